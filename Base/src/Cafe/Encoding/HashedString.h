@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Strings.h"
+
+namespace Cafe::Encoding
+{
+	/// @brief  缓存散列值的字符串，用作散列表的键时避免重复计算散列值
+	/// @remark 构造及每次修改后立即重新计算散列值，GetHash 仅读取缓存，因此可在多个线程间并发调用
+	///         为保证缓存有效，仅能通过 Modify 修改内容
+	template <CodePage::CodePageType CodePageValue, typename HashPolicy = Detail::DefaultHashPolicy,
+	          typename Allocator =
+	              std::allocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>,
+	          std::size_t SsoThresholdSize = Detail::DefaultSsoThresholdSize,
+	          typename GrowPolicy = Detail::DefaultGrowPolicy>
+	class HashedString
+	{
+	public:
+		using StringType = String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>;
+
+		template <std::size_t Extent = std::dynamic_extent>
+		using ViewType = StringView<CodePageValue, Extent>;
+
+		constexpr HashedString() : m_String{}, m_Hash{ ComputeHash(m_String) }
+		{
+		}
+
+		constexpr HashedString(StringType str)
+		    : m_String{ std::move(str) }, m_Hash{ ComputeHash(m_String) }
+		{
+		}
+
+		template <std::size_t Extent>
+		constexpr HashedString(ViewType<Extent> const& str) : HashedString{ StringType{ str } }
+		{
+		}
+
+		[[nodiscard]] constexpr StringType const& GetString() const noexcept
+		{
+			return m_String;
+		}
+
+		[[nodiscard]] constexpr ViewType<> GetView() const noexcept
+		{
+			return m_String.GetView();
+		}
+
+		[[nodiscard]] constexpr operator ViewType<>() const noexcept
+		{
+			return GetView();
+		}
+
+		[[nodiscard]] constexpr std::size_t GetHash() const noexcept
+		{
+			return m_Hash;
+		}
+
+		/// @brief  以 func 修改字符串内容
+		/// @remark func 以 StringType& 调用，返回后（包括抛出异常时）重新计算散列值
+		/// @return func 的返回值
+		template <typename Func>
+		constexpr decltype(auto) Modify(Func&& func)
+		{
+			struct HashUpdater
+			{
+				HashedString& Self;
+
+				constexpr ~HashUpdater()
+				{
+					Self.m_Hash = ComputeHash(Self.m_String);
+				}
+			} updater{ *this };
+
+			return std::forward<Func>(func)(m_String);
+		}
+
+		[[nodiscard]] constexpr bool operator==(HashedString const& other) const noexcept
+		{
+			return m_Hash == other.m_Hash && m_String == other.m_String.GetView();
+		}
+
+		template <std::size_t Extent>
+		[[nodiscard]] constexpr bool operator==(ViewType<Extent> const& other) const noexcept
+		{
+			return m_String == other;
+		}
+
+	private:
+		StringType m_String;
+		std::size_t m_Hash;
+
+		[[nodiscard]] static constexpr std::size_t ComputeHash(StringType const& str) noexcept
+		{
+			return StringHasher<HashPolicy>{}(str.GetView());
+		}
+	};
+} // namespace Cafe::Encoding
+
+namespace std
+{
+	template <Cafe::Encoding::CodePage::CodePageType CodePageValue, typename HashPolicy,
+	          typename Allocator, std::size_t SsoThresholdSize, typename GrowPolicy>
+	struct hash<Cafe::Encoding::HashedString<CodePageValue, HashPolicy, Allocator, SsoThresholdSize,
+	                                         GrowPolicy>>
+	{
+		using is_transparent = void;
+
+		template <std::size_t Extent>
+		[[nodiscard]] constexpr std::size_t
+		operator()(Cafe::Encoding::StringView<CodePageValue, Extent> const& value) const noexcept
+		{
+			return Cafe::Encoding::StringHasher<HashPolicy>{}(value);
+		}
+
+		[[nodiscard]] constexpr std::size_t
+		operator()(Cafe::Encoding::HashedString<CodePageValue, HashPolicy, Allocator,
+		                                        SsoThresholdSize, GrowPolicy> const& value) const
+		    noexcept
+		{
+			return value.GetHash();
+		}
+	};
+} // namespace std
@@ -0,0 +1,471 @@
+#pragma once
+
+#include "Strings.h"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace Cafe::Encoding
+{
+	/// @brief  预先编译的多模式串查找器
+	/// @remark 以 Aho-Corasick 算法一次扫描即可找到所有模式串的所有出现位置（包括重叠的出现）
+	///         自动机按广度优先的顺序编号，根及深度为 1 的状态使用稠密的转移表（已展开失配转移），
+	///         更深的状态的转移以排序的数组紧凑存储；编码单元先映射为模式串中出现过的编码单元的编号以
+	///         缩小稠密表，编号过多以致稠密表过大时仅根使用稠密的转移表
+	///         处于根状态时跳过不可能是任何模式串首个编码单元的部分：所有模式串的首个编码单元为同一
+	///         字节时以 std::memchr 查找，否则逐个编码单元查表
+	///         对于变长代码页，仅报告起始于字符边界的出现，字符边界通过解码从字符串开头起依次确定
+	///         构造后不可修改，所有查找操作均为 const，因此可在多个线程间共享
+	template <CodePage::CodePageType CodePageValue>
+	class MultiSearcher
+	{
+		using UsingCodePageTrait = CodePage::CodePageTrait<CodePageValue>;
+		using CharType = typename UsingCodePageTrait::CharType;
+		using StateType = std::uint32_t;
+
+		static constexpr StateType NoState = StateType(-1);
+		static constexpr std::size_t NoPattern = std::size_t(-1);
+
+	public:
+		/// @param  patterns    模式串，以空编码单元结尾时结尾的空编码单元不参与查找，空模式串不会被报告
+		explicit MultiSearcher(std::span<const StringView<CodePageValue>> const& patterns)
+		    : m_PatternSizes(patterns.size()), m_PatternNext(patterns.size(), NoPattern),
+		      m_ClassCount{ 1 }, m_MaxPatternSize{}
+		{
+			BuildClasses(patterns);
+			BuildAutomaton(patterns);
+		}
+
+		MultiSearcher(std::initializer_list<StringView<CodePageValue>> patterns)
+		    : MultiSearcher(std::span<const StringView<CodePageValue>>(patterns.begin(),
+		                                                               patterns.size()))
+		{
+		}
+
+		[[nodiscard]] std::size_t GetPatternCount() const noexcept
+		{
+			return m_PatternSizes.size();
+		}
+
+		/// @brief  扫描 str 并报告所有模式串的出现
+		/// @param  receiver    以模式串的下标及出现的位置调用，若返回 Core::Misc::ControlFlowVariant
+		///                     则可提前终止
+		/// @remark 按出现的结尾位置的顺序报告，结尾位置相同时较长的模式串先报告
+		template <std::size_t Extent, typename Receiver>
+		void Scan(StringView<CodePageValue, Extent> const& str, Receiver&& receiver) const
+		{
+			const auto data = str.GetData();
+			const auto size = str.GetSize();
+
+			[[maybe_unused]] BoundaryTracker boundaryTracker{ data, size, m_MaxPatternSize };
+
+			StateType state = 0;
+			for (std::size_t pos = 0; pos < size; ++pos)
+			{
+				if (!state)
+				{
+					pos = SkipToCandidate(data, pos, size);
+					if (pos == size)
+					{
+						break;
+					}
+				}
+
+				state = Transit(state, GetClass(data[pos]));
+
+				const auto& node = m_Nodes[state];
+				for (auto outputState = node.FirstPattern != NoPattern ? state : node.DictLink;
+				     outputState != NoState; outputState = m_Nodes[outputState].DictLink)
+				{
+					for (auto pattern = m_Nodes[outputState].FirstPattern; pattern != NoPattern;
+					     pattern = m_PatternNext[pattern])
+					{
+						const auto startPos = pos + 1 - m_PatternSizes[pattern];
+						if constexpr (UsingCodePageTrait::IsVariableWidth)
+						{
+							if (!boundaryTracker.IsBoundary(startPos))
+							{
+								continue;
+							}
+						}
+
+						if constexpr (Core::Misc::IsCallableReturningControlFlow<
+						                  Receiver, std::size_t, std::size_t>::value)
+						{
+							if (std::forward<Receiver>(receiver)(pattern, startPos).IsBreak())
+							{
+								return;
+							}
+						}
+						else
+						{
+							std::forward<Receiver>(receiver)(pattern, startPos);
+						}
+					}
+				}
+			}
+		}
+
+	private:
+		struct Node
+		{
+			// 更深的状态的转移在 m_Edges 中的范围，稠密状态不使用
+			StateType EdgeBegin;
+			StateType EdgeEnd;
+			StateType Fail;
+			// 失配链上最近的有模式串结束的状态
+			StateType DictLink;
+			// 在此结束的模式串，其余在此结束的模式串以 m_PatternNext 链接
+			std::size_t FirstPattern;
+		};
+
+		struct Edge
+		{
+			std::size_t Class;
+			StateType Target;
+		};
+
+		// 对于单字节编码单元直接查表，否则在排序的编码单元中二分查找
+		static constexpr bool IsByteUnit = sizeof(CharType) == 1;
+
+		// 深度为 1 的状态使用稠密转移表时稠密表的最大项数，单字节编码单元时总不会超出
+		static constexpr std::size_t MaxDenseTransitionCount = 257 * 257;
+
+		std::vector<std::size_t> m_PatternSizes;
+		std::vector<std::size_t> m_PatternNext;
+
+		std::array<std::uint16_t, 256> m_ByteClasses{};
+		std::vector<CharType> m_SortedUnits;
+		std::size_t m_ClassCount;
+
+		std::vector<Node> m_Nodes;
+		std::vector<Edge> m_Edges;
+		// 状态编号小于 m_DenseStateCount 的状态使用稠密转移表，每个状态 m_ClassCount 项
+		StateType m_DenseStateCount;
+		std::vector<StateType> m_DenseTransitions;
+
+		std::array<bool, 256> m_IsFirstByte{};
+		// 所有模式串的首个编码单元相同时为该编码单元，否则为 -1
+		int m_SingleFirstByte{ -1 };
+		std::vector<bool> m_IsFirstClass;
+
+		std::size_t m_MaxPatternSize;
+
+		[[nodiscard]] std::size_t GetClass(CharType unit) const noexcept
+		{
+			if constexpr (IsByteUnit)
+			{
+				return m_ByteClasses[static_cast<unsigned char>(unit)];
+			}
+			else
+			{
+				const auto iter = std::lower_bound(m_SortedUnits.begin(), m_SortedUnits.end(), unit);
+				return iter != m_SortedUnits.end() && *iter == unit
+				           ? static_cast<std::size_t>(iter - m_SortedUnits.begin()) + 1
+				           : 0;
+			}
+		}
+
+		[[nodiscard]] StateType Transit(StateType state, std::size_t unitClass) const noexcept
+		{
+			while (state >= m_DenseStateCount)
+			{
+				const auto& node = m_Nodes[state];
+				const auto begin = m_Edges.begin() + node.EdgeBegin,
+				           end = m_Edges.begin() + node.EdgeEnd;
+				const auto iter = std::lower_bound(
+				    begin, end, unitClass,
+				    [](Edge const& edge, std::size_t value) { return edge.Class < value; });
+				if (iter != end && iter->Class == unitClass)
+				{
+					return iter->Target;
+				}
+
+				state = node.Fail;
+			}
+
+			return m_DenseTransitions[state * m_ClassCount + unitClass];
+		}
+
+		[[nodiscard]] std::size_t SkipToCandidate(const CharType* data, std::size_t pos,
+		                                          std::size_t size) const noexcept
+		{
+			if constexpr (IsByteUnit)
+			{
+				if (m_SingleFirstByte >= 0)
+				{
+					const auto found = std::memchr(data + pos, m_SingleFirstByte, size - pos);
+					return found
+					           ? static_cast<std::size_t>(static_cast<const CharType*>(found) - data)
+					           : size;
+				}
+
+				while (pos < size && !m_IsFirstByte[static_cast<unsigned char>(data[pos])])
+				{
+					++pos;
+				}
+			}
+			else
+			{
+				while (pos < size && !m_IsFirstClass[GetClass(data[pos])])
+				{
+					++pos;
+				}
+			}
+
+			return pos;
+		}
+
+		void BuildClasses(std::span<const StringView<CodePageValue>> const& patterns)
+		{
+			if constexpr (IsByteUnit)
+			{
+				std::array<bool, 256> used{};
+				for (const auto& pattern : patterns)
+				{
+					for (const auto unit : pattern.GetTrimmedSpan())
+					{
+						used[static_cast<unsigned char>(unit)] = true;
+					}
+				}
+
+				for (std::size_t i = 0; i < used.size(); ++i)
+				{
+					if (used[i])
+					{
+						m_ByteClasses[i] = static_cast<std::uint16_t>(m_ClassCount++);
+					}
+				}
+			}
+			else
+			{
+				for (const auto& pattern : patterns)
+				{
+					const auto span = pattern.GetTrimmedSpan();
+					m_SortedUnits.insert(m_SortedUnits.end(), span.begin(), span.end());
+				}
+				std::sort(m_SortedUnits.begin(), m_SortedUnits.end());
+				m_SortedUnits.erase(std::unique(m_SortedUnits.begin(), m_SortedUnits.end()),
+				                    m_SortedUnits.end());
+				m_SortedUnits.shrink_to_fit();
+				m_ClassCount = m_SortedUnits.size() + 1;
+			}
+
+			m_IsFirstClass.assign(m_ClassCount, false);
+			for (const auto& pattern : patterns)
+			{
+				const auto span = pattern.GetTrimmedSpan();
+				if (!span.empty())
+				{
+					m_IsFirstClass[GetClass(span[0])] = true;
+					if constexpr (IsByteUnit)
+					{
+						m_IsFirstByte[static_cast<unsigned char>(span[0])] = true;
+					}
+				}
+			}
+
+			if constexpr (IsByteUnit)
+			{
+				if (std::count(m_IsFirstByte.begin(), m_IsFirstByte.end(), true) == 1)
+				{
+					m_SingleFirstByte = static_cast<int>(
+					    std::find(m_IsFirstByte.begin(), m_IsFirstByte.end(), true) -
+					    m_IsFirstByte.begin());
+				}
+			}
+		}
+
+		void BuildAutomaton(std::span<const StringView<CodePageValue>> const& patterns)
+		{
+			// 先以临时的字典树构建，再按广度优先的顺序重新编号
+			struct TrieNode
+			{
+				std::vector<Edge> Children;
+				std::size_t FirstPattern = NoPattern;
+			};
+
+			std::vector<TrieNode> trie(1);
+			for (std::size_t i = 0; i < patterns.size(); ++i)
+			{
+				const auto span = patterns[i].GetTrimmedSpan();
+				m_PatternSizes[i] = span.size();
+				m_MaxPatternSize = std::max(m_MaxPatternSize, span.size());
+				if (span.empty())
+				{
+					continue;
+				}
+
+				StateType current = 0;
+				for (const auto unit : span)
+				{
+					const auto unitClass = GetClass(unit);
+					auto& children = trie[current].Children;
+					const auto iter =
+					    std::find_if(children.begin(), children.end(),
+					                 [&](Edge const& edge) { return edge.Class == unitClass; });
+					if (iter != children.end())
+					{
+						current = iter->Target;
+					}
+					else
+					{
+						const auto next = static_cast<StateType>(trie.size());
+						children.push_back({ unitClass, next });
+						trie.emplace_back();
+						current = next;
+					}
+				}
+
+				// 保持较小的下标先报告
+				auto* link = &trie[current].FirstPattern;
+				while (*link != NoPattern)
+				{
+					link = &m_PatternNext[*link];
+				}
+				*link = i;
+			}
+
+			// 广度优先编号
+			std::vector<StateType> order{ 0 };
+			std::vector<StateType> newIndex(trie.size());
+			std::vector<std::size_t> depth(trie.size());
+			for (std::size_t i = 0; i < order.size(); ++i)
+			{
+				newIndex[order[i]] = static_cast<StateType>(i);
+				auto& children = trie[order[i]].Children;
+				std::sort(children.begin(), children.end(),
+				          [](Edge const& a, Edge const& b) { return a.Class < b.Class; });
+				for (const auto& child : children)
+				{
+					depth[child.Target] = depth[order[i]] + 1;
+					order.push_back(child.Target);
+				}
+			}
+
+			// 编码单元的编号过多时深度为 1 的状态的稠密转移表占用过多内存，此时仅根使用稠密转移表
+			m_DenseStateCount =
+			    (1 + trie[0].Children.size()) * m_ClassCount <= MaxDenseTransitionCount
+			        ? static_cast<StateType>(1 + trie[0].Children.size())
+			        : 1;
+			m_Nodes.resize(trie.size());
+			m_DenseTransitions.assign(m_DenseStateCount * m_ClassCount, 0);
+
+			for (std::size_t i = 0; i < order.size(); ++i)
+			{
+				const auto& trieNode = trie[order[i]];
+				auto& node = m_Nodes[i];
+				node.FirstPattern = trieNode.FirstPattern;
+				node.EdgeBegin = static_cast<StateType>(m_Edges.size());
+				if (i >= m_DenseStateCount)
+				{
+					for (const auto& child : trieNode.Children)
+					{
+						m_Edges.push_back({ child.Class, newIndex[child.Target] });
+					}
+				}
+				node.EdgeEnd = static_cast<StateType>(m_Edges.size());
+			}
+			m_Edges.shrink_to_fit();
+
+			// 按广度优先的顺序计算失配转移，此时较浅的状态的转移均已可用
+			m_Nodes[0].Fail = 0;
+			m_Nodes[0].DictLink = NoState;
+			for (const auto& child : trie[0].Children)
+			{
+				m_DenseTransitions[child.Class] = newIndex[child.Target];
+			}
+
+			for (std::size_t i = 1; i < order.size(); ++i)
+			{
+				const auto state = static_cast<StateType>(i);
+				auto& node = m_Nodes[state];
+				if (depth[order[i]] == 1)
+				{
+					node.Fail = 0;
+				}
+
+				const auto fail = node.Fail;
+				node.DictLink =
+				    m_Nodes[fail].FirstPattern != NoPattern ? fail : m_Nodes[fail].DictLink;
+
+				if (state < m_DenseStateCount)
+				{
+					// 深度为 1 的状态的失配状态为根，展开为稠密转移
+					const auto row = m_DenseTransitions.begin() + state * m_ClassCount;
+					std::copy_n(m_DenseTransitions.begin(), m_ClassCount, row);
+					for (const auto& child : trie[order[i]].Children)
+					{
+						row[child.Class] = newIndex[child.Target];
+					}
+				}
+
+				for (const auto& child : trie[order[i]].Children)
+				{
+					m_Nodes[newIndex[child.Target]].Fail = Transit(fail, child.Class);
+				}
+			}
+		}
+
+		/// @brief  按需从字符串开头起确定字符边界
+		/// @remark 仅保留最近的若干位置的信息，由于出现的起始位置不早于当前位置减去最长模式串的长度，
+		///         且确定边界的位置不会超出当前位置加上最大字符宽度，因此足以判断
+		class BoundaryTracker
+		{
+		public:
+			BoundaryTracker(const CharType* data, std::size_t size, std::size_t maxPatternSize)
+			    : m_Data{ data }, m_Size{ size }, m_Next{}, m_Mask{}, m_Flags{}
+			{
+				if constexpr (UsingCodePageTrait::IsVariableWidth)
+				{
+					std::size_t ringSize = 64;
+					while (ringSize < maxPatternSize + CodePage::GetMaxWidth<CodePageValue>() + 1)
+					{
+						ringSize *= 2;
+					}
+					m_Mask = ringSize - 1;
+
+					if (ringSize <= m_LocalFlags.size())
+					{
+						m_Flags = m_LocalFlags.data();
+					}
+					else
+					{
+						m_HeapFlags = std::make_unique<bool[]>(ringSize);
+						m_Flags = m_HeapFlags.get();
+					}
+				}
+			}
+
+			[[nodiscard]] bool IsBoundary(std::size_t pos) noexcept
+			{
+				while (m_Next <= pos && m_Next < m_Size)
+				{
+					// 以解码确定宽度，GetWidth 无法区分 GB18030 的双字节及四字节编码
+					const auto step =
+					    Detail::GetLeadingCharWidth<CodePageValue>(m_Data + m_Next, m_Size - m_Next);
+					m_Flags[m_Next & m_Mask] = true;
+					for (std::size_t i = 1; i < step; ++i)
+					{
+						m_Flags[(m_Next + i) & m_Mask] = false;
+					}
+					m_Next += step;
+				}
+
+				return m_Flags[pos & m_Mask];
+			}
+
+		private:
+			const CharType* m_Data;
+			std::size_t m_Size;
+			// 下一个尚未确定的字符边界
+			std::size_t m_Next;
+			std::size_t m_Mask;
+			bool* m_Flags;
+			std::array<bool, 1024> m_LocalFlags;
+			std::unique_ptr<bool[]> m_HeapFlags;
+		};
+	};
+} // namespace Cafe::Encoding
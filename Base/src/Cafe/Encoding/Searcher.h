@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Strings.h"
+#include <array>
+#include <vector>
+
+namespace Cafe::Encoding
+{
+	/// @brief  预先编译的模式串查找器
+	/// @remark 构造时复制模式串并根据其长度选择算法、计算所需的表，之后可对任意多个字符串重复查找
+	///         构造后不可修改，所有查找操作均为 const 且不修改任何状态，因此可在多个线程间共享
+	///         模式串以空编码单元结尾时，结尾的空编码单元不参与查找
+	template <CodePage::CodePageType CodePageValue>
+	class Searcher
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+	public:
+		static constexpr std::size_t Npos = std::size_t(-1);
+
+		/// @brief  不大于此长度的模式串使用首尾编码单元筛选
+		static constexpr std::size_t MaxFilterPatternSize = 16;
+
+		enum class Algorithm
+		{
+			Filter,   ///< @brief 首尾编码单元筛选，适用于短模式串
+			Horspool, ///< @brief Boyer-Moore-Horspool，适用于非周期的长模式串
+			TwoWay,   ///< @brief Two-Way，适用于周期的长模式串
+		};
+
+		template <std::size_t Extent>
+		explicit Searcher(StringView<CodePageValue, Extent> const& pattern)
+		    : m_Pattern(pattern.GetTrimmedSpan().begin(), pattern.GetTrimmedSpan().end()),
+		      m_Algorithm{ Algorithm::Filter }, m_Factorization{}, m_Shift{}
+		{
+			const auto patternSize = m_Pattern.size();
+			if (!patternSize)
+			{
+				return;
+			}
+
+			m_Factorization = Detail::TwoWayFactorize(m_Pattern.data(), patternSize);
+			if (patternSize <= MaxFilterPatternSize)
+			{
+				return;
+			}
+
+			if (m_Factorization.IsPeriodic)
+			{
+				// Horspool 在周期的模式串上容易退化
+				m_Algorithm = Algorithm::TwoWay;
+				return;
+			}
+
+			m_Algorithm = Algorithm::Horspool;
+			m_Shift.fill(patternSize);
+			for (std::size_t i = 0; i + 1 < patternSize; ++i)
+			{
+				m_Shift[GetShiftIndex(m_Pattern[i])] = patternSize - 1 - i;
+			}
+		}
+
+		[[nodiscard]] StringView<CodePageValue> GetPattern() const noexcept
+		{
+			return std::span<const CharType>(m_Pattern);
+		}
+
+		[[nodiscard]] Algorithm GetAlgorithm() const noexcept
+		{
+			return m_Algorithm;
+		}
+
+		/// @brief  查找模式串在 str 中从 startPos 开始首次出现的位置
+		/// @return 出现的位置，未找到时返回 Npos
+		template <std::size_t Extent>
+		[[nodiscard]] std::size_t FindIn(StringView<CodePageValue, Extent> const& str,
+		                                 std::size_t startPos = 0) const noexcept
+		{
+			const auto size = str.GetSize();
+			if (startPos > size)
+			{
+				return Npos;
+			}
+
+			const auto result = FindInSpan(str.GetData() + startPos, size - startPos);
+			return result == Npos ? Npos : result + startPos;
+		}
+
+		/// @brief  按顺序查找模式串在 str 中所有不重叠的出现位置
+		/// @param  receiver    接受出现位置的回调，若返回 Core::Misc::ControlFlowVariant 则可提前终止
+		/// @remark 空模式串不视为出现
+		template <std::size_t Extent, typename Receiver>
+		void FindAllIn(StringView<CodePageValue, Extent> const& str, Receiver&& receiver) const
+		{
+			const auto patternSize = m_Pattern.size();
+			if (!patternSize)
+			{
+				return;
+			}
+
+			for (auto pos = FindIn(str); pos != Npos; pos = FindIn(str, pos + patternSize))
+			{
+				if constexpr (Core::Misc::IsCallableReturningControlFlow<Receiver,
+				                                                         std::size_t>::value)
+				{
+					if (std::forward<Receiver>(receiver)(pos).IsBreak())
+					{
+						return;
+					}
+				}
+				else
+				{
+					std::forward<Receiver>(receiver)(pos);
+				}
+			}
+		}
+
+		/// @brief  计算模式串在 str 中不重叠的出现次数
+		template <std::size_t Extent>
+		[[nodiscard]] std::size_t
+		CountIn(StringView<CodePageValue, Extent> const& str) const noexcept
+		{
+			std::size_t count = 0;
+			FindAllIn(str, [&](std::size_t) { ++count; });
+			return count;
+		}
+
+	private:
+		std::vector<CharType> m_Pattern;
+		Algorithm m_Algorithm;
+		Detail::TwoWayFactorization m_Factorization;
+		// Horspool 的位移表，以编码单元的低 8 位索引，冲突时取较小的位移因此仍然正确
+		std::array<std::size_t, 256> m_Shift;
+
+		static constexpr std::size_t GetShiftIndex(CharType value) noexcept
+		{
+			return static_cast<std::size_t>(value) & 0xFF;
+		}
+
+		std::size_t FindInSpan(const CharType* str, std::size_t size) const noexcept
+		{
+			const auto pattern = m_Pattern.data();
+			const auto patternSize = m_Pattern.size();
+			if (!patternSize)
+			{
+				return 0;
+			}
+
+			if (patternSize > size)
+			{
+				return Npos;
+			}
+
+			switch (m_Algorithm)
+			{
+			default:
+				assert(!"Should never happen.");
+				[[fallthrough]];
+			case Algorithm::Filter:
+				return Detail::FilterFind(str, size, pattern, patternSize, &m_Factorization);
+			case Algorithm::TwoWay:
+				return Detail::TwoWayFind(str, size, pattern, patternSize, m_Factorization);
+			case Algorithm::Horspool:
+				return HorspoolFind(str, size);
+			}
+		}
+
+		/// @remark 与 Detail::FilterFind 相同，比较的总开销超出已扫描长度的一定比例时剩余部分改用 Two-Way
+		std::size_t HorspoolFind(const CharType* str, std::size_t size) const noexcept
+		{
+			const auto pattern = m_Pattern.data();
+			const auto patternSize = m_Pattern.size();
+			const auto lastOffset = patternSize - 1;
+			const auto lastUnit = pattern[lastOffset];
+			std::size_t verifyCost = 0;
+
+			for (std::size_t pos = 0; pos + patternSize <= size;)
+			{
+				const auto unit = str[pos + lastOffset];
+				if (unit == lastUnit)
+				{
+					if (Detail::UnitsEqual(str + pos, pattern, lastOffset))
+					{
+						return pos;
+					}
+
+					verifyCost += patternSize;
+					if (verifyCost > 2 * pos + 8 * patternSize)
+					{
+						const auto result = Detail::TwoWayFind(
+						    str + pos + 1, size - pos - 1, pattern, patternSize, m_Factorization);
+						return result == Npos ? Npos : result + pos + 1;
+					}
+				}
+
+				pos += m_Shift[GetShiftIndex(unit)];
+			}
+
+			return Npos;
+		}
+	};
+} // namespace Cafe::Encoding
@@ -0,0 +1,284 @@
+#pragma once
+
+#include "Strings.h"
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Cafe::Encoding
+{
+	/// @brief  字符串的单调分配区
+	/// @remark 分配时仅移动当前块中的偏移，不单独释放各次分配的内存，适用于在一次请求中构建大量
+	///         生存期相同的临时字符串，请求结束时调用 Reset 一并回收
+	///         Reset 后保留已分配的块以供之后的请求复用，Release 才真正释放内存
+	///         非线程安全，通常每个线程或每个请求使用一个分配区
+	class StringArena
+	{
+	public:
+		static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+		/// @param  chunkSize   每块的字节数，超过此大小的分配将单独占用一块
+		explicit StringArena(std::size_t chunkSize = DefaultChunkSize) noexcept
+		    : m_ChunkSize{ chunkSize }, m_CurrentChunk{}, m_Offset{}
+		{
+		}
+
+		StringArena(StringArena const&) = delete;
+		StringArena(StringArena&& other) noexcept
+		    : m_ChunkSize{ other.m_ChunkSize }, m_Chunks{ std::move(other.m_Chunks) },
+		      m_CurrentChunk{ std::exchange(other.m_CurrentChunk, 0) }, m_Offset{ std::exchange(
+			                                                                other.m_Offset, 0) }
+		{
+		}
+
+		StringArena& operator=(StringArena const&) = delete;
+		StringArena& operator=(StringArena&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_ChunkSize = other.m_ChunkSize;
+				m_Chunks = std::move(other.m_Chunks);
+				m_CurrentChunk = std::exchange(other.m_CurrentChunk, 0);
+				m_Offset = std::exchange(other.m_Offset, 0);
+			}
+
+			return *this;
+		}
+
+		/// @brief  分配 size 字节且按 alignment 对齐的内存
+		/// @remark alignment 必须为 2 的幂，且不大于 __STDCPP_DEFAULT_NEW_ALIGNMENT__
+		[[nodiscard]] void* Allocate(std::size_t size,
+		                             std::size_t alignment = alignof(std::max_align_t))
+		{
+			assert(alignment && (alignment & (alignment - 1)) == 0);
+			assert(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+			if (m_CurrentChunk < m_Chunks.size())
+			{
+				if (const auto result = TryAllocate(m_Chunks[m_CurrentChunk], size, alignment))
+				{
+					return result;
+				}
+
+				// 复用之前的请求遗留的块
+				while (++m_CurrentChunk < m_Chunks.size())
+				{
+					m_Offset = 0;
+					if (const auto result = TryAllocate(m_Chunks[m_CurrentChunk], size, alignment))
+					{
+						return result;
+					}
+				}
+			}
+
+			// 已无可复用的块
+			const auto chunkSize = std::max(m_ChunkSize, size);
+			m_Chunks.push_back(
+			    Chunk{ std::make_unique_for_overwrite<std::byte[]>(chunkSize), chunkSize });
+			m_CurrentChunk = m_Chunks.size() - 1;
+			m_Offset = 0;
+			const auto result = TryAllocate(m_Chunks[m_CurrentChunk], size, alignment);
+			assert(result);
+			return result;
+		}
+
+		/// @brief  释放由 Allocate 分配的内存
+		/// @remark 仅当其为当前块中最后一次分配时回收其空间，其他情况不做任何事
+		void Deallocate(void* ptr, std::size_t size) noexcept
+		{
+			if (m_CurrentChunk < m_Chunks.size())
+			{
+				const auto storage = m_Chunks[m_CurrentChunk].Storage.get();
+				if (static_cast<std::byte*>(ptr) + size == storage + m_Offset)
+				{
+					m_Offset = static_cast<std::byte*>(ptr) - storage;
+				}
+			}
+		}
+
+		/// @brief  回收所有分配，保留已分配的块供之后复用
+		/// @remark 由本分配区分配的字符串及视图均将失效
+		void Reset() noexcept
+		{
+			m_CurrentChunk = 0;
+			m_Offset = 0;
+		}
+
+		/// @brief  回收所有分配并释放所有块
+		void Release() noexcept
+		{
+			m_Chunks.clear();
+			Reset();
+		}
+
+		/// @brief  获得已分配的块的总字节数
+		[[nodiscard]] std::size_t GetReservedSize() const noexcept
+		{
+			std::size_t result{};
+			for (const auto& chunk : m_Chunks)
+			{
+				result += chunk.Size;
+			}
+			return result;
+		}
+
+		/// @brief  复制 str 到分配区中
+		/// @return 以 0 结尾的视图，生存期至下次 Reset 或 Release 为止
+		template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+		[[nodiscard]] StringView<CodePageValue> Copy(StringView<CodePageValue, Extent> const& str)
+		{
+			using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+			const auto span = str.GetTrimmedSpan();
+			const auto storage = AllocateUnits<CharType>(span.size() + 1);
+			std::copy(span.begin(), span.end(), storage);
+			storage[span.size()] = CharType{};
+			return std::span<const CharType>(storage, span.size() + 1);
+		}
+
+		/// @brief  将 str 编码到 ToCodePageValue，结果存放在分配区中
+		/// @return 编码的结果以及以 0 结尾的视图，生存期至下次 Reset 或 Release 为止
+		///         编码失败时视图包含失败前已编码的部分
+		template <CodePage::CodePageType ToCodePageValue, CodePage::CodePageType FromCodePageValue,
+		          std::size_t Extent>
+		[[nodiscard]] std::pair<EncodingResultCode, StringView<ToCodePageValue>>
+		Encode(StringView<FromCodePageValue, Extent> const& str)
+		{
+			using ToCharType = typename CodePage::CodePageTrait<ToCodePageValue>::CharType;
+
+			const auto span = str.GetTrimmedSpan();
+			// 先计算大小以精确分配，避免在分配区中留下无法回收的中间结果
+			const auto [resultCode, size] =
+			    CountEncodeSize<FromCodePageValue, ToCodePageValue>(span);
+			const auto storage = AllocateUnits<ToCharType>(size + 1);
+			auto iter = storage;
+			Encoder<FromCodePageValue, ToCodePageValue>::EncodeAll(span, [&](auto const& result) {
+				if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+				{
+					if constexpr (CodePage::CodePageTrait<ToCodePageValue>::IsVariableWidth)
+					{
+						iter = std::copy(result.Result.begin(), result.Result.end(), iter);
+					}
+					else
+					{
+						*iter++ = result.Result;
+					}
+				}
+			});
+			*iter = ToCharType{};
+
+			return { resultCode, StringView<ToCodePageValue>{
+				                     std::span<const ToCharType>(storage, size + 1) } };
+		}
+
+		/// @brief  创建使用本分配区的空字符串
+		template <CodePage::CodePageType CodePageValue>
+		[[nodiscard]] auto MakeString();
+
+		/// @brief  创建使用本分配区的字符串，内容复制自 str
+		template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+		[[nodiscard]] auto MakeString(StringView<CodePageValue, Extent> const& str);
+
+	private:
+		struct Chunk
+		{
+			std::unique_ptr<std::byte[]> Storage;
+			std::size_t Size;
+		};
+
+		std::size_t m_ChunkSize;
+		std::vector<Chunk> m_Chunks;
+		std::size_t m_CurrentChunk;
+		std::size_t m_Offset;
+
+		void* TryAllocate(Chunk const& chunk, std::size_t size, std::size_t alignment) noexcept
+		{
+			const auto alignedOffset = (m_Offset + alignment - 1) & ~(alignment - 1);
+			if (alignedOffset > chunk.Size || chunk.Size - alignedOffset < size)
+			{
+				return nullptr;
+			}
+
+			m_Offset = alignedOffset + size;
+			return chunk.Storage.get() + alignedOffset;
+		}
+
+		template <typename CharType>
+		CharType* AllocateUnits(std::size_t count)
+		{
+			return static_cast<CharType*>(Allocate(count * sizeof(CharType), alignof(CharType)));
+		}
+	};
+
+	/// @brief  从 StringArena 分配内存的分配器
+	/// @remark 释放内存通常不做任何事，内存在 StringArena::Reset 时一并回收
+	///         不能默认构造，使用此分配器的字符串需显式传入分配器
+	template <typename T>
+	class ArenaAllocator
+	{
+		template <typename U>
+		friend class ArenaAllocator;
+
+	public:
+		using value_type = T;
+
+		constexpr ArenaAllocator(StringArena& arena) noexcept : m_Arena{ &arena }
+		{
+		}
+
+		template <typename U>
+		constexpr ArenaAllocator(ArenaAllocator<U> const& other) noexcept : m_Arena{ other.m_Arena }
+		{
+		}
+
+		[[nodiscard]] T* allocate(std::size_t n)
+		{
+			return static_cast<T*>(m_Arena->Allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			m_Arena->Deallocate(ptr, n * sizeof(T));
+		}
+
+		[[nodiscard]] constexpr StringArena& GetArena() const noexcept
+		{
+			return *m_Arena;
+		}
+
+		template <typename U>
+		[[nodiscard]] constexpr bool operator==(ArenaAllocator<U> const& other) const noexcept
+		{
+			return m_Arena == other.m_Arena;
+		}
+
+	private:
+		StringArena* m_Arena;
+	};
+
+	/// @brief  使用 StringArena 分配内存的字符串
+	/// @remark 生存期不能超过所使用的分配区的下次 Reset 或 Release
+	template <CodePage::CodePageType CodePageValue,
+	          std::size_t SsoThresholdSize = Detail::DefaultSsoThresholdSize,
+	          typename GrowPolicy = Detail::DefaultGrowPolicy>
+	using ArenaString =
+	    String<CodePageValue, ArenaAllocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>,
+	           SsoThresholdSize, GrowPolicy>;
+
+	template <CodePage::CodePageType CodePageValue>
+	[[nodiscard]] auto StringArena::MakeString()
+	{
+		return ArenaString<CodePageValue>{
+			ArenaAllocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>{ *this }
+		};
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+	[[nodiscard]] auto StringArena::MakeString(StringView<CodePageValue, Extent> const& str)
+	{
+		return ArenaString<CodePageValue>{
+			str, ArenaAllocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>{ *this }
+		};
+	}
+} // namespace Cafe::Encoding
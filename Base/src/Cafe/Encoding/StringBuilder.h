@@ -0,0 +1,267 @@
+#pragma once
+
+#include "Strings.h"
+#include <vector>
+
+namespace Cafe::Encoding
+{
+	/// @brief  分块构建字符串
+	/// @remark 追加的内容写入一系列固定大小的块，已写入的内容不会因追加而被复制或移动，
+	///         完成后以 ToString 一次性复制到大小恰好的 String，或以 ForEachChunk 逐块输出
+	///         适用于构建较大的字符串，峰值内存约为最终大小加上一块
+	///         不存储结尾的空编码单元
+	template <CodePage::CodePageType CodePageValue,
+	          typename Allocator =
+	              std::allocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>>
+	class StringBuilder
+	{
+		using UsingCodePageTrait = CodePage::CodePageTrait<CodePageValue>;
+		using CharType = typename UsingCodePageTrait::CharType;
+
+	public:
+		/// @brief  默认每块的编码单元数
+		static constexpr std::size_t DefaultChunkSize = 16 * 1024;
+
+		explicit StringBuilder(std::size_t chunkSize = DefaultChunkSize,
+		                       Allocator const& allocator = Allocator{})
+		    : m_Allocator{ allocator }, m_ChunkSize{ chunkSize }, m_CurrentChunk{}, m_Size{}
+		{
+			assert(chunkSize > 0);
+		}
+
+		StringBuilder(StringBuilder const&) = delete;
+		StringBuilder(StringBuilder&& other) noexcept
+		    : m_Allocator{ other.m_Allocator }, m_ChunkSize{ other.m_ChunkSize },
+		      m_Chunks{ std::move(other.m_Chunks) }, m_CurrentChunk{ std::exchange(
+			                                             other.m_CurrentChunk, 0) },
+		      m_Size{ std::exchange(other.m_Size, 0) }
+		{
+		}
+
+		StringBuilder& operator=(StringBuilder const&) = delete;
+
+		~StringBuilder()
+		{
+			for (const auto& chunk : m_Chunks)
+			{
+				std::allocator_traits<Allocator>::deallocate(m_Allocator, chunk.Data,
+				                                             chunk.Capacity);
+			}
+		}
+
+		/// @brief  获得已追加的编码单元数，不包含结尾的空编码单元
+		[[nodiscard]] std::size_t GetSize() const noexcept
+		{
+			return m_Size;
+		}
+
+		[[nodiscard]] bool IsEmpty() const noexcept
+		{
+			return !m_Size;
+		}
+
+		template <std::size_t Extent>
+		void Append(std::span<const CharType, Extent> const& src)
+		{
+			auto remained = std::span<const CharType>(src);
+			while (!remained.empty())
+			{
+				auto& chunk = PrepareChunk();
+				const auto count = std::min(remained.size(), chunk.Capacity - chunk.Size);
+				std::copy_n(remained.data(), count, chunk.Data + chunk.Size);
+				chunk.Size += count;
+				m_Size += count;
+				remained = remained.subspan(count);
+			}
+		}
+
+		/// @remark 结尾的空编码单元不会被追加
+		template <std::size_t Extent>
+		void Append(StringView<CodePageValue, Extent> const& str)
+		{
+			Append(str.GetTrimmedSpan());
+		}
+
+		/// @brief  将其他代码页的字符串编码后追加
+		/// @return 编码的结果，失败时已追加失败前编码的部分
+		template <CodePage::CodePageType OtherCodePageValue, std::size_t Extent>
+		EncodingResultCode Append(StringView<OtherCodePageValue, Extent> const& str)
+		{
+			auto resultCode = EncodingResultCode::Accept;
+			Encoder<OtherCodePageValue, CodePageValue>::EncodeAll(
+			    str.GetTrimmedSpan(), [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    if constexpr (UsingCodePageTrait::IsVariableWidth)
+					    {
+						    Append(result.Result);
+					    }
+					    else
+					    {
+						    Append(result.Result, 1);
+					    }
+				    }
+				    else
+				    {
+					    resultCode = GetEncodingResultCode<decltype(result)>;
+				    }
+			    });
+			return resultCode;
+		}
+
+		void Append(CharType value, std::size_t count = 1)
+		{
+			while (count)
+			{
+				auto& chunk = PrepareChunk();
+				const auto fillCount = std::min(count, chunk.Capacity - chunk.Size);
+				std::fill_n(chunk.Data + chunk.Size, fillCount, value);
+				chunk.Size += fillCount;
+				m_Size += fillCount;
+				count -= fillCount;
+			}
+		}
+
+		/// @brief  将码点编码后追加
+		/// @return 编码的结果
+		EncodingResultCode AppendCodePoint(CodePointType codePoint)
+		{
+			auto resultCode = EncodingResultCode::Accept;
+			Encoder<CodePage::CodePoint, CodePageValue>::Encode(codePoint, [&](auto const& result) {
+				if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+				{
+					if constexpr (UsingCodePageTrait::IsVariableWidth)
+					{
+						Append(result.Result);
+					}
+					else
+					{
+						Append(result.Result, 1);
+					}
+				}
+				else
+				{
+					resultCode = GetEncodingResultCode<decltype(result)>;
+				}
+			});
+			return resultCode;
+		}
+
+		/// @brief  清空内容，保留已分配的块以供复用
+		void Clear() noexcept
+		{
+			for (auto& chunk : m_Chunks)
+			{
+				chunk.Size = 0;
+			}
+			m_CurrentChunk = 0;
+			m_Size = 0;
+		}
+
+		/// @brief  按顺序以每块的内容调用 receiver
+		/// @param  receiver    接受 std::span<const CharType> 的回调，若返回
+		///                     Core::Misc::ControlFlowVariant 则可提前终止
+		template <typename Receiver>
+		void ForEachChunk(Receiver&& receiver) const
+		{
+			for (const auto& chunk : m_Chunks)
+			{
+				if (!chunk.Size)
+				{
+					break;
+				}
+
+				const auto span = std::span<const CharType>(chunk.Data, chunk.Size);
+				if constexpr (Core::Misc::IsCallableReturningControlFlow<
+				                  Receiver, std::span<const CharType>>::value)
+				{
+					if (std::forward<Receiver>(receiver)(span).IsBreak())
+					{
+						return;
+					}
+				}
+				else
+				{
+					std::forward<Receiver>(receiver)(span);
+				}
+			}
+		}
+
+		/// @brief  将内容复制到新的字符串
+		/// @remark 结果仅分配一次，且容量恰好容纳内容
+		template <std::size_t SsoThresholdSize = Detail::DefaultSsoThresholdSize,
+		          typename GrowPolicy = Detail::DefaultGrowPolicy,
+		          typename StringAllocator = std::allocator<CharType>>
+		[[nodiscard]] String<CodePageValue, StringAllocator, SsoThresholdSize, GrowPolicy>
+		ToString(StringAllocator allocator = std::allocator<CharType>{}) const
+		{
+			String<CodePageValue, StringAllocator, SsoThresholdSize, GrowPolicy> result{
+				std::move(allocator)
+			};
+			result.Reserve(m_Size + 1);
+			ForEachChunk([&](std::span<const CharType> const& span) {
+				// 以 0 结尾的 span 会被 Append 视为带有结尾的空编码单元，因此结尾的 0 单独追加
+				const auto zeroBegin =
+				    std::find_if(span.rbegin(), span.rend(), [](CharType unit) {
+					    return unit != CharType{};
+				    }).base();
+				const auto prefixSize = static_cast<std::size_t>(zeroBegin - span.begin());
+				result.Append(span.first(prefixSize));
+				if (prefixSize != span.size())
+				{
+					result.Append(CharType{}, span.size() - prefixSize);
+				}
+			});
+			return result;
+		}
+
+	private:
+		struct Chunk
+		{
+			CharType* Data;
+			std::size_t Size;
+			std::size_t Capacity;
+		};
+
+#if __has_cpp_attribute(no_unique_address)
+		[[no_unique_address]]
+#endif
+		Allocator m_Allocator;
+		std::size_t m_ChunkSize;
+		std::vector<Chunk> m_Chunks;
+		// m_CurrentChunk 之后的块为空
+		std::size_t m_CurrentChunk;
+		std::size_t m_Size;
+
+		/// @brief  获得尚有剩余空间的块
+		Chunk& PrepareChunk()
+		{
+			if (m_CurrentChunk < m_Chunks.size())
+			{
+				auto& chunk = m_Chunks[m_CurrentChunk];
+				if (chunk.Size < chunk.Capacity)
+				{
+					return chunk;
+				}
+
+				// 复用 Clear 之前分配的块
+				if (++m_CurrentChunk < m_Chunks.size())
+				{
+					return m_Chunks[m_CurrentChunk];
+				}
+			}
+
+			// 按倍数扩大以免每次增加块时都复制所有块的信息，并保证之后的 push_back 不会抛出异常
+			if (m_Chunks.size() == m_Chunks.capacity())
+			{
+				m_Chunks.reserve(std::max<std::size_t>(4, m_Chunks.capacity() * 2));
+			}
+			const auto data = std::to_address(
+			    std::allocator_traits<Allocator>::allocate(m_Allocator, m_ChunkSize));
+			m_Chunks.push_back(Chunk{ data, 0, m_ChunkSize });
+			m_CurrentChunk = m_Chunks.size() - 1;
+			return m_Chunks.back();
+		}
+	};
+} // namespace Cafe::Encoding
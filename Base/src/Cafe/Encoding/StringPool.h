@@ -0,0 +1,310 @@
+#pragma once
+
+#include "StringArena.h"
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <optional>
+
+namespace Cafe::Encoding
+{
+	namespace Detail
+	{
+		/// @brief  驻留的字符串在存储中的表示
+		/// @remark 之后紧跟 Size 个编码单元，包含结尾的空编码单元
+		template <typename CharType>
+		struct InternedStringEntry
+		{
+			std::size_t Hash;
+			std::size_t Size;
+
+			[[nodiscard]] const CharType* GetData() const noexcept
+			{
+				return reinterpret_cast<const CharType*>(this + 1);
+			}
+		};
+	} // namespace Detail
+
+	/// @brief  由 StringPool 驻留的字符串的句柄
+	/// @remark 仅包含一个指针，内容相同的字符串在同一个池中的句柄必定相同，因此仅比较指针
+	///         来自不同池的句柄不应比较，生存期不能超过所属的池
+	///         默认构造的句柄为空，除比较及赋值外不应使用
+	template <CodePage::CodePageType CodePageValue>
+	class InternedString
+	{
+		template <CodePage::CodePageType CodePageValue_, typename HashPolicy_,
+		          std::size_t ShardCount_>
+		friend class StringPool;
+
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+		using EntryType = Detail::InternedStringEntry<CharType>;
+
+	public:
+		constexpr InternedString() noexcept : m_Entry{}
+		{
+		}
+
+		[[nodiscard]] constexpr bool IsNull() const noexcept
+		{
+			return !m_Entry;
+		}
+
+		[[nodiscard]] StringView<CodePageValue> GetView() const noexcept
+		{
+			assert(m_Entry);
+			return std::span<const CharType>(m_Entry->GetData(), m_Entry->Size);
+		}
+
+		[[nodiscard]] operator StringView<CodePageValue>() const noexcept
+		{
+			return GetView();
+		}
+
+		/// @brief  获得驻留时计算的散列值
+		/// @remark 以 HashPolicy 对不包含结尾空编码单元的内容计算，因此输入是否以 0 结尾不影响结果
+		[[nodiscard]] std::size_t GetHash() const noexcept
+		{
+			assert(m_Entry);
+			return m_Entry->Hash;
+		}
+
+		[[nodiscard]] constexpr bool operator==(InternedString const& other) const noexcept
+		{
+			return m_Entry == other.m_Entry;
+		}
+
+	private:
+		const EntryType* m_Entry;
+
+		constexpr explicit InternedString(const EntryType* entry) noexcept : m_Entry{ entry }
+		{
+		}
+	};
+
+	/// @brief  线程安全的字符串驻留池
+	/// @remark 驻留的字符串存放在按块分配的存储中，在池析构前不会被移动或释放
+	///         按散列值分为 ShardCount 个分片，各自以开放寻址的散列表索引驻留的字符串
+	///         查找不加锁，仅在插入时锁定所在分片
+	///         散列表扩容时旧表保留至池析构，以保证并发的查找不会访问已释放的内存，因此额外占用的
+	///         内存不超过现有散列表的大小
+	template <CodePage::CodePageType CodePageValue, typename HashPolicy = Detail::DefaultHashPolicy,
+	          std::size_t ShardCount = 16>
+	class StringPool
+	{
+		static_assert(std::has_single_bit(ShardCount), "ShardCount should be a power of 2.");
+
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+		using EntryType = Detail::InternedStringEntry<CharType>;
+
+		static_assert(sizeof(EntryType) % alignof(CharType) == 0);
+
+	public:
+		using HandleType = InternedString<CodePageValue>;
+
+		/// @param  chunkSize   每个分片存放字符串的块的字节数
+		explicit StringPool(std::size_t chunkSize = StringArena::DefaultChunkSize)
+		{
+			for (auto& shard : m_Shards)
+			{
+				shard.Arena = StringArena{ chunkSize };
+			}
+		}
+
+		StringPool(StringPool const&) = delete;
+		StringPool& operator=(StringPool const&) = delete;
+
+		/// @brief  驻留 str，若已驻留则返回已有的句柄
+		template <std::size_t Extent>
+		[[nodiscard]] HandleType Intern(StringView<CodePageValue, Extent> const& str)
+		{
+			const auto span = str.GetTrimmedSpan();
+			const auto hash = HashPolicy::Hash(span);
+			auto& shard = GetShard(hash);
+			if (const auto entry = Lookup(shard, span, hash))
+			{
+				return HandleType{ entry };
+			}
+
+			std::lock_guard lock{ shard.Mutex };
+			// 获得锁之前可能已被其他线程插入
+			if (const auto entry = Lookup(shard, span, hash))
+			{
+				return HandleType{ entry };
+			}
+
+			const auto count = shard.Count.load(std::memory_order_relaxed);
+			auto table = shard.Current.load(std::memory_order_relaxed);
+			if (!table || (count + 1) * 4 > (table->Mask + 1) * 3)
+			{
+				table = Grow(shard);
+			}
+
+			const auto entry = CreateEntry(shard, span, hash);
+			auto index = SlotIndex(hash);
+			while (true)
+			{
+				auto& slot = table->Slots[index & table->Mask];
+				if (!slot.load(std::memory_order_relaxed))
+				{
+					slot.store(entry, std::memory_order_release);
+					break;
+				}
+				++index;
+			}
+			shard.Count.store(count + 1, std::memory_order_relaxed);
+
+			return HandleType{ entry };
+		}
+
+		/// @brief  查找 str 的句柄，不会驻留 str
+		/// @return 若 str 未被驻留则返回 std::nullopt
+		template <std::size_t Extent>
+		[[nodiscard]] std::optional<HandleType>
+		Find(StringView<CodePageValue, Extent> const& str) const noexcept
+		{
+			const auto span = str.GetTrimmedSpan();
+			const auto hash = HashPolicy::Hash(span);
+			if (const auto entry = Lookup(GetShard(hash), span, hash))
+			{
+				return HandleType{ entry };
+			}
+
+			return std::nullopt;
+		}
+
+		/// @brief  获得已驻留的字符串的数量
+		/// @remark 存在并发的插入时结果仅为近似值
+		[[nodiscard]] std::size_t GetCount() const noexcept
+		{
+			std::size_t result{};
+			for (const auto& shard : m_Shards)
+			{
+				result += shard.Count.load(std::memory_order_relaxed);
+			}
+			return result;
+		}
+
+	private:
+		static constexpr std::size_t InitialTableSize = 16;
+		static constexpr std::size_t ShardBits = std::bit_width(ShardCount) - 1;
+
+		struct Table
+		{
+			std::size_t Mask;
+			std::unique_ptr<std::atomic<const EntryType*>[]> Slots;
+		};
+
+		// 分片间以缓存行对齐以避免伪共享
+		struct alignas(64) Shard
+		{
+			std::atomic<Table*> Current{};
+			std::atomic<std::size_t> Count{};
+			std::mutex Mutex;
+			// 以下仅在持有 Mutex 时访问
+			std::vector<std::unique_ptr<Table>> Tables;
+			StringArena Arena;
+		};
+
+		Shard m_Shards[ShardCount];
+
+		[[nodiscard]] Shard& GetShard(std::size_t hash) noexcept
+		{
+			return m_Shards[hash & (ShardCount - 1)];
+		}
+
+		[[nodiscard]] Shard const& GetShard(std::size_t hash) const noexcept
+		{
+			return m_Shards[hash & (ShardCount - 1)];
+		}
+
+		// 低位已用于选择分片
+		[[nodiscard]] static constexpr std::size_t SlotIndex(std::size_t hash) noexcept
+		{
+			return hash >> ShardBits;
+		}
+
+		[[nodiscard]] static const EntryType* Lookup(Shard const& shard,
+		                                             std::span<const CharType> const& span,
+		                                             std::size_t hash) noexcept
+		{
+			const auto table = shard.Current.load(std::memory_order_acquire);
+			if (!table)
+			{
+				return nullptr;
+			}
+
+			for (auto index = SlotIndex(hash);; ++index)
+			{
+				const auto entry = table->Slots[index & table->Mask].load(std::memory_order_acquire);
+				if (!entry)
+				{
+					return nullptr;
+				}
+
+				if (entry->Hash == hash && entry->Size == span.size() + 1 &&
+				    std::equal(span.begin(), span.end(), entry->GetData()))
+				{
+					return entry;
+				}
+			}
+		}
+
+		static Table* Grow(Shard& shard)
+		{
+			const auto oldTable = shard.Current.load(std::memory_order_relaxed);
+			const auto newSize = oldTable ? (oldTable->Mask + 1) * 2 : InitialTableSize;
+
+			auto newTable = std::make_unique<Table>(
+			    Table{ newSize - 1, std::make_unique<std::atomic<const EntryType*>[]>(newSize) });
+			if (oldTable)
+			{
+				for (std::size_t i = 0; i <= oldTable->Mask; ++i)
+				{
+					const auto entry = oldTable->Slots[i].load(std::memory_order_relaxed);
+					if (!entry)
+					{
+						continue;
+					}
+
+					auto index = SlotIndex(entry->Hash);
+					while (newTable->Slots[index & newTable->Mask].load(std::memory_order_relaxed))
+					{
+						++index;
+					}
+					newTable->Slots[index & newTable->Mask].store(entry, std::memory_order_relaxed);
+				}
+			}
+
+			const auto result = newTable.get();
+			shard.Tables.push_back(std::move(newTable));
+			shard.Current.store(result, std::memory_order_release);
+			return result;
+		}
+
+		static const EntryType* CreateEntry(Shard& shard, std::span<const CharType> const& span,
+		                                    std::size_t hash)
+		{
+			const auto storage = shard.Arena.Allocate(
+			    sizeof(EntryType) + (span.size() + 1) * sizeof(CharType), alignof(EntryType));
+			const auto entry = ::new (storage) EntryType{ hash, span.size() + 1 };
+			const auto data = reinterpret_cast<CharType*>(entry + 1);
+			std::copy(span.begin(), span.end(), data);
+			data[span.size()] = CharType{};
+			return entry;
+		}
+	};
+} // namespace Cafe::Encoding
+
+namespace std
+{
+	template <Cafe::Encoding::CodePage::CodePageType CodePageValue>
+	struct hash<Cafe::Encoding::InternedString<CodePageValue>>
+	{
+		[[nodiscard]] std::size_t
+		operator()(Cafe::Encoding::InternedString<CodePageValue> const& value) const noexcept
+		{
+			return value.GetHash();
+		}
+	};
+} // namespace std
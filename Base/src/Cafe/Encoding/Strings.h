@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Encode.h"
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <memory>
 #include <span>
@@ -25,6 +28,13 @@ namespace Cafe::Encoding
 			}
 		};
 
+		/// @brief  以此包装 GrowPolicy 以选用紧凑布局的存储
+		/// @see    Cafe::Encoding::CompactString
+		template <typename GrowPolicy = DefaultGrowPolicy>
+		struct CompactLayout : GrowPolicy
+		{
+		};
+
 		// 管理字符串的存储，保证 0 结尾
 		// 仅提供会导致分配去配及提供必要信息的操作，其他操作由外部实现
 		template <typename CharType, typename Allocator,
@@ -36,6 +46,10 @@ namespace Cafe::Encoding
 			          typename GrowPolicy_>
 			friend class StringStorage;
 
+			struct MoveTag
+			{
+			};
+
 		public:
 			constexpr StringStorage() noexcept(std::is_nothrow_default_constructible_v<Allocator>)
 			    : m_Allocator{}, m_Size{}, m_Capacity{ SsoThresholdSize }, m_SsoStorage{}
@@ -88,11 +102,43 @@ namespace Cafe::Encoding
 			{
 			}
 
+			constexpr StringStorage(StringStorage const& other)
+			    : StringStorage(std::span(other.GetStorage(), other.GetSize()),
+			                    std::allocator_traits<Allocator>::select_on_container_copy_construction(
+			                        other.m_Allocator))
+			{
+			}
+
+			constexpr StringStorage(StringStorage&& other) noexcept
+			    : StringStorage(MoveTag{}, std::move(other))
+			{
+			}
+
 			// 若 Allocator 类型不同则直接 fallback 到复制，因为无法重用
 			// StringStorage 的存储必定以 0 结尾，因此不需额外检查，直接复制即可
 			// 移动后 other 保证为空存储
 			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
 			constexpr StringStorage(
+			    StringStorage<CharType, Allocator, OtherSsoThresholdSize, OtherGrowPolicy>&&
+			        other) noexcept(SsoThresholdSize >= OtherSsoThresholdSize)
+			    : StringStorage(MoveTag{}, std::move(other))
+			{
+			}
+
+			// 布局不同时无法重用存储，仅能复制
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr StringStorage(StringStorage<CharType, Allocator, OtherSsoThresholdSize,
+			                                      CompactLayout<OtherGrowPolicy>>&& other)
+			    : StringStorage(std::span<const CharType>(other.GetStorage(), other.GetSize()),
+			                    other.m_Allocator)
+			{
+				other.Clear();
+			}
+
+		private:
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr StringStorage(
+			    MoveTag,
 			    StringStorage<CharType, Allocator, OtherSsoThresholdSize, OtherGrowPolicy>&&
 			        other) noexcept(SsoThresholdSize >= OtherSsoThresholdSize)
 			    : m_Allocator{ std::move(other.m_Allocator) }, m_Size{},
@@ -142,6 +188,7 @@ namespace Cafe::Encoding
 				other.Clear();
 			}
 
+		public:
 			constexpr ~StringStorage()
 			{
 				if (IsDynamicAllocated())
@@ -151,6 +198,16 @@ namespace Cafe::Encoding
 				}
 			}
 
+			constexpr StringStorage& operator=(StringStorage const& other)
+			{
+				return this->template operator=<Allocator, SsoThresholdSize, GrowPolicy>(other);
+			}
+
+			constexpr StringStorage& operator=(StringStorage&& other) noexcept
+			{
+				return this->template operator=<SsoThresholdSize, GrowPolicy>(std::move(other));
+			}
+
 			template <typename OtherAllocator, std::size_t OtherSsoThresholdSize,
 			          typename OtherGrowPolicy>
 			constexpr StringStorage&
@@ -179,6 +236,14 @@ namespace Cafe::Encoding
 				return *this;
 			}
 
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr StringStorage& operator=(StringStorage<CharType, Allocator, OtherSsoThresholdSize,
+			                                                 CompactLayout<OtherGrowPolicy>>&& other)
+			{
+				StringStorage tmpStorage(std::move(other));
+				return *this = std::move(tmpStorage);
+			}
+
 			// 若 Allocator 不同则直接 fallback 到复制，因为无法重用
 			// TODO: 不遵守 std::allocator_traits<Allocator>::propagate_on_container_move_assignment
 			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
@@ -222,6 +287,11 @@ namespace Cafe::Encoding
 				return m_Capacity;
 			}
 
+			[[nodiscard]] constexpr Allocator const& GetAllocator() const noexcept
+			{
+				return m_Allocator;
+			}
+
 			[[nodiscard]] constexpr CharType* GetStorage() noexcept
 			{
 				return const_cast<CharType*>(std::as_const(*this).GetStorage());
@@ -494,80 +564,1233 @@ namespace Cafe::Encoding
 					return m_Capacity;
 				}
 
-			private:
-#if __has_cpp_attribute(no_unique_address)
-				[[no_unique_address]]
-#endif
-				Allocator m_Allocator;
-				std::size_t m_Capacity;
-			};
+			private:
+#if __has_cpp_attribute(no_unique_address)
+				[[no_unique_address]]
+#endif
+				Allocator m_Allocator;
+				std::size_t m_Capacity;
+			};
+
+		public:
+			constexpr std::unique_ptr<CharType[], DynamicStorageDeleter> ReleaseStorage() noexcept
+			{
+				if (IsDynamicAllocated())
+				{
+					m_Size = 0;
+					const auto capacity = std::exchange(m_Capacity, SsoThresholdSize);
+					const auto storage = m_DynamicStorage;
+					m_SsoStorage[0] = CharType{};
+					return std::unique_ptr<CharType[], DynamicStorageDeleter>(
+					    storage, DynamicStorageDeleter{ m_Allocator, capacity });
+				}
+
+				return {};
+			}
+		};
+
+		// 紧凑布局：动态存储的指针、大小及容量与 SSO 缓冲区共用同一块存储，SSO 的大小以剩余容量的
+		// 形式保存在这块存储的最后一个字节，因此缓冲区满时这个字节恰为结尾的空编码单元；动态存储时该字节
+		// 为容量的一部分且最高位被置位以示区分（与 libc++ 及 folly 的做法相同）
+		// SsoThresholdSize 以字节计算并包含结尾的空编码单元，不足以存放动态存储的信息时存储按后者的大小
+		// 分配，但 SSO 的容量仍不超过 SsoThresholdSize
+		// 常量求值环境下无法判断共用的存储当前的用途，因此总是使用动态存储
+		template <typename CharType, typename Allocator, std::size_t SsoThresholdSize,
+		          typename GrowPolicy>
+		class StringStorage<CharType, Allocator, SsoThresholdSize, CompactLayout<GrowPolicy>>
+		{
+			template <typename CharType_, typename Allocator_, std::size_t SsoThresholdSize_,
+			          typename GrowPolicy_>
+			friend class StringStorage;
+
+			struct LongRepBase
+			{
+				CharType* Data;
+				std::size_t Size;
+				// 以 EncodeCapacity 编码
+				std::size_t Capacity;
+			};
+
+			static constexpr std::size_t RepSize = [] {
+				constexpr auto size = std::max(SsoThresholdSize, sizeof(LongRepBase));
+				return (size + alignof(LongRepBase) - 1) / alignof(LongRepBase) *
+				       alignof(LongRepBase);
+			}();
+
+			template <std::size_t PaddingSize>
+			struct LongRepPadding
+			{
+				unsigned char Padding[PaddingSize];
+			};
+
+			struct NoPadding
+			{
+			};
+
+			// 在前部填充使容量位于存储的结尾
+			struct LongRep
+			    : std::conditional_t<(RepSize > sizeof(LongRepBase)),
+			                         LongRepPadding<RepSize - sizeof(LongRepBase)>, NoPadding>,
+			      LongRepBase
+			{
+			};
+
+			static constexpr std::size_t RepUnitCount = RepSize / sizeof(CharType);
+
+			static_assert(sizeof(LongRep) == RepSize);
+			static_assert(RepSize % sizeof(CharType) == 0);
+
+		public:
+			/// @brief  SSO 的容量，包含结尾的空编码单元
+			static constexpr std::size_t SsoCapacity =
+			    std::clamp<std::size_t>(SsoThresholdSize / sizeof(CharType), 1, RepUnitCount);
+
+			static_assert(SsoCapacity <= 0x80, "SsoThresholdSize is too large.");
+
+			constexpr StringStorage() noexcept(std::is_nothrow_default_constructible_v<Allocator>)
+			    : m_Allocator{}
+			{
+				InitEmpty();
+			}
+
+			constexpr explicit StringStorage(Allocator const& allocator) noexcept
+			    : m_Allocator{ allocator }
+			{
+				InitEmpty();
+			}
+
+			template <std::size_t Extent>
+			constexpr StringStorage(std::span<const CharType, Extent> const& src,
+			                        Allocator const& allocator = Allocator{})
+			    : m_Allocator{ allocator }
+			{
+				CopyFrom(src);
+			}
+
+			constexpr StringStorage(StringStorage const& other)
+			    : m_Allocator{ std::allocator_traits<Allocator>::select_on_container_copy_construction(
+				      other.m_Allocator) }
+			{
+				CopyFrom(std::span(other.GetStorage(), other.GetSize()));
+			}
+
+			template <typename OtherAllocator, std::size_t OtherSsoThresholdSize,
+			          typename OtherGrowPolicy>
+			constexpr StringStorage(StringStorage<CharType, OtherAllocator, OtherSsoThresholdSize,
+			                                      OtherGrowPolicy> const& other)
+			    : StringStorage(std::span(other.GetStorage(), other.GetSize()))
+			{
+			}
+
+			constexpr StringStorage(StringStorage&& other) noexcept
+			    : m_Allocator{ std::move(other.m_Allocator) }
+			{
+				MoveFrom(other);
+			}
+
+			// 若 Allocator 类型不同则直接 fallback 到复制，因为无法重用
+			// 仅当 other 同为紧凑布局时可以重用其动态存储
+			// 移动后 other 保证为空存储
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr StringStorage(
+			    StringStorage<CharType, Allocator, OtherSsoThresholdSize, OtherGrowPolicy>&&
+			        other) noexcept(noexcept(MoveFrom(other)))
+			    : m_Allocator{ other.m_Allocator }
+			{
+				MoveFrom(other);
+			}
+
+			constexpr ~StringStorage()
+			{
+				if (IsDynamicAllocated())
+				{
+					Deallocate(m_Rep.Long.Data, GetCapacity());
+				}
+			}
+
+			constexpr StringStorage& operator=(StringStorage const& other)
+			{
+				return CopyAssign(other);
+			}
+
+			template <typename OtherAllocator, std::size_t OtherSsoThresholdSize,
+			          typename OtherGrowPolicy>
+			constexpr StringStorage&
+			operator=(StringStorage<CharType, OtherAllocator, OtherSsoThresholdSize,
+			                        OtherGrowPolicy> const& other)
+			{
+				return CopyAssign(other);
+			}
+
+			constexpr StringStorage& operator=(StringStorage&& other) noexcept
+			{
+				if (this != &other)
+				{
+					std::destroy_at(this);
+					std::construct_at(this, std::move(other));
+				}
+
+				return *this;
+			}
+
+			// 若 Allocator 不同则直接 fallback 到复制，因为无法重用
+			// TODO: 不遵守 std::allocator_traits<Allocator>::propagate_on_container_move_assignment
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr StringStorage&
+			operator=(StringStorage<CharType, Allocator, OtherSsoThresholdSize, OtherGrowPolicy>&&
+			              other) noexcept(noexcept(StringStorage(std::move(other))))
+			{
+				// 先构建临时对象，以保证 other 与 *this 中的存储互不影响
+				StringStorage tmpStorage(std::move(other));
+				return *this = std::move(tmpStorage);
+			}
+
+			/// @brief  获得内容占据的大小，包含结尾的空编码单元
+			[[nodiscard]] constexpr std::size_t GetSize() const noexcept
+			{
+				return GetLength() + 1;
+			}
+
+			/// @brief  获得已分配的大小，包含结尾的空编码单元
+			[[nodiscard]] constexpr std::size_t GetCapacity() const noexcept
+			{
+				return IsDynamicAllocated() ? DecodeCapacity(m_Rep.Long.Capacity) : SsoCapacity;
+			}
+
+			[[nodiscard]] constexpr Allocator const& GetAllocator() const noexcept
+			{
+				return m_Allocator;
+			}
+
+			[[nodiscard]] constexpr CharType* GetStorage() noexcept
+			{
+				return const_cast<CharType*>(std::as_const(*this).GetStorage());
+			}
+
+			[[nodiscard]] constexpr const CharType* GetStorage() const noexcept
+			{
+				return IsDynamicAllocated() ? m_Rep.Long.Data : m_Rep.Short;
+			}
+
+			[[nodiscard]] constexpr bool IsDynamicAllocated() const noexcept
+			{
+				if (std::is_constant_evaluated())
+				{
+					return true;
+				}
+
+				// 通过 unsigned char 读取对象表示总是允许的
+				return reinterpret_cast<const unsigned char*>(&m_Rep)[RepSize - 1] & LongFlag;
+			}
+
+			constexpr void Reserve(std::size_t newCapacity)
+			{
+				if (newCapacity <= GetCapacity())
+				{
+					return;
+				}
+
+				const auto length = GetLength();
+				const auto newStorage = Allocate(newCapacity);
+				std::copy_n(GetStorage(), length + 1, newStorage);
+				if (IsDynamicAllocated())
+				{
+					Deallocate(m_Rep.Long.Data, GetCapacity());
+				}
+				InitLong(newStorage, length, newCapacity);
+			}
+
+			constexpr void Resize(std::size_t newSize, CharType value = CharType{})
+			{
+				assert(newSize > 0);
+
+				if (newSize > GetCapacity())
+				{
+					Reserve(newSize);
+				}
+
+				--newSize; // 去除结尾空编码单元
+
+				const auto length = GetLength();
+				if (newSize > length)
+				{
+					std::fill(GetStorage() + length, GetStorage() + newSize, value);
+				}
+
+				SetLength(newSize);
+			}
+
+			/// @remark  用于在已确保 Reserve 足够内存的情况下不检查边界进行追加操作
+			template <std::size_t Extent>
+			constexpr void UncheckedAppend(std::span<const CharType, Extent> const& src)
+			{
+				const auto isSrcNullTerminated = src[src.size() - 1] == CharType{};
+				const auto srcSize = src.size() - isSrcNullTerminated;
+				const auto length = GetLength();
+				std::copy_n(src.data(), srcSize, GetStorage() + length);
+				SetLength(length + srcSize);
+			}
+
+			constexpr void UncheckedAppend(CharType value, std::size_t count = 1)
+			{
+				const auto length = GetLength();
+				std::fill_n(GetStorage() + length, count, value);
+				SetLength(length + count);
+			}
+
+			template <std::size_t Extent>
+			constexpr void Append(std::span<const CharType, Extent> const& src)
+			{
+				if (src.empty())
+				{
+					return;
+				}
+
+				const auto srcSize = src.size();
+				const auto isSrcNullTerminated = src[srcSize - 1] == CharType{};
+				const auto newCapacity = GetLength() + srcSize + !isSrcNullTerminated;
+				const auto capacity = GetCapacity();
+				if (newCapacity > capacity)
+				{
+					Reserve(GrowPolicy::Grow(capacity, newCapacity));
+				}
+
+				UncheckedAppend(src);
+			}
+
+			constexpr void Append(CharType value, std::size_t count = 1)
+			{
+				const auto newCapacity = GetLength() + count + 1;
+				const auto capacity = GetCapacity();
+				if (newCapacity > capacity)
+				{
+					Reserve(GrowPolicy::Grow(capacity, newCapacity));
+				}
+
+				UncheckedAppend(value, count);
+			}
+
+			constexpr void Clear() noexcept
+			{
+				SetLength(0);
+			}
+
+			/// @brief  用于在已确保 Reserve 足够内存的情况下不检查边界进行赋值操作
+			template <std::size_t Extent>
+			constexpr void UncheckedAssign(std::span<const CharType, Extent> const& src)
+			{
+				Clear();
+				UncheckedAppend(src);
+			}
+
+			constexpr void UncheckedAssign(CharType value, std::size_t count = 1)
+			{
+				Clear();
+				UncheckedAppend(value, count);
+			}
+
+			template <std::size_t Extent>
+			constexpr void Assign(std::span<const CharType, Extent> const& src)
+			{
+				Clear();
+				Append(src);
+			}
+
+			constexpr void Assign(CharType value, std::size_t count = 1)
+			{
+				Clear();
+				Append(value, count);
+			}
+
+			template <std::size_t Extent>
+			constexpr CharType* UncheckedInsert(const CharType* pos,
+			                                    std::span<const CharType, Extent> const& src)
+			{
+				const auto isSrcNullTerminated = src[src.size() - 1] == CharType{};
+				const auto srcSize = src.size() - isSrcNullTerminated;
+				const auto length = GetLength();
+				const auto newSize = length + srcSize;
+
+				const auto begin = GetStorage();
+				const auto end = begin + length;
+				const auto moveDest = end + srcSize;
+
+				const auto mutablePos = begin + (pos - begin);
+
+				std::move_backward(mutablePos, end, moveDest);
+				std::copy_n(src.data(), srcSize, mutablePos);
+				SetLength(newSize);
+
+				return begin + newSize;
+			}
+
+			template <std::size_t Extent>
+			constexpr CharType* Insert(const CharType* pos,
+			                           std::span<const CharType, Extent> const& src)
+			{
+				const auto length = GetLength();
+				assert(GetStorage() <= pos && static_cast<std::size_t>(pos - GetStorage()) <= length);
+				if (pos == GetStorage() + length)
+				{
+					Append(src);
+					return GetStorage() + GetLength();
+				}
+
+				const auto srcSize = src.size();
+				const auto isSrcNullTerminated = src[srcSize - 1] == CharType{};
+				const auto newCapacity = length + srcSize + !isSrcNullTerminated;
+				const auto capacity = GetCapacity();
+				if (newCapacity > capacity)
+				{
+					// Reserve 可能使 pos 失效
+					const auto offset = pos - GetStorage();
+					Reserve(GrowPolicy::Grow(capacity, newCapacity));
+					pos = GetStorage() + offset;
+				}
+
+				return UncheckedInsert(pos, src);
+			}
+
+			constexpr CharType* Remove(const CharType* begin, std::size_t count) noexcept
+			{
+				const auto storage = GetStorage();
+				const auto length = GetLength();
+
+				assert(storage <= begin && static_cast<std::size_t>(begin - storage) <= length);
+				assert(begin + count <= storage + length);
+
+				const auto mutableBegin = storage + (begin - storage);
+				const auto mutableEnd = mutableBegin + count;
+
+				std::move(mutableEnd, storage + length, mutableBegin);
+				SetLength(length - (mutableEnd - mutableBegin));
+
+				return mutableBegin;
+			}
+
+			constexpr void RemoveBack(std::size_t count = 1) noexcept
+			{
+				const auto length = GetLength();
+				SetLength(length - std::min(count, length));
+			}
+
+			constexpr void ShrinkToFit()
+			{
+				if (!IsDynamicAllocated())
+				{
+					return;
+				}
+
+				const auto oldStorage = m_Rep.Long.Data;
+				const auto oldCapacity = GetCapacity();
+				const auto length = GetLength();
+				if (length < SsoCapacity && !std::is_constant_evaluated())
+				{
+					InitShort();
+					std::copy_n(oldStorage, length, m_Rep.Short);
+					SetLength(length);
+					Deallocate(oldStorage, oldCapacity);
+				}
+				else if (length + 1 < oldCapacity)
+				{
+					const auto newStorage = Allocate(length + 1);
+					std::copy_n(oldStorage, length + 1, newStorage);
+					Deallocate(oldStorage, oldCapacity);
+					InitLong(newStorage, length, length + 1);
+				}
+			}
+
+		private:
+			static constexpr unsigned char LongFlag = 0x80;
+
+			// 存储的最后一个字节在编码单元中的位置
+			static constexpr std::size_t LastByteShift =
+			    std::endian::native == std::endian::little ? 8 * (sizeof(CharType) - 1) : 0;
+
+#if __has_cpp_attribute(no_unique_address)
+			[[no_unique_address]]
+#endif
+			Allocator m_Allocator;
+
+			union Rep
+			{
+				LongRep Long;
+				CharType Short[RepUnitCount];
+			} m_Rep;
+
+			/// @brief  编码容量使其最后一个字节的最高位被置位
+			/// @remark 容量的最后一个字节即为存储的最后一个字节
+			[[nodiscard]] static constexpr std::size_t EncodeCapacity(std::size_t capacity) noexcept
+			{
+				if constexpr (std::endian::native == std::endian::little)
+				{
+					return capacity | (std::size_t{ LongFlag } << (8 * (sizeof(std::size_t) - 1)));
+				}
+				else
+				{
+					return (capacity << 8) | LongFlag;
+				}
+			}
+
+			[[nodiscard]] static constexpr std::size_t DecodeCapacity(std::size_t encoded) noexcept
+			{
+				if constexpr (std::endian::native == std::endian::little)
+				{
+					return encoded & ~(std::size_t{ LongFlag } << (8 * (sizeof(std::size_t) - 1)));
+				}
+				else
+				{
+					return encoded >> 8;
+				}
+			}
+
+			[[nodiscard]] constexpr CharType* Allocate(std::size_t capacity)
+			{
+				return std::to_address(
+				    std::allocator_traits<Allocator>::allocate(m_Allocator, capacity));
+			}
+
+			constexpr void Deallocate(CharType* storage, std::size_t capacity) noexcept
+			{
+				std::allocator_traits<Allocator>::deallocate(m_Allocator, storage, capacity);
+			}
+
+			/// @brief  获得内容的长度，不包含结尾的空编码单元
+			[[nodiscard]] constexpr std::size_t GetLength() const noexcept
+			{
+				if (IsDynamicAllocated())
+				{
+					return m_Rep.Long.Size;
+				}
+
+				const auto lastUnit =
+				    static_cast<std::make_unsigned_t<CharType>>(m_Rep.Short[RepUnitCount - 1]);
+				return SsoCapacity - 1 - ((lastUnit >> LastByteShift) & 0x7F);
+			}
+
+			/// @brief  设置内容的长度并写入结尾的空编码单元
+			constexpr void SetLength(std::size_t length) noexcept
+			{
+				if (IsDynamicAllocated())
+				{
+					m_Rep.Long.Size = length;
+					m_Rep.Long.Data[length] = CharType{};
+				}
+				else
+				{
+					assert(length < SsoCapacity);
+					m_Rep.Short[length] = CharType{};
+					// 长度达到最大值时写入的值为 0，恰为结尾的空编码单元
+					m_Rep.Short[RepUnitCount - 1] =
+					    static_cast<CharType>((SsoCapacity - 1 - length) << LastByteShift);
+				}
+			}
+
+			constexpr void InitShort() noexcept
+			{
+				m_Rep.Short[0] = CharType{};
+				m_Rep.Short[RepUnitCount - 1] = static_cast<CharType>((SsoCapacity - 1)
+				                                                      << LastByteShift);
+			}
+
+			constexpr void InitLong(CharType* storage, std::size_t length,
+			                        std::size_t capacity) noexcept
+			{
+				m_Rep.Long = LongRep{ {}, { storage, length, EncodeCapacity(capacity) } };
+			}
+
+			constexpr void InitWithCapacity(std::size_t capacity)
+			{
+				if (capacity <= SsoCapacity && !std::is_constant_evaluated())
+				{
+					InitShort();
+				}
+				else
+				{
+					const auto storage = Allocate(capacity);
+					storage[0] = CharType{};
+					InitLong(storage, 0, capacity);
+				}
+			}
+
+			constexpr void InitEmpty() noexcept
+			{
+				InitWithCapacity(1);
+			}
+
+			template <std::size_t Extent>
+			constexpr void CopyFrom(std::span<const CharType, Extent> const& src)
+			{
+				auto length = static_cast<std::size_t>(src.size());
+				// 若 src 以 0 结尾则删去 1 位
+				if (length && src[length - 1] == CharType{})
+				{
+					--length;
+				}
+
+				InitWithCapacity(length + 1);
+				std::copy_n(src.data(), length, GetStorage());
+				SetLength(length);
+			}
+
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr void MoveFrom(
+			    StringStorage<CharType, Allocator, OtherSsoThresholdSize, CompactLayout<OtherGrowPolicy>>&
+			        other) noexcept(SsoCapacity >= StringStorage<CharType, Allocator,
+			                                                     OtherSsoThresholdSize,
+			                                                     CompactLayout<OtherGrowPolicy>>::
+			                                           SsoCapacity)
+			{
+				const auto length = other.GetLength();
+				if (other.IsDynamicAllocated() &&
+				    (other.GetCapacity() > SsoCapacity || std::is_constant_evaluated()))
+				{
+					// 允许直接重用动态存储
+					InitLong(other.m_Rep.Long.Data, length, other.GetCapacity());
+					other.InitEmpty();
+					return;
+				}
+
+				// 否则复制内容，other 保留其动态存储（若有）
+				InitWithCapacity(length + 1);
+				std::copy_n(other.GetStorage(), length, GetStorage());
+				SetLength(length);
+				other.Clear();
+			}
+
+			// 其他布局的存储无法重用，仅复制内容
+			template <std::size_t OtherSsoThresholdSize, typename OtherGrowPolicy>
+			constexpr void
+			MoveFrom(StringStorage<CharType, Allocator, OtherSsoThresholdSize, OtherGrowPolicy>& other)
+			{
+				CopyFrom(std::span<const CharType>(other.GetStorage(), other.GetSize()));
+				other.Clear();
+			}
+
+			template <typename OtherAllocator, std::size_t OtherSsoThresholdSize,
+			          typename OtherGrowPolicy>
+			constexpr StringStorage& CopyAssign(
+			    StringStorage<CharType, OtherAllocator, OtherSsoThresholdSize, OtherGrowPolicy> const&
+			        other)
+			{
+				if constexpr (std::is_same_v<Allocator, OtherAllocator> &&
+				              SsoThresholdSize == OtherSsoThresholdSize &&
+				              std::is_same_v<CompactLayout<GrowPolicy>, OtherGrowPolicy>)
+				{
+					if (this == &other)
+					{
+						return *this;
+					}
+				}
+
+				if constexpr (std::is_same_v<Allocator, OtherAllocator> &&
+				              std::allocator_traits<
+				                  Allocator>::propagate_on_container_copy_assignment::value)
+				{
+					if (m_Allocator != other.m_Allocator)
+					{
+						// 旧的存储必须由旧的分配器释放，因此以新的分配器构建后再替换
+						StringStorage tmpStorage(std::span(other.GetStorage(), other.GetSize()),
+						                         other.m_Allocator);
+						return *this = std::move(tmpStorage);
+					}
+				}
+
+				Assign(std::span(other.GetStorage(), other.GetSize()));
+
+				return *this;
+			}
+
+			class DynamicStorageDeleter
+			{
+			public:
+				constexpr DynamicStorageDeleter(Allocator const& allocator,
+				                                std::size_t capacity) noexcept
+				    : m_Allocator{ allocator }, m_Capacity{ capacity }
+				{
+				}
+
+				constexpr void operator()(CharType* storage) const noexcept
+				{
+					std::allocator_traits<Allocator>::deallocate(m_Allocator, storage, m_Capacity);
+				}
+
+				Allocator& GetAllocator() noexcept
+				{
+					return m_Allocator;
+				}
+
+				Allocator const& GetAllocator() const noexcept
+				{
+					return m_Allocator;
+				}
+
+				std::size_t GetCapacity() const noexcept
+				{
+					return m_Capacity;
+				}
+
+			private:
+#if __has_cpp_attribute(no_unique_address)
+				[[no_unique_address]]
+#endif
+				Allocator m_Allocator;
+				std::size_t m_Capacity;
+			};
+
+		public:
+			constexpr std::unique_ptr<CharType[], DynamicStorageDeleter> ReleaseStorage() noexcept
+			{
+				if (IsDynamicAllocated())
+				{
+					const auto capacity = GetCapacity();
+					const auto storage = m_Rep.Long.Data;
+					InitEmpty();
+					return std::unique_ptr<CharType[], DynamicStorageDeleter>(
+					    storage, DynamicStorageDeleter{ m_Allocator, capacity });
+				}
+
+				return {};
+			}
+		};
+
+		template <std::size_t Size>
+		class StringFindingCacheStorage
+		{
+		public:
+			constexpr std::span<Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size>
+			GetCacheContent() noexcept
+			{
+				return m_Cache;
+			}
+
+			constexpr std::span<const Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size>
+			GetCacheContent() const noexcept
+			{
+				return m_Cache;
+			}
+
+		private:
+			// 加 1 以保证 npos 不被合法值占用
+			std::array<Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size> m_Cache;
+		};
+
+		template <>
+		class StringFindingCacheStorage<std::numeric_limits<std::size_t>::max()>
+		{
+		public:
+			constexpr StringFindingCacheStorage(std::size_t size)
+			    : m_Cache{ new std::size_t[size]{} }, m_CacheSize{ size }
+			{
+			}
+
+			constexpr ~StringFindingCacheStorage()
+			{
+				delete[] m_Cache;
+			}
+
+			constexpr std::span<std::size_t> GetCacheContent() noexcept
+			{
+				return std::span(m_Cache, m_CacheSize);
+			}
+
+			constexpr std::span<const std::size_t> GetCacheContent() const noexcept
+			{
+				return std::span(m_Cache, m_CacheSize);
+			}
+
+		private:
+			std::size_t* m_Cache;
+			std::size_t m_CacheSize;
+		};
+
+		template <typename CharType>
+		constexpr bool IsStdCharType = std::is_same_v<CharType, char> ||
+#if __cpp_char8_t >= 201811L
+		                               std::is_same_v<CharType, char8_t> ||
+#endif
+		                               std::is_same_v<CharType, char16_t> ||
+		                               std::is_same_v<CharType, char32_t> ||
+		                               std::is_same_v<CharType, wchar_t>;
+
+		template <typename CharType>
+		[[nodiscard]] constexpr bool UnitsEqual(const CharType* a, const CharType* b,
+		                                        std::size_t size) noexcept
+		{
+			if constexpr (IsStdCharType<CharType>)
+			{
+				return std::char_traits<CharType>::compare(a, b, size) == 0;
+			}
+			else
+			{
+				return std::equal(a, a + size, b);
+			}
+		}
+
+		/// @brief  Two-Way 算法对模式串的预处理结果
+		struct TwoWayFactorization
+		{
+			/// @brief  关键分解位置，模式串被分为 [0, CriticalPos] 及 (CriticalPos, m)
+			std::ptrdiff_t CriticalPos;
+			/// @brief  模式串是周期的时为周期，否则为失配时的位移
+			std::ptrdiff_t Period;
+			bool IsPeriodic;
+		};
+
+		/// @brief  计算 Two-Way 算法所需的关键分解
+		/// @see    Crochemore M., Perrin D. Two-way string-matching. J. ACM 38(3), 1991
+		/// @remark 要求 patternSize > 0
+		template <typename CharType>
+		[[nodiscard]] constexpr TwoWayFactorization
+		TwoWayFactorize(const CharType* pattern, std::size_t patternSize) noexcept
+		{
+			const auto m = static_cast<std::ptrdiff_t>(patternSize);
+
+			// 计算在给定的序下的最大后缀的起始位置减 1 及其周期
+			const auto maximalSuffix = [&](bool reversed) constexpr {
+				std::ptrdiff_t ms = -1, j = 0, k = 1, p = 1;
+				while (j + k < m)
+				{
+					const auto a = pattern[j + k], b = pattern[ms + k];
+					if (reversed ? b < a : a < b)
+					{
+						j += k;
+						k = 1;
+						p = j - ms;
+					}
+					else if (a == b)
+					{
+						if (k != p)
+						{
+							++k;
+						}
+						else
+						{
+							j += p;
+							k = 1;
+						}
+					}
+					else
+					{
+						ms = j++;
+						k = p = 1;
+					}
+				}
+				return std::pair(ms, p);
+			};
+
+			const auto [suffix1, period1] = maximalSuffix(false);
+			const auto [suffix2, period2] = maximalSuffix(true);
+			const auto ell = suffix1 > suffix2 ? suffix1 : suffix2;
+			const auto period = suffix1 > suffix2 ? period1 : period2;
+
+			if (period + ell + 1 <= m &&
+			    UnitsEqual(pattern, pattern + period, static_cast<std::size_t>(ell + 1)))
+			{
+				return { ell, period, true };
+			}
+
+			return { ell, std::max(ell + 1, m - ell - 1) + 1, false };
+		}
+
+		/// @brief  以 Two-Way 算法查找，最坏情况下为线性时间且无需额外存储
+		/// @remark 要求 0 < patternSize，factorization 为 TwoWayFactorize 对同一模式串的结果
+		template <typename CharType>
+		[[nodiscard]] constexpr std::size_t
+		TwoWayFind(const CharType* str, std::size_t size, const CharType* pattern,
+		           std::size_t patternSize, TwoWayFactorization const& factorization) noexcept
+		{
+			const auto n = static_cast<std::ptrdiff_t>(size);
+			const auto m = static_cast<std::ptrdiff_t>(patternSize);
+			const auto [ell, period, isPeriodic] = factorization;
+
+			if (isPeriodic)
+			{
+				// 记忆已匹配的前缀以保证线性时间
+				std::ptrdiff_t memory = -1;
+				for (std::ptrdiff_t pos = 0; pos <= n - m;)
+				{
+					auto i = std::max(ell, memory) + 1;
+					while (i < m && pattern[i] == str[pos + i])
+					{
+						++i;
+					}
+
+					if (i < m)
+					{
+						pos += i - ell;
+						memory = -1;
+						continue;
+					}
+
+					i = ell;
+					while (i > memory && pattern[i] == str[pos + i])
+					{
+						--i;
+					}
+
+					if (i <= memory)
+					{
+						return static_cast<std::size_t>(pos);
+					}
+
+					pos += period;
+					memory = m - period - 1;
+				}
+			}
+			else
+			{
+				for (std::ptrdiff_t pos = 0; pos <= n - m;)
+				{
+					auto i = ell + 1;
+					while (i < m && pattern[i] == str[pos + i])
+					{
+						++i;
+					}
+
+					if (i < m)
+					{
+						pos += i - ell;
+						continue;
+					}
+
+					i = ell;
+					while (i >= 0 && pattern[i] == str[pos + i])
+					{
+						--i;
+					}
+
+					if (i < 0)
+					{
+						return static_cast<std::size_t>(pos);
+					}
+
+					pos += period;
+				}
+			}
+
+			return static_cast<std::size_t>(-1);
+		}
+
+		template <typename CharType>
+		[[nodiscard]] constexpr std::size_t TwoWayFind(const CharType* str, std::size_t size,
+		                                               const CharType* pattern,
+		                                               std::size_t patternSize) noexcept
+		{
+			return TwoWayFind(str, size, pattern, patternSize,
+			                  TwoWayFactorize(pattern, patternSize));
+		}
+
+		/// @brief  StringView::Find 的默认实现
+		/// @remark 先以模式串的首尾编码单元筛选候选位置，再比较中间部分；筛选按固定大小的块进行且块内
+		///         无分支，以便编译器向量化
+		///         比较中间部分的总开销超出已扫描长度的一定比例时（如周期性的病态输入），剩余部分改用
+		///         Two-Way 算法，因此最坏情况下仍为线性时间，且不需要分配内存
+		///         factorization 非空时使用预先计算的关键分解
+		template <typename CharType>
+		[[nodiscard]] constexpr std::size_t
+		FilterFind(const CharType* str, std::size_t size, const CharType* pattern,
+		           std::size_t patternSize,
+		           const TwoWayFactorization* factorization = nullptr) noexcept
+		{
+			constexpr std::size_t BlockSize = 32;
+			constexpr auto Npos = static_cast<std::size_t>(-1);
+
+			if (!patternSize)
+			{
+				return 0;
+			}
+
+			if (patternSize > size)
+			{
+				return Npos;
+			}
+
+			const auto first = pattern[0], last = pattern[patternSize - 1];
+			const auto lastOffset = patternSize - 1;
+			const auto maxPos = size - patternSize;
+			std::size_t verifyCost = 0;
+
+			for (std::size_t pos = 0; pos <= maxPos;)
+			{
+				for (; pos + BlockSize - 1 <= maxPos; pos += BlockSize)
+				{
+					bool hit = false;
+					for (std::size_t i = 0; i < BlockSize; ++i)
+					{
+						hit |= (str[pos + i] == first) & (str[pos + i + lastOffset] == last);
+					}
+
+					if (hit)
+					{
+						break;
+					}
+				}
+
+				const auto blockEnd = std::min(pos + BlockSize - 1, maxPos);
+				for (; pos <= blockEnd; ++pos)
+				{
+					if (str[pos] != first || str[pos + lastOffset] != last)
+					{
+						continue;
+					}
+
+					if (patternSize <= 2 || UnitsEqual(str + pos + 1, pattern + 1, patternSize - 2))
+					{
+						return pos;
+					}
+
+					verifyCost += patternSize;
+					if (verifyCost > 2 * pos + 8 * patternSize)
+					{
+						const auto result =
+						    factorization ? TwoWayFind(str + pos + 1, size - pos - 1, pattern,
+						                               patternSize, *factorization)
+						                  : TwoWayFind(str + pos + 1, size - pos - 1, pattern,
+						                               patternSize);
+						return result == Npos ? Npos : result + pos + 1;
+					}
+				}
+			}
+
+			return Npos;
+		}
+
+		/// @brief  获得 str 开头的字符的宽度，用于从字符串开头起依次确定字符边界
+		/// @remark 以 CodePageTrait::ToCodePoint 解码确定，因为 GetWidth 仅由首个编码单元判断，对于
+		///         GB18030 的四字节编码等无法由首个编码单元确定宽度的情况仅返回最小可能宽度
+		///         结尾被截断的字符视为延续至结尾，其他无法解码的情况退回到 GetWidth，无效的编码单元
+		///         视为单独的字符以便重新同步
+		template <CodePage::CodePageType CodePageValue, typename CharType>
+		[[nodiscard]] constexpr std::size_t GetLeadingCharWidth(const CharType* str,
+		                                                        std::size_t size) noexcept
+		{
+			using UsingCodePageTrait = CodePage::CodePageTrait<CodePageValue>;
+
+			std::size_t result = 0;
+			UsingCodePageTrait::ToCodePoint(
+			    std::span<const CharType>(str, size), [&](auto const& decodeResult) {
+				    constexpr auto ResultCode = GetEncodingResultCode<decltype(decodeResult)>;
+				    if constexpr (ResultCode == EncodingResultCode::Accept)
+				    {
+					    result = decodeResult.AdvanceCount;
+				    }
+				    else if constexpr (ResultCode == EncodingResultCode::Incomplete)
+				    {
+					    if (decodeResult.LackHint)
+					    {
+						    result = size;
+					    }
+				    }
+			    });
+
+			if (!result)
+			{
+				const auto width = UsingCodePageTrait::GetWidth(str[0]);
+				result = width > 0 ? std::min(static_cast<std::size_t>(width), size) : 1;
+			}
+
+			return result;
+		}
+
+		/// @brief  StringView::FindChar 的实现，查找首次起始于字符边界的出现位置
+		/// @remark 以 FilterFind 查找候选位置，再以 GetLeadingCharWidth 从 str 开头起依次确定字符边界，
+		///         候选位置不在字符边界时从其后的下一个字符边界继续查找，因此确定边界的总开销为线性
+		template <CodePage::CodePageType CodePageValue, typename CharType>
+		[[nodiscard]] constexpr std::size_t FindAtCharBoundary(const CharType* str, std::size_t size,
+		                                                       const CharType* pattern,
+		                                                       std::size_t patternSize) noexcept
+		{
+			using UsingCodePageTrait = CodePage::CodePageTrait<CodePageValue>;
+			constexpr auto Npos = static_cast<std::size_t>(-1);
+
+			if constexpr (!UsingCodePageTrait::IsVariableWidth)
+			{
+				return FilterFind(str, size, pattern, patternSize);
+			}
+			else
+			{
+				std::size_t boundary = 0;
+				while (true)
+				{
+					const auto found =
+					    FilterFind(str + boundary, size - boundary, pattern, patternSize);
+					if (found == Npos)
+					{
+						return Npos;
+					}
+
+					const auto pos = boundary + found;
+					while (boundary < pos)
+					{
+						boundary +=
+						    GetLeadingCharWidth<CodePageValue>(str + boundary, size - boundary);
+					}
+
+					if (boundary == pos)
+					{
+						return pos;
+					}
+				}
+			}
+		}
 
-		public:
-			constexpr std::unique_ptr<CharType[], DynamicStorageDeleter> ReleaseStorage() noexcept
+		/// @brief  BKDR 散列算法，逐个编码单元计算
+		/// @remark 为保持与已持久化的散列值兼容而保留
+		struct BkdrHashPolicy
+		{
+			template <typename CharType>
+			[[nodiscard]] static constexpr std::size_t
+			Hash(std::span<const CharType> const& span) noexcept
 			{
-				if (IsDynamicAllocated())
+				constexpr std::size_t seed = 131;
+				std::size_t hash = 0;
+
+				for (const auto item : span)
 				{
-					m_Size = 0;
-					const auto capacity = std::exchange(m_Capacity, SsoThresholdSize);
-					const auto storage = m_DynamicStorage;
-					m_SsoStorage[0] = CharType{};
-					return std::unique_ptr<CharType[], DynamicStorageDeleter>(
-					    storage, DynamicStorageDeleter{ m_Allocator, capacity });
+					hash = hash * seed + item;
 				}
 
-				return {};
+				return hash;
 			}
 		};
 
-		template <std::size_t Size>
-		class StringFindingCacheStorage
+		/// @brief  wyhash 算法，每次处理 16 或 48 字节
+		/// @remark 编码单元按小端序组合为 64 位的字，因此结果与平台字节序无关，可在常量求值环境下使用，
+		///         编译器通常可将组合合并为单次读取
+		struct WyHashPolicy
 		{
-		public:
-			constexpr std::span<Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size>
-			GetCacheContent() noexcept
-			{
-				return m_Cache;
-			}
+			static constexpr std::uint64_t Secret[] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+				                                        0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
 
-			constexpr std::span<const Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size>
-			GetCacheContent() const noexcept
+			template <typename CharType>
+			[[nodiscard]] static constexpr std::size_t
+			Hash(std::span<const CharType> const& span) noexcept
 			{
-				return m_Cache;
+				static_assert(sizeof(CharType) <= 4, "Unsupported code unit size.");
+
+				const auto data = span.data();
+				const std::uint64_t size = span.size_bytes();
+
+				auto seed = Mix(Secret[0], Secret[1]);
+				std::uint64_t a, b;
+				if (size <= 16)
+				{
+					if (size >= 4)
+					{
+						const auto offset = (size >> 3) << 2;
+						a = (Read<4>(data, 0) << 32) | Read<4>(data, offset);
+						b = (Read<4>(data, size - 4) << 32) | Read<4>(data, size - 4 - offset);
+					}
+					else if (size > 0)
+					{
+						a = (ReadByte(data, 0) << 16) | (ReadByte(data, size >> 1) << 8) |
+						    ReadByte(data, size - 1);
+						b = 0;
+					}
+					else
+					{
+						a = b = 0;
+					}
+				}
+				else
+				{
+					std::uint64_t offset = 0;
+					auto remained = size;
+					if (remained >= 48)
+					{
+						auto seed1 = seed, seed2 = seed;
+						do
+						{
+							seed = Mix(Read<8>(data, offset) ^ Secret[1],
+							           Read<8>(data, offset + 8) ^ seed);
+							seed1 = Mix(Read<8>(data, offset + 16) ^ Secret[2],
+							            Read<8>(data, offset + 24) ^ seed1);
+							seed2 = Mix(Read<8>(data, offset + 32) ^ Secret[3],
+							            Read<8>(data, offset + 40) ^ seed2);
+							offset += 48;
+							remained -= 48;
+						} while (remained >= 48);
+						seed ^= seed1 ^ seed2;
+					}
+
+					while (remained > 16)
+					{
+						seed = Mix(Read<8>(data, offset) ^ Secret[1],
+						           Read<8>(data, offset + 8) ^ seed);
+						offset += 16;
+						remained -= 16;
+					}
+
+					a = Read<8>(data, offset + remained - 16);
+					b = Read<8>(data, offset + remained - 8);
+				}
+
+				a ^= Secret[1];
+				b ^= seed;
+				MultiplyFull(a, b);
+				return static_cast<std::size_t>(Mix(a ^ Secret[0] ^ size, b ^ Secret[1]));
 			}
 
 		private:
-			// 加 1 以保证 npos 不被合法值占用
-			std::array<Core::Misc::UnsignedMinTypeToHold<Size + 1>, Size> m_Cache;
-		};
-
-		template <>
-		class StringFindingCacheStorage<std::numeric_limits<std::size_t>::max()>
-		{
-		public:
-			constexpr StringFindingCacheStorage(std::size_t size)
-			    : m_Cache{ new std::size_t[size]{} }, m_CacheSize{ size }
+			/// @brief  将 a 与 b 相乘，低 64 位存入 a，高 64 位存入 b
+			static constexpr void MultiplyFull(std::uint64_t& a, std::uint64_t& b) noexcept
 			{
+#ifdef __SIZEOF_INT128__
+				const auto result = static_cast<unsigned __int128>(a) * b;
+				a = static_cast<std::uint64_t>(result);
+				b = static_cast<std::uint64_t>(result >> 64);
+#else
+				const auto aHigh = a >> 32, aLow = a & 0xFFFFFFFF;
+				const auto bHigh = b >> 32, bLow = b & 0xFFFFFFFF;
+				const auto highHigh = aHigh * bHigh, highLow = aHigh * bLow,
+				           lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+				const auto middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+				a = (middle << 32) | (lowLow & 0xFFFFFFFF);
+				b = highHigh + (highLow >> 32) + (middle >> 32);
+#endif
 			}
 
-			constexpr ~StringFindingCacheStorage()
+			[[nodiscard]] static constexpr std::uint64_t Mix(std::uint64_t a, std::uint64_t b) noexcept
 			{
-				delete[] m_Cache;
+				MultiplyFull(a, b);
+				return a ^ b;
 			}
 
-			constexpr std::span<std::size_t> GetCacheContent() noexcept
+			template <typename CharType>
+			[[nodiscard]] static constexpr std::uint64_t ToUnsigned(CharType value) noexcept
 			{
-				return std::span(m_Cache, m_CacheSize);
+				return static_cast<std::make_unsigned_t<CharType>>(value);
 			}
 
-			constexpr std::span<const std::size_t> GetCacheContent() const noexcept
+			/// @brief  读取以字节计算的偏移处的一个字节
+			template <typename CharType>
+			[[nodiscard]] static constexpr std::uint64_t ReadByte(const CharType* data,
+			                                                      std::uint64_t offset) noexcept
 			{
-				return std::span(m_Cache, m_CacheSize);
+				return (ToUnsigned(data[offset / sizeof(CharType)]) >>
+				        (8 * (offset % sizeof(CharType)))) &
+				       0xFF;
 			}
 
-		private:
-			std::size_t* m_Cache;
-			std::size_t m_CacheSize;
+			/// @brief  以小端序读取以字节计算的偏移处的 Size 个字节
+			/// @remark offset 总是编码单元大小的整数倍
+			template <std::size_t Size, typename CharType>
+			[[nodiscard]] static constexpr std::uint64_t Read(const CharType* data,
+			                                                  std::uint64_t offset) noexcept
+			{
+				constexpr auto UnitCount = Size / sizeof(CharType);
+				const auto units = data + offset / sizeof(CharType);
+				std::uint64_t result = 0;
+				for (std::size_t i = 0; i < UnitCount; ++i)
+				{
+					result |= ToUnsigned(units[i]) << (8 * sizeof(CharType) * i);
+				}
+				return result;
+			}
 		};
+
+		using DefaultHashPolicy = WyHashPolicy;
 	} // namespace Detail
 
 	template <CodePage::CodePageType CodePageValue,
@@ -577,6 +1800,19 @@ namespace Cafe::Encoding
 	          typename GrowPolicy = Detail::DefaultGrowPolicy>
 	class String;
 
+	/// @brief  采用紧凑布局的字符串
+	/// @remark 动态存储的指针、大小及容量与 SSO 缓冲区共用存储，SSO 的大小保存在缓冲区的最后一个字节，
+	///         因此默认情况下对象大小仅为 3 个指针，在 64 位平台上可存放 23 个 UTF-8 编码单元而不需分配
+	///         SsoThresholdSize 以字节而非编码单元计算，包含结尾的空编码单元
+	///         常量求值环境下总是使用动态存储
+	template <CodePage::CodePageType CodePageValue,
+	          typename Allocator =
+	              std::allocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>,
+	          std::size_t SsoThresholdSize = 3 * sizeof(void*),
+	          typename GrowPolicy = Detail::DefaultGrowPolicy>
+	using CompactString =
+	    String<CodePageValue, Allocator, SsoThresholdSize, Detail::CompactLayout<GrowPolicy>>;
+
 	/// @brief  判断类型是否为 Cafe::Encoding::String 的实例
 	template <typename T>
 	struct IsStringTrait : std::false_type
@@ -826,26 +2062,22 @@ namespace Cafe::Encoding
 				return;
 			}
 
-			cacheStorage[0] = -1;
-
-			if (size == 1)
-			{
-				return;
-			}
-
-			cacheStorage[1] = 0;
+			using FindingCacheElemType =
+			    typename std::remove_cvref_t<decltype(cacheStorage)>::value_type;
+			constexpr auto FindingCacheNpos = static_cast<FindingCacheElemType>(-1);
 
-			std::size_t candidate = 0;
-			for (std::size_t i = 2; i < size; ++i)
+			// cacheStorage[i] 为 [0, i) 的最长真前后缀的长度，失配时需回退查找更短的前后缀
+			cacheStorage[0] = FindingCacheNpos;
+			auto candidate = FindingCacheNpos;
+			for (std::size_t i = 0; i + 1 < size;)
 			{
-				if (m_Span[i - 1] == m_Span[candidate])
+				if (candidate == FindingCacheNpos || m_Span[i] == m_Span[candidate])
 				{
-					cacheStorage[i] = ++candidate;
+					cacheStorage[++i] = ++candidate;
 				}
 				else
 				{
-					candidate = 0;
-					cacheStorage[i] = 0;
+					candidate = cacheStorage[candidate];
 				}
 			}
 		}
@@ -890,11 +2122,66 @@ namespace Cafe::Encoding
 			return Npos;
 		}
 
+		/// @brief  查找模式串首次出现的位置
+		/// @remark 若模式串以空编码单元结尾，结尾的空编码单元不参与查找
+		///         最坏情况下为线性时间，且不需要分配内存
 		template <std::size_t OtherExtent>
 		[[nodiscard]] constexpr std::size_t
 		Find(StringView<CodePageValue, OtherExtent> const& pattern) const noexcept
 		{
-			return NaiveFind(pattern);
+			return Detail::FilterFind(m_Span.data(), m_Span.size(), pattern.GetData(),
+			                          pattern.GetSize() - pattern.IsNullTerminated());
+		}
+
+		/// @brief  查找模式串首次起始于字符边界的出现位置
+		/// @remark 对于变长代码页，Find 可能找到起始于字符中间的出现（如 GB2312 双字节字符的尾字节），
+		///         此方法排除这类出现；对于定长代码页与 Find 相同
+		///         若模式串以空编码单元结尾，结尾的空编码单元不参与查找
+		template <std::size_t OtherExtent>
+		[[nodiscard]] constexpr std::size_t
+		FindChar(StringView<CodePageValue, OtherExtent> const& pattern) const noexcept
+		{
+			return Detail::FindAtCharBoundary<CodePageValue>(
+			    m_Span.data(), m_Span.size(), pattern.GetData(),
+			    pattern.GetSize() - pattern.IsNullTerminated());
+		}
+
+		/// @brief  查找以其他代码页表示的模式串首次起始于字符边界的出现位置
+		/// @remark 仅将模式串编码到此代码页一次，不转换被查找的字符串
+		/// @return 出现的位置，模式串无法编码到此代码页或未找到时返回 Npos
+		template <CodePage::CodePageType OtherCodePageValue, std::size_t OtherExtent>
+		[[nodiscard]] constexpr std::size_t
+		FindChar(StringView<OtherCodePageValue, OtherExtent> const& pattern) const;
+
+		/// @brief  查找码点首次出现的位置
+		/// @return 出现的位置，码点无法以此代码页表示或未找到时返回 Npos
+		[[nodiscard]] constexpr std::size_t FindCodePoint(CodePointType codePoint) const noexcept
+		{
+			CharType units[CodePage::GetMaxWidth<CodePageValue>()]{};
+			std::size_t unitCount = 0;
+			Encoder<CodePage::CodePoint, CodePageValue>::Encode(codePoint, [&](auto const& result) {
+				if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+				{
+					if constexpr (UsingCodePageTrait::IsVariableWidth)
+					{
+						unitCount = result.Result.size();
+						std::copy_n(result.Result.data(), unitCount, units);
+					}
+					else
+					{
+						units[0] = result.Result;
+						unitCount = 1;
+					}
+				}
+			});
+
+			if (!unitCount)
+			{
+				return Npos;
+			}
+
+			return Detail::FindAtCharBoundary<CodePageValue>(m_Span.data(), m_Span.size(), units,
+			                                                 unitCount);
 		}
 
 		template <std::size_t OtherExtent>
@@ -1412,7 +2699,8 @@ namespace Cafe::Encoding
 
 		constexpr iterator RemoveBack(std::size_t count = 1) noexcept
 		{
-			return m_Storage.RemoveBack(count);
+			m_Storage.RemoveBack(count);
+			return end();
 		}
 
 		[[nodiscard]] constexpr iterator begin() noexcept
@@ -1517,6 +2805,11 @@ namespace Cafe::Encoding
 			return m_Storage.GetCapacity();
 		}
 
+		[[nodiscard]] constexpr allocator_type GetAllocator() const noexcept
+		{
+			return m_Storage.GetAllocator();
+		}
+
 		[[nodiscard]] constexpr ViewType<> GetView() const noexcept
 		{
 			return ViewType<>{ std::span(m_Storage.GetStorage(), m_Storage.GetSize()) };
@@ -1607,7 +2900,12 @@ namespace Cafe::Encoding
 	operator+(String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& a,
 	          StringView<CodePageValue, Extent> const& b)
 	{
-		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> tmpStr(a);
+		// 预先分配足够的空间，避免复制 a 之后追加 b 时再次分配
+		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> tmpStr(
+		    std::allocator_traits<Allocator>::select_on_container_copy_construction(
+		        a.GetAllocator()));
+		tmpStr.Reserve(a.GetSize() + b.GetTrimmedSpan().size());
+		tmpStr.Append(a.GetView());
 		tmpStr.Append(b);
 		return tmpStr;
 	}
@@ -1646,12 +2944,248 @@ namespace Cafe::Encoding
 	operator+(StringView<CodePageValue, Extent> const& a,
 	          String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& b)
 	{
-		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> tmpStr(a);
+		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> tmpStr(
+		    std::allocator_traits<Allocator>::select_on_container_copy_construction(
+		        b.GetAllocator()));
+		tmpStr.Reserve(a.GetTrimmedSpan().size() + b.GetSize());
+		tmpStr.Append(a);
 		tmpStr.Append(b.GetView());
 		return tmpStr;
 	}
 
-	// 注：两个 StringView 不可相加
+	/// @brief  延迟的字符串连接
+	/// @remark 由 StringView 之间的 operator+ 产生，继续以 operator+ 连接时仅记录各部分，
+	///         转换为 String 时计算总大小后一次性分配，每部分仅复制一次
+	///         仅保存各部分的视图，因此不应在各部分失效后使用，通常应直接转换为 String 而不是以 auto
+	///         保存
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount>
+	class ConcatExpression
+	{
+	public:
+		static constexpr CodePage::CodePageType UsingCodePage = CodePageValue;
+
+		constexpr explicit ConcatExpression(
+		    std::array<StringView<CodePageValue>, PieceCount> const& pieces) noexcept
+		    : m_Pieces{ pieces }
+		{
+		}
+
+		[[nodiscard]] constexpr std::array<StringView<CodePageValue>, PieceCount> const&
+		GetPieces() const noexcept
+		{
+			return m_Pieces;
+		}
+
+		/// @brief  获得连接结果的大小，不包含结尾的空编码单元
+		[[nodiscard]] constexpr std::size_t GetSize() const noexcept
+		{
+			std::size_t size{};
+			for (const auto& piece : m_Pieces)
+			{
+				size += piece.GetTrimmedSpan().size();
+			}
+			return size;
+		}
+
+		template <std::size_t SsoThresholdSize = Detail::DefaultSsoThresholdSize,
+		          typename GrowPolicy = Detail::DefaultGrowPolicy,
+		          typename Allocator =
+		              std::allocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>>
+		[[nodiscard]] constexpr String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>
+		ToString(Allocator allocator = Allocator{}) const
+		{
+			String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> result(
+			    std::move(allocator));
+			result.Reserve(GetSize() + 1);
+			for (const auto& piece : m_Pieces)
+			{
+				result.Append(piece);
+			}
+			return result;
+		}
+
+		template <typename Allocator, std::size_t SsoThresholdSize, typename GrowPolicy>
+		constexpr operator String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>() const
+		{
+			return ToString<SsoThresholdSize, GrowPolicy, Allocator>();
+		}
+
+	private:
+		std::array<StringView<CodePageValue>, PieceCount> m_Pieces;
+	};
+
+	template <CodePage::CodePageType CodePageValue, std::size_t Extent1, std::size_t Extent2>
+	[[nodiscard]] constexpr ConcatExpression<CodePageValue, 2>
+	operator+(StringView<CodePageValue, Extent1> const& a,
+	          StringView<CodePageValue, Extent2> const& b) noexcept
+	{
+		return ConcatExpression<CodePageValue, 2>{ { a, b } };
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, std::size_t Extent>
+	[[nodiscard]] constexpr ConcatExpression<CodePageValue, PieceCount + 1>
+	operator+(ConcatExpression<CodePageValue, PieceCount> const& a,
+	          StringView<CodePageValue, Extent> const& b) noexcept
+	{
+		std::array<StringView<CodePageValue>, PieceCount + 1> pieces;
+		std::copy(a.GetPieces().begin(), a.GetPieces().end(), pieces.begin());
+		pieces.back() = b;
+		return ConcatExpression<CodePageValue, PieceCount + 1>{ pieces };
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, std::size_t Extent>
+	[[nodiscard]] constexpr ConcatExpression<CodePageValue, PieceCount + 1>
+	operator+(StringView<CodePageValue, Extent> const& a,
+	          ConcatExpression<CodePageValue, PieceCount> const& b) noexcept
+	{
+		std::array<StringView<CodePageValue>, PieceCount + 1> pieces;
+		pieces.front() = a;
+		std::copy(b.GetPieces().begin(), b.GetPieces().end(), pieces.begin() + 1);
+		return ConcatExpression<CodePageValue, PieceCount + 1>{ pieces };
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, typename Allocator,
+	          std::size_t SsoThresholdSize, typename GrowPolicy>
+	[[nodiscard]] constexpr ConcatExpression<CodePageValue, PieceCount + 1>
+	operator+(ConcatExpression<CodePageValue, PieceCount> const& a,
+	          String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& b) noexcept
+	{
+		return a + b.GetView();
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, typename Allocator,
+	          std::size_t SsoThresholdSize, typename GrowPolicy>
+	[[nodiscard]] constexpr ConcatExpression<CodePageValue, PieceCount + 1>
+	operator+(String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& a,
+	          ConcatExpression<CodePageValue, PieceCount> const& b) noexcept
+	{
+		return a.GetView() + b;
+	}
+
+	// 右值 String 在表达式结束后失效，因此立即求值
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, typename Allocator,
+	          std::size_t SsoThresholdSize, typename GrowPolicy>
+	[[nodiscard]] constexpr String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>
+	operator+(ConcatExpression<CodePageValue, PieceCount> const& a,
+	          String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>&& b)
+	{
+		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> result(b.GetAllocator());
+		result.Reserve(a.GetSize() + b.GetSize());
+		for (const auto& piece : a.GetPieces())
+		{
+			result.Append(piece);
+		}
+		result.Append(b.GetView());
+		return result;
+	}
+
+	template <CodePage::CodePageType CodePageValue, std::size_t PieceCount, typename Allocator,
+	          std::size_t SsoThresholdSize, typename GrowPolicy>
+	[[nodiscard]] constexpr String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>
+	operator+(String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>&& a,
+	          ConcatExpression<CodePageValue, PieceCount> const& b)
+	{
+		a.Reserve(a.GetSize() + b.GetSize());
+		for (const auto& piece : b.GetPieces())
+		{
+			a.Append(piece);
+		}
+		return std::move(a);
+	}
+
+	namespace Detail
+	{
+		template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+		constexpr StringView<CodePageValue, Extent> const&
+		AsConcatPiece(StringView<CodePageValue, Extent> const& piece) noexcept
+		{
+			return piece;
+		}
+
+		template <CodePage::CodePageType CodePageValue, typename Allocator,
+		          std::size_t SsoThresholdSize, typename GrowPolicy>
+		constexpr StringView<CodePageValue> AsConcatPiece(
+		    String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& piece) noexcept
+		{
+			return piece.GetView();
+		}
+
+		template <CodePage::CodePageType ToCodePageValue, CodePage::CodePageType FromCodePageValue,
+		          std::size_t Extent>
+		constexpr std::size_t
+		GetConcatPieceSize(StringView<FromCodePageValue, Extent> const& piece) noexcept
+		{
+			if constexpr (ToCodePageValue == FromCodePageValue)
+			{
+				return piece.GetTrimmedSpan().size();
+			}
+			else
+			{
+				return CountEncodeSize<FromCodePageValue, ToCodePageValue>(piece.GetTrimmedSpan())
+				    .second;
+			}
+		}
+
+		template <typename StringType, CodePage::CodePageType FromCodePageValue, std::size_t Extent>
+		constexpr void AppendConcatPiece(StringType& result,
+		                                 StringView<FromCodePageValue, Extent> const& piece)
+		{
+			constexpr auto ToCodePageValue = StringType::UsingCodePage;
+			if constexpr (ToCodePageValue == FromCodePageValue)
+			{
+				result.Append(piece);
+			}
+			else
+			{
+				Encoder<FromCodePageValue, ToCodePageValue>::EncodeAll(
+				    piece.GetTrimmedSpan(), [&](auto const& encodeResult) {
+					    if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+					                  EncodingResultCode::Accept)
+					    {
+						    if constexpr (CodePage::CodePageTrait<ToCodePageValue>::IsVariableWidth)
+						    {
+							    // 逐个追加以免编码结果中的 0 被视为结尾的空编码单元
+							    for (const auto unit : encodeResult.Result)
+							    {
+								    result.Append(unit);
+							    }
+						    }
+						    else
+						    {
+							    result.Append(encodeResult.Result);
+						    }
+					    }
+				    });
+			}
+		}
+	} // namespace Detail
+
+	/// @brief  连接各部分为 CodePageValue 的字符串
+	/// @param  pieces  StringView 或 String，可以为不同的代码页，此时将被编码到 CodePageValue
+	/// @remark 预先计算总大小，仅分配一次
+	///         若某部分无法编码，则该部分仅保留出错前已编码的内容
+	template <CodePage::CodePageType CodePageValue,
+	          std::size_t SsoThresholdSize = Detail::DefaultSsoThresholdSize,
+	          typename GrowPolicy = Detail::DefaultGrowPolicy,
+	          typename Allocator =
+	              std::allocator<typename CodePage::CodePageTrait<CodePageValue>::CharType>,
+	          typename... Pieces>
+	[[nodiscard]] constexpr String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy>
+	Concat(Pieces const&... pieces)
+	{
+		String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> result;
+		result.Reserve(
+		    (Detail::GetConcatPieceSize<CodePageValue>(Detail::AsConcatPiece(pieces)) + ... + 1));
+		(Detail::AppendConcatPiece(result, Detail::AsConcatPiece(pieces)), ...);
+		return result;
+	}
+
+	/// @brief  连接代码页相同的各部分，代码页由第一部分决定
+	template <typename FirstPiece, typename... Pieces>
+	[[nodiscard]] constexpr auto Concat(FirstPiece const& firstPiece, Pieces const&... pieces)
+	{
+		return Concat<std::remove_cvref_t<FirstPiece>::UsingCodePage>(firstPiece, pieces...);
+	}
 
 	template <CodePage::CodePageType CodePageValue, std::size_t Extent>
 	template <std::size_t SsoThresholdSize, typename GrowPolicy, typename Allocator>
@@ -1663,6 +3197,72 @@ namespace Cafe::Encoding
 		};
 	}
 
+	template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+	template <CodePage::CodePageType OtherCodePageValue, std::size_t OtherExtent>
+	[[nodiscard]] constexpr std::size_t StringView<CodePageValue, Extent>::FindChar(
+	    StringView<OtherCodePageValue, OtherExtent> const& pattern) const
+	{
+		String<CodePageValue> encodedPattern;
+		auto succeed = true;
+		Encoder<OtherCodePageValue, CodePageValue>::EncodeAll(
+		    pattern.GetTrimmedSpan(), [&](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    encodedPattern.Append(result.Result);
+			    }
+			    else
+			    {
+				    succeed = false;
+			    }
+		    });
+
+		if (!succeed)
+		{
+			return Npos;
+		}
+
+		return FindChar(encodedPattern.GetView());
+	}
+
+	/// @brief  字符串的散列函数对象
+	/// @remark 可透明地接受 StringView、StaticString 及 String，内容相同时结果相同
+	///         std::hash 使用 Detail::DefaultHashPolicy，需要与已持久化的散列值保持一致时可以
+	///         Detail::BkdrHashPolicy 作为 HashPolicy，例如
+	/// @code
+	///     std::unordered_map<String<CodePage::Utf8>, int,
+	///                        StringHasher<Detail::BkdrHashPolicy>> map;
+	/// @endcode
+	template <typename HashPolicy = Detail::DefaultHashPolicy>
+	struct StringHasher
+	{
+		using is_transparent = void;
+
+		template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+		[[nodiscard]] constexpr std::size_t
+		operator()(StringView<CodePageValue, Extent> const& value) const noexcept
+		{
+			return HashPolicy::Hash(
+			    std::span<const typename CodePage::CodePageTrait<CodePageValue>::CharType>(
+			        value.GetSpan()));
+		}
+
+		template <CodePage::CodePageType CodePageValue, std::size_t MaxSize>
+		[[nodiscard]] constexpr std::size_t
+		operator()(StaticString<CodePageValue, MaxSize> const& value) const noexcept
+		{
+			return operator()(value.GetView());
+		}
+
+		template <CodePage::CodePageType CodePageValue, typename Allocator,
+		          std::size_t SsoThresholdSize, typename GrowPolicy>
+		[[nodiscard]] std::size_t
+		operator()(String<CodePageValue, Allocator, SsoThresholdSize, GrowPolicy> const& value) const
+		    noexcept
+		{
+			return operator()(value.GetView());
+		}
+	};
+
 #if __cpp_nontype_template_parameter_class >= 201806L
 	template <CodePage::CodePageType ToCodePage, auto Str>
 	[[nodiscard]] constexpr auto StaticEncode() noexcept
@@ -1697,19 +3297,10 @@ namespace std
 	template <Cafe::Encoding::CodePage::CodePageType CodePageValue, std::size_t Extent>
 	struct hash<Cafe::Encoding::StringView<CodePageValue, Extent>>
 	{
-		// 使用 BKDR hash 算法
 		[[nodiscard]] constexpr std::size_t
 		operator()(Cafe::Encoding::StringView<CodePageValue, Extent> const& value) const noexcept
 		{
-			constexpr std::size_t seed = 131;
-			std::size_t hash = 0;
-
-			for (const auto item : value)
-			{
-				hash = hash * seed + item;
-			}
-
-			return hash;
+			return Cafe::Encoding::StringHasher<>{}(value);
 		}
 	};
 
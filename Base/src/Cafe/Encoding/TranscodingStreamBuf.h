@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Encode.h"
+#include <cstring>
+#include <streambuf>
+#include <vector>
+
+namespace Cafe::Encoding
+{
+	/// @brief  转码流缓冲的公共部分
+	/// @remark 读取时从底层流缓冲按块读取来源代码页的数据，转码后提供给使用者；
+	///         写入时将使用者写入的来源代码页的数据按块转码后写入底层流缓冲
+	///         跨越块边界的不完整字符会保留到下一块继续处理
+	///         出现无法转码的数据时停止转码，可通过 GetResultCode 获得原因
+	class TranscodingStreamBufBase : public std::streambuf
+	{
+	public:
+		static constexpr std::size_t DefaultBufferSize = 64 * 1024;
+
+		/// @brief  转码一块数据的结果
+		struct TranscodeResult
+		{
+			EncodingResultCode ResultCode;
+			std::size_t ConsumeCount; ///< @brief 已转码的来源字节数
+		};
+
+		/// @param  underlying  底层流缓冲，生存期需长于本对象
+		/// @param  bufferSize  读取及写入时每块的字节数，至少需能容纳来源代码页的一个完整字符
+		explicit TranscodingStreamBufBase(std::streambuf* underlying,
+		                                  std::size_t bufferSize = DefaultBufferSize)
+		    : m_Underlying{ underlying }, m_ReadBuffer(bufferSize), m_ReadSize{},
+		      m_WriteBuffer(bufferSize), m_ResultCode{ EncodingResultCode::Accept }
+		{
+			const auto writeBuffer = reinterpret_cast<char*>(m_WriteBuffer.data());
+			setp(writeBuffer, writeBuffer + m_WriteBuffer.size());
+		}
+
+		/// @brief  获得首次出现的错误，未出现错误时为 EncodingResultCode::Accept
+		[[nodiscard]] EncodingResultCode GetResultCode() const noexcept
+		{
+			return m_ResultCode;
+		}
+
+	protected:
+		/// @brief  转码 src 开头尽可能多的数据，将结果追加到 dst
+		/// @remark src 的起始位置按 std::max_align_t 对齐
+		///         结尾不完整的字符及不足一个编码单元的字节不应视为错误，未转码的部分将在之后重新提供
+		virtual TranscodeResult Transcode(std::span<const std::byte> src,
+		                                  std::vector<char>& dst) = 0;
+
+		int_type underflow() override
+		{
+			if (gptr() < egptr())
+			{
+				return traits_type::to_int_type(*gptr());
+			}
+
+			if (!m_Underlying || m_ResultCode != EncodingResultCode::Accept)
+			{
+				return traits_type::eof();
+			}
+
+			m_GetBuffer.clear();
+			while (m_GetBuffer.empty())
+			{
+				const auto readCount =
+				    m_ReadSize < m_ReadBuffer.size()
+				        ? static_cast<std::size_t>(m_Underlying->sgetn(
+				              reinterpret_cast<char*>(m_ReadBuffer.data() + m_ReadSize),
+				              static_cast<std::streamsize>(m_ReadBuffer.size() - m_ReadSize)))
+				        : 0;
+				m_ReadSize += readCount;
+				// 缓冲区已满却无法转码时同样视为结束
+				const auto isEnd = readCount == 0;
+				if (!m_ReadSize)
+				{
+					break;
+				}
+
+				const auto [resultCode, consumeCount] =
+				    Transcode(std::span(m_ReadBuffer.data(), m_ReadSize), m_GetBuffer);
+				std::memmove(m_ReadBuffer.data(), m_ReadBuffer.data() + consumeCount,
+				             m_ReadSize - consumeCount);
+				m_ReadSize -= consumeCount;
+
+				if (resultCode == EncodingResultCode::Reject)
+				{
+					m_ResultCode = EncodingResultCode::Reject;
+					break;
+				}
+
+				if (isEnd)
+				{
+					if (m_ReadSize)
+					{
+						m_ResultCode = EncodingResultCode::Incomplete;
+					}
+					break;
+				}
+			}
+
+			if (m_GetBuffer.empty())
+			{
+				return traits_type::eof();
+			}
+
+			setg(m_GetBuffer.data(), m_GetBuffer.data(), m_GetBuffer.data() + m_GetBuffer.size());
+			return traits_type::to_int_type(*gptr());
+		}
+
+		int_type overflow(int_type ch) override
+		{
+			if (!m_Underlying || !FlushWriteBuffer())
+			{
+				return traits_type::eof();
+			}
+
+			if (traits_type::eq_int_type(ch, traits_type::eof()))
+			{
+				return traits_type::not_eof(ch);
+			}
+
+			if (pptr() == epptr())
+			{
+				// 整个缓冲区都无法转码
+				m_ResultCode = EncodingResultCode::Incomplete;
+				return traits_type::eof();
+			}
+
+			*pptr() = traits_type::to_char_type(ch);
+			pbump(1);
+			return ch;
+		}
+
+		/// @remark 结尾不完整的字符会保留在缓冲区中，不会写入底层流缓冲
+		int sync() override
+		{
+			if (!m_Underlying || !FlushWriteBuffer())
+			{
+				return -1;
+			}
+
+			return m_Underlying->pubsync();
+		}
+
+	private:
+		std::streambuf* m_Underlying;
+
+		std::vector<std::byte> m_ReadBuffer;
+		std::size_t m_ReadSize;
+		std::vector<char> m_GetBuffer;
+
+		std::vector<std::byte> m_WriteBuffer;
+		std::vector<char> m_PutBuffer;
+
+		EncodingResultCode m_ResultCode;
+
+		bool FlushWriteBuffer()
+		{
+			const auto writeBuffer = reinterpret_cast<char*>(m_WriteBuffer.data());
+			const auto size = static_cast<std::size_t>(pptr() - writeBuffer);
+			if (!size)
+			{
+				return true;
+			}
+
+			if (m_ResultCode == EncodingResultCode::Reject)
+			{
+				return false;
+			}
+
+			m_PutBuffer.clear();
+			const auto [resultCode, consumeCount] =
+			    Transcode(std::span(m_WriteBuffer.data(), size), m_PutBuffer);
+			if (!m_PutBuffer.empty() &&
+			    m_Underlying->sputn(m_PutBuffer.data(),
+			                        static_cast<std::streamsize>(m_PutBuffer.size())) !=
+			        static_cast<std::streamsize>(m_PutBuffer.size()))
+			{
+				return false;
+			}
+
+			if (resultCode == EncodingResultCode::Reject)
+			{
+				m_ResultCode = EncodingResultCode::Reject;
+				return false;
+			}
+
+			const auto restSize = size - consumeCount;
+			std::memmove(writeBuffer, writeBuffer + consumeCount, restSize);
+			setp(writeBuffer, writeBuffer + m_WriteBuffer.size());
+			pbump(static_cast<int>(restSize));
+			return true;
+		}
+	};
+
+	/// @brief  在编译期确定的代码页之间转码的流缓冲
+	/// @remark 读写的数据均为代码页的编码单元在内存中的表示
+	template <CodePage::CodePageType FromCodePageValue, CodePage::CodePageType ToCodePageValue>
+	class TranscodingStreamBuf : public TranscodingStreamBufBase
+	{
+	public:
+		using TranscodingStreamBufBase::TranscodingStreamBufBase;
+
+		~TranscodingStreamBuf() override
+		{
+			pubsync();
+		}
+
+	protected:
+		TranscodeResult Transcode(std::span<const std::byte> src, std::vector<char>& dst) override
+		{
+			using FromCharType = typename CodePage::CodePageTrait<FromCodePageValue>::CharType;
+
+			TranscodeResult transcodeResult{ EncodingResultCode::Accept, 0 };
+			Encoder<FromCodePageValue, ToCodePageValue>::EncodeAll(
+			    std::span(reinterpret_cast<const FromCharType*>(src.data()),
+			              src.size() / sizeof(FromCharType)),
+			    [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    const auto resultSpan = [&] {
+						    if constexpr (CodePage::CodePageTrait<ToCodePageValue>::IsVariableWidth)
+						    {
+							    return std::as_bytes(result.Result);
+						    }
+						    else
+						    {
+							    return std::as_bytes(std::span(&result.Result, 1));
+						    }
+					    }();
+					    const auto resultData = reinterpret_cast<const char*>(resultSpan.data());
+					    dst.insert(dst.end(), resultData, resultData + resultSpan.size());
+					    transcodeResult.ConsumeCount += result.AdvanceCount * sizeof(FromCharType);
+				    }
+				    else
+				    {
+					    transcodeResult.ResultCode = GetEncodingResultCode<decltype(result)>;
+				    }
+			    });
+			return transcodeResult;
+		}
+	};
+} // namespace Cafe::Encoding
@@ -0,0 +1,658 @@
+#pragma once
+
+#include "Strings.h"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+
+namespace Cafe::Encoding
+{
+	namespace Detail
+	{
+		/// @brief  解码单个字符的结果
+		/// @remark Width 为 0 表示解码失败，此时 ResultCode 为失败的原因
+		struct DecodeOneResult
+		{
+			CodePointType Value;
+			std::size_t Width;
+			EncodingResultCode ResultCode;
+		};
+
+		/// @brief  解码 span 开头的字符
+		template <CodePage::CodePageType CodePageValue>
+		constexpr DecodeOneResult DecodeFirst(
+		    std::span<const typename CodePage::CodePageTrait<CodePageValue>::CharType> const&
+		        span) noexcept
+		{
+			DecodeOneResult decodeResult{ 0, 0, EncodingResultCode::Accept };
+			const auto encodeUnit = [&] {
+				if constexpr (CodePage::CodePageTrait<CodePageValue>::IsVariableWidth)
+				{
+					return span;
+				}
+				else
+				{
+					return span[0];
+				}
+			}();
+
+			Encoder<CodePageValue, CodePage::CodePoint>::Encode(
+			    encodeUnit, [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    decodeResult.Value = result.Result;
+					    decodeResult.Width = static_cast<std::size_t>(result.AdvanceCount);
+				    }
+				    else
+				    {
+					    decodeResult.ResultCode = GetEncodingResultCode<decltype(result)>;
+				    }
+			    });
+			return decodeResult;
+		}
+
+		/// @brief  判断代码页是否支持从结尾向前解码
+		/// @remark 定长代码页总是支持，变长代码页需提供 ToCodePointBackward
+		template <CodePage::CodePageType CodePageValue>
+		concept BackwardDecodable =
+		    !CodePage::CodePageTrait<CodePageValue>::IsVariableWidth || requires(
+		        std::span<const typename CodePage::CodePageTrait<CodePageValue>::CharType> span) {
+			    CodePage::CodePageTrait<CodePageValue>::ToCodePointBackward(span,
+			                                                                [](auto const&) {});
+		    };
+
+		/// @brief  解码 span 结尾的字符
+		template <CodePage::CodePageType CodePageValue>
+		requires BackwardDecodable<CodePageValue> constexpr DecodeOneResult DecodeLast(
+		    std::span<const typename CodePage::CodePageTrait<CodePageValue>::CharType> const&
+		        span) noexcept
+		{
+			if constexpr (!CodePage::CodePageTrait<CodePageValue>::IsVariableWidth)
+			{
+				return DecodeFirst<CodePageValue>(span.last(1));
+			}
+			else
+			{
+				DecodeOneResult decodeResult{ 0, 0, EncodingResultCode::Accept };
+				CodePage::CodePageTrait<CodePageValue>::ToCodePointBackward(
+				    span, [&](auto const& result) {
+					    if constexpr (GetEncodingResultCode<decltype(result)> ==
+					                  EncodingResultCode::Accept)
+					    {
+						    decodeResult.Value = result.Result;
+						    decodeResult.Width = static_cast<std::size_t>(result.AdvanceCount);
+					    }
+					    else
+					    {
+						    decodeResult.ResultCode = GetEncodingResultCode<decltype(result)>;
+					    }
+				    });
+				return decodeResult;
+			}
+		}
+	} // namespace Detail
+
+	/// @brief  在字符串上逐字符解码的迭代器
+	/// @remark 每次解引用得到一个码点，迭代器总是预先解码当前位置的字符
+	///         遇到无法解码的数据时迭代器与 std::default_sentinel 相等，此时可通过 GetResultCode
+	///         获得原因，GetPosition 即为出错的位置
+	///         代码页支持向前解码时迭代器是双向迭代器
+	template <CodePage::CodePageType CodePageValue>
+	class DecodeIterator
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+	public:
+		using value_type = CodePointType;
+		using difference_type = std::ptrdiff_t;
+		using reference = CodePointType;
+		using iterator_category = std::input_iterator_tag;
+		using iterator_concept =
+		    std::conditional_t<Detail::BackwardDecodable<CodePageValue>,
+		                       std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+
+		constexpr DecodeIterator() noexcept
+		    : m_Begin{}, m_Current{}, m_End{}, m_Result{ 0, 0, EncodingResultCode::Accept }
+		{
+		}
+
+		explicit constexpr DecodeIterator(std::span<const CharType> const& span) noexcept
+		    : m_Begin{ span.data() }, m_Current{ span.data() }, m_End{ span.data() + span.size() },
+		      m_Result{ 0, 0, EncodingResultCode::Accept }
+		{
+			DecodeCurrent();
+		}
+
+		[[nodiscard]] constexpr CodePointType operator*() const noexcept
+		{
+			assert(m_Result.Width);
+			return m_Result.Value;
+		}
+
+		constexpr DecodeIterator& operator++() noexcept
+		{
+			assert(m_Result.Width);
+			m_Current += m_Result.Width;
+			DecodeCurrent();
+			return *this;
+		}
+
+		constexpr DecodeIterator operator++(int) noexcept
+		{
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		/// @remark 前一字符无法解码时位置不变，迭代器与 std::default_sentinel 相等
+		constexpr DecodeIterator& operator--() noexcept requires
+		    Detail::BackwardDecodable<CodePageValue>
+		{
+			assert(m_Current != m_Begin);
+			m_Result = Detail::DecodeLast<CodePageValue>(std::span(m_Begin, m_Current));
+			m_Current -= m_Result.Width;
+			return *this;
+		}
+
+		constexpr DecodeIterator operator--(int) noexcept requires
+		    Detail::BackwardDecodable<CodePageValue>
+		{
+			auto result = *this;
+			--*this;
+			return result;
+		}
+
+		[[nodiscard]] constexpr bool operator==(DecodeIterator const& other) const noexcept
+		{
+			return m_Current == other.m_Current;
+		}
+
+		[[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept
+		{
+			return !m_Result.Width;
+		}
+
+		/// @brief  获得当前字符在原字符串中的起始位置
+		[[nodiscard]] constexpr const CharType* GetPosition() const noexcept
+		{
+			return m_Current;
+		}
+
+		/// @brief  获得当前字符占用的编码单元个数，已到达结尾或出错时为 0
+		[[nodiscard]] constexpr std::size_t GetWidth() const noexcept
+		{
+			return m_Result.Width;
+		}
+
+		/// @brief  获得当前位置的解码结果，正常到达结尾时为 Accept
+		[[nodiscard]] constexpr EncodingResultCode GetResultCode() const noexcept
+		{
+			return m_Result.ResultCode;
+		}
+
+	private:
+		const CharType* m_Begin;
+		const CharType* m_Current;
+		const CharType* m_End;
+		Detail::DecodeOneResult m_Result;
+
+		constexpr void DecodeCurrent() noexcept
+		{
+			if (m_Current == m_End)
+			{
+				m_Result = { 0, 0, EncodingResultCode::Accept };
+				return;
+			}
+
+			m_Result = Detail::DecodeFirst<CodePageValue>(std::span(m_Current, m_End));
+		}
+	};
+
+	/// @brief  将字符串惰性解码为码点的视图
+	/// @remark 仅在迭代时解码，适用于只需要开头若干字符或逐字符处理的场合
+	template <CodePage::CodePageType CodePageValue>
+	class DecodeView : public std::ranges::view_interface<DecodeView<CodePageValue>>
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+	public:
+		constexpr DecodeView() noexcept = default;
+
+		explicit constexpr DecodeView(std::span<const CharType> const& span) noexcept
+		    : m_Span{ span }
+		{
+		}
+
+		[[nodiscard]] constexpr DecodeIterator<CodePageValue> begin() const noexcept
+		{
+			return DecodeIterator<CodePageValue>{ m_Span };
+		}
+
+		[[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+		{
+			return std::default_sentinel;
+		}
+
+		[[nodiscard]] constexpr std::span<const CharType> GetSpan() const noexcept
+		{
+			return m_Span;
+		}
+
+	private:
+		std::span<const CharType> m_Span;
+	};
+
+	/// @brief  在字符串上逐编码单元转码的迭代器
+	/// @remark 每次解引用得到目标代码页的一个编码单元，一个来源字符转码的结果缓存在迭代器内
+	///         遇到无法转码的数据时迭代器与 std::default_sentinel 相等，此时可通过 GetResultCode
+	///         获得原因，GetPosition 即为出错的位置
+	template <CodePage::CodePageType FromCodePageValue, CodePage::CodePageType ToCodePageValue>
+	class TranscodeIterator
+	{
+		using FromCharType = typename CodePage::CodePageTrait<FromCodePageValue>::CharType;
+		using ToCodePageTrait = CodePage::CodePageTrait<ToCodePageValue>;
+		using ToCharType = typename ToCodePageTrait::CharType;
+
+	public:
+		using value_type = ToCharType;
+		using difference_type = std::ptrdiff_t;
+		using reference = ToCharType;
+		using iterator_category = std::input_iterator_tag;
+		using iterator_concept = std::forward_iterator_tag;
+
+		constexpr TranscodeIterator() noexcept
+		    : m_Decoder{}, m_Units{}, m_UnitCount{}, m_UnitIndex{},
+		      m_ResultCode{ EncodingResultCode::Accept }
+		{
+		}
+
+		explicit constexpr TranscodeIterator(std::span<const FromCharType> const& span) noexcept
+		    : m_Decoder{ span }, m_Units{}, m_UnitCount{}, m_UnitIndex{},
+		      m_ResultCode{ EncodingResultCode::Accept }
+		{
+			EncodeCurrent();
+		}
+
+		[[nodiscard]] constexpr ToCharType operator*() const noexcept
+		{
+			assert(m_UnitIndex < m_UnitCount);
+			return m_Units[m_UnitIndex];
+		}
+
+		constexpr TranscodeIterator& operator++() noexcept
+		{
+			if (++m_UnitIndex == m_UnitCount)
+			{
+				++m_Decoder;
+				EncodeCurrent();
+			}
+			return *this;
+		}
+
+		constexpr TranscodeIterator operator++(int) noexcept
+		{
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		[[nodiscard]] constexpr bool operator==(TranscodeIterator const& other) const noexcept
+		{
+			return m_Decoder == other.m_Decoder && m_UnitIndex == other.m_UnitIndex;
+		}
+
+		[[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept
+		{
+			return !m_UnitCount;
+		}
+
+		/// @brief  获得当前编码单元所属的来源字符在原字符串中的起始位置
+		[[nodiscard]] constexpr const FromCharType* GetPosition() const noexcept
+		{
+			return m_Decoder.GetPosition();
+		}
+
+		/// @brief  获得当前位置的转码结果，正常到达结尾时为 Accept
+		[[nodiscard]] constexpr EncodingResultCode GetResultCode() const noexcept
+		{
+			return m_ResultCode;
+		}
+
+	private:
+		DecodeIterator<FromCodePageValue> m_Decoder;
+		std::array<ToCharType, CodePage::GetMaxWidth<ToCodePageValue>()> m_Units;
+		std::size_t m_UnitCount;
+		std::size_t m_UnitIndex;
+		EncodingResultCode m_ResultCode;
+
+		constexpr void EncodeCurrent() noexcept
+		{
+			m_UnitCount = 0;
+			m_UnitIndex = 0;
+			if (m_Decoder == std::default_sentinel)
+			{
+				m_ResultCode = m_Decoder.GetResultCode();
+				return;
+			}
+
+			EncoderBase<CodePage::CodePoint, ToCodePageValue>::Encode(
+			    *m_Decoder, [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    if constexpr (ToCodePageTrait::IsVariableWidth)
+					    {
+						    std::copy(result.Result.begin(), result.Result.end(), m_Units.begin());
+						    m_UnitCount = result.Result.size();
+					    }
+					    else
+					    {
+						    m_Units[0] = result.Result;
+						    m_UnitCount = 1;
+					    }
+				    }
+				    else
+				    {
+					    m_ResultCode = GetEncodingResultCode<decltype(result)>;
+				    }
+			    });
+		}
+	};
+
+	/// @brief  将字符串惰性转码为目标代码页的编码单元的视图
+	template <CodePage::CodePageType FromCodePageValue, CodePage::CodePageType ToCodePageValue>
+	class TranscodeView
+	    : public std::ranges::view_interface<TranscodeView<FromCodePageValue, ToCodePageValue>>
+	{
+		using CharType = typename CodePage::CodePageTrait<FromCodePageValue>::CharType;
+
+	public:
+		constexpr TranscodeView() noexcept = default;
+
+		explicit constexpr TranscodeView(std::span<const CharType> const& span) noexcept
+		    : m_Span{ span }
+		{
+		}
+
+		[[nodiscard]] constexpr TranscodeIterator<FromCodePageValue, ToCodePageValue>
+		begin() const noexcept
+		{
+			return TranscodeIterator<FromCodePageValue, ToCodePageValue>{ m_Span };
+		}
+
+		[[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+		{
+			return std::default_sentinel;
+		}
+
+		[[nodiscard]] constexpr std::span<const CharType> GetSpan() const noexcept
+		{
+			return m_Span;
+		}
+
+	private:
+		std::span<const CharType> m_Span;
+	};
+
+	/// @brief  在字符串上从结尾向前逐字符解码的迭代器
+	/// @remark 仅解码实际访问的字符，因此获取结尾的若干字符的开销仅与这些字符的长度相关
+	///         遇到无法解码的数据时迭代器与 std::default_sentinel 相等，此时可通过 GetResultCode
+	///         获得原因，GetPosition 即为无法解码的数据的结尾
+	template <CodePage::CodePageType CodePageValue>
+	requires Detail::BackwardDecodable<CodePageValue>
+	class ReverseDecodeIterator
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+	public:
+		using value_type = CodePointType;
+		using difference_type = std::ptrdiff_t;
+		using reference = CodePointType;
+		using iterator_category = std::input_iterator_tag;
+		using iterator_concept = std::bidirectional_iterator_tag;
+
+		constexpr ReverseDecodeIterator() noexcept
+		    : m_Begin{}, m_Current{}, m_End{}, m_Result{ 0, 0, EncodingResultCode::Accept }
+		{
+		}
+
+		explicit constexpr ReverseDecodeIterator(std::span<const CharType> const& span) noexcept
+		    : m_Begin{ span.data() }, m_Current{ span.data() + span.size() },
+		      m_End{ span.data() + span.size() }, m_Result{ 0, 0, EncodingResultCode::Accept }
+		{
+			DecodeCurrent();
+		}
+
+		[[nodiscard]] constexpr CodePointType operator*() const noexcept
+		{
+			assert(m_Result.Width);
+			return m_Result.Value;
+		}
+
+		constexpr ReverseDecodeIterator& operator++() noexcept
+		{
+			assert(m_Result.Width);
+			m_Current -= m_Result.Width;
+			DecodeCurrent();
+			return *this;
+		}
+
+		constexpr ReverseDecodeIterator operator++(int) noexcept
+		{
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		/// @remark 后一字符无法解码时位置不变，迭代器与 std::default_sentinel 相等
+		constexpr ReverseDecodeIterator& operator--() noexcept
+		{
+			assert(m_Current != m_End);
+			m_Result = Detail::DecodeFirst<CodePageValue>(std::span(m_Current, m_End));
+			m_Current += m_Result.Width;
+			return *this;
+		}
+
+		constexpr ReverseDecodeIterator operator--(int) noexcept
+		{
+			auto result = *this;
+			--*this;
+			return result;
+		}
+
+		[[nodiscard]] constexpr bool operator==(ReverseDecodeIterator const& other) const noexcept
+		{
+			return m_Current == other.m_Current;
+		}
+
+		[[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept
+		{
+			return !m_Result.Width;
+		}
+
+		/// @brief  获得当前字符在原字符串中的起始位置
+		[[nodiscard]] constexpr const CharType* GetPosition() const noexcept
+		{
+			return m_Current - m_Result.Width;
+		}
+
+		/// @brief  获得当前字符占用的编码单元个数，已到达开头或出错时为 0
+		[[nodiscard]] constexpr std::size_t GetWidth() const noexcept
+		{
+			return m_Result.Width;
+		}
+
+		/// @brief  获得当前位置的解码结果，正常到达开头时为 Accept
+		[[nodiscard]] constexpr EncodingResultCode GetResultCode() const noexcept
+		{
+			return m_Result.ResultCode;
+		}
+
+	private:
+		const CharType* m_Begin;
+		// 当前字符的结尾
+		const CharType* m_Current;
+		const CharType* m_End;
+		Detail::DecodeOneResult m_Result;
+
+		constexpr void DecodeCurrent() noexcept
+		{
+			if (m_Current == m_Begin)
+			{
+				m_Result = { 0, 0, EncodingResultCode::Accept };
+				return;
+			}
+
+			m_Result = Detail::DecodeLast<CodePageValue>(std::span(m_Begin, m_Current));
+		}
+	};
+
+	/// @brief  将字符串从结尾向前惰性解码为码点的视图
+	/// @remark 适用于获取结尾的若干字符、按码点去除结尾空白等仅与后缀相关的操作
+	template <CodePage::CodePageType CodePageValue>
+	requires Detail::BackwardDecodable<CodePageValue>
+	class ReverseDecodeView : public std::ranges::view_interface<ReverseDecodeView<CodePageValue>>
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+	public:
+		constexpr ReverseDecodeView() noexcept = default;
+
+		explicit constexpr ReverseDecodeView(std::span<const CharType> const& span) noexcept
+		    : m_Span{ span }
+		{
+		}
+
+		[[nodiscard]] constexpr ReverseDecodeIterator<CodePageValue> begin() const noexcept
+		{
+			return ReverseDecodeIterator<CodePageValue>{ m_Span };
+		}
+
+		[[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+		{
+			return std::default_sentinel;
+		}
+
+		[[nodiscard]] constexpr std::span<const CharType> GetSpan() const noexcept
+		{
+			return m_Span;
+		}
+
+	private:
+		std::span<const CharType> m_Span;
+	};
+
+	namespace Views
+	{
+		namespace Detail
+		{
+			template <typename T>
+			concept OwningString = IsString<T> || IsStaticString<T>;
+
+			/// @brief  将字符串转换为视图的适配器的公共部分
+			/// @remark 可以 Adaptor(str) 或 str | Adaptor 的形式使用
+			///         若字符串以空编码单元结尾，结尾的空编码单元不会被处理
+			template <typename Derived>
+			struct AdaptorBase
+			{
+				template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+				[[nodiscard]] constexpr auto
+				operator()(StringView<CodePageValue, Extent> const& str) const noexcept
+				{
+					return Derived::template MakeView<CodePageValue>(str.GetTrimmedSpan());
+				}
+
+				template <OwningString T>
+				[[nodiscard]] constexpr auto operator()(T const& str) const noexcept
+				{
+					return operator()(str.GetView());
+				}
+
+				// 视图不持有字符串，禁止从临时字符串构造
+				template <OwningString T>
+				void operator()(T const&& str) const = delete;
+
+				template <typename T>
+				[[nodiscard]] friend constexpr auto operator|(T&& str, Derived const& adaptor) noexcept(
+				    noexcept(adaptor(std::forward<T>(str)))) -> decltype(adaptor(std::forward<T>(str)))
+				{
+					return adaptor(std::forward<T>(str));
+				}
+			};
+
+			struct DecodeAdaptor : AdaptorBase<DecodeAdaptor>
+			{
+				template <CodePage::CodePageType CodePageValue, typename CharType>
+				static constexpr DecodeView<CodePageValue>
+				MakeView(std::span<const CharType> const& span) noexcept
+				{
+					return DecodeView<CodePageValue>{ span };
+				}
+			};
+
+			struct ReverseDecodeAdaptor : AdaptorBase<ReverseDecodeAdaptor>
+			{
+				template <CodePage::CodePageType CodePageValue, typename CharType>
+				static constexpr ReverseDecodeView<CodePageValue>
+				MakeView(std::span<const CharType> const& span) noexcept
+				{
+					return ReverseDecodeView<CodePageValue>{ span };
+				}
+			};
+
+			template <CodePage::CodePageType ToCodePageValue>
+			struct TranscodeAdaptor : AdaptorBase<TranscodeAdaptor<ToCodePageValue>>
+			{
+				template <CodePage::CodePageType CodePageValue, typename CharType>
+				static constexpr TranscodeView<CodePageValue, ToCodePageValue>
+				MakeView(std::span<const CharType> const& span) noexcept
+				{
+					return TranscodeView<CodePageValue, ToCodePageValue>{ span };
+				}
+			};
+		} // namespace Detail
+
+		/// @brief  惰性解码为码点
+		/// @code
+		///     for (const auto codePoint : str | Views::Decode | std::views::take(3))
+		///     {
+		///         ...
+		///     }
+		/// @endcode
+		inline constexpr Detail::DecodeAdaptor Decode{};
+
+		/// @brief  从结尾向前惰性解码为码点
+		/// @code
+		///     // 按码点去除结尾空白
+		///     auto iter = (str | Views::ReverseDecode).begin();
+		///     while (iter != std::default_sentinel && IsWhiteSpace(*iter))
+		///     {
+		///         ++iter;
+		///     }
+		///     const auto trimmed = str.SubStr(0, iter.GetPosition() + iter.GetWidth() - str.GetData());
+		/// @endcode
+		inline constexpr Detail::ReverseDecodeAdaptor ReverseDecode{};
+
+		/// @brief  惰性转码为 ToCodePageValue 的编码单元
+		template <CodePage::CodePageType ToCodePageValue>
+		inline constexpr Detail::TranscodeAdaptor<ToCodePageValue> Transcode{};
+	} // namespace Views
+} // namespace Cafe::Encoding
+
+namespace std::ranges
+{
+	template <Cafe::Encoding::CodePage::CodePageType CodePageValue>
+	inline constexpr bool enable_borrowed_range<Cafe::Encoding::DecodeView<CodePageValue>> = true;
+
+	template <Cafe::Encoding::CodePage::CodePageType CodePageValue>
+	inline constexpr bool
+	    enable_borrowed_range<Cafe::Encoding::ReverseDecodeView<CodePageValue>> = true;
+
+	template <Cafe::Encoding::CodePage::CodePageType FromCodePageValue,
+	          Cafe::Encoding::CodePage::CodePageType ToCodePageValue>
+	inline constexpr bool
+	    enable_borrowed_range<Cafe::Encoding::TranscodeView<FromCodePageValue, ToCodePageValue>> =
+	        true;
+} // namespace std::ranges
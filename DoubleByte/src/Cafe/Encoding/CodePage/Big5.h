@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_BIG5_H
+#define CAFE_ENCODING_CODEPAGE_BIG5_H
+
+#include "DoubleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  表示 Windows 所使用的 Big5 编码
+		constexpr CodePageType Big5 = static_cast<CodePageType>(950);
+
+		namespace Detail
+		{
+			inline constexpr DoubleBytePair Big5Mapping[] = {
+				// 0xA2CC 及 0xA2CE 与以下编码映射到相同的码点，编码时使用以下编码
+				{ 0xA451, 0x5341 },
+				{ 0xA4CA, 0x5345 },
+#define DOUBLE_BYTE_PAIR(code, codePoint) { code, codePoint },
+#include "Impl/Big5Impl.h"
+			};
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Big5> : Detail::DoubleByteCommonPart<Big5, Detail::Big5Mapping>
+		{
+			static constexpr const char Name[] = "Big5";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Big5)
+#endif
@@ -0,0 +1,286 @@
+#ifndef CAFE_ENCODING_CODEPAGE_DOUBLE_BYTE_H
+#define CAFE_ENCODING_CODEPAGE_DOUBLE_BYTE_H
+
+#include <Cafe/Encoding/Encode.h>
+#include <Cafe/Encoding/Strings.h>
+#include <array>
+#include <cstdint>
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		namespace Detail
+		{
+			/// @brief  双字节代码页的映射项
+			/// @remark Code 小于 0x100 时表示单字节编码单元，否则高 8 位为前导字节，低 8 位为后续字节
+			///         同一码点存在多个映射项时，编码时使用最先出现的非后备映射项，参见
+			///         DoubleByteCommonPart
+			struct DoubleBytePair
+			{
+				std::uint16_t Code;
+				char16_t CodePoint;
+			};
+
+			/// @brief  单字节编码单元中表示未映射的码点
+			/// @remark U+FFFF 是非字符，不会出现在任何映射文件中
+			constexpr char16_t DoubleByteUnmapped = 0xFFFF;
+
+			/// @brief  两级表中的一页，index 是低 8 位
+			/// @remark 第 0 页保留为全部未映射
+			template <typename T>
+			using DoubleBytePage = std::array<T, 256>;
+
+			template <std::size_t RowCount>
+			struct DoubleByteToUnicodeMapping
+			{
+				/// @brief  单字节编码单元的映射，未映射为 DoubleByteUnmapped
+				std::array<char16_t, 256> SingleByte;
+				/// @brief  前导字节对应的行号，为 0 表示不是前导字节
+				std::array<std::uint8_t, 256> LeadIndex;
+				/// @brief  各前导字节所在的行，index 是后续字节，未映射为 0
+				std::array<DoubleBytePage<char16_t>, RowCount> Rows;
+			};
+
+			template <std::size_t PageCount>
+			struct UnicodeToDoubleByteMapping
+			{
+				/// @brief  码点的高 8 位对应的页号
+				std::array<std::uint8_t, 256> PageIndex;
+				/// @brief  各页的映射，index 是码点的低 8 位，未映射为 0
+				std::array<DoubleBytePage<std::uint16_t>, PageCount> Pages;
+			};
+
+			/// @brief  计算正向映射表需要的行数，包括保留的第 0 行
+			template <std::size_t N>
+			[[nodiscard]] constexpr std::size_t
+			CountDoubleByteRows(DoubleBytePair const (&pairs)[N]) noexcept
+			{
+				std::array<bool, 256> used{};
+				std::size_t count = 1;
+				for (const auto pair : pairs)
+				{
+					if (pair.Code > 0xFF && !used[pair.Code >> 8])
+					{
+						used[pair.Code >> 8] = true;
+						++count;
+					}
+				}
+				return count;
+			}
+
+			/// @brief  计算反向映射表需要的页数，包括保留的第 0 页
+			template <std::size_t N>
+			[[nodiscard]] constexpr std::size_t
+			CountDoubleBytePages(DoubleBytePair const (&pairs)[N]) noexcept
+			{
+				std::array<bool, 256> used{};
+				std::size_t count = 1;
+				for (const auto pair : pairs)
+				{
+					if (!used[pair.CodePoint >> 8])
+					{
+						used[pair.CodePoint >> 8] = true;
+						++count;
+					}
+				}
+				return count;
+			}
+
+			/// @brief  生成双字节代码页到 Unicode 的映射表
+			/// @remark 求值开销较大，除生成映射表外不应使用
+			template <std::size_t RowCount, std::size_t N>
+			[[nodiscard]] constexpr DoubleByteToUnicodeMapping<RowCount>
+			MakeDoubleByteToUnicodeMapping(DoubleBytePair const (&pairs)[N]) noexcept
+			{
+				DoubleByteToUnicodeMapping<RowCount> result{};
+				result.SingleByte.fill(DoubleByteUnmapped);
+				std::size_t nextRow = 1;
+				for (const auto pair : pairs)
+				{
+					if (pair.Code <= 0xFF)
+					{
+						result.SingleByte[pair.Code] = pair.CodePoint;
+						continue;
+					}
+
+					auto& row = result.LeadIndex[pair.Code >> 8];
+					if (!row)
+					{
+						row = static_cast<std::uint8_t>(nextRow++);
+					}
+					result.Rows[row][pair.Code & 0xFF] = pair.CodePoint;
+				}
+				return result;
+			}
+
+			/// @brief  不将任何编码视为后备编码
+			[[nodiscard]] constexpr bool NoDoubleByteFallback(std::uint16_t) noexcept
+			{
+				return false;
+			}
+
+			/// @brief  生成 Unicode 到双字节代码页的映射表
+			/// @remark 求值开销较大，除生成映射表外不应使用
+			///         isFallback 为 true 的编码仅在码点没有其他编码时使用
+			template <std::size_t PageCount, std::size_t N>
+			[[nodiscard]] constexpr UnicodeToDoubleByteMapping<PageCount>
+			MakeUnicodeToDoubleByteMapping(DoubleBytePair const (&pairs)[N],
+			                               bool (*isFallback)(std::uint16_t)) noexcept
+			{
+				UnicodeToDoubleByteMapping<PageCount> result{};
+				std::array<bool, 0x10000> mapped{};
+				std::size_t nextPage = 1;
+				// 第一遍跳过后备编码，第二遍仅处理后备编码
+				for (const auto fallbackPass : { false, true })
+				{
+					for (const auto& pair : pairs)
+					{
+						if (isFallback(pair.Code) != fallbackPass || mapped[pair.CodePoint])
+						{
+							continue;
+						}
+						mapped[pair.CodePoint] = true;
+
+						auto& page = result.PageIndex[pair.CodePoint >> 8];
+						if (!page)
+						{
+							page = static_cast<std::uint8_t>(nextPage++);
+						}
+						result.Pages[page][pair.CodePoint & 0xFF] = pair.Code;
+					}
+				}
+				return result;
+			}
+
+			/// @brief  由映射表驱动的双字节代码页的通用部分
+			/// @remark Pairs 为映射项数组，由 tools/DoubleByteMappingTool.cpp 从 Unicode
+			///         提供的映射文件生成
+			///         正反向映射表均为两级表，仅为实际使用的前导字节及码点高 8 位分配空间
+			///         IsFallback 用于指定编码时优先级最低的编码，这些编码仅在码点没有其他编码时
+			///         使用，其余情况下使用最先出现的映射项
+			template <CodePageType DoubleByteCodePage, auto const& Pairs,
+			          bool (*IsFallback)(std::uint16_t) = NoDoubleByteFallback>
+			struct DoubleByteCommonPart
+			{
+			private:
+				static constexpr auto ToUnicodeMapping =
+				    MakeDoubleByteToUnicodeMapping<CountDoubleByteRows(Pairs)>(Pairs);
+				static constexpr auto FromUnicodeMapping =
+				    MakeUnicodeToDoubleByteMapping<CountDoubleBytePages(Pairs)>(Pairs, IsFallback);
+
+			public:
+				using CharType = char;
+
+				static constexpr bool IsVariableWidth = true;
+
+				static constexpr std::size_t MaxWidth = 2;
+
+				[[nodiscard]] static constexpr std::ptrdiff_t GetWidth(CharType value) noexcept
+				{
+					return ToUnicodeMapping.LeadIndex[static_cast<unsigned char>(value)] ? 2 : 1;
+				}
+
+				template <std::size_t Extent, typename OutputReceiver>
+				static constexpr void ToCodePoint(std::span<const CharType, Extent> const& span,
+				                                  OutputReceiver&& receiver)
+				{
+					if (span.empty())
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<DoubleByteCodePage, CodePoint,
+						                   EncodingResultCode::Incomplete>{ 0, 1 });
+						return;
+					}
+
+					const auto firstUnit = static_cast<unsigned char>(span[0]);
+					const auto row = ToUnicodeMapping.LeadIndex[firstUnit];
+					if (!row)
+					{
+						const auto result = ToUnicodeMapping.SingleByte[firstUnit];
+						if (result == DoubleByteUnmapped)
+						{
+							std::forward<OutputReceiver>(receiver)(
+							    EncodingResult<DoubleByteCodePage, CodePoint,
+							                   EncodingResultCode::Reject>{});
+						}
+						else
+						{
+							std::forward<OutputReceiver>(receiver)(
+							    EncodingResult<DoubleByteCodePage, CodePoint,
+							                   EncodingResultCode::Accept>{
+							        static_cast<CodePointType>(result), 1u });
+						}
+						return;
+					}
+
+					if (span.size() < 2)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<DoubleByteCodePage, CodePoint,
+						                   EncodingResultCode::Incomplete>{ 0, 1 });
+						return;
+					}
+
+					const auto result =
+					    ToUnicodeMapping.Rows[row][static_cast<unsigned char>(span[1])];
+					if (!result)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<DoubleByteCodePage, CodePoint,
+						                   EncodingResultCode::Reject>{});
+					}
+					else
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<DoubleByteCodePage, CodePoint,
+						                   EncodingResultCode::Accept>{
+						        static_cast<CodePointType>(result), 2u });
+					}
+				}
+
+				template <typename OutputReceiver>
+				static constexpr void FromCodePoint(CodePointType codePoint,
+				                                    OutputReceiver&& receiver)
+				{
+					if (codePoint > 0xFFFF)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<CodePoint, DoubleByteCodePage,
+						                   EncodingResultCode::Reject>{});
+						return;
+					}
+
+					const auto page = FromUnicodeMapping.PageIndex[codePoint >> 8];
+					const auto mappedUnit = FromUnicodeMapping.Pages[page][codePoint & 0xFF];
+					// 仅 U+0000 可能映射到 0
+					if (!mappedUnit && codePoint)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<CodePoint, DoubleByteCodePage,
+						                   EncodingResultCode::Reject>{});
+						return;
+					}
+
+					if (mappedUnit <= 0xFF)
+					{
+						const auto result = static_cast<CharType>(mappedUnit);
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<CodePoint, DoubleByteCodePage,
+						                   EncodingResultCode::Accept>{ std::span(&result, 1) });
+					}
+					else
+					{
+						const CharType result[]{ static_cast<CharType>((mappedUnit & 0xFF00) >> 8),
+							                     static_cast<CharType>(mappedUnit & 0xFF) };
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<CodePoint, DoubleByteCodePage,
+						                   EncodingResultCode::Accept>{ std::span(result) });
+					}
+				}
+			};
+		} // namespace Detail
+	}     // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
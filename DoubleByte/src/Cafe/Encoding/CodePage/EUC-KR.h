@@ -0,0 +1,33 @@
+#ifndef CAFE_ENCODING_CODEPAGE_EUC_KR_H
+#define CAFE_ENCODING_CODEPAGE_EUC_KR_H
+
+#include "DoubleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  表示 Windows 所使用的 EUC-KR 编码（统一韩文编码）
+		constexpr CodePageType EucKr = static_cast<CodePageType>(949);
+
+		namespace Detail
+		{
+			inline constexpr DoubleBytePair EucKrMapping[] = {
+#define DOUBLE_BYTE_PAIR(code, codePoint) { code, codePoint },
+#include "Impl/EUC-KRImpl.h"
+			};
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<EucKr> : Detail::DoubleByteCommonPart<EucKr, Detail::EucKrMapping>
+		{
+			static constexpr const char Name[] = "EUC-KR";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::EucKr)
+#endif
@@ -0,0 +1,13885 @@
+// This file is generated from https://www.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP950.TXT
+// DO NOT EDIT!
+
+DOUBLE_BYTE_PAIR(0x00, 0x0000)
+DOUBLE_BYTE_PAIR(0x01, 0x0001)
+DOUBLE_BYTE_PAIR(0x02, 0x0002)
+DOUBLE_BYTE_PAIR(0x03, 0x0003)
+DOUBLE_BYTE_PAIR(0x04, 0x0004)
+DOUBLE_BYTE_PAIR(0x05, 0x0005)
+DOUBLE_BYTE_PAIR(0x06, 0x0006)
+DOUBLE_BYTE_PAIR(0x07, 0x0007)
+DOUBLE_BYTE_PAIR(0x08, 0x0008)
+DOUBLE_BYTE_PAIR(0x09, 0x0009)
+DOUBLE_BYTE_PAIR(0x0A, 0x000A)
+DOUBLE_BYTE_PAIR(0x0B, 0x000B)
+DOUBLE_BYTE_PAIR(0x0C, 0x000C)
+DOUBLE_BYTE_PAIR(0x0D, 0x000D)
+DOUBLE_BYTE_PAIR(0x0E, 0x000E)
+DOUBLE_BYTE_PAIR(0x0F, 0x000F)
+DOUBLE_BYTE_PAIR(0x10, 0x0010)
+DOUBLE_BYTE_PAIR(0x11, 0x0011)
+DOUBLE_BYTE_PAIR(0x12, 0x0012)
+DOUBLE_BYTE_PAIR(0x13, 0x0013)
+DOUBLE_BYTE_PAIR(0x14, 0x0014)
+DOUBLE_BYTE_PAIR(0x15, 0x0015)
+DOUBLE_BYTE_PAIR(0x16, 0x0016)
+DOUBLE_BYTE_PAIR(0x17, 0x0017)
+DOUBLE_BYTE_PAIR(0x18, 0x0018)
+DOUBLE_BYTE_PAIR(0x19, 0x0019)
+DOUBLE_BYTE_PAIR(0x1A, 0x001A)
+DOUBLE_BYTE_PAIR(0x1B, 0x001B)
+DOUBLE_BYTE_PAIR(0x1C, 0x001C)
+DOUBLE_BYTE_PAIR(0x1D, 0x001D)
+DOUBLE_BYTE_PAIR(0x1E, 0x001E)
+DOUBLE_BYTE_PAIR(0x1F, 0x001F)
+DOUBLE_BYTE_PAIR(0x20, 0x0020)
+DOUBLE_BYTE_PAIR(0x21, 0x0021)
+DOUBLE_BYTE_PAIR(0x22, 0x0022)
+DOUBLE_BYTE_PAIR(0x23, 0x0023)
+DOUBLE_BYTE_PAIR(0x24, 0x0024)
+DOUBLE_BYTE_PAIR(0x25, 0x0025)
+DOUBLE_BYTE_PAIR(0x26, 0x0026)
+DOUBLE_BYTE_PAIR(0x27, 0x0027)
+DOUBLE_BYTE_PAIR(0x28, 0x0028)
+DOUBLE_BYTE_PAIR(0x29, 0x0029)
+DOUBLE_BYTE_PAIR(0x2A, 0x002A)
+DOUBLE_BYTE_PAIR(0x2B, 0x002B)
+DOUBLE_BYTE_PAIR(0x2C, 0x002C)
+DOUBLE_BYTE_PAIR(0x2D, 0x002D)
+DOUBLE_BYTE_PAIR(0x2E, 0x002E)
+DOUBLE_BYTE_PAIR(0x2F, 0x002F)
+DOUBLE_BYTE_PAIR(0x30, 0x0030)
+DOUBLE_BYTE_PAIR(0x31, 0x0031)
+DOUBLE_BYTE_PAIR(0x32, 0x0032)
+DOUBLE_BYTE_PAIR(0x33, 0x0033)
+DOUBLE_BYTE_PAIR(0x34, 0x0034)
+DOUBLE_BYTE_PAIR(0x35, 0x0035)
+DOUBLE_BYTE_PAIR(0x36, 0x0036)
+DOUBLE_BYTE_PAIR(0x37, 0x0037)
+DOUBLE_BYTE_PAIR(0x38, 0x0038)
+DOUBLE_BYTE_PAIR(0x39, 0x0039)
+DOUBLE_BYTE_PAIR(0x3A, 0x003A)
+DOUBLE_BYTE_PAIR(0x3B, 0x003B)
+DOUBLE_BYTE_PAIR(0x3C, 0x003C)
+DOUBLE_BYTE_PAIR(0x3D, 0x003D)
+DOUBLE_BYTE_PAIR(0x3E, 0x003E)
+DOUBLE_BYTE_PAIR(0x3F, 0x003F)
+DOUBLE_BYTE_PAIR(0x40, 0x0040)
+DOUBLE_BYTE_PAIR(0x41, 0x0041)
+DOUBLE_BYTE_PAIR(0x42, 0x0042)
+DOUBLE_BYTE_PAIR(0x43, 0x0043)
+DOUBLE_BYTE_PAIR(0x44, 0x0044)
+DOUBLE_BYTE_PAIR(0x45, 0x0045)
+DOUBLE_BYTE_PAIR(0x46, 0x0046)
+DOUBLE_BYTE_PAIR(0x47, 0x0047)
+DOUBLE_BYTE_PAIR(0x48, 0x0048)
+DOUBLE_BYTE_PAIR(0x49, 0x0049)
+DOUBLE_BYTE_PAIR(0x4A, 0x004A)
+DOUBLE_BYTE_PAIR(0x4B, 0x004B)
+DOUBLE_BYTE_PAIR(0x4C, 0x004C)
+DOUBLE_BYTE_PAIR(0x4D, 0x004D)
+DOUBLE_BYTE_PAIR(0x4E, 0x004E)
+DOUBLE_BYTE_PAIR(0x4F, 0x004F)
+DOUBLE_BYTE_PAIR(0x50, 0x0050)
+DOUBLE_BYTE_PAIR(0x51, 0x0051)
+DOUBLE_BYTE_PAIR(0x52, 0x0052)
+DOUBLE_BYTE_PAIR(0x53, 0x0053)
+DOUBLE_BYTE_PAIR(0x54, 0x0054)
+DOUBLE_BYTE_PAIR(0x55, 0x0055)
+DOUBLE_BYTE_PAIR(0x56, 0x0056)
+DOUBLE_BYTE_PAIR(0x57, 0x0057)
+DOUBLE_BYTE_PAIR(0x58, 0x0058)
+DOUBLE_BYTE_PAIR(0x59, 0x0059)
+DOUBLE_BYTE_PAIR(0x5A, 0x005A)
+DOUBLE_BYTE_PAIR(0x5B, 0x005B)
+DOUBLE_BYTE_PAIR(0x5C, 0x005C)
+DOUBLE_BYTE_PAIR(0x5D, 0x005D)
+DOUBLE_BYTE_PAIR(0x5E, 0x005E)
+DOUBLE_BYTE_PAIR(0x5F, 0x005F)
+DOUBLE_BYTE_PAIR(0x60, 0x0060)
+DOUBLE_BYTE_PAIR(0x61, 0x0061)
+DOUBLE_BYTE_PAIR(0x62, 0x0062)
+DOUBLE_BYTE_PAIR(0x63, 0x0063)
+DOUBLE_BYTE_PAIR(0x64, 0x0064)
+DOUBLE_BYTE_PAIR(0x65, 0x0065)
+DOUBLE_BYTE_PAIR(0x66, 0x0066)
+DOUBLE_BYTE_PAIR(0x67, 0x0067)
+DOUBLE_BYTE_PAIR(0x68, 0x0068)
+DOUBLE_BYTE_PAIR(0x69, 0x0069)
+DOUBLE_BYTE_PAIR(0x6A, 0x006A)
+DOUBLE_BYTE_PAIR(0x6B, 0x006B)
+DOUBLE_BYTE_PAIR(0x6C, 0x006C)
+DOUBLE_BYTE_PAIR(0x6D, 0x006D)
+DOUBLE_BYTE_PAIR(0x6E, 0x006E)
+DOUBLE_BYTE_PAIR(0x6F, 0x006F)
+DOUBLE_BYTE_PAIR(0x70, 0x0070)
+DOUBLE_BYTE_PAIR(0x71, 0x0071)
+DOUBLE_BYTE_PAIR(0x72, 0x0072)
+DOUBLE_BYTE_PAIR(0x73, 0x0073)
+DOUBLE_BYTE_PAIR(0x74, 0x0074)
+DOUBLE_BYTE_PAIR(0x75, 0x0075)
+DOUBLE_BYTE_PAIR(0x76, 0x0076)
+DOUBLE_BYTE_PAIR(0x77, 0x0077)
+DOUBLE_BYTE_PAIR(0x78, 0x0078)
+DOUBLE_BYTE_PAIR(0x79, 0x0079)
+DOUBLE_BYTE_PAIR(0x7A, 0x007A)
+DOUBLE_BYTE_PAIR(0x7B, 0x007B)
+DOUBLE_BYTE_PAIR(0x7C, 0x007C)
+DOUBLE_BYTE_PAIR(0x7D, 0x007D)
+DOUBLE_BYTE_PAIR(0x7E, 0x007E)
+DOUBLE_BYTE_PAIR(0x7F, 0x007F)
+DOUBLE_BYTE_PAIR(0xA140, 0x3000)
+DOUBLE_BYTE_PAIR(0xA141, 0xFF0C)
+DOUBLE_BYTE_PAIR(0xA142, 0x3001)
+DOUBLE_BYTE_PAIR(0xA143, 0x3002)
+DOUBLE_BYTE_PAIR(0xA144, 0xFF0E)
+DOUBLE_BYTE_PAIR(0xA145, 0x2027)
+DOUBLE_BYTE_PAIR(0xA146, 0xFF1B)
+DOUBLE_BYTE_PAIR(0xA147, 0xFF1A)
+DOUBLE_BYTE_PAIR(0xA148, 0xFF1F)
+DOUBLE_BYTE_PAIR(0xA149, 0xFF01)
+DOUBLE_BYTE_PAIR(0xA14A, 0xFE30)
+DOUBLE_BYTE_PAIR(0xA14B, 0x2026)
+DOUBLE_BYTE_PAIR(0xA14C, 0x2025)
+DOUBLE_BYTE_PAIR(0xA14D, 0xFE50)
+DOUBLE_BYTE_PAIR(0xA14E, 0xFE51)
+DOUBLE_BYTE_PAIR(0xA14F, 0xFE52)
+DOUBLE_BYTE_PAIR(0xA150, 0x00B7)
+DOUBLE_BYTE_PAIR(0xA151, 0xFE54)
+DOUBLE_BYTE_PAIR(0xA152, 0xFE55)
+DOUBLE_BYTE_PAIR(0xA153, 0xFE56)
+DOUBLE_BYTE_PAIR(0xA154, 0xFE57)
+DOUBLE_BYTE_PAIR(0xA155, 0xFF5C)
+DOUBLE_BYTE_PAIR(0xA156, 0x2013)
+DOUBLE_BYTE_PAIR(0xA157, 0xFE31)
+DOUBLE_BYTE_PAIR(0xA158, 0x2014)
+DOUBLE_BYTE_PAIR(0xA159, 0xFE33)
+DOUBLE_BYTE_PAIR(0xA15A, 0x2574)
+DOUBLE_BYTE_PAIR(0xA15B, 0xFE34)
+DOUBLE_BYTE_PAIR(0xA15C, 0xFE4F)
+DOUBLE_BYTE_PAIR(0xA15D, 0xFF08)
+DOUBLE_BYTE_PAIR(0xA15E, 0xFF09)
+DOUBLE_BYTE_PAIR(0xA15F, 0xFE35)
+DOUBLE_BYTE_PAIR(0xA160, 0xFE36)
+DOUBLE_BYTE_PAIR(0xA161, 0xFF5B)
+DOUBLE_BYTE_PAIR(0xA162, 0xFF5D)
+DOUBLE_BYTE_PAIR(0xA163, 0xFE37)
+DOUBLE_BYTE_PAIR(0xA164, 0xFE38)
+DOUBLE_BYTE_PAIR(0xA165, 0x3014)
+DOUBLE_BYTE_PAIR(0xA166, 0x3015)
+DOUBLE_BYTE_PAIR(0xA167, 0xFE39)
+DOUBLE_BYTE_PAIR(0xA168, 0xFE3A)
+DOUBLE_BYTE_PAIR(0xA169, 0x3010)
+DOUBLE_BYTE_PAIR(0xA16A, 0x3011)
+DOUBLE_BYTE_PAIR(0xA16B, 0xFE3B)
+DOUBLE_BYTE_PAIR(0xA16C, 0xFE3C)
+DOUBLE_BYTE_PAIR(0xA16D, 0x300A)
+DOUBLE_BYTE_PAIR(0xA16E, 0x300B)
+DOUBLE_BYTE_PAIR(0xA16F, 0xFE3D)
+DOUBLE_BYTE_PAIR(0xA170, 0xFE3E)
+DOUBLE_BYTE_PAIR(0xA171, 0x3008)
+DOUBLE_BYTE_PAIR(0xA172, 0x3009)
+DOUBLE_BYTE_PAIR(0xA173, 0xFE3F)
+DOUBLE_BYTE_PAIR(0xA174, 0xFE40)
+DOUBLE_BYTE_PAIR(0xA175, 0x300C)
+DOUBLE_BYTE_PAIR(0xA176, 0x300D)
+DOUBLE_BYTE_PAIR(0xA177, 0xFE41)
+DOUBLE_BYTE_PAIR(0xA178, 0xFE42)
+DOUBLE_BYTE_PAIR(0xA179, 0x300E)
+DOUBLE_BYTE_PAIR(0xA17A, 0x300F)
+DOUBLE_BYTE_PAIR(0xA17B, 0xFE43)
+DOUBLE_BYTE_PAIR(0xA17C, 0xFE44)
+DOUBLE_BYTE_PAIR(0xA17D, 0xFE59)
+DOUBLE_BYTE_PAIR(0xA17E, 0xFE5A)
+DOUBLE_BYTE_PAIR(0xA1A1, 0xFE5B)
+DOUBLE_BYTE_PAIR(0xA1A2, 0xFE5C)
+DOUBLE_BYTE_PAIR(0xA1A3, 0xFE5D)
+DOUBLE_BYTE_PAIR(0xA1A4, 0xFE5E)
+DOUBLE_BYTE_PAIR(0xA1A5, 0x2018)
+DOUBLE_BYTE_PAIR(0xA1A6, 0x2019)
+DOUBLE_BYTE_PAIR(0xA1A7, 0x201C)
+DOUBLE_BYTE_PAIR(0xA1A8, 0x201D)
+DOUBLE_BYTE_PAIR(0xA1A9, 0x301D)
+DOUBLE_BYTE_PAIR(0xA1AA, 0x301E)
+DOUBLE_BYTE_PAIR(0xA1AB, 0x2035)
+DOUBLE_BYTE_PAIR(0xA1AC, 0x2032)
+DOUBLE_BYTE_PAIR(0xA1AD, 0xFF03)
+DOUBLE_BYTE_PAIR(0xA1AE, 0xFF06)
+DOUBLE_BYTE_PAIR(0xA1AF, 0xFF0A)
+DOUBLE_BYTE_PAIR(0xA1B0, 0x203B)
+DOUBLE_BYTE_PAIR(0xA1B1, 0x00A7)
+DOUBLE_BYTE_PAIR(0xA1B2, 0x3003)
+DOUBLE_BYTE_PAIR(0xA1B3, 0x25CB)
+DOUBLE_BYTE_PAIR(0xA1B4, 0x25CF)
+DOUBLE_BYTE_PAIR(0xA1B5, 0x25B3)
+DOUBLE_BYTE_PAIR(0xA1B6, 0x25B2)
+DOUBLE_BYTE_PAIR(0xA1B7, 0x25CE)
+DOUBLE_BYTE_PAIR(0xA1B8, 0x2606)
+DOUBLE_BYTE_PAIR(0xA1B9, 0x2605)
+DOUBLE_BYTE_PAIR(0xA1BA, 0x25C7)
+DOUBLE_BYTE_PAIR(0xA1BB, 0x25C6)
+DOUBLE_BYTE_PAIR(0xA1BC, 0x25A1)
+DOUBLE_BYTE_PAIR(0xA1BD, 0x25A0)
+DOUBLE_BYTE_PAIR(0xA1BE, 0x25BD)
+DOUBLE_BYTE_PAIR(0xA1BF, 0x25BC)
+DOUBLE_BYTE_PAIR(0xA1C0, 0x32A3)
+DOUBLE_BYTE_PAIR(0xA1C1, 0x2105)
+DOUBLE_BYTE_PAIR(0xA1C2, 0x00AF)
+DOUBLE_BYTE_PAIR(0xA1C3, 0xFFE3)
+DOUBLE_BYTE_PAIR(0xA1C4, 0xFF3F)
+DOUBLE_BYTE_PAIR(0xA1C5, 0x02CD)
+DOUBLE_BYTE_PAIR(0xA1C6, 0xFE49)
+DOUBLE_BYTE_PAIR(0xA1C7, 0xFE4A)
+DOUBLE_BYTE_PAIR(0xA1C8, 0xFE4D)
+DOUBLE_BYTE_PAIR(0xA1C9, 0xFE4E)
+DOUBLE_BYTE_PAIR(0xA1CA, 0xFE4B)
+DOUBLE_BYTE_PAIR(0xA1CB, 0xFE4C)
+DOUBLE_BYTE_PAIR(0xA1CC, 0xFE5F)
+DOUBLE_BYTE_PAIR(0xA1CD, 0xFE60)
+DOUBLE_BYTE_PAIR(0xA1CE, 0xFE61)
+DOUBLE_BYTE_PAIR(0xA1CF, 0xFF0B)
+DOUBLE_BYTE_PAIR(0xA1D0, 0xFF0D)
+DOUBLE_BYTE_PAIR(0xA1D1, 0x00D7)
+DOUBLE_BYTE_PAIR(0xA1D2, 0x00F7)
+DOUBLE_BYTE_PAIR(0xA1D3, 0x00B1)
+DOUBLE_BYTE_PAIR(0xA1D4, 0x221A)
+DOUBLE_BYTE_PAIR(0xA1D5, 0xFF1C)
+DOUBLE_BYTE_PAIR(0xA1D6, 0xFF1E)
+DOUBLE_BYTE_PAIR(0xA1D7, 0xFF1D)
+DOUBLE_BYTE_PAIR(0xA1D8, 0x2266)
+DOUBLE_BYTE_PAIR(0xA1D9, 0x2267)
+DOUBLE_BYTE_PAIR(0xA1DA, 0x2260)
+DOUBLE_BYTE_PAIR(0xA1DB, 0x221E)
+DOUBLE_BYTE_PAIR(0xA1DC, 0x2252)
+DOUBLE_BYTE_PAIR(0xA1DD, 0x2261)
+DOUBLE_BYTE_PAIR(0xA1DE, 0xFE62)
+DOUBLE_BYTE_PAIR(0xA1DF, 0xFE63)
+DOUBLE_BYTE_PAIR(0xA1E0, 0xFE64)
+DOUBLE_BYTE_PAIR(0xA1E1, 0xFE65)
+DOUBLE_BYTE_PAIR(0xA1E2, 0xFE66)
+DOUBLE_BYTE_PAIR(0xA1E3, 0xFF5E)
+DOUBLE_BYTE_PAIR(0xA1E4, 0x2229)
+DOUBLE_BYTE_PAIR(0xA1E5, 0x222A)
+DOUBLE_BYTE_PAIR(0xA1E6, 0x22A5)
+DOUBLE_BYTE_PAIR(0xA1E7, 0x2220)
+DOUBLE_BYTE_PAIR(0xA1E8, 0x221F)
+DOUBLE_BYTE_PAIR(0xA1E9, 0x22BF)
+DOUBLE_BYTE_PAIR(0xA1EA, 0x33D2)
+DOUBLE_BYTE_PAIR(0xA1EB, 0x33D1)
+DOUBLE_BYTE_PAIR(0xA1EC, 0x222B)
+DOUBLE_BYTE_PAIR(0xA1ED, 0x222E)
+DOUBLE_BYTE_PAIR(0xA1EE, 0x2235)
+DOUBLE_BYTE_PAIR(0xA1EF, 0x2234)
+DOUBLE_BYTE_PAIR(0xA1F0, 0x2640)
+DOUBLE_BYTE_PAIR(0xA1F1, 0x2642)
+DOUBLE_BYTE_PAIR(0xA1F2, 0x2295)
+DOUBLE_BYTE_PAIR(0xA1F3, 0x2299)
+DOUBLE_BYTE_PAIR(0xA1F4, 0x2191)
+DOUBLE_BYTE_PAIR(0xA1F5, 0x2193)
+DOUBLE_BYTE_PAIR(0xA1F6, 0x2190)
+DOUBLE_BYTE_PAIR(0xA1F7, 0x2192)
+DOUBLE_BYTE_PAIR(0xA1F8, 0x2196)
+DOUBLE_BYTE_PAIR(0xA1F9, 0x2197)
+DOUBLE_BYTE_PAIR(0xA1FA, 0x2199)
+DOUBLE_BYTE_PAIR(0xA1FB, 0x2198)
+DOUBLE_BYTE_PAIR(0xA1FC, 0x2225)
+DOUBLE_BYTE_PAIR(0xA1FD, 0x2223)
+DOUBLE_BYTE_PAIR(0xA1FE, 0xFF0F)
+DOUBLE_BYTE_PAIR(0xA240, 0xFF3C)
+DOUBLE_BYTE_PAIR(0xA241, 0x2215)
+DOUBLE_BYTE_PAIR(0xA242, 0xFE68)
+DOUBLE_BYTE_PAIR(0xA243, 0xFF04)
+DOUBLE_BYTE_PAIR(0xA244, 0xFFE5)
+DOUBLE_BYTE_PAIR(0xA245, 0x3012)
+DOUBLE_BYTE_PAIR(0xA246, 0xFFE0)
+DOUBLE_BYTE_PAIR(0xA247, 0xFFE1)
+DOUBLE_BYTE_PAIR(0xA248, 0xFF05)
+DOUBLE_BYTE_PAIR(0xA249, 0xFF20)
+DOUBLE_BYTE_PAIR(0xA24A, 0x2103)
+DOUBLE_BYTE_PAIR(0xA24B, 0x2109)
+DOUBLE_BYTE_PAIR(0xA24C, 0xFE69)
+DOUBLE_BYTE_PAIR(0xA24D, 0xFE6A)
+DOUBLE_BYTE_PAIR(0xA24E, 0xFE6B)
+DOUBLE_BYTE_PAIR(0xA24F, 0x33D5)
+DOUBLE_BYTE_PAIR(0xA250, 0x339C)
+DOUBLE_BYTE_PAIR(0xA251, 0x339D)
+DOUBLE_BYTE_PAIR(0xA252, 0x339E)
+DOUBLE_BYTE_PAIR(0xA253, 0x33CE)
+DOUBLE_BYTE_PAIR(0xA254, 0x33A1)
+DOUBLE_BYTE_PAIR(0xA255, 0x338E)
+DOUBLE_BYTE_PAIR(0xA256, 0x338F)
+DOUBLE_BYTE_PAIR(0xA257, 0x33C4)
+DOUBLE_BYTE_PAIR(0xA258, 0x00B0)
+DOUBLE_BYTE_PAIR(0xA259, 0x5159)
+DOUBLE_BYTE_PAIR(0xA25A, 0x515B)
+DOUBLE_BYTE_PAIR(0xA25B, 0x515E)
+DOUBLE_BYTE_PAIR(0xA25C, 0x515D)
+DOUBLE_BYTE_PAIR(0xA25D, 0x5161)
+DOUBLE_BYTE_PAIR(0xA25E, 0x5163)
+DOUBLE_BYTE_PAIR(0xA25F, 0x55E7)
+DOUBLE_BYTE_PAIR(0xA260, 0x74E9)
+DOUBLE_BYTE_PAIR(0xA261, 0x7CCE)
+DOUBLE_BYTE_PAIR(0xA262, 0x2581)
+DOUBLE_BYTE_PAIR(0xA263, 0x2582)
+DOUBLE_BYTE_PAIR(0xA264, 0x2583)
+DOUBLE_BYTE_PAIR(0xA265, 0x2584)
+DOUBLE_BYTE_PAIR(0xA266, 0x2585)
+DOUBLE_BYTE_PAIR(0xA267, 0x2586)
+DOUBLE_BYTE_PAIR(0xA268, 0x2587)
+DOUBLE_BYTE_PAIR(0xA269, 0x2588)
+DOUBLE_BYTE_PAIR(0xA26A, 0x258F)
+DOUBLE_BYTE_PAIR(0xA26B, 0x258E)
+DOUBLE_BYTE_PAIR(0xA26C, 0x258D)
+DOUBLE_BYTE_PAIR(0xA26D, 0x258C)
+DOUBLE_BYTE_PAIR(0xA26E, 0x258B)
+DOUBLE_BYTE_PAIR(0xA26F, 0x258A)
+DOUBLE_BYTE_PAIR(0xA270, 0x2589)
+DOUBLE_BYTE_PAIR(0xA271, 0x253C)
+DOUBLE_BYTE_PAIR(0xA272, 0x2534)
+DOUBLE_BYTE_PAIR(0xA273, 0x252C)
+DOUBLE_BYTE_PAIR(0xA274, 0x2524)
+DOUBLE_BYTE_PAIR(0xA275, 0x251C)
+DOUBLE_BYTE_PAIR(0xA276, 0x2594)
+DOUBLE_BYTE_PAIR(0xA277, 0x2500)
+DOUBLE_BYTE_PAIR(0xA278, 0x2502)
+DOUBLE_BYTE_PAIR(0xA279, 0x2595)
+DOUBLE_BYTE_PAIR(0xA27A, 0x250C)
+DOUBLE_BYTE_PAIR(0xA27B, 0x2510)
+DOUBLE_BYTE_PAIR(0xA27C, 0x2514)
+DOUBLE_BYTE_PAIR(0xA27D, 0x2518)
+DOUBLE_BYTE_PAIR(0xA27E, 0x256D)
+DOUBLE_BYTE_PAIR(0xA2A1, 0x256E)
+DOUBLE_BYTE_PAIR(0xA2A2, 0x2570)
+DOUBLE_BYTE_PAIR(0xA2A3, 0x256F)
+DOUBLE_BYTE_PAIR(0xA2A4, 0x2550)
+DOUBLE_BYTE_PAIR(0xA2A5, 0x255E)
+DOUBLE_BYTE_PAIR(0xA2A6, 0x256A)
+DOUBLE_BYTE_PAIR(0xA2A7, 0x2561)
+DOUBLE_BYTE_PAIR(0xA2A8, 0x25E2)
+DOUBLE_BYTE_PAIR(0xA2A9, 0x25E3)
+DOUBLE_BYTE_PAIR(0xA2AA, 0x25E5)
+DOUBLE_BYTE_PAIR(0xA2AB, 0x25E4)
+DOUBLE_BYTE_PAIR(0xA2AC, 0x2571)
+DOUBLE_BYTE_PAIR(0xA2AD, 0x2572)
+DOUBLE_BYTE_PAIR(0xA2AE, 0x2573)
+DOUBLE_BYTE_PAIR(0xA2AF, 0xFF10)
+DOUBLE_BYTE_PAIR(0xA2B0, 0xFF11)
+DOUBLE_BYTE_PAIR(0xA2B1, 0xFF12)
+DOUBLE_BYTE_PAIR(0xA2B2, 0xFF13)
+DOUBLE_BYTE_PAIR(0xA2B3, 0xFF14)
+DOUBLE_BYTE_PAIR(0xA2B4, 0xFF15)
+DOUBLE_BYTE_PAIR(0xA2B5, 0xFF16)
+DOUBLE_BYTE_PAIR(0xA2B6, 0xFF17)
+DOUBLE_BYTE_PAIR(0xA2B7, 0xFF18)
+DOUBLE_BYTE_PAIR(0xA2B8, 0xFF19)
+DOUBLE_BYTE_PAIR(0xA2B9, 0x2160)
+DOUBLE_BYTE_PAIR(0xA2BA, 0x2161)
+DOUBLE_BYTE_PAIR(0xA2BB, 0x2162)
+DOUBLE_BYTE_PAIR(0xA2BC, 0x2163)
+DOUBLE_BYTE_PAIR(0xA2BD, 0x2164)
+DOUBLE_BYTE_PAIR(0xA2BE, 0x2165)
+DOUBLE_BYTE_PAIR(0xA2BF, 0x2166)
+DOUBLE_BYTE_PAIR(0xA2C0, 0x2167)
+DOUBLE_BYTE_PAIR(0xA2C1, 0x2168)
+DOUBLE_BYTE_PAIR(0xA2C2, 0x2169)
+DOUBLE_BYTE_PAIR(0xA2C3, 0x3021)
+DOUBLE_BYTE_PAIR(0xA2C4, 0x3022)
+DOUBLE_BYTE_PAIR(0xA2C5, 0x3023)
+DOUBLE_BYTE_PAIR(0xA2C6, 0x3024)
+DOUBLE_BYTE_PAIR(0xA2C7, 0x3025)
+DOUBLE_BYTE_PAIR(0xA2C8, 0x3026)
+DOUBLE_BYTE_PAIR(0xA2C9, 0x3027)
+DOUBLE_BYTE_PAIR(0xA2CA, 0x3028)
+DOUBLE_BYTE_PAIR(0xA2CB, 0x3029)
+DOUBLE_BYTE_PAIR(0xA2CC, 0x5341)
+DOUBLE_BYTE_PAIR(0xA2CD, 0x5344)
+DOUBLE_BYTE_PAIR(0xA2CE, 0x5345)
+DOUBLE_BYTE_PAIR(0xA2CF, 0xFF21)
+DOUBLE_BYTE_PAIR(0xA2D0, 0xFF22)
+DOUBLE_BYTE_PAIR(0xA2D1, 0xFF23)
+DOUBLE_BYTE_PAIR(0xA2D2, 0xFF24)
+DOUBLE_BYTE_PAIR(0xA2D3, 0xFF25)
+DOUBLE_BYTE_PAIR(0xA2D4, 0xFF26)
+DOUBLE_BYTE_PAIR(0xA2D5, 0xFF27)
+DOUBLE_BYTE_PAIR(0xA2D6, 0xFF28)
+DOUBLE_BYTE_PAIR(0xA2D7, 0xFF29)
+DOUBLE_BYTE_PAIR(0xA2D8, 0xFF2A)
+DOUBLE_BYTE_PAIR(0xA2D9, 0xFF2B)
+DOUBLE_BYTE_PAIR(0xA2DA, 0xFF2C)
+DOUBLE_BYTE_PAIR(0xA2DB, 0xFF2D)
+DOUBLE_BYTE_PAIR(0xA2DC, 0xFF2E)
+DOUBLE_BYTE_PAIR(0xA2DD, 0xFF2F)
+DOUBLE_BYTE_PAIR(0xA2DE, 0xFF30)
+DOUBLE_BYTE_PAIR(0xA2DF, 0xFF31)
+DOUBLE_BYTE_PAIR(0xA2E0, 0xFF32)
+DOUBLE_BYTE_PAIR(0xA2E1, 0xFF33)
+DOUBLE_BYTE_PAIR(0xA2E2, 0xFF34)
+DOUBLE_BYTE_PAIR(0xA2E3, 0xFF35)
+DOUBLE_BYTE_PAIR(0xA2E4, 0xFF36)
+DOUBLE_BYTE_PAIR(0xA2E5, 0xFF37)
+DOUBLE_BYTE_PAIR(0xA2E6, 0xFF38)
+DOUBLE_BYTE_PAIR(0xA2E7, 0xFF39)
+DOUBLE_BYTE_PAIR(0xA2E8, 0xFF3A)
+DOUBLE_BYTE_PAIR(0xA2E9, 0xFF41)
+DOUBLE_BYTE_PAIR(0xA2EA, 0xFF42)
+DOUBLE_BYTE_PAIR(0xA2EB, 0xFF43)
+DOUBLE_BYTE_PAIR(0xA2EC, 0xFF44)
+DOUBLE_BYTE_PAIR(0xA2ED, 0xFF45)
+DOUBLE_BYTE_PAIR(0xA2EE, 0xFF46)
+DOUBLE_BYTE_PAIR(0xA2EF, 0xFF47)
+DOUBLE_BYTE_PAIR(0xA2F0, 0xFF48)
+DOUBLE_BYTE_PAIR(0xA2F1, 0xFF49)
+DOUBLE_BYTE_PAIR(0xA2F2, 0xFF4A)
+DOUBLE_BYTE_PAIR(0xA2F3, 0xFF4B)
+DOUBLE_BYTE_PAIR(0xA2F4, 0xFF4C)
+DOUBLE_BYTE_PAIR(0xA2F5, 0xFF4D)
+DOUBLE_BYTE_PAIR(0xA2F6, 0xFF4E)
+DOUBLE_BYTE_PAIR(0xA2F7, 0xFF4F)
+DOUBLE_BYTE_PAIR(0xA2F8, 0xFF50)
+DOUBLE_BYTE_PAIR(0xA2F9, 0xFF51)
+DOUBLE_BYTE_PAIR(0xA2FA, 0xFF52)
+DOUBLE_BYTE_PAIR(0xA2FB, 0xFF53)
+DOUBLE_BYTE_PAIR(0xA2FC, 0xFF54)
+DOUBLE_BYTE_PAIR(0xA2FD, 0xFF55)
+DOUBLE_BYTE_PAIR(0xA2FE, 0xFF56)
+DOUBLE_BYTE_PAIR(0xA340, 0xFF57)
+DOUBLE_BYTE_PAIR(0xA341, 0xFF58)
+DOUBLE_BYTE_PAIR(0xA342, 0xFF59)
+DOUBLE_BYTE_PAIR(0xA343, 0xFF5A)
+DOUBLE_BYTE_PAIR(0xA344, 0x0391)
+DOUBLE_BYTE_PAIR(0xA345, 0x0392)
+DOUBLE_BYTE_PAIR(0xA346, 0x0393)
+DOUBLE_BYTE_PAIR(0xA347, 0x0394)
+DOUBLE_BYTE_PAIR(0xA348, 0x0395)
+DOUBLE_BYTE_PAIR(0xA349, 0x0396)
+DOUBLE_BYTE_PAIR(0xA34A, 0x0397)
+DOUBLE_BYTE_PAIR(0xA34B, 0x0398)
+DOUBLE_BYTE_PAIR(0xA34C, 0x0399)
+DOUBLE_BYTE_PAIR(0xA34D, 0x039A)
+DOUBLE_BYTE_PAIR(0xA34E, 0x039B)
+DOUBLE_BYTE_PAIR(0xA34F, 0x039C)
+DOUBLE_BYTE_PAIR(0xA350, 0x039D)
+DOUBLE_BYTE_PAIR(0xA351, 0x039E)
+DOUBLE_BYTE_PAIR(0xA352, 0x039F)
+DOUBLE_BYTE_PAIR(0xA353, 0x03A0)
+DOUBLE_BYTE_PAIR(0xA354, 0x03A1)
+DOUBLE_BYTE_PAIR(0xA355, 0x03A3)
+DOUBLE_BYTE_PAIR(0xA356, 0x03A4)
+DOUBLE_BYTE_PAIR(0xA357, 0x03A5)
+DOUBLE_BYTE_PAIR(0xA358, 0x03A6)
+DOUBLE_BYTE_PAIR(0xA359, 0x03A7)
+DOUBLE_BYTE_PAIR(0xA35A, 0x03A8)
+DOUBLE_BYTE_PAIR(0xA35B, 0x03A9)
+DOUBLE_BYTE_PAIR(0xA35C, 0x03B1)
+DOUBLE_BYTE_PAIR(0xA35D, 0x03B2)
+DOUBLE_BYTE_PAIR(0xA35E, 0x03B3)
+DOUBLE_BYTE_PAIR(0xA35F, 0x03B4)
+DOUBLE_BYTE_PAIR(0xA360, 0x03B5)
+DOUBLE_BYTE_PAIR(0xA361, 0x03B6)
+DOUBLE_BYTE_PAIR(0xA362, 0x03B7)
+DOUBLE_BYTE_PAIR(0xA363, 0x03B8)
+DOUBLE_BYTE_PAIR(0xA364, 0x03B9)
+DOUBLE_BYTE_PAIR(0xA365, 0x03BA)
+DOUBLE_BYTE_PAIR(0xA366, 0x03BB)
+DOUBLE_BYTE_PAIR(0xA367, 0x03BC)
+DOUBLE_BYTE_PAIR(0xA368, 0x03BD)
+DOUBLE_BYTE_PAIR(0xA369, 0x03BE)
+DOUBLE_BYTE_PAIR(0xA36A, 0x03BF)
+DOUBLE_BYTE_PAIR(0xA36B, 0x03C0)
+DOUBLE_BYTE_PAIR(0xA36C, 0x03C1)
+DOUBLE_BYTE_PAIR(0xA36D, 0x03C3)
+DOUBLE_BYTE_PAIR(0xA36E, 0x03C4)
+DOUBLE_BYTE_PAIR(0xA36F, 0x03C5)
+DOUBLE_BYTE_PAIR(0xA370, 0x03C6)
+DOUBLE_BYTE_PAIR(0xA371, 0x03C7)
+DOUBLE_BYTE_PAIR(0xA372, 0x03C8)
+DOUBLE_BYTE_PAIR(0xA373, 0x03C9)
+DOUBLE_BYTE_PAIR(0xA374, 0x3105)
+DOUBLE_BYTE_PAIR(0xA375, 0x3106)
+DOUBLE_BYTE_PAIR(0xA376, 0x3107)
+DOUBLE_BYTE_PAIR(0xA377, 0x3108)
+DOUBLE_BYTE_PAIR(0xA378, 0x3109)
+DOUBLE_BYTE_PAIR(0xA379, 0x310A)
+DOUBLE_BYTE_PAIR(0xA37A, 0x310B)
+DOUBLE_BYTE_PAIR(0xA37B, 0x310C)
+DOUBLE_BYTE_PAIR(0xA37C, 0x310D)
+DOUBLE_BYTE_PAIR(0xA37D, 0x310E)
+DOUBLE_BYTE_PAIR(0xA37E, 0x310F)
+DOUBLE_BYTE_PAIR(0xA3A1, 0x3110)
+DOUBLE_BYTE_PAIR(0xA3A2, 0x3111)
+DOUBLE_BYTE_PAIR(0xA3A3, 0x3112)
+DOUBLE_BYTE_PAIR(0xA3A4, 0x3113)
+DOUBLE_BYTE_PAIR(0xA3A5, 0x3114)
+DOUBLE_BYTE_PAIR(0xA3A6, 0x3115)
+DOUBLE_BYTE_PAIR(0xA3A7, 0x3116)
+DOUBLE_BYTE_PAIR(0xA3A8, 0x3117)
+DOUBLE_BYTE_PAIR(0xA3A9, 0x3118)
+DOUBLE_BYTE_PAIR(0xA3AA, 0x3119)
+DOUBLE_BYTE_PAIR(0xA3AB, 0x311A)
+DOUBLE_BYTE_PAIR(0xA3AC, 0x311B)
+DOUBLE_BYTE_PAIR(0xA3AD, 0x311C)
+DOUBLE_BYTE_PAIR(0xA3AE, 0x311D)
+DOUBLE_BYTE_PAIR(0xA3AF, 0x311E)
+DOUBLE_BYTE_PAIR(0xA3B0, 0x311F)
+DOUBLE_BYTE_PAIR(0xA3B1, 0x3120)
+DOUBLE_BYTE_PAIR(0xA3B2, 0x3121)
+DOUBLE_BYTE_PAIR(0xA3B3, 0x3122)
+DOUBLE_BYTE_PAIR(0xA3B4, 0x3123)
+DOUBLE_BYTE_PAIR(0xA3B5, 0x3124)
+DOUBLE_BYTE_PAIR(0xA3B6, 0x3125)
+DOUBLE_BYTE_PAIR(0xA3B7, 0x3126)
+DOUBLE_BYTE_PAIR(0xA3B8, 0x3127)
+DOUBLE_BYTE_PAIR(0xA3B9, 0x3128)
+DOUBLE_BYTE_PAIR(0xA3BA, 0x3129)
+DOUBLE_BYTE_PAIR(0xA3BB, 0x02D9)
+DOUBLE_BYTE_PAIR(0xA3BC, 0x02C9)
+DOUBLE_BYTE_PAIR(0xA3BD, 0x02CA)
+DOUBLE_BYTE_PAIR(0xA3BE, 0x02C7)
+DOUBLE_BYTE_PAIR(0xA3BF, 0x02CB)
+DOUBLE_BYTE_PAIR(0xA3E1, 0x20AC)
+DOUBLE_BYTE_PAIR(0xA440, 0x4E00)
+DOUBLE_BYTE_PAIR(0xA441, 0x4E59)
+DOUBLE_BYTE_PAIR(0xA442, 0x4E01)
+DOUBLE_BYTE_PAIR(0xA443, 0x4E03)
+DOUBLE_BYTE_PAIR(0xA444, 0x4E43)
+DOUBLE_BYTE_PAIR(0xA445, 0x4E5D)
+DOUBLE_BYTE_PAIR(0xA446, 0x4E86)
+DOUBLE_BYTE_PAIR(0xA447, 0x4E8C)
+DOUBLE_BYTE_PAIR(0xA448, 0x4EBA)
+DOUBLE_BYTE_PAIR(0xA449, 0x513F)
+DOUBLE_BYTE_PAIR(0xA44A, 0x5165)
+DOUBLE_BYTE_PAIR(0xA44B, 0x516B)
+DOUBLE_BYTE_PAIR(0xA44C, 0x51E0)
+DOUBLE_BYTE_PAIR(0xA44D, 0x5200)
+DOUBLE_BYTE_PAIR(0xA44E, 0x5201)
+DOUBLE_BYTE_PAIR(0xA44F, 0x529B)
+DOUBLE_BYTE_PAIR(0xA450, 0x5315)
+DOUBLE_BYTE_PAIR(0xA451, 0x5341)
+DOUBLE_BYTE_PAIR(0xA452, 0x535C)
+DOUBLE_BYTE_PAIR(0xA453, 0x53C8)
+DOUBLE_BYTE_PAIR(0xA454, 0x4E09)
+DOUBLE_BYTE_PAIR(0xA455, 0x4E0B)
+DOUBLE_BYTE_PAIR(0xA456, 0x4E08)
+DOUBLE_BYTE_PAIR(0xA457, 0x4E0A)
+DOUBLE_BYTE_PAIR(0xA458, 0x4E2B)
+DOUBLE_BYTE_PAIR(0xA459, 0x4E38)
+DOUBLE_BYTE_PAIR(0xA45A, 0x51E1)
+DOUBLE_BYTE_PAIR(0xA45B, 0x4E45)
+DOUBLE_BYTE_PAIR(0xA45C, 0x4E48)
+DOUBLE_BYTE_PAIR(0xA45D, 0x4E5F)
+DOUBLE_BYTE_PAIR(0xA45E, 0x4E5E)
+DOUBLE_BYTE_PAIR(0xA45F, 0x4E8E)
+DOUBLE_BYTE_PAIR(0xA460, 0x4EA1)
+DOUBLE_BYTE_PAIR(0xA461, 0x5140)
+DOUBLE_BYTE_PAIR(0xA462, 0x5203)
+DOUBLE_BYTE_PAIR(0xA463, 0x52FA)
+DOUBLE_BYTE_PAIR(0xA464, 0x5343)
+DOUBLE_BYTE_PAIR(0xA465, 0x53C9)
+DOUBLE_BYTE_PAIR(0xA466, 0x53E3)
+DOUBLE_BYTE_PAIR(0xA467, 0x571F)
+DOUBLE_BYTE_PAIR(0xA468, 0x58EB)
+DOUBLE_BYTE_PAIR(0xA469, 0x5915)
+DOUBLE_BYTE_PAIR(0xA46A, 0x5927)
+DOUBLE_BYTE_PAIR(0xA46B, 0x5973)
+DOUBLE_BYTE_PAIR(0xA46C, 0x5B50)
+DOUBLE_BYTE_PAIR(0xA46D, 0x5B51)
+DOUBLE_BYTE_PAIR(0xA46E, 0x5B53)
+DOUBLE_BYTE_PAIR(0xA46F, 0x5BF8)
+DOUBLE_BYTE_PAIR(0xA470, 0x5C0F)
+DOUBLE_BYTE_PAIR(0xA471, 0x5C22)
+DOUBLE_BYTE_PAIR(0xA472, 0x5C38)
+DOUBLE_BYTE_PAIR(0xA473, 0x5C71)
+DOUBLE_BYTE_PAIR(0xA474, 0x5DDD)
+DOUBLE_BYTE_PAIR(0xA475, 0x5DE5)
+DOUBLE_BYTE_PAIR(0xA476, 0x5DF1)
+DOUBLE_BYTE_PAIR(0xA477, 0x5DF2)
+DOUBLE_BYTE_PAIR(0xA478, 0x5DF3)
+DOUBLE_BYTE_PAIR(0xA479, 0x5DFE)
+DOUBLE_BYTE_PAIR(0xA47A, 0x5E72)
+DOUBLE_BYTE_PAIR(0xA47B, 0x5EFE)
+DOUBLE_BYTE_PAIR(0xA47C, 0x5F0B)
+DOUBLE_BYTE_PAIR(0xA47D, 0x5F13)
+DOUBLE_BYTE_PAIR(0xA47E, 0x624D)
+DOUBLE_BYTE_PAIR(0xA4A1, 0x4E11)
+DOUBLE_BYTE_PAIR(0xA4A2, 0x4E10)
+DOUBLE_BYTE_PAIR(0xA4A3, 0x4E0D)
+DOUBLE_BYTE_PAIR(0xA4A4, 0x4E2D)
+DOUBLE_BYTE_PAIR(0xA4A5, 0x4E30)
+DOUBLE_BYTE_PAIR(0xA4A6, 0x4E39)
+DOUBLE_BYTE_PAIR(0xA4A7, 0x4E4B)
+DOUBLE_BYTE_PAIR(0xA4A8, 0x5C39)
+DOUBLE_BYTE_PAIR(0xA4A9, 0x4E88)
+DOUBLE_BYTE_PAIR(0xA4AA, 0x4E91)
+DOUBLE_BYTE_PAIR(0xA4AB, 0x4E95)
+DOUBLE_BYTE_PAIR(0xA4AC, 0x4E92)
+DOUBLE_BYTE_PAIR(0xA4AD, 0x4E94)
+DOUBLE_BYTE_PAIR(0xA4AE, 0x4EA2)
+DOUBLE_BYTE_PAIR(0xA4AF, 0x4EC1)
+DOUBLE_BYTE_PAIR(0xA4B0, 0x4EC0)
+DOUBLE_BYTE_PAIR(0xA4B1, 0x4EC3)
+DOUBLE_BYTE_PAIR(0xA4B2, 0x4EC6)
+DOUBLE_BYTE_PAIR(0xA4B3, 0x4EC7)
+DOUBLE_BYTE_PAIR(0xA4B4, 0x4ECD)
+DOUBLE_BYTE_PAIR(0xA4B5, 0x4ECA)
+DOUBLE_BYTE_PAIR(0xA4B6, 0x4ECB)
+DOUBLE_BYTE_PAIR(0xA4B7, 0x4EC4)
+DOUBLE_BYTE_PAIR(0xA4B8, 0x5143)
+DOUBLE_BYTE_PAIR(0xA4B9, 0x5141)
+DOUBLE_BYTE_PAIR(0xA4BA, 0x5167)
+DOUBLE_BYTE_PAIR(0xA4BB, 0x516D)
+DOUBLE_BYTE_PAIR(0xA4BC, 0x516E)
+DOUBLE_BYTE_PAIR(0xA4BD, 0x516C)
+DOUBLE_BYTE_PAIR(0xA4BE, 0x5197)
+DOUBLE_BYTE_PAIR(0xA4BF, 0x51F6)
+DOUBLE_BYTE_PAIR(0xA4C0, 0x5206)
+DOUBLE_BYTE_PAIR(0xA4C1, 0x5207)
+DOUBLE_BYTE_PAIR(0xA4C2, 0x5208)
+DOUBLE_BYTE_PAIR(0xA4C3, 0x52FB)
+DOUBLE_BYTE_PAIR(0xA4C4, 0x52FE)
+DOUBLE_BYTE_PAIR(0xA4C5, 0x52FF)
+DOUBLE_BYTE_PAIR(0xA4C6, 0x5316)
+DOUBLE_BYTE_PAIR(0xA4C7, 0x5339)
+DOUBLE_BYTE_PAIR(0xA4C8, 0x5348)
+DOUBLE_BYTE_PAIR(0xA4C9, 0x5347)
+DOUBLE_BYTE_PAIR(0xA4CA, 0x5345)
+DOUBLE_BYTE_PAIR(0xA4CB, 0x535E)
+DOUBLE_BYTE_PAIR(0xA4CC, 0x5384)
+DOUBLE_BYTE_PAIR(0xA4CD, 0x53CB)
+DOUBLE_BYTE_PAIR(0xA4CE, 0x53CA)
+DOUBLE_BYTE_PAIR(0xA4CF, 0x53CD)
+DOUBLE_BYTE_PAIR(0xA4D0, 0x58EC)
+DOUBLE_BYTE_PAIR(0xA4D1, 0x5929)
+DOUBLE_BYTE_PAIR(0xA4D2, 0x592B)
+DOUBLE_BYTE_PAIR(0xA4D3, 0x592A)
+DOUBLE_BYTE_PAIR(0xA4D4, 0x592D)
+DOUBLE_BYTE_PAIR(0xA4D5, 0x5B54)
+DOUBLE_BYTE_PAIR(0xA4D6, 0x5C11)
+DOUBLE_BYTE_PAIR(0xA4D7, 0x5C24)
+DOUBLE_BYTE_PAIR(0xA4D8, 0x5C3A)
+DOUBLE_BYTE_PAIR(0xA4D9, 0x5C6F)
+DOUBLE_BYTE_PAIR(0xA4DA, 0x5DF4)
+DOUBLE_BYTE_PAIR(0xA4DB, 0x5E7B)
+DOUBLE_BYTE_PAIR(0xA4DC, 0x5EFF)
+DOUBLE_BYTE_PAIR(0xA4DD, 0x5F14)
+DOUBLE_BYTE_PAIR(0xA4DE, 0x5F15)
+DOUBLE_BYTE_PAIR(0xA4DF, 0x5FC3)
+DOUBLE_BYTE_PAIR(0xA4E0, 0x6208)
+DOUBLE_BYTE_PAIR(0xA4E1, 0x6236)
+DOUBLE_BYTE_PAIR(0xA4E2, 0x624B)
+DOUBLE_BYTE_PAIR(0xA4E3, 0x624E)
+DOUBLE_BYTE_PAIR(0xA4E4, 0x652F)
+DOUBLE_BYTE_PAIR(0xA4E5, 0x6587)
+DOUBLE_BYTE_PAIR(0xA4E6, 0x6597)
+DOUBLE_BYTE_PAIR(0xA4E7, 0x65A4)
+DOUBLE_BYTE_PAIR(0xA4E8, 0x65B9)
+DOUBLE_BYTE_PAIR(0xA4E9, 0x65E5)
+DOUBLE_BYTE_PAIR(0xA4EA, 0x66F0)
+DOUBLE_BYTE_PAIR(0xA4EB, 0x6708)
+DOUBLE_BYTE_PAIR(0xA4EC, 0x6728)
+DOUBLE_BYTE_PAIR(0xA4ED, 0x6B20)
+DOUBLE_BYTE_PAIR(0xA4EE, 0x6B62)
+DOUBLE_BYTE_PAIR(0xA4EF, 0x6B79)
+DOUBLE_BYTE_PAIR(0xA4F0, 0x6BCB)
+DOUBLE_BYTE_PAIR(0xA4F1, 0x6BD4)
+DOUBLE_BYTE_PAIR(0xA4F2, 0x6BDB)
+DOUBLE_BYTE_PAIR(0xA4F3, 0x6C0F)
+DOUBLE_BYTE_PAIR(0xA4F4, 0x6C34)
+DOUBLE_BYTE_PAIR(0xA4F5, 0x706B)
+DOUBLE_BYTE_PAIR(0xA4F6, 0x722A)
+DOUBLE_BYTE_PAIR(0xA4F7, 0x7236)
+DOUBLE_BYTE_PAIR(0xA4F8, 0x723B)
+DOUBLE_BYTE_PAIR(0xA4F9, 0x7247)
+DOUBLE_BYTE_PAIR(0xA4FA, 0x7259)
+DOUBLE_BYTE_PAIR(0xA4FB, 0x725B)
+DOUBLE_BYTE_PAIR(0xA4FC, 0x72AC)
+DOUBLE_BYTE_PAIR(0xA4FD, 0x738B)
+DOUBLE_BYTE_PAIR(0xA4FE, 0x4E19)
+DOUBLE_BYTE_PAIR(0xA540, 0x4E16)
+DOUBLE_BYTE_PAIR(0xA541, 0x4E15)
+DOUBLE_BYTE_PAIR(0xA542, 0x4E14)
+DOUBLE_BYTE_PAIR(0xA543, 0x4E18)
+DOUBLE_BYTE_PAIR(0xA544, 0x4E3B)
+DOUBLE_BYTE_PAIR(0xA545, 0x4E4D)
+DOUBLE_BYTE_PAIR(0xA546, 0x4E4F)
+DOUBLE_BYTE_PAIR(0xA547, 0x4E4E)
+DOUBLE_BYTE_PAIR(0xA548, 0x4EE5)
+DOUBLE_BYTE_PAIR(0xA549, 0x4ED8)
+DOUBLE_BYTE_PAIR(0xA54A, 0x4ED4)
+DOUBLE_BYTE_PAIR(0xA54B, 0x4ED5)
+DOUBLE_BYTE_PAIR(0xA54C, 0x4ED6)
+DOUBLE_BYTE_PAIR(0xA54D, 0x4ED7)
+DOUBLE_BYTE_PAIR(0xA54E, 0x4EE3)
+DOUBLE_BYTE_PAIR(0xA54F, 0x4EE4)
+DOUBLE_BYTE_PAIR(0xA550, 0x4ED9)
+DOUBLE_BYTE_PAIR(0xA551, 0x4EDE)
+DOUBLE_BYTE_PAIR(0xA552, 0x5145)
+DOUBLE_BYTE_PAIR(0xA553, 0x5144)
+DOUBLE_BYTE_PAIR(0xA554, 0x5189)
+DOUBLE_BYTE_PAIR(0xA555, 0x518A)
+DOUBLE_BYTE_PAIR(0xA556, 0x51AC)
+DOUBLE_BYTE_PAIR(0xA557, 0x51F9)
+DOUBLE_BYTE_PAIR(0xA558, 0x51FA)
+DOUBLE_BYTE_PAIR(0xA559, 0x51F8)
+DOUBLE_BYTE_PAIR(0xA55A, 0x520A)
+DOUBLE_BYTE_PAIR(0xA55B, 0x52A0)
+DOUBLE_BYTE_PAIR(0xA55C, 0x529F)
+DOUBLE_BYTE_PAIR(0xA55D, 0x5305)
+DOUBLE_BYTE_PAIR(0xA55E, 0x5306)
+DOUBLE_BYTE_PAIR(0xA55F, 0x5317)
+DOUBLE_BYTE_PAIR(0xA560, 0x531D)
+DOUBLE_BYTE_PAIR(0xA561, 0x4EDF)
+DOUBLE_BYTE_PAIR(0xA562, 0x534A)
+DOUBLE_BYTE_PAIR(0xA563, 0x5349)
+DOUBLE_BYTE_PAIR(0xA564, 0x5361)
+DOUBLE_BYTE_PAIR(0xA565, 0x5360)
+DOUBLE_BYTE_PAIR(0xA566, 0x536F)
+DOUBLE_BYTE_PAIR(0xA567, 0x536E)
+DOUBLE_BYTE_PAIR(0xA568, 0x53BB)
+DOUBLE_BYTE_PAIR(0xA569, 0x53EF)
+DOUBLE_BYTE_PAIR(0xA56A, 0x53E4)
+DOUBLE_BYTE_PAIR(0xA56B, 0x53F3)
+DOUBLE_BYTE_PAIR(0xA56C, 0x53EC)
+DOUBLE_BYTE_PAIR(0xA56D, 0x53EE)
+DOUBLE_BYTE_PAIR(0xA56E, 0x53E9)
+DOUBLE_BYTE_PAIR(0xA56F, 0x53E8)
+DOUBLE_BYTE_PAIR(0xA570, 0x53FC)
+DOUBLE_BYTE_PAIR(0xA571, 0x53F8)
+DOUBLE_BYTE_PAIR(0xA572, 0x53F5)
+DOUBLE_BYTE_PAIR(0xA573, 0x53EB)
+DOUBLE_BYTE_PAIR(0xA574, 0x53E6)
+DOUBLE_BYTE_PAIR(0xA575, 0x53EA)
+DOUBLE_BYTE_PAIR(0xA576, 0x53F2)
+DOUBLE_BYTE_PAIR(0xA577, 0x53F1)
+DOUBLE_BYTE_PAIR(0xA578, 0x53F0)
+DOUBLE_BYTE_PAIR(0xA579, 0x53E5)
+DOUBLE_BYTE_PAIR(0xA57A, 0x53ED)
+DOUBLE_BYTE_PAIR(0xA57B, 0x53FB)
+DOUBLE_BYTE_PAIR(0xA57C, 0x56DB)
+DOUBLE_BYTE_PAIR(0xA57D, 0x56DA)
+DOUBLE_BYTE_PAIR(0xA57E, 0x5916)
+DOUBLE_BYTE_PAIR(0xA5A1, 0x592E)
+DOUBLE_BYTE_PAIR(0xA5A2, 0x5931)
+DOUBLE_BYTE_PAIR(0xA5A3, 0x5974)
+DOUBLE_BYTE_PAIR(0xA5A4, 0x5976)
+DOUBLE_BYTE_PAIR(0xA5A5, 0x5B55)
+DOUBLE_BYTE_PAIR(0xA5A6, 0x5B83)
+DOUBLE_BYTE_PAIR(0xA5A7, 0x5C3C)
+DOUBLE_BYTE_PAIR(0xA5A8, 0x5DE8)
+DOUBLE_BYTE_PAIR(0xA5A9, 0x5DE7)
+DOUBLE_BYTE_PAIR(0xA5AA, 0x5DE6)
+DOUBLE_BYTE_PAIR(0xA5AB, 0x5E02)
+DOUBLE_BYTE_PAIR(0xA5AC, 0x5E03)
+DOUBLE_BYTE_PAIR(0xA5AD, 0x5E73)
+DOUBLE_BYTE_PAIR(0xA5AE, 0x5E7C)
+DOUBLE_BYTE_PAIR(0xA5AF, 0x5F01)
+DOUBLE_BYTE_PAIR(0xA5B0, 0x5F18)
+DOUBLE_BYTE_PAIR(0xA5B1, 0x5F17)
+DOUBLE_BYTE_PAIR(0xA5B2, 0x5FC5)
+DOUBLE_BYTE_PAIR(0xA5B3, 0x620A)
+DOUBLE_BYTE_PAIR(0xA5B4, 0x6253)
+DOUBLE_BYTE_PAIR(0xA5B5, 0x6254)
+DOUBLE_BYTE_PAIR(0xA5B6, 0x6252)
+DOUBLE_BYTE_PAIR(0xA5B7, 0x6251)
+DOUBLE_BYTE_PAIR(0xA5B8, 0x65A5)
+DOUBLE_BYTE_PAIR(0xA5B9, 0x65E6)
+DOUBLE_BYTE_PAIR(0xA5BA, 0x672E)
+DOUBLE_BYTE_PAIR(0xA5BB, 0x672C)
+DOUBLE_BYTE_PAIR(0xA5BC, 0x672A)
+DOUBLE_BYTE_PAIR(0xA5BD, 0x672B)
+DOUBLE_BYTE_PAIR(0xA5BE, 0x672D)
+DOUBLE_BYTE_PAIR(0xA5BF, 0x6B63)
+DOUBLE_BYTE_PAIR(0xA5C0, 0x6BCD)
+DOUBLE_BYTE_PAIR(0xA5C1, 0x6C11)
+DOUBLE_BYTE_PAIR(0xA5C2, 0x6C10)
+DOUBLE_BYTE_PAIR(0xA5C3, 0x6C38)
+DOUBLE_BYTE_PAIR(0xA5C4, 0x6C41)
+DOUBLE_BYTE_PAIR(0xA5C5, 0x6C40)
+DOUBLE_BYTE_PAIR(0xA5C6, 0x6C3E)
+DOUBLE_BYTE_PAIR(0xA5C7, 0x72AF)
+DOUBLE_BYTE_PAIR(0xA5C8, 0x7384)
+DOUBLE_BYTE_PAIR(0xA5C9, 0x7389)
+DOUBLE_BYTE_PAIR(0xA5CA, 0x74DC)
+DOUBLE_BYTE_PAIR(0xA5CB, 0x74E6)
+DOUBLE_BYTE_PAIR(0xA5CC, 0x7518)
+DOUBLE_BYTE_PAIR(0xA5CD, 0x751F)
+DOUBLE_BYTE_PAIR(0xA5CE, 0x7528)
+DOUBLE_BYTE_PAIR(0xA5CF, 0x7529)
+DOUBLE_BYTE_PAIR(0xA5D0, 0x7530)
+DOUBLE_BYTE_PAIR(0xA5D1, 0x7531)
+DOUBLE_BYTE_PAIR(0xA5D2, 0x7532)
+DOUBLE_BYTE_PAIR(0xA5D3, 0x7533)
+DOUBLE_BYTE_PAIR(0xA5D4, 0x758B)
+DOUBLE_BYTE_PAIR(0xA5D5, 0x767D)
+DOUBLE_BYTE_PAIR(0xA5D6, 0x76AE)
+DOUBLE_BYTE_PAIR(0xA5D7, 0x76BF)
+DOUBLE_BYTE_PAIR(0xA5D8, 0x76EE)
+DOUBLE_BYTE_PAIR(0xA5D9, 0x77DB)
+DOUBLE_BYTE_PAIR(0xA5DA, 0x77E2)
+DOUBLE_BYTE_PAIR(0xA5DB, 0x77F3)
+DOUBLE_BYTE_PAIR(0xA5DC, 0x793A)
+DOUBLE_BYTE_PAIR(0xA5DD, 0x79BE)
+DOUBLE_BYTE_PAIR(0xA5DE, 0x7A74)
+DOUBLE_BYTE_PAIR(0xA5DF, 0x7ACB)
+DOUBLE_BYTE_PAIR(0xA5E0, 0x4E1E)
+DOUBLE_BYTE_PAIR(0xA5E1, 0x4E1F)
+DOUBLE_BYTE_PAIR(0xA5E2, 0x4E52)
+DOUBLE_BYTE_PAIR(0xA5E3, 0x4E53)
+DOUBLE_BYTE_PAIR(0xA5E4, 0x4E69)
+DOUBLE_BYTE_PAIR(0xA5E5, 0x4E99)
+DOUBLE_BYTE_PAIR(0xA5E6, 0x4EA4)
+DOUBLE_BYTE_PAIR(0xA5E7, 0x4EA6)
+DOUBLE_BYTE_PAIR(0xA5E8, 0x4EA5)
+DOUBLE_BYTE_PAIR(0xA5E9, 0x4EFF)
+DOUBLE_BYTE_PAIR(0xA5EA, 0x4F09)
+DOUBLE_BYTE_PAIR(0xA5EB, 0x4F19)
+DOUBLE_BYTE_PAIR(0xA5EC, 0x4F0A)
+DOUBLE_BYTE_PAIR(0xA5ED, 0x4F15)
+DOUBLE_BYTE_PAIR(0xA5EE, 0x4F0D)
+DOUBLE_BYTE_PAIR(0xA5EF, 0x4F10)
+DOUBLE_BYTE_PAIR(0xA5F0, 0x4F11)
+DOUBLE_BYTE_PAIR(0xA5F1, 0x4F0F)
+DOUBLE_BYTE_PAIR(0xA5F2, 0x4EF2)
+DOUBLE_BYTE_PAIR(0xA5F3, 0x4EF6)
+DOUBLE_BYTE_PAIR(0xA5F4, 0x4EFB)
+DOUBLE_BYTE_PAIR(0xA5F5, 0x4EF0)
+DOUBLE_BYTE_PAIR(0xA5F6, 0x4EF3)
+DOUBLE_BYTE_PAIR(0xA5F7, 0x4EFD)
+DOUBLE_BYTE_PAIR(0xA5F8, 0x4F01)
+DOUBLE_BYTE_PAIR(0xA5F9, 0x4F0B)
+DOUBLE_BYTE_PAIR(0xA5FA, 0x5149)
+DOUBLE_BYTE_PAIR(0xA5FB, 0x5147)
+DOUBLE_BYTE_PAIR(0xA5FC, 0x5146)
+DOUBLE_BYTE_PAIR(0xA5FD, 0x5148)
+DOUBLE_BYTE_PAIR(0xA5FE, 0x5168)
+DOUBLE_BYTE_PAIR(0xA640, 0x5171)
+DOUBLE_BYTE_PAIR(0xA641, 0x518D)
+DOUBLE_BYTE_PAIR(0xA642, 0x51B0)
+DOUBLE_BYTE_PAIR(0xA643, 0x5217)
+DOUBLE_BYTE_PAIR(0xA644, 0x5211)
+DOUBLE_BYTE_PAIR(0xA645, 0x5212)
+DOUBLE_BYTE_PAIR(0xA646, 0x520E)
+DOUBLE_BYTE_PAIR(0xA647, 0x5216)
+DOUBLE_BYTE_PAIR(0xA648, 0x52A3)
+DOUBLE_BYTE_PAIR(0xA649, 0x5308)
+DOUBLE_BYTE_PAIR(0xA64A, 0x5321)
+DOUBLE_BYTE_PAIR(0xA64B, 0x5320)
+DOUBLE_BYTE_PAIR(0xA64C, 0x5370)
+DOUBLE_BYTE_PAIR(0xA64D, 0x5371)
+DOUBLE_BYTE_PAIR(0xA64E, 0x5409)
+DOUBLE_BYTE_PAIR(0xA64F, 0x540F)
+DOUBLE_BYTE_PAIR(0xA650, 0x540C)
+DOUBLE_BYTE_PAIR(0xA651, 0x540A)
+DOUBLE_BYTE_PAIR(0xA652, 0x5410)
+DOUBLE_BYTE_PAIR(0xA653, 0x5401)
+DOUBLE_BYTE_PAIR(0xA654, 0x540B)
+DOUBLE_BYTE_PAIR(0xA655, 0x5404)
+DOUBLE_BYTE_PAIR(0xA656, 0x5411)
+DOUBLE_BYTE_PAIR(0xA657, 0x540D)
+DOUBLE_BYTE_PAIR(0xA658, 0x5408)
+DOUBLE_BYTE_PAIR(0xA659, 0x5403)
+DOUBLE_BYTE_PAIR(0xA65A, 0x540E)
+DOUBLE_BYTE_PAIR(0xA65B, 0x5406)
+DOUBLE_BYTE_PAIR(0xA65C, 0x5412)
+DOUBLE_BYTE_PAIR(0xA65D, 0x56E0)
+DOUBLE_BYTE_PAIR(0xA65E, 0x56DE)
+DOUBLE_BYTE_PAIR(0xA65F, 0x56DD)
+DOUBLE_BYTE_PAIR(0xA660, 0x5733)
+DOUBLE_BYTE_PAIR(0xA661, 0x5730)
+DOUBLE_BYTE_PAIR(0xA662, 0x5728)
+DOUBLE_BYTE_PAIR(0xA663, 0x572D)
+DOUBLE_BYTE_PAIR(0xA664, 0x572C)
+DOUBLE_BYTE_PAIR(0xA665, 0x572F)
+DOUBLE_BYTE_PAIR(0xA666, 0x5729)
+DOUBLE_BYTE_PAIR(0xA667, 0x5919)
+DOUBLE_BYTE_PAIR(0xA668, 0x591A)
+DOUBLE_BYTE_PAIR(0xA669, 0x5937)
+DOUBLE_BYTE_PAIR(0xA66A, 0x5938)
+DOUBLE_BYTE_PAIR(0xA66B, 0x5984)
+DOUBLE_BYTE_PAIR(0xA66C, 0x5978)
+DOUBLE_BYTE_PAIR(0xA66D, 0x5983)
+DOUBLE_BYTE_PAIR(0xA66E, 0x597D)
+DOUBLE_BYTE_PAIR(0xA66F, 0x5979)
+DOUBLE_BYTE_PAIR(0xA670, 0x5982)
+DOUBLE_BYTE_PAIR(0xA671, 0x5981)
+DOUBLE_BYTE_PAIR(0xA672, 0x5B57)
+DOUBLE_BYTE_PAIR(0xA673, 0x5B58)
+DOUBLE_BYTE_PAIR(0xA674, 0x5B87)
+DOUBLE_BYTE_PAIR(0xA675, 0x5B88)
+DOUBLE_BYTE_PAIR(0xA676, 0x5B85)
+DOUBLE_BYTE_PAIR(0xA677, 0x5B89)
+DOUBLE_BYTE_PAIR(0xA678, 0x5BFA)
+DOUBLE_BYTE_PAIR(0xA679, 0x5C16)
+DOUBLE_BYTE_PAIR(0xA67A, 0x5C79)
+DOUBLE_BYTE_PAIR(0xA67B, 0x5DDE)
+DOUBLE_BYTE_PAIR(0xA67C, 0x5E06)
+DOUBLE_BYTE_PAIR(0xA67D, 0x5E76)
+DOUBLE_BYTE_PAIR(0xA67E, 0x5E74)
+DOUBLE_BYTE_PAIR(0xA6A1, 0x5F0F)
+DOUBLE_BYTE_PAIR(0xA6A2, 0x5F1B)
+DOUBLE_BYTE_PAIR(0xA6A3, 0x5FD9)
+DOUBLE_BYTE_PAIR(0xA6A4, 0x5FD6)
+DOUBLE_BYTE_PAIR(0xA6A5, 0x620E)
+DOUBLE_BYTE_PAIR(0xA6A6, 0x620C)
+DOUBLE_BYTE_PAIR(0xA6A7, 0x620D)
+DOUBLE_BYTE_PAIR(0xA6A8, 0x6210)
+DOUBLE_BYTE_PAIR(0xA6A9, 0x6263)
+DOUBLE_BYTE_PAIR(0xA6AA, 0x625B)
+DOUBLE_BYTE_PAIR(0xA6AB, 0x6258)
+DOUBLE_BYTE_PAIR(0xA6AC, 0x6536)
+DOUBLE_BYTE_PAIR(0xA6AD, 0x65E9)
+DOUBLE_BYTE_PAIR(0xA6AE, 0x65E8)
+DOUBLE_BYTE_PAIR(0xA6AF, 0x65EC)
+DOUBLE_BYTE_PAIR(0xA6B0, 0x65ED)
+DOUBLE_BYTE_PAIR(0xA6B1, 0x66F2)
+DOUBLE_BYTE_PAIR(0xA6B2, 0x66F3)
+DOUBLE_BYTE_PAIR(0xA6B3, 0x6709)
+DOUBLE_BYTE_PAIR(0xA6B4, 0x673D)
+DOUBLE_BYTE_PAIR(0xA6B5, 0x6734)
+DOUBLE_BYTE_PAIR(0xA6B6, 0x6731)
+DOUBLE_BYTE_PAIR(0xA6B7, 0x6735)
+DOUBLE_BYTE_PAIR(0xA6B8, 0x6B21)
+DOUBLE_BYTE_PAIR(0xA6B9, 0x6B64)
+DOUBLE_BYTE_PAIR(0xA6BA, 0x6B7B)
+DOUBLE_BYTE_PAIR(0xA6BB, 0x6C16)
+DOUBLE_BYTE_PAIR(0xA6BC, 0x6C5D)
+DOUBLE_BYTE_PAIR(0xA6BD, 0x6C57)
+DOUBLE_BYTE_PAIR(0xA6BE, 0x6C59)
+DOUBLE_BYTE_PAIR(0xA6BF, 0x6C5F)
+DOUBLE_BYTE_PAIR(0xA6C0, 0x6C60)
+DOUBLE_BYTE_PAIR(0xA6C1, 0x6C50)
+DOUBLE_BYTE_PAIR(0xA6C2, 0x6C55)
+DOUBLE_BYTE_PAIR(0xA6C3, 0x6C61)
+DOUBLE_BYTE_PAIR(0xA6C4, 0x6C5B)
+DOUBLE_BYTE_PAIR(0xA6C5, 0x6C4D)
+DOUBLE_BYTE_PAIR(0xA6C6, 0x6C4E)
+DOUBLE_BYTE_PAIR(0xA6C7, 0x7070)
+DOUBLE_BYTE_PAIR(0xA6C8, 0x725F)
+DOUBLE_BYTE_PAIR(0xA6C9, 0x725D)
+DOUBLE_BYTE_PAIR(0xA6CA, 0x767E)
+DOUBLE_BYTE_PAIR(0xA6CB, 0x7AF9)
+DOUBLE_BYTE_PAIR(0xA6CC, 0x7C73)
+DOUBLE_BYTE_PAIR(0xA6CD, 0x7CF8)
+DOUBLE_BYTE_PAIR(0xA6CE, 0x7F36)
+DOUBLE_BYTE_PAIR(0xA6CF, 0x7F8A)
+DOUBLE_BYTE_PAIR(0xA6D0, 0x7FBD)
+DOUBLE_BYTE_PAIR(0xA6D1, 0x8001)
+DOUBLE_BYTE_PAIR(0xA6D2, 0x8003)
+DOUBLE_BYTE_PAIR(0xA6D3, 0x800C)
+DOUBLE_BYTE_PAIR(0xA6D4, 0x8012)
+DOUBLE_BYTE_PAIR(0xA6D5, 0x8033)
+DOUBLE_BYTE_PAIR(0xA6D6, 0x807F)
+DOUBLE_BYTE_PAIR(0xA6D7, 0x8089)
+DOUBLE_BYTE_PAIR(0xA6D8, 0x808B)
+DOUBLE_BYTE_PAIR(0xA6D9, 0x808C)
+DOUBLE_BYTE_PAIR(0xA6DA, 0x81E3)
+DOUBLE_BYTE_PAIR(0xA6DB, 0x81EA)
+DOUBLE_BYTE_PAIR(0xA6DC, 0x81F3)
+DOUBLE_BYTE_PAIR(0xA6DD, 0x81FC)
+DOUBLE_BYTE_PAIR(0xA6DE, 0x820C)
+DOUBLE_BYTE_PAIR(0xA6DF, 0x821B)
+DOUBLE_BYTE_PAIR(0xA6E0, 0x821F)
+DOUBLE_BYTE_PAIR(0xA6E1, 0x826E)
+DOUBLE_BYTE_PAIR(0xA6E2, 0x8272)
+DOUBLE_BYTE_PAIR(0xA6E3, 0x827E)
+DOUBLE_BYTE_PAIR(0xA6E4, 0x866B)
+DOUBLE_BYTE_PAIR(0xA6E5, 0x8840)
+DOUBLE_BYTE_PAIR(0xA6E6, 0x884C)
+DOUBLE_BYTE_PAIR(0xA6E7, 0x8863)
+DOUBLE_BYTE_PAIR(0xA6E8, 0x897F)
+DOUBLE_BYTE_PAIR(0xA6E9, 0x9621)
+DOUBLE_BYTE_PAIR(0xA6EA, 0x4E32)
+DOUBLE_BYTE_PAIR(0xA6EB, 0x4EA8)
+DOUBLE_BYTE_PAIR(0xA6EC, 0x4F4D)
+DOUBLE_BYTE_PAIR(0xA6ED, 0x4F4F)
+DOUBLE_BYTE_PAIR(0xA6EE, 0x4F47)
+DOUBLE_BYTE_PAIR(0xA6EF, 0x4F57)
+DOUBLE_BYTE_PAIR(0xA6F0, 0x4F5E)
+DOUBLE_BYTE_PAIR(0xA6F1, 0x4F34)
+DOUBLE_BYTE_PAIR(0xA6F2, 0x4F5B)
+DOUBLE_BYTE_PAIR(0xA6F3, 0x4F55)
+DOUBLE_BYTE_PAIR(0xA6F4, 0x4F30)
+DOUBLE_BYTE_PAIR(0xA6F5, 0x4F50)
+DOUBLE_BYTE_PAIR(0xA6F6, 0x4F51)
+DOUBLE_BYTE_PAIR(0xA6F7, 0x4F3D)
+DOUBLE_BYTE_PAIR(0xA6F8, 0x4F3A)
+DOUBLE_BYTE_PAIR(0xA6F9, 0x4F38)
+DOUBLE_BYTE_PAIR(0xA6FA, 0x4F43)
+DOUBLE_BYTE_PAIR(0xA6FB, 0x4F54)
+DOUBLE_BYTE_PAIR(0xA6FC, 0x4F3C)
+DOUBLE_BYTE_PAIR(0xA6FD, 0x4F46)
+DOUBLE_BYTE_PAIR(0xA6FE, 0x4F63)
+DOUBLE_BYTE_PAIR(0xA740, 0x4F5C)
+DOUBLE_BYTE_PAIR(0xA741, 0x4F60)
+DOUBLE_BYTE_PAIR(0xA742, 0x4F2F)
+DOUBLE_BYTE_PAIR(0xA743, 0x4F4E)
+DOUBLE_BYTE_PAIR(0xA744, 0x4F36)
+DOUBLE_BYTE_PAIR(0xA745, 0x4F59)
+DOUBLE_BYTE_PAIR(0xA746, 0x4F5D)
+DOUBLE_BYTE_PAIR(0xA747, 0x4F48)
+DOUBLE_BYTE_PAIR(0xA748, 0x4F5A)
+DOUBLE_BYTE_PAIR(0xA749, 0x514C)
+DOUBLE_BYTE_PAIR(0xA74A, 0x514B)
+DOUBLE_BYTE_PAIR(0xA74B, 0x514D)
+DOUBLE_BYTE_PAIR(0xA74C, 0x5175)
+DOUBLE_BYTE_PAIR(0xA74D, 0x51B6)
+DOUBLE_BYTE_PAIR(0xA74E, 0x51B7)
+DOUBLE_BYTE_PAIR(0xA74F, 0x5225)
+DOUBLE_BYTE_PAIR(0xA750, 0x5224)
+DOUBLE_BYTE_PAIR(0xA751, 0x5229)
+DOUBLE_BYTE_PAIR(0xA752, 0x522A)
+DOUBLE_BYTE_PAIR(0xA753, 0x5228)
+DOUBLE_BYTE_PAIR(0xA754, 0x52AB)
+DOUBLE_BYTE_PAIR(0xA755, 0x52A9)
+DOUBLE_BYTE_PAIR(0xA756, 0x52AA)
+DOUBLE_BYTE_PAIR(0xA757, 0x52AC)
+DOUBLE_BYTE_PAIR(0xA758, 0x5323)
+DOUBLE_BYTE_PAIR(0xA759, 0x5373)
+DOUBLE_BYTE_PAIR(0xA75A, 0x5375)
+DOUBLE_BYTE_PAIR(0xA75B, 0x541D)
+DOUBLE_BYTE_PAIR(0xA75C, 0x542D)
+DOUBLE_BYTE_PAIR(0xA75D, 0x541E)
+DOUBLE_BYTE_PAIR(0xA75E, 0x543E)
+DOUBLE_BYTE_PAIR(0xA75F, 0x5426)
+DOUBLE_BYTE_PAIR(0xA760, 0x544E)
+DOUBLE_BYTE_PAIR(0xA761, 0x5427)
+DOUBLE_BYTE_PAIR(0xA762, 0x5446)
+DOUBLE_BYTE_PAIR(0xA763, 0x5443)
+DOUBLE_BYTE_PAIR(0xA764, 0x5433)
+DOUBLE_BYTE_PAIR(0xA765, 0x5448)
+DOUBLE_BYTE_PAIR(0xA766, 0x5442)
+DOUBLE_BYTE_PAIR(0xA767, 0x541B)
+DOUBLE_BYTE_PAIR(0xA768, 0x5429)
+DOUBLE_BYTE_PAIR(0xA769, 0x544A)
+DOUBLE_BYTE_PAIR(0xA76A, 0x5439)
+DOUBLE_BYTE_PAIR(0xA76B, 0x543B)
+DOUBLE_BYTE_PAIR(0xA76C, 0x5438)
+DOUBLE_BYTE_PAIR(0xA76D, 0x542E)
+DOUBLE_BYTE_PAIR(0xA76E, 0x5435)
+DOUBLE_BYTE_PAIR(0xA76F, 0x5436)
+DOUBLE_BYTE_PAIR(0xA770, 0x5420)
+DOUBLE_BYTE_PAIR(0xA771, 0x543C)
+DOUBLE_BYTE_PAIR(0xA772, 0x5440)
+DOUBLE_BYTE_PAIR(0xA773, 0x5431)
+DOUBLE_BYTE_PAIR(0xA774, 0x542B)
+DOUBLE_BYTE_PAIR(0xA775, 0x541F)
+DOUBLE_BYTE_PAIR(0xA776, 0x542C)
+DOUBLE_BYTE_PAIR(0xA777, 0x56EA)
+DOUBLE_BYTE_PAIR(0xA778, 0x56F0)
+DOUBLE_BYTE_PAIR(0xA779, 0x56E4)
+DOUBLE_BYTE_PAIR(0xA77A, 0x56EB)
+DOUBLE_BYTE_PAIR(0xA77B, 0x574A)
+DOUBLE_BYTE_PAIR(0xA77C, 0x5751)
+DOUBLE_BYTE_PAIR(0xA77D, 0x5740)
+DOUBLE_BYTE_PAIR(0xA77E, 0x574D)
+DOUBLE_BYTE_PAIR(0xA7A1, 0x5747)
+DOUBLE_BYTE_PAIR(0xA7A2, 0x574E)
+DOUBLE_BYTE_PAIR(0xA7A3, 0x573E)
+DOUBLE_BYTE_PAIR(0xA7A4, 0x5750)
+DOUBLE_BYTE_PAIR(0xA7A5, 0x574F)
+DOUBLE_BYTE_PAIR(0xA7A6, 0x573B)
+DOUBLE_BYTE_PAIR(0xA7A7, 0x58EF)
+DOUBLE_BYTE_PAIR(0xA7A8, 0x593E)
+DOUBLE_BYTE_PAIR(0xA7A9, 0x599D)
+DOUBLE_BYTE_PAIR(0xA7AA, 0x5992)
+DOUBLE_BYTE_PAIR(0xA7AB, 0x59A8)
+DOUBLE_BYTE_PAIR(0xA7AC, 0x599E)
+DOUBLE_BYTE_PAIR(0xA7AD, 0x59A3)
+DOUBLE_BYTE_PAIR(0xA7AE, 0x5999)
+DOUBLE_BYTE_PAIR(0xA7AF, 0x5996)
+DOUBLE_BYTE_PAIR(0xA7B0, 0x598D)
+DOUBLE_BYTE_PAIR(0xA7B1, 0x59A4)
+DOUBLE_BYTE_PAIR(0xA7B2, 0x5993)
+DOUBLE_BYTE_PAIR(0xA7B3, 0x598A)
+DOUBLE_BYTE_PAIR(0xA7B4, 0x59A5)
+DOUBLE_BYTE_PAIR(0xA7B5, 0x5B5D)
+DOUBLE_BYTE_PAIR(0xA7B6, 0x5B5C)
+DOUBLE_BYTE_PAIR(0xA7B7, 0x5B5A)
+DOUBLE_BYTE_PAIR(0xA7B8, 0x5B5B)
+DOUBLE_BYTE_PAIR(0xA7B9, 0x5B8C)
+DOUBLE_BYTE_PAIR(0xA7BA, 0x5B8B)
+DOUBLE_BYTE_PAIR(0xA7BB, 0x5B8F)
+DOUBLE_BYTE_PAIR(0xA7BC, 0x5C2C)
+DOUBLE_BYTE_PAIR(0xA7BD, 0x5C40)
+DOUBLE_BYTE_PAIR(0xA7BE, 0x5C41)
+DOUBLE_BYTE_PAIR(0xA7BF, 0x5C3F)
+DOUBLE_BYTE_PAIR(0xA7C0, 0x5C3E)
+DOUBLE_BYTE_PAIR(0xA7C1, 0x5C90)
+DOUBLE_BYTE_PAIR(0xA7C2, 0x5C91)
+DOUBLE_BYTE_PAIR(0xA7C3, 0x5C94)
+DOUBLE_BYTE_PAIR(0xA7C4, 0x5C8C)
+DOUBLE_BYTE_PAIR(0xA7C5, 0x5DEB)
+DOUBLE_BYTE_PAIR(0xA7C6, 0x5E0C)
+DOUBLE_BYTE_PAIR(0xA7C7, 0x5E8F)
+DOUBLE_BYTE_PAIR(0xA7C8, 0x5E87)
+DOUBLE_BYTE_PAIR(0xA7C9, 0x5E8A)
+DOUBLE_BYTE_PAIR(0xA7CA, 0x5EF7)
+DOUBLE_BYTE_PAIR(0xA7CB, 0x5F04)
+DOUBLE_BYTE_PAIR(0xA7CC, 0x5F1F)
+DOUBLE_BYTE_PAIR(0xA7CD, 0x5F64)
+DOUBLE_BYTE_PAIR(0xA7CE, 0x5F62)
+DOUBLE_BYTE_PAIR(0xA7CF, 0x5F77)
+DOUBLE_BYTE_PAIR(0xA7D0, 0x5F79)
+DOUBLE_BYTE_PAIR(0xA7D1, 0x5FD8)
+DOUBLE_BYTE_PAIR(0xA7D2, 0x5FCC)
+DOUBLE_BYTE_PAIR(0xA7D3, 0x5FD7)
+DOUBLE_BYTE_PAIR(0xA7D4, 0x5FCD)
+DOUBLE_BYTE_PAIR(0xA7D5, 0x5FF1)
+DOUBLE_BYTE_PAIR(0xA7D6, 0x5FEB)
+DOUBLE_BYTE_PAIR(0xA7D7, 0x5FF8)
+DOUBLE_BYTE_PAIR(0xA7D8, 0x5FEA)
+DOUBLE_BYTE_PAIR(0xA7D9, 0x6212)
+DOUBLE_BYTE_PAIR(0xA7DA, 0x6211)
+DOUBLE_BYTE_PAIR(0xA7DB, 0x6284)
+DOUBLE_BYTE_PAIR(0xA7DC, 0x6297)
+DOUBLE_BYTE_PAIR(0xA7DD, 0x6296)
+DOUBLE_BYTE_PAIR(0xA7DE, 0x6280)
+DOUBLE_BYTE_PAIR(0xA7DF, 0x6276)
+DOUBLE_BYTE_PAIR(0xA7E0, 0x6289)
+DOUBLE_BYTE_PAIR(0xA7E1, 0x626D)
+DOUBLE_BYTE_PAIR(0xA7E2, 0x628A)
+DOUBLE_BYTE_PAIR(0xA7E3, 0x627C)
+DOUBLE_BYTE_PAIR(0xA7E4, 0x627E)
+DOUBLE_BYTE_PAIR(0xA7E5, 0x6279)
+DOUBLE_BYTE_PAIR(0xA7E6, 0x6273)
+DOUBLE_BYTE_PAIR(0xA7E7, 0x6292)
+DOUBLE_BYTE_PAIR(0xA7E8, 0x626F)
+DOUBLE_BYTE_PAIR(0xA7E9, 0x6298)
+DOUBLE_BYTE_PAIR(0xA7EA, 0x626E)
+DOUBLE_BYTE_PAIR(0xA7EB, 0x6295)
+DOUBLE_BYTE_PAIR(0xA7EC, 0x6293)
+DOUBLE_BYTE_PAIR(0xA7ED, 0x6291)
+DOUBLE_BYTE_PAIR(0xA7EE, 0x6286)
+DOUBLE_BYTE_PAIR(0xA7EF, 0x6539)
+DOUBLE_BYTE_PAIR(0xA7F0, 0x653B)
+DOUBLE_BYTE_PAIR(0xA7F1, 0x6538)
+DOUBLE_BYTE_PAIR(0xA7F2, 0x65F1)
+DOUBLE_BYTE_PAIR(0xA7F3, 0x66F4)
+DOUBLE_BYTE_PAIR(0xA7F4, 0x675F)
+DOUBLE_BYTE_PAIR(0xA7F5, 0x674E)
+DOUBLE_BYTE_PAIR(0xA7F6, 0x674F)
+DOUBLE_BYTE_PAIR(0xA7F7, 0x6750)
+DOUBLE_BYTE_PAIR(0xA7F8, 0x6751)
+DOUBLE_BYTE_PAIR(0xA7F9, 0x675C)
+DOUBLE_BYTE_PAIR(0xA7FA, 0x6756)
+DOUBLE_BYTE_PAIR(0xA7FB, 0x675E)
+DOUBLE_BYTE_PAIR(0xA7FC, 0x6749)
+DOUBLE_BYTE_PAIR(0xA7FD, 0x6746)
+DOUBLE_BYTE_PAIR(0xA7FE, 0x6760)
+DOUBLE_BYTE_PAIR(0xA840, 0x6753)
+DOUBLE_BYTE_PAIR(0xA841, 0x6757)
+DOUBLE_BYTE_PAIR(0xA842, 0x6B65)
+DOUBLE_BYTE_PAIR(0xA843, 0x6BCF)
+DOUBLE_BYTE_PAIR(0xA844, 0x6C42)
+DOUBLE_BYTE_PAIR(0xA845, 0x6C5E)
+DOUBLE_BYTE_PAIR(0xA846, 0x6C99)
+DOUBLE_BYTE_PAIR(0xA847, 0x6C81)
+DOUBLE_BYTE_PAIR(0xA848, 0x6C88)
+DOUBLE_BYTE_PAIR(0xA849, 0x6C89)
+DOUBLE_BYTE_PAIR(0xA84A, 0x6C85)
+DOUBLE_BYTE_PAIR(0xA84B, 0x6C9B)
+DOUBLE_BYTE_PAIR(0xA84C, 0x6C6A)
+DOUBLE_BYTE_PAIR(0xA84D, 0x6C7A)
+DOUBLE_BYTE_PAIR(0xA84E, 0x6C90)
+DOUBLE_BYTE_PAIR(0xA84F, 0x6C70)
+DOUBLE_BYTE_PAIR(0xA850, 0x6C8C)
+DOUBLE_BYTE_PAIR(0xA851, 0x6C68)
+DOUBLE_BYTE_PAIR(0xA852, 0x6C96)
+DOUBLE_BYTE_PAIR(0xA853, 0x6C92)
+DOUBLE_BYTE_PAIR(0xA854, 0x6C7D)
+DOUBLE_BYTE_PAIR(0xA855, 0x6C83)
+DOUBLE_BYTE_PAIR(0xA856, 0x6C72)
+DOUBLE_BYTE_PAIR(0xA857, 0x6C7E)
+DOUBLE_BYTE_PAIR(0xA858, 0x6C74)
+DOUBLE_BYTE_PAIR(0xA859, 0x6C86)
+DOUBLE_BYTE_PAIR(0xA85A, 0x6C76)
+DOUBLE_BYTE_PAIR(0xA85B, 0x6C8D)
+DOUBLE_BYTE_PAIR(0xA85C, 0x6C94)
+DOUBLE_BYTE_PAIR(0xA85D, 0x6C98)
+DOUBLE_BYTE_PAIR(0xA85E, 0x6C82)
+DOUBLE_BYTE_PAIR(0xA85F, 0x7076)
+DOUBLE_BYTE_PAIR(0xA860, 0x707C)
+DOUBLE_BYTE_PAIR(0xA861, 0x707D)
+DOUBLE_BYTE_PAIR(0xA862, 0x7078)
+DOUBLE_BYTE_PAIR(0xA863, 0x7262)
+DOUBLE_BYTE_PAIR(0xA864, 0x7261)
+DOUBLE_BYTE_PAIR(0xA865, 0x7260)
+DOUBLE_BYTE_PAIR(0xA866, 0x72C4)
+DOUBLE_BYTE_PAIR(0xA867, 0x72C2)
+DOUBLE_BYTE_PAIR(0xA868, 0x7396)
+DOUBLE_BYTE_PAIR(0xA869, 0x752C)
+DOUBLE_BYTE_PAIR(0xA86A, 0x752B)
+DOUBLE_BYTE_PAIR(0xA86B, 0x7537)
+DOUBLE_BYTE_PAIR(0xA86C, 0x7538)
+DOUBLE_BYTE_PAIR(0xA86D, 0x7682)
+DOUBLE_BYTE_PAIR(0xA86E, 0x76EF)
+DOUBLE_BYTE_PAIR(0xA86F, 0x77E3)
+DOUBLE_BYTE_PAIR(0xA870, 0x79C1)
+DOUBLE_BYTE_PAIR(0xA871, 0x79C0)
+DOUBLE_BYTE_PAIR(0xA872, 0x79BF)
+DOUBLE_BYTE_PAIR(0xA873, 0x7A76)
+DOUBLE_BYTE_PAIR(0xA874, 0x7CFB)
+DOUBLE_BYTE_PAIR(0xA875, 0x7F55)
+DOUBLE_BYTE_PAIR(0xA876, 0x8096)
+DOUBLE_BYTE_PAIR(0xA877, 0x8093)
+DOUBLE_BYTE_PAIR(0xA878, 0x809D)
+DOUBLE_BYTE_PAIR(0xA879, 0x8098)
+DOUBLE_BYTE_PAIR(0xA87A, 0x809B)
+DOUBLE_BYTE_PAIR(0xA87B, 0x809A)
+DOUBLE_BYTE_PAIR(0xA87C, 0x80B2)
+DOUBLE_BYTE_PAIR(0xA87D, 0x826F)
+DOUBLE_BYTE_PAIR(0xA87E, 0x8292)
+DOUBLE_BYTE_PAIR(0xA8A1, 0x828B)
+DOUBLE_BYTE_PAIR(0xA8A2, 0x828D)
+DOUBLE_BYTE_PAIR(0xA8A3, 0x898B)
+DOUBLE_BYTE_PAIR(0xA8A4, 0x89D2)
+DOUBLE_BYTE_PAIR(0xA8A5, 0x8A00)
+DOUBLE_BYTE_PAIR(0xA8A6, 0x8C37)
+DOUBLE_BYTE_PAIR(0xA8A7, 0x8C46)
+DOUBLE_BYTE_PAIR(0xA8A8, 0x8C55)
+DOUBLE_BYTE_PAIR(0xA8A9, 0x8C9D)
+DOUBLE_BYTE_PAIR(0xA8AA, 0x8D64)
+DOUBLE_BYTE_PAIR(0xA8AB, 0x8D70)
+DOUBLE_BYTE_PAIR(0xA8AC, 0x8DB3)
+DOUBLE_BYTE_PAIR(0xA8AD, 0x8EAB)
+DOUBLE_BYTE_PAIR(0xA8AE, 0x8ECA)
+DOUBLE_BYTE_PAIR(0xA8AF, 0x8F9B)
+DOUBLE_BYTE_PAIR(0xA8B0, 0x8FB0)
+DOUBLE_BYTE_PAIR(0xA8B1, 0x8FC2)
+DOUBLE_BYTE_PAIR(0xA8B2, 0x8FC6)
+DOUBLE_BYTE_PAIR(0xA8B3, 0x8FC5)
+DOUBLE_BYTE_PAIR(0xA8B4, 0x8FC4)
+DOUBLE_BYTE_PAIR(0xA8B5, 0x5DE1)
+DOUBLE_BYTE_PAIR(0xA8B6, 0x9091)
+DOUBLE_BYTE_PAIR(0xA8B7, 0x90A2)
+DOUBLE_BYTE_PAIR(0xA8B8, 0x90AA)
+DOUBLE_BYTE_PAIR(0xA8B9, 0x90A6)
+DOUBLE_BYTE_PAIR(0xA8BA, 0x90A3)
+DOUBLE_BYTE_PAIR(0xA8BB, 0x9149)
+DOUBLE_BYTE_PAIR(0xA8BC, 0x91C6)
+DOUBLE_BYTE_PAIR(0xA8BD, 0x91CC)
+DOUBLE_BYTE_PAIR(0xA8BE, 0x9632)
+DOUBLE_BYTE_PAIR(0xA8BF, 0x962E)
+DOUBLE_BYTE_PAIR(0xA8C0, 0x9631)
+DOUBLE_BYTE_PAIR(0xA8C1, 0x962A)
+DOUBLE_BYTE_PAIR(0xA8C2, 0x962C)
+DOUBLE_BYTE_PAIR(0xA8C3, 0x4E26)
+DOUBLE_BYTE_PAIR(0xA8C4, 0x4E56)
+DOUBLE_BYTE_PAIR(0xA8C5, 0x4E73)
+DOUBLE_BYTE_PAIR(0xA8C6, 0x4E8B)
+DOUBLE_BYTE_PAIR(0xA8C7, 0x4E9B)
+DOUBLE_BYTE_PAIR(0xA8C8, 0x4E9E)
+DOUBLE_BYTE_PAIR(0xA8C9, 0x4EAB)
+DOUBLE_BYTE_PAIR(0xA8CA, 0x4EAC)
+DOUBLE_BYTE_PAIR(0xA8CB, 0x4F6F)
+DOUBLE_BYTE_PAIR(0xA8CC, 0x4F9D)
+DOUBLE_BYTE_PAIR(0xA8CD, 0x4F8D)
+DOUBLE_BYTE_PAIR(0xA8CE, 0x4F73)
+DOUBLE_BYTE_PAIR(0xA8CF, 0x4F7F)
+DOUBLE_BYTE_PAIR(0xA8D0, 0x4F6C)
+DOUBLE_BYTE_PAIR(0xA8D1, 0x4F9B)
+DOUBLE_BYTE_PAIR(0xA8D2, 0x4F8B)
+DOUBLE_BYTE_PAIR(0xA8D3, 0x4F86)
+DOUBLE_BYTE_PAIR(0xA8D4, 0x4F83)
+DOUBLE_BYTE_PAIR(0xA8D5, 0x4F70)
+DOUBLE_BYTE_PAIR(0xA8D6, 0x4F75)
+DOUBLE_BYTE_PAIR(0xA8D7, 0x4F88)
+DOUBLE_BYTE_PAIR(0xA8D8, 0x4F69)
+DOUBLE_BYTE_PAIR(0xA8D9, 0x4F7B)
+DOUBLE_BYTE_PAIR(0xA8DA, 0x4F96)
+DOUBLE_BYTE_PAIR(0xA8DB, 0x4F7E)
+DOUBLE_BYTE_PAIR(0xA8DC, 0x4F8F)
+DOUBLE_BYTE_PAIR(0xA8DD, 0x4F91)
+DOUBLE_BYTE_PAIR(0xA8DE, 0x4F7A)
+DOUBLE_BYTE_PAIR(0xA8DF, 0x5154)
+DOUBLE_BYTE_PAIR(0xA8E0, 0x5152)
+DOUBLE_BYTE_PAIR(0xA8E1, 0x5155)
+DOUBLE_BYTE_PAIR(0xA8E2, 0x5169)
+DOUBLE_BYTE_PAIR(0xA8E3, 0x5177)
+DOUBLE_BYTE_PAIR(0xA8E4, 0x5176)
+DOUBLE_BYTE_PAIR(0xA8E5, 0x5178)
+DOUBLE_BYTE_PAIR(0xA8E6, 0x51BD)
+DOUBLE_BYTE_PAIR(0xA8E7, 0x51FD)
+DOUBLE_BYTE_PAIR(0xA8E8, 0x523B)
+DOUBLE_BYTE_PAIR(0xA8E9, 0x5238)
+DOUBLE_BYTE_PAIR(0xA8EA, 0x5237)
+DOUBLE_BYTE_PAIR(0xA8EB, 0x523A)
+DOUBLE_BYTE_PAIR(0xA8EC, 0x5230)
+DOUBLE_BYTE_PAIR(0xA8ED, 0x522E)
+DOUBLE_BYTE_PAIR(0xA8EE, 0x5236)
+DOUBLE_BYTE_PAIR(0xA8EF, 0x5241)
+DOUBLE_BYTE_PAIR(0xA8F0, 0x52BE)
+DOUBLE_BYTE_PAIR(0xA8F1, 0x52BB)
+DOUBLE_BYTE_PAIR(0xA8F2, 0x5352)
+DOUBLE_BYTE_PAIR(0xA8F3, 0x5354)
+DOUBLE_BYTE_PAIR(0xA8F4, 0x5353)
+DOUBLE_BYTE_PAIR(0xA8F5, 0x5351)
+DOUBLE_BYTE_PAIR(0xA8F6, 0x5366)
+DOUBLE_BYTE_PAIR(0xA8F7, 0x5377)
+DOUBLE_BYTE_PAIR(0xA8F8, 0x5378)
+DOUBLE_BYTE_PAIR(0xA8F9, 0x5379)
+DOUBLE_BYTE_PAIR(0xA8FA, 0x53D6)
+DOUBLE_BYTE_PAIR(0xA8FB, 0x53D4)
+DOUBLE_BYTE_PAIR(0xA8FC, 0x53D7)
+DOUBLE_BYTE_PAIR(0xA8FD, 0x5473)
+DOUBLE_BYTE_PAIR(0xA8FE, 0x5475)
+DOUBLE_BYTE_PAIR(0xA940, 0x5496)
+DOUBLE_BYTE_PAIR(0xA941, 0x5478)
+DOUBLE_BYTE_PAIR(0xA942, 0x5495)
+DOUBLE_BYTE_PAIR(0xA943, 0x5480)
+DOUBLE_BYTE_PAIR(0xA944, 0x547B)
+DOUBLE_BYTE_PAIR(0xA945, 0x5477)
+DOUBLE_BYTE_PAIR(0xA946, 0x5484)
+DOUBLE_BYTE_PAIR(0xA947, 0x5492)
+DOUBLE_BYTE_PAIR(0xA948, 0x5486)
+DOUBLE_BYTE_PAIR(0xA949, 0x547C)
+DOUBLE_BYTE_PAIR(0xA94A, 0x5490)
+DOUBLE_BYTE_PAIR(0xA94B, 0x5471)
+DOUBLE_BYTE_PAIR(0xA94C, 0x5476)
+DOUBLE_BYTE_PAIR(0xA94D, 0x548C)
+DOUBLE_BYTE_PAIR(0xA94E, 0x549A)
+DOUBLE_BYTE_PAIR(0xA94F, 0x5462)
+DOUBLE_BYTE_PAIR(0xA950, 0x5468)
+DOUBLE_BYTE_PAIR(0xA951, 0x548B)
+DOUBLE_BYTE_PAIR(0xA952, 0x547D)
+DOUBLE_BYTE_PAIR(0xA953, 0x548E)
+DOUBLE_BYTE_PAIR(0xA954, 0x56FA)
+DOUBLE_BYTE_PAIR(0xA955, 0x5783)
+DOUBLE_BYTE_PAIR(0xA956, 0x5777)
+DOUBLE_BYTE_PAIR(0xA957, 0x576A)
+DOUBLE_BYTE_PAIR(0xA958, 0x5769)
+DOUBLE_BYTE_PAIR(0xA959, 0x5761)
+DOUBLE_BYTE_PAIR(0xA95A, 0x5766)
+DOUBLE_BYTE_PAIR(0xA95B, 0x5764)
+DOUBLE_BYTE_PAIR(0xA95C, 0x577C)
+DOUBLE_BYTE_PAIR(0xA95D, 0x591C)
+DOUBLE_BYTE_PAIR(0xA95E, 0x5949)
+DOUBLE_BYTE_PAIR(0xA95F, 0x5947)
+DOUBLE_BYTE_PAIR(0xA960, 0x5948)
+DOUBLE_BYTE_PAIR(0xA961, 0x5944)
+DOUBLE_BYTE_PAIR(0xA962, 0x5954)
+DOUBLE_BYTE_PAIR(0xA963, 0x59BE)
+DOUBLE_BYTE_PAIR(0xA964, 0x59BB)
+DOUBLE_BYTE_PAIR(0xA965, 0x59D4)
+DOUBLE_BYTE_PAIR(0xA966, 0x59B9)
+DOUBLE_BYTE_PAIR(0xA967, 0x59AE)
+DOUBLE_BYTE_PAIR(0xA968, 0x59D1)
+DOUBLE_BYTE_PAIR(0xA969, 0x59C6)
+DOUBLE_BYTE_PAIR(0xA96A, 0x59D0)
+DOUBLE_BYTE_PAIR(0xA96B, 0x59CD)
+DOUBLE_BYTE_PAIR(0xA96C, 0x59CB)
+DOUBLE_BYTE_PAIR(0xA96D, 0x59D3)
+DOUBLE_BYTE_PAIR(0xA96E, 0x59CA)
+DOUBLE_BYTE_PAIR(0xA96F, 0x59AF)
+DOUBLE_BYTE_PAIR(0xA970, 0x59B3)
+DOUBLE_BYTE_PAIR(0xA971, 0x59D2)
+DOUBLE_BYTE_PAIR(0xA972, 0x59C5)
+DOUBLE_BYTE_PAIR(0xA973, 0x5B5F)
+DOUBLE_BYTE_PAIR(0xA974, 0x5B64)
+DOUBLE_BYTE_PAIR(0xA975, 0x5B63)
+DOUBLE_BYTE_PAIR(0xA976, 0x5B97)
+DOUBLE_BYTE_PAIR(0xA977, 0x5B9A)
+DOUBLE_BYTE_PAIR(0xA978, 0x5B98)
+DOUBLE_BYTE_PAIR(0xA979, 0x5B9C)
+DOUBLE_BYTE_PAIR(0xA97A, 0x5B99)
+DOUBLE_BYTE_PAIR(0xA97B, 0x5B9B)
+DOUBLE_BYTE_PAIR(0xA97C, 0x5C1A)
+DOUBLE_BYTE_PAIR(0xA97D, 0x5C48)
+DOUBLE_BYTE_PAIR(0xA97E, 0x5C45)
+DOUBLE_BYTE_PAIR(0xA9A1, 0x5C46)
+DOUBLE_BYTE_PAIR(0xA9A2, 0x5CB7)
+DOUBLE_BYTE_PAIR(0xA9A3, 0x5CA1)
+DOUBLE_BYTE_PAIR(0xA9A4, 0x5CB8)
+DOUBLE_BYTE_PAIR(0xA9A5, 0x5CA9)
+DOUBLE_BYTE_PAIR(0xA9A6, 0x5CAB)
+DOUBLE_BYTE_PAIR(0xA9A7, 0x5CB1)
+DOUBLE_BYTE_PAIR(0xA9A8, 0x5CB3)
+DOUBLE_BYTE_PAIR(0xA9A9, 0x5E18)
+DOUBLE_BYTE_PAIR(0xA9AA, 0x5E1A)
+DOUBLE_BYTE_PAIR(0xA9AB, 0x5E16)
+DOUBLE_BYTE_PAIR(0xA9AC, 0x5E15)
+DOUBLE_BYTE_PAIR(0xA9AD, 0x5E1B)
+DOUBLE_BYTE_PAIR(0xA9AE, 0x5E11)
+DOUBLE_BYTE_PAIR(0xA9AF, 0x5E78)
+DOUBLE_BYTE_PAIR(0xA9B0, 0x5E9A)
+DOUBLE_BYTE_PAIR(0xA9B1, 0x5E97)
+DOUBLE_BYTE_PAIR(0xA9B2, 0x5E9C)
+DOUBLE_BYTE_PAIR(0xA9B3, 0x5E95)
+DOUBLE_BYTE_PAIR(0xA9B4, 0x5E96)
+DOUBLE_BYTE_PAIR(0xA9B5, 0x5EF6)
+DOUBLE_BYTE_PAIR(0xA9B6, 0x5F26)
+DOUBLE_BYTE_PAIR(0xA9B7, 0x5F27)
+DOUBLE_BYTE_PAIR(0xA9B8, 0x5F29)
+DOUBLE_BYTE_PAIR(0xA9B9, 0x5F80)
+DOUBLE_BYTE_PAIR(0xA9BA, 0x5F81)
+DOUBLE_BYTE_PAIR(0xA9BB, 0x5F7F)
+DOUBLE_BYTE_PAIR(0xA9BC, 0x5F7C)
+DOUBLE_BYTE_PAIR(0xA9BD, 0x5FDD)
+DOUBLE_BYTE_PAIR(0xA9BE, 0x5FE0)
+DOUBLE_BYTE_PAIR(0xA9BF, 0x5FFD)
+DOUBLE_BYTE_PAIR(0xA9C0, 0x5FF5)
+DOUBLE_BYTE_PAIR(0xA9C1, 0x5FFF)
+DOUBLE_BYTE_PAIR(0xA9C2, 0x600F)
+DOUBLE_BYTE_PAIR(0xA9C3, 0x6014)
+DOUBLE_BYTE_PAIR(0xA9C4, 0x602F)
+DOUBLE_BYTE_PAIR(0xA9C5, 0x6035)
+DOUBLE_BYTE_PAIR(0xA9C6, 0x6016)
+DOUBLE_BYTE_PAIR(0xA9C7, 0x602A)
+DOUBLE_BYTE_PAIR(0xA9C8, 0x6015)
+DOUBLE_BYTE_PAIR(0xA9C9, 0x6021)
+DOUBLE_BYTE_PAIR(0xA9CA, 0x6027)
+DOUBLE_BYTE_PAIR(0xA9CB, 0x6029)
+DOUBLE_BYTE_PAIR(0xA9CC, 0x602B)
+DOUBLE_BYTE_PAIR(0xA9CD, 0x601B)
+DOUBLE_BYTE_PAIR(0xA9CE, 0x6216)
+DOUBLE_BYTE_PAIR(0xA9CF, 0x6215)
+DOUBLE_BYTE_PAIR(0xA9D0, 0x623F)
+DOUBLE_BYTE_PAIR(0xA9D1, 0x623E)
+DOUBLE_BYTE_PAIR(0xA9D2, 0x6240)
+DOUBLE_BYTE_PAIR(0xA9D3, 0x627F)
+DOUBLE_BYTE_PAIR(0xA9D4, 0x62C9)
+DOUBLE_BYTE_PAIR(0xA9D5, 0x62CC)
+DOUBLE_BYTE_PAIR(0xA9D6, 0x62C4)
+DOUBLE_BYTE_PAIR(0xA9D7, 0x62BF)
+DOUBLE_BYTE_PAIR(0xA9D8, 0x62C2)
+DOUBLE_BYTE_PAIR(0xA9D9, 0x62B9)
+DOUBLE_BYTE_PAIR(0xA9DA, 0x62D2)
+DOUBLE_BYTE_PAIR(0xA9DB, 0x62DB)
+DOUBLE_BYTE_PAIR(0xA9DC, 0x62AB)
+DOUBLE_BYTE_PAIR(0xA9DD, 0x62D3)
+DOUBLE_BYTE_PAIR(0xA9DE, 0x62D4)
+DOUBLE_BYTE_PAIR(0xA9DF, 0x62CB)
+DOUBLE_BYTE_PAIR(0xA9E0, 0x62C8)
+DOUBLE_BYTE_PAIR(0xA9E1, 0x62A8)
+DOUBLE_BYTE_PAIR(0xA9E2, 0x62BD)
+DOUBLE_BYTE_PAIR(0xA9E3, 0x62BC)
+DOUBLE_BYTE_PAIR(0xA9E4, 0x62D0)
+DOUBLE_BYTE_PAIR(0xA9E5, 0x62D9)
+DOUBLE_BYTE_PAIR(0xA9E6, 0x62C7)
+DOUBLE_BYTE_PAIR(0xA9E7, 0x62CD)
+DOUBLE_BYTE_PAIR(0xA9E8, 0x62B5)
+DOUBLE_BYTE_PAIR(0xA9E9, 0x62DA)
+DOUBLE_BYTE_PAIR(0xA9EA, 0x62B1)
+DOUBLE_BYTE_PAIR(0xA9EB, 0x62D8)
+DOUBLE_BYTE_PAIR(0xA9EC, 0x62D6)
+DOUBLE_BYTE_PAIR(0xA9ED, 0x62D7)
+DOUBLE_BYTE_PAIR(0xA9EE, 0x62C6)
+DOUBLE_BYTE_PAIR(0xA9EF, 0x62AC)
+DOUBLE_BYTE_PAIR(0xA9F0, 0x62CE)
+DOUBLE_BYTE_PAIR(0xA9F1, 0x653E)
+DOUBLE_BYTE_PAIR(0xA9F2, 0x65A7)
+DOUBLE_BYTE_PAIR(0xA9F3, 0x65BC)
+DOUBLE_BYTE_PAIR(0xA9F4, 0x65FA)
+DOUBLE_BYTE_PAIR(0xA9F5, 0x6614)
+DOUBLE_BYTE_PAIR(0xA9F6, 0x6613)
+DOUBLE_BYTE_PAIR(0xA9F7, 0x660C)
+DOUBLE_BYTE_PAIR(0xA9F8, 0x6606)
+DOUBLE_BYTE_PAIR(0xA9F9, 0x6602)
+DOUBLE_BYTE_PAIR(0xA9FA, 0x660E)
+DOUBLE_BYTE_PAIR(0xA9FB, 0x6600)
+DOUBLE_BYTE_PAIR(0xA9FC, 0x660F)
+DOUBLE_BYTE_PAIR(0xA9FD, 0x6615)
+DOUBLE_BYTE_PAIR(0xA9FE, 0x660A)
+DOUBLE_BYTE_PAIR(0xAA40, 0x6607)
+DOUBLE_BYTE_PAIR(0xAA41, 0x670D)
+DOUBLE_BYTE_PAIR(0xAA42, 0x670B)
+DOUBLE_BYTE_PAIR(0xAA43, 0x676D)
+DOUBLE_BYTE_PAIR(0xAA44, 0x678B)
+DOUBLE_BYTE_PAIR(0xAA45, 0x6795)
+DOUBLE_BYTE_PAIR(0xAA46, 0x6771)
+DOUBLE_BYTE_PAIR(0xAA47, 0x679C)
+DOUBLE_BYTE_PAIR(0xAA48, 0x6773)
+DOUBLE_BYTE_PAIR(0xAA49, 0x6777)
+DOUBLE_BYTE_PAIR(0xAA4A, 0x6787)
+DOUBLE_BYTE_PAIR(0xAA4B, 0x679D)
+DOUBLE_BYTE_PAIR(0xAA4C, 0x6797)
+DOUBLE_BYTE_PAIR(0xAA4D, 0x676F)
+DOUBLE_BYTE_PAIR(0xAA4E, 0x6770)
+DOUBLE_BYTE_PAIR(0xAA4F, 0x677F)
+DOUBLE_BYTE_PAIR(0xAA50, 0x6789)
+DOUBLE_BYTE_PAIR(0xAA51, 0x677E)
+DOUBLE_BYTE_PAIR(0xAA52, 0x6790)
+DOUBLE_BYTE_PAIR(0xAA53, 0x6775)
+DOUBLE_BYTE_PAIR(0xAA54, 0x679A)
+DOUBLE_BYTE_PAIR(0xAA55, 0x6793)
+DOUBLE_BYTE_PAIR(0xAA56, 0x677C)
+DOUBLE_BYTE_PAIR(0xAA57, 0x676A)
+DOUBLE_BYTE_PAIR(0xAA58, 0x6772)
+DOUBLE_BYTE_PAIR(0xAA59, 0x6B23)
+DOUBLE_BYTE_PAIR(0xAA5A, 0x6B66)
+DOUBLE_BYTE_PAIR(0xAA5B, 0x6B67)
+DOUBLE_BYTE_PAIR(0xAA5C, 0x6B7F)
+DOUBLE_BYTE_PAIR(0xAA5D, 0x6C13)
+DOUBLE_BYTE_PAIR(0xAA5E, 0x6C1B)
+DOUBLE_BYTE_PAIR(0xAA5F, 0x6CE3)
+DOUBLE_BYTE_PAIR(0xAA60, 0x6CE8)
+DOUBLE_BYTE_PAIR(0xAA61, 0x6CF3)
+DOUBLE_BYTE_PAIR(0xAA62, 0x6CB1)
+DOUBLE_BYTE_PAIR(0xAA63, 0x6CCC)
+DOUBLE_BYTE_PAIR(0xAA64, 0x6CE5)
+DOUBLE_BYTE_PAIR(0xAA65, 0x6CB3)
+DOUBLE_BYTE_PAIR(0xAA66, 0x6CBD)
+DOUBLE_BYTE_PAIR(0xAA67, 0x6CBE)
+DOUBLE_BYTE_PAIR(0xAA68, 0x6CBC)
+DOUBLE_BYTE_PAIR(0xAA69, 0x6CE2)
+DOUBLE_BYTE_PAIR(0xAA6A, 0x6CAB)
+DOUBLE_BYTE_PAIR(0xAA6B, 0x6CD5)
+DOUBLE_BYTE_PAIR(0xAA6C, 0x6CD3)
+DOUBLE_BYTE_PAIR(0xAA6D, 0x6CB8)
+DOUBLE_BYTE_PAIR(0xAA6E, 0x6CC4)
+DOUBLE_BYTE_PAIR(0xAA6F, 0x6CB9)
+DOUBLE_BYTE_PAIR(0xAA70, 0x6CC1)
+DOUBLE_BYTE_PAIR(0xAA71, 0x6CAE)
+DOUBLE_BYTE_PAIR(0xAA72, 0x6CD7)
+DOUBLE_BYTE_PAIR(0xAA73, 0x6CC5)
+DOUBLE_BYTE_PAIR(0xAA74, 0x6CF1)
+DOUBLE_BYTE_PAIR(0xAA75, 0x6CBF)
+DOUBLE_BYTE_PAIR(0xAA76, 0x6CBB)
+DOUBLE_BYTE_PAIR(0xAA77, 0x6CE1)
+DOUBLE_BYTE_PAIR(0xAA78, 0x6CDB)
+DOUBLE_BYTE_PAIR(0xAA79, 0x6CCA)
+DOUBLE_BYTE_PAIR(0xAA7A, 0x6CAC)
+DOUBLE_BYTE_PAIR(0xAA7B, 0x6CEF)
+DOUBLE_BYTE_PAIR(0xAA7C, 0x6CDC)
+DOUBLE_BYTE_PAIR(0xAA7D, 0x6CD6)
+DOUBLE_BYTE_PAIR(0xAA7E, 0x6CE0)
+DOUBLE_BYTE_PAIR(0xAAA1, 0x7095)
+DOUBLE_BYTE_PAIR(0xAAA2, 0x708E)
+DOUBLE_BYTE_PAIR(0xAAA3, 0x7092)
+DOUBLE_BYTE_PAIR(0xAAA4, 0x708A)
+DOUBLE_BYTE_PAIR(0xAAA5, 0x7099)
+DOUBLE_BYTE_PAIR(0xAAA6, 0x722C)
+DOUBLE_BYTE_PAIR(0xAAA7, 0x722D)
+DOUBLE_BYTE_PAIR(0xAAA8, 0x7238)
+DOUBLE_BYTE_PAIR(0xAAA9, 0x7248)
+DOUBLE_BYTE_PAIR(0xAAAA, 0x7267)
+DOUBLE_BYTE_PAIR(0xAAAB, 0x7269)
+DOUBLE_BYTE_PAIR(0xAAAC, 0x72C0)
+DOUBLE_BYTE_PAIR(0xAAAD, 0x72CE)
+DOUBLE_BYTE_PAIR(0xAAAE, 0x72D9)
+DOUBLE_BYTE_PAIR(0xAAAF, 0x72D7)
+DOUBLE_BYTE_PAIR(0xAAB0, 0x72D0)
+DOUBLE_BYTE_PAIR(0xAAB1, 0x73A9)
+DOUBLE_BYTE_PAIR(0xAAB2, 0x73A8)
+DOUBLE_BYTE_PAIR(0xAAB3, 0x739F)
+DOUBLE_BYTE_PAIR(0xAAB4, 0x73AB)
+DOUBLE_BYTE_PAIR(0xAAB5, 0x73A5)
+DOUBLE_BYTE_PAIR(0xAAB6, 0x753D)
+DOUBLE_BYTE_PAIR(0xAAB7, 0x759D)
+DOUBLE_BYTE_PAIR(0xAAB8, 0x7599)
+DOUBLE_BYTE_PAIR(0xAAB9, 0x759A)
+DOUBLE_BYTE_PAIR(0xAABA, 0x7684)
+DOUBLE_BYTE_PAIR(0xAABB, 0x76C2)
+DOUBLE_BYTE_PAIR(0xAABC, 0x76F2)
+DOUBLE_BYTE_PAIR(0xAABD, 0x76F4)
+DOUBLE_BYTE_PAIR(0xAABE, 0x77E5)
+DOUBLE_BYTE_PAIR(0xAABF, 0x77FD)
+DOUBLE_BYTE_PAIR(0xAAC0, 0x793E)
+DOUBLE_BYTE_PAIR(0xAAC1, 0x7940)
+DOUBLE_BYTE_PAIR(0xAAC2, 0x7941)
+DOUBLE_BYTE_PAIR(0xAAC3, 0x79C9)
+DOUBLE_BYTE_PAIR(0xAAC4, 0x79C8)
+DOUBLE_BYTE_PAIR(0xAAC5, 0x7A7A)
+DOUBLE_BYTE_PAIR(0xAAC6, 0x7A79)
+DOUBLE_BYTE_PAIR(0xAAC7, 0x7AFA)
+DOUBLE_BYTE_PAIR(0xAAC8, 0x7CFE)
+DOUBLE_BYTE_PAIR(0xAAC9, 0x7F54)
+DOUBLE_BYTE_PAIR(0xAACA, 0x7F8C)
+DOUBLE_BYTE_PAIR(0xAACB, 0x7F8B)
+DOUBLE_BYTE_PAIR(0xAACC, 0x8005)
+DOUBLE_BYTE_PAIR(0xAACD, 0x80BA)
+DOUBLE_BYTE_PAIR(0xAACE, 0x80A5)
+DOUBLE_BYTE_PAIR(0xAACF, 0x80A2)
+DOUBLE_BYTE_PAIR(0xAAD0, 0x80B1)
+DOUBLE_BYTE_PAIR(0xAAD1, 0x80A1)
+DOUBLE_BYTE_PAIR(0xAAD2, 0x80AB)
+DOUBLE_BYTE_PAIR(0xAAD3, 0x80A9)
+DOUBLE_BYTE_PAIR(0xAAD4, 0x80B4)
+DOUBLE_BYTE_PAIR(0xAAD5, 0x80AA)
+DOUBLE_BYTE_PAIR(0xAAD6, 0x80AF)
+DOUBLE_BYTE_PAIR(0xAAD7, 0x81E5)
+DOUBLE_BYTE_PAIR(0xAAD8, 0x81FE)
+DOUBLE_BYTE_PAIR(0xAAD9, 0x820D)
+DOUBLE_BYTE_PAIR(0xAADA, 0x82B3)
+DOUBLE_BYTE_PAIR(0xAADB, 0x829D)
+DOUBLE_BYTE_PAIR(0xAADC, 0x8299)
+DOUBLE_BYTE_PAIR(0xAADD, 0x82AD)
+DOUBLE_BYTE_PAIR(0xAADE, 0x82BD)
+DOUBLE_BYTE_PAIR(0xAADF, 0x829F)
+DOUBLE_BYTE_PAIR(0xAAE0, 0x82B9)
+DOUBLE_BYTE_PAIR(0xAAE1, 0x82B1)
+DOUBLE_BYTE_PAIR(0xAAE2, 0x82AC)
+DOUBLE_BYTE_PAIR(0xAAE3, 0x82A5)
+DOUBLE_BYTE_PAIR(0xAAE4, 0x82AF)
+DOUBLE_BYTE_PAIR(0xAAE5, 0x82B8)
+DOUBLE_BYTE_PAIR(0xAAE6, 0x82A3)
+DOUBLE_BYTE_PAIR(0xAAE7, 0x82B0)
+DOUBLE_BYTE_PAIR(0xAAE8, 0x82BE)
+DOUBLE_BYTE_PAIR(0xAAE9, 0x82B7)
+DOUBLE_BYTE_PAIR(0xAAEA, 0x864E)
+DOUBLE_BYTE_PAIR(0xAAEB, 0x8671)
+DOUBLE_BYTE_PAIR(0xAAEC, 0x521D)
+DOUBLE_BYTE_PAIR(0xAAED, 0x8868)
+DOUBLE_BYTE_PAIR(0xAAEE, 0x8ECB)
+DOUBLE_BYTE_PAIR(0xAAEF, 0x8FCE)
+DOUBLE_BYTE_PAIR(0xAAF0, 0x8FD4)
+DOUBLE_BYTE_PAIR(0xAAF1, 0x8FD1)
+DOUBLE_BYTE_PAIR(0xAAF2, 0x90B5)
+DOUBLE_BYTE_PAIR(0xAAF3, 0x90B8)
+DOUBLE_BYTE_PAIR(0xAAF4, 0x90B1)
+DOUBLE_BYTE_PAIR(0xAAF5, 0x90B6)
+DOUBLE_BYTE_PAIR(0xAAF6, 0x91C7)
+DOUBLE_BYTE_PAIR(0xAAF7, 0x91D1)
+DOUBLE_BYTE_PAIR(0xAAF8, 0x9577)
+DOUBLE_BYTE_PAIR(0xAAF9, 0x9580)
+DOUBLE_BYTE_PAIR(0xAAFA, 0x961C)
+DOUBLE_BYTE_PAIR(0xAAFB, 0x9640)
+DOUBLE_BYTE_PAIR(0xAAFC, 0x963F)
+DOUBLE_BYTE_PAIR(0xAAFD, 0x963B)
+DOUBLE_BYTE_PAIR(0xAAFE, 0x9644)
+DOUBLE_BYTE_PAIR(0xAB40, 0x9642)
+DOUBLE_BYTE_PAIR(0xAB41, 0x96B9)
+DOUBLE_BYTE_PAIR(0xAB42, 0x96E8)
+DOUBLE_BYTE_PAIR(0xAB43, 0x9752)
+DOUBLE_BYTE_PAIR(0xAB44, 0x975E)
+DOUBLE_BYTE_PAIR(0xAB45, 0x4E9F)
+DOUBLE_BYTE_PAIR(0xAB46, 0x4EAD)
+DOUBLE_BYTE_PAIR(0xAB47, 0x4EAE)
+DOUBLE_BYTE_PAIR(0xAB48, 0x4FE1)
+DOUBLE_BYTE_PAIR(0xAB49, 0x4FB5)
+DOUBLE_BYTE_PAIR(0xAB4A, 0x4FAF)
+DOUBLE_BYTE_PAIR(0xAB4B, 0x4FBF)
+DOUBLE_BYTE_PAIR(0xAB4C, 0x4FE0)
+DOUBLE_BYTE_PAIR(0xAB4D, 0x4FD1)
+DOUBLE_BYTE_PAIR(0xAB4E, 0x4FCF)
+DOUBLE_BYTE_PAIR(0xAB4F, 0x4FDD)
+DOUBLE_BYTE_PAIR(0xAB50, 0x4FC3)
+DOUBLE_BYTE_PAIR(0xAB51, 0x4FB6)
+DOUBLE_BYTE_PAIR(0xAB52, 0x4FD8)
+DOUBLE_BYTE_PAIR(0xAB53, 0x4FDF)
+DOUBLE_BYTE_PAIR(0xAB54, 0x4FCA)
+DOUBLE_BYTE_PAIR(0xAB55, 0x4FD7)
+DOUBLE_BYTE_PAIR(0xAB56, 0x4FAE)
+DOUBLE_BYTE_PAIR(0xAB57, 0x4FD0)
+DOUBLE_BYTE_PAIR(0xAB58, 0x4FC4)
+DOUBLE_BYTE_PAIR(0xAB59, 0x4FC2)
+DOUBLE_BYTE_PAIR(0xAB5A, 0x4FDA)
+DOUBLE_BYTE_PAIR(0xAB5B, 0x4FCE)
+DOUBLE_BYTE_PAIR(0xAB5C, 0x4FDE)
+DOUBLE_BYTE_PAIR(0xAB5D, 0x4FB7)
+DOUBLE_BYTE_PAIR(0xAB5E, 0x5157)
+DOUBLE_BYTE_PAIR(0xAB5F, 0x5192)
+DOUBLE_BYTE_PAIR(0xAB60, 0x5191)
+DOUBLE_BYTE_PAIR(0xAB61, 0x51A0)
+DOUBLE_BYTE_PAIR(0xAB62, 0x524E)
+DOUBLE_BYTE_PAIR(0xAB63, 0x5243)
+DOUBLE_BYTE_PAIR(0xAB64, 0x524A)
+DOUBLE_BYTE_PAIR(0xAB65, 0x524D)
+DOUBLE_BYTE_PAIR(0xAB66, 0x524C)
+DOUBLE_BYTE_PAIR(0xAB67, 0x524B)
+DOUBLE_BYTE_PAIR(0xAB68, 0x5247)
+DOUBLE_BYTE_PAIR(0xAB69, 0x52C7)
+DOUBLE_BYTE_PAIR(0xAB6A, 0x52C9)
+DOUBLE_BYTE_PAIR(0xAB6B, 0x52C3)
+DOUBLE_BYTE_PAIR(0xAB6C, 0x52C1)
+DOUBLE_BYTE_PAIR(0xAB6D, 0x530D)
+DOUBLE_BYTE_PAIR(0xAB6E, 0x5357)
+DOUBLE_BYTE_PAIR(0xAB6F, 0x537B)
+DOUBLE_BYTE_PAIR(0xAB70, 0x539A)
+DOUBLE_BYTE_PAIR(0xAB71, 0x53DB)
+DOUBLE_BYTE_PAIR(0xAB72, 0x54AC)
+DOUBLE_BYTE_PAIR(0xAB73, 0x54C0)
+DOUBLE_BYTE_PAIR(0xAB74, 0x54A8)
+DOUBLE_BYTE_PAIR(0xAB75, 0x54CE)
+DOUBLE_BYTE_PAIR(0xAB76, 0x54C9)
+DOUBLE_BYTE_PAIR(0xAB77, 0x54B8)
+DOUBLE_BYTE_PAIR(0xAB78, 0x54A6)
+DOUBLE_BYTE_PAIR(0xAB79, 0x54B3)
+DOUBLE_BYTE_PAIR(0xAB7A, 0x54C7)
+DOUBLE_BYTE_PAIR(0xAB7B, 0x54C2)
+DOUBLE_BYTE_PAIR(0xAB7C, 0x54BD)
+DOUBLE_BYTE_PAIR(0xAB7D, 0x54AA)
+DOUBLE_BYTE_PAIR(0xAB7E, 0x54C1)
+DOUBLE_BYTE_PAIR(0xABA1, 0x54C4)
+DOUBLE_BYTE_PAIR(0xABA2, 0x54C8)
+DOUBLE_BYTE_PAIR(0xABA3, 0x54AF)
+DOUBLE_BYTE_PAIR(0xABA4, 0x54AB)
+DOUBLE_BYTE_PAIR(0xABA5, 0x54B1)
+DOUBLE_BYTE_PAIR(0xABA6, 0x54BB)
+DOUBLE_BYTE_PAIR(0xABA7, 0x54A9)
+DOUBLE_BYTE_PAIR(0xABA8, 0x54A7)
+DOUBLE_BYTE_PAIR(0xABA9, 0x54BF)
+DOUBLE_BYTE_PAIR(0xABAA, 0x56FF)
+DOUBLE_BYTE_PAIR(0xABAB, 0x5782)
+DOUBLE_BYTE_PAIR(0xABAC, 0x578B)
+DOUBLE_BYTE_PAIR(0xABAD, 0x57A0)
+DOUBLE_BYTE_PAIR(0xABAE, 0x57A3)
+DOUBLE_BYTE_PAIR(0xABAF, 0x57A2)
+DOUBLE_BYTE_PAIR(0xABB0, 0x57CE)
+DOUBLE_BYTE_PAIR(0xABB1, 0x57AE)
+DOUBLE_BYTE_PAIR(0xABB2, 0x5793)
+DOUBLE_BYTE_PAIR(0xABB3, 0x5955)
+DOUBLE_BYTE_PAIR(0xABB4, 0x5951)
+DOUBLE_BYTE_PAIR(0xABB5, 0x594F)
+DOUBLE_BYTE_PAIR(0xABB6, 0x594E)
+DOUBLE_BYTE_PAIR(0xABB7, 0x5950)
+DOUBLE_BYTE_PAIR(0xABB8, 0x59DC)
+DOUBLE_BYTE_PAIR(0xABB9, 0x59D8)
+DOUBLE_BYTE_PAIR(0xABBA, 0x59FF)
+DOUBLE_BYTE_PAIR(0xABBB, 0x59E3)
+DOUBLE_BYTE_PAIR(0xABBC, 0x59E8)
+DOUBLE_BYTE_PAIR(0xABBD, 0x5A03)
+DOUBLE_BYTE_PAIR(0xABBE, 0x59E5)
+DOUBLE_BYTE_PAIR(0xABBF, 0x59EA)
+DOUBLE_BYTE_PAIR(0xABC0, 0x59DA)
+DOUBLE_BYTE_PAIR(0xABC1, 0x59E6)
+DOUBLE_BYTE_PAIR(0xABC2, 0x5A01)
+DOUBLE_BYTE_PAIR(0xABC3, 0x59FB)
+DOUBLE_BYTE_PAIR(0xABC4, 0x5B69)
+DOUBLE_BYTE_PAIR(0xABC5, 0x5BA3)
+DOUBLE_BYTE_PAIR(0xABC6, 0x5BA6)
+DOUBLE_BYTE_PAIR(0xABC7, 0x5BA4)
+DOUBLE_BYTE_PAIR(0xABC8, 0x5BA2)
+DOUBLE_BYTE_PAIR(0xABC9, 0x5BA5)
+DOUBLE_BYTE_PAIR(0xABCA, 0x5C01)
+DOUBLE_BYTE_PAIR(0xABCB, 0x5C4E)
+DOUBLE_BYTE_PAIR(0xABCC, 0x5C4F)
+DOUBLE_BYTE_PAIR(0xABCD, 0x5C4D)
+DOUBLE_BYTE_PAIR(0xABCE, 0x5C4B)
+DOUBLE_BYTE_PAIR(0xABCF, 0x5CD9)
+DOUBLE_BYTE_PAIR(0xABD0, 0x5CD2)
+DOUBLE_BYTE_PAIR(0xABD1, 0x5DF7)
+DOUBLE_BYTE_PAIR(0xABD2, 0x5E1D)
+DOUBLE_BYTE_PAIR(0xABD3, 0x5E25)
+DOUBLE_BYTE_PAIR(0xABD4, 0x5E1F)
+DOUBLE_BYTE_PAIR(0xABD5, 0x5E7D)
+DOUBLE_BYTE_PAIR(0xABD6, 0x5EA0)
+DOUBLE_BYTE_PAIR(0xABD7, 0x5EA6)
+DOUBLE_BYTE_PAIR(0xABD8, 0x5EFA)
+DOUBLE_BYTE_PAIR(0xABD9, 0x5F08)
+DOUBLE_BYTE_PAIR(0xABDA, 0x5F2D)
+DOUBLE_BYTE_PAIR(0xABDB, 0x5F65)
+DOUBLE_BYTE_PAIR(0xABDC, 0x5F88)
+DOUBLE_BYTE_PAIR(0xABDD, 0x5F85)
+DOUBLE_BYTE_PAIR(0xABDE, 0x5F8A)
+DOUBLE_BYTE_PAIR(0xABDF, 0x5F8B)
+DOUBLE_BYTE_PAIR(0xABE0, 0x5F87)
+DOUBLE_BYTE_PAIR(0xABE1, 0x5F8C)
+DOUBLE_BYTE_PAIR(0xABE2, 0x5F89)
+DOUBLE_BYTE_PAIR(0xABE3, 0x6012)
+DOUBLE_BYTE_PAIR(0xABE4, 0x601D)
+DOUBLE_BYTE_PAIR(0xABE5, 0x6020)
+DOUBLE_BYTE_PAIR(0xABE6, 0x6025)
+DOUBLE_BYTE_PAIR(0xABE7, 0x600E)
+DOUBLE_BYTE_PAIR(0xABE8, 0x6028)
+DOUBLE_BYTE_PAIR(0xABE9, 0x604D)
+DOUBLE_BYTE_PAIR(0xABEA, 0x6070)
+DOUBLE_BYTE_PAIR(0xABEB, 0x6068)
+DOUBLE_BYTE_PAIR(0xABEC, 0x6062)
+DOUBLE_BYTE_PAIR(0xABED, 0x6046)
+DOUBLE_BYTE_PAIR(0xABEE, 0x6043)
+DOUBLE_BYTE_PAIR(0xABEF, 0x606C)
+DOUBLE_BYTE_PAIR(0xABF0, 0x606B)
+DOUBLE_BYTE_PAIR(0xABF1, 0x606A)
+DOUBLE_BYTE_PAIR(0xABF2, 0x6064)
+DOUBLE_BYTE_PAIR(0xABF3, 0x6241)
+DOUBLE_BYTE_PAIR(0xABF4, 0x62DC)
+DOUBLE_BYTE_PAIR(0xABF5, 0x6316)
+DOUBLE_BYTE_PAIR(0xABF6, 0x6309)
+DOUBLE_BYTE_PAIR(0xABF7, 0x62FC)
+DOUBLE_BYTE_PAIR(0xABF8, 0x62ED)
+DOUBLE_BYTE_PAIR(0xABF9, 0x6301)
+DOUBLE_BYTE_PAIR(0xABFA, 0x62EE)
+DOUBLE_BYTE_PAIR(0xABFB, 0x62FD)
+DOUBLE_BYTE_PAIR(0xABFC, 0x6307)
+DOUBLE_BYTE_PAIR(0xABFD, 0x62F1)
+DOUBLE_BYTE_PAIR(0xABFE, 0x62F7)
+DOUBLE_BYTE_PAIR(0xAC40, 0x62EF)
+DOUBLE_BYTE_PAIR(0xAC41, 0x62EC)
+DOUBLE_BYTE_PAIR(0xAC42, 0x62FE)
+DOUBLE_BYTE_PAIR(0xAC43, 0x62F4)
+DOUBLE_BYTE_PAIR(0xAC44, 0x6311)
+DOUBLE_BYTE_PAIR(0xAC45, 0x6302)
+DOUBLE_BYTE_PAIR(0xAC46, 0x653F)
+DOUBLE_BYTE_PAIR(0xAC47, 0x6545)
+DOUBLE_BYTE_PAIR(0xAC48, 0x65AB)
+DOUBLE_BYTE_PAIR(0xAC49, 0x65BD)
+DOUBLE_BYTE_PAIR(0xAC4A, 0x65E2)
+DOUBLE_BYTE_PAIR(0xAC4B, 0x6625)
+DOUBLE_BYTE_PAIR(0xAC4C, 0x662D)
+DOUBLE_BYTE_PAIR(0xAC4D, 0x6620)
+DOUBLE_BYTE_PAIR(0xAC4E, 0x6627)
+DOUBLE_BYTE_PAIR(0xAC4F, 0x662F)
+DOUBLE_BYTE_PAIR(0xAC50, 0x661F)
+DOUBLE_BYTE_PAIR(0xAC51, 0x6628)
+DOUBLE_BYTE_PAIR(0xAC52, 0x6631)
+DOUBLE_BYTE_PAIR(0xAC53, 0x6624)
+DOUBLE_BYTE_PAIR(0xAC54, 0x66F7)
+DOUBLE_BYTE_PAIR(0xAC55, 0x67FF)
+DOUBLE_BYTE_PAIR(0xAC56, 0x67D3)
+DOUBLE_BYTE_PAIR(0xAC57, 0x67F1)
+DOUBLE_BYTE_PAIR(0xAC58, 0x67D4)
+DOUBLE_BYTE_PAIR(0xAC59, 0x67D0)
+DOUBLE_BYTE_PAIR(0xAC5A, 0x67EC)
+DOUBLE_BYTE_PAIR(0xAC5B, 0x67B6)
+DOUBLE_BYTE_PAIR(0xAC5C, 0x67AF)
+DOUBLE_BYTE_PAIR(0xAC5D, 0x67F5)
+DOUBLE_BYTE_PAIR(0xAC5E, 0x67E9)
+DOUBLE_BYTE_PAIR(0xAC5F, 0x67EF)
+DOUBLE_BYTE_PAIR(0xAC60, 0x67C4)
+DOUBLE_BYTE_PAIR(0xAC61, 0x67D1)
+DOUBLE_BYTE_PAIR(0xAC62, 0x67B4)
+DOUBLE_BYTE_PAIR(0xAC63, 0x67DA)
+DOUBLE_BYTE_PAIR(0xAC64, 0x67E5)
+DOUBLE_BYTE_PAIR(0xAC65, 0x67B8)
+DOUBLE_BYTE_PAIR(0xAC66, 0x67CF)
+DOUBLE_BYTE_PAIR(0xAC67, 0x67DE)
+DOUBLE_BYTE_PAIR(0xAC68, 0x67F3)
+DOUBLE_BYTE_PAIR(0xAC69, 0x67B0)
+DOUBLE_BYTE_PAIR(0xAC6A, 0x67D9)
+DOUBLE_BYTE_PAIR(0xAC6B, 0x67E2)
+DOUBLE_BYTE_PAIR(0xAC6C, 0x67DD)
+DOUBLE_BYTE_PAIR(0xAC6D, 0x67D2)
+DOUBLE_BYTE_PAIR(0xAC6E, 0x6B6A)
+DOUBLE_BYTE_PAIR(0xAC6F, 0x6B83)
+DOUBLE_BYTE_PAIR(0xAC70, 0x6B86)
+DOUBLE_BYTE_PAIR(0xAC71, 0x6BB5)
+DOUBLE_BYTE_PAIR(0xAC72, 0x6BD2)
+DOUBLE_BYTE_PAIR(0xAC73, 0x6BD7)
+DOUBLE_BYTE_PAIR(0xAC74, 0x6C1F)
+DOUBLE_BYTE_PAIR(0xAC75, 0x6CC9)
+DOUBLE_BYTE_PAIR(0xAC76, 0x6D0B)
+DOUBLE_BYTE_PAIR(0xAC77, 0x6D32)
+DOUBLE_BYTE_PAIR(0xAC78, 0x6D2A)
+DOUBLE_BYTE_PAIR(0xAC79, 0x6D41)
+DOUBLE_BYTE_PAIR(0xAC7A, 0x6D25)
+DOUBLE_BYTE_PAIR(0xAC7B, 0x6D0C)
+DOUBLE_BYTE_PAIR(0xAC7C, 0x6D31)
+DOUBLE_BYTE_PAIR(0xAC7D, 0x6D1E)
+DOUBLE_BYTE_PAIR(0xAC7E, 0x6D17)
+DOUBLE_BYTE_PAIR(0xACA1, 0x6D3B)
+DOUBLE_BYTE_PAIR(0xACA2, 0x6D3D)
+DOUBLE_BYTE_PAIR(0xACA3, 0x6D3E)
+DOUBLE_BYTE_PAIR(0xACA4, 0x6D36)
+DOUBLE_BYTE_PAIR(0xACA5, 0x6D1B)
+DOUBLE_BYTE_PAIR(0xACA6, 0x6CF5)
+DOUBLE_BYTE_PAIR(0xACA7, 0x6D39)
+DOUBLE_BYTE_PAIR(0xACA8, 0x6D27)
+DOUBLE_BYTE_PAIR(0xACA9, 0x6D38)
+DOUBLE_BYTE_PAIR(0xACAA, 0x6D29)
+DOUBLE_BYTE_PAIR(0xACAB, 0x6D2E)
+DOUBLE_BYTE_PAIR(0xACAC, 0x6D35)
+DOUBLE_BYTE_PAIR(0xACAD, 0x6D0E)
+DOUBLE_BYTE_PAIR(0xACAE, 0x6D2B)
+DOUBLE_BYTE_PAIR(0xACAF, 0x70AB)
+DOUBLE_BYTE_PAIR(0xACB0, 0x70BA)
+DOUBLE_BYTE_PAIR(0xACB1, 0x70B3)
+DOUBLE_BYTE_PAIR(0xACB2, 0x70AC)
+DOUBLE_BYTE_PAIR(0xACB3, 0x70AF)
+DOUBLE_BYTE_PAIR(0xACB4, 0x70AD)
+DOUBLE_BYTE_PAIR(0xACB5, 0x70B8)
+DOUBLE_BYTE_PAIR(0xACB6, 0x70AE)
+DOUBLE_BYTE_PAIR(0xACB7, 0x70A4)
+DOUBLE_BYTE_PAIR(0xACB8, 0x7230)
+DOUBLE_BYTE_PAIR(0xACB9, 0x7272)
+DOUBLE_BYTE_PAIR(0xACBA, 0x726F)
+DOUBLE_BYTE_PAIR(0xACBB, 0x7274)
+DOUBLE_BYTE_PAIR(0xACBC, 0x72E9)
+DOUBLE_BYTE_PAIR(0xACBD, 0x72E0)
+DOUBLE_BYTE_PAIR(0xACBE, 0x72E1)
+DOUBLE_BYTE_PAIR(0xACBF, 0x73B7)
+DOUBLE_BYTE_PAIR(0xACC0, 0x73CA)
+DOUBLE_BYTE_PAIR(0xACC1, 0x73BB)
+DOUBLE_BYTE_PAIR(0xACC2, 0x73B2)
+DOUBLE_BYTE_PAIR(0xACC3, 0x73CD)
+DOUBLE_BYTE_PAIR(0xACC4, 0x73C0)
+DOUBLE_BYTE_PAIR(0xACC5, 0x73B3)
+DOUBLE_BYTE_PAIR(0xACC6, 0x751A)
+DOUBLE_BYTE_PAIR(0xACC7, 0x752D)
+DOUBLE_BYTE_PAIR(0xACC8, 0x754F)
+DOUBLE_BYTE_PAIR(0xACC9, 0x754C)
+DOUBLE_BYTE_PAIR(0xACCA, 0x754E)
+DOUBLE_BYTE_PAIR(0xACCB, 0x754B)
+DOUBLE_BYTE_PAIR(0xACCC, 0x75AB)
+DOUBLE_BYTE_PAIR(0xACCD, 0x75A4)
+DOUBLE_BYTE_PAIR(0xACCE, 0x75A5)
+DOUBLE_BYTE_PAIR(0xACCF, 0x75A2)
+DOUBLE_BYTE_PAIR(0xACD0, 0x75A3)
+DOUBLE_BYTE_PAIR(0xACD1, 0x7678)
+DOUBLE_BYTE_PAIR(0xACD2, 0x7686)
+DOUBLE_BYTE_PAIR(0xACD3, 0x7687)
+DOUBLE_BYTE_PAIR(0xACD4, 0x7688)
+DOUBLE_BYTE_PAIR(0xACD5, 0x76C8)
+DOUBLE_BYTE_PAIR(0xACD6, 0x76C6)
+DOUBLE_BYTE_PAIR(0xACD7, 0x76C3)
+DOUBLE_BYTE_PAIR(0xACD8, 0x76C5)
+DOUBLE_BYTE_PAIR(0xACD9, 0x7701)
+DOUBLE_BYTE_PAIR(0xACDA, 0x76F9)
+DOUBLE_BYTE_PAIR(0xACDB, 0x76F8)
+DOUBLE_BYTE_PAIR(0xACDC, 0x7709)
+DOUBLE_BYTE_PAIR(0xACDD, 0x770B)
+DOUBLE_BYTE_PAIR(0xACDE, 0x76FE)
+DOUBLE_BYTE_PAIR(0xACDF, 0x76FC)
+DOUBLE_BYTE_PAIR(0xACE0, 0x7707)
+DOUBLE_BYTE_PAIR(0xACE1, 0x77DC)
+DOUBLE_BYTE_PAIR(0xACE2, 0x7802)
+DOUBLE_BYTE_PAIR(0xACE3, 0x7814)
+DOUBLE_BYTE_PAIR(0xACE4, 0x780C)
+DOUBLE_BYTE_PAIR(0xACE5, 0x780D)
+DOUBLE_BYTE_PAIR(0xACE6, 0x7946)
+DOUBLE_BYTE_PAIR(0xACE7, 0x7949)
+DOUBLE_BYTE_PAIR(0xACE8, 0x7948)
+DOUBLE_BYTE_PAIR(0xACE9, 0x7947)
+DOUBLE_BYTE_PAIR(0xACEA, 0x79B9)
+DOUBLE_BYTE_PAIR(0xACEB, 0x79BA)
+DOUBLE_BYTE_PAIR(0xACEC, 0x79D1)
+DOUBLE_BYTE_PAIR(0xACED, 0x79D2)
+DOUBLE_BYTE_PAIR(0xACEE, 0x79CB)
+DOUBLE_BYTE_PAIR(0xACEF, 0x7A7F)
+DOUBLE_BYTE_PAIR(0xACF0, 0x7A81)
+DOUBLE_BYTE_PAIR(0xACF1, 0x7AFF)
+DOUBLE_BYTE_PAIR(0xACF2, 0x7AFD)
+DOUBLE_BYTE_PAIR(0xACF3, 0x7C7D)
+DOUBLE_BYTE_PAIR(0xACF4, 0x7D02)
+DOUBLE_BYTE_PAIR(0xACF5, 0x7D05)
+DOUBLE_BYTE_PAIR(0xACF6, 0x7D00)
+DOUBLE_BYTE_PAIR(0xACF7, 0x7D09)
+DOUBLE_BYTE_PAIR(0xACF8, 0x7D07)
+DOUBLE_BYTE_PAIR(0xACF9, 0x7D04)
+DOUBLE_BYTE_PAIR(0xACFA, 0x7D06)
+DOUBLE_BYTE_PAIR(0xACFB, 0x7F38)
+DOUBLE_BYTE_PAIR(0xACFC, 0x7F8E)
+DOUBLE_BYTE_PAIR(0xACFD, 0x7FBF)
+DOUBLE_BYTE_PAIR(0xACFE, 0x8004)
+DOUBLE_BYTE_PAIR(0xAD40, 0x8010)
+DOUBLE_BYTE_PAIR(0xAD41, 0x800D)
+DOUBLE_BYTE_PAIR(0xAD42, 0x8011)
+DOUBLE_BYTE_PAIR(0xAD43, 0x8036)
+DOUBLE_BYTE_PAIR(0xAD44, 0x80D6)
+DOUBLE_BYTE_PAIR(0xAD45, 0x80E5)
+DOUBLE_BYTE_PAIR(0xAD46, 0x80DA)
+DOUBLE_BYTE_PAIR(0xAD47, 0x80C3)
+DOUBLE_BYTE_PAIR(0xAD48, 0x80C4)
+DOUBLE_BYTE_PAIR(0xAD49, 0x80CC)
+DOUBLE_BYTE_PAIR(0xAD4A, 0x80E1)
+DOUBLE_BYTE_PAIR(0xAD4B, 0x80DB)
+DOUBLE_BYTE_PAIR(0xAD4C, 0x80CE)
+DOUBLE_BYTE_PAIR(0xAD4D, 0x80DE)
+DOUBLE_BYTE_PAIR(0xAD4E, 0x80E4)
+DOUBLE_BYTE_PAIR(0xAD4F, 0x80DD)
+DOUBLE_BYTE_PAIR(0xAD50, 0x81F4)
+DOUBLE_BYTE_PAIR(0xAD51, 0x8222)
+DOUBLE_BYTE_PAIR(0xAD52, 0x82E7)
+DOUBLE_BYTE_PAIR(0xAD53, 0x8303)
+DOUBLE_BYTE_PAIR(0xAD54, 0x8305)
+DOUBLE_BYTE_PAIR(0xAD55, 0x82E3)
+DOUBLE_BYTE_PAIR(0xAD56, 0x82DB)
+DOUBLE_BYTE_PAIR(0xAD57, 0x82E6)
+DOUBLE_BYTE_PAIR(0xAD58, 0x8304)
+DOUBLE_BYTE_PAIR(0xAD59, 0x82E5)
+DOUBLE_BYTE_PAIR(0xAD5A, 0x8302)
+DOUBLE_BYTE_PAIR(0xAD5B, 0x8309)
+DOUBLE_BYTE_PAIR(0xAD5C, 0x82D2)
+DOUBLE_BYTE_PAIR(0xAD5D, 0x82D7)
+DOUBLE_BYTE_PAIR(0xAD5E, 0x82F1)
+DOUBLE_BYTE_PAIR(0xAD5F, 0x8301)
+DOUBLE_BYTE_PAIR(0xAD60, 0x82DC)
+DOUBLE_BYTE_PAIR(0xAD61, 0x82D4)
+DOUBLE_BYTE_PAIR(0xAD62, 0x82D1)
+DOUBLE_BYTE_PAIR(0xAD63, 0x82DE)
+DOUBLE_BYTE_PAIR(0xAD64, 0x82D3)
+DOUBLE_BYTE_PAIR(0xAD65, 0x82DF)
+DOUBLE_BYTE_PAIR(0xAD66, 0x82EF)
+DOUBLE_BYTE_PAIR(0xAD67, 0x8306)
+DOUBLE_BYTE_PAIR(0xAD68, 0x8650)
+DOUBLE_BYTE_PAIR(0xAD69, 0x8679)
+DOUBLE_BYTE_PAIR(0xAD6A, 0x867B)
+DOUBLE_BYTE_PAIR(0xAD6B, 0x867A)
+DOUBLE_BYTE_PAIR(0xAD6C, 0x884D)
+DOUBLE_BYTE_PAIR(0xAD6D, 0x886B)
+DOUBLE_BYTE_PAIR(0xAD6E, 0x8981)
+DOUBLE_BYTE_PAIR(0xAD6F, 0x89D4)
+DOUBLE_BYTE_PAIR(0xAD70, 0x8A08)
+DOUBLE_BYTE_PAIR(0xAD71, 0x8A02)
+DOUBLE_BYTE_PAIR(0xAD72, 0x8A03)
+DOUBLE_BYTE_PAIR(0xAD73, 0x8C9E)
+DOUBLE_BYTE_PAIR(0xAD74, 0x8CA0)
+DOUBLE_BYTE_PAIR(0xAD75, 0x8D74)
+DOUBLE_BYTE_PAIR(0xAD76, 0x8D73)
+DOUBLE_BYTE_PAIR(0xAD77, 0x8DB4)
+DOUBLE_BYTE_PAIR(0xAD78, 0x8ECD)
+DOUBLE_BYTE_PAIR(0xAD79, 0x8ECC)
+DOUBLE_BYTE_PAIR(0xAD7A, 0x8FF0)
+DOUBLE_BYTE_PAIR(0xAD7B, 0x8FE6)
+DOUBLE_BYTE_PAIR(0xAD7C, 0x8FE2)
+DOUBLE_BYTE_PAIR(0xAD7D, 0x8FEA)
+DOUBLE_BYTE_PAIR(0xAD7E, 0x8FE5)
+DOUBLE_BYTE_PAIR(0xADA1, 0x8FED)
+DOUBLE_BYTE_PAIR(0xADA2, 0x8FEB)
+DOUBLE_BYTE_PAIR(0xADA3, 0x8FE4)
+DOUBLE_BYTE_PAIR(0xADA4, 0x8FE8)
+DOUBLE_BYTE_PAIR(0xADA5, 0x90CA)
+DOUBLE_BYTE_PAIR(0xADA6, 0x90CE)
+DOUBLE_BYTE_PAIR(0xADA7, 0x90C1)
+DOUBLE_BYTE_PAIR(0xADA8, 0x90C3)
+DOUBLE_BYTE_PAIR(0xADA9, 0x914B)
+DOUBLE_BYTE_PAIR(0xADAA, 0x914A)
+DOUBLE_BYTE_PAIR(0xADAB, 0x91CD)
+DOUBLE_BYTE_PAIR(0xADAC, 0x9582)
+DOUBLE_BYTE_PAIR(0xADAD, 0x9650)
+DOUBLE_BYTE_PAIR(0xADAE, 0x964B)
+DOUBLE_BYTE_PAIR(0xADAF, 0x964C)
+DOUBLE_BYTE_PAIR(0xADB0, 0x964D)
+DOUBLE_BYTE_PAIR(0xADB1, 0x9762)
+DOUBLE_BYTE_PAIR(0xADB2, 0x9769)
+DOUBLE_BYTE_PAIR(0xADB3, 0x97CB)
+DOUBLE_BYTE_PAIR(0xADB4, 0x97ED)
+DOUBLE_BYTE_PAIR(0xADB5, 0x97F3)
+DOUBLE_BYTE_PAIR(0xADB6, 0x9801)
+DOUBLE_BYTE_PAIR(0xADB7, 0x98A8)
+DOUBLE_BYTE_PAIR(0xADB8, 0x98DB)
+DOUBLE_BYTE_PAIR(0xADB9, 0x98DF)
+DOUBLE_BYTE_PAIR(0xADBA, 0x9996)
+DOUBLE_BYTE_PAIR(0xADBB, 0x9999)
+DOUBLE_BYTE_PAIR(0xADBC, 0x4E58)
+DOUBLE_BYTE_PAIR(0xADBD, 0x4EB3)
+DOUBLE_BYTE_PAIR(0xADBE, 0x500C)
+DOUBLE_BYTE_PAIR(0xADBF, 0x500D)
+DOUBLE_BYTE_PAIR(0xADC0, 0x5023)
+DOUBLE_BYTE_PAIR(0xADC1, 0x4FEF)
+DOUBLE_BYTE_PAIR(0xADC2, 0x5026)
+DOUBLE_BYTE_PAIR(0xADC3, 0x5025)
+DOUBLE_BYTE_PAIR(0xADC4, 0x4FF8)
+DOUBLE_BYTE_PAIR(0xADC5, 0x5029)
+DOUBLE_BYTE_PAIR(0xADC6, 0x5016)
+DOUBLE_BYTE_PAIR(0xADC7, 0x5006)
+DOUBLE_BYTE_PAIR(0xADC8, 0x503C)
+DOUBLE_BYTE_PAIR(0xADC9, 0x501F)
+DOUBLE_BYTE_PAIR(0xADCA, 0x501A)
+DOUBLE_BYTE_PAIR(0xADCB, 0x5012)
+DOUBLE_BYTE_PAIR(0xADCC, 0x5011)
+DOUBLE_BYTE_PAIR(0xADCD, 0x4FFA)
+DOUBLE_BYTE_PAIR(0xADCE, 0x5000)
+DOUBLE_BYTE_PAIR(0xADCF, 0x5014)
+DOUBLE_BYTE_PAIR(0xADD0, 0x5028)
+DOUBLE_BYTE_PAIR(0xADD1, 0x4FF1)
+DOUBLE_BYTE_PAIR(0xADD2, 0x5021)
+DOUBLE_BYTE_PAIR(0xADD3, 0x500B)
+DOUBLE_BYTE_PAIR(0xADD4, 0x5019)
+DOUBLE_BYTE_PAIR(0xADD5, 0x5018)
+DOUBLE_BYTE_PAIR(0xADD6, 0x4FF3)
+DOUBLE_BYTE_PAIR(0xADD7, 0x4FEE)
+DOUBLE_BYTE_PAIR(0xADD8, 0x502D)
+DOUBLE_BYTE_PAIR(0xADD9, 0x502A)
+DOUBLE_BYTE_PAIR(0xADDA, 0x4FFE)
+DOUBLE_BYTE_PAIR(0xADDB, 0x502B)
+DOUBLE_BYTE_PAIR(0xADDC, 0x5009)
+DOUBLE_BYTE_PAIR(0xADDD, 0x517C)
+DOUBLE_BYTE_PAIR(0xADDE, 0x51A4)
+DOUBLE_BYTE_PAIR(0xADDF, 0x51A5)
+DOUBLE_BYTE_PAIR(0xADE0, 0x51A2)
+DOUBLE_BYTE_PAIR(0xADE1, 0x51CD)
+DOUBLE_BYTE_PAIR(0xADE2, 0x51CC)
+DOUBLE_BYTE_PAIR(0xADE3, 0x51C6)
+DOUBLE_BYTE_PAIR(0xADE4, 0x51CB)
+DOUBLE_BYTE_PAIR(0xADE5, 0x5256)
+DOUBLE_BYTE_PAIR(0xADE6, 0x525C)
+DOUBLE_BYTE_PAIR(0xADE7, 0x5254)
+DOUBLE_BYTE_PAIR(0xADE8, 0x525B)
+DOUBLE_BYTE_PAIR(0xADE9, 0x525D)
+DOUBLE_BYTE_PAIR(0xADEA, 0x532A)
+DOUBLE_BYTE_PAIR(0xADEB, 0x537F)
+DOUBLE_BYTE_PAIR(0xADEC, 0x539F)
+DOUBLE_BYTE_PAIR(0xADED, 0x539D)
+DOUBLE_BYTE_PAIR(0xADEE, 0x53DF)
+DOUBLE_BYTE_PAIR(0xADEF, 0x54E8)
+DOUBLE_BYTE_PAIR(0xADF0, 0x5510)
+DOUBLE_BYTE_PAIR(0xADF1, 0x5501)
+DOUBLE_BYTE_PAIR(0xADF2, 0x5537)
+DOUBLE_BYTE_PAIR(0xADF3, 0x54FC)
+DOUBLE_BYTE_PAIR(0xADF4, 0x54E5)
+DOUBLE_BYTE_PAIR(0xADF5, 0x54F2)
+DOUBLE_BYTE_PAIR(0xADF6, 0x5506)
+DOUBLE_BYTE_PAIR(0xADF7, 0x54FA)
+DOUBLE_BYTE_PAIR(0xADF8, 0x5514)
+DOUBLE_BYTE_PAIR(0xADF9, 0x54E9)
+DOUBLE_BYTE_PAIR(0xADFA, 0x54ED)
+DOUBLE_BYTE_PAIR(0xADFB, 0x54E1)
+DOUBLE_BYTE_PAIR(0xADFC, 0x5509)
+DOUBLE_BYTE_PAIR(0xADFD, 0x54EE)
+DOUBLE_BYTE_PAIR(0xADFE, 0x54EA)
+DOUBLE_BYTE_PAIR(0xAE40, 0x54E6)
+DOUBLE_BYTE_PAIR(0xAE41, 0x5527)
+DOUBLE_BYTE_PAIR(0xAE42, 0x5507)
+DOUBLE_BYTE_PAIR(0xAE43, 0x54FD)
+DOUBLE_BYTE_PAIR(0xAE44, 0x550F)
+DOUBLE_BYTE_PAIR(0xAE45, 0x5703)
+DOUBLE_BYTE_PAIR(0xAE46, 0x5704)
+DOUBLE_BYTE_PAIR(0xAE47, 0x57C2)
+DOUBLE_BYTE_PAIR(0xAE48, 0x57D4)
+DOUBLE_BYTE_PAIR(0xAE49, 0x57CB)
+DOUBLE_BYTE_PAIR(0xAE4A, 0x57C3)
+DOUBLE_BYTE_PAIR(0xAE4B, 0x5809)
+DOUBLE_BYTE_PAIR(0xAE4C, 0x590F)
+DOUBLE_BYTE_PAIR(0xAE4D, 0x5957)
+DOUBLE_BYTE_PAIR(0xAE4E, 0x5958)
+DOUBLE_BYTE_PAIR(0xAE4F, 0x595A)
+DOUBLE_BYTE_PAIR(0xAE50, 0x5A11)
+DOUBLE_BYTE_PAIR(0xAE51, 0x5A18)
+DOUBLE_BYTE_PAIR(0xAE52, 0x5A1C)
+DOUBLE_BYTE_PAIR(0xAE53, 0x5A1F)
+DOUBLE_BYTE_PAIR(0xAE54, 0x5A1B)
+DOUBLE_BYTE_PAIR(0xAE55, 0x5A13)
+DOUBLE_BYTE_PAIR(0xAE56, 0x59EC)
+DOUBLE_BYTE_PAIR(0xAE57, 0x5A20)
+DOUBLE_BYTE_PAIR(0xAE58, 0x5A23)
+DOUBLE_BYTE_PAIR(0xAE59, 0x5A29)
+DOUBLE_BYTE_PAIR(0xAE5A, 0x5A25)
+DOUBLE_BYTE_PAIR(0xAE5B, 0x5A0C)
+DOUBLE_BYTE_PAIR(0xAE5C, 0x5A09)
+DOUBLE_BYTE_PAIR(0xAE5D, 0x5B6B)
+DOUBLE_BYTE_PAIR(0xAE5E, 0x5C58)
+DOUBLE_BYTE_PAIR(0xAE5F, 0x5BB0)
+DOUBLE_BYTE_PAIR(0xAE60, 0x5BB3)
+DOUBLE_BYTE_PAIR(0xAE61, 0x5BB6)
+DOUBLE_BYTE_PAIR(0xAE62, 0x5BB4)
+DOUBLE_BYTE_PAIR(0xAE63, 0x5BAE)
+DOUBLE_BYTE_PAIR(0xAE64, 0x5BB5)
+DOUBLE_BYTE_PAIR(0xAE65, 0x5BB9)
+DOUBLE_BYTE_PAIR(0xAE66, 0x5BB8)
+DOUBLE_BYTE_PAIR(0xAE67, 0x5C04)
+DOUBLE_BYTE_PAIR(0xAE68, 0x5C51)
+DOUBLE_BYTE_PAIR(0xAE69, 0x5C55)
+DOUBLE_BYTE_PAIR(0xAE6A, 0x5C50)
+DOUBLE_BYTE_PAIR(0xAE6B, 0x5CED)
+DOUBLE_BYTE_PAIR(0xAE6C, 0x5CFD)
+DOUBLE_BYTE_PAIR(0xAE6D, 0x5CFB)
+DOUBLE_BYTE_PAIR(0xAE6E, 0x5CEA)
+DOUBLE_BYTE_PAIR(0xAE6F, 0x5CE8)
+DOUBLE_BYTE_PAIR(0xAE70, 0x5CF0)
+DOUBLE_BYTE_PAIR(0xAE71, 0x5CF6)
+DOUBLE_BYTE_PAIR(0xAE72, 0x5D01)
+DOUBLE_BYTE_PAIR(0xAE73, 0x5CF4)
+DOUBLE_BYTE_PAIR(0xAE74, 0x5DEE)
+DOUBLE_BYTE_PAIR(0xAE75, 0x5E2D)
+DOUBLE_BYTE_PAIR(0xAE76, 0x5E2B)
+DOUBLE_BYTE_PAIR(0xAE77, 0x5EAB)
+DOUBLE_BYTE_PAIR(0xAE78, 0x5EAD)
+DOUBLE_BYTE_PAIR(0xAE79, 0x5EA7)
+DOUBLE_BYTE_PAIR(0xAE7A, 0x5F31)
+DOUBLE_BYTE_PAIR(0xAE7B, 0x5F92)
+DOUBLE_BYTE_PAIR(0xAE7C, 0x5F91)
+DOUBLE_BYTE_PAIR(0xAE7D, 0x5F90)
+DOUBLE_BYTE_PAIR(0xAE7E, 0x6059)
+DOUBLE_BYTE_PAIR(0xAEA1, 0x6063)
+DOUBLE_BYTE_PAIR(0xAEA2, 0x6065)
+DOUBLE_BYTE_PAIR(0xAEA3, 0x6050)
+DOUBLE_BYTE_PAIR(0xAEA4, 0x6055)
+DOUBLE_BYTE_PAIR(0xAEA5, 0x606D)
+DOUBLE_BYTE_PAIR(0xAEA6, 0x6069)
+DOUBLE_BYTE_PAIR(0xAEA7, 0x606F)
+DOUBLE_BYTE_PAIR(0xAEA8, 0x6084)
+DOUBLE_BYTE_PAIR(0xAEA9, 0x609F)
+DOUBLE_BYTE_PAIR(0xAEAA, 0x609A)
+DOUBLE_BYTE_PAIR(0xAEAB, 0x608D)
+DOUBLE_BYTE_PAIR(0xAEAC, 0x6094)
+DOUBLE_BYTE_PAIR(0xAEAD, 0x608C)
+DOUBLE_BYTE_PAIR(0xAEAE, 0x6085)
+DOUBLE_BYTE_PAIR(0xAEAF, 0x6096)
+DOUBLE_BYTE_PAIR(0xAEB0, 0x6247)
+DOUBLE_BYTE_PAIR(0xAEB1, 0x62F3)
+DOUBLE_BYTE_PAIR(0xAEB2, 0x6308)
+DOUBLE_BYTE_PAIR(0xAEB3, 0x62FF)
+DOUBLE_BYTE_PAIR(0xAEB4, 0x634E)
+DOUBLE_BYTE_PAIR(0xAEB5, 0x633E)
+DOUBLE_BYTE_PAIR(0xAEB6, 0x632F)
+DOUBLE_BYTE_PAIR(0xAEB7, 0x6355)
+DOUBLE_BYTE_PAIR(0xAEB8, 0x6342)
+DOUBLE_BYTE_PAIR(0xAEB9, 0x6346)
+DOUBLE_BYTE_PAIR(0xAEBA, 0x634F)
+DOUBLE_BYTE_PAIR(0xAEBB, 0x6349)
+DOUBLE_BYTE_PAIR(0xAEBC, 0x633A)
+DOUBLE_BYTE_PAIR(0xAEBD, 0x6350)
+DOUBLE_BYTE_PAIR(0xAEBE, 0x633D)
+DOUBLE_BYTE_PAIR(0xAEBF, 0x632A)
+DOUBLE_BYTE_PAIR(0xAEC0, 0x632B)
+DOUBLE_BYTE_PAIR(0xAEC1, 0x6328)
+DOUBLE_BYTE_PAIR(0xAEC2, 0x634D)
+DOUBLE_BYTE_PAIR(0xAEC3, 0x634C)
+DOUBLE_BYTE_PAIR(0xAEC4, 0x6548)
+DOUBLE_BYTE_PAIR(0xAEC5, 0x6549)
+DOUBLE_BYTE_PAIR(0xAEC6, 0x6599)
+DOUBLE_BYTE_PAIR(0xAEC7, 0x65C1)
+DOUBLE_BYTE_PAIR(0xAEC8, 0x65C5)
+DOUBLE_BYTE_PAIR(0xAEC9, 0x6642)
+DOUBLE_BYTE_PAIR(0xAECA, 0x6649)
+DOUBLE_BYTE_PAIR(0xAECB, 0x664F)
+DOUBLE_BYTE_PAIR(0xAECC, 0x6643)
+DOUBLE_BYTE_PAIR(0xAECD, 0x6652)
+DOUBLE_BYTE_PAIR(0xAECE, 0x664C)
+DOUBLE_BYTE_PAIR(0xAECF, 0x6645)
+DOUBLE_BYTE_PAIR(0xAED0, 0x6641)
+DOUBLE_BYTE_PAIR(0xAED1, 0x66F8)
+DOUBLE_BYTE_PAIR(0xAED2, 0x6714)
+DOUBLE_BYTE_PAIR(0xAED3, 0x6715)
+DOUBLE_BYTE_PAIR(0xAED4, 0x6717)
+DOUBLE_BYTE_PAIR(0xAED5, 0x6821)
+DOUBLE_BYTE_PAIR(0xAED6, 0x6838)
+DOUBLE_BYTE_PAIR(0xAED7, 0x6848)
+DOUBLE_BYTE_PAIR(0xAED8, 0x6846)
+DOUBLE_BYTE_PAIR(0xAED9, 0x6853)
+DOUBLE_BYTE_PAIR(0xAEDA, 0x6839)
+DOUBLE_BYTE_PAIR(0xAEDB, 0x6842)
+DOUBLE_BYTE_PAIR(0xAEDC, 0x6854)
+DOUBLE_BYTE_PAIR(0xAEDD, 0x6829)
+DOUBLE_BYTE_PAIR(0xAEDE, 0x68B3)
+DOUBLE_BYTE_PAIR(0xAEDF, 0x6817)
+DOUBLE_BYTE_PAIR(0xAEE0, 0x684C)
+DOUBLE_BYTE_PAIR(0xAEE1, 0x6851)
+DOUBLE_BYTE_PAIR(0xAEE2, 0x683D)
+DOUBLE_BYTE_PAIR(0xAEE3, 0x67F4)
+DOUBLE_BYTE_PAIR(0xAEE4, 0x6850)
+DOUBLE_BYTE_PAIR(0xAEE5, 0x6840)
+DOUBLE_BYTE_PAIR(0xAEE6, 0x683C)
+DOUBLE_BYTE_PAIR(0xAEE7, 0x6843)
+DOUBLE_BYTE_PAIR(0xAEE8, 0x682A)
+DOUBLE_BYTE_PAIR(0xAEE9, 0x6845)
+DOUBLE_BYTE_PAIR(0xAEEA, 0x6813)
+DOUBLE_BYTE_PAIR(0xAEEB, 0x6818)
+DOUBLE_BYTE_PAIR(0xAEEC, 0x6841)
+DOUBLE_BYTE_PAIR(0xAEED, 0x6B8A)
+DOUBLE_BYTE_PAIR(0xAEEE, 0x6B89)
+DOUBLE_BYTE_PAIR(0xAEEF, 0x6BB7)
+DOUBLE_BYTE_PAIR(0xAEF0, 0x6C23)
+DOUBLE_BYTE_PAIR(0xAEF1, 0x6C27)
+DOUBLE_BYTE_PAIR(0xAEF2, 0x6C28)
+DOUBLE_BYTE_PAIR(0xAEF3, 0x6C26)
+DOUBLE_BYTE_PAIR(0xAEF4, 0x6C24)
+DOUBLE_BYTE_PAIR(0xAEF5, 0x6CF0)
+DOUBLE_BYTE_PAIR(0xAEF6, 0x6D6A)
+DOUBLE_BYTE_PAIR(0xAEF7, 0x6D95)
+DOUBLE_BYTE_PAIR(0xAEF8, 0x6D88)
+DOUBLE_BYTE_PAIR(0xAEF9, 0x6D87)
+DOUBLE_BYTE_PAIR(0xAEFA, 0x6D66)
+DOUBLE_BYTE_PAIR(0xAEFB, 0x6D78)
+DOUBLE_BYTE_PAIR(0xAEFC, 0x6D77)
+DOUBLE_BYTE_PAIR(0xAEFD, 0x6D59)
+DOUBLE_BYTE_PAIR(0xAEFE, 0x6D93)
+DOUBLE_BYTE_PAIR(0xAF40, 0x6D6C)
+DOUBLE_BYTE_PAIR(0xAF41, 0x6D89)
+DOUBLE_BYTE_PAIR(0xAF42, 0x6D6E)
+DOUBLE_BYTE_PAIR(0xAF43, 0x6D5A)
+DOUBLE_BYTE_PAIR(0xAF44, 0x6D74)
+DOUBLE_BYTE_PAIR(0xAF45, 0x6D69)
+DOUBLE_BYTE_PAIR(0xAF46, 0x6D8C)
+DOUBLE_BYTE_PAIR(0xAF47, 0x6D8A)
+DOUBLE_BYTE_PAIR(0xAF48, 0x6D79)
+DOUBLE_BYTE_PAIR(0xAF49, 0x6D85)
+DOUBLE_BYTE_PAIR(0xAF4A, 0x6D65)
+DOUBLE_BYTE_PAIR(0xAF4B, 0x6D94)
+DOUBLE_BYTE_PAIR(0xAF4C, 0x70CA)
+DOUBLE_BYTE_PAIR(0xAF4D, 0x70D8)
+DOUBLE_BYTE_PAIR(0xAF4E, 0x70E4)
+DOUBLE_BYTE_PAIR(0xAF4F, 0x70D9)
+DOUBLE_BYTE_PAIR(0xAF50, 0x70C8)
+DOUBLE_BYTE_PAIR(0xAF51, 0x70CF)
+DOUBLE_BYTE_PAIR(0xAF52, 0x7239)
+DOUBLE_BYTE_PAIR(0xAF53, 0x7279)
+DOUBLE_BYTE_PAIR(0xAF54, 0x72FC)
+DOUBLE_BYTE_PAIR(0xAF55, 0x72F9)
+DOUBLE_BYTE_PAIR(0xAF56, 0x72FD)
+DOUBLE_BYTE_PAIR(0xAF57, 0x72F8)
+DOUBLE_BYTE_PAIR(0xAF58, 0x72F7)
+DOUBLE_BYTE_PAIR(0xAF59, 0x7386)
+DOUBLE_BYTE_PAIR(0xAF5A, 0x73ED)
+DOUBLE_BYTE_PAIR(0xAF5B, 0x7409)
+DOUBLE_BYTE_PAIR(0xAF5C, 0x73EE)
+DOUBLE_BYTE_PAIR(0xAF5D, 0x73E0)
+DOUBLE_BYTE_PAIR(0xAF5E, 0x73EA)
+DOUBLE_BYTE_PAIR(0xAF5F, 0x73DE)
+DOUBLE_BYTE_PAIR(0xAF60, 0x7554)
+DOUBLE_BYTE_PAIR(0xAF61, 0x755D)
+DOUBLE_BYTE_PAIR(0xAF62, 0x755C)
+DOUBLE_BYTE_PAIR(0xAF63, 0x755A)
+DOUBLE_BYTE_PAIR(0xAF64, 0x7559)
+DOUBLE_BYTE_PAIR(0xAF65, 0x75BE)
+DOUBLE_BYTE_PAIR(0xAF66, 0x75C5)
+DOUBLE_BYTE_PAIR(0xAF67, 0x75C7)
+DOUBLE_BYTE_PAIR(0xAF68, 0x75B2)
+DOUBLE_BYTE_PAIR(0xAF69, 0x75B3)
+DOUBLE_BYTE_PAIR(0xAF6A, 0x75BD)
+DOUBLE_BYTE_PAIR(0xAF6B, 0x75BC)
+DOUBLE_BYTE_PAIR(0xAF6C, 0x75B9)
+DOUBLE_BYTE_PAIR(0xAF6D, 0x75C2)
+DOUBLE_BYTE_PAIR(0xAF6E, 0x75B8)
+DOUBLE_BYTE_PAIR(0xAF6F, 0x768B)
+DOUBLE_BYTE_PAIR(0xAF70, 0x76B0)
+DOUBLE_BYTE_PAIR(0xAF71, 0x76CA)
+DOUBLE_BYTE_PAIR(0xAF72, 0x76CD)
+DOUBLE_BYTE_PAIR(0xAF73, 0x76CE)
+DOUBLE_BYTE_PAIR(0xAF74, 0x7729)
+DOUBLE_BYTE_PAIR(0xAF75, 0x771F)
+DOUBLE_BYTE_PAIR(0xAF76, 0x7720)
+DOUBLE_BYTE_PAIR(0xAF77, 0x7728)
+DOUBLE_BYTE_PAIR(0xAF78, 0x77E9)
+DOUBLE_BYTE_PAIR(0xAF79, 0x7830)
+DOUBLE_BYTE_PAIR(0xAF7A, 0x7827)
+DOUBLE_BYTE_PAIR(0xAF7B, 0x7838)
+DOUBLE_BYTE_PAIR(0xAF7C, 0x781D)
+DOUBLE_BYTE_PAIR(0xAF7D, 0x7834)
+DOUBLE_BYTE_PAIR(0xAF7E, 0x7837)
+DOUBLE_BYTE_PAIR(0xAFA1, 0x7825)
+DOUBLE_BYTE_PAIR(0xAFA2, 0x782D)
+DOUBLE_BYTE_PAIR(0xAFA3, 0x7820)
+DOUBLE_BYTE_PAIR(0xAFA4, 0x781F)
+DOUBLE_BYTE_PAIR(0xAFA5, 0x7832)
+DOUBLE_BYTE_PAIR(0xAFA6, 0x7955)
+DOUBLE_BYTE_PAIR(0xAFA7, 0x7950)
+DOUBLE_BYTE_PAIR(0xAFA8, 0x7960)
+DOUBLE_BYTE_PAIR(0xAFA9, 0x795F)
+DOUBLE_BYTE_PAIR(0xAFAA, 0x7956)
+DOUBLE_BYTE_PAIR(0xAFAB, 0x795E)
+DOUBLE_BYTE_PAIR(0xAFAC, 0x795D)
+DOUBLE_BYTE_PAIR(0xAFAD, 0x7957)
+DOUBLE_BYTE_PAIR(0xAFAE, 0x795A)
+DOUBLE_BYTE_PAIR(0xAFAF, 0x79E4)
+DOUBLE_BYTE_PAIR(0xAFB0, 0x79E3)
+DOUBLE_BYTE_PAIR(0xAFB1, 0x79E7)
+DOUBLE_BYTE_PAIR(0xAFB2, 0x79DF)
+DOUBLE_BYTE_PAIR(0xAFB3, 0x79E6)
+DOUBLE_BYTE_PAIR(0xAFB4, 0x79E9)
+DOUBLE_BYTE_PAIR(0xAFB5, 0x79D8)
+DOUBLE_BYTE_PAIR(0xAFB6, 0x7A84)
+DOUBLE_BYTE_PAIR(0xAFB7, 0x7A88)
+DOUBLE_BYTE_PAIR(0xAFB8, 0x7AD9)
+DOUBLE_BYTE_PAIR(0xAFB9, 0x7B06)
+DOUBLE_BYTE_PAIR(0xAFBA, 0x7B11)
+DOUBLE_BYTE_PAIR(0xAFBB, 0x7C89)
+DOUBLE_BYTE_PAIR(0xAFBC, 0x7D21)
+DOUBLE_BYTE_PAIR(0xAFBD, 0x7D17)
+DOUBLE_BYTE_PAIR(0xAFBE, 0x7D0B)
+DOUBLE_BYTE_PAIR(0xAFBF, 0x7D0A)
+DOUBLE_BYTE_PAIR(0xAFC0, 0x7D20)
+DOUBLE_BYTE_PAIR(0xAFC1, 0x7D22)
+DOUBLE_BYTE_PAIR(0xAFC2, 0x7D14)
+DOUBLE_BYTE_PAIR(0xAFC3, 0x7D10)
+DOUBLE_BYTE_PAIR(0xAFC4, 0x7D15)
+DOUBLE_BYTE_PAIR(0xAFC5, 0x7D1A)
+DOUBLE_BYTE_PAIR(0xAFC6, 0x7D1C)
+DOUBLE_BYTE_PAIR(0xAFC7, 0x7D0D)
+DOUBLE_BYTE_PAIR(0xAFC8, 0x7D19)
+DOUBLE_BYTE_PAIR(0xAFC9, 0x7D1B)
+DOUBLE_BYTE_PAIR(0xAFCA, 0x7F3A)
+DOUBLE_BYTE_PAIR(0xAFCB, 0x7F5F)
+DOUBLE_BYTE_PAIR(0xAFCC, 0x7F94)
+DOUBLE_BYTE_PAIR(0xAFCD, 0x7FC5)
+DOUBLE_BYTE_PAIR(0xAFCE, 0x7FC1)
+DOUBLE_BYTE_PAIR(0xAFCF, 0x8006)
+DOUBLE_BYTE_PAIR(0xAFD0, 0x8018)
+DOUBLE_BYTE_PAIR(0xAFD1, 0x8015)
+DOUBLE_BYTE_PAIR(0xAFD2, 0x8019)
+DOUBLE_BYTE_PAIR(0xAFD3, 0x8017)
+DOUBLE_BYTE_PAIR(0xAFD4, 0x803D)
+DOUBLE_BYTE_PAIR(0xAFD5, 0x803F)
+DOUBLE_BYTE_PAIR(0xAFD6, 0x80F1)
+DOUBLE_BYTE_PAIR(0xAFD7, 0x8102)
+DOUBLE_BYTE_PAIR(0xAFD8, 0x80F0)
+DOUBLE_BYTE_PAIR(0xAFD9, 0x8105)
+DOUBLE_BYTE_PAIR(0xAFDA, 0x80ED)
+DOUBLE_BYTE_PAIR(0xAFDB, 0x80F4)
+DOUBLE_BYTE_PAIR(0xAFDC, 0x8106)
+DOUBLE_BYTE_PAIR(0xAFDD, 0x80F8)
+DOUBLE_BYTE_PAIR(0xAFDE, 0x80F3)
+DOUBLE_BYTE_PAIR(0xAFDF, 0x8108)
+DOUBLE_BYTE_PAIR(0xAFE0, 0x80FD)
+DOUBLE_BYTE_PAIR(0xAFE1, 0x810A)
+DOUBLE_BYTE_PAIR(0xAFE2, 0x80FC)
+DOUBLE_BYTE_PAIR(0xAFE3, 0x80EF)
+DOUBLE_BYTE_PAIR(0xAFE4, 0x81ED)
+DOUBLE_BYTE_PAIR(0xAFE5, 0x81EC)
+DOUBLE_BYTE_PAIR(0xAFE6, 0x8200)
+DOUBLE_BYTE_PAIR(0xAFE7, 0x8210)
+DOUBLE_BYTE_PAIR(0xAFE8, 0x822A)
+DOUBLE_BYTE_PAIR(0xAFE9, 0x822B)
+DOUBLE_BYTE_PAIR(0xAFEA, 0x8228)
+DOUBLE_BYTE_PAIR(0xAFEB, 0x822C)
+DOUBLE_BYTE_PAIR(0xAFEC, 0x82BB)
+DOUBLE_BYTE_PAIR(0xAFED, 0x832B)
+DOUBLE_BYTE_PAIR(0xAFEE, 0x8352)
+DOUBLE_BYTE_PAIR(0xAFEF, 0x8354)
+DOUBLE_BYTE_PAIR(0xAFF0, 0x834A)
+DOUBLE_BYTE_PAIR(0xAFF1, 0x8338)
+DOUBLE_BYTE_PAIR(0xAFF2, 0x8350)
+DOUBLE_BYTE_PAIR(0xAFF3, 0x8349)
+DOUBLE_BYTE_PAIR(0xAFF4, 0x8335)
+DOUBLE_BYTE_PAIR(0xAFF5, 0x8334)
+DOUBLE_BYTE_PAIR(0xAFF6, 0x834F)
+DOUBLE_BYTE_PAIR(0xAFF7, 0x8332)
+DOUBLE_BYTE_PAIR(0xAFF8, 0x8339)
+DOUBLE_BYTE_PAIR(0xAFF9, 0x8336)
+DOUBLE_BYTE_PAIR(0xAFFA, 0x8317)
+DOUBLE_BYTE_PAIR(0xAFFB, 0x8340)
+DOUBLE_BYTE_PAIR(0xAFFC, 0x8331)
+DOUBLE_BYTE_PAIR(0xAFFD, 0x8328)
+DOUBLE_BYTE_PAIR(0xAFFE, 0x8343)
+DOUBLE_BYTE_PAIR(0xB040, 0x8654)
+DOUBLE_BYTE_PAIR(0xB041, 0x868A)
+DOUBLE_BYTE_PAIR(0xB042, 0x86AA)
+DOUBLE_BYTE_PAIR(0xB043, 0x8693)
+DOUBLE_BYTE_PAIR(0xB044, 0x86A4)
+DOUBLE_BYTE_PAIR(0xB045, 0x86A9)
+DOUBLE_BYTE_PAIR(0xB046, 0x868C)
+DOUBLE_BYTE_PAIR(0xB047, 0x86A3)
+DOUBLE_BYTE_PAIR(0xB048, 0x869C)
+DOUBLE_BYTE_PAIR(0xB049, 0x8870)
+DOUBLE_BYTE_PAIR(0xB04A, 0x8877)
+DOUBLE_BYTE_PAIR(0xB04B, 0x8881)
+DOUBLE_BYTE_PAIR(0xB04C, 0x8882)
+DOUBLE_BYTE_PAIR(0xB04D, 0x887D)
+DOUBLE_BYTE_PAIR(0xB04E, 0x8879)
+DOUBLE_BYTE_PAIR(0xB04F, 0x8A18)
+DOUBLE_BYTE_PAIR(0xB050, 0x8A10)
+DOUBLE_BYTE_PAIR(0xB051, 0x8A0E)
+DOUBLE_BYTE_PAIR(0xB052, 0x8A0C)
+DOUBLE_BYTE_PAIR(0xB053, 0x8A15)
+DOUBLE_BYTE_PAIR(0xB054, 0x8A0A)
+DOUBLE_BYTE_PAIR(0xB055, 0x8A17)
+DOUBLE_BYTE_PAIR(0xB056, 0x8A13)
+DOUBLE_BYTE_PAIR(0xB057, 0x8A16)
+DOUBLE_BYTE_PAIR(0xB058, 0x8A0F)
+DOUBLE_BYTE_PAIR(0xB059, 0x8A11)
+DOUBLE_BYTE_PAIR(0xB05A, 0x8C48)
+DOUBLE_BYTE_PAIR(0xB05B, 0x8C7A)
+DOUBLE_BYTE_PAIR(0xB05C, 0x8C79)
+DOUBLE_BYTE_PAIR(0xB05D, 0x8CA1)
+DOUBLE_BYTE_PAIR(0xB05E, 0x8CA2)
+DOUBLE_BYTE_PAIR(0xB05F, 0x8D77)
+DOUBLE_BYTE_PAIR(0xB060, 0x8EAC)
+DOUBLE_BYTE_PAIR(0xB061, 0x8ED2)
+DOUBLE_BYTE_PAIR(0xB062, 0x8ED4)
+DOUBLE_BYTE_PAIR(0xB063, 0x8ECF)
+DOUBLE_BYTE_PAIR(0xB064, 0x8FB1)
+DOUBLE_BYTE_PAIR(0xB065, 0x9001)
+DOUBLE_BYTE_PAIR(0xB066, 0x9006)
+DOUBLE_BYTE_PAIR(0xB067, 0x8FF7)
+DOUBLE_BYTE_PAIR(0xB068, 0x9000)
+DOUBLE_BYTE_PAIR(0xB069, 0x8FFA)
+DOUBLE_BYTE_PAIR(0xB06A, 0x8FF4)
+DOUBLE_BYTE_PAIR(0xB06B, 0x9003)
+DOUBLE_BYTE_PAIR(0xB06C, 0x8FFD)
+DOUBLE_BYTE_PAIR(0xB06D, 0x9005)
+DOUBLE_BYTE_PAIR(0xB06E, 0x8FF8)
+DOUBLE_BYTE_PAIR(0xB06F, 0x9095)
+DOUBLE_BYTE_PAIR(0xB070, 0x90E1)
+DOUBLE_BYTE_PAIR(0xB071, 0x90DD)
+DOUBLE_BYTE_PAIR(0xB072, 0x90E2)
+DOUBLE_BYTE_PAIR(0xB073, 0x9152)
+DOUBLE_BYTE_PAIR(0xB074, 0x914D)
+DOUBLE_BYTE_PAIR(0xB075, 0x914C)
+DOUBLE_BYTE_PAIR(0xB076, 0x91D8)
+DOUBLE_BYTE_PAIR(0xB077, 0x91DD)
+DOUBLE_BYTE_PAIR(0xB078, 0x91D7)
+DOUBLE_BYTE_PAIR(0xB079, 0x91DC)
+DOUBLE_BYTE_PAIR(0xB07A, 0x91D9)
+DOUBLE_BYTE_PAIR(0xB07B, 0x9583)
+DOUBLE_BYTE_PAIR(0xB07C, 0x9662)
+DOUBLE_BYTE_PAIR(0xB07D, 0x9663)
+DOUBLE_BYTE_PAIR(0xB07E, 0x9661)
+DOUBLE_BYTE_PAIR(0xB0A1, 0x965B)
+DOUBLE_BYTE_PAIR(0xB0A2, 0x965D)
+DOUBLE_BYTE_PAIR(0xB0A3, 0x9664)
+DOUBLE_BYTE_PAIR(0xB0A4, 0x9658)
+DOUBLE_BYTE_PAIR(0xB0A5, 0x965E)
+DOUBLE_BYTE_PAIR(0xB0A6, 0x96BB)
+DOUBLE_BYTE_PAIR(0xB0A7, 0x98E2)
+DOUBLE_BYTE_PAIR(0xB0A8, 0x99AC)
+DOUBLE_BYTE_PAIR(0xB0A9, 0x9AA8)
+DOUBLE_BYTE_PAIR(0xB0AA, 0x9AD8)
+DOUBLE_BYTE_PAIR(0xB0AB, 0x9B25)
+DOUBLE_BYTE_PAIR(0xB0AC, 0x9B32)
+DOUBLE_BYTE_PAIR(0xB0AD, 0x9B3C)
+DOUBLE_BYTE_PAIR(0xB0AE, 0x4E7E)
+DOUBLE_BYTE_PAIR(0xB0AF, 0x507A)
+DOUBLE_BYTE_PAIR(0xB0B0, 0x507D)
+DOUBLE_BYTE_PAIR(0xB0B1, 0x505C)
+DOUBLE_BYTE_PAIR(0xB0B2, 0x5047)
+DOUBLE_BYTE_PAIR(0xB0B3, 0x5043)
+DOUBLE_BYTE_PAIR(0xB0B4, 0x504C)
+DOUBLE_BYTE_PAIR(0xB0B5, 0x505A)
+DOUBLE_BYTE_PAIR(0xB0B6, 0x5049)
+DOUBLE_BYTE_PAIR(0xB0B7, 0x5065)
+DOUBLE_BYTE_PAIR(0xB0B8, 0x5076)
+DOUBLE_BYTE_PAIR(0xB0B9, 0x504E)
+DOUBLE_BYTE_PAIR(0xB0BA, 0x5055)
+DOUBLE_BYTE_PAIR(0xB0BB, 0x5075)
+DOUBLE_BYTE_PAIR(0xB0BC, 0x5074)
+DOUBLE_BYTE_PAIR(0xB0BD, 0x5077)
+DOUBLE_BYTE_PAIR(0xB0BE, 0x504F)
+DOUBLE_BYTE_PAIR(0xB0BF, 0x500F)
+DOUBLE_BYTE_PAIR(0xB0C0, 0x506F)
+DOUBLE_BYTE_PAIR(0xB0C1, 0x506D)
+DOUBLE_BYTE_PAIR(0xB0C2, 0x515C)
+DOUBLE_BYTE_PAIR(0xB0C3, 0x5195)
+DOUBLE_BYTE_PAIR(0xB0C4, 0x51F0)
+DOUBLE_BYTE_PAIR(0xB0C5, 0x526A)
+DOUBLE_BYTE_PAIR(0xB0C6, 0x526F)
+DOUBLE_BYTE_PAIR(0xB0C7, 0x52D2)
+DOUBLE_BYTE_PAIR(0xB0C8, 0x52D9)
+DOUBLE_BYTE_PAIR(0xB0C9, 0x52D8)
+DOUBLE_BYTE_PAIR(0xB0CA, 0x52D5)
+DOUBLE_BYTE_PAIR(0xB0CB, 0x5310)
+DOUBLE_BYTE_PAIR(0xB0CC, 0x530F)
+DOUBLE_BYTE_PAIR(0xB0CD, 0x5319)
+DOUBLE_BYTE_PAIR(0xB0CE, 0x533F)
+DOUBLE_BYTE_PAIR(0xB0CF, 0x5340)
+DOUBLE_BYTE_PAIR(0xB0D0, 0x533E)
+DOUBLE_BYTE_PAIR(0xB0D1, 0x53C3)
+DOUBLE_BYTE_PAIR(0xB0D2, 0x66FC)
+DOUBLE_BYTE_PAIR(0xB0D3, 0x5546)
+DOUBLE_BYTE_PAIR(0xB0D4, 0x556A)
+DOUBLE_BYTE_PAIR(0xB0D5, 0x5566)
+DOUBLE_BYTE_PAIR(0xB0D6, 0x5544)
+DOUBLE_BYTE_PAIR(0xB0D7, 0x555E)
+DOUBLE_BYTE_PAIR(0xB0D8, 0x5561)
+DOUBLE_BYTE_PAIR(0xB0D9, 0x5543)
+DOUBLE_BYTE_PAIR(0xB0DA, 0x554A)
+DOUBLE_BYTE_PAIR(0xB0DB, 0x5531)
+DOUBLE_BYTE_PAIR(0xB0DC, 0x5556)
+DOUBLE_BYTE_PAIR(0xB0DD, 0x554F)
+DOUBLE_BYTE_PAIR(0xB0DE, 0x5555)
+DOUBLE_BYTE_PAIR(0xB0DF, 0x552F)
+DOUBLE_BYTE_PAIR(0xB0E0, 0x5564)
+DOUBLE_BYTE_PAIR(0xB0E1, 0x5538)
+DOUBLE_BYTE_PAIR(0xB0E2, 0x552E)
+DOUBLE_BYTE_PAIR(0xB0E3, 0x555C)
+DOUBLE_BYTE_PAIR(0xB0E4, 0x552C)
+DOUBLE_BYTE_PAIR(0xB0E5, 0x5563)
+DOUBLE_BYTE_PAIR(0xB0E6, 0x5533)
+DOUBLE_BYTE_PAIR(0xB0E7, 0x5541)
+DOUBLE_BYTE_PAIR(0xB0E8, 0x5557)
+DOUBLE_BYTE_PAIR(0xB0E9, 0x5708)
+DOUBLE_BYTE_PAIR(0xB0EA, 0x570B)
+DOUBLE_BYTE_PAIR(0xB0EB, 0x5709)
+DOUBLE_BYTE_PAIR(0xB0EC, 0x57DF)
+DOUBLE_BYTE_PAIR(0xB0ED, 0x5805)
+DOUBLE_BYTE_PAIR(0xB0EE, 0x580A)
+DOUBLE_BYTE_PAIR(0xB0EF, 0x5806)
+DOUBLE_BYTE_PAIR(0xB0F0, 0x57E0)
+DOUBLE_BYTE_PAIR(0xB0F1, 0x57E4)
+DOUBLE_BYTE_PAIR(0xB0F2, 0x57FA)
+DOUBLE_BYTE_PAIR(0xB0F3, 0x5802)
+DOUBLE_BYTE_PAIR(0xB0F4, 0x5835)
+DOUBLE_BYTE_PAIR(0xB0F5, 0x57F7)
+DOUBLE_BYTE_PAIR(0xB0F6, 0x57F9)
+DOUBLE_BYTE_PAIR(0xB0F7, 0x5920)
+DOUBLE_BYTE_PAIR(0xB0F8, 0x5962)
+DOUBLE_BYTE_PAIR(0xB0F9, 0x5A36)
+DOUBLE_BYTE_PAIR(0xB0FA, 0x5A41)
+DOUBLE_BYTE_PAIR(0xB0FB, 0x5A49)
+DOUBLE_BYTE_PAIR(0xB0FC, 0x5A66)
+DOUBLE_BYTE_PAIR(0xB0FD, 0x5A6A)
+DOUBLE_BYTE_PAIR(0xB0FE, 0x5A40)
+DOUBLE_BYTE_PAIR(0xB140, 0x5A3C)
+DOUBLE_BYTE_PAIR(0xB141, 0x5A62)
+DOUBLE_BYTE_PAIR(0xB142, 0x5A5A)
+DOUBLE_BYTE_PAIR(0xB143, 0x5A46)
+DOUBLE_BYTE_PAIR(0xB144, 0x5A4A)
+DOUBLE_BYTE_PAIR(0xB145, 0x5B70)
+DOUBLE_BYTE_PAIR(0xB146, 0x5BC7)
+DOUBLE_BYTE_PAIR(0xB147, 0x5BC5)
+DOUBLE_BYTE_PAIR(0xB148, 0x5BC4)
+DOUBLE_BYTE_PAIR(0xB149, 0x5BC2)
+DOUBLE_BYTE_PAIR(0xB14A, 0x5BBF)
+DOUBLE_BYTE_PAIR(0xB14B, 0x5BC6)
+DOUBLE_BYTE_PAIR(0xB14C, 0x5C09)
+DOUBLE_BYTE_PAIR(0xB14D, 0x5C08)
+DOUBLE_BYTE_PAIR(0xB14E, 0x5C07)
+DOUBLE_BYTE_PAIR(0xB14F, 0x5C60)
+DOUBLE_BYTE_PAIR(0xB150, 0x5C5C)
+DOUBLE_BYTE_PAIR(0xB151, 0x5C5D)
+DOUBLE_BYTE_PAIR(0xB152, 0x5D07)
+DOUBLE_BYTE_PAIR(0xB153, 0x5D06)
+DOUBLE_BYTE_PAIR(0xB154, 0x5D0E)
+DOUBLE_BYTE_PAIR(0xB155, 0x5D1B)
+DOUBLE_BYTE_PAIR(0xB156, 0x5D16)
+DOUBLE_BYTE_PAIR(0xB157, 0x5D22)
+DOUBLE_BYTE_PAIR(0xB158, 0x5D11)
+DOUBLE_BYTE_PAIR(0xB159, 0x5D29)
+DOUBLE_BYTE_PAIR(0xB15A, 0x5D14)
+DOUBLE_BYTE_PAIR(0xB15B, 0x5D19)
+DOUBLE_BYTE_PAIR(0xB15C, 0x5D24)
+DOUBLE_BYTE_PAIR(0xB15D, 0x5D27)
+DOUBLE_BYTE_PAIR(0xB15E, 0x5D17)
+DOUBLE_BYTE_PAIR(0xB15F, 0x5DE2)
+DOUBLE_BYTE_PAIR(0xB160, 0x5E38)
+DOUBLE_BYTE_PAIR(0xB161, 0x5E36)
+DOUBLE_BYTE_PAIR(0xB162, 0x5E33)
+DOUBLE_BYTE_PAIR(0xB163, 0x5E37)
+DOUBLE_BYTE_PAIR(0xB164, 0x5EB7)
+DOUBLE_BYTE_PAIR(0xB165, 0x5EB8)
+DOUBLE_BYTE_PAIR(0xB166, 0x5EB6)
+DOUBLE_BYTE_PAIR(0xB167, 0x5EB5)
+DOUBLE_BYTE_PAIR(0xB168, 0x5EBE)
+DOUBLE_BYTE_PAIR(0xB169, 0x5F35)
+DOUBLE_BYTE_PAIR(0xB16A, 0x5F37)
+DOUBLE_BYTE_PAIR(0xB16B, 0x5F57)
+DOUBLE_BYTE_PAIR(0xB16C, 0x5F6C)
+DOUBLE_BYTE_PAIR(0xB16D, 0x5F69)
+DOUBLE_BYTE_PAIR(0xB16E, 0x5F6B)
+DOUBLE_BYTE_PAIR(0xB16F, 0x5F97)
+DOUBLE_BYTE_PAIR(0xB170, 0x5F99)
+DOUBLE_BYTE_PAIR(0xB171, 0x5F9E)
+DOUBLE_BYTE_PAIR(0xB172, 0x5F98)
+DOUBLE_BYTE_PAIR(0xB173, 0x5FA1)
+DOUBLE_BYTE_PAIR(0xB174, 0x5FA0)
+DOUBLE_BYTE_PAIR(0xB175, 0x5F9C)
+DOUBLE_BYTE_PAIR(0xB176, 0x607F)
+DOUBLE_BYTE_PAIR(0xB177, 0x60A3)
+DOUBLE_BYTE_PAIR(0xB178, 0x6089)
+DOUBLE_BYTE_PAIR(0xB179, 0x60A0)
+DOUBLE_BYTE_PAIR(0xB17A, 0x60A8)
+DOUBLE_BYTE_PAIR(0xB17B, 0x60CB)
+DOUBLE_BYTE_PAIR(0xB17C, 0x60B4)
+DOUBLE_BYTE_PAIR(0xB17D, 0x60E6)
+DOUBLE_BYTE_PAIR(0xB17E, 0x60BD)
+DOUBLE_BYTE_PAIR(0xB1A1, 0x60C5)
+DOUBLE_BYTE_PAIR(0xB1A2, 0x60BB)
+DOUBLE_BYTE_PAIR(0xB1A3, 0x60B5)
+DOUBLE_BYTE_PAIR(0xB1A4, 0x60DC)
+DOUBLE_BYTE_PAIR(0xB1A5, 0x60BC)
+DOUBLE_BYTE_PAIR(0xB1A6, 0x60D8)
+DOUBLE_BYTE_PAIR(0xB1A7, 0x60D5)
+DOUBLE_BYTE_PAIR(0xB1A8, 0x60C6)
+DOUBLE_BYTE_PAIR(0xB1A9, 0x60DF)
+DOUBLE_BYTE_PAIR(0xB1AA, 0x60B8)
+DOUBLE_BYTE_PAIR(0xB1AB, 0x60DA)
+DOUBLE_BYTE_PAIR(0xB1AC, 0x60C7)
+DOUBLE_BYTE_PAIR(0xB1AD, 0x621A)
+DOUBLE_BYTE_PAIR(0xB1AE, 0x621B)
+DOUBLE_BYTE_PAIR(0xB1AF, 0x6248)
+DOUBLE_BYTE_PAIR(0xB1B0, 0x63A0)
+DOUBLE_BYTE_PAIR(0xB1B1, 0x63A7)
+DOUBLE_BYTE_PAIR(0xB1B2, 0x6372)
+DOUBLE_BYTE_PAIR(0xB1B3, 0x6396)
+DOUBLE_BYTE_PAIR(0xB1B4, 0x63A2)
+DOUBLE_BYTE_PAIR(0xB1B5, 0x63A5)
+DOUBLE_BYTE_PAIR(0xB1B6, 0x6377)
+DOUBLE_BYTE_PAIR(0xB1B7, 0x6367)
+DOUBLE_BYTE_PAIR(0xB1B8, 0x6398)
+DOUBLE_BYTE_PAIR(0xB1B9, 0x63AA)
+DOUBLE_BYTE_PAIR(0xB1BA, 0x6371)
+DOUBLE_BYTE_PAIR(0xB1BB, 0x63A9)
+DOUBLE_BYTE_PAIR(0xB1BC, 0x6389)
+DOUBLE_BYTE_PAIR(0xB1BD, 0x6383)
+DOUBLE_BYTE_PAIR(0xB1BE, 0x639B)
+DOUBLE_BYTE_PAIR(0xB1BF, 0x636B)
+DOUBLE_BYTE_PAIR(0xB1C0, 0x63A8)
+DOUBLE_BYTE_PAIR(0xB1C1, 0x6384)
+DOUBLE_BYTE_PAIR(0xB1C2, 0x6388)
+DOUBLE_BYTE_PAIR(0xB1C3, 0x6399)
+DOUBLE_BYTE_PAIR(0xB1C4, 0x63A1)
+DOUBLE_BYTE_PAIR(0xB1C5, 0x63AC)
+DOUBLE_BYTE_PAIR(0xB1C6, 0x6392)
+DOUBLE_BYTE_PAIR(0xB1C7, 0x638F)
+DOUBLE_BYTE_PAIR(0xB1C8, 0x6380)
+DOUBLE_BYTE_PAIR(0xB1C9, 0x637B)
+DOUBLE_BYTE_PAIR(0xB1CA, 0x6369)
+DOUBLE_BYTE_PAIR(0xB1CB, 0x6368)
+DOUBLE_BYTE_PAIR(0xB1CC, 0x637A)
+DOUBLE_BYTE_PAIR(0xB1CD, 0x655D)
+DOUBLE_BYTE_PAIR(0xB1CE, 0x6556)
+DOUBLE_BYTE_PAIR(0xB1CF, 0x6551)
+DOUBLE_BYTE_PAIR(0xB1D0, 0x6559)
+DOUBLE_BYTE_PAIR(0xB1D1, 0x6557)
+DOUBLE_BYTE_PAIR(0xB1D2, 0x555F)
+DOUBLE_BYTE_PAIR(0xB1D3, 0x654F)
+DOUBLE_BYTE_PAIR(0xB1D4, 0x6558)
+DOUBLE_BYTE_PAIR(0xB1D5, 0x6555)
+DOUBLE_BYTE_PAIR(0xB1D6, 0x6554)
+DOUBLE_BYTE_PAIR(0xB1D7, 0x659C)
+DOUBLE_BYTE_PAIR(0xB1D8, 0x659B)
+DOUBLE_BYTE_PAIR(0xB1D9, 0x65AC)
+DOUBLE_BYTE_PAIR(0xB1DA, 0x65CF)
+DOUBLE_BYTE_PAIR(0xB1DB, 0x65CB)
+DOUBLE_BYTE_PAIR(0xB1DC, 0x65CC)
+DOUBLE_BYTE_PAIR(0xB1DD, 0x65CE)
+DOUBLE_BYTE_PAIR(0xB1DE, 0x665D)
+DOUBLE_BYTE_PAIR(0xB1DF, 0x665A)
+DOUBLE_BYTE_PAIR(0xB1E0, 0x6664)
+DOUBLE_BYTE_PAIR(0xB1E1, 0x6668)
+DOUBLE_BYTE_PAIR(0xB1E2, 0x6666)
+DOUBLE_BYTE_PAIR(0xB1E3, 0x665E)
+DOUBLE_BYTE_PAIR(0xB1E4, 0x66F9)
+DOUBLE_BYTE_PAIR(0xB1E5, 0x52D7)
+DOUBLE_BYTE_PAIR(0xB1E6, 0x671B)
+DOUBLE_BYTE_PAIR(0xB1E7, 0x6881)
+DOUBLE_BYTE_PAIR(0xB1E8, 0x68AF)
+DOUBLE_BYTE_PAIR(0xB1E9, 0x68A2)
+DOUBLE_BYTE_PAIR(0xB1EA, 0x6893)
+DOUBLE_BYTE_PAIR(0xB1EB, 0x68B5)
+DOUBLE_BYTE_PAIR(0xB1EC, 0x687F)
+DOUBLE_BYTE_PAIR(0xB1ED, 0x6876)
+DOUBLE_BYTE_PAIR(0xB1EE, 0x68B1)
+DOUBLE_BYTE_PAIR(0xB1EF, 0x68A7)
+DOUBLE_BYTE_PAIR(0xB1F0, 0x6897)
+DOUBLE_BYTE_PAIR(0xB1F1, 0x68B0)
+DOUBLE_BYTE_PAIR(0xB1F2, 0x6883)
+DOUBLE_BYTE_PAIR(0xB1F3, 0x68C4)
+DOUBLE_BYTE_PAIR(0xB1F4, 0x68AD)
+DOUBLE_BYTE_PAIR(0xB1F5, 0x6886)
+DOUBLE_BYTE_PAIR(0xB1F6, 0x6885)
+DOUBLE_BYTE_PAIR(0xB1F7, 0x6894)
+DOUBLE_BYTE_PAIR(0xB1F8, 0x689D)
+DOUBLE_BYTE_PAIR(0xB1F9, 0x68A8)
+DOUBLE_BYTE_PAIR(0xB1FA, 0x689F)
+DOUBLE_BYTE_PAIR(0xB1FB, 0x68A1)
+DOUBLE_BYTE_PAIR(0xB1FC, 0x6882)
+DOUBLE_BYTE_PAIR(0xB1FD, 0x6B32)
+DOUBLE_BYTE_PAIR(0xB1FE, 0x6BBA)
+DOUBLE_BYTE_PAIR(0xB240, 0x6BEB)
+DOUBLE_BYTE_PAIR(0xB241, 0x6BEC)
+DOUBLE_BYTE_PAIR(0xB242, 0x6C2B)
+DOUBLE_BYTE_PAIR(0xB243, 0x6D8E)
+DOUBLE_BYTE_PAIR(0xB244, 0x6DBC)
+DOUBLE_BYTE_PAIR(0xB245, 0x6DF3)
+DOUBLE_BYTE_PAIR(0xB246, 0x6DD9)
+DOUBLE_BYTE_PAIR(0xB247, 0x6DB2)
+DOUBLE_BYTE_PAIR(0xB248, 0x6DE1)
+DOUBLE_BYTE_PAIR(0xB249, 0x6DCC)
+DOUBLE_BYTE_PAIR(0xB24A, 0x6DE4)
+DOUBLE_BYTE_PAIR(0xB24B, 0x6DFB)
+DOUBLE_BYTE_PAIR(0xB24C, 0x6DFA)
+DOUBLE_BYTE_PAIR(0xB24D, 0x6E05)
+DOUBLE_BYTE_PAIR(0xB24E, 0x6DC7)
+DOUBLE_BYTE_PAIR(0xB24F, 0x6DCB)
+DOUBLE_BYTE_PAIR(0xB250, 0x6DAF)
+DOUBLE_BYTE_PAIR(0xB251, 0x6DD1)
+DOUBLE_BYTE_PAIR(0xB252, 0x6DAE)
+DOUBLE_BYTE_PAIR(0xB253, 0x6DDE)
+DOUBLE_BYTE_PAIR(0xB254, 0x6DF9)
+DOUBLE_BYTE_PAIR(0xB255, 0x6DB8)
+DOUBLE_BYTE_PAIR(0xB256, 0x6DF7)
+DOUBLE_BYTE_PAIR(0xB257, 0x6DF5)
+DOUBLE_BYTE_PAIR(0xB258, 0x6DC5)
+DOUBLE_BYTE_PAIR(0xB259, 0x6DD2)
+DOUBLE_BYTE_PAIR(0xB25A, 0x6E1A)
+DOUBLE_BYTE_PAIR(0xB25B, 0x6DB5)
+DOUBLE_BYTE_PAIR(0xB25C, 0x6DDA)
+DOUBLE_BYTE_PAIR(0xB25D, 0x6DEB)
+DOUBLE_BYTE_PAIR(0xB25E, 0x6DD8)
+DOUBLE_BYTE_PAIR(0xB25F, 0x6DEA)
+DOUBLE_BYTE_PAIR(0xB260, 0x6DF1)
+DOUBLE_BYTE_PAIR(0xB261, 0x6DEE)
+DOUBLE_BYTE_PAIR(0xB262, 0x6DE8)
+DOUBLE_BYTE_PAIR(0xB263, 0x6DC6)
+DOUBLE_BYTE_PAIR(0xB264, 0x6DC4)
+DOUBLE_BYTE_PAIR(0xB265, 0x6DAA)
+DOUBLE_BYTE_PAIR(0xB266, 0x6DEC)
+DOUBLE_BYTE_PAIR(0xB267, 0x6DBF)
+DOUBLE_BYTE_PAIR(0xB268, 0x6DE6)
+DOUBLE_BYTE_PAIR(0xB269, 0x70F9)
+DOUBLE_BYTE_PAIR(0xB26A, 0x7109)
+DOUBLE_BYTE_PAIR(0xB26B, 0x710A)
+DOUBLE_BYTE_PAIR(0xB26C, 0x70FD)
+DOUBLE_BYTE_PAIR(0xB26D, 0x70EF)
+DOUBLE_BYTE_PAIR(0xB26E, 0x723D)
+DOUBLE_BYTE_PAIR(0xB26F, 0x727D)
+DOUBLE_BYTE_PAIR(0xB270, 0x7281)
+DOUBLE_BYTE_PAIR(0xB271, 0x731C)
+DOUBLE_BYTE_PAIR(0xB272, 0x731B)
+DOUBLE_BYTE_PAIR(0xB273, 0x7316)
+DOUBLE_BYTE_PAIR(0xB274, 0x7313)
+DOUBLE_BYTE_PAIR(0xB275, 0x7319)
+DOUBLE_BYTE_PAIR(0xB276, 0x7387)
+DOUBLE_BYTE_PAIR(0xB277, 0x7405)
+DOUBLE_BYTE_PAIR(0xB278, 0x740A)
+DOUBLE_BYTE_PAIR(0xB279, 0x7403)
+DOUBLE_BYTE_PAIR(0xB27A, 0x7406)
+DOUBLE_BYTE_PAIR(0xB27B, 0x73FE)
+DOUBLE_BYTE_PAIR(0xB27C, 0x740D)
+DOUBLE_BYTE_PAIR(0xB27D, 0x74E0)
+DOUBLE_BYTE_PAIR(0xB27E, 0x74F6)
+DOUBLE_BYTE_PAIR(0xB2A1, 0x74F7)
+DOUBLE_BYTE_PAIR(0xB2A2, 0x751C)
+DOUBLE_BYTE_PAIR(0xB2A3, 0x7522)
+DOUBLE_BYTE_PAIR(0xB2A4, 0x7565)
+DOUBLE_BYTE_PAIR(0xB2A5, 0x7566)
+DOUBLE_BYTE_PAIR(0xB2A6, 0x7562)
+DOUBLE_BYTE_PAIR(0xB2A7, 0x7570)
+DOUBLE_BYTE_PAIR(0xB2A8, 0x758F)
+DOUBLE_BYTE_PAIR(0xB2A9, 0x75D4)
+DOUBLE_BYTE_PAIR(0xB2AA, 0x75D5)
+DOUBLE_BYTE_PAIR(0xB2AB, 0x75B5)
+DOUBLE_BYTE_PAIR(0xB2AC, 0x75CA)
+DOUBLE_BYTE_PAIR(0xB2AD, 0x75CD)
+DOUBLE_BYTE_PAIR(0xB2AE, 0x768E)
+DOUBLE_BYTE_PAIR(0xB2AF, 0x76D4)
+DOUBLE_BYTE_PAIR(0xB2B0, 0x76D2)
+DOUBLE_BYTE_PAIR(0xB2B1, 0x76DB)
+DOUBLE_BYTE_PAIR(0xB2B2, 0x7737)
+DOUBLE_BYTE_PAIR(0xB2B3, 0x773E)
+DOUBLE_BYTE_PAIR(0xB2B4, 0x773C)
+DOUBLE_BYTE_PAIR(0xB2B5, 0x7736)
+DOUBLE_BYTE_PAIR(0xB2B6, 0x7738)
+DOUBLE_BYTE_PAIR(0xB2B7, 0x773A)
+DOUBLE_BYTE_PAIR(0xB2B8, 0x786B)
+DOUBLE_BYTE_PAIR(0xB2B9, 0x7843)
+DOUBLE_BYTE_PAIR(0xB2BA, 0x784E)
+DOUBLE_BYTE_PAIR(0xB2BB, 0x7965)
+DOUBLE_BYTE_PAIR(0xB2BC, 0x7968)
+DOUBLE_BYTE_PAIR(0xB2BD, 0x796D)
+DOUBLE_BYTE_PAIR(0xB2BE, 0x79FB)
+DOUBLE_BYTE_PAIR(0xB2BF, 0x7A92)
+DOUBLE_BYTE_PAIR(0xB2C0, 0x7A95)
+DOUBLE_BYTE_PAIR(0xB2C1, 0x7B20)
+DOUBLE_BYTE_PAIR(0xB2C2, 0x7B28)
+DOUBLE_BYTE_PAIR(0xB2C3, 0x7B1B)
+DOUBLE_BYTE_PAIR(0xB2C4, 0x7B2C)
+DOUBLE_BYTE_PAIR(0xB2C5, 0x7B26)
+DOUBLE_BYTE_PAIR(0xB2C6, 0x7B19)
+DOUBLE_BYTE_PAIR(0xB2C7, 0x7B1E)
+DOUBLE_BYTE_PAIR(0xB2C8, 0x7B2E)
+DOUBLE_BYTE_PAIR(0xB2C9, 0x7C92)
+DOUBLE_BYTE_PAIR(0xB2CA, 0x7C97)
+DOUBLE_BYTE_PAIR(0xB2CB, 0x7C95)
+DOUBLE_BYTE_PAIR(0xB2CC, 0x7D46)
+DOUBLE_BYTE_PAIR(0xB2CD, 0x7D43)
+DOUBLE_BYTE_PAIR(0xB2CE, 0x7D71)
+DOUBLE_BYTE_PAIR(0xB2CF, 0x7D2E)
+DOUBLE_BYTE_PAIR(0xB2D0, 0x7D39)
+DOUBLE_BYTE_PAIR(0xB2D1, 0x7D3C)
+DOUBLE_BYTE_PAIR(0xB2D2, 0x7D40)
+DOUBLE_BYTE_PAIR(0xB2D3, 0x7D30)
+DOUBLE_BYTE_PAIR(0xB2D4, 0x7D33)
+DOUBLE_BYTE_PAIR(0xB2D5, 0x7D44)
+DOUBLE_BYTE_PAIR(0xB2D6, 0x7D2F)
+DOUBLE_BYTE_PAIR(0xB2D7, 0x7D42)
+DOUBLE_BYTE_PAIR(0xB2D8, 0x7D32)
+DOUBLE_BYTE_PAIR(0xB2D9, 0x7D31)
+DOUBLE_BYTE_PAIR(0xB2DA, 0x7F3D)
+DOUBLE_BYTE_PAIR(0xB2DB, 0x7F9E)
+DOUBLE_BYTE_PAIR(0xB2DC, 0x7F9A)
+DOUBLE_BYTE_PAIR(0xB2DD, 0x7FCC)
+DOUBLE_BYTE_PAIR(0xB2DE, 0x7FCE)
+DOUBLE_BYTE_PAIR(0xB2DF, 0x7FD2)
+DOUBLE_BYTE_PAIR(0xB2E0, 0x801C)
+DOUBLE_BYTE_PAIR(0xB2E1, 0x804A)
+DOUBLE_BYTE_PAIR(0xB2E2, 0x8046)
+DOUBLE_BYTE_PAIR(0xB2E3, 0x812F)
+DOUBLE_BYTE_PAIR(0xB2E4, 0x8116)
+DOUBLE_BYTE_PAIR(0xB2E5, 0x8123)
+DOUBLE_BYTE_PAIR(0xB2E6, 0x812B)
+DOUBLE_BYTE_PAIR(0xB2E7, 0x8129)
+DOUBLE_BYTE_PAIR(0xB2E8, 0x8130)
+DOUBLE_BYTE_PAIR(0xB2E9, 0x8124)
+DOUBLE_BYTE_PAIR(0xB2EA, 0x8202)
+DOUBLE_BYTE_PAIR(0xB2EB, 0x8235)
+DOUBLE_BYTE_PAIR(0xB2EC, 0x8237)
+DOUBLE_BYTE_PAIR(0xB2ED, 0x8236)
+DOUBLE_BYTE_PAIR(0xB2EE, 0x8239)
+DOUBLE_BYTE_PAIR(0xB2EF, 0x838E)
+DOUBLE_BYTE_PAIR(0xB2F0, 0x839E)
+DOUBLE_BYTE_PAIR(0xB2F1, 0x8398)
+DOUBLE_BYTE_PAIR(0xB2F2, 0x8378)
+DOUBLE_BYTE_PAIR(0xB2F3, 0x83A2)
+DOUBLE_BYTE_PAIR(0xB2F4, 0x8396)
+DOUBLE_BYTE_PAIR(0xB2F5, 0x83BD)
+DOUBLE_BYTE_PAIR(0xB2F6, 0x83AB)
+DOUBLE_BYTE_PAIR(0xB2F7, 0x8392)
+DOUBLE_BYTE_PAIR(0xB2F8, 0x838A)
+DOUBLE_BYTE_PAIR(0xB2F9, 0x8393)
+DOUBLE_BYTE_PAIR(0xB2FA, 0x8389)
+DOUBLE_BYTE_PAIR(0xB2FB, 0x83A0)
+DOUBLE_BYTE_PAIR(0xB2FC, 0x8377)
+DOUBLE_BYTE_PAIR(0xB2FD, 0x837B)
+DOUBLE_BYTE_PAIR(0xB2FE, 0x837C)
+DOUBLE_BYTE_PAIR(0xB340, 0x8386)
+DOUBLE_BYTE_PAIR(0xB341, 0x83A7)
+DOUBLE_BYTE_PAIR(0xB342, 0x8655)
+DOUBLE_BYTE_PAIR(0xB343, 0x5F6A)
+DOUBLE_BYTE_PAIR(0xB344, 0x86C7)
+DOUBLE_BYTE_PAIR(0xB345, 0x86C0)
+DOUBLE_BYTE_PAIR(0xB346, 0x86B6)
+DOUBLE_BYTE_PAIR(0xB347, 0x86C4)
+DOUBLE_BYTE_PAIR(0xB348, 0x86B5)
+DOUBLE_BYTE_PAIR(0xB349, 0x86C6)
+DOUBLE_BYTE_PAIR(0xB34A, 0x86CB)
+DOUBLE_BYTE_PAIR(0xB34B, 0x86B1)
+DOUBLE_BYTE_PAIR(0xB34C, 0x86AF)
+DOUBLE_BYTE_PAIR(0xB34D, 0x86C9)
+DOUBLE_BYTE_PAIR(0xB34E, 0x8853)
+DOUBLE_BYTE_PAIR(0xB34F, 0x889E)
+DOUBLE_BYTE_PAIR(0xB350, 0x8888)
+DOUBLE_BYTE_PAIR(0xB351, 0x88AB)
+DOUBLE_BYTE_PAIR(0xB352, 0x8892)
+DOUBLE_BYTE_PAIR(0xB353, 0x8896)
+DOUBLE_BYTE_PAIR(0xB354, 0x888D)
+DOUBLE_BYTE_PAIR(0xB355, 0x888B)
+DOUBLE_BYTE_PAIR(0xB356, 0x8993)
+DOUBLE_BYTE_PAIR(0xB357, 0x898F)
+DOUBLE_BYTE_PAIR(0xB358, 0x8A2A)
+DOUBLE_BYTE_PAIR(0xB359, 0x8A1D)
+DOUBLE_BYTE_PAIR(0xB35A, 0x8A23)
+DOUBLE_BYTE_PAIR(0xB35B, 0x8A25)
+DOUBLE_BYTE_PAIR(0xB35C, 0x8A31)
+DOUBLE_BYTE_PAIR(0xB35D, 0x8A2D)
+DOUBLE_BYTE_PAIR(0xB35E, 0x8A1F)
+DOUBLE_BYTE_PAIR(0xB35F, 0x8A1B)
+DOUBLE_BYTE_PAIR(0xB360, 0x8A22)
+DOUBLE_BYTE_PAIR(0xB361, 0x8C49)
+DOUBLE_BYTE_PAIR(0xB362, 0x8C5A)
+DOUBLE_BYTE_PAIR(0xB363, 0x8CA9)
+DOUBLE_BYTE_PAIR(0xB364, 0x8CAC)
+DOUBLE_BYTE_PAIR(0xB365, 0x8CAB)
+DOUBLE_BYTE_PAIR(0xB366, 0x8CA8)
+DOUBLE_BYTE_PAIR(0xB367, 0x8CAA)
+DOUBLE_BYTE_PAIR(0xB368, 0x8CA7)
+DOUBLE_BYTE_PAIR(0xB369, 0x8D67)
+DOUBLE_BYTE_PAIR(0xB36A, 0x8D66)
+DOUBLE_BYTE_PAIR(0xB36B, 0x8DBE)
+DOUBLE_BYTE_PAIR(0xB36C, 0x8DBA)
+DOUBLE_BYTE_PAIR(0xB36D, 0x8EDB)
+DOUBLE_BYTE_PAIR(0xB36E, 0x8EDF)
+DOUBLE_BYTE_PAIR(0xB36F, 0x9019)
+DOUBLE_BYTE_PAIR(0xB370, 0x900D)
+DOUBLE_BYTE_PAIR(0xB371, 0x901A)
+DOUBLE_BYTE_PAIR(0xB372, 0x9017)
+DOUBLE_BYTE_PAIR(0xB373, 0x9023)
+DOUBLE_BYTE_PAIR(0xB374, 0x901F)
+DOUBLE_BYTE_PAIR(0xB375, 0x901D)
+DOUBLE_BYTE_PAIR(0xB376, 0x9010)
+DOUBLE_BYTE_PAIR(0xB377, 0x9015)
+DOUBLE_BYTE_PAIR(0xB378, 0x901E)
+DOUBLE_BYTE_PAIR(0xB379, 0x9020)
+DOUBLE_BYTE_PAIR(0xB37A, 0x900F)
+DOUBLE_BYTE_PAIR(0xB37B, 0x9022)
+DOUBLE_BYTE_PAIR(0xB37C, 0x9016)
+DOUBLE_BYTE_PAIR(0xB37D, 0x901B)
+DOUBLE_BYTE_PAIR(0xB37E, 0x9014)
+DOUBLE_BYTE_PAIR(0xB3A1, 0x90E8)
+DOUBLE_BYTE_PAIR(0xB3A2, 0x90ED)
+DOUBLE_BYTE_PAIR(0xB3A3, 0x90FD)
+DOUBLE_BYTE_PAIR(0xB3A4, 0x9157)
+DOUBLE_BYTE_PAIR(0xB3A5, 0x91CE)
+DOUBLE_BYTE_PAIR(0xB3A6, 0x91F5)
+DOUBLE_BYTE_PAIR(0xB3A7, 0x91E6)
+DOUBLE_BYTE_PAIR(0xB3A8, 0x91E3)
+DOUBLE_BYTE_PAIR(0xB3A9, 0x91E7)
+DOUBLE_BYTE_PAIR(0xB3AA, 0x91ED)
+DOUBLE_BYTE_PAIR(0xB3AB, 0x91E9)
+DOUBLE_BYTE_PAIR(0xB3AC, 0x9589)
+DOUBLE_BYTE_PAIR(0xB3AD, 0x966A)
+DOUBLE_BYTE_PAIR(0xB3AE, 0x9675)
+DOUBLE_BYTE_PAIR(0xB3AF, 0x9673)
+DOUBLE_BYTE_PAIR(0xB3B0, 0x9678)
+DOUBLE_BYTE_PAIR(0xB3B1, 0x9670)
+DOUBLE_BYTE_PAIR(0xB3B2, 0x9674)
+DOUBLE_BYTE_PAIR(0xB3B3, 0x9676)
+DOUBLE_BYTE_PAIR(0xB3B4, 0x9677)
+DOUBLE_BYTE_PAIR(0xB3B5, 0x966C)
+DOUBLE_BYTE_PAIR(0xB3B6, 0x96C0)
+DOUBLE_BYTE_PAIR(0xB3B7, 0x96EA)
+DOUBLE_BYTE_PAIR(0xB3B8, 0x96E9)
+DOUBLE_BYTE_PAIR(0xB3B9, 0x7AE0)
+DOUBLE_BYTE_PAIR(0xB3BA, 0x7ADF)
+DOUBLE_BYTE_PAIR(0xB3BB, 0x9802)
+DOUBLE_BYTE_PAIR(0xB3BC, 0x9803)
+DOUBLE_BYTE_PAIR(0xB3BD, 0x9B5A)
+DOUBLE_BYTE_PAIR(0xB3BE, 0x9CE5)
+DOUBLE_BYTE_PAIR(0xB3BF, 0x9E75)
+DOUBLE_BYTE_PAIR(0xB3C0, 0x9E7F)
+DOUBLE_BYTE_PAIR(0xB3C1, 0x9EA5)
+DOUBLE_BYTE_PAIR(0xB3C2, 0x9EBB)
+DOUBLE_BYTE_PAIR(0xB3C3, 0x50A2)
+DOUBLE_BYTE_PAIR(0xB3C4, 0x508D)
+DOUBLE_BYTE_PAIR(0xB3C5, 0x5085)
+DOUBLE_BYTE_PAIR(0xB3C6, 0x5099)
+DOUBLE_BYTE_PAIR(0xB3C7, 0x5091)
+DOUBLE_BYTE_PAIR(0xB3C8, 0x5080)
+DOUBLE_BYTE_PAIR(0xB3C9, 0x5096)
+DOUBLE_BYTE_PAIR(0xB3CA, 0x5098)
+DOUBLE_BYTE_PAIR(0xB3CB, 0x509A)
+DOUBLE_BYTE_PAIR(0xB3CC, 0x6700)
+DOUBLE_BYTE_PAIR(0xB3CD, 0x51F1)
+DOUBLE_BYTE_PAIR(0xB3CE, 0x5272)
+DOUBLE_BYTE_PAIR(0xB3CF, 0x5274)
+DOUBLE_BYTE_PAIR(0xB3D0, 0x5275)
+DOUBLE_BYTE_PAIR(0xB3D1, 0x5269)
+DOUBLE_BYTE_PAIR(0xB3D2, 0x52DE)
+DOUBLE_BYTE_PAIR(0xB3D3, 0x52DD)
+DOUBLE_BYTE_PAIR(0xB3D4, 0x52DB)
+DOUBLE_BYTE_PAIR(0xB3D5, 0x535A)
+DOUBLE_BYTE_PAIR(0xB3D6, 0x53A5)
+DOUBLE_BYTE_PAIR(0xB3D7, 0x557B)
+DOUBLE_BYTE_PAIR(0xB3D8, 0x5580)
+DOUBLE_BYTE_PAIR(0xB3D9, 0x55A7)
+DOUBLE_BYTE_PAIR(0xB3DA, 0x557C)
+DOUBLE_BYTE_PAIR(0xB3DB, 0x558A)
+DOUBLE_BYTE_PAIR(0xB3DC, 0x559D)
+DOUBLE_BYTE_PAIR(0xB3DD, 0x5598)
+DOUBLE_BYTE_PAIR(0xB3DE, 0x5582)
+DOUBLE_BYTE_PAIR(0xB3DF, 0x559C)
+DOUBLE_BYTE_PAIR(0xB3E0, 0x55AA)
+DOUBLE_BYTE_PAIR(0xB3E1, 0x5594)
+DOUBLE_BYTE_PAIR(0xB3E2, 0x5587)
+DOUBLE_BYTE_PAIR(0xB3E3, 0x558B)
+DOUBLE_BYTE_PAIR(0xB3E4, 0x5583)
+DOUBLE_BYTE_PAIR(0xB3E5, 0x55B3)
+DOUBLE_BYTE_PAIR(0xB3E6, 0x55AE)
+DOUBLE_BYTE_PAIR(0xB3E7, 0x559F)
+DOUBLE_BYTE_PAIR(0xB3E8, 0x553E)
+DOUBLE_BYTE_PAIR(0xB3E9, 0x55B2)
+DOUBLE_BYTE_PAIR(0xB3EA, 0x559A)
+DOUBLE_BYTE_PAIR(0xB3EB, 0x55BB)
+DOUBLE_BYTE_PAIR(0xB3EC, 0x55AC)
+DOUBLE_BYTE_PAIR(0xB3ED, 0x55B1)
+DOUBLE_BYTE_PAIR(0xB3EE, 0x557E)
+DOUBLE_BYTE_PAIR(0xB3EF, 0x5589)
+DOUBLE_BYTE_PAIR(0xB3F0, 0x55AB)
+DOUBLE_BYTE_PAIR(0xB3F1, 0x5599)
+DOUBLE_BYTE_PAIR(0xB3F2, 0x570D)
+DOUBLE_BYTE_PAIR(0xB3F3, 0x582F)
+DOUBLE_BYTE_PAIR(0xB3F4, 0x582A)
+DOUBLE_BYTE_PAIR(0xB3F5, 0x5834)
+DOUBLE_BYTE_PAIR(0xB3F6, 0x5824)
+DOUBLE_BYTE_PAIR(0xB3F7, 0x5830)
+DOUBLE_BYTE_PAIR(0xB3F8, 0x5831)
+DOUBLE_BYTE_PAIR(0xB3F9, 0x5821)
+DOUBLE_BYTE_PAIR(0xB3FA, 0x581D)
+DOUBLE_BYTE_PAIR(0xB3FB, 0x5820)
+DOUBLE_BYTE_PAIR(0xB3FC, 0x58F9)
+DOUBLE_BYTE_PAIR(0xB3FD, 0x58FA)
+DOUBLE_BYTE_PAIR(0xB3FE, 0x5960)
+DOUBLE_BYTE_PAIR(0xB440, 0x5A77)
+DOUBLE_BYTE_PAIR(0xB441, 0x5A9A)
+DOUBLE_BYTE_PAIR(0xB442, 0x5A7F)
+DOUBLE_BYTE_PAIR(0xB443, 0x5A92)
+DOUBLE_BYTE_PAIR(0xB444, 0x5A9B)
+DOUBLE_BYTE_PAIR(0xB445, 0x5AA7)
+DOUBLE_BYTE_PAIR(0xB446, 0x5B73)
+DOUBLE_BYTE_PAIR(0xB447, 0x5B71)
+DOUBLE_BYTE_PAIR(0xB448, 0x5BD2)
+DOUBLE_BYTE_PAIR(0xB449, 0x5BCC)
+DOUBLE_BYTE_PAIR(0xB44A, 0x5BD3)
+DOUBLE_BYTE_PAIR(0xB44B, 0x5BD0)
+DOUBLE_BYTE_PAIR(0xB44C, 0x5C0A)
+DOUBLE_BYTE_PAIR(0xB44D, 0x5C0B)
+DOUBLE_BYTE_PAIR(0xB44E, 0x5C31)
+DOUBLE_BYTE_PAIR(0xB44F, 0x5D4C)
+DOUBLE_BYTE_PAIR(0xB450, 0x5D50)
+DOUBLE_BYTE_PAIR(0xB451, 0x5D34)
+DOUBLE_BYTE_PAIR(0xB452, 0x5D47)
+DOUBLE_BYTE_PAIR(0xB453, 0x5DFD)
+DOUBLE_BYTE_PAIR(0xB454, 0x5E45)
+DOUBLE_BYTE_PAIR(0xB455, 0x5E3D)
+DOUBLE_BYTE_PAIR(0xB456, 0x5E40)
+DOUBLE_BYTE_PAIR(0xB457, 0x5E43)
+DOUBLE_BYTE_PAIR(0xB458, 0x5E7E)
+DOUBLE_BYTE_PAIR(0xB459, 0x5ECA)
+DOUBLE_BYTE_PAIR(0xB45A, 0x5EC1)
+DOUBLE_BYTE_PAIR(0xB45B, 0x5EC2)
+DOUBLE_BYTE_PAIR(0xB45C, 0x5EC4)
+DOUBLE_BYTE_PAIR(0xB45D, 0x5F3C)
+DOUBLE_BYTE_PAIR(0xB45E, 0x5F6D)
+DOUBLE_BYTE_PAIR(0xB45F, 0x5FA9)
+DOUBLE_BYTE_PAIR(0xB460, 0x5FAA)
+DOUBLE_BYTE_PAIR(0xB461, 0x5FA8)
+DOUBLE_BYTE_PAIR(0xB462, 0x60D1)
+DOUBLE_BYTE_PAIR(0xB463, 0x60E1)
+DOUBLE_BYTE_PAIR(0xB464, 0x60B2)
+DOUBLE_BYTE_PAIR(0xB465, 0x60B6)
+DOUBLE_BYTE_PAIR(0xB466, 0x60E0)
+DOUBLE_BYTE_PAIR(0xB467, 0x611C)
+DOUBLE_BYTE_PAIR(0xB468, 0x6123)
+DOUBLE_BYTE_PAIR(0xB469, 0x60FA)
+DOUBLE_BYTE_PAIR(0xB46A, 0x6115)
+DOUBLE_BYTE_PAIR(0xB46B, 0x60F0)
+DOUBLE_BYTE_PAIR(0xB46C, 0x60FB)
+DOUBLE_BYTE_PAIR(0xB46D, 0x60F4)
+DOUBLE_BYTE_PAIR(0xB46E, 0x6168)
+DOUBLE_BYTE_PAIR(0xB46F, 0x60F1)
+DOUBLE_BYTE_PAIR(0xB470, 0x610E)
+DOUBLE_BYTE_PAIR(0xB471, 0x60F6)
+DOUBLE_BYTE_PAIR(0xB472, 0x6109)
+DOUBLE_BYTE_PAIR(0xB473, 0x6100)
+DOUBLE_BYTE_PAIR(0xB474, 0x6112)
+DOUBLE_BYTE_PAIR(0xB475, 0x621F)
+DOUBLE_BYTE_PAIR(0xB476, 0x6249)
+DOUBLE_BYTE_PAIR(0xB477, 0x63A3)
+DOUBLE_BYTE_PAIR(0xB478, 0x638C)
+DOUBLE_BYTE_PAIR(0xB479, 0x63CF)
+DOUBLE_BYTE_PAIR(0xB47A, 0x63C0)
+DOUBLE_BYTE_PAIR(0xB47B, 0x63E9)
+DOUBLE_BYTE_PAIR(0xB47C, 0x63C9)
+DOUBLE_BYTE_PAIR(0xB47D, 0x63C6)
+DOUBLE_BYTE_PAIR(0xB47E, 0x63CD)
+DOUBLE_BYTE_PAIR(0xB4A1, 0x63D2)
+DOUBLE_BYTE_PAIR(0xB4A2, 0x63E3)
+DOUBLE_BYTE_PAIR(0xB4A3, 0x63D0)
+DOUBLE_BYTE_PAIR(0xB4A4, 0x63E1)
+DOUBLE_BYTE_PAIR(0xB4A5, 0x63D6)
+DOUBLE_BYTE_PAIR(0xB4A6, 0x63ED)
+DOUBLE_BYTE_PAIR(0xB4A7, 0x63EE)
+DOUBLE_BYTE_PAIR(0xB4A8, 0x6376)
+DOUBLE_BYTE_PAIR(0xB4A9, 0x63F4)
+DOUBLE_BYTE_PAIR(0xB4AA, 0x63EA)
+DOUBLE_BYTE_PAIR(0xB4AB, 0x63DB)
+DOUBLE_BYTE_PAIR(0xB4AC, 0x6452)
+DOUBLE_BYTE_PAIR(0xB4AD, 0x63DA)
+DOUBLE_BYTE_PAIR(0xB4AE, 0x63F9)
+DOUBLE_BYTE_PAIR(0xB4AF, 0x655E)
+DOUBLE_BYTE_PAIR(0xB4B0, 0x6566)
+DOUBLE_BYTE_PAIR(0xB4B1, 0x6562)
+DOUBLE_BYTE_PAIR(0xB4B2, 0x6563)
+DOUBLE_BYTE_PAIR(0xB4B3, 0x6591)
+DOUBLE_BYTE_PAIR(0xB4B4, 0x6590)
+DOUBLE_BYTE_PAIR(0xB4B5, 0x65AF)
+DOUBLE_BYTE_PAIR(0xB4B6, 0x666E)
+DOUBLE_BYTE_PAIR(0xB4B7, 0x6670)
+DOUBLE_BYTE_PAIR(0xB4B8, 0x6674)
+DOUBLE_BYTE_PAIR(0xB4B9, 0x6676)
+DOUBLE_BYTE_PAIR(0xB4BA, 0x666F)
+DOUBLE_BYTE_PAIR(0xB4BB, 0x6691)
+DOUBLE_BYTE_PAIR(0xB4BC, 0x667A)
+DOUBLE_BYTE_PAIR(0xB4BD, 0x667E)
+DOUBLE_BYTE_PAIR(0xB4BE, 0x6677)
+DOUBLE_BYTE_PAIR(0xB4BF, 0x66FE)
+DOUBLE_BYTE_PAIR(0xB4C0, 0x66FF)
+DOUBLE_BYTE_PAIR(0xB4C1, 0x671F)
+DOUBLE_BYTE_PAIR(0xB4C2, 0x671D)
+DOUBLE_BYTE_PAIR(0xB4C3, 0x68FA)
+DOUBLE_BYTE_PAIR(0xB4C4, 0x68D5)
+DOUBLE_BYTE_PAIR(0xB4C5, 0x68E0)
+DOUBLE_BYTE_PAIR(0xB4C6, 0x68D8)
+DOUBLE_BYTE_PAIR(0xB4C7, 0x68D7)
+DOUBLE_BYTE_PAIR(0xB4C8, 0x6905)
+DOUBLE_BYTE_PAIR(0xB4C9, 0x68DF)
+DOUBLE_BYTE_PAIR(0xB4CA, 0x68F5)
+DOUBLE_BYTE_PAIR(0xB4CB, 0x68EE)
+DOUBLE_BYTE_PAIR(0xB4CC, 0x68E7)
+DOUBLE_BYTE_PAIR(0xB4CD, 0x68F9)
+DOUBLE_BYTE_PAIR(0xB4CE, 0x68D2)
+DOUBLE_BYTE_PAIR(0xB4CF, 0x68F2)
+DOUBLE_BYTE_PAIR(0xB4D0, 0x68E3)
+DOUBLE_BYTE_PAIR(0xB4D1, 0x68CB)
+DOUBLE_BYTE_PAIR(0xB4D2, 0x68CD)
+DOUBLE_BYTE_PAIR(0xB4D3, 0x690D)
+DOUBLE_BYTE_PAIR(0xB4D4, 0x6912)
+DOUBLE_BYTE_PAIR(0xB4D5, 0x690E)
+DOUBLE_BYTE_PAIR(0xB4D6, 0x68C9)
+DOUBLE_BYTE_PAIR(0xB4D7, 0x68DA)
+DOUBLE_BYTE_PAIR(0xB4D8, 0x696E)
+DOUBLE_BYTE_PAIR(0xB4D9, 0x68FB)
+DOUBLE_BYTE_PAIR(0xB4DA, 0x6B3E)
+DOUBLE_BYTE_PAIR(0xB4DB, 0x6B3A)
+DOUBLE_BYTE_PAIR(0xB4DC, 0x6B3D)
+DOUBLE_BYTE_PAIR(0xB4DD, 0x6B98)
+DOUBLE_BYTE_PAIR(0xB4DE, 0x6B96)
+DOUBLE_BYTE_PAIR(0xB4DF, 0x6BBC)
+DOUBLE_BYTE_PAIR(0xB4E0, 0x6BEF)
+DOUBLE_BYTE_PAIR(0xB4E1, 0x6C2E)
+DOUBLE_BYTE_PAIR(0xB4E2, 0x6C2F)
+DOUBLE_BYTE_PAIR(0xB4E3, 0x6C2C)
+DOUBLE_BYTE_PAIR(0xB4E4, 0x6E2F)
+DOUBLE_BYTE_PAIR(0xB4E5, 0x6E38)
+DOUBLE_BYTE_PAIR(0xB4E6, 0x6E54)
+DOUBLE_BYTE_PAIR(0xB4E7, 0x6E21)
+DOUBLE_BYTE_PAIR(0xB4E8, 0x6E32)
+DOUBLE_BYTE_PAIR(0xB4E9, 0x6E67)
+DOUBLE_BYTE_PAIR(0xB4EA, 0x6E4A)
+DOUBLE_BYTE_PAIR(0xB4EB, 0x6E20)
+DOUBLE_BYTE_PAIR(0xB4EC, 0x6E25)
+DOUBLE_BYTE_PAIR(0xB4ED, 0x6E23)
+DOUBLE_BYTE_PAIR(0xB4EE, 0x6E1B)
+DOUBLE_BYTE_PAIR(0xB4EF, 0x6E5B)
+DOUBLE_BYTE_PAIR(0xB4F0, 0x6E58)
+DOUBLE_BYTE_PAIR(0xB4F1, 0x6E24)
+DOUBLE_BYTE_PAIR(0xB4F2, 0x6E56)
+DOUBLE_BYTE_PAIR(0xB4F3, 0x6E6E)
+DOUBLE_BYTE_PAIR(0xB4F4, 0x6E2D)
+DOUBLE_BYTE_PAIR(0xB4F5, 0x6E26)
+DOUBLE_BYTE_PAIR(0xB4F6, 0x6E6F)
+DOUBLE_BYTE_PAIR(0xB4F7, 0x6E34)
+DOUBLE_BYTE_PAIR(0xB4F8, 0x6E4D)
+DOUBLE_BYTE_PAIR(0xB4F9, 0x6E3A)
+DOUBLE_BYTE_PAIR(0xB4FA, 0x6E2C)
+DOUBLE_BYTE_PAIR(0xB4FB, 0x6E43)
+DOUBLE_BYTE_PAIR(0xB4FC, 0x6E1D)
+DOUBLE_BYTE_PAIR(0xB4FD, 0x6E3E)
+DOUBLE_BYTE_PAIR(0xB4FE, 0x6ECB)
+DOUBLE_BYTE_PAIR(0xB540, 0x6E89)
+DOUBLE_BYTE_PAIR(0xB541, 0x6E19)
+DOUBLE_BYTE_PAIR(0xB542, 0x6E4E)
+DOUBLE_BYTE_PAIR(0xB543, 0x6E63)
+DOUBLE_BYTE_PAIR(0xB544, 0x6E44)
+DOUBLE_BYTE_PAIR(0xB545, 0x6E72)
+DOUBLE_BYTE_PAIR(0xB546, 0x6E69)
+DOUBLE_BYTE_PAIR(0xB547, 0x6E5F)
+DOUBLE_BYTE_PAIR(0xB548, 0x7119)
+DOUBLE_BYTE_PAIR(0xB549, 0x711A)
+DOUBLE_BYTE_PAIR(0xB54A, 0x7126)
+DOUBLE_BYTE_PAIR(0xB54B, 0x7130)
+DOUBLE_BYTE_PAIR(0xB54C, 0x7121)
+DOUBLE_BYTE_PAIR(0xB54D, 0x7136)
+DOUBLE_BYTE_PAIR(0xB54E, 0x716E)
+DOUBLE_BYTE_PAIR(0xB54F, 0x711C)
+DOUBLE_BYTE_PAIR(0xB550, 0x724C)
+DOUBLE_BYTE_PAIR(0xB551, 0x7284)
+DOUBLE_BYTE_PAIR(0xB552, 0x7280)
+DOUBLE_BYTE_PAIR(0xB553, 0x7336)
+DOUBLE_BYTE_PAIR(0xB554, 0x7325)
+DOUBLE_BYTE_PAIR(0xB555, 0x7334)
+DOUBLE_BYTE_PAIR(0xB556, 0x7329)
+DOUBLE_BYTE_PAIR(0xB557, 0x743A)
+DOUBLE_BYTE_PAIR(0xB558, 0x742A)
+DOUBLE_BYTE_PAIR(0xB559, 0x7433)
+DOUBLE_BYTE_PAIR(0xB55A, 0x7422)
+DOUBLE_BYTE_PAIR(0xB55B, 0x7425)
+DOUBLE_BYTE_PAIR(0xB55C, 0x7435)
+DOUBLE_BYTE_PAIR(0xB55D, 0x7436)
+DOUBLE_BYTE_PAIR(0xB55E, 0x7434)
+DOUBLE_BYTE_PAIR(0xB55F, 0x742F)
+DOUBLE_BYTE_PAIR(0xB560, 0x741B)
+DOUBLE_BYTE_PAIR(0xB561, 0x7426)
+DOUBLE_BYTE_PAIR(0xB562, 0x7428)
+DOUBLE_BYTE_PAIR(0xB563, 0x7525)
+DOUBLE_BYTE_PAIR(0xB564, 0x7526)
+DOUBLE_BYTE_PAIR(0xB565, 0x756B)
+DOUBLE_BYTE_PAIR(0xB566, 0x756A)
+DOUBLE_BYTE_PAIR(0xB567, 0x75E2)
+DOUBLE_BYTE_PAIR(0xB568, 0x75DB)
+DOUBLE_BYTE_PAIR(0xB569, 0x75E3)
+DOUBLE_BYTE_PAIR(0xB56A, 0x75D9)
+DOUBLE_BYTE_PAIR(0xB56B, 0x75D8)
+DOUBLE_BYTE_PAIR(0xB56C, 0x75DE)
+DOUBLE_BYTE_PAIR(0xB56D, 0x75E0)
+DOUBLE_BYTE_PAIR(0xB56E, 0x767B)
+DOUBLE_BYTE_PAIR(0xB56F, 0x767C)
+DOUBLE_BYTE_PAIR(0xB570, 0x7696)
+DOUBLE_BYTE_PAIR(0xB571, 0x7693)
+DOUBLE_BYTE_PAIR(0xB572, 0x76B4)
+DOUBLE_BYTE_PAIR(0xB573, 0x76DC)
+DOUBLE_BYTE_PAIR(0xB574, 0x774F)
+DOUBLE_BYTE_PAIR(0xB575, 0x77ED)
+DOUBLE_BYTE_PAIR(0xB576, 0x785D)
+DOUBLE_BYTE_PAIR(0xB577, 0x786C)
+DOUBLE_BYTE_PAIR(0xB578, 0x786F)
+DOUBLE_BYTE_PAIR(0xB579, 0x7A0D)
+DOUBLE_BYTE_PAIR(0xB57A, 0x7A08)
+DOUBLE_BYTE_PAIR(0xB57B, 0x7A0B)
+DOUBLE_BYTE_PAIR(0xB57C, 0x7A05)
+DOUBLE_BYTE_PAIR(0xB57D, 0x7A00)
+DOUBLE_BYTE_PAIR(0xB57E, 0x7A98)
+DOUBLE_BYTE_PAIR(0xB5A1, 0x7A97)
+DOUBLE_BYTE_PAIR(0xB5A2, 0x7A96)
+DOUBLE_BYTE_PAIR(0xB5A3, 0x7AE5)
+DOUBLE_BYTE_PAIR(0xB5A4, 0x7AE3)
+DOUBLE_BYTE_PAIR(0xB5A5, 0x7B49)
+DOUBLE_BYTE_PAIR(0xB5A6, 0x7B56)
+DOUBLE_BYTE_PAIR(0xB5A7, 0x7B46)
+DOUBLE_BYTE_PAIR(0xB5A8, 0x7B50)
+DOUBLE_BYTE_PAIR(0xB5A9, 0x7B52)
+DOUBLE_BYTE_PAIR(0xB5AA, 0x7B54)
+DOUBLE_BYTE_PAIR(0xB5AB, 0x7B4D)
+DOUBLE_BYTE_PAIR(0xB5AC, 0x7B4B)
+DOUBLE_BYTE_PAIR(0xB5AD, 0x7B4F)
+DOUBLE_BYTE_PAIR(0xB5AE, 0x7B51)
+DOUBLE_BYTE_PAIR(0xB5AF, 0x7C9F)
+DOUBLE_BYTE_PAIR(0xB5B0, 0x7CA5)
+DOUBLE_BYTE_PAIR(0xB5B1, 0x7D5E)
+DOUBLE_BYTE_PAIR(0xB5B2, 0x7D50)
+DOUBLE_BYTE_PAIR(0xB5B3, 0x7D68)
+DOUBLE_BYTE_PAIR(0xB5B4, 0x7D55)
+DOUBLE_BYTE_PAIR(0xB5B5, 0x7D2B)
+DOUBLE_BYTE_PAIR(0xB5B6, 0x7D6E)
+DOUBLE_BYTE_PAIR(0xB5B7, 0x7D72)
+DOUBLE_BYTE_PAIR(0xB5B8, 0x7D61)
+DOUBLE_BYTE_PAIR(0xB5B9, 0x7D66)
+DOUBLE_BYTE_PAIR(0xB5BA, 0x7D62)
+DOUBLE_BYTE_PAIR(0xB5BB, 0x7D70)
+DOUBLE_BYTE_PAIR(0xB5BC, 0x7D73)
+DOUBLE_BYTE_PAIR(0xB5BD, 0x5584)
+DOUBLE_BYTE_PAIR(0xB5BE, 0x7FD4)
+DOUBLE_BYTE_PAIR(0xB5BF, 0x7FD5)
+DOUBLE_BYTE_PAIR(0xB5C0, 0x800B)
+DOUBLE_BYTE_PAIR(0xB5C1, 0x8052)
+DOUBLE_BYTE_PAIR(0xB5C2, 0x8085)
+DOUBLE_BYTE_PAIR(0xB5C3, 0x8155)
+DOUBLE_BYTE_PAIR(0xB5C4, 0x8154)
+DOUBLE_BYTE_PAIR(0xB5C5, 0x814B)
+DOUBLE_BYTE_PAIR(0xB5C6, 0x8151)
+DOUBLE_BYTE_PAIR(0xB5C7, 0x814E)
+DOUBLE_BYTE_PAIR(0xB5C8, 0x8139)
+DOUBLE_BYTE_PAIR(0xB5C9, 0x8146)
+DOUBLE_BYTE_PAIR(0xB5CA, 0x813E)
+DOUBLE_BYTE_PAIR(0xB5CB, 0x814C)
+DOUBLE_BYTE_PAIR(0xB5CC, 0x8153)
+DOUBLE_BYTE_PAIR(0xB5CD, 0x8174)
+DOUBLE_BYTE_PAIR(0xB5CE, 0x8212)
+DOUBLE_BYTE_PAIR(0xB5CF, 0x821C)
+DOUBLE_BYTE_PAIR(0xB5D0, 0x83E9)
+DOUBLE_BYTE_PAIR(0xB5D1, 0x8403)
+DOUBLE_BYTE_PAIR(0xB5D2, 0x83F8)
+DOUBLE_BYTE_PAIR(0xB5D3, 0x840D)
+DOUBLE_BYTE_PAIR(0xB5D4, 0x83E0)
+DOUBLE_BYTE_PAIR(0xB5D5, 0x83C5)
+DOUBLE_BYTE_PAIR(0xB5D6, 0x840B)
+DOUBLE_BYTE_PAIR(0xB5D7, 0x83C1)
+DOUBLE_BYTE_PAIR(0xB5D8, 0x83EF)
+DOUBLE_BYTE_PAIR(0xB5D9, 0x83F1)
+DOUBLE_BYTE_PAIR(0xB5DA, 0x83F4)
+DOUBLE_BYTE_PAIR(0xB5DB, 0x8457)
+DOUBLE_BYTE_PAIR(0xB5DC, 0x840A)
+DOUBLE_BYTE_PAIR(0xB5DD, 0x83F0)
+DOUBLE_BYTE_PAIR(0xB5DE, 0x840C)
+DOUBLE_BYTE_PAIR(0xB5DF, 0x83CC)
+DOUBLE_BYTE_PAIR(0xB5E0, 0x83FD)
+DOUBLE_BYTE_PAIR(0xB5E1, 0x83F2)
+DOUBLE_BYTE_PAIR(0xB5E2, 0x83CA)
+DOUBLE_BYTE_PAIR(0xB5E3, 0x8438)
+DOUBLE_BYTE_PAIR(0xB5E4, 0x840E)
+DOUBLE_BYTE_PAIR(0xB5E5, 0x8404)
+DOUBLE_BYTE_PAIR(0xB5E6, 0x83DC)
+DOUBLE_BYTE_PAIR(0xB5E7, 0x8407)
+DOUBLE_BYTE_PAIR(0xB5E8, 0x83D4)
+DOUBLE_BYTE_PAIR(0xB5E9, 0x83DF)
+DOUBLE_BYTE_PAIR(0xB5EA, 0x865B)
+DOUBLE_BYTE_PAIR(0xB5EB, 0x86DF)
+DOUBLE_BYTE_PAIR(0xB5EC, 0x86D9)
+DOUBLE_BYTE_PAIR(0xB5ED, 0x86ED)
+DOUBLE_BYTE_PAIR(0xB5EE, 0x86D4)
+DOUBLE_BYTE_PAIR(0xB5EF, 0x86DB)
+DOUBLE_BYTE_PAIR(0xB5F0, 0x86E4)
+DOUBLE_BYTE_PAIR(0xB5F1, 0x86D0)
+DOUBLE_BYTE_PAIR(0xB5F2, 0x86DE)
+DOUBLE_BYTE_PAIR(0xB5F3, 0x8857)
+DOUBLE_BYTE_PAIR(0xB5F4, 0x88C1)
+DOUBLE_BYTE_PAIR(0xB5F5, 0x88C2)
+DOUBLE_BYTE_PAIR(0xB5F6, 0x88B1)
+DOUBLE_BYTE_PAIR(0xB5F7, 0x8983)
+DOUBLE_BYTE_PAIR(0xB5F8, 0x8996)
+DOUBLE_BYTE_PAIR(0xB5F9, 0x8A3B)
+DOUBLE_BYTE_PAIR(0xB5FA, 0x8A60)
+DOUBLE_BYTE_PAIR(0xB5FB, 0x8A55)
+DOUBLE_BYTE_PAIR(0xB5FC, 0x8A5E)
+DOUBLE_BYTE_PAIR(0xB5FD, 0x8A3C)
+DOUBLE_BYTE_PAIR(0xB5FE, 0x8A41)
+DOUBLE_BYTE_PAIR(0xB640, 0x8A54)
+DOUBLE_BYTE_PAIR(0xB641, 0x8A5B)
+DOUBLE_BYTE_PAIR(0xB642, 0x8A50)
+DOUBLE_BYTE_PAIR(0xB643, 0x8A46)
+DOUBLE_BYTE_PAIR(0xB644, 0x8A34)
+DOUBLE_BYTE_PAIR(0xB645, 0x8A3A)
+DOUBLE_BYTE_PAIR(0xB646, 0x8A36)
+DOUBLE_BYTE_PAIR(0xB647, 0x8A56)
+DOUBLE_BYTE_PAIR(0xB648, 0x8C61)
+DOUBLE_BYTE_PAIR(0xB649, 0x8C82)
+DOUBLE_BYTE_PAIR(0xB64A, 0x8CAF)
+DOUBLE_BYTE_PAIR(0xB64B, 0x8CBC)
+DOUBLE_BYTE_PAIR(0xB64C, 0x8CB3)
+DOUBLE_BYTE_PAIR(0xB64D, 0x8CBD)
+DOUBLE_BYTE_PAIR(0xB64E, 0x8CC1)
+DOUBLE_BYTE_PAIR(0xB64F, 0x8CBB)
+DOUBLE_BYTE_PAIR(0xB650, 0x8CC0)
+DOUBLE_BYTE_PAIR(0xB651, 0x8CB4)
+DOUBLE_BYTE_PAIR(0xB652, 0x8CB7)
+DOUBLE_BYTE_PAIR(0xB653, 0x8CB6)
+DOUBLE_BYTE_PAIR(0xB654, 0x8CBF)
+DOUBLE_BYTE_PAIR(0xB655, 0x8CB8)
+DOUBLE_BYTE_PAIR(0xB656, 0x8D8A)
+DOUBLE_BYTE_PAIR(0xB657, 0x8D85)
+DOUBLE_BYTE_PAIR(0xB658, 0x8D81)
+DOUBLE_BYTE_PAIR(0xB659, 0x8DCE)
+DOUBLE_BYTE_PAIR(0xB65A, 0x8DDD)
+DOUBLE_BYTE_PAIR(0xB65B, 0x8DCB)
+DOUBLE_BYTE_PAIR(0xB65C, 0x8DDA)
+DOUBLE_BYTE_PAIR(0xB65D, 0x8DD1)
+DOUBLE_BYTE_PAIR(0xB65E, 0x8DCC)
+DOUBLE_BYTE_PAIR(0xB65F, 0x8DDB)
+DOUBLE_BYTE_PAIR(0xB660, 0x8DC6)
+DOUBLE_BYTE_PAIR(0xB661, 0x8EFB)
+DOUBLE_BYTE_PAIR(0xB662, 0x8EF8)
+DOUBLE_BYTE_PAIR(0xB663, 0x8EFC)
+DOUBLE_BYTE_PAIR(0xB664, 0x8F9C)
+DOUBLE_BYTE_PAIR(0xB665, 0x902E)
+DOUBLE_BYTE_PAIR(0xB666, 0x9035)
+DOUBLE_BYTE_PAIR(0xB667, 0x9031)
+DOUBLE_BYTE_PAIR(0xB668, 0x9038)
+DOUBLE_BYTE_PAIR(0xB669, 0x9032)
+DOUBLE_BYTE_PAIR(0xB66A, 0x9036)
+DOUBLE_BYTE_PAIR(0xB66B, 0x9102)
+DOUBLE_BYTE_PAIR(0xB66C, 0x90F5)
+DOUBLE_BYTE_PAIR(0xB66D, 0x9109)
+DOUBLE_BYTE_PAIR(0xB66E, 0x90FE)
+DOUBLE_BYTE_PAIR(0xB66F, 0x9163)
+DOUBLE_BYTE_PAIR(0xB670, 0x9165)
+DOUBLE_BYTE_PAIR(0xB671, 0x91CF)
+DOUBLE_BYTE_PAIR(0xB672, 0x9214)
+DOUBLE_BYTE_PAIR(0xB673, 0x9215)
+DOUBLE_BYTE_PAIR(0xB674, 0x9223)
+DOUBLE_BYTE_PAIR(0xB675, 0x9209)
+DOUBLE_BYTE_PAIR(0xB676, 0x921E)
+DOUBLE_BYTE_PAIR(0xB677, 0x920D)
+DOUBLE_BYTE_PAIR(0xB678, 0x9210)
+DOUBLE_BYTE_PAIR(0xB679, 0x9207)
+DOUBLE_BYTE_PAIR(0xB67A, 0x9211)
+DOUBLE_BYTE_PAIR(0xB67B, 0x9594)
+DOUBLE_BYTE_PAIR(0xB67C, 0x958F)
+DOUBLE_BYTE_PAIR(0xB67D, 0x958B)
+DOUBLE_BYTE_PAIR(0xB67E, 0x9591)
+DOUBLE_BYTE_PAIR(0xB6A1, 0x9593)
+DOUBLE_BYTE_PAIR(0xB6A2, 0x9592)
+DOUBLE_BYTE_PAIR(0xB6A3, 0x958E)
+DOUBLE_BYTE_PAIR(0xB6A4, 0x968A)
+DOUBLE_BYTE_PAIR(0xB6A5, 0x968E)
+DOUBLE_BYTE_PAIR(0xB6A6, 0x968B)
+DOUBLE_BYTE_PAIR(0xB6A7, 0x967D)
+DOUBLE_BYTE_PAIR(0xB6A8, 0x9685)
+DOUBLE_BYTE_PAIR(0xB6A9, 0x9686)
+DOUBLE_BYTE_PAIR(0xB6AA, 0x968D)
+DOUBLE_BYTE_PAIR(0xB6AB, 0x9672)
+DOUBLE_BYTE_PAIR(0xB6AC, 0x9684)
+DOUBLE_BYTE_PAIR(0xB6AD, 0x96C1)
+DOUBLE_BYTE_PAIR(0xB6AE, 0x96C5)
+DOUBLE_BYTE_PAIR(0xB6AF, 0x96C4)
+DOUBLE_BYTE_PAIR(0xB6B0, 0x96C6)
+DOUBLE_BYTE_PAIR(0xB6B1, 0x96C7)
+DOUBLE_BYTE_PAIR(0xB6B2, 0x96EF)
+DOUBLE_BYTE_PAIR(0xB6B3, 0x96F2)
+DOUBLE_BYTE_PAIR(0xB6B4, 0x97CC)
+DOUBLE_BYTE_PAIR(0xB6B5, 0x9805)
+DOUBLE_BYTE_PAIR(0xB6B6, 0x9806)
+DOUBLE_BYTE_PAIR(0xB6B7, 0x9808)
+DOUBLE_BYTE_PAIR(0xB6B8, 0x98E7)
+DOUBLE_BYTE_PAIR(0xB6B9, 0x98EA)
+DOUBLE_BYTE_PAIR(0xB6BA, 0x98EF)
+DOUBLE_BYTE_PAIR(0xB6BB, 0x98E9)
+DOUBLE_BYTE_PAIR(0xB6BC, 0x98F2)
+DOUBLE_BYTE_PAIR(0xB6BD, 0x98ED)
+DOUBLE_BYTE_PAIR(0xB6BE, 0x99AE)
+DOUBLE_BYTE_PAIR(0xB6BF, 0x99AD)
+DOUBLE_BYTE_PAIR(0xB6C0, 0x9EC3)
+DOUBLE_BYTE_PAIR(0xB6C1, 0x9ECD)
+DOUBLE_BYTE_PAIR(0xB6C2, 0x9ED1)
+DOUBLE_BYTE_PAIR(0xB6C3, 0x4E82)
+DOUBLE_BYTE_PAIR(0xB6C4, 0x50AD)
+DOUBLE_BYTE_PAIR(0xB6C5, 0x50B5)
+DOUBLE_BYTE_PAIR(0xB6C6, 0x50B2)
+DOUBLE_BYTE_PAIR(0xB6C7, 0x50B3)
+DOUBLE_BYTE_PAIR(0xB6C8, 0x50C5)
+DOUBLE_BYTE_PAIR(0xB6C9, 0x50BE)
+DOUBLE_BYTE_PAIR(0xB6CA, 0x50AC)
+DOUBLE_BYTE_PAIR(0xB6CB, 0x50B7)
+DOUBLE_BYTE_PAIR(0xB6CC, 0x50BB)
+DOUBLE_BYTE_PAIR(0xB6CD, 0x50AF)
+DOUBLE_BYTE_PAIR(0xB6CE, 0x50C7)
+DOUBLE_BYTE_PAIR(0xB6CF, 0x527F)
+DOUBLE_BYTE_PAIR(0xB6D0, 0x5277)
+DOUBLE_BYTE_PAIR(0xB6D1, 0x527D)
+DOUBLE_BYTE_PAIR(0xB6D2, 0x52DF)
+DOUBLE_BYTE_PAIR(0xB6D3, 0x52E6)
+DOUBLE_BYTE_PAIR(0xB6D4, 0x52E4)
+DOUBLE_BYTE_PAIR(0xB6D5, 0x52E2)
+DOUBLE_BYTE_PAIR(0xB6D6, 0x52E3)
+DOUBLE_BYTE_PAIR(0xB6D7, 0x532F)
+DOUBLE_BYTE_PAIR(0xB6D8, 0x55DF)
+DOUBLE_BYTE_PAIR(0xB6D9, 0x55E8)
+DOUBLE_BYTE_PAIR(0xB6DA, 0x55D3)
+DOUBLE_BYTE_PAIR(0xB6DB, 0x55E6)
+DOUBLE_BYTE_PAIR(0xB6DC, 0x55CE)
+DOUBLE_BYTE_PAIR(0xB6DD, 0x55DC)
+DOUBLE_BYTE_PAIR(0xB6DE, 0x55C7)
+DOUBLE_BYTE_PAIR(0xB6DF, 0x55D1)
+DOUBLE_BYTE_PAIR(0xB6E0, 0x55E3)
+DOUBLE_BYTE_PAIR(0xB6E1, 0x55E4)
+DOUBLE_BYTE_PAIR(0xB6E2, 0x55EF)
+DOUBLE_BYTE_PAIR(0xB6E3, 0x55DA)
+DOUBLE_BYTE_PAIR(0xB6E4, 0x55E1)
+DOUBLE_BYTE_PAIR(0xB6E5, 0x55C5)
+DOUBLE_BYTE_PAIR(0xB6E6, 0x55C6)
+DOUBLE_BYTE_PAIR(0xB6E7, 0x55E5)
+DOUBLE_BYTE_PAIR(0xB6E8, 0x55C9)
+DOUBLE_BYTE_PAIR(0xB6E9, 0x5712)
+DOUBLE_BYTE_PAIR(0xB6EA, 0x5713)
+DOUBLE_BYTE_PAIR(0xB6EB, 0x585E)
+DOUBLE_BYTE_PAIR(0xB6EC, 0x5851)
+DOUBLE_BYTE_PAIR(0xB6ED, 0x5858)
+DOUBLE_BYTE_PAIR(0xB6EE, 0x5857)
+DOUBLE_BYTE_PAIR(0xB6EF, 0x585A)
+DOUBLE_BYTE_PAIR(0xB6F0, 0x5854)
+DOUBLE_BYTE_PAIR(0xB6F1, 0x586B)
+DOUBLE_BYTE_PAIR(0xB6F2, 0x584C)
+DOUBLE_BYTE_PAIR(0xB6F3, 0x586D)
+DOUBLE_BYTE_PAIR(0xB6F4, 0x584A)
+DOUBLE_BYTE_PAIR(0xB6F5, 0x5862)
+DOUBLE_BYTE_PAIR(0xB6F6, 0x5852)
+DOUBLE_BYTE_PAIR(0xB6F7, 0x584B)
+DOUBLE_BYTE_PAIR(0xB6F8, 0x5967)
+DOUBLE_BYTE_PAIR(0xB6F9, 0x5AC1)
+DOUBLE_BYTE_PAIR(0xB6FA, 0x5AC9)
+DOUBLE_BYTE_PAIR(0xB6FB, 0x5ACC)
+DOUBLE_BYTE_PAIR(0xB6FC, 0x5ABE)
+DOUBLE_BYTE_PAIR(0xB6FD, 0x5ABD)
+DOUBLE_BYTE_PAIR(0xB6FE, 0x5ABC)
+DOUBLE_BYTE_PAIR(0xB740, 0x5AB3)
+DOUBLE_BYTE_PAIR(0xB741, 0x5AC2)
+DOUBLE_BYTE_PAIR(0xB742, 0x5AB2)
+DOUBLE_BYTE_PAIR(0xB743, 0x5D69)
+DOUBLE_BYTE_PAIR(0xB744, 0x5D6F)
+DOUBLE_BYTE_PAIR(0xB745, 0x5E4C)
+DOUBLE_BYTE_PAIR(0xB746, 0x5E79)
+DOUBLE_BYTE_PAIR(0xB747, 0x5EC9)
+DOUBLE_BYTE_PAIR(0xB748, 0x5EC8)
+DOUBLE_BYTE_PAIR(0xB749, 0x5F12)
+DOUBLE_BYTE_PAIR(0xB74A, 0x5F59)
+DOUBLE_BYTE_PAIR(0xB74B, 0x5FAC)
+DOUBLE_BYTE_PAIR(0xB74C, 0x5FAE)
+DOUBLE_BYTE_PAIR(0xB74D, 0x611A)
+DOUBLE_BYTE_PAIR(0xB74E, 0x610F)
+DOUBLE_BYTE_PAIR(0xB74F, 0x6148)
+DOUBLE_BYTE_PAIR(0xB750, 0x611F)
+DOUBLE_BYTE_PAIR(0xB751, 0x60F3)
+DOUBLE_BYTE_PAIR(0xB752, 0x611B)
+DOUBLE_BYTE_PAIR(0xB753, 0x60F9)
+DOUBLE_BYTE_PAIR(0xB754, 0x6101)
+DOUBLE_BYTE_PAIR(0xB755, 0x6108)
+DOUBLE_BYTE_PAIR(0xB756, 0x614E)
+DOUBLE_BYTE_PAIR(0xB757, 0x614C)
+DOUBLE_BYTE_PAIR(0xB758, 0x6144)
+DOUBLE_BYTE_PAIR(0xB759, 0x614D)
+DOUBLE_BYTE_PAIR(0xB75A, 0x613E)
+DOUBLE_BYTE_PAIR(0xB75B, 0x6134)
+DOUBLE_BYTE_PAIR(0xB75C, 0x6127)
+DOUBLE_BYTE_PAIR(0xB75D, 0x610D)
+DOUBLE_BYTE_PAIR(0xB75E, 0x6106)
+DOUBLE_BYTE_PAIR(0xB75F, 0x6137)
+DOUBLE_BYTE_PAIR(0xB760, 0x6221)
+DOUBLE_BYTE_PAIR(0xB761, 0x6222)
+DOUBLE_BYTE_PAIR(0xB762, 0x6413)
+DOUBLE_BYTE_PAIR(0xB763, 0x643E)
+DOUBLE_BYTE_PAIR(0xB764, 0x641E)
+DOUBLE_BYTE_PAIR(0xB765, 0x642A)
+DOUBLE_BYTE_PAIR(0xB766, 0x642D)
+DOUBLE_BYTE_PAIR(0xB767, 0x643D)
+DOUBLE_BYTE_PAIR(0xB768, 0x642C)
+DOUBLE_BYTE_PAIR(0xB769, 0x640F)
+DOUBLE_BYTE_PAIR(0xB76A, 0x641C)
+DOUBLE_BYTE_PAIR(0xB76B, 0x6414)
+DOUBLE_BYTE_PAIR(0xB76C, 0x640D)
+DOUBLE_BYTE_PAIR(0xB76D, 0x6436)
+DOUBLE_BYTE_PAIR(0xB76E, 0x6416)
+DOUBLE_BYTE_PAIR(0xB76F, 0x6417)
+DOUBLE_BYTE_PAIR(0xB770, 0x6406)
+DOUBLE_BYTE_PAIR(0xB771, 0x656C)
+DOUBLE_BYTE_PAIR(0xB772, 0x659F)
+DOUBLE_BYTE_PAIR(0xB773, 0x65B0)
+DOUBLE_BYTE_PAIR(0xB774, 0x6697)
+DOUBLE_BYTE_PAIR(0xB775, 0x6689)
+DOUBLE_BYTE_PAIR(0xB776, 0x6687)
+DOUBLE_BYTE_PAIR(0xB777, 0x6688)
+DOUBLE_BYTE_PAIR(0xB778, 0x6696)
+DOUBLE_BYTE_PAIR(0xB779, 0x6684)
+DOUBLE_BYTE_PAIR(0xB77A, 0x6698)
+DOUBLE_BYTE_PAIR(0xB77B, 0x668D)
+DOUBLE_BYTE_PAIR(0xB77C, 0x6703)
+DOUBLE_BYTE_PAIR(0xB77D, 0x6994)
+DOUBLE_BYTE_PAIR(0xB77E, 0x696D)
+DOUBLE_BYTE_PAIR(0xB7A1, 0x695A)
+DOUBLE_BYTE_PAIR(0xB7A2, 0x6977)
+DOUBLE_BYTE_PAIR(0xB7A3, 0x6960)
+DOUBLE_BYTE_PAIR(0xB7A4, 0x6954)
+DOUBLE_BYTE_PAIR(0xB7A5, 0x6975)
+DOUBLE_BYTE_PAIR(0xB7A6, 0x6930)
+DOUBLE_BYTE_PAIR(0xB7A7, 0x6982)
+DOUBLE_BYTE_PAIR(0xB7A8, 0x694A)
+DOUBLE_BYTE_PAIR(0xB7A9, 0x6968)
+DOUBLE_BYTE_PAIR(0xB7AA, 0x696B)
+DOUBLE_BYTE_PAIR(0xB7AB, 0x695E)
+DOUBLE_BYTE_PAIR(0xB7AC, 0x6953)
+DOUBLE_BYTE_PAIR(0xB7AD, 0x6979)
+DOUBLE_BYTE_PAIR(0xB7AE, 0x6986)
+DOUBLE_BYTE_PAIR(0xB7AF, 0x695D)
+DOUBLE_BYTE_PAIR(0xB7B0, 0x6963)
+DOUBLE_BYTE_PAIR(0xB7B1, 0x695B)
+DOUBLE_BYTE_PAIR(0xB7B2, 0x6B47)
+DOUBLE_BYTE_PAIR(0xB7B3, 0x6B72)
+DOUBLE_BYTE_PAIR(0xB7B4, 0x6BC0)
+DOUBLE_BYTE_PAIR(0xB7B5, 0x6BBF)
+DOUBLE_BYTE_PAIR(0xB7B6, 0x6BD3)
+DOUBLE_BYTE_PAIR(0xB7B7, 0x6BFD)
+DOUBLE_BYTE_PAIR(0xB7B8, 0x6EA2)
+DOUBLE_BYTE_PAIR(0xB7B9, 0x6EAF)
+DOUBLE_BYTE_PAIR(0xB7BA, 0x6ED3)
+DOUBLE_BYTE_PAIR(0xB7BB, 0x6EB6)
+DOUBLE_BYTE_PAIR(0xB7BC, 0x6EC2)
+DOUBLE_BYTE_PAIR(0xB7BD, 0x6E90)
+DOUBLE_BYTE_PAIR(0xB7BE, 0x6E9D)
+DOUBLE_BYTE_PAIR(0xB7BF, 0x6EC7)
+DOUBLE_BYTE_PAIR(0xB7C0, 0x6EC5)
+DOUBLE_BYTE_PAIR(0xB7C1, 0x6EA5)
+DOUBLE_BYTE_PAIR(0xB7C2, 0x6E98)
+DOUBLE_BYTE_PAIR(0xB7C3, 0x6EBC)
+DOUBLE_BYTE_PAIR(0xB7C4, 0x6EBA)
+DOUBLE_BYTE_PAIR(0xB7C5, 0x6EAB)
+DOUBLE_BYTE_PAIR(0xB7C6, 0x6ED1)
+DOUBLE_BYTE_PAIR(0xB7C7, 0x6E96)
+DOUBLE_BYTE_PAIR(0xB7C8, 0x6E9C)
+DOUBLE_BYTE_PAIR(0xB7C9, 0x6EC4)
+DOUBLE_BYTE_PAIR(0xB7CA, 0x6ED4)
+DOUBLE_BYTE_PAIR(0xB7CB, 0x6EAA)
+DOUBLE_BYTE_PAIR(0xB7CC, 0x6EA7)
+DOUBLE_BYTE_PAIR(0xB7CD, 0x6EB4)
+DOUBLE_BYTE_PAIR(0xB7CE, 0x714E)
+DOUBLE_BYTE_PAIR(0xB7CF, 0x7159)
+DOUBLE_BYTE_PAIR(0xB7D0, 0x7169)
+DOUBLE_BYTE_PAIR(0xB7D1, 0x7164)
+DOUBLE_BYTE_PAIR(0xB7D2, 0x7149)
+DOUBLE_BYTE_PAIR(0xB7D3, 0x7167)
+DOUBLE_BYTE_PAIR(0xB7D4, 0x715C)
+DOUBLE_BYTE_PAIR(0xB7D5, 0x716C)
+DOUBLE_BYTE_PAIR(0xB7D6, 0x7166)
+DOUBLE_BYTE_PAIR(0xB7D7, 0x714C)
+DOUBLE_BYTE_PAIR(0xB7D8, 0x7165)
+DOUBLE_BYTE_PAIR(0xB7D9, 0x715E)
+DOUBLE_BYTE_PAIR(0xB7DA, 0x7146)
+DOUBLE_BYTE_PAIR(0xB7DB, 0x7168)
+DOUBLE_BYTE_PAIR(0xB7DC, 0x7156)
+DOUBLE_BYTE_PAIR(0xB7DD, 0x723A)
+DOUBLE_BYTE_PAIR(0xB7DE, 0x7252)
+DOUBLE_BYTE_PAIR(0xB7DF, 0x7337)
+DOUBLE_BYTE_PAIR(0xB7E0, 0x7345)
+DOUBLE_BYTE_PAIR(0xB7E1, 0x733F)
+DOUBLE_BYTE_PAIR(0xB7E2, 0x733E)
+DOUBLE_BYTE_PAIR(0xB7E3, 0x746F)
+DOUBLE_BYTE_PAIR(0xB7E4, 0x745A)
+DOUBLE_BYTE_PAIR(0xB7E5, 0x7455)
+DOUBLE_BYTE_PAIR(0xB7E6, 0x745F)
+DOUBLE_BYTE_PAIR(0xB7E7, 0x745E)
+DOUBLE_BYTE_PAIR(0xB7E8, 0x7441)
+DOUBLE_BYTE_PAIR(0xB7E9, 0x743F)
+DOUBLE_BYTE_PAIR(0xB7EA, 0x7459)
+DOUBLE_BYTE_PAIR(0xB7EB, 0x745B)
+DOUBLE_BYTE_PAIR(0xB7EC, 0x745C)
+DOUBLE_BYTE_PAIR(0xB7ED, 0x7576)
+DOUBLE_BYTE_PAIR(0xB7EE, 0x7578)
+DOUBLE_BYTE_PAIR(0xB7EF, 0x7600)
+DOUBLE_BYTE_PAIR(0xB7F0, 0x75F0)
+DOUBLE_BYTE_PAIR(0xB7F1, 0x7601)
+DOUBLE_BYTE_PAIR(0xB7F2, 0x75F2)
+DOUBLE_BYTE_PAIR(0xB7F3, 0x75F1)
+DOUBLE_BYTE_PAIR(0xB7F4, 0x75FA)
+DOUBLE_BYTE_PAIR(0xB7F5, 0x75FF)
+DOUBLE_BYTE_PAIR(0xB7F6, 0x75F4)
+DOUBLE_BYTE_PAIR(0xB7F7, 0x75F3)
+DOUBLE_BYTE_PAIR(0xB7F8, 0x76DE)
+DOUBLE_BYTE_PAIR(0xB7F9, 0x76DF)
+DOUBLE_BYTE_PAIR(0xB7FA, 0x775B)
+DOUBLE_BYTE_PAIR(0xB7FB, 0x776B)
+DOUBLE_BYTE_PAIR(0xB7FC, 0x7766)
+DOUBLE_BYTE_PAIR(0xB7FD, 0x775E)
+DOUBLE_BYTE_PAIR(0xB7FE, 0x7763)
+DOUBLE_BYTE_PAIR(0xB840, 0x7779)
+DOUBLE_BYTE_PAIR(0xB841, 0x776A)
+DOUBLE_BYTE_PAIR(0xB842, 0x776C)
+DOUBLE_BYTE_PAIR(0xB843, 0x775C)
+DOUBLE_BYTE_PAIR(0xB844, 0x7765)
+DOUBLE_BYTE_PAIR(0xB845, 0x7768)
+DOUBLE_BYTE_PAIR(0xB846, 0x7762)
+DOUBLE_BYTE_PAIR(0xB847, 0x77EE)
+DOUBLE_BYTE_PAIR(0xB848, 0x788E)
+DOUBLE_BYTE_PAIR(0xB849, 0x78B0)
+DOUBLE_BYTE_PAIR(0xB84A, 0x7897)
+DOUBLE_BYTE_PAIR(0xB84B, 0x7898)
+DOUBLE_BYTE_PAIR(0xB84C, 0x788C)
+DOUBLE_BYTE_PAIR(0xB84D, 0x7889)
+DOUBLE_BYTE_PAIR(0xB84E, 0x787C)
+DOUBLE_BYTE_PAIR(0xB84F, 0x7891)
+DOUBLE_BYTE_PAIR(0xB850, 0x7893)
+DOUBLE_BYTE_PAIR(0xB851, 0x787F)
+DOUBLE_BYTE_PAIR(0xB852, 0x797A)
+DOUBLE_BYTE_PAIR(0xB853, 0x797F)
+DOUBLE_BYTE_PAIR(0xB854, 0x7981)
+DOUBLE_BYTE_PAIR(0xB855, 0x842C)
+DOUBLE_BYTE_PAIR(0xB856, 0x79BD)
+DOUBLE_BYTE_PAIR(0xB857, 0x7A1C)
+DOUBLE_BYTE_PAIR(0xB858, 0x7A1A)
+DOUBLE_BYTE_PAIR(0xB859, 0x7A20)
+DOUBLE_BYTE_PAIR(0xB85A, 0x7A14)
+DOUBLE_BYTE_PAIR(0xB85B, 0x7A1F)
+DOUBLE_BYTE_PAIR(0xB85C, 0x7A1E)
+DOUBLE_BYTE_PAIR(0xB85D, 0x7A9F)
+DOUBLE_BYTE_PAIR(0xB85E, 0x7AA0)
+DOUBLE_BYTE_PAIR(0xB85F, 0x7B77)
+DOUBLE_BYTE_PAIR(0xB860, 0x7BC0)
+DOUBLE_BYTE_PAIR(0xB861, 0x7B60)
+DOUBLE_BYTE_PAIR(0xB862, 0x7B6E)
+DOUBLE_BYTE_PAIR(0xB863, 0x7B67)
+DOUBLE_BYTE_PAIR(0xB864, 0x7CB1)
+DOUBLE_BYTE_PAIR(0xB865, 0x7CB3)
+DOUBLE_BYTE_PAIR(0xB866, 0x7CB5)
+DOUBLE_BYTE_PAIR(0xB867, 0x7D93)
+DOUBLE_BYTE_PAIR(0xB868, 0x7D79)
+DOUBLE_BYTE_PAIR(0xB869, 0x7D91)
+DOUBLE_BYTE_PAIR(0xB86A, 0x7D81)
+DOUBLE_BYTE_PAIR(0xB86B, 0x7D8F)
+DOUBLE_BYTE_PAIR(0xB86C, 0x7D5B)
+DOUBLE_BYTE_PAIR(0xB86D, 0x7F6E)
+DOUBLE_BYTE_PAIR(0xB86E, 0x7F69)
+DOUBLE_BYTE_PAIR(0xB86F, 0x7F6A)
+DOUBLE_BYTE_PAIR(0xB870, 0x7F72)
+DOUBLE_BYTE_PAIR(0xB871, 0x7FA9)
+DOUBLE_BYTE_PAIR(0xB872, 0x7FA8)
+DOUBLE_BYTE_PAIR(0xB873, 0x7FA4)
+DOUBLE_BYTE_PAIR(0xB874, 0x8056)
+DOUBLE_BYTE_PAIR(0xB875, 0x8058)
+DOUBLE_BYTE_PAIR(0xB876, 0x8086)
+DOUBLE_BYTE_PAIR(0xB877, 0x8084)
+DOUBLE_BYTE_PAIR(0xB878, 0x8171)
+DOUBLE_BYTE_PAIR(0xB879, 0x8170)
+DOUBLE_BYTE_PAIR(0xB87A, 0x8178)
+DOUBLE_BYTE_PAIR(0xB87B, 0x8165)
+DOUBLE_BYTE_PAIR(0xB87C, 0x816E)
+DOUBLE_BYTE_PAIR(0xB87D, 0x8173)
+DOUBLE_BYTE_PAIR(0xB87E, 0x816B)
+DOUBLE_BYTE_PAIR(0xB8A1, 0x8179)
+DOUBLE_BYTE_PAIR(0xB8A2, 0x817A)
+DOUBLE_BYTE_PAIR(0xB8A3, 0x8166)
+DOUBLE_BYTE_PAIR(0xB8A4, 0x8205)
+DOUBLE_BYTE_PAIR(0xB8A5, 0x8247)
+DOUBLE_BYTE_PAIR(0xB8A6, 0x8482)
+DOUBLE_BYTE_PAIR(0xB8A7, 0x8477)
+DOUBLE_BYTE_PAIR(0xB8A8, 0x843D)
+DOUBLE_BYTE_PAIR(0xB8A9, 0x8431)
+DOUBLE_BYTE_PAIR(0xB8AA, 0x8475)
+DOUBLE_BYTE_PAIR(0xB8AB, 0x8466)
+DOUBLE_BYTE_PAIR(0xB8AC, 0x846B)
+DOUBLE_BYTE_PAIR(0xB8AD, 0x8449)
+DOUBLE_BYTE_PAIR(0xB8AE, 0x846C)
+DOUBLE_BYTE_PAIR(0xB8AF, 0x845B)
+DOUBLE_BYTE_PAIR(0xB8B0, 0x843C)
+DOUBLE_BYTE_PAIR(0xB8B1, 0x8435)
+DOUBLE_BYTE_PAIR(0xB8B2, 0x8461)
+DOUBLE_BYTE_PAIR(0xB8B3, 0x8463)
+DOUBLE_BYTE_PAIR(0xB8B4, 0x8469)
+DOUBLE_BYTE_PAIR(0xB8B5, 0x846D)
+DOUBLE_BYTE_PAIR(0xB8B6, 0x8446)
+DOUBLE_BYTE_PAIR(0xB8B7, 0x865E)
+DOUBLE_BYTE_PAIR(0xB8B8, 0x865C)
+DOUBLE_BYTE_PAIR(0xB8B9, 0x865F)
+DOUBLE_BYTE_PAIR(0xB8BA, 0x86F9)
+DOUBLE_BYTE_PAIR(0xB8BB, 0x8713)
+DOUBLE_BYTE_PAIR(0xB8BC, 0x8708)
+DOUBLE_BYTE_PAIR(0xB8BD, 0x8707)
+DOUBLE_BYTE_PAIR(0xB8BE, 0x8700)
+DOUBLE_BYTE_PAIR(0xB8BF, 0x86FE)
+DOUBLE_BYTE_PAIR(0xB8C0, 0x86FB)
+DOUBLE_BYTE_PAIR(0xB8C1, 0x8702)
+DOUBLE_BYTE_PAIR(0xB8C2, 0x8703)
+DOUBLE_BYTE_PAIR(0xB8C3, 0x8706)
+DOUBLE_BYTE_PAIR(0xB8C4, 0x870A)
+DOUBLE_BYTE_PAIR(0xB8C5, 0x8859)
+DOUBLE_BYTE_PAIR(0xB8C6, 0x88DF)
+DOUBLE_BYTE_PAIR(0xB8C7, 0x88D4)
+DOUBLE_BYTE_PAIR(0xB8C8, 0x88D9)
+DOUBLE_BYTE_PAIR(0xB8C9, 0x88DC)
+DOUBLE_BYTE_PAIR(0xB8CA, 0x88D8)
+DOUBLE_BYTE_PAIR(0xB8CB, 0x88DD)
+DOUBLE_BYTE_PAIR(0xB8CC, 0x88E1)
+DOUBLE_BYTE_PAIR(0xB8CD, 0x88CA)
+DOUBLE_BYTE_PAIR(0xB8CE, 0x88D5)
+DOUBLE_BYTE_PAIR(0xB8CF, 0x88D2)
+DOUBLE_BYTE_PAIR(0xB8D0, 0x899C)
+DOUBLE_BYTE_PAIR(0xB8D1, 0x89E3)
+DOUBLE_BYTE_PAIR(0xB8D2, 0x8A6B)
+DOUBLE_BYTE_PAIR(0xB8D3, 0x8A72)
+DOUBLE_BYTE_PAIR(0xB8D4, 0x8A73)
+DOUBLE_BYTE_PAIR(0xB8D5, 0x8A66)
+DOUBLE_BYTE_PAIR(0xB8D6, 0x8A69)
+DOUBLE_BYTE_PAIR(0xB8D7, 0x8A70)
+DOUBLE_BYTE_PAIR(0xB8D8, 0x8A87)
+DOUBLE_BYTE_PAIR(0xB8D9, 0x8A7C)
+DOUBLE_BYTE_PAIR(0xB8DA, 0x8A63)
+DOUBLE_BYTE_PAIR(0xB8DB, 0x8AA0)
+DOUBLE_BYTE_PAIR(0xB8DC, 0x8A71)
+DOUBLE_BYTE_PAIR(0xB8DD, 0x8A85)
+DOUBLE_BYTE_PAIR(0xB8DE, 0x8A6D)
+DOUBLE_BYTE_PAIR(0xB8DF, 0x8A62)
+DOUBLE_BYTE_PAIR(0xB8E0, 0x8A6E)
+DOUBLE_BYTE_PAIR(0xB8E1, 0x8A6C)
+DOUBLE_BYTE_PAIR(0xB8E2, 0x8A79)
+DOUBLE_BYTE_PAIR(0xB8E3, 0x8A7B)
+DOUBLE_BYTE_PAIR(0xB8E4, 0x8A3E)
+DOUBLE_BYTE_PAIR(0xB8E5, 0x8A68)
+DOUBLE_BYTE_PAIR(0xB8E6, 0x8C62)
+DOUBLE_BYTE_PAIR(0xB8E7, 0x8C8A)
+DOUBLE_BYTE_PAIR(0xB8E8, 0x8C89)
+DOUBLE_BYTE_PAIR(0xB8E9, 0x8CCA)
+DOUBLE_BYTE_PAIR(0xB8EA, 0x8CC7)
+DOUBLE_BYTE_PAIR(0xB8EB, 0x8CC8)
+DOUBLE_BYTE_PAIR(0xB8EC, 0x8CC4)
+DOUBLE_BYTE_PAIR(0xB8ED, 0x8CB2)
+DOUBLE_BYTE_PAIR(0xB8EE, 0x8CC3)
+DOUBLE_BYTE_PAIR(0xB8EF, 0x8CC2)
+DOUBLE_BYTE_PAIR(0xB8F0, 0x8CC5)
+DOUBLE_BYTE_PAIR(0xB8F1, 0x8DE1)
+DOUBLE_BYTE_PAIR(0xB8F2, 0x8DDF)
+DOUBLE_BYTE_PAIR(0xB8F3, 0x8DE8)
+DOUBLE_BYTE_PAIR(0xB8F4, 0x8DEF)
+DOUBLE_BYTE_PAIR(0xB8F5, 0x8DF3)
+DOUBLE_BYTE_PAIR(0xB8F6, 0x8DFA)
+DOUBLE_BYTE_PAIR(0xB8F7, 0x8DEA)
+DOUBLE_BYTE_PAIR(0xB8F8, 0x8DE4)
+DOUBLE_BYTE_PAIR(0xB8F9, 0x8DE6)
+DOUBLE_BYTE_PAIR(0xB8FA, 0x8EB2)
+DOUBLE_BYTE_PAIR(0xB8FB, 0x8F03)
+DOUBLE_BYTE_PAIR(0xB8FC, 0x8F09)
+DOUBLE_BYTE_PAIR(0xB8FD, 0x8EFE)
+DOUBLE_BYTE_PAIR(0xB8FE, 0x8F0A)
+DOUBLE_BYTE_PAIR(0xB940, 0x8F9F)
+DOUBLE_BYTE_PAIR(0xB941, 0x8FB2)
+DOUBLE_BYTE_PAIR(0xB942, 0x904B)
+DOUBLE_BYTE_PAIR(0xB943, 0x904A)
+DOUBLE_BYTE_PAIR(0xB944, 0x9053)
+DOUBLE_BYTE_PAIR(0xB945, 0x9042)
+DOUBLE_BYTE_PAIR(0xB946, 0x9054)
+DOUBLE_BYTE_PAIR(0xB947, 0x903C)
+DOUBLE_BYTE_PAIR(0xB948, 0x9055)
+DOUBLE_BYTE_PAIR(0xB949, 0x9050)
+DOUBLE_BYTE_PAIR(0xB94A, 0x9047)
+DOUBLE_BYTE_PAIR(0xB94B, 0x904F)
+DOUBLE_BYTE_PAIR(0xB94C, 0x904E)
+DOUBLE_BYTE_PAIR(0xB94D, 0x904D)
+DOUBLE_BYTE_PAIR(0xB94E, 0x9051)
+DOUBLE_BYTE_PAIR(0xB94F, 0x903E)
+DOUBLE_BYTE_PAIR(0xB950, 0x9041)
+DOUBLE_BYTE_PAIR(0xB951, 0x9112)
+DOUBLE_BYTE_PAIR(0xB952, 0x9117)
+DOUBLE_BYTE_PAIR(0xB953, 0x916C)
+DOUBLE_BYTE_PAIR(0xB954, 0x916A)
+DOUBLE_BYTE_PAIR(0xB955, 0x9169)
+DOUBLE_BYTE_PAIR(0xB956, 0x91C9)
+DOUBLE_BYTE_PAIR(0xB957, 0x9237)
+DOUBLE_BYTE_PAIR(0xB958, 0x9257)
+DOUBLE_BYTE_PAIR(0xB959, 0x9238)
+DOUBLE_BYTE_PAIR(0xB95A, 0x923D)
+DOUBLE_BYTE_PAIR(0xB95B, 0x9240)
+DOUBLE_BYTE_PAIR(0xB95C, 0x923E)
+DOUBLE_BYTE_PAIR(0xB95D, 0x925B)
+DOUBLE_BYTE_PAIR(0xB95E, 0x924B)
+DOUBLE_BYTE_PAIR(0xB95F, 0x9264)
+DOUBLE_BYTE_PAIR(0xB960, 0x9251)
+DOUBLE_BYTE_PAIR(0xB961, 0x9234)
+DOUBLE_BYTE_PAIR(0xB962, 0x9249)
+DOUBLE_BYTE_PAIR(0xB963, 0x924D)
+DOUBLE_BYTE_PAIR(0xB964, 0x9245)
+DOUBLE_BYTE_PAIR(0xB965, 0x9239)
+DOUBLE_BYTE_PAIR(0xB966, 0x923F)
+DOUBLE_BYTE_PAIR(0xB967, 0x925A)
+DOUBLE_BYTE_PAIR(0xB968, 0x9598)
+DOUBLE_BYTE_PAIR(0xB969, 0x9698)
+DOUBLE_BYTE_PAIR(0xB96A, 0x9694)
+DOUBLE_BYTE_PAIR(0xB96B, 0x9695)
+DOUBLE_BYTE_PAIR(0xB96C, 0x96CD)
+DOUBLE_BYTE_PAIR(0xB96D, 0x96CB)
+DOUBLE_BYTE_PAIR(0xB96E, 0x96C9)
+DOUBLE_BYTE_PAIR(0xB96F, 0x96CA)
+DOUBLE_BYTE_PAIR(0xB970, 0x96F7)
+DOUBLE_BYTE_PAIR(0xB971, 0x96FB)
+DOUBLE_BYTE_PAIR(0xB972, 0x96F9)
+DOUBLE_BYTE_PAIR(0xB973, 0x96F6)
+DOUBLE_BYTE_PAIR(0xB974, 0x9756)
+DOUBLE_BYTE_PAIR(0xB975, 0x9774)
+DOUBLE_BYTE_PAIR(0xB976, 0x9776)
+DOUBLE_BYTE_PAIR(0xB977, 0x9810)
+DOUBLE_BYTE_PAIR(0xB978, 0x9811)
+DOUBLE_BYTE_PAIR(0xB979, 0x9813)
+DOUBLE_BYTE_PAIR(0xB97A, 0x980A)
+DOUBLE_BYTE_PAIR(0xB97B, 0x9812)
+DOUBLE_BYTE_PAIR(0xB97C, 0x980C)
+DOUBLE_BYTE_PAIR(0xB97D, 0x98FC)
+DOUBLE_BYTE_PAIR(0xB97E, 0x98F4)
+DOUBLE_BYTE_PAIR(0xB9A1, 0x98FD)
+DOUBLE_BYTE_PAIR(0xB9A2, 0x98FE)
+DOUBLE_BYTE_PAIR(0xB9A3, 0x99B3)
+DOUBLE_BYTE_PAIR(0xB9A4, 0x99B1)
+DOUBLE_BYTE_PAIR(0xB9A5, 0x99B4)
+DOUBLE_BYTE_PAIR(0xB9A6, 0x9AE1)
+DOUBLE_BYTE_PAIR(0xB9A7, 0x9CE9)
+DOUBLE_BYTE_PAIR(0xB9A8, 0x9E82)
+DOUBLE_BYTE_PAIR(0xB9A9, 0x9F0E)
+DOUBLE_BYTE_PAIR(0xB9AA, 0x9F13)
+DOUBLE_BYTE_PAIR(0xB9AB, 0x9F20)
+DOUBLE_BYTE_PAIR(0xB9AC, 0x50E7)
+DOUBLE_BYTE_PAIR(0xB9AD, 0x50EE)
+DOUBLE_BYTE_PAIR(0xB9AE, 0x50E5)
+DOUBLE_BYTE_PAIR(0xB9AF, 0x50D6)
+DOUBLE_BYTE_PAIR(0xB9B0, 0x50ED)
+DOUBLE_BYTE_PAIR(0xB9B1, 0x50DA)
+DOUBLE_BYTE_PAIR(0xB9B2, 0x50D5)
+DOUBLE_BYTE_PAIR(0xB9B3, 0x50CF)
+DOUBLE_BYTE_PAIR(0xB9B4, 0x50D1)
+DOUBLE_BYTE_PAIR(0xB9B5, 0x50F1)
+DOUBLE_BYTE_PAIR(0xB9B6, 0x50CE)
+DOUBLE_BYTE_PAIR(0xB9B7, 0x50E9)
+DOUBLE_BYTE_PAIR(0xB9B8, 0x5162)
+DOUBLE_BYTE_PAIR(0xB9B9, 0x51F3)
+DOUBLE_BYTE_PAIR(0xB9BA, 0x5283)
+DOUBLE_BYTE_PAIR(0xB9BB, 0x5282)
+DOUBLE_BYTE_PAIR(0xB9BC, 0x5331)
+DOUBLE_BYTE_PAIR(0xB9BD, 0x53AD)
+DOUBLE_BYTE_PAIR(0xB9BE, 0x55FE)
+DOUBLE_BYTE_PAIR(0xB9BF, 0x5600)
+DOUBLE_BYTE_PAIR(0xB9C0, 0x561B)
+DOUBLE_BYTE_PAIR(0xB9C1, 0x5617)
+DOUBLE_BYTE_PAIR(0xB9C2, 0x55FD)
+DOUBLE_BYTE_PAIR(0xB9C3, 0x5614)
+DOUBLE_BYTE_PAIR(0xB9C4, 0x5606)
+DOUBLE_BYTE_PAIR(0xB9C5, 0x5609)
+DOUBLE_BYTE_PAIR(0xB9C6, 0x560D)
+DOUBLE_BYTE_PAIR(0xB9C7, 0x560E)
+DOUBLE_BYTE_PAIR(0xB9C8, 0x55F7)
+DOUBLE_BYTE_PAIR(0xB9C9, 0x5616)
+DOUBLE_BYTE_PAIR(0xB9CA, 0x561F)
+DOUBLE_BYTE_PAIR(0xB9CB, 0x5608)
+DOUBLE_BYTE_PAIR(0xB9CC, 0x5610)
+DOUBLE_BYTE_PAIR(0xB9CD, 0x55F6)
+DOUBLE_BYTE_PAIR(0xB9CE, 0x5718)
+DOUBLE_BYTE_PAIR(0xB9CF, 0x5716)
+DOUBLE_BYTE_PAIR(0xB9D0, 0x5875)
+DOUBLE_BYTE_PAIR(0xB9D1, 0x587E)
+DOUBLE_BYTE_PAIR(0xB9D2, 0x5883)
+DOUBLE_BYTE_PAIR(0xB9D3, 0x5893)
+DOUBLE_BYTE_PAIR(0xB9D4, 0x588A)
+DOUBLE_BYTE_PAIR(0xB9D5, 0x5879)
+DOUBLE_BYTE_PAIR(0xB9D6, 0x5885)
+DOUBLE_BYTE_PAIR(0xB9D7, 0x587D)
+DOUBLE_BYTE_PAIR(0xB9D8, 0x58FD)
+DOUBLE_BYTE_PAIR(0xB9D9, 0x5925)
+DOUBLE_BYTE_PAIR(0xB9DA, 0x5922)
+DOUBLE_BYTE_PAIR(0xB9DB, 0x5924)
+DOUBLE_BYTE_PAIR(0xB9DC, 0x596A)
+DOUBLE_BYTE_PAIR(0xB9DD, 0x5969)
+DOUBLE_BYTE_PAIR(0xB9DE, 0x5AE1)
+DOUBLE_BYTE_PAIR(0xB9DF, 0x5AE6)
+DOUBLE_BYTE_PAIR(0xB9E0, 0x5AE9)
+DOUBLE_BYTE_PAIR(0xB9E1, 0x5AD7)
+DOUBLE_BYTE_PAIR(0xB9E2, 0x5AD6)
+DOUBLE_BYTE_PAIR(0xB9E3, 0x5AD8)
+DOUBLE_BYTE_PAIR(0xB9E4, 0x5AE3)
+DOUBLE_BYTE_PAIR(0xB9E5, 0x5B75)
+DOUBLE_BYTE_PAIR(0xB9E6, 0x5BDE)
+DOUBLE_BYTE_PAIR(0xB9E7, 0x5BE7)
+DOUBLE_BYTE_PAIR(0xB9E8, 0x5BE1)
+DOUBLE_BYTE_PAIR(0xB9E9, 0x5BE5)
+DOUBLE_BYTE_PAIR(0xB9EA, 0x5BE6)
+DOUBLE_BYTE_PAIR(0xB9EB, 0x5BE8)
+DOUBLE_BYTE_PAIR(0xB9EC, 0x5BE2)
+DOUBLE_BYTE_PAIR(0xB9ED, 0x5BE4)
+DOUBLE_BYTE_PAIR(0xB9EE, 0x5BDF)
+DOUBLE_BYTE_PAIR(0xB9EF, 0x5C0D)
+DOUBLE_BYTE_PAIR(0xB9F0, 0x5C62)
+DOUBLE_BYTE_PAIR(0xB9F1, 0x5D84)
+DOUBLE_BYTE_PAIR(0xB9F2, 0x5D87)
+DOUBLE_BYTE_PAIR(0xB9F3, 0x5E5B)
+DOUBLE_BYTE_PAIR(0xB9F4, 0x5E63)
+DOUBLE_BYTE_PAIR(0xB9F5, 0x5E55)
+DOUBLE_BYTE_PAIR(0xB9F6, 0x5E57)
+DOUBLE_BYTE_PAIR(0xB9F7, 0x5E54)
+DOUBLE_BYTE_PAIR(0xB9F8, 0x5ED3)
+DOUBLE_BYTE_PAIR(0xB9F9, 0x5ED6)
+DOUBLE_BYTE_PAIR(0xB9FA, 0x5F0A)
+DOUBLE_BYTE_PAIR(0xB9FB, 0x5F46)
+DOUBLE_BYTE_PAIR(0xB9FC, 0x5F70)
+DOUBLE_BYTE_PAIR(0xB9FD, 0x5FB9)
+DOUBLE_BYTE_PAIR(0xB9FE, 0x6147)
+DOUBLE_BYTE_PAIR(0xBA40, 0x613F)
+DOUBLE_BYTE_PAIR(0xBA41, 0x614B)
+DOUBLE_BYTE_PAIR(0xBA42, 0x6177)
+DOUBLE_BYTE_PAIR(0xBA43, 0x6162)
+DOUBLE_BYTE_PAIR(0xBA44, 0x6163)
+DOUBLE_BYTE_PAIR(0xBA45, 0x615F)
+DOUBLE_BYTE_PAIR(0xBA46, 0x615A)
+DOUBLE_BYTE_PAIR(0xBA47, 0x6158)
+DOUBLE_BYTE_PAIR(0xBA48, 0x6175)
+DOUBLE_BYTE_PAIR(0xBA49, 0x622A)
+DOUBLE_BYTE_PAIR(0xBA4A, 0x6487)
+DOUBLE_BYTE_PAIR(0xBA4B, 0x6458)
+DOUBLE_BYTE_PAIR(0xBA4C, 0x6454)
+DOUBLE_BYTE_PAIR(0xBA4D, 0x64A4)
+DOUBLE_BYTE_PAIR(0xBA4E, 0x6478)
+DOUBLE_BYTE_PAIR(0xBA4F, 0x645F)
+DOUBLE_BYTE_PAIR(0xBA50, 0x647A)
+DOUBLE_BYTE_PAIR(0xBA51, 0x6451)
+DOUBLE_BYTE_PAIR(0xBA52, 0x6467)
+DOUBLE_BYTE_PAIR(0xBA53, 0x6434)
+DOUBLE_BYTE_PAIR(0xBA54, 0x646D)
+DOUBLE_BYTE_PAIR(0xBA55, 0x647B)
+DOUBLE_BYTE_PAIR(0xBA56, 0x6572)
+DOUBLE_BYTE_PAIR(0xBA57, 0x65A1)
+DOUBLE_BYTE_PAIR(0xBA58, 0x65D7)
+DOUBLE_BYTE_PAIR(0xBA59, 0x65D6)
+DOUBLE_BYTE_PAIR(0xBA5A, 0x66A2)
+DOUBLE_BYTE_PAIR(0xBA5B, 0x66A8)
+DOUBLE_BYTE_PAIR(0xBA5C, 0x669D)
+DOUBLE_BYTE_PAIR(0xBA5D, 0x699C)
+DOUBLE_BYTE_PAIR(0xBA5E, 0x69A8)
+DOUBLE_BYTE_PAIR(0xBA5F, 0x6995)
+DOUBLE_BYTE_PAIR(0xBA60, 0x69C1)
+DOUBLE_BYTE_PAIR(0xBA61, 0x69AE)
+DOUBLE_BYTE_PAIR(0xBA62, 0x69D3)
+DOUBLE_BYTE_PAIR(0xBA63, 0x69CB)
+DOUBLE_BYTE_PAIR(0xBA64, 0x699B)
+DOUBLE_BYTE_PAIR(0xBA65, 0x69B7)
+DOUBLE_BYTE_PAIR(0xBA66, 0x69BB)
+DOUBLE_BYTE_PAIR(0xBA67, 0x69AB)
+DOUBLE_BYTE_PAIR(0xBA68, 0x69B4)
+DOUBLE_BYTE_PAIR(0xBA69, 0x69D0)
+DOUBLE_BYTE_PAIR(0xBA6A, 0x69CD)
+DOUBLE_BYTE_PAIR(0xBA6B, 0x69AD)
+DOUBLE_BYTE_PAIR(0xBA6C, 0x69CC)
+DOUBLE_BYTE_PAIR(0xBA6D, 0x69A6)
+DOUBLE_BYTE_PAIR(0xBA6E, 0x69C3)
+DOUBLE_BYTE_PAIR(0xBA6F, 0x69A3)
+DOUBLE_BYTE_PAIR(0xBA70, 0x6B49)
+DOUBLE_BYTE_PAIR(0xBA71, 0x6B4C)
+DOUBLE_BYTE_PAIR(0xBA72, 0x6C33)
+DOUBLE_BYTE_PAIR(0xBA73, 0x6F33)
+DOUBLE_BYTE_PAIR(0xBA74, 0x6F14)
+DOUBLE_BYTE_PAIR(0xBA75, 0x6EFE)
+DOUBLE_BYTE_PAIR(0xBA76, 0x6F13)
+DOUBLE_BYTE_PAIR(0xBA77, 0x6EF4)
+DOUBLE_BYTE_PAIR(0xBA78, 0x6F29)
+DOUBLE_BYTE_PAIR(0xBA79, 0x6F3E)
+DOUBLE_BYTE_PAIR(0xBA7A, 0x6F20)
+DOUBLE_BYTE_PAIR(0xBA7B, 0x6F2C)
+DOUBLE_BYTE_PAIR(0xBA7C, 0x6F0F)
+DOUBLE_BYTE_PAIR(0xBA7D, 0x6F02)
+DOUBLE_BYTE_PAIR(0xBA7E, 0x6F22)
+DOUBLE_BYTE_PAIR(0xBAA1, 0x6EFF)
+DOUBLE_BYTE_PAIR(0xBAA2, 0x6EEF)
+DOUBLE_BYTE_PAIR(0xBAA3, 0x6F06)
+DOUBLE_BYTE_PAIR(0xBAA4, 0x6F31)
+DOUBLE_BYTE_PAIR(0xBAA5, 0x6F38)
+DOUBLE_BYTE_PAIR(0xBAA6, 0x6F32)
+DOUBLE_BYTE_PAIR(0xBAA7, 0x6F23)
+DOUBLE_BYTE_PAIR(0xBAA8, 0x6F15)
+DOUBLE_BYTE_PAIR(0xBAA9, 0x6F2B)
+DOUBLE_BYTE_PAIR(0xBAAA, 0x6F2F)
+DOUBLE_BYTE_PAIR(0xBAAB, 0x6F88)
+DOUBLE_BYTE_PAIR(0xBAAC, 0x6F2A)
+DOUBLE_BYTE_PAIR(0xBAAD, 0x6EEC)
+DOUBLE_BYTE_PAIR(0xBAAE, 0x6F01)
+DOUBLE_BYTE_PAIR(0xBAAF, 0x6EF2)
+DOUBLE_BYTE_PAIR(0xBAB0, 0x6ECC)
+DOUBLE_BYTE_PAIR(0xBAB1, 0x6EF7)
+DOUBLE_BYTE_PAIR(0xBAB2, 0x7194)
+DOUBLE_BYTE_PAIR(0xBAB3, 0x7199)
+DOUBLE_BYTE_PAIR(0xBAB4, 0x717D)
+DOUBLE_BYTE_PAIR(0xBAB5, 0x718A)
+DOUBLE_BYTE_PAIR(0xBAB6, 0x7184)
+DOUBLE_BYTE_PAIR(0xBAB7, 0x7192)
+DOUBLE_BYTE_PAIR(0xBAB8, 0x723E)
+DOUBLE_BYTE_PAIR(0xBAB9, 0x7292)
+DOUBLE_BYTE_PAIR(0xBABA, 0x7296)
+DOUBLE_BYTE_PAIR(0xBABB, 0x7344)
+DOUBLE_BYTE_PAIR(0xBABC, 0x7350)
+DOUBLE_BYTE_PAIR(0xBABD, 0x7464)
+DOUBLE_BYTE_PAIR(0xBABE, 0x7463)
+DOUBLE_BYTE_PAIR(0xBABF, 0x746A)
+DOUBLE_BYTE_PAIR(0xBAC0, 0x7470)
+DOUBLE_BYTE_PAIR(0xBAC1, 0x746D)
+DOUBLE_BYTE_PAIR(0xBAC2, 0x7504)
+DOUBLE_BYTE_PAIR(0xBAC3, 0x7591)
+DOUBLE_BYTE_PAIR(0xBAC4, 0x7627)
+DOUBLE_BYTE_PAIR(0xBAC5, 0x760D)
+DOUBLE_BYTE_PAIR(0xBAC6, 0x760B)
+DOUBLE_BYTE_PAIR(0xBAC7, 0x7609)
+DOUBLE_BYTE_PAIR(0xBAC8, 0x7613)
+DOUBLE_BYTE_PAIR(0xBAC9, 0x76E1)
+DOUBLE_BYTE_PAIR(0xBACA, 0x76E3)
+DOUBLE_BYTE_PAIR(0xBACB, 0x7784)
+DOUBLE_BYTE_PAIR(0xBACC, 0x777D)
+DOUBLE_BYTE_PAIR(0xBACD, 0x777F)
+DOUBLE_BYTE_PAIR(0xBACE, 0x7761)
+DOUBLE_BYTE_PAIR(0xBACF, 0x78C1)
+DOUBLE_BYTE_PAIR(0xBAD0, 0x789F)
+DOUBLE_BYTE_PAIR(0xBAD1, 0x78A7)
+DOUBLE_BYTE_PAIR(0xBAD2, 0x78B3)
+DOUBLE_BYTE_PAIR(0xBAD3, 0x78A9)
+DOUBLE_BYTE_PAIR(0xBAD4, 0x78A3)
+DOUBLE_BYTE_PAIR(0xBAD5, 0x798E)
+DOUBLE_BYTE_PAIR(0xBAD6, 0x798F)
+DOUBLE_BYTE_PAIR(0xBAD7, 0x798D)
+DOUBLE_BYTE_PAIR(0xBAD8, 0x7A2E)
+DOUBLE_BYTE_PAIR(0xBAD9, 0x7A31)
+DOUBLE_BYTE_PAIR(0xBADA, 0x7AAA)
+DOUBLE_BYTE_PAIR(0xBADB, 0x7AA9)
+DOUBLE_BYTE_PAIR(0xBADC, 0x7AED)
+DOUBLE_BYTE_PAIR(0xBADD, 0x7AEF)
+DOUBLE_BYTE_PAIR(0xBADE, 0x7BA1)
+DOUBLE_BYTE_PAIR(0xBADF, 0x7B95)
+DOUBLE_BYTE_PAIR(0xBAE0, 0x7B8B)
+DOUBLE_BYTE_PAIR(0xBAE1, 0x7B75)
+DOUBLE_BYTE_PAIR(0xBAE2, 0x7B97)
+DOUBLE_BYTE_PAIR(0xBAE3, 0x7B9D)
+DOUBLE_BYTE_PAIR(0xBAE4, 0x7B94)
+DOUBLE_BYTE_PAIR(0xBAE5, 0x7B8F)
+DOUBLE_BYTE_PAIR(0xBAE6, 0x7BB8)
+DOUBLE_BYTE_PAIR(0xBAE7, 0x7B87)
+DOUBLE_BYTE_PAIR(0xBAE8, 0x7B84)
+DOUBLE_BYTE_PAIR(0xBAE9, 0x7CB9)
+DOUBLE_BYTE_PAIR(0xBAEA, 0x7CBD)
+DOUBLE_BYTE_PAIR(0xBAEB, 0x7CBE)
+DOUBLE_BYTE_PAIR(0xBAEC, 0x7DBB)
+DOUBLE_BYTE_PAIR(0xBAED, 0x7DB0)
+DOUBLE_BYTE_PAIR(0xBAEE, 0x7D9C)
+DOUBLE_BYTE_PAIR(0xBAEF, 0x7DBD)
+DOUBLE_BYTE_PAIR(0xBAF0, 0x7DBE)
+DOUBLE_BYTE_PAIR(0xBAF1, 0x7DA0)
+DOUBLE_BYTE_PAIR(0xBAF2, 0x7DCA)
+DOUBLE_BYTE_PAIR(0xBAF3, 0x7DB4)
+DOUBLE_BYTE_PAIR(0xBAF4, 0x7DB2)
+DOUBLE_BYTE_PAIR(0xBAF5, 0x7DB1)
+DOUBLE_BYTE_PAIR(0xBAF6, 0x7DBA)
+DOUBLE_BYTE_PAIR(0xBAF7, 0x7DA2)
+DOUBLE_BYTE_PAIR(0xBAF8, 0x7DBF)
+DOUBLE_BYTE_PAIR(0xBAF9, 0x7DB5)
+DOUBLE_BYTE_PAIR(0xBAFA, 0x7DB8)
+DOUBLE_BYTE_PAIR(0xBAFB, 0x7DAD)
+DOUBLE_BYTE_PAIR(0xBAFC, 0x7DD2)
+DOUBLE_BYTE_PAIR(0xBAFD, 0x7DC7)
+DOUBLE_BYTE_PAIR(0xBAFE, 0x7DAC)
+DOUBLE_BYTE_PAIR(0xBB40, 0x7F70)
+DOUBLE_BYTE_PAIR(0xBB41, 0x7FE0)
+DOUBLE_BYTE_PAIR(0xBB42, 0x7FE1)
+DOUBLE_BYTE_PAIR(0xBB43, 0x7FDF)
+DOUBLE_BYTE_PAIR(0xBB44, 0x805E)
+DOUBLE_BYTE_PAIR(0xBB45, 0x805A)
+DOUBLE_BYTE_PAIR(0xBB46, 0x8087)
+DOUBLE_BYTE_PAIR(0xBB47, 0x8150)
+DOUBLE_BYTE_PAIR(0xBB48, 0x8180)
+DOUBLE_BYTE_PAIR(0xBB49, 0x818F)
+DOUBLE_BYTE_PAIR(0xBB4A, 0x8188)
+DOUBLE_BYTE_PAIR(0xBB4B, 0x818A)
+DOUBLE_BYTE_PAIR(0xBB4C, 0x817F)
+DOUBLE_BYTE_PAIR(0xBB4D, 0x8182)
+DOUBLE_BYTE_PAIR(0xBB4E, 0x81E7)
+DOUBLE_BYTE_PAIR(0xBB4F, 0x81FA)
+DOUBLE_BYTE_PAIR(0xBB50, 0x8207)
+DOUBLE_BYTE_PAIR(0xBB51, 0x8214)
+DOUBLE_BYTE_PAIR(0xBB52, 0x821E)
+DOUBLE_BYTE_PAIR(0xBB53, 0x824B)
+DOUBLE_BYTE_PAIR(0xBB54, 0x84C9)
+DOUBLE_BYTE_PAIR(0xBB55, 0x84BF)
+DOUBLE_BYTE_PAIR(0xBB56, 0x84C6)
+DOUBLE_BYTE_PAIR(0xBB57, 0x84C4)
+DOUBLE_BYTE_PAIR(0xBB58, 0x8499)
+DOUBLE_BYTE_PAIR(0xBB59, 0x849E)
+DOUBLE_BYTE_PAIR(0xBB5A, 0x84B2)
+DOUBLE_BYTE_PAIR(0xBB5B, 0x849C)
+DOUBLE_BYTE_PAIR(0xBB5C, 0x84CB)
+DOUBLE_BYTE_PAIR(0xBB5D, 0x84B8)
+DOUBLE_BYTE_PAIR(0xBB5E, 0x84C0)
+DOUBLE_BYTE_PAIR(0xBB5F, 0x84D3)
+DOUBLE_BYTE_PAIR(0xBB60, 0x8490)
+DOUBLE_BYTE_PAIR(0xBB61, 0x84BC)
+DOUBLE_BYTE_PAIR(0xBB62, 0x84D1)
+DOUBLE_BYTE_PAIR(0xBB63, 0x84CA)
+DOUBLE_BYTE_PAIR(0xBB64, 0x873F)
+DOUBLE_BYTE_PAIR(0xBB65, 0x871C)
+DOUBLE_BYTE_PAIR(0xBB66, 0x873B)
+DOUBLE_BYTE_PAIR(0xBB67, 0x8722)
+DOUBLE_BYTE_PAIR(0xBB68, 0x8725)
+DOUBLE_BYTE_PAIR(0xBB69, 0x8734)
+DOUBLE_BYTE_PAIR(0xBB6A, 0x8718)
+DOUBLE_BYTE_PAIR(0xBB6B, 0x8755)
+DOUBLE_BYTE_PAIR(0xBB6C, 0x8737)
+DOUBLE_BYTE_PAIR(0xBB6D, 0x8729)
+DOUBLE_BYTE_PAIR(0xBB6E, 0x88F3)
+DOUBLE_BYTE_PAIR(0xBB6F, 0x8902)
+DOUBLE_BYTE_PAIR(0xBB70, 0x88F4)
+DOUBLE_BYTE_PAIR(0xBB71, 0x88F9)
+DOUBLE_BYTE_PAIR(0xBB72, 0x88F8)
+DOUBLE_BYTE_PAIR(0xBB73, 0x88FD)
+DOUBLE_BYTE_PAIR(0xBB74, 0x88E8)
+DOUBLE_BYTE_PAIR(0xBB75, 0x891A)
+DOUBLE_BYTE_PAIR(0xBB76, 0x88EF)
+DOUBLE_BYTE_PAIR(0xBB77, 0x8AA6)
+DOUBLE_BYTE_PAIR(0xBB78, 0x8A8C)
+DOUBLE_BYTE_PAIR(0xBB79, 0x8A9E)
+DOUBLE_BYTE_PAIR(0xBB7A, 0x8AA3)
+DOUBLE_BYTE_PAIR(0xBB7B, 0x8A8D)
+DOUBLE_BYTE_PAIR(0xBB7C, 0x8AA1)
+DOUBLE_BYTE_PAIR(0xBB7D, 0x8A93)
+DOUBLE_BYTE_PAIR(0xBB7E, 0x8AA4)
+DOUBLE_BYTE_PAIR(0xBBA1, 0x8AAA)
+DOUBLE_BYTE_PAIR(0xBBA2, 0x8AA5)
+DOUBLE_BYTE_PAIR(0xBBA3, 0x8AA8)
+DOUBLE_BYTE_PAIR(0xBBA4, 0x8A98)
+DOUBLE_BYTE_PAIR(0xBBA5, 0x8A91)
+DOUBLE_BYTE_PAIR(0xBBA6, 0x8A9A)
+DOUBLE_BYTE_PAIR(0xBBA7, 0x8AA7)
+DOUBLE_BYTE_PAIR(0xBBA8, 0x8C6A)
+DOUBLE_BYTE_PAIR(0xBBA9, 0x8C8D)
+DOUBLE_BYTE_PAIR(0xBBAA, 0x8C8C)
+DOUBLE_BYTE_PAIR(0xBBAB, 0x8CD3)
+DOUBLE_BYTE_PAIR(0xBBAC, 0x8CD1)
+DOUBLE_BYTE_PAIR(0xBBAD, 0x8CD2)
+DOUBLE_BYTE_PAIR(0xBBAE, 0x8D6B)
+DOUBLE_BYTE_PAIR(0xBBAF, 0x8D99)
+DOUBLE_BYTE_PAIR(0xBBB0, 0x8D95)
+DOUBLE_BYTE_PAIR(0xBBB1, 0x8DFC)
+DOUBLE_BYTE_PAIR(0xBBB2, 0x8F14)
+DOUBLE_BYTE_PAIR(0xBBB3, 0x8F12)
+DOUBLE_BYTE_PAIR(0xBBB4, 0x8F15)
+DOUBLE_BYTE_PAIR(0xBBB5, 0x8F13)
+DOUBLE_BYTE_PAIR(0xBBB6, 0x8FA3)
+DOUBLE_BYTE_PAIR(0xBBB7, 0x9060)
+DOUBLE_BYTE_PAIR(0xBBB8, 0x9058)
+DOUBLE_BYTE_PAIR(0xBBB9, 0x905C)
+DOUBLE_BYTE_PAIR(0xBBBA, 0x9063)
+DOUBLE_BYTE_PAIR(0xBBBB, 0x9059)
+DOUBLE_BYTE_PAIR(0xBBBC, 0x905E)
+DOUBLE_BYTE_PAIR(0xBBBD, 0x9062)
+DOUBLE_BYTE_PAIR(0xBBBE, 0x905D)
+DOUBLE_BYTE_PAIR(0xBBBF, 0x905B)
+DOUBLE_BYTE_PAIR(0xBBC0, 0x9119)
+DOUBLE_BYTE_PAIR(0xBBC1, 0x9118)
+DOUBLE_BYTE_PAIR(0xBBC2, 0x911E)
+DOUBLE_BYTE_PAIR(0xBBC3, 0x9175)
+DOUBLE_BYTE_PAIR(0xBBC4, 0x9178)
+DOUBLE_BYTE_PAIR(0xBBC5, 0x9177)
+DOUBLE_BYTE_PAIR(0xBBC6, 0x9174)
+DOUBLE_BYTE_PAIR(0xBBC7, 0x9278)
+DOUBLE_BYTE_PAIR(0xBBC8, 0x9280)
+DOUBLE_BYTE_PAIR(0xBBC9, 0x9285)
+DOUBLE_BYTE_PAIR(0xBBCA, 0x9298)
+DOUBLE_BYTE_PAIR(0xBBCB, 0x9296)
+DOUBLE_BYTE_PAIR(0xBBCC, 0x927B)
+DOUBLE_BYTE_PAIR(0xBBCD, 0x9293)
+DOUBLE_BYTE_PAIR(0xBBCE, 0x929C)
+DOUBLE_BYTE_PAIR(0xBBCF, 0x92A8)
+DOUBLE_BYTE_PAIR(0xBBD0, 0x927C)
+DOUBLE_BYTE_PAIR(0xBBD1, 0x9291)
+DOUBLE_BYTE_PAIR(0xBBD2, 0x95A1)
+DOUBLE_BYTE_PAIR(0xBBD3, 0x95A8)
+DOUBLE_BYTE_PAIR(0xBBD4, 0x95A9)
+DOUBLE_BYTE_PAIR(0xBBD5, 0x95A3)
+DOUBLE_BYTE_PAIR(0xBBD6, 0x95A5)
+DOUBLE_BYTE_PAIR(0xBBD7, 0x95A4)
+DOUBLE_BYTE_PAIR(0xBBD8, 0x9699)
+DOUBLE_BYTE_PAIR(0xBBD9, 0x969C)
+DOUBLE_BYTE_PAIR(0xBBDA, 0x969B)
+DOUBLE_BYTE_PAIR(0xBBDB, 0x96CC)
+DOUBLE_BYTE_PAIR(0xBBDC, 0x96D2)
+DOUBLE_BYTE_PAIR(0xBBDD, 0x9700)
+DOUBLE_BYTE_PAIR(0xBBDE, 0x977C)
+DOUBLE_BYTE_PAIR(0xBBDF, 0x9785)
+DOUBLE_BYTE_PAIR(0xBBE0, 0x97F6)
+DOUBLE_BYTE_PAIR(0xBBE1, 0x9817)
+DOUBLE_BYTE_PAIR(0xBBE2, 0x9818)
+DOUBLE_BYTE_PAIR(0xBBE3, 0x98AF)
+DOUBLE_BYTE_PAIR(0xBBE4, 0x98B1)
+DOUBLE_BYTE_PAIR(0xBBE5, 0x9903)
+DOUBLE_BYTE_PAIR(0xBBE6, 0x9905)
+DOUBLE_BYTE_PAIR(0xBBE7, 0x990C)
+DOUBLE_BYTE_PAIR(0xBBE8, 0x9909)
+DOUBLE_BYTE_PAIR(0xBBE9, 0x99C1)
+DOUBLE_BYTE_PAIR(0xBBEA, 0x9AAF)
+DOUBLE_BYTE_PAIR(0xBBEB, 0x9AB0)
+DOUBLE_BYTE_PAIR(0xBBEC, 0x9AE6)
+DOUBLE_BYTE_PAIR(0xBBED, 0x9B41)
+DOUBLE_BYTE_PAIR(0xBBEE, 0x9B42)
+DOUBLE_BYTE_PAIR(0xBBEF, 0x9CF4)
+DOUBLE_BYTE_PAIR(0xBBF0, 0x9CF6)
+DOUBLE_BYTE_PAIR(0xBBF1, 0x9CF3)
+DOUBLE_BYTE_PAIR(0xBBF2, 0x9EBC)
+DOUBLE_BYTE_PAIR(0xBBF3, 0x9F3B)
+DOUBLE_BYTE_PAIR(0xBBF4, 0x9F4A)
+DOUBLE_BYTE_PAIR(0xBBF5, 0x5104)
+DOUBLE_BYTE_PAIR(0xBBF6, 0x5100)
+DOUBLE_BYTE_PAIR(0xBBF7, 0x50FB)
+DOUBLE_BYTE_PAIR(0xBBF8, 0x50F5)
+DOUBLE_BYTE_PAIR(0xBBF9, 0x50F9)
+DOUBLE_BYTE_PAIR(0xBBFA, 0x5102)
+DOUBLE_BYTE_PAIR(0xBBFB, 0x5108)
+DOUBLE_BYTE_PAIR(0xBBFC, 0x5109)
+DOUBLE_BYTE_PAIR(0xBBFD, 0x5105)
+DOUBLE_BYTE_PAIR(0xBBFE, 0x51DC)
+DOUBLE_BYTE_PAIR(0xBC40, 0x5287)
+DOUBLE_BYTE_PAIR(0xBC41, 0x5288)
+DOUBLE_BYTE_PAIR(0xBC42, 0x5289)
+DOUBLE_BYTE_PAIR(0xBC43, 0x528D)
+DOUBLE_BYTE_PAIR(0xBC44, 0x528A)
+DOUBLE_BYTE_PAIR(0xBC45, 0x52F0)
+DOUBLE_BYTE_PAIR(0xBC46, 0x53B2)
+DOUBLE_BYTE_PAIR(0xBC47, 0x562E)
+DOUBLE_BYTE_PAIR(0xBC48, 0x563B)
+DOUBLE_BYTE_PAIR(0xBC49, 0x5639)
+DOUBLE_BYTE_PAIR(0xBC4A, 0x5632)
+DOUBLE_BYTE_PAIR(0xBC4B, 0x563F)
+DOUBLE_BYTE_PAIR(0xBC4C, 0x5634)
+DOUBLE_BYTE_PAIR(0xBC4D, 0x5629)
+DOUBLE_BYTE_PAIR(0xBC4E, 0x5653)
+DOUBLE_BYTE_PAIR(0xBC4F, 0x564E)
+DOUBLE_BYTE_PAIR(0xBC50, 0x5657)
+DOUBLE_BYTE_PAIR(0xBC51, 0x5674)
+DOUBLE_BYTE_PAIR(0xBC52, 0x5636)
+DOUBLE_BYTE_PAIR(0xBC53, 0x562F)
+DOUBLE_BYTE_PAIR(0xBC54, 0x5630)
+DOUBLE_BYTE_PAIR(0xBC55, 0x5880)
+DOUBLE_BYTE_PAIR(0xBC56, 0x589F)
+DOUBLE_BYTE_PAIR(0xBC57, 0x589E)
+DOUBLE_BYTE_PAIR(0xBC58, 0x58B3)
+DOUBLE_BYTE_PAIR(0xBC59, 0x589C)
+DOUBLE_BYTE_PAIR(0xBC5A, 0x58AE)
+DOUBLE_BYTE_PAIR(0xBC5B, 0x58A9)
+DOUBLE_BYTE_PAIR(0xBC5C, 0x58A6)
+DOUBLE_BYTE_PAIR(0xBC5D, 0x596D)
+DOUBLE_BYTE_PAIR(0xBC5E, 0x5B09)
+DOUBLE_BYTE_PAIR(0xBC5F, 0x5AFB)
+DOUBLE_BYTE_PAIR(0xBC60, 0x5B0B)
+DOUBLE_BYTE_PAIR(0xBC61, 0x5AF5)
+DOUBLE_BYTE_PAIR(0xBC62, 0x5B0C)
+DOUBLE_BYTE_PAIR(0xBC63, 0x5B08)
+DOUBLE_BYTE_PAIR(0xBC64, 0x5BEE)
+DOUBLE_BYTE_PAIR(0xBC65, 0x5BEC)
+DOUBLE_BYTE_PAIR(0xBC66, 0x5BE9)
+DOUBLE_BYTE_PAIR(0xBC67, 0x5BEB)
+DOUBLE_BYTE_PAIR(0xBC68, 0x5C64)
+DOUBLE_BYTE_PAIR(0xBC69, 0x5C65)
+DOUBLE_BYTE_PAIR(0xBC6A, 0x5D9D)
+DOUBLE_BYTE_PAIR(0xBC6B, 0x5D94)
+DOUBLE_BYTE_PAIR(0xBC6C, 0x5E62)
+DOUBLE_BYTE_PAIR(0xBC6D, 0x5E5F)
+DOUBLE_BYTE_PAIR(0xBC6E, 0x5E61)
+DOUBLE_BYTE_PAIR(0xBC6F, 0x5EE2)
+DOUBLE_BYTE_PAIR(0xBC70, 0x5EDA)
+DOUBLE_BYTE_PAIR(0xBC71, 0x5EDF)
+DOUBLE_BYTE_PAIR(0xBC72, 0x5EDD)
+DOUBLE_BYTE_PAIR(0xBC73, 0x5EE3)
+DOUBLE_BYTE_PAIR(0xBC74, 0x5EE0)
+DOUBLE_BYTE_PAIR(0xBC75, 0x5F48)
+DOUBLE_BYTE_PAIR(0xBC76, 0x5F71)
+DOUBLE_BYTE_PAIR(0xBC77, 0x5FB7)
+DOUBLE_BYTE_PAIR(0xBC78, 0x5FB5)
+DOUBLE_BYTE_PAIR(0xBC79, 0x6176)
+DOUBLE_BYTE_PAIR(0xBC7A, 0x6167)
+DOUBLE_BYTE_PAIR(0xBC7B, 0x616E)
+DOUBLE_BYTE_PAIR(0xBC7C, 0x615D)
+DOUBLE_BYTE_PAIR(0xBC7D, 0x6155)
+DOUBLE_BYTE_PAIR(0xBC7E, 0x6182)
+DOUBLE_BYTE_PAIR(0xBCA1, 0x617C)
+DOUBLE_BYTE_PAIR(0xBCA2, 0x6170)
+DOUBLE_BYTE_PAIR(0xBCA3, 0x616B)
+DOUBLE_BYTE_PAIR(0xBCA4, 0x617E)
+DOUBLE_BYTE_PAIR(0xBCA5, 0x61A7)
+DOUBLE_BYTE_PAIR(0xBCA6, 0x6190)
+DOUBLE_BYTE_PAIR(0xBCA7, 0x61AB)
+DOUBLE_BYTE_PAIR(0xBCA8, 0x618E)
+DOUBLE_BYTE_PAIR(0xBCA9, 0x61AC)
+DOUBLE_BYTE_PAIR(0xBCAA, 0x619A)
+DOUBLE_BYTE_PAIR(0xBCAB, 0x61A4)
+DOUBLE_BYTE_PAIR(0xBCAC, 0x6194)
+DOUBLE_BYTE_PAIR(0xBCAD, 0x61AE)
+DOUBLE_BYTE_PAIR(0xBCAE, 0x622E)
+DOUBLE_BYTE_PAIR(0xBCAF, 0x6469)
+DOUBLE_BYTE_PAIR(0xBCB0, 0x646F)
+DOUBLE_BYTE_PAIR(0xBCB1, 0x6479)
+DOUBLE_BYTE_PAIR(0xBCB2, 0x649E)
+DOUBLE_BYTE_PAIR(0xBCB3, 0x64B2)
+DOUBLE_BYTE_PAIR(0xBCB4, 0x6488)
+DOUBLE_BYTE_PAIR(0xBCB5, 0x6490)
+DOUBLE_BYTE_PAIR(0xBCB6, 0x64B0)
+DOUBLE_BYTE_PAIR(0xBCB7, 0x64A5)
+DOUBLE_BYTE_PAIR(0xBCB8, 0x6493)
+DOUBLE_BYTE_PAIR(0xBCB9, 0x6495)
+DOUBLE_BYTE_PAIR(0xBCBA, 0x64A9)
+DOUBLE_BYTE_PAIR(0xBCBB, 0x6492)
+DOUBLE_BYTE_PAIR(0xBCBC, 0x64AE)
+DOUBLE_BYTE_PAIR(0xBCBD, 0x64AD)
+DOUBLE_BYTE_PAIR(0xBCBE, 0x64AB)
+DOUBLE_BYTE_PAIR(0xBCBF, 0x649A)
+DOUBLE_BYTE_PAIR(0xBCC0, 0x64AC)
+DOUBLE_BYTE_PAIR(0xBCC1, 0x6499)
+DOUBLE_BYTE_PAIR(0xBCC2, 0x64A2)
+DOUBLE_BYTE_PAIR(0xBCC3, 0x64B3)
+DOUBLE_BYTE_PAIR(0xBCC4, 0x6575)
+DOUBLE_BYTE_PAIR(0xBCC5, 0x6577)
+DOUBLE_BYTE_PAIR(0xBCC6, 0x6578)
+DOUBLE_BYTE_PAIR(0xBCC7, 0x66AE)
+DOUBLE_BYTE_PAIR(0xBCC8, 0x66AB)
+DOUBLE_BYTE_PAIR(0xBCC9, 0x66B4)
+DOUBLE_BYTE_PAIR(0xBCCA, 0x66B1)
+DOUBLE_BYTE_PAIR(0xBCCB, 0x6A23)
+DOUBLE_BYTE_PAIR(0xBCCC, 0x6A1F)
+DOUBLE_BYTE_PAIR(0xBCCD, 0x69E8)
+DOUBLE_BYTE_PAIR(0xBCCE, 0x6A01)
+DOUBLE_BYTE_PAIR(0xBCCF, 0x6A1E)
+DOUBLE_BYTE_PAIR(0xBCD0, 0x6A19)
+DOUBLE_BYTE_PAIR(0xBCD1, 0x69FD)
+DOUBLE_BYTE_PAIR(0xBCD2, 0x6A21)
+DOUBLE_BYTE_PAIR(0xBCD3, 0x6A13)
+DOUBLE_BYTE_PAIR(0xBCD4, 0x6A0A)
+DOUBLE_BYTE_PAIR(0xBCD5, 0x69F3)
+DOUBLE_BYTE_PAIR(0xBCD6, 0x6A02)
+DOUBLE_BYTE_PAIR(0xBCD7, 0x6A05)
+DOUBLE_BYTE_PAIR(0xBCD8, 0x69ED)
+DOUBLE_BYTE_PAIR(0xBCD9, 0x6A11)
+DOUBLE_BYTE_PAIR(0xBCDA, 0x6B50)
+DOUBLE_BYTE_PAIR(0xBCDB, 0x6B4E)
+DOUBLE_BYTE_PAIR(0xBCDC, 0x6BA4)
+DOUBLE_BYTE_PAIR(0xBCDD, 0x6BC5)
+DOUBLE_BYTE_PAIR(0xBCDE, 0x6BC6)
+DOUBLE_BYTE_PAIR(0xBCDF, 0x6F3F)
+DOUBLE_BYTE_PAIR(0xBCE0, 0x6F7C)
+DOUBLE_BYTE_PAIR(0xBCE1, 0x6F84)
+DOUBLE_BYTE_PAIR(0xBCE2, 0x6F51)
+DOUBLE_BYTE_PAIR(0xBCE3, 0x6F66)
+DOUBLE_BYTE_PAIR(0xBCE4, 0x6F54)
+DOUBLE_BYTE_PAIR(0xBCE5, 0x6F86)
+DOUBLE_BYTE_PAIR(0xBCE6, 0x6F6D)
+DOUBLE_BYTE_PAIR(0xBCE7, 0x6F5B)
+DOUBLE_BYTE_PAIR(0xBCE8, 0x6F78)
+DOUBLE_BYTE_PAIR(0xBCE9, 0x6F6E)
+DOUBLE_BYTE_PAIR(0xBCEA, 0x6F8E)
+DOUBLE_BYTE_PAIR(0xBCEB, 0x6F7A)
+DOUBLE_BYTE_PAIR(0xBCEC, 0x6F70)
+DOUBLE_BYTE_PAIR(0xBCED, 0x6F64)
+DOUBLE_BYTE_PAIR(0xBCEE, 0x6F97)
+DOUBLE_BYTE_PAIR(0xBCEF, 0x6F58)
+DOUBLE_BYTE_PAIR(0xBCF0, 0x6ED5)
+DOUBLE_BYTE_PAIR(0xBCF1, 0x6F6F)
+DOUBLE_BYTE_PAIR(0xBCF2, 0x6F60)
+DOUBLE_BYTE_PAIR(0xBCF3, 0x6F5F)
+DOUBLE_BYTE_PAIR(0xBCF4, 0x719F)
+DOUBLE_BYTE_PAIR(0xBCF5, 0x71AC)
+DOUBLE_BYTE_PAIR(0xBCF6, 0x71B1)
+DOUBLE_BYTE_PAIR(0xBCF7, 0x71A8)
+DOUBLE_BYTE_PAIR(0xBCF8, 0x7256)
+DOUBLE_BYTE_PAIR(0xBCF9, 0x729B)
+DOUBLE_BYTE_PAIR(0xBCFA, 0x734E)
+DOUBLE_BYTE_PAIR(0xBCFB, 0x7357)
+DOUBLE_BYTE_PAIR(0xBCFC, 0x7469)
+DOUBLE_BYTE_PAIR(0xBCFD, 0x748B)
+DOUBLE_BYTE_PAIR(0xBCFE, 0x7483)
+DOUBLE_BYTE_PAIR(0xBD40, 0x747E)
+DOUBLE_BYTE_PAIR(0xBD41, 0x7480)
+DOUBLE_BYTE_PAIR(0xBD42, 0x757F)
+DOUBLE_BYTE_PAIR(0xBD43, 0x7620)
+DOUBLE_BYTE_PAIR(0xBD44, 0x7629)
+DOUBLE_BYTE_PAIR(0xBD45, 0x761F)
+DOUBLE_BYTE_PAIR(0xBD46, 0x7624)
+DOUBLE_BYTE_PAIR(0xBD47, 0x7626)
+DOUBLE_BYTE_PAIR(0xBD48, 0x7621)
+DOUBLE_BYTE_PAIR(0xBD49, 0x7622)
+DOUBLE_BYTE_PAIR(0xBD4A, 0x769A)
+DOUBLE_BYTE_PAIR(0xBD4B, 0x76BA)
+DOUBLE_BYTE_PAIR(0xBD4C, 0x76E4)
+DOUBLE_BYTE_PAIR(0xBD4D, 0x778E)
+DOUBLE_BYTE_PAIR(0xBD4E, 0x7787)
+DOUBLE_BYTE_PAIR(0xBD4F, 0x778C)
+DOUBLE_BYTE_PAIR(0xBD50, 0x7791)
+DOUBLE_BYTE_PAIR(0xBD51, 0x778B)
+DOUBLE_BYTE_PAIR(0xBD52, 0x78CB)
+DOUBLE_BYTE_PAIR(0xBD53, 0x78C5)
+DOUBLE_BYTE_PAIR(0xBD54, 0x78BA)
+DOUBLE_BYTE_PAIR(0xBD55, 0x78CA)
+DOUBLE_BYTE_PAIR(0xBD56, 0x78BE)
+DOUBLE_BYTE_PAIR(0xBD57, 0x78D5)
+DOUBLE_BYTE_PAIR(0xBD58, 0x78BC)
+DOUBLE_BYTE_PAIR(0xBD59, 0x78D0)
+DOUBLE_BYTE_PAIR(0xBD5A, 0x7A3F)
+DOUBLE_BYTE_PAIR(0xBD5B, 0x7A3C)
+DOUBLE_BYTE_PAIR(0xBD5C, 0x7A40)
+DOUBLE_BYTE_PAIR(0xBD5D, 0x7A3D)
+DOUBLE_BYTE_PAIR(0xBD5E, 0x7A37)
+DOUBLE_BYTE_PAIR(0xBD5F, 0x7A3B)
+DOUBLE_BYTE_PAIR(0xBD60, 0x7AAF)
+DOUBLE_BYTE_PAIR(0xBD61, 0x7AAE)
+DOUBLE_BYTE_PAIR(0xBD62, 0x7BAD)
+DOUBLE_BYTE_PAIR(0xBD63, 0x7BB1)
+DOUBLE_BYTE_PAIR(0xBD64, 0x7BC4)
+DOUBLE_BYTE_PAIR(0xBD65, 0x7BB4)
+DOUBLE_BYTE_PAIR(0xBD66, 0x7BC6)
+DOUBLE_BYTE_PAIR(0xBD67, 0x7BC7)
+DOUBLE_BYTE_PAIR(0xBD68, 0x7BC1)
+DOUBLE_BYTE_PAIR(0xBD69, 0x7BA0)
+DOUBLE_BYTE_PAIR(0xBD6A, 0x7BCC)
+DOUBLE_BYTE_PAIR(0xBD6B, 0x7CCA)
+DOUBLE_BYTE_PAIR(0xBD6C, 0x7DE0)
+DOUBLE_BYTE_PAIR(0xBD6D, 0x7DF4)
+DOUBLE_BYTE_PAIR(0xBD6E, 0x7DEF)
+DOUBLE_BYTE_PAIR(0xBD6F, 0x7DFB)
+DOUBLE_BYTE_PAIR(0xBD70, 0x7DD8)
+DOUBLE_BYTE_PAIR(0xBD71, 0x7DEC)
+DOUBLE_BYTE_PAIR(0xBD72, 0x7DDD)
+DOUBLE_BYTE_PAIR(0xBD73, 0x7DE8)
+DOUBLE_BYTE_PAIR(0xBD74, 0x7DE3)
+DOUBLE_BYTE_PAIR(0xBD75, 0x7DDA)
+DOUBLE_BYTE_PAIR(0xBD76, 0x7DDE)
+DOUBLE_BYTE_PAIR(0xBD77, 0x7DE9)
+DOUBLE_BYTE_PAIR(0xBD78, 0x7D9E)
+DOUBLE_BYTE_PAIR(0xBD79, 0x7DD9)
+DOUBLE_BYTE_PAIR(0xBD7A, 0x7DF2)
+DOUBLE_BYTE_PAIR(0xBD7B, 0x7DF9)
+DOUBLE_BYTE_PAIR(0xBD7C, 0x7F75)
+DOUBLE_BYTE_PAIR(0xBD7D, 0x7F77)
+DOUBLE_BYTE_PAIR(0xBD7E, 0x7FAF)
+DOUBLE_BYTE_PAIR(0xBDA1, 0x7FE9)
+DOUBLE_BYTE_PAIR(0xBDA2, 0x8026)
+DOUBLE_BYTE_PAIR(0xBDA3, 0x819B)
+DOUBLE_BYTE_PAIR(0xBDA4, 0x819C)
+DOUBLE_BYTE_PAIR(0xBDA5, 0x819D)
+DOUBLE_BYTE_PAIR(0xBDA6, 0x81A0)
+DOUBLE_BYTE_PAIR(0xBDA7, 0x819A)
+DOUBLE_BYTE_PAIR(0xBDA8, 0x8198)
+DOUBLE_BYTE_PAIR(0xBDA9, 0x8517)
+DOUBLE_BYTE_PAIR(0xBDAA, 0x853D)
+DOUBLE_BYTE_PAIR(0xBDAB, 0x851A)
+DOUBLE_BYTE_PAIR(0xBDAC, 0x84EE)
+DOUBLE_BYTE_PAIR(0xBDAD, 0x852C)
+DOUBLE_BYTE_PAIR(0xBDAE, 0x852D)
+DOUBLE_BYTE_PAIR(0xBDAF, 0x8513)
+DOUBLE_BYTE_PAIR(0xBDB0, 0x8511)
+DOUBLE_BYTE_PAIR(0xBDB1, 0x8523)
+DOUBLE_BYTE_PAIR(0xBDB2, 0x8521)
+DOUBLE_BYTE_PAIR(0xBDB3, 0x8514)
+DOUBLE_BYTE_PAIR(0xBDB4, 0x84EC)
+DOUBLE_BYTE_PAIR(0xBDB5, 0x8525)
+DOUBLE_BYTE_PAIR(0xBDB6, 0x84FF)
+DOUBLE_BYTE_PAIR(0xBDB7, 0x8506)
+DOUBLE_BYTE_PAIR(0xBDB8, 0x8782)
+DOUBLE_BYTE_PAIR(0xBDB9, 0x8774)
+DOUBLE_BYTE_PAIR(0xBDBA, 0x8776)
+DOUBLE_BYTE_PAIR(0xBDBB, 0x8760)
+DOUBLE_BYTE_PAIR(0xBDBC, 0x8766)
+DOUBLE_BYTE_PAIR(0xBDBD, 0x8778)
+DOUBLE_BYTE_PAIR(0xBDBE, 0x8768)
+DOUBLE_BYTE_PAIR(0xBDBF, 0x8759)
+DOUBLE_BYTE_PAIR(0xBDC0, 0x8757)
+DOUBLE_BYTE_PAIR(0xBDC1, 0x874C)
+DOUBLE_BYTE_PAIR(0xBDC2, 0x8753)
+DOUBLE_BYTE_PAIR(0xBDC3, 0x885B)
+DOUBLE_BYTE_PAIR(0xBDC4, 0x885D)
+DOUBLE_BYTE_PAIR(0xBDC5, 0x8910)
+DOUBLE_BYTE_PAIR(0xBDC6, 0x8907)
+DOUBLE_BYTE_PAIR(0xBDC7, 0x8912)
+DOUBLE_BYTE_PAIR(0xBDC8, 0x8913)
+DOUBLE_BYTE_PAIR(0xBDC9, 0x8915)
+DOUBLE_BYTE_PAIR(0xBDCA, 0x890A)
+DOUBLE_BYTE_PAIR(0xBDCB, 0x8ABC)
+DOUBLE_BYTE_PAIR(0xBDCC, 0x8AD2)
+DOUBLE_BYTE_PAIR(0xBDCD, 0x8AC7)
+DOUBLE_BYTE_PAIR(0xBDCE, 0x8AC4)
+DOUBLE_BYTE_PAIR(0xBDCF, 0x8A95)
+DOUBLE_BYTE_PAIR(0xBDD0, 0x8ACB)
+DOUBLE_BYTE_PAIR(0xBDD1, 0x8AF8)
+DOUBLE_BYTE_PAIR(0xBDD2, 0x8AB2)
+DOUBLE_BYTE_PAIR(0xBDD3, 0x8AC9)
+DOUBLE_BYTE_PAIR(0xBDD4, 0x8AC2)
+DOUBLE_BYTE_PAIR(0xBDD5, 0x8ABF)
+DOUBLE_BYTE_PAIR(0xBDD6, 0x8AB0)
+DOUBLE_BYTE_PAIR(0xBDD7, 0x8AD6)
+DOUBLE_BYTE_PAIR(0xBDD8, 0x8ACD)
+DOUBLE_BYTE_PAIR(0xBDD9, 0x8AB6)
+DOUBLE_BYTE_PAIR(0xBDDA, 0x8AB9)
+DOUBLE_BYTE_PAIR(0xBDDB, 0x8ADB)
+DOUBLE_BYTE_PAIR(0xBDDC, 0x8C4C)
+DOUBLE_BYTE_PAIR(0xBDDD, 0x8C4E)
+DOUBLE_BYTE_PAIR(0xBDDE, 0x8C6C)
+DOUBLE_BYTE_PAIR(0xBDDF, 0x8CE0)
+DOUBLE_BYTE_PAIR(0xBDE0, 0x8CDE)
+DOUBLE_BYTE_PAIR(0xBDE1, 0x8CE6)
+DOUBLE_BYTE_PAIR(0xBDE2, 0x8CE4)
+DOUBLE_BYTE_PAIR(0xBDE3, 0x8CEC)
+DOUBLE_BYTE_PAIR(0xBDE4, 0x8CED)
+DOUBLE_BYTE_PAIR(0xBDE5, 0x8CE2)
+DOUBLE_BYTE_PAIR(0xBDE6, 0x8CE3)
+DOUBLE_BYTE_PAIR(0xBDE7, 0x8CDC)
+DOUBLE_BYTE_PAIR(0xBDE8, 0x8CEA)
+DOUBLE_BYTE_PAIR(0xBDE9, 0x8CE1)
+DOUBLE_BYTE_PAIR(0xBDEA, 0x8D6D)
+DOUBLE_BYTE_PAIR(0xBDEB, 0x8D9F)
+DOUBLE_BYTE_PAIR(0xBDEC, 0x8DA3)
+DOUBLE_BYTE_PAIR(0xBDED, 0x8E2B)
+DOUBLE_BYTE_PAIR(0xBDEE, 0x8E10)
+DOUBLE_BYTE_PAIR(0xBDEF, 0x8E1D)
+DOUBLE_BYTE_PAIR(0xBDF0, 0x8E22)
+DOUBLE_BYTE_PAIR(0xBDF1, 0x8E0F)
+DOUBLE_BYTE_PAIR(0xBDF2, 0x8E29)
+DOUBLE_BYTE_PAIR(0xBDF3, 0x8E1F)
+DOUBLE_BYTE_PAIR(0xBDF4, 0x8E21)
+DOUBLE_BYTE_PAIR(0xBDF5, 0x8E1E)
+DOUBLE_BYTE_PAIR(0xBDF6, 0x8EBA)
+DOUBLE_BYTE_PAIR(0xBDF7, 0x8F1D)
+DOUBLE_BYTE_PAIR(0xBDF8, 0x8F1B)
+DOUBLE_BYTE_PAIR(0xBDF9, 0x8F1F)
+DOUBLE_BYTE_PAIR(0xBDFA, 0x8F29)
+DOUBLE_BYTE_PAIR(0xBDFB, 0x8F26)
+DOUBLE_BYTE_PAIR(0xBDFC, 0x8F2A)
+DOUBLE_BYTE_PAIR(0xBDFD, 0x8F1C)
+DOUBLE_BYTE_PAIR(0xBDFE, 0x8F1E)
+DOUBLE_BYTE_PAIR(0xBE40, 0x8F25)
+DOUBLE_BYTE_PAIR(0xBE41, 0x9069)
+DOUBLE_BYTE_PAIR(0xBE42, 0x906E)
+DOUBLE_BYTE_PAIR(0xBE43, 0x9068)
+DOUBLE_BYTE_PAIR(0xBE44, 0x906D)
+DOUBLE_BYTE_PAIR(0xBE45, 0x9077)
+DOUBLE_BYTE_PAIR(0xBE46, 0x9130)
+DOUBLE_BYTE_PAIR(0xBE47, 0x912D)
+DOUBLE_BYTE_PAIR(0xBE48, 0x9127)
+DOUBLE_BYTE_PAIR(0xBE49, 0x9131)
+DOUBLE_BYTE_PAIR(0xBE4A, 0x9187)
+DOUBLE_BYTE_PAIR(0xBE4B, 0x9189)
+DOUBLE_BYTE_PAIR(0xBE4C, 0x918B)
+DOUBLE_BYTE_PAIR(0xBE4D, 0x9183)
+DOUBLE_BYTE_PAIR(0xBE4E, 0x92C5)
+DOUBLE_BYTE_PAIR(0xBE4F, 0x92BB)
+DOUBLE_BYTE_PAIR(0xBE50, 0x92B7)
+DOUBLE_BYTE_PAIR(0xBE51, 0x92EA)
+DOUBLE_BYTE_PAIR(0xBE52, 0x92AC)
+DOUBLE_BYTE_PAIR(0xBE53, 0x92E4)
+DOUBLE_BYTE_PAIR(0xBE54, 0x92C1)
+DOUBLE_BYTE_PAIR(0xBE55, 0x92B3)
+DOUBLE_BYTE_PAIR(0xBE56, 0x92BC)
+DOUBLE_BYTE_PAIR(0xBE57, 0x92D2)
+DOUBLE_BYTE_PAIR(0xBE58, 0x92C7)
+DOUBLE_BYTE_PAIR(0xBE59, 0x92F0)
+DOUBLE_BYTE_PAIR(0xBE5A, 0x92B2)
+DOUBLE_BYTE_PAIR(0xBE5B, 0x95AD)
+DOUBLE_BYTE_PAIR(0xBE5C, 0x95B1)
+DOUBLE_BYTE_PAIR(0xBE5D, 0x9704)
+DOUBLE_BYTE_PAIR(0xBE5E, 0x9706)
+DOUBLE_BYTE_PAIR(0xBE5F, 0x9707)
+DOUBLE_BYTE_PAIR(0xBE60, 0x9709)
+DOUBLE_BYTE_PAIR(0xBE61, 0x9760)
+DOUBLE_BYTE_PAIR(0xBE62, 0x978D)
+DOUBLE_BYTE_PAIR(0xBE63, 0x978B)
+DOUBLE_BYTE_PAIR(0xBE64, 0x978F)
+DOUBLE_BYTE_PAIR(0xBE65, 0x9821)
+DOUBLE_BYTE_PAIR(0xBE66, 0x982B)
+DOUBLE_BYTE_PAIR(0xBE67, 0x981C)
+DOUBLE_BYTE_PAIR(0xBE68, 0x98B3)
+DOUBLE_BYTE_PAIR(0xBE69, 0x990A)
+DOUBLE_BYTE_PAIR(0xBE6A, 0x9913)
+DOUBLE_BYTE_PAIR(0xBE6B, 0x9912)
+DOUBLE_BYTE_PAIR(0xBE6C, 0x9918)
+DOUBLE_BYTE_PAIR(0xBE6D, 0x99DD)
+DOUBLE_BYTE_PAIR(0xBE6E, 0x99D0)
+DOUBLE_BYTE_PAIR(0xBE6F, 0x99DF)
+DOUBLE_BYTE_PAIR(0xBE70, 0x99DB)
+DOUBLE_BYTE_PAIR(0xBE71, 0x99D1)
+DOUBLE_BYTE_PAIR(0xBE72, 0x99D5)
+DOUBLE_BYTE_PAIR(0xBE73, 0x99D2)
+DOUBLE_BYTE_PAIR(0xBE74, 0x99D9)
+DOUBLE_BYTE_PAIR(0xBE75, 0x9AB7)
+DOUBLE_BYTE_PAIR(0xBE76, 0x9AEE)
+DOUBLE_BYTE_PAIR(0xBE77, 0x9AEF)
+DOUBLE_BYTE_PAIR(0xBE78, 0x9B27)
+DOUBLE_BYTE_PAIR(0xBE79, 0x9B45)
+DOUBLE_BYTE_PAIR(0xBE7A, 0x9B44)
+DOUBLE_BYTE_PAIR(0xBE7B, 0x9B77)
+DOUBLE_BYTE_PAIR(0xBE7C, 0x9B6F)
+DOUBLE_BYTE_PAIR(0xBE7D, 0x9D06)
+DOUBLE_BYTE_PAIR(0xBE7E, 0x9D09)
+DOUBLE_BYTE_PAIR(0xBEA1, 0x9D03)
+DOUBLE_BYTE_PAIR(0xBEA2, 0x9EA9)
+DOUBLE_BYTE_PAIR(0xBEA3, 0x9EBE)
+DOUBLE_BYTE_PAIR(0xBEA4, 0x9ECE)
+DOUBLE_BYTE_PAIR(0xBEA5, 0x58A8)
+DOUBLE_BYTE_PAIR(0xBEA6, 0x9F52)
+DOUBLE_BYTE_PAIR(0xBEA7, 0x5112)
+DOUBLE_BYTE_PAIR(0xBEA8, 0x5118)
+DOUBLE_BYTE_PAIR(0xBEA9, 0x5114)
+DOUBLE_BYTE_PAIR(0xBEAA, 0x5110)
+DOUBLE_BYTE_PAIR(0xBEAB, 0x5115)
+DOUBLE_BYTE_PAIR(0xBEAC, 0x5180)
+DOUBLE_BYTE_PAIR(0xBEAD, 0x51AA)
+DOUBLE_BYTE_PAIR(0xBEAE, 0x51DD)
+DOUBLE_BYTE_PAIR(0xBEAF, 0x5291)
+DOUBLE_BYTE_PAIR(0xBEB0, 0x5293)
+DOUBLE_BYTE_PAIR(0xBEB1, 0x52F3)
+DOUBLE_BYTE_PAIR(0xBEB2, 0x5659)
+DOUBLE_BYTE_PAIR(0xBEB3, 0x566B)
+DOUBLE_BYTE_PAIR(0xBEB4, 0x5679)
+DOUBLE_BYTE_PAIR(0xBEB5, 0x5669)
+DOUBLE_BYTE_PAIR(0xBEB6, 0x5664)
+DOUBLE_BYTE_PAIR(0xBEB7, 0x5678)
+DOUBLE_BYTE_PAIR(0xBEB8, 0x566A)
+DOUBLE_BYTE_PAIR(0xBEB9, 0x5668)
+DOUBLE_BYTE_PAIR(0xBEBA, 0x5665)
+DOUBLE_BYTE_PAIR(0xBEBB, 0x5671)
+DOUBLE_BYTE_PAIR(0xBEBC, 0x566F)
+DOUBLE_BYTE_PAIR(0xBEBD, 0x566C)
+DOUBLE_BYTE_PAIR(0xBEBE, 0x5662)
+DOUBLE_BYTE_PAIR(0xBEBF, 0x5676)
+DOUBLE_BYTE_PAIR(0xBEC0, 0x58C1)
+DOUBLE_BYTE_PAIR(0xBEC1, 0x58BE)
+DOUBLE_BYTE_PAIR(0xBEC2, 0x58C7)
+DOUBLE_BYTE_PAIR(0xBEC3, 0x58C5)
+DOUBLE_BYTE_PAIR(0xBEC4, 0x596E)
+DOUBLE_BYTE_PAIR(0xBEC5, 0x5B1D)
+DOUBLE_BYTE_PAIR(0xBEC6, 0x5B34)
+DOUBLE_BYTE_PAIR(0xBEC7, 0x5B78)
+DOUBLE_BYTE_PAIR(0xBEC8, 0x5BF0)
+DOUBLE_BYTE_PAIR(0xBEC9, 0x5C0E)
+DOUBLE_BYTE_PAIR(0xBECA, 0x5F4A)
+DOUBLE_BYTE_PAIR(0xBECB, 0x61B2)
+DOUBLE_BYTE_PAIR(0xBECC, 0x6191)
+DOUBLE_BYTE_PAIR(0xBECD, 0x61A9)
+DOUBLE_BYTE_PAIR(0xBECE, 0x618A)
+DOUBLE_BYTE_PAIR(0xBECF, 0x61CD)
+DOUBLE_BYTE_PAIR(0xBED0, 0x61B6)
+DOUBLE_BYTE_PAIR(0xBED1, 0x61BE)
+DOUBLE_BYTE_PAIR(0xBED2, 0x61CA)
+DOUBLE_BYTE_PAIR(0xBED3, 0x61C8)
+DOUBLE_BYTE_PAIR(0xBED4, 0x6230)
+DOUBLE_BYTE_PAIR(0xBED5, 0x64C5)
+DOUBLE_BYTE_PAIR(0xBED6, 0x64C1)
+DOUBLE_BYTE_PAIR(0xBED7, 0x64CB)
+DOUBLE_BYTE_PAIR(0xBED8, 0x64BB)
+DOUBLE_BYTE_PAIR(0xBED9, 0x64BC)
+DOUBLE_BYTE_PAIR(0xBEDA, 0x64DA)
+DOUBLE_BYTE_PAIR(0xBEDB, 0x64C4)
+DOUBLE_BYTE_PAIR(0xBEDC, 0x64C7)
+DOUBLE_BYTE_PAIR(0xBEDD, 0x64C2)
+DOUBLE_BYTE_PAIR(0xBEDE, 0x64CD)
+DOUBLE_BYTE_PAIR(0xBEDF, 0x64BF)
+DOUBLE_BYTE_PAIR(0xBEE0, 0x64D2)
+DOUBLE_BYTE_PAIR(0xBEE1, 0x64D4)
+DOUBLE_BYTE_PAIR(0xBEE2, 0x64BE)
+DOUBLE_BYTE_PAIR(0xBEE3, 0x6574)
+DOUBLE_BYTE_PAIR(0xBEE4, 0x66C6)
+DOUBLE_BYTE_PAIR(0xBEE5, 0x66C9)
+DOUBLE_BYTE_PAIR(0xBEE6, 0x66B9)
+DOUBLE_BYTE_PAIR(0xBEE7, 0x66C4)
+DOUBLE_BYTE_PAIR(0xBEE8, 0x66C7)
+DOUBLE_BYTE_PAIR(0xBEE9, 0x66B8)
+DOUBLE_BYTE_PAIR(0xBEEA, 0x6A3D)
+DOUBLE_BYTE_PAIR(0xBEEB, 0x6A38)
+DOUBLE_BYTE_PAIR(0xBEEC, 0x6A3A)
+DOUBLE_BYTE_PAIR(0xBEED, 0x6A59)
+DOUBLE_BYTE_PAIR(0xBEEE, 0x6A6B)
+DOUBLE_BYTE_PAIR(0xBEEF, 0x6A58)
+DOUBLE_BYTE_PAIR(0xBEF0, 0x6A39)
+DOUBLE_BYTE_PAIR(0xBEF1, 0x6A44)
+DOUBLE_BYTE_PAIR(0xBEF2, 0x6A62)
+DOUBLE_BYTE_PAIR(0xBEF3, 0x6A61)
+DOUBLE_BYTE_PAIR(0xBEF4, 0x6A4B)
+DOUBLE_BYTE_PAIR(0xBEF5, 0x6A47)
+DOUBLE_BYTE_PAIR(0xBEF6, 0x6A35)
+DOUBLE_BYTE_PAIR(0xBEF7, 0x6A5F)
+DOUBLE_BYTE_PAIR(0xBEF8, 0x6A48)
+DOUBLE_BYTE_PAIR(0xBEF9, 0x6B59)
+DOUBLE_BYTE_PAIR(0xBEFA, 0x6B77)
+DOUBLE_BYTE_PAIR(0xBEFB, 0x6C05)
+DOUBLE_BYTE_PAIR(0xBEFC, 0x6FC2)
+DOUBLE_BYTE_PAIR(0xBEFD, 0x6FB1)
+DOUBLE_BYTE_PAIR(0xBEFE, 0x6FA1)
+DOUBLE_BYTE_PAIR(0xBF40, 0x6FC3)
+DOUBLE_BYTE_PAIR(0xBF41, 0x6FA4)
+DOUBLE_BYTE_PAIR(0xBF42, 0x6FC1)
+DOUBLE_BYTE_PAIR(0xBF43, 0x6FA7)
+DOUBLE_BYTE_PAIR(0xBF44, 0x6FB3)
+DOUBLE_BYTE_PAIR(0xBF45, 0x6FC0)
+DOUBLE_BYTE_PAIR(0xBF46, 0x6FB9)
+DOUBLE_BYTE_PAIR(0xBF47, 0x6FB6)
+DOUBLE_BYTE_PAIR(0xBF48, 0x6FA6)
+DOUBLE_BYTE_PAIR(0xBF49, 0x6FA0)
+DOUBLE_BYTE_PAIR(0xBF4A, 0x6FB4)
+DOUBLE_BYTE_PAIR(0xBF4B, 0x71BE)
+DOUBLE_BYTE_PAIR(0xBF4C, 0x71C9)
+DOUBLE_BYTE_PAIR(0xBF4D, 0x71D0)
+DOUBLE_BYTE_PAIR(0xBF4E, 0x71D2)
+DOUBLE_BYTE_PAIR(0xBF4F, 0x71C8)
+DOUBLE_BYTE_PAIR(0xBF50, 0x71D5)
+DOUBLE_BYTE_PAIR(0xBF51, 0x71B9)
+DOUBLE_BYTE_PAIR(0xBF52, 0x71CE)
+DOUBLE_BYTE_PAIR(0xBF53, 0x71D9)
+DOUBLE_BYTE_PAIR(0xBF54, 0x71DC)
+DOUBLE_BYTE_PAIR(0xBF55, 0x71C3)
+DOUBLE_BYTE_PAIR(0xBF56, 0x71C4)
+DOUBLE_BYTE_PAIR(0xBF57, 0x7368)
+DOUBLE_BYTE_PAIR(0xBF58, 0x749C)
+DOUBLE_BYTE_PAIR(0xBF59, 0x74A3)
+DOUBLE_BYTE_PAIR(0xBF5A, 0x7498)
+DOUBLE_BYTE_PAIR(0xBF5B, 0x749F)
+DOUBLE_BYTE_PAIR(0xBF5C, 0x749E)
+DOUBLE_BYTE_PAIR(0xBF5D, 0x74E2)
+DOUBLE_BYTE_PAIR(0xBF5E, 0x750C)
+DOUBLE_BYTE_PAIR(0xBF5F, 0x750D)
+DOUBLE_BYTE_PAIR(0xBF60, 0x7634)
+DOUBLE_BYTE_PAIR(0xBF61, 0x7638)
+DOUBLE_BYTE_PAIR(0xBF62, 0x763A)
+DOUBLE_BYTE_PAIR(0xBF63, 0x76E7)
+DOUBLE_BYTE_PAIR(0xBF64, 0x76E5)
+DOUBLE_BYTE_PAIR(0xBF65, 0x77A0)
+DOUBLE_BYTE_PAIR(0xBF66, 0x779E)
+DOUBLE_BYTE_PAIR(0xBF67, 0x779F)
+DOUBLE_BYTE_PAIR(0xBF68, 0x77A5)
+DOUBLE_BYTE_PAIR(0xBF69, 0x78E8)
+DOUBLE_BYTE_PAIR(0xBF6A, 0x78DA)
+DOUBLE_BYTE_PAIR(0xBF6B, 0x78EC)
+DOUBLE_BYTE_PAIR(0xBF6C, 0x78E7)
+DOUBLE_BYTE_PAIR(0xBF6D, 0x79A6)
+DOUBLE_BYTE_PAIR(0xBF6E, 0x7A4D)
+DOUBLE_BYTE_PAIR(0xBF6F, 0x7A4E)
+DOUBLE_BYTE_PAIR(0xBF70, 0x7A46)
+DOUBLE_BYTE_PAIR(0xBF71, 0x7A4C)
+DOUBLE_BYTE_PAIR(0xBF72, 0x7A4B)
+DOUBLE_BYTE_PAIR(0xBF73, 0x7ABA)
+DOUBLE_BYTE_PAIR(0xBF74, 0x7BD9)
+DOUBLE_BYTE_PAIR(0xBF75, 0x7C11)
+DOUBLE_BYTE_PAIR(0xBF76, 0x7BC9)
+DOUBLE_BYTE_PAIR(0xBF77, 0x7BE4)
+DOUBLE_BYTE_PAIR(0xBF78, 0x7BDB)
+DOUBLE_BYTE_PAIR(0xBF79, 0x7BE1)
+DOUBLE_BYTE_PAIR(0xBF7A, 0x7BE9)
+DOUBLE_BYTE_PAIR(0xBF7B, 0x7BE6)
+DOUBLE_BYTE_PAIR(0xBF7C, 0x7CD5)
+DOUBLE_BYTE_PAIR(0xBF7D, 0x7CD6)
+DOUBLE_BYTE_PAIR(0xBF7E, 0x7E0A)
+DOUBLE_BYTE_PAIR(0xBFA1, 0x7E11)
+DOUBLE_BYTE_PAIR(0xBFA2, 0x7E08)
+DOUBLE_BYTE_PAIR(0xBFA3, 0x7E1B)
+DOUBLE_BYTE_PAIR(0xBFA4, 0x7E23)
+DOUBLE_BYTE_PAIR(0xBFA5, 0x7E1E)
+DOUBLE_BYTE_PAIR(0xBFA6, 0x7E1D)
+DOUBLE_BYTE_PAIR(0xBFA7, 0x7E09)
+DOUBLE_BYTE_PAIR(0xBFA8, 0x7E10)
+DOUBLE_BYTE_PAIR(0xBFA9, 0x7F79)
+DOUBLE_BYTE_PAIR(0xBFAA, 0x7FB2)
+DOUBLE_BYTE_PAIR(0xBFAB, 0x7FF0)
+DOUBLE_BYTE_PAIR(0xBFAC, 0x7FF1)
+DOUBLE_BYTE_PAIR(0xBFAD, 0x7FEE)
+DOUBLE_BYTE_PAIR(0xBFAE, 0x8028)
+DOUBLE_BYTE_PAIR(0xBFAF, 0x81B3)
+DOUBLE_BYTE_PAIR(0xBFB0, 0x81A9)
+DOUBLE_BYTE_PAIR(0xBFB1, 0x81A8)
+DOUBLE_BYTE_PAIR(0xBFB2, 0x81FB)
+DOUBLE_BYTE_PAIR(0xBFB3, 0x8208)
+DOUBLE_BYTE_PAIR(0xBFB4, 0x8258)
+DOUBLE_BYTE_PAIR(0xBFB5, 0x8259)
+DOUBLE_BYTE_PAIR(0xBFB6, 0x854A)
+DOUBLE_BYTE_PAIR(0xBFB7, 0x8559)
+DOUBLE_BYTE_PAIR(0xBFB8, 0x8548)
+DOUBLE_BYTE_PAIR(0xBFB9, 0x8568)
+DOUBLE_BYTE_PAIR(0xBFBA, 0x8569)
+DOUBLE_BYTE_PAIR(0xBFBB, 0x8543)
+DOUBLE_BYTE_PAIR(0xBFBC, 0x8549)
+DOUBLE_BYTE_PAIR(0xBFBD, 0x856D)
+DOUBLE_BYTE_PAIR(0xBFBE, 0x856A)
+DOUBLE_BYTE_PAIR(0xBFBF, 0x855E)
+DOUBLE_BYTE_PAIR(0xBFC0, 0x8783)
+DOUBLE_BYTE_PAIR(0xBFC1, 0x879F)
+DOUBLE_BYTE_PAIR(0xBFC2, 0x879E)
+DOUBLE_BYTE_PAIR(0xBFC3, 0x87A2)
+DOUBLE_BYTE_PAIR(0xBFC4, 0x878D)
+DOUBLE_BYTE_PAIR(0xBFC5, 0x8861)
+DOUBLE_BYTE_PAIR(0xBFC6, 0x892A)
+DOUBLE_BYTE_PAIR(0xBFC7, 0x8932)
+DOUBLE_BYTE_PAIR(0xBFC8, 0x8925)
+DOUBLE_BYTE_PAIR(0xBFC9, 0x892B)
+DOUBLE_BYTE_PAIR(0xBFCA, 0x8921)
+DOUBLE_BYTE_PAIR(0xBFCB, 0x89AA)
+DOUBLE_BYTE_PAIR(0xBFCC, 0x89A6)
+DOUBLE_BYTE_PAIR(0xBFCD, 0x8AE6)
+DOUBLE_BYTE_PAIR(0xBFCE, 0x8AFA)
+DOUBLE_BYTE_PAIR(0xBFCF, 0x8AEB)
+DOUBLE_BYTE_PAIR(0xBFD0, 0x8AF1)
+DOUBLE_BYTE_PAIR(0xBFD1, 0x8B00)
+DOUBLE_BYTE_PAIR(0xBFD2, 0x8ADC)
+DOUBLE_BYTE_PAIR(0xBFD3, 0x8AE7)
+DOUBLE_BYTE_PAIR(0xBFD4, 0x8AEE)
+DOUBLE_BYTE_PAIR(0xBFD5, 0x8AFE)
+DOUBLE_BYTE_PAIR(0xBFD6, 0x8B01)
+DOUBLE_BYTE_PAIR(0xBFD7, 0x8B02)
+DOUBLE_BYTE_PAIR(0xBFD8, 0x8AF7)
+DOUBLE_BYTE_PAIR(0xBFD9, 0x8AED)
+DOUBLE_BYTE_PAIR(0xBFDA, 0x8AF3)
+DOUBLE_BYTE_PAIR(0xBFDB, 0x8AF6)
+DOUBLE_BYTE_PAIR(0xBFDC, 0x8AFC)
+DOUBLE_BYTE_PAIR(0xBFDD, 0x8C6B)
+DOUBLE_BYTE_PAIR(0xBFDE, 0x8C6D)
+DOUBLE_BYTE_PAIR(0xBFDF, 0x8C93)
+DOUBLE_BYTE_PAIR(0xBFE0, 0x8CF4)
+DOUBLE_BYTE_PAIR(0xBFE1, 0x8E44)
+DOUBLE_BYTE_PAIR(0xBFE2, 0x8E31)
+DOUBLE_BYTE_PAIR(0xBFE3, 0x8E34)
+DOUBLE_BYTE_PAIR(0xBFE4, 0x8E42)
+DOUBLE_BYTE_PAIR(0xBFE5, 0x8E39)
+DOUBLE_BYTE_PAIR(0xBFE6, 0x8E35)
+DOUBLE_BYTE_PAIR(0xBFE7, 0x8F3B)
+DOUBLE_BYTE_PAIR(0xBFE8, 0x8F2F)
+DOUBLE_BYTE_PAIR(0xBFE9, 0x8F38)
+DOUBLE_BYTE_PAIR(0xBFEA, 0x8F33)
+DOUBLE_BYTE_PAIR(0xBFEB, 0x8FA8)
+DOUBLE_BYTE_PAIR(0xBFEC, 0x8FA6)
+DOUBLE_BYTE_PAIR(0xBFED, 0x9075)
+DOUBLE_BYTE_PAIR(0xBFEE, 0x9074)
+DOUBLE_BYTE_PAIR(0xBFEF, 0x9078)
+DOUBLE_BYTE_PAIR(0xBFF0, 0x9072)
+DOUBLE_BYTE_PAIR(0xBFF1, 0x907C)
+DOUBLE_BYTE_PAIR(0xBFF2, 0x907A)
+DOUBLE_BYTE_PAIR(0xBFF3, 0x9134)
+DOUBLE_BYTE_PAIR(0xBFF4, 0x9192)
+DOUBLE_BYTE_PAIR(0xBFF5, 0x9320)
+DOUBLE_BYTE_PAIR(0xBFF6, 0x9336)
+DOUBLE_BYTE_PAIR(0xBFF7, 0x92F8)
+DOUBLE_BYTE_PAIR(0xBFF8, 0x9333)
+DOUBLE_BYTE_PAIR(0xBFF9, 0x932F)
+DOUBLE_BYTE_PAIR(0xBFFA, 0x9322)
+DOUBLE_BYTE_PAIR(0xBFFB, 0x92FC)
+DOUBLE_BYTE_PAIR(0xBFFC, 0x932B)
+DOUBLE_BYTE_PAIR(0xBFFD, 0x9304)
+DOUBLE_BYTE_PAIR(0xBFFE, 0x931A)
+DOUBLE_BYTE_PAIR(0xC040, 0x9310)
+DOUBLE_BYTE_PAIR(0xC041, 0x9326)
+DOUBLE_BYTE_PAIR(0xC042, 0x9321)
+DOUBLE_BYTE_PAIR(0xC043, 0x9315)
+DOUBLE_BYTE_PAIR(0xC044, 0x932E)
+DOUBLE_BYTE_PAIR(0xC045, 0x9319)
+DOUBLE_BYTE_PAIR(0xC046, 0x95BB)
+DOUBLE_BYTE_PAIR(0xC047, 0x96A7)
+DOUBLE_BYTE_PAIR(0xC048, 0x96A8)
+DOUBLE_BYTE_PAIR(0xC049, 0x96AA)
+DOUBLE_BYTE_PAIR(0xC04A, 0x96D5)
+DOUBLE_BYTE_PAIR(0xC04B, 0x970E)
+DOUBLE_BYTE_PAIR(0xC04C, 0x9711)
+DOUBLE_BYTE_PAIR(0xC04D, 0x9716)
+DOUBLE_BYTE_PAIR(0xC04E, 0x970D)
+DOUBLE_BYTE_PAIR(0xC04F, 0x9713)
+DOUBLE_BYTE_PAIR(0xC050, 0x970F)
+DOUBLE_BYTE_PAIR(0xC051, 0x975B)
+DOUBLE_BYTE_PAIR(0xC052, 0x975C)
+DOUBLE_BYTE_PAIR(0xC053, 0x9766)
+DOUBLE_BYTE_PAIR(0xC054, 0x9798)
+DOUBLE_BYTE_PAIR(0xC055, 0x9830)
+DOUBLE_BYTE_PAIR(0xC056, 0x9838)
+DOUBLE_BYTE_PAIR(0xC057, 0x983B)
+DOUBLE_BYTE_PAIR(0xC058, 0x9837)
+DOUBLE_BYTE_PAIR(0xC059, 0x982D)
+DOUBLE_BYTE_PAIR(0xC05A, 0x9839)
+DOUBLE_BYTE_PAIR(0xC05B, 0x9824)
+DOUBLE_BYTE_PAIR(0xC05C, 0x9910)
+DOUBLE_BYTE_PAIR(0xC05D, 0x9928)
+DOUBLE_BYTE_PAIR(0xC05E, 0x991E)
+DOUBLE_BYTE_PAIR(0xC05F, 0x991B)
+DOUBLE_BYTE_PAIR(0xC060, 0x9921)
+DOUBLE_BYTE_PAIR(0xC061, 0x991A)
+DOUBLE_BYTE_PAIR(0xC062, 0x99ED)
+DOUBLE_BYTE_PAIR(0xC063, 0x99E2)
+DOUBLE_BYTE_PAIR(0xC064, 0x99F1)
+DOUBLE_BYTE_PAIR(0xC065, 0x9AB8)
+DOUBLE_BYTE_PAIR(0xC066, 0x9ABC)
+DOUBLE_BYTE_PAIR(0xC067, 0x9AFB)
+DOUBLE_BYTE_PAIR(0xC068, 0x9AED)
+DOUBLE_BYTE_PAIR(0xC069, 0x9B28)
+DOUBLE_BYTE_PAIR(0xC06A, 0x9B91)
+DOUBLE_BYTE_PAIR(0xC06B, 0x9D15)
+DOUBLE_BYTE_PAIR(0xC06C, 0x9D23)
+DOUBLE_BYTE_PAIR(0xC06D, 0x9D26)
+DOUBLE_BYTE_PAIR(0xC06E, 0x9D28)
+DOUBLE_BYTE_PAIR(0xC06F, 0x9D12)
+DOUBLE_BYTE_PAIR(0xC070, 0x9D1B)
+DOUBLE_BYTE_PAIR(0xC071, 0x9ED8)
+DOUBLE_BYTE_PAIR(0xC072, 0x9ED4)
+DOUBLE_BYTE_PAIR(0xC073, 0x9F8D)
+DOUBLE_BYTE_PAIR(0xC074, 0x9F9C)
+DOUBLE_BYTE_PAIR(0xC075, 0x512A)
+DOUBLE_BYTE_PAIR(0xC076, 0x511F)
+DOUBLE_BYTE_PAIR(0xC077, 0x5121)
+DOUBLE_BYTE_PAIR(0xC078, 0x5132)
+DOUBLE_BYTE_PAIR(0xC079, 0x52F5)
+DOUBLE_BYTE_PAIR(0xC07A, 0x568E)
+DOUBLE_BYTE_PAIR(0xC07B, 0x5680)
+DOUBLE_BYTE_PAIR(0xC07C, 0x5690)
+DOUBLE_BYTE_PAIR(0xC07D, 0x5685)
+DOUBLE_BYTE_PAIR(0xC07E, 0x5687)
+DOUBLE_BYTE_PAIR(0xC0A1, 0x568F)
+DOUBLE_BYTE_PAIR(0xC0A2, 0x58D5)
+DOUBLE_BYTE_PAIR(0xC0A3, 0x58D3)
+DOUBLE_BYTE_PAIR(0xC0A4, 0x58D1)
+DOUBLE_BYTE_PAIR(0xC0A5, 0x58CE)
+DOUBLE_BYTE_PAIR(0xC0A6, 0x5B30)
+DOUBLE_BYTE_PAIR(0xC0A7, 0x5B2A)
+DOUBLE_BYTE_PAIR(0xC0A8, 0x5B24)
+DOUBLE_BYTE_PAIR(0xC0A9, 0x5B7A)
+DOUBLE_BYTE_PAIR(0xC0AA, 0x5C37)
+DOUBLE_BYTE_PAIR(0xC0AB, 0x5C68)
+DOUBLE_BYTE_PAIR(0xC0AC, 0x5DBC)
+DOUBLE_BYTE_PAIR(0xC0AD, 0x5DBA)
+DOUBLE_BYTE_PAIR(0xC0AE, 0x5DBD)
+DOUBLE_BYTE_PAIR(0xC0AF, 0x5DB8)
+DOUBLE_BYTE_PAIR(0xC0B0, 0x5E6B)
+DOUBLE_BYTE_PAIR(0xC0B1, 0x5F4C)
+DOUBLE_BYTE_PAIR(0xC0B2, 0x5FBD)
+DOUBLE_BYTE_PAIR(0xC0B3, 0x61C9)
+DOUBLE_BYTE_PAIR(0xC0B4, 0x61C2)
+DOUBLE_BYTE_PAIR(0xC0B5, 0x61C7)
+DOUBLE_BYTE_PAIR(0xC0B6, 0x61E6)
+DOUBLE_BYTE_PAIR(0xC0B7, 0x61CB)
+DOUBLE_BYTE_PAIR(0xC0B8, 0x6232)
+DOUBLE_BYTE_PAIR(0xC0B9, 0x6234)
+DOUBLE_BYTE_PAIR(0xC0BA, 0x64CE)
+DOUBLE_BYTE_PAIR(0xC0BB, 0x64CA)
+DOUBLE_BYTE_PAIR(0xC0BC, 0x64D8)
+DOUBLE_BYTE_PAIR(0xC0BD, 0x64E0)
+DOUBLE_BYTE_PAIR(0xC0BE, 0x64F0)
+DOUBLE_BYTE_PAIR(0xC0BF, 0x64E6)
+DOUBLE_BYTE_PAIR(0xC0C0, 0x64EC)
+DOUBLE_BYTE_PAIR(0xC0C1, 0x64F1)
+DOUBLE_BYTE_PAIR(0xC0C2, 0x64E2)
+DOUBLE_BYTE_PAIR(0xC0C3, 0x64ED)
+DOUBLE_BYTE_PAIR(0xC0C4, 0x6582)
+DOUBLE_BYTE_PAIR(0xC0C5, 0x6583)
+DOUBLE_BYTE_PAIR(0xC0C6, 0x66D9)
+DOUBLE_BYTE_PAIR(0xC0C7, 0x66D6)
+DOUBLE_BYTE_PAIR(0xC0C8, 0x6A80)
+DOUBLE_BYTE_PAIR(0xC0C9, 0x6A94)
+DOUBLE_BYTE_PAIR(0xC0CA, 0x6A84)
+DOUBLE_BYTE_PAIR(0xC0CB, 0x6AA2)
+DOUBLE_BYTE_PAIR(0xC0CC, 0x6A9C)
+DOUBLE_BYTE_PAIR(0xC0CD, 0x6ADB)
+DOUBLE_BYTE_PAIR(0xC0CE, 0x6AA3)
+DOUBLE_BYTE_PAIR(0xC0CF, 0x6A7E)
+DOUBLE_BYTE_PAIR(0xC0D0, 0x6A97)
+DOUBLE_BYTE_PAIR(0xC0D1, 0x6A90)
+DOUBLE_BYTE_PAIR(0xC0D2, 0x6AA0)
+DOUBLE_BYTE_PAIR(0xC0D3, 0x6B5C)
+DOUBLE_BYTE_PAIR(0xC0D4, 0x6BAE)
+DOUBLE_BYTE_PAIR(0xC0D5, 0x6BDA)
+DOUBLE_BYTE_PAIR(0xC0D6, 0x6C08)
+DOUBLE_BYTE_PAIR(0xC0D7, 0x6FD8)
+DOUBLE_BYTE_PAIR(0xC0D8, 0x6FF1)
+DOUBLE_BYTE_PAIR(0xC0D9, 0x6FDF)
+DOUBLE_BYTE_PAIR(0xC0DA, 0x6FE0)
+DOUBLE_BYTE_PAIR(0xC0DB, 0x6FDB)
+DOUBLE_BYTE_PAIR(0xC0DC, 0x6FE4)
+DOUBLE_BYTE_PAIR(0xC0DD, 0x6FEB)
+DOUBLE_BYTE_PAIR(0xC0DE, 0x6FEF)
+DOUBLE_BYTE_PAIR(0xC0DF, 0x6F80)
+DOUBLE_BYTE_PAIR(0xC0E0, 0x6FEC)
+DOUBLE_BYTE_PAIR(0xC0E1, 0x6FE1)
+DOUBLE_BYTE_PAIR(0xC0E2, 0x6FE9)
+DOUBLE_BYTE_PAIR(0xC0E3, 0x6FD5)
+DOUBLE_BYTE_PAIR(0xC0E4, 0x6FEE)
+DOUBLE_BYTE_PAIR(0xC0E5, 0x6FF0)
+DOUBLE_BYTE_PAIR(0xC0E6, 0x71E7)
+DOUBLE_BYTE_PAIR(0xC0E7, 0x71DF)
+DOUBLE_BYTE_PAIR(0xC0E8, 0x71EE)
+DOUBLE_BYTE_PAIR(0xC0E9, 0x71E6)
+DOUBLE_BYTE_PAIR(0xC0EA, 0x71E5)
+DOUBLE_BYTE_PAIR(0xC0EB, 0x71ED)
+DOUBLE_BYTE_PAIR(0xC0EC, 0x71EC)
+DOUBLE_BYTE_PAIR(0xC0ED, 0x71F4)
+DOUBLE_BYTE_PAIR(0xC0EE, 0x71E0)
+DOUBLE_BYTE_PAIR(0xC0EF, 0x7235)
+DOUBLE_BYTE_PAIR(0xC0F0, 0x7246)
+DOUBLE_BYTE_PAIR(0xC0F1, 0x7370)
+DOUBLE_BYTE_PAIR(0xC0F2, 0x7372)
+DOUBLE_BYTE_PAIR(0xC0F3, 0x74A9)
+DOUBLE_BYTE_PAIR(0xC0F4, 0x74B0)
+DOUBLE_BYTE_PAIR(0xC0F5, 0x74A6)
+DOUBLE_BYTE_PAIR(0xC0F6, 0x74A8)
+DOUBLE_BYTE_PAIR(0xC0F7, 0x7646)
+DOUBLE_BYTE_PAIR(0xC0F8, 0x7642)
+DOUBLE_BYTE_PAIR(0xC0F9, 0x764C)
+DOUBLE_BYTE_PAIR(0xC0FA, 0x76EA)
+DOUBLE_BYTE_PAIR(0xC0FB, 0x77B3)
+DOUBLE_BYTE_PAIR(0xC0FC, 0x77AA)
+DOUBLE_BYTE_PAIR(0xC0FD, 0x77B0)
+DOUBLE_BYTE_PAIR(0xC0FE, 0x77AC)
+DOUBLE_BYTE_PAIR(0xC140, 0x77A7)
+DOUBLE_BYTE_PAIR(0xC141, 0x77AD)
+DOUBLE_BYTE_PAIR(0xC142, 0x77EF)
+DOUBLE_BYTE_PAIR(0xC143, 0x78F7)
+DOUBLE_BYTE_PAIR(0xC144, 0x78FA)
+DOUBLE_BYTE_PAIR(0xC145, 0x78F4)
+DOUBLE_BYTE_PAIR(0xC146, 0x78EF)
+DOUBLE_BYTE_PAIR(0xC147, 0x7901)
+DOUBLE_BYTE_PAIR(0xC148, 0x79A7)
+DOUBLE_BYTE_PAIR(0xC149, 0x79AA)
+DOUBLE_BYTE_PAIR(0xC14A, 0x7A57)
+DOUBLE_BYTE_PAIR(0xC14B, 0x7ABF)
+DOUBLE_BYTE_PAIR(0xC14C, 0x7C07)
+DOUBLE_BYTE_PAIR(0xC14D, 0x7C0D)
+DOUBLE_BYTE_PAIR(0xC14E, 0x7BFE)
+DOUBLE_BYTE_PAIR(0xC14F, 0x7BF7)
+DOUBLE_BYTE_PAIR(0xC150, 0x7C0C)
+DOUBLE_BYTE_PAIR(0xC151, 0x7BE0)
+DOUBLE_BYTE_PAIR(0xC152, 0x7CE0)
+DOUBLE_BYTE_PAIR(0xC153, 0x7CDC)
+DOUBLE_BYTE_PAIR(0xC154, 0x7CDE)
+DOUBLE_BYTE_PAIR(0xC155, 0x7CE2)
+DOUBLE_BYTE_PAIR(0xC156, 0x7CDF)
+DOUBLE_BYTE_PAIR(0xC157, 0x7CD9)
+DOUBLE_BYTE_PAIR(0xC158, 0x7CDD)
+DOUBLE_BYTE_PAIR(0xC159, 0x7E2E)
+DOUBLE_BYTE_PAIR(0xC15A, 0x7E3E)
+DOUBLE_BYTE_PAIR(0xC15B, 0x7E46)
+DOUBLE_BYTE_PAIR(0xC15C, 0x7E37)
+DOUBLE_BYTE_PAIR(0xC15D, 0x7E32)
+DOUBLE_BYTE_PAIR(0xC15E, 0x7E43)
+DOUBLE_BYTE_PAIR(0xC15F, 0x7E2B)
+DOUBLE_BYTE_PAIR(0xC160, 0x7E3D)
+DOUBLE_BYTE_PAIR(0xC161, 0x7E31)
+DOUBLE_BYTE_PAIR(0xC162, 0x7E45)
+DOUBLE_BYTE_PAIR(0xC163, 0x7E41)
+DOUBLE_BYTE_PAIR(0xC164, 0x7E34)
+DOUBLE_BYTE_PAIR(0xC165, 0x7E39)
+DOUBLE_BYTE_PAIR(0xC166, 0x7E48)
+DOUBLE_BYTE_PAIR(0xC167, 0x7E35)
+DOUBLE_BYTE_PAIR(0xC168, 0x7E3F)
+DOUBLE_BYTE_PAIR(0xC169, 0x7E2F)
+DOUBLE_BYTE_PAIR(0xC16A, 0x7F44)
+DOUBLE_BYTE_PAIR(0xC16B, 0x7FF3)
+DOUBLE_BYTE_PAIR(0xC16C, 0x7FFC)
+DOUBLE_BYTE_PAIR(0xC16D, 0x8071)
+DOUBLE_BYTE_PAIR(0xC16E, 0x8072)
+DOUBLE_BYTE_PAIR(0xC16F, 0x8070)
+DOUBLE_BYTE_PAIR(0xC170, 0x806F)
+DOUBLE_BYTE_PAIR(0xC171, 0x8073)
+DOUBLE_BYTE_PAIR(0xC172, 0x81C6)
+DOUBLE_BYTE_PAIR(0xC173, 0x81C3)
+DOUBLE_BYTE_PAIR(0xC174, 0x81BA)
+DOUBLE_BYTE_PAIR(0xC175, 0x81C2)
+DOUBLE_BYTE_PAIR(0xC176, 0x81C0)
+DOUBLE_BYTE_PAIR(0xC177, 0x81BF)
+DOUBLE_BYTE_PAIR(0xC178, 0x81BD)
+DOUBLE_BYTE_PAIR(0xC179, 0x81C9)
+DOUBLE_BYTE_PAIR(0xC17A, 0x81BE)
+DOUBLE_BYTE_PAIR(0xC17B, 0x81E8)
+DOUBLE_BYTE_PAIR(0xC17C, 0x8209)
+DOUBLE_BYTE_PAIR(0xC17D, 0x8271)
+DOUBLE_BYTE_PAIR(0xC17E, 0x85AA)
+DOUBLE_BYTE_PAIR(0xC1A1, 0x8584)
+DOUBLE_BYTE_PAIR(0xC1A2, 0x857E)
+DOUBLE_BYTE_PAIR(0xC1A3, 0x859C)
+DOUBLE_BYTE_PAIR(0xC1A4, 0x8591)
+DOUBLE_BYTE_PAIR(0xC1A5, 0x8594)
+DOUBLE_BYTE_PAIR(0xC1A6, 0x85AF)
+DOUBLE_BYTE_PAIR(0xC1A7, 0x859B)
+DOUBLE_BYTE_PAIR(0xC1A8, 0x8587)
+DOUBLE_BYTE_PAIR(0xC1A9, 0x85A8)
+DOUBLE_BYTE_PAIR(0xC1AA, 0x858A)
+DOUBLE_BYTE_PAIR(0xC1AB, 0x8667)
+DOUBLE_BYTE_PAIR(0xC1AC, 0x87C0)
+DOUBLE_BYTE_PAIR(0xC1AD, 0x87D1)
+DOUBLE_BYTE_PAIR(0xC1AE, 0x87B3)
+DOUBLE_BYTE_PAIR(0xC1AF, 0x87D2)
+DOUBLE_BYTE_PAIR(0xC1B0, 0x87C6)
+DOUBLE_BYTE_PAIR(0xC1B1, 0x87AB)
+DOUBLE_BYTE_PAIR(0xC1B2, 0x87BB)
+DOUBLE_BYTE_PAIR(0xC1B3, 0x87BA)
+DOUBLE_BYTE_PAIR(0xC1B4, 0x87C8)
+DOUBLE_BYTE_PAIR(0xC1B5, 0x87CB)
+DOUBLE_BYTE_PAIR(0xC1B6, 0x893B)
+DOUBLE_BYTE_PAIR(0xC1B7, 0x8936)
+DOUBLE_BYTE_PAIR(0xC1B8, 0x8944)
+DOUBLE_BYTE_PAIR(0xC1B9, 0x8938)
+DOUBLE_BYTE_PAIR(0xC1BA, 0x893D)
+DOUBLE_BYTE_PAIR(0xC1BB, 0x89AC)
+DOUBLE_BYTE_PAIR(0xC1BC, 0x8B0E)
+DOUBLE_BYTE_PAIR(0xC1BD, 0x8B17)
+DOUBLE_BYTE_PAIR(0xC1BE, 0x8B19)
+DOUBLE_BYTE_PAIR(0xC1BF, 0x8B1B)
+DOUBLE_BYTE_PAIR(0xC1C0, 0x8B0A)
+DOUBLE_BYTE_PAIR(0xC1C1, 0x8B20)
+DOUBLE_BYTE_PAIR(0xC1C2, 0x8B1D)
+DOUBLE_BYTE_PAIR(0xC1C3, 0x8B04)
+DOUBLE_BYTE_PAIR(0xC1C4, 0x8B10)
+DOUBLE_BYTE_PAIR(0xC1C5, 0x8C41)
+DOUBLE_BYTE_PAIR(0xC1C6, 0x8C3F)
+DOUBLE_BYTE_PAIR(0xC1C7, 0x8C73)
+DOUBLE_BYTE_PAIR(0xC1C8, 0x8CFA)
+DOUBLE_BYTE_PAIR(0xC1C9, 0x8CFD)
+DOUBLE_BYTE_PAIR(0xC1CA, 0x8CFC)
+DOUBLE_BYTE_PAIR(0xC1CB, 0x8CF8)
+DOUBLE_BYTE_PAIR(0xC1CC, 0x8CFB)
+DOUBLE_BYTE_PAIR(0xC1CD, 0x8DA8)
+DOUBLE_BYTE_PAIR(0xC1CE, 0x8E49)
+DOUBLE_BYTE_PAIR(0xC1CF, 0x8E4B)
+DOUBLE_BYTE_PAIR(0xC1D0, 0x8E48)
+DOUBLE_BYTE_PAIR(0xC1D1, 0x8E4A)
+DOUBLE_BYTE_PAIR(0xC1D2, 0x8F44)
+DOUBLE_BYTE_PAIR(0xC1D3, 0x8F3E)
+DOUBLE_BYTE_PAIR(0xC1D4, 0x8F42)
+DOUBLE_BYTE_PAIR(0xC1D5, 0x8F45)
+DOUBLE_BYTE_PAIR(0xC1D6, 0x8F3F)
+DOUBLE_BYTE_PAIR(0xC1D7, 0x907F)
+DOUBLE_BYTE_PAIR(0xC1D8, 0x907D)
+DOUBLE_BYTE_PAIR(0xC1D9, 0x9084)
+DOUBLE_BYTE_PAIR(0xC1DA, 0x9081)
+DOUBLE_BYTE_PAIR(0xC1DB, 0x9082)
+DOUBLE_BYTE_PAIR(0xC1DC, 0x9080)
+DOUBLE_BYTE_PAIR(0xC1DD, 0x9139)
+DOUBLE_BYTE_PAIR(0xC1DE, 0x91A3)
+DOUBLE_BYTE_PAIR(0xC1DF, 0x919E)
+DOUBLE_BYTE_PAIR(0xC1E0, 0x919C)
+DOUBLE_BYTE_PAIR(0xC1E1, 0x934D)
+DOUBLE_BYTE_PAIR(0xC1E2, 0x9382)
+DOUBLE_BYTE_PAIR(0xC1E3, 0x9328)
+DOUBLE_BYTE_PAIR(0xC1E4, 0x9375)
+DOUBLE_BYTE_PAIR(0xC1E5, 0x934A)
+DOUBLE_BYTE_PAIR(0xC1E6, 0x9365)
+DOUBLE_BYTE_PAIR(0xC1E7, 0x934B)
+DOUBLE_BYTE_PAIR(0xC1E8, 0x9318)
+DOUBLE_BYTE_PAIR(0xC1E9, 0x937E)
+DOUBLE_BYTE_PAIR(0xC1EA, 0x936C)
+DOUBLE_BYTE_PAIR(0xC1EB, 0x935B)
+DOUBLE_BYTE_PAIR(0xC1EC, 0x9370)
+DOUBLE_BYTE_PAIR(0xC1ED, 0x935A)
+DOUBLE_BYTE_PAIR(0xC1EE, 0x9354)
+DOUBLE_BYTE_PAIR(0xC1EF, 0x95CA)
+DOUBLE_BYTE_PAIR(0xC1F0, 0x95CB)
+DOUBLE_BYTE_PAIR(0xC1F1, 0x95CC)
+DOUBLE_BYTE_PAIR(0xC1F2, 0x95C8)
+DOUBLE_BYTE_PAIR(0xC1F3, 0x95C6)
+DOUBLE_BYTE_PAIR(0xC1F4, 0x96B1)
+DOUBLE_BYTE_PAIR(0xC1F5, 0x96B8)
+DOUBLE_BYTE_PAIR(0xC1F6, 0x96D6)
+DOUBLE_BYTE_PAIR(0xC1F7, 0x971C)
+DOUBLE_BYTE_PAIR(0xC1F8, 0x971E)
+DOUBLE_BYTE_PAIR(0xC1F9, 0x97A0)
+DOUBLE_BYTE_PAIR(0xC1FA, 0x97D3)
+DOUBLE_BYTE_PAIR(0xC1FB, 0x9846)
+DOUBLE_BYTE_PAIR(0xC1FC, 0x98B6)
+DOUBLE_BYTE_PAIR(0xC1FD, 0x9935)
+DOUBLE_BYTE_PAIR(0xC1FE, 0x9A01)
+DOUBLE_BYTE_PAIR(0xC240, 0x99FF)
+DOUBLE_BYTE_PAIR(0xC241, 0x9BAE)
+DOUBLE_BYTE_PAIR(0xC242, 0x9BAB)
+DOUBLE_BYTE_PAIR(0xC243, 0x9BAA)
+DOUBLE_BYTE_PAIR(0xC244, 0x9BAD)
+DOUBLE_BYTE_PAIR(0xC245, 0x9D3B)
+DOUBLE_BYTE_PAIR(0xC246, 0x9D3F)
+DOUBLE_BYTE_PAIR(0xC247, 0x9E8B)
+DOUBLE_BYTE_PAIR(0xC248, 0x9ECF)
+DOUBLE_BYTE_PAIR(0xC249, 0x9EDE)
+DOUBLE_BYTE_PAIR(0xC24A, 0x9EDC)
+DOUBLE_BYTE_PAIR(0xC24B, 0x9EDD)
+DOUBLE_BYTE_PAIR(0xC24C, 0x9EDB)
+DOUBLE_BYTE_PAIR(0xC24D, 0x9F3E)
+DOUBLE_BYTE_PAIR(0xC24E, 0x9F4B)
+DOUBLE_BYTE_PAIR(0xC24F, 0x53E2)
+DOUBLE_BYTE_PAIR(0xC250, 0x5695)
+DOUBLE_BYTE_PAIR(0xC251, 0x56AE)
+DOUBLE_BYTE_PAIR(0xC252, 0x58D9)
+DOUBLE_BYTE_PAIR(0xC253, 0x58D8)
+DOUBLE_BYTE_PAIR(0xC254, 0x5B38)
+DOUBLE_BYTE_PAIR(0xC255, 0x5F5D)
+DOUBLE_BYTE_PAIR(0xC256, 0x61E3)
+DOUBLE_BYTE_PAIR(0xC257, 0x6233)
+DOUBLE_BYTE_PAIR(0xC258, 0x64F4)
+DOUBLE_BYTE_PAIR(0xC259, 0x64F2)
+DOUBLE_BYTE_PAIR(0xC25A, 0x64FE)
+DOUBLE_BYTE_PAIR(0xC25B, 0x6506)
+DOUBLE_BYTE_PAIR(0xC25C, 0x64FA)
+DOUBLE_BYTE_PAIR(0xC25D, 0x64FB)
+DOUBLE_BYTE_PAIR(0xC25E, 0x64F7)
+DOUBLE_BYTE_PAIR(0xC25F, 0x65B7)
+DOUBLE_BYTE_PAIR(0xC260, 0x66DC)
+DOUBLE_BYTE_PAIR(0xC261, 0x6726)
+DOUBLE_BYTE_PAIR(0xC262, 0x6AB3)
+DOUBLE_BYTE_PAIR(0xC263, 0x6AAC)
+DOUBLE_BYTE_PAIR(0xC264, 0x6AC3)
+DOUBLE_BYTE_PAIR(0xC265, 0x6ABB)
+DOUBLE_BYTE_PAIR(0xC266, 0x6AB8)
+DOUBLE_BYTE_PAIR(0xC267, 0x6AC2)
+DOUBLE_BYTE_PAIR(0xC268, 0x6AAE)
+DOUBLE_BYTE_PAIR(0xC269, 0x6AAF)
+DOUBLE_BYTE_PAIR(0xC26A, 0x6B5F)
+DOUBLE_BYTE_PAIR(0xC26B, 0x6B78)
+DOUBLE_BYTE_PAIR(0xC26C, 0x6BAF)
+DOUBLE_BYTE_PAIR(0xC26D, 0x7009)
+DOUBLE_BYTE_PAIR(0xC26E, 0x700B)
+DOUBLE_BYTE_PAIR(0xC26F, 0x6FFE)
+DOUBLE_BYTE_PAIR(0xC270, 0x7006)
+DOUBLE_BYTE_PAIR(0xC271, 0x6FFA)
+DOUBLE_BYTE_PAIR(0xC272, 0x7011)
+DOUBLE_BYTE_PAIR(0xC273, 0x700F)
+DOUBLE_BYTE_PAIR(0xC274, 0x71FB)
+DOUBLE_BYTE_PAIR(0xC275, 0x71FC)
+DOUBLE_BYTE_PAIR(0xC276, 0x71FE)
+DOUBLE_BYTE_PAIR(0xC277, 0x71F8)
+DOUBLE_BYTE_PAIR(0xC278, 0x7377)
+DOUBLE_BYTE_PAIR(0xC279, 0x7375)
+DOUBLE_BYTE_PAIR(0xC27A, 0x74A7)
+DOUBLE_BYTE_PAIR(0xC27B, 0x74BF)
+DOUBLE_BYTE_PAIR(0xC27C, 0x7515)
+DOUBLE_BYTE_PAIR(0xC27D, 0x7656)
+DOUBLE_BYTE_PAIR(0xC27E, 0x7658)
+DOUBLE_BYTE_PAIR(0xC2A1, 0x7652)
+DOUBLE_BYTE_PAIR(0xC2A2, 0x77BD)
+DOUBLE_BYTE_PAIR(0xC2A3, 0x77BF)
+DOUBLE_BYTE_PAIR(0xC2A4, 0x77BB)
+DOUBLE_BYTE_PAIR(0xC2A5, 0x77BC)
+DOUBLE_BYTE_PAIR(0xC2A6, 0x790E)
+DOUBLE_BYTE_PAIR(0xC2A7, 0x79AE)
+DOUBLE_BYTE_PAIR(0xC2A8, 0x7A61)
+DOUBLE_BYTE_PAIR(0xC2A9, 0x7A62)
+DOUBLE_BYTE_PAIR(0xC2AA, 0x7A60)
+DOUBLE_BYTE_PAIR(0xC2AB, 0x7AC4)
+DOUBLE_BYTE_PAIR(0xC2AC, 0x7AC5)
+DOUBLE_BYTE_PAIR(0xC2AD, 0x7C2B)
+DOUBLE_BYTE_PAIR(0xC2AE, 0x7C27)
+DOUBLE_BYTE_PAIR(0xC2AF, 0x7C2A)
+DOUBLE_BYTE_PAIR(0xC2B0, 0x7C1E)
+DOUBLE_BYTE_PAIR(0xC2B1, 0x7C23)
+DOUBLE_BYTE_PAIR(0xC2B2, 0x7C21)
+DOUBLE_BYTE_PAIR(0xC2B3, 0x7CE7)
+DOUBLE_BYTE_PAIR(0xC2B4, 0x7E54)
+DOUBLE_BYTE_PAIR(0xC2B5, 0x7E55)
+DOUBLE_BYTE_PAIR(0xC2B6, 0x7E5E)
+DOUBLE_BYTE_PAIR(0xC2B7, 0x7E5A)
+DOUBLE_BYTE_PAIR(0xC2B8, 0x7E61)
+DOUBLE_BYTE_PAIR(0xC2B9, 0x7E52)
+DOUBLE_BYTE_PAIR(0xC2BA, 0x7E59)
+DOUBLE_BYTE_PAIR(0xC2BB, 0x7F48)
+DOUBLE_BYTE_PAIR(0xC2BC, 0x7FF9)
+DOUBLE_BYTE_PAIR(0xC2BD, 0x7FFB)
+DOUBLE_BYTE_PAIR(0xC2BE, 0x8077)
+DOUBLE_BYTE_PAIR(0xC2BF, 0x8076)
+DOUBLE_BYTE_PAIR(0xC2C0, 0x81CD)
+DOUBLE_BYTE_PAIR(0xC2C1, 0x81CF)
+DOUBLE_BYTE_PAIR(0xC2C2, 0x820A)
+DOUBLE_BYTE_PAIR(0xC2C3, 0x85CF)
+DOUBLE_BYTE_PAIR(0xC2C4, 0x85A9)
+DOUBLE_BYTE_PAIR(0xC2C5, 0x85CD)
+DOUBLE_BYTE_PAIR(0xC2C6, 0x85D0)
+DOUBLE_BYTE_PAIR(0xC2C7, 0x85C9)
+DOUBLE_BYTE_PAIR(0xC2C8, 0x85B0)
+DOUBLE_BYTE_PAIR(0xC2C9, 0x85BA)
+DOUBLE_BYTE_PAIR(0xC2CA, 0x85B9)
+DOUBLE_BYTE_PAIR(0xC2CB, 0x85A6)
+DOUBLE_BYTE_PAIR(0xC2CC, 0x87EF)
+DOUBLE_BYTE_PAIR(0xC2CD, 0x87EC)
+DOUBLE_BYTE_PAIR(0xC2CE, 0x87F2)
+DOUBLE_BYTE_PAIR(0xC2CF, 0x87E0)
+DOUBLE_BYTE_PAIR(0xC2D0, 0x8986)
+DOUBLE_BYTE_PAIR(0xC2D1, 0x89B2)
+DOUBLE_BYTE_PAIR(0xC2D2, 0x89F4)
+DOUBLE_BYTE_PAIR(0xC2D3, 0x8B28)
+DOUBLE_BYTE_PAIR(0xC2D4, 0x8B39)
+DOUBLE_BYTE_PAIR(0xC2D5, 0x8B2C)
+DOUBLE_BYTE_PAIR(0xC2D6, 0x8B2B)
+DOUBLE_BYTE_PAIR(0xC2D7, 0x8C50)
+DOUBLE_BYTE_PAIR(0xC2D8, 0x8D05)
+DOUBLE_BYTE_PAIR(0xC2D9, 0x8E59)
+DOUBLE_BYTE_PAIR(0xC2DA, 0x8E63)
+DOUBLE_BYTE_PAIR(0xC2DB, 0x8E66)
+DOUBLE_BYTE_PAIR(0xC2DC, 0x8E64)
+DOUBLE_BYTE_PAIR(0xC2DD, 0x8E5F)
+DOUBLE_BYTE_PAIR(0xC2DE, 0x8E55)
+DOUBLE_BYTE_PAIR(0xC2DF, 0x8EC0)
+DOUBLE_BYTE_PAIR(0xC2E0, 0x8F49)
+DOUBLE_BYTE_PAIR(0xC2E1, 0x8F4D)
+DOUBLE_BYTE_PAIR(0xC2E2, 0x9087)
+DOUBLE_BYTE_PAIR(0xC2E3, 0x9083)
+DOUBLE_BYTE_PAIR(0xC2E4, 0x9088)
+DOUBLE_BYTE_PAIR(0xC2E5, 0x91AB)
+DOUBLE_BYTE_PAIR(0xC2E6, 0x91AC)
+DOUBLE_BYTE_PAIR(0xC2E7, 0x91D0)
+DOUBLE_BYTE_PAIR(0xC2E8, 0x9394)
+DOUBLE_BYTE_PAIR(0xC2E9, 0x938A)
+DOUBLE_BYTE_PAIR(0xC2EA, 0x9396)
+DOUBLE_BYTE_PAIR(0xC2EB, 0x93A2)
+DOUBLE_BYTE_PAIR(0xC2EC, 0x93B3)
+DOUBLE_BYTE_PAIR(0xC2ED, 0x93AE)
+DOUBLE_BYTE_PAIR(0xC2EE, 0x93AC)
+DOUBLE_BYTE_PAIR(0xC2EF, 0x93B0)
+DOUBLE_BYTE_PAIR(0xC2F0, 0x9398)
+DOUBLE_BYTE_PAIR(0xC2F1, 0x939A)
+DOUBLE_BYTE_PAIR(0xC2F2, 0x9397)
+DOUBLE_BYTE_PAIR(0xC2F3, 0x95D4)
+DOUBLE_BYTE_PAIR(0xC2F4, 0x95D6)
+DOUBLE_BYTE_PAIR(0xC2F5, 0x95D0)
+DOUBLE_BYTE_PAIR(0xC2F6, 0x95D5)
+DOUBLE_BYTE_PAIR(0xC2F7, 0x96E2)
+DOUBLE_BYTE_PAIR(0xC2F8, 0x96DC)
+DOUBLE_BYTE_PAIR(0xC2F9, 0x96D9)
+DOUBLE_BYTE_PAIR(0xC2FA, 0x96DB)
+DOUBLE_BYTE_PAIR(0xC2FB, 0x96DE)
+DOUBLE_BYTE_PAIR(0xC2FC, 0x9724)
+DOUBLE_BYTE_PAIR(0xC2FD, 0x97A3)
+DOUBLE_BYTE_PAIR(0xC2FE, 0x97A6)
+DOUBLE_BYTE_PAIR(0xC340, 0x97AD)
+DOUBLE_BYTE_PAIR(0xC341, 0x97F9)
+DOUBLE_BYTE_PAIR(0xC342, 0x984D)
+DOUBLE_BYTE_PAIR(0xC343, 0x984F)
+DOUBLE_BYTE_PAIR(0xC344, 0x984C)
+DOUBLE_BYTE_PAIR(0xC345, 0x984E)
+DOUBLE_BYTE_PAIR(0xC346, 0x9853)
+DOUBLE_BYTE_PAIR(0xC347, 0x98BA)
+DOUBLE_BYTE_PAIR(0xC348, 0x993E)
+DOUBLE_BYTE_PAIR(0xC349, 0x993F)
+DOUBLE_BYTE_PAIR(0xC34A, 0x993D)
+DOUBLE_BYTE_PAIR(0xC34B, 0x992E)
+DOUBLE_BYTE_PAIR(0xC34C, 0x99A5)
+DOUBLE_BYTE_PAIR(0xC34D, 0x9A0E)
+DOUBLE_BYTE_PAIR(0xC34E, 0x9AC1)
+DOUBLE_BYTE_PAIR(0xC34F, 0x9B03)
+DOUBLE_BYTE_PAIR(0xC350, 0x9B06)
+DOUBLE_BYTE_PAIR(0xC351, 0x9B4F)
+DOUBLE_BYTE_PAIR(0xC352, 0x9B4E)
+DOUBLE_BYTE_PAIR(0xC353, 0x9B4D)
+DOUBLE_BYTE_PAIR(0xC354, 0x9BCA)
+DOUBLE_BYTE_PAIR(0xC355, 0x9BC9)
+DOUBLE_BYTE_PAIR(0xC356, 0x9BFD)
+DOUBLE_BYTE_PAIR(0xC357, 0x9BC8)
+DOUBLE_BYTE_PAIR(0xC358, 0x9BC0)
+DOUBLE_BYTE_PAIR(0xC359, 0x9D51)
+DOUBLE_BYTE_PAIR(0xC35A, 0x9D5D)
+DOUBLE_BYTE_PAIR(0xC35B, 0x9D60)
+DOUBLE_BYTE_PAIR(0xC35C, 0x9EE0)
+DOUBLE_BYTE_PAIR(0xC35D, 0x9F15)
+DOUBLE_BYTE_PAIR(0xC35E, 0x9F2C)
+DOUBLE_BYTE_PAIR(0xC35F, 0x5133)
+DOUBLE_BYTE_PAIR(0xC360, 0x56A5)
+DOUBLE_BYTE_PAIR(0xC361, 0x58DE)
+DOUBLE_BYTE_PAIR(0xC362, 0x58DF)
+DOUBLE_BYTE_PAIR(0xC363, 0x58E2)
+DOUBLE_BYTE_PAIR(0xC364, 0x5BF5)
+DOUBLE_BYTE_PAIR(0xC365, 0x9F90)
+DOUBLE_BYTE_PAIR(0xC366, 0x5EEC)
+DOUBLE_BYTE_PAIR(0xC367, 0x61F2)
+DOUBLE_BYTE_PAIR(0xC368, 0x61F7)
+DOUBLE_BYTE_PAIR(0xC369, 0x61F6)
+DOUBLE_BYTE_PAIR(0xC36A, 0x61F5)
+DOUBLE_BYTE_PAIR(0xC36B, 0x6500)
+DOUBLE_BYTE_PAIR(0xC36C, 0x650F)
+DOUBLE_BYTE_PAIR(0xC36D, 0x66E0)
+DOUBLE_BYTE_PAIR(0xC36E, 0x66DD)
+DOUBLE_BYTE_PAIR(0xC36F, 0x6AE5)
+DOUBLE_BYTE_PAIR(0xC370, 0x6ADD)
+DOUBLE_BYTE_PAIR(0xC371, 0x6ADA)
+DOUBLE_BYTE_PAIR(0xC372, 0x6AD3)
+DOUBLE_BYTE_PAIR(0xC373, 0x701B)
+DOUBLE_BYTE_PAIR(0xC374, 0x701F)
+DOUBLE_BYTE_PAIR(0xC375, 0x7028)
+DOUBLE_BYTE_PAIR(0xC376, 0x701A)
+DOUBLE_BYTE_PAIR(0xC377, 0x701D)
+DOUBLE_BYTE_PAIR(0xC378, 0x7015)
+DOUBLE_BYTE_PAIR(0xC379, 0x7018)
+DOUBLE_BYTE_PAIR(0xC37A, 0x7206)
+DOUBLE_BYTE_PAIR(0xC37B, 0x720D)
+DOUBLE_BYTE_PAIR(0xC37C, 0x7258)
+DOUBLE_BYTE_PAIR(0xC37D, 0x72A2)
+DOUBLE_BYTE_PAIR(0xC37E, 0x7378)
+DOUBLE_BYTE_PAIR(0xC3A1, 0x737A)
+DOUBLE_BYTE_PAIR(0xC3A2, 0x74BD)
+DOUBLE_BYTE_PAIR(0xC3A3, 0x74CA)
+DOUBLE_BYTE_PAIR(0xC3A4, 0x74E3)
+DOUBLE_BYTE_PAIR(0xC3A5, 0x7587)
+DOUBLE_BYTE_PAIR(0xC3A6, 0x7586)
+DOUBLE_BYTE_PAIR(0xC3A7, 0x765F)
+DOUBLE_BYTE_PAIR(0xC3A8, 0x7661)
+DOUBLE_BYTE_PAIR(0xC3A9, 0x77C7)
+DOUBLE_BYTE_PAIR(0xC3AA, 0x7919)
+DOUBLE_BYTE_PAIR(0xC3AB, 0x79B1)
+DOUBLE_BYTE_PAIR(0xC3AC, 0x7A6B)
+DOUBLE_BYTE_PAIR(0xC3AD, 0x7A69)
+DOUBLE_BYTE_PAIR(0xC3AE, 0x7C3E)
+DOUBLE_BYTE_PAIR(0xC3AF, 0x7C3F)
+DOUBLE_BYTE_PAIR(0xC3B0, 0x7C38)
+DOUBLE_BYTE_PAIR(0xC3B1, 0x7C3D)
+DOUBLE_BYTE_PAIR(0xC3B2, 0x7C37)
+DOUBLE_BYTE_PAIR(0xC3B3, 0x7C40)
+DOUBLE_BYTE_PAIR(0xC3B4, 0x7E6B)
+DOUBLE_BYTE_PAIR(0xC3B5, 0x7E6D)
+DOUBLE_BYTE_PAIR(0xC3B6, 0x7E79)
+DOUBLE_BYTE_PAIR(0xC3B7, 0x7E69)
+DOUBLE_BYTE_PAIR(0xC3B8, 0x7E6A)
+DOUBLE_BYTE_PAIR(0xC3B9, 0x7F85)
+DOUBLE_BYTE_PAIR(0xC3BA, 0x7E73)
+DOUBLE_BYTE_PAIR(0xC3BB, 0x7FB6)
+DOUBLE_BYTE_PAIR(0xC3BC, 0x7FB9)
+DOUBLE_BYTE_PAIR(0xC3BD, 0x7FB8)
+DOUBLE_BYTE_PAIR(0xC3BE, 0x81D8)
+DOUBLE_BYTE_PAIR(0xC3BF, 0x85E9)
+DOUBLE_BYTE_PAIR(0xC3C0, 0x85DD)
+DOUBLE_BYTE_PAIR(0xC3C1, 0x85EA)
+DOUBLE_BYTE_PAIR(0xC3C2, 0x85D5)
+DOUBLE_BYTE_PAIR(0xC3C3, 0x85E4)
+DOUBLE_BYTE_PAIR(0xC3C4, 0x85E5)
+DOUBLE_BYTE_PAIR(0xC3C5, 0x85F7)
+DOUBLE_BYTE_PAIR(0xC3C6, 0x87FB)
+DOUBLE_BYTE_PAIR(0xC3C7, 0x8805)
+DOUBLE_BYTE_PAIR(0xC3C8, 0x880D)
+DOUBLE_BYTE_PAIR(0xC3C9, 0x87F9)
+DOUBLE_BYTE_PAIR(0xC3CA, 0x87FE)
+DOUBLE_BYTE_PAIR(0xC3CB, 0x8960)
+DOUBLE_BYTE_PAIR(0xC3CC, 0x895F)
+DOUBLE_BYTE_PAIR(0xC3CD, 0x8956)
+DOUBLE_BYTE_PAIR(0xC3CE, 0x895E)
+DOUBLE_BYTE_PAIR(0xC3CF, 0x8B41)
+DOUBLE_BYTE_PAIR(0xC3D0, 0x8B5C)
+DOUBLE_BYTE_PAIR(0xC3D1, 0x8B58)
+DOUBLE_BYTE_PAIR(0xC3D2, 0x8B49)
+DOUBLE_BYTE_PAIR(0xC3D3, 0x8B5A)
+DOUBLE_BYTE_PAIR(0xC3D4, 0x8B4E)
+DOUBLE_BYTE_PAIR(0xC3D5, 0x8B4F)
+DOUBLE_BYTE_PAIR(0xC3D6, 0x8B46)
+DOUBLE_BYTE_PAIR(0xC3D7, 0x8B59)
+DOUBLE_BYTE_PAIR(0xC3D8, 0x8D08)
+DOUBLE_BYTE_PAIR(0xC3D9, 0x8D0A)
+DOUBLE_BYTE_PAIR(0xC3DA, 0x8E7C)
+DOUBLE_BYTE_PAIR(0xC3DB, 0x8E72)
+DOUBLE_BYTE_PAIR(0xC3DC, 0x8E87)
+DOUBLE_BYTE_PAIR(0xC3DD, 0x8E76)
+DOUBLE_BYTE_PAIR(0xC3DE, 0x8E6C)
+DOUBLE_BYTE_PAIR(0xC3DF, 0x8E7A)
+DOUBLE_BYTE_PAIR(0xC3E0, 0x8E74)
+DOUBLE_BYTE_PAIR(0xC3E1, 0x8F54)
+DOUBLE_BYTE_PAIR(0xC3E2, 0x8F4E)
+DOUBLE_BYTE_PAIR(0xC3E3, 0x8FAD)
+DOUBLE_BYTE_PAIR(0xC3E4, 0x908A)
+DOUBLE_BYTE_PAIR(0xC3E5, 0x908B)
+DOUBLE_BYTE_PAIR(0xC3E6, 0x91B1)
+DOUBLE_BYTE_PAIR(0xC3E7, 0x91AE)
+DOUBLE_BYTE_PAIR(0xC3E8, 0x93E1)
+DOUBLE_BYTE_PAIR(0xC3E9, 0x93D1)
+DOUBLE_BYTE_PAIR(0xC3EA, 0x93DF)
+DOUBLE_BYTE_PAIR(0xC3EB, 0x93C3)
+DOUBLE_BYTE_PAIR(0xC3EC, 0x93C8)
+DOUBLE_BYTE_PAIR(0xC3ED, 0x93DC)
+DOUBLE_BYTE_PAIR(0xC3EE, 0x93DD)
+DOUBLE_BYTE_PAIR(0xC3EF, 0x93D6)
+DOUBLE_BYTE_PAIR(0xC3F0, 0x93E2)
+DOUBLE_BYTE_PAIR(0xC3F1, 0x93CD)
+DOUBLE_BYTE_PAIR(0xC3F2, 0x93D8)
+DOUBLE_BYTE_PAIR(0xC3F3, 0x93E4)
+DOUBLE_BYTE_PAIR(0xC3F4, 0x93D7)
+DOUBLE_BYTE_PAIR(0xC3F5, 0x93E8)
+DOUBLE_BYTE_PAIR(0xC3F6, 0x95DC)
+DOUBLE_BYTE_PAIR(0xC3F7, 0x96B4)
+DOUBLE_BYTE_PAIR(0xC3F8, 0x96E3)
+DOUBLE_BYTE_PAIR(0xC3F9, 0x972A)
+DOUBLE_BYTE_PAIR(0xC3FA, 0x9727)
+DOUBLE_BYTE_PAIR(0xC3FB, 0x9761)
+DOUBLE_BYTE_PAIR(0xC3FC, 0x97DC)
+DOUBLE_BYTE_PAIR(0xC3FD, 0x97FB)
+DOUBLE_BYTE_PAIR(0xC3FE, 0x985E)
+DOUBLE_BYTE_PAIR(0xC440, 0x9858)
+DOUBLE_BYTE_PAIR(0xC441, 0x985B)
+DOUBLE_BYTE_PAIR(0xC442, 0x98BC)
+DOUBLE_BYTE_PAIR(0xC443, 0x9945)
+DOUBLE_BYTE_PAIR(0xC444, 0x9949)
+DOUBLE_BYTE_PAIR(0xC445, 0x9A16)
+DOUBLE_BYTE_PAIR(0xC446, 0x9A19)
+DOUBLE_BYTE_PAIR(0xC447, 0x9B0D)
+DOUBLE_BYTE_PAIR(0xC448, 0x9BE8)
+DOUBLE_BYTE_PAIR(0xC449, 0x9BE7)
+DOUBLE_BYTE_PAIR(0xC44A, 0x9BD6)
+DOUBLE_BYTE_PAIR(0xC44B, 0x9BDB)
+DOUBLE_BYTE_PAIR(0xC44C, 0x9D89)
+DOUBLE_BYTE_PAIR(0xC44D, 0x9D61)
+DOUBLE_BYTE_PAIR(0xC44E, 0x9D72)
+DOUBLE_BYTE_PAIR(0xC44F, 0x9D6A)
+DOUBLE_BYTE_PAIR(0xC450, 0x9D6C)
+DOUBLE_BYTE_PAIR(0xC451, 0x9E92)
+DOUBLE_BYTE_PAIR(0xC452, 0x9E97)
+DOUBLE_BYTE_PAIR(0xC453, 0x9E93)
+DOUBLE_BYTE_PAIR(0xC454, 0x9EB4)
+DOUBLE_BYTE_PAIR(0xC455, 0x52F8)
+DOUBLE_BYTE_PAIR(0xC456, 0x56A8)
+DOUBLE_BYTE_PAIR(0xC457, 0x56B7)
+DOUBLE_BYTE_PAIR(0xC458, 0x56B6)
+DOUBLE_BYTE_PAIR(0xC459, 0x56B4)
+DOUBLE_BYTE_PAIR(0xC45A, 0x56BC)
+DOUBLE_BYTE_PAIR(0xC45B, 0x58E4)
+DOUBLE_BYTE_PAIR(0xC45C, 0x5B40)
+DOUBLE_BYTE_PAIR(0xC45D, 0x5B43)
+DOUBLE_BYTE_PAIR(0xC45E, 0x5B7D)
+DOUBLE_BYTE_PAIR(0xC45F, 0x5BF6)
+DOUBLE_BYTE_PAIR(0xC460, 0x5DC9)
+DOUBLE_BYTE_PAIR(0xC461, 0x61F8)
+DOUBLE_BYTE_PAIR(0xC462, 0x61FA)
+DOUBLE_BYTE_PAIR(0xC463, 0x6518)
+DOUBLE_BYTE_PAIR(0xC464, 0x6514)
+DOUBLE_BYTE_PAIR(0xC465, 0x6519)
+DOUBLE_BYTE_PAIR(0xC466, 0x66E6)
+DOUBLE_BYTE_PAIR(0xC467, 0x6727)
+DOUBLE_BYTE_PAIR(0xC468, 0x6AEC)
+DOUBLE_BYTE_PAIR(0xC469, 0x703E)
+DOUBLE_BYTE_PAIR(0xC46A, 0x7030)
+DOUBLE_BYTE_PAIR(0xC46B, 0x7032)
+DOUBLE_BYTE_PAIR(0xC46C, 0x7210)
+DOUBLE_BYTE_PAIR(0xC46D, 0x737B)
+DOUBLE_BYTE_PAIR(0xC46E, 0x74CF)
+DOUBLE_BYTE_PAIR(0xC46F, 0x7662)
+DOUBLE_BYTE_PAIR(0xC470, 0x7665)
+DOUBLE_BYTE_PAIR(0xC471, 0x7926)
+DOUBLE_BYTE_PAIR(0xC472, 0x792A)
+DOUBLE_BYTE_PAIR(0xC473, 0x792C)
+DOUBLE_BYTE_PAIR(0xC474, 0x792B)
+DOUBLE_BYTE_PAIR(0xC475, 0x7AC7)
+DOUBLE_BYTE_PAIR(0xC476, 0x7AF6)
+DOUBLE_BYTE_PAIR(0xC477, 0x7C4C)
+DOUBLE_BYTE_PAIR(0xC478, 0x7C43)
+DOUBLE_BYTE_PAIR(0xC479, 0x7C4D)
+DOUBLE_BYTE_PAIR(0xC47A, 0x7CEF)
+DOUBLE_BYTE_PAIR(0xC47B, 0x7CF0)
+DOUBLE_BYTE_PAIR(0xC47C, 0x8FAE)
+DOUBLE_BYTE_PAIR(0xC47D, 0x7E7D)
+DOUBLE_BYTE_PAIR(0xC47E, 0x7E7C)
+DOUBLE_BYTE_PAIR(0xC4A1, 0x7E82)
+DOUBLE_BYTE_PAIR(0xC4A2, 0x7F4C)
+DOUBLE_BYTE_PAIR(0xC4A3, 0x8000)
+DOUBLE_BYTE_PAIR(0xC4A4, 0x81DA)
+DOUBLE_BYTE_PAIR(0xC4A5, 0x8266)
+DOUBLE_BYTE_PAIR(0xC4A6, 0x85FB)
+DOUBLE_BYTE_PAIR(0xC4A7, 0x85F9)
+DOUBLE_BYTE_PAIR(0xC4A8, 0x8611)
+DOUBLE_BYTE_PAIR(0xC4A9, 0x85FA)
+DOUBLE_BYTE_PAIR(0xC4AA, 0x8606)
+DOUBLE_BYTE_PAIR(0xC4AB, 0x860B)
+DOUBLE_BYTE_PAIR(0xC4AC, 0x8607)
+DOUBLE_BYTE_PAIR(0xC4AD, 0x860A)
+DOUBLE_BYTE_PAIR(0xC4AE, 0x8814)
+DOUBLE_BYTE_PAIR(0xC4AF, 0x8815)
+DOUBLE_BYTE_PAIR(0xC4B0, 0x8964)
+DOUBLE_BYTE_PAIR(0xC4B1, 0x89BA)
+DOUBLE_BYTE_PAIR(0xC4B2, 0x89F8)
+DOUBLE_BYTE_PAIR(0xC4B3, 0x8B70)
+DOUBLE_BYTE_PAIR(0xC4B4, 0x8B6C)
+DOUBLE_BYTE_PAIR(0xC4B5, 0x8B66)
+DOUBLE_BYTE_PAIR(0xC4B6, 0x8B6F)
+DOUBLE_BYTE_PAIR(0xC4B7, 0x8B5F)
+DOUBLE_BYTE_PAIR(0xC4B8, 0x8B6B)
+DOUBLE_BYTE_PAIR(0xC4B9, 0x8D0F)
+DOUBLE_BYTE_PAIR(0xC4BA, 0x8D0D)
+DOUBLE_BYTE_PAIR(0xC4BB, 0x8E89)
+DOUBLE_BYTE_PAIR(0xC4BC, 0x8E81)
+DOUBLE_BYTE_PAIR(0xC4BD, 0x8E85)
+DOUBLE_BYTE_PAIR(0xC4BE, 0x8E82)
+DOUBLE_BYTE_PAIR(0xC4BF, 0x91B4)
+DOUBLE_BYTE_PAIR(0xC4C0, 0x91CB)
+DOUBLE_BYTE_PAIR(0xC4C1, 0x9418)
+DOUBLE_BYTE_PAIR(0xC4C2, 0x9403)
+DOUBLE_BYTE_PAIR(0xC4C3, 0x93FD)
+DOUBLE_BYTE_PAIR(0xC4C4, 0x95E1)
+DOUBLE_BYTE_PAIR(0xC4C5, 0x9730)
+DOUBLE_BYTE_PAIR(0xC4C6, 0x98C4)
+DOUBLE_BYTE_PAIR(0xC4C7, 0x9952)
+DOUBLE_BYTE_PAIR(0xC4C8, 0x9951)
+DOUBLE_BYTE_PAIR(0xC4C9, 0x99A8)
+DOUBLE_BYTE_PAIR(0xC4CA, 0x9A2B)
+DOUBLE_BYTE_PAIR(0xC4CB, 0x9A30)
+DOUBLE_BYTE_PAIR(0xC4CC, 0x9A37)
+DOUBLE_BYTE_PAIR(0xC4CD, 0x9A35)
+DOUBLE_BYTE_PAIR(0xC4CE, 0x9C13)
+DOUBLE_BYTE_PAIR(0xC4CF, 0x9C0D)
+DOUBLE_BYTE_PAIR(0xC4D0, 0x9E79)
+DOUBLE_BYTE_PAIR(0xC4D1, 0x9EB5)
+DOUBLE_BYTE_PAIR(0xC4D2, 0x9EE8)
+DOUBLE_BYTE_PAIR(0xC4D3, 0x9F2F)
+DOUBLE_BYTE_PAIR(0xC4D4, 0x9F5F)
+DOUBLE_BYTE_PAIR(0xC4D5, 0x9F63)
+DOUBLE_BYTE_PAIR(0xC4D6, 0x9F61)
+DOUBLE_BYTE_PAIR(0xC4D7, 0x5137)
+DOUBLE_BYTE_PAIR(0xC4D8, 0x5138)
+DOUBLE_BYTE_PAIR(0xC4D9, 0x56C1)
+DOUBLE_BYTE_PAIR(0xC4DA, 0x56C0)
+DOUBLE_BYTE_PAIR(0xC4DB, 0x56C2)
+DOUBLE_BYTE_PAIR(0xC4DC, 0x5914)
+DOUBLE_BYTE_PAIR(0xC4DD, 0x5C6C)
+DOUBLE_BYTE_PAIR(0xC4DE, 0x5DCD)
+DOUBLE_BYTE_PAIR(0xC4DF, 0x61FC)
+DOUBLE_BYTE_PAIR(0xC4E0, 0x61FE)
+DOUBLE_BYTE_PAIR(0xC4E1, 0x651D)
+DOUBLE_BYTE_PAIR(0xC4E2, 0x651C)
+DOUBLE_BYTE_PAIR(0xC4E3, 0x6595)
+DOUBLE_BYTE_PAIR(0xC4E4, 0x66E9)
+DOUBLE_BYTE_PAIR(0xC4E5, 0x6AFB)
+DOUBLE_BYTE_PAIR(0xC4E6, 0x6B04)
+DOUBLE_BYTE_PAIR(0xC4E7, 0x6AFA)
+DOUBLE_BYTE_PAIR(0xC4E8, 0x6BB2)
+DOUBLE_BYTE_PAIR(0xC4E9, 0x704C)
+DOUBLE_BYTE_PAIR(0xC4EA, 0x721B)
+DOUBLE_BYTE_PAIR(0xC4EB, 0x72A7)
+DOUBLE_BYTE_PAIR(0xC4EC, 0x74D6)
+DOUBLE_BYTE_PAIR(0xC4ED, 0x74D4)
+DOUBLE_BYTE_PAIR(0xC4EE, 0x7669)
+DOUBLE_BYTE_PAIR(0xC4EF, 0x77D3)
+DOUBLE_BYTE_PAIR(0xC4F0, 0x7C50)
+DOUBLE_BYTE_PAIR(0xC4F1, 0x7E8F)
+DOUBLE_BYTE_PAIR(0xC4F2, 0x7E8C)
+DOUBLE_BYTE_PAIR(0xC4F3, 0x7FBC)
+DOUBLE_BYTE_PAIR(0xC4F4, 0x8617)
+DOUBLE_BYTE_PAIR(0xC4F5, 0x862D)
+DOUBLE_BYTE_PAIR(0xC4F6, 0x861A)
+DOUBLE_BYTE_PAIR(0xC4F7, 0x8823)
+DOUBLE_BYTE_PAIR(0xC4F8, 0x8822)
+DOUBLE_BYTE_PAIR(0xC4F9, 0x8821)
+DOUBLE_BYTE_PAIR(0xC4FA, 0x881F)
+DOUBLE_BYTE_PAIR(0xC4FB, 0x896A)
+DOUBLE_BYTE_PAIR(0xC4FC, 0x896C)
+DOUBLE_BYTE_PAIR(0xC4FD, 0x89BD)
+DOUBLE_BYTE_PAIR(0xC4FE, 0x8B74)
+DOUBLE_BYTE_PAIR(0xC540, 0x8B77)
+DOUBLE_BYTE_PAIR(0xC541, 0x8B7D)
+DOUBLE_BYTE_PAIR(0xC542, 0x8D13)
+DOUBLE_BYTE_PAIR(0xC543, 0x8E8A)
+DOUBLE_BYTE_PAIR(0xC544, 0x8E8D)
+DOUBLE_BYTE_PAIR(0xC545, 0x8E8B)
+DOUBLE_BYTE_PAIR(0xC546, 0x8F5F)
+DOUBLE_BYTE_PAIR(0xC547, 0x8FAF)
+DOUBLE_BYTE_PAIR(0xC548, 0x91BA)
+DOUBLE_BYTE_PAIR(0xC549, 0x942E)
+DOUBLE_BYTE_PAIR(0xC54A, 0x9433)
+DOUBLE_BYTE_PAIR(0xC54B, 0x9435)
+DOUBLE_BYTE_PAIR(0xC54C, 0x943A)
+DOUBLE_BYTE_PAIR(0xC54D, 0x9438)
+DOUBLE_BYTE_PAIR(0xC54E, 0x9432)
+DOUBLE_BYTE_PAIR(0xC54F, 0x942B)
+DOUBLE_BYTE_PAIR(0xC550, 0x95E2)
+DOUBLE_BYTE_PAIR(0xC551, 0x9738)
+DOUBLE_BYTE_PAIR(0xC552, 0x9739)
+DOUBLE_BYTE_PAIR(0xC553, 0x9732)
+DOUBLE_BYTE_PAIR(0xC554, 0x97FF)
+DOUBLE_BYTE_PAIR(0xC555, 0x9867)
+DOUBLE_BYTE_PAIR(0xC556, 0x9865)
+DOUBLE_BYTE_PAIR(0xC557, 0x9957)
+DOUBLE_BYTE_PAIR(0xC558, 0x9A45)
+DOUBLE_BYTE_PAIR(0xC559, 0x9A43)
+DOUBLE_BYTE_PAIR(0xC55A, 0x9A40)
+DOUBLE_BYTE_PAIR(0xC55B, 0x9A3E)
+DOUBLE_BYTE_PAIR(0xC55C, 0x9ACF)
+DOUBLE_BYTE_PAIR(0xC55D, 0x9B54)
+DOUBLE_BYTE_PAIR(0xC55E, 0x9B51)
+DOUBLE_BYTE_PAIR(0xC55F, 0x9C2D)
+DOUBLE_BYTE_PAIR(0xC560, 0x9C25)
+DOUBLE_BYTE_PAIR(0xC561, 0x9DAF)
+DOUBLE_BYTE_PAIR(0xC562, 0x9DB4)
+DOUBLE_BYTE_PAIR(0xC563, 0x9DC2)
+DOUBLE_BYTE_PAIR(0xC564, 0x9DB8)
+DOUBLE_BYTE_PAIR(0xC565, 0x9E9D)
+DOUBLE_BYTE_PAIR(0xC566, 0x9EEF)
+DOUBLE_BYTE_PAIR(0xC567, 0x9F19)
+DOUBLE_BYTE_PAIR(0xC568, 0x9F5C)
+DOUBLE_BYTE_PAIR(0xC569, 0x9F66)
+DOUBLE_BYTE_PAIR(0xC56A, 0x9F67)
+DOUBLE_BYTE_PAIR(0xC56B, 0x513C)
+DOUBLE_BYTE_PAIR(0xC56C, 0x513B)
+DOUBLE_BYTE_PAIR(0xC56D, 0x56C8)
+DOUBLE_BYTE_PAIR(0xC56E, 0x56CA)
+DOUBLE_BYTE_PAIR(0xC56F, 0x56C9)
+DOUBLE_BYTE_PAIR(0xC570, 0x5B7F)
+DOUBLE_BYTE_PAIR(0xC571, 0x5DD4)
+DOUBLE_BYTE_PAIR(0xC572, 0x5DD2)
+DOUBLE_BYTE_PAIR(0xC573, 0x5F4E)
+DOUBLE_BYTE_PAIR(0xC574, 0x61FF)
+DOUBLE_BYTE_PAIR(0xC575, 0x6524)
+DOUBLE_BYTE_PAIR(0xC576, 0x6B0A)
+DOUBLE_BYTE_PAIR(0xC577, 0x6B61)
+DOUBLE_BYTE_PAIR(0xC578, 0x7051)
+DOUBLE_BYTE_PAIR(0xC579, 0x7058)
+DOUBLE_BYTE_PAIR(0xC57A, 0x7380)
+DOUBLE_BYTE_PAIR(0xC57B, 0x74E4)
+DOUBLE_BYTE_PAIR(0xC57C, 0x758A)
+DOUBLE_BYTE_PAIR(0xC57D, 0x766E)
+DOUBLE_BYTE_PAIR(0xC57E, 0x766C)
+DOUBLE_BYTE_PAIR(0xC5A1, 0x79B3)
+DOUBLE_BYTE_PAIR(0xC5A2, 0x7C60)
+DOUBLE_BYTE_PAIR(0xC5A3, 0x7C5F)
+DOUBLE_BYTE_PAIR(0xC5A4, 0x807E)
+DOUBLE_BYTE_PAIR(0xC5A5, 0x807D)
+DOUBLE_BYTE_PAIR(0xC5A6, 0x81DF)
+DOUBLE_BYTE_PAIR(0xC5A7, 0x8972)
+DOUBLE_BYTE_PAIR(0xC5A8, 0x896F)
+DOUBLE_BYTE_PAIR(0xC5A9, 0x89FC)
+DOUBLE_BYTE_PAIR(0xC5AA, 0x8B80)
+DOUBLE_BYTE_PAIR(0xC5AB, 0x8D16)
+DOUBLE_BYTE_PAIR(0xC5AC, 0x8D17)
+DOUBLE_BYTE_PAIR(0xC5AD, 0x8E91)
+DOUBLE_BYTE_PAIR(0xC5AE, 0x8E93)
+DOUBLE_BYTE_PAIR(0xC5AF, 0x8F61)
+DOUBLE_BYTE_PAIR(0xC5B0, 0x9148)
+DOUBLE_BYTE_PAIR(0xC5B1, 0x9444)
+DOUBLE_BYTE_PAIR(0xC5B2, 0x9451)
+DOUBLE_BYTE_PAIR(0xC5B3, 0x9452)
+DOUBLE_BYTE_PAIR(0xC5B4, 0x973D)
+DOUBLE_BYTE_PAIR(0xC5B5, 0x973E)
+DOUBLE_BYTE_PAIR(0xC5B6, 0x97C3)
+DOUBLE_BYTE_PAIR(0xC5B7, 0x97C1)
+DOUBLE_BYTE_PAIR(0xC5B8, 0x986B)
+DOUBLE_BYTE_PAIR(0xC5B9, 0x9955)
+DOUBLE_BYTE_PAIR(0xC5BA, 0x9A55)
+DOUBLE_BYTE_PAIR(0xC5BB, 0x9A4D)
+DOUBLE_BYTE_PAIR(0xC5BC, 0x9AD2)
+DOUBLE_BYTE_PAIR(0xC5BD, 0x9B1A)
+DOUBLE_BYTE_PAIR(0xC5BE, 0x9C49)
+DOUBLE_BYTE_PAIR(0xC5BF, 0x9C31)
+DOUBLE_BYTE_PAIR(0xC5C0, 0x9C3E)
+DOUBLE_BYTE_PAIR(0xC5C1, 0x9C3B)
+DOUBLE_BYTE_PAIR(0xC5C2, 0x9DD3)
+DOUBLE_BYTE_PAIR(0xC5C3, 0x9DD7)
+DOUBLE_BYTE_PAIR(0xC5C4, 0x9F34)
+DOUBLE_BYTE_PAIR(0xC5C5, 0x9F6C)
+DOUBLE_BYTE_PAIR(0xC5C6, 0x9F6A)
+DOUBLE_BYTE_PAIR(0xC5C7, 0x9F94)
+DOUBLE_BYTE_PAIR(0xC5C8, 0x56CC)
+DOUBLE_BYTE_PAIR(0xC5C9, 0x5DD6)
+DOUBLE_BYTE_PAIR(0xC5CA, 0x6200)
+DOUBLE_BYTE_PAIR(0xC5CB, 0x6523)
+DOUBLE_BYTE_PAIR(0xC5CC, 0x652B)
+DOUBLE_BYTE_PAIR(0xC5CD, 0x652A)
+DOUBLE_BYTE_PAIR(0xC5CE, 0x66EC)
+DOUBLE_BYTE_PAIR(0xC5CF, 0x6B10)
+DOUBLE_BYTE_PAIR(0xC5D0, 0x74DA)
+DOUBLE_BYTE_PAIR(0xC5D1, 0x7ACA)
+DOUBLE_BYTE_PAIR(0xC5D2, 0x7C64)
+DOUBLE_BYTE_PAIR(0xC5D3, 0x7C63)
+DOUBLE_BYTE_PAIR(0xC5D4, 0x7C65)
+DOUBLE_BYTE_PAIR(0xC5D5, 0x7E93)
+DOUBLE_BYTE_PAIR(0xC5D6, 0x7E96)
+DOUBLE_BYTE_PAIR(0xC5D7, 0x7E94)
+DOUBLE_BYTE_PAIR(0xC5D8, 0x81E2)
+DOUBLE_BYTE_PAIR(0xC5D9, 0x8638)
+DOUBLE_BYTE_PAIR(0xC5DA, 0x863F)
+DOUBLE_BYTE_PAIR(0xC5DB, 0x8831)
+DOUBLE_BYTE_PAIR(0xC5DC, 0x8B8A)
+DOUBLE_BYTE_PAIR(0xC5DD, 0x9090)
+DOUBLE_BYTE_PAIR(0xC5DE, 0x908F)
+DOUBLE_BYTE_PAIR(0xC5DF, 0x9463)
+DOUBLE_BYTE_PAIR(0xC5E0, 0x9460)
+DOUBLE_BYTE_PAIR(0xC5E1, 0x9464)
+DOUBLE_BYTE_PAIR(0xC5E2, 0x9768)
+DOUBLE_BYTE_PAIR(0xC5E3, 0x986F)
+DOUBLE_BYTE_PAIR(0xC5E4, 0x995C)
+DOUBLE_BYTE_PAIR(0xC5E5, 0x9A5A)
+DOUBLE_BYTE_PAIR(0xC5E6, 0x9A5B)
+DOUBLE_BYTE_PAIR(0xC5E7, 0x9A57)
+DOUBLE_BYTE_PAIR(0xC5E8, 0x9AD3)
+DOUBLE_BYTE_PAIR(0xC5E9, 0x9AD4)
+DOUBLE_BYTE_PAIR(0xC5EA, 0x9AD1)
+DOUBLE_BYTE_PAIR(0xC5EB, 0x9C54)
+DOUBLE_BYTE_PAIR(0xC5EC, 0x9C57)
+DOUBLE_BYTE_PAIR(0xC5ED, 0x9C56)
+DOUBLE_BYTE_PAIR(0xC5EE, 0x9DE5)
+DOUBLE_BYTE_PAIR(0xC5EF, 0x9E9F)
+DOUBLE_BYTE_PAIR(0xC5F0, 0x9EF4)
+DOUBLE_BYTE_PAIR(0xC5F1, 0x56D1)
+DOUBLE_BYTE_PAIR(0xC5F2, 0x58E9)
+DOUBLE_BYTE_PAIR(0xC5F3, 0x652C)
+DOUBLE_BYTE_PAIR(0xC5F4, 0x705E)
+DOUBLE_BYTE_PAIR(0xC5F5, 0x7671)
+DOUBLE_BYTE_PAIR(0xC5F6, 0x7672)
+DOUBLE_BYTE_PAIR(0xC5F7, 0x77D7)
+DOUBLE_BYTE_PAIR(0xC5F8, 0x7F50)
+DOUBLE_BYTE_PAIR(0xC5F9, 0x7F88)
+DOUBLE_BYTE_PAIR(0xC5FA, 0x8836)
+DOUBLE_BYTE_PAIR(0xC5FB, 0x8839)
+DOUBLE_BYTE_PAIR(0xC5FC, 0x8862)
+DOUBLE_BYTE_PAIR(0xC5FD, 0x8B93)
+DOUBLE_BYTE_PAIR(0xC5FE, 0x8B92)
+DOUBLE_BYTE_PAIR(0xC640, 0x8B96)
+DOUBLE_BYTE_PAIR(0xC641, 0x8277)
+DOUBLE_BYTE_PAIR(0xC642, 0x8D1B)
+DOUBLE_BYTE_PAIR(0xC643, 0x91C0)
+DOUBLE_BYTE_PAIR(0xC644, 0x946A)
+DOUBLE_BYTE_PAIR(0xC645, 0x9742)
+DOUBLE_BYTE_PAIR(0xC646, 0x9748)
+DOUBLE_BYTE_PAIR(0xC647, 0x9744)
+DOUBLE_BYTE_PAIR(0xC648, 0x97C6)
+DOUBLE_BYTE_PAIR(0xC649, 0x9870)
+DOUBLE_BYTE_PAIR(0xC64A, 0x9A5F)
+DOUBLE_BYTE_PAIR(0xC64B, 0x9B22)
+DOUBLE_BYTE_PAIR(0xC64C, 0x9B58)
+DOUBLE_BYTE_PAIR(0xC64D, 0x9C5F)
+DOUBLE_BYTE_PAIR(0xC64E, 0x9DF9)
+DOUBLE_BYTE_PAIR(0xC64F, 0x9DFA)
+DOUBLE_BYTE_PAIR(0xC650, 0x9E7C)
+DOUBLE_BYTE_PAIR(0xC651, 0x9E7D)
+DOUBLE_BYTE_PAIR(0xC652, 0x9F07)
+DOUBLE_BYTE_PAIR(0xC653, 0x9F77)
+DOUBLE_BYTE_PAIR(0xC654, 0x9F72)
+DOUBLE_BYTE_PAIR(0xC655, 0x5EF3)
+DOUBLE_BYTE_PAIR(0xC656, 0x6B16)
+DOUBLE_BYTE_PAIR(0xC657, 0x7063)
+DOUBLE_BYTE_PAIR(0xC658, 0x7C6C)
+DOUBLE_BYTE_PAIR(0xC659, 0x7C6E)
+DOUBLE_BYTE_PAIR(0xC65A, 0x883B)
+DOUBLE_BYTE_PAIR(0xC65B, 0x89C0)
+DOUBLE_BYTE_PAIR(0xC65C, 0x8EA1)
+DOUBLE_BYTE_PAIR(0xC65D, 0x91C1)
+DOUBLE_BYTE_PAIR(0xC65E, 0x9472)
+DOUBLE_BYTE_PAIR(0xC65F, 0x9470)
+DOUBLE_BYTE_PAIR(0xC660, 0x9871)
+DOUBLE_BYTE_PAIR(0xC661, 0x995E)
+DOUBLE_BYTE_PAIR(0xC662, 0x9AD6)
+DOUBLE_BYTE_PAIR(0xC663, 0x9B23)
+DOUBLE_BYTE_PAIR(0xC664, 0x9ECC)
+DOUBLE_BYTE_PAIR(0xC665, 0x7064)
+DOUBLE_BYTE_PAIR(0xC666, 0x77DA)
+DOUBLE_BYTE_PAIR(0xC667, 0x8B9A)
+DOUBLE_BYTE_PAIR(0xC668, 0x9477)
+DOUBLE_BYTE_PAIR(0xC669, 0x97C9)
+DOUBLE_BYTE_PAIR(0xC66A, 0x9A62)
+DOUBLE_BYTE_PAIR(0xC66B, 0x9A65)
+DOUBLE_BYTE_PAIR(0xC66C, 0x7E9C)
+DOUBLE_BYTE_PAIR(0xC66D, 0x8B9C)
+DOUBLE_BYTE_PAIR(0xC66E, 0x8EAA)
+DOUBLE_BYTE_PAIR(0xC66F, 0x91C5)
+DOUBLE_BYTE_PAIR(0xC670, 0x947D)
+DOUBLE_BYTE_PAIR(0xC671, 0x947E)
+DOUBLE_BYTE_PAIR(0xC672, 0x947C)
+DOUBLE_BYTE_PAIR(0xC673, 0x9C77)
+DOUBLE_BYTE_PAIR(0xC674, 0x9C78)
+DOUBLE_BYTE_PAIR(0xC675, 0x9EF7)
+DOUBLE_BYTE_PAIR(0xC676, 0x8C54)
+DOUBLE_BYTE_PAIR(0xC677, 0x947F)
+DOUBLE_BYTE_PAIR(0xC678, 0x9E1A)
+DOUBLE_BYTE_PAIR(0xC679, 0x7228)
+DOUBLE_BYTE_PAIR(0xC67A, 0x9A6A)
+DOUBLE_BYTE_PAIR(0xC67B, 0x9B31)
+DOUBLE_BYTE_PAIR(0xC67C, 0x9E1B)
+DOUBLE_BYTE_PAIR(0xC67D, 0x9E1E)
+DOUBLE_BYTE_PAIR(0xC67E, 0x7C72)
+DOUBLE_BYTE_PAIR(0xC6A1, 0x30FE)
+DOUBLE_BYTE_PAIR(0xC6A2, 0x309D)
+DOUBLE_BYTE_PAIR(0xC6A3, 0x309E)
+DOUBLE_BYTE_PAIR(0xC6A4, 0x3005)
+DOUBLE_BYTE_PAIR(0xC6A5, 0x3041)
+DOUBLE_BYTE_PAIR(0xC6A6, 0x3042)
+DOUBLE_BYTE_PAIR(0xC6A7, 0x3043)
+DOUBLE_BYTE_PAIR(0xC6A8, 0x3044)
+DOUBLE_BYTE_PAIR(0xC6A9, 0x3045)
+DOUBLE_BYTE_PAIR(0xC6AA, 0x3046)
+DOUBLE_BYTE_PAIR(0xC6AB, 0x3047)
+DOUBLE_BYTE_PAIR(0xC6AC, 0x3048)
+DOUBLE_BYTE_PAIR(0xC6AD, 0x3049)
+DOUBLE_BYTE_PAIR(0xC6AE, 0x304A)
+DOUBLE_BYTE_PAIR(0xC6AF, 0x304B)
+DOUBLE_BYTE_PAIR(0xC6B0, 0x304C)
+DOUBLE_BYTE_PAIR(0xC6B1, 0x304D)
+DOUBLE_BYTE_PAIR(0xC6B2, 0x304E)
+DOUBLE_BYTE_PAIR(0xC6B3, 0x304F)
+DOUBLE_BYTE_PAIR(0xC6B4, 0x3050)
+DOUBLE_BYTE_PAIR(0xC6B5, 0x3051)
+DOUBLE_BYTE_PAIR(0xC6B6, 0x3052)
+DOUBLE_BYTE_PAIR(0xC6B7, 0x3053)
+DOUBLE_BYTE_PAIR(0xC6B8, 0x3054)
+DOUBLE_BYTE_PAIR(0xC6B9, 0x3055)
+DOUBLE_BYTE_PAIR(0xC6BA, 0x3056)
+DOUBLE_BYTE_PAIR(0xC6BB, 0x3057)
+DOUBLE_BYTE_PAIR(0xC6BC, 0x3058)
+DOUBLE_BYTE_PAIR(0xC6BD, 0x3059)
+DOUBLE_BYTE_PAIR(0xC6BE, 0x305A)
+DOUBLE_BYTE_PAIR(0xC6BF, 0x305B)
+DOUBLE_BYTE_PAIR(0xC6C0, 0x305C)
+DOUBLE_BYTE_PAIR(0xC6C1, 0x305D)
+DOUBLE_BYTE_PAIR(0xC6C2, 0x305E)
+DOUBLE_BYTE_PAIR(0xC6C3, 0x305F)
+DOUBLE_BYTE_PAIR(0xC6C4, 0x3060)
+DOUBLE_BYTE_PAIR(0xC6C5, 0x3061)
+DOUBLE_BYTE_PAIR(0xC6C6, 0x3062)
+DOUBLE_BYTE_PAIR(0xC6C7, 0x3063)
+DOUBLE_BYTE_PAIR(0xC6C8, 0x3064)
+DOUBLE_BYTE_PAIR(0xC6C9, 0x3065)
+DOUBLE_BYTE_PAIR(0xC6CA, 0x3066)
+DOUBLE_BYTE_PAIR(0xC6CB, 0x3067)
+DOUBLE_BYTE_PAIR(0xC6CC, 0x3068)
+DOUBLE_BYTE_PAIR(0xC6CD, 0x3069)
+DOUBLE_BYTE_PAIR(0xC6CE, 0x306A)
+DOUBLE_BYTE_PAIR(0xC6CF, 0x306B)
+DOUBLE_BYTE_PAIR(0xC6D0, 0x306C)
+DOUBLE_BYTE_PAIR(0xC6D1, 0x306D)
+DOUBLE_BYTE_PAIR(0xC6D2, 0x306E)
+DOUBLE_BYTE_PAIR(0xC6D3, 0x306F)
+DOUBLE_BYTE_PAIR(0xC6D4, 0x3070)
+DOUBLE_BYTE_PAIR(0xC6D5, 0x3071)
+DOUBLE_BYTE_PAIR(0xC6D6, 0x3072)
+DOUBLE_BYTE_PAIR(0xC6D7, 0x3073)
+DOUBLE_BYTE_PAIR(0xC6D8, 0x3074)
+DOUBLE_BYTE_PAIR(0xC6D9, 0x3075)
+DOUBLE_BYTE_PAIR(0xC6DA, 0x3076)
+DOUBLE_BYTE_PAIR(0xC6DB, 0x3077)
+DOUBLE_BYTE_PAIR(0xC6DC, 0x3078)
+DOUBLE_BYTE_PAIR(0xC6DD, 0x3079)
+DOUBLE_BYTE_PAIR(0xC6DE, 0x307A)
+DOUBLE_BYTE_PAIR(0xC6DF, 0x307B)
+DOUBLE_BYTE_PAIR(0xC6E0, 0x307C)
+DOUBLE_BYTE_PAIR(0xC6E1, 0x307D)
+DOUBLE_BYTE_PAIR(0xC6E2, 0x307E)
+DOUBLE_BYTE_PAIR(0xC6E3, 0x307F)
+DOUBLE_BYTE_PAIR(0xC6E4, 0x3080)
+DOUBLE_BYTE_PAIR(0xC6E5, 0x3081)
+DOUBLE_BYTE_PAIR(0xC6E6, 0x3082)
+DOUBLE_BYTE_PAIR(0xC6E7, 0x3083)
+DOUBLE_BYTE_PAIR(0xC6E8, 0x3084)
+DOUBLE_BYTE_PAIR(0xC6E9, 0x3085)
+DOUBLE_BYTE_PAIR(0xC6EA, 0x3086)
+DOUBLE_BYTE_PAIR(0xC6EB, 0x3087)
+DOUBLE_BYTE_PAIR(0xC6EC, 0x3088)
+DOUBLE_BYTE_PAIR(0xC6ED, 0x3089)
+DOUBLE_BYTE_PAIR(0xC6EE, 0x308A)
+DOUBLE_BYTE_PAIR(0xC6EF, 0x308B)
+DOUBLE_BYTE_PAIR(0xC6F0, 0x308C)
+DOUBLE_BYTE_PAIR(0xC6F1, 0x308D)
+DOUBLE_BYTE_PAIR(0xC6F2, 0x308E)
+DOUBLE_BYTE_PAIR(0xC6F3, 0x308F)
+DOUBLE_BYTE_PAIR(0xC6F4, 0x3090)
+DOUBLE_BYTE_PAIR(0xC6F5, 0x3091)
+DOUBLE_BYTE_PAIR(0xC6F6, 0x3092)
+DOUBLE_BYTE_PAIR(0xC6F7, 0x3093)
+DOUBLE_BYTE_PAIR(0xC6F8, 0x30A1)
+DOUBLE_BYTE_PAIR(0xC6F9, 0x30A2)
+DOUBLE_BYTE_PAIR(0xC6FA, 0x30A3)
+DOUBLE_BYTE_PAIR(0xC6FB, 0x30A4)
+DOUBLE_BYTE_PAIR(0xC6FC, 0x30A5)
+DOUBLE_BYTE_PAIR(0xC6FD, 0x30A6)
+DOUBLE_BYTE_PAIR(0xC6FE, 0x30A7)
+DOUBLE_BYTE_PAIR(0xC740, 0x30A8)
+DOUBLE_BYTE_PAIR(0xC741, 0x30A9)
+DOUBLE_BYTE_PAIR(0xC742, 0x30AA)
+DOUBLE_BYTE_PAIR(0xC743, 0x30AB)
+DOUBLE_BYTE_PAIR(0xC744, 0x30AC)
+DOUBLE_BYTE_PAIR(0xC745, 0x30AD)
+DOUBLE_BYTE_PAIR(0xC746, 0x30AE)
+DOUBLE_BYTE_PAIR(0xC747, 0x30AF)
+DOUBLE_BYTE_PAIR(0xC748, 0x30B0)
+DOUBLE_BYTE_PAIR(0xC749, 0x30B1)
+DOUBLE_BYTE_PAIR(0xC74A, 0x30B2)
+DOUBLE_BYTE_PAIR(0xC74B, 0x30B3)
+DOUBLE_BYTE_PAIR(0xC74C, 0x30B4)
+DOUBLE_BYTE_PAIR(0xC74D, 0x30B5)
+DOUBLE_BYTE_PAIR(0xC74E, 0x30B6)
+DOUBLE_BYTE_PAIR(0xC74F, 0x30B7)
+DOUBLE_BYTE_PAIR(0xC750, 0x30B8)
+DOUBLE_BYTE_PAIR(0xC751, 0x30B9)
+DOUBLE_BYTE_PAIR(0xC752, 0x30BA)
+DOUBLE_BYTE_PAIR(0xC753, 0x30BB)
+DOUBLE_BYTE_PAIR(0xC754, 0x30BC)
+DOUBLE_BYTE_PAIR(0xC755, 0x30BD)
+DOUBLE_BYTE_PAIR(0xC756, 0x30BE)
+DOUBLE_BYTE_PAIR(0xC757, 0x30BF)
+DOUBLE_BYTE_PAIR(0xC758, 0x30C0)
+DOUBLE_BYTE_PAIR(0xC759, 0x30C1)
+DOUBLE_BYTE_PAIR(0xC75A, 0x30C2)
+DOUBLE_BYTE_PAIR(0xC75B, 0x30C3)
+DOUBLE_BYTE_PAIR(0xC75C, 0x30C4)
+DOUBLE_BYTE_PAIR(0xC75D, 0x30C5)
+DOUBLE_BYTE_PAIR(0xC75E, 0x30C6)
+DOUBLE_BYTE_PAIR(0xC75F, 0x30C7)
+DOUBLE_BYTE_PAIR(0xC760, 0x30C8)
+DOUBLE_BYTE_PAIR(0xC761, 0x30C9)
+DOUBLE_BYTE_PAIR(0xC762, 0x30CA)
+DOUBLE_BYTE_PAIR(0xC763, 0x30CB)
+DOUBLE_BYTE_PAIR(0xC764, 0x30CC)
+DOUBLE_BYTE_PAIR(0xC765, 0x30CD)
+DOUBLE_BYTE_PAIR(0xC766, 0x30CE)
+DOUBLE_BYTE_PAIR(0xC767, 0x30CF)
+DOUBLE_BYTE_PAIR(0xC768, 0x30D0)
+DOUBLE_BYTE_PAIR(0xC769, 0x30D1)
+DOUBLE_BYTE_PAIR(0xC76A, 0x30D2)
+DOUBLE_BYTE_PAIR(0xC76B, 0x30D3)
+DOUBLE_BYTE_PAIR(0xC76C, 0x30D4)
+DOUBLE_BYTE_PAIR(0xC76D, 0x30D5)
+DOUBLE_BYTE_PAIR(0xC76E, 0x30D6)
+DOUBLE_BYTE_PAIR(0xC76F, 0x30D7)
+DOUBLE_BYTE_PAIR(0xC770, 0x30D8)
+DOUBLE_BYTE_PAIR(0xC771, 0x30D9)
+DOUBLE_BYTE_PAIR(0xC772, 0x30DA)
+DOUBLE_BYTE_PAIR(0xC773, 0x30DB)
+DOUBLE_BYTE_PAIR(0xC774, 0x30DC)
+DOUBLE_BYTE_PAIR(0xC775, 0x30DD)
+DOUBLE_BYTE_PAIR(0xC776, 0x30DE)
+DOUBLE_BYTE_PAIR(0xC777, 0x30DF)
+DOUBLE_BYTE_PAIR(0xC778, 0x30E0)
+DOUBLE_BYTE_PAIR(0xC779, 0x30E1)
+DOUBLE_BYTE_PAIR(0xC77A, 0x30E2)
+DOUBLE_BYTE_PAIR(0xC77B, 0x30E3)
+DOUBLE_BYTE_PAIR(0xC77C, 0x30E4)
+DOUBLE_BYTE_PAIR(0xC77D, 0x30E5)
+DOUBLE_BYTE_PAIR(0xC77E, 0x30E6)
+DOUBLE_BYTE_PAIR(0xC7A1, 0x30E7)
+DOUBLE_BYTE_PAIR(0xC7A2, 0x30E8)
+DOUBLE_BYTE_PAIR(0xC7A3, 0x30E9)
+DOUBLE_BYTE_PAIR(0xC7A4, 0x30EA)
+DOUBLE_BYTE_PAIR(0xC7A5, 0x30EB)
+DOUBLE_BYTE_PAIR(0xC7A6, 0x30EC)
+DOUBLE_BYTE_PAIR(0xC7A7, 0x30ED)
+DOUBLE_BYTE_PAIR(0xC7A8, 0x30EE)
+DOUBLE_BYTE_PAIR(0xC7A9, 0x30EF)
+DOUBLE_BYTE_PAIR(0xC7AA, 0x30F0)
+DOUBLE_BYTE_PAIR(0xC7AB, 0x30F1)
+DOUBLE_BYTE_PAIR(0xC7AC, 0x30F2)
+DOUBLE_BYTE_PAIR(0xC7AD, 0x30F3)
+DOUBLE_BYTE_PAIR(0xC7AE, 0x30F4)
+DOUBLE_BYTE_PAIR(0xC7AF, 0x30F5)
+DOUBLE_BYTE_PAIR(0xC7B0, 0x30F6)
+DOUBLE_BYTE_PAIR(0xC7B1, 0x0414)
+DOUBLE_BYTE_PAIR(0xC7B2, 0x0415)
+DOUBLE_BYTE_PAIR(0xC7B3, 0x0401)
+DOUBLE_BYTE_PAIR(0xC7B4, 0x0416)
+DOUBLE_BYTE_PAIR(0xC7B5, 0x0417)
+DOUBLE_BYTE_PAIR(0xC7B6, 0x0418)
+DOUBLE_BYTE_PAIR(0xC7B7, 0x0419)
+DOUBLE_BYTE_PAIR(0xC7B8, 0x041A)
+DOUBLE_BYTE_PAIR(0xC7B9, 0x041B)
+DOUBLE_BYTE_PAIR(0xC7BA, 0x041C)
+DOUBLE_BYTE_PAIR(0xC7BB, 0x0423)
+DOUBLE_BYTE_PAIR(0xC7BC, 0x0424)
+DOUBLE_BYTE_PAIR(0xC7BD, 0x0425)
+DOUBLE_BYTE_PAIR(0xC7BE, 0x0426)
+DOUBLE_BYTE_PAIR(0xC7BF, 0x0427)
+DOUBLE_BYTE_PAIR(0xC7C0, 0x0428)
+DOUBLE_BYTE_PAIR(0xC7C1, 0x0429)
+DOUBLE_BYTE_PAIR(0xC7C2, 0x042A)
+DOUBLE_BYTE_PAIR(0xC7C3, 0x042B)
+DOUBLE_BYTE_PAIR(0xC7C4, 0x042C)
+DOUBLE_BYTE_PAIR(0xC7C5, 0x042D)
+DOUBLE_BYTE_PAIR(0xC7C6, 0x042E)
+DOUBLE_BYTE_PAIR(0xC7C7, 0x042F)
+DOUBLE_BYTE_PAIR(0xC7C8, 0x0430)
+DOUBLE_BYTE_PAIR(0xC7C9, 0x0431)
+DOUBLE_BYTE_PAIR(0xC7CA, 0x0432)
+DOUBLE_BYTE_PAIR(0xC7CB, 0x0433)
+DOUBLE_BYTE_PAIR(0xC7CC, 0x0434)
+DOUBLE_BYTE_PAIR(0xC7CD, 0x0435)
+DOUBLE_BYTE_PAIR(0xC7CE, 0x0451)
+DOUBLE_BYTE_PAIR(0xC7CF, 0x0436)
+DOUBLE_BYTE_PAIR(0xC7D0, 0x0437)
+DOUBLE_BYTE_PAIR(0xC7D1, 0x0438)
+DOUBLE_BYTE_PAIR(0xC7D2, 0x0439)
+DOUBLE_BYTE_PAIR(0xC7D3, 0x043A)
+DOUBLE_BYTE_PAIR(0xC7D4, 0x043B)
+DOUBLE_BYTE_PAIR(0xC7D5, 0x043C)
+DOUBLE_BYTE_PAIR(0xC7D6, 0x043D)
+DOUBLE_BYTE_PAIR(0xC7D7, 0x043E)
+DOUBLE_BYTE_PAIR(0xC7D8, 0x043F)
+DOUBLE_BYTE_PAIR(0xC7D9, 0x0440)
+DOUBLE_BYTE_PAIR(0xC7DA, 0x0441)
+DOUBLE_BYTE_PAIR(0xC7DB, 0x0442)
+DOUBLE_BYTE_PAIR(0xC7DC, 0x0443)
+DOUBLE_BYTE_PAIR(0xC7DD, 0x0444)
+DOUBLE_BYTE_PAIR(0xC7DE, 0x0445)
+DOUBLE_BYTE_PAIR(0xC7DF, 0x0446)
+DOUBLE_BYTE_PAIR(0xC7E0, 0x0447)
+DOUBLE_BYTE_PAIR(0xC7E1, 0x0448)
+DOUBLE_BYTE_PAIR(0xC7E2, 0x0449)
+DOUBLE_BYTE_PAIR(0xC7E3, 0x044A)
+DOUBLE_BYTE_PAIR(0xC7E4, 0x044B)
+DOUBLE_BYTE_PAIR(0xC7E5, 0x044C)
+DOUBLE_BYTE_PAIR(0xC7E6, 0x044D)
+DOUBLE_BYTE_PAIR(0xC7E7, 0x044E)
+DOUBLE_BYTE_PAIR(0xC7E8, 0x044F)
+DOUBLE_BYTE_PAIR(0xC7E9, 0x2460)
+DOUBLE_BYTE_PAIR(0xC7EA, 0x2461)
+DOUBLE_BYTE_PAIR(0xC7EB, 0x2462)
+DOUBLE_BYTE_PAIR(0xC7EC, 0x2463)
+DOUBLE_BYTE_PAIR(0xC7ED, 0x2464)
+DOUBLE_BYTE_PAIR(0xC7EE, 0x2465)
+DOUBLE_BYTE_PAIR(0xC7EF, 0x2466)
+DOUBLE_BYTE_PAIR(0xC7F0, 0x2467)
+DOUBLE_BYTE_PAIR(0xC7F1, 0x2468)
+DOUBLE_BYTE_PAIR(0xC7F2, 0x2469)
+DOUBLE_BYTE_PAIR(0xC7F3, 0x2474)
+DOUBLE_BYTE_PAIR(0xC7F4, 0x2475)
+DOUBLE_BYTE_PAIR(0xC7F5, 0x2476)
+DOUBLE_BYTE_PAIR(0xC7F6, 0x2477)
+DOUBLE_BYTE_PAIR(0xC7F7, 0x2478)
+DOUBLE_BYTE_PAIR(0xC7F8, 0x2479)
+DOUBLE_BYTE_PAIR(0xC7F9, 0x247A)
+DOUBLE_BYTE_PAIR(0xC7FA, 0x247B)
+DOUBLE_BYTE_PAIR(0xC7FB, 0x247C)
+DOUBLE_BYTE_PAIR(0xC7FC, 0x247D)
+DOUBLE_BYTE_PAIR(0xC940, 0x4E42)
+DOUBLE_BYTE_PAIR(0xC941, 0x4E5C)
+DOUBLE_BYTE_PAIR(0xC942, 0x51F5)
+DOUBLE_BYTE_PAIR(0xC943, 0x531A)
+DOUBLE_BYTE_PAIR(0xC944, 0x5382)
+DOUBLE_BYTE_PAIR(0xC945, 0x4E07)
+DOUBLE_BYTE_PAIR(0xC946, 0x4E0C)
+DOUBLE_BYTE_PAIR(0xC947, 0x4E47)
+DOUBLE_BYTE_PAIR(0xC948, 0x4E8D)
+DOUBLE_BYTE_PAIR(0xC949, 0x56D7)
+DOUBLE_BYTE_PAIR(0xC94A, 0xFA0C)
+DOUBLE_BYTE_PAIR(0xC94B, 0x5C6E)
+DOUBLE_BYTE_PAIR(0xC94C, 0x5F73)
+DOUBLE_BYTE_PAIR(0xC94D, 0x4E0F)
+DOUBLE_BYTE_PAIR(0xC94E, 0x5187)
+DOUBLE_BYTE_PAIR(0xC94F, 0x4E0E)
+DOUBLE_BYTE_PAIR(0xC950, 0x4E2E)
+DOUBLE_BYTE_PAIR(0xC951, 0x4E93)
+DOUBLE_BYTE_PAIR(0xC952, 0x4EC2)
+DOUBLE_BYTE_PAIR(0xC953, 0x4EC9)
+DOUBLE_BYTE_PAIR(0xC954, 0x4EC8)
+DOUBLE_BYTE_PAIR(0xC955, 0x5198)
+DOUBLE_BYTE_PAIR(0xC956, 0x52FC)
+DOUBLE_BYTE_PAIR(0xC957, 0x536C)
+DOUBLE_BYTE_PAIR(0xC958, 0x53B9)
+DOUBLE_BYTE_PAIR(0xC959, 0x5720)
+DOUBLE_BYTE_PAIR(0xC95A, 0x5903)
+DOUBLE_BYTE_PAIR(0xC95B, 0x592C)
+DOUBLE_BYTE_PAIR(0xC95C, 0x5C10)
+DOUBLE_BYTE_PAIR(0xC95D, 0x5DFF)
+DOUBLE_BYTE_PAIR(0xC95E, 0x65E1)
+DOUBLE_BYTE_PAIR(0xC95F, 0x6BB3)
+DOUBLE_BYTE_PAIR(0xC960, 0x6BCC)
+DOUBLE_BYTE_PAIR(0xC961, 0x6C14)
+DOUBLE_BYTE_PAIR(0xC962, 0x723F)
+DOUBLE_BYTE_PAIR(0xC963, 0x4E31)
+DOUBLE_BYTE_PAIR(0xC964, 0x4E3C)
+DOUBLE_BYTE_PAIR(0xC965, 0x4EE8)
+DOUBLE_BYTE_PAIR(0xC966, 0x4EDC)
+DOUBLE_BYTE_PAIR(0xC967, 0x4EE9)
+DOUBLE_BYTE_PAIR(0xC968, 0x4EE1)
+DOUBLE_BYTE_PAIR(0xC969, 0x4EDD)
+DOUBLE_BYTE_PAIR(0xC96A, 0x4EDA)
+DOUBLE_BYTE_PAIR(0xC96B, 0x520C)
+DOUBLE_BYTE_PAIR(0xC96C, 0x531C)
+DOUBLE_BYTE_PAIR(0xC96D, 0x534C)
+DOUBLE_BYTE_PAIR(0xC96E, 0x5722)
+DOUBLE_BYTE_PAIR(0xC96F, 0x5723)
+DOUBLE_BYTE_PAIR(0xC970, 0x5917)
+DOUBLE_BYTE_PAIR(0xC971, 0x592F)
+DOUBLE_BYTE_PAIR(0xC972, 0x5B81)
+DOUBLE_BYTE_PAIR(0xC973, 0x5B84)
+DOUBLE_BYTE_PAIR(0xC974, 0x5C12)
+DOUBLE_BYTE_PAIR(0xC975, 0x5C3B)
+DOUBLE_BYTE_PAIR(0xC976, 0x5C74)
+DOUBLE_BYTE_PAIR(0xC977, 0x5C73)
+DOUBLE_BYTE_PAIR(0xC978, 0x5E04)
+DOUBLE_BYTE_PAIR(0xC979, 0x5E80)
+DOUBLE_BYTE_PAIR(0xC97A, 0x5E82)
+DOUBLE_BYTE_PAIR(0xC97B, 0x5FC9)
+DOUBLE_BYTE_PAIR(0xC97C, 0x6209)
+DOUBLE_BYTE_PAIR(0xC97D, 0x6250)
+DOUBLE_BYTE_PAIR(0xC97E, 0x6C15)
+DOUBLE_BYTE_PAIR(0xC9A1, 0x6C36)
+DOUBLE_BYTE_PAIR(0xC9A2, 0x6C43)
+DOUBLE_BYTE_PAIR(0xC9A3, 0x6C3F)
+DOUBLE_BYTE_PAIR(0xC9A4, 0x6C3B)
+DOUBLE_BYTE_PAIR(0xC9A5, 0x72AE)
+DOUBLE_BYTE_PAIR(0xC9A6, 0x72B0)
+DOUBLE_BYTE_PAIR(0xC9A7, 0x738A)
+DOUBLE_BYTE_PAIR(0xC9A8, 0x79B8)
+DOUBLE_BYTE_PAIR(0xC9A9, 0x808A)
+DOUBLE_BYTE_PAIR(0xC9AA, 0x961E)
+DOUBLE_BYTE_PAIR(0xC9AB, 0x4F0E)
+DOUBLE_BYTE_PAIR(0xC9AC, 0x4F18)
+DOUBLE_BYTE_PAIR(0xC9AD, 0x4F2C)
+DOUBLE_BYTE_PAIR(0xC9AE, 0x4EF5)
+DOUBLE_BYTE_PAIR(0xC9AF, 0x4F14)
+DOUBLE_BYTE_PAIR(0xC9B0, 0x4EF1)
+DOUBLE_BYTE_PAIR(0xC9B1, 0x4F00)
+DOUBLE_BYTE_PAIR(0xC9B2, 0x4EF7)
+DOUBLE_BYTE_PAIR(0xC9B3, 0x4F08)
+DOUBLE_BYTE_PAIR(0xC9B4, 0x4F1D)
+DOUBLE_BYTE_PAIR(0xC9B5, 0x4F02)
+DOUBLE_BYTE_PAIR(0xC9B6, 0x4F05)
+DOUBLE_BYTE_PAIR(0xC9B7, 0x4F22)
+DOUBLE_BYTE_PAIR(0xC9B8, 0x4F13)
+DOUBLE_BYTE_PAIR(0xC9B9, 0x4F04)
+DOUBLE_BYTE_PAIR(0xC9BA, 0x4EF4)
+DOUBLE_BYTE_PAIR(0xC9BB, 0x4F12)
+DOUBLE_BYTE_PAIR(0xC9BC, 0x51B1)
+DOUBLE_BYTE_PAIR(0xC9BD, 0x5213)
+DOUBLE_BYTE_PAIR(0xC9BE, 0x5209)
+DOUBLE_BYTE_PAIR(0xC9BF, 0x5210)
+DOUBLE_BYTE_PAIR(0xC9C0, 0x52A6)
+DOUBLE_BYTE_PAIR(0xC9C1, 0x5322)
+DOUBLE_BYTE_PAIR(0xC9C2, 0x531F)
+DOUBLE_BYTE_PAIR(0xC9C3, 0x534D)
+DOUBLE_BYTE_PAIR(0xC9C4, 0x538A)
+DOUBLE_BYTE_PAIR(0xC9C5, 0x5407)
+DOUBLE_BYTE_PAIR(0xC9C6, 0x56E1)
+DOUBLE_BYTE_PAIR(0xC9C7, 0x56DF)
+DOUBLE_BYTE_PAIR(0xC9C8, 0x572E)
+DOUBLE_BYTE_PAIR(0xC9C9, 0x572A)
+DOUBLE_BYTE_PAIR(0xC9CA, 0x5734)
+DOUBLE_BYTE_PAIR(0xC9CB, 0x593C)
+DOUBLE_BYTE_PAIR(0xC9CC, 0x5980)
+DOUBLE_BYTE_PAIR(0xC9CD, 0x597C)
+DOUBLE_BYTE_PAIR(0xC9CE, 0x5985)
+DOUBLE_BYTE_PAIR(0xC9CF, 0x597B)
+DOUBLE_BYTE_PAIR(0xC9D0, 0x597E)
+DOUBLE_BYTE_PAIR(0xC9D1, 0x5977)
+DOUBLE_BYTE_PAIR(0xC9D2, 0x597F)
+DOUBLE_BYTE_PAIR(0xC9D3, 0x5B56)
+DOUBLE_BYTE_PAIR(0xC9D4, 0x5C15)
+DOUBLE_BYTE_PAIR(0xC9D5, 0x5C25)
+DOUBLE_BYTE_PAIR(0xC9D6, 0x5C7C)
+DOUBLE_BYTE_PAIR(0xC9D7, 0x5C7A)
+DOUBLE_BYTE_PAIR(0xC9D8, 0x5C7B)
+DOUBLE_BYTE_PAIR(0xC9D9, 0x5C7E)
+DOUBLE_BYTE_PAIR(0xC9DA, 0x5DDF)
+DOUBLE_BYTE_PAIR(0xC9DB, 0x5E75)
+DOUBLE_BYTE_PAIR(0xC9DC, 0x5E84)
+DOUBLE_BYTE_PAIR(0xC9DD, 0x5F02)
+DOUBLE_BYTE_PAIR(0xC9DE, 0x5F1A)
+DOUBLE_BYTE_PAIR(0xC9DF, 0x5F74)
+DOUBLE_BYTE_PAIR(0xC9E0, 0x5FD5)
+DOUBLE_BYTE_PAIR(0xC9E1, 0x5FD4)
+DOUBLE_BYTE_PAIR(0xC9E2, 0x5FCF)
+DOUBLE_BYTE_PAIR(0xC9E3, 0x625C)
+DOUBLE_BYTE_PAIR(0xC9E4, 0x625E)
+DOUBLE_BYTE_PAIR(0xC9E5, 0x6264)
+DOUBLE_BYTE_PAIR(0xC9E6, 0x6261)
+DOUBLE_BYTE_PAIR(0xC9E7, 0x6266)
+DOUBLE_BYTE_PAIR(0xC9E8, 0x6262)
+DOUBLE_BYTE_PAIR(0xC9E9, 0x6259)
+DOUBLE_BYTE_PAIR(0xC9EA, 0x6260)
+DOUBLE_BYTE_PAIR(0xC9EB, 0x625A)
+DOUBLE_BYTE_PAIR(0xC9EC, 0x6265)
+DOUBLE_BYTE_PAIR(0xC9ED, 0x65EF)
+DOUBLE_BYTE_PAIR(0xC9EE, 0x65EE)
+DOUBLE_BYTE_PAIR(0xC9EF, 0x673E)
+DOUBLE_BYTE_PAIR(0xC9F0, 0x6739)
+DOUBLE_BYTE_PAIR(0xC9F1, 0x6738)
+DOUBLE_BYTE_PAIR(0xC9F2, 0x673B)
+DOUBLE_BYTE_PAIR(0xC9F3, 0x673A)
+DOUBLE_BYTE_PAIR(0xC9F4, 0x673F)
+DOUBLE_BYTE_PAIR(0xC9F5, 0x673C)
+DOUBLE_BYTE_PAIR(0xC9F6, 0x6733)
+DOUBLE_BYTE_PAIR(0xC9F7, 0x6C18)
+DOUBLE_BYTE_PAIR(0xC9F8, 0x6C46)
+DOUBLE_BYTE_PAIR(0xC9F9, 0x6C52)
+DOUBLE_BYTE_PAIR(0xC9FA, 0x6C5C)
+DOUBLE_BYTE_PAIR(0xC9FB, 0x6C4F)
+DOUBLE_BYTE_PAIR(0xC9FC, 0x6C4A)
+DOUBLE_BYTE_PAIR(0xC9FD, 0x6C54)
+DOUBLE_BYTE_PAIR(0xC9FE, 0x6C4B)
+DOUBLE_BYTE_PAIR(0xCA40, 0x6C4C)
+DOUBLE_BYTE_PAIR(0xCA41, 0x7071)
+DOUBLE_BYTE_PAIR(0xCA42, 0x725E)
+DOUBLE_BYTE_PAIR(0xCA43, 0x72B4)
+DOUBLE_BYTE_PAIR(0xCA44, 0x72B5)
+DOUBLE_BYTE_PAIR(0xCA45, 0x738E)
+DOUBLE_BYTE_PAIR(0xCA46, 0x752A)
+DOUBLE_BYTE_PAIR(0xCA47, 0x767F)
+DOUBLE_BYTE_PAIR(0xCA48, 0x7A75)
+DOUBLE_BYTE_PAIR(0xCA49, 0x7F51)
+DOUBLE_BYTE_PAIR(0xCA4A, 0x8278)
+DOUBLE_BYTE_PAIR(0xCA4B, 0x827C)
+DOUBLE_BYTE_PAIR(0xCA4C, 0x8280)
+DOUBLE_BYTE_PAIR(0xCA4D, 0x827D)
+DOUBLE_BYTE_PAIR(0xCA4E, 0x827F)
+DOUBLE_BYTE_PAIR(0xCA4F, 0x864D)
+DOUBLE_BYTE_PAIR(0xCA50, 0x897E)
+DOUBLE_BYTE_PAIR(0xCA51, 0x9099)
+DOUBLE_BYTE_PAIR(0xCA52, 0x9097)
+DOUBLE_BYTE_PAIR(0xCA53, 0x9098)
+DOUBLE_BYTE_PAIR(0xCA54, 0x909B)
+DOUBLE_BYTE_PAIR(0xCA55, 0x9094)
+DOUBLE_BYTE_PAIR(0xCA56, 0x9622)
+DOUBLE_BYTE_PAIR(0xCA57, 0x9624)
+DOUBLE_BYTE_PAIR(0xCA58, 0x9620)
+DOUBLE_BYTE_PAIR(0xCA59, 0x9623)
+DOUBLE_BYTE_PAIR(0xCA5A, 0x4F56)
+DOUBLE_BYTE_PAIR(0xCA5B, 0x4F3B)
+DOUBLE_BYTE_PAIR(0xCA5C, 0x4F62)
+DOUBLE_BYTE_PAIR(0xCA5D, 0x4F49)
+DOUBLE_BYTE_PAIR(0xCA5E, 0x4F53)
+DOUBLE_BYTE_PAIR(0xCA5F, 0x4F64)
+DOUBLE_BYTE_PAIR(0xCA60, 0x4F3E)
+DOUBLE_BYTE_PAIR(0xCA61, 0x4F67)
+DOUBLE_BYTE_PAIR(0xCA62, 0x4F52)
+DOUBLE_BYTE_PAIR(0xCA63, 0x4F5F)
+DOUBLE_BYTE_PAIR(0xCA64, 0x4F41)
+DOUBLE_BYTE_PAIR(0xCA65, 0x4F58)
+DOUBLE_BYTE_PAIR(0xCA66, 0x4F2D)
+DOUBLE_BYTE_PAIR(0xCA67, 0x4F33)
+DOUBLE_BYTE_PAIR(0xCA68, 0x4F3F)
+DOUBLE_BYTE_PAIR(0xCA69, 0x4F61)
+DOUBLE_BYTE_PAIR(0xCA6A, 0x518F)
+DOUBLE_BYTE_PAIR(0xCA6B, 0x51B9)
+DOUBLE_BYTE_PAIR(0xCA6C, 0x521C)
+DOUBLE_BYTE_PAIR(0xCA6D, 0x521E)
+DOUBLE_BYTE_PAIR(0xCA6E, 0x5221)
+DOUBLE_BYTE_PAIR(0xCA6F, 0x52AD)
+DOUBLE_BYTE_PAIR(0xCA70, 0x52AE)
+DOUBLE_BYTE_PAIR(0xCA71, 0x5309)
+DOUBLE_BYTE_PAIR(0xCA72, 0x5363)
+DOUBLE_BYTE_PAIR(0xCA73, 0x5372)
+DOUBLE_BYTE_PAIR(0xCA74, 0x538E)
+DOUBLE_BYTE_PAIR(0xCA75, 0x538F)
+DOUBLE_BYTE_PAIR(0xCA76, 0x5430)
+DOUBLE_BYTE_PAIR(0xCA77, 0x5437)
+DOUBLE_BYTE_PAIR(0xCA78, 0x542A)
+DOUBLE_BYTE_PAIR(0xCA79, 0x5454)
+DOUBLE_BYTE_PAIR(0xCA7A, 0x5445)
+DOUBLE_BYTE_PAIR(0xCA7B, 0x5419)
+DOUBLE_BYTE_PAIR(0xCA7C, 0x541C)
+DOUBLE_BYTE_PAIR(0xCA7D, 0x5425)
+DOUBLE_BYTE_PAIR(0xCA7E, 0x5418)
+DOUBLE_BYTE_PAIR(0xCAA1, 0x543D)
+DOUBLE_BYTE_PAIR(0xCAA2, 0x544F)
+DOUBLE_BYTE_PAIR(0xCAA3, 0x5441)
+DOUBLE_BYTE_PAIR(0xCAA4, 0x5428)
+DOUBLE_BYTE_PAIR(0xCAA5, 0x5424)
+DOUBLE_BYTE_PAIR(0xCAA6, 0x5447)
+DOUBLE_BYTE_PAIR(0xCAA7, 0x56EE)
+DOUBLE_BYTE_PAIR(0xCAA8, 0x56E7)
+DOUBLE_BYTE_PAIR(0xCAA9, 0x56E5)
+DOUBLE_BYTE_PAIR(0xCAAA, 0x5741)
+DOUBLE_BYTE_PAIR(0xCAAB, 0x5745)
+DOUBLE_BYTE_PAIR(0xCAAC, 0x574C)
+DOUBLE_BYTE_PAIR(0xCAAD, 0x5749)
+DOUBLE_BYTE_PAIR(0xCAAE, 0x574B)
+DOUBLE_BYTE_PAIR(0xCAAF, 0x5752)
+DOUBLE_BYTE_PAIR(0xCAB0, 0x5906)
+DOUBLE_BYTE_PAIR(0xCAB1, 0x5940)
+DOUBLE_BYTE_PAIR(0xCAB2, 0x59A6)
+DOUBLE_BYTE_PAIR(0xCAB3, 0x5998)
+DOUBLE_BYTE_PAIR(0xCAB4, 0x59A0)
+DOUBLE_BYTE_PAIR(0xCAB5, 0x5997)
+DOUBLE_BYTE_PAIR(0xCAB6, 0x598E)
+DOUBLE_BYTE_PAIR(0xCAB7, 0x59A2)
+DOUBLE_BYTE_PAIR(0xCAB8, 0x5990)
+DOUBLE_BYTE_PAIR(0xCAB9, 0x598F)
+DOUBLE_BYTE_PAIR(0xCABA, 0x59A7)
+DOUBLE_BYTE_PAIR(0xCABB, 0x59A1)
+DOUBLE_BYTE_PAIR(0xCABC, 0x5B8E)
+DOUBLE_BYTE_PAIR(0xCABD, 0x5B92)
+DOUBLE_BYTE_PAIR(0xCABE, 0x5C28)
+DOUBLE_BYTE_PAIR(0xCABF, 0x5C2A)
+DOUBLE_BYTE_PAIR(0xCAC0, 0x5C8D)
+DOUBLE_BYTE_PAIR(0xCAC1, 0x5C8F)
+DOUBLE_BYTE_PAIR(0xCAC2, 0x5C88)
+DOUBLE_BYTE_PAIR(0xCAC3, 0x5C8B)
+DOUBLE_BYTE_PAIR(0xCAC4, 0x5C89)
+DOUBLE_BYTE_PAIR(0xCAC5, 0x5C92)
+DOUBLE_BYTE_PAIR(0xCAC6, 0x5C8A)
+DOUBLE_BYTE_PAIR(0xCAC7, 0x5C86)
+DOUBLE_BYTE_PAIR(0xCAC8, 0x5C93)
+DOUBLE_BYTE_PAIR(0xCAC9, 0x5C95)
+DOUBLE_BYTE_PAIR(0xCACA, 0x5DE0)
+DOUBLE_BYTE_PAIR(0xCACB, 0x5E0A)
+DOUBLE_BYTE_PAIR(0xCACC, 0x5E0E)
+DOUBLE_BYTE_PAIR(0xCACD, 0x5E8B)
+DOUBLE_BYTE_PAIR(0xCACE, 0x5E89)
+DOUBLE_BYTE_PAIR(0xCACF, 0x5E8C)
+DOUBLE_BYTE_PAIR(0xCAD0, 0x5E88)
+DOUBLE_BYTE_PAIR(0xCAD1, 0x5E8D)
+DOUBLE_BYTE_PAIR(0xCAD2, 0x5F05)
+DOUBLE_BYTE_PAIR(0xCAD3, 0x5F1D)
+DOUBLE_BYTE_PAIR(0xCAD4, 0x5F78)
+DOUBLE_BYTE_PAIR(0xCAD5, 0x5F76)
+DOUBLE_BYTE_PAIR(0xCAD6, 0x5FD2)
+DOUBLE_BYTE_PAIR(0xCAD7, 0x5FD1)
+DOUBLE_BYTE_PAIR(0xCAD8, 0x5FD0)
+DOUBLE_BYTE_PAIR(0xCAD9, 0x5FED)
+DOUBLE_BYTE_PAIR(0xCADA, 0x5FE8)
+DOUBLE_BYTE_PAIR(0xCADB, 0x5FEE)
+DOUBLE_BYTE_PAIR(0xCADC, 0x5FF3)
+DOUBLE_BYTE_PAIR(0xCADD, 0x5FE1)
+DOUBLE_BYTE_PAIR(0xCADE, 0x5FE4)
+DOUBLE_BYTE_PAIR(0xCADF, 0x5FE3)
+DOUBLE_BYTE_PAIR(0xCAE0, 0x5FFA)
+DOUBLE_BYTE_PAIR(0xCAE1, 0x5FEF)
+DOUBLE_BYTE_PAIR(0xCAE2, 0x5FF7)
+DOUBLE_BYTE_PAIR(0xCAE3, 0x5FFB)
+DOUBLE_BYTE_PAIR(0xCAE4, 0x6000)
+DOUBLE_BYTE_PAIR(0xCAE5, 0x5FF4)
+DOUBLE_BYTE_PAIR(0xCAE6, 0x623A)
+DOUBLE_BYTE_PAIR(0xCAE7, 0x6283)
+DOUBLE_BYTE_PAIR(0xCAE8, 0x628C)
+DOUBLE_BYTE_PAIR(0xCAE9, 0x628E)
+DOUBLE_BYTE_PAIR(0xCAEA, 0x628F)
+DOUBLE_BYTE_PAIR(0xCAEB, 0x6294)
+DOUBLE_BYTE_PAIR(0xCAEC, 0x6287)
+DOUBLE_BYTE_PAIR(0xCAED, 0x6271)
+DOUBLE_BYTE_PAIR(0xCAEE, 0x627B)
+DOUBLE_BYTE_PAIR(0xCAEF, 0x627A)
+DOUBLE_BYTE_PAIR(0xCAF0, 0x6270)
+DOUBLE_BYTE_PAIR(0xCAF1, 0x6281)
+DOUBLE_BYTE_PAIR(0xCAF2, 0x6288)
+DOUBLE_BYTE_PAIR(0xCAF3, 0x6277)
+DOUBLE_BYTE_PAIR(0xCAF4, 0x627D)
+DOUBLE_BYTE_PAIR(0xCAF5, 0x6272)
+DOUBLE_BYTE_PAIR(0xCAF6, 0x6274)
+DOUBLE_BYTE_PAIR(0xCAF7, 0x6537)
+DOUBLE_BYTE_PAIR(0xCAF8, 0x65F0)
+DOUBLE_BYTE_PAIR(0xCAF9, 0x65F4)
+DOUBLE_BYTE_PAIR(0xCAFA, 0x65F3)
+DOUBLE_BYTE_PAIR(0xCAFB, 0x65F2)
+DOUBLE_BYTE_PAIR(0xCAFC, 0x65F5)
+DOUBLE_BYTE_PAIR(0xCAFD, 0x6745)
+DOUBLE_BYTE_PAIR(0xCAFE, 0x6747)
+DOUBLE_BYTE_PAIR(0xCB40, 0x6759)
+DOUBLE_BYTE_PAIR(0xCB41, 0x6755)
+DOUBLE_BYTE_PAIR(0xCB42, 0x674C)
+DOUBLE_BYTE_PAIR(0xCB43, 0x6748)
+DOUBLE_BYTE_PAIR(0xCB44, 0x675D)
+DOUBLE_BYTE_PAIR(0xCB45, 0x674D)
+DOUBLE_BYTE_PAIR(0xCB46, 0x675A)
+DOUBLE_BYTE_PAIR(0xCB47, 0x674B)
+DOUBLE_BYTE_PAIR(0xCB48, 0x6BD0)
+DOUBLE_BYTE_PAIR(0xCB49, 0x6C19)
+DOUBLE_BYTE_PAIR(0xCB4A, 0x6C1A)
+DOUBLE_BYTE_PAIR(0xCB4B, 0x6C78)
+DOUBLE_BYTE_PAIR(0xCB4C, 0x6C67)
+DOUBLE_BYTE_PAIR(0xCB4D, 0x6C6B)
+DOUBLE_BYTE_PAIR(0xCB4E, 0x6C84)
+DOUBLE_BYTE_PAIR(0xCB4F, 0x6C8B)
+DOUBLE_BYTE_PAIR(0xCB50, 0x6C8F)
+DOUBLE_BYTE_PAIR(0xCB51, 0x6C71)
+DOUBLE_BYTE_PAIR(0xCB52, 0x6C6F)
+DOUBLE_BYTE_PAIR(0xCB53, 0x6C69)
+DOUBLE_BYTE_PAIR(0xCB54, 0x6C9A)
+DOUBLE_BYTE_PAIR(0xCB55, 0x6C6D)
+DOUBLE_BYTE_PAIR(0xCB56, 0x6C87)
+DOUBLE_BYTE_PAIR(0xCB57, 0x6C95)
+DOUBLE_BYTE_PAIR(0xCB58, 0x6C9C)
+DOUBLE_BYTE_PAIR(0xCB59, 0x6C66)
+DOUBLE_BYTE_PAIR(0xCB5A, 0x6C73)
+DOUBLE_BYTE_PAIR(0xCB5B, 0x6C65)
+DOUBLE_BYTE_PAIR(0xCB5C, 0x6C7B)
+DOUBLE_BYTE_PAIR(0xCB5D, 0x6C8E)
+DOUBLE_BYTE_PAIR(0xCB5E, 0x7074)
+DOUBLE_BYTE_PAIR(0xCB5F, 0x707A)
+DOUBLE_BYTE_PAIR(0xCB60, 0x7263)
+DOUBLE_BYTE_PAIR(0xCB61, 0x72BF)
+DOUBLE_BYTE_PAIR(0xCB62, 0x72BD)
+DOUBLE_BYTE_PAIR(0xCB63, 0x72C3)
+DOUBLE_BYTE_PAIR(0xCB64, 0x72C6)
+DOUBLE_BYTE_PAIR(0xCB65, 0x72C1)
+DOUBLE_BYTE_PAIR(0xCB66, 0x72BA)
+DOUBLE_BYTE_PAIR(0xCB67, 0x72C5)
+DOUBLE_BYTE_PAIR(0xCB68, 0x7395)
+DOUBLE_BYTE_PAIR(0xCB69, 0x7397)
+DOUBLE_BYTE_PAIR(0xCB6A, 0x7393)
+DOUBLE_BYTE_PAIR(0xCB6B, 0x7394)
+DOUBLE_BYTE_PAIR(0xCB6C, 0x7392)
+DOUBLE_BYTE_PAIR(0xCB6D, 0x753A)
+DOUBLE_BYTE_PAIR(0xCB6E, 0x7539)
+DOUBLE_BYTE_PAIR(0xCB6F, 0x7594)
+DOUBLE_BYTE_PAIR(0xCB70, 0x7595)
+DOUBLE_BYTE_PAIR(0xCB71, 0x7681)
+DOUBLE_BYTE_PAIR(0xCB72, 0x793D)
+DOUBLE_BYTE_PAIR(0xCB73, 0x8034)
+DOUBLE_BYTE_PAIR(0xCB74, 0x8095)
+DOUBLE_BYTE_PAIR(0xCB75, 0x8099)
+DOUBLE_BYTE_PAIR(0xCB76, 0x8090)
+DOUBLE_BYTE_PAIR(0xCB77, 0x8092)
+DOUBLE_BYTE_PAIR(0xCB78, 0x809C)
+DOUBLE_BYTE_PAIR(0xCB79, 0x8290)
+DOUBLE_BYTE_PAIR(0xCB7A, 0x828F)
+DOUBLE_BYTE_PAIR(0xCB7B, 0x8285)
+DOUBLE_BYTE_PAIR(0xCB7C, 0x828E)
+DOUBLE_BYTE_PAIR(0xCB7D, 0x8291)
+DOUBLE_BYTE_PAIR(0xCB7E, 0x8293)
+DOUBLE_BYTE_PAIR(0xCBA1, 0x828A)
+DOUBLE_BYTE_PAIR(0xCBA2, 0x8283)
+DOUBLE_BYTE_PAIR(0xCBA3, 0x8284)
+DOUBLE_BYTE_PAIR(0xCBA4, 0x8C78)
+DOUBLE_BYTE_PAIR(0xCBA5, 0x8FC9)
+DOUBLE_BYTE_PAIR(0xCBA6, 0x8FBF)
+DOUBLE_BYTE_PAIR(0xCBA7, 0x909F)
+DOUBLE_BYTE_PAIR(0xCBA8, 0x90A1)
+DOUBLE_BYTE_PAIR(0xCBA9, 0x90A5)
+DOUBLE_BYTE_PAIR(0xCBAA, 0x909E)
+DOUBLE_BYTE_PAIR(0xCBAB, 0x90A7)
+DOUBLE_BYTE_PAIR(0xCBAC, 0x90A0)
+DOUBLE_BYTE_PAIR(0xCBAD, 0x9630)
+DOUBLE_BYTE_PAIR(0xCBAE, 0x9628)
+DOUBLE_BYTE_PAIR(0xCBAF, 0x962F)
+DOUBLE_BYTE_PAIR(0xCBB0, 0x962D)
+DOUBLE_BYTE_PAIR(0xCBB1, 0x4E33)
+DOUBLE_BYTE_PAIR(0xCBB2, 0x4F98)
+DOUBLE_BYTE_PAIR(0xCBB3, 0x4F7C)
+DOUBLE_BYTE_PAIR(0xCBB4, 0x4F85)
+DOUBLE_BYTE_PAIR(0xCBB5, 0x4F7D)
+DOUBLE_BYTE_PAIR(0xCBB6, 0x4F80)
+DOUBLE_BYTE_PAIR(0xCBB7, 0x4F87)
+DOUBLE_BYTE_PAIR(0xCBB8, 0x4F76)
+DOUBLE_BYTE_PAIR(0xCBB9, 0x4F74)
+DOUBLE_BYTE_PAIR(0xCBBA, 0x4F89)
+DOUBLE_BYTE_PAIR(0xCBBB, 0x4F84)
+DOUBLE_BYTE_PAIR(0xCBBC, 0x4F77)
+DOUBLE_BYTE_PAIR(0xCBBD, 0x4F4C)
+DOUBLE_BYTE_PAIR(0xCBBE, 0x4F97)
+DOUBLE_BYTE_PAIR(0xCBBF, 0x4F6A)
+DOUBLE_BYTE_PAIR(0xCBC0, 0x4F9A)
+DOUBLE_BYTE_PAIR(0xCBC1, 0x4F79)
+DOUBLE_BYTE_PAIR(0xCBC2, 0x4F81)
+DOUBLE_BYTE_PAIR(0xCBC3, 0x4F78)
+DOUBLE_BYTE_PAIR(0xCBC4, 0x4F90)
+DOUBLE_BYTE_PAIR(0xCBC5, 0x4F9C)
+DOUBLE_BYTE_PAIR(0xCBC6, 0x4F94)
+DOUBLE_BYTE_PAIR(0xCBC7, 0x4F9E)
+DOUBLE_BYTE_PAIR(0xCBC8, 0x4F92)
+DOUBLE_BYTE_PAIR(0xCBC9, 0x4F82)
+DOUBLE_BYTE_PAIR(0xCBCA, 0x4F95)
+DOUBLE_BYTE_PAIR(0xCBCB, 0x4F6B)
+DOUBLE_BYTE_PAIR(0xCBCC, 0x4F6E)
+DOUBLE_BYTE_PAIR(0xCBCD, 0x519E)
+DOUBLE_BYTE_PAIR(0xCBCE, 0x51BC)
+DOUBLE_BYTE_PAIR(0xCBCF, 0x51BE)
+DOUBLE_BYTE_PAIR(0xCBD0, 0x5235)
+DOUBLE_BYTE_PAIR(0xCBD1, 0x5232)
+DOUBLE_BYTE_PAIR(0xCBD2, 0x5233)
+DOUBLE_BYTE_PAIR(0xCBD3, 0x5246)
+DOUBLE_BYTE_PAIR(0xCBD4, 0x5231)
+DOUBLE_BYTE_PAIR(0xCBD5, 0x52BC)
+DOUBLE_BYTE_PAIR(0xCBD6, 0x530A)
+DOUBLE_BYTE_PAIR(0xCBD7, 0x530B)
+DOUBLE_BYTE_PAIR(0xCBD8, 0x533C)
+DOUBLE_BYTE_PAIR(0xCBD9, 0x5392)
+DOUBLE_BYTE_PAIR(0xCBDA, 0x5394)
+DOUBLE_BYTE_PAIR(0xCBDB, 0x5487)
+DOUBLE_BYTE_PAIR(0xCBDC, 0x547F)
+DOUBLE_BYTE_PAIR(0xCBDD, 0x5481)
+DOUBLE_BYTE_PAIR(0xCBDE, 0x5491)
+DOUBLE_BYTE_PAIR(0xCBDF, 0x5482)
+DOUBLE_BYTE_PAIR(0xCBE0, 0x5488)
+DOUBLE_BYTE_PAIR(0xCBE1, 0x546B)
+DOUBLE_BYTE_PAIR(0xCBE2, 0x547A)
+DOUBLE_BYTE_PAIR(0xCBE3, 0x547E)
+DOUBLE_BYTE_PAIR(0xCBE4, 0x5465)
+DOUBLE_BYTE_PAIR(0xCBE5, 0x546C)
+DOUBLE_BYTE_PAIR(0xCBE6, 0x5474)
+DOUBLE_BYTE_PAIR(0xCBE7, 0x5466)
+DOUBLE_BYTE_PAIR(0xCBE8, 0x548D)
+DOUBLE_BYTE_PAIR(0xCBE9, 0x546F)
+DOUBLE_BYTE_PAIR(0xCBEA, 0x5461)
+DOUBLE_BYTE_PAIR(0xCBEB, 0x5460)
+DOUBLE_BYTE_PAIR(0xCBEC, 0x5498)
+DOUBLE_BYTE_PAIR(0xCBED, 0x5463)
+DOUBLE_BYTE_PAIR(0xCBEE, 0x5467)
+DOUBLE_BYTE_PAIR(0xCBEF, 0x5464)
+DOUBLE_BYTE_PAIR(0xCBF0, 0x56F7)
+DOUBLE_BYTE_PAIR(0xCBF1, 0x56F9)
+DOUBLE_BYTE_PAIR(0xCBF2, 0x576F)
+DOUBLE_BYTE_PAIR(0xCBF3, 0x5772)
+DOUBLE_BYTE_PAIR(0xCBF4, 0x576D)
+DOUBLE_BYTE_PAIR(0xCBF5, 0x576B)
+DOUBLE_BYTE_PAIR(0xCBF6, 0x5771)
+DOUBLE_BYTE_PAIR(0xCBF7, 0x5770)
+DOUBLE_BYTE_PAIR(0xCBF8, 0x5776)
+DOUBLE_BYTE_PAIR(0xCBF9, 0x5780)
+DOUBLE_BYTE_PAIR(0xCBFA, 0x5775)
+DOUBLE_BYTE_PAIR(0xCBFB, 0x577B)
+DOUBLE_BYTE_PAIR(0xCBFC, 0x5773)
+DOUBLE_BYTE_PAIR(0xCBFD, 0x5774)
+DOUBLE_BYTE_PAIR(0xCBFE, 0x5762)
+DOUBLE_BYTE_PAIR(0xCC40, 0x5768)
+DOUBLE_BYTE_PAIR(0xCC41, 0x577D)
+DOUBLE_BYTE_PAIR(0xCC42, 0x590C)
+DOUBLE_BYTE_PAIR(0xCC43, 0x5945)
+DOUBLE_BYTE_PAIR(0xCC44, 0x59B5)
+DOUBLE_BYTE_PAIR(0xCC45, 0x59BA)
+DOUBLE_BYTE_PAIR(0xCC46, 0x59CF)
+DOUBLE_BYTE_PAIR(0xCC47, 0x59CE)
+DOUBLE_BYTE_PAIR(0xCC48, 0x59B2)
+DOUBLE_BYTE_PAIR(0xCC49, 0x59CC)
+DOUBLE_BYTE_PAIR(0xCC4A, 0x59C1)
+DOUBLE_BYTE_PAIR(0xCC4B, 0x59B6)
+DOUBLE_BYTE_PAIR(0xCC4C, 0x59BC)
+DOUBLE_BYTE_PAIR(0xCC4D, 0x59C3)
+DOUBLE_BYTE_PAIR(0xCC4E, 0x59D6)
+DOUBLE_BYTE_PAIR(0xCC4F, 0x59B1)
+DOUBLE_BYTE_PAIR(0xCC50, 0x59BD)
+DOUBLE_BYTE_PAIR(0xCC51, 0x59C0)
+DOUBLE_BYTE_PAIR(0xCC52, 0x59C8)
+DOUBLE_BYTE_PAIR(0xCC53, 0x59B4)
+DOUBLE_BYTE_PAIR(0xCC54, 0x59C7)
+DOUBLE_BYTE_PAIR(0xCC55, 0x5B62)
+DOUBLE_BYTE_PAIR(0xCC56, 0x5B65)
+DOUBLE_BYTE_PAIR(0xCC57, 0x5B93)
+DOUBLE_BYTE_PAIR(0xCC58, 0x5B95)
+DOUBLE_BYTE_PAIR(0xCC59, 0x5C44)
+DOUBLE_BYTE_PAIR(0xCC5A, 0x5C47)
+DOUBLE_BYTE_PAIR(0xCC5B, 0x5CAE)
+DOUBLE_BYTE_PAIR(0xCC5C, 0x5CA4)
+DOUBLE_BYTE_PAIR(0xCC5D, 0x5CA0)
+DOUBLE_BYTE_PAIR(0xCC5E, 0x5CB5)
+DOUBLE_BYTE_PAIR(0xCC5F, 0x5CAF)
+DOUBLE_BYTE_PAIR(0xCC60, 0x5CA8)
+DOUBLE_BYTE_PAIR(0xCC61, 0x5CAC)
+DOUBLE_BYTE_PAIR(0xCC62, 0x5C9F)
+DOUBLE_BYTE_PAIR(0xCC63, 0x5CA3)
+DOUBLE_BYTE_PAIR(0xCC64, 0x5CAD)
+DOUBLE_BYTE_PAIR(0xCC65, 0x5CA2)
+DOUBLE_BYTE_PAIR(0xCC66, 0x5CAA)
+DOUBLE_BYTE_PAIR(0xCC67, 0x5CA7)
+DOUBLE_BYTE_PAIR(0xCC68, 0x5C9D)
+DOUBLE_BYTE_PAIR(0xCC69, 0x5CA5)
+DOUBLE_BYTE_PAIR(0xCC6A, 0x5CB6)
+DOUBLE_BYTE_PAIR(0xCC6B, 0x5CB0)
+DOUBLE_BYTE_PAIR(0xCC6C, 0x5CA6)
+DOUBLE_BYTE_PAIR(0xCC6D, 0x5E17)
+DOUBLE_BYTE_PAIR(0xCC6E, 0x5E14)
+DOUBLE_BYTE_PAIR(0xCC6F, 0x5E19)
+DOUBLE_BYTE_PAIR(0xCC70, 0x5F28)
+DOUBLE_BYTE_PAIR(0xCC71, 0x5F22)
+DOUBLE_BYTE_PAIR(0xCC72, 0x5F23)
+DOUBLE_BYTE_PAIR(0xCC73, 0x5F24)
+DOUBLE_BYTE_PAIR(0xCC74, 0x5F54)
+DOUBLE_BYTE_PAIR(0xCC75, 0x5F82)
+DOUBLE_BYTE_PAIR(0xCC76, 0x5F7E)
+DOUBLE_BYTE_PAIR(0xCC77, 0x5F7D)
+DOUBLE_BYTE_PAIR(0xCC78, 0x5FDE)
+DOUBLE_BYTE_PAIR(0xCC79, 0x5FE5)
+DOUBLE_BYTE_PAIR(0xCC7A, 0x602D)
+DOUBLE_BYTE_PAIR(0xCC7B, 0x6026)
+DOUBLE_BYTE_PAIR(0xCC7C, 0x6019)
+DOUBLE_BYTE_PAIR(0xCC7D, 0x6032)
+DOUBLE_BYTE_PAIR(0xCC7E, 0x600B)
+DOUBLE_BYTE_PAIR(0xCCA1, 0x6034)
+DOUBLE_BYTE_PAIR(0xCCA2, 0x600A)
+DOUBLE_BYTE_PAIR(0xCCA3, 0x6017)
+DOUBLE_BYTE_PAIR(0xCCA4, 0x6033)
+DOUBLE_BYTE_PAIR(0xCCA5, 0x601A)
+DOUBLE_BYTE_PAIR(0xCCA6, 0x601E)
+DOUBLE_BYTE_PAIR(0xCCA7, 0x602C)
+DOUBLE_BYTE_PAIR(0xCCA8, 0x6022)
+DOUBLE_BYTE_PAIR(0xCCA9, 0x600D)
+DOUBLE_BYTE_PAIR(0xCCAA, 0x6010)
+DOUBLE_BYTE_PAIR(0xCCAB, 0x602E)
+DOUBLE_BYTE_PAIR(0xCCAC, 0x6013)
+DOUBLE_BYTE_PAIR(0xCCAD, 0x6011)
+DOUBLE_BYTE_PAIR(0xCCAE, 0x600C)
+DOUBLE_BYTE_PAIR(0xCCAF, 0x6009)
+DOUBLE_BYTE_PAIR(0xCCB0, 0x601C)
+DOUBLE_BYTE_PAIR(0xCCB1, 0x6214)
+DOUBLE_BYTE_PAIR(0xCCB2, 0x623D)
+DOUBLE_BYTE_PAIR(0xCCB3, 0x62AD)
+DOUBLE_BYTE_PAIR(0xCCB4, 0x62B4)
+DOUBLE_BYTE_PAIR(0xCCB5, 0x62D1)
+DOUBLE_BYTE_PAIR(0xCCB6, 0x62BE)
+DOUBLE_BYTE_PAIR(0xCCB7, 0x62AA)
+DOUBLE_BYTE_PAIR(0xCCB8, 0x62B6)
+DOUBLE_BYTE_PAIR(0xCCB9, 0x62CA)
+DOUBLE_BYTE_PAIR(0xCCBA, 0x62AE)
+DOUBLE_BYTE_PAIR(0xCCBB, 0x62B3)
+DOUBLE_BYTE_PAIR(0xCCBC, 0x62AF)
+DOUBLE_BYTE_PAIR(0xCCBD, 0x62BB)
+DOUBLE_BYTE_PAIR(0xCCBE, 0x62A9)
+DOUBLE_BYTE_PAIR(0xCCBF, 0x62B0)
+DOUBLE_BYTE_PAIR(0xCCC0, 0x62B8)
+DOUBLE_BYTE_PAIR(0xCCC1, 0x653D)
+DOUBLE_BYTE_PAIR(0xCCC2, 0x65A8)
+DOUBLE_BYTE_PAIR(0xCCC3, 0x65BB)
+DOUBLE_BYTE_PAIR(0xCCC4, 0x6609)
+DOUBLE_BYTE_PAIR(0xCCC5, 0x65FC)
+DOUBLE_BYTE_PAIR(0xCCC6, 0x6604)
+DOUBLE_BYTE_PAIR(0xCCC7, 0x6612)
+DOUBLE_BYTE_PAIR(0xCCC8, 0x6608)
+DOUBLE_BYTE_PAIR(0xCCC9, 0x65FB)
+DOUBLE_BYTE_PAIR(0xCCCA, 0x6603)
+DOUBLE_BYTE_PAIR(0xCCCB, 0x660B)
+DOUBLE_BYTE_PAIR(0xCCCC, 0x660D)
+DOUBLE_BYTE_PAIR(0xCCCD, 0x6605)
+DOUBLE_BYTE_PAIR(0xCCCE, 0x65FD)
+DOUBLE_BYTE_PAIR(0xCCCF, 0x6611)
+DOUBLE_BYTE_PAIR(0xCCD0, 0x6610)
+DOUBLE_BYTE_PAIR(0xCCD1, 0x66F6)
+DOUBLE_BYTE_PAIR(0xCCD2, 0x670A)
+DOUBLE_BYTE_PAIR(0xCCD3, 0x6785)
+DOUBLE_BYTE_PAIR(0xCCD4, 0x676C)
+DOUBLE_BYTE_PAIR(0xCCD5, 0x678E)
+DOUBLE_BYTE_PAIR(0xCCD6, 0x6792)
+DOUBLE_BYTE_PAIR(0xCCD7, 0x6776)
+DOUBLE_BYTE_PAIR(0xCCD8, 0x677B)
+DOUBLE_BYTE_PAIR(0xCCD9, 0x6798)
+DOUBLE_BYTE_PAIR(0xCCDA, 0x6786)
+DOUBLE_BYTE_PAIR(0xCCDB, 0x6784)
+DOUBLE_BYTE_PAIR(0xCCDC, 0x6774)
+DOUBLE_BYTE_PAIR(0xCCDD, 0x678D)
+DOUBLE_BYTE_PAIR(0xCCDE, 0x678C)
+DOUBLE_BYTE_PAIR(0xCCDF, 0x677A)
+DOUBLE_BYTE_PAIR(0xCCE0, 0x679F)
+DOUBLE_BYTE_PAIR(0xCCE1, 0x6791)
+DOUBLE_BYTE_PAIR(0xCCE2, 0x6799)
+DOUBLE_BYTE_PAIR(0xCCE3, 0x6783)
+DOUBLE_BYTE_PAIR(0xCCE4, 0x677D)
+DOUBLE_BYTE_PAIR(0xCCE5, 0x6781)
+DOUBLE_BYTE_PAIR(0xCCE6, 0x6778)
+DOUBLE_BYTE_PAIR(0xCCE7, 0x6779)
+DOUBLE_BYTE_PAIR(0xCCE8, 0x6794)
+DOUBLE_BYTE_PAIR(0xCCE9, 0x6B25)
+DOUBLE_BYTE_PAIR(0xCCEA, 0x6B80)
+DOUBLE_BYTE_PAIR(0xCCEB, 0x6B7E)
+DOUBLE_BYTE_PAIR(0xCCEC, 0x6BDE)
+DOUBLE_BYTE_PAIR(0xCCED, 0x6C1D)
+DOUBLE_BYTE_PAIR(0xCCEE, 0x6C93)
+DOUBLE_BYTE_PAIR(0xCCEF, 0x6CEC)
+DOUBLE_BYTE_PAIR(0xCCF0, 0x6CEB)
+DOUBLE_BYTE_PAIR(0xCCF1, 0x6CEE)
+DOUBLE_BYTE_PAIR(0xCCF2, 0x6CD9)
+DOUBLE_BYTE_PAIR(0xCCF3, 0x6CB6)
+DOUBLE_BYTE_PAIR(0xCCF4, 0x6CD4)
+DOUBLE_BYTE_PAIR(0xCCF5, 0x6CAD)
+DOUBLE_BYTE_PAIR(0xCCF6, 0x6CE7)
+DOUBLE_BYTE_PAIR(0xCCF7, 0x6CB7)
+DOUBLE_BYTE_PAIR(0xCCF8, 0x6CD0)
+DOUBLE_BYTE_PAIR(0xCCF9, 0x6CC2)
+DOUBLE_BYTE_PAIR(0xCCFA, 0x6CBA)
+DOUBLE_BYTE_PAIR(0xCCFB, 0x6CC3)
+DOUBLE_BYTE_PAIR(0xCCFC, 0x6CC6)
+DOUBLE_BYTE_PAIR(0xCCFD, 0x6CED)
+DOUBLE_BYTE_PAIR(0xCCFE, 0x6CF2)
+DOUBLE_BYTE_PAIR(0xCD40, 0x6CD2)
+DOUBLE_BYTE_PAIR(0xCD41, 0x6CDD)
+DOUBLE_BYTE_PAIR(0xCD42, 0x6CB4)
+DOUBLE_BYTE_PAIR(0xCD43, 0x6C8A)
+DOUBLE_BYTE_PAIR(0xCD44, 0x6C9D)
+DOUBLE_BYTE_PAIR(0xCD45, 0x6C80)
+DOUBLE_BYTE_PAIR(0xCD46, 0x6CDE)
+DOUBLE_BYTE_PAIR(0xCD47, 0x6CC0)
+DOUBLE_BYTE_PAIR(0xCD48, 0x6D30)
+DOUBLE_BYTE_PAIR(0xCD49, 0x6CCD)
+DOUBLE_BYTE_PAIR(0xCD4A, 0x6CC7)
+DOUBLE_BYTE_PAIR(0xCD4B, 0x6CB0)
+DOUBLE_BYTE_PAIR(0xCD4C, 0x6CF9)
+DOUBLE_BYTE_PAIR(0xCD4D, 0x6CCF)
+DOUBLE_BYTE_PAIR(0xCD4E, 0x6CE9)
+DOUBLE_BYTE_PAIR(0xCD4F, 0x6CD1)
+DOUBLE_BYTE_PAIR(0xCD50, 0x7094)
+DOUBLE_BYTE_PAIR(0xCD51, 0x7098)
+DOUBLE_BYTE_PAIR(0xCD52, 0x7085)
+DOUBLE_BYTE_PAIR(0xCD53, 0x7093)
+DOUBLE_BYTE_PAIR(0xCD54, 0x7086)
+DOUBLE_BYTE_PAIR(0xCD55, 0x7084)
+DOUBLE_BYTE_PAIR(0xCD56, 0x7091)
+DOUBLE_BYTE_PAIR(0xCD57, 0x7096)
+DOUBLE_BYTE_PAIR(0xCD58, 0x7082)
+DOUBLE_BYTE_PAIR(0xCD59, 0x709A)
+DOUBLE_BYTE_PAIR(0xCD5A, 0x7083)
+DOUBLE_BYTE_PAIR(0xCD5B, 0x726A)
+DOUBLE_BYTE_PAIR(0xCD5C, 0x72D6)
+DOUBLE_BYTE_PAIR(0xCD5D, 0x72CB)
+DOUBLE_BYTE_PAIR(0xCD5E, 0x72D8)
+DOUBLE_BYTE_PAIR(0xCD5F, 0x72C9)
+DOUBLE_BYTE_PAIR(0xCD60, 0x72DC)
+DOUBLE_BYTE_PAIR(0xCD61, 0x72D2)
+DOUBLE_BYTE_PAIR(0xCD62, 0x72D4)
+DOUBLE_BYTE_PAIR(0xCD63, 0x72DA)
+DOUBLE_BYTE_PAIR(0xCD64, 0x72CC)
+DOUBLE_BYTE_PAIR(0xCD65, 0x72D1)
+DOUBLE_BYTE_PAIR(0xCD66, 0x73A4)
+DOUBLE_BYTE_PAIR(0xCD67, 0x73A1)
+DOUBLE_BYTE_PAIR(0xCD68, 0x73AD)
+DOUBLE_BYTE_PAIR(0xCD69, 0x73A6)
+DOUBLE_BYTE_PAIR(0xCD6A, 0x73A2)
+DOUBLE_BYTE_PAIR(0xCD6B, 0x73A0)
+DOUBLE_BYTE_PAIR(0xCD6C, 0x73AC)
+DOUBLE_BYTE_PAIR(0xCD6D, 0x739D)
+DOUBLE_BYTE_PAIR(0xCD6E, 0x74DD)
+DOUBLE_BYTE_PAIR(0xCD6F, 0x74E8)
+DOUBLE_BYTE_PAIR(0xCD70, 0x753F)
+DOUBLE_BYTE_PAIR(0xCD71, 0x7540)
+DOUBLE_BYTE_PAIR(0xCD72, 0x753E)
+DOUBLE_BYTE_PAIR(0xCD73, 0x758C)
+DOUBLE_BYTE_PAIR(0xCD74, 0x7598)
+DOUBLE_BYTE_PAIR(0xCD75, 0x76AF)
+DOUBLE_BYTE_PAIR(0xCD76, 0x76F3)
+DOUBLE_BYTE_PAIR(0xCD77, 0x76F1)
+DOUBLE_BYTE_PAIR(0xCD78, 0x76F0)
+DOUBLE_BYTE_PAIR(0xCD79, 0x76F5)
+DOUBLE_BYTE_PAIR(0xCD7A, 0x77F8)
+DOUBLE_BYTE_PAIR(0xCD7B, 0x77FC)
+DOUBLE_BYTE_PAIR(0xCD7C, 0x77F9)
+DOUBLE_BYTE_PAIR(0xCD7D, 0x77FB)
+DOUBLE_BYTE_PAIR(0xCD7E, 0x77FA)
+DOUBLE_BYTE_PAIR(0xCDA1, 0x77F7)
+DOUBLE_BYTE_PAIR(0xCDA2, 0x7942)
+DOUBLE_BYTE_PAIR(0xCDA3, 0x793F)
+DOUBLE_BYTE_PAIR(0xCDA4, 0x79C5)
+DOUBLE_BYTE_PAIR(0xCDA5, 0x7A78)
+DOUBLE_BYTE_PAIR(0xCDA6, 0x7A7B)
+DOUBLE_BYTE_PAIR(0xCDA7, 0x7AFB)
+DOUBLE_BYTE_PAIR(0xCDA8, 0x7C75)
+DOUBLE_BYTE_PAIR(0xCDA9, 0x7CFD)
+DOUBLE_BYTE_PAIR(0xCDAA, 0x8035)
+DOUBLE_BYTE_PAIR(0xCDAB, 0x808F)
+DOUBLE_BYTE_PAIR(0xCDAC, 0x80AE)
+DOUBLE_BYTE_PAIR(0xCDAD, 0x80A3)
+DOUBLE_BYTE_PAIR(0xCDAE, 0x80B8)
+DOUBLE_BYTE_PAIR(0xCDAF, 0x80B5)
+DOUBLE_BYTE_PAIR(0xCDB0, 0x80AD)
+DOUBLE_BYTE_PAIR(0xCDB1, 0x8220)
+DOUBLE_BYTE_PAIR(0xCDB2, 0x82A0)
+DOUBLE_BYTE_PAIR(0xCDB3, 0x82C0)
+DOUBLE_BYTE_PAIR(0xCDB4, 0x82AB)
+DOUBLE_BYTE_PAIR(0xCDB5, 0x829A)
+DOUBLE_BYTE_PAIR(0xCDB6, 0x8298)
+DOUBLE_BYTE_PAIR(0xCDB7, 0x829B)
+DOUBLE_BYTE_PAIR(0xCDB8, 0x82B5)
+DOUBLE_BYTE_PAIR(0xCDB9, 0x82A7)
+DOUBLE_BYTE_PAIR(0xCDBA, 0x82AE)
+DOUBLE_BYTE_PAIR(0xCDBB, 0x82BC)
+DOUBLE_BYTE_PAIR(0xCDBC, 0x829E)
+DOUBLE_BYTE_PAIR(0xCDBD, 0x82BA)
+DOUBLE_BYTE_PAIR(0xCDBE, 0x82B4)
+DOUBLE_BYTE_PAIR(0xCDBF, 0x82A8)
+DOUBLE_BYTE_PAIR(0xCDC0, 0x82A1)
+DOUBLE_BYTE_PAIR(0xCDC1, 0x82A9)
+DOUBLE_BYTE_PAIR(0xCDC2, 0x82C2)
+DOUBLE_BYTE_PAIR(0xCDC3, 0x82A4)
+DOUBLE_BYTE_PAIR(0xCDC4, 0x82C3)
+DOUBLE_BYTE_PAIR(0xCDC5, 0x82B6)
+DOUBLE_BYTE_PAIR(0xCDC6, 0x82A2)
+DOUBLE_BYTE_PAIR(0xCDC7, 0x8670)
+DOUBLE_BYTE_PAIR(0xCDC8, 0x866F)
+DOUBLE_BYTE_PAIR(0xCDC9, 0x866D)
+DOUBLE_BYTE_PAIR(0xCDCA, 0x866E)
+DOUBLE_BYTE_PAIR(0xCDCB, 0x8C56)
+DOUBLE_BYTE_PAIR(0xCDCC, 0x8FD2)
+DOUBLE_BYTE_PAIR(0xCDCD, 0x8FCB)
+DOUBLE_BYTE_PAIR(0xCDCE, 0x8FD3)
+DOUBLE_BYTE_PAIR(0xCDCF, 0x8FCD)
+DOUBLE_BYTE_PAIR(0xCDD0, 0x8FD6)
+DOUBLE_BYTE_PAIR(0xCDD1, 0x8FD5)
+DOUBLE_BYTE_PAIR(0xCDD2, 0x8FD7)
+DOUBLE_BYTE_PAIR(0xCDD3, 0x90B2)
+DOUBLE_BYTE_PAIR(0xCDD4, 0x90B4)
+DOUBLE_BYTE_PAIR(0xCDD5, 0x90AF)
+DOUBLE_BYTE_PAIR(0xCDD6, 0x90B3)
+DOUBLE_BYTE_PAIR(0xCDD7, 0x90B0)
+DOUBLE_BYTE_PAIR(0xCDD8, 0x9639)
+DOUBLE_BYTE_PAIR(0xCDD9, 0x963D)
+DOUBLE_BYTE_PAIR(0xCDDA, 0x963C)
+DOUBLE_BYTE_PAIR(0xCDDB, 0x963A)
+DOUBLE_BYTE_PAIR(0xCDDC, 0x9643)
+DOUBLE_BYTE_PAIR(0xCDDD, 0x4FCD)
+DOUBLE_BYTE_PAIR(0xCDDE, 0x4FC5)
+DOUBLE_BYTE_PAIR(0xCDDF, 0x4FD3)
+DOUBLE_BYTE_PAIR(0xCDE0, 0x4FB2)
+DOUBLE_BYTE_PAIR(0xCDE1, 0x4FC9)
+DOUBLE_BYTE_PAIR(0xCDE2, 0x4FCB)
+DOUBLE_BYTE_PAIR(0xCDE3, 0x4FC1)
+DOUBLE_BYTE_PAIR(0xCDE4, 0x4FD4)
+DOUBLE_BYTE_PAIR(0xCDE5, 0x4FDC)
+DOUBLE_BYTE_PAIR(0xCDE6, 0x4FD9)
+DOUBLE_BYTE_PAIR(0xCDE7, 0x4FBB)
+DOUBLE_BYTE_PAIR(0xCDE8, 0x4FB3)
+DOUBLE_BYTE_PAIR(0xCDE9, 0x4FDB)
+DOUBLE_BYTE_PAIR(0xCDEA, 0x4FC7)
+DOUBLE_BYTE_PAIR(0xCDEB, 0x4FD6)
+DOUBLE_BYTE_PAIR(0xCDEC, 0x4FBA)
+DOUBLE_BYTE_PAIR(0xCDED, 0x4FC0)
+DOUBLE_BYTE_PAIR(0xCDEE, 0x4FB9)
+DOUBLE_BYTE_PAIR(0xCDEF, 0x4FEC)
+DOUBLE_BYTE_PAIR(0xCDF0, 0x5244)
+DOUBLE_BYTE_PAIR(0xCDF1, 0x5249)
+DOUBLE_BYTE_PAIR(0xCDF2, 0x52C0)
+DOUBLE_BYTE_PAIR(0xCDF3, 0x52C2)
+DOUBLE_BYTE_PAIR(0xCDF4, 0x533D)
+DOUBLE_BYTE_PAIR(0xCDF5, 0x537C)
+DOUBLE_BYTE_PAIR(0xCDF6, 0x5397)
+DOUBLE_BYTE_PAIR(0xCDF7, 0x5396)
+DOUBLE_BYTE_PAIR(0xCDF8, 0x5399)
+DOUBLE_BYTE_PAIR(0xCDF9, 0x5398)
+DOUBLE_BYTE_PAIR(0xCDFA, 0x54BA)
+DOUBLE_BYTE_PAIR(0xCDFB, 0x54A1)
+DOUBLE_BYTE_PAIR(0xCDFC, 0x54AD)
+DOUBLE_BYTE_PAIR(0xCDFD, 0x54A5)
+DOUBLE_BYTE_PAIR(0xCDFE, 0x54CF)
+DOUBLE_BYTE_PAIR(0xCE40, 0x54C3)
+DOUBLE_BYTE_PAIR(0xCE41, 0x830D)
+DOUBLE_BYTE_PAIR(0xCE42, 0x54B7)
+DOUBLE_BYTE_PAIR(0xCE43, 0x54AE)
+DOUBLE_BYTE_PAIR(0xCE44, 0x54D6)
+DOUBLE_BYTE_PAIR(0xCE45, 0x54B6)
+DOUBLE_BYTE_PAIR(0xCE46, 0x54C5)
+DOUBLE_BYTE_PAIR(0xCE47, 0x54C6)
+DOUBLE_BYTE_PAIR(0xCE48, 0x54A0)
+DOUBLE_BYTE_PAIR(0xCE49, 0x5470)
+DOUBLE_BYTE_PAIR(0xCE4A, 0x54BC)
+DOUBLE_BYTE_PAIR(0xCE4B, 0x54A2)
+DOUBLE_BYTE_PAIR(0xCE4C, 0x54BE)
+DOUBLE_BYTE_PAIR(0xCE4D, 0x5472)
+DOUBLE_BYTE_PAIR(0xCE4E, 0x54DE)
+DOUBLE_BYTE_PAIR(0xCE4F, 0x54B0)
+DOUBLE_BYTE_PAIR(0xCE50, 0x57B5)
+DOUBLE_BYTE_PAIR(0xCE51, 0x579E)
+DOUBLE_BYTE_PAIR(0xCE52, 0x579F)
+DOUBLE_BYTE_PAIR(0xCE53, 0x57A4)
+DOUBLE_BYTE_PAIR(0xCE54, 0x578C)
+DOUBLE_BYTE_PAIR(0xCE55, 0x5797)
+DOUBLE_BYTE_PAIR(0xCE56, 0x579D)
+DOUBLE_BYTE_PAIR(0xCE57, 0x579B)
+DOUBLE_BYTE_PAIR(0xCE58, 0x5794)
+DOUBLE_BYTE_PAIR(0xCE59, 0x5798)
+DOUBLE_BYTE_PAIR(0xCE5A, 0x578F)
+DOUBLE_BYTE_PAIR(0xCE5B, 0x5799)
+DOUBLE_BYTE_PAIR(0xCE5C, 0x57A5)
+DOUBLE_BYTE_PAIR(0xCE5D, 0x579A)
+DOUBLE_BYTE_PAIR(0xCE5E, 0x5795)
+DOUBLE_BYTE_PAIR(0xCE5F, 0x58F4)
+DOUBLE_BYTE_PAIR(0xCE60, 0x590D)
+DOUBLE_BYTE_PAIR(0xCE61, 0x5953)
+DOUBLE_BYTE_PAIR(0xCE62, 0x59E1)
+DOUBLE_BYTE_PAIR(0xCE63, 0x59DE)
+DOUBLE_BYTE_PAIR(0xCE64, 0x59EE)
+DOUBLE_BYTE_PAIR(0xCE65, 0x5A00)
+DOUBLE_BYTE_PAIR(0xCE66, 0x59F1)
+DOUBLE_BYTE_PAIR(0xCE67, 0x59DD)
+DOUBLE_BYTE_PAIR(0xCE68, 0x59FA)
+DOUBLE_BYTE_PAIR(0xCE69, 0x59FD)
+DOUBLE_BYTE_PAIR(0xCE6A, 0x59FC)
+DOUBLE_BYTE_PAIR(0xCE6B, 0x59F6)
+DOUBLE_BYTE_PAIR(0xCE6C, 0x59E4)
+DOUBLE_BYTE_PAIR(0xCE6D, 0x59F2)
+DOUBLE_BYTE_PAIR(0xCE6E, 0x59F7)
+DOUBLE_BYTE_PAIR(0xCE6F, 0x59DB)
+DOUBLE_BYTE_PAIR(0xCE70, 0x59E9)
+DOUBLE_BYTE_PAIR(0xCE71, 0x59F3)
+DOUBLE_BYTE_PAIR(0xCE72, 0x59F5)
+DOUBLE_BYTE_PAIR(0xCE73, 0x59E0)
+DOUBLE_BYTE_PAIR(0xCE74, 0x59FE)
+DOUBLE_BYTE_PAIR(0xCE75, 0x59F4)
+DOUBLE_BYTE_PAIR(0xCE76, 0x59ED)
+DOUBLE_BYTE_PAIR(0xCE77, 0x5BA8)
+DOUBLE_BYTE_PAIR(0xCE78, 0x5C4C)
+DOUBLE_BYTE_PAIR(0xCE79, 0x5CD0)
+DOUBLE_BYTE_PAIR(0xCE7A, 0x5CD8)
+DOUBLE_BYTE_PAIR(0xCE7B, 0x5CCC)
+DOUBLE_BYTE_PAIR(0xCE7C, 0x5CD7)
+DOUBLE_BYTE_PAIR(0xCE7D, 0x5CCB)
+DOUBLE_BYTE_PAIR(0xCE7E, 0x5CDB)
+DOUBLE_BYTE_PAIR(0xCEA1, 0x5CDE)
+DOUBLE_BYTE_PAIR(0xCEA2, 0x5CDA)
+DOUBLE_BYTE_PAIR(0xCEA3, 0x5CC9)
+DOUBLE_BYTE_PAIR(0xCEA4, 0x5CC7)
+DOUBLE_BYTE_PAIR(0xCEA5, 0x5CCA)
+DOUBLE_BYTE_PAIR(0xCEA6, 0x5CD6)
+DOUBLE_BYTE_PAIR(0xCEA7, 0x5CD3)
+DOUBLE_BYTE_PAIR(0xCEA8, 0x5CD4)
+DOUBLE_BYTE_PAIR(0xCEA9, 0x5CCF)
+DOUBLE_BYTE_PAIR(0xCEAA, 0x5CC8)
+DOUBLE_BYTE_PAIR(0xCEAB, 0x5CC6)
+DOUBLE_BYTE_PAIR(0xCEAC, 0x5CCE)
+DOUBLE_BYTE_PAIR(0xCEAD, 0x5CDF)
+DOUBLE_BYTE_PAIR(0xCEAE, 0x5CF8)
+DOUBLE_BYTE_PAIR(0xCEAF, 0x5DF9)
+DOUBLE_BYTE_PAIR(0xCEB0, 0x5E21)
+DOUBLE_BYTE_PAIR(0xCEB1, 0x5E22)
+DOUBLE_BYTE_PAIR(0xCEB2, 0x5E23)
+DOUBLE_BYTE_PAIR(0xCEB3, 0x5E20)
+DOUBLE_BYTE_PAIR(0xCEB4, 0x5E24)
+DOUBLE_BYTE_PAIR(0xCEB5, 0x5EB0)
+DOUBLE_BYTE_PAIR(0xCEB6, 0x5EA4)
+DOUBLE_BYTE_PAIR(0xCEB7, 0x5EA2)
+DOUBLE_BYTE_PAIR(0xCEB8, 0x5E9B)
+DOUBLE_BYTE_PAIR(0xCEB9, 0x5EA3)
+DOUBLE_BYTE_PAIR(0xCEBA, 0x5EA5)
+DOUBLE_BYTE_PAIR(0xCEBB, 0x5F07)
+DOUBLE_BYTE_PAIR(0xCEBC, 0x5F2E)
+DOUBLE_BYTE_PAIR(0xCEBD, 0x5F56)
+DOUBLE_BYTE_PAIR(0xCEBE, 0x5F86)
+DOUBLE_BYTE_PAIR(0xCEBF, 0x6037)
+DOUBLE_BYTE_PAIR(0xCEC0, 0x6039)
+DOUBLE_BYTE_PAIR(0xCEC1, 0x6054)
+DOUBLE_BYTE_PAIR(0xCEC2, 0x6072)
+DOUBLE_BYTE_PAIR(0xCEC3, 0x605E)
+DOUBLE_BYTE_PAIR(0xCEC4, 0x6045)
+DOUBLE_BYTE_PAIR(0xCEC5, 0x6053)
+DOUBLE_BYTE_PAIR(0xCEC6, 0x6047)
+DOUBLE_BYTE_PAIR(0xCEC7, 0x6049)
+DOUBLE_BYTE_PAIR(0xCEC8, 0x605B)
+DOUBLE_BYTE_PAIR(0xCEC9, 0x604C)
+DOUBLE_BYTE_PAIR(0xCECA, 0x6040)
+DOUBLE_BYTE_PAIR(0xCECB, 0x6042)
+DOUBLE_BYTE_PAIR(0xCECC, 0x605F)
+DOUBLE_BYTE_PAIR(0xCECD, 0x6024)
+DOUBLE_BYTE_PAIR(0xCECE, 0x6044)
+DOUBLE_BYTE_PAIR(0xCECF, 0x6058)
+DOUBLE_BYTE_PAIR(0xCED0, 0x6066)
+DOUBLE_BYTE_PAIR(0xCED1, 0x606E)
+DOUBLE_BYTE_PAIR(0xCED2, 0x6242)
+DOUBLE_BYTE_PAIR(0xCED3, 0x6243)
+DOUBLE_BYTE_PAIR(0xCED4, 0x62CF)
+DOUBLE_BYTE_PAIR(0xCED5, 0x630D)
+DOUBLE_BYTE_PAIR(0xCED6, 0x630B)
+DOUBLE_BYTE_PAIR(0xCED7, 0x62F5)
+DOUBLE_BYTE_PAIR(0xCED8, 0x630E)
+DOUBLE_BYTE_PAIR(0xCED9, 0x6303)
+DOUBLE_BYTE_PAIR(0xCEDA, 0x62EB)
+DOUBLE_BYTE_PAIR(0xCEDB, 0x62F9)
+DOUBLE_BYTE_PAIR(0xCEDC, 0x630F)
+DOUBLE_BYTE_PAIR(0xCEDD, 0x630C)
+DOUBLE_BYTE_PAIR(0xCEDE, 0x62F8)
+DOUBLE_BYTE_PAIR(0xCEDF, 0x62F6)
+DOUBLE_BYTE_PAIR(0xCEE0, 0x6300)
+DOUBLE_BYTE_PAIR(0xCEE1, 0x6313)
+DOUBLE_BYTE_PAIR(0xCEE2, 0x6314)
+DOUBLE_BYTE_PAIR(0xCEE3, 0x62FA)
+DOUBLE_BYTE_PAIR(0xCEE4, 0x6315)
+DOUBLE_BYTE_PAIR(0xCEE5, 0x62FB)
+DOUBLE_BYTE_PAIR(0xCEE6, 0x62F0)
+DOUBLE_BYTE_PAIR(0xCEE7, 0x6541)
+DOUBLE_BYTE_PAIR(0xCEE8, 0x6543)
+DOUBLE_BYTE_PAIR(0xCEE9, 0x65AA)
+DOUBLE_BYTE_PAIR(0xCEEA, 0x65BF)
+DOUBLE_BYTE_PAIR(0xCEEB, 0x6636)
+DOUBLE_BYTE_PAIR(0xCEEC, 0x6621)
+DOUBLE_BYTE_PAIR(0xCEED, 0x6632)
+DOUBLE_BYTE_PAIR(0xCEEE, 0x6635)
+DOUBLE_BYTE_PAIR(0xCEEF, 0x661C)
+DOUBLE_BYTE_PAIR(0xCEF0, 0x6626)
+DOUBLE_BYTE_PAIR(0xCEF1, 0x6622)
+DOUBLE_BYTE_PAIR(0xCEF2, 0x6633)
+DOUBLE_BYTE_PAIR(0xCEF3, 0x662B)
+DOUBLE_BYTE_PAIR(0xCEF4, 0x663A)
+DOUBLE_BYTE_PAIR(0xCEF5, 0x661D)
+DOUBLE_BYTE_PAIR(0xCEF6, 0x6634)
+DOUBLE_BYTE_PAIR(0xCEF7, 0x6639)
+DOUBLE_BYTE_PAIR(0xCEF8, 0x662E)
+DOUBLE_BYTE_PAIR(0xCEF9, 0x670F)
+DOUBLE_BYTE_PAIR(0xCEFA, 0x6710)
+DOUBLE_BYTE_PAIR(0xCEFB, 0x67C1)
+DOUBLE_BYTE_PAIR(0xCEFC, 0x67F2)
+DOUBLE_BYTE_PAIR(0xCEFD, 0x67C8)
+DOUBLE_BYTE_PAIR(0xCEFE, 0x67BA)
+DOUBLE_BYTE_PAIR(0xCF40, 0x67DC)
+DOUBLE_BYTE_PAIR(0xCF41, 0x67BB)
+DOUBLE_BYTE_PAIR(0xCF42, 0x67F8)
+DOUBLE_BYTE_PAIR(0xCF43, 0x67D8)
+DOUBLE_BYTE_PAIR(0xCF44, 0x67C0)
+DOUBLE_BYTE_PAIR(0xCF45, 0x67B7)
+DOUBLE_BYTE_PAIR(0xCF46, 0x67C5)
+DOUBLE_BYTE_PAIR(0xCF47, 0x67EB)
+DOUBLE_BYTE_PAIR(0xCF48, 0x67E4)
+DOUBLE_BYTE_PAIR(0xCF49, 0x67DF)
+DOUBLE_BYTE_PAIR(0xCF4A, 0x67B5)
+DOUBLE_BYTE_PAIR(0xCF4B, 0x67CD)
+DOUBLE_BYTE_PAIR(0xCF4C, 0x67B3)
+DOUBLE_BYTE_PAIR(0xCF4D, 0x67F7)
+DOUBLE_BYTE_PAIR(0xCF4E, 0x67F6)
+DOUBLE_BYTE_PAIR(0xCF4F, 0x67EE)
+DOUBLE_BYTE_PAIR(0xCF50, 0x67E3)
+DOUBLE_BYTE_PAIR(0xCF51, 0x67C2)
+DOUBLE_BYTE_PAIR(0xCF52, 0x67B9)
+DOUBLE_BYTE_PAIR(0xCF53, 0x67CE)
+DOUBLE_BYTE_PAIR(0xCF54, 0x67E7)
+DOUBLE_BYTE_PAIR(0xCF55, 0x67F0)
+DOUBLE_BYTE_PAIR(0xCF56, 0x67B2)
+DOUBLE_BYTE_PAIR(0xCF57, 0x67FC)
+DOUBLE_BYTE_PAIR(0xCF58, 0x67C6)
+DOUBLE_BYTE_PAIR(0xCF59, 0x67ED)
+DOUBLE_BYTE_PAIR(0xCF5A, 0x67CC)
+DOUBLE_BYTE_PAIR(0xCF5B, 0x67AE)
+DOUBLE_BYTE_PAIR(0xCF5C, 0x67E6)
+DOUBLE_BYTE_PAIR(0xCF5D, 0x67DB)
+DOUBLE_BYTE_PAIR(0xCF5E, 0x67FA)
+DOUBLE_BYTE_PAIR(0xCF5F, 0x67C9)
+DOUBLE_BYTE_PAIR(0xCF60, 0x67CA)
+DOUBLE_BYTE_PAIR(0xCF61, 0x67C3)
+DOUBLE_BYTE_PAIR(0xCF62, 0x67EA)
+DOUBLE_BYTE_PAIR(0xCF63, 0x67CB)
+DOUBLE_BYTE_PAIR(0xCF64, 0x6B28)
+DOUBLE_BYTE_PAIR(0xCF65, 0x6B82)
+DOUBLE_BYTE_PAIR(0xCF66, 0x6B84)
+DOUBLE_BYTE_PAIR(0xCF67, 0x6BB6)
+DOUBLE_BYTE_PAIR(0xCF68, 0x6BD6)
+DOUBLE_BYTE_PAIR(0xCF69, 0x6BD8)
+DOUBLE_BYTE_PAIR(0xCF6A, 0x6BE0)
+DOUBLE_BYTE_PAIR(0xCF6B, 0x6C20)
+DOUBLE_BYTE_PAIR(0xCF6C, 0x6C21)
+DOUBLE_BYTE_PAIR(0xCF6D, 0x6D28)
+DOUBLE_BYTE_PAIR(0xCF6E, 0x6D34)
+DOUBLE_BYTE_PAIR(0xCF6F, 0x6D2D)
+DOUBLE_BYTE_PAIR(0xCF70, 0x6D1F)
+DOUBLE_BYTE_PAIR(0xCF71, 0x6D3C)
+DOUBLE_BYTE_PAIR(0xCF72, 0x6D3F)
+DOUBLE_BYTE_PAIR(0xCF73, 0x6D12)
+DOUBLE_BYTE_PAIR(0xCF74, 0x6D0A)
+DOUBLE_BYTE_PAIR(0xCF75, 0x6CDA)
+DOUBLE_BYTE_PAIR(0xCF76, 0x6D33)
+DOUBLE_BYTE_PAIR(0xCF77, 0x6D04)
+DOUBLE_BYTE_PAIR(0xCF78, 0x6D19)
+DOUBLE_BYTE_PAIR(0xCF79, 0x6D3A)
+DOUBLE_BYTE_PAIR(0xCF7A, 0x6D1A)
+DOUBLE_BYTE_PAIR(0xCF7B, 0x6D11)
+DOUBLE_BYTE_PAIR(0xCF7C, 0x6D00)
+DOUBLE_BYTE_PAIR(0xCF7D, 0x6D1D)
+DOUBLE_BYTE_PAIR(0xCF7E, 0x6D42)
+DOUBLE_BYTE_PAIR(0xCFA1, 0x6D01)
+DOUBLE_BYTE_PAIR(0xCFA2, 0x6D18)
+DOUBLE_BYTE_PAIR(0xCFA3, 0x6D37)
+DOUBLE_BYTE_PAIR(0xCFA4, 0x6D03)
+DOUBLE_BYTE_PAIR(0xCFA5, 0x6D0F)
+DOUBLE_BYTE_PAIR(0xCFA6, 0x6D40)
+DOUBLE_BYTE_PAIR(0xCFA7, 0x6D07)
+DOUBLE_BYTE_PAIR(0xCFA8, 0x6D20)
+DOUBLE_BYTE_PAIR(0xCFA9, 0x6D2C)
+DOUBLE_BYTE_PAIR(0xCFAA, 0x6D08)
+DOUBLE_BYTE_PAIR(0xCFAB, 0x6D22)
+DOUBLE_BYTE_PAIR(0xCFAC, 0x6D09)
+DOUBLE_BYTE_PAIR(0xCFAD, 0x6D10)
+DOUBLE_BYTE_PAIR(0xCFAE, 0x70B7)
+DOUBLE_BYTE_PAIR(0xCFAF, 0x709F)
+DOUBLE_BYTE_PAIR(0xCFB0, 0x70BE)
+DOUBLE_BYTE_PAIR(0xCFB1, 0x70B1)
+DOUBLE_BYTE_PAIR(0xCFB2, 0x70B0)
+DOUBLE_BYTE_PAIR(0xCFB3, 0x70A1)
+DOUBLE_BYTE_PAIR(0xCFB4, 0x70B4)
+DOUBLE_BYTE_PAIR(0xCFB5, 0x70B5)
+DOUBLE_BYTE_PAIR(0xCFB6, 0x70A9)
+DOUBLE_BYTE_PAIR(0xCFB7, 0x7241)
+DOUBLE_BYTE_PAIR(0xCFB8, 0x7249)
+DOUBLE_BYTE_PAIR(0xCFB9, 0x724A)
+DOUBLE_BYTE_PAIR(0xCFBA, 0x726C)
+DOUBLE_BYTE_PAIR(0xCFBB, 0x7270)
+DOUBLE_BYTE_PAIR(0xCFBC, 0x7273)
+DOUBLE_BYTE_PAIR(0xCFBD, 0x726E)
+DOUBLE_BYTE_PAIR(0xCFBE, 0x72CA)
+DOUBLE_BYTE_PAIR(0xCFBF, 0x72E4)
+DOUBLE_BYTE_PAIR(0xCFC0, 0x72E8)
+DOUBLE_BYTE_PAIR(0xCFC1, 0x72EB)
+DOUBLE_BYTE_PAIR(0xCFC2, 0x72DF)
+DOUBLE_BYTE_PAIR(0xCFC3, 0x72EA)
+DOUBLE_BYTE_PAIR(0xCFC4, 0x72E6)
+DOUBLE_BYTE_PAIR(0xCFC5, 0x72E3)
+DOUBLE_BYTE_PAIR(0xCFC6, 0x7385)
+DOUBLE_BYTE_PAIR(0xCFC7, 0x73CC)
+DOUBLE_BYTE_PAIR(0xCFC8, 0x73C2)
+DOUBLE_BYTE_PAIR(0xCFC9, 0x73C8)
+DOUBLE_BYTE_PAIR(0xCFCA, 0x73C5)
+DOUBLE_BYTE_PAIR(0xCFCB, 0x73B9)
+DOUBLE_BYTE_PAIR(0xCFCC, 0x73B6)
+DOUBLE_BYTE_PAIR(0xCFCD, 0x73B5)
+DOUBLE_BYTE_PAIR(0xCFCE, 0x73B4)
+DOUBLE_BYTE_PAIR(0xCFCF, 0x73EB)
+DOUBLE_BYTE_PAIR(0xCFD0, 0x73BF)
+DOUBLE_BYTE_PAIR(0xCFD1, 0x73C7)
+DOUBLE_BYTE_PAIR(0xCFD2, 0x73BE)
+DOUBLE_BYTE_PAIR(0xCFD3, 0x73C3)
+DOUBLE_BYTE_PAIR(0xCFD4, 0x73C6)
+DOUBLE_BYTE_PAIR(0xCFD5, 0x73B8)
+DOUBLE_BYTE_PAIR(0xCFD6, 0x73CB)
+DOUBLE_BYTE_PAIR(0xCFD7, 0x74EC)
+DOUBLE_BYTE_PAIR(0xCFD8, 0x74EE)
+DOUBLE_BYTE_PAIR(0xCFD9, 0x752E)
+DOUBLE_BYTE_PAIR(0xCFDA, 0x7547)
+DOUBLE_BYTE_PAIR(0xCFDB, 0x7548)
+DOUBLE_BYTE_PAIR(0xCFDC, 0x75A7)
+DOUBLE_BYTE_PAIR(0xCFDD, 0x75AA)
+DOUBLE_BYTE_PAIR(0xCFDE, 0x7679)
+DOUBLE_BYTE_PAIR(0xCFDF, 0x76C4)
+DOUBLE_BYTE_PAIR(0xCFE0, 0x7708)
+DOUBLE_BYTE_PAIR(0xCFE1, 0x7703)
+DOUBLE_BYTE_PAIR(0xCFE2, 0x7704)
+DOUBLE_BYTE_PAIR(0xCFE3, 0x7705)
+DOUBLE_BYTE_PAIR(0xCFE4, 0x770A)
+DOUBLE_BYTE_PAIR(0xCFE5, 0x76F7)
+DOUBLE_BYTE_PAIR(0xCFE6, 0x76FB)
+DOUBLE_BYTE_PAIR(0xCFE7, 0x76FA)
+DOUBLE_BYTE_PAIR(0xCFE8, 0x77E7)
+DOUBLE_BYTE_PAIR(0xCFE9, 0x77E8)
+DOUBLE_BYTE_PAIR(0xCFEA, 0x7806)
+DOUBLE_BYTE_PAIR(0xCFEB, 0x7811)
+DOUBLE_BYTE_PAIR(0xCFEC, 0x7812)
+DOUBLE_BYTE_PAIR(0xCFED, 0x7805)
+DOUBLE_BYTE_PAIR(0xCFEE, 0x7810)
+DOUBLE_BYTE_PAIR(0xCFEF, 0x780F)
+DOUBLE_BYTE_PAIR(0xCFF0, 0x780E)
+DOUBLE_BYTE_PAIR(0xCFF1, 0x7809)
+DOUBLE_BYTE_PAIR(0xCFF2, 0x7803)
+DOUBLE_BYTE_PAIR(0xCFF3, 0x7813)
+DOUBLE_BYTE_PAIR(0xCFF4, 0x794A)
+DOUBLE_BYTE_PAIR(0xCFF5, 0x794C)
+DOUBLE_BYTE_PAIR(0xCFF6, 0x794B)
+DOUBLE_BYTE_PAIR(0xCFF7, 0x7945)
+DOUBLE_BYTE_PAIR(0xCFF8, 0x7944)
+DOUBLE_BYTE_PAIR(0xCFF9, 0x79D5)
+DOUBLE_BYTE_PAIR(0xCFFA, 0x79CD)
+DOUBLE_BYTE_PAIR(0xCFFB, 0x79CF)
+DOUBLE_BYTE_PAIR(0xCFFC, 0x79D6)
+DOUBLE_BYTE_PAIR(0xCFFD, 0x79CE)
+DOUBLE_BYTE_PAIR(0xCFFE, 0x7A80)
+DOUBLE_BYTE_PAIR(0xD040, 0x7A7E)
+DOUBLE_BYTE_PAIR(0xD041, 0x7AD1)
+DOUBLE_BYTE_PAIR(0xD042, 0x7B00)
+DOUBLE_BYTE_PAIR(0xD043, 0x7B01)
+DOUBLE_BYTE_PAIR(0xD044, 0x7C7A)
+DOUBLE_BYTE_PAIR(0xD045, 0x7C78)
+DOUBLE_BYTE_PAIR(0xD046, 0x7C79)
+DOUBLE_BYTE_PAIR(0xD047, 0x7C7F)
+DOUBLE_BYTE_PAIR(0xD048, 0x7C80)
+DOUBLE_BYTE_PAIR(0xD049, 0x7C81)
+DOUBLE_BYTE_PAIR(0xD04A, 0x7D03)
+DOUBLE_BYTE_PAIR(0xD04B, 0x7D08)
+DOUBLE_BYTE_PAIR(0xD04C, 0x7D01)
+DOUBLE_BYTE_PAIR(0xD04D, 0x7F58)
+DOUBLE_BYTE_PAIR(0xD04E, 0x7F91)
+DOUBLE_BYTE_PAIR(0xD04F, 0x7F8D)
+DOUBLE_BYTE_PAIR(0xD050, 0x7FBE)
+DOUBLE_BYTE_PAIR(0xD051, 0x8007)
+DOUBLE_BYTE_PAIR(0xD052, 0x800E)
+DOUBLE_BYTE_PAIR(0xD053, 0x800F)
+DOUBLE_BYTE_PAIR(0xD054, 0x8014)
+DOUBLE_BYTE_PAIR(0xD055, 0x8037)
+DOUBLE_BYTE_PAIR(0xD056, 0x80D8)
+DOUBLE_BYTE_PAIR(0xD057, 0x80C7)
+DOUBLE_BYTE_PAIR(0xD058, 0x80E0)
+DOUBLE_BYTE_PAIR(0xD059, 0x80D1)
+DOUBLE_BYTE_PAIR(0xD05A, 0x80C8)
+DOUBLE_BYTE_PAIR(0xD05B, 0x80C2)
+DOUBLE_BYTE_PAIR(0xD05C, 0x80D0)
+DOUBLE_BYTE_PAIR(0xD05D, 0x80C5)
+DOUBLE_BYTE_PAIR(0xD05E, 0x80E3)
+DOUBLE_BYTE_PAIR(0xD05F, 0x80D9)
+DOUBLE_BYTE_PAIR(0xD060, 0x80DC)
+DOUBLE_BYTE_PAIR(0xD061, 0x80CA)
+DOUBLE_BYTE_PAIR(0xD062, 0x80D5)
+DOUBLE_BYTE_PAIR(0xD063, 0x80C9)
+DOUBLE_BYTE_PAIR(0xD064, 0x80CF)
+DOUBLE_BYTE_PAIR(0xD065, 0x80D7)
+DOUBLE_BYTE_PAIR(0xD066, 0x80E6)
+DOUBLE_BYTE_PAIR(0xD067, 0x80CD)
+DOUBLE_BYTE_PAIR(0xD068, 0x81FF)
+DOUBLE_BYTE_PAIR(0xD069, 0x8221)
+DOUBLE_BYTE_PAIR(0xD06A, 0x8294)
+DOUBLE_BYTE_PAIR(0xD06B, 0x82D9)
+DOUBLE_BYTE_PAIR(0xD06C, 0x82FE)
+DOUBLE_BYTE_PAIR(0xD06D, 0x82F9)
+DOUBLE_BYTE_PAIR(0xD06E, 0x8307)
+DOUBLE_BYTE_PAIR(0xD06F, 0x82E8)
+DOUBLE_BYTE_PAIR(0xD070, 0x8300)
+DOUBLE_BYTE_PAIR(0xD071, 0x82D5)
+DOUBLE_BYTE_PAIR(0xD072, 0x833A)
+DOUBLE_BYTE_PAIR(0xD073, 0x82EB)
+DOUBLE_BYTE_PAIR(0xD074, 0x82D6)
+DOUBLE_BYTE_PAIR(0xD075, 0x82F4)
+DOUBLE_BYTE_PAIR(0xD076, 0x82EC)
+DOUBLE_BYTE_PAIR(0xD077, 0x82E1)
+DOUBLE_BYTE_PAIR(0xD078, 0x82F2)
+DOUBLE_BYTE_PAIR(0xD079, 0x82F5)
+DOUBLE_BYTE_PAIR(0xD07A, 0x830C)
+DOUBLE_BYTE_PAIR(0xD07B, 0x82FB)
+DOUBLE_BYTE_PAIR(0xD07C, 0x82F6)
+DOUBLE_BYTE_PAIR(0xD07D, 0x82F0)
+DOUBLE_BYTE_PAIR(0xD07E, 0x82EA)
+DOUBLE_BYTE_PAIR(0xD0A1, 0x82E4)
+DOUBLE_BYTE_PAIR(0xD0A2, 0x82E0)
+DOUBLE_BYTE_PAIR(0xD0A3, 0x82FA)
+DOUBLE_BYTE_PAIR(0xD0A4, 0x82F3)
+DOUBLE_BYTE_PAIR(0xD0A5, 0x82ED)
+DOUBLE_BYTE_PAIR(0xD0A6, 0x8677)
+DOUBLE_BYTE_PAIR(0xD0A7, 0x8674)
+DOUBLE_BYTE_PAIR(0xD0A8, 0x867C)
+DOUBLE_BYTE_PAIR(0xD0A9, 0x8673)
+DOUBLE_BYTE_PAIR(0xD0AA, 0x8841)
+DOUBLE_BYTE_PAIR(0xD0AB, 0x884E)
+DOUBLE_BYTE_PAIR(0xD0AC, 0x8867)
+DOUBLE_BYTE_PAIR(0xD0AD, 0x886A)
+DOUBLE_BYTE_PAIR(0xD0AE, 0x8869)
+DOUBLE_BYTE_PAIR(0xD0AF, 0x89D3)
+DOUBLE_BYTE_PAIR(0xD0B0, 0x8A04)
+DOUBLE_BYTE_PAIR(0xD0B1, 0x8A07)
+DOUBLE_BYTE_PAIR(0xD0B2, 0x8D72)
+DOUBLE_BYTE_PAIR(0xD0B3, 0x8FE3)
+DOUBLE_BYTE_PAIR(0xD0B4, 0x8FE1)
+DOUBLE_BYTE_PAIR(0xD0B5, 0x8FEE)
+DOUBLE_BYTE_PAIR(0xD0B6, 0x8FE0)
+DOUBLE_BYTE_PAIR(0xD0B7, 0x90F1)
+DOUBLE_BYTE_PAIR(0xD0B8, 0x90BD)
+DOUBLE_BYTE_PAIR(0xD0B9, 0x90BF)
+DOUBLE_BYTE_PAIR(0xD0BA, 0x90D5)
+DOUBLE_BYTE_PAIR(0xD0BB, 0x90C5)
+DOUBLE_BYTE_PAIR(0xD0BC, 0x90BE)
+DOUBLE_BYTE_PAIR(0xD0BD, 0x90C7)
+DOUBLE_BYTE_PAIR(0xD0BE, 0x90CB)
+DOUBLE_BYTE_PAIR(0xD0BF, 0x90C8)
+DOUBLE_BYTE_PAIR(0xD0C0, 0x91D4)
+DOUBLE_BYTE_PAIR(0xD0C1, 0x91D3)
+DOUBLE_BYTE_PAIR(0xD0C2, 0x9654)
+DOUBLE_BYTE_PAIR(0xD0C3, 0x964F)
+DOUBLE_BYTE_PAIR(0xD0C4, 0x9651)
+DOUBLE_BYTE_PAIR(0xD0C5, 0x9653)
+DOUBLE_BYTE_PAIR(0xD0C6, 0x964A)
+DOUBLE_BYTE_PAIR(0xD0C7, 0x964E)
+DOUBLE_BYTE_PAIR(0xD0C8, 0x501E)
+DOUBLE_BYTE_PAIR(0xD0C9, 0x5005)
+DOUBLE_BYTE_PAIR(0xD0CA, 0x5007)
+DOUBLE_BYTE_PAIR(0xD0CB, 0x5013)
+DOUBLE_BYTE_PAIR(0xD0CC, 0x5022)
+DOUBLE_BYTE_PAIR(0xD0CD, 0x5030)
+DOUBLE_BYTE_PAIR(0xD0CE, 0x501B)
+DOUBLE_BYTE_PAIR(0xD0CF, 0x4FF5)
+DOUBLE_BYTE_PAIR(0xD0D0, 0x4FF4)
+DOUBLE_BYTE_PAIR(0xD0D1, 0x5033)
+DOUBLE_BYTE_PAIR(0xD0D2, 0x5037)
+DOUBLE_BYTE_PAIR(0xD0D3, 0x502C)
+DOUBLE_BYTE_PAIR(0xD0D4, 0x4FF6)
+DOUBLE_BYTE_PAIR(0xD0D5, 0x4FF7)
+DOUBLE_BYTE_PAIR(0xD0D6, 0x5017)
+DOUBLE_BYTE_PAIR(0xD0D7, 0x501C)
+DOUBLE_BYTE_PAIR(0xD0D8, 0x5020)
+DOUBLE_BYTE_PAIR(0xD0D9, 0x5027)
+DOUBLE_BYTE_PAIR(0xD0DA, 0x5035)
+DOUBLE_BYTE_PAIR(0xD0DB, 0x502F)
+DOUBLE_BYTE_PAIR(0xD0DC, 0x5031)
+DOUBLE_BYTE_PAIR(0xD0DD, 0x500E)
+DOUBLE_BYTE_PAIR(0xD0DE, 0x515A)
+DOUBLE_BYTE_PAIR(0xD0DF, 0x5194)
+DOUBLE_BYTE_PAIR(0xD0E0, 0x5193)
+DOUBLE_BYTE_PAIR(0xD0E1, 0x51CA)
+DOUBLE_BYTE_PAIR(0xD0E2, 0x51C4)
+DOUBLE_BYTE_PAIR(0xD0E3, 0x51C5)
+DOUBLE_BYTE_PAIR(0xD0E4, 0x51C8)
+DOUBLE_BYTE_PAIR(0xD0E5, 0x51CE)
+DOUBLE_BYTE_PAIR(0xD0E6, 0x5261)
+DOUBLE_BYTE_PAIR(0xD0E7, 0x525A)
+DOUBLE_BYTE_PAIR(0xD0E8, 0x5252)
+DOUBLE_BYTE_PAIR(0xD0E9, 0x525E)
+DOUBLE_BYTE_PAIR(0xD0EA, 0x525F)
+DOUBLE_BYTE_PAIR(0xD0EB, 0x5255)
+DOUBLE_BYTE_PAIR(0xD0EC, 0x5262)
+DOUBLE_BYTE_PAIR(0xD0ED, 0x52CD)
+DOUBLE_BYTE_PAIR(0xD0EE, 0x530E)
+DOUBLE_BYTE_PAIR(0xD0EF, 0x539E)
+DOUBLE_BYTE_PAIR(0xD0F0, 0x5526)
+DOUBLE_BYTE_PAIR(0xD0F1, 0x54E2)
+DOUBLE_BYTE_PAIR(0xD0F2, 0x5517)
+DOUBLE_BYTE_PAIR(0xD0F3, 0x5512)
+DOUBLE_BYTE_PAIR(0xD0F4, 0x54E7)
+DOUBLE_BYTE_PAIR(0xD0F5, 0x54F3)
+DOUBLE_BYTE_PAIR(0xD0F6, 0x54E4)
+DOUBLE_BYTE_PAIR(0xD0F7, 0x551A)
+DOUBLE_BYTE_PAIR(0xD0F8, 0x54FF)
+DOUBLE_BYTE_PAIR(0xD0F9, 0x5504)
+DOUBLE_BYTE_PAIR(0xD0FA, 0x5508)
+DOUBLE_BYTE_PAIR(0xD0FB, 0x54EB)
+DOUBLE_BYTE_PAIR(0xD0FC, 0x5511)
+DOUBLE_BYTE_PAIR(0xD0FD, 0x5505)
+DOUBLE_BYTE_PAIR(0xD0FE, 0x54F1)
+DOUBLE_BYTE_PAIR(0xD140, 0x550A)
+DOUBLE_BYTE_PAIR(0xD141, 0x54FB)
+DOUBLE_BYTE_PAIR(0xD142, 0x54F7)
+DOUBLE_BYTE_PAIR(0xD143, 0x54F8)
+DOUBLE_BYTE_PAIR(0xD144, 0x54E0)
+DOUBLE_BYTE_PAIR(0xD145, 0x550E)
+DOUBLE_BYTE_PAIR(0xD146, 0x5503)
+DOUBLE_BYTE_PAIR(0xD147, 0x550B)
+DOUBLE_BYTE_PAIR(0xD148, 0x5701)
+DOUBLE_BYTE_PAIR(0xD149, 0x5702)
+DOUBLE_BYTE_PAIR(0xD14A, 0x57CC)
+DOUBLE_BYTE_PAIR(0xD14B, 0x5832)
+DOUBLE_BYTE_PAIR(0xD14C, 0x57D5)
+DOUBLE_BYTE_PAIR(0xD14D, 0x57D2)
+DOUBLE_BYTE_PAIR(0xD14E, 0x57BA)
+DOUBLE_BYTE_PAIR(0xD14F, 0x57C6)
+DOUBLE_BYTE_PAIR(0xD150, 0x57BD)
+DOUBLE_BYTE_PAIR(0xD151, 0x57BC)
+DOUBLE_BYTE_PAIR(0xD152, 0x57B8)
+DOUBLE_BYTE_PAIR(0xD153, 0x57B6)
+DOUBLE_BYTE_PAIR(0xD154, 0x57BF)
+DOUBLE_BYTE_PAIR(0xD155, 0x57C7)
+DOUBLE_BYTE_PAIR(0xD156, 0x57D0)
+DOUBLE_BYTE_PAIR(0xD157, 0x57B9)
+DOUBLE_BYTE_PAIR(0xD158, 0x57C1)
+DOUBLE_BYTE_PAIR(0xD159, 0x590E)
+DOUBLE_BYTE_PAIR(0xD15A, 0x594A)
+DOUBLE_BYTE_PAIR(0xD15B, 0x5A19)
+DOUBLE_BYTE_PAIR(0xD15C, 0x5A16)
+DOUBLE_BYTE_PAIR(0xD15D, 0x5A2D)
+DOUBLE_BYTE_PAIR(0xD15E, 0x5A2E)
+DOUBLE_BYTE_PAIR(0xD15F, 0x5A15)
+DOUBLE_BYTE_PAIR(0xD160, 0x5A0F)
+DOUBLE_BYTE_PAIR(0xD161, 0x5A17)
+DOUBLE_BYTE_PAIR(0xD162, 0x5A0A)
+DOUBLE_BYTE_PAIR(0xD163, 0x5A1E)
+DOUBLE_BYTE_PAIR(0xD164, 0x5A33)
+DOUBLE_BYTE_PAIR(0xD165, 0x5B6C)
+DOUBLE_BYTE_PAIR(0xD166, 0x5BA7)
+DOUBLE_BYTE_PAIR(0xD167, 0x5BAD)
+DOUBLE_BYTE_PAIR(0xD168, 0x5BAC)
+DOUBLE_BYTE_PAIR(0xD169, 0x5C03)
+DOUBLE_BYTE_PAIR(0xD16A, 0x5C56)
+DOUBLE_BYTE_PAIR(0xD16B, 0x5C54)
+DOUBLE_BYTE_PAIR(0xD16C, 0x5CEC)
+DOUBLE_BYTE_PAIR(0xD16D, 0x5CFF)
+DOUBLE_BYTE_PAIR(0xD16E, 0x5CEE)
+DOUBLE_BYTE_PAIR(0xD16F, 0x5CF1)
+DOUBLE_BYTE_PAIR(0xD170, 0x5CF7)
+DOUBLE_BYTE_PAIR(0xD171, 0x5D00)
+DOUBLE_BYTE_PAIR(0xD172, 0x5CF9)
+DOUBLE_BYTE_PAIR(0xD173, 0x5E29)
+DOUBLE_BYTE_PAIR(0xD174, 0x5E28)
+DOUBLE_BYTE_PAIR(0xD175, 0x5EA8)
+DOUBLE_BYTE_PAIR(0xD176, 0x5EAE)
+DOUBLE_BYTE_PAIR(0xD177, 0x5EAA)
+DOUBLE_BYTE_PAIR(0xD178, 0x5EAC)
+DOUBLE_BYTE_PAIR(0xD179, 0x5F33)
+DOUBLE_BYTE_PAIR(0xD17A, 0x5F30)
+DOUBLE_BYTE_PAIR(0xD17B, 0x5F67)
+DOUBLE_BYTE_PAIR(0xD17C, 0x605D)
+DOUBLE_BYTE_PAIR(0xD17D, 0x605A)
+DOUBLE_BYTE_PAIR(0xD17E, 0x6067)
+DOUBLE_BYTE_PAIR(0xD1A1, 0x6041)
+DOUBLE_BYTE_PAIR(0xD1A2, 0x60A2)
+DOUBLE_BYTE_PAIR(0xD1A3, 0x6088)
+DOUBLE_BYTE_PAIR(0xD1A4, 0x6080)
+DOUBLE_BYTE_PAIR(0xD1A5, 0x6092)
+DOUBLE_BYTE_PAIR(0xD1A6, 0x6081)
+DOUBLE_BYTE_PAIR(0xD1A7, 0x609D)
+DOUBLE_BYTE_PAIR(0xD1A8, 0x6083)
+DOUBLE_BYTE_PAIR(0xD1A9, 0x6095)
+DOUBLE_BYTE_PAIR(0xD1AA, 0x609B)
+DOUBLE_BYTE_PAIR(0xD1AB, 0x6097)
+DOUBLE_BYTE_PAIR(0xD1AC, 0x6087)
+DOUBLE_BYTE_PAIR(0xD1AD, 0x609C)
+DOUBLE_BYTE_PAIR(0xD1AE, 0x608E)
+DOUBLE_BYTE_PAIR(0xD1AF, 0x6219)
+DOUBLE_BYTE_PAIR(0xD1B0, 0x6246)
+DOUBLE_BYTE_PAIR(0xD1B1, 0x62F2)
+DOUBLE_BYTE_PAIR(0xD1B2, 0x6310)
+DOUBLE_BYTE_PAIR(0xD1B3, 0x6356)
+DOUBLE_BYTE_PAIR(0xD1B4, 0x632C)
+DOUBLE_BYTE_PAIR(0xD1B5, 0x6344)
+DOUBLE_BYTE_PAIR(0xD1B6, 0x6345)
+DOUBLE_BYTE_PAIR(0xD1B7, 0x6336)
+DOUBLE_BYTE_PAIR(0xD1B8, 0x6343)
+DOUBLE_BYTE_PAIR(0xD1B9, 0x63E4)
+DOUBLE_BYTE_PAIR(0xD1BA, 0x6339)
+DOUBLE_BYTE_PAIR(0xD1BB, 0x634B)
+DOUBLE_BYTE_PAIR(0xD1BC, 0x634A)
+DOUBLE_BYTE_PAIR(0xD1BD, 0x633C)
+DOUBLE_BYTE_PAIR(0xD1BE, 0x6329)
+DOUBLE_BYTE_PAIR(0xD1BF, 0x6341)
+DOUBLE_BYTE_PAIR(0xD1C0, 0x6334)
+DOUBLE_BYTE_PAIR(0xD1C1, 0x6358)
+DOUBLE_BYTE_PAIR(0xD1C2, 0x6354)
+DOUBLE_BYTE_PAIR(0xD1C3, 0x6359)
+DOUBLE_BYTE_PAIR(0xD1C4, 0x632D)
+DOUBLE_BYTE_PAIR(0xD1C5, 0x6347)
+DOUBLE_BYTE_PAIR(0xD1C6, 0x6333)
+DOUBLE_BYTE_PAIR(0xD1C7, 0x635A)
+DOUBLE_BYTE_PAIR(0xD1C8, 0x6351)
+DOUBLE_BYTE_PAIR(0xD1C9, 0x6338)
+DOUBLE_BYTE_PAIR(0xD1CA, 0x6357)
+DOUBLE_BYTE_PAIR(0xD1CB, 0x6340)
+DOUBLE_BYTE_PAIR(0xD1CC, 0x6348)
+DOUBLE_BYTE_PAIR(0xD1CD, 0x654A)
+DOUBLE_BYTE_PAIR(0xD1CE, 0x6546)
+DOUBLE_BYTE_PAIR(0xD1CF, 0x65C6)
+DOUBLE_BYTE_PAIR(0xD1D0, 0x65C3)
+DOUBLE_BYTE_PAIR(0xD1D1, 0x65C4)
+DOUBLE_BYTE_PAIR(0xD1D2, 0x65C2)
+DOUBLE_BYTE_PAIR(0xD1D3, 0x664A)
+DOUBLE_BYTE_PAIR(0xD1D4, 0x665F)
+DOUBLE_BYTE_PAIR(0xD1D5, 0x6647)
+DOUBLE_BYTE_PAIR(0xD1D6, 0x6651)
+DOUBLE_BYTE_PAIR(0xD1D7, 0x6712)
+DOUBLE_BYTE_PAIR(0xD1D8, 0x6713)
+DOUBLE_BYTE_PAIR(0xD1D9, 0x681F)
+DOUBLE_BYTE_PAIR(0xD1DA, 0x681A)
+DOUBLE_BYTE_PAIR(0xD1DB, 0x6849)
+DOUBLE_BYTE_PAIR(0xD1DC, 0x6832)
+DOUBLE_BYTE_PAIR(0xD1DD, 0x6833)
+DOUBLE_BYTE_PAIR(0xD1DE, 0x683B)
+DOUBLE_BYTE_PAIR(0xD1DF, 0x684B)
+DOUBLE_BYTE_PAIR(0xD1E0, 0x684F)
+DOUBLE_BYTE_PAIR(0xD1E1, 0x6816)
+DOUBLE_BYTE_PAIR(0xD1E2, 0x6831)
+DOUBLE_BYTE_PAIR(0xD1E3, 0x681C)
+DOUBLE_BYTE_PAIR(0xD1E4, 0x6835)
+DOUBLE_BYTE_PAIR(0xD1E5, 0x682B)
+DOUBLE_BYTE_PAIR(0xD1E6, 0x682D)
+DOUBLE_BYTE_PAIR(0xD1E7, 0x682F)
+DOUBLE_BYTE_PAIR(0xD1E8, 0x684E)
+DOUBLE_BYTE_PAIR(0xD1E9, 0x6844)
+DOUBLE_BYTE_PAIR(0xD1EA, 0x6834)
+DOUBLE_BYTE_PAIR(0xD1EB, 0x681D)
+DOUBLE_BYTE_PAIR(0xD1EC, 0x6812)
+DOUBLE_BYTE_PAIR(0xD1ED, 0x6814)
+DOUBLE_BYTE_PAIR(0xD1EE, 0x6826)
+DOUBLE_BYTE_PAIR(0xD1EF, 0x6828)
+DOUBLE_BYTE_PAIR(0xD1F0, 0x682E)
+DOUBLE_BYTE_PAIR(0xD1F1, 0x684D)
+DOUBLE_BYTE_PAIR(0xD1F2, 0x683A)
+DOUBLE_BYTE_PAIR(0xD1F3, 0x6825)
+DOUBLE_BYTE_PAIR(0xD1F4, 0x6820)
+DOUBLE_BYTE_PAIR(0xD1F5, 0x6B2C)
+DOUBLE_BYTE_PAIR(0xD1F6, 0x6B2F)
+DOUBLE_BYTE_PAIR(0xD1F7, 0x6B2D)
+DOUBLE_BYTE_PAIR(0xD1F8, 0x6B31)
+DOUBLE_BYTE_PAIR(0xD1F9, 0x6B34)
+DOUBLE_BYTE_PAIR(0xD1FA, 0x6B6D)
+DOUBLE_BYTE_PAIR(0xD1FB, 0x8082)
+DOUBLE_BYTE_PAIR(0xD1FC, 0x6B88)
+DOUBLE_BYTE_PAIR(0xD1FD, 0x6BE6)
+DOUBLE_BYTE_PAIR(0xD1FE, 0x6BE4)
+DOUBLE_BYTE_PAIR(0xD240, 0x6BE8)
+DOUBLE_BYTE_PAIR(0xD241, 0x6BE3)
+DOUBLE_BYTE_PAIR(0xD242, 0x6BE2)
+DOUBLE_BYTE_PAIR(0xD243, 0x6BE7)
+DOUBLE_BYTE_PAIR(0xD244, 0x6C25)
+DOUBLE_BYTE_PAIR(0xD245, 0x6D7A)
+DOUBLE_BYTE_PAIR(0xD246, 0x6D63)
+DOUBLE_BYTE_PAIR(0xD247, 0x6D64)
+DOUBLE_BYTE_PAIR(0xD248, 0x6D76)
+DOUBLE_BYTE_PAIR(0xD249, 0x6D0D)
+DOUBLE_BYTE_PAIR(0xD24A, 0x6D61)
+DOUBLE_BYTE_PAIR(0xD24B, 0x6D92)
+DOUBLE_BYTE_PAIR(0xD24C, 0x6D58)
+DOUBLE_BYTE_PAIR(0xD24D, 0x6D62)
+DOUBLE_BYTE_PAIR(0xD24E, 0x6D6D)
+DOUBLE_BYTE_PAIR(0xD24F, 0x6D6F)
+DOUBLE_BYTE_PAIR(0xD250, 0x6D91)
+DOUBLE_BYTE_PAIR(0xD251, 0x6D8D)
+DOUBLE_BYTE_PAIR(0xD252, 0x6DEF)
+DOUBLE_BYTE_PAIR(0xD253, 0x6D7F)
+DOUBLE_BYTE_PAIR(0xD254, 0x6D86)
+DOUBLE_BYTE_PAIR(0xD255, 0x6D5E)
+DOUBLE_BYTE_PAIR(0xD256, 0x6D67)
+DOUBLE_BYTE_PAIR(0xD257, 0x6D60)
+DOUBLE_BYTE_PAIR(0xD258, 0x6D97)
+DOUBLE_BYTE_PAIR(0xD259, 0x6D70)
+DOUBLE_BYTE_PAIR(0xD25A, 0x6D7C)
+DOUBLE_BYTE_PAIR(0xD25B, 0x6D5F)
+DOUBLE_BYTE_PAIR(0xD25C, 0x6D82)
+DOUBLE_BYTE_PAIR(0xD25D, 0x6D98)
+DOUBLE_BYTE_PAIR(0xD25E, 0x6D2F)
+DOUBLE_BYTE_PAIR(0xD25F, 0x6D68)
+DOUBLE_BYTE_PAIR(0xD260, 0x6D8B)
+DOUBLE_BYTE_PAIR(0xD261, 0x6D7E)
+DOUBLE_BYTE_PAIR(0xD262, 0x6D80)
+DOUBLE_BYTE_PAIR(0xD263, 0x6D84)
+DOUBLE_BYTE_PAIR(0xD264, 0x6D16)
+DOUBLE_BYTE_PAIR(0xD265, 0x6D83)
+DOUBLE_BYTE_PAIR(0xD266, 0x6D7B)
+DOUBLE_BYTE_PAIR(0xD267, 0x6D7D)
+DOUBLE_BYTE_PAIR(0xD268, 0x6D75)
+DOUBLE_BYTE_PAIR(0xD269, 0x6D90)
+DOUBLE_BYTE_PAIR(0xD26A, 0x70DC)
+DOUBLE_BYTE_PAIR(0xD26B, 0x70D3)
+DOUBLE_BYTE_PAIR(0xD26C, 0x70D1)
+DOUBLE_BYTE_PAIR(0xD26D, 0x70DD)
+DOUBLE_BYTE_PAIR(0xD26E, 0x70CB)
+DOUBLE_BYTE_PAIR(0xD26F, 0x7F39)
+DOUBLE_BYTE_PAIR(0xD270, 0x70E2)
+DOUBLE_BYTE_PAIR(0xD271, 0x70D7)
+DOUBLE_BYTE_PAIR(0xD272, 0x70D2)
+DOUBLE_BYTE_PAIR(0xD273, 0x70DE)
+DOUBLE_BYTE_PAIR(0xD274, 0x70E0)
+DOUBLE_BYTE_PAIR(0xD275, 0x70D4)
+DOUBLE_BYTE_PAIR(0xD276, 0x70CD)
+DOUBLE_BYTE_PAIR(0xD277, 0x70C5)
+DOUBLE_BYTE_PAIR(0xD278, 0x70C6)
+DOUBLE_BYTE_PAIR(0xD279, 0x70C7)
+DOUBLE_BYTE_PAIR(0xD27A, 0x70DA)
+DOUBLE_BYTE_PAIR(0xD27B, 0x70CE)
+DOUBLE_BYTE_PAIR(0xD27C, 0x70E1)
+DOUBLE_BYTE_PAIR(0xD27D, 0x7242)
+DOUBLE_BYTE_PAIR(0xD27E, 0x7278)
+DOUBLE_BYTE_PAIR(0xD2A1, 0x7277)
+DOUBLE_BYTE_PAIR(0xD2A2, 0x7276)
+DOUBLE_BYTE_PAIR(0xD2A3, 0x7300)
+DOUBLE_BYTE_PAIR(0xD2A4, 0x72FA)
+DOUBLE_BYTE_PAIR(0xD2A5, 0x72F4)
+DOUBLE_BYTE_PAIR(0xD2A6, 0x72FE)
+DOUBLE_BYTE_PAIR(0xD2A7, 0x72F6)
+DOUBLE_BYTE_PAIR(0xD2A8, 0x72F3)
+DOUBLE_BYTE_PAIR(0xD2A9, 0x72FB)
+DOUBLE_BYTE_PAIR(0xD2AA, 0x7301)
+DOUBLE_BYTE_PAIR(0xD2AB, 0x73D3)
+DOUBLE_BYTE_PAIR(0xD2AC, 0x73D9)
+DOUBLE_BYTE_PAIR(0xD2AD, 0x73E5)
+DOUBLE_BYTE_PAIR(0xD2AE, 0x73D6)
+DOUBLE_BYTE_PAIR(0xD2AF, 0x73BC)
+DOUBLE_BYTE_PAIR(0xD2B0, 0x73E7)
+DOUBLE_BYTE_PAIR(0xD2B1, 0x73E3)
+DOUBLE_BYTE_PAIR(0xD2B2, 0x73E9)
+DOUBLE_BYTE_PAIR(0xD2B3, 0x73DC)
+DOUBLE_BYTE_PAIR(0xD2B4, 0x73D2)
+DOUBLE_BYTE_PAIR(0xD2B5, 0x73DB)
+DOUBLE_BYTE_PAIR(0xD2B6, 0x73D4)
+DOUBLE_BYTE_PAIR(0xD2B7, 0x73DD)
+DOUBLE_BYTE_PAIR(0xD2B8, 0x73DA)
+DOUBLE_BYTE_PAIR(0xD2B9, 0x73D7)
+DOUBLE_BYTE_PAIR(0xD2BA, 0x73D8)
+DOUBLE_BYTE_PAIR(0xD2BB, 0x73E8)
+DOUBLE_BYTE_PAIR(0xD2BC, 0x74DE)
+DOUBLE_BYTE_PAIR(0xD2BD, 0x74DF)
+DOUBLE_BYTE_PAIR(0xD2BE, 0x74F4)
+DOUBLE_BYTE_PAIR(0xD2BF, 0x74F5)
+DOUBLE_BYTE_PAIR(0xD2C0, 0x7521)
+DOUBLE_BYTE_PAIR(0xD2C1, 0x755B)
+DOUBLE_BYTE_PAIR(0xD2C2, 0x755F)
+DOUBLE_BYTE_PAIR(0xD2C3, 0x75B0)
+DOUBLE_BYTE_PAIR(0xD2C4, 0x75C1)
+DOUBLE_BYTE_PAIR(0xD2C5, 0x75BB)
+DOUBLE_BYTE_PAIR(0xD2C6, 0x75C4)
+DOUBLE_BYTE_PAIR(0xD2C7, 0x75C0)
+DOUBLE_BYTE_PAIR(0xD2C8, 0x75BF)
+DOUBLE_BYTE_PAIR(0xD2C9, 0x75B6)
+DOUBLE_BYTE_PAIR(0xD2CA, 0x75BA)
+DOUBLE_BYTE_PAIR(0xD2CB, 0x768A)
+DOUBLE_BYTE_PAIR(0xD2CC, 0x76C9)
+DOUBLE_BYTE_PAIR(0xD2CD, 0x771D)
+DOUBLE_BYTE_PAIR(0xD2CE, 0x771B)
+DOUBLE_BYTE_PAIR(0xD2CF, 0x7710)
+DOUBLE_BYTE_PAIR(0xD2D0, 0x7713)
+DOUBLE_BYTE_PAIR(0xD2D1, 0x7712)
+DOUBLE_BYTE_PAIR(0xD2D2, 0x7723)
+DOUBLE_BYTE_PAIR(0xD2D3, 0x7711)
+DOUBLE_BYTE_PAIR(0xD2D4, 0x7715)
+DOUBLE_BYTE_PAIR(0xD2D5, 0x7719)
+DOUBLE_BYTE_PAIR(0xD2D6, 0x771A)
+DOUBLE_BYTE_PAIR(0xD2D7, 0x7722)
+DOUBLE_BYTE_PAIR(0xD2D8, 0x7727)
+DOUBLE_BYTE_PAIR(0xD2D9, 0x7823)
+DOUBLE_BYTE_PAIR(0xD2DA, 0x782C)
+DOUBLE_BYTE_PAIR(0xD2DB, 0x7822)
+DOUBLE_BYTE_PAIR(0xD2DC, 0x7835)
+DOUBLE_BYTE_PAIR(0xD2DD, 0x782F)
+DOUBLE_BYTE_PAIR(0xD2DE, 0x7828)
+DOUBLE_BYTE_PAIR(0xD2DF, 0x782E)
+DOUBLE_BYTE_PAIR(0xD2E0, 0x782B)
+DOUBLE_BYTE_PAIR(0xD2E1, 0x7821)
+DOUBLE_BYTE_PAIR(0xD2E2, 0x7829)
+DOUBLE_BYTE_PAIR(0xD2E3, 0x7833)
+DOUBLE_BYTE_PAIR(0xD2E4, 0x782A)
+DOUBLE_BYTE_PAIR(0xD2E5, 0x7831)
+DOUBLE_BYTE_PAIR(0xD2E6, 0x7954)
+DOUBLE_BYTE_PAIR(0xD2E7, 0x795B)
+DOUBLE_BYTE_PAIR(0xD2E8, 0x794F)
+DOUBLE_BYTE_PAIR(0xD2E9, 0x795C)
+DOUBLE_BYTE_PAIR(0xD2EA, 0x7953)
+DOUBLE_BYTE_PAIR(0xD2EB, 0x7952)
+DOUBLE_BYTE_PAIR(0xD2EC, 0x7951)
+DOUBLE_BYTE_PAIR(0xD2ED, 0x79EB)
+DOUBLE_BYTE_PAIR(0xD2EE, 0x79EC)
+DOUBLE_BYTE_PAIR(0xD2EF, 0x79E0)
+DOUBLE_BYTE_PAIR(0xD2F0, 0x79EE)
+DOUBLE_BYTE_PAIR(0xD2F1, 0x79ED)
+DOUBLE_BYTE_PAIR(0xD2F2, 0x79EA)
+DOUBLE_BYTE_PAIR(0xD2F3, 0x79DC)
+DOUBLE_BYTE_PAIR(0xD2F4, 0x79DE)
+DOUBLE_BYTE_PAIR(0xD2F5, 0x79DD)
+DOUBLE_BYTE_PAIR(0xD2F6, 0x7A86)
+DOUBLE_BYTE_PAIR(0xD2F7, 0x7A89)
+DOUBLE_BYTE_PAIR(0xD2F8, 0x7A85)
+DOUBLE_BYTE_PAIR(0xD2F9, 0x7A8B)
+DOUBLE_BYTE_PAIR(0xD2FA, 0x7A8C)
+DOUBLE_BYTE_PAIR(0xD2FB, 0x7A8A)
+DOUBLE_BYTE_PAIR(0xD2FC, 0x7A87)
+DOUBLE_BYTE_PAIR(0xD2FD, 0x7AD8)
+DOUBLE_BYTE_PAIR(0xD2FE, 0x7B10)
+DOUBLE_BYTE_PAIR(0xD340, 0x7B04)
+DOUBLE_BYTE_PAIR(0xD341, 0x7B13)
+DOUBLE_BYTE_PAIR(0xD342, 0x7B05)
+DOUBLE_BYTE_PAIR(0xD343, 0x7B0F)
+DOUBLE_BYTE_PAIR(0xD344, 0x7B08)
+DOUBLE_BYTE_PAIR(0xD345, 0x7B0A)
+DOUBLE_BYTE_PAIR(0xD346, 0x7B0E)
+DOUBLE_BYTE_PAIR(0xD347, 0x7B09)
+DOUBLE_BYTE_PAIR(0xD348, 0x7B12)
+DOUBLE_BYTE_PAIR(0xD349, 0x7C84)
+DOUBLE_BYTE_PAIR(0xD34A, 0x7C91)
+DOUBLE_BYTE_PAIR(0xD34B, 0x7C8A)
+DOUBLE_BYTE_PAIR(0xD34C, 0x7C8C)
+DOUBLE_BYTE_PAIR(0xD34D, 0x7C88)
+DOUBLE_BYTE_PAIR(0xD34E, 0x7C8D)
+DOUBLE_BYTE_PAIR(0xD34F, 0x7C85)
+DOUBLE_BYTE_PAIR(0xD350, 0x7D1E)
+DOUBLE_BYTE_PAIR(0xD351, 0x7D1D)
+DOUBLE_BYTE_PAIR(0xD352, 0x7D11)
+DOUBLE_BYTE_PAIR(0xD353, 0x7D0E)
+DOUBLE_BYTE_PAIR(0xD354, 0x7D18)
+DOUBLE_BYTE_PAIR(0xD355, 0x7D16)
+DOUBLE_BYTE_PAIR(0xD356, 0x7D13)
+DOUBLE_BYTE_PAIR(0xD357, 0x7D1F)
+DOUBLE_BYTE_PAIR(0xD358, 0x7D12)
+DOUBLE_BYTE_PAIR(0xD359, 0x7D0F)
+DOUBLE_BYTE_PAIR(0xD35A, 0x7D0C)
+DOUBLE_BYTE_PAIR(0xD35B, 0x7F5C)
+DOUBLE_BYTE_PAIR(0xD35C, 0x7F61)
+DOUBLE_BYTE_PAIR(0xD35D, 0x7F5E)
+DOUBLE_BYTE_PAIR(0xD35E, 0x7F60)
+DOUBLE_BYTE_PAIR(0xD35F, 0x7F5D)
+DOUBLE_BYTE_PAIR(0xD360, 0x7F5B)
+DOUBLE_BYTE_PAIR(0xD361, 0x7F96)
+DOUBLE_BYTE_PAIR(0xD362, 0x7F92)
+DOUBLE_BYTE_PAIR(0xD363, 0x7FC3)
+DOUBLE_BYTE_PAIR(0xD364, 0x7FC2)
+DOUBLE_BYTE_PAIR(0xD365, 0x7FC0)
+DOUBLE_BYTE_PAIR(0xD366, 0x8016)
+DOUBLE_BYTE_PAIR(0xD367, 0x803E)
+DOUBLE_BYTE_PAIR(0xD368, 0x8039)
+DOUBLE_BYTE_PAIR(0xD369, 0x80FA)
+DOUBLE_BYTE_PAIR(0xD36A, 0x80F2)
+DOUBLE_BYTE_PAIR(0xD36B, 0x80F9)
+DOUBLE_BYTE_PAIR(0xD36C, 0x80F5)
+DOUBLE_BYTE_PAIR(0xD36D, 0x8101)
+DOUBLE_BYTE_PAIR(0xD36E, 0x80FB)
+DOUBLE_BYTE_PAIR(0xD36F, 0x8100)
+DOUBLE_BYTE_PAIR(0xD370, 0x8201)
+DOUBLE_BYTE_PAIR(0xD371, 0x822F)
+DOUBLE_BYTE_PAIR(0xD372, 0x8225)
+DOUBLE_BYTE_PAIR(0xD373, 0x8333)
+DOUBLE_BYTE_PAIR(0xD374, 0x832D)
+DOUBLE_BYTE_PAIR(0xD375, 0x8344)
+DOUBLE_BYTE_PAIR(0xD376, 0x8319)
+DOUBLE_BYTE_PAIR(0xD377, 0x8351)
+DOUBLE_BYTE_PAIR(0xD378, 0x8325)
+DOUBLE_BYTE_PAIR(0xD379, 0x8356)
+DOUBLE_BYTE_PAIR(0xD37A, 0x833F)
+DOUBLE_BYTE_PAIR(0xD37B, 0x8341)
+DOUBLE_BYTE_PAIR(0xD37C, 0x8326)
+DOUBLE_BYTE_PAIR(0xD37D, 0x831C)
+DOUBLE_BYTE_PAIR(0xD37E, 0x8322)
+DOUBLE_BYTE_PAIR(0xD3A1, 0x8342)
+DOUBLE_BYTE_PAIR(0xD3A2, 0x834E)
+DOUBLE_BYTE_PAIR(0xD3A3, 0x831B)
+DOUBLE_BYTE_PAIR(0xD3A4, 0x832A)
+DOUBLE_BYTE_PAIR(0xD3A5, 0x8308)
+DOUBLE_BYTE_PAIR(0xD3A6, 0x833C)
+DOUBLE_BYTE_PAIR(0xD3A7, 0x834D)
+DOUBLE_BYTE_PAIR(0xD3A8, 0x8316)
+DOUBLE_BYTE_PAIR(0xD3A9, 0x8324)
+DOUBLE_BYTE_PAIR(0xD3AA, 0x8320)
+DOUBLE_BYTE_PAIR(0xD3AB, 0x8337)
+DOUBLE_BYTE_PAIR(0xD3AC, 0x832F)
+DOUBLE_BYTE_PAIR(0xD3AD, 0x8329)
+DOUBLE_BYTE_PAIR(0xD3AE, 0x8347)
+DOUBLE_BYTE_PAIR(0xD3AF, 0x8345)
+DOUBLE_BYTE_PAIR(0xD3B0, 0x834C)
+DOUBLE_BYTE_PAIR(0xD3B1, 0x8353)
+DOUBLE_BYTE_PAIR(0xD3B2, 0x831E)
+DOUBLE_BYTE_PAIR(0xD3B3, 0x832C)
+DOUBLE_BYTE_PAIR(0xD3B4, 0x834B)
+DOUBLE_BYTE_PAIR(0xD3B5, 0x8327)
+DOUBLE_BYTE_PAIR(0xD3B6, 0x8348)
+DOUBLE_BYTE_PAIR(0xD3B7, 0x8653)
+DOUBLE_BYTE_PAIR(0xD3B8, 0x8652)
+DOUBLE_BYTE_PAIR(0xD3B9, 0x86A2)
+DOUBLE_BYTE_PAIR(0xD3BA, 0x86A8)
+DOUBLE_BYTE_PAIR(0xD3BB, 0x8696)
+DOUBLE_BYTE_PAIR(0xD3BC, 0x868D)
+DOUBLE_BYTE_PAIR(0xD3BD, 0x8691)
+DOUBLE_BYTE_PAIR(0xD3BE, 0x869E)
+DOUBLE_BYTE_PAIR(0xD3BF, 0x8687)
+DOUBLE_BYTE_PAIR(0xD3C0, 0x8697)
+DOUBLE_BYTE_PAIR(0xD3C1, 0x8686)
+DOUBLE_BYTE_PAIR(0xD3C2, 0x868B)
+DOUBLE_BYTE_PAIR(0xD3C3, 0x869A)
+DOUBLE_BYTE_PAIR(0xD3C4, 0x8685)
+DOUBLE_BYTE_PAIR(0xD3C5, 0x86A5)
+DOUBLE_BYTE_PAIR(0xD3C6, 0x8699)
+DOUBLE_BYTE_PAIR(0xD3C7, 0x86A1)
+DOUBLE_BYTE_PAIR(0xD3C8, 0x86A7)
+DOUBLE_BYTE_PAIR(0xD3C9, 0x8695)
+DOUBLE_BYTE_PAIR(0xD3CA, 0x8698)
+DOUBLE_BYTE_PAIR(0xD3CB, 0x868E)
+DOUBLE_BYTE_PAIR(0xD3CC, 0x869D)
+DOUBLE_BYTE_PAIR(0xD3CD, 0x8690)
+DOUBLE_BYTE_PAIR(0xD3CE, 0x8694)
+DOUBLE_BYTE_PAIR(0xD3CF, 0x8843)
+DOUBLE_BYTE_PAIR(0xD3D0, 0x8844)
+DOUBLE_BYTE_PAIR(0xD3D1, 0x886D)
+DOUBLE_BYTE_PAIR(0xD3D2, 0x8875)
+DOUBLE_BYTE_PAIR(0xD3D3, 0x8876)
+DOUBLE_BYTE_PAIR(0xD3D4, 0x8872)
+DOUBLE_BYTE_PAIR(0xD3D5, 0x8880)
+DOUBLE_BYTE_PAIR(0xD3D6, 0x8871)
+DOUBLE_BYTE_PAIR(0xD3D7, 0x887F)
+DOUBLE_BYTE_PAIR(0xD3D8, 0x886F)
+DOUBLE_BYTE_PAIR(0xD3D9, 0x8883)
+DOUBLE_BYTE_PAIR(0xD3DA, 0x887E)
+DOUBLE_BYTE_PAIR(0xD3DB, 0x8874)
+DOUBLE_BYTE_PAIR(0xD3DC, 0x887C)
+DOUBLE_BYTE_PAIR(0xD3DD, 0x8A12)
+DOUBLE_BYTE_PAIR(0xD3DE, 0x8C47)
+DOUBLE_BYTE_PAIR(0xD3DF, 0x8C57)
+DOUBLE_BYTE_PAIR(0xD3E0, 0x8C7B)
+DOUBLE_BYTE_PAIR(0xD3E1, 0x8CA4)
+DOUBLE_BYTE_PAIR(0xD3E2, 0x8CA3)
+DOUBLE_BYTE_PAIR(0xD3E3, 0x8D76)
+DOUBLE_BYTE_PAIR(0xD3E4, 0x8D78)
+DOUBLE_BYTE_PAIR(0xD3E5, 0x8DB5)
+DOUBLE_BYTE_PAIR(0xD3E6, 0x8DB7)
+DOUBLE_BYTE_PAIR(0xD3E7, 0x8DB6)
+DOUBLE_BYTE_PAIR(0xD3E8, 0x8ED1)
+DOUBLE_BYTE_PAIR(0xD3E9, 0x8ED3)
+DOUBLE_BYTE_PAIR(0xD3EA, 0x8FFE)
+DOUBLE_BYTE_PAIR(0xD3EB, 0x8FF5)
+DOUBLE_BYTE_PAIR(0xD3EC, 0x9002)
+DOUBLE_BYTE_PAIR(0xD3ED, 0x8FFF)
+DOUBLE_BYTE_PAIR(0xD3EE, 0x8FFB)
+DOUBLE_BYTE_PAIR(0xD3EF, 0x9004)
+DOUBLE_BYTE_PAIR(0xD3F0, 0x8FFC)
+DOUBLE_BYTE_PAIR(0xD3F1, 0x8FF6)
+DOUBLE_BYTE_PAIR(0xD3F2, 0x90D6)
+DOUBLE_BYTE_PAIR(0xD3F3, 0x90E0)
+DOUBLE_BYTE_PAIR(0xD3F4, 0x90D9)
+DOUBLE_BYTE_PAIR(0xD3F5, 0x90DA)
+DOUBLE_BYTE_PAIR(0xD3F6, 0x90E3)
+DOUBLE_BYTE_PAIR(0xD3F7, 0x90DF)
+DOUBLE_BYTE_PAIR(0xD3F8, 0x90E5)
+DOUBLE_BYTE_PAIR(0xD3F9, 0x90D8)
+DOUBLE_BYTE_PAIR(0xD3FA, 0x90DB)
+DOUBLE_BYTE_PAIR(0xD3FB, 0x90D7)
+DOUBLE_BYTE_PAIR(0xD3FC, 0x90DC)
+DOUBLE_BYTE_PAIR(0xD3FD, 0x90E4)
+DOUBLE_BYTE_PAIR(0xD3FE, 0x9150)
+DOUBLE_BYTE_PAIR(0xD440, 0x914E)
+DOUBLE_BYTE_PAIR(0xD441, 0x914F)
+DOUBLE_BYTE_PAIR(0xD442, 0x91D5)
+DOUBLE_BYTE_PAIR(0xD443, 0x91E2)
+DOUBLE_BYTE_PAIR(0xD444, 0x91DA)
+DOUBLE_BYTE_PAIR(0xD445, 0x965C)
+DOUBLE_BYTE_PAIR(0xD446, 0x965F)
+DOUBLE_BYTE_PAIR(0xD447, 0x96BC)
+DOUBLE_BYTE_PAIR(0xD448, 0x98E3)
+DOUBLE_BYTE_PAIR(0xD449, 0x9ADF)
+DOUBLE_BYTE_PAIR(0xD44A, 0x9B2F)
+DOUBLE_BYTE_PAIR(0xD44B, 0x4E7F)
+DOUBLE_BYTE_PAIR(0xD44C, 0x5070)
+DOUBLE_BYTE_PAIR(0xD44D, 0x506A)
+DOUBLE_BYTE_PAIR(0xD44E, 0x5061)
+DOUBLE_BYTE_PAIR(0xD44F, 0x505E)
+DOUBLE_BYTE_PAIR(0xD450, 0x5060)
+DOUBLE_BYTE_PAIR(0xD451, 0x5053)
+DOUBLE_BYTE_PAIR(0xD452, 0x504B)
+DOUBLE_BYTE_PAIR(0xD453, 0x505D)
+DOUBLE_BYTE_PAIR(0xD454, 0x5072)
+DOUBLE_BYTE_PAIR(0xD455, 0x5048)
+DOUBLE_BYTE_PAIR(0xD456, 0x504D)
+DOUBLE_BYTE_PAIR(0xD457, 0x5041)
+DOUBLE_BYTE_PAIR(0xD458, 0x505B)
+DOUBLE_BYTE_PAIR(0xD459, 0x504A)
+DOUBLE_BYTE_PAIR(0xD45A, 0x5062)
+DOUBLE_BYTE_PAIR(0xD45B, 0x5015)
+DOUBLE_BYTE_PAIR(0xD45C, 0x5045)
+DOUBLE_BYTE_PAIR(0xD45D, 0x505F)
+DOUBLE_BYTE_PAIR(0xD45E, 0x5069)
+DOUBLE_BYTE_PAIR(0xD45F, 0x506B)
+DOUBLE_BYTE_PAIR(0xD460, 0x5063)
+DOUBLE_BYTE_PAIR(0xD461, 0x5064)
+DOUBLE_BYTE_PAIR(0xD462, 0x5046)
+DOUBLE_BYTE_PAIR(0xD463, 0x5040)
+DOUBLE_BYTE_PAIR(0xD464, 0x506E)
+DOUBLE_BYTE_PAIR(0xD465, 0x5073)
+DOUBLE_BYTE_PAIR(0xD466, 0x5057)
+DOUBLE_BYTE_PAIR(0xD467, 0x5051)
+DOUBLE_BYTE_PAIR(0xD468, 0x51D0)
+DOUBLE_BYTE_PAIR(0xD469, 0x526B)
+DOUBLE_BYTE_PAIR(0xD46A, 0x526D)
+DOUBLE_BYTE_PAIR(0xD46B, 0x526C)
+DOUBLE_BYTE_PAIR(0xD46C, 0x526E)
+DOUBLE_BYTE_PAIR(0xD46D, 0x52D6)
+DOUBLE_BYTE_PAIR(0xD46E, 0x52D3)
+DOUBLE_BYTE_PAIR(0xD46F, 0x532D)
+DOUBLE_BYTE_PAIR(0xD470, 0x539C)
+DOUBLE_BYTE_PAIR(0xD471, 0x5575)
+DOUBLE_BYTE_PAIR(0xD472, 0x5576)
+DOUBLE_BYTE_PAIR(0xD473, 0x553C)
+DOUBLE_BYTE_PAIR(0xD474, 0x554D)
+DOUBLE_BYTE_PAIR(0xD475, 0x5550)
+DOUBLE_BYTE_PAIR(0xD476, 0x5534)
+DOUBLE_BYTE_PAIR(0xD477, 0x552A)
+DOUBLE_BYTE_PAIR(0xD478, 0x5551)
+DOUBLE_BYTE_PAIR(0xD479, 0x5562)
+DOUBLE_BYTE_PAIR(0xD47A, 0x5536)
+DOUBLE_BYTE_PAIR(0xD47B, 0x5535)
+DOUBLE_BYTE_PAIR(0xD47C, 0x5530)
+DOUBLE_BYTE_PAIR(0xD47D, 0x5552)
+DOUBLE_BYTE_PAIR(0xD47E, 0x5545)
+DOUBLE_BYTE_PAIR(0xD4A1, 0x550C)
+DOUBLE_BYTE_PAIR(0xD4A2, 0x5532)
+DOUBLE_BYTE_PAIR(0xD4A3, 0x5565)
+DOUBLE_BYTE_PAIR(0xD4A4, 0x554E)
+DOUBLE_BYTE_PAIR(0xD4A5, 0x5539)
+DOUBLE_BYTE_PAIR(0xD4A6, 0x5548)
+DOUBLE_BYTE_PAIR(0xD4A7, 0x552D)
+DOUBLE_BYTE_PAIR(0xD4A8, 0x553B)
+DOUBLE_BYTE_PAIR(0xD4A9, 0x5540)
+DOUBLE_BYTE_PAIR(0xD4AA, 0x554B)
+DOUBLE_BYTE_PAIR(0xD4AB, 0x570A)
+DOUBLE_BYTE_PAIR(0xD4AC, 0x5707)
+DOUBLE_BYTE_PAIR(0xD4AD, 0x57FB)
+DOUBLE_BYTE_PAIR(0xD4AE, 0x5814)
+DOUBLE_BYTE_PAIR(0xD4AF, 0x57E2)
+DOUBLE_BYTE_PAIR(0xD4B0, 0x57F6)
+DOUBLE_BYTE_PAIR(0xD4B1, 0x57DC)
+DOUBLE_BYTE_PAIR(0xD4B2, 0x57F4)
+DOUBLE_BYTE_PAIR(0xD4B3, 0x5800)
+DOUBLE_BYTE_PAIR(0xD4B4, 0x57ED)
+DOUBLE_BYTE_PAIR(0xD4B5, 0x57FD)
+DOUBLE_BYTE_PAIR(0xD4B6, 0x5808)
+DOUBLE_BYTE_PAIR(0xD4B7, 0x57F8)
+DOUBLE_BYTE_PAIR(0xD4B8, 0x580B)
+DOUBLE_BYTE_PAIR(0xD4B9, 0x57F3)
+DOUBLE_BYTE_PAIR(0xD4BA, 0x57CF)
+DOUBLE_BYTE_PAIR(0xD4BB, 0x5807)
+DOUBLE_BYTE_PAIR(0xD4BC, 0x57EE)
+DOUBLE_BYTE_PAIR(0xD4BD, 0x57E3)
+DOUBLE_BYTE_PAIR(0xD4BE, 0x57F2)
+DOUBLE_BYTE_PAIR(0xD4BF, 0x57E5)
+DOUBLE_BYTE_PAIR(0xD4C0, 0x57EC)
+DOUBLE_BYTE_PAIR(0xD4C1, 0x57E1)
+DOUBLE_BYTE_PAIR(0xD4C2, 0x580E)
+DOUBLE_BYTE_PAIR(0xD4C3, 0x57FC)
+DOUBLE_BYTE_PAIR(0xD4C4, 0x5810)
+DOUBLE_BYTE_PAIR(0xD4C5, 0x57E7)
+DOUBLE_BYTE_PAIR(0xD4C6, 0x5801)
+DOUBLE_BYTE_PAIR(0xD4C7, 0x580C)
+DOUBLE_BYTE_PAIR(0xD4C8, 0x57F1)
+DOUBLE_BYTE_PAIR(0xD4C9, 0x57E9)
+DOUBLE_BYTE_PAIR(0xD4CA, 0x57F0)
+DOUBLE_BYTE_PAIR(0xD4CB, 0x580D)
+DOUBLE_BYTE_PAIR(0xD4CC, 0x5804)
+DOUBLE_BYTE_PAIR(0xD4CD, 0x595C)
+DOUBLE_BYTE_PAIR(0xD4CE, 0x5A60)
+DOUBLE_BYTE_PAIR(0xD4CF, 0x5A58)
+DOUBLE_BYTE_PAIR(0xD4D0, 0x5A55)
+DOUBLE_BYTE_PAIR(0xD4D1, 0x5A67)
+DOUBLE_BYTE_PAIR(0xD4D2, 0x5A5E)
+DOUBLE_BYTE_PAIR(0xD4D3, 0x5A38)
+DOUBLE_BYTE_PAIR(0xD4D4, 0x5A35)
+DOUBLE_BYTE_PAIR(0xD4D5, 0x5A6D)
+DOUBLE_BYTE_PAIR(0xD4D6, 0x5A50)
+DOUBLE_BYTE_PAIR(0xD4D7, 0x5A5F)
+DOUBLE_BYTE_PAIR(0xD4D8, 0x5A65)
+DOUBLE_BYTE_PAIR(0xD4D9, 0x5A6C)
+DOUBLE_BYTE_PAIR(0xD4DA, 0x5A53)
+DOUBLE_BYTE_PAIR(0xD4DB, 0x5A64)
+DOUBLE_BYTE_PAIR(0xD4DC, 0x5A57)
+DOUBLE_BYTE_PAIR(0xD4DD, 0x5A43)
+DOUBLE_BYTE_PAIR(0xD4DE, 0x5A5D)
+DOUBLE_BYTE_PAIR(0xD4DF, 0x5A52)
+DOUBLE_BYTE_PAIR(0xD4E0, 0x5A44)
+DOUBLE_BYTE_PAIR(0xD4E1, 0x5A5B)
+DOUBLE_BYTE_PAIR(0xD4E2, 0x5A48)
+DOUBLE_BYTE_PAIR(0xD4E3, 0x5A8E)
+DOUBLE_BYTE_PAIR(0xD4E4, 0x5A3E)
+DOUBLE_BYTE_PAIR(0xD4E5, 0x5A4D)
+DOUBLE_BYTE_PAIR(0xD4E6, 0x5A39)
+DOUBLE_BYTE_PAIR(0xD4E7, 0x5A4C)
+DOUBLE_BYTE_PAIR(0xD4E8, 0x5A70)
+DOUBLE_BYTE_PAIR(0xD4E9, 0x5A69)
+DOUBLE_BYTE_PAIR(0xD4EA, 0x5A47)
+DOUBLE_BYTE_PAIR(0xD4EB, 0x5A51)
+DOUBLE_BYTE_PAIR(0xD4EC, 0x5A56)
+DOUBLE_BYTE_PAIR(0xD4ED, 0x5A42)
+DOUBLE_BYTE_PAIR(0xD4EE, 0x5A5C)
+DOUBLE_BYTE_PAIR(0xD4EF, 0x5B72)
+DOUBLE_BYTE_PAIR(0xD4F0, 0x5B6E)
+DOUBLE_BYTE_PAIR(0xD4F1, 0x5BC1)
+DOUBLE_BYTE_PAIR(0xD4F2, 0x5BC0)
+DOUBLE_BYTE_PAIR(0xD4F3, 0x5C59)
+DOUBLE_BYTE_PAIR(0xD4F4, 0x5D1E)
+DOUBLE_BYTE_PAIR(0xD4F5, 0x5D0B)
+DOUBLE_BYTE_PAIR(0xD4F6, 0x5D1D)
+DOUBLE_BYTE_PAIR(0xD4F7, 0x5D1A)
+DOUBLE_BYTE_PAIR(0xD4F8, 0x5D20)
+DOUBLE_BYTE_PAIR(0xD4F9, 0x5D0C)
+DOUBLE_BYTE_PAIR(0xD4FA, 0x5D28)
+DOUBLE_BYTE_PAIR(0xD4FB, 0x5D0D)
+DOUBLE_BYTE_PAIR(0xD4FC, 0x5D26)
+DOUBLE_BYTE_PAIR(0xD4FD, 0x5D25)
+DOUBLE_BYTE_PAIR(0xD4FE, 0x5D0F)
+DOUBLE_BYTE_PAIR(0xD540, 0x5D30)
+DOUBLE_BYTE_PAIR(0xD541, 0x5D12)
+DOUBLE_BYTE_PAIR(0xD542, 0x5D23)
+DOUBLE_BYTE_PAIR(0xD543, 0x5D1F)
+DOUBLE_BYTE_PAIR(0xD544, 0x5D2E)
+DOUBLE_BYTE_PAIR(0xD545, 0x5E3E)
+DOUBLE_BYTE_PAIR(0xD546, 0x5E34)
+DOUBLE_BYTE_PAIR(0xD547, 0x5EB1)
+DOUBLE_BYTE_PAIR(0xD548, 0x5EB4)
+DOUBLE_BYTE_PAIR(0xD549, 0x5EB9)
+DOUBLE_BYTE_PAIR(0xD54A, 0x5EB2)
+DOUBLE_BYTE_PAIR(0xD54B, 0x5EB3)
+DOUBLE_BYTE_PAIR(0xD54C, 0x5F36)
+DOUBLE_BYTE_PAIR(0xD54D, 0x5F38)
+DOUBLE_BYTE_PAIR(0xD54E, 0x5F9B)
+DOUBLE_BYTE_PAIR(0xD54F, 0x5F96)
+DOUBLE_BYTE_PAIR(0xD550, 0x5F9F)
+DOUBLE_BYTE_PAIR(0xD551, 0x608A)
+DOUBLE_BYTE_PAIR(0xD552, 0x6090)
+DOUBLE_BYTE_PAIR(0xD553, 0x6086)
+DOUBLE_BYTE_PAIR(0xD554, 0x60BE)
+DOUBLE_BYTE_PAIR(0xD555, 0x60B0)
+DOUBLE_BYTE_PAIR(0xD556, 0x60BA)
+DOUBLE_BYTE_PAIR(0xD557, 0x60D3)
+DOUBLE_BYTE_PAIR(0xD558, 0x60D4)
+DOUBLE_BYTE_PAIR(0xD559, 0x60CF)
+DOUBLE_BYTE_PAIR(0xD55A, 0x60E4)
+DOUBLE_BYTE_PAIR(0xD55B, 0x60D9)
+DOUBLE_BYTE_PAIR(0xD55C, 0x60DD)
+DOUBLE_BYTE_PAIR(0xD55D, 0x60C8)
+DOUBLE_BYTE_PAIR(0xD55E, 0x60B1)
+DOUBLE_BYTE_PAIR(0xD55F, 0x60DB)
+DOUBLE_BYTE_PAIR(0xD560, 0x60B7)
+DOUBLE_BYTE_PAIR(0xD561, 0x60CA)
+DOUBLE_BYTE_PAIR(0xD562, 0x60BF)
+DOUBLE_BYTE_PAIR(0xD563, 0x60C3)
+DOUBLE_BYTE_PAIR(0xD564, 0x60CD)
+DOUBLE_BYTE_PAIR(0xD565, 0x60C0)
+DOUBLE_BYTE_PAIR(0xD566, 0x6332)
+DOUBLE_BYTE_PAIR(0xD567, 0x6365)
+DOUBLE_BYTE_PAIR(0xD568, 0x638A)
+DOUBLE_BYTE_PAIR(0xD569, 0x6382)
+DOUBLE_BYTE_PAIR(0xD56A, 0x637D)
+DOUBLE_BYTE_PAIR(0xD56B, 0x63BD)
+DOUBLE_BYTE_PAIR(0xD56C, 0x639E)
+DOUBLE_BYTE_PAIR(0xD56D, 0x63AD)
+DOUBLE_BYTE_PAIR(0xD56E, 0x639D)
+DOUBLE_BYTE_PAIR(0xD56F, 0x6397)
+DOUBLE_BYTE_PAIR(0xD570, 0x63AB)
+DOUBLE_BYTE_PAIR(0xD571, 0x638E)
+DOUBLE_BYTE_PAIR(0xD572, 0x636F)
+DOUBLE_BYTE_PAIR(0xD573, 0x6387)
+DOUBLE_BYTE_PAIR(0xD574, 0x6390)
+DOUBLE_BYTE_PAIR(0xD575, 0x636E)
+DOUBLE_BYTE_PAIR(0xD576, 0x63AF)
+DOUBLE_BYTE_PAIR(0xD577, 0x6375)
+DOUBLE_BYTE_PAIR(0xD578, 0x639C)
+DOUBLE_BYTE_PAIR(0xD579, 0x636D)
+DOUBLE_BYTE_PAIR(0xD57A, 0x63AE)
+DOUBLE_BYTE_PAIR(0xD57B, 0x637C)
+DOUBLE_BYTE_PAIR(0xD57C, 0x63A4)
+DOUBLE_BYTE_PAIR(0xD57D, 0x633B)
+DOUBLE_BYTE_PAIR(0xD57E, 0x639F)
+DOUBLE_BYTE_PAIR(0xD5A1, 0x6378)
+DOUBLE_BYTE_PAIR(0xD5A2, 0x6385)
+DOUBLE_BYTE_PAIR(0xD5A3, 0x6381)
+DOUBLE_BYTE_PAIR(0xD5A4, 0x6391)
+DOUBLE_BYTE_PAIR(0xD5A5, 0x638D)
+DOUBLE_BYTE_PAIR(0xD5A6, 0x6370)
+DOUBLE_BYTE_PAIR(0xD5A7, 0x6553)
+DOUBLE_BYTE_PAIR(0xD5A8, 0x65CD)
+DOUBLE_BYTE_PAIR(0xD5A9, 0x6665)
+DOUBLE_BYTE_PAIR(0xD5AA, 0x6661)
+DOUBLE_BYTE_PAIR(0xD5AB, 0x665B)
+DOUBLE_BYTE_PAIR(0xD5AC, 0x6659)
+DOUBLE_BYTE_PAIR(0xD5AD, 0x665C)
+DOUBLE_BYTE_PAIR(0xD5AE, 0x6662)
+DOUBLE_BYTE_PAIR(0xD5AF, 0x6718)
+DOUBLE_BYTE_PAIR(0xD5B0, 0x6879)
+DOUBLE_BYTE_PAIR(0xD5B1, 0x6887)
+DOUBLE_BYTE_PAIR(0xD5B2, 0x6890)
+DOUBLE_BYTE_PAIR(0xD5B3, 0x689C)
+DOUBLE_BYTE_PAIR(0xD5B4, 0x686D)
+DOUBLE_BYTE_PAIR(0xD5B5, 0x686E)
+DOUBLE_BYTE_PAIR(0xD5B6, 0x68AE)
+DOUBLE_BYTE_PAIR(0xD5B7, 0x68AB)
+DOUBLE_BYTE_PAIR(0xD5B8, 0x6956)
+DOUBLE_BYTE_PAIR(0xD5B9, 0x686F)
+DOUBLE_BYTE_PAIR(0xD5BA, 0x68A3)
+DOUBLE_BYTE_PAIR(0xD5BB, 0x68AC)
+DOUBLE_BYTE_PAIR(0xD5BC, 0x68A9)
+DOUBLE_BYTE_PAIR(0xD5BD, 0x6875)
+DOUBLE_BYTE_PAIR(0xD5BE, 0x6874)
+DOUBLE_BYTE_PAIR(0xD5BF, 0x68B2)
+DOUBLE_BYTE_PAIR(0xD5C0, 0x688F)
+DOUBLE_BYTE_PAIR(0xD5C1, 0x6877)
+DOUBLE_BYTE_PAIR(0xD5C2, 0x6892)
+DOUBLE_BYTE_PAIR(0xD5C3, 0x687C)
+DOUBLE_BYTE_PAIR(0xD5C4, 0x686B)
+DOUBLE_BYTE_PAIR(0xD5C5, 0x6872)
+DOUBLE_BYTE_PAIR(0xD5C6, 0x68AA)
+DOUBLE_BYTE_PAIR(0xD5C7, 0x6880)
+DOUBLE_BYTE_PAIR(0xD5C8, 0x6871)
+DOUBLE_BYTE_PAIR(0xD5C9, 0x687E)
+DOUBLE_BYTE_PAIR(0xD5CA, 0x689B)
+DOUBLE_BYTE_PAIR(0xD5CB, 0x6896)
+DOUBLE_BYTE_PAIR(0xD5CC, 0x688B)
+DOUBLE_BYTE_PAIR(0xD5CD, 0x68A0)
+DOUBLE_BYTE_PAIR(0xD5CE, 0x6889)
+DOUBLE_BYTE_PAIR(0xD5CF, 0x68A4)
+DOUBLE_BYTE_PAIR(0xD5D0, 0x6878)
+DOUBLE_BYTE_PAIR(0xD5D1, 0x687B)
+DOUBLE_BYTE_PAIR(0xD5D2, 0x6891)
+DOUBLE_BYTE_PAIR(0xD5D3, 0x688C)
+DOUBLE_BYTE_PAIR(0xD5D4, 0x688A)
+DOUBLE_BYTE_PAIR(0xD5D5, 0x687D)
+DOUBLE_BYTE_PAIR(0xD5D6, 0x6B36)
+DOUBLE_BYTE_PAIR(0xD5D7, 0x6B33)
+DOUBLE_BYTE_PAIR(0xD5D8, 0x6B37)
+DOUBLE_BYTE_PAIR(0xD5D9, 0x6B38)
+DOUBLE_BYTE_PAIR(0xD5DA, 0x6B91)
+DOUBLE_BYTE_PAIR(0xD5DB, 0x6B8F)
+DOUBLE_BYTE_PAIR(0xD5DC, 0x6B8D)
+DOUBLE_BYTE_PAIR(0xD5DD, 0x6B8E)
+DOUBLE_BYTE_PAIR(0xD5DE, 0x6B8C)
+DOUBLE_BYTE_PAIR(0xD5DF, 0x6C2A)
+DOUBLE_BYTE_PAIR(0xD5E0, 0x6DC0)
+DOUBLE_BYTE_PAIR(0xD5E1, 0x6DAB)
+DOUBLE_BYTE_PAIR(0xD5E2, 0x6DB4)
+DOUBLE_BYTE_PAIR(0xD5E3, 0x6DB3)
+DOUBLE_BYTE_PAIR(0xD5E4, 0x6E74)
+DOUBLE_BYTE_PAIR(0xD5E5, 0x6DAC)
+DOUBLE_BYTE_PAIR(0xD5E6, 0x6DE9)
+DOUBLE_BYTE_PAIR(0xD5E7, 0x6DE2)
+DOUBLE_BYTE_PAIR(0xD5E8, 0x6DB7)
+DOUBLE_BYTE_PAIR(0xD5E9, 0x6DF6)
+DOUBLE_BYTE_PAIR(0xD5EA, 0x6DD4)
+DOUBLE_BYTE_PAIR(0xD5EB, 0x6E00)
+DOUBLE_BYTE_PAIR(0xD5EC, 0x6DC8)
+DOUBLE_BYTE_PAIR(0xD5ED, 0x6DE0)
+DOUBLE_BYTE_PAIR(0xD5EE, 0x6DDF)
+DOUBLE_BYTE_PAIR(0xD5EF, 0x6DD6)
+DOUBLE_BYTE_PAIR(0xD5F0, 0x6DBE)
+DOUBLE_BYTE_PAIR(0xD5F1, 0x6DE5)
+DOUBLE_BYTE_PAIR(0xD5F2, 0x6DDC)
+DOUBLE_BYTE_PAIR(0xD5F3, 0x6DDD)
+DOUBLE_BYTE_PAIR(0xD5F4, 0x6DDB)
+DOUBLE_BYTE_PAIR(0xD5F5, 0x6DF4)
+DOUBLE_BYTE_PAIR(0xD5F6, 0x6DCA)
+DOUBLE_BYTE_PAIR(0xD5F7, 0x6DBD)
+DOUBLE_BYTE_PAIR(0xD5F8, 0x6DED)
+DOUBLE_BYTE_PAIR(0xD5F9, 0x6DF0)
+DOUBLE_BYTE_PAIR(0xD5FA, 0x6DBA)
+DOUBLE_BYTE_PAIR(0xD5FB, 0x6DD5)
+DOUBLE_BYTE_PAIR(0xD5FC, 0x6DC2)
+DOUBLE_BYTE_PAIR(0xD5FD, 0x6DCF)
+DOUBLE_BYTE_PAIR(0xD5FE, 0x6DC9)
+DOUBLE_BYTE_PAIR(0xD640, 0x6DD0)
+DOUBLE_BYTE_PAIR(0xD641, 0x6DF2)
+DOUBLE_BYTE_PAIR(0xD642, 0x6DD3)
+DOUBLE_BYTE_PAIR(0xD643, 0x6DFD)
+DOUBLE_BYTE_PAIR(0xD644, 0x6DD7)
+DOUBLE_BYTE_PAIR(0xD645, 0x6DCD)
+DOUBLE_BYTE_PAIR(0xD646, 0x6DE3)
+DOUBLE_BYTE_PAIR(0xD647, 0x6DBB)
+DOUBLE_BYTE_PAIR(0xD648, 0x70FA)
+DOUBLE_BYTE_PAIR(0xD649, 0x710D)
+DOUBLE_BYTE_PAIR(0xD64A, 0x70F7)
+DOUBLE_BYTE_PAIR(0xD64B, 0x7117)
+DOUBLE_BYTE_PAIR(0xD64C, 0x70F4)
+DOUBLE_BYTE_PAIR(0xD64D, 0x710C)
+DOUBLE_BYTE_PAIR(0xD64E, 0x70F0)
+DOUBLE_BYTE_PAIR(0xD64F, 0x7104)
+DOUBLE_BYTE_PAIR(0xD650, 0x70F3)
+DOUBLE_BYTE_PAIR(0xD651, 0x7110)
+DOUBLE_BYTE_PAIR(0xD652, 0x70FC)
+DOUBLE_BYTE_PAIR(0xD653, 0x70FF)
+DOUBLE_BYTE_PAIR(0xD654, 0x7106)
+DOUBLE_BYTE_PAIR(0xD655, 0x7113)
+DOUBLE_BYTE_PAIR(0xD656, 0x7100)
+DOUBLE_BYTE_PAIR(0xD657, 0x70F8)
+DOUBLE_BYTE_PAIR(0xD658, 0x70F6)
+DOUBLE_BYTE_PAIR(0xD659, 0x710B)
+DOUBLE_BYTE_PAIR(0xD65A, 0x7102)
+DOUBLE_BYTE_PAIR(0xD65B, 0x710E)
+DOUBLE_BYTE_PAIR(0xD65C, 0x727E)
+DOUBLE_BYTE_PAIR(0xD65D, 0x727B)
+DOUBLE_BYTE_PAIR(0xD65E, 0x727C)
+DOUBLE_BYTE_PAIR(0xD65F, 0x727F)
+DOUBLE_BYTE_PAIR(0xD660, 0x731D)
+DOUBLE_BYTE_PAIR(0xD661, 0x7317)
+DOUBLE_BYTE_PAIR(0xD662, 0x7307)
+DOUBLE_BYTE_PAIR(0xD663, 0x7311)
+DOUBLE_BYTE_PAIR(0xD664, 0x7318)
+DOUBLE_BYTE_PAIR(0xD665, 0x730A)
+DOUBLE_BYTE_PAIR(0xD666, 0x7308)
+DOUBLE_BYTE_PAIR(0xD667, 0x72FF)
+DOUBLE_BYTE_PAIR(0xD668, 0x730F)
+DOUBLE_BYTE_PAIR(0xD669, 0x731E)
+DOUBLE_BYTE_PAIR(0xD66A, 0x7388)
+DOUBLE_BYTE_PAIR(0xD66B, 0x73F6)
+DOUBLE_BYTE_PAIR(0xD66C, 0x73F8)
+DOUBLE_BYTE_PAIR(0xD66D, 0x73F5)
+DOUBLE_BYTE_PAIR(0xD66E, 0x7404)
+DOUBLE_BYTE_PAIR(0xD66F, 0x7401)
+DOUBLE_BYTE_PAIR(0xD670, 0x73FD)
+DOUBLE_BYTE_PAIR(0xD671, 0x7407)
+DOUBLE_BYTE_PAIR(0xD672, 0x7400)
+DOUBLE_BYTE_PAIR(0xD673, 0x73FA)
+DOUBLE_BYTE_PAIR(0xD674, 0x73FC)
+DOUBLE_BYTE_PAIR(0xD675, 0x73FF)
+DOUBLE_BYTE_PAIR(0xD676, 0x740C)
+DOUBLE_BYTE_PAIR(0xD677, 0x740B)
+DOUBLE_BYTE_PAIR(0xD678, 0x73F4)
+DOUBLE_BYTE_PAIR(0xD679, 0x7408)
+DOUBLE_BYTE_PAIR(0xD67A, 0x7564)
+DOUBLE_BYTE_PAIR(0xD67B, 0x7563)
+DOUBLE_BYTE_PAIR(0xD67C, 0x75CE)
+DOUBLE_BYTE_PAIR(0xD67D, 0x75D2)
+DOUBLE_BYTE_PAIR(0xD67E, 0x75CF)
+DOUBLE_BYTE_PAIR(0xD6A1, 0x75CB)
+DOUBLE_BYTE_PAIR(0xD6A2, 0x75CC)
+DOUBLE_BYTE_PAIR(0xD6A3, 0x75D1)
+DOUBLE_BYTE_PAIR(0xD6A4, 0x75D0)
+DOUBLE_BYTE_PAIR(0xD6A5, 0x768F)
+DOUBLE_BYTE_PAIR(0xD6A6, 0x7689)
+DOUBLE_BYTE_PAIR(0xD6A7, 0x76D3)
+DOUBLE_BYTE_PAIR(0xD6A8, 0x7739)
+DOUBLE_BYTE_PAIR(0xD6A9, 0x772F)
+DOUBLE_BYTE_PAIR(0xD6AA, 0x772D)
+DOUBLE_BYTE_PAIR(0xD6AB, 0x7731)
+DOUBLE_BYTE_PAIR(0xD6AC, 0x7732)
+DOUBLE_BYTE_PAIR(0xD6AD, 0x7734)
+DOUBLE_BYTE_PAIR(0xD6AE, 0x7733)
+DOUBLE_BYTE_PAIR(0xD6AF, 0x773D)
+DOUBLE_BYTE_PAIR(0xD6B0, 0x7725)
+DOUBLE_BYTE_PAIR(0xD6B1, 0x773B)
+DOUBLE_BYTE_PAIR(0xD6B2, 0x7735)
+DOUBLE_BYTE_PAIR(0xD6B3, 0x7848)
+DOUBLE_BYTE_PAIR(0xD6B4, 0x7852)
+DOUBLE_BYTE_PAIR(0xD6B5, 0x7849)
+DOUBLE_BYTE_PAIR(0xD6B6, 0x784D)
+DOUBLE_BYTE_PAIR(0xD6B7, 0x784A)
+DOUBLE_BYTE_PAIR(0xD6B8, 0x784C)
+DOUBLE_BYTE_PAIR(0xD6B9, 0x7826)
+DOUBLE_BYTE_PAIR(0xD6BA, 0x7845)
+DOUBLE_BYTE_PAIR(0xD6BB, 0x7850)
+DOUBLE_BYTE_PAIR(0xD6BC, 0x7964)
+DOUBLE_BYTE_PAIR(0xD6BD, 0x7967)
+DOUBLE_BYTE_PAIR(0xD6BE, 0x7969)
+DOUBLE_BYTE_PAIR(0xD6BF, 0x796A)
+DOUBLE_BYTE_PAIR(0xD6C0, 0x7963)
+DOUBLE_BYTE_PAIR(0xD6C1, 0x796B)
+DOUBLE_BYTE_PAIR(0xD6C2, 0x7961)
+DOUBLE_BYTE_PAIR(0xD6C3, 0x79BB)
+DOUBLE_BYTE_PAIR(0xD6C4, 0x79FA)
+DOUBLE_BYTE_PAIR(0xD6C5, 0x79F8)
+DOUBLE_BYTE_PAIR(0xD6C6, 0x79F6)
+DOUBLE_BYTE_PAIR(0xD6C7, 0x79F7)
+DOUBLE_BYTE_PAIR(0xD6C8, 0x7A8F)
+DOUBLE_BYTE_PAIR(0xD6C9, 0x7A94)
+DOUBLE_BYTE_PAIR(0xD6CA, 0x7A90)
+DOUBLE_BYTE_PAIR(0xD6CB, 0x7B35)
+DOUBLE_BYTE_PAIR(0xD6CC, 0x7B47)
+DOUBLE_BYTE_PAIR(0xD6CD, 0x7B34)
+DOUBLE_BYTE_PAIR(0xD6CE, 0x7B25)
+DOUBLE_BYTE_PAIR(0xD6CF, 0x7B30)
+DOUBLE_BYTE_PAIR(0xD6D0, 0x7B22)
+DOUBLE_BYTE_PAIR(0xD6D1, 0x7B24)
+DOUBLE_BYTE_PAIR(0xD6D2, 0x7B33)
+DOUBLE_BYTE_PAIR(0xD6D3, 0x7B18)
+DOUBLE_BYTE_PAIR(0xD6D4, 0x7B2A)
+DOUBLE_BYTE_PAIR(0xD6D5, 0x7B1D)
+DOUBLE_BYTE_PAIR(0xD6D6, 0x7B31)
+DOUBLE_BYTE_PAIR(0xD6D7, 0x7B2B)
+DOUBLE_BYTE_PAIR(0xD6D8, 0x7B2D)
+DOUBLE_BYTE_PAIR(0xD6D9, 0x7B2F)
+DOUBLE_BYTE_PAIR(0xD6DA, 0x7B32)
+DOUBLE_BYTE_PAIR(0xD6DB, 0x7B38)
+DOUBLE_BYTE_PAIR(0xD6DC, 0x7B1A)
+DOUBLE_BYTE_PAIR(0xD6DD, 0x7B23)
+DOUBLE_BYTE_PAIR(0xD6DE, 0x7C94)
+DOUBLE_BYTE_PAIR(0xD6DF, 0x7C98)
+DOUBLE_BYTE_PAIR(0xD6E0, 0x7C96)
+DOUBLE_BYTE_PAIR(0xD6E1, 0x7CA3)
+DOUBLE_BYTE_PAIR(0xD6E2, 0x7D35)
+DOUBLE_BYTE_PAIR(0xD6E3, 0x7D3D)
+DOUBLE_BYTE_PAIR(0xD6E4, 0x7D38)
+DOUBLE_BYTE_PAIR(0xD6E5, 0x7D36)
+DOUBLE_BYTE_PAIR(0xD6E6, 0x7D3A)
+DOUBLE_BYTE_PAIR(0xD6E7, 0x7D45)
+DOUBLE_BYTE_PAIR(0xD6E8, 0x7D2C)
+DOUBLE_BYTE_PAIR(0xD6E9, 0x7D29)
+DOUBLE_BYTE_PAIR(0xD6EA, 0x7D41)
+DOUBLE_BYTE_PAIR(0xD6EB, 0x7D47)
+DOUBLE_BYTE_PAIR(0xD6EC, 0x7D3E)
+DOUBLE_BYTE_PAIR(0xD6ED, 0x7D3F)
+DOUBLE_BYTE_PAIR(0xD6EE, 0x7D4A)
+DOUBLE_BYTE_PAIR(0xD6EF, 0x7D3B)
+DOUBLE_BYTE_PAIR(0xD6F0, 0x7D28)
+DOUBLE_BYTE_PAIR(0xD6F1, 0x7F63)
+DOUBLE_BYTE_PAIR(0xD6F2, 0x7F95)
+DOUBLE_BYTE_PAIR(0xD6F3, 0x7F9C)
+DOUBLE_BYTE_PAIR(0xD6F4, 0x7F9D)
+DOUBLE_BYTE_PAIR(0xD6F5, 0x7F9B)
+DOUBLE_BYTE_PAIR(0xD6F6, 0x7FCA)
+DOUBLE_BYTE_PAIR(0xD6F7, 0x7FCB)
+DOUBLE_BYTE_PAIR(0xD6F8, 0x7FCD)
+DOUBLE_BYTE_PAIR(0xD6F9, 0x7FD0)
+DOUBLE_BYTE_PAIR(0xD6FA, 0x7FD1)
+DOUBLE_BYTE_PAIR(0xD6FB, 0x7FC7)
+DOUBLE_BYTE_PAIR(0xD6FC, 0x7FCF)
+DOUBLE_BYTE_PAIR(0xD6FD, 0x7FC9)
+DOUBLE_BYTE_PAIR(0xD6FE, 0x801F)
+DOUBLE_BYTE_PAIR(0xD740, 0x801E)
+DOUBLE_BYTE_PAIR(0xD741, 0x801B)
+DOUBLE_BYTE_PAIR(0xD742, 0x8047)
+DOUBLE_BYTE_PAIR(0xD743, 0x8043)
+DOUBLE_BYTE_PAIR(0xD744, 0x8048)
+DOUBLE_BYTE_PAIR(0xD745, 0x8118)
+DOUBLE_BYTE_PAIR(0xD746, 0x8125)
+DOUBLE_BYTE_PAIR(0xD747, 0x8119)
+DOUBLE_BYTE_PAIR(0xD748, 0x811B)
+DOUBLE_BYTE_PAIR(0xD749, 0x812D)
+DOUBLE_BYTE_PAIR(0xD74A, 0x811F)
+DOUBLE_BYTE_PAIR(0xD74B, 0x812C)
+DOUBLE_BYTE_PAIR(0xD74C, 0x811E)
+DOUBLE_BYTE_PAIR(0xD74D, 0x8121)
+DOUBLE_BYTE_PAIR(0xD74E, 0x8115)
+DOUBLE_BYTE_PAIR(0xD74F, 0x8127)
+DOUBLE_BYTE_PAIR(0xD750, 0x811D)
+DOUBLE_BYTE_PAIR(0xD751, 0x8122)
+DOUBLE_BYTE_PAIR(0xD752, 0x8211)
+DOUBLE_BYTE_PAIR(0xD753, 0x8238)
+DOUBLE_BYTE_PAIR(0xD754, 0x8233)
+DOUBLE_BYTE_PAIR(0xD755, 0x823A)
+DOUBLE_BYTE_PAIR(0xD756, 0x8234)
+DOUBLE_BYTE_PAIR(0xD757, 0x8232)
+DOUBLE_BYTE_PAIR(0xD758, 0x8274)
+DOUBLE_BYTE_PAIR(0xD759, 0x8390)
+DOUBLE_BYTE_PAIR(0xD75A, 0x83A3)
+DOUBLE_BYTE_PAIR(0xD75B, 0x83A8)
+DOUBLE_BYTE_PAIR(0xD75C, 0x838D)
+DOUBLE_BYTE_PAIR(0xD75D, 0x837A)
+DOUBLE_BYTE_PAIR(0xD75E, 0x8373)
+DOUBLE_BYTE_PAIR(0xD75F, 0x83A4)
+DOUBLE_BYTE_PAIR(0xD760, 0x8374)
+DOUBLE_BYTE_PAIR(0xD761, 0x838F)
+DOUBLE_BYTE_PAIR(0xD762, 0x8381)
+DOUBLE_BYTE_PAIR(0xD763, 0x8395)
+DOUBLE_BYTE_PAIR(0xD764, 0x8399)
+DOUBLE_BYTE_PAIR(0xD765, 0x8375)
+DOUBLE_BYTE_PAIR(0xD766, 0x8394)
+DOUBLE_BYTE_PAIR(0xD767, 0x83A9)
+DOUBLE_BYTE_PAIR(0xD768, 0x837D)
+DOUBLE_BYTE_PAIR(0xD769, 0x8383)
+DOUBLE_BYTE_PAIR(0xD76A, 0x838C)
+DOUBLE_BYTE_PAIR(0xD76B, 0x839D)
+DOUBLE_BYTE_PAIR(0xD76C, 0x839B)
+DOUBLE_BYTE_PAIR(0xD76D, 0x83AA)
+DOUBLE_BYTE_PAIR(0xD76E, 0x838B)
+DOUBLE_BYTE_PAIR(0xD76F, 0x837E)
+DOUBLE_BYTE_PAIR(0xD770, 0x83A5)
+DOUBLE_BYTE_PAIR(0xD771, 0x83AF)
+DOUBLE_BYTE_PAIR(0xD772, 0x8388)
+DOUBLE_BYTE_PAIR(0xD773, 0x8397)
+DOUBLE_BYTE_PAIR(0xD774, 0x83B0)
+DOUBLE_BYTE_PAIR(0xD775, 0x837F)
+DOUBLE_BYTE_PAIR(0xD776, 0x83A6)
+DOUBLE_BYTE_PAIR(0xD777, 0x8387)
+DOUBLE_BYTE_PAIR(0xD778, 0x83AE)
+DOUBLE_BYTE_PAIR(0xD779, 0x8376)
+DOUBLE_BYTE_PAIR(0xD77A, 0x839A)
+DOUBLE_BYTE_PAIR(0xD77B, 0x8659)
+DOUBLE_BYTE_PAIR(0xD77C, 0x8656)
+DOUBLE_BYTE_PAIR(0xD77D, 0x86BF)
+DOUBLE_BYTE_PAIR(0xD77E, 0x86B7)
+DOUBLE_BYTE_PAIR(0xD7A1, 0x86C2)
+DOUBLE_BYTE_PAIR(0xD7A2, 0x86C1)
+DOUBLE_BYTE_PAIR(0xD7A3, 0x86C5)
+DOUBLE_BYTE_PAIR(0xD7A4, 0x86BA)
+DOUBLE_BYTE_PAIR(0xD7A5, 0x86B0)
+DOUBLE_BYTE_PAIR(0xD7A6, 0x86C8)
+DOUBLE_BYTE_PAIR(0xD7A7, 0x86B9)
+DOUBLE_BYTE_PAIR(0xD7A8, 0x86B3)
+DOUBLE_BYTE_PAIR(0xD7A9, 0x86B8)
+DOUBLE_BYTE_PAIR(0xD7AA, 0x86CC)
+DOUBLE_BYTE_PAIR(0xD7AB, 0x86B4)
+DOUBLE_BYTE_PAIR(0xD7AC, 0x86BB)
+DOUBLE_BYTE_PAIR(0xD7AD, 0x86BC)
+DOUBLE_BYTE_PAIR(0xD7AE, 0x86C3)
+DOUBLE_BYTE_PAIR(0xD7AF, 0x86BD)
+DOUBLE_BYTE_PAIR(0xD7B0, 0x86BE)
+DOUBLE_BYTE_PAIR(0xD7B1, 0x8852)
+DOUBLE_BYTE_PAIR(0xD7B2, 0x8889)
+DOUBLE_BYTE_PAIR(0xD7B3, 0x8895)
+DOUBLE_BYTE_PAIR(0xD7B4, 0x88A8)
+DOUBLE_BYTE_PAIR(0xD7B5, 0x88A2)
+DOUBLE_BYTE_PAIR(0xD7B6, 0x88AA)
+DOUBLE_BYTE_PAIR(0xD7B7, 0x889A)
+DOUBLE_BYTE_PAIR(0xD7B8, 0x8891)
+DOUBLE_BYTE_PAIR(0xD7B9, 0x88A1)
+DOUBLE_BYTE_PAIR(0xD7BA, 0x889F)
+DOUBLE_BYTE_PAIR(0xD7BB, 0x8898)
+DOUBLE_BYTE_PAIR(0xD7BC, 0x88A7)
+DOUBLE_BYTE_PAIR(0xD7BD, 0x8899)
+DOUBLE_BYTE_PAIR(0xD7BE, 0x889B)
+DOUBLE_BYTE_PAIR(0xD7BF, 0x8897)
+DOUBLE_BYTE_PAIR(0xD7C0, 0x88A4)
+DOUBLE_BYTE_PAIR(0xD7C1, 0x88AC)
+DOUBLE_BYTE_PAIR(0xD7C2, 0x888C)
+DOUBLE_BYTE_PAIR(0xD7C3, 0x8893)
+DOUBLE_BYTE_PAIR(0xD7C4, 0x888E)
+DOUBLE_BYTE_PAIR(0xD7C5, 0x8982)
+DOUBLE_BYTE_PAIR(0xD7C6, 0x89D6)
+DOUBLE_BYTE_PAIR(0xD7C7, 0x89D9)
+DOUBLE_BYTE_PAIR(0xD7C8, 0x89D5)
+DOUBLE_BYTE_PAIR(0xD7C9, 0x8A30)
+DOUBLE_BYTE_PAIR(0xD7CA, 0x8A27)
+DOUBLE_BYTE_PAIR(0xD7CB, 0x8A2C)
+DOUBLE_BYTE_PAIR(0xD7CC, 0x8A1E)
+DOUBLE_BYTE_PAIR(0xD7CD, 0x8C39)
+DOUBLE_BYTE_PAIR(0xD7CE, 0x8C3B)
+DOUBLE_BYTE_PAIR(0xD7CF, 0x8C5C)
+DOUBLE_BYTE_PAIR(0xD7D0, 0x8C5D)
+DOUBLE_BYTE_PAIR(0xD7D1, 0x8C7D)
+DOUBLE_BYTE_PAIR(0xD7D2, 0x8CA5)
+DOUBLE_BYTE_PAIR(0xD7D3, 0x8D7D)
+DOUBLE_BYTE_PAIR(0xD7D4, 0x8D7B)
+DOUBLE_BYTE_PAIR(0xD7D5, 0x8D79)
+DOUBLE_BYTE_PAIR(0xD7D6, 0x8DBC)
+DOUBLE_BYTE_PAIR(0xD7D7, 0x8DC2)
+DOUBLE_BYTE_PAIR(0xD7D8, 0x8DB9)
+DOUBLE_BYTE_PAIR(0xD7D9, 0x8DBF)
+DOUBLE_BYTE_PAIR(0xD7DA, 0x8DC1)
+DOUBLE_BYTE_PAIR(0xD7DB, 0x8ED8)
+DOUBLE_BYTE_PAIR(0xD7DC, 0x8EDE)
+DOUBLE_BYTE_PAIR(0xD7DD, 0x8EDD)
+DOUBLE_BYTE_PAIR(0xD7DE, 0x8EDC)
+DOUBLE_BYTE_PAIR(0xD7DF, 0x8ED7)
+DOUBLE_BYTE_PAIR(0xD7E0, 0x8EE0)
+DOUBLE_BYTE_PAIR(0xD7E1, 0x8EE1)
+DOUBLE_BYTE_PAIR(0xD7E2, 0x9024)
+DOUBLE_BYTE_PAIR(0xD7E3, 0x900B)
+DOUBLE_BYTE_PAIR(0xD7E4, 0x9011)
+DOUBLE_BYTE_PAIR(0xD7E5, 0x901C)
+DOUBLE_BYTE_PAIR(0xD7E6, 0x900C)
+DOUBLE_BYTE_PAIR(0xD7E7, 0x9021)
+DOUBLE_BYTE_PAIR(0xD7E8, 0x90EF)
+DOUBLE_BYTE_PAIR(0xD7E9, 0x90EA)
+DOUBLE_BYTE_PAIR(0xD7EA, 0x90F0)
+DOUBLE_BYTE_PAIR(0xD7EB, 0x90F4)
+DOUBLE_BYTE_PAIR(0xD7EC, 0x90F2)
+DOUBLE_BYTE_PAIR(0xD7ED, 0x90F3)
+DOUBLE_BYTE_PAIR(0xD7EE, 0x90D4)
+DOUBLE_BYTE_PAIR(0xD7EF, 0x90EB)
+DOUBLE_BYTE_PAIR(0xD7F0, 0x90EC)
+DOUBLE_BYTE_PAIR(0xD7F1, 0x90E9)
+DOUBLE_BYTE_PAIR(0xD7F2, 0x9156)
+DOUBLE_BYTE_PAIR(0xD7F3, 0x9158)
+DOUBLE_BYTE_PAIR(0xD7F4, 0x915A)
+DOUBLE_BYTE_PAIR(0xD7F5, 0x9153)
+DOUBLE_BYTE_PAIR(0xD7F6, 0x9155)
+DOUBLE_BYTE_PAIR(0xD7F7, 0x91EC)
+DOUBLE_BYTE_PAIR(0xD7F8, 0x91F4)
+DOUBLE_BYTE_PAIR(0xD7F9, 0x91F1)
+DOUBLE_BYTE_PAIR(0xD7FA, 0x91F3)
+DOUBLE_BYTE_PAIR(0xD7FB, 0x91F8)
+DOUBLE_BYTE_PAIR(0xD7FC, 0x91E4)
+DOUBLE_BYTE_PAIR(0xD7FD, 0x91F9)
+DOUBLE_BYTE_PAIR(0xD7FE, 0x91EA)
+DOUBLE_BYTE_PAIR(0xD840, 0x91EB)
+DOUBLE_BYTE_PAIR(0xD841, 0x91F7)
+DOUBLE_BYTE_PAIR(0xD842, 0x91E8)
+DOUBLE_BYTE_PAIR(0xD843, 0x91EE)
+DOUBLE_BYTE_PAIR(0xD844, 0x957A)
+DOUBLE_BYTE_PAIR(0xD845, 0x9586)
+DOUBLE_BYTE_PAIR(0xD846, 0x9588)
+DOUBLE_BYTE_PAIR(0xD847, 0x967C)
+DOUBLE_BYTE_PAIR(0xD848, 0x966D)
+DOUBLE_BYTE_PAIR(0xD849, 0x966B)
+DOUBLE_BYTE_PAIR(0xD84A, 0x9671)
+DOUBLE_BYTE_PAIR(0xD84B, 0x966F)
+DOUBLE_BYTE_PAIR(0xD84C, 0x96BF)
+DOUBLE_BYTE_PAIR(0xD84D, 0x976A)
+DOUBLE_BYTE_PAIR(0xD84E, 0x9804)
+DOUBLE_BYTE_PAIR(0xD84F, 0x98E5)
+DOUBLE_BYTE_PAIR(0xD850, 0x9997)
+DOUBLE_BYTE_PAIR(0xD851, 0x509B)
+DOUBLE_BYTE_PAIR(0xD852, 0x5095)
+DOUBLE_BYTE_PAIR(0xD853, 0x5094)
+DOUBLE_BYTE_PAIR(0xD854, 0x509E)
+DOUBLE_BYTE_PAIR(0xD855, 0x508B)
+DOUBLE_BYTE_PAIR(0xD856, 0x50A3)
+DOUBLE_BYTE_PAIR(0xD857, 0x5083)
+DOUBLE_BYTE_PAIR(0xD858, 0x508C)
+DOUBLE_BYTE_PAIR(0xD859, 0x508E)
+DOUBLE_BYTE_PAIR(0xD85A, 0x509D)
+DOUBLE_BYTE_PAIR(0xD85B, 0x5068)
+DOUBLE_BYTE_PAIR(0xD85C, 0x509C)
+DOUBLE_BYTE_PAIR(0xD85D, 0x5092)
+DOUBLE_BYTE_PAIR(0xD85E, 0x5082)
+DOUBLE_BYTE_PAIR(0xD85F, 0x5087)
+DOUBLE_BYTE_PAIR(0xD860, 0x515F)
+DOUBLE_BYTE_PAIR(0xD861, 0x51D4)
+DOUBLE_BYTE_PAIR(0xD862, 0x5312)
+DOUBLE_BYTE_PAIR(0xD863, 0x5311)
+DOUBLE_BYTE_PAIR(0xD864, 0x53A4)
+DOUBLE_BYTE_PAIR(0xD865, 0x53A7)
+DOUBLE_BYTE_PAIR(0xD866, 0x5591)
+DOUBLE_BYTE_PAIR(0xD867, 0x55A8)
+DOUBLE_BYTE_PAIR(0xD868, 0x55A5)
+DOUBLE_BYTE_PAIR(0xD869, 0x55AD)
+DOUBLE_BYTE_PAIR(0xD86A, 0x5577)
+DOUBLE_BYTE_PAIR(0xD86B, 0x5645)
+DOUBLE_BYTE_PAIR(0xD86C, 0x55A2)
+DOUBLE_BYTE_PAIR(0xD86D, 0x5593)
+DOUBLE_BYTE_PAIR(0xD86E, 0x5588)
+DOUBLE_BYTE_PAIR(0xD86F, 0x558F)
+DOUBLE_BYTE_PAIR(0xD870, 0x55B5)
+DOUBLE_BYTE_PAIR(0xD871, 0x5581)
+DOUBLE_BYTE_PAIR(0xD872, 0x55A3)
+DOUBLE_BYTE_PAIR(0xD873, 0x5592)
+DOUBLE_BYTE_PAIR(0xD874, 0x55A4)
+DOUBLE_BYTE_PAIR(0xD875, 0x557D)
+DOUBLE_BYTE_PAIR(0xD876, 0x558C)
+DOUBLE_BYTE_PAIR(0xD877, 0x55A6)
+DOUBLE_BYTE_PAIR(0xD878, 0x557F)
+DOUBLE_BYTE_PAIR(0xD879, 0x5595)
+DOUBLE_BYTE_PAIR(0xD87A, 0x55A1)
+DOUBLE_BYTE_PAIR(0xD87B, 0x558E)
+DOUBLE_BYTE_PAIR(0xD87C, 0x570C)
+DOUBLE_BYTE_PAIR(0xD87D, 0x5829)
+DOUBLE_BYTE_PAIR(0xD87E, 0x5837)
+DOUBLE_BYTE_PAIR(0xD8A1, 0x5819)
+DOUBLE_BYTE_PAIR(0xD8A2, 0x581E)
+DOUBLE_BYTE_PAIR(0xD8A3, 0x5827)
+DOUBLE_BYTE_PAIR(0xD8A4, 0x5823)
+DOUBLE_BYTE_PAIR(0xD8A5, 0x5828)
+DOUBLE_BYTE_PAIR(0xD8A6, 0x57F5)
+DOUBLE_BYTE_PAIR(0xD8A7, 0x5848)
+DOUBLE_BYTE_PAIR(0xD8A8, 0x5825)
+DOUBLE_BYTE_PAIR(0xD8A9, 0x581C)
+DOUBLE_BYTE_PAIR(0xD8AA, 0x581B)
+DOUBLE_BYTE_PAIR(0xD8AB, 0x5833)
+DOUBLE_BYTE_PAIR(0xD8AC, 0x583F)
+DOUBLE_BYTE_PAIR(0xD8AD, 0x5836)
+DOUBLE_BYTE_PAIR(0xD8AE, 0x582E)
+DOUBLE_BYTE_PAIR(0xD8AF, 0x5839)
+DOUBLE_BYTE_PAIR(0xD8B0, 0x5838)
+DOUBLE_BYTE_PAIR(0xD8B1, 0x582D)
+DOUBLE_BYTE_PAIR(0xD8B2, 0x582C)
+DOUBLE_BYTE_PAIR(0xD8B3, 0x583B)
+DOUBLE_BYTE_PAIR(0xD8B4, 0x5961)
+DOUBLE_BYTE_PAIR(0xD8B5, 0x5AAF)
+DOUBLE_BYTE_PAIR(0xD8B6, 0x5A94)
+DOUBLE_BYTE_PAIR(0xD8B7, 0x5A9F)
+DOUBLE_BYTE_PAIR(0xD8B8, 0x5A7A)
+DOUBLE_BYTE_PAIR(0xD8B9, 0x5AA2)
+DOUBLE_BYTE_PAIR(0xD8BA, 0x5A9E)
+DOUBLE_BYTE_PAIR(0xD8BB, 0x5A78)
+DOUBLE_BYTE_PAIR(0xD8BC, 0x5AA6)
+DOUBLE_BYTE_PAIR(0xD8BD, 0x5A7C)
+DOUBLE_BYTE_PAIR(0xD8BE, 0x5AA5)
+DOUBLE_BYTE_PAIR(0xD8BF, 0x5AAC)
+DOUBLE_BYTE_PAIR(0xD8C0, 0x5A95)
+DOUBLE_BYTE_PAIR(0xD8C1, 0x5AAE)
+DOUBLE_BYTE_PAIR(0xD8C2, 0x5A37)
+DOUBLE_BYTE_PAIR(0xD8C3, 0x5A84)
+DOUBLE_BYTE_PAIR(0xD8C4, 0x5A8A)
+DOUBLE_BYTE_PAIR(0xD8C5, 0x5A97)
+DOUBLE_BYTE_PAIR(0xD8C6, 0x5A83)
+DOUBLE_BYTE_PAIR(0xD8C7, 0x5A8B)
+DOUBLE_BYTE_PAIR(0xD8C8, 0x5AA9)
+DOUBLE_BYTE_PAIR(0xD8C9, 0x5A7B)
+DOUBLE_BYTE_PAIR(0xD8CA, 0x5A7D)
+DOUBLE_BYTE_PAIR(0xD8CB, 0x5A8C)
+DOUBLE_BYTE_PAIR(0xD8CC, 0x5A9C)
+DOUBLE_BYTE_PAIR(0xD8CD, 0x5A8F)
+DOUBLE_BYTE_PAIR(0xD8CE, 0x5A93)
+DOUBLE_BYTE_PAIR(0xD8CF, 0x5A9D)
+DOUBLE_BYTE_PAIR(0xD8D0, 0x5BEA)
+DOUBLE_BYTE_PAIR(0xD8D1, 0x5BCD)
+DOUBLE_BYTE_PAIR(0xD8D2, 0x5BCB)
+DOUBLE_BYTE_PAIR(0xD8D3, 0x5BD4)
+DOUBLE_BYTE_PAIR(0xD8D4, 0x5BD1)
+DOUBLE_BYTE_PAIR(0xD8D5, 0x5BCA)
+DOUBLE_BYTE_PAIR(0xD8D6, 0x5BCE)
+DOUBLE_BYTE_PAIR(0xD8D7, 0x5C0C)
+DOUBLE_BYTE_PAIR(0xD8D8, 0x5C30)
+DOUBLE_BYTE_PAIR(0xD8D9, 0x5D37)
+DOUBLE_BYTE_PAIR(0xD8DA, 0x5D43)
+DOUBLE_BYTE_PAIR(0xD8DB, 0x5D6B)
+DOUBLE_BYTE_PAIR(0xD8DC, 0x5D41)
+DOUBLE_BYTE_PAIR(0xD8DD, 0x5D4B)
+DOUBLE_BYTE_PAIR(0xD8DE, 0x5D3F)
+DOUBLE_BYTE_PAIR(0xD8DF, 0x5D35)
+DOUBLE_BYTE_PAIR(0xD8E0, 0x5D51)
+DOUBLE_BYTE_PAIR(0xD8E1, 0x5D4E)
+DOUBLE_BYTE_PAIR(0xD8E2, 0x5D55)
+DOUBLE_BYTE_PAIR(0xD8E3, 0x5D33)
+DOUBLE_BYTE_PAIR(0xD8E4, 0x5D3A)
+DOUBLE_BYTE_PAIR(0xD8E5, 0x5D52)
+DOUBLE_BYTE_PAIR(0xD8E6, 0x5D3D)
+DOUBLE_BYTE_PAIR(0xD8E7, 0x5D31)
+DOUBLE_BYTE_PAIR(0xD8E8, 0x5D59)
+DOUBLE_BYTE_PAIR(0xD8E9, 0x5D42)
+DOUBLE_BYTE_PAIR(0xD8EA, 0x5D39)
+DOUBLE_BYTE_PAIR(0xD8EB, 0x5D49)
+DOUBLE_BYTE_PAIR(0xD8EC, 0x5D38)
+DOUBLE_BYTE_PAIR(0xD8ED, 0x5D3C)
+DOUBLE_BYTE_PAIR(0xD8EE, 0x5D32)
+DOUBLE_BYTE_PAIR(0xD8EF, 0x5D36)
+DOUBLE_BYTE_PAIR(0xD8F0, 0x5D40)
+DOUBLE_BYTE_PAIR(0xD8F1, 0x5D45)
+DOUBLE_BYTE_PAIR(0xD8F2, 0x5E44)
+DOUBLE_BYTE_PAIR(0xD8F3, 0x5E41)
+DOUBLE_BYTE_PAIR(0xD8F4, 0x5F58)
+DOUBLE_BYTE_PAIR(0xD8F5, 0x5FA6)
+DOUBLE_BYTE_PAIR(0xD8F6, 0x5FA5)
+DOUBLE_BYTE_PAIR(0xD8F7, 0x5FAB)
+DOUBLE_BYTE_PAIR(0xD8F8, 0x60C9)
+DOUBLE_BYTE_PAIR(0xD8F9, 0x60B9)
+DOUBLE_BYTE_PAIR(0xD8FA, 0x60CC)
+DOUBLE_BYTE_PAIR(0xD8FB, 0x60E2)
+DOUBLE_BYTE_PAIR(0xD8FC, 0x60CE)
+DOUBLE_BYTE_PAIR(0xD8FD, 0x60C4)
+DOUBLE_BYTE_PAIR(0xD8FE, 0x6114)
+DOUBLE_BYTE_PAIR(0xD940, 0x60F2)
+DOUBLE_BYTE_PAIR(0xD941, 0x610A)
+DOUBLE_BYTE_PAIR(0xD942, 0x6116)
+DOUBLE_BYTE_PAIR(0xD943, 0x6105)
+DOUBLE_BYTE_PAIR(0xD944, 0x60F5)
+DOUBLE_BYTE_PAIR(0xD945, 0x6113)
+DOUBLE_BYTE_PAIR(0xD946, 0x60F8)
+DOUBLE_BYTE_PAIR(0xD947, 0x60FC)
+DOUBLE_BYTE_PAIR(0xD948, 0x60FE)
+DOUBLE_BYTE_PAIR(0xD949, 0x60C1)
+DOUBLE_BYTE_PAIR(0xD94A, 0x6103)
+DOUBLE_BYTE_PAIR(0xD94B, 0x6118)
+DOUBLE_BYTE_PAIR(0xD94C, 0x611D)
+DOUBLE_BYTE_PAIR(0xD94D, 0x6110)
+DOUBLE_BYTE_PAIR(0xD94E, 0x60FF)
+DOUBLE_BYTE_PAIR(0xD94F, 0x6104)
+DOUBLE_BYTE_PAIR(0xD950, 0x610B)
+DOUBLE_BYTE_PAIR(0xD951, 0x624A)
+DOUBLE_BYTE_PAIR(0xD952, 0x6394)
+DOUBLE_BYTE_PAIR(0xD953, 0x63B1)
+DOUBLE_BYTE_PAIR(0xD954, 0x63B0)
+DOUBLE_BYTE_PAIR(0xD955, 0x63CE)
+DOUBLE_BYTE_PAIR(0xD956, 0x63E5)
+DOUBLE_BYTE_PAIR(0xD957, 0x63E8)
+DOUBLE_BYTE_PAIR(0xD958, 0x63EF)
+DOUBLE_BYTE_PAIR(0xD959, 0x63C3)
+DOUBLE_BYTE_PAIR(0xD95A, 0x649D)
+DOUBLE_BYTE_PAIR(0xD95B, 0x63F3)
+DOUBLE_BYTE_PAIR(0xD95C, 0x63CA)
+DOUBLE_BYTE_PAIR(0xD95D, 0x63E0)
+DOUBLE_BYTE_PAIR(0xD95E, 0x63F6)
+DOUBLE_BYTE_PAIR(0xD95F, 0x63D5)
+DOUBLE_BYTE_PAIR(0xD960, 0x63F2)
+DOUBLE_BYTE_PAIR(0xD961, 0x63F5)
+DOUBLE_BYTE_PAIR(0xD962, 0x6461)
+DOUBLE_BYTE_PAIR(0xD963, 0x63DF)
+DOUBLE_BYTE_PAIR(0xD964, 0x63BE)
+DOUBLE_BYTE_PAIR(0xD965, 0x63DD)
+DOUBLE_BYTE_PAIR(0xD966, 0x63DC)
+DOUBLE_BYTE_PAIR(0xD967, 0x63C4)
+DOUBLE_BYTE_PAIR(0xD968, 0x63D8)
+DOUBLE_BYTE_PAIR(0xD969, 0x63D3)
+DOUBLE_BYTE_PAIR(0xD96A, 0x63C2)
+DOUBLE_BYTE_PAIR(0xD96B, 0x63C7)
+DOUBLE_BYTE_PAIR(0xD96C, 0x63CC)
+DOUBLE_BYTE_PAIR(0xD96D, 0x63CB)
+DOUBLE_BYTE_PAIR(0xD96E, 0x63C8)
+DOUBLE_BYTE_PAIR(0xD96F, 0x63F0)
+DOUBLE_BYTE_PAIR(0xD970, 0x63D7)
+DOUBLE_BYTE_PAIR(0xD971, 0x63D9)
+DOUBLE_BYTE_PAIR(0xD972, 0x6532)
+DOUBLE_BYTE_PAIR(0xD973, 0x6567)
+DOUBLE_BYTE_PAIR(0xD974, 0x656A)
+DOUBLE_BYTE_PAIR(0xD975, 0x6564)
+DOUBLE_BYTE_PAIR(0xD976, 0x655C)
+DOUBLE_BYTE_PAIR(0xD977, 0x6568)
+DOUBLE_BYTE_PAIR(0xD978, 0x6565)
+DOUBLE_BYTE_PAIR(0xD979, 0x658C)
+DOUBLE_BYTE_PAIR(0xD97A, 0x659D)
+DOUBLE_BYTE_PAIR(0xD97B, 0x659E)
+DOUBLE_BYTE_PAIR(0xD97C, 0x65AE)
+DOUBLE_BYTE_PAIR(0xD97D, 0x65D0)
+DOUBLE_BYTE_PAIR(0xD97E, 0x65D2)
+DOUBLE_BYTE_PAIR(0xD9A1, 0x667C)
+DOUBLE_BYTE_PAIR(0xD9A2, 0x666C)
+DOUBLE_BYTE_PAIR(0xD9A3, 0x667B)
+DOUBLE_BYTE_PAIR(0xD9A4, 0x6680)
+DOUBLE_BYTE_PAIR(0xD9A5, 0x6671)
+DOUBLE_BYTE_PAIR(0xD9A6, 0x6679)
+DOUBLE_BYTE_PAIR(0xD9A7, 0x666A)
+DOUBLE_BYTE_PAIR(0xD9A8, 0x6672)
+DOUBLE_BYTE_PAIR(0xD9A9, 0x6701)
+DOUBLE_BYTE_PAIR(0xD9AA, 0x690C)
+DOUBLE_BYTE_PAIR(0xD9AB, 0x68D3)
+DOUBLE_BYTE_PAIR(0xD9AC, 0x6904)
+DOUBLE_BYTE_PAIR(0xD9AD, 0x68DC)
+DOUBLE_BYTE_PAIR(0xD9AE, 0x692A)
+DOUBLE_BYTE_PAIR(0xD9AF, 0x68EC)
+DOUBLE_BYTE_PAIR(0xD9B0, 0x68EA)
+DOUBLE_BYTE_PAIR(0xD9B1, 0x68F1)
+DOUBLE_BYTE_PAIR(0xD9B2, 0x690F)
+DOUBLE_BYTE_PAIR(0xD9B3, 0x68D6)
+DOUBLE_BYTE_PAIR(0xD9B4, 0x68F7)
+DOUBLE_BYTE_PAIR(0xD9B5, 0x68EB)
+DOUBLE_BYTE_PAIR(0xD9B6, 0x68E4)
+DOUBLE_BYTE_PAIR(0xD9B7, 0x68F6)
+DOUBLE_BYTE_PAIR(0xD9B8, 0x6913)
+DOUBLE_BYTE_PAIR(0xD9B9, 0x6910)
+DOUBLE_BYTE_PAIR(0xD9BA, 0x68F3)
+DOUBLE_BYTE_PAIR(0xD9BB, 0x68E1)
+DOUBLE_BYTE_PAIR(0xD9BC, 0x6907)
+DOUBLE_BYTE_PAIR(0xD9BD, 0x68CC)
+DOUBLE_BYTE_PAIR(0xD9BE, 0x6908)
+DOUBLE_BYTE_PAIR(0xD9BF, 0x6970)
+DOUBLE_BYTE_PAIR(0xD9C0, 0x68B4)
+DOUBLE_BYTE_PAIR(0xD9C1, 0x6911)
+DOUBLE_BYTE_PAIR(0xD9C2, 0x68EF)
+DOUBLE_BYTE_PAIR(0xD9C3, 0x68C6)
+DOUBLE_BYTE_PAIR(0xD9C4, 0x6914)
+DOUBLE_BYTE_PAIR(0xD9C5, 0x68F8)
+DOUBLE_BYTE_PAIR(0xD9C6, 0x68D0)
+DOUBLE_BYTE_PAIR(0xD9C7, 0x68FD)
+DOUBLE_BYTE_PAIR(0xD9C8, 0x68FC)
+DOUBLE_BYTE_PAIR(0xD9C9, 0x68E8)
+DOUBLE_BYTE_PAIR(0xD9CA, 0x690B)
+DOUBLE_BYTE_PAIR(0xD9CB, 0x690A)
+DOUBLE_BYTE_PAIR(0xD9CC, 0x6917)
+DOUBLE_BYTE_PAIR(0xD9CD, 0x68CE)
+DOUBLE_BYTE_PAIR(0xD9CE, 0x68C8)
+DOUBLE_BYTE_PAIR(0xD9CF, 0x68DD)
+DOUBLE_BYTE_PAIR(0xD9D0, 0x68DE)
+DOUBLE_BYTE_PAIR(0xD9D1, 0x68E6)
+DOUBLE_BYTE_PAIR(0xD9D2, 0x68F4)
+DOUBLE_BYTE_PAIR(0xD9D3, 0x68D1)
+DOUBLE_BYTE_PAIR(0xD9D4, 0x6906)
+DOUBLE_BYTE_PAIR(0xD9D5, 0x68D4)
+DOUBLE_BYTE_PAIR(0xD9D6, 0x68E9)
+DOUBLE_BYTE_PAIR(0xD9D7, 0x6915)
+DOUBLE_BYTE_PAIR(0xD9D8, 0x6925)
+DOUBLE_BYTE_PAIR(0xD9D9, 0x68C7)
+DOUBLE_BYTE_PAIR(0xD9DA, 0x6B39)
+DOUBLE_BYTE_PAIR(0xD9DB, 0x6B3B)
+DOUBLE_BYTE_PAIR(0xD9DC, 0x6B3F)
+DOUBLE_BYTE_PAIR(0xD9DD, 0x6B3C)
+DOUBLE_BYTE_PAIR(0xD9DE, 0x6B94)
+DOUBLE_BYTE_PAIR(0xD9DF, 0x6B97)
+DOUBLE_BYTE_PAIR(0xD9E0, 0x6B99)
+DOUBLE_BYTE_PAIR(0xD9E1, 0x6B95)
+DOUBLE_BYTE_PAIR(0xD9E2, 0x6BBD)
+DOUBLE_BYTE_PAIR(0xD9E3, 0x6BF0)
+DOUBLE_BYTE_PAIR(0xD9E4, 0x6BF2)
+DOUBLE_BYTE_PAIR(0xD9E5, 0x6BF3)
+DOUBLE_BYTE_PAIR(0xD9E6, 0x6C30)
+DOUBLE_BYTE_PAIR(0xD9E7, 0x6DFC)
+DOUBLE_BYTE_PAIR(0xD9E8, 0x6E46)
+DOUBLE_BYTE_PAIR(0xD9E9, 0x6E47)
+DOUBLE_BYTE_PAIR(0xD9EA, 0x6E1F)
+DOUBLE_BYTE_PAIR(0xD9EB, 0x6E49)
+DOUBLE_BYTE_PAIR(0xD9EC, 0x6E88)
+DOUBLE_BYTE_PAIR(0xD9ED, 0x6E3C)
+DOUBLE_BYTE_PAIR(0xD9EE, 0x6E3D)
+DOUBLE_BYTE_PAIR(0xD9EF, 0x6E45)
+DOUBLE_BYTE_PAIR(0xD9F0, 0x6E62)
+DOUBLE_BYTE_PAIR(0xD9F1, 0x6E2B)
+DOUBLE_BYTE_PAIR(0xD9F2, 0x6E3F)
+DOUBLE_BYTE_PAIR(0xD9F3, 0x6E41)
+DOUBLE_BYTE_PAIR(0xD9F4, 0x6E5D)
+DOUBLE_BYTE_PAIR(0xD9F5, 0x6E73)
+DOUBLE_BYTE_PAIR(0xD9F6, 0x6E1C)
+DOUBLE_BYTE_PAIR(0xD9F7, 0x6E33)
+DOUBLE_BYTE_PAIR(0xD9F8, 0x6E4B)
+DOUBLE_BYTE_PAIR(0xD9F9, 0x6E40)
+DOUBLE_BYTE_PAIR(0xD9FA, 0x6E51)
+DOUBLE_BYTE_PAIR(0xD9FB, 0x6E3B)
+DOUBLE_BYTE_PAIR(0xD9FC, 0x6E03)
+DOUBLE_BYTE_PAIR(0xD9FD, 0x6E2E)
+DOUBLE_BYTE_PAIR(0xD9FE, 0x6E5E)
+DOUBLE_BYTE_PAIR(0xDA40, 0x6E68)
+DOUBLE_BYTE_PAIR(0xDA41, 0x6E5C)
+DOUBLE_BYTE_PAIR(0xDA42, 0x6E61)
+DOUBLE_BYTE_PAIR(0xDA43, 0x6E31)
+DOUBLE_BYTE_PAIR(0xDA44, 0x6E28)
+DOUBLE_BYTE_PAIR(0xDA45, 0x6E60)
+DOUBLE_BYTE_PAIR(0xDA46, 0x6E71)
+DOUBLE_BYTE_PAIR(0xDA47, 0x6E6B)
+DOUBLE_BYTE_PAIR(0xDA48, 0x6E39)
+DOUBLE_BYTE_PAIR(0xDA49, 0x6E22)
+DOUBLE_BYTE_PAIR(0xDA4A, 0x6E30)
+DOUBLE_BYTE_PAIR(0xDA4B, 0x6E53)
+DOUBLE_BYTE_PAIR(0xDA4C, 0x6E65)
+DOUBLE_BYTE_PAIR(0xDA4D, 0x6E27)
+DOUBLE_BYTE_PAIR(0xDA4E, 0x6E78)
+DOUBLE_BYTE_PAIR(0xDA4F, 0x6E64)
+DOUBLE_BYTE_PAIR(0xDA50, 0x6E77)
+DOUBLE_BYTE_PAIR(0xDA51, 0x6E55)
+DOUBLE_BYTE_PAIR(0xDA52, 0x6E79)
+DOUBLE_BYTE_PAIR(0xDA53, 0x6E52)
+DOUBLE_BYTE_PAIR(0xDA54, 0x6E66)
+DOUBLE_BYTE_PAIR(0xDA55, 0x6E35)
+DOUBLE_BYTE_PAIR(0xDA56, 0x6E36)
+DOUBLE_BYTE_PAIR(0xDA57, 0x6E5A)
+DOUBLE_BYTE_PAIR(0xDA58, 0x7120)
+DOUBLE_BYTE_PAIR(0xDA59, 0x711E)
+DOUBLE_BYTE_PAIR(0xDA5A, 0x712F)
+DOUBLE_BYTE_PAIR(0xDA5B, 0x70FB)
+DOUBLE_BYTE_PAIR(0xDA5C, 0x712E)
+DOUBLE_BYTE_PAIR(0xDA5D, 0x7131)
+DOUBLE_BYTE_PAIR(0xDA5E, 0x7123)
+DOUBLE_BYTE_PAIR(0xDA5F, 0x7125)
+DOUBLE_BYTE_PAIR(0xDA60, 0x7122)
+DOUBLE_BYTE_PAIR(0xDA61, 0x7132)
+DOUBLE_BYTE_PAIR(0xDA62, 0x711F)
+DOUBLE_BYTE_PAIR(0xDA63, 0x7128)
+DOUBLE_BYTE_PAIR(0xDA64, 0x713A)
+DOUBLE_BYTE_PAIR(0xDA65, 0x711B)
+DOUBLE_BYTE_PAIR(0xDA66, 0x724B)
+DOUBLE_BYTE_PAIR(0xDA67, 0x725A)
+DOUBLE_BYTE_PAIR(0xDA68, 0x7288)
+DOUBLE_BYTE_PAIR(0xDA69, 0x7289)
+DOUBLE_BYTE_PAIR(0xDA6A, 0x7286)
+DOUBLE_BYTE_PAIR(0xDA6B, 0x7285)
+DOUBLE_BYTE_PAIR(0xDA6C, 0x728B)
+DOUBLE_BYTE_PAIR(0xDA6D, 0x7312)
+DOUBLE_BYTE_PAIR(0xDA6E, 0x730B)
+DOUBLE_BYTE_PAIR(0xDA6F, 0x7330)
+DOUBLE_BYTE_PAIR(0xDA70, 0x7322)
+DOUBLE_BYTE_PAIR(0xDA71, 0x7331)
+DOUBLE_BYTE_PAIR(0xDA72, 0x7333)
+DOUBLE_BYTE_PAIR(0xDA73, 0x7327)
+DOUBLE_BYTE_PAIR(0xDA74, 0x7332)
+DOUBLE_BYTE_PAIR(0xDA75, 0x732D)
+DOUBLE_BYTE_PAIR(0xDA76, 0x7326)
+DOUBLE_BYTE_PAIR(0xDA77, 0x7323)
+DOUBLE_BYTE_PAIR(0xDA78, 0x7335)
+DOUBLE_BYTE_PAIR(0xDA79, 0x730C)
+DOUBLE_BYTE_PAIR(0xDA7A, 0x742E)
+DOUBLE_BYTE_PAIR(0xDA7B, 0x742C)
+DOUBLE_BYTE_PAIR(0xDA7C, 0x7430)
+DOUBLE_BYTE_PAIR(0xDA7D, 0x742B)
+DOUBLE_BYTE_PAIR(0xDA7E, 0x7416)
+DOUBLE_BYTE_PAIR(0xDAA1, 0x741A)
+DOUBLE_BYTE_PAIR(0xDAA2, 0x7421)
+DOUBLE_BYTE_PAIR(0xDAA3, 0x742D)
+DOUBLE_BYTE_PAIR(0xDAA4, 0x7431)
+DOUBLE_BYTE_PAIR(0xDAA5, 0x7424)
+DOUBLE_BYTE_PAIR(0xDAA6, 0x7423)
+DOUBLE_BYTE_PAIR(0xDAA7, 0x741D)
+DOUBLE_BYTE_PAIR(0xDAA8, 0x7429)
+DOUBLE_BYTE_PAIR(0xDAA9, 0x7420)
+DOUBLE_BYTE_PAIR(0xDAAA, 0x7432)
+DOUBLE_BYTE_PAIR(0xDAAB, 0x74FB)
+DOUBLE_BYTE_PAIR(0xDAAC, 0x752F)
+DOUBLE_BYTE_PAIR(0xDAAD, 0x756F)
+DOUBLE_BYTE_PAIR(0xDAAE, 0x756C)
+DOUBLE_BYTE_PAIR(0xDAAF, 0x75E7)
+DOUBLE_BYTE_PAIR(0xDAB0, 0x75DA)
+DOUBLE_BYTE_PAIR(0xDAB1, 0x75E1)
+DOUBLE_BYTE_PAIR(0xDAB2, 0x75E6)
+DOUBLE_BYTE_PAIR(0xDAB3, 0x75DD)
+DOUBLE_BYTE_PAIR(0xDAB4, 0x75DF)
+DOUBLE_BYTE_PAIR(0xDAB5, 0x75E4)
+DOUBLE_BYTE_PAIR(0xDAB6, 0x75D7)
+DOUBLE_BYTE_PAIR(0xDAB7, 0x7695)
+DOUBLE_BYTE_PAIR(0xDAB8, 0x7692)
+DOUBLE_BYTE_PAIR(0xDAB9, 0x76DA)
+DOUBLE_BYTE_PAIR(0xDABA, 0x7746)
+DOUBLE_BYTE_PAIR(0xDABB, 0x7747)
+DOUBLE_BYTE_PAIR(0xDABC, 0x7744)
+DOUBLE_BYTE_PAIR(0xDABD, 0x774D)
+DOUBLE_BYTE_PAIR(0xDABE, 0x7745)
+DOUBLE_BYTE_PAIR(0xDABF, 0x774A)
+DOUBLE_BYTE_PAIR(0xDAC0, 0x774E)
+DOUBLE_BYTE_PAIR(0xDAC1, 0x774B)
+DOUBLE_BYTE_PAIR(0xDAC2, 0x774C)
+DOUBLE_BYTE_PAIR(0xDAC3, 0x77DE)
+DOUBLE_BYTE_PAIR(0xDAC4, 0x77EC)
+DOUBLE_BYTE_PAIR(0xDAC5, 0x7860)
+DOUBLE_BYTE_PAIR(0xDAC6, 0x7864)
+DOUBLE_BYTE_PAIR(0xDAC7, 0x7865)
+DOUBLE_BYTE_PAIR(0xDAC8, 0x785C)
+DOUBLE_BYTE_PAIR(0xDAC9, 0x786D)
+DOUBLE_BYTE_PAIR(0xDACA, 0x7871)
+DOUBLE_BYTE_PAIR(0xDACB, 0x786A)
+DOUBLE_BYTE_PAIR(0xDACC, 0x786E)
+DOUBLE_BYTE_PAIR(0xDACD, 0x7870)
+DOUBLE_BYTE_PAIR(0xDACE, 0x7869)
+DOUBLE_BYTE_PAIR(0xDACF, 0x7868)
+DOUBLE_BYTE_PAIR(0xDAD0, 0x785E)
+DOUBLE_BYTE_PAIR(0xDAD1, 0x7862)
+DOUBLE_BYTE_PAIR(0xDAD2, 0x7974)
+DOUBLE_BYTE_PAIR(0xDAD3, 0x7973)
+DOUBLE_BYTE_PAIR(0xDAD4, 0x7972)
+DOUBLE_BYTE_PAIR(0xDAD5, 0x7970)
+DOUBLE_BYTE_PAIR(0xDAD6, 0x7A02)
+DOUBLE_BYTE_PAIR(0xDAD7, 0x7A0A)
+DOUBLE_BYTE_PAIR(0xDAD8, 0x7A03)
+DOUBLE_BYTE_PAIR(0xDAD9, 0x7A0C)
+DOUBLE_BYTE_PAIR(0xDADA, 0x7A04)
+DOUBLE_BYTE_PAIR(0xDADB, 0x7A99)
+DOUBLE_BYTE_PAIR(0xDADC, 0x7AE6)
+DOUBLE_BYTE_PAIR(0xDADD, 0x7AE4)
+DOUBLE_BYTE_PAIR(0xDADE, 0x7B4A)
+DOUBLE_BYTE_PAIR(0xDADF, 0x7B3B)
+DOUBLE_BYTE_PAIR(0xDAE0, 0x7B44)
+DOUBLE_BYTE_PAIR(0xDAE1, 0x7B48)
+DOUBLE_BYTE_PAIR(0xDAE2, 0x7B4C)
+DOUBLE_BYTE_PAIR(0xDAE3, 0x7B4E)
+DOUBLE_BYTE_PAIR(0xDAE4, 0x7B40)
+DOUBLE_BYTE_PAIR(0xDAE5, 0x7B58)
+DOUBLE_BYTE_PAIR(0xDAE6, 0x7B45)
+DOUBLE_BYTE_PAIR(0xDAE7, 0x7CA2)
+DOUBLE_BYTE_PAIR(0xDAE8, 0x7C9E)
+DOUBLE_BYTE_PAIR(0xDAE9, 0x7CA8)
+DOUBLE_BYTE_PAIR(0xDAEA, 0x7CA1)
+DOUBLE_BYTE_PAIR(0xDAEB, 0x7D58)
+DOUBLE_BYTE_PAIR(0xDAEC, 0x7D6F)
+DOUBLE_BYTE_PAIR(0xDAED, 0x7D63)
+DOUBLE_BYTE_PAIR(0xDAEE, 0x7D53)
+DOUBLE_BYTE_PAIR(0xDAEF, 0x7D56)
+DOUBLE_BYTE_PAIR(0xDAF0, 0x7D67)
+DOUBLE_BYTE_PAIR(0xDAF1, 0x7D6A)
+DOUBLE_BYTE_PAIR(0xDAF2, 0x7D4F)
+DOUBLE_BYTE_PAIR(0xDAF3, 0x7D6D)
+DOUBLE_BYTE_PAIR(0xDAF4, 0x7D5C)
+DOUBLE_BYTE_PAIR(0xDAF5, 0x7D6B)
+DOUBLE_BYTE_PAIR(0xDAF6, 0x7D52)
+DOUBLE_BYTE_PAIR(0xDAF7, 0x7D54)
+DOUBLE_BYTE_PAIR(0xDAF8, 0x7D69)
+DOUBLE_BYTE_PAIR(0xDAF9, 0x7D51)
+DOUBLE_BYTE_PAIR(0xDAFA, 0x7D5F)
+DOUBLE_BYTE_PAIR(0xDAFB, 0x7D4E)
+DOUBLE_BYTE_PAIR(0xDAFC, 0x7F3E)
+DOUBLE_BYTE_PAIR(0xDAFD, 0x7F3F)
+DOUBLE_BYTE_PAIR(0xDAFE, 0x7F65)
+DOUBLE_BYTE_PAIR(0xDB40, 0x7F66)
+DOUBLE_BYTE_PAIR(0xDB41, 0x7FA2)
+DOUBLE_BYTE_PAIR(0xDB42, 0x7FA0)
+DOUBLE_BYTE_PAIR(0xDB43, 0x7FA1)
+DOUBLE_BYTE_PAIR(0xDB44, 0x7FD7)
+DOUBLE_BYTE_PAIR(0xDB45, 0x8051)
+DOUBLE_BYTE_PAIR(0xDB46, 0x804F)
+DOUBLE_BYTE_PAIR(0xDB47, 0x8050)
+DOUBLE_BYTE_PAIR(0xDB48, 0x80FE)
+DOUBLE_BYTE_PAIR(0xDB49, 0x80D4)
+DOUBLE_BYTE_PAIR(0xDB4A, 0x8143)
+DOUBLE_BYTE_PAIR(0xDB4B, 0x814A)
+DOUBLE_BYTE_PAIR(0xDB4C, 0x8152)
+DOUBLE_BYTE_PAIR(0xDB4D, 0x814F)
+DOUBLE_BYTE_PAIR(0xDB4E, 0x8147)
+DOUBLE_BYTE_PAIR(0xDB4F, 0x813D)
+DOUBLE_BYTE_PAIR(0xDB50, 0x814D)
+DOUBLE_BYTE_PAIR(0xDB51, 0x813A)
+DOUBLE_BYTE_PAIR(0xDB52, 0x81E6)
+DOUBLE_BYTE_PAIR(0xDB53, 0x81EE)
+DOUBLE_BYTE_PAIR(0xDB54, 0x81F7)
+DOUBLE_BYTE_PAIR(0xDB55, 0x81F8)
+DOUBLE_BYTE_PAIR(0xDB56, 0x81F9)
+DOUBLE_BYTE_PAIR(0xDB57, 0x8204)
+DOUBLE_BYTE_PAIR(0xDB58, 0x823C)
+DOUBLE_BYTE_PAIR(0xDB59, 0x823D)
+DOUBLE_BYTE_PAIR(0xDB5A, 0x823F)
+DOUBLE_BYTE_PAIR(0xDB5B, 0x8275)
+DOUBLE_BYTE_PAIR(0xDB5C, 0x833B)
+DOUBLE_BYTE_PAIR(0xDB5D, 0x83CF)
+DOUBLE_BYTE_PAIR(0xDB5E, 0x83F9)
+DOUBLE_BYTE_PAIR(0xDB5F, 0x8423)
+DOUBLE_BYTE_PAIR(0xDB60, 0x83C0)
+DOUBLE_BYTE_PAIR(0xDB61, 0x83E8)
+DOUBLE_BYTE_PAIR(0xDB62, 0x8412)
+DOUBLE_BYTE_PAIR(0xDB63, 0x83E7)
+DOUBLE_BYTE_PAIR(0xDB64, 0x83E4)
+DOUBLE_BYTE_PAIR(0xDB65, 0x83FC)
+DOUBLE_BYTE_PAIR(0xDB66, 0x83F6)
+DOUBLE_BYTE_PAIR(0xDB67, 0x8410)
+DOUBLE_BYTE_PAIR(0xDB68, 0x83C6)
+DOUBLE_BYTE_PAIR(0xDB69, 0x83C8)
+DOUBLE_BYTE_PAIR(0xDB6A, 0x83EB)
+DOUBLE_BYTE_PAIR(0xDB6B, 0x83E3)
+DOUBLE_BYTE_PAIR(0xDB6C, 0x83BF)
+DOUBLE_BYTE_PAIR(0xDB6D, 0x8401)
+DOUBLE_BYTE_PAIR(0xDB6E, 0x83DD)
+DOUBLE_BYTE_PAIR(0xDB6F, 0x83E5)
+DOUBLE_BYTE_PAIR(0xDB70, 0x83D8)
+DOUBLE_BYTE_PAIR(0xDB71, 0x83FF)
+DOUBLE_BYTE_PAIR(0xDB72, 0x83E1)
+DOUBLE_BYTE_PAIR(0xDB73, 0x83CB)
+DOUBLE_BYTE_PAIR(0xDB74, 0x83CE)
+DOUBLE_BYTE_PAIR(0xDB75, 0x83D6)
+DOUBLE_BYTE_PAIR(0xDB76, 0x83F5)
+DOUBLE_BYTE_PAIR(0xDB77, 0x83C9)
+DOUBLE_BYTE_PAIR(0xDB78, 0x8409)
+DOUBLE_BYTE_PAIR(0xDB79, 0x840F)
+DOUBLE_BYTE_PAIR(0xDB7A, 0x83DE)
+DOUBLE_BYTE_PAIR(0xDB7B, 0x8411)
+DOUBLE_BYTE_PAIR(0xDB7C, 0x8406)
+DOUBLE_BYTE_PAIR(0xDB7D, 0x83C2)
+DOUBLE_BYTE_PAIR(0xDB7E, 0x83F3)
+DOUBLE_BYTE_PAIR(0xDBA1, 0x83D5)
+DOUBLE_BYTE_PAIR(0xDBA2, 0x83FA)
+DOUBLE_BYTE_PAIR(0xDBA3, 0x83C7)
+DOUBLE_BYTE_PAIR(0xDBA4, 0x83D1)
+DOUBLE_BYTE_PAIR(0xDBA5, 0x83EA)
+DOUBLE_BYTE_PAIR(0xDBA6, 0x8413)
+DOUBLE_BYTE_PAIR(0xDBA7, 0x83C3)
+DOUBLE_BYTE_PAIR(0xDBA8, 0x83EC)
+DOUBLE_BYTE_PAIR(0xDBA9, 0x83EE)
+DOUBLE_BYTE_PAIR(0xDBAA, 0x83C4)
+DOUBLE_BYTE_PAIR(0xDBAB, 0x83FB)
+DOUBLE_BYTE_PAIR(0xDBAC, 0x83D7)
+DOUBLE_BYTE_PAIR(0xDBAD, 0x83E2)
+DOUBLE_BYTE_PAIR(0xDBAE, 0x841B)
+DOUBLE_BYTE_PAIR(0xDBAF, 0x83DB)
+DOUBLE_BYTE_PAIR(0xDBB0, 0x83FE)
+DOUBLE_BYTE_PAIR(0xDBB1, 0x86D8)
+DOUBLE_BYTE_PAIR(0xDBB2, 0x86E2)
+DOUBLE_BYTE_PAIR(0xDBB3, 0x86E6)
+DOUBLE_BYTE_PAIR(0xDBB4, 0x86D3)
+DOUBLE_BYTE_PAIR(0xDBB5, 0x86E3)
+DOUBLE_BYTE_PAIR(0xDBB6, 0x86DA)
+DOUBLE_BYTE_PAIR(0xDBB7, 0x86EA)
+DOUBLE_BYTE_PAIR(0xDBB8, 0x86DD)
+DOUBLE_BYTE_PAIR(0xDBB9, 0x86EB)
+DOUBLE_BYTE_PAIR(0xDBBA, 0x86DC)
+DOUBLE_BYTE_PAIR(0xDBBB, 0x86EC)
+DOUBLE_BYTE_PAIR(0xDBBC, 0x86E9)
+DOUBLE_BYTE_PAIR(0xDBBD, 0x86D7)
+DOUBLE_BYTE_PAIR(0xDBBE, 0x86E8)
+DOUBLE_BYTE_PAIR(0xDBBF, 0x86D1)
+DOUBLE_BYTE_PAIR(0xDBC0, 0x8848)
+DOUBLE_BYTE_PAIR(0xDBC1, 0x8856)
+DOUBLE_BYTE_PAIR(0xDBC2, 0x8855)
+DOUBLE_BYTE_PAIR(0xDBC3, 0x88BA)
+DOUBLE_BYTE_PAIR(0xDBC4, 0x88D7)
+DOUBLE_BYTE_PAIR(0xDBC5, 0x88B9)
+DOUBLE_BYTE_PAIR(0xDBC6, 0x88B8)
+DOUBLE_BYTE_PAIR(0xDBC7, 0x88C0)
+DOUBLE_BYTE_PAIR(0xDBC8, 0x88BE)
+DOUBLE_BYTE_PAIR(0xDBC9, 0x88B6)
+DOUBLE_BYTE_PAIR(0xDBCA, 0x88BC)
+DOUBLE_BYTE_PAIR(0xDBCB, 0x88B7)
+DOUBLE_BYTE_PAIR(0xDBCC, 0x88BD)
+DOUBLE_BYTE_PAIR(0xDBCD, 0x88B2)
+DOUBLE_BYTE_PAIR(0xDBCE, 0x8901)
+DOUBLE_BYTE_PAIR(0xDBCF, 0x88C9)
+DOUBLE_BYTE_PAIR(0xDBD0, 0x8995)
+DOUBLE_BYTE_PAIR(0xDBD1, 0x8998)
+DOUBLE_BYTE_PAIR(0xDBD2, 0x8997)
+DOUBLE_BYTE_PAIR(0xDBD3, 0x89DD)
+DOUBLE_BYTE_PAIR(0xDBD4, 0x89DA)
+DOUBLE_BYTE_PAIR(0xDBD5, 0x89DB)
+DOUBLE_BYTE_PAIR(0xDBD6, 0x8A4E)
+DOUBLE_BYTE_PAIR(0xDBD7, 0x8A4D)
+DOUBLE_BYTE_PAIR(0xDBD8, 0x8A39)
+DOUBLE_BYTE_PAIR(0xDBD9, 0x8A59)
+DOUBLE_BYTE_PAIR(0xDBDA, 0x8A40)
+DOUBLE_BYTE_PAIR(0xDBDB, 0x8A57)
+DOUBLE_BYTE_PAIR(0xDBDC, 0x8A58)
+DOUBLE_BYTE_PAIR(0xDBDD, 0x8A44)
+DOUBLE_BYTE_PAIR(0xDBDE, 0x8A45)
+DOUBLE_BYTE_PAIR(0xDBDF, 0x8A52)
+DOUBLE_BYTE_PAIR(0xDBE0, 0x8A48)
+DOUBLE_BYTE_PAIR(0xDBE1, 0x8A51)
+DOUBLE_BYTE_PAIR(0xDBE2, 0x8A4A)
+DOUBLE_BYTE_PAIR(0xDBE3, 0x8A4C)
+DOUBLE_BYTE_PAIR(0xDBE4, 0x8A4F)
+DOUBLE_BYTE_PAIR(0xDBE5, 0x8C5F)
+DOUBLE_BYTE_PAIR(0xDBE6, 0x8C81)
+DOUBLE_BYTE_PAIR(0xDBE7, 0x8C80)
+DOUBLE_BYTE_PAIR(0xDBE8, 0x8CBA)
+DOUBLE_BYTE_PAIR(0xDBE9, 0x8CBE)
+DOUBLE_BYTE_PAIR(0xDBEA, 0x8CB0)
+DOUBLE_BYTE_PAIR(0xDBEB, 0x8CB9)
+DOUBLE_BYTE_PAIR(0xDBEC, 0x8CB5)
+DOUBLE_BYTE_PAIR(0xDBED, 0x8D84)
+DOUBLE_BYTE_PAIR(0xDBEE, 0x8D80)
+DOUBLE_BYTE_PAIR(0xDBEF, 0x8D89)
+DOUBLE_BYTE_PAIR(0xDBF0, 0x8DD8)
+DOUBLE_BYTE_PAIR(0xDBF1, 0x8DD3)
+DOUBLE_BYTE_PAIR(0xDBF2, 0x8DCD)
+DOUBLE_BYTE_PAIR(0xDBF3, 0x8DC7)
+DOUBLE_BYTE_PAIR(0xDBF4, 0x8DD6)
+DOUBLE_BYTE_PAIR(0xDBF5, 0x8DDC)
+DOUBLE_BYTE_PAIR(0xDBF6, 0x8DCF)
+DOUBLE_BYTE_PAIR(0xDBF7, 0x8DD5)
+DOUBLE_BYTE_PAIR(0xDBF8, 0x8DD9)
+DOUBLE_BYTE_PAIR(0xDBF9, 0x8DC8)
+DOUBLE_BYTE_PAIR(0xDBFA, 0x8DD7)
+DOUBLE_BYTE_PAIR(0xDBFB, 0x8DC5)
+DOUBLE_BYTE_PAIR(0xDBFC, 0x8EEF)
+DOUBLE_BYTE_PAIR(0xDBFD, 0x8EF7)
+DOUBLE_BYTE_PAIR(0xDBFE, 0x8EFA)
+DOUBLE_BYTE_PAIR(0xDC40, 0x8EF9)
+DOUBLE_BYTE_PAIR(0xDC41, 0x8EE6)
+DOUBLE_BYTE_PAIR(0xDC42, 0x8EEE)
+DOUBLE_BYTE_PAIR(0xDC43, 0x8EE5)
+DOUBLE_BYTE_PAIR(0xDC44, 0x8EF5)
+DOUBLE_BYTE_PAIR(0xDC45, 0x8EE7)
+DOUBLE_BYTE_PAIR(0xDC46, 0x8EE8)
+DOUBLE_BYTE_PAIR(0xDC47, 0x8EF6)
+DOUBLE_BYTE_PAIR(0xDC48, 0x8EEB)
+DOUBLE_BYTE_PAIR(0xDC49, 0x8EF1)
+DOUBLE_BYTE_PAIR(0xDC4A, 0x8EEC)
+DOUBLE_BYTE_PAIR(0xDC4B, 0x8EF4)
+DOUBLE_BYTE_PAIR(0xDC4C, 0x8EE9)
+DOUBLE_BYTE_PAIR(0xDC4D, 0x902D)
+DOUBLE_BYTE_PAIR(0xDC4E, 0x9034)
+DOUBLE_BYTE_PAIR(0xDC4F, 0x902F)
+DOUBLE_BYTE_PAIR(0xDC50, 0x9106)
+DOUBLE_BYTE_PAIR(0xDC51, 0x912C)
+DOUBLE_BYTE_PAIR(0xDC52, 0x9104)
+DOUBLE_BYTE_PAIR(0xDC53, 0x90FF)
+DOUBLE_BYTE_PAIR(0xDC54, 0x90FC)
+DOUBLE_BYTE_PAIR(0xDC55, 0x9108)
+DOUBLE_BYTE_PAIR(0xDC56, 0x90F9)
+DOUBLE_BYTE_PAIR(0xDC57, 0x90FB)
+DOUBLE_BYTE_PAIR(0xDC58, 0x9101)
+DOUBLE_BYTE_PAIR(0xDC59, 0x9100)
+DOUBLE_BYTE_PAIR(0xDC5A, 0x9107)
+DOUBLE_BYTE_PAIR(0xDC5B, 0x9105)
+DOUBLE_BYTE_PAIR(0xDC5C, 0x9103)
+DOUBLE_BYTE_PAIR(0xDC5D, 0x9161)
+DOUBLE_BYTE_PAIR(0xDC5E, 0x9164)
+DOUBLE_BYTE_PAIR(0xDC5F, 0x915F)
+DOUBLE_BYTE_PAIR(0xDC60, 0x9162)
+DOUBLE_BYTE_PAIR(0xDC61, 0x9160)
+DOUBLE_BYTE_PAIR(0xDC62, 0x9201)
+DOUBLE_BYTE_PAIR(0xDC63, 0x920A)
+DOUBLE_BYTE_PAIR(0xDC64, 0x9225)
+DOUBLE_BYTE_PAIR(0xDC65, 0x9203)
+DOUBLE_BYTE_PAIR(0xDC66, 0x921A)
+DOUBLE_BYTE_PAIR(0xDC67, 0x9226)
+DOUBLE_BYTE_PAIR(0xDC68, 0x920F)
+DOUBLE_BYTE_PAIR(0xDC69, 0x920C)
+DOUBLE_BYTE_PAIR(0xDC6A, 0x9200)
+DOUBLE_BYTE_PAIR(0xDC6B, 0x9212)
+DOUBLE_BYTE_PAIR(0xDC6C, 0x91FF)
+DOUBLE_BYTE_PAIR(0xDC6D, 0x91FD)
+DOUBLE_BYTE_PAIR(0xDC6E, 0x9206)
+DOUBLE_BYTE_PAIR(0xDC6F, 0x9204)
+DOUBLE_BYTE_PAIR(0xDC70, 0x9227)
+DOUBLE_BYTE_PAIR(0xDC71, 0x9202)
+DOUBLE_BYTE_PAIR(0xDC72, 0x921C)
+DOUBLE_BYTE_PAIR(0xDC73, 0x9224)
+DOUBLE_BYTE_PAIR(0xDC74, 0x9219)
+DOUBLE_BYTE_PAIR(0xDC75, 0x9217)
+DOUBLE_BYTE_PAIR(0xDC76, 0x9205)
+DOUBLE_BYTE_PAIR(0xDC77, 0x9216)
+DOUBLE_BYTE_PAIR(0xDC78, 0x957B)
+DOUBLE_BYTE_PAIR(0xDC79, 0x958D)
+DOUBLE_BYTE_PAIR(0xDC7A, 0x958C)
+DOUBLE_BYTE_PAIR(0xDC7B, 0x9590)
+DOUBLE_BYTE_PAIR(0xDC7C, 0x9687)
+DOUBLE_BYTE_PAIR(0xDC7D, 0x967E)
+DOUBLE_BYTE_PAIR(0xDC7E, 0x9688)
+DOUBLE_BYTE_PAIR(0xDCA1, 0x9689)
+DOUBLE_BYTE_PAIR(0xDCA2, 0x9683)
+DOUBLE_BYTE_PAIR(0xDCA3, 0x9680)
+DOUBLE_BYTE_PAIR(0xDCA4, 0x96C2)
+DOUBLE_BYTE_PAIR(0xDCA5, 0x96C8)
+DOUBLE_BYTE_PAIR(0xDCA6, 0x96C3)
+DOUBLE_BYTE_PAIR(0xDCA7, 0x96F1)
+DOUBLE_BYTE_PAIR(0xDCA8, 0x96F0)
+DOUBLE_BYTE_PAIR(0xDCA9, 0x976C)
+DOUBLE_BYTE_PAIR(0xDCAA, 0x9770)
+DOUBLE_BYTE_PAIR(0xDCAB, 0x976E)
+DOUBLE_BYTE_PAIR(0xDCAC, 0x9807)
+DOUBLE_BYTE_PAIR(0xDCAD, 0x98A9)
+DOUBLE_BYTE_PAIR(0xDCAE, 0x98EB)
+DOUBLE_BYTE_PAIR(0xDCAF, 0x9CE6)
+DOUBLE_BYTE_PAIR(0xDCB0, 0x9EF9)
+DOUBLE_BYTE_PAIR(0xDCB1, 0x4E83)
+DOUBLE_BYTE_PAIR(0xDCB2, 0x4E84)
+DOUBLE_BYTE_PAIR(0xDCB3, 0x4EB6)
+DOUBLE_BYTE_PAIR(0xDCB4, 0x50BD)
+DOUBLE_BYTE_PAIR(0xDCB5, 0x50BF)
+DOUBLE_BYTE_PAIR(0xDCB6, 0x50C6)
+DOUBLE_BYTE_PAIR(0xDCB7, 0x50AE)
+DOUBLE_BYTE_PAIR(0xDCB8, 0x50C4)
+DOUBLE_BYTE_PAIR(0xDCB9, 0x50CA)
+DOUBLE_BYTE_PAIR(0xDCBA, 0x50B4)
+DOUBLE_BYTE_PAIR(0xDCBB, 0x50C8)
+DOUBLE_BYTE_PAIR(0xDCBC, 0x50C2)
+DOUBLE_BYTE_PAIR(0xDCBD, 0x50B0)
+DOUBLE_BYTE_PAIR(0xDCBE, 0x50C1)
+DOUBLE_BYTE_PAIR(0xDCBF, 0x50BA)
+DOUBLE_BYTE_PAIR(0xDCC0, 0x50B1)
+DOUBLE_BYTE_PAIR(0xDCC1, 0x50CB)
+DOUBLE_BYTE_PAIR(0xDCC2, 0x50C9)
+DOUBLE_BYTE_PAIR(0xDCC3, 0x50B6)
+DOUBLE_BYTE_PAIR(0xDCC4, 0x50B8)
+DOUBLE_BYTE_PAIR(0xDCC5, 0x51D7)
+DOUBLE_BYTE_PAIR(0xDCC6, 0x527A)
+DOUBLE_BYTE_PAIR(0xDCC7, 0x5278)
+DOUBLE_BYTE_PAIR(0xDCC8, 0x527B)
+DOUBLE_BYTE_PAIR(0xDCC9, 0x527C)
+DOUBLE_BYTE_PAIR(0xDCCA, 0x55C3)
+DOUBLE_BYTE_PAIR(0xDCCB, 0x55DB)
+DOUBLE_BYTE_PAIR(0xDCCC, 0x55CC)
+DOUBLE_BYTE_PAIR(0xDCCD, 0x55D0)
+DOUBLE_BYTE_PAIR(0xDCCE, 0x55CB)
+DOUBLE_BYTE_PAIR(0xDCCF, 0x55CA)
+DOUBLE_BYTE_PAIR(0xDCD0, 0x55DD)
+DOUBLE_BYTE_PAIR(0xDCD1, 0x55C0)
+DOUBLE_BYTE_PAIR(0xDCD2, 0x55D4)
+DOUBLE_BYTE_PAIR(0xDCD3, 0x55C4)
+DOUBLE_BYTE_PAIR(0xDCD4, 0x55E9)
+DOUBLE_BYTE_PAIR(0xDCD5, 0x55BF)
+DOUBLE_BYTE_PAIR(0xDCD6, 0x55D2)
+DOUBLE_BYTE_PAIR(0xDCD7, 0x558D)
+DOUBLE_BYTE_PAIR(0xDCD8, 0x55CF)
+DOUBLE_BYTE_PAIR(0xDCD9, 0x55D5)
+DOUBLE_BYTE_PAIR(0xDCDA, 0x55E2)
+DOUBLE_BYTE_PAIR(0xDCDB, 0x55D6)
+DOUBLE_BYTE_PAIR(0xDCDC, 0x55C8)
+DOUBLE_BYTE_PAIR(0xDCDD, 0x55F2)
+DOUBLE_BYTE_PAIR(0xDCDE, 0x55CD)
+DOUBLE_BYTE_PAIR(0xDCDF, 0x55D9)
+DOUBLE_BYTE_PAIR(0xDCE0, 0x55C2)
+DOUBLE_BYTE_PAIR(0xDCE1, 0x5714)
+DOUBLE_BYTE_PAIR(0xDCE2, 0x5853)
+DOUBLE_BYTE_PAIR(0xDCE3, 0x5868)
+DOUBLE_BYTE_PAIR(0xDCE4, 0x5864)
+DOUBLE_BYTE_PAIR(0xDCE5, 0x584F)
+DOUBLE_BYTE_PAIR(0xDCE6, 0x584D)
+DOUBLE_BYTE_PAIR(0xDCE7, 0x5849)
+DOUBLE_BYTE_PAIR(0xDCE8, 0x586F)
+DOUBLE_BYTE_PAIR(0xDCE9, 0x5855)
+DOUBLE_BYTE_PAIR(0xDCEA, 0x584E)
+DOUBLE_BYTE_PAIR(0xDCEB, 0x585D)
+DOUBLE_BYTE_PAIR(0xDCEC, 0x5859)
+DOUBLE_BYTE_PAIR(0xDCED, 0x5865)
+DOUBLE_BYTE_PAIR(0xDCEE, 0x585B)
+DOUBLE_BYTE_PAIR(0xDCEF, 0x583D)
+DOUBLE_BYTE_PAIR(0xDCF0, 0x5863)
+DOUBLE_BYTE_PAIR(0xDCF1, 0x5871)
+DOUBLE_BYTE_PAIR(0xDCF2, 0x58FC)
+DOUBLE_BYTE_PAIR(0xDCF3, 0x5AC7)
+DOUBLE_BYTE_PAIR(0xDCF4, 0x5AC4)
+DOUBLE_BYTE_PAIR(0xDCF5, 0x5ACB)
+DOUBLE_BYTE_PAIR(0xDCF6, 0x5ABA)
+DOUBLE_BYTE_PAIR(0xDCF7, 0x5AB8)
+DOUBLE_BYTE_PAIR(0xDCF8, 0x5AB1)
+DOUBLE_BYTE_PAIR(0xDCF9, 0x5AB5)
+DOUBLE_BYTE_PAIR(0xDCFA, 0x5AB0)
+DOUBLE_BYTE_PAIR(0xDCFB, 0x5ABF)
+DOUBLE_BYTE_PAIR(0xDCFC, 0x5AC8)
+DOUBLE_BYTE_PAIR(0xDCFD, 0x5ABB)
+DOUBLE_BYTE_PAIR(0xDCFE, 0x5AC6)
+DOUBLE_BYTE_PAIR(0xDD40, 0x5AB7)
+DOUBLE_BYTE_PAIR(0xDD41, 0x5AC0)
+DOUBLE_BYTE_PAIR(0xDD42, 0x5ACA)
+DOUBLE_BYTE_PAIR(0xDD43, 0x5AB4)
+DOUBLE_BYTE_PAIR(0xDD44, 0x5AB6)
+DOUBLE_BYTE_PAIR(0xDD45, 0x5ACD)
+DOUBLE_BYTE_PAIR(0xDD46, 0x5AB9)
+DOUBLE_BYTE_PAIR(0xDD47, 0x5A90)
+DOUBLE_BYTE_PAIR(0xDD48, 0x5BD6)
+DOUBLE_BYTE_PAIR(0xDD49, 0x5BD8)
+DOUBLE_BYTE_PAIR(0xDD4A, 0x5BD9)
+DOUBLE_BYTE_PAIR(0xDD4B, 0x5C1F)
+DOUBLE_BYTE_PAIR(0xDD4C, 0x5C33)
+DOUBLE_BYTE_PAIR(0xDD4D, 0x5D71)
+DOUBLE_BYTE_PAIR(0xDD4E, 0x5D63)
+DOUBLE_BYTE_PAIR(0xDD4F, 0x5D4A)
+DOUBLE_BYTE_PAIR(0xDD50, 0x5D65)
+DOUBLE_BYTE_PAIR(0xDD51, 0x5D72)
+DOUBLE_BYTE_PAIR(0xDD52, 0x5D6C)
+DOUBLE_BYTE_PAIR(0xDD53, 0x5D5E)
+DOUBLE_BYTE_PAIR(0xDD54, 0x5D68)
+DOUBLE_BYTE_PAIR(0xDD55, 0x5D67)
+DOUBLE_BYTE_PAIR(0xDD56, 0x5D62)
+DOUBLE_BYTE_PAIR(0xDD57, 0x5DF0)
+DOUBLE_BYTE_PAIR(0xDD58, 0x5E4F)
+DOUBLE_BYTE_PAIR(0xDD59, 0x5E4E)
+DOUBLE_BYTE_PAIR(0xDD5A, 0x5E4A)
+DOUBLE_BYTE_PAIR(0xDD5B, 0x5E4D)
+DOUBLE_BYTE_PAIR(0xDD5C, 0x5E4B)
+DOUBLE_BYTE_PAIR(0xDD5D, 0x5EC5)
+DOUBLE_BYTE_PAIR(0xDD5E, 0x5ECC)
+DOUBLE_BYTE_PAIR(0xDD5F, 0x5EC6)
+DOUBLE_BYTE_PAIR(0xDD60, 0x5ECB)
+DOUBLE_BYTE_PAIR(0xDD61, 0x5EC7)
+DOUBLE_BYTE_PAIR(0xDD62, 0x5F40)
+DOUBLE_BYTE_PAIR(0xDD63, 0x5FAF)
+DOUBLE_BYTE_PAIR(0xDD64, 0x5FAD)
+DOUBLE_BYTE_PAIR(0xDD65, 0x60F7)
+DOUBLE_BYTE_PAIR(0xDD66, 0x6149)
+DOUBLE_BYTE_PAIR(0xDD67, 0x614A)
+DOUBLE_BYTE_PAIR(0xDD68, 0x612B)
+DOUBLE_BYTE_PAIR(0xDD69, 0x6145)
+DOUBLE_BYTE_PAIR(0xDD6A, 0x6136)
+DOUBLE_BYTE_PAIR(0xDD6B, 0x6132)
+DOUBLE_BYTE_PAIR(0xDD6C, 0x612E)
+DOUBLE_BYTE_PAIR(0xDD6D, 0x6146)
+DOUBLE_BYTE_PAIR(0xDD6E, 0x612F)
+DOUBLE_BYTE_PAIR(0xDD6F, 0x614F)
+DOUBLE_BYTE_PAIR(0xDD70, 0x6129)
+DOUBLE_BYTE_PAIR(0xDD71, 0x6140)
+DOUBLE_BYTE_PAIR(0xDD72, 0x6220)
+DOUBLE_BYTE_PAIR(0xDD73, 0x9168)
+DOUBLE_BYTE_PAIR(0xDD74, 0x6223)
+DOUBLE_BYTE_PAIR(0xDD75, 0x6225)
+DOUBLE_BYTE_PAIR(0xDD76, 0x6224)
+DOUBLE_BYTE_PAIR(0xDD77, 0x63C5)
+DOUBLE_BYTE_PAIR(0xDD78, 0x63F1)
+DOUBLE_BYTE_PAIR(0xDD79, 0x63EB)
+DOUBLE_BYTE_PAIR(0xDD7A, 0x6410)
+DOUBLE_BYTE_PAIR(0xDD7B, 0x6412)
+DOUBLE_BYTE_PAIR(0xDD7C, 0x6409)
+DOUBLE_BYTE_PAIR(0xDD7D, 0x6420)
+DOUBLE_BYTE_PAIR(0xDD7E, 0x6424)
+DOUBLE_BYTE_PAIR(0xDDA1, 0x6433)
+DOUBLE_BYTE_PAIR(0xDDA2, 0x6443)
+DOUBLE_BYTE_PAIR(0xDDA3, 0x641F)
+DOUBLE_BYTE_PAIR(0xDDA4, 0x6415)
+DOUBLE_BYTE_PAIR(0xDDA5, 0x6418)
+DOUBLE_BYTE_PAIR(0xDDA6, 0x6439)
+DOUBLE_BYTE_PAIR(0xDDA7, 0x6437)
+DOUBLE_BYTE_PAIR(0xDDA8, 0x6422)
+DOUBLE_BYTE_PAIR(0xDDA9, 0x6423)
+DOUBLE_BYTE_PAIR(0xDDAA, 0x640C)
+DOUBLE_BYTE_PAIR(0xDDAB, 0x6426)
+DOUBLE_BYTE_PAIR(0xDDAC, 0x6430)
+DOUBLE_BYTE_PAIR(0xDDAD, 0x6428)
+DOUBLE_BYTE_PAIR(0xDDAE, 0x6441)
+DOUBLE_BYTE_PAIR(0xDDAF, 0x6435)
+DOUBLE_BYTE_PAIR(0xDDB0, 0x642F)
+DOUBLE_BYTE_PAIR(0xDDB1, 0x640A)
+DOUBLE_BYTE_PAIR(0xDDB2, 0x641A)
+DOUBLE_BYTE_PAIR(0xDDB3, 0x6440)
+DOUBLE_BYTE_PAIR(0xDDB4, 0x6425)
+DOUBLE_BYTE_PAIR(0xDDB5, 0x6427)
+DOUBLE_BYTE_PAIR(0xDDB6, 0x640B)
+DOUBLE_BYTE_PAIR(0xDDB7, 0x63E7)
+DOUBLE_BYTE_PAIR(0xDDB8, 0x641B)
+DOUBLE_BYTE_PAIR(0xDDB9, 0x642E)
+DOUBLE_BYTE_PAIR(0xDDBA, 0x6421)
+DOUBLE_BYTE_PAIR(0xDDBB, 0x640E)
+DOUBLE_BYTE_PAIR(0xDDBC, 0x656F)
+DOUBLE_BYTE_PAIR(0xDDBD, 0x6592)
+DOUBLE_BYTE_PAIR(0xDDBE, 0x65D3)
+DOUBLE_BYTE_PAIR(0xDDBF, 0x6686)
+DOUBLE_BYTE_PAIR(0xDDC0, 0x668C)
+DOUBLE_BYTE_PAIR(0xDDC1, 0x6695)
+DOUBLE_BYTE_PAIR(0xDDC2, 0x6690)
+DOUBLE_BYTE_PAIR(0xDDC3, 0x668B)
+DOUBLE_BYTE_PAIR(0xDDC4, 0x668A)
+DOUBLE_BYTE_PAIR(0xDDC5, 0x6699)
+DOUBLE_BYTE_PAIR(0xDDC6, 0x6694)
+DOUBLE_BYTE_PAIR(0xDDC7, 0x6678)
+DOUBLE_BYTE_PAIR(0xDDC8, 0x6720)
+DOUBLE_BYTE_PAIR(0xDDC9, 0x6966)
+DOUBLE_BYTE_PAIR(0xDDCA, 0x695F)
+DOUBLE_BYTE_PAIR(0xDDCB, 0x6938)
+DOUBLE_BYTE_PAIR(0xDDCC, 0x694E)
+DOUBLE_BYTE_PAIR(0xDDCD, 0x6962)
+DOUBLE_BYTE_PAIR(0xDDCE, 0x6971)
+DOUBLE_BYTE_PAIR(0xDDCF, 0x693F)
+DOUBLE_BYTE_PAIR(0xDDD0, 0x6945)
+DOUBLE_BYTE_PAIR(0xDDD1, 0x696A)
+DOUBLE_BYTE_PAIR(0xDDD2, 0x6939)
+DOUBLE_BYTE_PAIR(0xDDD3, 0x6942)
+DOUBLE_BYTE_PAIR(0xDDD4, 0x6957)
+DOUBLE_BYTE_PAIR(0xDDD5, 0x6959)
+DOUBLE_BYTE_PAIR(0xDDD6, 0x697A)
+DOUBLE_BYTE_PAIR(0xDDD7, 0x6948)
+DOUBLE_BYTE_PAIR(0xDDD8, 0x6949)
+DOUBLE_BYTE_PAIR(0xDDD9, 0x6935)
+DOUBLE_BYTE_PAIR(0xDDDA, 0x696C)
+DOUBLE_BYTE_PAIR(0xDDDB, 0x6933)
+DOUBLE_BYTE_PAIR(0xDDDC, 0x693D)
+DOUBLE_BYTE_PAIR(0xDDDD, 0x6965)
+DOUBLE_BYTE_PAIR(0xDDDE, 0x68F0)
+DOUBLE_BYTE_PAIR(0xDDDF, 0x6978)
+DOUBLE_BYTE_PAIR(0xDDE0, 0x6934)
+DOUBLE_BYTE_PAIR(0xDDE1, 0x6969)
+DOUBLE_BYTE_PAIR(0xDDE2, 0x6940)
+DOUBLE_BYTE_PAIR(0xDDE3, 0x696F)
+DOUBLE_BYTE_PAIR(0xDDE4, 0x6944)
+DOUBLE_BYTE_PAIR(0xDDE5, 0x6976)
+DOUBLE_BYTE_PAIR(0xDDE6, 0x6958)
+DOUBLE_BYTE_PAIR(0xDDE7, 0x6941)
+DOUBLE_BYTE_PAIR(0xDDE8, 0x6974)
+DOUBLE_BYTE_PAIR(0xDDE9, 0x694C)
+DOUBLE_BYTE_PAIR(0xDDEA, 0x693B)
+DOUBLE_BYTE_PAIR(0xDDEB, 0x694B)
+DOUBLE_BYTE_PAIR(0xDDEC, 0x6937)
+DOUBLE_BYTE_PAIR(0xDDED, 0x695C)
+DOUBLE_BYTE_PAIR(0xDDEE, 0x694F)
+DOUBLE_BYTE_PAIR(0xDDEF, 0x6951)
+DOUBLE_BYTE_PAIR(0xDDF0, 0x6932)
+DOUBLE_BYTE_PAIR(0xDDF1, 0x6952)
+DOUBLE_BYTE_PAIR(0xDDF2, 0x692F)
+DOUBLE_BYTE_PAIR(0xDDF3, 0x697B)
+DOUBLE_BYTE_PAIR(0xDDF4, 0x693C)
+DOUBLE_BYTE_PAIR(0xDDF5, 0x6B46)
+DOUBLE_BYTE_PAIR(0xDDF6, 0x6B45)
+DOUBLE_BYTE_PAIR(0xDDF7, 0x6B43)
+DOUBLE_BYTE_PAIR(0xDDF8, 0x6B42)
+DOUBLE_BYTE_PAIR(0xDDF9, 0x6B48)
+DOUBLE_BYTE_PAIR(0xDDFA, 0x6B41)
+DOUBLE_BYTE_PAIR(0xDDFB, 0x6B9B)
+DOUBLE_BYTE_PAIR(0xDDFC, 0xFA0D)
+DOUBLE_BYTE_PAIR(0xDDFD, 0x6BFB)
+DOUBLE_BYTE_PAIR(0xDDFE, 0x6BFC)
+DOUBLE_BYTE_PAIR(0xDE40, 0x6BF9)
+DOUBLE_BYTE_PAIR(0xDE41, 0x6BF7)
+DOUBLE_BYTE_PAIR(0xDE42, 0x6BF8)
+DOUBLE_BYTE_PAIR(0xDE43, 0x6E9B)
+DOUBLE_BYTE_PAIR(0xDE44, 0x6ED6)
+DOUBLE_BYTE_PAIR(0xDE45, 0x6EC8)
+DOUBLE_BYTE_PAIR(0xDE46, 0x6E8F)
+DOUBLE_BYTE_PAIR(0xDE47, 0x6EC0)
+DOUBLE_BYTE_PAIR(0xDE48, 0x6E9F)
+DOUBLE_BYTE_PAIR(0xDE49, 0x6E93)
+DOUBLE_BYTE_PAIR(0xDE4A, 0x6E94)
+DOUBLE_BYTE_PAIR(0xDE4B, 0x6EA0)
+DOUBLE_BYTE_PAIR(0xDE4C, 0x6EB1)
+DOUBLE_BYTE_PAIR(0xDE4D, 0x6EB9)
+DOUBLE_BYTE_PAIR(0xDE4E, 0x6EC6)
+DOUBLE_BYTE_PAIR(0xDE4F, 0x6ED2)
+DOUBLE_BYTE_PAIR(0xDE50, 0x6EBD)
+DOUBLE_BYTE_PAIR(0xDE51, 0x6EC1)
+DOUBLE_BYTE_PAIR(0xDE52, 0x6E9E)
+DOUBLE_BYTE_PAIR(0xDE53, 0x6EC9)
+DOUBLE_BYTE_PAIR(0xDE54, 0x6EB7)
+DOUBLE_BYTE_PAIR(0xDE55, 0x6EB0)
+DOUBLE_BYTE_PAIR(0xDE56, 0x6ECD)
+DOUBLE_BYTE_PAIR(0xDE57, 0x6EA6)
+DOUBLE_BYTE_PAIR(0xDE58, 0x6ECF)
+DOUBLE_BYTE_PAIR(0xDE59, 0x6EB2)
+DOUBLE_BYTE_PAIR(0xDE5A, 0x6EBE)
+DOUBLE_BYTE_PAIR(0xDE5B, 0x6EC3)
+DOUBLE_BYTE_PAIR(0xDE5C, 0x6EDC)
+DOUBLE_BYTE_PAIR(0xDE5D, 0x6ED8)
+DOUBLE_BYTE_PAIR(0xDE5E, 0x6E99)
+DOUBLE_BYTE_PAIR(0xDE5F, 0x6E92)
+DOUBLE_BYTE_PAIR(0xDE60, 0x6E8E)
+DOUBLE_BYTE_PAIR(0xDE61, 0x6E8D)
+DOUBLE_BYTE_PAIR(0xDE62, 0x6EA4)
+DOUBLE_BYTE_PAIR(0xDE63, 0x6EA1)
+DOUBLE_BYTE_PAIR(0xDE64, 0x6EBF)
+DOUBLE_BYTE_PAIR(0xDE65, 0x6EB3)
+DOUBLE_BYTE_PAIR(0xDE66, 0x6ED0)
+DOUBLE_BYTE_PAIR(0xDE67, 0x6ECA)
+DOUBLE_BYTE_PAIR(0xDE68, 0x6E97)
+DOUBLE_BYTE_PAIR(0xDE69, 0x6EAE)
+DOUBLE_BYTE_PAIR(0xDE6A, 0x6EA3)
+DOUBLE_BYTE_PAIR(0xDE6B, 0x7147)
+DOUBLE_BYTE_PAIR(0xDE6C, 0x7154)
+DOUBLE_BYTE_PAIR(0xDE6D, 0x7152)
+DOUBLE_BYTE_PAIR(0xDE6E, 0x7163)
+DOUBLE_BYTE_PAIR(0xDE6F, 0x7160)
+DOUBLE_BYTE_PAIR(0xDE70, 0x7141)
+DOUBLE_BYTE_PAIR(0xDE71, 0x715D)
+DOUBLE_BYTE_PAIR(0xDE72, 0x7162)
+DOUBLE_BYTE_PAIR(0xDE73, 0x7172)
+DOUBLE_BYTE_PAIR(0xDE74, 0x7178)
+DOUBLE_BYTE_PAIR(0xDE75, 0x716A)
+DOUBLE_BYTE_PAIR(0xDE76, 0x7161)
+DOUBLE_BYTE_PAIR(0xDE77, 0x7142)
+DOUBLE_BYTE_PAIR(0xDE78, 0x7158)
+DOUBLE_BYTE_PAIR(0xDE79, 0x7143)
+DOUBLE_BYTE_PAIR(0xDE7A, 0x714B)
+DOUBLE_BYTE_PAIR(0xDE7B, 0x7170)
+DOUBLE_BYTE_PAIR(0xDE7C, 0x715F)
+DOUBLE_BYTE_PAIR(0xDE7D, 0x7150)
+DOUBLE_BYTE_PAIR(0xDE7E, 0x7153)
+DOUBLE_BYTE_PAIR(0xDEA1, 0x7144)
+DOUBLE_BYTE_PAIR(0xDEA2, 0x714D)
+DOUBLE_BYTE_PAIR(0xDEA3, 0x715A)
+DOUBLE_BYTE_PAIR(0xDEA4, 0x724F)
+DOUBLE_BYTE_PAIR(0xDEA5, 0x728D)
+DOUBLE_BYTE_PAIR(0xDEA6, 0x728C)
+DOUBLE_BYTE_PAIR(0xDEA7, 0x7291)
+DOUBLE_BYTE_PAIR(0xDEA8, 0x7290)
+DOUBLE_BYTE_PAIR(0xDEA9, 0x728E)
+DOUBLE_BYTE_PAIR(0xDEAA, 0x733C)
+DOUBLE_BYTE_PAIR(0xDEAB, 0x7342)
+DOUBLE_BYTE_PAIR(0xDEAC, 0x733B)
+DOUBLE_BYTE_PAIR(0xDEAD, 0x733A)
+DOUBLE_BYTE_PAIR(0xDEAE, 0x7340)
+DOUBLE_BYTE_PAIR(0xDEAF, 0x734A)
+DOUBLE_BYTE_PAIR(0xDEB0, 0x7349)
+DOUBLE_BYTE_PAIR(0xDEB1, 0x7444)
+DOUBLE_BYTE_PAIR(0xDEB2, 0x744A)
+DOUBLE_BYTE_PAIR(0xDEB3, 0x744B)
+DOUBLE_BYTE_PAIR(0xDEB4, 0x7452)
+DOUBLE_BYTE_PAIR(0xDEB5, 0x7451)
+DOUBLE_BYTE_PAIR(0xDEB6, 0x7457)
+DOUBLE_BYTE_PAIR(0xDEB7, 0x7440)
+DOUBLE_BYTE_PAIR(0xDEB8, 0x744F)
+DOUBLE_BYTE_PAIR(0xDEB9, 0x7450)
+DOUBLE_BYTE_PAIR(0xDEBA, 0x744E)
+DOUBLE_BYTE_PAIR(0xDEBB, 0x7442)
+DOUBLE_BYTE_PAIR(0xDEBC, 0x7446)
+DOUBLE_BYTE_PAIR(0xDEBD, 0x744D)
+DOUBLE_BYTE_PAIR(0xDEBE, 0x7454)
+DOUBLE_BYTE_PAIR(0xDEBF, 0x74E1)
+DOUBLE_BYTE_PAIR(0xDEC0, 0x74FF)
+DOUBLE_BYTE_PAIR(0xDEC1, 0x74FE)
+DOUBLE_BYTE_PAIR(0xDEC2, 0x74FD)
+DOUBLE_BYTE_PAIR(0xDEC3, 0x751D)
+DOUBLE_BYTE_PAIR(0xDEC4, 0x7579)
+DOUBLE_BYTE_PAIR(0xDEC5, 0x7577)
+DOUBLE_BYTE_PAIR(0xDEC6, 0x6983)
+DOUBLE_BYTE_PAIR(0xDEC7, 0x75EF)
+DOUBLE_BYTE_PAIR(0xDEC8, 0x760F)
+DOUBLE_BYTE_PAIR(0xDEC9, 0x7603)
+DOUBLE_BYTE_PAIR(0xDECA, 0x75F7)
+DOUBLE_BYTE_PAIR(0xDECB, 0x75FE)
+DOUBLE_BYTE_PAIR(0xDECC, 0x75FC)
+DOUBLE_BYTE_PAIR(0xDECD, 0x75F9)
+DOUBLE_BYTE_PAIR(0xDECE, 0x75F8)
+DOUBLE_BYTE_PAIR(0xDECF, 0x7610)
+DOUBLE_BYTE_PAIR(0xDED0, 0x75FB)
+DOUBLE_BYTE_PAIR(0xDED1, 0x75F6)
+DOUBLE_BYTE_PAIR(0xDED2, 0x75ED)
+DOUBLE_BYTE_PAIR(0xDED3, 0x75F5)
+DOUBLE_BYTE_PAIR(0xDED4, 0x75FD)
+DOUBLE_BYTE_PAIR(0xDED5, 0x7699)
+DOUBLE_BYTE_PAIR(0xDED6, 0x76B5)
+DOUBLE_BYTE_PAIR(0xDED7, 0x76DD)
+DOUBLE_BYTE_PAIR(0xDED8, 0x7755)
+DOUBLE_BYTE_PAIR(0xDED9, 0x775F)
+DOUBLE_BYTE_PAIR(0xDEDA, 0x7760)
+DOUBLE_BYTE_PAIR(0xDEDB, 0x7752)
+DOUBLE_BYTE_PAIR(0xDEDC, 0x7756)
+DOUBLE_BYTE_PAIR(0xDEDD, 0x775A)
+DOUBLE_BYTE_PAIR(0xDEDE, 0x7769)
+DOUBLE_BYTE_PAIR(0xDEDF, 0x7767)
+DOUBLE_BYTE_PAIR(0xDEE0, 0x7754)
+DOUBLE_BYTE_PAIR(0xDEE1, 0x7759)
+DOUBLE_BYTE_PAIR(0xDEE2, 0x776D)
+DOUBLE_BYTE_PAIR(0xDEE3, 0x77E0)
+DOUBLE_BYTE_PAIR(0xDEE4, 0x7887)
+DOUBLE_BYTE_PAIR(0xDEE5, 0x789A)
+DOUBLE_BYTE_PAIR(0xDEE6, 0x7894)
+DOUBLE_BYTE_PAIR(0xDEE7, 0x788F)
+DOUBLE_BYTE_PAIR(0xDEE8, 0x7884)
+DOUBLE_BYTE_PAIR(0xDEE9, 0x7895)
+DOUBLE_BYTE_PAIR(0xDEEA, 0x7885)
+DOUBLE_BYTE_PAIR(0xDEEB, 0x7886)
+DOUBLE_BYTE_PAIR(0xDEEC, 0x78A1)
+DOUBLE_BYTE_PAIR(0xDEED, 0x7883)
+DOUBLE_BYTE_PAIR(0xDEEE, 0x7879)
+DOUBLE_BYTE_PAIR(0xDEEF, 0x7899)
+DOUBLE_BYTE_PAIR(0xDEF0, 0x7880)
+DOUBLE_BYTE_PAIR(0xDEF1, 0x7896)
+DOUBLE_BYTE_PAIR(0xDEF2, 0x787B)
+DOUBLE_BYTE_PAIR(0xDEF3, 0x797C)
+DOUBLE_BYTE_PAIR(0xDEF4, 0x7982)
+DOUBLE_BYTE_PAIR(0xDEF5, 0x797D)
+DOUBLE_BYTE_PAIR(0xDEF6, 0x7979)
+DOUBLE_BYTE_PAIR(0xDEF7, 0x7A11)
+DOUBLE_BYTE_PAIR(0xDEF8, 0x7A18)
+DOUBLE_BYTE_PAIR(0xDEF9, 0x7A19)
+DOUBLE_BYTE_PAIR(0xDEFA, 0x7A12)
+DOUBLE_BYTE_PAIR(0xDEFB, 0x7A17)
+DOUBLE_BYTE_PAIR(0xDEFC, 0x7A15)
+DOUBLE_BYTE_PAIR(0xDEFD, 0x7A22)
+DOUBLE_BYTE_PAIR(0xDEFE, 0x7A13)
+DOUBLE_BYTE_PAIR(0xDF40, 0x7A1B)
+DOUBLE_BYTE_PAIR(0xDF41, 0x7A10)
+DOUBLE_BYTE_PAIR(0xDF42, 0x7AA3)
+DOUBLE_BYTE_PAIR(0xDF43, 0x7AA2)
+DOUBLE_BYTE_PAIR(0xDF44, 0x7A9E)
+DOUBLE_BYTE_PAIR(0xDF45, 0x7AEB)
+DOUBLE_BYTE_PAIR(0xDF46, 0x7B66)
+DOUBLE_BYTE_PAIR(0xDF47, 0x7B64)
+DOUBLE_BYTE_PAIR(0xDF48, 0x7B6D)
+DOUBLE_BYTE_PAIR(0xDF49, 0x7B74)
+DOUBLE_BYTE_PAIR(0xDF4A, 0x7B69)
+DOUBLE_BYTE_PAIR(0xDF4B, 0x7B72)
+DOUBLE_BYTE_PAIR(0xDF4C, 0x7B65)
+DOUBLE_BYTE_PAIR(0xDF4D, 0x7B73)
+DOUBLE_BYTE_PAIR(0xDF4E, 0x7B71)
+DOUBLE_BYTE_PAIR(0xDF4F, 0x7B70)
+DOUBLE_BYTE_PAIR(0xDF50, 0x7B61)
+DOUBLE_BYTE_PAIR(0xDF51, 0x7B78)
+DOUBLE_BYTE_PAIR(0xDF52, 0x7B76)
+DOUBLE_BYTE_PAIR(0xDF53, 0x7B63)
+DOUBLE_BYTE_PAIR(0xDF54, 0x7CB2)
+DOUBLE_BYTE_PAIR(0xDF55, 0x7CB4)
+DOUBLE_BYTE_PAIR(0xDF56, 0x7CAF)
+DOUBLE_BYTE_PAIR(0xDF57, 0x7D88)
+DOUBLE_BYTE_PAIR(0xDF58, 0x7D86)
+DOUBLE_BYTE_PAIR(0xDF59, 0x7D80)
+DOUBLE_BYTE_PAIR(0xDF5A, 0x7D8D)
+DOUBLE_BYTE_PAIR(0xDF5B, 0x7D7F)
+DOUBLE_BYTE_PAIR(0xDF5C, 0x7D85)
+DOUBLE_BYTE_PAIR(0xDF5D, 0x7D7A)
+DOUBLE_BYTE_PAIR(0xDF5E, 0x7D8E)
+DOUBLE_BYTE_PAIR(0xDF5F, 0x7D7B)
+DOUBLE_BYTE_PAIR(0xDF60, 0x7D83)
+DOUBLE_BYTE_PAIR(0xDF61, 0x7D7C)
+DOUBLE_BYTE_PAIR(0xDF62, 0x7D8C)
+DOUBLE_BYTE_PAIR(0xDF63, 0x7D94)
+DOUBLE_BYTE_PAIR(0xDF64, 0x7D84)
+DOUBLE_BYTE_PAIR(0xDF65, 0x7D7D)
+DOUBLE_BYTE_PAIR(0xDF66, 0x7D92)
+DOUBLE_BYTE_PAIR(0xDF67, 0x7F6D)
+DOUBLE_BYTE_PAIR(0xDF68, 0x7F6B)
+DOUBLE_BYTE_PAIR(0xDF69, 0x7F67)
+DOUBLE_BYTE_PAIR(0xDF6A, 0x7F68)
+DOUBLE_BYTE_PAIR(0xDF6B, 0x7F6C)
+DOUBLE_BYTE_PAIR(0xDF6C, 0x7FA6)
+DOUBLE_BYTE_PAIR(0xDF6D, 0x7FA5)
+DOUBLE_BYTE_PAIR(0xDF6E, 0x7FA7)
+DOUBLE_BYTE_PAIR(0xDF6F, 0x7FDB)
+DOUBLE_BYTE_PAIR(0xDF70, 0x7FDC)
+DOUBLE_BYTE_PAIR(0xDF71, 0x8021)
+DOUBLE_BYTE_PAIR(0xDF72, 0x8164)
+DOUBLE_BYTE_PAIR(0xDF73, 0x8160)
+DOUBLE_BYTE_PAIR(0xDF74, 0x8177)
+DOUBLE_BYTE_PAIR(0xDF75, 0x815C)
+DOUBLE_BYTE_PAIR(0xDF76, 0x8169)
+DOUBLE_BYTE_PAIR(0xDF77, 0x815B)
+DOUBLE_BYTE_PAIR(0xDF78, 0x8162)
+DOUBLE_BYTE_PAIR(0xDF79, 0x8172)
+DOUBLE_BYTE_PAIR(0xDF7A, 0x6721)
+DOUBLE_BYTE_PAIR(0xDF7B, 0x815E)
+DOUBLE_BYTE_PAIR(0xDF7C, 0x8176)
+DOUBLE_BYTE_PAIR(0xDF7D, 0x8167)
+DOUBLE_BYTE_PAIR(0xDF7E, 0x816F)
+DOUBLE_BYTE_PAIR(0xDFA1, 0x8144)
+DOUBLE_BYTE_PAIR(0xDFA2, 0x8161)
+DOUBLE_BYTE_PAIR(0xDFA3, 0x821D)
+DOUBLE_BYTE_PAIR(0xDFA4, 0x8249)
+DOUBLE_BYTE_PAIR(0xDFA5, 0x8244)
+DOUBLE_BYTE_PAIR(0xDFA6, 0x8240)
+DOUBLE_BYTE_PAIR(0xDFA7, 0x8242)
+DOUBLE_BYTE_PAIR(0xDFA8, 0x8245)
+DOUBLE_BYTE_PAIR(0xDFA9, 0x84F1)
+DOUBLE_BYTE_PAIR(0xDFAA, 0x843F)
+DOUBLE_BYTE_PAIR(0xDFAB, 0x8456)
+DOUBLE_BYTE_PAIR(0xDFAC, 0x8476)
+DOUBLE_BYTE_PAIR(0xDFAD, 0x8479)
+DOUBLE_BYTE_PAIR(0xDFAE, 0x848F)
+DOUBLE_BYTE_PAIR(0xDFAF, 0x848D)
+DOUBLE_BYTE_PAIR(0xDFB0, 0x8465)
+DOUBLE_BYTE_PAIR(0xDFB1, 0x8451)
+DOUBLE_BYTE_PAIR(0xDFB2, 0x8440)
+DOUBLE_BYTE_PAIR(0xDFB3, 0x8486)
+DOUBLE_BYTE_PAIR(0xDFB4, 0x8467)
+DOUBLE_BYTE_PAIR(0xDFB5, 0x8430)
+DOUBLE_BYTE_PAIR(0xDFB6, 0x844D)
+DOUBLE_BYTE_PAIR(0xDFB7, 0x847D)
+DOUBLE_BYTE_PAIR(0xDFB8, 0x845A)
+DOUBLE_BYTE_PAIR(0xDFB9, 0x8459)
+DOUBLE_BYTE_PAIR(0xDFBA, 0x8474)
+DOUBLE_BYTE_PAIR(0xDFBB, 0x8473)
+DOUBLE_BYTE_PAIR(0xDFBC, 0x845D)
+DOUBLE_BYTE_PAIR(0xDFBD, 0x8507)
+DOUBLE_BYTE_PAIR(0xDFBE, 0x845E)
+DOUBLE_BYTE_PAIR(0xDFBF, 0x8437)
+DOUBLE_BYTE_PAIR(0xDFC0, 0x843A)
+DOUBLE_BYTE_PAIR(0xDFC1, 0x8434)
+DOUBLE_BYTE_PAIR(0xDFC2, 0x847A)
+DOUBLE_BYTE_PAIR(0xDFC3, 0x8443)
+DOUBLE_BYTE_PAIR(0xDFC4, 0x8478)
+DOUBLE_BYTE_PAIR(0xDFC5, 0x8432)
+DOUBLE_BYTE_PAIR(0xDFC6, 0x8445)
+DOUBLE_BYTE_PAIR(0xDFC7, 0x8429)
+DOUBLE_BYTE_PAIR(0xDFC8, 0x83D9)
+DOUBLE_BYTE_PAIR(0xDFC9, 0x844B)
+DOUBLE_BYTE_PAIR(0xDFCA, 0x842F)
+DOUBLE_BYTE_PAIR(0xDFCB, 0x8442)
+DOUBLE_BYTE_PAIR(0xDFCC, 0x842D)
+DOUBLE_BYTE_PAIR(0xDFCD, 0x845F)
+DOUBLE_BYTE_PAIR(0xDFCE, 0x8470)
+DOUBLE_BYTE_PAIR(0xDFCF, 0x8439)
+DOUBLE_BYTE_PAIR(0xDFD0, 0x844E)
+DOUBLE_BYTE_PAIR(0xDFD1, 0x844C)
+DOUBLE_BYTE_PAIR(0xDFD2, 0x8452)
+DOUBLE_BYTE_PAIR(0xDFD3, 0x846F)
+DOUBLE_BYTE_PAIR(0xDFD4, 0x84C5)
+DOUBLE_BYTE_PAIR(0xDFD5, 0x848E)
+DOUBLE_BYTE_PAIR(0xDFD6, 0x843B)
+DOUBLE_BYTE_PAIR(0xDFD7, 0x8447)
+DOUBLE_BYTE_PAIR(0xDFD8, 0x8436)
+DOUBLE_BYTE_PAIR(0xDFD9, 0x8433)
+DOUBLE_BYTE_PAIR(0xDFDA, 0x8468)
+DOUBLE_BYTE_PAIR(0xDFDB, 0x847E)
+DOUBLE_BYTE_PAIR(0xDFDC, 0x8444)
+DOUBLE_BYTE_PAIR(0xDFDD, 0x842B)
+DOUBLE_BYTE_PAIR(0xDFDE, 0x8460)
+DOUBLE_BYTE_PAIR(0xDFDF, 0x8454)
+DOUBLE_BYTE_PAIR(0xDFE0, 0x846E)
+DOUBLE_BYTE_PAIR(0xDFE1, 0x8450)
+DOUBLE_BYTE_PAIR(0xDFE2, 0x870B)
+DOUBLE_BYTE_PAIR(0xDFE3, 0x8704)
+DOUBLE_BYTE_PAIR(0xDFE4, 0x86F7)
+DOUBLE_BYTE_PAIR(0xDFE5, 0x870C)
+DOUBLE_BYTE_PAIR(0xDFE6, 0x86FA)
+DOUBLE_BYTE_PAIR(0xDFE7, 0x86D6)
+DOUBLE_BYTE_PAIR(0xDFE8, 0x86F5)
+DOUBLE_BYTE_PAIR(0xDFE9, 0x874D)
+DOUBLE_BYTE_PAIR(0xDFEA, 0x86F8)
+DOUBLE_BYTE_PAIR(0xDFEB, 0x870E)
+DOUBLE_BYTE_PAIR(0xDFEC, 0x8709)
+DOUBLE_BYTE_PAIR(0xDFED, 0x8701)
+DOUBLE_BYTE_PAIR(0xDFEE, 0x86F6)
+DOUBLE_BYTE_PAIR(0xDFEF, 0x870D)
+DOUBLE_BYTE_PAIR(0xDFF0, 0x8705)
+DOUBLE_BYTE_PAIR(0xDFF1, 0x88D6)
+DOUBLE_BYTE_PAIR(0xDFF2, 0x88CB)
+DOUBLE_BYTE_PAIR(0xDFF3, 0x88CD)
+DOUBLE_BYTE_PAIR(0xDFF4, 0x88CE)
+DOUBLE_BYTE_PAIR(0xDFF5, 0x88DE)
+DOUBLE_BYTE_PAIR(0xDFF6, 0x88DB)
+DOUBLE_BYTE_PAIR(0xDFF7, 0x88DA)
+DOUBLE_BYTE_PAIR(0xDFF8, 0x88CC)
+DOUBLE_BYTE_PAIR(0xDFF9, 0x88D0)
+DOUBLE_BYTE_PAIR(0xDFFA, 0x8985)
+DOUBLE_BYTE_PAIR(0xDFFB, 0x899B)
+DOUBLE_BYTE_PAIR(0xDFFC, 0x89DF)
+DOUBLE_BYTE_PAIR(0xDFFD, 0x89E5)
+DOUBLE_BYTE_PAIR(0xDFFE, 0x89E4)
+DOUBLE_BYTE_PAIR(0xE040, 0x89E1)
+DOUBLE_BYTE_PAIR(0xE041, 0x89E0)
+DOUBLE_BYTE_PAIR(0xE042, 0x89E2)
+DOUBLE_BYTE_PAIR(0xE043, 0x89DC)
+DOUBLE_BYTE_PAIR(0xE044, 0x89E6)
+DOUBLE_BYTE_PAIR(0xE045, 0x8A76)
+DOUBLE_BYTE_PAIR(0xE046, 0x8A86)
+DOUBLE_BYTE_PAIR(0xE047, 0x8A7F)
+DOUBLE_BYTE_PAIR(0xE048, 0x8A61)
+DOUBLE_BYTE_PAIR(0xE049, 0x8A3F)
+DOUBLE_BYTE_PAIR(0xE04A, 0x8A77)
+DOUBLE_BYTE_PAIR(0xE04B, 0x8A82)
+DOUBLE_BYTE_PAIR(0xE04C, 0x8A84)
+DOUBLE_BYTE_PAIR(0xE04D, 0x8A75)
+DOUBLE_BYTE_PAIR(0xE04E, 0x8A83)
+DOUBLE_BYTE_PAIR(0xE04F, 0x8A81)
+DOUBLE_BYTE_PAIR(0xE050, 0x8A74)
+DOUBLE_BYTE_PAIR(0xE051, 0x8A7A)
+DOUBLE_BYTE_PAIR(0xE052, 0x8C3C)
+DOUBLE_BYTE_PAIR(0xE053, 0x8C4B)
+DOUBLE_BYTE_PAIR(0xE054, 0x8C4A)
+DOUBLE_BYTE_PAIR(0xE055, 0x8C65)
+DOUBLE_BYTE_PAIR(0xE056, 0x8C64)
+DOUBLE_BYTE_PAIR(0xE057, 0x8C66)
+DOUBLE_BYTE_PAIR(0xE058, 0x8C86)
+DOUBLE_BYTE_PAIR(0xE059, 0x8C84)
+DOUBLE_BYTE_PAIR(0xE05A, 0x8C85)
+DOUBLE_BYTE_PAIR(0xE05B, 0x8CCC)
+DOUBLE_BYTE_PAIR(0xE05C, 0x8D68)
+DOUBLE_BYTE_PAIR(0xE05D, 0x8D69)
+DOUBLE_BYTE_PAIR(0xE05E, 0x8D91)
+DOUBLE_BYTE_PAIR(0xE05F, 0x8D8C)
+DOUBLE_BYTE_PAIR(0xE060, 0x8D8E)
+DOUBLE_BYTE_PAIR(0xE061, 0x8D8F)
+DOUBLE_BYTE_PAIR(0xE062, 0x8D8D)
+DOUBLE_BYTE_PAIR(0xE063, 0x8D93)
+DOUBLE_BYTE_PAIR(0xE064, 0x8D94)
+DOUBLE_BYTE_PAIR(0xE065, 0x8D90)
+DOUBLE_BYTE_PAIR(0xE066, 0x8D92)
+DOUBLE_BYTE_PAIR(0xE067, 0x8DF0)
+DOUBLE_BYTE_PAIR(0xE068, 0x8DE0)
+DOUBLE_BYTE_PAIR(0xE069, 0x8DEC)
+DOUBLE_BYTE_PAIR(0xE06A, 0x8DF1)
+DOUBLE_BYTE_PAIR(0xE06B, 0x8DEE)
+DOUBLE_BYTE_PAIR(0xE06C, 0x8DD0)
+DOUBLE_BYTE_PAIR(0xE06D, 0x8DE9)
+DOUBLE_BYTE_PAIR(0xE06E, 0x8DE3)
+DOUBLE_BYTE_PAIR(0xE06F, 0x8DE2)
+DOUBLE_BYTE_PAIR(0xE070, 0x8DE7)
+DOUBLE_BYTE_PAIR(0xE071, 0x8DF2)
+DOUBLE_BYTE_PAIR(0xE072, 0x8DEB)
+DOUBLE_BYTE_PAIR(0xE073, 0x8DF4)
+DOUBLE_BYTE_PAIR(0xE074, 0x8F06)
+DOUBLE_BYTE_PAIR(0xE075, 0x8EFF)
+DOUBLE_BYTE_PAIR(0xE076, 0x8F01)
+DOUBLE_BYTE_PAIR(0xE077, 0x8F00)
+DOUBLE_BYTE_PAIR(0xE078, 0x8F05)
+DOUBLE_BYTE_PAIR(0xE079, 0x8F07)
+DOUBLE_BYTE_PAIR(0xE07A, 0x8F08)
+DOUBLE_BYTE_PAIR(0xE07B, 0x8F02)
+DOUBLE_BYTE_PAIR(0xE07C, 0x8F0B)
+DOUBLE_BYTE_PAIR(0xE07D, 0x9052)
+DOUBLE_BYTE_PAIR(0xE07E, 0x903F)
+DOUBLE_BYTE_PAIR(0xE0A1, 0x9044)
+DOUBLE_BYTE_PAIR(0xE0A2, 0x9049)
+DOUBLE_BYTE_PAIR(0xE0A3, 0x903D)
+DOUBLE_BYTE_PAIR(0xE0A4, 0x9110)
+DOUBLE_BYTE_PAIR(0xE0A5, 0x910D)
+DOUBLE_BYTE_PAIR(0xE0A6, 0x910F)
+DOUBLE_BYTE_PAIR(0xE0A7, 0x9111)
+DOUBLE_BYTE_PAIR(0xE0A8, 0x9116)
+DOUBLE_BYTE_PAIR(0xE0A9, 0x9114)
+DOUBLE_BYTE_PAIR(0xE0AA, 0x910B)
+DOUBLE_BYTE_PAIR(0xE0AB, 0x910E)
+DOUBLE_BYTE_PAIR(0xE0AC, 0x916E)
+DOUBLE_BYTE_PAIR(0xE0AD, 0x916F)
+DOUBLE_BYTE_PAIR(0xE0AE, 0x9248)
+DOUBLE_BYTE_PAIR(0xE0AF, 0x9252)
+DOUBLE_BYTE_PAIR(0xE0B0, 0x9230)
+DOUBLE_BYTE_PAIR(0xE0B1, 0x923A)
+DOUBLE_BYTE_PAIR(0xE0B2, 0x9266)
+DOUBLE_BYTE_PAIR(0xE0B3, 0x9233)
+DOUBLE_BYTE_PAIR(0xE0B4, 0x9265)
+DOUBLE_BYTE_PAIR(0xE0B5, 0x925E)
+DOUBLE_BYTE_PAIR(0xE0B6, 0x9283)
+DOUBLE_BYTE_PAIR(0xE0B7, 0x922E)
+DOUBLE_BYTE_PAIR(0xE0B8, 0x924A)
+DOUBLE_BYTE_PAIR(0xE0B9, 0x9246)
+DOUBLE_BYTE_PAIR(0xE0BA, 0x926D)
+DOUBLE_BYTE_PAIR(0xE0BB, 0x926C)
+DOUBLE_BYTE_PAIR(0xE0BC, 0x924F)
+DOUBLE_BYTE_PAIR(0xE0BD, 0x9260)
+DOUBLE_BYTE_PAIR(0xE0BE, 0x9267)
+DOUBLE_BYTE_PAIR(0xE0BF, 0x926F)
+DOUBLE_BYTE_PAIR(0xE0C0, 0x9236)
+DOUBLE_BYTE_PAIR(0xE0C1, 0x9261)
+DOUBLE_BYTE_PAIR(0xE0C2, 0x9270)
+DOUBLE_BYTE_PAIR(0xE0C3, 0x9231)
+DOUBLE_BYTE_PAIR(0xE0C4, 0x9254)
+DOUBLE_BYTE_PAIR(0xE0C5, 0x9263)
+DOUBLE_BYTE_PAIR(0xE0C6, 0x9250)
+DOUBLE_BYTE_PAIR(0xE0C7, 0x9272)
+DOUBLE_BYTE_PAIR(0xE0C8, 0x924E)
+DOUBLE_BYTE_PAIR(0xE0C9, 0x9253)
+DOUBLE_BYTE_PAIR(0xE0CA, 0x924C)
+DOUBLE_BYTE_PAIR(0xE0CB, 0x9256)
+DOUBLE_BYTE_PAIR(0xE0CC, 0x9232)
+DOUBLE_BYTE_PAIR(0xE0CD, 0x959F)
+DOUBLE_BYTE_PAIR(0xE0CE, 0x959C)
+DOUBLE_BYTE_PAIR(0xE0CF, 0x959E)
+DOUBLE_BYTE_PAIR(0xE0D0, 0x959B)
+DOUBLE_BYTE_PAIR(0xE0D1, 0x9692)
+DOUBLE_BYTE_PAIR(0xE0D2, 0x9693)
+DOUBLE_BYTE_PAIR(0xE0D3, 0x9691)
+DOUBLE_BYTE_PAIR(0xE0D4, 0x9697)
+DOUBLE_BYTE_PAIR(0xE0D5, 0x96CE)
+DOUBLE_BYTE_PAIR(0xE0D6, 0x96FA)
+DOUBLE_BYTE_PAIR(0xE0D7, 0x96FD)
+DOUBLE_BYTE_PAIR(0xE0D8, 0x96F8)
+DOUBLE_BYTE_PAIR(0xE0D9, 0x96F5)
+DOUBLE_BYTE_PAIR(0xE0DA, 0x9773)
+DOUBLE_BYTE_PAIR(0xE0DB, 0x9777)
+DOUBLE_BYTE_PAIR(0xE0DC, 0x9778)
+DOUBLE_BYTE_PAIR(0xE0DD, 0x9772)
+DOUBLE_BYTE_PAIR(0xE0DE, 0x980F)
+DOUBLE_BYTE_PAIR(0xE0DF, 0x980D)
+DOUBLE_BYTE_PAIR(0xE0E0, 0x980E)
+DOUBLE_BYTE_PAIR(0xE0E1, 0x98AC)
+DOUBLE_BYTE_PAIR(0xE0E2, 0x98F6)
+DOUBLE_BYTE_PAIR(0xE0E3, 0x98F9)
+DOUBLE_BYTE_PAIR(0xE0E4, 0x99AF)
+DOUBLE_BYTE_PAIR(0xE0E5, 0x99B2)
+DOUBLE_BYTE_PAIR(0xE0E6, 0x99B0)
+DOUBLE_BYTE_PAIR(0xE0E7, 0x99B5)
+DOUBLE_BYTE_PAIR(0xE0E8, 0x9AAD)
+DOUBLE_BYTE_PAIR(0xE0E9, 0x9AAB)
+DOUBLE_BYTE_PAIR(0xE0EA, 0x9B5B)
+DOUBLE_BYTE_PAIR(0xE0EB, 0x9CEA)
+DOUBLE_BYTE_PAIR(0xE0EC, 0x9CED)
+DOUBLE_BYTE_PAIR(0xE0ED, 0x9CE7)
+DOUBLE_BYTE_PAIR(0xE0EE, 0x9E80)
+DOUBLE_BYTE_PAIR(0xE0EF, 0x9EFD)
+DOUBLE_BYTE_PAIR(0xE0F0, 0x50E6)
+DOUBLE_BYTE_PAIR(0xE0F1, 0x50D4)
+DOUBLE_BYTE_PAIR(0xE0F2, 0x50D7)
+DOUBLE_BYTE_PAIR(0xE0F3, 0x50E8)
+DOUBLE_BYTE_PAIR(0xE0F4, 0x50F3)
+DOUBLE_BYTE_PAIR(0xE0F5, 0x50DB)
+DOUBLE_BYTE_PAIR(0xE0F6, 0x50EA)
+DOUBLE_BYTE_PAIR(0xE0F7, 0x50DD)
+DOUBLE_BYTE_PAIR(0xE0F8, 0x50E4)
+DOUBLE_BYTE_PAIR(0xE0F9, 0x50D3)
+DOUBLE_BYTE_PAIR(0xE0FA, 0x50EC)
+DOUBLE_BYTE_PAIR(0xE0FB, 0x50F0)
+DOUBLE_BYTE_PAIR(0xE0FC, 0x50EF)
+DOUBLE_BYTE_PAIR(0xE0FD, 0x50E3)
+DOUBLE_BYTE_PAIR(0xE0FE, 0x50E0)
+DOUBLE_BYTE_PAIR(0xE140, 0x51D8)
+DOUBLE_BYTE_PAIR(0xE141, 0x5280)
+DOUBLE_BYTE_PAIR(0xE142, 0x5281)
+DOUBLE_BYTE_PAIR(0xE143, 0x52E9)
+DOUBLE_BYTE_PAIR(0xE144, 0x52EB)
+DOUBLE_BYTE_PAIR(0xE145, 0x5330)
+DOUBLE_BYTE_PAIR(0xE146, 0x53AC)
+DOUBLE_BYTE_PAIR(0xE147, 0x5627)
+DOUBLE_BYTE_PAIR(0xE148, 0x5615)
+DOUBLE_BYTE_PAIR(0xE149, 0x560C)
+DOUBLE_BYTE_PAIR(0xE14A, 0x5612)
+DOUBLE_BYTE_PAIR(0xE14B, 0x55FC)
+DOUBLE_BYTE_PAIR(0xE14C, 0x560F)
+DOUBLE_BYTE_PAIR(0xE14D, 0x561C)
+DOUBLE_BYTE_PAIR(0xE14E, 0x5601)
+DOUBLE_BYTE_PAIR(0xE14F, 0x5613)
+DOUBLE_BYTE_PAIR(0xE150, 0x5602)
+DOUBLE_BYTE_PAIR(0xE151, 0x55FA)
+DOUBLE_BYTE_PAIR(0xE152, 0x561D)
+DOUBLE_BYTE_PAIR(0xE153, 0x5604)
+DOUBLE_BYTE_PAIR(0xE154, 0x55FF)
+DOUBLE_BYTE_PAIR(0xE155, 0x55F9)
+DOUBLE_BYTE_PAIR(0xE156, 0x5889)
+DOUBLE_BYTE_PAIR(0xE157, 0x587C)
+DOUBLE_BYTE_PAIR(0xE158, 0x5890)
+DOUBLE_BYTE_PAIR(0xE159, 0x5898)
+DOUBLE_BYTE_PAIR(0xE15A, 0x5886)
+DOUBLE_BYTE_PAIR(0xE15B, 0x5881)
+DOUBLE_BYTE_PAIR(0xE15C, 0x587F)
+DOUBLE_BYTE_PAIR(0xE15D, 0x5874)
+DOUBLE_BYTE_PAIR(0xE15E, 0x588B)
+DOUBLE_BYTE_PAIR(0xE15F, 0x587A)
+DOUBLE_BYTE_PAIR(0xE160, 0x5887)
+DOUBLE_BYTE_PAIR(0xE161, 0x5891)
+DOUBLE_BYTE_PAIR(0xE162, 0x588E)
+DOUBLE_BYTE_PAIR(0xE163, 0x5876)
+DOUBLE_BYTE_PAIR(0xE164, 0x5882)
+DOUBLE_BYTE_PAIR(0xE165, 0x5888)
+DOUBLE_BYTE_PAIR(0xE166, 0x587B)
+DOUBLE_BYTE_PAIR(0xE167, 0x5894)
+DOUBLE_BYTE_PAIR(0xE168, 0x588F)
+DOUBLE_BYTE_PAIR(0xE169, 0x58FE)
+DOUBLE_BYTE_PAIR(0xE16A, 0x596B)
+DOUBLE_BYTE_PAIR(0xE16B, 0x5ADC)
+DOUBLE_BYTE_PAIR(0xE16C, 0x5AEE)
+DOUBLE_BYTE_PAIR(0xE16D, 0x5AE5)
+DOUBLE_BYTE_PAIR(0xE16E, 0x5AD5)
+DOUBLE_BYTE_PAIR(0xE16F, 0x5AEA)
+DOUBLE_BYTE_PAIR(0xE170, 0x5ADA)
+DOUBLE_BYTE_PAIR(0xE171, 0x5AED)
+DOUBLE_BYTE_PAIR(0xE172, 0x5AEB)
+DOUBLE_BYTE_PAIR(0xE173, 0x5AF3)
+DOUBLE_BYTE_PAIR(0xE174, 0x5AE2)
+DOUBLE_BYTE_PAIR(0xE175, 0x5AE0)
+DOUBLE_BYTE_PAIR(0xE176, 0x5ADB)
+DOUBLE_BYTE_PAIR(0xE177, 0x5AEC)
+DOUBLE_BYTE_PAIR(0xE178, 0x5ADE)
+DOUBLE_BYTE_PAIR(0xE179, 0x5ADD)
+DOUBLE_BYTE_PAIR(0xE17A, 0x5AD9)
+DOUBLE_BYTE_PAIR(0xE17B, 0x5AE8)
+DOUBLE_BYTE_PAIR(0xE17C, 0x5ADF)
+DOUBLE_BYTE_PAIR(0xE17D, 0x5B77)
+DOUBLE_BYTE_PAIR(0xE17E, 0x5BE0)
+DOUBLE_BYTE_PAIR(0xE1A1, 0x5BE3)
+DOUBLE_BYTE_PAIR(0xE1A2, 0x5C63)
+DOUBLE_BYTE_PAIR(0xE1A3, 0x5D82)
+DOUBLE_BYTE_PAIR(0xE1A4, 0x5D80)
+DOUBLE_BYTE_PAIR(0xE1A5, 0x5D7D)
+DOUBLE_BYTE_PAIR(0xE1A6, 0x5D86)
+DOUBLE_BYTE_PAIR(0xE1A7, 0x5D7A)
+DOUBLE_BYTE_PAIR(0xE1A8, 0x5D81)
+DOUBLE_BYTE_PAIR(0xE1A9, 0x5D77)
+DOUBLE_BYTE_PAIR(0xE1AA, 0x5D8A)
+DOUBLE_BYTE_PAIR(0xE1AB, 0x5D89)
+DOUBLE_BYTE_PAIR(0xE1AC, 0x5D88)
+DOUBLE_BYTE_PAIR(0xE1AD, 0x5D7E)
+DOUBLE_BYTE_PAIR(0xE1AE, 0x5D7C)
+DOUBLE_BYTE_PAIR(0xE1AF, 0x5D8D)
+DOUBLE_BYTE_PAIR(0xE1B0, 0x5D79)
+DOUBLE_BYTE_PAIR(0xE1B1, 0x5D7F)
+DOUBLE_BYTE_PAIR(0xE1B2, 0x5E58)
+DOUBLE_BYTE_PAIR(0xE1B3, 0x5E59)
+DOUBLE_BYTE_PAIR(0xE1B4, 0x5E53)
+DOUBLE_BYTE_PAIR(0xE1B5, 0x5ED8)
+DOUBLE_BYTE_PAIR(0xE1B6, 0x5ED1)
+DOUBLE_BYTE_PAIR(0xE1B7, 0x5ED7)
+DOUBLE_BYTE_PAIR(0xE1B8, 0x5ECE)
+DOUBLE_BYTE_PAIR(0xE1B9, 0x5EDC)
+DOUBLE_BYTE_PAIR(0xE1BA, 0x5ED5)
+DOUBLE_BYTE_PAIR(0xE1BB, 0x5ED9)
+DOUBLE_BYTE_PAIR(0xE1BC, 0x5ED2)
+DOUBLE_BYTE_PAIR(0xE1BD, 0x5ED4)
+DOUBLE_BYTE_PAIR(0xE1BE, 0x5F44)
+DOUBLE_BYTE_PAIR(0xE1BF, 0x5F43)
+DOUBLE_BYTE_PAIR(0xE1C0, 0x5F6F)
+DOUBLE_BYTE_PAIR(0xE1C1, 0x5FB6)
+DOUBLE_BYTE_PAIR(0xE1C2, 0x612C)
+DOUBLE_BYTE_PAIR(0xE1C3, 0x6128)
+DOUBLE_BYTE_PAIR(0xE1C4, 0x6141)
+DOUBLE_BYTE_PAIR(0xE1C5, 0x615E)
+DOUBLE_BYTE_PAIR(0xE1C6, 0x6171)
+DOUBLE_BYTE_PAIR(0xE1C7, 0x6173)
+DOUBLE_BYTE_PAIR(0xE1C8, 0x6152)
+DOUBLE_BYTE_PAIR(0xE1C9, 0x6153)
+DOUBLE_BYTE_PAIR(0xE1CA, 0x6172)
+DOUBLE_BYTE_PAIR(0xE1CB, 0x616C)
+DOUBLE_BYTE_PAIR(0xE1CC, 0x6180)
+DOUBLE_BYTE_PAIR(0xE1CD, 0x6174)
+DOUBLE_BYTE_PAIR(0xE1CE, 0x6154)
+DOUBLE_BYTE_PAIR(0xE1CF, 0x617A)
+DOUBLE_BYTE_PAIR(0xE1D0, 0x615B)
+DOUBLE_BYTE_PAIR(0xE1D1, 0x6165)
+DOUBLE_BYTE_PAIR(0xE1D2, 0x613B)
+DOUBLE_BYTE_PAIR(0xE1D3, 0x616A)
+DOUBLE_BYTE_PAIR(0xE1D4, 0x6161)
+DOUBLE_BYTE_PAIR(0xE1D5, 0x6156)
+DOUBLE_BYTE_PAIR(0xE1D6, 0x6229)
+DOUBLE_BYTE_PAIR(0xE1D7, 0x6227)
+DOUBLE_BYTE_PAIR(0xE1D8, 0x622B)
+DOUBLE_BYTE_PAIR(0xE1D9, 0x642B)
+DOUBLE_BYTE_PAIR(0xE1DA, 0x644D)
+DOUBLE_BYTE_PAIR(0xE1DB, 0x645B)
+DOUBLE_BYTE_PAIR(0xE1DC, 0x645D)
+DOUBLE_BYTE_PAIR(0xE1DD, 0x6474)
+DOUBLE_BYTE_PAIR(0xE1DE, 0x6476)
+DOUBLE_BYTE_PAIR(0xE1DF, 0x6472)
+DOUBLE_BYTE_PAIR(0xE1E0, 0x6473)
+DOUBLE_BYTE_PAIR(0xE1E1, 0x647D)
+DOUBLE_BYTE_PAIR(0xE1E2, 0x6475)
+DOUBLE_BYTE_PAIR(0xE1E3, 0x6466)
+DOUBLE_BYTE_PAIR(0xE1E4, 0x64A6)
+DOUBLE_BYTE_PAIR(0xE1E5, 0x644E)
+DOUBLE_BYTE_PAIR(0xE1E6, 0x6482)
+DOUBLE_BYTE_PAIR(0xE1E7, 0x645E)
+DOUBLE_BYTE_PAIR(0xE1E8, 0x645C)
+DOUBLE_BYTE_PAIR(0xE1E9, 0x644B)
+DOUBLE_BYTE_PAIR(0xE1EA, 0x6453)
+DOUBLE_BYTE_PAIR(0xE1EB, 0x6460)
+DOUBLE_BYTE_PAIR(0xE1EC, 0x6450)
+DOUBLE_BYTE_PAIR(0xE1ED, 0x647F)
+DOUBLE_BYTE_PAIR(0xE1EE, 0x643F)
+DOUBLE_BYTE_PAIR(0xE1EF, 0x646C)
+DOUBLE_BYTE_PAIR(0xE1F0, 0x646B)
+DOUBLE_BYTE_PAIR(0xE1F1, 0x6459)
+DOUBLE_BYTE_PAIR(0xE1F2, 0x6465)
+DOUBLE_BYTE_PAIR(0xE1F3, 0x6477)
+DOUBLE_BYTE_PAIR(0xE1F4, 0x6573)
+DOUBLE_BYTE_PAIR(0xE1F5, 0x65A0)
+DOUBLE_BYTE_PAIR(0xE1F6, 0x66A1)
+DOUBLE_BYTE_PAIR(0xE1F7, 0x66A0)
+DOUBLE_BYTE_PAIR(0xE1F8, 0x669F)
+DOUBLE_BYTE_PAIR(0xE1F9, 0x6705)
+DOUBLE_BYTE_PAIR(0xE1FA, 0x6704)
+DOUBLE_BYTE_PAIR(0xE1FB, 0x6722)
+DOUBLE_BYTE_PAIR(0xE1FC, 0x69B1)
+DOUBLE_BYTE_PAIR(0xE1FD, 0x69B6)
+DOUBLE_BYTE_PAIR(0xE1FE, 0x69C9)
+DOUBLE_BYTE_PAIR(0xE240, 0x69A0)
+DOUBLE_BYTE_PAIR(0xE241, 0x69CE)
+DOUBLE_BYTE_PAIR(0xE242, 0x6996)
+DOUBLE_BYTE_PAIR(0xE243, 0x69B0)
+DOUBLE_BYTE_PAIR(0xE244, 0x69AC)
+DOUBLE_BYTE_PAIR(0xE245, 0x69BC)
+DOUBLE_BYTE_PAIR(0xE246, 0x6991)
+DOUBLE_BYTE_PAIR(0xE247, 0x6999)
+DOUBLE_BYTE_PAIR(0xE248, 0x698E)
+DOUBLE_BYTE_PAIR(0xE249, 0x69A7)
+DOUBLE_BYTE_PAIR(0xE24A, 0x698D)
+DOUBLE_BYTE_PAIR(0xE24B, 0x69A9)
+DOUBLE_BYTE_PAIR(0xE24C, 0x69BE)
+DOUBLE_BYTE_PAIR(0xE24D, 0x69AF)
+DOUBLE_BYTE_PAIR(0xE24E, 0x69BF)
+DOUBLE_BYTE_PAIR(0xE24F, 0x69C4)
+DOUBLE_BYTE_PAIR(0xE250, 0x69BD)
+DOUBLE_BYTE_PAIR(0xE251, 0x69A4)
+DOUBLE_BYTE_PAIR(0xE252, 0x69D4)
+DOUBLE_BYTE_PAIR(0xE253, 0x69B9)
+DOUBLE_BYTE_PAIR(0xE254, 0x69CA)
+DOUBLE_BYTE_PAIR(0xE255, 0x699A)
+DOUBLE_BYTE_PAIR(0xE256, 0x69CF)
+DOUBLE_BYTE_PAIR(0xE257, 0x69B3)
+DOUBLE_BYTE_PAIR(0xE258, 0x6993)
+DOUBLE_BYTE_PAIR(0xE259, 0x69AA)
+DOUBLE_BYTE_PAIR(0xE25A, 0x69A1)
+DOUBLE_BYTE_PAIR(0xE25B, 0x699E)
+DOUBLE_BYTE_PAIR(0xE25C, 0x69D9)
+DOUBLE_BYTE_PAIR(0xE25D, 0x6997)
+DOUBLE_BYTE_PAIR(0xE25E, 0x6990)
+DOUBLE_BYTE_PAIR(0xE25F, 0x69C2)
+DOUBLE_BYTE_PAIR(0xE260, 0x69B5)
+DOUBLE_BYTE_PAIR(0xE261, 0x69A5)
+DOUBLE_BYTE_PAIR(0xE262, 0x69C6)
+DOUBLE_BYTE_PAIR(0xE263, 0x6B4A)
+DOUBLE_BYTE_PAIR(0xE264, 0x6B4D)
+DOUBLE_BYTE_PAIR(0xE265, 0x6B4B)
+DOUBLE_BYTE_PAIR(0xE266, 0x6B9E)
+DOUBLE_BYTE_PAIR(0xE267, 0x6B9F)
+DOUBLE_BYTE_PAIR(0xE268, 0x6BA0)
+DOUBLE_BYTE_PAIR(0xE269, 0x6BC3)
+DOUBLE_BYTE_PAIR(0xE26A, 0x6BC4)
+DOUBLE_BYTE_PAIR(0xE26B, 0x6BFE)
+DOUBLE_BYTE_PAIR(0xE26C, 0x6ECE)
+DOUBLE_BYTE_PAIR(0xE26D, 0x6EF5)
+DOUBLE_BYTE_PAIR(0xE26E, 0x6EF1)
+DOUBLE_BYTE_PAIR(0xE26F, 0x6F03)
+DOUBLE_BYTE_PAIR(0xE270, 0x6F25)
+DOUBLE_BYTE_PAIR(0xE271, 0x6EF8)
+DOUBLE_BYTE_PAIR(0xE272, 0x6F37)
+DOUBLE_BYTE_PAIR(0xE273, 0x6EFB)
+DOUBLE_BYTE_PAIR(0xE274, 0x6F2E)
+DOUBLE_BYTE_PAIR(0xE275, 0x6F09)
+DOUBLE_BYTE_PAIR(0xE276, 0x6F4E)
+DOUBLE_BYTE_PAIR(0xE277, 0x6F19)
+DOUBLE_BYTE_PAIR(0xE278, 0x6F1A)
+DOUBLE_BYTE_PAIR(0xE279, 0x6F27)
+DOUBLE_BYTE_PAIR(0xE27A, 0x6F18)
+DOUBLE_BYTE_PAIR(0xE27B, 0x6F3B)
+DOUBLE_BYTE_PAIR(0xE27C, 0x6F12)
+DOUBLE_BYTE_PAIR(0xE27D, 0x6EED)
+DOUBLE_BYTE_PAIR(0xE27E, 0x6F0A)
+DOUBLE_BYTE_PAIR(0xE2A1, 0x6F36)
+DOUBLE_BYTE_PAIR(0xE2A2, 0x6F73)
+DOUBLE_BYTE_PAIR(0xE2A3, 0x6EF9)
+DOUBLE_BYTE_PAIR(0xE2A4, 0x6EEE)
+DOUBLE_BYTE_PAIR(0xE2A5, 0x6F2D)
+DOUBLE_BYTE_PAIR(0xE2A6, 0x6F40)
+DOUBLE_BYTE_PAIR(0xE2A7, 0x6F30)
+DOUBLE_BYTE_PAIR(0xE2A8, 0x6F3C)
+DOUBLE_BYTE_PAIR(0xE2A9, 0x6F35)
+DOUBLE_BYTE_PAIR(0xE2AA, 0x6EEB)
+DOUBLE_BYTE_PAIR(0xE2AB, 0x6F07)
+DOUBLE_BYTE_PAIR(0xE2AC, 0x6F0E)
+DOUBLE_BYTE_PAIR(0xE2AD, 0x6F43)
+DOUBLE_BYTE_PAIR(0xE2AE, 0x6F05)
+DOUBLE_BYTE_PAIR(0xE2AF, 0x6EFD)
+DOUBLE_BYTE_PAIR(0xE2B0, 0x6EF6)
+DOUBLE_BYTE_PAIR(0xE2B1, 0x6F39)
+DOUBLE_BYTE_PAIR(0xE2B2, 0x6F1C)
+DOUBLE_BYTE_PAIR(0xE2B3, 0x6EFC)
+DOUBLE_BYTE_PAIR(0xE2B4, 0x6F3A)
+DOUBLE_BYTE_PAIR(0xE2B5, 0x6F1F)
+DOUBLE_BYTE_PAIR(0xE2B6, 0x6F0D)
+DOUBLE_BYTE_PAIR(0xE2B7, 0x6F1E)
+DOUBLE_BYTE_PAIR(0xE2B8, 0x6F08)
+DOUBLE_BYTE_PAIR(0xE2B9, 0x6F21)
+DOUBLE_BYTE_PAIR(0xE2BA, 0x7187)
+DOUBLE_BYTE_PAIR(0xE2BB, 0x7190)
+DOUBLE_BYTE_PAIR(0xE2BC, 0x7189)
+DOUBLE_BYTE_PAIR(0xE2BD, 0x7180)
+DOUBLE_BYTE_PAIR(0xE2BE, 0x7185)
+DOUBLE_BYTE_PAIR(0xE2BF, 0x7182)
+DOUBLE_BYTE_PAIR(0xE2C0, 0x718F)
+DOUBLE_BYTE_PAIR(0xE2C1, 0x717B)
+DOUBLE_BYTE_PAIR(0xE2C2, 0x7186)
+DOUBLE_BYTE_PAIR(0xE2C3, 0x7181)
+DOUBLE_BYTE_PAIR(0xE2C4, 0x7197)
+DOUBLE_BYTE_PAIR(0xE2C5, 0x7244)
+DOUBLE_BYTE_PAIR(0xE2C6, 0x7253)
+DOUBLE_BYTE_PAIR(0xE2C7, 0x7297)
+DOUBLE_BYTE_PAIR(0xE2C8, 0x7295)
+DOUBLE_BYTE_PAIR(0xE2C9, 0x7293)
+DOUBLE_BYTE_PAIR(0xE2CA, 0x7343)
+DOUBLE_BYTE_PAIR(0xE2CB, 0x734D)
+DOUBLE_BYTE_PAIR(0xE2CC, 0x7351)
+DOUBLE_BYTE_PAIR(0xE2CD, 0x734C)
+DOUBLE_BYTE_PAIR(0xE2CE, 0x7462)
+DOUBLE_BYTE_PAIR(0xE2CF, 0x7473)
+DOUBLE_BYTE_PAIR(0xE2D0, 0x7471)
+DOUBLE_BYTE_PAIR(0xE2D1, 0x7475)
+DOUBLE_BYTE_PAIR(0xE2D2, 0x7472)
+DOUBLE_BYTE_PAIR(0xE2D3, 0x7467)
+DOUBLE_BYTE_PAIR(0xE2D4, 0x746E)
+DOUBLE_BYTE_PAIR(0xE2D5, 0x7500)
+DOUBLE_BYTE_PAIR(0xE2D6, 0x7502)
+DOUBLE_BYTE_PAIR(0xE2D7, 0x7503)
+DOUBLE_BYTE_PAIR(0xE2D8, 0x757D)
+DOUBLE_BYTE_PAIR(0xE2D9, 0x7590)
+DOUBLE_BYTE_PAIR(0xE2DA, 0x7616)
+DOUBLE_BYTE_PAIR(0xE2DB, 0x7608)
+DOUBLE_BYTE_PAIR(0xE2DC, 0x760C)
+DOUBLE_BYTE_PAIR(0xE2DD, 0x7615)
+DOUBLE_BYTE_PAIR(0xE2DE, 0x7611)
+DOUBLE_BYTE_PAIR(0xE2DF, 0x760A)
+DOUBLE_BYTE_PAIR(0xE2E0, 0x7614)
+DOUBLE_BYTE_PAIR(0xE2E1, 0x76B8)
+DOUBLE_BYTE_PAIR(0xE2E2, 0x7781)
+DOUBLE_BYTE_PAIR(0xE2E3, 0x777C)
+DOUBLE_BYTE_PAIR(0xE2E4, 0x7785)
+DOUBLE_BYTE_PAIR(0xE2E5, 0x7782)
+DOUBLE_BYTE_PAIR(0xE2E6, 0x776E)
+DOUBLE_BYTE_PAIR(0xE2E7, 0x7780)
+DOUBLE_BYTE_PAIR(0xE2E8, 0x776F)
+DOUBLE_BYTE_PAIR(0xE2E9, 0x777E)
+DOUBLE_BYTE_PAIR(0xE2EA, 0x7783)
+DOUBLE_BYTE_PAIR(0xE2EB, 0x78B2)
+DOUBLE_BYTE_PAIR(0xE2EC, 0x78AA)
+DOUBLE_BYTE_PAIR(0xE2ED, 0x78B4)
+DOUBLE_BYTE_PAIR(0xE2EE, 0x78AD)
+DOUBLE_BYTE_PAIR(0xE2EF, 0x78A8)
+DOUBLE_BYTE_PAIR(0xE2F0, 0x787E)
+DOUBLE_BYTE_PAIR(0xE2F1, 0x78AB)
+DOUBLE_BYTE_PAIR(0xE2F2, 0x789E)
+DOUBLE_BYTE_PAIR(0xE2F3, 0x78A5)
+DOUBLE_BYTE_PAIR(0xE2F4, 0x78A0)
+DOUBLE_BYTE_PAIR(0xE2F5, 0x78AC)
+DOUBLE_BYTE_PAIR(0xE2F6, 0x78A2)
+DOUBLE_BYTE_PAIR(0xE2F7, 0x78A4)
+DOUBLE_BYTE_PAIR(0xE2F8, 0x7998)
+DOUBLE_BYTE_PAIR(0xE2F9, 0x798A)
+DOUBLE_BYTE_PAIR(0xE2FA, 0x798B)
+DOUBLE_BYTE_PAIR(0xE2FB, 0x7996)
+DOUBLE_BYTE_PAIR(0xE2FC, 0x7995)
+DOUBLE_BYTE_PAIR(0xE2FD, 0x7994)
+DOUBLE_BYTE_PAIR(0xE2FE, 0x7993)
+DOUBLE_BYTE_PAIR(0xE340, 0x7997)
+DOUBLE_BYTE_PAIR(0xE341, 0x7988)
+DOUBLE_BYTE_PAIR(0xE342, 0x7992)
+DOUBLE_BYTE_PAIR(0xE343, 0x7990)
+DOUBLE_BYTE_PAIR(0xE344, 0x7A2B)
+DOUBLE_BYTE_PAIR(0xE345, 0x7A4A)
+DOUBLE_BYTE_PAIR(0xE346, 0x7A30)
+DOUBLE_BYTE_PAIR(0xE347, 0x7A2F)
+DOUBLE_BYTE_PAIR(0xE348, 0x7A28)
+DOUBLE_BYTE_PAIR(0xE349, 0x7A26)
+DOUBLE_BYTE_PAIR(0xE34A, 0x7AA8)
+DOUBLE_BYTE_PAIR(0xE34B, 0x7AAB)
+DOUBLE_BYTE_PAIR(0xE34C, 0x7AAC)
+DOUBLE_BYTE_PAIR(0xE34D, 0x7AEE)
+DOUBLE_BYTE_PAIR(0xE34E, 0x7B88)
+DOUBLE_BYTE_PAIR(0xE34F, 0x7B9C)
+DOUBLE_BYTE_PAIR(0xE350, 0x7B8A)
+DOUBLE_BYTE_PAIR(0xE351, 0x7B91)
+DOUBLE_BYTE_PAIR(0xE352, 0x7B90)
+DOUBLE_BYTE_PAIR(0xE353, 0x7B96)
+DOUBLE_BYTE_PAIR(0xE354, 0x7B8D)
+DOUBLE_BYTE_PAIR(0xE355, 0x7B8C)
+DOUBLE_BYTE_PAIR(0xE356, 0x7B9B)
+DOUBLE_BYTE_PAIR(0xE357, 0x7B8E)
+DOUBLE_BYTE_PAIR(0xE358, 0x7B85)
+DOUBLE_BYTE_PAIR(0xE359, 0x7B98)
+DOUBLE_BYTE_PAIR(0xE35A, 0x5284)
+DOUBLE_BYTE_PAIR(0xE35B, 0x7B99)
+DOUBLE_BYTE_PAIR(0xE35C, 0x7BA4)
+DOUBLE_BYTE_PAIR(0xE35D, 0x7B82)
+DOUBLE_BYTE_PAIR(0xE35E, 0x7CBB)
+DOUBLE_BYTE_PAIR(0xE35F, 0x7CBF)
+DOUBLE_BYTE_PAIR(0xE360, 0x7CBC)
+DOUBLE_BYTE_PAIR(0xE361, 0x7CBA)
+DOUBLE_BYTE_PAIR(0xE362, 0x7DA7)
+DOUBLE_BYTE_PAIR(0xE363, 0x7DB7)
+DOUBLE_BYTE_PAIR(0xE364, 0x7DC2)
+DOUBLE_BYTE_PAIR(0xE365, 0x7DA3)
+DOUBLE_BYTE_PAIR(0xE366, 0x7DAA)
+DOUBLE_BYTE_PAIR(0xE367, 0x7DC1)
+DOUBLE_BYTE_PAIR(0xE368, 0x7DC0)
+DOUBLE_BYTE_PAIR(0xE369, 0x7DC5)
+DOUBLE_BYTE_PAIR(0xE36A, 0x7D9D)
+DOUBLE_BYTE_PAIR(0xE36B, 0x7DCE)
+DOUBLE_BYTE_PAIR(0xE36C, 0x7DC4)
+DOUBLE_BYTE_PAIR(0xE36D, 0x7DC6)
+DOUBLE_BYTE_PAIR(0xE36E, 0x7DCB)
+DOUBLE_BYTE_PAIR(0xE36F, 0x7DCC)
+DOUBLE_BYTE_PAIR(0xE370, 0x7DAF)
+DOUBLE_BYTE_PAIR(0xE371, 0x7DB9)
+DOUBLE_BYTE_PAIR(0xE372, 0x7D96)
+DOUBLE_BYTE_PAIR(0xE373, 0x7DBC)
+DOUBLE_BYTE_PAIR(0xE374, 0x7D9F)
+DOUBLE_BYTE_PAIR(0xE375, 0x7DA6)
+DOUBLE_BYTE_PAIR(0xE376, 0x7DAE)
+DOUBLE_BYTE_PAIR(0xE377, 0x7DA9)
+DOUBLE_BYTE_PAIR(0xE378, 0x7DA1)
+DOUBLE_BYTE_PAIR(0xE379, 0x7DC9)
+DOUBLE_BYTE_PAIR(0xE37A, 0x7F73)
+DOUBLE_BYTE_PAIR(0xE37B, 0x7FE2)
+DOUBLE_BYTE_PAIR(0xE37C, 0x7FE3)
+DOUBLE_BYTE_PAIR(0xE37D, 0x7FE5)
+DOUBLE_BYTE_PAIR(0xE37E, 0x7FDE)
+DOUBLE_BYTE_PAIR(0xE3A1, 0x8024)
+DOUBLE_BYTE_PAIR(0xE3A2, 0x805D)
+DOUBLE_BYTE_PAIR(0xE3A3, 0x805C)
+DOUBLE_BYTE_PAIR(0xE3A4, 0x8189)
+DOUBLE_BYTE_PAIR(0xE3A5, 0x8186)
+DOUBLE_BYTE_PAIR(0xE3A6, 0x8183)
+DOUBLE_BYTE_PAIR(0xE3A7, 0x8187)
+DOUBLE_BYTE_PAIR(0xE3A8, 0x818D)
+DOUBLE_BYTE_PAIR(0xE3A9, 0x818C)
+DOUBLE_BYTE_PAIR(0xE3AA, 0x818B)
+DOUBLE_BYTE_PAIR(0xE3AB, 0x8215)
+DOUBLE_BYTE_PAIR(0xE3AC, 0x8497)
+DOUBLE_BYTE_PAIR(0xE3AD, 0x84A4)
+DOUBLE_BYTE_PAIR(0xE3AE, 0x84A1)
+DOUBLE_BYTE_PAIR(0xE3AF, 0x849F)
+DOUBLE_BYTE_PAIR(0xE3B0, 0x84BA)
+DOUBLE_BYTE_PAIR(0xE3B1, 0x84CE)
+DOUBLE_BYTE_PAIR(0xE3B2, 0x84C2)
+DOUBLE_BYTE_PAIR(0xE3B3, 0x84AC)
+DOUBLE_BYTE_PAIR(0xE3B4, 0x84AE)
+DOUBLE_BYTE_PAIR(0xE3B5, 0x84AB)
+DOUBLE_BYTE_PAIR(0xE3B6, 0x84B9)
+DOUBLE_BYTE_PAIR(0xE3B7, 0x84B4)
+DOUBLE_BYTE_PAIR(0xE3B8, 0x84C1)
+DOUBLE_BYTE_PAIR(0xE3B9, 0x84CD)
+DOUBLE_BYTE_PAIR(0xE3BA, 0x84AA)
+DOUBLE_BYTE_PAIR(0xE3BB, 0x849A)
+DOUBLE_BYTE_PAIR(0xE3BC, 0x84B1)
+DOUBLE_BYTE_PAIR(0xE3BD, 0x84D0)
+DOUBLE_BYTE_PAIR(0xE3BE, 0x849D)
+DOUBLE_BYTE_PAIR(0xE3BF, 0x84A7)
+DOUBLE_BYTE_PAIR(0xE3C0, 0x84BB)
+DOUBLE_BYTE_PAIR(0xE3C1, 0x84A2)
+DOUBLE_BYTE_PAIR(0xE3C2, 0x8494)
+DOUBLE_BYTE_PAIR(0xE3C3, 0x84C7)
+DOUBLE_BYTE_PAIR(0xE3C4, 0x84CC)
+DOUBLE_BYTE_PAIR(0xE3C5, 0x849B)
+DOUBLE_BYTE_PAIR(0xE3C6, 0x84A9)
+DOUBLE_BYTE_PAIR(0xE3C7, 0x84AF)
+DOUBLE_BYTE_PAIR(0xE3C8, 0x84A8)
+DOUBLE_BYTE_PAIR(0xE3C9, 0x84D6)
+DOUBLE_BYTE_PAIR(0xE3CA, 0x8498)
+DOUBLE_BYTE_PAIR(0xE3CB, 0x84B6)
+DOUBLE_BYTE_PAIR(0xE3CC, 0x84CF)
+DOUBLE_BYTE_PAIR(0xE3CD, 0x84A0)
+DOUBLE_BYTE_PAIR(0xE3CE, 0x84D7)
+DOUBLE_BYTE_PAIR(0xE3CF, 0x84D4)
+DOUBLE_BYTE_PAIR(0xE3D0, 0x84D2)
+DOUBLE_BYTE_PAIR(0xE3D1, 0x84DB)
+DOUBLE_BYTE_PAIR(0xE3D2, 0x84B0)
+DOUBLE_BYTE_PAIR(0xE3D3, 0x8491)
+DOUBLE_BYTE_PAIR(0xE3D4, 0x8661)
+DOUBLE_BYTE_PAIR(0xE3D5, 0x8733)
+DOUBLE_BYTE_PAIR(0xE3D6, 0x8723)
+DOUBLE_BYTE_PAIR(0xE3D7, 0x8728)
+DOUBLE_BYTE_PAIR(0xE3D8, 0x876B)
+DOUBLE_BYTE_PAIR(0xE3D9, 0x8740)
+DOUBLE_BYTE_PAIR(0xE3DA, 0x872E)
+DOUBLE_BYTE_PAIR(0xE3DB, 0x871E)
+DOUBLE_BYTE_PAIR(0xE3DC, 0x8721)
+DOUBLE_BYTE_PAIR(0xE3DD, 0x8719)
+DOUBLE_BYTE_PAIR(0xE3DE, 0x871B)
+DOUBLE_BYTE_PAIR(0xE3DF, 0x8743)
+DOUBLE_BYTE_PAIR(0xE3E0, 0x872C)
+DOUBLE_BYTE_PAIR(0xE3E1, 0x8741)
+DOUBLE_BYTE_PAIR(0xE3E2, 0x873E)
+DOUBLE_BYTE_PAIR(0xE3E3, 0x8746)
+DOUBLE_BYTE_PAIR(0xE3E4, 0x8720)
+DOUBLE_BYTE_PAIR(0xE3E5, 0x8732)
+DOUBLE_BYTE_PAIR(0xE3E6, 0x872A)
+DOUBLE_BYTE_PAIR(0xE3E7, 0x872D)
+DOUBLE_BYTE_PAIR(0xE3E8, 0x873C)
+DOUBLE_BYTE_PAIR(0xE3E9, 0x8712)
+DOUBLE_BYTE_PAIR(0xE3EA, 0x873A)
+DOUBLE_BYTE_PAIR(0xE3EB, 0x8731)
+DOUBLE_BYTE_PAIR(0xE3EC, 0x8735)
+DOUBLE_BYTE_PAIR(0xE3ED, 0x8742)
+DOUBLE_BYTE_PAIR(0xE3EE, 0x8726)
+DOUBLE_BYTE_PAIR(0xE3EF, 0x8727)
+DOUBLE_BYTE_PAIR(0xE3F0, 0x8738)
+DOUBLE_BYTE_PAIR(0xE3F1, 0x8724)
+DOUBLE_BYTE_PAIR(0xE3F2, 0x871A)
+DOUBLE_BYTE_PAIR(0xE3F3, 0x8730)
+DOUBLE_BYTE_PAIR(0xE3F4, 0x8711)
+DOUBLE_BYTE_PAIR(0xE3F5, 0x88F7)
+DOUBLE_BYTE_PAIR(0xE3F6, 0x88E7)
+DOUBLE_BYTE_PAIR(0xE3F7, 0x88F1)
+DOUBLE_BYTE_PAIR(0xE3F8, 0x88F2)
+DOUBLE_BYTE_PAIR(0xE3F9, 0x88FA)
+DOUBLE_BYTE_PAIR(0xE3FA, 0x88FE)
+DOUBLE_BYTE_PAIR(0xE3FB, 0x88EE)
+DOUBLE_BYTE_PAIR(0xE3FC, 0x88FC)
+DOUBLE_BYTE_PAIR(0xE3FD, 0x88F6)
+DOUBLE_BYTE_PAIR(0xE3FE, 0x88FB)
+DOUBLE_BYTE_PAIR(0xE440, 0x88F0)
+DOUBLE_BYTE_PAIR(0xE441, 0x88EC)
+DOUBLE_BYTE_PAIR(0xE442, 0x88EB)
+DOUBLE_BYTE_PAIR(0xE443, 0x899D)
+DOUBLE_BYTE_PAIR(0xE444, 0x89A1)
+DOUBLE_BYTE_PAIR(0xE445, 0x899F)
+DOUBLE_BYTE_PAIR(0xE446, 0x899E)
+DOUBLE_BYTE_PAIR(0xE447, 0x89E9)
+DOUBLE_BYTE_PAIR(0xE448, 0x89EB)
+DOUBLE_BYTE_PAIR(0xE449, 0x89E8)
+DOUBLE_BYTE_PAIR(0xE44A, 0x8AAB)
+DOUBLE_BYTE_PAIR(0xE44B, 0x8A99)
+DOUBLE_BYTE_PAIR(0xE44C, 0x8A8B)
+DOUBLE_BYTE_PAIR(0xE44D, 0x8A92)
+DOUBLE_BYTE_PAIR(0xE44E, 0x8A8F)
+DOUBLE_BYTE_PAIR(0xE44F, 0x8A96)
+DOUBLE_BYTE_PAIR(0xE450, 0x8C3D)
+DOUBLE_BYTE_PAIR(0xE451, 0x8C68)
+DOUBLE_BYTE_PAIR(0xE452, 0x8C69)
+DOUBLE_BYTE_PAIR(0xE453, 0x8CD5)
+DOUBLE_BYTE_PAIR(0xE454, 0x8CCF)
+DOUBLE_BYTE_PAIR(0xE455, 0x8CD7)
+DOUBLE_BYTE_PAIR(0xE456, 0x8D96)
+DOUBLE_BYTE_PAIR(0xE457, 0x8E09)
+DOUBLE_BYTE_PAIR(0xE458, 0x8E02)
+DOUBLE_BYTE_PAIR(0xE459, 0x8DFF)
+DOUBLE_BYTE_PAIR(0xE45A, 0x8E0D)
+DOUBLE_BYTE_PAIR(0xE45B, 0x8DFD)
+DOUBLE_BYTE_PAIR(0xE45C, 0x8E0A)
+DOUBLE_BYTE_PAIR(0xE45D, 0x8E03)
+DOUBLE_BYTE_PAIR(0xE45E, 0x8E07)
+DOUBLE_BYTE_PAIR(0xE45F, 0x8E06)
+DOUBLE_BYTE_PAIR(0xE460, 0x8E05)
+DOUBLE_BYTE_PAIR(0xE461, 0x8DFE)
+DOUBLE_BYTE_PAIR(0xE462, 0x8E00)
+DOUBLE_BYTE_PAIR(0xE463, 0x8E04)
+DOUBLE_BYTE_PAIR(0xE464, 0x8F10)
+DOUBLE_BYTE_PAIR(0xE465, 0x8F11)
+DOUBLE_BYTE_PAIR(0xE466, 0x8F0E)
+DOUBLE_BYTE_PAIR(0xE467, 0x8F0D)
+DOUBLE_BYTE_PAIR(0xE468, 0x9123)
+DOUBLE_BYTE_PAIR(0xE469, 0x911C)
+DOUBLE_BYTE_PAIR(0xE46A, 0x9120)
+DOUBLE_BYTE_PAIR(0xE46B, 0x9122)
+DOUBLE_BYTE_PAIR(0xE46C, 0x911F)
+DOUBLE_BYTE_PAIR(0xE46D, 0x911D)
+DOUBLE_BYTE_PAIR(0xE46E, 0x911A)
+DOUBLE_BYTE_PAIR(0xE46F, 0x9124)
+DOUBLE_BYTE_PAIR(0xE470, 0x9121)
+DOUBLE_BYTE_PAIR(0xE471, 0x911B)
+DOUBLE_BYTE_PAIR(0xE472, 0x917A)
+DOUBLE_BYTE_PAIR(0xE473, 0x9172)
+DOUBLE_BYTE_PAIR(0xE474, 0x9179)
+DOUBLE_BYTE_PAIR(0xE475, 0x9173)
+DOUBLE_BYTE_PAIR(0xE476, 0x92A5)
+DOUBLE_BYTE_PAIR(0xE477, 0x92A4)
+DOUBLE_BYTE_PAIR(0xE478, 0x9276)
+DOUBLE_BYTE_PAIR(0xE479, 0x929B)
+DOUBLE_BYTE_PAIR(0xE47A, 0x927A)
+DOUBLE_BYTE_PAIR(0xE47B, 0x92A0)
+DOUBLE_BYTE_PAIR(0xE47C, 0x9294)
+DOUBLE_BYTE_PAIR(0xE47D, 0x92AA)
+DOUBLE_BYTE_PAIR(0xE47E, 0x928D)
+DOUBLE_BYTE_PAIR(0xE4A1, 0x92A6)
+DOUBLE_BYTE_PAIR(0xE4A2, 0x929A)
+DOUBLE_BYTE_PAIR(0xE4A3, 0x92AB)
+DOUBLE_BYTE_PAIR(0xE4A4, 0x9279)
+DOUBLE_BYTE_PAIR(0xE4A5, 0x9297)
+DOUBLE_BYTE_PAIR(0xE4A6, 0x927F)
+DOUBLE_BYTE_PAIR(0xE4A7, 0x92A3)
+DOUBLE_BYTE_PAIR(0xE4A8, 0x92EE)
+DOUBLE_BYTE_PAIR(0xE4A9, 0x928E)
+DOUBLE_BYTE_PAIR(0xE4AA, 0x9282)
+DOUBLE_BYTE_PAIR(0xE4AB, 0x9295)
+DOUBLE_BYTE_PAIR(0xE4AC, 0x92A2)
+DOUBLE_BYTE_PAIR(0xE4AD, 0x927D)
+DOUBLE_BYTE_PAIR(0xE4AE, 0x9288)
+DOUBLE_BYTE_PAIR(0xE4AF, 0x92A1)
+DOUBLE_BYTE_PAIR(0xE4B0, 0x928A)
+DOUBLE_BYTE_PAIR(0xE4B1, 0x9286)
+DOUBLE_BYTE_PAIR(0xE4B2, 0x928C)
+DOUBLE_BYTE_PAIR(0xE4B3, 0x9299)
+DOUBLE_BYTE_PAIR(0xE4B4, 0x92A7)
+DOUBLE_BYTE_PAIR(0xE4B5, 0x927E)
+DOUBLE_BYTE_PAIR(0xE4B6, 0x9287)
+DOUBLE_BYTE_PAIR(0xE4B7, 0x92A9)
+DOUBLE_BYTE_PAIR(0xE4B8, 0x929D)
+DOUBLE_BYTE_PAIR(0xE4B9, 0x928B)
+DOUBLE_BYTE_PAIR(0xE4BA, 0x922D)
+DOUBLE_BYTE_PAIR(0xE4BB, 0x969E)
+DOUBLE_BYTE_PAIR(0xE4BC, 0x96A1)
+DOUBLE_BYTE_PAIR(0xE4BD, 0x96FF)
+DOUBLE_BYTE_PAIR(0xE4BE, 0x9758)
+DOUBLE_BYTE_PAIR(0xE4BF, 0x977D)
+DOUBLE_BYTE_PAIR(0xE4C0, 0x977A)
+DOUBLE_BYTE_PAIR(0xE4C1, 0x977E)
+DOUBLE_BYTE_PAIR(0xE4C2, 0x9783)
+DOUBLE_BYTE_PAIR(0xE4C3, 0x9780)
+DOUBLE_BYTE_PAIR(0xE4C4, 0x9782)
+DOUBLE_BYTE_PAIR(0xE4C5, 0x977B)
+DOUBLE_BYTE_PAIR(0xE4C6, 0x9784)
+DOUBLE_BYTE_PAIR(0xE4C7, 0x9781)
+DOUBLE_BYTE_PAIR(0xE4C8, 0x977F)
+DOUBLE_BYTE_PAIR(0xE4C9, 0x97CE)
+DOUBLE_BYTE_PAIR(0xE4CA, 0x97CD)
+DOUBLE_BYTE_PAIR(0xE4CB, 0x9816)
+DOUBLE_BYTE_PAIR(0xE4CC, 0x98AD)
+DOUBLE_BYTE_PAIR(0xE4CD, 0x98AE)
+DOUBLE_BYTE_PAIR(0xE4CE, 0x9902)
+DOUBLE_BYTE_PAIR(0xE4CF, 0x9900)
+DOUBLE_BYTE_PAIR(0xE4D0, 0x9907)
+DOUBLE_BYTE_PAIR(0xE4D1, 0x999D)
+DOUBLE_BYTE_PAIR(0xE4D2, 0x999C)
+DOUBLE_BYTE_PAIR(0xE4D3, 0x99C3)
+DOUBLE_BYTE_PAIR(0xE4D4, 0x99B9)
+DOUBLE_BYTE_PAIR(0xE4D5, 0x99BB)
+DOUBLE_BYTE_PAIR(0xE4D6, 0x99BA)
+DOUBLE_BYTE_PAIR(0xE4D7, 0x99C2)
+DOUBLE_BYTE_PAIR(0xE4D8, 0x99BD)
+DOUBLE_BYTE_PAIR(0xE4D9, 0x99C7)
+DOUBLE_BYTE_PAIR(0xE4DA, 0x9AB1)
+DOUBLE_BYTE_PAIR(0xE4DB, 0x9AE3)
+DOUBLE_BYTE_PAIR(0xE4DC, 0x9AE7)
+DOUBLE_BYTE_PAIR(0xE4DD, 0x9B3E)
+DOUBLE_BYTE_PAIR(0xE4DE, 0x9B3F)
+DOUBLE_BYTE_PAIR(0xE4DF, 0x9B60)
+DOUBLE_BYTE_PAIR(0xE4E0, 0x9B61)
+DOUBLE_BYTE_PAIR(0xE4E1, 0x9B5F)
+DOUBLE_BYTE_PAIR(0xE4E2, 0x9CF1)
+DOUBLE_BYTE_PAIR(0xE4E3, 0x9CF2)
+DOUBLE_BYTE_PAIR(0xE4E4, 0x9CF5)
+DOUBLE_BYTE_PAIR(0xE4E5, 0x9EA7)
+DOUBLE_BYTE_PAIR(0xE4E6, 0x50FF)
+DOUBLE_BYTE_PAIR(0xE4E7, 0x5103)
+DOUBLE_BYTE_PAIR(0xE4E8, 0x5130)
+DOUBLE_BYTE_PAIR(0xE4E9, 0x50F8)
+DOUBLE_BYTE_PAIR(0xE4EA, 0x5106)
+DOUBLE_BYTE_PAIR(0xE4EB, 0x5107)
+DOUBLE_BYTE_PAIR(0xE4EC, 0x50F6)
+DOUBLE_BYTE_PAIR(0xE4ED, 0x50FE)
+DOUBLE_BYTE_PAIR(0xE4EE, 0x510B)
+DOUBLE_BYTE_PAIR(0xE4EF, 0x510C)
+DOUBLE_BYTE_PAIR(0xE4F0, 0x50FD)
+DOUBLE_BYTE_PAIR(0xE4F1, 0x510A)
+DOUBLE_BYTE_PAIR(0xE4F2, 0x528B)
+DOUBLE_BYTE_PAIR(0xE4F3, 0x528C)
+DOUBLE_BYTE_PAIR(0xE4F4, 0x52F1)
+DOUBLE_BYTE_PAIR(0xE4F5, 0x52EF)
+DOUBLE_BYTE_PAIR(0xE4F6, 0x5648)
+DOUBLE_BYTE_PAIR(0xE4F7, 0x5642)
+DOUBLE_BYTE_PAIR(0xE4F8, 0x564C)
+DOUBLE_BYTE_PAIR(0xE4F9, 0x5635)
+DOUBLE_BYTE_PAIR(0xE4FA, 0x5641)
+DOUBLE_BYTE_PAIR(0xE4FB, 0x564A)
+DOUBLE_BYTE_PAIR(0xE4FC, 0x5649)
+DOUBLE_BYTE_PAIR(0xE4FD, 0x5646)
+DOUBLE_BYTE_PAIR(0xE4FE, 0x5658)
+DOUBLE_BYTE_PAIR(0xE540, 0x565A)
+DOUBLE_BYTE_PAIR(0xE541, 0x5640)
+DOUBLE_BYTE_PAIR(0xE542, 0x5633)
+DOUBLE_BYTE_PAIR(0xE543, 0x563D)
+DOUBLE_BYTE_PAIR(0xE544, 0x562C)
+DOUBLE_BYTE_PAIR(0xE545, 0x563E)
+DOUBLE_BYTE_PAIR(0xE546, 0x5638)
+DOUBLE_BYTE_PAIR(0xE547, 0x562A)
+DOUBLE_BYTE_PAIR(0xE548, 0x563A)
+DOUBLE_BYTE_PAIR(0xE549, 0x571A)
+DOUBLE_BYTE_PAIR(0xE54A, 0x58AB)
+DOUBLE_BYTE_PAIR(0xE54B, 0x589D)
+DOUBLE_BYTE_PAIR(0xE54C, 0x58B1)
+DOUBLE_BYTE_PAIR(0xE54D, 0x58A0)
+DOUBLE_BYTE_PAIR(0xE54E, 0x58A3)
+DOUBLE_BYTE_PAIR(0xE54F, 0x58AF)
+DOUBLE_BYTE_PAIR(0xE550, 0x58AC)
+DOUBLE_BYTE_PAIR(0xE551, 0x58A5)
+DOUBLE_BYTE_PAIR(0xE552, 0x58A1)
+DOUBLE_BYTE_PAIR(0xE553, 0x58FF)
+DOUBLE_BYTE_PAIR(0xE554, 0x5AFF)
+DOUBLE_BYTE_PAIR(0xE555, 0x5AF4)
+DOUBLE_BYTE_PAIR(0xE556, 0x5AFD)
+DOUBLE_BYTE_PAIR(0xE557, 0x5AF7)
+DOUBLE_BYTE_PAIR(0xE558, 0x5AF6)
+DOUBLE_BYTE_PAIR(0xE559, 0x5B03)
+DOUBLE_BYTE_PAIR(0xE55A, 0x5AF8)
+DOUBLE_BYTE_PAIR(0xE55B, 0x5B02)
+DOUBLE_BYTE_PAIR(0xE55C, 0x5AF9)
+DOUBLE_BYTE_PAIR(0xE55D, 0x5B01)
+DOUBLE_BYTE_PAIR(0xE55E, 0x5B07)
+DOUBLE_BYTE_PAIR(0xE55F, 0x5B05)
+DOUBLE_BYTE_PAIR(0xE560, 0x5B0F)
+DOUBLE_BYTE_PAIR(0xE561, 0x5C67)
+DOUBLE_BYTE_PAIR(0xE562, 0x5D99)
+DOUBLE_BYTE_PAIR(0xE563, 0x5D97)
+DOUBLE_BYTE_PAIR(0xE564, 0x5D9F)
+DOUBLE_BYTE_PAIR(0xE565, 0x5D92)
+DOUBLE_BYTE_PAIR(0xE566, 0x5DA2)
+DOUBLE_BYTE_PAIR(0xE567, 0x5D93)
+DOUBLE_BYTE_PAIR(0xE568, 0x5D95)
+DOUBLE_BYTE_PAIR(0xE569, 0x5DA0)
+DOUBLE_BYTE_PAIR(0xE56A, 0x5D9C)
+DOUBLE_BYTE_PAIR(0xE56B, 0x5DA1)
+DOUBLE_BYTE_PAIR(0xE56C, 0x5D9A)
+DOUBLE_BYTE_PAIR(0xE56D, 0x5D9E)
+DOUBLE_BYTE_PAIR(0xE56E, 0x5E69)
+DOUBLE_BYTE_PAIR(0xE56F, 0x5E5D)
+DOUBLE_BYTE_PAIR(0xE570, 0x5E60)
+DOUBLE_BYTE_PAIR(0xE571, 0x5E5C)
+DOUBLE_BYTE_PAIR(0xE572, 0x7DF3)
+DOUBLE_BYTE_PAIR(0xE573, 0x5EDB)
+DOUBLE_BYTE_PAIR(0xE574, 0x5EDE)
+DOUBLE_BYTE_PAIR(0xE575, 0x5EE1)
+DOUBLE_BYTE_PAIR(0xE576, 0x5F49)
+DOUBLE_BYTE_PAIR(0xE577, 0x5FB2)
+DOUBLE_BYTE_PAIR(0xE578, 0x618B)
+DOUBLE_BYTE_PAIR(0xE579, 0x6183)
+DOUBLE_BYTE_PAIR(0xE57A, 0x6179)
+DOUBLE_BYTE_PAIR(0xE57B, 0x61B1)
+DOUBLE_BYTE_PAIR(0xE57C, 0x61B0)
+DOUBLE_BYTE_PAIR(0xE57D, 0x61A2)
+DOUBLE_BYTE_PAIR(0xE57E, 0x6189)
+DOUBLE_BYTE_PAIR(0xE5A1, 0x619B)
+DOUBLE_BYTE_PAIR(0xE5A2, 0x6193)
+DOUBLE_BYTE_PAIR(0xE5A3, 0x61AF)
+DOUBLE_BYTE_PAIR(0xE5A4, 0x61AD)
+DOUBLE_BYTE_PAIR(0xE5A5, 0x619F)
+DOUBLE_BYTE_PAIR(0xE5A6, 0x6192)
+DOUBLE_BYTE_PAIR(0xE5A7, 0x61AA)
+DOUBLE_BYTE_PAIR(0xE5A8, 0x61A1)
+DOUBLE_BYTE_PAIR(0xE5A9, 0x618D)
+DOUBLE_BYTE_PAIR(0xE5AA, 0x6166)
+DOUBLE_BYTE_PAIR(0xE5AB, 0x61B3)
+DOUBLE_BYTE_PAIR(0xE5AC, 0x622D)
+DOUBLE_BYTE_PAIR(0xE5AD, 0x646E)
+DOUBLE_BYTE_PAIR(0xE5AE, 0x6470)
+DOUBLE_BYTE_PAIR(0xE5AF, 0x6496)
+DOUBLE_BYTE_PAIR(0xE5B0, 0x64A0)
+DOUBLE_BYTE_PAIR(0xE5B1, 0x6485)
+DOUBLE_BYTE_PAIR(0xE5B2, 0x6497)
+DOUBLE_BYTE_PAIR(0xE5B3, 0x649C)
+DOUBLE_BYTE_PAIR(0xE5B4, 0x648F)
+DOUBLE_BYTE_PAIR(0xE5B5, 0x648B)
+DOUBLE_BYTE_PAIR(0xE5B6, 0x648A)
+DOUBLE_BYTE_PAIR(0xE5B7, 0x648C)
+DOUBLE_BYTE_PAIR(0xE5B8, 0x64A3)
+DOUBLE_BYTE_PAIR(0xE5B9, 0x649F)
+DOUBLE_BYTE_PAIR(0xE5BA, 0x6468)
+DOUBLE_BYTE_PAIR(0xE5BB, 0x64B1)
+DOUBLE_BYTE_PAIR(0xE5BC, 0x6498)
+DOUBLE_BYTE_PAIR(0xE5BD, 0x6576)
+DOUBLE_BYTE_PAIR(0xE5BE, 0x657A)
+DOUBLE_BYTE_PAIR(0xE5BF, 0x6579)
+DOUBLE_BYTE_PAIR(0xE5C0, 0x657B)
+DOUBLE_BYTE_PAIR(0xE5C1, 0x65B2)
+DOUBLE_BYTE_PAIR(0xE5C2, 0x65B3)
+DOUBLE_BYTE_PAIR(0xE5C3, 0x66B5)
+DOUBLE_BYTE_PAIR(0xE5C4, 0x66B0)
+DOUBLE_BYTE_PAIR(0xE5C5, 0x66A9)
+DOUBLE_BYTE_PAIR(0xE5C6, 0x66B2)
+DOUBLE_BYTE_PAIR(0xE5C7, 0x66B7)
+DOUBLE_BYTE_PAIR(0xE5C8, 0x66AA)
+DOUBLE_BYTE_PAIR(0xE5C9, 0x66AF)
+DOUBLE_BYTE_PAIR(0xE5CA, 0x6A00)
+DOUBLE_BYTE_PAIR(0xE5CB, 0x6A06)
+DOUBLE_BYTE_PAIR(0xE5CC, 0x6A17)
+DOUBLE_BYTE_PAIR(0xE5CD, 0x69E5)
+DOUBLE_BYTE_PAIR(0xE5CE, 0x69F8)
+DOUBLE_BYTE_PAIR(0xE5CF, 0x6A15)
+DOUBLE_BYTE_PAIR(0xE5D0, 0x69F1)
+DOUBLE_BYTE_PAIR(0xE5D1, 0x69E4)
+DOUBLE_BYTE_PAIR(0xE5D2, 0x6A20)
+DOUBLE_BYTE_PAIR(0xE5D3, 0x69FF)
+DOUBLE_BYTE_PAIR(0xE5D4, 0x69EC)
+DOUBLE_BYTE_PAIR(0xE5D5, 0x69E2)
+DOUBLE_BYTE_PAIR(0xE5D6, 0x6A1B)
+DOUBLE_BYTE_PAIR(0xE5D7, 0x6A1D)
+DOUBLE_BYTE_PAIR(0xE5D8, 0x69FE)
+DOUBLE_BYTE_PAIR(0xE5D9, 0x6A27)
+DOUBLE_BYTE_PAIR(0xE5DA, 0x69F2)
+DOUBLE_BYTE_PAIR(0xE5DB, 0x69EE)
+DOUBLE_BYTE_PAIR(0xE5DC, 0x6A14)
+DOUBLE_BYTE_PAIR(0xE5DD, 0x69F7)
+DOUBLE_BYTE_PAIR(0xE5DE, 0x69E7)
+DOUBLE_BYTE_PAIR(0xE5DF, 0x6A40)
+DOUBLE_BYTE_PAIR(0xE5E0, 0x6A08)
+DOUBLE_BYTE_PAIR(0xE5E1, 0x69E6)
+DOUBLE_BYTE_PAIR(0xE5E2, 0x69FB)
+DOUBLE_BYTE_PAIR(0xE5E3, 0x6A0D)
+DOUBLE_BYTE_PAIR(0xE5E4, 0x69FC)
+DOUBLE_BYTE_PAIR(0xE5E5, 0x69EB)
+DOUBLE_BYTE_PAIR(0xE5E6, 0x6A09)
+DOUBLE_BYTE_PAIR(0xE5E7, 0x6A04)
+DOUBLE_BYTE_PAIR(0xE5E8, 0x6A18)
+DOUBLE_BYTE_PAIR(0xE5E9, 0x6A25)
+DOUBLE_BYTE_PAIR(0xE5EA, 0x6A0F)
+DOUBLE_BYTE_PAIR(0xE5EB, 0x69F6)
+DOUBLE_BYTE_PAIR(0xE5EC, 0x6A26)
+DOUBLE_BYTE_PAIR(0xE5ED, 0x6A07)
+DOUBLE_BYTE_PAIR(0xE5EE, 0x69F4)
+DOUBLE_BYTE_PAIR(0xE5EF, 0x6A16)
+DOUBLE_BYTE_PAIR(0xE5F0, 0x6B51)
+DOUBLE_BYTE_PAIR(0xE5F1, 0x6BA5)
+DOUBLE_BYTE_PAIR(0xE5F2, 0x6BA3)
+DOUBLE_BYTE_PAIR(0xE5F3, 0x6BA2)
+DOUBLE_BYTE_PAIR(0xE5F4, 0x6BA6)
+DOUBLE_BYTE_PAIR(0xE5F5, 0x6C01)
+DOUBLE_BYTE_PAIR(0xE5F6, 0x6C00)
+DOUBLE_BYTE_PAIR(0xE5F7, 0x6BFF)
+DOUBLE_BYTE_PAIR(0xE5F8, 0x6C02)
+DOUBLE_BYTE_PAIR(0xE5F9, 0x6F41)
+DOUBLE_BYTE_PAIR(0xE5FA, 0x6F26)
+DOUBLE_BYTE_PAIR(0xE5FB, 0x6F7E)
+DOUBLE_BYTE_PAIR(0xE5FC, 0x6F87)
+DOUBLE_BYTE_PAIR(0xE5FD, 0x6FC6)
+DOUBLE_BYTE_PAIR(0xE5FE, 0x6F92)
+DOUBLE_BYTE_PAIR(0xE640, 0x6F8D)
+DOUBLE_BYTE_PAIR(0xE641, 0x6F89)
+DOUBLE_BYTE_PAIR(0xE642, 0x6F8C)
+DOUBLE_BYTE_PAIR(0xE643, 0x6F62)
+DOUBLE_BYTE_PAIR(0xE644, 0x6F4F)
+DOUBLE_BYTE_PAIR(0xE645, 0x6F85)
+DOUBLE_BYTE_PAIR(0xE646, 0x6F5A)
+DOUBLE_BYTE_PAIR(0xE647, 0x6F96)
+DOUBLE_BYTE_PAIR(0xE648, 0x6F76)
+DOUBLE_BYTE_PAIR(0xE649, 0x6F6C)
+DOUBLE_BYTE_PAIR(0xE64A, 0x6F82)
+DOUBLE_BYTE_PAIR(0xE64B, 0x6F55)
+DOUBLE_BYTE_PAIR(0xE64C, 0x6F72)
+DOUBLE_BYTE_PAIR(0xE64D, 0x6F52)
+DOUBLE_BYTE_PAIR(0xE64E, 0x6F50)
+DOUBLE_BYTE_PAIR(0xE64F, 0x6F57)
+DOUBLE_BYTE_PAIR(0xE650, 0x6F94)
+DOUBLE_BYTE_PAIR(0xE651, 0x6F93)
+DOUBLE_BYTE_PAIR(0xE652, 0x6F5D)
+DOUBLE_BYTE_PAIR(0xE653, 0x6F00)
+DOUBLE_BYTE_PAIR(0xE654, 0x6F61)
+DOUBLE_BYTE_PAIR(0xE655, 0x6F6B)
+DOUBLE_BYTE_PAIR(0xE656, 0x6F7D)
+DOUBLE_BYTE_PAIR(0xE657, 0x6F67)
+DOUBLE_BYTE_PAIR(0xE658, 0x6F90)
+DOUBLE_BYTE_PAIR(0xE659, 0x6F53)
+DOUBLE_BYTE_PAIR(0xE65A, 0x6F8B)
+DOUBLE_BYTE_PAIR(0xE65B, 0x6F69)
+DOUBLE_BYTE_PAIR(0xE65C, 0x6F7F)
+DOUBLE_BYTE_PAIR(0xE65D, 0x6F95)
+DOUBLE_BYTE_PAIR(0xE65E, 0x6F63)
+DOUBLE_BYTE_PAIR(0xE65F, 0x6F77)
+DOUBLE_BYTE_PAIR(0xE660, 0x6F6A)
+DOUBLE_BYTE_PAIR(0xE661, 0x6F7B)
+DOUBLE_BYTE_PAIR(0xE662, 0x71B2)
+DOUBLE_BYTE_PAIR(0xE663, 0x71AF)
+DOUBLE_BYTE_PAIR(0xE664, 0x719B)
+DOUBLE_BYTE_PAIR(0xE665, 0x71B0)
+DOUBLE_BYTE_PAIR(0xE666, 0x71A0)
+DOUBLE_BYTE_PAIR(0xE667, 0x719A)
+DOUBLE_BYTE_PAIR(0xE668, 0x71A9)
+DOUBLE_BYTE_PAIR(0xE669, 0x71B5)
+DOUBLE_BYTE_PAIR(0xE66A, 0x719D)
+DOUBLE_BYTE_PAIR(0xE66B, 0x71A5)
+DOUBLE_BYTE_PAIR(0xE66C, 0x719E)
+DOUBLE_BYTE_PAIR(0xE66D, 0x71A4)
+DOUBLE_BYTE_PAIR(0xE66E, 0x71A1)
+DOUBLE_BYTE_PAIR(0xE66F, 0x71AA)
+DOUBLE_BYTE_PAIR(0xE670, 0x719C)
+DOUBLE_BYTE_PAIR(0xE671, 0x71A7)
+DOUBLE_BYTE_PAIR(0xE672, 0x71B3)
+DOUBLE_BYTE_PAIR(0xE673, 0x7298)
+DOUBLE_BYTE_PAIR(0xE674, 0x729A)
+DOUBLE_BYTE_PAIR(0xE675, 0x7358)
+DOUBLE_BYTE_PAIR(0xE676, 0x7352)
+DOUBLE_BYTE_PAIR(0xE677, 0x735E)
+DOUBLE_BYTE_PAIR(0xE678, 0x735F)
+DOUBLE_BYTE_PAIR(0xE679, 0x7360)
+DOUBLE_BYTE_PAIR(0xE67A, 0x735D)
+DOUBLE_BYTE_PAIR(0xE67B, 0x735B)
+DOUBLE_BYTE_PAIR(0xE67C, 0x7361)
+DOUBLE_BYTE_PAIR(0xE67D, 0x735A)
+DOUBLE_BYTE_PAIR(0xE67E, 0x7359)
+DOUBLE_BYTE_PAIR(0xE6A1, 0x7362)
+DOUBLE_BYTE_PAIR(0xE6A2, 0x7487)
+DOUBLE_BYTE_PAIR(0xE6A3, 0x7489)
+DOUBLE_BYTE_PAIR(0xE6A4, 0x748A)
+DOUBLE_BYTE_PAIR(0xE6A5, 0x7486)
+DOUBLE_BYTE_PAIR(0xE6A6, 0x7481)
+DOUBLE_BYTE_PAIR(0xE6A7, 0x747D)
+DOUBLE_BYTE_PAIR(0xE6A8, 0x7485)
+DOUBLE_BYTE_PAIR(0xE6A9, 0x7488)
+DOUBLE_BYTE_PAIR(0xE6AA, 0x747C)
+DOUBLE_BYTE_PAIR(0xE6AB, 0x7479)
+DOUBLE_BYTE_PAIR(0xE6AC, 0x7508)
+DOUBLE_BYTE_PAIR(0xE6AD, 0x7507)
+DOUBLE_BYTE_PAIR(0xE6AE, 0x757E)
+DOUBLE_BYTE_PAIR(0xE6AF, 0x7625)
+DOUBLE_BYTE_PAIR(0xE6B0, 0x761E)
+DOUBLE_BYTE_PAIR(0xE6B1, 0x7619)
+DOUBLE_BYTE_PAIR(0xE6B2, 0x761D)
+DOUBLE_BYTE_PAIR(0xE6B3, 0x761C)
+DOUBLE_BYTE_PAIR(0xE6B4, 0x7623)
+DOUBLE_BYTE_PAIR(0xE6B5, 0x761A)
+DOUBLE_BYTE_PAIR(0xE6B6, 0x7628)
+DOUBLE_BYTE_PAIR(0xE6B7, 0x761B)
+DOUBLE_BYTE_PAIR(0xE6B8, 0x769C)
+DOUBLE_BYTE_PAIR(0xE6B9, 0x769D)
+DOUBLE_BYTE_PAIR(0xE6BA, 0x769E)
+DOUBLE_BYTE_PAIR(0xE6BB, 0x769B)
+DOUBLE_BYTE_PAIR(0xE6BC, 0x778D)
+DOUBLE_BYTE_PAIR(0xE6BD, 0x778F)
+DOUBLE_BYTE_PAIR(0xE6BE, 0x7789)
+DOUBLE_BYTE_PAIR(0xE6BF, 0x7788)
+DOUBLE_BYTE_PAIR(0xE6C0, 0x78CD)
+DOUBLE_BYTE_PAIR(0xE6C1, 0x78BB)
+DOUBLE_BYTE_PAIR(0xE6C2, 0x78CF)
+DOUBLE_BYTE_PAIR(0xE6C3, 0x78CC)
+DOUBLE_BYTE_PAIR(0xE6C4, 0x78D1)
+DOUBLE_BYTE_PAIR(0xE6C5, 0x78CE)
+DOUBLE_BYTE_PAIR(0xE6C6, 0x78D4)
+DOUBLE_BYTE_PAIR(0xE6C7, 0x78C8)
+DOUBLE_BYTE_PAIR(0xE6C8, 0x78C3)
+DOUBLE_BYTE_PAIR(0xE6C9, 0x78C4)
+DOUBLE_BYTE_PAIR(0xE6CA, 0x78C9)
+DOUBLE_BYTE_PAIR(0xE6CB, 0x799A)
+DOUBLE_BYTE_PAIR(0xE6CC, 0x79A1)
+DOUBLE_BYTE_PAIR(0xE6CD, 0x79A0)
+DOUBLE_BYTE_PAIR(0xE6CE, 0x799C)
+DOUBLE_BYTE_PAIR(0xE6CF, 0x79A2)
+DOUBLE_BYTE_PAIR(0xE6D0, 0x799B)
+DOUBLE_BYTE_PAIR(0xE6D1, 0x6B76)
+DOUBLE_BYTE_PAIR(0xE6D2, 0x7A39)
+DOUBLE_BYTE_PAIR(0xE6D3, 0x7AB2)
+DOUBLE_BYTE_PAIR(0xE6D4, 0x7AB4)
+DOUBLE_BYTE_PAIR(0xE6D5, 0x7AB3)
+DOUBLE_BYTE_PAIR(0xE6D6, 0x7BB7)
+DOUBLE_BYTE_PAIR(0xE6D7, 0x7BCB)
+DOUBLE_BYTE_PAIR(0xE6D8, 0x7BBE)
+DOUBLE_BYTE_PAIR(0xE6D9, 0x7BAC)
+DOUBLE_BYTE_PAIR(0xE6DA, 0x7BCE)
+DOUBLE_BYTE_PAIR(0xE6DB, 0x7BAF)
+DOUBLE_BYTE_PAIR(0xE6DC, 0x7BB9)
+DOUBLE_BYTE_PAIR(0xE6DD, 0x7BCA)
+DOUBLE_BYTE_PAIR(0xE6DE, 0x7BB5)
+DOUBLE_BYTE_PAIR(0xE6DF, 0x7CC5)
+DOUBLE_BYTE_PAIR(0xE6E0, 0x7CC8)
+DOUBLE_BYTE_PAIR(0xE6E1, 0x7CCC)
+DOUBLE_BYTE_PAIR(0xE6E2, 0x7CCB)
+DOUBLE_BYTE_PAIR(0xE6E3, 0x7DF7)
+DOUBLE_BYTE_PAIR(0xE6E4, 0x7DDB)
+DOUBLE_BYTE_PAIR(0xE6E5, 0x7DEA)
+DOUBLE_BYTE_PAIR(0xE6E6, 0x7DE7)
+DOUBLE_BYTE_PAIR(0xE6E7, 0x7DD7)
+DOUBLE_BYTE_PAIR(0xE6E8, 0x7DE1)
+DOUBLE_BYTE_PAIR(0xE6E9, 0x7E03)
+DOUBLE_BYTE_PAIR(0xE6EA, 0x7DFA)
+DOUBLE_BYTE_PAIR(0xE6EB, 0x7DE6)
+DOUBLE_BYTE_PAIR(0xE6EC, 0x7DF6)
+DOUBLE_BYTE_PAIR(0xE6ED, 0x7DF1)
+DOUBLE_BYTE_PAIR(0xE6EE, 0x7DF0)
+DOUBLE_BYTE_PAIR(0xE6EF, 0x7DEE)
+DOUBLE_BYTE_PAIR(0xE6F0, 0x7DDF)
+DOUBLE_BYTE_PAIR(0xE6F1, 0x7F76)
+DOUBLE_BYTE_PAIR(0xE6F2, 0x7FAC)
+DOUBLE_BYTE_PAIR(0xE6F3, 0x7FB0)
+DOUBLE_BYTE_PAIR(0xE6F4, 0x7FAD)
+DOUBLE_BYTE_PAIR(0xE6F5, 0x7FED)
+DOUBLE_BYTE_PAIR(0xE6F6, 0x7FEB)
+DOUBLE_BYTE_PAIR(0xE6F7, 0x7FEA)
+DOUBLE_BYTE_PAIR(0xE6F8, 0x7FEC)
+DOUBLE_BYTE_PAIR(0xE6F9, 0x7FE6)
+DOUBLE_BYTE_PAIR(0xE6FA, 0x7FE8)
+DOUBLE_BYTE_PAIR(0xE6FB, 0x8064)
+DOUBLE_BYTE_PAIR(0xE6FC, 0x8067)
+DOUBLE_BYTE_PAIR(0xE6FD, 0x81A3)
+DOUBLE_BYTE_PAIR(0xE6FE, 0x819F)
+DOUBLE_BYTE_PAIR(0xE740, 0x819E)
+DOUBLE_BYTE_PAIR(0xE741, 0x8195)
+DOUBLE_BYTE_PAIR(0xE742, 0x81A2)
+DOUBLE_BYTE_PAIR(0xE743, 0x8199)
+DOUBLE_BYTE_PAIR(0xE744, 0x8197)
+DOUBLE_BYTE_PAIR(0xE745, 0x8216)
+DOUBLE_BYTE_PAIR(0xE746, 0x824F)
+DOUBLE_BYTE_PAIR(0xE747, 0x8253)
+DOUBLE_BYTE_PAIR(0xE748, 0x8252)
+DOUBLE_BYTE_PAIR(0xE749, 0x8250)
+DOUBLE_BYTE_PAIR(0xE74A, 0x824E)
+DOUBLE_BYTE_PAIR(0xE74B, 0x8251)
+DOUBLE_BYTE_PAIR(0xE74C, 0x8524)
+DOUBLE_BYTE_PAIR(0xE74D, 0x853B)
+DOUBLE_BYTE_PAIR(0xE74E, 0x850F)
+DOUBLE_BYTE_PAIR(0xE74F, 0x8500)
+DOUBLE_BYTE_PAIR(0xE750, 0x8529)
+DOUBLE_BYTE_PAIR(0xE751, 0x850E)
+DOUBLE_BYTE_PAIR(0xE752, 0x8509)
+DOUBLE_BYTE_PAIR(0xE753, 0x850D)
+DOUBLE_BYTE_PAIR(0xE754, 0x851F)
+DOUBLE_BYTE_PAIR(0xE755, 0x850A)
+DOUBLE_BYTE_PAIR(0xE756, 0x8527)
+DOUBLE_BYTE_PAIR(0xE757, 0x851C)
+DOUBLE_BYTE_PAIR(0xE758, 0x84FB)
+DOUBLE_BYTE_PAIR(0xE759, 0x852B)
+DOUBLE_BYTE_PAIR(0xE75A, 0x84FA)
+DOUBLE_BYTE_PAIR(0xE75B, 0x8508)
+DOUBLE_BYTE_PAIR(0xE75C, 0x850C)
+DOUBLE_BYTE_PAIR(0xE75D, 0x84F4)
+DOUBLE_BYTE_PAIR(0xE75E, 0x852A)
+DOUBLE_BYTE_PAIR(0xE75F, 0x84F2)
+DOUBLE_BYTE_PAIR(0xE760, 0x8515)
+DOUBLE_BYTE_PAIR(0xE761, 0x84F7)
+DOUBLE_BYTE_PAIR(0xE762, 0x84EB)
+DOUBLE_BYTE_PAIR(0xE763, 0x84F3)
+DOUBLE_BYTE_PAIR(0xE764, 0x84FC)
+DOUBLE_BYTE_PAIR(0xE765, 0x8512)
+DOUBLE_BYTE_PAIR(0xE766, 0x84EA)
+DOUBLE_BYTE_PAIR(0xE767, 0x84E9)
+DOUBLE_BYTE_PAIR(0xE768, 0x8516)
+DOUBLE_BYTE_PAIR(0xE769, 0x84FE)
+DOUBLE_BYTE_PAIR(0xE76A, 0x8528)
+DOUBLE_BYTE_PAIR(0xE76B, 0x851D)
+DOUBLE_BYTE_PAIR(0xE76C, 0x852E)
+DOUBLE_BYTE_PAIR(0xE76D, 0x8502)
+DOUBLE_BYTE_PAIR(0xE76E, 0x84FD)
+DOUBLE_BYTE_PAIR(0xE76F, 0x851E)
+DOUBLE_BYTE_PAIR(0xE770, 0x84F6)
+DOUBLE_BYTE_PAIR(0xE771, 0x8531)
+DOUBLE_BYTE_PAIR(0xE772, 0x8526)
+DOUBLE_BYTE_PAIR(0xE773, 0x84E7)
+DOUBLE_BYTE_PAIR(0xE774, 0x84E8)
+DOUBLE_BYTE_PAIR(0xE775, 0x84F0)
+DOUBLE_BYTE_PAIR(0xE776, 0x84EF)
+DOUBLE_BYTE_PAIR(0xE777, 0x84F9)
+DOUBLE_BYTE_PAIR(0xE778, 0x8518)
+DOUBLE_BYTE_PAIR(0xE779, 0x8520)
+DOUBLE_BYTE_PAIR(0xE77A, 0x8530)
+DOUBLE_BYTE_PAIR(0xE77B, 0x850B)
+DOUBLE_BYTE_PAIR(0xE77C, 0x8519)
+DOUBLE_BYTE_PAIR(0xE77D, 0x852F)
+DOUBLE_BYTE_PAIR(0xE77E, 0x8662)
+DOUBLE_BYTE_PAIR(0xE7A1, 0x8756)
+DOUBLE_BYTE_PAIR(0xE7A2, 0x8763)
+DOUBLE_BYTE_PAIR(0xE7A3, 0x8764)
+DOUBLE_BYTE_PAIR(0xE7A4, 0x8777)
+DOUBLE_BYTE_PAIR(0xE7A5, 0x87E1)
+DOUBLE_BYTE_PAIR(0xE7A6, 0x8773)
+DOUBLE_BYTE_PAIR(0xE7A7, 0x8758)
+DOUBLE_BYTE_PAIR(0xE7A8, 0x8754)
+DOUBLE_BYTE_PAIR(0xE7A9, 0x875B)
+DOUBLE_BYTE_PAIR(0xE7AA, 0x8752)
+DOUBLE_BYTE_PAIR(0xE7AB, 0x8761)
+DOUBLE_BYTE_PAIR(0xE7AC, 0x875A)
+DOUBLE_BYTE_PAIR(0xE7AD, 0x8751)
+DOUBLE_BYTE_PAIR(0xE7AE, 0x875E)
+DOUBLE_BYTE_PAIR(0xE7AF, 0x876D)
+DOUBLE_BYTE_PAIR(0xE7B0, 0x876A)
+DOUBLE_BYTE_PAIR(0xE7B1, 0x8750)
+DOUBLE_BYTE_PAIR(0xE7B2, 0x874E)
+DOUBLE_BYTE_PAIR(0xE7B3, 0x875F)
+DOUBLE_BYTE_PAIR(0xE7B4, 0x875D)
+DOUBLE_BYTE_PAIR(0xE7B5, 0x876F)
+DOUBLE_BYTE_PAIR(0xE7B6, 0x876C)
+DOUBLE_BYTE_PAIR(0xE7B7, 0x877A)
+DOUBLE_BYTE_PAIR(0xE7B8, 0x876E)
+DOUBLE_BYTE_PAIR(0xE7B9, 0x875C)
+DOUBLE_BYTE_PAIR(0xE7BA, 0x8765)
+DOUBLE_BYTE_PAIR(0xE7BB, 0x874F)
+DOUBLE_BYTE_PAIR(0xE7BC, 0x877B)
+DOUBLE_BYTE_PAIR(0xE7BD, 0x8775)
+DOUBLE_BYTE_PAIR(0xE7BE, 0x8762)
+DOUBLE_BYTE_PAIR(0xE7BF, 0x8767)
+DOUBLE_BYTE_PAIR(0xE7C0, 0x8769)
+DOUBLE_BYTE_PAIR(0xE7C1, 0x885A)
+DOUBLE_BYTE_PAIR(0xE7C2, 0x8905)
+DOUBLE_BYTE_PAIR(0xE7C3, 0x890C)
+DOUBLE_BYTE_PAIR(0xE7C4, 0x8914)
+DOUBLE_BYTE_PAIR(0xE7C5, 0x890B)
+DOUBLE_BYTE_PAIR(0xE7C6, 0x8917)
+DOUBLE_BYTE_PAIR(0xE7C7, 0x8918)
+DOUBLE_BYTE_PAIR(0xE7C8, 0x8919)
+DOUBLE_BYTE_PAIR(0xE7C9, 0x8906)
+DOUBLE_BYTE_PAIR(0xE7CA, 0x8916)
+DOUBLE_BYTE_PAIR(0xE7CB, 0x8911)
+DOUBLE_BYTE_PAIR(0xE7CC, 0x890E)
+DOUBLE_BYTE_PAIR(0xE7CD, 0x8909)
+DOUBLE_BYTE_PAIR(0xE7CE, 0x89A2)
+DOUBLE_BYTE_PAIR(0xE7CF, 0x89A4)
+DOUBLE_BYTE_PAIR(0xE7D0, 0x89A3)
+DOUBLE_BYTE_PAIR(0xE7D1, 0x89ED)
+DOUBLE_BYTE_PAIR(0xE7D2, 0x89F0)
+DOUBLE_BYTE_PAIR(0xE7D3, 0x89EC)
+DOUBLE_BYTE_PAIR(0xE7D4, 0x8ACF)
+DOUBLE_BYTE_PAIR(0xE7D5, 0x8AC6)
+DOUBLE_BYTE_PAIR(0xE7D6, 0x8AB8)
+DOUBLE_BYTE_PAIR(0xE7D7, 0x8AD3)
+DOUBLE_BYTE_PAIR(0xE7D8, 0x8AD1)
+DOUBLE_BYTE_PAIR(0xE7D9, 0x8AD4)
+DOUBLE_BYTE_PAIR(0xE7DA, 0x8AD5)
+DOUBLE_BYTE_PAIR(0xE7DB, 0x8ABB)
+DOUBLE_BYTE_PAIR(0xE7DC, 0x8AD7)
+DOUBLE_BYTE_PAIR(0xE7DD, 0x8ABE)
+DOUBLE_BYTE_PAIR(0xE7DE, 0x8AC0)
+DOUBLE_BYTE_PAIR(0xE7DF, 0x8AC5)
+DOUBLE_BYTE_PAIR(0xE7E0, 0x8AD8)
+DOUBLE_BYTE_PAIR(0xE7E1, 0x8AC3)
+DOUBLE_BYTE_PAIR(0xE7E2, 0x8ABA)
+DOUBLE_BYTE_PAIR(0xE7E3, 0x8ABD)
+DOUBLE_BYTE_PAIR(0xE7E4, 0x8AD9)
+DOUBLE_BYTE_PAIR(0xE7E5, 0x8C3E)
+DOUBLE_BYTE_PAIR(0xE7E6, 0x8C4D)
+DOUBLE_BYTE_PAIR(0xE7E7, 0x8C8F)
+DOUBLE_BYTE_PAIR(0xE7E8, 0x8CE5)
+DOUBLE_BYTE_PAIR(0xE7E9, 0x8CDF)
+DOUBLE_BYTE_PAIR(0xE7EA, 0x8CD9)
+DOUBLE_BYTE_PAIR(0xE7EB, 0x8CE8)
+DOUBLE_BYTE_PAIR(0xE7EC, 0x8CDA)
+DOUBLE_BYTE_PAIR(0xE7ED, 0x8CDD)
+DOUBLE_BYTE_PAIR(0xE7EE, 0x8CE7)
+DOUBLE_BYTE_PAIR(0xE7EF, 0x8DA0)
+DOUBLE_BYTE_PAIR(0xE7F0, 0x8D9C)
+DOUBLE_BYTE_PAIR(0xE7F1, 0x8DA1)
+DOUBLE_BYTE_PAIR(0xE7F2, 0x8D9B)
+DOUBLE_BYTE_PAIR(0xE7F3, 0x8E20)
+DOUBLE_BYTE_PAIR(0xE7F4, 0x8E23)
+DOUBLE_BYTE_PAIR(0xE7F5, 0x8E25)
+DOUBLE_BYTE_PAIR(0xE7F6, 0x8E24)
+DOUBLE_BYTE_PAIR(0xE7F7, 0x8E2E)
+DOUBLE_BYTE_PAIR(0xE7F8, 0x8E15)
+DOUBLE_BYTE_PAIR(0xE7F9, 0x8E1B)
+DOUBLE_BYTE_PAIR(0xE7FA, 0x8E16)
+DOUBLE_BYTE_PAIR(0xE7FB, 0x8E11)
+DOUBLE_BYTE_PAIR(0xE7FC, 0x8E19)
+DOUBLE_BYTE_PAIR(0xE7FD, 0x8E26)
+DOUBLE_BYTE_PAIR(0xE7FE, 0x8E27)
+DOUBLE_BYTE_PAIR(0xE840, 0x8E14)
+DOUBLE_BYTE_PAIR(0xE841, 0x8E12)
+DOUBLE_BYTE_PAIR(0xE842, 0x8E18)
+DOUBLE_BYTE_PAIR(0xE843, 0x8E13)
+DOUBLE_BYTE_PAIR(0xE844, 0x8E1C)
+DOUBLE_BYTE_PAIR(0xE845, 0x8E17)
+DOUBLE_BYTE_PAIR(0xE846, 0x8E1A)
+DOUBLE_BYTE_PAIR(0xE847, 0x8F2C)
+DOUBLE_BYTE_PAIR(0xE848, 0x8F24)
+DOUBLE_BYTE_PAIR(0xE849, 0x8F18)
+DOUBLE_BYTE_PAIR(0xE84A, 0x8F1A)
+DOUBLE_BYTE_PAIR(0xE84B, 0x8F20)
+DOUBLE_BYTE_PAIR(0xE84C, 0x8F23)
+DOUBLE_BYTE_PAIR(0xE84D, 0x8F16)
+DOUBLE_BYTE_PAIR(0xE84E, 0x8F17)
+DOUBLE_BYTE_PAIR(0xE84F, 0x9073)
+DOUBLE_BYTE_PAIR(0xE850, 0x9070)
+DOUBLE_BYTE_PAIR(0xE851, 0x906F)
+DOUBLE_BYTE_PAIR(0xE852, 0x9067)
+DOUBLE_BYTE_PAIR(0xE853, 0x906B)
+DOUBLE_BYTE_PAIR(0xE854, 0x912F)
+DOUBLE_BYTE_PAIR(0xE855, 0x912B)
+DOUBLE_BYTE_PAIR(0xE856, 0x9129)
+DOUBLE_BYTE_PAIR(0xE857, 0x912A)
+DOUBLE_BYTE_PAIR(0xE858, 0x9132)
+DOUBLE_BYTE_PAIR(0xE859, 0x9126)
+DOUBLE_BYTE_PAIR(0xE85A, 0x912E)
+DOUBLE_BYTE_PAIR(0xE85B, 0x9185)
+DOUBLE_BYTE_PAIR(0xE85C, 0x9186)
+DOUBLE_BYTE_PAIR(0xE85D, 0x918A)
+DOUBLE_BYTE_PAIR(0xE85E, 0x9181)
+DOUBLE_BYTE_PAIR(0xE85F, 0x9182)
+DOUBLE_BYTE_PAIR(0xE860, 0x9184)
+DOUBLE_BYTE_PAIR(0xE861, 0x9180)
+DOUBLE_BYTE_PAIR(0xE862, 0x92D0)
+DOUBLE_BYTE_PAIR(0xE863, 0x92C3)
+DOUBLE_BYTE_PAIR(0xE864, 0x92C4)
+DOUBLE_BYTE_PAIR(0xE865, 0x92C0)
+DOUBLE_BYTE_PAIR(0xE866, 0x92D9)
+DOUBLE_BYTE_PAIR(0xE867, 0x92B6)
+DOUBLE_BYTE_PAIR(0xE868, 0x92CF)
+DOUBLE_BYTE_PAIR(0xE869, 0x92F1)
+DOUBLE_BYTE_PAIR(0xE86A, 0x92DF)
+DOUBLE_BYTE_PAIR(0xE86B, 0x92D8)
+DOUBLE_BYTE_PAIR(0xE86C, 0x92E9)
+DOUBLE_BYTE_PAIR(0xE86D, 0x92D7)
+DOUBLE_BYTE_PAIR(0xE86E, 0x92DD)
+DOUBLE_BYTE_PAIR(0xE86F, 0x92CC)
+DOUBLE_BYTE_PAIR(0xE870, 0x92EF)
+DOUBLE_BYTE_PAIR(0xE871, 0x92C2)
+DOUBLE_BYTE_PAIR(0xE872, 0x92E8)
+DOUBLE_BYTE_PAIR(0xE873, 0x92CA)
+DOUBLE_BYTE_PAIR(0xE874, 0x92C8)
+DOUBLE_BYTE_PAIR(0xE875, 0x92CE)
+DOUBLE_BYTE_PAIR(0xE876, 0x92E6)
+DOUBLE_BYTE_PAIR(0xE877, 0x92CD)
+DOUBLE_BYTE_PAIR(0xE878, 0x92D5)
+DOUBLE_BYTE_PAIR(0xE879, 0x92C9)
+DOUBLE_BYTE_PAIR(0xE87A, 0x92E0)
+DOUBLE_BYTE_PAIR(0xE87B, 0x92DE)
+DOUBLE_BYTE_PAIR(0xE87C, 0x92E7)
+DOUBLE_BYTE_PAIR(0xE87D, 0x92D1)
+DOUBLE_BYTE_PAIR(0xE87E, 0x92D3)
+DOUBLE_BYTE_PAIR(0xE8A1, 0x92B5)
+DOUBLE_BYTE_PAIR(0xE8A2, 0x92E1)
+DOUBLE_BYTE_PAIR(0xE8A3, 0x92C6)
+DOUBLE_BYTE_PAIR(0xE8A4, 0x92B4)
+DOUBLE_BYTE_PAIR(0xE8A5, 0x957C)
+DOUBLE_BYTE_PAIR(0xE8A6, 0x95AC)
+DOUBLE_BYTE_PAIR(0xE8A7, 0x95AB)
+DOUBLE_BYTE_PAIR(0xE8A8, 0x95AE)
+DOUBLE_BYTE_PAIR(0xE8A9, 0x95B0)
+DOUBLE_BYTE_PAIR(0xE8AA, 0x96A4)
+DOUBLE_BYTE_PAIR(0xE8AB, 0x96A2)
+DOUBLE_BYTE_PAIR(0xE8AC, 0x96D3)
+DOUBLE_BYTE_PAIR(0xE8AD, 0x9705)
+DOUBLE_BYTE_PAIR(0xE8AE, 0x9708)
+DOUBLE_BYTE_PAIR(0xE8AF, 0x9702)
+DOUBLE_BYTE_PAIR(0xE8B0, 0x975A)
+DOUBLE_BYTE_PAIR(0xE8B1, 0x978A)
+DOUBLE_BYTE_PAIR(0xE8B2, 0x978E)
+DOUBLE_BYTE_PAIR(0xE8B3, 0x9788)
+DOUBLE_BYTE_PAIR(0xE8B4, 0x97D0)
+DOUBLE_BYTE_PAIR(0xE8B5, 0x97CF)
+DOUBLE_BYTE_PAIR(0xE8B6, 0x981E)
+DOUBLE_BYTE_PAIR(0xE8B7, 0x981D)
+DOUBLE_BYTE_PAIR(0xE8B8, 0x9826)
+DOUBLE_BYTE_PAIR(0xE8B9, 0x9829)
+DOUBLE_BYTE_PAIR(0xE8BA, 0x9828)
+DOUBLE_BYTE_PAIR(0xE8BB, 0x9820)
+DOUBLE_BYTE_PAIR(0xE8BC, 0x981B)
+DOUBLE_BYTE_PAIR(0xE8BD, 0x9827)
+DOUBLE_BYTE_PAIR(0xE8BE, 0x98B2)
+DOUBLE_BYTE_PAIR(0xE8BF, 0x9908)
+DOUBLE_BYTE_PAIR(0xE8C0, 0x98FA)
+DOUBLE_BYTE_PAIR(0xE8C1, 0x9911)
+DOUBLE_BYTE_PAIR(0xE8C2, 0x9914)
+DOUBLE_BYTE_PAIR(0xE8C3, 0x9916)
+DOUBLE_BYTE_PAIR(0xE8C4, 0x9917)
+DOUBLE_BYTE_PAIR(0xE8C5, 0x9915)
+DOUBLE_BYTE_PAIR(0xE8C6, 0x99DC)
+DOUBLE_BYTE_PAIR(0xE8C7, 0x99CD)
+DOUBLE_BYTE_PAIR(0xE8C8, 0x99CF)
+DOUBLE_BYTE_PAIR(0xE8C9, 0x99D3)
+DOUBLE_BYTE_PAIR(0xE8CA, 0x99D4)
+DOUBLE_BYTE_PAIR(0xE8CB, 0x99CE)
+DOUBLE_BYTE_PAIR(0xE8CC, 0x99C9)
+DOUBLE_BYTE_PAIR(0xE8CD, 0x99D6)
+DOUBLE_BYTE_PAIR(0xE8CE, 0x99D8)
+DOUBLE_BYTE_PAIR(0xE8CF, 0x99CB)
+DOUBLE_BYTE_PAIR(0xE8D0, 0x99D7)
+DOUBLE_BYTE_PAIR(0xE8D1, 0x99CC)
+DOUBLE_BYTE_PAIR(0xE8D2, 0x9AB3)
+DOUBLE_BYTE_PAIR(0xE8D3, 0x9AEC)
+DOUBLE_BYTE_PAIR(0xE8D4, 0x9AEB)
+DOUBLE_BYTE_PAIR(0xE8D5, 0x9AF3)
+DOUBLE_BYTE_PAIR(0xE8D6, 0x9AF2)
+DOUBLE_BYTE_PAIR(0xE8D7, 0x9AF1)
+DOUBLE_BYTE_PAIR(0xE8D8, 0x9B46)
+DOUBLE_BYTE_PAIR(0xE8D9, 0x9B43)
+DOUBLE_BYTE_PAIR(0xE8DA, 0x9B67)
+DOUBLE_BYTE_PAIR(0xE8DB, 0x9B74)
+DOUBLE_BYTE_PAIR(0xE8DC, 0x9B71)
+DOUBLE_BYTE_PAIR(0xE8DD, 0x9B66)
+DOUBLE_BYTE_PAIR(0xE8DE, 0x9B76)
+DOUBLE_BYTE_PAIR(0xE8DF, 0x9B75)
+DOUBLE_BYTE_PAIR(0xE8E0, 0x9B70)
+DOUBLE_BYTE_PAIR(0xE8E1, 0x9B68)
+DOUBLE_BYTE_PAIR(0xE8E2, 0x9B64)
+DOUBLE_BYTE_PAIR(0xE8E3, 0x9B6C)
+DOUBLE_BYTE_PAIR(0xE8E4, 0x9CFC)
+DOUBLE_BYTE_PAIR(0xE8E5, 0x9CFA)
+DOUBLE_BYTE_PAIR(0xE8E6, 0x9CFD)
+DOUBLE_BYTE_PAIR(0xE8E7, 0x9CFF)
+DOUBLE_BYTE_PAIR(0xE8E8, 0x9CF7)
+DOUBLE_BYTE_PAIR(0xE8E9, 0x9D07)
+DOUBLE_BYTE_PAIR(0xE8EA, 0x9D00)
+DOUBLE_BYTE_PAIR(0xE8EB, 0x9CF9)
+DOUBLE_BYTE_PAIR(0xE8EC, 0x9CFB)
+DOUBLE_BYTE_PAIR(0xE8ED, 0x9D08)
+DOUBLE_BYTE_PAIR(0xE8EE, 0x9D05)
+DOUBLE_BYTE_PAIR(0xE8EF, 0x9D04)
+DOUBLE_BYTE_PAIR(0xE8F0, 0x9E83)
+DOUBLE_BYTE_PAIR(0xE8F1, 0x9ED3)
+DOUBLE_BYTE_PAIR(0xE8F2, 0x9F0F)
+DOUBLE_BYTE_PAIR(0xE8F3, 0x9F10)
+DOUBLE_BYTE_PAIR(0xE8F4, 0x511C)
+DOUBLE_BYTE_PAIR(0xE8F5, 0x5113)
+DOUBLE_BYTE_PAIR(0xE8F6, 0x5117)
+DOUBLE_BYTE_PAIR(0xE8F7, 0x511A)
+DOUBLE_BYTE_PAIR(0xE8F8, 0x5111)
+DOUBLE_BYTE_PAIR(0xE8F9, 0x51DE)
+DOUBLE_BYTE_PAIR(0xE8FA, 0x5334)
+DOUBLE_BYTE_PAIR(0xE8FB, 0x53E1)
+DOUBLE_BYTE_PAIR(0xE8FC, 0x5670)
+DOUBLE_BYTE_PAIR(0xE8FD, 0x5660)
+DOUBLE_BYTE_PAIR(0xE8FE, 0x566E)
+DOUBLE_BYTE_PAIR(0xE940, 0x5673)
+DOUBLE_BYTE_PAIR(0xE941, 0x5666)
+DOUBLE_BYTE_PAIR(0xE942, 0x5663)
+DOUBLE_BYTE_PAIR(0xE943, 0x566D)
+DOUBLE_BYTE_PAIR(0xE944, 0x5672)
+DOUBLE_BYTE_PAIR(0xE945, 0x565E)
+DOUBLE_BYTE_PAIR(0xE946, 0x5677)
+DOUBLE_BYTE_PAIR(0xE947, 0x571C)
+DOUBLE_BYTE_PAIR(0xE948, 0x571B)
+DOUBLE_BYTE_PAIR(0xE949, 0x58C8)
+DOUBLE_BYTE_PAIR(0xE94A, 0x58BD)
+DOUBLE_BYTE_PAIR(0xE94B, 0x58C9)
+DOUBLE_BYTE_PAIR(0xE94C, 0x58BF)
+DOUBLE_BYTE_PAIR(0xE94D, 0x58BA)
+DOUBLE_BYTE_PAIR(0xE94E, 0x58C2)
+DOUBLE_BYTE_PAIR(0xE94F, 0x58BC)
+DOUBLE_BYTE_PAIR(0xE950, 0x58C6)
+DOUBLE_BYTE_PAIR(0xE951, 0x5B17)
+DOUBLE_BYTE_PAIR(0xE952, 0x5B19)
+DOUBLE_BYTE_PAIR(0xE953, 0x5B1B)
+DOUBLE_BYTE_PAIR(0xE954, 0x5B21)
+DOUBLE_BYTE_PAIR(0xE955, 0x5B14)
+DOUBLE_BYTE_PAIR(0xE956, 0x5B13)
+DOUBLE_BYTE_PAIR(0xE957, 0x5B10)
+DOUBLE_BYTE_PAIR(0xE958, 0x5B16)
+DOUBLE_BYTE_PAIR(0xE959, 0x5B28)
+DOUBLE_BYTE_PAIR(0xE95A, 0x5B1A)
+DOUBLE_BYTE_PAIR(0xE95B, 0x5B20)
+DOUBLE_BYTE_PAIR(0xE95C, 0x5B1E)
+DOUBLE_BYTE_PAIR(0xE95D, 0x5BEF)
+DOUBLE_BYTE_PAIR(0xE95E, 0x5DAC)
+DOUBLE_BYTE_PAIR(0xE95F, 0x5DB1)
+DOUBLE_BYTE_PAIR(0xE960, 0x5DA9)
+DOUBLE_BYTE_PAIR(0xE961, 0x5DA7)
+DOUBLE_BYTE_PAIR(0xE962, 0x5DB5)
+DOUBLE_BYTE_PAIR(0xE963, 0x5DB0)
+DOUBLE_BYTE_PAIR(0xE964, 0x5DAE)
+DOUBLE_BYTE_PAIR(0xE965, 0x5DAA)
+DOUBLE_BYTE_PAIR(0xE966, 0x5DA8)
+DOUBLE_BYTE_PAIR(0xE967, 0x5DB2)
+DOUBLE_BYTE_PAIR(0xE968, 0x5DAD)
+DOUBLE_BYTE_PAIR(0xE969, 0x5DAF)
+DOUBLE_BYTE_PAIR(0xE96A, 0x5DB4)
+DOUBLE_BYTE_PAIR(0xE96B, 0x5E67)
+DOUBLE_BYTE_PAIR(0xE96C, 0x5E68)
+DOUBLE_BYTE_PAIR(0xE96D, 0x5E66)
+DOUBLE_BYTE_PAIR(0xE96E, 0x5E6F)
+DOUBLE_BYTE_PAIR(0xE96F, 0x5EE9)
+DOUBLE_BYTE_PAIR(0xE970, 0x5EE7)
+DOUBLE_BYTE_PAIR(0xE971, 0x5EE6)
+DOUBLE_BYTE_PAIR(0xE972, 0x5EE8)
+DOUBLE_BYTE_PAIR(0xE973, 0x5EE5)
+DOUBLE_BYTE_PAIR(0xE974, 0x5F4B)
+DOUBLE_BYTE_PAIR(0xE975, 0x5FBC)
+DOUBLE_BYTE_PAIR(0xE976, 0x619D)
+DOUBLE_BYTE_PAIR(0xE977, 0x61A8)
+DOUBLE_BYTE_PAIR(0xE978, 0x6196)
+DOUBLE_BYTE_PAIR(0xE979, 0x61C5)
+DOUBLE_BYTE_PAIR(0xE97A, 0x61B4)
+DOUBLE_BYTE_PAIR(0xE97B, 0x61C6)
+DOUBLE_BYTE_PAIR(0xE97C, 0x61C1)
+DOUBLE_BYTE_PAIR(0xE97D, 0x61CC)
+DOUBLE_BYTE_PAIR(0xE97E, 0x61BA)
+DOUBLE_BYTE_PAIR(0xE9A1, 0x61BF)
+DOUBLE_BYTE_PAIR(0xE9A2, 0x61B8)
+DOUBLE_BYTE_PAIR(0xE9A3, 0x618C)
+DOUBLE_BYTE_PAIR(0xE9A4, 0x64D7)
+DOUBLE_BYTE_PAIR(0xE9A5, 0x64D6)
+DOUBLE_BYTE_PAIR(0xE9A6, 0x64D0)
+DOUBLE_BYTE_PAIR(0xE9A7, 0x64CF)
+DOUBLE_BYTE_PAIR(0xE9A8, 0x64C9)
+DOUBLE_BYTE_PAIR(0xE9A9, 0x64BD)
+DOUBLE_BYTE_PAIR(0xE9AA, 0x6489)
+DOUBLE_BYTE_PAIR(0xE9AB, 0x64C3)
+DOUBLE_BYTE_PAIR(0xE9AC, 0x64DB)
+DOUBLE_BYTE_PAIR(0xE9AD, 0x64F3)
+DOUBLE_BYTE_PAIR(0xE9AE, 0x64D9)
+DOUBLE_BYTE_PAIR(0xE9AF, 0x6533)
+DOUBLE_BYTE_PAIR(0xE9B0, 0x657F)
+DOUBLE_BYTE_PAIR(0xE9B1, 0x657C)
+DOUBLE_BYTE_PAIR(0xE9B2, 0x65A2)
+DOUBLE_BYTE_PAIR(0xE9B3, 0x66C8)
+DOUBLE_BYTE_PAIR(0xE9B4, 0x66BE)
+DOUBLE_BYTE_PAIR(0xE9B5, 0x66C0)
+DOUBLE_BYTE_PAIR(0xE9B6, 0x66CA)
+DOUBLE_BYTE_PAIR(0xE9B7, 0x66CB)
+DOUBLE_BYTE_PAIR(0xE9B8, 0x66CF)
+DOUBLE_BYTE_PAIR(0xE9B9, 0x66BD)
+DOUBLE_BYTE_PAIR(0xE9BA, 0x66BB)
+DOUBLE_BYTE_PAIR(0xE9BB, 0x66BA)
+DOUBLE_BYTE_PAIR(0xE9BC, 0x66CC)
+DOUBLE_BYTE_PAIR(0xE9BD, 0x6723)
+DOUBLE_BYTE_PAIR(0xE9BE, 0x6A34)
+DOUBLE_BYTE_PAIR(0xE9BF, 0x6A66)
+DOUBLE_BYTE_PAIR(0xE9C0, 0x6A49)
+DOUBLE_BYTE_PAIR(0xE9C1, 0x6A67)
+DOUBLE_BYTE_PAIR(0xE9C2, 0x6A32)
+DOUBLE_BYTE_PAIR(0xE9C3, 0x6A68)
+DOUBLE_BYTE_PAIR(0xE9C4, 0x6A3E)
+DOUBLE_BYTE_PAIR(0xE9C5, 0x6A5D)
+DOUBLE_BYTE_PAIR(0xE9C6, 0x6A6D)
+DOUBLE_BYTE_PAIR(0xE9C7, 0x6A76)
+DOUBLE_BYTE_PAIR(0xE9C8, 0x6A5B)
+DOUBLE_BYTE_PAIR(0xE9C9, 0x6A51)
+DOUBLE_BYTE_PAIR(0xE9CA, 0x6A28)
+DOUBLE_BYTE_PAIR(0xE9CB, 0x6A5A)
+DOUBLE_BYTE_PAIR(0xE9CC, 0x6A3B)
+DOUBLE_BYTE_PAIR(0xE9CD, 0x6A3F)
+DOUBLE_BYTE_PAIR(0xE9CE, 0x6A41)
+DOUBLE_BYTE_PAIR(0xE9CF, 0x6A6A)
+DOUBLE_BYTE_PAIR(0xE9D0, 0x6A64)
+DOUBLE_BYTE_PAIR(0xE9D1, 0x6A50)
+DOUBLE_BYTE_PAIR(0xE9D2, 0x6A4F)
+DOUBLE_BYTE_PAIR(0xE9D3, 0x6A54)
+DOUBLE_BYTE_PAIR(0xE9D4, 0x6A6F)
+DOUBLE_BYTE_PAIR(0xE9D5, 0x6A69)
+DOUBLE_BYTE_PAIR(0xE9D6, 0x6A60)
+DOUBLE_BYTE_PAIR(0xE9D7, 0x6A3C)
+DOUBLE_BYTE_PAIR(0xE9D8, 0x6A5E)
+DOUBLE_BYTE_PAIR(0xE9D9, 0x6A56)
+DOUBLE_BYTE_PAIR(0xE9DA, 0x6A55)
+DOUBLE_BYTE_PAIR(0xE9DB, 0x6A4D)
+DOUBLE_BYTE_PAIR(0xE9DC, 0x6A4E)
+DOUBLE_BYTE_PAIR(0xE9DD, 0x6A46)
+DOUBLE_BYTE_PAIR(0xE9DE, 0x6B55)
+DOUBLE_BYTE_PAIR(0xE9DF, 0x6B54)
+DOUBLE_BYTE_PAIR(0xE9E0, 0x6B56)
+DOUBLE_BYTE_PAIR(0xE9E1, 0x6BA7)
+DOUBLE_BYTE_PAIR(0xE9E2, 0x6BAA)
+DOUBLE_BYTE_PAIR(0xE9E3, 0x6BAB)
+DOUBLE_BYTE_PAIR(0xE9E4, 0x6BC8)
+DOUBLE_BYTE_PAIR(0xE9E5, 0x6BC7)
+DOUBLE_BYTE_PAIR(0xE9E6, 0x6C04)
+DOUBLE_BYTE_PAIR(0xE9E7, 0x6C03)
+DOUBLE_BYTE_PAIR(0xE9E8, 0x6C06)
+DOUBLE_BYTE_PAIR(0xE9E9, 0x6FAD)
+DOUBLE_BYTE_PAIR(0xE9EA, 0x6FCB)
+DOUBLE_BYTE_PAIR(0xE9EB, 0x6FA3)
+DOUBLE_BYTE_PAIR(0xE9EC, 0x6FC7)
+DOUBLE_BYTE_PAIR(0xE9ED, 0x6FBC)
+DOUBLE_BYTE_PAIR(0xE9EE, 0x6FCE)
+DOUBLE_BYTE_PAIR(0xE9EF, 0x6FC8)
+DOUBLE_BYTE_PAIR(0xE9F0, 0x6F5E)
+DOUBLE_BYTE_PAIR(0xE9F1, 0x6FC4)
+DOUBLE_BYTE_PAIR(0xE9F2, 0x6FBD)
+DOUBLE_BYTE_PAIR(0xE9F3, 0x6F9E)
+DOUBLE_BYTE_PAIR(0xE9F4, 0x6FCA)
+DOUBLE_BYTE_PAIR(0xE9F5, 0x6FA8)
+DOUBLE_BYTE_PAIR(0xE9F6, 0x7004)
+DOUBLE_BYTE_PAIR(0xE9F7, 0x6FA5)
+DOUBLE_BYTE_PAIR(0xE9F8, 0x6FAE)
+DOUBLE_BYTE_PAIR(0xE9F9, 0x6FBA)
+DOUBLE_BYTE_PAIR(0xE9FA, 0x6FAC)
+DOUBLE_BYTE_PAIR(0xE9FB, 0x6FAA)
+DOUBLE_BYTE_PAIR(0xE9FC, 0x6FCF)
+DOUBLE_BYTE_PAIR(0xE9FD, 0x6FBF)
+DOUBLE_BYTE_PAIR(0xE9FE, 0x6FB8)
+DOUBLE_BYTE_PAIR(0xEA40, 0x6FA2)
+DOUBLE_BYTE_PAIR(0xEA41, 0x6FC9)
+DOUBLE_BYTE_PAIR(0xEA42, 0x6FAB)
+DOUBLE_BYTE_PAIR(0xEA43, 0x6FCD)
+DOUBLE_BYTE_PAIR(0xEA44, 0x6FAF)
+DOUBLE_BYTE_PAIR(0xEA45, 0x6FB2)
+DOUBLE_BYTE_PAIR(0xEA46, 0x6FB0)
+DOUBLE_BYTE_PAIR(0xEA47, 0x71C5)
+DOUBLE_BYTE_PAIR(0xEA48, 0x71C2)
+DOUBLE_BYTE_PAIR(0xEA49, 0x71BF)
+DOUBLE_BYTE_PAIR(0xEA4A, 0x71B8)
+DOUBLE_BYTE_PAIR(0xEA4B, 0x71D6)
+DOUBLE_BYTE_PAIR(0xEA4C, 0x71C0)
+DOUBLE_BYTE_PAIR(0xEA4D, 0x71C1)
+DOUBLE_BYTE_PAIR(0xEA4E, 0x71CB)
+DOUBLE_BYTE_PAIR(0xEA4F, 0x71D4)
+DOUBLE_BYTE_PAIR(0xEA50, 0x71CA)
+DOUBLE_BYTE_PAIR(0xEA51, 0x71C7)
+DOUBLE_BYTE_PAIR(0xEA52, 0x71CF)
+DOUBLE_BYTE_PAIR(0xEA53, 0x71BD)
+DOUBLE_BYTE_PAIR(0xEA54, 0x71D8)
+DOUBLE_BYTE_PAIR(0xEA55, 0x71BC)
+DOUBLE_BYTE_PAIR(0xEA56, 0x71C6)
+DOUBLE_BYTE_PAIR(0xEA57, 0x71DA)
+DOUBLE_BYTE_PAIR(0xEA58, 0x71DB)
+DOUBLE_BYTE_PAIR(0xEA59, 0x729D)
+DOUBLE_BYTE_PAIR(0xEA5A, 0x729E)
+DOUBLE_BYTE_PAIR(0xEA5B, 0x7369)
+DOUBLE_BYTE_PAIR(0xEA5C, 0x7366)
+DOUBLE_BYTE_PAIR(0xEA5D, 0x7367)
+DOUBLE_BYTE_PAIR(0xEA5E, 0x736C)
+DOUBLE_BYTE_PAIR(0xEA5F, 0x7365)
+DOUBLE_BYTE_PAIR(0xEA60, 0x736B)
+DOUBLE_BYTE_PAIR(0xEA61, 0x736A)
+DOUBLE_BYTE_PAIR(0xEA62, 0x747F)
+DOUBLE_BYTE_PAIR(0xEA63, 0x749A)
+DOUBLE_BYTE_PAIR(0xEA64, 0x74A0)
+DOUBLE_BYTE_PAIR(0xEA65, 0x7494)
+DOUBLE_BYTE_PAIR(0xEA66, 0x7492)
+DOUBLE_BYTE_PAIR(0xEA67, 0x7495)
+DOUBLE_BYTE_PAIR(0xEA68, 0x74A1)
+DOUBLE_BYTE_PAIR(0xEA69, 0x750B)
+DOUBLE_BYTE_PAIR(0xEA6A, 0x7580)
+DOUBLE_BYTE_PAIR(0xEA6B, 0x762F)
+DOUBLE_BYTE_PAIR(0xEA6C, 0x762D)
+DOUBLE_BYTE_PAIR(0xEA6D, 0x7631)
+DOUBLE_BYTE_PAIR(0xEA6E, 0x763D)
+DOUBLE_BYTE_PAIR(0xEA6F, 0x7633)
+DOUBLE_BYTE_PAIR(0xEA70, 0x763C)
+DOUBLE_BYTE_PAIR(0xEA71, 0x7635)
+DOUBLE_BYTE_PAIR(0xEA72, 0x7632)
+DOUBLE_BYTE_PAIR(0xEA73, 0x7630)
+DOUBLE_BYTE_PAIR(0xEA74, 0x76BB)
+DOUBLE_BYTE_PAIR(0xEA75, 0x76E6)
+DOUBLE_BYTE_PAIR(0xEA76, 0x779A)
+DOUBLE_BYTE_PAIR(0xEA77, 0x779D)
+DOUBLE_BYTE_PAIR(0xEA78, 0x77A1)
+DOUBLE_BYTE_PAIR(0xEA79, 0x779C)
+DOUBLE_BYTE_PAIR(0xEA7A, 0x779B)
+DOUBLE_BYTE_PAIR(0xEA7B, 0x77A2)
+DOUBLE_BYTE_PAIR(0xEA7C, 0x77A3)
+DOUBLE_BYTE_PAIR(0xEA7D, 0x7795)
+DOUBLE_BYTE_PAIR(0xEA7E, 0x7799)
+DOUBLE_BYTE_PAIR(0xEAA1, 0x7797)
+DOUBLE_BYTE_PAIR(0xEAA2, 0x78DD)
+DOUBLE_BYTE_PAIR(0xEAA3, 0x78E9)
+DOUBLE_BYTE_PAIR(0xEAA4, 0x78E5)
+DOUBLE_BYTE_PAIR(0xEAA5, 0x78EA)
+DOUBLE_BYTE_PAIR(0xEAA6, 0x78DE)
+DOUBLE_BYTE_PAIR(0xEAA7, 0x78E3)
+DOUBLE_BYTE_PAIR(0xEAA8, 0x78DB)
+DOUBLE_BYTE_PAIR(0xEAA9, 0x78E1)
+DOUBLE_BYTE_PAIR(0xEAAA, 0x78E2)
+DOUBLE_BYTE_PAIR(0xEAAB, 0x78ED)
+DOUBLE_BYTE_PAIR(0xEAAC, 0x78DF)
+DOUBLE_BYTE_PAIR(0xEAAD, 0x78E0)
+DOUBLE_BYTE_PAIR(0xEAAE, 0x79A4)
+DOUBLE_BYTE_PAIR(0xEAAF, 0x7A44)
+DOUBLE_BYTE_PAIR(0xEAB0, 0x7A48)
+DOUBLE_BYTE_PAIR(0xEAB1, 0x7A47)
+DOUBLE_BYTE_PAIR(0xEAB2, 0x7AB6)
+DOUBLE_BYTE_PAIR(0xEAB3, 0x7AB8)
+DOUBLE_BYTE_PAIR(0xEAB4, 0x7AB5)
+DOUBLE_BYTE_PAIR(0xEAB5, 0x7AB1)
+DOUBLE_BYTE_PAIR(0xEAB6, 0x7AB7)
+DOUBLE_BYTE_PAIR(0xEAB7, 0x7BDE)
+DOUBLE_BYTE_PAIR(0xEAB8, 0x7BE3)
+DOUBLE_BYTE_PAIR(0xEAB9, 0x7BE7)
+DOUBLE_BYTE_PAIR(0xEABA, 0x7BDD)
+DOUBLE_BYTE_PAIR(0xEABB, 0x7BD5)
+DOUBLE_BYTE_PAIR(0xEABC, 0x7BE5)
+DOUBLE_BYTE_PAIR(0xEABD, 0x7BDA)
+DOUBLE_BYTE_PAIR(0xEABE, 0x7BE8)
+DOUBLE_BYTE_PAIR(0xEABF, 0x7BF9)
+DOUBLE_BYTE_PAIR(0xEAC0, 0x7BD4)
+DOUBLE_BYTE_PAIR(0xEAC1, 0x7BEA)
+DOUBLE_BYTE_PAIR(0xEAC2, 0x7BE2)
+DOUBLE_BYTE_PAIR(0xEAC3, 0x7BDC)
+DOUBLE_BYTE_PAIR(0xEAC4, 0x7BEB)
+DOUBLE_BYTE_PAIR(0xEAC5, 0x7BD8)
+DOUBLE_BYTE_PAIR(0xEAC6, 0x7BDF)
+DOUBLE_BYTE_PAIR(0xEAC7, 0x7CD2)
+DOUBLE_BYTE_PAIR(0xEAC8, 0x7CD4)
+DOUBLE_BYTE_PAIR(0xEAC9, 0x7CD7)
+DOUBLE_BYTE_PAIR(0xEACA, 0x7CD0)
+DOUBLE_BYTE_PAIR(0xEACB, 0x7CD1)
+DOUBLE_BYTE_PAIR(0xEACC, 0x7E12)
+DOUBLE_BYTE_PAIR(0xEACD, 0x7E21)
+DOUBLE_BYTE_PAIR(0xEACE, 0x7E17)
+DOUBLE_BYTE_PAIR(0xEACF, 0x7E0C)
+DOUBLE_BYTE_PAIR(0xEAD0, 0x7E1F)
+DOUBLE_BYTE_PAIR(0xEAD1, 0x7E20)
+DOUBLE_BYTE_PAIR(0xEAD2, 0x7E13)
+DOUBLE_BYTE_PAIR(0xEAD3, 0x7E0E)
+DOUBLE_BYTE_PAIR(0xEAD4, 0x7E1C)
+DOUBLE_BYTE_PAIR(0xEAD5, 0x7E15)
+DOUBLE_BYTE_PAIR(0xEAD6, 0x7E1A)
+DOUBLE_BYTE_PAIR(0xEAD7, 0x7E22)
+DOUBLE_BYTE_PAIR(0xEAD8, 0x7E0B)
+DOUBLE_BYTE_PAIR(0xEAD9, 0x7E0F)
+DOUBLE_BYTE_PAIR(0xEADA, 0x7E16)
+DOUBLE_BYTE_PAIR(0xEADB, 0x7E0D)
+DOUBLE_BYTE_PAIR(0xEADC, 0x7E14)
+DOUBLE_BYTE_PAIR(0xEADD, 0x7E25)
+DOUBLE_BYTE_PAIR(0xEADE, 0x7E24)
+DOUBLE_BYTE_PAIR(0xEADF, 0x7F43)
+DOUBLE_BYTE_PAIR(0xEAE0, 0x7F7B)
+DOUBLE_BYTE_PAIR(0xEAE1, 0x7F7C)
+DOUBLE_BYTE_PAIR(0xEAE2, 0x7F7A)
+DOUBLE_BYTE_PAIR(0xEAE3, 0x7FB1)
+DOUBLE_BYTE_PAIR(0xEAE4, 0x7FEF)
+DOUBLE_BYTE_PAIR(0xEAE5, 0x802A)
+DOUBLE_BYTE_PAIR(0xEAE6, 0x8029)
+DOUBLE_BYTE_PAIR(0xEAE7, 0x806C)
+DOUBLE_BYTE_PAIR(0xEAE8, 0x81B1)
+DOUBLE_BYTE_PAIR(0xEAE9, 0x81A6)
+DOUBLE_BYTE_PAIR(0xEAEA, 0x81AE)
+DOUBLE_BYTE_PAIR(0xEAEB, 0x81B9)
+DOUBLE_BYTE_PAIR(0xEAEC, 0x81B5)
+DOUBLE_BYTE_PAIR(0xEAED, 0x81AB)
+DOUBLE_BYTE_PAIR(0xEAEE, 0x81B0)
+DOUBLE_BYTE_PAIR(0xEAEF, 0x81AC)
+DOUBLE_BYTE_PAIR(0xEAF0, 0x81B4)
+DOUBLE_BYTE_PAIR(0xEAF1, 0x81B2)
+DOUBLE_BYTE_PAIR(0xEAF2, 0x81B7)
+DOUBLE_BYTE_PAIR(0xEAF3, 0x81A7)
+DOUBLE_BYTE_PAIR(0xEAF4, 0x81F2)
+DOUBLE_BYTE_PAIR(0xEAF5, 0x8255)
+DOUBLE_BYTE_PAIR(0xEAF6, 0x8256)
+DOUBLE_BYTE_PAIR(0xEAF7, 0x8257)
+DOUBLE_BYTE_PAIR(0xEAF8, 0x8556)
+DOUBLE_BYTE_PAIR(0xEAF9, 0x8545)
+DOUBLE_BYTE_PAIR(0xEAFA, 0x856B)
+DOUBLE_BYTE_PAIR(0xEAFB, 0x854D)
+DOUBLE_BYTE_PAIR(0xEAFC, 0x8553)
+DOUBLE_BYTE_PAIR(0xEAFD, 0x8561)
+DOUBLE_BYTE_PAIR(0xEAFE, 0x8558)
+DOUBLE_BYTE_PAIR(0xEB40, 0x8540)
+DOUBLE_BYTE_PAIR(0xEB41, 0x8546)
+DOUBLE_BYTE_PAIR(0xEB42, 0x8564)
+DOUBLE_BYTE_PAIR(0xEB43, 0x8541)
+DOUBLE_BYTE_PAIR(0xEB44, 0x8562)
+DOUBLE_BYTE_PAIR(0xEB45, 0x8544)
+DOUBLE_BYTE_PAIR(0xEB46, 0x8551)
+DOUBLE_BYTE_PAIR(0xEB47, 0x8547)
+DOUBLE_BYTE_PAIR(0xEB48, 0x8563)
+DOUBLE_BYTE_PAIR(0xEB49, 0x853E)
+DOUBLE_BYTE_PAIR(0xEB4A, 0x855B)
+DOUBLE_BYTE_PAIR(0xEB4B, 0x8571)
+DOUBLE_BYTE_PAIR(0xEB4C, 0x854E)
+DOUBLE_BYTE_PAIR(0xEB4D, 0x856E)
+DOUBLE_BYTE_PAIR(0xEB4E, 0x8575)
+DOUBLE_BYTE_PAIR(0xEB4F, 0x8555)
+DOUBLE_BYTE_PAIR(0xEB50, 0x8567)
+DOUBLE_BYTE_PAIR(0xEB51, 0x8560)
+DOUBLE_BYTE_PAIR(0xEB52, 0x858C)
+DOUBLE_BYTE_PAIR(0xEB53, 0x8566)
+DOUBLE_BYTE_PAIR(0xEB54, 0x855D)
+DOUBLE_BYTE_PAIR(0xEB55, 0x8554)
+DOUBLE_BYTE_PAIR(0xEB56, 0x8565)
+DOUBLE_BYTE_PAIR(0xEB57, 0x856C)
+DOUBLE_BYTE_PAIR(0xEB58, 0x8663)
+DOUBLE_BYTE_PAIR(0xEB59, 0x8665)
+DOUBLE_BYTE_PAIR(0xEB5A, 0x8664)
+DOUBLE_BYTE_PAIR(0xEB5B, 0x879B)
+DOUBLE_BYTE_PAIR(0xEB5C, 0x878F)
+DOUBLE_BYTE_PAIR(0xEB5D, 0x8797)
+DOUBLE_BYTE_PAIR(0xEB5E, 0x8793)
+DOUBLE_BYTE_PAIR(0xEB5F, 0x8792)
+DOUBLE_BYTE_PAIR(0xEB60, 0x8788)
+DOUBLE_BYTE_PAIR(0xEB61, 0x8781)
+DOUBLE_BYTE_PAIR(0xEB62, 0x8796)
+DOUBLE_BYTE_PAIR(0xEB63, 0x8798)
+DOUBLE_BYTE_PAIR(0xEB64, 0x8779)
+DOUBLE_BYTE_PAIR(0xEB65, 0x8787)
+DOUBLE_BYTE_PAIR(0xEB66, 0x87A3)
+DOUBLE_BYTE_PAIR(0xEB67, 0x8785)
+DOUBLE_BYTE_PAIR(0xEB68, 0x8790)
+DOUBLE_BYTE_PAIR(0xEB69, 0x8791)
+DOUBLE_BYTE_PAIR(0xEB6A, 0x879D)
+DOUBLE_BYTE_PAIR(0xEB6B, 0x8784)
+DOUBLE_BYTE_PAIR(0xEB6C, 0x8794)
+DOUBLE_BYTE_PAIR(0xEB6D, 0x879C)
+DOUBLE_BYTE_PAIR(0xEB6E, 0x879A)
+DOUBLE_BYTE_PAIR(0xEB6F, 0x8789)
+DOUBLE_BYTE_PAIR(0xEB70, 0x891E)
+DOUBLE_BYTE_PAIR(0xEB71, 0x8926)
+DOUBLE_BYTE_PAIR(0xEB72, 0x8930)
+DOUBLE_BYTE_PAIR(0xEB73, 0x892D)
+DOUBLE_BYTE_PAIR(0xEB74, 0x892E)
+DOUBLE_BYTE_PAIR(0xEB75, 0x8927)
+DOUBLE_BYTE_PAIR(0xEB76, 0x8931)
+DOUBLE_BYTE_PAIR(0xEB77, 0x8922)
+DOUBLE_BYTE_PAIR(0xEB78, 0x8929)
+DOUBLE_BYTE_PAIR(0xEB79, 0x8923)
+DOUBLE_BYTE_PAIR(0xEB7A, 0x892F)
+DOUBLE_BYTE_PAIR(0xEB7B, 0x892C)
+DOUBLE_BYTE_PAIR(0xEB7C, 0x891F)
+DOUBLE_BYTE_PAIR(0xEB7D, 0x89F1)
+DOUBLE_BYTE_PAIR(0xEB7E, 0x8AE0)
+DOUBLE_BYTE_PAIR(0xEBA1, 0x8AE2)
+DOUBLE_BYTE_PAIR(0xEBA2, 0x8AF2)
+DOUBLE_BYTE_PAIR(0xEBA3, 0x8AF4)
+DOUBLE_BYTE_PAIR(0xEBA4, 0x8AF5)
+DOUBLE_BYTE_PAIR(0xEBA5, 0x8ADD)
+DOUBLE_BYTE_PAIR(0xEBA6, 0x8B14)
+DOUBLE_BYTE_PAIR(0xEBA7, 0x8AE4)
+DOUBLE_BYTE_PAIR(0xEBA8, 0x8ADF)
+DOUBLE_BYTE_PAIR(0xEBA9, 0x8AF0)
+DOUBLE_BYTE_PAIR(0xEBAA, 0x8AC8)
+DOUBLE_BYTE_PAIR(0xEBAB, 0x8ADE)
+DOUBLE_BYTE_PAIR(0xEBAC, 0x8AE1)
+DOUBLE_BYTE_PAIR(0xEBAD, 0x8AE8)
+DOUBLE_BYTE_PAIR(0xEBAE, 0x8AFF)
+DOUBLE_BYTE_PAIR(0xEBAF, 0x8AEF)
+DOUBLE_BYTE_PAIR(0xEBB0, 0x8AFB)
+DOUBLE_BYTE_PAIR(0xEBB1, 0x8C91)
+DOUBLE_BYTE_PAIR(0xEBB2, 0x8C92)
+DOUBLE_BYTE_PAIR(0xEBB3, 0x8C90)
+DOUBLE_BYTE_PAIR(0xEBB4, 0x8CF5)
+DOUBLE_BYTE_PAIR(0xEBB5, 0x8CEE)
+DOUBLE_BYTE_PAIR(0xEBB6, 0x8CF1)
+DOUBLE_BYTE_PAIR(0xEBB7, 0x8CF0)
+DOUBLE_BYTE_PAIR(0xEBB8, 0x8CF3)
+DOUBLE_BYTE_PAIR(0xEBB9, 0x8D6C)
+DOUBLE_BYTE_PAIR(0xEBBA, 0x8D6E)
+DOUBLE_BYTE_PAIR(0xEBBB, 0x8DA5)
+DOUBLE_BYTE_PAIR(0xEBBC, 0x8DA7)
+DOUBLE_BYTE_PAIR(0xEBBD, 0x8E33)
+DOUBLE_BYTE_PAIR(0xEBBE, 0x8E3E)
+DOUBLE_BYTE_PAIR(0xEBBF, 0x8E38)
+DOUBLE_BYTE_PAIR(0xEBC0, 0x8E40)
+DOUBLE_BYTE_PAIR(0xEBC1, 0x8E45)
+DOUBLE_BYTE_PAIR(0xEBC2, 0x8E36)
+DOUBLE_BYTE_PAIR(0xEBC3, 0x8E3C)
+DOUBLE_BYTE_PAIR(0xEBC4, 0x8E3D)
+DOUBLE_BYTE_PAIR(0xEBC5, 0x8E41)
+DOUBLE_BYTE_PAIR(0xEBC6, 0x8E30)
+DOUBLE_BYTE_PAIR(0xEBC7, 0x8E3F)
+DOUBLE_BYTE_PAIR(0xEBC8, 0x8EBD)
+DOUBLE_BYTE_PAIR(0xEBC9, 0x8F36)
+DOUBLE_BYTE_PAIR(0xEBCA, 0x8F2E)
+DOUBLE_BYTE_PAIR(0xEBCB, 0x8F35)
+DOUBLE_BYTE_PAIR(0xEBCC, 0x8F32)
+DOUBLE_BYTE_PAIR(0xEBCD, 0x8F39)
+DOUBLE_BYTE_PAIR(0xEBCE, 0x8F37)
+DOUBLE_BYTE_PAIR(0xEBCF, 0x8F34)
+DOUBLE_BYTE_PAIR(0xEBD0, 0x9076)
+DOUBLE_BYTE_PAIR(0xEBD1, 0x9079)
+DOUBLE_BYTE_PAIR(0xEBD2, 0x907B)
+DOUBLE_BYTE_PAIR(0xEBD3, 0x9086)
+DOUBLE_BYTE_PAIR(0xEBD4, 0x90FA)
+DOUBLE_BYTE_PAIR(0xEBD5, 0x9133)
+DOUBLE_BYTE_PAIR(0xEBD6, 0x9135)
+DOUBLE_BYTE_PAIR(0xEBD7, 0x9136)
+DOUBLE_BYTE_PAIR(0xEBD8, 0x9193)
+DOUBLE_BYTE_PAIR(0xEBD9, 0x9190)
+DOUBLE_BYTE_PAIR(0xEBDA, 0x9191)
+DOUBLE_BYTE_PAIR(0xEBDB, 0x918D)
+DOUBLE_BYTE_PAIR(0xEBDC, 0x918F)
+DOUBLE_BYTE_PAIR(0xEBDD, 0x9327)
+DOUBLE_BYTE_PAIR(0xEBDE, 0x931E)
+DOUBLE_BYTE_PAIR(0xEBDF, 0x9308)
+DOUBLE_BYTE_PAIR(0xEBE0, 0x931F)
+DOUBLE_BYTE_PAIR(0xEBE1, 0x9306)
+DOUBLE_BYTE_PAIR(0xEBE2, 0x930F)
+DOUBLE_BYTE_PAIR(0xEBE3, 0x937A)
+DOUBLE_BYTE_PAIR(0xEBE4, 0x9338)
+DOUBLE_BYTE_PAIR(0xEBE5, 0x933C)
+DOUBLE_BYTE_PAIR(0xEBE6, 0x931B)
+DOUBLE_BYTE_PAIR(0xEBE7, 0x9323)
+DOUBLE_BYTE_PAIR(0xEBE8, 0x9312)
+DOUBLE_BYTE_PAIR(0xEBE9, 0x9301)
+DOUBLE_BYTE_PAIR(0xEBEA, 0x9346)
+DOUBLE_BYTE_PAIR(0xEBEB, 0x932D)
+DOUBLE_BYTE_PAIR(0xEBEC, 0x930E)
+DOUBLE_BYTE_PAIR(0xEBED, 0x930D)
+DOUBLE_BYTE_PAIR(0xEBEE, 0x92CB)
+DOUBLE_BYTE_PAIR(0xEBEF, 0x931D)
+DOUBLE_BYTE_PAIR(0xEBF0, 0x92FA)
+DOUBLE_BYTE_PAIR(0xEBF1, 0x9325)
+DOUBLE_BYTE_PAIR(0xEBF2, 0x9313)
+DOUBLE_BYTE_PAIR(0xEBF3, 0x92F9)
+DOUBLE_BYTE_PAIR(0xEBF4, 0x92F7)
+DOUBLE_BYTE_PAIR(0xEBF5, 0x9334)
+DOUBLE_BYTE_PAIR(0xEBF6, 0x9302)
+DOUBLE_BYTE_PAIR(0xEBF7, 0x9324)
+DOUBLE_BYTE_PAIR(0xEBF8, 0x92FF)
+DOUBLE_BYTE_PAIR(0xEBF9, 0x9329)
+DOUBLE_BYTE_PAIR(0xEBFA, 0x9339)
+DOUBLE_BYTE_PAIR(0xEBFB, 0x9335)
+DOUBLE_BYTE_PAIR(0xEBFC, 0x932A)
+DOUBLE_BYTE_PAIR(0xEBFD, 0x9314)
+DOUBLE_BYTE_PAIR(0xEBFE, 0x930C)
+DOUBLE_BYTE_PAIR(0xEC40, 0x930B)
+DOUBLE_BYTE_PAIR(0xEC41, 0x92FE)
+DOUBLE_BYTE_PAIR(0xEC42, 0x9309)
+DOUBLE_BYTE_PAIR(0xEC43, 0x9300)
+DOUBLE_BYTE_PAIR(0xEC44, 0x92FB)
+DOUBLE_BYTE_PAIR(0xEC45, 0x9316)
+DOUBLE_BYTE_PAIR(0xEC46, 0x95BC)
+DOUBLE_BYTE_PAIR(0xEC47, 0x95CD)
+DOUBLE_BYTE_PAIR(0xEC48, 0x95BE)
+DOUBLE_BYTE_PAIR(0xEC49, 0x95B9)
+DOUBLE_BYTE_PAIR(0xEC4A, 0x95BA)
+DOUBLE_BYTE_PAIR(0xEC4B, 0x95B6)
+DOUBLE_BYTE_PAIR(0xEC4C, 0x95BF)
+DOUBLE_BYTE_PAIR(0xEC4D, 0x95B5)
+DOUBLE_BYTE_PAIR(0xEC4E, 0x95BD)
+DOUBLE_BYTE_PAIR(0xEC4F, 0x96A9)
+DOUBLE_BYTE_PAIR(0xEC50, 0x96D4)
+DOUBLE_BYTE_PAIR(0xEC51, 0x970B)
+DOUBLE_BYTE_PAIR(0xEC52, 0x9712)
+DOUBLE_BYTE_PAIR(0xEC53, 0x9710)
+DOUBLE_BYTE_PAIR(0xEC54, 0x9799)
+DOUBLE_BYTE_PAIR(0xEC55, 0x9797)
+DOUBLE_BYTE_PAIR(0xEC56, 0x9794)
+DOUBLE_BYTE_PAIR(0xEC57, 0x97F0)
+DOUBLE_BYTE_PAIR(0xEC58, 0x97F8)
+DOUBLE_BYTE_PAIR(0xEC59, 0x9835)
+DOUBLE_BYTE_PAIR(0xEC5A, 0x982F)
+DOUBLE_BYTE_PAIR(0xEC5B, 0x9832)
+DOUBLE_BYTE_PAIR(0xEC5C, 0x9924)
+DOUBLE_BYTE_PAIR(0xEC5D, 0x991F)
+DOUBLE_BYTE_PAIR(0xEC5E, 0x9927)
+DOUBLE_BYTE_PAIR(0xEC5F, 0x9929)
+DOUBLE_BYTE_PAIR(0xEC60, 0x999E)
+DOUBLE_BYTE_PAIR(0xEC61, 0x99EE)
+DOUBLE_BYTE_PAIR(0xEC62, 0x99EC)
+DOUBLE_BYTE_PAIR(0xEC63, 0x99E5)
+DOUBLE_BYTE_PAIR(0xEC64, 0x99E4)
+DOUBLE_BYTE_PAIR(0xEC65, 0x99F0)
+DOUBLE_BYTE_PAIR(0xEC66, 0x99E3)
+DOUBLE_BYTE_PAIR(0xEC67, 0x99EA)
+DOUBLE_BYTE_PAIR(0xEC68, 0x99E9)
+DOUBLE_BYTE_PAIR(0xEC69, 0x99E7)
+DOUBLE_BYTE_PAIR(0xEC6A, 0x9AB9)
+DOUBLE_BYTE_PAIR(0xEC6B, 0x9ABF)
+DOUBLE_BYTE_PAIR(0xEC6C, 0x9AB4)
+DOUBLE_BYTE_PAIR(0xEC6D, 0x9ABB)
+DOUBLE_BYTE_PAIR(0xEC6E, 0x9AF6)
+DOUBLE_BYTE_PAIR(0xEC6F, 0x9AFA)
+DOUBLE_BYTE_PAIR(0xEC70, 0x9AF9)
+DOUBLE_BYTE_PAIR(0xEC71, 0x9AF7)
+DOUBLE_BYTE_PAIR(0xEC72, 0x9B33)
+DOUBLE_BYTE_PAIR(0xEC73, 0x9B80)
+DOUBLE_BYTE_PAIR(0xEC74, 0x9B85)
+DOUBLE_BYTE_PAIR(0xEC75, 0x9B87)
+DOUBLE_BYTE_PAIR(0xEC76, 0x9B7C)
+DOUBLE_BYTE_PAIR(0xEC77, 0x9B7E)
+DOUBLE_BYTE_PAIR(0xEC78, 0x9B7B)
+DOUBLE_BYTE_PAIR(0xEC79, 0x9B82)
+DOUBLE_BYTE_PAIR(0xEC7A, 0x9B93)
+DOUBLE_BYTE_PAIR(0xEC7B, 0x9B92)
+DOUBLE_BYTE_PAIR(0xEC7C, 0x9B90)
+DOUBLE_BYTE_PAIR(0xEC7D, 0x9B7A)
+DOUBLE_BYTE_PAIR(0xEC7E, 0x9B95)
+DOUBLE_BYTE_PAIR(0xECA1, 0x9B7D)
+DOUBLE_BYTE_PAIR(0xECA2, 0x9B88)
+DOUBLE_BYTE_PAIR(0xECA3, 0x9D25)
+DOUBLE_BYTE_PAIR(0xECA4, 0x9D17)
+DOUBLE_BYTE_PAIR(0xECA5, 0x9D20)
+DOUBLE_BYTE_PAIR(0xECA6, 0x9D1E)
+DOUBLE_BYTE_PAIR(0xECA7, 0x9D14)
+DOUBLE_BYTE_PAIR(0xECA8, 0x9D29)
+DOUBLE_BYTE_PAIR(0xECA9, 0x9D1D)
+DOUBLE_BYTE_PAIR(0xECAA, 0x9D18)
+DOUBLE_BYTE_PAIR(0xECAB, 0x9D22)
+DOUBLE_BYTE_PAIR(0xECAC, 0x9D10)
+DOUBLE_BYTE_PAIR(0xECAD, 0x9D19)
+DOUBLE_BYTE_PAIR(0xECAE, 0x9D1F)
+DOUBLE_BYTE_PAIR(0xECAF, 0x9E88)
+DOUBLE_BYTE_PAIR(0xECB0, 0x9E86)
+DOUBLE_BYTE_PAIR(0xECB1, 0x9E87)
+DOUBLE_BYTE_PAIR(0xECB2, 0x9EAE)
+DOUBLE_BYTE_PAIR(0xECB3, 0x9EAD)
+DOUBLE_BYTE_PAIR(0xECB4, 0x9ED5)
+DOUBLE_BYTE_PAIR(0xECB5, 0x9ED6)
+DOUBLE_BYTE_PAIR(0xECB6, 0x9EFA)
+DOUBLE_BYTE_PAIR(0xECB7, 0x9F12)
+DOUBLE_BYTE_PAIR(0xECB8, 0x9F3D)
+DOUBLE_BYTE_PAIR(0xECB9, 0x5126)
+DOUBLE_BYTE_PAIR(0xECBA, 0x5125)
+DOUBLE_BYTE_PAIR(0xECBB, 0x5122)
+DOUBLE_BYTE_PAIR(0xECBC, 0x5124)
+DOUBLE_BYTE_PAIR(0xECBD, 0x5120)
+DOUBLE_BYTE_PAIR(0xECBE, 0x5129)
+DOUBLE_BYTE_PAIR(0xECBF, 0x52F4)
+DOUBLE_BYTE_PAIR(0xECC0, 0x5693)
+DOUBLE_BYTE_PAIR(0xECC1, 0x568C)
+DOUBLE_BYTE_PAIR(0xECC2, 0x568D)
+DOUBLE_BYTE_PAIR(0xECC3, 0x5686)
+DOUBLE_BYTE_PAIR(0xECC4, 0x5684)
+DOUBLE_BYTE_PAIR(0xECC5, 0x5683)
+DOUBLE_BYTE_PAIR(0xECC6, 0x567E)
+DOUBLE_BYTE_PAIR(0xECC7, 0x5682)
+DOUBLE_BYTE_PAIR(0xECC8, 0x567F)
+DOUBLE_BYTE_PAIR(0xECC9, 0x5681)
+DOUBLE_BYTE_PAIR(0xECCA, 0x58D6)
+DOUBLE_BYTE_PAIR(0xECCB, 0x58D4)
+DOUBLE_BYTE_PAIR(0xECCC, 0x58CF)
+DOUBLE_BYTE_PAIR(0xECCD, 0x58D2)
+DOUBLE_BYTE_PAIR(0xECCE, 0x5B2D)
+DOUBLE_BYTE_PAIR(0xECCF, 0x5B25)
+DOUBLE_BYTE_PAIR(0xECD0, 0x5B32)
+DOUBLE_BYTE_PAIR(0xECD1, 0x5B23)
+DOUBLE_BYTE_PAIR(0xECD2, 0x5B2C)
+DOUBLE_BYTE_PAIR(0xECD3, 0x5B27)
+DOUBLE_BYTE_PAIR(0xECD4, 0x5B26)
+DOUBLE_BYTE_PAIR(0xECD5, 0x5B2F)
+DOUBLE_BYTE_PAIR(0xECD6, 0x5B2E)
+DOUBLE_BYTE_PAIR(0xECD7, 0x5B7B)
+DOUBLE_BYTE_PAIR(0xECD8, 0x5BF1)
+DOUBLE_BYTE_PAIR(0xECD9, 0x5BF2)
+DOUBLE_BYTE_PAIR(0xECDA, 0x5DB7)
+DOUBLE_BYTE_PAIR(0xECDB, 0x5E6C)
+DOUBLE_BYTE_PAIR(0xECDC, 0x5E6A)
+DOUBLE_BYTE_PAIR(0xECDD, 0x5FBE)
+DOUBLE_BYTE_PAIR(0xECDE, 0x5FBB)
+DOUBLE_BYTE_PAIR(0xECDF, 0x61C3)
+DOUBLE_BYTE_PAIR(0xECE0, 0x61B5)
+DOUBLE_BYTE_PAIR(0xECE1, 0x61BC)
+DOUBLE_BYTE_PAIR(0xECE2, 0x61E7)
+DOUBLE_BYTE_PAIR(0xECE3, 0x61E0)
+DOUBLE_BYTE_PAIR(0xECE4, 0x61E5)
+DOUBLE_BYTE_PAIR(0xECE5, 0x61E4)
+DOUBLE_BYTE_PAIR(0xECE6, 0x61E8)
+DOUBLE_BYTE_PAIR(0xECE7, 0x61DE)
+DOUBLE_BYTE_PAIR(0xECE8, 0x64EF)
+DOUBLE_BYTE_PAIR(0xECE9, 0x64E9)
+DOUBLE_BYTE_PAIR(0xECEA, 0x64E3)
+DOUBLE_BYTE_PAIR(0xECEB, 0x64EB)
+DOUBLE_BYTE_PAIR(0xECEC, 0x64E4)
+DOUBLE_BYTE_PAIR(0xECED, 0x64E8)
+DOUBLE_BYTE_PAIR(0xECEE, 0x6581)
+DOUBLE_BYTE_PAIR(0xECEF, 0x6580)
+DOUBLE_BYTE_PAIR(0xECF0, 0x65B6)
+DOUBLE_BYTE_PAIR(0xECF1, 0x65DA)
+DOUBLE_BYTE_PAIR(0xECF2, 0x66D2)
+DOUBLE_BYTE_PAIR(0xECF3, 0x6A8D)
+DOUBLE_BYTE_PAIR(0xECF4, 0x6A96)
+DOUBLE_BYTE_PAIR(0xECF5, 0x6A81)
+DOUBLE_BYTE_PAIR(0xECF6, 0x6AA5)
+DOUBLE_BYTE_PAIR(0xECF7, 0x6A89)
+DOUBLE_BYTE_PAIR(0xECF8, 0x6A9F)
+DOUBLE_BYTE_PAIR(0xECF9, 0x6A9B)
+DOUBLE_BYTE_PAIR(0xECFA, 0x6AA1)
+DOUBLE_BYTE_PAIR(0xECFB, 0x6A9E)
+DOUBLE_BYTE_PAIR(0xECFC, 0x6A87)
+DOUBLE_BYTE_PAIR(0xECFD, 0x6A93)
+DOUBLE_BYTE_PAIR(0xECFE, 0x6A8E)
+DOUBLE_BYTE_PAIR(0xED40, 0x6A95)
+DOUBLE_BYTE_PAIR(0xED41, 0x6A83)
+DOUBLE_BYTE_PAIR(0xED42, 0x6AA8)
+DOUBLE_BYTE_PAIR(0xED43, 0x6AA4)
+DOUBLE_BYTE_PAIR(0xED44, 0x6A91)
+DOUBLE_BYTE_PAIR(0xED45, 0x6A7F)
+DOUBLE_BYTE_PAIR(0xED46, 0x6AA6)
+DOUBLE_BYTE_PAIR(0xED47, 0x6A9A)
+DOUBLE_BYTE_PAIR(0xED48, 0x6A85)
+DOUBLE_BYTE_PAIR(0xED49, 0x6A8C)
+DOUBLE_BYTE_PAIR(0xED4A, 0x6A92)
+DOUBLE_BYTE_PAIR(0xED4B, 0x6B5B)
+DOUBLE_BYTE_PAIR(0xED4C, 0x6BAD)
+DOUBLE_BYTE_PAIR(0xED4D, 0x6C09)
+DOUBLE_BYTE_PAIR(0xED4E, 0x6FCC)
+DOUBLE_BYTE_PAIR(0xED4F, 0x6FA9)
+DOUBLE_BYTE_PAIR(0xED50, 0x6FF4)
+DOUBLE_BYTE_PAIR(0xED51, 0x6FD4)
+DOUBLE_BYTE_PAIR(0xED52, 0x6FE3)
+DOUBLE_BYTE_PAIR(0xED53, 0x6FDC)
+DOUBLE_BYTE_PAIR(0xED54, 0x6FED)
+DOUBLE_BYTE_PAIR(0xED55, 0x6FE7)
+DOUBLE_BYTE_PAIR(0xED56, 0x6FE6)
+DOUBLE_BYTE_PAIR(0xED57, 0x6FDE)
+DOUBLE_BYTE_PAIR(0xED58, 0x6FF2)
+DOUBLE_BYTE_PAIR(0xED59, 0x6FDD)
+DOUBLE_BYTE_PAIR(0xED5A, 0x6FE2)
+DOUBLE_BYTE_PAIR(0xED5B, 0x6FE8)
+DOUBLE_BYTE_PAIR(0xED5C, 0x71E1)
+DOUBLE_BYTE_PAIR(0xED5D, 0x71F1)
+DOUBLE_BYTE_PAIR(0xED5E, 0x71E8)
+DOUBLE_BYTE_PAIR(0xED5F, 0x71F2)
+DOUBLE_BYTE_PAIR(0xED60, 0x71E4)
+DOUBLE_BYTE_PAIR(0xED61, 0x71F0)
+DOUBLE_BYTE_PAIR(0xED62, 0x71E2)
+DOUBLE_BYTE_PAIR(0xED63, 0x7373)
+DOUBLE_BYTE_PAIR(0xED64, 0x736E)
+DOUBLE_BYTE_PAIR(0xED65, 0x736F)
+DOUBLE_BYTE_PAIR(0xED66, 0x7497)
+DOUBLE_BYTE_PAIR(0xED67, 0x74B2)
+DOUBLE_BYTE_PAIR(0xED68, 0x74AB)
+DOUBLE_BYTE_PAIR(0xED69, 0x7490)
+DOUBLE_BYTE_PAIR(0xED6A, 0x74AA)
+DOUBLE_BYTE_PAIR(0xED6B, 0x74AD)
+DOUBLE_BYTE_PAIR(0xED6C, 0x74B1)
+DOUBLE_BYTE_PAIR(0xED6D, 0x74A5)
+DOUBLE_BYTE_PAIR(0xED6E, 0x74AF)
+DOUBLE_BYTE_PAIR(0xED6F, 0x7510)
+DOUBLE_BYTE_PAIR(0xED70, 0x7511)
+DOUBLE_BYTE_PAIR(0xED71, 0x7512)
+DOUBLE_BYTE_PAIR(0xED72, 0x750F)
+DOUBLE_BYTE_PAIR(0xED73, 0x7584)
+DOUBLE_BYTE_PAIR(0xED74, 0x7643)
+DOUBLE_BYTE_PAIR(0xED75, 0x7648)
+DOUBLE_BYTE_PAIR(0xED76, 0x7649)
+DOUBLE_BYTE_PAIR(0xED77, 0x7647)
+DOUBLE_BYTE_PAIR(0xED78, 0x76A4)
+DOUBLE_BYTE_PAIR(0xED79, 0x76E9)
+DOUBLE_BYTE_PAIR(0xED7A, 0x77B5)
+DOUBLE_BYTE_PAIR(0xED7B, 0x77AB)
+DOUBLE_BYTE_PAIR(0xED7C, 0x77B2)
+DOUBLE_BYTE_PAIR(0xED7D, 0x77B7)
+DOUBLE_BYTE_PAIR(0xED7E, 0x77B6)
+DOUBLE_BYTE_PAIR(0xEDA1, 0x77B4)
+DOUBLE_BYTE_PAIR(0xEDA2, 0x77B1)
+DOUBLE_BYTE_PAIR(0xEDA3, 0x77A8)
+DOUBLE_BYTE_PAIR(0xEDA4, 0x77F0)
+DOUBLE_BYTE_PAIR(0xEDA5, 0x78F3)
+DOUBLE_BYTE_PAIR(0xEDA6, 0x78FD)
+DOUBLE_BYTE_PAIR(0xEDA7, 0x7902)
+DOUBLE_BYTE_PAIR(0xEDA8, 0x78FB)
+DOUBLE_BYTE_PAIR(0xEDA9, 0x78FC)
+DOUBLE_BYTE_PAIR(0xEDAA, 0x78F2)
+DOUBLE_BYTE_PAIR(0xEDAB, 0x7905)
+DOUBLE_BYTE_PAIR(0xEDAC, 0x78F9)
+DOUBLE_BYTE_PAIR(0xEDAD, 0x78FE)
+DOUBLE_BYTE_PAIR(0xEDAE, 0x7904)
+DOUBLE_BYTE_PAIR(0xEDAF, 0x79AB)
+DOUBLE_BYTE_PAIR(0xEDB0, 0x79A8)
+DOUBLE_BYTE_PAIR(0xEDB1, 0x7A5C)
+DOUBLE_BYTE_PAIR(0xEDB2, 0x7A5B)
+DOUBLE_BYTE_PAIR(0xEDB3, 0x7A56)
+DOUBLE_BYTE_PAIR(0xEDB4, 0x7A58)
+DOUBLE_BYTE_PAIR(0xEDB5, 0x7A54)
+DOUBLE_BYTE_PAIR(0xEDB6, 0x7A5A)
+DOUBLE_BYTE_PAIR(0xEDB7, 0x7ABE)
+DOUBLE_BYTE_PAIR(0xEDB8, 0x7AC0)
+DOUBLE_BYTE_PAIR(0xEDB9, 0x7AC1)
+DOUBLE_BYTE_PAIR(0xEDBA, 0x7C05)
+DOUBLE_BYTE_PAIR(0xEDBB, 0x7C0F)
+DOUBLE_BYTE_PAIR(0xEDBC, 0x7BF2)
+DOUBLE_BYTE_PAIR(0xEDBD, 0x7C00)
+DOUBLE_BYTE_PAIR(0xEDBE, 0x7BFF)
+DOUBLE_BYTE_PAIR(0xEDBF, 0x7BFB)
+DOUBLE_BYTE_PAIR(0xEDC0, 0x7C0E)
+DOUBLE_BYTE_PAIR(0xEDC1, 0x7BF4)
+DOUBLE_BYTE_PAIR(0xEDC2, 0x7C0B)
+DOUBLE_BYTE_PAIR(0xEDC3, 0x7BF3)
+DOUBLE_BYTE_PAIR(0xEDC4, 0x7C02)
+DOUBLE_BYTE_PAIR(0xEDC5, 0x7C09)
+DOUBLE_BYTE_PAIR(0xEDC6, 0x7C03)
+DOUBLE_BYTE_PAIR(0xEDC7, 0x7C01)
+DOUBLE_BYTE_PAIR(0xEDC8, 0x7BF8)
+DOUBLE_BYTE_PAIR(0xEDC9, 0x7BFD)
+DOUBLE_BYTE_PAIR(0xEDCA, 0x7C06)
+DOUBLE_BYTE_PAIR(0xEDCB, 0x7BF0)
+DOUBLE_BYTE_PAIR(0xEDCC, 0x7BF1)
+DOUBLE_BYTE_PAIR(0xEDCD, 0x7C10)
+DOUBLE_BYTE_PAIR(0xEDCE, 0x7C0A)
+DOUBLE_BYTE_PAIR(0xEDCF, 0x7CE8)
+DOUBLE_BYTE_PAIR(0xEDD0, 0x7E2D)
+DOUBLE_BYTE_PAIR(0xEDD1, 0x7E3C)
+DOUBLE_BYTE_PAIR(0xEDD2, 0x7E42)
+DOUBLE_BYTE_PAIR(0xEDD3, 0x7E33)
+DOUBLE_BYTE_PAIR(0xEDD4, 0x9848)
+DOUBLE_BYTE_PAIR(0xEDD5, 0x7E38)
+DOUBLE_BYTE_PAIR(0xEDD6, 0x7E2A)
+DOUBLE_BYTE_PAIR(0xEDD7, 0x7E49)
+DOUBLE_BYTE_PAIR(0xEDD8, 0x7E40)
+DOUBLE_BYTE_PAIR(0xEDD9, 0x7E47)
+DOUBLE_BYTE_PAIR(0xEDDA, 0x7E29)
+DOUBLE_BYTE_PAIR(0xEDDB, 0x7E4C)
+DOUBLE_BYTE_PAIR(0xEDDC, 0x7E30)
+DOUBLE_BYTE_PAIR(0xEDDD, 0x7E3B)
+DOUBLE_BYTE_PAIR(0xEDDE, 0x7E36)
+DOUBLE_BYTE_PAIR(0xEDDF, 0x7E44)
+DOUBLE_BYTE_PAIR(0xEDE0, 0x7E3A)
+DOUBLE_BYTE_PAIR(0xEDE1, 0x7F45)
+DOUBLE_BYTE_PAIR(0xEDE2, 0x7F7F)
+DOUBLE_BYTE_PAIR(0xEDE3, 0x7F7E)
+DOUBLE_BYTE_PAIR(0xEDE4, 0x7F7D)
+DOUBLE_BYTE_PAIR(0xEDE5, 0x7FF4)
+DOUBLE_BYTE_PAIR(0xEDE6, 0x7FF2)
+DOUBLE_BYTE_PAIR(0xEDE7, 0x802C)
+DOUBLE_BYTE_PAIR(0xEDE8, 0x81BB)
+DOUBLE_BYTE_PAIR(0xEDE9, 0x81C4)
+DOUBLE_BYTE_PAIR(0xEDEA, 0x81CC)
+DOUBLE_BYTE_PAIR(0xEDEB, 0x81CA)
+DOUBLE_BYTE_PAIR(0xEDEC, 0x81C5)
+DOUBLE_BYTE_PAIR(0xEDED, 0x81C7)
+DOUBLE_BYTE_PAIR(0xEDEE, 0x81BC)
+DOUBLE_BYTE_PAIR(0xEDEF, 0x81E9)
+DOUBLE_BYTE_PAIR(0xEDF0, 0x825B)
+DOUBLE_BYTE_PAIR(0xEDF1, 0x825A)
+DOUBLE_BYTE_PAIR(0xEDF2, 0x825C)
+DOUBLE_BYTE_PAIR(0xEDF3, 0x8583)
+DOUBLE_BYTE_PAIR(0xEDF4, 0x8580)
+DOUBLE_BYTE_PAIR(0xEDF5, 0x858F)
+DOUBLE_BYTE_PAIR(0xEDF6, 0x85A7)
+DOUBLE_BYTE_PAIR(0xEDF7, 0x8595)
+DOUBLE_BYTE_PAIR(0xEDF8, 0x85A0)
+DOUBLE_BYTE_PAIR(0xEDF9, 0x858B)
+DOUBLE_BYTE_PAIR(0xEDFA, 0x85A3)
+DOUBLE_BYTE_PAIR(0xEDFB, 0x857B)
+DOUBLE_BYTE_PAIR(0xEDFC, 0x85A4)
+DOUBLE_BYTE_PAIR(0xEDFD, 0x859A)
+DOUBLE_BYTE_PAIR(0xEDFE, 0x859E)
+DOUBLE_BYTE_PAIR(0xEE40, 0x8577)
+DOUBLE_BYTE_PAIR(0xEE41, 0x857C)
+DOUBLE_BYTE_PAIR(0xEE42, 0x8589)
+DOUBLE_BYTE_PAIR(0xEE43, 0x85A1)
+DOUBLE_BYTE_PAIR(0xEE44, 0x857A)
+DOUBLE_BYTE_PAIR(0xEE45, 0x8578)
+DOUBLE_BYTE_PAIR(0xEE46, 0x8557)
+DOUBLE_BYTE_PAIR(0xEE47, 0x858E)
+DOUBLE_BYTE_PAIR(0xEE48, 0x8596)
+DOUBLE_BYTE_PAIR(0xEE49, 0x8586)
+DOUBLE_BYTE_PAIR(0xEE4A, 0x858D)
+DOUBLE_BYTE_PAIR(0xEE4B, 0x8599)
+DOUBLE_BYTE_PAIR(0xEE4C, 0x859D)
+DOUBLE_BYTE_PAIR(0xEE4D, 0x8581)
+DOUBLE_BYTE_PAIR(0xEE4E, 0x85A2)
+DOUBLE_BYTE_PAIR(0xEE4F, 0x8582)
+DOUBLE_BYTE_PAIR(0xEE50, 0x8588)
+DOUBLE_BYTE_PAIR(0xEE51, 0x8585)
+DOUBLE_BYTE_PAIR(0xEE52, 0x8579)
+DOUBLE_BYTE_PAIR(0xEE53, 0x8576)
+DOUBLE_BYTE_PAIR(0xEE54, 0x8598)
+DOUBLE_BYTE_PAIR(0xEE55, 0x8590)
+DOUBLE_BYTE_PAIR(0xEE56, 0x859F)
+DOUBLE_BYTE_PAIR(0xEE57, 0x8668)
+DOUBLE_BYTE_PAIR(0xEE58, 0x87BE)
+DOUBLE_BYTE_PAIR(0xEE59, 0x87AA)
+DOUBLE_BYTE_PAIR(0xEE5A, 0x87AD)
+DOUBLE_BYTE_PAIR(0xEE5B, 0x87C5)
+DOUBLE_BYTE_PAIR(0xEE5C, 0x87B0)
+DOUBLE_BYTE_PAIR(0xEE5D, 0x87AC)
+DOUBLE_BYTE_PAIR(0xEE5E, 0x87B9)
+DOUBLE_BYTE_PAIR(0xEE5F, 0x87B5)
+DOUBLE_BYTE_PAIR(0xEE60, 0x87BC)
+DOUBLE_BYTE_PAIR(0xEE61, 0x87AE)
+DOUBLE_BYTE_PAIR(0xEE62, 0x87C9)
+DOUBLE_BYTE_PAIR(0xEE63, 0x87C3)
+DOUBLE_BYTE_PAIR(0xEE64, 0x87C2)
+DOUBLE_BYTE_PAIR(0xEE65, 0x87CC)
+DOUBLE_BYTE_PAIR(0xEE66, 0x87B7)
+DOUBLE_BYTE_PAIR(0xEE67, 0x87AF)
+DOUBLE_BYTE_PAIR(0xEE68, 0x87C4)
+DOUBLE_BYTE_PAIR(0xEE69, 0x87CA)
+DOUBLE_BYTE_PAIR(0xEE6A, 0x87B4)
+DOUBLE_BYTE_PAIR(0xEE6B, 0x87B6)
+DOUBLE_BYTE_PAIR(0xEE6C, 0x87BF)
+DOUBLE_BYTE_PAIR(0xEE6D, 0x87B8)
+DOUBLE_BYTE_PAIR(0xEE6E, 0x87BD)
+DOUBLE_BYTE_PAIR(0xEE6F, 0x87DE)
+DOUBLE_BYTE_PAIR(0xEE70, 0x87B2)
+DOUBLE_BYTE_PAIR(0xEE71, 0x8935)
+DOUBLE_BYTE_PAIR(0xEE72, 0x8933)
+DOUBLE_BYTE_PAIR(0xEE73, 0x893C)
+DOUBLE_BYTE_PAIR(0xEE74, 0x893E)
+DOUBLE_BYTE_PAIR(0xEE75, 0x8941)
+DOUBLE_BYTE_PAIR(0xEE76, 0x8952)
+DOUBLE_BYTE_PAIR(0xEE77, 0x8937)
+DOUBLE_BYTE_PAIR(0xEE78, 0x8942)
+DOUBLE_BYTE_PAIR(0xEE79, 0x89AD)
+DOUBLE_BYTE_PAIR(0xEE7A, 0x89AF)
+DOUBLE_BYTE_PAIR(0xEE7B, 0x89AE)
+DOUBLE_BYTE_PAIR(0xEE7C, 0x89F2)
+DOUBLE_BYTE_PAIR(0xEE7D, 0x89F3)
+DOUBLE_BYTE_PAIR(0xEE7E, 0x8B1E)
+DOUBLE_BYTE_PAIR(0xEEA1, 0x8B18)
+DOUBLE_BYTE_PAIR(0xEEA2, 0x8B16)
+DOUBLE_BYTE_PAIR(0xEEA3, 0x8B11)
+DOUBLE_BYTE_PAIR(0xEEA4, 0x8B05)
+DOUBLE_BYTE_PAIR(0xEEA5, 0x8B0B)
+DOUBLE_BYTE_PAIR(0xEEA6, 0x8B22)
+DOUBLE_BYTE_PAIR(0xEEA7, 0x8B0F)
+DOUBLE_BYTE_PAIR(0xEEA8, 0x8B12)
+DOUBLE_BYTE_PAIR(0xEEA9, 0x8B15)
+DOUBLE_BYTE_PAIR(0xEEAA, 0x8B07)
+DOUBLE_BYTE_PAIR(0xEEAB, 0x8B0D)
+DOUBLE_BYTE_PAIR(0xEEAC, 0x8B08)
+DOUBLE_BYTE_PAIR(0xEEAD, 0x8B06)
+DOUBLE_BYTE_PAIR(0xEEAE, 0x8B1C)
+DOUBLE_BYTE_PAIR(0xEEAF, 0x8B13)
+DOUBLE_BYTE_PAIR(0xEEB0, 0x8B1A)
+DOUBLE_BYTE_PAIR(0xEEB1, 0x8C4F)
+DOUBLE_BYTE_PAIR(0xEEB2, 0x8C70)
+DOUBLE_BYTE_PAIR(0xEEB3, 0x8C72)
+DOUBLE_BYTE_PAIR(0xEEB4, 0x8C71)
+DOUBLE_BYTE_PAIR(0xEEB5, 0x8C6F)
+DOUBLE_BYTE_PAIR(0xEEB6, 0x8C95)
+DOUBLE_BYTE_PAIR(0xEEB7, 0x8C94)
+DOUBLE_BYTE_PAIR(0xEEB8, 0x8CF9)
+DOUBLE_BYTE_PAIR(0xEEB9, 0x8D6F)
+DOUBLE_BYTE_PAIR(0xEEBA, 0x8E4E)
+DOUBLE_BYTE_PAIR(0xEEBB, 0x8E4D)
+DOUBLE_BYTE_PAIR(0xEEBC, 0x8E53)
+DOUBLE_BYTE_PAIR(0xEEBD, 0x8E50)
+DOUBLE_BYTE_PAIR(0xEEBE, 0x8E4C)
+DOUBLE_BYTE_PAIR(0xEEBF, 0x8E47)
+DOUBLE_BYTE_PAIR(0xEEC0, 0x8F43)
+DOUBLE_BYTE_PAIR(0xEEC1, 0x8F40)
+DOUBLE_BYTE_PAIR(0xEEC2, 0x9085)
+DOUBLE_BYTE_PAIR(0xEEC3, 0x907E)
+DOUBLE_BYTE_PAIR(0xEEC4, 0x9138)
+DOUBLE_BYTE_PAIR(0xEEC5, 0x919A)
+DOUBLE_BYTE_PAIR(0xEEC6, 0x91A2)
+DOUBLE_BYTE_PAIR(0xEEC7, 0x919B)
+DOUBLE_BYTE_PAIR(0xEEC8, 0x9199)
+DOUBLE_BYTE_PAIR(0xEEC9, 0x919F)
+DOUBLE_BYTE_PAIR(0xEECA, 0x91A1)
+DOUBLE_BYTE_PAIR(0xEECB, 0x919D)
+DOUBLE_BYTE_PAIR(0xEECC, 0x91A0)
+DOUBLE_BYTE_PAIR(0xEECD, 0x93A1)
+DOUBLE_BYTE_PAIR(0xEECE, 0x9383)
+DOUBLE_BYTE_PAIR(0xEECF, 0x93AF)
+DOUBLE_BYTE_PAIR(0xEED0, 0x9364)
+DOUBLE_BYTE_PAIR(0xEED1, 0x9356)
+DOUBLE_BYTE_PAIR(0xEED2, 0x9347)
+DOUBLE_BYTE_PAIR(0xEED3, 0x937C)
+DOUBLE_BYTE_PAIR(0xEED4, 0x9358)
+DOUBLE_BYTE_PAIR(0xEED5, 0x935C)
+DOUBLE_BYTE_PAIR(0xEED6, 0x9376)
+DOUBLE_BYTE_PAIR(0xEED7, 0x9349)
+DOUBLE_BYTE_PAIR(0xEED8, 0x9350)
+DOUBLE_BYTE_PAIR(0xEED9, 0x9351)
+DOUBLE_BYTE_PAIR(0xEEDA, 0x9360)
+DOUBLE_BYTE_PAIR(0xEEDB, 0x936D)
+DOUBLE_BYTE_PAIR(0xEEDC, 0x938F)
+DOUBLE_BYTE_PAIR(0xEEDD, 0x934C)
+DOUBLE_BYTE_PAIR(0xEEDE, 0x936A)
+DOUBLE_BYTE_PAIR(0xEEDF, 0x9379)
+DOUBLE_BYTE_PAIR(0xEEE0, 0x9357)
+DOUBLE_BYTE_PAIR(0xEEE1, 0x9355)
+DOUBLE_BYTE_PAIR(0xEEE2, 0x9352)
+DOUBLE_BYTE_PAIR(0xEEE3, 0x934F)
+DOUBLE_BYTE_PAIR(0xEEE4, 0x9371)
+DOUBLE_BYTE_PAIR(0xEEE5, 0x9377)
+DOUBLE_BYTE_PAIR(0xEEE6, 0x937B)
+DOUBLE_BYTE_PAIR(0xEEE7, 0x9361)
+DOUBLE_BYTE_PAIR(0xEEE8, 0x935E)
+DOUBLE_BYTE_PAIR(0xEEE9, 0x9363)
+DOUBLE_BYTE_PAIR(0xEEEA, 0x9367)
+DOUBLE_BYTE_PAIR(0xEEEB, 0x9380)
+DOUBLE_BYTE_PAIR(0xEEEC, 0x934E)
+DOUBLE_BYTE_PAIR(0xEEED, 0x9359)
+DOUBLE_BYTE_PAIR(0xEEEE, 0x95C7)
+DOUBLE_BYTE_PAIR(0xEEEF, 0x95C0)
+DOUBLE_BYTE_PAIR(0xEEF0, 0x95C9)
+DOUBLE_BYTE_PAIR(0xEEF1, 0x95C3)
+DOUBLE_BYTE_PAIR(0xEEF2, 0x95C5)
+DOUBLE_BYTE_PAIR(0xEEF3, 0x95B7)
+DOUBLE_BYTE_PAIR(0xEEF4, 0x96AE)
+DOUBLE_BYTE_PAIR(0xEEF5, 0x96B0)
+DOUBLE_BYTE_PAIR(0xEEF6, 0x96AC)
+DOUBLE_BYTE_PAIR(0xEEF7, 0x9720)
+DOUBLE_BYTE_PAIR(0xEEF8, 0x971F)
+DOUBLE_BYTE_PAIR(0xEEF9, 0x9718)
+DOUBLE_BYTE_PAIR(0xEEFA, 0x971D)
+DOUBLE_BYTE_PAIR(0xEEFB, 0x9719)
+DOUBLE_BYTE_PAIR(0xEEFC, 0x979A)
+DOUBLE_BYTE_PAIR(0xEEFD, 0x97A1)
+DOUBLE_BYTE_PAIR(0xEEFE, 0x979C)
+DOUBLE_BYTE_PAIR(0xEF40, 0x979E)
+DOUBLE_BYTE_PAIR(0xEF41, 0x979D)
+DOUBLE_BYTE_PAIR(0xEF42, 0x97D5)
+DOUBLE_BYTE_PAIR(0xEF43, 0x97D4)
+DOUBLE_BYTE_PAIR(0xEF44, 0x97F1)
+DOUBLE_BYTE_PAIR(0xEF45, 0x9841)
+DOUBLE_BYTE_PAIR(0xEF46, 0x9844)
+DOUBLE_BYTE_PAIR(0xEF47, 0x984A)
+DOUBLE_BYTE_PAIR(0xEF48, 0x9849)
+DOUBLE_BYTE_PAIR(0xEF49, 0x9845)
+DOUBLE_BYTE_PAIR(0xEF4A, 0x9843)
+DOUBLE_BYTE_PAIR(0xEF4B, 0x9925)
+DOUBLE_BYTE_PAIR(0xEF4C, 0x992B)
+DOUBLE_BYTE_PAIR(0xEF4D, 0x992C)
+DOUBLE_BYTE_PAIR(0xEF4E, 0x992A)
+DOUBLE_BYTE_PAIR(0xEF4F, 0x9933)
+DOUBLE_BYTE_PAIR(0xEF50, 0x9932)
+DOUBLE_BYTE_PAIR(0xEF51, 0x992F)
+DOUBLE_BYTE_PAIR(0xEF52, 0x992D)
+DOUBLE_BYTE_PAIR(0xEF53, 0x9931)
+DOUBLE_BYTE_PAIR(0xEF54, 0x9930)
+DOUBLE_BYTE_PAIR(0xEF55, 0x9998)
+DOUBLE_BYTE_PAIR(0xEF56, 0x99A3)
+DOUBLE_BYTE_PAIR(0xEF57, 0x99A1)
+DOUBLE_BYTE_PAIR(0xEF58, 0x9A02)
+DOUBLE_BYTE_PAIR(0xEF59, 0x99FA)
+DOUBLE_BYTE_PAIR(0xEF5A, 0x99F4)
+DOUBLE_BYTE_PAIR(0xEF5B, 0x99F7)
+DOUBLE_BYTE_PAIR(0xEF5C, 0x99F9)
+DOUBLE_BYTE_PAIR(0xEF5D, 0x99F8)
+DOUBLE_BYTE_PAIR(0xEF5E, 0x99F6)
+DOUBLE_BYTE_PAIR(0xEF5F, 0x99FB)
+DOUBLE_BYTE_PAIR(0xEF60, 0x99FD)
+DOUBLE_BYTE_PAIR(0xEF61, 0x99FE)
+DOUBLE_BYTE_PAIR(0xEF62, 0x99FC)
+DOUBLE_BYTE_PAIR(0xEF63, 0x9A03)
+DOUBLE_BYTE_PAIR(0xEF64, 0x9ABE)
+DOUBLE_BYTE_PAIR(0xEF65, 0x9AFE)
+DOUBLE_BYTE_PAIR(0xEF66, 0x9AFD)
+DOUBLE_BYTE_PAIR(0xEF67, 0x9B01)
+DOUBLE_BYTE_PAIR(0xEF68, 0x9AFC)
+DOUBLE_BYTE_PAIR(0xEF69, 0x9B48)
+DOUBLE_BYTE_PAIR(0xEF6A, 0x9B9A)
+DOUBLE_BYTE_PAIR(0xEF6B, 0x9BA8)
+DOUBLE_BYTE_PAIR(0xEF6C, 0x9B9E)
+DOUBLE_BYTE_PAIR(0xEF6D, 0x9B9B)
+DOUBLE_BYTE_PAIR(0xEF6E, 0x9BA6)
+DOUBLE_BYTE_PAIR(0xEF6F, 0x9BA1)
+DOUBLE_BYTE_PAIR(0xEF70, 0x9BA5)
+DOUBLE_BYTE_PAIR(0xEF71, 0x9BA4)
+DOUBLE_BYTE_PAIR(0xEF72, 0x9B86)
+DOUBLE_BYTE_PAIR(0xEF73, 0x9BA2)
+DOUBLE_BYTE_PAIR(0xEF74, 0x9BA0)
+DOUBLE_BYTE_PAIR(0xEF75, 0x9BAF)
+DOUBLE_BYTE_PAIR(0xEF76, 0x9D33)
+DOUBLE_BYTE_PAIR(0xEF77, 0x9D41)
+DOUBLE_BYTE_PAIR(0xEF78, 0x9D67)
+DOUBLE_BYTE_PAIR(0xEF79, 0x9D36)
+DOUBLE_BYTE_PAIR(0xEF7A, 0x9D2E)
+DOUBLE_BYTE_PAIR(0xEF7B, 0x9D2F)
+DOUBLE_BYTE_PAIR(0xEF7C, 0x9D31)
+DOUBLE_BYTE_PAIR(0xEF7D, 0x9D38)
+DOUBLE_BYTE_PAIR(0xEF7E, 0x9D30)
+DOUBLE_BYTE_PAIR(0xEFA1, 0x9D45)
+DOUBLE_BYTE_PAIR(0xEFA2, 0x9D42)
+DOUBLE_BYTE_PAIR(0xEFA3, 0x9D43)
+DOUBLE_BYTE_PAIR(0xEFA4, 0x9D3E)
+DOUBLE_BYTE_PAIR(0xEFA5, 0x9D37)
+DOUBLE_BYTE_PAIR(0xEFA6, 0x9D40)
+DOUBLE_BYTE_PAIR(0xEFA7, 0x9D3D)
+DOUBLE_BYTE_PAIR(0xEFA8, 0x7FF5)
+DOUBLE_BYTE_PAIR(0xEFA9, 0x9D2D)
+DOUBLE_BYTE_PAIR(0xEFAA, 0x9E8A)
+DOUBLE_BYTE_PAIR(0xEFAB, 0x9E89)
+DOUBLE_BYTE_PAIR(0xEFAC, 0x9E8D)
+DOUBLE_BYTE_PAIR(0xEFAD, 0x9EB0)
+DOUBLE_BYTE_PAIR(0xEFAE, 0x9EC8)
+DOUBLE_BYTE_PAIR(0xEFAF, 0x9EDA)
+DOUBLE_BYTE_PAIR(0xEFB0, 0x9EFB)
+DOUBLE_BYTE_PAIR(0xEFB1, 0x9EFF)
+DOUBLE_BYTE_PAIR(0xEFB2, 0x9F24)
+DOUBLE_BYTE_PAIR(0xEFB3, 0x9F23)
+DOUBLE_BYTE_PAIR(0xEFB4, 0x9F22)
+DOUBLE_BYTE_PAIR(0xEFB5, 0x9F54)
+DOUBLE_BYTE_PAIR(0xEFB6, 0x9FA0)
+DOUBLE_BYTE_PAIR(0xEFB7, 0x5131)
+DOUBLE_BYTE_PAIR(0xEFB8, 0x512D)
+DOUBLE_BYTE_PAIR(0xEFB9, 0x512E)
+DOUBLE_BYTE_PAIR(0xEFBA, 0x5698)
+DOUBLE_BYTE_PAIR(0xEFBB, 0x569C)
+DOUBLE_BYTE_PAIR(0xEFBC, 0x5697)
+DOUBLE_BYTE_PAIR(0xEFBD, 0x569A)
+DOUBLE_BYTE_PAIR(0xEFBE, 0x569D)
+DOUBLE_BYTE_PAIR(0xEFBF, 0x5699)
+DOUBLE_BYTE_PAIR(0xEFC0, 0x5970)
+DOUBLE_BYTE_PAIR(0xEFC1, 0x5B3C)
+DOUBLE_BYTE_PAIR(0xEFC2, 0x5C69)
+DOUBLE_BYTE_PAIR(0xEFC3, 0x5C6A)
+DOUBLE_BYTE_PAIR(0xEFC4, 0x5DC0)
+DOUBLE_BYTE_PAIR(0xEFC5, 0x5E6D)
+DOUBLE_BYTE_PAIR(0xEFC6, 0x5E6E)
+DOUBLE_BYTE_PAIR(0xEFC7, 0x61D8)
+DOUBLE_BYTE_PAIR(0xEFC8, 0x61DF)
+DOUBLE_BYTE_PAIR(0xEFC9, 0x61ED)
+DOUBLE_BYTE_PAIR(0xEFCA, 0x61EE)
+DOUBLE_BYTE_PAIR(0xEFCB, 0x61F1)
+DOUBLE_BYTE_PAIR(0xEFCC, 0x61EA)
+DOUBLE_BYTE_PAIR(0xEFCD, 0x61F0)
+DOUBLE_BYTE_PAIR(0xEFCE, 0x61EB)
+DOUBLE_BYTE_PAIR(0xEFCF, 0x61D6)
+DOUBLE_BYTE_PAIR(0xEFD0, 0x61E9)
+DOUBLE_BYTE_PAIR(0xEFD1, 0x64FF)
+DOUBLE_BYTE_PAIR(0xEFD2, 0x6504)
+DOUBLE_BYTE_PAIR(0xEFD3, 0x64FD)
+DOUBLE_BYTE_PAIR(0xEFD4, 0x64F8)
+DOUBLE_BYTE_PAIR(0xEFD5, 0x6501)
+DOUBLE_BYTE_PAIR(0xEFD6, 0x6503)
+DOUBLE_BYTE_PAIR(0xEFD7, 0x64FC)
+DOUBLE_BYTE_PAIR(0xEFD8, 0x6594)
+DOUBLE_BYTE_PAIR(0xEFD9, 0x65DB)
+DOUBLE_BYTE_PAIR(0xEFDA, 0x66DA)
+DOUBLE_BYTE_PAIR(0xEFDB, 0x66DB)
+DOUBLE_BYTE_PAIR(0xEFDC, 0x66D8)
+DOUBLE_BYTE_PAIR(0xEFDD, 0x6AC5)
+DOUBLE_BYTE_PAIR(0xEFDE, 0x6AB9)
+DOUBLE_BYTE_PAIR(0xEFDF, 0x6ABD)
+DOUBLE_BYTE_PAIR(0xEFE0, 0x6AE1)
+DOUBLE_BYTE_PAIR(0xEFE1, 0x6AC6)
+DOUBLE_BYTE_PAIR(0xEFE2, 0x6ABA)
+DOUBLE_BYTE_PAIR(0xEFE3, 0x6AB6)
+DOUBLE_BYTE_PAIR(0xEFE4, 0x6AB7)
+DOUBLE_BYTE_PAIR(0xEFE5, 0x6AC7)
+DOUBLE_BYTE_PAIR(0xEFE6, 0x6AB4)
+DOUBLE_BYTE_PAIR(0xEFE7, 0x6AAD)
+DOUBLE_BYTE_PAIR(0xEFE8, 0x6B5E)
+DOUBLE_BYTE_PAIR(0xEFE9, 0x6BC9)
+DOUBLE_BYTE_PAIR(0xEFEA, 0x6C0B)
+DOUBLE_BYTE_PAIR(0xEFEB, 0x7007)
+DOUBLE_BYTE_PAIR(0xEFEC, 0x700C)
+DOUBLE_BYTE_PAIR(0xEFED, 0x700D)
+DOUBLE_BYTE_PAIR(0xEFEE, 0x7001)
+DOUBLE_BYTE_PAIR(0xEFEF, 0x7005)
+DOUBLE_BYTE_PAIR(0xEFF0, 0x7014)
+DOUBLE_BYTE_PAIR(0xEFF1, 0x700E)
+DOUBLE_BYTE_PAIR(0xEFF2, 0x6FFF)
+DOUBLE_BYTE_PAIR(0xEFF3, 0x7000)
+DOUBLE_BYTE_PAIR(0xEFF4, 0x6FFB)
+DOUBLE_BYTE_PAIR(0xEFF5, 0x7026)
+DOUBLE_BYTE_PAIR(0xEFF6, 0x6FFC)
+DOUBLE_BYTE_PAIR(0xEFF7, 0x6FF7)
+DOUBLE_BYTE_PAIR(0xEFF8, 0x700A)
+DOUBLE_BYTE_PAIR(0xEFF9, 0x7201)
+DOUBLE_BYTE_PAIR(0xEFFA, 0x71FF)
+DOUBLE_BYTE_PAIR(0xEFFB, 0x71F9)
+DOUBLE_BYTE_PAIR(0xEFFC, 0x7203)
+DOUBLE_BYTE_PAIR(0xEFFD, 0x71FD)
+DOUBLE_BYTE_PAIR(0xEFFE, 0x7376)
+DOUBLE_BYTE_PAIR(0xF040, 0x74B8)
+DOUBLE_BYTE_PAIR(0xF041, 0x74C0)
+DOUBLE_BYTE_PAIR(0xF042, 0x74B5)
+DOUBLE_BYTE_PAIR(0xF043, 0x74C1)
+DOUBLE_BYTE_PAIR(0xF044, 0x74BE)
+DOUBLE_BYTE_PAIR(0xF045, 0x74B6)
+DOUBLE_BYTE_PAIR(0xF046, 0x74BB)
+DOUBLE_BYTE_PAIR(0xF047, 0x74C2)
+DOUBLE_BYTE_PAIR(0xF048, 0x7514)
+DOUBLE_BYTE_PAIR(0xF049, 0x7513)
+DOUBLE_BYTE_PAIR(0xF04A, 0x765C)
+DOUBLE_BYTE_PAIR(0xF04B, 0x7664)
+DOUBLE_BYTE_PAIR(0xF04C, 0x7659)
+DOUBLE_BYTE_PAIR(0xF04D, 0x7650)
+DOUBLE_BYTE_PAIR(0xF04E, 0x7653)
+DOUBLE_BYTE_PAIR(0xF04F, 0x7657)
+DOUBLE_BYTE_PAIR(0xF050, 0x765A)
+DOUBLE_BYTE_PAIR(0xF051, 0x76A6)
+DOUBLE_BYTE_PAIR(0xF052, 0x76BD)
+DOUBLE_BYTE_PAIR(0xF053, 0x76EC)
+DOUBLE_BYTE_PAIR(0xF054, 0x77C2)
+DOUBLE_BYTE_PAIR(0xF055, 0x77BA)
+DOUBLE_BYTE_PAIR(0xF056, 0x78FF)
+DOUBLE_BYTE_PAIR(0xF057, 0x790C)
+DOUBLE_BYTE_PAIR(0xF058, 0x7913)
+DOUBLE_BYTE_PAIR(0xF059, 0x7914)
+DOUBLE_BYTE_PAIR(0xF05A, 0x7909)
+DOUBLE_BYTE_PAIR(0xF05B, 0x7910)
+DOUBLE_BYTE_PAIR(0xF05C, 0x7912)
+DOUBLE_BYTE_PAIR(0xF05D, 0x7911)
+DOUBLE_BYTE_PAIR(0xF05E, 0x79AD)
+DOUBLE_BYTE_PAIR(0xF05F, 0x79AC)
+DOUBLE_BYTE_PAIR(0xF060, 0x7A5F)
+DOUBLE_BYTE_PAIR(0xF061, 0x7C1C)
+DOUBLE_BYTE_PAIR(0xF062, 0x7C29)
+DOUBLE_BYTE_PAIR(0xF063, 0x7C19)
+DOUBLE_BYTE_PAIR(0xF064, 0x7C20)
+DOUBLE_BYTE_PAIR(0xF065, 0x7C1F)
+DOUBLE_BYTE_PAIR(0xF066, 0x7C2D)
+DOUBLE_BYTE_PAIR(0xF067, 0x7C1D)
+DOUBLE_BYTE_PAIR(0xF068, 0x7C26)
+DOUBLE_BYTE_PAIR(0xF069, 0x7C28)
+DOUBLE_BYTE_PAIR(0xF06A, 0x7C22)
+DOUBLE_BYTE_PAIR(0xF06B, 0x7C25)
+DOUBLE_BYTE_PAIR(0xF06C, 0x7C30)
+DOUBLE_BYTE_PAIR(0xF06D, 0x7E5C)
+DOUBLE_BYTE_PAIR(0xF06E, 0x7E50)
+DOUBLE_BYTE_PAIR(0xF06F, 0x7E56)
+DOUBLE_BYTE_PAIR(0xF070, 0x7E63)
+DOUBLE_BYTE_PAIR(0xF071, 0x7E58)
+DOUBLE_BYTE_PAIR(0xF072, 0x7E62)
+DOUBLE_BYTE_PAIR(0xF073, 0x7E5F)
+DOUBLE_BYTE_PAIR(0xF074, 0x7E51)
+DOUBLE_BYTE_PAIR(0xF075, 0x7E60)
+DOUBLE_BYTE_PAIR(0xF076, 0x7E57)
+DOUBLE_BYTE_PAIR(0xF077, 0x7E53)
+DOUBLE_BYTE_PAIR(0xF078, 0x7FB5)
+DOUBLE_BYTE_PAIR(0xF079, 0x7FB3)
+DOUBLE_BYTE_PAIR(0xF07A, 0x7FF7)
+DOUBLE_BYTE_PAIR(0xF07B, 0x7FF8)
+DOUBLE_BYTE_PAIR(0xF07C, 0x8075)
+DOUBLE_BYTE_PAIR(0xF07D, 0x81D1)
+DOUBLE_BYTE_PAIR(0xF07E, 0x81D2)
+DOUBLE_BYTE_PAIR(0xF0A1, 0x81D0)
+DOUBLE_BYTE_PAIR(0xF0A2, 0x825F)
+DOUBLE_BYTE_PAIR(0xF0A3, 0x825E)
+DOUBLE_BYTE_PAIR(0xF0A4, 0x85B4)
+DOUBLE_BYTE_PAIR(0xF0A5, 0x85C6)
+DOUBLE_BYTE_PAIR(0xF0A6, 0x85C0)
+DOUBLE_BYTE_PAIR(0xF0A7, 0x85C3)
+DOUBLE_BYTE_PAIR(0xF0A8, 0x85C2)
+DOUBLE_BYTE_PAIR(0xF0A9, 0x85B3)
+DOUBLE_BYTE_PAIR(0xF0AA, 0x85B5)
+DOUBLE_BYTE_PAIR(0xF0AB, 0x85BD)
+DOUBLE_BYTE_PAIR(0xF0AC, 0x85C7)
+DOUBLE_BYTE_PAIR(0xF0AD, 0x85C4)
+DOUBLE_BYTE_PAIR(0xF0AE, 0x85BF)
+DOUBLE_BYTE_PAIR(0xF0AF, 0x85CB)
+DOUBLE_BYTE_PAIR(0xF0B0, 0x85CE)
+DOUBLE_BYTE_PAIR(0xF0B1, 0x85C8)
+DOUBLE_BYTE_PAIR(0xF0B2, 0x85C5)
+DOUBLE_BYTE_PAIR(0xF0B3, 0x85B1)
+DOUBLE_BYTE_PAIR(0xF0B4, 0x85B6)
+DOUBLE_BYTE_PAIR(0xF0B5, 0x85D2)
+DOUBLE_BYTE_PAIR(0xF0B6, 0x8624)
+DOUBLE_BYTE_PAIR(0xF0B7, 0x85B8)
+DOUBLE_BYTE_PAIR(0xF0B8, 0x85B7)
+DOUBLE_BYTE_PAIR(0xF0B9, 0x85BE)
+DOUBLE_BYTE_PAIR(0xF0BA, 0x8669)
+DOUBLE_BYTE_PAIR(0xF0BB, 0x87E7)
+DOUBLE_BYTE_PAIR(0xF0BC, 0x87E6)
+DOUBLE_BYTE_PAIR(0xF0BD, 0x87E2)
+DOUBLE_BYTE_PAIR(0xF0BE, 0x87DB)
+DOUBLE_BYTE_PAIR(0xF0BF, 0x87EB)
+DOUBLE_BYTE_PAIR(0xF0C0, 0x87EA)
+DOUBLE_BYTE_PAIR(0xF0C1, 0x87E5)
+DOUBLE_BYTE_PAIR(0xF0C2, 0x87DF)
+DOUBLE_BYTE_PAIR(0xF0C3, 0x87F3)
+DOUBLE_BYTE_PAIR(0xF0C4, 0x87E4)
+DOUBLE_BYTE_PAIR(0xF0C5, 0x87D4)
+DOUBLE_BYTE_PAIR(0xF0C6, 0x87DC)
+DOUBLE_BYTE_PAIR(0xF0C7, 0x87D3)
+DOUBLE_BYTE_PAIR(0xF0C8, 0x87ED)
+DOUBLE_BYTE_PAIR(0xF0C9, 0x87D8)
+DOUBLE_BYTE_PAIR(0xF0CA, 0x87E3)
+DOUBLE_BYTE_PAIR(0xF0CB, 0x87A4)
+DOUBLE_BYTE_PAIR(0xF0CC, 0x87D7)
+DOUBLE_BYTE_PAIR(0xF0CD, 0x87D9)
+DOUBLE_BYTE_PAIR(0xF0CE, 0x8801)
+DOUBLE_BYTE_PAIR(0xF0CF, 0x87F4)
+DOUBLE_BYTE_PAIR(0xF0D0, 0x87E8)
+DOUBLE_BYTE_PAIR(0xF0D1, 0x87DD)
+DOUBLE_BYTE_PAIR(0xF0D2, 0x8953)
+DOUBLE_BYTE_PAIR(0xF0D3, 0x894B)
+DOUBLE_BYTE_PAIR(0xF0D4, 0x894F)
+DOUBLE_BYTE_PAIR(0xF0D5, 0x894C)
+DOUBLE_BYTE_PAIR(0xF0D6, 0x8946)
+DOUBLE_BYTE_PAIR(0xF0D7, 0x8950)
+DOUBLE_BYTE_PAIR(0xF0D8, 0x8951)
+DOUBLE_BYTE_PAIR(0xF0D9, 0x8949)
+DOUBLE_BYTE_PAIR(0xF0DA, 0x8B2A)
+DOUBLE_BYTE_PAIR(0xF0DB, 0x8B27)
+DOUBLE_BYTE_PAIR(0xF0DC, 0x8B23)
+DOUBLE_BYTE_PAIR(0xF0DD, 0x8B33)
+DOUBLE_BYTE_PAIR(0xF0DE, 0x8B30)
+DOUBLE_BYTE_PAIR(0xF0DF, 0x8B35)
+DOUBLE_BYTE_PAIR(0xF0E0, 0x8B47)
+DOUBLE_BYTE_PAIR(0xF0E1, 0x8B2F)
+DOUBLE_BYTE_PAIR(0xF0E2, 0x8B3C)
+DOUBLE_BYTE_PAIR(0xF0E3, 0x8B3E)
+DOUBLE_BYTE_PAIR(0xF0E4, 0x8B31)
+DOUBLE_BYTE_PAIR(0xF0E5, 0x8B25)
+DOUBLE_BYTE_PAIR(0xF0E6, 0x8B37)
+DOUBLE_BYTE_PAIR(0xF0E7, 0x8B26)
+DOUBLE_BYTE_PAIR(0xF0E8, 0x8B36)
+DOUBLE_BYTE_PAIR(0xF0E9, 0x8B2E)
+DOUBLE_BYTE_PAIR(0xF0EA, 0x8B24)
+DOUBLE_BYTE_PAIR(0xF0EB, 0x8B3B)
+DOUBLE_BYTE_PAIR(0xF0EC, 0x8B3D)
+DOUBLE_BYTE_PAIR(0xF0ED, 0x8B3A)
+DOUBLE_BYTE_PAIR(0xF0EE, 0x8C42)
+DOUBLE_BYTE_PAIR(0xF0EF, 0x8C75)
+DOUBLE_BYTE_PAIR(0xF0F0, 0x8C99)
+DOUBLE_BYTE_PAIR(0xF0F1, 0x8C98)
+DOUBLE_BYTE_PAIR(0xF0F2, 0x8C97)
+DOUBLE_BYTE_PAIR(0xF0F3, 0x8CFE)
+DOUBLE_BYTE_PAIR(0xF0F4, 0x8D04)
+DOUBLE_BYTE_PAIR(0xF0F5, 0x8D02)
+DOUBLE_BYTE_PAIR(0xF0F6, 0x8D00)
+DOUBLE_BYTE_PAIR(0xF0F7, 0x8E5C)
+DOUBLE_BYTE_PAIR(0xF0F8, 0x8E62)
+DOUBLE_BYTE_PAIR(0xF0F9, 0x8E60)
+DOUBLE_BYTE_PAIR(0xF0FA, 0x8E57)
+DOUBLE_BYTE_PAIR(0xF0FB, 0x8E56)
+DOUBLE_BYTE_PAIR(0xF0FC, 0x8E5E)
+DOUBLE_BYTE_PAIR(0xF0FD, 0x8E65)
+DOUBLE_BYTE_PAIR(0xF0FE, 0x8E67)
+DOUBLE_BYTE_PAIR(0xF140, 0x8E5B)
+DOUBLE_BYTE_PAIR(0xF141, 0x8E5A)
+DOUBLE_BYTE_PAIR(0xF142, 0x8E61)
+DOUBLE_BYTE_PAIR(0xF143, 0x8E5D)
+DOUBLE_BYTE_PAIR(0xF144, 0x8E69)
+DOUBLE_BYTE_PAIR(0xF145, 0x8E54)
+DOUBLE_BYTE_PAIR(0xF146, 0x8F46)
+DOUBLE_BYTE_PAIR(0xF147, 0x8F47)
+DOUBLE_BYTE_PAIR(0xF148, 0x8F48)
+DOUBLE_BYTE_PAIR(0xF149, 0x8F4B)
+DOUBLE_BYTE_PAIR(0xF14A, 0x9128)
+DOUBLE_BYTE_PAIR(0xF14B, 0x913A)
+DOUBLE_BYTE_PAIR(0xF14C, 0x913B)
+DOUBLE_BYTE_PAIR(0xF14D, 0x913E)
+DOUBLE_BYTE_PAIR(0xF14E, 0x91A8)
+DOUBLE_BYTE_PAIR(0xF14F, 0x91A5)
+DOUBLE_BYTE_PAIR(0xF150, 0x91A7)
+DOUBLE_BYTE_PAIR(0xF151, 0x91AF)
+DOUBLE_BYTE_PAIR(0xF152, 0x91AA)
+DOUBLE_BYTE_PAIR(0xF153, 0x93B5)
+DOUBLE_BYTE_PAIR(0xF154, 0x938C)
+DOUBLE_BYTE_PAIR(0xF155, 0x9392)
+DOUBLE_BYTE_PAIR(0xF156, 0x93B7)
+DOUBLE_BYTE_PAIR(0xF157, 0x939B)
+DOUBLE_BYTE_PAIR(0xF158, 0x939D)
+DOUBLE_BYTE_PAIR(0xF159, 0x9389)
+DOUBLE_BYTE_PAIR(0xF15A, 0x93A7)
+DOUBLE_BYTE_PAIR(0xF15B, 0x938E)
+DOUBLE_BYTE_PAIR(0xF15C, 0x93AA)
+DOUBLE_BYTE_PAIR(0xF15D, 0x939E)
+DOUBLE_BYTE_PAIR(0xF15E, 0x93A6)
+DOUBLE_BYTE_PAIR(0xF15F, 0x9395)
+DOUBLE_BYTE_PAIR(0xF160, 0x9388)
+DOUBLE_BYTE_PAIR(0xF161, 0x9399)
+DOUBLE_BYTE_PAIR(0xF162, 0x939F)
+DOUBLE_BYTE_PAIR(0xF163, 0x938D)
+DOUBLE_BYTE_PAIR(0xF164, 0x93B1)
+DOUBLE_BYTE_PAIR(0xF165, 0x9391)
+DOUBLE_BYTE_PAIR(0xF166, 0x93B2)
+DOUBLE_BYTE_PAIR(0xF167, 0x93A4)
+DOUBLE_BYTE_PAIR(0xF168, 0x93A8)
+DOUBLE_BYTE_PAIR(0xF169, 0x93B4)
+DOUBLE_BYTE_PAIR(0xF16A, 0x93A3)
+DOUBLE_BYTE_PAIR(0xF16B, 0x93A5)
+DOUBLE_BYTE_PAIR(0xF16C, 0x95D2)
+DOUBLE_BYTE_PAIR(0xF16D, 0x95D3)
+DOUBLE_BYTE_PAIR(0xF16E, 0x95D1)
+DOUBLE_BYTE_PAIR(0xF16F, 0x96B3)
+DOUBLE_BYTE_PAIR(0xF170, 0x96D7)
+DOUBLE_BYTE_PAIR(0xF171, 0x96DA)
+DOUBLE_BYTE_PAIR(0xF172, 0x5DC2)
+DOUBLE_BYTE_PAIR(0xF173, 0x96DF)
+DOUBLE_BYTE_PAIR(0xF174, 0x96D8)
+DOUBLE_BYTE_PAIR(0xF175, 0x96DD)
+DOUBLE_BYTE_PAIR(0xF176, 0x9723)
+DOUBLE_BYTE_PAIR(0xF177, 0x9722)
+DOUBLE_BYTE_PAIR(0xF178, 0x9725)
+DOUBLE_BYTE_PAIR(0xF179, 0x97AC)
+DOUBLE_BYTE_PAIR(0xF17A, 0x97AE)
+DOUBLE_BYTE_PAIR(0xF17B, 0x97A8)
+DOUBLE_BYTE_PAIR(0xF17C, 0x97AB)
+DOUBLE_BYTE_PAIR(0xF17D, 0x97A4)
+DOUBLE_BYTE_PAIR(0xF17E, 0x97AA)
+DOUBLE_BYTE_PAIR(0xF1A1, 0x97A2)
+DOUBLE_BYTE_PAIR(0xF1A2, 0x97A5)
+DOUBLE_BYTE_PAIR(0xF1A3, 0x97D7)
+DOUBLE_BYTE_PAIR(0xF1A4, 0x97D9)
+DOUBLE_BYTE_PAIR(0xF1A5, 0x97D6)
+DOUBLE_BYTE_PAIR(0xF1A6, 0x97D8)
+DOUBLE_BYTE_PAIR(0xF1A7, 0x97FA)
+DOUBLE_BYTE_PAIR(0xF1A8, 0x9850)
+DOUBLE_BYTE_PAIR(0xF1A9, 0x9851)
+DOUBLE_BYTE_PAIR(0xF1AA, 0x9852)
+DOUBLE_BYTE_PAIR(0xF1AB, 0x98B8)
+DOUBLE_BYTE_PAIR(0xF1AC, 0x9941)
+DOUBLE_BYTE_PAIR(0xF1AD, 0x993C)
+DOUBLE_BYTE_PAIR(0xF1AE, 0x993A)
+DOUBLE_BYTE_PAIR(0xF1AF, 0x9A0F)
+DOUBLE_BYTE_PAIR(0xF1B0, 0x9A0B)
+DOUBLE_BYTE_PAIR(0xF1B1, 0x9A09)
+DOUBLE_BYTE_PAIR(0xF1B2, 0x9A0D)
+DOUBLE_BYTE_PAIR(0xF1B3, 0x9A04)
+DOUBLE_BYTE_PAIR(0xF1B4, 0x9A11)
+DOUBLE_BYTE_PAIR(0xF1B5, 0x9A0A)
+DOUBLE_BYTE_PAIR(0xF1B6, 0x9A05)
+DOUBLE_BYTE_PAIR(0xF1B7, 0x9A07)
+DOUBLE_BYTE_PAIR(0xF1B8, 0x9A06)
+DOUBLE_BYTE_PAIR(0xF1B9, 0x9AC0)
+DOUBLE_BYTE_PAIR(0xF1BA, 0x9ADC)
+DOUBLE_BYTE_PAIR(0xF1BB, 0x9B08)
+DOUBLE_BYTE_PAIR(0xF1BC, 0x9B04)
+DOUBLE_BYTE_PAIR(0xF1BD, 0x9B05)
+DOUBLE_BYTE_PAIR(0xF1BE, 0x9B29)
+DOUBLE_BYTE_PAIR(0xF1BF, 0x9B35)
+DOUBLE_BYTE_PAIR(0xF1C0, 0x9B4A)
+DOUBLE_BYTE_PAIR(0xF1C1, 0x9B4C)
+DOUBLE_BYTE_PAIR(0xF1C2, 0x9B4B)
+DOUBLE_BYTE_PAIR(0xF1C3, 0x9BC7)
+DOUBLE_BYTE_PAIR(0xF1C4, 0x9BC6)
+DOUBLE_BYTE_PAIR(0xF1C5, 0x9BC3)
+DOUBLE_BYTE_PAIR(0xF1C6, 0x9BBF)
+DOUBLE_BYTE_PAIR(0xF1C7, 0x9BC1)
+DOUBLE_BYTE_PAIR(0xF1C8, 0x9BB5)
+DOUBLE_BYTE_PAIR(0xF1C9, 0x9BB8)
+DOUBLE_BYTE_PAIR(0xF1CA, 0x9BD3)
+DOUBLE_BYTE_PAIR(0xF1CB, 0x9BB6)
+DOUBLE_BYTE_PAIR(0xF1CC, 0x9BC4)
+DOUBLE_BYTE_PAIR(0xF1CD, 0x9BB9)
+DOUBLE_BYTE_PAIR(0xF1CE, 0x9BBD)
+DOUBLE_BYTE_PAIR(0xF1CF, 0x9D5C)
+DOUBLE_BYTE_PAIR(0xF1D0, 0x9D53)
+DOUBLE_BYTE_PAIR(0xF1D1, 0x9D4F)
+DOUBLE_BYTE_PAIR(0xF1D2, 0x9D4A)
+DOUBLE_BYTE_PAIR(0xF1D3, 0x9D5B)
+DOUBLE_BYTE_PAIR(0xF1D4, 0x9D4B)
+DOUBLE_BYTE_PAIR(0xF1D5, 0x9D59)
+DOUBLE_BYTE_PAIR(0xF1D6, 0x9D56)
+DOUBLE_BYTE_PAIR(0xF1D7, 0x9D4C)
+DOUBLE_BYTE_PAIR(0xF1D8, 0x9D57)
+DOUBLE_BYTE_PAIR(0xF1D9, 0x9D52)
+DOUBLE_BYTE_PAIR(0xF1DA, 0x9D54)
+DOUBLE_BYTE_PAIR(0xF1DB, 0x9D5F)
+DOUBLE_BYTE_PAIR(0xF1DC, 0x9D58)
+DOUBLE_BYTE_PAIR(0xF1DD, 0x9D5A)
+DOUBLE_BYTE_PAIR(0xF1DE, 0x9E8E)
+DOUBLE_BYTE_PAIR(0xF1DF, 0x9E8C)
+DOUBLE_BYTE_PAIR(0xF1E0, 0x9EDF)
+DOUBLE_BYTE_PAIR(0xF1E1, 0x9F01)
+DOUBLE_BYTE_PAIR(0xF1E2, 0x9F00)
+DOUBLE_BYTE_PAIR(0xF1E3, 0x9F16)
+DOUBLE_BYTE_PAIR(0xF1E4, 0x9F25)
+DOUBLE_BYTE_PAIR(0xF1E5, 0x9F2B)
+DOUBLE_BYTE_PAIR(0xF1E6, 0x9F2A)
+DOUBLE_BYTE_PAIR(0xF1E7, 0x9F29)
+DOUBLE_BYTE_PAIR(0xF1E8, 0x9F28)
+DOUBLE_BYTE_PAIR(0xF1E9, 0x9F4C)
+DOUBLE_BYTE_PAIR(0xF1EA, 0x9F55)
+DOUBLE_BYTE_PAIR(0xF1EB, 0x5134)
+DOUBLE_BYTE_PAIR(0xF1EC, 0x5135)
+DOUBLE_BYTE_PAIR(0xF1ED, 0x5296)
+DOUBLE_BYTE_PAIR(0xF1EE, 0x52F7)
+DOUBLE_BYTE_PAIR(0xF1EF, 0x53B4)
+DOUBLE_BYTE_PAIR(0xF1F0, 0x56AB)
+DOUBLE_BYTE_PAIR(0xF1F1, 0x56AD)
+DOUBLE_BYTE_PAIR(0xF1F2, 0x56A6)
+DOUBLE_BYTE_PAIR(0xF1F3, 0x56A7)
+DOUBLE_BYTE_PAIR(0xF1F4, 0x56AA)
+DOUBLE_BYTE_PAIR(0xF1F5, 0x56AC)
+DOUBLE_BYTE_PAIR(0xF1F6, 0x58DA)
+DOUBLE_BYTE_PAIR(0xF1F7, 0x58DD)
+DOUBLE_BYTE_PAIR(0xF1F8, 0x58DB)
+DOUBLE_BYTE_PAIR(0xF1F9, 0x5912)
+DOUBLE_BYTE_PAIR(0xF1FA, 0x5B3D)
+DOUBLE_BYTE_PAIR(0xF1FB, 0x5B3E)
+DOUBLE_BYTE_PAIR(0xF1FC, 0x5B3F)
+DOUBLE_BYTE_PAIR(0xF1FD, 0x5DC3)
+DOUBLE_BYTE_PAIR(0xF1FE, 0x5E70)
+DOUBLE_BYTE_PAIR(0xF240, 0x5FBF)
+DOUBLE_BYTE_PAIR(0xF241, 0x61FB)
+DOUBLE_BYTE_PAIR(0xF242, 0x6507)
+DOUBLE_BYTE_PAIR(0xF243, 0x6510)
+DOUBLE_BYTE_PAIR(0xF244, 0x650D)
+DOUBLE_BYTE_PAIR(0xF245, 0x6509)
+DOUBLE_BYTE_PAIR(0xF246, 0x650C)
+DOUBLE_BYTE_PAIR(0xF247, 0x650E)
+DOUBLE_BYTE_PAIR(0xF248, 0x6584)
+DOUBLE_BYTE_PAIR(0xF249, 0x65DE)
+DOUBLE_BYTE_PAIR(0xF24A, 0x65DD)
+DOUBLE_BYTE_PAIR(0xF24B, 0x66DE)
+DOUBLE_BYTE_PAIR(0xF24C, 0x6AE7)
+DOUBLE_BYTE_PAIR(0xF24D, 0x6AE0)
+DOUBLE_BYTE_PAIR(0xF24E, 0x6ACC)
+DOUBLE_BYTE_PAIR(0xF24F, 0x6AD1)
+DOUBLE_BYTE_PAIR(0xF250, 0x6AD9)
+DOUBLE_BYTE_PAIR(0xF251, 0x6ACB)
+DOUBLE_BYTE_PAIR(0xF252, 0x6ADF)
+DOUBLE_BYTE_PAIR(0xF253, 0x6ADC)
+DOUBLE_BYTE_PAIR(0xF254, 0x6AD0)
+DOUBLE_BYTE_PAIR(0xF255, 0x6AEB)
+DOUBLE_BYTE_PAIR(0xF256, 0x6ACF)
+DOUBLE_BYTE_PAIR(0xF257, 0x6ACD)
+DOUBLE_BYTE_PAIR(0xF258, 0x6ADE)
+DOUBLE_BYTE_PAIR(0xF259, 0x6B60)
+DOUBLE_BYTE_PAIR(0xF25A, 0x6BB0)
+DOUBLE_BYTE_PAIR(0xF25B, 0x6C0C)
+DOUBLE_BYTE_PAIR(0xF25C, 0x7019)
+DOUBLE_BYTE_PAIR(0xF25D, 0x7027)
+DOUBLE_BYTE_PAIR(0xF25E, 0x7020)
+DOUBLE_BYTE_PAIR(0xF25F, 0x7016)
+DOUBLE_BYTE_PAIR(0xF260, 0x702B)
+DOUBLE_BYTE_PAIR(0xF261, 0x7021)
+DOUBLE_BYTE_PAIR(0xF262, 0x7022)
+DOUBLE_BYTE_PAIR(0xF263, 0x7023)
+DOUBLE_BYTE_PAIR(0xF264, 0x7029)
+DOUBLE_BYTE_PAIR(0xF265, 0x7017)
+DOUBLE_BYTE_PAIR(0xF266, 0x7024)
+DOUBLE_BYTE_PAIR(0xF267, 0x701C)
+DOUBLE_BYTE_PAIR(0xF268, 0x702A)
+DOUBLE_BYTE_PAIR(0xF269, 0x720C)
+DOUBLE_BYTE_PAIR(0xF26A, 0x720A)
+DOUBLE_BYTE_PAIR(0xF26B, 0x7207)
+DOUBLE_BYTE_PAIR(0xF26C, 0x7202)
+DOUBLE_BYTE_PAIR(0xF26D, 0x7205)
+DOUBLE_BYTE_PAIR(0xF26E, 0x72A5)
+DOUBLE_BYTE_PAIR(0xF26F, 0x72A6)
+DOUBLE_BYTE_PAIR(0xF270, 0x72A4)
+DOUBLE_BYTE_PAIR(0xF271, 0x72A3)
+DOUBLE_BYTE_PAIR(0xF272, 0x72A1)
+DOUBLE_BYTE_PAIR(0xF273, 0x74CB)
+DOUBLE_BYTE_PAIR(0xF274, 0x74C5)
+DOUBLE_BYTE_PAIR(0xF275, 0x74B7)
+DOUBLE_BYTE_PAIR(0xF276, 0x74C3)
+DOUBLE_BYTE_PAIR(0xF277, 0x7516)
+DOUBLE_BYTE_PAIR(0xF278, 0x7660)
+DOUBLE_BYTE_PAIR(0xF279, 0x77C9)
+DOUBLE_BYTE_PAIR(0xF27A, 0x77CA)
+DOUBLE_BYTE_PAIR(0xF27B, 0x77C4)
+DOUBLE_BYTE_PAIR(0xF27C, 0x77F1)
+DOUBLE_BYTE_PAIR(0xF27D, 0x791D)
+DOUBLE_BYTE_PAIR(0xF27E, 0x791B)
+DOUBLE_BYTE_PAIR(0xF2A1, 0x7921)
+DOUBLE_BYTE_PAIR(0xF2A2, 0x791C)
+DOUBLE_BYTE_PAIR(0xF2A3, 0x7917)
+DOUBLE_BYTE_PAIR(0xF2A4, 0x791E)
+DOUBLE_BYTE_PAIR(0xF2A5, 0x79B0)
+DOUBLE_BYTE_PAIR(0xF2A6, 0x7A67)
+DOUBLE_BYTE_PAIR(0xF2A7, 0x7A68)
+DOUBLE_BYTE_PAIR(0xF2A8, 0x7C33)
+DOUBLE_BYTE_PAIR(0xF2A9, 0x7C3C)
+DOUBLE_BYTE_PAIR(0xF2AA, 0x7C39)
+DOUBLE_BYTE_PAIR(0xF2AB, 0x7C2C)
+DOUBLE_BYTE_PAIR(0xF2AC, 0x7C3B)
+DOUBLE_BYTE_PAIR(0xF2AD, 0x7CEC)
+DOUBLE_BYTE_PAIR(0xF2AE, 0x7CEA)
+DOUBLE_BYTE_PAIR(0xF2AF, 0x7E76)
+DOUBLE_BYTE_PAIR(0xF2B0, 0x7E75)
+DOUBLE_BYTE_PAIR(0xF2B1, 0x7E78)
+DOUBLE_BYTE_PAIR(0xF2B2, 0x7E70)
+DOUBLE_BYTE_PAIR(0xF2B3, 0x7E77)
+DOUBLE_BYTE_PAIR(0xF2B4, 0x7E6F)
+DOUBLE_BYTE_PAIR(0xF2B5, 0x7E7A)
+DOUBLE_BYTE_PAIR(0xF2B6, 0x7E72)
+DOUBLE_BYTE_PAIR(0xF2B7, 0x7E74)
+DOUBLE_BYTE_PAIR(0xF2B8, 0x7E68)
+DOUBLE_BYTE_PAIR(0xF2B9, 0x7F4B)
+DOUBLE_BYTE_PAIR(0xF2BA, 0x7F4A)
+DOUBLE_BYTE_PAIR(0xF2BB, 0x7F83)
+DOUBLE_BYTE_PAIR(0xF2BC, 0x7F86)
+DOUBLE_BYTE_PAIR(0xF2BD, 0x7FB7)
+DOUBLE_BYTE_PAIR(0xF2BE, 0x7FFD)
+DOUBLE_BYTE_PAIR(0xF2BF, 0x7FFE)
+DOUBLE_BYTE_PAIR(0xF2C0, 0x8078)
+DOUBLE_BYTE_PAIR(0xF2C1, 0x81D7)
+DOUBLE_BYTE_PAIR(0xF2C2, 0x81D5)
+DOUBLE_BYTE_PAIR(0xF2C3, 0x8264)
+DOUBLE_BYTE_PAIR(0xF2C4, 0x8261)
+DOUBLE_BYTE_PAIR(0xF2C5, 0x8263)
+DOUBLE_BYTE_PAIR(0xF2C6, 0x85EB)
+DOUBLE_BYTE_PAIR(0xF2C7, 0x85F1)
+DOUBLE_BYTE_PAIR(0xF2C8, 0x85ED)
+DOUBLE_BYTE_PAIR(0xF2C9, 0x85D9)
+DOUBLE_BYTE_PAIR(0xF2CA, 0x85E1)
+DOUBLE_BYTE_PAIR(0xF2CB, 0x85E8)
+DOUBLE_BYTE_PAIR(0xF2CC, 0x85DA)
+DOUBLE_BYTE_PAIR(0xF2CD, 0x85D7)
+DOUBLE_BYTE_PAIR(0xF2CE, 0x85EC)
+DOUBLE_BYTE_PAIR(0xF2CF, 0x85F2)
+DOUBLE_BYTE_PAIR(0xF2D0, 0x85F8)
+DOUBLE_BYTE_PAIR(0xF2D1, 0x85D8)
+DOUBLE_BYTE_PAIR(0xF2D2, 0x85DF)
+DOUBLE_BYTE_PAIR(0xF2D3, 0x85E3)
+DOUBLE_BYTE_PAIR(0xF2D4, 0x85DC)
+DOUBLE_BYTE_PAIR(0xF2D5, 0x85D1)
+DOUBLE_BYTE_PAIR(0xF2D6, 0x85F0)
+DOUBLE_BYTE_PAIR(0xF2D7, 0x85E6)
+DOUBLE_BYTE_PAIR(0xF2D8, 0x85EF)
+DOUBLE_BYTE_PAIR(0xF2D9, 0x85DE)
+DOUBLE_BYTE_PAIR(0xF2DA, 0x85E2)
+DOUBLE_BYTE_PAIR(0xF2DB, 0x8800)
+DOUBLE_BYTE_PAIR(0xF2DC, 0x87FA)
+DOUBLE_BYTE_PAIR(0xF2DD, 0x8803)
+DOUBLE_BYTE_PAIR(0xF2DE, 0x87F6)
+DOUBLE_BYTE_PAIR(0xF2DF, 0x87F7)
+DOUBLE_BYTE_PAIR(0xF2E0, 0x8809)
+DOUBLE_BYTE_PAIR(0xF2E1, 0x880C)
+DOUBLE_BYTE_PAIR(0xF2E2, 0x880B)
+DOUBLE_BYTE_PAIR(0xF2E3, 0x8806)
+DOUBLE_BYTE_PAIR(0xF2E4, 0x87FC)
+DOUBLE_BYTE_PAIR(0xF2E5, 0x8808)
+DOUBLE_BYTE_PAIR(0xF2E6, 0x87FF)
+DOUBLE_BYTE_PAIR(0xF2E7, 0x880A)
+DOUBLE_BYTE_PAIR(0xF2E8, 0x8802)
+DOUBLE_BYTE_PAIR(0xF2E9, 0x8962)
+DOUBLE_BYTE_PAIR(0xF2EA, 0x895A)
+DOUBLE_BYTE_PAIR(0xF2EB, 0x895B)
+DOUBLE_BYTE_PAIR(0xF2EC, 0x8957)
+DOUBLE_BYTE_PAIR(0xF2ED, 0x8961)
+DOUBLE_BYTE_PAIR(0xF2EE, 0x895C)
+DOUBLE_BYTE_PAIR(0xF2EF, 0x8958)
+DOUBLE_BYTE_PAIR(0xF2F0, 0x895D)
+DOUBLE_BYTE_PAIR(0xF2F1, 0x8959)
+DOUBLE_BYTE_PAIR(0xF2F2, 0x8988)
+DOUBLE_BYTE_PAIR(0xF2F3, 0x89B7)
+DOUBLE_BYTE_PAIR(0xF2F4, 0x89B6)
+DOUBLE_BYTE_PAIR(0xF2F5, 0x89F6)
+DOUBLE_BYTE_PAIR(0xF2F6, 0x8B50)
+DOUBLE_BYTE_PAIR(0xF2F7, 0x8B48)
+DOUBLE_BYTE_PAIR(0xF2F8, 0x8B4A)
+DOUBLE_BYTE_PAIR(0xF2F9, 0x8B40)
+DOUBLE_BYTE_PAIR(0xF2FA, 0x8B53)
+DOUBLE_BYTE_PAIR(0xF2FB, 0x8B56)
+DOUBLE_BYTE_PAIR(0xF2FC, 0x8B54)
+DOUBLE_BYTE_PAIR(0xF2FD, 0x8B4B)
+DOUBLE_BYTE_PAIR(0xF2FE, 0x8B55)
+DOUBLE_BYTE_PAIR(0xF340, 0x8B51)
+DOUBLE_BYTE_PAIR(0xF341, 0x8B42)
+DOUBLE_BYTE_PAIR(0xF342, 0x8B52)
+DOUBLE_BYTE_PAIR(0xF343, 0x8B57)
+DOUBLE_BYTE_PAIR(0xF344, 0x8C43)
+DOUBLE_BYTE_PAIR(0xF345, 0x8C77)
+DOUBLE_BYTE_PAIR(0xF346, 0x8C76)
+DOUBLE_BYTE_PAIR(0xF347, 0x8C9A)
+DOUBLE_BYTE_PAIR(0xF348, 0x8D06)
+DOUBLE_BYTE_PAIR(0xF349, 0x8D07)
+DOUBLE_BYTE_PAIR(0xF34A, 0x8D09)
+DOUBLE_BYTE_PAIR(0xF34B, 0x8DAC)
+DOUBLE_BYTE_PAIR(0xF34C, 0x8DAA)
+DOUBLE_BYTE_PAIR(0xF34D, 0x8DAD)
+DOUBLE_BYTE_PAIR(0xF34E, 0x8DAB)
+DOUBLE_BYTE_PAIR(0xF34F, 0x8E6D)
+DOUBLE_BYTE_PAIR(0xF350, 0x8E78)
+DOUBLE_BYTE_PAIR(0xF351, 0x8E73)
+DOUBLE_BYTE_PAIR(0xF352, 0x8E6A)
+DOUBLE_BYTE_PAIR(0xF353, 0x8E6F)
+DOUBLE_BYTE_PAIR(0xF354, 0x8E7B)
+DOUBLE_BYTE_PAIR(0xF355, 0x8EC2)
+DOUBLE_BYTE_PAIR(0xF356, 0x8F52)
+DOUBLE_BYTE_PAIR(0xF357, 0x8F51)
+DOUBLE_BYTE_PAIR(0xF358, 0x8F4F)
+DOUBLE_BYTE_PAIR(0xF359, 0x8F50)
+DOUBLE_BYTE_PAIR(0xF35A, 0x8F53)
+DOUBLE_BYTE_PAIR(0xF35B, 0x8FB4)
+DOUBLE_BYTE_PAIR(0xF35C, 0x9140)
+DOUBLE_BYTE_PAIR(0xF35D, 0x913F)
+DOUBLE_BYTE_PAIR(0xF35E, 0x91B0)
+DOUBLE_BYTE_PAIR(0xF35F, 0x91AD)
+DOUBLE_BYTE_PAIR(0xF360, 0x93DE)
+DOUBLE_BYTE_PAIR(0xF361, 0x93C7)
+DOUBLE_BYTE_PAIR(0xF362, 0x93CF)
+DOUBLE_BYTE_PAIR(0xF363, 0x93C2)
+DOUBLE_BYTE_PAIR(0xF364, 0x93DA)
+DOUBLE_BYTE_PAIR(0xF365, 0x93D0)
+DOUBLE_BYTE_PAIR(0xF366, 0x93F9)
+DOUBLE_BYTE_PAIR(0xF367, 0x93EC)
+DOUBLE_BYTE_PAIR(0xF368, 0x93CC)
+DOUBLE_BYTE_PAIR(0xF369, 0x93D9)
+DOUBLE_BYTE_PAIR(0xF36A, 0x93A9)
+DOUBLE_BYTE_PAIR(0xF36B, 0x93E6)
+DOUBLE_BYTE_PAIR(0xF36C, 0x93CA)
+DOUBLE_BYTE_PAIR(0xF36D, 0x93D4)
+DOUBLE_BYTE_PAIR(0xF36E, 0x93EE)
+DOUBLE_BYTE_PAIR(0xF36F, 0x93E3)
+DOUBLE_BYTE_PAIR(0xF370, 0x93D5)
+DOUBLE_BYTE_PAIR(0xF371, 0x93C4)
+DOUBLE_BYTE_PAIR(0xF372, 0x93CE)
+DOUBLE_BYTE_PAIR(0xF373, 0x93C0)
+DOUBLE_BYTE_PAIR(0xF374, 0x93D2)
+DOUBLE_BYTE_PAIR(0xF375, 0x93E7)
+DOUBLE_BYTE_PAIR(0xF376, 0x957D)
+DOUBLE_BYTE_PAIR(0xF377, 0x95DA)
+DOUBLE_BYTE_PAIR(0xF378, 0x95DB)
+DOUBLE_BYTE_PAIR(0xF379, 0x96E1)
+DOUBLE_BYTE_PAIR(0xF37A, 0x9729)
+DOUBLE_BYTE_PAIR(0xF37B, 0x972B)
+DOUBLE_BYTE_PAIR(0xF37C, 0x972C)
+DOUBLE_BYTE_PAIR(0xF37D, 0x9728)
+DOUBLE_BYTE_PAIR(0xF37E, 0x9726)
+DOUBLE_BYTE_PAIR(0xF3A1, 0x97B3)
+DOUBLE_BYTE_PAIR(0xF3A2, 0x97B7)
+DOUBLE_BYTE_PAIR(0xF3A3, 0x97B6)
+DOUBLE_BYTE_PAIR(0xF3A4, 0x97DD)
+DOUBLE_BYTE_PAIR(0xF3A5, 0x97DE)
+DOUBLE_BYTE_PAIR(0xF3A6, 0x97DF)
+DOUBLE_BYTE_PAIR(0xF3A7, 0x985C)
+DOUBLE_BYTE_PAIR(0xF3A8, 0x9859)
+DOUBLE_BYTE_PAIR(0xF3A9, 0x985D)
+DOUBLE_BYTE_PAIR(0xF3AA, 0x9857)
+DOUBLE_BYTE_PAIR(0xF3AB, 0x98BF)
+DOUBLE_BYTE_PAIR(0xF3AC, 0x98BD)
+DOUBLE_BYTE_PAIR(0xF3AD, 0x98BB)
+DOUBLE_BYTE_PAIR(0xF3AE, 0x98BE)
+DOUBLE_BYTE_PAIR(0xF3AF, 0x9948)
+DOUBLE_BYTE_PAIR(0xF3B0, 0x9947)
+DOUBLE_BYTE_PAIR(0xF3B1, 0x9943)
+DOUBLE_BYTE_PAIR(0xF3B2, 0x99A6)
+DOUBLE_BYTE_PAIR(0xF3B3, 0x99A7)
+DOUBLE_BYTE_PAIR(0xF3B4, 0x9A1A)
+DOUBLE_BYTE_PAIR(0xF3B5, 0x9A15)
+DOUBLE_BYTE_PAIR(0xF3B6, 0x9A25)
+DOUBLE_BYTE_PAIR(0xF3B7, 0x9A1D)
+DOUBLE_BYTE_PAIR(0xF3B8, 0x9A24)
+DOUBLE_BYTE_PAIR(0xF3B9, 0x9A1B)
+DOUBLE_BYTE_PAIR(0xF3BA, 0x9A22)
+DOUBLE_BYTE_PAIR(0xF3BB, 0x9A20)
+DOUBLE_BYTE_PAIR(0xF3BC, 0x9A27)
+DOUBLE_BYTE_PAIR(0xF3BD, 0x9A23)
+DOUBLE_BYTE_PAIR(0xF3BE, 0x9A1E)
+DOUBLE_BYTE_PAIR(0xF3BF, 0x9A1C)
+DOUBLE_BYTE_PAIR(0xF3C0, 0x9A14)
+DOUBLE_BYTE_PAIR(0xF3C1, 0x9AC2)
+DOUBLE_BYTE_PAIR(0xF3C2, 0x9B0B)
+DOUBLE_BYTE_PAIR(0xF3C3, 0x9B0A)
+DOUBLE_BYTE_PAIR(0xF3C4, 0x9B0E)
+DOUBLE_BYTE_PAIR(0xF3C5, 0x9B0C)
+DOUBLE_BYTE_PAIR(0xF3C6, 0x9B37)
+DOUBLE_BYTE_PAIR(0xF3C7, 0x9BEA)
+DOUBLE_BYTE_PAIR(0xF3C8, 0x9BEB)
+DOUBLE_BYTE_PAIR(0xF3C9, 0x9BE0)
+DOUBLE_BYTE_PAIR(0xF3CA, 0x9BDE)
+DOUBLE_BYTE_PAIR(0xF3CB, 0x9BE4)
+DOUBLE_BYTE_PAIR(0xF3CC, 0x9BE6)
+DOUBLE_BYTE_PAIR(0xF3CD, 0x9BE2)
+DOUBLE_BYTE_PAIR(0xF3CE, 0x9BF0)
+DOUBLE_BYTE_PAIR(0xF3CF, 0x9BD4)
+DOUBLE_BYTE_PAIR(0xF3D0, 0x9BD7)
+DOUBLE_BYTE_PAIR(0xF3D1, 0x9BEC)
+DOUBLE_BYTE_PAIR(0xF3D2, 0x9BDC)
+DOUBLE_BYTE_PAIR(0xF3D3, 0x9BD9)
+DOUBLE_BYTE_PAIR(0xF3D4, 0x9BE5)
+DOUBLE_BYTE_PAIR(0xF3D5, 0x9BD5)
+DOUBLE_BYTE_PAIR(0xF3D6, 0x9BE1)
+DOUBLE_BYTE_PAIR(0xF3D7, 0x9BDA)
+DOUBLE_BYTE_PAIR(0xF3D8, 0x9D77)
+DOUBLE_BYTE_PAIR(0xF3D9, 0x9D81)
+DOUBLE_BYTE_PAIR(0xF3DA, 0x9D8A)
+DOUBLE_BYTE_PAIR(0xF3DB, 0x9D84)
+DOUBLE_BYTE_PAIR(0xF3DC, 0x9D88)
+DOUBLE_BYTE_PAIR(0xF3DD, 0x9D71)
+DOUBLE_BYTE_PAIR(0xF3DE, 0x9D80)
+DOUBLE_BYTE_PAIR(0xF3DF, 0x9D78)
+DOUBLE_BYTE_PAIR(0xF3E0, 0x9D86)
+DOUBLE_BYTE_PAIR(0xF3E1, 0x9D8B)
+DOUBLE_BYTE_PAIR(0xF3E2, 0x9D8C)
+DOUBLE_BYTE_PAIR(0xF3E3, 0x9D7D)
+DOUBLE_BYTE_PAIR(0xF3E4, 0x9D6B)
+DOUBLE_BYTE_PAIR(0xF3E5, 0x9D74)
+DOUBLE_BYTE_PAIR(0xF3E6, 0x9D75)
+DOUBLE_BYTE_PAIR(0xF3E7, 0x9D70)
+DOUBLE_BYTE_PAIR(0xF3E8, 0x9D69)
+DOUBLE_BYTE_PAIR(0xF3E9, 0x9D85)
+DOUBLE_BYTE_PAIR(0xF3EA, 0x9D73)
+DOUBLE_BYTE_PAIR(0xF3EB, 0x9D7B)
+DOUBLE_BYTE_PAIR(0xF3EC, 0x9D82)
+DOUBLE_BYTE_PAIR(0xF3ED, 0x9D6F)
+DOUBLE_BYTE_PAIR(0xF3EE, 0x9D79)
+DOUBLE_BYTE_PAIR(0xF3EF, 0x9D7F)
+DOUBLE_BYTE_PAIR(0xF3F0, 0x9D87)
+DOUBLE_BYTE_PAIR(0xF3F1, 0x9D68)
+DOUBLE_BYTE_PAIR(0xF3F2, 0x9E94)
+DOUBLE_BYTE_PAIR(0xF3F3, 0x9E91)
+DOUBLE_BYTE_PAIR(0xF3F4, 0x9EC0)
+DOUBLE_BYTE_PAIR(0xF3F5, 0x9EFC)
+DOUBLE_BYTE_PAIR(0xF3F6, 0x9F2D)
+DOUBLE_BYTE_PAIR(0xF3F7, 0x9F40)
+DOUBLE_BYTE_PAIR(0xF3F8, 0x9F41)
+DOUBLE_BYTE_PAIR(0xF3F9, 0x9F4D)
+DOUBLE_BYTE_PAIR(0xF3FA, 0x9F56)
+DOUBLE_BYTE_PAIR(0xF3FB, 0x9F57)
+DOUBLE_BYTE_PAIR(0xF3FC, 0x9F58)
+DOUBLE_BYTE_PAIR(0xF3FD, 0x5337)
+DOUBLE_BYTE_PAIR(0xF3FE, 0x56B2)
+DOUBLE_BYTE_PAIR(0xF440, 0x56B5)
+DOUBLE_BYTE_PAIR(0xF441, 0x56B3)
+DOUBLE_BYTE_PAIR(0xF442, 0x58E3)
+DOUBLE_BYTE_PAIR(0xF443, 0x5B45)
+DOUBLE_BYTE_PAIR(0xF444, 0x5DC6)
+DOUBLE_BYTE_PAIR(0xF445, 0x5DC7)
+DOUBLE_BYTE_PAIR(0xF446, 0x5EEE)
+DOUBLE_BYTE_PAIR(0xF447, 0x5EEF)
+DOUBLE_BYTE_PAIR(0xF448, 0x5FC0)
+DOUBLE_BYTE_PAIR(0xF449, 0x5FC1)
+DOUBLE_BYTE_PAIR(0xF44A, 0x61F9)
+DOUBLE_BYTE_PAIR(0xF44B, 0x6517)
+DOUBLE_BYTE_PAIR(0xF44C, 0x6516)
+DOUBLE_BYTE_PAIR(0xF44D, 0x6515)
+DOUBLE_BYTE_PAIR(0xF44E, 0x6513)
+DOUBLE_BYTE_PAIR(0xF44F, 0x65DF)
+DOUBLE_BYTE_PAIR(0xF450, 0x66E8)
+DOUBLE_BYTE_PAIR(0xF451, 0x66E3)
+DOUBLE_BYTE_PAIR(0xF452, 0x66E4)
+DOUBLE_BYTE_PAIR(0xF453, 0x6AF3)
+DOUBLE_BYTE_PAIR(0xF454, 0x6AF0)
+DOUBLE_BYTE_PAIR(0xF455, 0x6AEA)
+DOUBLE_BYTE_PAIR(0xF456, 0x6AE8)
+DOUBLE_BYTE_PAIR(0xF457, 0x6AF9)
+DOUBLE_BYTE_PAIR(0xF458, 0x6AF1)
+DOUBLE_BYTE_PAIR(0xF459, 0x6AEE)
+DOUBLE_BYTE_PAIR(0xF45A, 0x6AEF)
+DOUBLE_BYTE_PAIR(0xF45B, 0x703C)
+DOUBLE_BYTE_PAIR(0xF45C, 0x7035)
+DOUBLE_BYTE_PAIR(0xF45D, 0x702F)
+DOUBLE_BYTE_PAIR(0xF45E, 0x7037)
+DOUBLE_BYTE_PAIR(0xF45F, 0x7034)
+DOUBLE_BYTE_PAIR(0xF460, 0x7031)
+DOUBLE_BYTE_PAIR(0xF461, 0x7042)
+DOUBLE_BYTE_PAIR(0xF462, 0x7038)
+DOUBLE_BYTE_PAIR(0xF463, 0x703F)
+DOUBLE_BYTE_PAIR(0xF464, 0x703A)
+DOUBLE_BYTE_PAIR(0xF465, 0x7039)
+DOUBLE_BYTE_PAIR(0xF466, 0x7040)
+DOUBLE_BYTE_PAIR(0xF467, 0x703B)
+DOUBLE_BYTE_PAIR(0xF468, 0x7033)
+DOUBLE_BYTE_PAIR(0xF469, 0x7041)
+DOUBLE_BYTE_PAIR(0xF46A, 0x7213)
+DOUBLE_BYTE_PAIR(0xF46B, 0x7214)
+DOUBLE_BYTE_PAIR(0xF46C, 0x72A8)
+DOUBLE_BYTE_PAIR(0xF46D, 0x737D)
+DOUBLE_BYTE_PAIR(0xF46E, 0x737C)
+DOUBLE_BYTE_PAIR(0xF46F, 0x74BA)
+DOUBLE_BYTE_PAIR(0xF470, 0x76AB)
+DOUBLE_BYTE_PAIR(0xF471, 0x76AA)
+DOUBLE_BYTE_PAIR(0xF472, 0x76BE)
+DOUBLE_BYTE_PAIR(0xF473, 0x76ED)
+DOUBLE_BYTE_PAIR(0xF474, 0x77CC)
+DOUBLE_BYTE_PAIR(0xF475, 0x77CE)
+DOUBLE_BYTE_PAIR(0xF476, 0x77CF)
+DOUBLE_BYTE_PAIR(0xF477, 0x77CD)
+DOUBLE_BYTE_PAIR(0xF478, 0x77F2)
+DOUBLE_BYTE_PAIR(0xF479, 0x7925)
+DOUBLE_BYTE_PAIR(0xF47A, 0x7923)
+DOUBLE_BYTE_PAIR(0xF47B, 0x7927)
+DOUBLE_BYTE_PAIR(0xF47C, 0x7928)
+DOUBLE_BYTE_PAIR(0xF47D, 0x7924)
+DOUBLE_BYTE_PAIR(0xF47E, 0x7929)
+DOUBLE_BYTE_PAIR(0xF4A1, 0x79B2)
+DOUBLE_BYTE_PAIR(0xF4A2, 0x7A6E)
+DOUBLE_BYTE_PAIR(0xF4A3, 0x7A6C)
+DOUBLE_BYTE_PAIR(0xF4A4, 0x7A6D)
+DOUBLE_BYTE_PAIR(0xF4A5, 0x7AF7)
+DOUBLE_BYTE_PAIR(0xF4A6, 0x7C49)
+DOUBLE_BYTE_PAIR(0xF4A7, 0x7C48)
+DOUBLE_BYTE_PAIR(0xF4A8, 0x7C4A)
+DOUBLE_BYTE_PAIR(0xF4A9, 0x7C47)
+DOUBLE_BYTE_PAIR(0xF4AA, 0x7C45)
+DOUBLE_BYTE_PAIR(0xF4AB, 0x7CEE)
+DOUBLE_BYTE_PAIR(0xF4AC, 0x7E7B)
+DOUBLE_BYTE_PAIR(0xF4AD, 0x7E7E)
+DOUBLE_BYTE_PAIR(0xF4AE, 0x7E81)
+DOUBLE_BYTE_PAIR(0xF4AF, 0x7E80)
+DOUBLE_BYTE_PAIR(0xF4B0, 0x7FBA)
+DOUBLE_BYTE_PAIR(0xF4B1, 0x7FFF)
+DOUBLE_BYTE_PAIR(0xF4B2, 0x8079)
+DOUBLE_BYTE_PAIR(0xF4B3, 0x81DB)
+DOUBLE_BYTE_PAIR(0xF4B4, 0x81D9)
+DOUBLE_BYTE_PAIR(0xF4B5, 0x820B)
+DOUBLE_BYTE_PAIR(0xF4B6, 0x8268)
+DOUBLE_BYTE_PAIR(0xF4B7, 0x8269)
+DOUBLE_BYTE_PAIR(0xF4B8, 0x8622)
+DOUBLE_BYTE_PAIR(0xF4B9, 0x85FF)
+DOUBLE_BYTE_PAIR(0xF4BA, 0x8601)
+DOUBLE_BYTE_PAIR(0xF4BB, 0x85FE)
+DOUBLE_BYTE_PAIR(0xF4BC, 0x861B)
+DOUBLE_BYTE_PAIR(0xF4BD, 0x8600)
+DOUBLE_BYTE_PAIR(0xF4BE, 0x85F6)
+DOUBLE_BYTE_PAIR(0xF4BF, 0x8604)
+DOUBLE_BYTE_PAIR(0xF4C0, 0x8609)
+DOUBLE_BYTE_PAIR(0xF4C1, 0x8605)
+DOUBLE_BYTE_PAIR(0xF4C2, 0x860C)
+DOUBLE_BYTE_PAIR(0xF4C3, 0x85FD)
+DOUBLE_BYTE_PAIR(0xF4C4, 0x8819)
+DOUBLE_BYTE_PAIR(0xF4C5, 0x8810)
+DOUBLE_BYTE_PAIR(0xF4C6, 0x8811)
+DOUBLE_BYTE_PAIR(0xF4C7, 0x8817)
+DOUBLE_BYTE_PAIR(0xF4C8, 0x8813)
+DOUBLE_BYTE_PAIR(0xF4C9, 0x8816)
+DOUBLE_BYTE_PAIR(0xF4CA, 0x8963)
+DOUBLE_BYTE_PAIR(0xF4CB, 0x8966)
+DOUBLE_BYTE_PAIR(0xF4CC, 0x89B9)
+DOUBLE_BYTE_PAIR(0xF4CD, 0x89F7)
+DOUBLE_BYTE_PAIR(0xF4CE, 0x8B60)
+DOUBLE_BYTE_PAIR(0xF4CF, 0x8B6A)
+DOUBLE_BYTE_PAIR(0xF4D0, 0x8B5D)
+DOUBLE_BYTE_PAIR(0xF4D1, 0x8B68)
+DOUBLE_BYTE_PAIR(0xF4D2, 0x8B63)
+DOUBLE_BYTE_PAIR(0xF4D3, 0x8B65)
+DOUBLE_BYTE_PAIR(0xF4D4, 0x8B67)
+DOUBLE_BYTE_PAIR(0xF4D5, 0x8B6D)
+DOUBLE_BYTE_PAIR(0xF4D6, 0x8DAE)
+DOUBLE_BYTE_PAIR(0xF4D7, 0x8E86)
+DOUBLE_BYTE_PAIR(0xF4D8, 0x8E88)
+DOUBLE_BYTE_PAIR(0xF4D9, 0x8E84)
+DOUBLE_BYTE_PAIR(0xF4DA, 0x8F59)
+DOUBLE_BYTE_PAIR(0xF4DB, 0x8F56)
+DOUBLE_BYTE_PAIR(0xF4DC, 0x8F57)
+DOUBLE_BYTE_PAIR(0xF4DD, 0x8F55)
+DOUBLE_BYTE_PAIR(0xF4DE, 0x8F58)
+DOUBLE_BYTE_PAIR(0xF4DF, 0x8F5A)
+DOUBLE_BYTE_PAIR(0xF4E0, 0x908D)
+DOUBLE_BYTE_PAIR(0xF4E1, 0x9143)
+DOUBLE_BYTE_PAIR(0xF4E2, 0x9141)
+DOUBLE_BYTE_PAIR(0xF4E3, 0x91B7)
+DOUBLE_BYTE_PAIR(0xF4E4, 0x91B5)
+DOUBLE_BYTE_PAIR(0xF4E5, 0x91B2)
+DOUBLE_BYTE_PAIR(0xF4E6, 0x91B3)
+DOUBLE_BYTE_PAIR(0xF4E7, 0x940B)
+DOUBLE_BYTE_PAIR(0xF4E8, 0x9413)
+DOUBLE_BYTE_PAIR(0xF4E9, 0x93FB)
+DOUBLE_BYTE_PAIR(0xF4EA, 0x9420)
+DOUBLE_BYTE_PAIR(0xF4EB, 0x940F)
+DOUBLE_BYTE_PAIR(0xF4EC, 0x9414)
+DOUBLE_BYTE_PAIR(0xF4ED, 0x93FE)
+DOUBLE_BYTE_PAIR(0xF4EE, 0x9415)
+DOUBLE_BYTE_PAIR(0xF4EF, 0x9410)
+DOUBLE_BYTE_PAIR(0xF4F0, 0x9428)
+DOUBLE_BYTE_PAIR(0xF4F1, 0x9419)
+DOUBLE_BYTE_PAIR(0xF4F2, 0x940D)
+DOUBLE_BYTE_PAIR(0xF4F3, 0x93F5)
+DOUBLE_BYTE_PAIR(0xF4F4, 0x9400)
+DOUBLE_BYTE_PAIR(0xF4F5, 0x93F7)
+DOUBLE_BYTE_PAIR(0xF4F6, 0x9407)
+DOUBLE_BYTE_PAIR(0xF4F7, 0x940E)
+DOUBLE_BYTE_PAIR(0xF4F8, 0x9416)
+DOUBLE_BYTE_PAIR(0xF4F9, 0x9412)
+DOUBLE_BYTE_PAIR(0xF4FA, 0x93FA)
+DOUBLE_BYTE_PAIR(0xF4FB, 0x9409)
+DOUBLE_BYTE_PAIR(0xF4FC, 0x93F8)
+DOUBLE_BYTE_PAIR(0xF4FD, 0x940A)
+DOUBLE_BYTE_PAIR(0xF4FE, 0x93FF)
+DOUBLE_BYTE_PAIR(0xF540, 0x93FC)
+DOUBLE_BYTE_PAIR(0xF541, 0x940C)
+DOUBLE_BYTE_PAIR(0xF542, 0x93F6)
+DOUBLE_BYTE_PAIR(0xF543, 0x9411)
+DOUBLE_BYTE_PAIR(0xF544, 0x9406)
+DOUBLE_BYTE_PAIR(0xF545, 0x95DE)
+DOUBLE_BYTE_PAIR(0xF546, 0x95E0)
+DOUBLE_BYTE_PAIR(0xF547, 0x95DF)
+DOUBLE_BYTE_PAIR(0xF548, 0x972E)
+DOUBLE_BYTE_PAIR(0xF549, 0x972F)
+DOUBLE_BYTE_PAIR(0xF54A, 0x97B9)
+DOUBLE_BYTE_PAIR(0xF54B, 0x97BB)
+DOUBLE_BYTE_PAIR(0xF54C, 0x97FD)
+DOUBLE_BYTE_PAIR(0xF54D, 0x97FE)
+DOUBLE_BYTE_PAIR(0xF54E, 0x9860)
+DOUBLE_BYTE_PAIR(0xF54F, 0x9862)
+DOUBLE_BYTE_PAIR(0xF550, 0x9863)
+DOUBLE_BYTE_PAIR(0xF551, 0x985F)
+DOUBLE_BYTE_PAIR(0xF552, 0x98C1)
+DOUBLE_BYTE_PAIR(0xF553, 0x98C2)
+DOUBLE_BYTE_PAIR(0xF554, 0x9950)
+DOUBLE_BYTE_PAIR(0xF555, 0x994E)
+DOUBLE_BYTE_PAIR(0xF556, 0x9959)
+DOUBLE_BYTE_PAIR(0xF557, 0x994C)
+DOUBLE_BYTE_PAIR(0xF558, 0x994B)
+DOUBLE_BYTE_PAIR(0xF559, 0x9953)
+DOUBLE_BYTE_PAIR(0xF55A, 0x9A32)
+DOUBLE_BYTE_PAIR(0xF55B, 0x9A34)
+DOUBLE_BYTE_PAIR(0xF55C, 0x9A31)
+DOUBLE_BYTE_PAIR(0xF55D, 0x9A2C)
+DOUBLE_BYTE_PAIR(0xF55E, 0x9A2A)
+DOUBLE_BYTE_PAIR(0xF55F, 0x9A36)
+DOUBLE_BYTE_PAIR(0xF560, 0x9A29)
+DOUBLE_BYTE_PAIR(0xF561, 0x9A2E)
+DOUBLE_BYTE_PAIR(0xF562, 0x9A38)
+DOUBLE_BYTE_PAIR(0xF563, 0x9A2D)
+DOUBLE_BYTE_PAIR(0xF564, 0x9AC7)
+DOUBLE_BYTE_PAIR(0xF565, 0x9ACA)
+DOUBLE_BYTE_PAIR(0xF566, 0x9AC6)
+DOUBLE_BYTE_PAIR(0xF567, 0x9B10)
+DOUBLE_BYTE_PAIR(0xF568, 0x9B12)
+DOUBLE_BYTE_PAIR(0xF569, 0x9B11)
+DOUBLE_BYTE_PAIR(0xF56A, 0x9C0B)
+DOUBLE_BYTE_PAIR(0xF56B, 0x9C08)
+DOUBLE_BYTE_PAIR(0xF56C, 0x9BF7)
+DOUBLE_BYTE_PAIR(0xF56D, 0x9C05)
+DOUBLE_BYTE_PAIR(0xF56E, 0x9C12)
+DOUBLE_BYTE_PAIR(0xF56F, 0x9BF8)
+DOUBLE_BYTE_PAIR(0xF570, 0x9C40)
+DOUBLE_BYTE_PAIR(0xF571, 0x9C07)
+DOUBLE_BYTE_PAIR(0xF572, 0x9C0E)
+DOUBLE_BYTE_PAIR(0xF573, 0x9C06)
+DOUBLE_BYTE_PAIR(0xF574, 0x9C17)
+DOUBLE_BYTE_PAIR(0xF575, 0x9C14)
+DOUBLE_BYTE_PAIR(0xF576, 0x9C09)
+DOUBLE_BYTE_PAIR(0xF577, 0x9D9F)
+DOUBLE_BYTE_PAIR(0xF578, 0x9D99)
+DOUBLE_BYTE_PAIR(0xF579, 0x9DA4)
+DOUBLE_BYTE_PAIR(0xF57A, 0x9D9D)
+DOUBLE_BYTE_PAIR(0xF57B, 0x9D92)
+DOUBLE_BYTE_PAIR(0xF57C, 0x9D98)
+DOUBLE_BYTE_PAIR(0xF57D, 0x9D90)
+DOUBLE_BYTE_PAIR(0xF57E, 0x9D9B)
+DOUBLE_BYTE_PAIR(0xF5A1, 0x9DA0)
+DOUBLE_BYTE_PAIR(0xF5A2, 0x9D94)
+DOUBLE_BYTE_PAIR(0xF5A3, 0x9D9C)
+DOUBLE_BYTE_PAIR(0xF5A4, 0x9DAA)
+DOUBLE_BYTE_PAIR(0xF5A5, 0x9D97)
+DOUBLE_BYTE_PAIR(0xF5A6, 0x9DA1)
+DOUBLE_BYTE_PAIR(0xF5A7, 0x9D9A)
+DOUBLE_BYTE_PAIR(0xF5A8, 0x9DA2)
+DOUBLE_BYTE_PAIR(0xF5A9, 0x9DA8)
+DOUBLE_BYTE_PAIR(0xF5AA, 0x9D9E)
+DOUBLE_BYTE_PAIR(0xF5AB, 0x9DA3)
+DOUBLE_BYTE_PAIR(0xF5AC, 0x9DBF)
+DOUBLE_BYTE_PAIR(0xF5AD, 0x9DA9)
+DOUBLE_BYTE_PAIR(0xF5AE, 0x9D96)
+DOUBLE_BYTE_PAIR(0xF5AF, 0x9DA6)
+DOUBLE_BYTE_PAIR(0xF5B0, 0x9DA7)
+DOUBLE_BYTE_PAIR(0xF5B1, 0x9E99)
+DOUBLE_BYTE_PAIR(0xF5B2, 0x9E9B)
+DOUBLE_BYTE_PAIR(0xF5B3, 0x9E9A)
+DOUBLE_BYTE_PAIR(0xF5B4, 0x9EE5)
+DOUBLE_BYTE_PAIR(0xF5B5, 0x9EE4)
+DOUBLE_BYTE_PAIR(0xF5B6, 0x9EE7)
+DOUBLE_BYTE_PAIR(0xF5B7, 0x9EE6)
+DOUBLE_BYTE_PAIR(0xF5B8, 0x9F30)
+DOUBLE_BYTE_PAIR(0xF5B9, 0x9F2E)
+DOUBLE_BYTE_PAIR(0xF5BA, 0x9F5B)
+DOUBLE_BYTE_PAIR(0xF5BB, 0x9F60)
+DOUBLE_BYTE_PAIR(0xF5BC, 0x9F5E)
+DOUBLE_BYTE_PAIR(0xF5BD, 0x9F5D)
+DOUBLE_BYTE_PAIR(0xF5BE, 0x9F59)
+DOUBLE_BYTE_PAIR(0xF5BF, 0x9F91)
+DOUBLE_BYTE_PAIR(0xF5C0, 0x513A)
+DOUBLE_BYTE_PAIR(0xF5C1, 0x5139)
+DOUBLE_BYTE_PAIR(0xF5C2, 0x5298)
+DOUBLE_BYTE_PAIR(0xF5C3, 0x5297)
+DOUBLE_BYTE_PAIR(0xF5C4, 0x56C3)
+DOUBLE_BYTE_PAIR(0xF5C5, 0x56BD)
+DOUBLE_BYTE_PAIR(0xF5C6, 0x56BE)
+DOUBLE_BYTE_PAIR(0xF5C7, 0x5B48)
+DOUBLE_BYTE_PAIR(0xF5C8, 0x5B47)
+DOUBLE_BYTE_PAIR(0xF5C9, 0x5DCB)
+DOUBLE_BYTE_PAIR(0xF5CA, 0x5DCF)
+DOUBLE_BYTE_PAIR(0xF5CB, 0x5EF1)
+DOUBLE_BYTE_PAIR(0xF5CC, 0x61FD)
+DOUBLE_BYTE_PAIR(0xF5CD, 0x651B)
+DOUBLE_BYTE_PAIR(0xF5CE, 0x6B02)
+DOUBLE_BYTE_PAIR(0xF5CF, 0x6AFC)
+DOUBLE_BYTE_PAIR(0xF5D0, 0x6B03)
+DOUBLE_BYTE_PAIR(0xF5D1, 0x6AF8)
+DOUBLE_BYTE_PAIR(0xF5D2, 0x6B00)
+DOUBLE_BYTE_PAIR(0xF5D3, 0x7043)
+DOUBLE_BYTE_PAIR(0xF5D4, 0x7044)
+DOUBLE_BYTE_PAIR(0xF5D5, 0x704A)
+DOUBLE_BYTE_PAIR(0xF5D6, 0x7048)
+DOUBLE_BYTE_PAIR(0xF5D7, 0x7049)
+DOUBLE_BYTE_PAIR(0xF5D8, 0x7045)
+DOUBLE_BYTE_PAIR(0xF5D9, 0x7046)
+DOUBLE_BYTE_PAIR(0xF5DA, 0x721D)
+DOUBLE_BYTE_PAIR(0xF5DB, 0x721A)
+DOUBLE_BYTE_PAIR(0xF5DC, 0x7219)
+DOUBLE_BYTE_PAIR(0xF5DD, 0x737E)
+DOUBLE_BYTE_PAIR(0xF5DE, 0x7517)
+DOUBLE_BYTE_PAIR(0xF5DF, 0x766A)
+DOUBLE_BYTE_PAIR(0xF5E0, 0x77D0)
+DOUBLE_BYTE_PAIR(0xF5E1, 0x792D)
+DOUBLE_BYTE_PAIR(0xF5E2, 0x7931)
+DOUBLE_BYTE_PAIR(0xF5E3, 0x792F)
+DOUBLE_BYTE_PAIR(0xF5E4, 0x7C54)
+DOUBLE_BYTE_PAIR(0xF5E5, 0x7C53)
+DOUBLE_BYTE_PAIR(0xF5E6, 0x7CF2)
+DOUBLE_BYTE_PAIR(0xF5E7, 0x7E8A)
+DOUBLE_BYTE_PAIR(0xF5E8, 0x7E87)
+DOUBLE_BYTE_PAIR(0xF5E9, 0x7E88)
+DOUBLE_BYTE_PAIR(0xF5EA, 0x7E8B)
+DOUBLE_BYTE_PAIR(0xF5EB, 0x7E86)
+DOUBLE_BYTE_PAIR(0xF5EC, 0x7E8D)
+DOUBLE_BYTE_PAIR(0xF5ED, 0x7F4D)
+DOUBLE_BYTE_PAIR(0xF5EE, 0x7FBB)
+DOUBLE_BYTE_PAIR(0xF5EF, 0x8030)
+DOUBLE_BYTE_PAIR(0xF5F0, 0x81DD)
+DOUBLE_BYTE_PAIR(0xF5F1, 0x8618)
+DOUBLE_BYTE_PAIR(0xF5F2, 0x862A)
+DOUBLE_BYTE_PAIR(0xF5F3, 0x8626)
+DOUBLE_BYTE_PAIR(0xF5F4, 0x861F)
+DOUBLE_BYTE_PAIR(0xF5F5, 0x8623)
+DOUBLE_BYTE_PAIR(0xF5F6, 0x861C)
+DOUBLE_BYTE_PAIR(0xF5F7, 0x8619)
+DOUBLE_BYTE_PAIR(0xF5F8, 0x8627)
+DOUBLE_BYTE_PAIR(0xF5F9, 0x862E)
+DOUBLE_BYTE_PAIR(0xF5FA, 0x8621)
+DOUBLE_BYTE_PAIR(0xF5FB, 0x8620)
+DOUBLE_BYTE_PAIR(0xF5FC, 0x8629)
+DOUBLE_BYTE_PAIR(0xF5FD, 0x861E)
+DOUBLE_BYTE_PAIR(0xF5FE, 0x8625)
+DOUBLE_BYTE_PAIR(0xF640, 0x8829)
+DOUBLE_BYTE_PAIR(0xF641, 0x881D)
+DOUBLE_BYTE_PAIR(0xF642, 0x881B)
+DOUBLE_BYTE_PAIR(0xF643, 0x8820)
+DOUBLE_BYTE_PAIR(0xF644, 0x8824)
+DOUBLE_BYTE_PAIR(0xF645, 0x881C)
+DOUBLE_BYTE_PAIR(0xF646, 0x882B)
+DOUBLE_BYTE_PAIR(0xF647, 0x884A)
+DOUBLE_BYTE_PAIR(0xF648, 0x896D)
+DOUBLE_BYTE_PAIR(0xF649, 0x8969)
+DOUBLE_BYTE_PAIR(0xF64A, 0x896E)
+DOUBLE_BYTE_PAIR(0xF64B, 0x896B)
+DOUBLE_BYTE_PAIR(0xF64C, 0x89FA)
+DOUBLE_BYTE_PAIR(0xF64D, 0x8B79)
+DOUBLE_BYTE_PAIR(0xF64E, 0x8B78)
+DOUBLE_BYTE_PAIR(0xF64F, 0x8B45)
+DOUBLE_BYTE_PAIR(0xF650, 0x8B7A)
+DOUBLE_BYTE_PAIR(0xF651, 0x8B7B)
+DOUBLE_BYTE_PAIR(0xF652, 0x8D10)
+DOUBLE_BYTE_PAIR(0xF653, 0x8D14)
+DOUBLE_BYTE_PAIR(0xF654, 0x8DAF)
+DOUBLE_BYTE_PAIR(0xF655, 0x8E8E)
+DOUBLE_BYTE_PAIR(0xF656, 0x8E8C)
+DOUBLE_BYTE_PAIR(0xF657, 0x8F5E)
+DOUBLE_BYTE_PAIR(0xF658, 0x8F5B)
+DOUBLE_BYTE_PAIR(0xF659, 0x8F5D)
+DOUBLE_BYTE_PAIR(0xF65A, 0x9146)
+DOUBLE_BYTE_PAIR(0xF65B, 0x9144)
+DOUBLE_BYTE_PAIR(0xF65C, 0x9145)
+DOUBLE_BYTE_PAIR(0xF65D, 0x91B9)
+DOUBLE_BYTE_PAIR(0xF65E, 0x943F)
+DOUBLE_BYTE_PAIR(0xF65F, 0x943B)
+DOUBLE_BYTE_PAIR(0xF660, 0x9436)
+DOUBLE_BYTE_PAIR(0xF661, 0x9429)
+DOUBLE_BYTE_PAIR(0xF662, 0x943D)
+DOUBLE_BYTE_PAIR(0xF663, 0x943C)
+DOUBLE_BYTE_PAIR(0xF664, 0x9430)
+DOUBLE_BYTE_PAIR(0xF665, 0x9439)
+DOUBLE_BYTE_PAIR(0xF666, 0x942A)
+DOUBLE_BYTE_PAIR(0xF667, 0x9437)
+DOUBLE_BYTE_PAIR(0xF668, 0x942C)
+DOUBLE_BYTE_PAIR(0xF669, 0x9440)
+DOUBLE_BYTE_PAIR(0xF66A, 0x9431)
+DOUBLE_BYTE_PAIR(0xF66B, 0x95E5)
+DOUBLE_BYTE_PAIR(0xF66C, 0x95E4)
+DOUBLE_BYTE_PAIR(0xF66D, 0x95E3)
+DOUBLE_BYTE_PAIR(0xF66E, 0x9735)
+DOUBLE_BYTE_PAIR(0xF66F, 0x973A)
+DOUBLE_BYTE_PAIR(0xF670, 0x97BF)
+DOUBLE_BYTE_PAIR(0xF671, 0x97E1)
+DOUBLE_BYTE_PAIR(0xF672, 0x9864)
+DOUBLE_BYTE_PAIR(0xF673, 0x98C9)
+DOUBLE_BYTE_PAIR(0xF674, 0x98C6)
+DOUBLE_BYTE_PAIR(0xF675, 0x98C0)
+DOUBLE_BYTE_PAIR(0xF676, 0x9958)
+DOUBLE_BYTE_PAIR(0xF677, 0x9956)
+DOUBLE_BYTE_PAIR(0xF678, 0x9A39)
+DOUBLE_BYTE_PAIR(0xF679, 0x9A3D)
+DOUBLE_BYTE_PAIR(0xF67A, 0x9A46)
+DOUBLE_BYTE_PAIR(0xF67B, 0x9A44)
+DOUBLE_BYTE_PAIR(0xF67C, 0x9A42)
+DOUBLE_BYTE_PAIR(0xF67D, 0x9A41)
+DOUBLE_BYTE_PAIR(0xF67E, 0x9A3A)
+DOUBLE_BYTE_PAIR(0xF6A1, 0x9A3F)
+DOUBLE_BYTE_PAIR(0xF6A2, 0x9ACD)
+DOUBLE_BYTE_PAIR(0xF6A3, 0x9B15)
+DOUBLE_BYTE_PAIR(0xF6A4, 0x9B17)
+DOUBLE_BYTE_PAIR(0xF6A5, 0x9B18)
+DOUBLE_BYTE_PAIR(0xF6A6, 0x9B16)
+DOUBLE_BYTE_PAIR(0xF6A7, 0x9B3A)
+DOUBLE_BYTE_PAIR(0xF6A8, 0x9B52)
+DOUBLE_BYTE_PAIR(0xF6A9, 0x9C2B)
+DOUBLE_BYTE_PAIR(0xF6AA, 0x9C1D)
+DOUBLE_BYTE_PAIR(0xF6AB, 0x9C1C)
+DOUBLE_BYTE_PAIR(0xF6AC, 0x9C2C)
+DOUBLE_BYTE_PAIR(0xF6AD, 0x9C23)
+DOUBLE_BYTE_PAIR(0xF6AE, 0x9C28)
+DOUBLE_BYTE_PAIR(0xF6AF, 0x9C29)
+DOUBLE_BYTE_PAIR(0xF6B0, 0x9C24)
+DOUBLE_BYTE_PAIR(0xF6B1, 0x9C21)
+DOUBLE_BYTE_PAIR(0xF6B2, 0x9DB7)
+DOUBLE_BYTE_PAIR(0xF6B3, 0x9DB6)
+DOUBLE_BYTE_PAIR(0xF6B4, 0x9DBC)
+DOUBLE_BYTE_PAIR(0xF6B5, 0x9DC1)
+DOUBLE_BYTE_PAIR(0xF6B6, 0x9DC7)
+DOUBLE_BYTE_PAIR(0xF6B7, 0x9DCA)
+DOUBLE_BYTE_PAIR(0xF6B8, 0x9DCF)
+DOUBLE_BYTE_PAIR(0xF6B9, 0x9DBE)
+DOUBLE_BYTE_PAIR(0xF6BA, 0x9DC5)
+DOUBLE_BYTE_PAIR(0xF6BB, 0x9DC3)
+DOUBLE_BYTE_PAIR(0xF6BC, 0x9DBB)
+DOUBLE_BYTE_PAIR(0xF6BD, 0x9DB5)
+DOUBLE_BYTE_PAIR(0xF6BE, 0x9DCE)
+DOUBLE_BYTE_PAIR(0xF6BF, 0x9DB9)
+DOUBLE_BYTE_PAIR(0xF6C0, 0x9DBA)
+DOUBLE_BYTE_PAIR(0xF6C1, 0x9DAC)
+DOUBLE_BYTE_PAIR(0xF6C2, 0x9DC8)
+DOUBLE_BYTE_PAIR(0xF6C3, 0x9DB1)
+DOUBLE_BYTE_PAIR(0xF6C4, 0x9DAD)
+DOUBLE_BYTE_PAIR(0xF6C5, 0x9DCC)
+DOUBLE_BYTE_PAIR(0xF6C6, 0x9DB3)
+DOUBLE_BYTE_PAIR(0xF6C7, 0x9DCD)
+DOUBLE_BYTE_PAIR(0xF6C8, 0x9DB2)
+DOUBLE_BYTE_PAIR(0xF6C9, 0x9E7A)
+DOUBLE_BYTE_PAIR(0xF6CA, 0x9E9C)
+DOUBLE_BYTE_PAIR(0xF6CB, 0x9EEB)
+DOUBLE_BYTE_PAIR(0xF6CC, 0x9EEE)
+DOUBLE_BYTE_PAIR(0xF6CD, 0x9EED)
+DOUBLE_BYTE_PAIR(0xF6CE, 0x9F1B)
+DOUBLE_BYTE_PAIR(0xF6CF, 0x9F18)
+DOUBLE_BYTE_PAIR(0xF6D0, 0x9F1A)
+DOUBLE_BYTE_PAIR(0xF6D1, 0x9F31)
+DOUBLE_BYTE_PAIR(0xF6D2, 0x9F4E)
+DOUBLE_BYTE_PAIR(0xF6D3, 0x9F65)
+DOUBLE_BYTE_PAIR(0xF6D4, 0x9F64)
+DOUBLE_BYTE_PAIR(0xF6D5, 0x9F92)
+DOUBLE_BYTE_PAIR(0xF6D6, 0x4EB9)
+DOUBLE_BYTE_PAIR(0xF6D7, 0x56C6)
+DOUBLE_BYTE_PAIR(0xF6D8, 0x56C5)
+DOUBLE_BYTE_PAIR(0xF6D9, 0x56CB)
+DOUBLE_BYTE_PAIR(0xF6DA, 0x5971)
+DOUBLE_BYTE_PAIR(0xF6DB, 0x5B4B)
+DOUBLE_BYTE_PAIR(0xF6DC, 0x5B4C)
+DOUBLE_BYTE_PAIR(0xF6DD, 0x5DD5)
+DOUBLE_BYTE_PAIR(0xF6DE, 0x5DD1)
+DOUBLE_BYTE_PAIR(0xF6DF, 0x5EF2)
+DOUBLE_BYTE_PAIR(0xF6E0, 0x6521)
+DOUBLE_BYTE_PAIR(0xF6E1, 0x6520)
+DOUBLE_BYTE_PAIR(0xF6E2, 0x6526)
+DOUBLE_BYTE_PAIR(0xF6E3, 0x6522)
+DOUBLE_BYTE_PAIR(0xF6E4, 0x6B0B)
+DOUBLE_BYTE_PAIR(0xF6E5, 0x6B08)
+DOUBLE_BYTE_PAIR(0xF6E6, 0x6B09)
+DOUBLE_BYTE_PAIR(0xF6E7, 0x6C0D)
+DOUBLE_BYTE_PAIR(0xF6E8, 0x7055)
+DOUBLE_BYTE_PAIR(0xF6E9, 0x7056)
+DOUBLE_BYTE_PAIR(0xF6EA, 0x7057)
+DOUBLE_BYTE_PAIR(0xF6EB, 0x7052)
+DOUBLE_BYTE_PAIR(0xF6EC, 0x721E)
+DOUBLE_BYTE_PAIR(0xF6ED, 0x721F)
+DOUBLE_BYTE_PAIR(0xF6EE, 0x72A9)
+DOUBLE_BYTE_PAIR(0xF6EF, 0x737F)
+DOUBLE_BYTE_PAIR(0xF6F0, 0x74D8)
+DOUBLE_BYTE_PAIR(0xF6F1, 0x74D5)
+DOUBLE_BYTE_PAIR(0xF6F2, 0x74D9)
+DOUBLE_BYTE_PAIR(0xF6F3, 0x74D7)
+DOUBLE_BYTE_PAIR(0xF6F4, 0x766D)
+DOUBLE_BYTE_PAIR(0xF6F5, 0x76AD)
+DOUBLE_BYTE_PAIR(0xF6F6, 0x7935)
+DOUBLE_BYTE_PAIR(0xF6F7, 0x79B4)
+DOUBLE_BYTE_PAIR(0xF6F8, 0x7A70)
+DOUBLE_BYTE_PAIR(0xF6F9, 0x7A71)
+DOUBLE_BYTE_PAIR(0xF6FA, 0x7C57)
+DOUBLE_BYTE_PAIR(0xF6FB, 0x7C5C)
+DOUBLE_BYTE_PAIR(0xF6FC, 0x7C59)
+DOUBLE_BYTE_PAIR(0xF6FD, 0x7C5B)
+DOUBLE_BYTE_PAIR(0xF6FE, 0x7C5A)
+DOUBLE_BYTE_PAIR(0xF740, 0x7CF4)
+DOUBLE_BYTE_PAIR(0xF741, 0x7CF1)
+DOUBLE_BYTE_PAIR(0xF742, 0x7E91)
+DOUBLE_BYTE_PAIR(0xF743, 0x7F4F)
+DOUBLE_BYTE_PAIR(0xF744, 0x7F87)
+DOUBLE_BYTE_PAIR(0xF745, 0x81DE)
+DOUBLE_BYTE_PAIR(0xF746, 0x826B)
+DOUBLE_BYTE_PAIR(0xF747, 0x8634)
+DOUBLE_BYTE_PAIR(0xF748, 0x8635)
+DOUBLE_BYTE_PAIR(0xF749, 0x8633)
+DOUBLE_BYTE_PAIR(0xF74A, 0x862C)
+DOUBLE_BYTE_PAIR(0xF74B, 0x8632)
+DOUBLE_BYTE_PAIR(0xF74C, 0x8636)
+DOUBLE_BYTE_PAIR(0xF74D, 0x882C)
+DOUBLE_BYTE_PAIR(0xF74E, 0x8828)
+DOUBLE_BYTE_PAIR(0xF74F, 0x8826)
+DOUBLE_BYTE_PAIR(0xF750, 0x882A)
+DOUBLE_BYTE_PAIR(0xF751, 0x8825)
+DOUBLE_BYTE_PAIR(0xF752, 0x8971)
+DOUBLE_BYTE_PAIR(0xF753, 0x89BF)
+DOUBLE_BYTE_PAIR(0xF754, 0x89BE)
+DOUBLE_BYTE_PAIR(0xF755, 0x89FB)
+DOUBLE_BYTE_PAIR(0xF756, 0x8B7E)
+DOUBLE_BYTE_PAIR(0xF757, 0x8B84)
+DOUBLE_BYTE_PAIR(0xF758, 0x8B82)
+DOUBLE_BYTE_PAIR(0xF759, 0x8B86)
+DOUBLE_BYTE_PAIR(0xF75A, 0x8B85)
+DOUBLE_BYTE_PAIR(0xF75B, 0x8B7F)
+DOUBLE_BYTE_PAIR(0xF75C, 0x8D15)
+DOUBLE_BYTE_PAIR(0xF75D, 0x8E95)
+DOUBLE_BYTE_PAIR(0xF75E, 0x8E94)
+DOUBLE_BYTE_PAIR(0xF75F, 0x8E9A)
+DOUBLE_BYTE_PAIR(0xF760, 0x8E92)
+DOUBLE_BYTE_PAIR(0xF761, 0x8E90)
+DOUBLE_BYTE_PAIR(0xF762, 0x8E96)
+DOUBLE_BYTE_PAIR(0xF763, 0x8E97)
+DOUBLE_BYTE_PAIR(0xF764, 0x8F60)
+DOUBLE_BYTE_PAIR(0xF765, 0x8F62)
+DOUBLE_BYTE_PAIR(0xF766, 0x9147)
+DOUBLE_BYTE_PAIR(0xF767, 0x944C)
+DOUBLE_BYTE_PAIR(0xF768, 0x9450)
+DOUBLE_BYTE_PAIR(0xF769, 0x944A)
+DOUBLE_BYTE_PAIR(0xF76A, 0x944B)
+DOUBLE_BYTE_PAIR(0xF76B, 0x944F)
+DOUBLE_BYTE_PAIR(0xF76C, 0x9447)
+DOUBLE_BYTE_PAIR(0xF76D, 0x9445)
+DOUBLE_BYTE_PAIR(0xF76E, 0x9448)
+DOUBLE_BYTE_PAIR(0xF76F, 0x9449)
+DOUBLE_BYTE_PAIR(0xF770, 0x9446)
+DOUBLE_BYTE_PAIR(0xF771, 0x973F)
+DOUBLE_BYTE_PAIR(0xF772, 0x97E3)
+DOUBLE_BYTE_PAIR(0xF773, 0x986A)
+DOUBLE_BYTE_PAIR(0xF774, 0x9869)
+DOUBLE_BYTE_PAIR(0xF775, 0x98CB)
+DOUBLE_BYTE_PAIR(0xF776, 0x9954)
+DOUBLE_BYTE_PAIR(0xF777, 0x995B)
+DOUBLE_BYTE_PAIR(0xF778, 0x9A4E)
+DOUBLE_BYTE_PAIR(0xF779, 0x9A53)
+DOUBLE_BYTE_PAIR(0xF77A, 0x9A54)
+DOUBLE_BYTE_PAIR(0xF77B, 0x9A4C)
+DOUBLE_BYTE_PAIR(0xF77C, 0x9A4F)
+DOUBLE_BYTE_PAIR(0xF77D, 0x9A48)
+DOUBLE_BYTE_PAIR(0xF77E, 0x9A4A)
+DOUBLE_BYTE_PAIR(0xF7A1, 0x9A49)
+DOUBLE_BYTE_PAIR(0xF7A2, 0x9A52)
+DOUBLE_BYTE_PAIR(0xF7A3, 0x9A50)
+DOUBLE_BYTE_PAIR(0xF7A4, 0x9AD0)
+DOUBLE_BYTE_PAIR(0xF7A5, 0x9B19)
+DOUBLE_BYTE_PAIR(0xF7A6, 0x9B2B)
+DOUBLE_BYTE_PAIR(0xF7A7, 0x9B3B)
+DOUBLE_BYTE_PAIR(0xF7A8, 0x9B56)
+DOUBLE_BYTE_PAIR(0xF7A9, 0x9B55)
+DOUBLE_BYTE_PAIR(0xF7AA, 0x9C46)
+DOUBLE_BYTE_PAIR(0xF7AB, 0x9C48)
+DOUBLE_BYTE_PAIR(0xF7AC, 0x9C3F)
+DOUBLE_BYTE_PAIR(0xF7AD, 0x9C44)
+DOUBLE_BYTE_PAIR(0xF7AE, 0x9C39)
+DOUBLE_BYTE_PAIR(0xF7AF, 0x9C33)
+DOUBLE_BYTE_PAIR(0xF7B0, 0x9C41)
+DOUBLE_BYTE_PAIR(0xF7B1, 0x9C3C)
+DOUBLE_BYTE_PAIR(0xF7B2, 0x9C37)
+DOUBLE_BYTE_PAIR(0xF7B3, 0x9C34)
+DOUBLE_BYTE_PAIR(0xF7B4, 0x9C32)
+DOUBLE_BYTE_PAIR(0xF7B5, 0x9C3D)
+DOUBLE_BYTE_PAIR(0xF7B6, 0x9C36)
+DOUBLE_BYTE_PAIR(0xF7B7, 0x9DDB)
+DOUBLE_BYTE_PAIR(0xF7B8, 0x9DD2)
+DOUBLE_BYTE_PAIR(0xF7B9, 0x9DDE)
+DOUBLE_BYTE_PAIR(0xF7BA, 0x9DDA)
+DOUBLE_BYTE_PAIR(0xF7BB, 0x9DCB)
+DOUBLE_BYTE_PAIR(0xF7BC, 0x9DD0)
+DOUBLE_BYTE_PAIR(0xF7BD, 0x9DDC)
+DOUBLE_BYTE_PAIR(0xF7BE, 0x9DD1)
+DOUBLE_BYTE_PAIR(0xF7BF, 0x9DDF)
+DOUBLE_BYTE_PAIR(0xF7C0, 0x9DE9)
+DOUBLE_BYTE_PAIR(0xF7C1, 0x9DD9)
+DOUBLE_BYTE_PAIR(0xF7C2, 0x9DD8)
+DOUBLE_BYTE_PAIR(0xF7C3, 0x9DD6)
+DOUBLE_BYTE_PAIR(0xF7C4, 0x9DF5)
+DOUBLE_BYTE_PAIR(0xF7C5, 0x9DD5)
+DOUBLE_BYTE_PAIR(0xF7C6, 0x9DDD)
+DOUBLE_BYTE_PAIR(0xF7C7, 0x9EB6)
+DOUBLE_BYTE_PAIR(0xF7C8, 0x9EF0)
+DOUBLE_BYTE_PAIR(0xF7C9, 0x9F35)
+DOUBLE_BYTE_PAIR(0xF7CA, 0x9F33)
+DOUBLE_BYTE_PAIR(0xF7CB, 0x9F32)
+DOUBLE_BYTE_PAIR(0xF7CC, 0x9F42)
+DOUBLE_BYTE_PAIR(0xF7CD, 0x9F6B)
+DOUBLE_BYTE_PAIR(0xF7CE, 0x9F95)
+DOUBLE_BYTE_PAIR(0xF7CF, 0x9FA2)
+DOUBLE_BYTE_PAIR(0xF7D0, 0x513D)
+DOUBLE_BYTE_PAIR(0xF7D1, 0x5299)
+DOUBLE_BYTE_PAIR(0xF7D2, 0x58E8)
+DOUBLE_BYTE_PAIR(0xF7D3, 0x58E7)
+DOUBLE_BYTE_PAIR(0xF7D4, 0x5972)
+DOUBLE_BYTE_PAIR(0xF7D5, 0x5B4D)
+DOUBLE_BYTE_PAIR(0xF7D6, 0x5DD8)
+DOUBLE_BYTE_PAIR(0xF7D7, 0x882F)
+DOUBLE_BYTE_PAIR(0xF7D8, 0x5F4F)
+DOUBLE_BYTE_PAIR(0xF7D9, 0x6201)
+DOUBLE_BYTE_PAIR(0xF7DA, 0x6203)
+DOUBLE_BYTE_PAIR(0xF7DB, 0x6204)
+DOUBLE_BYTE_PAIR(0xF7DC, 0x6529)
+DOUBLE_BYTE_PAIR(0xF7DD, 0x6525)
+DOUBLE_BYTE_PAIR(0xF7DE, 0x6596)
+DOUBLE_BYTE_PAIR(0xF7DF, 0x66EB)
+DOUBLE_BYTE_PAIR(0xF7E0, 0x6B11)
+DOUBLE_BYTE_PAIR(0xF7E1, 0x6B12)
+DOUBLE_BYTE_PAIR(0xF7E2, 0x6B0F)
+DOUBLE_BYTE_PAIR(0xF7E3, 0x6BCA)
+DOUBLE_BYTE_PAIR(0xF7E4, 0x705B)
+DOUBLE_BYTE_PAIR(0xF7E5, 0x705A)
+DOUBLE_BYTE_PAIR(0xF7E6, 0x7222)
+DOUBLE_BYTE_PAIR(0xF7E7, 0x7382)
+DOUBLE_BYTE_PAIR(0xF7E8, 0x7381)
+DOUBLE_BYTE_PAIR(0xF7E9, 0x7383)
+DOUBLE_BYTE_PAIR(0xF7EA, 0x7670)
+DOUBLE_BYTE_PAIR(0xF7EB, 0x77D4)
+DOUBLE_BYTE_PAIR(0xF7EC, 0x7C67)
+DOUBLE_BYTE_PAIR(0xF7ED, 0x7C66)
+DOUBLE_BYTE_PAIR(0xF7EE, 0x7E95)
+DOUBLE_BYTE_PAIR(0xF7EF, 0x826C)
+DOUBLE_BYTE_PAIR(0xF7F0, 0x863A)
+DOUBLE_BYTE_PAIR(0xF7F1, 0x8640)
+DOUBLE_BYTE_PAIR(0xF7F2, 0x8639)
+DOUBLE_BYTE_PAIR(0xF7F3, 0x863C)
+DOUBLE_BYTE_PAIR(0xF7F4, 0x8631)
+DOUBLE_BYTE_PAIR(0xF7F5, 0x863B)
+DOUBLE_BYTE_PAIR(0xF7F6, 0x863E)
+DOUBLE_BYTE_PAIR(0xF7F7, 0x8830)
+DOUBLE_BYTE_PAIR(0xF7F8, 0x8832)
+DOUBLE_BYTE_PAIR(0xF7F9, 0x882E)
+DOUBLE_BYTE_PAIR(0xF7FA, 0x8833)
+DOUBLE_BYTE_PAIR(0xF7FB, 0x8976)
+DOUBLE_BYTE_PAIR(0xF7FC, 0x8974)
+DOUBLE_BYTE_PAIR(0xF7FD, 0x8973)
+DOUBLE_BYTE_PAIR(0xF7FE, 0x89FE)
+DOUBLE_BYTE_PAIR(0xF840, 0x8B8C)
+DOUBLE_BYTE_PAIR(0xF841, 0x8B8E)
+DOUBLE_BYTE_PAIR(0xF842, 0x8B8B)
+DOUBLE_BYTE_PAIR(0xF843, 0x8B88)
+DOUBLE_BYTE_PAIR(0xF844, 0x8C45)
+DOUBLE_BYTE_PAIR(0xF845, 0x8D19)
+DOUBLE_BYTE_PAIR(0xF846, 0x8E98)
+DOUBLE_BYTE_PAIR(0xF847, 0x8F64)
+DOUBLE_BYTE_PAIR(0xF848, 0x8F63)
+DOUBLE_BYTE_PAIR(0xF849, 0x91BC)
+DOUBLE_BYTE_PAIR(0xF84A, 0x9462)
+DOUBLE_BYTE_PAIR(0xF84B, 0x9455)
+DOUBLE_BYTE_PAIR(0xF84C, 0x945D)
+DOUBLE_BYTE_PAIR(0xF84D, 0x9457)
+DOUBLE_BYTE_PAIR(0xF84E, 0x945E)
+DOUBLE_BYTE_PAIR(0xF84F, 0x97C4)
+DOUBLE_BYTE_PAIR(0xF850, 0x97C5)
+DOUBLE_BYTE_PAIR(0xF851, 0x9800)
+DOUBLE_BYTE_PAIR(0xF852, 0x9A56)
+DOUBLE_BYTE_PAIR(0xF853, 0x9A59)
+DOUBLE_BYTE_PAIR(0xF854, 0x9B1E)
+DOUBLE_BYTE_PAIR(0xF855, 0x9B1F)
+DOUBLE_BYTE_PAIR(0xF856, 0x9B20)
+DOUBLE_BYTE_PAIR(0xF857, 0x9C52)
+DOUBLE_BYTE_PAIR(0xF858, 0x9C58)
+DOUBLE_BYTE_PAIR(0xF859, 0x9C50)
+DOUBLE_BYTE_PAIR(0xF85A, 0x9C4A)
+DOUBLE_BYTE_PAIR(0xF85B, 0x9C4D)
+DOUBLE_BYTE_PAIR(0xF85C, 0x9C4B)
+DOUBLE_BYTE_PAIR(0xF85D, 0x9C55)
+DOUBLE_BYTE_PAIR(0xF85E, 0x9C59)
+DOUBLE_BYTE_PAIR(0xF85F, 0x9C4C)
+DOUBLE_BYTE_PAIR(0xF860, 0x9C4E)
+DOUBLE_BYTE_PAIR(0xF861, 0x9DFB)
+DOUBLE_BYTE_PAIR(0xF862, 0x9DF7)
+DOUBLE_BYTE_PAIR(0xF863, 0x9DEF)
+DOUBLE_BYTE_PAIR(0xF864, 0x9DE3)
+DOUBLE_BYTE_PAIR(0xF865, 0x9DEB)
+DOUBLE_BYTE_PAIR(0xF866, 0x9DF8)
+DOUBLE_BYTE_PAIR(0xF867, 0x9DE4)
+DOUBLE_BYTE_PAIR(0xF868, 0x9DF6)
+DOUBLE_BYTE_PAIR(0xF869, 0x9DE1)
+DOUBLE_BYTE_PAIR(0xF86A, 0x9DEE)
+DOUBLE_BYTE_PAIR(0xF86B, 0x9DE6)
+DOUBLE_BYTE_PAIR(0xF86C, 0x9DF2)
+DOUBLE_BYTE_PAIR(0xF86D, 0x9DF0)
+DOUBLE_BYTE_PAIR(0xF86E, 0x9DE2)
+DOUBLE_BYTE_PAIR(0xF86F, 0x9DEC)
+DOUBLE_BYTE_PAIR(0xF870, 0x9DF4)
+DOUBLE_BYTE_PAIR(0xF871, 0x9DF3)
+DOUBLE_BYTE_PAIR(0xF872, 0x9DE8)
+DOUBLE_BYTE_PAIR(0xF873, 0x9DED)
+DOUBLE_BYTE_PAIR(0xF874, 0x9EC2)
+DOUBLE_BYTE_PAIR(0xF875, 0x9ED0)
+DOUBLE_BYTE_PAIR(0xF876, 0x9EF2)
+DOUBLE_BYTE_PAIR(0xF877, 0x9EF3)
+DOUBLE_BYTE_PAIR(0xF878, 0x9F06)
+DOUBLE_BYTE_PAIR(0xF879, 0x9F1C)
+DOUBLE_BYTE_PAIR(0xF87A, 0x9F38)
+DOUBLE_BYTE_PAIR(0xF87B, 0x9F37)
+DOUBLE_BYTE_PAIR(0xF87C, 0x9F36)
+DOUBLE_BYTE_PAIR(0xF87D, 0x9F43)
+DOUBLE_BYTE_PAIR(0xF87E, 0x9F4F)
+DOUBLE_BYTE_PAIR(0xF8A1, 0x9F71)
+DOUBLE_BYTE_PAIR(0xF8A2, 0x9F70)
+DOUBLE_BYTE_PAIR(0xF8A3, 0x9F6E)
+DOUBLE_BYTE_PAIR(0xF8A4, 0x9F6F)
+DOUBLE_BYTE_PAIR(0xF8A5, 0x56D3)
+DOUBLE_BYTE_PAIR(0xF8A6, 0x56CD)
+DOUBLE_BYTE_PAIR(0xF8A7, 0x5B4E)
+DOUBLE_BYTE_PAIR(0xF8A8, 0x5C6D)
+DOUBLE_BYTE_PAIR(0xF8A9, 0x652D)
+DOUBLE_BYTE_PAIR(0xF8AA, 0x66ED)
+DOUBLE_BYTE_PAIR(0xF8AB, 0x66EE)
+DOUBLE_BYTE_PAIR(0xF8AC, 0x6B13)
+DOUBLE_BYTE_PAIR(0xF8AD, 0x705F)
+DOUBLE_BYTE_PAIR(0xF8AE, 0x7061)
+DOUBLE_BYTE_PAIR(0xF8AF, 0x705D)
+DOUBLE_BYTE_PAIR(0xF8B0, 0x7060)
+DOUBLE_BYTE_PAIR(0xF8B1, 0x7223)
+DOUBLE_BYTE_PAIR(0xF8B2, 0x74DB)
+DOUBLE_BYTE_PAIR(0xF8B3, 0x74E5)
+DOUBLE_BYTE_PAIR(0xF8B4, 0x77D5)
+DOUBLE_BYTE_PAIR(0xF8B5, 0x7938)
+DOUBLE_BYTE_PAIR(0xF8B6, 0x79B7)
+DOUBLE_BYTE_PAIR(0xF8B7, 0x79B6)
+DOUBLE_BYTE_PAIR(0xF8B8, 0x7C6A)
+DOUBLE_BYTE_PAIR(0xF8B9, 0x7E97)
+DOUBLE_BYTE_PAIR(0xF8BA, 0x7F89)
+DOUBLE_BYTE_PAIR(0xF8BB, 0x826D)
+DOUBLE_BYTE_PAIR(0xF8BC, 0x8643)
+DOUBLE_BYTE_PAIR(0xF8BD, 0x8838)
+DOUBLE_BYTE_PAIR(0xF8BE, 0x8837)
+DOUBLE_BYTE_PAIR(0xF8BF, 0x8835)
+DOUBLE_BYTE_PAIR(0xF8C0, 0x884B)
+DOUBLE_BYTE_PAIR(0xF8C1, 0x8B94)
+DOUBLE_BYTE_PAIR(0xF8C2, 0x8B95)
+DOUBLE_BYTE_PAIR(0xF8C3, 0x8E9E)
+DOUBLE_BYTE_PAIR(0xF8C4, 0x8E9F)
+DOUBLE_BYTE_PAIR(0xF8C5, 0x8EA0)
+DOUBLE_BYTE_PAIR(0xF8C6, 0x8E9D)
+DOUBLE_BYTE_PAIR(0xF8C7, 0x91BE)
+DOUBLE_BYTE_PAIR(0xF8C8, 0x91BD)
+DOUBLE_BYTE_PAIR(0xF8C9, 0x91C2)
+DOUBLE_BYTE_PAIR(0xF8CA, 0x946B)
+DOUBLE_BYTE_PAIR(0xF8CB, 0x9468)
+DOUBLE_BYTE_PAIR(0xF8CC, 0x9469)
+DOUBLE_BYTE_PAIR(0xF8CD, 0x96E5)
+DOUBLE_BYTE_PAIR(0xF8CE, 0x9746)
+DOUBLE_BYTE_PAIR(0xF8CF, 0x9743)
+DOUBLE_BYTE_PAIR(0xF8D0, 0x9747)
+DOUBLE_BYTE_PAIR(0xF8D1, 0x97C7)
+DOUBLE_BYTE_PAIR(0xF8D2, 0x97E5)
+DOUBLE_BYTE_PAIR(0xF8D3, 0x9A5E)
+DOUBLE_BYTE_PAIR(0xF8D4, 0x9AD5)
+DOUBLE_BYTE_PAIR(0xF8D5, 0x9B59)
+DOUBLE_BYTE_PAIR(0xF8D6, 0x9C63)
+DOUBLE_BYTE_PAIR(0xF8D7, 0x9C67)
+DOUBLE_BYTE_PAIR(0xF8D8, 0x9C66)
+DOUBLE_BYTE_PAIR(0xF8D9, 0x9C62)
+DOUBLE_BYTE_PAIR(0xF8DA, 0x9C5E)
+DOUBLE_BYTE_PAIR(0xF8DB, 0x9C60)
+DOUBLE_BYTE_PAIR(0xF8DC, 0x9E02)
+DOUBLE_BYTE_PAIR(0xF8DD, 0x9DFE)
+DOUBLE_BYTE_PAIR(0xF8DE, 0x9E07)
+DOUBLE_BYTE_PAIR(0xF8DF, 0x9E03)
+DOUBLE_BYTE_PAIR(0xF8E0, 0x9E06)
+DOUBLE_BYTE_PAIR(0xF8E1, 0x9E05)
+DOUBLE_BYTE_PAIR(0xF8E2, 0x9E00)
+DOUBLE_BYTE_PAIR(0xF8E3, 0x9E01)
+DOUBLE_BYTE_PAIR(0xF8E4, 0x9E09)
+DOUBLE_BYTE_PAIR(0xF8E5, 0x9DFF)
+DOUBLE_BYTE_PAIR(0xF8E6, 0x9DFD)
+DOUBLE_BYTE_PAIR(0xF8E7, 0x9E04)
+DOUBLE_BYTE_PAIR(0xF8E8, 0x9EA0)
+DOUBLE_BYTE_PAIR(0xF8E9, 0x9F1E)
+DOUBLE_BYTE_PAIR(0xF8EA, 0x9F46)
+DOUBLE_BYTE_PAIR(0xF8EB, 0x9F74)
+DOUBLE_BYTE_PAIR(0xF8EC, 0x9F75)
+DOUBLE_BYTE_PAIR(0xF8ED, 0x9F76)
+DOUBLE_BYTE_PAIR(0xF8EE, 0x56D4)
+DOUBLE_BYTE_PAIR(0xF8EF, 0x652E)
+DOUBLE_BYTE_PAIR(0xF8F0, 0x65B8)
+DOUBLE_BYTE_PAIR(0xF8F1, 0x6B18)
+DOUBLE_BYTE_PAIR(0xF8F2, 0x6B19)
+DOUBLE_BYTE_PAIR(0xF8F3, 0x6B17)
+DOUBLE_BYTE_PAIR(0xF8F4, 0x6B1A)
+DOUBLE_BYTE_PAIR(0xF8F5, 0x7062)
+DOUBLE_BYTE_PAIR(0xF8F6, 0x7226)
+DOUBLE_BYTE_PAIR(0xF8F7, 0x72AA)
+DOUBLE_BYTE_PAIR(0xF8F8, 0x77D8)
+DOUBLE_BYTE_PAIR(0xF8F9, 0x77D9)
+DOUBLE_BYTE_PAIR(0xF8FA, 0x7939)
+DOUBLE_BYTE_PAIR(0xF8FB, 0x7C69)
+DOUBLE_BYTE_PAIR(0xF8FC, 0x7C6B)
+DOUBLE_BYTE_PAIR(0xF8FD, 0x7CF6)
+DOUBLE_BYTE_PAIR(0xF8FE, 0x7E9A)
+DOUBLE_BYTE_PAIR(0xF940, 0x7E98)
+DOUBLE_BYTE_PAIR(0xF941, 0x7E9B)
+DOUBLE_BYTE_PAIR(0xF942, 0x7E99)
+DOUBLE_BYTE_PAIR(0xF943, 0x81E0)
+DOUBLE_BYTE_PAIR(0xF944, 0x81E1)
+DOUBLE_BYTE_PAIR(0xF945, 0x8646)
+DOUBLE_BYTE_PAIR(0xF946, 0x8647)
+DOUBLE_BYTE_PAIR(0xF947, 0x8648)
+DOUBLE_BYTE_PAIR(0xF948, 0x8979)
+DOUBLE_BYTE_PAIR(0xF949, 0x897A)
+DOUBLE_BYTE_PAIR(0xF94A, 0x897C)
+DOUBLE_BYTE_PAIR(0xF94B, 0x897B)
+DOUBLE_BYTE_PAIR(0xF94C, 0x89FF)
+DOUBLE_BYTE_PAIR(0xF94D, 0x8B98)
+DOUBLE_BYTE_PAIR(0xF94E, 0x8B99)
+DOUBLE_BYTE_PAIR(0xF94F, 0x8EA5)
+DOUBLE_BYTE_PAIR(0xF950, 0x8EA4)
+DOUBLE_BYTE_PAIR(0xF951, 0x8EA3)
+DOUBLE_BYTE_PAIR(0xF952, 0x946E)
+DOUBLE_BYTE_PAIR(0xF953, 0x946D)
+DOUBLE_BYTE_PAIR(0xF954, 0x946F)
+DOUBLE_BYTE_PAIR(0xF955, 0x9471)
+DOUBLE_BYTE_PAIR(0xF956, 0x9473)
+DOUBLE_BYTE_PAIR(0xF957, 0x9749)
+DOUBLE_BYTE_PAIR(0xF958, 0x9872)
+DOUBLE_BYTE_PAIR(0xF959, 0x995F)
+DOUBLE_BYTE_PAIR(0xF95A, 0x9C68)
+DOUBLE_BYTE_PAIR(0xF95B, 0x9C6E)
+DOUBLE_BYTE_PAIR(0xF95C, 0x9C6D)
+DOUBLE_BYTE_PAIR(0xF95D, 0x9E0B)
+DOUBLE_BYTE_PAIR(0xF95E, 0x9E0D)
+DOUBLE_BYTE_PAIR(0xF95F, 0x9E10)
+DOUBLE_BYTE_PAIR(0xF960, 0x9E0F)
+DOUBLE_BYTE_PAIR(0xF961, 0x9E12)
+DOUBLE_BYTE_PAIR(0xF962, 0x9E11)
+DOUBLE_BYTE_PAIR(0xF963, 0x9EA1)
+DOUBLE_BYTE_PAIR(0xF964, 0x9EF5)
+DOUBLE_BYTE_PAIR(0xF965, 0x9F09)
+DOUBLE_BYTE_PAIR(0xF966, 0x9F47)
+DOUBLE_BYTE_PAIR(0xF967, 0x9F78)
+DOUBLE_BYTE_PAIR(0xF968, 0x9F7B)
+DOUBLE_BYTE_PAIR(0xF969, 0x9F7A)
+DOUBLE_BYTE_PAIR(0xF96A, 0x9F79)
+DOUBLE_BYTE_PAIR(0xF96B, 0x571E)
+DOUBLE_BYTE_PAIR(0xF96C, 0x7066)
+DOUBLE_BYTE_PAIR(0xF96D, 0x7C6F)
+DOUBLE_BYTE_PAIR(0xF96E, 0x883C)
+DOUBLE_BYTE_PAIR(0xF96F, 0x8DB2)
+DOUBLE_BYTE_PAIR(0xF970, 0x8EA6)
+DOUBLE_BYTE_PAIR(0xF971, 0x91C3)
+DOUBLE_BYTE_PAIR(0xF972, 0x9474)
+DOUBLE_BYTE_PAIR(0xF973, 0x9478)
+DOUBLE_BYTE_PAIR(0xF974, 0x9476)
+DOUBLE_BYTE_PAIR(0xF975, 0x9475)
+DOUBLE_BYTE_PAIR(0xF976, 0x9A60)
+DOUBLE_BYTE_PAIR(0xF977, 0x9C74)
+DOUBLE_BYTE_PAIR(0xF978, 0x9C73)
+DOUBLE_BYTE_PAIR(0xF979, 0x9C71)
+DOUBLE_BYTE_PAIR(0xF97A, 0x9C75)
+DOUBLE_BYTE_PAIR(0xF97B, 0x9E14)
+DOUBLE_BYTE_PAIR(0xF97C, 0x9E13)
+DOUBLE_BYTE_PAIR(0xF97D, 0x9EF6)
+DOUBLE_BYTE_PAIR(0xF97E, 0x9F0A)
+DOUBLE_BYTE_PAIR(0xF9A1, 0x9FA4)
+DOUBLE_BYTE_PAIR(0xF9A2, 0x7068)
+DOUBLE_BYTE_PAIR(0xF9A3, 0x7065)
+DOUBLE_BYTE_PAIR(0xF9A4, 0x7CF7)
+DOUBLE_BYTE_PAIR(0xF9A5, 0x866A)
+DOUBLE_BYTE_PAIR(0xF9A6, 0x883E)
+DOUBLE_BYTE_PAIR(0xF9A7, 0x883D)
+DOUBLE_BYTE_PAIR(0xF9A8, 0x883F)
+DOUBLE_BYTE_PAIR(0xF9A9, 0x8B9E)
+DOUBLE_BYTE_PAIR(0xF9AA, 0x8C9C)
+DOUBLE_BYTE_PAIR(0xF9AB, 0x8EA9)
+DOUBLE_BYTE_PAIR(0xF9AC, 0x8EC9)
+DOUBLE_BYTE_PAIR(0xF9AD, 0x974B)
+DOUBLE_BYTE_PAIR(0xF9AE, 0x9873)
+DOUBLE_BYTE_PAIR(0xF9AF, 0x9874)
+DOUBLE_BYTE_PAIR(0xF9B0, 0x98CC)
+DOUBLE_BYTE_PAIR(0xF9B1, 0x9961)
+DOUBLE_BYTE_PAIR(0xF9B2, 0x99AB)
+DOUBLE_BYTE_PAIR(0xF9B3, 0x9A64)
+DOUBLE_BYTE_PAIR(0xF9B4, 0x9A66)
+DOUBLE_BYTE_PAIR(0xF9B5, 0x9A67)
+DOUBLE_BYTE_PAIR(0xF9B6, 0x9B24)
+DOUBLE_BYTE_PAIR(0xF9B7, 0x9E15)
+DOUBLE_BYTE_PAIR(0xF9B8, 0x9E17)
+DOUBLE_BYTE_PAIR(0xF9B9, 0x9F48)
+DOUBLE_BYTE_PAIR(0xF9BA, 0x6207)
+DOUBLE_BYTE_PAIR(0xF9BB, 0x6B1E)
+DOUBLE_BYTE_PAIR(0xF9BC, 0x7227)
+DOUBLE_BYTE_PAIR(0xF9BD, 0x864C)
+DOUBLE_BYTE_PAIR(0xF9BE, 0x8EA8)
+DOUBLE_BYTE_PAIR(0xF9BF, 0x9482)
+DOUBLE_BYTE_PAIR(0xF9C0, 0x9480)
+DOUBLE_BYTE_PAIR(0xF9C1, 0x9481)
+DOUBLE_BYTE_PAIR(0xF9C2, 0x9A69)
+DOUBLE_BYTE_PAIR(0xF9C3, 0x9A68)
+DOUBLE_BYTE_PAIR(0xF9C4, 0x9B2E)
+DOUBLE_BYTE_PAIR(0xF9C5, 0x9E19)
+DOUBLE_BYTE_PAIR(0xF9C6, 0x7229)
+DOUBLE_BYTE_PAIR(0xF9C7, 0x864B)
+DOUBLE_BYTE_PAIR(0xF9C8, 0x8B9F)
+DOUBLE_BYTE_PAIR(0xF9C9, 0x9483)
+DOUBLE_BYTE_PAIR(0xF9CA, 0x9C79)
+DOUBLE_BYTE_PAIR(0xF9CB, 0x9EB7)
+DOUBLE_BYTE_PAIR(0xF9CC, 0x7675)
+DOUBLE_BYTE_PAIR(0xF9CD, 0x9A6B)
+DOUBLE_BYTE_PAIR(0xF9CE, 0x9C7A)
+DOUBLE_BYTE_PAIR(0xF9CF, 0x9E1D)
+DOUBLE_BYTE_PAIR(0xF9D0, 0x7069)
+DOUBLE_BYTE_PAIR(0xF9D1, 0x706A)
+DOUBLE_BYTE_PAIR(0xF9D2, 0x9EA4)
+DOUBLE_BYTE_PAIR(0xF9D3, 0x9F7E)
+DOUBLE_BYTE_PAIR(0xF9D4, 0x9F49)
+DOUBLE_BYTE_PAIR(0xF9D5, 0x9F98)
+DOUBLE_BYTE_PAIR(0xF9D6, 0x7881)
+DOUBLE_BYTE_PAIR(0xF9D7, 0x92B9)
+DOUBLE_BYTE_PAIR(0xF9D8, 0x88CF)
+DOUBLE_BYTE_PAIR(0xF9D9, 0x58BB)
+DOUBLE_BYTE_PAIR(0xF9DA, 0x6052)
+DOUBLE_BYTE_PAIR(0xF9DB, 0x7CA7)
+DOUBLE_BYTE_PAIR(0xF9DC, 0x5AFA)
+DOUBLE_BYTE_PAIR(0xF9DD, 0x2554)
+DOUBLE_BYTE_PAIR(0xF9DE, 0x2566)
+DOUBLE_BYTE_PAIR(0xF9DF, 0x2557)
+DOUBLE_BYTE_PAIR(0xF9E0, 0x2560)
+DOUBLE_BYTE_PAIR(0xF9E1, 0x256C)
+DOUBLE_BYTE_PAIR(0xF9E2, 0x2563)
+DOUBLE_BYTE_PAIR(0xF9E3, 0x255A)
+DOUBLE_BYTE_PAIR(0xF9E4, 0x2569)
+DOUBLE_BYTE_PAIR(0xF9E5, 0x255D)
+DOUBLE_BYTE_PAIR(0xF9E6, 0x2552)
+DOUBLE_BYTE_PAIR(0xF9E7, 0x2564)
+DOUBLE_BYTE_PAIR(0xF9E8, 0x2555)
+DOUBLE_BYTE_PAIR(0xF9E9, 0x255E)
+DOUBLE_BYTE_PAIR(0xF9EA, 0x256A)
+DOUBLE_BYTE_PAIR(0xF9EB, 0x2561)
+DOUBLE_BYTE_PAIR(0xF9EC, 0x2558)
+DOUBLE_BYTE_PAIR(0xF9ED, 0x2567)
+DOUBLE_BYTE_PAIR(0xF9EE, 0x255B)
+DOUBLE_BYTE_PAIR(0xF9EF, 0x2553)
+DOUBLE_BYTE_PAIR(0xF9F0, 0x2565)
+DOUBLE_BYTE_PAIR(0xF9F1, 0x2556)
+DOUBLE_BYTE_PAIR(0xF9F2, 0x255F)
+DOUBLE_BYTE_PAIR(0xF9F3, 0x256B)
+DOUBLE_BYTE_PAIR(0xF9F4, 0x2562)
+DOUBLE_BYTE_PAIR(0xF9F5, 0x2559)
+DOUBLE_BYTE_PAIR(0xF9F6, 0x2568)
+DOUBLE_BYTE_PAIR(0xF9F7, 0x255C)
+DOUBLE_BYTE_PAIR(0xF9F8, 0x2551)
+DOUBLE_BYTE_PAIR(0xF9F9, 0x2550)
+DOUBLE_BYTE_PAIR(0xF9FA, 0x256D)
+DOUBLE_BYTE_PAIR(0xF9FB, 0x256E)
+DOUBLE_BYTE_PAIR(0xF9FC, 0x2570)
+DOUBLE_BYTE_PAIR(0xF9FD, 0x256F)
+DOUBLE_BYTE_PAIR(0xF9FE, 0x2593)
+
+#undef DOUBLE_BYTE_PAIR
@@ -0,0 +1,17181 @@
+// This file is generated from https://www.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP949.TXT
+// DO NOT EDIT!
+
+DOUBLE_BYTE_PAIR(0x00, 0x0000)
+DOUBLE_BYTE_PAIR(0x01, 0x0001)
+DOUBLE_BYTE_PAIR(0x02, 0x0002)
+DOUBLE_BYTE_PAIR(0x03, 0x0003)
+DOUBLE_BYTE_PAIR(0x04, 0x0004)
+DOUBLE_BYTE_PAIR(0x05, 0x0005)
+DOUBLE_BYTE_PAIR(0x06, 0x0006)
+DOUBLE_BYTE_PAIR(0x07, 0x0007)
+DOUBLE_BYTE_PAIR(0x08, 0x0008)
+DOUBLE_BYTE_PAIR(0x09, 0x0009)
+DOUBLE_BYTE_PAIR(0x0A, 0x000A)
+DOUBLE_BYTE_PAIR(0x0B, 0x000B)
+DOUBLE_BYTE_PAIR(0x0C, 0x000C)
+DOUBLE_BYTE_PAIR(0x0D, 0x000D)
+DOUBLE_BYTE_PAIR(0x0E, 0x000E)
+DOUBLE_BYTE_PAIR(0x0F, 0x000F)
+DOUBLE_BYTE_PAIR(0x10, 0x0010)
+DOUBLE_BYTE_PAIR(0x11, 0x0011)
+DOUBLE_BYTE_PAIR(0x12, 0x0012)
+DOUBLE_BYTE_PAIR(0x13, 0x0013)
+DOUBLE_BYTE_PAIR(0x14, 0x0014)
+DOUBLE_BYTE_PAIR(0x15, 0x0015)
+DOUBLE_BYTE_PAIR(0x16, 0x0016)
+DOUBLE_BYTE_PAIR(0x17, 0x0017)
+DOUBLE_BYTE_PAIR(0x18, 0x0018)
+DOUBLE_BYTE_PAIR(0x19, 0x0019)
+DOUBLE_BYTE_PAIR(0x1A, 0x001A)
+DOUBLE_BYTE_PAIR(0x1B, 0x001B)
+DOUBLE_BYTE_PAIR(0x1C, 0x001C)
+DOUBLE_BYTE_PAIR(0x1D, 0x001D)
+DOUBLE_BYTE_PAIR(0x1E, 0x001E)
+DOUBLE_BYTE_PAIR(0x1F, 0x001F)
+DOUBLE_BYTE_PAIR(0x20, 0x0020)
+DOUBLE_BYTE_PAIR(0x21, 0x0021)
+DOUBLE_BYTE_PAIR(0x22, 0x0022)
+DOUBLE_BYTE_PAIR(0x23, 0x0023)
+DOUBLE_BYTE_PAIR(0x24, 0x0024)
+DOUBLE_BYTE_PAIR(0x25, 0x0025)
+DOUBLE_BYTE_PAIR(0x26, 0x0026)
+DOUBLE_BYTE_PAIR(0x27, 0x0027)
+DOUBLE_BYTE_PAIR(0x28, 0x0028)
+DOUBLE_BYTE_PAIR(0x29, 0x0029)
+DOUBLE_BYTE_PAIR(0x2A, 0x002A)
+DOUBLE_BYTE_PAIR(0x2B, 0x002B)
+DOUBLE_BYTE_PAIR(0x2C, 0x002C)
+DOUBLE_BYTE_PAIR(0x2D, 0x002D)
+DOUBLE_BYTE_PAIR(0x2E, 0x002E)
+DOUBLE_BYTE_PAIR(0x2F, 0x002F)
+DOUBLE_BYTE_PAIR(0x30, 0x0030)
+DOUBLE_BYTE_PAIR(0x31, 0x0031)
+DOUBLE_BYTE_PAIR(0x32, 0x0032)
+DOUBLE_BYTE_PAIR(0x33, 0x0033)
+DOUBLE_BYTE_PAIR(0x34, 0x0034)
+DOUBLE_BYTE_PAIR(0x35, 0x0035)
+DOUBLE_BYTE_PAIR(0x36, 0x0036)
+DOUBLE_BYTE_PAIR(0x37, 0x0037)
+DOUBLE_BYTE_PAIR(0x38, 0x0038)
+DOUBLE_BYTE_PAIR(0x39, 0x0039)
+DOUBLE_BYTE_PAIR(0x3A, 0x003A)
+DOUBLE_BYTE_PAIR(0x3B, 0x003B)
+DOUBLE_BYTE_PAIR(0x3C, 0x003C)
+DOUBLE_BYTE_PAIR(0x3D, 0x003D)
+DOUBLE_BYTE_PAIR(0x3E, 0x003E)
+DOUBLE_BYTE_PAIR(0x3F, 0x003F)
+DOUBLE_BYTE_PAIR(0x40, 0x0040)
+DOUBLE_BYTE_PAIR(0x41, 0x0041)
+DOUBLE_BYTE_PAIR(0x42, 0x0042)
+DOUBLE_BYTE_PAIR(0x43, 0x0043)
+DOUBLE_BYTE_PAIR(0x44, 0x0044)
+DOUBLE_BYTE_PAIR(0x45, 0x0045)
+DOUBLE_BYTE_PAIR(0x46, 0x0046)
+DOUBLE_BYTE_PAIR(0x47, 0x0047)
+DOUBLE_BYTE_PAIR(0x48, 0x0048)
+DOUBLE_BYTE_PAIR(0x49, 0x0049)
+DOUBLE_BYTE_PAIR(0x4A, 0x004A)
+DOUBLE_BYTE_PAIR(0x4B, 0x004B)
+DOUBLE_BYTE_PAIR(0x4C, 0x004C)
+DOUBLE_BYTE_PAIR(0x4D, 0x004D)
+DOUBLE_BYTE_PAIR(0x4E, 0x004E)
+DOUBLE_BYTE_PAIR(0x4F, 0x004F)
+DOUBLE_BYTE_PAIR(0x50, 0x0050)
+DOUBLE_BYTE_PAIR(0x51, 0x0051)
+DOUBLE_BYTE_PAIR(0x52, 0x0052)
+DOUBLE_BYTE_PAIR(0x53, 0x0053)
+DOUBLE_BYTE_PAIR(0x54, 0x0054)
+DOUBLE_BYTE_PAIR(0x55, 0x0055)
+DOUBLE_BYTE_PAIR(0x56, 0x0056)
+DOUBLE_BYTE_PAIR(0x57, 0x0057)
+DOUBLE_BYTE_PAIR(0x58, 0x0058)
+DOUBLE_BYTE_PAIR(0x59, 0x0059)
+DOUBLE_BYTE_PAIR(0x5A, 0x005A)
+DOUBLE_BYTE_PAIR(0x5B, 0x005B)
+DOUBLE_BYTE_PAIR(0x5C, 0x005C)
+DOUBLE_BYTE_PAIR(0x5D, 0x005D)
+DOUBLE_BYTE_PAIR(0x5E, 0x005E)
+DOUBLE_BYTE_PAIR(0x5F, 0x005F)
+DOUBLE_BYTE_PAIR(0x60, 0x0060)
+DOUBLE_BYTE_PAIR(0x61, 0x0061)
+DOUBLE_BYTE_PAIR(0x62, 0x0062)
+DOUBLE_BYTE_PAIR(0x63, 0x0063)
+DOUBLE_BYTE_PAIR(0x64, 0x0064)
+DOUBLE_BYTE_PAIR(0x65, 0x0065)
+DOUBLE_BYTE_PAIR(0x66, 0x0066)
+DOUBLE_BYTE_PAIR(0x67, 0x0067)
+DOUBLE_BYTE_PAIR(0x68, 0x0068)
+DOUBLE_BYTE_PAIR(0x69, 0x0069)
+DOUBLE_BYTE_PAIR(0x6A, 0x006A)
+DOUBLE_BYTE_PAIR(0x6B, 0x006B)
+DOUBLE_BYTE_PAIR(0x6C, 0x006C)
+DOUBLE_BYTE_PAIR(0x6D, 0x006D)
+DOUBLE_BYTE_PAIR(0x6E, 0x006E)
+DOUBLE_BYTE_PAIR(0x6F, 0x006F)
+DOUBLE_BYTE_PAIR(0x70, 0x0070)
+DOUBLE_BYTE_PAIR(0x71, 0x0071)
+DOUBLE_BYTE_PAIR(0x72, 0x0072)
+DOUBLE_BYTE_PAIR(0x73, 0x0073)
+DOUBLE_BYTE_PAIR(0x74, 0x0074)
+DOUBLE_BYTE_PAIR(0x75, 0x0075)
+DOUBLE_BYTE_PAIR(0x76, 0x0076)
+DOUBLE_BYTE_PAIR(0x77, 0x0077)
+DOUBLE_BYTE_PAIR(0x78, 0x0078)
+DOUBLE_BYTE_PAIR(0x79, 0x0079)
+DOUBLE_BYTE_PAIR(0x7A, 0x007A)
+DOUBLE_BYTE_PAIR(0x7B, 0x007B)
+DOUBLE_BYTE_PAIR(0x7C, 0x007C)
+DOUBLE_BYTE_PAIR(0x7D, 0x007D)
+DOUBLE_BYTE_PAIR(0x7E, 0x007E)
+DOUBLE_BYTE_PAIR(0x7F, 0x007F)
+DOUBLE_BYTE_PAIR(0x8141, 0xAC02)
+DOUBLE_BYTE_PAIR(0x8142, 0xAC03)
+DOUBLE_BYTE_PAIR(0x8143, 0xAC05)
+DOUBLE_BYTE_PAIR(0x8144, 0xAC06)
+DOUBLE_BYTE_PAIR(0x8145, 0xAC0B)
+DOUBLE_BYTE_PAIR(0x8146, 0xAC0C)
+DOUBLE_BYTE_PAIR(0x8147, 0xAC0D)
+DOUBLE_BYTE_PAIR(0x8148, 0xAC0E)
+DOUBLE_BYTE_PAIR(0x8149, 0xAC0F)
+DOUBLE_BYTE_PAIR(0x814A, 0xAC18)
+DOUBLE_BYTE_PAIR(0x814B, 0xAC1E)
+DOUBLE_BYTE_PAIR(0x814C, 0xAC1F)
+DOUBLE_BYTE_PAIR(0x814D, 0xAC21)
+DOUBLE_BYTE_PAIR(0x814E, 0xAC22)
+DOUBLE_BYTE_PAIR(0x814F, 0xAC23)
+DOUBLE_BYTE_PAIR(0x8150, 0xAC25)
+DOUBLE_BYTE_PAIR(0x8151, 0xAC26)
+DOUBLE_BYTE_PAIR(0x8152, 0xAC27)
+DOUBLE_BYTE_PAIR(0x8153, 0xAC28)
+DOUBLE_BYTE_PAIR(0x8154, 0xAC29)
+DOUBLE_BYTE_PAIR(0x8155, 0xAC2A)
+DOUBLE_BYTE_PAIR(0x8156, 0xAC2B)
+DOUBLE_BYTE_PAIR(0x8157, 0xAC2E)
+DOUBLE_BYTE_PAIR(0x8158, 0xAC32)
+DOUBLE_BYTE_PAIR(0x8159, 0xAC33)
+DOUBLE_BYTE_PAIR(0x815A, 0xAC34)
+DOUBLE_BYTE_PAIR(0x8161, 0xAC35)
+DOUBLE_BYTE_PAIR(0x8162, 0xAC36)
+DOUBLE_BYTE_PAIR(0x8163, 0xAC37)
+DOUBLE_BYTE_PAIR(0x8164, 0xAC3A)
+DOUBLE_BYTE_PAIR(0x8165, 0xAC3B)
+DOUBLE_BYTE_PAIR(0x8166, 0xAC3D)
+DOUBLE_BYTE_PAIR(0x8167, 0xAC3E)
+DOUBLE_BYTE_PAIR(0x8168, 0xAC3F)
+DOUBLE_BYTE_PAIR(0x8169, 0xAC41)
+DOUBLE_BYTE_PAIR(0x816A, 0xAC42)
+DOUBLE_BYTE_PAIR(0x816B, 0xAC43)
+DOUBLE_BYTE_PAIR(0x816C, 0xAC44)
+DOUBLE_BYTE_PAIR(0x816D, 0xAC45)
+DOUBLE_BYTE_PAIR(0x816E, 0xAC46)
+DOUBLE_BYTE_PAIR(0x816F, 0xAC47)
+DOUBLE_BYTE_PAIR(0x8170, 0xAC48)
+DOUBLE_BYTE_PAIR(0x8171, 0xAC49)
+DOUBLE_BYTE_PAIR(0x8172, 0xAC4A)
+DOUBLE_BYTE_PAIR(0x8173, 0xAC4C)
+DOUBLE_BYTE_PAIR(0x8174, 0xAC4E)
+DOUBLE_BYTE_PAIR(0x8175, 0xAC4F)
+DOUBLE_BYTE_PAIR(0x8176, 0xAC50)
+DOUBLE_BYTE_PAIR(0x8177, 0xAC51)
+DOUBLE_BYTE_PAIR(0x8178, 0xAC52)
+DOUBLE_BYTE_PAIR(0x8179, 0xAC53)
+DOUBLE_BYTE_PAIR(0x817A, 0xAC55)
+DOUBLE_BYTE_PAIR(0x8181, 0xAC56)
+DOUBLE_BYTE_PAIR(0x8182, 0xAC57)
+DOUBLE_BYTE_PAIR(0x8183, 0xAC59)
+DOUBLE_BYTE_PAIR(0x8184, 0xAC5A)
+DOUBLE_BYTE_PAIR(0x8185, 0xAC5B)
+DOUBLE_BYTE_PAIR(0x8186, 0xAC5D)
+DOUBLE_BYTE_PAIR(0x8187, 0xAC5E)
+DOUBLE_BYTE_PAIR(0x8188, 0xAC5F)
+DOUBLE_BYTE_PAIR(0x8189, 0xAC60)
+DOUBLE_BYTE_PAIR(0x818A, 0xAC61)
+DOUBLE_BYTE_PAIR(0x818B, 0xAC62)
+DOUBLE_BYTE_PAIR(0x818C, 0xAC63)
+DOUBLE_BYTE_PAIR(0x818D, 0xAC64)
+DOUBLE_BYTE_PAIR(0x818E, 0xAC65)
+DOUBLE_BYTE_PAIR(0x818F, 0xAC66)
+DOUBLE_BYTE_PAIR(0x8190, 0xAC67)
+DOUBLE_BYTE_PAIR(0x8191, 0xAC68)
+DOUBLE_BYTE_PAIR(0x8192, 0xAC69)
+DOUBLE_BYTE_PAIR(0x8193, 0xAC6A)
+DOUBLE_BYTE_PAIR(0x8194, 0xAC6B)
+DOUBLE_BYTE_PAIR(0x8195, 0xAC6C)
+DOUBLE_BYTE_PAIR(0x8196, 0xAC6D)
+DOUBLE_BYTE_PAIR(0x8197, 0xAC6E)
+DOUBLE_BYTE_PAIR(0x8198, 0xAC6F)
+DOUBLE_BYTE_PAIR(0x8199, 0xAC72)
+DOUBLE_BYTE_PAIR(0x819A, 0xAC73)
+DOUBLE_BYTE_PAIR(0x819B, 0xAC75)
+DOUBLE_BYTE_PAIR(0x819C, 0xAC76)
+DOUBLE_BYTE_PAIR(0x819D, 0xAC79)
+DOUBLE_BYTE_PAIR(0x819E, 0xAC7B)
+DOUBLE_BYTE_PAIR(0x819F, 0xAC7C)
+DOUBLE_BYTE_PAIR(0x81A0, 0xAC7D)
+DOUBLE_BYTE_PAIR(0x81A1, 0xAC7E)
+DOUBLE_BYTE_PAIR(0x81A2, 0xAC7F)
+DOUBLE_BYTE_PAIR(0x81A3, 0xAC82)
+DOUBLE_BYTE_PAIR(0x81A4, 0xAC87)
+DOUBLE_BYTE_PAIR(0x81A5, 0xAC88)
+DOUBLE_BYTE_PAIR(0x81A6, 0xAC8D)
+DOUBLE_BYTE_PAIR(0x81A7, 0xAC8E)
+DOUBLE_BYTE_PAIR(0x81A8, 0xAC8F)
+DOUBLE_BYTE_PAIR(0x81A9, 0xAC91)
+DOUBLE_BYTE_PAIR(0x81AA, 0xAC92)
+DOUBLE_BYTE_PAIR(0x81AB, 0xAC93)
+DOUBLE_BYTE_PAIR(0x81AC, 0xAC95)
+DOUBLE_BYTE_PAIR(0x81AD, 0xAC96)
+DOUBLE_BYTE_PAIR(0x81AE, 0xAC97)
+DOUBLE_BYTE_PAIR(0x81AF, 0xAC98)
+DOUBLE_BYTE_PAIR(0x81B0, 0xAC99)
+DOUBLE_BYTE_PAIR(0x81B1, 0xAC9A)
+DOUBLE_BYTE_PAIR(0x81B2, 0xAC9B)
+DOUBLE_BYTE_PAIR(0x81B3, 0xAC9E)
+DOUBLE_BYTE_PAIR(0x81B4, 0xACA2)
+DOUBLE_BYTE_PAIR(0x81B5, 0xACA3)
+DOUBLE_BYTE_PAIR(0x81B6, 0xACA4)
+DOUBLE_BYTE_PAIR(0x81B7, 0xACA5)
+DOUBLE_BYTE_PAIR(0x81B8, 0xACA6)
+DOUBLE_BYTE_PAIR(0x81B9, 0xACA7)
+DOUBLE_BYTE_PAIR(0x81BA, 0xACAB)
+DOUBLE_BYTE_PAIR(0x81BB, 0xACAD)
+DOUBLE_BYTE_PAIR(0x81BC, 0xACAE)
+DOUBLE_BYTE_PAIR(0x81BD, 0xACB1)
+DOUBLE_BYTE_PAIR(0x81BE, 0xACB2)
+DOUBLE_BYTE_PAIR(0x81BF, 0xACB3)
+DOUBLE_BYTE_PAIR(0x81C0, 0xACB4)
+DOUBLE_BYTE_PAIR(0x81C1, 0xACB5)
+DOUBLE_BYTE_PAIR(0x81C2, 0xACB6)
+DOUBLE_BYTE_PAIR(0x81C3, 0xACB7)
+DOUBLE_BYTE_PAIR(0x81C4, 0xACBA)
+DOUBLE_BYTE_PAIR(0x81C5, 0xACBE)
+DOUBLE_BYTE_PAIR(0x81C6, 0xACBF)
+DOUBLE_BYTE_PAIR(0x81C7, 0xACC0)
+DOUBLE_BYTE_PAIR(0x81C8, 0xACC2)
+DOUBLE_BYTE_PAIR(0x81C9, 0xACC3)
+DOUBLE_BYTE_PAIR(0x81CA, 0xACC5)
+DOUBLE_BYTE_PAIR(0x81CB, 0xACC6)
+DOUBLE_BYTE_PAIR(0x81CC, 0xACC7)
+DOUBLE_BYTE_PAIR(0x81CD, 0xACC9)
+DOUBLE_BYTE_PAIR(0x81CE, 0xACCA)
+DOUBLE_BYTE_PAIR(0x81CF, 0xACCB)
+DOUBLE_BYTE_PAIR(0x81D0, 0xACCD)
+DOUBLE_BYTE_PAIR(0x81D1, 0xACCE)
+DOUBLE_BYTE_PAIR(0x81D2, 0xACCF)
+DOUBLE_BYTE_PAIR(0x81D3, 0xACD0)
+DOUBLE_BYTE_PAIR(0x81D4, 0xACD1)
+DOUBLE_BYTE_PAIR(0x81D5, 0xACD2)
+DOUBLE_BYTE_PAIR(0x81D6, 0xACD3)
+DOUBLE_BYTE_PAIR(0x81D7, 0xACD4)
+DOUBLE_BYTE_PAIR(0x81D8, 0xACD6)
+DOUBLE_BYTE_PAIR(0x81D9, 0xACD8)
+DOUBLE_BYTE_PAIR(0x81DA, 0xACD9)
+DOUBLE_BYTE_PAIR(0x81DB, 0xACDA)
+DOUBLE_BYTE_PAIR(0x81DC, 0xACDB)
+DOUBLE_BYTE_PAIR(0x81DD, 0xACDC)
+DOUBLE_BYTE_PAIR(0x81DE, 0xACDD)
+DOUBLE_BYTE_PAIR(0x81DF, 0xACDE)
+DOUBLE_BYTE_PAIR(0x81E0, 0xACDF)
+DOUBLE_BYTE_PAIR(0x81E1, 0xACE2)
+DOUBLE_BYTE_PAIR(0x81E2, 0xACE3)
+DOUBLE_BYTE_PAIR(0x81E3, 0xACE5)
+DOUBLE_BYTE_PAIR(0x81E4, 0xACE6)
+DOUBLE_BYTE_PAIR(0x81E5, 0xACE9)
+DOUBLE_BYTE_PAIR(0x81E6, 0xACEB)
+DOUBLE_BYTE_PAIR(0x81E7, 0xACED)
+DOUBLE_BYTE_PAIR(0x81E8, 0xACEE)
+DOUBLE_BYTE_PAIR(0x81E9, 0xACF2)
+DOUBLE_BYTE_PAIR(0x81EA, 0xACF4)
+DOUBLE_BYTE_PAIR(0x81EB, 0xACF7)
+DOUBLE_BYTE_PAIR(0x81EC, 0xACF8)
+DOUBLE_BYTE_PAIR(0x81ED, 0xACF9)
+DOUBLE_BYTE_PAIR(0x81EE, 0xACFA)
+DOUBLE_BYTE_PAIR(0x81EF, 0xACFB)
+DOUBLE_BYTE_PAIR(0x81F0, 0xACFE)
+DOUBLE_BYTE_PAIR(0x81F1, 0xACFF)
+DOUBLE_BYTE_PAIR(0x81F2, 0xAD01)
+DOUBLE_BYTE_PAIR(0x81F3, 0xAD02)
+DOUBLE_BYTE_PAIR(0x81F4, 0xAD03)
+DOUBLE_BYTE_PAIR(0x81F5, 0xAD05)
+DOUBLE_BYTE_PAIR(0x81F6, 0xAD07)
+DOUBLE_BYTE_PAIR(0x81F7, 0xAD08)
+DOUBLE_BYTE_PAIR(0x81F8, 0xAD09)
+DOUBLE_BYTE_PAIR(0x81F9, 0xAD0A)
+DOUBLE_BYTE_PAIR(0x81FA, 0xAD0B)
+DOUBLE_BYTE_PAIR(0x81FB, 0xAD0E)
+DOUBLE_BYTE_PAIR(0x81FC, 0xAD10)
+DOUBLE_BYTE_PAIR(0x81FD, 0xAD12)
+DOUBLE_BYTE_PAIR(0x81FE, 0xAD13)
+DOUBLE_BYTE_PAIR(0x8241, 0xAD14)
+DOUBLE_BYTE_PAIR(0x8242, 0xAD15)
+DOUBLE_BYTE_PAIR(0x8243, 0xAD16)
+DOUBLE_BYTE_PAIR(0x8244, 0xAD17)
+DOUBLE_BYTE_PAIR(0x8245, 0xAD19)
+DOUBLE_BYTE_PAIR(0x8246, 0xAD1A)
+DOUBLE_BYTE_PAIR(0x8247, 0xAD1B)
+DOUBLE_BYTE_PAIR(0x8248, 0xAD1D)
+DOUBLE_BYTE_PAIR(0x8249, 0xAD1E)
+DOUBLE_BYTE_PAIR(0x824A, 0xAD1F)
+DOUBLE_BYTE_PAIR(0x824B, 0xAD21)
+DOUBLE_BYTE_PAIR(0x824C, 0xAD22)
+DOUBLE_BYTE_PAIR(0x824D, 0xAD23)
+DOUBLE_BYTE_PAIR(0x824E, 0xAD24)
+DOUBLE_BYTE_PAIR(0x824F, 0xAD25)
+DOUBLE_BYTE_PAIR(0x8250, 0xAD26)
+DOUBLE_BYTE_PAIR(0x8251, 0xAD27)
+DOUBLE_BYTE_PAIR(0x8252, 0xAD28)
+DOUBLE_BYTE_PAIR(0x8253, 0xAD2A)
+DOUBLE_BYTE_PAIR(0x8254, 0xAD2B)
+DOUBLE_BYTE_PAIR(0x8255, 0xAD2E)
+DOUBLE_BYTE_PAIR(0x8256, 0xAD2F)
+DOUBLE_BYTE_PAIR(0x8257, 0xAD30)
+DOUBLE_BYTE_PAIR(0x8258, 0xAD31)
+DOUBLE_BYTE_PAIR(0x8259, 0xAD32)
+DOUBLE_BYTE_PAIR(0x825A, 0xAD33)
+DOUBLE_BYTE_PAIR(0x8261, 0xAD36)
+DOUBLE_BYTE_PAIR(0x8262, 0xAD37)
+DOUBLE_BYTE_PAIR(0x8263, 0xAD39)
+DOUBLE_BYTE_PAIR(0x8264, 0xAD3A)
+DOUBLE_BYTE_PAIR(0x8265, 0xAD3B)
+DOUBLE_BYTE_PAIR(0x8266, 0xAD3D)
+DOUBLE_BYTE_PAIR(0x8267, 0xAD3E)
+DOUBLE_BYTE_PAIR(0x8268, 0xAD3F)
+DOUBLE_BYTE_PAIR(0x8269, 0xAD40)
+DOUBLE_BYTE_PAIR(0x826A, 0xAD41)
+DOUBLE_BYTE_PAIR(0x826B, 0xAD42)
+DOUBLE_BYTE_PAIR(0x826C, 0xAD43)
+DOUBLE_BYTE_PAIR(0x826D, 0xAD46)
+DOUBLE_BYTE_PAIR(0x826E, 0xAD48)
+DOUBLE_BYTE_PAIR(0x826F, 0xAD4A)
+DOUBLE_BYTE_PAIR(0x8270, 0xAD4B)
+DOUBLE_BYTE_PAIR(0x8271, 0xAD4C)
+DOUBLE_BYTE_PAIR(0x8272, 0xAD4D)
+DOUBLE_BYTE_PAIR(0x8273, 0xAD4E)
+DOUBLE_BYTE_PAIR(0x8274, 0xAD4F)
+DOUBLE_BYTE_PAIR(0x8275, 0xAD51)
+DOUBLE_BYTE_PAIR(0x8276, 0xAD52)
+DOUBLE_BYTE_PAIR(0x8277, 0xAD53)
+DOUBLE_BYTE_PAIR(0x8278, 0xAD55)
+DOUBLE_BYTE_PAIR(0x8279, 0xAD56)
+DOUBLE_BYTE_PAIR(0x827A, 0xAD57)
+DOUBLE_BYTE_PAIR(0x8281, 0xAD59)
+DOUBLE_BYTE_PAIR(0x8282, 0xAD5A)
+DOUBLE_BYTE_PAIR(0x8283, 0xAD5B)
+DOUBLE_BYTE_PAIR(0x8284, 0xAD5C)
+DOUBLE_BYTE_PAIR(0x8285, 0xAD5D)
+DOUBLE_BYTE_PAIR(0x8286, 0xAD5E)
+DOUBLE_BYTE_PAIR(0x8287, 0xAD5F)
+DOUBLE_BYTE_PAIR(0x8288, 0xAD60)
+DOUBLE_BYTE_PAIR(0x8289, 0xAD62)
+DOUBLE_BYTE_PAIR(0x828A, 0xAD64)
+DOUBLE_BYTE_PAIR(0x828B, 0xAD65)
+DOUBLE_BYTE_PAIR(0x828C, 0xAD66)
+DOUBLE_BYTE_PAIR(0x828D, 0xAD67)
+DOUBLE_BYTE_PAIR(0x828E, 0xAD68)
+DOUBLE_BYTE_PAIR(0x828F, 0xAD69)
+DOUBLE_BYTE_PAIR(0x8290, 0xAD6A)
+DOUBLE_BYTE_PAIR(0x8291, 0xAD6B)
+DOUBLE_BYTE_PAIR(0x8292, 0xAD6E)
+DOUBLE_BYTE_PAIR(0x8293, 0xAD6F)
+DOUBLE_BYTE_PAIR(0x8294, 0xAD71)
+DOUBLE_BYTE_PAIR(0x8295, 0xAD72)
+DOUBLE_BYTE_PAIR(0x8296, 0xAD77)
+DOUBLE_BYTE_PAIR(0x8297, 0xAD78)
+DOUBLE_BYTE_PAIR(0x8298, 0xAD79)
+DOUBLE_BYTE_PAIR(0x8299, 0xAD7A)
+DOUBLE_BYTE_PAIR(0x829A, 0xAD7E)
+DOUBLE_BYTE_PAIR(0x829B, 0xAD80)
+DOUBLE_BYTE_PAIR(0x829C, 0xAD83)
+DOUBLE_BYTE_PAIR(0x829D, 0xAD84)
+DOUBLE_BYTE_PAIR(0x829E, 0xAD85)
+DOUBLE_BYTE_PAIR(0x829F, 0xAD86)
+DOUBLE_BYTE_PAIR(0x82A0, 0xAD87)
+DOUBLE_BYTE_PAIR(0x82A1, 0xAD8A)
+DOUBLE_BYTE_PAIR(0x82A2, 0xAD8B)
+DOUBLE_BYTE_PAIR(0x82A3, 0xAD8D)
+DOUBLE_BYTE_PAIR(0x82A4, 0xAD8E)
+DOUBLE_BYTE_PAIR(0x82A5, 0xAD8F)
+DOUBLE_BYTE_PAIR(0x82A6, 0xAD91)
+DOUBLE_BYTE_PAIR(0x82A7, 0xAD92)
+DOUBLE_BYTE_PAIR(0x82A8, 0xAD93)
+DOUBLE_BYTE_PAIR(0x82A9, 0xAD94)
+DOUBLE_BYTE_PAIR(0x82AA, 0xAD95)
+DOUBLE_BYTE_PAIR(0x82AB, 0xAD96)
+DOUBLE_BYTE_PAIR(0x82AC, 0xAD97)
+DOUBLE_BYTE_PAIR(0x82AD, 0xAD98)
+DOUBLE_BYTE_PAIR(0x82AE, 0xAD99)
+DOUBLE_BYTE_PAIR(0x82AF, 0xAD9A)
+DOUBLE_BYTE_PAIR(0x82B0, 0xAD9B)
+DOUBLE_BYTE_PAIR(0x82B1, 0xAD9E)
+DOUBLE_BYTE_PAIR(0x82B2, 0xAD9F)
+DOUBLE_BYTE_PAIR(0x82B3, 0xADA0)
+DOUBLE_BYTE_PAIR(0x82B4, 0xADA1)
+DOUBLE_BYTE_PAIR(0x82B5, 0xADA2)
+DOUBLE_BYTE_PAIR(0x82B6, 0xADA3)
+DOUBLE_BYTE_PAIR(0x82B7, 0xADA5)
+DOUBLE_BYTE_PAIR(0x82B8, 0xADA6)
+DOUBLE_BYTE_PAIR(0x82B9, 0xADA7)
+DOUBLE_BYTE_PAIR(0x82BA, 0xADA8)
+DOUBLE_BYTE_PAIR(0x82BB, 0xADA9)
+DOUBLE_BYTE_PAIR(0x82BC, 0xADAA)
+DOUBLE_BYTE_PAIR(0x82BD, 0xADAB)
+DOUBLE_BYTE_PAIR(0x82BE, 0xADAC)
+DOUBLE_BYTE_PAIR(0x82BF, 0xADAD)
+DOUBLE_BYTE_PAIR(0x82C0, 0xADAE)
+DOUBLE_BYTE_PAIR(0x82C1, 0xADAF)
+DOUBLE_BYTE_PAIR(0x82C2, 0xADB0)
+DOUBLE_BYTE_PAIR(0x82C3, 0xADB1)
+DOUBLE_BYTE_PAIR(0x82C4, 0xADB2)
+DOUBLE_BYTE_PAIR(0x82C5, 0xADB3)
+DOUBLE_BYTE_PAIR(0x82C6, 0xADB4)
+DOUBLE_BYTE_PAIR(0x82C7, 0xADB5)
+DOUBLE_BYTE_PAIR(0x82C8, 0xADB6)
+DOUBLE_BYTE_PAIR(0x82C9, 0xADB8)
+DOUBLE_BYTE_PAIR(0x82CA, 0xADB9)
+DOUBLE_BYTE_PAIR(0x82CB, 0xADBA)
+DOUBLE_BYTE_PAIR(0x82CC, 0xADBB)
+DOUBLE_BYTE_PAIR(0x82CD, 0xADBC)
+DOUBLE_BYTE_PAIR(0x82CE, 0xADBD)
+DOUBLE_BYTE_PAIR(0x82CF, 0xADBE)
+DOUBLE_BYTE_PAIR(0x82D0, 0xADBF)
+DOUBLE_BYTE_PAIR(0x82D1, 0xADC2)
+DOUBLE_BYTE_PAIR(0x82D2, 0xADC3)
+DOUBLE_BYTE_PAIR(0x82D3, 0xADC5)
+DOUBLE_BYTE_PAIR(0x82D4, 0xADC6)
+DOUBLE_BYTE_PAIR(0x82D5, 0xADC7)
+DOUBLE_BYTE_PAIR(0x82D6, 0xADC9)
+DOUBLE_BYTE_PAIR(0x82D7, 0xADCA)
+DOUBLE_BYTE_PAIR(0x82D8, 0xADCB)
+DOUBLE_BYTE_PAIR(0x82D9, 0xADCC)
+DOUBLE_BYTE_PAIR(0x82DA, 0xADCD)
+DOUBLE_BYTE_PAIR(0x82DB, 0xADCE)
+DOUBLE_BYTE_PAIR(0x82DC, 0xADCF)
+DOUBLE_BYTE_PAIR(0x82DD, 0xADD2)
+DOUBLE_BYTE_PAIR(0x82DE, 0xADD4)
+DOUBLE_BYTE_PAIR(0x82DF, 0xADD5)
+DOUBLE_BYTE_PAIR(0x82E0, 0xADD6)
+DOUBLE_BYTE_PAIR(0x82E1, 0xADD7)
+DOUBLE_BYTE_PAIR(0x82E2, 0xADD8)
+DOUBLE_BYTE_PAIR(0x82E3, 0xADD9)
+DOUBLE_BYTE_PAIR(0x82E4, 0xADDA)
+DOUBLE_BYTE_PAIR(0x82E5, 0xADDB)
+DOUBLE_BYTE_PAIR(0x82E6, 0xADDD)
+DOUBLE_BYTE_PAIR(0x82E7, 0xADDE)
+DOUBLE_BYTE_PAIR(0x82E8, 0xADDF)
+DOUBLE_BYTE_PAIR(0x82E9, 0xADE1)
+DOUBLE_BYTE_PAIR(0x82EA, 0xADE2)
+DOUBLE_BYTE_PAIR(0x82EB, 0xADE3)
+DOUBLE_BYTE_PAIR(0x82EC, 0xADE5)
+DOUBLE_BYTE_PAIR(0x82ED, 0xADE6)
+DOUBLE_BYTE_PAIR(0x82EE, 0xADE7)
+DOUBLE_BYTE_PAIR(0x82EF, 0xADE8)
+DOUBLE_BYTE_PAIR(0x82F0, 0xADE9)
+DOUBLE_BYTE_PAIR(0x82F1, 0xADEA)
+DOUBLE_BYTE_PAIR(0x82F2, 0xADEB)
+DOUBLE_BYTE_PAIR(0x82F3, 0xADEC)
+DOUBLE_BYTE_PAIR(0x82F4, 0xADED)
+DOUBLE_BYTE_PAIR(0x82F5, 0xADEE)
+DOUBLE_BYTE_PAIR(0x82F6, 0xADEF)
+DOUBLE_BYTE_PAIR(0x82F7, 0xADF0)
+DOUBLE_BYTE_PAIR(0x82F8, 0xADF1)
+DOUBLE_BYTE_PAIR(0x82F9, 0xADF2)
+DOUBLE_BYTE_PAIR(0x82FA, 0xADF3)
+DOUBLE_BYTE_PAIR(0x82FB, 0xADF4)
+DOUBLE_BYTE_PAIR(0x82FC, 0xADF5)
+DOUBLE_BYTE_PAIR(0x82FD, 0xADF6)
+DOUBLE_BYTE_PAIR(0x82FE, 0xADF7)
+DOUBLE_BYTE_PAIR(0x8341, 0xADFA)
+DOUBLE_BYTE_PAIR(0x8342, 0xADFB)
+DOUBLE_BYTE_PAIR(0x8343, 0xADFD)
+DOUBLE_BYTE_PAIR(0x8344, 0xADFE)
+DOUBLE_BYTE_PAIR(0x8345, 0xAE02)
+DOUBLE_BYTE_PAIR(0x8346, 0xAE03)
+DOUBLE_BYTE_PAIR(0x8347, 0xAE04)
+DOUBLE_BYTE_PAIR(0x8348, 0xAE05)
+DOUBLE_BYTE_PAIR(0x8349, 0xAE06)
+DOUBLE_BYTE_PAIR(0x834A, 0xAE07)
+DOUBLE_BYTE_PAIR(0x834B, 0xAE0A)
+DOUBLE_BYTE_PAIR(0x834C, 0xAE0C)
+DOUBLE_BYTE_PAIR(0x834D, 0xAE0E)
+DOUBLE_BYTE_PAIR(0x834E, 0xAE0F)
+DOUBLE_BYTE_PAIR(0x834F, 0xAE10)
+DOUBLE_BYTE_PAIR(0x8350, 0xAE11)
+DOUBLE_BYTE_PAIR(0x8351, 0xAE12)
+DOUBLE_BYTE_PAIR(0x8352, 0xAE13)
+DOUBLE_BYTE_PAIR(0x8353, 0xAE15)
+DOUBLE_BYTE_PAIR(0x8354, 0xAE16)
+DOUBLE_BYTE_PAIR(0x8355, 0xAE17)
+DOUBLE_BYTE_PAIR(0x8356, 0xAE18)
+DOUBLE_BYTE_PAIR(0x8357, 0xAE19)
+DOUBLE_BYTE_PAIR(0x8358, 0xAE1A)
+DOUBLE_BYTE_PAIR(0x8359, 0xAE1B)
+DOUBLE_BYTE_PAIR(0x835A, 0xAE1C)
+DOUBLE_BYTE_PAIR(0x8361, 0xAE1D)
+DOUBLE_BYTE_PAIR(0x8362, 0xAE1E)
+DOUBLE_BYTE_PAIR(0x8363, 0xAE1F)
+DOUBLE_BYTE_PAIR(0x8364, 0xAE20)
+DOUBLE_BYTE_PAIR(0x8365, 0xAE21)
+DOUBLE_BYTE_PAIR(0x8366, 0xAE22)
+DOUBLE_BYTE_PAIR(0x8367, 0xAE23)
+DOUBLE_BYTE_PAIR(0x8368, 0xAE24)
+DOUBLE_BYTE_PAIR(0x8369, 0xAE25)
+DOUBLE_BYTE_PAIR(0x836A, 0xAE26)
+DOUBLE_BYTE_PAIR(0x836B, 0xAE27)
+DOUBLE_BYTE_PAIR(0x836C, 0xAE28)
+DOUBLE_BYTE_PAIR(0x836D, 0xAE29)
+DOUBLE_BYTE_PAIR(0x836E, 0xAE2A)
+DOUBLE_BYTE_PAIR(0x836F, 0xAE2B)
+DOUBLE_BYTE_PAIR(0x8370, 0xAE2C)
+DOUBLE_BYTE_PAIR(0x8371, 0xAE2D)
+DOUBLE_BYTE_PAIR(0x8372, 0xAE2E)
+DOUBLE_BYTE_PAIR(0x8373, 0xAE2F)
+DOUBLE_BYTE_PAIR(0x8374, 0xAE32)
+DOUBLE_BYTE_PAIR(0x8375, 0xAE33)
+DOUBLE_BYTE_PAIR(0x8376, 0xAE35)
+DOUBLE_BYTE_PAIR(0x8377, 0xAE36)
+DOUBLE_BYTE_PAIR(0x8378, 0xAE39)
+DOUBLE_BYTE_PAIR(0x8379, 0xAE3B)
+DOUBLE_BYTE_PAIR(0x837A, 0xAE3C)
+DOUBLE_BYTE_PAIR(0x8381, 0xAE3D)
+DOUBLE_BYTE_PAIR(0x8382, 0xAE3E)
+DOUBLE_BYTE_PAIR(0x8383, 0xAE3F)
+DOUBLE_BYTE_PAIR(0x8384, 0xAE42)
+DOUBLE_BYTE_PAIR(0x8385, 0xAE44)
+DOUBLE_BYTE_PAIR(0x8386, 0xAE47)
+DOUBLE_BYTE_PAIR(0x8387, 0xAE48)
+DOUBLE_BYTE_PAIR(0x8388, 0xAE49)
+DOUBLE_BYTE_PAIR(0x8389, 0xAE4B)
+DOUBLE_BYTE_PAIR(0x838A, 0xAE4F)
+DOUBLE_BYTE_PAIR(0x838B, 0xAE51)
+DOUBLE_BYTE_PAIR(0x838C, 0xAE52)
+DOUBLE_BYTE_PAIR(0x838D, 0xAE53)
+DOUBLE_BYTE_PAIR(0x838E, 0xAE55)
+DOUBLE_BYTE_PAIR(0x838F, 0xAE57)
+DOUBLE_BYTE_PAIR(0x8390, 0xAE58)
+DOUBLE_BYTE_PAIR(0x8391, 0xAE59)
+DOUBLE_BYTE_PAIR(0x8392, 0xAE5A)
+DOUBLE_BYTE_PAIR(0x8393, 0xAE5B)
+DOUBLE_BYTE_PAIR(0x8394, 0xAE5E)
+DOUBLE_BYTE_PAIR(0x8395, 0xAE62)
+DOUBLE_BYTE_PAIR(0x8396, 0xAE63)
+DOUBLE_BYTE_PAIR(0x8397, 0xAE64)
+DOUBLE_BYTE_PAIR(0x8398, 0xAE66)
+DOUBLE_BYTE_PAIR(0x8399, 0xAE67)
+DOUBLE_BYTE_PAIR(0x839A, 0xAE6A)
+DOUBLE_BYTE_PAIR(0x839B, 0xAE6B)
+DOUBLE_BYTE_PAIR(0x839C, 0xAE6D)
+DOUBLE_BYTE_PAIR(0x839D, 0xAE6E)
+DOUBLE_BYTE_PAIR(0x839E, 0xAE6F)
+DOUBLE_BYTE_PAIR(0x839F, 0xAE71)
+DOUBLE_BYTE_PAIR(0x83A0, 0xAE72)
+DOUBLE_BYTE_PAIR(0x83A1, 0xAE73)
+DOUBLE_BYTE_PAIR(0x83A2, 0xAE74)
+DOUBLE_BYTE_PAIR(0x83A3, 0xAE75)
+DOUBLE_BYTE_PAIR(0x83A4, 0xAE76)
+DOUBLE_BYTE_PAIR(0x83A5, 0xAE77)
+DOUBLE_BYTE_PAIR(0x83A6, 0xAE7A)
+DOUBLE_BYTE_PAIR(0x83A7, 0xAE7E)
+DOUBLE_BYTE_PAIR(0x83A8, 0xAE7F)
+DOUBLE_BYTE_PAIR(0x83A9, 0xAE80)
+DOUBLE_BYTE_PAIR(0x83AA, 0xAE81)
+DOUBLE_BYTE_PAIR(0x83AB, 0xAE82)
+DOUBLE_BYTE_PAIR(0x83AC, 0xAE83)
+DOUBLE_BYTE_PAIR(0x83AD, 0xAE86)
+DOUBLE_BYTE_PAIR(0x83AE, 0xAE87)
+DOUBLE_BYTE_PAIR(0x83AF, 0xAE88)
+DOUBLE_BYTE_PAIR(0x83B0, 0xAE89)
+DOUBLE_BYTE_PAIR(0x83B1, 0xAE8A)
+DOUBLE_BYTE_PAIR(0x83B2, 0xAE8B)
+DOUBLE_BYTE_PAIR(0x83B3, 0xAE8D)
+DOUBLE_BYTE_PAIR(0x83B4, 0xAE8E)
+DOUBLE_BYTE_PAIR(0x83B5, 0xAE8F)
+DOUBLE_BYTE_PAIR(0x83B6, 0xAE90)
+DOUBLE_BYTE_PAIR(0x83B7, 0xAE91)
+DOUBLE_BYTE_PAIR(0x83B8, 0xAE92)
+DOUBLE_BYTE_PAIR(0x83B9, 0xAE93)
+DOUBLE_BYTE_PAIR(0x83BA, 0xAE94)
+DOUBLE_BYTE_PAIR(0x83BB, 0xAE95)
+DOUBLE_BYTE_PAIR(0x83BC, 0xAE96)
+DOUBLE_BYTE_PAIR(0x83BD, 0xAE97)
+DOUBLE_BYTE_PAIR(0x83BE, 0xAE98)
+DOUBLE_BYTE_PAIR(0x83BF, 0xAE99)
+DOUBLE_BYTE_PAIR(0x83C0, 0xAE9A)
+DOUBLE_BYTE_PAIR(0x83C1, 0xAE9B)
+DOUBLE_BYTE_PAIR(0x83C2, 0xAE9C)
+DOUBLE_BYTE_PAIR(0x83C3, 0xAE9D)
+DOUBLE_BYTE_PAIR(0x83C4, 0xAE9E)
+DOUBLE_BYTE_PAIR(0x83C5, 0xAE9F)
+DOUBLE_BYTE_PAIR(0x83C6, 0xAEA0)
+DOUBLE_BYTE_PAIR(0x83C7, 0xAEA1)
+DOUBLE_BYTE_PAIR(0x83C8, 0xAEA2)
+DOUBLE_BYTE_PAIR(0x83C9, 0xAEA3)
+DOUBLE_BYTE_PAIR(0x83CA, 0xAEA4)
+DOUBLE_BYTE_PAIR(0x83CB, 0xAEA5)
+DOUBLE_BYTE_PAIR(0x83CC, 0xAEA6)
+DOUBLE_BYTE_PAIR(0x83CD, 0xAEA7)
+DOUBLE_BYTE_PAIR(0x83CE, 0xAEA8)
+DOUBLE_BYTE_PAIR(0x83CF, 0xAEA9)
+DOUBLE_BYTE_PAIR(0x83D0, 0xAEAA)
+DOUBLE_BYTE_PAIR(0x83D1, 0xAEAB)
+DOUBLE_BYTE_PAIR(0x83D2, 0xAEAC)
+DOUBLE_BYTE_PAIR(0x83D3, 0xAEAD)
+DOUBLE_BYTE_PAIR(0x83D4, 0xAEAE)
+DOUBLE_BYTE_PAIR(0x83D5, 0xAEAF)
+DOUBLE_BYTE_PAIR(0x83D6, 0xAEB0)
+DOUBLE_BYTE_PAIR(0x83D7, 0xAEB1)
+DOUBLE_BYTE_PAIR(0x83D8, 0xAEB2)
+DOUBLE_BYTE_PAIR(0x83D9, 0xAEB3)
+DOUBLE_BYTE_PAIR(0x83DA, 0xAEB4)
+DOUBLE_BYTE_PAIR(0x83DB, 0xAEB5)
+DOUBLE_BYTE_PAIR(0x83DC, 0xAEB6)
+DOUBLE_BYTE_PAIR(0x83DD, 0xAEB7)
+DOUBLE_BYTE_PAIR(0x83DE, 0xAEB8)
+DOUBLE_BYTE_PAIR(0x83DF, 0xAEB9)
+DOUBLE_BYTE_PAIR(0x83E0, 0xAEBA)
+DOUBLE_BYTE_PAIR(0x83E1, 0xAEBB)
+DOUBLE_BYTE_PAIR(0x83E2, 0xAEBF)
+DOUBLE_BYTE_PAIR(0x83E3, 0xAEC1)
+DOUBLE_BYTE_PAIR(0x83E4, 0xAEC2)
+DOUBLE_BYTE_PAIR(0x83E5, 0xAEC3)
+DOUBLE_BYTE_PAIR(0x83E6, 0xAEC5)
+DOUBLE_BYTE_PAIR(0x83E7, 0xAEC6)
+DOUBLE_BYTE_PAIR(0x83E8, 0xAEC7)
+DOUBLE_BYTE_PAIR(0x83E9, 0xAEC8)
+DOUBLE_BYTE_PAIR(0x83EA, 0xAEC9)
+DOUBLE_BYTE_PAIR(0x83EB, 0xAECA)
+DOUBLE_BYTE_PAIR(0x83EC, 0xAECB)
+DOUBLE_BYTE_PAIR(0x83ED, 0xAECE)
+DOUBLE_BYTE_PAIR(0x83EE, 0xAED2)
+DOUBLE_BYTE_PAIR(0x83EF, 0xAED3)
+DOUBLE_BYTE_PAIR(0x83F0, 0xAED4)
+DOUBLE_BYTE_PAIR(0x83F1, 0xAED5)
+DOUBLE_BYTE_PAIR(0x83F2, 0xAED6)
+DOUBLE_BYTE_PAIR(0x83F3, 0xAED7)
+DOUBLE_BYTE_PAIR(0x83F4, 0xAEDA)
+DOUBLE_BYTE_PAIR(0x83F5, 0xAEDB)
+DOUBLE_BYTE_PAIR(0x83F6, 0xAEDD)
+DOUBLE_BYTE_PAIR(0x83F7, 0xAEDE)
+DOUBLE_BYTE_PAIR(0x83F8, 0xAEDF)
+DOUBLE_BYTE_PAIR(0x83F9, 0xAEE0)
+DOUBLE_BYTE_PAIR(0x83FA, 0xAEE1)
+DOUBLE_BYTE_PAIR(0x83FB, 0xAEE2)
+DOUBLE_BYTE_PAIR(0x83FC, 0xAEE3)
+DOUBLE_BYTE_PAIR(0x83FD, 0xAEE4)
+DOUBLE_BYTE_PAIR(0x83FE, 0xAEE5)
+DOUBLE_BYTE_PAIR(0x8441, 0xAEE6)
+DOUBLE_BYTE_PAIR(0x8442, 0xAEE7)
+DOUBLE_BYTE_PAIR(0x8443, 0xAEE9)
+DOUBLE_BYTE_PAIR(0x8444, 0xAEEA)
+DOUBLE_BYTE_PAIR(0x8445, 0xAEEC)
+DOUBLE_BYTE_PAIR(0x8446, 0xAEEE)
+DOUBLE_BYTE_PAIR(0x8447, 0xAEEF)
+DOUBLE_BYTE_PAIR(0x8448, 0xAEF0)
+DOUBLE_BYTE_PAIR(0x8449, 0xAEF1)
+DOUBLE_BYTE_PAIR(0x844A, 0xAEF2)
+DOUBLE_BYTE_PAIR(0x844B, 0xAEF3)
+DOUBLE_BYTE_PAIR(0x844C, 0xAEF5)
+DOUBLE_BYTE_PAIR(0x844D, 0xAEF6)
+DOUBLE_BYTE_PAIR(0x844E, 0xAEF7)
+DOUBLE_BYTE_PAIR(0x844F, 0xAEF9)
+DOUBLE_BYTE_PAIR(0x8450, 0xAEFA)
+DOUBLE_BYTE_PAIR(0x8451, 0xAEFB)
+DOUBLE_BYTE_PAIR(0x8452, 0xAEFD)
+DOUBLE_BYTE_PAIR(0x8453, 0xAEFE)
+DOUBLE_BYTE_PAIR(0x8454, 0xAEFF)
+DOUBLE_BYTE_PAIR(0x8455, 0xAF00)
+DOUBLE_BYTE_PAIR(0x8456, 0xAF01)
+DOUBLE_BYTE_PAIR(0x8457, 0xAF02)
+DOUBLE_BYTE_PAIR(0x8458, 0xAF03)
+DOUBLE_BYTE_PAIR(0x8459, 0xAF04)
+DOUBLE_BYTE_PAIR(0x845A, 0xAF05)
+DOUBLE_BYTE_PAIR(0x8461, 0xAF06)
+DOUBLE_BYTE_PAIR(0x8462, 0xAF09)
+DOUBLE_BYTE_PAIR(0x8463, 0xAF0A)
+DOUBLE_BYTE_PAIR(0x8464, 0xAF0B)
+DOUBLE_BYTE_PAIR(0x8465, 0xAF0C)
+DOUBLE_BYTE_PAIR(0x8466, 0xAF0E)
+DOUBLE_BYTE_PAIR(0x8467, 0xAF0F)
+DOUBLE_BYTE_PAIR(0x8468, 0xAF11)
+DOUBLE_BYTE_PAIR(0x8469, 0xAF12)
+DOUBLE_BYTE_PAIR(0x846A, 0xAF13)
+DOUBLE_BYTE_PAIR(0x846B, 0xAF14)
+DOUBLE_BYTE_PAIR(0x846C, 0xAF15)
+DOUBLE_BYTE_PAIR(0x846D, 0xAF16)
+DOUBLE_BYTE_PAIR(0x846E, 0xAF17)
+DOUBLE_BYTE_PAIR(0x846F, 0xAF18)
+DOUBLE_BYTE_PAIR(0x8470, 0xAF19)
+DOUBLE_BYTE_PAIR(0x8471, 0xAF1A)
+DOUBLE_BYTE_PAIR(0x8472, 0xAF1B)
+DOUBLE_BYTE_PAIR(0x8473, 0xAF1C)
+DOUBLE_BYTE_PAIR(0x8474, 0xAF1D)
+DOUBLE_BYTE_PAIR(0x8475, 0xAF1E)
+DOUBLE_BYTE_PAIR(0x8476, 0xAF1F)
+DOUBLE_BYTE_PAIR(0x8477, 0xAF20)
+DOUBLE_BYTE_PAIR(0x8478, 0xAF21)
+DOUBLE_BYTE_PAIR(0x8479, 0xAF22)
+DOUBLE_BYTE_PAIR(0x847A, 0xAF23)
+DOUBLE_BYTE_PAIR(0x8481, 0xAF24)
+DOUBLE_BYTE_PAIR(0x8482, 0xAF25)
+DOUBLE_BYTE_PAIR(0x8483, 0xAF26)
+DOUBLE_BYTE_PAIR(0x8484, 0xAF27)
+DOUBLE_BYTE_PAIR(0x8485, 0xAF28)
+DOUBLE_BYTE_PAIR(0x8486, 0xAF29)
+DOUBLE_BYTE_PAIR(0x8487, 0xAF2A)
+DOUBLE_BYTE_PAIR(0x8488, 0xAF2B)
+DOUBLE_BYTE_PAIR(0x8489, 0xAF2E)
+DOUBLE_BYTE_PAIR(0x848A, 0xAF2F)
+DOUBLE_BYTE_PAIR(0x848B, 0xAF31)
+DOUBLE_BYTE_PAIR(0x848C, 0xAF33)
+DOUBLE_BYTE_PAIR(0x848D, 0xAF35)
+DOUBLE_BYTE_PAIR(0x848E, 0xAF36)
+DOUBLE_BYTE_PAIR(0x848F, 0xAF37)
+DOUBLE_BYTE_PAIR(0x8490, 0xAF38)
+DOUBLE_BYTE_PAIR(0x8491, 0xAF39)
+DOUBLE_BYTE_PAIR(0x8492, 0xAF3A)
+DOUBLE_BYTE_PAIR(0x8493, 0xAF3B)
+DOUBLE_BYTE_PAIR(0x8494, 0xAF3E)
+DOUBLE_BYTE_PAIR(0x8495, 0xAF40)
+DOUBLE_BYTE_PAIR(0x8496, 0xAF44)
+DOUBLE_BYTE_PAIR(0x8497, 0xAF45)
+DOUBLE_BYTE_PAIR(0x8498, 0xAF46)
+DOUBLE_BYTE_PAIR(0x8499, 0xAF47)
+DOUBLE_BYTE_PAIR(0x849A, 0xAF4A)
+DOUBLE_BYTE_PAIR(0x849B, 0xAF4B)
+DOUBLE_BYTE_PAIR(0x849C, 0xAF4C)
+DOUBLE_BYTE_PAIR(0x849D, 0xAF4D)
+DOUBLE_BYTE_PAIR(0x849E, 0xAF4E)
+DOUBLE_BYTE_PAIR(0x849F, 0xAF4F)
+DOUBLE_BYTE_PAIR(0x84A0, 0xAF51)
+DOUBLE_BYTE_PAIR(0x84A1, 0xAF52)
+DOUBLE_BYTE_PAIR(0x84A2, 0xAF53)
+DOUBLE_BYTE_PAIR(0x84A3, 0xAF54)
+DOUBLE_BYTE_PAIR(0x84A4, 0xAF55)
+DOUBLE_BYTE_PAIR(0x84A5, 0xAF56)
+DOUBLE_BYTE_PAIR(0x84A6, 0xAF57)
+DOUBLE_BYTE_PAIR(0x84A7, 0xAF58)
+DOUBLE_BYTE_PAIR(0x84A8, 0xAF59)
+DOUBLE_BYTE_PAIR(0x84A9, 0xAF5A)
+DOUBLE_BYTE_PAIR(0x84AA, 0xAF5B)
+DOUBLE_BYTE_PAIR(0x84AB, 0xAF5E)
+DOUBLE_BYTE_PAIR(0x84AC, 0xAF5F)
+DOUBLE_BYTE_PAIR(0x84AD, 0xAF60)
+DOUBLE_BYTE_PAIR(0x84AE, 0xAF61)
+DOUBLE_BYTE_PAIR(0x84AF, 0xAF62)
+DOUBLE_BYTE_PAIR(0x84B0, 0xAF63)
+DOUBLE_BYTE_PAIR(0x84B1, 0xAF66)
+DOUBLE_BYTE_PAIR(0x84B2, 0xAF67)
+DOUBLE_BYTE_PAIR(0x84B3, 0xAF68)
+DOUBLE_BYTE_PAIR(0x84B4, 0xAF69)
+DOUBLE_BYTE_PAIR(0x84B5, 0xAF6A)
+DOUBLE_BYTE_PAIR(0x84B6, 0xAF6B)
+DOUBLE_BYTE_PAIR(0x84B7, 0xAF6C)
+DOUBLE_BYTE_PAIR(0x84B8, 0xAF6D)
+DOUBLE_BYTE_PAIR(0x84B9, 0xAF6E)
+DOUBLE_BYTE_PAIR(0x84BA, 0xAF6F)
+DOUBLE_BYTE_PAIR(0x84BB, 0xAF70)
+DOUBLE_BYTE_PAIR(0x84BC, 0xAF71)
+DOUBLE_BYTE_PAIR(0x84BD, 0xAF72)
+DOUBLE_BYTE_PAIR(0x84BE, 0xAF73)
+DOUBLE_BYTE_PAIR(0x84BF, 0xAF74)
+DOUBLE_BYTE_PAIR(0x84C0, 0xAF75)
+DOUBLE_BYTE_PAIR(0x84C1, 0xAF76)
+DOUBLE_BYTE_PAIR(0x84C2, 0xAF77)
+DOUBLE_BYTE_PAIR(0x84C3, 0xAF78)
+DOUBLE_BYTE_PAIR(0x84C4, 0xAF7A)
+DOUBLE_BYTE_PAIR(0x84C5, 0xAF7B)
+DOUBLE_BYTE_PAIR(0x84C6, 0xAF7C)
+DOUBLE_BYTE_PAIR(0x84C7, 0xAF7D)
+DOUBLE_BYTE_PAIR(0x84C8, 0xAF7E)
+DOUBLE_BYTE_PAIR(0x84C9, 0xAF7F)
+DOUBLE_BYTE_PAIR(0x84CA, 0xAF81)
+DOUBLE_BYTE_PAIR(0x84CB, 0xAF82)
+DOUBLE_BYTE_PAIR(0x84CC, 0xAF83)
+DOUBLE_BYTE_PAIR(0x84CD, 0xAF85)
+DOUBLE_BYTE_PAIR(0x84CE, 0xAF86)
+DOUBLE_BYTE_PAIR(0x84CF, 0xAF87)
+DOUBLE_BYTE_PAIR(0x84D0, 0xAF89)
+DOUBLE_BYTE_PAIR(0x84D1, 0xAF8A)
+DOUBLE_BYTE_PAIR(0x84D2, 0xAF8B)
+DOUBLE_BYTE_PAIR(0x84D3, 0xAF8C)
+DOUBLE_BYTE_PAIR(0x84D4, 0xAF8D)
+DOUBLE_BYTE_PAIR(0x84D5, 0xAF8E)
+DOUBLE_BYTE_PAIR(0x84D6, 0xAF8F)
+DOUBLE_BYTE_PAIR(0x84D7, 0xAF92)
+DOUBLE_BYTE_PAIR(0x84D8, 0xAF93)
+DOUBLE_BYTE_PAIR(0x84D9, 0xAF94)
+DOUBLE_BYTE_PAIR(0x84DA, 0xAF96)
+DOUBLE_BYTE_PAIR(0x84DB, 0xAF97)
+DOUBLE_BYTE_PAIR(0x84DC, 0xAF98)
+DOUBLE_BYTE_PAIR(0x84DD, 0xAF99)
+DOUBLE_BYTE_PAIR(0x84DE, 0xAF9A)
+DOUBLE_BYTE_PAIR(0x84DF, 0xAF9B)
+DOUBLE_BYTE_PAIR(0x84E0, 0xAF9D)
+DOUBLE_BYTE_PAIR(0x84E1, 0xAF9E)
+DOUBLE_BYTE_PAIR(0x84E2, 0xAF9F)
+DOUBLE_BYTE_PAIR(0x84E3, 0xAFA0)
+DOUBLE_BYTE_PAIR(0x84E4, 0xAFA1)
+DOUBLE_BYTE_PAIR(0x84E5, 0xAFA2)
+DOUBLE_BYTE_PAIR(0x84E6, 0xAFA3)
+DOUBLE_BYTE_PAIR(0x84E7, 0xAFA4)
+DOUBLE_BYTE_PAIR(0x84E8, 0xAFA5)
+DOUBLE_BYTE_PAIR(0x84E9, 0xAFA6)
+DOUBLE_BYTE_PAIR(0x84EA, 0xAFA7)
+DOUBLE_BYTE_PAIR(0x84EB, 0xAFA8)
+DOUBLE_BYTE_PAIR(0x84EC, 0xAFA9)
+DOUBLE_BYTE_PAIR(0x84ED, 0xAFAA)
+DOUBLE_BYTE_PAIR(0x84EE, 0xAFAB)
+DOUBLE_BYTE_PAIR(0x84EF, 0xAFAC)
+DOUBLE_BYTE_PAIR(0x84F0, 0xAFAD)
+DOUBLE_BYTE_PAIR(0x84F1, 0xAFAE)
+DOUBLE_BYTE_PAIR(0x84F2, 0xAFAF)
+DOUBLE_BYTE_PAIR(0x84F3, 0xAFB0)
+DOUBLE_BYTE_PAIR(0x84F4, 0xAFB1)
+DOUBLE_BYTE_PAIR(0x84F5, 0xAFB2)
+DOUBLE_BYTE_PAIR(0x84F6, 0xAFB3)
+DOUBLE_BYTE_PAIR(0x84F7, 0xAFB4)
+DOUBLE_BYTE_PAIR(0x84F8, 0xAFB5)
+DOUBLE_BYTE_PAIR(0x84F9, 0xAFB6)
+DOUBLE_BYTE_PAIR(0x84FA, 0xAFB7)
+DOUBLE_BYTE_PAIR(0x84FB, 0xAFBA)
+DOUBLE_BYTE_PAIR(0x84FC, 0xAFBB)
+DOUBLE_BYTE_PAIR(0x84FD, 0xAFBD)
+DOUBLE_BYTE_PAIR(0x84FE, 0xAFBE)
+DOUBLE_BYTE_PAIR(0x8541, 0xAFBF)
+DOUBLE_BYTE_PAIR(0x8542, 0xAFC1)
+DOUBLE_BYTE_PAIR(0x8543, 0xAFC2)
+DOUBLE_BYTE_PAIR(0x8544, 0xAFC3)
+DOUBLE_BYTE_PAIR(0x8545, 0xAFC4)
+DOUBLE_BYTE_PAIR(0x8546, 0xAFC5)
+DOUBLE_BYTE_PAIR(0x8547, 0xAFC6)
+DOUBLE_BYTE_PAIR(0x8548, 0xAFCA)
+DOUBLE_BYTE_PAIR(0x8549, 0xAFCC)
+DOUBLE_BYTE_PAIR(0x854A, 0xAFCF)
+DOUBLE_BYTE_PAIR(0x854B, 0xAFD0)
+DOUBLE_BYTE_PAIR(0x854C, 0xAFD1)
+DOUBLE_BYTE_PAIR(0x854D, 0xAFD2)
+DOUBLE_BYTE_PAIR(0x854E, 0xAFD3)
+DOUBLE_BYTE_PAIR(0x854F, 0xAFD5)
+DOUBLE_BYTE_PAIR(0x8550, 0xAFD6)
+DOUBLE_BYTE_PAIR(0x8551, 0xAFD7)
+DOUBLE_BYTE_PAIR(0x8552, 0xAFD8)
+DOUBLE_BYTE_PAIR(0x8553, 0xAFD9)
+DOUBLE_BYTE_PAIR(0x8554, 0xAFDA)
+DOUBLE_BYTE_PAIR(0x8555, 0xAFDB)
+DOUBLE_BYTE_PAIR(0x8556, 0xAFDD)
+DOUBLE_BYTE_PAIR(0x8557, 0xAFDE)
+DOUBLE_BYTE_PAIR(0x8558, 0xAFDF)
+DOUBLE_BYTE_PAIR(0x8559, 0xAFE0)
+DOUBLE_BYTE_PAIR(0x855A, 0xAFE1)
+DOUBLE_BYTE_PAIR(0x8561, 0xAFE2)
+DOUBLE_BYTE_PAIR(0x8562, 0xAFE3)
+DOUBLE_BYTE_PAIR(0x8563, 0xAFE4)
+DOUBLE_BYTE_PAIR(0x8564, 0xAFE5)
+DOUBLE_BYTE_PAIR(0x8565, 0xAFE6)
+DOUBLE_BYTE_PAIR(0x8566, 0xAFE7)
+DOUBLE_BYTE_PAIR(0x8567, 0xAFEA)
+DOUBLE_BYTE_PAIR(0x8568, 0xAFEB)
+DOUBLE_BYTE_PAIR(0x8569, 0xAFEC)
+DOUBLE_BYTE_PAIR(0x856A, 0xAFED)
+DOUBLE_BYTE_PAIR(0x856B, 0xAFEE)
+DOUBLE_BYTE_PAIR(0x856C, 0xAFEF)
+DOUBLE_BYTE_PAIR(0x856D, 0xAFF2)
+DOUBLE_BYTE_PAIR(0x856E, 0xAFF3)
+DOUBLE_BYTE_PAIR(0x856F, 0xAFF5)
+DOUBLE_BYTE_PAIR(0x8570, 0xAFF6)
+DOUBLE_BYTE_PAIR(0x8571, 0xAFF7)
+DOUBLE_BYTE_PAIR(0x8572, 0xAFF9)
+DOUBLE_BYTE_PAIR(0x8573, 0xAFFA)
+DOUBLE_BYTE_PAIR(0x8574, 0xAFFB)
+DOUBLE_BYTE_PAIR(0x8575, 0xAFFC)
+DOUBLE_BYTE_PAIR(0x8576, 0xAFFD)
+DOUBLE_BYTE_PAIR(0x8577, 0xAFFE)
+DOUBLE_BYTE_PAIR(0x8578, 0xAFFF)
+DOUBLE_BYTE_PAIR(0x8579, 0xB002)
+DOUBLE_BYTE_PAIR(0x857A, 0xB003)
+DOUBLE_BYTE_PAIR(0x8581, 0xB005)
+DOUBLE_BYTE_PAIR(0x8582, 0xB006)
+DOUBLE_BYTE_PAIR(0x8583, 0xB007)
+DOUBLE_BYTE_PAIR(0x8584, 0xB008)
+DOUBLE_BYTE_PAIR(0x8585, 0xB009)
+DOUBLE_BYTE_PAIR(0x8586, 0xB00A)
+DOUBLE_BYTE_PAIR(0x8587, 0xB00B)
+DOUBLE_BYTE_PAIR(0x8588, 0xB00D)
+DOUBLE_BYTE_PAIR(0x8589, 0xB00E)
+DOUBLE_BYTE_PAIR(0x858A, 0xB00F)
+DOUBLE_BYTE_PAIR(0x858B, 0xB011)
+DOUBLE_BYTE_PAIR(0x858C, 0xB012)
+DOUBLE_BYTE_PAIR(0x858D, 0xB013)
+DOUBLE_BYTE_PAIR(0x858E, 0xB015)
+DOUBLE_BYTE_PAIR(0x858F, 0xB016)
+DOUBLE_BYTE_PAIR(0x8590, 0xB017)
+DOUBLE_BYTE_PAIR(0x8591, 0xB018)
+DOUBLE_BYTE_PAIR(0x8592, 0xB019)
+DOUBLE_BYTE_PAIR(0x8593, 0xB01A)
+DOUBLE_BYTE_PAIR(0x8594, 0xB01B)
+DOUBLE_BYTE_PAIR(0x8595, 0xB01E)
+DOUBLE_BYTE_PAIR(0x8596, 0xB01F)
+DOUBLE_BYTE_PAIR(0x8597, 0xB020)
+DOUBLE_BYTE_PAIR(0x8598, 0xB021)
+DOUBLE_BYTE_PAIR(0x8599, 0xB022)
+DOUBLE_BYTE_PAIR(0x859A, 0xB023)
+DOUBLE_BYTE_PAIR(0x859B, 0xB024)
+DOUBLE_BYTE_PAIR(0x859C, 0xB025)
+DOUBLE_BYTE_PAIR(0x859D, 0xB026)
+DOUBLE_BYTE_PAIR(0x859E, 0xB027)
+DOUBLE_BYTE_PAIR(0x859F, 0xB029)
+DOUBLE_BYTE_PAIR(0x85A0, 0xB02A)
+DOUBLE_BYTE_PAIR(0x85A1, 0xB02B)
+DOUBLE_BYTE_PAIR(0x85A2, 0xB02C)
+DOUBLE_BYTE_PAIR(0x85A3, 0xB02D)
+DOUBLE_BYTE_PAIR(0x85A4, 0xB02E)
+DOUBLE_BYTE_PAIR(0x85A5, 0xB02F)
+DOUBLE_BYTE_PAIR(0x85A6, 0xB030)
+DOUBLE_BYTE_PAIR(0x85A7, 0xB031)
+DOUBLE_BYTE_PAIR(0x85A8, 0xB032)
+DOUBLE_BYTE_PAIR(0x85A9, 0xB033)
+DOUBLE_BYTE_PAIR(0x85AA, 0xB034)
+DOUBLE_BYTE_PAIR(0x85AB, 0xB035)
+DOUBLE_BYTE_PAIR(0x85AC, 0xB036)
+DOUBLE_BYTE_PAIR(0x85AD, 0xB037)
+DOUBLE_BYTE_PAIR(0x85AE, 0xB038)
+DOUBLE_BYTE_PAIR(0x85AF, 0xB039)
+DOUBLE_BYTE_PAIR(0x85B0, 0xB03A)
+DOUBLE_BYTE_PAIR(0x85B1, 0xB03B)
+DOUBLE_BYTE_PAIR(0x85B2, 0xB03C)
+DOUBLE_BYTE_PAIR(0x85B3, 0xB03D)
+DOUBLE_BYTE_PAIR(0x85B4, 0xB03E)
+DOUBLE_BYTE_PAIR(0x85B5, 0xB03F)
+DOUBLE_BYTE_PAIR(0x85B6, 0xB040)
+DOUBLE_BYTE_PAIR(0x85B7, 0xB041)
+DOUBLE_BYTE_PAIR(0x85B8, 0xB042)
+DOUBLE_BYTE_PAIR(0x85B9, 0xB043)
+DOUBLE_BYTE_PAIR(0x85BA, 0xB046)
+DOUBLE_BYTE_PAIR(0x85BB, 0xB047)
+DOUBLE_BYTE_PAIR(0x85BC, 0xB049)
+DOUBLE_BYTE_PAIR(0x85BD, 0xB04B)
+DOUBLE_BYTE_PAIR(0x85BE, 0xB04D)
+DOUBLE_BYTE_PAIR(0x85BF, 0xB04F)
+DOUBLE_BYTE_PAIR(0x85C0, 0xB050)
+DOUBLE_BYTE_PAIR(0x85C1, 0xB051)
+DOUBLE_BYTE_PAIR(0x85C2, 0xB052)
+DOUBLE_BYTE_PAIR(0x85C3, 0xB056)
+DOUBLE_BYTE_PAIR(0x85C4, 0xB058)
+DOUBLE_BYTE_PAIR(0x85C5, 0xB05A)
+DOUBLE_BYTE_PAIR(0x85C6, 0xB05B)
+DOUBLE_BYTE_PAIR(0x85C7, 0xB05C)
+DOUBLE_BYTE_PAIR(0x85C8, 0xB05E)
+DOUBLE_BYTE_PAIR(0x85C9, 0xB05F)
+DOUBLE_BYTE_PAIR(0x85CA, 0xB060)
+DOUBLE_BYTE_PAIR(0x85CB, 0xB061)
+DOUBLE_BYTE_PAIR(0x85CC, 0xB062)
+DOUBLE_BYTE_PAIR(0x85CD, 0xB063)
+DOUBLE_BYTE_PAIR(0x85CE, 0xB064)
+DOUBLE_BYTE_PAIR(0x85CF, 0xB065)
+DOUBLE_BYTE_PAIR(0x85D0, 0xB066)
+DOUBLE_BYTE_PAIR(0x85D1, 0xB067)
+DOUBLE_BYTE_PAIR(0x85D2, 0xB068)
+DOUBLE_BYTE_PAIR(0x85D3, 0xB069)
+DOUBLE_BYTE_PAIR(0x85D4, 0xB06A)
+DOUBLE_BYTE_PAIR(0x85D5, 0xB06B)
+DOUBLE_BYTE_PAIR(0x85D6, 0xB06C)
+DOUBLE_BYTE_PAIR(0x85D7, 0xB06D)
+DOUBLE_BYTE_PAIR(0x85D8, 0xB06E)
+DOUBLE_BYTE_PAIR(0x85D9, 0xB06F)
+DOUBLE_BYTE_PAIR(0x85DA, 0xB070)
+DOUBLE_BYTE_PAIR(0x85DB, 0xB071)
+DOUBLE_BYTE_PAIR(0x85DC, 0xB072)
+DOUBLE_BYTE_PAIR(0x85DD, 0xB073)
+DOUBLE_BYTE_PAIR(0x85DE, 0xB074)
+DOUBLE_BYTE_PAIR(0x85DF, 0xB075)
+DOUBLE_BYTE_PAIR(0x85E0, 0xB076)
+DOUBLE_BYTE_PAIR(0x85E1, 0xB077)
+DOUBLE_BYTE_PAIR(0x85E2, 0xB078)
+DOUBLE_BYTE_PAIR(0x85E3, 0xB079)
+DOUBLE_BYTE_PAIR(0x85E4, 0xB07A)
+DOUBLE_BYTE_PAIR(0x85E5, 0xB07B)
+DOUBLE_BYTE_PAIR(0x85E6, 0xB07E)
+DOUBLE_BYTE_PAIR(0x85E7, 0xB07F)
+DOUBLE_BYTE_PAIR(0x85E8, 0xB081)
+DOUBLE_BYTE_PAIR(0x85E9, 0xB082)
+DOUBLE_BYTE_PAIR(0x85EA, 0xB083)
+DOUBLE_BYTE_PAIR(0x85EB, 0xB085)
+DOUBLE_BYTE_PAIR(0x85EC, 0xB086)
+DOUBLE_BYTE_PAIR(0x85ED, 0xB087)
+DOUBLE_BYTE_PAIR(0x85EE, 0xB088)
+DOUBLE_BYTE_PAIR(0x85EF, 0xB089)
+DOUBLE_BYTE_PAIR(0x85F0, 0xB08A)
+DOUBLE_BYTE_PAIR(0x85F1, 0xB08B)
+DOUBLE_BYTE_PAIR(0x85F2, 0xB08E)
+DOUBLE_BYTE_PAIR(0x85F3, 0xB090)
+DOUBLE_BYTE_PAIR(0x85F4, 0xB092)
+DOUBLE_BYTE_PAIR(0x85F5, 0xB093)
+DOUBLE_BYTE_PAIR(0x85F6, 0xB094)
+DOUBLE_BYTE_PAIR(0x85F7, 0xB095)
+DOUBLE_BYTE_PAIR(0x85F8, 0xB096)
+DOUBLE_BYTE_PAIR(0x85F9, 0xB097)
+DOUBLE_BYTE_PAIR(0x85FA, 0xB09B)
+DOUBLE_BYTE_PAIR(0x85FB, 0xB09D)
+DOUBLE_BYTE_PAIR(0x85FC, 0xB09E)
+DOUBLE_BYTE_PAIR(0x85FD, 0xB0A3)
+DOUBLE_BYTE_PAIR(0x85FE, 0xB0A4)
+DOUBLE_BYTE_PAIR(0x8641, 0xB0A5)
+DOUBLE_BYTE_PAIR(0x8642, 0xB0A6)
+DOUBLE_BYTE_PAIR(0x8643, 0xB0A7)
+DOUBLE_BYTE_PAIR(0x8644, 0xB0AA)
+DOUBLE_BYTE_PAIR(0x8645, 0xB0B0)
+DOUBLE_BYTE_PAIR(0x8646, 0xB0B2)
+DOUBLE_BYTE_PAIR(0x8647, 0xB0B6)
+DOUBLE_BYTE_PAIR(0x8648, 0xB0B7)
+DOUBLE_BYTE_PAIR(0x8649, 0xB0B9)
+DOUBLE_BYTE_PAIR(0x864A, 0xB0BA)
+DOUBLE_BYTE_PAIR(0x864B, 0xB0BB)
+DOUBLE_BYTE_PAIR(0x864C, 0xB0BD)
+DOUBLE_BYTE_PAIR(0x864D, 0xB0BE)
+DOUBLE_BYTE_PAIR(0x864E, 0xB0BF)
+DOUBLE_BYTE_PAIR(0x864F, 0xB0C0)
+DOUBLE_BYTE_PAIR(0x8650, 0xB0C1)
+DOUBLE_BYTE_PAIR(0x8651, 0xB0C2)
+DOUBLE_BYTE_PAIR(0x8652, 0xB0C3)
+DOUBLE_BYTE_PAIR(0x8653, 0xB0C6)
+DOUBLE_BYTE_PAIR(0x8654, 0xB0CA)
+DOUBLE_BYTE_PAIR(0x8655, 0xB0CB)
+DOUBLE_BYTE_PAIR(0x8656, 0xB0CC)
+DOUBLE_BYTE_PAIR(0x8657, 0xB0CD)
+DOUBLE_BYTE_PAIR(0x8658, 0xB0CE)
+DOUBLE_BYTE_PAIR(0x8659, 0xB0CF)
+DOUBLE_BYTE_PAIR(0x865A, 0xB0D2)
+DOUBLE_BYTE_PAIR(0x8661, 0xB0D3)
+DOUBLE_BYTE_PAIR(0x8662, 0xB0D5)
+DOUBLE_BYTE_PAIR(0x8663, 0xB0D6)
+DOUBLE_BYTE_PAIR(0x8664, 0xB0D7)
+DOUBLE_BYTE_PAIR(0x8665, 0xB0D9)
+DOUBLE_BYTE_PAIR(0x8666, 0xB0DA)
+DOUBLE_BYTE_PAIR(0x8667, 0xB0DB)
+DOUBLE_BYTE_PAIR(0x8668, 0xB0DC)
+DOUBLE_BYTE_PAIR(0x8669, 0xB0DD)
+DOUBLE_BYTE_PAIR(0x866A, 0xB0DE)
+DOUBLE_BYTE_PAIR(0x866B, 0xB0DF)
+DOUBLE_BYTE_PAIR(0x866C, 0xB0E1)
+DOUBLE_BYTE_PAIR(0x866D, 0xB0E2)
+DOUBLE_BYTE_PAIR(0x866E, 0xB0E3)
+DOUBLE_BYTE_PAIR(0x866F, 0xB0E4)
+DOUBLE_BYTE_PAIR(0x8670, 0xB0E6)
+DOUBLE_BYTE_PAIR(0x8671, 0xB0E7)
+DOUBLE_BYTE_PAIR(0x8672, 0xB0E8)
+DOUBLE_BYTE_PAIR(0x8673, 0xB0E9)
+DOUBLE_BYTE_PAIR(0x8674, 0xB0EA)
+DOUBLE_BYTE_PAIR(0x8675, 0xB0EB)
+DOUBLE_BYTE_PAIR(0x8676, 0xB0EC)
+DOUBLE_BYTE_PAIR(0x8677, 0xB0ED)
+DOUBLE_BYTE_PAIR(0x8678, 0xB0EE)
+DOUBLE_BYTE_PAIR(0x8679, 0xB0EF)
+DOUBLE_BYTE_PAIR(0x867A, 0xB0F0)
+DOUBLE_BYTE_PAIR(0x8681, 0xB0F1)
+DOUBLE_BYTE_PAIR(0x8682, 0xB0F2)
+DOUBLE_BYTE_PAIR(0x8683, 0xB0F3)
+DOUBLE_BYTE_PAIR(0x8684, 0xB0F4)
+DOUBLE_BYTE_PAIR(0x8685, 0xB0F5)
+DOUBLE_BYTE_PAIR(0x8686, 0xB0F6)
+DOUBLE_BYTE_PAIR(0x8687, 0xB0F7)
+DOUBLE_BYTE_PAIR(0x8688, 0xB0F8)
+DOUBLE_BYTE_PAIR(0x8689, 0xB0F9)
+DOUBLE_BYTE_PAIR(0x868A, 0xB0FA)
+DOUBLE_BYTE_PAIR(0x868B, 0xB0FB)
+DOUBLE_BYTE_PAIR(0x868C, 0xB0FC)
+DOUBLE_BYTE_PAIR(0x868D, 0xB0FD)
+DOUBLE_BYTE_PAIR(0x868E, 0xB0FE)
+DOUBLE_BYTE_PAIR(0x868F, 0xB0FF)
+DOUBLE_BYTE_PAIR(0x8690, 0xB100)
+DOUBLE_BYTE_PAIR(0x8691, 0xB101)
+DOUBLE_BYTE_PAIR(0x8692, 0xB102)
+DOUBLE_BYTE_PAIR(0x8693, 0xB103)
+DOUBLE_BYTE_PAIR(0x8694, 0xB104)
+DOUBLE_BYTE_PAIR(0x8695, 0xB105)
+DOUBLE_BYTE_PAIR(0x8696, 0xB106)
+DOUBLE_BYTE_PAIR(0x8697, 0xB107)
+DOUBLE_BYTE_PAIR(0x8698, 0xB10A)
+DOUBLE_BYTE_PAIR(0x8699, 0xB10D)
+DOUBLE_BYTE_PAIR(0x869A, 0xB10E)
+DOUBLE_BYTE_PAIR(0x869B, 0xB10F)
+DOUBLE_BYTE_PAIR(0x869C, 0xB111)
+DOUBLE_BYTE_PAIR(0x869D, 0xB114)
+DOUBLE_BYTE_PAIR(0x869E, 0xB115)
+DOUBLE_BYTE_PAIR(0x869F, 0xB116)
+DOUBLE_BYTE_PAIR(0x86A0, 0xB117)
+DOUBLE_BYTE_PAIR(0x86A1, 0xB11A)
+DOUBLE_BYTE_PAIR(0x86A2, 0xB11E)
+DOUBLE_BYTE_PAIR(0x86A3, 0xB11F)
+DOUBLE_BYTE_PAIR(0x86A4, 0xB120)
+DOUBLE_BYTE_PAIR(0x86A5, 0xB121)
+DOUBLE_BYTE_PAIR(0x86A6, 0xB122)
+DOUBLE_BYTE_PAIR(0x86A7, 0xB126)
+DOUBLE_BYTE_PAIR(0x86A8, 0xB127)
+DOUBLE_BYTE_PAIR(0x86A9, 0xB129)
+DOUBLE_BYTE_PAIR(0x86AA, 0xB12A)
+DOUBLE_BYTE_PAIR(0x86AB, 0xB12B)
+DOUBLE_BYTE_PAIR(0x86AC, 0xB12D)
+DOUBLE_BYTE_PAIR(0x86AD, 0xB12E)
+DOUBLE_BYTE_PAIR(0x86AE, 0xB12F)
+DOUBLE_BYTE_PAIR(0x86AF, 0xB130)
+DOUBLE_BYTE_PAIR(0x86B0, 0xB131)
+DOUBLE_BYTE_PAIR(0x86B1, 0xB132)
+DOUBLE_BYTE_PAIR(0x86B2, 0xB133)
+DOUBLE_BYTE_PAIR(0x86B3, 0xB136)
+DOUBLE_BYTE_PAIR(0x86B4, 0xB13A)
+DOUBLE_BYTE_PAIR(0x86B5, 0xB13B)
+DOUBLE_BYTE_PAIR(0x86B6, 0xB13C)
+DOUBLE_BYTE_PAIR(0x86B7, 0xB13D)
+DOUBLE_BYTE_PAIR(0x86B8, 0xB13E)
+DOUBLE_BYTE_PAIR(0x86B9, 0xB13F)
+DOUBLE_BYTE_PAIR(0x86BA, 0xB142)
+DOUBLE_BYTE_PAIR(0x86BB, 0xB143)
+DOUBLE_BYTE_PAIR(0x86BC, 0xB145)
+DOUBLE_BYTE_PAIR(0x86BD, 0xB146)
+DOUBLE_BYTE_PAIR(0x86BE, 0xB147)
+DOUBLE_BYTE_PAIR(0x86BF, 0xB149)
+DOUBLE_BYTE_PAIR(0x86C0, 0xB14A)
+DOUBLE_BYTE_PAIR(0x86C1, 0xB14B)
+DOUBLE_BYTE_PAIR(0x86C2, 0xB14C)
+DOUBLE_BYTE_PAIR(0x86C3, 0xB14D)
+DOUBLE_BYTE_PAIR(0x86C4, 0xB14E)
+DOUBLE_BYTE_PAIR(0x86C5, 0xB14F)
+DOUBLE_BYTE_PAIR(0x86C6, 0xB152)
+DOUBLE_BYTE_PAIR(0x86C7, 0xB153)
+DOUBLE_BYTE_PAIR(0x86C8, 0xB156)
+DOUBLE_BYTE_PAIR(0x86C9, 0xB157)
+DOUBLE_BYTE_PAIR(0x86CA, 0xB159)
+DOUBLE_BYTE_PAIR(0x86CB, 0xB15A)
+DOUBLE_BYTE_PAIR(0x86CC, 0xB15B)
+DOUBLE_BYTE_PAIR(0x86CD, 0xB15D)
+DOUBLE_BYTE_PAIR(0x86CE, 0xB15E)
+DOUBLE_BYTE_PAIR(0x86CF, 0xB15F)
+DOUBLE_BYTE_PAIR(0x86D0, 0xB161)
+DOUBLE_BYTE_PAIR(0x86D1, 0xB162)
+DOUBLE_BYTE_PAIR(0x86D2, 0xB163)
+DOUBLE_BYTE_PAIR(0x86D3, 0xB164)
+DOUBLE_BYTE_PAIR(0x86D4, 0xB165)
+DOUBLE_BYTE_PAIR(0x86D5, 0xB166)
+DOUBLE_BYTE_PAIR(0x86D6, 0xB167)
+DOUBLE_BYTE_PAIR(0x86D7, 0xB168)
+DOUBLE_BYTE_PAIR(0x86D8, 0xB169)
+DOUBLE_BYTE_PAIR(0x86D9, 0xB16A)
+DOUBLE_BYTE_PAIR(0x86DA, 0xB16B)
+DOUBLE_BYTE_PAIR(0x86DB, 0xB16C)
+DOUBLE_BYTE_PAIR(0x86DC, 0xB16D)
+DOUBLE_BYTE_PAIR(0x86DD, 0xB16E)
+DOUBLE_BYTE_PAIR(0x86DE, 0xB16F)
+DOUBLE_BYTE_PAIR(0x86DF, 0xB170)
+DOUBLE_BYTE_PAIR(0x86E0, 0xB171)
+DOUBLE_BYTE_PAIR(0x86E1, 0xB172)
+DOUBLE_BYTE_PAIR(0x86E2, 0xB173)
+DOUBLE_BYTE_PAIR(0x86E3, 0xB174)
+DOUBLE_BYTE_PAIR(0x86E4, 0xB175)
+DOUBLE_BYTE_PAIR(0x86E5, 0xB176)
+DOUBLE_BYTE_PAIR(0x86E6, 0xB177)
+DOUBLE_BYTE_PAIR(0x86E7, 0xB17A)
+DOUBLE_BYTE_PAIR(0x86E8, 0xB17B)
+DOUBLE_BYTE_PAIR(0x86E9, 0xB17D)
+DOUBLE_BYTE_PAIR(0x86EA, 0xB17E)
+DOUBLE_BYTE_PAIR(0x86EB, 0xB17F)
+DOUBLE_BYTE_PAIR(0x86EC, 0xB181)
+DOUBLE_BYTE_PAIR(0x86ED, 0xB183)
+DOUBLE_BYTE_PAIR(0x86EE, 0xB184)
+DOUBLE_BYTE_PAIR(0x86EF, 0xB185)
+DOUBLE_BYTE_PAIR(0x86F0, 0xB186)
+DOUBLE_BYTE_PAIR(0x86F1, 0xB187)
+DOUBLE_BYTE_PAIR(0x86F2, 0xB18A)
+DOUBLE_BYTE_PAIR(0x86F3, 0xB18C)
+DOUBLE_BYTE_PAIR(0x86F4, 0xB18E)
+DOUBLE_BYTE_PAIR(0x86F5, 0xB18F)
+DOUBLE_BYTE_PAIR(0x86F6, 0xB190)
+DOUBLE_BYTE_PAIR(0x86F7, 0xB191)
+DOUBLE_BYTE_PAIR(0x86F8, 0xB195)
+DOUBLE_BYTE_PAIR(0x86F9, 0xB196)
+DOUBLE_BYTE_PAIR(0x86FA, 0xB197)
+DOUBLE_BYTE_PAIR(0x86FB, 0xB199)
+DOUBLE_BYTE_PAIR(0x86FC, 0xB19A)
+DOUBLE_BYTE_PAIR(0x86FD, 0xB19B)
+DOUBLE_BYTE_PAIR(0x86FE, 0xB19D)
+DOUBLE_BYTE_PAIR(0x8741, 0xB19E)
+DOUBLE_BYTE_PAIR(0x8742, 0xB19F)
+DOUBLE_BYTE_PAIR(0x8743, 0xB1A0)
+DOUBLE_BYTE_PAIR(0x8744, 0xB1A1)
+DOUBLE_BYTE_PAIR(0x8745, 0xB1A2)
+DOUBLE_BYTE_PAIR(0x8746, 0xB1A3)
+DOUBLE_BYTE_PAIR(0x8747, 0xB1A4)
+DOUBLE_BYTE_PAIR(0x8748, 0xB1A5)
+DOUBLE_BYTE_PAIR(0x8749, 0xB1A6)
+DOUBLE_BYTE_PAIR(0x874A, 0xB1A7)
+DOUBLE_BYTE_PAIR(0x874B, 0xB1A9)
+DOUBLE_BYTE_PAIR(0x874C, 0xB1AA)
+DOUBLE_BYTE_PAIR(0x874D, 0xB1AB)
+DOUBLE_BYTE_PAIR(0x874E, 0xB1AC)
+DOUBLE_BYTE_PAIR(0x874F, 0xB1AD)
+DOUBLE_BYTE_PAIR(0x8750, 0xB1AE)
+DOUBLE_BYTE_PAIR(0x8751, 0xB1AF)
+DOUBLE_BYTE_PAIR(0x8752, 0xB1B0)
+DOUBLE_BYTE_PAIR(0x8753, 0xB1B1)
+DOUBLE_BYTE_PAIR(0x8754, 0xB1B2)
+DOUBLE_BYTE_PAIR(0x8755, 0xB1B3)
+DOUBLE_BYTE_PAIR(0x8756, 0xB1B4)
+DOUBLE_BYTE_PAIR(0x8757, 0xB1B5)
+DOUBLE_BYTE_PAIR(0x8758, 0xB1B6)
+DOUBLE_BYTE_PAIR(0x8759, 0xB1B7)
+DOUBLE_BYTE_PAIR(0x875A, 0xB1B8)
+DOUBLE_BYTE_PAIR(0x8761, 0xB1B9)
+DOUBLE_BYTE_PAIR(0x8762, 0xB1BA)
+DOUBLE_BYTE_PAIR(0x8763, 0xB1BB)
+DOUBLE_BYTE_PAIR(0x8764, 0xB1BC)
+DOUBLE_BYTE_PAIR(0x8765, 0xB1BD)
+DOUBLE_BYTE_PAIR(0x8766, 0xB1BE)
+DOUBLE_BYTE_PAIR(0x8767, 0xB1BF)
+DOUBLE_BYTE_PAIR(0x8768, 0xB1C0)
+DOUBLE_BYTE_PAIR(0x8769, 0xB1C1)
+DOUBLE_BYTE_PAIR(0x876A, 0xB1C2)
+DOUBLE_BYTE_PAIR(0x876B, 0xB1C3)
+DOUBLE_BYTE_PAIR(0x876C, 0xB1C4)
+DOUBLE_BYTE_PAIR(0x876D, 0xB1C5)
+DOUBLE_BYTE_PAIR(0x876E, 0xB1C6)
+DOUBLE_BYTE_PAIR(0x876F, 0xB1C7)
+DOUBLE_BYTE_PAIR(0x8770, 0xB1C8)
+DOUBLE_BYTE_PAIR(0x8771, 0xB1C9)
+DOUBLE_BYTE_PAIR(0x8772, 0xB1CA)
+DOUBLE_BYTE_PAIR(0x8773, 0xB1CB)
+DOUBLE_BYTE_PAIR(0x8774, 0xB1CD)
+DOUBLE_BYTE_PAIR(0x8775, 0xB1CE)
+DOUBLE_BYTE_PAIR(0x8776, 0xB1CF)
+DOUBLE_BYTE_PAIR(0x8777, 0xB1D1)
+DOUBLE_BYTE_PAIR(0x8778, 0xB1D2)
+DOUBLE_BYTE_PAIR(0x8779, 0xB1D3)
+DOUBLE_BYTE_PAIR(0x877A, 0xB1D5)
+DOUBLE_BYTE_PAIR(0x8781, 0xB1D6)
+DOUBLE_BYTE_PAIR(0x8782, 0xB1D7)
+DOUBLE_BYTE_PAIR(0x8783, 0xB1D8)
+DOUBLE_BYTE_PAIR(0x8784, 0xB1D9)
+DOUBLE_BYTE_PAIR(0x8785, 0xB1DA)
+DOUBLE_BYTE_PAIR(0x8786, 0xB1DB)
+DOUBLE_BYTE_PAIR(0x8787, 0xB1DE)
+DOUBLE_BYTE_PAIR(0x8788, 0xB1E0)
+DOUBLE_BYTE_PAIR(0x8789, 0xB1E1)
+DOUBLE_BYTE_PAIR(0x878A, 0xB1E2)
+DOUBLE_BYTE_PAIR(0x878B, 0xB1E3)
+DOUBLE_BYTE_PAIR(0x878C, 0xB1E4)
+DOUBLE_BYTE_PAIR(0x878D, 0xB1E5)
+DOUBLE_BYTE_PAIR(0x878E, 0xB1E6)
+DOUBLE_BYTE_PAIR(0x878F, 0xB1E7)
+DOUBLE_BYTE_PAIR(0x8790, 0xB1EA)
+DOUBLE_BYTE_PAIR(0x8791, 0xB1EB)
+DOUBLE_BYTE_PAIR(0x8792, 0xB1ED)
+DOUBLE_BYTE_PAIR(0x8793, 0xB1EE)
+DOUBLE_BYTE_PAIR(0x8794, 0xB1EF)
+DOUBLE_BYTE_PAIR(0x8795, 0xB1F1)
+DOUBLE_BYTE_PAIR(0x8796, 0xB1F2)
+DOUBLE_BYTE_PAIR(0x8797, 0xB1F3)
+DOUBLE_BYTE_PAIR(0x8798, 0xB1F4)
+DOUBLE_BYTE_PAIR(0x8799, 0xB1F5)
+DOUBLE_BYTE_PAIR(0x879A, 0xB1F6)
+DOUBLE_BYTE_PAIR(0x879B, 0xB1F7)
+DOUBLE_BYTE_PAIR(0x879C, 0xB1F8)
+DOUBLE_BYTE_PAIR(0x879D, 0xB1FA)
+DOUBLE_BYTE_PAIR(0x879E, 0xB1FC)
+DOUBLE_BYTE_PAIR(0x879F, 0xB1FE)
+DOUBLE_BYTE_PAIR(0x87A0, 0xB1FF)
+DOUBLE_BYTE_PAIR(0x87A1, 0xB200)
+DOUBLE_BYTE_PAIR(0x87A2, 0xB201)
+DOUBLE_BYTE_PAIR(0x87A3, 0xB202)
+DOUBLE_BYTE_PAIR(0x87A4, 0xB203)
+DOUBLE_BYTE_PAIR(0x87A5, 0xB206)
+DOUBLE_BYTE_PAIR(0x87A6, 0xB207)
+DOUBLE_BYTE_PAIR(0x87A7, 0xB209)
+DOUBLE_BYTE_PAIR(0x87A8, 0xB20A)
+DOUBLE_BYTE_PAIR(0x87A9, 0xB20D)
+DOUBLE_BYTE_PAIR(0x87AA, 0xB20E)
+DOUBLE_BYTE_PAIR(0x87AB, 0xB20F)
+DOUBLE_BYTE_PAIR(0x87AC, 0xB210)
+DOUBLE_BYTE_PAIR(0x87AD, 0xB211)
+DOUBLE_BYTE_PAIR(0x87AE, 0xB212)
+DOUBLE_BYTE_PAIR(0x87AF, 0xB213)
+DOUBLE_BYTE_PAIR(0x87B0, 0xB216)
+DOUBLE_BYTE_PAIR(0x87B1, 0xB218)
+DOUBLE_BYTE_PAIR(0x87B2, 0xB21A)
+DOUBLE_BYTE_PAIR(0x87B3, 0xB21B)
+DOUBLE_BYTE_PAIR(0x87B4, 0xB21C)
+DOUBLE_BYTE_PAIR(0x87B5, 0xB21D)
+DOUBLE_BYTE_PAIR(0x87B6, 0xB21E)
+DOUBLE_BYTE_PAIR(0x87B7, 0xB21F)
+DOUBLE_BYTE_PAIR(0x87B8, 0xB221)
+DOUBLE_BYTE_PAIR(0x87B9, 0xB222)
+DOUBLE_BYTE_PAIR(0x87BA, 0xB223)
+DOUBLE_BYTE_PAIR(0x87BB, 0xB224)
+DOUBLE_BYTE_PAIR(0x87BC, 0xB225)
+DOUBLE_BYTE_PAIR(0x87BD, 0xB226)
+DOUBLE_BYTE_PAIR(0x87BE, 0xB227)
+DOUBLE_BYTE_PAIR(0x87BF, 0xB228)
+DOUBLE_BYTE_PAIR(0x87C0, 0xB229)
+DOUBLE_BYTE_PAIR(0x87C1, 0xB22A)
+DOUBLE_BYTE_PAIR(0x87C2, 0xB22B)
+DOUBLE_BYTE_PAIR(0x87C3, 0xB22C)
+DOUBLE_BYTE_PAIR(0x87C4, 0xB22D)
+DOUBLE_BYTE_PAIR(0x87C5, 0xB22E)
+DOUBLE_BYTE_PAIR(0x87C6, 0xB22F)
+DOUBLE_BYTE_PAIR(0x87C7, 0xB230)
+DOUBLE_BYTE_PAIR(0x87C8, 0xB231)
+DOUBLE_BYTE_PAIR(0x87C9, 0xB232)
+DOUBLE_BYTE_PAIR(0x87CA, 0xB233)
+DOUBLE_BYTE_PAIR(0x87CB, 0xB235)
+DOUBLE_BYTE_PAIR(0x87CC, 0xB236)
+DOUBLE_BYTE_PAIR(0x87CD, 0xB237)
+DOUBLE_BYTE_PAIR(0x87CE, 0xB238)
+DOUBLE_BYTE_PAIR(0x87CF, 0xB239)
+DOUBLE_BYTE_PAIR(0x87D0, 0xB23A)
+DOUBLE_BYTE_PAIR(0x87D1, 0xB23B)
+DOUBLE_BYTE_PAIR(0x87D2, 0xB23D)
+DOUBLE_BYTE_PAIR(0x87D3, 0xB23E)
+DOUBLE_BYTE_PAIR(0x87D4, 0xB23F)
+DOUBLE_BYTE_PAIR(0x87D5, 0xB240)
+DOUBLE_BYTE_PAIR(0x87D6, 0xB241)
+DOUBLE_BYTE_PAIR(0x87D7, 0xB242)
+DOUBLE_BYTE_PAIR(0x87D8, 0xB243)
+DOUBLE_BYTE_PAIR(0x87D9, 0xB244)
+DOUBLE_BYTE_PAIR(0x87DA, 0xB245)
+DOUBLE_BYTE_PAIR(0x87DB, 0xB246)
+DOUBLE_BYTE_PAIR(0x87DC, 0xB247)
+DOUBLE_BYTE_PAIR(0x87DD, 0xB248)
+DOUBLE_BYTE_PAIR(0x87DE, 0xB249)
+DOUBLE_BYTE_PAIR(0x87DF, 0xB24A)
+DOUBLE_BYTE_PAIR(0x87E0, 0xB24B)
+DOUBLE_BYTE_PAIR(0x87E1, 0xB24C)
+DOUBLE_BYTE_PAIR(0x87E2, 0xB24D)
+DOUBLE_BYTE_PAIR(0x87E3, 0xB24E)
+DOUBLE_BYTE_PAIR(0x87E4, 0xB24F)
+DOUBLE_BYTE_PAIR(0x87E5, 0xB250)
+DOUBLE_BYTE_PAIR(0x87E6, 0xB251)
+DOUBLE_BYTE_PAIR(0x87E7, 0xB252)
+DOUBLE_BYTE_PAIR(0x87E8, 0xB253)
+DOUBLE_BYTE_PAIR(0x87E9, 0xB254)
+DOUBLE_BYTE_PAIR(0x87EA, 0xB255)
+DOUBLE_BYTE_PAIR(0x87EB, 0xB256)
+DOUBLE_BYTE_PAIR(0x87EC, 0xB257)
+DOUBLE_BYTE_PAIR(0x87ED, 0xB259)
+DOUBLE_BYTE_PAIR(0x87EE, 0xB25A)
+DOUBLE_BYTE_PAIR(0x87EF, 0xB25B)
+DOUBLE_BYTE_PAIR(0x87F0, 0xB25D)
+DOUBLE_BYTE_PAIR(0x87F1, 0xB25E)
+DOUBLE_BYTE_PAIR(0x87F2, 0xB25F)
+DOUBLE_BYTE_PAIR(0x87F3, 0xB261)
+DOUBLE_BYTE_PAIR(0x87F4, 0xB262)
+DOUBLE_BYTE_PAIR(0x87F5, 0xB263)
+DOUBLE_BYTE_PAIR(0x87F6, 0xB264)
+DOUBLE_BYTE_PAIR(0x87F7, 0xB265)
+DOUBLE_BYTE_PAIR(0x87F8, 0xB266)
+DOUBLE_BYTE_PAIR(0x87F9, 0xB267)
+DOUBLE_BYTE_PAIR(0x87FA, 0xB26A)
+DOUBLE_BYTE_PAIR(0x87FB, 0xB26B)
+DOUBLE_BYTE_PAIR(0x87FC, 0xB26C)
+DOUBLE_BYTE_PAIR(0x87FD, 0xB26D)
+DOUBLE_BYTE_PAIR(0x87FE, 0xB26E)
+DOUBLE_BYTE_PAIR(0x8841, 0xB26F)
+DOUBLE_BYTE_PAIR(0x8842, 0xB270)
+DOUBLE_BYTE_PAIR(0x8843, 0xB271)
+DOUBLE_BYTE_PAIR(0x8844, 0xB272)
+DOUBLE_BYTE_PAIR(0x8845, 0xB273)
+DOUBLE_BYTE_PAIR(0x8846, 0xB276)
+DOUBLE_BYTE_PAIR(0x8847, 0xB277)
+DOUBLE_BYTE_PAIR(0x8848, 0xB278)
+DOUBLE_BYTE_PAIR(0x8849, 0xB279)
+DOUBLE_BYTE_PAIR(0x884A, 0xB27A)
+DOUBLE_BYTE_PAIR(0x884B, 0xB27B)
+DOUBLE_BYTE_PAIR(0x884C, 0xB27D)
+DOUBLE_BYTE_PAIR(0x884D, 0xB27E)
+DOUBLE_BYTE_PAIR(0x884E, 0xB27F)
+DOUBLE_BYTE_PAIR(0x884F, 0xB280)
+DOUBLE_BYTE_PAIR(0x8850, 0xB281)
+DOUBLE_BYTE_PAIR(0x8851, 0xB282)
+DOUBLE_BYTE_PAIR(0x8852, 0xB283)
+DOUBLE_BYTE_PAIR(0x8853, 0xB286)
+DOUBLE_BYTE_PAIR(0x8854, 0xB287)
+DOUBLE_BYTE_PAIR(0x8855, 0xB288)
+DOUBLE_BYTE_PAIR(0x8856, 0xB28A)
+DOUBLE_BYTE_PAIR(0x8857, 0xB28B)
+DOUBLE_BYTE_PAIR(0x8858, 0xB28C)
+DOUBLE_BYTE_PAIR(0x8859, 0xB28D)
+DOUBLE_BYTE_PAIR(0x885A, 0xB28E)
+DOUBLE_BYTE_PAIR(0x8861, 0xB28F)
+DOUBLE_BYTE_PAIR(0x8862, 0xB292)
+DOUBLE_BYTE_PAIR(0x8863, 0xB293)
+DOUBLE_BYTE_PAIR(0x8864, 0xB295)
+DOUBLE_BYTE_PAIR(0x8865, 0xB296)
+DOUBLE_BYTE_PAIR(0x8866, 0xB297)
+DOUBLE_BYTE_PAIR(0x8867, 0xB29B)
+DOUBLE_BYTE_PAIR(0x8868, 0xB29C)
+DOUBLE_BYTE_PAIR(0x8869, 0xB29D)
+DOUBLE_BYTE_PAIR(0x886A, 0xB29E)
+DOUBLE_BYTE_PAIR(0x886B, 0xB29F)
+DOUBLE_BYTE_PAIR(0x886C, 0xB2A2)
+DOUBLE_BYTE_PAIR(0x886D, 0xB2A4)
+DOUBLE_BYTE_PAIR(0x886E, 0xB2A7)
+DOUBLE_BYTE_PAIR(0x886F, 0xB2A8)
+DOUBLE_BYTE_PAIR(0x8870, 0xB2A9)
+DOUBLE_BYTE_PAIR(0x8871, 0xB2AB)
+DOUBLE_BYTE_PAIR(0x8872, 0xB2AD)
+DOUBLE_BYTE_PAIR(0x8873, 0xB2AE)
+DOUBLE_BYTE_PAIR(0x8874, 0xB2AF)
+DOUBLE_BYTE_PAIR(0x8875, 0xB2B1)
+DOUBLE_BYTE_PAIR(0x8876, 0xB2B2)
+DOUBLE_BYTE_PAIR(0x8877, 0xB2B3)
+DOUBLE_BYTE_PAIR(0x8878, 0xB2B5)
+DOUBLE_BYTE_PAIR(0x8879, 0xB2B6)
+DOUBLE_BYTE_PAIR(0x887A, 0xB2B7)
+DOUBLE_BYTE_PAIR(0x8881, 0xB2B8)
+DOUBLE_BYTE_PAIR(0x8882, 0xB2B9)
+DOUBLE_BYTE_PAIR(0x8883, 0xB2BA)
+DOUBLE_BYTE_PAIR(0x8884, 0xB2BB)
+DOUBLE_BYTE_PAIR(0x8885, 0xB2BC)
+DOUBLE_BYTE_PAIR(0x8886, 0xB2BD)
+DOUBLE_BYTE_PAIR(0x8887, 0xB2BE)
+DOUBLE_BYTE_PAIR(0x8888, 0xB2BF)
+DOUBLE_BYTE_PAIR(0x8889, 0xB2C0)
+DOUBLE_BYTE_PAIR(0x888A, 0xB2C1)
+DOUBLE_BYTE_PAIR(0x888B, 0xB2C2)
+DOUBLE_BYTE_PAIR(0x888C, 0xB2C3)
+DOUBLE_BYTE_PAIR(0x888D, 0xB2C4)
+DOUBLE_BYTE_PAIR(0x888E, 0xB2C5)
+DOUBLE_BYTE_PAIR(0x888F, 0xB2C6)
+DOUBLE_BYTE_PAIR(0x8890, 0xB2C7)
+DOUBLE_BYTE_PAIR(0x8891, 0xB2CA)
+DOUBLE_BYTE_PAIR(0x8892, 0xB2CB)
+DOUBLE_BYTE_PAIR(0x8893, 0xB2CD)
+DOUBLE_BYTE_PAIR(0x8894, 0xB2CE)
+DOUBLE_BYTE_PAIR(0x8895, 0xB2CF)
+DOUBLE_BYTE_PAIR(0x8896, 0xB2D1)
+DOUBLE_BYTE_PAIR(0x8897, 0xB2D3)
+DOUBLE_BYTE_PAIR(0x8898, 0xB2D4)
+DOUBLE_BYTE_PAIR(0x8899, 0xB2D5)
+DOUBLE_BYTE_PAIR(0x889A, 0xB2D6)
+DOUBLE_BYTE_PAIR(0x889B, 0xB2D7)
+DOUBLE_BYTE_PAIR(0x889C, 0xB2DA)
+DOUBLE_BYTE_PAIR(0x889D, 0xB2DC)
+DOUBLE_BYTE_PAIR(0x889E, 0xB2DE)
+DOUBLE_BYTE_PAIR(0x889F, 0xB2DF)
+DOUBLE_BYTE_PAIR(0x88A0, 0xB2E0)
+DOUBLE_BYTE_PAIR(0x88A1, 0xB2E1)
+DOUBLE_BYTE_PAIR(0x88A2, 0xB2E3)
+DOUBLE_BYTE_PAIR(0x88A3, 0xB2E7)
+DOUBLE_BYTE_PAIR(0x88A4, 0xB2E9)
+DOUBLE_BYTE_PAIR(0x88A5, 0xB2EA)
+DOUBLE_BYTE_PAIR(0x88A6, 0xB2F0)
+DOUBLE_BYTE_PAIR(0x88A7, 0xB2F1)
+DOUBLE_BYTE_PAIR(0x88A8, 0xB2F2)
+DOUBLE_BYTE_PAIR(0x88A9, 0xB2F6)
+DOUBLE_BYTE_PAIR(0x88AA, 0xB2FC)
+DOUBLE_BYTE_PAIR(0x88AB, 0xB2FD)
+DOUBLE_BYTE_PAIR(0x88AC, 0xB2FE)
+DOUBLE_BYTE_PAIR(0x88AD, 0xB302)
+DOUBLE_BYTE_PAIR(0x88AE, 0xB303)
+DOUBLE_BYTE_PAIR(0x88AF, 0xB305)
+DOUBLE_BYTE_PAIR(0x88B0, 0xB306)
+DOUBLE_BYTE_PAIR(0x88B1, 0xB307)
+DOUBLE_BYTE_PAIR(0x88B2, 0xB309)
+DOUBLE_BYTE_PAIR(0x88B3, 0xB30A)
+DOUBLE_BYTE_PAIR(0x88B4, 0xB30B)
+DOUBLE_BYTE_PAIR(0x88B5, 0xB30C)
+DOUBLE_BYTE_PAIR(0x88B6, 0xB30D)
+DOUBLE_BYTE_PAIR(0x88B7, 0xB30E)
+DOUBLE_BYTE_PAIR(0x88B8, 0xB30F)
+DOUBLE_BYTE_PAIR(0x88B9, 0xB312)
+DOUBLE_BYTE_PAIR(0x88BA, 0xB316)
+DOUBLE_BYTE_PAIR(0x88BB, 0xB317)
+DOUBLE_BYTE_PAIR(0x88BC, 0xB318)
+DOUBLE_BYTE_PAIR(0x88BD, 0xB319)
+DOUBLE_BYTE_PAIR(0x88BE, 0xB31A)
+DOUBLE_BYTE_PAIR(0x88BF, 0xB31B)
+DOUBLE_BYTE_PAIR(0x88C0, 0xB31D)
+DOUBLE_BYTE_PAIR(0x88C1, 0xB31E)
+DOUBLE_BYTE_PAIR(0x88C2, 0xB31F)
+DOUBLE_BYTE_PAIR(0x88C3, 0xB320)
+DOUBLE_BYTE_PAIR(0x88C4, 0xB321)
+DOUBLE_BYTE_PAIR(0x88C5, 0xB322)
+DOUBLE_BYTE_PAIR(0x88C6, 0xB323)
+DOUBLE_BYTE_PAIR(0x88C7, 0xB324)
+DOUBLE_BYTE_PAIR(0x88C8, 0xB325)
+DOUBLE_BYTE_PAIR(0x88C9, 0xB326)
+DOUBLE_BYTE_PAIR(0x88CA, 0xB327)
+DOUBLE_BYTE_PAIR(0x88CB, 0xB328)
+DOUBLE_BYTE_PAIR(0x88CC, 0xB329)
+DOUBLE_BYTE_PAIR(0x88CD, 0xB32A)
+DOUBLE_BYTE_PAIR(0x88CE, 0xB32B)
+DOUBLE_BYTE_PAIR(0x88CF, 0xB32C)
+DOUBLE_BYTE_PAIR(0x88D0, 0xB32D)
+DOUBLE_BYTE_PAIR(0x88D1, 0xB32E)
+DOUBLE_BYTE_PAIR(0x88D2, 0xB32F)
+DOUBLE_BYTE_PAIR(0x88D3, 0xB330)
+DOUBLE_BYTE_PAIR(0x88D4, 0xB331)
+DOUBLE_BYTE_PAIR(0x88D5, 0xB332)
+DOUBLE_BYTE_PAIR(0x88D6, 0xB333)
+DOUBLE_BYTE_PAIR(0x88D7, 0xB334)
+DOUBLE_BYTE_PAIR(0x88D8, 0xB335)
+DOUBLE_BYTE_PAIR(0x88D9, 0xB336)
+DOUBLE_BYTE_PAIR(0x88DA, 0xB337)
+DOUBLE_BYTE_PAIR(0x88DB, 0xB338)
+DOUBLE_BYTE_PAIR(0x88DC, 0xB339)
+DOUBLE_BYTE_PAIR(0x88DD, 0xB33A)
+DOUBLE_BYTE_PAIR(0x88DE, 0xB33B)
+DOUBLE_BYTE_PAIR(0x88DF, 0xB33C)
+DOUBLE_BYTE_PAIR(0x88E0, 0xB33D)
+DOUBLE_BYTE_PAIR(0x88E1, 0xB33E)
+DOUBLE_BYTE_PAIR(0x88E2, 0xB33F)
+DOUBLE_BYTE_PAIR(0x88E3, 0xB340)
+DOUBLE_BYTE_PAIR(0x88E4, 0xB341)
+DOUBLE_BYTE_PAIR(0x88E5, 0xB342)
+DOUBLE_BYTE_PAIR(0x88E6, 0xB343)
+DOUBLE_BYTE_PAIR(0x88E7, 0xB344)
+DOUBLE_BYTE_PAIR(0x88E8, 0xB345)
+DOUBLE_BYTE_PAIR(0x88E9, 0xB346)
+DOUBLE_BYTE_PAIR(0x88EA, 0xB347)
+DOUBLE_BYTE_PAIR(0x88EB, 0xB348)
+DOUBLE_BYTE_PAIR(0x88EC, 0xB349)
+DOUBLE_BYTE_PAIR(0x88ED, 0xB34A)
+DOUBLE_BYTE_PAIR(0x88EE, 0xB34B)
+DOUBLE_BYTE_PAIR(0x88EF, 0xB34C)
+DOUBLE_BYTE_PAIR(0x88F0, 0xB34D)
+DOUBLE_BYTE_PAIR(0x88F1, 0xB34E)
+DOUBLE_BYTE_PAIR(0x88F2, 0xB34F)
+DOUBLE_BYTE_PAIR(0x88F3, 0xB350)
+DOUBLE_BYTE_PAIR(0x88F4, 0xB351)
+DOUBLE_BYTE_PAIR(0x88F5, 0xB352)
+DOUBLE_BYTE_PAIR(0x88F6, 0xB353)
+DOUBLE_BYTE_PAIR(0x88F7, 0xB357)
+DOUBLE_BYTE_PAIR(0x88F8, 0xB359)
+DOUBLE_BYTE_PAIR(0x88F9, 0xB35A)
+DOUBLE_BYTE_PAIR(0x88FA, 0xB35D)
+DOUBLE_BYTE_PAIR(0x88FB, 0xB360)
+DOUBLE_BYTE_PAIR(0x88FC, 0xB361)
+DOUBLE_BYTE_PAIR(0x88FD, 0xB362)
+DOUBLE_BYTE_PAIR(0x88FE, 0xB363)
+DOUBLE_BYTE_PAIR(0x8941, 0xB366)
+DOUBLE_BYTE_PAIR(0x8942, 0xB368)
+DOUBLE_BYTE_PAIR(0x8943, 0xB36A)
+DOUBLE_BYTE_PAIR(0x8944, 0xB36C)
+DOUBLE_BYTE_PAIR(0x8945, 0xB36D)
+DOUBLE_BYTE_PAIR(0x8946, 0xB36F)
+DOUBLE_BYTE_PAIR(0x8947, 0xB372)
+DOUBLE_BYTE_PAIR(0x8948, 0xB373)
+DOUBLE_BYTE_PAIR(0x8949, 0xB375)
+DOUBLE_BYTE_PAIR(0x894A, 0xB376)
+DOUBLE_BYTE_PAIR(0x894B, 0xB377)
+DOUBLE_BYTE_PAIR(0x894C, 0xB379)
+DOUBLE_BYTE_PAIR(0x894D, 0xB37A)
+DOUBLE_BYTE_PAIR(0x894E, 0xB37B)
+DOUBLE_BYTE_PAIR(0x894F, 0xB37C)
+DOUBLE_BYTE_PAIR(0x8950, 0xB37D)
+DOUBLE_BYTE_PAIR(0x8951, 0xB37E)
+DOUBLE_BYTE_PAIR(0x8952, 0xB37F)
+DOUBLE_BYTE_PAIR(0x8953, 0xB382)
+DOUBLE_BYTE_PAIR(0x8954, 0xB386)
+DOUBLE_BYTE_PAIR(0x8955, 0xB387)
+DOUBLE_BYTE_PAIR(0x8956, 0xB388)
+DOUBLE_BYTE_PAIR(0x8957, 0xB389)
+DOUBLE_BYTE_PAIR(0x8958, 0xB38A)
+DOUBLE_BYTE_PAIR(0x8959, 0xB38B)
+DOUBLE_BYTE_PAIR(0x895A, 0xB38D)
+DOUBLE_BYTE_PAIR(0x8961, 0xB38E)
+DOUBLE_BYTE_PAIR(0x8962, 0xB38F)
+DOUBLE_BYTE_PAIR(0x8963, 0xB391)
+DOUBLE_BYTE_PAIR(0x8964, 0xB392)
+DOUBLE_BYTE_PAIR(0x8965, 0xB393)
+DOUBLE_BYTE_PAIR(0x8966, 0xB395)
+DOUBLE_BYTE_PAIR(0x8967, 0xB396)
+DOUBLE_BYTE_PAIR(0x8968, 0xB397)
+DOUBLE_BYTE_PAIR(0x8969, 0xB398)
+DOUBLE_BYTE_PAIR(0x896A, 0xB399)
+DOUBLE_BYTE_PAIR(0x896B, 0xB39A)
+DOUBLE_BYTE_PAIR(0x896C, 0xB39B)
+DOUBLE_BYTE_PAIR(0x896D, 0xB39C)
+DOUBLE_BYTE_PAIR(0x896E, 0xB39D)
+DOUBLE_BYTE_PAIR(0x896F, 0xB39E)
+DOUBLE_BYTE_PAIR(0x8970, 0xB39F)
+DOUBLE_BYTE_PAIR(0x8971, 0xB3A2)
+DOUBLE_BYTE_PAIR(0x8972, 0xB3A3)
+DOUBLE_BYTE_PAIR(0x8973, 0xB3A4)
+DOUBLE_BYTE_PAIR(0x8974, 0xB3A5)
+DOUBLE_BYTE_PAIR(0x8975, 0xB3A6)
+DOUBLE_BYTE_PAIR(0x8976, 0xB3A7)
+DOUBLE_BYTE_PAIR(0x8977, 0xB3A9)
+DOUBLE_BYTE_PAIR(0x8978, 0xB3AA)
+DOUBLE_BYTE_PAIR(0x8979, 0xB3AB)
+DOUBLE_BYTE_PAIR(0x897A, 0xB3AD)
+DOUBLE_BYTE_PAIR(0x8981, 0xB3AE)
+DOUBLE_BYTE_PAIR(0x8982, 0xB3AF)
+DOUBLE_BYTE_PAIR(0x8983, 0xB3B0)
+DOUBLE_BYTE_PAIR(0x8984, 0xB3B1)
+DOUBLE_BYTE_PAIR(0x8985, 0xB3B2)
+DOUBLE_BYTE_PAIR(0x8986, 0xB3B3)
+DOUBLE_BYTE_PAIR(0x8987, 0xB3B4)
+DOUBLE_BYTE_PAIR(0x8988, 0xB3B5)
+DOUBLE_BYTE_PAIR(0x8989, 0xB3B6)
+DOUBLE_BYTE_PAIR(0x898A, 0xB3B7)
+DOUBLE_BYTE_PAIR(0x898B, 0xB3B8)
+DOUBLE_BYTE_PAIR(0x898C, 0xB3B9)
+DOUBLE_BYTE_PAIR(0x898D, 0xB3BA)
+DOUBLE_BYTE_PAIR(0x898E, 0xB3BB)
+DOUBLE_BYTE_PAIR(0x898F, 0xB3BC)
+DOUBLE_BYTE_PAIR(0x8990, 0xB3BD)
+DOUBLE_BYTE_PAIR(0x8991, 0xB3BE)
+DOUBLE_BYTE_PAIR(0x8992, 0xB3BF)
+DOUBLE_BYTE_PAIR(0x8993, 0xB3C0)
+DOUBLE_BYTE_PAIR(0x8994, 0xB3C1)
+DOUBLE_BYTE_PAIR(0x8995, 0xB3C2)
+DOUBLE_BYTE_PAIR(0x8996, 0xB3C3)
+DOUBLE_BYTE_PAIR(0x8997, 0xB3C6)
+DOUBLE_BYTE_PAIR(0x8998, 0xB3C7)
+DOUBLE_BYTE_PAIR(0x8999, 0xB3C9)
+DOUBLE_BYTE_PAIR(0x899A, 0xB3CA)
+DOUBLE_BYTE_PAIR(0x899B, 0xB3CD)
+DOUBLE_BYTE_PAIR(0x899C, 0xB3CF)
+DOUBLE_BYTE_PAIR(0x899D, 0xB3D1)
+DOUBLE_BYTE_PAIR(0x899E, 0xB3D2)
+DOUBLE_BYTE_PAIR(0x899F, 0xB3D3)
+DOUBLE_BYTE_PAIR(0x89A0, 0xB3D6)
+DOUBLE_BYTE_PAIR(0x89A1, 0xB3D8)
+DOUBLE_BYTE_PAIR(0x89A2, 0xB3DA)
+DOUBLE_BYTE_PAIR(0x89A3, 0xB3DC)
+DOUBLE_BYTE_PAIR(0x89A4, 0xB3DE)
+DOUBLE_BYTE_PAIR(0x89A5, 0xB3DF)
+DOUBLE_BYTE_PAIR(0x89A6, 0xB3E1)
+DOUBLE_BYTE_PAIR(0x89A7, 0xB3E2)
+DOUBLE_BYTE_PAIR(0x89A8, 0xB3E3)
+DOUBLE_BYTE_PAIR(0x89A9, 0xB3E5)
+DOUBLE_BYTE_PAIR(0x89AA, 0xB3E6)
+DOUBLE_BYTE_PAIR(0x89AB, 0xB3E7)
+DOUBLE_BYTE_PAIR(0x89AC, 0xB3E9)
+DOUBLE_BYTE_PAIR(0x89AD, 0xB3EA)
+DOUBLE_BYTE_PAIR(0x89AE, 0xB3EB)
+DOUBLE_BYTE_PAIR(0x89AF, 0xB3EC)
+DOUBLE_BYTE_PAIR(0x89B0, 0xB3ED)
+DOUBLE_BYTE_PAIR(0x89B1, 0xB3EE)
+DOUBLE_BYTE_PAIR(0x89B2, 0xB3EF)
+DOUBLE_BYTE_PAIR(0x89B3, 0xB3F0)
+DOUBLE_BYTE_PAIR(0x89B4, 0xB3F1)
+DOUBLE_BYTE_PAIR(0x89B5, 0xB3F2)
+DOUBLE_BYTE_PAIR(0x89B6, 0xB3F3)
+DOUBLE_BYTE_PAIR(0x89B7, 0xB3F4)
+DOUBLE_BYTE_PAIR(0x89B8, 0xB3F5)
+DOUBLE_BYTE_PAIR(0x89B9, 0xB3F6)
+DOUBLE_BYTE_PAIR(0x89BA, 0xB3F7)
+DOUBLE_BYTE_PAIR(0x89BB, 0xB3F8)
+DOUBLE_BYTE_PAIR(0x89BC, 0xB3F9)
+DOUBLE_BYTE_PAIR(0x89BD, 0xB3FA)
+DOUBLE_BYTE_PAIR(0x89BE, 0xB3FB)
+DOUBLE_BYTE_PAIR(0x89BF, 0xB3FD)
+DOUBLE_BYTE_PAIR(0x89C0, 0xB3FE)
+DOUBLE_BYTE_PAIR(0x89C1, 0xB3FF)
+DOUBLE_BYTE_PAIR(0x89C2, 0xB400)
+DOUBLE_BYTE_PAIR(0x89C3, 0xB401)
+DOUBLE_BYTE_PAIR(0x89C4, 0xB402)
+DOUBLE_BYTE_PAIR(0x89C5, 0xB403)
+DOUBLE_BYTE_PAIR(0x89C6, 0xB404)
+DOUBLE_BYTE_PAIR(0x89C7, 0xB405)
+DOUBLE_BYTE_PAIR(0x89C8, 0xB406)
+DOUBLE_BYTE_PAIR(0x89C9, 0xB407)
+DOUBLE_BYTE_PAIR(0x89CA, 0xB408)
+DOUBLE_BYTE_PAIR(0x89CB, 0xB409)
+DOUBLE_BYTE_PAIR(0x89CC, 0xB40A)
+DOUBLE_BYTE_PAIR(0x89CD, 0xB40B)
+DOUBLE_BYTE_PAIR(0x89CE, 0xB40C)
+DOUBLE_BYTE_PAIR(0x89CF, 0xB40D)
+DOUBLE_BYTE_PAIR(0x89D0, 0xB40E)
+DOUBLE_BYTE_PAIR(0x89D1, 0xB40F)
+DOUBLE_BYTE_PAIR(0x89D2, 0xB411)
+DOUBLE_BYTE_PAIR(0x89D3, 0xB412)
+DOUBLE_BYTE_PAIR(0x89D4, 0xB413)
+DOUBLE_BYTE_PAIR(0x89D5, 0xB414)
+DOUBLE_BYTE_PAIR(0x89D6, 0xB415)
+DOUBLE_BYTE_PAIR(0x89D7, 0xB416)
+DOUBLE_BYTE_PAIR(0x89D8, 0xB417)
+DOUBLE_BYTE_PAIR(0x89D9, 0xB419)
+DOUBLE_BYTE_PAIR(0x89DA, 0xB41A)
+DOUBLE_BYTE_PAIR(0x89DB, 0xB41B)
+DOUBLE_BYTE_PAIR(0x89DC, 0xB41D)
+DOUBLE_BYTE_PAIR(0x89DD, 0xB41E)
+DOUBLE_BYTE_PAIR(0x89DE, 0xB41F)
+DOUBLE_BYTE_PAIR(0x89DF, 0xB421)
+DOUBLE_BYTE_PAIR(0x89E0, 0xB422)
+DOUBLE_BYTE_PAIR(0x89E1, 0xB423)
+DOUBLE_BYTE_PAIR(0x89E2, 0xB424)
+DOUBLE_BYTE_PAIR(0x89E3, 0xB425)
+DOUBLE_BYTE_PAIR(0x89E4, 0xB426)
+DOUBLE_BYTE_PAIR(0x89E5, 0xB427)
+DOUBLE_BYTE_PAIR(0x89E6, 0xB42A)
+DOUBLE_BYTE_PAIR(0x89E7, 0xB42C)
+DOUBLE_BYTE_PAIR(0x89E8, 0xB42D)
+DOUBLE_BYTE_PAIR(0x89E9, 0xB42E)
+DOUBLE_BYTE_PAIR(0x89EA, 0xB42F)
+DOUBLE_BYTE_PAIR(0x89EB, 0xB430)
+DOUBLE_BYTE_PAIR(0x89EC, 0xB431)
+DOUBLE_BYTE_PAIR(0x89ED, 0xB432)
+DOUBLE_BYTE_PAIR(0x89EE, 0xB433)
+DOUBLE_BYTE_PAIR(0x89EF, 0xB435)
+DOUBLE_BYTE_PAIR(0x89F0, 0xB436)
+DOUBLE_BYTE_PAIR(0x89F1, 0xB437)
+DOUBLE_BYTE_PAIR(0x89F2, 0xB438)
+DOUBLE_BYTE_PAIR(0x89F3, 0xB439)
+DOUBLE_BYTE_PAIR(0x89F4, 0xB43A)
+DOUBLE_BYTE_PAIR(0x89F5, 0xB43B)
+DOUBLE_BYTE_PAIR(0x89F6, 0xB43C)
+DOUBLE_BYTE_PAIR(0x89F7, 0xB43D)
+DOUBLE_BYTE_PAIR(0x89F8, 0xB43E)
+DOUBLE_BYTE_PAIR(0x89F9, 0xB43F)
+DOUBLE_BYTE_PAIR(0x89FA, 0xB440)
+DOUBLE_BYTE_PAIR(0x89FB, 0xB441)
+DOUBLE_BYTE_PAIR(0x89FC, 0xB442)
+DOUBLE_BYTE_PAIR(0x89FD, 0xB443)
+DOUBLE_BYTE_PAIR(0x89FE, 0xB444)
+DOUBLE_BYTE_PAIR(0x8A41, 0xB445)
+DOUBLE_BYTE_PAIR(0x8A42, 0xB446)
+DOUBLE_BYTE_PAIR(0x8A43, 0xB447)
+DOUBLE_BYTE_PAIR(0x8A44, 0xB448)
+DOUBLE_BYTE_PAIR(0x8A45, 0xB449)
+DOUBLE_BYTE_PAIR(0x8A46, 0xB44A)
+DOUBLE_BYTE_PAIR(0x8A47, 0xB44B)
+DOUBLE_BYTE_PAIR(0x8A48, 0xB44C)
+DOUBLE_BYTE_PAIR(0x8A49, 0xB44D)
+DOUBLE_BYTE_PAIR(0x8A4A, 0xB44E)
+DOUBLE_BYTE_PAIR(0x8A4B, 0xB44F)
+DOUBLE_BYTE_PAIR(0x8A4C, 0xB452)
+DOUBLE_BYTE_PAIR(0x8A4D, 0xB453)
+DOUBLE_BYTE_PAIR(0x8A4E, 0xB455)
+DOUBLE_BYTE_PAIR(0x8A4F, 0xB456)
+DOUBLE_BYTE_PAIR(0x8A50, 0xB457)
+DOUBLE_BYTE_PAIR(0x8A51, 0xB459)
+DOUBLE_BYTE_PAIR(0x8A52, 0xB45A)
+DOUBLE_BYTE_PAIR(0x8A53, 0xB45B)
+DOUBLE_BYTE_PAIR(0x8A54, 0xB45C)
+DOUBLE_BYTE_PAIR(0x8A55, 0xB45D)
+DOUBLE_BYTE_PAIR(0x8A56, 0xB45E)
+DOUBLE_BYTE_PAIR(0x8A57, 0xB45F)
+DOUBLE_BYTE_PAIR(0x8A58, 0xB462)
+DOUBLE_BYTE_PAIR(0x8A59, 0xB464)
+DOUBLE_BYTE_PAIR(0x8A5A, 0xB466)
+DOUBLE_BYTE_PAIR(0x8A61, 0xB467)
+DOUBLE_BYTE_PAIR(0x8A62, 0xB468)
+DOUBLE_BYTE_PAIR(0x8A63, 0xB469)
+DOUBLE_BYTE_PAIR(0x8A64, 0xB46A)
+DOUBLE_BYTE_PAIR(0x8A65, 0xB46B)
+DOUBLE_BYTE_PAIR(0x8A66, 0xB46D)
+DOUBLE_BYTE_PAIR(0x8A67, 0xB46E)
+DOUBLE_BYTE_PAIR(0x8A68, 0xB46F)
+DOUBLE_BYTE_PAIR(0x8A69, 0xB470)
+DOUBLE_BYTE_PAIR(0x8A6A, 0xB471)
+DOUBLE_BYTE_PAIR(0x8A6B, 0xB472)
+DOUBLE_BYTE_PAIR(0x8A6C, 0xB473)
+DOUBLE_BYTE_PAIR(0x8A6D, 0xB474)
+DOUBLE_BYTE_PAIR(0x8A6E, 0xB475)
+DOUBLE_BYTE_PAIR(0x8A6F, 0xB476)
+DOUBLE_BYTE_PAIR(0x8A70, 0xB477)
+DOUBLE_BYTE_PAIR(0x8A71, 0xB478)
+DOUBLE_BYTE_PAIR(0x8A72, 0xB479)
+DOUBLE_BYTE_PAIR(0x8A73, 0xB47A)
+DOUBLE_BYTE_PAIR(0x8A74, 0xB47B)
+DOUBLE_BYTE_PAIR(0x8A75, 0xB47C)
+DOUBLE_BYTE_PAIR(0x8A76, 0xB47D)
+DOUBLE_BYTE_PAIR(0x8A77, 0xB47E)
+DOUBLE_BYTE_PAIR(0x8A78, 0xB47F)
+DOUBLE_BYTE_PAIR(0x8A79, 0xB481)
+DOUBLE_BYTE_PAIR(0x8A7A, 0xB482)
+DOUBLE_BYTE_PAIR(0x8A81, 0xB483)
+DOUBLE_BYTE_PAIR(0x8A82, 0xB484)
+DOUBLE_BYTE_PAIR(0x8A83, 0xB485)
+DOUBLE_BYTE_PAIR(0x8A84, 0xB486)
+DOUBLE_BYTE_PAIR(0x8A85, 0xB487)
+DOUBLE_BYTE_PAIR(0x8A86, 0xB489)
+DOUBLE_BYTE_PAIR(0x8A87, 0xB48A)
+DOUBLE_BYTE_PAIR(0x8A88, 0xB48B)
+DOUBLE_BYTE_PAIR(0x8A89, 0xB48C)
+DOUBLE_BYTE_PAIR(0x8A8A, 0xB48D)
+DOUBLE_BYTE_PAIR(0x8A8B, 0xB48E)
+DOUBLE_BYTE_PAIR(0x8A8C, 0xB48F)
+DOUBLE_BYTE_PAIR(0x8A8D, 0xB490)
+DOUBLE_BYTE_PAIR(0x8A8E, 0xB491)
+DOUBLE_BYTE_PAIR(0x8A8F, 0xB492)
+DOUBLE_BYTE_PAIR(0x8A90, 0xB493)
+DOUBLE_BYTE_PAIR(0x8A91, 0xB494)
+DOUBLE_BYTE_PAIR(0x8A92, 0xB495)
+DOUBLE_BYTE_PAIR(0x8A93, 0xB496)
+DOUBLE_BYTE_PAIR(0x8A94, 0xB497)
+DOUBLE_BYTE_PAIR(0x8A95, 0xB498)
+DOUBLE_BYTE_PAIR(0x8A96, 0xB499)
+DOUBLE_BYTE_PAIR(0x8A97, 0xB49A)
+DOUBLE_BYTE_PAIR(0x8A98, 0xB49B)
+DOUBLE_BYTE_PAIR(0x8A99, 0xB49C)
+DOUBLE_BYTE_PAIR(0x8A9A, 0xB49E)
+DOUBLE_BYTE_PAIR(0x8A9B, 0xB49F)
+DOUBLE_BYTE_PAIR(0x8A9C, 0xB4A0)
+DOUBLE_BYTE_PAIR(0x8A9D, 0xB4A1)
+DOUBLE_BYTE_PAIR(0x8A9E, 0xB4A2)
+DOUBLE_BYTE_PAIR(0x8A9F, 0xB4A3)
+DOUBLE_BYTE_PAIR(0x8AA0, 0xB4A5)
+DOUBLE_BYTE_PAIR(0x8AA1, 0xB4A6)
+DOUBLE_BYTE_PAIR(0x8AA2, 0xB4A7)
+DOUBLE_BYTE_PAIR(0x8AA3, 0xB4A9)
+DOUBLE_BYTE_PAIR(0x8AA4, 0xB4AA)
+DOUBLE_BYTE_PAIR(0x8AA5, 0xB4AB)
+DOUBLE_BYTE_PAIR(0x8AA6, 0xB4AD)
+DOUBLE_BYTE_PAIR(0x8AA7, 0xB4AE)
+DOUBLE_BYTE_PAIR(0x8AA8, 0xB4AF)
+DOUBLE_BYTE_PAIR(0x8AA9, 0xB4B0)
+DOUBLE_BYTE_PAIR(0x8AAA, 0xB4B1)
+DOUBLE_BYTE_PAIR(0x8AAB, 0xB4B2)
+DOUBLE_BYTE_PAIR(0x8AAC, 0xB4B3)
+DOUBLE_BYTE_PAIR(0x8AAD, 0xB4B4)
+DOUBLE_BYTE_PAIR(0x8AAE, 0xB4B6)
+DOUBLE_BYTE_PAIR(0x8AAF, 0xB4B8)
+DOUBLE_BYTE_PAIR(0x8AB0, 0xB4BA)
+DOUBLE_BYTE_PAIR(0x8AB1, 0xB4BB)
+DOUBLE_BYTE_PAIR(0x8AB2, 0xB4BC)
+DOUBLE_BYTE_PAIR(0x8AB3, 0xB4BD)
+DOUBLE_BYTE_PAIR(0x8AB4, 0xB4BE)
+DOUBLE_BYTE_PAIR(0x8AB5, 0xB4BF)
+DOUBLE_BYTE_PAIR(0x8AB6, 0xB4C1)
+DOUBLE_BYTE_PAIR(0x8AB7, 0xB4C2)
+DOUBLE_BYTE_PAIR(0x8AB8, 0xB4C3)
+DOUBLE_BYTE_PAIR(0x8AB9, 0xB4C5)
+DOUBLE_BYTE_PAIR(0x8ABA, 0xB4C6)
+DOUBLE_BYTE_PAIR(0x8ABB, 0xB4C7)
+DOUBLE_BYTE_PAIR(0x8ABC, 0xB4C9)
+DOUBLE_BYTE_PAIR(0x8ABD, 0xB4CA)
+DOUBLE_BYTE_PAIR(0x8ABE, 0xB4CB)
+DOUBLE_BYTE_PAIR(0x8ABF, 0xB4CC)
+DOUBLE_BYTE_PAIR(0x8AC0, 0xB4CD)
+DOUBLE_BYTE_PAIR(0x8AC1, 0xB4CE)
+DOUBLE_BYTE_PAIR(0x8AC2, 0xB4CF)
+DOUBLE_BYTE_PAIR(0x8AC3, 0xB4D1)
+DOUBLE_BYTE_PAIR(0x8AC4, 0xB4D2)
+DOUBLE_BYTE_PAIR(0x8AC5, 0xB4D3)
+DOUBLE_BYTE_PAIR(0x8AC6, 0xB4D4)
+DOUBLE_BYTE_PAIR(0x8AC7, 0xB4D6)
+DOUBLE_BYTE_PAIR(0x8AC8, 0xB4D7)
+DOUBLE_BYTE_PAIR(0x8AC9, 0xB4D8)
+DOUBLE_BYTE_PAIR(0x8ACA, 0xB4D9)
+DOUBLE_BYTE_PAIR(0x8ACB, 0xB4DA)
+DOUBLE_BYTE_PAIR(0x8ACC, 0xB4DB)
+DOUBLE_BYTE_PAIR(0x8ACD, 0xB4DE)
+DOUBLE_BYTE_PAIR(0x8ACE, 0xB4DF)
+DOUBLE_BYTE_PAIR(0x8ACF, 0xB4E1)
+DOUBLE_BYTE_PAIR(0x8AD0, 0xB4E2)
+DOUBLE_BYTE_PAIR(0x8AD1, 0xB4E5)
+DOUBLE_BYTE_PAIR(0x8AD2, 0xB4E7)
+DOUBLE_BYTE_PAIR(0x8AD3, 0xB4E8)
+DOUBLE_BYTE_PAIR(0x8AD4, 0xB4E9)
+DOUBLE_BYTE_PAIR(0x8AD5, 0xB4EA)
+DOUBLE_BYTE_PAIR(0x8AD6, 0xB4EB)
+DOUBLE_BYTE_PAIR(0x8AD7, 0xB4EE)
+DOUBLE_BYTE_PAIR(0x8AD8, 0xB4F0)
+DOUBLE_BYTE_PAIR(0x8AD9, 0xB4F2)
+DOUBLE_BYTE_PAIR(0x8ADA, 0xB4F3)
+DOUBLE_BYTE_PAIR(0x8ADB, 0xB4F4)
+DOUBLE_BYTE_PAIR(0x8ADC, 0xB4F5)
+DOUBLE_BYTE_PAIR(0x8ADD, 0xB4F6)
+DOUBLE_BYTE_PAIR(0x8ADE, 0xB4F7)
+DOUBLE_BYTE_PAIR(0x8ADF, 0xB4F9)
+DOUBLE_BYTE_PAIR(0x8AE0, 0xB4FA)
+DOUBLE_BYTE_PAIR(0x8AE1, 0xB4FB)
+DOUBLE_BYTE_PAIR(0x8AE2, 0xB4FC)
+DOUBLE_BYTE_PAIR(0x8AE3, 0xB4FD)
+DOUBLE_BYTE_PAIR(0x8AE4, 0xB4FE)
+DOUBLE_BYTE_PAIR(0x8AE5, 0xB4FF)
+DOUBLE_BYTE_PAIR(0x8AE6, 0xB500)
+DOUBLE_BYTE_PAIR(0x8AE7, 0xB501)
+DOUBLE_BYTE_PAIR(0x8AE8, 0xB502)
+DOUBLE_BYTE_PAIR(0x8AE9, 0xB503)
+DOUBLE_BYTE_PAIR(0x8AEA, 0xB504)
+DOUBLE_BYTE_PAIR(0x8AEB, 0xB505)
+DOUBLE_BYTE_PAIR(0x8AEC, 0xB506)
+DOUBLE_BYTE_PAIR(0x8AED, 0xB507)
+DOUBLE_BYTE_PAIR(0x8AEE, 0xB508)
+DOUBLE_BYTE_PAIR(0x8AEF, 0xB509)
+DOUBLE_BYTE_PAIR(0x8AF0, 0xB50A)
+DOUBLE_BYTE_PAIR(0x8AF1, 0xB50B)
+DOUBLE_BYTE_PAIR(0x8AF2, 0xB50C)
+DOUBLE_BYTE_PAIR(0x8AF3, 0xB50D)
+DOUBLE_BYTE_PAIR(0x8AF4, 0xB50E)
+DOUBLE_BYTE_PAIR(0x8AF5, 0xB50F)
+DOUBLE_BYTE_PAIR(0x8AF6, 0xB510)
+DOUBLE_BYTE_PAIR(0x8AF7, 0xB511)
+DOUBLE_BYTE_PAIR(0x8AF8, 0xB512)
+DOUBLE_BYTE_PAIR(0x8AF9, 0xB513)
+DOUBLE_BYTE_PAIR(0x8AFA, 0xB516)
+DOUBLE_BYTE_PAIR(0x8AFB, 0xB517)
+DOUBLE_BYTE_PAIR(0x8AFC, 0xB519)
+DOUBLE_BYTE_PAIR(0x8AFD, 0xB51A)
+DOUBLE_BYTE_PAIR(0x8AFE, 0xB51D)
+DOUBLE_BYTE_PAIR(0x8B41, 0xB51E)
+DOUBLE_BYTE_PAIR(0x8B42, 0xB51F)
+DOUBLE_BYTE_PAIR(0x8B43, 0xB520)
+DOUBLE_BYTE_PAIR(0x8B44, 0xB521)
+DOUBLE_BYTE_PAIR(0x8B45, 0xB522)
+DOUBLE_BYTE_PAIR(0x8B46, 0xB523)
+DOUBLE_BYTE_PAIR(0x8B47, 0xB526)
+DOUBLE_BYTE_PAIR(0x8B48, 0xB52B)
+DOUBLE_BYTE_PAIR(0x8B49, 0xB52C)
+DOUBLE_BYTE_PAIR(0x8B4A, 0xB52D)
+DOUBLE_BYTE_PAIR(0x8B4B, 0xB52E)
+DOUBLE_BYTE_PAIR(0x8B4C, 0xB52F)
+DOUBLE_BYTE_PAIR(0x8B4D, 0xB532)
+DOUBLE_BYTE_PAIR(0x8B4E, 0xB533)
+DOUBLE_BYTE_PAIR(0x8B4F, 0xB535)
+DOUBLE_BYTE_PAIR(0x8B50, 0xB536)
+DOUBLE_BYTE_PAIR(0x8B51, 0xB537)
+DOUBLE_BYTE_PAIR(0x8B52, 0xB539)
+DOUBLE_BYTE_PAIR(0x8B53, 0xB53A)
+DOUBLE_BYTE_PAIR(0x8B54, 0xB53B)
+DOUBLE_BYTE_PAIR(0x8B55, 0xB53C)
+DOUBLE_BYTE_PAIR(0x8B56, 0xB53D)
+DOUBLE_BYTE_PAIR(0x8B57, 0xB53E)
+DOUBLE_BYTE_PAIR(0x8B58, 0xB53F)
+DOUBLE_BYTE_PAIR(0x8B59, 0xB542)
+DOUBLE_BYTE_PAIR(0x8B5A, 0xB546)
+DOUBLE_BYTE_PAIR(0x8B61, 0xB547)
+DOUBLE_BYTE_PAIR(0x8B62, 0xB548)
+DOUBLE_BYTE_PAIR(0x8B63, 0xB549)
+DOUBLE_BYTE_PAIR(0x8B64, 0xB54A)
+DOUBLE_BYTE_PAIR(0x8B65, 0xB54E)
+DOUBLE_BYTE_PAIR(0x8B66, 0xB54F)
+DOUBLE_BYTE_PAIR(0x8B67, 0xB551)
+DOUBLE_BYTE_PAIR(0x8B68, 0xB552)
+DOUBLE_BYTE_PAIR(0x8B69, 0xB553)
+DOUBLE_BYTE_PAIR(0x8B6A, 0xB555)
+DOUBLE_BYTE_PAIR(0x8B6B, 0xB556)
+DOUBLE_BYTE_PAIR(0x8B6C, 0xB557)
+DOUBLE_BYTE_PAIR(0x8B6D, 0xB558)
+DOUBLE_BYTE_PAIR(0x8B6E, 0xB559)
+DOUBLE_BYTE_PAIR(0x8B6F, 0xB55A)
+DOUBLE_BYTE_PAIR(0x8B70, 0xB55B)
+DOUBLE_BYTE_PAIR(0x8B71, 0xB55E)
+DOUBLE_BYTE_PAIR(0x8B72, 0xB562)
+DOUBLE_BYTE_PAIR(0x8B73, 0xB563)
+DOUBLE_BYTE_PAIR(0x8B74, 0xB564)
+DOUBLE_BYTE_PAIR(0x8B75, 0xB565)
+DOUBLE_BYTE_PAIR(0x8B76, 0xB566)
+DOUBLE_BYTE_PAIR(0x8B77, 0xB567)
+DOUBLE_BYTE_PAIR(0x8B78, 0xB568)
+DOUBLE_BYTE_PAIR(0x8B79, 0xB569)
+DOUBLE_BYTE_PAIR(0x8B7A, 0xB56A)
+DOUBLE_BYTE_PAIR(0x8B81, 0xB56B)
+DOUBLE_BYTE_PAIR(0x8B82, 0xB56C)
+DOUBLE_BYTE_PAIR(0x8B83, 0xB56D)
+DOUBLE_BYTE_PAIR(0x8B84, 0xB56E)
+DOUBLE_BYTE_PAIR(0x8B85, 0xB56F)
+DOUBLE_BYTE_PAIR(0x8B86, 0xB570)
+DOUBLE_BYTE_PAIR(0x8B87, 0xB571)
+DOUBLE_BYTE_PAIR(0x8B88, 0xB572)
+DOUBLE_BYTE_PAIR(0x8B89, 0xB573)
+DOUBLE_BYTE_PAIR(0x8B8A, 0xB574)
+DOUBLE_BYTE_PAIR(0x8B8B, 0xB575)
+DOUBLE_BYTE_PAIR(0x8B8C, 0xB576)
+DOUBLE_BYTE_PAIR(0x8B8D, 0xB577)
+DOUBLE_BYTE_PAIR(0x8B8E, 0xB578)
+DOUBLE_BYTE_PAIR(0x8B8F, 0xB579)
+DOUBLE_BYTE_PAIR(0x8B90, 0xB57A)
+DOUBLE_BYTE_PAIR(0x8B91, 0xB57B)
+DOUBLE_BYTE_PAIR(0x8B92, 0xB57C)
+DOUBLE_BYTE_PAIR(0x8B93, 0xB57D)
+DOUBLE_BYTE_PAIR(0x8B94, 0xB57E)
+DOUBLE_BYTE_PAIR(0x8B95, 0xB57F)
+DOUBLE_BYTE_PAIR(0x8B96, 0xB580)
+DOUBLE_BYTE_PAIR(0x8B97, 0xB581)
+DOUBLE_BYTE_PAIR(0x8B98, 0xB582)
+DOUBLE_BYTE_PAIR(0x8B99, 0xB583)
+DOUBLE_BYTE_PAIR(0x8B9A, 0xB584)
+DOUBLE_BYTE_PAIR(0x8B9B, 0xB585)
+DOUBLE_BYTE_PAIR(0x8B9C, 0xB586)
+DOUBLE_BYTE_PAIR(0x8B9D, 0xB587)
+DOUBLE_BYTE_PAIR(0x8B9E, 0xB588)
+DOUBLE_BYTE_PAIR(0x8B9F, 0xB589)
+DOUBLE_BYTE_PAIR(0x8BA0, 0xB58A)
+DOUBLE_BYTE_PAIR(0x8BA1, 0xB58B)
+DOUBLE_BYTE_PAIR(0x8BA2, 0xB58C)
+DOUBLE_BYTE_PAIR(0x8BA3, 0xB58D)
+DOUBLE_BYTE_PAIR(0x8BA4, 0xB58E)
+DOUBLE_BYTE_PAIR(0x8BA5, 0xB58F)
+DOUBLE_BYTE_PAIR(0x8BA6, 0xB590)
+DOUBLE_BYTE_PAIR(0x8BA7, 0xB591)
+DOUBLE_BYTE_PAIR(0x8BA8, 0xB592)
+DOUBLE_BYTE_PAIR(0x8BA9, 0xB593)
+DOUBLE_BYTE_PAIR(0x8BAA, 0xB594)
+DOUBLE_BYTE_PAIR(0x8BAB, 0xB595)
+DOUBLE_BYTE_PAIR(0x8BAC, 0xB596)
+DOUBLE_BYTE_PAIR(0x8BAD, 0xB597)
+DOUBLE_BYTE_PAIR(0x8BAE, 0xB598)
+DOUBLE_BYTE_PAIR(0x8BAF, 0xB599)
+DOUBLE_BYTE_PAIR(0x8BB0, 0xB59A)
+DOUBLE_BYTE_PAIR(0x8BB1, 0xB59B)
+DOUBLE_BYTE_PAIR(0x8BB2, 0xB59C)
+DOUBLE_BYTE_PAIR(0x8BB3, 0xB59D)
+DOUBLE_BYTE_PAIR(0x8BB4, 0xB59E)
+DOUBLE_BYTE_PAIR(0x8BB5, 0xB59F)
+DOUBLE_BYTE_PAIR(0x8BB6, 0xB5A2)
+DOUBLE_BYTE_PAIR(0x8BB7, 0xB5A3)
+DOUBLE_BYTE_PAIR(0x8BB8, 0xB5A5)
+DOUBLE_BYTE_PAIR(0x8BB9, 0xB5A6)
+DOUBLE_BYTE_PAIR(0x8BBA, 0xB5A7)
+DOUBLE_BYTE_PAIR(0x8BBB, 0xB5A9)
+DOUBLE_BYTE_PAIR(0x8BBC, 0xB5AC)
+DOUBLE_BYTE_PAIR(0x8BBD, 0xB5AD)
+DOUBLE_BYTE_PAIR(0x8BBE, 0xB5AE)
+DOUBLE_BYTE_PAIR(0x8BBF, 0xB5AF)
+DOUBLE_BYTE_PAIR(0x8BC0, 0xB5B2)
+DOUBLE_BYTE_PAIR(0x8BC1, 0xB5B6)
+DOUBLE_BYTE_PAIR(0x8BC2, 0xB5B7)
+DOUBLE_BYTE_PAIR(0x8BC3, 0xB5B8)
+DOUBLE_BYTE_PAIR(0x8BC4, 0xB5B9)
+DOUBLE_BYTE_PAIR(0x8BC5, 0xB5BA)
+DOUBLE_BYTE_PAIR(0x8BC6, 0xB5BE)
+DOUBLE_BYTE_PAIR(0x8BC7, 0xB5BF)
+DOUBLE_BYTE_PAIR(0x8BC8, 0xB5C1)
+DOUBLE_BYTE_PAIR(0x8BC9, 0xB5C2)
+DOUBLE_BYTE_PAIR(0x8BCA, 0xB5C3)
+DOUBLE_BYTE_PAIR(0x8BCB, 0xB5C5)
+DOUBLE_BYTE_PAIR(0x8BCC, 0xB5C6)
+DOUBLE_BYTE_PAIR(0x8BCD, 0xB5C7)
+DOUBLE_BYTE_PAIR(0x8BCE, 0xB5C8)
+DOUBLE_BYTE_PAIR(0x8BCF, 0xB5C9)
+DOUBLE_BYTE_PAIR(0x8BD0, 0xB5CA)
+DOUBLE_BYTE_PAIR(0x8BD1, 0xB5CB)
+DOUBLE_BYTE_PAIR(0x8BD2, 0xB5CE)
+DOUBLE_BYTE_PAIR(0x8BD3, 0xB5D2)
+DOUBLE_BYTE_PAIR(0x8BD4, 0xB5D3)
+DOUBLE_BYTE_PAIR(0x8BD5, 0xB5D4)
+DOUBLE_BYTE_PAIR(0x8BD6, 0xB5D5)
+DOUBLE_BYTE_PAIR(0x8BD7, 0xB5D6)
+DOUBLE_BYTE_PAIR(0x8BD8, 0xB5D7)
+DOUBLE_BYTE_PAIR(0x8BD9, 0xB5D9)
+DOUBLE_BYTE_PAIR(0x8BDA, 0xB5DA)
+DOUBLE_BYTE_PAIR(0x8BDB, 0xB5DB)
+DOUBLE_BYTE_PAIR(0x8BDC, 0xB5DC)
+DOUBLE_BYTE_PAIR(0x8BDD, 0xB5DD)
+DOUBLE_BYTE_PAIR(0x8BDE, 0xB5DE)
+DOUBLE_BYTE_PAIR(0x8BDF, 0xB5DF)
+DOUBLE_BYTE_PAIR(0x8BE0, 0xB5E0)
+DOUBLE_BYTE_PAIR(0x8BE1, 0xB5E1)
+DOUBLE_BYTE_PAIR(0x8BE2, 0xB5E2)
+DOUBLE_BYTE_PAIR(0x8BE3, 0xB5E3)
+DOUBLE_BYTE_PAIR(0x8BE4, 0xB5E4)
+DOUBLE_BYTE_PAIR(0x8BE5, 0xB5E5)
+DOUBLE_BYTE_PAIR(0x8BE6, 0xB5E6)
+DOUBLE_BYTE_PAIR(0x8BE7, 0xB5E7)
+DOUBLE_BYTE_PAIR(0x8BE8, 0xB5E8)
+DOUBLE_BYTE_PAIR(0x8BE9, 0xB5E9)
+DOUBLE_BYTE_PAIR(0x8BEA, 0xB5EA)
+DOUBLE_BYTE_PAIR(0x8BEB, 0xB5EB)
+DOUBLE_BYTE_PAIR(0x8BEC, 0xB5ED)
+DOUBLE_BYTE_PAIR(0x8BED, 0xB5EE)
+DOUBLE_BYTE_PAIR(0x8BEE, 0xB5EF)
+DOUBLE_BYTE_PAIR(0x8BEF, 0xB5F0)
+DOUBLE_BYTE_PAIR(0x8BF0, 0xB5F1)
+DOUBLE_BYTE_PAIR(0x8BF1, 0xB5F2)
+DOUBLE_BYTE_PAIR(0x8BF2, 0xB5F3)
+DOUBLE_BYTE_PAIR(0x8BF3, 0xB5F4)
+DOUBLE_BYTE_PAIR(0x8BF4, 0xB5F5)
+DOUBLE_BYTE_PAIR(0x8BF5, 0xB5F6)
+DOUBLE_BYTE_PAIR(0x8BF6, 0xB5F7)
+DOUBLE_BYTE_PAIR(0x8BF7, 0xB5F8)
+DOUBLE_BYTE_PAIR(0x8BF8, 0xB5F9)
+DOUBLE_BYTE_PAIR(0x8BF9, 0xB5FA)
+DOUBLE_BYTE_PAIR(0x8BFA, 0xB5FB)
+DOUBLE_BYTE_PAIR(0x8BFB, 0xB5FC)
+DOUBLE_BYTE_PAIR(0x8BFC, 0xB5FD)
+DOUBLE_BYTE_PAIR(0x8BFD, 0xB5FE)
+DOUBLE_BYTE_PAIR(0x8BFE, 0xB5FF)
+DOUBLE_BYTE_PAIR(0x8C41, 0xB600)
+DOUBLE_BYTE_PAIR(0x8C42, 0xB601)
+DOUBLE_BYTE_PAIR(0x8C43, 0xB602)
+DOUBLE_BYTE_PAIR(0x8C44, 0xB603)
+DOUBLE_BYTE_PAIR(0x8C45, 0xB604)
+DOUBLE_BYTE_PAIR(0x8C46, 0xB605)
+DOUBLE_BYTE_PAIR(0x8C47, 0xB606)
+DOUBLE_BYTE_PAIR(0x8C48, 0xB607)
+DOUBLE_BYTE_PAIR(0x8C49, 0xB608)
+DOUBLE_BYTE_PAIR(0x8C4A, 0xB609)
+DOUBLE_BYTE_PAIR(0x8C4B, 0xB60A)
+DOUBLE_BYTE_PAIR(0x8C4C, 0xB60B)
+DOUBLE_BYTE_PAIR(0x8C4D, 0xB60C)
+DOUBLE_BYTE_PAIR(0x8C4E, 0xB60D)
+DOUBLE_BYTE_PAIR(0x8C4F, 0xB60E)
+DOUBLE_BYTE_PAIR(0x8C50, 0xB60F)
+DOUBLE_BYTE_PAIR(0x8C51, 0xB612)
+DOUBLE_BYTE_PAIR(0x8C52, 0xB613)
+DOUBLE_BYTE_PAIR(0x8C53, 0xB615)
+DOUBLE_BYTE_PAIR(0x8C54, 0xB616)
+DOUBLE_BYTE_PAIR(0x8C55, 0xB617)
+DOUBLE_BYTE_PAIR(0x8C56, 0xB619)
+DOUBLE_BYTE_PAIR(0x8C57, 0xB61A)
+DOUBLE_BYTE_PAIR(0x8C58, 0xB61B)
+DOUBLE_BYTE_PAIR(0x8C59, 0xB61C)
+DOUBLE_BYTE_PAIR(0x8C5A, 0xB61D)
+DOUBLE_BYTE_PAIR(0x8C61, 0xB61E)
+DOUBLE_BYTE_PAIR(0x8C62, 0xB61F)
+DOUBLE_BYTE_PAIR(0x8C63, 0xB620)
+DOUBLE_BYTE_PAIR(0x8C64, 0xB621)
+DOUBLE_BYTE_PAIR(0x8C65, 0xB622)
+DOUBLE_BYTE_PAIR(0x8C66, 0xB623)
+DOUBLE_BYTE_PAIR(0x8C67, 0xB624)
+DOUBLE_BYTE_PAIR(0x8C68, 0xB626)
+DOUBLE_BYTE_PAIR(0x8C69, 0xB627)
+DOUBLE_BYTE_PAIR(0x8C6A, 0xB628)
+DOUBLE_BYTE_PAIR(0x8C6B, 0xB629)
+DOUBLE_BYTE_PAIR(0x8C6C, 0xB62A)
+DOUBLE_BYTE_PAIR(0x8C6D, 0xB62B)
+DOUBLE_BYTE_PAIR(0x8C6E, 0xB62D)
+DOUBLE_BYTE_PAIR(0x8C6F, 0xB62E)
+DOUBLE_BYTE_PAIR(0x8C70, 0xB62F)
+DOUBLE_BYTE_PAIR(0x8C71, 0xB630)
+DOUBLE_BYTE_PAIR(0x8C72, 0xB631)
+DOUBLE_BYTE_PAIR(0x8C73, 0xB632)
+DOUBLE_BYTE_PAIR(0x8C74, 0xB633)
+DOUBLE_BYTE_PAIR(0x8C75, 0xB635)
+DOUBLE_BYTE_PAIR(0x8C76, 0xB636)
+DOUBLE_BYTE_PAIR(0x8C77, 0xB637)
+DOUBLE_BYTE_PAIR(0x8C78, 0xB638)
+DOUBLE_BYTE_PAIR(0x8C79, 0xB639)
+DOUBLE_BYTE_PAIR(0x8C7A, 0xB63A)
+DOUBLE_BYTE_PAIR(0x8C81, 0xB63B)
+DOUBLE_BYTE_PAIR(0x8C82, 0xB63C)
+DOUBLE_BYTE_PAIR(0x8C83, 0xB63D)
+DOUBLE_BYTE_PAIR(0x8C84, 0xB63E)
+DOUBLE_BYTE_PAIR(0x8C85, 0xB63F)
+DOUBLE_BYTE_PAIR(0x8C86, 0xB640)
+DOUBLE_BYTE_PAIR(0x8C87, 0xB641)
+DOUBLE_BYTE_PAIR(0x8C88, 0xB642)
+DOUBLE_BYTE_PAIR(0x8C89, 0xB643)
+DOUBLE_BYTE_PAIR(0x8C8A, 0xB644)
+DOUBLE_BYTE_PAIR(0x8C8B, 0xB645)
+DOUBLE_BYTE_PAIR(0x8C8C, 0xB646)
+DOUBLE_BYTE_PAIR(0x8C8D, 0xB647)
+DOUBLE_BYTE_PAIR(0x8C8E, 0xB649)
+DOUBLE_BYTE_PAIR(0x8C8F, 0xB64A)
+DOUBLE_BYTE_PAIR(0x8C90, 0xB64B)
+DOUBLE_BYTE_PAIR(0x8C91, 0xB64C)
+DOUBLE_BYTE_PAIR(0x8C92, 0xB64D)
+DOUBLE_BYTE_PAIR(0x8C93, 0xB64E)
+DOUBLE_BYTE_PAIR(0x8C94, 0xB64F)
+DOUBLE_BYTE_PAIR(0x8C95, 0xB650)
+DOUBLE_BYTE_PAIR(0x8C96, 0xB651)
+DOUBLE_BYTE_PAIR(0x8C97, 0xB652)
+DOUBLE_BYTE_PAIR(0x8C98, 0xB653)
+DOUBLE_BYTE_PAIR(0x8C99, 0xB654)
+DOUBLE_BYTE_PAIR(0x8C9A, 0xB655)
+DOUBLE_BYTE_PAIR(0x8C9B, 0xB656)
+DOUBLE_BYTE_PAIR(0x8C9C, 0xB657)
+DOUBLE_BYTE_PAIR(0x8C9D, 0xB658)
+DOUBLE_BYTE_PAIR(0x8C9E, 0xB659)
+DOUBLE_BYTE_PAIR(0x8C9F, 0xB65A)
+DOUBLE_BYTE_PAIR(0x8CA0, 0xB65B)
+DOUBLE_BYTE_PAIR(0x8CA1, 0xB65C)
+DOUBLE_BYTE_PAIR(0x8CA2, 0xB65D)
+DOUBLE_BYTE_PAIR(0x8CA3, 0xB65E)
+DOUBLE_BYTE_PAIR(0x8CA4, 0xB65F)
+DOUBLE_BYTE_PAIR(0x8CA5, 0xB660)
+DOUBLE_BYTE_PAIR(0x8CA6, 0xB661)
+DOUBLE_BYTE_PAIR(0x8CA7, 0xB662)
+DOUBLE_BYTE_PAIR(0x8CA8, 0xB663)
+DOUBLE_BYTE_PAIR(0x8CA9, 0xB665)
+DOUBLE_BYTE_PAIR(0x8CAA, 0xB666)
+DOUBLE_BYTE_PAIR(0x8CAB, 0xB667)
+DOUBLE_BYTE_PAIR(0x8CAC, 0xB669)
+DOUBLE_BYTE_PAIR(0x8CAD, 0xB66A)
+DOUBLE_BYTE_PAIR(0x8CAE, 0xB66B)
+DOUBLE_BYTE_PAIR(0x8CAF, 0xB66C)
+DOUBLE_BYTE_PAIR(0x8CB0, 0xB66D)
+DOUBLE_BYTE_PAIR(0x8CB1, 0xB66E)
+DOUBLE_BYTE_PAIR(0x8CB2, 0xB66F)
+DOUBLE_BYTE_PAIR(0x8CB3, 0xB670)
+DOUBLE_BYTE_PAIR(0x8CB4, 0xB671)
+DOUBLE_BYTE_PAIR(0x8CB5, 0xB672)
+DOUBLE_BYTE_PAIR(0x8CB6, 0xB673)
+DOUBLE_BYTE_PAIR(0x8CB7, 0xB674)
+DOUBLE_BYTE_PAIR(0x8CB8, 0xB675)
+DOUBLE_BYTE_PAIR(0x8CB9, 0xB676)
+DOUBLE_BYTE_PAIR(0x8CBA, 0xB677)
+DOUBLE_BYTE_PAIR(0x8CBB, 0xB678)
+DOUBLE_BYTE_PAIR(0x8CBC, 0xB679)
+DOUBLE_BYTE_PAIR(0x8CBD, 0xB67A)
+DOUBLE_BYTE_PAIR(0x8CBE, 0xB67B)
+DOUBLE_BYTE_PAIR(0x8CBF, 0xB67C)
+DOUBLE_BYTE_PAIR(0x8CC0, 0xB67D)
+DOUBLE_BYTE_PAIR(0x8CC1, 0xB67E)
+DOUBLE_BYTE_PAIR(0x8CC2, 0xB67F)
+DOUBLE_BYTE_PAIR(0x8CC3, 0xB680)
+DOUBLE_BYTE_PAIR(0x8CC4, 0xB681)
+DOUBLE_BYTE_PAIR(0x8CC5, 0xB682)
+DOUBLE_BYTE_PAIR(0x8CC6, 0xB683)
+DOUBLE_BYTE_PAIR(0x8CC7, 0xB684)
+DOUBLE_BYTE_PAIR(0x8CC8, 0xB685)
+DOUBLE_BYTE_PAIR(0x8CC9, 0xB686)
+DOUBLE_BYTE_PAIR(0x8CCA, 0xB687)
+DOUBLE_BYTE_PAIR(0x8CCB, 0xB688)
+DOUBLE_BYTE_PAIR(0x8CCC, 0xB689)
+DOUBLE_BYTE_PAIR(0x8CCD, 0xB68A)
+DOUBLE_BYTE_PAIR(0x8CCE, 0xB68B)
+DOUBLE_BYTE_PAIR(0x8CCF, 0xB68C)
+DOUBLE_BYTE_PAIR(0x8CD0, 0xB68D)
+DOUBLE_BYTE_PAIR(0x8CD1, 0xB68E)
+DOUBLE_BYTE_PAIR(0x8CD2, 0xB68F)
+DOUBLE_BYTE_PAIR(0x8CD3, 0xB690)
+DOUBLE_BYTE_PAIR(0x8CD4, 0xB691)
+DOUBLE_BYTE_PAIR(0x8CD5, 0xB692)
+DOUBLE_BYTE_PAIR(0x8CD6, 0xB693)
+DOUBLE_BYTE_PAIR(0x8CD7, 0xB694)
+DOUBLE_BYTE_PAIR(0x8CD8, 0xB695)
+DOUBLE_BYTE_PAIR(0x8CD9, 0xB696)
+DOUBLE_BYTE_PAIR(0x8CDA, 0xB697)
+DOUBLE_BYTE_PAIR(0x8CDB, 0xB698)
+DOUBLE_BYTE_PAIR(0x8CDC, 0xB699)
+DOUBLE_BYTE_PAIR(0x8CDD, 0xB69A)
+DOUBLE_BYTE_PAIR(0x8CDE, 0xB69B)
+DOUBLE_BYTE_PAIR(0x8CDF, 0xB69E)
+DOUBLE_BYTE_PAIR(0x8CE0, 0xB69F)
+DOUBLE_BYTE_PAIR(0x8CE1, 0xB6A1)
+DOUBLE_BYTE_PAIR(0x8CE2, 0xB6A2)
+DOUBLE_BYTE_PAIR(0x8CE3, 0xB6A3)
+DOUBLE_BYTE_PAIR(0x8CE4, 0xB6A5)
+DOUBLE_BYTE_PAIR(0x8CE5, 0xB6A6)
+DOUBLE_BYTE_PAIR(0x8CE6, 0xB6A7)
+DOUBLE_BYTE_PAIR(0x8CE7, 0xB6A8)
+DOUBLE_BYTE_PAIR(0x8CE8, 0xB6A9)
+DOUBLE_BYTE_PAIR(0x8CE9, 0xB6AA)
+DOUBLE_BYTE_PAIR(0x8CEA, 0xB6AD)
+DOUBLE_BYTE_PAIR(0x8CEB, 0xB6AE)
+DOUBLE_BYTE_PAIR(0x8CEC, 0xB6AF)
+DOUBLE_BYTE_PAIR(0x8CED, 0xB6B0)
+DOUBLE_BYTE_PAIR(0x8CEE, 0xB6B2)
+DOUBLE_BYTE_PAIR(0x8CEF, 0xB6B3)
+DOUBLE_BYTE_PAIR(0x8CF0, 0xB6B4)
+DOUBLE_BYTE_PAIR(0x8CF1, 0xB6B5)
+DOUBLE_BYTE_PAIR(0x8CF2, 0xB6B6)
+DOUBLE_BYTE_PAIR(0x8CF3, 0xB6B7)
+DOUBLE_BYTE_PAIR(0x8CF4, 0xB6B8)
+DOUBLE_BYTE_PAIR(0x8CF5, 0xB6B9)
+DOUBLE_BYTE_PAIR(0x8CF6, 0xB6BA)
+DOUBLE_BYTE_PAIR(0x8CF7, 0xB6BB)
+DOUBLE_BYTE_PAIR(0x8CF8, 0xB6BC)
+DOUBLE_BYTE_PAIR(0x8CF9, 0xB6BD)
+DOUBLE_BYTE_PAIR(0x8CFA, 0xB6BE)
+DOUBLE_BYTE_PAIR(0x8CFB, 0xB6BF)
+DOUBLE_BYTE_PAIR(0x8CFC, 0xB6C0)
+DOUBLE_BYTE_PAIR(0x8CFD, 0xB6C1)
+DOUBLE_BYTE_PAIR(0x8CFE, 0xB6C2)
+DOUBLE_BYTE_PAIR(0x8D41, 0xB6C3)
+DOUBLE_BYTE_PAIR(0x8D42, 0xB6C4)
+DOUBLE_BYTE_PAIR(0x8D43, 0xB6C5)
+DOUBLE_BYTE_PAIR(0x8D44, 0xB6C6)
+DOUBLE_BYTE_PAIR(0x8D45, 0xB6C7)
+DOUBLE_BYTE_PAIR(0x8D46, 0xB6C8)
+DOUBLE_BYTE_PAIR(0x8D47, 0xB6C9)
+DOUBLE_BYTE_PAIR(0x8D48, 0xB6CA)
+DOUBLE_BYTE_PAIR(0x8D49, 0xB6CB)
+DOUBLE_BYTE_PAIR(0x8D4A, 0xB6CC)
+DOUBLE_BYTE_PAIR(0x8D4B, 0xB6CD)
+DOUBLE_BYTE_PAIR(0x8D4C, 0xB6CE)
+DOUBLE_BYTE_PAIR(0x8D4D, 0xB6CF)
+DOUBLE_BYTE_PAIR(0x8D4E, 0xB6D0)
+DOUBLE_BYTE_PAIR(0x8D4F, 0xB6D1)
+DOUBLE_BYTE_PAIR(0x8D50, 0xB6D2)
+DOUBLE_BYTE_PAIR(0x8D51, 0xB6D3)
+DOUBLE_BYTE_PAIR(0x8D52, 0xB6D5)
+DOUBLE_BYTE_PAIR(0x8D53, 0xB6D6)
+DOUBLE_BYTE_PAIR(0x8D54, 0xB6D7)
+DOUBLE_BYTE_PAIR(0x8D55, 0xB6D8)
+DOUBLE_BYTE_PAIR(0x8D56, 0xB6D9)
+DOUBLE_BYTE_PAIR(0x8D57, 0xB6DA)
+DOUBLE_BYTE_PAIR(0x8D58, 0xB6DB)
+DOUBLE_BYTE_PAIR(0x8D59, 0xB6DC)
+DOUBLE_BYTE_PAIR(0x8D5A, 0xB6DD)
+DOUBLE_BYTE_PAIR(0x8D61, 0xB6DE)
+DOUBLE_BYTE_PAIR(0x8D62, 0xB6DF)
+DOUBLE_BYTE_PAIR(0x8D63, 0xB6E0)
+DOUBLE_BYTE_PAIR(0x8D64, 0xB6E1)
+DOUBLE_BYTE_PAIR(0x8D65, 0xB6E2)
+DOUBLE_BYTE_PAIR(0x8D66, 0xB6E3)
+DOUBLE_BYTE_PAIR(0x8D67, 0xB6E4)
+DOUBLE_BYTE_PAIR(0x8D68, 0xB6E5)
+DOUBLE_BYTE_PAIR(0x8D69, 0xB6E6)
+DOUBLE_BYTE_PAIR(0x8D6A, 0xB6E7)
+DOUBLE_BYTE_PAIR(0x8D6B, 0xB6E8)
+DOUBLE_BYTE_PAIR(0x8D6C, 0xB6E9)
+DOUBLE_BYTE_PAIR(0x8D6D, 0xB6EA)
+DOUBLE_BYTE_PAIR(0x8D6E, 0xB6EB)
+DOUBLE_BYTE_PAIR(0x8D6F, 0xB6EC)
+DOUBLE_BYTE_PAIR(0x8D70, 0xB6ED)
+DOUBLE_BYTE_PAIR(0x8D71, 0xB6EE)
+DOUBLE_BYTE_PAIR(0x8D72, 0xB6EF)
+DOUBLE_BYTE_PAIR(0x8D73, 0xB6F1)
+DOUBLE_BYTE_PAIR(0x8D74, 0xB6F2)
+DOUBLE_BYTE_PAIR(0x8D75, 0xB6F3)
+DOUBLE_BYTE_PAIR(0x8D76, 0xB6F5)
+DOUBLE_BYTE_PAIR(0x8D77, 0xB6F6)
+DOUBLE_BYTE_PAIR(0x8D78, 0xB6F7)
+DOUBLE_BYTE_PAIR(0x8D79, 0xB6F9)
+DOUBLE_BYTE_PAIR(0x8D7A, 0xB6FA)
+DOUBLE_BYTE_PAIR(0x8D81, 0xB6FB)
+DOUBLE_BYTE_PAIR(0x8D82, 0xB6FC)
+DOUBLE_BYTE_PAIR(0x8D83, 0xB6FD)
+DOUBLE_BYTE_PAIR(0x8D84, 0xB6FE)
+DOUBLE_BYTE_PAIR(0x8D85, 0xB6FF)
+DOUBLE_BYTE_PAIR(0x8D86, 0xB702)
+DOUBLE_BYTE_PAIR(0x8D87, 0xB703)
+DOUBLE_BYTE_PAIR(0x8D88, 0xB704)
+DOUBLE_BYTE_PAIR(0x8D89, 0xB706)
+DOUBLE_BYTE_PAIR(0x8D8A, 0xB707)
+DOUBLE_BYTE_PAIR(0x8D8B, 0xB708)
+DOUBLE_BYTE_PAIR(0x8D8C, 0xB709)
+DOUBLE_BYTE_PAIR(0x8D8D, 0xB70A)
+DOUBLE_BYTE_PAIR(0x8D8E, 0xB70B)
+DOUBLE_BYTE_PAIR(0x8D8F, 0xB70C)
+DOUBLE_BYTE_PAIR(0x8D90, 0xB70D)
+DOUBLE_BYTE_PAIR(0x8D91, 0xB70E)
+DOUBLE_BYTE_PAIR(0x8D92, 0xB70F)
+DOUBLE_BYTE_PAIR(0x8D93, 0xB710)
+DOUBLE_BYTE_PAIR(0x8D94, 0xB711)
+DOUBLE_BYTE_PAIR(0x8D95, 0xB712)
+DOUBLE_BYTE_PAIR(0x8D96, 0xB713)
+DOUBLE_BYTE_PAIR(0x8D97, 0xB714)
+DOUBLE_BYTE_PAIR(0x8D98, 0xB715)
+DOUBLE_BYTE_PAIR(0x8D99, 0xB716)
+DOUBLE_BYTE_PAIR(0x8D9A, 0xB717)
+DOUBLE_BYTE_PAIR(0x8D9B, 0xB718)
+DOUBLE_BYTE_PAIR(0x8D9C, 0xB719)
+DOUBLE_BYTE_PAIR(0x8D9D, 0xB71A)
+DOUBLE_BYTE_PAIR(0x8D9E, 0xB71B)
+DOUBLE_BYTE_PAIR(0x8D9F, 0xB71C)
+DOUBLE_BYTE_PAIR(0x8DA0, 0xB71D)
+DOUBLE_BYTE_PAIR(0x8DA1, 0xB71E)
+DOUBLE_BYTE_PAIR(0x8DA2, 0xB71F)
+DOUBLE_BYTE_PAIR(0x8DA3, 0xB720)
+DOUBLE_BYTE_PAIR(0x8DA4, 0xB721)
+DOUBLE_BYTE_PAIR(0x8DA5, 0xB722)
+DOUBLE_BYTE_PAIR(0x8DA6, 0xB723)
+DOUBLE_BYTE_PAIR(0x8DA7, 0xB724)
+DOUBLE_BYTE_PAIR(0x8DA8, 0xB725)
+DOUBLE_BYTE_PAIR(0x8DA9, 0xB726)
+DOUBLE_BYTE_PAIR(0x8DAA, 0xB727)
+DOUBLE_BYTE_PAIR(0x8DAB, 0xB72A)
+DOUBLE_BYTE_PAIR(0x8DAC, 0xB72B)
+DOUBLE_BYTE_PAIR(0x8DAD, 0xB72D)
+DOUBLE_BYTE_PAIR(0x8DAE, 0xB72E)
+DOUBLE_BYTE_PAIR(0x8DAF, 0xB731)
+DOUBLE_BYTE_PAIR(0x8DB0, 0xB732)
+DOUBLE_BYTE_PAIR(0x8DB1, 0xB733)
+DOUBLE_BYTE_PAIR(0x8DB2, 0xB734)
+DOUBLE_BYTE_PAIR(0x8DB3, 0xB735)
+DOUBLE_BYTE_PAIR(0x8DB4, 0xB736)
+DOUBLE_BYTE_PAIR(0x8DB5, 0xB737)
+DOUBLE_BYTE_PAIR(0x8DB6, 0xB73A)
+DOUBLE_BYTE_PAIR(0x8DB7, 0xB73C)
+DOUBLE_BYTE_PAIR(0x8DB8, 0xB73D)
+DOUBLE_BYTE_PAIR(0x8DB9, 0xB73E)
+DOUBLE_BYTE_PAIR(0x8DBA, 0xB73F)
+DOUBLE_BYTE_PAIR(0x8DBB, 0xB740)
+DOUBLE_BYTE_PAIR(0x8DBC, 0xB741)
+DOUBLE_BYTE_PAIR(0x8DBD, 0xB742)
+DOUBLE_BYTE_PAIR(0x8DBE, 0xB743)
+DOUBLE_BYTE_PAIR(0x8DBF, 0xB745)
+DOUBLE_BYTE_PAIR(0x8DC0, 0xB746)
+DOUBLE_BYTE_PAIR(0x8DC1, 0xB747)
+DOUBLE_BYTE_PAIR(0x8DC2, 0xB749)
+DOUBLE_BYTE_PAIR(0x8DC3, 0xB74A)
+DOUBLE_BYTE_PAIR(0x8DC4, 0xB74B)
+DOUBLE_BYTE_PAIR(0x8DC5, 0xB74D)
+DOUBLE_BYTE_PAIR(0x8DC6, 0xB74E)
+DOUBLE_BYTE_PAIR(0x8DC7, 0xB74F)
+DOUBLE_BYTE_PAIR(0x8DC8, 0xB750)
+DOUBLE_BYTE_PAIR(0x8DC9, 0xB751)
+DOUBLE_BYTE_PAIR(0x8DCA, 0xB752)
+DOUBLE_BYTE_PAIR(0x8DCB, 0xB753)
+DOUBLE_BYTE_PAIR(0x8DCC, 0xB756)
+DOUBLE_BYTE_PAIR(0x8DCD, 0xB757)
+DOUBLE_BYTE_PAIR(0x8DCE, 0xB758)
+DOUBLE_BYTE_PAIR(0x8DCF, 0xB759)
+DOUBLE_BYTE_PAIR(0x8DD0, 0xB75A)
+DOUBLE_BYTE_PAIR(0x8DD1, 0xB75B)
+DOUBLE_BYTE_PAIR(0x8DD2, 0xB75C)
+DOUBLE_BYTE_PAIR(0x8DD3, 0xB75D)
+DOUBLE_BYTE_PAIR(0x8DD4, 0xB75E)
+DOUBLE_BYTE_PAIR(0x8DD5, 0xB75F)
+DOUBLE_BYTE_PAIR(0x8DD6, 0xB761)
+DOUBLE_BYTE_PAIR(0x8DD7, 0xB762)
+DOUBLE_BYTE_PAIR(0x8DD8, 0xB763)
+DOUBLE_BYTE_PAIR(0x8DD9, 0xB765)
+DOUBLE_BYTE_PAIR(0x8DDA, 0xB766)
+DOUBLE_BYTE_PAIR(0x8DDB, 0xB767)
+DOUBLE_BYTE_PAIR(0x8DDC, 0xB769)
+DOUBLE_BYTE_PAIR(0x8DDD, 0xB76A)
+DOUBLE_BYTE_PAIR(0x8DDE, 0xB76B)
+DOUBLE_BYTE_PAIR(0x8DDF, 0xB76C)
+DOUBLE_BYTE_PAIR(0x8DE0, 0xB76D)
+DOUBLE_BYTE_PAIR(0x8DE1, 0xB76E)
+DOUBLE_BYTE_PAIR(0x8DE2, 0xB76F)
+DOUBLE_BYTE_PAIR(0x8DE3, 0xB772)
+DOUBLE_BYTE_PAIR(0x8DE4, 0xB774)
+DOUBLE_BYTE_PAIR(0x8DE5, 0xB776)
+DOUBLE_BYTE_PAIR(0x8DE6, 0xB777)
+DOUBLE_BYTE_PAIR(0x8DE7, 0xB778)
+DOUBLE_BYTE_PAIR(0x8DE8, 0xB779)
+DOUBLE_BYTE_PAIR(0x8DE9, 0xB77A)
+DOUBLE_BYTE_PAIR(0x8DEA, 0xB77B)
+DOUBLE_BYTE_PAIR(0x8DEB, 0xB77E)
+DOUBLE_BYTE_PAIR(0x8DEC, 0xB77F)
+DOUBLE_BYTE_PAIR(0x8DED, 0xB781)
+DOUBLE_BYTE_PAIR(0x8DEE, 0xB782)
+DOUBLE_BYTE_PAIR(0x8DEF, 0xB783)
+DOUBLE_BYTE_PAIR(0x8DF0, 0xB785)
+DOUBLE_BYTE_PAIR(0x8DF1, 0xB786)
+DOUBLE_BYTE_PAIR(0x8DF2, 0xB787)
+DOUBLE_BYTE_PAIR(0x8DF3, 0xB788)
+DOUBLE_BYTE_PAIR(0x8DF4, 0xB789)
+DOUBLE_BYTE_PAIR(0x8DF5, 0xB78A)
+DOUBLE_BYTE_PAIR(0x8DF6, 0xB78B)
+DOUBLE_BYTE_PAIR(0x8DF7, 0xB78E)
+DOUBLE_BYTE_PAIR(0x8DF8, 0xB793)
+DOUBLE_BYTE_PAIR(0x8DF9, 0xB794)
+DOUBLE_BYTE_PAIR(0x8DFA, 0xB795)
+DOUBLE_BYTE_PAIR(0x8DFB, 0xB79A)
+DOUBLE_BYTE_PAIR(0x8DFC, 0xB79B)
+DOUBLE_BYTE_PAIR(0x8DFD, 0xB79D)
+DOUBLE_BYTE_PAIR(0x8DFE, 0xB79E)
+DOUBLE_BYTE_PAIR(0x8E41, 0xB79F)
+DOUBLE_BYTE_PAIR(0x8E42, 0xB7A1)
+DOUBLE_BYTE_PAIR(0x8E43, 0xB7A2)
+DOUBLE_BYTE_PAIR(0x8E44, 0xB7A3)
+DOUBLE_BYTE_PAIR(0x8E45, 0xB7A4)
+DOUBLE_BYTE_PAIR(0x8E46, 0xB7A5)
+DOUBLE_BYTE_PAIR(0x8E47, 0xB7A6)
+DOUBLE_BYTE_PAIR(0x8E48, 0xB7A7)
+DOUBLE_BYTE_PAIR(0x8E49, 0xB7AA)
+DOUBLE_BYTE_PAIR(0x8E4A, 0xB7AE)
+DOUBLE_BYTE_PAIR(0x8E4B, 0xB7AF)
+DOUBLE_BYTE_PAIR(0x8E4C, 0xB7B0)
+DOUBLE_BYTE_PAIR(0x8E4D, 0xB7B1)
+DOUBLE_BYTE_PAIR(0x8E4E, 0xB7B2)
+DOUBLE_BYTE_PAIR(0x8E4F, 0xB7B3)
+DOUBLE_BYTE_PAIR(0x8E50, 0xB7B6)
+DOUBLE_BYTE_PAIR(0x8E51, 0xB7B7)
+DOUBLE_BYTE_PAIR(0x8E52, 0xB7B9)
+DOUBLE_BYTE_PAIR(0x8E53, 0xB7BA)
+DOUBLE_BYTE_PAIR(0x8E54, 0xB7BB)
+DOUBLE_BYTE_PAIR(0x8E55, 0xB7BC)
+DOUBLE_BYTE_PAIR(0x8E56, 0xB7BD)
+DOUBLE_BYTE_PAIR(0x8E57, 0xB7BE)
+DOUBLE_BYTE_PAIR(0x8E58, 0xB7BF)
+DOUBLE_BYTE_PAIR(0x8E59, 0xB7C0)
+DOUBLE_BYTE_PAIR(0x8E5A, 0xB7C1)
+DOUBLE_BYTE_PAIR(0x8E61, 0xB7C2)
+DOUBLE_BYTE_PAIR(0x8E62, 0xB7C3)
+DOUBLE_BYTE_PAIR(0x8E63, 0xB7C4)
+DOUBLE_BYTE_PAIR(0x8E64, 0xB7C5)
+DOUBLE_BYTE_PAIR(0x8E65, 0xB7C6)
+DOUBLE_BYTE_PAIR(0x8E66, 0xB7C8)
+DOUBLE_BYTE_PAIR(0x8E67, 0xB7CA)
+DOUBLE_BYTE_PAIR(0x8E68, 0xB7CB)
+DOUBLE_BYTE_PAIR(0x8E69, 0xB7CC)
+DOUBLE_BYTE_PAIR(0x8E6A, 0xB7CD)
+DOUBLE_BYTE_PAIR(0x8E6B, 0xB7CE)
+DOUBLE_BYTE_PAIR(0x8E6C, 0xB7CF)
+DOUBLE_BYTE_PAIR(0x8E6D, 0xB7D0)
+DOUBLE_BYTE_PAIR(0x8E6E, 0xB7D1)
+DOUBLE_BYTE_PAIR(0x8E6F, 0xB7D2)
+DOUBLE_BYTE_PAIR(0x8E70, 0xB7D3)
+DOUBLE_BYTE_PAIR(0x8E71, 0xB7D4)
+DOUBLE_BYTE_PAIR(0x8E72, 0xB7D5)
+DOUBLE_BYTE_PAIR(0x8E73, 0xB7D6)
+DOUBLE_BYTE_PAIR(0x8E74, 0xB7D7)
+DOUBLE_BYTE_PAIR(0x8E75, 0xB7D8)
+DOUBLE_BYTE_PAIR(0x8E76, 0xB7D9)
+DOUBLE_BYTE_PAIR(0x8E77, 0xB7DA)
+DOUBLE_BYTE_PAIR(0x8E78, 0xB7DB)
+DOUBLE_BYTE_PAIR(0x8E79, 0xB7DC)
+DOUBLE_BYTE_PAIR(0x8E7A, 0xB7DD)
+DOUBLE_BYTE_PAIR(0x8E81, 0xB7DE)
+DOUBLE_BYTE_PAIR(0x8E82, 0xB7DF)
+DOUBLE_BYTE_PAIR(0x8E83, 0xB7E0)
+DOUBLE_BYTE_PAIR(0x8E84, 0xB7E1)
+DOUBLE_BYTE_PAIR(0x8E85, 0xB7E2)
+DOUBLE_BYTE_PAIR(0x8E86, 0xB7E3)
+DOUBLE_BYTE_PAIR(0x8E87, 0xB7E4)
+DOUBLE_BYTE_PAIR(0x8E88, 0xB7E5)
+DOUBLE_BYTE_PAIR(0x8E89, 0xB7E6)
+DOUBLE_BYTE_PAIR(0x8E8A, 0xB7E7)
+DOUBLE_BYTE_PAIR(0x8E8B, 0xB7E8)
+DOUBLE_BYTE_PAIR(0x8E8C, 0xB7E9)
+DOUBLE_BYTE_PAIR(0x8E8D, 0xB7EA)
+DOUBLE_BYTE_PAIR(0x8E8E, 0xB7EB)
+DOUBLE_BYTE_PAIR(0x8E8F, 0xB7EE)
+DOUBLE_BYTE_PAIR(0x8E90, 0xB7EF)
+DOUBLE_BYTE_PAIR(0x8E91, 0xB7F1)
+DOUBLE_BYTE_PAIR(0x8E92, 0xB7F2)
+DOUBLE_BYTE_PAIR(0x8E93, 0xB7F3)
+DOUBLE_BYTE_PAIR(0x8E94, 0xB7F5)
+DOUBLE_BYTE_PAIR(0x8E95, 0xB7F6)
+DOUBLE_BYTE_PAIR(0x8E96, 0xB7F7)
+DOUBLE_BYTE_PAIR(0x8E97, 0xB7F8)
+DOUBLE_BYTE_PAIR(0x8E98, 0xB7F9)
+DOUBLE_BYTE_PAIR(0x8E99, 0xB7FA)
+DOUBLE_BYTE_PAIR(0x8E9A, 0xB7FB)
+DOUBLE_BYTE_PAIR(0x8E9B, 0xB7FE)
+DOUBLE_BYTE_PAIR(0x8E9C, 0xB802)
+DOUBLE_BYTE_PAIR(0x8E9D, 0xB803)
+DOUBLE_BYTE_PAIR(0x8E9E, 0xB804)
+DOUBLE_BYTE_PAIR(0x8E9F, 0xB805)
+DOUBLE_BYTE_PAIR(0x8EA0, 0xB806)
+DOUBLE_BYTE_PAIR(0x8EA1, 0xB80A)
+DOUBLE_BYTE_PAIR(0x8EA2, 0xB80B)
+DOUBLE_BYTE_PAIR(0x8EA3, 0xB80D)
+DOUBLE_BYTE_PAIR(0x8EA4, 0xB80E)
+DOUBLE_BYTE_PAIR(0x8EA5, 0xB80F)
+DOUBLE_BYTE_PAIR(0x8EA6, 0xB811)
+DOUBLE_BYTE_PAIR(0x8EA7, 0xB812)
+DOUBLE_BYTE_PAIR(0x8EA8, 0xB813)
+DOUBLE_BYTE_PAIR(0x8EA9, 0xB814)
+DOUBLE_BYTE_PAIR(0x8EAA, 0xB815)
+DOUBLE_BYTE_PAIR(0x8EAB, 0xB816)
+DOUBLE_BYTE_PAIR(0x8EAC, 0xB817)
+DOUBLE_BYTE_PAIR(0x8EAD, 0xB81A)
+DOUBLE_BYTE_PAIR(0x8EAE, 0xB81C)
+DOUBLE_BYTE_PAIR(0x8EAF, 0xB81E)
+DOUBLE_BYTE_PAIR(0x8EB0, 0xB81F)
+DOUBLE_BYTE_PAIR(0x8EB1, 0xB820)
+DOUBLE_BYTE_PAIR(0x8EB2, 0xB821)
+DOUBLE_BYTE_PAIR(0x8EB3, 0xB822)
+DOUBLE_BYTE_PAIR(0x8EB4, 0xB823)
+DOUBLE_BYTE_PAIR(0x8EB5, 0xB826)
+DOUBLE_BYTE_PAIR(0x8EB6, 0xB827)
+DOUBLE_BYTE_PAIR(0x8EB7, 0xB829)
+DOUBLE_BYTE_PAIR(0x8EB8, 0xB82A)
+DOUBLE_BYTE_PAIR(0x8EB9, 0xB82B)
+DOUBLE_BYTE_PAIR(0x8EBA, 0xB82D)
+DOUBLE_BYTE_PAIR(0x8EBB, 0xB82E)
+DOUBLE_BYTE_PAIR(0x8EBC, 0xB82F)
+DOUBLE_BYTE_PAIR(0x8EBD, 0xB830)
+DOUBLE_BYTE_PAIR(0x8EBE, 0xB831)
+DOUBLE_BYTE_PAIR(0x8EBF, 0xB832)
+DOUBLE_BYTE_PAIR(0x8EC0, 0xB833)
+DOUBLE_BYTE_PAIR(0x8EC1, 0xB836)
+DOUBLE_BYTE_PAIR(0x8EC2, 0xB83A)
+DOUBLE_BYTE_PAIR(0x8EC3, 0xB83B)
+DOUBLE_BYTE_PAIR(0x8EC4, 0xB83C)
+DOUBLE_BYTE_PAIR(0x8EC5, 0xB83D)
+DOUBLE_BYTE_PAIR(0x8EC6, 0xB83E)
+DOUBLE_BYTE_PAIR(0x8EC7, 0xB83F)
+DOUBLE_BYTE_PAIR(0x8EC8, 0xB841)
+DOUBLE_BYTE_PAIR(0x8EC9, 0xB842)
+DOUBLE_BYTE_PAIR(0x8ECA, 0xB843)
+DOUBLE_BYTE_PAIR(0x8ECB, 0xB845)
+DOUBLE_BYTE_PAIR(0x8ECC, 0xB846)
+DOUBLE_BYTE_PAIR(0x8ECD, 0xB847)
+DOUBLE_BYTE_PAIR(0x8ECE, 0xB848)
+DOUBLE_BYTE_PAIR(0x8ECF, 0xB849)
+DOUBLE_BYTE_PAIR(0x8ED0, 0xB84A)
+DOUBLE_BYTE_PAIR(0x8ED1, 0xB84B)
+DOUBLE_BYTE_PAIR(0x8ED2, 0xB84C)
+DOUBLE_BYTE_PAIR(0x8ED3, 0xB84D)
+DOUBLE_BYTE_PAIR(0x8ED4, 0xB84E)
+DOUBLE_BYTE_PAIR(0x8ED5, 0xB84F)
+DOUBLE_BYTE_PAIR(0x8ED6, 0xB850)
+DOUBLE_BYTE_PAIR(0x8ED7, 0xB852)
+DOUBLE_BYTE_PAIR(0x8ED8, 0xB854)
+DOUBLE_BYTE_PAIR(0x8ED9, 0xB855)
+DOUBLE_BYTE_PAIR(0x8EDA, 0xB856)
+DOUBLE_BYTE_PAIR(0x8EDB, 0xB857)
+DOUBLE_BYTE_PAIR(0x8EDC, 0xB858)
+DOUBLE_BYTE_PAIR(0x8EDD, 0xB859)
+DOUBLE_BYTE_PAIR(0x8EDE, 0xB85A)
+DOUBLE_BYTE_PAIR(0x8EDF, 0xB85B)
+DOUBLE_BYTE_PAIR(0x8EE0, 0xB85E)
+DOUBLE_BYTE_PAIR(0x8EE1, 0xB85F)
+DOUBLE_BYTE_PAIR(0x8EE2, 0xB861)
+DOUBLE_BYTE_PAIR(0x8EE3, 0xB862)
+DOUBLE_BYTE_PAIR(0x8EE4, 0xB863)
+DOUBLE_BYTE_PAIR(0x8EE5, 0xB865)
+DOUBLE_BYTE_PAIR(0x8EE6, 0xB866)
+DOUBLE_BYTE_PAIR(0x8EE7, 0xB867)
+DOUBLE_BYTE_PAIR(0x8EE8, 0xB868)
+DOUBLE_BYTE_PAIR(0x8EE9, 0xB869)
+DOUBLE_BYTE_PAIR(0x8EEA, 0xB86A)
+DOUBLE_BYTE_PAIR(0x8EEB, 0xB86B)
+DOUBLE_BYTE_PAIR(0x8EEC, 0xB86E)
+DOUBLE_BYTE_PAIR(0x8EED, 0xB870)
+DOUBLE_BYTE_PAIR(0x8EEE, 0xB872)
+DOUBLE_BYTE_PAIR(0x8EEF, 0xB873)
+DOUBLE_BYTE_PAIR(0x8EF0, 0xB874)
+DOUBLE_BYTE_PAIR(0x8EF1, 0xB875)
+DOUBLE_BYTE_PAIR(0x8EF2, 0xB876)
+DOUBLE_BYTE_PAIR(0x8EF3, 0xB877)
+DOUBLE_BYTE_PAIR(0x8EF4, 0xB879)
+DOUBLE_BYTE_PAIR(0x8EF5, 0xB87A)
+DOUBLE_BYTE_PAIR(0x8EF6, 0xB87B)
+DOUBLE_BYTE_PAIR(0x8EF7, 0xB87D)
+DOUBLE_BYTE_PAIR(0x8EF8, 0xB87E)
+DOUBLE_BYTE_PAIR(0x8EF9, 0xB87F)
+DOUBLE_BYTE_PAIR(0x8EFA, 0xB880)
+DOUBLE_BYTE_PAIR(0x8EFB, 0xB881)
+DOUBLE_BYTE_PAIR(0x8EFC, 0xB882)
+DOUBLE_BYTE_PAIR(0x8EFD, 0xB883)
+DOUBLE_BYTE_PAIR(0x8EFE, 0xB884)
+DOUBLE_BYTE_PAIR(0x8F41, 0xB885)
+DOUBLE_BYTE_PAIR(0x8F42, 0xB886)
+DOUBLE_BYTE_PAIR(0x8F43, 0xB887)
+DOUBLE_BYTE_PAIR(0x8F44, 0xB888)
+DOUBLE_BYTE_PAIR(0x8F45, 0xB889)
+DOUBLE_BYTE_PAIR(0x8F46, 0xB88A)
+DOUBLE_BYTE_PAIR(0x8F47, 0xB88B)
+DOUBLE_BYTE_PAIR(0x8F48, 0xB88C)
+DOUBLE_BYTE_PAIR(0x8F49, 0xB88E)
+DOUBLE_BYTE_PAIR(0x8F4A, 0xB88F)
+DOUBLE_BYTE_PAIR(0x8F4B, 0xB890)
+DOUBLE_BYTE_PAIR(0x8F4C, 0xB891)
+DOUBLE_BYTE_PAIR(0x8F4D, 0xB892)
+DOUBLE_BYTE_PAIR(0x8F4E, 0xB893)
+DOUBLE_BYTE_PAIR(0x8F4F, 0xB894)
+DOUBLE_BYTE_PAIR(0x8F50, 0xB895)
+DOUBLE_BYTE_PAIR(0x8F51, 0xB896)
+DOUBLE_BYTE_PAIR(0x8F52, 0xB897)
+DOUBLE_BYTE_PAIR(0x8F53, 0xB898)
+DOUBLE_BYTE_PAIR(0x8F54, 0xB899)
+DOUBLE_BYTE_PAIR(0x8F55, 0xB89A)
+DOUBLE_BYTE_PAIR(0x8F56, 0xB89B)
+DOUBLE_BYTE_PAIR(0x8F57, 0xB89C)
+DOUBLE_BYTE_PAIR(0x8F58, 0xB89D)
+DOUBLE_BYTE_PAIR(0x8F59, 0xB89E)
+DOUBLE_BYTE_PAIR(0x8F5A, 0xB89F)
+DOUBLE_BYTE_PAIR(0x8F61, 0xB8A0)
+DOUBLE_BYTE_PAIR(0x8F62, 0xB8A1)
+DOUBLE_BYTE_PAIR(0x8F63, 0xB8A2)
+DOUBLE_BYTE_PAIR(0x8F64, 0xB8A3)
+DOUBLE_BYTE_PAIR(0x8F65, 0xB8A4)
+DOUBLE_BYTE_PAIR(0x8F66, 0xB8A5)
+DOUBLE_BYTE_PAIR(0x8F67, 0xB8A6)
+DOUBLE_BYTE_PAIR(0x8F68, 0xB8A7)
+DOUBLE_BYTE_PAIR(0x8F69, 0xB8A9)
+DOUBLE_BYTE_PAIR(0x8F6A, 0xB8AA)
+DOUBLE_BYTE_PAIR(0x8F6B, 0xB8AB)
+DOUBLE_BYTE_PAIR(0x8F6C, 0xB8AC)
+DOUBLE_BYTE_PAIR(0x8F6D, 0xB8AD)
+DOUBLE_BYTE_PAIR(0x8F6E, 0xB8AE)
+DOUBLE_BYTE_PAIR(0x8F6F, 0xB8AF)
+DOUBLE_BYTE_PAIR(0x8F70, 0xB8B1)
+DOUBLE_BYTE_PAIR(0x8F71, 0xB8B2)
+DOUBLE_BYTE_PAIR(0x8F72, 0xB8B3)
+DOUBLE_BYTE_PAIR(0x8F73, 0xB8B5)
+DOUBLE_BYTE_PAIR(0x8F74, 0xB8B6)
+DOUBLE_BYTE_PAIR(0x8F75, 0xB8B7)
+DOUBLE_BYTE_PAIR(0x8F76, 0xB8B9)
+DOUBLE_BYTE_PAIR(0x8F77, 0xB8BA)
+DOUBLE_BYTE_PAIR(0x8F78, 0xB8BB)
+DOUBLE_BYTE_PAIR(0x8F79, 0xB8BC)
+DOUBLE_BYTE_PAIR(0x8F7A, 0xB8BD)
+DOUBLE_BYTE_PAIR(0x8F81, 0xB8BE)
+DOUBLE_BYTE_PAIR(0x8F82, 0xB8BF)
+DOUBLE_BYTE_PAIR(0x8F83, 0xB8C2)
+DOUBLE_BYTE_PAIR(0x8F84, 0xB8C4)
+DOUBLE_BYTE_PAIR(0x8F85, 0xB8C6)
+DOUBLE_BYTE_PAIR(0x8F86, 0xB8C7)
+DOUBLE_BYTE_PAIR(0x8F87, 0xB8C8)
+DOUBLE_BYTE_PAIR(0x8F88, 0xB8C9)
+DOUBLE_BYTE_PAIR(0x8F89, 0xB8CA)
+DOUBLE_BYTE_PAIR(0x8F8A, 0xB8CB)
+DOUBLE_BYTE_PAIR(0x8F8B, 0xB8CD)
+DOUBLE_BYTE_PAIR(0x8F8C, 0xB8CE)
+DOUBLE_BYTE_PAIR(0x8F8D, 0xB8CF)
+DOUBLE_BYTE_PAIR(0x8F8E, 0xB8D1)
+DOUBLE_BYTE_PAIR(0x8F8F, 0xB8D2)
+DOUBLE_BYTE_PAIR(0x8F90, 0xB8D3)
+DOUBLE_BYTE_PAIR(0x8F91, 0xB8D5)
+DOUBLE_BYTE_PAIR(0x8F92, 0xB8D6)
+DOUBLE_BYTE_PAIR(0x8F93, 0xB8D7)
+DOUBLE_BYTE_PAIR(0x8F94, 0xB8D8)
+DOUBLE_BYTE_PAIR(0x8F95, 0xB8D9)
+DOUBLE_BYTE_PAIR(0x8F96, 0xB8DA)
+DOUBLE_BYTE_PAIR(0x8F97, 0xB8DB)
+DOUBLE_BYTE_PAIR(0x8F98, 0xB8DC)
+DOUBLE_BYTE_PAIR(0x8F99, 0xB8DE)
+DOUBLE_BYTE_PAIR(0x8F9A, 0xB8E0)
+DOUBLE_BYTE_PAIR(0x8F9B, 0xB8E2)
+DOUBLE_BYTE_PAIR(0x8F9C, 0xB8E3)
+DOUBLE_BYTE_PAIR(0x8F9D, 0xB8E4)
+DOUBLE_BYTE_PAIR(0x8F9E, 0xB8E5)
+DOUBLE_BYTE_PAIR(0x8F9F, 0xB8E6)
+DOUBLE_BYTE_PAIR(0x8FA0, 0xB8E7)
+DOUBLE_BYTE_PAIR(0x8FA1, 0xB8EA)
+DOUBLE_BYTE_PAIR(0x8FA2, 0xB8EB)
+DOUBLE_BYTE_PAIR(0x8FA3, 0xB8ED)
+DOUBLE_BYTE_PAIR(0x8FA4, 0xB8EE)
+DOUBLE_BYTE_PAIR(0x8FA5, 0xB8EF)
+DOUBLE_BYTE_PAIR(0x8FA6, 0xB8F1)
+DOUBLE_BYTE_PAIR(0x8FA7, 0xB8F2)
+DOUBLE_BYTE_PAIR(0x8FA8, 0xB8F3)
+DOUBLE_BYTE_PAIR(0x8FA9, 0xB8F4)
+DOUBLE_BYTE_PAIR(0x8FAA, 0xB8F5)
+DOUBLE_BYTE_PAIR(0x8FAB, 0xB8F6)
+DOUBLE_BYTE_PAIR(0x8FAC, 0xB8F7)
+DOUBLE_BYTE_PAIR(0x8FAD, 0xB8FA)
+DOUBLE_BYTE_PAIR(0x8FAE, 0xB8FC)
+DOUBLE_BYTE_PAIR(0x8FAF, 0xB8FE)
+DOUBLE_BYTE_PAIR(0x8FB0, 0xB8FF)
+DOUBLE_BYTE_PAIR(0x8FB1, 0xB900)
+DOUBLE_BYTE_PAIR(0x8FB2, 0xB901)
+DOUBLE_BYTE_PAIR(0x8FB3, 0xB902)
+DOUBLE_BYTE_PAIR(0x8FB4, 0xB903)
+DOUBLE_BYTE_PAIR(0x8FB5, 0xB905)
+DOUBLE_BYTE_PAIR(0x8FB6, 0xB906)
+DOUBLE_BYTE_PAIR(0x8FB7, 0xB907)
+DOUBLE_BYTE_PAIR(0x8FB8, 0xB908)
+DOUBLE_BYTE_PAIR(0x8FB9, 0xB909)
+DOUBLE_BYTE_PAIR(0x8FBA, 0xB90A)
+DOUBLE_BYTE_PAIR(0x8FBB, 0xB90B)
+DOUBLE_BYTE_PAIR(0x8FBC, 0xB90C)
+DOUBLE_BYTE_PAIR(0x8FBD, 0xB90D)
+DOUBLE_BYTE_PAIR(0x8FBE, 0xB90E)
+DOUBLE_BYTE_PAIR(0x8FBF, 0xB90F)
+DOUBLE_BYTE_PAIR(0x8FC0, 0xB910)
+DOUBLE_BYTE_PAIR(0x8FC1, 0xB911)
+DOUBLE_BYTE_PAIR(0x8FC2, 0xB912)
+DOUBLE_BYTE_PAIR(0x8FC3, 0xB913)
+DOUBLE_BYTE_PAIR(0x8FC4, 0xB914)
+DOUBLE_BYTE_PAIR(0x8FC5, 0xB915)
+DOUBLE_BYTE_PAIR(0x8FC6, 0xB916)
+DOUBLE_BYTE_PAIR(0x8FC7, 0xB917)
+DOUBLE_BYTE_PAIR(0x8FC8, 0xB919)
+DOUBLE_BYTE_PAIR(0x8FC9, 0xB91A)
+DOUBLE_BYTE_PAIR(0x8FCA, 0xB91B)
+DOUBLE_BYTE_PAIR(0x8FCB, 0xB91C)
+DOUBLE_BYTE_PAIR(0x8FCC, 0xB91D)
+DOUBLE_BYTE_PAIR(0x8FCD, 0xB91E)
+DOUBLE_BYTE_PAIR(0x8FCE, 0xB91F)
+DOUBLE_BYTE_PAIR(0x8FCF, 0xB921)
+DOUBLE_BYTE_PAIR(0x8FD0, 0xB922)
+DOUBLE_BYTE_PAIR(0x8FD1, 0xB923)
+DOUBLE_BYTE_PAIR(0x8FD2, 0xB924)
+DOUBLE_BYTE_PAIR(0x8FD3, 0xB925)
+DOUBLE_BYTE_PAIR(0x8FD4, 0xB926)
+DOUBLE_BYTE_PAIR(0x8FD5, 0xB927)
+DOUBLE_BYTE_PAIR(0x8FD6, 0xB928)
+DOUBLE_BYTE_PAIR(0x8FD7, 0xB929)
+DOUBLE_BYTE_PAIR(0x8FD8, 0xB92A)
+DOUBLE_BYTE_PAIR(0x8FD9, 0xB92B)
+DOUBLE_BYTE_PAIR(0x8FDA, 0xB92C)
+DOUBLE_BYTE_PAIR(0x8FDB, 0xB92D)
+DOUBLE_BYTE_PAIR(0x8FDC, 0xB92E)
+DOUBLE_BYTE_PAIR(0x8FDD, 0xB92F)
+DOUBLE_BYTE_PAIR(0x8FDE, 0xB930)
+DOUBLE_BYTE_PAIR(0x8FDF, 0xB931)
+DOUBLE_BYTE_PAIR(0x8FE0, 0xB932)
+DOUBLE_BYTE_PAIR(0x8FE1, 0xB933)
+DOUBLE_BYTE_PAIR(0x8FE2, 0xB934)
+DOUBLE_BYTE_PAIR(0x8FE3, 0xB935)
+DOUBLE_BYTE_PAIR(0x8FE4, 0xB936)
+DOUBLE_BYTE_PAIR(0x8FE5, 0xB937)
+DOUBLE_BYTE_PAIR(0x8FE6, 0xB938)
+DOUBLE_BYTE_PAIR(0x8FE7, 0xB939)
+DOUBLE_BYTE_PAIR(0x8FE8, 0xB93A)
+DOUBLE_BYTE_PAIR(0x8FE9, 0xB93B)
+DOUBLE_BYTE_PAIR(0x8FEA, 0xB93E)
+DOUBLE_BYTE_PAIR(0x8FEB, 0xB93F)
+DOUBLE_BYTE_PAIR(0x8FEC, 0xB941)
+DOUBLE_BYTE_PAIR(0x8FED, 0xB942)
+DOUBLE_BYTE_PAIR(0x8FEE, 0xB943)
+DOUBLE_BYTE_PAIR(0x8FEF, 0xB945)
+DOUBLE_BYTE_PAIR(0x8FF0, 0xB946)
+DOUBLE_BYTE_PAIR(0x8FF1, 0xB947)
+DOUBLE_BYTE_PAIR(0x8FF2, 0xB948)
+DOUBLE_BYTE_PAIR(0x8FF3, 0xB949)
+DOUBLE_BYTE_PAIR(0x8FF4, 0xB94A)
+DOUBLE_BYTE_PAIR(0x8FF5, 0xB94B)
+DOUBLE_BYTE_PAIR(0x8FF6, 0xB94D)
+DOUBLE_BYTE_PAIR(0x8FF7, 0xB94E)
+DOUBLE_BYTE_PAIR(0x8FF8, 0xB950)
+DOUBLE_BYTE_PAIR(0x8FF9, 0xB952)
+DOUBLE_BYTE_PAIR(0x8FFA, 0xB953)
+DOUBLE_BYTE_PAIR(0x8FFB, 0xB954)
+DOUBLE_BYTE_PAIR(0x8FFC, 0xB955)
+DOUBLE_BYTE_PAIR(0x8FFD, 0xB956)
+DOUBLE_BYTE_PAIR(0x8FFE, 0xB957)
+DOUBLE_BYTE_PAIR(0x9041, 0xB95A)
+DOUBLE_BYTE_PAIR(0x9042, 0xB95B)
+DOUBLE_BYTE_PAIR(0x9043, 0xB95D)
+DOUBLE_BYTE_PAIR(0x9044, 0xB95E)
+DOUBLE_BYTE_PAIR(0x9045, 0xB95F)
+DOUBLE_BYTE_PAIR(0x9046, 0xB961)
+DOUBLE_BYTE_PAIR(0x9047, 0xB962)
+DOUBLE_BYTE_PAIR(0x9048, 0xB963)
+DOUBLE_BYTE_PAIR(0x9049, 0xB964)
+DOUBLE_BYTE_PAIR(0x904A, 0xB965)
+DOUBLE_BYTE_PAIR(0x904B, 0xB966)
+DOUBLE_BYTE_PAIR(0x904C, 0xB967)
+DOUBLE_BYTE_PAIR(0x904D, 0xB96A)
+DOUBLE_BYTE_PAIR(0x904E, 0xB96C)
+DOUBLE_BYTE_PAIR(0x904F, 0xB96E)
+DOUBLE_BYTE_PAIR(0x9050, 0xB96F)
+DOUBLE_BYTE_PAIR(0x9051, 0xB970)
+DOUBLE_BYTE_PAIR(0x9052, 0xB971)
+DOUBLE_BYTE_PAIR(0x9053, 0xB972)
+DOUBLE_BYTE_PAIR(0x9054, 0xB973)
+DOUBLE_BYTE_PAIR(0x9055, 0xB976)
+DOUBLE_BYTE_PAIR(0x9056, 0xB977)
+DOUBLE_BYTE_PAIR(0x9057, 0xB979)
+DOUBLE_BYTE_PAIR(0x9058, 0xB97A)
+DOUBLE_BYTE_PAIR(0x9059, 0xB97B)
+DOUBLE_BYTE_PAIR(0x905A, 0xB97D)
+DOUBLE_BYTE_PAIR(0x9061, 0xB97E)
+DOUBLE_BYTE_PAIR(0x9062, 0xB97F)
+DOUBLE_BYTE_PAIR(0x9063, 0xB980)
+DOUBLE_BYTE_PAIR(0x9064, 0xB981)
+DOUBLE_BYTE_PAIR(0x9065, 0xB982)
+DOUBLE_BYTE_PAIR(0x9066, 0xB983)
+DOUBLE_BYTE_PAIR(0x9067, 0xB986)
+DOUBLE_BYTE_PAIR(0x9068, 0xB988)
+DOUBLE_BYTE_PAIR(0x9069, 0xB98B)
+DOUBLE_BYTE_PAIR(0x906A, 0xB98C)
+DOUBLE_BYTE_PAIR(0x906B, 0xB98F)
+DOUBLE_BYTE_PAIR(0x906C, 0xB990)
+DOUBLE_BYTE_PAIR(0x906D, 0xB991)
+DOUBLE_BYTE_PAIR(0x906E, 0xB992)
+DOUBLE_BYTE_PAIR(0x906F, 0xB993)
+DOUBLE_BYTE_PAIR(0x9070, 0xB994)
+DOUBLE_BYTE_PAIR(0x9071, 0xB995)
+DOUBLE_BYTE_PAIR(0x9072, 0xB996)
+DOUBLE_BYTE_PAIR(0x9073, 0xB997)
+DOUBLE_BYTE_PAIR(0x9074, 0xB998)
+DOUBLE_BYTE_PAIR(0x9075, 0xB999)
+DOUBLE_BYTE_PAIR(0x9076, 0xB99A)
+DOUBLE_BYTE_PAIR(0x9077, 0xB99B)
+DOUBLE_BYTE_PAIR(0x9078, 0xB99C)
+DOUBLE_BYTE_PAIR(0x9079, 0xB99D)
+DOUBLE_BYTE_PAIR(0x907A, 0xB99E)
+DOUBLE_BYTE_PAIR(0x9081, 0xB99F)
+DOUBLE_BYTE_PAIR(0x9082, 0xB9A0)
+DOUBLE_BYTE_PAIR(0x9083, 0xB9A1)
+DOUBLE_BYTE_PAIR(0x9084, 0xB9A2)
+DOUBLE_BYTE_PAIR(0x9085, 0xB9A3)
+DOUBLE_BYTE_PAIR(0x9086, 0xB9A4)
+DOUBLE_BYTE_PAIR(0x9087, 0xB9A5)
+DOUBLE_BYTE_PAIR(0x9088, 0xB9A6)
+DOUBLE_BYTE_PAIR(0x9089, 0xB9A7)
+DOUBLE_BYTE_PAIR(0x908A, 0xB9A8)
+DOUBLE_BYTE_PAIR(0x908B, 0xB9A9)
+DOUBLE_BYTE_PAIR(0x908C, 0xB9AA)
+DOUBLE_BYTE_PAIR(0x908D, 0xB9AB)
+DOUBLE_BYTE_PAIR(0x908E, 0xB9AE)
+DOUBLE_BYTE_PAIR(0x908F, 0xB9AF)
+DOUBLE_BYTE_PAIR(0x9090, 0xB9B1)
+DOUBLE_BYTE_PAIR(0x9091, 0xB9B2)
+DOUBLE_BYTE_PAIR(0x9092, 0xB9B3)
+DOUBLE_BYTE_PAIR(0x9093, 0xB9B5)
+DOUBLE_BYTE_PAIR(0x9094, 0xB9B6)
+DOUBLE_BYTE_PAIR(0x9095, 0xB9B7)
+DOUBLE_BYTE_PAIR(0x9096, 0xB9B8)
+DOUBLE_BYTE_PAIR(0x9097, 0xB9B9)
+DOUBLE_BYTE_PAIR(0x9098, 0xB9BA)
+DOUBLE_BYTE_PAIR(0x9099, 0xB9BB)
+DOUBLE_BYTE_PAIR(0x909A, 0xB9BE)
+DOUBLE_BYTE_PAIR(0x909B, 0xB9C0)
+DOUBLE_BYTE_PAIR(0x909C, 0xB9C2)
+DOUBLE_BYTE_PAIR(0x909D, 0xB9C3)
+DOUBLE_BYTE_PAIR(0x909E, 0xB9C4)
+DOUBLE_BYTE_PAIR(0x909F, 0xB9C5)
+DOUBLE_BYTE_PAIR(0x90A0, 0xB9C6)
+DOUBLE_BYTE_PAIR(0x90A1, 0xB9C7)
+DOUBLE_BYTE_PAIR(0x90A2, 0xB9CA)
+DOUBLE_BYTE_PAIR(0x90A3, 0xB9CB)
+DOUBLE_BYTE_PAIR(0x90A4, 0xB9CD)
+DOUBLE_BYTE_PAIR(0x90A5, 0xB9D3)
+DOUBLE_BYTE_PAIR(0x90A6, 0xB9D4)
+DOUBLE_BYTE_PAIR(0x90A7, 0xB9D5)
+DOUBLE_BYTE_PAIR(0x90A8, 0xB9D6)
+DOUBLE_BYTE_PAIR(0x90A9, 0xB9D7)
+DOUBLE_BYTE_PAIR(0x90AA, 0xB9DA)
+DOUBLE_BYTE_PAIR(0x90AB, 0xB9DC)
+DOUBLE_BYTE_PAIR(0x90AC, 0xB9DF)
+DOUBLE_BYTE_PAIR(0x90AD, 0xB9E0)
+DOUBLE_BYTE_PAIR(0x90AE, 0xB9E2)
+DOUBLE_BYTE_PAIR(0x90AF, 0xB9E6)
+DOUBLE_BYTE_PAIR(0x90B0, 0xB9E7)
+DOUBLE_BYTE_PAIR(0x90B1, 0xB9E9)
+DOUBLE_BYTE_PAIR(0x90B2, 0xB9EA)
+DOUBLE_BYTE_PAIR(0x90B3, 0xB9EB)
+DOUBLE_BYTE_PAIR(0x90B4, 0xB9ED)
+DOUBLE_BYTE_PAIR(0x90B5, 0xB9EE)
+DOUBLE_BYTE_PAIR(0x90B6, 0xB9EF)
+DOUBLE_BYTE_PAIR(0x90B7, 0xB9F0)
+DOUBLE_BYTE_PAIR(0x90B8, 0xB9F1)
+DOUBLE_BYTE_PAIR(0x90B9, 0xB9F2)
+DOUBLE_BYTE_PAIR(0x90BA, 0xB9F3)
+DOUBLE_BYTE_PAIR(0x90BB, 0xB9F6)
+DOUBLE_BYTE_PAIR(0x90BC, 0xB9FB)
+DOUBLE_BYTE_PAIR(0x90BD, 0xB9FC)
+DOUBLE_BYTE_PAIR(0x90BE, 0xB9FD)
+DOUBLE_BYTE_PAIR(0x90BF, 0xB9FE)
+DOUBLE_BYTE_PAIR(0x90C0, 0xB9FF)
+DOUBLE_BYTE_PAIR(0x90C1, 0xBA02)
+DOUBLE_BYTE_PAIR(0x90C2, 0xBA03)
+DOUBLE_BYTE_PAIR(0x90C3, 0xBA04)
+DOUBLE_BYTE_PAIR(0x90C4, 0xBA05)
+DOUBLE_BYTE_PAIR(0x90C5, 0xBA06)
+DOUBLE_BYTE_PAIR(0x90C6, 0xBA07)
+DOUBLE_BYTE_PAIR(0x90C7, 0xBA09)
+DOUBLE_BYTE_PAIR(0x90C8, 0xBA0A)
+DOUBLE_BYTE_PAIR(0x90C9, 0xBA0B)
+DOUBLE_BYTE_PAIR(0x90CA, 0xBA0C)
+DOUBLE_BYTE_PAIR(0x90CB, 0xBA0D)
+DOUBLE_BYTE_PAIR(0x90CC, 0xBA0E)
+DOUBLE_BYTE_PAIR(0x90CD, 0xBA0F)
+DOUBLE_BYTE_PAIR(0x90CE, 0xBA10)
+DOUBLE_BYTE_PAIR(0x90CF, 0xBA11)
+DOUBLE_BYTE_PAIR(0x90D0, 0xBA12)
+DOUBLE_BYTE_PAIR(0x90D1, 0xBA13)
+DOUBLE_BYTE_PAIR(0x90D2, 0xBA14)
+DOUBLE_BYTE_PAIR(0x90D3, 0xBA16)
+DOUBLE_BYTE_PAIR(0x90D4, 0xBA17)
+DOUBLE_BYTE_PAIR(0x90D5, 0xBA18)
+DOUBLE_BYTE_PAIR(0x90D6, 0xBA19)
+DOUBLE_BYTE_PAIR(0x90D7, 0xBA1A)
+DOUBLE_BYTE_PAIR(0x90D8, 0xBA1B)
+DOUBLE_BYTE_PAIR(0x90D9, 0xBA1C)
+DOUBLE_BYTE_PAIR(0x90DA, 0xBA1D)
+DOUBLE_BYTE_PAIR(0x90DB, 0xBA1E)
+DOUBLE_BYTE_PAIR(0x90DC, 0xBA1F)
+DOUBLE_BYTE_PAIR(0x90DD, 0xBA20)
+DOUBLE_BYTE_PAIR(0x90DE, 0xBA21)
+DOUBLE_BYTE_PAIR(0x90DF, 0xBA22)
+DOUBLE_BYTE_PAIR(0x90E0, 0xBA23)
+DOUBLE_BYTE_PAIR(0x90E1, 0xBA24)
+DOUBLE_BYTE_PAIR(0x90E2, 0xBA25)
+DOUBLE_BYTE_PAIR(0x90E3, 0xBA26)
+DOUBLE_BYTE_PAIR(0x90E4, 0xBA27)
+DOUBLE_BYTE_PAIR(0x90E5, 0xBA28)
+DOUBLE_BYTE_PAIR(0x90E6, 0xBA29)
+DOUBLE_BYTE_PAIR(0x90E7, 0xBA2A)
+DOUBLE_BYTE_PAIR(0x90E8, 0xBA2B)
+DOUBLE_BYTE_PAIR(0x90E9, 0xBA2C)
+DOUBLE_BYTE_PAIR(0x90EA, 0xBA2D)
+DOUBLE_BYTE_PAIR(0x90EB, 0xBA2E)
+DOUBLE_BYTE_PAIR(0x90EC, 0xBA2F)
+DOUBLE_BYTE_PAIR(0x90ED, 0xBA30)
+DOUBLE_BYTE_PAIR(0x90EE, 0xBA31)
+DOUBLE_BYTE_PAIR(0x90EF, 0xBA32)
+DOUBLE_BYTE_PAIR(0x90F0, 0xBA33)
+DOUBLE_BYTE_PAIR(0x90F1, 0xBA34)
+DOUBLE_BYTE_PAIR(0x90F2, 0xBA35)
+DOUBLE_BYTE_PAIR(0x90F3, 0xBA36)
+DOUBLE_BYTE_PAIR(0x90F4, 0xBA37)
+DOUBLE_BYTE_PAIR(0x90F5, 0xBA3A)
+DOUBLE_BYTE_PAIR(0x90F6, 0xBA3B)
+DOUBLE_BYTE_PAIR(0x90F7, 0xBA3D)
+DOUBLE_BYTE_PAIR(0x90F8, 0xBA3E)
+DOUBLE_BYTE_PAIR(0x90F9, 0xBA3F)
+DOUBLE_BYTE_PAIR(0x90FA, 0xBA41)
+DOUBLE_BYTE_PAIR(0x90FB, 0xBA43)
+DOUBLE_BYTE_PAIR(0x90FC, 0xBA44)
+DOUBLE_BYTE_PAIR(0x90FD, 0xBA45)
+DOUBLE_BYTE_PAIR(0x90FE, 0xBA46)
+DOUBLE_BYTE_PAIR(0x9141, 0xBA47)
+DOUBLE_BYTE_PAIR(0x9142, 0xBA4A)
+DOUBLE_BYTE_PAIR(0x9143, 0xBA4C)
+DOUBLE_BYTE_PAIR(0x9144, 0xBA4F)
+DOUBLE_BYTE_PAIR(0x9145, 0xBA50)
+DOUBLE_BYTE_PAIR(0x9146, 0xBA51)
+DOUBLE_BYTE_PAIR(0x9147, 0xBA52)
+DOUBLE_BYTE_PAIR(0x9148, 0xBA56)
+DOUBLE_BYTE_PAIR(0x9149, 0xBA57)
+DOUBLE_BYTE_PAIR(0x914A, 0xBA59)
+DOUBLE_BYTE_PAIR(0x914B, 0xBA5A)
+DOUBLE_BYTE_PAIR(0x914C, 0xBA5B)
+DOUBLE_BYTE_PAIR(0x914D, 0xBA5D)
+DOUBLE_BYTE_PAIR(0x914E, 0xBA5E)
+DOUBLE_BYTE_PAIR(0x914F, 0xBA5F)
+DOUBLE_BYTE_PAIR(0x9150, 0xBA60)
+DOUBLE_BYTE_PAIR(0x9151, 0xBA61)
+DOUBLE_BYTE_PAIR(0x9152, 0xBA62)
+DOUBLE_BYTE_PAIR(0x9153, 0xBA63)
+DOUBLE_BYTE_PAIR(0x9154, 0xBA66)
+DOUBLE_BYTE_PAIR(0x9155, 0xBA6A)
+DOUBLE_BYTE_PAIR(0x9156, 0xBA6B)
+DOUBLE_BYTE_PAIR(0x9157, 0xBA6C)
+DOUBLE_BYTE_PAIR(0x9158, 0xBA6D)
+DOUBLE_BYTE_PAIR(0x9159, 0xBA6E)
+DOUBLE_BYTE_PAIR(0x915A, 0xBA6F)
+DOUBLE_BYTE_PAIR(0x9161, 0xBA72)
+DOUBLE_BYTE_PAIR(0x9162, 0xBA73)
+DOUBLE_BYTE_PAIR(0x9163, 0xBA75)
+DOUBLE_BYTE_PAIR(0x9164, 0xBA76)
+DOUBLE_BYTE_PAIR(0x9165, 0xBA77)
+DOUBLE_BYTE_PAIR(0x9166, 0xBA79)
+DOUBLE_BYTE_PAIR(0x9167, 0xBA7A)
+DOUBLE_BYTE_PAIR(0x9168, 0xBA7B)
+DOUBLE_BYTE_PAIR(0x9169, 0xBA7C)
+DOUBLE_BYTE_PAIR(0x916A, 0xBA7D)
+DOUBLE_BYTE_PAIR(0x916B, 0xBA7E)
+DOUBLE_BYTE_PAIR(0x916C, 0xBA7F)
+DOUBLE_BYTE_PAIR(0x916D, 0xBA80)
+DOUBLE_BYTE_PAIR(0x916E, 0xBA81)
+DOUBLE_BYTE_PAIR(0x916F, 0xBA82)
+DOUBLE_BYTE_PAIR(0x9170, 0xBA86)
+DOUBLE_BYTE_PAIR(0x9171, 0xBA88)
+DOUBLE_BYTE_PAIR(0x9172, 0xBA89)
+DOUBLE_BYTE_PAIR(0x9173, 0xBA8A)
+DOUBLE_BYTE_PAIR(0x9174, 0xBA8B)
+DOUBLE_BYTE_PAIR(0x9175, 0xBA8D)
+DOUBLE_BYTE_PAIR(0x9176, 0xBA8E)
+DOUBLE_BYTE_PAIR(0x9177, 0xBA8F)
+DOUBLE_BYTE_PAIR(0x9178, 0xBA90)
+DOUBLE_BYTE_PAIR(0x9179, 0xBA91)
+DOUBLE_BYTE_PAIR(0x917A, 0xBA92)
+DOUBLE_BYTE_PAIR(0x9181, 0xBA93)
+DOUBLE_BYTE_PAIR(0x9182, 0xBA94)
+DOUBLE_BYTE_PAIR(0x9183, 0xBA95)
+DOUBLE_BYTE_PAIR(0x9184, 0xBA96)
+DOUBLE_BYTE_PAIR(0x9185, 0xBA97)
+DOUBLE_BYTE_PAIR(0x9186, 0xBA98)
+DOUBLE_BYTE_PAIR(0x9187, 0xBA99)
+DOUBLE_BYTE_PAIR(0x9188, 0xBA9A)
+DOUBLE_BYTE_PAIR(0x9189, 0xBA9B)
+DOUBLE_BYTE_PAIR(0x918A, 0xBA9C)
+DOUBLE_BYTE_PAIR(0x918B, 0xBA9D)
+DOUBLE_BYTE_PAIR(0x918C, 0xBA9E)
+DOUBLE_BYTE_PAIR(0x918D, 0xBA9F)
+DOUBLE_BYTE_PAIR(0x918E, 0xBAA0)
+DOUBLE_BYTE_PAIR(0x918F, 0xBAA1)
+DOUBLE_BYTE_PAIR(0x9190, 0xBAA2)
+DOUBLE_BYTE_PAIR(0x9191, 0xBAA3)
+DOUBLE_BYTE_PAIR(0x9192, 0xBAA4)
+DOUBLE_BYTE_PAIR(0x9193, 0xBAA5)
+DOUBLE_BYTE_PAIR(0x9194, 0xBAA6)
+DOUBLE_BYTE_PAIR(0x9195, 0xBAA7)
+DOUBLE_BYTE_PAIR(0x9196, 0xBAAA)
+DOUBLE_BYTE_PAIR(0x9197, 0xBAAD)
+DOUBLE_BYTE_PAIR(0x9198, 0xBAAE)
+DOUBLE_BYTE_PAIR(0x9199, 0xBAAF)
+DOUBLE_BYTE_PAIR(0x919A, 0xBAB1)
+DOUBLE_BYTE_PAIR(0x919B, 0xBAB3)
+DOUBLE_BYTE_PAIR(0x919C, 0xBAB4)
+DOUBLE_BYTE_PAIR(0x919D, 0xBAB5)
+DOUBLE_BYTE_PAIR(0x919E, 0xBAB6)
+DOUBLE_BYTE_PAIR(0x919F, 0xBAB7)
+DOUBLE_BYTE_PAIR(0x91A0, 0xBABA)
+DOUBLE_BYTE_PAIR(0x91A1, 0xBABC)
+DOUBLE_BYTE_PAIR(0x91A2, 0xBABE)
+DOUBLE_BYTE_PAIR(0x91A3, 0xBABF)
+DOUBLE_BYTE_PAIR(0x91A4, 0xBAC0)
+DOUBLE_BYTE_PAIR(0x91A5, 0xBAC1)
+DOUBLE_BYTE_PAIR(0x91A6, 0xBAC2)
+DOUBLE_BYTE_PAIR(0x91A7, 0xBAC3)
+DOUBLE_BYTE_PAIR(0x91A8, 0xBAC5)
+DOUBLE_BYTE_PAIR(0x91A9, 0xBAC6)
+DOUBLE_BYTE_PAIR(0x91AA, 0xBAC7)
+DOUBLE_BYTE_PAIR(0x91AB, 0xBAC9)
+DOUBLE_BYTE_PAIR(0x91AC, 0xBACA)
+DOUBLE_BYTE_PAIR(0x91AD, 0xBACB)
+DOUBLE_BYTE_PAIR(0x91AE, 0xBACC)
+DOUBLE_BYTE_PAIR(0x91AF, 0xBACD)
+DOUBLE_BYTE_PAIR(0x91B0, 0xBACE)
+DOUBLE_BYTE_PAIR(0x91B1, 0xBACF)
+DOUBLE_BYTE_PAIR(0x91B2, 0xBAD0)
+DOUBLE_BYTE_PAIR(0x91B3, 0xBAD1)
+DOUBLE_BYTE_PAIR(0x91B4, 0xBAD2)
+DOUBLE_BYTE_PAIR(0x91B5, 0xBAD3)
+DOUBLE_BYTE_PAIR(0x91B6, 0xBAD4)
+DOUBLE_BYTE_PAIR(0x91B7, 0xBAD5)
+DOUBLE_BYTE_PAIR(0x91B8, 0xBAD6)
+DOUBLE_BYTE_PAIR(0x91B9, 0xBAD7)
+DOUBLE_BYTE_PAIR(0x91BA, 0xBADA)
+DOUBLE_BYTE_PAIR(0x91BB, 0xBADB)
+DOUBLE_BYTE_PAIR(0x91BC, 0xBADC)
+DOUBLE_BYTE_PAIR(0x91BD, 0xBADD)
+DOUBLE_BYTE_PAIR(0x91BE, 0xBADE)
+DOUBLE_BYTE_PAIR(0x91BF, 0xBADF)
+DOUBLE_BYTE_PAIR(0x91C0, 0xBAE0)
+DOUBLE_BYTE_PAIR(0x91C1, 0xBAE1)
+DOUBLE_BYTE_PAIR(0x91C2, 0xBAE2)
+DOUBLE_BYTE_PAIR(0x91C3, 0xBAE3)
+DOUBLE_BYTE_PAIR(0x91C4, 0xBAE4)
+DOUBLE_BYTE_PAIR(0x91C5, 0xBAE5)
+DOUBLE_BYTE_PAIR(0x91C6, 0xBAE6)
+DOUBLE_BYTE_PAIR(0x91C7, 0xBAE7)
+DOUBLE_BYTE_PAIR(0x91C8, 0xBAE8)
+DOUBLE_BYTE_PAIR(0x91C9, 0xBAE9)
+DOUBLE_BYTE_PAIR(0x91CA, 0xBAEA)
+DOUBLE_BYTE_PAIR(0x91CB, 0xBAEB)
+DOUBLE_BYTE_PAIR(0x91CC, 0xBAEC)
+DOUBLE_BYTE_PAIR(0x91CD, 0xBAED)
+DOUBLE_BYTE_PAIR(0x91CE, 0xBAEE)
+DOUBLE_BYTE_PAIR(0x91CF, 0xBAEF)
+DOUBLE_BYTE_PAIR(0x91D0, 0xBAF0)
+DOUBLE_BYTE_PAIR(0x91D1, 0xBAF1)
+DOUBLE_BYTE_PAIR(0x91D2, 0xBAF2)
+DOUBLE_BYTE_PAIR(0x91D3, 0xBAF3)
+DOUBLE_BYTE_PAIR(0x91D4, 0xBAF4)
+DOUBLE_BYTE_PAIR(0x91D5, 0xBAF5)
+DOUBLE_BYTE_PAIR(0x91D6, 0xBAF6)
+DOUBLE_BYTE_PAIR(0x91D7, 0xBAF7)
+DOUBLE_BYTE_PAIR(0x91D8, 0xBAF8)
+DOUBLE_BYTE_PAIR(0x91D9, 0xBAF9)
+DOUBLE_BYTE_PAIR(0x91DA, 0xBAFA)
+DOUBLE_BYTE_PAIR(0x91DB, 0xBAFB)
+DOUBLE_BYTE_PAIR(0x91DC, 0xBAFD)
+DOUBLE_BYTE_PAIR(0x91DD, 0xBAFE)
+DOUBLE_BYTE_PAIR(0x91DE, 0xBAFF)
+DOUBLE_BYTE_PAIR(0x91DF, 0xBB01)
+DOUBLE_BYTE_PAIR(0x91E0, 0xBB02)
+DOUBLE_BYTE_PAIR(0x91E1, 0xBB03)
+DOUBLE_BYTE_PAIR(0x91E2, 0xBB05)
+DOUBLE_BYTE_PAIR(0x91E3, 0xBB06)
+DOUBLE_BYTE_PAIR(0x91E4, 0xBB07)
+DOUBLE_BYTE_PAIR(0x91E5, 0xBB08)
+DOUBLE_BYTE_PAIR(0x91E6, 0xBB09)
+DOUBLE_BYTE_PAIR(0x91E7, 0xBB0A)
+DOUBLE_BYTE_PAIR(0x91E8, 0xBB0B)
+DOUBLE_BYTE_PAIR(0x91E9, 0xBB0C)
+DOUBLE_BYTE_PAIR(0x91EA, 0xBB0E)
+DOUBLE_BYTE_PAIR(0x91EB, 0xBB10)
+DOUBLE_BYTE_PAIR(0x91EC, 0xBB12)
+DOUBLE_BYTE_PAIR(0x91ED, 0xBB13)
+DOUBLE_BYTE_PAIR(0x91EE, 0xBB14)
+DOUBLE_BYTE_PAIR(0x91EF, 0xBB15)
+DOUBLE_BYTE_PAIR(0x91F0, 0xBB16)
+DOUBLE_BYTE_PAIR(0x91F1, 0xBB17)
+DOUBLE_BYTE_PAIR(0x91F2, 0xBB19)
+DOUBLE_BYTE_PAIR(0x91F3, 0xBB1A)
+DOUBLE_BYTE_PAIR(0x91F4, 0xBB1B)
+DOUBLE_BYTE_PAIR(0x91F5, 0xBB1D)
+DOUBLE_BYTE_PAIR(0x91F6, 0xBB1E)
+DOUBLE_BYTE_PAIR(0x91F7, 0xBB1F)
+DOUBLE_BYTE_PAIR(0x91F8, 0xBB21)
+DOUBLE_BYTE_PAIR(0x91F9, 0xBB22)
+DOUBLE_BYTE_PAIR(0x91FA, 0xBB23)
+DOUBLE_BYTE_PAIR(0x91FB, 0xBB24)
+DOUBLE_BYTE_PAIR(0x91FC, 0xBB25)
+DOUBLE_BYTE_PAIR(0x91FD, 0xBB26)
+DOUBLE_BYTE_PAIR(0x91FE, 0xBB27)
+DOUBLE_BYTE_PAIR(0x9241, 0xBB28)
+DOUBLE_BYTE_PAIR(0x9242, 0xBB2A)
+DOUBLE_BYTE_PAIR(0x9243, 0xBB2C)
+DOUBLE_BYTE_PAIR(0x9244, 0xBB2D)
+DOUBLE_BYTE_PAIR(0x9245, 0xBB2E)
+DOUBLE_BYTE_PAIR(0x9246, 0xBB2F)
+DOUBLE_BYTE_PAIR(0x9247, 0xBB30)
+DOUBLE_BYTE_PAIR(0x9248, 0xBB31)
+DOUBLE_BYTE_PAIR(0x9249, 0xBB32)
+DOUBLE_BYTE_PAIR(0x924A, 0xBB33)
+DOUBLE_BYTE_PAIR(0x924B, 0xBB37)
+DOUBLE_BYTE_PAIR(0x924C, 0xBB39)
+DOUBLE_BYTE_PAIR(0x924D, 0xBB3A)
+DOUBLE_BYTE_PAIR(0x924E, 0xBB3F)
+DOUBLE_BYTE_PAIR(0x924F, 0xBB40)
+DOUBLE_BYTE_PAIR(0x9250, 0xBB41)
+DOUBLE_BYTE_PAIR(0x9251, 0xBB42)
+DOUBLE_BYTE_PAIR(0x9252, 0xBB43)
+DOUBLE_BYTE_PAIR(0x9253, 0xBB46)
+DOUBLE_BYTE_PAIR(0x9254, 0xBB48)
+DOUBLE_BYTE_PAIR(0x9255, 0xBB4A)
+DOUBLE_BYTE_PAIR(0x9256, 0xBB4B)
+DOUBLE_BYTE_PAIR(0x9257, 0xBB4C)
+DOUBLE_BYTE_PAIR(0x9258, 0xBB4E)
+DOUBLE_BYTE_PAIR(0x9259, 0xBB51)
+DOUBLE_BYTE_PAIR(0x925A, 0xBB52)
+DOUBLE_BYTE_PAIR(0x9261, 0xBB53)
+DOUBLE_BYTE_PAIR(0x9262, 0xBB55)
+DOUBLE_BYTE_PAIR(0x9263, 0xBB56)
+DOUBLE_BYTE_PAIR(0x9264, 0xBB57)
+DOUBLE_BYTE_PAIR(0x9265, 0xBB59)
+DOUBLE_BYTE_PAIR(0x9266, 0xBB5A)
+DOUBLE_BYTE_PAIR(0x9267, 0xBB5B)
+DOUBLE_BYTE_PAIR(0x9268, 0xBB5C)
+DOUBLE_BYTE_PAIR(0x9269, 0xBB5D)
+DOUBLE_BYTE_PAIR(0x926A, 0xBB5E)
+DOUBLE_BYTE_PAIR(0x926B, 0xBB5F)
+DOUBLE_BYTE_PAIR(0x926C, 0xBB60)
+DOUBLE_BYTE_PAIR(0x926D, 0xBB62)
+DOUBLE_BYTE_PAIR(0x926E, 0xBB64)
+DOUBLE_BYTE_PAIR(0x926F, 0xBB65)
+DOUBLE_BYTE_PAIR(0x9270, 0xBB66)
+DOUBLE_BYTE_PAIR(0x9271, 0xBB67)
+DOUBLE_BYTE_PAIR(0x9272, 0xBB68)
+DOUBLE_BYTE_PAIR(0x9273, 0xBB69)
+DOUBLE_BYTE_PAIR(0x9274, 0xBB6A)
+DOUBLE_BYTE_PAIR(0x9275, 0xBB6B)
+DOUBLE_BYTE_PAIR(0x9276, 0xBB6D)
+DOUBLE_BYTE_PAIR(0x9277, 0xBB6E)
+DOUBLE_BYTE_PAIR(0x9278, 0xBB6F)
+DOUBLE_BYTE_PAIR(0x9279, 0xBB70)
+DOUBLE_BYTE_PAIR(0x927A, 0xBB71)
+DOUBLE_BYTE_PAIR(0x9281, 0xBB72)
+DOUBLE_BYTE_PAIR(0x9282, 0xBB73)
+DOUBLE_BYTE_PAIR(0x9283, 0xBB74)
+DOUBLE_BYTE_PAIR(0x9284, 0xBB75)
+DOUBLE_BYTE_PAIR(0x9285, 0xBB76)
+DOUBLE_BYTE_PAIR(0x9286, 0xBB77)
+DOUBLE_BYTE_PAIR(0x9287, 0xBB78)
+DOUBLE_BYTE_PAIR(0x9288, 0xBB79)
+DOUBLE_BYTE_PAIR(0x9289, 0xBB7A)
+DOUBLE_BYTE_PAIR(0x928A, 0xBB7B)
+DOUBLE_BYTE_PAIR(0x928B, 0xBB7C)
+DOUBLE_BYTE_PAIR(0x928C, 0xBB7D)
+DOUBLE_BYTE_PAIR(0x928D, 0xBB7E)
+DOUBLE_BYTE_PAIR(0x928E, 0xBB7F)
+DOUBLE_BYTE_PAIR(0x928F, 0xBB80)
+DOUBLE_BYTE_PAIR(0x9290, 0xBB81)
+DOUBLE_BYTE_PAIR(0x9291, 0xBB82)
+DOUBLE_BYTE_PAIR(0x9292, 0xBB83)
+DOUBLE_BYTE_PAIR(0x9293, 0xBB84)
+DOUBLE_BYTE_PAIR(0x9294, 0xBB85)
+DOUBLE_BYTE_PAIR(0x9295, 0xBB86)
+DOUBLE_BYTE_PAIR(0x9296, 0xBB87)
+DOUBLE_BYTE_PAIR(0x9297, 0xBB89)
+DOUBLE_BYTE_PAIR(0x9298, 0xBB8A)
+DOUBLE_BYTE_PAIR(0x9299, 0xBB8B)
+DOUBLE_BYTE_PAIR(0x929A, 0xBB8D)
+DOUBLE_BYTE_PAIR(0x929B, 0xBB8E)
+DOUBLE_BYTE_PAIR(0x929C, 0xBB8F)
+DOUBLE_BYTE_PAIR(0x929D, 0xBB91)
+DOUBLE_BYTE_PAIR(0x929E, 0xBB92)
+DOUBLE_BYTE_PAIR(0x929F, 0xBB93)
+DOUBLE_BYTE_PAIR(0x92A0, 0xBB94)
+DOUBLE_BYTE_PAIR(0x92A1, 0xBB95)
+DOUBLE_BYTE_PAIR(0x92A2, 0xBB96)
+DOUBLE_BYTE_PAIR(0x92A3, 0xBB97)
+DOUBLE_BYTE_PAIR(0x92A4, 0xBB98)
+DOUBLE_BYTE_PAIR(0x92A5, 0xBB99)
+DOUBLE_BYTE_PAIR(0x92A6, 0xBB9A)
+DOUBLE_BYTE_PAIR(0x92A7, 0xBB9B)
+DOUBLE_BYTE_PAIR(0x92A8, 0xBB9C)
+DOUBLE_BYTE_PAIR(0x92A9, 0xBB9D)
+DOUBLE_BYTE_PAIR(0x92AA, 0xBB9E)
+DOUBLE_BYTE_PAIR(0x92AB, 0xBB9F)
+DOUBLE_BYTE_PAIR(0x92AC, 0xBBA0)
+DOUBLE_BYTE_PAIR(0x92AD, 0xBBA1)
+DOUBLE_BYTE_PAIR(0x92AE, 0xBBA2)
+DOUBLE_BYTE_PAIR(0x92AF, 0xBBA3)
+DOUBLE_BYTE_PAIR(0x92B0, 0xBBA5)
+DOUBLE_BYTE_PAIR(0x92B1, 0xBBA6)
+DOUBLE_BYTE_PAIR(0x92B2, 0xBBA7)
+DOUBLE_BYTE_PAIR(0x92B3, 0xBBA9)
+DOUBLE_BYTE_PAIR(0x92B4, 0xBBAA)
+DOUBLE_BYTE_PAIR(0x92B5, 0xBBAB)
+DOUBLE_BYTE_PAIR(0x92B6, 0xBBAD)
+DOUBLE_BYTE_PAIR(0x92B7, 0xBBAE)
+DOUBLE_BYTE_PAIR(0x92B8, 0xBBAF)
+DOUBLE_BYTE_PAIR(0x92B9, 0xBBB0)
+DOUBLE_BYTE_PAIR(0x92BA, 0xBBB1)
+DOUBLE_BYTE_PAIR(0x92BB, 0xBBB2)
+DOUBLE_BYTE_PAIR(0x92BC, 0xBBB3)
+DOUBLE_BYTE_PAIR(0x92BD, 0xBBB5)
+DOUBLE_BYTE_PAIR(0x92BE, 0xBBB6)
+DOUBLE_BYTE_PAIR(0x92BF, 0xBBB8)
+DOUBLE_BYTE_PAIR(0x92C0, 0xBBB9)
+DOUBLE_BYTE_PAIR(0x92C1, 0xBBBA)
+DOUBLE_BYTE_PAIR(0x92C2, 0xBBBB)
+DOUBLE_BYTE_PAIR(0x92C3, 0xBBBC)
+DOUBLE_BYTE_PAIR(0x92C4, 0xBBBD)
+DOUBLE_BYTE_PAIR(0x92C5, 0xBBBE)
+DOUBLE_BYTE_PAIR(0x92C6, 0xBBBF)
+DOUBLE_BYTE_PAIR(0x92C7, 0xBBC1)
+DOUBLE_BYTE_PAIR(0x92C8, 0xBBC2)
+DOUBLE_BYTE_PAIR(0x92C9, 0xBBC3)
+DOUBLE_BYTE_PAIR(0x92CA, 0xBBC5)
+DOUBLE_BYTE_PAIR(0x92CB, 0xBBC6)
+DOUBLE_BYTE_PAIR(0x92CC, 0xBBC7)
+DOUBLE_BYTE_PAIR(0x92CD, 0xBBC9)
+DOUBLE_BYTE_PAIR(0x92CE, 0xBBCA)
+DOUBLE_BYTE_PAIR(0x92CF, 0xBBCB)
+DOUBLE_BYTE_PAIR(0x92D0, 0xBBCC)
+DOUBLE_BYTE_PAIR(0x92D1, 0xBBCD)
+DOUBLE_BYTE_PAIR(0x92D2, 0xBBCE)
+DOUBLE_BYTE_PAIR(0x92D3, 0xBBCF)
+DOUBLE_BYTE_PAIR(0x92D4, 0xBBD1)
+DOUBLE_BYTE_PAIR(0x92D5, 0xBBD2)
+DOUBLE_BYTE_PAIR(0x92D6, 0xBBD4)
+DOUBLE_BYTE_PAIR(0x92D7, 0xBBD5)
+DOUBLE_BYTE_PAIR(0x92D8, 0xBBD6)
+DOUBLE_BYTE_PAIR(0x92D9, 0xBBD7)
+DOUBLE_BYTE_PAIR(0x92DA, 0xBBD8)
+DOUBLE_BYTE_PAIR(0x92DB, 0xBBD9)
+DOUBLE_BYTE_PAIR(0x92DC, 0xBBDA)
+DOUBLE_BYTE_PAIR(0x92DD, 0xBBDB)
+DOUBLE_BYTE_PAIR(0x92DE, 0xBBDC)
+DOUBLE_BYTE_PAIR(0x92DF, 0xBBDD)
+DOUBLE_BYTE_PAIR(0x92E0, 0xBBDE)
+DOUBLE_BYTE_PAIR(0x92E1, 0xBBDF)
+DOUBLE_BYTE_PAIR(0x92E2, 0xBBE0)
+DOUBLE_BYTE_PAIR(0x92E3, 0xBBE1)
+DOUBLE_BYTE_PAIR(0x92E4, 0xBBE2)
+DOUBLE_BYTE_PAIR(0x92E5, 0xBBE3)
+DOUBLE_BYTE_PAIR(0x92E6, 0xBBE4)
+DOUBLE_BYTE_PAIR(0x92E7, 0xBBE5)
+DOUBLE_BYTE_PAIR(0x92E8, 0xBBE6)
+DOUBLE_BYTE_PAIR(0x92E9, 0xBBE7)
+DOUBLE_BYTE_PAIR(0x92EA, 0xBBE8)
+DOUBLE_BYTE_PAIR(0x92EB, 0xBBE9)
+DOUBLE_BYTE_PAIR(0x92EC, 0xBBEA)
+DOUBLE_BYTE_PAIR(0x92ED, 0xBBEB)
+DOUBLE_BYTE_PAIR(0x92EE, 0xBBEC)
+DOUBLE_BYTE_PAIR(0x92EF, 0xBBED)
+DOUBLE_BYTE_PAIR(0x92F0, 0xBBEE)
+DOUBLE_BYTE_PAIR(0x92F1, 0xBBEF)
+DOUBLE_BYTE_PAIR(0x92F2, 0xBBF0)
+DOUBLE_BYTE_PAIR(0x92F3, 0xBBF1)
+DOUBLE_BYTE_PAIR(0x92F4, 0xBBF2)
+DOUBLE_BYTE_PAIR(0x92F5, 0xBBF3)
+DOUBLE_BYTE_PAIR(0x92F6, 0xBBF4)
+DOUBLE_BYTE_PAIR(0x92F7, 0xBBF5)
+DOUBLE_BYTE_PAIR(0x92F8, 0xBBF6)
+DOUBLE_BYTE_PAIR(0x92F9, 0xBBF7)
+DOUBLE_BYTE_PAIR(0x92FA, 0xBBFA)
+DOUBLE_BYTE_PAIR(0x92FB, 0xBBFB)
+DOUBLE_BYTE_PAIR(0x92FC, 0xBBFD)
+DOUBLE_BYTE_PAIR(0x92FD, 0xBBFE)
+DOUBLE_BYTE_PAIR(0x92FE, 0xBC01)
+DOUBLE_BYTE_PAIR(0x9341, 0xBC03)
+DOUBLE_BYTE_PAIR(0x9342, 0xBC04)
+DOUBLE_BYTE_PAIR(0x9343, 0xBC05)
+DOUBLE_BYTE_PAIR(0x9344, 0xBC06)
+DOUBLE_BYTE_PAIR(0x9345, 0xBC07)
+DOUBLE_BYTE_PAIR(0x9346, 0xBC0A)
+DOUBLE_BYTE_PAIR(0x9347, 0xBC0E)
+DOUBLE_BYTE_PAIR(0x9348, 0xBC10)
+DOUBLE_BYTE_PAIR(0x9349, 0xBC12)
+DOUBLE_BYTE_PAIR(0x934A, 0xBC13)
+DOUBLE_BYTE_PAIR(0x934B, 0xBC19)
+DOUBLE_BYTE_PAIR(0x934C, 0xBC1A)
+DOUBLE_BYTE_PAIR(0x934D, 0xBC20)
+DOUBLE_BYTE_PAIR(0x934E, 0xBC21)
+DOUBLE_BYTE_PAIR(0x934F, 0xBC22)
+DOUBLE_BYTE_PAIR(0x9350, 0xBC23)
+DOUBLE_BYTE_PAIR(0x9351, 0xBC26)
+DOUBLE_BYTE_PAIR(0x9352, 0xBC28)
+DOUBLE_BYTE_PAIR(0x9353, 0xBC2A)
+DOUBLE_BYTE_PAIR(0x9354, 0xBC2B)
+DOUBLE_BYTE_PAIR(0x9355, 0xBC2C)
+DOUBLE_BYTE_PAIR(0x9356, 0xBC2E)
+DOUBLE_BYTE_PAIR(0x9357, 0xBC2F)
+DOUBLE_BYTE_PAIR(0x9358, 0xBC32)
+DOUBLE_BYTE_PAIR(0x9359, 0xBC33)
+DOUBLE_BYTE_PAIR(0x935A, 0xBC35)
+DOUBLE_BYTE_PAIR(0x9361, 0xBC36)
+DOUBLE_BYTE_PAIR(0x9362, 0xBC37)
+DOUBLE_BYTE_PAIR(0x9363, 0xBC39)
+DOUBLE_BYTE_PAIR(0x9364, 0xBC3A)
+DOUBLE_BYTE_PAIR(0x9365, 0xBC3B)
+DOUBLE_BYTE_PAIR(0x9366, 0xBC3C)
+DOUBLE_BYTE_PAIR(0x9367, 0xBC3D)
+DOUBLE_BYTE_PAIR(0x9368, 0xBC3E)
+DOUBLE_BYTE_PAIR(0x9369, 0xBC3F)
+DOUBLE_BYTE_PAIR(0x936A, 0xBC42)
+DOUBLE_BYTE_PAIR(0x936B, 0xBC46)
+DOUBLE_BYTE_PAIR(0x936C, 0xBC47)
+DOUBLE_BYTE_PAIR(0x936D, 0xBC48)
+DOUBLE_BYTE_PAIR(0x936E, 0xBC4A)
+DOUBLE_BYTE_PAIR(0x936F, 0xBC4B)
+DOUBLE_BYTE_PAIR(0x9370, 0xBC4E)
+DOUBLE_BYTE_PAIR(0x9371, 0xBC4F)
+DOUBLE_BYTE_PAIR(0x9372, 0xBC51)
+DOUBLE_BYTE_PAIR(0x9373, 0xBC52)
+DOUBLE_BYTE_PAIR(0x9374, 0xBC53)
+DOUBLE_BYTE_PAIR(0x9375, 0xBC54)
+DOUBLE_BYTE_PAIR(0x9376, 0xBC55)
+DOUBLE_BYTE_PAIR(0x9377, 0xBC56)
+DOUBLE_BYTE_PAIR(0x9378, 0xBC57)
+DOUBLE_BYTE_PAIR(0x9379, 0xBC58)
+DOUBLE_BYTE_PAIR(0x937A, 0xBC59)
+DOUBLE_BYTE_PAIR(0x9381, 0xBC5A)
+DOUBLE_BYTE_PAIR(0x9382, 0xBC5B)
+DOUBLE_BYTE_PAIR(0x9383, 0xBC5C)
+DOUBLE_BYTE_PAIR(0x9384, 0xBC5E)
+DOUBLE_BYTE_PAIR(0x9385, 0xBC5F)
+DOUBLE_BYTE_PAIR(0x9386, 0xBC60)
+DOUBLE_BYTE_PAIR(0x9387, 0xBC61)
+DOUBLE_BYTE_PAIR(0x9388, 0xBC62)
+DOUBLE_BYTE_PAIR(0x9389, 0xBC63)
+DOUBLE_BYTE_PAIR(0x938A, 0xBC64)
+DOUBLE_BYTE_PAIR(0x938B, 0xBC65)
+DOUBLE_BYTE_PAIR(0x938C, 0xBC66)
+DOUBLE_BYTE_PAIR(0x938D, 0xBC67)
+DOUBLE_BYTE_PAIR(0x938E, 0xBC68)
+DOUBLE_BYTE_PAIR(0x938F, 0xBC69)
+DOUBLE_BYTE_PAIR(0x9390, 0xBC6A)
+DOUBLE_BYTE_PAIR(0x9391, 0xBC6B)
+DOUBLE_BYTE_PAIR(0x9392, 0xBC6C)
+DOUBLE_BYTE_PAIR(0x9393, 0xBC6D)
+DOUBLE_BYTE_PAIR(0x9394, 0xBC6E)
+DOUBLE_BYTE_PAIR(0x9395, 0xBC6F)
+DOUBLE_BYTE_PAIR(0x9396, 0xBC70)
+DOUBLE_BYTE_PAIR(0x9397, 0xBC71)
+DOUBLE_BYTE_PAIR(0x9398, 0xBC72)
+DOUBLE_BYTE_PAIR(0x9399, 0xBC73)
+DOUBLE_BYTE_PAIR(0x939A, 0xBC74)
+DOUBLE_BYTE_PAIR(0x939B, 0xBC75)
+DOUBLE_BYTE_PAIR(0x939C, 0xBC76)
+DOUBLE_BYTE_PAIR(0x939D, 0xBC77)
+DOUBLE_BYTE_PAIR(0x939E, 0xBC78)
+DOUBLE_BYTE_PAIR(0x939F, 0xBC79)
+DOUBLE_BYTE_PAIR(0x93A0, 0xBC7A)
+DOUBLE_BYTE_PAIR(0x93A1, 0xBC7B)
+DOUBLE_BYTE_PAIR(0x93A2, 0xBC7C)
+DOUBLE_BYTE_PAIR(0x93A3, 0xBC7D)
+DOUBLE_BYTE_PAIR(0x93A4, 0xBC7E)
+DOUBLE_BYTE_PAIR(0x93A5, 0xBC7F)
+DOUBLE_BYTE_PAIR(0x93A6, 0xBC80)
+DOUBLE_BYTE_PAIR(0x93A7, 0xBC81)
+DOUBLE_BYTE_PAIR(0x93A8, 0xBC82)
+DOUBLE_BYTE_PAIR(0x93A9, 0xBC83)
+DOUBLE_BYTE_PAIR(0x93AA, 0xBC86)
+DOUBLE_BYTE_PAIR(0x93AB, 0xBC87)
+DOUBLE_BYTE_PAIR(0x93AC, 0xBC89)
+DOUBLE_BYTE_PAIR(0x93AD, 0xBC8A)
+DOUBLE_BYTE_PAIR(0x93AE, 0xBC8D)
+DOUBLE_BYTE_PAIR(0x93AF, 0xBC8F)
+DOUBLE_BYTE_PAIR(0x93B0, 0xBC90)
+DOUBLE_BYTE_PAIR(0x93B1, 0xBC91)
+DOUBLE_BYTE_PAIR(0x93B2, 0xBC92)
+DOUBLE_BYTE_PAIR(0x93B3, 0xBC93)
+DOUBLE_BYTE_PAIR(0x93B4, 0xBC96)
+DOUBLE_BYTE_PAIR(0x93B5, 0xBC98)
+DOUBLE_BYTE_PAIR(0x93B6, 0xBC9B)
+DOUBLE_BYTE_PAIR(0x93B7, 0xBC9C)
+DOUBLE_BYTE_PAIR(0x93B8, 0xBC9D)
+DOUBLE_BYTE_PAIR(0x93B9, 0xBC9E)
+DOUBLE_BYTE_PAIR(0x93BA, 0xBC9F)
+DOUBLE_BYTE_PAIR(0x93BB, 0xBCA2)
+DOUBLE_BYTE_PAIR(0x93BC, 0xBCA3)
+DOUBLE_BYTE_PAIR(0x93BD, 0xBCA5)
+DOUBLE_BYTE_PAIR(0x93BE, 0xBCA6)
+DOUBLE_BYTE_PAIR(0x93BF, 0xBCA9)
+DOUBLE_BYTE_PAIR(0x93C0, 0xBCAA)
+DOUBLE_BYTE_PAIR(0x93C1, 0xBCAB)
+DOUBLE_BYTE_PAIR(0x93C2, 0xBCAC)
+DOUBLE_BYTE_PAIR(0x93C3, 0xBCAD)
+DOUBLE_BYTE_PAIR(0x93C4, 0xBCAE)
+DOUBLE_BYTE_PAIR(0x93C5, 0xBCAF)
+DOUBLE_BYTE_PAIR(0x93C6, 0xBCB2)
+DOUBLE_BYTE_PAIR(0x93C7, 0xBCB6)
+DOUBLE_BYTE_PAIR(0x93C8, 0xBCB7)
+DOUBLE_BYTE_PAIR(0x93C9, 0xBCB8)
+DOUBLE_BYTE_PAIR(0x93CA, 0xBCB9)
+DOUBLE_BYTE_PAIR(0x93CB, 0xBCBA)
+DOUBLE_BYTE_PAIR(0x93CC, 0xBCBB)
+DOUBLE_BYTE_PAIR(0x93CD, 0xBCBE)
+DOUBLE_BYTE_PAIR(0x93CE, 0xBCBF)
+DOUBLE_BYTE_PAIR(0x93CF, 0xBCC1)
+DOUBLE_BYTE_PAIR(0x93D0, 0xBCC2)
+DOUBLE_BYTE_PAIR(0x93D1, 0xBCC3)
+DOUBLE_BYTE_PAIR(0x93D2, 0xBCC5)
+DOUBLE_BYTE_PAIR(0x93D3, 0xBCC6)
+DOUBLE_BYTE_PAIR(0x93D4, 0xBCC7)
+DOUBLE_BYTE_PAIR(0x93D5, 0xBCC8)
+DOUBLE_BYTE_PAIR(0x93D6, 0xBCC9)
+DOUBLE_BYTE_PAIR(0x93D7, 0xBCCA)
+DOUBLE_BYTE_PAIR(0x93D8, 0xBCCB)
+DOUBLE_BYTE_PAIR(0x93D9, 0xBCCC)
+DOUBLE_BYTE_PAIR(0x93DA, 0xBCCE)
+DOUBLE_BYTE_PAIR(0x93DB, 0xBCD2)
+DOUBLE_BYTE_PAIR(0x93DC, 0xBCD3)
+DOUBLE_BYTE_PAIR(0x93DD, 0xBCD4)
+DOUBLE_BYTE_PAIR(0x93DE, 0xBCD6)
+DOUBLE_BYTE_PAIR(0x93DF, 0xBCD7)
+DOUBLE_BYTE_PAIR(0x93E0, 0xBCD9)
+DOUBLE_BYTE_PAIR(0x93E1, 0xBCDA)
+DOUBLE_BYTE_PAIR(0x93E2, 0xBCDB)
+DOUBLE_BYTE_PAIR(0x93E3, 0xBCDD)
+DOUBLE_BYTE_PAIR(0x93E4, 0xBCDE)
+DOUBLE_BYTE_PAIR(0x93E5, 0xBCDF)
+DOUBLE_BYTE_PAIR(0x93E6, 0xBCE0)
+DOUBLE_BYTE_PAIR(0x93E7, 0xBCE1)
+DOUBLE_BYTE_PAIR(0x93E8, 0xBCE2)
+DOUBLE_BYTE_PAIR(0x93E9, 0xBCE3)
+DOUBLE_BYTE_PAIR(0x93EA, 0xBCE4)
+DOUBLE_BYTE_PAIR(0x93EB, 0xBCE5)
+DOUBLE_BYTE_PAIR(0x93EC, 0xBCE6)
+DOUBLE_BYTE_PAIR(0x93ED, 0xBCE7)
+DOUBLE_BYTE_PAIR(0x93EE, 0xBCE8)
+DOUBLE_BYTE_PAIR(0x93EF, 0xBCE9)
+DOUBLE_BYTE_PAIR(0x93F0, 0xBCEA)
+DOUBLE_BYTE_PAIR(0x93F1, 0xBCEB)
+DOUBLE_BYTE_PAIR(0x93F2, 0xBCEC)
+DOUBLE_BYTE_PAIR(0x93F3, 0xBCED)
+DOUBLE_BYTE_PAIR(0x93F4, 0xBCEE)
+DOUBLE_BYTE_PAIR(0x93F5, 0xBCEF)
+DOUBLE_BYTE_PAIR(0x93F6, 0xBCF0)
+DOUBLE_BYTE_PAIR(0x93F7, 0xBCF1)
+DOUBLE_BYTE_PAIR(0x93F8, 0xBCF2)
+DOUBLE_BYTE_PAIR(0x93F9, 0xBCF3)
+DOUBLE_BYTE_PAIR(0x93FA, 0xBCF7)
+DOUBLE_BYTE_PAIR(0x93FB, 0xBCF9)
+DOUBLE_BYTE_PAIR(0x93FC, 0xBCFA)
+DOUBLE_BYTE_PAIR(0x93FD, 0xBCFB)
+DOUBLE_BYTE_PAIR(0x93FE, 0xBCFD)
+DOUBLE_BYTE_PAIR(0x9441, 0xBCFE)
+DOUBLE_BYTE_PAIR(0x9442, 0xBCFF)
+DOUBLE_BYTE_PAIR(0x9443, 0xBD00)
+DOUBLE_BYTE_PAIR(0x9444, 0xBD01)
+DOUBLE_BYTE_PAIR(0x9445, 0xBD02)
+DOUBLE_BYTE_PAIR(0x9446, 0xBD03)
+DOUBLE_BYTE_PAIR(0x9447, 0xBD06)
+DOUBLE_BYTE_PAIR(0x9448, 0xBD08)
+DOUBLE_BYTE_PAIR(0x9449, 0xBD0A)
+DOUBLE_BYTE_PAIR(0x944A, 0xBD0B)
+DOUBLE_BYTE_PAIR(0x944B, 0xBD0C)
+DOUBLE_BYTE_PAIR(0x944C, 0xBD0D)
+DOUBLE_BYTE_PAIR(0x944D, 0xBD0E)
+DOUBLE_BYTE_PAIR(0x944E, 0xBD0F)
+DOUBLE_BYTE_PAIR(0x944F, 0xBD11)
+DOUBLE_BYTE_PAIR(0x9450, 0xBD12)
+DOUBLE_BYTE_PAIR(0x9451, 0xBD13)
+DOUBLE_BYTE_PAIR(0x9452, 0xBD15)
+DOUBLE_BYTE_PAIR(0x9453, 0xBD16)
+DOUBLE_BYTE_PAIR(0x9454, 0xBD17)
+DOUBLE_BYTE_PAIR(0x9455, 0xBD18)
+DOUBLE_BYTE_PAIR(0x9456, 0xBD19)
+DOUBLE_BYTE_PAIR(0x9457, 0xBD1A)
+DOUBLE_BYTE_PAIR(0x9458, 0xBD1B)
+DOUBLE_BYTE_PAIR(0x9459, 0xBD1C)
+DOUBLE_BYTE_PAIR(0x945A, 0xBD1D)
+DOUBLE_BYTE_PAIR(0x9461, 0xBD1E)
+DOUBLE_BYTE_PAIR(0x9462, 0xBD1F)
+DOUBLE_BYTE_PAIR(0x9463, 0xBD20)
+DOUBLE_BYTE_PAIR(0x9464, 0xBD21)
+DOUBLE_BYTE_PAIR(0x9465, 0xBD22)
+DOUBLE_BYTE_PAIR(0x9466, 0xBD23)
+DOUBLE_BYTE_PAIR(0x9467, 0xBD25)
+DOUBLE_BYTE_PAIR(0x9468, 0xBD26)
+DOUBLE_BYTE_PAIR(0x9469, 0xBD27)
+DOUBLE_BYTE_PAIR(0x946A, 0xBD28)
+DOUBLE_BYTE_PAIR(0x946B, 0xBD29)
+DOUBLE_BYTE_PAIR(0x946C, 0xBD2A)
+DOUBLE_BYTE_PAIR(0x946D, 0xBD2B)
+DOUBLE_BYTE_PAIR(0x946E, 0xBD2D)
+DOUBLE_BYTE_PAIR(0x946F, 0xBD2E)
+DOUBLE_BYTE_PAIR(0x9470, 0xBD2F)
+DOUBLE_BYTE_PAIR(0x9471, 0xBD30)
+DOUBLE_BYTE_PAIR(0x9472, 0xBD31)
+DOUBLE_BYTE_PAIR(0x9473, 0xBD32)
+DOUBLE_BYTE_PAIR(0x9474, 0xBD33)
+DOUBLE_BYTE_PAIR(0x9475, 0xBD34)
+DOUBLE_BYTE_PAIR(0x9476, 0xBD35)
+DOUBLE_BYTE_PAIR(0x9477, 0xBD36)
+DOUBLE_BYTE_PAIR(0x9478, 0xBD37)
+DOUBLE_BYTE_PAIR(0x9479, 0xBD38)
+DOUBLE_BYTE_PAIR(0x947A, 0xBD39)
+DOUBLE_BYTE_PAIR(0x9481, 0xBD3A)
+DOUBLE_BYTE_PAIR(0x9482, 0xBD3B)
+DOUBLE_BYTE_PAIR(0x9483, 0xBD3C)
+DOUBLE_BYTE_PAIR(0x9484, 0xBD3D)
+DOUBLE_BYTE_PAIR(0x9485, 0xBD3E)
+DOUBLE_BYTE_PAIR(0x9486, 0xBD3F)
+DOUBLE_BYTE_PAIR(0x9487, 0xBD41)
+DOUBLE_BYTE_PAIR(0x9488, 0xBD42)
+DOUBLE_BYTE_PAIR(0x9489, 0xBD43)
+DOUBLE_BYTE_PAIR(0x948A, 0xBD44)
+DOUBLE_BYTE_PAIR(0x948B, 0xBD45)
+DOUBLE_BYTE_PAIR(0x948C, 0xBD46)
+DOUBLE_BYTE_PAIR(0x948D, 0xBD47)
+DOUBLE_BYTE_PAIR(0x948E, 0xBD4A)
+DOUBLE_BYTE_PAIR(0x948F, 0xBD4B)
+DOUBLE_BYTE_PAIR(0x9490, 0xBD4D)
+DOUBLE_BYTE_PAIR(0x9491, 0xBD4E)
+DOUBLE_BYTE_PAIR(0x9492, 0xBD4F)
+DOUBLE_BYTE_PAIR(0x9493, 0xBD51)
+DOUBLE_BYTE_PAIR(0x9494, 0xBD52)
+DOUBLE_BYTE_PAIR(0x9495, 0xBD53)
+DOUBLE_BYTE_PAIR(0x9496, 0xBD54)
+DOUBLE_BYTE_PAIR(0x9497, 0xBD55)
+DOUBLE_BYTE_PAIR(0x9498, 0xBD56)
+DOUBLE_BYTE_PAIR(0x9499, 0xBD57)
+DOUBLE_BYTE_PAIR(0x949A, 0xBD5A)
+DOUBLE_BYTE_PAIR(0x949B, 0xBD5B)
+DOUBLE_BYTE_PAIR(0x949C, 0xBD5C)
+DOUBLE_BYTE_PAIR(0x949D, 0xBD5D)
+DOUBLE_BYTE_PAIR(0x949E, 0xBD5E)
+DOUBLE_BYTE_PAIR(0x949F, 0xBD5F)
+DOUBLE_BYTE_PAIR(0x94A0, 0xBD60)
+DOUBLE_BYTE_PAIR(0x94A1, 0xBD61)
+DOUBLE_BYTE_PAIR(0x94A2, 0xBD62)
+DOUBLE_BYTE_PAIR(0x94A3, 0xBD63)
+DOUBLE_BYTE_PAIR(0x94A4, 0xBD65)
+DOUBLE_BYTE_PAIR(0x94A5, 0xBD66)
+DOUBLE_BYTE_PAIR(0x94A6, 0xBD67)
+DOUBLE_BYTE_PAIR(0x94A7, 0xBD69)
+DOUBLE_BYTE_PAIR(0x94A8, 0xBD6A)
+DOUBLE_BYTE_PAIR(0x94A9, 0xBD6B)
+DOUBLE_BYTE_PAIR(0x94AA, 0xBD6C)
+DOUBLE_BYTE_PAIR(0x94AB, 0xBD6D)
+DOUBLE_BYTE_PAIR(0x94AC, 0xBD6E)
+DOUBLE_BYTE_PAIR(0x94AD, 0xBD6F)
+DOUBLE_BYTE_PAIR(0x94AE, 0xBD70)
+DOUBLE_BYTE_PAIR(0x94AF, 0xBD71)
+DOUBLE_BYTE_PAIR(0x94B0, 0xBD72)
+DOUBLE_BYTE_PAIR(0x94B1, 0xBD73)
+DOUBLE_BYTE_PAIR(0x94B2, 0xBD74)
+DOUBLE_BYTE_PAIR(0x94B3, 0xBD75)
+DOUBLE_BYTE_PAIR(0x94B4, 0xBD76)
+DOUBLE_BYTE_PAIR(0x94B5, 0xBD77)
+DOUBLE_BYTE_PAIR(0x94B6, 0xBD78)
+DOUBLE_BYTE_PAIR(0x94B7, 0xBD79)
+DOUBLE_BYTE_PAIR(0x94B8, 0xBD7A)
+DOUBLE_BYTE_PAIR(0x94B9, 0xBD7B)
+DOUBLE_BYTE_PAIR(0x94BA, 0xBD7C)
+DOUBLE_BYTE_PAIR(0x94BB, 0xBD7D)
+DOUBLE_BYTE_PAIR(0x94BC, 0xBD7E)
+DOUBLE_BYTE_PAIR(0x94BD, 0xBD7F)
+DOUBLE_BYTE_PAIR(0x94BE, 0xBD82)
+DOUBLE_BYTE_PAIR(0x94BF, 0xBD83)
+DOUBLE_BYTE_PAIR(0x94C0, 0xBD85)
+DOUBLE_BYTE_PAIR(0x94C1, 0xBD86)
+DOUBLE_BYTE_PAIR(0x94C2, 0xBD8B)
+DOUBLE_BYTE_PAIR(0x94C3, 0xBD8C)
+DOUBLE_BYTE_PAIR(0x94C4, 0xBD8D)
+DOUBLE_BYTE_PAIR(0x94C5, 0xBD8E)
+DOUBLE_BYTE_PAIR(0x94C6, 0xBD8F)
+DOUBLE_BYTE_PAIR(0x94C7, 0xBD92)
+DOUBLE_BYTE_PAIR(0x94C8, 0xBD94)
+DOUBLE_BYTE_PAIR(0x94C9, 0xBD96)
+DOUBLE_BYTE_PAIR(0x94CA, 0xBD97)
+DOUBLE_BYTE_PAIR(0x94CB, 0xBD98)
+DOUBLE_BYTE_PAIR(0x94CC, 0xBD9B)
+DOUBLE_BYTE_PAIR(0x94CD, 0xBD9D)
+DOUBLE_BYTE_PAIR(0x94CE, 0xBD9E)
+DOUBLE_BYTE_PAIR(0x94CF, 0xBD9F)
+DOUBLE_BYTE_PAIR(0x94D0, 0xBDA0)
+DOUBLE_BYTE_PAIR(0x94D1, 0xBDA1)
+DOUBLE_BYTE_PAIR(0x94D2, 0xBDA2)
+DOUBLE_BYTE_PAIR(0x94D3, 0xBDA3)
+DOUBLE_BYTE_PAIR(0x94D4, 0xBDA5)
+DOUBLE_BYTE_PAIR(0x94D5, 0xBDA6)
+DOUBLE_BYTE_PAIR(0x94D6, 0xBDA7)
+DOUBLE_BYTE_PAIR(0x94D7, 0xBDA8)
+DOUBLE_BYTE_PAIR(0x94D8, 0xBDA9)
+DOUBLE_BYTE_PAIR(0x94D9, 0xBDAA)
+DOUBLE_BYTE_PAIR(0x94DA, 0xBDAB)
+DOUBLE_BYTE_PAIR(0x94DB, 0xBDAC)
+DOUBLE_BYTE_PAIR(0x94DC, 0xBDAD)
+DOUBLE_BYTE_PAIR(0x94DD, 0xBDAE)
+DOUBLE_BYTE_PAIR(0x94DE, 0xBDAF)
+DOUBLE_BYTE_PAIR(0x94DF, 0xBDB1)
+DOUBLE_BYTE_PAIR(0x94E0, 0xBDB2)
+DOUBLE_BYTE_PAIR(0x94E1, 0xBDB3)
+DOUBLE_BYTE_PAIR(0x94E2, 0xBDB4)
+DOUBLE_BYTE_PAIR(0x94E3, 0xBDB5)
+DOUBLE_BYTE_PAIR(0x94E4, 0xBDB6)
+DOUBLE_BYTE_PAIR(0x94E5, 0xBDB7)
+DOUBLE_BYTE_PAIR(0x94E6, 0xBDB9)
+DOUBLE_BYTE_PAIR(0x94E7, 0xBDBA)
+DOUBLE_BYTE_PAIR(0x94E8, 0xBDBB)
+DOUBLE_BYTE_PAIR(0x94E9, 0xBDBC)
+DOUBLE_BYTE_PAIR(0x94EA, 0xBDBD)
+DOUBLE_BYTE_PAIR(0x94EB, 0xBDBE)
+DOUBLE_BYTE_PAIR(0x94EC, 0xBDBF)
+DOUBLE_BYTE_PAIR(0x94ED, 0xBDC0)
+DOUBLE_BYTE_PAIR(0x94EE, 0xBDC1)
+DOUBLE_BYTE_PAIR(0x94EF, 0xBDC2)
+DOUBLE_BYTE_PAIR(0x94F0, 0xBDC3)
+DOUBLE_BYTE_PAIR(0x94F1, 0xBDC4)
+DOUBLE_BYTE_PAIR(0x94F2, 0xBDC5)
+DOUBLE_BYTE_PAIR(0x94F3, 0xBDC6)
+DOUBLE_BYTE_PAIR(0x94F4, 0xBDC7)
+DOUBLE_BYTE_PAIR(0x94F5, 0xBDC8)
+DOUBLE_BYTE_PAIR(0x94F6, 0xBDC9)
+DOUBLE_BYTE_PAIR(0x94F7, 0xBDCA)
+DOUBLE_BYTE_PAIR(0x94F8, 0xBDCB)
+DOUBLE_BYTE_PAIR(0x94F9, 0xBDCC)
+DOUBLE_BYTE_PAIR(0x94FA, 0xBDCD)
+DOUBLE_BYTE_PAIR(0x94FB, 0xBDCE)
+DOUBLE_BYTE_PAIR(0x94FC, 0xBDCF)
+DOUBLE_BYTE_PAIR(0x94FD, 0xBDD0)
+DOUBLE_BYTE_PAIR(0x94FE, 0xBDD1)
+DOUBLE_BYTE_PAIR(0x9541, 0xBDD2)
+DOUBLE_BYTE_PAIR(0x9542, 0xBDD3)
+DOUBLE_BYTE_PAIR(0x9543, 0xBDD6)
+DOUBLE_BYTE_PAIR(0x9544, 0xBDD7)
+DOUBLE_BYTE_PAIR(0x9545, 0xBDD9)
+DOUBLE_BYTE_PAIR(0x9546, 0xBDDA)
+DOUBLE_BYTE_PAIR(0x9547, 0xBDDB)
+DOUBLE_BYTE_PAIR(0x9548, 0xBDDD)
+DOUBLE_BYTE_PAIR(0x9549, 0xBDDE)
+DOUBLE_BYTE_PAIR(0x954A, 0xBDDF)
+DOUBLE_BYTE_PAIR(0x954B, 0xBDE0)
+DOUBLE_BYTE_PAIR(0x954C, 0xBDE1)
+DOUBLE_BYTE_PAIR(0x954D, 0xBDE2)
+DOUBLE_BYTE_PAIR(0x954E, 0xBDE3)
+DOUBLE_BYTE_PAIR(0x954F, 0xBDE4)
+DOUBLE_BYTE_PAIR(0x9550, 0xBDE5)
+DOUBLE_BYTE_PAIR(0x9551, 0xBDE6)
+DOUBLE_BYTE_PAIR(0x9552, 0xBDE7)
+DOUBLE_BYTE_PAIR(0x9553, 0xBDE8)
+DOUBLE_BYTE_PAIR(0x9554, 0xBDEA)
+DOUBLE_BYTE_PAIR(0x9555, 0xBDEB)
+DOUBLE_BYTE_PAIR(0x9556, 0xBDEC)
+DOUBLE_BYTE_PAIR(0x9557, 0xBDED)
+DOUBLE_BYTE_PAIR(0x9558, 0xBDEE)
+DOUBLE_BYTE_PAIR(0x9559, 0xBDEF)
+DOUBLE_BYTE_PAIR(0x955A, 0xBDF1)
+DOUBLE_BYTE_PAIR(0x9561, 0xBDF2)
+DOUBLE_BYTE_PAIR(0x9562, 0xBDF3)
+DOUBLE_BYTE_PAIR(0x9563, 0xBDF5)
+DOUBLE_BYTE_PAIR(0x9564, 0xBDF6)
+DOUBLE_BYTE_PAIR(0x9565, 0xBDF7)
+DOUBLE_BYTE_PAIR(0x9566, 0xBDF9)
+DOUBLE_BYTE_PAIR(0x9567, 0xBDFA)
+DOUBLE_BYTE_PAIR(0x9568, 0xBDFB)
+DOUBLE_BYTE_PAIR(0x9569, 0xBDFC)
+DOUBLE_BYTE_PAIR(0x956A, 0xBDFD)
+DOUBLE_BYTE_PAIR(0x956B, 0xBDFE)
+DOUBLE_BYTE_PAIR(0x956C, 0xBDFF)
+DOUBLE_BYTE_PAIR(0x956D, 0xBE01)
+DOUBLE_BYTE_PAIR(0x956E, 0xBE02)
+DOUBLE_BYTE_PAIR(0x956F, 0xBE04)
+DOUBLE_BYTE_PAIR(0x9570, 0xBE06)
+DOUBLE_BYTE_PAIR(0x9571, 0xBE07)
+DOUBLE_BYTE_PAIR(0x9572, 0xBE08)
+DOUBLE_BYTE_PAIR(0x9573, 0xBE09)
+DOUBLE_BYTE_PAIR(0x9574, 0xBE0A)
+DOUBLE_BYTE_PAIR(0x9575, 0xBE0B)
+DOUBLE_BYTE_PAIR(0x9576, 0xBE0E)
+DOUBLE_BYTE_PAIR(0x9577, 0xBE0F)
+DOUBLE_BYTE_PAIR(0x9578, 0xBE11)
+DOUBLE_BYTE_PAIR(0x9579, 0xBE12)
+DOUBLE_BYTE_PAIR(0x957A, 0xBE13)
+DOUBLE_BYTE_PAIR(0x9581, 0xBE15)
+DOUBLE_BYTE_PAIR(0x9582, 0xBE16)
+DOUBLE_BYTE_PAIR(0x9583, 0xBE17)
+DOUBLE_BYTE_PAIR(0x9584, 0xBE18)
+DOUBLE_BYTE_PAIR(0x9585, 0xBE19)
+DOUBLE_BYTE_PAIR(0x9586, 0xBE1A)
+DOUBLE_BYTE_PAIR(0x9587, 0xBE1B)
+DOUBLE_BYTE_PAIR(0x9588, 0xBE1E)
+DOUBLE_BYTE_PAIR(0x9589, 0xBE20)
+DOUBLE_BYTE_PAIR(0x958A, 0xBE21)
+DOUBLE_BYTE_PAIR(0x958B, 0xBE22)
+DOUBLE_BYTE_PAIR(0x958C, 0xBE23)
+DOUBLE_BYTE_PAIR(0x958D, 0xBE24)
+DOUBLE_BYTE_PAIR(0x958E, 0xBE25)
+DOUBLE_BYTE_PAIR(0x958F, 0xBE26)
+DOUBLE_BYTE_PAIR(0x9590, 0xBE27)
+DOUBLE_BYTE_PAIR(0x9591, 0xBE28)
+DOUBLE_BYTE_PAIR(0x9592, 0xBE29)
+DOUBLE_BYTE_PAIR(0x9593, 0xBE2A)
+DOUBLE_BYTE_PAIR(0x9594, 0xBE2B)
+DOUBLE_BYTE_PAIR(0x9595, 0xBE2C)
+DOUBLE_BYTE_PAIR(0x9596, 0xBE2D)
+DOUBLE_BYTE_PAIR(0x9597, 0xBE2E)
+DOUBLE_BYTE_PAIR(0x9598, 0xBE2F)
+DOUBLE_BYTE_PAIR(0x9599, 0xBE30)
+DOUBLE_BYTE_PAIR(0x959A, 0xBE31)
+DOUBLE_BYTE_PAIR(0x959B, 0xBE32)
+DOUBLE_BYTE_PAIR(0x959C, 0xBE33)
+DOUBLE_BYTE_PAIR(0x959D, 0xBE34)
+DOUBLE_BYTE_PAIR(0x959E, 0xBE35)
+DOUBLE_BYTE_PAIR(0x959F, 0xBE36)
+DOUBLE_BYTE_PAIR(0x95A0, 0xBE37)
+DOUBLE_BYTE_PAIR(0x95A1, 0xBE38)
+DOUBLE_BYTE_PAIR(0x95A2, 0xBE39)
+DOUBLE_BYTE_PAIR(0x95A3, 0xBE3A)
+DOUBLE_BYTE_PAIR(0x95A4, 0xBE3B)
+DOUBLE_BYTE_PAIR(0x95A5, 0xBE3C)
+DOUBLE_BYTE_PAIR(0x95A6, 0xBE3D)
+DOUBLE_BYTE_PAIR(0x95A7, 0xBE3E)
+DOUBLE_BYTE_PAIR(0x95A8, 0xBE3F)
+DOUBLE_BYTE_PAIR(0x95A9, 0xBE40)
+DOUBLE_BYTE_PAIR(0x95AA, 0xBE41)
+DOUBLE_BYTE_PAIR(0x95AB, 0xBE42)
+DOUBLE_BYTE_PAIR(0x95AC, 0xBE43)
+DOUBLE_BYTE_PAIR(0x95AD, 0xBE46)
+DOUBLE_BYTE_PAIR(0x95AE, 0xBE47)
+DOUBLE_BYTE_PAIR(0x95AF, 0xBE49)
+DOUBLE_BYTE_PAIR(0x95B0, 0xBE4A)
+DOUBLE_BYTE_PAIR(0x95B1, 0xBE4B)
+DOUBLE_BYTE_PAIR(0x95B2, 0xBE4D)
+DOUBLE_BYTE_PAIR(0x95B3, 0xBE4F)
+DOUBLE_BYTE_PAIR(0x95B4, 0xBE50)
+DOUBLE_BYTE_PAIR(0x95B5, 0xBE51)
+DOUBLE_BYTE_PAIR(0x95B6, 0xBE52)
+DOUBLE_BYTE_PAIR(0x95B7, 0xBE53)
+DOUBLE_BYTE_PAIR(0x95B8, 0xBE56)
+DOUBLE_BYTE_PAIR(0x95B9, 0xBE58)
+DOUBLE_BYTE_PAIR(0x95BA, 0xBE5C)
+DOUBLE_BYTE_PAIR(0x95BB, 0xBE5D)
+DOUBLE_BYTE_PAIR(0x95BC, 0xBE5E)
+DOUBLE_BYTE_PAIR(0x95BD, 0xBE5F)
+DOUBLE_BYTE_PAIR(0x95BE, 0xBE62)
+DOUBLE_BYTE_PAIR(0x95BF, 0xBE63)
+DOUBLE_BYTE_PAIR(0x95C0, 0xBE65)
+DOUBLE_BYTE_PAIR(0x95C1, 0xBE66)
+DOUBLE_BYTE_PAIR(0x95C2, 0xBE67)
+DOUBLE_BYTE_PAIR(0x95C3, 0xBE69)
+DOUBLE_BYTE_PAIR(0x95C4, 0xBE6B)
+DOUBLE_BYTE_PAIR(0x95C5, 0xBE6C)
+DOUBLE_BYTE_PAIR(0x95C6, 0xBE6D)
+DOUBLE_BYTE_PAIR(0x95C7, 0xBE6E)
+DOUBLE_BYTE_PAIR(0x95C8, 0xBE6F)
+DOUBLE_BYTE_PAIR(0x95C9, 0xBE72)
+DOUBLE_BYTE_PAIR(0x95CA, 0xBE76)
+DOUBLE_BYTE_PAIR(0x95CB, 0xBE77)
+DOUBLE_BYTE_PAIR(0x95CC, 0xBE78)
+DOUBLE_BYTE_PAIR(0x95CD, 0xBE79)
+DOUBLE_BYTE_PAIR(0x95CE, 0xBE7A)
+DOUBLE_BYTE_PAIR(0x95CF, 0xBE7E)
+DOUBLE_BYTE_PAIR(0x95D0, 0xBE7F)
+DOUBLE_BYTE_PAIR(0x95D1, 0xBE81)
+DOUBLE_BYTE_PAIR(0x95D2, 0xBE82)
+DOUBLE_BYTE_PAIR(0x95D3, 0xBE83)
+DOUBLE_BYTE_PAIR(0x95D4, 0xBE85)
+DOUBLE_BYTE_PAIR(0x95D5, 0xBE86)
+DOUBLE_BYTE_PAIR(0x95D6, 0xBE87)
+DOUBLE_BYTE_PAIR(0x95D7, 0xBE88)
+DOUBLE_BYTE_PAIR(0x95D8, 0xBE89)
+DOUBLE_BYTE_PAIR(0x95D9, 0xBE8A)
+DOUBLE_BYTE_PAIR(0x95DA, 0xBE8B)
+DOUBLE_BYTE_PAIR(0x95DB, 0xBE8E)
+DOUBLE_BYTE_PAIR(0x95DC, 0xBE92)
+DOUBLE_BYTE_PAIR(0x95DD, 0xBE93)
+DOUBLE_BYTE_PAIR(0x95DE, 0xBE94)
+DOUBLE_BYTE_PAIR(0x95DF, 0xBE95)
+DOUBLE_BYTE_PAIR(0x95E0, 0xBE96)
+DOUBLE_BYTE_PAIR(0x95E1, 0xBE97)
+DOUBLE_BYTE_PAIR(0x95E2, 0xBE9A)
+DOUBLE_BYTE_PAIR(0x95E3, 0xBE9B)
+DOUBLE_BYTE_PAIR(0x95E4, 0xBE9C)
+DOUBLE_BYTE_PAIR(0x95E5, 0xBE9D)
+DOUBLE_BYTE_PAIR(0x95E6, 0xBE9E)
+DOUBLE_BYTE_PAIR(0x95E7, 0xBE9F)
+DOUBLE_BYTE_PAIR(0x95E8, 0xBEA0)
+DOUBLE_BYTE_PAIR(0x95E9, 0xBEA1)
+DOUBLE_BYTE_PAIR(0x95EA, 0xBEA2)
+DOUBLE_BYTE_PAIR(0x95EB, 0xBEA3)
+DOUBLE_BYTE_PAIR(0x95EC, 0xBEA4)
+DOUBLE_BYTE_PAIR(0x95ED, 0xBEA5)
+DOUBLE_BYTE_PAIR(0x95EE, 0xBEA6)
+DOUBLE_BYTE_PAIR(0x95EF, 0xBEA7)
+DOUBLE_BYTE_PAIR(0x95F0, 0xBEA9)
+DOUBLE_BYTE_PAIR(0x95F1, 0xBEAA)
+DOUBLE_BYTE_PAIR(0x95F2, 0xBEAB)
+DOUBLE_BYTE_PAIR(0x95F3, 0xBEAC)
+DOUBLE_BYTE_PAIR(0x95F4, 0xBEAD)
+DOUBLE_BYTE_PAIR(0x95F5, 0xBEAE)
+DOUBLE_BYTE_PAIR(0x95F6, 0xBEAF)
+DOUBLE_BYTE_PAIR(0x95F7, 0xBEB0)
+DOUBLE_BYTE_PAIR(0x95F8, 0xBEB1)
+DOUBLE_BYTE_PAIR(0x95F9, 0xBEB2)
+DOUBLE_BYTE_PAIR(0x95FA, 0xBEB3)
+DOUBLE_BYTE_PAIR(0x95FB, 0xBEB4)
+DOUBLE_BYTE_PAIR(0x95FC, 0xBEB5)
+DOUBLE_BYTE_PAIR(0x95FD, 0xBEB6)
+DOUBLE_BYTE_PAIR(0x95FE, 0xBEB7)
+DOUBLE_BYTE_PAIR(0x9641, 0xBEB8)
+DOUBLE_BYTE_PAIR(0x9642, 0xBEB9)
+DOUBLE_BYTE_PAIR(0x9643, 0xBEBA)
+DOUBLE_BYTE_PAIR(0x9644, 0xBEBB)
+DOUBLE_BYTE_PAIR(0x9645, 0xBEBC)
+DOUBLE_BYTE_PAIR(0x9646, 0xBEBD)
+DOUBLE_BYTE_PAIR(0x9647, 0xBEBE)
+DOUBLE_BYTE_PAIR(0x9648, 0xBEBF)
+DOUBLE_BYTE_PAIR(0x9649, 0xBEC0)
+DOUBLE_BYTE_PAIR(0x964A, 0xBEC1)
+DOUBLE_BYTE_PAIR(0x964B, 0xBEC2)
+DOUBLE_BYTE_PAIR(0x964C, 0xBEC3)
+DOUBLE_BYTE_PAIR(0x964D, 0xBEC4)
+DOUBLE_BYTE_PAIR(0x964E, 0xBEC5)
+DOUBLE_BYTE_PAIR(0x964F, 0xBEC6)
+DOUBLE_BYTE_PAIR(0x9650, 0xBEC7)
+DOUBLE_BYTE_PAIR(0x9651, 0xBEC8)
+DOUBLE_BYTE_PAIR(0x9652, 0xBEC9)
+DOUBLE_BYTE_PAIR(0x9653, 0xBECA)
+DOUBLE_BYTE_PAIR(0x9654, 0xBECB)
+DOUBLE_BYTE_PAIR(0x9655, 0xBECC)
+DOUBLE_BYTE_PAIR(0x9656, 0xBECD)
+DOUBLE_BYTE_PAIR(0x9657, 0xBECE)
+DOUBLE_BYTE_PAIR(0x9658, 0xBECF)
+DOUBLE_BYTE_PAIR(0x9659, 0xBED2)
+DOUBLE_BYTE_PAIR(0x965A, 0xBED3)
+DOUBLE_BYTE_PAIR(0x9661, 0xBED5)
+DOUBLE_BYTE_PAIR(0x9662, 0xBED6)
+DOUBLE_BYTE_PAIR(0x9663, 0xBED9)
+DOUBLE_BYTE_PAIR(0x9664, 0xBEDA)
+DOUBLE_BYTE_PAIR(0x9665, 0xBEDB)
+DOUBLE_BYTE_PAIR(0x9666, 0xBEDC)
+DOUBLE_BYTE_PAIR(0x9667, 0xBEDD)
+DOUBLE_BYTE_PAIR(0x9668, 0xBEDE)
+DOUBLE_BYTE_PAIR(0x9669, 0xBEDF)
+DOUBLE_BYTE_PAIR(0x966A, 0xBEE1)
+DOUBLE_BYTE_PAIR(0x966B, 0xBEE2)
+DOUBLE_BYTE_PAIR(0x966C, 0xBEE6)
+DOUBLE_BYTE_PAIR(0x966D, 0xBEE7)
+DOUBLE_BYTE_PAIR(0x966E, 0xBEE8)
+DOUBLE_BYTE_PAIR(0x966F, 0xBEE9)
+DOUBLE_BYTE_PAIR(0x9670, 0xBEEA)
+DOUBLE_BYTE_PAIR(0x9671, 0xBEEB)
+DOUBLE_BYTE_PAIR(0x9672, 0xBEED)
+DOUBLE_BYTE_PAIR(0x9673, 0xBEEE)
+DOUBLE_BYTE_PAIR(0x9674, 0xBEEF)
+DOUBLE_BYTE_PAIR(0x9675, 0xBEF0)
+DOUBLE_BYTE_PAIR(0x9676, 0xBEF1)
+DOUBLE_BYTE_PAIR(0x9677, 0xBEF2)
+DOUBLE_BYTE_PAIR(0x9678, 0xBEF3)
+DOUBLE_BYTE_PAIR(0x9679, 0xBEF4)
+DOUBLE_BYTE_PAIR(0x967A, 0xBEF5)
+DOUBLE_BYTE_PAIR(0x9681, 0xBEF6)
+DOUBLE_BYTE_PAIR(0x9682, 0xBEF7)
+DOUBLE_BYTE_PAIR(0x9683, 0xBEF8)
+DOUBLE_BYTE_PAIR(0x9684, 0xBEF9)
+DOUBLE_BYTE_PAIR(0x9685, 0xBEFA)
+DOUBLE_BYTE_PAIR(0x9686, 0xBEFB)
+DOUBLE_BYTE_PAIR(0x9687, 0xBEFC)
+DOUBLE_BYTE_PAIR(0x9688, 0xBEFD)
+DOUBLE_BYTE_PAIR(0x9689, 0xBEFE)
+DOUBLE_BYTE_PAIR(0x968A, 0xBEFF)
+DOUBLE_BYTE_PAIR(0x968B, 0xBF00)
+DOUBLE_BYTE_PAIR(0x968C, 0xBF02)
+DOUBLE_BYTE_PAIR(0x968D, 0xBF03)
+DOUBLE_BYTE_PAIR(0x968E, 0xBF04)
+DOUBLE_BYTE_PAIR(0x968F, 0xBF05)
+DOUBLE_BYTE_PAIR(0x9690, 0xBF06)
+DOUBLE_BYTE_PAIR(0x9691, 0xBF07)
+DOUBLE_BYTE_PAIR(0x9692, 0xBF0A)
+DOUBLE_BYTE_PAIR(0x9693, 0xBF0B)
+DOUBLE_BYTE_PAIR(0x9694, 0xBF0C)
+DOUBLE_BYTE_PAIR(0x9695, 0xBF0D)
+DOUBLE_BYTE_PAIR(0x9696, 0xBF0E)
+DOUBLE_BYTE_PAIR(0x9697, 0xBF0F)
+DOUBLE_BYTE_PAIR(0x9698, 0xBF10)
+DOUBLE_BYTE_PAIR(0x9699, 0xBF11)
+DOUBLE_BYTE_PAIR(0x969A, 0xBF12)
+DOUBLE_BYTE_PAIR(0x969B, 0xBF13)
+DOUBLE_BYTE_PAIR(0x969C, 0xBF14)
+DOUBLE_BYTE_PAIR(0x969D, 0xBF15)
+DOUBLE_BYTE_PAIR(0x969E, 0xBF16)
+DOUBLE_BYTE_PAIR(0x969F, 0xBF17)
+DOUBLE_BYTE_PAIR(0x96A0, 0xBF1A)
+DOUBLE_BYTE_PAIR(0x96A1, 0xBF1E)
+DOUBLE_BYTE_PAIR(0x96A2, 0xBF1F)
+DOUBLE_BYTE_PAIR(0x96A3, 0xBF20)
+DOUBLE_BYTE_PAIR(0x96A4, 0xBF21)
+DOUBLE_BYTE_PAIR(0x96A5, 0xBF22)
+DOUBLE_BYTE_PAIR(0x96A6, 0xBF23)
+DOUBLE_BYTE_PAIR(0x96A7, 0xBF24)
+DOUBLE_BYTE_PAIR(0x96A8, 0xBF25)
+DOUBLE_BYTE_PAIR(0x96A9, 0xBF26)
+DOUBLE_BYTE_PAIR(0x96AA, 0xBF27)
+DOUBLE_BYTE_PAIR(0x96AB, 0xBF28)
+DOUBLE_BYTE_PAIR(0x96AC, 0xBF29)
+DOUBLE_BYTE_PAIR(0x96AD, 0xBF2A)
+DOUBLE_BYTE_PAIR(0x96AE, 0xBF2B)
+DOUBLE_BYTE_PAIR(0x96AF, 0xBF2C)
+DOUBLE_BYTE_PAIR(0x96B0, 0xBF2D)
+DOUBLE_BYTE_PAIR(0x96B1, 0xBF2E)
+DOUBLE_BYTE_PAIR(0x96B2, 0xBF2F)
+DOUBLE_BYTE_PAIR(0x96B3, 0xBF30)
+DOUBLE_BYTE_PAIR(0x96B4, 0xBF31)
+DOUBLE_BYTE_PAIR(0x96B5, 0xBF32)
+DOUBLE_BYTE_PAIR(0x96B6, 0xBF33)
+DOUBLE_BYTE_PAIR(0x96B7, 0xBF34)
+DOUBLE_BYTE_PAIR(0x96B8, 0xBF35)
+DOUBLE_BYTE_PAIR(0x96B9, 0xBF36)
+DOUBLE_BYTE_PAIR(0x96BA, 0xBF37)
+DOUBLE_BYTE_PAIR(0x96BB, 0xBF38)
+DOUBLE_BYTE_PAIR(0x96BC, 0xBF39)
+DOUBLE_BYTE_PAIR(0x96BD, 0xBF3A)
+DOUBLE_BYTE_PAIR(0x96BE, 0xBF3B)
+DOUBLE_BYTE_PAIR(0x96BF, 0xBF3C)
+DOUBLE_BYTE_PAIR(0x96C0, 0xBF3D)
+DOUBLE_BYTE_PAIR(0x96C1, 0xBF3E)
+DOUBLE_BYTE_PAIR(0x96C2, 0xBF3F)
+DOUBLE_BYTE_PAIR(0x96C3, 0xBF42)
+DOUBLE_BYTE_PAIR(0x96C4, 0xBF43)
+DOUBLE_BYTE_PAIR(0x96C5, 0xBF45)
+DOUBLE_BYTE_PAIR(0x96C6, 0xBF46)
+DOUBLE_BYTE_PAIR(0x96C7, 0xBF47)
+DOUBLE_BYTE_PAIR(0x96C8, 0xBF49)
+DOUBLE_BYTE_PAIR(0x96C9, 0xBF4A)
+DOUBLE_BYTE_PAIR(0x96CA, 0xBF4B)
+DOUBLE_BYTE_PAIR(0x96CB, 0xBF4C)
+DOUBLE_BYTE_PAIR(0x96CC, 0xBF4D)
+DOUBLE_BYTE_PAIR(0x96CD, 0xBF4E)
+DOUBLE_BYTE_PAIR(0x96CE, 0xBF4F)
+DOUBLE_BYTE_PAIR(0x96CF, 0xBF52)
+DOUBLE_BYTE_PAIR(0x96D0, 0xBF53)
+DOUBLE_BYTE_PAIR(0x96D1, 0xBF54)
+DOUBLE_BYTE_PAIR(0x96D2, 0xBF56)
+DOUBLE_BYTE_PAIR(0x96D3, 0xBF57)
+DOUBLE_BYTE_PAIR(0x96D4, 0xBF58)
+DOUBLE_BYTE_PAIR(0x96D5, 0xBF59)
+DOUBLE_BYTE_PAIR(0x96D6, 0xBF5A)
+DOUBLE_BYTE_PAIR(0x96D7, 0xBF5B)
+DOUBLE_BYTE_PAIR(0x96D8, 0xBF5C)
+DOUBLE_BYTE_PAIR(0x96D9, 0xBF5D)
+DOUBLE_BYTE_PAIR(0x96DA, 0xBF5E)
+DOUBLE_BYTE_PAIR(0x96DB, 0xBF5F)
+DOUBLE_BYTE_PAIR(0x96DC, 0xBF60)
+DOUBLE_BYTE_PAIR(0x96DD, 0xBF61)
+DOUBLE_BYTE_PAIR(0x96DE, 0xBF62)
+DOUBLE_BYTE_PAIR(0x96DF, 0xBF63)
+DOUBLE_BYTE_PAIR(0x96E0, 0xBF64)
+DOUBLE_BYTE_PAIR(0x96E1, 0xBF65)
+DOUBLE_BYTE_PAIR(0x96E2, 0xBF66)
+DOUBLE_BYTE_PAIR(0x96E3, 0xBF67)
+DOUBLE_BYTE_PAIR(0x96E4, 0xBF68)
+DOUBLE_BYTE_PAIR(0x96E5, 0xBF69)
+DOUBLE_BYTE_PAIR(0x96E6, 0xBF6A)
+DOUBLE_BYTE_PAIR(0x96E7, 0xBF6B)
+DOUBLE_BYTE_PAIR(0x96E8, 0xBF6C)
+DOUBLE_BYTE_PAIR(0x96E9, 0xBF6D)
+DOUBLE_BYTE_PAIR(0x96EA, 0xBF6E)
+DOUBLE_BYTE_PAIR(0x96EB, 0xBF6F)
+DOUBLE_BYTE_PAIR(0x96EC, 0xBF70)
+DOUBLE_BYTE_PAIR(0x96ED, 0xBF71)
+DOUBLE_BYTE_PAIR(0x96EE, 0xBF72)
+DOUBLE_BYTE_PAIR(0x96EF, 0xBF73)
+DOUBLE_BYTE_PAIR(0x96F0, 0xBF74)
+DOUBLE_BYTE_PAIR(0x96F1, 0xBF75)
+DOUBLE_BYTE_PAIR(0x96F2, 0xBF76)
+DOUBLE_BYTE_PAIR(0x96F3, 0xBF77)
+DOUBLE_BYTE_PAIR(0x96F4, 0xBF78)
+DOUBLE_BYTE_PAIR(0x96F5, 0xBF79)
+DOUBLE_BYTE_PAIR(0x96F6, 0xBF7A)
+DOUBLE_BYTE_PAIR(0x96F7, 0xBF7B)
+DOUBLE_BYTE_PAIR(0x96F8, 0xBF7C)
+DOUBLE_BYTE_PAIR(0x96F9, 0xBF7D)
+DOUBLE_BYTE_PAIR(0x96FA, 0xBF7E)
+DOUBLE_BYTE_PAIR(0x96FB, 0xBF7F)
+DOUBLE_BYTE_PAIR(0x96FC, 0xBF80)
+DOUBLE_BYTE_PAIR(0x96FD, 0xBF81)
+DOUBLE_BYTE_PAIR(0x96FE, 0xBF82)
+DOUBLE_BYTE_PAIR(0x9741, 0xBF83)
+DOUBLE_BYTE_PAIR(0x9742, 0xBF84)
+DOUBLE_BYTE_PAIR(0x9743, 0xBF85)
+DOUBLE_BYTE_PAIR(0x9744, 0xBF86)
+DOUBLE_BYTE_PAIR(0x9745, 0xBF87)
+DOUBLE_BYTE_PAIR(0x9746, 0xBF88)
+DOUBLE_BYTE_PAIR(0x9747, 0xBF89)
+DOUBLE_BYTE_PAIR(0x9748, 0xBF8A)
+DOUBLE_BYTE_PAIR(0x9749, 0xBF8B)
+DOUBLE_BYTE_PAIR(0x974A, 0xBF8C)
+DOUBLE_BYTE_PAIR(0x974B, 0xBF8D)
+DOUBLE_BYTE_PAIR(0x974C, 0xBF8E)
+DOUBLE_BYTE_PAIR(0x974D, 0xBF8F)
+DOUBLE_BYTE_PAIR(0x974E, 0xBF90)
+DOUBLE_BYTE_PAIR(0x974F, 0xBF91)
+DOUBLE_BYTE_PAIR(0x9750, 0xBF92)
+DOUBLE_BYTE_PAIR(0x9751, 0xBF93)
+DOUBLE_BYTE_PAIR(0x9752, 0xBF95)
+DOUBLE_BYTE_PAIR(0x9753, 0xBF96)
+DOUBLE_BYTE_PAIR(0x9754, 0xBF97)
+DOUBLE_BYTE_PAIR(0x9755, 0xBF98)
+DOUBLE_BYTE_PAIR(0x9756, 0xBF99)
+DOUBLE_BYTE_PAIR(0x9757, 0xBF9A)
+DOUBLE_BYTE_PAIR(0x9758, 0xBF9B)
+DOUBLE_BYTE_PAIR(0x9759, 0xBF9C)
+DOUBLE_BYTE_PAIR(0x975A, 0xBF9D)
+DOUBLE_BYTE_PAIR(0x9761, 0xBF9E)
+DOUBLE_BYTE_PAIR(0x9762, 0xBF9F)
+DOUBLE_BYTE_PAIR(0x9763, 0xBFA0)
+DOUBLE_BYTE_PAIR(0x9764, 0xBFA1)
+DOUBLE_BYTE_PAIR(0x9765, 0xBFA2)
+DOUBLE_BYTE_PAIR(0x9766, 0xBFA3)
+DOUBLE_BYTE_PAIR(0x9767, 0xBFA4)
+DOUBLE_BYTE_PAIR(0x9768, 0xBFA5)
+DOUBLE_BYTE_PAIR(0x9769, 0xBFA6)
+DOUBLE_BYTE_PAIR(0x976A, 0xBFA7)
+DOUBLE_BYTE_PAIR(0x976B, 0xBFA8)
+DOUBLE_BYTE_PAIR(0x976C, 0xBFA9)
+DOUBLE_BYTE_PAIR(0x976D, 0xBFAA)
+DOUBLE_BYTE_PAIR(0x976E, 0xBFAB)
+DOUBLE_BYTE_PAIR(0x976F, 0xBFAC)
+DOUBLE_BYTE_PAIR(0x9770, 0xBFAD)
+DOUBLE_BYTE_PAIR(0x9771, 0xBFAE)
+DOUBLE_BYTE_PAIR(0x9772, 0xBFAF)
+DOUBLE_BYTE_PAIR(0x9773, 0xBFB1)
+DOUBLE_BYTE_PAIR(0x9774, 0xBFB2)
+DOUBLE_BYTE_PAIR(0x9775, 0xBFB3)
+DOUBLE_BYTE_PAIR(0x9776, 0xBFB4)
+DOUBLE_BYTE_PAIR(0x9777, 0xBFB5)
+DOUBLE_BYTE_PAIR(0x9778, 0xBFB6)
+DOUBLE_BYTE_PAIR(0x9779, 0xBFB7)
+DOUBLE_BYTE_PAIR(0x977A, 0xBFB8)
+DOUBLE_BYTE_PAIR(0x9781, 0xBFB9)
+DOUBLE_BYTE_PAIR(0x9782, 0xBFBA)
+DOUBLE_BYTE_PAIR(0x9783, 0xBFBB)
+DOUBLE_BYTE_PAIR(0x9784, 0xBFBC)
+DOUBLE_BYTE_PAIR(0x9785, 0xBFBD)
+DOUBLE_BYTE_PAIR(0x9786, 0xBFBE)
+DOUBLE_BYTE_PAIR(0x9787, 0xBFBF)
+DOUBLE_BYTE_PAIR(0x9788, 0xBFC0)
+DOUBLE_BYTE_PAIR(0x9789, 0xBFC1)
+DOUBLE_BYTE_PAIR(0x978A, 0xBFC2)
+DOUBLE_BYTE_PAIR(0x978B, 0xBFC3)
+DOUBLE_BYTE_PAIR(0x978C, 0xBFC4)
+DOUBLE_BYTE_PAIR(0x978D, 0xBFC6)
+DOUBLE_BYTE_PAIR(0x978E, 0xBFC7)
+DOUBLE_BYTE_PAIR(0x978F, 0xBFC8)
+DOUBLE_BYTE_PAIR(0x9790, 0xBFC9)
+DOUBLE_BYTE_PAIR(0x9791, 0xBFCA)
+DOUBLE_BYTE_PAIR(0x9792, 0xBFCB)
+DOUBLE_BYTE_PAIR(0x9793, 0xBFCE)
+DOUBLE_BYTE_PAIR(0x9794, 0xBFCF)
+DOUBLE_BYTE_PAIR(0x9795, 0xBFD1)
+DOUBLE_BYTE_PAIR(0x9796, 0xBFD2)
+DOUBLE_BYTE_PAIR(0x9797, 0xBFD3)
+DOUBLE_BYTE_PAIR(0x9798, 0xBFD5)
+DOUBLE_BYTE_PAIR(0x9799, 0xBFD6)
+DOUBLE_BYTE_PAIR(0x979A, 0xBFD7)
+DOUBLE_BYTE_PAIR(0x979B, 0xBFD8)
+DOUBLE_BYTE_PAIR(0x979C, 0xBFD9)
+DOUBLE_BYTE_PAIR(0x979D, 0xBFDA)
+DOUBLE_BYTE_PAIR(0x979E, 0xBFDB)
+DOUBLE_BYTE_PAIR(0x979F, 0xBFDD)
+DOUBLE_BYTE_PAIR(0x97A0, 0xBFDE)
+DOUBLE_BYTE_PAIR(0x97A1, 0xBFE0)
+DOUBLE_BYTE_PAIR(0x97A2, 0xBFE2)
+DOUBLE_BYTE_PAIR(0x97A3, 0xBFE3)
+DOUBLE_BYTE_PAIR(0x97A4, 0xBFE4)
+DOUBLE_BYTE_PAIR(0x97A5, 0xBFE5)
+DOUBLE_BYTE_PAIR(0x97A6, 0xBFE6)
+DOUBLE_BYTE_PAIR(0x97A7, 0xBFE7)
+DOUBLE_BYTE_PAIR(0x97A8, 0xBFE8)
+DOUBLE_BYTE_PAIR(0x97A9, 0xBFE9)
+DOUBLE_BYTE_PAIR(0x97AA, 0xBFEA)
+DOUBLE_BYTE_PAIR(0x97AB, 0xBFEB)
+DOUBLE_BYTE_PAIR(0x97AC, 0xBFEC)
+DOUBLE_BYTE_PAIR(0x97AD, 0xBFED)
+DOUBLE_BYTE_PAIR(0x97AE, 0xBFEE)
+DOUBLE_BYTE_PAIR(0x97AF, 0xBFEF)
+DOUBLE_BYTE_PAIR(0x97B0, 0xBFF0)
+DOUBLE_BYTE_PAIR(0x97B1, 0xBFF1)
+DOUBLE_BYTE_PAIR(0x97B2, 0xBFF2)
+DOUBLE_BYTE_PAIR(0x97B3, 0xBFF3)
+DOUBLE_BYTE_PAIR(0x97B4, 0xBFF4)
+DOUBLE_BYTE_PAIR(0x97B5, 0xBFF5)
+DOUBLE_BYTE_PAIR(0x97B6, 0xBFF6)
+DOUBLE_BYTE_PAIR(0x97B7, 0xBFF7)
+DOUBLE_BYTE_PAIR(0x97B8, 0xBFF8)
+DOUBLE_BYTE_PAIR(0x97B9, 0xBFF9)
+DOUBLE_BYTE_PAIR(0x97BA, 0xBFFA)
+DOUBLE_BYTE_PAIR(0x97BB, 0xBFFB)
+DOUBLE_BYTE_PAIR(0x97BC, 0xBFFC)
+DOUBLE_BYTE_PAIR(0x97BD, 0xBFFD)
+DOUBLE_BYTE_PAIR(0x97BE, 0xBFFE)
+DOUBLE_BYTE_PAIR(0x97BF, 0xBFFF)
+DOUBLE_BYTE_PAIR(0x97C0, 0xC000)
+DOUBLE_BYTE_PAIR(0x97C1, 0xC001)
+DOUBLE_BYTE_PAIR(0x97C2, 0xC002)
+DOUBLE_BYTE_PAIR(0x97C3, 0xC003)
+DOUBLE_BYTE_PAIR(0x97C4, 0xC004)
+DOUBLE_BYTE_PAIR(0x97C5, 0xC005)
+DOUBLE_BYTE_PAIR(0x97C6, 0xC006)
+DOUBLE_BYTE_PAIR(0x97C7, 0xC007)
+DOUBLE_BYTE_PAIR(0x97C8, 0xC008)
+DOUBLE_BYTE_PAIR(0x97C9, 0xC009)
+DOUBLE_BYTE_PAIR(0x97CA, 0xC00A)
+DOUBLE_BYTE_PAIR(0x97CB, 0xC00B)
+DOUBLE_BYTE_PAIR(0x97CC, 0xC00C)
+DOUBLE_BYTE_PAIR(0x97CD, 0xC00D)
+DOUBLE_BYTE_PAIR(0x97CE, 0xC00E)
+DOUBLE_BYTE_PAIR(0x97CF, 0xC00F)
+DOUBLE_BYTE_PAIR(0x97D0, 0xC010)
+DOUBLE_BYTE_PAIR(0x97D1, 0xC011)
+DOUBLE_BYTE_PAIR(0x97D2, 0xC012)
+DOUBLE_BYTE_PAIR(0x97D3, 0xC013)
+DOUBLE_BYTE_PAIR(0x97D4, 0xC014)
+DOUBLE_BYTE_PAIR(0x97D5, 0xC015)
+DOUBLE_BYTE_PAIR(0x97D6, 0xC016)
+DOUBLE_BYTE_PAIR(0x97D7, 0xC017)
+DOUBLE_BYTE_PAIR(0x97D8, 0xC018)
+DOUBLE_BYTE_PAIR(0x97D9, 0xC019)
+DOUBLE_BYTE_PAIR(0x97DA, 0xC01A)
+DOUBLE_BYTE_PAIR(0x97DB, 0xC01B)
+DOUBLE_BYTE_PAIR(0x97DC, 0xC01C)
+DOUBLE_BYTE_PAIR(0x97DD, 0xC01D)
+DOUBLE_BYTE_PAIR(0x97DE, 0xC01E)
+DOUBLE_BYTE_PAIR(0x97DF, 0xC01F)
+DOUBLE_BYTE_PAIR(0x97E0, 0xC020)
+DOUBLE_BYTE_PAIR(0x97E1, 0xC021)
+DOUBLE_BYTE_PAIR(0x97E2, 0xC022)
+DOUBLE_BYTE_PAIR(0x97E3, 0xC023)
+DOUBLE_BYTE_PAIR(0x97E4, 0xC024)
+DOUBLE_BYTE_PAIR(0x97E5, 0xC025)
+DOUBLE_BYTE_PAIR(0x97E6, 0xC026)
+DOUBLE_BYTE_PAIR(0x97E7, 0xC027)
+DOUBLE_BYTE_PAIR(0x97E8, 0xC028)
+DOUBLE_BYTE_PAIR(0x97E9, 0xC029)
+DOUBLE_BYTE_PAIR(0x97EA, 0xC02A)
+DOUBLE_BYTE_PAIR(0x97EB, 0xC02B)
+DOUBLE_BYTE_PAIR(0x97EC, 0xC02C)
+DOUBLE_BYTE_PAIR(0x97ED, 0xC02D)
+DOUBLE_BYTE_PAIR(0x97EE, 0xC02E)
+DOUBLE_BYTE_PAIR(0x97EF, 0xC02F)
+DOUBLE_BYTE_PAIR(0x97F0, 0xC030)
+DOUBLE_BYTE_PAIR(0x97F1, 0xC031)
+DOUBLE_BYTE_PAIR(0x97F2, 0xC032)
+DOUBLE_BYTE_PAIR(0x97F3, 0xC033)
+DOUBLE_BYTE_PAIR(0x97F4, 0xC034)
+DOUBLE_BYTE_PAIR(0x97F5, 0xC035)
+DOUBLE_BYTE_PAIR(0x97F6, 0xC036)
+DOUBLE_BYTE_PAIR(0x97F7, 0xC037)
+DOUBLE_BYTE_PAIR(0x97F8, 0xC038)
+DOUBLE_BYTE_PAIR(0x97F9, 0xC039)
+DOUBLE_BYTE_PAIR(0x97FA, 0xC03A)
+DOUBLE_BYTE_PAIR(0x97FB, 0xC03B)
+DOUBLE_BYTE_PAIR(0x97FC, 0xC03D)
+DOUBLE_BYTE_PAIR(0x97FD, 0xC03E)
+DOUBLE_BYTE_PAIR(0x97FE, 0xC03F)
+DOUBLE_BYTE_PAIR(0x9841, 0xC040)
+DOUBLE_BYTE_PAIR(0x9842, 0xC041)
+DOUBLE_BYTE_PAIR(0x9843, 0xC042)
+DOUBLE_BYTE_PAIR(0x9844, 0xC043)
+DOUBLE_BYTE_PAIR(0x9845, 0xC044)
+DOUBLE_BYTE_PAIR(0x9846, 0xC045)
+DOUBLE_BYTE_PAIR(0x9847, 0xC046)
+DOUBLE_BYTE_PAIR(0x9848, 0xC047)
+DOUBLE_BYTE_PAIR(0x9849, 0xC048)
+DOUBLE_BYTE_PAIR(0x984A, 0xC049)
+DOUBLE_BYTE_PAIR(0x984B, 0xC04A)
+DOUBLE_BYTE_PAIR(0x984C, 0xC04B)
+DOUBLE_BYTE_PAIR(0x984D, 0xC04C)
+DOUBLE_BYTE_PAIR(0x984E, 0xC04D)
+DOUBLE_BYTE_PAIR(0x984F, 0xC04E)
+DOUBLE_BYTE_PAIR(0x9850, 0xC04F)
+DOUBLE_BYTE_PAIR(0x9851, 0xC050)
+DOUBLE_BYTE_PAIR(0x9852, 0xC052)
+DOUBLE_BYTE_PAIR(0x9853, 0xC053)
+DOUBLE_BYTE_PAIR(0x9854, 0xC054)
+DOUBLE_BYTE_PAIR(0x9855, 0xC055)
+DOUBLE_BYTE_PAIR(0x9856, 0xC056)
+DOUBLE_BYTE_PAIR(0x9857, 0xC057)
+DOUBLE_BYTE_PAIR(0x9858, 0xC059)
+DOUBLE_BYTE_PAIR(0x9859, 0xC05A)
+DOUBLE_BYTE_PAIR(0x985A, 0xC05B)
+DOUBLE_BYTE_PAIR(0x9861, 0xC05D)
+DOUBLE_BYTE_PAIR(0x9862, 0xC05E)
+DOUBLE_BYTE_PAIR(0x9863, 0xC05F)
+DOUBLE_BYTE_PAIR(0x9864, 0xC061)
+DOUBLE_BYTE_PAIR(0x9865, 0xC062)
+DOUBLE_BYTE_PAIR(0x9866, 0xC063)
+DOUBLE_BYTE_PAIR(0x9867, 0xC064)
+DOUBLE_BYTE_PAIR(0x9868, 0xC065)
+DOUBLE_BYTE_PAIR(0x9869, 0xC066)
+DOUBLE_BYTE_PAIR(0x986A, 0xC067)
+DOUBLE_BYTE_PAIR(0x986B, 0xC06A)
+DOUBLE_BYTE_PAIR(0x986C, 0xC06B)
+DOUBLE_BYTE_PAIR(0x986D, 0xC06C)
+DOUBLE_BYTE_PAIR(0x986E, 0xC06D)
+DOUBLE_BYTE_PAIR(0x986F, 0xC06E)
+DOUBLE_BYTE_PAIR(0x9870, 0xC06F)
+DOUBLE_BYTE_PAIR(0x9871, 0xC070)
+DOUBLE_BYTE_PAIR(0x9872, 0xC071)
+DOUBLE_BYTE_PAIR(0x9873, 0xC072)
+DOUBLE_BYTE_PAIR(0x9874, 0xC073)
+DOUBLE_BYTE_PAIR(0x9875, 0xC074)
+DOUBLE_BYTE_PAIR(0x9876, 0xC075)
+DOUBLE_BYTE_PAIR(0x9877, 0xC076)
+DOUBLE_BYTE_PAIR(0x9878, 0xC077)
+DOUBLE_BYTE_PAIR(0x9879, 0xC078)
+DOUBLE_BYTE_PAIR(0x987A, 0xC079)
+DOUBLE_BYTE_PAIR(0x9881, 0xC07A)
+DOUBLE_BYTE_PAIR(0x9882, 0xC07B)
+DOUBLE_BYTE_PAIR(0x9883, 0xC07C)
+DOUBLE_BYTE_PAIR(0x9884, 0xC07D)
+DOUBLE_BYTE_PAIR(0x9885, 0xC07E)
+DOUBLE_BYTE_PAIR(0x9886, 0xC07F)
+DOUBLE_BYTE_PAIR(0x9887, 0xC080)
+DOUBLE_BYTE_PAIR(0x9888, 0xC081)
+DOUBLE_BYTE_PAIR(0x9889, 0xC082)
+DOUBLE_BYTE_PAIR(0x988A, 0xC083)
+DOUBLE_BYTE_PAIR(0x988B, 0xC084)
+DOUBLE_BYTE_PAIR(0x988C, 0xC085)
+DOUBLE_BYTE_PAIR(0x988D, 0xC086)
+DOUBLE_BYTE_PAIR(0x988E, 0xC087)
+DOUBLE_BYTE_PAIR(0x988F, 0xC088)
+DOUBLE_BYTE_PAIR(0x9890, 0xC089)
+DOUBLE_BYTE_PAIR(0x9891, 0xC08A)
+DOUBLE_BYTE_PAIR(0x9892, 0xC08B)
+DOUBLE_BYTE_PAIR(0x9893, 0xC08C)
+DOUBLE_BYTE_PAIR(0x9894, 0xC08D)
+DOUBLE_BYTE_PAIR(0x9895, 0xC08E)
+DOUBLE_BYTE_PAIR(0x9896, 0xC08F)
+DOUBLE_BYTE_PAIR(0x9897, 0xC092)
+DOUBLE_BYTE_PAIR(0x9898, 0xC093)
+DOUBLE_BYTE_PAIR(0x9899, 0xC095)
+DOUBLE_BYTE_PAIR(0x989A, 0xC096)
+DOUBLE_BYTE_PAIR(0x989B, 0xC097)
+DOUBLE_BYTE_PAIR(0x989C, 0xC099)
+DOUBLE_BYTE_PAIR(0x989D, 0xC09A)
+DOUBLE_BYTE_PAIR(0x989E, 0xC09B)
+DOUBLE_BYTE_PAIR(0x989F, 0xC09C)
+DOUBLE_BYTE_PAIR(0x98A0, 0xC09D)
+DOUBLE_BYTE_PAIR(0x98A1, 0xC09E)
+DOUBLE_BYTE_PAIR(0x98A2, 0xC09F)
+DOUBLE_BYTE_PAIR(0x98A3, 0xC0A2)
+DOUBLE_BYTE_PAIR(0x98A4, 0xC0A4)
+DOUBLE_BYTE_PAIR(0x98A5, 0xC0A6)
+DOUBLE_BYTE_PAIR(0x98A6, 0xC0A7)
+DOUBLE_BYTE_PAIR(0x98A7, 0xC0A8)
+DOUBLE_BYTE_PAIR(0x98A8, 0xC0A9)
+DOUBLE_BYTE_PAIR(0x98A9, 0xC0AA)
+DOUBLE_BYTE_PAIR(0x98AA, 0xC0AB)
+DOUBLE_BYTE_PAIR(0x98AB, 0xC0AE)
+DOUBLE_BYTE_PAIR(0x98AC, 0xC0B1)
+DOUBLE_BYTE_PAIR(0x98AD, 0xC0B2)
+DOUBLE_BYTE_PAIR(0x98AE, 0xC0B7)
+DOUBLE_BYTE_PAIR(0x98AF, 0xC0B8)
+DOUBLE_BYTE_PAIR(0x98B0, 0xC0B9)
+DOUBLE_BYTE_PAIR(0x98B1, 0xC0BA)
+DOUBLE_BYTE_PAIR(0x98B2, 0xC0BB)
+DOUBLE_BYTE_PAIR(0x98B3, 0xC0BE)
+DOUBLE_BYTE_PAIR(0x98B4, 0xC0C2)
+DOUBLE_BYTE_PAIR(0x98B5, 0xC0C3)
+DOUBLE_BYTE_PAIR(0x98B6, 0xC0C4)
+DOUBLE_BYTE_PAIR(0x98B7, 0xC0C6)
+DOUBLE_BYTE_PAIR(0x98B8, 0xC0C7)
+DOUBLE_BYTE_PAIR(0x98B9, 0xC0CA)
+DOUBLE_BYTE_PAIR(0x98BA, 0xC0CB)
+DOUBLE_BYTE_PAIR(0x98BB, 0xC0CD)
+DOUBLE_BYTE_PAIR(0x98BC, 0xC0CE)
+DOUBLE_BYTE_PAIR(0x98BD, 0xC0CF)
+DOUBLE_BYTE_PAIR(0x98BE, 0xC0D1)
+DOUBLE_BYTE_PAIR(0x98BF, 0xC0D2)
+DOUBLE_BYTE_PAIR(0x98C0, 0xC0D3)
+DOUBLE_BYTE_PAIR(0x98C1, 0xC0D4)
+DOUBLE_BYTE_PAIR(0x98C2, 0xC0D5)
+DOUBLE_BYTE_PAIR(0x98C3, 0xC0D6)
+DOUBLE_BYTE_PAIR(0x98C4, 0xC0D7)
+DOUBLE_BYTE_PAIR(0x98C5, 0xC0DA)
+DOUBLE_BYTE_PAIR(0x98C6, 0xC0DE)
+DOUBLE_BYTE_PAIR(0x98C7, 0xC0DF)
+DOUBLE_BYTE_PAIR(0x98C8, 0xC0E0)
+DOUBLE_BYTE_PAIR(0x98C9, 0xC0E1)
+DOUBLE_BYTE_PAIR(0x98CA, 0xC0E2)
+DOUBLE_BYTE_PAIR(0x98CB, 0xC0E3)
+DOUBLE_BYTE_PAIR(0x98CC, 0xC0E6)
+DOUBLE_BYTE_PAIR(0x98CD, 0xC0E7)
+DOUBLE_BYTE_PAIR(0x98CE, 0xC0E9)
+DOUBLE_BYTE_PAIR(0x98CF, 0xC0EA)
+DOUBLE_BYTE_PAIR(0x98D0, 0xC0EB)
+DOUBLE_BYTE_PAIR(0x98D1, 0xC0ED)
+DOUBLE_BYTE_PAIR(0x98D2, 0xC0EE)
+DOUBLE_BYTE_PAIR(0x98D3, 0xC0EF)
+DOUBLE_BYTE_PAIR(0x98D4, 0xC0F0)
+DOUBLE_BYTE_PAIR(0x98D5, 0xC0F1)
+DOUBLE_BYTE_PAIR(0x98D6, 0xC0F2)
+DOUBLE_BYTE_PAIR(0x98D7, 0xC0F3)
+DOUBLE_BYTE_PAIR(0x98D8, 0xC0F6)
+DOUBLE_BYTE_PAIR(0x98D9, 0xC0F8)
+DOUBLE_BYTE_PAIR(0x98DA, 0xC0FA)
+DOUBLE_BYTE_PAIR(0x98DB, 0xC0FB)
+DOUBLE_BYTE_PAIR(0x98DC, 0xC0FC)
+DOUBLE_BYTE_PAIR(0x98DD, 0xC0FD)
+DOUBLE_BYTE_PAIR(0x98DE, 0xC0FE)
+DOUBLE_BYTE_PAIR(0x98DF, 0xC0FF)
+DOUBLE_BYTE_PAIR(0x98E0, 0xC101)
+DOUBLE_BYTE_PAIR(0x98E1, 0xC102)
+DOUBLE_BYTE_PAIR(0x98E2, 0xC103)
+DOUBLE_BYTE_PAIR(0x98E3, 0xC105)
+DOUBLE_BYTE_PAIR(0x98E4, 0xC106)
+DOUBLE_BYTE_PAIR(0x98E5, 0xC107)
+DOUBLE_BYTE_PAIR(0x98E6, 0xC109)
+DOUBLE_BYTE_PAIR(0x98E7, 0xC10A)
+DOUBLE_BYTE_PAIR(0x98E8, 0xC10B)
+DOUBLE_BYTE_PAIR(0x98E9, 0xC10C)
+DOUBLE_BYTE_PAIR(0x98EA, 0xC10D)
+DOUBLE_BYTE_PAIR(0x98EB, 0xC10E)
+DOUBLE_BYTE_PAIR(0x98EC, 0xC10F)
+DOUBLE_BYTE_PAIR(0x98ED, 0xC111)
+DOUBLE_BYTE_PAIR(0x98EE, 0xC112)
+DOUBLE_BYTE_PAIR(0x98EF, 0xC113)
+DOUBLE_BYTE_PAIR(0x98F0, 0xC114)
+DOUBLE_BYTE_PAIR(0x98F1, 0xC116)
+DOUBLE_BYTE_PAIR(0x98F2, 0xC117)
+DOUBLE_BYTE_PAIR(0x98F3, 0xC118)
+DOUBLE_BYTE_PAIR(0x98F4, 0xC119)
+DOUBLE_BYTE_PAIR(0x98F5, 0xC11A)
+DOUBLE_BYTE_PAIR(0x98F6, 0xC11B)
+DOUBLE_BYTE_PAIR(0x98F7, 0xC121)
+DOUBLE_BYTE_PAIR(0x98F8, 0xC122)
+DOUBLE_BYTE_PAIR(0x98F9, 0xC125)
+DOUBLE_BYTE_PAIR(0x98FA, 0xC128)
+DOUBLE_BYTE_PAIR(0x98FB, 0xC129)
+DOUBLE_BYTE_PAIR(0x98FC, 0xC12A)
+DOUBLE_BYTE_PAIR(0x98FD, 0xC12B)
+DOUBLE_BYTE_PAIR(0x98FE, 0xC12E)
+DOUBLE_BYTE_PAIR(0x9941, 0xC132)
+DOUBLE_BYTE_PAIR(0x9942, 0xC133)
+DOUBLE_BYTE_PAIR(0x9943, 0xC134)
+DOUBLE_BYTE_PAIR(0x9944, 0xC135)
+DOUBLE_BYTE_PAIR(0x9945, 0xC137)
+DOUBLE_BYTE_PAIR(0x9946, 0xC13A)
+DOUBLE_BYTE_PAIR(0x9947, 0xC13B)
+DOUBLE_BYTE_PAIR(0x9948, 0xC13D)
+DOUBLE_BYTE_PAIR(0x9949, 0xC13E)
+DOUBLE_BYTE_PAIR(0x994A, 0xC13F)
+DOUBLE_BYTE_PAIR(0x994B, 0xC141)
+DOUBLE_BYTE_PAIR(0x994C, 0xC142)
+DOUBLE_BYTE_PAIR(0x994D, 0xC143)
+DOUBLE_BYTE_PAIR(0x994E, 0xC144)
+DOUBLE_BYTE_PAIR(0x994F, 0xC145)
+DOUBLE_BYTE_PAIR(0x9950, 0xC146)
+DOUBLE_BYTE_PAIR(0x9951, 0xC147)
+DOUBLE_BYTE_PAIR(0x9952, 0xC14A)
+DOUBLE_BYTE_PAIR(0x9953, 0xC14E)
+DOUBLE_BYTE_PAIR(0x9954, 0xC14F)
+DOUBLE_BYTE_PAIR(0x9955, 0xC150)
+DOUBLE_BYTE_PAIR(0x9956, 0xC151)
+DOUBLE_BYTE_PAIR(0x9957, 0xC152)
+DOUBLE_BYTE_PAIR(0x9958, 0xC153)
+DOUBLE_BYTE_PAIR(0x9959, 0xC156)
+DOUBLE_BYTE_PAIR(0x995A, 0xC157)
+DOUBLE_BYTE_PAIR(0x9961, 0xC159)
+DOUBLE_BYTE_PAIR(0x9962, 0xC15A)
+DOUBLE_BYTE_PAIR(0x9963, 0xC15B)
+DOUBLE_BYTE_PAIR(0x9964, 0xC15D)
+DOUBLE_BYTE_PAIR(0x9965, 0xC15E)
+DOUBLE_BYTE_PAIR(0x9966, 0xC15F)
+DOUBLE_BYTE_PAIR(0x9967, 0xC160)
+DOUBLE_BYTE_PAIR(0x9968, 0xC161)
+DOUBLE_BYTE_PAIR(0x9969, 0xC162)
+DOUBLE_BYTE_PAIR(0x996A, 0xC163)
+DOUBLE_BYTE_PAIR(0x996B, 0xC166)
+DOUBLE_BYTE_PAIR(0x996C, 0xC16A)
+DOUBLE_BYTE_PAIR(0x996D, 0xC16B)
+DOUBLE_BYTE_PAIR(0x996E, 0xC16C)
+DOUBLE_BYTE_PAIR(0x996F, 0xC16D)
+DOUBLE_BYTE_PAIR(0x9970, 0xC16E)
+DOUBLE_BYTE_PAIR(0x9971, 0xC16F)
+DOUBLE_BYTE_PAIR(0x9972, 0xC171)
+DOUBLE_BYTE_PAIR(0x9973, 0xC172)
+DOUBLE_BYTE_PAIR(0x9974, 0xC173)
+DOUBLE_BYTE_PAIR(0x9975, 0xC175)
+DOUBLE_BYTE_PAIR(0x9976, 0xC176)
+DOUBLE_BYTE_PAIR(0x9977, 0xC177)
+DOUBLE_BYTE_PAIR(0x9978, 0xC179)
+DOUBLE_BYTE_PAIR(0x9979, 0xC17A)
+DOUBLE_BYTE_PAIR(0x997A, 0xC17B)
+DOUBLE_BYTE_PAIR(0x9981, 0xC17C)
+DOUBLE_BYTE_PAIR(0x9982, 0xC17D)
+DOUBLE_BYTE_PAIR(0x9983, 0xC17E)
+DOUBLE_BYTE_PAIR(0x9984, 0xC17F)
+DOUBLE_BYTE_PAIR(0x9985, 0xC180)
+DOUBLE_BYTE_PAIR(0x9986, 0xC181)
+DOUBLE_BYTE_PAIR(0x9987, 0xC182)
+DOUBLE_BYTE_PAIR(0x9988, 0xC183)
+DOUBLE_BYTE_PAIR(0x9989, 0xC184)
+DOUBLE_BYTE_PAIR(0x998A, 0xC186)
+DOUBLE_BYTE_PAIR(0x998B, 0xC187)
+DOUBLE_BYTE_PAIR(0x998C, 0xC188)
+DOUBLE_BYTE_PAIR(0x998D, 0xC189)
+DOUBLE_BYTE_PAIR(0x998E, 0xC18A)
+DOUBLE_BYTE_PAIR(0x998F, 0xC18B)
+DOUBLE_BYTE_PAIR(0x9990, 0xC18F)
+DOUBLE_BYTE_PAIR(0x9991, 0xC191)
+DOUBLE_BYTE_PAIR(0x9992, 0xC192)
+DOUBLE_BYTE_PAIR(0x9993, 0xC193)
+DOUBLE_BYTE_PAIR(0x9994, 0xC195)
+DOUBLE_BYTE_PAIR(0x9995, 0xC197)
+DOUBLE_BYTE_PAIR(0x9996, 0xC198)
+DOUBLE_BYTE_PAIR(0x9997, 0xC199)
+DOUBLE_BYTE_PAIR(0x9998, 0xC19A)
+DOUBLE_BYTE_PAIR(0x9999, 0xC19B)
+DOUBLE_BYTE_PAIR(0x999A, 0xC19E)
+DOUBLE_BYTE_PAIR(0x999B, 0xC1A0)
+DOUBLE_BYTE_PAIR(0x999C, 0xC1A2)
+DOUBLE_BYTE_PAIR(0x999D, 0xC1A3)
+DOUBLE_BYTE_PAIR(0x999E, 0xC1A4)
+DOUBLE_BYTE_PAIR(0x999F, 0xC1A6)
+DOUBLE_BYTE_PAIR(0x99A0, 0xC1A7)
+DOUBLE_BYTE_PAIR(0x99A1, 0xC1AA)
+DOUBLE_BYTE_PAIR(0x99A2, 0xC1AB)
+DOUBLE_BYTE_PAIR(0x99A3, 0xC1AD)
+DOUBLE_BYTE_PAIR(0x99A4, 0xC1AE)
+DOUBLE_BYTE_PAIR(0x99A5, 0xC1AF)
+DOUBLE_BYTE_PAIR(0x99A6, 0xC1B1)
+DOUBLE_BYTE_PAIR(0x99A7, 0xC1B2)
+DOUBLE_BYTE_PAIR(0x99A8, 0xC1B3)
+DOUBLE_BYTE_PAIR(0x99A9, 0xC1B4)
+DOUBLE_BYTE_PAIR(0x99AA, 0xC1B5)
+DOUBLE_BYTE_PAIR(0x99AB, 0xC1B6)
+DOUBLE_BYTE_PAIR(0x99AC, 0xC1B7)
+DOUBLE_BYTE_PAIR(0x99AD, 0xC1B8)
+DOUBLE_BYTE_PAIR(0x99AE, 0xC1B9)
+DOUBLE_BYTE_PAIR(0x99AF, 0xC1BA)
+DOUBLE_BYTE_PAIR(0x99B0, 0xC1BB)
+DOUBLE_BYTE_PAIR(0x99B1, 0xC1BC)
+DOUBLE_BYTE_PAIR(0x99B2, 0xC1BE)
+DOUBLE_BYTE_PAIR(0x99B3, 0xC1BF)
+DOUBLE_BYTE_PAIR(0x99B4, 0xC1C0)
+DOUBLE_BYTE_PAIR(0x99B5, 0xC1C1)
+DOUBLE_BYTE_PAIR(0x99B6, 0xC1C2)
+DOUBLE_BYTE_PAIR(0x99B7, 0xC1C3)
+DOUBLE_BYTE_PAIR(0x99B8, 0xC1C5)
+DOUBLE_BYTE_PAIR(0x99B9, 0xC1C6)
+DOUBLE_BYTE_PAIR(0x99BA, 0xC1C7)
+DOUBLE_BYTE_PAIR(0x99BB, 0xC1C9)
+DOUBLE_BYTE_PAIR(0x99BC, 0xC1CA)
+DOUBLE_BYTE_PAIR(0x99BD, 0xC1CB)
+DOUBLE_BYTE_PAIR(0x99BE, 0xC1CD)
+DOUBLE_BYTE_PAIR(0x99BF, 0xC1CE)
+DOUBLE_BYTE_PAIR(0x99C0, 0xC1CF)
+DOUBLE_BYTE_PAIR(0x99C1, 0xC1D0)
+DOUBLE_BYTE_PAIR(0x99C2, 0xC1D1)
+DOUBLE_BYTE_PAIR(0x99C3, 0xC1D2)
+DOUBLE_BYTE_PAIR(0x99C4, 0xC1D3)
+DOUBLE_BYTE_PAIR(0x99C5, 0xC1D5)
+DOUBLE_BYTE_PAIR(0x99C6, 0xC1D6)
+DOUBLE_BYTE_PAIR(0x99C7, 0xC1D9)
+DOUBLE_BYTE_PAIR(0x99C8, 0xC1DA)
+DOUBLE_BYTE_PAIR(0x99C9, 0xC1DB)
+DOUBLE_BYTE_PAIR(0x99CA, 0xC1DC)
+DOUBLE_BYTE_PAIR(0x99CB, 0xC1DD)
+DOUBLE_BYTE_PAIR(0x99CC, 0xC1DE)
+DOUBLE_BYTE_PAIR(0x99CD, 0xC1DF)
+DOUBLE_BYTE_PAIR(0x99CE, 0xC1E1)
+DOUBLE_BYTE_PAIR(0x99CF, 0xC1E2)
+DOUBLE_BYTE_PAIR(0x99D0, 0xC1E3)
+DOUBLE_BYTE_PAIR(0x99D1, 0xC1E5)
+DOUBLE_BYTE_PAIR(0x99D2, 0xC1E6)
+DOUBLE_BYTE_PAIR(0x99D3, 0xC1E7)
+DOUBLE_BYTE_PAIR(0x99D4, 0xC1E9)
+DOUBLE_BYTE_PAIR(0x99D5, 0xC1EA)
+DOUBLE_BYTE_PAIR(0x99D6, 0xC1EB)
+DOUBLE_BYTE_PAIR(0x99D7, 0xC1EC)
+DOUBLE_BYTE_PAIR(0x99D8, 0xC1ED)
+DOUBLE_BYTE_PAIR(0x99D9, 0xC1EE)
+DOUBLE_BYTE_PAIR(0x99DA, 0xC1EF)
+DOUBLE_BYTE_PAIR(0x99DB, 0xC1F2)
+DOUBLE_BYTE_PAIR(0x99DC, 0xC1F4)
+DOUBLE_BYTE_PAIR(0x99DD, 0xC1F5)
+DOUBLE_BYTE_PAIR(0x99DE, 0xC1F6)
+DOUBLE_BYTE_PAIR(0x99DF, 0xC1F7)
+DOUBLE_BYTE_PAIR(0x99E0, 0xC1F8)
+DOUBLE_BYTE_PAIR(0x99E1, 0xC1F9)
+DOUBLE_BYTE_PAIR(0x99E2, 0xC1FA)
+DOUBLE_BYTE_PAIR(0x99E3, 0xC1FB)
+DOUBLE_BYTE_PAIR(0x99E4, 0xC1FE)
+DOUBLE_BYTE_PAIR(0x99E5, 0xC1FF)
+DOUBLE_BYTE_PAIR(0x99E6, 0xC201)
+DOUBLE_BYTE_PAIR(0x99E7, 0xC202)
+DOUBLE_BYTE_PAIR(0x99E8, 0xC203)
+DOUBLE_BYTE_PAIR(0x99E9, 0xC205)
+DOUBLE_BYTE_PAIR(0x99EA, 0xC206)
+DOUBLE_BYTE_PAIR(0x99EB, 0xC207)
+DOUBLE_BYTE_PAIR(0x99EC, 0xC208)
+DOUBLE_BYTE_PAIR(0x99ED, 0xC209)
+DOUBLE_BYTE_PAIR(0x99EE, 0xC20A)
+DOUBLE_BYTE_PAIR(0x99EF, 0xC20B)
+DOUBLE_BYTE_PAIR(0x99F0, 0xC20E)
+DOUBLE_BYTE_PAIR(0x99F1, 0xC210)
+DOUBLE_BYTE_PAIR(0x99F2, 0xC212)
+DOUBLE_BYTE_PAIR(0x99F3, 0xC213)
+DOUBLE_BYTE_PAIR(0x99F4, 0xC214)
+DOUBLE_BYTE_PAIR(0x99F5, 0xC215)
+DOUBLE_BYTE_PAIR(0x99F6, 0xC216)
+DOUBLE_BYTE_PAIR(0x99F7, 0xC217)
+DOUBLE_BYTE_PAIR(0x99F8, 0xC21A)
+DOUBLE_BYTE_PAIR(0x99F9, 0xC21B)
+DOUBLE_BYTE_PAIR(0x99FA, 0xC21D)
+DOUBLE_BYTE_PAIR(0x99FB, 0xC21E)
+DOUBLE_BYTE_PAIR(0x99FC, 0xC221)
+DOUBLE_BYTE_PAIR(0x99FD, 0xC222)
+DOUBLE_BYTE_PAIR(0x99FE, 0xC223)
+DOUBLE_BYTE_PAIR(0x9A41, 0xC224)
+DOUBLE_BYTE_PAIR(0x9A42, 0xC225)
+DOUBLE_BYTE_PAIR(0x9A43, 0xC226)
+DOUBLE_BYTE_PAIR(0x9A44, 0xC227)
+DOUBLE_BYTE_PAIR(0x9A45, 0xC22A)
+DOUBLE_BYTE_PAIR(0x9A46, 0xC22C)
+DOUBLE_BYTE_PAIR(0x9A47, 0xC22E)
+DOUBLE_BYTE_PAIR(0x9A48, 0xC230)
+DOUBLE_BYTE_PAIR(0x9A49, 0xC233)
+DOUBLE_BYTE_PAIR(0x9A4A, 0xC235)
+DOUBLE_BYTE_PAIR(0x9A4B, 0xC236)
+DOUBLE_BYTE_PAIR(0x9A4C, 0xC237)
+DOUBLE_BYTE_PAIR(0x9A4D, 0xC238)
+DOUBLE_BYTE_PAIR(0x9A4E, 0xC239)
+DOUBLE_BYTE_PAIR(0x9A4F, 0xC23A)
+DOUBLE_BYTE_PAIR(0x9A50, 0xC23B)
+DOUBLE_BYTE_PAIR(0x9A51, 0xC23C)
+DOUBLE_BYTE_PAIR(0x9A52, 0xC23D)
+DOUBLE_BYTE_PAIR(0x9A53, 0xC23E)
+DOUBLE_BYTE_PAIR(0x9A54, 0xC23F)
+DOUBLE_BYTE_PAIR(0x9A55, 0xC240)
+DOUBLE_BYTE_PAIR(0x9A56, 0xC241)
+DOUBLE_BYTE_PAIR(0x9A57, 0xC242)
+DOUBLE_BYTE_PAIR(0x9A58, 0xC243)
+DOUBLE_BYTE_PAIR(0x9A59, 0xC244)
+DOUBLE_BYTE_PAIR(0x9A5A, 0xC245)
+DOUBLE_BYTE_PAIR(0x9A61, 0xC246)
+DOUBLE_BYTE_PAIR(0x9A62, 0xC247)
+DOUBLE_BYTE_PAIR(0x9A63, 0xC249)
+DOUBLE_BYTE_PAIR(0x9A64, 0xC24A)
+DOUBLE_BYTE_PAIR(0x9A65, 0xC24B)
+DOUBLE_BYTE_PAIR(0x9A66, 0xC24C)
+DOUBLE_BYTE_PAIR(0x9A67, 0xC24D)
+DOUBLE_BYTE_PAIR(0x9A68, 0xC24E)
+DOUBLE_BYTE_PAIR(0x9A69, 0xC24F)
+DOUBLE_BYTE_PAIR(0x9A6A, 0xC252)
+DOUBLE_BYTE_PAIR(0x9A6B, 0xC253)
+DOUBLE_BYTE_PAIR(0x9A6C, 0xC255)
+DOUBLE_BYTE_PAIR(0x9A6D, 0xC256)
+DOUBLE_BYTE_PAIR(0x9A6E, 0xC257)
+DOUBLE_BYTE_PAIR(0x9A6F, 0xC259)
+DOUBLE_BYTE_PAIR(0x9A70, 0xC25A)
+DOUBLE_BYTE_PAIR(0x9A71, 0xC25B)
+DOUBLE_BYTE_PAIR(0x9A72, 0xC25C)
+DOUBLE_BYTE_PAIR(0x9A73, 0xC25D)
+DOUBLE_BYTE_PAIR(0x9A74, 0xC25E)
+DOUBLE_BYTE_PAIR(0x9A75, 0xC25F)
+DOUBLE_BYTE_PAIR(0x9A76, 0xC261)
+DOUBLE_BYTE_PAIR(0x9A77, 0xC262)
+DOUBLE_BYTE_PAIR(0x9A78, 0xC263)
+DOUBLE_BYTE_PAIR(0x9A79, 0xC264)
+DOUBLE_BYTE_PAIR(0x9A7A, 0xC266)
+DOUBLE_BYTE_PAIR(0x9A81, 0xC267)
+DOUBLE_BYTE_PAIR(0x9A82, 0xC268)
+DOUBLE_BYTE_PAIR(0x9A83, 0xC269)
+DOUBLE_BYTE_PAIR(0x9A84, 0xC26A)
+DOUBLE_BYTE_PAIR(0x9A85, 0xC26B)
+DOUBLE_BYTE_PAIR(0x9A86, 0xC26E)
+DOUBLE_BYTE_PAIR(0x9A87, 0xC26F)
+DOUBLE_BYTE_PAIR(0x9A88, 0xC271)
+DOUBLE_BYTE_PAIR(0x9A89, 0xC272)
+DOUBLE_BYTE_PAIR(0x9A8A, 0xC273)
+DOUBLE_BYTE_PAIR(0x9A8B, 0xC275)
+DOUBLE_BYTE_PAIR(0x9A8C, 0xC276)
+DOUBLE_BYTE_PAIR(0x9A8D, 0xC277)
+DOUBLE_BYTE_PAIR(0x9A8E, 0xC278)
+DOUBLE_BYTE_PAIR(0x9A8F, 0xC279)
+DOUBLE_BYTE_PAIR(0x9A90, 0xC27A)
+DOUBLE_BYTE_PAIR(0x9A91, 0xC27B)
+DOUBLE_BYTE_PAIR(0x9A92, 0xC27E)
+DOUBLE_BYTE_PAIR(0x9A93, 0xC280)
+DOUBLE_BYTE_PAIR(0x9A94, 0xC282)
+DOUBLE_BYTE_PAIR(0x9A95, 0xC283)
+DOUBLE_BYTE_PAIR(0x9A96, 0xC284)
+DOUBLE_BYTE_PAIR(0x9A97, 0xC285)
+DOUBLE_BYTE_PAIR(0x9A98, 0xC286)
+DOUBLE_BYTE_PAIR(0x9A99, 0xC287)
+DOUBLE_BYTE_PAIR(0x9A9A, 0xC28A)
+DOUBLE_BYTE_PAIR(0x9A9B, 0xC28B)
+DOUBLE_BYTE_PAIR(0x9A9C, 0xC28C)
+DOUBLE_BYTE_PAIR(0x9A9D, 0xC28D)
+DOUBLE_BYTE_PAIR(0x9A9E, 0xC28E)
+DOUBLE_BYTE_PAIR(0x9A9F, 0xC28F)
+DOUBLE_BYTE_PAIR(0x9AA0, 0xC291)
+DOUBLE_BYTE_PAIR(0x9AA1, 0xC292)
+DOUBLE_BYTE_PAIR(0x9AA2, 0xC293)
+DOUBLE_BYTE_PAIR(0x9AA3, 0xC294)
+DOUBLE_BYTE_PAIR(0x9AA4, 0xC295)
+DOUBLE_BYTE_PAIR(0x9AA5, 0xC296)
+DOUBLE_BYTE_PAIR(0x9AA6, 0xC297)
+DOUBLE_BYTE_PAIR(0x9AA7, 0xC299)
+DOUBLE_BYTE_PAIR(0x9AA8, 0xC29A)
+DOUBLE_BYTE_PAIR(0x9AA9, 0xC29C)
+DOUBLE_BYTE_PAIR(0x9AAA, 0xC29E)
+DOUBLE_BYTE_PAIR(0x9AAB, 0xC29F)
+DOUBLE_BYTE_PAIR(0x9AAC, 0xC2A0)
+DOUBLE_BYTE_PAIR(0x9AAD, 0xC2A1)
+DOUBLE_BYTE_PAIR(0x9AAE, 0xC2A2)
+DOUBLE_BYTE_PAIR(0x9AAF, 0xC2A3)
+DOUBLE_BYTE_PAIR(0x9AB0, 0xC2A6)
+DOUBLE_BYTE_PAIR(0x9AB1, 0xC2A7)
+DOUBLE_BYTE_PAIR(0x9AB2, 0xC2A9)
+DOUBLE_BYTE_PAIR(0x9AB3, 0xC2AA)
+DOUBLE_BYTE_PAIR(0x9AB4, 0xC2AB)
+DOUBLE_BYTE_PAIR(0x9AB5, 0xC2AE)
+DOUBLE_BYTE_PAIR(0x9AB6, 0xC2AF)
+DOUBLE_BYTE_PAIR(0x9AB7, 0xC2B0)
+DOUBLE_BYTE_PAIR(0x9AB8, 0xC2B1)
+DOUBLE_BYTE_PAIR(0x9AB9, 0xC2B2)
+DOUBLE_BYTE_PAIR(0x9ABA, 0xC2B3)
+DOUBLE_BYTE_PAIR(0x9ABB, 0xC2B6)
+DOUBLE_BYTE_PAIR(0x9ABC, 0xC2B8)
+DOUBLE_BYTE_PAIR(0x9ABD, 0xC2BA)
+DOUBLE_BYTE_PAIR(0x9ABE, 0xC2BB)
+DOUBLE_BYTE_PAIR(0x9ABF, 0xC2BC)
+DOUBLE_BYTE_PAIR(0x9AC0, 0xC2BD)
+DOUBLE_BYTE_PAIR(0x9AC1, 0xC2BE)
+DOUBLE_BYTE_PAIR(0x9AC2, 0xC2BF)
+DOUBLE_BYTE_PAIR(0x9AC3, 0xC2C0)
+DOUBLE_BYTE_PAIR(0x9AC4, 0xC2C1)
+DOUBLE_BYTE_PAIR(0x9AC5, 0xC2C2)
+DOUBLE_BYTE_PAIR(0x9AC6, 0xC2C3)
+DOUBLE_BYTE_PAIR(0x9AC7, 0xC2C4)
+DOUBLE_BYTE_PAIR(0x9AC8, 0xC2C5)
+DOUBLE_BYTE_PAIR(0x9AC9, 0xC2C6)
+DOUBLE_BYTE_PAIR(0x9ACA, 0xC2C7)
+DOUBLE_BYTE_PAIR(0x9ACB, 0xC2C8)
+DOUBLE_BYTE_PAIR(0x9ACC, 0xC2C9)
+DOUBLE_BYTE_PAIR(0x9ACD, 0xC2CA)
+DOUBLE_BYTE_PAIR(0x9ACE, 0xC2CB)
+DOUBLE_BYTE_PAIR(0x9ACF, 0xC2CC)
+DOUBLE_BYTE_PAIR(0x9AD0, 0xC2CD)
+DOUBLE_BYTE_PAIR(0x9AD1, 0xC2CE)
+DOUBLE_BYTE_PAIR(0x9AD2, 0xC2CF)
+DOUBLE_BYTE_PAIR(0x9AD3, 0xC2D0)
+DOUBLE_BYTE_PAIR(0x9AD4, 0xC2D1)
+DOUBLE_BYTE_PAIR(0x9AD5, 0xC2D2)
+DOUBLE_BYTE_PAIR(0x9AD6, 0xC2D3)
+DOUBLE_BYTE_PAIR(0x9AD7, 0xC2D4)
+DOUBLE_BYTE_PAIR(0x9AD8, 0xC2D5)
+DOUBLE_BYTE_PAIR(0x9AD9, 0xC2D6)
+DOUBLE_BYTE_PAIR(0x9ADA, 0xC2D7)
+DOUBLE_BYTE_PAIR(0x9ADB, 0xC2D8)
+DOUBLE_BYTE_PAIR(0x9ADC, 0xC2D9)
+DOUBLE_BYTE_PAIR(0x9ADD, 0xC2DA)
+DOUBLE_BYTE_PAIR(0x9ADE, 0xC2DB)
+DOUBLE_BYTE_PAIR(0x9ADF, 0xC2DE)
+DOUBLE_BYTE_PAIR(0x9AE0, 0xC2DF)
+DOUBLE_BYTE_PAIR(0x9AE1, 0xC2E1)
+DOUBLE_BYTE_PAIR(0x9AE2, 0xC2E2)
+DOUBLE_BYTE_PAIR(0x9AE3, 0xC2E5)
+DOUBLE_BYTE_PAIR(0x9AE4, 0xC2E6)
+DOUBLE_BYTE_PAIR(0x9AE5, 0xC2E7)
+DOUBLE_BYTE_PAIR(0x9AE6, 0xC2E8)
+DOUBLE_BYTE_PAIR(0x9AE7, 0xC2E9)
+DOUBLE_BYTE_PAIR(0x9AE8, 0xC2EA)
+DOUBLE_BYTE_PAIR(0x9AE9, 0xC2EE)
+DOUBLE_BYTE_PAIR(0x9AEA, 0xC2F0)
+DOUBLE_BYTE_PAIR(0x9AEB, 0xC2F2)
+DOUBLE_BYTE_PAIR(0x9AEC, 0xC2F3)
+DOUBLE_BYTE_PAIR(0x9AED, 0xC2F4)
+DOUBLE_BYTE_PAIR(0x9AEE, 0xC2F5)
+DOUBLE_BYTE_PAIR(0x9AEF, 0xC2F7)
+DOUBLE_BYTE_PAIR(0x9AF0, 0xC2FA)
+DOUBLE_BYTE_PAIR(0x9AF1, 0xC2FD)
+DOUBLE_BYTE_PAIR(0x9AF2, 0xC2FE)
+DOUBLE_BYTE_PAIR(0x9AF3, 0xC2FF)
+DOUBLE_BYTE_PAIR(0x9AF4, 0xC301)
+DOUBLE_BYTE_PAIR(0x9AF5, 0xC302)
+DOUBLE_BYTE_PAIR(0x9AF6, 0xC303)
+DOUBLE_BYTE_PAIR(0x9AF7, 0xC304)
+DOUBLE_BYTE_PAIR(0x9AF8, 0xC305)
+DOUBLE_BYTE_PAIR(0x9AF9, 0xC306)
+DOUBLE_BYTE_PAIR(0x9AFA, 0xC307)
+DOUBLE_BYTE_PAIR(0x9AFB, 0xC30A)
+DOUBLE_BYTE_PAIR(0x9AFC, 0xC30B)
+DOUBLE_BYTE_PAIR(0x9AFD, 0xC30E)
+DOUBLE_BYTE_PAIR(0x9AFE, 0xC30F)
+DOUBLE_BYTE_PAIR(0x9B41, 0xC310)
+DOUBLE_BYTE_PAIR(0x9B42, 0xC311)
+DOUBLE_BYTE_PAIR(0x9B43, 0xC312)
+DOUBLE_BYTE_PAIR(0x9B44, 0xC316)
+DOUBLE_BYTE_PAIR(0x9B45, 0xC317)
+DOUBLE_BYTE_PAIR(0x9B46, 0xC319)
+DOUBLE_BYTE_PAIR(0x9B47, 0xC31A)
+DOUBLE_BYTE_PAIR(0x9B48, 0xC31B)
+DOUBLE_BYTE_PAIR(0x9B49, 0xC31D)
+DOUBLE_BYTE_PAIR(0x9B4A, 0xC31E)
+DOUBLE_BYTE_PAIR(0x9B4B, 0xC31F)
+DOUBLE_BYTE_PAIR(0x9B4C, 0xC320)
+DOUBLE_BYTE_PAIR(0x9B4D, 0xC321)
+DOUBLE_BYTE_PAIR(0x9B4E, 0xC322)
+DOUBLE_BYTE_PAIR(0x9B4F, 0xC323)
+DOUBLE_BYTE_PAIR(0x9B50, 0xC326)
+DOUBLE_BYTE_PAIR(0x9B51, 0xC327)
+DOUBLE_BYTE_PAIR(0x9B52, 0xC32A)
+DOUBLE_BYTE_PAIR(0x9B53, 0xC32B)
+DOUBLE_BYTE_PAIR(0x9B54, 0xC32C)
+DOUBLE_BYTE_PAIR(0x9B55, 0xC32D)
+DOUBLE_BYTE_PAIR(0x9B56, 0xC32E)
+DOUBLE_BYTE_PAIR(0x9B57, 0xC32F)
+DOUBLE_BYTE_PAIR(0x9B58, 0xC330)
+DOUBLE_BYTE_PAIR(0x9B59, 0xC331)
+DOUBLE_BYTE_PAIR(0x9B5A, 0xC332)
+DOUBLE_BYTE_PAIR(0x9B61, 0xC333)
+DOUBLE_BYTE_PAIR(0x9B62, 0xC334)
+DOUBLE_BYTE_PAIR(0x9B63, 0xC335)
+DOUBLE_BYTE_PAIR(0x9B64, 0xC336)
+DOUBLE_BYTE_PAIR(0x9B65, 0xC337)
+DOUBLE_BYTE_PAIR(0x9B66, 0xC338)
+DOUBLE_BYTE_PAIR(0x9B67, 0xC339)
+DOUBLE_BYTE_PAIR(0x9B68, 0xC33A)
+DOUBLE_BYTE_PAIR(0x9B69, 0xC33B)
+DOUBLE_BYTE_PAIR(0x9B6A, 0xC33C)
+DOUBLE_BYTE_PAIR(0x9B6B, 0xC33D)
+DOUBLE_BYTE_PAIR(0x9B6C, 0xC33E)
+DOUBLE_BYTE_PAIR(0x9B6D, 0xC33F)
+DOUBLE_BYTE_PAIR(0x9B6E, 0xC340)
+DOUBLE_BYTE_PAIR(0x9B6F, 0xC341)
+DOUBLE_BYTE_PAIR(0x9B70, 0xC342)
+DOUBLE_BYTE_PAIR(0x9B71, 0xC343)
+DOUBLE_BYTE_PAIR(0x9B72, 0xC344)
+DOUBLE_BYTE_PAIR(0x9B73, 0xC346)
+DOUBLE_BYTE_PAIR(0x9B74, 0xC347)
+DOUBLE_BYTE_PAIR(0x9B75, 0xC348)
+DOUBLE_BYTE_PAIR(0x9B76, 0xC349)
+DOUBLE_BYTE_PAIR(0x9B77, 0xC34A)
+DOUBLE_BYTE_PAIR(0x9B78, 0xC34B)
+DOUBLE_BYTE_PAIR(0x9B79, 0xC34C)
+DOUBLE_BYTE_PAIR(0x9B7A, 0xC34D)
+DOUBLE_BYTE_PAIR(0x9B81, 0xC34E)
+DOUBLE_BYTE_PAIR(0x9B82, 0xC34F)
+DOUBLE_BYTE_PAIR(0x9B83, 0xC350)
+DOUBLE_BYTE_PAIR(0x9B84, 0xC351)
+DOUBLE_BYTE_PAIR(0x9B85, 0xC352)
+DOUBLE_BYTE_PAIR(0x9B86, 0xC353)
+DOUBLE_BYTE_PAIR(0x9B87, 0xC354)
+DOUBLE_BYTE_PAIR(0x9B88, 0xC355)
+DOUBLE_BYTE_PAIR(0x9B89, 0xC356)
+DOUBLE_BYTE_PAIR(0x9B8A, 0xC357)
+DOUBLE_BYTE_PAIR(0x9B8B, 0xC358)
+DOUBLE_BYTE_PAIR(0x9B8C, 0xC359)
+DOUBLE_BYTE_PAIR(0x9B8D, 0xC35A)
+DOUBLE_BYTE_PAIR(0x9B8E, 0xC35B)
+DOUBLE_BYTE_PAIR(0x9B8F, 0xC35C)
+DOUBLE_BYTE_PAIR(0x9B90, 0xC35D)
+DOUBLE_BYTE_PAIR(0x9B91, 0xC35E)
+DOUBLE_BYTE_PAIR(0x9B92, 0xC35F)
+DOUBLE_BYTE_PAIR(0x9B93, 0xC360)
+DOUBLE_BYTE_PAIR(0x9B94, 0xC361)
+DOUBLE_BYTE_PAIR(0x9B95, 0xC362)
+DOUBLE_BYTE_PAIR(0x9B96, 0xC363)
+DOUBLE_BYTE_PAIR(0x9B97, 0xC364)
+DOUBLE_BYTE_PAIR(0x9B98, 0xC365)
+DOUBLE_BYTE_PAIR(0x9B99, 0xC366)
+DOUBLE_BYTE_PAIR(0x9B9A, 0xC367)
+DOUBLE_BYTE_PAIR(0x9B9B, 0xC36A)
+DOUBLE_BYTE_PAIR(0x9B9C, 0xC36B)
+DOUBLE_BYTE_PAIR(0x9B9D, 0xC36D)
+DOUBLE_BYTE_PAIR(0x9B9E, 0xC36E)
+DOUBLE_BYTE_PAIR(0x9B9F, 0xC36F)
+DOUBLE_BYTE_PAIR(0x9BA0, 0xC371)
+DOUBLE_BYTE_PAIR(0x9BA1, 0xC373)
+DOUBLE_BYTE_PAIR(0x9BA2, 0xC374)
+DOUBLE_BYTE_PAIR(0x9BA3, 0xC375)
+DOUBLE_BYTE_PAIR(0x9BA4, 0xC376)
+DOUBLE_BYTE_PAIR(0x9BA5, 0xC377)
+DOUBLE_BYTE_PAIR(0x9BA6, 0xC37A)
+DOUBLE_BYTE_PAIR(0x9BA7, 0xC37B)
+DOUBLE_BYTE_PAIR(0x9BA8, 0xC37E)
+DOUBLE_BYTE_PAIR(0x9BA9, 0xC37F)
+DOUBLE_BYTE_PAIR(0x9BAA, 0xC380)
+DOUBLE_BYTE_PAIR(0x9BAB, 0xC381)
+DOUBLE_BYTE_PAIR(0x9BAC, 0xC382)
+DOUBLE_BYTE_PAIR(0x9BAD, 0xC383)
+DOUBLE_BYTE_PAIR(0x9BAE, 0xC385)
+DOUBLE_BYTE_PAIR(0x9BAF, 0xC386)
+DOUBLE_BYTE_PAIR(0x9BB0, 0xC387)
+DOUBLE_BYTE_PAIR(0x9BB1, 0xC389)
+DOUBLE_BYTE_PAIR(0x9BB2, 0xC38A)
+DOUBLE_BYTE_PAIR(0x9BB3, 0xC38B)
+DOUBLE_BYTE_PAIR(0x9BB4, 0xC38D)
+DOUBLE_BYTE_PAIR(0x9BB5, 0xC38E)
+DOUBLE_BYTE_PAIR(0x9BB6, 0xC38F)
+DOUBLE_BYTE_PAIR(0x9BB7, 0xC390)
+DOUBLE_BYTE_PAIR(0x9BB8, 0xC391)
+DOUBLE_BYTE_PAIR(0x9BB9, 0xC392)
+DOUBLE_BYTE_PAIR(0x9BBA, 0xC393)
+DOUBLE_BYTE_PAIR(0x9BBB, 0xC394)
+DOUBLE_BYTE_PAIR(0x9BBC, 0xC395)
+DOUBLE_BYTE_PAIR(0x9BBD, 0xC396)
+DOUBLE_BYTE_PAIR(0x9BBE, 0xC397)
+DOUBLE_BYTE_PAIR(0x9BBF, 0xC398)
+DOUBLE_BYTE_PAIR(0x9BC0, 0xC399)
+DOUBLE_BYTE_PAIR(0x9BC1, 0xC39A)
+DOUBLE_BYTE_PAIR(0x9BC2, 0xC39B)
+DOUBLE_BYTE_PAIR(0x9BC3, 0xC39C)
+DOUBLE_BYTE_PAIR(0x9BC4, 0xC39D)
+DOUBLE_BYTE_PAIR(0x9BC5, 0xC39E)
+DOUBLE_BYTE_PAIR(0x9BC6, 0xC39F)
+DOUBLE_BYTE_PAIR(0x9BC7, 0xC3A0)
+DOUBLE_BYTE_PAIR(0x9BC8, 0xC3A1)
+DOUBLE_BYTE_PAIR(0x9BC9, 0xC3A2)
+DOUBLE_BYTE_PAIR(0x9BCA, 0xC3A3)
+DOUBLE_BYTE_PAIR(0x9BCB, 0xC3A4)
+DOUBLE_BYTE_PAIR(0x9BCC, 0xC3A5)
+DOUBLE_BYTE_PAIR(0x9BCD, 0xC3A6)
+DOUBLE_BYTE_PAIR(0x9BCE, 0xC3A7)
+DOUBLE_BYTE_PAIR(0x9BCF, 0xC3A8)
+DOUBLE_BYTE_PAIR(0x9BD0, 0xC3A9)
+DOUBLE_BYTE_PAIR(0x9BD1, 0xC3AA)
+DOUBLE_BYTE_PAIR(0x9BD2, 0xC3AB)
+DOUBLE_BYTE_PAIR(0x9BD3, 0xC3AC)
+DOUBLE_BYTE_PAIR(0x9BD4, 0xC3AD)
+DOUBLE_BYTE_PAIR(0x9BD5, 0xC3AE)
+DOUBLE_BYTE_PAIR(0x9BD6, 0xC3AF)
+DOUBLE_BYTE_PAIR(0x9BD7, 0xC3B0)
+DOUBLE_BYTE_PAIR(0x9BD8, 0xC3B1)
+DOUBLE_BYTE_PAIR(0x9BD9, 0xC3B2)
+DOUBLE_BYTE_PAIR(0x9BDA, 0xC3B3)
+DOUBLE_BYTE_PAIR(0x9BDB, 0xC3B4)
+DOUBLE_BYTE_PAIR(0x9BDC, 0xC3B5)
+DOUBLE_BYTE_PAIR(0x9BDD, 0xC3B6)
+DOUBLE_BYTE_PAIR(0x9BDE, 0xC3B7)
+DOUBLE_BYTE_PAIR(0x9BDF, 0xC3B8)
+DOUBLE_BYTE_PAIR(0x9BE0, 0xC3B9)
+DOUBLE_BYTE_PAIR(0x9BE1, 0xC3BA)
+DOUBLE_BYTE_PAIR(0x9BE2, 0xC3BB)
+DOUBLE_BYTE_PAIR(0x9BE3, 0xC3BC)
+DOUBLE_BYTE_PAIR(0x9BE4, 0xC3BD)
+DOUBLE_BYTE_PAIR(0x9BE5, 0xC3BE)
+DOUBLE_BYTE_PAIR(0x9BE6, 0xC3BF)
+DOUBLE_BYTE_PAIR(0x9BE7, 0xC3C1)
+DOUBLE_BYTE_PAIR(0x9BE8, 0xC3C2)
+DOUBLE_BYTE_PAIR(0x9BE9, 0xC3C3)
+DOUBLE_BYTE_PAIR(0x9BEA, 0xC3C4)
+DOUBLE_BYTE_PAIR(0x9BEB, 0xC3C5)
+DOUBLE_BYTE_PAIR(0x9BEC, 0xC3C6)
+DOUBLE_BYTE_PAIR(0x9BED, 0xC3C7)
+DOUBLE_BYTE_PAIR(0x9BEE, 0xC3C8)
+DOUBLE_BYTE_PAIR(0x9BEF, 0xC3C9)
+DOUBLE_BYTE_PAIR(0x9BF0, 0xC3CA)
+DOUBLE_BYTE_PAIR(0x9BF1, 0xC3CB)
+DOUBLE_BYTE_PAIR(0x9BF2, 0xC3CC)
+DOUBLE_BYTE_PAIR(0x9BF3, 0xC3CD)
+DOUBLE_BYTE_PAIR(0x9BF4, 0xC3CE)
+DOUBLE_BYTE_PAIR(0x9BF5, 0xC3CF)
+DOUBLE_BYTE_PAIR(0x9BF6, 0xC3D0)
+DOUBLE_BYTE_PAIR(0x9BF7, 0xC3D1)
+DOUBLE_BYTE_PAIR(0x9BF8, 0xC3D2)
+DOUBLE_BYTE_PAIR(0x9BF9, 0xC3D3)
+DOUBLE_BYTE_PAIR(0x9BFA, 0xC3D4)
+DOUBLE_BYTE_PAIR(0x9BFB, 0xC3D5)
+DOUBLE_BYTE_PAIR(0x9BFC, 0xC3D6)
+DOUBLE_BYTE_PAIR(0x9BFD, 0xC3D7)
+DOUBLE_BYTE_PAIR(0x9BFE, 0xC3DA)
+DOUBLE_BYTE_PAIR(0x9C41, 0xC3DB)
+DOUBLE_BYTE_PAIR(0x9C42, 0xC3DD)
+DOUBLE_BYTE_PAIR(0x9C43, 0xC3DE)
+DOUBLE_BYTE_PAIR(0x9C44, 0xC3E1)
+DOUBLE_BYTE_PAIR(0x9C45, 0xC3E3)
+DOUBLE_BYTE_PAIR(0x9C46, 0xC3E4)
+DOUBLE_BYTE_PAIR(0x9C47, 0xC3E5)
+DOUBLE_BYTE_PAIR(0x9C48, 0xC3E6)
+DOUBLE_BYTE_PAIR(0x9C49, 0xC3E7)
+DOUBLE_BYTE_PAIR(0x9C4A, 0xC3EA)
+DOUBLE_BYTE_PAIR(0x9C4B, 0xC3EB)
+DOUBLE_BYTE_PAIR(0x9C4C, 0xC3EC)
+DOUBLE_BYTE_PAIR(0x9C4D, 0xC3EE)
+DOUBLE_BYTE_PAIR(0x9C4E, 0xC3EF)
+DOUBLE_BYTE_PAIR(0x9C4F, 0xC3F0)
+DOUBLE_BYTE_PAIR(0x9C50, 0xC3F1)
+DOUBLE_BYTE_PAIR(0x9C51, 0xC3F2)
+DOUBLE_BYTE_PAIR(0x9C52, 0xC3F3)
+DOUBLE_BYTE_PAIR(0x9C53, 0xC3F6)
+DOUBLE_BYTE_PAIR(0x9C54, 0xC3F7)
+DOUBLE_BYTE_PAIR(0x9C55, 0xC3F9)
+DOUBLE_BYTE_PAIR(0x9C56, 0xC3FA)
+DOUBLE_BYTE_PAIR(0x9C57, 0xC3FB)
+DOUBLE_BYTE_PAIR(0x9C58, 0xC3FC)
+DOUBLE_BYTE_PAIR(0x9C59, 0xC3FD)
+DOUBLE_BYTE_PAIR(0x9C5A, 0xC3FE)
+DOUBLE_BYTE_PAIR(0x9C61, 0xC3FF)
+DOUBLE_BYTE_PAIR(0x9C62, 0xC400)
+DOUBLE_BYTE_PAIR(0x9C63, 0xC401)
+DOUBLE_BYTE_PAIR(0x9C64, 0xC402)
+DOUBLE_BYTE_PAIR(0x9C65, 0xC403)
+DOUBLE_BYTE_PAIR(0x9C66, 0xC404)
+DOUBLE_BYTE_PAIR(0x9C67, 0xC405)
+DOUBLE_BYTE_PAIR(0x9C68, 0xC406)
+DOUBLE_BYTE_PAIR(0x9C69, 0xC407)
+DOUBLE_BYTE_PAIR(0x9C6A, 0xC409)
+DOUBLE_BYTE_PAIR(0x9C6B, 0xC40A)
+DOUBLE_BYTE_PAIR(0x9C6C, 0xC40B)
+DOUBLE_BYTE_PAIR(0x9C6D, 0xC40C)
+DOUBLE_BYTE_PAIR(0x9C6E, 0xC40D)
+DOUBLE_BYTE_PAIR(0x9C6F, 0xC40E)
+DOUBLE_BYTE_PAIR(0x9C70, 0xC40F)
+DOUBLE_BYTE_PAIR(0x9C71, 0xC411)
+DOUBLE_BYTE_PAIR(0x9C72, 0xC412)
+DOUBLE_BYTE_PAIR(0x9C73, 0xC413)
+DOUBLE_BYTE_PAIR(0x9C74, 0xC414)
+DOUBLE_BYTE_PAIR(0x9C75, 0xC415)
+DOUBLE_BYTE_PAIR(0x9C76, 0xC416)
+DOUBLE_BYTE_PAIR(0x9C77, 0xC417)
+DOUBLE_BYTE_PAIR(0x9C78, 0xC418)
+DOUBLE_BYTE_PAIR(0x9C79, 0xC419)
+DOUBLE_BYTE_PAIR(0x9C7A, 0xC41A)
+DOUBLE_BYTE_PAIR(0x9C81, 0xC41B)
+DOUBLE_BYTE_PAIR(0x9C82, 0xC41C)
+DOUBLE_BYTE_PAIR(0x9C83, 0xC41D)
+DOUBLE_BYTE_PAIR(0x9C84, 0xC41E)
+DOUBLE_BYTE_PAIR(0x9C85, 0xC41F)
+DOUBLE_BYTE_PAIR(0x9C86, 0xC420)
+DOUBLE_BYTE_PAIR(0x9C87, 0xC421)
+DOUBLE_BYTE_PAIR(0x9C88, 0xC422)
+DOUBLE_BYTE_PAIR(0x9C89, 0xC423)
+DOUBLE_BYTE_PAIR(0x9C8A, 0xC425)
+DOUBLE_BYTE_PAIR(0x9C8B, 0xC426)
+DOUBLE_BYTE_PAIR(0x9C8C, 0xC427)
+DOUBLE_BYTE_PAIR(0x9C8D, 0xC428)
+DOUBLE_BYTE_PAIR(0x9C8E, 0xC429)
+DOUBLE_BYTE_PAIR(0x9C8F, 0xC42A)
+DOUBLE_BYTE_PAIR(0x9C90, 0xC42B)
+DOUBLE_BYTE_PAIR(0x9C91, 0xC42D)
+DOUBLE_BYTE_PAIR(0x9C92, 0xC42E)
+DOUBLE_BYTE_PAIR(0x9C93, 0xC42F)
+DOUBLE_BYTE_PAIR(0x9C94, 0xC431)
+DOUBLE_BYTE_PAIR(0x9C95, 0xC432)
+DOUBLE_BYTE_PAIR(0x9C96, 0xC433)
+DOUBLE_BYTE_PAIR(0x9C97, 0xC435)
+DOUBLE_BYTE_PAIR(0x9C98, 0xC436)
+DOUBLE_BYTE_PAIR(0x9C99, 0xC437)
+DOUBLE_BYTE_PAIR(0x9C9A, 0xC438)
+DOUBLE_BYTE_PAIR(0x9C9B, 0xC439)
+DOUBLE_BYTE_PAIR(0x9C9C, 0xC43A)
+DOUBLE_BYTE_PAIR(0x9C9D, 0xC43B)
+DOUBLE_BYTE_PAIR(0x9C9E, 0xC43E)
+DOUBLE_BYTE_PAIR(0x9C9F, 0xC43F)
+DOUBLE_BYTE_PAIR(0x9CA0, 0xC440)
+DOUBLE_BYTE_PAIR(0x9CA1, 0xC441)
+DOUBLE_BYTE_PAIR(0x9CA2, 0xC442)
+DOUBLE_BYTE_PAIR(0x9CA3, 0xC443)
+DOUBLE_BYTE_PAIR(0x9CA4, 0xC444)
+DOUBLE_BYTE_PAIR(0x9CA5, 0xC445)
+DOUBLE_BYTE_PAIR(0x9CA6, 0xC446)
+DOUBLE_BYTE_PAIR(0x9CA7, 0xC447)
+DOUBLE_BYTE_PAIR(0x9CA8, 0xC449)
+DOUBLE_BYTE_PAIR(0x9CA9, 0xC44A)
+DOUBLE_BYTE_PAIR(0x9CAA, 0xC44B)
+DOUBLE_BYTE_PAIR(0x9CAB, 0xC44C)
+DOUBLE_BYTE_PAIR(0x9CAC, 0xC44D)
+DOUBLE_BYTE_PAIR(0x9CAD, 0xC44E)
+DOUBLE_BYTE_PAIR(0x9CAE, 0xC44F)
+DOUBLE_BYTE_PAIR(0x9CAF, 0xC450)
+DOUBLE_BYTE_PAIR(0x9CB0, 0xC451)
+DOUBLE_BYTE_PAIR(0x9CB1, 0xC452)
+DOUBLE_BYTE_PAIR(0x9CB2, 0xC453)
+DOUBLE_BYTE_PAIR(0x9CB3, 0xC454)
+DOUBLE_BYTE_PAIR(0x9CB4, 0xC455)
+DOUBLE_BYTE_PAIR(0x9CB5, 0xC456)
+DOUBLE_BYTE_PAIR(0x9CB6, 0xC457)
+DOUBLE_BYTE_PAIR(0x9CB7, 0xC458)
+DOUBLE_BYTE_PAIR(0x9CB8, 0xC459)
+DOUBLE_BYTE_PAIR(0x9CB9, 0xC45A)
+DOUBLE_BYTE_PAIR(0x9CBA, 0xC45B)
+DOUBLE_BYTE_PAIR(0x9CBB, 0xC45C)
+DOUBLE_BYTE_PAIR(0x9CBC, 0xC45D)
+DOUBLE_BYTE_PAIR(0x9CBD, 0xC45E)
+DOUBLE_BYTE_PAIR(0x9CBE, 0xC45F)
+DOUBLE_BYTE_PAIR(0x9CBF, 0xC460)
+DOUBLE_BYTE_PAIR(0x9CC0, 0xC461)
+DOUBLE_BYTE_PAIR(0x9CC1, 0xC462)
+DOUBLE_BYTE_PAIR(0x9CC2, 0xC463)
+DOUBLE_BYTE_PAIR(0x9CC3, 0xC466)
+DOUBLE_BYTE_PAIR(0x9CC4, 0xC467)
+DOUBLE_BYTE_PAIR(0x9CC5, 0xC469)
+DOUBLE_BYTE_PAIR(0x9CC6, 0xC46A)
+DOUBLE_BYTE_PAIR(0x9CC7, 0xC46B)
+DOUBLE_BYTE_PAIR(0x9CC8, 0xC46D)
+DOUBLE_BYTE_PAIR(0x9CC9, 0xC46E)
+DOUBLE_BYTE_PAIR(0x9CCA, 0xC46F)
+DOUBLE_BYTE_PAIR(0x9CCB, 0xC470)
+DOUBLE_BYTE_PAIR(0x9CCC, 0xC471)
+DOUBLE_BYTE_PAIR(0x9CCD, 0xC472)
+DOUBLE_BYTE_PAIR(0x9CCE, 0xC473)
+DOUBLE_BYTE_PAIR(0x9CCF, 0xC476)
+DOUBLE_BYTE_PAIR(0x9CD0, 0xC477)
+DOUBLE_BYTE_PAIR(0x9CD1, 0xC478)
+DOUBLE_BYTE_PAIR(0x9CD2, 0xC47A)
+DOUBLE_BYTE_PAIR(0x9CD3, 0xC47B)
+DOUBLE_BYTE_PAIR(0x9CD4, 0xC47C)
+DOUBLE_BYTE_PAIR(0x9CD5, 0xC47D)
+DOUBLE_BYTE_PAIR(0x9CD6, 0xC47E)
+DOUBLE_BYTE_PAIR(0x9CD7, 0xC47F)
+DOUBLE_BYTE_PAIR(0x9CD8, 0xC481)
+DOUBLE_BYTE_PAIR(0x9CD9, 0xC482)
+DOUBLE_BYTE_PAIR(0x9CDA, 0xC483)
+DOUBLE_BYTE_PAIR(0x9CDB, 0xC484)
+DOUBLE_BYTE_PAIR(0x9CDC, 0xC485)
+DOUBLE_BYTE_PAIR(0x9CDD, 0xC486)
+DOUBLE_BYTE_PAIR(0x9CDE, 0xC487)
+DOUBLE_BYTE_PAIR(0x9CDF, 0xC488)
+DOUBLE_BYTE_PAIR(0x9CE0, 0xC489)
+DOUBLE_BYTE_PAIR(0x9CE1, 0xC48A)
+DOUBLE_BYTE_PAIR(0x9CE2, 0xC48B)
+DOUBLE_BYTE_PAIR(0x9CE3, 0xC48C)
+DOUBLE_BYTE_PAIR(0x9CE4, 0xC48D)
+DOUBLE_BYTE_PAIR(0x9CE5, 0xC48E)
+DOUBLE_BYTE_PAIR(0x9CE6, 0xC48F)
+DOUBLE_BYTE_PAIR(0x9CE7, 0xC490)
+DOUBLE_BYTE_PAIR(0x9CE8, 0xC491)
+DOUBLE_BYTE_PAIR(0x9CE9, 0xC492)
+DOUBLE_BYTE_PAIR(0x9CEA, 0xC493)
+DOUBLE_BYTE_PAIR(0x9CEB, 0xC495)
+DOUBLE_BYTE_PAIR(0x9CEC, 0xC496)
+DOUBLE_BYTE_PAIR(0x9CED, 0xC497)
+DOUBLE_BYTE_PAIR(0x9CEE, 0xC498)
+DOUBLE_BYTE_PAIR(0x9CEF, 0xC499)
+DOUBLE_BYTE_PAIR(0x9CF0, 0xC49A)
+DOUBLE_BYTE_PAIR(0x9CF1, 0xC49B)
+DOUBLE_BYTE_PAIR(0x9CF2, 0xC49D)
+DOUBLE_BYTE_PAIR(0x9CF3, 0xC49E)
+DOUBLE_BYTE_PAIR(0x9CF4, 0xC49F)
+DOUBLE_BYTE_PAIR(0x9CF5, 0xC4A0)
+DOUBLE_BYTE_PAIR(0x9CF6, 0xC4A1)
+DOUBLE_BYTE_PAIR(0x9CF7, 0xC4A2)
+DOUBLE_BYTE_PAIR(0x9CF8, 0xC4A3)
+DOUBLE_BYTE_PAIR(0x9CF9, 0xC4A4)
+DOUBLE_BYTE_PAIR(0x9CFA, 0xC4A5)
+DOUBLE_BYTE_PAIR(0x9CFB, 0xC4A6)
+DOUBLE_BYTE_PAIR(0x9CFC, 0xC4A7)
+DOUBLE_BYTE_PAIR(0x9CFD, 0xC4A8)
+DOUBLE_BYTE_PAIR(0x9CFE, 0xC4A9)
+DOUBLE_BYTE_PAIR(0x9D41, 0xC4AA)
+DOUBLE_BYTE_PAIR(0x9D42, 0xC4AB)
+DOUBLE_BYTE_PAIR(0x9D43, 0xC4AC)
+DOUBLE_BYTE_PAIR(0x9D44, 0xC4AD)
+DOUBLE_BYTE_PAIR(0x9D45, 0xC4AE)
+DOUBLE_BYTE_PAIR(0x9D46, 0xC4AF)
+DOUBLE_BYTE_PAIR(0x9D47, 0xC4B0)
+DOUBLE_BYTE_PAIR(0x9D48, 0xC4B1)
+DOUBLE_BYTE_PAIR(0x9D49, 0xC4B2)
+DOUBLE_BYTE_PAIR(0x9D4A, 0xC4B3)
+DOUBLE_BYTE_PAIR(0x9D4B, 0xC4B4)
+DOUBLE_BYTE_PAIR(0x9D4C, 0xC4B5)
+DOUBLE_BYTE_PAIR(0x9D4D, 0xC4B6)
+DOUBLE_BYTE_PAIR(0x9D4E, 0xC4B7)
+DOUBLE_BYTE_PAIR(0x9D4F, 0xC4B9)
+DOUBLE_BYTE_PAIR(0x9D50, 0xC4BA)
+DOUBLE_BYTE_PAIR(0x9D51, 0xC4BB)
+DOUBLE_BYTE_PAIR(0x9D52, 0xC4BD)
+DOUBLE_BYTE_PAIR(0x9D53, 0xC4BE)
+DOUBLE_BYTE_PAIR(0x9D54, 0xC4BF)
+DOUBLE_BYTE_PAIR(0x9D55, 0xC4C0)
+DOUBLE_BYTE_PAIR(0x9D56, 0xC4C1)
+DOUBLE_BYTE_PAIR(0x9D57, 0xC4C2)
+DOUBLE_BYTE_PAIR(0x9D58, 0xC4C3)
+DOUBLE_BYTE_PAIR(0x9D59, 0xC4C4)
+DOUBLE_BYTE_PAIR(0x9D5A, 0xC4C5)
+DOUBLE_BYTE_PAIR(0x9D61, 0xC4C6)
+DOUBLE_BYTE_PAIR(0x9D62, 0xC4C7)
+DOUBLE_BYTE_PAIR(0x9D63, 0xC4C8)
+DOUBLE_BYTE_PAIR(0x9D64, 0xC4C9)
+DOUBLE_BYTE_PAIR(0x9D65, 0xC4CA)
+DOUBLE_BYTE_PAIR(0x9D66, 0xC4CB)
+DOUBLE_BYTE_PAIR(0x9D67, 0xC4CC)
+DOUBLE_BYTE_PAIR(0x9D68, 0xC4CD)
+DOUBLE_BYTE_PAIR(0x9D69, 0xC4CE)
+DOUBLE_BYTE_PAIR(0x9D6A, 0xC4CF)
+DOUBLE_BYTE_PAIR(0x9D6B, 0xC4D0)
+DOUBLE_BYTE_PAIR(0x9D6C, 0xC4D1)
+DOUBLE_BYTE_PAIR(0x9D6D, 0xC4D2)
+DOUBLE_BYTE_PAIR(0x9D6E, 0xC4D3)
+DOUBLE_BYTE_PAIR(0x9D6F, 0xC4D4)
+DOUBLE_BYTE_PAIR(0x9D70, 0xC4D5)
+DOUBLE_BYTE_PAIR(0x9D71, 0xC4D6)
+DOUBLE_BYTE_PAIR(0x9D72, 0xC4D7)
+DOUBLE_BYTE_PAIR(0x9D73, 0xC4D8)
+DOUBLE_BYTE_PAIR(0x9D74, 0xC4D9)
+DOUBLE_BYTE_PAIR(0x9D75, 0xC4DA)
+DOUBLE_BYTE_PAIR(0x9D76, 0xC4DB)
+DOUBLE_BYTE_PAIR(0x9D77, 0xC4DC)
+DOUBLE_BYTE_PAIR(0x9D78, 0xC4DD)
+DOUBLE_BYTE_PAIR(0x9D79, 0xC4DE)
+DOUBLE_BYTE_PAIR(0x9D7A, 0xC4DF)
+DOUBLE_BYTE_PAIR(0x9D81, 0xC4E0)
+DOUBLE_BYTE_PAIR(0x9D82, 0xC4E1)
+DOUBLE_BYTE_PAIR(0x9D83, 0xC4E2)
+DOUBLE_BYTE_PAIR(0x9D84, 0xC4E3)
+DOUBLE_BYTE_PAIR(0x9D85, 0xC4E4)
+DOUBLE_BYTE_PAIR(0x9D86, 0xC4E5)
+DOUBLE_BYTE_PAIR(0x9D87, 0xC4E6)
+DOUBLE_BYTE_PAIR(0x9D88, 0xC4E7)
+DOUBLE_BYTE_PAIR(0x9D89, 0xC4E8)
+DOUBLE_BYTE_PAIR(0x9D8A, 0xC4EA)
+DOUBLE_BYTE_PAIR(0x9D8B, 0xC4EB)
+DOUBLE_BYTE_PAIR(0x9D8C, 0xC4EC)
+DOUBLE_BYTE_PAIR(0x9D8D, 0xC4ED)
+DOUBLE_BYTE_PAIR(0x9D8E, 0xC4EE)
+DOUBLE_BYTE_PAIR(0x9D8F, 0xC4EF)
+DOUBLE_BYTE_PAIR(0x9D90, 0xC4F2)
+DOUBLE_BYTE_PAIR(0x9D91, 0xC4F3)
+DOUBLE_BYTE_PAIR(0x9D92, 0xC4F5)
+DOUBLE_BYTE_PAIR(0x9D93, 0xC4F6)
+DOUBLE_BYTE_PAIR(0x9D94, 0xC4F7)
+DOUBLE_BYTE_PAIR(0x9D95, 0xC4F9)
+DOUBLE_BYTE_PAIR(0x9D96, 0xC4FB)
+DOUBLE_BYTE_PAIR(0x9D97, 0xC4FC)
+DOUBLE_BYTE_PAIR(0x9D98, 0xC4FD)
+DOUBLE_BYTE_PAIR(0x9D99, 0xC4FE)
+DOUBLE_BYTE_PAIR(0x9D9A, 0xC502)
+DOUBLE_BYTE_PAIR(0x9D9B, 0xC503)
+DOUBLE_BYTE_PAIR(0x9D9C, 0xC504)
+DOUBLE_BYTE_PAIR(0x9D9D, 0xC505)
+DOUBLE_BYTE_PAIR(0x9D9E, 0xC506)
+DOUBLE_BYTE_PAIR(0x9D9F, 0xC507)
+DOUBLE_BYTE_PAIR(0x9DA0, 0xC508)
+DOUBLE_BYTE_PAIR(0x9DA1, 0xC509)
+DOUBLE_BYTE_PAIR(0x9DA2, 0xC50A)
+DOUBLE_BYTE_PAIR(0x9DA3, 0xC50B)
+DOUBLE_BYTE_PAIR(0x9DA4, 0xC50D)
+DOUBLE_BYTE_PAIR(0x9DA5, 0xC50E)
+DOUBLE_BYTE_PAIR(0x9DA6, 0xC50F)
+DOUBLE_BYTE_PAIR(0x9DA7, 0xC511)
+DOUBLE_BYTE_PAIR(0x9DA8, 0xC512)
+DOUBLE_BYTE_PAIR(0x9DA9, 0xC513)
+DOUBLE_BYTE_PAIR(0x9DAA, 0xC515)
+DOUBLE_BYTE_PAIR(0x9DAB, 0xC516)
+DOUBLE_BYTE_PAIR(0x9DAC, 0xC517)
+DOUBLE_BYTE_PAIR(0x9DAD, 0xC518)
+DOUBLE_BYTE_PAIR(0x9DAE, 0xC519)
+DOUBLE_BYTE_PAIR(0x9DAF, 0xC51A)
+DOUBLE_BYTE_PAIR(0x9DB0, 0xC51B)
+DOUBLE_BYTE_PAIR(0x9DB1, 0xC51D)
+DOUBLE_BYTE_PAIR(0x9DB2, 0xC51E)
+DOUBLE_BYTE_PAIR(0x9DB3, 0xC51F)
+DOUBLE_BYTE_PAIR(0x9DB4, 0xC520)
+DOUBLE_BYTE_PAIR(0x9DB5, 0xC521)
+DOUBLE_BYTE_PAIR(0x9DB6, 0xC522)
+DOUBLE_BYTE_PAIR(0x9DB7, 0xC523)
+DOUBLE_BYTE_PAIR(0x9DB8, 0xC524)
+DOUBLE_BYTE_PAIR(0x9DB9, 0xC525)
+DOUBLE_BYTE_PAIR(0x9DBA, 0xC526)
+DOUBLE_BYTE_PAIR(0x9DBB, 0xC527)
+DOUBLE_BYTE_PAIR(0x9DBC, 0xC52A)
+DOUBLE_BYTE_PAIR(0x9DBD, 0xC52B)
+DOUBLE_BYTE_PAIR(0x9DBE, 0xC52D)
+DOUBLE_BYTE_PAIR(0x9DBF, 0xC52E)
+DOUBLE_BYTE_PAIR(0x9DC0, 0xC52F)
+DOUBLE_BYTE_PAIR(0x9DC1, 0xC531)
+DOUBLE_BYTE_PAIR(0x9DC2, 0xC532)
+DOUBLE_BYTE_PAIR(0x9DC3, 0xC533)
+DOUBLE_BYTE_PAIR(0x9DC4, 0xC534)
+DOUBLE_BYTE_PAIR(0x9DC5, 0xC535)
+DOUBLE_BYTE_PAIR(0x9DC6, 0xC536)
+DOUBLE_BYTE_PAIR(0x9DC7, 0xC537)
+DOUBLE_BYTE_PAIR(0x9DC8, 0xC53A)
+DOUBLE_BYTE_PAIR(0x9DC9, 0xC53C)
+DOUBLE_BYTE_PAIR(0x9DCA, 0xC53E)
+DOUBLE_BYTE_PAIR(0x9DCB, 0xC53F)
+DOUBLE_BYTE_PAIR(0x9DCC, 0xC540)
+DOUBLE_BYTE_PAIR(0x9DCD, 0xC541)
+DOUBLE_BYTE_PAIR(0x9DCE, 0xC542)
+DOUBLE_BYTE_PAIR(0x9DCF, 0xC543)
+DOUBLE_BYTE_PAIR(0x9DD0, 0xC546)
+DOUBLE_BYTE_PAIR(0x9DD1, 0xC547)
+DOUBLE_BYTE_PAIR(0x9DD2, 0xC54B)
+DOUBLE_BYTE_PAIR(0x9DD3, 0xC54F)
+DOUBLE_BYTE_PAIR(0x9DD4, 0xC550)
+DOUBLE_BYTE_PAIR(0x9DD5, 0xC551)
+DOUBLE_BYTE_PAIR(0x9DD6, 0xC552)
+DOUBLE_BYTE_PAIR(0x9DD7, 0xC556)
+DOUBLE_BYTE_PAIR(0x9DD8, 0xC55A)
+DOUBLE_BYTE_PAIR(0x9DD9, 0xC55B)
+DOUBLE_BYTE_PAIR(0x9DDA, 0xC55C)
+DOUBLE_BYTE_PAIR(0x9DDB, 0xC55F)
+DOUBLE_BYTE_PAIR(0x9DDC, 0xC562)
+DOUBLE_BYTE_PAIR(0x9DDD, 0xC563)
+DOUBLE_BYTE_PAIR(0x9DDE, 0xC565)
+DOUBLE_BYTE_PAIR(0x9DDF, 0xC566)
+DOUBLE_BYTE_PAIR(0x9DE0, 0xC567)
+DOUBLE_BYTE_PAIR(0x9DE1, 0xC569)
+DOUBLE_BYTE_PAIR(0x9DE2, 0xC56A)
+DOUBLE_BYTE_PAIR(0x9DE3, 0xC56B)
+DOUBLE_BYTE_PAIR(0x9DE4, 0xC56C)
+DOUBLE_BYTE_PAIR(0x9DE5, 0xC56D)
+DOUBLE_BYTE_PAIR(0x9DE6, 0xC56E)
+DOUBLE_BYTE_PAIR(0x9DE7, 0xC56F)
+DOUBLE_BYTE_PAIR(0x9DE8, 0xC572)
+DOUBLE_BYTE_PAIR(0x9DE9, 0xC576)
+DOUBLE_BYTE_PAIR(0x9DEA, 0xC577)
+DOUBLE_BYTE_PAIR(0x9DEB, 0xC578)
+DOUBLE_BYTE_PAIR(0x9DEC, 0xC579)
+DOUBLE_BYTE_PAIR(0x9DED, 0xC57A)
+DOUBLE_BYTE_PAIR(0x9DEE, 0xC57B)
+DOUBLE_BYTE_PAIR(0x9DEF, 0xC57E)
+DOUBLE_BYTE_PAIR(0x9DF0, 0xC57F)
+DOUBLE_BYTE_PAIR(0x9DF1, 0xC581)
+DOUBLE_BYTE_PAIR(0x9DF2, 0xC582)
+DOUBLE_BYTE_PAIR(0x9DF3, 0xC583)
+DOUBLE_BYTE_PAIR(0x9DF4, 0xC585)
+DOUBLE_BYTE_PAIR(0x9DF5, 0xC586)
+DOUBLE_BYTE_PAIR(0x9DF6, 0xC588)
+DOUBLE_BYTE_PAIR(0x9DF7, 0xC589)
+DOUBLE_BYTE_PAIR(0x9DF8, 0xC58A)
+DOUBLE_BYTE_PAIR(0x9DF9, 0xC58B)
+DOUBLE_BYTE_PAIR(0x9DFA, 0xC58E)
+DOUBLE_BYTE_PAIR(0x9DFB, 0xC590)
+DOUBLE_BYTE_PAIR(0x9DFC, 0xC592)
+DOUBLE_BYTE_PAIR(0x9DFD, 0xC593)
+DOUBLE_BYTE_PAIR(0x9DFE, 0xC594)
+DOUBLE_BYTE_PAIR(0x9E41, 0xC596)
+DOUBLE_BYTE_PAIR(0x9E42, 0xC599)
+DOUBLE_BYTE_PAIR(0x9E43, 0xC59A)
+DOUBLE_BYTE_PAIR(0x9E44, 0xC59B)
+DOUBLE_BYTE_PAIR(0x9E45, 0xC59D)
+DOUBLE_BYTE_PAIR(0x9E46, 0xC59E)
+DOUBLE_BYTE_PAIR(0x9E47, 0xC59F)
+DOUBLE_BYTE_PAIR(0x9E48, 0xC5A1)
+DOUBLE_BYTE_PAIR(0x9E49, 0xC5A2)
+DOUBLE_BYTE_PAIR(0x9E4A, 0xC5A3)
+DOUBLE_BYTE_PAIR(0x9E4B, 0xC5A4)
+DOUBLE_BYTE_PAIR(0x9E4C, 0xC5A5)
+DOUBLE_BYTE_PAIR(0x9E4D, 0xC5A6)
+DOUBLE_BYTE_PAIR(0x9E4E, 0xC5A7)
+DOUBLE_BYTE_PAIR(0x9E4F, 0xC5A8)
+DOUBLE_BYTE_PAIR(0x9E50, 0xC5AA)
+DOUBLE_BYTE_PAIR(0x9E51, 0xC5AB)
+DOUBLE_BYTE_PAIR(0x9E52, 0xC5AC)
+DOUBLE_BYTE_PAIR(0x9E53, 0xC5AD)
+DOUBLE_BYTE_PAIR(0x9E54, 0xC5AE)
+DOUBLE_BYTE_PAIR(0x9E55, 0xC5AF)
+DOUBLE_BYTE_PAIR(0x9E56, 0xC5B0)
+DOUBLE_BYTE_PAIR(0x9E57, 0xC5B1)
+DOUBLE_BYTE_PAIR(0x9E58, 0xC5B2)
+DOUBLE_BYTE_PAIR(0x9E59, 0xC5B3)
+DOUBLE_BYTE_PAIR(0x9E5A, 0xC5B6)
+DOUBLE_BYTE_PAIR(0x9E61, 0xC5B7)
+DOUBLE_BYTE_PAIR(0x9E62, 0xC5BA)
+DOUBLE_BYTE_PAIR(0x9E63, 0xC5BF)
+DOUBLE_BYTE_PAIR(0x9E64, 0xC5C0)
+DOUBLE_BYTE_PAIR(0x9E65, 0xC5C1)
+DOUBLE_BYTE_PAIR(0x9E66, 0xC5C2)
+DOUBLE_BYTE_PAIR(0x9E67, 0xC5C3)
+DOUBLE_BYTE_PAIR(0x9E68, 0xC5CB)
+DOUBLE_BYTE_PAIR(0x9E69, 0xC5CD)
+DOUBLE_BYTE_PAIR(0x9E6A, 0xC5CF)
+DOUBLE_BYTE_PAIR(0x9E6B, 0xC5D2)
+DOUBLE_BYTE_PAIR(0x9E6C, 0xC5D3)
+DOUBLE_BYTE_PAIR(0x9E6D, 0xC5D5)
+DOUBLE_BYTE_PAIR(0x9E6E, 0xC5D6)
+DOUBLE_BYTE_PAIR(0x9E6F, 0xC5D7)
+DOUBLE_BYTE_PAIR(0x9E70, 0xC5D9)
+DOUBLE_BYTE_PAIR(0x9E71, 0xC5DA)
+DOUBLE_BYTE_PAIR(0x9E72, 0xC5DB)
+DOUBLE_BYTE_PAIR(0x9E73, 0xC5DC)
+DOUBLE_BYTE_PAIR(0x9E74, 0xC5DD)
+DOUBLE_BYTE_PAIR(0x9E75, 0xC5DE)
+DOUBLE_BYTE_PAIR(0x9E76, 0xC5DF)
+DOUBLE_BYTE_PAIR(0x9E77, 0xC5E2)
+DOUBLE_BYTE_PAIR(0x9E78, 0xC5E4)
+DOUBLE_BYTE_PAIR(0x9E79, 0xC5E6)
+DOUBLE_BYTE_PAIR(0x9E7A, 0xC5E7)
+DOUBLE_BYTE_PAIR(0x9E81, 0xC5E8)
+DOUBLE_BYTE_PAIR(0x9E82, 0xC5E9)
+DOUBLE_BYTE_PAIR(0x9E83, 0xC5EA)
+DOUBLE_BYTE_PAIR(0x9E84, 0xC5EB)
+DOUBLE_BYTE_PAIR(0x9E85, 0xC5EF)
+DOUBLE_BYTE_PAIR(0x9E86, 0xC5F1)
+DOUBLE_BYTE_PAIR(0x9E87, 0xC5F2)
+DOUBLE_BYTE_PAIR(0x9E88, 0xC5F3)
+DOUBLE_BYTE_PAIR(0x9E89, 0xC5F5)
+DOUBLE_BYTE_PAIR(0x9E8A, 0xC5F8)
+DOUBLE_BYTE_PAIR(0x9E8B, 0xC5F9)
+DOUBLE_BYTE_PAIR(0x9E8C, 0xC5FA)
+DOUBLE_BYTE_PAIR(0x9E8D, 0xC5FB)
+DOUBLE_BYTE_PAIR(0x9E8E, 0xC602)
+DOUBLE_BYTE_PAIR(0x9E8F, 0xC603)
+DOUBLE_BYTE_PAIR(0x9E90, 0xC604)
+DOUBLE_BYTE_PAIR(0x9E91, 0xC609)
+DOUBLE_BYTE_PAIR(0x9E92, 0xC60A)
+DOUBLE_BYTE_PAIR(0x9E93, 0xC60B)
+DOUBLE_BYTE_PAIR(0x9E94, 0xC60D)
+DOUBLE_BYTE_PAIR(0x9E95, 0xC60E)
+DOUBLE_BYTE_PAIR(0x9E96, 0xC60F)
+DOUBLE_BYTE_PAIR(0x9E97, 0xC611)
+DOUBLE_BYTE_PAIR(0x9E98, 0xC612)
+DOUBLE_BYTE_PAIR(0x9E99, 0xC613)
+DOUBLE_BYTE_PAIR(0x9E9A, 0xC614)
+DOUBLE_BYTE_PAIR(0x9E9B, 0xC615)
+DOUBLE_BYTE_PAIR(0x9E9C, 0xC616)
+DOUBLE_BYTE_PAIR(0x9E9D, 0xC617)
+DOUBLE_BYTE_PAIR(0x9E9E, 0xC61A)
+DOUBLE_BYTE_PAIR(0x9E9F, 0xC61D)
+DOUBLE_BYTE_PAIR(0x9EA0, 0xC61E)
+DOUBLE_BYTE_PAIR(0x9EA1, 0xC61F)
+DOUBLE_BYTE_PAIR(0x9EA2, 0xC620)
+DOUBLE_BYTE_PAIR(0x9EA3, 0xC621)
+DOUBLE_BYTE_PAIR(0x9EA4, 0xC622)
+DOUBLE_BYTE_PAIR(0x9EA5, 0xC623)
+DOUBLE_BYTE_PAIR(0x9EA6, 0xC626)
+DOUBLE_BYTE_PAIR(0x9EA7, 0xC627)
+DOUBLE_BYTE_PAIR(0x9EA8, 0xC629)
+DOUBLE_BYTE_PAIR(0x9EA9, 0xC62A)
+DOUBLE_BYTE_PAIR(0x9EAA, 0xC62B)
+DOUBLE_BYTE_PAIR(0x9EAB, 0xC62F)
+DOUBLE_BYTE_PAIR(0x9EAC, 0xC631)
+DOUBLE_BYTE_PAIR(0x9EAD, 0xC632)
+DOUBLE_BYTE_PAIR(0x9EAE, 0xC636)
+DOUBLE_BYTE_PAIR(0x9EAF, 0xC638)
+DOUBLE_BYTE_PAIR(0x9EB0, 0xC63A)
+DOUBLE_BYTE_PAIR(0x9EB1, 0xC63C)
+DOUBLE_BYTE_PAIR(0x9EB2, 0xC63D)
+DOUBLE_BYTE_PAIR(0x9EB3, 0xC63E)
+DOUBLE_BYTE_PAIR(0x9EB4, 0xC63F)
+DOUBLE_BYTE_PAIR(0x9EB5, 0xC642)
+DOUBLE_BYTE_PAIR(0x9EB6, 0xC643)
+DOUBLE_BYTE_PAIR(0x9EB7, 0xC645)
+DOUBLE_BYTE_PAIR(0x9EB8, 0xC646)
+DOUBLE_BYTE_PAIR(0x9EB9, 0xC647)
+DOUBLE_BYTE_PAIR(0x9EBA, 0xC649)
+DOUBLE_BYTE_PAIR(0x9EBB, 0xC64A)
+DOUBLE_BYTE_PAIR(0x9EBC, 0xC64B)
+DOUBLE_BYTE_PAIR(0x9EBD, 0xC64C)
+DOUBLE_BYTE_PAIR(0x9EBE, 0xC64D)
+DOUBLE_BYTE_PAIR(0x9EBF, 0xC64E)
+DOUBLE_BYTE_PAIR(0x9EC0, 0xC64F)
+DOUBLE_BYTE_PAIR(0x9EC1, 0xC652)
+DOUBLE_BYTE_PAIR(0x9EC2, 0xC656)
+DOUBLE_BYTE_PAIR(0x9EC3, 0xC657)
+DOUBLE_BYTE_PAIR(0x9EC4, 0xC658)
+DOUBLE_BYTE_PAIR(0x9EC5, 0xC659)
+DOUBLE_BYTE_PAIR(0x9EC6, 0xC65A)
+DOUBLE_BYTE_PAIR(0x9EC7, 0xC65B)
+DOUBLE_BYTE_PAIR(0x9EC8, 0xC65E)
+DOUBLE_BYTE_PAIR(0x9EC9, 0xC65F)
+DOUBLE_BYTE_PAIR(0x9ECA, 0xC661)
+DOUBLE_BYTE_PAIR(0x9ECB, 0xC662)
+DOUBLE_BYTE_PAIR(0x9ECC, 0xC663)
+DOUBLE_BYTE_PAIR(0x9ECD, 0xC664)
+DOUBLE_BYTE_PAIR(0x9ECE, 0xC665)
+DOUBLE_BYTE_PAIR(0x9ECF, 0xC666)
+DOUBLE_BYTE_PAIR(0x9ED0, 0xC667)
+DOUBLE_BYTE_PAIR(0x9ED1, 0xC668)
+DOUBLE_BYTE_PAIR(0x9ED2, 0xC669)
+DOUBLE_BYTE_PAIR(0x9ED3, 0xC66A)
+DOUBLE_BYTE_PAIR(0x9ED4, 0xC66B)
+DOUBLE_BYTE_PAIR(0x9ED5, 0xC66D)
+DOUBLE_BYTE_PAIR(0x9ED6, 0xC66E)
+DOUBLE_BYTE_PAIR(0x9ED7, 0xC670)
+DOUBLE_BYTE_PAIR(0x9ED8, 0xC672)
+DOUBLE_BYTE_PAIR(0x9ED9, 0xC673)
+DOUBLE_BYTE_PAIR(0x9EDA, 0xC674)
+DOUBLE_BYTE_PAIR(0x9EDB, 0xC675)
+DOUBLE_BYTE_PAIR(0x9EDC, 0xC676)
+DOUBLE_BYTE_PAIR(0x9EDD, 0xC677)
+DOUBLE_BYTE_PAIR(0x9EDE, 0xC67A)
+DOUBLE_BYTE_PAIR(0x9EDF, 0xC67B)
+DOUBLE_BYTE_PAIR(0x9EE0, 0xC67D)
+DOUBLE_BYTE_PAIR(0x9EE1, 0xC67E)
+DOUBLE_BYTE_PAIR(0x9EE2, 0xC67F)
+DOUBLE_BYTE_PAIR(0x9EE3, 0xC681)
+DOUBLE_BYTE_PAIR(0x9EE4, 0xC682)
+DOUBLE_BYTE_PAIR(0x9EE5, 0xC683)
+DOUBLE_BYTE_PAIR(0x9EE6, 0xC684)
+DOUBLE_BYTE_PAIR(0x9EE7, 0xC685)
+DOUBLE_BYTE_PAIR(0x9EE8, 0xC686)
+DOUBLE_BYTE_PAIR(0x9EE9, 0xC687)
+DOUBLE_BYTE_PAIR(0x9EEA, 0xC68A)
+DOUBLE_BYTE_PAIR(0x9EEB, 0xC68C)
+DOUBLE_BYTE_PAIR(0x9EEC, 0xC68E)
+DOUBLE_BYTE_PAIR(0x9EED, 0xC68F)
+DOUBLE_BYTE_PAIR(0x9EEE, 0xC690)
+DOUBLE_BYTE_PAIR(0x9EEF, 0xC691)
+DOUBLE_BYTE_PAIR(0x9EF0, 0xC692)
+DOUBLE_BYTE_PAIR(0x9EF1, 0xC693)
+DOUBLE_BYTE_PAIR(0x9EF2, 0xC696)
+DOUBLE_BYTE_PAIR(0x9EF3, 0xC697)
+DOUBLE_BYTE_PAIR(0x9EF4, 0xC699)
+DOUBLE_BYTE_PAIR(0x9EF5, 0xC69A)
+DOUBLE_BYTE_PAIR(0x9EF6, 0xC69B)
+DOUBLE_BYTE_PAIR(0x9EF7, 0xC69D)
+DOUBLE_BYTE_PAIR(0x9EF8, 0xC69E)
+DOUBLE_BYTE_PAIR(0x9EF9, 0xC69F)
+DOUBLE_BYTE_PAIR(0x9EFA, 0xC6A0)
+DOUBLE_BYTE_PAIR(0x9EFB, 0xC6A1)
+DOUBLE_BYTE_PAIR(0x9EFC, 0xC6A2)
+DOUBLE_BYTE_PAIR(0x9EFD, 0xC6A3)
+DOUBLE_BYTE_PAIR(0x9EFE, 0xC6A6)
+DOUBLE_BYTE_PAIR(0x9F41, 0xC6A8)
+DOUBLE_BYTE_PAIR(0x9F42, 0xC6AA)
+DOUBLE_BYTE_PAIR(0x9F43, 0xC6AB)
+DOUBLE_BYTE_PAIR(0x9F44, 0xC6AC)
+DOUBLE_BYTE_PAIR(0x9F45, 0xC6AD)
+DOUBLE_BYTE_PAIR(0x9F46, 0xC6AE)
+DOUBLE_BYTE_PAIR(0x9F47, 0xC6AF)
+DOUBLE_BYTE_PAIR(0x9F48, 0xC6B2)
+DOUBLE_BYTE_PAIR(0x9F49, 0xC6B3)
+DOUBLE_BYTE_PAIR(0x9F4A, 0xC6B5)
+DOUBLE_BYTE_PAIR(0x9F4B, 0xC6B6)
+DOUBLE_BYTE_PAIR(0x9F4C, 0xC6B7)
+DOUBLE_BYTE_PAIR(0x9F4D, 0xC6BB)
+DOUBLE_BYTE_PAIR(0x9F4E, 0xC6BC)
+DOUBLE_BYTE_PAIR(0x9F4F, 0xC6BD)
+DOUBLE_BYTE_PAIR(0x9F50, 0xC6BE)
+DOUBLE_BYTE_PAIR(0x9F51, 0xC6BF)
+DOUBLE_BYTE_PAIR(0x9F52, 0xC6C2)
+DOUBLE_BYTE_PAIR(0x9F53, 0xC6C4)
+DOUBLE_BYTE_PAIR(0x9F54, 0xC6C6)
+DOUBLE_BYTE_PAIR(0x9F55, 0xC6C7)
+DOUBLE_BYTE_PAIR(0x9F56, 0xC6C8)
+DOUBLE_BYTE_PAIR(0x9F57, 0xC6C9)
+DOUBLE_BYTE_PAIR(0x9F58, 0xC6CA)
+DOUBLE_BYTE_PAIR(0x9F59, 0xC6CB)
+DOUBLE_BYTE_PAIR(0x9F5A, 0xC6CE)
+DOUBLE_BYTE_PAIR(0x9F61, 0xC6CF)
+DOUBLE_BYTE_PAIR(0x9F62, 0xC6D1)
+DOUBLE_BYTE_PAIR(0x9F63, 0xC6D2)
+DOUBLE_BYTE_PAIR(0x9F64, 0xC6D3)
+DOUBLE_BYTE_PAIR(0x9F65, 0xC6D5)
+DOUBLE_BYTE_PAIR(0x9F66, 0xC6D6)
+DOUBLE_BYTE_PAIR(0x9F67, 0xC6D7)
+DOUBLE_BYTE_PAIR(0x9F68, 0xC6D8)
+DOUBLE_BYTE_PAIR(0x9F69, 0xC6D9)
+DOUBLE_BYTE_PAIR(0x9F6A, 0xC6DA)
+DOUBLE_BYTE_PAIR(0x9F6B, 0xC6DB)
+DOUBLE_BYTE_PAIR(0x9F6C, 0xC6DE)
+DOUBLE_BYTE_PAIR(0x9F6D, 0xC6DF)
+DOUBLE_BYTE_PAIR(0x9F6E, 0xC6E2)
+DOUBLE_BYTE_PAIR(0x9F6F, 0xC6E3)
+DOUBLE_BYTE_PAIR(0x9F70, 0xC6E4)
+DOUBLE_BYTE_PAIR(0x9F71, 0xC6E5)
+DOUBLE_BYTE_PAIR(0x9F72, 0xC6E6)
+DOUBLE_BYTE_PAIR(0x9F73, 0xC6E7)
+DOUBLE_BYTE_PAIR(0x9F74, 0xC6EA)
+DOUBLE_BYTE_PAIR(0x9F75, 0xC6EB)
+DOUBLE_BYTE_PAIR(0x9F76, 0xC6ED)
+DOUBLE_BYTE_PAIR(0x9F77, 0xC6EE)
+DOUBLE_BYTE_PAIR(0x9F78, 0xC6EF)
+DOUBLE_BYTE_PAIR(0x9F79, 0xC6F1)
+DOUBLE_BYTE_PAIR(0x9F7A, 0xC6F2)
+DOUBLE_BYTE_PAIR(0x9F81, 0xC6F3)
+DOUBLE_BYTE_PAIR(0x9F82, 0xC6F4)
+DOUBLE_BYTE_PAIR(0x9F83, 0xC6F5)
+DOUBLE_BYTE_PAIR(0x9F84, 0xC6F6)
+DOUBLE_BYTE_PAIR(0x9F85, 0xC6F7)
+DOUBLE_BYTE_PAIR(0x9F86, 0xC6FA)
+DOUBLE_BYTE_PAIR(0x9F87, 0xC6FB)
+DOUBLE_BYTE_PAIR(0x9F88, 0xC6FC)
+DOUBLE_BYTE_PAIR(0x9F89, 0xC6FE)
+DOUBLE_BYTE_PAIR(0x9F8A, 0xC6FF)
+DOUBLE_BYTE_PAIR(0x9F8B, 0xC700)
+DOUBLE_BYTE_PAIR(0x9F8C, 0xC701)
+DOUBLE_BYTE_PAIR(0x9F8D, 0xC702)
+DOUBLE_BYTE_PAIR(0x9F8E, 0xC703)
+DOUBLE_BYTE_PAIR(0x9F8F, 0xC706)
+DOUBLE_BYTE_PAIR(0x9F90, 0xC707)
+DOUBLE_BYTE_PAIR(0x9F91, 0xC709)
+DOUBLE_BYTE_PAIR(0x9F92, 0xC70A)
+DOUBLE_BYTE_PAIR(0x9F93, 0xC70B)
+DOUBLE_BYTE_PAIR(0x9F94, 0xC70D)
+DOUBLE_BYTE_PAIR(0x9F95, 0xC70E)
+DOUBLE_BYTE_PAIR(0x9F96, 0xC70F)
+DOUBLE_BYTE_PAIR(0x9F97, 0xC710)
+DOUBLE_BYTE_PAIR(0x9F98, 0xC711)
+DOUBLE_BYTE_PAIR(0x9F99, 0xC712)
+DOUBLE_BYTE_PAIR(0x9F9A, 0xC713)
+DOUBLE_BYTE_PAIR(0x9F9B, 0xC716)
+DOUBLE_BYTE_PAIR(0x9F9C, 0xC718)
+DOUBLE_BYTE_PAIR(0x9F9D, 0xC71A)
+DOUBLE_BYTE_PAIR(0x9F9E, 0xC71B)
+DOUBLE_BYTE_PAIR(0x9F9F, 0xC71C)
+DOUBLE_BYTE_PAIR(0x9FA0, 0xC71D)
+DOUBLE_BYTE_PAIR(0x9FA1, 0xC71E)
+DOUBLE_BYTE_PAIR(0x9FA2, 0xC71F)
+DOUBLE_BYTE_PAIR(0x9FA3, 0xC722)
+DOUBLE_BYTE_PAIR(0x9FA4, 0xC723)
+DOUBLE_BYTE_PAIR(0x9FA5, 0xC725)
+DOUBLE_BYTE_PAIR(0x9FA6, 0xC726)
+DOUBLE_BYTE_PAIR(0x9FA7, 0xC727)
+DOUBLE_BYTE_PAIR(0x9FA8, 0xC729)
+DOUBLE_BYTE_PAIR(0x9FA9, 0xC72A)
+DOUBLE_BYTE_PAIR(0x9FAA, 0xC72B)
+DOUBLE_BYTE_PAIR(0x9FAB, 0xC72C)
+DOUBLE_BYTE_PAIR(0x9FAC, 0xC72D)
+DOUBLE_BYTE_PAIR(0x9FAD, 0xC72E)
+DOUBLE_BYTE_PAIR(0x9FAE, 0xC72F)
+DOUBLE_BYTE_PAIR(0x9FAF, 0xC732)
+DOUBLE_BYTE_PAIR(0x9FB0, 0xC734)
+DOUBLE_BYTE_PAIR(0x9FB1, 0xC736)
+DOUBLE_BYTE_PAIR(0x9FB2, 0xC738)
+DOUBLE_BYTE_PAIR(0x9FB3, 0xC739)
+DOUBLE_BYTE_PAIR(0x9FB4, 0xC73A)
+DOUBLE_BYTE_PAIR(0x9FB5, 0xC73B)
+DOUBLE_BYTE_PAIR(0x9FB6, 0xC73E)
+DOUBLE_BYTE_PAIR(0x9FB7, 0xC73F)
+DOUBLE_BYTE_PAIR(0x9FB8, 0xC741)
+DOUBLE_BYTE_PAIR(0x9FB9, 0xC742)
+DOUBLE_BYTE_PAIR(0x9FBA, 0xC743)
+DOUBLE_BYTE_PAIR(0x9FBB, 0xC745)
+DOUBLE_BYTE_PAIR(0x9FBC, 0xC746)
+DOUBLE_BYTE_PAIR(0x9FBD, 0xC747)
+DOUBLE_BYTE_PAIR(0x9FBE, 0xC748)
+DOUBLE_BYTE_PAIR(0x9FBF, 0xC749)
+DOUBLE_BYTE_PAIR(0x9FC0, 0xC74B)
+DOUBLE_BYTE_PAIR(0x9FC1, 0xC74E)
+DOUBLE_BYTE_PAIR(0x9FC2, 0xC750)
+DOUBLE_BYTE_PAIR(0x9FC3, 0xC759)
+DOUBLE_BYTE_PAIR(0x9FC4, 0xC75A)
+DOUBLE_BYTE_PAIR(0x9FC5, 0xC75B)
+DOUBLE_BYTE_PAIR(0x9FC6, 0xC75D)
+DOUBLE_BYTE_PAIR(0x9FC7, 0xC75E)
+DOUBLE_BYTE_PAIR(0x9FC8, 0xC75F)
+DOUBLE_BYTE_PAIR(0x9FC9, 0xC761)
+DOUBLE_BYTE_PAIR(0x9FCA, 0xC762)
+DOUBLE_BYTE_PAIR(0x9FCB, 0xC763)
+DOUBLE_BYTE_PAIR(0x9FCC, 0xC764)
+DOUBLE_BYTE_PAIR(0x9FCD, 0xC765)
+DOUBLE_BYTE_PAIR(0x9FCE, 0xC766)
+DOUBLE_BYTE_PAIR(0x9FCF, 0xC767)
+DOUBLE_BYTE_PAIR(0x9FD0, 0xC769)
+DOUBLE_BYTE_PAIR(0x9FD1, 0xC76A)
+DOUBLE_BYTE_PAIR(0x9FD2, 0xC76C)
+DOUBLE_BYTE_PAIR(0x9FD3, 0xC76D)
+DOUBLE_BYTE_PAIR(0x9FD4, 0xC76E)
+DOUBLE_BYTE_PAIR(0x9FD5, 0xC76F)
+DOUBLE_BYTE_PAIR(0x9FD6, 0xC770)
+DOUBLE_BYTE_PAIR(0x9FD7, 0xC771)
+DOUBLE_BYTE_PAIR(0x9FD8, 0xC772)
+DOUBLE_BYTE_PAIR(0x9FD9, 0xC773)
+DOUBLE_BYTE_PAIR(0x9FDA, 0xC776)
+DOUBLE_BYTE_PAIR(0x9FDB, 0xC777)
+DOUBLE_BYTE_PAIR(0x9FDC, 0xC779)
+DOUBLE_BYTE_PAIR(0x9FDD, 0xC77A)
+DOUBLE_BYTE_PAIR(0x9FDE, 0xC77B)
+DOUBLE_BYTE_PAIR(0x9FDF, 0xC77F)
+DOUBLE_BYTE_PAIR(0x9FE0, 0xC780)
+DOUBLE_BYTE_PAIR(0x9FE1, 0xC781)
+DOUBLE_BYTE_PAIR(0x9FE2, 0xC782)
+DOUBLE_BYTE_PAIR(0x9FE3, 0xC786)
+DOUBLE_BYTE_PAIR(0x9FE4, 0xC78B)
+DOUBLE_BYTE_PAIR(0x9FE5, 0xC78C)
+DOUBLE_BYTE_PAIR(0x9FE6, 0xC78D)
+DOUBLE_BYTE_PAIR(0x9FE7, 0xC78F)
+DOUBLE_BYTE_PAIR(0x9FE8, 0xC792)
+DOUBLE_BYTE_PAIR(0x9FE9, 0xC793)
+DOUBLE_BYTE_PAIR(0x9FEA, 0xC795)
+DOUBLE_BYTE_PAIR(0x9FEB, 0xC799)
+DOUBLE_BYTE_PAIR(0x9FEC, 0xC79B)
+DOUBLE_BYTE_PAIR(0x9FED, 0xC79C)
+DOUBLE_BYTE_PAIR(0x9FEE, 0xC79D)
+DOUBLE_BYTE_PAIR(0x9FEF, 0xC79E)
+DOUBLE_BYTE_PAIR(0x9FF0, 0xC79F)
+DOUBLE_BYTE_PAIR(0x9FF1, 0xC7A2)
+DOUBLE_BYTE_PAIR(0x9FF2, 0xC7A7)
+DOUBLE_BYTE_PAIR(0x9FF3, 0xC7A8)
+DOUBLE_BYTE_PAIR(0x9FF4, 0xC7A9)
+DOUBLE_BYTE_PAIR(0x9FF5, 0xC7AA)
+DOUBLE_BYTE_PAIR(0x9FF6, 0xC7AB)
+DOUBLE_BYTE_PAIR(0x9FF7, 0xC7AE)
+DOUBLE_BYTE_PAIR(0x9FF8, 0xC7AF)
+DOUBLE_BYTE_PAIR(0x9FF9, 0xC7B1)
+DOUBLE_BYTE_PAIR(0x9FFA, 0xC7B2)
+DOUBLE_BYTE_PAIR(0x9FFB, 0xC7B3)
+DOUBLE_BYTE_PAIR(0x9FFC, 0xC7B5)
+DOUBLE_BYTE_PAIR(0x9FFD, 0xC7B6)
+DOUBLE_BYTE_PAIR(0x9FFE, 0xC7B7)
+DOUBLE_BYTE_PAIR(0xA041, 0xC7B8)
+DOUBLE_BYTE_PAIR(0xA042, 0xC7B9)
+DOUBLE_BYTE_PAIR(0xA043, 0xC7BA)
+DOUBLE_BYTE_PAIR(0xA044, 0xC7BB)
+DOUBLE_BYTE_PAIR(0xA045, 0xC7BE)
+DOUBLE_BYTE_PAIR(0xA046, 0xC7C2)
+DOUBLE_BYTE_PAIR(0xA047, 0xC7C3)
+DOUBLE_BYTE_PAIR(0xA048, 0xC7C4)
+DOUBLE_BYTE_PAIR(0xA049, 0xC7C5)
+DOUBLE_BYTE_PAIR(0xA04A, 0xC7C6)
+DOUBLE_BYTE_PAIR(0xA04B, 0xC7C7)
+DOUBLE_BYTE_PAIR(0xA04C, 0xC7CA)
+DOUBLE_BYTE_PAIR(0xA04D, 0xC7CB)
+DOUBLE_BYTE_PAIR(0xA04E, 0xC7CD)
+DOUBLE_BYTE_PAIR(0xA04F, 0xC7CF)
+DOUBLE_BYTE_PAIR(0xA050, 0xC7D1)
+DOUBLE_BYTE_PAIR(0xA051, 0xC7D2)
+DOUBLE_BYTE_PAIR(0xA052, 0xC7D3)
+DOUBLE_BYTE_PAIR(0xA053, 0xC7D4)
+DOUBLE_BYTE_PAIR(0xA054, 0xC7D5)
+DOUBLE_BYTE_PAIR(0xA055, 0xC7D6)
+DOUBLE_BYTE_PAIR(0xA056, 0xC7D7)
+DOUBLE_BYTE_PAIR(0xA057, 0xC7D9)
+DOUBLE_BYTE_PAIR(0xA058, 0xC7DA)
+DOUBLE_BYTE_PAIR(0xA059, 0xC7DB)
+DOUBLE_BYTE_PAIR(0xA05A, 0xC7DC)
+DOUBLE_BYTE_PAIR(0xA061, 0xC7DE)
+DOUBLE_BYTE_PAIR(0xA062, 0xC7DF)
+DOUBLE_BYTE_PAIR(0xA063, 0xC7E0)
+DOUBLE_BYTE_PAIR(0xA064, 0xC7E1)
+DOUBLE_BYTE_PAIR(0xA065, 0xC7E2)
+DOUBLE_BYTE_PAIR(0xA066, 0xC7E3)
+DOUBLE_BYTE_PAIR(0xA067, 0xC7E5)
+DOUBLE_BYTE_PAIR(0xA068, 0xC7E6)
+DOUBLE_BYTE_PAIR(0xA069, 0xC7E7)
+DOUBLE_BYTE_PAIR(0xA06A, 0xC7E9)
+DOUBLE_BYTE_PAIR(0xA06B, 0xC7EA)
+DOUBLE_BYTE_PAIR(0xA06C, 0xC7EB)
+DOUBLE_BYTE_PAIR(0xA06D, 0xC7ED)
+DOUBLE_BYTE_PAIR(0xA06E, 0xC7EE)
+DOUBLE_BYTE_PAIR(0xA06F, 0xC7EF)
+DOUBLE_BYTE_PAIR(0xA070, 0xC7F0)
+DOUBLE_BYTE_PAIR(0xA071, 0xC7F1)
+DOUBLE_BYTE_PAIR(0xA072, 0xC7F2)
+DOUBLE_BYTE_PAIR(0xA073, 0xC7F3)
+DOUBLE_BYTE_PAIR(0xA074, 0xC7F4)
+DOUBLE_BYTE_PAIR(0xA075, 0xC7F5)
+DOUBLE_BYTE_PAIR(0xA076, 0xC7F6)
+DOUBLE_BYTE_PAIR(0xA077, 0xC7F7)
+DOUBLE_BYTE_PAIR(0xA078, 0xC7F8)
+DOUBLE_BYTE_PAIR(0xA079, 0xC7F9)
+DOUBLE_BYTE_PAIR(0xA07A, 0xC7FA)
+DOUBLE_BYTE_PAIR(0xA081, 0xC7FB)
+DOUBLE_BYTE_PAIR(0xA082, 0xC7FC)
+DOUBLE_BYTE_PAIR(0xA083, 0xC7FD)
+DOUBLE_BYTE_PAIR(0xA084, 0xC7FE)
+DOUBLE_BYTE_PAIR(0xA085, 0xC7FF)
+DOUBLE_BYTE_PAIR(0xA086, 0xC802)
+DOUBLE_BYTE_PAIR(0xA087, 0xC803)
+DOUBLE_BYTE_PAIR(0xA088, 0xC805)
+DOUBLE_BYTE_PAIR(0xA089, 0xC806)
+DOUBLE_BYTE_PAIR(0xA08A, 0xC807)
+DOUBLE_BYTE_PAIR(0xA08B, 0xC809)
+DOUBLE_BYTE_PAIR(0xA08C, 0xC80B)
+DOUBLE_BYTE_PAIR(0xA08D, 0xC80C)
+DOUBLE_BYTE_PAIR(0xA08E, 0xC80D)
+DOUBLE_BYTE_PAIR(0xA08F, 0xC80E)
+DOUBLE_BYTE_PAIR(0xA090, 0xC80F)
+DOUBLE_BYTE_PAIR(0xA091, 0xC812)
+DOUBLE_BYTE_PAIR(0xA092, 0xC814)
+DOUBLE_BYTE_PAIR(0xA093, 0xC817)
+DOUBLE_BYTE_PAIR(0xA094, 0xC818)
+DOUBLE_BYTE_PAIR(0xA095, 0xC819)
+DOUBLE_BYTE_PAIR(0xA096, 0xC81A)
+DOUBLE_BYTE_PAIR(0xA097, 0xC81B)
+DOUBLE_BYTE_PAIR(0xA098, 0xC81E)
+DOUBLE_BYTE_PAIR(0xA099, 0xC81F)
+DOUBLE_BYTE_PAIR(0xA09A, 0xC821)
+DOUBLE_BYTE_PAIR(0xA09B, 0xC822)
+DOUBLE_BYTE_PAIR(0xA09C, 0xC823)
+DOUBLE_BYTE_PAIR(0xA09D, 0xC825)
+DOUBLE_BYTE_PAIR(0xA09E, 0xC826)
+DOUBLE_BYTE_PAIR(0xA09F, 0xC827)
+DOUBLE_BYTE_PAIR(0xA0A0, 0xC828)
+DOUBLE_BYTE_PAIR(0xA0A1, 0xC829)
+DOUBLE_BYTE_PAIR(0xA0A2, 0xC82A)
+DOUBLE_BYTE_PAIR(0xA0A3, 0xC82B)
+DOUBLE_BYTE_PAIR(0xA0A4, 0xC82E)
+DOUBLE_BYTE_PAIR(0xA0A5, 0xC830)
+DOUBLE_BYTE_PAIR(0xA0A6, 0xC832)
+DOUBLE_BYTE_PAIR(0xA0A7, 0xC833)
+DOUBLE_BYTE_PAIR(0xA0A8, 0xC834)
+DOUBLE_BYTE_PAIR(0xA0A9, 0xC835)
+DOUBLE_BYTE_PAIR(0xA0AA, 0xC836)
+DOUBLE_BYTE_PAIR(0xA0AB, 0xC837)
+DOUBLE_BYTE_PAIR(0xA0AC, 0xC839)
+DOUBLE_BYTE_PAIR(0xA0AD, 0xC83A)
+DOUBLE_BYTE_PAIR(0xA0AE, 0xC83B)
+DOUBLE_BYTE_PAIR(0xA0AF, 0xC83D)
+DOUBLE_BYTE_PAIR(0xA0B0, 0xC83E)
+DOUBLE_BYTE_PAIR(0xA0B1, 0xC83F)
+DOUBLE_BYTE_PAIR(0xA0B2, 0xC841)
+DOUBLE_BYTE_PAIR(0xA0B3, 0xC842)
+DOUBLE_BYTE_PAIR(0xA0B4, 0xC843)
+DOUBLE_BYTE_PAIR(0xA0B5, 0xC844)
+DOUBLE_BYTE_PAIR(0xA0B6, 0xC845)
+DOUBLE_BYTE_PAIR(0xA0B7, 0xC846)
+DOUBLE_BYTE_PAIR(0xA0B8, 0xC847)
+DOUBLE_BYTE_PAIR(0xA0B9, 0xC84A)
+DOUBLE_BYTE_PAIR(0xA0BA, 0xC84B)
+DOUBLE_BYTE_PAIR(0xA0BB, 0xC84E)
+DOUBLE_BYTE_PAIR(0xA0BC, 0xC84F)
+DOUBLE_BYTE_PAIR(0xA0BD, 0xC850)
+DOUBLE_BYTE_PAIR(0xA0BE, 0xC851)
+DOUBLE_BYTE_PAIR(0xA0BF, 0xC852)
+DOUBLE_BYTE_PAIR(0xA0C0, 0xC853)
+DOUBLE_BYTE_PAIR(0xA0C1, 0xC855)
+DOUBLE_BYTE_PAIR(0xA0C2, 0xC856)
+DOUBLE_BYTE_PAIR(0xA0C3, 0xC857)
+DOUBLE_BYTE_PAIR(0xA0C4, 0xC858)
+DOUBLE_BYTE_PAIR(0xA0C5, 0xC859)
+DOUBLE_BYTE_PAIR(0xA0C6, 0xC85A)
+DOUBLE_BYTE_PAIR(0xA0C7, 0xC85B)
+DOUBLE_BYTE_PAIR(0xA0C8, 0xC85C)
+DOUBLE_BYTE_PAIR(0xA0C9, 0xC85D)
+DOUBLE_BYTE_PAIR(0xA0CA, 0xC85E)
+DOUBLE_BYTE_PAIR(0xA0CB, 0xC85F)
+DOUBLE_BYTE_PAIR(0xA0CC, 0xC860)
+DOUBLE_BYTE_PAIR(0xA0CD, 0xC861)
+DOUBLE_BYTE_PAIR(0xA0CE, 0xC862)
+DOUBLE_BYTE_PAIR(0xA0CF, 0xC863)
+DOUBLE_BYTE_PAIR(0xA0D0, 0xC864)
+DOUBLE_BYTE_PAIR(0xA0D1, 0xC865)
+DOUBLE_BYTE_PAIR(0xA0D2, 0xC866)
+DOUBLE_BYTE_PAIR(0xA0D3, 0xC867)
+DOUBLE_BYTE_PAIR(0xA0D4, 0xC868)
+DOUBLE_BYTE_PAIR(0xA0D5, 0xC869)
+DOUBLE_BYTE_PAIR(0xA0D6, 0xC86A)
+DOUBLE_BYTE_PAIR(0xA0D7, 0xC86B)
+DOUBLE_BYTE_PAIR(0xA0D8, 0xC86C)
+DOUBLE_BYTE_PAIR(0xA0D9, 0xC86D)
+DOUBLE_BYTE_PAIR(0xA0DA, 0xC86E)
+DOUBLE_BYTE_PAIR(0xA0DB, 0xC86F)
+DOUBLE_BYTE_PAIR(0xA0DC, 0xC872)
+DOUBLE_BYTE_PAIR(0xA0DD, 0xC873)
+DOUBLE_BYTE_PAIR(0xA0DE, 0xC875)
+DOUBLE_BYTE_PAIR(0xA0DF, 0xC876)
+DOUBLE_BYTE_PAIR(0xA0E0, 0xC877)
+DOUBLE_BYTE_PAIR(0xA0E1, 0xC879)
+DOUBLE_BYTE_PAIR(0xA0E2, 0xC87B)
+DOUBLE_BYTE_PAIR(0xA0E3, 0xC87C)
+DOUBLE_BYTE_PAIR(0xA0E4, 0xC87D)
+DOUBLE_BYTE_PAIR(0xA0E5, 0xC87E)
+DOUBLE_BYTE_PAIR(0xA0E6, 0xC87F)
+DOUBLE_BYTE_PAIR(0xA0E7, 0xC882)
+DOUBLE_BYTE_PAIR(0xA0E8, 0xC884)
+DOUBLE_BYTE_PAIR(0xA0E9, 0xC888)
+DOUBLE_BYTE_PAIR(0xA0EA, 0xC889)
+DOUBLE_BYTE_PAIR(0xA0EB, 0xC88A)
+DOUBLE_BYTE_PAIR(0xA0EC, 0xC88E)
+DOUBLE_BYTE_PAIR(0xA0ED, 0xC88F)
+DOUBLE_BYTE_PAIR(0xA0EE, 0xC890)
+DOUBLE_BYTE_PAIR(0xA0EF, 0xC891)
+DOUBLE_BYTE_PAIR(0xA0F0, 0xC892)
+DOUBLE_BYTE_PAIR(0xA0F1, 0xC893)
+DOUBLE_BYTE_PAIR(0xA0F2, 0xC895)
+DOUBLE_BYTE_PAIR(0xA0F3, 0xC896)
+DOUBLE_BYTE_PAIR(0xA0F4, 0xC897)
+DOUBLE_BYTE_PAIR(0xA0F5, 0xC898)
+DOUBLE_BYTE_PAIR(0xA0F6, 0xC899)
+DOUBLE_BYTE_PAIR(0xA0F7, 0xC89A)
+DOUBLE_BYTE_PAIR(0xA0F8, 0xC89B)
+DOUBLE_BYTE_PAIR(0xA0F9, 0xC89C)
+DOUBLE_BYTE_PAIR(0xA0FA, 0xC89E)
+DOUBLE_BYTE_PAIR(0xA0FB, 0xC8A0)
+DOUBLE_BYTE_PAIR(0xA0FC, 0xC8A2)
+DOUBLE_BYTE_PAIR(0xA0FD, 0xC8A3)
+DOUBLE_BYTE_PAIR(0xA0FE, 0xC8A4)
+DOUBLE_BYTE_PAIR(0xA141, 0xC8A5)
+DOUBLE_BYTE_PAIR(0xA142, 0xC8A6)
+DOUBLE_BYTE_PAIR(0xA143, 0xC8A7)
+DOUBLE_BYTE_PAIR(0xA144, 0xC8A9)
+DOUBLE_BYTE_PAIR(0xA145, 0xC8AA)
+DOUBLE_BYTE_PAIR(0xA146, 0xC8AB)
+DOUBLE_BYTE_PAIR(0xA147, 0xC8AC)
+DOUBLE_BYTE_PAIR(0xA148, 0xC8AD)
+DOUBLE_BYTE_PAIR(0xA149, 0xC8AE)
+DOUBLE_BYTE_PAIR(0xA14A, 0xC8AF)
+DOUBLE_BYTE_PAIR(0xA14B, 0xC8B0)
+DOUBLE_BYTE_PAIR(0xA14C, 0xC8B1)
+DOUBLE_BYTE_PAIR(0xA14D, 0xC8B2)
+DOUBLE_BYTE_PAIR(0xA14E, 0xC8B3)
+DOUBLE_BYTE_PAIR(0xA14F, 0xC8B4)
+DOUBLE_BYTE_PAIR(0xA150, 0xC8B5)
+DOUBLE_BYTE_PAIR(0xA151, 0xC8B6)
+DOUBLE_BYTE_PAIR(0xA152, 0xC8B7)
+DOUBLE_BYTE_PAIR(0xA153, 0xC8B8)
+DOUBLE_BYTE_PAIR(0xA154, 0xC8B9)
+DOUBLE_BYTE_PAIR(0xA155, 0xC8BA)
+DOUBLE_BYTE_PAIR(0xA156, 0xC8BB)
+DOUBLE_BYTE_PAIR(0xA157, 0xC8BE)
+DOUBLE_BYTE_PAIR(0xA158, 0xC8BF)
+DOUBLE_BYTE_PAIR(0xA159, 0xC8C0)
+DOUBLE_BYTE_PAIR(0xA15A, 0xC8C1)
+DOUBLE_BYTE_PAIR(0xA161, 0xC8C2)
+DOUBLE_BYTE_PAIR(0xA162, 0xC8C3)
+DOUBLE_BYTE_PAIR(0xA163, 0xC8C5)
+DOUBLE_BYTE_PAIR(0xA164, 0xC8C6)
+DOUBLE_BYTE_PAIR(0xA165, 0xC8C7)
+DOUBLE_BYTE_PAIR(0xA166, 0xC8C9)
+DOUBLE_BYTE_PAIR(0xA167, 0xC8CA)
+DOUBLE_BYTE_PAIR(0xA168, 0xC8CB)
+DOUBLE_BYTE_PAIR(0xA169, 0xC8CD)
+DOUBLE_BYTE_PAIR(0xA16A, 0xC8CE)
+DOUBLE_BYTE_PAIR(0xA16B, 0xC8CF)
+DOUBLE_BYTE_PAIR(0xA16C, 0xC8D0)
+DOUBLE_BYTE_PAIR(0xA16D, 0xC8D1)
+DOUBLE_BYTE_PAIR(0xA16E, 0xC8D2)
+DOUBLE_BYTE_PAIR(0xA16F, 0xC8D3)
+DOUBLE_BYTE_PAIR(0xA170, 0xC8D6)
+DOUBLE_BYTE_PAIR(0xA171, 0xC8D8)
+DOUBLE_BYTE_PAIR(0xA172, 0xC8DA)
+DOUBLE_BYTE_PAIR(0xA173, 0xC8DB)
+DOUBLE_BYTE_PAIR(0xA174, 0xC8DC)
+DOUBLE_BYTE_PAIR(0xA175, 0xC8DD)
+DOUBLE_BYTE_PAIR(0xA176, 0xC8DE)
+DOUBLE_BYTE_PAIR(0xA177, 0xC8DF)
+DOUBLE_BYTE_PAIR(0xA178, 0xC8E2)
+DOUBLE_BYTE_PAIR(0xA179, 0xC8E3)
+DOUBLE_BYTE_PAIR(0xA17A, 0xC8E5)
+DOUBLE_BYTE_PAIR(0xA181, 0xC8E6)
+DOUBLE_BYTE_PAIR(0xA182, 0xC8E7)
+DOUBLE_BYTE_PAIR(0xA183, 0xC8E8)
+DOUBLE_BYTE_PAIR(0xA184, 0xC8E9)
+DOUBLE_BYTE_PAIR(0xA185, 0xC8EA)
+DOUBLE_BYTE_PAIR(0xA186, 0xC8EB)
+DOUBLE_BYTE_PAIR(0xA187, 0xC8EC)
+DOUBLE_BYTE_PAIR(0xA188, 0xC8ED)
+DOUBLE_BYTE_PAIR(0xA189, 0xC8EE)
+DOUBLE_BYTE_PAIR(0xA18A, 0xC8EF)
+DOUBLE_BYTE_PAIR(0xA18B, 0xC8F0)
+DOUBLE_BYTE_PAIR(0xA18C, 0xC8F1)
+DOUBLE_BYTE_PAIR(0xA18D, 0xC8F2)
+DOUBLE_BYTE_PAIR(0xA18E, 0xC8F3)
+DOUBLE_BYTE_PAIR(0xA18F, 0xC8F4)
+DOUBLE_BYTE_PAIR(0xA190, 0xC8F6)
+DOUBLE_BYTE_PAIR(0xA191, 0xC8F7)
+DOUBLE_BYTE_PAIR(0xA192, 0xC8F8)
+DOUBLE_BYTE_PAIR(0xA193, 0xC8F9)
+DOUBLE_BYTE_PAIR(0xA194, 0xC8FA)
+DOUBLE_BYTE_PAIR(0xA195, 0xC8FB)
+DOUBLE_BYTE_PAIR(0xA196, 0xC8FE)
+DOUBLE_BYTE_PAIR(0xA197, 0xC8FF)
+DOUBLE_BYTE_PAIR(0xA198, 0xC901)
+DOUBLE_BYTE_PAIR(0xA199, 0xC902)
+DOUBLE_BYTE_PAIR(0xA19A, 0xC903)
+DOUBLE_BYTE_PAIR(0xA19B, 0xC907)
+DOUBLE_BYTE_PAIR(0xA19C, 0xC908)
+DOUBLE_BYTE_PAIR(0xA19D, 0xC909)
+DOUBLE_BYTE_PAIR(0xA19E, 0xC90A)
+DOUBLE_BYTE_PAIR(0xA19F, 0xC90B)
+DOUBLE_BYTE_PAIR(0xA1A0, 0xC90E)
+DOUBLE_BYTE_PAIR(0xA1A1, 0x3000)
+DOUBLE_BYTE_PAIR(0xA1A2, 0x3001)
+DOUBLE_BYTE_PAIR(0xA1A3, 0x3002)
+DOUBLE_BYTE_PAIR(0xA1A4, 0x00B7)
+DOUBLE_BYTE_PAIR(0xA1A5, 0x2025)
+DOUBLE_BYTE_PAIR(0xA1A6, 0x2026)
+DOUBLE_BYTE_PAIR(0xA1A7, 0x00A8)
+DOUBLE_BYTE_PAIR(0xA1A8, 0x3003)
+DOUBLE_BYTE_PAIR(0xA1A9, 0x00AD)
+DOUBLE_BYTE_PAIR(0xA1AA, 0x2015)
+DOUBLE_BYTE_PAIR(0xA1AB, 0x2225)
+DOUBLE_BYTE_PAIR(0xA1AC, 0xFF3C)
+DOUBLE_BYTE_PAIR(0xA1AD, 0x223C)
+DOUBLE_BYTE_PAIR(0xA1AE, 0x2018)
+DOUBLE_BYTE_PAIR(0xA1AF, 0x2019)
+DOUBLE_BYTE_PAIR(0xA1B0, 0x201C)
+DOUBLE_BYTE_PAIR(0xA1B1, 0x201D)
+DOUBLE_BYTE_PAIR(0xA1B2, 0x3014)
+DOUBLE_BYTE_PAIR(0xA1B3, 0x3015)
+DOUBLE_BYTE_PAIR(0xA1B4, 0x3008)
+DOUBLE_BYTE_PAIR(0xA1B5, 0x3009)
+DOUBLE_BYTE_PAIR(0xA1B6, 0x300A)
+DOUBLE_BYTE_PAIR(0xA1B7, 0x300B)
+DOUBLE_BYTE_PAIR(0xA1B8, 0x300C)
+DOUBLE_BYTE_PAIR(0xA1B9, 0x300D)
+DOUBLE_BYTE_PAIR(0xA1BA, 0x300E)
+DOUBLE_BYTE_PAIR(0xA1BB, 0x300F)
+DOUBLE_BYTE_PAIR(0xA1BC, 0x3010)
+DOUBLE_BYTE_PAIR(0xA1BD, 0x3011)
+DOUBLE_BYTE_PAIR(0xA1BE, 0x00B1)
+DOUBLE_BYTE_PAIR(0xA1BF, 0x00D7)
+DOUBLE_BYTE_PAIR(0xA1C0, 0x00F7)
+DOUBLE_BYTE_PAIR(0xA1C1, 0x2260)
+DOUBLE_BYTE_PAIR(0xA1C2, 0x2264)
+DOUBLE_BYTE_PAIR(0xA1C3, 0x2265)
+DOUBLE_BYTE_PAIR(0xA1C4, 0x221E)
+DOUBLE_BYTE_PAIR(0xA1C5, 0x2234)
+DOUBLE_BYTE_PAIR(0xA1C6, 0x00B0)
+DOUBLE_BYTE_PAIR(0xA1C7, 0x2032)
+DOUBLE_BYTE_PAIR(0xA1C8, 0x2033)
+DOUBLE_BYTE_PAIR(0xA1C9, 0x2103)
+DOUBLE_BYTE_PAIR(0xA1CA, 0x212B)
+DOUBLE_BYTE_PAIR(0xA1CB, 0xFFE0)
+DOUBLE_BYTE_PAIR(0xA1CC, 0xFFE1)
+DOUBLE_BYTE_PAIR(0xA1CD, 0xFFE5)
+DOUBLE_BYTE_PAIR(0xA1CE, 0x2642)
+DOUBLE_BYTE_PAIR(0xA1CF, 0x2640)
+DOUBLE_BYTE_PAIR(0xA1D0, 0x2220)
+DOUBLE_BYTE_PAIR(0xA1D1, 0x22A5)
+DOUBLE_BYTE_PAIR(0xA1D2, 0x2312)
+DOUBLE_BYTE_PAIR(0xA1D3, 0x2202)
+DOUBLE_BYTE_PAIR(0xA1D4, 0x2207)
+DOUBLE_BYTE_PAIR(0xA1D5, 0x2261)
+DOUBLE_BYTE_PAIR(0xA1D6, 0x2252)
+DOUBLE_BYTE_PAIR(0xA1D7, 0x00A7)
+DOUBLE_BYTE_PAIR(0xA1D8, 0x203B)
+DOUBLE_BYTE_PAIR(0xA1D9, 0x2606)
+DOUBLE_BYTE_PAIR(0xA1DA, 0x2605)
+DOUBLE_BYTE_PAIR(0xA1DB, 0x25CB)
+DOUBLE_BYTE_PAIR(0xA1DC, 0x25CF)
+DOUBLE_BYTE_PAIR(0xA1DD, 0x25CE)
+DOUBLE_BYTE_PAIR(0xA1DE, 0x25C7)
+DOUBLE_BYTE_PAIR(0xA1DF, 0x25C6)
+DOUBLE_BYTE_PAIR(0xA1E0, 0x25A1)
+DOUBLE_BYTE_PAIR(0xA1E1, 0x25A0)
+DOUBLE_BYTE_PAIR(0xA1E2, 0x25B3)
+DOUBLE_BYTE_PAIR(0xA1E3, 0x25B2)
+DOUBLE_BYTE_PAIR(0xA1E4, 0x25BD)
+DOUBLE_BYTE_PAIR(0xA1E5, 0x25BC)
+DOUBLE_BYTE_PAIR(0xA1E6, 0x2192)
+DOUBLE_BYTE_PAIR(0xA1E7, 0x2190)
+DOUBLE_BYTE_PAIR(0xA1E8, 0x2191)
+DOUBLE_BYTE_PAIR(0xA1E9, 0x2193)
+DOUBLE_BYTE_PAIR(0xA1EA, 0x2194)
+DOUBLE_BYTE_PAIR(0xA1EB, 0x3013)
+DOUBLE_BYTE_PAIR(0xA1EC, 0x226A)
+DOUBLE_BYTE_PAIR(0xA1ED, 0x226B)
+DOUBLE_BYTE_PAIR(0xA1EE, 0x221A)
+DOUBLE_BYTE_PAIR(0xA1EF, 0x223D)
+DOUBLE_BYTE_PAIR(0xA1F0, 0x221D)
+DOUBLE_BYTE_PAIR(0xA1F1, 0x2235)
+DOUBLE_BYTE_PAIR(0xA1F2, 0x222B)
+DOUBLE_BYTE_PAIR(0xA1F3, 0x222C)
+DOUBLE_BYTE_PAIR(0xA1F4, 0x2208)
+DOUBLE_BYTE_PAIR(0xA1F5, 0x220B)
+DOUBLE_BYTE_PAIR(0xA1F6, 0x2286)
+DOUBLE_BYTE_PAIR(0xA1F7, 0x2287)
+DOUBLE_BYTE_PAIR(0xA1F8, 0x2282)
+DOUBLE_BYTE_PAIR(0xA1F9, 0x2283)
+DOUBLE_BYTE_PAIR(0xA1FA, 0x222A)
+DOUBLE_BYTE_PAIR(0xA1FB, 0x2229)
+DOUBLE_BYTE_PAIR(0xA1FC, 0x2227)
+DOUBLE_BYTE_PAIR(0xA1FD, 0x2228)
+DOUBLE_BYTE_PAIR(0xA1FE, 0xFFE2)
+DOUBLE_BYTE_PAIR(0xA241, 0xC910)
+DOUBLE_BYTE_PAIR(0xA242, 0xC912)
+DOUBLE_BYTE_PAIR(0xA243, 0xC913)
+DOUBLE_BYTE_PAIR(0xA244, 0xC914)
+DOUBLE_BYTE_PAIR(0xA245, 0xC915)
+DOUBLE_BYTE_PAIR(0xA246, 0xC916)
+DOUBLE_BYTE_PAIR(0xA247, 0xC917)
+DOUBLE_BYTE_PAIR(0xA248, 0xC919)
+DOUBLE_BYTE_PAIR(0xA249, 0xC91A)
+DOUBLE_BYTE_PAIR(0xA24A, 0xC91B)
+DOUBLE_BYTE_PAIR(0xA24B, 0xC91C)
+DOUBLE_BYTE_PAIR(0xA24C, 0xC91D)
+DOUBLE_BYTE_PAIR(0xA24D, 0xC91E)
+DOUBLE_BYTE_PAIR(0xA24E, 0xC91F)
+DOUBLE_BYTE_PAIR(0xA24F, 0xC920)
+DOUBLE_BYTE_PAIR(0xA250, 0xC921)
+DOUBLE_BYTE_PAIR(0xA251, 0xC922)
+DOUBLE_BYTE_PAIR(0xA252, 0xC923)
+DOUBLE_BYTE_PAIR(0xA253, 0xC924)
+DOUBLE_BYTE_PAIR(0xA254, 0xC925)
+DOUBLE_BYTE_PAIR(0xA255, 0xC926)
+DOUBLE_BYTE_PAIR(0xA256, 0xC927)
+DOUBLE_BYTE_PAIR(0xA257, 0xC928)
+DOUBLE_BYTE_PAIR(0xA258, 0xC929)
+DOUBLE_BYTE_PAIR(0xA259, 0xC92A)
+DOUBLE_BYTE_PAIR(0xA25A, 0xC92B)
+DOUBLE_BYTE_PAIR(0xA261, 0xC92D)
+DOUBLE_BYTE_PAIR(0xA262, 0xC92E)
+DOUBLE_BYTE_PAIR(0xA263, 0xC92F)
+DOUBLE_BYTE_PAIR(0xA264, 0xC930)
+DOUBLE_BYTE_PAIR(0xA265, 0xC931)
+DOUBLE_BYTE_PAIR(0xA266, 0xC932)
+DOUBLE_BYTE_PAIR(0xA267, 0xC933)
+DOUBLE_BYTE_PAIR(0xA268, 0xC935)
+DOUBLE_BYTE_PAIR(0xA269, 0xC936)
+DOUBLE_BYTE_PAIR(0xA26A, 0xC937)
+DOUBLE_BYTE_PAIR(0xA26B, 0xC938)
+DOUBLE_BYTE_PAIR(0xA26C, 0xC939)
+DOUBLE_BYTE_PAIR(0xA26D, 0xC93A)
+DOUBLE_BYTE_PAIR(0xA26E, 0xC93B)
+DOUBLE_BYTE_PAIR(0xA26F, 0xC93C)
+DOUBLE_BYTE_PAIR(0xA270, 0xC93D)
+DOUBLE_BYTE_PAIR(0xA271, 0xC93E)
+DOUBLE_BYTE_PAIR(0xA272, 0xC93F)
+DOUBLE_BYTE_PAIR(0xA273, 0xC940)
+DOUBLE_BYTE_PAIR(0xA274, 0xC941)
+DOUBLE_BYTE_PAIR(0xA275, 0xC942)
+DOUBLE_BYTE_PAIR(0xA276, 0xC943)
+DOUBLE_BYTE_PAIR(0xA277, 0xC944)
+DOUBLE_BYTE_PAIR(0xA278, 0xC945)
+DOUBLE_BYTE_PAIR(0xA279, 0xC946)
+DOUBLE_BYTE_PAIR(0xA27A, 0xC947)
+DOUBLE_BYTE_PAIR(0xA281, 0xC948)
+DOUBLE_BYTE_PAIR(0xA282, 0xC949)
+DOUBLE_BYTE_PAIR(0xA283, 0xC94A)
+DOUBLE_BYTE_PAIR(0xA284, 0xC94B)
+DOUBLE_BYTE_PAIR(0xA285, 0xC94C)
+DOUBLE_BYTE_PAIR(0xA286, 0xC94D)
+DOUBLE_BYTE_PAIR(0xA287, 0xC94E)
+DOUBLE_BYTE_PAIR(0xA288, 0xC94F)
+DOUBLE_BYTE_PAIR(0xA289, 0xC952)
+DOUBLE_BYTE_PAIR(0xA28A, 0xC953)
+DOUBLE_BYTE_PAIR(0xA28B, 0xC955)
+DOUBLE_BYTE_PAIR(0xA28C, 0xC956)
+DOUBLE_BYTE_PAIR(0xA28D, 0xC957)
+DOUBLE_BYTE_PAIR(0xA28E, 0xC959)
+DOUBLE_BYTE_PAIR(0xA28F, 0xC95A)
+DOUBLE_BYTE_PAIR(0xA290, 0xC95B)
+DOUBLE_BYTE_PAIR(0xA291, 0xC95C)
+DOUBLE_BYTE_PAIR(0xA292, 0xC95D)
+DOUBLE_BYTE_PAIR(0xA293, 0xC95E)
+DOUBLE_BYTE_PAIR(0xA294, 0xC95F)
+DOUBLE_BYTE_PAIR(0xA295, 0xC962)
+DOUBLE_BYTE_PAIR(0xA296, 0xC964)
+DOUBLE_BYTE_PAIR(0xA297, 0xC965)
+DOUBLE_BYTE_PAIR(0xA298, 0xC966)
+DOUBLE_BYTE_PAIR(0xA299, 0xC967)
+DOUBLE_BYTE_PAIR(0xA29A, 0xC968)
+DOUBLE_BYTE_PAIR(0xA29B, 0xC969)
+DOUBLE_BYTE_PAIR(0xA29C, 0xC96A)
+DOUBLE_BYTE_PAIR(0xA29D, 0xC96B)
+DOUBLE_BYTE_PAIR(0xA29E, 0xC96D)
+DOUBLE_BYTE_PAIR(0xA29F, 0xC96E)
+DOUBLE_BYTE_PAIR(0xA2A0, 0xC96F)
+DOUBLE_BYTE_PAIR(0xA2A1, 0x21D2)
+DOUBLE_BYTE_PAIR(0xA2A2, 0x21D4)
+DOUBLE_BYTE_PAIR(0xA2A3, 0x2200)
+DOUBLE_BYTE_PAIR(0xA2A4, 0x2203)
+DOUBLE_BYTE_PAIR(0xA2A5, 0x00B4)
+DOUBLE_BYTE_PAIR(0xA2A6, 0xFF5E)
+DOUBLE_BYTE_PAIR(0xA2A7, 0x02C7)
+DOUBLE_BYTE_PAIR(0xA2A8, 0x02D8)
+DOUBLE_BYTE_PAIR(0xA2A9, 0x02DD)
+DOUBLE_BYTE_PAIR(0xA2AA, 0x02DA)
+DOUBLE_BYTE_PAIR(0xA2AB, 0x02D9)
+DOUBLE_BYTE_PAIR(0xA2AC, 0x00B8)
+DOUBLE_BYTE_PAIR(0xA2AD, 0x02DB)
+DOUBLE_BYTE_PAIR(0xA2AE, 0x00A1)
+DOUBLE_BYTE_PAIR(0xA2AF, 0x00BF)
+DOUBLE_BYTE_PAIR(0xA2B0, 0x02D0)
+DOUBLE_BYTE_PAIR(0xA2B1, 0x222E)
+DOUBLE_BYTE_PAIR(0xA2B2, 0x2211)
+DOUBLE_BYTE_PAIR(0xA2B3, 0x220F)
+DOUBLE_BYTE_PAIR(0xA2B4, 0x00A4)
+DOUBLE_BYTE_PAIR(0xA2B5, 0x2109)
+DOUBLE_BYTE_PAIR(0xA2B6, 0x2030)
+DOUBLE_BYTE_PAIR(0xA2B7, 0x25C1)
+DOUBLE_BYTE_PAIR(0xA2B8, 0x25C0)
+DOUBLE_BYTE_PAIR(0xA2B9, 0x25B7)
+DOUBLE_BYTE_PAIR(0xA2BA, 0x25B6)
+DOUBLE_BYTE_PAIR(0xA2BB, 0x2664)
+DOUBLE_BYTE_PAIR(0xA2BC, 0x2660)
+DOUBLE_BYTE_PAIR(0xA2BD, 0x2661)
+DOUBLE_BYTE_PAIR(0xA2BE, 0x2665)
+DOUBLE_BYTE_PAIR(0xA2BF, 0x2667)
+DOUBLE_BYTE_PAIR(0xA2C0, 0x2663)
+DOUBLE_BYTE_PAIR(0xA2C1, 0x2299)
+DOUBLE_BYTE_PAIR(0xA2C2, 0x25C8)
+DOUBLE_BYTE_PAIR(0xA2C3, 0x25A3)
+DOUBLE_BYTE_PAIR(0xA2C4, 0x25D0)
+DOUBLE_BYTE_PAIR(0xA2C5, 0x25D1)
+DOUBLE_BYTE_PAIR(0xA2C6, 0x2592)
+DOUBLE_BYTE_PAIR(0xA2C7, 0x25A4)
+DOUBLE_BYTE_PAIR(0xA2C8, 0x25A5)
+DOUBLE_BYTE_PAIR(0xA2C9, 0x25A8)
+DOUBLE_BYTE_PAIR(0xA2CA, 0x25A7)
+DOUBLE_BYTE_PAIR(0xA2CB, 0x25A6)
+DOUBLE_BYTE_PAIR(0xA2CC, 0x25A9)
+DOUBLE_BYTE_PAIR(0xA2CD, 0x2668)
+DOUBLE_BYTE_PAIR(0xA2CE, 0x260F)
+DOUBLE_BYTE_PAIR(0xA2CF, 0x260E)
+DOUBLE_BYTE_PAIR(0xA2D0, 0x261C)
+DOUBLE_BYTE_PAIR(0xA2D1, 0x261E)
+DOUBLE_BYTE_PAIR(0xA2D2, 0x00B6)
+DOUBLE_BYTE_PAIR(0xA2D3, 0x2020)
+DOUBLE_BYTE_PAIR(0xA2D4, 0x2021)
+DOUBLE_BYTE_PAIR(0xA2D5, 0x2195)
+DOUBLE_BYTE_PAIR(0xA2D6, 0x2197)
+DOUBLE_BYTE_PAIR(0xA2D7, 0x2199)
+DOUBLE_BYTE_PAIR(0xA2D8, 0x2196)
+DOUBLE_BYTE_PAIR(0xA2D9, 0x2198)
+DOUBLE_BYTE_PAIR(0xA2DA, 0x266D)
+DOUBLE_BYTE_PAIR(0xA2DB, 0x2669)
+DOUBLE_BYTE_PAIR(0xA2DC, 0x266A)
+DOUBLE_BYTE_PAIR(0xA2DD, 0x266C)
+DOUBLE_BYTE_PAIR(0xA2DE, 0x327F)
+DOUBLE_BYTE_PAIR(0xA2DF, 0x321C)
+DOUBLE_BYTE_PAIR(0xA2E0, 0x2116)
+DOUBLE_BYTE_PAIR(0xA2E1, 0x33C7)
+DOUBLE_BYTE_PAIR(0xA2E2, 0x2122)
+DOUBLE_BYTE_PAIR(0xA2E3, 0x33C2)
+DOUBLE_BYTE_PAIR(0xA2E4, 0x33D8)
+DOUBLE_BYTE_PAIR(0xA2E5, 0x2121)
+DOUBLE_BYTE_PAIR(0xA2E6, 0x20AC)
+DOUBLE_BYTE_PAIR(0xA2E7, 0x00AE)
+DOUBLE_BYTE_PAIR(0xA341, 0xC971)
+DOUBLE_BYTE_PAIR(0xA342, 0xC972)
+DOUBLE_BYTE_PAIR(0xA343, 0xC973)
+DOUBLE_BYTE_PAIR(0xA344, 0xC975)
+DOUBLE_BYTE_PAIR(0xA345, 0xC976)
+DOUBLE_BYTE_PAIR(0xA346, 0xC977)
+DOUBLE_BYTE_PAIR(0xA347, 0xC978)
+DOUBLE_BYTE_PAIR(0xA348, 0xC979)
+DOUBLE_BYTE_PAIR(0xA349, 0xC97A)
+DOUBLE_BYTE_PAIR(0xA34A, 0xC97B)
+DOUBLE_BYTE_PAIR(0xA34B, 0xC97D)
+DOUBLE_BYTE_PAIR(0xA34C, 0xC97E)
+DOUBLE_BYTE_PAIR(0xA34D, 0xC97F)
+DOUBLE_BYTE_PAIR(0xA34E, 0xC980)
+DOUBLE_BYTE_PAIR(0xA34F, 0xC981)
+DOUBLE_BYTE_PAIR(0xA350, 0xC982)
+DOUBLE_BYTE_PAIR(0xA351, 0xC983)
+DOUBLE_BYTE_PAIR(0xA352, 0xC984)
+DOUBLE_BYTE_PAIR(0xA353, 0xC985)
+DOUBLE_BYTE_PAIR(0xA354, 0xC986)
+DOUBLE_BYTE_PAIR(0xA355, 0xC987)
+DOUBLE_BYTE_PAIR(0xA356, 0xC98A)
+DOUBLE_BYTE_PAIR(0xA357, 0xC98B)
+DOUBLE_BYTE_PAIR(0xA358, 0xC98D)
+DOUBLE_BYTE_PAIR(0xA359, 0xC98E)
+DOUBLE_BYTE_PAIR(0xA35A, 0xC98F)
+DOUBLE_BYTE_PAIR(0xA361, 0xC991)
+DOUBLE_BYTE_PAIR(0xA362, 0xC992)
+DOUBLE_BYTE_PAIR(0xA363, 0xC993)
+DOUBLE_BYTE_PAIR(0xA364, 0xC994)
+DOUBLE_BYTE_PAIR(0xA365, 0xC995)
+DOUBLE_BYTE_PAIR(0xA366, 0xC996)
+DOUBLE_BYTE_PAIR(0xA367, 0xC997)
+DOUBLE_BYTE_PAIR(0xA368, 0xC99A)
+DOUBLE_BYTE_PAIR(0xA369, 0xC99C)
+DOUBLE_BYTE_PAIR(0xA36A, 0xC99E)
+DOUBLE_BYTE_PAIR(0xA36B, 0xC99F)
+DOUBLE_BYTE_PAIR(0xA36C, 0xC9A0)
+DOUBLE_BYTE_PAIR(0xA36D, 0xC9A1)
+DOUBLE_BYTE_PAIR(0xA36E, 0xC9A2)
+DOUBLE_BYTE_PAIR(0xA36F, 0xC9A3)
+DOUBLE_BYTE_PAIR(0xA370, 0xC9A4)
+DOUBLE_BYTE_PAIR(0xA371, 0xC9A5)
+DOUBLE_BYTE_PAIR(0xA372, 0xC9A6)
+DOUBLE_BYTE_PAIR(0xA373, 0xC9A7)
+DOUBLE_BYTE_PAIR(0xA374, 0xC9A8)
+DOUBLE_BYTE_PAIR(0xA375, 0xC9A9)
+DOUBLE_BYTE_PAIR(0xA376, 0xC9AA)
+DOUBLE_BYTE_PAIR(0xA377, 0xC9AB)
+DOUBLE_BYTE_PAIR(0xA378, 0xC9AC)
+DOUBLE_BYTE_PAIR(0xA379, 0xC9AD)
+DOUBLE_BYTE_PAIR(0xA37A, 0xC9AE)
+DOUBLE_BYTE_PAIR(0xA381, 0xC9AF)
+DOUBLE_BYTE_PAIR(0xA382, 0xC9B0)
+DOUBLE_BYTE_PAIR(0xA383, 0xC9B1)
+DOUBLE_BYTE_PAIR(0xA384, 0xC9B2)
+DOUBLE_BYTE_PAIR(0xA385, 0xC9B3)
+DOUBLE_BYTE_PAIR(0xA386, 0xC9B4)
+DOUBLE_BYTE_PAIR(0xA387, 0xC9B5)
+DOUBLE_BYTE_PAIR(0xA388, 0xC9B6)
+DOUBLE_BYTE_PAIR(0xA389, 0xC9B7)
+DOUBLE_BYTE_PAIR(0xA38A, 0xC9B8)
+DOUBLE_BYTE_PAIR(0xA38B, 0xC9B9)
+DOUBLE_BYTE_PAIR(0xA38C, 0xC9BA)
+DOUBLE_BYTE_PAIR(0xA38D, 0xC9BB)
+DOUBLE_BYTE_PAIR(0xA38E, 0xC9BC)
+DOUBLE_BYTE_PAIR(0xA38F, 0xC9BD)
+DOUBLE_BYTE_PAIR(0xA390, 0xC9BE)
+DOUBLE_BYTE_PAIR(0xA391, 0xC9BF)
+DOUBLE_BYTE_PAIR(0xA392, 0xC9C2)
+DOUBLE_BYTE_PAIR(0xA393, 0xC9C3)
+DOUBLE_BYTE_PAIR(0xA394, 0xC9C5)
+DOUBLE_BYTE_PAIR(0xA395, 0xC9C6)
+DOUBLE_BYTE_PAIR(0xA396, 0xC9C9)
+DOUBLE_BYTE_PAIR(0xA397, 0xC9CB)
+DOUBLE_BYTE_PAIR(0xA398, 0xC9CC)
+DOUBLE_BYTE_PAIR(0xA399, 0xC9CD)
+DOUBLE_BYTE_PAIR(0xA39A, 0xC9CE)
+DOUBLE_BYTE_PAIR(0xA39B, 0xC9CF)
+DOUBLE_BYTE_PAIR(0xA39C, 0xC9D2)
+DOUBLE_BYTE_PAIR(0xA39D, 0xC9D4)
+DOUBLE_BYTE_PAIR(0xA39E, 0xC9D7)
+DOUBLE_BYTE_PAIR(0xA39F, 0xC9D8)
+DOUBLE_BYTE_PAIR(0xA3A0, 0xC9DB)
+DOUBLE_BYTE_PAIR(0xA3A1, 0xFF01)
+DOUBLE_BYTE_PAIR(0xA3A2, 0xFF02)
+DOUBLE_BYTE_PAIR(0xA3A3, 0xFF03)
+DOUBLE_BYTE_PAIR(0xA3A4, 0xFF04)
+DOUBLE_BYTE_PAIR(0xA3A5, 0xFF05)
+DOUBLE_BYTE_PAIR(0xA3A6, 0xFF06)
+DOUBLE_BYTE_PAIR(0xA3A7, 0xFF07)
+DOUBLE_BYTE_PAIR(0xA3A8, 0xFF08)
+DOUBLE_BYTE_PAIR(0xA3A9, 0xFF09)
+DOUBLE_BYTE_PAIR(0xA3AA, 0xFF0A)
+DOUBLE_BYTE_PAIR(0xA3AB, 0xFF0B)
+DOUBLE_BYTE_PAIR(0xA3AC, 0xFF0C)
+DOUBLE_BYTE_PAIR(0xA3AD, 0xFF0D)
+DOUBLE_BYTE_PAIR(0xA3AE, 0xFF0E)
+DOUBLE_BYTE_PAIR(0xA3AF, 0xFF0F)
+DOUBLE_BYTE_PAIR(0xA3B0, 0xFF10)
+DOUBLE_BYTE_PAIR(0xA3B1, 0xFF11)
+DOUBLE_BYTE_PAIR(0xA3B2, 0xFF12)
+DOUBLE_BYTE_PAIR(0xA3B3, 0xFF13)
+DOUBLE_BYTE_PAIR(0xA3B4, 0xFF14)
+DOUBLE_BYTE_PAIR(0xA3B5, 0xFF15)
+DOUBLE_BYTE_PAIR(0xA3B6, 0xFF16)
+DOUBLE_BYTE_PAIR(0xA3B7, 0xFF17)
+DOUBLE_BYTE_PAIR(0xA3B8, 0xFF18)
+DOUBLE_BYTE_PAIR(0xA3B9, 0xFF19)
+DOUBLE_BYTE_PAIR(0xA3BA, 0xFF1A)
+DOUBLE_BYTE_PAIR(0xA3BB, 0xFF1B)
+DOUBLE_BYTE_PAIR(0xA3BC, 0xFF1C)
+DOUBLE_BYTE_PAIR(0xA3BD, 0xFF1D)
+DOUBLE_BYTE_PAIR(0xA3BE, 0xFF1E)
+DOUBLE_BYTE_PAIR(0xA3BF, 0xFF1F)
+DOUBLE_BYTE_PAIR(0xA3C0, 0xFF20)
+DOUBLE_BYTE_PAIR(0xA3C1, 0xFF21)
+DOUBLE_BYTE_PAIR(0xA3C2, 0xFF22)
+DOUBLE_BYTE_PAIR(0xA3C3, 0xFF23)
+DOUBLE_BYTE_PAIR(0xA3C4, 0xFF24)
+DOUBLE_BYTE_PAIR(0xA3C5, 0xFF25)
+DOUBLE_BYTE_PAIR(0xA3C6, 0xFF26)
+DOUBLE_BYTE_PAIR(0xA3C7, 0xFF27)
+DOUBLE_BYTE_PAIR(0xA3C8, 0xFF28)
+DOUBLE_BYTE_PAIR(0xA3C9, 0xFF29)
+DOUBLE_BYTE_PAIR(0xA3CA, 0xFF2A)
+DOUBLE_BYTE_PAIR(0xA3CB, 0xFF2B)
+DOUBLE_BYTE_PAIR(0xA3CC, 0xFF2C)
+DOUBLE_BYTE_PAIR(0xA3CD, 0xFF2D)
+DOUBLE_BYTE_PAIR(0xA3CE, 0xFF2E)
+DOUBLE_BYTE_PAIR(0xA3CF, 0xFF2F)
+DOUBLE_BYTE_PAIR(0xA3D0, 0xFF30)
+DOUBLE_BYTE_PAIR(0xA3D1, 0xFF31)
+DOUBLE_BYTE_PAIR(0xA3D2, 0xFF32)
+DOUBLE_BYTE_PAIR(0xA3D3, 0xFF33)
+DOUBLE_BYTE_PAIR(0xA3D4, 0xFF34)
+DOUBLE_BYTE_PAIR(0xA3D5, 0xFF35)
+DOUBLE_BYTE_PAIR(0xA3D6, 0xFF36)
+DOUBLE_BYTE_PAIR(0xA3D7, 0xFF37)
+DOUBLE_BYTE_PAIR(0xA3D8, 0xFF38)
+DOUBLE_BYTE_PAIR(0xA3D9, 0xFF39)
+DOUBLE_BYTE_PAIR(0xA3DA, 0xFF3A)
+DOUBLE_BYTE_PAIR(0xA3DB, 0xFF3B)
+DOUBLE_BYTE_PAIR(0xA3DC, 0xFFE6)
+DOUBLE_BYTE_PAIR(0xA3DD, 0xFF3D)
+DOUBLE_BYTE_PAIR(0xA3DE, 0xFF3E)
+DOUBLE_BYTE_PAIR(0xA3DF, 0xFF3F)
+DOUBLE_BYTE_PAIR(0xA3E0, 0xFF40)
+DOUBLE_BYTE_PAIR(0xA3E1, 0xFF41)
+DOUBLE_BYTE_PAIR(0xA3E2, 0xFF42)
+DOUBLE_BYTE_PAIR(0xA3E3, 0xFF43)
+DOUBLE_BYTE_PAIR(0xA3E4, 0xFF44)
+DOUBLE_BYTE_PAIR(0xA3E5, 0xFF45)
+DOUBLE_BYTE_PAIR(0xA3E6, 0xFF46)
+DOUBLE_BYTE_PAIR(0xA3E7, 0xFF47)
+DOUBLE_BYTE_PAIR(0xA3E8, 0xFF48)
+DOUBLE_BYTE_PAIR(0xA3E9, 0xFF49)
+DOUBLE_BYTE_PAIR(0xA3EA, 0xFF4A)
+DOUBLE_BYTE_PAIR(0xA3EB, 0xFF4B)
+DOUBLE_BYTE_PAIR(0xA3EC, 0xFF4C)
+DOUBLE_BYTE_PAIR(0xA3ED, 0xFF4D)
+DOUBLE_BYTE_PAIR(0xA3EE, 0xFF4E)
+DOUBLE_BYTE_PAIR(0xA3EF, 0xFF4F)
+DOUBLE_BYTE_PAIR(0xA3F0, 0xFF50)
+DOUBLE_BYTE_PAIR(0xA3F1, 0xFF51)
+DOUBLE_BYTE_PAIR(0xA3F2, 0xFF52)
+DOUBLE_BYTE_PAIR(0xA3F3, 0xFF53)
+DOUBLE_BYTE_PAIR(0xA3F4, 0xFF54)
+DOUBLE_BYTE_PAIR(0xA3F5, 0xFF55)
+DOUBLE_BYTE_PAIR(0xA3F6, 0xFF56)
+DOUBLE_BYTE_PAIR(0xA3F7, 0xFF57)
+DOUBLE_BYTE_PAIR(0xA3F8, 0xFF58)
+DOUBLE_BYTE_PAIR(0xA3F9, 0xFF59)
+DOUBLE_BYTE_PAIR(0xA3FA, 0xFF5A)
+DOUBLE_BYTE_PAIR(0xA3FB, 0xFF5B)
+DOUBLE_BYTE_PAIR(0xA3FC, 0xFF5C)
+DOUBLE_BYTE_PAIR(0xA3FD, 0xFF5D)
+DOUBLE_BYTE_PAIR(0xA3FE, 0xFFE3)
+DOUBLE_BYTE_PAIR(0xA441, 0xC9DE)
+DOUBLE_BYTE_PAIR(0xA442, 0xC9DF)
+DOUBLE_BYTE_PAIR(0xA443, 0xC9E1)
+DOUBLE_BYTE_PAIR(0xA444, 0xC9E3)
+DOUBLE_BYTE_PAIR(0xA445, 0xC9E5)
+DOUBLE_BYTE_PAIR(0xA446, 0xC9E6)
+DOUBLE_BYTE_PAIR(0xA447, 0xC9E8)
+DOUBLE_BYTE_PAIR(0xA448, 0xC9E9)
+DOUBLE_BYTE_PAIR(0xA449, 0xC9EA)
+DOUBLE_BYTE_PAIR(0xA44A, 0xC9EB)
+DOUBLE_BYTE_PAIR(0xA44B, 0xC9EE)
+DOUBLE_BYTE_PAIR(0xA44C, 0xC9F2)
+DOUBLE_BYTE_PAIR(0xA44D, 0xC9F3)
+DOUBLE_BYTE_PAIR(0xA44E, 0xC9F4)
+DOUBLE_BYTE_PAIR(0xA44F, 0xC9F5)
+DOUBLE_BYTE_PAIR(0xA450, 0xC9F6)
+DOUBLE_BYTE_PAIR(0xA451, 0xC9F7)
+DOUBLE_BYTE_PAIR(0xA452, 0xC9FA)
+DOUBLE_BYTE_PAIR(0xA453, 0xC9FB)
+DOUBLE_BYTE_PAIR(0xA454, 0xC9FD)
+DOUBLE_BYTE_PAIR(0xA455, 0xC9FE)
+DOUBLE_BYTE_PAIR(0xA456, 0xC9FF)
+DOUBLE_BYTE_PAIR(0xA457, 0xCA01)
+DOUBLE_BYTE_PAIR(0xA458, 0xCA02)
+DOUBLE_BYTE_PAIR(0xA459, 0xCA03)
+DOUBLE_BYTE_PAIR(0xA45A, 0xCA04)
+DOUBLE_BYTE_PAIR(0xA461, 0xCA05)
+DOUBLE_BYTE_PAIR(0xA462, 0xCA06)
+DOUBLE_BYTE_PAIR(0xA463, 0xCA07)
+DOUBLE_BYTE_PAIR(0xA464, 0xCA0A)
+DOUBLE_BYTE_PAIR(0xA465, 0xCA0E)
+DOUBLE_BYTE_PAIR(0xA466, 0xCA0F)
+DOUBLE_BYTE_PAIR(0xA467, 0xCA10)
+DOUBLE_BYTE_PAIR(0xA468, 0xCA11)
+DOUBLE_BYTE_PAIR(0xA469, 0xCA12)
+DOUBLE_BYTE_PAIR(0xA46A, 0xCA13)
+DOUBLE_BYTE_PAIR(0xA46B, 0xCA15)
+DOUBLE_BYTE_PAIR(0xA46C, 0xCA16)
+DOUBLE_BYTE_PAIR(0xA46D, 0xCA17)
+DOUBLE_BYTE_PAIR(0xA46E, 0xCA19)
+DOUBLE_BYTE_PAIR(0xA46F, 0xCA1A)
+DOUBLE_BYTE_PAIR(0xA470, 0xCA1B)
+DOUBLE_BYTE_PAIR(0xA471, 0xCA1C)
+DOUBLE_BYTE_PAIR(0xA472, 0xCA1D)
+DOUBLE_BYTE_PAIR(0xA473, 0xCA1E)
+DOUBLE_BYTE_PAIR(0xA474, 0xCA1F)
+DOUBLE_BYTE_PAIR(0xA475, 0xCA20)
+DOUBLE_BYTE_PAIR(0xA476, 0xCA21)
+DOUBLE_BYTE_PAIR(0xA477, 0xCA22)
+DOUBLE_BYTE_PAIR(0xA478, 0xCA23)
+DOUBLE_BYTE_PAIR(0xA479, 0xCA24)
+DOUBLE_BYTE_PAIR(0xA47A, 0xCA25)
+DOUBLE_BYTE_PAIR(0xA481, 0xCA26)
+DOUBLE_BYTE_PAIR(0xA482, 0xCA27)
+DOUBLE_BYTE_PAIR(0xA483, 0xCA28)
+DOUBLE_BYTE_PAIR(0xA484, 0xCA2A)
+DOUBLE_BYTE_PAIR(0xA485, 0xCA2B)
+DOUBLE_BYTE_PAIR(0xA486, 0xCA2C)
+DOUBLE_BYTE_PAIR(0xA487, 0xCA2D)
+DOUBLE_BYTE_PAIR(0xA488, 0xCA2E)
+DOUBLE_BYTE_PAIR(0xA489, 0xCA2F)
+DOUBLE_BYTE_PAIR(0xA48A, 0xCA30)
+DOUBLE_BYTE_PAIR(0xA48B, 0xCA31)
+DOUBLE_BYTE_PAIR(0xA48C, 0xCA32)
+DOUBLE_BYTE_PAIR(0xA48D, 0xCA33)
+DOUBLE_BYTE_PAIR(0xA48E, 0xCA34)
+DOUBLE_BYTE_PAIR(0xA48F, 0xCA35)
+DOUBLE_BYTE_PAIR(0xA490, 0xCA36)
+DOUBLE_BYTE_PAIR(0xA491, 0xCA37)
+DOUBLE_BYTE_PAIR(0xA492, 0xCA38)
+DOUBLE_BYTE_PAIR(0xA493, 0xCA39)
+DOUBLE_BYTE_PAIR(0xA494, 0xCA3A)
+DOUBLE_BYTE_PAIR(0xA495, 0xCA3B)
+DOUBLE_BYTE_PAIR(0xA496, 0xCA3C)
+DOUBLE_BYTE_PAIR(0xA497, 0xCA3D)
+DOUBLE_BYTE_PAIR(0xA498, 0xCA3E)
+DOUBLE_BYTE_PAIR(0xA499, 0xCA3F)
+DOUBLE_BYTE_PAIR(0xA49A, 0xCA40)
+DOUBLE_BYTE_PAIR(0xA49B, 0xCA41)
+DOUBLE_BYTE_PAIR(0xA49C, 0xCA42)
+DOUBLE_BYTE_PAIR(0xA49D, 0xCA43)
+DOUBLE_BYTE_PAIR(0xA49E, 0xCA44)
+DOUBLE_BYTE_PAIR(0xA49F, 0xCA45)
+DOUBLE_BYTE_PAIR(0xA4A0, 0xCA46)
+DOUBLE_BYTE_PAIR(0xA4A1, 0x3131)
+DOUBLE_BYTE_PAIR(0xA4A2, 0x3132)
+DOUBLE_BYTE_PAIR(0xA4A3, 0x3133)
+DOUBLE_BYTE_PAIR(0xA4A4, 0x3134)
+DOUBLE_BYTE_PAIR(0xA4A5, 0x3135)
+DOUBLE_BYTE_PAIR(0xA4A6, 0x3136)
+DOUBLE_BYTE_PAIR(0xA4A7, 0x3137)
+DOUBLE_BYTE_PAIR(0xA4A8, 0x3138)
+DOUBLE_BYTE_PAIR(0xA4A9, 0x3139)
+DOUBLE_BYTE_PAIR(0xA4AA, 0x313A)
+DOUBLE_BYTE_PAIR(0xA4AB, 0x313B)
+DOUBLE_BYTE_PAIR(0xA4AC, 0x313C)
+DOUBLE_BYTE_PAIR(0xA4AD, 0x313D)
+DOUBLE_BYTE_PAIR(0xA4AE, 0x313E)
+DOUBLE_BYTE_PAIR(0xA4AF, 0x313F)
+DOUBLE_BYTE_PAIR(0xA4B0, 0x3140)
+DOUBLE_BYTE_PAIR(0xA4B1, 0x3141)
+DOUBLE_BYTE_PAIR(0xA4B2, 0x3142)
+DOUBLE_BYTE_PAIR(0xA4B3, 0x3143)
+DOUBLE_BYTE_PAIR(0xA4B4, 0x3144)
+DOUBLE_BYTE_PAIR(0xA4B5, 0x3145)
+DOUBLE_BYTE_PAIR(0xA4B6, 0x3146)
+DOUBLE_BYTE_PAIR(0xA4B7, 0x3147)
+DOUBLE_BYTE_PAIR(0xA4B8, 0x3148)
+DOUBLE_BYTE_PAIR(0xA4B9, 0x3149)
+DOUBLE_BYTE_PAIR(0xA4BA, 0x314A)
+DOUBLE_BYTE_PAIR(0xA4BB, 0x314B)
+DOUBLE_BYTE_PAIR(0xA4BC, 0x314C)
+DOUBLE_BYTE_PAIR(0xA4BD, 0x314D)
+DOUBLE_BYTE_PAIR(0xA4BE, 0x314E)
+DOUBLE_BYTE_PAIR(0xA4BF, 0x314F)
+DOUBLE_BYTE_PAIR(0xA4C0, 0x3150)
+DOUBLE_BYTE_PAIR(0xA4C1, 0x3151)
+DOUBLE_BYTE_PAIR(0xA4C2, 0x3152)
+DOUBLE_BYTE_PAIR(0xA4C3, 0x3153)
+DOUBLE_BYTE_PAIR(0xA4C4, 0x3154)
+DOUBLE_BYTE_PAIR(0xA4C5, 0x3155)
+DOUBLE_BYTE_PAIR(0xA4C6, 0x3156)
+DOUBLE_BYTE_PAIR(0xA4C7, 0x3157)
+DOUBLE_BYTE_PAIR(0xA4C8, 0x3158)
+DOUBLE_BYTE_PAIR(0xA4C9, 0x3159)
+DOUBLE_BYTE_PAIR(0xA4CA, 0x315A)
+DOUBLE_BYTE_PAIR(0xA4CB, 0x315B)
+DOUBLE_BYTE_PAIR(0xA4CC, 0x315C)
+DOUBLE_BYTE_PAIR(0xA4CD, 0x315D)
+DOUBLE_BYTE_PAIR(0xA4CE, 0x315E)
+DOUBLE_BYTE_PAIR(0xA4CF, 0x315F)
+DOUBLE_BYTE_PAIR(0xA4D0, 0x3160)
+DOUBLE_BYTE_PAIR(0xA4D1, 0x3161)
+DOUBLE_BYTE_PAIR(0xA4D2, 0x3162)
+DOUBLE_BYTE_PAIR(0xA4D3, 0x3163)
+DOUBLE_BYTE_PAIR(0xA4D4, 0x3164)
+DOUBLE_BYTE_PAIR(0xA4D5, 0x3165)
+DOUBLE_BYTE_PAIR(0xA4D6, 0x3166)
+DOUBLE_BYTE_PAIR(0xA4D7, 0x3167)
+DOUBLE_BYTE_PAIR(0xA4D8, 0x3168)
+DOUBLE_BYTE_PAIR(0xA4D9, 0x3169)
+DOUBLE_BYTE_PAIR(0xA4DA, 0x316A)
+DOUBLE_BYTE_PAIR(0xA4DB, 0x316B)
+DOUBLE_BYTE_PAIR(0xA4DC, 0x316C)
+DOUBLE_BYTE_PAIR(0xA4DD, 0x316D)
+DOUBLE_BYTE_PAIR(0xA4DE, 0x316E)
+DOUBLE_BYTE_PAIR(0xA4DF, 0x316F)
+DOUBLE_BYTE_PAIR(0xA4E0, 0x3170)
+DOUBLE_BYTE_PAIR(0xA4E1, 0x3171)
+DOUBLE_BYTE_PAIR(0xA4E2, 0x3172)
+DOUBLE_BYTE_PAIR(0xA4E3, 0x3173)
+DOUBLE_BYTE_PAIR(0xA4E4, 0x3174)
+DOUBLE_BYTE_PAIR(0xA4E5, 0x3175)
+DOUBLE_BYTE_PAIR(0xA4E6, 0x3176)
+DOUBLE_BYTE_PAIR(0xA4E7, 0x3177)
+DOUBLE_BYTE_PAIR(0xA4E8, 0x3178)
+DOUBLE_BYTE_PAIR(0xA4E9, 0x3179)
+DOUBLE_BYTE_PAIR(0xA4EA, 0x317A)
+DOUBLE_BYTE_PAIR(0xA4EB, 0x317B)
+DOUBLE_BYTE_PAIR(0xA4EC, 0x317C)
+DOUBLE_BYTE_PAIR(0xA4ED, 0x317D)
+DOUBLE_BYTE_PAIR(0xA4EE, 0x317E)
+DOUBLE_BYTE_PAIR(0xA4EF, 0x317F)
+DOUBLE_BYTE_PAIR(0xA4F0, 0x3180)
+DOUBLE_BYTE_PAIR(0xA4F1, 0x3181)
+DOUBLE_BYTE_PAIR(0xA4F2, 0x3182)
+DOUBLE_BYTE_PAIR(0xA4F3, 0x3183)
+DOUBLE_BYTE_PAIR(0xA4F4, 0x3184)
+DOUBLE_BYTE_PAIR(0xA4F5, 0x3185)
+DOUBLE_BYTE_PAIR(0xA4F6, 0x3186)
+DOUBLE_BYTE_PAIR(0xA4F7, 0x3187)
+DOUBLE_BYTE_PAIR(0xA4F8, 0x3188)
+DOUBLE_BYTE_PAIR(0xA4F9, 0x3189)
+DOUBLE_BYTE_PAIR(0xA4FA, 0x318A)
+DOUBLE_BYTE_PAIR(0xA4FB, 0x318B)
+DOUBLE_BYTE_PAIR(0xA4FC, 0x318C)
+DOUBLE_BYTE_PAIR(0xA4FD, 0x318D)
+DOUBLE_BYTE_PAIR(0xA4FE, 0x318E)
+DOUBLE_BYTE_PAIR(0xA541, 0xCA47)
+DOUBLE_BYTE_PAIR(0xA542, 0xCA48)
+DOUBLE_BYTE_PAIR(0xA543, 0xCA49)
+DOUBLE_BYTE_PAIR(0xA544, 0xCA4A)
+DOUBLE_BYTE_PAIR(0xA545, 0xCA4B)
+DOUBLE_BYTE_PAIR(0xA546, 0xCA4E)
+DOUBLE_BYTE_PAIR(0xA547, 0xCA4F)
+DOUBLE_BYTE_PAIR(0xA548, 0xCA51)
+DOUBLE_BYTE_PAIR(0xA549, 0xCA52)
+DOUBLE_BYTE_PAIR(0xA54A, 0xCA53)
+DOUBLE_BYTE_PAIR(0xA54B, 0xCA55)
+DOUBLE_BYTE_PAIR(0xA54C, 0xCA56)
+DOUBLE_BYTE_PAIR(0xA54D, 0xCA57)
+DOUBLE_BYTE_PAIR(0xA54E, 0xCA58)
+DOUBLE_BYTE_PAIR(0xA54F, 0xCA59)
+DOUBLE_BYTE_PAIR(0xA550, 0xCA5A)
+DOUBLE_BYTE_PAIR(0xA551, 0xCA5B)
+DOUBLE_BYTE_PAIR(0xA552, 0xCA5E)
+DOUBLE_BYTE_PAIR(0xA553, 0xCA62)
+DOUBLE_BYTE_PAIR(0xA554, 0xCA63)
+DOUBLE_BYTE_PAIR(0xA555, 0xCA64)
+DOUBLE_BYTE_PAIR(0xA556, 0xCA65)
+DOUBLE_BYTE_PAIR(0xA557, 0xCA66)
+DOUBLE_BYTE_PAIR(0xA558, 0xCA67)
+DOUBLE_BYTE_PAIR(0xA559, 0xCA69)
+DOUBLE_BYTE_PAIR(0xA55A, 0xCA6A)
+DOUBLE_BYTE_PAIR(0xA561, 0xCA6B)
+DOUBLE_BYTE_PAIR(0xA562, 0xCA6C)
+DOUBLE_BYTE_PAIR(0xA563, 0xCA6D)
+DOUBLE_BYTE_PAIR(0xA564, 0xCA6E)
+DOUBLE_BYTE_PAIR(0xA565, 0xCA6F)
+DOUBLE_BYTE_PAIR(0xA566, 0xCA70)
+DOUBLE_BYTE_PAIR(0xA567, 0xCA71)
+DOUBLE_BYTE_PAIR(0xA568, 0xCA72)
+DOUBLE_BYTE_PAIR(0xA569, 0xCA73)
+DOUBLE_BYTE_PAIR(0xA56A, 0xCA74)
+DOUBLE_BYTE_PAIR(0xA56B, 0xCA75)
+DOUBLE_BYTE_PAIR(0xA56C, 0xCA76)
+DOUBLE_BYTE_PAIR(0xA56D, 0xCA77)
+DOUBLE_BYTE_PAIR(0xA56E, 0xCA78)
+DOUBLE_BYTE_PAIR(0xA56F, 0xCA79)
+DOUBLE_BYTE_PAIR(0xA570, 0xCA7A)
+DOUBLE_BYTE_PAIR(0xA571, 0xCA7B)
+DOUBLE_BYTE_PAIR(0xA572, 0xCA7C)
+DOUBLE_BYTE_PAIR(0xA573, 0xCA7E)
+DOUBLE_BYTE_PAIR(0xA574, 0xCA7F)
+DOUBLE_BYTE_PAIR(0xA575, 0xCA80)
+DOUBLE_BYTE_PAIR(0xA576, 0xCA81)
+DOUBLE_BYTE_PAIR(0xA577, 0xCA82)
+DOUBLE_BYTE_PAIR(0xA578, 0xCA83)
+DOUBLE_BYTE_PAIR(0xA579, 0xCA85)
+DOUBLE_BYTE_PAIR(0xA57A, 0xCA86)
+DOUBLE_BYTE_PAIR(0xA581, 0xCA87)
+DOUBLE_BYTE_PAIR(0xA582, 0xCA88)
+DOUBLE_BYTE_PAIR(0xA583, 0xCA89)
+DOUBLE_BYTE_PAIR(0xA584, 0xCA8A)
+DOUBLE_BYTE_PAIR(0xA585, 0xCA8B)
+DOUBLE_BYTE_PAIR(0xA586, 0xCA8C)
+DOUBLE_BYTE_PAIR(0xA587, 0xCA8D)
+DOUBLE_BYTE_PAIR(0xA588, 0xCA8E)
+DOUBLE_BYTE_PAIR(0xA589, 0xCA8F)
+DOUBLE_BYTE_PAIR(0xA58A, 0xCA90)
+DOUBLE_BYTE_PAIR(0xA58B, 0xCA91)
+DOUBLE_BYTE_PAIR(0xA58C, 0xCA92)
+DOUBLE_BYTE_PAIR(0xA58D, 0xCA93)
+DOUBLE_BYTE_PAIR(0xA58E, 0xCA94)
+DOUBLE_BYTE_PAIR(0xA58F, 0xCA95)
+DOUBLE_BYTE_PAIR(0xA590, 0xCA96)
+DOUBLE_BYTE_PAIR(0xA591, 0xCA97)
+DOUBLE_BYTE_PAIR(0xA592, 0xCA99)
+DOUBLE_BYTE_PAIR(0xA593, 0xCA9A)
+DOUBLE_BYTE_PAIR(0xA594, 0xCA9B)
+DOUBLE_BYTE_PAIR(0xA595, 0xCA9C)
+DOUBLE_BYTE_PAIR(0xA596, 0xCA9D)
+DOUBLE_BYTE_PAIR(0xA597, 0xCA9E)
+DOUBLE_BYTE_PAIR(0xA598, 0xCA9F)
+DOUBLE_BYTE_PAIR(0xA599, 0xCAA0)
+DOUBLE_BYTE_PAIR(0xA59A, 0xCAA1)
+DOUBLE_BYTE_PAIR(0xA59B, 0xCAA2)
+DOUBLE_BYTE_PAIR(0xA59C, 0xCAA3)
+DOUBLE_BYTE_PAIR(0xA59D, 0xCAA4)
+DOUBLE_BYTE_PAIR(0xA59E, 0xCAA5)
+DOUBLE_BYTE_PAIR(0xA59F, 0xCAA6)
+DOUBLE_BYTE_PAIR(0xA5A0, 0xCAA7)
+DOUBLE_BYTE_PAIR(0xA5A1, 0x2170)
+DOUBLE_BYTE_PAIR(0xA5A2, 0x2171)
+DOUBLE_BYTE_PAIR(0xA5A3, 0x2172)
+DOUBLE_BYTE_PAIR(0xA5A4, 0x2173)
+DOUBLE_BYTE_PAIR(0xA5A5, 0x2174)
+DOUBLE_BYTE_PAIR(0xA5A6, 0x2175)
+DOUBLE_BYTE_PAIR(0xA5A7, 0x2176)
+DOUBLE_BYTE_PAIR(0xA5A8, 0x2177)
+DOUBLE_BYTE_PAIR(0xA5A9, 0x2178)
+DOUBLE_BYTE_PAIR(0xA5AA, 0x2179)
+DOUBLE_BYTE_PAIR(0xA5B0, 0x2160)
+DOUBLE_BYTE_PAIR(0xA5B1, 0x2161)
+DOUBLE_BYTE_PAIR(0xA5B2, 0x2162)
+DOUBLE_BYTE_PAIR(0xA5B3, 0x2163)
+DOUBLE_BYTE_PAIR(0xA5B4, 0x2164)
+DOUBLE_BYTE_PAIR(0xA5B5, 0x2165)
+DOUBLE_BYTE_PAIR(0xA5B6, 0x2166)
+DOUBLE_BYTE_PAIR(0xA5B7, 0x2167)
+DOUBLE_BYTE_PAIR(0xA5B8, 0x2168)
+DOUBLE_BYTE_PAIR(0xA5B9, 0x2169)
+DOUBLE_BYTE_PAIR(0xA5C1, 0x0391)
+DOUBLE_BYTE_PAIR(0xA5C2, 0x0392)
+DOUBLE_BYTE_PAIR(0xA5C3, 0x0393)
+DOUBLE_BYTE_PAIR(0xA5C4, 0x0394)
+DOUBLE_BYTE_PAIR(0xA5C5, 0x0395)
+DOUBLE_BYTE_PAIR(0xA5C6, 0x0396)
+DOUBLE_BYTE_PAIR(0xA5C7, 0x0397)
+DOUBLE_BYTE_PAIR(0xA5C8, 0x0398)
+DOUBLE_BYTE_PAIR(0xA5C9, 0x0399)
+DOUBLE_BYTE_PAIR(0xA5CA, 0x039A)
+DOUBLE_BYTE_PAIR(0xA5CB, 0x039B)
+DOUBLE_BYTE_PAIR(0xA5CC, 0x039C)
+DOUBLE_BYTE_PAIR(0xA5CD, 0x039D)
+DOUBLE_BYTE_PAIR(0xA5CE, 0x039E)
+DOUBLE_BYTE_PAIR(0xA5CF, 0x039F)
+DOUBLE_BYTE_PAIR(0xA5D0, 0x03A0)
+DOUBLE_BYTE_PAIR(0xA5D1, 0x03A1)
+DOUBLE_BYTE_PAIR(0xA5D2, 0x03A3)
+DOUBLE_BYTE_PAIR(0xA5D3, 0x03A4)
+DOUBLE_BYTE_PAIR(0xA5D4, 0x03A5)
+DOUBLE_BYTE_PAIR(0xA5D5, 0x03A6)
+DOUBLE_BYTE_PAIR(0xA5D6, 0x03A7)
+DOUBLE_BYTE_PAIR(0xA5D7, 0x03A8)
+DOUBLE_BYTE_PAIR(0xA5D8, 0x03A9)
+DOUBLE_BYTE_PAIR(0xA5E1, 0x03B1)
+DOUBLE_BYTE_PAIR(0xA5E2, 0x03B2)
+DOUBLE_BYTE_PAIR(0xA5E3, 0x03B3)
+DOUBLE_BYTE_PAIR(0xA5E4, 0x03B4)
+DOUBLE_BYTE_PAIR(0xA5E5, 0x03B5)
+DOUBLE_BYTE_PAIR(0xA5E6, 0x03B6)
+DOUBLE_BYTE_PAIR(0xA5E7, 0x03B7)
+DOUBLE_BYTE_PAIR(0xA5E8, 0x03B8)
+DOUBLE_BYTE_PAIR(0xA5E9, 0x03B9)
+DOUBLE_BYTE_PAIR(0xA5EA, 0x03BA)
+DOUBLE_BYTE_PAIR(0xA5EB, 0x03BB)
+DOUBLE_BYTE_PAIR(0xA5EC, 0x03BC)
+DOUBLE_BYTE_PAIR(0xA5ED, 0x03BD)
+DOUBLE_BYTE_PAIR(0xA5EE, 0x03BE)
+DOUBLE_BYTE_PAIR(0xA5EF, 0x03BF)
+DOUBLE_BYTE_PAIR(0xA5F0, 0x03C0)
+DOUBLE_BYTE_PAIR(0xA5F1, 0x03C1)
+DOUBLE_BYTE_PAIR(0xA5F2, 0x03C3)
+DOUBLE_BYTE_PAIR(0xA5F3, 0x03C4)
+DOUBLE_BYTE_PAIR(0xA5F4, 0x03C5)
+DOUBLE_BYTE_PAIR(0xA5F5, 0x03C6)
+DOUBLE_BYTE_PAIR(0xA5F6, 0x03C7)
+DOUBLE_BYTE_PAIR(0xA5F7, 0x03C8)
+DOUBLE_BYTE_PAIR(0xA5F8, 0x03C9)
+DOUBLE_BYTE_PAIR(0xA641, 0xCAA8)
+DOUBLE_BYTE_PAIR(0xA642, 0xCAA9)
+DOUBLE_BYTE_PAIR(0xA643, 0xCAAA)
+DOUBLE_BYTE_PAIR(0xA644, 0xCAAB)
+DOUBLE_BYTE_PAIR(0xA645, 0xCAAC)
+DOUBLE_BYTE_PAIR(0xA646, 0xCAAD)
+DOUBLE_BYTE_PAIR(0xA647, 0xCAAE)
+DOUBLE_BYTE_PAIR(0xA648, 0xCAAF)
+DOUBLE_BYTE_PAIR(0xA649, 0xCAB0)
+DOUBLE_BYTE_PAIR(0xA64A, 0xCAB1)
+DOUBLE_BYTE_PAIR(0xA64B, 0xCAB2)
+DOUBLE_BYTE_PAIR(0xA64C, 0xCAB3)
+DOUBLE_BYTE_PAIR(0xA64D, 0xCAB4)
+DOUBLE_BYTE_PAIR(0xA64E, 0xCAB5)
+DOUBLE_BYTE_PAIR(0xA64F, 0xCAB6)
+DOUBLE_BYTE_PAIR(0xA650, 0xCAB7)
+DOUBLE_BYTE_PAIR(0xA651, 0xCAB8)
+DOUBLE_BYTE_PAIR(0xA652, 0xCAB9)
+DOUBLE_BYTE_PAIR(0xA653, 0xCABA)
+DOUBLE_BYTE_PAIR(0xA654, 0xCABB)
+DOUBLE_BYTE_PAIR(0xA655, 0xCABE)
+DOUBLE_BYTE_PAIR(0xA656, 0xCABF)
+DOUBLE_BYTE_PAIR(0xA657, 0xCAC1)
+DOUBLE_BYTE_PAIR(0xA658, 0xCAC2)
+DOUBLE_BYTE_PAIR(0xA659, 0xCAC3)
+DOUBLE_BYTE_PAIR(0xA65A, 0xCAC5)
+DOUBLE_BYTE_PAIR(0xA661, 0xCAC6)
+DOUBLE_BYTE_PAIR(0xA662, 0xCAC7)
+DOUBLE_BYTE_PAIR(0xA663, 0xCAC8)
+DOUBLE_BYTE_PAIR(0xA664, 0xCAC9)
+DOUBLE_BYTE_PAIR(0xA665, 0xCACA)
+DOUBLE_BYTE_PAIR(0xA666, 0xCACB)
+DOUBLE_BYTE_PAIR(0xA667, 0xCACE)
+DOUBLE_BYTE_PAIR(0xA668, 0xCAD0)
+DOUBLE_BYTE_PAIR(0xA669, 0xCAD2)
+DOUBLE_BYTE_PAIR(0xA66A, 0xCAD4)
+DOUBLE_BYTE_PAIR(0xA66B, 0xCAD5)
+DOUBLE_BYTE_PAIR(0xA66C, 0xCAD6)
+DOUBLE_BYTE_PAIR(0xA66D, 0xCAD7)
+DOUBLE_BYTE_PAIR(0xA66E, 0xCADA)
+DOUBLE_BYTE_PAIR(0xA66F, 0xCADB)
+DOUBLE_BYTE_PAIR(0xA670, 0xCADC)
+DOUBLE_BYTE_PAIR(0xA671, 0xCADD)
+DOUBLE_BYTE_PAIR(0xA672, 0xCADE)
+DOUBLE_BYTE_PAIR(0xA673, 0xCADF)
+DOUBLE_BYTE_PAIR(0xA674, 0xCAE1)
+DOUBLE_BYTE_PAIR(0xA675, 0xCAE2)
+DOUBLE_BYTE_PAIR(0xA676, 0xCAE3)
+DOUBLE_BYTE_PAIR(0xA677, 0xCAE4)
+DOUBLE_BYTE_PAIR(0xA678, 0xCAE5)
+DOUBLE_BYTE_PAIR(0xA679, 0xCAE6)
+DOUBLE_BYTE_PAIR(0xA67A, 0xCAE7)
+DOUBLE_BYTE_PAIR(0xA681, 0xCAE8)
+DOUBLE_BYTE_PAIR(0xA682, 0xCAE9)
+DOUBLE_BYTE_PAIR(0xA683, 0xCAEA)
+DOUBLE_BYTE_PAIR(0xA684, 0xCAEB)
+DOUBLE_BYTE_PAIR(0xA685, 0xCAED)
+DOUBLE_BYTE_PAIR(0xA686, 0xCAEE)
+DOUBLE_BYTE_PAIR(0xA687, 0xCAEF)
+DOUBLE_BYTE_PAIR(0xA688, 0xCAF0)
+DOUBLE_BYTE_PAIR(0xA689, 0xCAF1)
+DOUBLE_BYTE_PAIR(0xA68A, 0xCAF2)
+DOUBLE_BYTE_PAIR(0xA68B, 0xCAF3)
+DOUBLE_BYTE_PAIR(0xA68C, 0xCAF5)
+DOUBLE_BYTE_PAIR(0xA68D, 0xCAF6)
+DOUBLE_BYTE_PAIR(0xA68E, 0xCAF7)
+DOUBLE_BYTE_PAIR(0xA68F, 0xCAF8)
+DOUBLE_BYTE_PAIR(0xA690, 0xCAF9)
+DOUBLE_BYTE_PAIR(0xA691, 0xCAFA)
+DOUBLE_BYTE_PAIR(0xA692, 0xCAFB)
+DOUBLE_BYTE_PAIR(0xA693, 0xCAFC)
+DOUBLE_BYTE_PAIR(0xA694, 0xCAFD)
+DOUBLE_BYTE_PAIR(0xA695, 0xCAFE)
+DOUBLE_BYTE_PAIR(0xA696, 0xCAFF)
+DOUBLE_BYTE_PAIR(0xA697, 0xCB00)
+DOUBLE_BYTE_PAIR(0xA698, 0xCB01)
+DOUBLE_BYTE_PAIR(0xA699, 0xCB02)
+DOUBLE_BYTE_PAIR(0xA69A, 0xCB03)
+DOUBLE_BYTE_PAIR(0xA69B, 0xCB04)
+DOUBLE_BYTE_PAIR(0xA69C, 0xCB05)
+DOUBLE_BYTE_PAIR(0xA69D, 0xCB06)
+DOUBLE_BYTE_PAIR(0xA69E, 0xCB07)
+DOUBLE_BYTE_PAIR(0xA69F, 0xCB09)
+DOUBLE_BYTE_PAIR(0xA6A0, 0xCB0A)
+DOUBLE_BYTE_PAIR(0xA6A1, 0x2500)
+DOUBLE_BYTE_PAIR(0xA6A2, 0x2502)
+DOUBLE_BYTE_PAIR(0xA6A3, 0x250C)
+DOUBLE_BYTE_PAIR(0xA6A4, 0x2510)
+DOUBLE_BYTE_PAIR(0xA6A5, 0x2518)
+DOUBLE_BYTE_PAIR(0xA6A6, 0x2514)
+DOUBLE_BYTE_PAIR(0xA6A7, 0x251C)
+DOUBLE_BYTE_PAIR(0xA6A8, 0x252C)
+DOUBLE_BYTE_PAIR(0xA6A9, 0x2524)
+DOUBLE_BYTE_PAIR(0xA6AA, 0x2534)
+DOUBLE_BYTE_PAIR(0xA6AB, 0x253C)
+DOUBLE_BYTE_PAIR(0xA6AC, 0x2501)
+DOUBLE_BYTE_PAIR(0xA6AD, 0x2503)
+DOUBLE_BYTE_PAIR(0xA6AE, 0x250F)
+DOUBLE_BYTE_PAIR(0xA6AF, 0x2513)
+DOUBLE_BYTE_PAIR(0xA6B0, 0x251B)
+DOUBLE_BYTE_PAIR(0xA6B1, 0x2517)
+DOUBLE_BYTE_PAIR(0xA6B2, 0x2523)
+DOUBLE_BYTE_PAIR(0xA6B3, 0x2533)
+DOUBLE_BYTE_PAIR(0xA6B4, 0x252B)
+DOUBLE_BYTE_PAIR(0xA6B5, 0x253B)
+DOUBLE_BYTE_PAIR(0xA6B6, 0x254B)
+DOUBLE_BYTE_PAIR(0xA6B7, 0x2520)
+DOUBLE_BYTE_PAIR(0xA6B8, 0x252F)
+DOUBLE_BYTE_PAIR(0xA6B9, 0x2528)
+DOUBLE_BYTE_PAIR(0xA6BA, 0x2537)
+DOUBLE_BYTE_PAIR(0xA6BB, 0x253F)
+DOUBLE_BYTE_PAIR(0xA6BC, 0x251D)
+DOUBLE_BYTE_PAIR(0xA6BD, 0x2530)
+DOUBLE_BYTE_PAIR(0xA6BE, 0x2525)
+DOUBLE_BYTE_PAIR(0xA6BF, 0x2538)
+DOUBLE_BYTE_PAIR(0xA6C0, 0x2542)
+DOUBLE_BYTE_PAIR(0xA6C1, 0x2512)
+DOUBLE_BYTE_PAIR(0xA6C2, 0x2511)
+DOUBLE_BYTE_PAIR(0xA6C3, 0x251A)
+DOUBLE_BYTE_PAIR(0xA6C4, 0x2519)
+DOUBLE_BYTE_PAIR(0xA6C5, 0x2516)
+DOUBLE_BYTE_PAIR(0xA6C6, 0x2515)
+DOUBLE_BYTE_PAIR(0xA6C7, 0x250E)
+DOUBLE_BYTE_PAIR(0xA6C8, 0x250D)
+DOUBLE_BYTE_PAIR(0xA6C9, 0x251E)
+DOUBLE_BYTE_PAIR(0xA6CA, 0x251F)
+DOUBLE_BYTE_PAIR(0xA6CB, 0x2521)
+DOUBLE_BYTE_PAIR(0xA6CC, 0x2522)
+DOUBLE_BYTE_PAIR(0xA6CD, 0x2526)
+DOUBLE_BYTE_PAIR(0xA6CE, 0x2527)
+DOUBLE_BYTE_PAIR(0xA6CF, 0x2529)
+DOUBLE_BYTE_PAIR(0xA6D0, 0x252A)
+DOUBLE_BYTE_PAIR(0xA6D1, 0x252D)
+DOUBLE_BYTE_PAIR(0xA6D2, 0x252E)
+DOUBLE_BYTE_PAIR(0xA6D3, 0x2531)
+DOUBLE_BYTE_PAIR(0xA6D4, 0x2532)
+DOUBLE_BYTE_PAIR(0xA6D5, 0x2535)
+DOUBLE_BYTE_PAIR(0xA6D6, 0x2536)
+DOUBLE_BYTE_PAIR(0xA6D7, 0x2539)
+DOUBLE_BYTE_PAIR(0xA6D8, 0x253A)
+DOUBLE_BYTE_PAIR(0xA6D9, 0x253D)
+DOUBLE_BYTE_PAIR(0xA6DA, 0x253E)
+DOUBLE_BYTE_PAIR(0xA6DB, 0x2540)
+DOUBLE_BYTE_PAIR(0xA6DC, 0x2541)
+DOUBLE_BYTE_PAIR(0xA6DD, 0x2543)
+DOUBLE_BYTE_PAIR(0xA6DE, 0x2544)
+DOUBLE_BYTE_PAIR(0xA6DF, 0x2545)
+DOUBLE_BYTE_PAIR(0xA6E0, 0x2546)
+DOUBLE_BYTE_PAIR(0xA6E1, 0x2547)
+DOUBLE_BYTE_PAIR(0xA6E2, 0x2548)
+DOUBLE_BYTE_PAIR(0xA6E3, 0x2549)
+DOUBLE_BYTE_PAIR(0xA6E4, 0x254A)
+DOUBLE_BYTE_PAIR(0xA741, 0xCB0B)
+DOUBLE_BYTE_PAIR(0xA742, 0xCB0C)
+DOUBLE_BYTE_PAIR(0xA743, 0xCB0D)
+DOUBLE_BYTE_PAIR(0xA744, 0xCB0E)
+DOUBLE_BYTE_PAIR(0xA745, 0xCB0F)
+DOUBLE_BYTE_PAIR(0xA746, 0xCB11)
+DOUBLE_BYTE_PAIR(0xA747, 0xCB12)
+DOUBLE_BYTE_PAIR(0xA748, 0xCB13)
+DOUBLE_BYTE_PAIR(0xA749, 0xCB15)
+DOUBLE_BYTE_PAIR(0xA74A, 0xCB16)
+DOUBLE_BYTE_PAIR(0xA74B, 0xCB17)
+DOUBLE_BYTE_PAIR(0xA74C, 0xCB19)
+DOUBLE_BYTE_PAIR(0xA74D, 0xCB1A)
+DOUBLE_BYTE_PAIR(0xA74E, 0xCB1B)
+DOUBLE_BYTE_PAIR(0xA74F, 0xCB1C)
+DOUBLE_BYTE_PAIR(0xA750, 0xCB1D)
+DOUBLE_BYTE_PAIR(0xA751, 0xCB1E)
+DOUBLE_BYTE_PAIR(0xA752, 0xCB1F)
+DOUBLE_BYTE_PAIR(0xA753, 0xCB22)
+DOUBLE_BYTE_PAIR(0xA754, 0xCB23)
+DOUBLE_BYTE_PAIR(0xA755, 0xCB24)
+DOUBLE_BYTE_PAIR(0xA756, 0xCB25)
+DOUBLE_BYTE_PAIR(0xA757, 0xCB26)
+DOUBLE_BYTE_PAIR(0xA758, 0xCB27)
+DOUBLE_BYTE_PAIR(0xA759, 0xCB28)
+DOUBLE_BYTE_PAIR(0xA75A, 0xCB29)
+DOUBLE_BYTE_PAIR(0xA761, 0xCB2A)
+DOUBLE_BYTE_PAIR(0xA762, 0xCB2B)
+DOUBLE_BYTE_PAIR(0xA763, 0xCB2C)
+DOUBLE_BYTE_PAIR(0xA764, 0xCB2D)
+DOUBLE_BYTE_PAIR(0xA765, 0xCB2E)
+DOUBLE_BYTE_PAIR(0xA766, 0xCB2F)
+DOUBLE_BYTE_PAIR(0xA767, 0xCB30)
+DOUBLE_BYTE_PAIR(0xA768, 0xCB31)
+DOUBLE_BYTE_PAIR(0xA769, 0xCB32)
+DOUBLE_BYTE_PAIR(0xA76A, 0xCB33)
+DOUBLE_BYTE_PAIR(0xA76B, 0xCB34)
+DOUBLE_BYTE_PAIR(0xA76C, 0xCB35)
+DOUBLE_BYTE_PAIR(0xA76D, 0xCB36)
+DOUBLE_BYTE_PAIR(0xA76E, 0xCB37)
+DOUBLE_BYTE_PAIR(0xA76F, 0xCB38)
+DOUBLE_BYTE_PAIR(0xA770, 0xCB39)
+DOUBLE_BYTE_PAIR(0xA771, 0xCB3A)
+DOUBLE_BYTE_PAIR(0xA772, 0xCB3B)
+DOUBLE_BYTE_PAIR(0xA773, 0xCB3C)
+DOUBLE_BYTE_PAIR(0xA774, 0xCB3D)
+DOUBLE_BYTE_PAIR(0xA775, 0xCB3E)
+DOUBLE_BYTE_PAIR(0xA776, 0xCB3F)
+DOUBLE_BYTE_PAIR(0xA777, 0xCB40)
+DOUBLE_BYTE_PAIR(0xA778, 0xCB42)
+DOUBLE_BYTE_PAIR(0xA779, 0xCB43)
+DOUBLE_BYTE_PAIR(0xA77A, 0xCB44)
+DOUBLE_BYTE_PAIR(0xA781, 0xCB45)
+DOUBLE_BYTE_PAIR(0xA782, 0xCB46)
+DOUBLE_BYTE_PAIR(0xA783, 0xCB47)
+DOUBLE_BYTE_PAIR(0xA784, 0xCB4A)
+DOUBLE_BYTE_PAIR(0xA785, 0xCB4B)
+DOUBLE_BYTE_PAIR(0xA786, 0xCB4D)
+DOUBLE_BYTE_PAIR(0xA787, 0xCB4E)
+DOUBLE_BYTE_PAIR(0xA788, 0xCB4F)
+DOUBLE_BYTE_PAIR(0xA789, 0xCB51)
+DOUBLE_BYTE_PAIR(0xA78A, 0xCB52)
+DOUBLE_BYTE_PAIR(0xA78B, 0xCB53)
+DOUBLE_BYTE_PAIR(0xA78C, 0xCB54)
+DOUBLE_BYTE_PAIR(0xA78D, 0xCB55)
+DOUBLE_BYTE_PAIR(0xA78E, 0xCB56)
+DOUBLE_BYTE_PAIR(0xA78F, 0xCB57)
+DOUBLE_BYTE_PAIR(0xA790, 0xCB5A)
+DOUBLE_BYTE_PAIR(0xA791, 0xCB5B)
+DOUBLE_BYTE_PAIR(0xA792, 0xCB5C)
+DOUBLE_BYTE_PAIR(0xA793, 0xCB5E)
+DOUBLE_BYTE_PAIR(0xA794, 0xCB5F)
+DOUBLE_BYTE_PAIR(0xA795, 0xCB60)
+DOUBLE_BYTE_PAIR(0xA796, 0xCB61)
+DOUBLE_BYTE_PAIR(0xA797, 0xCB62)
+DOUBLE_BYTE_PAIR(0xA798, 0xCB63)
+DOUBLE_BYTE_PAIR(0xA799, 0xCB65)
+DOUBLE_BYTE_PAIR(0xA79A, 0xCB66)
+DOUBLE_BYTE_PAIR(0xA79B, 0xCB67)
+DOUBLE_BYTE_PAIR(0xA79C, 0xCB68)
+DOUBLE_BYTE_PAIR(0xA79D, 0xCB69)
+DOUBLE_BYTE_PAIR(0xA79E, 0xCB6A)
+DOUBLE_BYTE_PAIR(0xA79F, 0xCB6B)
+DOUBLE_BYTE_PAIR(0xA7A0, 0xCB6C)
+DOUBLE_BYTE_PAIR(0xA7A1, 0x3395)
+DOUBLE_BYTE_PAIR(0xA7A2, 0x3396)
+DOUBLE_BYTE_PAIR(0xA7A3, 0x3397)
+DOUBLE_BYTE_PAIR(0xA7A4, 0x2113)
+DOUBLE_BYTE_PAIR(0xA7A5, 0x3398)
+DOUBLE_BYTE_PAIR(0xA7A6, 0x33C4)
+DOUBLE_BYTE_PAIR(0xA7A7, 0x33A3)
+DOUBLE_BYTE_PAIR(0xA7A8, 0x33A4)
+DOUBLE_BYTE_PAIR(0xA7A9, 0x33A5)
+DOUBLE_BYTE_PAIR(0xA7AA, 0x33A6)
+DOUBLE_BYTE_PAIR(0xA7AB, 0x3399)
+DOUBLE_BYTE_PAIR(0xA7AC, 0x339A)
+DOUBLE_BYTE_PAIR(0xA7AD, 0x339B)
+DOUBLE_BYTE_PAIR(0xA7AE, 0x339C)
+DOUBLE_BYTE_PAIR(0xA7AF, 0x339D)
+DOUBLE_BYTE_PAIR(0xA7B0, 0x339E)
+DOUBLE_BYTE_PAIR(0xA7B1, 0x339F)
+DOUBLE_BYTE_PAIR(0xA7B2, 0x33A0)
+DOUBLE_BYTE_PAIR(0xA7B3, 0x33A1)
+DOUBLE_BYTE_PAIR(0xA7B4, 0x33A2)
+DOUBLE_BYTE_PAIR(0xA7B5, 0x33CA)
+DOUBLE_BYTE_PAIR(0xA7B6, 0x338D)
+DOUBLE_BYTE_PAIR(0xA7B7, 0x338E)
+DOUBLE_BYTE_PAIR(0xA7B8, 0x338F)
+DOUBLE_BYTE_PAIR(0xA7B9, 0x33CF)
+DOUBLE_BYTE_PAIR(0xA7BA, 0x3388)
+DOUBLE_BYTE_PAIR(0xA7BB, 0x3389)
+DOUBLE_BYTE_PAIR(0xA7BC, 0x33C8)
+DOUBLE_BYTE_PAIR(0xA7BD, 0x33A7)
+DOUBLE_BYTE_PAIR(0xA7BE, 0x33A8)
+DOUBLE_BYTE_PAIR(0xA7BF, 0x33B0)
+DOUBLE_BYTE_PAIR(0xA7C0, 0x33B1)
+DOUBLE_BYTE_PAIR(0xA7C1, 0x33B2)
+DOUBLE_BYTE_PAIR(0xA7C2, 0x33B3)
+DOUBLE_BYTE_PAIR(0xA7C3, 0x33B4)
+DOUBLE_BYTE_PAIR(0xA7C4, 0x33B5)
+DOUBLE_BYTE_PAIR(0xA7C5, 0x33B6)
+DOUBLE_BYTE_PAIR(0xA7C6, 0x33B7)
+DOUBLE_BYTE_PAIR(0xA7C7, 0x33B8)
+DOUBLE_BYTE_PAIR(0xA7C8, 0x33B9)
+DOUBLE_BYTE_PAIR(0xA7C9, 0x3380)
+DOUBLE_BYTE_PAIR(0xA7CA, 0x3381)
+DOUBLE_BYTE_PAIR(0xA7CB, 0x3382)
+DOUBLE_BYTE_PAIR(0xA7CC, 0x3383)
+DOUBLE_BYTE_PAIR(0xA7CD, 0x3384)
+DOUBLE_BYTE_PAIR(0xA7CE, 0x33BA)
+DOUBLE_BYTE_PAIR(0xA7CF, 0x33BB)
+DOUBLE_BYTE_PAIR(0xA7D0, 0x33BC)
+DOUBLE_BYTE_PAIR(0xA7D1, 0x33BD)
+DOUBLE_BYTE_PAIR(0xA7D2, 0x33BE)
+DOUBLE_BYTE_PAIR(0xA7D3, 0x33BF)
+DOUBLE_BYTE_PAIR(0xA7D4, 0x3390)
+DOUBLE_BYTE_PAIR(0xA7D5, 0x3391)
+DOUBLE_BYTE_PAIR(0xA7D6, 0x3392)
+DOUBLE_BYTE_PAIR(0xA7D7, 0x3393)
+DOUBLE_BYTE_PAIR(0xA7D8, 0x3394)
+DOUBLE_BYTE_PAIR(0xA7D9, 0x2126)
+DOUBLE_BYTE_PAIR(0xA7DA, 0x33C0)
+DOUBLE_BYTE_PAIR(0xA7DB, 0x33C1)
+DOUBLE_BYTE_PAIR(0xA7DC, 0x338A)
+DOUBLE_BYTE_PAIR(0xA7DD, 0x338B)
+DOUBLE_BYTE_PAIR(0xA7DE, 0x338C)
+DOUBLE_BYTE_PAIR(0xA7DF, 0x33D6)
+DOUBLE_BYTE_PAIR(0xA7E0, 0x33C5)
+DOUBLE_BYTE_PAIR(0xA7E1, 0x33AD)
+DOUBLE_BYTE_PAIR(0xA7E2, 0x33AE)
+DOUBLE_BYTE_PAIR(0xA7E3, 0x33AF)
+DOUBLE_BYTE_PAIR(0xA7E4, 0x33DB)
+DOUBLE_BYTE_PAIR(0xA7E5, 0x33A9)
+DOUBLE_BYTE_PAIR(0xA7E6, 0x33AA)
+DOUBLE_BYTE_PAIR(0xA7E7, 0x33AB)
+DOUBLE_BYTE_PAIR(0xA7E8, 0x33AC)
+DOUBLE_BYTE_PAIR(0xA7E9, 0x33DD)
+DOUBLE_BYTE_PAIR(0xA7EA, 0x33D0)
+DOUBLE_BYTE_PAIR(0xA7EB, 0x33D3)
+DOUBLE_BYTE_PAIR(0xA7EC, 0x33C3)
+DOUBLE_BYTE_PAIR(0xA7ED, 0x33C9)
+DOUBLE_BYTE_PAIR(0xA7EE, 0x33DC)
+DOUBLE_BYTE_PAIR(0xA7EF, 0x33C6)
+DOUBLE_BYTE_PAIR(0xA841, 0xCB6D)
+DOUBLE_BYTE_PAIR(0xA842, 0xCB6E)
+DOUBLE_BYTE_PAIR(0xA843, 0xCB6F)
+DOUBLE_BYTE_PAIR(0xA844, 0xCB70)
+DOUBLE_BYTE_PAIR(0xA845, 0xCB71)
+DOUBLE_BYTE_PAIR(0xA846, 0xCB72)
+DOUBLE_BYTE_PAIR(0xA847, 0xCB73)
+DOUBLE_BYTE_PAIR(0xA848, 0xCB74)
+DOUBLE_BYTE_PAIR(0xA849, 0xCB75)
+DOUBLE_BYTE_PAIR(0xA84A, 0xCB76)
+DOUBLE_BYTE_PAIR(0xA84B, 0xCB77)
+DOUBLE_BYTE_PAIR(0xA84C, 0xCB7A)
+DOUBLE_BYTE_PAIR(0xA84D, 0xCB7B)
+DOUBLE_BYTE_PAIR(0xA84E, 0xCB7C)
+DOUBLE_BYTE_PAIR(0xA84F, 0xCB7D)
+DOUBLE_BYTE_PAIR(0xA850, 0xCB7E)
+DOUBLE_BYTE_PAIR(0xA851, 0xCB7F)
+DOUBLE_BYTE_PAIR(0xA852, 0xCB80)
+DOUBLE_BYTE_PAIR(0xA853, 0xCB81)
+DOUBLE_BYTE_PAIR(0xA854, 0xCB82)
+DOUBLE_BYTE_PAIR(0xA855, 0xCB83)
+DOUBLE_BYTE_PAIR(0xA856, 0xCB84)
+DOUBLE_BYTE_PAIR(0xA857, 0xCB85)
+DOUBLE_BYTE_PAIR(0xA858, 0xCB86)
+DOUBLE_BYTE_PAIR(0xA859, 0xCB87)
+DOUBLE_BYTE_PAIR(0xA85A, 0xCB88)
+DOUBLE_BYTE_PAIR(0xA861, 0xCB89)
+DOUBLE_BYTE_PAIR(0xA862, 0xCB8A)
+DOUBLE_BYTE_PAIR(0xA863, 0xCB8B)
+DOUBLE_BYTE_PAIR(0xA864, 0xCB8C)
+DOUBLE_BYTE_PAIR(0xA865, 0xCB8D)
+DOUBLE_BYTE_PAIR(0xA866, 0xCB8E)
+DOUBLE_BYTE_PAIR(0xA867, 0xCB8F)
+DOUBLE_BYTE_PAIR(0xA868, 0xCB90)
+DOUBLE_BYTE_PAIR(0xA869, 0xCB91)
+DOUBLE_BYTE_PAIR(0xA86A, 0xCB92)
+DOUBLE_BYTE_PAIR(0xA86B, 0xCB93)
+DOUBLE_BYTE_PAIR(0xA86C, 0xCB94)
+DOUBLE_BYTE_PAIR(0xA86D, 0xCB95)
+DOUBLE_BYTE_PAIR(0xA86E, 0xCB96)
+DOUBLE_BYTE_PAIR(0xA86F, 0xCB97)
+DOUBLE_BYTE_PAIR(0xA870, 0xCB98)
+DOUBLE_BYTE_PAIR(0xA871, 0xCB99)
+DOUBLE_BYTE_PAIR(0xA872, 0xCB9A)
+DOUBLE_BYTE_PAIR(0xA873, 0xCB9B)
+DOUBLE_BYTE_PAIR(0xA874, 0xCB9D)
+DOUBLE_BYTE_PAIR(0xA875, 0xCB9E)
+DOUBLE_BYTE_PAIR(0xA876, 0xCB9F)
+DOUBLE_BYTE_PAIR(0xA877, 0xCBA0)
+DOUBLE_BYTE_PAIR(0xA878, 0xCBA1)
+DOUBLE_BYTE_PAIR(0xA879, 0xCBA2)
+DOUBLE_BYTE_PAIR(0xA87A, 0xCBA3)
+DOUBLE_BYTE_PAIR(0xA881, 0xCBA4)
+DOUBLE_BYTE_PAIR(0xA882, 0xCBA5)
+DOUBLE_BYTE_PAIR(0xA883, 0xCBA6)
+DOUBLE_BYTE_PAIR(0xA884, 0xCBA7)
+DOUBLE_BYTE_PAIR(0xA885, 0xCBA8)
+DOUBLE_BYTE_PAIR(0xA886, 0xCBA9)
+DOUBLE_BYTE_PAIR(0xA887, 0xCBAA)
+DOUBLE_BYTE_PAIR(0xA888, 0xCBAB)
+DOUBLE_BYTE_PAIR(0xA889, 0xCBAC)
+DOUBLE_BYTE_PAIR(0xA88A, 0xCBAD)
+DOUBLE_BYTE_PAIR(0xA88B, 0xCBAE)
+DOUBLE_BYTE_PAIR(0xA88C, 0xCBAF)
+DOUBLE_BYTE_PAIR(0xA88D, 0xCBB0)
+DOUBLE_BYTE_PAIR(0xA88E, 0xCBB1)
+DOUBLE_BYTE_PAIR(0xA88F, 0xCBB2)
+DOUBLE_BYTE_PAIR(0xA890, 0xCBB3)
+DOUBLE_BYTE_PAIR(0xA891, 0xCBB4)
+DOUBLE_BYTE_PAIR(0xA892, 0xCBB5)
+DOUBLE_BYTE_PAIR(0xA893, 0xCBB6)
+DOUBLE_BYTE_PAIR(0xA894, 0xCBB7)
+DOUBLE_BYTE_PAIR(0xA895, 0xCBB9)
+DOUBLE_BYTE_PAIR(0xA896, 0xCBBA)
+DOUBLE_BYTE_PAIR(0xA897, 0xCBBB)
+DOUBLE_BYTE_PAIR(0xA898, 0xCBBC)
+DOUBLE_BYTE_PAIR(0xA899, 0xCBBD)
+DOUBLE_BYTE_PAIR(0xA89A, 0xCBBE)
+DOUBLE_BYTE_PAIR(0xA89B, 0xCBBF)
+DOUBLE_BYTE_PAIR(0xA89C, 0xCBC0)
+DOUBLE_BYTE_PAIR(0xA89D, 0xCBC1)
+DOUBLE_BYTE_PAIR(0xA89E, 0xCBC2)
+DOUBLE_BYTE_PAIR(0xA89F, 0xCBC3)
+DOUBLE_BYTE_PAIR(0xA8A0, 0xCBC4)
+DOUBLE_BYTE_PAIR(0xA8A1, 0x00C6)
+DOUBLE_BYTE_PAIR(0xA8A2, 0x00D0)
+DOUBLE_BYTE_PAIR(0xA8A3, 0x00AA)
+DOUBLE_BYTE_PAIR(0xA8A4, 0x0126)
+DOUBLE_BYTE_PAIR(0xA8A6, 0x0132)
+DOUBLE_BYTE_PAIR(0xA8A8, 0x013F)
+DOUBLE_BYTE_PAIR(0xA8A9, 0x0141)
+DOUBLE_BYTE_PAIR(0xA8AA, 0x00D8)
+DOUBLE_BYTE_PAIR(0xA8AB, 0x0152)
+DOUBLE_BYTE_PAIR(0xA8AC, 0x00BA)
+DOUBLE_BYTE_PAIR(0xA8AD, 0x00DE)
+DOUBLE_BYTE_PAIR(0xA8AE, 0x0166)
+DOUBLE_BYTE_PAIR(0xA8AF, 0x014A)
+DOUBLE_BYTE_PAIR(0xA8B1, 0x3260)
+DOUBLE_BYTE_PAIR(0xA8B2, 0x3261)
+DOUBLE_BYTE_PAIR(0xA8B3, 0x3262)
+DOUBLE_BYTE_PAIR(0xA8B4, 0x3263)
+DOUBLE_BYTE_PAIR(0xA8B5, 0x3264)
+DOUBLE_BYTE_PAIR(0xA8B6, 0x3265)
+DOUBLE_BYTE_PAIR(0xA8B7, 0x3266)
+DOUBLE_BYTE_PAIR(0xA8B8, 0x3267)
+DOUBLE_BYTE_PAIR(0xA8B9, 0x3268)
+DOUBLE_BYTE_PAIR(0xA8BA, 0x3269)
+DOUBLE_BYTE_PAIR(0xA8BB, 0x326A)
+DOUBLE_BYTE_PAIR(0xA8BC, 0x326B)
+DOUBLE_BYTE_PAIR(0xA8BD, 0x326C)
+DOUBLE_BYTE_PAIR(0xA8BE, 0x326D)
+DOUBLE_BYTE_PAIR(0xA8BF, 0x326E)
+DOUBLE_BYTE_PAIR(0xA8C0, 0x326F)
+DOUBLE_BYTE_PAIR(0xA8C1, 0x3270)
+DOUBLE_BYTE_PAIR(0xA8C2, 0x3271)
+DOUBLE_BYTE_PAIR(0xA8C3, 0x3272)
+DOUBLE_BYTE_PAIR(0xA8C4, 0x3273)
+DOUBLE_BYTE_PAIR(0xA8C5, 0x3274)
+DOUBLE_BYTE_PAIR(0xA8C6, 0x3275)
+DOUBLE_BYTE_PAIR(0xA8C7, 0x3276)
+DOUBLE_BYTE_PAIR(0xA8C8, 0x3277)
+DOUBLE_BYTE_PAIR(0xA8C9, 0x3278)
+DOUBLE_BYTE_PAIR(0xA8CA, 0x3279)
+DOUBLE_BYTE_PAIR(0xA8CB, 0x327A)
+DOUBLE_BYTE_PAIR(0xA8CC, 0x327B)
+DOUBLE_BYTE_PAIR(0xA8CD, 0x24D0)
+DOUBLE_BYTE_PAIR(0xA8CE, 0x24D1)
+DOUBLE_BYTE_PAIR(0xA8CF, 0x24D2)
+DOUBLE_BYTE_PAIR(0xA8D0, 0x24D3)
+DOUBLE_BYTE_PAIR(0xA8D1, 0x24D4)
+DOUBLE_BYTE_PAIR(0xA8D2, 0x24D5)
+DOUBLE_BYTE_PAIR(0xA8D3, 0x24D6)
+DOUBLE_BYTE_PAIR(0xA8D4, 0x24D7)
+DOUBLE_BYTE_PAIR(0xA8D5, 0x24D8)
+DOUBLE_BYTE_PAIR(0xA8D6, 0x24D9)
+DOUBLE_BYTE_PAIR(0xA8D7, 0x24DA)
+DOUBLE_BYTE_PAIR(0xA8D8, 0x24DB)
+DOUBLE_BYTE_PAIR(0xA8D9, 0x24DC)
+DOUBLE_BYTE_PAIR(0xA8DA, 0x24DD)
+DOUBLE_BYTE_PAIR(0xA8DB, 0x24DE)
+DOUBLE_BYTE_PAIR(0xA8DC, 0x24DF)
+DOUBLE_BYTE_PAIR(0xA8DD, 0x24E0)
+DOUBLE_BYTE_PAIR(0xA8DE, 0x24E1)
+DOUBLE_BYTE_PAIR(0xA8DF, 0x24E2)
+DOUBLE_BYTE_PAIR(0xA8E0, 0x24E3)
+DOUBLE_BYTE_PAIR(0xA8E1, 0x24E4)
+DOUBLE_BYTE_PAIR(0xA8E2, 0x24E5)
+DOUBLE_BYTE_PAIR(0xA8E3, 0x24E6)
+DOUBLE_BYTE_PAIR(0xA8E4, 0x24E7)
+DOUBLE_BYTE_PAIR(0xA8E5, 0x24E8)
+DOUBLE_BYTE_PAIR(0xA8E6, 0x24E9)
+DOUBLE_BYTE_PAIR(0xA8E7, 0x2460)
+DOUBLE_BYTE_PAIR(0xA8E8, 0x2461)
+DOUBLE_BYTE_PAIR(0xA8E9, 0x2462)
+DOUBLE_BYTE_PAIR(0xA8EA, 0x2463)
+DOUBLE_BYTE_PAIR(0xA8EB, 0x2464)
+DOUBLE_BYTE_PAIR(0xA8EC, 0x2465)
+DOUBLE_BYTE_PAIR(0xA8ED, 0x2466)
+DOUBLE_BYTE_PAIR(0xA8EE, 0x2467)
+DOUBLE_BYTE_PAIR(0xA8EF, 0x2468)
+DOUBLE_BYTE_PAIR(0xA8F0, 0x2469)
+DOUBLE_BYTE_PAIR(0xA8F1, 0x246A)
+DOUBLE_BYTE_PAIR(0xA8F2, 0x246B)
+DOUBLE_BYTE_PAIR(0xA8F3, 0x246C)
+DOUBLE_BYTE_PAIR(0xA8F4, 0x246D)
+DOUBLE_BYTE_PAIR(0xA8F5, 0x246E)
+DOUBLE_BYTE_PAIR(0xA8F6, 0x00BD)
+DOUBLE_BYTE_PAIR(0xA8F7, 0x2153)
+DOUBLE_BYTE_PAIR(0xA8F8, 0x2154)
+DOUBLE_BYTE_PAIR(0xA8F9, 0x00BC)
+DOUBLE_BYTE_PAIR(0xA8FA, 0x00BE)
+DOUBLE_BYTE_PAIR(0xA8FB, 0x215B)
+DOUBLE_BYTE_PAIR(0xA8FC, 0x215C)
+DOUBLE_BYTE_PAIR(0xA8FD, 0x215D)
+DOUBLE_BYTE_PAIR(0xA8FE, 0x215E)
+DOUBLE_BYTE_PAIR(0xA941, 0xCBC5)
+DOUBLE_BYTE_PAIR(0xA942, 0xCBC6)
+DOUBLE_BYTE_PAIR(0xA943, 0xCBC7)
+DOUBLE_BYTE_PAIR(0xA944, 0xCBC8)
+DOUBLE_BYTE_PAIR(0xA945, 0xCBC9)
+DOUBLE_BYTE_PAIR(0xA946, 0xCBCA)
+DOUBLE_BYTE_PAIR(0xA947, 0xCBCB)
+DOUBLE_BYTE_PAIR(0xA948, 0xCBCC)
+DOUBLE_BYTE_PAIR(0xA949, 0xCBCD)
+DOUBLE_BYTE_PAIR(0xA94A, 0xCBCE)
+DOUBLE_BYTE_PAIR(0xA94B, 0xCBCF)
+DOUBLE_BYTE_PAIR(0xA94C, 0xCBD0)
+DOUBLE_BYTE_PAIR(0xA94D, 0xCBD1)
+DOUBLE_BYTE_PAIR(0xA94E, 0xCBD2)
+DOUBLE_BYTE_PAIR(0xA94F, 0xCBD3)
+DOUBLE_BYTE_PAIR(0xA950, 0xCBD5)
+DOUBLE_BYTE_PAIR(0xA951, 0xCBD6)
+DOUBLE_BYTE_PAIR(0xA952, 0xCBD7)
+DOUBLE_BYTE_PAIR(0xA953, 0xCBD8)
+DOUBLE_BYTE_PAIR(0xA954, 0xCBD9)
+DOUBLE_BYTE_PAIR(0xA955, 0xCBDA)
+DOUBLE_BYTE_PAIR(0xA956, 0xCBDB)
+DOUBLE_BYTE_PAIR(0xA957, 0xCBDC)
+DOUBLE_BYTE_PAIR(0xA958, 0xCBDD)
+DOUBLE_BYTE_PAIR(0xA959, 0xCBDE)
+DOUBLE_BYTE_PAIR(0xA95A, 0xCBDF)
+DOUBLE_BYTE_PAIR(0xA961, 0xCBE0)
+DOUBLE_BYTE_PAIR(0xA962, 0xCBE1)
+DOUBLE_BYTE_PAIR(0xA963, 0xCBE2)
+DOUBLE_BYTE_PAIR(0xA964, 0xCBE3)
+DOUBLE_BYTE_PAIR(0xA965, 0xCBE5)
+DOUBLE_BYTE_PAIR(0xA966, 0xCBE6)
+DOUBLE_BYTE_PAIR(0xA967, 0xCBE8)
+DOUBLE_BYTE_PAIR(0xA968, 0xCBEA)
+DOUBLE_BYTE_PAIR(0xA969, 0xCBEB)
+DOUBLE_BYTE_PAIR(0xA96A, 0xCBEC)
+DOUBLE_BYTE_PAIR(0xA96B, 0xCBED)
+DOUBLE_BYTE_PAIR(0xA96C, 0xCBEE)
+DOUBLE_BYTE_PAIR(0xA96D, 0xCBEF)
+DOUBLE_BYTE_PAIR(0xA96E, 0xCBF0)
+DOUBLE_BYTE_PAIR(0xA96F, 0xCBF1)
+DOUBLE_BYTE_PAIR(0xA970, 0xCBF2)
+DOUBLE_BYTE_PAIR(0xA971, 0xCBF3)
+DOUBLE_BYTE_PAIR(0xA972, 0xCBF4)
+DOUBLE_BYTE_PAIR(0xA973, 0xCBF5)
+DOUBLE_BYTE_PAIR(0xA974, 0xCBF6)
+DOUBLE_BYTE_PAIR(0xA975, 0xCBF7)
+DOUBLE_BYTE_PAIR(0xA976, 0xCBF8)
+DOUBLE_BYTE_PAIR(0xA977, 0xCBF9)
+DOUBLE_BYTE_PAIR(0xA978, 0xCBFA)
+DOUBLE_BYTE_PAIR(0xA979, 0xCBFB)
+DOUBLE_BYTE_PAIR(0xA97A, 0xCBFC)
+DOUBLE_BYTE_PAIR(0xA981, 0xCBFD)
+DOUBLE_BYTE_PAIR(0xA982, 0xCBFE)
+DOUBLE_BYTE_PAIR(0xA983, 0xCBFF)
+DOUBLE_BYTE_PAIR(0xA984, 0xCC00)
+DOUBLE_BYTE_PAIR(0xA985, 0xCC01)
+DOUBLE_BYTE_PAIR(0xA986, 0xCC02)
+DOUBLE_BYTE_PAIR(0xA987, 0xCC03)
+DOUBLE_BYTE_PAIR(0xA988, 0xCC04)
+DOUBLE_BYTE_PAIR(0xA989, 0xCC05)
+DOUBLE_BYTE_PAIR(0xA98A, 0xCC06)
+DOUBLE_BYTE_PAIR(0xA98B, 0xCC07)
+DOUBLE_BYTE_PAIR(0xA98C, 0xCC08)
+DOUBLE_BYTE_PAIR(0xA98D, 0xCC09)
+DOUBLE_BYTE_PAIR(0xA98E, 0xCC0A)
+DOUBLE_BYTE_PAIR(0xA98F, 0xCC0B)
+DOUBLE_BYTE_PAIR(0xA990, 0xCC0E)
+DOUBLE_BYTE_PAIR(0xA991, 0xCC0F)
+DOUBLE_BYTE_PAIR(0xA992, 0xCC11)
+DOUBLE_BYTE_PAIR(0xA993, 0xCC12)
+DOUBLE_BYTE_PAIR(0xA994, 0xCC13)
+DOUBLE_BYTE_PAIR(0xA995, 0xCC15)
+DOUBLE_BYTE_PAIR(0xA996, 0xCC16)
+DOUBLE_BYTE_PAIR(0xA997, 0xCC17)
+DOUBLE_BYTE_PAIR(0xA998, 0xCC18)
+DOUBLE_BYTE_PAIR(0xA999, 0xCC19)
+DOUBLE_BYTE_PAIR(0xA99A, 0xCC1A)
+DOUBLE_BYTE_PAIR(0xA99B, 0xCC1B)
+DOUBLE_BYTE_PAIR(0xA99C, 0xCC1E)
+DOUBLE_BYTE_PAIR(0xA99D, 0xCC1F)
+DOUBLE_BYTE_PAIR(0xA99E, 0xCC20)
+DOUBLE_BYTE_PAIR(0xA99F, 0xCC23)
+DOUBLE_BYTE_PAIR(0xA9A0, 0xCC24)
+DOUBLE_BYTE_PAIR(0xA9A1, 0x00E6)
+DOUBLE_BYTE_PAIR(0xA9A2, 0x0111)
+DOUBLE_BYTE_PAIR(0xA9A3, 0x00F0)
+DOUBLE_BYTE_PAIR(0xA9A4, 0x0127)
+DOUBLE_BYTE_PAIR(0xA9A5, 0x0131)
+DOUBLE_BYTE_PAIR(0xA9A6, 0x0133)
+DOUBLE_BYTE_PAIR(0xA9A7, 0x0138)
+DOUBLE_BYTE_PAIR(0xA9A8, 0x0140)
+DOUBLE_BYTE_PAIR(0xA9A9, 0x0142)
+DOUBLE_BYTE_PAIR(0xA9AA, 0x00F8)
+DOUBLE_BYTE_PAIR(0xA9AB, 0x0153)
+DOUBLE_BYTE_PAIR(0xA9AC, 0x00DF)
+DOUBLE_BYTE_PAIR(0xA9AD, 0x00FE)
+DOUBLE_BYTE_PAIR(0xA9AE, 0x0167)
+DOUBLE_BYTE_PAIR(0xA9AF, 0x014B)
+DOUBLE_BYTE_PAIR(0xA9B0, 0x0149)
+DOUBLE_BYTE_PAIR(0xA9B1, 0x3200)
+DOUBLE_BYTE_PAIR(0xA9B2, 0x3201)
+DOUBLE_BYTE_PAIR(0xA9B3, 0x3202)
+DOUBLE_BYTE_PAIR(0xA9B4, 0x3203)
+DOUBLE_BYTE_PAIR(0xA9B5, 0x3204)
+DOUBLE_BYTE_PAIR(0xA9B6, 0x3205)
+DOUBLE_BYTE_PAIR(0xA9B7, 0x3206)
+DOUBLE_BYTE_PAIR(0xA9B8, 0x3207)
+DOUBLE_BYTE_PAIR(0xA9B9, 0x3208)
+DOUBLE_BYTE_PAIR(0xA9BA, 0x3209)
+DOUBLE_BYTE_PAIR(0xA9BB, 0x320A)
+DOUBLE_BYTE_PAIR(0xA9BC, 0x320B)
+DOUBLE_BYTE_PAIR(0xA9BD, 0x320C)
+DOUBLE_BYTE_PAIR(0xA9BE, 0x320D)
+DOUBLE_BYTE_PAIR(0xA9BF, 0x320E)
+DOUBLE_BYTE_PAIR(0xA9C0, 0x320F)
+DOUBLE_BYTE_PAIR(0xA9C1, 0x3210)
+DOUBLE_BYTE_PAIR(0xA9C2, 0x3211)
+DOUBLE_BYTE_PAIR(0xA9C3, 0x3212)
+DOUBLE_BYTE_PAIR(0xA9C4, 0x3213)
+DOUBLE_BYTE_PAIR(0xA9C5, 0x3214)
+DOUBLE_BYTE_PAIR(0xA9C6, 0x3215)
+DOUBLE_BYTE_PAIR(0xA9C7, 0x3216)
+DOUBLE_BYTE_PAIR(0xA9C8, 0x3217)
+DOUBLE_BYTE_PAIR(0xA9C9, 0x3218)
+DOUBLE_BYTE_PAIR(0xA9CA, 0x3219)
+DOUBLE_BYTE_PAIR(0xA9CB, 0x321A)
+DOUBLE_BYTE_PAIR(0xA9CC, 0x321B)
+DOUBLE_BYTE_PAIR(0xA9CD, 0x249C)
+DOUBLE_BYTE_PAIR(0xA9CE, 0x249D)
+DOUBLE_BYTE_PAIR(0xA9CF, 0x249E)
+DOUBLE_BYTE_PAIR(0xA9D0, 0x249F)
+DOUBLE_BYTE_PAIR(0xA9D1, 0x24A0)
+DOUBLE_BYTE_PAIR(0xA9D2, 0x24A1)
+DOUBLE_BYTE_PAIR(0xA9D3, 0x24A2)
+DOUBLE_BYTE_PAIR(0xA9D4, 0x24A3)
+DOUBLE_BYTE_PAIR(0xA9D5, 0x24A4)
+DOUBLE_BYTE_PAIR(0xA9D6, 0x24A5)
+DOUBLE_BYTE_PAIR(0xA9D7, 0x24A6)
+DOUBLE_BYTE_PAIR(0xA9D8, 0x24A7)
+DOUBLE_BYTE_PAIR(0xA9D9, 0x24A8)
+DOUBLE_BYTE_PAIR(0xA9DA, 0x24A9)
+DOUBLE_BYTE_PAIR(0xA9DB, 0x24AA)
+DOUBLE_BYTE_PAIR(0xA9DC, 0x24AB)
+DOUBLE_BYTE_PAIR(0xA9DD, 0x24AC)
+DOUBLE_BYTE_PAIR(0xA9DE, 0x24AD)
+DOUBLE_BYTE_PAIR(0xA9DF, 0x24AE)
+DOUBLE_BYTE_PAIR(0xA9E0, 0x24AF)
+DOUBLE_BYTE_PAIR(0xA9E1, 0x24B0)
+DOUBLE_BYTE_PAIR(0xA9E2, 0x24B1)
+DOUBLE_BYTE_PAIR(0xA9E3, 0x24B2)
+DOUBLE_BYTE_PAIR(0xA9E4, 0x24B3)
+DOUBLE_BYTE_PAIR(0xA9E5, 0x24B4)
+DOUBLE_BYTE_PAIR(0xA9E6, 0x24B5)
+DOUBLE_BYTE_PAIR(0xA9E7, 0x2474)
+DOUBLE_BYTE_PAIR(0xA9E8, 0x2475)
+DOUBLE_BYTE_PAIR(0xA9E9, 0x2476)
+DOUBLE_BYTE_PAIR(0xA9EA, 0x2477)
+DOUBLE_BYTE_PAIR(0xA9EB, 0x2478)
+DOUBLE_BYTE_PAIR(0xA9EC, 0x2479)
+DOUBLE_BYTE_PAIR(0xA9ED, 0x247A)
+DOUBLE_BYTE_PAIR(0xA9EE, 0x247B)
+DOUBLE_BYTE_PAIR(0xA9EF, 0x247C)
+DOUBLE_BYTE_PAIR(0xA9F0, 0x247D)
+DOUBLE_BYTE_PAIR(0xA9F1, 0x247E)
+DOUBLE_BYTE_PAIR(0xA9F2, 0x247F)
+DOUBLE_BYTE_PAIR(0xA9F3, 0x2480)
+DOUBLE_BYTE_PAIR(0xA9F4, 0x2481)
+DOUBLE_BYTE_PAIR(0xA9F5, 0x2482)
+DOUBLE_BYTE_PAIR(0xA9F6, 0x00B9)
+DOUBLE_BYTE_PAIR(0xA9F7, 0x00B2)
+DOUBLE_BYTE_PAIR(0xA9F8, 0x00B3)
+DOUBLE_BYTE_PAIR(0xA9F9, 0x2074)
+DOUBLE_BYTE_PAIR(0xA9FA, 0x207F)
+DOUBLE_BYTE_PAIR(0xA9FB, 0x2081)
+DOUBLE_BYTE_PAIR(0xA9FC, 0x2082)
+DOUBLE_BYTE_PAIR(0xA9FD, 0x2083)
+DOUBLE_BYTE_PAIR(0xA9FE, 0x2084)
+DOUBLE_BYTE_PAIR(0xAA41, 0xCC25)
+DOUBLE_BYTE_PAIR(0xAA42, 0xCC26)
+DOUBLE_BYTE_PAIR(0xAA43, 0xCC2A)
+DOUBLE_BYTE_PAIR(0xAA44, 0xCC2B)
+DOUBLE_BYTE_PAIR(0xAA45, 0xCC2D)
+DOUBLE_BYTE_PAIR(0xAA46, 0xCC2F)
+DOUBLE_BYTE_PAIR(0xAA47, 0xCC31)
+DOUBLE_BYTE_PAIR(0xAA48, 0xCC32)
+DOUBLE_BYTE_PAIR(0xAA49, 0xCC33)
+DOUBLE_BYTE_PAIR(0xAA4A, 0xCC34)
+DOUBLE_BYTE_PAIR(0xAA4B, 0xCC35)
+DOUBLE_BYTE_PAIR(0xAA4C, 0xCC36)
+DOUBLE_BYTE_PAIR(0xAA4D, 0xCC37)
+DOUBLE_BYTE_PAIR(0xAA4E, 0xCC3A)
+DOUBLE_BYTE_PAIR(0xAA4F, 0xCC3F)
+DOUBLE_BYTE_PAIR(0xAA50, 0xCC40)
+DOUBLE_BYTE_PAIR(0xAA51, 0xCC41)
+DOUBLE_BYTE_PAIR(0xAA52, 0xCC42)
+DOUBLE_BYTE_PAIR(0xAA53, 0xCC43)
+DOUBLE_BYTE_PAIR(0xAA54, 0xCC46)
+DOUBLE_BYTE_PAIR(0xAA55, 0xCC47)
+DOUBLE_BYTE_PAIR(0xAA56, 0xCC49)
+DOUBLE_BYTE_PAIR(0xAA57, 0xCC4A)
+DOUBLE_BYTE_PAIR(0xAA58, 0xCC4B)
+DOUBLE_BYTE_PAIR(0xAA59, 0xCC4D)
+DOUBLE_BYTE_PAIR(0xAA5A, 0xCC4E)
+DOUBLE_BYTE_PAIR(0xAA61, 0xCC4F)
+DOUBLE_BYTE_PAIR(0xAA62, 0xCC50)
+DOUBLE_BYTE_PAIR(0xAA63, 0xCC51)
+DOUBLE_BYTE_PAIR(0xAA64, 0xCC52)
+DOUBLE_BYTE_PAIR(0xAA65, 0xCC53)
+DOUBLE_BYTE_PAIR(0xAA66, 0xCC56)
+DOUBLE_BYTE_PAIR(0xAA67, 0xCC5A)
+DOUBLE_BYTE_PAIR(0xAA68, 0xCC5B)
+DOUBLE_BYTE_PAIR(0xAA69, 0xCC5C)
+DOUBLE_BYTE_PAIR(0xAA6A, 0xCC5D)
+DOUBLE_BYTE_PAIR(0xAA6B, 0xCC5E)
+DOUBLE_BYTE_PAIR(0xAA6C, 0xCC5F)
+DOUBLE_BYTE_PAIR(0xAA6D, 0xCC61)
+DOUBLE_BYTE_PAIR(0xAA6E, 0xCC62)
+DOUBLE_BYTE_PAIR(0xAA6F, 0xCC63)
+DOUBLE_BYTE_PAIR(0xAA70, 0xCC65)
+DOUBLE_BYTE_PAIR(0xAA71, 0xCC67)
+DOUBLE_BYTE_PAIR(0xAA72, 0xCC69)
+DOUBLE_BYTE_PAIR(0xAA73, 0xCC6A)
+DOUBLE_BYTE_PAIR(0xAA74, 0xCC6B)
+DOUBLE_BYTE_PAIR(0xAA75, 0xCC6C)
+DOUBLE_BYTE_PAIR(0xAA76, 0xCC6D)
+DOUBLE_BYTE_PAIR(0xAA77, 0xCC6E)
+DOUBLE_BYTE_PAIR(0xAA78, 0xCC6F)
+DOUBLE_BYTE_PAIR(0xAA79, 0xCC71)
+DOUBLE_BYTE_PAIR(0xAA7A, 0xCC72)
+DOUBLE_BYTE_PAIR(0xAA81, 0xCC73)
+DOUBLE_BYTE_PAIR(0xAA82, 0xCC74)
+DOUBLE_BYTE_PAIR(0xAA83, 0xCC76)
+DOUBLE_BYTE_PAIR(0xAA84, 0xCC77)
+DOUBLE_BYTE_PAIR(0xAA85, 0xCC78)
+DOUBLE_BYTE_PAIR(0xAA86, 0xCC79)
+DOUBLE_BYTE_PAIR(0xAA87, 0xCC7A)
+DOUBLE_BYTE_PAIR(0xAA88, 0xCC7B)
+DOUBLE_BYTE_PAIR(0xAA89, 0xCC7C)
+DOUBLE_BYTE_PAIR(0xAA8A, 0xCC7D)
+DOUBLE_BYTE_PAIR(0xAA8B, 0xCC7E)
+DOUBLE_BYTE_PAIR(0xAA8C, 0xCC7F)
+DOUBLE_BYTE_PAIR(0xAA8D, 0xCC80)
+DOUBLE_BYTE_PAIR(0xAA8E, 0xCC81)
+DOUBLE_BYTE_PAIR(0xAA8F, 0xCC82)
+DOUBLE_BYTE_PAIR(0xAA90, 0xCC83)
+DOUBLE_BYTE_PAIR(0xAA91, 0xCC84)
+DOUBLE_BYTE_PAIR(0xAA92, 0xCC85)
+DOUBLE_BYTE_PAIR(0xAA93, 0xCC86)
+DOUBLE_BYTE_PAIR(0xAA94, 0xCC87)
+DOUBLE_BYTE_PAIR(0xAA95, 0xCC88)
+DOUBLE_BYTE_PAIR(0xAA96, 0xCC89)
+DOUBLE_BYTE_PAIR(0xAA97, 0xCC8A)
+DOUBLE_BYTE_PAIR(0xAA98, 0xCC8B)
+DOUBLE_BYTE_PAIR(0xAA99, 0xCC8C)
+DOUBLE_BYTE_PAIR(0xAA9A, 0xCC8D)
+DOUBLE_BYTE_PAIR(0xAA9B, 0xCC8E)
+DOUBLE_BYTE_PAIR(0xAA9C, 0xCC8F)
+DOUBLE_BYTE_PAIR(0xAA9D, 0xCC90)
+DOUBLE_BYTE_PAIR(0xAA9E, 0xCC91)
+DOUBLE_BYTE_PAIR(0xAA9F, 0xCC92)
+DOUBLE_BYTE_PAIR(0xAAA0, 0xCC93)
+DOUBLE_BYTE_PAIR(0xAAA1, 0x3041)
+DOUBLE_BYTE_PAIR(0xAAA2, 0x3042)
+DOUBLE_BYTE_PAIR(0xAAA3, 0x3043)
+DOUBLE_BYTE_PAIR(0xAAA4, 0x3044)
+DOUBLE_BYTE_PAIR(0xAAA5, 0x3045)
+DOUBLE_BYTE_PAIR(0xAAA6, 0x3046)
+DOUBLE_BYTE_PAIR(0xAAA7, 0x3047)
+DOUBLE_BYTE_PAIR(0xAAA8, 0x3048)
+DOUBLE_BYTE_PAIR(0xAAA9, 0x3049)
+DOUBLE_BYTE_PAIR(0xAAAA, 0x304A)
+DOUBLE_BYTE_PAIR(0xAAAB, 0x304B)
+DOUBLE_BYTE_PAIR(0xAAAC, 0x304C)
+DOUBLE_BYTE_PAIR(0xAAAD, 0x304D)
+DOUBLE_BYTE_PAIR(0xAAAE, 0x304E)
+DOUBLE_BYTE_PAIR(0xAAAF, 0x304F)
+DOUBLE_BYTE_PAIR(0xAAB0, 0x3050)
+DOUBLE_BYTE_PAIR(0xAAB1, 0x3051)
+DOUBLE_BYTE_PAIR(0xAAB2, 0x3052)
+DOUBLE_BYTE_PAIR(0xAAB3, 0x3053)
+DOUBLE_BYTE_PAIR(0xAAB4, 0x3054)
+DOUBLE_BYTE_PAIR(0xAAB5, 0x3055)
+DOUBLE_BYTE_PAIR(0xAAB6, 0x3056)
+DOUBLE_BYTE_PAIR(0xAAB7, 0x3057)
+DOUBLE_BYTE_PAIR(0xAAB8, 0x3058)
+DOUBLE_BYTE_PAIR(0xAAB9, 0x3059)
+DOUBLE_BYTE_PAIR(0xAABA, 0x305A)
+DOUBLE_BYTE_PAIR(0xAABB, 0x305B)
+DOUBLE_BYTE_PAIR(0xAABC, 0x305C)
+DOUBLE_BYTE_PAIR(0xAABD, 0x305D)
+DOUBLE_BYTE_PAIR(0xAABE, 0x305E)
+DOUBLE_BYTE_PAIR(0xAABF, 0x305F)
+DOUBLE_BYTE_PAIR(0xAAC0, 0x3060)
+DOUBLE_BYTE_PAIR(0xAAC1, 0x3061)
+DOUBLE_BYTE_PAIR(0xAAC2, 0x3062)
+DOUBLE_BYTE_PAIR(0xAAC3, 0x3063)
+DOUBLE_BYTE_PAIR(0xAAC4, 0x3064)
+DOUBLE_BYTE_PAIR(0xAAC5, 0x3065)
+DOUBLE_BYTE_PAIR(0xAAC6, 0x3066)
+DOUBLE_BYTE_PAIR(0xAAC7, 0x3067)
+DOUBLE_BYTE_PAIR(0xAAC8, 0x3068)
+DOUBLE_BYTE_PAIR(0xAAC9, 0x3069)
+DOUBLE_BYTE_PAIR(0xAACA, 0x306A)
+DOUBLE_BYTE_PAIR(0xAACB, 0x306B)
+DOUBLE_BYTE_PAIR(0xAACC, 0x306C)
+DOUBLE_BYTE_PAIR(0xAACD, 0x306D)
+DOUBLE_BYTE_PAIR(0xAACE, 0x306E)
+DOUBLE_BYTE_PAIR(0xAACF, 0x306F)
+DOUBLE_BYTE_PAIR(0xAAD0, 0x3070)
+DOUBLE_BYTE_PAIR(0xAAD1, 0x3071)
+DOUBLE_BYTE_PAIR(0xAAD2, 0x3072)
+DOUBLE_BYTE_PAIR(0xAAD3, 0x3073)
+DOUBLE_BYTE_PAIR(0xAAD4, 0x3074)
+DOUBLE_BYTE_PAIR(0xAAD5, 0x3075)
+DOUBLE_BYTE_PAIR(0xAAD6, 0x3076)
+DOUBLE_BYTE_PAIR(0xAAD7, 0x3077)
+DOUBLE_BYTE_PAIR(0xAAD8, 0x3078)
+DOUBLE_BYTE_PAIR(0xAAD9, 0x3079)
+DOUBLE_BYTE_PAIR(0xAADA, 0x307A)
+DOUBLE_BYTE_PAIR(0xAADB, 0x307B)
+DOUBLE_BYTE_PAIR(0xAADC, 0x307C)
+DOUBLE_BYTE_PAIR(0xAADD, 0x307D)
+DOUBLE_BYTE_PAIR(0xAADE, 0x307E)
+DOUBLE_BYTE_PAIR(0xAADF, 0x307F)
+DOUBLE_BYTE_PAIR(0xAAE0, 0x3080)
+DOUBLE_BYTE_PAIR(0xAAE1, 0x3081)
+DOUBLE_BYTE_PAIR(0xAAE2, 0x3082)
+DOUBLE_BYTE_PAIR(0xAAE3, 0x3083)
+DOUBLE_BYTE_PAIR(0xAAE4, 0x3084)
+DOUBLE_BYTE_PAIR(0xAAE5, 0x3085)
+DOUBLE_BYTE_PAIR(0xAAE6, 0x3086)
+DOUBLE_BYTE_PAIR(0xAAE7, 0x3087)
+DOUBLE_BYTE_PAIR(0xAAE8, 0x3088)
+DOUBLE_BYTE_PAIR(0xAAE9, 0x3089)
+DOUBLE_BYTE_PAIR(0xAAEA, 0x308A)
+DOUBLE_BYTE_PAIR(0xAAEB, 0x308B)
+DOUBLE_BYTE_PAIR(0xAAEC, 0x308C)
+DOUBLE_BYTE_PAIR(0xAAED, 0x308D)
+DOUBLE_BYTE_PAIR(0xAAEE, 0x308E)
+DOUBLE_BYTE_PAIR(0xAAEF, 0x308F)
+DOUBLE_BYTE_PAIR(0xAAF0, 0x3090)
+DOUBLE_BYTE_PAIR(0xAAF1, 0x3091)
+DOUBLE_BYTE_PAIR(0xAAF2, 0x3092)
+DOUBLE_BYTE_PAIR(0xAAF3, 0x3093)
+DOUBLE_BYTE_PAIR(0xAB41, 0xCC94)
+DOUBLE_BYTE_PAIR(0xAB42, 0xCC95)
+DOUBLE_BYTE_PAIR(0xAB43, 0xCC96)
+DOUBLE_BYTE_PAIR(0xAB44, 0xCC97)
+DOUBLE_BYTE_PAIR(0xAB45, 0xCC9A)
+DOUBLE_BYTE_PAIR(0xAB46, 0xCC9B)
+DOUBLE_BYTE_PAIR(0xAB47, 0xCC9D)
+DOUBLE_BYTE_PAIR(0xAB48, 0xCC9E)
+DOUBLE_BYTE_PAIR(0xAB49, 0xCC9F)
+DOUBLE_BYTE_PAIR(0xAB4A, 0xCCA1)
+DOUBLE_BYTE_PAIR(0xAB4B, 0xCCA2)
+DOUBLE_BYTE_PAIR(0xAB4C, 0xCCA3)
+DOUBLE_BYTE_PAIR(0xAB4D, 0xCCA4)
+DOUBLE_BYTE_PAIR(0xAB4E, 0xCCA5)
+DOUBLE_BYTE_PAIR(0xAB4F, 0xCCA6)
+DOUBLE_BYTE_PAIR(0xAB50, 0xCCA7)
+DOUBLE_BYTE_PAIR(0xAB51, 0xCCAA)
+DOUBLE_BYTE_PAIR(0xAB52, 0xCCAE)
+DOUBLE_BYTE_PAIR(0xAB53, 0xCCAF)
+DOUBLE_BYTE_PAIR(0xAB54, 0xCCB0)
+DOUBLE_BYTE_PAIR(0xAB55, 0xCCB1)
+DOUBLE_BYTE_PAIR(0xAB56, 0xCCB2)
+DOUBLE_BYTE_PAIR(0xAB57, 0xCCB3)
+DOUBLE_BYTE_PAIR(0xAB58, 0xCCB6)
+DOUBLE_BYTE_PAIR(0xAB59, 0xCCB7)
+DOUBLE_BYTE_PAIR(0xAB5A, 0xCCB9)
+DOUBLE_BYTE_PAIR(0xAB61, 0xCCBA)
+DOUBLE_BYTE_PAIR(0xAB62, 0xCCBB)
+DOUBLE_BYTE_PAIR(0xAB63, 0xCCBD)
+DOUBLE_BYTE_PAIR(0xAB64, 0xCCBE)
+DOUBLE_BYTE_PAIR(0xAB65, 0xCCBF)
+DOUBLE_BYTE_PAIR(0xAB66, 0xCCC0)
+DOUBLE_BYTE_PAIR(0xAB67, 0xCCC1)
+DOUBLE_BYTE_PAIR(0xAB68, 0xCCC2)
+DOUBLE_BYTE_PAIR(0xAB69, 0xCCC3)
+DOUBLE_BYTE_PAIR(0xAB6A, 0xCCC6)
+DOUBLE_BYTE_PAIR(0xAB6B, 0xCCC8)
+DOUBLE_BYTE_PAIR(0xAB6C, 0xCCCA)
+DOUBLE_BYTE_PAIR(0xAB6D, 0xCCCB)
+DOUBLE_BYTE_PAIR(0xAB6E, 0xCCCC)
+DOUBLE_BYTE_PAIR(0xAB6F, 0xCCCD)
+DOUBLE_BYTE_PAIR(0xAB70, 0xCCCE)
+DOUBLE_BYTE_PAIR(0xAB71, 0xCCCF)
+DOUBLE_BYTE_PAIR(0xAB72, 0xCCD1)
+DOUBLE_BYTE_PAIR(0xAB73, 0xCCD2)
+DOUBLE_BYTE_PAIR(0xAB74, 0xCCD3)
+DOUBLE_BYTE_PAIR(0xAB75, 0xCCD5)
+DOUBLE_BYTE_PAIR(0xAB76, 0xCCD6)
+DOUBLE_BYTE_PAIR(0xAB77, 0xCCD7)
+DOUBLE_BYTE_PAIR(0xAB78, 0xCCD8)
+DOUBLE_BYTE_PAIR(0xAB79, 0xCCD9)
+DOUBLE_BYTE_PAIR(0xAB7A, 0xCCDA)
+DOUBLE_BYTE_PAIR(0xAB81, 0xCCDB)
+DOUBLE_BYTE_PAIR(0xAB82, 0xCCDC)
+DOUBLE_BYTE_PAIR(0xAB83, 0xCCDD)
+DOUBLE_BYTE_PAIR(0xAB84, 0xCCDE)
+DOUBLE_BYTE_PAIR(0xAB85, 0xCCDF)
+DOUBLE_BYTE_PAIR(0xAB86, 0xCCE0)
+DOUBLE_BYTE_PAIR(0xAB87, 0xCCE1)
+DOUBLE_BYTE_PAIR(0xAB88, 0xCCE2)
+DOUBLE_BYTE_PAIR(0xAB89, 0xCCE3)
+DOUBLE_BYTE_PAIR(0xAB8A, 0xCCE5)
+DOUBLE_BYTE_PAIR(0xAB8B, 0xCCE6)
+DOUBLE_BYTE_PAIR(0xAB8C, 0xCCE7)
+DOUBLE_BYTE_PAIR(0xAB8D, 0xCCE8)
+DOUBLE_BYTE_PAIR(0xAB8E, 0xCCE9)
+DOUBLE_BYTE_PAIR(0xAB8F, 0xCCEA)
+DOUBLE_BYTE_PAIR(0xAB90, 0xCCEB)
+DOUBLE_BYTE_PAIR(0xAB91, 0xCCED)
+DOUBLE_BYTE_PAIR(0xAB92, 0xCCEE)
+DOUBLE_BYTE_PAIR(0xAB93, 0xCCEF)
+DOUBLE_BYTE_PAIR(0xAB94, 0xCCF1)
+DOUBLE_BYTE_PAIR(0xAB95, 0xCCF2)
+DOUBLE_BYTE_PAIR(0xAB96, 0xCCF3)
+DOUBLE_BYTE_PAIR(0xAB97, 0xCCF4)
+DOUBLE_BYTE_PAIR(0xAB98, 0xCCF5)
+DOUBLE_BYTE_PAIR(0xAB99, 0xCCF6)
+DOUBLE_BYTE_PAIR(0xAB9A, 0xCCF7)
+DOUBLE_BYTE_PAIR(0xAB9B, 0xCCF8)
+DOUBLE_BYTE_PAIR(0xAB9C, 0xCCF9)
+DOUBLE_BYTE_PAIR(0xAB9D, 0xCCFA)
+DOUBLE_BYTE_PAIR(0xAB9E, 0xCCFB)
+DOUBLE_BYTE_PAIR(0xAB9F, 0xCCFC)
+DOUBLE_BYTE_PAIR(0xABA0, 0xCCFD)
+DOUBLE_BYTE_PAIR(0xABA1, 0x30A1)
+DOUBLE_BYTE_PAIR(0xABA2, 0x30A2)
+DOUBLE_BYTE_PAIR(0xABA3, 0x30A3)
+DOUBLE_BYTE_PAIR(0xABA4, 0x30A4)
+DOUBLE_BYTE_PAIR(0xABA5, 0x30A5)
+DOUBLE_BYTE_PAIR(0xABA6, 0x30A6)
+DOUBLE_BYTE_PAIR(0xABA7, 0x30A7)
+DOUBLE_BYTE_PAIR(0xABA8, 0x30A8)
+DOUBLE_BYTE_PAIR(0xABA9, 0x30A9)
+DOUBLE_BYTE_PAIR(0xABAA, 0x30AA)
+DOUBLE_BYTE_PAIR(0xABAB, 0x30AB)
+DOUBLE_BYTE_PAIR(0xABAC, 0x30AC)
+DOUBLE_BYTE_PAIR(0xABAD, 0x30AD)
+DOUBLE_BYTE_PAIR(0xABAE, 0x30AE)
+DOUBLE_BYTE_PAIR(0xABAF, 0x30AF)
+DOUBLE_BYTE_PAIR(0xABB0, 0x30B0)
+DOUBLE_BYTE_PAIR(0xABB1, 0x30B1)
+DOUBLE_BYTE_PAIR(0xABB2, 0x30B2)
+DOUBLE_BYTE_PAIR(0xABB3, 0x30B3)
+DOUBLE_BYTE_PAIR(0xABB4, 0x30B4)
+DOUBLE_BYTE_PAIR(0xABB5, 0x30B5)
+DOUBLE_BYTE_PAIR(0xABB6, 0x30B6)
+DOUBLE_BYTE_PAIR(0xABB7, 0x30B7)
+DOUBLE_BYTE_PAIR(0xABB8, 0x30B8)
+DOUBLE_BYTE_PAIR(0xABB9, 0x30B9)
+DOUBLE_BYTE_PAIR(0xABBA, 0x30BA)
+DOUBLE_BYTE_PAIR(0xABBB, 0x30BB)
+DOUBLE_BYTE_PAIR(0xABBC, 0x30BC)
+DOUBLE_BYTE_PAIR(0xABBD, 0x30BD)
+DOUBLE_BYTE_PAIR(0xABBE, 0x30BE)
+DOUBLE_BYTE_PAIR(0xABBF, 0x30BF)
+DOUBLE_BYTE_PAIR(0xABC0, 0x30C0)
+DOUBLE_BYTE_PAIR(0xABC1, 0x30C1)
+DOUBLE_BYTE_PAIR(0xABC2, 0x30C2)
+DOUBLE_BYTE_PAIR(0xABC3, 0x30C3)
+DOUBLE_BYTE_PAIR(0xABC4, 0x30C4)
+DOUBLE_BYTE_PAIR(0xABC5, 0x30C5)
+DOUBLE_BYTE_PAIR(0xABC6, 0x30C6)
+DOUBLE_BYTE_PAIR(0xABC7, 0x30C7)
+DOUBLE_BYTE_PAIR(0xABC8, 0x30C8)
+DOUBLE_BYTE_PAIR(0xABC9, 0x30C9)
+DOUBLE_BYTE_PAIR(0xABCA, 0x30CA)
+DOUBLE_BYTE_PAIR(0xABCB, 0x30CB)
+DOUBLE_BYTE_PAIR(0xABCC, 0x30CC)
+DOUBLE_BYTE_PAIR(0xABCD, 0x30CD)
+DOUBLE_BYTE_PAIR(0xABCE, 0x30CE)
+DOUBLE_BYTE_PAIR(0xABCF, 0x30CF)
+DOUBLE_BYTE_PAIR(0xABD0, 0x30D0)
+DOUBLE_BYTE_PAIR(0xABD1, 0x30D1)
+DOUBLE_BYTE_PAIR(0xABD2, 0x30D2)
+DOUBLE_BYTE_PAIR(0xABD3, 0x30D3)
+DOUBLE_BYTE_PAIR(0xABD4, 0x30D4)
+DOUBLE_BYTE_PAIR(0xABD5, 0x30D5)
+DOUBLE_BYTE_PAIR(0xABD6, 0x30D6)
+DOUBLE_BYTE_PAIR(0xABD7, 0x30D7)
+DOUBLE_BYTE_PAIR(0xABD8, 0x30D8)
+DOUBLE_BYTE_PAIR(0xABD9, 0x30D9)
+DOUBLE_BYTE_PAIR(0xABDA, 0x30DA)
+DOUBLE_BYTE_PAIR(0xABDB, 0x30DB)
+DOUBLE_BYTE_PAIR(0xABDC, 0x30DC)
+DOUBLE_BYTE_PAIR(0xABDD, 0x30DD)
+DOUBLE_BYTE_PAIR(0xABDE, 0x30DE)
+DOUBLE_BYTE_PAIR(0xABDF, 0x30DF)
+DOUBLE_BYTE_PAIR(0xABE0, 0x30E0)
+DOUBLE_BYTE_PAIR(0xABE1, 0x30E1)
+DOUBLE_BYTE_PAIR(0xABE2, 0x30E2)
+DOUBLE_BYTE_PAIR(0xABE3, 0x30E3)
+DOUBLE_BYTE_PAIR(0xABE4, 0x30E4)
+DOUBLE_BYTE_PAIR(0xABE5, 0x30E5)
+DOUBLE_BYTE_PAIR(0xABE6, 0x30E6)
+DOUBLE_BYTE_PAIR(0xABE7, 0x30E7)
+DOUBLE_BYTE_PAIR(0xABE8, 0x30E8)
+DOUBLE_BYTE_PAIR(0xABE9, 0x30E9)
+DOUBLE_BYTE_PAIR(0xABEA, 0x30EA)
+DOUBLE_BYTE_PAIR(0xABEB, 0x30EB)
+DOUBLE_BYTE_PAIR(0xABEC, 0x30EC)
+DOUBLE_BYTE_PAIR(0xABED, 0x30ED)
+DOUBLE_BYTE_PAIR(0xABEE, 0x30EE)
+DOUBLE_BYTE_PAIR(0xABEF, 0x30EF)
+DOUBLE_BYTE_PAIR(0xABF0, 0x30F0)
+DOUBLE_BYTE_PAIR(0xABF1, 0x30F1)
+DOUBLE_BYTE_PAIR(0xABF2, 0x30F2)
+DOUBLE_BYTE_PAIR(0xABF3, 0x30F3)
+DOUBLE_BYTE_PAIR(0xABF4, 0x30F4)
+DOUBLE_BYTE_PAIR(0xABF5, 0x30F5)
+DOUBLE_BYTE_PAIR(0xABF6, 0x30F6)
+DOUBLE_BYTE_PAIR(0xAC41, 0xCCFE)
+DOUBLE_BYTE_PAIR(0xAC42, 0xCCFF)
+DOUBLE_BYTE_PAIR(0xAC43, 0xCD00)
+DOUBLE_BYTE_PAIR(0xAC44, 0xCD02)
+DOUBLE_BYTE_PAIR(0xAC45, 0xCD03)
+DOUBLE_BYTE_PAIR(0xAC46, 0xCD04)
+DOUBLE_BYTE_PAIR(0xAC47, 0xCD05)
+DOUBLE_BYTE_PAIR(0xAC48, 0xCD06)
+DOUBLE_BYTE_PAIR(0xAC49, 0xCD07)
+DOUBLE_BYTE_PAIR(0xAC4A, 0xCD0A)
+DOUBLE_BYTE_PAIR(0xAC4B, 0xCD0B)
+DOUBLE_BYTE_PAIR(0xAC4C, 0xCD0D)
+DOUBLE_BYTE_PAIR(0xAC4D, 0xCD0E)
+DOUBLE_BYTE_PAIR(0xAC4E, 0xCD0F)
+DOUBLE_BYTE_PAIR(0xAC4F, 0xCD11)
+DOUBLE_BYTE_PAIR(0xAC50, 0xCD12)
+DOUBLE_BYTE_PAIR(0xAC51, 0xCD13)
+DOUBLE_BYTE_PAIR(0xAC52, 0xCD14)
+DOUBLE_BYTE_PAIR(0xAC53, 0xCD15)
+DOUBLE_BYTE_PAIR(0xAC54, 0xCD16)
+DOUBLE_BYTE_PAIR(0xAC55, 0xCD17)
+DOUBLE_BYTE_PAIR(0xAC56, 0xCD1A)
+DOUBLE_BYTE_PAIR(0xAC57, 0xCD1C)
+DOUBLE_BYTE_PAIR(0xAC58, 0xCD1E)
+DOUBLE_BYTE_PAIR(0xAC59, 0xCD1F)
+DOUBLE_BYTE_PAIR(0xAC5A, 0xCD20)
+DOUBLE_BYTE_PAIR(0xAC61, 0xCD21)
+DOUBLE_BYTE_PAIR(0xAC62, 0xCD22)
+DOUBLE_BYTE_PAIR(0xAC63, 0xCD23)
+DOUBLE_BYTE_PAIR(0xAC64, 0xCD25)
+DOUBLE_BYTE_PAIR(0xAC65, 0xCD26)
+DOUBLE_BYTE_PAIR(0xAC66, 0xCD27)
+DOUBLE_BYTE_PAIR(0xAC67, 0xCD29)
+DOUBLE_BYTE_PAIR(0xAC68, 0xCD2A)
+DOUBLE_BYTE_PAIR(0xAC69, 0xCD2B)
+DOUBLE_BYTE_PAIR(0xAC6A, 0xCD2D)
+DOUBLE_BYTE_PAIR(0xAC6B, 0xCD2E)
+DOUBLE_BYTE_PAIR(0xAC6C, 0xCD2F)
+DOUBLE_BYTE_PAIR(0xAC6D, 0xCD30)
+DOUBLE_BYTE_PAIR(0xAC6E, 0xCD31)
+DOUBLE_BYTE_PAIR(0xAC6F, 0xCD32)
+DOUBLE_BYTE_PAIR(0xAC70, 0xCD33)
+DOUBLE_BYTE_PAIR(0xAC71, 0xCD34)
+DOUBLE_BYTE_PAIR(0xAC72, 0xCD35)
+DOUBLE_BYTE_PAIR(0xAC73, 0xCD36)
+DOUBLE_BYTE_PAIR(0xAC74, 0xCD37)
+DOUBLE_BYTE_PAIR(0xAC75, 0xCD38)
+DOUBLE_BYTE_PAIR(0xAC76, 0xCD3A)
+DOUBLE_BYTE_PAIR(0xAC77, 0xCD3B)
+DOUBLE_BYTE_PAIR(0xAC78, 0xCD3C)
+DOUBLE_BYTE_PAIR(0xAC79, 0xCD3D)
+DOUBLE_BYTE_PAIR(0xAC7A, 0xCD3E)
+DOUBLE_BYTE_PAIR(0xAC81, 0xCD3F)
+DOUBLE_BYTE_PAIR(0xAC82, 0xCD40)
+DOUBLE_BYTE_PAIR(0xAC83, 0xCD41)
+DOUBLE_BYTE_PAIR(0xAC84, 0xCD42)
+DOUBLE_BYTE_PAIR(0xAC85, 0xCD43)
+DOUBLE_BYTE_PAIR(0xAC86, 0xCD44)
+DOUBLE_BYTE_PAIR(0xAC87, 0xCD45)
+DOUBLE_BYTE_PAIR(0xAC88, 0xCD46)
+DOUBLE_BYTE_PAIR(0xAC89, 0xCD47)
+DOUBLE_BYTE_PAIR(0xAC8A, 0xCD48)
+DOUBLE_BYTE_PAIR(0xAC8B, 0xCD49)
+DOUBLE_BYTE_PAIR(0xAC8C, 0xCD4A)
+DOUBLE_BYTE_PAIR(0xAC8D, 0xCD4B)
+DOUBLE_BYTE_PAIR(0xAC8E, 0xCD4C)
+DOUBLE_BYTE_PAIR(0xAC8F, 0xCD4D)
+DOUBLE_BYTE_PAIR(0xAC90, 0xCD4E)
+DOUBLE_BYTE_PAIR(0xAC91, 0xCD4F)
+DOUBLE_BYTE_PAIR(0xAC92, 0xCD50)
+DOUBLE_BYTE_PAIR(0xAC93, 0xCD51)
+DOUBLE_BYTE_PAIR(0xAC94, 0xCD52)
+DOUBLE_BYTE_PAIR(0xAC95, 0xCD53)
+DOUBLE_BYTE_PAIR(0xAC96, 0xCD54)
+DOUBLE_BYTE_PAIR(0xAC97, 0xCD55)
+DOUBLE_BYTE_PAIR(0xAC98, 0xCD56)
+DOUBLE_BYTE_PAIR(0xAC99, 0xCD57)
+DOUBLE_BYTE_PAIR(0xAC9A, 0xCD58)
+DOUBLE_BYTE_PAIR(0xAC9B, 0xCD59)
+DOUBLE_BYTE_PAIR(0xAC9C, 0xCD5A)
+DOUBLE_BYTE_PAIR(0xAC9D, 0xCD5B)
+DOUBLE_BYTE_PAIR(0xAC9E, 0xCD5D)
+DOUBLE_BYTE_PAIR(0xAC9F, 0xCD5E)
+DOUBLE_BYTE_PAIR(0xACA0, 0xCD5F)
+DOUBLE_BYTE_PAIR(0xACA1, 0x0410)
+DOUBLE_BYTE_PAIR(0xACA2, 0x0411)
+DOUBLE_BYTE_PAIR(0xACA3, 0x0412)
+DOUBLE_BYTE_PAIR(0xACA4, 0x0413)
+DOUBLE_BYTE_PAIR(0xACA5, 0x0414)
+DOUBLE_BYTE_PAIR(0xACA6, 0x0415)
+DOUBLE_BYTE_PAIR(0xACA7, 0x0401)
+DOUBLE_BYTE_PAIR(0xACA8, 0x0416)
+DOUBLE_BYTE_PAIR(0xACA9, 0x0417)
+DOUBLE_BYTE_PAIR(0xACAA, 0x0418)
+DOUBLE_BYTE_PAIR(0xACAB, 0x0419)
+DOUBLE_BYTE_PAIR(0xACAC, 0x041A)
+DOUBLE_BYTE_PAIR(0xACAD, 0x041B)
+DOUBLE_BYTE_PAIR(0xACAE, 0x041C)
+DOUBLE_BYTE_PAIR(0xACAF, 0x041D)
+DOUBLE_BYTE_PAIR(0xACB0, 0x041E)
+DOUBLE_BYTE_PAIR(0xACB1, 0x041F)
+DOUBLE_BYTE_PAIR(0xACB2, 0x0420)
+DOUBLE_BYTE_PAIR(0xACB3, 0x0421)
+DOUBLE_BYTE_PAIR(0xACB4, 0x0422)
+DOUBLE_BYTE_PAIR(0xACB5, 0x0423)
+DOUBLE_BYTE_PAIR(0xACB6, 0x0424)
+DOUBLE_BYTE_PAIR(0xACB7, 0x0425)
+DOUBLE_BYTE_PAIR(0xACB8, 0x0426)
+DOUBLE_BYTE_PAIR(0xACB9, 0x0427)
+DOUBLE_BYTE_PAIR(0xACBA, 0x0428)
+DOUBLE_BYTE_PAIR(0xACBB, 0x0429)
+DOUBLE_BYTE_PAIR(0xACBC, 0x042A)
+DOUBLE_BYTE_PAIR(0xACBD, 0x042B)
+DOUBLE_BYTE_PAIR(0xACBE, 0x042C)
+DOUBLE_BYTE_PAIR(0xACBF, 0x042D)
+DOUBLE_BYTE_PAIR(0xACC0, 0x042E)
+DOUBLE_BYTE_PAIR(0xACC1, 0x042F)
+DOUBLE_BYTE_PAIR(0xACD1, 0x0430)
+DOUBLE_BYTE_PAIR(0xACD2, 0x0431)
+DOUBLE_BYTE_PAIR(0xACD3, 0x0432)
+DOUBLE_BYTE_PAIR(0xACD4, 0x0433)
+DOUBLE_BYTE_PAIR(0xACD5, 0x0434)
+DOUBLE_BYTE_PAIR(0xACD6, 0x0435)
+DOUBLE_BYTE_PAIR(0xACD7, 0x0451)
+DOUBLE_BYTE_PAIR(0xACD8, 0x0436)
+DOUBLE_BYTE_PAIR(0xACD9, 0x0437)
+DOUBLE_BYTE_PAIR(0xACDA, 0x0438)
+DOUBLE_BYTE_PAIR(0xACDB, 0x0439)
+DOUBLE_BYTE_PAIR(0xACDC, 0x043A)
+DOUBLE_BYTE_PAIR(0xACDD, 0x043B)
+DOUBLE_BYTE_PAIR(0xACDE, 0x043C)
+DOUBLE_BYTE_PAIR(0xACDF, 0x043D)
+DOUBLE_BYTE_PAIR(0xACE0, 0x043E)
+DOUBLE_BYTE_PAIR(0xACE1, 0x043F)
+DOUBLE_BYTE_PAIR(0xACE2, 0x0440)
+DOUBLE_BYTE_PAIR(0xACE3, 0x0441)
+DOUBLE_BYTE_PAIR(0xACE4, 0x0442)
+DOUBLE_BYTE_PAIR(0xACE5, 0x0443)
+DOUBLE_BYTE_PAIR(0xACE6, 0x0444)
+DOUBLE_BYTE_PAIR(0xACE7, 0x0445)
+DOUBLE_BYTE_PAIR(0xACE8, 0x0446)
+DOUBLE_BYTE_PAIR(0xACE9, 0x0447)
+DOUBLE_BYTE_PAIR(0xACEA, 0x0448)
+DOUBLE_BYTE_PAIR(0xACEB, 0x0449)
+DOUBLE_BYTE_PAIR(0xACEC, 0x044A)
+DOUBLE_BYTE_PAIR(0xACED, 0x044B)
+DOUBLE_BYTE_PAIR(0xACEE, 0x044C)
+DOUBLE_BYTE_PAIR(0xACEF, 0x044D)
+DOUBLE_BYTE_PAIR(0xACF0, 0x044E)
+DOUBLE_BYTE_PAIR(0xACF1, 0x044F)
+DOUBLE_BYTE_PAIR(0xAD41, 0xCD61)
+DOUBLE_BYTE_PAIR(0xAD42, 0xCD62)
+DOUBLE_BYTE_PAIR(0xAD43, 0xCD63)
+DOUBLE_BYTE_PAIR(0xAD44, 0xCD65)
+DOUBLE_BYTE_PAIR(0xAD45, 0xCD66)
+DOUBLE_BYTE_PAIR(0xAD46, 0xCD67)
+DOUBLE_BYTE_PAIR(0xAD47, 0xCD68)
+DOUBLE_BYTE_PAIR(0xAD48, 0xCD69)
+DOUBLE_BYTE_PAIR(0xAD49, 0xCD6A)
+DOUBLE_BYTE_PAIR(0xAD4A, 0xCD6B)
+DOUBLE_BYTE_PAIR(0xAD4B, 0xCD6E)
+DOUBLE_BYTE_PAIR(0xAD4C, 0xCD70)
+DOUBLE_BYTE_PAIR(0xAD4D, 0xCD72)
+DOUBLE_BYTE_PAIR(0xAD4E, 0xCD73)
+DOUBLE_BYTE_PAIR(0xAD4F, 0xCD74)
+DOUBLE_BYTE_PAIR(0xAD50, 0xCD75)
+DOUBLE_BYTE_PAIR(0xAD51, 0xCD76)
+DOUBLE_BYTE_PAIR(0xAD52, 0xCD77)
+DOUBLE_BYTE_PAIR(0xAD53, 0xCD79)
+DOUBLE_BYTE_PAIR(0xAD54, 0xCD7A)
+DOUBLE_BYTE_PAIR(0xAD55, 0xCD7B)
+DOUBLE_BYTE_PAIR(0xAD56, 0xCD7C)
+DOUBLE_BYTE_PAIR(0xAD57, 0xCD7D)
+DOUBLE_BYTE_PAIR(0xAD58, 0xCD7E)
+DOUBLE_BYTE_PAIR(0xAD59, 0xCD7F)
+DOUBLE_BYTE_PAIR(0xAD5A, 0xCD80)
+DOUBLE_BYTE_PAIR(0xAD61, 0xCD81)
+DOUBLE_BYTE_PAIR(0xAD62, 0xCD82)
+DOUBLE_BYTE_PAIR(0xAD63, 0xCD83)
+DOUBLE_BYTE_PAIR(0xAD64, 0xCD84)
+DOUBLE_BYTE_PAIR(0xAD65, 0xCD85)
+DOUBLE_BYTE_PAIR(0xAD66, 0xCD86)
+DOUBLE_BYTE_PAIR(0xAD67, 0xCD87)
+DOUBLE_BYTE_PAIR(0xAD68, 0xCD89)
+DOUBLE_BYTE_PAIR(0xAD69, 0xCD8A)
+DOUBLE_BYTE_PAIR(0xAD6A, 0xCD8B)
+DOUBLE_BYTE_PAIR(0xAD6B, 0xCD8C)
+DOUBLE_BYTE_PAIR(0xAD6C, 0xCD8D)
+DOUBLE_BYTE_PAIR(0xAD6D, 0xCD8E)
+DOUBLE_BYTE_PAIR(0xAD6E, 0xCD8F)
+DOUBLE_BYTE_PAIR(0xAD6F, 0xCD90)
+DOUBLE_BYTE_PAIR(0xAD70, 0xCD91)
+DOUBLE_BYTE_PAIR(0xAD71, 0xCD92)
+DOUBLE_BYTE_PAIR(0xAD72, 0xCD93)
+DOUBLE_BYTE_PAIR(0xAD73, 0xCD96)
+DOUBLE_BYTE_PAIR(0xAD74, 0xCD97)
+DOUBLE_BYTE_PAIR(0xAD75, 0xCD99)
+DOUBLE_BYTE_PAIR(0xAD76, 0xCD9A)
+DOUBLE_BYTE_PAIR(0xAD77, 0xCD9B)
+DOUBLE_BYTE_PAIR(0xAD78, 0xCD9D)
+DOUBLE_BYTE_PAIR(0xAD79, 0xCD9E)
+DOUBLE_BYTE_PAIR(0xAD7A, 0xCD9F)
+DOUBLE_BYTE_PAIR(0xAD81, 0xCDA0)
+DOUBLE_BYTE_PAIR(0xAD82, 0xCDA1)
+DOUBLE_BYTE_PAIR(0xAD83, 0xCDA2)
+DOUBLE_BYTE_PAIR(0xAD84, 0xCDA3)
+DOUBLE_BYTE_PAIR(0xAD85, 0xCDA6)
+DOUBLE_BYTE_PAIR(0xAD86, 0xCDA8)
+DOUBLE_BYTE_PAIR(0xAD87, 0xCDAA)
+DOUBLE_BYTE_PAIR(0xAD88, 0xCDAB)
+DOUBLE_BYTE_PAIR(0xAD89, 0xCDAC)
+DOUBLE_BYTE_PAIR(0xAD8A, 0xCDAD)
+DOUBLE_BYTE_PAIR(0xAD8B, 0xCDAE)
+DOUBLE_BYTE_PAIR(0xAD8C, 0xCDAF)
+DOUBLE_BYTE_PAIR(0xAD8D, 0xCDB1)
+DOUBLE_BYTE_PAIR(0xAD8E, 0xCDB2)
+DOUBLE_BYTE_PAIR(0xAD8F, 0xCDB3)
+DOUBLE_BYTE_PAIR(0xAD90, 0xCDB4)
+DOUBLE_BYTE_PAIR(0xAD91, 0xCDB5)
+DOUBLE_BYTE_PAIR(0xAD92, 0xCDB6)
+DOUBLE_BYTE_PAIR(0xAD93, 0xCDB7)
+DOUBLE_BYTE_PAIR(0xAD94, 0xCDB8)
+DOUBLE_BYTE_PAIR(0xAD95, 0xCDB9)
+DOUBLE_BYTE_PAIR(0xAD96, 0xCDBA)
+DOUBLE_BYTE_PAIR(0xAD97, 0xCDBB)
+DOUBLE_BYTE_PAIR(0xAD98, 0xCDBC)
+DOUBLE_BYTE_PAIR(0xAD99, 0xCDBD)
+DOUBLE_BYTE_PAIR(0xAD9A, 0xCDBE)
+DOUBLE_BYTE_PAIR(0xAD9B, 0xCDBF)
+DOUBLE_BYTE_PAIR(0xAD9C, 0xCDC0)
+DOUBLE_BYTE_PAIR(0xAD9D, 0xCDC1)
+DOUBLE_BYTE_PAIR(0xAD9E, 0xCDC2)
+DOUBLE_BYTE_PAIR(0xAD9F, 0xCDC3)
+DOUBLE_BYTE_PAIR(0xADA0, 0xCDC5)
+DOUBLE_BYTE_PAIR(0xAE41, 0xCDC6)
+DOUBLE_BYTE_PAIR(0xAE42, 0xCDC7)
+DOUBLE_BYTE_PAIR(0xAE43, 0xCDC8)
+DOUBLE_BYTE_PAIR(0xAE44, 0xCDC9)
+DOUBLE_BYTE_PAIR(0xAE45, 0xCDCA)
+DOUBLE_BYTE_PAIR(0xAE46, 0xCDCB)
+DOUBLE_BYTE_PAIR(0xAE47, 0xCDCD)
+DOUBLE_BYTE_PAIR(0xAE48, 0xCDCE)
+DOUBLE_BYTE_PAIR(0xAE49, 0xCDCF)
+DOUBLE_BYTE_PAIR(0xAE4A, 0xCDD1)
+DOUBLE_BYTE_PAIR(0xAE4B, 0xCDD2)
+DOUBLE_BYTE_PAIR(0xAE4C, 0xCDD3)
+DOUBLE_BYTE_PAIR(0xAE4D, 0xCDD4)
+DOUBLE_BYTE_PAIR(0xAE4E, 0xCDD5)
+DOUBLE_BYTE_PAIR(0xAE4F, 0xCDD6)
+DOUBLE_BYTE_PAIR(0xAE50, 0xCDD7)
+DOUBLE_BYTE_PAIR(0xAE51, 0xCDD8)
+DOUBLE_BYTE_PAIR(0xAE52, 0xCDD9)
+DOUBLE_BYTE_PAIR(0xAE53, 0xCDDA)
+DOUBLE_BYTE_PAIR(0xAE54, 0xCDDB)
+DOUBLE_BYTE_PAIR(0xAE55, 0xCDDC)
+DOUBLE_BYTE_PAIR(0xAE56, 0xCDDD)
+DOUBLE_BYTE_PAIR(0xAE57, 0xCDDE)
+DOUBLE_BYTE_PAIR(0xAE58, 0xCDDF)
+DOUBLE_BYTE_PAIR(0xAE59, 0xCDE0)
+DOUBLE_BYTE_PAIR(0xAE5A, 0xCDE1)
+DOUBLE_BYTE_PAIR(0xAE61, 0xCDE2)
+DOUBLE_BYTE_PAIR(0xAE62, 0xCDE3)
+DOUBLE_BYTE_PAIR(0xAE63, 0xCDE4)
+DOUBLE_BYTE_PAIR(0xAE64, 0xCDE5)
+DOUBLE_BYTE_PAIR(0xAE65, 0xCDE6)
+DOUBLE_BYTE_PAIR(0xAE66, 0xCDE7)
+DOUBLE_BYTE_PAIR(0xAE67, 0xCDE9)
+DOUBLE_BYTE_PAIR(0xAE68, 0xCDEA)
+DOUBLE_BYTE_PAIR(0xAE69, 0xCDEB)
+DOUBLE_BYTE_PAIR(0xAE6A, 0xCDED)
+DOUBLE_BYTE_PAIR(0xAE6B, 0xCDEE)
+DOUBLE_BYTE_PAIR(0xAE6C, 0xCDEF)
+DOUBLE_BYTE_PAIR(0xAE6D, 0xCDF1)
+DOUBLE_BYTE_PAIR(0xAE6E, 0xCDF2)
+DOUBLE_BYTE_PAIR(0xAE6F, 0xCDF3)
+DOUBLE_BYTE_PAIR(0xAE70, 0xCDF4)
+DOUBLE_BYTE_PAIR(0xAE71, 0xCDF5)
+DOUBLE_BYTE_PAIR(0xAE72, 0xCDF6)
+DOUBLE_BYTE_PAIR(0xAE73, 0xCDF7)
+DOUBLE_BYTE_PAIR(0xAE74, 0xCDFA)
+DOUBLE_BYTE_PAIR(0xAE75, 0xCDFC)
+DOUBLE_BYTE_PAIR(0xAE76, 0xCDFE)
+DOUBLE_BYTE_PAIR(0xAE77, 0xCDFF)
+DOUBLE_BYTE_PAIR(0xAE78, 0xCE00)
+DOUBLE_BYTE_PAIR(0xAE79, 0xCE01)
+DOUBLE_BYTE_PAIR(0xAE7A, 0xCE02)
+DOUBLE_BYTE_PAIR(0xAE81, 0xCE03)
+DOUBLE_BYTE_PAIR(0xAE82, 0xCE05)
+DOUBLE_BYTE_PAIR(0xAE83, 0xCE06)
+DOUBLE_BYTE_PAIR(0xAE84, 0xCE07)
+DOUBLE_BYTE_PAIR(0xAE85, 0xCE09)
+DOUBLE_BYTE_PAIR(0xAE86, 0xCE0A)
+DOUBLE_BYTE_PAIR(0xAE87, 0xCE0B)
+DOUBLE_BYTE_PAIR(0xAE88, 0xCE0D)
+DOUBLE_BYTE_PAIR(0xAE89, 0xCE0E)
+DOUBLE_BYTE_PAIR(0xAE8A, 0xCE0F)
+DOUBLE_BYTE_PAIR(0xAE8B, 0xCE10)
+DOUBLE_BYTE_PAIR(0xAE8C, 0xCE11)
+DOUBLE_BYTE_PAIR(0xAE8D, 0xCE12)
+DOUBLE_BYTE_PAIR(0xAE8E, 0xCE13)
+DOUBLE_BYTE_PAIR(0xAE8F, 0xCE15)
+DOUBLE_BYTE_PAIR(0xAE90, 0xCE16)
+DOUBLE_BYTE_PAIR(0xAE91, 0xCE17)
+DOUBLE_BYTE_PAIR(0xAE92, 0xCE18)
+DOUBLE_BYTE_PAIR(0xAE93, 0xCE1A)
+DOUBLE_BYTE_PAIR(0xAE94, 0xCE1B)
+DOUBLE_BYTE_PAIR(0xAE95, 0xCE1C)
+DOUBLE_BYTE_PAIR(0xAE96, 0xCE1D)
+DOUBLE_BYTE_PAIR(0xAE97, 0xCE1E)
+DOUBLE_BYTE_PAIR(0xAE98, 0xCE1F)
+DOUBLE_BYTE_PAIR(0xAE99, 0xCE22)
+DOUBLE_BYTE_PAIR(0xAE9A, 0xCE23)
+DOUBLE_BYTE_PAIR(0xAE9B, 0xCE25)
+DOUBLE_BYTE_PAIR(0xAE9C, 0xCE26)
+DOUBLE_BYTE_PAIR(0xAE9D, 0xCE27)
+DOUBLE_BYTE_PAIR(0xAE9E, 0xCE29)
+DOUBLE_BYTE_PAIR(0xAE9F, 0xCE2A)
+DOUBLE_BYTE_PAIR(0xAEA0, 0xCE2B)
+DOUBLE_BYTE_PAIR(0xAF41, 0xCE2C)
+DOUBLE_BYTE_PAIR(0xAF42, 0xCE2D)
+DOUBLE_BYTE_PAIR(0xAF43, 0xCE2E)
+DOUBLE_BYTE_PAIR(0xAF44, 0xCE2F)
+DOUBLE_BYTE_PAIR(0xAF45, 0xCE32)
+DOUBLE_BYTE_PAIR(0xAF46, 0xCE34)
+DOUBLE_BYTE_PAIR(0xAF47, 0xCE36)
+DOUBLE_BYTE_PAIR(0xAF48, 0xCE37)
+DOUBLE_BYTE_PAIR(0xAF49, 0xCE38)
+DOUBLE_BYTE_PAIR(0xAF4A, 0xCE39)
+DOUBLE_BYTE_PAIR(0xAF4B, 0xCE3A)
+DOUBLE_BYTE_PAIR(0xAF4C, 0xCE3B)
+DOUBLE_BYTE_PAIR(0xAF4D, 0xCE3C)
+DOUBLE_BYTE_PAIR(0xAF4E, 0xCE3D)
+DOUBLE_BYTE_PAIR(0xAF4F, 0xCE3E)
+DOUBLE_BYTE_PAIR(0xAF50, 0xCE3F)
+DOUBLE_BYTE_PAIR(0xAF51, 0xCE40)
+DOUBLE_BYTE_PAIR(0xAF52, 0xCE41)
+DOUBLE_BYTE_PAIR(0xAF53, 0xCE42)
+DOUBLE_BYTE_PAIR(0xAF54, 0xCE43)
+DOUBLE_BYTE_PAIR(0xAF55, 0xCE44)
+DOUBLE_BYTE_PAIR(0xAF56, 0xCE45)
+DOUBLE_BYTE_PAIR(0xAF57, 0xCE46)
+DOUBLE_BYTE_PAIR(0xAF58, 0xCE47)
+DOUBLE_BYTE_PAIR(0xAF59, 0xCE48)
+DOUBLE_BYTE_PAIR(0xAF5A, 0xCE49)
+DOUBLE_BYTE_PAIR(0xAF61, 0xCE4A)
+DOUBLE_BYTE_PAIR(0xAF62, 0xCE4B)
+DOUBLE_BYTE_PAIR(0xAF63, 0xCE4C)
+DOUBLE_BYTE_PAIR(0xAF64, 0xCE4D)
+DOUBLE_BYTE_PAIR(0xAF65, 0xCE4E)
+DOUBLE_BYTE_PAIR(0xAF66, 0xCE4F)
+DOUBLE_BYTE_PAIR(0xAF67, 0xCE50)
+DOUBLE_BYTE_PAIR(0xAF68, 0xCE51)
+DOUBLE_BYTE_PAIR(0xAF69, 0xCE52)
+DOUBLE_BYTE_PAIR(0xAF6A, 0xCE53)
+DOUBLE_BYTE_PAIR(0xAF6B, 0xCE54)
+DOUBLE_BYTE_PAIR(0xAF6C, 0xCE55)
+DOUBLE_BYTE_PAIR(0xAF6D, 0xCE56)
+DOUBLE_BYTE_PAIR(0xAF6E, 0xCE57)
+DOUBLE_BYTE_PAIR(0xAF6F, 0xCE5A)
+DOUBLE_BYTE_PAIR(0xAF70, 0xCE5B)
+DOUBLE_BYTE_PAIR(0xAF71, 0xCE5D)
+DOUBLE_BYTE_PAIR(0xAF72, 0xCE5E)
+DOUBLE_BYTE_PAIR(0xAF73, 0xCE62)
+DOUBLE_BYTE_PAIR(0xAF74, 0xCE63)
+DOUBLE_BYTE_PAIR(0xAF75, 0xCE64)
+DOUBLE_BYTE_PAIR(0xAF76, 0xCE65)
+DOUBLE_BYTE_PAIR(0xAF77, 0xCE66)
+DOUBLE_BYTE_PAIR(0xAF78, 0xCE67)
+DOUBLE_BYTE_PAIR(0xAF79, 0xCE6A)
+DOUBLE_BYTE_PAIR(0xAF7A, 0xCE6C)
+DOUBLE_BYTE_PAIR(0xAF81, 0xCE6E)
+DOUBLE_BYTE_PAIR(0xAF82, 0xCE6F)
+DOUBLE_BYTE_PAIR(0xAF83, 0xCE70)
+DOUBLE_BYTE_PAIR(0xAF84, 0xCE71)
+DOUBLE_BYTE_PAIR(0xAF85, 0xCE72)
+DOUBLE_BYTE_PAIR(0xAF86, 0xCE73)
+DOUBLE_BYTE_PAIR(0xAF87, 0xCE76)
+DOUBLE_BYTE_PAIR(0xAF88, 0xCE77)
+DOUBLE_BYTE_PAIR(0xAF89, 0xCE79)
+DOUBLE_BYTE_PAIR(0xAF8A, 0xCE7A)
+DOUBLE_BYTE_PAIR(0xAF8B, 0xCE7B)
+DOUBLE_BYTE_PAIR(0xAF8C, 0xCE7D)
+DOUBLE_BYTE_PAIR(0xAF8D, 0xCE7E)
+DOUBLE_BYTE_PAIR(0xAF8E, 0xCE7F)
+DOUBLE_BYTE_PAIR(0xAF8F, 0xCE80)
+DOUBLE_BYTE_PAIR(0xAF90, 0xCE81)
+DOUBLE_BYTE_PAIR(0xAF91, 0xCE82)
+DOUBLE_BYTE_PAIR(0xAF92, 0xCE83)
+DOUBLE_BYTE_PAIR(0xAF93, 0xCE86)
+DOUBLE_BYTE_PAIR(0xAF94, 0xCE88)
+DOUBLE_BYTE_PAIR(0xAF95, 0xCE8A)
+DOUBLE_BYTE_PAIR(0xAF96, 0xCE8B)
+DOUBLE_BYTE_PAIR(0xAF97, 0xCE8C)
+DOUBLE_BYTE_PAIR(0xAF98, 0xCE8D)
+DOUBLE_BYTE_PAIR(0xAF99, 0xCE8E)
+DOUBLE_BYTE_PAIR(0xAF9A, 0xCE8F)
+DOUBLE_BYTE_PAIR(0xAF9B, 0xCE92)
+DOUBLE_BYTE_PAIR(0xAF9C, 0xCE93)
+DOUBLE_BYTE_PAIR(0xAF9D, 0xCE95)
+DOUBLE_BYTE_PAIR(0xAF9E, 0xCE96)
+DOUBLE_BYTE_PAIR(0xAF9F, 0xCE97)
+DOUBLE_BYTE_PAIR(0xAFA0, 0xCE99)
+DOUBLE_BYTE_PAIR(0xB041, 0xCE9A)
+DOUBLE_BYTE_PAIR(0xB042, 0xCE9B)
+DOUBLE_BYTE_PAIR(0xB043, 0xCE9C)
+DOUBLE_BYTE_PAIR(0xB044, 0xCE9D)
+DOUBLE_BYTE_PAIR(0xB045, 0xCE9E)
+DOUBLE_BYTE_PAIR(0xB046, 0xCE9F)
+DOUBLE_BYTE_PAIR(0xB047, 0xCEA2)
+DOUBLE_BYTE_PAIR(0xB048, 0xCEA6)
+DOUBLE_BYTE_PAIR(0xB049, 0xCEA7)
+DOUBLE_BYTE_PAIR(0xB04A, 0xCEA8)
+DOUBLE_BYTE_PAIR(0xB04B, 0xCEA9)
+DOUBLE_BYTE_PAIR(0xB04C, 0xCEAA)
+DOUBLE_BYTE_PAIR(0xB04D, 0xCEAB)
+DOUBLE_BYTE_PAIR(0xB04E, 0xCEAE)
+DOUBLE_BYTE_PAIR(0xB04F, 0xCEAF)
+DOUBLE_BYTE_PAIR(0xB050, 0xCEB0)
+DOUBLE_BYTE_PAIR(0xB051, 0xCEB1)
+DOUBLE_BYTE_PAIR(0xB052, 0xCEB2)
+DOUBLE_BYTE_PAIR(0xB053, 0xCEB3)
+DOUBLE_BYTE_PAIR(0xB054, 0xCEB4)
+DOUBLE_BYTE_PAIR(0xB055, 0xCEB5)
+DOUBLE_BYTE_PAIR(0xB056, 0xCEB6)
+DOUBLE_BYTE_PAIR(0xB057, 0xCEB7)
+DOUBLE_BYTE_PAIR(0xB058, 0xCEB8)
+DOUBLE_BYTE_PAIR(0xB059, 0xCEB9)
+DOUBLE_BYTE_PAIR(0xB05A, 0xCEBA)
+DOUBLE_BYTE_PAIR(0xB061, 0xCEBB)
+DOUBLE_BYTE_PAIR(0xB062, 0xCEBC)
+DOUBLE_BYTE_PAIR(0xB063, 0xCEBD)
+DOUBLE_BYTE_PAIR(0xB064, 0xCEBE)
+DOUBLE_BYTE_PAIR(0xB065, 0xCEBF)
+DOUBLE_BYTE_PAIR(0xB066, 0xCEC0)
+DOUBLE_BYTE_PAIR(0xB067, 0xCEC2)
+DOUBLE_BYTE_PAIR(0xB068, 0xCEC3)
+DOUBLE_BYTE_PAIR(0xB069, 0xCEC4)
+DOUBLE_BYTE_PAIR(0xB06A, 0xCEC5)
+DOUBLE_BYTE_PAIR(0xB06B, 0xCEC6)
+DOUBLE_BYTE_PAIR(0xB06C, 0xCEC7)
+DOUBLE_BYTE_PAIR(0xB06D, 0xCEC8)
+DOUBLE_BYTE_PAIR(0xB06E, 0xCEC9)
+DOUBLE_BYTE_PAIR(0xB06F, 0xCECA)
+DOUBLE_BYTE_PAIR(0xB070, 0xCECB)
+DOUBLE_BYTE_PAIR(0xB071, 0xCECC)
+DOUBLE_BYTE_PAIR(0xB072, 0xCECD)
+DOUBLE_BYTE_PAIR(0xB073, 0xCECE)
+DOUBLE_BYTE_PAIR(0xB074, 0xCECF)
+DOUBLE_BYTE_PAIR(0xB075, 0xCED0)
+DOUBLE_BYTE_PAIR(0xB076, 0xCED1)
+DOUBLE_BYTE_PAIR(0xB077, 0xCED2)
+DOUBLE_BYTE_PAIR(0xB078, 0xCED3)
+DOUBLE_BYTE_PAIR(0xB079, 0xCED4)
+DOUBLE_BYTE_PAIR(0xB07A, 0xCED5)
+DOUBLE_BYTE_PAIR(0xB081, 0xCED6)
+DOUBLE_BYTE_PAIR(0xB082, 0xCED7)
+DOUBLE_BYTE_PAIR(0xB083, 0xCED8)
+DOUBLE_BYTE_PAIR(0xB084, 0xCED9)
+DOUBLE_BYTE_PAIR(0xB085, 0xCEDA)
+DOUBLE_BYTE_PAIR(0xB086, 0xCEDB)
+DOUBLE_BYTE_PAIR(0xB087, 0xCEDC)
+DOUBLE_BYTE_PAIR(0xB088, 0xCEDD)
+DOUBLE_BYTE_PAIR(0xB089, 0xCEDE)
+DOUBLE_BYTE_PAIR(0xB08A, 0xCEDF)
+DOUBLE_BYTE_PAIR(0xB08B, 0xCEE0)
+DOUBLE_BYTE_PAIR(0xB08C, 0xCEE1)
+DOUBLE_BYTE_PAIR(0xB08D, 0xCEE2)
+DOUBLE_BYTE_PAIR(0xB08E, 0xCEE3)
+DOUBLE_BYTE_PAIR(0xB08F, 0xCEE6)
+DOUBLE_BYTE_PAIR(0xB090, 0xCEE7)
+DOUBLE_BYTE_PAIR(0xB091, 0xCEE9)
+DOUBLE_BYTE_PAIR(0xB092, 0xCEEA)
+DOUBLE_BYTE_PAIR(0xB093, 0xCEED)
+DOUBLE_BYTE_PAIR(0xB094, 0xCEEE)
+DOUBLE_BYTE_PAIR(0xB095, 0xCEEF)
+DOUBLE_BYTE_PAIR(0xB096, 0xCEF0)
+DOUBLE_BYTE_PAIR(0xB097, 0xCEF1)
+DOUBLE_BYTE_PAIR(0xB098, 0xCEF2)
+DOUBLE_BYTE_PAIR(0xB099, 0xCEF3)
+DOUBLE_BYTE_PAIR(0xB09A, 0xCEF6)
+DOUBLE_BYTE_PAIR(0xB09B, 0xCEFA)
+DOUBLE_BYTE_PAIR(0xB09C, 0xCEFB)
+DOUBLE_BYTE_PAIR(0xB09D, 0xCEFC)
+DOUBLE_BYTE_PAIR(0xB09E, 0xCEFD)
+DOUBLE_BYTE_PAIR(0xB09F, 0xCEFE)
+DOUBLE_BYTE_PAIR(0xB0A0, 0xCEFF)
+DOUBLE_BYTE_PAIR(0xB0A1, 0xAC00)
+DOUBLE_BYTE_PAIR(0xB0A2, 0xAC01)
+DOUBLE_BYTE_PAIR(0xB0A3, 0xAC04)
+DOUBLE_BYTE_PAIR(0xB0A4, 0xAC07)
+DOUBLE_BYTE_PAIR(0xB0A5, 0xAC08)
+DOUBLE_BYTE_PAIR(0xB0A6, 0xAC09)
+DOUBLE_BYTE_PAIR(0xB0A7, 0xAC0A)
+DOUBLE_BYTE_PAIR(0xB0A8, 0xAC10)
+DOUBLE_BYTE_PAIR(0xB0A9, 0xAC11)
+DOUBLE_BYTE_PAIR(0xB0AA, 0xAC12)
+DOUBLE_BYTE_PAIR(0xB0AB, 0xAC13)
+DOUBLE_BYTE_PAIR(0xB0AC, 0xAC14)
+DOUBLE_BYTE_PAIR(0xB0AD, 0xAC15)
+DOUBLE_BYTE_PAIR(0xB0AE, 0xAC16)
+DOUBLE_BYTE_PAIR(0xB0AF, 0xAC17)
+DOUBLE_BYTE_PAIR(0xB0B0, 0xAC19)
+DOUBLE_BYTE_PAIR(0xB0B1, 0xAC1A)
+DOUBLE_BYTE_PAIR(0xB0B2, 0xAC1B)
+DOUBLE_BYTE_PAIR(0xB0B3, 0xAC1C)
+DOUBLE_BYTE_PAIR(0xB0B4, 0xAC1D)
+DOUBLE_BYTE_PAIR(0xB0B5, 0xAC20)
+DOUBLE_BYTE_PAIR(0xB0B6, 0xAC24)
+DOUBLE_BYTE_PAIR(0xB0B7, 0xAC2C)
+DOUBLE_BYTE_PAIR(0xB0B8, 0xAC2D)
+DOUBLE_BYTE_PAIR(0xB0B9, 0xAC2F)
+DOUBLE_BYTE_PAIR(0xB0BA, 0xAC30)
+DOUBLE_BYTE_PAIR(0xB0BB, 0xAC31)
+DOUBLE_BYTE_PAIR(0xB0BC, 0xAC38)
+DOUBLE_BYTE_PAIR(0xB0BD, 0xAC39)
+DOUBLE_BYTE_PAIR(0xB0BE, 0xAC3C)
+DOUBLE_BYTE_PAIR(0xB0BF, 0xAC40)
+DOUBLE_BYTE_PAIR(0xB0C0, 0xAC4B)
+DOUBLE_BYTE_PAIR(0xB0C1, 0xAC4D)
+DOUBLE_BYTE_PAIR(0xB0C2, 0xAC54)
+DOUBLE_BYTE_PAIR(0xB0C3, 0xAC58)
+DOUBLE_BYTE_PAIR(0xB0C4, 0xAC5C)
+DOUBLE_BYTE_PAIR(0xB0C5, 0xAC70)
+DOUBLE_BYTE_PAIR(0xB0C6, 0xAC71)
+DOUBLE_BYTE_PAIR(0xB0C7, 0xAC74)
+DOUBLE_BYTE_PAIR(0xB0C8, 0xAC77)
+DOUBLE_BYTE_PAIR(0xB0C9, 0xAC78)
+DOUBLE_BYTE_PAIR(0xB0CA, 0xAC7A)
+DOUBLE_BYTE_PAIR(0xB0CB, 0xAC80)
+DOUBLE_BYTE_PAIR(0xB0CC, 0xAC81)
+DOUBLE_BYTE_PAIR(0xB0CD, 0xAC83)
+DOUBLE_BYTE_PAIR(0xB0CE, 0xAC84)
+DOUBLE_BYTE_PAIR(0xB0CF, 0xAC85)
+DOUBLE_BYTE_PAIR(0xB0D0, 0xAC86)
+DOUBLE_BYTE_PAIR(0xB0D1, 0xAC89)
+DOUBLE_BYTE_PAIR(0xB0D2, 0xAC8A)
+DOUBLE_BYTE_PAIR(0xB0D3, 0xAC8B)
+DOUBLE_BYTE_PAIR(0xB0D4, 0xAC8C)
+DOUBLE_BYTE_PAIR(0xB0D5, 0xAC90)
+DOUBLE_BYTE_PAIR(0xB0D6, 0xAC94)
+DOUBLE_BYTE_PAIR(0xB0D7, 0xAC9C)
+DOUBLE_BYTE_PAIR(0xB0D8, 0xAC9D)
+DOUBLE_BYTE_PAIR(0xB0D9, 0xAC9F)
+DOUBLE_BYTE_PAIR(0xB0DA, 0xACA0)
+DOUBLE_BYTE_PAIR(0xB0DB, 0xACA1)
+DOUBLE_BYTE_PAIR(0xB0DC, 0xACA8)
+DOUBLE_BYTE_PAIR(0xB0DD, 0xACA9)
+DOUBLE_BYTE_PAIR(0xB0DE, 0xACAA)
+DOUBLE_BYTE_PAIR(0xB0DF, 0xACAC)
+DOUBLE_BYTE_PAIR(0xB0E0, 0xACAF)
+DOUBLE_BYTE_PAIR(0xB0E1, 0xACB0)
+DOUBLE_BYTE_PAIR(0xB0E2, 0xACB8)
+DOUBLE_BYTE_PAIR(0xB0E3, 0xACB9)
+DOUBLE_BYTE_PAIR(0xB0E4, 0xACBB)
+DOUBLE_BYTE_PAIR(0xB0E5, 0xACBC)
+DOUBLE_BYTE_PAIR(0xB0E6, 0xACBD)
+DOUBLE_BYTE_PAIR(0xB0E7, 0xACC1)
+DOUBLE_BYTE_PAIR(0xB0E8, 0xACC4)
+DOUBLE_BYTE_PAIR(0xB0E9, 0xACC8)
+DOUBLE_BYTE_PAIR(0xB0EA, 0xACCC)
+DOUBLE_BYTE_PAIR(0xB0EB, 0xACD5)
+DOUBLE_BYTE_PAIR(0xB0EC, 0xACD7)
+DOUBLE_BYTE_PAIR(0xB0ED, 0xACE0)
+DOUBLE_BYTE_PAIR(0xB0EE, 0xACE1)
+DOUBLE_BYTE_PAIR(0xB0EF, 0xACE4)
+DOUBLE_BYTE_PAIR(0xB0F0, 0xACE7)
+DOUBLE_BYTE_PAIR(0xB0F1, 0xACE8)
+DOUBLE_BYTE_PAIR(0xB0F2, 0xACEA)
+DOUBLE_BYTE_PAIR(0xB0F3, 0xACEC)
+DOUBLE_BYTE_PAIR(0xB0F4, 0xACEF)
+DOUBLE_BYTE_PAIR(0xB0F5, 0xACF0)
+DOUBLE_BYTE_PAIR(0xB0F6, 0xACF1)
+DOUBLE_BYTE_PAIR(0xB0F7, 0xACF3)
+DOUBLE_BYTE_PAIR(0xB0F8, 0xACF5)
+DOUBLE_BYTE_PAIR(0xB0F9, 0xACF6)
+DOUBLE_BYTE_PAIR(0xB0FA, 0xACFC)
+DOUBLE_BYTE_PAIR(0xB0FB, 0xACFD)
+DOUBLE_BYTE_PAIR(0xB0FC, 0xAD00)
+DOUBLE_BYTE_PAIR(0xB0FD, 0xAD04)
+DOUBLE_BYTE_PAIR(0xB0FE, 0xAD06)
+DOUBLE_BYTE_PAIR(0xB141, 0xCF02)
+DOUBLE_BYTE_PAIR(0xB142, 0xCF03)
+DOUBLE_BYTE_PAIR(0xB143, 0xCF05)
+DOUBLE_BYTE_PAIR(0xB144, 0xCF06)
+DOUBLE_BYTE_PAIR(0xB145, 0xCF07)
+DOUBLE_BYTE_PAIR(0xB146, 0xCF09)
+DOUBLE_BYTE_PAIR(0xB147, 0xCF0A)
+DOUBLE_BYTE_PAIR(0xB148, 0xCF0B)
+DOUBLE_BYTE_PAIR(0xB149, 0xCF0C)
+DOUBLE_BYTE_PAIR(0xB14A, 0xCF0D)
+DOUBLE_BYTE_PAIR(0xB14B, 0xCF0E)
+DOUBLE_BYTE_PAIR(0xB14C, 0xCF0F)
+DOUBLE_BYTE_PAIR(0xB14D, 0xCF12)
+DOUBLE_BYTE_PAIR(0xB14E, 0xCF14)
+DOUBLE_BYTE_PAIR(0xB14F, 0xCF16)
+DOUBLE_BYTE_PAIR(0xB150, 0xCF17)
+DOUBLE_BYTE_PAIR(0xB151, 0xCF18)
+DOUBLE_BYTE_PAIR(0xB152, 0xCF19)
+DOUBLE_BYTE_PAIR(0xB153, 0xCF1A)
+DOUBLE_BYTE_PAIR(0xB154, 0xCF1B)
+DOUBLE_BYTE_PAIR(0xB155, 0xCF1D)
+DOUBLE_BYTE_PAIR(0xB156, 0xCF1E)
+DOUBLE_BYTE_PAIR(0xB157, 0xCF1F)
+DOUBLE_BYTE_PAIR(0xB158, 0xCF21)
+DOUBLE_BYTE_PAIR(0xB159, 0xCF22)
+DOUBLE_BYTE_PAIR(0xB15A, 0xCF23)
+DOUBLE_BYTE_PAIR(0xB161, 0xCF25)
+DOUBLE_BYTE_PAIR(0xB162, 0xCF26)
+DOUBLE_BYTE_PAIR(0xB163, 0xCF27)
+DOUBLE_BYTE_PAIR(0xB164, 0xCF28)
+DOUBLE_BYTE_PAIR(0xB165, 0xCF29)
+DOUBLE_BYTE_PAIR(0xB166, 0xCF2A)
+DOUBLE_BYTE_PAIR(0xB167, 0xCF2B)
+DOUBLE_BYTE_PAIR(0xB168, 0xCF2E)
+DOUBLE_BYTE_PAIR(0xB169, 0xCF32)
+DOUBLE_BYTE_PAIR(0xB16A, 0xCF33)
+DOUBLE_BYTE_PAIR(0xB16B, 0xCF34)
+DOUBLE_BYTE_PAIR(0xB16C, 0xCF35)
+DOUBLE_BYTE_PAIR(0xB16D, 0xCF36)
+DOUBLE_BYTE_PAIR(0xB16E, 0xCF37)
+DOUBLE_BYTE_PAIR(0xB16F, 0xCF39)
+DOUBLE_BYTE_PAIR(0xB170, 0xCF3A)
+DOUBLE_BYTE_PAIR(0xB171, 0xCF3B)
+DOUBLE_BYTE_PAIR(0xB172, 0xCF3C)
+DOUBLE_BYTE_PAIR(0xB173, 0xCF3D)
+DOUBLE_BYTE_PAIR(0xB174, 0xCF3E)
+DOUBLE_BYTE_PAIR(0xB175, 0xCF3F)
+DOUBLE_BYTE_PAIR(0xB176, 0xCF40)
+DOUBLE_BYTE_PAIR(0xB177, 0xCF41)
+DOUBLE_BYTE_PAIR(0xB178, 0xCF42)
+DOUBLE_BYTE_PAIR(0xB179, 0xCF43)
+DOUBLE_BYTE_PAIR(0xB17A, 0xCF44)
+DOUBLE_BYTE_PAIR(0xB181, 0xCF45)
+DOUBLE_BYTE_PAIR(0xB182, 0xCF46)
+DOUBLE_BYTE_PAIR(0xB183, 0xCF47)
+DOUBLE_BYTE_PAIR(0xB184, 0xCF48)
+DOUBLE_BYTE_PAIR(0xB185, 0xCF49)
+DOUBLE_BYTE_PAIR(0xB186, 0xCF4A)
+DOUBLE_BYTE_PAIR(0xB187, 0xCF4B)
+DOUBLE_BYTE_PAIR(0xB188, 0xCF4C)
+DOUBLE_BYTE_PAIR(0xB189, 0xCF4D)
+DOUBLE_BYTE_PAIR(0xB18A, 0xCF4E)
+DOUBLE_BYTE_PAIR(0xB18B, 0xCF4F)
+DOUBLE_BYTE_PAIR(0xB18C, 0xCF50)
+DOUBLE_BYTE_PAIR(0xB18D, 0xCF51)
+DOUBLE_BYTE_PAIR(0xB18E, 0xCF52)
+DOUBLE_BYTE_PAIR(0xB18F, 0xCF53)
+DOUBLE_BYTE_PAIR(0xB190, 0xCF56)
+DOUBLE_BYTE_PAIR(0xB191, 0xCF57)
+DOUBLE_BYTE_PAIR(0xB192, 0xCF59)
+DOUBLE_BYTE_PAIR(0xB193, 0xCF5A)
+DOUBLE_BYTE_PAIR(0xB194, 0xCF5B)
+DOUBLE_BYTE_PAIR(0xB195, 0xCF5D)
+DOUBLE_BYTE_PAIR(0xB196, 0xCF5E)
+DOUBLE_BYTE_PAIR(0xB197, 0xCF5F)
+DOUBLE_BYTE_PAIR(0xB198, 0xCF60)
+DOUBLE_BYTE_PAIR(0xB199, 0xCF61)
+DOUBLE_BYTE_PAIR(0xB19A, 0xCF62)
+DOUBLE_BYTE_PAIR(0xB19B, 0xCF63)
+DOUBLE_BYTE_PAIR(0xB19C, 0xCF66)
+DOUBLE_BYTE_PAIR(0xB19D, 0xCF68)
+DOUBLE_BYTE_PAIR(0xB19E, 0xCF6A)
+DOUBLE_BYTE_PAIR(0xB19F, 0xCF6B)
+DOUBLE_BYTE_PAIR(0xB1A0, 0xCF6C)
+DOUBLE_BYTE_PAIR(0xB1A1, 0xAD0C)
+DOUBLE_BYTE_PAIR(0xB1A2, 0xAD0D)
+DOUBLE_BYTE_PAIR(0xB1A3, 0xAD0F)
+DOUBLE_BYTE_PAIR(0xB1A4, 0xAD11)
+DOUBLE_BYTE_PAIR(0xB1A5, 0xAD18)
+DOUBLE_BYTE_PAIR(0xB1A6, 0xAD1C)
+DOUBLE_BYTE_PAIR(0xB1A7, 0xAD20)
+DOUBLE_BYTE_PAIR(0xB1A8, 0xAD29)
+DOUBLE_BYTE_PAIR(0xB1A9, 0xAD2C)
+DOUBLE_BYTE_PAIR(0xB1AA, 0xAD2D)
+DOUBLE_BYTE_PAIR(0xB1AB, 0xAD34)
+DOUBLE_BYTE_PAIR(0xB1AC, 0xAD35)
+DOUBLE_BYTE_PAIR(0xB1AD, 0xAD38)
+DOUBLE_BYTE_PAIR(0xB1AE, 0xAD3C)
+DOUBLE_BYTE_PAIR(0xB1AF, 0xAD44)
+DOUBLE_BYTE_PAIR(0xB1B0, 0xAD45)
+DOUBLE_BYTE_PAIR(0xB1B1, 0xAD47)
+DOUBLE_BYTE_PAIR(0xB1B2, 0xAD49)
+DOUBLE_BYTE_PAIR(0xB1B3, 0xAD50)
+DOUBLE_BYTE_PAIR(0xB1B4, 0xAD54)
+DOUBLE_BYTE_PAIR(0xB1B5, 0xAD58)
+DOUBLE_BYTE_PAIR(0xB1B6, 0xAD61)
+DOUBLE_BYTE_PAIR(0xB1B7, 0xAD63)
+DOUBLE_BYTE_PAIR(0xB1B8, 0xAD6C)
+DOUBLE_BYTE_PAIR(0xB1B9, 0xAD6D)
+DOUBLE_BYTE_PAIR(0xB1BA, 0xAD70)
+DOUBLE_BYTE_PAIR(0xB1BB, 0xAD73)
+DOUBLE_BYTE_PAIR(0xB1BC, 0xAD74)
+DOUBLE_BYTE_PAIR(0xB1BD, 0xAD75)
+DOUBLE_BYTE_PAIR(0xB1BE, 0xAD76)
+DOUBLE_BYTE_PAIR(0xB1BF, 0xAD7B)
+DOUBLE_BYTE_PAIR(0xB1C0, 0xAD7C)
+DOUBLE_BYTE_PAIR(0xB1C1, 0xAD7D)
+DOUBLE_BYTE_PAIR(0xB1C2, 0xAD7F)
+DOUBLE_BYTE_PAIR(0xB1C3, 0xAD81)
+DOUBLE_BYTE_PAIR(0xB1C4, 0xAD82)
+DOUBLE_BYTE_PAIR(0xB1C5, 0xAD88)
+DOUBLE_BYTE_PAIR(0xB1C6, 0xAD89)
+DOUBLE_BYTE_PAIR(0xB1C7, 0xAD8C)
+DOUBLE_BYTE_PAIR(0xB1C8, 0xAD90)
+DOUBLE_BYTE_PAIR(0xB1C9, 0xAD9C)
+DOUBLE_BYTE_PAIR(0xB1CA, 0xAD9D)
+DOUBLE_BYTE_PAIR(0xB1CB, 0xADA4)
+DOUBLE_BYTE_PAIR(0xB1CC, 0xADB7)
+DOUBLE_BYTE_PAIR(0xB1CD, 0xADC0)
+DOUBLE_BYTE_PAIR(0xB1CE, 0xADC1)
+DOUBLE_BYTE_PAIR(0xB1CF, 0xADC4)
+DOUBLE_BYTE_PAIR(0xB1D0, 0xADC8)
+DOUBLE_BYTE_PAIR(0xB1D1, 0xADD0)
+DOUBLE_BYTE_PAIR(0xB1D2, 0xADD1)
+DOUBLE_BYTE_PAIR(0xB1D3, 0xADD3)
+DOUBLE_BYTE_PAIR(0xB1D4, 0xADDC)
+DOUBLE_BYTE_PAIR(0xB1D5, 0xADE0)
+DOUBLE_BYTE_PAIR(0xB1D6, 0xADE4)
+DOUBLE_BYTE_PAIR(0xB1D7, 0xADF8)
+DOUBLE_BYTE_PAIR(0xB1D8, 0xADF9)
+DOUBLE_BYTE_PAIR(0xB1D9, 0xADFC)
+DOUBLE_BYTE_PAIR(0xB1DA, 0xADFF)
+DOUBLE_BYTE_PAIR(0xB1DB, 0xAE00)
+DOUBLE_BYTE_PAIR(0xB1DC, 0xAE01)
+DOUBLE_BYTE_PAIR(0xB1DD, 0xAE08)
+DOUBLE_BYTE_PAIR(0xB1DE, 0xAE09)
+DOUBLE_BYTE_PAIR(0xB1DF, 0xAE0B)
+DOUBLE_BYTE_PAIR(0xB1E0, 0xAE0D)
+DOUBLE_BYTE_PAIR(0xB1E1, 0xAE14)
+DOUBLE_BYTE_PAIR(0xB1E2, 0xAE30)
+DOUBLE_BYTE_PAIR(0xB1E3, 0xAE31)
+DOUBLE_BYTE_PAIR(0xB1E4, 0xAE34)
+DOUBLE_BYTE_PAIR(0xB1E5, 0xAE37)
+DOUBLE_BYTE_PAIR(0xB1E6, 0xAE38)
+DOUBLE_BYTE_PAIR(0xB1E7, 0xAE3A)
+DOUBLE_BYTE_PAIR(0xB1E8, 0xAE40)
+DOUBLE_BYTE_PAIR(0xB1E9, 0xAE41)
+DOUBLE_BYTE_PAIR(0xB1EA, 0xAE43)
+DOUBLE_BYTE_PAIR(0xB1EB, 0xAE45)
+DOUBLE_BYTE_PAIR(0xB1EC, 0xAE46)
+DOUBLE_BYTE_PAIR(0xB1ED, 0xAE4A)
+DOUBLE_BYTE_PAIR(0xB1EE, 0xAE4C)
+DOUBLE_BYTE_PAIR(0xB1EF, 0xAE4D)
+DOUBLE_BYTE_PAIR(0xB1F0, 0xAE4E)
+DOUBLE_BYTE_PAIR(0xB1F1, 0xAE50)
+DOUBLE_BYTE_PAIR(0xB1F2, 0xAE54)
+DOUBLE_BYTE_PAIR(0xB1F3, 0xAE56)
+DOUBLE_BYTE_PAIR(0xB1F4, 0xAE5C)
+DOUBLE_BYTE_PAIR(0xB1F5, 0xAE5D)
+DOUBLE_BYTE_PAIR(0xB1F6, 0xAE5F)
+DOUBLE_BYTE_PAIR(0xB1F7, 0xAE60)
+DOUBLE_BYTE_PAIR(0xB1F8, 0xAE61)
+DOUBLE_BYTE_PAIR(0xB1F9, 0xAE65)
+DOUBLE_BYTE_PAIR(0xB1FA, 0xAE68)
+DOUBLE_BYTE_PAIR(0xB1FB, 0xAE69)
+DOUBLE_BYTE_PAIR(0xB1FC, 0xAE6C)
+DOUBLE_BYTE_PAIR(0xB1FD, 0xAE70)
+DOUBLE_BYTE_PAIR(0xB1FE, 0xAE78)
+DOUBLE_BYTE_PAIR(0xB241, 0xCF6D)
+DOUBLE_BYTE_PAIR(0xB242, 0xCF6E)
+DOUBLE_BYTE_PAIR(0xB243, 0xCF6F)
+DOUBLE_BYTE_PAIR(0xB244, 0xCF72)
+DOUBLE_BYTE_PAIR(0xB245, 0xCF73)
+DOUBLE_BYTE_PAIR(0xB246, 0xCF75)
+DOUBLE_BYTE_PAIR(0xB247, 0xCF76)
+DOUBLE_BYTE_PAIR(0xB248, 0xCF77)
+DOUBLE_BYTE_PAIR(0xB249, 0xCF79)
+DOUBLE_BYTE_PAIR(0xB24A, 0xCF7A)
+DOUBLE_BYTE_PAIR(0xB24B, 0xCF7B)
+DOUBLE_BYTE_PAIR(0xB24C, 0xCF7C)
+DOUBLE_BYTE_PAIR(0xB24D, 0xCF7D)
+DOUBLE_BYTE_PAIR(0xB24E, 0xCF7E)
+DOUBLE_BYTE_PAIR(0xB24F, 0xCF7F)
+DOUBLE_BYTE_PAIR(0xB250, 0xCF81)
+DOUBLE_BYTE_PAIR(0xB251, 0xCF82)
+DOUBLE_BYTE_PAIR(0xB252, 0xCF83)
+DOUBLE_BYTE_PAIR(0xB253, 0xCF84)
+DOUBLE_BYTE_PAIR(0xB254, 0xCF86)
+DOUBLE_BYTE_PAIR(0xB255, 0xCF87)
+DOUBLE_BYTE_PAIR(0xB256, 0xCF88)
+DOUBLE_BYTE_PAIR(0xB257, 0xCF89)
+DOUBLE_BYTE_PAIR(0xB258, 0xCF8A)
+DOUBLE_BYTE_PAIR(0xB259, 0xCF8B)
+DOUBLE_BYTE_PAIR(0xB25A, 0xCF8D)
+DOUBLE_BYTE_PAIR(0xB261, 0xCF8E)
+DOUBLE_BYTE_PAIR(0xB262, 0xCF8F)
+DOUBLE_BYTE_PAIR(0xB263, 0xCF90)
+DOUBLE_BYTE_PAIR(0xB264, 0xCF91)
+DOUBLE_BYTE_PAIR(0xB265, 0xCF92)
+DOUBLE_BYTE_PAIR(0xB266, 0xCF93)
+DOUBLE_BYTE_PAIR(0xB267, 0xCF94)
+DOUBLE_BYTE_PAIR(0xB268, 0xCF95)
+DOUBLE_BYTE_PAIR(0xB269, 0xCF96)
+DOUBLE_BYTE_PAIR(0xB26A, 0xCF97)
+DOUBLE_BYTE_PAIR(0xB26B, 0xCF98)
+DOUBLE_BYTE_PAIR(0xB26C, 0xCF99)
+DOUBLE_BYTE_PAIR(0xB26D, 0xCF9A)
+DOUBLE_BYTE_PAIR(0xB26E, 0xCF9B)
+DOUBLE_BYTE_PAIR(0xB26F, 0xCF9C)
+DOUBLE_BYTE_PAIR(0xB270, 0xCF9D)
+DOUBLE_BYTE_PAIR(0xB271, 0xCF9E)
+DOUBLE_BYTE_PAIR(0xB272, 0xCF9F)
+DOUBLE_BYTE_PAIR(0xB273, 0xCFA0)
+DOUBLE_BYTE_PAIR(0xB274, 0xCFA2)
+DOUBLE_BYTE_PAIR(0xB275, 0xCFA3)
+DOUBLE_BYTE_PAIR(0xB276, 0xCFA4)
+DOUBLE_BYTE_PAIR(0xB277, 0xCFA5)
+DOUBLE_BYTE_PAIR(0xB278, 0xCFA6)
+DOUBLE_BYTE_PAIR(0xB279, 0xCFA7)
+DOUBLE_BYTE_PAIR(0xB27A, 0xCFA9)
+DOUBLE_BYTE_PAIR(0xB281, 0xCFAA)
+DOUBLE_BYTE_PAIR(0xB282, 0xCFAB)
+DOUBLE_BYTE_PAIR(0xB283, 0xCFAC)
+DOUBLE_BYTE_PAIR(0xB284, 0xCFAD)
+DOUBLE_BYTE_PAIR(0xB285, 0xCFAE)
+DOUBLE_BYTE_PAIR(0xB286, 0xCFAF)
+DOUBLE_BYTE_PAIR(0xB287, 0xCFB1)
+DOUBLE_BYTE_PAIR(0xB288, 0xCFB2)
+DOUBLE_BYTE_PAIR(0xB289, 0xCFB3)
+DOUBLE_BYTE_PAIR(0xB28A, 0xCFB4)
+DOUBLE_BYTE_PAIR(0xB28B, 0xCFB5)
+DOUBLE_BYTE_PAIR(0xB28C, 0xCFB6)
+DOUBLE_BYTE_PAIR(0xB28D, 0xCFB7)
+DOUBLE_BYTE_PAIR(0xB28E, 0xCFB8)
+DOUBLE_BYTE_PAIR(0xB28F, 0xCFB9)
+DOUBLE_BYTE_PAIR(0xB290, 0xCFBA)
+DOUBLE_BYTE_PAIR(0xB291, 0xCFBB)
+DOUBLE_BYTE_PAIR(0xB292, 0xCFBC)
+DOUBLE_BYTE_PAIR(0xB293, 0xCFBD)
+DOUBLE_BYTE_PAIR(0xB294, 0xCFBE)
+DOUBLE_BYTE_PAIR(0xB295, 0xCFBF)
+DOUBLE_BYTE_PAIR(0xB296, 0xCFC0)
+DOUBLE_BYTE_PAIR(0xB297, 0xCFC1)
+DOUBLE_BYTE_PAIR(0xB298, 0xCFC2)
+DOUBLE_BYTE_PAIR(0xB299, 0xCFC3)
+DOUBLE_BYTE_PAIR(0xB29A, 0xCFC5)
+DOUBLE_BYTE_PAIR(0xB29B, 0xCFC6)
+DOUBLE_BYTE_PAIR(0xB29C, 0xCFC7)
+DOUBLE_BYTE_PAIR(0xB29D, 0xCFC8)
+DOUBLE_BYTE_PAIR(0xB29E, 0xCFC9)
+DOUBLE_BYTE_PAIR(0xB29F, 0xCFCA)
+DOUBLE_BYTE_PAIR(0xB2A0, 0xCFCB)
+DOUBLE_BYTE_PAIR(0xB2A1, 0xAE79)
+DOUBLE_BYTE_PAIR(0xB2A2, 0xAE7B)
+DOUBLE_BYTE_PAIR(0xB2A3, 0xAE7C)
+DOUBLE_BYTE_PAIR(0xB2A4, 0xAE7D)
+DOUBLE_BYTE_PAIR(0xB2A5, 0xAE84)
+DOUBLE_BYTE_PAIR(0xB2A6, 0xAE85)
+DOUBLE_BYTE_PAIR(0xB2A7, 0xAE8C)
+DOUBLE_BYTE_PAIR(0xB2A8, 0xAEBC)
+DOUBLE_BYTE_PAIR(0xB2A9, 0xAEBD)
+DOUBLE_BYTE_PAIR(0xB2AA, 0xAEBE)
+DOUBLE_BYTE_PAIR(0xB2AB, 0xAEC0)
+DOUBLE_BYTE_PAIR(0xB2AC, 0xAEC4)
+DOUBLE_BYTE_PAIR(0xB2AD, 0xAECC)
+DOUBLE_BYTE_PAIR(0xB2AE, 0xAECD)
+DOUBLE_BYTE_PAIR(0xB2AF, 0xAECF)
+DOUBLE_BYTE_PAIR(0xB2B0, 0xAED0)
+DOUBLE_BYTE_PAIR(0xB2B1, 0xAED1)
+DOUBLE_BYTE_PAIR(0xB2B2, 0xAED8)
+DOUBLE_BYTE_PAIR(0xB2B3, 0xAED9)
+DOUBLE_BYTE_PAIR(0xB2B4, 0xAEDC)
+DOUBLE_BYTE_PAIR(0xB2B5, 0xAEE8)
+DOUBLE_BYTE_PAIR(0xB2B6, 0xAEEB)
+DOUBLE_BYTE_PAIR(0xB2B7, 0xAEED)
+DOUBLE_BYTE_PAIR(0xB2B8, 0xAEF4)
+DOUBLE_BYTE_PAIR(0xB2B9, 0xAEF8)
+DOUBLE_BYTE_PAIR(0xB2BA, 0xAEFC)
+DOUBLE_BYTE_PAIR(0xB2BB, 0xAF07)
+DOUBLE_BYTE_PAIR(0xB2BC, 0xAF08)
+DOUBLE_BYTE_PAIR(0xB2BD, 0xAF0D)
+DOUBLE_BYTE_PAIR(0xB2BE, 0xAF10)
+DOUBLE_BYTE_PAIR(0xB2BF, 0xAF2C)
+DOUBLE_BYTE_PAIR(0xB2C0, 0xAF2D)
+DOUBLE_BYTE_PAIR(0xB2C1, 0xAF30)
+DOUBLE_BYTE_PAIR(0xB2C2, 0xAF32)
+DOUBLE_BYTE_PAIR(0xB2C3, 0xAF34)
+DOUBLE_BYTE_PAIR(0xB2C4, 0xAF3C)
+DOUBLE_BYTE_PAIR(0xB2C5, 0xAF3D)
+DOUBLE_BYTE_PAIR(0xB2C6, 0xAF3F)
+DOUBLE_BYTE_PAIR(0xB2C7, 0xAF41)
+DOUBLE_BYTE_PAIR(0xB2C8, 0xAF42)
+DOUBLE_BYTE_PAIR(0xB2C9, 0xAF43)
+DOUBLE_BYTE_PAIR(0xB2CA, 0xAF48)
+DOUBLE_BYTE_PAIR(0xB2CB, 0xAF49)
+DOUBLE_BYTE_PAIR(0xB2CC, 0xAF50)
+DOUBLE_BYTE_PAIR(0xB2CD, 0xAF5C)
+DOUBLE_BYTE_PAIR(0xB2CE, 0xAF5D)
+DOUBLE_BYTE_PAIR(0xB2CF, 0xAF64)
+DOUBLE_BYTE_PAIR(0xB2D0, 0xAF65)
+DOUBLE_BYTE_PAIR(0xB2D1, 0xAF79)
+DOUBLE_BYTE_PAIR(0xB2D2, 0xAF80)
+DOUBLE_BYTE_PAIR(0xB2D3, 0xAF84)
+DOUBLE_BYTE_PAIR(0xB2D4, 0xAF88)
+DOUBLE_BYTE_PAIR(0xB2D5, 0xAF90)
+DOUBLE_BYTE_PAIR(0xB2D6, 0xAF91)
+DOUBLE_BYTE_PAIR(0xB2D7, 0xAF95)
+DOUBLE_BYTE_PAIR(0xB2D8, 0xAF9C)
+DOUBLE_BYTE_PAIR(0xB2D9, 0xAFB8)
+DOUBLE_BYTE_PAIR(0xB2DA, 0xAFB9)
+DOUBLE_BYTE_PAIR(0xB2DB, 0xAFBC)
+DOUBLE_BYTE_PAIR(0xB2DC, 0xAFC0)
+DOUBLE_BYTE_PAIR(0xB2DD, 0xAFC7)
+DOUBLE_BYTE_PAIR(0xB2DE, 0xAFC8)
+DOUBLE_BYTE_PAIR(0xB2DF, 0xAFC9)
+DOUBLE_BYTE_PAIR(0xB2E0, 0xAFCB)
+DOUBLE_BYTE_PAIR(0xB2E1, 0xAFCD)
+DOUBLE_BYTE_PAIR(0xB2E2, 0xAFCE)
+DOUBLE_BYTE_PAIR(0xB2E3, 0xAFD4)
+DOUBLE_BYTE_PAIR(0xB2E4, 0xAFDC)
+DOUBLE_BYTE_PAIR(0xB2E5, 0xAFE8)
+DOUBLE_BYTE_PAIR(0xB2E6, 0xAFE9)
+DOUBLE_BYTE_PAIR(0xB2E7, 0xAFF0)
+DOUBLE_BYTE_PAIR(0xB2E8, 0xAFF1)
+DOUBLE_BYTE_PAIR(0xB2E9, 0xAFF4)
+DOUBLE_BYTE_PAIR(0xB2EA, 0xAFF8)
+DOUBLE_BYTE_PAIR(0xB2EB, 0xB000)
+DOUBLE_BYTE_PAIR(0xB2EC, 0xB001)
+DOUBLE_BYTE_PAIR(0xB2ED, 0xB004)
+DOUBLE_BYTE_PAIR(0xB2EE, 0xB00C)
+DOUBLE_BYTE_PAIR(0xB2EF, 0xB010)
+DOUBLE_BYTE_PAIR(0xB2F0, 0xB014)
+DOUBLE_BYTE_PAIR(0xB2F1, 0xB01C)
+DOUBLE_BYTE_PAIR(0xB2F2, 0xB01D)
+DOUBLE_BYTE_PAIR(0xB2F3, 0xB028)
+DOUBLE_BYTE_PAIR(0xB2F4, 0xB044)
+DOUBLE_BYTE_PAIR(0xB2F5, 0xB045)
+DOUBLE_BYTE_PAIR(0xB2F6, 0xB048)
+DOUBLE_BYTE_PAIR(0xB2F7, 0xB04A)
+DOUBLE_BYTE_PAIR(0xB2F8, 0xB04C)
+DOUBLE_BYTE_PAIR(0xB2F9, 0xB04E)
+DOUBLE_BYTE_PAIR(0xB2FA, 0xB053)
+DOUBLE_BYTE_PAIR(0xB2FB, 0xB054)
+DOUBLE_BYTE_PAIR(0xB2FC, 0xB055)
+DOUBLE_BYTE_PAIR(0xB2FD, 0xB057)
+DOUBLE_BYTE_PAIR(0xB2FE, 0xB059)
+DOUBLE_BYTE_PAIR(0xB341, 0xCFCC)
+DOUBLE_BYTE_PAIR(0xB342, 0xCFCD)
+DOUBLE_BYTE_PAIR(0xB343, 0xCFCE)
+DOUBLE_BYTE_PAIR(0xB344, 0xCFCF)
+DOUBLE_BYTE_PAIR(0xB345, 0xCFD0)
+DOUBLE_BYTE_PAIR(0xB346, 0xCFD1)
+DOUBLE_BYTE_PAIR(0xB347, 0xCFD2)
+DOUBLE_BYTE_PAIR(0xB348, 0xCFD3)
+DOUBLE_BYTE_PAIR(0xB349, 0xCFD4)
+DOUBLE_BYTE_PAIR(0xB34A, 0xCFD5)
+DOUBLE_BYTE_PAIR(0xB34B, 0xCFD6)
+DOUBLE_BYTE_PAIR(0xB34C, 0xCFD7)
+DOUBLE_BYTE_PAIR(0xB34D, 0xCFD8)
+DOUBLE_BYTE_PAIR(0xB34E, 0xCFD9)
+DOUBLE_BYTE_PAIR(0xB34F, 0xCFDA)
+DOUBLE_BYTE_PAIR(0xB350, 0xCFDB)
+DOUBLE_BYTE_PAIR(0xB351, 0xCFDC)
+DOUBLE_BYTE_PAIR(0xB352, 0xCFDD)
+DOUBLE_BYTE_PAIR(0xB353, 0xCFDE)
+DOUBLE_BYTE_PAIR(0xB354, 0xCFDF)
+DOUBLE_BYTE_PAIR(0xB355, 0xCFE2)
+DOUBLE_BYTE_PAIR(0xB356, 0xCFE3)
+DOUBLE_BYTE_PAIR(0xB357, 0xCFE5)
+DOUBLE_BYTE_PAIR(0xB358, 0xCFE6)
+DOUBLE_BYTE_PAIR(0xB359, 0xCFE7)
+DOUBLE_BYTE_PAIR(0xB35A, 0xCFE9)
+DOUBLE_BYTE_PAIR(0xB361, 0xCFEA)
+DOUBLE_BYTE_PAIR(0xB362, 0xCFEB)
+DOUBLE_BYTE_PAIR(0xB363, 0xCFEC)
+DOUBLE_BYTE_PAIR(0xB364, 0xCFED)
+DOUBLE_BYTE_PAIR(0xB365, 0xCFEE)
+DOUBLE_BYTE_PAIR(0xB366, 0xCFEF)
+DOUBLE_BYTE_PAIR(0xB367, 0xCFF2)
+DOUBLE_BYTE_PAIR(0xB368, 0xCFF4)
+DOUBLE_BYTE_PAIR(0xB369, 0xCFF6)
+DOUBLE_BYTE_PAIR(0xB36A, 0xCFF7)
+DOUBLE_BYTE_PAIR(0xB36B, 0xCFF8)
+DOUBLE_BYTE_PAIR(0xB36C, 0xCFF9)
+DOUBLE_BYTE_PAIR(0xB36D, 0xCFFA)
+DOUBLE_BYTE_PAIR(0xB36E, 0xCFFB)
+DOUBLE_BYTE_PAIR(0xB36F, 0xCFFD)
+DOUBLE_BYTE_PAIR(0xB370, 0xCFFE)
+DOUBLE_BYTE_PAIR(0xB371, 0xCFFF)
+DOUBLE_BYTE_PAIR(0xB372, 0xD001)
+DOUBLE_BYTE_PAIR(0xB373, 0xD002)
+DOUBLE_BYTE_PAIR(0xB374, 0xD003)
+DOUBLE_BYTE_PAIR(0xB375, 0xD005)
+DOUBLE_BYTE_PAIR(0xB376, 0xD006)
+DOUBLE_BYTE_PAIR(0xB377, 0xD007)
+DOUBLE_BYTE_PAIR(0xB378, 0xD008)
+DOUBLE_BYTE_PAIR(0xB379, 0xD009)
+DOUBLE_BYTE_PAIR(0xB37A, 0xD00A)
+DOUBLE_BYTE_PAIR(0xB381, 0xD00B)
+DOUBLE_BYTE_PAIR(0xB382, 0xD00C)
+DOUBLE_BYTE_PAIR(0xB383, 0xD00D)
+DOUBLE_BYTE_PAIR(0xB384, 0xD00E)
+DOUBLE_BYTE_PAIR(0xB385, 0xD00F)
+DOUBLE_BYTE_PAIR(0xB386, 0xD010)
+DOUBLE_BYTE_PAIR(0xB387, 0xD012)
+DOUBLE_BYTE_PAIR(0xB388, 0xD013)
+DOUBLE_BYTE_PAIR(0xB389, 0xD014)
+DOUBLE_BYTE_PAIR(0xB38A, 0xD015)
+DOUBLE_BYTE_PAIR(0xB38B, 0xD016)
+DOUBLE_BYTE_PAIR(0xB38C, 0xD017)
+DOUBLE_BYTE_PAIR(0xB38D, 0xD019)
+DOUBLE_BYTE_PAIR(0xB38E, 0xD01A)
+DOUBLE_BYTE_PAIR(0xB38F, 0xD01B)
+DOUBLE_BYTE_PAIR(0xB390, 0xD01C)
+DOUBLE_BYTE_PAIR(0xB391, 0xD01D)
+DOUBLE_BYTE_PAIR(0xB392, 0xD01E)
+DOUBLE_BYTE_PAIR(0xB393, 0xD01F)
+DOUBLE_BYTE_PAIR(0xB394, 0xD020)
+DOUBLE_BYTE_PAIR(0xB395, 0xD021)
+DOUBLE_BYTE_PAIR(0xB396, 0xD022)
+DOUBLE_BYTE_PAIR(0xB397, 0xD023)
+DOUBLE_BYTE_PAIR(0xB398, 0xD024)
+DOUBLE_BYTE_PAIR(0xB399, 0xD025)
+DOUBLE_BYTE_PAIR(0xB39A, 0xD026)
+DOUBLE_BYTE_PAIR(0xB39B, 0xD027)
+DOUBLE_BYTE_PAIR(0xB39C, 0xD028)
+DOUBLE_BYTE_PAIR(0xB39D, 0xD029)
+DOUBLE_BYTE_PAIR(0xB39E, 0xD02A)
+DOUBLE_BYTE_PAIR(0xB39F, 0xD02B)
+DOUBLE_BYTE_PAIR(0xB3A0, 0xD02C)
+DOUBLE_BYTE_PAIR(0xB3A1, 0xB05D)
+DOUBLE_BYTE_PAIR(0xB3A2, 0xB07C)
+DOUBLE_BYTE_PAIR(0xB3A3, 0xB07D)
+DOUBLE_BYTE_PAIR(0xB3A4, 0xB080)
+DOUBLE_BYTE_PAIR(0xB3A5, 0xB084)
+DOUBLE_BYTE_PAIR(0xB3A6, 0xB08C)
+DOUBLE_BYTE_PAIR(0xB3A7, 0xB08D)
+DOUBLE_BYTE_PAIR(0xB3A8, 0xB08F)
+DOUBLE_BYTE_PAIR(0xB3A9, 0xB091)
+DOUBLE_BYTE_PAIR(0xB3AA, 0xB098)
+DOUBLE_BYTE_PAIR(0xB3AB, 0xB099)
+DOUBLE_BYTE_PAIR(0xB3AC, 0xB09A)
+DOUBLE_BYTE_PAIR(0xB3AD, 0xB09C)
+DOUBLE_BYTE_PAIR(0xB3AE, 0xB09F)
+DOUBLE_BYTE_PAIR(0xB3AF, 0xB0A0)
+DOUBLE_BYTE_PAIR(0xB3B0, 0xB0A1)
+DOUBLE_BYTE_PAIR(0xB3B1, 0xB0A2)
+DOUBLE_BYTE_PAIR(0xB3B2, 0xB0A8)
+DOUBLE_BYTE_PAIR(0xB3B3, 0xB0A9)
+DOUBLE_BYTE_PAIR(0xB3B4, 0xB0AB)
+DOUBLE_BYTE_PAIR(0xB3B5, 0xB0AC)
+DOUBLE_BYTE_PAIR(0xB3B6, 0xB0AD)
+DOUBLE_BYTE_PAIR(0xB3B7, 0xB0AE)
+DOUBLE_BYTE_PAIR(0xB3B8, 0xB0AF)
+DOUBLE_BYTE_PAIR(0xB3B9, 0xB0B1)
+DOUBLE_BYTE_PAIR(0xB3BA, 0xB0B3)
+DOUBLE_BYTE_PAIR(0xB3BB, 0xB0B4)
+DOUBLE_BYTE_PAIR(0xB3BC, 0xB0B5)
+DOUBLE_BYTE_PAIR(0xB3BD, 0xB0B8)
+DOUBLE_BYTE_PAIR(0xB3BE, 0xB0BC)
+DOUBLE_BYTE_PAIR(0xB3BF, 0xB0C4)
+DOUBLE_BYTE_PAIR(0xB3C0, 0xB0C5)
+DOUBLE_BYTE_PAIR(0xB3C1, 0xB0C7)
+DOUBLE_BYTE_PAIR(0xB3C2, 0xB0C8)
+DOUBLE_BYTE_PAIR(0xB3C3, 0xB0C9)
+DOUBLE_BYTE_PAIR(0xB3C4, 0xB0D0)
+DOUBLE_BYTE_PAIR(0xB3C5, 0xB0D1)
+DOUBLE_BYTE_PAIR(0xB3C6, 0xB0D4)
+DOUBLE_BYTE_PAIR(0xB3C7, 0xB0D8)
+DOUBLE_BYTE_PAIR(0xB3C8, 0xB0E0)
+DOUBLE_BYTE_PAIR(0xB3C9, 0xB0E5)
+DOUBLE_BYTE_PAIR(0xB3CA, 0xB108)
+DOUBLE_BYTE_PAIR(0xB3CB, 0xB109)
+DOUBLE_BYTE_PAIR(0xB3CC, 0xB10B)
+DOUBLE_BYTE_PAIR(0xB3CD, 0xB10C)
+DOUBLE_BYTE_PAIR(0xB3CE, 0xB110)
+DOUBLE_BYTE_PAIR(0xB3CF, 0xB112)
+DOUBLE_BYTE_PAIR(0xB3D0, 0xB113)
+DOUBLE_BYTE_PAIR(0xB3D1, 0xB118)
+DOUBLE_BYTE_PAIR(0xB3D2, 0xB119)
+DOUBLE_BYTE_PAIR(0xB3D3, 0xB11B)
+DOUBLE_BYTE_PAIR(0xB3D4, 0xB11C)
+DOUBLE_BYTE_PAIR(0xB3D5, 0xB11D)
+DOUBLE_BYTE_PAIR(0xB3D6, 0xB123)
+DOUBLE_BYTE_PAIR(0xB3D7, 0xB124)
+DOUBLE_BYTE_PAIR(0xB3D8, 0xB125)
+DOUBLE_BYTE_PAIR(0xB3D9, 0xB128)
+DOUBLE_BYTE_PAIR(0xB3DA, 0xB12C)
+DOUBLE_BYTE_PAIR(0xB3DB, 0xB134)
+DOUBLE_BYTE_PAIR(0xB3DC, 0xB135)
+DOUBLE_BYTE_PAIR(0xB3DD, 0xB137)
+DOUBLE_BYTE_PAIR(0xB3DE, 0xB138)
+DOUBLE_BYTE_PAIR(0xB3DF, 0xB139)
+DOUBLE_BYTE_PAIR(0xB3E0, 0xB140)
+DOUBLE_BYTE_PAIR(0xB3E1, 0xB141)
+DOUBLE_BYTE_PAIR(0xB3E2, 0xB144)
+DOUBLE_BYTE_PAIR(0xB3E3, 0xB148)
+DOUBLE_BYTE_PAIR(0xB3E4, 0xB150)
+DOUBLE_BYTE_PAIR(0xB3E5, 0xB151)
+DOUBLE_BYTE_PAIR(0xB3E6, 0xB154)
+DOUBLE_BYTE_PAIR(0xB3E7, 0xB155)
+DOUBLE_BYTE_PAIR(0xB3E8, 0xB158)
+DOUBLE_BYTE_PAIR(0xB3E9, 0xB15C)
+DOUBLE_BYTE_PAIR(0xB3EA, 0xB160)
+DOUBLE_BYTE_PAIR(0xB3EB, 0xB178)
+DOUBLE_BYTE_PAIR(0xB3EC, 0xB179)
+DOUBLE_BYTE_PAIR(0xB3ED, 0xB17C)
+DOUBLE_BYTE_PAIR(0xB3EE, 0xB180)
+DOUBLE_BYTE_PAIR(0xB3EF, 0xB182)
+DOUBLE_BYTE_PAIR(0xB3F0, 0xB188)
+DOUBLE_BYTE_PAIR(0xB3F1, 0xB189)
+DOUBLE_BYTE_PAIR(0xB3F2, 0xB18B)
+DOUBLE_BYTE_PAIR(0xB3F3, 0xB18D)
+DOUBLE_BYTE_PAIR(0xB3F4, 0xB192)
+DOUBLE_BYTE_PAIR(0xB3F5, 0xB193)
+DOUBLE_BYTE_PAIR(0xB3F6, 0xB194)
+DOUBLE_BYTE_PAIR(0xB3F7, 0xB198)
+DOUBLE_BYTE_PAIR(0xB3F8, 0xB19C)
+DOUBLE_BYTE_PAIR(0xB3F9, 0xB1A8)
+DOUBLE_BYTE_PAIR(0xB3FA, 0xB1CC)
+DOUBLE_BYTE_PAIR(0xB3FB, 0xB1D0)
+DOUBLE_BYTE_PAIR(0xB3FC, 0xB1D4)
+DOUBLE_BYTE_PAIR(0xB3FD, 0xB1DC)
+DOUBLE_BYTE_PAIR(0xB3FE, 0xB1DD)
+DOUBLE_BYTE_PAIR(0xB441, 0xD02E)
+DOUBLE_BYTE_PAIR(0xB442, 0xD02F)
+DOUBLE_BYTE_PAIR(0xB443, 0xD030)
+DOUBLE_BYTE_PAIR(0xB444, 0xD031)
+DOUBLE_BYTE_PAIR(0xB445, 0xD032)
+DOUBLE_BYTE_PAIR(0xB446, 0xD033)
+DOUBLE_BYTE_PAIR(0xB447, 0xD036)
+DOUBLE_BYTE_PAIR(0xB448, 0xD037)
+DOUBLE_BYTE_PAIR(0xB449, 0xD039)
+DOUBLE_BYTE_PAIR(0xB44A, 0xD03A)
+DOUBLE_BYTE_PAIR(0xB44B, 0xD03B)
+DOUBLE_BYTE_PAIR(0xB44C, 0xD03D)
+DOUBLE_BYTE_PAIR(0xB44D, 0xD03E)
+DOUBLE_BYTE_PAIR(0xB44E, 0xD03F)
+DOUBLE_BYTE_PAIR(0xB44F, 0xD040)
+DOUBLE_BYTE_PAIR(0xB450, 0xD041)
+DOUBLE_BYTE_PAIR(0xB451, 0xD042)
+DOUBLE_BYTE_PAIR(0xB452, 0xD043)
+DOUBLE_BYTE_PAIR(0xB453, 0xD046)
+DOUBLE_BYTE_PAIR(0xB454, 0xD048)
+DOUBLE_BYTE_PAIR(0xB455, 0xD04A)
+DOUBLE_BYTE_PAIR(0xB456, 0xD04B)
+DOUBLE_BYTE_PAIR(0xB457, 0xD04C)
+DOUBLE_BYTE_PAIR(0xB458, 0xD04D)
+DOUBLE_BYTE_PAIR(0xB459, 0xD04E)
+DOUBLE_BYTE_PAIR(0xB45A, 0xD04F)
+DOUBLE_BYTE_PAIR(0xB461, 0xD051)
+DOUBLE_BYTE_PAIR(0xB462, 0xD052)
+DOUBLE_BYTE_PAIR(0xB463, 0xD053)
+DOUBLE_BYTE_PAIR(0xB464, 0xD055)
+DOUBLE_BYTE_PAIR(0xB465, 0xD056)
+DOUBLE_BYTE_PAIR(0xB466, 0xD057)
+DOUBLE_BYTE_PAIR(0xB467, 0xD059)
+DOUBLE_BYTE_PAIR(0xB468, 0xD05A)
+DOUBLE_BYTE_PAIR(0xB469, 0xD05B)
+DOUBLE_BYTE_PAIR(0xB46A, 0xD05C)
+DOUBLE_BYTE_PAIR(0xB46B, 0xD05D)
+DOUBLE_BYTE_PAIR(0xB46C, 0xD05E)
+DOUBLE_BYTE_PAIR(0xB46D, 0xD05F)
+DOUBLE_BYTE_PAIR(0xB46E, 0xD061)
+DOUBLE_BYTE_PAIR(0xB46F, 0xD062)
+DOUBLE_BYTE_PAIR(0xB470, 0xD063)
+DOUBLE_BYTE_PAIR(0xB471, 0xD064)
+DOUBLE_BYTE_PAIR(0xB472, 0xD065)
+DOUBLE_BYTE_PAIR(0xB473, 0xD066)
+DOUBLE_BYTE_PAIR(0xB474, 0xD067)
+DOUBLE_BYTE_PAIR(0xB475, 0xD068)
+DOUBLE_BYTE_PAIR(0xB476, 0xD069)
+DOUBLE_BYTE_PAIR(0xB477, 0xD06A)
+DOUBLE_BYTE_PAIR(0xB478, 0xD06B)
+DOUBLE_BYTE_PAIR(0xB479, 0xD06E)
+DOUBLE_BYTE_PAIR(0xB47A, 0xD06F)
+DOUBLE_BYTE_PAIR(0xB481, 0xD071)
+DOUBLE_BYTE_PAIR(0xB482, 0xD072)
+DOUBLE_BYTE_PAIR(0xB483, 0xD073)
+DOUBLE_BYTE_PAIR(0xB484, 0xD075)
+DOUBLE_BYTE_PAIR(0xB485, 0xD076)
+DOUBLE_BYTE_PAIR(0xB486, 0xD077)
+DOUBLE_BYTE_PAIR(0xB487, 0xD078)
+DOUBLE_BYTE_PAIR(0xB488, 0xD079)
+DOUBLE_BYTE_PAIR(0xB489, 0xD07A)
+DOUBLE_BYTE_PAIR(0xB48A, 0xD07B)
+DOUBLE_BYTE_PAIR(0xB48B, 0xD07E)
+DOUBLE_BYTE_PAIR(0xB48C, 0xD07F)
+DOUBLE_BYTE_PAIR(0xB48D, 0xD080)
+DOUBLE_BYTE_PAIR(0xB48E, 0xD082)
+DOUBLE_BYTE_PAIR(0xB48F, 0xD083)
+DOUBLE_BYTE_PAIR(0xB490, 0xD084)
+DOUBLE_BYTE_PAIR(0xB491, 0xD085)
+DOUBLE_BYTE_PAIR(0xB492, 0xD086)
+DOUBLE_BYTE_PAIR(0xB493, 0xD087)
+DOUBLE_BYTE_PAIR(0xB494, 0xD088)
+DOUBLE_BYTE_PAIR(0xB495, 0xD089)
+DOUBLE_BYTE_PAIR(0xB496, 0xD08A)
+DOUBLE_BYTE_PAIR(0xB497, 0xD08B)
+DOUBLE_BYTE_PAIR(0xB498, 0xD08C)
+DOUBLE_BYTE_PAIR(0xB499, 0xD08D)
+DOUBLE_BYTE_PAIR(0xB49A, 0xD08E)
+DOUBLE_BYTE_PAIR(0xB49B, 0xD08F)
+DOUBLE_BYTE_PAIR(0xB49C, 0xD090)
+DOUBLE_BYTE_PAIR(0xB49D, 0xD091)
+DOUBLE_BYTE_PAIR(0xB49E, 0xD092)
+DOUBLE_BYTE_PAIR(0xB49F, 0xD093)
+DOUBLE_BYTE_PAIR(0xB4A0, 0xD094)
+DOUBLE_BYTE_PAIR(0xB4A1, 0xB1DF)
+DOUBLE_BYTE_PAIR(0xB4A2, 0xB1E8)
+DOUBLE_BYTE_PAIR(0xB4A3, 0xB1E9)
+DOUBLE_BYTE_PAIR(0xB4A4, 0xB1EC)
+DOUBLE_BYTE_PAIR(0xB4A5, 0xB1F0)
+DOUBLE_BYTE_PAIR(0xB4A6, 0xB1F9)
+DOUBLE_BYTE_PAIR(0xB4A7, 0xB1FB)
+DOUBLE_BYTE_PAIR(0xB4A8, 0xB1FD)
+DOUBLE_BYTE_PAIR(0xB4A9, 0xB204)
+DOUBLE_BYTE_PAIR(0xB4AA, 0xB205)
+DOUBLE_BYTE_PAIR(0xB4AB, 0xB208)
+DOUBLE_BYTE_PAIR(0xB4AC, 0xB20B)
+DOUBLE_BYTE_PAIR(0xB4AD, 0xB20C)
+DOUBLE_BYTE_PAIR(0xB4AE, 0xB214)
+DOUBLE_BYTE_PAIR(0xB4AF, 0xB215)
+DOUBLE_BYTE_PAIR(0xB4B0, 0xB217)
+DOUBLE_BYTE_PAIR(0xB4B1, 0xB219)
+DOUBLE_BYTE_PAIR(0xB4B2, 0xB220)
+DOUBLE_BYTE_PAIR(0xB4B3, 0xB234)
+DOUBLE_BYTE_PAIR(0xB4B4, 0xB23C)
+DOUBLE_BYTE_PAIR(0xB4B5, 0xB258)
+DOUBLE_BYTE_PAIR(0xB4B6, 0xB25C)
+DOUBLE_BYTE_PAIR(0xB4B7, 0xB260)
+DOUBLE_BYTE_PAIR(0xB4B8, 0xB268)
+DOUBLE_BYTE_PAIR(0xB4B9, 0xB269)
+DOUBLE_BYTE_PAIR(0xB4BA, 0xB274)
+DOUBLE_BYTE_PAIR(0xB4BB, 0xB275)
+DOUBLE_BYTE_PAIR(0xB4BC, 0xB27C)
+DOUBLE_BYTE_PAIR(0xB4BD, 0xB284)
+DOUBLE_BYTE_PAIR(0xB4BE, 0xB285)
+DOUBLE_BYTE_PAIR(0xB4BF, 0xB289)
+DOUBLE_BYTE_PAIR(0xB4C0, 0xB290)
+DOUBLE_BYTE_PAIR(0xB4C1, 0xB291)
+DOUBLE_BYTE_PAIR(0xB4C2, 0xB294)
+DOUBLE_BYTE_PAIR(0xB4C3, 0xB298)
+DOUBLE_BYTE_PAIR(0xB4C4, 0xB299)
+DOUBLE_BYTE_PAIR(0xB4C5, 0xB29A)
+DOUBLE_BYTE_PAIR(0xB4C6, 0xB2A0)
+DOUBLE_BYTE_PAIR(0xB4C7, 0xB2A1)
+DOUBLE_BYTE_PAIR(0xB4C8, 0xB2A3)
+DOUBLE_BYTE_PAIR(0xB4C9, 0xB2A5)
+DOUBLE_BYTE_PAIR(0xB4CA, 0xB2A6)
+DOUBLE_BYTE_PAIR(0xB4CB, 0xB2AA)
+DOUBLE_BYTE_PAIR(0xB4CC, 0xB2AC)
+DOUBLE_BYTE_PAIR(0xB4CD, 0xB2B0)
+DOUBLE_BYTE_PAIR(0xB4CE, 0xB2B4)
+DOUBLE_BYTE_PAIR(0xB4CF, 0xB2C8)
+DOUBLE_BYTE_PAIR(0xB4D0, 0xB2C9)
+DOUBLE_BYTE_PAIR(0xB4D1, 0xB2CC)
+DOUBLE_BYTE_PAIR(0xB4D2, 0xB2D0)
+DOUBLE_BYTE_PAIR(0xB4D3, 0xB2D2)
+DOUBLE_BYTE_PAIR(0xB4D4, 0xB2D8)
+DOUBLE_BYTE_PAIR(0xB4D5, 0xB2D9)
+DOUBLE_BYTE_PAIR(0xB4D6, 0xB2DB)
+DOUBLE_BYTE_PAIR(0xB4D7, 0xB2DD)
+DOUBLE_BYTE_PAIR(0xB4D8, 0xB2E2)
+DOUBLE_BYTE_PAIR(0xB4D9, 0xB2E4)
+DOUBLE_BYTE_PAIR(0xB4DA, 0xB2E5)
+DOUBLE_BYTE_PAIR(0xB4DB, 0xB2E6)
+DOUBLE_BYTE_PAIR(0xB4DC, 0xB2E8)
+DOUBLE_BYTE_PAIR(0xB4DD, 0xB2EB)
+DOUBLE_BYTE_PAIR(0xB4DE, 0xB2EC)
+DOUBLE_BYTE_PAIR(0xB4DF, 0xB2ED)
+DOUBLE_BYTE_PAIR(0xB4E0, 0xB2EE)
+DOUBLE_BYTE_PAIR(0xB4E1, 0xB2EF)
+DOUBLE_BYTE_PAIR(0xB4E2, 0xB2F3)
+DOUBLE_BYTE_PAIR(0xB4E3, 0xB2F4)
+DOUBLE_BYTE_PAIR(0xB4E4, 0xB2F5)
+DOUBLE_BYTE_PAIR(0xB4E5, 0xB2F7)
+DOUBLE_BYTE_PAIR(0xB4E6, 0xB2F8)
+DOUBLE_BYTE_PAIR(0xB4E7, 0xB2F9)
+DOUBLE_BYTE_PAIR(0xB4E8, 0xB2FA)
+DOUBLE_BYTE_PAIR(0xB4E9, 0xB2FB)
+DOUBLE_BYTE_PAIR(0xB4EA, 0xB2FF)
+DOUBLE_BYTE_PAIR(0xB4EB, 0xB300)
+DOUBLE_BYTE_PAIR(0xB4EC, 0xB301)
+DOUBLE_BYTE_PAIR(0xB4ED, 0xB304)
+DOUBLE_BYTE_PAIR(0xB4EE, 0xB308)
+DOUBLE_BYTE_PAIR(0xB4EF, 0xB310)
+DOUBLE_BYTE_PAIR(0xB4F0, 0xB311)
+DOUBLE_BYTE_PAIR(0xB4F1, 0xB313)
+DOUBLE_BYTE_PAIR(0xB4F2, 0xB314)
+DOUBLE_BYTE_PAIR(0xB4F3, 0xB315)
+DOUBLE_BYTE_PAIR(0xB4F4, 0xB31C)
+DOUBLE_BYTE_PAIR(0xB4F5, 0xB354)
+DOUBLE_BYTE_PAIR(0xB4F6, 0xB355)
+DOUBLE_BYTE_PAIR(0xB4F7, 0xB356)
+DOUBLE_BYTE_PAIR(0xB4F8, 0xB358)
+DOUBLE_BYTE_PAIR(0xB4F9, 0xB35B)
+DOUBLE_BYTE_PAIR(0xB4FA, 0xB35C)
+DOUBLE_BYTE_PAIR(0xB4FB, 0xB35E)
+DOUBLE_BYTE_PAIR(0xB4FC, 0xB35F)
+DOUBLE_BYTE_PAIR(0xB4FD, 0xB364)
+DOUBLE_BYTE_PAIR(0xB4FE, 0xB365)
+DOUBLE_BYTE_PAIR(0xB541, 0xD095)
+DOUBLE_BYTE_PAIR(0xB542, 0xD096)
+DOUBLE_BYTE_PAIR(0xB543, 0xD097)
+DOUBLE_BYTE_PAIR(0xB544, 0xD098)
+DOUBLE_BYTE_PAIR(0xB545, 0xD099)
+DOUBLE_BYTE_PAIR(0xB546, 0xD09A)
+DOUBLE_BYTE_PAIR(0xB547, 0xD09B)
+DOUBLE_BYTE_PAIR(0xB548, 0xD09C)
+DOUBLE_BYTE_PAIR(0xB549, 0xD09D)
+DOUBLE_BYTE_PAIR(0xB54A, 0xD09E)
+DOUBLE_BYTE_PAIR(0xB54B, 0xD09F)
+DOUBLE_BYTE_PAIR(0xB54C, 0xD0A0)
+DOUBLE_BYTE_PAIR(0xB54D, 0xD0A1)
+DOUBLE_BYTE_PAIR(0xB54E, 0xD0A2)
+DOUBLE_BYTE_PAIR(0xB54F, 0xD0A3)
+DOUBLE_BYTE_PAIR(0xB550, 0xD0A6)
+DOUBLE_BYTE_PAIR(0xB551, 0xD0A7)
+DOUBLE_BYTE_PAIR(0xB552, 0xD0A9)
+DOUBLE_BYTE_PAIR(0xB553, 0xD0AA)
+DOUBLE_BYTE_PAIR(0xB554, 0xD0AB)
+DOUBLE_BYTE_PAIR(0xB555, 0xD0AD)
+DOUBLE_BYTE_PAIR(0xB556, 0xD0AE)
+DOUBLE_BYTE_PAIR(0xB557, 0xD0AF)
+DOUBLE_BYTE_PAIR(0xB558, 0xD0B0)
+DOUBLE_BYTE_PAIR(0xB559, 0xD0B1)
+DOUBLE_BYTE_PAIR(0xB55A, 0xD0B2)
+DOUBLE_BYTE_PAIR(0xB561, 0xD0B3)
+DOUBLE_BYTE_PAIR(0xB562, 0xD0B6)
+DOUBLE_BYTE_PAIR(0xB563, 0xD0B8)
+DOUBLE_BYTE_PAIR(0xB564, 0xD0BA)
+DOUBLE_BYTE_PAIR(0xB565, 0xD0BB)
+DOUBLE_BYTE_PAIR(0xB566, 0xD0BC)
+DOUBLE_BYTE_PAIR(0xB567, 0xD0BD)
+DOUBLE_BYTE_PAIR(0xB568, 0xD0BE)
+DOUBLE_BYTE_PAIR(0xB569, 0xD0BF)
+DOUBLE_BYTE_PAIR(0xB56A, 0xD0C2)
+DOUBLE_BYTE_PAIR(0xB56B, 0xD0C3)
+DOUBLE_BYTE_PAIR(0xB56C, 0xD0C5)
+DOUBLE_BYTE_PAIR(0xB56D, 0xD0C6)
+DOUBLE_BYTE_PAIR(0xB56E, 0xD0C7)
+DOUBLE_BYTE_PAIR(0xB56F, 0xD0CA)
+DOUBLE_BYTE_PAIR(0xB570, 0xD0CB)
+DOUBLE_BYTE_PAIR(0xB571, 0xD0CC)
+DOUBLE_BYTE_PAIR(0xB572, 0xD0CD)
+DOUBLE_BYTE_PAIR(0xB573, 0xD0CE)
+DOUBLE_BYTE_PAIR(0xB574, 0xD0CF)
+DOUBLE_BYTE_PAIR(0xB575, 0xD0D2)
+DOUBLE_BYTE_PAIR(0xB576, 0xD0D6)
+DOUBLE_BYTE_PAIR(0xB577, 0xD0D7)
+DOUBLE_BYTE_PAIR(0xB578, 0xD0D8)
+DOUBLE_BYTE_PAIR(0xB579, 0xD0D9)
+DOUBLE_BYTE_PAIR(0xB57A, 0xD0DA)
+DOUBLE_BYTE_PAIR(0xB581, 0xD0DB)
+DOUBLE_BYTE_PAIR(0xB582, 0xD0DE)
+DOUBLE_BYTE_PAIR(0xB583, 0xD0DF)
+DOUBLE_BYTE_PAIR(0xB584, 0xD0E1)
+DOUBLE_BYTE_PAIR(0xB585, 0xD0E2)
+DOUBLE_BYTE_PAIR(0xB586, 0xD0E3)
+DOUBLE_BYTE_PAIR(0xB587, 0xD0E5)
+DOUBLE_BYTE_PAIR(0xB588, 0xD0E6)
+DOUBLE_BYTE_PAIR(0xB589, 0xD0E7)
+DOUBLE_BYTE_PAIR(0xB58A, 0xD0E8)
+DOUBLE_BYTE_PAIR(0xB58B, 0xD0E9)
+DOUBLE_BYTE_PAIR(0xB58C, 0xD0EA)
+DOUBLE_BYTE_PAIR(0xB58D, 0xD0EB)
+DOUBLE_BYTE_PAIR(0xB58E, 0xD0EE)
+DOUBLE_BYTE_PAIR(0xB58F, 0xD0F2)
+DOUBLE_BYTE_PAIR(0xB590, 0xD0F3)
+DOUBLE_BYTE_PAIR(0xB591, 0xD0F4)
+DOUBLE_BYTE_PAIR(0xB592, 0xD0F5)
+DOUBLE_BYTE_PAIR(0xB593, 0xD0F6)
+DOUBLE_BYTE_PAIR(0xB594, 0xD0F7)
+DOUBLE_BYTE_PAIR(0xB595, 0xD0F9)
+DOUBLE_BYTE_PAIR(0xB596, 0xD0FA)
+DOUBLE_BYTE_PAIR(0xB597, 0xD0FB)
+DOUBLE_BYTE_PAIR(0xB598, 0xD0FC)
+DOUBLE_BYTE_PAIR(0xB599, 0xD0FD)
+DOUBLE_BYTE_PAIR(0xB59A, 0xD0FE)
+DOUBLE_BYTE_PAIR(0xB59B, 0xD0FF)
+DOUBLE_BYTE_PAIR(0xB59C, 0xD100)
+DOUBLE_BYTE_PAIR(0xB59D, 0xD101)
+DOUBLE_BYTE_PAIR(0xB59E, 0xD102)
+DOUBLE_BYTE_PAIR(0xB59F, 0xD103)
+DOUBLE_BYTE_PAIR(0xB5A0, 0xD104)
+DOUBLE_BYTE_PAIR(0xB5A1, 0xB367)
+DOUBLE_BYTE_PAIR(0xB5A2, 0xB369)
+DOUBLE_BYTE_PAIR(0xB5A3, 0xB36B)
+DOUBLE_BYTE_PAIR(0xB5A4, 0xB36E)
+DOUBLE_BYTE_PAIR(0xB5A5, 0xB370)
+DOUBLE_BYTE_PAIR(0xB5A6, 0xB371)
+DOUBLE_BYTE_PAIR(0xB5A7, 0xB374)
+DOUBLE_BYTE_PAIR(0xB5A8, 0xB378)
+DOUBLE_BYTE_PAIR(0xB5A9, 0xB380)
+DOUBLE_BYTE_PAIR(0xB5AA, 0xB381)
+DOUBLE_BYTE_PAIR(0xB5AB, 0xB383)
+DOUBLE_BYTE_PAIR(0xB5AC, 0xB384)
+DOUBLE_BYTE_PAIR(0xB5AD, 0xB385)
+DOUBLE_BYTE_PAIR(0xB5AE, 0xB38C)
+DOUBLE_BYTE_PAIR(0xB5AF, 0xB390)
+DOUBLE_BYTE_PAIR(0xB5B0, 0xB394)
+DOUBLE_BYTE_PAIR(0xB5B1, 0xB3A0)
+DOUBLE_BYTE_PAIR(0xB5B2, 0xB3A1)
+DOUBLE_BYTE_PAIR(0xB5B3, 0xB3A8)
+DOUBLE_BYTE_PAIR(0xB5B4, 0xB3AC)
+DOUBLE_BYTE_PAIR(0xB5B5, 0xB3C4)
+DOUBLE_BYTE_PAIR(0xB5B6, 0xB3C5)
+DOUBLE_BYTE_PAIR(0xB5B7, 0xB3C8)
+DOUBLE_BYTE_PAIR(0xB5B8, 0xB3CB)
+DOUBLE_BYTE_PAIR(0xB5B9, 0xB3CC)
+DOUBLE_BYTE_PAIR(0xB5BA, 0xB3CE)
+DOUBLE_BYTE_PAIR(0xB5BB, 0xB3D0)
+DOUBLE_BYTE_PAIR(0xB5BC, 0xB3D4)
+DOUBLE_BYTE_PAIR(0xB5BD, 0xB3D5)
+DOUBLE_BYTE_PAIR(0xB5BE, 0xB3D7)
+DOUBLE_BYTE_PAIR(0xB5BF, 0xB3D9)
+DOUBLE_BYTE_PAIR(0xB5C0, 0xB3DB)
+DOUBLE_BYTE_PAIR(0xB5C1, 0xB3DD)
+DOUBLE_BYTE_PAIR(0xB5C2, 0xB3E0)
+DOUBLE_BYTE_PAIR(0xB5C3, 0xB3E4)
+DOUBLE_BYTE_PAIR(0xB5C4, 0xB3E8)
+DOUBLE_BYTE_PAIR(0xB5C5, 0xB3FC)
+DOUBLE_BYTE_PAIR(0xB5C6, 0xB410)
+DOUBLE_BYTE_PAIR(0xB5C7, 0xB418)
+DOUBLE_BYTE_PAIR(0xB5C8, 0xB41C)
+DOUBLE_BYTE_PAIR(0xB5C9, 0xB420)
+DOUBLE_BYTE_PAIR(0xB5CA, 0xB428)
+DOUBLE_BYTE_PAIR(0xB5CB, 0xB429)
+DOUBLE_BYTE_PAIR(0xB5CC, 0xB42B)
+DOUBLE_BYTE_PAIR(0xB5CD, 0xB434)
+DOUBLE_BYTE_PAIR(0xB5CE, 0xB450)
+DOUBLE_BYTE_PAIR(0xB5CF, 0xB451)
+DOUBLE_BYTE_PAIR(0xB5D0, 0xB454)
+DOUBLE_BYTE_PAIR(0xB5D1, 0xB458)
+DOUBLE_BYTE_PAIR(0xB5D2, 0xB460)
+DOUBLE_BYTE_PAIR(0xB5D3, 0xB461)
+DOUBLE_BYTE_PAIR(0xB5D4, 0xB463)
+DOUBLE_BYTE_PAIR(0xB5D5, 0xB465)
+DOUBLE_BYTE_PAIR(0xB5D6, 0xB46C)
+DOUBLE_BYTE_PAIR(0xB5D7, 0xB480)
+DOUBLE_BYTE_PAIR(0xB5D8, 0xB488)
+DOUBLE_BYTE_PAIR(0xB5D9, 0xB49D)
+DOUBLE_BYTE_PAIR(0xB5DA, 0xB4A4)
+DOUBLE_BYTE_PAIR(0xB5DB, 0xB4A8)
+DOUBLE_BYTE_PAIR(0xB5DC, 0xB4AC)
+DOUBLE_BYTE_PAIR(0xB5DD, 0xB4B5)
+DOUBLE_BYTE_PAIR(0xB5DE, 0xB4B7)
+DOUBLE_BYTE_PAIR(0xB5DF, 0xB4B9)
+DOUBLE_BYTE_PAIR(0xB5E0, 0xB4C0)
+DOUBLE_BYTE_PAIR(0xB5E1, 0xB4C4)
+DOUBLE_BYTE_PAIR(0xB5E2, 0xB4C8)
+DOUBLE_BYTE_PAIR(0xB5E3, 0xB4D0)
+DOUBLE_BYTE_PAIR(0xB5E4, 0xB4D5)
+DOUBLE_BYTE_PAIR(0xB5E5, 0xB4DC)
+DOUBLE_BYTE_PAIR(0xB5E6, 0xB4DD)
+DOUBLE_BYTE_PAIR(0xB5E7, 0xB4E0)
+DOUBLE_BYTE_PAIR(0xB5E8, 0xB4E3)
+DOUBLE_BYTE_PAIR(0xB5E9, 0xB4E4)
+DOUBLE_BYTE_PAIR(0xB5EA, 0xB4E6)
+DOUBLE_BYTE_PAIR(0xB5EB, 0xB4EC)
+DOUBLE_BYTE_PAIR(0xB5EC, 0xB4ED)
+DOUBLE_BYTE_PAIR(0xB5ED, 0xB4EF)
+DOUBLE_BYTE_PAIR(0xB5EE, 0xB4F1)
+DOUBLE_BYTE_PAIR(0xB5EF, 0xB4F8)
+DOUBLE_BYTE_PAIR(0xB5F0, 0xB514)
+DOUBLE_BYTE_PAIR(0xB5F1, 0xB515)
+DOUBLE_BYTE_PAIR(0xB5F2, 0xB518)
+DOUBLE_BYTE_PAIR(0xB5F3, 0xB51B)
+DOUBLE_BYTE_PAIR(0xB5F4, 0xB51C)
+DOUBLE_BYTE_PAIR(0xB5F5, 0xB524)
+DOUBLE_BYTE_PAIR(0xB5F6, 0xB525)
+DOUBLE_BYTE_PAIR(0xB5F7, 0xB527)
+DOUBLE_BYTE_PAIR(0xB5F8, 0xB528)
+DOUBLE_BYTE_PAIR(0xB5F9, 0xB529)
+DOUBLE_BYTE_PAIR(0xB5FA, 0xB52A)
+DOUBLE_BYTE_PAIR(0xB5FB, 0xB530)
+DOUBLE_BYTE_PAIR(0xB5FC, 0xB531)
+DOUBLE_BYTE_PAIR(0xB5FD, 0xB534)
+DOUBLE_BYTE_PAIR(0xB5FE, 0xB538)
+DOUBLE_BYTE_PAIR(0xB641, 0xD105)
+DOUBLE_BYTE_PAIR(0xB642, 0xD106)
+DOUBLE_BYTE_PAIR(0xB643, 0xD107)
+DOUBLE_BYTE_PAIR(0xB644, 0xD108)
+DOUBLE_BYTE_PAIR(0xB645, 0xD109)
+DOUBLE_BYTE_PAIR(0xB646, 0xD10A)
+DOUBLE_BYTE_PAIR(0xB647, 0xD10B)
+DOUBLE_BYTE_PAIR(0xB648, 0xD10C)
+DOUBLE_BYTE_PAIR(0xB649, 0xD10E)
+DOUBLE_BYTE_PAIR(0xB64A, 0xD10F)
+DOUBLE_BYTE_PAIR(0xB64B, 0xD110)
+DOUBLE_BYTE_PAIR(0xB64C, 0xD111)
+DOUBLE_BYTE_PAIR(0xB64D, 0xD112)
+DOUBLE_BYTE_PAIR(0xB64E, 0xD113)
+DOUBLE_BYTE_PAIR(0xB64F, 0xD114)
+DOUBLE_BYTE_PAIR(0xB650, 0xD115)
+DOUBLE_BYTE_PAIR(0xB651, 0xD116)
+DOUBLE_BYTE_PAIR(0xB652, 0xD117)
+DOUBLE_BYTE_PAIR(0xB653, 0xD118)
+DOUBLE_BYTE_PAIR(0xB654, 0xD119)
+DOUBLE_BYTE_PAIR(0xB655, 0xD11A)
+DOUBLE_BYTE_PAIR(0xB656, 0xD11B)
+DOUBLE_BYTE_PAIR(0xB657, 0xD11C)
+DOUBLE_BYTE_PAIR(0xB658, 0xD11D)
+DOUBLE_BYTE_PAIR(0xB659, 0xD11E)
+DOUBLE_BYTE_PAIR(0xB65A, 0xD11F)
+DOUBLE_BYTE_PAIR(0xB661, 0xD120)
+DOUBLE_BYTE_PAIR(0xB662, 0xD121)
+DOUBLE_BYTE_PAIR(0xB663, 0xD122)
+DOUBLE_BYTE_PAIR(0xB664, 0xD123)
+DOUBLE_BYTE_PAIR(0xB665, 0xD124)
+DOUBLE_BYTE_PAIR(0xB666, 0xD125)
+DOUBLE_BYTE_PAIR(0xB667, 0xD126)
+DOUBLE_BYTE_PAIR(0xB668, 0xD127)
+DOUBLE_BYTE_PAIR(0xB669, 0xD128)
+DOUBLE_BYTE_PAIR(0xB66A, 0xD129)
+DOUBLE_BYTE_PAIR(0xB66B, 0xD12A)
+DOUBLE_BYTE_PAIR(0xB66C, 0xD12B)
+DOUBLE_BYTE_PAIR(0xB66D, 0xD12C)
+DOUBLE_BYTE_PAIR(0xB66E, 0xD12D)
+DOUBLE_BYTE_PAIR(0xB66F, 0xD12E)
+DOUBLE_BYTE_PAIR(0xB670, 0xD12F)
+DOUBLE_BYTE_PAIR(0xB671, 0xD132)
+DOUBLE_BYTE_PAIR(0xB672, 0xD133)
+DOUBLE_BYTE_PAIR(0xB673, 0xD135)
+DOUBLE_BYTE_PAIR(0xB674, 0xD136)
+DOUBLE_BYTE_PAIR(0xB675, 0xD137)
+DOUBLE_BYTE_PAIR(0xB676, 0xD139)
+DOUBLE_BYTE_PAIR(0xB677, 0xD13B)
+DOUBLE_BYTE_PAIR(0xB678, 0xD13C)
+DOUBLE_BYTE_PAIR(0xB679, 0xD13D)
+DOUBLE_BYTE_PAIR(0xB67A, 0xD13E)
+DOUBLE_BYTE_PAIR(0xB681, 0xD13F)
+DOUBLE_BYTE_PAIR(0xB682, 0xD142)
+DOUBLE_BYTE_PAIR(0xB683, 0xD146)
+DOUBLE_BYTE_PAIR(0xB684, 0xD147)
+DOUBLE_BYTE_PAIR(0xB685, 0xD148)
+DOUBLE_BYTE_PAIR(0xB686, 0xD149)
+DOUBLE_BYTE_PAIR(0xB687, 0xD14A)
+DOUBLE_BYTE_PAIR(0xB688, 0xD14B)
+DOUBLE_BYTE_PAIR(0xB689, 0xD14E)
+DOUBLE_BYTE_PAIR(0xB68A, 0xD14F)
+DOUBLE_BYTE_PAIR(0xB68B, 0xD151)
+DOUBLE_BYTE_PAIR(0xB68C, 0xD152)
+DOUBLE_BYTE_PAIR(0xB68D, 0xD153)
+DOUBLE_BYTE_PAIR(0xB68E, 0xD155)
+DOUBLE_BYTE_PAIR(0xB68F, 0xD156)
+DOUBLE_BYTE_PAIR(0xB690, 0xD157)
+DOUBLE_BYTE_PAIR(0xB691, 0xD158)
+DOUBLE_BYTE_PAIR(0xB692, 0xD159)
+DOUBLE_BYTE_PAIR(0xB693, 0xD15A)
+DOUBLE_BYTE_PAIR(0xB694, 0xD15B)
+DOUBLE_BYTE_PAIR(0xB695, 0xD15E)
+DOUBLE_BYTE_PAIR(0xB696, 0xD160)
+DOUBLE_BYTE_PAIR(0xB697, 0xD162)
+DOUBLE_BYTE_PAIR(0xB698, 0xD163)
+DOUBLE_BYTE_PAIR(0xB699, 0xD164)
+DOUBLE_BYTE_PAIR(0xB69A, 0xD165)
+DOUBLE_BYTE_PAIR(0xB69B, 0xD166)
+DOUBLE_BYTE_PAIR(0xB69C, 0xD167)
+DOUBLE_BYTE_PAIR(0xB69D, 0xD169)
+DOUBLE_BYTE_PAIR(0xB69E, 0xD16A)
+DOUBLE_BYTE_PAIR(0xB69F, 0xD16B)
+DOUBLE_BYTE_PAIR(0xB6A0, 0xD16D)
+DOUBLE_BYTE_PAIR(0xB6A1, 0xB540)
+DOUBLE_BYTE_PAIR(0xB6A2, 0xB541)
+DOUBLE_BYTE_PAIR(0xB6A3, 0xB543)
+DOUBLE_BYTE_PAIR(0xB6A4, 0xB544)
+DOUBLE_BYTE_PAIR(0xB6A5, 0xB545)
+DOUBLE_BYTE_PAIR(0xB6A6, 0xB54B)
+DOUBLE_BYTE_PAIR(0xB6A7, 0xB54C)
+DOUBLE_BYTE_PAIR(0xB6A8, 0xB54D)
+DOUBLE_BYTE_PAIR(0xB6A9, 0xB550)
+DOUBLE_BYTE_PAIR(0xB6AA, 0xB554)
+DOUBLE_BYTE_PAIR(0xB6AB, 0xB55C)
+DOUBLE_BYTE_PAIR(0xB6AC, 0xB55D)
+DOUBLE_BYTE_PAIR(0xB6AD, 0xB55F)
+DOUBLE_BYTE_PAIR(0xB6AE, 0xB560)
+DOUBLE_BYTE_PAIR(0xB6AF, 0xB561)
+DOUBLE_BYTE_PAIR(0xB6B0, 0xB5A0)
+DOUBLE_BYTE_PAIR(0xB6B1, 0xB5A1)
+DOUBLE_BYTE_PAIR(0xB6B2, 0xB5A4)
+DOUBLE_BYTE_PAIR(0xB6B3, 0xB5A8)
+DOUBLE_BYTE_PAIR(0xB6B4, 0xB5AA)
+DOUBLE_BYTE_PAIR(0xB6B5, 0xB5AB)
+DOUBLE_BYTE_PAIR(0xB6B6, 0xB5B0)
+DOUBLE_BYTE_PAIR(0xB6B7, 0xB5B1)
+DOUBLE_BYTE_PAIR(0xB6B8, 0xB5B3)
+DOUBLE_BYTE_PAIR(0xB6B9, 0xB5B4)
+DOUBLE_BYTE_PAIR(0xB6BA, 0xB5B5)
+DOUBLE_BYTE_PAIR(0xB6BB, 0xB5BB)
+DOUBLE_BYTE_PAIR(0xB6BC, 0xB5BC)
+DOUBLE_BYTE_PAIR(0xB6BD, 0xB5BD)
+DOUBLE_BYTE_PAIR(0xB6BE, 0xB5C0)
+DOUBLE_BYTE_PAIR(0xB6BF, 0xB5C4)
+DOUBLE_BYTE_PAIR(0xB6C0, 0xB5CC)
+DOUBLE_BYTE_PAIR(0xB6C1, 0xB5CD)
+DOUBLE_BYTE_PAIR(0xB6C2, 0xB5CF)
+DOUBLE_BYTE_PAIR(0xB6C3, 0xB5D0)
+DOUBLE_BYTE_PAIR(0xB6C4, 0xB5D1)
+DOUBLE_BYTE_PAIR(0xB6C5, 0xB5D8)
+DOUBLE_BYTE_PAIR(0xB6C6, 0xB5EC)
+DOUBLE_BYTE_PAIR(0xB6C7, 0xB610)
+DOUBLE_BYTE_PAIR(0xB6C8, 0xB611)
+DOUBLE_BYTE_PAIR(0xB6C9, 0xB614)
+DOUBLE_BYTE_PAIR(0xB6CA, 0xB618)
+DOUBLE_BYTE_PAIR(0xB6CB, 0xB625)
+DOUBLE_BYTE_PAIR(0xB6CC, 0xB62C)
+DOUBLE_BYTE_PAIR(0xB6CD, 0xB634)
+DOUBLE_BYTE_PAIR(0xB6CE, 0xB648)
+DOUBLE_BYTE_PAIR(0xB6CF, 0xB664)
+DOUBLE_BYTE_PAIR(0xB6D0, 0xB668)
+DOUBLE_BYTE_PAIR(0xB6D1, 0xB69C)
+DOUBLE_BYTE_PAIR(0xB6D2, 0xB69D)
+DOUBLE_BYTE_PAIR(0xB6D3, 0xB6A0)
+DOUBLE_BYTE_PAIR(0xB6D4, 0xB6A4)
+DOUBLE_BYTE_PAIR(0xB6D5, 0xB6AB)
+DOUBLE_BYTE_PAIR(0xB6D6, 0xB6AC)
+DOUBLE_BYTE_PAIR(0xB6D7, 0xB6B1)
+DOUBLE_BYTE_PAIR(0xB6D8, 0xB6D4)
+DOUBLE_BYTE_PAIR(0xB6D9, 0xB6F0)
+DOUBLE_BYTE_PAIR(0xB6DA, 0xB6F4)
+DOUBLE_BYTE_PAIR(0xB6DB, 0xB6F8)
+DOUBLE_BYTE_PAIR(0xB6DC, 0xB700)
+DOUBLE_BYTE_PAIR(0xB6DD, 0xB701)
+DOUBLE_BYTE_PAIR(0xB6DE, 0xB705)
+DOUBLE_BYTE_PAIR(0xB6DF, 0xB728)
+DOUBLE_BYTE_PAIR(0xB6E0, 0xB729)
+DOUBLE_BYTE_PAIR(0xB6E1, 0xB72C)
+DOUBLE_BYTE_PAIR(0xB6E2, 0xB72F)
+DOUBLE_BYTE_PAIR(0xB6E3, 0xB730)
+DOUBLE_BYTE_PAIR(0xB6E4, 0xB738)
+DOUBLE_BYTE_PAIR(0xB6E5, 0xB739)
+DOUBLE_BYTE_PAIR(0xB6E6, 0xB73B)
+DOUBLE_BYTE_PAIR(0xB6E7, 0xB744)
+DOUBLE_BYTE_PAIR(0xB6E8, 0xB748)
+DOUBLE_BYTE_PAIR(0xB6E9, 0xB74C)
+DOUBLE_BYTE_PAIR(0xB6EA, 0xB754)
+DOUBLE_BYTE_PAIR(0xB6EB, 0xB755)
+DOUBLE_BYTE_PAIR(0xB6EC, 0xB760)
+DOUBLE_BYTE_PAIR(0xB6ED, 0xB764)
+DOUBLE_BYTE_PAIR(0xB6EE, 0xB768)
+DOUBLE_BYTE_PAIR(0xB6EF, 0xB770)
+DOUBLE_BYTE_PAIR(0xB6F0, 0xB771)
+DOUBLE_BYTE_PAIR(0xB6F1, 0xB773)
+DOUBLE_BYTE_PAIR(0xB6F2, 0xB775)
+DOUBLE_BYTE_PAIR(0xB6F3, 0xB77C)
+DOUBLE_BYTE_PAIR(0xB6F4, 0xB77D)
+DOUBLE_BYTE_PAIR(0xB6F5, 0xB780)
+DOUBLE_BYTE_PAIR(0xB6F6, 0xB784)
+DOUBLE_BYTE_PAIR(0xB6F7, 0xB78C)
+DOUBLE_BYTE_PAIR(0xB6F8, 0xB78D)
+DOUBLE_BYTE_PAIR(0xB6F9, 0xB78F)
+DOUBLE_BYTE_PAIR(0xB6FA, 0xB790)
+DOUBLE_BYTE_PAIR(0xB6FB, 0xB791)
+DOUBLE_BYTE_PAIR(0xB6FC, 0xB792)
+DOUBLE_BYTE_PAIR(0xB6FD, 0xB796)
+DOUBLE_BYTE_PAIR(0xB6FE, 0xB797)
+DOUBLE_BYTE_PAIR(0xB741, 0xD16E)
+DOUBLE_BYTE_PAIR(0xB742, 0xD16F)
+DOUBLE_BYTE_PAIR(0xB743, 0xD170)
+DOUBLE_BYTE_PAIR(0xB744, 0xD171)
+DOUBLE_BYTE_PAIR(0xB745, 0xD172)
+DOUBLE_BYTE_PAIR(0xB746, 0xD173)
+DOUBLE_BYTE_PAIR(0xB747, 0xD174)
+DOUBLE_BYTE_PAIR(0xB748, 0xD175)
+DOUBLE_BYTE_PAIR(0xB749, 0xD176)
+DOUBLE_BYTE_PAIR(0xB74A, 0xD177)
+DOUBLE_BYTE_PAIR(0xB74B, 0xD178)
+DOUBLE_BYTE_PAIR(0xB74C, 0xD179)
+DOUBLE_BYTE_PAIR(0xB74D, 0xD17A)
+DOUBLE_BYTE_PAIR(0xB74E, 0xD17B)
+DOUBLE_BYTE_PAIR(0xB74F, 0xD17D)
+DOUBLE_BYTE_PAIR(0xB750, 0xD17E)
+DOUBLE_BYTE_PAIR(0xB751, 0xD17F)
+DOUBLE_BYTE_PAIR(0xB752, 0xD180)
+DOUBLE_BYTE_PAIR(0xB753, 0xD181)
+DOUBLE_BYTE_PAIR(0xB754, 0xD182)
+DOUBLE_BYTE_PAIR(0xB755, 0xD183)
+DOUBLE_BYTE_PAIR(0xB756, 0xD185)
+DOUBLE_BYTE_PAIR(0xB757, 0xD186)
+DOUBLE_BYTE_PAIR(0xB758, 0xD187)
+DOUBLE_BYTE_PAIR(0xB759, 0xD189)
+DOUBLE_BYTE_PAIR(0xB75A, 0xD18A)
+DOUBLE_BYTE_PAIR(0xB761, 0xD18B)
+DOUBLE_BYTE_PAIR(0xB762, 0xD18C)
+DOUBLE_BYTE_PAIR(0xB763, 0xD18D)
+DOUBLE_BYTE_PAIR(0xB764, 0xD18E)
+DOUBLE_BYTE_PAIR(0xB765, 0xD18F)
+DOUBLE_BYTE_PAIR(0xB766, 0xD190)
+DOUBLE_BYTE_PAIR(0xB767, 0xD191)
+DOUBLE_BYTE_PAIR(0xB768, 0xD192)
+DOUBLE_BYTE_PAIR(0xB769, 0xD193)
+DOUBLE_BYTE_PAIR(0xB76A, 0xD194)
+DOUBLE_BYTE_PAIR(0xB76B, 0xD195)
+DOUBLE_BYTE_PAIR(0xB76C, 0xD196)
+DOUBLE_BYTE_PAIR(0xB76D, 0xD197)
+DOUBLE_BYTE_PAIR(0xB76E, 0xD198)
+DOUBLE_BYTE_PAIR(0xB76F, 0xD199)
+DOUBLE_BYTE_PAIR(0xB770, 0xD19A)
+DOUBLE_BYTE_PAIR(0xB771, 0xD19B)
+DOUBLE_BYTE_PAIR(0xB772, 0xD19C)
+DOUBLE_BYTE_PAIR(0xB773, 0xD19D)
+DOUBLE_BYTE_PAIR(0xB774, 0xD19E)
+DOUBLE_BYTE_PAIR(0xB775, 0xD19F)
+DOUBLE_BYTE_PAIR(0xB776, 0xD1A2)
+DOUBLE_BYTE_PAIR(0xB777, 0xD1A3)
+DOUBLE_BYTE_PAIR(0xB778, 0xD1A5)
+DOUBLE_BYTE_PAIR(0xB779, 0xD1A6)
+DOUBLE_BYTE_PAIR(0xB77A, 0xD1A7)
+DOUBLE_BYTE_PAIR(0xB781, 0xD1A9)
+DOUBLE_BYTE_PAIR(0xB782, 0xD1AA)
+DOUBLE_BYTE_PAIR(0xB783, 0xD1AB)
+DOUBLE_BYTE_PAIR(0xB784, 0xD1AC)
+DOUBLE_BYTE_PAIR(0xB785, 0xD1AD)
+DOUBLE_BYTE_PAIR(0xB786, 0xD1AE)
+DOUBLE_BYTE_PAIR(0xB787, 0xD1AF)
+DOUBLE_BYTE_PAIR(0xB788, 0xD1B2)
+DOUBLE_BYTE_PAIR(0xB789, 0xD1B4)
+DOUBLE_BYTE_PAIR(0xB78A, 0xD1B6)
+DOUBLE_BYTE_PAIR(0xB78B, 0xD1B7)
+DOUBLE_BYTE_PAIR(0xB78C, 0xD1B8)
+DOUBLE_BYTE_PAIR(0xB78D, 0xD1B9)
+DOUBLE_BYTE_PAIR(0xB78E, 0xD1BB)
+DOUBLE_BYTE_PAIR(0xB78F, 0xD1BD)
+DOUBLE_BYTE_PAIR(0xB790, 0xD1BE)
+DOUBLE_BYTE_PAIR(0xB791, 0xD1BF)
+DOUBLE_BYTE_PAIR(0xB792, 0xD1C1)
+DOUBLE_BYTE_PAIR(0xB793, 0xD1C2)
+DOUBLE_BYTE_PAIR(0xB794, 0xD1C3)
+DOUBLE_BYTE_PAIR(0xB795, 0xD1C4)
+DOUBLE_BYTE_PAIR(0xB796, 0xD1C5)
+DOUBLE_BYTE_PAIR(0xB797, 0xD1C6)
+DOUBLE_BYTE_PAIR(0xB798, 0xD1C7)
+DOUBLE_BYTE_PAIR(0xB799, 0xD1C8)
+DOUBLE_BYTE_PAIR(0xB79A, 0xD1C9)
+DOUBLE_BYTE_PAIR(0xB79B, 0xD1CA)
+DOUBLE_BYTE_PAIR(0xB79C, 0xD1CB)
+DOUBLE_BYTE_PAIR(0xB79D, 0xD1CC)
+DOUBLE_BYTE_PAIR(0xB79E, 0xD1CD)
+DOUBLE_BYTE_PAIR(0xB79F, 0xD1CE)
+DOUBLE_BYTE_PAIR(0xB7A0, 0xD1CF)
+DOUBLE_BYTE_PAIR(0xB7A1, 0xB798)
+DOUBLE_BYTE_PAIR(0xB7A2, 0xB799)
+DOUBLE_BYTE_PAIR(0xB7A3, 0xB79C)
+DOUBLE_BYTE_PAIR(0xB7A4, 0xB7A0)
+DOUBLE_BYTE_PAIR(0xB7A5, 0xB7A8)
+DOUBLE_BYTE_PAIR(0xB7A6, 0xB7A9)
+DOUBLE_BYTE_PAIR(0xB7A7, 0xB7AB)
+DOUBLE_BYTE_PAIR(0xB7A8, 0xB7AC)
+DOUBLE_BYTE_PAIR(0xB7A9, 0xB7AD)
+DOUBLE_BYTE_PAIR(0xB7AA, 0xB7B4)
+DOUBLE_BYTE_PAIR(0xB7AB, 0xB7B5)
+DOUBLE_BYTE_PAIR(0xB7AC, 0xB7B8)
+DOUBLE_BYTE_PAIR(0xB7AD, 0xB7C7)
+DOUBLE_BYTE_PAIR(0xB7AE, 0xB7C9)
+DOUBLE_BYTE_PAIR(0xB7AF, 0xB7EC)
+DOUBLE_BYTE_PAIR(0xB7B0, 0xB7ED)
+DOUBLE_BYTE_PAIR(0xB7B1, 0xB7F0)
+DOUBLE_BYTE_PAIR(0xB7B2, 0xB7F4)
+DOUBLE_BYTE_PAIR(0xB7B3, 0xB7FC)
+DOUBLE_BYTE_PAIR(0xB7B4, 0xB7FD)
+DOUBLE_BYTE_PAIR(0xB7B5, 0xB7FF)
+DOUBLE_BYTE_PAIR(0xB7B6, 0xB800)
+DOUBLE_BYTE_PAIR(0xB7B7, 0xB801)
+DOUBLE_BYTE_PAIR(0xB7B8, 0xB807)
+DOUBLE_BYTE_PAIR(0xB7B9, 0xB808)
+DOUBLE_BYTE_PAIR(0xB7BA, 0xB809)
+DOUBLE_BYTE_PAIR(0xB7BB, 0xB80C)
+DOUBLE_BYTE_PAIR(0xB7BC, 0xB810)
+DOUBLE_BYTE_PAIR(0xB7BD, 0xB818)
+DOUBLE_BYTE_PAIR(0xB7BE, 0xB819)
+DOUBLE_BYTE_PAIR(0xB7BF, 0xB81B)
+DOUBLE_BYTE_PAIR(0xB7C0, 0xB81D)
+DOUBLE_BYTE_PAIR(0xB7C1, 0xB824)
+DOUBLE_BYTE_PAIR(0xB7C2, 0xB825)
+DOUBLE_BYTE_PAIR(0xB7C3, 0xB828)
+DOUBLE_BYTE_PAIR(0xB7C4, 0xB82C)
+DOUBLE_BYTE_PAIR(0xB7C5, 0xB834)
+DOUBLE_BYTE_PAIR(0xB7C6, 0xB835)
+DOUBLE_BYTE_PAIR(0xB7C7, 0xB837)
+DOUBLE_BYTE_PAIR(0xB7C8, 0xB838)
+DOUBLE_BYTE_PAIR(0xB7C9, 0xB839)
+DOUBLE_BYTE_PAIR(0xB7CA, 0xB840)
+DOUBLE_BYTE_PAIR(0xB7CB, 0xB844)
+DOUBLE_BYTE_PAIR(0xB7CC, 0xB851)
+DOUBLE_BYTE_PAIR(0xB7CD, 0xB853)
+DOUBLE_BYTE_PAIR(0xB7CE, 0xB85C)
+DOUBLE_BYTE_PAIR(0xB7CF, 0xB85D)
+DOUBLE_BYTE_PAIR(0xB7D0, 0xB860)
+DOUBLE_BYTE_PAIR(0xB7D1, 0xB864)
+DOUBLE_BYTE_PAIR(0xB7D2, 0xB86C)
+DOUBLE_BYTE_PAIR(0xB7D3, 0xB86D)
+DOUBLE_BYTE_PAIR(0xB7D4, 0xB86F)
+DOUBLE_BYTE_PAIR(0xB7D5, 0xB871)
+DOUBLE_BYTE_PAIR(0xB7D6, 0xB878)
+DOUBLE_BYTE_PAIR(0xB7D7, 0xB87C)
+DOUBLE_BYTE_PAIR(0xB7D8, 0xB88D)
+DOUBLE_BYTE_PAIR(0xB7D9, 0xB8A8)
+DOUBLE_BYTE_PAIR(0xB7DA, 0xB8B0)
+DOUBLE_BYTE_PAIR(0xB7DB, 0xB8B4)
+DOUBLE_BYTE_PAIR(0xB7DC, 0xB8B8)
+DOUBLE_BYTE_PAIR(0xB7DD, 0xB8C0)
+DOUBLE_BYTE_PAIR(0xB7DE, 0xB8C1)
+DOUBLE_BYTE_PAIR(0xB7DF, 0xB8C3)
+DOUBLE_BYTE_PAIR(0xB7E0, 0xB8C5)
+DOUBLE_BYTE_PAIR(0xB7E1, 0xB8CC)
+DOUBLE_BYTE_PAIR(0xB7E2, 0xB8D0)
+DOUBLE_BYTE_PAIR(0xB7E3, 0xB8D4)
+DOUBLE_BYTE_PAIR(0xB7E4, 0xB8DD)
+DOUBLE_BYTE_PAIR(0xB7E5, 0xB8DF)
+DOUBLE_BYTE_PAIR(0xB7E6, 0xB8E1)
+DOUBLE_BYTE_PAIR(0xB7E7, 0xB8E8)
+DOUBLE_BYTE_PAIR(0xB7E8, 0xB8E9)
+DOUBLE_BYTE_PAIR(0xB7E9, 0xB8EC)
+DOUBLE_BYTE_PAIR(0xB7EA, 0xB8F0)
+DOUBLE_BYTE_PAIR(0xB7EB, 0xB8F8)
+DOUBLE_BYTE_PAIR(0xB7EC, 0xB8F9)
+DOUBLE_BYTE_PAIR(0xB7ED, 0xB8FB)
+DOUBLE_BYTE_PAIR(0xB7EE, 0xB8FD)
+DOUBLE_BYTE_PAIR(0xB7EF, 0xB904)
+DOUBLE_BYTE_PAIR(0xB7F0, 0xB918)
+DOUBLE_BYTE_PAIR(0xB7F1, 0xB920)
+DOUBLE_BYTE_PAIR(0xB7F2, 0xB93C)
+DOUBLE_BYTE_PAIR(0xB7F3, 0xB93D)
+DOUBLE_BYTE_PAIR(0xB7F4, 0xB940)
+DOUBLE_BYTE_PAIR(0xB7F5, 0xB944)
+DOUBLE_BYTE_PAIR(0xB7F6, 0xB94C)
+DOUBLE_BYTE_PAIR(0xB7F7, 0xB94F)
+DOUBLE_BYTE_PAIR(0xB7F8, 0xB951)
+DOUBLE_BYTE_PAIR(0xB7F9, 0xB958)
+DOUBLE_BYTE_PAIR(0xB7FA, 0xB959)
+DOUBLE_BYTE_PAIR(0xB7FB, 0xB95C)
+DOUBLE_BYTE_PAIR(0xB7FC, 0xB960)
+DOUBLE_BYTE_PAIR(0xB7FD, 0xB968)
+DOUBLE_BYTE_PAIR(0xB7FE, 0xB969)
+DOUBLE_BYTE_PAIR(0xB841, 0xD1D0)
+DOUBLE_BYTE_PAIR(0xB842, 0xD1D1)
+DOUBLE_BYTE_PAIR(0xB843, 0xD1D2)
+DOUBLE_BYTE_PAIR(0xB844, 0xD1D3)
+DOUBLE_BYTE_PAIR(0xB845, 0xD1D4)
+DOUBLE_BYTE_PAIR(0xB846, 0xD1D5)
+DOUBLE_BYTE_PAIR(0xB847, 0xD1D6)
+DOUBLE_BYTE_PAIR(0xB848, 0xD1D7)
+DOUBLE_BYTE_PAIR(0xB849, 0xD1D9)
+DOUBLE_BYTE_PAIR(0xB84A, 0xD1DA)
+DOUBLE_BYTE_PAIR(0xB84B, 0xD1DB)
+DOUBLE_BYTE_PAIR(0xB84C, 0xD1DC)
+DOUBLE_BYTE_PAIR(0xB84D, 0xD1DD)
+DOUBLE_BYTE_PAIR(0xB84E, 0xD1DE)
+DOUBLE_BYTE_PAIR(0xB84F, 0xD1DF)
+DOUBLE_BYTE_PAIR(0xB850, 0xD1E0)
+DOUBLE_BYTE_PAIR(0xB851, 0xD1E1)
+DOUBLE_BYTE_PAIR(0xB852, 0xD1E2)
+DOUBLE_BYTE_PAIR(0xB853, 0xD1E3)
+DOUBLE_BYTE_PAIR(0xB854, 0xD1E4)
+DOUBLE_BYTE_PAIR(0xB855, 0xD1E5)
+DOUBLE_BYTE_PAIR(0xB856, 0xD1E6)
+DOUBLE_BYTE_PAIR(0xB857, 0xD1E7)
+DOUBLE_BYTE_PAIR(0xB858, 0xD1E8)
+DOUBLE_BYTE_PAIR(0xB859, 0xD1E9)
+DOUBLE_BYTE_PAIR(0xB85A, 0xD1EA)
+DOUBLE_BYTE_PAIR(0xB861, 0xD1EB)
+DOUBLE_BYTE_PAIR(0xB862, 0xD1EC)
+DOUBLE_BYTE_PAIR(0xB863, 0xD1ED)
+DOUBLE_BYTE_PAIR(0xB864, 0xD1EE)
+DOUBLE_BYTE_PAIR(0xB865, 0xD1EF)
+DOUBLE_BYTE_PAIR(0xB866, 0xD1F0)
+DOUBLE_BYTE_PAIR(0xB867, 0xD1F1)
+DOUBLE_BYTE_PAIR(0xB868, 0xD1F2)
+DOUBLE_BYTE_PAIR(0xB869, 0xD1F3)
+DOUBLE_BYTE_PAIR(0xB86A, 0xD1F5)
+DOUBLE_BYTE_PAIR(0xB86B, 0xD1F6)
+DOUBLE_BYTE_PAIR(0xB86C, 0xD1F7)
+DOUBLE_BYTE_PAIR(0xB86D, 0xD1F9)
+DOUBLE_BYTE_PAIR(0xB86E, 0xD1FA)
+DOUBLE_BYTE_PAIR(0xB86F, 0xD1FB)
+DOUBLE_BYTE_PAIR(0xB870, 0xD1FC)
+DOUBLE_BYTE_PAIR(0xB871, 0xD1FD)
+DOUBLE_BYTE_PAIR(0xB872, 0xD1FE)
+DOUBLE_BYTE_PAIR(0xB873, 0xD1FF)
+DOUBLE_BYTE_PAIR(0xB874, 0xD200)
+DOUBLE_BYTE_PAIR(0xB875, 0xD201)
+DOUBLE_BYTE_PAIR(0xB876, 0xD202)
+DOUBLE_BYTE_PAIR(0xB877, 0xD203)
+DOUBLE_BYTE_PAIR(0xB878, 0xD204)
+DOUBLE_BYTE_PAIR(0xB879, 0xD205)
+DOUBLE_BYTE_PAIR(0xB87A, 0xD206)
+DOUBLE_BYTE_PAIR(0xB881, 0xD208)
+DOUBLE_BYTE_PAIR(0xB882, 0xD20A)
+DOUBLE_BYTE_PAIR(0xB883, 0xD20B)
+DOUBLE_BYTE_PAIR(0xB884, 0xD20C)
+DOUBLE_BYTE_PAIR(0xB885, 0xD20D)
+DOUBLE_BYTE_PAIR(0xB886, 0xD20E)
+DOUBLE_BYTE_PAIR(0xB887, 0xD20F)
+DOUBLE_BYTE_PAIR(0xB888, 0xD211)
+DOUBLE_BYTE_PAIR(0xB889, 0xD212)
+DOUBLE_BYTE_PAIR(0xB88A, 0xD213)
+DOUBLE_BYTE_PAIR(0xB88B, 0xD214)
+DOUBLE_BYTE_PAIR(0xB88C, 0xD215)
+DOUBLE_BYTE_PAIR(0xB88D, 0xD216)
+DOUBLE_BYTE_PAIR(0xB88E, 0xD217)
+DOUBLE_BYTE_PAIR(0xB88F, 0xD218)
+DOUBLE_BYTE_PAIR(0xB890, 0xD219)
+DOUBLE_BYTE_PAIR(0xB891, 0xD21A)
+DOUBLE_BYTE_PAIR(0xB892, 0xD21B)
+DOUBLE_BYTE_PAIR(0xB893, 0xD21C)
+DOUBLE_BYTE_PAIR(0xB894, 0xD21D)
+DOUBLE_BYTE_PAIR(0xB895, 0xD21E)
+DOUBLE_BYTE_PAIR(0xB896, 0xD21F)
+DOUBLE_BYTE_PAIR(0xB897, 0xD220)
+DOUBLE_BYTE_PAIR(0xB898, 0xD221)
+DOUBLE_BYTE_PAIR(0xB899, 0xD222)
+DOUBLE_BYTE_PAIR(0xB89A, 0xD223)
+DOUBLE_BYTE_PAIR(0xB89B, 0xD224)
+DOUBLE_BYTE_PAIR(0xB89C, 0xD225)
+DOUBLE_BYTE_PAIR(0xB89D, 0xD226)
+DOUBLE_BYTE_PAIR(0xB89E, 0xD227)
+DOUBLE_BYTE_PAIR(0xB89F, 0xD228)
+DOUBLE_BYTE_PAIR(0xB8A0, 0xD229)
+DOUBLE_BYTE_PAIR(0xB8A1, 0xB96B)
+DOUBLE_BYTE_PAIR(0xB8A2, 0xB96D)
+DOUBLE_BYTE_PAIR(0xB8A3, 0xB974)
+DOUBLE_BYTE_PAIR(0xB8A4, 0xB975)
+DOUBLE_BYTE_PAIR(0xB8A5, 0xB978)
+DOUBLE_BYTE_PAIR(0xB8A6, 0xB97C)
+DOUBLE_BYTE_PAIR(0xB8A7, 0xB984)
+DOUBLE_BYTE_PAIR(0xB8A8, 0xB985)
+DOUBLE_BYTE_PAIR(0xB8A9, 0xB987)
+DOUBLE_BYTE_PAIR(0xB8AA, 0xB989)
+DOUBLE_BYTE_PAIR(0xB8AB, 0xB98A)
+DOUBLE_BYTE_PAIR(0xB8AC, 0xB98D)
+DOUBLE_BYTE_PAIR(0xB8AD, 0xB98E)
+DOUBLE_BYTE_PAIR(0xB8AE, 0xB9AC)
+DOUBLE_BYTE_PAIR(0xB8AF, 0xB9AD)
+DOUBLE_BYTE_PAIR(0xB8B0, 0xB9B0)
+DOUBLE_BYTE_PAIR(0xB8B1, 0xB9B4)
+DOUBLE_BYTE_PAIR(0xB8B2, 0xB9BC)
+DOUBLE_BYTE_PAIR(0xB8B3, 0xB9BD)
+DOUBLE_BYTE_PAIR(0xB8B4, 0xB9BF)
+DOUBLE_BYTE_PAIR(0xB8B5, 0xB9C1)
+DOUBLE_BYTE_PAIR(0xB8B6, 0xB9C8)
+DOUBLE_BYTE_PAIR(0xB8B7, 0xB9C9)
+DOUBLE_BYTE_PAIR(0xB8B8, 0xB9CC)
+DOUBLE_BYTE_PAIR(0xB8B9, 0xB9CE)
+DOUBLE_BYTE_PAIR(0xB8BA, 0xB9CF)
+DOUBLE_BYTE_PAIR(0xB8BB, 0xB9D0)
+DOUBLE_BYTE_PAIR(0xB8BC, 0xB9D1)
+DOUBLE_BYTE_PAIR(0xB8BD, 0xB9D2)
+DOUBLE_BYTE_PAIR(0xB8BE, 0xB9D8)
+DOUBLE_BYTE_PAIR(0xB8BF, 0xB9D9)
+DOUBLE_BYTE_PAIR(0xB8C0, 0xB9DB)
+DOUBLE_BYTE_PAIR(0xB8C1, 0xB9DD)
+DOUBLE_BYTE_PAIR(0xB8C2, 0xB9DE)
+DOUBLE_BYTE_PAIR(0xB8C3, 0xB9E1)
+DOUBLE_BYTE_PAIR(0xB8C4, 0xB9E3)
+DOUBLE_BYTE_PAIR(0xB8C5, 0xB9E4)
+DOUBLE_BYTE_PAIR(0xB8C6, 0xB9E5)
+DOUBLE_BYTE_PAIR(0xB8C7, 0xB9E8)
+DOUBLE_BYTE_PAIR(0xB8C8, 0xB9EC)
+DOUBLE_BYTE_PAIR(0xB8C9, 0xB9F4)
+DOUBLE_BYTE_PAIR(0xB8CA, 0xB9F5)
+DOUBLE_BYTE_PAIR(0xB8CB, 0xB9F7)
+DOUBLE_BYTE_PAIR(0xB8CC, 0xB9F8)
+DOUBLE_BYTE_PAIR(0xB8CD, 0xB9F9)
+DOUBLE_BYTE_PAIR(0xB8CE, 0xB9FA)
+DOUBLE_BYTE_PAIR(0xB8CF, 0xBA00)
+DOUBLE_BYTE_PAIR(0xB8D0, 0xBA01)
+DOUBLE_BYTE_PAIR(0xB8D1, 0xBA08)
+DOUBLE_BYTE_PAIR(0xB8D2, 0xBA15)
+DOUBLE_BYTE_PAIR(0xB8D3, 0xBA38)
+DOUBLE_BYTE_PAIR(0xB8D4, 0xBA39)
+DOUBLE_BYTE_PAIR(0xB8D5, 0xBA3C)
+DOUBLE_BYTE_PAIR(0xB8D6, 0xBA40)
+DOUBLE_BYTE_PAIR(0xB8D7, 0xBA42)
+DOUBLE_BYTE_PAIR(0xB8D8, 0xBA48)
+DOUBLE_BYTE_PAIR(0xB8D9, 0xBA49)
+DOUBLE_BYTE_PAIR(0xB8DA, 0xBA4B)
+DOUBLE_BYTE_PAIR(0xB8DB, 0xBA4D)
+DOUBLE_BYTE_PAIR(0xB8DC, 0xBA4E)
+DOUBLE_BYTE_PAIR(0xB8DD, 0xBA53)
+DOUBLE_BYTE_PAIR(0xB8DE, 0xBA54)
+DOUBLE_BYTE_PAIR(0xB8DF, 0xBA55)
+DOUBLE_BYTE_PAIR(0xB8E0, 0xBA58)
+DOUBLE_BYTE_PAIR(0xB8E1, 0xBA5C)
+DOUBLE_BYTE_PAIR(0xB8E2, 0xBA64)
+DOUBLE_BYTE_PAIR(0xB8E3, 0xBA65)
+DOUBLE_BYTE_PAIR(0xB8E4, 0xBA67)
+DOUBLE_BYTE_PAIR(0xB8E5, 0xBA68)
+DOUBLE_BYTE_PAIR(0xB8E6, 0xBA69)
+DOUBLE_BYTE_PAIR(0xB8E7, 0xBA70)
+DOUBLE_BYTE_PAIR(0xB8E8, 0xBA71)
+DOUBLE_BYTE_PAIR(0xB8E9, 0xBA74)
+DOUBLE_BYTE_PAIR(0xB8EA, 0xBA78)
+DOUBLE_BYTE_PAIR(0xB8EB, 0xBA83)
+DOUBLE_BYTE_PAIR(0xB8EC, 0xBA84)
+DOUBLE_BYTE_PAIR(0xB8ED, 0xBA85)
+DOUBLE_BYTE_PAIR(0xB8EE, 0xBA87)
+DOUBLE_BYTE_PAIR(0xB8EF, 0xBA8C)
+DOUBLE_BYTE_PAIR(0xB8F0, 0xBAA8)
+DOUBLE_BYTE_PAIR(0xB8F1, 0xBAA9)
+DOUBLE_BYTE_PAIR(0xB8F2, 0xBAAB)
+DOUBLE_BYTE_PAIR(0xB8F3, 0xBAAC)
+DOUBLE_BYTE_PAIR(0xB8F4, 0xBAB0)
+DOUBLE_BYTE_PAIR(0xB8F5, 0xBAB2)
+DOUBLE_BYTE_PAIR(0xB8F6, 0xBAB8)
+DOUBLE_BYTE_PAIR(0xB8F7, 0xBAB9)
+DOUBLE_BYTE_PAIR(0xB8F8, 0xBABB)
+DOUBLE_BYTE_PAIR(0xB8F9, 0xBABD)
+DOUBLE_BYTE_PAIR(0xB8FA, 0xBAC4)
+DOUBLE_BYTE_PAIR(0xB8FB, 0xBAC8)
+DOUBLE_BYTE_PAIR(0xB8FC, 0xBAD8)
+DOUBLE_BYTE_PAIR(0xB8FD, 0xBAD9)
+DOUBLE_BYTE_PAIR(0xB8FE, 0xBAFC)
+DOUBLE_BYTE_PAIR(0xB941, 0xD22A)
+DOUBLE_BYTE_PAIR(0xB942, 0xD22B)
+DOUBLE_BYTE_PAIR(0xB943, 0xD22E)
+DOUBLE_BYTE_PAIR(0xB944, 0xD22F)
+DOUBLE_BYTE_PAIR(0xB945, 0xD231)
+DOUBLE_BYTE_PAIR(0xB946, 0xD232)
+DOUBLE_BYTE_PAIR(0xB947, 0xD233)
+DOUBLE_BYTE_PAIR(0xB948, 0xD235)
+DOUBLE_BYTE_PAIR(0xB949, 0xD236)
+DOUBLE_BYTE_PAIR(0xB94A, 0xD237)
+DOUBLE_BYTE_PAIR(0xB94B, 0xD238)
+DOUBLE_BYTE_PAIR(0xB94C, 0xD239)
+DOUBLE_BYTE_PAIR(0xB94D, 0xD23A)
+DOUBLE_BYTE_PAIR(0xB94E, 0xD23B)
+DOUBLE_BYTE_PAIR(0xB94F, 0xD23E)
+DOUBLE_BYTE_PAIR(0xB950, 0xD240)
+DOUBLE_BYTE_PAIR(0xB951, 0xD242)
+DOUBLE_BYTE_PAIR(0xB952, 0xD243)
+DOUBLE_BYTE_PAIR(0xB953, 0xD244)
+DOUBLE_BYTE_PAIR(0xB954, 0xD245)
+DOUBLE_BYTE_PAIR(0xB955, 0xD246)
+DOUBLE_BYTE_PAIR(0xB956, 0xD247)
+DOUBLE_BYTE_PAIR(0xB957, 0xD249)
+DOUBLE_BYTE_PAIR(0xB958, 0xD24A)
+DOUBLE_BYTE_PAIR(0xB959, 0xD24B)
+DOUBLE_BYTE_PAIR(0xB95A, 0xD24C)
+DOUBLE_BYTE_PAIR(0xB961, 0xD24D)
+DOUBLE_BYTE_PAIR(0xB962, 0xD24E)
+DOUBLE_BYTE_PAIR(0xB963, 0xD24F)
+DOUBLE_BYTE_PAIR(0xB964, 0xD250)
+DOUBLE_BYTE_PAIR(0xB965, 0xD251)
+DOUBLE_BYTE_PAIR(0xB966, 0xD252)
+DOUBLE_BYTE_PAIR(0xB967, 0xD253)
+DOUBLE_BYTE_PAIR(0xB968, 0xD254)
+DOUBLE_BYTE_PAIR(0xB969, 0xD255)
+DOUBLE_BYTE_PAIR(0xB96A, 0xD256)
+DOUBLE_BYTE_PAIR(0xB96B, 0xD257)
+DOUBLE_BYTE_PAIR(0xB96C, 0xD258)
+DOUBLE_BYTE_PAIR(0xB96D, 0xD259)
+DOUBLE_BYTE_PAIR(0xB96E, 0xD25A)
+DOUBLE_BYTE_PAIR(0xB96F, 0xD25B)
+DOUBLE_BYTE_PAIR(0xB970, 0xD25D)
+DOUBLE_BYTE_PAIR(0xB971, 0xD25E)
+DOUBLE_BYTE_PAIR(0xB972, 0xD25F)
+DOUBLE_BYTE_PAIR(0xB973, 0xD260)
+DOUBLE_BYTE_PAIR(0xB974, 0xD261)
+DOUBLE_BYTE_PAIR(0xB975, 0xD262)
+DOUBLE_BYTE_PAIR(0xB976, 0xD263)
+DOUBLE_BYTE_PAIR(0xB977, 0xD265)
+DOUBLE_BYTE_PAIR(0xB978, 0xD266)
+DOUBLE_BYTE_PAIR(0xB979, 0xD267)
+DOUBLE_BYTE_PAIR(0xB97A, 0xD268)
+DOUBLE_BYTE_PAIR(0xB981, 0xD269)
+DOUBLE_BYTE_PAIR(0xB982, 0xD26A)
+DOUBLE_BYTE_PAIR(0xB983, 0xD26B)
+DOUBLE_BYTE_PAIR(0xB984, 0xD26C)
+DOUBLE_BYTE_PAIR(0xB985, 0xD26D)
+DOUBLE_BYTE_PAIR(0xB986, 0xD26E)
+DOUBLE_BYTE_PAIR(0xB987, 0xD26F)
+DOUBLE_BYTE_PAIR(0xB988, 0xD270)
+DOUBLE_BYTE_PAIR(0xB989, 0xD271)
+DOUBLE_BYTE_PAIR(0xB98A, 0xD272)
+DOUBLE_BYTE_PAIR(0xB98B, 0xD273)
+DOUBLE_BYTE_PAIR(0xB98C, 0xD274)
+DOUBLE_BYTE_PAIR(0xB98D, 0xD275)
+DOUBLE_BYTE_PAIR(0xB98E, 0xD276)
+DOUBLE_BYTE_PAIR(0xB98F, 0xD277)
+DOUBLE_BYTE_PAIR(0xB990, 0xD278)
+DOUBLE_BYTE_PAIR(0xB991, 0xD279)
+DOUBLE_BYTE_PAIR(0xB992, 0xD27A)
+DOUBLE_BYTE_PAIR(0xB993, 0xD27B)
+DOUBLE_BYTE_PAIR(0xB994, 0xD27C)
+DOUBLE_BYTE_PAIR(0xB995, 0xD27D)
+DOUBLE_BYTE_PAIR(0xB996, 0xD27E)
+DOUBLE_BYTE_PAIR(0xB997, 0xD27F)
+DOUBLE_BYTE_PAIR(0xB998, 0xD282)
+DOUBLE_BYTE_PAIR(0xB999, 0xD283)
+DOUBLE_BYTE_PAIR(0xB99A, 0xD285)
+DOUBLE_BYTE_PAIR(0xB99B, 0xD286)
+DOUBLE_BYTE_PAIR(0xB99C, 0xD287)
+DOUBLE_BYTE_PAIR(0xB99D, 0xD289)
+DOUBLE_BYTE_PAIR(0xB99E, 0xD28A)
+DOUBLE_BYTE_PAIR(0xB99F, 0xD28B)
+DOUBLE_BYTE_PAIR(0xB9A0, 0xD28C)
+DOUBLE_BYTE_PAIR(0xB9A1, 0xBB00)
+DOUBLE_BYTE_PAIR(0xB9A2, 0xBB04)
+DOUBLE_BYTE_PAIR(0xB9A3, 0xBB0D)
+DOUBLE_BYTE_PAIR(0xB9A4, 0xBB0F)
+DOUBLE_BYTE_PAIR(0xB9A5, 0xBB11)
+DOUBLE_BYTE_PAIR(0xB9A6, 0xBB18)
+DOUBLE_BYTE_PAIR(0xB9A7, 0xBB1C)
+DOUBLE_BYTE_PAIR(0xB9A8, 0xBB20)
+DOUBLE_BYTE_PAIR(0xB9A9, 0xBB29)
+DOUBLE_BYTE_PAIR(0xB9AA, 0xBB2B)
+DOUBLE_BYTE_PAIR(0xB9AB, 0xBB34)
+DOUBLE_BYTE_PAIR(0xB9AC, 0xBB35)
+DOUBLE_BYTE_PAIR(0xB9AD, 0xBB36)
+DOUBLE_BYTE_PAIR(0xB9AE, 0xBB38)
+DOUBLE_BYTE_PAIR(0xB9AF, 0xBB3B)
+DOUBLE_BYTE_PAIR(0xB9B0, 0xBB3C)
+DOUBLE_BYTE_PAIR(0xB9B1, 0xBB3D)
+DOUBLE_BYTE_PAIR(0xB9B2, 0xBB3E)
+DOUBLE_BYTE_PAIR(0xB9B3, 0xBB44)
+DOUBLE_BYTE_PAIR(0xB9B4, 0xBB45)
+DOUBLE_BYTE_PAIR(0xB9B5, 0xBB47)
+DOUBLE_BYTE_PAIR(0xB9B6, 0xBB49)
+DOUBLE_BYTE_PAIR(0xB9B7, 0xBB4D)
+DOUBLE_BYTE_PAIR(0xB9B8, 0xBB4F)
+DOUBLE_BYTE_PAIR(0xB9B9, 0xBB50)
+DOUBLE_BYTE_PAIR(0xB9BA, 0xBB54)
+DOUBLE_BYTE_PAIR(0xB9BB, 0xBB58)
+DOUBLE_BYTE_PAIR(0xB9BC, 0xBB61)
+DOUBLE_BYTE_PAIR(0xB9BD, 0xBB63)
+DOUBLE_BYTE_PAIR(0xB9BE, 0xBB6C)
+DOUBLE_BYTE_PAIR(0xB9BF, 0xBB88)
+DOUBLE_BYTE_PAIR(0xB9C0, 0xBB8C)
+DOUBLE_BYTE_PAIR(0xB9C1, 0xBB90)
+DOUBLE_BYTE_PAIR(0xB9C2, 0xBBA4)
+DOUBLE_BYTE_PAIR(0xB9C3, 0xBBA8)
+DOUBLE_BYTE_PAIR(0xB9C4, 0xBBAC)
+DOUBLE_BYTE_PAIR(0xB9C5, 0xBBB4)
+DOUBLE_BYTE_PAIR(0xB9C6, 0xBBB7)
+DOUBLE_BYTE_PAIR(0xB9C7, 0xBBC0)
+DOUBLE_BYTE_PAIR(0xB9C8, 0xBBC4)
+DOUBLE_BYTE_PAIR(0xB9C9, 0xBBC8)
+DOUBLE_BYTE_PAIR(0xB9CA, 0xBBD0)
+DOUBLE_BYTE_PAIR(0xB9CB, 0xBBD3)
+DOUBLE_BYTE_PAIR(0xB9CC, 0xBBF8)
+DOUBLE_BYTE_PAIR(0xB9CD, 0xBBF9)
+DOUBLE_BYTE_PAIR(0xB9CE, 0xBBFC)
+DOUBLE_BYTE_PAIR(0xB9CF, 0xBBFF)
+DOUBLE_BYTE_PAIR(0xB9D0, 0xBC00)
+DOUBLE_BYTE_PAIR(0xB9D1, 0xBC02)
+DOUBLE_BYTE_PAIR(0xB9D2, 0xBC08)
+DOUBLE_BYTE_PAIR(0xB9D3, 0xBC09)
+DOUBLE_BYTE_PAIR(0xB9D4, 0xBC0B)
+DOUBLE_BYTE_PAIR(0xB9D5, 0xBC0C)
+DOUBLE_BYTE_PAIR(0xB9D6, 0xBC0D)
+DOUBLE_BYTE_PAIR(0xB9D7, 0xBC0F)
+DOUBLE_BYTE_PAIR(0xB9D8, 0xBC11)
+DOUBLE_BYTE_PAIR(0xB9D9, 0xBC14)
+DOUBLE_BYTE_PAIR(0xB9DA, 0xBC15)
+DOUBLE_BYTE_PAIR(0xB9DB, 0xBC16)
+DOUBLE_BYTE_PAIR(0xB9DC, 0xBC17)
+DOUBLE_BYTE_PAIR(0xB9DD, 0xBC18)
+DOUBLE_BYTE_PAIR(0xB9DE, 0xBC1B)
+DOUBLE_BYTE_PAIR(0xB9DF, 0xBC1C)
+DOUBLE_BYTE_PAIR(0xB9E0, 0xBC1D)
+DOUBLE_BYTE_PAIR(0xB9E1, 0xBC1E)
+DOUBLE_BYTE_PAIR(0xB9E2, 0xBC1F)
+DOUBLE_BYTE_PAIR(0xB9E3, 0xBC24)
+DOUBLE_BYTE_PAIR(0xB9E4, 0xBC25)
+DOUBLE_BYTE_PAIR(0xB9E5, 0xBC27)
+DOUBLE_BYTE_PAIR(0xB9E6, 0xBC29)
+DOUBLE_BYTE_PAIR(0xB9E7, 0xBC2D)
+DOUBLE_BYTE_PAIR(0xB9E8, 0xBC30)
+DOUBLE_BYTE_PAIR(0xB9E9, 0xBC31)
+DOUBLE_BYTE_PAIR(0xB9EA, 0xBC34)
+DOUBLE_BYTE_PAIR(0xB9EB, 0xBC38)
+DOUBLE_BYTE_PAIR(0xB9EC, 0xBC40)
+DOUBLE_BYTE_PAIR(0xB9ED, 0xBC41)
+DOUBLE_BYTE_PAIR(0xB9EE, 0xBC43)
+DOUBLE_BYTE_PAIR(0xB9EF, 0xBC44)
+DOUBLE_BYTE_PAIR(0xB9F0, 0xBC45)
+DOUBLE_BYTE_PAIR(0xB9F1, 0xBC49)
+DOUBLE_BYTE_PAIR(0xB9F2, 0xBC4C)
+DOUBLE_BYTE_PAIR(0xB9F3, 0xBC4D)
+DOUBLE_BYTE_PAIR(0xB9F4, 0xBC50)
+DOUBLE_BYTE_PAIR(0xB9F5, 0xBC5D)
+DOUBLE_BYTE_PAIR(0xB9F6, 0xBC84)
+DOUBLE_BYTE_PAIR(0xB9F7, 0xBC85)
+DOUBLE_BYTE_PAIR(0xB9F8, 0xBC88)
+DOUBLE_BYTE_PAIR(0xB9F9, 0xBC8B)
+DOUBLE_BYTE_PAIR(0xB9FA, 0xBC8C)
+DOUBLE_BYTE_PAIR(0xB9FB, 0xBC8E)
+DOUBLE_BYTE_PAIR(0xB9FC, 0xBC94)
+DOUBLE_BYTE_PAIR(0xB9FD, 0xBC95)
+DOUBLE_BYTE_PAIR(0xB9FE, 0xBC97)
+DOUBLE_BYTE_PAIR(0xBA41, 0xD28D)
+DOUBLE_BYTE_PAIR(0xBA42, 0xD28E)
+DOUBLE_BYTE_PAIR(0xBA43, 0xD28F)
+DOUBLE_BYTE_PAIR(0xBA44, 0xD292)
+DOUBLE_BYTE_PAIR(0xBA45, 0xD293)
+DOUBLE_BYTE_PAIR(0xBA46, 0xD294)
+DOUBLE_BYTE_PAIR(0xBA47, 0xD296)
+DOUBLE_BYTE_PAIR(0xBA48, 0xD297)
+DOUBLE_BYTE_PAIR(0xBA49, 0xD298)
+DOUBLE_BYTE_PAIR(0xBA4A, 0xD299)
+DOUBLE_BYTE_PAIR(0xBA4B, 0xD29A)
+DOUBLE_BYTE_PAIR(0xBA4C, 0xD29B)
+DOUBLE_BYTE_PAIR(0xBA4D, 0xD29D)
+DOUBLE_BYTE_PAIR(0xBA4E, 0xD29E)
+DOUBLE_BYTE_PAIR(0xBA4F, 0xD29F)
+DOUBLE_BYTE_PAIR(0xBA50, 0xD2A1)
+DOUBLE_BYTE_PAIR(0xBA51, 0xD2A2)
+DOUBLE_BYTE_PAIR(0xBA52, 0xD2A3)
+DOUBLE_BYTE_PAIR(0xBA53, 0xD2A5)
+DOUBLE_BYTE_PAIR(0xBA54, 0xD2A6)
+DOUBLE_BYTE_PAIR(0xBA55, 0xD2A7)
+DOUBLE_BYTE_PAIR(0xBA56, 0xD2A8)
+DOUBLE_BYTE_PAIR(0xBA57, 0xD2A9)
+DOUBLE_BYTE_PAIR(0xBA58, 0xD2AA)
+DOUBLE_BYTE_PAIR(0xBA59, 0xD2AB)
+DOUBLE_BYTE_PAIR(0xBA5A, 0xD2AD)
+DOUBLE_BYTE_PAIR(0xBA61, 0xD2AE)
+DOUBLE_BYTE_PAIR(0xBA62, 0xD2AF)
+DOUBLE_BYTE_PAIR(0xBA63, 0xD2B0)
+DOUBLE_BYTE_PAIR(0xBA64, 0xD2B2)
+DOUBLE_BYTE_PAIR(0xBA65, 0xD2B3)
+DOUBLE_BYTE_PAIR(0xBA66, 0xD2B4)
+DOUBLE_BYTE_PAIR(0xBA67, 0xD2B5)
+DOUBLE_BYTE_PAIR(0xBA68, 0xD2B6)
+DOUBLE_BYTE_PAIR(0xBA69, 0xD2B7)
+DOUBLE_BYTE_PAIR(0xBA6A, 0xD2BA)
+DOUBLE_BYTE_PAIR(0xBA6B, 0xD2BB)
+DOUBLE_BYTE_PAIR(0xBA6C, 0xD2BD)
+DOUBLE_BYTE_PAIR(0xBA6D, 0xD2BE)
+DOUBLE_BYTE_PAIR(0xBA6E, 0xD2C1)
+DOUBLE_BYTE_PAIR(0xBA6F, 0xD2C3)
+DOUBLE_BYTE_PAIR(0xBA70, 0xD2C4)
+DOUBLE_BYTE_PAIR(0xBA71, 0xD2C5)
+DOUBLE_BYTE_PAIR(0xBA72, 0xD2C6)
+DOUBLE_BYTE_PAIR(0xBA73, 0xD2C7)
+DOUBLE_BYTE_PAIR(0xBA74, 0xD2CA)
+DOUBLE_BYTE_PAIR(0xBA75, 0xD2CC)
+DOUBLE_BYTE_PAIR(0xBA76, 0xD2CD)
+DOUBLE_BYTE_PAIR(0xBA77, 0xD2CE)
+DOUBLE_BYTE_PAIR(0xBA78, 0xD2CF)
+DOUBLE_BYTE_PAIR(0xBA79, 0xD2D0)
+DOUBLE_BYTE_PAIR(0xBA7A, 0xD2D1)
+DOUBLE_BYTE_PAIR(0xBA81, 0xD2D2)
+DOUBLE_BYTE_PAIR(0xBA82, 0xD2D3)
+DOUBLE_BYTE_PAIR(0xBA83, 0xD2D5)
+DOUBLE_BYTE_PAIR(0xBA84, 0xD2D6)
+DOUBLE_BYTE_PAIR(0xBA85, 0xD2D7)
+DOUBLE_BYTE_PAIR(0xBA86, 0xD2D9)
+DOUBLE_BYTE_PAIR(0xBA87, 0xD2DA)
+DOUBLE_BYTE_PAIR(0xBA88, 0xD2DB)
+DOUBLE_BYTE_PAIR(0xBA89, 0xD2DD)
+DOUBLE_BYTE_PAIR(0xBA8A, 0xD2DE)
+DOUBLE_BYTE_PAIR(0xBA8B, 0xD2DF)
+DOUBLE_BYTE_PAIR(0xBA8C, 0xD2E0)
+DOUBLE_BYTE_PAIR(0xBA8D, 0xD2E1)
+DOUBLE_BYTE_PAIR(0xBA8E, 0xD2E2)
+DOUBLE_BYTE_PAIR(0xBA8F, 0xD2E3)
+DOUBLE_BYTE_PAIR(0xBA90, 0xD2E6)
+DOUBLE_BYTE_PAIR(0xBA91, 0xD2E7)
+DOUBLE_BYTE_PAIR(0xBA92, 0xD2E8)
+DOUBLE_BYTE_PAIR(0xBA93, 0xD2E9)
+DOUBLE_BYTE_PAIR(0xBA94, 0xD2EA)
+DOUBLE_BYTE_PAIR(0xBA95, 0xD2EB)
+DOUBLE_BYTE_PAIR(0xBA96, 0xD2EC)
+DOUBLE_BYTE_PAIR(0xBA97, 0xD2ED)
+DOUBLE_BYTE_PAIR(0xBA98, 0xD2EE)
+DOUBLE_BYTE_PAIR(0xBA99, 0xD2EF)
+DOUBLE_BYTE_PAIR(0xBA9A, 0xD2F2)
+DOUBLE_BYTE_PAIR(0xBA9B, 0xD2F3)
+DOUBLE_BYTE_PAIR(0xBA9C, 0xD2F5)
+DOUBLE_BYTE_PAIR(0xBA9D, 0xD2F6)
+DOUBLE_BYTE_PAIR(0xBA9E, 0xD2F7)
+DOUBLE_BYTE_PAIR(0xBA9F, 0xD2F9)
+DOUBLE_BYTE_PAIR(0xBAA0, 0xD2FA)
+DOUBLE_BYTE_PAIR(0xBAA1, 0xBC99)
+DOUBLE_BYTE_PAIR(0xBAA2, 0xBC9A)
+DOUBLE_BYTE_PAIR(0xBAA3, 0xBCA0)
+DOUBLE_BYTE_PAIR(0xBAA4, 0xBCA1)
+DOUBLE_BYTE_PAIR(0xBAA5, 0xBCA4)
+DOUBLE_BYTE_PAIR(0xBAA6, 0xBCA7)
+DOUBLE_BYTE_PAIR(0xBAA7, 0xBCA8)
+DOUBLE_BYTE_PAIR(0xBAA8, 0xBCB0)
+DOUBLE_BYTE_PAIR(0xBAA9, 0xBCB1)
+DOUBLE_BYTE_PAIR(0xBAAA, 0xBCB3)
+DOUBLE_BYTE_PAIR(0xBAAB, 0xBCB4)
+DOUBLE_BYTE_PAIR(0xBAAC, 0xBCB5)
+DOUBLE_BYTE_PAIR(0xBAAD, 0xBCBC)
+DOUBLE_BYTE_PAIR(0xBAAE, 0xBCBD)
+DOUBLE_BYTE_PAIR(0xBAAF, 0xBCC0)
+DOUBLE_BYTE_PAIR(0xBAB0, 0xBCC4)
+DOUBLE_BYTE_PAIR(0xBAB1, 0xBCCD)
+DOUBLE_BYTE_PAIR(0xBAB2, 0xBCCF)
+DOUBLE_BYTE_PAIR(0xBAB3, 0xBCD0)
+DOUBLE_BYTE_PAIR(0xBAB4, 0xBCD1)
+DOUBLE_BYTE_PAIR(0xBAB5, 0xBCD5)
+DOUBLE_BYTE_PAIR(0xBAB6, 0xBCD8)
+DOUBLE_BYTE_PAIR(0xBAB7, 0xBCDC)
+DOUBLE_BYTE_PAIR(0xBAB8, 0xBCF4)
+DOUBLE_BYTE_PAIR(0xBAB9, 0xBCF5)
+DOUBLE_BYTE_PAIR(0xBABA, 0xBCF6)
+DOUBLE_BYTE_PAIR(0xBABB, 0xBCF8)
+DOUBLE_BYTE_PAIR(0xBABC, 0xBCFC)
+DOUBLE_BYTE_PAIR(0xBABD, 0xBD04)
+DOUBLE_BYTE_PAIR(0xBABE, 0xBD05)
+DOUBLE_BYTE_PAIR(0xBABF, 0xBD07)
+DOUBLE_BYTE_PAIR(0xBAC0, 0xBD09)
+DOUBLE_BYTE_PAIR(0xBAC1, 0xBD10)
+DOUBLE_BYTE_PAIR(0xBAC2, 0xBD14)
+DOUBLE_BYTE_PAIR(0xBAC3, 0xBD24)
+DOUBLE_BYTE_PAIR(0xBAC4, 0xBD2C)
+DOUBLE_BYTE_PAIR(0xBAC5, 0xBD40)
+DOUBLE_BYTE_PAIR(0xBAC6, 0xBD48)
+DOUBLE_BYTE_PAIR(0xBAC7, 0xBD49)
+DOUBLE_BYTE_PAIR(0xBAC8, 0xBD4C)
+DOUBLE_BYTE_PAIR(0xBAC9, 0xBD50)
+DOUBLE_BYTE_PAIR(0xBACA, 0xBD58)
+DOUBLE_BYTE_PAIR(0xBACB, 0xBD59)
+DOUBLE_BYTE_PAIR(0xBACC, 0xBD64)
+DOUBLE_BYTE_PAIR(0xBACD, 0xBD68)
+DOUBLE_BYTE_PAIR(0xBACE, 0xBD80)
+DOUBLE_BYTE_PAIR(0xBACF, 0xBD81)
+DOUBLE_BYTE_PAIR(0xBAD0, 0xBD84)
+DOUBLE_BYTE_PAIR(0xBAD1, 0xBD87)
+DOUBLE_BYTE_PAIR(0xBAD2, 0xBD88)
+DOUBLE_BYTE_PAIR(0xBAD3, 0xBD89)
+DOUBLE_BYTE_PAIR(0xBAD4, 0xBD8A)
+DOUBLE_BYTE_PAIR(0xBAD5, 0xBD90)
+DOUBLE_BYTE_PAIR(0xBAD6, 0xBD91)
+DOUBLE_BYTE_PAIR(0xBAD7, 0xBD93)
+DOUBLE_BYTE_PAIR(0xBAD8, 0xBD95)
+DOUBLE_BYTE_PAIR(0xBAD9, 0xBD99)
+DOUBLE_BYTE_PAIR(0xBADA, 0xBD9A)
+DOUBLE_BYTE_PAIR(0xBADB, 0xBD9C)
+DOUBLE_BYTE_PAIR(0xBADC, 0xBDA4)
+DOUBLE_BYTE_PAIR(0xBADD, 0xBDB0)
+DOUBLE_BYTE_PAIR(0xBADE, 0xBDB8)
+DOUBLE_BYTE_PAIR(0xBADF, 0xBDD4)
+DOUBLE_BYTE_PAIR(0xBAE0, 0xBDD5)
+DOUBLE_BYTE_PAIR(0xBAE1, 0xBDD8)
+DOUBLE_BYTE_PAIR(0xBAE2, 0xBDDC)
+DOUBLE_BYTE_PAIR(0xBAE3, 0xBDE9)
+DOUBLE_BYTE_PAIR(0xBAE4, 0xBDF0)
+DOUBLE_BYTE_PAIR(0xBAE5, 0xBDF4)
+DOUBLE_BYTE_PAIR(0xBAE6, 0xBDF8)
+DOUBLE_BYTE_PAIR(0xBAE7, 0xBE00)
+DOUBLE_BYTE_PAIR(0xBAE8, 0xBE03)
+DOUBLE_BYTE_PAIR(0xBAE9, 0xBE05)
+DOUBLE_BYTE_PAIR(0xBAEA, 0xBE0C)
+DOUBLE_BYTE_PAIR(0xBAEB, 0xBE0D)
+DOUBLE_BYTE_PAIR(0xBAEC, 0xBE10)
+DOUBLE_BYTE_PAIR(0xBAED, 0xBE14)
+DOUBLE_BYTE_PAIR(0xBAEE, 0xBE1C)
+DOUBLE_BYTE_PAIR(0xBAEF, 0xBE1D)
+DOUBLE_BYTE_PAIR(0xBAF0, 0xBE1F)
+DOUBLE_BYTE_PAIR(0xBAF1, 0xBE44)
+DOUBLE_BYTE_PAIR(0xBAF2, 0xBE45)
+DOUBLE_BYTE_PAIR(0xBAF3, 0xBE48)
+DOUBLE_BYTE_PAIR(0xBAF4, 0xBE4C)
+DOUBLE_BYTE_PAIR(0xBAF5, 0xBE4E)
+DOUBLE_BYTE_PAIR(0xBAF6, 0xBE54)
+DOUBLE_BYTE_PAIR(0xBAF7, 0xBE55)
+DOUBLE_BYTE_PAIR(0xBAF8, 0xBE57)
+DOUBLE_BYTE_PAIR(0xBAF9, 0xBE59)
+DOUBLE_BYTE_PAIR(0xBAFA, 0xBE5A)
+DOUBLE_BYTE_PAIR(0xBAFB, 0xBE5B)
+DOUBLE_BYTE_PAIR(0xBAFC, 0xBE60)
+DOUBLE_BYTE_PAIR(0xBAFD, 0xBE61)
+DOUBLE_BYTE_PAIR(0xBAFE, 0xBE64)
+DOUBLE_BYTE_PAIR(0xBB41, 0xD2FB)
+DOUBLE_BYTE_PAIR(0xBB42, 0xD2FC)
+DOUBLE_BYTE_PAIR(0xBB43, 0xD2FD)
+DOUBLE_BYTE_PAIR(0xBB44, 0xD2FE)
+DOUBLE_BYTE_PAIR(0xBB45, 0xD2FF)
+DOUBLE_BYTE_PAIR(0xBB46, 0xD302)
+DOUBLE_BYTE_PAIR(0xBB47, 0xD304)
+DOUBLE_BYTE_PAIR(0xBB48, 0xD306)
+DOUBLE_BYTE_PAIR(0xBB49, 0xD307)
+DOUBLE_BYTE_PAIR(0xBB4A, 0xD308)
+DOUBLE_BYTE_PAIR(0xBB4B, 0xD309)
+DOUBLE_BYTE_PAIR(0xBB4C, 0xD30A)
+DOUBLE_BYTE_PAIR(0xBB4D, 0xD30B)
+DOUBLE_BYTE_PAIR(0xBB4E, 0xD30F)
+DOUBLE_BYTE_PAIR(0xBB4F, 0xD311)
+DOUBLE_BYTE_PAIR(0xBB50, 0xD312)
+DOUBLE_BYTE_PAIR(0xBB51, 0xD313)
+DOUBLE_BYTE_PAIR(0xBB52, 0xD315)
+DOUBLE_BYTE_PAIR(0xBB53, 0xD317)
+DOUBLE_BYTE_PAIR(0xBB54, 0xD318)
+DOUBLE_BYTE_PAIR(0xBB55, 0xD319)
+DOUBLE_BYTE_PAIR(0xBB56, 0xD31A)
+DOUBLE_BYTE_PAIR(0xBB57, 0xD31B)
+DOUBLE_BYTE_PAIR(0xBB58, 0xD31E)
+DOUBLE_BYTE_PAIR(0xBB59, 0xD322)
+DOUBLE_BYTE_PAIR(0xBB5A, 0xD323)
+DOUBLE_BYTE_PAIR(0xBB61, 0xD324)
+DOUBLE_BYTE_PAIR(0xBB62, 0xD326)
+DOUBLE_BYTE_PAIR(0xBB63, 0xD327)
+DOUBLE_BYTE_PAIR(0xBB64, 0xD32A)
+DOUBLE_BYTE_PAIR(0xBB65, 0xD32B)
+DOUBLE_BYTE_PAIR(0xBB66, 0xD32D)
+DOUBLE_BYTE_PAIR(0xBB67, 0xD32E)
+DOUBLE_BYTE_PAIR(0xBB68, 0xD32F)
+DOUBLE_BYTE_PAIR(0xBB69, 0xD331)
+DOUBLE_BYTE_PAIR(0xBB6A, 0xD332)
+DOUBLE_BYTE_PAIR(0xBB6B, 0xD333)
+DOUBLE_BYTE_PAIR(0xBB6C, 0xD334)
+DOUBLE_BYTE_PAIR(0xBB6D, 0xD335)
+DOUBLE_BYTE_PAIR(0xBB6E, 0xD336)
+DOUBLE_BYTE_PAIR(0xBB6F, 0xD337)
+DOUBLE_BYTE_PAIR(0xBB70, 0xD33A)
+DOUBLE_BYTE_PAIR(0xBB71, 0xD33E)
+DOUBLE_BYTE_PAIR(0xBB72, 0xD33F)
+DOUBLE_BYTE_PAIR(0xBB73, 0xD340)
+DOUBLE_BYTE_PAIR(0xBB74, 0xD341)
+DOUBLE_BYTE_PAIR(0xBB75, 0xD342)
+DOUBLE_BYTE_PAIR(0xBB76, 0xD343)
+DOUBLE_BYTE_PAIR(0xBB77, 0xD346)
+DOUBLE_BYTE_PAIR(0xBB78, 0xD347)
+DOUBLE_BYTE_PAIR(0xBB79, 0xD348)
+DOUBLE_BYTE_PAIR(0xBB7A, 0xD349)
+DOUBLE_BYTE_PAIR(0xBB81, 0xD34A)
+DOUBLE_BYTE_PAIR(0xBB82, 0xD34B)
+DOUBLE_BYTE_PAIR(0xBB83, 0xD34C)
+DOUBLE_BYTE_PAIR(0xBB84, 0xD34D)
+DOUBLE_BYTE_PAIR(0xBB85, 0xD34E)
+DOUBLE_BYTE_PAIR(0xBB86, 0xD34F)
+DOUBLE_BYTE_PAIR(0xBB87, 0xD350)
+DOUBLE_BYTE_PAIR(0xBB88, 0xD351)
+DOUBLE_BYTE_PAIR(0xBB89, 0xD352)
+DOUBLE_BYTE_PAIR(0xBB8A, 0xD353)
+DOUBLE_BYTE_PAIR(0xBB8B, 0xD354)
+DOUBLE_BYTE_PAIR(0xBB8C, 0xD355)
+DOUBLE_BYTE_PAIR(0xBB8D, 0xD356)
+DOUBLE_BYTE_PAIR(0xBB8E, 0xD357)
+DOUBLE_BYTE_PAIR(0xBB8F, 0xD358)
+DOUBLE_BYTE_PAIR(0xBB90, 0xD359)
+DOUBLE_BYTE_PAIR(0xBB91, 0xD35A)
+DOUBLE_BYTE_PAIR(0xBB92, 0xD35B)
+DOUBLE_BYTE_PAIR(0xBB93, 0xD35C)
+DOUBLE_BYTE_PAIR(0xBB94, 0xD35D)
+DOUBLE_BYTE_PAIR(0xBB95, 0xD35E)
+DOUBLE_BYTE_PAIR(0xBB96, 0xD35F)
+DOUBLE_BYTE_PAIR(0xBB97, 0xD360)
+DOUBLE_BYTE_PAIR(0xBB98, 0xD361)
+DOUBLE_BYTE_PAIR(0xBB99, 0xD362)
+DOUBLE_BYTE_PAIR(0xBB9A, 0xD363)
+DOUBLE_BYTE_PAIR(0xBB9B, 0xD364)
+DOUBLE_BYTE_PAIR(0xBB9C, 0xD365)
+DOUBLE_BYTE_PAIR(0xBB9D, 0xD366)
+DOUBLE_BYTE_PAIR(0xBB9E, 0xD367)
+DOUBLE_BYTE_PAIR(0xBB9F, 0xD368)
+DOUBLE_BYTE_PAIR(0xBBA0, 0xD369)
+DOUBLE_BYTE_PAIR(0xBBA1, 0xBE68)
+DOUBLE_BYTE_PAIR(0xBBA2, 0xBE6A)
+DOUBLE_BYTE_PAIR(0xBBA3, 0xBE70)
+DOUBLE_BYTE_PAIR(0xBBA4, 0xBE71)
+DOUBLE_BYTE_PAIR(0xBBA5, 0xBE73)
+DOUBLE_BYTE_PAIR(0xBBA6, 0xBE74)
+DOUBLE_BYTE_PAIR(0xBBA7, 0xBE75)
+DOUBLE_BYTE_PAIR(0xBBA8, 0xBE7B)
+DOUBLE_BYTE_PAIR(0xBBA9, 0xBE7C)
+DOUBLE_BYTE_PAIR(0xBBAA, 0xBE7D)
+DOUBLE_BYTE_PAIR(0xBBAB, 0xBE80)
+DOUBLE_BYTE_PAIR(0xBBAC, 0xBE84)
+DOUBLE_BYTE_PAIR(0xBBAD, 0xBE8C)
+DOUBLE_BYTE_PAIR(0xBBAE, 0xBE8D)
+DOUBLE_BYTE_PAIR(0xBBAF, 0xBE8F)
+DOUBLE_BYTE_PAIR(0xBBB0, 0xBE90)
+DOUBLE_BYTE_PAIR(0xBBB1, 0xBE91)
+DOUBLE_BYTE_PAIR(0xBBB2, 0xBE98)
+DOUBLE_BYTE_PAIR(0xBBB3, 0xBE99)
+DOUBLE_BYTE_PAIR(0xBBB4, 0xBEA8)
+DOUBLE_BYTE_PAIR(0xBBB5, 0xBED0)
+DOUBLE_BYTE_PAIR(0xBBB6, 0xBED1)
+DOUBLE_BYTE_PAIR(0xBBB7, 0xBED4)
+DOUBLE_BYTE_PAIR(0xBBB8, 0xBED7)
+DOUBLE_BYTE_PAIR(0xBBB9, 0xBED8)
+DOUBLE_BYTE_PAIR(0xBBBA, 0xBEE0)
+DOUBLE_BYTE_PAIR(0xBBBB, 0xBEE3)
+DOUBLE_BYTE_PAIR(0xBBBC, 0xBEE4)
+DOUBLE_BYTE_PAIR(0xBBBD, 0xBEE5)
+DOUBLE_BYTE_PAIR(0xBBBE, 0xBEEC)
+DOUBLE_BYTE_PAIR(0xBBBF, 0xBF01)
+DOUBLE_BYTE_PAIR(0xBBC0, 0xBF08)
+DOUBLE_BYTE_PAIR(0xBBC1, 0xBF09)
+DOUBLE_BYTE_PAIR(0xBBC2, 0xBF18)
+DOUBLE_BYTE_PAIR(0xBBC3, 0xBF19)
+DOUBLE_BYTE_PAIR(0xBBC4, 0xBF1B)
+DOUBLE_BYTE_PAIR(0xBBC5, 0xBF1C)
+DOUBLE_BYTE_PAIR(0xBBC6, 0xBF1D)
+DOUBLE_BYTE_PAIR(0xBBC7, 0xBF40)
+DOUBLE_BYTE_PAIR(0xBBC8, 0xBF41)
+DOUBLE_BYTE_PAIR(0xBBC9, 0xBF44)
+DOUBLE_BYTE_PAIR(0xBBCA, 0xBF48)
+DOUBLE_BYTE_PAIR(0xBBCB, 0xBF50)
+DOUBLE_BYTE_PAIR(0xBBCC, 0xBF51)
+DOUBLE_BYTE_PAIR(0xBBCD, 0xBF55)
+DOUBLE_BYTE_PAIR(0xBBCE, 0xBF94)
+DOUBLE_BYTE_PAIR(0xBBCF, 0xBFB0)
+DOUBLE_BYTE_PAIR(0xBBD0, 0xBFC5)
+DOUBLE_BYTE_PAIR(0xBBD1, 0xBFCC)
+DOUBLE_BYTE_PAIR(0xBBD2, 0xBFCD)
+DOUBLE_BYTE_PAIR(0xBBD3, 0xBFD0)
+DOUBLE_BYTE_PAIR(0xBBD4, 0xBFD4)
+DOUBLE_BYTE_PAIR(0xBBD5, 0xBFDC)
+DOUBLE_BYTE_PAIR(0xBBD6, 0xBFDF)
+DOUBLE_BYTE_PAIR(0xBBD7, 0xBFE1)
+DOUBLE_BYTE_PAIR(0xBBD8, 0xC03C)
+DOUBLE_BYTE_PAIR(0xBBD9, 0xC051)
+DOUBLE_BYTE_PAIR(0xBBDA, 0xC058)
+DOUBLE_BYTE_PAIR(0xBBDB, 0xC05C)
+DOUBLE_BYTE_PAIR(0xBBDC, 0xC060)
+DOUBLE_BYTE_PAIR(0xBBDD, 0xC068)
+DOUBLE_BYTE_PAIR(0xBBDE, 0xC069)
+DOUBLE_BYTE_PAIR(0xBBDF, 0xC090)
+DOUBLE_BYTE_PAIR(0xBBE0, 0xC091)
+DOUBLE_BYTE_PAIR(0xBBE1, 0xC094)
+DOUBLE_BYTE_PAIR(0xBBE2, 0xC098)
+DOUBLE_BYTE_PAIR(0xBBE3, 0xC0A0)
+DOUBLE_BYTE_PAIR(0xBBE4, 0xC0A1)
+DOUBLE_BYTE_PAIR(0xBBE5, 0xC0A3)
+DOUBLE_BYTE_PAIR(0xBBE6, 0xC0A5)
+DOUBLE_BYTE_PAIR(0xBBE7, 0xC0AC)
+DOUBLE_BYTE_PAIR(0xBBE8, 0xC0AD)
+DOUBLE_BYTE_PAIR(0xBBE9, 0xC0AF)
+DOUBLE_BYTE_PAIR(0xBBEA, 0xC0B0)
+DOUBLE_BYTE_PAIR(0xBBEB, 0xC0B3)
+DOUBLE_BYTE_PAIR(0xBBEC, 0xC0B4)
+DOUBLE_BYTE_PAIR(0xBBED, 0xC0B5)
+DOUBLE_BYTE_PAIR(0xBBEE, 0xC0B6)
+DOUBLE_BYTE_PAIR(0xBBEF, 0xC0BC)
+DOUBLE_BYTE_PAIR(0xBBF0, 0xC0BD)
+DOUBLE_BYTE_PAIR(0xBBF1, 0xC0BF)
+DOUBLE_BYTE_PAIR(0xBBF2, 0xC0C0)
+DOUBLE_BYTE_PAIR(0xBBF3, 0xC0C1)
+DOUBLE_BYTE_PAIR(0xBBF4, 0xC0C5)
+DOUBLE_BYTE_PAIR(0xBBF5, 0xC0C8)
+DOUBLE_BYTE_PAIR(0xBBF6, 0xC0C9)
+DOUBLE_BYTE_PAIR(0xBBF7, 0xC0CC)
+DOUBLE_BYTE_PAIR(0xBBF8, 0xC0D0)
+DOUBLE_BYTE_PAIR(0xBBF9, 0xC0D8)
+DOUBLE_BYTE_PAIR(0xBBFA, 0xC0D9)
+DOUBLE_BYTE_PAIR(0xBBFB, 0xC0DB)
+DOUBLE_BYTE_PAIR(0xBBFC, 0xC0DC)
+DOUBLE_BYTE_PAIR(0xBBFD, 0xC0DD)
+DOUBLE_BYTE_PAIR(0xBBFE, 0xC0E4)
+DOUBLE_BYTE_PAIR(0xBC41, 0xD36A)
+DOUBLE_BYTE_PAIR(0xBC42, 0xD36B)
+DOUBLE_BYTE_PAIR(0xBC43, 0xD36C)
+DOUBLE_BYTE_PAIR(0xBC44, 0xD36D)
+DOUBLE_BYTE_PAIR(0xBC45, 0xD36E)
+DOUBLE_BYTE_PAIR(0xBC46, 0xD36F)
+DOUBLE_BYTE_PAIR(0xBC47, 0xD370)
+DOUBLE_BYTE_PAIR(0xBC48, 0xD371)
+DOUBLE_BYTE_PAIR(0xBC49, 0xD372)
+DOUBLE_BYTE_PAIR(0xBC4A, 0xD373)
+DOUBLE_BYTE_PAIR(0xBC4B, 0xD374)
+DOUBLE_BYTE_PAIR(0xBC4C, 0xD375)
+DOUBLE_BYTE_PAIR(0xBC4D, 0xD376)
+DOUBLE_BYTE_PAIR(0xBC4E, 0xD377)
+DOUBLE_BYTE_PAIR(0xBC4F, 0xD378)
+DOUBLE_BYTE_PAIR(0xBC50, 0xD379)
+DOUBLE_BYTE_PAIR(0xBC51, 0xD37A)
+DOUBLE_BYTE_PAIR(0xBC52, 0xD37B)
+DOUBLE_BYTE_PAIR(0xBC53, 0xD37E)
+DOUBLE_BYTE_PAIR(0xBC54, 0xD37F)
+DOUBLE_BYTE_PAIR(0xBC55, 0xD381)
+DOUBLE_BYTE_PAIR(0xBC56, 0xD382)
+DOUBLE_BYTE_PAIR(0xBC57, 0xD383)
+DOUBLE_BYTE_PAIR(0xBC58, 0xD385)
+DOUBLE_BYTE_PAIR(0xBC59, 0xD386)
+DOUBLE_BYTE_PAIR(0xBC5A, 0xD387)
+DOUBLE_BYTE_PAIR(0xBC61, 0xD388)
+DOUBLE_BYTE_PAIR(0xBC62, 0xD389)
+DOUBLE_BYTE_PAIR(0xBC63, 0xD38A)
+DOUBLE_BYTE_PAIR(0xBC64, 0xD38B)
+DOUBLE_BYTE_PAIR(0xBC65, 0xD38E)
+DOUBLE_BYTE_PAIR(0xBC66, 0xD392)
+DOUBLE_BYTE_PAIR(0xBC67, 0xD393)
+DOUBLE_BYTE_PAIR(0xBC68, 0xD394)
+DOUBLE_BYTE_PAIR(0xBC69, 0xD395)
+DOUBLE_BYTE_PAIR(0xBC6A, 0xD396)
+DOUBLE_BYTE_PAIR(0xBC6B, 0xD397)
+DOUBLE_BYTE_PAIR(0xBC6C, 0xD39A)
+DOUBLE_BYTE_PAIR(0xBC6D, 0xD39B)
+DOUBLE_BYTE_PAIR(0xBC6E, 0xD39D)
+DOUBLE_BYTE_PAIR(0xBC6F, 0xD39E)
+DOUBLE_BYTE_PAIR(0xBC70, 0xD39F)
+DOUBLE_BYTE_PAIR(0xBC71, 0xD3A1)
+DOUBLE_BYTE_PAIR(0xBC72, 0xD3A2)
+DOUBLE_BYTE_PAIR(0xBC73, 0xD3A3)
+DOUBLE_BYTE_PAIR(0xBC74, 0xD3A4)
+DOUBLE_BYTE_PAIR(0xBC75, 0xD3A5)
+DOUBLE_BYTE_PAIR(0xBC76, 0xD3A6)
+DOUBLE_BYTE_PAIR(0xBC77, 0xD3A7)
+DOUBLE_BYTE_PAIR(0xBC78, 0xD3AA)
+DOUBLE_BYTE_PAIR(0xBC79, 0xD3AC)
+DOUBLE_BYTE_PAIR(0xBC7A, 0xD3AE)
+DOUBLE_BYTE_PAIR(0xBC81, 0xD3AF)
+DOUBLE_BYTE_PAIR(0xBC82, 0xD3B0)
+DOUBLE_BYTE_PAIR(0xBC83, 0xD3B1)
+DOUBLE_BYTE_PAIR(0xBC84, 0xD3B2)
+DOUBLE_BYTE_PAIR(0xBC85, 0xD3B3)
+DOUBLE_BYTE_PAIR(0xBC86, 0xD3B5)
+DOUBLE_BYTE_PAIR(0xBC87, 0xD3B6)
+DOUBLE_BYTE_PAIR(0xBC88, 0xD3B7)
+DOUBLE_BYTE_PAIR(0xBC89, 0xD3B9)
+DOUBLE_BYTE_PAIR(0xBC8A, 0xD3BA)
+DOUBLE_BYTE_PAIR(0xBC8B, 0xD3BB)
+DOUBLE_BYTE_PAIR(0xBC8C, 0xD3BD)
+DOUBLE_BYTE_PAIR(0xBC8D, 0xD3BE)
+DOUBLE_BYTE_PAIR(0xBC8E, 0xD3BF)
+DOUBLE_BYTE_PAIR(0xBC8F, 0xD3C0)
+DOUBLE_BYTE_PAIR(0xBC90, 0xD3C1)
+DOUBLE_BYTE_PAIR(0xBC91, 0xD3C2)
+DOUBLE_BYTE_PAIR(0xBC92, 0xD3C3)
+DOUBLE_BYTE_PAIR(0xBC93, 0xD3C6)
+DOUBLE_BYTE_PAIR(0xBC94, 0xD3C7)
+DOUBLE_BYTE_PAIR(0xBC95, 0xD3CA)
+DOUBLE_BYTE_PAIR(0xBC96, 0xD3CB)
+DOUBLE_BYTE_PAIR(0xBC97, 0xD3CC)
+DOUBLE_BYTE_PAIR(0xBC98, 0xD3CD)
+DOUBLE_BYTE_PAIR(0xBC99, 0xD3CE)
+DOUBLE_BYTE_PAIR(0xBC9A, 0xD3CF)
+DOUBLE_BYTE_PAIR(0xBC9B, 0xD3D1)
+DOUBLE_BYTE_PAIR(0xBC9C, 0xD3D2)
+DOUBLE_BYTE_PAIR(0xBC9D, 0xD3D3)
+DOUBLE_BYTE_PAIR(0xBC9E, 0xD3D4)
+DOUBLE_BYTE_PAIR(0xBC9F, 0xD3D5)
+DOUBLE_BYTE_PAIR(0xBCA0, 0xD3D6)
+DOUBLE_BYTE_PAIR(0xBCA1, 0xC0E5)
+DOUBLE_BYTE_PAIR(0xBCA2, 0xC0E8)
+DOUBLE_BYTE_PAIR(0xBCA3, 0xC0EC)
+DOUBLE_BYTE_PAIR(0xBCA4, 0xC0F4)
+DOUBLE_BYTE_PAIR(0xBCA5, 0xC0F5)
+DOUBLE_BYTE_PAIR(0xBCA6, 0xC0F7)
+DOUBLE_BYTE_PAIR(0xBCA7, 0xC0F9)
+DOUBLE_BYTE_PAIR(0xBCA8, 0xC100)
+DOUBLE_BYTE_PAIR(0xBCA9, 0xC104)
+DOUBLE_BYTE_PAIR(0xBCAA, 0xC108)
+DOUBLE_BYTE_PAIR(0xBCAB, 0xC110)
+DOUBLE_BYTE_PAIR(0xBCAC, 0xC115)
+DOUBLE_BYTE_PAIR(0xBCAD, 0xC11C)
+DOUBLE_BYTE_PAIR(0xBCAE, 0xC11D)
+DOUBLE_BYTE_PAIR(0xBCAF, 0xC11E)
+DOUBLE_BYTE_PAIR(0xBCB0, 0xC11F)
+DOUBLE_BYTE_PAIR(0xBCB1, 0xC120)
+DOUBLE_BYTE_PAIR(0xBCB2, 0xC123)
+DOUBLE_BYTE_PAIR(0xBCB3, 0xC124)
+DOUBLE_BYTE_PAIR(0xBCB4, 0xC126)
+DOUBLE_BYTE_PAIR(0xBCB5, 0xC127)
+DOUBLE_BYTE_PAIR(0xBCB6, 0xC12C)
+DOUBLE_BYTE_PAIR(0xBCB7, 0xC12D)
+DOUBLE_BYTE_PAIR(0xBCB8, 0xC12F)
+DOUBLE_BYTE_PAIR(0xBCB9, 0xC130)
+DOUBLE_BYTE_PAIR(0xBCBA, 0xC131)
+DOUBLE_BYTE_PAIR(0xBCBB, 0xC136)
+DOUBLE_BYTE_PAIR(0xBCBC, 0xC138)
+DOUBLE_BYTE_PAIR(0xBCBD, 0xC139)
+DOUBLE_BYTE_PAIR(0xBCBE, 0xC13C)
+DOUBLE_BYTE_PAIR(0xBCBF, 0xC140)
+DOUBLE_BYTE_PAIR(0xBCC0, 0xC148)
+DOUBLE_BYTE_PAIR(0xBCC1, 0xC149)
+DOUBLE_BYTE_PAIR(0xBCC2, 0xC14B)
+DOUBLE_BYTE_PAIR(0xBCC3, 0xC14C)
+DOUBLE_BYTE_PAIR(0xBCC4, 0xC14D)
+DOUBLE_BYTE_PAIR(0xBCC5, 0xC154)
+DOUBLE_BYTE_PAIR(0xBCC6, 0xC155)
+DOUBLE_BYTE_PAIR(0xBCC7, 0xC158)
+DOUBLE_BYTE_PAIR(0xBCC8, 0xC15C)
+DOUBLE_BYTE_PAIR(0xBCC9, 0xC164)
+DOUBLE_BYTE_PAIR(0xBCCA, 0xC165)
+DOUBLE_BYTE_PAIR(0xBCCB, 0xC167)
+DOUBLE_BYTE_PAIR(0xBCCC, 0xC168)
+DOUBLE_BYTE_PAIR(0xBCCD, 0xC169)
+DOUBLE_BYTE_PAIR(0xBCCE, 0xC170)
+DOUBLE_BYTE_PAIR(0xBCCF, 0xC174)
+DOUBLE_BYTE_PAIR(0xBCD0, 0xC178)
+DOUBLE_BYTE_PAIR(0xBCD1, 0xC185)
+DOUBLE_BYTE_PAIR(0xBCD2, 0xC18C)
+DOUBLE_BYTE_PAIR(0xBCD3, 0xC18D)
+DOUBLE_BYTE_PAIR(0xBCD4, 0xC18E)
+DOUBLE_BYTE_PAIR(0xBCD5, 0xC190)
+DOUBLE_BYTE_PAIR(0xBCD6, 0xC194)
+DOUBLE_BYTE_PAIR(0xBCD7, 0xC196)
+DOUBLE_BYTE_PAIR(0xBCD8, 0xC19C)
+DOUBLE_BYTE_PAIR(0xBCD9, 0xC19D)
+DOUBLE_BYTE_PAIR(0xBCDA, 0xC19F)
+DOUBLE_BYTE_PAIR(0xBCDB, 0xC1A1)
+DOUBLE_BYTE_PAIR(0xBCDC, 0xC1A5)
+DOUBLE_BYTE_PAIR(0xBCDD, 0xC1A8)
+DOUBLE_BYTE_PAIR(0xBCDE, 0xC1A9)
+DOUBLE_BYTE_PAIR(0xBCDF, 0xC1AC)
+DOUBLE_BYTE_PAIR(0xBCE0, 0xC1B0)
+DOUBLE_BYTE_PAIR(0xBCE1, 0xC1BD)
+DOUBLE_BYTE_PAIR(0xBCE2, 0xC1C4)
+DOUBLE_BYTE_PAIR(0xBCE3, 0xC1C8)
+DOUBLE_BYTE_PAIR(0xBCE4, 0xC1CC)
+DOUBLE_BYTE_PAIR(0xBCE5, 0xC1D4)
+DOUBLE_BYTE_PAIR(0xBCE6, 0xC1D7)
+DOUBLE_BYTE_PAIR(0xBCE7, 0xC1D8)
+DOUBLE_BYTE_PAIR(0xBCE8, 0xC1E0)
+DOUBLE_BYTE_PAIR(0xBCE9, 0xC1E4)
+DOUBLE_BYTE_PAIR(0xBCEA, 0xC1E8)
+DOUBLE_BYTE_PAIR(0xBCEB, 0xC1F0)
+DOUBLE_BYTE_PAIR(0xBCEC, 0xC1F1)
+DOUBLE_BYTE_PAIR(0xBCED, 0xC1F3)
+DOUBLE_BYTE_PAIR(0xBCEE, 0xC1FC)
+DOUBLE_BYTE_PAIR(0xBCEF, 0xC1FD)
+DOUBLE_BYTE_PAIR(0xBCF0, 0xC200)
+DOUBLE_BYTE_PAIR(0xBCF1, 0xC204)
+DOUBLE_BYTE_PAIR(0xBCF2, 0xC20C)
+DOUBLE_BYTE_PAIR(0xBCF3, 0xC20D)
+DOUBLE_BYTE_PAIR(0xBCF4, 0xC20F)
+DOUBLE_BYTE_PAIR(0xBCF5, 0xC211)
+DOUBLE_BYTE_PAIR(0xBCF6, 0xC218)
+DOUBLE_BYTE_PAIR(0xBCF7, 0xC219)
+DOUBLE_BYTE_PAIR(0xBCF8, 0xC21C)
+DOUBLE_BYTE_PAIR(0xBCF9, 0xC21F)
+DOUBLE_BYTE_PAIR(0xBCFA, 0xC220)
+DOUBLE_BYTE_PAIR(0xBCFB, 0xC228)
+DOUBLE_BYTE_PAIR(0xBCFC, 0xC229)
+DOUBLE_BYTE_PAIR(0xBCFD, 0xC22B)
+DOUBLE_BYTE_PAIR(0xBCFE, 0xC22D)
+DOUBLE_BYTE_PAIR(0xBD41, 0xD3D7)
+DOUBLE_BYTE_PAIR(0xBD42, 0xD3D9)
+DOUBLE_BYTE_PAIR(0xBD43, 0xD3DA)
+DOUBLE_BYTE_PAIR(0xBD44, 0xD3DB)
+DOUBLE_BYTE_PAIR(0xBD45, 0xD3DC)
+DOUBLE_BYTE_PAIR(0xBD46, 0xD3DD)
+DOUBLE_BYTE_PAIR(0xBD47, 0xD3DE)
+DOUBLE_BYTE_PAIR(0xBD48, 0xD3DF)
+DOUBLE_BYTE_PAIR(0xBD49, 0xD3E0)
+DOUBLE_BYTE_PAIR(0xBD4A, 0xD3E2)
+DOUBLE_BYTE_PAIR(0xBD4B, 0xD3E4)
+DOUBLE_BYTE_PAIR(0xBD4C, 0xD3E5)
+DOUBLE_BYTE_PAIR(0xBD4D, 0xD3E6)
+DOUBLE_BYTE_PAIR(0xBD4E, 0xD3E7)
+DOUBLE_BYTE_PAIR(0xBD4F, 0xD3E8)
+DOUBLE_BYTE_PAIR(0xBD50, 0xD3E9)
+DOUBLE_BYTE_PAIR(0xBD51, 0xD3EA)
+DOUBLE_BYTE_PAIR(0xBD52, 0xD3EB)
+DOUBLE_BYTE_PAIR(0xBD53, 0xD3EE)
+DOUBLE_BYTE_PAIR(0xBD54, 0xD3EF)
+DOUBLE_BYTE_PAIR(0xBD55, 0xD3F1)
+DOUBLE_BYTE_PAIR(0xBD56, 0xD3F2)
+DOUBLE_BYTE_PAIR(0xBD57, 0xD3F3)
+DOUBLE_BYTE_PAIR(0xBD58, 0xD3F5)
+DOUBLE_BYTE_PAIR(0xBD59, 0xD3F6)
+DOUBLE_BYTE_PAIR(0xBD5A, 0xD3F7)
+DOUBLE_BYTE_PAIR(0xBD61, 0xD3F8)
+DOUBLE_BYTE_PAIR(0xBD62, 0xD3F9)
+DOUBLE_BYTE_PAIR(0xBD63, 0xD3FA)
+DOUBLE_BYTE_PAIR(0xBD64, 0xD3FB)
+DOUBLE_BYTE_PAIR(0xBD65, 0xD3FE)
+DOUBLE_BYTE_PAIR(0xBD66, 0xD400)
+DOUBLE_BYTE_PAIR(0xBD67, 0xD402)
+DOUBLE_BYTE_PAIR(0xBD68, 0xD403)
+DOUBLE_BYTE_PAIR(0xBD69, 0xD404)
+DOUBLE_BYTE_PAIR(0xBD6A, 0xD405)
+DOUBLE_BYTE_PAIR(0xBD6B, 0xD406)
+DOUBLE_BYTE_PAIR(0xBD6C, 0xD407)
+DOUBLE_BYTE_PAIR(0xBD6D, 0xD409)
+DOUBLE_BYTE_PAIR(0xBD6E, 0xD40A)
+DOUBLE_BYTE_PAIR(0xBD6F, 0xD40B)
+DOUBLE_BYTE_PAIR(0xBD70, 0xD40C)
+DOUBLE_BYTE_PAIR(0xBD71, 0xD40D)
+DOUBLE_BYTE_PAIR(0xBD72, 0xD40E)
+DOUBLE_BYTE_PAIR(0xBD73, 0xD40F)
+DOUBLE_BYTE_PAIR(0xBD74, 0xD410)
+DOUBLE_BYTE_PAIR(0xBD75, 0xD411)
+DOUBLE_BYTE_PAIR(0xBD76, 0xD412)
+DOUBLE_BYTE_PAIR(0xBD77, 0xD413)
+DOUBLE_BYTE_PAIR(0xBD78, 0xD414)
+DOUBLE_BYTE_PAIR(0xBD79, 0xD415)
+DOUBLE_BYTE_PAIR(0xBD7A, 0xD416)
+DOUBLE_BYTE_PAIR(0xBD81, 0xD417)
+DOUBLE_BYTE_PAIR(0xBD82, 0xD418)
+DOUBLE_BYTE_PAIR(0xBD83, 0xD419)
+DOUBLE_BYTE_PAIR(0xBD84, 0xD41A)
+DOUBLE_BYTE_PAIR(0xBD85, 0xD41B)
+DOUBLE_BYTE_PAIR(0xBD86, 0xD41C)
+DOUBLE_BYTE_PAIR(0xBD87, 0xD41E)
+DOUBLE_BYTE_PAIR(0xBD88, 0xD41F)
+DOUBLE_BYTE_PAIR(0xBD89, 0xD420)
+DOUBLE_BYTE_PAIR(0xBD8A, 0xD421)
+DOUBLE_BYTE_PAIR(0xBD8B, 0xD422)
+DOUBLE_BYTE_PAIR(0xBD8C, 0xD423)
+DOUBLE_BYTE_PAIR(0xBD8D, 0xD424)
+DOUBLE_BYTE_PAIR(0xBD8E, 0xD425)
+DOUBLE_BYTE_PAIR(0xBD8F, 0xD426)
+DOUBLE_BYTE_PAIR(0xBD90, 0xD427)
+DOUBLE_BYTE_PAIR(0xBD91, 0xD428)
+DOUBLE_BYTE_PAIR(0xBD92, 0xD429)
+DOUBLE_BYTE_PAIR(0xBD93, 0xD42A)
+DOUBLE_BYTE_PAIR(0xBD94, 0xD42B)
+DOUBLE_BYTE_PAIR(0xBD95, 0xD42C)
+DOUBLE_BYTE_PAIR(0xBD96, 0xD42D)
+DOUBLE_BYTE_PAIR(0xBD97, 0xD42E)
+DOUBLE_BYTE_PAIR(0xBD98, 0xD42F)
+DOUBLE_BYTE_PAIR(0xBD99, 0xD430)
+DOUBLE_BYTE_PAIR(0xBD9A, 0xD431)
+DOUBLE_BYTE_PAIR(0xBD9B, 0xD432)
+DOUBLE_BYTE_PAIR(0xBD9C, 0xD433)
+DOUBLE_BYTE_PAIR(0xBD9D, 0xD434)
+DOUBLE_BYTE_PAIR(0xBD9E, 0xD435)
+DOUBLE_BYTE_PAIR(0xBD9F, 0xD436)
+DOUBLE_BYTE_PAIR(0xBDA0, 0xD437)
+DOUBLE_BYTE_PAIR(0xBDA1, 0xC22F)
+DOUBLE_BYTE_PAIR(0xBDA2, 0xC231)
+DOUBLE_BYTE_PAIR(0xBDA3, 0xC232)
+DOUBLE_BYTE_PAIR(0xBDA4, 0xC234)
+DOUBLE_BYTE_PAIR(0xBDA5, 0xC248)
+DOUBLE_BYTE_PAIR(0xBDA6, 0xC250)
+DOUBLE_BYTE_PAIR(0xBDA7, 0xC251)
+DOUBLE_BYTE_PAIR(0xBDA8, 0xC254)
+DOUBLE_BYTE_PAIR(0xBDA9, 0xC258)
+DOUBLE_BYTE_PAIR(0xBDAA, 0xC260)
+DOUBLE_BYTE_PAIR(0xBDAB, 0xC265)
+DOUBLE_BYTE_PAIR(0xBDAC, 0xC26C)
+DOUBLE_BYTE_PAIR(0xBDAD, 0xC26D)
+DOUBLE_BYTE_PAIR(0xBDAE, 0xC270)
+DOUBLE_BYTE_PAIR(0xBDAF, 0xC274)
+DOUBLE_BYTE_PAIR(0xBDB0, 0xC27C)
+DOUBLE_BYTE_PAIR(0xBDB1, 0xC27D)
+DOUBLE_BYTE_PAIR(0xBDB2, 0xC27F)
+DOUBLE_BYTE_PAIR(0xBDB3, 0xC281)
+DOUBLE_BYTE_PAIR(0xBDB4, 0xC288)
+DOUBLE_BYTE_PAIR(0xBDB5, 0xC289)
+DOUBLE_BYTE_PAIR(0xBDB6, 0xC290)
+DOUBLE_BYTE_PAIR(0xBDB7, 0xC298)
+DOUBLE_BYTE_PAIR(0xBDB8, 0xC29B)
+DOUBLE_BYTE_PAIR(0xBDB9, 0xC29D)
+DOUBLE_BYTE_PAIR(0xBDBA, 0xC2A4)
+DOUBLE_BYTE_PAIR(0xBDBB, 0xC2A5)
+DOUBLE_BYTE_PAIR(0xBDBC, 0xC2A8)
+DOUBLE_BYTE_PAIR(0xBDBD, 0xC2AC)
+DOUBLE_BYTE_PAIR(0xBDBE, 0xC2AD)
+DOUBLE_BYTE_PAIR(0xBDBF, 0xC2B4)
+DOUBLE_BYTE_PAIR(0xBDC0, 0xC2B5)
+DOUBLE_BYTE_PAIR(0xBDC1, 0xC2B7)
+DOUBLE_BYTE_PAIR(0xBDC2, 0xC2B9)
+DOUBLE_BYTE_PAIR(0xBDC3, 0xC2DC)
+DOUBLE_BYTE_PAIR(0xBDC4, 0xC2DD)
+DOUBLE_BYTE_PAIR(0xBDC5, 0xC2E0)
+DOUBLE_BYTE_PAIR(0xBDC6, 0xC2E3)
+DOUBLE_BYTE_PAIR(0xBDC7, 0xC2E4)
+DOUBLE_BYTE_PAIR(0xBDC8, 0xC2EB)
+DOUBLE_BYTE_PAIR(0xBDC9, 0xC2EC)
+DOUBLE_BYTE_PAIR(0xBDCA, 0xC2ED)
+DOUBLE_BYTE_PAIR(0xBDCB, 0xC2EF)
+DOUBLE_BYTE_PAIR(0xBDCC, 0xC2F1)
+DOUBLE_BYTE_PAIR(0xBDCD, 0xC2F6)
+DOUBLE_BYTE_PAIR(0xBDCE, 0xC2F8)
+DOUBLE_BYTE_PAIR(0xBDCF, 0xC2F9)
+DOUBLE_BYTE_PAIR(0xBDD0, 0xC2FB)
+DOUBLE_BYTE_PAIR(0xBDD1, 0xC2FC)
+DOUBLE_BYTE_PAIR(0xBDD2, 0xC300)
+DOUBLE_BYTE_PAIR(0xBDD3, 0xC308)
+DOUBLE_BYTE_PAIR(0xBDD4, 0xC309)
+DOUBLE_BYTE_PAIR(0xBDD5, 0xC30C)
+DOUBLE_BYTE_PAIR(0xBDD6, 0xC30D)
+DOUBLE_BYTE_PAIR(0xBDD7, 0xC313)
+DOUBLE_BYTE_PAIR(0xBDD8, 0xC314)
+DOUBLE_BYTE_PAIR(0xBDD9, 0xC315)
+DOUBLE_BYTE_PAIR(0xBDDA, 0xC318)
+DOUBLE_BYTE_PAIR(0xBDDB, 0xC31C)
+DOUBLE_BYTE_PAIR(0xBDDC, 0xC324)
+DOUBLE_BYTE_PAIR(0xBDDD, 0xC325)
+DOUBLE_BYTE_PAIR(0xBDDE, 0xC328)
+DOUBLE_BYTE_PAIR(0xBDDF, 0xC329)
+DOUBLE_BYTE_PAIR(0xBDE0, 0xC345)
+DOUBLE_BYTE_PAIR(0xBDE1, 0xC368)
+DOUBLE_BYTE_PAIR(0xBDE2, 0xC369)
+DOUBLE_BYTE_PAIR(0xBDE3, 0xC36C)
+DOUBLE_BYTE_PAIR(0xBDE4, 0xC370)
+DOUBLE_BYTE_PAIR(0xBDE5, 0xC372)
+DOUBLE_BYTE_PAIR(0xBDE6, 0xC378)
+DOUBLE_BYTE_PAIR(0xBDE7, 0xC379)
+DOUBLE_BYTE_PAIR(0xBDE8, 0xC37C)
+DOUBLE_BYTE_PAIR(0xBDE9, 0xC37D)
+DOUBLE_BYTE_PAIR(0xBDEA, 0xC384)
+DOUBLE_BYTE_PAIR(0xBDEB, 0xC388)
+DOUBLE_BYTE_PAIR(0xBDEC, 0xC38C)
+DOUBLE_BYTE_PAIR(0xBDED, 0xC3C0)
+DOUBLE_BYTE_PAIR(0xBDEE, 0xC3D8)
+DOUBLE_BYTE_PAIR(0xBDEF, 0xC3D9)
+DOUBLE_BYTE_PAIR(0xBDF0, 0xC3DC)
+DOUBLE_BYTE_PAIR(0xBDF1, 0xC3DF)
+DOUBLE_BYTE_PAIR(0xBDF2, 0xC3E0)
+DOUBLE_BYTE_PAIR(0xBDF3, 0xC3E2)
+DOUBLE_BYTE_PAIR(0xBDF4, 0xC3E8)
+DOUBLE_BYTE_PAIR(0xBDF5, 0xC3E9)
+DOUBLE_BYTE_PAIR(0xBDF6, 0xC3ED)
+DOUBLE_BYTE_PAIR(0xBDF7, 0xC3F4)
+DOUBLE_BYTE_PAIR(0xBDF8, 0xC3F5)
+DOUBLE_BYTE_PAIR(0xBDF9, 0xC3F8)
+DOUBLE_BYTE_PAIR(0xBDFA, 0xC408)
+DOUBLE_BYTE_PAIR(0xBDFB, 0xC410)
+DOUBLE_BYTE_PAIR(0xBDFC, 0xC424)
+DOUBLE_BYTE_PAIR(0xBDFD, 0xC42C)
+DOUBLE_BYTE_PAIR(0xBDFE, 0xC430)
+DOUBLE_BYTE_PAIR(0xBE41, 0xD438)
+DOUBLE_BYTE_PAIR(0xBE42, 0xD439)
+DOUBLE_BYTE_PAIR(0xBE43, 0xD43A)
+DOUBLE_BYTE_PAIR(0xBE44, 0xD43B)
+DOUBLE_BYTE_PAIR(0xBE45, 0xD43C)
+DOUBLE_BYTE_PAIR(0xBE46, 0xD43D)
+DOUBLE_BYTE_PAIR(0xBE47, 0xD43E)
+DOUBLE_BYTE_PAIR(0xBE48, 0xD43F)
+DOUBLE_BYTE_PAIR(0xBE49, 0xD441)
+DOUBLE_BYTE_PAIR(0xBE4A, 0xD442)
+DOUBLE_BYTE_PAIR(0xBE4B, 0xD443)
+DOUBLE_BYTE_PAIR(0xBE4C, 0xD445)
+DOUBLE_BYTE_PAIR(0xBE4D, 0xD446)
+DOUBLE_BYTE_PAIR(0xBE4E, 0xD447)
+DOUBLE_BYTE_PAIR(0xBE4F, 0xD448)
+DOUBLE_BYTE_PAIR(0xBE50, 0xD449)
+DOUBLE_BYTE_PAIR(0xBE51, 0xD44A)
+DOUBLE_BYTE_PAIR(0xBE52, 0xD44B)
+DOUBLE_BYTE_PAIR(0xBE53, 0xD44C)
+DOUBLE_BYTE_PAIR(0xBE54, 0xD44D)
+DOUBLE_BYTE_PAIR(0xBE55, 0xD44E)
+DOUBLE_BYTE_PAIR(0xBE56, 0xD44F)
+DOUBLE_BYTE_PAIR(0xBE57, 0xD450)
+DOUBLE_BYTE_PAIR(0xBE58, 0xD451)
+DOUBLE_BYTE_PAIR(0xBE59, 0xD452)
+DOUBLE_BYTE_PAIR(0xBE5A, 0xD453)
+DOUBLE_BYTE_PAIR(0xBE61, 0xD454)
+DOUBLE_BYTE_PAIR(0xBE62, 0xD455)
+DOUBLE_BYTE_PAIR(0xBE63, 0xD456)
+DOUBLE_BYTE_PAIR(0xBE64, 0xD457)
+DOUBLE_BYTE_PAIR(0xBE65, 0xD458)
+DOUBLE_BYTE_PAIR(0xBE66, 0xD459)
+DOUBLE_BYTE_PAIR(0xBE67, 0xD45A)
+DOUBLE_BYTE_PAIR(0xBE68, 0xD45B)
+DOUBLE_BYTE_PAIR(0xBE69, 0xD45D)
+DOUBLE_BYTE_PAIR(0xBE6A, 0xD45E)
+DOUBLE_BYTE_PAIR(0xBE6B, 0xD45F)
+DOUBLE_BYTE_PAIR(0xBE6C, 0xD461)
+DOUBLE_BYTE_PAIR(0xBE6D, 0xD462)
+DOUBLE_BYTE_PAIR(0xBE6E, 0xD463)
+DOUBLE_BYTE_PAIR(0xBE6F, 0xD465)
+DOUBLE_BYTE_PAIR(0xBE70, 0xD466)
+DOUBLE_BYTE_PAIR(0xBE71, 0xD467)
+DOUBLE_BYTE_PAIR(0xBE72, 0xD468)
+DOUBLE_BYTE_PAIR(0xBE73, 0xD469)
+DOUBLE_BYTE_PAIR(0xBE74, 0xD46A)
+DOUBLE_BYTE_PAIR(0xBE75, 0xD46B)
+DOUBLE_BYTE_PAIR(0xBE76, 0xD46C)
+DOUBLE_BYTE_PAIR(0xBE77, 0xD46E)
+DOUBLE_BYTE_PAIR(0xBE78, 0xD470)
+DOUBLE_BYTE_PAIR(0xBE79, 0xD471)
+DOUBLE_BYTE_PAIR(0xBE7A, 0xD472)
+DOUBLE_BYTE_PAIR(0xBE81, 0xD473)
+DOUBLE_BYTE_PAIR(0xBE82, 0xD474)
+DOUBLE_BYTE_PAIR(0xBE83, 0xD475)
+DOUBLE_BYTE_PAIR(0xBE84, 0xD476)
+DOUBLE_BYTE_PAIR(0xBE85, 0xD477)
+DOUBLE_BYTE_PAIR(0xBE86, 0xD47A)
+DOUBLE_BYTE_PAIR(0xBE87, 0xD47B)
+DOUBLE_BYTE_PAIR(0xBE88, 0xD47D)
+DOUBLE_BYTE_PAIR(0xBE89, 0xD47E)
+DOUBLE_BYTE_PAIR(0xBE8A, 0xD481)
+DOUBLE_BYTE_PAIR(0xBE8B, 0xD483)
+DOUBLE_BYTE_PAIR(0xBE8C, 0xD484)
+DOUBLE_BYTE_PAIR(0xBE8D, 0xD485)
+DOUBLE_BYTE_PAIR(0xBE8E, 0xD486)
+DOUBLE_BYTE_PAIR(0xBE8F, 0xD487)
+DOUBLE_BYTE_PAIR(0xBE90, 0xD48A)
+DOUBLE_BYTE_PAIR(0xBE91, 0xD48C)
+DOUBLE_BYTE_PAIR(0xBE92, 0xD48E)
+DOUBLE_BYTE_PAIR(0xBE93, 0xD48F)
+DOUBLE_BYTE_PAIR(0xBE94, 0xD490)
+DOUBLE_BYTE_PAIR(0xBE95, 0xD491)
+DOUBLE_BYTE_PAIR(0xBE96, 0xD492)
+DOUBLE_BYTE_PAIR(0xBE97, 0xD493)
+DOUBLE_BYTE_PAIR(0xBE98, 0xD495)
+DOUBLE_BYTE_PAIR(0xBE99, 0xD496)
+DOUBLE_BYTE_PAIR(0xBE9A, 0xD497)
+DOUBLE_BYTE_PAIR(0xBE9B, 0xD498)
+DOUBLE_BYTE_PAIR(0xBE9C, 0xD499)
+DOUBLE_BYTE_PAIR(0xBE9D, 0xD49A)
+DOUBLE_BYTE_PAIR(0xBE9E, 0xD49B)
+DOUBLE_BYTE_PAIR(0xBE9F, 0xD49C)
+DOUBLE_BYTE_PAIR(0xBEA0, 0xD49D)
+DOUBLE_BYTE_PAIR(0xBEA1, 0xC434)
+DOUBLE_BYTE_PAIR(0xBEA2, 0xC43C)
+DOUBLE_BYTE_PAIR(0xBEA3, 0xC43D)
+DOUBLE_BYTE_PAIR(0xBEA4, 0xC448)
+DOUBLE_BYTE_PAIR(0xBEA5, 0xC464)
+DOUBLE_BYTE_PAIR(0xBEA6, 0xC465)
+DOUBLE_BYTE_PAIR(0xBEA7, 0xC468)
+DOUBLE_BYTE_PAIR(0xBEA8, 0xC46C)
+DOUBLE_BYTE_PAIR(0xBEA9, 0xC474)
+DOUBLE_BYTE_PAIR(0xBEAA, 0xC475)
+DOUBLE_BYTE_PAIR(0xBEAB, 0xC479)
+DOUBLE_BYTE_PAIR(0xBEAC, 0xC480)
+DOUBLE_BYTE_PAIR(0xBEAD, 0xC494)
+DOUBLE_BYTE_PAIR(0xBEAE, 0xC49C)
+DOUBLE_BYTE_PAIR(0xBEAF, 0xC4B8)
+DOUBLE_BYTE_PAIR(0xBEB0, 0xC4BC)
+DOUBLE_BYTE_PAIR(0xBEB1, 0xC4E9)
+DOUBLE_BYTE_PAIR(0xBEB2, 0xC4F0)
+DOUBLE_BYTE_PAIR(0xBEB3, 0xC4F1)
+DOUBLE_BYTE_PAIR(0xBEB4, 0xC4F4)
+DOUBLE_BYTE_PAIR(0xBEB5, 0xC4F8)
+DOUBLE_BYTE_PAIR(0xBEB6, 0xC4FA)
+DOUBLE_BYTE_PAIR(0xBEB7, 0xC4FF)
+DOUBLE_BYTE_PAIR(0xBEB8, 0xC500)
+DOUBLE_BYTE_PAIR(0xBEB9, 0xC501)
+DOUBLE_BYTE_PAIR(0xBEBA, 0xC50C)
+DOUBLE_BYTE_PAIR(0xBEBB, 0xC510)
+DOUBLE_BYTE_PAIR(0xBEBC, 0xC514)
+DOUBLE_BYTE_PAIR(0xBEBD, 0xC51C)
+DOUBLE_BYTE_PAIR(0xBEBE, 0xC528)
+DOUBLE_BYTE_PAIR(0xBEBF, 0xC529)
+DOUBLE_BYTE_PAIR(0xBEC0, 0xC52C)
+DOUBLE_BYTE_PAIR(0xBEC1, 0xC530)
+DOUBLE_BYTE_PAIR(0xBEC2, 0xC538)
+DOUBLE_BYTE_PAIR(0xBEC3, 0xC539)
+DOUBLE_BYTE_PAIR(0xBEC4, 0xC53B)
+DOUBLE_BYTE_PAIR(0xBEC5, 0xC53D)
+DOUBLE_BYTE_PAIR(0xBEC6, 0xC544)
+DOUBLE_BYTE_PAIR(0xBEC7, 0xC545)
+DOUBLE_BYTE_PAIR(0xBEC8, 0xC548)
+DOUBLE_BYTE_PAIR(0xBEC9, 0xC549)
+DOUBLE_BYTE_PAIR(0xBECA, 0xC54A)
+DOUBLE_BYTE_PAIR(0xBECB, 0xC54C)
+DOUBLE_BYTE_PAIR(0xBECC, 0xC54D)
+DOUBLE_BYTE_PAIR(0xBECD, 0xC54E)
+DOUBLE_BYTE_PAIR(0xBECE, 0xC553)
+DOUBLE_BYTE_PAIR(0xBECF, 0xC554)
+DOUBLE_BYTE_PAIR(0xBED0, 0xC555)
+DOUBLE_BYTE_PAIR(0xBED1, 0xC557)
+DOUBLE_BYTE_PAIR(0xBED2, 0xC558)
+DOUBLE_BYTE_PAIR(0xBED3, 0xC559)
+DOUBLE_BYTE_PAIR(0xBED4, 0xC55D)
+DOUBLE_BYTE_PAIR(0xBED5, 0xC55E)
+DOUBLE_BYTE_PAIR(0xBED6, 0xC560)
+DOUBLE_BYTE_PAIR(0xBED7, 0xC561)
+DOUBLE_BYTE_PAIR(0xBED8, 0xC564)
+DOUBLE_BYTE_PAIR(0xBED9, 0xC568)
+DOUBLE_BYTE_PAIR(0xBEDA, 0xC570)
+DOUBLE_BYTE_PAIR(0xBEDB, 0xC571)
+DOUBLE_BYTE_PAIR(0xBEDC, 0xC573)
+DOUBLE_BYTE_PAIR(0xBEDD, 0xC574)
+DOUBLE_BYTE_PAIR(0xBEDE, 0xC575)
+DOUBLE_BYTE_PAIR(0xBEDF, 0xC57C)
+DOUBLE_BYTE_PAIR(0xBEE0, 0xC57D)
+DOUBLE_BYTE_PAIR(0xBEE1, 0xC580)
+DOUBLE_BYTE_PAIR(0xBEE2, 0xC584)
+DOUBLE_BYTE_PAIR(0xBEE3, 0xC587)
+DOUBLE_BYTE_PAIR(0xBEE4, 0xC58C)
+DOUBLE_BYTE_PAIR(0xBEE5, 0xC58D)
+DOUBLE_BYTE_PAIR(0xBEE6, 0xC58F)
+DOUBLE_BYTE_PAIR(0xBEE7, 0xC591)
+DOUBLE_BYTE_PAIR(0xBEE8, 0xC595)
+DOUBLE_BYTE_PAIR(0xBEE9, 0xC597)
+DOUBLE_BYTE_PAIR(0xBEEA, 0xC598)
+DOUBLE_BYTE_PAIR(0xBEEB, 0xC59C)
+DOUBLE_BYTE_PAIR(0xBEEC, 0xC5A0)
+DOUBLE_BYTE_PAIR(0xBEED, 0xC5A9)
+DOUBLE_BYTE_PAIR(0xBEEE, 0xC5B4)
+DOUBLE_BYTE_PAIR(0xBEEF, 0xC5B5)
+DOUBLE_BYTE_PAIR(0xBEF0, 0xC5B8)
+DOUBLE_BYTE_PAIR(0xBEF1, 0xC5B9)
+DOUBLE_BYTE_PAIR(0xBEF2, 0xC5BB)
+DOUBLE_BYTE_PAIR(0xBEF3, 0xC5BC)
+DOUBLE_BYTE_PAIR(0xBEF4, 0xC5BD)
+DOUBLE_BYTE_PAIR(0xBEF5, 0xC5BE)
+DOUBLE_BYTE_PAIR(0xBEF6, 0xC5C4)
+DOUBLE_BYTE_PAIR(0xBEF7, 0xC5C5)
+DOUBLE_BYTE_PAIR(0xBEF8, 0xC5C6)
+DOUBLE_BYTE_PAIR(0xBEF9, 0xC5C7)
+DOUBLE_BYTE_PAIR(0xBEFA, 0xC5C8)
+DOUBLE_BYTE_PAIR(0xBEFB, 0xC5C9)
+DOUBLE_BYTE_PAIR(0xBEFC, 0xC5CA)
+DOUBLE_BYTE_PAIR(0xBEFD, 0xC5CC)
+DOUBLE_BYTE_PAIR(0xBEFE, 0xC5CE)
+DOUBLE_BYTE_PAIR(0xBF41, 0xD49E)
+DOUBLE_BYTE_PAIR(0xBF42, 0xD49F)
+DOUBLE_BYTE_PAIR(0xBF43, 0xD4A0)
+DOUBLE_BYTE_PAIR(0xBF44, 0xD4A1)
+DOUBLE_BYTE_PAIR(0xBF45, 0xD4A2)
+DOUBLE_BYTE_PAIR(0xBF46, 0xD4A3)
+DOUBLE_BYTE_PAIR(0xBF47, 0xD4A4)
+DOUBLE_BYTE_PAIR(0xBF48, 0xD4A5)
+DOUBLE_BYTE_PAIR(0xBF49, 0xD4A6)
+DOUBLE_BYTE_PAIR(0xBF4A, 0xD4A7)
+DOUBLE_BYTE_PAIR(0xBF4B, 0xD4A8)
+DOUBLE_BYTE_PAIR(0xBF4C, 0xD4AA)
+DOUBLE_BYTE_PAIR(0xBF4D, 0xD4AB)
+DOUBLE_BYTE_PAIR(0xBF4E, 0xD4AC)
+DOUBLE_BYTE_PAIR(0xBF4F, 0xD4AD)
+DOUBLE_BYTE_PAIR(0xBF50, 0xD4AE)
+DOUBLE_BYTE_PAIR(0xBF51, 0xD4AF)
+DOUBLE_BYTE_PAIR(0xBF52, 0xD4B0)
+DOUBLE_BYTE_PAIR(0xBF53, 0xD4B1)
+DOUBLE_BYTE_PAIR(0xBF54, 0xD4B2)
+DOUBLE_BYTE_PAIR(0xBF55, 0xD4B3)
+DOUBLE_BYTE_PAIR(0xBF56, 0xD4B4)
+DOUBLE_BYTE_PAIR(0xBF57, 0xD4B5)
+DOUBLE_BYTE_PAIR(0xBF58, 0xD4B6)
+DOUBLE_BYTE_PAIR(0xBF59, 0xD4B7)
+DOUBLE_BYTE_PAIR(0xBF5A, 0xD4B8)
+DOUBLE_BYTE_PAIR(0xBF61, 0xD4B9)
+DOUBLE_BYTE_PAIR(0xBF62, 0xD4BA)
+DOUBLE_BYTE_PAIR(0xBF63, 0xD4BB)
+DOUBLE_BYTE_PAIR(0xBF64, 0xD4BC)
+DOUBLE_BYTE_PAIR(0xBF65, 0xD4BD)
+DOUBLE_BYTE_PAIR(0xBF66, 0xD4BE)
+DOUBLE_BYTE_PAIR(0xBF67, 0xD4BF)
+DOUBLE_BYTE_PAIR(0xBF68, 0xD4C0)
+DOUBLE_BYTE_PAIR(0xBF69, 0xD4C1)
+DOUBLE_BYTE_PAIR(0xBF6A, 0xD4C2)
+DOUBLE_BYTE_PAIR(0xBF6B, 0xD4C3)
+DOUBLE_BYTE_PAIR(0xBF6C, 0xD4C4)
+DOUBLE_BYTE_PAIR(0xBF6D, 0xD4C5)
+DOUBLE_BYTE_PAIR(0xBF6E, 0xD4C6)
+DOUBLE_BYTE_PAIR(0xBF6F, 0xD4C7)
+DOUBLE_BYTE_PAIR(0xBF70, 0xD4C8)
+DOUBLE_BYTE_PAIR(0xBF71, 0xD4C9)
+DOUBLE_BYTE_PAIR(0xBF72, 0xD4CA)
+DOUBLE_BYTE_PAIR(0xBF73, 0xD4CB)
+DOUBLE_BYTE_PAIR(0xBF74, 0xD4CD)
+DOUBLE_BYTE_PAIR(0xBF75, 0xD4CE)
+DOUBLE_BYTE_PAIR(0xBF76, 0xD4CF)
+DOUBLE_BYTE_PAIR(0xBF77, 0xD4D1)
+DOUBLE_BYTE_PAIR(0xBF78, 0xD4D2)
+DOUBLE_BYTE_PAIR(0xBF79, 0xD4D3)
+DOUBLE_BYTE_PAIR(0xBF7A, 0xD4D5)
+DOUBLE_BYTE_PAIR(0xBF81, 0xD4D6)
+DOUBLE_BYTE_PAIR(0xBF82, 0xD4D7)
+DOUBLE_BYTE_PAIR(0xBF83, 0xD4D8)
+DOUBLE_BYTE_PAIR(0xBF84, 0xD4D9)
+DOUBLE_BYTE_PAIR(0xBF85, 0xD4DA)
+DOUBLE_BYTE_PAIR(0xBF86, 0xD4DB)
+DOUBLE_BYTE_PAIR(0xBF87, 0xD4DD)
+DOUBLE_BYTE_PAIR(0xBF88, 0xD4DE)
+DOUBLE_BYTE_PAIR(0xBF89, 0xD4E0)
+DOUBLE_BYTE_PAIR(0xBF8A, 0xD4E1)
+DOUBLE_BYTE_PAIR(0xBF8B, 0xD4E2)
+DOUBLE_BYTE_PAIR(0xBF8C, 0xD4E3)
+DOUBLE_BYTE_PAIR(0xBF8D, 0xD4E4)
+DOUBLE_BYTE_PAIR(0xBF8E, 0xD4E5)
+DOUBLE_BYTE_PAIR(0xBF8F, 0xD4E6)
+DOUBLE_BYTE_PAIR(0xBF90, 0xD4E7)
+DOUBLE_BYTE_PAIR(0xBF91, 0xD4E9)
+DOUBLE_BYTE_PAIR(0xBF92, 0xD4EA)
+DOUBLE_BYTE_PAIR(0xBF93, 0xD4EB)
+DOUBLE_BYTE_PAIR(0xBF94, 0xD4ED)
+DOUBLE_BYTE_PAIR(0xBF95, 0xD4EE)
+DOUBLE_BYTE_PAIR(0xBF96, 0xD4EF)
+DOUBLE_BYTE_PAIR(0xBF97, 0xD4F1)
+DOUBLE_BYTE_PAIR(0xBF98, 0xD4F2)
+DOUBLE_BYTE_PAIR(0xBF99, 0xD4F3)
+DOUBLE_BYTE_PAIR(0xBF9A, 0xD4F4)
+DOUBLE_BYTE_PAIR(0xBF9B, 0xD4F5)
+DOUBLE_BYTE_PAIR(0xBF9C, 0xD4F6)
+DOUBLE_BYTE_PAIR(0xBF9D, 0xD4F7)
+DOUBLE_BYTE_PAIR(0xBF9E, 0xD4F9)
+DOUBLE_BYTE_PAIR(0xBF9F, 0xD4FA)
+DOUBLE_BYTE_PAIR(0xBFA0, 0xD4FC)
+DOUBLE_BYTE_PAIR(0xBFA1, 0xC5D0)
+DOUBLE_BYTE_PAIR(0xBFA2, 0xC5D1)
+DOUBLE_BYTE_PAIR(0xBFA3, 0xC5D4)
+DOUBLE_BYTE_PAIR(0xBFA4, 0xC5D8)
+DOUBLE_BYTE_PAIR(0xBFA5, 0xC5E0)
+DOUBLE_BYTE_PAIR(0xBFA6, 0xC5E1)
+DOUBLE_BYTE_PAIR(0xBFA7, 0xC5E3)
+DOUBLE_BYTE_PAIR(0xBFA8, 0xC5E5)
+DOUBLE_BYTE_PAIR(0xBFA9, 0xC5EC)
+DOUBLE_BYTE_PAIR(0xBFAA, 0xC5ED)
+DOUBLE_BYTE_PAIR(0xBFAB, 0xC5EE)
+DOUBLE_BYTE_PAIR(0xBFAC, 0xC5F0)
+DOUBLE_BYTE_PAIR(0xBFAD, 0xC5F4)
+DOUBLE_BYTE_PAIR(0xBFAE, 0xC5F6)
+DOUBLE_BYTE_PAIR(0xBFAF, 0xC5F7)
+DOUBLE_BYTE_PAIR(0xBFB0, 0xC5FC)
+DOUBLE_BYTE_PAIR(0xBFB1, 0xC5FD)
+DOUBLE_BYTE_PAIR(0xBFB2, 0xC5FE)
+DOUBLE_BYTE_PAIR(0xBFB3, 0xC5FF)
+DOUBLE_BYTE_PAIR(0xBFB4, 0xC600)
+DOUBLE_BYTE_PAIR(0xBFB5, 0xC601)
+DOUBLE_BYTE_PAIR(0xBFB6, 0xC605)
+DOUBLE_BYTE_PAIR(0xBFB7, 0xC606)
+DOUBLE_BYTE_PAIR(0xBFB8, 0xC607)
+DOUBLE_BYTE_PAIR(0xBFB9, 0xC608)
+DOUBLE_BYTE_PAIR(0xBFBA, 0xC60C)
+DOUBLE_BYTE_PAIR(0xBFBB, 0xC610)
+DOUBLE_BYTE_PAIR(0xBFBC, 0xC618)
+DOUBLE_BYTE_PAIR(0xBFBD, 0xC619)
+DOUBLE_BYTE_PAIR(0xBFBE, 0xC61B)
+DOUBLE_BYTE_PAIR(0xBFBF, 0xC61C)
+DOUBLE_BYTE_PAIR(0xBFC0, 0xC624)
+DOUBLE_BYTE_PAIR(0xBFC1, 0xC625)
+DOUBLE_BYTE_PAIR(0xBFC2, 0xC628)
+DOUBLE_BYTE_PAIR(0xBFC3, 0xC62C)
+DOUBLE_BYTE_PAIR(0xBFC4, 0xC62D)
+DOUBLE_BYTE_PAIR(0xBFC5, 0xC62E)
+DOUBLE_BYTE_PAIR(0xBFC6, 0xC630)
+DOUBLE_BYTE_PAIR(0xBFC7, 0xC633)
+DOUBLE_BYTE_PAIR(0xBFC8, 0xC634)
+DOUBLE_BYTE_PAIR(0xBFC9, 0xC635)
+DOUBLE_BYTE_PAIR(0xBFCA, 0xC637)
+DOUBLE_BYTE_PAIR(0xBFCB, 0xC639)
+DOUBLE_BYTE_PAIR(0xBFCC, 0xC63B)
+DOUBLE_BYTE_PAIR(0xBFCD, 0xC640)
+DOUBLE_BYTE_PAIR(0xBFCE, 0xC641)
+DOUBLE_BYTE_PAIR(0xBFCF, 0xC644)
+DOUBLE_BYTE_PAIR(0xBFD0, 0xC648)
+DOUBLE_BYTE_PAIR(0xBFD1, 0xC650)
+DOUBLE_BYTE_PAIR(0xBFD2, 0xC651)
+DOUBLE_BYTE_PAIR(0xBFD3, 0xC653)
+DOUBLE_BYTE_PAIR(0xBFD4, 0xC654)
+DOUBLE_BYTE_PAIR(0xBFD5, 0xC655)
+DOUBLE_BYTE_PAIR(0xBFD6, 0xC65C)
+DOUBLE_BYTE_PAIR(0xBFD7, 0xC65D)
+DOUBLE_BYTE_PAIR(0xBFD8, 0xC660)
+DOUBLE_BYTE_PAIR(0xBFD9, 0xC66C)
+DOUBLE_BYTE_PAIR(0xBFDA, 0xC66F)
+DOUBLE_BYTE_PAIR(0xBFDB, 0xC671)
+DOUBLE_BYTE_PAIR(0xBFDC, 0xC678)
+DOUBLE_BYTE_PAIR(0xBFDD, 0xC679)
+DOUBLE_BYTE_PAIR(0xBFDE, 0xC67C)
+DOUBLE_BYTE_PAIR(0xBFDF, 0xC680)
+DOUBLE_BYTE_PAIR(0xBFE0, 0xC688)
+DOUBLE_BYTE_PAIR(0xBFE1, 0xC689)
+DOUBLE_BYTE_PAIR(0xBFE2, 0xC68B)
+DOUBLE_BYTE_PAIR(0xBFE3, 0xC68D)
+DOUBLE_BYTE_PAIR(0xBFE4, 0xC694)
+DOUBLE_BYTE_PAIR(0xBFE5, 0xC695)
+DOUBLE_BYTE_PAIR(0xBFE6, 0xC698)
+DOUBLE_BYTE_PAIR(0xBFE7, 0xC69C)
+DOUBLE_BYTE_PAIR(0xBFE8, 0xC6A4)
+DOUBLE_BYTE_PAIR(0xBFE9, 0xC6A5)
+DOUBLE_BYTE_PAIR(0xBFEA, 0xC6A7)
+DOUBLE_BYTE_PAIR(0xBFEB, 0xC6A9)
+DOUBLE_BYTE_PAIR(0xBFEC, 0xC6B0)
+DOUBLE_BYTE_PAIR(0xBFED, 0xC6B1)
+DOUBLE_BYTE_PAIR(0xBFEE, 0xC6B4)
+DOUBLE_BYTE_PAIR(0xBFEF, 0xC6B8)
+DOUBLE_BYTE_PAIR(0xBFF0, 0xC6B9)
+DOUBLE_BYTE_PAIR(0xBFF1, 0xC6BA)
+DOUBLE_BYTE_PAIR(0xBFF2, 0xC6C0)
+DOUBLE_BYTE_PAIR(0xBFF3, 0xC6C1)
+DOUBLE_BYTE_PAIR(0xBFF4, 0xC6C3)
+DOUBLE_BYTE_PAIR(0xBFF5, 0xC6C5)
+DOUBLE_BYTE_PAIR(0xBFF6, 0xC6CC)
+DOUBLE_BYTE_PAIR(0xBFF7, 0xC6CD)
+DOUBLE_BYTE_PAIR(0xBFF8, 0xC6D0)
+DOUBLE_BYTE_PAIR(0xBFF9, 0xC6D4)
+DOUBLE_BYTE_PAIR(0xBFFA, 0xC6DC)
+DOUBLE_BYTE_PAIR(0xBFFB, 0xC6DD)
+DOUBLE_BYTE_PAIR(0xBFFC, 0xC6E0)
+DOUBLE_BYTE_PAIR(0xBFFD, 0xC6E1)
+DOUBLE_BYTE_PAIR(0xBFFE, 0xC6E8)
+DOUBLE_BYTE_PAIR(0xC041, 0xD4FE)
+DOUBLE_BYTE_PAIR(0xC042, 0xD4FF)
+DOUBLE_BYTE_PAIR(0xC043, 0xD500)
+DOUBLE_BYTE_PAIR(0xC044, 0xD501)
+DOUBLE_BYTE_PAIR(0xC045, 0xD502)
+DOUBLE_BYTE_PAIR(0xC046, 0xD503)
+DOUBLE_BYTE_PAIR(0xC047, 0xD505)
+DOUBLE_BYTE_PAIR(0xC048, 0xD506)
+DOUBLE_BYTE_PAIR(0xC049, 0xD507)
+DOUBLE_BYTE_PAIR(0xC04A, 0xD509)
+DOUBLE_BYTE_PAIR(0xC04B, 0xD50A)
+DOUBLE_BYTE_PAIR(0xC04C, 0xD50B)
+DOUBLE_BYTE_PAIR(0xC04D, 0xD50D)
+DOUBLE_BYTE_PAIR(0xC04E, 0xD50E)
+DOUBLE_BYTE_PAIR(0xC04F, 0xD50F)
+DOUBLE_BYTE_PAIR(0xC050, 0xD510)
+DOUBLE_BYTE_PAIR(0xC051, 0xD511)
+DOUBLE_BYTE_PAIR(0xC052, 0xD512)
+DOUBLE_BYTE_PAIR(0xC053, 0xD513)
+DOUBLE_BYTE_PAIR(0xC054, 0xD516)
+DOUBLE_BYTE_PAIR(0xC055, 0xD518)
+DOUBLE_BYTE_PAIR(0xC056, 0xD519)
+DOUBLE_BYTE_PAIR(0xC057, 0xD51A)
+DOUBLE_BYTE_PAIR(0xC058, 0xD51B)
+DOUBLE_BYTE_PAIR(0xC059, 0xD51C)
+DOUBLE_BYTE_PAIR(0xC05A, 0xD51D)
+DOUBLE_BYTE_PAIR(0xC061, 0xD51E)
+DOUBLE_BYTE_PAIR(0xC062, 0xD51F)
+DOUBLE_BYTE_PAIR(0xC063, 0xD520)
+DOUBLE_BYTE_PAIR(0xC064, 0xD521)
+DOUBLE_BYTE_PAIR(0xC065, 0xD522)
+DOUBLE_BYTE_PAIR(0xC066, 0xD523)
+DOUBLE_BYTE_PAIR(0xC067, 0xD524)
+DOUBLE_BYTE_PAIR(0xC068, 0xD525)
+DOUBLE_BYTE_PAIR(0xC069, 0xD526)
+DOUBLE_BYTE_PAIR(0xC06A, 0xD527)
+DOUBLE_BYTE_PAIR(0xC06B, 0xD528)
+DOUBLE_BYTE_PAIR(0xC06C, 0xD529)
+DOUBLE_BYTE_PAIR(0xC06D, 0xD52A)
+DOUBLE_BYTE_PAIR(0xC06E, 0xD52B)
+DOUBLE_BYTE_PAIR(0xC06F, 0xD52C)
+DOUBLE_BYTE_PAIR(0xC070, 0xD52D)
+DOUBLE_BYTE_PAIR(0xC071, 0xD52E)
+DOUBLE_BYTE_PAIR(0xC072, 0xD52F)
+DOUBLE_BYTE_PAIR(0xC073, 0xD530)
+DOUBLE_BYTE_PAIR(0xC074, 0xD531)
+DOUBLE_BYTE_PAIR(0xC075, 0xD532)
+DOUBLE_BYTE_PAIR(0xC076, 0xD533)
+DOUBLE_BYTE_PAIR(0xC077, 0xD534)
+DOUBLE_BYTE_PAIR(0xC078, 0xD535)
+DOUBLE_BYTE_PAIR(0xC079, 0xD536)
+DOUBLE_BYTE_PAIR(0xC07A, 0xD537)
+DOUBLE_BYTE_PAIR(0xC081, 0xD538)
+DOUBLE_BYTE_PAIR(0xC082, 0xD539)
+DOUBLE_BYTE_PAIR(0xC083, 0xD53A)
+DOUBLE_BYTE_PAIR(0xC084, 0xD53B)
+DOUBLE_BYTE_PAIR(0xC085, 0xD53E)
+DOUBLE_BYTE_PAIR(0xC086, 0xD53F)
+DOUBLE_BYTE_PAIR(0xC087, 0xD541)
+DOUBLE_BYTE_PAIR(0xC088, 0xD542)
+DOUBLE_BYTE_PAIR(0xC089, 0xD543)
+DOUBLE_BYTE_PAIR(0xC08A, 0xD545)
+DOUBLE_BYTE_PAIR(0xC08B, 0xD546)
+DOUBLE_BYTE_PAIR(0xC08C, 0xD547)
+DOUBLE_BYTE_PAIR(0xC08D, 0xD548)
+DOUBLE_BYTE_PAIR(0xC08E, 0xD549)
+DOUBLE_BYTE_PAIR(0xC08F, 0xD54A)
+DOUBLE_BYTE_PAIR(0xC090, 0xD54B)
+DOUBLE_BYTE_PAIR(0xC091, 0xD54E)
+DOUBLE_BYTE_PAIR(0xC092, 0xD550)
+DOUBLE_BYTE_PAIR(0xC093, 0xD552)
+DOUBLE_BYTE_PAIR(0xC094, 0xD553)
+DOUBLE_BYTE_PAIR(0xC095, 0xD554)
+DOUBLE_BYTE_PAIR(0xC096, 0xD555)
+DOUBLE_BYTE_PAIR(0xC097, 0xD556)
+DOUBLE_BYTE_PAIR(0xC098, 0xD557)
+DOUBLE_BYTE_PAIR(0xC099, 0xD55A)
+DOUBLE_BYTE_PAIR(0xC09A, 0xD55B)
+DOUBLE_BYTE_PAIR(0xC09B, 0xD55D)
+DOUBLE_BYTE_PAIR(0xC09C, 0xD55E)
+DOUBLE_BYTE_PAIR(0xC09D, 0xD55F)
+DOUBLE_BYTE_PAIR(0xC09E, 0xD561)
+DOUBLE_BYTE_PAIR(0xC09F, 0xD562)
+DOUBLE_BYTE_PAIR(0xC0A0, 0xD563)
+DOUBLE_BYTE_PAIR(0xC0A1, 0xC6E9)
+DOUBLE_BYTE_PAIR(0xC0A2, 0xC6EC)
+DOUBLE_BYTE_PAIR(0xC0A3, 0xC6F0)
+DOUBLE_BYTE_PAIR(0xC0A4, 0xC6F8)
+DOUBLE_BYTE_PAIR(0xC0A5, 0xC6F9)
+DOUBLE_BYTE_PAIR(0xC0A6, 0xC6FD)
+DOUBLE_BYTE_PAIR(0xC0A7, 0xC704)
+DOUBLE_BYTE_PAIR(0xC0A8, 0xC705)
+DOUBLE_BYTE_PAIR(0xC0A9, 0xC708)
+DOUBLE_BYTE_PAIR(0xC0AA, 0xC70C)
+DOUBLE_BYTE_PAIR(0xC0AB, 0xC714)
+DOUBLE_BYTE_PAIR(0xC0AC, 0xC715)
+DOUBLE_BYTE_PAIR(0xC0AD, 0xC717)
+DOUBLE_BYTE_PAIR(0xC0AE, 0xC719)
+DOUBLE_BYTE_PAIR(0xC0AF, 0xC720)
+DOUBLE_BYTE_PAIR(0xC0B0, 0xC721)
+DOUBLE_BYTE_PAIR(0xC0B1, 0xC724)
+DOUBLE_BYTE_PAIR(0xC0B2, 0xC728)
+DOUBLE_BYTE_PAIR(0xC0B3, 0xC730)
+DOUBLE_BYTE_PAIR(0xC0B4, 0xC731)
+DOUBLE_BYTE_PAIR(0xC0B5, 0xC733)
+DOUBLE_BYTE_PAIR(0xC0B6, 0xC735)
+DOUBLE_BYTE_PAIR(0xC0B7, 0xC737)
+DOUBLE_BYTE_PAIR(0xC0B8, 0xC73C)
+DOUBLE_BYTE_PAIR(0xC0B9, 0xC73D)
+DOUBLE_BYTE_PAIR(0xC0BA, 0xC740)
+DOUBLE_BYTE_PAIR(0xC0BB, 0xC744)
+DOUBLE_BYTE_PAIR(0xC0BC, 0xC74A)
+DOUBLE_BYTE_PAIR(0xC0BD, 0xC74C)
+DOUBLE_BYTE_PAIR(0xC0BE, 0xC74D)
+DOUBLE_BYTE_PAIR(0xC0BF, 0xC74F)
+DOUBLE_BYTE_PAIR(0xC0C0, 0xC751)
+DOUBLE_BYTE_PAIR(0xC0C1, 0xC752)
+DOUBLE_BYTE_PAIR(0xC0C2, 0xC753)
+DOUBLE_BYTE_PAIR(0xC0C3, 0xC754)
+DOUBLE_BYTE_PAIR(0xC0C4, 0xC755)
+DOUBLE_BYTE_PAIR(0xC0C5, 0xC756)
+DOUBLE_BYTE_PAIR(0xC0C6, 0xC757)
+DOUBLE_BYTE_PAIR(0xC0C7, 0xC758)
+DOUBLE_BYTE_PAIR(0xC0C8, 0xC75C)
+DOUBLE_BYTE_PAIR(0xC0C9, 0xC760)
+DOUBLE_BYTE_PAIR(0xC0CA, 0xC768)
+DOUBLE_BYTE_PAIR(0xC0CB, 0xC76B)
+DOUBLE_BYTE_PAIR(0xC0CC, 0xC774)
+DOUBLE_BYTE_PAIR(0xC0CD, 0xC775)
+DOUBLE_BYTE_PAIR(0xC0CE, 0xC778)
+DOUBLE_BYTE_PAIR(0xC0CF, 0xC77C)
+DOUBLE_BYTE_PAIR(0xC0D0, 0xC77D)
+DOUBLE_BYTE_PAIR(0xC0D1, 0xC77E)
+DOUBLE_BYTE_PAIR(0xC0D2, 0xC783)
+DOUBLE_BYTE_PAIR(0xC0D3, 0xC784)
+DOUBLE_BYTE_PAIR(0xC0D4, 0xC785)
+DOUBLE_BYTE_PAIR(0xC0D5, 0xC787)
+DOUBLE_BYTE_PAIR(0xC0D6, 0xC788)
+DOUBLE_BYTE_PAIR(0xC0D7, 0xC789)
+DOUBLE_BYTE_PAIR(0xC0D8, 0xC78A)
+DOUBLE_BYTE_PAIR(0xC0D9, 0xC78E)
+DOUBLE_BYTE_PAIR(0xC0DA, 0xC790)
+DOUBLE_BYTE_PAIR(0xC0DB, 0xC791)
+DOUBLE_BYTE_PAIR(0xC0DC, 0xC794)
+DOUBLE_BYTE_PAIR(0xC0DD, 0xC796)
+DOUBLE_BYTE_PAIR(0xC0DE, 0xC797)
+DOUBLE_BYTE_PAIR(0xC0DF, 0xC798)
+DOUBLE_BYTE_PAIR(0xC0E0, 0xC79A)
+DOUBLE_BYTE_PAIR(0xC0E1, 0xC7A0)
+DOUBLE_BYTE_PAIR(0xC0E2, 0xC7A1)
+DOUBLE_BYTE_PAIR(0xC0E3, 0xC7A3)
+DOUBLE_BYTE_PAIR(0xC0E4, 0xC7A4)
+DOUBLE_BYTE_PAIR(0xC0E5, 0xC7A5)
+DOUBLE_BYTE_PAIR(0xC0E6, 0xC7A6)
+DOUBLE_BYTE_PAIR(0xC0E7, 0xC7AC)
+DOUBLE_BYTE_PAIR(0xC0E8, 0xC7AD)
+DOUBLE_BYTE_PAIR(0xC0E9, 0xC7B0)
+DOUBLE_BYTE_PAIR(0xC0EA, 0xC7B4)
+DOUBLE_BYTE_PAIR(0xC0EB, 0xC7BC)
+DOUBLE_BYTE_PAIR(0xC0EC, 0xC7BD)
+DOUBLE_BYTE_PAIR(0xC0ED, 0xC7BF)
+DOUBLE_BYTE_PAIR(0xC0EE, 0xC7C0)
+DOUBLE_BYTE_PAIR(0xC0EF, 0xC7C1)
+DOUBLE_BYTE_PAIR(0xC0F0, 0xC7C8)
+DOUBLE_BYTE_PAIR(0xC0F1, 0xC7C9)
+DOUBLE_BYTE_PAIR(0xC0F2, 0xC7CC)
+DOUBLE_BYTE_PAIR(0xC0F3, 0xC7CE)
+DOUBLE_BYTE_PAIR(0xC0F4, 0xC7D0)
+DOUBLE_BYTE_PAIR(0xC0F5, 0xC7D8)
+DOUBLE_BYTE_PAIR(0xC0F6, 0xC7DD)
+DOUBLE_BYTE_PAIR(0xC0F7, 0xC7E4)
+DOUBLE_BYTE_PAIR(0xC0F8, 0xC7E8)
+DOUBLE_BYTE_PAIR(0xC0F9, 0xC7EC)
+DOUBLE_BYTE_PAIR(0xC0FA, 0xC800)
+DOUBLE_BYTE_PAIR(0xC0FB, 0xC801)
+DOUBLE_BYTE_PAIR(0xC0FC, 0xC804)
+DOUBLE_BYTE_PAIR(0xC0FD, 0xC808)
+DOUBLE_BYTE_PAIR(0xC0FE, 0xC80A)
+DOUBLE_BYTE_PAIR(0xC141, 0xD564)
+DOUBLE_BYTE_PAIR(0xC142, 0xD566)
+DOUBLE_BYTE_PAIR(0xC143, 0xD567)
+DOUBLE_BYTE_PAIR(0xC144, 0xD56A)
+DOUBLE_BYTE_PAIR(0xC145, 0xD56C)
+DOUBLE_BYTE_PAIR(0xC146, 0xD56E)
+DOUBLE_BYTE_PAIR(0xC147, 0xD56F)
+DOUBLE_BYTE_PAIR(0xC148, 0xD570)
+DOUBLE_BYTE_PAIR(0xC149, 0xD571)
+DOUBLE_BYTE_PAIR(0xC14A, 0xD572)
+DOUBLE_BYTE_PAIR(0xC14B, 0xD573)
+DOUBLE_BYTE_PAIR(0xC14C, 0xD576)
+DOUBLE_BYTE_PAIR(0xC14D, 0xD577)
+DOUBLE_BYTE_PAIR(0xC14E, 0xD579)
+DOUBLE_BYTE_PAIR(0xC14F, 0xD57A)
+DOUBLE_BYTE_PAIR(0xC150, 0xD57B)
+DOUBLE_BYTE_PAIR(0xC151, 0xD57D)
+DOUBLE_BYTE_PAIR(0xC152, 0xD57E)
+DOUBLE_BYTE_PAIR(0xC153, 0xD57F)
+DOUBLE_BYTE_PAIR(0xC154, 0xD580)
+DOUBLE_BYTE_PAIR(0xC155, 0xD581)
+DOUBLE_BYTE_PAIR(0xC156, 0xD582)
+DOUBLE_BYTE_PAIR(0xC157, 0xD583)
+DOUBLE_BYTE_PAIR(0xC158, 0xD586)
+DOUBLE_BYTE_PAIR(0xC159, 0xD58A)
+DOUBLE_BYTE_PAIR(0xC15A, 0xD58B)
+DOUBLE_BYTE_PAIR(0xC161, 0xD58C)
+DOUBLE_BYTE_PAIR(0xC162, 0xD58D)
+DOUBLE_BYTE_PAIR(0xC163, 0xD58E)
+DOUBLE_BYTE_PAIR(0xC164, 0xD58F)
+DOUBLE_BYTE_PAIR(0xC165, 0xD591)
+DOUBLE_BYTE_PAIR(0xC166, 0xD592)
+DOUBLE_BYTE_PAIR(0xC167, 0xD593)
+DOUBLE_BYTE_PAIR(0xC168, 0xD594)
+DOUBLE_BYTE_PAIR(0xC169, 0xD595)
+DOUBLE_BYTE_PAIR(0xC16A, 0xD596)
+DOUBLE_BYTE_PAIR(0xC16B, 0xD597)
+DOUBLE_BYTE_PAIR(0xC16C, 0xD598)
+DOUBLE_BYTE_PAIR(0xC16D, 0xD599)
+DOUBLE_BYTE_PAIR(0xC16E, 0xD59A)
+DOUBLE_BYTE_PAIR(0xC16F, 0xD59B)
+DOUBLE_BYTE_PAIR(0xC170, 0xD59C)
+DOUBLE_BYTE_PAIR(0xC171, 0xD59D)
+DOUBLE_BYTE_PAIR(0xC172, 0xD59E)
+DOUBLE_BYTE_PAIR(0xC173, 0xD59F)
+DOUBLE_BYTE_PAIR(0xC174, 0xD5A0)
+DOUBLE_BYTE_PAIR(0xC175, 0xD5A1)
+DOUBLE_BYTE_PAIR(0xC176, 0xD5A2)
+DOUBLE_BYTE_PAIR(0xC177, 0xD5A3)
+DOUBLE_BYTE_PAIR(0xC178, 0xD5A4)
+DOUBLE_BYTE_PAIR(0xC179, 0xD5A6)
+DOUBLE_BYTE_PAIR(0xC17A, 0xD5A7)
+DOUBLE_BYTE_PAIR(0xC181, 0xD5A8)
+DOUBLE_BYTE_PAIR(0xC182, 0xD5A9)
+DOUBLE_BYTE_PAIR(0xC183, 0xD5AA)
+DOUBLE_BYTE_PAIR(0xC184, 0xD5AB)
+DOUBLE_BYTE_PAIR(0xC185, 0xD5AC)
+DOUBLE_BYTE_PAIR(0xC186, 0xD5AD)
+DOUBLE_BYTE_PAIR(0xC187, 0xD5AE)
+DOUBLE_BYTE_PAIR(0xC188, 0xD5AF)
+DOUBLE_BYTE_PAIR(0xC189, 0xD5B0)
+DOUBLE_BYTE_PAIR(0xC18A, 0xD5B1)
+DOUBLE_BYTE_PAIR(0xC18B, 0xD5B2)
+DOUBLE_BYTE_PAIR(0xC18C, 0xD5B3)
+DOUBLE_BYTE_PAIR(0xC18D, 0xD5B4)
+DOUBLE_BYTE_PAIR(0xC18E, 0xD5B5)
+DOUBLE_BYTE_PAIR(0xC18F, 0xD5B6)
+DOUBLE_BYTE_PAIR(0xC190, 0xD5B7)
+DOUBLE_BYTE_PAIR(0xC191, 0xD5B8)
+DOUBLE_BYTE_PAIR(0xC192, 0xD5B9)
+DOUBLE_BYTE_PAIR(0xC193, 0xD5BA)
+DOUBLE_BYTE_PAIR(0xC194, 0xD5BB)
+DOUBLE_BYTE_PAIR(0xC195, 0xD5BC)
+DOUBLE_BYTE_PAIR(0xC196, 0xD5BD)
+DOUBLE_BYTE_PAIR(0xC197, 0xD5BE)
+DOUBLE_BYTE_PAIR(0xC198, 0xD5BF)
+DOUBLE_BYTE_PAIR(0xC199, 0xD5C0)
+DOUBLE_BYTE_PAIR(0xC19A, 0xD5C1)
+DOUBLE_BYTE_PAIR(0xC19B, 0xD5C2)
+DOUBLE_BYTE_PAIR(0xC19C, 0xD5C3)
+DOUBLE_BYTE_PAIR(0xC19D, 0xD5C4)
+DOUBLE_BYTE_PAIR(0xC19E, 0xD5C5)
+DOUBLE_BYTE_PAIR(0xC19F, 0xD5C6)
+DOUBLE_BYTE_PAIR(0xC1A0, 0xD5C7)
+DOUBLE_BYTE_PAIR(0xC1A1, 0xC810)
+DOUBLE_BYTE_PAIR(0xC1A2, 0xC811)
+DOUBLE_BYTE_PAIR(0xC1A3, 0xC813)
+DOUBLE_BYTE_PAIR(0xC1A4, 0xC815)
+DOUBLE_BYTE_PAIR(0xC1A5, 0xC816)
+DOUBLE_BYTE_PAIR(0xC1A6, 0xC81C)
+DOUBLE_BYTE_PAIR(0xC1A7, 0xC81D)
+DOUBLE_BYTE_PAIR(0xC1A8, 0xC820)
+DOUBLE_BYTE_PAIR(0xC1A9, 0xC824)
+DOUBLE_BYTE_PAIR(0xC1AA, 0xC82C)
+DOUBLE_BYTE_PAIR(0xC1AB, 0xC82D)
+DOUBLE_BYTE_PAIR(0xC1AC, 0xC82F)
+DOUBLE_BYTE_PAIR(0xC1AD, 0xC831)
+DOUBLE_BYTE_PAIR(0xC1AE, 0xC838)
+DOUBLE_BYTE_PAIR(0xC1AF, 0xC83C)
+DOUBLE_BYTE_PAIR(0xC1B0, 0xC840)
+DOUBLE_BYTE_PAIR(0xC1B1, 0xC848)
+DOUBLE_BYTE_PAIR(0xC1B2, 0xC849)
+DOUBLE_BYTE_PAIR(0xC1B3, 0xC84C)
+DOUBLE_BYTE_PAIR(0xC1B4, 0xC84D)
+DOUBLE_BYTE_PAIR(0xC1B5, 0xC854)
+DOUBLE_BYTE_PAIR(0xC1B6, 0xC870)
+DOUBLE_BYTE_PAIR(0xC1B7, 0xC871)
+DOUBLE_BYTE_PAIR(0xC1B8, 0xC874)
+DOUBLE_BYTE_PAIR(0xC1B9, 0xC878)
+DOUBLE_BYTE_PAIR(0xC1BA, 0xC87A)
+DOUBLE_BYTE_PAIR(0xC1BB, 0xC880)
+DOUBLE_BYTE_PAIR(0xC1BC, 0xC881)
+DOUBLE_BYTE_PAIR(0xC1BD, 0xC883)
+DOUBLE_BYTE_PAIR(0xC1BE, 0xC885)
+DOUBLE_BYTE_PAIR(0xC1BF, 0xC886)
+DOUBLE_BYTE_PAIR(0xC1C0, 0xC887)
+DOUBLE_BYTE_PAIR(0xC1C1, 0xC88B)
+DOUBLE_BYTE_PAIR(0xC1C2, 0xC88C)
+DOUBLE_BYTE_PAIR(0xC1C3, 0xC88D)
+DOUBLE_BYTE_PAIR(0xC1C4, 0xC894)
+DOUBLE_BYTE_PAIR(0xC1C5, 0xC89D)
+DOUBLE_BYTE_PAIR(0xC1C6, 0xC89F)
+DOUBLE_BYTE_PAIR(0xC1C7, 0xC8A1)
+DOUBLE_BYTE_PAIR(0xC1C8, 0xC8A8)
+DOUBLE_BYTE_PAIR(0xC1C9, 0xC8BC)
+DOUBLE_BYTE_PAIR(0xC1CA, 0xC8BD)
+DOUBLE_BYTE_PAIR(0xC1CB, 0xC8C4)
+DOUBLE_BYTE_PAIR(0xC1CC, 0xC8C8)
+DOUBLE_BYTE_PAIR(0xC1CD, 0xC8CC)
+DOUBLE_BYTE_PAIR(0xC1CE, 0xC8D4)
+DOUBLE_BYTE_PAIR(0xC1CF, 0xC8D5)
+DOUBLE_BYTE_PAIR(0xC1D0, 0xC8D7)
+DOUBLE_BYTE_PAIR(0xC1D1, 0xC8D9)
+DOUBLE_BYTE_PAIR(0xC1D2, 0xC8E0)
+DOUBLE_BYTE_PAIR(0xC1D3, 0xC8E1)
+DOUBLE_BYTE_PAIR(0xC1D4, 0xC8E4)
+DOUBLE_BYTE_PAIR(0xC1D5, 0xC8F5)
+DOUBLE_BYTE_PAIR(0xC1D6, 0xC8FC)
+DOUBLE_BYTE_PAIR(0xC1D7, 0xC8FD)
+DOUBLE_BYTE_PAIR(0xC1D8, 0xC900)
+DOUBLE_BYTE_PAIR(0xC1D9, 0xC904)
+DOUBLE_BYTE_PAIR(0xC1DA, 0xC905)
+DOUBLE_BYTE_PAIR(0xC1DB, 0xC906)
+DOUBLE_BYTE_PAIR(0xC1DC, 0xC90C)
+DOUBLE_BYTE_PAIR(0xC1DD, 0xC90D)
+DOUBLE_BYTE_PAIR(0xC1DE, 0xC90F)
+DOUBLE_BYTE_PAIR(0xC1DF, 0xC911)
+DOUBLE_BYTE_PAIR(0xC1E0, 0xC918)
+DOUBLE_BYTE_PAIR(0xC1E1, 0xC92C)
+DOUBLE_BYTE_PAIR(0xC1E2, 0xC934)
+DOUBLE_BYTE_PAIR(0xC1E3, 0xC950)
+DOUBLE_BYTE_PAIR(0xC1E4, 0xC951)
+DOUBLE_BYTE_PAIR(0xC1E5, 0xC954)
+DOUBLE_BYTE_PAIR(0xC1E6, 0xC958)
+DOUBLE_BYTE_PAIR(0xC1E7, 0xC960)
+DOUBLE_BYTE_PAIR(0xC1E8, 0xC961)
+DOUBLE_BYTE_PAIR(0xC1E9, 0xC963)
+DOUBLE_BYTE_PAIR(0xC1EA, 0xC96C)
+DOUBLE_BYTE_PAIR(0xC1EB, 0xC970)
+DOUBLE_BYTE_PAIR(0xC1EC, 0xC974)
+DOUBLE_BYTE_PAIR(0xC1ED, 0xC97C)
+DOUBLE_BYTE_PAIR(0xC1EE, 0xC988)
+DOUBLE_BYTE_PAIR(0xC1EF, 0xC989)
+DOUBLE_BYTE_PAIR(0xC1F0, 0xC98C)
+DOUBLE_BYTE_PAIR(0xC1F1, 0xC990)
+DOUBLE_BYTE_PAIR(0xC1F2, 0xC998)
+DOUBLE_BYTE_PAIR(0xC1F3, 0xC999)
+DOUBLE_BYTE_PAIR(0xC1F4, 0xC99B)
+DOUBLE_BYTE_PAIR(0xC1F5, 0xC99D)
+DOUBLE_BYTE_PAIR(0xC1F6, 0xC9C0)
+DOUBLE_BYTE_PAIR(0xC1F7, 0xC9C1)
+DOUBLE_BYTE_PAIR(0xC1F8, 0xC9C4)
+DOUBLE_BYTE_PAIR(0xC1F9, 0xC9C7)
+DOUBLE_BYTE_PAIR(0xC1FA, 0xC9C8)
+DOUBLE_BYTE_PAIR(0xC1FB, 0xC9CA)
+DOUBLE_BYTE_PAIR(0xC1FC, 0xC9D0)
+DOUBLE_BYTE_PAIR(0xC1FD, 0xC9D1)
+DOUBLE_BYTE_PAIR(0xC1FE, 0xC9D3)
+DOUBLE_BYTE_PAIR(0xC241, 0xD5CA)
+DOUBLE_BYTE_PAIR(0xC242, 0xD5CB)
+DOUBLE_BYTE_PAIR(0xC243, 0xD5CD)
+DOUBLE_BYTE_PAIR(0xC244, 0xD5CE)
+DOUBLE_BYTE_PAIR(0xC245, 0xD5CF)
+DOUBLE_BYTE_PAIR(0xC246, 0xD5D1)
+DOUBLE_BYTE_PAIR(0xC247, 0xD5D3)
+DOUBLE_BYTE_PAIR(0xC248, 0xD5D4)
+DOUBLE_BYTE_PAIR(0xC249, 0xD5D5)
+DOUBLE_BYTE_PAIR(0xC24A, 0xD5D6)
+DOUBLE_BYTE_PAIR(0xC24B, 0xD5D7)
+DOUBLE_BYTE_PAIR(0xC24C, 0xD5DA)
+DOUBLE_BYTE_PAIR(0xC24D, 0xD5DC)
+DOUBLE_BYTE_PAIR(0xC24E, 0xD5DE)
+DOUBLE_BYTE_PAIR(0xC24F, 0xD5DF)
+DOUBLE_BYTE_PAIR(0xC250, 0xD5E0)
+DOUBLE_BYTE_PAIR(0xC251, 0xD5E1)
+DOUBLE_BYTE_PAIR(0xC252, 0xD5E2)
+DOUBLE_BYTE_PAIR(0xC253, 0xD5E3)
+DOUBLE_BYTE_PAIR(0xC254, 0xD5E6)
+DOUBLE_BYTE_PAIR(0xC255, 0xD5E7)
+DOUBLE_BYTE_PAIR(0xC256, 0xD5E9)
+DOUBLE_BYTE_PAIR(0xC257, 0xD5EA)
+DOUBLE_BYTE_PAIR(0xC258, 0xD5EB)
+DOUBLE_BYTE_PAIR(0xC259, 0xD5ED)
+DOUBLE_BYTE_PAIR(0xC25A, 0xD5EE)
+DOUBLE_BYTE_PAIR(0xC261, 0xD5EF)
+DOUBLE_BYTE_PAIR(0xC262, 0xD5F0)
+DOUBLE_BYTE_PAIR(0xC263, 0xD5F1)
+DOUBLE_BYTE_PAIR(0xC264, 0xD5F2)
+DOUBLE_BYTE_PAIR(0xC265, 0xD5F3)
+DOUBLE_BYTE_PAIR(0xC266, 0xD5F6)
+DOUBLE_BYTE_PAIR(0xC267, 0xD5F8)
+DOUBLE_BYTE_PAIR(0xC268, 0xD5FA)
+DOUBLE_BYTE_PAIR(0xC269, 0xD5FB)
+DOUBLE_BYTE_PAIR(0xC26A, 0xD5FC)
+DOUBLE_BYTE_PAIR(0xC26B, 0xD5FD)
+DOUBLE_BYTE_PAIR(0xC26C, 0xD5FE)
+DOUBLE_BYTE_PAIR(0xC26D, 0xD5FF)
+DOUBLE_BYTE_PAIR(0xC26E, 0xD602)
+DOUBLE_BYTE_PAIR(0xC26F, 0xD603)
+DOUBLE_BYTE_PAIR(0xC270, 0xD605)
+DOUBLE_BYTE_PAIR(0xC271, 0xD606)
+DOUBLE_BYTE_PAIR(0xC272, 0xD607)
+DOUBLE_BYTE_PAIR(0xC273, 0xD609)
+DOUBLE_BYTE_PAIR(0xC274, 0xD60A)
+DOUBLE_BYTE_PAIR(0xC275, 0xD60B)
+DOUBLE_BYTE_PAIR(0xC276, 0xD60C)
+DOUBLE_BYTE_PAIR(0xC277, 0xD60D)
+DOUBLE_BYTE_PAIR(0xC278, 0xD60E)
+DOUBLE_BYTE_PAIR(0xC279, 0xD60F)
+DOUBLE_BYTE_PAIR(0xC27A, 0xD612)
+DOUBLE_BYTE_PAIR(0xC281, 0xD616)
+DOUBLE_BYTE_PAIR(0xC282, 0xD617)
+DOUBLE_BYTE_PAIR(0xC283, 0xD618)
+DOUBLE_BYTE_PAIR(0xC284, 0xD619)
+DOUBLE_BYTE_PAIR(0xC285, 0xD61A)
+DOUBLE_BYTE_PAIR(0xC286, 0xD61B)
+DOUBLE_BYTE_PAIR(0xC287, 0xD61D)
+DOUBLE_BYTE_PAIR(0xC288, 0xD61E)
+DOUBLE_BYTE_PAIR(0xC289, 0xD61F)
+DOUBLE_BYTE_PAIR(0xC28A, 0xD621)
+DOUBLE_BYTE_PAIR(0xC28B, 0xD622)
+DOUBLE_BYTE_PAIR(0xC28C, 0xD623)
+DOUBLE_BYTE_PAIR(0xC28D, 0xD625)
+DOUBLE_BYTE_PAIR(0xC28E, 0xD626)
+DOUBLE_BYTE_PAIR(0xC28F, 0xD627)
+DOUBLE_BYTE_PAIR(0xC290, 0xD628)
+DOUBLE_BYTE_PAIR(0xC291, 0xD629)
+DOUBLE_BYTE_PAIR(0xC292, 0xD62A)
+DOUBLE_BYTE_PAIR(0xC293, 0xD62B)
+DOUBLE_BYTE_PAIR(0xC294, 0xD62C)
+DOUBLE_BYTE_PAIR(0xC295, 0xD62E)
+DOUBLE_BYTE_PAIR(0xC296, 0xD62F)
+DOUBLE_BYTE_PAIR(0xC297, 0xD630)
+DOUBLE_BYTE_PAIR(0xC298, 0xD631)
+DOUBLE_BYTE_PAIR(0xC299, 0xD632)
+DOUBLE_BYTE_PAIR(0xC29A, 0xD633)
+DOUBLE_BYTE_PAIR(0xC29B, 0xD634)
+DOUBLE_BYTE_PAIR(0xC29C, 0xD635)
+DOUBLE_BYTE_PAIR(0xC29D, 0xD636)
+DOUBLE_BYTE_PAIR(0xC29E, 0xD637)
+DOUBLE_BYTE_PAIR(0xC29F, 0xD63A)
+DOUBLE_BYTE_PAIR(0xC2A0, 0xD63B)
+DOUBLE_BYTE_PAIR(0xC2A1, 0xC9D5)
+DOUBLE_BYTE_PAIR(0xC2A2, 0xC9D6)
+DOUBLE_BYTE_PAIR(0xC2A3, 0xC9D9)
+DOUBLE_BYTE_PAIR(0xC2A4, 0xC9DA)
+DOUBLE_BYTE_PAIR(0xC2A5, 0xC9DC)
+DOUBLE_BYTE_PAIR(0xC2A6, 0xC9DD)
+DOUBLE_BYTE_PAIR(0xC2A7, 0xC9E0)
+DOUBLE_BYTE_PAIR(0xC2A8, 0xC9E2)
+DOUBLE_BYTE_PAIR(0xC2A9, 0xC9E4)
+DOUBLE_BYTE_PAIR(0xC2AA, 0xC9E7)
+DOUBLE_BYTE_PAIR(0xC2AB, 0xC9EC)
+DOUBLE_BYTE_PAIR(0xC2AC, 0xC9ED)
+DOUBLE_BYTE_PAIR(0xC2AD, 0xC9EF)
+DOUBLE_BYTE_PAIR(0xC2AE, 0xC9F0)
+DOUBLE_BYTE_PAIR(0xC2AF, 0xC9F1)
+DOUBLE_BYTE_PAIR(0xC2B0, 0xC9F8)
+DOUBLE_BYTE_PAIR(0xC2B1, 0xC9F9)
+DOUBLE_BYTE_PAIR(0xC2B2, 0xC9FC)
+DOUBLE_BYTE_PAIR(0xC2B3, 0xCA00)
+DOUBLE_BYTE_PAIR(0xC2B4, 0xCA08)
+DOUBLE_BYTE_PAIR(0xC2B5, 0xCA09)
+DOUBLE_BYTE_PAIR(0xC2B6, 0xCA0B)
+DOUBLE_BYTE_PAIR(0xC2B7, 0xCA0C)
+DOUBLE_BYTE_PAIR(0xC2B8, 0xCA0D)
+DOUBLE_BYTE_PAIR(0xC2B9, 0xCA14)
+DOUBLE_BYTE_PAIR(0xC2BA, 0xCA18)
+DOUBLE_BYTE_PAIR(0xC2BB, 0xCA29)
+DOUBLE_BYTE_PAIR(0xC2BC, 0xCA4C)
+DOUBLE_BYTE_PAIR(0xC2BD, 0xCA4D)
+DOUBLE_BYTE_PAIR(0xC2BE, 0xCA50)
+DOUBLE_BYTE_PAIR(0xC2BF, 0xCA54)
+DOUBLE_BYTE_PAIR(0xC2C0, 0xCA5C)
+DOUBLE_BYTE_PAIR(0xC2C1, 0xCA5D)
+DOUBLE_BYTE_PAIR(0xC2C2, 0xCA5F)
+DOUBLE_BYTE_PAIR(0xC2C3, 0xCA60)
+DOUBLE_BYTE_PAIR(0xC2C4, 0xCA61)
+DOUBLE_BYTE_PAIR(0xC2C5, 0xCA68)
+DOUBLE_BYTE_PAIR(0xC2C6, 0xCA7D)
+DOUBLE_BYTE_PAIR(0xC2C7, 0xCA84)
+DOUBLE_BYTE_PAIR(0xC2C8, 0xCA98)
+DOUBLE_BYTE_PAIR(0xC2C9, 0xCABC)
+DOUBLE_BYTE_PAIR(0xC2CA, 0xCABD)
+DOUBLE_BYTE_PAIR(0xC2CB, 0xCAC0)
+DOUBLE_BYTE_PAIR(0xC2CC, 0xCAC4)
+DOUBLE_BYTE_PAIR(0xC2CD, 0xCACC)
+DOUBLE_BYTE_PAIR(0xC2CE, 0xCACD)
+DOUBLE_BYTE_PAIR(0xC2CF, 0xCACF)
+DOUBLE_BYTE_PAIR(0xC2D0, 0xCAD1)
+DOUBLE_BYTE_PAIR(0xC2D1, 0xCAD3)
+DOUBLE_BYTE_PAIR(0xC2D2, 0xCAD8)
+DOUBLE_BYTE_PAIR(0xC2D3, 0xCAD9)
+DOUBLE_BYTE_PAIR(0xC2D4, 0xCAE0)
+DOUBLE_BYTE_PAIR(0xC2D5, 0xCAEC)
+DOUBLE_BYTE_PAIR(0xC2D6, 0xCAF4)
+DOUBLE_BYTE_PAIR(0xC2D7, 0xCB08)
+DOUBLE_BYTE_PAIR(0xC2D8, 0xCB10)
+DOUBLE_BYTE_PAIR(0xC2D9, 0xCB14)
+DOUBLE_BYTE_PAIR(0xC2DA, 0xCB18)
+DOUBLE_BYTE_PAIR(0xC2DB, 0xCB20)
+DOUBLE_BYTE_PAIR(0xC2DC, 0xCB21)
+DOUBLE_BYTE_PAIR(0xC2DD, 0xCB41)
+DOUBLE_BYTE_PAIR(0xC2DE, 0xCB48)
+DOUBLE_BYTE_PAIR(0xC2DF, 0xCB49)
+DOUBLE_BYTE_PAIR(0xC2E0, 0xCB4C)
+DOUBLE_BYTE_PAIR(0xC2E1, 0xCB50)
+DOUBLE_BYTE_PAIR(0xC2E2, 0xCB58)
+DOUBLE_BYTE_PAIR(0xC2E3, 0xCB59)
+DOUBLE_BYTE_PAIR(0xC2E4, 0xCB5D)
+DOUBLE_BYTE_PAIR(0xC2E5, 0xCB64)
+DOUBLE_BYTE_PAIR(0xC2E6, 0xCB78)
+DOUBLE_BYTE_PAIR(0xC2E7, 0xCB79)
+DOUBLE_BYTE_PAIR(0xC2E8, 0xCB9C)
+DOUBLE_BYTE_PAIR(0xC2E9, 0xCBB8)
+DOUBLE_BYTE_PAIR(0xC2EA, 0xCBD4)
+DOUBLE_BYTE_PAIR(0xC2EB, 0xCBE4)
+DOUBLE_BYTE_PAIR(0xC2EC, 0xCBE7)
+DOUBLE_BYTE_PAIR(0xC2ED, 0xCBE9)
+DOUBLE_BYTE_PAIR(0xC2EE, 0xCC0C)
+DOUBLE_BYTE_PAIR(0xC2EF, 0xCC0D)
+DOUBLE_BYTE_PAIR(0xC2F0, 0xCC10)
+DOUBLE_BYTE_PAIR(0xC2F1, 0xCC14)
+DOUBLE_BYTE_PAIR(0xC2F2, 0xCC1C)
+DOUBLE_BYTE_PAIR(0xC2F3, 0xCC1D)
+DOUBLE_BYTE_PAIR(0xC2F4, 0xCC21)
+DOUBLE_BYTE_PAIR(0xC2F5, 0xCC22)
+DOUBLE_BYTE_PAIR(0xC2F6, 0xCC27)
+DOUBLE_BYTE_PAIR(0xC2F7, 0xCC28)
+DOUBLE_BYTE_PAIR(0xC2F8, 0xCC29)
+DOUBLE_BYTE_PAIR(0xC2F9, 0xCC2C)
+DOUBLE_BYTE_PAIR(0xC2FA, 0xCC2E)
+DOUBLE_BYTE_PAIR(0xC2FB, 0xCC30)
+DOUBLE_BYTE_PAIR(0xC2FC, 0xCC38)
+DOUBLE_BYTE_PAIR(0xC2FD, 0xCC39)
+DOUBLE_BYTE_PAIR(0xC2FE, 0xCC3B)
+DOUBLE_BYTE_PAIR(0xC341, 0xD63D)
+DOUBLE_BYTE_PAIR(0xC342, 0xD63E)
+DOUBLE_BYTE_PAIR(0xC343, 0xD63F)
+DOUBLE_BYTE_PAIR(0xC344, 0xD641)
+DOUBLE_BYTE_PAIR(0xC345, 0xD642)
+DOUBLE_BYTE_PAIR(0xC346, 0xD643)
+DOUBLE_BYTE_PAIR(0xC347, 0xD644)
+DOUBLE_BYTE_PAIR(0xC348, 0xD646)
+DOUBLE_BYTE_PAIR(0xC349, 0xD647)
+DOUBLE_BYTE_PAIR(0xC34A, 0xD64A)
+DOUBLE_BYTE_PAIR(0xC34B, 0xD64C)
+DOUBLE_BYTE_PAIR(0xC34C, 0xD64E)
+DOUBLE_BYTE_PAIR(0xC34D, 0xD64F)
+DOUBLE_BYTE_PAIR(0xC34E, 0xD650)
+DOUBLE_BYTE_PAIR(0xC34F, 0xD652)
+DOUBLE_BYTE_PAIR(0xC350, 0xD653)
+DOUBLE_BYTE_PAIR(0xC351, 0xD656)
+DOUBLE_BYTE_PAIR(0xC352, 0xD657)
+DOUBLE_BYTE_PAIR(0xC353, 0xD659)
+DOUBLE_BYTE_PAIR(0xC354, 0xD65A)
+DOUBLE_BYTE_PAIR(0xC355, 0xD65B)
+DOUBLE_BYTE_PAIR(0xC356, 0xD65D)
+DOUBLE_BYTE_PAIR(0xC357, 0xD65E)
+DOUBLE_BYTE_PAIR(0xC358, 0xD65F)
+DOUBLE_BYTE_PAIR(0xC359, 0xD660)
+DOUBLE_BYTE_PAIR(0xC35A, 0xD661)
+DOUBLE_BYTE_PAIR(0xC361, 0xD662)
+DOUBLE_BYTE_PAIR(0xC362, 0xD663)
+DOUBLE_BYTE_PAIR(0xC363, 0xD664)
+DOUBLE_BYTE_PAIR(0xC364, 0xD665)
+DOUBLE_BYTE_PAIR(0xC365, 0xD666)
+DOUBLE_BYTE_PAIR(0xC366, 0xD668)
+DOUBLE_BYTE_PAIR(0xC367, 0xD66A)
+DOUBLE_BYTE_PAIR(0xC368, 0xD66B)
+DOUBLE_BYTE_PAIR(0xC369, 0xD66C)
+DOUBLE_BYTE_PAIR(0xC36A, 0xD66D)
+DOUBLE_BYTE_PAIR(0xC36B, 0xD66E)
+DOUBLE_BYTE_PAIR(0xC36C, 0xD66F)
+DOUBLE_BYTE_PAIR(0xC36D, 0xD672)
+DOUBLE_BYTE_PAIR(0xC36E, 0xD673)
+DOUBLE_BYTE_PAIR(0xC36F, 0xD675)
+DOUBLE_BYTE_PAIR(0xC370, 0xD676)
+DOUBLE_BYTE_PAIR(0xC371, 0xD677)
+DOUBLE_BYTE_PAIR(0xC372, 0xD678)
+DOUBLE_BYTE_PAIR(0xC373, 0xD679)
+DOUBLE_BYTE_PAIR(0xC374, 0xD67A)
+DOUBLE_BYTE_PAIR(0xC375, 0xD67B)
+DOUBLE_BYTE_PAIR(0xC376, 0xD67C)
+DOUBLE_BYTE_PAIR(0xC377, 0xD67D)
+DOUBLE_BYTE_PAIR(0xC378, 0xD67E)
+DOUBLE_BYTE_PAIR(0xC379, 0xD67F)
+DOUBLE_BYTE_PAIR(0xC37A, 0xD680)
+DOUBLE_BYTE_PAIR(0xC381, 0xD681)
+DOUBLE_BYTE_PAIR(0xC382, 0xD682)
+DOUBLE_BYTE_PAIR(0xC383, 0xD684)
+DOUBLE_BYTE_PAIR(0xC384, 0xD686)
+DOUBLE_BYTE_PAIR(0xC385, 0xD687)
+DOUBLE_BYTE_PAIR(0xC386, 0xD688)
+DOUBLE_BYTE_PAIR(0xC387, 0xD689)
+DOUBLE_BYTE_PAIR(0xC388, 0xD68A)
+DOUBLE_BYTE_PAIR(0xC389, 0xD68B)
+DOUBLE_BYTE_PAIR(0xC38A, 0xD68E)
+DOUBLE_BYTE_PAIR(0xC38B, 0xD68F)
+DOUBLE_BYTE_PAIR(0xC38C, 0xD691)
+DOUBLE_BYTE_PAIR(0xC38D, 0xD692)
+DOUBLE_BYTE_PAIR(0xC38E, 0xD693)
+DOUBLE_BYTE_PAIR(0xC38F, 0xD695)
+DOUBLE_BYTE_PAIR(0xC390, 0xD696)
+DOUBLE_BYTE_PAIR(0xC391, 0xD697)
+DOUBLE_BYTE_PAIR(0xC392, 0xD698)
+DOUBLE_BYTE_PAIR(0xC393, 0xD699)
+DOUBLE_BYTE_PAIR(0xC394, 0xD69A)
+DOUBLE_BYTE_PAIR(0xC395, 0xD69B)
+DOUBLE_BYTE_PAIR(0xC396, 0xD69C)
+DOUBLE_BYTE_PAIR(0xC397, 0xD69E)
+DOUBLE_BYTE_PAIR(0xC398, 0xD6A0)
+DOUBLE_BYTE_PAIR(0xC399, 0xD6A2)
+DOUBLE_BYTE_PAIR(0xC39A, 0xD6A3)
+DOUBLE_BYTE_PAIR(0xC39B, 0xD6A4)
+DOUBLE_BYTE_PAIR(0xC39C, 0xD6A5)
+DOUBLE_BYTE_PAIR(0xC39D, 0xD6A6)
+DOUBLE_BYTE_PAIR(0xC39E, 0xD6A7)
+DOUBLE_BYTE_PAIR(0xC39F, 0xD6A9)
+DOUBLE_BYTE_PAIR(0xC3A0, 0xD6AA)
+DOUBLE_BYTE_PAIR(0xC3A1, 0xCC3C)
+DOUBLE_BYTE_PAIR(0xC3A2, 0xCC3D)
+DOUBLE_BYTE_PAIR(0xC3A3, 0xCC3E)
+DOUBLE_BYTE_PAIR(0xC3A4, 0xCC44)
+DOUBLE_BYTE_PAIR(0xC3A5, 0xCC45)
+DOUBLE_BYTE_PAIR(0xC3A6, 0xCC48)
+DOUBLE_BYTE_PAIR(0xC3A7, 0xCC4C)
+DOUBLE_BYTE_PAIR(0xC3A8, 0xCC54)
+DOUBLE_BYTE_PAIR(0xC3A9, 0xCC55)
+DOUBLE_BYTE_PAIR(0xC3AA, 0xCC57)
+DOUBLE_BYTE_PAIR(0xC3AB, 0xCC58)
+DOUBLE_BYTE_PAIR(0xC3AC, 0xCC59)
+DOUBLE_BYTE_PAIR(0xC3AD, 0xCC60)
+DOUBLE_BYTE_PAIR(0xC3AE, 0xCC64)
+DOUBLE_BYTE_PAIR(0xC3AF, 0xCC66)
+DOUBLE_BYTE_PAIR(0xC3B0, 0xCC68)
+DOUBLE_BYTE_PAIR(0xC3B1, 0xCC70)
+DOUBLE_BYTE_PAIR(0xC3B2, 0xCC75)
+DOUBLE_BYTE_PAIR(0xC3B3, 0xCC98)
+DOUBLE_BYTE_PAIR(0xC3B4, 0xCC99)
+DOUBLE_BYTE_PAIR(0xC3B5, 0xCC9C)
+DOUBLE_BYTE_PAIR(0xC3B6, 0xCCA0)
+DOUBLE_BYTE_PAIR(0xC3B7, 0xCCA8)
+DOUBLE_BYTE_PAIR(0xC3B8, 0xCCA9)
+DOUBLE_BYTE_PAIR(0xC3B9, 0xCCAB)
+DOUBLE_BYTE_PAIR(0xC3BA, 0xCCAC)
+DOUBLE_BYTE_PAIR(0xC3BB, 0xCCAD)
+DOUBLE_BYTE_PAIR(0xC3BC, 0xCCB4)
+DOUBLE_BYTE_PAIR(0xC3BD, 0xCCB5)
+DOUBLE_BYTE_PAIR(0xC3BE, 0xCCB8)
+DOUBLE_BYTE_PAIR(0xC3BF, 0xCCBC)
+DOUBLE_BYTE_PAIR(0xC3C0, 0xCCC4)
+DOUBLE_BYTE_PAIR(0xC3C1, 0xCCC5)
+DOUBLE_BYTE_PAIR(0xC3C2, 0xCCC7)
+DOUBLE_BYTE_PAIR(0xC3C3, 0xCCC9)
+DOUBLE_BYTE_PAIR(0xC3C4, 0xCCD0)
+DOUBLE_BYTE_PAIR(0xC3C5, 0xCCD4)
+DOUBLE_BYTE_PAIR(0xC3C6, 0xCCE4)
+DOUBLE_BYTE_PAIR(0xC3C7, 0xCCEC)
+DOUBLE_BYTE_PAIR(0xC3C8, 0xCCF0)
+DOUBLE_BYTE_PAIR(0xC3C9, 0xCD01)
+DOUBLE_BYTE_PAIR(0xC3CA, 0xCD08)
+DOUBLE_BYTE_PAIR(0xC3CB, 0xCD09)
+DOUBLE_BYTE_PAIR(0xC3CC, 0xCD0C)
+DOUBLE_BYTE_PAIR(0xC3CD, 0xCD10)
+DOUBLE_BYTE_PAIR(0xC3CE, 0xCD18)
+DOUBLE_BYTE_PAIR(0xC3CF, 0xCD19)
+DOUBLE_BYTE_PAIR(0xC3D0, 0xCD1B)
+DOUBLE_BYTE_PAIR(0xC3D1, 0xCD1D)
+DOUBLE_BYTE_PAIR(0xC3D2, 0xCD24)
+DOUBLE_BYTE_PAIR(0xC3D3, 0xCD28)
+DOUBLE_BYTE_PAIR(0xC3D4, 0xCD2C)
+DOUBLE_BYTE_PAIR(0xC3D5, 0xCD39)
+DOUBLE_BYTE_PAIR(0xC3D6, 0xCD5C)
+DOUBLE_BYTE_PAIR(0xC3D7, 0xCD60)
+DOUBLE_BYTE_PAIR(0xC3D8, 0xCD64)
+DOUBLE_BYTE_PAIR(0xC3D9, 0xCD6C)
+DOUBLE_BYTE_PAIR(0xC3DA, 0xCD6D)
+DOUBLE_BYTE_PAIR(0xC3DB, 0xCD6F)
+DOUBLE_BYTE_PAIR(0xC3DC, 0xCD71)
+DOUBLE_BYTE_PAIR(0xC3DD, 0xCD78)
+DOUBLE_BYTE_PAIR(0xC3DE, 0xCD88)
+DOUBLE_BYTE_PAIR(0xC3DF, 0xCD94)
+DOUBLE_BYTE_PAIR(0xC3E0, 0xCD95)
+DOUBLE_BYTE_PAIR(0xC3E1, 0xCD98)
+DOUBLE_BYTE_PAIR(0xC3E2, 0xCD9C)
+DOUBLE_BYTE_PAIR(0xC3E3, 0xCDA4)
+DOUBLE_BYTE_PAIR(0xC3E4, 0xCDA5)
+DOUBLE_BYTE_PAIR(0xC3E5, 0xCDA7)
+DOUBLE_BYTE_PAIR(0xC3E6, 0xCDA9)
+DOUBLE_BYTE_PAIR(0xC3E7, 0xCDB0)
+DOUBLE_BYTE_PAIR(0xC3E8, 0xCDC4)
+DOUBLE_BYTE_PAIR(0xC3E9, 0xCDCC)
+DOUBLE_BYTE_PAIR(0xC3EA, 0xCDD0)
+DOUBLE_BYTE_PAIR(0xC3EB, 0xCDE8)
+DOUBLE_BYTE_PAIR(0xC3EC, 0xCDEC)
+DOUBLE_BYTE_PAIR(0xC3ED, 0xCDF0)
+DOUBLE_BYTE_PAIR(0xC3EE, 0xCDF8)
+DOUBLE_BYTE_PAIR(0xC3EF, 0xCDF9)
+DOUBLE_BYTE_PAIR(0xC3F0, 0xCDFB)
+DOUBLE_BYTE_PAIR(0xC3F1, 0xCDFD)
+DOUBLE_BYTE_PAIR(0xC3F2, 0xCE04)
+DOUBLE_BYTE_PAIR(0xC3F3, 0xCE08)
+DOUBLE_BYTE_PAIR(0xC3F4, 0xCE0C)
+DOUBLE_BYTE_PAIR(0xC3F5, 0xCE14)
+DOUBLE_BYTE_PAIR(0xC3F6, 0xCE19)
+DOUBLE_BYTE_PAIR(0xC3F7, 0xCE20)
+DOUBLE_BYTE_PAIR(0xC3F8, 0xCE21)
+DOUBLE_BYTE_PAIR(0xC3F9, 0xCE24)
+DOUBLE_BYTE_PAIR(0xC3FA, 0xCE28)
+DOUBLE_BYTE_PAIR(0xC3FB, 0xCE30)
+DOUBLE_BYTE_PAIR(0xC3FC, 0xCE31)
+DOUBLE_BYTE_PAIR(0xC3FD, 0xCE33)
+DOUBLE_BYTE_PAIR(0xC3FE, 0xCE35)
+DOUBLE_BYTE_PAIR(0xC441, 0xD6AB)
+DOUBLE_BYTE_PAIR(0xC442, 0xD6AD)
+DOUBLE_BYTE_PAIR(0xC443, 0xD6AE)
+DOUBLE_BYTE_PAIR(0xC444, 0xD6AF)
+DOUBLE_BYTE_PAIR(0xC445, 0xD6B1)
+DOUBLE_BYTE_PAIR(0xC446, 0xD6B2)
+DOUBLE_BYTE_PAIR(0xC447, 0xD6B3)
+DOUBLE_BYTE_PAIR(0xC448, 0xD6B4)
+DOUBLE_BYTE_PAIR(0xC449, 0xD6B5)
+DOUBLE_BYTE_PAIR(0xC44A, 0xD6B6)
+DOUBLE_BYTE_PAIR(0xC44B, 0xD6B7)
+DOUBLE_BYTE_PAIR(0xC44C, 0xD6B8)
+DOUBLE_BYTE_PAIR(0xC44D, 0xD6BA)
+DOUBLE_BYTE_PAIR(0xC44E, 0xD6BC)
+DOUBLE_BYTE_PAIR(0xC44F, 0xD6BD)
+DOUBLE_BYTE_PAIR(0xC450, 0xD6BE)
+DOUBLE_BYTE_PAIR(0xC451, 0xD6BF)
+DOUBLE_BYTE_PAIR(0xC452, 0xD6C0)
+DOUBLE_BYTE_PAIR(0xC453, 0xD6C1)
+DOUBLE_BYTE_PAIR(0xC454, 0xD6C2)
+DOUBLE_BYTE_PAIR(0xC455, 0xD6C3)
+DOUBLE_BYTE_PAIR(0xC456, 0xD6C6)
+DOUBLE_BYTE_PAIR(0xC457, 0xD6C7)
+DOUBLE_BYTE_PAIR(0xC458, 0xD6C9)
+DOUBLE_BYTE_PAIR(0xC459, 0xD6CA)
+DOUBLE_BYTE_PAIR(0xC45A, 0xD6CB)
+DOUBLE_BYTE_PAIR(0xC461, 0xD6CD)
+DOUBLE_BYTE_PAIR(0xC462, 0xD6CE)
+DOUBLE_BYTE_PAIR(0xC463, 0xD6CF)
+DOUBLE_BYTE_PAIR(0xC464, 0xD6D0)
+DOUBLE_BYTE_PAIR(0xC465, 0xD6D2)
+DOUBLE_BYTE_PAIR(0xC466, 0xD6D3)
+DOUBLE_BYTE_PAIR(0xC467, 0xD6D5)
+DOUBLE_BYTE_PAIR(0xC468, 0xD6D6)
+DOUBLE_BYTE_PAIR(0xC469, 0xD6D8)
+DOUBLE_BYTE_PAIR(0xC46A, 0xD6DA)
+DOUBLE_BYTE_PAIR(0xC46B, 0xD6DB)
+DOUBLE_BYTE_PAIR(0xC46C, 0xD6DC)
+DOUBLE_BYTE_PAIR(0xC46D, 0xD6DD)
+DOUBLE_BYTE_PAIR(0xC46E, 0xD6DE)
+DOUBLE_BYTE_PAIR(0xC46F, 0xD6DF)
+DOUBLE_BYTE_PAIR(0xC470, 0xD6E1)
+DOUBLE_BYTE_PAIR(0xC471, 0xD6E2)
+DOUBLE_BYTE_PAIR(0xC472, 0xD6E3)
+DOUBLE_BYTE_PAIR(0xC473, 0xD6E5)
+DOUBLE_BYTE_PAIR(0xC474, 0xD6E6)
+DOUBLE_BYTE_PAIR(0xC475, 0xD6E7)
+DOUBLE_BYTE_PAIR(0xC476, 0xD6E9)
+DOUBLE_BYTE_PAIR(0xC477, 0xD6EA)
+DOUBLE_BYTE_PAIR(0xC478, 0xD6EB)
+DOUBLE_BYTE_PAIR(0xC479, 0xD6EC)
+DOUBLE_BYTE_PAIR(0xC47A, 0xD6ED)
+DOUBLE_BYTE_PAIR(0xC481, 0xD6EE)
+DOUBLE_BYTE_PAIR(0xC482, 0xD6EF)
+DOUBLE_BYTE_PAIR(0xC483, 0xD6F1)
+DOUBLE_BYTE_PAIR(0xC484, 0xD6F2)
+DOUBLE_BYTE_PAIR(0xC485, 0xD6F3)
+DOUBLE_BYTE_PAIR(0xC486, 0xD6F4)
+DOUBLE_BYTE_PAIR(0xC487, 0xD6F6)
+DOUBLE_BYTE_PAIR(0xC488, 0xD6F7)
+DOUBLE_BYTE_PAIR(0xC489, 0xD6F8)
+DOUBLE_BYTE_PAIR(0xC48A, 0xD6F9)
+DOUBLE_BYTE_PAIR(0xC48B, 0xD6FA)
+DOUBLE_BYTE_PAIR(0xC48C, 0xD6FB)
+DOUBLE_BYTE_PAIR(0xC48D, 0xD6FE)
+DOUBLE_BYTE_PAIR(0xC48E, 0xD6FF)
+DOUBLE_BYTE_PAIR(0xC48F, 0xD701)
+DOUBLE_BYTE_PAIR(0xC490, 0xD702)
+DOUBLE_BYTE_PAIR(0xC491, 0xD703)
+DOUBLE_BYTE_PAIR(0xC492, 0xD705)
+DOUBLE_BYTE_PAIR(0xC493, 0xD706)
+DOUBLE_BYTE_PAIR(0xC494, 0xD707)
+DOUBLE_BYTE_PAIR(0xC495, 0xD708)
+DOUBLE_BYTE_PAIR(0xC496, 0xD709)
+DOUBLE_BYTE_PAIR(0xC497, 0xD70A)
+DOUBLE_BYTE_PAIR(0xC498, 0xD70B)
+DOUBLE_BYTE_PAIR(0xC499, 0xD70C)
+DOUBLE_BYTE_PAIR(0xC49A, 0xD70D)
+DOUBLE_BYTE_PAIR(0xC49B, 0xD70E)
+DOUBLE_BYTE_PAIR(0xC49C, 0xD70F)
+DOUBLE_BYTE_PAIR(0xC49D, 0xD710)
+DOUBLE_BYTE_PAIR(0xC49E, 0xD712)
+DOUBLE_BYTE_PAIR(0xC49F, 0xD713)
+DOUBLE_BYTE_PAIR(0xC4A0, 0xD714)
+DOUBLE_BYTE_PAIR(0xC4A1, 0xCE58)
+DOUBLE_BYTE_PAIR(0xC4A2, 0xCE59)
+DOUBLE_BYTE_PAIR(0xC4A3, 0xCE5C)
+DOUBLE_BYTE_PAIR(0xC4A4, 0xCE5F)
+DOUBLE_BYTE_PAIR(0xC4A5, 0xCE60)
+DOUBLE_BYTE_PAIR(0xC4A6, 0xCE61)
+DOUBLE_BYTE_PAIR(0xC4A7, 0xCE68)
+DOUBLE_BYTE_PAIR(0xC4A8, 0xCE69)
+DOUBLE_BYTE_PAIR(0xC4A9, 0xCE6B)
+DOUBLE_BYTE_PAIR(0xC4AA, 0xCE6D)
+DOUBLE_BYTE_PAIR(0xC4AB, 0xCE74)
+DOUBLE_BYTE_PAIR(0xC4AC, 0xCE75)
+DOUBLE_BYTE_PAIR(0xC4AD, 0xCE78)
+DOUBLE_BYTE_PAIR(0xC4AE, 0xCE7C)
+DOUBLE_BYTE_PAIR(0xC4AF, 0xCE84)
+DOUBLE_BYTE_PAIR(0xC4B0, 0xCE85)
+DOUBLE_BYTE_PAIR(0xC4B1, 0xCE87)
+DOUBLE_BYTE_PAIR(0xC4B2, 0xCE89)
+DOUBLE_BYTE_PAIR(0xC4B3, 0xCE90)
+DOUBLE_BYTE_PAIR(0xC4B4, 0xCE91)
+DOUBLE_BYTE_PAIR(0xC4B5, 0xCE94)
+DOUBLE_BYTE_PAIR(0xC4B6, 0xCE98)
+DOUBLE_BYTE_PAIR(0xC4B7, 0xCEA0)
+DOUBLE_BYTE_PAIR(0xC4B8, 0xCEA1)
+DOUBLE_BYTE_PAIR(0xC4B9, 0xCEA3)
+DOUBLE_BYTE_PAIR(0xC4BA, 0xCEA4)
+DOUBLE_BYTE_PAIR(0xC4BB, 0xCEA5)
+DOUBLE_BYTE_PAIR(0xC4BC, 0xCEAC)
+DOUBLE_BYTE_PAIR(0xC4BD, 0xCEAD)
+DOUBLE_BYTE_PAIR(0xC4BE, 0xCEC1)
+DOUBLE_BYTE_PAIR(0xC4BF, 0xCEE4)
+DOUBLE_BYTE_PAIR(0xC4C0, 0xCEE5)
+DOUBLE_BYTE_PAIR(0xC4C1, 0xCEE8)
+DOUBLE_BYTE_PAIR(0xC4C2, 0xCEEB)
+DOUBLE_BYTE_PAIR(0xC4C3, 0xCEEC)
+DOUBLE_BYTE_PAIR(0xC4C4, 0xCEF4)
+DOUBLE_BYTE_PAIR(0xC4C5, 0xCEF5)
+DOUBLE_BYTE_PAIR(0xC4C6, 0xCEF7)
+DOUBLE_BYTE_PAIR(0xC4C7, 0xCEF8)
+DOUBLE_BYTE_PAIR(0xC4C8, 0xCEF9)
+DOUBLE_BYTE_PAIR(0xC4C9, 0xCF00)
+DOUBLE_BYTE_PAIR(0xC4CA, 0xCF01)
+DOUBLE_BYTE_PAIR(0xC4CB, 0xCF04)
+DOUBLE_BYTE_PAIR(0xC4CC, 0xCF08)
+DOUBLE_BYTE_PAIR(0xC4CD, 0xCF10)
+DOUBLE_BYTE_PAIR(0xC4CE, 0xCF11)
+DOUBLE_BYTE_PAIR(0xC4CF, 0xCF13)
+DOUBLE_BYTE_PAIR(0xC4D0, 0xCF15)
+DOUBLE_BYTE_PAIR(0xC4D1, 0xCF1C)
+DOUBLE_BYTE_PAIR(0xC4D2, 0xCF20)
+DOUBLE_BYTE_PAIR(0xC4D3, 0xCF24)
+DOUBLE_BYTE_PAIR(0xC4D4, 0xCF2C)
+DOUBLE_BYTE_PAIR(0xC4D5, 0xCF2D)
+DOUBLE_BYTE_PAIR(0xC4D6, 0xCF2F)
+DOUBLE_BYTE_PAIR(0xC4D7, 0xCF30)
+DOUBLE_BYTE_PAIR(0xC4D8, 0xCF31)
+DOUBLE_BYTE_PAIR(0xC4D9, 0xCF38)
+DOUBLE_BYTE_PAIR(0xC4DA, 0xCF54)
+DOUBLE_BYTE_PAIR(0xC4DB, 0xCF55)
+DOUBLE_BYTE_PAIR(0xC4DC, 0xCF58)
+DOUBLE_BYTE_PAIR(0xC4DD, 0xCF5C)
+DOUBLE_BYTE_PAIR(0xC4DE, 0xCF64)
+DOUBLE_BYTE_PAIR(0xC4DF, 0xCF65)
+DOUBLE_BYTE_PAIR(0xC4E0, 0xCF67)
+DOUBLE_BYTE_PAIR(0xC4E1, 0xCF69)
+DOUBLE_BYTE_PAIR(0xC4E2, 0xCF70)
+DOUBLE_BYTE_PAIR(0xC4E3, 0xCF71)
+DOUBLE_BYTE_PAIR(0xC4E4, 0xCF74)
+DOUBLE_BYTE_PAIR(0xC4E5, 0xCF78)
+DOUBLE_BYTE_PAIR(0xC4E6, 0xCF80)
+DOUBLE_BYTE_PAIR(0xC4E7, 0xCF85)
+DOUBLE_BYTE_PAIR(0xC4E8, 0xCF8C)
+DOUBLE_BYTE_PAIR(0xC4E9, 0xCFA1)
+DOUBLE_BYTE_PAIR(0xC4EA, 0xCFA8)
+DOUBLE_BYTE_PAIR(0xC4EB, 0xCFB0)
+DOUBLE_BYTE_PAIR(0xC4EC, 0xCFC4)
+DOUBLE_BYTE_PAIR(0xC4ED, 0xCFE0)
+DOUBLE_BYTE_PAIR(0xC4EE, 0xCFE1)
+DOUBLE_BYTE_PAIR(0xC4EF, 0xCFE4)
+DOUBLE_BYTE_PAIR(0xC4F0, 0xCFE8)
+DOUBLE_BYTE_PAIR(0xC4F1, 0xCFF0)
+DOUBLE_BYTE_PAIR(0xC4F2, 0xCFF1)
+DOUBLE_BYTE_PAIR(0xC4F3, 0xCFF3)
+DOUBLE_BYTE_PAIR(0xC4F4, 0xCFF5)
+DOUBLE_BYTE_PAIR(0xC4F5, 0xCFFC)
+DOUBLE_BYTE_PAIR(0xC4F6, 0xD000)
+DOUBLE_BYTE_PAIR(0xC4F7, 0xD004)
+DOUBLE_BYTE_PAIR(0xC4F8, 0xD011)
+DOUBLE_BYTE_PAIR(0xC4F9, 0xD018)
+DOUBLE_BYTE_PAIR(0xC4FA, 0xD02D)
+DOUBLE_BYTE_PAIR(0xC4FB, 0xD034)
+DOUBLE_BYTE_PAIR(0xC4FC, 0xD035)
+DOUBLE_BYTE_PAIR(0xC4FD, 0xD038)
+DOUBLE_BYTE_PAIR(0xC4FE, 0xD03C)
+DOUBLE_BYTE_PAIR(0xC541, 0xD715)
+DOUBLE_BYTE_PAIR(0xC542, 0xD716)
+DOUBLE_BYTE_PAIR(0xC543, 0xD717)
+DOUBLE_BYTE_PAIR(0xC544, 0xD71A)
+DOUBLE_BYTE_PAIR(0xC545, 0xD71B)
+DOUBLE_BYTE_PAIR(0xC546, 0xD71D)
+DOUBLE_BYTE_PAIR(0xC547, 0xD71E)
+DOUBLE_BYTE_PAIR(0xC548, 0xD71F)
+DOUBLE_BYTE_PAIR(0xC549, 0xD721)
+DOUBLE_BYTE_PAIR(0xC54A, 0xD722)
+DOUBLE_BYTE_PAIR(0xC54B, 0xD723)
+DOUBLE_BYTE_PAIR(0xC54C, 0xD724)
+DOUBLE_BYTE_PAIR(0xC54D, 0xD725)
+DOUBLE_BYTE_PAIR(0xC54E, 0xD726)
+DOUBLE_BYTE_PAIR(0xC54F, 0xD727)
+DOUBLE_BYTE_PAIR(0xC550, 0xD72A)
+DOUBLE_BYTE_PAIR(0xC551, 0xD72C)
+DOUBLE_BYTE_PAIR(0xC552, 0xD72E)
+DOUBLE_BYTE_PAIR(0xC553, 0xD72F)
+DOUBLE_BYTE_PAIR(0xC554, 0xD730)
+DOUBLE_BYTE_PAIR(0xC555, 0xD731)
+DOUBLE_BYTE_PAIR(0xC556, 0xD732)
+DOUBLE_BYTE_PAIR(0xC557, 0xD733)
+DOUBLE_BYTE_PAIR(0xC558, 0xD736)
+DOUBLE_BYTE_PAIR(0xC559, 0xD737)
+DOUBLE_BYTE_PAIR(0xC55A, 0xD739)
+DOUBLE_BYTE_PAIR(0xC561, 0xD73A)
+DOUBLE_BYTE_PAIR(0xC562, 0xD73B)
+DOUBLE_BYTE_PAIR(0xC563, 0xD73D)
+DOUBLE_BYTE_PAIR(0xC564, 0xD73E)
+DOUBLE_BYTE_PAIR(0xC565, 0xD73F)
+DOUBLE_BYTE_PAIR(0xC566, 0xD740)
+DOUBLE_BYTE_PAIR(0xC567, 0xD741)
+DOUBLE_BYTE_PAIR(0xC568, 0xD742)
+DOUBLE_BYTE_PAIR(0xC569, 0xD743)
+DOUBLE_BYTE_PAIR(0xC56A, 0xD745)
+DOUBLE_BYTE_PAIR(0xC56B, 0xD746)
+DOUBLE_BYTE_PAIR(0xC56C, 0xD748)
+DOUBLE_BYTE_PAIR(0xC56D, 0xD74A)
+DOUBLE_BYTE_PAIR(0xC56E, 0xD74B)
+DOUBLE_BYTE_PAIR(0xC56F, 0xD74C)
+DOUBLE_BYTE_PAIR(0xC570, 0xD74D)
+DOUBLE_BYTE_PAIR(0xC571, 0xD74E)
+DOUBLE_BYTE_PAIR(0xC572, 0xD74F)
+DOUBLE_BYTE_PAIR(0xC573, 0xD752)
+DOUBLE_BYTE_PAIR(0xC574, 0xD753)
+DOUBLE_BYTE_PAIR(0xC575, 0xD755)
+DOUBLE_BYTE_PAIR(0xC576, 0xD75A)
+DOUBLE_BYTE_PAIR(0xC577, 0xD75B)
+DOUBLE_BYTE_PAIR(0xC578, 0xD75C)
+DOUBLE_BYTE_PAIR(0xC579, 0xD75D)
+DOUBLE_BYTE_PAIR(0xC57A, 0xD75E)
+DOUBLE_BYTE_PAIR(0xC581, 0xD75F)
+DOUBLE_BYTE_PAIR(0xC582, 0xD762)
+DOUBLE_BYTE_PAIR(0xC583, 0xD764)
+DOUBLE_BYTE_PAIR(0xC584, 0xD766)
+DOUBLE_BYTE_PAIR(0xC585, 0xD767)
+DOUBLE_BYTE_PAIR(0xC586, 0xD768)
+DOUBLE_BYTE_PAIR(0xC587, 0xD76A)
+DOUBLE_BYTE_PAIR(0xC588, 0xD76B)
+DOUBLE_BYTE_PAIR(0xC589, 0xD76D)
+DOUBLE_BYTE_PAIR(0xC58A, 0xD76E)
+DOUBLE_BYTE_PAIR(0xC58B, 0xD76F)
+DOUBLE_BYTE_PAIR(0xC58C, 0xD771)
+DOUBLE_BYTE_PAIR(0xC58D, 0xD772)
+DOUBLE_BYTE_PAIR(0xC58E, 0xD773)
+DOUBLE_BYTE_PAIR(0xC58F, 0xD775)
+DOUBLE_BYTE_PAIR(0xC590, 0xD776)
+DOUBLE_BYTE_PAIR(0xC591, 0xD777)
+DOUBLE_BYTE_PAIR(0xC592, 0xD778)
+DOUBLE_BYTE_PAIR(0xC593, 0xD779)
+DOUBLE_BYTE_PAIR(0xC594, 0xD77A)
+DOUBLE_BYTE_PAIR(0xC595, 0xD77B)
+DOUBLE_BYTE_PAIR(0xC596, 0xD77E)
+DOUBLE_BYTE_PAIR(0xC597, 0xD77F)
+DOUBLE_BYTE_PAIR(0xC598, 0xD780)
+DOUBLE_BYTE_PAIR(0xC599, 0xD782)
+DOUBLE_BYTE_PAIR(0xC59A, 0xD783)
+DOUBLE_BYTE_PAIR(0xC59B, 0xD784)
+DOUBLE_BYTE_PAIR(0xC59C, 0xD785)
+DOUBLE_BYTE_PAIR(0xC59D, 0xD786)
+DOUBLE_BYTE_PAIR(0xC59E, 0xD787)
+DOUBLE_BYTE_PAIR(0xC59F, 0xD78A)
+DOUBLE_BYTE_PAIR(0xC5A0, 0xD78B)
+DOUBLE_BYTE_PAIR(0xC5A1, 0xD044)
+DOUBLE_BYTE_PAIR(0xC5A2, 0xD045)
+DOUBLE_BYTE_PAIR(0xC5A3, 0xD047)
+DOUBLE_BYTE_PAIR(0xC5A4, 0xD049)
+DOUBLE_BYTE_PAIR(0xC5A5, 0xD050)
+DOUBLE_BYTE_PAIR(0xC5A6, 0xD054)
+DOUBLE_BYTE_PAIR(0xC5A7, 0xD058)
+DOUBLE_BYTE_PAIR(0xC5A8, 0xD060)
+DOUBLE_BYTE_PAIR(0xC5A9, 0xD06C)
+DOUBLE_BYTE_PAIR(0xC5AA, 0xD06D)
+DOUBLE_BYTE_PAIR(0xC5AB, 0xD070)
+DOUBLE_BYTE_PAIR(0xC5AC, 0xD074)
+DOUBLE_BYTE_PAIR(0xC5AD, 0xD07C)
+DOUBLE_BYTE_PAIR(0xC5AE, 0xD07D)
+DOUBLE_BYTE_PAIR(0xC5AF, 0xD081)
+DOUBLE_BYTE_PAIR(0xC5B0, 0xD0A4)
+DOUBLE_BYTE_PAIR(0xC5B1, 0xD0A5)
+DOUBLE_BYTE_PAIR(0xC5B2, 0xD0A8)
+DOUBLE_BYTE_PAIR(0xC5B3, 0xD0AC)
+DOUBLE_BYTE_PAIR(0xC5B4, 0xD0B4)
+DOUBLE_BYTE_PAIR(0xC5B5, 0xD0B5)
+DOUBLE_BYTE_PAIR(0xC5B6, 0xD0B7)
+DOUBLE_BYTE_PAIR(0xC5B7, 0xD0B9)
+DOUBLE_BYTE_PAIR(0xC5B8, 0xD0C0)
+DOUBLE_BYTE_PAIR(0xC5B9, 0xD0C1)
+DOUBLE_BYTE_PAIR(0xC5BA, 0xD0C4)
+DOUBLE_BYTE_PAIR(0xC5BB, 0xD0C8)
+DOUBLE_BYTE_PAIR(0xC5BC, 0xD0C9)
+DOUBLE_BYTE_PAIR(0xC5BD, 0xD0D0)
+DOUBLE_BYTE_PAIR(0xC5BE, 0xD0D1)
+DOUBLE_BYTE_PAIR(0xC5BF, 0xD0D3)
+DOUBLE_BYTE_PAIR(0xC5C0, 0xD0D4)
+DOUBLE_BYTE_PAIR(0xC5C1, 0xD0D5)
+DOUBLE_BYTE_PAIR(0xC5C2, 0xD0DC)
+DOUBLE_BYTE_PAIR(0xC5C3, 0xD0DD)
+DOUBLE_BYTE_PAIR(0xC5C4, 0xD0E0)
+DOUBLE_BYTE_PAIR(0xC5C5, 0xD0E4)
+DOUBLE_BYTE_PAIR(0xC5C6, 0xD0EC)
+DOUBLE_BYTE_PAIR(0xC5C7, 0xD0ED)
+DOUBLE_BYTE_PAIR(0xC5C8, 0xD0EF)
+DOUBLE_BYTE_PAIR(0xC5C9, 0xD0F0)
+DOUBLE_BYTE_PAIR(0xC5CA, 0xD0F1)
+DOUBLE_BYTE_PAIR(0xC5CB, 0xD0F8)
+DOUBLE_BYTE_PAIR(0xC5CC, 0xD10D)
+DOUBLE_BYTE_PAIR(0xC5CD, 0xD130)
+DOUBLE_BYTE_PAIR(0xC5CE, 0xD131)
+DOUBLE_BYTE_PAIR(0xC5CF, 0xD134)
+DOUBLE_BYTE_PAIR(0xC5D0, 0xD138)
+DOUBLE_BYTE_PAIR(0xC5D1, 0xD13A)
+DOUBLE_BYTE_PAIR(0xC5D2, 0xD140)
+DOUBLE_BYTE_PAIR(0xC5D3, 0xD141)
+DOUBLE_BYTE_PAIR(0xC5D4, 0xD143)
+DOUBLE_BYTE_PAIR(0xC5D5, 0xD144)
+DOUBLE_BYTE_PAIR(0xC5D6, 0xD145)
+DOUBLE_BYTE_PAIR(0xC5D7, 0xD14C)
+DOUBLE_BYTE_PAIR(0xC5D8, 0xD14D)
+DOUBLE_BYTE_PAIR(0xC5D9, 0xD150)
+DOUBLE_BYTE_PAIR(0xC5DA, 0xD154)
+DOUBLE_BYTE_PAIR(0xC5DB, 0xD15C)
+DOUBLE_BYTE_PAIR(0xC5DC, 0xD15D)
+DOUBLE_BYTE_PAIR(0xC5DD, 0xD15F)
+DOUBLE_BYTE_PAIR(0xC5DE, 0xD161)
+DOUBLE_BYTE_PAIR(0xC5DF, 0xD168)
+DOUBLE_BYTE_PAIR(0xC5E0, 0xD16C)
+DOUBLE_BYTE_PAIR(0xC5E1, 0xD17C)
+DOUBLE_BYTE_PAIR(0xC5E2, 0xD184)
+DOUBLE_BYTE_PAIR(0xC5E3, 0xD188)
+DOUBLE_BYTE_PAIR(0xC5E4, 0xD1A0)
+DOUBLE_BYTE_PAIR(0xC5E5, 0xD1A1)
+DOUBLE_BYTE_PAIR(0xC5E6, 0xD1A4)
+DOUBLE_BYTE_PAIR(0xC5E7, 0xD1A8)
+DOUBLE_BYTE_PAIR(0xC5E8, 0xD1B0)
+DOUBLE_BYTE_PAIR(0xC5E9, 0xD1B1)
+DOUBLE_BYTE_PAIR(0xC5EA, 0xD1B3)
+DOUBLE_BYTE_PAIR(0xC5EB, 0xD1B5)
+DOUBLE_BYTE_PAIR(0xC5EC, 0xD1BA)
+DOUBLE_BYTE_PAIR(0xC5ED, 0xD1BC)
+DOUBLE_BYTE_PAIR(0xC5EE, 0xD1C0)
+DOUBLE_BYTE_PAIR(0xC5EF, 0xD1D8)
+DOUBLE_BYTE_PAIR(0xC5F0, 0xD1F4)
+DOUBLE_BYTE_PAIR(0xC5F1, 0xD1F8)
+DOUBLE_BYTE_PAIR(0xC5F2, 0xD207)
+DOUBLE_BYTE_PAIR(0xC5F3, 0xD209)
+DOUBLE_BYTE_PAIR(0xC5F4, 0xD210)
+DOUBLE_BYTE_PAIR(0xC5F5, 0xD22C)
+DOUBLE_BYTE_PAIR(0xC5F6, 0xD22D)
+DOUBLE_BYTE_PAIR(0xC5F7, 0xD230)
+DOUBLE_BYTE_PAIR(0xC5F8, 0xD234)
+DOUBLE_BYTE_PAIR(0xC5F9, 0xD23C)
+DOUBLE_BYTE_PAIR(0xC5FA, 0xD23D)
+DOUBLE_BYTE_PAIR(0xC5FB, 0xD23F)
+DOUBLE_BYTE_PAIR(0xC5FC, 0xD241)
+DOUBLE_BYTE_PAIR(0xC5FD, 0xD248)
+DOUBLE_BYTE_PAIR(0xC5FE, 0xD25C)
+DOUBLE_BYTE_PAIR(0xC641, 0xD78D)
+DOUBLE_BYTE_PAIR(0xC642, 0xD78E)
+DOUBLE_BYTE_PAIR(0xC643, 0xD78F)
+DOUBLE_BYTE_PAIR(0xC644, 0xD791)
+DOUBLE_BYTE_PAIR(0xC645, 0xD792)
+DOUBLE_BYTE_PAIR(0xC646, 0xD793)
+DOUBLE_BYTE_PAIR(0xC647, 0xD794)
+DOUBLE_BYTE_PAIR(0xC648, 0xD795)
+DOUBLE_BYTE_PAIR(0xC649, 0xD796)
+DOUBLE_BYTE_PAIR(0xC64A, 0xD797)
+DOUBLE_BYTE_PAIR(0xC64B, 0xD79A)
+DOUBLE_BYTE_PAIR(0xC64C, 0xD79C)
+DOUBLE_BYTE_PAIR(0xC64D, 0xD79E)
+DOUBLE_BYTE_PAIR(0xC64E, 0xD79F)
+DOUBLE_BYTE_PAIR(0xC64F, 0xD7A0)
+DOUBLE_BYTE_PAIR(0xC650, 0xD7A1)
+DOUBLE_BYTE_PAIR(0xC651, 0xD7A2)
+DOUBLE_BYTE_PAIR(0xC652, 0xD7A3)
+DOUBLE_BYTE_PAIR(0xC6A1, 0xD264)
+DOUBLE_BYTE_PAIR(0xC6A2, 0xD280)
+DOUBLE_BYTE_PAIR(0xC6A3, 0xD281)
+DOUBLE_BYTE_PAIR(0xC6A4, 0xD284)
+DOUBLE_BYTE_PAIR(0xC6A5, 0xD288)
+DOUBLE_BYTE_PAIR(0xC6A6, 0xD290)
+DOUBLE_BYTE_PAIR(0xC6A7, 0xD291)
+DOUBLE_BYTE_PAIR(0xC6A8, 0xD295)
+DOUBLE_BYTE_PAIR(0xC6A9, 0xD29C)
+DOUBLE_BYTE_PAIR(0xC6AA, 0xD2A0)
+DOUBLE_BYTE_PAIR(0xC6AB, 0xD2A4)
+DOUBLE_BYTE_PAIR(0xC6AC, 0xD2AC)
+DOUBLE_BYTE_PAIR(0xC6AD, 0xD2B1)
+DOUBLE_BYTE_PAIR(0xC6AE, 0xD2B8)
+DOUBLE_BYTE_PAIR(0xC6AF, 0xD2B9)
+DOUBLE_BYTE_PAIR(0xC6B0, 0xD2BC)
+DOUBLE_BYTE_PAIR(0xC6B1, 0xD2BF)
+DOUBLE_BYTE_PAIR(0xC6B2, 0xD2C0)
+DOUBLE_BYTE_PAIR(0xC6B3, 0xD2C2)
+DOUBLE_BYTE_PAIR(0xC6B4, 0xD2C8)
+DOUBLE_BYTE_PAIR(0xC6B5, 0xD2C9)
+DOUBLE_BYTE_PAIR(0xC6B6, 0xD2CB)
+DOUBLE_BYTE_PAIR(0xC6B7, 0xD2D4)
+DOUBLE_BYTE_PAIR(0xC6B8, 0xD2D8)
+DOUBLE_BYTE_PAIR(0xC6B9, 0xD2DC)
+DOUBLE_BYTE_PAIR(0xC6BA, 0xD2E4)
+DOUBLE_BYTE_PAIR(0xC6BB, 0xD2E5)
+DOUBLE_BYTE_PAIR(0xC6BC, 0xD2F0)
+DOUBLE_BYTE_PAIR(0xC6BD, 0xD2F1)
+DOUBLE_BYTE_PAIR(0xC6BE, 0xD2F4)
+DOUBLE_BYTE_PAIR(0xC6BF, 0xD2F8)
+DOUBLE_BYTE_PAIR(0xC6C0, 0xD300)
+DOUBLE_BYTE_PAIR(0xC6C1, 0xD301)
+DOUBLE_BYTE_PAIR(0xC6C2, 0xD303)
+DOUBLE_BYTE_PAIR(0xC6C3, 0xD305)
+DOUBLE_BYTE_PAIR(0xC6C4, 0xD30C)
+DOUBLE_BYTE_PAIR(0xC6C5, 0xD30D)
+DOUBLE_BYTE_PAIR(0xC6C6, 0xD30E)
+DOUBLE_BYTE_PAIR(0xC6C7, 0xD310)
+DOUBLE_BYTE_PAIR(0xC6C8, 0xD314)
+DOUBLE_BYTE_PAIR(0xC6C9, 0xD316)
+DOUBLE_BYTE_PAIR(0xC6CA, 0xD31C)
+DOUBLE_BYTE_PAIR(0xC6CB, 0xD31D)
+DOUBLE_BYTE_PAIR(0xC6CC, 0xD31F)
+DOUBLE_BYTE_PAIR(0xC6CD, 0xD320)
+DOUBLE_BYTE_PAIR(0xC6CE, 0xD321)
+DOUBLE_BYTE_PAIR(0xC6CF, 0xD325)
+DOUBLE_BYTE_PAIR(0xC6D0, 0xD328)
+DOUBLE_BYTE_PAIR(0xC6D1, 0xD329)
+DOUBLE_BYTE_PAIR(0xC6D2, 0xD32C)
+DOUBLE_BYTE_PAIR(0xC6D3, 0xD330)
+DOUBLE_BYTE_PAIR(0xC6D4, 0xD338)
+DOUBLE_BYTE_PAIR(0xC6D5, 0xD339)
+DOUBLE_BYTE_PAIR(0xC6D6, 0xD33B)
+DOUBLE_BYTE_PAIR(0xC6D7, 0xD33C)
+DOUBLE_BYTE_PAIR(0xC6D8, 0xD33D)
+DOUBLE_BYTE_PAIR(0xC6D9, 0xD344)
+DOUBLE_BYTE_PAIR(0xC6DA, 0xD345)
+DOUBLE_BYTE_PAIR(0xC6DB, 0xD37C)
+DOUBLE_BYTE_PAIR(0xC6DC, 0xD37D)
+DOUBLE_BYTE_PAIR(0xC6DD, 0xD380)
+DOUBLE_BYTE_PAIR(0xC6DE, 0xD384)
+DOUBLE_BYTE_PAIR(0xC6DF, 0xD38C)
+DOUBLE_BYTE_PAIR(0xC6E0, 0xD38D)
+DOUBLE_BYTE_PAIR(0xC6E1, 0xD38F)
+DOUBLE_BYTE_PAIR(0xC6E2, 0xD390)
+DOUBLE_BYTE_PAIR(0xC6E3, 0xD391)
+DOUBLE_BYTE_PAIR(0xC6E4, 0xD398)
+DOUBLE_BYTE_PAIR(0xC6E5, 0xD399)
+DOUBLE_BYTE_PAIR(0xC6E6, 0xD39C)
+DOUBLE_BYTE_PAIR(0xC6E7, 0xD3A0)
+DOUBLE_BYTE_PAIR(0xC6E8, 0xD3A8)
+DOUBLE_BYTE_PAIR(0xC6E9, 0xD3A9)
+DOUBLE_BYTE_PAIR(0xC6EA, 0xD3AB)
+DOUBLE_BYTE_PAIR(0xC6EB, 0xD3AD)
+DOUBLE_BYTE_PAIR(0xC6EC, 0xD3B4)
+DOUBLE_BYTE_PAIR(0xC6ED, 0xD3B8)
+DOUBLE_BYTE_PAIR(0xC6EE, 0xD3BC)
+DOUBLE_BYTE_PAIR(0xC6EF, 0xD3C4)
+DOUBLE_BYTE_PAIR(0xC6F0, 0xD3C5)
+DOUBLE_BYTE_PAIR(0xC6F1, 0xD3C8)
+DOUBLE_BYTE_PAIR(0xC6F2, 0xD3C9)
+DOUBLE_BYTE_PAIR(0xC6F3, 0xD3D0)
+DOUBLE_BYTE_PAIR(0xC6F4, 0xD3D8)
+DOUBLE_BYTE_PAIR(0xC6F5, 0xD3E1)
+DOUBLE_BYTE_PAIR(0xC6F6, 0xD3E3)
+DOUBLE_BYTE_PAIR(0xC6F7, 0xD3EC)
+DOUBLE_BYTE_PAIR(0xC6F8, 0xD3ED)
+DOUBLE_BYTE_PAIR(0xC6F9, 0xD3F0)
+DOUBLE_BYTE_PAIR(0xC6FA, 0xD3F4)
+DOUBLE_BYTE_PAIR(0xC6FB, 0xD3FC)
+DOUBLE_BYTE_PAIR(0xC6FC, 0xD3FD)
+DOUBLE_BYTE_PAIR(0xC6FD, 0xD3FF)
+DOUBLE_BYTE_PAIR(0xC6FE, 0xD401)
+DOUBLE_BYTE_PAIR(0xC7A1, 0xD408)
+DOUBLE_BYTE_PAIR(0xC7A2, 0xD41D)
+DOUBLE_BYTE_PAIR(0xC7A3, 0xD440)
+DOUBLE_BYTE_PAIR(0xC7A4, 0xD444)
+DOUBLE_BYTE_PAIR(0xC7A5, 0xD45C)
+DOUBLE_BYTE_PAIR(0xC7A6, 0xD460)
+DOUBLE_BYTE_PAIR(0xC7A7, 0xD464)
+DOUBLE_BYTE_PAIR(0xC7A8, 0xD46D)
+DOUBLE_BYTE_PAIR(0xC7A9, 0xD46F)
+DOUBLE_BYTE_PAIR(0xC7AA, 0xD478)
+DOUBLE_BYTE_PAIR(0xC7AB, 0xD479)
+DOUBLE_BYTE_PAIR(0xC7AC, 0xD47C)
+DOUBLE_BYTE_PAIR(0xC7AD, 0xD47F)
+DOUBLE_BYTE_PAIR(0xC7AE, 0xD480)
+DOUBLE_BYTE_PAIR(0xC7AF, 0xD482)
+DOUBLE_BYTE_PAIR(0xC7B0, 0xD488)
+DOUBLE_BYTE_PAIR(0xC7B1, 0xD489)
+DOUBLE_BYTE_PAIR(0xC7B2, 0xD48B)
+DOUBLE_BYTE_PAIR(0xC7B3, 0xD48D)
+DOUBLE_BYTE_PAIR(0xC7B4, 0xD494)
+DOUBLE_BYTE_PAIR(0xC7B5, 0xD4A9)
+DOUBLE_BYTE_PAIR(0xC7B6, 0xD4CC)
+DOUBLE_BYTE_PAIR(0xC7B7, 0xD4D0)
+DOUBLE_BYTE_PAIR(0xC7B8, 0xD4D4)
+DOUBLE_BYTE_PAIR(0xC7B9, 0xD4DC)
+DOUBLE_BYTE_PAIR(0xC7BA, 0xD4DF)
+DOUBLE_BYTE_PAIR(0xC7BB, 0xD4E8)
+DOUBLE_BYTE_PAIR(0xC7BC, 0xD4EC)
+DOUBLE_BYTE_PAIR(0xC7BD, 0xD4F0)
+DOUBLE_BYTE_PAIR(0xC7BE, 0xD4F8)
+DOUBLE_BYTE_PAIR(0xC7BF, 0xD4FB)
+DOUBLE_BYTE_PAIR(0xC7C0, 0xD4FD)
+DOUBLE_BYTE_PAIR(0xC7C1, 0xD504)
+DOUBLE_BYTE_PAIR(0xC7C2, 0xD508)
+DOUBLE_BYTE_PAIR(0xC7C3, 0xD50C)
+DOUBLE_BYTE_PAIR(0xC7C4, 0xD514)
+DOUBLE_BYTE_PAIR(0xC7C5, 0xD515)
+DOUBLE_BYTE_PAIR(0xC7C6, 0xD517)
+DOUBLE_BYTE_PAIR(0xC7C7, 0xD53C)
+DOUBLE_BYTE_PAIR(0xC7C8, 0xD53D)
+DOUBLE_BYTE_PAIR(0xC7C9, 0xD540)
+DOUBLE_BYTE_PAIR(0xC7CA, 0xD544)
+DOUBLE_BYTE_PAIR(0xC7CB, 0xD54C)
+DOUBLE_BYTE_PAIR(0xC7CC, 0xD54D)
+DOUBLE_BYTE_PAIR(0xC7CD, 0xD54F)
+DOUBLE_BYTE_PAIR(0xC7CE, 0xD551)
+DOUBLE_BYTE_PAIR(0xC7CF, 0xD558)
+DOUBLE_BYTE_PAIR(0xC7D0, 0xD559)
+DOUBLE_BYTE_PAIR(0xC7D1, 0xD55C)
+DOUBLE_BYTE_PAIR(0xC7D2, 0xD560)
+DOUBLE_BYTE_PAIR(0xC7D3, 0xD565)
+DOUBLE_BYTE_PAIR(0xC7D4, 0xD568)
+DOUBLE_BYTE_PAIR(0xC7D5, 0xD569)
+DOUBLE_BYTE_PAIR(0xC7D6, 0xD56B)
+DOUBLE_BYTE_PAIR(0xC7D7, 0xD56D)
+DOUBLE_BYTE_PAIR(0xC7D8, 0xD574)
+DOUBLE_BYTE_PAIR(0xC7D9, 0xD575)
+DOUBLE_BYTE_PAIR(0xC7DA, 0xD578)
+DOUBLE_BYTE_PAIR(0xC7DB, 0xD57C)
+DOUBLE_BYTE_PAIR(0xC7DC, 0xD584)
+DOUBLE_BYTE_PAIR(0xC7DD, 0xD585)
+DOUBLE_BYTE_PAIR(0xC7DE, 0xD587)
+DOUBLE_BYTE_PAIR(0xC7DF, 0xD588)
+DOUBLE_BYTE_PAIR(0xC7E0, 0xD589)
+DOUBLE_BYTE_PAIR(0xC7E1, 0xD590)
+DOUBLE_BYTE_PAIR(0xC7E2, 0xD5A5)
+DOUBLE_BYTE_PAIR(0xC7E3, 0xD5C8)
+DOUBLE_BYTE_PAIR(0xC7E4, 0xD5C9)
+DOUBLE_BYTE_PAIR(0xC7E5, 0xD5CC)
+DOUBLE_BYTE_PAIR(0xC7E6, 0xD5D0)
+DOUBLE_BYTE_PAIR(0xC7E7, 0xD5D2)
+DOUBLE_BYTE_PAIR(0xC7E8, 0xD5D8)
+DOUBLE_BYTE_PAIR(0xC7E9, 0xD5D9)
+DOUBLE_BYTE_PAIR(0xC7EA, 0xD5DB)
+DOUBLE_BYTE_PAIR(0xC7EB, 0xD5DD)
+DOUBLE_BYTE_PAIR(0xC7EC, 0xD5E4)
+DOUBLE_BYTE_PAIR(0xC7ED, 0xD5E5)
+DOUBLE_BYTE_PAIR(0xC7EE, 0xD5E8)
+DOUBLE_BYTE_PAIR(0xC7EF, 0xD5EC)
+DOUBLE_BYTE_PAIR(0xC7F0, 0xD5F4)
+DOUBLE_BYTE_PAIR(0xC7F1, 0xD5F5)
+DOUBLE_BYTE_PAIR(0xC7F2, 0xD5F7)
+DOUBLE_BYTE_PAIR(0xC7F3, 0xD5F9)
+DOUBLE_BYTE_PAIR(0xC7F4, 0xD600)
+DOUBLE_BYTE_PAIR(0xC7F5, 0xD601)
+DOUBLE_BYTE_PAIR(0xC7F6, 0xD604)
+DOUBLE_BYTE_PAIR(0xC7F7, 0xD608)
+DOUBLE_BYTE_PAIR(0xC7F8, 0xD610)
+DOUBLE_BYTE_PAIR(0xC7F9, 0xD611)
+DOUBLE_BYTE_PAIR(0xC7FA, 0xD613)
+DOUBLE_BYTE_PAIR(0xC7FB, 0xD614)
+DOUBLE_BYTE_PAIR(0xC7FC, 0xD615)
+DOUBLE_BYTE_PAIR(0xC7FD, 0xD61C)
+DOUBLE_BYTE_PAIR(0xC7FE, 0xD620)
+DOUBLE_BYTE_PAIR(0xC8A1, 0xD624)
+DOUBLE_BYTE_PAIR(0xC8A2, 0xD62D)
+DOUBLE_BYTE_PAIR(0xC8A3, 0xD638)
+DOUBLE_BYTE_PAIR(0xC8A4, 0xD639)
+DOUBLE_BYTE_PAIR(0xC8A5, 0xD63C)
+DOUBLE_BYTE_PAIR(0xC8A6, 0xD640)
+DOUBLE_BYTE_PAIR(0xC8A7, 0xD645)
+DOUBLE_BYTE_PAIR(0xC8A8, 0xD648)
+DOUBLE_BYTE_PAIR(0xC8A9, 0xD649)
+DOUBLE_BYTE_PAIR(0xC8AA, 0xD64B)
+DOUBLE_BYTE_PAIR(0xC8AB, 0xD64D)
+DOUBLE_BYTE_PAIR(0xC8AC, 0xD651)
+DOUBLE_BYTE_PAIR(0xC8AD, 0xD654)
+DOUBLE_BYTE_PAIR(0xC8AE, 0xD655)
+DOUBLE_BYTE_PAIR(0xC8AF, 0xD658)
+DOUBLE_BYTE_PAIR(0xC8B0, 0xD65C)
+DOUBLE_BYTE_PAIR(0xC8B1, 0xD667)
+DOUBLE_BYTE_PAIR(0xC8B2, 0xD669)
+DOUBLE_BYTE_PAIR(0xC8B3, 0xD670)
+DOUBLE_BYTE_PAIR(0xC8B4, 0xD671)
+DOUBLE_BYTE_PAIR(0xC8B5, 0xD674)
+DOUBLE_BYTE_PAIR(0xC8B6, 0xD683)
+DOUBLE_BYTE_PAIR(0xC8B7, 0xD685)
+DOUBLE_BYTE_PAIR(0xC8B8, 0xD68C)
+DOUBLE_BYTE_PAIR(0xC8B9, 0xD68D)
+DOUBLE_BYTE_PAIR(0xC8BA, 0xD690)
+DOUBLE_BYTE_PAIR(0xC8BB, 0xD694)
+DOUBLE_BYTE_PAIR(0xC8BC, 0xD69D)
+DOUBLE_BYTE_PAIR(0xC8BD, 0xD69F)
+DOUBLE_BYTE_PAIR(0xC8BE, 0xD6A1)
+DOUBLE_BYTE_PAIR(0xC8BF, 0xD6A8)
+DOUBLE_BYTE_PAIR(0xC8C0, 0xD6AC)
+DOUBLE_BYTE_PAIR(0xC8C1, 0xD6B0)
+DOUBLE_BYTE_PAIR(0xC8C2, 0xD6B9)
+DOUBLE_BYTE_PAIR(0xC8C3, 0xD6BB)
+DOUBLE_BYTE_PAIR(0xC8C4, 0xD6C4)
+DOUBLE_BYTE_PAIR(0xC8C5, 0xD6C5)
+DOUBLE_BYTE_PAIR(0xC8C6, 0xD6C8)
+DOUBLE_BYTE_PAIR(0xC8C7, 0xD6CC)
+DOUBLE_BYTE_PAIR(0xC8C8, 0xD6D1)
+DOUBLE_BYTE_PAIR(0xC8C9, 0xD6D4)
+DOUBLE_BYTE_PAIR(0xC8CA, 0xD6D7)
+DOUBLE_BYTE_PAIR(0xC8CB, 0xD6D9)
+DOUBLE_BYTE_PAIR(0xC8CC, 0xD6E0)
+DOUBLE_BYTE_PAIR(0xC8CD, 0xD6E4)
+DOUBLE_BYTE_PAIR(0xC8CE, 0xD6E8)
+DOUBLE_BYTE_PAIR(0xC8CF, 0xD6F0)
+DOUBLE_BYTE_PAIR(0xC8D0, 0xD6F5)
+DOUBLE_BYTE_PAIR(0xC8D1, 0xD6FC)
+DOUBLE_BYTE_PAIR(0xC8D2, 0xD6FD)
+DOUBLE_BYTE_PAIR(0xC8D3, 0xD700)
+DOUBLE_BYTE_PAIR(0xC8D4, 0xD704)
+DOUBLE_BYTE_PAIR(0xC8D5, 0xD711)
+DOUBLE_BYTE_PAIR(0xC8D6, 0xD718)
+DOUBLE_BYTE_PAIR(0xC8D7, 0xD719)
+DOUBLE_BYTE_PAIR(0xC8D8, 0xD71C)
+DOUBLE_BYTE_PAIR(0xC8D9, 0xD720)
+DOUBLE_BYTE_PAIR(0xC8DA, 0xD728)
+DOUBLE_BYTE_PAIR(0xC8DB, 0xD729)
+DOUBLE_BYTE_PAIR(0xC8DC, 0xD72B)
+DOUBLE_BYTE_PAIR(0xC8DD, 0xD72D)
+DOUBLE_BYTE_PAIR(0xC8DE, 0xD734)
+DOUBLE_BYTE_PAIR(0xC8DF, 0xD735)
+DOUBLE_BYTE_PAIR(0xC8E0, 0xD738)
+DOUBLE_BYTE_PAIR(0xC8E1, 0xD73C)
+DOUBLE_BYTE_PAIR(0xC8E2, 0xD744)
+DOUBLE_BYTE_PAIR(0xC8E3, 0xD747)
+DOUBLE_BYTE_PAIR(0xC8E4, 0xD749)
+DOUBLE_BYTE_PAIR(0xC8E5, 0xD750)
+DOUBLE_BYTE_PAIR(0xC8E6, 0xD751)
+DOUBLE_BYTE_PAIR(0xC8E7, 0xD754)
+DOUBLE_BYTE_PAIR(0xC8E8, 0xD756)
+DOUBLE_BYTE_PAIR(0xC8E9, 0xD757)
+DOUBLE_BYTE_PAIR(0xC8EA, 0xD758)
+DOUBLE_BYTE_PAIR(0xC8EB, 0xD759)
+DOUBLE_BYTE_PAIR(0xC8EC, 0xD760)
+DOUBLE_BYTE_PAIR(0xC8ED, 0xD761)
+DOUBLE_BYTE_PAIR(0xC8EE, 0xD763)
+DOUBLE_BYTE_PAIR(0xC8EF, 0xD765)
+DOUBLE_BYTE_PAIR(0xC8F0, 0xD769)
+DOUBLE_BYTE_PAIR(0xC8F1, 0xD76C)
+DOUBLE_BYTE_PAIR(0xC8F2, 0xD770)
+DOUBLE_BYTE_PAIR(0xC8F3, 0xD774)
+DOUBLE_BYTE_PAIR(0xC8F4, 0xD77C)
+DOUBLE_BYTE_PAIR(0xC8F5, 0xD77D)
+DOUBLE_BYTE_PAIR(0xC8F6, 0xD781)
+DOUBLE_BYTE_PAIR(0xC8F7, 0xD788)
+DOUBLE_BYTE_PAIR(0xC8F8, 0xD789)
+DOUBLE_BYTE_PAIR(0xC8F9, 0xD78C)
+DOUBLE_BYTE_PAIR(0xC8FA, 0xD790)
+DOUBLE_BYTE_PAIR(0xC8FB, 0xD798)
+DOUBLE_BYTE_PAIR(0xC8FC, 0xD799)
+DOUBLE_BYTE_PAIR(0xC8FD, 0xD79B)
+DOUBLE_BYTE_PAIR(0xC8FE, 0xD79D)
+DOUBLE_BYTE_PAIR(0xCAA1, 0x4F3D)
+DOUBLE_BYTE_PAIR(0xCAA2, 0x4F73)
+DOUBLE_BYTE_PAIR(0xCAA3, 0x5047)
+DOUBLE_BYTE_PAIR(0xCAA4, 0x50F9)
+DOUBLE_BYTE_PAIR(0xCAA5, 0x52A0)
+DOUBLE_BYTE_PAIR(0xCAA6, 0x53EF)
+DOUBLE_BYTE_PAIR(0xCAA7, 0x5475)
+DOUBLE_BYTE_PAIR(0xCAA8, 0x54E5)
+DOUBLE_BYTE_PAIR(0xCAA9, 0x5609)
+DOUBLE_BYTE_PAIR(0xCAAA, 0x5AC1)
+DOUBLE_BYTE_PAIR(0xCAAB, 0x5BB6)
+DOUBLE_BYTE_PAIR(0xCAAC, 0x6687)
+DOUBLE_BYTE_PAIR(0xCAAD, 0x67B6)
+DOUBLE_BYTE_PAIR(0xCAAE, 0x67B7)
+DOUBLE_BYTE_PAIR(0xCAAF, 0x67EF)
+DOUBLE_BYTE_PAIR(0xCAB0, 0x6B4C)
+DOUBLE_BYTE_PAIR(0xCAB1, 0x73C2)
+DOUBLE_BYTE_PAIR(0xCAB2, 0x75C2)
+DOUBLE_BYTE_PAIR(0xCAB3, 0x7A3C)
+DOUBLE_BYTE_PAIR(0xCAB4, 0x82DB)
+DOUBLE_BYTE_PAIR(0xCAB5, 0x8304)
+DOUBLE_BYTE_PAIR(0xCAB6, 0x8857)
+DOUBLE_BYTE_PAIR(0xCAB7, 0x8888)
+DOUBLE_BYTE_PAIR(0xCAB8, 0x8A36)
+DOUBLE_BYTE_PAIR(0xCAB9, 0x8CC8)
+DOUBLE_BYTE_PAIR(0xCABA, 0x8DCF)
+DOUBLE_BYTE_PAIR(0xCABB, 0x8EFB)
+DOUBLE_BYTE_PAIR(0xCABC, 0x8FE6)
+DOUBLE_BYTE_PAIR(0xCABD, 0x99D5)
+DOUBLE_BYTE_PAIR(0xCABE, 0x523B)
+DOUBLE_BYTE_PAIR(0xCABF, 0x5374)
+DOUBLE_BYTE_PAIR(0xCAC0, 0x5404)
+DOUBLE_BYTE_PAIR(0xCAC1, 0x606A)
+DOUBLE_BYTE_PAIR(0xCAC2, 0x6164)
+DOUBLE_BYTE_PAIR(0xCAC3, 0x6BBC)
+DOUBLE_BYTE_PAIR(0xCAC4, 0x73CF)
+DOUBLE_BYTE_PAIR(0xCAC5, 0x811A)
+DOUBLE_BYTE_PAIR(0xCAC6, 0x89BA)
+DOUBLE_BYTE_PAIR(0xCAC7, 0x89D2)
+DOUBLE_BYTE_PAIR(0xCAC8, 0x95A3)
+DOUBLE_BYTE_PAIR(0xCAC9, 0x4F83)
+DOUBLE_BYTE_PAIR(0xCACA, 0x520A)
+DOUBLE_BYTE_PAIR(0xCACB, 0x58BE)
+DOUBLE_BYTE_PAIR(0xCACC, 0x5978)
+DOUBLE_BYTE_PAIR(0xCACD, 0x59E6)
+DOUBLE_BYTE_PAIR(0xCACE, 0x5E72)
+DOUBLE_BYTE_PAIR(0xCACF, 0x5E79)
+DOUBLE_BYTE_PAIR(0xCAD0, 0x61C7)
+DOUBLE_BYTE_PAIR(0xCAD1, 0x63C0)
+DOUBLE_BYTE_PAIR(0xCAD2, 0x6746)
+DOUBLE_BYTE_PAIR(0xCAD3, 0x67EC)
+DOUBLE_BYTE_PAIR(0xCAD4, 0x687F)
+DOUBLE_BYTE_PAIR(0xCAD5, 0x6F97)
+DOUBLE_BYTE_PAIR(0xCAD6, 0x764E)
+DOUBLE_BYTE_PAIR(0xCAD7, 0x770B)
+DOUBLE_BYTE_PAIR(0xCAD8, 0x78F5)
+DOUBLE_BYTE_PAIR(0xCAD9, 0x7A08)
+DOUBLE_BYTE_PAIR(0xCADA, 0x7AFF)
+DOUBLE_BYTE_PAIR(0xCADB, 0x7C21)
+DOUBLE_BYTE_PAIR(0xCADC, 0x809D)
+DOUBLE_BYTE_PAIR(0xCADD, 0x826E)
+DOUBLE_BYTE_PAIR(0xCADE, 0x8271)
+DOUBLE_BYTE_PAIR(0xCADF, 0x8AEB)
+DOUBLE_BYTE_PAIR(0xCAE0, 0x9593)
+DOUBLE_BYTE_PAIR(0xCAE1, 0x4E6B)
+DOUBLE_BYTE_PAIR(0xCAE2, 0x559D)
+DOUBLE_BYTE_PAIR(0xCAE3, 0x66F7)
+DOUBLE_BYTE_PAIR(0xCAE4, 0x6E34)
+DOUBLE_BYTE_PAIR(0xCAE5, 0x78A3)
+DOUBLE_BYTE_PAIR(0xCAE6, 0x7AED)
+DOUBLE_BYTE_PAIR(0xCAE7, 0x845B)
+DOUBLE_BYTE_PAIR(0xCAE8, 0x8910)
+DOUBLE_BYTE_PAIR(0xCAE9, 0x874E)
+DOUBLE_BYTE_PAIR(0xCAEA, 0x97A8)
+DOUBLE_BYTE_PAIR(0xCAEB, 0x52D8)
+DOUBLE_BYTE_PAIR(0xCAEC, 0x574E)
+DOUBLE_BYTE_PAIR(0xCAED, 0x582A)
+DOUBLE_BYTE_PAIR(0xCAEE, 0x5D4C)
+DOUBLE_BYTE_PAIR(0xCAEF, 0x611F)
+DOUBLE_BYTE_PAIR(0xCAF0, 0x61BE)
+DOUBLE_BYTE_PAIR(0xCAF1, 0x6221)
+DOUBLE_BYTE_PAIR(0xCAF2, 0x6562)
+DOUBLE_BYTE_PAIR(0xCAF3, 0x67D1)
+DOUBLE_BYTE_PAIR(0xCAF4, 0x6A44)
+DOUBLE_BYTE_PAIR(0xCAF5, 0x6E1B)
+DOUBLE_BYTE_PAIR(0xCAF6, 0x7518)
+DOUBLE_BYTE_PAIR(0xCAF7, 0x75B3)
+DOUBLE_BYTE_PAIR(0xCAF8, 0x76E3)
+DOUBLE_BYTE_PAIR(0xCAF9, 0x77B0)
+DOUBLE_BYTE_PAIR(0xCAFA, 0x7D3A)
+DOUBLE_BYTE_PAIR(0xCAFB, 0x90AF)
+DOUBLE_BYTE_PAIR(0xCAFC, 0x9451)
+DOUBLE_BYTE_PAIR(0xCAFD, 0x9452)
+DOUBLE_BYTE_PAIR(0xCAFE, 0x9F95)
+DOUBLE_BYTE_PAIR(0xCBA1, 0x5323)
+DOUBLE_BYTE_PAIR(0xCBA2, 0x5CAC)
+DOUBLE_BYTE_PAIR(0xCBA3, 0x7532)
+DOUBLE_BYTE_PAIR(0xCBA4, 0x80DB)
+DOUBLE_BYTE_PAIR(0xCBA5, 0x9240)
+DOUBLE_BYTE_PAIR(0xCBA6, 0x9598)
+DOUBLE_BYTE_PAIR(0xCBA7, 0x525B)
+DOUBLE_BYTE_PAIR(0xCBA8, 0x5808)
+DOUBLE_BYTE_PAIR(0xCBA9, 0x59DC)
+DOUBLE_BYTE_PAIR(0xCBAA, 0x5CA1)
+DOUBLE_BYTE_PAIR(0xCBAB, 0x5D17)
+DOUBLE_BYTE_PAIR(0xCBAC, 0x5EB7)
+DOUBLE_BYTE_PAIR(0xCBAD, 0x5F3A)
+DOUBLE_BYTE_PAIR(0xCBAE, 0x5F4A)
+DOUBLE_BYTE_PAIR(0xCBAF, 0x6177)
+DOUBLE_BYTE_PAIR(0xCBB0, 0x6C5F)
+DOUBLE_BYTE_PAIR(0xCBB1, 0x757A)
+DOUBLE_BYTE_PAIR(0xCBB2, 0x7586)
+DOUBLE_BYTE_PAIR(0xCBB3, 0x7CE0)
+DOUBLE_BYTE_PAIR(0xCBB4, 0x7D73)
+DOUBLE_BYTE_PAIR(0xCBB5, 0x7DB1)
+DOUBLE_BYTE_PAIR(0xCBB6, 0x7F8C)
+DOUBLE_BYTE_PAIR(0xCBB7, 0x8154)
+DOUBLE_BYTE_PAIR(0xCBB8, 0x8221)
+DOUBLE_BYTE_PAIR(0xCBB9, 0x8591)
+DOUBLE_BYTE_PAIR(0xCBBA, 0x8941)
+DOUBLE_BYTE_PAIR(0xCBBB, 0x8B1B)
+DOUBLE_BYTE_PAIR(0xCBBC, 0x92FC)
+DOUBLE_BYTE_PAIR(0xCBBD, 0x964D)
+DOUBLE_BYTE_PAIR(0xCBBE, 0x9C47)
+DOUBLE_BYTE_PAIR(0xCBBF, 0x4ECB)
+DOUBLE_BYTE_PAIR(0xCBC0, 0x4EF7)
+DOUBLE_BYTE_PAIR(0xCBC1, 0x500B)
+DOUBLE_BYTE_PAIR(0xCBC2, 0x51F1)
+DOUBLE_BYTE_PAIR(0xCBC3, 0x584F)
+DOUBLE_BYTE_PAIR(0xCBC4, 0x6137)
+DOUBLE_BYTE_PAIR(0xCBC5, 0x613E)
+DOUBLE_BYTE_PAIR(0xCBC6, 0x6168)
+DOUBLE_BYTE_PAIR(0xCBC7, 0x6539)
+DOUBLE_BYTE_PAIR(0xCBC8, 0x69EA)
+DOUBLE_BYTE_PAIR(0xCBC9, 0x6F11)
+DOUBLE_BYTE_PAIR(0xCBCA, 0x75A5)
+DOUBLE_BYTE_PAIR(0xCBCB, 0x7686)
+DOUBLE_BYTE_PAIR(0xCBCC, 0x76D6)
+DOUBLE_BYTE_PAIR(0xCBCD, 0x7B87)
+DOUBLE_BYTE_PAIR(0xCBCE, 0x82A5)
+DOUBLE_BYTE_PAIR(0xCBCF, 0x84CB)
+DOUBLE_BYTE_PAIR(0xCBD0, 0xF900)
+DOUBLE_BYTE_PAIR(0xCBD1, 0x93A7)
+DOUBLE_BYTE_PAIR(0xCBD2, 0x958B)
+DOUBLE_BYTE_PAIR(0xCBD3, 0x5580)
+DOUBLE_BYTE_PAIR(0xCBD4, 0x5BA2)
+DOUBLE_BYTE_PAIR(0xCBD5, 0x5751)
+DOUBLE_BYTE_PAIR(0xCBD6, 0xF901)
+DOUBLE_BYTE_PAIR(0xCBD7, 0x7CB3)
+DOUBLE_BYTE_PAIR(0xCBD8, 0x7FB9)
+DOUBLE_BYTE_PAIR(0xCBD9, 0x91B5)
+DOUBLE_BYTE_PAIR(0xCBDA, 0x5028)
+DOUBLE_BYTE_PAIR(0xCBDB, 0x53BB)
+DOUBLE_BYTE_PAIR(0xCBDC, 0x5C45)
+DOUBLE_BYTE_PAIR(0xCBDD, 0x5DE8)
+DOUBLE_BYTE_PAIR(0xCBDE, 0x62D2)
+DOUBLE_BYTE_PAIR(0xCBDF, 0x636E)
+DOUBLE_BYTE_PAIR(0xCBE0, 0x64DA)
+DOUBLE_BYTE_PAIR(0xCBE1, 0x64E7)
+DOUBLE_BYTE_PAIR(0xCBE2, 0x6E20)
+DOUBLE_BYTE_PAIR(0xCBE3, 0x70AC)
+DOUBLE_BYTE_PAIR(0xCBE4, 0x795B)
+DOUBLE_BYTE_PAIR(0xCBE5, 0x8DDD)
+DOUBLE_BYTE_PAIR(0xCBE6, 0x8E1E)
+DOUBLE_BYTE_PAIR(0xCBE7, 0xF902)
+DOUBLE_BYTE_PAIR(0xCBE8, 0x907D)
+DOUBLE_BYTE_PAIR(0xCBE9, 0x9245)
+DOUBLE_BYTE_PAIR(0xCBEA, 0x92F8)
+DOUBLE_BYTE_PAIR(0xCBEB, 0x4E7E)
+DOUBLE_BYTE_PAIR(0xCBEC, 0x4EF6)
+DOUBLE_BYTE_PAIR(0xCBED, 0x5065)
+DOUBLE_BYTE_PAIR(0xCBEE, 0x5DFE)
+DOUBLE_BYTE_PAIR(0xCBEF, 0x5EFA)
+DOUBLE_BYTE_PAIR(0xCBF0, 0x6106)
+DOUBLE_BYTE_PAIR(0xCBF1, 0x6957)
+DOUBLE_BYTE_PAIR(0xCBF2, 0x8171)
+DOUBLE_BYTE_PAIR(0xCBF3, 0x8654)
+DOUBLE_BYTE_PAIR(0xCBF4, 0x8E47)
+DOUBLE_BYTE_PAIR(0xCBF5, 0x9375)
+DOUBLE_BYTE_PAIR(0xCBF6, 0x9A2B)
+DOUBLE_BYTE_PAIR(0xCBF7, 0x4E5E)
+DOUBLE_BYTE_PAIR(0xCBF8, 0x5091)
+DOUBLE_BYTE_PAIR(0xCBF9, 0x6770)
+DOUBLE_BYTE_PAIR(0xCBFA, 0x6840)
+DOUBLE_BYTE_PAIR(0xCBFB, 0x5109)
+DOUBLE_BYTE_PAIR(0xCBFC, 0x528D)
+DOUBLE_BYTE_PAIR(0xCBFD, 0x5292)
+DOUBLE_BYTE_PAIR(0xCBFE, 0x6AA2)
+DOUBLE_BYTE_PAIR(0xCCA1, 0x77BC)
+DOUBLE_BYTE_PAIR(0xCCA2, 0x9210)
+DOUBLE_BYTE_PAIR(0xCCA3, 0x9ED4)
+DOUBLE_BYTE_PAIR(0xCCA4, 0x52AB)
+DOUBLE_BYTE_PAIR(0xCCA5, 0x602F)
+DOUBLE_BYTE_PAIR(0xCCA6, 0x8FF2)
+DOUBLE_BYTE_PAIR(0xCCA7, 0x5048)
+DOUBLE_BYTE_PAIR(0xCCA8, 0x61A9)
+DOUBLE_BYTE_PAIR(0xCCA9, 0x63ED)
+DOUBLE_BYTE_PAIR(0xCCAA, 0x64CA)
+DOUBLE_BYTE_PAIR(0xCCAB, 0x683C)
+DOUBLE_BYTE_PAIR(0xCCAC, 0x6A84)
+DOUBLE_BYTE_PAIR(0xCCAD, 0x6FC0)
+DOUBLE_BYTE_PAIR(0xCCAE, 0x8188)
+DOUBLE_BYTE_PAIR(0xCCAF, 0x89A1)
+DOUBLE_BYTE_PAIR(0xCCB0, 0x9694)
+DOUBLE_BYTE_PAIR(0xCCB1, 0x5805)
+DOUBLE_BYTE_PAIR(0xCCB2, 0x727D)
+DOUBLE_BYTE_PAIR(0xCCB3, 0x72AC)
+DOUBLE_BYTE_PAIR(0xCCB4, 0x7504)
+DOUBLE_BYTE_PAIR(0xCCB5, 0x7D79)
+DOUBLE_BYTE_PAIR(0xCCB6, 0x7E6D)
+DOUBLE_BYTE_PAIR(0xCCB7, 0x80A9)
+DOUBLE_BYTE_PAIR(0xCCB8, 0x898B)
+DOUBLE_BYTE_PAIR(0xCCB9, 0x8B74)
+DOUBLE_BYTE_PAIR(0xCCBA, 0x9063)
+DOUBLE_BYTE_PAIR(0xCCBB, 0x9D51)
+DOUBLE_BYTE_PAIR(0xCCBC, 0x6289)
+DOUBLE_BYTE_PAIR(0xCCBD, 0x6C7A)
+DOUBLE_BYTE_PAIR(0xCCBE, 0x6F54)
+DOUBLE_BYTE_PAIR(0xCCBF, 0x7D50)
+DOUBLE_BYTE_PAIR(0xCCC0, 0x7F3A)
+DOUBLE_BYTE_PAIR(0xCCC1, 0x8A23)
+DOUBLE_BYTE_PAIR(0xCCC2, 0x517C)
+DOUBLE_BYTE_PAIR(0xCCC3, 0x614A)
+DOUBLE_BYTE_PAIR(0xCCC4, 0x7B9D)
+DOUBLE_BYTE_PAIR(0xCCC5, 0x8B19)
+DOUBLE_BYTE_PAIR(0xCCC6, 0x9257)
+DOUBLE_BYTE_PAIR(0xCCC7, 0x938C)
+DOUBLE_BYTE_PAIR(0xCCC8, 0x4EAC)
+DOUBLE_BYTE_PAIR(0xCCC9, 0x4FD3)
+DOUBLE_BYTE_PAIR(0xCCCA, 0x501E)
+DOUBLE_BYTE_PAIR(0xCCCB, 0x50BE)
+DOUBLE_BYTE_PAIR(0xCCCC, 0x5106)
+DOUBLE_BYTE_PAIR(0xCCCD, 0x52C1)
+DOUBLE_BYTE_PAIR(0xCCCE, 0x52CD)
+DOUBLE_BYTE_PAIR(0xCCCF, 0x537F)
+DOUBLE_BYTE_PAIR(0xCCD0, 0x5770)
+DOUBLE_BYTE_PAIR(0xCCD1, 0x5883)
+DOUBLE_BYTE_PAIR(0xCCD2, 0x5E9A)
+DOUBLE_BYTE_PAIR(0xCCD3, 0x5F91)
+DOUBLE_BYTE_PAIR(0xCCD4, 0x6176)
+DOUBLE_BYTE_PAIR(0xCCD5, 0x61AC)
+DOUBLE_BYTE_PAIR(0xCCD6, 0x64CE)
+DOUBLE_BYTE_PAIR(0xCCD7, 0x656C)
+DOUBLE_BYTE_PAIR(0xCCD8, 0x666F)
+DOUBLE_BYTE_PAIR(0xCCD9, 0x66BB)
+DOUBLE_BYTE_PAIR(0xCCDA, 0x66F4)
+DOUBLE_BYTE_PAIR(0xCCDB, 0x6897)
+DOUBLE_BYTE_PAIR(0xCCDC, 0x6D87)
+DOUBLE_BYTE_PAIR(0xCCDD, 0x7085)
+DOUBLE_BYTE_PAIR(0xCCDE, 0x70F1)
+DOUBLE_BYTE_PAIR(0xCCDF, 0x749F)
+DOUBLE_BYTE_PAIR(0xCCE0, 0x74A5)
+DOUBLE_BYTE_PAIR(0xCCE1, 0x74CA)
+DOUBLE_BYTE_PAIR(0xCCE2, 0x75D9)
+DOUBLE_BYTE_PAIR(0xCCE3, 0x786C)
+DOUBLE_BYTE_PAIR(0xCCE4, 0x78EC)
+DOUBLE_BYTE_PAIR(0xCCE5, 0x7ADF)
+DOUBLE_BYTE_PAIR(0xCCE6, 0x7AF6)
+DOUBLE_BYTE_PAIR(0xCCE7, 0x7D45)
+DOUBLE_BYTE_PAIR(0xCCE8, 0x7D93)
+DOUBLE_BYTE_PAIR(0xCCE9, 0x8015)
+DOUBLE_BYTE_PAIR(0xCCEA, 0x803F)
+DOUBLE_BYTE_PAIR(0xCCEB, 0x811B)
+DOUBLE_BYTE_PAIR(0xCCEC, 0x8396)
+DOUBLE_BYTE_PAIR(0xCCED, 0x8B66)
+DOUBLE_BYTE_PAIR(0xCCEE, 0x8F15)
+DOUBLE_BYTE_PAIR(0xCCEF, 0x9015)
+DOUBLE_BYTE_PAIR(0xCCF0, 0x93E1)
+DOUBLE_BYTE_PAIR(0xCCF1, 0x9803)
+DOUBLE_BYTE_PAIR(0xCCF2, 0x9838)
+DOUBLE_BYTE_PAIR(0xCCF3, 0x9A5A)
+DOUBLE_BYTE_PAIR(0xCCF4, 0x9BE8)
+DOUBLE_BYTE_PAIR(0xCCF5, 0x4FC2)
+DOUBLE_BYTE_PAIR(0xCCF6, 0x5553)
+DOUBLE_BYTE_PAIR(0xCCF7, 0x583A)
+DOUBLE_BYTE_PAIR(0xCCF8, 0x5951)
+DOUBLE_BYTE_PAIR(0xCCF9, 0x5B63)
+DOUBLE_BYTE_PAIR(0xCCFA, 0x5C46)
+DOUBLE_BYTE_PAIR(0xCCFB, 0x60B8)
+DOUBLE_BYTE_PAIR(0xCCFC, 0x6212)
+DOUBLE_BYTE_PAIR(0xCCFD, 0x6842)
+DOUBLE_BYTE_PAIR(0xCCFE, 0x68B0)
+DOUBLE_BYTE_PAIR(0xCDA1, 0x68E8)
+DOUBLE_BYTE_PAIR(0xCDA2, 0x6EAA)
+DOUBLE_BYTE_PAIR(0xCDA3, 0x754C)
+DOUBLE_BYTE_PAIR(0xCDA4, 0x7678)
+DOUBLE_BYTE_PAIR(0xCDA5, 0x78CE)
+DOUBLE_BYTE_PAIR(0xCDA6, 0x7A3D)
+DOUBLE_BYTE_PAIR(0xCDA7, 0x7CFB)
+DOUBLE_BYTE_PAIR(0xCDA8, 0x7E6B)
+DOUBLE_BYTE_PAIR(0xCDA9, 0x7E7C)
+DOUBLE_BYTE_PAIR(0xCDAA, 0x8A08)
+DOUBLE_BYTE_PAIR(0xCDAB, 0x8AA1)
+DOUBLE_BYTE_PAIR(0xCDAC, 0x8C3F)
+DOUBLE_BYTE_PAIR(0xCDAD, 0x968E)
+DOUBLE_BYTE_PAIR(0xCDAE, 0x9DC4)
+DOUBLE_BYTE_PAIR(0xCDAF, 0x53E4)
+DOUBLE_BYTE_PAIR(0xCDB0, 0x53E9)
+DOUBLE_BYTE_PAIR(0xCDB1, 0x544A)
+DOUBLE_BYTE_PAIR(0xCDB2, 0x5471)
+DOUBLE_BYTE_PAIR(0xCDB3, 0x56FA)
+DOUBLE_BYTE_PAIR(0xCDB4, 0x59D1)
+DOUBLE_BYTE_PAIR(0xCDB5, 0x5B64)
+DOUBLE_BYTE_PAIR(0xCDB6, 0x5C3B)
+DOUBLE_BYTE_PAIR(0xCDB7, 0x5EAB)
+DOUBLE_BYTE_PAIR(0xCDB8, 0x62F7)
+DOUBLE_BYTE_PAIR(0xCDB9, 0x6537)
+DOUBLE_BYTE_PAIR(0xCDBA, 0x6545)
+DOUBLE_BYTE_PAIR(0xCDBB, 0x6572)
+DOUBLE_BYTE_PAIR(0xCDBC, 0x66A0)
+DOUBLE_BYTE_PAIR(0xCDBD, 0x67AF)
+DOUBLE_BYTE_PAIR(0xCDBE, 0x69C1)
+DOUBLE_BYTE_PAIR(0xCDBF, 0x6CBD)
+DOUBLE_BYTE_PAIR(0xCDC0, 0x75FC)
+DOUBLE_BYTE_PAIR(0xCDC1, 0x7690)
+DOUBLE_BYTE_PAIR(0xCDC2, 0x777E)
+DOUBLE_BYTE_PAIR(0xCDC3, 0x7A3F)
+DOUBLE_BYTE_PAIR(0xCDC4, 0x7F94)
+DOUBLE_BYTE_PAIR(0xCDC5, 0x8003)
+DOUBLE_BYTE_PAIR(0xCDC6, 0x80A1)
+DOUBLE_BYTE_PAIR(0xCDC7, 0x818F)
+DOUBLE_BYTE_PAIR(0xCDC8, 0x82E6)
+DOUBLE_BYTE_PAIR(0xCDC9, 0x82FD)
+DOUBLE_BYTE_PAIR(0xCDCA, 0x83F0)
+DOUBLE_BYTE_PAIR(0xCDCB, 0x85C1)
+DOUBLE_BYTE_PAIR(0xCDCC, 0x8831)
+DOUBLE_BYTE_PAIR(0xCDCD, 0x88B4)
+DOUBLE_BYTE_PAIR(0xCDCE, 0x8AA5)
+DOUBLE_BYTE_PAIR(0xCDCF, 0xF903)
+DOUBLE_BYTE_PAIR(0xCDD0, 0x8F9C)
+DOUBLE_BYTE_PAIR(0xCDD1, 0x932E)
+DOUBLE_BYTE_PAIR(0xCDD2, 0x96C7)
+DOUBLE_BYTE_PAIR(0xCDD3, 0x9867)
+DOUBLE_BYTE_PAIR(0xCDD4, 0x9AD8)
+DOUBLE_BYTE_PAIR(0xCDD5, 0x9F13)
+DOUBLE_BYTE_PAIR(0xCDD6, 0x54ED)
+DOUBLE_BYTE_PAIR(0xCDD7, 0x659B)
+DOUBLE_BYTE_PAIR(0xCDD8, 0x66F2)
+DOUBLE_BYTE_PAIR(0xCDD9, 0x688F)
+DOUBLE_BYTE_PAIR(0xCDDA, 0x7A40)
+DOUBLE_BYTE_PAIR(0xCDDB, 0x8C37)
+DOUBLE_BYTE_PAIR(0xCDDC, 0x9D60)
+DOUBLE_BYTE_PAIR(0xCDDD, 0x56F0)
+DOUBLE_BYTE_PAIR(0xCDDE, 0x5764)
+DOUBLE_BYTE_PAIR(0xCDDF, 0x5D11)
+DOUBLE_BYTE_PAIR(0xCDE0, 0x6606)
+DOUBLE_BYTE_PAIR(0xCDE1, 0x68B1)
+DOUBLE_BYTE_PAIR(0xCDE2, 0x68CD)
+DOUBLE_BYTE_PAIR(0xCDE3, 0x6EFE)
+DOUBLE_BYTE_PAIR(0xCDE4, 0x7428)
+DOUBLE_BYTE_PAIR(0xCDE5, 0x889E)
+DOUBLE_BYTE_PAIR(0xCDE6, 0x9BE4)
+DOUBLE_BYTE_PAIR(0xCDE7, 0x6C68)
+DOUBLE_BYTE_PAIR(0xCDE8, 0xF904)
+DOUBLE_BYTE_PAIR(0xCDE9, 0x9AA8)
+DOUBLE_BYTE_PAIR(0xCDEA, 0x4F9B)
+DOUBLE_BYTE_PAIR(0xCDEB, 0x516C)
+DOUBLE_BYTE_PAIR(0xCDEC, 0x5171)
+DOUBLE_BYTE_PAIR(0xCDED, 0x529F)
+DOUBLE_BYTE_PAIR(0xCDEE, 0x5B54)
+DOUBLE_BYTE_PAIR(0xCDEF, 0x5DE5)
+DOUBLE_BYTE_PAIR(0xCDF0, 0x6050)
+DOUBLE_BYTE_PAIR(0xCDF1, 0x606D)
+DOUBLE_BYTE_PAIR(0xCDF2, 0x62F1)
+DOUBLE_BYTE_PAIR(0xCDF3, 0x63A7)
+DOUBLE_BYTE_PAIR(0xCDF4, 0x653B)
+DOUBLE_BYTE_PAIR(0xCDF5, 0x73D9)
+DOUBLE_BYTE_PAIR(0xCDF6, 0x7A7A)
+DOUBLE_BYTE_PAIR(0xCDF7, 0x86A3)
+DOUBLE_BYTE_PAIR(0xCDF8, 0x8CA2)
+DOUBLE_BYTE_PAIR(0xCDF9, 0x978F)
+DOUBLE_BYTE_PAIR(0xCDFA, 0x4E32)
+DOUBLE_BYTE_PAIR(0xCDFB, 0x5BE1)
+DOUBLE_BYTE_PAIR(0xCDFC, 0x6208)
+DOUBLE_BYTE_PAIR(0xCDFD, 0x679C)
+DOUBLE_BYTE_PAIR(0xCDFE, 0x74DC)
+DOUBLE_BYTE_PAIR(0xCEA1, 0x79D1)
+DOUBLE_BYTE_PAIR(0xCEA2, 0x83D3)
+DOUBLE_BYTE_PAIR(0xCEA3, 0x8A87)
+DOUBLE_BYTE_PAIR(0xCEA4, 0x8AB2)
+DOUBLE_BYTE_PAIR(0xCEA5, 0x8DE8)
+DOUBLE_BYTE_PAIR(0xCEA6, 0x904E)
+DOUBLE_BYTE_PAIR(0xCEA7, 0x934B)
+DOUBLE_BYTE_PAIR(0xCEA8, 0x9846)
+DOUBLE_BYTE_PAIR(0xCEA9, 0x5ED3)
+DOUBLE_BYTE_PAIR(0xCEAA, 0x69E8)
+DOUBLE_BYTE_PAIR(0xCEAB, 0x85FF)
+DOUBLE_BYTE_PAIR(0xCEAC, 0x90ED)
+DOUBLE_BYTE_PAIR(0xCEAD, 0xF905)
+DOUBLE_BYTE_PAIR(0xCEAE, 0x51A0)
+DOUBLE_BYTE_PAIR(0xCEAF, 0x5B98)
+DOUBLE_BYTE_PAIR(0xCEB0, 0x5BEC)
+DOUBLE_BYTE_PAIR(0xCEB1, 0x6163)
+DOUBLE_BYTE_PAIR(0xCEB2, 0x68FA)
+DOUBLE_BYTE_PAIR(0xCEB3, 0x6B3E)
+DOUBLE_BYTE_PAIR(0xCEB4, 0x704C)
+DOUBLE_BYTE_PAIR(0xCEB5, 0x742F)
+DOUBLE_BYTE_PAIR(0xCEB6, 0x74D8)
+DOUBLE_BYTE_PAIR(0xCEB7, 0x7BA1)
+DOUBLE_BYTE_PAIR(0xCEB8, 0x7F50)
+DOUBLE_BYTE_PAIR(0xCEB9, 0x83C5)
+DOUBLE_BYTE_PAIR(0xCEBA, 0x89C0)
+DOUBLE_BYTE_PAIR(0xCEBB, 0x8CAB)
+DOUBLE_BYTE_PAIR(0xCEBC, 0x95DC)
+DOUBLE_BYTE_PAIR(0xCEBD, 0x9928)
+DOUBLE_BYTE_PAIR(0xCEBE, 0x522E)
+DOUBLE_BYTE_PAIR(0xCEBF, 0x605D)
+DOUBLE_BYTE_PAIR(0xCEC0, 0x62EC)
+DOUBLE_BYTE_PAIR(0xCEC1, 0x9002)
+DOUBLE_BYTE_PAIR(0xCEC2, 0x4F8A)
+DOUBLE_BYTE_PAIR(0xCEC3, 0x5149)
+DOUBLE_BYTE_PAIR(0xCEC4, 0x5321)
+DOUBLE_BYTE_PAIR(0xCEC5, 0x58D9)
+DOUBLE_BYTE_PAIR(0xCEC6, 0x5EE3)
+DOUBLE_BYTE_PAIR(0xCEC7, 0x66E0)
+DOUBLE_BYTE_PAIR(0xCEC8, 0x6D38)
+DOUBLE_BYTE_PAIR(0xCEC9, 0x709A)
+DOUBLE_BYTE_PAIR(0xCECA, 0x72C2)
+DOUBLE_BYTE_PAIR(0xCECB, 0x73D6)
+DOUBLE_BYTE_PAIR(0xCECC, 0x7B50)
+DOUBLE_BYTE_PAIR(0xCECD, 0x80F1)
+DOUBLE_BYTE_PAIR(0xCECE, 0x945B)
+DOUBLE_BYTE_PAIR(0xCECF, 0x5366)
+DOUBLE_BYTE_PAIR(0xCED0, 0x639B)
+DOUBLE_BYTE_PAIR(0xCED1, 0x7F6B)
+DOUBLE_BYTE_PAIR(0xCED2, 0x4E56)
+DOUBLE_BYTE_PAIR(0xCED3, 0x5080)
+DOUBLE_BYTE_PAIR(0xCED4, 0x584A)
+DOUBLE_BYTE_PAIR(0xCED5, 0x58DE)
+DOUBLE_BYTE_PAIR(0xCED6, 0x602A)
+DOUBLE_BYTE_PAIR(0xCED7, 0x6127)
+DOUBLE_BYTE_PAIR(0xCED8, 0x62D0)
+DOUBLE_BYTE_PAIR(0xCED9, 0x69D0)
+DOUBLE_BYTE_PAIR(0xCEDA, 0x9B41)
+DOUBLE_BYTE_PAIR(0xCEDB, 0x5B8F)
+DOUBLE_BYTE_PAIR(0xCEDC, 0x7D18)
+DOUBLE_BYTE_PAIR(0xCEDD, 0x80B1)
+DOUBLE_BYTE_PAIR(0xCEDE, 0x8F5F)
+DOUBLE_BYTE_PAIR(0xCEDF, 0x4EA4)
+DOUBLE_BYTE_PAIR(0xCEE0, 0x50D1)
+DOUBLE_BYTE_PAIR(0xCEE1, 0x54AC)
+DOUBLE_BYTE_PAIR(0xCEE2, 0x55AC)
+DOUBLE_BYTE_PAIR(0xCEE3, 0x5B0C)
+DOUBLE_BYTE_PAIR(0xCEE4, 0x5DA0)
+DOUBLE_BYTE_PAIR(0xCEE5, 0x5DE7)
+DOUBLE_BYTE_PAIR(0xCEE6, 0x652A)
+DOUBLE_BYTE_PAIR(0xCEE7, 0x654E)
+DOUBLE_BYTE_PAIR(0xCEE8, 0x6821)
+DOUBLE_BYTE_PAIR(0xCEE9, 0x6A4B)
+DOUBLE_BYTE_PAIR(0xCEEA, 0x72E1)
+DOUBLE_BYTE_PAIR(0xCEEB, 0x768E)
+DOUBLE_BYTE_PAIR(0xCEEC, 0x77EF)
+DOUBLE_BYTE_PAIR(0xCEED, 0x7D5E)
+DOUBLE_BYTE_PAIR(0xCEEE, 0x7FF9)
+DOUBLE_BYTE_PAIR(0xCEEF, 0x81A0)
+DOUBLE_BYTE_PAIR(0xCEF0, 0x854E)
+DOUBLE_BYTE_PAIR(0xCEF1, 0x86DF)
+DOUBLE_BYTE_PAIR(0xCEF2, 0x8F03)
+DOUBLE_BYTE_PAIR(0xCEF3, 0x8F4E)
+DOUBLE_BYTE_PAIR(0xCEF4, 0x90CA)
+DOUBLE_BYTE_PAIR(0xCEF5, 0x9903)
+DOUBLE_BYTE_PAIR(0xCEF6, 0x9A55)
+DOUBLE_BYTE_PAIR(0xCEF7, 0x9BAB)
+DOUBLE_BYTE_PAIR(0xCEF8, 0x4E18)
+DOUBLE_BYTE_PAIR(0xCEF9, 0x4E45)
+DOUBLE_BYTE_PAIR(0xCEFA, 0x4E5D)
+DOUBLE_BYTE_PAIR(0xCEFB, 0x4EC7)
+DOUBLE_BYTE_PAIR(0xCEFC, 0x4FF1)
+DOUBLE_BYTE_PAIR(0xCEFD, 0x5177)
+DOUBLE_BYTE_PAIR(0xCEFE, 0x52FE)
+DOUBLE_BYTE_PAIR(0xCFA1, 0x5340)
+DOUBLE_BYTE_PAIR(0xCFA2, 0x53E3)
+DOUBLE_BYTE_PAIR(0xCFA3, 0x53E5)
+DOUBLE_BYTE_PAIR(0xCFA4, 0x548E)
+DOUBLE_BYTE_PAIR(0xCFA5, 0x5614)
+DOUBLE_BYTE_PAIR(0xCFA6, 0x5775)
+DOUBLE_BYTE_PAIR(0xCFA7, 0x57A2)
+DOUBLE_BYTE_PAIR(0xCFA8, 0x5BC7)
+DOUBLE_BYTE_PAIR(0xCFA9, 0x5D87)
+DOUBLE_BYTE_PAIR(0xCFAA, 0x5ED0)
+DOUBLE_BYTE_PAIR(0xCFAB, 0x61FC)
+DOUBLE_BYTE_PAIR(0xCFAC, 0x62D8)
+DOUBLE_BYTE_PAIR(0xCFAD, 0x6551)
+DOUBLE_BYTE_PAIR(0xCFAE, 0x67B8)
+DOUBLE_BYTE_PAIR(0xCFAF, 0x67E9)
+DOUBLE_BYTE_PAIR(0xCFB0, 0x69CB)
+DOUBLE_BYTE_PAIR(0xCFB1, 0x6B50)
+DOUBLE_BYTE_PAIR(0xCFB2, 0x6BC6)
+DOUBLE_BYTE_PAIR(0xCFB3, 0x6BEC)
+DOUBLE_BYTE_PAIR(0xCFB4, 0x6C42)
+DOUBLE_BYTE_PAIR(0xCFB5, 0x6E9D)
+DOUBLE_BYTE_PAIR(0xCFB6, 0x7078)
+DOUBLE_BYTE_PAIR(0xCFB7, 0x72D7)
+DOUBLE_BYTE_PAIR(0xCFB8, 0x7396)
+DOUBLE_BYTE_PAIR(0xCFB9, 0x7403)
+DOUBLE_BYTE_PAIR(0xCFBA, 0x77BF)
+DOUBLE_BYTE_PAIR(0xCFBB, 0x77E9)
+DOUBLE_BYTE_PAIR(0xCFBC, 0x7A76)
+DOUBLE_BYTE_PAIR(0xCFBD, 0x7D7F)
+DOUBLE_BYTE_PAIR(0xCFBE, 0x8009)
+DOUBLE_BYTE_PAIR(0xCFBF, 0x81FC)
+DOUBLE_BYTE_PAIR(0xCFC0, 0x8205)
+DOUBLE_BYTE_PAIR(0xCFC1, 0x820A)
+DOUBLE_BYTE_PAIR(0xCFC2, 0x82DF)
+DOUBLE_BYTE_PAIR(0xCFC3, 0x8862)
+DOUBLE_BYTE_PAIR(0xCFC4, 0x8B33)
+DOUBLE_BYTE_PAIR(0xCFC5, 0x8CFC)
+DOUBLE_BYTE_PAIR(0xCFC6, 0x8EC0)
+DOUBLE_BYTE_PAIR(0xCFC7, 0x9011)
+DOUBLE_BYTE_PAIR(0xCFC8, 0x90B1)
+DOUBLE_BYTE_PAIR(0xCFC9, 0x9264)
+DOUBLE_BYTE_PAIR(0xCFCA, 0x92B6)
+DOUBLE_BYTE_PAIR(0xCFCB, 0x99D2)
+DOUBLE_BYTE_PAIR(0xCFCC, 0x9A45)
+DOUBLE_BYTE_PAIR(0xCFCD, 0x9CE9)
+DOUBLE_BYTE_PAIR(0xCFCE, 0x9DD7)
+DOUBLE_BYTE_PAIR(0xCFCF, 0x9F9C)
+DOUBLE_BYTE_PAIR(0xCFD0, 0x570B)
+DOUBLE_BYTE_PAIR(0xCFD1, 0x5C40)
+DOUBLE_BYTE_PAIR(0xCFD2, 0x83CA)
+DOUBLE_BYTE_PAIR(0xCFD3, 0x97A0)
+DOUBLE_BYTE_PAIR(0xCFD4, 0x97AB)
+DOUBLE_BYTE_PAIR(0xCFD5, 0x9EB4)
+DOUBLE_BYTE_PAIR(0xCFD6, 0x541B)
+DOUBLE_BYTE_PAIR(0xCFD7, 0x7A98)
+DOUBLE_BYTE_PAIR(0xCFD8, 0x7FA4)
+DOUBLE_BYTE_PAIR(0xCFD9, 0x88D9)
+DOUBLE_BYTE_PAIR(0xCFDA, 0x8ECD)
+DOUBLE_BYTE_PAIR(0xCFDB, 0x90E1)
+DOUBLE_BYTE_PAIR(0xCFDC, 0x5800)
+DOUBLE_BYTE_PAIR(0xCFDD, 0x5C48)
+DOUBLE_BYTE_PAIR(0xCFDE, 0x6398)
+DOUBLE_BYTE_PAIR(0xCFDF, 0x7A9F)
+DOUBLE_BYTE_PAIR(0xCFE0, 0x5BAE)
+DOUBLE_BYTE_PAIR(0xCFE1, 0x5F13)
+DOUBLE_BYTE_PAIR(0xCFE2, 0x7A79)
+DOUBLE_BYTE_PAIR(0xCFE3, 0x7AAE)
+DOUBLE_BYTE_PAIR(0xCFE4, 0x828E)
+DOUBLE_BYTE_PAIR(0xCFE5, 0x8EAC)
+DOUBLE_BYTE_PAIR(0xCFE6, 0x5026)
+DOUBLE_BYTE_PAIR(0xCFE7, 0x5238)
+DOUBLE_BYTE_PAIR(0xCFE8, 0x52F8)
+DOUBLE_BYTE_PAIR(0xCFE9, 0x5377)
+DOUBLE_BYTE_PAIR(0xCFEA, 0x5708)
+DOUBLE_BYTE_PAIR(0xCFEB, 0x62F3)
+DOUBLE_BYTE_PAIR(0xCFEC, 0x6372)
+DOUBLE_BYTE_PAIR(0xCFED, 0x6B0A)
+DOUBLE_BYTE_PAIR(0xCFEE, 0x6DC3)
+DOUBLE_BYTE_PAIR(0xCFEF, 0x7737)
+DOUBLE_BYTE_PAIR(0xCFF0, 0x53A5)
+DOUBLE_BYTE_PAIR(0xCFF1, 0x7357)
+DOUBLE_BYTE_PAIR(0xCFF2, 0x8568)
+DOUBLE_BYTE_PAIR(0xCFF3, 0x8E76)
+DOUBLE_BYTE_PAIR(0xCFF4, 0x95D5)
+DOUBLE_BYTE_PAIR(0xCFF5, 0x673A)
+DOUBLE_BYTE_PAIR(0xCFF6, 0x6AC3)
+DOUBLE_BYTE_PAIR(0xCFF7, 0x6F70)
+DOUBLE_BYTE_PAIR(0xCFF8, 0x8A6D)
+DOUBLE_BYTE_PAIR(0xCFF9, 0x8ECC)
+DOUBLE_BYTE_PAIR(0xCFFA, 0x994B)
+DOUBLE_BYTE_PAIR(0xCFFB, 0xF906)
+DOUBLE_BYTE_PAIR(0xCFFC, 0x6677)
+DOUBLE_BYTE_PAIR(0xCFFD, 0x6B78)
+DOUBLE_BYTE_PAIR(0xCFFE, 0x8CB4)
+DOUBLE_BYTE_PAIR(0xD0A1, 0x9B3C)
+DOUBLE_BYTE_PAIR(0xD0A2, 0xF907)
+DOUBLE_BYTE_PAIR(0xD0A3, 0x53EB)
+DOUBLE_BYTE_PAIR(0xD0A4, 0x572D)
+DOUBLE_BYTE_PAIR(0xD0A5, 0x594E)
+DOUBLE_BYTE_PAIR(0xD0A6, 0x63C6)
+DOUBLE_BYTE_PAIR(0xD0A7, 0x69FB)
+DOUBLE_BYTE_PAIR(0xD0A8, 0x73EA)
+DOUBLE_BYTE_PAIR(0xD0A9, 0x7845)
+DOUBLE_BYTE_PAIR(0xD0AA, 0x7ABA)
+DOUBLE_BYTE_PAIR(0xD0AB, 0x7AC5)
+DOUBLE_BYTE_PAIR(0xD0AC, 0x7CFE)
+DOUBLE_BYTE_PAIR(0xD0AD, 0x8475)
+DOUBLE_BYTE_PAIR(0xD0AE, 0x898F)
+DOUBLE_BYTE_PAIR(0xD0AF, 0x8D73)
+DOUBLE_BYTE_PAIR(0xD0B0, 0x9035)
+DOUBLE_BYTE_PAIR(0xD0B1, 0x95A8)
+DOUBLE_BYTE_PAIR(0xD0B2, 0x52FB)
+DOUBLE_BYTE_PAIR(0xD0B3, 0x5747)
+DOUBLE_BYTE_PAIR(0xD0B4, 0x7547)
+DOUBLE_BYTE_PAIR(0xD0B5, 0x7B60)
+DOUBLE_BYTE_PAIR(0xD0B6, 0x83CC)
+DOUBLE_BYTE_PAIR(0xD0B7, 0x921E)
+DOUBLE_BYTE_PAIR(0xD0B8, 0xF908)
+DOUBLE_BYTE_PAIR(0xD0B9, 0x6A58)
+DOUBLE_BYTE_PAIR(0xD0BA, 0x514B)
+DOUBLE_BYTE_PAIR(0xD0BB, 0x524B)
+DOUBLE_BYTE_PAIR(0xD0BC, 0x5287)
+DOUBLE_BYTE_PAIR(0xD0BD, 0x621F)
+DOUBLE_BYTE_PAIR(0xD0BE, 0x68D8)
+DOUBLE_BYTE_PAIR(0xD0BF, 0x6975)
+DOUBLE_BYTE_PAIR(0xD0C0, 0x9699)
+DOUBLE_BYTE_PAIR(0xD0C1, 0x50C5)
+DOUBLE_BYTE_PAIR(0xD0C2, 0x52A4)
+DOUBLE_BYTE_PAIR(0xD0C3, 0x52E4)
+DOUBLE_BYTE_PAIR(0xD0C4, 0x61C3)
+DOUBLE_BYTE_PAIR(0xD0C5, 0x65A4)
+DOUBLE_BYTE_PAIR(0xD0C6, 0x6839)
+DOUBLE_BYTE_PAIR(0xD0C7, 0x69FF)
+DOUBLE_BYTE_PAIR(0xD0C8, 0x747E)
+DOUBLE_BYTE_PAIR(0xD0C9, 0x7B4B)
+DOUBLE_BYTE_PAIR(0xD0CA, 0x82B9)
+DOUBLE_BYTE_PAIR(0xD0CB, 0x83EB)
+DOUBLE_BYTE_PAIR(0xD0CC, 0x89B2)
+DOUBLE_BYTE_PAIR(0xD0CD, 0x8B39)
+DOUBLE_BYTE_PAIR(0xD0CE, 0x8FD1)
+DOUBLE_BYTE_PAIR(0xD0CF, 0x9949)
+DOUBLE_BYTE_PAIR(0xD0D0, 0xF909)
+DOUBLE_BYTE_PAIR(0xD0D1, 0x4ECA)
+DOUBLE_BYTE_PAIR(0xD0D2, 0x5997)
+DOUBLE_BYTE_PAIR(0xD0D3, 0x64D2)
+DOUBLE_BYTE_PAIR(0xD0D4, 0x6611)
+DOUBLE_BYTE_PAIR(0xD0D5, 0x6A8E)
+DOUBLE_BYTE_PAIR(0xD0D6, 0x7434)
+DOUBLE_BYTE_PAIR(0xD0D7, 0x7981)
+DOUBLE_BYTE_PAIR(0xD0D8, 0x79BD)
+DOUBLE_BYTE_PAIR(0xD0D9, 0x82A9)
+DOUBLE_BYTE_PAIR(0xD0DA, 0x887E)
+DOUBLE_BYTE_PAIR(0xD0DB, 0x887F)
+DOUBLE_BYTE_PAIR(0xD0DC, 0x895F)
+DOUBLE_BYTE_PAIR(0xD0DD, 0xF90A)
+DOUBLE_BYTE_PAIR(0xD0DE, 0x9326)
+DOUBLE_BYTE_PAIR(0xD0DF, 0x4F0B)
+DOUBLE_BYTE_PAIR(0xD0E0, 0x53CA)
+DOUBLE_BYTE_PAIR(0xD0E1, 0x6025)
+DOUBLE_BYTE_PAIR(0xD0E2, 0x6271)
+DOUBLE_BYTE_PAIR(0xD0E3, 0x6C72)
+DOUBLE_BYTE_PAIR(0xD0E4, 0x7D1A)
+DOUBLE_BYTE_PAIR(0xD0E5, 0x7D66)
+DOUBLE_BYTE_PAIR(0xD0E6, 0x4E98)
+DOUBLE_BYTE_PAIR(0xD0E7, 0x5162)
+DOUBLE_BYTE_PAIR(0xD0E8, 0x77DC)
+DOUBLE_BYTE_PAIR(0xD0E9, 0x80AF)
+DOUBLE_BYTE_PAIR(0xD0EA, 0x4F01)
+DOUBLE_BYTE_PAIR(0xD0EB, 0x4F0E)
+DOUBLE_BYTE_PAIR(0xD0EC, 0x5176)
+DOUBLE_BYTE_PAIR(0xD0ED, 0x5180)
+DOUBLE_BYTE_PAIR(0xD0EE, 0x55DC)
+DOUBLE_BYTE_PAIR(0xD0EF, 0x5668)
+DOUBLE_BYTE_PAIR(0xD0F0, 0x573B)
+DOUBLE_BYTE_PAIR(0xD0F1, 0x57FA)
+DOUBLE_BYTE_PAIR(0xD0F2, 0x57FC)
+DOUBLE_BYTE_PAIR(0xD0F3, 0x5914)
+DOUBLE_BYTE_PAIR(0xD0F4, 0x5947)
+DOUBLE_BYTE_PAIR(0xD0F5, 0x5993)
+DOUBLE_BYTE_PAIR(0xD0F6, 0x5BC4)
+DOUBLE_BYTE_PAIR(0xD0F7, 0x5C90)
+DOUBLE_BYTE_PAIR(0xD0F8, 0x5D0E)
+DOUBLE_BYTE_PAIR(0xD0F9, 0x5DF1)
+DOUBLE_BYTE_PAIR(0xD0FA, 0x5E7E)
+DOUBLE_BYTE_PAIR(0xD0FB, 0x5FCC)
+DOUBLE_BYTE_PAIR(0xD0FC, 0x6280)
+DOUBLE_BYTE_PAIR(0xD0FD, 0x65D7)
+DOUBLE_BYTE_PAIR(0xD0FE, 0x65E3)
+DOUBLE_BYTE_PAIR(0xD1A1, 0x671E)
+DOUBLE_BYTE_PAIR(0xD1A2, 0x671F)
+DOUBLE_BYTE_PAIR(0xD1A3, 0x675E)
+DOUBLE_BYTE_PAIR(0xD1A4, 0x68CB)
+DOUBLE_BYTE_PAIR(0xD1A5, 0x68C4)
+DOUBLE_BYTE_PAIR(0xD1A6, 0x6A5F)
+DOUBLE_BYTE_PAIR(0xD1A7, 0x6B3A)
+DOUBLE_BYTE_PAIR(0xD1A8, 0x6C23)
+DOUBLE_BYTE_PAIR(0xD1A9, 0x6C7D)
+DOUBLE_BYTE_PAIR(0xD1AA, 0x6C82)
+DOUBLE_BYTE_PAIR(0xD1AB, 0x6DC7)
+DOUBLE_BYTE_PAIR(0xD1AC, 0x7398)
+DOUBLE_BYTE_PAIR(0xD1AD, 0x7426)
+DOUBLE_BYTE_PAIR(0xD1AE, 0x742A)
+DOUBLE_BYTE_PAIR(0xD1AF, 0x7482)
+DOUBLE_BYTE_PAIR(0xD1B0, 0x74A3)
+DOUBLE_BYTE_PAIR(0xD1B1, 0x7578)
+DOUBLE_BYTE_PAIR(0xD1B2, 0x757F)
+DOUBLE_BYTE_PAIR(0xD1B3, 0x7881)
+DOUBLE_BYTE_PAIR(0xD1B4, 0x78EF)
+DOUBLE_BYTE_PAIR(0xD1B5, 0x7941)
+DOUBLE_BYTE_PAIR(0xD1B6, 0x7947)
+DOUBLE_BYTE_PAIR(0xD1B7, 0x7948)
+DOUBLE_BYTE_PAIR(0xD1B8, 0x797A)
+DOUBLE_BYTE_PAIR(0xD1B9, 0x7B95)
+DOUBLE_BYTE_PAIR(0xD1BA, 0x7D00)
+DOUBLE_BYTE_PAIR(0xD1BB, 0x7DBA)
+DOUBLE_BYTE_PAIR(0xD1BC, 0x7F88)
+DOUBLE_BYTE_PAIR(0xD1BD, 0x8006)
+DOUBLE_BYTE_PAIR(0xD1BE, 0x802D)
+DOUBLE_BYTE_PAIR(0xD1BF, 0x808C)
+DOUBLE_BYTE_PAIR(0xD1C0, 0x8A18)
+DOUBLE_BYTE_PAIR(0xD1C1, 0x8B4F)
+DOUBLE_BYTE_PAIR(0xD1C2, 0x8C48)
+DOUBLE_BYTE_PAIR(0xD1C3, 0x8D77)
+DOUBLE_BYTE_PAIR(0xD1C4, 0x9321)
+DOUBLE_BYTE_PAIR(0xD1C5, 0x9324)
+DOUBLE_BYTE_PAIR(0xD1C6, 0x98E2)
+DOUBLE_BYTE_PAIR(0xD1C7, 0x9951)
+DOUBLE_BYTE_PAIR(0xD1C8, 0x9A0E)
+DOUBLE_BYTE_PAIR(0xD1C9, 0x9A0F)
+DOUBLE_BYTE_PAIR(0xD1CA, 0x9A65)
+DOUBLE_BYTE_PAIR(0xD1CB, 0x9E92)
+DOUBLE_BYTE_PAIR(0xD1CC, 0x7DCA)
+DOUBLE_BYTE_PAIR(0xD1CD, 0x4F76)
+DOUBLE_BYTE_PAIR(0xD1CE, 0x5409)
+DOUBLE_BYTE_PAIR(0xD1CF, 0x62EE)
+DOUBLE_BYTE_PAIR(0xD1D0, 0x6854)
+DOUBLE_BYTE_PAIR(0xD1D1, 0x91D1)
+DOUBLE_BYTE_PAIR(0xD1D2, 0x55AB)
+DOUBLE_BYTE_PAIR(0xD1D3, 0x513A)
+DOUBLE_BYTE_PAIR(0xD1D4, 0xF90B)
+DOUBLE_BYTE_PAIR(0xD1D5, 0xF90C)
+DOUBLE_BYTE_PAIR(0xD1D6, 0x5A1C)
+DOUBLE_BYTE_PAIR(0xD1D7, 0x61E6)
+DOUBLE_BYTE_PAIR(0xD1D8, 0xF90D)
+DOUBLE_BYTE_PAIR(0xD1D9, 0x62CF)
+DOUBLE_BYTE_PAIR(0xD1DA, 0x62FF)
+DOUBLE_BYTE_PAIR(0xD1DB, 0xF90E)
+DOUBLE_BYTE_PAIR(0xD1DC, 0xF90F)
+DOUBLE_BYTE_PAIR(0xD1DD, 0xF910)
+DOUBLE_BYTE_PAIR(0xD1DE, 0xF911)
+DOUBLE_BYTE_PAIR(0xD1DF, 0xF912)
+DOUBLE_BYTE_PAIR(0xD1E0, 0xF913)
+DOUBLE_BYTE_PAIR(0xD1E1, 0x90A3)
+DOUBLE_BYTE_PAIR(0xD1E2, 0xF914)
+DOUBLE_BYTE_PAIR(0xD1E3, 0xF915)
+DOUBLE_BYTE_PAIR(0xD1E4, 0xF916)
+DOUBLE_BYTE_PAIR(0xD1E5, 0xF917)
+DOUBLE_BYTE_PAIR(0xD1E6, 0xF918)
+DOUBLE_BYTE_PAIR(0xD1E7, 0x8AFE)
+DOUBLE_BYTE_PAIR(0xD1E8, 0xF919)
+DOUBLE_BYTE_PAIR(0xD1E9, 0xF91A)
+DOUBLE_BYTE_PAIR(0xD1EA, 0xF91B)
+DOUBLE_BYTE_PAIR(0xD1EB, 0xF91C)
+DOUBLE_BYTE_PAIR(0xD1EC, 0x6696)
+DOUBLE_BYTE_PAIR(0xD1ED, 0xF91D)
+DOUBLE_BYTE_PAIR(0xD1EE, 0x7156)
+DOUBLE_BYTE_PAIR(0xD1EF, 0xF91E)
+DOUBLE_BYTE_PAIR(0xD1F0, 0xF91F)
+DOUBLE_BYTE_PAIR(0xD1F1, 0x96E3)
+DOUBLE_BYTE_PAIR(0xD1F2, 0xF920)
+DOUBLE_BYTE_PAIR(0xD1F3, 0x634F)
+DOUBLE_BYTE_PAIR(0xD1F4, 0x637A)
+DOUBLE_BYTE_PAIR(0xD1F5, 0x5357)
+DOUBLE_BYTE_PAIR(0xD1F6, 0xF921)
+DOUBLE_BYTE_PAIR(0xD1F7, 0x678F)
+DOUBLE_BYTE_PAIR(0xD1F8, 0x6960)
+DOUBLE_BYTE_PAIR(0xD1F9, 0x6E73)
+DOUBLE_BYTE_PAIR(0xD1FA, 0xF922)
+DOUBLE_BYTE_PAIR(0xD1FB, 0x7537)
+DOUBLE_BYTE_PAIR(0xD1FC, 0xF923)
+DOUBLE_BYTE_PAIR(0xD1FD, 0xF924)
+DOUBLE_BYTE_PAIR(0xD1FE, 0xF925)
+DOUBLE_BYTE_PAIR(0xD2A1, 0x7D0D)
+DOUBLE_BYTE_PAIR(0xD2A2, 0xF926)
+DOUBLE_BYTE_PAIR(0xD2A3, 0xF927)
+DOUBLE_BYTE_PAIR(0xD2A4, 0x8872)
+DOUBLE_BYTE_PAIR(0xD2A5, 0x56CA)
+DOUBLE_BYTE_PAIR(0xD2A6, 0x5A18)
+DOUBLE_BYTE_PAIR(0xD2A7, 0xF928)
+DOUBLE_BYTE_PAIR(0xD2A8, 0xF929)
+DOUBLE_BYTE_PAIR(0xD2A9, 0xF92A)
+DOUBLE_BYTE_PAIR(0xD2AA, 0xF92B)
+DOUBLE_BYTE_PAIR(0xD2AB, 0xF92C)
+DOUBLE_BYTE_PAIR(0xD2AC, 0x4E43)
+DOUBLE_BYTE_PAIR(0xD2AD, 0xF92D)
+DOUBLE_BYTE_PAIR(0xD2AE, 0x5167)
+DOUBLE_BYTE_PAIR(0xD2AF, 0x5948)
+DOUBLE_BYTE_PAIR(0xD2B0, 0x67F0)
+DOUBLE_BYTE_PAIR(0xD2B1, 0x8010)
+DOUBLE_BYTE_PAIR(0xD2B2, 0xF92E)
+DOUBLE_BYTE_PAIR(0xD2B3, 0x5973)
+DOUBLE_BYTE_PAIR(0xD2B4, 0x5E74)
+DOUBLE_BYTE_PAIR(0xD2B5, 0x649A)
+DOUBLE_BYTE_PAIR(0xD2B6, 0x79CA)
+DOUBLE_BYTE_PAIR(0xD2B7, 0x5FF5)
+DOUBLE_BYTE_PAIR(0xD2B8, 0x606C)
+DOUBLE_BYTE_PAIR(0xD2B9, 0x62C8)
+DOUBLE_BYTE_PAIR(0xD2BA, 0x637B)
+DOUBLE_BYTE_PAIR(0xD2BB, 0x5BE7)
+DOUBLE_BYTE_PAIR(0xD2BC, 0x5BD7)
+DOUBLE_BYTE_PAIR(0xD2BD, 0x52AA)
+DOUBLE_BYTE_PAIR(0xD2BE, 0xF92F)
+DOUBLE_BYTE_PAIR(0xD2BF, 0x5974)
+DOUBLE_BYTE_PAIR(0xD2C0, 0x5F29)
+DOUBLE_BYTE_PAIR(0xD2C1, 0x6012)
+DOUBLE_BYTE_PAIR(0xD2C2, 0xF930)
+DOUBLE_BYTE_PAIR(0xD2C3, 0xF931)
+DOUBLE_BYTE_PAIR(0xD2C4, 0xF932)
+DOUBLE_BYTE_PAIR(0xD2C5, 0x7459)
+DOUBLE_BYTE_PAIR(0xD2C6, 0xF933)
+DOUBLE_BYTE_PAIR(0xD2C7, 0xF934)
+DOUBLE_BYTE_PAIR(0xD2C8, 0xF935)
+DOUBLE_BYTE_PAIR(0xD2C9, 0xF936)
+DOUBLE_BYTE_PAIR(0xD2CA, 0xF937)
+DOUBLE_BYTE_PAIR(0xD2CB, 0xF938)
+DOUBLE_BYTE_PAIR(0xD2CC, 0x99D1)
+DOUBLE_BYTE_PAIR(0xD2CD, 0xF939)
+DOUBLE_BYTE_PAIR(0xD2CE, 0xF93A)
+DOUBLE_BYTE_PAIR(0xD2CF, 0xF93B)
+DOUBLE_BYTE_PAIR(0xD2D0, 0xF93C)
+DOUBLE_BYTE_PAIR(0xD2D1, 0xF93D)
+DOUBLE_BYTE_PAIR(0xD2D2, 0xF93E)
+DOUBLE_BYTE_PAIR(0xD2D3, 0xF93F)
+DOUBLE_BYTE_PAIR(0xD2D4, 0xF940)
+DOUBLE_BYTE_PAIR(0xD2D5, 0xF941)
+DOUBLE_BYTE_PAIR(0xD2D6, 0xF942)
+DOUBLE_BYTE_PAIR(0xD2D7, 0xF943)
+DOUBLE_BYTE_PAIR(0xD2D8, 0x6FC3)
+DOUBLE_BYTE_PAIR(0xD2D9, 0xF944)
+DOUBLE_BYTE_PAIR(0xD2DA, 0xF945)
+DOUBLE_BYTE_PAIR(0xD2DB, 0x81BF)
+DOUBLE_BYTE_PAIR(0xD2DC, 0x8FB2)
+DOUBLE_BYTE_PAIR(0xD2DD, 0x60F1)
+DOUBLE_BYTE_PAIR(0xD2DE, 0xF946)
+DOUBLE_BYTE_PAIR(0xD2DF, 0xF947)
+DOUBLE_BYTE_PAIR(0xD2E0, 0x8166)
+DOUBLE_BYTE_PAIR(0xD2E1, 0xF948)
+DOUBLE_BYTE_PAIR(0xD2E2, 0xF949)
+DOUBLE_BYTE_PAIR(0xD2E3, 0x5C3F)
+DOUBLE_BYTE_PAIR(0xD2E4, 0xF94A)
+DOUBLE_BYTE_PAIR(0xD2E5, 0xF94B)
+DOUBLE_BYTE_PAIR(0xD2E6, 0xF94C)
+DOUBLE_BYTE_PAIR(0xD2E7, 0xF94D)
+DOUBLE_BYTE_PAIR(0xD2E8, 0xF94E)
+DOUBLE_BYTE_PAIR(0xD2E9, 0xF94F)
+DOUBLE_BYTE_PAIR(0xD2EA, 0xF950)
+DOUBLE_BYTE_PAIR(0xD2EB, 0xF951)
+DOUBLE_BYTE_PAIR(0xD2EC, 0x5AE9)
+DOUBLE_BYTE_PAIR(0xD2ED, 0x8A25)
+DOUBLE_BYTE_PAIR(0xD2EE, 0x677B)
+DOUBLE_BYTE_PAIR(0xD2EF, 0x7D10)
+DOUBLE_BYTE_PAIR(0xD2F0, 0xF952)
+DOUBLE_BYTE_PAIR(0xD2F1, 0xF953)
+DOUBLE_BYTE_PAIR(0xD2F2, 0xF954)
+DOUBLE_BYTE_PAIR(0xD2F3, 0xF955)
+DOUBLE_BYTE_PAIR(0xD2F4, 0xF956)
+DOUBLE_BYTE_PAIR(0xD2F5, 0xF957)
+DOUBLE_BYTE_PAIR(0xD2F6, 0x80FD)
+DOUBLE_BYTE_PAIR(0xD2F7, 0xF958)
+DOUBLE_BYTE_PAIR(0xD2F8, 0xF959)
+DOUBLE_BYTE_PAIR(0xD2F9, 0x5C3C)
+DOUBLE_BYTE_PAIR(0xD2FA, 0x6CE5)
+DOUBLE_BYTE_PAIR(0xD2FB, 0x533F)
+DOUBLE_BYTE_PAIR(0xD2FC, 0x6EBA)
+DOUBLE_BYTE_PAIR(0xD2FD, 0x591A)
+DOUBLE_BYTE_PAIR(0xD2FE, 0x8336)
+DOUBLE_BYTE_PAIR(0xD3A1, 0x4E39)
+DOUBLE_BYTE_PAIR(0xD3A2, 0x4EB6)
+DOUBLE_BYTE_PAIR(0xD3A3, 0x4F46)
+DOUBLE_BYTE_PAIR(0xD3A4, 0x55AE)
+DOUBLE_BYTE_PAIR(0xD3A5, 0x5718)
+DOUBLE_BYTE_PAIR(0xD3A6, 0x58C7)
+DOUBLE_BYTE_PAIR(0xD3A7, 0x5F56)
+DOUBLE_BYTE_PAIR(0xD3A8, 0x65B7)
+DOUBLE_BYTE_PAIR(0xD3A9, 0x65E6)
+DOUBLE_BYTE_PAIR(0xD3AA, 0x6A80)
+DOUBLE_BYTE_PAIR(0xD3AB, 0x6BB5)
+DOUBLE_BYTE_PAIR(0xD3AC, 0x6E4D)
+DOUBLE_BYTE_PAIR(0xD3AD, 0x77ED)
+DOUBLE_BYTE_PAIR(0xD3AE, 0x7AEF)
+DOUBLE_BYTE_PAIR(0xD3AF, 0x7C1E)
+DOUBLE_BYTE_PAIR(0xD3B0, 0x7DDE)
+DOUBLE_BYTE_PAIR(0xD3B1, 0x86CB)
+DOUBLE_BYTE_PAIR(0xD3B2, 0x8892)
+DOUBLE_BYTE_PAIR(0xD3B3, 0x9132)
+DOUBLE_BYTE_PAIR(0xD3B4, 0x935B)
+DOUBLE_BYTE_PAIR(0xD3B5, 0x64BB)
+DOUBLE_BYTE_PAIR(0xD3B6, 0x6FBE)
+DOUBLE_BYTE_PAIR(0xD3B7, 0x737A)
+DOUBLE_BYTE_PAIR(0xD3B8, 0x75B8)
+DOUBLE_BYTE_PAIR(0xD3B9, 0x9054)
+DOUBLE_BYTE_PAIR(0xD3BA, 0x5556)
+DOUBLE_BYTE_PAIR(0xD3BB, 0x574D)
+DOUBLE_BYTE_PAIR(0xD3BC, 0x61BA)
+DOUBLE_BYTE_PAIR(0xD3BD, 0x64D4)
+DOUBLE_BYTE_PAIR(0xD3BE, 0x66C7)
+DOUBLE_BYTE_PAIR(0xD3BF, 0x6DE1)
+DOUBLE_BYTE_PAIR(0xD3C0, 0x6E5B)
+DOUBLE_BYTE_PAIR(0xD3C1, 0x6F6D)
+DOUBLE_BYTE_PAIR(0xD3C2, 0x6FB9)
+DOUBLE_BYTE_PAIR(0xD3C3, 0x75F0)
+DOUBLE_BYTE_PAIR(0xD3C4, 0x8043)
+DOUBLE_BYTE_PAIR(0xD3C5, 0x81BD)
+DOUBLE_BYTE_PAIR(0xD3C6, 0x8541)
+DOUBLE_BYTE_PAIR(0xD3C7, 0x8983)
+DOUBLE_BYTE_PAIR(0xD3C8, 0x8AC7)
+DOUBLE_BYTE_PAIR(0xD3C9, 0x8B5A)
+DOUBLE_BYTE_PAIR(0xD3CA, 0x931F)
+DOUBLE_BYTE_PAIR(0xD3CB, 0x6C93)
+DOUBLE_BYTE_PAIR(0xD3CC, 0x7553)
+DOUBLE_BYTE_PAIR(0xD3CD, 0x7B54)
+DOUBLE_BYTE_PAIR(0xD3CE, 0x8E0F)
+DOUBLE_BYTE_PAIR(0xD3CF, 0x905D)
+DOUBLE_BYTE_PAIR(0xD3D0, 0x5510)
+DOUBLE_BYTE_PAIR(0xD3D1, 0x5802)
+DOUBLE_BYTE_PAIR(0xD3D2, 0x5858)
+DOUBLE_BYTE_PAIR(0xD3D3, 0x5E62)
+DOUBLE_BYTE_PAIR(0xD3D4, 0x6207)
+DOUBLE_BYTE_PAIR(0xD3D5, 0x649E)
+DOUBLE_BYTE_PAIR(0xD3D6, 0x68E0)
+DOUBLE_BYTE_PAIR(0xD3D7, 0x7576)
+DOUBLE_BYTE_PAIR(0xD3D8, 0x7CD6)
+DOUBLE_BYTE_PAIR(0xD3D9, 0x87B3)
+DOUBLE_BYTE_PAIR(0xD3DA, 0x9EE8)
+DOUBLE_BYTE_PAIR(0xD3DB, 0x4EE3)
+DOUBLE_BYTE_PAIR(0xD3DC, 0x5788)
+DOUBLE_BYTE_PAIR(0xD3DD, 0x576E)
+DOUBLE_BYTE_PAIR(0xD3DE, 0x5927)
+DOUBLE_BYTE_PAIR(0xD3DF, 0x5C0D)
+DOUBLE_BYTE_PAIR(0xD3E0, 0x5CB1)
+DOUBLE_BYTE_PAIR(0xD3E1, 0x5E36)
+DOUBLE_BYTE_PAIR(0xD3E2, 0x5F85)
+DOUBLE_BYTE_PAIR(0xD3E3, 0x6234)
+DOUBLE_BYTE_PAIR(0xD3E4, 0x64E1)
+DOUBLE_BYTE_PAIR(0xD3E5, 0x73B3)
+DOUBLE_BYTE_PAIR(0xD3E6, 0x81FA)
+DOUBLE_BYTE_PAIR(0xD3E7, 0x888B)
+DOUBLE_BYTE_PAIR(0xD3E8, 0x8CB8)
+DOUBLE_BYTE_PAIR(0xD3E9, 0x968A)
+DOUBLE_BYTE_PAIR(0xD3EA, 0x9EDB)
+DOUBLE_BYTE_PAIR(0xD3EB, 0x5B85)
+DOUBLE_BYTE_PAIR(0xD3EC, 0x5FB7)
+DOUBLE_BYTE_PAIR(0xD3ED, 0x60B3)
+DOUBLE_BYTE_PAIR(0xD3EE, 0x5012)
+DOUBLE_BYTE_PAIR(0xD3EF, 0x5200)
+DOUBLE_BYTE_PAIR(0xD3F0, 0x5230)
+DOUBLE_BYTE_PAIR(0xD3F1, 0x5716)
+DOUBLE_BYTE_PAIR(0xD3F2, 0x5835)
+DOUBLE_BYTE_PAIR(0xD3F3, 0x5857)
+DOUBLE_BYTE_PAIR(0xD3F4, 0x5C0E)
+DOUBLE_BYTE_PAIR(0xD3F5, 0x5C60)
+DOUBLE_BYTE_PAIR(0xD3F6, 0x5CF6)
+DOUBLE_BYTE_PAIR(0xD3F7, 0x5D8B)
+DOUBLE_BYTE_PAIR(0xD3F8, 0x5EA6)
+DOUBLE_BYTE_PAIR(0xD3F9, 0x5F92)
+DOUBLE_BYTE_PAIR(0xD3FA, 0x60BC)
+DOUBLE_BYTE_PAIR(0xD3FB, 0x6311)
+DOUBLE_BYTE_PAIR(0xD3FC, 0x6389)
+DOUBLE_BYTE_PAIR(0xD3FD, 0x6417)
+DOUBLE_BYTE_PAIR(0xD3FE, 0x6843)
+DOUBLE_BYTE_PAIR(0xD4A1, 0x68F9)
+DOUBLE_BYTE_PAIR(0xD4A2, 0x6AC2)
+DOUBLE_BYTE_PAIR(0xD4A3, 0x6DD8)
+DOUBLE_BYTE_PAIR(0xD4A4, 0x6E21)
+DOUBLE_BYTE_PAIR(0xD4A5, 0x6ED4)
+DOUBLE_BYTE_PAIR(0xD4A6, 0x6FE4)
+DOUBLE_BYTE_PAIR(0xD4A7, 0x71FE)
+DOUBLE_BYTE_PAIR(0xD4A8, 0x76DC)
+DOUBLE_BYTE_PAIR(0xD4A9, 0x7779)
+DOUBLE_BYTE_PAIR(0xD4AA, 0x79B1)
+DOUBLE_BYTE_PAIR(0xD4AB, 0x7A3B)
+DOUBLE_BYTE_PAIR(0xD4AC, 0x8404)
+DOUBLE_BYTE_PAIR(0xD4AD, 0x89A9)
+DOUBLE_BYTE_PAIR(0xD4AE, 0x8CED)
+DOUBLE_BYTE_PAIR(0xD4AF, 0x8DF3)
+DOUBLE_BYTE_PAIR(0xD4B0, 0x8E48)
+DOUBLE_BYTE_PAIR(0xD4B1, 0x9003)
+DOUBLE_BYTE_PAIR(0xD4B2, 0x9014)
+DOUBLE_BYTE_PAIR(0xD4B3, 0x9053)
+DOUBLE_BYTE_PAIR(0xD4B4, 0x90FD)
+DOUBLE_BYTE_PAIR(0xD4B5, 0x934D)
+DOUBLE_BYTE_PAIR(0xD4B6, 0x9676)
+DOUBLE_BYTE_PAIR(0xD4B7, 0x97DC)
+DOUBLE_BYTE_PAIR(0xD4B8, 0x6BD2)
+DOUBLE_BYTE_PAIR(0xD4B9, 0x7006)
+DOUBLE_BYTE_PAIR(0xD4BA, 0x7258)
+DOUBLE_BYTE_PAIR(0xD4BB, 0x72A2)
+DOUBLE_BYTE_PAIR(0xD4BC, 0x7368)
+DOUBLE_BYTE_PAIR(0xD4BD, 0x7763)
+DOUBLE_BYTE_PAIR(0xD4BE, 0x79BF)
+DOUBLE_BYTE_PAIR(0xD4BF, 0x7BE4)
+DOUBLE_BYTE_PAIR(0xD4C0, 0x7E9B)
+DOUBLE_BYTE_PAIR(0xD4C1, 0x8B80)
+DOUBLE_BYTE_PAIR(0xD4C2, 0x58A9)
+DOUBLE_BYTE_PAIR(0xD4C3, 0x60C7)
+DOUBLE_BYTE_PAIR(0xD4C4, 0x6566)
+DOUBLE_BYTE_PAIR(0xD4C5, 0x65FD)
+DOUBLE_BYTE_PAIR(0xD4C6, 0x66BE)
+DOUBLE_BYTE_PAIR(0xD4C7, 0x6C8C)
+DOUBLE_BYTE_PAIR(0xD4C8, 0x711E)
+DOUBLE_BYTE_PAIR(0xD4C9, 0x71C9)
+DOUBLE_BYTE_PAIR(0xD4CA, 0x8C5A)
+DOUBLE_BYTE_PAIR(0xD4CB, 0x9813)
+DOUBLE_BYTE_PAIR(0xD4CC, 0x4E6D)
+DOUBLE_BYTE_PAIR(0xD4CD, 0x7A81)
+DOUBLE_BYTE_PAIR(0xD4CE, 0x4EDD)
+DOUBLE_BYTE_PAIR(0xD4CF, 0x51AC)
+DOUBLE_BYTE_PAIR(0xD4D0, 0x51CD)
+DOUBLE_BYTE_PAIR(0xD4D1, 0x52D5)
+DOUBLE_BYTE_PAIR(0xD4D2, 0x540C)
+DOUBLE_BYTE_PAIR(0xD4D3, 0x61A7)
+DOUBLE_BYTE_PAIR(0xD4D4, 0x6771)
+DOUBLE_BYTE_PAIR(0xD4D5, 0x6850)
+DOUBLE_BYTE_PAIR(0xD4D6, 0x68DF)
+DOUBLE_BYTE_PAIR(0xD4D7, 0x6D1E)
+DOUBLE_BYTE_PAIR(0xD4D8, 0x6F7C)
+DOUBLE_BYTE_PAIR(0xD4D9, 0x75BC)
+DOUBLE_BYTE_PAIR(0xD4DA, 0x77B3)
+DOUBLE_BYTE_PAIR(0xD4DB, 0x7AE5)
+DOUBLE_BYTE_PAIR(0xD4DC, 0x80F4)
+DOUBLE_BYTE_PAIR(0xD4DD, 0x8463)
+DOUBLE_BYTE_PAIR(0xD4DE, 0x9285)
+DOUBLE_BYTE_PAIR(0xD4DF, 0x515C)
+DOUBLE_BYTE_PAIR(0xD4E0, 0x6597)
+DOUBLE_BYTE_PAIR(0xD4E1, 0x675C)
+DOUBLE_BYTE_PAIR(0xD4E2, 0x6793)
+DOUBLE_BYTE_PAIR(0xD4E3, 0x75D8)
+DOUBLE_BYTE_PAIR(0xD4E4, 0x7AC7)
+DOUBLE_BYTE_PAIR(0xD4E5, 0x8373)
+DOUBLE_BYTE_PAIR(0xD4E6, 0xF95A)
+DOUBLE_BYTE_PAIR(0xD4E7, 0x8C46)
+DOUBLE_BYTE_PAIR(0xD4E8, 0x9017)
+DOUBLE_BYTE_PAIR(0xD4E9, 0x982D)
+DOUBLE_BYTE_PAIR(0xD4EA, 0x5C6F)
+DOUBLE_BYTE_PAIR(0xD4EB, 0x81C0)
+DOUBLE_BYTE_PAIR(0xD4EC, 0x829A)
+DOUBLE_BYTE_PAIR(0xD4ED, 0x9041)
+DOUBLE_BYTE_PAIR(0xD4EE, 0x906F)
+DOUBLE_BYTE_PAIR(0xD4EF, 0x920D)
+DOUBLE_BYTE_PAIR(0xD4F0, 0x5F97)
+DOUBLE_BYTE_PAIR(0xD4F1, 0x5D9D)
+DOUBLE_BYTE_PAIR(0xD4F2, 0x6A59)
+DOUBLE_BYTE_PAIR(0xD4F3, 0x71C8)
+DOUBLE_BYTE_PAIR(0xD4F4, 0x767B)
+DOUBLE_BYTE_PAIR(0xD4F5, 0x7B49)
+DOUBLE_BYTE_PAIR(0xD4F6, 0x85E4)
+DOUBLE_BYTE_PAIR(0xD4F7, 0x8B04)
+DOUBLE_BYTE_PAIR(0xD4F8, 0x9127)
+DOUBLE_BYTE_PAIR(0xD4F9, 0x9A30)
+DOUBLE_BYTE_PAIR(0xD4FA, 0x5587)
+DOUBLE_BYTE_PAIR(0xD4FB, 0x61F6)
+DOUBLE_BYTE_PAIR(0xD4FC, 0xF95B)
+DOUBLE_BYTE_PAIR(0xD4FD, 0x7669)
+DOUBLE_BYTE_PAIR(0xD4FE, 0x7F85)
+DOUBLE_BYTE_PAIR(0xD5A1, 0x863F)
+DOUBLE_BYTE_PAIR(0xD5A2, 0x87BA)
+DOUBLE_BYTE_PAIR(0xD5A3, 0x88F8)
+DOUBLE_BYTE_PAIR(0xD5A4, 0x908F)
+DOUBLE_BYTE_PAIR(0xD5A5, 0xF95C)
+DOUBLE_BYTE_PAIR(0xD5A6, 0x6D1B)
+DOUBLE_BYTE_PAIR(0xD5A7, 0x70D9)
+DOUBLE_BYTE_PAIR(0xD5A8, 0x73DE)
+DOUBLE_BYTE_PAIR(0xD5A9, 0x7D61)
+DOUBLE_BYTE_PAIR(0xD5AA, 0x843D)
+DOUBLE_BYTE_PAIR(0xD5AB, 0xF95D)
+DOUBLE_BYTE_PAIR(0xD5AC, 0x916A)
+DOUBLE_BYTE_PAIR(0xD5AD, 0x99F1)
+DOUBLE_BYTE_PAIR(0xD5AE, 0xF95E)
+DOUBLE_BYTE_PAIR(0xD5AF, 0x4E82)
+DOUBLE_BYTE_PAIR(0xD5B0, 0x5375)
+DOUBLE_BYTE_PAIR(0xD5B1, 0x6B04)
+DOUBLE_BYTE_PAIR(0xD5B2, 0x6B12)
+DOUBLE_BYTE_PAIR(0xD5B3, 0x703E)
+DOUBLE_BYTE_PAIR(0xD5B4, 0x721B)
+DOUBLE_BYTE_PAIR(0xD5B5, 0x862D)
+DOUBLE_BYTE_PAIR(0xD5B6, 0x9E1E)
+DOUBLE_BYTE_PAIR(0xD5B7, 0x524C)
+DOUBLE_BYTE_PAIR(0xD5B8, 0x8FA3)
+DOUBLE_BYTE_PAIR(0xD5B9, 0x5D50)
+DOUBLE_BYTE_PAIR(0xD5BA, 0x64E5)
+DOUBLE_BYTE_PAIR(0xD5BB, 0x652C)
+DOUBLE_BYTE_PAIR(0xD5BC, 0x6B16)
+DOUBLE_BYTE_PAIR(0xD5BD, 0x6FEB)
+DOUBLE_BYTE_PAIR(0xD5BE, 0x7C43)
+DOUBLE_BYTE_PAIR(0xD5BF, 0x7E9C)
+DOUBLE_BYTE_PAIR(0xD5C0, 0x85CD)
+DOUBLE_BYTE_PAIR(0xD5C1, 0x8964)
+DOUBLE_BYTE_PAIR(0xD5C2, 0x89BD)
+DOUBLE_BYTE_PAIR(0xD5C3, 0x62C9)
+DOUBLE_BYTE_PAIR(0xD5C4, 0x81D8)
+DOUBLE_BYTE_PAIR(0xD5C5, 0x881F)
+DOUBLE_BYTE_PAIR(0xD5C6, 0x5ECA)
+DOUBLE_BYTE_PAIR(0xD5C7, 0x6717)
+DOUBLE_BYTE_PAIR(0xD5C8, 0x6D6A)
+DOUBLE_BYTE_PAIR(0xD5C9, 0x72FC)
+DOUBLE_BYTE_PAIR(0xD5CA, 0x7405)
+DOUBLE_BYTE_PAIR(0xD5CB, 0x746F)
+DOUBLE_BYTE_PAIR(0xD5CC, 0x8782)
+DOUBLE_BYTE_PAIR(0xD5CD, 0x90DE)
+DOUBLE_BYTE_PAIR(0xD5CE, 0x4F86)
+DOUBLE_BYTE_PAIR(0xD5CF, 0x5D0D)
+DOUBLE_BYTE_PAIR(0xD5D0, 0x5FA0)
+DOUBLE_BYTE_PAIR(0xD5D1, 0x840A)
+DOUBLE_BYTE_PAIR(0xD5D2, 0x51B7)
+DOUBLE_BYTE_PAIR(0xD5D3, 0x63A0)
+DOUBLE_BYTE_PAIR(0xD5D4, 0x7565)
+DOUBLE_BYTE_PAIR(0xD5D5, 0x4EAE)
+DOUBLE_BYTE_PAIR(0xD5D6, 0x5006)
+DOUBLE_BYTE_PAIR(0xD5D7, 0x5169)
+DOUBLE_BYTE_PAIR(0xD5D8, 0x51C9)
+DOUBLE_BYTE_PAIR(0xD5D9, 0x6881)
+DOUBLE_BYTE_PAIR(0xD5DA, 0x6A11)
+DOUBLE_BYTE_PAIR(0xD5DB, 0x7CAE)
+DOUBLE_BYTE_PAIR(0xD5DC, 0x7CB1)
+DOUBLE_BYTE_PAIR(0xD5DD, 0x7CE7)
+DOUBLE_BYTE_PAIR(0xD5DE, 0x826F)
+DOUBLE_BYTE_PAIR(0xD5DF, 0x8AD2)
+DOUBLE_BYTE_PAIR(0xD5E0, 0x8F1B)
+DOUBLE_BYTE_PAIR(0xD5E1, 0x91CF)
+DOUBLE_BYTE_PAIR(0xD5E2, 0x4FB6)
+DOUBLE_BYTE_PAIR(0xD5E3, 0x5137)
+DOUBLE_BYTE_PAIR(0xD5E4, 0x52F5)
+DOUBLE_BYTE_PAIR(0xD5E5, 0x5442)
+DOUBLE_BYTE_PAIR(0xD5E6, 0x5EEC)
+DOUBLE_BYTE_PAIR(0xD5E7, 0x616E)
+DOUBLE_BYTE_PAIR(0xD5E8, 0x623E)
+DOUBLE_BYTE_PAIR(0xD5E9, 0x65C5)
+DOUBLE_BYTE_PAIR(0xD5EA, 0x6ADA)
+DOUBLE_BYTE_PAIR(0xD5EB, 0x6FFE)
+DOUBLE_BYTE_PAIR(0xD5EC, 0x792A)
+DOUBLE_BYTE_PAIR(0xD5ED, 0x85DC)
+DOUBLE_BYTE_PAIR(0xD5EE, 0x8823)
+DOUBLE_BYTE_PAIR(0xD5EF, 0x95AD)
+DOUBLE_BYTE_PAIR(0xD5F0, 0x9A62)
+DOUBLE_BYTE_PAIR(0xD5F1, 0x9A6A)
+DOUBLE_BYTE_PAIR(0xD5F2, 0x9E97)
+DOUBLE_BYTE_PAIR(0xD5F3, 0x9ECE)
+DOUBLE_BYTE_PAIR(0xD5F4, 0x529B)
+DOUBLE_BYTE_PAIR(0xD5F5, 0x66C6)
+DOUBLE_BYTE_PAIR(0xD5F6, 0x6B77)
+DOUBLE_BYTE_PAIR(0xD5F7, 0x701D)
+DOUBLE_BYTE_PAIR(0xD5F8, 0x792B)
+DOUBLE_BYTE_PAIR(0xD5F9, 0x8F62)
+DOUBLE_BYTE_PAIR(0xD5FA, 0x9742)
+DOUBLE_BYTE_PAIR(0xD5FB, 0x6190)
+DOUBLE_BYTE_PAIR(0xD5FC, 0x6200)
+DOUBLE_BYTE_PAIR(0xD5FD, 0x6523)
+DOUBLE_BYTE_PAIR(0xD5FE, 0x6F23)
+DOUBLE_BYTE_PAIR(0xD6A1, 0x7149)
+DOUBLE_BYTE_PAIR(0xD6A2, 0x7489)
+DOUBLE_BYTE_PAIR(0xD6A3, 0x7DF4)
+DOUBLE_BYTE_PAIR(0xD6A4, 0x806F)
+DOUBLE_BYTE_PAIR(0xD6A5, 0x84EE)
+DOUBLE_BYTE_PAIR(0xD6A6, 0x8F26)
+DOUBLE_BYTE_PAIR(0xD6A7, 0x9023)
+DOUBLE_BYTE_PAIR(0xD6A8, 0x934A)
+DOUBLE_BYTE_PAIR(0xD6A9, 0x51BD)
+DOUBLE_BYTE_PAIR(0xD6AA, 0x5217)
+DOUBLE_BYTE_PAIR(0xD6AB, 0x52A3)
+DOUBLE_BYTE_PAIR(0xD6AC, 0x6D0C)
+DOUBLE_BYTE_PAIR(0xD6AD, 0x70C8)
+DOUBLE_BYTE_PAIR(0xD6AE, 0x88C2)
+DOUBLE_BYTE_PAIR(0xD6AF, 0x5EC9)
+DOUBLE_BYTE_PAIR(0xD6B0, 0x6582)
+DOUBLE_BYTE_PAIR(0xD6B1, 0x6BAE)
+DOUBLE_BYTE_PAIR(0xD6B2, 0x6FC2)
+DOUBLE_BYTE_PAIR(0xD6B3, 0x7C3E)
+DOUBLE_BYTE_PAIR(0xD6B4, 0x7375)
+DOUBLE_BYTE_PAIR(0xD6B5, 0x4EE4)
+DOUBLE_BYTE_PAIR(0xD6B6, 0x4F36)
+DOUBLE_BYTE_PAIR(0xD6B7, 0x56F9)
+DOUBLE_BYTE_PAIR(0xD6B8, 0xF95F)
+DOUBLE_BYTE_PAIR(0xD6B9, 0x5CBA)
+DOUBLE_BYTE_PAIR(0xD6BA, 0x5DBA)
+DOUBLE_BYTE_PAIR(0xD6BB, 0x601C)
+DOUBLE_BYTE_PAIR(0xD6BC, 0x73B2)
+DOUBLE_BYTE_PAIR(0xD6BD, 0x7B2D)
+DOUBLE_BYTE_PAIR(0xD6BE, 0x7F9A)
+DOUBLE_BYTE_PAIR(0xD6BF, 0x7FCE)
+DOUBLE_BYTE_PAIR(0xD6C0, 0x8046)
+DOUBLE_BYTE_PAIR(0xD6C1, 0x901E)
+DOUBLE_BYTE_PAIR(0xD6C2, 0x9234)
+DOUBLE_BYTE_PAIR(0xD6C3, 0x96F6)
+DOUBLE_BYTE_PAIR(0xD6C4, 0x9748)
+DOUBLE_BYTE_PAIR(0xD6C5, 0x9818)
+DOUBLE_BYTE_PAIR(0xD6C6, 0x9F61)
+DOUBLE_BYTE_PAIR(0xD6C7, 0x4F8B)
+DOUBLE_BYTE_PAIR(0xD6C8, 0x6FA7)
+DOUBLE_BYTE_PAIR(0xD6C9, 0x79AE)
+DOUBLE_BYTE_PAIR(0xD6CA, 0x91B4)
+DOUBLE_BYTE_PAIR(0xD6CB, 0x96B7)
+DOUBLE_BYTE_PAIR(0xD6CC, 0x52DE)
+DOUBLE_BYTE_PAIR(0xD6CD, 0xF960)
+DOUBLE_BYTE_PAIR(0xD6CE, 0x6488)
+DOUBLE_BYTE_PAIR(0xD6CF, 0x64C4)
+DOUBLE_BYTE_PAIR(0xD6D0, 0x6AD3)
+DOUBLE_BYTE_PAIR(0xD6D1, 0x6F5E)
+DOUBLE_BYTE_PAIR(0xD6D2, 0x7018)
+DOUBLE_BYTE_PAIR(0xD6D3, 0x7210)
+DOUBLE_BYTE_PAIR(0xD6D4, 0x76E7)
+DOUBLE_BYTE_PAIR(0xD6D5, 0x8001)
+DOUBLE_BYTE_PAIR(0xD6D6, 0x8606)
+DOUBLE_BYTE_PAIR(0xD6D7, 0x865C)
+DOUBLE_BYTE_PAIR(0xD6D8, 0x8DEF)
+DOUBLE_BYTE_PAIR(0xD6D9, 0x8F05)
+DOUBLE_BYTE_PAIR(0xD6DA, 0x9732)
+DOUBLE_BYTE_PAIR(0xD6DB, 0x9B6F)
+DOUBLE_BYTE_PAIR(0xD6DC, 0x9DFA)
+DOUBLE_BYTE_PAIR(0xD6DD, 0x9E75)
+DOUBLE_BYTE_PAIR(0xD6DE, 0x788C)
+DOUBLE_BYTE_PAIR(0xD6DF, 0x797F)
+DOUBLE_BYTE_PAIR(0xD6E0, 0x7DA0)
+DOUBLE_BYTE_PAIR(0xD6E1, 0x83C9)
+DOUBLE_BYTE_PAIR(0xD6E2, 0x9304)
+DOUBLE_BYTE_PAIR(0xD6E3, 0x9E7F)
+DOUBLE_BYTE_PAIR(0xD6E4, 0x9E93)
+DOUBLE_BYTE_PAIR(0xD6E5, 0x8AD6)
+DOUBLE_BYTE_PAIR(0xD6E6, 0x58DF)
+DOUBLE_BYTE_PAIR(0xD6E7, 0x5F04)
+DOUBLE_BYTE_PAIR(0xD6E8, 0x6727)
+DOUBLE_BYTE_PAIR(0xD6E9, 0x7027)
+DOUBLE_BYTE_PAIR(0xD6EA, 0x74CF)
+DOUBLE_BYTE_PAIR(0xD6EB, 0x7C60)
+DOUBLE_BYTE_PAIR(0xD6EC, 0x807E)
+DOUBLE_BYTE_PAIR(0xD6ED, 0x5121)
+DOUBLE_BYTE_PAIR(0xD6EE, 0x7028)
+DOUBLE_BYTE_PAIR(0xD6EF, 0x7262)
+DOUBLE_BYTE_PAIR(0xD6F0, 0x78CA)
+DOUBLE_BYTE_PAIR(0xD6F1, 0x8CC2)
+DOUBLE_BYTE_PAIR(0xD6F2, 0x8CDA)
+DOUBLE_BYTE_PAIR(0xD6F3, 0x8CF4)
+DOUBLE_BYTE_PAIR(0xD6F4, 0x96F7)
+DOUBLE_BYTE_PAIR(0xD6F5, 0x4E86)
+DOUBLE_BYTE_PAIR(0xD6F6, 0x50DA)
+DOUBLE_BYTE_PAIR(0xD6F7, 0x5BEE)
+DOUBLE_BYTE_PAIR(0xD6F8, 0x5ED6)
+DOUBLE_BYTE_PAIR(0xD6F9, 0x6599)
+DOUBLE_BYTE_PAIR(0xD6FA, 0x71CE)
+DOUBLE_BYTE_PAIR(0xD6FB, 0x7642)
+DOUBLE_BYTE_PAIR(0xD6FC, 0x77AD)
+DOUBLE_BYTE_PAIR(0xD6FD, 0x804A)
+DOUBLE_BYTE_PAIR(0xD6FE, 0x84FC)
+DOUBLE_BYTE_PAIR(0xD7A1, 0x907C)
+DOUBLE_BYTE_PAIR(0xD7A2, 0x9B27)
+DOUBLE_BYTE_PAIR(0xD7A3, 0x9F8D)
+DOUBLE_BYTE_PAIR(0xD7A4, 0x58D8)
+DOUBLE_BYTE_PAIR(0xD7A5, 0x5A41)
+DOUBLE_BYTE_PAIR(0xD7A6, 0x5C62)
+DOUBLE_BYTE_PAIR(0xD7A7, 0x6A13)
+DOUBLE_BYTE_PAIR(0xD7A8, 0x6DDA)
+DOUBLE_BYTE_PAIR(0xD7A9, 0x6F0F)
+DOUBLE_BYTE_PAIR(0xD7AA, 0x763B)
+DOUBLE_BYTE_PAIR(0xD7AB, 0x7D2F)
+DOUBLE_BYTE_PAIR(0xD7AC, 0x7E37)
+DOUBLE_BYTE_PAIR(0xD7AD, 0x851E)
+DOUBLE_BYTE_PAIR(0xD7AE, 0x8938)
+DOUBLE_BYTE_PAIR(0xD7AF, 0x93E4)
+DOUBLE_BYTE_PAIR(0xD7B0, 0x964B)
+DOUBLE_BYTE_PAIR(0xD7B1, 0x5289)
+DOUBLE_BYTE_PAIR(0xD7B2, 0x65D2)
+DOUBLE_BYTE_PAIR(0xD7B3, 0x67F3)
+DOUBLE_BYTE_PAIR(0xD7B4, 0x69B4)
+DOUBLE_BYTE_PAIR(0xD7B5, 0x6D41)
+DOUBLE_BYTE_PAIR(0xD7B6, 0x6E9C)
+DOUBLE_BYTE_PAIR(0xD7B7, 0x700F)
+DOUBLE_BYTE_PAIR(0xD7B8, 0x7409)
+DOUBLE_BYTE_PAIR(0xD7B9, 0x7460)
+DOUBLE_BYTE_PAIR(0xD7BA, 0x7559)
+DOUBLE_BYTE_PAIR(0xD7BB, 0x7624)
+DOUBLE_BYTE_PAIR(0xD7BC, 0x786B)
+DOUBLE_BYTE_PAIR(0xD7BD, 0x8B2C)
+DOUBLE_BYTE_PAIR(0xD7BE, 0x985E)
+DOUBLE_BYTE_PAIR(0xD7BF, 0x516D)
+DOUBLE_BYTE_PAIR(0xD7C0, 0x622E)
+DOUBLE_BYTE_PAIR(0xD7C1, 0x9678)
+DOUBLE_BYTE_PAIR(0xD7C2, 0x4F96)
+DOUBLE_BYTE_PAIR(0xD7C3, 0x502B)
+DOUBLE_BYTE_PAIR(0xD7C4, 0x5D19)
+DOUBLE_BYTE_PAIR(0xD7C5, 0x6DEA)
+DOUBLE_BYTE_PAIR(0xD7C6, 0x7DB8)
+DOUBLE_BYTE_PAIR(0xD7C7, 0x8F2A)
+DOUBLE_BYTE_PAIR(0xD7C8, 0x5F8B)
+DOUBLE_BYTE_PAIR(0xD7C9, 0x6144)
+DOUBLE_BYTE_PAIR(0xD7CA, 0x6817)
+DOUBLE_BYTE_PAIR(0xD7CB, 0xF961)
+DOUBLE_BYTE_PAIR(0xD7CC, 0x9686)
+DOUBLE_BYTE_PAIR(0xD7CD, 0x52D2)
+DOUBLE_BYTE_PAIR(0xD7CE, 0x808B)
+DOUBLE_BYTE_PAIR(0xD7CF, 0x51DC)
+DOUBLE_BYTE_PAIR(0xD7D0, 0x51CC)
+DOUBLE_BYTE_PAIR(0xD7D1, 0x695E)
+DOUBLE_BYTE_PAIR(0xD7D2, 0x7A1C)
+DOUBLE_BYTE_PAIR(0xD7D3, 0x7DBE)
+DOUBLE_BYTE_PAIR(0xD7D4, 0x83F1)
+DOUBLE_BYTE_PAIR(0xD7D5, 0x9675)
+DOUBLE_BYTE_PAIR(0xD7D6, 0x4FDA)
+DOUBLE_BYTE_PAIR(0xD7D7, 0x5229)
+DOUBLE_BYTE_PAIR(0xD7D8, 0x5398)
+DOUBLE_BYTE_PAIR(0xD7D9, 0x540F)
+DOUBLE_BYTE_PAIR(0xD7DA, 0x550E)
+DOUBLE_BYTE_PAIR(0xD7DB, 0x5C65)
+DOUBLE_BYTE_PAIR(0xD7DC, 0x60A7)
+DOUBLE_BYTE_PAIR(0xD7DD, 0x674E)
+DOUBLE_BYTE_PAIR(0xD7DE, 0x68A8)
+DOUBLE_BYTE_PAIR(0xD7DF, 0x6D6C)
+DOUBLE_BYTE_PAIR(0xD7E0, 0x7281)
+DOUBLE_BYTE_PAIR(0xD7E1, 0x72F8)
+DOUBLE_BYTE_PAIR(0xD7E2, 0x7406)
+DOUBLE_BYTE_PAIR(0xD7E3, 0x7483)
+DOUBLE_BYTE_PAIR(0xD7E4, 0xF962)
+DOUBLE_BYTE_PAIR(0xD7E5, 0x75E2)
+DOUBLE_BYTE_PAIR(0xD7E6, 0x7C6C)
+DOUBLE_BYTE_PAIR(0xD7E7, 0x7F79)
+DOUBLE_BYTE_PAIR(0xD7E8, 0x7FB8)
+DOUBLE_BYTE_PAIR(0xD7E9, 0x8389)
+DOUBLE_BYTE_PAIR(0xD7EA, 0x88CF)
+DOUBLE_BYTE_PAIR(0xD7EB, 0x88E1)
+DOUBLE_BYTE_PAIR(0xD7EC, 0x91CC)
+DOUBLE_BYTE_PAIR(0xD7ED, 0x91D0)
+DOUBLE_BYTE_PAIR(0xD7EE, 0x96E2)
+DOUBLE_BYTE_PAIR(0xD7EF, 0x9BC9)
+DOUBLE_BYTE_PAIR(0xD7F0, 0x541D)
+DOUBLE_BYTE_PAIR(0xD7F1, 0x6F7E)
+DOUBLE_BYTE_PAIR(0xD7F2, 0x71D0)
+DOUBLE_BYTE_PAIR(0xD7F3, 0x7498)
+DOUBLE_BYTE_PAIR(0xD7F4, 0x85FA)
+DOUBLE_BYTE_PAIR(0xD7F5, 0x8EAA)
+DOUBLE_BYTE_PAIR(0xD7F6, 0x96A3)
+DOUBLE_BYTE_PAIR(0xD7F7, 0x9C57)
+DOUBLE_BYTE_PAIR(0xD7F8, 0x9E9F)
+DOUBLE_BYTE_PAIR(0xD7F9, 0x6797)
+DOUBLE_BYTE_PAIR(0xD7FA, 0x6DCB)
+DOUBLE_BYTE_PAIR(0xD7FB, 0x7433)
+DOUBLE_BYTE_PAIR(0xD7FC, 0x81E8)
+DOUBLE_BYTE_PAIR(0xD7FD, 0x9716)
+DOUBLE_BYTE_PAIR(0xD7FE, 0x782C)
+DOUBLE_BYTE_PAIR(0xD8A1, 0x7ACB)
+DOUBLE_BYTE_PAIR(0xD8A2, 0x7B20)
+DOUBLE_BYTE_PAIR(0xD8A3, 0x7C92)
+DOUBLE_BYTE_PAIR(0xD8A4, 0x6469)
+DOUBLE_BYTE_PAIR(0xD8A5, 0x746A)
+DOUBLE_BYTE_PAIR(0xD8A6, 0x75F2)
+DOUBLE_BYTE_PAIR(0xD8A7, 0x78BC)
+DOUBLE_BYTE_PAIR(0xD8A8, 0x78E8)
+DOUBLE_BYTE_PAIR(0xD8A9, 0x99AC)
+DOUBLE_BYTE_PAIR(0xD8AA, 0x9B54)
+DOUBLE_BYTE_PAIR(0xD8AB, 0x9EBB)
+DOUBLE_BYTE_PAIR(0xD8AC, 0x5BDE)
+DOUBLE_BYTE_PAIR(0xD8AD, 0x5E55)
+DOUBLE_BYTE_PAIR(0xD8AE, 0x6F20)
+DOUBLE_BYTE_PAIR(0xD8AF, 0x819C)
+DOUBLE_BYTE_PAIR(0xD8B0, 0x83AB)
+DOUBLE_BYTE_PAIR(0xD8B1, 0x9088)
+DOUBLE_BYTE_PAIR(0xD8B2, 0x4E07)
+DOUBLE_BYTE_PAIR(0xD8B3, 0x534D)
+DOUBLE_BYTE_PAIR(0xD8B4, 0x5A29)
+DOUBLE_BYTE_PAIR(0xD8B5, 0x5DD2)
+DOUBLE_BYTE_PAIR(0xD8B6, 0x5F4E)
+DOUBLE_BYTE_PAIR(0xD8B7, 0x6162)
+DOUBLE_BYTE_PAIR(0xD8B8, 0x633D)
+DOUBLE_BYTE_PAIR(0xD8B9, 0x6669)
+DOUBLE_BYTE_PAIR(0xD8BA, 0x66FC)
+DOUBLE_BYTE_PAIR(0xD8BB, 0x6EFF)
+DOUBLE_BYTE_PAIR(0xD8BC, 0x6F2B)
+DOUBLE_BYTE_PAIR(0xD8BD, 0x7063)
+DOUBLE_BYTE_PAIR(0xD8BE, 0x779E)
+DOUBLE_BYTE_PAIR(0xD8BF, 0x842C)
+DOUBLE_BYTE_PAIR(0xD8C0, 0x8513)
+DOUBLE_BYTE_PAIR(0xD8C1, 0x883B)
+DOUBLE_BYTE_PAIR(0xD8C2, 0x8F13)
+DOUBLE_BYTE_PAIR(0xD8C3, 0x9945)
+DOUBLE_BYTE_PAIR(0xD8C4, 0x9C3B)
+DOUBLE_BYTE_PAIR(0xD8C5, 0x551C)
+DOUBLE_BYTE_PAIR(0xD8C6, 0x62B9)
+DOUBLE_BYTE_PAIR(0xD8C7, 0x672B)
+DOUBLE_BYTE_PAIR(0xD8C8, 0x6CAB)
+DOUBLE_BYTE_PAIR(0xD8C9, 0x8309)
+DOUBLE_BYTE_PAIR(0xD8CA, 0x896A)
+DOUBLE_BYTE_PAIR(0xD8CB, 0x977A)
+DOUBLE_BYTE_PAIR(0xD8CC, 0x4EA1)
+DOUBLE_BYTE_PAIR(0xD8CD, 0x5984)
+DOUBLE_BYTE_PAIR(0xD8CE, 0x5FD8)
+DOUBLE_BYTE_PAIR(0xD8CF, 0x5FD9)
+DOUBLE_BYTE_PAIR(0xD8D0, 0x671B)
+DOUBLE_BYTE_PAIR(0xD8D1, 0x7DB2)
+DOUBLE_BYTE_PAIR(0xD8D2, 0x7F54)
+DOUBLE_BYTE_PAIR(0xD8D3, 0x8292)
+DOUBLE_BYTE_PAIR(0xD8D4, 0x832B)
+DOUBLE_BYTE_PAIR(0xD8D5, 0x83BD)
+DOUBLE_BYTE_PAIR(0xD8D6, 0x8F1E)
+DOUBLE_BYTE_PAIR(0xD8D7, 0x9099)
+DOUBLE_BYTE_PAIR(0xD8D8, 0x57CB)
+DOUBLE_BYTE_PAIR(0xD8D9, 0x59B9)
+DOUBLE_BYTE_PAIR(0xD8DA, 0x5A92)
+DOUBLE_BYTE_PAIR(0xD8DB, 0x5BD0)
+DOUBLE_BYTE_PAIR(0xD8DC, 0x6627)
+DOUBLE_BYTE_PAIR(0xD8DD, 0x679A)
+DOUBLE_BYTE_PAIR(0xD8DE, 0x6885)
+DOUBLE_BYTE_PAIR(0xD8DF, 0x6BCF)
+DOUBLE_BYTE_PAIR(0xD8E0, 0x7164)
+DOUBLE_BYTE_PAIR(0xD8E1, 0x7F75)
+DOUBLE_BYTE_PAIR(0xD8E2, 0x8CB7)
+DOUBLE_BYTE_PAIR(0xD8E3, 0x8CE3)
+DOUBLE_BYTE_PAIR(0xD8E4, 0x9081)
+DOUBLE_BYTE_PAIR(0xD8E5, 0x9B45)
+DOUBLE_BYTE_PAIR(0xD8E6, 0x8108)
+DOUBLE_BYTE_PAIR(0xD8E7, 0x8C8A)
+DOUBLE_BYTE_PAIR(0xD8E8, 0x964C)
+DOUBLE_BYTE_PAIR(0xD8E9, 0x9A40)
+DOUBLE_BYTE_PAIR(0xD8EA, 0x9EA5)
+DOUBLE_BYTE_PAIR(0xD8EB, 0x5B5F)
+DOUBLE_BYTE_PAIR(0xD8EC, 0x6C13)
+DOUBLE_BYTE_PAIR(0xD8ED, 0x731B)
+DOUBLE_BYTE_PAIR(0xD8EE, 0x76F2)
+DOUBLE_BYTE_PAIR(0xD8EF, 0x76DF)
+DOUBLE_BYTE_PAIR(0xD8F0, 0x840C)
+DOUBLE_BYTE_PAIR(0xD8F1, 0x51AA)
+DOUBLE_BYTE_PAIR(0xD8F2, 0x8993)
+DOUBLE_BYTE_PAIR(0xD8F3, 0x514D)
+DOUBLE_BYTE_PAIR(0xD8F4, 0x5195)
+DOUBLE_BYTE_PAIR(0xD8F5, 0x52C9)
+DOUBLE_BYTE_PAIR(0xD8F6, 0x68C9)
+DOUBLE_BYTE_PAIR(0xD8F7, 0x6C94)
+DOUBLE_BYTE_PAIR(0xD8F8, 0x7704)
+DOUBLE_BYTE_PAIR(0xD8F9, 0x7720)
+DOUBLE_BYTE_PAIR(0xD8FA, 0x7DBF)
+DOUBLE_BYTE_PAIR(0xD8FB, 0x7DEC)
+DOUBLE_BYTE_PAIR(0xD8FC, 0x9762)
+DOUBLE_BYTE_PAIR(0xD8FD, 0x9EB5)
+DOUBLE_BYTE_PAIR(0xD8FE, 0x6EC5)
+DOUBLE_BYTE_PAIR(0xD9A1, 0x8511)
+DOUBLE_BYTE_PAIR(0xD9A2, 0x51A5)
+DOUBLE_BYTE_PAIR(0xD9A3, 0x540D)
+DOUBLE_BYTE_PAIR(0xD9A4, 0x547D)
+DOUBLE_BYTE_PAIR(0xD9A5, 0x660E)
+DOUBLE_BYTE_PAIR(0xD9A6, 0x669D)
+DOUBLE_BYTE_PAIR(0xD9A7, 0x6927)
+DOUBLE_BYTE_PAIR(0xD9A8, 0x6E9F)
+DOUBLE_BYTE_PAIR(0xD9A9, 0x76BF)
+DOUBLE_BYTE_PAIR(0xD9AA, 0x7791)
+DOUBLE_BYTE_PAIR(0xD9AB, 0x8317)
+DOUBLE_BYTE_PAIR(0xD9AC, 0x84C2)
+DOUBLE_BYTE_PAIR(0xD9AD, 0x879F)
+DOUBLE_BYTE_PAIR(0xD9AE, 0x9169)
+DOUBLE_BYTE_PAIR(0xD9AF, 0x9298)
+DOUBLE_BYTE_PAIR(0xD9B0, 0x9CF4)
+DOUBLE_BYTE_PAIR(0xD9B1, 0x8882)
+DOUBLE_BYTE_PAIR(0xD9B2, 0x4FAE)
+DOUBLE_BYTE_PAIR(0xD9B3, 0x5192)
+DOUBLE_BYTE_PAIR(0xD9B4, 0x52DF)
+DOUBLE_BYTE_PAIR(0xD9B5, 0x59C6)
+DOUBLE_BYTE_PAIR(0xD9B6, 0x5E3D)
+DOUBLE_BYTE_PAIR(0xD9B7, 0x6155)
+DOUBLE_BYTE_PAIR(0xD9B8, 0x6478)
+DOUBLE_BYTE_PAIR(0xD9B9, 0x6479)
+DOUBLE_BYTE_PAIR(0xD9BA, 0x66AE)
+DOUBLE_BYTE_PAIR(0xD9BB, 0x67D0)
+DOUBLE_BYTE_PAIR(0xD9BC, 0x6A21)
+DOUBLE_BYTE_PAIR(0xD9BD, 0x6BCD)
+DOUBLE_BYTE_PAIR(0xD9BE, 0x6BDB)
+DOUBLE_BYTE_PAIR(0xD9BF, 0x725F)
+DOUBLE_BYTE_PAIR(0xD9C0, 0x7261)
+DOUBLE_BYTE_PAIR(0xD9C1, 0x7441)
+DOUBLE_BYTE_PAIR(0xD9C2, 0x7738)
+DOUBLE_BYTE_PAIR(0xD9C3, 0x77DB)
+DOUBLE_BYTE_PAIR(0xD9C4, 0x8017)
+DOUBLE_BYTE_PAIR(0xD9C5, 0x82BC)
+DOUBLE_BYTE_PAIR(0xD9C6, 0x8305)
+DOUBLE_BYTE_PAIR(0xD9C7, 0x8B00)
+DOUBLE_BYTE_PAIR(0xD9C8, 0x8B28)
+DOUBLE_BYTE_PAIR(0xD9C9, 0x8C8C)
+DOUBLE_BYTE_PAIR(0xD9CA, 0x6728)
+DOUBLE_BYTE_PAIR(0xD9CB, 0x6C90)
+DOUBLE_BYTE_PAIR(0xD9CC, 0x7267)
+DOUBLE_BYTE_PAIR(0xD9CD, 0x76EE)
+DOUBLE_BYTE_PAIR(0xD9CE, 0x7766)
+DOUBLE_BYTE_PAIR(0xD9CF, 0x7A46)
+DOUBLE_BYTE_PAIR(0xD9D0, 0x9DA9)
+DOUBLE_BYTE_PAIR(0xD9D1, 0x6B7F)
+DOUBLE_BYTE_PAIR(0xD9D2, 0x6C92)
+DOUBLE_BYTE_PAIR(0xD9D3, 0x5922)
+DOUBLE_BYTE_PAIR(0xD9D4, 0x6726)
+DOUBLE_BYTE_PAIR(0xD9D5, 0x8499)
+DOUBLE_BYTE_PAIR(0xD9D6, 0x536F)
+DOUBLE_BYTE_PAIR(0xD9D7, 0x5893)
+DOUBLE_BYTE_PAIR(0xD9D8, 0x5999)
+DOUBLE_BYTE_PAIR(0xD9D9, 0x5EDF)
+DOUBLE_BYTE_PAIR(0xD9DA, 0x63CF)
+DOUBLE_BYTE_PAIR(0xD9DB, 0x6634)
+DOUBLE_BYTE_PAIR(0xD9DC, 0x6773)
+DOUBLE_BYTE_PAIR(0xD9DD, 0x6E3A)
+DOUBLE_BYTE_PAIR(0xD9DE, 0x732B)
+DOUBLE_BYTE_PAIR(0xD9DF, 0x7AD7)
+DOUBLE_BYTE_PAIR(0xD9E0, 0x82D7)
+DOUBLE_BYTE_PAIR(0xD9E1, 0x9328)
+DOUBLE_BYTE_PAIR(0xD9E2, 0x52D9)
+DOUBLE_BYTE_PAIR(0xD9E3, 0x5DEB)
+DOUBLE_BYTE_PAIR(0xD9E4, 0x61AE)
+DOUBLE_BYTE_PAIR(0xD9E5, 0x61CB)
+DOUBLE_BYTE_PAIR(0xD9E6, 0x620A)
+DOUBLE_BYTE_PAIR(0xD9E7, 0x62C7)
+DOUBLE_BYTE_PAIR(0xD9E8, 0x64AB)
+DOUBLE_BYTE_PAIR(0xD9E9, 0x65E0)
+DOUBLE_BYTE_PAIR(0xD9EA, 0x6959)
+DOUBLE_BYTE_PAIR(0xD9EB, 0x6B66)
+DOUBLE_BYTE_PAIR(0xD9EC, 0x6BCB)
+DOUBLE_BYTE_PAIR(0xD9ED, 0x7121)
+DOUBLE_BYTE_PAIR(0xD9EE, 0x73F7)
+DOUBLE_BYTE_PAIR(0xD9EF, 0x755D)
+DOUBLE_BYTE_PAIR(0xD9F0, 0x7E46)
+DOUBLE_BYTE_PAIR(0xD9F1, 0x821E)
+DOUBLE_BYTE_PAIR(0xD9F2, 0x8302)
+DOUBLE_BYTE_PAIR(0xD9F3, 0x856A)
+DOUBLE_BYTE_PAIR(0xD9F4, 0x8AA3)
+DOUBLE_BYTE_PAIR(0xD9F5, 0x8CBF)
+DOUBLE_BYTE_PAIR(0xD9F6, 0x9727)
+DOUBLE_BYTE_PAIR(0xD9F7, 0x9D61)
+DOUBLE_BYTE_PAIR(0xD9F8, 0x58A8)
+DOUBLE_BYTE_PAIR(0xD9F9, 0x9ED8)
+DOUBLE_BYTE_PAIR(0xD9FA, 0x5011)
+DOUBLE_BYTE_PAIR(0xD9FB, 0x520E)
+DOUBLE_BYTE_PAIR(0xD9FC, 0x543B)
+DOUBLE_BYTE_PAIR(0xD9FD, 0x554F)
+DOUBLE_BYTE_PAIR(0xD9FE, 0x6587)
+DOUBLE_BYTE_PAIR(0xDAA1, 0x6C76)
+DOUBLE_BYTE_PAIR(0xDAA2, 0x7D0A)
+DOUBLE_BYTE_PAIR(0xDAA3, 0x7D0B)
+DOUBLE_BYTE_PAIR(0xDAA4, 0x805E)
+DOUBLE_BYTE_PAIR(0xDAA5, 0x868A)
+DOUBLE_BYTE_PAIR(0xDAA6, 0x9580)
+DOUBLE_BYTE_PAIR(0xDAA7, 0x96EF)
+DOUBLE_BYTE_PAIR(0xDAA8, 0x52FF)
+DOUBLE_BYTE_PAIR(0xDAA9, 0x6C95)
+DOUBLE_BYTE_PAIR(0xDAAA, 0x7269)
+DOUBLE_BYTE_PAIR(0xDAAB, 0x5473)
+DOUBLE_BYTE_PAIR(0xDAAC, 0x5A9A)
+DOUBLE_BYTE_PAIR(0xDAAD, 0x5C3E)
+DOUBLE_BYTE_PAIR(0xDAAE, 0x5D4B)
+DOUBLE_BYTE_PAIR(0xDAAF, 0x5F4C)
+DOUBLE_BYTE_PAIR(0xDAB0, 0x5FAE)
+DOUBLE_BYTE_PAIR(0xDAB1, 0x672A)
+DOUBLE_BYTE_PAIR(0xDAB2, 0x68B6)
+DOUBLE_BYTE_PAIR(0xDAB3, 0x6963)
+DOUBLE_BYTE_PAIR(0xDAB4, 0x6E3C)
+DOUBLE_BYTE_PAIR(0xDAB5, 0x6E44)
+DOUBLE_BYTE_PAIR(0xDAB6, 0x7709)
+DOUBLE_BYTE_PAIR(0xDAB7, 0x7C73)
+DOUBLE_BYTE_PAIR(0xDAB8, 0x7F8E)
+DOUBLE_BYTE_PAIR(0xDAB9, 0x8587)
+DOUBLE_BYTE_PAIR(0xDABA, 0x8B0E)
+DOUBLE_BYTE_PAIR(0xDABB, 0x8FF7)
+DOUBLE_BYTE_PAIR(0xDABC, 0x9761)
+DOUBLE_BYTE_PAIR(0xDABD, 0x9EF4)
+DOUBLE_BYTE_PAIR(0xDABE, 0x5CB7)
+DOUBLE_BYTE_PAIR(0xDABF, 0x60B6)
+DOUBLE_BYTE_PAIR(0xDAC0, 0x610D)
+DOUBLE_BYTE_PAIR(0xDAC1, 0x61AB)
+DOUBLE_BYTE_PAIR(0xDAC2, 0x654F)
+DOUBLE_BYTE_PAIR(0xDAC3, 0x65FB)
+DOUBLE_BYTE_PAIR(0xDAC4, 0x65FC)
+DOUBLE_BYTE_PAIR(0xDAC5, 0x6C11)
+DOUBLE_BYTE_PAIR(0xDAC6, 0x6CEF)
+DOUBLE_BYTE_PAIR(0xDAC7, 0x739F)
+DOUBLE_BYTE_PAIR(0xDAC8, 0x73C9)
+DOUBLE_BYTE_PAIR(0xDAC9, 0x7DE1)
+DOUBLE_BYTE_PAIR(0xDACA, 0x9594)
+DOUBLE_BYTE_PAIR(0xDACB, 0x5BC6)
+DOUBLE_BYTE_PAIR(0xDACC, 0x871C)
+DOUBLE_BYTE_PAIR(0xDACD, 0x8B10)
+DOUBLE_BYTE_PAIR(0xDACE, 0x525D)
+DOUBLE_BYTE_PAIR(0xDACF, 0x535A)
+DOUBLE_BYTE_PAIR(0xDAD0, 0x62CD)
+DOUBLE_BYTE_PAIR(0xDAD1, 0x640F)
+DOUBLE_BYTE_PAIR(0xDAD2, 0x64B2)
+DOUBLE_BYTE_PAIR(0xDAD3, 0x6734)
+DOUBLE_BYTE_PAIR(0xDAD4, 0x6A38)
+DOUBLE_BYTE_PAIR(0xDAD5, 0x6CCA)
+DOUBLE_BYTE_PAIR(0xDAD6, 0x73C0)
+DOUBLE_BYTE_PAIR(0xDAD7, 0x749E)
+DOUBLE_BYTE_PAIR(0xDAD8, 0x7B94)
+DOUBLE_BYTE_PAIR(0xDAD9, 0x7C95)
+DOUBLE_BYTE_PAIR(0xDADA, 0x7E1B)
+DOUBLE_BYTE_PAIR(0xDADB, 0x818A)
+DOUBLE_BYTE_PAIR(0xDADC, 0x8236)
+DOUBLE_BYTE_PAIR(0xDADD, 0x8584)
+DOUBLE_BYTE_PAIR(0xDADE, 0x8FEB)
+DOUBLE_BYTE_PAIR(0xDADF, 0x96F9)
+DOUBLE_BYTE_PAIR(0xDAE0, 0x99C1)
+DOUBLE_BYTE_PAIR(0xDAE1, 0x4F34)
+DOUBLE_BYTE_PAIR(0xDAE2, 0x534A)
+DOUBLE_BYTE_PAIR(0xDAE3, 0x53CD)
+DOUBLE_BYTE_PAIR(0xDAE4, 0x53DB)
+DOUBLE_BYTE_PAIR(0xDAE5, 0x62CC)
+DOUBLE_BYTE_PAIR(0xDAE6, 0x642C)
+DOUBLE_BYTE_PAIR(0xDAE7, 0x6500)
+DOUBLE_BYTE_PAIR(0xDAE8, 0x6591)
+DOUBLE_BYTE_PAIR(0xDAE9, 0x69C3)
+DOUBLE_BYTE_PAIR(0xDAEA, 0x6CEE)
+DOUBLE_BYTE_PAIR(0xDAEB, 0x6F58)
+DOUBLE_BYTE_PAIR(0xDAEC, 0x73ED)
+DOUBLE_BYTE_PAIR(0xDAED, 0x7554)
+DOUBLE_BYTE_PAIR(0xDAEE, 0x7622)
+DOUBLE_BYTE_PAIR(0xDAEF, 0x76E4)
+DOUBLE_BYTE_PAIR(0xDAF0, 0x76FC)
+DOUBLE_BYTE_PAIR(0xDAF1, 0x78D0)
+DOUBLE_BYTE_PAIR(0xDAF2, 0x78FB)
+DOUBLE_BYTE_PAIR(0xDAF3, 0x792C)
+DOUBLE_BYTE_PAIR(0xDAF4, 0x7D46)
+DOUBLE_BYTE_PAIR(0xDAF5, 0x822C)
+DOUBLE_BYTE_PAIR(0xDAF6, 0x87E0)
+DOUBLE_BYTE_PAIR(0xDAF7, 0x8FD4)
+DOUBLE_BYTE_PAIR(0xDAF8, 0x9812)
+DOUBLE_BYTE_PAIR(0xDAF9, 0x98EF)
+DOUBLE_BYTE_PAIR(0xDAFA, 0x52C3)
+DOUBLE_BYTE_PAIR(0xDAFB, 0x62D4)
+DOUBLE_BYTE_PAIR(0xDAFC, 0x64A5)
+DOUBLE_BYTE_PAIR(0xDAFD, 0x6E24)
+DOUBLE_BYTE_PAIR(0xDAFE, 0x6F51)
+DOUBLE_BYTE_PAIR(0xDBA1, 0x767C)
+DOUBLE_BYTE_PAIR(0xDBA2, 0x8DCB)
+DOUBLE_BYTE_PAIR(0xDBA3, 0x91B1)
+DOUBLE_BYTE_PAIR(0xDBA4, 0x9262)
+DOUBLE_BYTE_PAIR(0xDBA5, 0x9AEE)
+DOUBLE_BYTE_PAIR(0xDBA6, 0x9B43)
+DOUBLE_BYTE_PAIR(0xDBA7, 0x5023)
+DOUBLE_BYTE_PAIR(0xDBA8, 0x508D)
+DOUBLE_BYTE_PAIR(0xDBA9, 0x574A)
+DOUBLE_BYTE_PAIR(0xDBAA, 0x59A8)
+DOUBLE_BYTE_PAIR(0xDBAB, 0x5C28)
+DOUBLE_BYTE_PAIR(0xDBAC, 0x5E47)
+DOUBLE_BYTE_PAIR(0xDBAD, 0x5F77)
+DOUBLE_BYTE_PAIR(0xDBAE, 0x623F)
+DOUBLE_BYTE_PAIR(0xDBAF, 0x653E)
+DOUBLE_BYTE_PAIR(0xDBB0, 0x65B9)
+DOUBLE_BYTE_PAIR(0xDBB1, 0x65C1)
+DOUBLE_BYTE_PAIR(0xDBB2, 0x6609)
+DOUBLE_BYTE_PAIR(0xDBB3, 0x678B)
+DOUBLE_BYTE_PAIR(0xDBB4, 0x699C)
+DOUBLE_BYTE_PAIR(0xDBB5, 0x6EC2)
+DOUBLE_BYTE_PAIR(0xDBB6, 0x78C5)
+DOUBLE_BYTE_PAIR(0xDBB7, 0x7D21)
+DOUBLE_BYTE_PAIR(0xDBB8, 0x80AA)
+DOUBLE_BYTE_PAIR(0xDBB9, 0x8180)
+DOUBLE_BYTE_PAIR(0xDBBA, 0x822B)
+DOUBLE_BYTE_PAIR(0xDBBB, 0x82B3)
+DOUBLE_BYTE_PAIR(0xDBBC, 0x84A1)
+DOUBLE_BYTE_PAIR(0xDBBD, 0x868C)
+DOUBLE_BYTE_PAIR(0xDBBE, 0x8A2A)
+DOUBLE_BYTE_PAIR(0xDBBF, 0x8B17)
+DOUBLE_BYTE_PAIR(0xDBC0, 0x90A6)
+DOUBLE_BYTE_PAIR(0xDBC1, 0x9632)
+DOUBLE_BYTE_PAIR(0xDBC2, 0x9F90)
+DOUBLE_BYTE_PAIR(0xDBC3, 0x500D)
+DOUBLE_BYTE_PAIR(0xDBC4, 0x4FF3)
+DOUBLE_BYTE_PAIR(0xDBC5, 0xF963)
+DOUBLE_BYTE_PAIR(0xDBC6, 0x57F9)
+DOUBLE_BYTE_PAIR(0xDBC7, 0x5F98)
+DOUBLE_BYTE_PAIR(0xDBC8, 0x62DC)
+DOUBLE_BYTE_PAIR(0xDBC9, 0x6392)
+DOUBLE_BYTE_PAIR(0xDBCA, 0x676F)
+DOUBLE_BYTE_PAIR(0xDBCB, 0x6E43)
+DOUBLE_BYTE_PAIR(0xDBCC, 0x7119)
+DOUBLE_BYTE_PAIR(0xDBCD, 0x76C3)
+DOUBLE_BYTE_PAIR(0xDBCE, 0x80CC)
+DOUBLE_BYTE_PAIR(0xDBCF, 0x80DA)
+DOUBLE_BYTE_PAIR(0xDBD0, 0x88F4)
+DOUBLE_BYTE_PAIR(0xDBD1, 0x88F5)
+DOUBLE_BYTE_PAIR(0xDBD2, 0x8919)
+DOUBLE_BYTE_PAIR(0xDBD3, 0x8CE0)
+DOUBLE_BYTE_PAIR(0xDBD4, 0x8F29)
+DOUBLE_BYTE_PAIR(0xDBD5, 0x914D)
+DOUBLE_BYTE_PAIR(0xDBD6, 0x966A)
+DOUBLE_BYTE_PAIR(0xDBD7, 0x4F2F)
+DOUBLE_BYTE_PAIR(0xDBD8, 0x4F70)
+DOUBLE_BYTE_PAIR(0xDBD9, 0x5E1B)
+DOUBLE_BYTE_PAIR(0xDBDA, 0x67CF)
+DOUBLE_BYTE_PAIR(0xDBDB, 0x6822)
+DOUBLE_BYTE_PAIR(0xDBDC, 0x767D)
+DOUBLE_BYTE_PAIR(0xDBDD, 0x767E)
+DOUBLE_BYTE_PAIR(0xDBDE, 0x9B44)
+DOUBLE_BYTE_PAIR(0xDBDF, 0x5E61)
+DOUBLE_BYTE_PAIR(0xDBE0, 0x6A0A)
+DOUBLE_BYTE_PAIR(0xDBE1, 0x7169)
+DOUBLE_BYTE_PAIR(0xDBE2, 0x71D4)
+DOUBLE_BYTE_PAIR(0xDBE3, 0x756A)
+DOUBLE_BYTE_PAIR(0xDBE4, 0xF964)
+DOUBLE_BYTE_PAIR(0xDBE5, 0x7E41)
+DOUBLE_BYTE_PAIR(0xDBE6, 0x8543)
+DOUBLE_BYTE_PAIR(0xDBE7, 0x85E9)
+DOUBLE_BYTE_PAIR(0xDBE8, 0x98DC)
+DOUBLE_BYTE_PAIR(0xDBE9, 0x4F10)
+DOUBLE_BYTE_PAIR(0xDBEA, 0x7B4F)
+DOUBLE_BYTE_PAIR(0xDBEB, 0x7F70)
+DOUBLE_BYTE_PAIR(0xDBEC, 0x95A5)
+DOUBLE_BYTE_PAIR(0xDBED, 0x51E1)
+DOUBLE_BYTE_PAIR(0xDBEE, 0x5E06)
+DOUBLE_BYTE_PAIR(0xDBEF, 0x68B5)
+DOUBLE_BYTE_PAIR(0xDBF0, 0x6C3E)
+DOUBLE_BYTE_PAIR(0xDBF1, 0x6C4E)
+DOUBLE_BYTE_PAIR(0xDBF2, 0x6CDB)
+DOUBLE_BYTE_PAIR(0xDBF3, 0x72AF)
+DOUBLE_BYTE_PAIR(0xDBF4, 0x7BC4)
+DOUBLE_BYTE_PAIR(0xDBF5, 0x8303)
+DOUBLE_BYTE_PAIR(0xDBF6, 0x6CD5)
+DOUBLE_BYTE_PAIR(0xDBF7, 0x743A)
+DOUBLE_BYTE_PAIR(0xDBF8, 0x50FB)
+DOUBLE_BYTE_PAIR(0xDBF9, 0x5288)
+DOUBLE_BYTE_PAIR(0xDBFA, 0x58C1)
+DOUBLE_BYTE_PAIR(0xDBFB, 0x64D8)
+DOUBLE_BYTE_PAIR(0xDBFC, 0x6A97)
+DOUBLE_BYTE_PAIR(0xDBFD, 0x74A7)
+DOUBLE_BYTE_PAIR(0xDBFE, 0x7656)
+DOUBLE_BYTE_PAIR(0xDCA1, 0x78A7)
+DOUBLE_BYTE_PAIR(0xDCA2, 0x8617)
+DOUBLE_BYTE_PAIR(0xDCA3, 0x95E2)
+DOUBLE_BYTE_PAIR(0xDCA4, 0x9739)
+DOUBLE_BYTE_PAIR(0xDCA5, 0xF965)
+DOUBLE_BYTE_PAIR(0xDCA6, 0x535E)
+DOUBLE_BYTE_PAIR(0xDCA7, 0x5F01)
+DOUBLE_BYTE_PAIR(0xDCA8, 0x8B8A)
+DOUBLE_BYTE_PAIR(0xDCA9, 0x8FA8)
+DOUBLE_BYTE_PAIR(0xDCAA, 0x8FAF)
+DOUBLE_BYTE_PAIR(0xDCAB, 0x908A)
+DOUBLE_BYTE_PAIR(0xDCAC, 0x5225)
+DOUBLE_BYTE_PAIR(0xDCAD, 0x77A5)
+DOUBLE_BYTE_PAIR(0xDCAE, 0x9C49)
+DOUBLE_BYTE_PAIR(0xDCAF, 0x9F08)
+DOUBLE_BYTE_PAIR(0xDCB0, 0x4E19)
+DOUBLE_BYTE_PAIR(0xDCB1, 0x5002)
+DOUBLE_BYTE_PAIR(0xDCB2, 0x5175)
+DOUBLE_BYTE_PAIR(0xDCB3, 0x5C5B)
+DOUBLE_BYTE_PAIR(0xDCB4, 0x5E77)
+DOUBLE_BYTE_PAIR(0xDCB5, 0x661E)
+DOUBLE_BYTE_PAIR(0xDCB6, 0x663A)
+DOUBLE_BYTE_PAIR(0xDCB7, 0x67C4)
+DOUBLE_BYTE_PAIR(0xDCB8, 0x68C5)
+DOUBLE_BYTE_PAIR(0xDCB9, 0x70B3)
+DOUBLE_BYTE_PAIR(0xDCBA, 0x7501)
+DOUBLE_BYTE_PAIR(0xDCBB, 0x75C5)
+DOUBLE_BYTE_PAIR(0xDCBC, 0x79C9)
+DOUBLE_BYTE_PAIR(0xDCBD, 0x7ADD)
+DOUBLE_BYTE_PAIR(0xDCBE, 0x8F27)
+DOUBLE_BYTE_PAIR(0xDCBF, 0x9920)
+DOUBLE_BYTE_PAIR(0xDCC0, 0x9A08)
+DOUBLE_BYTE_PAIR(0xDCC1, 0x4FDD)
+DOUBLE_BYTE_PAIR(0xDCC2, 0x5821)
+DOUBLE_BYTE_PAIR(0xDCC3, 0x5831)
+DOUBLE_BYTE_PAIR(0xDCC4, 0x5BF6)
+DOUBLE_BYTE_PAIR(0xDCC5, 0x666E)
+DOUBLE_BYTE_PAIR(0xDCC6, 0x6B65)
+DOUBLE_BYTE_PAIR(0xDCC7, 0x6D11)
+DOUBLE_BYTE_PAIR(0xDCC8, 0x6E7A)
+DOUBLE_BYTE_PAIR(0xDCC9, 0x6F7D)
+DOUBLE_BYTE_PAIR(0xDCCA, 0x73E4)
+DOUBLE_BYTE_PAIR(0xDCCB, 0x752B)
+DOUBLE_BYTE_PAIR(0xDCCC, 0x83E9)
+DOUBLE_BYTE_PAIR(0xDCCD, 0x88DC)
+DOUBLE_BYTE_PAIR(0xDCCE, 0x8913)
+DOUBLE_BYTE_PAIR(0xDCCF, 0x8B5C)
+DOUBLE_BYTE_PAIR(0xDCD0, 0x8F14)
+DOUBLE_BYTE_PAIR(0xDCD1, 0x4F0F)
+DOUBLE_BYTE_PAIR(0xDCD2, 0x50D5)
+DOUBLE_BYTE_PAIR(0xDCD3, 0x5310)
+DOUBLE_BYTE_PAIR(0xDCD4, 0x535C)
+DOUBLE_BYTE_PAIR(0xDCD5, 0x5B93)
+DOUBLE_BYTE_PAIR(0xDCD6, 0x5FA9)
+DOUBLE_BYTE_PAIR(0xDCD7, 0x670D)
+DOUBLE_BYTE_PAIR(0xDCD8, 0x798F)
+DOUBLE_BYTE_PAIR(0xDCD9, 0x8179)
+DOUBLE_BYTE_PAIR(0xDCDA, 0x832F)
+DOUBLE_BYTE_PAIR(0xDCDB, 0x8514)
+DOUBLE_BYTE_PAIR(0xDCDC, 0x8907)
+DOUBLE_BYTE_PAIR(0xDCDD, 0x8986)
+DOUBLE_BYTE_PAIR(0xDCDE, 0x8F39)
+DOUBLE_BYTE_PAIR(0xDCDF, 0x8F3B)
+DOUBLE_BYTE_PAIR(0xDCE0, 0x99A5)
+DOUBLE_BYTE_PAIR(0xDCE1, 0x9C12)
+DOUBLE_BYTE_PAIR(0xDCE2, 0x672C)
+DOUBLE_BYTE_PAIR(0xDCE3, 0x4E76)
+DOUBLE_BYTE_PAIR(0xDCE4, 0x4FF8)
+DOUBLE_BYTE_PAIR(0xDCE5, 0x5949)
+DOUBLE_BYTE_PAIR(0xDCE6, 0x5C01)
+DOUBLE_BYTE_PAIR(0xDCE7, 0x5CEF)
+DOUBLE_BYTE_PAIR(0xDCE8, 0x5CF0)
+DOUBLE_BYTE_PAIR(0xDCE9, 0x6367)
+DOUBLE_BYTE_PAIR(0xDCEA, 0x68D2)
+DOUBLE_BYTE_PAIR(0xDCEB, 0x70FD)
+DOUBLE_BYTE_PAIR(0xDCEC, 0x71A2)
+DOUBLE_BYTE_PAIR(0xDCED, 0x742B)
+DOUBLE_BYTE_PAIR(0xDCEE, 0x7E2B)
+DOUBLE_BYTE_PAIR(0xDCEF, 0x84EC)
+DOUBLE_BYTE_PAIR(0xDCF0, 0x8702)
+DOUBLE_BYTE_PAIR(0xDCF1, 0x9022)
+DOUBLE_BYTE_PAIR(0xDCF2, 0x92D2)
+DOUBLE_BYTE_PAIR(0xDCF3, 0x9CF3)
+DOUBLE_BYTE_PAIR(0xDCF4, 0x4E0D)
+DOUBLE_BYTE_PAIR(0xDCF5, 0x4ED8)
+DOUBLE_BYTE_PAIR(0xDCF6, 0x4FEF)
+DOUBLE_BYTE_PAIR(0xDCF7, 0x5085)
+DOUBLE_BYTE_PAIR(0xDCF8, 0x5256)
+DOUBLE_BYTE_PAIR(0xDCF9, 0x526F)
+DOUBLE_BYTE_PAIR(0xDCFA, 0x5426)
+DOUBLE_BYTE_PAIR(0xDCFB, 0x5490)
+DOUBLE_BYTE_PAIR(0xDCFC, 0x57E0)
+DOUBLE_BYTE_PAIR(0xDCFD, 0x592B)
+DOUBLE_BYTE_PAIR(0xDCFE, 0x5A66)
+DOUBLE_BYTE_PAIR(0xDDA1, 0x5B5A)
+DOUBLE_BYTE_PAIR(0xDDA2, 0x5B75)
+DOUBLE_BYTE_PAIR(0xDDA3, 0x5BCC)
+DOUBLE_BYTE_PAIR(0xDDA4, 0x5E9C)
+DOUBLE_BYTE_PAIR(0xDDA5, 0xF966)
+DOUBLE_BYTE_PAIR(0xDDA6, 0x6276)
+DOUBLE_BYTE_PAIR(0xDDA7, 0x6577)
+DOUBLE_BYTE_PAIR(0xDDA8, 0x65A7)
+DOUBLE_BYTE_PAIR(0xDDA9, 0x6D6E)
+DOUBLE_BYTE_PAIR(0xDDAA, 0x6EA5)
+DOUBLE_BYTE_PAIR(0xDDAB, 0x7236)
+DOUBLE_BYTE_PAIR(0xDDAC, 0x7B26)
+DOUBLE_BYTE_PAIR(0xDDAD, 0x7C3F)
+DOUBLE_BYTE_PAIR(0xDDAE, 0x7F36)
+DOUBLE_BYTE_PAIR(0xDDAF, 0x8150)
+DOUBLE_BYTE_PAIR(0xDDB0, 0x8151)
+DOUBLE_BYTE_PAIR(0xDDB1, 0x819A)
+DOUBLE_BYTE_PAIR(0xDDB2, 0x8240)
+DOUBLE_BYTE_PAIR(0xDDB3, 0x8299)
+DOUBLE_BYTE_PAIR(0xDDB4, 0x83A9)
+DOUBLE_BYTE_PAIR(0xDDB5, 0x8A03)
+DOUBLE_BYTE_PAIR(0xDDB6, 0x8CA0)
+DOUBLE_BYTE_PAIR(0xDDB7, 0x8CE6)
+DOUBLE_BYTE_PAIR(0xDDB8, 0x8CFB)
+DOUBLE_BYTE_PAIR(0xDDB9, 0x8D74)
+DOUBLE_BYTE_PAIR(0xDDBA, 0x8DBA)
+DOUBLE_BYTE_PAIR(0xDDBB, 0x90E8)
+DOUBLE_BYTE_PAIR(0xDDBC, 0x91DC)
+DOUBLE_BYTE_PAIR(0xDDBD, 0x961C)
+DOUBLE_BYTE_PAIR(0xDDBE, 0x9644)
+DOUBLE_BYTE_PAIR(0xDDBF, 0x99D9)
+DOUBLE_BYTE_PAIR(0xDDC0, 0x9CE7)
+DOUBLE_BYTE_PAIR(0xDDC1, 0x5317)
+DOUBLE_BYTE_PAIR(0xDDC2, 0x5206)
+DOUBLE_BYTE_PAIR(0xDDC3, 0x5429)
+DOUBLE_BYTE_PAIR(0xDDC4, 0x5674)
+DOUBLE_BYTE_PAIR(0xDDC5, 0x58B3)
+DOUBLE_BYTE_PAIR(0xDDC6, 0x5954)
+DOUBLE_BYTE_PAIR(0xDDC7, 0x596E)
+DOUBLE_BYTE_PAIR(0xDDC8, 0x5FFF)
+DOUBLE_BYTE_PAIR(0xDDC9, 0x61A4)
+DOUBLE_BYTE_PAIR(0xDDCA, 0x626E)
+DOUBLE_BYTE_PAIR(0xDDCB, 0x6610)
+DOUBLE_BYTE_PAIR(0xDDCC, 0x6C7E)
+DOUBLE_BYTE_PAIR(0xDDCD, 0x711A)
+DOUBLE_BYTE_PAIR(0xDDCE, 0x76C6)
+DOUBLE_BYTE_PAIR(0xDDCF, 0x7C89)
+DOUBLE_BYTE_PAIR(0xDDD0, 0x7CDE)
+DOUBLE_BYTE_PAIR(0xDDD1, 0x7D1B)
+DOUBLE_BYTE_PAIR(0xDDD2, 0x82AC)
+DOUBLE_BYTE_PAIR(0xDDD3, 0x8CC1)
+DOUBLE_BYTE_PAIR(0xDDD4, 0x96F0)
+DOUBLE_BYTE_PAIR(0xDDD5, 0xF967)
+DOUBLE_BYTE_PAIR(0xDDD6, 0x4F5B)
+DOUBLE_BYTE_PAIR(0xDDD7, 0x5F17)
+DOUBLE_BYTE_PAIR(0xDDD8, 0x5F7F)
+DOUBLE_BYTE_PAIR(0xDDD9, 0x62C2)
+DOUBLE_BYTE_PAIR(0xDDDA, 0x5D29)
+DOUBLE_BYTE_PAIR(0xDDDB, 0x670B)
+DOUBLE_BYTE_PAIR(0xDDDC, 0x68DA)
+DOUBLE_BYTE_PAIR(0xDDDD, 0x787C)
+DOUBLE_BYTE_PAIR(0xDDDE, 0x7E43)
+DOUBLE_BYTE_PAIR(0xDDDF, 0x9D6C)
+DOUBLE_BYTE_PAIR(0xDDE0, 0x4E15)
+DOUBLE_BYTE_PAIR(0xDDE1, 0x5099)
+DOUBLE_BYTE_PAIR(0xDDE2, 0x5315)
+DOUBLE_BYTE_PAIR(0xDDE3, 0x532A)
+DOUBLE_BYTE_PAIR(0xDDE4, 0x5351)
+DOUBLE_BYTE_PAIR(0xDDE5, 0x5983)
+DOUBLE_BYTE_PAIR(0xDDE6, 0x5A62)
+DOUBLE_BYTE_PAIR(0xDDE7, 0x5E87)
+DOUBLE_BYTE_PAIR(0xDDE8, 0x60B2)
+DOUBLE_BYTE_PAIR(0xDDE9, 0x618A)
+DOUBLE_BYTE_PAIR(0xDDEA, 0x6249)
+DOUBLE_BYTE_PAIR(0xDDEB, 0x6279)
+DOUBLE_BYTE_PAIR(0xDDEC, 0x6590)
+DOUBLE_BYTE_PAIR(0xDDED, 0x6787)
+DOUBLE_BYTE_PAIR(0xDDEE, 0x69A7)
+DOUBLE_BYTE_PAIR(0xDDEF, 0x6BD4)
+DOUBLE_BYTE_PAIR(0xDDF0, 0x6BD6)
+DOUBLE_BYTE_PAIR(0xDDF1, 0x6BD7)
+DOUBLE_BYTE_PAIR(0xDDF2, 0x6BD8)
+DOUBLE_BYTE_PAIR(0xDDF3, 0x6CB8)
+DOUBLE_BYTE_PAIR(0xDDF4, 0xF968)
+DOUBLE_BYTE_PAIR(0xDDF5, 0x7435)
+DOUBLE_BYTE_PAIR(0xDDF6, 0x75FA)
+DOUBLE_BYTE_PAIR(0xDDF7, 0x7812)
+DOUBLE_BYTE_PAIR(0xDDF8, 0x7891)
+DOUBLE_BYTE_PAIR(0xDDF9, 0x79D5)
+DOUBLE_BYTE_PAIR(0xDDFA, 0x79D8)
+DOUBLE_BYTE_PAIR(0xDDFB, 0x7C83)
+DOUBLE_BYTE_PAIR(0xDDFC, 0x7DCB)
+DOUBLE_BYTE_PAIR(0xDDFD, 0x7FE1)
+DOUBLE_BYTE_PAIR(0xDDFE, 0x80A5)
+DOUBLE_BYTE_PAIR(0xDEA1, 0x813E)
+DOUBLE_BYTE_PAIR(0xDEA2, 0x81C2)
+DOUBLE_BYTE_PAIR(0xDEA3, 0x83F2)
+DOUBLE_BYTE_PAIR(0xDEA4, 0x871A)
+DOUBLE_BYTE_PAIR(0xDEA5, 0x88E8)
+DOUBLE_BYTE_PAIR(0xDEA6, 0x8AB9)
+DOUBLE_BYTE_PAIR(0xDEA7, 0x8B6C)
+DOUBLE_BYTE_PAIR(0xDEA8, 0x8CBB)
+DOUBLE_BYTE_PAIR(0xDEA9, 0x9119)
+DOUBLE_BYTE_PAIR(0xDEAA, 0x975E)
+DOUBLE_BYTE_PAIR(0xDEAB, 0x98DB)
+DOUBLE_BYTE_PAIR(0xDEAC, 0x9F3B)
+DOUBLE_BYTE_PAIR(0xDEAD, 0x56AC)
+DOUBLE_BYTE_PAIR(0xDEAE, 0x5B2A)
+DOUBLE_BYTE_PAIR(0xDEAF, 0x5F6C)
+DOUBLE_BYTE_PAIR(0xDEB0, 0x658C)
+DOUBLE_BYTE_PAIR(0xDEB1, 0x6AB3)
+DOUBLE_BYTE_PAIR(0xDEB2, 0x6BAF)
+DOUBLE_BYTE_PAIR(0xDEB3, 0x6D5C)
+DOUBLE_BYTE_PAIR(0xDEB4, 0x6FF1)
+DOUBLE_BYTE_PAIR(0xDEB5, 0x7015)
+DOUBLE_BYTE_PAIR(0xDEB6, 0x725D)
+DOUBLE_BYTE_PAIR(0xDEB7, 0x73AD)
+DOUBLE_BYTE_PAIR(0xDEB8, 0x8CA7)
+DOUBLE_BYTE_PAIR(0xDEB9, 0x8CD3)
+DOUBLE_BYTE_PAIR(0xDEBA, 0x983B)
+DOUBLE_BYTE_PAIR(0xDEBB, 0x6191)
+DOUBLE_BYTE_PAIR(0xDEBC, 0x6C37)
+DOUBLE_BYTE_PAIR(0xDEBD, 0x8058)
+DOUBLE_BYTE_PAIR(0xDEBE, 0x9A01)
+DOUBLE_BYTE_PAIR(0xDEBF, 0x4E4D)
+DOUBLE_BYTE_PAIR(0xDEC0, 0x4E8B)
+DOUBLE_BYTE_PAIR(0xDEC1, 0x4E9B)
+DOUBLE_BYTE_PAIR(0xDEC2, 0x4ED5)
+DOUBLE_BYTE_PAIR(0xDEC3, 0x4F3A)
+DOUBLE_BYTE_PAIR(0xDEC4, 0x4F3C)
+DOUBLE_BYTE_PAIR(0xDEC5, 0x4F7F)
+DOUBLE_BYTE_PAIR(0xDEC6, 0x4FDF)
+DOUBLE_BYTE_PAIR(0xDEC7, 0x50FF)
+DOUBLE_BYTE_PAIR(0xDEC8, 0x53F2)
+DOUBLE_BYTE_PAIR(0xDEC9, 0x53F8)
+DOUBLE_BYTE_PAIR(0xDECA, 0x5506)
+DOUBLE_BYTE_PAIR(0xDECB, 0x55E3)
+DOUBLE_BYTE_PAIR(0xDECC, 0x56DB)
+DOUBLE_BYTE_PAIR(0xDECD, 0x58EB)
+DOUBLE_BYTE_PAIR(0xDECE, 0x5962)
+DOUBLE_BYTE_PAIR(0xDECF, 0x5A11)
+DOUBLE_BYTE_PAIR(0xDED0, 0x5BEB)
+DOUBLE_BYTE_PAIR(0xDED1, 0x5BFA)
+DOUBLE_BYTE_PAIR(0xDED2, 0x5C04)
+DOUBLE_BYTE_PAIR(0xDED3, 0x5DF3)
+DOUBLE_BYTE_PAIR(0xDED4, 0x5E2B)
+DOUBLE_BYTE_PAIR(0xDED5, 0x5F99)
+DOUBLE_BYTE_PAIR(0xDED6, 0x601D)
+DOUBLE_BYTE_PAIR(0xDED7, 0x6368)
+DOUBLE_BYTE_PAIR(0xDED8, 0x659C)
+DOUBLE_BYTE_PAIR(0xDED9, 0x65AF)
+DOUBLE_BYTE_PAIR(0xDEDA, 0x67F6)
+DOUBLE_BYTE_PAIR(0xDEDB, 0x67FB)
+DOUBLE_BYTE_PAIR(0xDEDC, 0x68AD)
+DOUBLE_BYTE_PAIR(0xDEDD, 0x6B7B)
+DOUBLE_BYTE_PAIR(0xDEDE, 0x6C99)
+DOUBLE_BYTE_PAIR(0xDEDF, 0x6CD7)
+DOUBLE_BYTE_PAIR(0xDEE0, 0x6E23)
+DOUBLE_BYTE_PAIR(0xDEE1, 0x7009)
+DOUBLE_BYTE_PAIR(0xDEE2, 0x7345)
+DOUBLE_BYTE_PAIR(0xDEE3, 0x7802)
+DOUBLE_BYTE_PAIR(0xDEE4, 0x793E)
+DOUBLE_BYTE_PAIR(0xDEE5, 0x7940)
+DOUBLE_BYTE_PAIR(0xDEE6, 0x7960)
+DOUBLE_BYTE_PAIR(0xDEE7, 0x79C1)
+DOUBLE_BYTE_PAIR(0xDEE8, 0x7BE9)
+DOUBLE_BYTE_PAIR(0xDEE9, 0x7D17)
+DOUBLE_BYTE_PAIR(0xDEEA, 0x7D72)
+DOUBLE_BYTE_PAIR(0xDEEB, 0x8086)
+DOUBLE_BYTE_PAIR(0xDEEC, 0x820D)
+DOUBLE_BYTE_PAIR(0xDEED, 0x838E)
+DOUBLE_BYTE_PAIR(0xDEEE, 0x84D1)
+DOUBLE_BYTE_PAIR(0xDEEF, 0x86C7)
+DOUBLE_BYTE_PAIR(0xDEF0, 0x88DF)
+DOUBLE_BYTE_PAIR(0xDEF1, 0x8A50)
+DOUBLE_BYTE_PAIR(0xDEF2, 0x8A5E)
+DOUBLE_BYTE_PAIR(0xDEF3, 0x8B1D)
+DOUBLE_BYTE_PAIR(0xDEF4, 0x8CDC)
+DOUBLE_BYTE_PAIR(0xDEF5, 0x8D66)
+DOUBLE_BYTE_PAIR(0xDEF6, 0x8FAD)
+DOUBLE_BYTE_PAIR(0xDEF7, 0x90AA)
+DOUBLE_BYTE_PAIR(0xDEF8, 0x98FC)
+DOUBLE_BYTE_PAIR(0xDEF9, 0x99DF)
+DOUBLE_BYTE_PAIR(0xDEFA, 0x9E9D)
+DOUBLE_BYTE_PAIR(0xDEFB, 0x524A)
+DOUBLE_BYTE_PAIR(0xDEFC, 0xF969)
+DOUBLE_BYTE_PAIR(0xDEFD, 0x6714)
+DOUBLE_BYTE_PAIR(0xDEFE, 0xF96A)
+DOUBLE_BYTE_PAIR(0xDFA1, 0x5098)
+DOUBLE_BYTE_PAIR(0xDFA2, 0x522A)
+DOUBLE_BYTE_PAIR(0xDFA3, 0x5C71)
+DOUBLE_BYTE_PAIR(0xDFA4, 0x6563)
+DOUBLE_BYTE_PAIR(0xDFA5, 0x6C55)
+DOUBLE_BYTE_PAIR(0xDFA6, 0x73CA)
+DOUBLE_BYTE_PAIR(0xDFA7, 0x7523)
+DOUBLE_BYTE_PAIR(0xDFA8, 0x759D)
+DOUBLE_BYTE_PAIR(0xDFA9, 0x7B97)
+DOUBLE_BYTE_PAIR(0xDFAA, 0x849C)
+DOUBLE_BYTE_PAIR(0xDFAB, 0x9178)
+DOUBLE_BYTE_PAIR(0xDFAC, 0x9730)
+DOUBLE_BYTE_PAIR(0xDFAD, 0x4E77)
+DOUBLE_BYTE_PAIR(0xDFAE, 0x6492)
+DOUBLE_BYTE_PAIR(0xDFAF, 0x6BBA)
+DOUBLE_BYTE_PAIR(0xDFB0, 0x715E)
+DOUBLE_BYTE_PAIR(0xDFB1, 0x85A9)
+DOUBLE_BYTE_PAIR(0xDFB2, 0x4E09)
+DOUBLE_BYTE_PAIR(0xDFB3, 0xF96B)
+DOUBLE_BYTE_PAIR(0xDFB4, 0x6749)
+DOUBLE_BYTE_PAIR(0xDFB5, 0x68EE)
+DOUBLE_BYTE_PAIR(0xDFB6, 0x6E17)
+DOUBLE_BYTE_PAIR(0xDFB7, 0x829F)
+DOUBLE_BYTE_PAIR(0xDFB8, 0x8518)
+DOUBLE_BYTE_PAIR(0xDFB9, 0x886B)
+DOUBLE_BYTE_PAIR(0xDFBA, 0x63F7)
+DOUBLE_BYTE_PAIR(0xDFBB, 0x6F81)
+DOUBLE_BYTE_PAIR(0xDFBC, 0x9212)
+DOUBLE_BYTE_PAIR(0xDFBD, 0x98AF)
+DOUBLE_BYTE_PAIR(0xDFBE, 0x4E0A)
+DOUBLE_BYTE_PAIR(0xDFBF, 0x50B7)
+DOUBLE_BYTE_PAIR(0xDFC0, 0x50CF)
+DOUBLE_BYTE_PAIR(0xDFC1, 0x511F)
+DOUBLE_BYTE_PAIR(0xDFC2, 0x5546)
+DOUBLE_BYTE_PAIR(0xDFC3, 0x55AA)
+DOUBLE_BYTE_PAIR(0xDFC4, 0x5617)
+DOUBLE_BYTE_PAIR(0xDFC5, 0x5B40)
+DOUBLE_BYTE_PAIR(0xDFC6, 0x5C19)
+DOUBLE_BYTE_PAIR(0xDFC7, 0x5CE0)
+DOUBLE_BYTE_PAIR(0xDFC8, 0x5E38)
+DOUBLE_BYTE_PAIR(0xDFC9, 0x5E8A)
+DOUBLE_BYTE_PAIR(0xDFCA, 0x5EA0)
+DOUBLE_BYTE_PAIR(0xDFCB, 0x5EC2)
+DOUBLE_BYTE_PAIR(0xDFCC, 0x60F3)
+DOUBLE_BYTE_PAIR(0xDFCD, 0x6851)
+DOUBLE_BYTE_PAIR(0xDFCE, 0x6A61)
+DOUBLE_BYTE_PAIR(0xDFCF, 0x6E58)
+DOUBLE_BYTE_PAIR(0xDFD0, 0x723D)
+DOUBLE_BYTE_PAIR(0xDFD1, 0x7240)
+DOUBLE_BYTE_PAIR(0xDFD2, 0x72C0)
+DOUBLE_BYTE_PAIR(0xDFD3, 0x76F8)
+DOUBLE_BYTE_PAIR(0xDFD4, 0x7965)
+DOUBLE_BYTE_PAIR(0xDFD5, 0x7BB1)
+DOUBLE_BYTE_PAIR(0xDFD6, 0x7FD4)
+DOUBLE_BYTE_PAIR(0xDFD7, 0x88F3)
+DOUBLE_BYTE_PAIR(0xDFD8, 0x89F4)
+DOUBLE_BYTE_PAIR(0xDFD9, 0x8A73)
+DOUBLE_BYTE_PAIR(0xDFDA, 0x8C61)
+DOUBLE_BYTE_PAIR(0xDFDB, 0x8CDE)
+DOUBLE_BYTE_PAIR(0xDFDC, 0x971C)
+DOUBLE_BYTE_PAIR(0xDFDD, 0x585E)
+DOUBLE_BYTE_PAIR(0xDFDE, 0x74BD)
+DOUBLE_BYTE_PAIR(0xDFDF, 0x8CFD)
+DOUBLE_BYTE_PAIR(0xDFE0, 0x55C7)
+DOUBLE_BYTE_PAIR(0xDFE1, 0xF96C)
+DOUBLE_BYTE_PAIR(0xDFE2, 0x7A61)
+DOUBLE_BYTE_PAIR(0xDFE3, 0x7D22)
+DOUBLE_BYTE_PAIR(0xDFE4, 0x8272)
+DOUBLE_BYTE_PAIR(0xDFE5, 0x7272)
+DOUBLE_BYTE_PAIR(0xDFE6, 0x751F)
+DOUBLE_BYTE_PAIR(0xDFE7, 0x7525)
+DOUBLE_BYTE_PAIR(0xDFE8, 0xF96D)
+DOUBLE_BYTE_PAIR(0xDFE9, 0x7B19)
+DOUBLE_BYTE_PAIR(0xDFEA, 0x5885)
+DOUBLE_BYTE_PAIR(0xDFEB, 0x58FB)
+DOUBLE_BYTE_PAIR(0xDFEC, 0x5DBC)
+DOUBLE_BYTE_PAIR(0xDFED, 0x5E8F)
+DOUBLE_BYTE_PAIR(0xDFEE, 0x5EB6)
+DOUBLE_BYTE_PAIR(0xDFEF, 0x5F90)
+DOUBLE_BYTE_PAIR(0xDFF0, 0x6055)
+DOUBLE_BYTE_PAIR(0xDFF1, 0x6292)
+DOUBLE_BYTE_PAIR(0xDFF2, 0x637F)
+DOUBLE_BYTE_PAIR(0xDFF3, 0x654D)
+DOUBLE_BYTE_PAIR(0xDFF4, 0x6691)
+DOUBLE_BYTE_PAIR(0xDFF5, 0x66D9)
+DOUBLE_BYTE_PAIR(0xDFF6, 0x66F8)
+DOUBLE_BYTE_PAIR(0xDFF7, 0x6816)
+DOUBLE_BYTE_PAIR(0xDFF8, 0x68F2)
+DOUBLE_BYTE_PAIR(0xDFF9, 0x7280)
+DOUBLE_BYTE_PAIR(0xDFFA, 0x745E)
+DOUBLE_BYTE_PAIR(0xDFFB, 0x7B6E)
+DOUBLE_BYTE_PAIR(0xDFFC, 0x7D6E)
+DOUBLE_BYTE_PAIR(0xDFFD, 0x7DD6)
+DOUBLE_BYTE_PAIR(0xDFFE, 0x7F72)
+DOUBLE_BYTE_PAIR(0xE0A1, 0x80E5)
+DOUBLE_BYTE_PAIR(0xE0A2, 0x8212)
+DOUBLE_BYTE_PAIR(0xE0A3, 0x85AF)
+DOUBLE_BYTE_PAIR(0xE0A4, 0x897F)
+DOUBLE_BYTE_PAIR(0xE0A5, 0x8A93)
+DOUBLE_BYTE_PAIR(0xE0A6, 0x901D)
+DOUBLE_BYTE_PAIR(0xE0A7, 0x92E4)
+DOUBLE_BYTE_PAIR(0xE0A8, 0x9ECD)
+DOUBLE_BYTE_PAIR(0xE0A9, 0x9F20)
+DOUBLE_BYTE_PAIR(0xE0AA, 0x5915)
+DOUBLE_BYTE_PAIR(0xE0AB, 0x596D)
+DOUBLE_BYTE_PAIR(0xE0AC, 0x5E2D)
+DOUBLE_BYTE_PAIR(0xE0AD, 0x60DC)
+DOUBLE_BYTE_PAIR(0xE0AE, 0x6614)
+DOUBLE_BYTE_PAIR(0xE0AF, 0x6673)
+DOUBLE_BYTE_PAIR(0xE0B0, 0x6790)
+DOUBLE_BYTE_PAIR(0xE0B1, 0x6C50)
+DOUBLE_BYTE_PAIR(0xE0B2, 0x6DC5)
+DOUBLE_BYTE_PAIR(0xE0B3, 0x6F5F)
+DOUBLE_BYTE_PAIR(0xE0B4, 0x77F3)
+DOUBLE_BYTE_PAIR(0xE0B5, 0x78A9)
+DOUBLE_BYTE_PAIR(0xE0B6, 0x84C6)
+DOUBLE_BYTE_PAIR(0xE0B7, 0x91CB)
+DOUBLE_BYTE_PAIR(0xE0B8, 0x932B)
+DOUBLE_BYTE_PAIR(0xE0B9, 0x4ED9)
+DOUBLE_BYTE_PAIR(0xE0BA, 0x50CA)
+DOUBLE_BYTE_PAIR(0xE0BB, 0x5148)
+DOUBLE_BYTE_PAIR(0xE0BC, 0x5584)
+DOUBLE_BYTE_PAIR(0xE0BD, 0x5B0B)
+DOUBLE_BYTE_PAIR(0xE0BE, 0x5BA3)
+DOUBLE_BYTE_PAIR(0xE0BF, 0x6247)
+DOUBLE_BYTE_PAIR(0xE0C0, 0x657E)
+DOUBLE_BYTE_PAIR(0xE0C1, 0x65CB)
+DOUBLE_BYTE_PAIR(0xE0C2, 0x6E32)
+DOUBLE_BYTE_PAIR(0xE0C3, 0x717D)
+DOUBLE_BYTE_PAIR(0xE0C4, 0x7401)
+DOUBLE_BYTE_PAIR(0xE0C5, 0x7444)
+DOUBLE_BYTE_PAIR(0xE0C6, 0x7487)
+DOUBLE_BYTE_PAIR(0xE0C7, 0x74BF)
+DOUBLE_BYTE_PAIR(0xE0C8, 0x766C)
+DOUBLE_BYTE_PAIR(0xE0C9, 0x79AA)
+DOUBLE_BYTE_PAIR(0xE0CA, 0x7DDA)
+DOUBLE_BYTE_PAIR(0xE0CB, 0x7E55)
+DOUBLE_BYTE_PAIR(0xE0CC, 0x7FA8)
+DOUBLE_BYTE_PAIR(0xE0CD, 0x817A)
+DOUBLE_BYTE_PAIR(0xE0CE, 0x81B3)
+DOUBLE_BYTE_PAIR(0xE0CF, 0x8239)
+DOUBLE_BYTE_PAIR(0xE0D0, 0x861A)
+DOUBLE_BYTE_PAIR(0xE0D1, 0x87EC)
+DOUBLE_BYTE_PAIR(0xE0D2, 0x8A75)
+DOUBLE_BYTE_PAIR(0xE0D3, 0x8DE3)
+DOUBLE_BYTE_PAIR(0xE0D4, 0x9078)
+DOUBLE_BYTE_PAIR(0xE0D5, 0x9291)
+DOUBLE_BYTE_PAIR(0xE0D6, 0x9425)
+DOUBLE_BYTE_PAIR(0xE0D7, 0x994D)
+DOUBLE_BYTE_PAIR(0xE0D8, 0x9BAE)
+DOUBLE_BYTE_PAIR(0xE0D9, 0x5368)
+DOUBLE_BYTE_PAIR(0xE0DA, 0x5C51)
+DOUBLE_BYTE_PAIR(0xE0DB, 0x6954)
+DOUBLE_BYTE_PAIR(0xE0DC, 0x6CC4)
+DOUBLE_BYTE_PAIR(0xE0DD, 0x6D29)
+DOUBLE_BYTE_PAIR(0xE0DE, 0x6E2B)
+DOUBLE_BYTE_PAIR(0xE0DF, 0x820C)
+DOUBLE_BYTE_PAIR(0xE0E0, 0x859B)
+DOUBLE_BYTE_PAIR(0xE0E1, 0x893B)
+DOUBLE_BYTE_PAIR(0xE0E2, 0x8A2D)
+DOUBLE_BYTE_PAIR(0xE0E3, 0x8AAA)
+DOUBLE_BYTE_PAIR(0xE0E4, 0x96EA)
+DOUBLE_BYTE_PAIR(0xE0E5, 0x9F67)
+DOUBLE_BYTE_PAIR(0xE0E6, 0x5261)
+DOUBLE_BYTE_PAIR(0xE0E7, 0x66B9)
+DOUBLE_BYTE_PAIR(0xE0E8, 0x6BB2)
+DOUBLE_BYTE_PAIR(0xE0E9, 0x7E96)
+DOUBLE_BYTE_PAIR(0xE0EA, 0x87FE)
+DOUBLE_BYTE_PAIR(0xE0EB, 0x8D0D)
+DOUBLE_BYTE_PAIR(0xE0EC, 0x9583)
+DOUBLE_BYTE_PAIR(0xE0ED, 0x965D)
+DOUBLE_BYTE_PAIR(0xE0EE, 0x651D)
+DOUBLE_BYTE_PAIR(0xE0EF, 0x6D89)
+DOUBLE_BYTE_PAIR(0xE0F0, 0x71EE)
+DOUBLE_BYTE_PAIR(0xE0F1, 0xF96E)
+DOUBLE_BYTE_PAIR(0xE0F2, 0x57CE)
+DOUBLE_BYTE_PAIR(0xE0F3, 0x59D3)
+DOUBLE_BYTE_PAIR(0xE0F4, 0x5BAC)
+DOUBLE_BYTE_PAIR(0xE0F5, 0x6027)
+DOUBLE_BYTE_PAIR(0xE0F6, 0x60FA)
+DOUBLE_BYTE_PAIR(0xE0F7, 0x6210)
+DOUBLE_BYTE_PAIR(0xE0F8, 0x661F)
+DOUBLE_BYTE_PAIR(0xE0F9, 0x665F)
+DOUBLE_BYTE_PAIR(0xE0FA, 0x7329)
+DOUBLE_BYTE_PAIR(0xE0FB, 0x73F9)
+DOUBLE_BYTE_PAIR(0xE0FC, 0x76DB)
+DOUBLE_BYTE_PAIR(0xE0FD, 0x7701)
+DOUBLE_BYTE_PAIR(0xE0FE, 0x7B6C)
+DOUBLE_BYTE_PAIR(0xE1A1, 0x8056)
+DOUBLE_BYTE_PAIR(0xE1A2, 0x8072)
+DOUBLE_BYTE_PAIR(0xE1A3, 0x8165)
+DOUBLE_BYTE_PAIR(0xE1A4, 0x8AA0)
+DOUBLE_BYTE_PAIR(0xE1A5, 0x9192)
+DOUBLE_BYTE_PAIR(0xE1A6, 0x4E16)
+DOUBLE_BYTE_PAIR(0xE1A7, 0x52E2)
+DOUBLE_BYTE_PAIR(0xE1A8, 0x6B72)
+DOUBLE_BYTE_PAIR(0xE1A9, 0x6D17)
+DOUBLE_BYTE_PAIR(0xE1AA, 0x7A05)
+DOUBLE_BYTE_PAIR(0xE1AB, 0x7B39)
+DOUBLE_BYTE_PAIR(0xE1AC, 0x7D30)
+DOUBLE_BYTE_PAIR(0xE1AD, 0xF96F)
+DOUBLE_BYTE_PAIR(0xE1AE, 0x8CB0)
+DOUBLE_BYTE_PAIR(0xE1AF, 0x53EC)
+DOUBLE_BYTE_PAIR(0xE1B0, 0x562F)
+DOUBLE_BYTE_PAIR(0xE1B1, 0x5851)
+DOUBLE_BYTE_PAIR(0xE1B2, 0x5BB5)
+DOUBLE_BYTE_PAIR(0xE1B3, 0x5C0F)
+DOUBLE_BYTE_PAIR(0xE1B4, 0x5C11)
+DOUBLE_BYTE_PAIR(0xE1B5, 0x5DE2)
+DOUBLE_BYTE_PAIR(0xE1B6, 0x6240)
+DOUBLE_BYTE_PAIR(0xE1B7, 0x6383)
+DOUBLE_BYTE_PAIR(0xE1B8, 0x6414)
+DOUBLE_BYTE_PAIR(0xE1B9, 0x662D)
+DOUBLE_BYTE_PAIR(0xE1BA, 0x68B3)
+DOUBLE_BYTE_PAIR(0xE1BB, 0x6CBC)
+DOUBLE_BYTE_PAIR(0xE1BC, 0x6D88)
+DOUBLE_BYTE_PAIR(0xE1BD, 0x6EAF)
+DOUBLE_BYTE_PAIR(0xE1BE, 0x701F)
+DOUBLE_BYTE_PAIR(0xE1BF, 0x70A4)
+DOUBLE_BYTE_PAIR(0xE1C0, 0x71D2)
+DOUBLE_BYTE_PAIR(0xE1C1, 0x7526)
+DOUBLE_BYTE_PAIR(0xE1C2, 0x758F)
+DOUBLE_BYTE_PAIR(0xE1C3, 0x758E)
+DOUBLE_BYTE_PAIR(0xE1C4, 0x7619)
+DOUBLE_BYTE_PAIR(0xE1C5, 0x7B11)
+DOUBLE_BYTE_PAIR(0xE1C6, 0x7BE0)
+DOUBLE_BYTE_PAIR(0xE1C7, 0x7C2B)
+DOUBLE_BYTE_PAIR(0xE1C8, 0x7D20)
+DOUBLE_BYTE_PAIR(0xE1C9, 0x7D39)
+DOUBLE_BYTE_PAIR(0xE1CA, 0x852C)
+DOUBLE_BYTE_PAIR(0xE1CB, 0x856D)
+DOUBLE_BYTE_PAIR(0xE1CC, 0x8607)
+DOUBLE_BYTE_PAIR(0xE1CD, 0x8A34)
+DOUBLE_BYTE_PAIR(0xE1CE, 0x900D)
+DOUBLE_BYTE_PAIR(0xE1CF, 0x9061)
+DOUBLE_BYTE_PAIR(0xE1D0, 0x90B5)
+DOUBLE_BYTE_PAIR(0xE1D1, 0x92B7)
+DOUBLE_BYTE_PAIR(0xE1D2, 0x97F6)
+DOUBLE_BYTE_PAIR(0xE1D3, 0x9A37)
+DOUBLE_BYTE_PAIR(0xE1D4, 0x4FD7)
+DOUBLE_BYTE_PAIR(0xE1D5, 0x5C6C)
+DOUBLE_BYTE_PAIR(0xE1D6, 0x675F)
+DOUBLE_BYTE_PAIR(0xE1D7, 0x6D91)
+DOUBLE_BYTE_PAIR(0xE1D8, 0x7C9F)
+DOUBLE_BYTE_PAIR(0xE1D9, 0x7E8C)
+DOUBLE_BYTE_PAIR(0xE1DA, 0x8B16)
+DOUBLE_BYTE_PAIR(0xE1DB, 0x8D16)
+DOUBLE_BYTE_PAIR(0xE1DC, 0x901F)
+DOUBLE_BYTE_PAIR(0xE1DD, 0x5B6B)
+DOUBLE_BYTE_PAIR(0xE1DE, 0x5DFD)
+DOUBLE_BYTE_PAIR(0xE1DF, 0x640D)
+DOUBLE_BYTE_PAIR(0xE1E0, 0x84C0)
+DOUBLE_BYTE_PAIR(0xE1E1, 0x905C)
+DOUBLE_BYTE_PAIR(0xE1E2, 0x98E1)
+DOUBLE_BYTE_PAIR(0xE1E3, 0x7387)
+DOUBLE_BYTE_PAIR(0xE1E4, 0x5B8B)
+DOUBLE_BYTE_PAIR(0xE1E5, 0x609A)
+DOUBLE_BYTE_PAIR(0xE1E6, 0x677E)
+DOUBLE_BYTE_PAIR(0xE1E7, 0x6DDE)
+DOUBLE_BYTE_PAIR(0xE1E8, 0x8A1F)
+DOUBLE_BYTE_PAIR(0xE1E9, 0x8AA6)
+DOUBLE_BYTE_PAIR(0xE1EA, 0x9001)
+DOUBLE_BYTE_PAIR(0xE1EB, 0x980C)
+DOUBLE_BYTE_PAIR(0xE1EC, 0x5237)
+DOUBLE_BYTE_PAIR(0xE1ED, 0xF970)
+DOUBLE_BYTE_PAIR(0xE1EE, 0x7051)
+DOUBLE_BYTE_PAIR(0xE1EF, 0x788E)
+DOUBLE_BYTE_PAIR(0xE1F0, 0x9396)
+DOUBLE_BYTE_PAIR(0xE1F1, 0x8870)
+DOUBLE_BYTE_PAIR(0xE1F2, 0x91D7)
+DOUBLE_BYTE_PAIR(0xE1F3, 0x4FEE)
+DOUBLE_BYTE_PAIR(0xE1F4, 0x53D7)
+DOUBLE_BYTE_PAIR(0xE1F5, 0x55FD)
+DOUBLE_BYTE_PAIR(0xE1F6, 0x56DA)
+DOUBLE_BYTE_PAIR(0xE1F7, 0x5782)
+DOUBLE_BYTE_PAIR(0xE1F8, 0x58FD)
+DOUBLE_BYTE_PAIR(0xE1F9, 0x5AC2)
+DOUBLE_BYTE_PAIR(0xE1FA, 0x5B88)
+DOUBLE_BYTE_PAIR(0xE1FB, 0x5CAB)
+DOUBLE_BYTE_PAIR(0xE1FC, 0x5CC0)
+DOUBLE_BYTE_PAIR(0xE1FD, 0x5E25)
+DOUBLE_BYTE_PAIR(0xE1FE, 0x6101)
+DOUBLE_BYTE_PAIR(0xE2A1, 0x620D)
+DOUBLE_BYTE_PAIR(0xE2A2, 0x624B)
+DOUBLE_BYTE_PAIR(0xE2A3, 0x6388)
+DOUBLE_BYTE_PAIR(0xE2A4, 0x641C)
+DOUBLE_BYTE_PAIR(0xE2A5, 0x6536)
+DOUBLE_BYTE_PAIR(0xE2A6, 0x6578)
+DOUBLE_BYTE_PAIR(0xE2A7, 0x6A39)
+DOUBLE_BYTE_PAIR(0xE2A8, 0x6B8A)
+DOUBLE_BYTE_PAIR(0xE2A9, 0x6C34)
+DOUBLE_BYTE_PAIR(0xE2AA, 0x6D19)
+DOUBLE_BYTE_PAIR(0xE2AB, 0x6F31)
+DOUBLE_BYTE_PAIR(0xE2AC, 0x71E7)
+DOUBLE_BYTE_PAIR(0xE2AD, 0x72E9)
+DOUBLE_BYTE_PAIR(0xE2AE, 0x7378)
+DOUBLE_BYTE_PAIR(0xE2AF, 0x7407)
+DOUBLE_BYTE_PAIR(0xE2B0, 0x74B2)
+DOUBLE_BYTE_PAIR(0xE2B1, 0x7626)
+DOUBLE_BYTE_PAIR(0xE2B2, 0x7761)
+DOUBLE_BYTE_PAIR(0xE2B3, 0x79C0)
+DOUBLE_BYTE_PAIR(0xE2B4, 0x7A57)
+DOUBLE_BYTE_PAIR(0xE2B5, 0x7AEA)
+DOUBLE_BYTE_PAIR(0xE2B6, 0x7CB9)
+DOUBLE_BYTE_PAIR(0xE2B7, 0x7D8F)
+DOUBLE_BYTE_PAIR(0xE2B8, 0x7DAC)
+DOUBLE_BYTE_PAIR(0xE2B9, 0x7E61)
+DOUBLE_BYTE_PAIR(0xE2BA, 0x7F9E)
+DOUBLE_BYTE_PAIR(0xE2BB, 0x8129)
+DOUBLE_BYTE_PAIR(0xE2BC, 0x8331)
+DOUBLE_BYTE_PAIR(0xE2BD, 0x8490)
+DOUBLE_BYTE_PAIR(0xE2BE, 0x84DA)
+DOUBLE_BYTE_PAIR(0xE2BF, 0x85EA)
+DOUBLE_BYTE_PAIR(0xE2C0, 0x8896)
+DOUBLE_BYTE_PAIR(0xE2C1, 0x8AB0)
+DOUBLE_BYTE_PAIR(0xE2C2, 0x8B90)
+DOUBLE_BYTE_PAIR(0xE2C3, 0x8F38)
+DOUBLE_BYTE_PAIR(0xE2C4, 0x9042)
+DOUBLE_BYTE_PAIR(0xE2C5, 0x9083)
+DOUBLE_BYTE_PAIR(0xE2C6, 0x916C)
+DOUBLE_BYTE_PAIR(0xE2C7, 0x9296)
+DOUBLE_BYTE_PAIR(0xE2C8, 0x92B9)
+DOUBLE_BYTE_PAIR(0xE2C9, 0x968B)
+DOUBLE_BYTE_PAIR(0xE2CA, 0x96A7)
+DOUBLE_BYTE_PAIR(0xE2CB, 0x96A8)
+DOUBLE_BYTE_PAIR(0xE2CC, 0x96D6)
+DOUBLE_BYTE_PAIR(0xE2CD, 0x9700)
+DOUBLE_BYTE_PAIR(0xE2CE, 0x9808)
+DOUBLE_BYTE_PAIR(0xE2CF, 0x9996)
+DOUBLE_BYTE_PAIR(0xE2D0, 0x9AD3)
+DOUBLE_BYTE_PAIR(0xE2D1, 0x9B1A)
+DOUBLE_BYTE_PAIR(0xE2D2, 0x53D4)
+DOUBLE_BYTE_PAIR(0xE2D3, 0x587E)
+DOUBLE_BYTE_PAIR(0xE2D4, 0x5919)
+DOUBLE_BYTE_PAIR(0xE2D5, 0x5B70)
+DOUBLE_BYTE_PAIR(0xE2D6, 0x5BBF)
+DOUBLE_BYTE_PAIR(0xE2D7, 0x6DD1)
+DOUBLE_BYTE_PAIR(0xE2D8, 0x6F5A)
+DOUBLE_BYTE_PAIR(0xE2D9, 0x719F)
+DOUBLE_BYTE_PAIR(0xE2DA, 0x7421)
+DOUBLE_BYTE_PAIR(0xE2DB, 0x74B9)
+DOUBLE_BYTE_PAIR(0xE2DC, 0x8085)
+DOUBLE_BYTE_PAIR(0xE2DD, 0x83FD)
+DOUBLE_BYTE_PAIR(0xE2DE, 0x5DE1)
+DOUBLE_BYTE_PAIR(0xE2DF, 0x5F87)
+DOUBLE_BYTE_PAIR(0xE2E0, 0x5FAA)
+DOUBLE_BYTE_PAIR(0xE2E1, 0x6042)
+DOUBLE_BYTE_PAIR(0xE2E2, 0x65EC)
+DOUBLE_BYTE_PAIR(0xE2E3, 0x6812)
+DOUBLE_BYTE_PAIR(0xE2E4, 0x696F)
+DOUBLE_BYTE_PAIR(0xE2E5, 0x6A53)
+DOUBLE_BYTE_PAIR(0xE2E6, 0x6B89)
+DOUBLE_BYTE_PAIR(0xE2E7, 0x6D35)
+DOUBLE_BYTE_PAIR(0xE2E8, 0x6DF3)
+DOUBLE_BYTE_PAIR(0xE2E9, 0x73E3)
+DOUBLE_BYTE_PAIR(0xE2EA, 0x76FE)
+DOUBLE_BYTE_PAIR(0xE2EB, 0x77AC)
+DOUBLE_BYTE_PAIR(0xE2EC, 0x7B4D)
+DOUBLE_BYTE_PAIR(0xE2ED, 0x7D14)
+DOUBLE_BYTE_PAIR(0xE2EE, 0x8123)
+DOUBLE_BYTE_PAIR(0xE2EF, 0x821C)
+DOUBLE_BYTE_PAIR(0xE2F0, 0x8340)
+DOUBLE_BYTE_PAIR(0xE2F1, 0x84F4)
+DOUBLE_BYTE_PAIR(0xE2F2, 0x8563)
+DOUBLE_BYTE_PAIR(0xE2F3, 0x8A62)
+DOUBLE_BYTE_PAIR(0xE2F4, 0x8AC4)
+DOUBLE_BYTE_PAIR(0xE2F5, 0x9187)
+DOUBLE_BYTE_PAIR(0xE2F6, 0x931E)
+DOUBLE_BYTE_PAIR(0xE2F7, 0x9806)
+DOUBLE_BYTE_PAIR(0xE2F8, 0x99B4)
+DOUBLE_BYTE_PAIR(0xE2F9, 0x620C)
+DOUBLE_BYTE_PAIR(0xE2FA, 0x8853)
+DOUBLE_BYTE_PAIR(0xE2FB, 0x8FF0)
+DOUBLE_BYTE_PAIR(0xE2FC, 0x9265)
+DOUBLE_BYTE_PAIR(0xE2FD, 0x5D07)
+DOUBLE_BYTE_PAIR(0xE2FE, 0x5D27)
+DOUBLE_BYTE_PAIR(0xE3A1, 0x5D69)
+DOUBLE_BYTE_PAIR(0xE3A2, 0x745F)
+DOUBLE_BYTE_PAIR(0xE3A3, 0x819D)
+DOUBLE_BYTE_PAIR(0xE3A4, 0x8768)
+DOUBLE_BYTE_PAIR(0xE3A5, 0x6FD5)
+DOUBLE_BYTE_PAIR(0xE3A6, 0x62FE)
+DOUBLE_BYTE_PAIR(0xE3A7, 0x7FD2)
+DOUBLE_BYTE_PAIR(0xE3A8, 0x8936)
+DOUBLE_BYTE_PAIR(0xE3A9, 0x8972)
+DOUBLE_BYTE_PAIR(0xE3AA, 0x4E1E)
+DOUBLE_BYTE_PAIR(0xE3AB, 0x4E58)
+DOUBLE_BYTE_PAIR(0xE3AC, 0x50E7)
+DOUBLE_BYTE_PAIR(0xE3AD, 0x52DD)
+DOUBLE_BYTE_PAIR(0xE3AE, 0x5347)
+DOUBLE_BYTE_PAIR(0xE3AF, 0x627F)
+DOUBLE_BYTE_PAIR(0xE3B0, 0x6607)
+DOUBLE_BYTE_PAIR(0xE3B1, 0x7E69)
+DOUBLE_BYTE_PAIR(0xE3B2, 0x8805)
+DOUBLE_BYTE_PAIR(0xE3B3, 0x965E)
+DOUBLE_BYTE_PAIR(0xE3B4, 0x4F8D)
+DOUBLE_BYTE_PAIR(0xE3B5, 0x5319)
+DOUBLE_BYTE_PAIR(0xE3B6, 0x5636)
+DOUBLE_BYTE_PAIR(0xE3B7, 0x59CB)
+DOUBLE_BYTE_PAIR(0xE3B8, 0x5AA4)
+DOUBLE_BYTE_PAIR(0xE3B9, 0x5C38)
+DOUBLE_BYTE_PAIR(0xE3BA, 0x5C4E)
+DOUBLE_BYTE_PAIR(0xE3BB, 0x5C4D)
+DOUBLE_BYTE_PAIR(0xE3BC, 0x5E02)
+DOUBLE_BYTE_PAIR(0xE3BD, 0x5F11)
+DOUBLE_BYTE_PAIR(0xE3BE, 0x6043)
+DOUBLE_BYTE_PAIR(0xE3BF, 0x65BD)
+DOUBLE_BYTE_PAIR(0xE3C0, 0x662F)
+DOUBLE_BYTE_PAIR(0xE3C1, 0x6642)
+DOUBLE_BYTE_PAIR(0xE3C2, 0x67BE)
+DOUBLE_BYTE_PAIR(0xE3C3, 0x67F4)
+DOUBLE_BYTE_PAIR(0xE3C4, 0x731C)
+DOUBLE_BYTE_PAIR(0xE3C5, 0x77E2)
+DOUBLE_BYTE_PAIR(0xE3C6, 0x793A)
+DOUBLE_BYTE_PAIR(0xE3C7, 0x7FC5)
+DOUBLE_BYTE_PAIR(0xE3C8, 0x8494)
+DOUBLE_BYTE_PAIR(0xE3C9, 0x84CD)
+DOUBLE_BYTE_PAIR(0xE3CA, 0x8996)
+DOUBLE_BYTE_PAIR(0xE3CB, 0x8A66)
+DOUBLE_BYTE_PAIR(0xE3CC, 0x8A69)
+DOUBLE_BYTE_PAIR(0xE3CD, 0x8AE1)
+DOUBLE_BYTE_PAIR(0xE3CE, 0x8C55)
+DOUBLE_BYTE_PAIR(0xE3CF, 0x8C7A)
+DOUBLE_BYTE_PAIR(0xE3D0, 0x57F4)
+DOUBLE_BYTE_PAIR(0xE3D1, 0x5BD4)
+DOUBLE_BYTE_PAIR(0xE3D2, 0x5F0F)
+DOUBLE_BYTE_PAIR(0xE3D3, 0x606F)
+DOUBLE_BYTE_PAIR(0xE3D4, 0x62ED)
+DOUBLE_BYTE_PAIR(0xE3D5, 0x690D)
+DOUBLE_BYTE_PAIR(0xE3D6, 0x6B96)
+DOUBLE_BYTE_PAIR(0xE3D7, 0x6E5C)
+DOUBLE_BYTE_PAIR(0xE3D8, 0x7184)
+DOUBLE_BYTE_PAIR(0xE3D9, 0x7BD2)
+DOUBLE_BYTE_PAIR(0xE3DA, 0x8755)
+DOUBLE_BYTE_PAIR(0xE3DB, 0x8B58)
+DOUBLE_BYTE_PAIR(0xE3DC, 0x8EFE)
+DOUBLE_BYTE_PAIR(0xE3DD, 0x98DF)
+DOUBLE_BYTE_PAIR(0xE3DE, 0x98FE)
+DOUBLE_BYTE_PAIR(0xE3DF, 0x4F38)
+DOUBLE_BYTE_PAIR(0xE3E0, 0x4F81)
+DOUBLE_BYTE_PAIR(0xE3E1, 0x4FE1)
+DOUBLE_BYTE_PAIR(0xE3E2, 0x547B)
+DOUBLE_BYTE_PAIR(0xE3E3, 0x5A20)
+DOUBLE_BYTE_PAIR(0xE3E4, 0x5BB8)
+DOUBLE_BYTE_PAIR(0xE3E5, 0x613C)
+DOUBLE_BYTE_PAIR(0xE3E6, 0x65B0)
+DOUBLE_BYTE_PAIR(0xE3E7, 0x6668)
+DOUBLE_BYTE_PAIR(0xE3E8, 0x71FC)
+DOUBLE_BYTE_PAIR(0xE3E9, 0x7533)
+DOUBLE_BYTE_PAIR(0xE3EA, 0x795E)
+DOUBLE_BYTE_PAIR(0xE3EB, 0x7D33)
+DOUBLE_BYTE_PAIR(0xE3EC, 0x814E)
+DOUBLE_BYTE_PAIR(0xE3ED, 0x81E3)
+DOUBLE_BYTE_PAIR(0xE3EE, 0x8398)
+DOUBLE_BYTE_PAIR(0xE3EF, 0x85AA)
+DOUBLE_BYTE_PAIR(0xE3F0, 0x85CE)
+DOUBLE_BYTE_PAIR(0xE3F1, 0x8703)
+DOUBLE_BYTE_PAIR(0xE3F2, 0x8A0A)
+DOUBLE_BYTE_PAIR(0xE3F3, 0x8EAB)
+DOUBLE_BYTE_PAIR(0xE3F4, 0x8F9B)
+DOUBLE_BYTE_PAIR(0xE3F5, 0xF971)
+DOUBLE_BYTE_PAIR(0xE3F6, 0x8FC5)
+DOUBLE_BYTE_PAIR(0xE3F7, 0x5931)
+DOUBLE_BYTE_PAIR(0xE3F8, 0x5BA4)
+DOUBLE_BYTE_PAIR(0xE3F9, 0x5BE6)
+DOUBLE_BYTE_PAIR(0xE3FA, 0x6089)
+DOUBLE_BYTE_PAIR(0xE3FB, 0x5BE9)
+DOUBLE_BYTE_PAIR(0xE3FC, 0x5C0B)
+DOUBLE_BYTE_PAIR(0xE3FD, 0x5FC3)
+DOUBLE_BYTE_PAIR(0xE3FE, 0x6C81)
+DOUBLE_BYTE_PAIR(0xE4A1, 0xF972)
+DOUBLE_BYTE_PAIR(0xE4A2, 0x6DF1)
+DOUBLE_BYTE_PAIR(0xE4A3, 0x700B)
+DOUBLE_BYTE_PAIR(0xE4A4, 0x751A)
+DOUBLE_BYTE_PAIR(0xE4A5, 0x82AF)
+DOUBLE_BYTE_PAIR(0xE4A6, 0x8AF6)
+DOUBLE_BYTE_PAIR(0xE4A7, 0x4EC0)
+DOUBLE_BYTE_PAIR(0xE4A8, 0x5341)
+DOUBLE_BYTE_PAIR(0xE4A9, 0xF973)
+DOUBLE_BYTE_PAIR(0xE4AA, 0x96D9)
+DOUBLE_BYTE_PAIR(0xE4AB, 0x6C0F)
+DOUBLE_BYTE_PAIR(0xE4AC, 0x4E9E)
+DOUBLE_BYTE_PAIR(0xE4AD, 0x4FC4)
+DOUBLE_BYTE_PAIR(0xE4AE, 0x5152)
+DOUBLE_BYTE_PAIR(0xE4AF, 0x555E)
+DOUBLE_BYTE_PAIR(0xE4B0, 0x5A25)
+DOUBLE_BYTE_PAIR(0xE4B1, 0x5CE8)
+DOUBLE_BYTE_PAIR(0xE4B2, 0x6211)
+DOUBLE_BYTE_PAIR(0xE4B3, 0x7259)
+DOUBLE_BYTE_PAIR(0xE4B4, 0x82BD)
+DOUBLE_BYTE_PAIR(0xE4B5, 0x83AA)
+DOUBLE_BYTE_PAIR(0xE4B6, 0x86FE)
+DOUBLE_BYTE_PAIR(0xE4B7, 0x8859)
+DOUBLE_BYTE_PAIR(0xE4B8, 0x8A1D)
+DOUBLE_BYTE_PAIR(0xE4B9, 0x963F)
+DOUBLE_BYTE_PAIR(0xE4BA, 0x96C5)
+DOUBLE_BYTE_PAIR(0xE4BB, 0x9913)
+DOUBLE_BYTE_PAIR(0xE4BC, 0x9D09)
+DOUBLE_BYTE_PAIR(0xE4BD, 0x9D5D)
+DOUBLE_BYTE_PAIR(0xE4BE, 0x580A)
+DOUBLE_BYTE_PAIR(0xE4BF, 0x5CB3)
+DOUBLE_BYTE_PAIR(0xE4C0, 0x5DBD)
+DOUBLE_BYTE_PAIR(0xE4C1, 0x5E44)
+DOUBLE_BYTE_PAIR(0xE4C2, 0x60E1)
+DOUBLE_BYTE_PAIR(0xE4C3, 0x6115)
+DOUBLE_BYTE_PAIR(0xE4C4, 0x63E1)
+DOUBLE_BYTE_PAIR(0xE4C5, 0x6A02)
+DOUBLE_BYTE_PAIR(0xE4C6, 0x6E25)
+DOUBLE_BYTE_PAIR(0xE4C7, 0x9102)
+DOUBLE_BYTE_PAIR(0xE4C8, 0x9354)
+DOUBLE_BYTE_PAIR(0xE4C9, 0x984E)
+DOUBLE_BYTE_PAIR(0xE4CA, 0x9C10)
+DOUBLE_BYTE_PAIR(0xE4CB, 0x9F77)
+DOUBLE_BYTE_PAIR(0xE4CC, 0x5B89)
+DOUBLE_BYTE_PAIR(0xE4CD, 0x5CB8)
+DOUBLE_BYTE_PAIR(0xE4CE, 0x6309)
+DOUBLE_BYTE_PAIR(0xE4CF, 0x664F)
+DOUBLE_BYTE_PAIR(0xE4D0, 0x6848)
+DOUBLE_BYTE_PAIR(0xE4D1, 0x773C)
+DOUBLE_BYTE_PAIR(0xE4D2, 0x96C1)
+DOUBLE_BYTE_PAIR(0xE4D3, 0x978D)
+DOUBLE_BYTE_PAIR(0xE4D4, 0x9854)
+DOUBLE_BYTE_PAIR(0xE4D5, 0x9B9F)
+DOUBLE_BYTE_PAIR(0xE4D6, 0x65A1)
+DOUBLE_BYTE_PAIR(0xE4D7, 0x8B01)
+DOUBLE_BYTE_PAIR(0xE4D8, 0x8ECB)
+DOUBLE_BYTE_PAIR(0xE4D9, 0x95BC)
+DOUBLE_BYTE_PAIR(0xE4DA, 0x5535)
+DOUBLE_BYTE_PAIR(0xE4DB, 0x5CA9)
+DOUBLE_BYTE_PAIR(0xE4DC, 0x5DD6)
+DOUBLE_BYTE_PAIR(0xE4DD, 0x5EB5)
+DOUBLE_BYTE_PAIR(0xE4DE, 0x6697)
+DOUBLE_BYTE_PAIR(0xE4DF, 0x764C)
+DOUBLE_BYTE_PAIR(0xE4E0, 0x83F4)
+DOUBLE_BYTE_PAIR(0xE4E1, 0x95C7)
+DOUBLE_BYTE_PAIR(0xE4E2, 0x58D3)
+DOUBLE_BYTE_PAIR(0xE4E3, 0x62BC)
+DOUBLE_BYTE_PAIR(0xE4E4, 0x72CE)
+DOUBLE_BYTE_PAIR(0xE4E5, 0x9D28)
+DOUBLE_BYTE_PAIR(0xE4E6, 0x4EF0)
+DOUBLE_BYTE_PAIR(0xE4E7, 0x592E)
+DOUBLE_BYTE_PAIR(0xE4E8, 0x600F)
+DOUBLE_BYTE_PAIR(0xE4E9, 0x663B)
+DOUBLE_BYTE_PAIR(0xE4EA, 0x6B83)
+DOUBLE_BYTE_PAIR(0xE4EB, 0x79E7)
+DOUBLE_BYTE_PAIR(0xE4EC, 0x9D26)
+DOUBLE_BYTE_PAIR(0xE4ED, 0x5393)
+DOUBLE_BYTE_PAIR(0xE4EE, 0x54C0)
+DOUBLE_BYTE_PAIR(0xE4EF, 0x57C3)
+DOUBLE_BYTE_PAIR(0xE4F0, 0x5D16)
+DOUBLE_BYTE_PAIR(0xE4F1, 0x611B)
+DOUBLE_BYTE_PAIR(0xE4F2, 0x66D6)
+DOUBLE_BYTE_PAIR(0xE4F3, 0x6DAF)
+DOUBLE_BYTE_PAIR(0xE4F4, 0x788D)
+DOUBLE_BYTE_PAIR(0xE4F5, 0x827E)
+DOUBLE_BYTE_PAIR(0xE4F6, 0x9698)
+DOUBLE_BYTE_PAIR(0xE4F7, 0x9744)
+DOUBLE_BYTE_PAIR(0xE4F8, 0x5384)
+DOUBLE_BYTE_PAIR(0xE4F9, 0x627C)
+DOUBLE_BYTE_PAIR(0xE4FA, 0x6396)
+DOUBLE_BYTE_PAIR(0xE4FB, 0x6DB2)
+DOUBLE_BYTE_PAIR(0xE4FC, 0x7E0A)
+DOUBLE_BYTE_PAIR(0xE4FD, 0x814B)
+DOUBLE_BYTE_PAIR(0xE4FE, 0x984D)
+DOUBLE_BYTE_PAIR(0xE5A1, 0x6AFB)
+DOUBLE_BYTE_PAIR(0xE5A2, 0x7F4C)
+DOUBLE_BYTE_PAIR(0xE5A3, 0x9DAF)
+DOUBLE_BYTE_PAIR(0xE5A4, 0x9E1A)
+DOUBLE_BYTE_PAIR(0xE5A5, 0x4E5F)
+DOUBLE_BYTE_PAIR(0xE5A6, 0x503B)
+DOUBLE_BYTE_PAIR(0xE5A7, 0x51B6)
+DOUBLE_BYTE_PAIR(0xE5A8, 0x591C)
+DOUBLE_BYTE_PAIR(0xE5A9, 0x60F9)
+DOUBLE_BYTE_PAIR(0xE5AA, 0x63F6)
+DOUBLE_BYTE_PAIR(0xE5AB, 0x6930)
+DOUBLE_BYTE_PAIR(0xE5AC, 0x723A)
+DOUBLE_BYTE_PAIR(0xE5AD, 0x8036)
+DOUBLE_BYTE_PAIR(0xE5AE, 0xF974)
+DOUBLE_BYTE_PAIR(0xE5AF, 0x91CE)
+DOUBLE_BYTE_PAIR(0xE5B0, 0x5F31)
+DOUBLE_BYTE_PAIR(0xE5B1, 0xF975)
+DOUBLE_BYTE_PAIR(0xE5B2, 0xF976)
+DOUBLE_BYTE_PAIR(0xE5B3, 0x7D04)
+DOUBLE_BYTE_PAIR(0xE5B4, 0x82E5)
+DOUBLE_BYTE_PAIR(0xE5B5, 0x846F)
+DOUBLE_BYTE_PAIR(0xE5B6, 0x84BB)
+DOUBLE_BYTE_PAIR(0xE5B7, 0x85E5)
+DOUBLE_BYTE_PAIR(0xE5B8, 0x8E8D)
+DOUBLE_BYTE_PAIR(0xE5B9, 0xF977)
+DOUBLE_BYTE_PAIR(0xE5BA, 0x4F6F)
+DOUBLE_BYTE_PAIR(0xE5BB, 0xF978)
+DOUBLE_BYTE_PAIR(0xE5BC, 0xF979)
+DOUBLE_BYTE_PAIR(0xE5BD, 0x58E4)
+DOUBLE_BYTE_PAIR(0xE5BE, 0x5B43)
+DOUBLE_BYTE_PAIR(0xE5BF, 0x6059)
+DOUBLE_BYTE_PAIR(0xE5C0, 0x63DA)
+DOUBLE_BYTE_PAIR(0xE5C1, 0x6518)
+DOUBLE_BYTE_PAIR(0xE5C2, 0x656D)
+DOUBLE_BYTE_PAIR(0xE5C3, 0x6698)
+DOUBLE_BYTE_PAIR(0xE5C4, 0xF97A)
+DOUBLE_BYTE_PAIR(0xE5C5, 0x694A)
+DOUBLE_BYTE_PAIR(0xE5C6, 0x6A23)
+DOUBLE_BYTE_PAIR(0xE5C7, 0x6D0B)
+DOUBLE_BYTE_PAIR(0xE5C8, 0x7001)
+DOUBLE_BYTE_PAIR(0xE5C9, 0x716C)
+DOUBLE_BYTE_PAIR(0xE5CA, 0x75D2)
+DOUBLE_BYTE_PAIR(0xE5CB, 0x760D)
+DOUBLE_BYTE_PAIR(0xE5CC, 0x79B3)
+DOUBLE_BYTE_PAIR(0xE5CD, 0x7A70)
+DOUBLE_BYTE_PAIR(0xE5CE, 0xF97B)
+DOUBLE_BYTE_PAIR(0xE5CF, 0x7F8A)
+DOUBLE_BYTE_PAIR(0xE5D0, 0xF97C)
+DOUBLE_BYTE_PAIR(0xE5D1, 0x8944)
+DOUBLE_BYTE_PAIR(0xE5D2, 0xF97D)
+DOUBLE_BYTE_PAIR(0xE5D3, 0x8B93)
+DOUBLE_BYTE_PAIR(0xE5D4, 0x91C0)
+DOUBLE_BYTE_PAIR(0xE5D5, 0x967D)
+DOUBLE_BYTE_PAIR(0xE5D6, 0xF97E)
+DOUBLE_BYTE_PAIR(0xE5D7, 0x990A)
+DOUBLE_BYTE_PAIR(0xE5D8, 0x5704)
+DOUBLE_BYTE_PAIR(0xE5D9, 0x5FA1)
+DOUBLE_BYTE_PAIR(0xE5DA, 0x65BC)
+DOUBLE_BYTE_PAIR(0xE5DB, 0x6F01)
+DOUBLE_BYTE_PAIR(0xE5DC, 0x7600)
+DOUBLE_BYTE_PAIR(0xE5DD, 0x79A6)
+DOUBLE_BYTE_PAIR(0xE5DE, 0x8A9E)
+DOUBLE_BYTE_PAIR(0xE5DF, 0x99AD)
+DOUBLE_BYTE_PAIR(0xE5E0, 0x9B5A)
+DOUBLE_BYTE_PAIR(0xE5E1, 0x9F6C)
+DOUBLE_BYTE_PAIR(0xE5E2, 0x5104)
+DOUBLE_BYTE_PAIR(0xE5E3, 0x61B6)
+DOUBLE_BYTE_PAIR(0xE5E4, 0x6291)
+DOUBLE_BYTE_PAIR(0xE5E5, 0x6A8D)
+DOUBLE_BYTE_PAIR(0xE5E6, 0x81C6)
+DOUBLE_BYTE_PAIR(0xE5E7, 0x5043)
+DOUBLE_BYTE_PAIR(0xE5E8, 0x5830)
+DOUBLE_BYTE_PAIR(0xE5E9, 0x5F66)
+DOUBLE_BYTE_PAIR(0xE5EA, 0x7109)
+DOUBLE_BYTE_PAIR(0xE5EB, 0x8A00)
+DOUBLE_BYTE_PAIR(0xE5EC, 0x8AFA)
+DOUBLE_BYTE_PAIR(0xE5ED, 0x5B7C)
+DOUBLE_BYTE_PAIR(0xE5EE, 0x8616)
+DOUBLE_BYTE_PAIR(0xE5EF, 0x4FFA)
+DOUBLE_BYTE_PAIR(0xE5F0, 0x513C)
+DOUBLE_BYTE_PAIR(0xE5F1, 0x56B4)
+DOUBLE_BYTE_PAIR(0xE5F2, 0x5944)
+DOUBLE_BYTE_PAIR(0xE5F3, 0x63A9)
+DOUBLE_BYTE_PAIR(0xE5F4, 0x6DF9)
+DOUBLE_BYTE_PAIR(0xE5F5, 0x5DAA)
+DOUBLE_BYTE_PAIR(0xE5F6, 0x696D)
+DOUBLE_BYTE_PAIR(0xE5F7, 0x5186)
+DOUBLE_BYTE_PAIR(0xE5F8, 0x4E88)
+DOUBLE_BYTE_PAIR(0xE5F9, 0x4F59)
+DOUBLE_BYTE_PAIR(0xE5FA, 0xF97F)
+DOUBLE_BYTE_PAIR(0xE5FB, 0xF980)
+DOUBLE_BYTE_PAIR(0xE5FC, 0xF981)
+DOUBLE_BYTE_PAIR(0xE5FD, 0x5982)
+DOUBLE_BYTE_PAIR(0xE5FE, 0xF982)
+DOUBLE_BYTE_PAIR(0xE6A1, 0xF983)
+DOUBLE_BYTE_PAIR(0xE6A2, 0x6B5F)
+DOUBLE_BYTE_PAIR(0xE6A3, 0x6C5D)
+DOUBLE_BYTE_PAIR(0xE6A4, 0xF984)
+DOUBLE_BYTE_PAIR(0xE6A5, 0x74B5)
+DOUBLE_BYTE_PAIR(0xE6A6, 0x7916)
+DOUBLE_BYTE_PAIR(0xE6A7, 0xF985)
+DOUBLE_BYTE_PAIR(0xE6A8, 0x8207)
+DOUBLE_BYTE_PAIR(0xE6A9, 0x8245)
+DOUBLE_BYTE_PAIR(0xE6AA, 0x8339)
+DOUBLE_BYTE_PAIR(0xE6AB, 0x8F3F)
+DOUBLE_BYTE_PAIR(0xE6AC, 0x8F5D)
+DOUBLE_BYTE_PAIR(0xE6AD, 0xF986)
+DOUBLE_BYTE_PAIR(0xE6AE, 0x9918)
+DOUBLE_BYTE_PAIR(0xE6AF, 0xF987)
+DOUBLE_BYTE_PAIR(0xE6B0, 0xF988)
+DOUBLE_BYTE_PAIR(0xE6B1, 0xF989)
+DOUBLE_BYTE_PAIR(0xE6B2, 0x4EA6)
+DOUBLE_BYTE_PAIR(0xE6B3, 0xF98A)
+DOUBLE_BYTE_PAIR(0xE6B4, 0x57DF)
+DOUBLE_BYTE_PAIR(0xE6B5, 0x5F79)
+DOUBLE_BYTE_PAIR(0xE6B6, 0x6613)
+DOUBLE_BYTE_PAIR(0xE6B7, 0xF98B)
+DOUBLE_BYTE_PAIR(0xE6B8, 0xF98C)
+DOUBLE_BYTE_PAIR(0xE6B9, 0x75AB)
+DOUBLE_BYTE_PAIR(0xE6BA, 0x7E79)
+DOUBLE_BYTE_PAIR(0xE6BB, 0x8B6F)
+DOUBLE_BYTE_PAIR(0xE6BC, 0xF98D)
+DOUBLE_BYTE_PAIR(0xE6BD, 0x9006)
+DOUBLE_BYTE_PAIR(0xE6BE, 0x9A5B)
+DOUBLE_BYTE_PAIR(0xE6BF, 0x56A5)
+DOUBLE_BYTE_PAIR(0xE6C0, 0x5827)
+DOUBLE_BYTE_PAIR(0xE6C1, 0x59F8)
+DOUBLE_BYTE_PAIR(0xE6C2, 0x5A1F)
+DOUBLE_BYTE_PAIR(0xE6C3, 0x5BB4)
+DOUBLE_BYTE_PAIR(0xE6C4, 0xF98E)
+DOUBLE_BYTE_PAIR(0xE6C5, 0x5EF6)
+DOUBLE_BYTE_PAIR(0xE6C6, 0xF98F)
+DOUBLE_BYTE_PAIR(0xE6C7, 0xF990)
+DOUBLE_BYTE_PAIR(0xE6C8, 0x6350)
+DOUBLE_BYTE_PAIR(0xE6C9, 0x633B)
+DOUBLE_BYTE_PAIR(0xE6CA, 0xF991)
+DOUBLE_BYTE_PAIR(0xE6CB, 0x693D)
+DOUBLE_BYTE_PAIR(0xE6CC, 0x6C87)
+DOUBLE_BYTE_PAIR(0xE6CD, 0x6CBF)
+DOUBLE_BYTE_PAIR(0xE6CE, 0x6D8E)
+DOUBLE_BYTE_PAIR(0xE6CF, 0x6D93)
+DOUBLE_BYTE_PAIR(0xE6D0, 0x6DF5)
+DOUBLE_BYTE_PAIR(0xE6D1, 0x6F14)
+DOUBLE_BYTE_PAIR(0xE6D2, 0xF992)
+DOUBLE_BYTE_PAIR(0xE6D3, 0x70DF)
+DOUBLE_BYTE_PAIR(0xE6D4, 0x7136)
+DOUBLE_BYTE_PAIR(0xE6D5, 0x7159)
+DOUBLE_BYTE_PAIR(0xE6D6, 0xF993)
+DOUBLE_BYTE_PAIR(0xE6D7, 0x71C3)
+DOUBLE_BYTE_PAIR(0xE6D8, 0x71D5)
+DOUBLE_BYTE_PAIR(0xE6D9, 0xF994)
+DOUBLE_BYTE_PAIR(0xE6DA, 0x784F)
+DOUBLE_BYTE_PAIR(0xE6DB, 0x786F)
+DOUBLE_BYTE_PAIR(0xE6DC, 0xF995)
+DOUBLE_BYTE_PAIR(0xE6DD, 0x7B75)
+DOUBLE_BYTE_PAIR(0xE6DE, 0x7DE3)
+DOUBLE_BYTE_PAIR(0xE6DF, 0xF996)
+DOUBLE_BYTE_PAIR(0xE6E0, 0x7E2F)
+DOUBLE_BYTE_PAIR(0xE6E1, 0xF997)
+DOUBLE_BYTE_PAIR(0xE6E2, 0x884D)
+DOUBLE_BYTE_PAIR(0xE6E3, 0x8EDF)
+DOUBLE_BYTE_PAIR(0xE6E4, 0xF998)
+DOUBLE_BYTE_PAIR(0xE6E5, 0xF999)
+DOUBLE_BYTE_PAIR(0xE6E6, 0xF99A)
+DOUBLE_BYTE_PAIR(0xE6E7, 0x925B)
+DOUBLE_BYTE_PAIR(0xE6E8, 0xF99B)
+DOUBLE_BYTE_PAIR(0xE6E9, 0x9CF6)
+DOUBLE_BYTE_PAIR(0xE6EA, 0xF99C)
+DOUBLE_BYTE_PAIR(0xE6EB, 0xF99D)
+DOUBLE_BYTE_PAIR(0xE6EC, 0xF99E)
+DOUBLE_BYTE_PAIR(0xE6ED, 0x6085)
+DOUBLE_BYTE_PAIR(0xE6EE, 0x6D85)
+DOUBLE_BYTE_PAIR(0xE6EF, 0xF99F)
+DOUBLE_BYTE_PAIR(0xE6F0, 0x71B1)
+DOUBLE_BYTE_PAIR(0xE6F1, 0xF9A0)
+DOUBLE_BYTE_PAIR(0xE6F2, 0xF9A1)
+DOUBLE_BYTE_PAIR(0xE6F3, 0x95B1)
+DOUBLE_BYTE_PAIR(0xE6F4, 0x53AD)
+DOUBLE_BYTE_PAIR(0xE6F5, 0xF9A2)
+DOUBLE_BYTE_PAIR(0xE6F6, 0xF9A3)
+DOUBLE_BYTE_PAIR(0xE6F7, 0xF9A4)
+DOUBLE_BYTE_PAIR(0xE6F8, 0x67D3)
+DOUBLE_BYTE_PAIR(0xE6F9, 0xF9A5)
+DOUBLE_BYTE_PAIR(0xE6FA, 0x708E)
+DOUBLE_BYTE_PAIR(0xE6FB, 0x7130)
+DOUBLE_BYTE_PAIR(0xE6FC, 0x7430)
+DOUBLE_BYTE_PAIR(0xE6FD, 0x8276)
+DOUBLE_BYTE_PAIR(0xE6FE, 0x82D2)
+DOUBLE_BYTE_PAIR(0xE7A1, 0xF9A6)
+DOUBLE_BYTE_PAIR(0xE7A2, 0x95BB)
+DOUBLE_BYTE_PAIR(0xE7A3, 0x9AE5)
+DOUBLE_BYTE_PAIR(0xE7A4, 0x9E7D)
+DOUBLE_BYTE_PAIR(0xE7A5, 0x66C4)
+DOUBLE_BYTE_PAIR(0xE7A6, 0xF9A7)
+DOUBLE_BYTE_PAIR(0xE7A7, 0x71C1)
+DOUBLE_BYTE_PAIR(0xE7A8, 0x8449)
+DOUBLE_BYTE_PAIR(0xE7A9, 0xF9A8)
+DOUBLE_BYTE_PAIR(0xE7AA, 0xF9A9)
+DOUBLE_BYTE_PAIR(0xE7AB, 0x584B)
+DOUBLE_BYTE_PAIR(0xE7AC, 0xF9AA)
+DOUBLE_BYTE_PAIR(0xE7AD, 0xF9AB)
+DOUBLE_BYTE_PAIR(0xE7AE, 0x5DB8)
+DOUBLE_BYTE_PAIR(0xE7AF, 0x5F71)
+DOUBLE_BYTE_PAIR(0xE7B0, 0xF9AC)
+DOUBLE_BYTE_PAIR(0xE7B1, 0x6620)
+DOUBLE_BYTE_PAIR(0xE7B2, 0x668E)
+DOUBLE_BYTE_PAIR(0xE7B3, 0x6979)
+DOUBLE_BYTE_PAIR(0xE7B4, 0x69AE)
+DOUBLE_BYTE_PAIR(0xE7B5, 0x6C38)
+DOUBLE_BYTE_PAIR(0xE7B6, 0x6CF3)
+DOUBLE_BYTE_PAIR(0xE7B7, 0x6E36)
+DOUBLE_BYTE_PAIR(0xE7B8, 0x6F41)
+DOUBLE_BYTE_PAIR(0xE7B9, 0x6FDA)
+DOUBLE_BYTE_PAIR(0xE7BA, 0x701B)
+DOUBLE_BYTE_PAIR(0xE7BB, 0x702F)
+DOUBLE_BYTE_PAIR(0xE7BC, 0x7150)
+DOUBLE_BYTE_PAIR(0xE7BD, 0x71DF)
+DOUBLE_BYTE_PAIR(0xE7BE, 0x7370)
+DOUBLE_BYTE_PAIR(0xE7BF, 0xF9AD)
+DOUBLE_BYTE_PAIR(0xE7C0, 0x745B)
+DOUBLE_BYTE_PAIR(0xE7C1, 0xF9AE)
+DOUBLE_BYTE_PAIR(0xE7C2, 0x74D4)
+DOUBLE_BYTE_PAIR(0xE7C3, 0x76C8)
+DOUBLE_BYTE_PAIR(0xE7C4, 0x7A4E)
+DOUBLE_BYTE_PAIR(0xE7C5, 0x7E93)
+DOUBLE_BYTE_PAIR(0xE7C6, 0xF9AF)
+DOUBLE_BYTE_PAIR(0xE7C7, 0xF9B0)
+DOUBLE_BYTE_PAIR(0xE7C8, 0x82F1)
+DOUBLE_BYTE_PAIR(0xE7C9, 0x8A60)
+DOUBLE_BYTE_PAIR(0xE7CA, 0x8FCE)
+DOUBLE_BYTE_PAIR(0xE7CB, 0xF9B1)
+DOUBLE_BYTE_PAIR(0xE7CC, 0x9348)
+DOUBLE_BYTE_PAIR(0xE7CD, 0xF9B2)
+DOUBLE_BYTE_PAIR(0xE7CE, 0x9719)
+DOUBLE_BYTE_PAIR(0xE7CF, 0xF9B3)
+DOUBLE_BYTE_PAIR(0xE7D0, 0xF9B4)
+DOUBLE_BYTE_PAIR(0xE7D1, 0x4E42)
+DOUBLE_BYTE_PAIR(0xE7D2, 0x502A)
+DOUBLE_BYTE_PAIR(0xE7D3, 0xF9B5)
+DOUBLE_BYTE_PAIR(0xE7D4, 0x5208)
+DOUBLE_BYTE_PAIR(0xE7D5, 0x53E1)
+DOUBLE_BYTE_PAIR(0xE7D6, 0x66F3)
+DOUBLE_BYTE_PAIR(0xE7D7, 0x6C6D)
+DOUBLE_BYTE_PAIR(0xE7D8, 0x6FCA)
+DOUBLE_BYTE_PAIR(0xE7D9, 0x730A)
+DOUBLE_BYTE_PAIR(0xE7DA, 0x777F)
+DOUBLE_BYTE_PAIR(0xE7DB, 0x7A62)
+DOUBLE_BYTE_PAIR(0xE7DC, 0x82AE)
+DOUBLE_BYTE_PAIR(0xE7DD, 0x85DD)
+DOUBLE_BYTE_PAIR(0xE7DE, 0x8602)
+DOUBLE_BYTE_PAIR(0xE7DF, 0xF9B6)
+DOUBLE_BYTE_PAIR(0xE7E0, 0x88D4)
+DOUBLE_BYTE_PAIR(0xE7E1, 0x8A63)
+DOUBLE_BYTE_PAIR(0xE7E2, 0x8B7D)
+DOUBLE_BYTE_PAIR(0xE7E3, 0x8C6B)
+DOUBLE_BYTE_PAIR(0xE7E4, 0xF9B7)
+DOUBLE_BYTE_PAIR(0xE7E5, 0x92B3)
+DOUBLE_BYTE_PAIR(0xE7E6, 0xF9B8)
+DOUBLE_BYTE_PAIR(0xE7E7, 0x9713)
+DOUBLE_BYTE_PAIR(0xE7E8, 0x9810)
+DOUBLE_BYTE_PAIR(0xE7E9, 0x4E94)
+DOUBLE_BYTE_PAIR(0xE7EA, 0x4F0D)
+DOUBLE_BYTE_PAIR(0xE7EB, 0x4FC9)
+DOUBLE_BYTE_PAIR(0xE7EC, 0x50B2)
+DOUBLE_BYTE_PAIR(0xE7ED, 0x5348)
+DOUBLE_BYTE_PAIR(0xE7EE, 0x543E)
+DOUBLE_BYTE_PAIR(0xE7EF, 0x5433)
+DOUBLE_BYTE_PAIR(0xE7F0, 0x55DA)
+DOUBLE_BYTE_PAIR(0xE7F1, 0x5862)
+DOUBLE_BYTE_PAIR(0xE7F2, 0x58BA)
+DOUBLE_BYTE_PAIR(0xE7F3, 0x5967)
+DOUBLE_BYTE_PAIR(0xE7F4, 0x5A1B)
+DOUBLE_BYTE_PAIR(0xE7F5, 0x5BE4)
+DOUBLE_BYTE_PAIR(0xE7F6, 0x609F)
+DOUBLE_BYTE_PAIR(0xE7F7, 0xF9B9)
+DOUBLE_BYTE_PAIR(0xE7F8, 0x61CA)
+DOUBLE_BYTE_PAIR(0xE7F9, 0x6556)
+DOUBLE_BYTE_PAIR(0xE7FA, 0x65FF)
+DOUBLE_BYTE_PAIR(0xE7FB, 0x6664)
+DOUBLE_BYTE_PAIR(0xE7FC, 0x68A7)
+DOUBLE_BYTE_PAIR(0xE7FD, 0x6C5A)
+DOUBLE_BYTE_PAIR(0xE7FE, 0x6FB3)
+DOUBLE_BYTE_PAIR(0xE8A1, 0x70CF)
+DOUBLE_BYTE_PAIR(0xE8A2, 0x71AC)
+DOUBLE_BYTE_PAIR(0xE8A3, 0x7352)
+DOUBLE_BYTE_PAIR(0xE8A4, 0x7B7D)
+DOUBLE_BYTE_PAIR(0xE8A5, 0x8708)
+DOUBLE_BYTE_PAIR(0xE8A6, 0x8AA4)
+DOUBLE_BYTE_PAIR(0xE8A7, 0x9C32)
+DOUBLE_BYTE_PAIR(0xE8A8, 0x9F07)
+DOUBLE_BYTE_PAIR(0xE8A9, 0x5C4B)
+DOUBLE_BYTE_PAIR(0xE8AA, 0x6C83)
+DOUBLE_BYTE_PAIR(0xE8AB, 0x7344)
+DOUBLE_BYTE_PAIR(0xE8AC, 0x7389)
+DOUBLE_BYTE_PAIR(0xE8AD, 0x923A)
+DOUBLE_BYTE_PAIR(0xE8AE, 0x6EAB)
+DOUBLE_BYTE_PAIR(0xE8AF, 0x7465)
+DOUBLE_BYTE_PAIR(0xE8B0, 0x761F)
+DOUBLE_BYTE_PAIR(0xE8B1, 0x7A69)
+DOUBLE_BYTE_PAIR(0xE8B2, 0x7E15)
+DOUBLE_BYTE_PAIR(0xE8B3, 0x860A)
+DOUBLE_BYTE_PAIR(0xE8B4, 0x5140)
+DOUBLE_BYTE_PAIR(0xE8B5, 0x58C5)
+DOUBLE_BYTE_PAIR(0xE8B6, 0x64C1)
+DOUBLE_BYTE_PAIR(0xE8B7, 0x74EE)
+DOUBLE_BYTE_PAIR(0xE8B8, 0x7515)
+DOUBLE_BYTE_PAIR(0xE8B9, 0x7670)
+DOUBLE_BYTE_PAIR(0xE8BA, 0x7FC1)
+DOUBLE_BYTE_PAIR(0xE8BB, 0x9095)
+DOUBLE_BYTE_PAIR(0xE8BC, 0x96CD)
+DOUBLE_BYTE_PAIR(0xE8BD, 0x9954)
+DOUBLE_BYTE_PAIR(0xE8BE, 0x6E26)
+DOUBLE_BYTE_PAIR(0xE8BF, 0x74E6)
+DOUBLE_BYTE_PAIR(0xE8C0, 0x7AA9)
+DOUBLE_BYTE_PAIR(0xE8C1, 0x7AAA)
+DOUBLE_BYTE_PAIR(0xE8C2, 0x81E5)
+DOUBLE_BYTE_PAIR(0xE8C3, 0x86D9)
+DOUBLE_BYTE_PAIR(0xE8C4, 0x8778)
+DOUBLE_BYTE_PAIR(0xE8C5, 0x8A1B)
+DOUBLE_BYTE_PAIR(0xE8C6, 0x5A49)
+DOUBLE_BYTE_PAIR(0xE8C7, 0x5B8C)
+DOUBLE_BYTE_PAIR(0xE8C8, 0x5B9B)
+DOUBLE_BYTE_PAIR(0xE8C9, 0x68A1)
+DOUBLE_BYTE_PAIR(0xE8CA, 0x6900)
+DOUBLE_BYTE_PAIR(0xE8CB, 0x6D63)
+DOUBLE_BYTE_PAIR(0xE8CC, 0x73A9)
+DOUBLE_BYTE_PAIR(0xE8CD, 0x7413)
+DOUBLE_BYTE_PAIR(0xE8CE, 0x742C)
+DOUBLE_BYTE_PAIR(0xE8CF, 0x7897)
+DOUBLE_BYTE_PAIR(0xE8D0, 0x7DE9)
+DOUBLE_BYTE_PAIR(0xE8D1, 0x7FEB)
+DOUBLE_BYTE_PAIR(0xE8D2, 0x8118)
+DOUBLE_BYTE_PAIR(0xE8D3, 0x8155)
+DOUBLE_BYTE_PAIR(0xE8D4, 0x839E)
+DOUBLE_BYTE_PAIR(0xE8D5, 0x8C4C)
+DOUBLE_BYTE_PAIR(0xE8D6, 0x962E)
+DOUBLE_BYTE_PAIR(0xE8D7, 0x9811)
+DOUBLE_BYTE_PAIR(0xE8D8, 0x66F0)
+DOUBLE_BYTE_PAIR(0xE8D9, 0x5F80)
+DOUBLE_BYTE_PAIR(0xE8DA, 0x65FA)
+DOUBLE_BYTE_PAIR(0xE8DB, 0x6789)
+DOUBLE_BYTE_PAIR(0xE8DC, 0x6C6A)
+DOUBLE_BYTE_PAIR(0xE8DD, 0x738B)
+DOUBLE_BYTE_PAIR(0xE8DE, 0x502D)
+DOUBLE_BYTE_PAIR(0xE8DF, 0x5A03)
+DOUBLE_BYTE_PAIR(0xE8E0, 0x6B6A)
+DOUBLE_BYTE_PAIR(0xE8E1, 0x77EE)
+DOUBLE_BYTE_PAIR(0xE8E2, 0x5916)
+DOUBLE_BYTE_PAIR(0xE8E3, 0x5D6C)
+DOUBLE_BYTE_PAIR(0xE8E4, 0x5DCD)
+DOUBLE_BYTE_PAIR(0xE8E5, 0x7325)
+DOUBLE_BYTE_PAIR(0xE8E6, 0x754F)
+DOUBLE_BYTE_PAIR(0xE8E7, 0xF9BA)
+DOUBLE_BYTE_PAIR(0xE8E8, 0xF9BB)
+DOUBLE_BYTE_PAIR(0xE8E9, 0x50E5)
+DOUBLE_BYTE_PAIR(0xE8EA, 0x51F9)
+DOUBLE_BYTE_PAIR(0xE8EB, 0x582F)
+DOUBLE_BYTE_PAIR(0xE8EC, 0x592D)
+DOUBLE_BYTE_PAIR(0xE8ED, 0x5996)
+DOUBLE_BYTE_PAIR(0xE8EE, 0x59DA)
+DOUBLE_BYTE_PAIR(0xE8EF, 0x5BE5)
+DOUBLE_BYTE_PAIR(0xE8F0, 0xF9BC)
+DOUBLE_BYTE_PAIR(0xE8F1, 0xF9BD)
+DOUBLE_BYTE_PAIR(0xE8F2, 0x5DA2)
+DOUBLE_BYTE_PAIR(0xE8F3, 0x62D7)
+DOUBLE_BYTE_PAIR(0xE8F4, 0x6416)
+DOUBLE_BYTE_PAIR(0xE8F5, 0x6493)
+DOUBLE_BYTE_PAIR(0xE8F6, 0x64FE)
+DOUBLE_BYTE_PAIR(0xE8F7, 0xF9BE)
+DOUBLE_BYTE_PAIR(0xE8F8, 0x66DC)
+DOUBLE_BYTE_PAIR(0xE8F9, 0xF9BF)
+DOUBLE_BYTE_PAIR(0xE8FA, 0x6A48)
+DOUBLE_BYTE_PAIR(0xE8FB, 0xF9C0)
+DOUBLE_BYTE_PAIR(0xE8FC, 0x71FF)
+DOUBLE_BYTE_PAIR(0xE8FD, 0x7464)
+DOUBLE_BYTE_PAIR(0xE8FE, 0xF9C1)
+DOUBLE_BYTE_PAIR(0xE9A1, 0x7A88)
+DOUBLE_BYTE_PAIR(0xE9A2, 0x7AAF)
+DOUBLE_BYTE_PAIR(0xE9A3, 0x7E47)
+DOUBLE_BYTE_PAIR(0xE9A4, 0x7E5E)
+DOUBLE_BYTE_PAIR(0xE9A5, 0x8000)
+DOUBLE_BYTE_PAIR(0xE9A6, 0x8170)
+DOUBLE_BYTE_PAIR(0xE9A7, 0xF9C2)
+DOUBLE_BYTE_PAIR(0xE9A8, 0x87EF)
+DOUBLE_BYTE_PAIR(0xE9A9, 0x8981)
+DOUBLE_BYTE_PAIR(0xE9AA, 0x8B20)
+DOUBLE_BYTE_PAIR(0xE9AB, 0x9059)
+DOUBLE_BYTE_PAIR(0xE9AC, 0xF9C3)
+DOUBLE_BYTE_PAIR(0xE9AD, 0x9080)
+DOUBLE_BYTE_PAIR(0xE9AE, 0x9952)
+DOUBLE_BYTE_PAIR(0xE9AF, 0x617E)
+DOUBLE_BYTE_PAIR(0xE9B0, 0x6B32)
+DOUBLE_BYTE_PAIR(0xE9B1, 0x6D74)
+DOUBLE_BYTE_PAIR(0xE9B2, 0x7E1F)
+DOUBLE_BYTE_PAIR(0xE9B3, 0x8925)
+DOUBLE_BYTE_PAIR(0xE9B4, 0x8FB1)
+DOUBLE_BYTE_PAIR(0xE9B5, 0x4FD1)
+DOUBLE_BYTE_PAIR(0xE9B6, 0x50AD)
+DOUBLE_BYTE_PAIR(0xE9B7, 0x5197)
+DOUBLE_BYTE_PAIR(0xE9B8, 0x52C7)
+DOUBLE_BYTE_PAIR(0xE9B9, 0x57C7)
+DOUBLE_BYTE_PAIR(0xE9BA, 0x5889)
+DOUBLE_BYTE_PAIR(0xE9BB, 0x5BB9)
+DOUBLE_BYTE_PAIR(0xE9BC, 0x5EB8)
+DOUBLE_BYTE_PAIR(0xE9BD, 0x6142)
+DOUBLE_BYTE_PAIR(0xE9BE, 0x6995)
+DOUBLE_BYTE_PAIR(0xE9BF, 0x6D8C)
+DOUBLE_BYTE_PAIR(0xE9C0, 0x6E67)
+DOUBLE_BYTE_PAIR(0xE9C1, 0x6EB6)
+DOUBLE_BYTE_PAIR(0xE9C2, 0x7194)
+DOUBLE_BYTE_PAIR(0xE9C3, 0x7462)
+DOUBLE_BYTE_PAIR(0xE9C4, 0x7528)
+DOUBLE_BYTE_PAIR(0xE9C5, 0x752C)
+DOUBLE_BYTE_PAIR(0xE9C6, 0x8073)
+DOUBLE_BYTE_PAIR(0xE9C7, 0x8338)
+DOUBLE_BYTE_PAIR(0xE9C8, 0x84C9)
+DOUBLE_BYTE_PAIR(0xE9C9, 0x8E0A)
+DOUBLE_BYTE_PAIR(0xE9CA, 0x9394)
+DOUBLE_BYTE_PAIR(0xE9CB, 0x93DE)
+DOUBLE_BYTE_PAIR(0xE9CC, 0xF9C4)
+DOUBLE_BYTE_PAIR(0xE9CD, 0x4E8E)
+DOUBLE_BYTE_PAIR(0xE9CE, 0x4F51)
+DOUBLE_BYTE_PAIR(0xE9CF, 0x5076)
+DOUBLE_BYTE_PAIR(0xE9D0, 0x512A)
+DOUBLE_BYTE_PAIR(0xE9D1, 0x53C8)
+DOUBLE_BYTE_PAIR(0xE9D2, 0x53CB)
+DOUBLE_BYTE_PAIR(0xE9D3, 0x53F3)
+DOUBLE_BYTE_PAIR(0xE9D4, 0x5B87)
+DOUBLE_BYTE_PAIR(0xE9D5, 0x5BD3)
+DOUBLE_BYTE_PAIR(0xE9D6, 0x5C24)
+DOUBLE_BYTE_PAIR(0xE9D7, 0x611A)
+DOUBLE_BYTE_PAIR(0xE9D8, 0x6182)
+DOUBLE_BYTE_PAIR(0xE9D9, 0x65F4)
+DOUBLE_BYTE_PAIR(0xE9DA, 0x725B)
+DOUBLE_BYTE_PAIR(0xE9DB, 0x7397)
+DOUBLE_BYTE_PAIR(0xE9DC, 0x7440)
+DOUBLE_BYTE_PAIR(0xE9DD, 0x76C2)
+DOUBLE_BYTE_PAIR(0xE9DE, 0x7950)
+DOUBLE_BYTE_PAIR(0xE9DF, 0x7991)
+DOUBLE_BYTE_PAIR(0xE9E0, 0x79B9)
+DOUBLE_BYTE_PAIR(0xE9E1, 0x7D06)
+DOUBLE_BYTE_PAIR(0xE9E2, 0x7FBD)
+DOUBLE_BYTE_PAIR(0xE9E3, 0x828B)
+DOUBLE_BYTE_PAIR(0xE9E4, 0x85D5)
+DOUBLE_BYTE_PAIR(0xE9E5, 0x865E)
+DOUBLE_BYTE_PAIR(0xE9E6, 0x8FC2)
+DOUBLE_BYTE_PAIR(0xE9E7, 0x9047)
+DOUBLE_BYTE_PAIR(0xE9E8, 0x90F5)
+DOUBLE_BYTE_PAIR(0xE9E9, 0x91EA)
+DOUBLE_BYTE_PAIR(0xE9EA, 0x9685)
+DOUBLE_BYTE_PAIR(0xE9EB, 0x96E8)
+DOUBLE_BYTE_PAIR(0xE9EC, 0x96E9)
+DOUBLE_BYTE_PAIR(0xE9ED, 0x52D6)
+DOUBLE_BYTE_PAIR(0xE9EE, 0x5F67)
+DOUBLE_BYTE_PAIR(0xE9EF, 0x65ED)
+DOUBLE_BYTE_PAIR(0xE9F0, 0x6631)
+DOUBLE_BYTE_PAIR(0xE9F1, 0x682F)
+DOUBLE_BYTE_PAIR(0xE9F2, 0x715C)
+DOUBLE_BYTE_PAIR(0xE9F3, 0x7A36)
+DOUBLE_BYTE_PAIR(0xE9F4, 0x90C1)
+DOUBLE_BYTE_PAIR(0xE9F5, 0x980A)
+DOUBLE_BYTE_PAIR(0xE9F6, 0x4E91)
+DOUBLE_BYTE_PAIR(0xE9F7, 0xF9C5)
+DOUBLE_BYTE_PAIR(0xE9F8, 0x6A52)
+DOUBLE_BYTE_PAIR(0xE9F9, 0x6B9E)
+DOUBLE_BYTE_PAIR(0xE9FA, 0x6F90)
+DOUBLE_BYTE_PAIR(0xE9FB, 0x7189)
+DOUBLE_BYTE_PAIR(0xE9FC, 0x8018)
+DOUBLE_BYTE_PAIR(0xE9FD, 0x82B8)
+DOUBLE_BYTE_PAIR(0xE9FE, 0x8553)
+DOUBLE_BYTE_PAIR(0xEAA1, 0x904B)
+DOUBLE_BYTE_PAIR(0xEAA2, 0x9695)
+DOUBLE_BYTE_PAIR(0xEAA3, 0x96F2)
+DOUBLE_BYTE_PAIR(0xEAA4, 0x97FB)
+DOUBLE_BYTE_PAIR(0xEAA5, 0x851A)
+DOUBLE_BYTE_PAIR(0xEAA6, 0x9B31)
+DOUBLE_BYTE_PAIR(0xEAA7, 0x4E90)
+DOUBLE_BYTE_PAIR(0xEAA8, 0x718A)
+DOUBLE_BYTE_PAIR(0xEAA9, 0x96C4)
+DOUBLE_BYTE_PAIR(0xEAAA, 0x5143)
+DOUBLE_BYTE_PAIR(0xEAAB, 0x539F)
+DOUBLE_BYTE_PAIR(0xEAAC, 0x54E1)
+DOUBLE_BYTE_PAIR(0xEAAD, 0x5713)
+DOUBLE_BYTE_PAIR(0xEAAE, 0x5712)
+DOUBLE_BYTE_PAIR(0xEAAF, 0x57A3)
+DOUBLE_BYTE_PAIR(0xEAB0, 0x5A9B)
+DOUBLE_BYTE_PAIR(0xEAB1, 0x5AC4)
+DOUBLE_BYTE_PAIR(0xEAB2, 0x5BC3)
+DOUBLE_BYTE_PAIR(0xEAB3, 0x6028)
+DOUBLE_BYTE_PAIR(0xEAB4, 0x613F)
+DOUBLE_BYTE_PAIR(0xEAB5, 0x63F4)
+DOUBLE_BYTE_PAIR(0xEAB6, 0x6C85)
+DOUBLE_BYTE_PAIR(0xEAB7, 0x6D39)
+DOUBLE_BYTE_PAIR(0xEAB8, 0x6E72)
+DOUBLE_BYTE_PAIR(0xEAB9, 0x6E90)
+DOUBLE_BYTE_PAIR(0xEABA, 0x7230)
+DOUBLE_BYTE_PAIR(0xEABB, 0x733F)
+DOUBLE_BYTE_PAIR(0xEABC, 0x7457)
+DOUBLE_BYTE_PAIR(0xEABD, 0x82D1)
+DOUBLE_BYTE_PAIR(0xEABE, 0x8881)
+DOUBLE_BYTE_PAIR(0xEABF, 0x8F45)
+DOUBLE_BYTE_PAIR(0xEAC0, 0x9060)
+DOUBLE_BYTE_PAIR(0xEAC1, 0xF9C6)
+DOUBLE_BYTE_PAIR(0xEAC2, 0x9662)
+DOUBLE_BYTE_PAIR(0xEAC3, 0x9858)
+DOUBLE_BYTE_PAIR(0xEAC4, 0x9D1B)
+DOUBLE_BYTE_PAIR(0xEAC5, 0x6708)
+DOUBLE_BYTE_PAIR(0xEAC6, 0x8D8A)
+DOUBLE_BYTE_PAIR(0xEAC7, 0x925E)
+DOUBLE_BYTE_PAIR(0xEAC8, 0x4F4D)
+DOUBLE_BYTE_PAIR(0xEAC9, 0x5049)
+DOUBLE_BYTE_PAIR(0xEACA, 0x50DE)
+DOUBLE_BYTE_PAIR(0xEACB, 0x5371)
+DOUBLE_BYTE_PAIR(0xEACC, 0x570D)
+DOUBLE_BYTE_PAIR(0xEACD, 0x59D4)
+DOUBLE_BYTE_PAIR(0xEACE, 0x5A01)
+DOUBLE_BYTE_PAIR(0xEACF, 0x5C09)
+DOUBLE_BYTE_PAIR(0xEAD0, 0x6170)
+DOUBLE_BYTE_PAIR(0xEAD1, 0x6690)
+DOUBLE_BYTE_PAIR(0xEAD2, 0x6E2D)
+DOUBLE_BYTE_PAIR(0xEAD3, 0x7232)
+DOUBLE_BYTE_PAIR(0xEAD4, 0x744B)
+DOUBLE_BYTE_PAIR(0xEAD5, 0x7DEF)
+DOUBLE_BYTE_PAIR(0xEAD6, 0x80C3)
+DOUBLE_BYTE_PAIR(0xEAD7, 0x840E)
+DOUBLE_BYTE_PAIR(0xEAD8, 0x8466)
+DOUBLE_BYTE_PAIR(0xEAD9, 0x853F)
+DOUBLE_BYTE_PAIR(0xEADA, 0x875F)
+DOUBLE_BYTE_PAIR(0xEADB, 0x885B)
+DOUBLE_BYTE_PAIR(0xEADC, 0x8918)
+DOUBLE_BYTE_PAIR(0xEADD, 0x8B02)
+DOUBLE_BYTE_PAIR(0xEADE, 0x9055)
+DOUBLE_BYTE_PAIR(0xEADF, 0x97CB)
+DOUBLE_BYTE_PAIR(0xEAE0, 0x9B4F)
+DOUBLE_BYTE_PAIR(0xEAE1, 0x4E73)
+DOUBLE_BYTE_PAIR(0xEAE2, 0x4F91)
+DOUBLE_BYTE_PAIR(0xEAE3, 0x5112)
+DOUBLE_BYTE_PAIR(0xEAE4, 0x516A)
+DOUBLE_BYTE_PAIR(0xEAE5, 0xF9C7)
+DOUBLE_BYTE_PAIR(0xEAE6, 0x552F)
+DOUBLE_BYTE_PAIR(0xEAE7, 0x55A9)
+DOUBLE_BYTE_PAIR(0xEAE8, 0x5B7A)
+DOUBLE_BYTE_PAIR(0xEAE9, 0x5BA5)
+DOUBLE_BYTE_PAIR(0xEAEA, 0x5E7C)
+DOUBLE_BYTE_PAIR(0xEAEB, 0x5E7D)
+DOUBLE_BYTE_PAIR(0xEAEC, 0x5EBE)
+DOUBLE_BYTE_PAIR(0xEAED, 0x60A0)
+DOUBLE_BYTE_PAIR(0xEAEE, 0x60DF)
+DOUBLE_BYTE_PAIR(0xEAEF, 0x6108)
+DOUBLE_BYTE_PAIR(0xEAF0, 0x6109)
+DOUBLE_BYTE_PAIR(0xEAF1, 0x63C4)
+DOUBLE_BYTE_PAIR(0xEAF2, 0x6538)
+DOUBLE_BYTE_PAIR(0xEAF3, 0x6709)
+DOUBLE_BYTE_PAIR(0xEAF4, 0xF9C8)
+DOUBLE_BYTE_PAIR(0xEAF5, 0x67D4)
+DOUBLE_BYTE_PAIR(0xEAF6, 0x67DA)
+DOUBLE_BYTE_PAIR(0xEAF7, 0xF9C9)
+DOUBLE_BYTE_PAIR(0xEAF8, 0x6961)
+DOUBLE_BYTE_PAIR(0xEAF9, 0x6962)
+DOUBLE_BYTE_PAIR(0xEAFA, 0x6CB9)
+DOUBLE_BYTE_PAIR(0xEAFB, 0x6D27)
+DOUBLE_BYTE_PAIR(0xEAFC, 0xF9CA)
+DOUBLE_BYTE_PAIR(0xEAFD, 0x6E38)
+DOUBLE_BYTE_PAIR(0xEAFE, 0xF9CB)
+DOUBLE_BYTE_PAIR(0xEBA1, 0x6FE1)
+DOUBLE_BYTE_PAIR(0xEBA2, 0x7336)
+DOUBLE_BYTE_PAIR(0xEBA3, 0x7337)
+DOUBLE_BYTE_PAIR(0xEBA4, 0xF9CC)
+DOUBLE_BYTE_PAIR(0xEBA5, 0x745C)
+DOUBLE_BYTE_PAIR(0xEBA6, 0x7531)
+DOUBLE_BYTE_PAIR(0xEBA7, 0xF9CD)
+DOUBLE_BYTE_PAIR(0xEBA8, 0x7652)
+DOUBLE_BYTE_PAIR(0xEBA9, 0xF9CE)
+DOUBLE_BYTE_PAIR(0xEBAA, 0xF9CF)
+DOUBLE_BYTE_PAIR(0xEBAB, 0x7DAD)
+DOUBLE_BYTE_PAIR(0xEBAC, 0x81FE)
+DOUBLE_BYTE_PAIR(0xEBAD, 0x8438)
+DOUBLE_BYTE_PAIR(0xEBAE, 0x88D5)
+DOUBLE_BYTE_PAIR(0xEBAF, 0x8A98)
+DOUBLE_BYTE_PAIR(0xEBB0, 0x8ADB)
+DOUBLE_BYTE_PAIR(0xEBB1, 0x8AED)
+DOUBLE_BYTE_PAIR(0xEBB2, 0x8E30)
+DOUBLE_BYTE_PAIR(0xEBB3, 0x8E42)
+DOUBLE_BYTE_PAIR(0xEBB4, 0x904A)
+DOUBLE_BYTE_PAIR(0xEBB5, 0x903E)
+DOUBLE_BYTE_PAIR(0xEBB6, 0x907A)
+DOUBLE_BYTE_PAIR(0xEBB7, 0x9149)
+DOUBLE_BYTE_PAIR(0xEBB8, 0x91C9)
+DOUBLE_BYTE_PAIR(0xEBB9, 0x936E)
+DOUBLE_BYTE_PAIR(0xEBBA, 0xF9D0)
+DOUBLE_BYTE_PAIR(0xEBBB, 0xF9D1)
+DOUBLE_BYTE_PAIR(0xEBBC, 0x5809)
+DOUBLE_BYTE_PAIR(0xEBBD, 0xF9D2)
+DOUBLE_BYTE_PAIR(0xEBBE, 0x6BD3)
+DOUBLE_BYTE_PAIR(0xEBBF, 0x8089)
+DOUBLE_BYTE_PAIR(0xEBC0, 0x80B2)
+DOUBLE_BYTE_PAIR(0xEBC1, 0xF9D3)
+DOUBLE_BYTE_PAIR(0xEBC2, 0xF9D4)
+DOUBLE_BYTE_PAIR(0xEBC3, 0x5141)
+DOUBLE_BYTE_PAIR(0xEBC4, 0x596B)
+DOUBLE_BYTE_PAIR(0xEBC5, 0x5C39)
+DOUBLE_BYTE_PAIR(0xEBC6, 0xF9D5)
+DOUBLE_BYTE_PAIR(0xEBC7, 0xF9D6)
+DOUBLE_BYTE_PAIR(0xEBC8, 0x6F64)
+DOUBLE_BYTE_PAIR(0xEBC9, 0x73A7)
+DOUBLE_BYTE_PAIR(0xEBCA, 0x80E4)
+DOUBLE_BYTE_PAIR(0xEBCB, 0x8D07)
+DOUBLE_BYTE_PAIR(0xEBCC, 0xF9D7)
+DOUBLE_BYTE_PAIR(0xEBCD, 0x9217)
+DOUBLE_BYTE_PAIR(0xEBCE, 0x958F)
+DOUBLE_BYTE_PAIR(0xEBCF, 0xF9D8)
+DOUBLE_BYTE_PAIR(0xEBD0, 0xF9D9)
+DOUBLE_BYTE_PAIR(0xEBD1, 0xF9DA)
+DOUBLE_BYTE_PAIR(0xEBD2, 0xF9DB)
+DOUBLE_BYTE_PAIR(0xEBD3, 0x807F)
+DOUBLE_BYTE_PAIR(0xEBD4, 0x620E)
+DOUBLE_BYTE_PAIR(0xEBD5, 0x701C)
+DOUBLE_BYTE_PAIR(0xEBD6, 0x7D68)
+DOUBLE_BYTE_PAIR(0xEBD7, 0x878D)
+DOUBLE_BYTE_PAIR(0xEBD8, 0xF9DC)
+DOUBLE_BYTE_PAIR(0xEBD9, 0x57A0)
+DOUBLE_BYTE_PAIR(0xEBDA, 0x6069)
+DOUBLE_BYTE_PAIR(0xEBDB, 0x6147)
+DOUBLE_BYTE_PAIR(0xEBDC, 0x6BB7)
+DOUBLE_BYTE_PAIR(0xEBDD, 0x8ABE)
+DOUBLE_BYTE_PAIR(0xEBDE, 0x9280)
+DOUBLE_BYTE_PAIR(0xEBDF, 0x96B1)
+DOUBLE_BYTE_PAIR(0xEBE0, 0x4E59)
+DOUBLE_BYTE_PAIR(0xEBE1, 0x541F)
+DOUBLE_BYTE_PAIR(0xEBE2, 0x6DEB)
+DOUBLE_BYTE_PAIR(0xEBE3, 0x852D)
+DOUBLE_BYTE_PAIR(0xEBE4, 0x9670)
+DOUBLE_BYTE_PAIR(0xEBE5, 0x97F3)
+DOUBLE_BYTE_PAIR(0xEBE6, 0x98EE)
+DOUBLE_BYTE_PAIR(0xEBE7, 0x63D6)
+DOUBLE_BYTE_PAIR(0xEBE8, 0x6CE3)
+DOUBLE_BYTE_PAIR(0xEBE9, 0x9091)
+DOUBLE_BYTE_PAIR(0xEBEA, 0x51DD)
+DOUBLE_BYTE_PAIR(0xEBEB, 0x61C9)
+DOUBLE_BYTE_PAIR(0xEBEC, 0x81BA)
+DOUBLE_BYTE_PAIR(0xEBED, 0x9DF9)
+DOUBLE_BYTE_PAIR(0xEBEE, 0x4F9D)
+DOUBLE_BYTE_PAIR(0xEBEF, 0x501A)
+DOUBLE_BYTE_PAIR(0xEBF0, 0x5100)
+DOUBLE_BYTE_PAIR(0xEBF1, 0x5B9C)
+DOUBLE_BYTE_PAIR(0xEBF2, 0x610F)
+DOUBLE_BYTE_PAIR(0xEBF3, 0x61FF)
+DOUBLE_BYTE_PAIR(0xEBF4, 0x64EC)
+DOUBLE_BYTE_PAIR(0xEBF5, 0x6905)
+DOUBLE_BYTE_PAIR(0xEBF6, 0x6BC5)
+DOUBLE_BYTE_PAIR(0xEBF7, 0x7591)
+DOUBLE_BYTE_PAIR(0xEBF8, 0x77E3)
+DOUBLE_BYTE_PAIR(0xEBF9, 0x7FA9)
+DOUBLE_BYTE_PAIR(0xEBFA, 0x8264)
+DOUBLE_BYTE_PAIR(0xEBFB, 0x858F)
+DOUBLE_BYTE_PAIR(0xEBFC, 0x87FB)
+DOUBLE_BYTE_PAIR(0xEBFD, 0x8863)
+DOUBLE_BYTE_PAIR(0xEBFE, 0x8ABC)
+DOUBLE_BYTE_PAIR(0xECA1, 0x8B70)
+DOUBLE_BYTE_PAIR(0xECA2, 0x91AB)
+DOUBLE_BYTE_PAIR(0xECA3, 0x4E8C)
+DOUBLE_BYTE_PAIR(0xECA4, 0x4EE5)
+DOUBLE_BYTE_PAIR(0xECA5, 0x4F0A)
+DOUBLE_BYTE_PAIR(0xECA6, 0xF9DD)
+DOUBLE_BYTE_PAIR(0xECA7, 0xF9DE)
+DOUBLE_BYTE_PAIR(0xECA8, 0x5937)
+DOUBLE_BYTE_PAIR(0xECA9, 0x59E8)
+DOUBLE_BYTE_PAIR(0xECAA, 0xF9DF)
+DOUBLE_BYTE_PAIR(0xECAB, 0x5DF2)
+DOUBLE_BYTE_PAIR(0xECAC, 0x5F1B)
+DOUBLE_BYTE_PAIR(0xECAD, 0x5F5B)
+DOUBLE_BYTE_PAIR(0xECAE, 0x6021)
+DOUBLE_BYTE_PAIR(0xECAF, 0xF9E0)
+DOUBLE_BYTE_PAIR(0xECB0, 0xF9E1)
+DOUBLE_BYTE_PAIR(0xECB1, 0xF9E2)
+DOUBLE_BYTE_PAIR(0xECB2, 0xF9E3)
+DOUBLE_BYTE_PAIR(0xECB3, 0x723E)
+DOUBLE_BYTE_PAIR(0xECB4, 0x73E5)
+DOUBLE_BYTE_PAIR(0xECB5, 0xF9E4)
+DOUBLE_BYTE_PAIR(0xECB6, 0x7570)
+DOUBLE_BYTE_PAIR(0xECB7, 0x75CD)
+DOUBLE_BYTE_PAIR(0xECB8, 0xF9E5)
+DOUBLE_BYTE_PAIR(0xECB9, 0x79FB)
+DOUBLE_BYTE_PAIR(0xECBA, 0xF9E6)
+DOUBLE_BYTE_PAIR(0xECBB, 0x800C)
+DOUBLE_BYTE_PAIR(0xECBC, 0x8033)
+DOUBLE_BYTE_PAIR(0xECBD, 0x8084)
+DOUBLE_BYTE_PAIR(0xECBE, 0x82E1)
+DOUBLE_BYTE_PAIR(0xECBF, 0x8351)
+DOUBLE_BYTE_PAIR(0xECC0, 0xF9E7)
+DOUBLE_BYTE_PAIR(0xECC1, 0xF9E8)
+DOUBLE_BYTE_PAIR(0xECC2, 0x8CBD)
+DOUBLE_BYTE_PAIR(0xECC3, 0x8CB3)
+DOUBLE_BYTE_PAIR(0xECC4, 0x9087)
+DOUBLE_BYTE_PAIR(0xECC5, 0xF9E9)
+DOUBLE_BYTE_PAIR(0xECC6, 0xF9EA)
+DOUBLE_BYTE_PAIR(0xECC7, 0x98F4)
+DOUBLE_BYTE_PAIR(0xECC8, 0x990C)
+DOUBLE_BYTE_PAIR(0xECC9, 0xF9EB)
+DOUBLE_BYTE_PAIR(0xECCA, 0xF9EC)
+DOUBLE_BYTE_PAIR(0xECCB, 0x7037)
+DOUBLE_BYTE_PAIR(0xECCC, 0x76CA)
+DOUBLE_BYTE_PAIR(0xECCD, 0x7FCA)
+DOUBLE_BYTE_PAIR(0xECCE, 0x7FCC)
+DOUBLE_BYTE_PAIR(0xECCF, 0x7FFC)
+DOUBLE_BYTE_PAIR(0xECD0, 0x8B1A)
+DOUBLE_BYTE_PAIR(0xECD1, 0x4EBA)
+DOUBLE_BYTE_PAIR(0xECD2, 0x4EC1)
+DOUBLE_BYTE_PAIR(0xECD3, 0x5203)
+DOUBLE_BYTE_PAIR(0xECD4, 0x5370)
+DOUBLE_BYTE_PAIR(0xECD5, 0xF9ED)
+DOUBLE_BYTE_PAIR(0xECD6, 0x54BD)
+DOUBLE_BYTE_PAIR(0xECD7, 0x56E0)
+DOUBLE_BYTE_PAIR(0xECD8, 0x59FB)
+DOUBLE_BYTE_PAIR(0xECD9, 0x5BC5)
+DOUBLE_BYTE_PAIR(0xECDA, 0x5F15)
+DOUBLE_BYTE_PAIR(0xECDB, 0x5FCD)
+DOUBLE_BYTE_PAIR(0xECDC, 0x6E6E)
+DOUBLE_BYTE_PAIR(0xECDD, 0xF9EE)
+DOUBLE_BYTE_PAIR(0xECDE, 0xF9EF)
+DOUBLE_BYTE_PAIR(0xECDF, 0x7D6A)
+DOUBLE_BYTE_PAIR(0xECE0, 0x8335)
+DOUBLE_BYTE_PAIR(0xECE1, 0xF9F0)
+DOUBLE_BYTE_PAIR(0xECE2, 0x8693)
+DOUBLE_BYTE_PAIR(0xECE3, 0x8A8D)
+DOUBLE_BYTE_PAIR(0xECE4, 0xF9F1)
+DOUBLE_BYTE_PAIR(0xECE5, 0x976D)
+DOUBLE_BYTE_PAIR(0xECE6, 0x9777)
+DOUBLE_BYTE_PAIR(0xECE7, 0xF9F2)
+DOUBLE_BYTE_PAIR(0xECE8, 0xF9F3)
+DOUBLE_BYTE_PAIR(0xECE9, 0x4E00)
+DOUBLE_BYTE_PAIR(0xECEA, 0x4F5A)
+DOUBLE_BYTE_PAIR(0xECEB, 0x4F7E)
+DOUBLE_BYTE_PAIR(0xECEC, 0x58F9)
+DOUBLE_BYTE_PAIR(0xECED, 0x65E5)
+DOUBLE_BYTE_PAIR(0xECEE, 0x6EA2)
+DOUBLE_BYTE_PAIR(0xECEF, 0x9038)
+DOUBLE_BYTE_PAIR(0xECF0, 0x93B0)
+DOUBLE_BYTE_PAIR(0xECF1, 0x99B9)
+DOUBLE_BYTE_PAIR(0xECF2, 0x4EFB)
+DOUBLE_BYTE_PAIR(0xECF3, 0x58EC)
+DOUBLE_BYTE_PAIR(0xECF4, 0x598A)
+DOUBLE_BYTE_PAIR(0xECF5, 0x59D9)
+DOUBLE_BYTE_PAIR(0xECF6, 0x6041)
+DOUBLE_BYTE_PAIR(0xECF7, 0xF9F4)
+DOUBLE_BYTE_PAIR(0xECF8, 0xF9F5)
+DOUBLE_BYTE_PAIR(0xECF9, 0x7A14)
+DOUBLE_BYTE_PAIR(0xECFA, 0xF9F6)
+DOUBLE_BYTE_PAIR(0xECFB, 0x834F)
+DOUBLE_BYTE_PAIR(0xECFC, 0x8CC3)
+DOUBLE_BYTE_PAIR(0xECFD, 0x5165)
+DOUBLE_BYTE_PAIR(0xECFE, 0x5344)
+DOUBLE_BYTE_PAIR(0xEDA1, 0xF9F7)
+DOUBLE_BYTE_PAIR(0xEDA2, 0xF9F8)
+DOUBLE_BYTE_PAIR(0xEDA3, 0xF9F9)
+DOUBLE_BYTE_PAIR(0xEDA4, 0x4ECD)
+DOUBLE_BYTE_PAIR(0xEDA5, 0x5269)
+DOUBLE_BYTE_PAIR(0xEDA6, 0x5B55)
+DOUBLE_BYTE_PAIR(0xEDA7, 0x82BF)
+DOUBLE_BYTE_PAIR(0xEDA8, 0x4ED4)
+DOUBLE_BYTE_PAIR(0xEDA9, 0x523A)
+DOUBLE_BYTE_PAIR(0xEDAA, 0x54A8)
+DOUBLE_BYTE_PAIR(0xEDAB, 0x59C9)
+DOUBLE_BYTE_PAIR(0xEDAC, 0x59FF)
+DOUBLE_BYTE_PAIR(0xEDAD, 0x5B50)
+DOUBLE_BYTE_PAIR(0xEDAE, 0x5B57)
+DOUBLE_BYTE_PAIR(0xEDAF, 0x5B5C)
+DOUBLE_BYTE_PAIR(0xEDB0, 0x6063)
+DOUBLE_BYTE_PAIR(0xEDB1, 0x6148)
+DOUBLE_BYTE_PAIR(0xEDB2, 0x6ECB)
+DOUBLE_BYTE_PAIR(0xEDB3, 0x7099)
+DOUBLE_BYTE_PAIR(0xEDB4, 0x716E)
+DOUBLE_BYTE_PAIR(0xEDB5, 0x7386)
+DOUBLE_BYTE_PAIR(0xEDB6, 0x74F7)
+DOUBLE_BYTE_PAIR(0xEDB7, 0x75B5)
+DOUBLE_BYTE_PAIR(0xEDB8, 0x78C1)
+DOUBLE_BYTE_PAIR(0xEDB9, 0x7D2B)
+DOUBLE_BYTE_PAIR(0xEDBA, 0x8005)
+DOUBLE_BYTE_PAIR(0xEDBB, 0x81EA)
+DOUBLE_BYTE_PAIR(0xEDBC, 0x8328)
+DOUBLE_BYTE_PAIR(0xEDBD, 0x8517)
+DOUBLE_BYTE_PAIR(0xEDBE, 0x85C9)
+DOUBLE_BYTE_PAIR(0xEDBF, 0x8AEE)
+DOUBLE_BYTE_PAIR(0xEDC0, 0x8CC7)
+DOUBLE_BYTE_PAIR(0xEDC1, 0x96CC)
+DOUBLE_BYTE_PAIR(0xEDC2, 0x4F5C)
+DOUBLE_BYTE_PAIR(0xEDC3, 0x52FA)
+DOUBLE_BYTE_PAIR(0xEDC4, 0x56BC)
+DOUBLE_BYTE_PAIR(0xEDC5, 0x65AB)
+DOUBLE_BYTE_PAIR(0xEDC6, 0x6628)
+DOUBLE_BYTE_PAIR(0xEDC7, 0x707C)
+DOUBLE_BYTE_PAIR(0xEDC8, 0x70B8)
+DOUBLE_BYTE_PAIR(0xEDC9, 0x7235)
+DOUBLE_BYTE_PAIR(0xEDCA, 0x7DBD)
+DOUBLE_BYTE_PAIR(0xEDCB, 0x828D)
+DOUBLE_BYTE_PAIR(0xEDCC, 0x914C)
+DOUBLE_BYTE_PAIR(0xEDCD, 0x96C0)
+DOUBLE_BYTE_PAIR(0xEDCE, 0x9D72)
+DOUBLE_BYTE_PAIR(0xEDCF, 0x5B71)
+DOUBLE_BYTE_PAIR(0xEDD0, 0x68E7)
+DOUBLE_BYTE_PAIR(0xEDD1, 0x6B98)
+DOUBLE_BYTE_PAIR(0xEDD2, 0x6F7A)
+DOUBLE_BYTE_PAIR(0xEDD3, 0x76DE)
+DOUBLE_BYTE_PAIR(0xEDD4, 0x5C91)
+DOUBLE_BYTE_PAIR(0xEDD5, 0x66AB)
+DOUBLE_BYTE_PAIR(0xEDD6, 0x6F5B)
+DOUBLE_BYTE_PAIR(0xEDD7, 0x7BB4)
+DOUBLE_BYTE_PAIR(0xEDD8, 0x7C2A)
+DOUBLE_BYTE_PAIR(0xEDD9, 0x8836)
+DOUBLE_BYTE_PAIR(0xEDDA, 0x96DC)
+DOUBLE_BYTE_PAIR(0xEDDB, 0x4E08)
+DOUBLE_BYTE_PAIR(0xEDDC, 0x4ED7)
+DOUBLE_BYTE_PAIR(0xEDDD, 0x5320)
+DOUBLE_BYTE_PAIR(0xEDDE, 0x5834)
+DOUBLE_BYTE_PAIR(0xEDDF, 0x58BB)
+DOUBLE_BYTE_PAIR(0xEDE0, 0x58EF)
+DOUBLE_BYTE_PAIR(0xEDE1, 0x596C)
+DOUBLE_BYTE_PAIR(0xEDE2, 0x5C07)
+DOUBLE_BYTE_PAIR(0xEDE3, 0x5E33)
+DOUBLE_BYTE_PAIR(0xEDE4, 0x5E84)
+DOUBLE_BYTE_PAIR(0xEDE5, 0x5F35)
+DOUBLE_BYTE_PAIR(0xEDE6, 0x638C)
+DOUBLE_BYTE_PAIR(0xEDE7, 0x66B2)
+DOUBLE_BYTE_PAIR(0xEDE8, 0x6756)
+DOUBLE_BYTE_PAIR(0xEDE9, 0x6A1F)
+DOUBLE_BYTE_PAIR(0xEDEA, 0x6AA3)
+DOUBLE_BYTE_PAIR(0xEDEB, 0x6B0C)
+DOUBLE_BYTE_PAIR(0xEDEC, 0x6F3F)
+DOUBLE_BYTE_PAIR(0xEDED, 0x7246)
+DOUBLE_BYTE_PAIR(0xEDEE, 0xF9FA)
+DOUBLE_BYTE_PAIR(0xEDEF, 0x7350)
+DOUBLE_BYTE_PAIR(0xEDF0, 0x748B)
+DOUBLE_BYTE_PAIR(0xEDF1, 0x7AE0)
+DOUBLE_BYTE_PAIR(0xEDF2, 0x7CA7)
+DOUBLE_BYTE_PAIR(0xEDF3, 0x8178)
+DOUBLE_BYTE_PAIR(0xEDF4, 0x81DF)
+DOUBLE_BYTE_PAIR(0xEDF5, 0x81E7)
+DOUBLE_BYTE_PAIR(0xEDF6, 0x838A)
+DOUBLE_BYTE_PAIR(0xEDF7, 0x846C)
+DOUBLE_BYTE_PAIR(0xEDF8, 0x8523)
+DOUBLE_BYTE_PAIR(0xEDF9, 0x8594)
+DOUBLE_BYTE_PAIR(0xEDFA, 0x85CF)
+DOUBLE_BYTE_PAIR(0xEDFB, 0x88DD)
+DOUBLE_BYTE_PAIR(0xEDFC, 0x8D13)
+DOUBLE_BYTE_PAIR(0xEDFD, 0x91AC)
+DOUBLE_BYTE_PAIR(0xEDFE, 0x9577)
+DOUBLE_BYTE_PAIR(0xEEA1, 0x969C)
+DOUBLE_BYTE_PAIR(0xEEA2, 0x518D)
+DOUBLE_BYTE_PAIR(0xEEA3, 0x54C9)
+DOUBLE_BYTE_PAIR(0xEEA4, 0x5728)
+DOUBLE_BYTE_PAIR(0xEEA5, 0x5BB0)
+DOUBLE_BYTE_PAIR(0xEEA6, 0x624D)
+DOUBLE_BYTE_PAIR(0xEEA7, 0x6750)
+DOUBLE_BYTE_PAIR(0xEEA8, 0x683D)
+DOUBLE_BYTE_PAIR(0xEEA9, 0x6893)
+DOUBLE_BYTE_PAIR(0xEEAA, 0x6E3D)
+DOUBLE_BYTE_PAIR(0xEEAB, 0x6ED3)
+DOUBLE_BYTE_PAIR(0xEEAC, 0x707D)
+DOUBLE_BYTE_PAIR(0xEEAD, 0x7E21)
+DOUBLE_BYTE_PAIR(0xEEAE, 0x88C1)
+DOUBLE_BYTE_PAIR(0xEEAF, 0x8CA1)
+DOUBLE_BYTE_PAIR(0xEEB0, 0x8F09)
+DOUBLE_BYTE_PAIR(0xEEB1, 0x9F4B)
+DOUBLE_BYTE_PAIR(0xEEB2, 0x9F4E)
+DOUBLE_BYTE_PAIR(0xEEB3, 0x722D)
+DOUBLE_BYTE_PAIR(0xEEB4, 0x7B8F)
+DOUBLE_BYTE_PAIR(0xEEB5, 0x8ACD)
+DOUBLE_BYTE_PAIR(0xEEB6, 0x931A)
+DOUBLE_BYTE_PAIR(0xEEB7, 0x4F47)
+DOUBLE_BYTE_PAIR(0xEEB8, 0x4F4E)
+DOUBLE_BYTE_PAIR(0xEEB9, 0x5132)
+DOUBLE_BYTE_PAIR(0xEEBA, 0x5480)
+DOUBLE_BYTE_PAIR(0xEEBB, 0x59D0)
+DOUBLE_BYTE_PAIR(0xEEBC, 0x5E95)
+DOUBLE_BYTE_PAIR(0xEEBD, 0x62B5)
+DOUBLE_BYTE_PAIR(0xEEBE, 0x6775)
+DOUBLE_BYTE_PAIR(0xEEBF, 0x696E)
+DOUBLE_BYTE_PAIR(0xEEC0, 0x6A17)
+DOUBLE_BYTE_PAIR(0xEEC1, 0x6CAE)
+DOUBLE_BYTE_PAIR(0xEEC2, 0x6E1A)
+DOUBLE_BYTE_PAIR(0xEEC3, 0x72D9)
+DOUBLE_BYTE_PAIR(0xEEC4, 0x732A)
+DOUBLE_BYTE_PAIR(0xEEC5, 0x75BD)
+DOUBLE_BYTE_PAIR(0xEEC6, 0x7BB8)
+DOUBLE_BYTE_PAIR(0xEEC7, 0x7D35)
+DOUBLE_BYTE_PAIR(0xEEC8, 0x82E7)
+DOUBLE_BYTE_PAIR(0xEEC9, 0x83F9)
+DOUBLE_BYTE_PAIR(0xEECA, 0x8457)
+DOUBLE_BYTE_PAIR(0xEECB, 0x85F7)
+DOUBLE_BYTE_PAIR(0xEECC, 0x8A5B)
+DOUBLE_BYTE_PAIR(0xEECD, 0x8CAF)
+DOUBLE_BYTE_PAIR(0xEECE, 0x8E87)
+DOUBLE_BYTE_PAIR(0xEECF, 0x9019)
+DOUBLE_BYTE_PAIR(0xEED0, 0x90B8)
+DOUBLE_BYTE_PAIR(0xEED1, 0x96CE)
+DOUBLE_BYTE_PAIR(0xEED2, 0x9F5F)
+DOUBLE_BYTE_PAIR(0xEED3, 0x52E3)
+DOUBLE_BYTE_PAIR(0xEED4, 0x540A)
+DOUBLE_BYTE_PAIR(0xEED5, 0x5AE1)
+DOUBLE_BYTE_PAIR(0xEED6, 0x5BC2)
+DOUBLE_BYTE_PAIR(0xEED7, 0x6458)
+DOUBLE_BYTE_PAIR(0xEED8, 0x6575)
+DOUBLE_BYTE_PAIR(0xEED9, 0x6EF4)
+DOUBLE_BYTE_PAIR(0xEEDA, 0x72C4)
+DOUBLE_BYTE_PAIR(0xEEDB, 0xF9FB)
+DOUBLE_BYTE_PAIR(0xEEDC, 0x7684)
+DOUBLE_BYTE_PAIR(0xEEDD, 0x7A4D)
+DOUBLE_BYTE_PAIR(0xEEDE, 0x7B1B)
+DOUBLE_BYTE_PAIR(0xEEDF, 0x7C4D)
+DOUBLE_BYTE_PAIR(0xEEE0, 0x7E3E)
+DOUBLE_BYTE_PAIR(0xEEE1, 0x7FDF)
+DOUBLE_BYTE_PAIR(0xEEE2, 0x837B)
+DOUBLE_BYTE_PAIR(0xEEE3, 0x8B2B)
+DOUBLE_BYTE_PAIR(0xEEE4, 0x8CCA)
+DOUBLE_BYTE_PAIR(0xEEE5, 0x8D64)
+DOUBLE_BYTE_PAIR(0xEEE6, 0x8DE1)
+DOUBLE_BYTE_PAIR(0xEEE7, 0x8E5F)
+DOUBLE_BYTE_PAIR(0xEEE8, 0x8FEA)
+DOUBLE_BYTE_PAIR(0xEEE9, 0x8FF9)
+DOUBLE_BYTE_PAIR(0xEEEA, 0x9069)
+DOUBLE_BYTE_PAIR(0xEEEB, 0x93D1)
+DOUBLE_BYTE_PAIR(0xEEEC, 0x4F43)
+DOUBLE_BYTE_PAIR(0xEEED, 0x4F7A)
+DOUBLE_BYTE_PAIR(0xEEEE, 0x50B3)
+DOUBLE_BYTE_PAIR(0xEEEF, 0x5168)
+DOUBLE_BYTE_PAIR(0xEEF0, 0x5178)
+DOUBLE_BYTE_PAIR(0xEEF1, 0x524D)
+DOUBLE_BYTE_PAIR(0xEEF2, 0x526A)
+DOUBLE_BYTE_PAIR(0xEEF3, 0x5861)
+DOUBLE_BYTE_PAIR(0xEEF4, 0x587C)
+DOUBLE_BYTE_PAIR(0xEEF5, 0x5960)
+DOUBLE_BYTE_PAIR(0xEEF6, 0x5C08)
+DOUBLE_BYTE_PAIR(0xEEF7, 0x5C55)
+DOUBLE_BYTE_PAIR(0xEEF8, 0x5EDB)
+DOUBLE_BYTE_PAIR(0xEEF9, 0x609B)
+DOUBLE_BYTE_PAIR(0xEEFA, 0x6230)
+DOUBLE_BYTE_PAIR(0xEEFB, 0x6813)
+DOUBLE_BYTE_PAIR(0xEEFC, 0x6BBF)
+DOUBLE_BYTE_PAIR(0xEEFD, 0x6C08)
+DOUBLE_BYTE_PAIR(0xEEFE, 0x6FB1)
+DOUBLE_BYTE_PAIR(0xEFA1, 0x714E)
+DOUBLE_BYTE_PAIR(0xEFA2, 0x7420)
+DOUBLE_BYTE_PAIR(0xEFA3, 0x7530)
+DOUBLE_BYTE_PAIR(0xEFA4, 0x7538)
+DOUBLE_BYTE_PAIR(0xEFA5, 0x7551)
+DOUBLE_BYTE_PAIR(0xEFA6, 0x7672)
+DOUBLE_BYTE_PAIR(0xEFA7, 0x7B4C)
+DOUBLE_BYTE_PAIR(0xEFA8, 0x7B8B)
+DOUBLE_BYTE_PAIR(0xEFA9, 0x7BAD)
+DOUBLE_BYTE_PAIR(0xEFAA, 0x7BC6)
+DOUBLE_BYTE_PAIR(0xEFAB, 0x7E8F)
+DOUBLE_BYTE_PAIR(0xEFAC, 0x8A6E)
+DOUBLE_BYTE_PAIR(0xEFAD, 0x8F3E)
+DOUBLE_BYTE_PAIR(0xEFAE, 0x8F49)
+DOUBLE_BYTE_PAIR(0xEFAF, 0x923F)
+DOUBLE_BYTE_PAIR(0xEFB0, 0x9293)
+DOUBLE_BYTE_PAIR(0xEFB1, 0x9322)
+DOUBLE_BYTE_PAIR(0xEFB2, 0x942B)
+DOUBLE_BYTE_PAIR(0xEFB3, 0x96FB)
+DOUBLE_BYTE_PAIR(0xEFB4, 0x985A)
+DOUBLE_BYTE_PAIR(0xEFB5, 0x986B)
+DOUBLE_BYTE_PAIR(0xEFB6, 0x991E)
+DOUBLE_BYTE_PAIR(0xEFB7, 0x5207)
+DOUBLE_BYTE_PAIR(0xEFB8, 0x622A)
+DOUBLE_BYTE_PAIR(0xEFB9, 0x6298)
+DOUBLE_BYTE_PAIR(0xEFBA, 0x6D59)
+DOUBLE_BYTE_PAIR(0xEFBB, 0x7664)
+DOUBLE_BYTE_PAIR(0xEFBC, 0x7ACA)
+DOUBLE_BYTE_PAIR(0xEFBD, 0x7BC0)
+DOUBLE_BYTE_PAIR(0xEFBE, 0x7D76)
+DOUBLE_BYTE_PAIR(0xEFBF, 0x5360)
+DOUBLE_BYTE_PAIR(0xEFC0, 0x5CBE)
+DOUBLE_BYTE_PAIR(0xEFC1, 0x5E97)
+DOUBLE_BYTE_PAIR(0xEFC2, 0x6F38)
+DOUBLE_BYTE_PAIR(0xEFC3, 0x70B9)
+DOUBLE_BYTE_PAIR(0xEFC4, 0x7C98)
+DOUBLE_BYTE_PAIR(0xEFC5, 0x9711)
+DOUBLE_BYTE_PAIR(0xEFC6, 0x9B8E)
+DOUBLE_BYTE_PAIR(0xEFC7, 0x9EDE)
+DOUBLE_BYTE_PAIR(0xEFC8, 0x63A5)
+DOUBLE_BYTE_PAIR(0xEFC9, 0x647A)
+DOUBLE_BYTE_PAIR(0xEFCA, 0x8776)
+DOUBLE_BYTE_PAIR(0xEFCB, 0x4E01)
+DOUBLE_BYTE_PAIR(0xEFCC, 0x4E95)
+DOUBLE_BYTE_PAIR(0xEFCD, 0x4EAD)
+DOUBLE_BYTE_PAIR(0xEFCE, 0x505C)
+DOUBLE_BYTE_PAIR(0xEFCF, 0x5075)
+DOUBLE_BYTE_PAIR(0xEFD0, 0x5448)
+DOUBLE_BYTE_PAIR(0xEFD1, 0x59C3)
+DOUBLE_BYTE_PAIR(0xEFD2, 0x5B9A)
+DOUBLE_BYTE_PAIR(0xEFD3, 0x5E40)
+DOUBLE_BYTE_PAIR(0xEFD4, 0x5EAD)
+DOUBLE_BYTE_PAIR(0xEFD5, 0x5EF7)
+DOUBLE_BYTE_PAIR(0xEFD6, 0x5F81)
+DOUBLE_BYTE_PAIR(0xEFD7, 0x60C5)
+DOUBLE_BYTE_PAIR(0xEFD8, 0x633A)
+DOUBLE_BYTE_PAIR(0xEFD9, 0x653F)
+DOUBLE_BYTE_PAIR(0xEFDA, 0x6574)
+DOUBLE_BYTE_PAIR(0xEFDB, 0x65CC)
+DOUBLE_BYTE_PAIR(0xEFDC, 0x6676)
+DOUBLE_BYTE_PAIR(0xEFDD, 0x6678)
+DOUBLE_BYTE_PAIR(0xEFDE, 0x67FE)
+DOUBLE_BYTE_PAIR(0xEFDF, 0x6968)
+DOUBLE_BYTE_PAIR(0xEFE0, 0x6A89)
+DOUBLE_BYTE_PAIR(0xEFE1, 0x6B63)
+DOUBLE_BYTE_PAIR(0xEFE2, 0x6C40)
+DOUBLE_BYTE_PAIR(0xEFE3, 0x6DC0)
+DOUBLE_BYTE_PAIR(0xEFE4, 0x6DE8)
+DOUBLE_BYTE_PAIR(0xEFE5, 0x6E1F)
+DOUBLE_BYTE_PAIR(0xEFE6, 0x6E5E)
+DOUBLE_BYTE_PAIR(0xEFE7, 0x701E)
+DOUBLE_BYTE_PAIR(0xEFE8, 0x70A1)
+DOUBLE_BYTE_PAIR(0xEFE9, 0x738E)
+DOUBLE_BYTE_PAIR(0xEFEA, 0x73FD)
+DOUBLE_BYTE_PAIR(0xEFEB, 0x753A)
+DOUBLE_BYTE_PAIR(0xEFEC, 0x775B)
+DOUBLE_BYTE_PAIR(0xEFED, 0x7887)
+DOUBLE_BYTE_PAIR(0xEFEE, 0x798E)
+DOUBLE_BYTE_PAIR(0xEFEF, 0x7A0B)
+DOUBLE_BYTE_PAIR(0xEFF0, 0x7A7D)
+DOUBLE_BYTE_PAIR(0xEFF1, 0x7CBE)
+DOUBLE_BYTE_PAIR(0xEFF2, 0x7D8E)
+DOUBLE_BYTE_PAIR(0xEFF3, 0x8247)
+DOUBLE_BYTE_PAIR(0xEFF4, 0x8A02)
+DOUBLE_BYTE_PAIR(0xEFF5, 0x8AEA)
+DOUBLE_BYTE_PAIR(0xEFF6, 0x8C9E)
+DOUBLE_BYTE_PAIR(0xEFF7, 0x912D)
+DOUBLE_BYTE_PAIR(0xEFF8, 0x914A)
+DOUBLE_BYTE_PAIR(0xEFF9, 0x91D8)
+DOUBLE_BYTE_PAIR(0xEFFA, 0x9266)
+DOUBLE_BYTE_PAIR(0xEFFB, 0x92CC)
+DOUBLE_BYTE_PAIR(0xEFFC, 0x9320)
+DOUBLE_BYTE_PAIR(0xEFFD, 0x9706)
+DOUBLE_BYTE_PAIR(0xEFFE, 0x9756)
+DOUBLE_BYTE_PAIR(0xF0A1, 0x975C)
+DOUBLE_BYTE_PAIR(0xF0A2, 0x9802)
+DOUBLE_BYTE_PAIR(0xF0A3, 0x9F0E)
+DOUBLE_BYTE_PAIR(0xF0A4, 0x5236)
+DOUBLE_BYTE_PAIR(0xF0A5, 0x5291)
+DOUBLE_BYTE_PAIR(0xF0A6, 0x557C)
+DOUBLE_BYTE_PAIR(0xF0A7, 0x5824)
+DOUBLE_BYTE_PAIR(0xF0A8, 0x5E1D)
+DOUBLE_BYTE_PAIR(0xF0A9, 0x5F1F)
+DOUBLE_BYTE_PAIR(0xF0AA, 0x608C)
+DOUBLE_BYTE_PAIR(0xF0AB, 0x63D0)
+DOUBLE_BYTE_PAIR(0xF0AC, 0x68AF)
+DOUBLE_BYTE_PAIR(0xF0AD, 0x6FDF)
+DOUBLE_BYTE_PAIR(0xF0AE, 0x796D)
+DOUBLE_BYTE_PAIR(0xF0AF, 0x7B2C)
+DOUBLE_BYTE_PAIR(0xF0B0, 0x81CD)
+DOUBLE_BYTE_PAIR(0xF0B1, 0x85BA)
+DOUBLE_BYTE_PAIR(0xF0B2, 0x88FD)
+DOUBLE_BYTE_PAIR(0xF0B3, 0x8AF8)
+DOUBLE_BYTE_PAIR(0xF0B4, 0x8E44)
+DOUBLE_BYTE_PAIR(0xF0B5, 0x918D)
+DOUBLE_BYTE_PAIR(0xF0B6, 0x9664)
+DOUBLE_BYTE_PAIR(0xF0B7, 0x969B)
+DOUBLE_BYTE_PAIR(0xF0B8, 0x973D)
+DOUBLE_BYTE_PAIR(0xF0B9, 0x984C)
+DOUBLE_BYTE_PAIR(0xF0BA, 0x9F4A)
+DOUBLE_BYTE_PAIR(0xF0BB, 0x4FCE)
+DOUBLE_BYTE_PAIR(0xF0BC, 0x5146)
+DOUBLE_BYTE_PAIR(0xF0BD, 0x51CB)
+DOUBLE_BYTE_PAIR(0xF0BE, 0x52A9)
+DOUBLE_BYTE_PAIR(0xF0BF, 0x5632)
+DOUBLE_BYTE_PAIR(0xF0C0, 0x5F14)
+DOUBLE_BYTE_PAIR(0xF0C1, 0x5F6B)
+DOUBLE_BYTE_PAIR(0xF0C2, 0x63AA)
+DOUBLE_BYTE_PAIR(0xF0C3, 0x64CD)
+DOUBLE_BYTE_PAIR(0xF0C4, 0x65E9)
+DOUBLE_BYTE_PAIR(0xF0C5, 0x6641)
+DOUBLE_BYTE_PAIR(0xF0C6, 0x66FA)
+DOUBLE_BYTE_PAIR(0xF0C7, 0x66F9)
+DOUBLE_BYTE_PAIR(0xF0C8, 0x671D)
+DOUBLE_BYTE_PAIR(0xF0C9, 0x689D)
+DOUBLE_BYTE_PAIR(0xF0CA, 0x68D7)
+DOUBLE_BYTE_PAIR(0xF0CB, 0x69FD)
+DOUBLE_BYTE_PAIR(0xF0CC, 0x6F15)
+DOUBLE_BYTE_PAIR(0xF0CD, 0x6F6E)
+DOUBLE_BYTE_PAIR(0xF0CE, 0x7167)
+DOUBLE_BYTE_PAIR(0xF0CF, 0x71E5)
+DOUBLE_BYTE_PAIR(0xF0D0, 0x722A)
+DOUBLE_BYTE_PAIR(0xF0D1, 0x74AA)
+DOUBLE_BYTE_PAIR(0xF0D2, 0x773A)
+DOUBLE_BYTE_PAIR(0xF0D3, 0x7956)
+DOUBLE_BYTE_PAIR(0xF0D4, 0x795A)
+DOUBLE_BYTE_PAIR(0xF0D5, 0x79DF)
+DOUBLE_BYTE_PAIR(0xF0D6, 0x7A20)
+DOUBLE_BYTE_PAIR(0xF0D7, 0x7A95)
+DOUBLE_BYTE_PAIR(0xF0D8, 0x7C97)
+DOUBLE_BYTE_PAIR(0xF0D9, 0x7CDF)
+DOUBLE_BYTE_PAIR(0xF0DA, 0x7D44)
+DOUBLE_BYTE_PAIR(0xF0DB, 0x7E70)
+DOUBLE_BYTE_PAIR(0xF0DC, 0x8087)
+DOUBLE_BYTE_PAIR(0xF0DD, 0x85FB)
+DOUBLE_BYTE_PAIR(0xF0DE, 0x86A4)
+DOUBLE_BYTE_PAIR(0xF0DF, 0x8A54)
+DOUBLE_BYTE_PAIR(0xF0E0, 0x8ABF)
+DOUBLE_BYTE_PAIR(0xF0E1, 0x8D99)
+DOUBLE_BYTE_PAIR(0xF0E2, 0x8E81)
+DOUBLE_BYTE_PAIR(0xF0E3, 0x9020)
+DOUBLE_BYTE_PAIR(0xF0E4, 0x906D)
+DOUBLE_BYTE_PAIR(0xF0E5, 0x91E3)
+DOUBLE_BYTE_PAIR(0xF0E6, 0x963B)
+DOUBLE_BYTE_PAIR(0xF0E7, 0x96D5)
+DOUBLE_BYTE_PAIR(0xF0E8, 0x9CE5)
+DOUBLE_BYTE_PAIR(0xF0E9, 0x65CF)
+DOUBLE_BYTE_PAIR(0xF0EA, 0x7C07)
+DOUBLE_BYTE_PAIR(0xF0EB, 0x8DB3)
+DOUBLE_BYTE_PAIR(0xF0EC, 0x93C3)
+DOUBLE_BYTE_PAIR(0xF0ED, 0x5B58)
+DOUBLE_BYTE_PAIR(0xF0EE, 0x5C0A)
+DOUBLE_BYTE_PAIR(0xF0EF, 0x5352)
+DOUBLE_BYTE_PAIR(0xF0F0, 0x62D9)
+DOUBLE_BYTE_PAIR(0xF0F1, 0x731D)
+DOUBLE_BYTE_PAIR(0xF0F2, 0x5027)
+DOUBLE_BYTE_PAIR(0xF0F3, 0x5B97)
+DOUBLE_BYTE_PAIR(0xF0F4, 0x5F9E)
+DOUBLE_BYTE_PAIR(0xF0F5, 0x60B0)
+DOUBLE_BYTE_PAIR(0xF0F6, 0x616B)
+DOUBLE_BYTE_PAIR(0xF0F7, 0x68D5)
+DOUBLE_BYTE_PAIR(0xF0F8, 0x6DD9)
+DOUBLE_BYTE_PAIR(0xF0F9, 0x742E)
+DOUBLE_BYTE_PAIR(0xF0FA, 0x7A2E)
+DOUBLE_BYTE_PAIR(0xF0FB, 0x7D42)
+DOUBLE_BYTE_PAIR(0xF0FC, 0x7D9C)
+DOUBLE_BYTE_PAIR(0xF0FD, 0x7E31)
+DOUBLE_BYTE_PAIR(0xF0FE, 0x816B)
+DOUBLE_BYTE_PAIR(0xF1A1, 0x8E2A)
+DOUBLE_BYTE_PAIR(0xF1A2, 0x8E35)
+DOUBLE_BYTE_PAIR(0xF1A3, 0x937E)
+DOUBLE_BYTE_PAIR(0xF1A4, 0x9418)
+DOUBLE_BYTE_PAIR(0xF1A5, 0x4F50)
+DOUBLE_BYTE_PAIR(0xF1A6, 0x5750)
+DOUBLE_BYTE_PAIR(0xF1A7, 0x5DE6)
+DOUBLE_BYTE_PAIR(0xF1A8, 0x5EA7)
+DOUBLE_BYTE_PAIR(0xF1A9, 0x632B)
+DOUBLE_BYTE_PAIR(0xF1AA, 0x7F6A)
+DOUBLE_BYTE_PAIR(0xF1AB, 0x4E3B)
+DOUBLE_BYTE_PAIR(0xF1AC, 0x4F4F)
+DOUBLE_BYTE_PAIR(0xF1AD, 0x4F8F)
+DOUBLE_BYTE_PAIR(0xF1AE, 0x505A)
+DOUBLE_BYTE_PAIR(0xF1AF, 0x59DD)
+DOUBLE_BYTE_PAIR(0xF1B0, 0x80C4)
+DOUBLE_BYTE_PAIR(0xF1B1, 0x546A)
+DOUBLE_BYTE_PAIR(0xF1B2, 0x5468)
+DOUBLE_BYTE_PAIR(0xF1B3, 0x55FE)
+DOUBLE_BYTE_PAIR(0xF1B4, 0x594F)
+DOUBLE_BYTE_PAIR(0xF1B5, 0x5B99)
+DOUBLE_BYTE_PAIR(0xF1B6, 0x5DDE)
+DOUBLE_BYTE_PAIR(0xF1B7, 0x5EDA)
+DOUBLE_BYTE_PAIR(0xF1B8, 0x665D)
+DOUBLE_BYTE_PAIR(0xF1B9, 0x6731)
+DOUBLE_BYTE_PAIR(0xF1BA, 0x67F1)
+DOUBLE_BYTE_PAIR(0xF1BB, 0x682A)
+DOUBLE_BYTE_PAIR(0xF1BC, 0x6CE8)
+DOUBLE_BYTE_PAIR(0xF1BD, 0x6D32)
+DOUBLE_BYTE_PAIR(0xF1BE, 0x6E4A)
+DOUBLE_BYTE_PAIR(0xF1BF, 0x6F8D)
+DOUBLE_BYTE_PAIR(0xF1C0, 0x70B7)
+DOUBLE_BYTE_PAIR(0xF1C1, 0x73E0)
+DOUBLE_BYTE_PAIR(0xF1C2, 0x7587)
+DOUBLE_BYTE_PAIR(0xF1C3, 0x7C4C)
+DOUBLE_BYTE_PAIR(0xF1C4, 0x7D02)
+DOUBLE_BYTE_PAIR(0xF1C5, 0x7D2C)
+DOUBLE_BYTE_PAIR(0xF1C6, 0x7DA2)
+DOUBLE_BYTE_PAIR(0xF1C7, 0x821F)
+DOUBLE_BYTE_PAIR(0xF1C8, 0x86DB)
+DOUBLE_BYTE_PAIR(0xF1C9, 0x8A3B)
+DOUBLE_BYTE_PAIR(0xF1CA, 0x8A85)
+DOUBLE_BYTE_PAIR(0xF1CB, 0x8D70)
+DOUBLE_BYTE_PAIR(0xF1CC, 0x8E8A)
+DOUBLE_BYTE_PAIR(0xF1CD, 0x8F33)
+DOUBLE_BYTE_PAIR(0xF1CE, 0x9031)
+DOUBLE_BYTE_PAIR(0xF1CF, 0x914E)
+DOUBLE_BYTE_PAIR(0xF1D0, 0x9152)
+DOUBLE_BYTE_PAIR(0xF1D1, 0x9444)
+DOUBLE_BYTE_PAIR(0xF1D2, 0x99D0)
+DOUBLE_BYTE_PAIR(0xF1D3, 0x7AF9)
+DOUBLE_BYTE_PAIR(0xF1D4, 0x7CA5)
+DOUBLE_BYTE_PAIR(0xF1D5, 0x4FCA)
+DOUBLE_BYTE_PAIR(0xF1D6, 0x5101)
+DOUBLE_BYTE_PAIR(0xF1D7, 0x51C6)
+DOUBLE_BYTE_PAIR(0xF1D8, 0x57C8)
+DOUBLE_BYTE_PAIR(0xF1D9, 0x5BEF)
+DOUBLE_BYTE_PAIR(0xF1DA, 0x5CFB)
+DOUBLE_BYTE_PAIR(0xF1DB, 0x6659)
+DOUBLE_BYTE_PAIR(0xF1DC, 0x6A3D)
+DOUBLE_BYTE_PAIR(0xF1DD, 0x6D5A)
+DOUBLE_BYTE_PAIR(0xF1DE, 0x6E96)
+DOUBLE_BYTE_PAIR(0xF1DF, 0x6FEC)
+DOUBLE_BYTE_PAIR(0xF1E0, 0x710C)
+DOUBLE_BYTE_PAIR(0xF1E1, 0x756F)
+DOUBLE_BYTE_PAIR(0xF1E2, 0x7AE3)
+DOUBLE_BYTE_PAIR(0xF1E3, 0x8822)
+DOUBLE_BYTE_PAIR(0xF1E4, 0x9021)
+DOUBLE_BYTE_PAIR(0xF1E5, 0x9075)
+DOUBLE_BYTE_PAIR(0xF1E6, 0x96CB)
+DOUBLE_BYTE_PAIR(0xF1E7, 0x99FF)
+DOUBLE_BYTE_PAIR(0xF1E8, 0x8301)
+DOUBLE_BYTE_PAIR(0xF1E9, 0x4E2D)
+DOUBLE_BYTE_PAIR(0xF1EA, 0x4EF2)
+DOUBLE_BYTE_PAIR(0xF1EB, 0x8846)
+DOUBLE_BYTE_PAIR(0xF1EC, 0x91CD)
+DOUBLE_BYTE_PAIR(0xF1ED, 0x537D)
+DOUBLE_BYTE_PAIR(0xF1EE, 0x6ADB)
+DOUBLE_BYTE_PAIR(0xF1EF, 0x696B)
+DOUBLE_BYTE_PAIR(0xF1F0, 0x6C41)
+DOUBLE_BYTE_PAIR(0xF1F1, 0x847A)
+DOUBLE_BYTE_PAIR(0xF1F2, 0x589E)
+DOUBLE_BYTE_PAIR(0xF1F3, 0x618E)
+DOUBLE_BYTE_PAIR(0xF1F4, 0x66FE)
+DOUBLE_BYTE_PAIR(0xF1F5, 0x62EF)
+DOUBLE_BYTE_PAIR(0xF1F6, 0x70DD)
+DOUBLE_BYTE_PAIR(0xF1F7, 0x7511)
+DOUBLE_BYTE_PAIR(0xF1F8, 0x75C7)
+DOUBLE_BYTE_PAIR(0xF1F9, 0x7E52)
+DOUBLE_BYTE_PAIR(0xF1FA, 0x84B8)
+DOUBLE_BYTE_PAIR(0xF1FB, 0x8B49)
+DOUBLE_BYTE_PAIR(0xF1FC, 0x8D08)
+DOUBLE_BYTE_PAIR(0xF1FD, 0x4E4B)
+DOUBLE_BYTE_PAIR(0xF1FE, 0x53EA)
+DOUBLE_BYTE_PAIR(0xF2A1, 0x54AB)
+DOUBLE_BYTE_PAIR(0xF2A2, 0x5730)
+DOUBLE_BYTE_PAIR(0xF2A3, 0x5740)
+DOUBLE_BYTE_PAIR(0xF2A4, 0x5FD7)
+DOUBLE_BYTE_PAIR(0xF2A5, 0x6301)
+DOUBLE_BYTE_PAIR(0xF2A6, 0x6307)
+DOUBLE_BYTE_PAIR(0xF2A7, 0x646F)
+DOUBLE_BYTE_PAIR(0xF2A8, 0x652F)
+DOUBLE_BYTE_PAIR(0xF2A9, 0x65E8)
+DOUBLE_BYTE_PAIR(0xF2AA, 0x667A)
+DOUBLE_BYTE_PAIR(0xF2AB, 0x679D)
+DOUBLE_BYTE_PAIR(0xF2AC, 0x67B3)
+DOUBLE_BYTE_PAIR(0xF2AD, 0x6B62)
+DOUBLE_BYTE_PAIR(0xF2AE, 0x6C60)
+DOUBLE_BYTE_PAIR(0xF2AF, 0x6C9A)
+DOUBLE_BYTE_PAIR(0xF2B0, 0x6F2C)
+DOUBLE_BYTE_PAIR(0xF2B1, 0x77E5)
+DOUBLE_BYTE_PAIR(0xF2B2, 0x7825)
+DOUBLE_BYTE_PAIR(0xF2B3, 0x7949)
+DOUBLE_BYTE_PAIR(0xF2B4, 0x7957)
+DOUBLE_BYTE_PAIR(0xF2B5, 0x7D19)
+DOUBLE_BYTE_PAIR(0xF2B6, 0x80A2)
+DOUBLE_BYTE_PAIR(0xF2B7, 0x8102)
+DOUBLE_BYTE_PAIR(0xF2B8, 0x81F3)
+DOUBLE_BYTE_PAIR(0xF2B9, 0x829D)
+DOUBLE_BYTE_PAIR(0xF2BA, 0x82B7)
+DOUBLE_BYTE_PAIR(0xF2BB, 0x8718)
+DOUBLE_BYTE_PAIR(0xF2BC, 0x8A8C)
+DOUBLE_BYTE_PAIR(0xF2BD, 0xF9FC)
+DOUBLE_BYTE_PAIR(0xF2BE, 0x8D04)
+DOUBLE_BYTE_PAIR(0xF2BF, 0x8DBE)
+DOUBLE_BYTE_PAIR(0xF2C0, 0x9072)
+DOUBLE_BYTE_PAIR(0xF2C1, 0x76F4)
+DOUBLE_BYTE_PAIR(0xF2C2, 0x7A19)
+DOUBLE_BYTE_PAIR(0xF2C3, 0x7A37)
+DOUBLE_BYTE_PAIR(0xF2C4, 0x7E54)
+DOUBLE_BYTE_PAIR(0xF2C5, 0x8077)
+DOUBLE_BYTE_PAIR(0xF2C6, 0x5507)
+DOUBLE_BYTE_PAIR(0xF2C7, 0x55D4)
+DOUBLE_BYTE_PAIR(0xF2C8, 0x5875)
+DOUBLE_BYTE_PAIR(0xF2C9, 0x632F)
+DOUBLE_BYTE_PAIR(0xF2CA, 0x6422)
+DOUBLE_BYTE_PAIR(0xF2CB, 0x6649)
+DOUBLE_BYTE_PAIR(0xF2CC, 0x664B)
+DOUBLE_BYTE_PAIR(0xF2CD, 0x686D)
+DOUBLE_BYTE_PAIR(0xF2CE, 0x699B)
+DOUBLE_BYTE_PAIR(0xF2CF, 0x6B84)
+DOUBLE_BYTE_PAIR(0xF2D0, 0x6D25)
+DOUBLE_BYTE_PAIR(0xF2D1, 0x6EB1)
+DOUBLE_BYTE_PAIR(0xF2D2, 0x73CD)
+DOUBLE_BYTE_PAIR(0xF2D3, 0x7468)
+DOUBLE_BYTE_PAIR(0xF2D4, 0x74A1)
+DOUBLE_BYTE_PAIR(0xF2D5, 0x755B)
+DOUBLE_BYTE_PAIR(0xF2D6, 0x75B9)
+DOUBLE_BYTE_PAIR(0xF2D7, 0x76E1)
+DOUBLE_BYTE_PAIR(0xF2D8, 0x771E)
+DOUBLE_BYTE_PAIR(0xF2D9, 0x778B)
+DOUBLE_BYTE_PAIR(0xF2DA, 0x79E6)
+DOUBLE_BYTE_PAIR(0xF2DB, 0x7E09)
+DOUBLE_BYTE_PAIR(0xF2DC, 0x7E1D)
+DOUBLE_BYTE_PAIR(0xF2DD, 0x81FB)
+DOUBLE_BYTE_PAIR(0xF2DE, 0x852F)
+DOUBLE_BYTE_PAIR(0xF2DF, 0x8897)
+DOUBLE_BYTE_PAIR(0xF2E0, 0x8A3A)
+DOUBLE_BYTE_PAIR(0xF2E1, 0x8CD1)
+DOUBLE_BYTE_PAIR(0xF2E2, 0x8EEB)
+DOUBLE_BYTE_PAIR(0xF2E3, 0x8FB0)
+DOUBLE_BYTE_PAIR(0xF2E4, 0x9032)
+DOUBLE_BYTE_PAIR(0xF2E5, 0x93AD)
+DOUBLE_BYTE_PAIR(0xF2E6, 0x9663)
+DOUBLE_BYTE_PAIR(0xF2E7, 0x9673)
+DOUBLE_BYTE_PAIR(0xF2E8, 0x9707)
+DOUBLE_BYTE_PAIR(0xF2E9, 0x4F84)
+DOUBLE_BYTE_PAIR(0xF2EA, 0x53F1)
+DOUBLE_BYTE_PAIR(0xF2EB, 0x59EA)
+DOUBLE_BYTE_PAIR(0xF2EC, 0x5AC9)
+DOUBLE_BYTE_PAIR(0xF2ED, 0x5E19)
+DOUBLE_BYTE_PAIR(0xF2EE, 0x684E)
+DOUBLE_BYTE_PAIR(0xF2EF, 0x74C6)
+DOUBLE_BYTE_PAIR(0xF2F0, 0x75BE)
+DOUBLE_BYTE_PAIR(0xF2F1, 0x79E9)
+DOUBLE_BYTE_PAIR(0xF2F2, 0x7A92)
+DOUBLE_BYTE_PAIR(0xF2F3, 0x81A3)
+DOUBLE_BYTE_PAIR(0xF2F4, 0x86ED)
+DOUBLE_BYTE_PAIR(0xF2F5, 0x8CEA)
+DOUBLE_BYTE_PAIR(0xF2F6, 0x8DCC)
+DOUBLE_BYTE_PAIR(0xF2F7, 0x8FED)
+DOUBLE_BYTE_PAIR(0xF2F8, 0x659F)
+DOUBLE_BYTE_PAIR(0xF2F9, 0x6715)
+DOUBLE_BYTE_PAIR(0xF2FA, 0xF9FD)
+DOUBLE_BYTE_PAIR(0xF2FB, 0x57F7)
+DOUBLE_BYTE_PAIR(0xF2FC, 0x6F57)
+DOUBLE_BYTE_PAIR(0xF2FD, 0x7DDD)
+DOUBLE_BYTE_PAIR(0xF2FE, 0x8F2F)
+DOUBLE_BYTE_PAIR(0xF3A1, 0x93F6)
+DOUBLE_BYTE_PAIR(0xF3A2, 0x96C6)
+DOUBLE_BYTE_PAIR(0xF3A3, 0x5FB5)
+DOUBLE_BYTE_PAIR(0xF3A4, 0x61F2)
+DOUBLE_BYTE_PAIR(0xF3A5, 0x6F84)
+DOUBLE_BYTE_PAIR(0xF3A6, 0x4E14)
+DOUBLE_BYTE_PAIR(0xF3A7, 0x4F98)
+DOUBLE_BYTE_PAIR(0xF3A8, 0x501F)
+DOUBLE_BYTE_PAIR(0xF3A9, 0x53C9)
+DOUBLE_BYTE_PAIR(0xF3AA, 0x55DF)
+DOUBLE_BYTE_PAIR(0xF3AB, 0x5D6F)
+DOUBLE_BYTE_PAIR(0xF3AC, 0x5DEE)
+DOUBLE_BYTE_PAIR(0xF3AD, 0x6B21)
+DOUBLE_BYTE_PAIR(0xF3AE, 0x6B64)
+DOUBLE_BYTE_PAIR(0xF3AF, 0x78CB)
+DOUBLE_BYTE_PAIR(0xF3B0, 0x7B9A)
+DOUBLE_BYTE_PAIR(0xF3B1, 0xF9FE)
+DOUBLE_BYTE_PAIR(0xF3B2, 0x8E49)
+DOUBLE_BYTE_PAIR(0xF3B3, 0x8ECA)
+DOUBLE_BYTE_PAIR(0xF3B4, 0x906E)
+DOUBLE_BYTE_PAIR(0xF3B5, 0x6349)
+DOUBLE_BYTE_PAIR(0xF3B6, 0x643E)
+DOUBLE_BYTE_PAIR(0xF3B7, 0x7740)
+DOUBLE_BYTE_PAIR(0xF3B8, 0x7A84)
+DOUBLE_BYTE_PAIR(0xF3B9, 0x932F)
+DOUBLE_BYTE_PAIR(0xF3BA, 0x947F)
+DOUBLE_BYTE_PAIR(0xF3BB, 0x9F6A)
+DOUBLE_BYTE_PAIR(0xF3BC, 0x64B0)
+DOUBLE_BYTE_PAIR(0xF3BD, 0x6FAF)
+DOUBLE_BYTE_PAIR(0xF3BE, 0x71E6)
+DOUBLE_BYTE_PAIR(0xF3BF, 0x74A8)
+DOUBLE_BYTE_PAIR(0xF3C0, 0x74DA)
+DOUBLE_BYTE_PAIR(0xF3C1, 0x7AC4)
+DOUBLE_BYTE_PAIR(0xF3C2, 0x7C12)
+DOUBLE_BYTE_PAIR(0xF3C3, 0x7E82)
+DOUBLE_BYTE_PAIR(0xF3C4, 0x7CB2)
+DOUBLE_BYTE_PAIR(0xF3C5, 0x7E98)
+DOUBLE_BYTE_PAIR(0xF3C6, 0x8B9A)
+DOUBLE_BYTE_PAIR(0xF3C7, 0x8D0A)
+DOUBLE_BYTE_PAIR(0xF3C8, 0x947D)
+DOUBLE_BYTE_PAIR(0xF3C9, 0x9910)
+DOUBLE_BYTE_PAIR(0xF3CA, 0x994C)
+DOUBLE_BYTE_PAIR(0xF3CB, 0x5239)
+DOUBLE_BYTE_PAIR(0xF3CC, 0x5BDF)
+DOUBLE_BYTE_PAIR(0xF3CD, 0x64E6)
+DOUBLE_BYTE_PAIR(0xF3CE, 0x672D)
+DOUBLE_BYTE_PAIR(0xF3CF, 0x7D2E)
+DOUBLE_BYTE_PAIR(0xF3D0, 0x50ED)
+DOUBLE_BYTE_PAIR(0xF3D1, 0x53C3)
+DOUBLE_BYTE_PAIR(0xF3D2, 0x5879)
+DOUBLE_BYTE_PAIR(0xF3D3, 0x6158)
+DOUBLE_BYTE_PAIR(0xF3D4, 0x6159)
+DOUBLE_BYTE_PAIR(0xF3D5, 0x61FA)
+DOUBLE_BYTE_PAIR(0xF3D6, 0x65AC)
+DOUBLE_BYTE_PAIR(0xF3D7, 0x7AD9)
+DOUBLE_BYTE_PAIR(0xF3D8, 0x8B92)
+DOUBLE_BYTE_PAIR(0xF3D9, 0x8B96)
+DOUBLE_BYTE_PAIR(0xF3DA, 0x5009)
+DOUBLE_BYTE_PAIR(0xF3DB, 0x5021)
+DOUBLE_BYTE_PAIR(0xF3DC, 0x5275)
+DOUBLE_BYTE_PAIR(0xF3DD, 0x5531)
+DOUBLE_BYTE_PAIR(0xF3DE, 0x5A3C)
+DOUBLE_BYTE_PAIR(0xF3DF, 0x5EE0)
+DOUBLE_BYTE_PAIR(0xF3E0, 0x5F70)
+DOUBLE_BYTE_PAIR(0xF3E1, 0x6134)
+DOUBLE_BYTE_PAIR(0xF3E2, 0x655E)
+DOUBLE_BYTE_PAIR(0xF3E3, 0x660C)
+DOUBLE_BYTE_PAIR(0xF3E4, 0x6636)
+DOUBLE_BYTE_PAIR(0xF3E5, 0x66A2)
+DOUBLE_BYTE_PAIR(0xF3E6, 0x69CD)
+DOUBLE_BYTE_PAIR(0xF3E7, 0x6EC4)
+DOUBLE_BYTE_PAIR(0xF3E8, 0x6F32)
+DOUBLE_BYTE_PAIR(0xF3E9, 0x7316)
+DOUBLE_BYTE_PAIR(0xF3EA, 0x7621)
+DOUBLE_BYTE_PAIR(0xF3EB, 0x7A93)
+DOUBLE_BYTE_PAIR(0xF3EC, 0x8139)
+DOUBLE_BYTE_PAIR(0xF3ED, 0x8259)
+DOUBLE_BYTE_PAIR(0xF3EE, 0x83D6)
+DOUBLE_BYTE_PAIR(0xF3EF, 0x84BC)
+DOUBLE_BYTE_PAIR(0xF3F0, 0x50B5)
+DOUBLE_BYTE_PAIR(0xF3F1, 0x57F0)
+DOUBLE_BYTE_PAIR(0xF3F2, 0x5BC0)
+DOUBLE_BYTE_PAIR(0xF3F3, 0x5BE8)
+DOUBLE_BYTE_PAIR(0xF3F4, 0x5F69)
+DOUBLE_BYTE_PAIR(0xF3F5, 0x63A1)
+DOUBLE_BYTE_PAIR(0xF3F6, 0x7826)
+DOUBLE_BYTE_PAIR(0xF3F7, 0x7DB5)
+DOUBLE_BYTE_PAIR(0xF3F8, 0x83DC)
+DOUBLE_BYTE_PAIR(0xF3F9, 0x8521)
+DOUBLE_BYTE_PAIR(0xF3FA, 0x91C7)
+DOUBLE_BYTE_PAIR(0xF3FB, 0x91F5)
+DOUBLE_BYTE_PAIR(0xF3FC, 0x518A)
+DOUBLE_BYTE_PAIR(0xF3FD, 0x67F5)
+DOUBLE_BYTE_PAIR(0xF3FE, 0x7B56)
+DOUBLE_BYTE_PAIR(0xF4A1, 0x8CAC)
+DOUBLE_BYTE_PAIR(0xF4A2, 0x51C4)
+DOUBLE_BYTE_PAIR(0xF4A3, 0x59BB)
+DOUBLE_BYTE_PAIR(0xF4A4, 0x60BD)
+DOUBLE_BYTE_PAIR(0xF4A5, 0x8655)
+DOUBLE_BYTE_PAIR(0xF4A6, 0x501C)
+DOUBLE_BYTE_PAIR(0xF4A7, 0xF9FF)
+DOUBLE_BYTE_PAIR(0xF4A8, 0x5254)
+DOUBLE_BYTE_PAIR(0xF4A9, 0x5C3A)
+DOUBLE_BYTE_PAIR(0xF4AA, 0x617D)
+DOUBLE_BYTE_PAIR(0xF4AB, 0x621A)
+DOUBLE_BYTE_PAIR(0xF4AC, 0x62D3)
+DOUBLE_BYTE_PAIR(0xF4AD, 0x64F2)
+DOUBLE_BYTE_PAIR(0xF4AE, 0x65A5)
+DOUBLE_BYTE_PAIR(0xF4AF, 0x6ECC)
+DOUBLE_BYTE_PAIR(0xF4B0, 0x7620)
+DOUBLE_BYTE_PAIR(0xF4B1, 0x810A)
+DOUBLE_BYTE_PAIR(0xF4B2, 0x8E60)
+DOUBLE_BYTE_PAIR(0xF4B3, 0x965F)
+DOUBLE_BYTE_PAIR(0xF4B4, 0x96BB)
+DOUBLE_BYTE_PAIR(0xF4B5, 0x4EDF)
+DOUBLE_BYTE_PAIR(0xF4B6, 0x5343)
+DOUBLE_BYTE_PAIR(0xF4B7, 0x5598)
+DOUBLE_BYTE_PAIR(0xF4B8, 0x5929)
+DOUBLE_BYTE_PAIR(0xF4B9, 0x5DDD)
+DOUBLE_BYTE_PAIR(0xF4BA, 0x64C5)
+DOUBLE_BYTE_PAIR(0xF4BB, 0x6CC9)
+DOUBLE_BYTE_PAIR(0xF4BC, 0x6DFA)
+DOUBLE_BYTE_PAIR(0xF4BD, 0x7394)
+DOUBLE_BYTE_PAIR(0xF4BE, 0x7A7F)
+DOUBLE_BYTE_PAIR(0xF4BF, 0x821B)
+DOUBLE_BYTE_PAIR(0xF4C0, 0x85A6)
+DOUBLE_BYTE_PAIR(0xF4C1, 0x8CE4)
+DOUBLE_BYTE_PAIR(0xF4C2, 0x8E10)
+DOUBLE_BYTE_PAIR(0xF4C3, 0x9077)
+DOUBLE_BYTE_PAIR(0xF4C4, 0x91E7)
+DOUBLE_BYTE_PAIR(0xF4C5, 0x95E1)
+DOUBLE_BYTE_PAIR(0xF4C6, 0x9621)
+DOUBLE_BYTE_PAIR(0xF4C7, 0x97C6)
+DOUBLE_BYTE_PAIR(0xF4C8, 0x51F8)
+DOUBLE_BYTE_PAIR(0xF4C9, 0x54F2)
+DOUBLE_BYTE_PAIR(0xF4CA, 0x5586)
+DOUBLE_BYTE_PAIR(0xF4CB, 0x5FB9)
+DOUBLE_BYTE_PAIR(0xF4CC, 0x64A4)
+DOUBLE_BYTE_PAIR(0xF4CD, 0x6F88)
+DOUBLE_BYTE_PAIR(0xF4CE, 0x7DB4)
+DOUBLE_BYTE_PAIR(0xF4CF, 0x8F1F)
+DOUBLE_BYTE_PAIR(0xF4D0, 0x8F4D)
+DOUBLE_BYTE_PAIR(0xF4D1, 0x9435)
+DOUBLE_BYTE_PAIR(0xF4D2, 0x50C9)
+DOUBLE_BYTE_PAIR(0xF4D3, 0x5C16)
+DOUBLE_BYTE_PAIR(0xF4D4, 0x6CBE)
+DOUBLE_BYTE_PAIR(0xF4D5, 0x6DFB)
+DOUBLE_BYTE_PAIR(0xF4D6, 0x751B)
+DOUBLE_BYTE_PAIR(0xF4D7, 0x77BB)
+DOUBLE_BYTE_PAIR(0xF4D8, 0x7C3D)
+DOUBLE_BYTE_PAIR(0xF4D9, 0x7C64)
+DOUBLE_BYTE_PAIR(0xF4DA, 0x8A79)
+DOUBLE_BYTE_PAIR(0xF4DB, 0x8AC2)
+DOUBLE_BYTE_PAIR(0xF4DC, 0x581E)
+DOUBLE_BYTE_PAIR(0xF4DD, 0x59BE)
+DOUBLE_BYTE_PAIR(0xF4DE, 0x5E16)
+DOUBLE_BYTE_PAIR(0xF4DF, 0x6377)
+DOUBLE_BYTE_PAIR(0xF4E0, 0x7252)
+DOUBLE_BYTE_PAIR(0xF4E1, 0x758A)
+DOUBLE_BYTE_PAIR(0xF4E2, 0x776B)
+DOUBLE_BYTE_PAIR(0xF4E3, 0x8ADC)
+DOUBLE_BYTE_PAIR(0xF4E4, 0x8CBC)
+DOUBLE_BYTE_PAIR(0xF4E5, 0x8F12)
+DOUBLE_BYTE_PAIR(0xF4E6, 0x5EF3)
+DOUBLE_BYTE_PAIR(0xF4E7, 0x6674)
+DOUBLE_BYTE_PAIR(0xF4E8, 0x6DF8)
+DOUBLE_BYTE_PAIR(0xF4E9, 0x807D)
+DOUBLE_BYTE_PAIR(0xF4EA, 0x83C1)
+DOUBLE_BYTE_PAIR(0xF4EB, 0x8ACB)
+DOUBLE_BYTE_PAIR(0xF4EC, 0x9751)
+DOUBLE_BYTE_PAIR(0xF4ED, 0x9BD6)
+DOUBLE_BYTE_PAIR(0xF4EE, 0xFA00)
+DOUBLE_BYTE_PAIR(0xF4EF, 0x5243)
+DOUBLE_BYTE_PAIR(0xF4F0, 0x66FF)
+DOUBLE_BYTE_PAIR(0xF4F1, 0x6D95)
+DOUBLE_BYTE_PAIR(0xF4F2, 0x6EEF)
+DOUBLE_BYTE_PAIR(0xF4F3, 0x7DE0)
+DOUBLE_BYTE_PAIR(0xF4F4, 0x8AE6)
+DOUBLE_BYTE_PAIR(0xF4F5, 0x902E)
+DOUBLE_BYTE_PAIR(0xF4F6, 0x905E)
+DOUBLE_BYTE_PAIR(0xF4F7, 0x9AD4)
+DOUBLE_BYTE_PAIR(0xF4F8, 0x521D)
+DOUBLE_BYTE_PAIR(0xF4F9, 0x527F)
+DOUBLE_BYTE_PAIR(0xF4FA, 0x54E8)
+DOUBLE_BYTE_PAIR(0xF4FB, 0x6194)
+DOUBLE_BYTE_PAIR(0xF4FC, 0x6284)
+DOUBLE_BYTE_PAIR(0xF4FD, 0x62DB)
+DOUBLE_BYTE_PAIR(0xF4FE, 0x68A2)
+DOUBLE_BYTE_PAIR(0xF5A1, 0x6912)
+DOUBLE_BYTE_PAIR(0xF5A2, 0x695A)
+DOUBLE_BYTE_PAIR(0xF5A3, 0x6A35)
+DOUBLE_BYTE_PAIR(0xF5A4, 0x7092)
+DOUBLE_BYTE_PAIR(0xF5A5, 0x7126)
+DOUBLE_BYTE_PAIR(0xF5A6, 0x785D)
+DOUBLE_BYTE_PAIR(0xF5A7, 0x7901)
+DOUBLE_BYTE_PAIR(0xF5A8, 0x790E)
+DOUBLE_BYTE_PAIR(0xF5A9, 0x79D2)
+DOUBLE_BYTE_PAIR(0xF5AA, 0x7A0D)
+DOUBLE_BYTE_PAIR(0xF5AB, 0x8096)
+DOUBLE_BYTE_PAIR(0xF5AC, 0x8278)
+DOUBLE_BYTE_PAIR(0xF5AD, 0x82D5)
+DOUBLE_BYTE_PAIR(0xF5AE, 0x8349)
+DOUBLE_BYTE_PAIR(0xF5AF, 0x8549)
+DOUBLE_BYTE_PAIR(0xF5B0, 0x8C82)
+DOUBLE_BYTE_PAIR(0xF5B1, 0x8D85)
+DOUBLE_BYTE_PAIR(0xF5B2, 0x9162)
+DOUBLE_BYTE_PAIR(0xF5B3, 0x918B)
+DOUBLE_BYTE_PAIR(0xF5B4, 0x91AE)
+DOUBLE_BYTE_PAIR(0xF5B5, 0x4FC3)
+DOUBLE_BYTE_PAIR(0xF5B6, 0x56D1)
+DOUBLE_BYTE_PAIR(0xF5B7, 0x71ED)
+DOUBLE_BYTE_PAIR(0xF5B8, 0x77D7)
+DOUBLE_BYTE_PAIR(0xF5B9, 0x8700)
+DOUBLE_BYTE_PAIR(0xF5BA, 0x89F8)
+DOUBLE_BYTE_PAIR(0xF5BB, 0x5BF8)
+DOUBLE_BYTE_PAIR(0xF5BC, 0x5FD6)
+DOUBLE_BYTE_PAIR(0xF5BD, 0x6751)
+DOUBLE_BYTE_PAIR(0xF5BE, 0x90A8)
+DOUBLE_BYTE_PAIR(0xF5BF, 0x53E2)
+DOUBLE_BYTE_PAIR(0xF5C0, 0x585A)
+DOUBLE_BYTE_PAIR(0xF5C1, 0x5BF5)
+DOUBLE_BYTE_PAIR(0xF5C2, 0x60A4)
+DOUBLE_BYTE_PAIR(0xF5C3, 0x6181)
+DOUBLE_BYTE_PAIR(0xF5C4, 0x6460)
+DOUBLE_BYTE_PAIR(0xF5C5, 0x7E3D)
+DOUBLE_BYTE_PAIR(0xF5C6, 0x8070)
+DOUBLE_BYTE_PAIR(0xF5C7, 0x8525)
+DOUBLE_BYTE_PAIR(0xF5C8, 0x9283)
+DOUBLE_BYTE_PAIR(0xF5C9, 0x64AE)
+DOUBLE_BYTE_PAIR(0xF5CA, 0x50AC)
+DOUBLE_BYTE_PAIR(0xF5CB, 0x5D14)
+DOUBLE_BYTE_PAIR(0xF5CC, 0x6700)
+DOUBLE_BYTE_PAIR(0xF5CD, 0x589C)
+DOUBLE_BYTE_PAIR(0xF5CE, 0x62BD)
+DOUBLE_BYTE_PAIR(0xF5CF, 0x63A8)
+DOUBLE_BYTE_PAIR(0xF5D0, 0x690E)
+DOUBLE_BYTE_PAIR(0xF5D1, 0x6978)
+DOUBLE_BYTE_PAIR(0xF5D2, 0x6A1E)
+DOUBLE_BYTE_PAIR(0xF5D3, 0x6E6B)
+DOUBLE_BYTE_PAIR(0xF5D4, 0x76BA)
+DOUBLE_BYTE_PAIR(0xF5D5, 0x79CB)
+DOUBLE_BYTE_PAIR(0xF5D6, 0x82BB)
+DOUBLE_BYTE_PAIR(0xF5D7, 0x8429)
+DOUBLE_BYTE_PAIR(0xF5D8, 0x8ACF)
+DOUBLE_BYTE_PAIR(0xF5D9, 0x8DA8)
+DOUBLE_BYTE_PAIR(0xF5DA, 0x8FFD)
+DOUBLE_BYTE_PAIR(0xF5DB, 0x9112)
+DOUBLE_BYTE_PAIR(0xF5DC, 0x914B)
+DOUBLE_BYTE_PAIR(0xF5DD, 0x919C)
+DOUBLE_BYTE_PAIR(0xF5DE, 0x9310)
+DOUBLE_BYTE_PAIR(0xF5DF, 0x9318)
+DOUBLE_BYTE_PAIR(0xF5E0, 0x939A)
+DOUBLE_BYTE_PAIR(0xF5E1, 0x96DB)
+DOUBLE_BYTE_PAIR(0xF5E2, 0x9A36)
+DOUBLE_BYTE_PAIR(0xF5E3, 0x9C0D)
+DOUBLE_BYTE_PAIR(0xF5E4, 0x4E11)
+DOUBLE_BYTE_PAIR(0xF5E5, 0x755C)
+DOUBLE_BYTE_PAIR(0xF5E6, 0x795D)
+DOUBLE_BYTE_PAIR(0xF5E7, 0x7AFA)
+DOUBLE_BYTE_PAIR(0xF5E8, 0x7B51)
+DOUBLE_BYTE_PAIR(0xF5E9, 0x7BC9)
+DOUBLE_BYTE_PAIR(0xF5EA, 0x7E2E)
+DOUBLE_BYTE_PAIR(0xF5EB, 0x84C4)
+DOUBLE_BYTE_PAIR(0xF5EC, 0x8E59)
+DOUBLE_BYTE_PAIR(0xF5ED, 0x8E74)
+DOUBLE_BYTE_PAIR(0xF5EE, 0x8EF8)
+DOUBLE_BYTE_PAIR(0xF5EF, 0x9010)
+DOUBLE_BYTE_PAIR(0xF5F0, 0x6625)
+DOUBLE_BYTE_PAIR(0xF5F1, 0x693F)
+DOUBLE_BYTE_PAIR(0xF5F2, 0x7443)
+DOUBLE_BYTE_PAIR(0xF5F3, 0x51FA)
+DOUBLE_BYTE_PAIR(0xF5F4, 0x672E)
+DOUBLE_BYTE_PAIR(0xF5F5, 0x9EDC)
+DOUBLE_BYTE_PAIR(0xF5F6, 0x5145)
+DOUBLE_BYTE_PAIR(0xF5F7, 0x5FE0)
+DOUBLE_BYTE_PAIR(0xF5F8, 0x6C96)
+DOUBLE_BYTE_PAIR(0xF5F9, 0x87F2)
+DOUBLE_BYTE_PAIR(0xF5FA, 0x885D)
+DOUBLE_BYTE_PAIR(0xF5FB, 0x8877)
+DOUBLE_BYTE_PAIR(0xF5FC, 0x60B4)
+DOUBLE_BYTE_PAIR(0xF5FD, 0x81B5)
+DOUBLE_BYTE_PAIR(0xF5FE, 0x8403)
+DOUBLE_BYTE_PAIR(0xF6A1, 0x8D05)
+DOUBLE_BYTE_PAIR(0xF6A2, 0x53D6)
+DOUBLE_BYTE_PAIR(0xF6A3, 0x5439)
+DOUBLE_BYTE_PAIR(0xF6A4, 0x5634)
+DOUBLE_BYTE_PAIR(0xF6A5, 0x5A36)
+DOUBLE_BYTE_PAIR(0xF6A6, 0x5C31)
+DOUBLE_BYTE_PAIR(0xF6A7, 0x708A)
+DOUBLE_BYTE_PAIR(0xF6A8, 0x7FE0)
+DOUBLE_BYTE_PAIR(0xF6A9, 0x805A)
+DOUBLE_BYTE_PAIR(0xF6AA, 0x8106)
+DOUBLE_BYTE_PAIR(0xF6AB, 0x81ED)
+DOUBLE_BYTE_PAIR(0xF6AC, 0x8DA3)
+DOUBLE_BYTE_PAIR(0xF6AD, 0x9189)
+DOUBLE_BYTE_PAIR(0xF6AE, 0x9A5F)
+DOUBLE_BYTE_PAIR(0xF6AF, 0x9DF2)
+DOUBLE_BYTE_PAIR(0xF6B0, 0x5074)
+DOUBLE_BYTE_PAIR(0xF6B1, 0x4EC4)
+DOUBLE_BYTE_PAIR(0xF6B2, 0x53A0)
+DOUBLE_BYTE_PAIR(0xF6B3, 0x60FB)
+DOUBLE_BYTE_PAIR(0xF6B4, 0x6E2C)
+DOUBLE_BYTE_PAIR(0xF6B5, 0x5C64)
+DOUBLE_BYTE_PAIR(0xF6B6, 0x4F88)
+DOUBLE_BYTE_PAIR(0xF6B7, 0x5024)
+DOUBLE_BYTE_PAIR(0xF6B8, 0x55E4)
+DOUBLE_BYTE_PAIR(0xF6B9, 0x5CD9)
+DOUBLE_BYTE_PAIR(0xF6BA, 0x5E5F)
+DOUBLE_BYTE_PAIR(0xF6BB, 0x6065)
+DOUBLE_BYTE_PAIR(0xF6BC, 0x6894)
+DOUBLE_BYTE_PAIR(0xF6BD, 0x6CBB)
+DOUBLE_BYTE_PAIR(0xF6BE, 0x6DC4)
+DOUBLE_BYTE_PAIR(0xF6BF, 0x71BE)
+DOUBLE_BYTE_PAIR(0xF6C0, 0x75D4)
+DOUBLE_BYTE_PAIR(0xF6C1, 0x75F4)
+DOUBLE_BYTE_PAIR(0xF6C2, 0x7661)
+DOUBLE_BYTE_PAIR(0xF6C3, 0x7A1A)
+DOUBLE_BYTE_PAIR(0xF6C4, 0x7A49)
+DOUBLE_BYTE_PAIR(0xF6C5, 0x7DC7)
+DOUBLE_BYTE_PAIR(0xF6C6, 0x7DFB)
+DOUBLE_BYTE_PAIR(0xF6C7, 0x7F6E)
+DOUBLE_BYTE_PAIR(0xF6C8, 0x81F4)
+DOUBLE_BYTE_PAIR(0xF6C9, 0x86A9)
+DOUBLE_BYTE_PAIR(0xF6CA, 0x8F1C)
+DOUBLE_BYTE_PAIR(0xF6CB, 0x96C9)
+DOUBLE_BYTE_PAIR(0xF6CC, 0x99B3)
+DOUBLE_BYTE_PAIR(0xF6CD, 0x9F52)
+DOUBLE_BYTE_PAIR(0xF6CE, 0x5247)
+DOUBLE_BYTE_PAIR(0xF6CF, 0x52C5)
+DOUBLE_BYTE_PAIR(0xF6D0, 0x98ED)
+DOUBLE_BYTE_PAIR(0xF6D1, 0x89AA)
+DOUBLE_BYTE_PAIR(0xF6D2, 0x4E03)
+DOUBLE_BYTE_PAIR(0xF6D3, 0x67D2)
+DOUBLE_BYTE_PAIR(0xF6D4, 0x6F06)
+DOUBLE_BYTE_PAIR(0xF6D5, 0x4FB5)
+DOUBLE_BYTE_PAIR(0xF6D6, 0x5BE2)
+DOUBLE_BYTE_PAIR(0xF6D7, 0x6795)
+DOUBLE_BYTE_PAIR(0xF6D8, 0x6C88)
+DOUBLE_BYTE_PAIR(0xF6D9, 0x6D78)
+DOUBLE_BYTE_PAIR(0xF6DA, 0x741B)
+DOUBLE_BYTE_PAIR(0xF6DB, 0x7827)
+DOUBLE_BYTE_PAIR(0xF6DC, 0x91DD)
+DOUBLE_BYTE_PAIR(0xF6DD, 0x937C)
+DOUBLE_BYTE_PAIR(0xF6DE, 0x87C4)
+DOUBLE_BYTE_PAIR(0xF6DF, 0x79E4)
+DOUBLE_BYTE_PAIR(0xF6E0, 0x7A31)
+DOUBLE_BYTE_PAIR(0xF6E1, 0x5FEB)
+DOUBLE_BYTE_PAIR(0xF6E2, 0x4ED6)
+DOUBLE_BYTE_PAIR(0xF6E3, 0x54A4)
+DOUBLE_BYTE_PAIR(0xF6E4, 0x553E)
+DOUBLE_BYTE_PAIR(0xF6E5, 0x58AE)
+DOUBLE_BYTE_PAIR(0xF6E6, 0x59A5)
+DOUBLE_BYTE_PAIR(0xF6E7, 0x60F0)
+DOUBLE_BYTE_PAIR(0xF6E8, 0x6253)
+DOUBLE_BYTE_PAIR(0xF6E9, 0x62D6)
+DOUBLE_BYTE_PAIR(0xF6EA, 0x6736)
+DOUBLE_BYTE_PAIR(0xF6EB, 0x6955)
+DOUBLE_BYTE_PAIR(0xF6EC, 0x8235)
+DOUBLE_BYTE_PAIR(0xF6ED, 0x9640)
+DOUBLE_BYTE_PAIR(0xF6EE, 0x99B1)
+DOUBLE_BYTE_PAIR(0xF6EF, 0x99DD)
+DOUBLE_BYTE_PAIR(0xF6F0, 0x502C)
+DOUBLE_BYTE_PAIR(0xF6F1, 0x5353)
+DOUBLE_BYTE_PAIR(0xF6F2, 0x5544)
+DOUBLE_BYTE_PAIR(0xF6F3, 0x577C)
+DOUBLE_BYTE_PAIR(0xF6F4, 0xFA01)
+DOUBLE_BYTE_PAIR(0xF6F5, 0x6258)
+DOUBLE_BYTE_PAIR(0xF6F6, 0xFA02)
+DOUBLE_BYTE_PAIR(0xF6F7, 0x64E2)
+DOUBLE_BYTE_PAIR(0xF6F8, 0x666B)
+DOUBLE_BYTE_PAIR(0xF6F9, 0x67DD)
+DOUBLE_BYTE_PAIR(0xF6FA, 0x6FC1)
+DOUBLE_BYTE_PAIR(0xF6FB, 0x6FEF)
+DOUBLE_BYTE_PAIR(0xF6FC, 0x7422)
+DOUBLE_BYTE_PAIR(0xF6FD, 0x7438)
+DOUBLE_BYTE_PAIR(0xF6FE, 0x8A17)
+DOUBLE_BYTE_PAIR(0xF7A1, 0x9438)
+DOUBLE_BYTE_PAIR(0xF7A2, 0x5451)
+DOUBLE_BYTE_PAIR(0xF7A3, 0x5606)
+DOUBLE_BYTE_PAIR(0xF7A4, 0x5766)
+DOUBLE_BYTE_PAIR(0xF7A5, 0x5F48)
+DOUBLE_BYTE_PAIR(0xF7A6, 0x619A)
+DOUBLE_BYTE_PAIR(0xF7A7, 0x6B4E)
+DOUBLE_BYTE_PAIR(0xF7A8, 0x7058)
+DOUBLE_BYTE_PAIR(0xF7A9, 0x70AD)
+DOUBLE_BYTE_PAIR(0xF7AA, 0x7DBB)
+DOUBLE_BYTE_PAIR(0xF7AB, 0x8A95)
+DOUBLE_BYTE_PAIR(0xF7AC, 0x596A)
+DOUBLE_BYTE_PAIR(0xF7AD, 0x812B)
+DOUBLE_BYTE_PAIR(0xF7AE, 0x63A2)
+DOUBLE_BYTE_PAIR(0xF7AF, 0x7708)
+DOUBLE_BYTE_PAIR(0xF7B0, 0x803D)
+DOUBLE_BYTE_PAIR(0xF7B1, 0x8CAA)
+DOUBLE_BYTE_PAIR(0xF7B2, 0x5854)
+DOUBLE_BYTE_PAIR(0xF7B3, 0x642D)
+DOUBLE_BYTE_PAIR(0xF7B4, 0x69BB)
+DOUBLE_BYTE_PAIR(0xF7B5, 0x5B95)
+DOUBLE_BYTE_PAIR(0xF7B6, 0x5E11)
+DOUBLE_BYTE_PAIR(0xF7B7, 0x6E6F)
+DOUBLE_BYTE_PAIR(0xF7B8, 0xFA03)
+DOUBLE_BYTE_PAIR(0xF7B9, 0x8569)
+DOUBLE_BYTE_PAIR(0xF7BA, 0x514C)
+DOUBLE_BYTE_PAIR(0xF7BB, 0x53F0)
+DOUBLE_BYTE_PAIR(0xF7BC, 0x592A)
+DOUBLE_BYTE_PAIR(0xF7BD, 0x6020)
+DOUBLE_BYTE_PAIR(0xF7BE, 0x614B)
+DOUBLE_BYTE_PAIR(0xF7BF, 0x6B86)
+DOUBLE_BYTE_PAIR(0xF7C0, 0x6C70)
+DOUBLE_BYTE_PAIR(0xF7C1, 0x6CF0)
+DOUBLE_BYTE_PAIR(0xF7C2, 0x7B1E)
+DOUBLE_BYTE_PAIR(0xF7C3, 0x80CE)
+DOUBLE_BYTE_PAIR(0xF7C4, 0x82D4)
+DOUBLE_BYTE_PAIR(0xF7C5, 0x8DC6)
+DOUBLE_BYTE_PAIR(0xF7C6, 0x90B0)
+DOUBLE_BYTE_PAIR(0xF7C7, 0x98B1)
+DOUBLE_BYTE_PAIR(0xF7C8, 0xFA04)
+DOUBLE_BYTE_PAIR(0xF7C9, 0x64C7)
+DOUBLE_BYTE_PAIR(0xF7CA, 0x6FA4)
+DOUBLE_BYTE_PAIR(0xF7CB, 0x6491)
+DOUBLE_BYTE_PAIR(0xF7CC, 0x6504)
+DOUBLE_BYTE_PAIR(0xF7CD, 0x514E)
+DOUBLE_BYTE_PAIR(0xF7CE, 0x5410)
+DOUBLE_BYTE_PAIR(0xF7CF, 0x571F)
+DOUBLE_BYTE_PAIR(0xF7D0, 0x8A0E)
+DOUBLE_BYTE_PAIR(0xF7D1, 0x615F)
+DOUBLE_BYTE_PAIR(0xF7D2, 0x6876)
+DOUBLE_BYTE_PAIR(0xF7D3, 0xFA05)
+DOUBLE_BYTE_PAIR(0xF7D4, 0x75DB)
+DOUBLE_BYTE_PAIR(0xF7D5, 0x7B52)
+DOUBLE_BYTE_PAIR(0xF7D6, 0x7D71)
+DOUBLE_BYTE_PAIR(0xF7D7, 0x901A)
+DOUBLE_BYTE_PAIR(0xF7D8, 0x5806)
+DOUBLE_BYTE_PAIR(0xF7D9, 0x69CC)
+DOUBLE_BYTE_PAIR(0xF7DA, 0x817F)
+DOUBLE_BYTE_PAIR(0xF7DB, 0x892A)
+DOUBLE_BYTE_PAIR(0xF7DC, 0x9000)
+DOUBLE_BYTE_PAIR(0xF7DD, 0x9839)
+DOUBLE_BYTE_PAIR(0xF7DE, 0x5078)
+DOUBLE_BYTE_PAIR(0xF7DF, 0x5957)
+DOUBLE_BYTE_PAIR(0xF7E0, 0x59AC)
+DOUBLE_BYTE_PAIR(0xF7E1, 0x6295)
+DOUBLE_BYTE_PAIR(0xF7E2, 0x900F)
+DOUBLE_BYTE_PAIR(0xF7E3, 0x9B2A)
+DOUBLE_BYTE_PAIR(0xF7E4, 0x615D)
+DOUBLE_BYTE_PAIR(0xF7E5, 0x7279)
+DOUBLE_BYTE_PAIR(0xF7E6, 0x95D6)
+DOUBLE_BYTE_PAIR(0xF7E7, 0x5761)
+DOUBLE_BYTE_PAIR(0xF7E8, 0x5A46)
+DOUBLE_BYTE_PAIR(0xF7E9, 0x5DF4)
+DOUBLE_BYTE_PAIR(0xF7EA, 0x628A)
+DOUBLE_BYTE_PAIR(0xF7EB, 0x64AD)
+DOUBLE_BYTE_PAIR(0xF7EC, 0x64FA)
+DOUBLE_BYTE_PAIR(0xF7ED, 0x6777)
+DOUBLE_BYTE_PAIR(0xF7EE, 0x6CE2)
+DOUBLE_BYTE_PAIR(0xF7EF, 0x6D3E)
+DOUBLE_BYTE_PAIR(0xF7F0, 0x722C)
+DOUBLE_BYTE_PAIR(0xF7F1, 0x7436)
+DOUBLE_BYTE_PAIR(0xF7F2, 0x7834)
+DOUBLE_BYTE_PAIR(0xF7F3, 0x7F77)
+DOUBLE_BYTE_PAIR(0xF7F4, 0x82AD)
+DOUBLE_BYTE_PAIR(0xF7F5, 0x8DDB)
+DOUBLE_BYTE_PAIR(0xF7F6, 0x9817)
+DOUBLE_BYTE_PAIR(0xF7F7, 0x5224)
+DOUBLE_BYTE_PAIR(0xF7F8, 0x5742)
+DOUBLE_BYTE_PAIR(0xF7F9, 0x677F)
+DOUBLE_BYTE_PAIR(0xF7FA, 0x7248)
+DOUBLE_BYTE_PAIR(0xF7FB, 0x74E3)
+DOUBLE_BYTE_PAIR(0xF7FC, 0x8CA9)
+DOUBLE_BYTE_PAIR(0xF7FD, 0x8FA6)
+DOUBLE_BYTE_PAIR(0xF7FE, 0x9211)
+DOUBLE_BYTE_PAIR(0xF8A1, 0x962A)
+DOUBLE_BYTE_PAIR(0xF8A2, 0x516B)
+DOUBLE_BYTE_PAIR(0xF8A3, 0x53ED)
+DOUBLE_BYTE_PAIR(0xF8A4, 0x634C)
+DOUBLE_BYTE_PAIR(0xF8A5, 0x4F69)
+DOUBLE_BYTE_PAIR(0xF8A6, 0x5504)
+DOUBLE_BYTE_PAIR(0xF8A7, 0x6096)
+DOUBLE_BYTE_PAIR(0xF8A8, 0x6557)
+DOUBLE_BYTE_PAIR(0xF8A9, 0x6C9B)
+DOUBLE_BYTE_PAIR(0xF8AA, 0x6D7F)
+DOUBLE_BYTE_PAIR(0xF8AB, 0x724C)
+DOUBLE_BYTE_PAIR(0xF8AC, 0x72FD)
+DOUBLE_BYTE_PAIR(0xF8AD, 0x7A17)
+DOUBLE_BYTE_PAIR(0xF8AE, 0x8987)
+DOUBLE_BYTE_PAIR(0xF8AF, 0x8C9D)
+DOUBLE_BYTE_PAIR(0xF8B0, 0x5F6D)
+DOUBLE_BYTE_PAIR(0xF8B1, 0x6F8E)
+DOUBLE_BYTE_PAIR(0xF8B2, 0x70F9)
+DOUBLE_BYTE_PAIR(0xF8B3, 0x81A8)
+DOUBLE_BYTE_PAIR(0xF8B4, 0x610E)
+DOUBLE_BYTE_PAIR(0xF8B5, 0x4FBF)
+DOUBLE_BYTE_PAIR(0xF8B6, 0x504F)
+DOUBLE_BYTE_PAIR(0xF8B7, 0x6241)
+DOUBLE_BYTE_PAIR(0xF8B8, 0x7247)
+DOUBLE_BYTE_PAIR(0xF8B9, 0x7BC7)
+DOUBLE_BYTE_PAIR(0xF8BA, 0x7DE8)
+DOUBLE_BYTE_PAIR(0xF8BB, 0x7FE9)
+DOUBLE_BYTE_PAIR(0xF8BC, 0x904D)
+DOUBLE_BYTE_PAIR(0xF8BD, 0x97AD)
+DOUBLE_BYTE_PAIR(0xF8BE, 0x9A19)
+DOUBLE_BYTE_PAIR(0xF8BF, 0x8CB6)
+DOUBLE_BYTE_PAIR(0xF8C0, 0x576A)
+DOUBLE_BYTE_PAIR(0xF8C1, 0x5E73)
+DOUBLE_BYTE_PAIR(0xF8C2, 0x67B0)
+DOUBLE_BYTE_PAIR(0xF8C3, 0x840D)
+DOUBLE_BYTE_PAIR(0xF8C4, 0x8A55)
+DOUBLE_BYTE_PAIR(0xF8C5, 0x5420)
+DOUBLE_BYTE_PAIR(0xF8C6, 0x5B16)
+DOUBLE_BYTE_PAIR(0xF8C7, 0x5E63)
+DOUBLE_BYTE_PAIR(0xF8C8, 0x5EE2)
+DOUBLE_BYTE_PAIR(0xF8C9, 0x5F0A)
+DOUBLE_BYTE_PAIR(0xF8CA, 0x6583)
+DOUBLE_BYTE_PAIR(0xF8CB, 0x80BA)
+DOUBLE_BYTE_PAIR(0xF8CC, 0x853D)
+DOUBLE_BYTE_PAIR(0xF8CD, 0x9589)
+DOUBLE_BYTE_PAIR(0xF8CE, 0x965B)
+DOUBLE_BYTE_PAIR(0xF8CF, 0x4F48)
+DOUBLE_BYTE_PAIR(0xF8D0, 0x5305)
+DOUBLE_BYTE_PAIR(0xF8D1, 0x530D)
+DOUBLE_BYTE_PAIR(0xF8D2, 0x530F)
+DOUBLE_BYTE_PAIR(0xF8D3, 0x5486)
+DOUBLE_BYTE_PAIR(0xF8D4, 0x54FA)
+DOUBLE_BYTE_PAIR(0xF8D5, 0x5703)
+DOUBLE_BYTE_PAIR(0xF8D6, 0x5E03)
+DOUBLE_BYTE_PAIR(0xF8D7, 0x6016)
+DOUBLE_BYTE_PAIR(0xF8D8, 0x629B)
+DOUBLE_BYTE_PAIR(0xF8D9, 0x62B1)
+DOUBLE_BYTE_PAIR(0xF8DA, 0x6355)
+DOUBLE_BYTE_PAIR(0xF8DB, 0xFA06)
+DOUBLE_BYTE_PAIR(0xF8DC, 0x6CE1)
+DOUBLE_BYTE_PAIR(0xF8DD, 0x6D66)
+DOUBLE_BYTE_PAIR(0xF8DE, 0x75B1)
+DOUBLE_BYTE_PAIR(0xF8DF, 0x7832)
+DOUBLE_BYTE_PAIR(0xF8E0, 0x80DE)
+DOUBLE_BYTE_PAIR(0xF8E1, 0x812F)
+DOUBLE_BYTE_PAIR(0xF8E2, 0x82DE)
+DOUBLE_BYTE_PAIR(0xF8E3, 0x8461)
+DOUBLE_BYTE_PAIR(0xF8E4, 0x84B2)
+DOUBLE_BYTE_PAIR(0xF8E5, 0x888D)
+DOUBLE_BYTE_PAIR(0xF8E6, 0x8912)
+DOUBLE_BYTE_PAIR(0xF8E7, 0x900B)
+DOUBLE_BYTE_PAIR(0xF8E8, 0x92EA)
+DOUBLE_BYTE_PAIR(0xF8E9, 0x98FD)
+DOUBLE_BYTE_PAIR(0xF8EA, 0x9B91)
+DOUBLE_BYTE_PAIR(0xF8EB, 0x5E45)
+DOUBLE_BYTE_PAIR(0xF8EC, 0x66B4)
+DOUBLE_BYTE_PAIR(0xF8ED, 0x66DD)
+DOUBLE_BYTE_PAIR(0xF8EE, 0x7011)
+DOUBLE_BYTE_PAIR(0xF8EF, 0x7206)
+DOUBLE_BYTE_PAIR(0xF8F0, 0xFA07)
+DOUBLE_BYTE_PAIR(0xF8F1, 0x4FF5)
+DOUBLE_BYTE_PAIR(0xF8F2, 0x527D)
+DOUBLE_BYTE_PAIR(0xF8F3, 0x5F6A)
+DOUBLE_BYTE_PAIR(0xF8F4, 0x6153)
+DOUBLE_BYTE_PAIR(0xF8F5, 0x6753)
+DOUBLE_BYTE_PAIR(0xF8F6, 0x6A19)
+DOUBLE_BYTE_PAIR(0xF8F7, 0x6F02)
+DOUBLE_BYTE_PAIR(0xF8F8, 0x74E2)
+DOUBLE_BYTE_PAIR(0xF8F9, 0x7968)
+DOUBLE_BYTE_PAIR(0xF8FA, 0x8868)
+DOUBLE_BYTE_PAIR(0xF8FB, 0x8C79)
+DOUBLE_BYTE_PAIR(0xF8FC, 0x98C7)
+DOUBLE_BYTE_PAIR(0xF8FD, 0x98C4)
+DOUBLE_BYTE_PAIR(0xF8FE, 0x9A43)
+DOUBLE_BYTE_PAIR(0xF9A1, 0x54C1)
+DOUBLE_BYTE_PAIR(0xF9A2, 0x7A1F)
+DOUBLE_BYTE_PAIR(0xF9A3, 0x6953)
+DOUBLE_BYTE_PAIR(0xF9A4, 0x8AF7)
+DOUBLE_BYTE_PAIR(0xF9A5, 0x8C4A)
+DOUBLE_BYTE_PAIR(0xF9A6, 0x98A8)
+DOUBLE_BYTE_PAIR(0xF9A7, 0x99AE)
+DOUBLE_BYTE_PAIR(0xF9A8, 0x5F7C)
+DOUBLE_BYTE_PAIR(0xF9A9, 0x62AB)
+DOUBLE_BYTE_PAIR(0xF9AA, 0x75B2)
+DOUBLE_BYTE_PAIR(0xF9AB, 0x76AE)
+DOUBLE_BYTE_PAIR(0xF9AC, 0x88AB)
+DOUBLE_BYTE_PAIR(0xF9AD, 0x907F)
+DOUBLE_BYTE_PAIR(0xF9AE, 0x9642)
+DOUBLE_BYTE_PAIR(0xF9AF, 0x5339)
+DOUBLE_BYTE_PAIR(0xF9B0, 0x5F3C)
+DOUBLE_BYTE_PAIR(0xF9B1, 0x5FC5)
+DOUBLE_BYTE_PAIR(0xF9B2, 0x6CCC)
+DOUBLE_BYTE_PAIR(0xF9B3, 0x73CC)
+DOUBLE_BYTE_PAIR(0xF9B4, 0x7562)
+DOUBLE_BYTE_PAIR(0xF9B5, 0x758B)
+DOUBLE_BYTE_PAIR(0xF9B6, 0x7B46)
+DOUBLE_BYTE_PAIR(0xF9B7, 0x82FE)
+DOUBLE_BYTE_PAIR(0xF9B8, 0x999D)
+DOUBLE_BYTE_PAIR(0xF9B9, 0x4E4F)
+DOUBLE_BYTE_PAIR(0xF9BA, 0x903C)
+DOUBLE_BYTE_PAIR(0xF9BB, 0x4E0B)
+DOUBLE_BYTE_PAIR(0xF9BC, 0x4F55)
+DOUBLE_BYTE_PAIR(0xF9BD, 0x53A6)
+DOUBLE_BYTE_PAIR(0xF9BE, 0x590F)
+DOUBLE_BYTE_PAIR(0xF9BF, 0x5EC8)
+DOUBLE_BYTE_PAIR(0xF9C0, 0x6630)
+DOUBLE_BYTE_PAIR(0xF9C1, 0x6CB3)
+DOUBLE_BYTE_PAIR(0xF9C2, 0x7455)
+DOUBLE_BYTE_PAIR(0xF9C3, 0x8377)
+DOUBLE_BYTE_PAIR(0xF9C4, 0x8766)
+DOUBLE_BYTE_PAIR(0xF9C5, 0x8CC0)
+DOUBLE_BYTE_PAIR(0xF9C6, 0x9050)
+DOUBLE_BYTE_PAIR(0xF9C7, 0x971E)
+DOUBLE_BYTE_PAIR(0xF9C8, 0x9C15)
+DOUBLE_BYTE_PAIR(0xF9C9, 0x58D1)
+DOUBLE_BYTE_PAIR(0xF9CA, 0x5B78)
+DOUBLE_BYTE_PAIR(0xF9CB, 0x8650)
+DOUBLE_BYTE_PAIR(0xF9CC, 0x8B14)
+DOUBLE_BYTE_PAIR(0xF9CD, 0x9DB4)
+DOUBLE_BYTE_PAIR(0xF9CE, 0x5BD2)
+DOUBLE_BYTE_PAIR(0xF9CF, 0x6068)
+DOUBLE_BYTE_PAIR(0xF9D0, 0x608D)
+DOUBLE_BYTE_PAIR(0xF9D1, 0x65F1)
+DOUBLE_BYTE_PAIR(0xF9D2, 0x6C57)
+DOUBLE_BYTE_PAIR(0xF9D3, 0x6F22)
+DOUBLE_BYTE_PAIR(0xF9D4, 0x6FA3)
+DOUBLE_BYTE_PAIR(0xF9D5, 0x701A)
+DOUBLE_BYTE_PAIR(0xF9D6, 0x7F55)
+DOUBLE_BYTE_PAIR(0xF9D7, 0x7FF0)
+DOUBLE_BYTE_PAIR(0xF9D8, 0x9591)
+DOUBLE_BYTE_PAIR(0xF9D9, 0x9592)
+DOUBLE_BYTE_PAIR(0xF9DA, 0x9650)
+DOUBLE_BYTE_PAIR(0xF9DB, 0x97D3)
+DOUBLE_BYTE_PAIR(0xF9DC, 0x5272)
+DOUBLE_BYTE_PAIR(0xF9DD, 0x8F44)
+DOUBLE_BYTE_PAIR(0xF9DE, 0x51FD)
+DOUBLE_BYTE_PAIR(0xF9DF, 0x542B)
+DOUBLE_BYTE_PAIR(0xF9E0, 0x54B8)
+DOUBLE_BYTE_PAIR(0xF9E1, 0x5563)
+DOUBLE_BYTE_PAIR(0xF9E2, 0x558A)
+DOUBLE_BYTE_PAIR(0xF9E3, 0x6ABB)
+DOUBLE_BYTE_PAIR(0xF9E4, 0x6DB5)
+DOUBLE_BYTE_PAIR(0xF9E5, 0x7DD8)
+DOUBLE_BYTE_PAIR(0xF9E6, 0x8266)
+DOUBLE_BYTE_PAIR(0xF9E7, 0x929C)
+DOUBLE_BYTE_PAIR(0xF9E8, 0x9677)
+DOUBLE_BYTE_PAIR(0xF9E9, 0x9E79)
+DOUBLE_BYTE_PAIR(0xF9EA, 0x5408)
+DOUBLE_BYTE_PAIR(0xF9EB, 0x54C8)
+DOUBLE_BYTE_PAIR(0xF9EC, 0x76D2)
+DOUBLE_BYTE_PAIR(0xF9ED, 0x86E4)
+DOUBLE_BYTE_PAIR(0xF9EE, 0x95A4)
+DOUBLE_BYTE_PAIR(0xF9EF, 0x95D4)
+DOUBLE_BYTE_PAIR(0xF9F0, 0x965C)
+DOUBLE_BYTE_PAIR(0xF9F1, 0x4EA2)
+DOUBLE_BYTE_PAIR(0xF9F2, 0x4F09)
+DOUBLE_BYTE_PAIR(0xF9F3, 0x59EE)
+DOUBLE_BYTE_PAIR(0xF9F4, 0x5AE6)
+DOUBLE_BYTE_PAIR(0xF9F5, 0x5DF7)
+DOUBLE_BYTE_PAIR(0xF9F6, 0x6052)
+DOUBLE_BYTE_PAIR(0xF9F7, 0x6297)
+DOUBLE_BYTE_PAIR(0xF9F8, 0x676D)
+DOUBLE_BYTE_PAIR(0xF9F9, 0x6841)
+DOUBLE_BYTE_PAIR(0xF9FA, 0x6C86)
+DOUBLE_BYTE_PAIR(0xF9FB, 0x6E2F)
+DOUBLE_BYTE_PAIR(0xF9FC, 0x7F38)
+DOUBLE_BYTE_PAIR(0xF9FD, 0x809B)
+DOUBLE_BYTE_PAIR(0xF9FE, 0x822A)
+DOUBLE_BYTE_PAIR(0xFAA1, 0xFA08)
+DOUBLE_BYTE_PAIR(0xFAA2, 0xFA09)
+DOUBLE_BYTE_PAIR(0xFAA3, 0x9805)
+DOUBLE_BYTE_PAIR(0xFAA4, 0x4EA5)
+DOUBLE_BYTE_PAIR(0xFAA5, 0x5055)
+DOUBLE_BYTE_PAIR(0xFAA6, 0x54B3)
+DOUBLE_BYTE_PAIR(0xFAA7, 0x5793)
+DOUBLE_BYTE_PAIR(0xFAA8, 0x595A)
+DOUBLE_BYTE_PAIR(0xFAA9, 0x5B69)
+DOUBLE_BYTE_PAIR(0xFAAA, 0x5BB3)
+DOUBLE_BYTE_PAIR(0xFAAB, 0x61C8)
+DOUBLE_BYTE_PAIR(0xFAAC, 0x6977)
+DOUBLE_BYTE_PAIR(0xFAAD, 0x6D77)
+DOUBLE_BYTE_PAIR(0xFAAE, 0x7023)
+DOUBLE_BYTE_PAIR(0xFAAF, 0x87F9)
+DOUBLE_BYTE_PAIR(0xFAB0, 0x89E3)
+DOUBLE_BYTE_PAIR(0xFAB1, 0x8A72)
+DOUBLE_BYTE_PAIR(0xFAB2, 0x8AE7)
+DOUBLE_BYTE_PAIR(0xFAB3, 0x9082)
+DOUBLE_BYTE_PAIR(0xFAB4, 0x99ED)
+DOUBLE_BYTE_PAIR(0xFAB5, 0x9AB8)
+DOUBLE_BYTE_PAIR(0xFAB6, 0x52BE)
+DOUBLE_BYTE_PAIR(0xFAB7, 0x6838)
+DOUBLE_BYTE_PAIR(0xFAB8, 0x5016)
+DOUBLE_BYTE_PAIR(0xFAB9, 0x5E78)
+DOUBLE_BYTE_PAIR(0xFABA, 0x674F)
+DOUBLE_BYTE_PAIR(0xFABB, 0x8347)
+DOUBLE_BYTE_PAIR(0xFABC, 0x884C)
+DOUBLE_BYTE_PAIR(0xFABD, 0x4EAB)
+DOUBLE_BYTE_PAIR(0xFABE, 0x5411)
+DOUBLE_BYTE_PAIR(0xFABF, 0x56AE)
+DOUBLE_BYTE_PAIR(0xFAC0, 0x73E6)
+DOUBLE_BYTE_PAIR(0xFAC1, 0x9115)
+DOUBLE_BYTE_PAIR(0xFAC2, 0x97FF)
+DOUBLE_BYTE_PAIR(0xFAC3, 0x9909)
+DOUBLE_BYTE_PAIR(0xFAC4, 0x9957)
+DOUBLE_BYTE_PAIR(0xFAC5, 0x9999)
+DOUBLE_BYTE_PAIR(0xFAC6, 0x5653)
+DOUBLE_BYTE_PAIR(0xFAC7, 0x589F)
+DOUBLE_BYTE_PAIR(0xFAC8, 0x865B)
+DOUBLE_BYTE_PAIR(0xFAC9, 0x8A31)
+DOUBLE_BYTE_PAIR(0xFACA, 0x61B2)
+DOUBLE_BYTE_PAIR(0xFACB, 0x6AF6)
+DOUBLE_BYTE_PAIR(0xFACC, 0x737B)
+DOUBLE_BYTE_PAIR(0xFACD, 0x8ED2)
+DOUBLE_BYTE_PAIR(0xFACE, 0x6B47)
+DOUBLE_BYTE_PAIR(0xFACF, 0x96AA)
+DOUBLE_BYTE_PAIR(0xFAD0, 0x9A57)
+DOUBLE_BYTE_PAIR(0xFAD1, 0x5955)
+DOUBLE_BYTE_PAIR(0xFAD2, 0x7200)
+DOUBLE_BYTE_PAIR(0xFAD3, 0x8D6B)
+DOUBLE_BYTE_PAIR(0xFAD4, 0x9769)
+DOUBLE_BYTE_PAIR(0xFAD5, 0x4FD4)
+DOUBLE_BYTE_PAIR(0xFAD6, 0x5CF4)
+DOUBLE_BYTE_PAIR(0xFAD7, 0x5F26)
+DOUBLE_BYTE_PAIR(0xFAD8, 0x61F8)
+DOUBLE_BYTE_PAIR(0xFAD9, 0x665B)
+DOUBLE_BYTE_PAIR(0xFADA, 0x6CEB)
+DOUBLE_BYTE_PAIR(0xFADB, 0x70AB)
+DOUBLE_BYTE_PAIR(0xFADC, 0x7384)
+DOUBLE_BYTE_PAIR(0xFADD, 0x73B9)
+DOUBLE_BYTE_PAIR(0xFADE, 0x73FE)
+DOUBLE_BYTE_PAIR(0xFADF, 0x7729)
+DOUBLE_BYTE_PAIR(0xFAE0, 0x774D)
+DOUBLE_BYTE_PAIR(0xFAE1, 0x7D43)
+DOUBLE_BYTE_PAIR(0xFAE2, 0x7D62)
+DOUBLE_BYTE_PAIR(0xFAE3, 0x7E23)
+DOUBLE_BYTE_PAIR(0xFAE4, 0x8237)
+DOUBLE_BYTE_PAIR(0xFAE5, 0x8852)
+DOUBLE_BYTE_PAIR(0xFAE6, 0xFA0A)
+DOUBLE_BYTE_PAIR(0xFAE7, 0x8CE2)
+DOUBLE_BYTE_PAIR(0xFAE8, 0x9249)
+DOUBLE_BYTE_PAIR(0xFAE9, 0x986F)
+DOUBLE_BYTE_PAIR(0xFAEA, 0x5B51)
+DOUBLE_BYTE_PAIR(0xFAEB, 0x7A74)
+DOUBLE_BYTE_PAIR(0xFAEC, 0x8840)
+DOUBLE_BYTE_PAIR(0xFAED, 0x9801)
+DOUBLE_BYTE_PAIR(0xFAEE, 0x5ACC)
+DOUBLE_BYTE_PAIR(0xFAEF, 0x4FE0)
+DOUBLE_BYTE_PAIR(0xFAF0, 0x5354)
+DOUBLE_BYTE_PAIR(0xFAF1, 0x593E)
+DOUBLE_BYTE_PAIR(0xFAF2, 0x5CFD)
+DOUBLE_BYTE_PAIR(0xFAF3, 0x633E)
+DOUBLE_BYTE_PAIR(0xFAF4, 0x6D79)
+DOUBLE_BYTE_PAIR(0xFAF5, 0x72F9)
+DOUBLE_BYTE_PAIR(0xFAF6, 0x8105)
+DOUBLE_BYTE_PAIR(0xFAF7, 0x8107)
+DOUBLE_BYTE_PAIR(0xFAF8, 0x83A2)
+DOUBLE_BYTE_PAIR(0xFAF9, 0x92CF)
+DOUBLE_BYTE_PAIR(0xFAFA, 0x9830)
+DOUBLE_BYTE_PAIR(0xFAFB, 0x4EA8)
+DOUBLE_BYTE_PAIR(0xFAFC, 0x5144)
+DOUBLE_BYTE_PAIR(0xFAFD, 0x5211)
+DOUBLE_BYTE_PAIR(0xFAFE, 0x578B)
+DOUBLE_BYTE_PAIR(0xFBA1, 0x5F62)
+DOUBLE_BYTE_PAIR(0xFBA2, 0x6CC2)
+DOUBLE_BYTE_PAIR(0xFBA3, 0x6ECE)
+DOUBLE_BYTE_PAIR(0xFBA4, 0x7005)
+DOUBLE_BYTE_PAIR(0xFBA5, 0x7050)
+DOUBLE_BYTE_PAIR(0xFBA6, 0x70AF)
+DOUBLE_BYTE_PAIR(0xFBA7, 0x7192)
+DOUBLE_BYTE_PAIR(0xFBA8, 0x73E9)
+DOUBLE_BYTE_PAIR(0xFBA9, 0x7469)
+DOUBLE_BYTE_PAIR(0xFBAA, 0x834A)
+DOUBLE_BYTE_PAIR(0xFBAB, 0x87A2)
+DOUBLE_BYTE_PAIR(0xFBAC, 0x8861)
+DOUBLE_BYTE_PAIR(0xFBAD, 0x9008)
+DOUBLE_BYTE_PAIR(0xFBAE, 0x90A2)
+DOUBLE_BYTE_PAIR(0xFBAF, 0x93A3)
+DOUBLE_BYTE_PAIR(0xFBB0, 0x99A8)
+DOUBLE_BYTE_PAIR(0xFBB1, 0x516E)
+DOUBLE_BYTE_PAIR(0xFBB2, 0x5F57)
+DOUBLE_BYTE_PAIR(0xFBB3, 0x60E0)
+DOUBLE_BYTE_PAIR(0xFBB4, 0x6167)
+DOUBLE_BYTE_PAIR(0xFBB5, 0x66B3)
+DOUBLE_BYTE_PAIR(0xFBB6, 0x8559)
+DOUBLE_BYTE_PAIR(0xFBB7, 0x8E4A)
+DOUBLE_BYTE_PAIR(0xFBB8, 0x91AF)
+DOUBLE_BYTE_PAIR(0xFBB9, 0x978B)
+DOUBLE_BYTE_PAIR(0xFBBA, 0x4E4E)
+DOUBLE_BYTE_PAIR(0xFBBB, 0x4E92)
+DOUBLE_BYTE_PAIR(0xFBBC, 0x547C)
+DOUBLE_BYTE_PAIR(0xFBBD, 0x58D5)
+DOUBLE_BYTE_PAIR(0xFBBE, 0x58FA)
+DOUBLE_BYTE_PAIR(0xFBBF, 0x597D)
+DOUBLE_BYTE_PAIR(0xFBC0, 0x5CB5)
+DOUBLE_BYTE_PAIR(0xFBC1, 0x5F27)
+DOUBLE_BYTE_PAIR(0xFBC2, 0x6236)
+DOUBLE_BYTE_PAIR(0xFBC3, 0x6248)
+DOUBLE_BYTE_PAIR(0xFBC4, 0x660A)
+DOUBLE_BYTE_PAIR(0xFBC5, 0x6667)
+DOUBLE_BYTE_PAIR(0xFBC6, 0x6BEB)
+DOUBLE_BYTE_PAIR(0xFBC7, 0x6D69)
+DOUBLE_BYTE_PAIR(0xFBC8, 0x6DCF)
+DOUBLE_BYTE_PAIR(0xFBC9, 0x6E56)
+DOUBLE_BYTE_PAIR(0xFBCA, 0x6EF8)
+DOUBLE_BYTE_PAIR(0xFBCB, 0x6F94)
+DOUBLE_BYTE_PAIR(0xFBCC, 0x6FE0)
+DOUBLE_BYTE_PAIR(0xFBCD, 0x6FE9)
+DOUBLE_BYTE_PAIR(0xFBCE, 0x705D)
+DOUBLE_BYTE_PAIR(0xFBCF, 0x72D0)
+DOUBLE_BYTE_PAIR(0xFBD0, 0x7425)
+DOUBLE_BYTE_PAIR(0xFBD1, 0x745A)
+DOUBLE_BYTE_PAIR(0xFBD2, 0x74E0)
+DOUBLE_BYTE_PAIR(0xFBD3, 0x7693)
+DOUBLE_BYTE_PAIR(0xFBD4, 0x795C)
+DOUBLE_BYTE_PAIR(0xFBD5, 0x7CCA)
+DOUBLE_BYTE_PAIR(0xFBD6, 0x7E1E)
+DOUBLE_BYTE_PAIR(0xFBD7, 0x80E1)
+DOUBLE_BYTE_PAIR(0xFBD8, 0x82A6)
+DOUBLE_BYTE_PAIR(0xFBD9, 0x846B)
+DOUBLE_BYTE_PAIR(0xFBDA, 0x84BF)
+DOUBLE_BYTE_PAIR(0xFBDB, 0x864E)
+DOUBLE_BYTE_PAIR(0xFBDC, 0x865F)
+DOUBLE_BYTE_PAIR(0xFBDD, 0x8774)
+DOUBLE_BYTE_PAIR(0xFBDE, 0x8B77)
+DOUBLE_BYTE_PAIR(0xFBDF, 0x8C6A)
+DOUBLE_BYTE_PAIR(0xFBE0, 0x93AC)
+DOUBLE_BYTE_PAIR(0xFBE1, 0x9800)
+DOUBLE_BYTE_PAIR(0xFBE2, 0x9865)
+DOUBLE_BYTE_PAIR(0xFBE3, 0x60D1)
+DOUBLE_BYTE_PAIR(0xFBE4, 0x6216)
+DOUBLE_BYTE_PAIR(0xFBE5, 0x9177)
+DOUBLE_BYTE_PAIR(0xFBE6, 0x5A5A)
+DOUBLE_BYTE_PAIR(0xFBE7, 0x660F)
+DOUBLE_BYTE_PAIR(0xFBE8, 0x6DF7)
+DOUBLE_BYTE_PAIR(0xFBE9, 0x6E3E)
+DOUBLE_BYTE_PAIR(0xFBEA, 0x743F)
+DOUBLE_BYTE_PAIR(0xFBEB, 0x9B42)
+DOUBLE_BYTE_PAIR(0xFBEC, 0x5FFD)
+DOUBLE_BYTE_PAIR(0xFBED, 0x60DA)
+DOUBLE_BYTE_PAIR(0xFBEE, 0x7B0F)
+DOUBLE_BYTE_PAIR(0xFBEF, 0x54C4)
+DOUBLE_BYTE_PAIR(0xFBF0, 0x5F18)
+DOUBLE_BYTE_PAIR(0xFBF1, 0x6C5E)
+DOUBLE_BYTE_PAIR(0xFBF2, 0x6CD3)
+DOUBLE_BYTE_PAIR(0xFBF3, 0x6D2A)
+DOUBLE_BYTE_PAIR(0xFBF4, 0x70D8)
+DOUBLE_BYTE_PAIR(0xFBF5, 0x7D05)
+DOUBLE_BYTE_PAIR(0xFBF6, 0x8679)
+DOUBLE_BYTE_PAIR(0xFBF7, 0x8A0C)
+DOUBLE_BYTE_PAIR(0xFBF8, 0x9D3B)
+DOUBLE_BYTE_PAIR(0xFBF9, 0x5316)
+DOUBLE_BYTE_PAIR(0xFBFA, 0x548C)
+DOUBLE_BYTE_PAIR(0xFBFB, 0x5B05)
+DOUBLE_BYTE_PAIR(0xFBFC, 0x6A3A)
+DOUBLE_BYTE_PAIR(0xFBFD, 0x706B)
+DOUBLE_BYTE_PAIR(0xFBFE, 0x7575)
+DOUBLE_BYTE_PAIR(0xFCA1, 0x798D)
+DOUBLE_BYTE_PAIR(0xFCA2, 0x79BE)
+DOUBLE_BYTE_PAIR(0xFCA3, 0x82B1)
+DOUBLE_BYTE_PAIR(0xFCA4, 0x83EF)
+DOUBLE_BYTE_PAIR(0xFCA5, 0x8A71)
+DOUBLE_BYTE_PAIR(0xFCA6, 0x8B41)
+DOUBLE_BYTE_PAIR(0xFCA7, 0x8CA8)
+DOUBLE_BYTE_PAIR(0xFCA8, 0x9774)
+DOUBLE_BYTE_PAIR(0xFCA9, 0xFA0B)
+DOUBLE_BYTE_PAIR(0xFCAA, 0x64F4)
+DOUBLE_BYTE_PAIR(0xFCAB, 0x652B)
+DOUBLE_BYTE_PAIR(0xFCAC, 0x78BA)
+DOUBLE_BYTE_PAIR(0xFCAD, 0x78BB)
+DOUBLE_BYTE_PAIR(0xFCAE, 0x7A6B)
+DOUBLE_BYTE_PAIR(0xFCAF, 0x4E38)
+DOUBLE_BYTE_PAIR(0xFCB0, 0x559A)
+DOUBLE_BYTE_PAIR(0xFCB1, 0x5950)
+DOUBLE_BYTE_PAIR(0xFCB2, 0x5BA6)
+DOUBLE_BYTE_PAIR(0xFCB3, 0x5E7B)
+DOUBLE_BYTE_PAIR(0xFCB4, 0x60A3)
+DOUBLE_BYTE_PAIR(0xFCB5, 0x63DB)
+DOUBLE_BYTE_PAIR(0xFCB6, 0x6B61)
+DOUBLE_BYTE_PAIR(0xFCB7, 0x6665)
+DOUBLE_BYTE_PAIR(0xFCB8, 0x6853)
+DOUBLE_BYTE_PAIR(0xFCB9, 0x6E19)
+DOUBLE_BYTE_PAIR(0xFCBA, 0x7165)
+DOUBLE_BYTE_PAIR(0xFCBB, 0x74B0)
+DOUBLE_BYTE_PAIR(0xFCBC, 0x7D08)
+DOUBLE_BYTE_PAIR(0xFCBD, 0x9084)
+DOUBLE_BYTE_PAIR(0xFCBE, 0x9A69)
+DOUBLE_BYTE_PAIR(0xFCBF, 0x9C25)
+DOUBLE_BYTE_PAIR(0xFCC0, 0x6D3B)
+DOUBLE_BYTE_PAIR(0xFCC1, 0x6ED1)
+DOUBLE_BYTE_PAIR(0xFCC2, 0x733E)
+DOUBLE_BYTE_PAIR(0xFCC3, 0x8C41)
+DOUBLE_BYTE_PAIR(0xFCC4, 0x95CA)
+DOUBLE_BYTE_PAIR(0xFCC5, 0x51F0)
+DOUBLE_BYTE_PAIR(0xFCC6, 0x5E4C)
+DOUBLE_BYTE_PAIR(0xFCC7, 0x5FA8)
+DOUBLE_BYTE_PAIR(0xFCC8, 0x604D)
+DOUBLE_BYTE_PAIR(0xFCC9, 0x60F6)
+DOUBLE_BYTE_PAIR(0xFCCA, 0x6130)
+DOUBLE_BYTE_PAIR(0xFCCB, 0x614C)
+DOUBLE_BYTE_PAIR(0xFCCC, 0x6643)
+DOUBLE_BYTE_PAIR(0xFCCD, 0x6644)
+DOUBLE_BYTE_PAIR(0xFCCE, 0x69A5)
+DOUBLE_BYTE_PAIR(0xFCCF, 0x6CC1)
+DOUBLE_BYTE_PAIR(0xFCD0, 0x6E5F)
+DOUBLE_BYTE_PAIR(0xFCD1, 0x6EC9)
+DOUBLE_BYTE_PAIR(0xFCD2, 0x6F62)
+DOUBLE_BYTE_PAIR(0xFCD3, 0x714C)
+DOUBLE_BYTE_PAIR(0xFCD4, 0x749C)
+DOUBLE_BYTE_PAIR(0xFCD5, 0x7687)
+DOUBLE_BYTE_PAIR(0xFCD6, 0x7BC1)
+DOUBLE_BYTE_PAIR(0xFCD7, 0x7C27)
+DOUBLE_BYTE_PAIR(0xFCD8, 0x8352)
+DOUBLE_BYTE_PAIR(0xFCD9, 0x8757)
+DOUBLE_BYTE_PAIR(0xFCDA, 0x9051)
+DOUBLE_BYTE_PAIR(0xFCDB, 0x968D)
+DOUBLE_BYTE_PAIR(0xFCDC, 0x9EC3)
+DOUBLE_BYTE_PAIR(0xFCDD, 0x532F)
+DOUBLE_BYTE_PAIR(0xFCDE, 0x56DE)
+DOUBLE_BYTE_PAIR(0xFCDF, 0x5EFB)
+DOUBLE_BYTE_PAIR(0xFCE0, 0x5F8A)
+DOUBLE_BYTE_PAIR(0xFCE1, 0x6062)
+DOUBLE_BYTE_PAIR(0xFCE2, 0x6094)
+DOUBLE_BYTE_PAIR(0xFCE3, 0x61F7)
+DOUBLE_BYTE_PAIR(0xFCE4, 0x6666)
+DOUBLE_BYTE_PAIR(0xFCE5, 0x6703)
+DOUBLE_BYTE_PAIR(0xFCE6, 0x6A9C)
+DOUBLE_BYTE_PAIR(0xFCE7, 0x6DEE)
+DOUBLE_BYTE_PAIR(0xFCE8, 0x6FAE)
+DOUBLE_BYTE_PAIR(0xFCE9, 0x7070)
+DOUBLE_BYTE_PAIR(0xFCEA, 0x736A)
+DOUBLE_BYTE_PAIR(0xFCEB, 0x7E6A)
+DOUBLE_BYTE_PAIR(0xFCEC, 0x81BE)
+DOUBLE_BYTE_PAIR(0xFCED, 0x8334)
+DOUBLE_BYTE_PAIR(0xFCEE, 0x86D4)
+DOUBLE_BYTE_PAIR(0xFCEF, 0x8AA8)
+DOUBLE_BYTE_PAIR(0xFCF0, 0x8CC4)
+DOUBLE_BYTE_PAIR(0xFCF1, 0x5283)
+DOUBLE_BYTE_PAIR(0xFCF2, 0x7372)
+DOUBLE_BYTE_PAIR(0xFCF3, 0x5B96)
+DOUBLE_BYTE_PAIR(0xFCF4, 0x6A6B)
+DOUBLE_BYTE_PAIR(0xFCF5, 0x9404)
+DOUBLE_BYTE_PAIR(0xFCF6, 0x54EE)
+DOUBLE_BYTE_PAIR(0xFCF7, 0x5686)
+DOUBLE_BYTE_PAIR(0xFCF8, 0x5B5D)
+DOUBLE_BYTE_PAIR(0xFCF9, 0x6548)
+DOUBLE_BYTE_PAIR(0xFCFA, 0x6585)
+DOUBLE_BYTE_PAIR(0xFCFB, 0x66C9)
+DOUBLE_BYTE_PAIR(0xFCFC, 0x689F)
+DOUBLE_BYTE_PAIR(0xFCFD, 0x6D8D)
+DOUBLE_BYTE_PAIR(0xFCFE, 0x6DC6)
+DOUBLE_BYTE_PAIR(0xFDA1, 0x723B)
+DOUBLE_BYTE_PAIR(0xFDA2, 0x80B4)
+DOUBLE_BYTE_PAIR(0xFDA3, 0x9175)
+DOUBLE_BYTE_PAIR(0xFDA4, 0x9A4D)
+DOUBLE_BYTE_PAIR(0xFDA5, 0x4FAF)
+DOUBLE_BYTE_PAIR(0xFDA6, 0x5019)
+DOUBLE_BYTE_PAIR(0xFDA7, 0x539A)
+DOUBLE_BYTE_PAIR(0xFDA8, 0x540E)
+DOUBLE_BYTE_PAIR(0xFDA9, 0x543C)
+DOUBLE_BYTE_PAIR(0xFDAA, 0x5589)
+DOUBLE_BYTE_PAIR(0xFDAB, 0x55C5)
+DOUBLE_BYTE_PAIR(0xFDAC, 0x5E3F)
+DOUBLE_BYTE_PAIR(0xFDAD, 0x5F8C)
+DOUBLE_BYTE_PAIR(0xFDAE, 0x673D)
+DOUBLE_BYTE_PAIR(0xFDAF, 0x7166)
+DOUBLE_BYTE_PAIR(0xFDB0, 0x73DD)
+DOUBLE_BYTE_PAIR(0xFDB1, 0x9005)
+DOUBLE_BYTE_PAIR(0xFDB2, 0x52DB)
+DOUBLE_BYTE_PAIR(0xFDB3, 0x52F3)
+DOUBLE_BYTE_PAIR(0xFDB4, 0x5864)
+DOUBLE_BYTE_PAIR(0xFDB5, 0x58CE)
+DOUBLE_BYTE_PAIR(0xFDB6, 0x7104)
+DOUBLE_BYTE_PAIR(0xFDB7, 0x718F)
+DOUBLE_BYTE_PAIR(0xFDB8, 0x71FB)
+DOUBLE_BYTE_PAIR(0xFDB9, 0x85B0)
+DOUBLE_BYTE_PAIR(0xFDBA, 0x8A13)
+DOUBLE_BYTE_PAIR(0xFDBB, 0x6688)
+DOUBLE_BYTE_PAIR(0xFDBC, 0x85A8)
+DOUBLE_BYTE_PAIR(0xFDBD, 0x55A7)
+DOUBLE_BYTE_PAIR(0xFDBE, 0x6684)
+DOUBLE_BYTE_PAIR(0xFDBF, 0x714A)
+DOUBLE_BYTE_PAIR(0xFDC0, 0x8431)
+DOUBLE_BYTE_PAIR(0xFDC1, 0x5349)
+DOUBLE_BYTE_PAIR(0xFDC2, 0x5599)
+DOUBLE_BYTE_PAIR(0xFDC3, 0x6BC1)
+DOUBLE_BYTE_PAIR(0xFDC4, 0x5F59)
+DOUBLE_BYTE_PAIR(0xFDC5, 0x5FBD)
+DOUBLE_BYTE_PAIR(0xFDC6, 0x63EE)
+DOUBLE_BYTE_PAIR(0xFDC7, 0x6689)
+DOUBLE_BYTE_PAIR(0xFDC8, 0x7147)
+DOUBLE_BYTE_PAIR(0xFDC9, 0x8AF1)
+DOUBLE_BYTE_PAIR(0xFDCA, 0x8F1D)
+DOUBLE_BYTE_PAIR(0xFDCB, 0x9EBE)
+DOUBLE_BYTE_PAIR(0xFDCC, 0x4F11)
+DOUBLE_BYTE_PAIR(0xFDCD, 0x643A)
+DOUBLE_BYTE_PAIR(0xFDCE, 0x70CB)
+DOUBLE_BYTE_PAIR(0xFDCF, 0x7566)
+DOUBLE_BYTE_PAIR(0xFDD0, 0x8667)
+DOUBLE_BYTE_PAIR(0xFDD1, 0x6064)
+DOUBLE_BYTE_PAIR(0xFDD2, 0x8B4E)
+DOUBLE_BYTE_PAIR(0xFDD3, 0x9DF8)
+DOUBLE_BYTE_PAIR(0xFDD4, 0x5147)
+DOUBLE_BYTE_PAIR(0xFDD5, 0x51F6)
+DOUBLE_BYTE_PAIR(0xFDD6, 0x5308)
+DOUBLE_BYTE_PAIR(0xFDD7, 0x6D36)
+DOUBLE_BYTE_PAIR(0xFDD8, 0x80F8)
+DOUBLE_BYTE_PAIR(0xFDD9, 0x9ED1)
+DOUBLE_BYTE_PAIR(0xFDDA, 0x6615)
+DOUBLE_BYTE_PAIR(0xFDDB, 0x6B23)
+DOUBLE_BYTE_PAIR(0xFDDC, 0x7098)
+DOUBLE_BYTE_PAIR(0xFDDD, 0x75D5)
+DOUBLE_BYTE_PAIR(0xFDDE, 0x5403)
+DOUBLE_BYTE_PAIR(0xFDDF, 0x5C79)
+DOUBLE_BYTE_PAIR(0xFDE0, 0x7D07)
+DOUBLE_BYTE_PAIR(0xFDE1, 0x8A16)
+DOUBLE_BYTE_PAIR(0xFDE2, 0x6B20)
+DOUBLE_BYTE_PAIR(0xFDE3, 0x6B3D)
+DOUBLE_BYTE_PAIR(0xFDE4, 0x6B46)
+DOUBLE_BYTE_PAIR(0xFDE5, 0x5438)
+DOUBLE_BYTE_PAIR(0xFDE6, 0x6070)
+DOUBLE_BYTE_PAIR(0xFDE7, 0x6D3D)
+DOUBLE_BYTE_PAIR(0xFDE8, 0x7FD5)
+DOUBLE_BYTE_PAIR(0xFDE9, 0x8208)
+DOUBLE_BYTE_PAIR(0xFDEA, 0x50D6)
+DOUBLE_BYTE_PAIR(0xFDEB, 0x51DE)
+DOUBLE_BYTE_PAIR(0xFDEC, 0x559C)
+DOUBLE_BYTE_PAIR(0xFDED, 0x566B)
+DOUBLE_BYTE_PAIR(0xFDEE, 0x56CD)
+DOUBLE_BYTE_PAIR(0xFDEF, 0x59EC)
+DOUBLE_BYTE_PAIR(0xFDF0, 0x5B09)
+DOUBLE_BYTE_PAIR(0xFDF1, 0x5E0C)
+DOUBLE_BYTE_PAIR(0xFDF2, 0x6199)
+DOUBLE_BYTE_PAIR(0xFDF3, 0x6198)
+DOUBLE_BYTE_PAIR(0xFDF4, 0x6231)
+DOUBLE_BYTE_PAIR(0xFDF5, 0x665E)
+DOUBLE_BYTE_PAIR(0xFDF6, 0x66E6)
+DOUBLE_BYTE_PAIR(0xFDF7, 0x7199)
+DOUBLE_BYTE_PAIR(0xFDF8, 0x71B9)
+DOUBLE_BYTE_PAIR(0xFDF9, 0x71BA)
+DOUBLE_BYTE_PAIR(0xFDFA, 0x72A7)
+DOUBLE_BYTE_PAIR(0xFDFB, 0x79A7)
+DOUBLE_BYTE_PAIR(0xFDFC, 0x7A00)
+DOUBLE_BYTE_PAIR(0xFDFD, 0x7FB2)
+DOUBLE_BYTE_PAIR(0xFDFE, 0x8A70)
+
+#undef DOUBLE_BYTE_PAIR
@@ -0,0 +1,9800 @@
+// This file is generated from https://www.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP932.TXT
+// DO NOT EDIT!
+
+DOUBLE_BYTE_PAIR(0x00, 0x0000)
+DOUBLE_BYTE_PAIR(0x01, 0x0001)
+DOUBLE_BYTE_PAIR(0x02, 0x0002)
+DOUBLE_BYTE_PAIR(0x03, 0x0003)
+DOUBLE_BYTE_PAIR(0x04, 0x0004)
+DOUBLE_BYTE_PAIR(0x05, 0x0005)
+DOUBLE_BYTE_PAIR(0x06, 0x0006)
+DOUBLE_BYTE_PAIR(0x07, 0x0007)
+DOUBLE_BYTE_PAIR(0x08, 0x0008)
+DOUBLE_BYTE_PAIR(0x09, 0x0009)
+DOUBLE_BYTE_PAIR(0x0A, 0x000A)
+DOUBLE_BYTE_PAIR(0x0B, 0x000B)
+DOUBLE_BYTE_PAIR(0x0C, 0x000C)
+DOUBLE_BYTE_PAIR(0x0D, 0x000D)
+DOUBLE_BYTE_PAIR(0x0E, 0x000E)
+DOUBLE_BYTE_PAIR(0x0F, 0x000F)
+DOUBLE_BYTE_PAIR(0x10, 0x0010)
+DOUBLE_BYTE_PAIR(0x11, 0x0011)
+DOUBLE_BYTE_PAIR(0x12, 0x0012)
+DOUBLE_BYTE_PAIR(0x13, 0x0013)
+DOUBLE_BYTE_PAIR(0x14, 0x0014)
+DOUBLE_BYTE_PAIR(0x15, 0x0015)
+DOUBLE_BYTE_PAIR(0x16, 0x0016)
+DOUBLE_BYTE_PAIR(0x17, 0x0017)
+DOUBLE_BYTE_PAIR(0x18, 0x0018)
+DOUBLE_BYTE_PAIR(0x19, 0x0019)
+DOUBLE_BYTE_PAIR(0x1A, 0x001A)
+DOUBLE_BYTE_PAIR(0x1B, 0x001B)
+DOUBLE_BYTE_PAIR(0x1C, 0x001C)
+DOUBLE_BYTE_PAIR(0x1D, 0x001D)
+DOUBLE_BYTE_PAIR(0x1E, 0x001E)
+DOUBLE_BYTE_PAIR(0x1F, 0x001F)
+DOUBLE_BYTE_PAIR(0x20, 0x0020)
+DOUBLE_BYTE_PAIR(0x21, 0x0021)
+DOUBLE_BYTE_PAIR(0x22, 0x0022)
+DOUBLE_BYTE_PAIR(0x23, 0x0023)
+DOUBLE_BYTE_PAIR(0x24, 0x0024)
+DOUBLE_BYTE_PAIR(0x25, 0x0025)
+DOUBLE_BYTE_PAIR(0x26, 0x0026)
+DOUBLE_BYTE_PAIR(0x27, 0x0027)
+DOUBLE_BYTE_PAIR(0x28, 0x0028)
+DOUBLE_BYTE_PAIR(0x29, 0x0029)
+DOUBLE_BYTE_PAIR(0x2A, 0x002A)
+DOUBLE_BYTE_PAIR(0x2B, 0x002B)
+DOUBLE_BYTE_PAIR(0x2C, 0x002C)
+DOUBLE_BYTE_PAIR(0x2D, 0x002D)
+DOUBLE_BYTE_PAIR(0x2E, 0x002E)
+DOUBLE_BYTE_PAIR(0x2F, 0x002F)
+DOUBLE_BYTE_PAIR(0x30, 0x0030)
+DOUBLE_BYTE_PAIR(0x31, 0x0031)
+DOUBLE_BYTE_PAIR(0x32, 0x0032)
+DOUBLE_BYTE_PAIR(0x33, 0x0033)
+DOUBLE_BYTE_PAIR(0x34, 0x0034)
+DOUBLE_BYTE_PAIR(0x35, 0x0035)
+DOUBLE_BYTE_PAIR(0x36, 0x0036)
+DOUBLE_BYTE_PAIR(0x37, 0x0037)
+DOUBLE_BYTE_PAIR(0x38, 0x0038)
+DOUBLE_BYTE_PAIR(0x39, 0x0039)
+DOUBLE_BYTE_PAIR(0x3A, 0x003A)
+DOUBLE_BYTE_PAIR(0x3B, 0x003B)
+DOUBLE_BYTE_PAIR(0x3C, 0x003C)
+DOUBLE_BYTE_PAIR(0x3D, 0x003D)
+DOUBLE_BYTE_PAIR(0x3E, 0x003E)
+DOUBLE_BYTE_PAIR(0x3F, 0x003F)
+DOUBLE_BYTE_PAIR(0x40, 0x0040)
+DOUBLE_BYTE_PAIR(0x41, 0x0041)
+DOUBLE_BYTE_PAIR(0x42, 0x0042)
+DOUBLE_BYTE_PAIR(0x43, 0x0043)
+DOUBLE_BYTE_PAIR(0x44, 0x0044)
+DOUBLE_BYTE_PAIR(0x45, 0x0045)
+DOUBLE_BYTE_PAIR(0x46, 0x0046)
+DOUBLE_BYTE_PAIR(0x47, 0x0047)
+DOUBLE_BYTE_PAIR(0x48, 0x0048)
+DOUBLE_BYTE_PAIR(0x49, 0x0049)
+DOUBLE_BYTE_PAIR(0x4A, 0x004A)
+DOUBLE_BYTE_PAIR(0x4B, 0x004B)
+DOUBLE_BYTE_PAIR(0x4C, 0x004C)
+DOUBLE_BYTE_PAIR(0x4D, 0x004D)
+DOUBLE_BYTE_PAIR(0x4E, 0x004E)
+DOUBLE_BYTE_PAIR(0x4F, 0x004F)
+DOUBLE_BYTE_PAIR(0x50, 0x0050)
+DOUBLE_BYTE_PAIR(0x51, 0x0051)
+DOUBLE_BYTE_PAIR(0x52, 0x0052)
+DOUBLE_BYTE_PAIR(0x53, 0x0053)
+DOUBLE_BYTE_PAIR(0x54, 0x0054)
+DOUBLE_BYTE_PAIR(0x55, 0x0055)
+DOUBLE_BYTE_PAIR(0x56, 0x0056)
+DOUBLE_BYTE_PAIR(0x57, 0x0057)
+DOUBLE_BYTE_PAIR(0x58, 0x0058)
+DOUBLE_BYTE_PAIR(0x59, 0x0059)
+DOUBLE_BYTE_PAIR(0x5A, 0x005A)
+DOUBLE_BYTE_PAIR(0x5B, 0x005B)
+DOUBLE_BYTE_PAIR(0x5C, 0x005C)
+DOUBLE_BYTE_PAIR(0x5D, 0x005D)
+DOUBLE_BYTE_PAIR(0x5E, 0x005E)
+DOUBLE_BYTE_PAIR(0x5F, 0x005F)
+DOUBLE_BYTE_PAIR(0x60, 0x0060)
+DOUBLE_BYTE_PAIR(0x61, 0x0061)
+DOUBLE_BYTE_PAIR(0x62, 0x0062)
+DOUBLE_BYTE_PAIR(0x63, 0x0063)
+DOUBLE_BYTE_PAIR(0x64, 0x0064)
+DOUBLE_BYTE_PAIR(0x65, 0x0065)
+DOUBLE_BYTE_PAIR(0x66, 0x0066)
+DOUBLE_BYTE_PAIR(0x67, 0x0067)
+DOUBLE_BYTE_PAIR(0x68, 0x0068)
+DOUBLE_BYTE_PAIR(0x69, 0x0069)
+DOUBLE_BYTE_PAIR(0x6A, 0x006A)
+DOUBLE_BYTE_PAIR(0x6B, 0x006B)
+DOUBLE_BYTE_PAIR(0x6C, 0x006C)
+DOUBLE_BYTE_PAIR(0x6D, 0x006D)
+DOUBLE_BYTE_PAIR(0x6E, 0x006E)
+DOUBLE_BYTE_PAIR(0x6F, 0x006F)
+DOUBLE_BYTE_PAIR(0x70, 0x0070)
+DOUBLE_BYTE_PAIR(0x71, 0x0071)
+DOUBLE_BYTE_PAIR(0x72, 0x0072)
+DOUBLE_BYTE_PAIR(0x73, 0x0073)
+DOUBLE_BYTE_PAIR(0x74, 0x0074)
+DOUBLE_BYTE_PAIR(0x75, 0x0075)
+DOUBLE_BYTE_PAIR(0x76, 0x0076)
+DOUBLE_BYTE_PAIR(0x77, 0x0077)
+DOUBLE_BYTE_PAIR(0x78, 0x0078)
+DOUBLE_BYTE_PAIR(0x79, 0x0079)
+DOUBLE_BYTE_PAIR(0x7A, 0x007A)
+DOUBLE_BYTE_PAIR(0x7B, 0x007B)
+DOUBLE_BYTE_PAIR(0x7C, 0x007C)
+DOUBLE_BYTE_PAIR(0x7D, 0x007D)
+DOUBLE_BYTE_PAIR(0x7E, 0x007E)
+DOUBLE_BYTE_PAIR(0x7F, 0x007F)
+DOUBLE_BYTE_PAIR(0xA1, 0xFF61)
+DOUBLE_BYTE_PAIR(0xA2, 0xFF62)
+DOUBLE_BYTE_PAIR(0xA3, 0xFF63)
+DOUBLE_BYTE_PAIR(0xA4, 0xFF64)
+DOUBLE_BYTE_PAIR(0xA5, 0xFF65)
+DOUBLE_BYTE_PAIR(0xA6, 0xFF66)
+DOUBLE_BYTE_PAIR(0xA7, 0xFF67)
+DOUBLE_BYTE_PAIR(0xA8, 0xFF68)
+DOUBLE_BYTE_PAIR(0xA9, 0xFF69)
+DOUBLE_BYTE_PAIR(0xAA, 0xFF6A)
+DOUBLE_BYTE_PAIR(0xAB, 0xFF6B)
+DOUBLE_BYTE_PAIR(0xAC, 0xFF6C)
+DOUBLE_BYTE_PAIR(0xAD, 0xFF6D)
+DOUBLE_BYTE_PAIR(0xAE, 0xFF6E)
+DOUBLE_BYTE_PAIR(0xAF, 0xFF6F)
+DOUBLE_BYTE_PAIR(0xB0, 0xFF70)
+DOUBLE_BYTE_PAIR(0xB1, 0xFF71)
+DOUBLE_BYTE_PAIR(0xB2, 0xFF72)
+DOUBLE_BYTE_PAIR(0xB3, 0xFF73)
+DOUBLE_BYTE_PAIR(0xB4, 0xFF74)
+DOUBLE_BYTE_PAIR(0xB5, 0xFF75)
+DOUBLE_BYTE_PAIR(0xB6, 0xFF76)
+DOUBLE_BYTE_PAIR(0xB7, 0xFF77)
+DOUBLE_BYTE_PAIR(0xB8, 0xFF78)
+DOUBLE_BYTE_PAIR(0xB9, 0xFF79)
+DOUBLE_BYTE_PAIR(0xBA, 0xFF7A)
+DOUBLE_BYTE_PAIR(0xBB, 0xFF7B)
+DOUBLE_BYTE_PAIR(0xBC, 0xFF7C)
+DOUBLE_BYTE_PAIR(0xBD, 0xFF7D)
+DOUBLE_BYTE_PAIR(0xBE, 0xFF7E)
+DOUBLE_BYTE_PAIR(0xBF, 0xFF7F)
+DOUBLE_BYTE_PAIR(0xC0, 0xFF80)
+DOUBLE_BYTE_PAIR(0xC1, 0xFF81)
+DOUBLE_BYTE_PAIR(0xC2, 0xFF82)
+DOUBLE_BYTE_PAIR(0xC3, 0xFF83)
+DOUBLE_BYTE_PAIR(0xC4, 0xFF84)
+DOUBLE_BYTE_PAIR(0xC5, 0xFF85)
+DOUBLE_BYTE_PAIR(0xC6, 0xFF86)
+DOUBLE_BYTE_PAIR(0xC7, 0xFF87)
+DOUBLE_BYTE_PAIR(0xC8, 0xFF88)
+DOUBLE_BYTE_PAIR(0xC9, 0xFF89)
+DOUBLE_BYTE_PAIR(0xCA, 0xFF8A)
+DOUBLE_BYTE_PAIR(0xCB, 0xFF8B)
+DOUBLE_BYTE_PAIR(0xCC, 0xFF8C)
+DOUBLE_BYTE_PAIR(0xCD, 0xFF8D)
+DOUBLE_BYTE_PAIR(0xCE, 0xFF8E)
+DOUBLE_BYTE_PAIR(0xCF, 0xFF8F)
+DOUBLE_BYTE_PAIR(0xD0, 0xFF90)
+DOUBLE_BYTE_PAIR(0xD1, 0xFF91)
+DOUBLE_BYTE_PAIR(0xD2, 0xFF92)
+DOUBLE_BYTE_PAIR(0xD3, 0xFF93)
+DOUBLE_BYTE_PAIR(0xD4, 0xFF94)
+DOUBLE_BYTE_PAIR(0xD5, 0xFF95)
+DOUBLE_BYTE_PAIR(0xD6, 0xFF96)
+DOUBLE_BYTE_PAIR(0xD7, 0xFF97)
+DOUBLE_BYTE_PAIR(0xD8, 0xFF98)
+DOUBLE_BYTE_PAIR(0xD9, 0xFF99)
+DOUBLE_BYTE_PAIR(0xDA, 0xFF9A)
+DOUBLE_BYTE_PAIR(0xDB, 0xFF9B)
+DOUBLE_BYTE_PAIR(0xDC, 0xFF9C)
+DOUBLE_BYTE_PAIR(0xDD, 0xFF9D)
+DOUBLE_BYTE_PAIR(0xDE, 0xFF9E)
+DOUBLE_BYTE_PAIR(0xDF, 0xFF9F)
+DOUBLE_BYTE_PAIR(0x8140, 0x3000)
+DOUBLE_BYTE_PAIR(0x8141, 0x3001)
+DOUBLE_BYTE_PAIR(0x8142, 0x3002)
+DOUBLE_BYTE_PAIR(0x8143, 0xFF0C)
+DOUBLE_BYTE_PAIR(0x8144, 0xFF0E)
+DOUBLE_BYTE_PAIR(0x8145, 0x30FB)
+DOUBLE_BYTE_PAIR(0x8146, 0xFF1A)
+DOUBLE_BYTE_PAIR(0x8147, 0xFF1B)
+DOUBLE_BYTE_PAIR(0x8148, 0xFF1F)
+DOUBLE_BYTE_PAIR(0x8149, 0xFF01)
+DOUBLE_BYTE_PAIR(0x814A, 0x309B)
+DOUBLE_BYTE_PAIR(0x814B, 0x309C)
+DOUBLE_BYTE_PAIR(0x814C, 0x00B4)
+DOUBLE_BYTE_PAIR(0x814D, 0xFF40)
+DOUBLE_BYTE_PAIR(0x814E, 0x00A8)
+DOUBLE_BYTE_PAIR(0x814F, 0xFF3E)
+DOUBLE_BYTE_PAIR(0x8150, 0xFFE3)
+DOUBLE_BYTE_PAIR(0x8151, 0xFF3F)
+DOUBLE_BYTE_PAIR(0x8152, 0x30FD)
+DOUBLE_BYTE_PAIR(0x8153, 0x30FE)
+DOUBLE_BYTE_PAIR(0x8154, 0x309D)
+DOUBLE_BYTE_PAIR(0x8155, 0x309E)
+DOUBLE_BYTE_PAIR(0x8156, 0x3003)
+DOUBLE_BYTE_PAIR(0x8157, 0x4EDD)
+DOUBLE_BYTE_PAIR(0x8158, 0x3005)
+DOUBLE_BYTE_PAIR(0x8159, 0x3006)
+DOUBLE_BYTE_PAIR(0x815A, 0x3007)
+DOUBLE_BYTE_PAIR(0x815B, 0x30FC)
+DOUBLE_BYTE_PAIR(0x815C, 0x2015)
+DOUBLE_BYTE_PAIR(0x815D, 0x2010)
+DOUBLE_BYTE_PAIR(0x815E, 0xFF0F)
+DOUBLE_BYTE_PAIR(0x815F, 0xFF3C)
+DOUBLE_BYTE_PAIR(0x8160, 0xFF5E)
+DOUBLE_BYTE_PAIR(0x8161, 0x2225)
+DOUBLE_BYTE_PAIR(0x8162, 0xFF5C)
+DOUBLE_BYTE_PAIR(0x8163, 0x2026)
+DOUBLE_BYTE_PAIR(0x8164, 0x2025)
+DOUBLE_BYTE_PAIR(0x8165, 0x2018)
+DOUBLE_BYTE_PAIR(0x8166, 0x2019)
+DOUBLE_BYTE_PAIR(0x8167, 0x201C)
+DOUBLE_BYTE_PAIR(0x8168, 0x201D)
+DOUBLE_BYTE_PAIR(0x8169, 0xFF08)
+DOUBLE_BYTE_PAIR(0x816A, 0xFF09)
+DOUBLE_BYTE_PAIR(0x816B, 0x3014)
+DOUBLE_BYTE_PAIR(0x816C, 0x3015)
+DOUBLE_BYTE_PAIR(0x816D, 0xFF3B)
+DOUBLE_BYTE_PAIR(0x816E, 0xFF3D)
+DOUBLE_BYTE_PAIR(0x816F, 0xFF5B)
+DOUBLE_BYTE_PAIR(0x8170, 0xFF5D)
+DOUBLE_BYTE_PAIR(0x8171, 0x3008)
+DOUBLE_BYTE_PAIR(0x8172, 0x3009)
+DOUBLE_BYTE_PAIR(0x8173, 0x300A)
+DOUBLE_BYTE_PAIR(0x8174, 0x300B)
+DOUBLE_BYTE_PAIR(0x8175, 0x300C)
+DOUBLE_BYTE_PAIR(0x8176, 0x300D)
+DOUBLE_BYTE_PAIR(0x8177, 0x300E)
+DOUBLE_BYTE_PAIR(0x8178, 0x300F)
+DOUBLE_BYTE_PAIR(0x8179, 0x3010)
+DOUBLE_BYTE_PAIR(0x817A, 0x3011)
+DOUBLE_BYTE_PAIR(0x817B, 0xFF0B)
+DOUBLE_BYTE_PAIR(0x817C, 0xFF0D)
+DOUBLE_BYTE_PAIR(0x817D, 0x00B1)
+DOUBLE_BYTE_PAIR(0x817E, 0x00D7)
+DOUBLE_BYTE_PAIR(0x8180, 0x00F7)
+DOUBLE_BYTE_PAIR(0x8181, 0xFF1D)
+DOUBLE_BYTE_PAIR(0x8182, 0x2260)
+DOUBLE_BYTE_PAIR(0x8183, 0xFF1C)
+DOUBLE_BYTE_PAIR(0x8184, 0xFF1E)
+DOUBLE_BYTE_PAIR(0x8185, 0x2266)
+DOUBLE_BYTE_PAIR(0x8186, 0x2267)
+DOUBLE_BYTE_PAIR(0x8187, 0x221E)
+DOUBLE_BYTE_PAIR(0x8188, 0x2234)
+DOUBLE_BYTE_PAIR(0x8189, 0x2642)
+DOUBLE_BYTE_PAIR(0x818A, 0x2640)
+DOUBLE_BYTE_PAIR(0x818B, 0x00B0)
+DOUBLE_BYTE_PAIR(0x818C, 0x2032)
+DOUBLE_BYTE_PAIR(0x818D, 0x2033)
+DOUBLE_BYTE_PAIR(0x818E, 0x2103)
+DOUBLE_BYTE_PAIR(0x818F, 0xFFE5)
+DOUBLE_BYTE_PAIR(0x8190, 0xFF04)
+DOUBLE_BYTE_PAIR(0x8191, 0xFFE0)
+DOUBLE_BYTE_PAIR(0x8192, 0xFFE1)
+DOUBLE_BYTE_PAIR(0x8193, 0xFF05)
+DOUBLE_BYTE_PAIR(0x8194, 0xFF03)
+DOUBLE_BYTE_PAIR(0x8195, 0xFF06)
+DOUBLE_BYTE_PAIR(0x8196, 0xFF0A)
+DOUBLE_BYTE_PAIR(0x8197, 0xFF20)
+DOUBLE_BYTE_PAIR(0x8198, 0x00A7)
+DOUBLE_BYTE_PAIR(0x8199, 0x2606)
+DOUBLE_BYTE_PAIR(0x819A, 0x2605)
+DOUBLE_BYTE_PAIR(0x819B, 0x25CB)
+DOUBLE_BYTE_PAIR(0x819C, 0x25CF)
+DOUBLE_BYTE_PAIR(0x819D, 0x25CE)
+DOUBLE_BYTE_PAIR(0x819E, 0x25C7)
+DOUBLE_BYTE_PAIR(0x819F, 0x25C6)
+DOUBLE_BYTE_PAIR(0x81A0, 0x25A1)
+DOUBLE_BYTE_PAIR(0x81A1, 0x25A0)
+DOUBLE_BYTE_PAIR(0x81A2, 0x25B3)
+DOUBLE_BYTE_PAIR(0x81A3, 0x25B2)
+DOUBLE_BYTE_PAIR(0x81A4, 0x25BD)
+DOUBLE_BYTE_PAIR(0x81A5, 0x25BC)
+DOUBLE_BYTE_PAIR(0x81A6, 0x203B)
+DOUBLE_BYTE_PAIR(0x81A7, 0x3012)
+DOUBLE_BYTE_PAIR(0x81A8, 0x2192)
+DOUBLE_BYTE_PAIR(0x81A9, 0x2190)
+DOUBLE_BYTE_PAIR(0x81AA, 0x2191)
+DOUBLE_BYTE_PAIR(0x81AB, 0x2193)
+DOUBLE_BYTE_PAIR(0x81AC, 0x3013)
+DOUBLE_BYTE_PAIR(0x81B8, 0x2208)
+DOUBLE_BYTE_PAIR(0x81B9, 0x220B)
+DOUBLE_BYTE_PAIR(0x81BA, 0x2286)
+DOUBLE_BYTE_PAIR(0x81BB, 0x2287)
+DOUBLE_BYTE_PAIR(0x81BC, 0x2282)
+DOUBLE_BYTE_PAIR(0x81BD, 0x2283)
+DOUBLE_BYTE_PAIR(0x81BE, 0x222A)
+DOUBLE_BYTE_PAIR(0x81BF, 0x2229)
+DOUBLE_BYTE_PAIR(0x81C8, 0x2227)
+DOUBLE_BYTE_PAIR(0x81C9, 0x2228)
+DOUBLE_BYTE_PAIR(0x81CA, 0xFFE2)
+DOUBLE_BYTE_PAIR(0x81CB, 0x21D2)
+DOUBLE_BYTE_PAIR(0x81CC, 0x21D4)
+DOUBLE_BYTE_PAIR(0x81CD, 0x2200)
+DOUBLE_BYTE_PAIR(0x81CE, 0x2203)
+DOUBLE_BYTE_PAIR(0x81DA, 0x2220)
+DOUBLE_BYTE_PAIR(0x81DB, 0x22A5)
+DOUBLE_BYTE_PAIR(0x81DC, 0x2312)
+DOUBLE_BYTE_PAIR(0x81DD, 0x2202)
+DOUBLE_BYTE_PAIR(0x81DE, 0x2207)
+DOUBLE_BYTE_PAIR(0x81DF, 0x2261)
+DOUBLE_BYTE_PAIR(0x81E0, 0x2252)
+DOUBLE_BYTE_PAIR(0x81E1, 0x226A)
+DOUBLE_BYTE_PAIR(0x81E2, 0x226B)
+DOUBLE_BYTE_PAIR(0x81E3, 0x221A)
+DOUBLE_BYTE_PAIR(0x81E4, 0x223D)
+DOUBLE_BYTE_PAIR(0x81E5, 0x221D)
+DOUBLE_BYTE_PAIR(0x81E6, 0x2235)
+DOUBLE_BYTE_PAIR(0x81E7, 0x222B)
+DOUBLE_BYTE_PAIR(0x81E8, 0x222C)
+DOUBLE_BYTE_PAIR(0x81F0, 0x212B)
+DOUBLE_BYTE_PAIR(0x81F1, 0x2030)
+DOUBLE_BYTE_PAIR(0x81F2, 0x266F)
+DOUBLE_BYTE_PAIR(0x81F3, 0x266D)
+DOUBLE_BYTE_PAIR(0x81F4, 0x266A)
+DOUBLE_BYTE_PAIR(0x81F5, 0x2020)
+DOUBLE_BYTE_PAIR(0x81F6, 0x2021)
+DOUBLE_BYTE_PAIR(0x81F7, 0x00B6)
+DOUBLE_BYTE_PAIR(0x81FC, 0x25EF)
+DOUBLE_BYTE_PAIR(0x824F, 0xFF10)
+DOUBLE_BYTE_PAIR(0x8250, 0xFF11)
+DOUBLE_BYTE_PAIR(0x8251, 0xFF12)
+DOUBLE_BYTE_PAIR(0x8252, 0xFF13)
+DOUBLE_BYTE_PAIR(0x8253, 0xFF14)
+DOUBLE_BYTE_PAIR(0x8254, 0xFF15)
+DOUBLE_BYTE_PAIR(0x8255, 0xFF16)
+DOUBLE_BYTE_PAIR(0x8256, 0xFF17)
+DOUBLE_BYTE_PAIR(0x8257, 0xFF18)
+DOUBLE_BYTE_PAIR(0x8258, 0xFF19)
+DOUBLE_BYTE_PAIR(0x8260, 0xFF21)
+DOUBLE_BYTE_PAIR(0x8261, 0xFF22)
+DOUBLE_BYTE_PAIR(0x8262, 0xFF23)
+DOUBLE_BYTE_PAIR(0x8263, 0xFF24)
+DOUBLE_BYTE_PAIR(0x8264, 0xFF25)
+DOUBLE_BYTE_PAIR(0x8265, 0xFF26)
+DOUBLE_BYTE_PAIR(0x8266, 0xFF27)
+DOUBLE_BYTE_PAIR(0x8267, 0xFF28)
+DOUBLE_BYTE_PAIR(0x8268, 0xFF29)
+DOUBLE_BYTE_PAIR(0x8269, 0xFF2A)
+DOUBLE_BYTE_PAIR(0x826A, 0xFF2B)
+DOUBLE_BYTE_PAIR(0x826B, 0xFF2C)
+DOUBLE_BYTE_PAIR(0x826C, 0xFF2D)
+DOUBLE_BYTE_PAIR(0x826D, 0xFF2E)
+DOUBLE_BYTE_PAIR(0x826E, 0xFF2F)
+DOUBLE_BYTE_PAIR(0x826F, 0xFF30)
+DOUBLE_BYTE_PAIR(0x8270, 0xFF31)
+DOUBLE_BYTE_PAIR(0x8271, 0xFF32)
+DOUBLE_BYTE_PAIR(0x8272, 0xFF33)
+DOUBLE_BYTE_PAIR(0x8273, 0xFF34)
+DOUBLE_BYTE_PAIR(0x8274, 0xFF35)
+DOUBLE_BYTE_PAIR(0x8275, 0xFF36)
+DOUBLE_BYTE_PAIR(0x8276, 0xFF37)
+DOUBLE_BYTE_PAIR(0x8277, 0xFF38)
+DOUBLE_BYTE_PAIR(0x8278, 0xFF39)
+DOUBLE_BYTE_PAIR(0x8279, 0xFF3A)
+DOUBLE_BYTE_PAIR(0x8281, 0xFF41)
+DOUBLE_BYTE_PAIR(0x8282, 0xFF42)
+DOUBLE_BYTE_PAIR(0x8283, 0xFF43)
+DOUBLE_BYTE_PAIR(0x8284, 0xFF44)
+DOUBLE_BYTE_PAIR(0x8285, 0xFF45)
+DOUBLE_BYTE_PAIR(0x8286, 0xFF46)
+DOUBLE_BYTE_PAIR(0x8287, 0xFF47)
+DOUBLE_BYTE_PAIR(0x8288, 0xFF48)
+DOUBLE_BYTE_PAIR(0x8289, 0xFF49)
+DOUBLE_BYTE_PAIR(0x828A, 0xFF4A)
+DOUBLE_BYTE_PAIR(0x828B, 0xFF4B)
+DOUBLE_BYTE_PAIR(0x828C, 0xFF4C)
+DOUBLE_BYTE_PAIR(0x828D, 0xFF4D)
+DOUBLE_BYTE_PAIR(0x828E, 0xFF4E)
+DOUBLE_BYTE_PAIR(0x828F, 0xFF4F)
+DOUBLE_BYTE_PAIR(0x8290, 0xFF50)
+DOUBLE_BYTE_PAIR(0x8291, 0xFF51)
+DOUBLE_BYTE_PAIR(0x8292, 0xFF52)
+DOUBLE_BYTE_PAIR(0x8293, 0xFF53)
+DOUBLE_BYTE_PAIR(0x8294, 0xFF54)
+DOUBLE_BYTE_PAIR(0x8295, 0xFF55)
+DOUBLE_BYTE_PAIR(0x8296, 0xFF56)
+DOUBLE_BYTE_PAIR(0x8297, 0xFF57)
+DOUBLE_BYTE_PAIR(0x8298, 0xFF58)
+DOUBLE_BYTE_PAIR(0x8299, 0xFF59)
+DOUBLE_BYTE_PAIR(0x829A, 0xFF5A)
+DOUBLE_BYTE_PAIR(0x829F, 0x3041)
+DOUBLE_BYTE_PAIR(0x82A0, 0x3042)
+DOUBLE_BYTE_PAIR(0x82A1, 0x3043)
+DOUBLE_BYTE_PAIR(0x82A2, 0x3044)
+DOUBLE_BYTE_PAIR(0x82A3, 0x3045)
+DOUBLE_BYTE_PAIR(0x82A4, 0x3046)
+DOUBLE_BYTE_PAIR(0x82A5, 0x3047)
+DOUBLE_BYTE_PAIR(0x82A6, 0x3048)
+DOUBLE_BYTE_PAIR(0x82A7, 0x3049)
+DOUBLE_BYTE_PAIR(0x82A8, 0x304A)
+DOUBLE_BYTE_PAIR(0x82A9, 0x304B)
+DOUBLE_BYTE_PAIR(0x82AA, 0x304C)
+DOUBLE_BYTE_PAIR(0x82AB, 0x304D)
+DOUBLE_BYTE_PAIR(0x82AC, 0x304E)
+DOUBLE_BYTE_PAIR(0x82AD, 0x304F)
+DOUBLE_BYTE_PAIR(0x82AE, 0x3050)
+DOUBLE_BYTE_PAIR(0x82AF, 0x3051)
+DOUBLE_BYTE_PAIR(0x82B0, 0x3052)
+DOUBLE_BYTE_PAIR(0x82B1, 0x3053)
+DOUBLE_BYTE_PAIR(0x82B2, 0x3054)
+DOUBLE_BYTE_PAIR(0x82B3, 0x3055)
+DOUBLE_BYTE_PAIR(0x82B4, 0x3056)
+DOUBLE_BYTE_PAIR(0x82B5, 0x3057)
+DOUBLE_BYTE_PAIR(0x82B6, 0x3058)
+DOUBLE_BYTE_PAIR(0x82B7, 0x3059)
+DOUBLE_BYTE_PAIR(0x82B8, 0x305A)
+DOUBLE_BYTE_PAIR(0x82B9, 0x305B)
+DOUBLE_BYTE_PAIR(0x82BA, 0x305C)
+DOUBLE_BYTE_PAIR(0x82BB, 0x305D)
+DOUBLE_BYTE_PAIR(0x82BC, 0x305E)
+DOUBLE_BYTE_PAIR(0x82BD, 0x305F)
+DOUBLE_BYTE_PAIR(0x82BE, 0x3060)
+DOUBLE_BYTE_PAIR(0x82BF, 0x3061)
+DOUBLE_BYTE_PAIR(0x82C0, 0x3062)
+DOUBLE_BYTE_PAIR(0x82C1, 0x3063)
+DOUBLE_BYTE_PAIR(0x82C2, 0x3064)
+DOUBLE_BYTE_PAIR(0x82C3, 0x3065)
+DOUBLE_BYTE_PAIR(0x82C4, 0x3066)
+DOUBLE_BYTE_PAIR(0x82C5, 0x3067)
+DOUBLE_BYTE_PAIR(0x82C6, 0x3068)
+DOUBLE_BYTE_PAIR(0x82C7, 0x3069)
+DOUBLE_BYTE_PAIR(0x82C8, 0x306A)
+DOUBLE_BYTE_PAIR(0x82C9, 0x306B)
+DOUBLE_BYTE_PAIR(0x82CA, 0x306C)
+DOUBLE_BYTE_PAIR(0x82CB, 0x306D)
+DOUBLE_BYTE_PAIR(0x82CC, 0x306E)
+DOUBLE_BYTE_PAIR(0x82CD, 0x306F)
+DOUBLE_BYTE_PAIR(0x82CE, 0x3070)
+DOUBLE_BYTE_PAIR(0x82CF, 0x3071)
+DOUBLE_BYTE_PAIR(0x82D0, 0x3072)
+DOUBLE_BYTE_PAIR(0x82D1, 0x3073)
+DOUBLE_BYTE_PAIR(0x82D2, 0x3074)
+DOUBLE_BYTE_PAIR(0x82D3, 0x3075)
+DOUBLE_BYTE_PAIR(0x82D4, 0x3076)
+DOUBLE_BYTE_PAIR(0x82D5, 0x3077)
+DOUBLE_BYTE_PAIR(0x82D6, 0x3078)
+DOUBLE_BYTE_PAIR(0x82D7, 0x3079)
+DOUBLE_BYTE_PAIR(0x82D8, 0x307A)
+DOUBLE_BYTE_PAIR(0x82D9, 0x307B)
+DOUBLE_BYTE_PAIR(0x82DA, 0x307C)
+DOUBLE_BYTE_PAIR(0x82DB, 0x307D)
+DOUBLE_BYTE_PAIR(0x82DC, 0x307E)
+DOUBLE_BYTE_PAIR(0x82DD, 0x307F)
+DOUBLE_BYTE_PAIR(0x82DE, 0x3080)
+DOUBLE_BYTE_PAIR(0x82DF, 0x3081)
+DOUBLE_BYTE_PAIR(0x82E0, 0x3082)
+DOUBLE_BYTE_PAIR(0x82E1, 0x3083)
+DOUBLE_BYTE_PAIR(0x82E2, 0x3084)
+DOUBLE_BYTE_PAIR(0x82E3, 0x3085)
+DOUBLE_BYTE_PAIR(0x82E4, 0x3086)
+DOUBLE_BYTE_PAIR(0x82E5, 0x3087)
+DOUBLE_BYTE_PAIR(0x82E6, 0x3088)
+DOUBLE_BYTE_PAIR(0x82E7, 0x3089)
+DOUBLE_BYTE_PAIR(0x82E8, 0x308A)
+DOUBLE_BYTE_PAIR(0x82E9, 0x308B)
+DOUBLE_BYTE_PAIR(0x82EA, 0x308C)
+DOUBLE_BYTE_PAIR(0x82EB, 0x308D)
+DOUBLE_BYTE_PAIR(0x82EC, 0x308E)
+DOUBLE_BYTE_PAIR(0x82ED, 0x308F)
+DOUBLE_BYTE_PAIR(0x82EE, 0x3090)
+DOUBLE_BYTE_PAIR(0x82EF, 0x3091)
+DOUBLE_BYTE_PAIR(0x82F0, 0x3092)
+DOUBLE_BYTE_PAIR(0x82F1, 0x3093)
+DOUBLE_BYTE_PAIR(0x8340, 0x30A1)
+DOUBLE_BYTE_PAIR(0x8341, 0x30A2)
+DOUBLE_BYTE_PAIR(0x8342, 0x30A3)
+DOUBLE_BYTE_PAIR(0x8343, 0x30A4)
+DOUBLE_BYTE_PAIR(0x8344, 0x30A5)
+DOUBLE_BYTE_PAIR(0x8345, 0x30A6)
+DOUBLE_BYTE_PAIR(0x8346, 0x30A7)
+DOUBLE_BYTE_PAIR(0x8347, 0x30A8)
+DOUBLE_BYTE_PAIR(0x8348, 0x30A9)
+DOUBLE_BYTE_PAIR(0x8349, 0x30AA)
+DOUBLE_BYTE_PAIR(0x834A, 0x30AB)
+DOUBLE_BYTE_PAIR(0x834B, 0x30AC)
+DOUBLE_BYTE_PAIR(0x834C, 0x30AD)
+DOUBLE_BYTE_PAIR(0x834D, 0x30AE)
+DOUBLE_BYTE_PAIR(0x834E, 0x30AF)
+DOUBLE_BYTE_PAIR(0x834F, 0x30B0)
+DOUBLE_BYTE_PAIR(0x8350, 0x30B1)
+DOUBLE_BYTE_PAIR(0x8351, 0x30B2)
+DOUBLE_BYTE_PAIR(0x8352, 0x30B3)
+DOUBLE_BYTE_PAIR(0x8353, 0x30B4)
+DOUBLE_BYTE_PAIR(0x8354, 0x30B5)
+DOUBLE_BYTE_PAIR(0x8355, 0x30B6)
+DOUBLE_BYTE_PAIR(0x8356, 0x30B7)
+DOUBLE_BYTE_PAIR(0x8357, 0x30B8)
+DOUBLE_BYTE_PAIR(0x8358, 0x30B9)
+DOUBLE_BYTE_PAIR(0x8359, 0x30BA)
+DOUBLE_BYTE_PAIR(0x835A, 0x30BB)
+DOUBLE_BYTE_PAIR(0x835B, 0x30BC)
+DOUBLE_BYTE_PAIR(0x835C, 0x30BD)
+DOUBLE_BYTE_PAIR(0x835D, 0x30BE)
+DOUBLE_BYTE_PAIR(0x835E, 0x30BF)
+DOUBLE_BYTE_PAIR(0x835F, 0x30C0)
+DOUBLE_BYTE_PAIR(0x8360, 0x30C1)
+DOUBLE_BYTE_PAIR(0x8361, 0x30C2)
+DOUBLE_BYTE_PAIR(0x8362, 0x30C3)
+DOUBLE_BYTE_PAIR(0x8363, 0x30C4)
+DOUBLE_BYTE_PAIR(0x8364, 0x30C5)
+DOUBLE_BYTE_PAIR(0x8365, 0x30C6)
+DOUBLE_BYTE_PAIR(0x8366, 0x30C7)
+DOUBLE_BYTE_PAIR(0x8367, 0x30C8)
+DOUBLE_BYTE_PAIR(0x8368, 0x30C9)
+DOUBLE_BYTE_PAIR(0x8369, 0x30CA)
+DOUBLE_BYTE_PAIR(0x836A, 0x30CB)
+DOUBLE_BYTE_PAIR(0x836B, 0x30CC)
+DOUBLE_BYTE_PAIR(0x836C, 0x30CD)
+DOUBLE_BYTE_PAIR(0x836D, 0x30CE)
+DOUBLE_BYTE_PAIR(0x836E, 0x30CF)
+DOUBLE_BYTE_PAIR(0x836F, 0x30D0)
+DOUBLE_BYTE_PAIR(0x8370, 0x30D1)
+DOUBLE_BYTE_PAIR(0x8371, 0x30D2)
+DOUBLE_BYTE_PAIR(0x8372, 0x30D3)
+DOUBLE_BYTE_PAIR(0x8373, 0x30D4)
+DOUBLE_BYTE_PAIR(0x8374, 0x30D5)
+DOUBLE_BYTE_PAIR(0x8375, 0x30D6)
+DOUBLE_BYTE_PAIR(0x8376, 0x30D7)
+DOUBLE_BYTE_PAIR(0x8377, 0x30D8)
+DOUBLE_BYTE_PAIR(0x8378, 0x30D9)
+DOUBLE_BYTE_PAIR(0x8379, 0x30DA)
+DOUBLE_BYTE_PAIR(0x837A, 0x30DB)
+DOUBLE_BYTE_PAIR(0x837B, 0x30DC)
+DOUBLE_BYTE_PAIR(0x837C, 0x30DD)
+DOUBLE_BYTE_PAIR(0x837D, 0x30DE)
+DOUBLE_BYTE_PAIR(0x837E, 0x30DF)
+DOUBLE_BYTE_PAIR(0x8380, 0x30E0)
+DOUBLE_BYTE_PAIR(0x8381, 0x30E1)
+DOUBLE_BYTE_PAIR(0x8382, 0x30E2)
+DOUBLE_BYTE_PAIR(0x8383, 0x30E3)
+DOUBLE_BYTE_PAIR(0x8384, 0x30E4)
+DOUBLE_BYTE_PAIR(0x8385, 0x30E5)
+DOUBLE_BYTE_PAIR(0x8386, 0x30E6)
+DOUBLE_BYTE_PAIR(0x8387, 0x30E7)
+DOUBLE_BYTE_PAIR(0x8388, 0x30E8)
+DOUBLE_BYTE_PAIR(0x8389, 0x30E9)
+DOUBLE_BYTE_PAIR(0x838A, 0x30EA)
+DOUBLE_BYTE_PAIR(0x838B, 0x30EB)
+DOUBLE_BYTE_PAIR(0x838C, 0x30EC)
+DOUBLE_BYTE_PAIR(0x838D, 0x30ED)
+DOUBLE_BYTE_PAIR(0x838E, 0x30EE)
+DOUBLE_BYTE_PAIR(0x838F, 0x30EF)
+DOUBLE_BYTE_PAIR(0x8390, 0x30F0)
+DOUBLE_BYTE_PAIR(0x8391, 0x30F1)
+DOUBLE_BYTE_PAIR(0x8392, 0x30F2)
+DOUBLE_BYTE_PAIR(0x8393, 0x30F3)
+DOUBLE_BYTE_PAIR(0x8394, 0x30F4)
+DOUBLE_BYTE_PAIR(0x8395, 0x30F5)
+DOUBLE_BYTE_PAIR(0x8396, 0x30F6)
+DOUBLE_BYTE_PAIR(0x839F, 0x0391)
+DOUBLE_BYTE_PAIR(0x83A0, 0x0392)
+DOUBLE_BYTE_PAIR(0x83A1, 0x0393)
+DOUBLE_BYTE_PAIR(0x83A2, 0x0394)
+DOUBLE_BYTE_PAIR(0x83A3, 0x0395)
+DOUBLE_BYTE_PAIR(0x83A4, 0x0396)
+DOUBLE_BYTE_PAIR(0x83A5, 0x0397)
+DOUBLE_BYTE_PAIR(0x83A6, 0x0398)
+DOUBLE_BYTE_PAIR(0x83A7, 0x0399)
+DOUBLE_BYTE_PAIR(0x83A8, 0x039A)
+DOUBLE_BYTE_PAIR(0x83A9, 0x039B)
+DOUBLE_BYTE_PAIR(0x83AA, 0x039C)
+DOUBLE_BYTE_PAIR(0x83AB, 0x039D)
+DOUBLE_BYTE_PAIR(0x83AC, 0x039E)
+DOUBLE_BYTE_PAIR(0x83AD, 0x039F)
+DOUBLE_BYTE_PAIR(0x83AE, 0x03A0)
+DOUBLE_BYTE_PAIR(0x83AF, 0x03A1)
+DOUBLE_BYTE_PAIR(0x83B0, 0x03A3)
+DOUBLE_BYTE_PAIR(0x83B1, 0x03A4)
+DOUBLE_BYTE_PAIR(0x83B2, 0x03A5)
+DOUBLE_BYTE_PAIR(0x83B3, 0x03A6)
+DOUBLE_BYTE_PAIR(0x83B4, 0x03A7)
+DOUBLE_BYTE_PAIR(0x83B5, 0x03A8)
+DOUBLE_BYTE_PAIR(0x83B6, 0x03A9)
+DOUBLE_BYTE_PAIR(0x83BF, 0x03B1)
+DOUBLE_BYTE_PAIR(0x83C0, 0x03B2)
+DOUBLE_BYTE_PAIR(0x83C1, 0x03B3)
+DOUBLE_BYTE_PAIR(0x83C2, 0x03B4)
+DOUBLE_BYTE_PAIR(0x83C3, 0x03B5)
+DOUBLE_BYTE_PAIR(0x83C4, 0x03B6)
+DOUBLE_BYTE_PAIR(0x83C5, 0x03B7)
+DOUBLE_BYTE_PAIR(0x83C6, 0x03B8)
+DOUBLE_BYTE_PAIR(0x83C7, 0x03B9)
+DOUBLE_BYTE_PAIR(0x83C8, 0x03BA)
+DOUBLE_BYTE_PAIR(0x83C9, 0x03BB)
+DOUBLE_BYTE_PAIR(0x83CA, 0x03BC)
+DOUBLE_BYTE_PAIR(0x83CB, 0x03BD)
+DOUBLE_BYTE_PAIR(0x83CC, 0x03BE)
+DOUBLE_BYTE_PAIR(0x83CD, 0x03BF)
+DOUBLE_BYTE_PAIR(0x83CE, 0x03C0)
+DOUBLE_BYTE_PAIR(0x83CF, 0x03C1)
+DOUBLE_BYTE_PAIR(0x83D0, 0x03C3)
+DOUBLE_BYTE_PAIR(0x83D1, 0x03C4)
+DOUBLE_BYTE_PAIR(0x83D2, 0x03C5)
+DOUBLE_BYTE_PAIR(0x83D3, 0x03C6)
+DOUBLE_BYTE_PAIR(0x83D4, 0x03C7)
+DOUBLE_BYTE_PAIR(0x83D5, 0x03C8)
+DOUBLE_BYTE_PAIR(0x83D6, 0x03C9)
+DOUBLE_BYTE_PAIR(0x8440, 0x0410)
+DOUBLE_BYTE_PAIR(0x8441, 0x0411)
+DOUBLE_BYTE_PAIR(0x8442, 0x0412)
+DOUBLE_BYTE_PAIR(0x8443, 0x0413)
+DOUBLE_BYTE_PAIR(0x8444, 0x0414)
+DOUBLE_BYTE_PAIR(0x8445, 0x0415)
+DOUBLE_BYTE_PAIR(0x8446, 0x0401)
+DOUBLE_BYTE_PAIR(0x8447, 0x0416)
+DOUBLE_BYTE_PAIR(0x8448, 0x0417)
+DOUBLE_BYTE_PAIR(0x8449, 0x0418)
+DOUBLE_BYTE_PAIR(0x844A, 0x0419)
+DOUBLE_BYTE_PAIR(0x844B, 0x041A)
+DOUBLE_BYTE_PAIR(0x844C, 0x041B)
+DOUBLE_BYTE_PAIR(0x844D, 0x041C)
+DOUBLE_BYTE_PAIR(0x844E, 0x041D)
+DOUBLE_BYTE_PAIR(0x844F, 0x041E)
+DOUBLE_BYTE_PAIR(0x8450, 0x041F)
+DOUBLE_BYTE_PAIR(0x8451, 0x0420)
+DOUBLE_BYTE_PAIR(0x8452, 0x0421)
+DOUBLE_BYTE_PAIR(0x8453, 0x0422)
+DOUBLE_BYTE_PAIR(0x8454, 0x0423)
+DOUBLE_BYTE_PAIR(0x8455, 0x0424)
+DOUBLE_BYTE_PAIR(0x8456, 0x0425)
+DOUBLE_BYTE_PAIR(0x8457, 0x0426)
+DOUBLE_BYTE_PAIR(0x8458, 0x0427)
+DOUBLE_BYTE_PAIR(0x8459, 0x0428)
+DOUBLE_BYTE_PAIR(0x845A, 0x0429)
+DOUBLE_BYTE_PAIR(0x845B, 0x042A)
+DOUBLE_BYTE_PAIR(0x845C, 0x042B)
+DOUBLE_BYTE_PAIR(0x845D, 0x042C)
+DOUBLE_BYTE_PAIR(0x845E, 0x042D)
+DOUBLE_BYTE_PAIR(0x845F, 0x042E)
+DOUBLE_BYTE_PAIR(0x8460, 0x042F)
+DOUBLE_BYTE_PAIR(0x8470, 0x0430)
+DOUBLE_BYTE_PAIR(0x8471, 0x0431)
+DOUBLE_BYTE_PAIR(0x8472, 0x0432)
+DOUBLE_BYTE_PAIR(0x8473, 0x0433)
+DOUBLE_BYTE_PAIR(0x8474, 0x0434)
+DOUBLE_BYTE_PAIR(0x8475, 0x0435)
+DOUBLE_BYTE_PAIR(0x8476, 0x0451)
+DOUBLE_BYTE_PAIR(0x8477, 0x0436)
+DOUBLE_BYTE_PAIR(0x8478, 0x0437)
+DOUBLE_BYTE_PAIR(0x8479, 0x0438)
+DOUBLE_BYTE_PAIR(0x847A, 0x0439)
+DOUBLE_BYTE_PAIR(0x847B, 0x043A)
+DOUBLE_BYTE_PAIR(0x847C, 0x043B)
+DOUBLE_BYTE_PAIR(0x847D, 0x043C)
+DOUBLE_BYTE_PAIR(0x847E, 0x043D)
+DOUBLE_BYTE_PAIR(0x8480, 0x043E)
+DOUBLE_BYTE_PAIR(0x8481, 0x043F)
+DOUBLE_BYTE_PAIR(0x8482, 0x0440)
+DOUBLE_BYTE_PAIR(0x8483, 0x0441)
+DOUBLE_BYTE_PAIR(0x8484, 0x0442)
+DOUBLE_BYTE_PAIR(0x8485, 0x0443)
+DOUBLE_BYTE_PAIR(0x8486, 0x0444)
+DOUBLE_BYTE_PAIR(0x8487, 0x0445)
+DOUBLE_BYTE_PAIR(0x8488, 0x0446)
+DOUBLE_BYTE_PAIR(0x8489, 0x0447)
+DOUBLE_BYTE_PAIR(0x848A, 0x0448)
+DOUBLE_BYTE_PAIR(0x848B, 0x0449)
+DOUBLE_BYTE_PAIR(0x848C, 0x044A)
+DOUBLE_BYTE_PAIR(0x848D, 0x044B)
+DOUBLE_BYTE_PAIR(0x848E, 0x044C)
+DOUBLE_BYTE_PAIR(0x848F, 0x044D)
+DOUBLE_BYTE_PAIR(0x8490, 0x044E)
+DOUBLE_BYTE_PAIR(0x8491, 0x044F)
+DOUBLE_BYTE_PAIR(0x849F, 0x2500)
+DOUBLE_BYTE_PAIR(0x84A0, 0x2502)
+DOUBLE_BYTE_PAIR(0x84A1, 0x250C)
+DOUBLE_BYTE_PAIR(0x84A2, 0x2510)
+DOUBLE_BYTE_PAIR(0x84A3, 0x2518)
+DOUBLE_BYTE_PAIR(0x84A4, 0x2514)
+DOUBLE_BYTE_PAIR(0x84A5, 0x251C)
+DOUBLE_BYTE_PAIR(0x84A6, 0x252C)
+DOUBLE_BYTE_PAIR(0x84A7, 0x2524)
+DOUBLE_BYTE_PAIR(0x84A8, 0x2534)
+DOUBLE_BYTE_PAIR(0x84A9, 0x253C)
+DOUBLE_BYTE_PAIR(0x84AA, 0x2501)
+DOUBLE_BYTE_PAIR(0x84AB, 0x2503)
+DOUBLE_BYTE_PAIR(0x84AC, 0x250F)
+DOUBLE_BYTE_PAIR(0x84AD, 0x2513)
+DOUBLE_BYTE_PAIR(0x84AE, 0x251B)
+DOUBLE_BYTE_PAIR(0x84AF, 0x2517)
+DOUBLE_BYTE_PAIR(0x84B0, 0x2523)
+DOUBLE_BYTE_PAIR(0x84B1, 0x2533)
+DOUBLE_BYTE_PAIR(0x84B2, 0x252B)
+DOUBLE_BYTE_PAIR(0x84B3, 0x253B)
+DOUBLE_BYTE_PAIR(0x84B4, 0x254B)
+DOUBLE_BYTE_PAIR(0x84B5, 0x2520)
+DOUBLE_BYTE_PAIR(0x84B6, 0x252F)
+DOUBLE_BYTE_PAIR(0x84B7, 0x2528)
+DOUBLE_BYTE_PAIR(0x84B8, 0x2537)
+DOUBLE_BYTE_PAIR(0x84B9, 0x253F)
+DOUBLE_BYTE_PAIR(0x84BA, 0x251D)
+DOUBLE_BYTE_PAIR(0x84BB, 0x2530)
+DOUBLE_BYTE_PAIR(0x84BC, 0x2525)
+DOUBLE_BYTE_PAIR(0x84BD, 0x2538)
+DOUBLE_BYTE_PAIR(0x84BE, 0x2542)
+DOUBLE_BYTE_PAIR(0x8740, 0x2460)
+DOUBLE_BYTE_PAIR(0x8741, 0x2461)
+DOUBLE_BYTE_PAIR(0x8742, 0x2462)
+DOUBLE_BYTE_PAIR(0x8743, 0x2463)
+DOUBLE_BYTE_PAIR(0x8744, 0x2464)
+DOUBLE_BYTE_PAIR(0x8745, 0x2465)
+DOUBLE_BYTE_PAIR(0x8746, 0x2466)
+DOUBLE_BYTE_PAIR(0x8747, 0x2467)
+DOUBLE_BYTE_PAIR(0x8748, 0x2468)
+DOUBLE_BYTE_PAIR(0x8749, 0x2469)
+DOUBLE_BYTE_PAIR(0x874A, 0x246A)
+DOUBLE_BYTE_PAIR(0x874B, 0x246B)
+DOUBLE_BYTE_PAIR(0x874C, 0x246C)
+DOUBLE_BYTE_PAIR(0x874D, 0x246D)
+DOUBLE_BYTE_PAIR(0x874E, 0x246E)
+DOUBLE_BYTE_PAIR(0x874F, 0x246F)
+DOUBLE_BYTE_PAIR(0x8750, 0x2470)
+DOUBLE_BYTE_PAIR(0x8751, 0x2471)
+DOUBLE_BYTE_PAIR(0x8752, 0x2472)
+DOUBLE_BYTE_PAIR(0x8753, 0x2473)
+DOUBLE_BYTE_PAIR(0x8754, 0x2160)
+DOUBLE_BYTE_PAIR(0x8755, 0x2161)
+DOUBLE_BYTE_PAIR(0x8756, 0x2162)
+DOUBLE_BYTE_PAIR(0x8757, 0x2163)
+DOUBLE_BYTE_PAIR(0x8758, 0x2164)
+DOUBLE_BYTE_PAIR(0x8759, 0x2165)
+DOUBLE_BYTE_PAIR(0x875A, 0x2166)
+DOUBLE_BYTE_PAIR(0x875B, 0x2167)
+DOUBLE_BYTE_PAIR(0x875C, 0x2168)
+DOUBLE_BYTE_PAIR(0x875D, 0x2169)
+DOUBLE_BYTE_PAIR(0x875F, 0x3349)
+DOUBLE_BYTE_PAIR(0x8760, 0x3314)
+DOUBLE_BYTE_PAIR(0x8761, 0x3322)
+DOUBLE_BYTE_PAIR(0x8762, 0x334D)
+DOUBLE_BYTE_PAIR(0x8763, 0x3318)
+DOUBLE_BYTE_PAIR(0x8764, 0x3327)
+DOUBLE_BYTE_PAIR(0x8765, 0x3303)
+DOUBLE_BYTE_PAIR(0x8766, 0x3336)
+DOUBLE_BYTE_PAIR(0x8767, 0x3351)
+DOUBLE_BYTE_PAIR(0x8768, 0x3357)
+DOUBLE_BYTE_PAIR(0x8769, 0x330D)
+DOUBLE_BYTE_PAIR(0x876A, 0x3326)
+DOUBLE_BYTE_PAIR(0x876B, 0x3323)
+DOUBLE_BYTE_PAIR(0x876C, 0x332B)
+DOUBLE_BYTE_PAIR(0x876D, 0x334A)
+DOUBLE_BYTE_PAIR(0x876E, 0x333B)
+DOUBLE_BYTE_PAIR(0x876F, 0x339C)
+DOUBLE_BYTE_PAIR(0x8770, 0x339D)
+DOUBLE_BYTE_PAIR(0x8771, 0x339E)
+DOUBLE_BYTE_PAIR(0x8772, 0x338E)
+DOUBLE_BYTE_PAIR(0x8773, 0x338F)
+DOUBLE_BYTE_PAIR(0x8774, 0x33C4)
+DOUBLE_BYTE_PAIR(0x8775, 0x33A1)
+DOUBLE_BYTE_PAIR(0x877E, 0x337B)
+DOUBLE_BYTE_PAIR(0x8780, 0x301D)
+DOUBLE_BYTE_PAIR(0x8781, 0x301F)
+DOUBLE_BYTE_PAIR(0x8782, 0x2116)
+DOUBLE_BYTE_PAIR(0x8783, 0x33CD)
+DOUBLE_BYTE_PAIR(0x8784, 0x2121)
+DOUBLE_BYTE_PAIR(0x8785, 0x32A4)
+DOUBLE_BYTE_PAIR(0x8786, 0x32A5)
+DOUBLE_BYTE_PAIR(0x8787, 0x32A6)
+DOUBLE_BYTE_PAIR(0x8788, 0x32A7)
+DOUBLE_BYTE_PAIR(0x8789, 0x32A8)
+DOUBLE_BYTE_PAIR(0x878A, 0x3231)
+DOUBLE_BYTE_PAIR(0x878B, 0x3232)
+DOUBLE_BYTE_PAIR(0x878C, 0x3239)
+DOUBLE_BYTE_PAIR(0x878D, 0x337E)
+DOUBLE_BYTE_PAIR(0x878E, 0x337D)
+DOUBLE_BYTE_PAIR(0x878F, 0x337C)
+DOUBLE_BYTE_PAIR(0x8790, 0x2252)
+DOUBLE_BYTE_PAIR(0x8791, 0x2261)
+DOUBLE_BYTE_PAIR(0x8792, 0x222B)
+DOUBLE_BYTE_PAIR(0x8793, 0x222E)
+DOUBLE_BYTE_PAIR(0x8794, 0x2211)
+DOUBLE_BYTE_PAIR(0x8795, 0x221A)
+DOUBLE_BYTE_PAIR(0x8796, 0x22A5)
+DOUBLE_BYTE_PAIR(0x8797, 0x2220)
+DOUBLE_BYTE_PAIR(0x8798, 0x221F)
+DOUBLE_BYTE_PAIR(0x8799, 0x22BF)
+DOUBLE_BYTE_PAIR(0x879A, 0x2235)
+DOUBLE_BYTE_PAIR(0x879B, 0x2229)
+DOUBLE_BYTE_PAIR(0x879C, 0x222A)
+DOUBLE_BYTE_PAIR(0x889F, 0x4E9C)
+DOUBLE_BYTE_PAIR(0x88A0, 0x5516)
+DOUBLE_BYTE_PAIR(0x88A1, 0x5A03)
+DOUBLE_BYTE_PAIR(0x88A2, 0x963F)
+DOUBLE_BYTE_PAIR(0x88A3, 0x54C0)
+DOUBLE_BYTE_PAIR(0x88A4, 0x611B)
+DOUBLE_BYTE_PAIR(0x88A5, 0x6328)
+DOUBLE_BYTE_PAIR(0x88A6, 0x59F6)
+DOUBLE_BYTE_PAIR(0x88A7, 0x9022)
+DOUBLE_BYTE_PAIR(0x88A8, 0x8475)
+DOUBLE_BYTE_PAIR(0x88A9, 0x831C)
+DOUBLE_BYTE_PAIR(0x88AA, 0x7A50)
+DOUBLE_BYTE_PAIR(0x88AB, 0x60AA)
+DOUBLE_BYTE_PAIR(0x88AC, 0x63E1)
+DOUBLE_BYTE_PAIR(0x88AD, 0x6E25)
+DOUBLE_BYTE_PAIR(0x88AE, 0x65ED)
+DOUBLE_BYTE_PAIR(0x88AF, 0x8466)
+DOUBLE_BYTE_PAIR(0x88B0, 0x82A6)
+DOUBLE_BYTE_PAIR(0x88B1, 0x9BF5)
+DOUBLE_BYTE_PAIR(0x88B2, 0x6893)
+DOUBLE_BYTE_PAIR(0x88B3, 0x5727)
+DOUBLE_BYTE_PAIR(0x88B4, 0x65A1)
+DOUBLE_BYTE_PAIR(0x88B5, 0x6271)
+DOUBLE_BYTE_PAIR(0x88B6, 0x5B9B)
+DOUBLE_BYTE_PAIR(0x88B7, 0x59D0)
+DOUBLE_BYTE_PAIR(0x88B8, 0x867B)
+DOUBLE_BYTE_PAIR(0x88B9, 0x98F4)
+DOUBLE_BYTE_PAIR(0x88BA, 0x7D62)
+DOUBLE_BYTE_PAIR(0x88BB, 0x7DBE)
+DOUBLE_BYTE_PAIR(0x88BC, 0x9B8E)
+DOUBLE_BYTE_PAIR(0x88BD, 0x6216)
+DOUBLE_BYTE_PAIR(0x88BE, 0x7C9F)
+DOUBLE_BYTE_PAIR(0x88BF, 0x88B7)
+DOUBLE_BYTE_PAIR(0x88C0, 0x5B89)
+DOUBLE_BYTE_PAIR(0x88C1, 0x5EB5)
+DOUBLE_BYTE_PAIR(0x88C2, 0x6309)
+DOUBLE_BYTE_PAIR(0x88C3, 0x6697)
+DOUBLE_BYTE_PAIR(0x88C4, 0x6848)
+DOUBLE_BYTE_PAIR(0x88C5, 0x95C7)
+DOUBLE_BYTE_PAIR(0x88C6, 0x978D)
+DOUBLE_BYTE_PAIR(0x88C7, 0x674F)
+DOUBLE_BYTE_PAIR(0x88C8, 0x4EE5)
+DOUBLE_BYTE_PAIR(0x88C9, 0x4F0A)
+DOUBLE_BYTE_PAIR(0x88CA, 0x4F4D)
+DOUBLE_BYTE_PAIR(0x88CB, 0x4F9D)
+DOUBLE_BYTE_PAIR(0x88CC, 0x5049)
+DOUBLE_BYTE_PAIR(0x88CD, 0x56F2)
+DOUBLE_BYTE_PAIR(0x88CE, 0x5937)
+DOUBLE_BYTE_PAIR(0x88CF, 0x59D4)
+DOUBLE_BYTE_PAIR(0x88D0, 0x5A01)
+DOUBLE_BYTE_PAIR(0x88D1, 0x5C09)
+DOUBLE_BYTE_PAIR(0x88D2, 0x60DF)
+DOUBLE_BYTE_PAIR(0x88D3, 0x610F)
+DOUBLE_BYTE_PAIR(0x88D4, 0x6170)
+DOUBLE_BYTE_PAIR(0x88D5, 0x6613)
+DOUBLE_BYTE_PAIR(0x88D6, 0x6905)
+DOUBLE_BYTE_PAIR(0x88D7, 0x70BA)
+DOUBLE_BYTE_PAIR(0x88D8, 0x754F)
+DOUBLE_BYTE_PAIR(0x88D9, 0x7570)
+DOUBLE_BYTE_PAIR(0x88DA, 0x79FB)
+DOUBLE_BYTE_PAIR(0x88DB, 0x7DAD)
+DOUBLE_BYTE_PAIR(0x88DC, 0x7DEF)
+DOUBLE_BYTE_PAIR(0x88DD, 0x80C3)
+DOUBLE_BYTE_PAIR(0x88DE, 0x840E)
+DOUBLE_BYTE_PAIR(0x88DF, 0x8863)
+DOUBLE_BYTE_PAIR(0x88E0, 0x8B02)
+DOUBLE_BYTE_PAIR(0x88E1, 0x9055)
+DOUBLE_BYTE_PAIR(0x88E2, 0x907A)
+DOUBLE_BYTE_PAIR(0x88E3, 0x533B)
+DOUBLE_BYTE_PAIR(0x88E4, 0x4E95)
+DOUBLE_BYTE_PAIR(0x88E5, 0x4EA5)
+DOUBLE_BYTE_PAIR(0x88E6, 0x57DF)
+DOUBLE_BYTE_PAIR(0x88E7, 0x80B2)
+DOUBLE_BYTE_PAIR(0x88E8, 0x90C1)
+DOUBLE_BYTE_PAIR(0x88E9, 0x78EF)
+DOUBLE_BYTE_PAIR(0x88EA, 0x4E00)
+DOUBLE_BYTE_PAIR(0x88EB, 0x58F1)
+DOUBLE_BYTE_PAIR(0x88EC, 0x6EA2)
+DOUBLE_BYTE_PAIR(0x88ED, 0x9038)
+DOUBLE_BYTE_PAIR(0x88EE, 0x7A32)
+DOUBLE_BYTE_PAIR(0x88EF, 0x8328)
+DOUBLE_BYTE_PAIR(0x88F0, 0x828B)
+DOUBLE_BYTE_PAIR(0x88F1, 0x9C2F)
+DOUBLE_BYTE_PAIR(0x88F2, 0x5141)
+DOUBLE_BYTE_PAIR(0x88F3, 0x5370)
+DOUBLE_BYTE_PAIR(0x88F4, 0x54BD)
+DOUBLE_BYTE_PAIR(0x88F5, 0x54E1)
+DOUBLE_BYTE_PAIR(0x88F6, 0x56E0)
+DOUBLE_BYTE_PAIR(0x88F7, 0x59FB)
+DOUBLE_BYTE_PAIR(0x88F8, 0x5F15)
+DOUBLE_BYTE_PAIR(0x88F9, 0x98F2)
+DOUBLE_BYTE_PAIR(0x88FA, 0x6DEB)
+DOUBLE_BYTE_PAIR(0x88FB, 0x80E4)
+DOUBLE_BYTE_PAIR(0x88FC, 0x852D)
+DOUBLE_BYTE_PAIR(0x8940, 0x9662)
+DOUBLE_BYTE_PAIR(0x8941, 0x9670)
+DOUBLE_BYTE_PAIR(0x8942, 0x96A0)
+DOUBLE_BYTE_PAIR(0x8943, 0x97FB)
+DOUBLE_BYTE_PAIR(0x8944, 0x540B)
+DOUBLE_BYTE_PAIR(0x8945, 0x53F3)
+DOUBLE_BYTE_PAIR(0x8946, 0x5B87)
+DOUBLE_BYTE_PAIR(0x8947, 0x70CF)
+DOUBLE_BYTE_PAIR(0x8948, 0x7FBD)
+DOUBLE_BYTE_PAIR(0x8949, 0x8FC2)
+DOUBLE_BYTE_PAIR(0x894A, 0x96E8)
+DOUBLE_BYTE_PAIR(0x894B, 0x536F)
+DOUBLE_BYTE_PAIR(0x894C, 0x9D5C)
+DOUBLE_BYTE_PAIR(0x894D, 0x7ABA)
+DOUBLE_BYTE_PAIR(0x894E, 0x4E11)
+DOUBLE_BYTE_PAIR(0x894F, 0x7893)
+DOUBLE_BYTE_PAIR(0x8950, 0x81FC)
+DOUBLE_BYTE_PAIR(0x8951, 0x6E26)
+DOUBLE_BYTE_PAIR(0x8952, 0x5618)
+DOUBLE_BYTE_PAIR(0x8953, 0x5504)
+DOUBLE_BYTE_PAIR(0x8954, 0x6B1D)
+DOUBLE_BYTE_PAIR(0x8955, 0x851A)
+DOUBLE_BYTE_PAIR(0x8956, 0x9C3B)
+DOUBLE_BYTE_PAIR(0x8957, 0x59E5)
+DOUBLE_BYTE_PAIR(0x8958, 0x53A9)
+DOUBLE_BYTE_PAIR(0x8959, 0x6D66)
+DOUBLE_BYTE_PAIR(0x895A, 0x74DC)
+DOUBLE_BYTE_PAIR(0x895B, 0x958F)
+DOUBLE_BYTE_PAIR(0x895C, 0x5642)
+DOUBLE_BYTE_PAIR(0x895D, 0x4E91)
+DOUBLE_BYTE_PAIR(0x895E, 0x904B)
+DOUBLE_BYTE_PAIR(0x895F, 0x96F2)
+DOUBLE_BYTE_PAIR(0x8960, 0x834F)
+DOUBLE_BYTE_PAIR(0x8961, 0x990C)
+DOUBLE_BYTE_PAIR(0x8962, 0x53E1)
+DOUBLE_BYTE_PAIR(0x8963, 0x55B6)
+DOUBLE_BYTE_PAIR(0x8964, 0x5B30)
+DOUBLE_BYTE_PAIR(0x8965, 0x5F71)
+DOUBLE_BYTE_PAIR(0x8966, 0x6620)
+DOUBLE_BYTE_PAIR(0x8967, 0x66F3)
+DOUBLE_BYTE_PAIR(0x8968, 0x6804)
+DOUBLE_BYTE_PAIR(0x8969, 0x6C38)
+DOUBLE_BYTE_PAIR(0x896A, 0x6CF3)
+DOUBLE_BYTE_PAIR(0x896B, 0x6D29)
+DOUBLE_BYTE_PAIR(0x896C, 0x745B)
+DOUBLE_BYTE_PAIR(0x896D, 0x76C8)
+DOUBLE_BYTE_PAIR(0x896E, 0x7A4E)
+DOUBLE_BYTE_PAIR(0x896F, 0x9834)
+DOUBLE_BYTE_PAIR(0x8970, 0x82F1)
+DOUBLE_BYTE_PAIR(0x8971, 0x885B)
+DOUBLE_BYTE_PAIR(0x8972, 0x8A60)
+DOUBLE_BYTE_PAIR(0x8973, 0x92ED)
+DOUBLE_BYTE_PAIR(0x8974, 0x6DB2)
+DOUBLE_BYTE_PAIR(0x8975, 0x75AB)
+DOUBLE_BYTE_PAIR(0x8976, 0x76CA)
+DOUBLE_BYTE_PAIR(0x8977, 0x99C5)
+DOUBLE_BYTE_PAIR(0x8978, 0x60A6)
+DOUBLE_BYTE_PAIR(0x8979, 0x8B01)
+DOUBLE_BYTE_PAIR(0x897A, 0x8D8A)
+DOUBLE_BYTE_PAIR(0x897B, 0x95B2)
+DOUBLE_BYTE_PAIR(0x897C, 0x698E)
+DOUBLE_BYTE_PAIR(0x897D, 0x53AD)
+DOUBLE_BYTE_PAIR(0x897E, 0x5186)
+DOUBLE_BYTE_PAIR(0x8980, 0x5712)
+DOUBLE_BYTE_PAIR(0x8981, 0x5830)
+DOUBLE_BYTE_PAIR(0x8982, 0x5944)
+DOUBLE_BYTE_PAIR(0x8983, 0x5BB4)
+DOUBLE_BYTE_PAIR(0x8984, 0x5EF6)
+DOUBLE_BYTE_PAIR(0x8985, 0x6028)
+DOUBLE_BYTE_PAIR(0x8986, 0x63A9)
+DOUBLE_BYTE_PAIR(0x8987, 0x63F4)
+DOUBLE_BYTE_PAIR(0x8988, 0x6CBF)
+DOUBLE_BYTE_PAIR(0x8989, 0x6F14)
+DOUBLE_BYTE_PAIR(0x898A, 0x708E)
+DOUBLE_BYTE_PAIR(0x898B, 0x7114)
+DOUBLE_BYTE_PAIR(0x898C, 0x7159)
+DOUBLE_BYTE_PAIR(0x898D, 0x71D5)
+DOUBLE_BYTE_PAIR(0x898E, 0x733F)
+DOUBLE_BYTE_PAIR(0x898F, 0x7E01)
+DOUBLE_BYTE_PAIR(0x8990, 0x8276)
+DOUBLE_BYTE_PAIR(0x8991, 0x82D1)
+DOUBLE_BYTE_PAIR(0x8992, 0x8597)
+DOUBLE_BYTE_PAIR(0x8993, 0x9060)
+DOUBLE_BYTE_PAIR(0x8994, 0x925B)
+DOUBLE_BYTE_PAIR(0x8995, 0x9D1B)
+DOUBLE_BYTE_PAIR(0x8996, 0x5869)
+DOUBLE_BYTE_PAIR(0x8997, 0x65BC)
+DOUBLE_BYTE_PAIR(0x8998, 0x6C5A)
+DOUBLE_BYTE_PAIR(0x8999, 0x7525)
+DOUBLE_BYTE_PAIR(0x899A, 0x51F9)
+DOUBLE_BYTE_PAIR(0x899B, 0x592E)
+DOUBLE_BYTE_PAIR(0x899C, 0x5965)
+DOUBLE_BYTE_PAIR(0x899D, 0x5F80)
+DOUBLE_BYTE_PAIR(0x899E, 0x5FDC)
+DOUBLE_BYTE_PAIR(0x899F, 0x62BC)
+DOUBLE_BYTE_PAIR(0x89A0, 0x65FA)
+DOUBLE_BYTE_PAIR(0x89A1, 0x6A2A)
+DOUBLE_BYTE_PAIR(0x89A2, 0x6B27)
+DOUBLE_BYTE_PAIR(0x89A3, 0x6BB4)
+DOUBLE_BYTE_PAIR(0x89A4, 0x738B)
+DOUBLE_BYTE_PAIR(0x89A5, 0x7FC1)
+DOUBLE_BYTE_PAIR(0x89A6, 0x8956)
+DOUBLE_BYTE_PAIR(0x89A7, 0x9D2C)
+DOUBLE_BYTE_PAIR(0x89A8, 0x9D0E)
+DOUBLE_BYTE_PAIR(0x89A9, 0x9EC4)
+DOUBLE_BYTE_PAIR(0x89AA, 0x5CA1)
+DOUBLE_BYTE_PAIR(0x89AB, 0x6C96)
+DOUBLE_BYTE_PAIR(0x89AC, 0x837B)
+DOUBLE_BYTE_PAIR(0x89AD, 0x5104)
+DOUBLE_BYTE_PAIR(0x89AE, 0x5C4B)
+DOUBLE_BYTE_PAIR(0x89AF, 0x61B6)
+DOUBLE_BYTE_PAIR(0x89B0, 0x81C6)
+DOUBLE_BYTE_PAIR(0x89B1, 0x6876)
+DOUBLE_BYTE_PAIR(0x89B2, 0x7261)
+DOUBLE_BYTE_PAIR(0x89B3, 0x4E59)
+DOUBLE_BYTE_PAIR(0x89B4, 0x4FFA)
+DOUBLE_BYTE_PAIR(0x89B5, 0x5378)
+DOUBLE_BYTE_PAIR(0x89B6, 0x6069)
+DOUBLE_BYTE_PAIR(0x89B7, 0x6E29)
+DOUBLE_BYTE_PAIR(0x89B8, 0x7A4F)
+DOUBLE_BYTE_PAIR(0x89B9, 0x97F3)
+DOUBLE_BYTE_PAIR(0x89BA, 0x4E0B)
+DOUBLE_BYTE_PAIR(0x89BB, 0x5316)
+DOUBLE_BYTE_PAIR(0x89BC, 0x4EEE)
+DOUBLE_BYTE_PAIR(0x89BD, 0x4F55)
+DOUBLE_BYTE_PAIR(0x89BE, 0x4F3D)
+DOUBLE_BYTE_PAIR(0x89BF, 0x4FA1)
+DOUBLE_BYTE_PAIR(0x89C0, 0x4F73)
+DOUBLE_BYTE_PAIR(0x89C1, 0x52A0)
+DOUBLE_BYTE_PAIR(0x89C2, 0x53EF)
+DOUBLE_BYTE_PAIR(0x89C3, 0x5609)
+DOUBLE_BYTE_PAIR(0x89C4, 0x590F)
+DOUBLE_BYTE_PAIR(0x89C5, 0x5AC1)
+DOUBLE_BYTE_PAIR(0x89C6, 0x5BB6)
+DOUBLE_BYTE_PAIR(0x89C7, 0x5BE1)
+DOUBLE_BYTE_PAIR(0x89C8, 0x79D1)
+DOUBLE_BYTE_PAIR(0x89C9, 0x6687)
+DOUBLE_BYTE_PAIR(0x89CA, 0x679C)
+DOUBLE_BYTE_PAIR(0x89CB, 0x67B6)
+DOUBLE_BYTE_PAIR(0x89CC, 0x6B4C)
+DOUBLE_BYTE_PAIR(0x89CD, 0x6CB3)
+DOUBLE_BYTE_PAIR(0x89CE, 0x706B)
+DOUBLE_BYTE_PAIR(0x89CF, 0x73C2)
+DOUBLE_BYTE_PAIR(0x89D0, 0x798D)
+DOUBLE_BYTE_PAIR(0x89D1, 0x79BE)
+DOUBLE_BYTE_PAIR(0x89D2, 0x7A3C)
+DOUBLE_BYTE_PAIR(0x89D3, 0x7B87)
+DOUBLE_BYTE_PAIR(0x89D4, 0x82B1)
+DOUBLE_BYTE_PAIR(0x89D5, 0x82DB)
+DOUBLE_BYTE_PAIR(0x89D6, 0x8304)
+DOUBLE_BYTE_PAIR(0x89D7, 0x8377)
+DOUBLE_BYTE_PAIR(0x89D8, 0x83EF)
+DOUBLE_BYTE_PAIR(0x89D9, 0x83D3)
+DOUBLE_BYTE_PAIR(0x89DA, 0x8766)
+DOUBLE_BYTE_PAIR(0x89DB, 0x8AB2)
+DOUBLE_BYTE_PAIR(0x89DC, 0x5629)
+DOUBLE_BYTE_PAIR(0x89DD, 0x8CA8)
+DOUBLE_BYTE_PAIR(0x89DE, 0x8FE6)
+DOUBLE_BYTE_PAIR(0x89DF, 0x904E)
+DOUBLE_BYTE_PAIR(0x89E0, 0x971E)
+DOUBLE_BYTE_PAIR(0x89E1, 0x868A)
+DOUBLE_BYTE_PAIR(0x89E2, 0x4FC4)
+DOUBLE_BYTE_PAIR(0x89E3, 0x5CE8)
+DOUBLE_BYTE_PAIR(0x89E4, 0x6211)
+DOUBLE_BYTE_PAIR(0x89E5, 0x7259)
+DOUBLE_BYTE_PAIR(0x89E6, 0x753B)
+DOUBLE_BYTE_PAIR(0x89E7, 0x81E5)
+DOUBLE_BYTE_PAIR(0x89E8, 0x82BD)
+DOUBLE_BYTE_PAIR(0x89E9, 0x86FE)
+DOUBLE_BYTE_PAIR(0x89EA, 0x8CC0)
+DOUBLE_BYTE_PAIR(0x89EB, 0x96C5)
+DOUBLE_BYTE_PAIR(0x89EC, 0x9913)
+DOUBLE_BYTE_PAIR(0x89ED, 0x99D5)
+DOUBLE_BYTE_PAIR(0x89EE, 0x4ECB)
+DOUBLE_BYTE_PAIR(0x89EF, 0x4F1A)
+DOUBLE_BYTE_PAIR(0x89F0, 0x89E3)
+DOUBLE_BYTE_PAIR(0x89F1, 0x56DE)
+DOUBLE_BYTE_PAIR(0x89F2, 0x584A)
+DOUBLE_BYTE_PAIR(0x89F3, 0x58CA)
+DOUBLE_BYTE_PAIR(0x89F4, 0x5EFB)
+DOUBLE_BYTE_PAIR(0x89F5, 0x5FEB)
+DOUBLE_BYTE_PAIR(0x89F6, 0x602A)
+DOUBLE_BYTE_PAIR(0x89F7, 0x6094)
+DOUBLE_BYTE_PAIR(0x89F8, 0x6062)
+DOUBLE_BYTE_PAIR(0x89F9, 0x61D0)
+DOUBLE_BYTE_PAIR(0x89FA, 0x6212)
+DOUBLE_BYTE_PAIR(0x89FB, 0x62D0)
+DOUBLE_BYTE_PAIR(0x89FC, 0x6539)
+DOUBLE_BYTE_PAIR(0x8A40, 0x9B41)
+DOUBLE_BYTE_PAIR(0x8A41, 0x6666)
+DOUBLE_BYTE_PAIR(0x8A42, 0x68B0)
+DOUBLE_BYTE_PAIR(0x8A43, 0x6D77)
+DOUBLE_BYTE_PAIR(0x8A44, 0x7070)
+DOUBLE_BYTE_PAIR(0x8A45, 0x754C)
+DOUBLE_BYTE_PAIR(0x8A46, 0x7686)
+DOUBLE_BYTE_PAIR(0x8A47, 0x7D75)
+DOUBLE_BYTE_PAIR(0x8A48, 0x82A5)
+DOUBLE_BYTE_PAIR(0x8A49, 0x87F9)
+DOUBLE_BYTE_PAIR(0x8A4A, 0x958B)
+DOUBLE_BYTE_PAIR(0x8A4B, 0x968E)
+DOUBLE_BYTE_PAIR(0x8A4C, 0x8C9D)
+DOUBLE_BYTE_PAIR(0x8A4D, 0x51F1)
+DOUBLE_BYTE_PAIR(0x8A4E, 0x52BE)
+DOUBLE_BYTE_PAIR(0x8A4F, 0x5916)
+DOUBLE_BYTE_PAIR(0x8A50, 0x54B3)
+DOUBLE_BYTE_PAIR(0x8A51, 0x5BB3)
+DOUBLE_BYTE_PAIR(0x8A52, 0x5D16)
+DOUBLE_BYTE_PAIR(0x8A53, 0x6168)
+DOUBLE_BYTE_PAIR(0x8A54, 0x6982)
+DOUBLE_BYTE_PAIR(0x8A55, 0x6DAF)
+DOUBLE_BYTE_PAIR(0x8A56, 0x788D)
+DOUBLE_BYTE_PAIR(0x8A57, 0x84CB)
+DOUBLE_BYTE_PAIR(0x8A58, 0x8857)
+DOUBLE_BYTE_PAIR(0x8A59, 0x8A72)
+DOUBLE_BYTE_PAIR(0x8A5A, 0x93A7)
+DOUBLE_BYTE_PAIR(0x8A5B, 0x9AB8)
+DOUBLE_BYTE_PAIR(0x8A5C, 0x6D6C)
+DOUBLE_BYTE_PAIR(0x8A5D, 0x99A8)
+DOUBLE_BYTE_PAIR(0x8A5E, 0x86D9)
+DOUBLE_BYTE_PAIR(0x8A5F, 0x57A3)
+DOUBLE_BYTE_PAIR(0x8A60, 0x67FF)
+DOUBLE_BYTE_PAIR(0x8A61, 0x86CE)
+DOUBLE_BYTE_PAIR(0x8A62, 0x920E)
+DOUBLE_BYTE_PAIR(0x8A63, 0x5283)
+DOUBLE_BYTE_PAIR(0x8A64, 0x5687)
+DOUBLE_BYTE_PAIR(0x8A65, 0x5404)
+DOUBLE_BYTE_PAIR(0x8A66, 0x5ED3)
+DOUBLE_BYTE_PAIR(0x8A67, 0x62E1)
+DOUBLE_BYTE_PAIR(0x8A68, 0x64B9)
+DOUBLE_BYTE_PAIR(0x8A69, 0x683C)
+DOUBLE_BYTE_PAIR(0x8A6A, 0x6838)
+DOUBLE_BYTE_PAIR(0x8A6B, 0x6BBB)
+DOUBLE_BYTE_PAIR(0x8A6C, 0x7372)
+DOUBLE_BYTE_PAIR(0x8A6D, 0x78BA)
+DOUBLE_BYTE_PAIR(0x8A6E, 0x7A6B)
+DOUBLE_BYTE_PAIR(0x8A6F, 0x899A)
+DOUBLE_BYTE_PAIR(0x8A70, 0x89D2)
+DOUBLE_BYTE_PAIR(0x8A71, 0x8D6B)
+DOUBLE_BYTE_PAIR(0x8A72, 0x8F03)
+DOUBLE_BYTE_PAIR(0x8A73, 0x90ED)
+DOUBLE_BYTE_PAIR(0x8A74, 0x95A3)
+DOUBLE_BYTE_PAIR(0x8A75, 0x9694)
+DOUBLE_BYTE_PAIR(0x8A76, 0x9769)
+DOUBLE_BYTE_PAIR(0x8A77, 0x5B66)
+DOUBLE_BYTE_PAIR(0x8A78, 0x5CB3)
+DOUBLE_BYTE_PAIR(0x8A79, 0x697D)
+DOUBLE_BYTE_PAIR(0x8A7A, 0x984D)
+DOUBLE_BYTE_PAIR(0x8A7B, 0x984E)
+DOUBLE_BYTE_PAIR(0x8A7C, 0x639B)
+DOUBLE_BYTE_PAIR(0x8A7D, 0x7B20)
+DOUBLE_BYTE_PAIR(0x8A7E, 0x6A2B)
+DOUBLE_BYTE_PAIR(0x8A80, 0x6A7F)
+DOUBLE_BYTE_PAIR(0x8A81, 0x68B6)
+DOUBLE_BYTE_PAIR(0x8A82, 0x9C0D)
+DOUBLE_BYTE_PAIR(0x8A83, 0x6F5F)
+DOUBLE_BYTE_PAIR(0x8A84, 0x5272)
+DOUBLE_BYTE_PAIR(0x8A85, 0x559D)
+DOUBLE_BYTE_PAIR(0x8A86, 0x6070)
+DOUBLE_BYTE_PAIR(0x8A87, 0x62EC)
+DOUBLE_BYTE_PAIR(0x8A88, 0x6D3B)
+DOUBLE_BYTE_PAIR(0x8A89, 0x6E07)
+DOUBLE_BYTE_PAIR(0x8A8A, 0x6ED1)
+DOUBLE_BYTE_PAIR(0x8A8B, 0x845B)
+DOUBLE_BYTE_PAIR(0x8A8C, 0x8910)
+DOUBLE_BYTE_PAIR(0x8A8D, 0x8F44)
+DOUBLE_BYTE_PAIR(0x8A8E, 0x4E14)
+DOUBLE_BYTE_PAIR(0x8A8F, 0x9C39)
+DOUBLE_BYTE_PAIR(0x8A90, 0x53F6)
+DOUBLE_BYTE_PAIR(0x8A91, 0x691B)
+DOUBLE_BYTE_PAIR(0x8A92, 0x6A3A)
+DOUBLE_BYTE_PAIR(0x8A93, 0x9784)
+DOUBLE_BYTE_PAIR(0x8A94, 0x682A)
+DOUBLE_BYTE_PAIR(0x8A95, 0x515C)
+DOUBLE_BYTE_PAIR(0x8A96, 0x7AC3)
+DOUBLE_BYTE_PAIR(0x8A97, 0x84B2)
+DOUBLE_BYTE_PAIR(0x8A98, 0x91DC)
+DOUBLE_BYTE_PAIR(0x8A99, 0x938C)
+DOUBLE_BYTE_PAIR(0x8A9A, 0x565B)
+DOUBLE_BYTE_PAIR(0x8A9B, 0x9D28)
+DOUBLE_BYTE_PAIR(0x8A9C, 0x6822)
+DOUBLE_BYTE_PAIR(0x8A9D, 0x8305)
+DOUBLE_BYTE_PAIR(0x8A9E, 0x8431)
+DOUBLE_BYTE_PAIR(0x8A9F, 0x7CA5)
+DOUBLE_BYTE_PAIR(0x8AA0, 0x5208)
+DOUBLE_BYTE_PAIR(0x8AA1, 0x82C5)
+DOUBLE_BYTE_PAIR(0x8AA2, 0x74E6)
+DOUBLE_BYTE_PAIR(0x8AA3, 0x4E7E)
+DOUBLE_BYTE_PAIR(0x8AA4, 0x4F83)
+DOUBLE_BYTE_PAIR(0x8AA5, 0x51A0)
+DOUBLE_BYTE_PAIR(0x8AA6, 0x5BD2)
+DOUBLE_BYTE_PAIR(0x8AA7, 0x520A)
+DOUBLE_BYTE_PAIR(0x8AA8, 0x52D8)
+DOUBLE_BYTE_PAIR(0x8AA9, 0x52E7)
+DOUBLE_BYTE_PAIR(0x8AAA, 0x5DFB)
+DOUBLE_BYTE_PAIR(0x8AAB, 0x559A)
+DOUBLE_BYTE_PAIR(0x8AAC, 0x582A)
+DOUBLE_BYTE_PAIR(0x8AAD, 0x59E6)
+DOUBLE_BYTE_PAIR(0x8AAE, 0x5B8C)
+DOUBLE_BYTE_PAIR(0x8AAF, 0x5B98)
+DOUBLE_BYTE_PAIR(0x8AB0, 0x5BDB)
+DOUBLE_BYTE_PAIR(0x8AB1, 0x5E72)
+DOUBLE_BYTE_PAIR(0x8AB2, 0x5E79)
+DOUBLE_BYTE_PAIR(0x8AB3, 0x60A3)
+DOUBLE_BYTE_PAIR(0x8AB4, 0x611F)
+DOUBLE_BYTE_PAIR(0x8AB5, 0x6163)
+DOUBLE_BYTE_PAIR(0x8AB6, 0x61BE)
+DOUBLE_BYTE_PAIR(0x8AB7, 0x63DB)
+DOUBLE_BYTE_PAIR(0x8AB8, 0x6562)
+DOUBLE_BYTE_PAIR(0x8AB9, 0x67D1)
+DOUBLE_BYTE_PAIR(0x8ABA, 0x6853)
+DOUBLE_BYTE_PAIR(0x8ABB, 0x68FA)
+DOUBLE_BYTE_PAIR(0x8ABC, 0x6B3E)
+DOUBLE_BYTE_PAIR(0x8ABD, 0x6B53)
+DOUBLE_BYTE_PAIR(0x8ABE, 0x6C57)
+DOUBLE_BYTE_PAIR(0x8ABF, 0x6F22)
+DOUBLE_BYTE_PAIR(0x8AC0, 0x6F97)
+DOUBLE_BYTE_PAIR(0x8AC1, 0x6F45)
+DOUBLE_BYTE_PAIR(0x8AC2, 0x74B0)
+DOUBLE_BYTE_PAIR(0x8AC3, 0x7518)
+DOUBLE_BYTE_PAIR(0x8AC4, 0x76E3)
+DOUBLE_BYTE_PAIR(0x8AC5, 0x770B)
+DOUBLE_BYTE_PAIR(0x8AC6, 0x7AFF)
+DOUBLE_BYTE_PAIR(0x8AC7, 0x7BA1)
+DOUBLE_BYTE_PAIR(0x8AC8, 0x7C21)
+DOUBLE_BYTE_PAIR(0x8AC9, 0x7DE9)
+DOUBLE_BYTE_PAIR(0x8ACA, 0x7F36)
+DOUBLE_BYTE_PAIR(0x8ACB, 0x7FF0)
+DOUBLE_BYTE_PAIR(0x8ACC, 0x809D)
+DOUBLE_BYTE_PAIR(0x8ACD, 0x8266)
+DOUBLE_BYTE_PAIR(0x8ACE, 0x839E)
+DOUBLE_BYTE_PAIR(0x8ACF, 0x89B3)
+DOUBLE_BYTE_PAIR(0x8AD0, 0x8ACC)
+DOUBLE_BYTE_PAIR(0x8AD1, 0x8CAB)
+DOUBLE_BYTE_PAIR(0x8AD2, 0x9084)
+DOUBLE_BYTE_PAIR(0x8AD3, 0x9451)
+DOUBLE_BYTE_PAIR(0x8AD4, 0x9593)
+DOUBLE_BYTE_PAIR(0x8AD5, 0x9591)
+DOUBLE_BYTE_PAIR(0x8AD6, 0x95A2)
+DOUBLE_BYTE_PAIR(0x8AD7, 0x9665)
+DOUBLE_BYTE_PAIR(0x8AD8, 0x97D3)
+DOUBLE_BYTE_PAIR(0x8AD9, 0x9928)
+DOUBLE_BYTE_PAIR(0x8ADA, 0x8218)
+DOUBLE_BYTE_PAIR(0x8ADB, 0x4E38)
+DOUBLE_BYTE_PAIR(0x8ADC, 0x542B)
+DOUBLE_BYTE_PAIR(0x8ADD, 0x5CB8)
+DOUBLE_BYTE_PAIR(0x8ADE, 0x5DCC)
+DOUBLE_BYTE_PAIR(0x8ADF, 0x73A9)
+DOUBLE_BYTE_PAIR(0x8AE0, 0x764C)
+DOUBLE_BYTE_PAIR(0x8AE1, 0x773C)
+DOUBLE_BYTE_PAIR(0x8AE2, 0x5CA9)
+DOUBLE_BYTE_PAIR(0x8AE3, 0x7FEB)
+DOUBLE_BYTE_PAIR(0x8AE4, 0x8D0B)
+DOUBLE_BYTE_PAIR(0x8AE5, 0x96C1)
+DOUBLE_BYTE_PAIR(0x8AE6, 0x9811)
+DOUBLE_BYTE_PAIR(0x8AE7, 0x9854)
+DOUBLE_BYTE_PAIR(0x8AE8, 0x9858)
+DOUBLE_BYTE_PAIR(0x8AE9, 0x4F01)
+DOUBLE_BYTE_PAIR(0x8AEA, 0x4F0E)
+DOUBLE_BYTE_PAIR(0x8AEB, 0x5371)
+DOUBLE_BYTE_PAIR(0x8AEC, 0x559C)
+DOUBLE_BYTE_PAIR(0x8AED, 0x5668)
+DOUBLE_BYTE_PAIR(0x8AEE, 0x57FA)
+DOUBLE_BYTE_PAIR(0x8AEF, 0x5947)
+DOUBLE_BYTE_PAIR(0x8AF0, 0x5B09)
+DOUBLE_BYTE_PAIR(0x8AF1, 0x5BC4)
+DOUBLE_BYTE_PAIR(0x8AF2, 0x5C90)
+DOUBLE_BYTE_PAIR(0x8AF3, 0x5E0C)
+DOUBLE_BYTE_PAIR(0x8AF4, 0x5E7E)
+DOUBLE_BYTE_PAIR(0x8AF5, 0x5FCC)
+DOUBLE_BYTE_PAIR(0x8AF6, 0x63EE)
+DOUBLE_BYTE_PAIR(0x8AF7, 0x673A)
+DOUBLE_BYTE_PAIR(0x8AF8, 0x65D7)
+DOUBLE_BYTE_PAIR(0x8AF9, 0x65E2)
+DOUBLE_BYTE_PAIR(0x8AFA, 0x671F)
+DOUBLE_BYTE_PAIR(0x8AFB, 0x68CB)
+DOUBLE_BYTE_PAIR(0x8AFC, 0x68C4)
+DOUBLE_BYTE_PAIR(0x8B40, 0x6A5F)
+DOUBLE_BYTE_PAIR(0x8B41, 0x5E30)
+DOUBLE_BYTE_PAIR(0x8B42, 0x6BC5)
+DOUBLE_BYTE_PAIR(0x8B43, 0x6C17)
+DOUBLE_BYTE_PAIR(0x8B44, 0x6C7D)
+DOUBLE_BYTE_PAIR(0x8B45, 0x757F)
+DOUBLE_BYTE_PAIR(0x8B46, 0x7948)
+DOUBLE_BYTE_PAIR(0x8B47, 0x5B63)
+DOUBLE_BYTE_PAIR(0x8B48, 0x7A00)
+DOUBLE_BYTE_PAIR(0x8B49, 0x7D00)
+DOUBLE_BYTE_PAIR(0x8B4A, 0x5FBD)
+DOUBLE_BYTE_PAIR(0x8B4B, 0x898F)
+DOUBLE_BYTE_PAIR(0x8B4C, 0x8A18)
+DOUBLE_BYTE_PAIR(0x8B4D, 0x8CB4)
+DOUBLE_BYTE_PAIR(0x8B4E, 0x8D77)
+DOUBLE_BYTE_PAIR(0x8B4F, 0x8ECC)
+DOUBLE_BYTE_PAIR(0x8B50, 0x8F1D)
+DOUBLE_BYTE_PAIR(0x8B51, 0x98E2)
+DOUBLE_BYTE_PAIR(0x8B52, 0x9A0E)
+DOUBLE_BYTE_PAIR(0x8B53, 0x9B3C)
+DOUBLE_BYTE_PAIR(0x8B54, 0x4E80)
+DOUBLE_BYTE_PAIR(0x8B55, 0x507D)
+DOUBLE_BYTE_PAIR(0x8B56, 0x5100)
+DOUBLE_BYTE_PAIR(0x8B57, 0x5993)
+DOUBLE_BYTE_PAIR(0x8B58, 0x5B9C)
+DOUBLE_BYTE_PAIR(0x8B59, 0x622F)
+DOUBLE_BYTE_PAIR(0x8B5A, 0x6280)
+DOUBLE_BYTE_PAIR(0x8B5B, 0x64EC)
+DOUBLE_BYTE_PAIR(0x8B5C, 0x6B3A)
+DOUBLE_BYTE_PAIR(0x8B5D, 0x72A0)
+DOUBLE_BYTE_PAIR(0x8B5E, 0x7591)
+DOUBLE_BYTE_PAIR(0x8B5F, 0x7947)
+DOUBLE_BYTE_PAIR(0x8B60, 0x7FA9)
+DOUBLE_BYTE_PAIR(0x8B61, 0x87FB)
+DOUBLE_BYTE_PAIR(0x8B62, 0x8ABC)
+DOUBLE_BYTE_PAIR(0x8B63, 0x8B70)
+DOUBLE_BYTE_PAIR(0x8B64, 0x63AC)
+DOUBLE_BYTE_PAIR(0x8B65, 0x83CA)
+DOUBLE_BYTE_PAIR(0x8B66, 0x97A0)
+DOUBLE_BYTE_PAIR(0x8B67, 0x5409)
+DOUBLE_BYTE_PAIR(0x8B68, 0x5403)
+DOUBLE_BYTE_PAIR(0x8B69, 0x55AB)
+DOUBLE_BYTE_PAIR(0x8B6A, 0x6854)
+DOUBLE_BYTE_PAIR(0x8B6B, 0x6A58)
+DOUBLE_BYTE_PAIR(0x8B6C, 0x8A70)
+DOUBLE_BYTE_PAIR(0x8B6D, 0x7827)
+DOUBLE_BYTE_PAIR(0x8B6E, 0x6775)
+DOUBLE_BYTE_PAIR(0x8B6F, 0x9ECD)
+DOUBLE_BYTE_PAIR(0x8B70, 0x5374)
+DOUBLE_BYTE_PAIR(0x8B71, 0x5BA2)
+DOUBLE_BYTE_PAIR(0x8B72, 0x811A)
+DOUBLE_BYTE_PAIR(0x8B73, 0x8650)
+DOUBLE_BYTE_PAIR(0x8B74, 0x9006)
+DOUBLE_BYTE_PAIR(0x8B75, 0x4E18)
+DOUBLE_BYTE_PAIR(0x8B76, 0x4E45)
+DOUBLE_BYTE_PAIR(0x8B77, 0x4EC7)
+DOUBLE_BYTE_PAIR(0x8B78, 0x4F11)
+DOUBLE_BYTE_PAIR(0x8B79, 0x53CA)
+DOUBLE_BYTE_PAIR(0x8B7A, 0x5438)
+DOUBLE_BYTE_PAIR(0x8B7B, 0x5BAE)
+DOUBLE_BYTE_PAIR(0x8B7C, 0x5F13)
+DOUBLE_BYTE_PAIR(0x8B7D, 0x6025)
+DOUBLE_BYTE_PAIR(0x8B7E, 0x6551)
+DOUBLE_BYTE_PAIR(0x8B80, 0x673D)
+DOUBLE_BYTE_PAIR(0x8B81, 0x6C42)
+DOUBLE_BYTE_PAIR(0x8B82, 0x6C72)
+DOUBLE_BYTE_PAIR(0x8B83, 0x6CE3)
+DOUBLE_BYTE_PAIR(0x8B84, 0x7078)
+DOUBLE_BYTE_PAIR(0x8B85, 0x7403)
+DOUBLE_BYTE_PAIR(0x8B86, 0x7A76)
+DOUBLE_BYTE_PAIR(0x8B87, 0x7AAE)
+DOUBLE_BYTE_PAIR(0x8B88, 0x7B08)
+DOUBLE_BYTE_PAIR(0x8B89, 0x7D1A)
+DOUBLE_BYTE_PAIR(0x8B8A, 0x7CFE)
+DOUBLE_BYTE_PAIR(0x8B8B, 0x7D66)
+DOUBLE_BYTE_PAIR(0x8B8C, 0x65E7)
+DOUBLE_BYTE_PAIR(0x8B8D, 0x725B)
+DOUBLE_BYTE_PAIR(0x8B8E, 0x53BB)
+DOUBLE_BYTE_PAIR(0x8B8F, 0x5C45)
+DOUBLE_BYTE_PAIR(0x8B90, 0x5DE8)
+DOUBLE_BYTE_PAIR(0x8B91, 0x62D2)
+DOUBLE_BYTE_PAIR(0x8B92, 0x62E0)
+DOUBLE_BYTE_PAIR(0x8B93, 0x6319)
+DOUBLE_BYTE_PAIR(0x8B94, 0x6E20)
+DOUBLE_BYTE_PAIR(0x8B95, 0x865A)
+DOUBLE_BYTE_PAIR(0x8B96, 0x8A31)
+DOUBLE_BYTE_PAIR(0x8B97, 0x8DDD)
+DOUBLE_BYTE_PAIR(0x8B98, 0x92F8)
+DOUBLE_BYTE_PAIR(0x8B99, 0x6F01)
+DOUBLE_BYTE_PAIR(0x8B9A, 0x79A6)
+DOUBLE_BYTE_PAIR(0x8B9B, 0x9B5A)
+DOUBLE_BYTE_PAIR(0x8B9C, 0x4EA8)
+DOUBLE_BYTE_PAIR(0x8B9D, 0x4EAB)
+DOUBLE_BYTE_PAIR(0x8B9E, 0x4EAC)
+DOUBLE_BYTE_PAIR(0x8B9F, 0x4F9B)
+DOUBLE_BYTE_PAIR(0x8BA0, 0x4FA0)
+DOUBLE_BYTE_PAIR(0x8BA1, 0x50D1)
+DOUBLE_BYTE_PAIR(0x8BA2, 0x5147)
+DOUBLE_BYTE_PAIR(0x8BA3, 0x7AF6)
+DOUBLE_BYTE_PAIR(0x8BA4, 0x5171)
+DOUBLE_BYTE_PAIR(0x8BA5, 0x51F6)
+DOUBLE_BYTE_PAIR(0x8BA6, 0x5354)
+DOUBLE_BYTE_PAIR(0x8BA7, 0x5321)
+DOUBLE_BYTE_PAIR(0x8BA8, 0x537F)
+DOUBLE_BYTE_PAIR(0x8BA9, 0x53EB)
+DOUBLE_BYTE_PAIR(0x8BAA, 0x55AC)
+DOUBLE_BYTE_PAIR(0x8BAB, 0x5883)
+DOUBLE_BYTE_PAIR(0x8BAC, 0x5CE1)
+DOUBLE_BYTE_PAIR(0x8BAD, 0x5F37)
+DOUBLE_BYTE_PAIR(0x8BAE, 0x5F4A)
+DOUBLE_BYTE_PAIR(0x8BAF, 0x602F)
+DOUBLE_BYTE_PAIR(0x8BB0, 0x6050)
+DOUBLE_BYTE_PAIR(0x8BB1, 0x606D)
+DOUBLE_BYTE_PAIR(0x8BB2, 0x631F)
+DOUBLE_BYTE_PAIR(0x8BB3, 0x6559)
+DOUBLE_BYTE_PAIR(0x8BB4, 0x6A4B)
+DOUBLE_BYTE_PAIR(0x8BB5, 0x6CC1)
+DOUBLE_BYTE_PAIR(0x8BB6, 0x72C2)
+DOUBLE_BYTE_PAIR(0x8BB7, 0x72ED)
+DOUBLE_BYTE_PAIR(0x8BB8, 0x77EF)
+DOUBLE_BYTE_PAIR(0x8BB9, 0x80F8)
+DOUBLE_BYTE_PAIR(0x8BBA, 0x8105)
+DOUBLE_BYTE_PAIR(0x8BBB, 0x8208)
+DOUBLE_BYTE_PAIR(0x8BBC, 0x854E)
+DOUBLE_BYTE_PAIR(0x8BBD, 0x90F7)
+DOUBLE_BYTE_PAIR(0x8BBE, 0x93E1)
+DOUBLE_BYTE_PAIR(0x8BBF, 0x97FF)
+DOUBLE_BYTE_PAIR(0x8BC0, 0x9957)
+DOUBLE_BYTE_PAIR(0x8BC1, 0x9A5A)
+DOUBLE_BYTE_PAIR(0x8BC2, 0x4EF0)
+DOUBLE_BYTE_PAIR(0x8BC3, 0x51DD)
+DOUBLE_BYTE_PAIR(0x8BC4, 0x5C2D)
+DOUBLE_BYTE_PAIR(0x8BC5, 0x6681)
+DOUBLE_BYTE_PAIR(0x8BC6, 0x696D)
+DOUBLE_BYTE_PAIR(0x8BC7, 0x5C40)
+DOUBLE_BYTE_PAIR(0x8BC8, 0x66F2)
+DOUBLE_BYTE_PAIR(0x8BC9, 0x6975)
+DOUBLE_BYTE_PAIR(0x8BCA, 0x7389)
+DOUBLE_BYTE_PAIR(0x8BCB, 0x6850)
+DOUBLE_BYTE_PAIR(0x8BCC, 0x7C81)
+DOUBLE_BYTE_PAIR(0x8BCD, 0x50C5)
+DOUBLE_BYTE_PAIR(0x8BCE, 0x52E4)
+DOUBLE_BYTE_PAIR(0x8BCF, 0x5747)
+DOUBLE_BYTE_PAIR(0x8BD0, 0x5DFE)
+DOUBLE_BYTE_PAIR(0x8BD1, 0x9326)
+DOUBLE_BYTE_PAIR(0x8BD2, 0x65A4)
+DOUBLE_BYTE_PAIR(0x8BD3, 0x6B23)
+DOUBLE_BYTE_PAIR(0x8BD4, 0x6B3D)
+DOUBLE_BYTE_PAIR(0x8BD5, 0x7434)
+DOUBLE_BYTE_PAIR(0x8BD6, 0x7981)
+DOUBLE_BYTE_PAIR(0x8BD7, 0x79BD)
+DOUBLE_BYTE_PAIR(0x8BD8, 0x7B4B)
+DOUBLE_BYTE_PAIR(0x8BD9, 0x7DCA)
+DOUBLE_BYTE_PAIR(0x8BDA, 0x82B9)
+DOUBLE_BYTE_PAIR(0x8BDB, 0x83CC)
+DOUBLE_BYTE_PAIR(0x8BDC, 0x887F)
+DOUBLE_BYTE_PAIR(0x8BDD, 0x895F)
+DOUBLE_BYTE_PAIR(0x8BDE, 0x8B39)
+DOUBLE_BYTE_PAIR(0x8BDF, 0x8FD1)
+DOUBLE_BYTE_PAIR(0x8BE0, 0x91D1)
+DOUBLE_BYTE_PAIR(0x8BE1, 0x541F)
+DOUBLE_BYTE_PAIR(0x8BE2, 0x9280)
+DOUBLE_BYTE_PAIR(0x8BE3, 0x4E5D)
+DOUBLE_BYTE_PAIR(0x8BE4, 0x5036)
+DOUBLE_BYTE_PAIR(0x8BE5, 0x53E5)
+DOUBLE_BYTE_PAIR(0x8BE6, 0x533A)
+DOUBLE_BYTE_PAIR(0x8BE7, 0x72D7)
+DOUBLE_BYTE_PAIR(0x8BE8, 0x7396)
+DOUBLE_BYTE_PAIR(0x8BE9, 0x77E9)
+DOUBLE_BYTE_PAIR(0x8BEA, 0x82E6)
+DOUBLE_BYTE_PAIR(0x8BEB, 0x8EAF)
+DOUBLE_BYTE_PAIR(0x8BEC, 0x99C6)
+DOUBLE_BYTE_PAIR(0x8BED, 0x99C8)
+DOUBLE_BYTE_PAIR(0x8BEE, 0x99D2)
+DOUBLE_BYTE_PAIR(0x8BEF, 0x5177)
+DOUBLE_BYTE_PAIR(0x8BF0, 0x611A)
+DOUBLE_BYTE_PAIR(0x8BF1, 0x865E)
+DOUBLE_BYTE_PAIR(0x8BF2, 0x55B0)
+DOUBLE_BYTE_PAIR(0x8BF3, 0x7A7A)
+DOUBLE_BYTE_PAIR(0x8BF4, 0x5076)
+DOUBLE_BYTE_PAIR(0x8BF5, 0x5BD3)
+DOUBLE_BYTE_PAIR(0x8BF6, 0x9047)
+DOUBLE_BYTE_PAIR(0x8BF7, 0x9685)
+DOUBLE_BYTE_PAIR(0x8BF8, 0x4E32)
+DOUBLE_BYTE_PAIR(0x8BF9, 0x6ADB)
+DOUBLE_BYTE_PAIR(0x8BFA, 0x91E7)
+DOUBLE_BYTE_PAIR(0x8BFB, 0x5C51)
+DOUBLE_BYTE_PAIR(0x8BFC, 0x5C48)
+DOUBLE_BYTE_PAIR(0x8C40, 0x6398)
+DOUBLE_BYTE_PAIR(0x8C41, 0x7A9F)
+DOUBLE_BYTE_PAIR(0x8C42, 0x6C93)
+DOUBLE_BYTE_PAIR(0x8C43, 0x9774)
+DOUBLE_BYTE_PAIR(0x8C44, 0x8F61)
+DOUBLE_BYTE_PAIR(0x8C45, 0x7AAA)
+DOUBLE_BYTE_PAIR(0x8C46, 0x718A)
+DOUBLE_BYTE_PAIR(0x8C47, 0x9688)
+DOUBLE_BYTE_PAIR(0x8C48, 0x7C82)
+DOUBLE_BYTE_PAIR(0x8C49, 0x6817)
+DOUBLE_BYTE_PAIR(0x8C4A, 0x7E70)
+DOUBLE_BYTE_PAIR(0x8C4B, 0x6851)
+DOUBLE_BYTE_PAIR(0x8C4C, 0x936C)
+DOUBLE_BYTE_PAIR(0x8C4D, 0x52F2)
+DOUBLE_BYTE_PAIR(0x8C4E, 0x541B)
+DOUBLE_BYTE_PAIR(0x8C4F, 0x85AB)
+DOUBLE_BYTE_PAIR(0x8C50, 0x8A13)
+DOUBLE_BYTE_PAIR(0x8C51, 0x7FA4)
+DOUBLE_BYTE_PAIR(0x8C52, 0x8ECD)
+DOUBLE_BYTE_PAIR(0x8C53, 0x90E1)
+DOUBLE_BYTE_PAIR(0x8C54, 0x5366)
+DOUBLE_BYTE_PAIR(0x8C55, 0x8888)
+DOUBLE_BYTE_PAIR(0x8C56, 0x7941)
+DOUBLE_BYTE_PAIR(0x8C57, 0x4FC2)
+DOUBLE_BYTE_PAIR(0x8C58, 0x50BE)
+DOUBLE_BYTE_PAIR(0x8C59, 0x5211)
+DOUBLE_BYTE_PAIR(0x8C5A, 0x5144)
+DOUBLE_BYTE_PAIR(0x8C5B, 0x5553)
+DOUBLE_BYTE_PAIR(0x8C5C, 0x572D)
+DOUBLE_BYTE_PAIR(0x8C5D, 0x73EA)
+DOUBLE_BYTE_PAIR(0x8C5E, 0x578B)
+DOUBLE_BYTE_PAIR(0x8C5F, 0x5951)
+DOUBLE_BYTE_PAIR(0x8C60, 0x5F62)
+DOUBLE_BYTE_PAIR(0x8C61, 0x5F84)
+DOUBLE_BYTE_PAIR(0x8C62, 0x6075)
+DOUBLE_BYTE_PAIR(0x8C63, 0x6176)
+DOUBLE_BYTE_PAIR(0x8C64, 0x6167)
+DOUBLE_BYTE_PAIR(0x8C65, 0x61A9)
+DOUBLE_BYTE_PAIR(0x8C66, 0x63B2)
+DOUBLE_BYTE_PAIR(0x8C67, 0x643A)
+DOUBLE_BYTE_PAIR(0x8C68, 0x656C)
+DOUBLE_BYTE_PAIR(0x8C69, 0x666F)
+DOUBLE_BYTE_PAIR(0x8C6A, 0x6842)
+DOUBLE_BYTE_PAIR(0x8C6B, 0x6E13)
+DOUBLE_BYTE_PAIR(0x8C6C, 0x7566)
+DOUBLE_BYTE_PAIR(0x8C6D, 0x7A3D)
+DOUBLE_BYTE_PAIR(0x8C6E, 0x7CFB)
+DOUBLE_BYTE_PAIR(0x8C6F, 0x7D4C)
+DOUBLE_BYTE_PAIR(0x8C70, 0x7D99)
+DOUBLE_BYTE_PAIR(0x8C71, 0x7E4B)
+DOUBLE_BYTE_PAIR(0x8C72, 0x7F6B)
+DOUBLE_BYTE_PAIR(0x8C73, 0x830E)
+DOUBLE_BYTE_PAIR(0x8C74, 0x834A)
+DOUBLE_BYTE_PAIR(0x8C75, 0x86CD)
+DOUBLE_BYTE_PAIR(0x8C76, 0x8A08)
+DOUBLE_BYTE_PAIR(0x8C77, 0x8A63)
+DOUBLE_BYTE_PAIR(0x8C78, 0x8B66)
+DOUBLE_BYTE_PAIR(0x8C79, 0x8EFD)
+DOUBLE_BYTE_PAIR(0x8C7A, 0x981A)
+DOUBLE_BYTE_PAIR(0x8C7B, 0x9D8F)
+DOUBLE_BYTE_PAIR(0x8C7C, 0x82B8)
+DOUBLE_BYTE_PAIR(0x8C7D, 0x8FCE)
+DOUBLE_BYTE_PAIR(0x8C7E, 0x9BE8)
+DOUBLE_BYTE_PAIR(0x8C80, 0x5287)
+DOUBLE_BYTE_PAIR(0x8C81, 0x621F)
+DOUBLE_BYTE_PAIR(0x8C82, 0x6483)
+DOUBLE_BYTE_PAIR(0x8C83, 0x6FC0)
+DOUBLE_BYTE_PAIR(0x8C84, 0x9699)
+DOUBLE_BYTE_PAIR(0x8C85, 0x6841)
+DOUBLE_BYTE_PAIR(0x8C86, 0x5091)
+DOUBLE_BYTE_PAIR(0x8C87, 0x6B20)
+DOUBLE_BYTE_PAIR(0x8C88, 0x6C7A)
+DOUBLE_BYTE_PAIR(0x8C89, 0x6F54)
+DOUBLE_BYTE_PAIR(0x8C8A, 0x7A74)
+DOUBLE_BYTE_PAIR(0x8C8B, 0x7D50)
+DOUBLE_BYTE_PAIR(0x8C8C, 0x8840)
+DOUBLE_BYTE_PAIR(0x8C8D, 0x8A23)
+DOUBLE_BYTE_PAIR(0x8C8E, 0x6708)
+DOUBLE_BYTE_PAIR(0x8C8F, 0x4EF6)
+DOUBLE_BYTE_PAIR(0x8C90, 0x5039)
+DOUBLE_BYTE_PAIR(0x8C91, 0x5026)
+DOUBLE_BYTE_PAIR(0x8C92, 0x5065)
+DOUBLE_BYTE_PAIR(0x8C93, 0x517C)
+DOUBLE_BYTE_PAIR(0x8C94, 0x5238)
+DOUBLE_BYTE_PAIR(0x8C95, 0x5263)
+DOUBLE_BYTE_PAIR(0x8C96, 0x55A7)
+DOUBLE_BYTE_PAIR(0x8C97, 0x570F)
+DOUBLE_BYTE_PAIR(0x8C98, 0x5805)
+DOUBLE_BYTE_PAIR(0x8C99, 0x5ACC)
+DOUBLE_BYTE_PAIR(0x8C9A, 0x5EFA)
+DOUBLE_BYTE_PAIR(0x8C9B, 0x61B2)
+DOUBLE_BYTE_PAIR(0x8C9C, 0x61F8)
+DOUBLE_BYTE_PAIR(0x8C9D, 0x62F3)
+DOUBLE_BYTE_PAIR(0x8C9E, 0x6372)
+DOUBLE_BYTE_PAIR(0x8C9F, 0x691C)
+DOUBLE_BYTE_PAIR(0x8CA0, 0x6A29)
+DOUBLE_BYTE_PAIR(0x8CA1, 0x727D)
+DOUBLE_BYTE_PAIR(0x8CA2, 0x72AC)
+DOUBLE_BYTE_PAIR(0x8CA3, 0x732E)
+DOUBLE_BYTE_PAIR(0x8CA4, 0x7814)
+DOUBLE_BYTE_PAIR(0x8CA5, 0x786F)
+DOUBLE_BYTE_PAIR(0x8CA6, 0x7D79)
+DOUBLE_BYTE_PAIR(0x8CA7, 0x770C)
+DOUBLE_BYTE_PAIR(0x8CA8, 0x80A9)
+DOUBLE_BYTE_PAIR(0x8CA9, 0x898B)
+DOUBLE_BYTE_PAIR(0x8CAA, 0x8B19)
+DOUBLE_BYTE_PAIR(0x8CAB, 0x8CE2)
+DOUBLE_BYTE_PAIR(0x8CAC, 0x8ED2)
+DOUBLE_BYTE_PAIR(0x8CAD, 0x9063)
+DOUBLE_BYTE_PAIR(0x8CAE, 0x9375)
+DOUBLE_BYTE_PAIR(0x8CAF, 0x967A)
+DOUBLE_BYTE_PAIR(0x8CB0, 0x9855)
+DOUBLE_BYTE_PAIR(0x8CB1, 0x9A13)
+DOUBLE_BYTE_PAIR(0x8CB2, 0x9E78)
+DOUBLE_BYTE_PAIR(0x8CB3, 0x5143)
+DOUBLE_BYTE_PAIR(0x8CB4, 0x539F)
+DOUBLE_BYTE_PAIR(0x8CB5, 0x53B3)
+DOUBLE_BYTE_PAIR(0x8CB6, 0x5E7B)
+DOUBLE_BYTE_PAIR(0x8CB7, 0x5F26)
+DOUBLE_BYTE_PAIR(0x8CB8, 0x6E1B)
+DOUBLE_BYTE_PAIR(0x8CB9, 0x6E90)
+DOUBLE_BYTE_PAIR(0x8CBA, 0x7384)
+DOUBLE_BYTE_PAIR(0x8CBB, 0x73FE)
+DOUBLE_BYTE_PAIR(0x8CBC, 0x7D43)
+DOUBLE_BYTE_PAIR(0x8CBD, 0x8237)
+DOUBLE_BYTE_PAIR(0x8CBE, 0x8A00)
+DOUBLE_BYTE_PAIR(0x8CBF, 0x8AFA)
+DOUBLE_BYTE_PAIR(0x8CC0, 0x9650)
+DOUBLE_BYTE_PAIR(0x8CC1, 0x4E4E)
+DOUBLE_BYTE_PAIR(0x8CC2, 0x500B)
+DOUBLE_BYTE_PAIR(0x8CC3, 0x53E4)
+DOUBLE_BYTE_PAIR(0x8CC4, 0x547C)
+DOUBLE_BYTE_PAIR(0x8CC5, 0x56FA)
+DOUBLE_BYTE_PAIR(0x8CC6, 0x59D1)
+DOUBLE_BYTE_PAIR(0x8CC7, 0x5B64)
+DOUBLE_BYTE_PAIR(0x8CC8, 0x5DF1)
+DOUBLE_BYTE_PAIR(0x8CC9, 0x5EAB)
+DOUBLE_BYTE_PAIR(0x8CCA, 0x5F27)
+DOUBLE_BYTE_PAIR(0x8CCB, 0x6238)
+DOUBLE_BYTE_PAIR(0x8CCC, 0x6545)
+DOUBLE_BYTE_PAIR(0x8CCD, 0x67AF)
+DOUBLE_BYTE_PAIR(0x8CCE, 0x6E56)
+DOUBLE_BYTE_PAIR(0x8CCF, 0x72D0)
+DOUBLE_BYTE_PAIR(0x8CD0, 0x7CCA)
+DOUBLE_BYTE_PAIR(0x8CD1, 0x88B4)
+DOUBLE_BYTE_PAIR(0x8CD2, 0x80A1)
+DOUBLE_BYTE_PAIR(0x8CD3, 0x80E1)
+DOUBLE_BYTE_PAIR(0x8CD4, 0x83F0)
+DOUBLE_BYTE_PAIR(0x8CD5, 0x864E)
+DOUBLE_BYTE_PAIR(0x8CD6, 0x8A87)
+DOUBLE_BYTE_PAIR(0x8CD7, 0x8DE8)
+DOUBLE_BYTE_PAIR(0x8CD8, 0x9237)
+DOUBLE_BYTE_PAIR(0x8CD9, 0x96C7)
+DOUBLE_BYTE_PAIR(0x8CDA, 0x9867)
+DOUBLE_BYTE_PAIR(0x8CDB, 0x9F13)
+DOUBLE_BYTE_PAIR(0x8CDC, 0x4E94)
+DOUBLE_BYTE_PAIR(0x8CDD, 0x4E92)
+DOUBLE_BYTE_PAIR(0x8CDE, 0x4F0D)
+DOUBLE_BYTE_PAIR(0x8CDF, 0x5348)
+DOUBLE_BYTE_PAIR(0x8CE0, 0x5449)
+DOUBLE_BYTE_PAIR(0x8CE1, 0x543E)
+DOUBLE_BYTE_PAIR(0x8CE2, 0x5A2F)
+DOUBLE_BYTE_PAIR(0x8CE3, 0x5F8C)
+DOUBLE_BYTE_PAIR(0x8CE4, 0x5FA1)
+DOUBLE_BYTE_PAIR(0x8CE5, 0x609F)
+DOUBLE_BYTE_PAIR(0x8CE6, 0x68A7)
+DOUBLE_BYTE_PAIR(0x8CE7, 0x6A8E)
+DOUBLE_BYTE_PAIR(0x8CE8, 0x745A)
+DOUBLE_BYTE_PAIR(0x8CE9, 0x7881)
+DOUBLE_BYTE_PAIR(0x8CEA, 0x8A9E)
+DOUBLE_BYTE_PAIR(0x8CEB, 0x8AA4)
+DOUBLE_BYTE_PAIR(0x8CEC, 0x8B77)
+DOUBLE_BYTE_PAIR(0x8CED, 0x9190)
+DOUBLE_BYTE_PAIR(0x8CEE, 0x4E5E)
+DOUBLE_BYTE_PAIR(0x8CEF, 0x9BC9)
+DOUBLE_BYTE_PAIR(0x8CF0, 0x4EA4)
+DOUBLE_BYTE_PAIR(0x8CF1, 0x4F7C)
+DOUBLE_BYTE_PAIR(0x8CF2, 0x4FAF)
+DOUBLE_BYTE_PAIR(0x8CF3, 0x5019)
+DOUBLE_BYTE_PAIR(0x8CF4, 0x5016)
+DOUBLE_BYTE_PAIR(0x8CF5, 0x5149)
+DOUBLE_BYTE_PAIR(0x8CF6, 0x516C)
+DOUBLE_BYTE_PAIR(0x8CF7, 0x529F)
+DOUBLE_BYTE_PAIR(0x8CF8, 0x52B9)
+DOUBLE_BYTE_PAIR(0x8CF9, 0x52FE)
+DOUBLE_BYTE_PAIR(0x8CFA, 0x539A)
+DOUBLE_BYTE_PAIR(0x8CFB, 0x53E3)
+DOUBLE_BYTE_PAIR(0x8CFC, 0x5411)
+DOUBLE_BYTE_PAIR(0x8D40, 0x540E)
+DOUBLE_BYTE_PAIR(0x8D41, 0x5589)
+DOUBLE_BYTE_PAIR(0x8D42, 0x5751)
+DOUBLE_BYTE_PAIR(0x8D43, 0x57A2)
+DOUBLE_BYTE_PAIR(0x8D44, 0x597D)
+DOUBLE_BYTE_PAIR(0x8D45, 0x5B54)
+DOUBLE_BYTE_PAIR(0x8D46, 0x5B5D)
+DOUBLE_BYTE_PAIR(0x8D47, 0x5B8F)
+DOUBLE_BYTE_PAIR(0x8D48, 0x5DE5)
+DOUBLE_BYTE_PAIR(0x8D49, 0x5DE7)
+DOUBLE_BYTE_PAIR(0x8D4A, 0x5DF7)
+DOUBLE_BYTE_PAIR(0x8D4B, 0x5E78)
+DOUBLE_BYTE_PAIR(0x8D4C, 0x5E83)
+DOUBLE_BYTE_PAIR(0x8D4D, 0x5E9A)
+DOUBLE_BYTE_PAIR(0x8D4E, 0x5EB7)
+DOUBLE_BYTE_PAIR(0x8D4F, 0x5F18)
+DOUBLE_BYTE_PAIR(0x8D50, 0x6052)
+DOUBLE_BYTE_PAIR(0x8D51, 0x614C)
+DOUBLE_BYTE_PAIR(0x8D52, 0x6297)
+DOUBLE_BYTE_PAIR(0x8D53, 0x62D8)
+DOUBLE_BYTE_PAIR(0x8D54, 0x63A7)
+DOUBLE_BYTE_PAIR(0x8D55, 0x653B)
+DOUBLE_BYTE_PAIR(0x8D56, 0x6602)
+DOUBLE_BYTE_PAIR(0x8D57, 0x6643)
+DOUBLE_BYTE_PAIR(0x8D58, 0x66F4)
+DOUBLE_BYTE_PAIR(0x8D59, 0x676D)
+DOUBLE_BYTE_PAIR(0x8D5A, 0x6821)
+DOUBLE_BYTE_PAIR(0x8D5B, 0x6897)
+DOUBLE_BYTE_PAIR(0x8D5C, 0x69CB)
+DOUBLE_BYTE_PAIR(0x8D5D, 0x6C5F)
+DOUBLE_BYTE_PAIR(0x8D5E, 0x6D2A)
+DOUBLE_BYTE_PAIR(0x8D5F, 0x6D69)
+DOUBLE_BYTE_PAIR(0x8D60, 0x6E2F)
+DOUBLE_BYTE_PAIR(0x8D61, 0x6E9D)
+DOUBLE_BYTE_PAIR(0x8D62, 0x7532)
+DOUBLE_BYTE_PAIR(0x8D63, 0x7687)
+DOUBLE_BYTE_PAIR(0x8D64, 0x786C)
+DOUBLE_BYTE_PAIR(0x8D65, 0x7A3F)
+DOUBLE_BYTE_PAIR(0x8D66, 0x7CE0)
+DOUBLE_BYTE_PAIR(0x8D67, 0x7D05)
+DOUBLE_BYTE_PAIR(0x8D68, 0x7D18)
+DOUBLE_BYTE_PAIR(0x8D69, 0x7D5E)
+DOUBLE_BYTE_PAIR(0x8D6A, 0x7DB1)
+DOUBLE_BYTE_PAIR(0x8D6B, 0x8015)
+DOUBLE_BYTE_PAIR(0x8D6C, 0x8003)
+DOUBLE_BYTE_PAIR(0x8D6D, 0x80AF)
+DOUBLE_BYTE_PAIR(0x8D6E, 0x80B1)
+DOUBLE_BYTE_PAIR(0x8D6F, 0x8154)
+DOUBLE_BYTE_PAIR(0x8D70, 0x818F)
+DOUBLE_BYTE_PAIR(0x8D71, 0x822A)
+DOUBLE_BYTE_PAIR(0x8D72, 0x8352)
+DOUBLE_BYTE_PAIR(0x8D73, 0x884C)
+DOUBLE_BYTE_PAIR(0x8D74, 0x8861)
+DOUBLE_BYTE_PAIR(0x8D75, 0x8B1B)
+DOUBLE_BYTE_PAIR(0x8D76, 0x8CA2)
+DOUBLE_BYTE_PAIR(0x8D77, 0x8CFC)
+DOUBLE_BYTE_PAIR(0x8D78, 0x90CA)
+DOUBLE_BYTE_PAIR(0x8D79, 0x9175)
+DOUBLE_BYTE_PAIR(0x8D7A, 0x9271)
+DOUBLE_BYTE_PAIR(0x8D7B, 0x783F)
+DOUBLE_BYTE_PAIR(0x8D7C, 0x92FC)
+DOUBLE_BYTE_PAIR(0x8D7D, 0x95A4)
+DOUBLE_BYTE_PAIR(0x8D7E, 0x964D)
+DOUBLE_BYTE_PAIR(0x8D80, 0x9805)
+DOUBLE_BYTE_PAIR(0x8D81, 0x9999)
+DOUBLE_BYTE_PAIR(0x8D82, 0x9AD8)
+DOUBLE_BYTE_PAIR(0x8D83, 0x9D3B)
+DOUBLE_BYTE_PAIR(0x8D84, 0x525B)
+DOUBLE_BYTE_PAIR(0x8D85, 0x52AB)
+DOUBLE_BYTE_PAIR(0x8D86, 0x53F7)
+DOUBLE_BYTE_PAIR(0x8D87, 0x5408)
+DOUBLE_BYTE_PAIR(0x8D88, 0x58D5)
+DOUBLE_BYTE_PAIR(0x8D89, 0x62F7)
+DOUBLE_BYTE_PAIR(0x8D8A, 0x6FE0)
+DOUBLE_BYTE_PAIR(0x8D8B, 0x8C6A)
+DOUBLE_BYTE_PAIR(0x8D8C, 0x8F5F)
+DOUBLE_BYTE_PAIR(0x8D8D, 0x9EB9)
+DOUBLE_BYTE_PAIR(0x8D8E, 0x514B)
+DOUBLE_BYTE_PAIR(0x8D8F, 0x523B)
+DOUBLE_BYTE_PAIR(0x8D90, 0x544A)
+DOUBLE_BYTE_PAIR(0x8D91, 0x56FD)
+DOUBLE_BYTE_PAIR(0x8D92, 0x7A40)
+DOUBLE_BYTE_PAIR(0x8D93, 0x9177)
+DOUBLE_BYTE_PAIR(0x8D94, 0x9D60)
+DOUBLE_BYTE_PAIR(0x8D95, 0x9ED2)
+DOUBLE_BYTE_PAIR(0x8D96, 0x7344)
+DOUBLE_BYTE_PAIR(0x8D97, 0x6F09)
+DOUBLE_BYTE_PAIR(0x8D98, 0x8170)
+DOUBLE_BYTE_PAIR(0x8D99, 0x7511)
+DOUBLE_BYTE_PAIR(0x8D9A, 0x5FFD)
+DOUBLE_BYTE_PAIR(0x8D9B, 0x60DA)
+DOUBLE_BYTE_PAIR(0x8D9C, 0x9AA8)
+DOUBLE_BYTE_PAIR(0x8D9D, 0x72DB)
+DOUBLE_BYTE_PAIR(0x8D9E, 0x8FBC)
+DOUBLE_BYTE_PAIR(0x8D9F, 0x6B64)
+DOUBLE_BYTE_PAIR(0x8DA0, 0x9803)
+DOUBLE_BYTE_PAIR(0x8DA1, 0x4ECA)
+DOUBLE_BYTE_PAIR(0x8DA2, 0x56F0)
+DOUBLE_BYTE_PAIR(0x8DA3, 0x5764)
+DOUBLE_BYTE_PAIR(0x8DA4, 0x58BE)
+DOUBLE_BYTE_PAIR(0x8DA5, 0x5A5A)
+DOUBLE_BYTE_PAIR(0x8DA6, 0x6068)
+DOUBLE_BYTE_PAIR(0x8DA7, 0x61C7)
+DOUBLE_BYTE_PAIR(0x8DA8, 0x660F)
+DOUBLE_BYTE_PAIR(0x8DA9, 0x6606)
+DOUBLE_BYTE_PAIR(0x8DAA, 0x6839)
+DOUBLE_BYTE_PAIR(0x8DAB, 0x68B1)
+DOUBLE_BYTE_PAIR(0x8DAC, 0x6DF7)
+DOUBLE_BYTE_PAIR(0x8DAD, 0x75D5)
+DOUBLE_BYTE_PAIR(0x8DAE, 0x7D3A)
+DOUBLE_BYTE_PAIR(0x8DAF, 0x826E)
+DOUBLE_BYTE_PAIR(0x8DB0, 0x9B42)
+DOUBLE_BYTE_PAIR(0x8DB1, 0x4E9B)
+DOUBLE_BYTE_PAIR(0x8DB2, 0x4F50)
+DOUBLE_BYTE_PAIR(0x8DB3, 0x53C9)
+DOUBLE_BYTE_PAIR(0x8DB4, 0x5506)
+DOUBLE_BYTE_PAIR(0x8DB5, 0x5D6F)
+DOUBLE_BYTE_PAIR(0x8DB6, 0x5DE6)
+DOUBLE_BYTE_PAIR(0x8DB7, 0x5DEE)
+DOUBLE_BYTE_PAIR(0x8DB8, 0x67FB)
+DOUBLE_BYTE_PAIR(0x8DB9, 0x6C99)
+DOUBLE_BYTE_PAIR(0x8DBA, 0x7473)
+DOUBLE_BYTE_PAIR(0x8DBB, 0x7802)
+DOUBLE_BYTE_PAIR(0x8DBC, 0x8A50)
+DOUBLE_BYTE_PAIR(0x8DBD, 0x9396)
+DOUBLE_BYTE_PAIR(0x8DBE, 0x88DF)
+DOUBLE_BYTE_PAIR(0x8DBF, 0x5750)
+DOUBLE_BYTE_PAIR(0x8DC0, 0x5EA7)
+DOUBLE_BYTE_PAIR(0x8DC1, 0x632B)
+DOUBLE_BYTE_PAIR(0x8DC2, 0x50B5)
+DOUBLE_BYTE_PAIR(0x8DC3, 0x50AC)
+DOUBLE_BYTE_PAIR(0x8DC4, 0x518D)
+DOUBLE_BYTE_PAIR(0x8DC5, 0x6700)
+DOUBLE_BYTE_PAIR(0x8DC6, 0x54C9)
+DOUBLE_BYTE_PAIR(0x8DC7, 0x585E)
+DOUBLE_BYTE_PAIR(0x8DC8, 0x59BB)
+DOUBLE_BYTE_PAIR(0x8DC9, 0x5BB0)
+DOUBLE_BYTE_PAIR(0x8DCA, 0x5F69)
+DOUBLE_BYTE_PAIR(0x8DCB, 0x624D)
+DOUBLE_BYTE_PAIR(0x8DCC, 0x63A1)
+DOUBLE_BYTE_PAIR(0x8DCD, 0x683D)
+DOUBLE_BYTE_PAIR(0x8DCE, 0x6B73)
+DOUBLE_BYTE_PAIR(0x8DCF, 0x6E08)
+DOUBLE_BYTE_PAIR(0x8DD0, 0x707D)
+DOUBLE_BYTE_PAIR(0x8DD1, 0x91C7)
+DOUBLE_BYTE_PAIR(0x8DD2, 0x7280)
+DOUBLE_BYTE_PAIR(0x8DD3, 0x7815)
+DOUBLE_BYTE_PAIR(0x8DD4, 0x7826)
+DOUBLE_BYTE_PAIR(0x8DD5, 0x796D)
+DOUBLE_BYTE_PAIR(0x8DD6, 0x658E)
+DOUBLE_BYTE_PAIR(0x8DD7, 0x7D30)
+DOUBLE_BYTE_PAIR(0x8DD8, 0x83DC)
+DOUBLE_BYTE_PAIR(0x8DD9, 0x88C1)
+DOUBLE_BYTE_PAIR(0x8DDA, 0x8F09)
+DOUBLE_BYTE_PAIR(0x8DDB, 0x969B)
+DOUBLE_BYTE_PAIR(0x8DDC, 0x5264)
+DOUBLE_BYTE_PAIR(0x8DDD, 0x5728)
+DOUBLE_BYTE_PAIR(0x8DDE, 0x6750)
+DOUBLE_BYTE_PAIR(0x8DDF, 0x7F6A)
+DOUBLE_BYTE_PAIR(0x8DE0, 0x8CA1)
+DOUBLE_BYTE_PAIR(0x8DE1, 0x51B4)
+DOUBLE_BYTE_PAIR(0x8DE2, 0x5742)
+DOUBLE_BYTE_PAIR(0x8DE3, 0x962A)
+DOUBLE_BYTE_PAIR(0x8DE4, 0x583A)
+DOUBLE_BYTE_PAIR(0x8DE5, 0x698A)
+DOUBLE_BYTE_PAIR(0x8DE6, 0x80B4)
+DOUBLE_BYTE_PAIR(0x8DE7, 0x54B2)
+DOUBLE_BYTE_PAIR(0x8DE8, 0x5D0E)
+DOUBLE_BYTE_PAIR(0x8DE9, 0x57FC)
+DOUBLE_BYTE_PAIR(0x8DEA, 0x7895)
+DOUBLE_BYTE_PAIR(0x8DEB, 0x9DFA)
+DOUBLE_BYTE_PAIR(0x8DEC, 0x4F5C)
+DOUBLE_BYTE_PAIR(0x8DED, 0x524A)
+DOUBLE_BYTE_PAIR(0x8DEE, 0x548B)
+DOUBLE_BYTE_PAIR(0x8DEF, 0x643E)
+DOUBLE_BYTE_PAIR(0x8DF0, 0x6628)
+DOUBLE_BYTE_PAIR(0x8DF1, 0x6714)
+DOUBLE_BYTE_PAIR(0x8DF2, 0x67F5)
+DOUBLE_BYTE_PAIR(0x8DF3, 0x7A84)
+DOUBLE_BYTE_PAIR(0x8DF4, 0x7B56)
+DOUBLE_BYTE_PAIR(0x8DF5, 0x7D22)
+DOUBLE_BYTE_PAIR(0x8DF6, 0x932F)
+DOUBLE_BYTE_PAIR(0x8DF7, 0x685C)
+DOUBLE_BYTE_PAIR(0x8DF8, 0x9BAD)
+DOUBLE_BYTE_PAIR(0x8DF9, 0x7B39)
+DOUBLE_BYTE_PAIR(0x8DFA, 0x5319)
+DOUBLE_BYTE_PAIR(0x8DFB, 0x518A)
+DOUBLE_BYTE_PAIR(0x8DFC, 0x5237)
+DOUBLE_BYTE_PAIR(0x8E40, 0x5BDF)
+DOUBLE_BYTE_PAIR(0x8E41, 0x62F6)
+DOUBLE_BYTE_PAIR(0x8E42, 0x64AE)
+DOUBLE_BYTE_PAIR(0x8E43, 0x64E6)
+DOUBLE_BYTE_PAIR(0x8E44, 0x672D)
+DOUBLE_BYTE_PAIR(0x8E45, 0x6BBA)
+DOUBLE_BYTE_PAIR(0x8E46, 0x85A9)
+DOUBLE_BYTE_PAIR(0x8E47, 0x96D1)
+DOUBLE_BYTE_PAIR(0x8E48, 0x7690)
+DOUBLE_BYTE_PAIR(0x8E49, 0x9BD6)
+DOUBLE_BYTE_PAIR(0x8E4A, 0x634C)
+DOUBLE_BYTE_PAIR(0x8E4B, 0x9306)
+DOUBLE_BYTE_PAIR(0x8E4C, 0x9BAB)
+DOUBLE_BYTE_PAIR(0x8E4D, 0x76BF)
+DOUBLE_BYTE_PAIR(0x8E4E, 0x6652)
+DOUBLE_BYTE_PAIR(0x8E4F, 0x4E09)
+DOUBLE_BYTE_PAIR(0x8E50, 0x5098)
+DOUBLE_BYTE_PAIR(0x8E51, 0x53C2)
+DOUBLE_BYTE_PAIR(0x8E52, 0x5C71)
+DOUBLE_BYTE_PAIR(0x8E53, 0x60E8)
+DOUBLE_BYTE_PAIR(0x8E54, 0x6492)
+DOUBLE_BYTE_PAIR(0x8E55, 0x6563)
+DOUBLE_BYTE_PAIR(0x8E56, 0x685F)
+DOUBLE_BYTE_PAIR(0x8E57, 0x71E6)
+DOUBLE_BYTE_PAIR(0x8E58, 0x73CA)
+DOUBLE_BYTE_PAIR(0x8E59, 0x7523)
+DOUBLE_BYTE_PAIR(0x8E5A, 0x7B97)
+DOUBLE_BYTE_PAIR(0x8E5B, 0x7E82)
+DOUBLE_BYTE_PAIR(0x8E5C, 0x8695)
+DOUBLE_BYTE_PAIR(0x8E5D, 0x8B83)
+DOUBLE_BYTE_PAIR(0x8E5E, 0x8CDB)
+DOUBLE_BYTE_PAIR(0x8E5F, 0x9178)
+DOUBLE_BYTE_PAIR(0x8E60, 0x9910)
+DOUBLE_BYTE_PAIR(0x8E61, 0x65AC)
+DOUBLE_BYTE_PAIR(0x8E62, 0x66AB)
+DOUBLE_BYTE_PAIR(0x8E63, 0x6B8B)
+DOUBLE_BYTE_PAIR(0x8E64, 0x4ED5)
+DOUBLE_BYTE_PAIR(0x8E65, 0x4ED4)
+DOUBLE_BYTE_PAIR(0x8E66, 0x4F3A)
+DOUBLE_BYTE_PAIR(0x8E67, 0x4F7F)
+DOUBLE_BYTE_PAIR(0x8E68, 0x523A)
+DOUBLE_BYTE_PAIR(0x8E69, 0x53F8)
+DOUBLE_BYTE_PAIR(0x8E6A, 0x53F2)
+DOUBLE_BYTE_PAIR(0x8E6B, 0x55E3)
+DOUBLE_BYTE_PAIR(0x8E6C, 0x56DB)
+DOUBLE_BYTE_PAIR(0x8E6D, 0x58EB)
+DOUBLE_BYTE_PAIR(0x8E6E, 0x59CB)
+DOUBLE_BYTE_PAIR(0x8E6F, 0x59C9)
+DOUBLE_BYTE_PAIR(0x8E70, 0x59FF)
+DOUBLE_BYTE_PAIR(0x8E71, 0x5B50)
+DOUBLE_BYTE_PAIR(0x8E72, 0x5C4D)
+DOUBLE_BYTE_PAIR(0x8E73, 0x5E02)
+DOUBLE_BYTE_PAIR(0x8E74, 0x5E2B)
+DOUBLE_BYTE_PAIR(0x8E75, 0x5FD7)
+DOUBLE_BYTE_PAIR(0x8E76, 0x601D)
+DOUBLE_BYTE_PAIR(0x8E77, 0x6307)
+DOUBLE_BYTE_PAIR(0x8E78, 0x652F)
+DOUBLE_BYTE_PAIR(0x8E79, 0x5B5C)
+DOUBLE_BYTE_PAIR(0x8E7A, 0x65AF)
+DOUBLE_BYTE_PAIR(0x8E7B, 0x65BD)
+DOUBLE_BYTE_PAIR(0x8E7C, 0x65E8)
+DOUBLE_BYTE_PAIR(0x8E7D, 0x679D)
+DOUBLE_BYTE_PAIR(0x8E7E, 0x6B62)
+DOUBLE_BYTE_PAIR(0x8E80, 0x6B7B)
+DOUBLE_BYTE_PAIR(0x8E81, 0x6C0F)
+DOUBLE_BYTE_PAIR(0x8E82, 0x7345)
+DOUBLE_BYTE_PAIR(0x8E83, 0x7949)
+DOUBLE_BYTE_PAIR(0x8E84, 0x79C1)
+DOUBLE_BYTE_PAIR(0x8E85, 0x7CF8)
+DOUBLE_BYTE_PAIR(0x8E86, 0x7D19)
+DOUBLE_BYTE_PAIR(0x8E87, 0x7D2B)
+DOUBLE_BYTE_PAIR(0x8E88, 0x80A2)
+DOUBLE_BYTE_PAIR(0x8E89, 0x8102)
+DOUBLE_BYTE_PAIR(0x8E8A, 0x81F3)
+DOUBLE_BYTE_PAIR(0x8E8B, 0x8996)
+DOUBLE_BYTE_PAIR(0x8E8C, 0x8A5E)
+DOUBLE_BYTE_PAIR(0x8E8D, 0x8A69)
+DOUBLE_BYTE_PAIR(0x8E8E, 0x8A66)
+DOUBLE_BYTE_PAIR(0x8E8F, 0x8A8C)
+DOUBLE_BYTE_PAIR(0x8E90, 0x8AEE)
+DOUBLE_BYTE_PAIR(0x8E91, 0x8CC7)
+DOUBLE_BYTE_PAIR(0x8E92, 0x8CDC)
+DOUBLE_BYTE_PAIR(0x8E93, 0x96CC)
+DOUBLE_BYTE_PAIR(0x8E94, 0x98FC)
+DOUBLE_BYTE_PAIR(0x8E95, 0x6B6F)
+DOUBLE_BYTE_PAIR(0x8E96, 0x4E8B)
+DOUBLE_BYTE_PAIR(0x8E97, 0x4F3C)
+DOUBLE_BYTE_PAIR(0x8E98, 0x4F8D)
+DOUBLE_BYTE_PAIR(0x8E99, 0x5150)
+DOUBLE_BYTE_PAIR(0x8E9A, 0x5B57)
+DOUBLE_BYTE_PAIR(0x8E9B, 0x5BFA)
+DOUBLE_BYTE_PAIR(0x8E9C, 0x6148)
+DOUBLE_BYTE_PAIR(0x8E9D, 0x6301)
+DOUBLE_BYTE_PAIR(0x8E9E, 0x6642)
+DOUBLE_BYTE_PAIR(0x8E9F, 0x6B21)
+DOUBLE_BYTE_PAIR(0x8EA0, 0x6ECB)
+DOUBLE_BYTE_PAIR(0x8EA1, 0x6CBB)
+DOUBLE_BYTE_PAIR(0x8EA2, 0x723E)
+DOUBLE_BYTE_PAIR(0x8EA3, 0x74BD)
+DOUBLE_BYTE_PAIR(0x8EA4, 0x75D4)
+DOUBLE_BYTE_PAIR(0x8EA5, 0x78C1)
+DOUBLE_BYTE_PAIR(0x8EA6, 0x793A)
+DOUBLE_BYTE_PAIR(0x8EA7, 0x800C)
+DOUBLE_BYTE_PAIR(0x8EA8, 0x8033)
+DOUBLE_BYTE_PAIR(0x8EA9, 0x81EA)
+DOUBLE_BYTE_PAIR(0x8EAA, 0x8494)
+DOUBLE_BYTE_PAIR(0x8EAB, 0x8F9E)
+DOUBLE_BYTE_PAIR(0x8EAC, 0x6C50)
+DOUBLE_BYTE_PAIR(0x8EAD, 0x9E7F)
+DOUBLE_BYTE_PAIR(0x8EAE, 0x5F0F)
+DOUBLE_BYTE_PAIR(0x8EAF, 0x8B58)
+DOUBLE_BYTE_PAIR(0x8EB0, 0x9D2B)
+DOUBLE_BYTE_PAIR(0x8EB1, 0x7AFA)
+DOUBLE_BYTE_PAIR(0x8EB2, 0x8EF8)
+DOUBLE_BYTE_PAIR(0x8EB3, 0x5B8D)
+DOUBLE_BYTE_PAIR(0x8EB4, 0x96EB)
+DOUBLE_BYTE_PAIR(0x8EB5, 0x4E03)
+DOUBLE_BYTE_PAIR(0x8EB6, 0x53F1)
+DOUBLE_BYTE_PAIR(0x8EB7, 0x57F7)
+DOUBLE_BYTE_PAIR(0x8EB8, 0x5931)
+DOUBLE_BYTE_PAIR(0x8EB9, 0x5AC9)
+DOUBLE_BYTE_PAIR(0x8EBA, 0x5BA4)
+DOUBLE_BYTE_PAIR(0x8EBB, 0x6089)
+DOUBLE_BYTE_PAIR(0x8EBC, 0x6E7F)
+DOUBLE_BYTE_PAIR(0x8EBD, 0x6F06)
+DOUBLE_BYTE_PAIR(0x8EBE, 0x75BE)
+DOUBLE_BYTE_PAIR(0x8EBF, 0x8CEA)
+DOUBLE_BYTE_PAIR(0x8EC0, 0x5B9F)
+DOUBLE_BYTE_PAIR(0x8EC1, 0x8500)
+DOUBLE_BYTE_PAIR(0x8EC2, 0x7BE0)
+DOUBLE_BYTE_PAIR(0x8EC3, 0x5072)
+DOUBLE_BYTE_PAIR(0x8EC4, 0x67F4)
+DOUBLE_BYTE_PAIR(0x8EC5, 0x829D)
+DOUBLE_BYTE_PAIR(0x8EC6, 0x5C61)
+DOUBLE_BYTE_PAIR(0x8EC7, 0x854A)
+DOUBLE_BYTE_PAIR(0x8EC8, 0x7E1E)
+DOUBLE_BYTE_PAIR(0x8EC9, 0x820E)
+DOUBLE_BYTE_PAIR(0x8ECA, 0x5199)
+DOUBLE_BYTE_PAIR(0x8ECB, 0x5C04)
+DOUBLE_BYTE_PAIR(0x8ECC, 0x6368)
+DOUBLE_BYTE_PAIR(0x8ECD, 0x8D66)
+DOUBLE_BYTE_PAIR(0x8ECE, 0x659C)
+DOUBLE_BYTE_PAIR(0x8ECF, 0x716E)
+DOUBLE_BYTE_PAIR(0x8ED0, 0x793E)
+DOUBLE_BYTE_PAIR(0x8ED1, 0x7D17)
+DOUBLE_BYTE_PAIR(0x8ED2, 0x8005)
+DOUBLE_BYTE_PAIR(0x8ED3, 0x8B1D)
+DOUBLE_BYTE_PAIR(0x8ED4, 0x8ECA)
+DOUBLE_BYTE_PAIR(0x8ED5, 0x906E)
+DOUBLE_BYTE_PAIR(0x8ED6, 0x86C7)
+DOUBLE_BYTE_PAIR(0x8ED7, 0x90AA)
+DOUBLE_BYTE_PAIR(0x8ED8, 0x501F)
+DOUBLE_BYTE_PAIR(0x8ED9, 0x52FA)
+DOUBLE_BYTE_PAIR(0x8EDA, 0x5C3A)
+DOUBLE_BYTE_PAIR(0x8EDB, 0x6753)
+DOUBLE_BYTE_PAIR(0x8EDC, 0x707C)
+DOUBLE_BYTE_PAIR(0x8EDD, 0x7235)
+DOUBLE_BYTE_PAIR(0x8EDE, 0x914C)
+DOUBLE_BYTE_PAIR(0x8EDF, 0x91C8)
+DOUBLE_BYTE_PAIR(0x8EE0, 0x932B)
+DOUBLE_BYTE_PAIR(0x8EE1, 0x82E5)
+DOUBLE_BYTE_PAIR(0x8EE2, 0x5BC2)
+DOUBLE_BYTE_PAIR(0x8EE3, 0x5F31)
+DOUBLE_BYTE_PAIR(0x8EE4, 0x60F9)
+DOUBLE_BYTE_PAIR(0x8EE5, 0x4E3B)
+DOUBLE_BYTE_PAIR(0x8EE6, 0x53D6)
+DOUBLE_BYTE_PAIR(0x8EE7, 0x5B88)
+DOUBLE_BYTE_PAIR(0x8EE8, 0x624B)
+DOUBLE_BYTE_PAIR(0x8EE9, 0x6731)
+DOUBLE_BYTE_PAIR(0x8EEA, 0x6B8A)
+DOUBLE_BYTE_PAIR(0x8EEB, 0x72E9)
+DOUBLE_BYTE_PAIR(0x8EEC, 0x73E0)
+DOUBLE_BYTE_PAIR(0x8EED, 0x7A2E)
+DOUBLE_BYTE_PAIR(0x8EEE, 0x816B)
+DOUBLE_BYTE_PAIR(0x8EEF, 0x8DA3)
+DOUBLE_BYTE_PAIR(0x8EF0, 0x9152)
+DOUBLE_BYTE_PAIR(0x8EF1, 0x9996)
+DOUBLE_BYTE_PAIR(0x8EF2, 0x5112)
+DOUBLE_BYTE_PAIR(0x8EF3, 0x53D7)
+DOUBLE_BYTE_PAIR(0x8EF4, 0x546A)
+DOUBLE_BYTE_PAIR(0x8EF5, 0x5BFF)
+DOUBLE_BYTE_PAIR(0x8EF6, 0x6388)
+DOUBLE_BYTE_PAIR(0x8EF7, 0x6A39)
+DOUBLE_BYTE_PAIR(0x8EF8, 0x7DAC)
+DOUBLE_BYTE_PAIR(0x8EF9, 0x9700)
+DOUBLE_BYTE_PAIR(0x8EFA, 0x56DA)
+DOUBLE_BYTE_PAIR(0x8EFB, 0x53CE)
+DOUBLE_BYTE_PAIR(0x8EFC, 0x5468)
+DOUBLE_BYTE_PAIR(0x8F40, 0x5B97)
+DOUBLE_BYTE_PAIR(0x8F41, 0x5C31)
+DOUBLE_BYTE_PAIR(0x8F42, 0x5DDE)
+DOUBLE_BYTE_PAIR(0x8F43, 0x4FEE)
+DOUBLE_BYTE_PAIR(0x8F44, 0x6101)
+DOUBLE_BYTE_PAIR(0x8F45, 0x62FE)
+DOUBLE_BYTE_PAIR(0x8F46, 0x6D32)
+DOUBLE_BYTE_PAIR(0x8F47, 0x79C0)
+DOUBLE_BYTE_PAIR(0x8F48, 0x79CB)
+DOUBLE_BYTE_PAIR(0x8F49, 0x7D42)
+DOUBLE_BYTE_PAIR(0x8F4A, 0x7E4D)
+DOUBLE_BYTE_PAIR(0x8F4B, 0x7FD2)
+DOUBLE_BYTE_PAIR(0x8F4C, 0x81ED)
+DOUBLE_BYTE_PAIR(0x8F4D, 0x821F)
+DOUBLE_BYTE_PAIR(0x8F4E, 0x8490)
+DOUBLE_BYTE_PAIR(0x8F4F, 0x8846)
+DOUBLE_BYTE_PAIR(0x8F50, 0x8972)
+DOUBLE_BYTE_PAIR(0x8F51, 0x8B90)
+DOUBLE_BYTE_PAIR(0x8F52, 0x8E74)
+DOUBLE_BYTE_PAIR(0x8F53, 0x8F2F)
+DOUBLE_BYTE_PAIR(0x8F54, 0x9031)
+DOUBLE_BYTE_PAIR(0x8F55, 0x914B)
+DOUBLE_BYTE_PAIR(0x8F56, 0x916C)
+DOUBLE_BYTE_PAIR(0x8F57, 0x96C6)
+DOUBLE_BYTE_PAIR(0x8F58, 0x919C)
+DOUBLE_BYTE_PAIR(0x8F59, 0x4EC0)
+DOUBLE_BYTE_PAIR(0x8F5A, 0x4F4F)
+DOUBLE_BYTE_PAIR(0x8F5B, 0x5145)
+DOUBLE_BYTE_PAIR(0x8F5C, 0x5341)
+DOUBLE_BYTE_PAIR(0x8F5D, 0x5F93)
+DOUBLE_BYTE_PAIR(0x8F5E, 0x620E)
+DOUBLE_BYTE_PAIR(0x8F5F, 0x67D4)
+DOUBLE_BYTE_PAIR(0x8F60, 0x6C41)
+DOUBLE_BYTE_PAIR(0x8F61, 0x6E0B)
+DOUBLE_BYTE_PAIR(0x8F62, 0x7363)
+DOUBLE_BYTE_PAIR(0x8F63, 0x7E26)
+DOUBLE_BYTE_PAIR(0x8F64, 0x91CD)
+DOUBLE_BYTE_PAIR(0x8F65, 0x9283)
+DOUBLE_BYTE_PAIR(0x8F66, 0x53D4)
+DOUBLE_BYTE_PAIR(0x8F67, 0x5919)
+DOUBLE_BYTE_PAIR(0x8F68, 0x5BBF)
+DOUBLE_BYTE_PAIR(0x8F69, 0x6DD1)
+DOUBLE_BYTE_PAIR(0x8F6A, 0x795D)
+DOUBLE_BYTE_PAIR(0x8F6B, 0x7E2E)
+DOUBLE_BYTE_PAIR(0x8F6C, 0x7C9B)
+DOUBLE_BYTE_PAIR(0x8F6D, 0x587E)
+DOUBLE_BYTE_PAIR(0x8F6E, 0x719F)
+DOUBLE_BYTE_PAIR(0x8F6F, 0x51FA)
+DOUBLE_BYTE_PAIR(0x8F70, 0x8853)
+DOUBLE_BYTE_PAIR(0x8F71, 0x8FF0)
+DOUBLE_BYTE_PAIR(0x8F72, 0x4FCA)
+DOUBLE_BYTE_PAIR(0x8F73, 0x5CFB)
+DOUBLE_BYTE_PAIR(0x8F74, 0x6625)
+DOUBLE_BYTE_PAIR(0x8F75, 0x77AC)
+DOUBLE_BYTE_PAIR(0x8F76, 0x7AE3)
+DOUBLE_BYTE_PAIR(0x8F77, 0x821C)
+DOUBLE_BYTE_PAIR(0x8F78, 0x99FF)
+DOUBLE_BYTE_PAIR(0x8F79, 0x51C6)
+DOUBLE_BYTE_PAIR(0x8F7A, 0x5FAA)
+DOUBLE_BYTE_PAIR(0x8F7B, 0x65EC)
+DOUBLE_BYTE_PAIR(0x8F7C, 0x696F)
+DOUBLE_BYTE_PAIR(0x8F7D, 0x6B89)
+DOUBLE_BYTE_PAIR(0x8F7E, 0x6DF3)
+DOUBLE_BYTE_PAIR(0x8F80, 0x6E96)
+DOUBLE_BYTE_PAIR(0x8F81, 0x6F64)
+DOUBLE_BYTE_PAIR(0x8F82, 0x76FE)
+DOUBLE_BYTE_PAIR(0x8F83, 0x7D14)
+DOUBLE_BYTE_PAIR(0x8F84, 0x5DE1)
+DOUBLE_BYTE_PAIR(0x8F85, 0x9075)
+DOUBLE_BYTE_PAIR(0x8F86, 0x9187)
+DOUBLE_BYTE_PAIR(0x8F87, 0x9806)
+DOUBLE_BYTE_PAIR(0x8F88, 0x51E6)
+DOUBLE_BYTE_PAIR(0x8F89, 0x521D)
+DOUBLE_BYTE_PAIR(0x8F8A, 0x6240)
+DOUBLE_BYTE_PAIR(0x8F8B, 0x6691)
+DOUBLE_BYTE_PAIR(0x8F8C, 0x66D9)
+DOUBLE_BYTE_PAIR(0x8F8D, 0x6E1A)
+DOUBLE_BYTE_PAIR(0x8F8E, 0x5EB6)
+DOUBLE_BYTE_PAIR(0x8F8F, 0x7DD2)
+DOUBLE_BYTE_PAIR(0x8F90, 0x7F72)
+DOUBLE_BYTE_PAIR(0x8F91, 0x66F8)
+DOUBLE_BYTE_PAIR(0x8F92, 0x85AF)
+DOUBLE_BYTE_PAIR(0x8F93, 0x85F7)
+DOUBLE_BYTE_PAIR(0x8F94, 0x8AF8)
+DOUBLE_BYTE_PAIR(0x8F95, 0x52A9)
+DOUBLE_BYTE_PAIR(0x8F96, 0x53D9)
+DOUBLE_BYTE_PAIR(0x8F97, 0x5973)
+DOUBLE_BYTE_PAIR(0x8F98, 0x5E8F)
+DOUBLE_BYTE_PAIR(0x8F99, 0x5F90)
+DOUBLE_BYTE_PAIR(0x8F9A, 0x6055)
+DOUBLE_BYTE_PAIR(0x8F9B, 0x92E4)
+DOUBLE_BYTE_PAIR(0x8F9C, 0x9664)
+DOUBLE_BYTE_PAIR(0x8F9D, 0x50B7)
+DOUBLE_BYTE_PAIR(0x8F9E, 0x511F)
+DOUBLE_BYTE_PAIR(0x8F9F, 0x52DD)
+DOUBLE_BYTE_PAIR(0x8FA0, 0x5320)
+DOUBLE_BYTE_PAIR(0x8FA1, 0x5347)
+DOUBLE_BYTE_PAIR(0x8FA2, 0x53EC)
+DOUBLE_BYTE_PAIR(0x8FA3, 0x54E8)
+DOUBLE_BYTE_PAIR(0x8FA4, 0x5546)
+DOUBLE_BYTE_PAIR(0x8FA5, 0x5531)
+DOUBLE_BYTE_PAIR(0x8FA6, 0x5617)
+DOUBLE_BYTE_PAIR(0x8FA7, 0x5968)
+DOUBLE_BYTE_PAIR(0x8FA8, 0x59BE)
+DOUBLE_BYTE_PAIR(0x8FA9, 0x5A3C)
+DOUBLE_BYTE_PAIR(0x8FAA, 0x5BB5)
+DOUBLE_BYTE_PAIR(0x8FAB, 0x5C06)
+DOUBLE_BYTE_PAIR(0x8FAC, 0x5C0F)
+DOUBLE_BYTE_PAIR(0x8FAD, 0x5C11)
+DOUBLE_BYTE_PAIR(0x8FAE, 0x5C1A)
+DOUBLE_BYTE_PAIR(0x8FAF, 0x5E84)
+DOUBLE_BYTE_PAIR(0x8FB0, 0x5E8A)
+DOUBLE_BYTE_PAIR(0x8FB1, 0x5EE0)
+DOUBLE_BYTE_PAIR(0x8FB2, 0x5F70)
+DOUBLE_BYTE_PAIR(0x8FB3, 0x627F)
+DOUBLE_BYTE_PAIR(0x8FB4, 0x6284)
+DOUBLE_BYTE_PAIR(0x8FB5, 0x62DB)
+DOUBLE_BYTE_PAIR(0x8FB6, 0x638C)
+DOUBLE_BYTE_PAIR(0x8FB7, 0x6377)
+DOUBLE_BYTE_PAIR(0x8FB8, 0x6607)
+DOUBLE_BYTE_PAIR(0x8FB9, 0x660C)
+DOUBLE_BYTE_PAIR(0x8FBA, 0x662D)
+DOUBLE_BYTE_PAIR(0x8FBB, 0x6676)
+DOUBLE_BYTE_PAIR(0x8FBC, 0x677E)
+DOUBLE_BYTE_PAIR(0x8FBD, 0x68A2)
+DOUBLE_BYTE_PAIR(0x8FBE, 0x6A1F)
+DOUBLE_BYTE_PAIR(0x8FBF, 0x6A35)
+DOUBLE_BYTE_PAIR(0x8FC0, 0x6CBC)
+DOUBLE_BYTE_PAIR(0x8FC1, 0x6D88)
+DOUBLE_BYTE_PAIR(0x8FC2, 0x6E09)
+DOUBLE_BYTE_PAIR(0x8FC3, 0x6E58)
+DOUBLE_BYTE_PAIR(0x8FC4, 0x713C)
+DOUBLE_BYTE_PAIR(0x8FC5, 0x7126)
+DOUBLE_BYTE_PAIR(0x8FC6, 0x7167)
+DOUBLE_BYTE_PAIR(0x8FC7, 0x75C7)
+DOUBLE_BYTE_PAIR(0x8FC8, 0x7701)
+DOUBLE_BYTE_PAIR(0x8FC9, 0x785D)
+DOUBLE_BYTE_PAIR(0x8FCA, 0x7901)
+DOUBLE_BYTE_PAIR(0x8FCB, 0x7965)
+DOUBLE_BYTE_PAIR(0x8FCC, 0x79F0)
+DOUBLE_BYTE_PAIR(0x8FCD, 0x7AE0)
+DOUBLE_BYTE_PAIR(0x8FCE, 0x7B11)
+DOUBLE_BYTE_PAIR(0x8FCF, 0x7CA7)
+DOUBLE_BYTE_PAIR(0x8FD0, 0x7D39)
+DOUBLE_BYTE_PAIR(0x8FD1, 0x8096)
+DOUBLE_BYTE_PAIR(0x8FD2, 0x83D6)
+DOUBLE_BYTE_PAIR(0x8FD3, 0x848B)
+DOUBLE_BYTE_PAIR(0x8FD4, 0x8549)
+DOUBLE_BYTE_PAIR(0x8FD5, 0x885D)
+DOUBLE_BYTE_PAIR(0x8FD6, 0x88F3)
+DOUBLE_BYTE_PAIR(0x8FD7, 0x8A1F)
+DOUBLE_BYTE_PAIR(0x8FD8, 0x8A3C)
+DOUBLE_BYTE_PAIR(0x8FD9, 0x8A54)
+DOUBLE_BYTE_PAIR(0x8FDA, 0x8A73)
+DOUBLE_BYTE_PAIR(0x8FDB, 0x8C61)
+DOUBLE_BYTE_PAIR(0x8FDC, 0x8CDE)
+DOUBLE_BYTE_PAIR(0x8FDD, 0x91A4)
+DOUBLE_BYTE_PAIR(0x8FDE, 0x9266)
+DOUBLE_BYTE_PAIR(0x8FDF, 0x937E)
+DOUBLE_BYTE_PAIR(0x8FE0, 0x9418)
+DOUBLE_BYTE_PAIR(0x8FE1, 0x969C)
+DOUBLE_BYTE_PAIR(0x8FE2, 0x9798)
+DOUBLE_BYTE_PAIR(0x8FE3, 0x4E0A)
+DOUBLE_BYTE_PAIR(0x8FE4, 0x4E08)
+DOUBLE_BYTE_PAIR(0x8FE5, 0x4E1E)
+DOUBLE_BYTE_PAIR(0x8FE6, 0x4E57)
+DOUBLE_BYTE_PAIR(0x8FE7, 0x5197)
+DOUBLE_BYTE_PAIR(0x8FE8, 0x5270)
+DOUBLE_BYTE_PAIR(0x8FE9, 0x57CE)
+DOUBLE_BYTE_PAIR(0x8FEA, 0x5834)
+DOUBLE_BYTE_PAIR(0x8FEB, 0x58CC)
+DOUBLE_BYTE_PAIR(0x8FEC, 0x5B22)
+DOUBLE_BYTE_PAIR(0x8FED, 0x5E38)
+DOUBLE_BYTE_PAIR(0x8FEE, 0x60C5)
+DOUBLE_BYTE_PAIR(0x8FEF, 0x64FE)
+DOUBLE_BYTE_PAIR(0x8FF0, 0x6761)
+DOUBLE_BYTE_PAIR(0x8FF1, 0x6756)
+DOUBLE_BYTE_PAIR(0x8FF2, 0x6D44)
+DOUBLE_BYTE_PAIR(0x8FF3, 0x72B6)
+DOUBLE_BYTE_PAIR(0x8FF4, 0x7573)
+DOUBLE_BYTE_PAIR(0x8FF5, 0x7A63)
+DOUBLE_BYTE_PAIR(0x8FF6, 0x84B8)
+DOUBLE_BYTE_PAIR(0x8FF7, 0x8B72)
+DOUBLE_BYTE_PAIR(0x8FF8, 0x91B8)
+DOUBLE_BYTE_PAIR(0x8FF9, 0x9320)
+DOUBLE_BYTE_PAIR(0x8FFA, 0x5631)
+DOUBLE_BYTE_PAIR(0x8FFB, 0x57F4)
+DOUBLE_BYTE_PAIR(0x8FFC, 0x98FE)
+DOUBLE_BYTE_PAIR(0x9040, 0x62ED)
+DOUBLE_BYTE_PAIR(0x9041, 0x690D)
+DOUBLE_BYTE_PAIR(0x9042, 0x6B96)
+DOUBLE_BYTE_PAIR(0x9043, 0x71ED)
+DOUBLE_BYTE_PAIR(0x9044, 0x7E54)
+DOUBLE_BYTE_PAIR(0x9045, 0x8077)
+DOUBLE_BYTE_PAIR(0x9046, 0x8272)
+DOUBLE_BYTE_PAIR(0x9047, 0x89E6)
+DOUBLE_BYTE_PAIR(0x9048, 0x98DF)
+DOUBLE_BYTE_PAIR(0x9049, 0x8755)
+DOUBLE_BYTE_PAIR(0x904A, 0x8FB1)
+DOUBLE_BYTE_PAIR(0x904B, 0x5C3B)
+DOUBLE_BYTE_PAIR(0x904C, 0x4F38)
+DOUBLE_BYTE_PAIR(0x904D, 0x4FE1)
+DOUBLE_BYTE_PAIR(0x904E, 0x4FB5)
+DOUBLE_BYTE_PAIR(0x904F, 0x5507)
+DOUBLE_BYTE_PAIR(0x9050, 0x5A20)
+DOUBLE_BYTE_PAIR(0x9051, 0x5BDD)
+DOUBLE_BYTE_PAIR(0x9052, 0x5BE9)
+DOUBLE_BYTE_PAIR(0x9053, 0x5FC3)
+DOUBLE_BYTE_PAIR(0x9054, 0x614E)
+DOUBLE_BYTE_PAIR(0x9055, 0x632F)
+DOUBLE_BYTE_PAIR(0x9056, 0x65B0)
+DOUBLE_BYTE_PAIR(0x9057, 0x664B)
+DOUBLE_BYTE_PAIR(0x9058, 0x68EE)
+DOUBLE_BYTE_PAIR(0x9059, 0x699B)
+DOUBLE_BYTE_PAIR(0x905A, 0x6D78)
+DOUBLE_BYTE_PAIR(0x905B, 0x6DF1)
+DOUBLE_BYTE_PAIR(0x905C, 0x7533)
+DOUBLE_BYTE_PAIR(0x905D, 0x75B9)
+DOUBLE_BYTE_PAIR(0x905E, 0x771F)
+DOUBLE_BYTE_PAIR(0x905F, 0x795E)
+DOUBLE_BYTE_PAIR(0x9060, 0x79E6)
+DOUBLE_BYTE_PAIR(0x9061, 0x7D33)
+DOUBLE_BYTE_PAIR(0x9062, 0x81E3)
+DOUBLE_BYTE_PAIR(0x9063, 0x82AF)
+DOUBLE_BYTE_PAIR(0x9064, 0x85AA)
+DOUBLE_BYTE_PAIR(0x9065, 0x89AA)
+DOUBLE_BYTE_PAIR(0x9066, 0x8A3A)
+DOUBLE_BYTE_PAIR(0x9067, 0x8EAB)
+DOUBLE_BYTE_PAIR(0x9068, 0x8F9B)
+DOUBLE_BYTE_PAIR(0x9069, 0x9032)
+DOUBLE_BYTE_PAIR(0x906A, 0x91DD)
+DOUBLE_BYTE_PAIR(0x906B, 0x9707)
+DOUBLE_BYTE_PAIR(0x906C, 0x4EBA)
+DOUBLE_BYTE_PAIR(0x906D, 0x4EC1)
+DOUBLE_BYTE_PAIR(0x906E, 0x5203)
+DOUBLE_BYTE_PAIR(0x906F, 0x5875)
+DOUBLE_BYTE_PAIR(0x9070, 0x58EC)
+DOUBLE_BYTE_PAIR(0x9071, 0x5C0B)
+DOUBLE_BYTE_PAIR(0x9072, 0x751A)
+DOUBLE_BYTE_PAIR(0x9073, 0x5C3D)
+DOUBLE_BYTE_PAIR(0x9074, 0x814E)
+DOUBLE_BYTE_PAIR(0x9075, 0x8A0A)
+DOUBLE_BYTE_PAIR(0x9076, 0x8FC5)
+DOUBLE_BYTE_PAIR(0x9077, 0x9663)
+DOUBLE_BYTE_PAIR(0x9078, 0x976D)
+DOUBLE_BYTE_PAIR(0x9079, 0x7B25)
+DOUBLE_BYTE_PAIR(0x907A, 0x8ACF)
+DOUBLE_BYTE_PAIR(0x907B, 0x9808)
+DOUBLE_BYTE_PAIR(0x907C, 0x9162)
+DOUBLE_BYTE_PAIR(0x907D, 0x56F3)
+DOUBLE_BYTE_PAIR(0x907E, 0x53A8)
+DOUBLE_BYTE_PAIR(0x9080, 0x9017)
+DOUBLE_BYTE_PAIR(0x9081, 0x5439)
+DOUBLE_BYTE_PAIR(0x9082, 0x5782)
+DOUBLE_BYTE_PAIR(0x9083, 0x5E25)
+DOUBLE_BYTE_PAIR(0x9084, 0x63A8)
+DOUBLE_BYTE_PAIR(0x9085, 0x6C34)
+DOUBLE_BYTE_PAIR(0x9086, 0x708A)
+DOUBLE_BYTE_PAIR(0x9087, 0x7761)
+DOUBLE_BYTE_PAIR(0x9088, 0x7C8B)
+DOUBLE_BYTE_PAIR(0x9089, 0x7FE0)
+DOUBLE_BYTE_PAIR(0x908A, 0x8870)
+DOUBLE_BYTE_PAIR(0x908B, 0x9042)
+DOUBLE_BYTE_PAIR(0x908C, 0x9154)
+DOUBLE_BYTE_PAIR(0x908D, 0x9310)
+DOUBLE_BYTE_PAIR(0x908E, 0x9318)
+DOUBLE_BYTE_PAIR(0x908F, 0x968F)
+DOUBLE_BYTE_PAIR(0x9090, 0x745E)
+DOUBLE_BYTE_PAIR(0x9091, 0x9AC4)
+DOUBLE_BYTE_PAIR(0x9092, 0x5D07)
+DOUBLE_BYTE_PAIR(0x9093, 0x5D69)
+DOUBLE_BYTE_PAIR(0x9094, 0x6570)
+DOUBLE_BYTE_PAIR(0x9095, 0x67A2)
+DOUBLE_BYTE_PAIR(0x9096, 0x8DA8)
+DOUBLE_BYTE_PAIR(0x9097, 0x96DB)
+DOUBLE_BYTE_PAIR(0x9098, 0x636E)
+DOUBLE_BYTE_PAIR(0x9099, 0x6749)
+DOUBLE_BYTE_PAIR(0x909A, 0x6919)
+DOUBLE_BYTE_PAIR(0x909B, 0x83C5)
+DOUBLE_BYTE_PAIR(0x909C, 0x9817)
+DOUBLE_BYTE_PAIR(0x909D, 0x96C0)
+DOUBLE_BYTE_PAIR(0x909E, 0x88FE)
+DOUBLE_BYTE_PAIR(0x909F, 0x6F84)
+DOUBLE_BYTE_PAIR(0x90A0, 0x647A)
+DOUBLE_BYTE_PAIR(0x90A1, 0x5BF8)
+DOUBLE_BYTE_PAIR(0x90A2, 0x4E16)
+DOUBLE_BYTE_PAIR(0x90A3, 0x702C)
+DOUBLE_BYTE_PAIR(0x90A4, 0x755D)
+DOUBLE_BYTE_PAIR(0x90A5, 0x662F)
+DOUBLE_BYTE_PAIR(0x90A6, 0x51C4)
+DOUBLE_BYTE_PAIR(0x90A7, 0x5236)
+DOUBLE_BYTE_PAIR(0x90A8, 0x52E2)
+DOUBLE_BYTE_PAIR(0x90A9, 0x59D3)
+DOUBLE_BYTE_PAIR(0x90AA, 0x5F81)
+DOUBLE_BYTE_PAIR(0x90AB, 0x6027)
+DOUBLE_BYTE_PAIR(0x90AC, 0x6210)
+DOUBLE_BYTE_PAIR(0x90AD, 0x653F)
+DOUBLE_BYTE_PAIR(0x90AE, 0x6574)
+DOUBLE_BYTE_PAIR(0x90AF, 0x661F)
+DOUBLE_BYTE_PAIR(0x90B0, 0x6674)
+DOUBLE_BYTE_PAIR(0x90B1, 0x68F2)
+DOUBLE_BYTE_PAIR(0x90B2, 0x6816)
+DOUBLE_BYTE_PAIR(0x90B3, 0x6B63)
+DOUBLE_BYTE_PAIR(0x90B4, 0x6E05)
+DOUBLE_BYTE_PAIR(0x90B5, 0x7272)
+DOUBLE_BYTE_PAIR(0x90B6, 0x751F)
+DOUBLE_BYTE_PAIR(0x90B7, 0x76DB)
+DOUBLE_BYTE_PAIR(0x90B8, 0x7CBE)
+DOUBLE_BYTE_PAIR(0x90B9, 0x8056)
+DOUBLE_BYTE_PAIR(0x90BA, 0x58F0)
+DOUBLE_BYTE_PAIR(0x90BB, 0x88FD)
+DOUBLE_BYTE_PAIR(0x90BC, 0x897F)
+DOUBLE_BYTE_PAIR(0x90BD, 0x8AA0)
+DOUBLE_BYTE_PAIR(0x90BE, 0x8A93)
+DOUBLE_BYTE_PAIR(0x90BF, 0x8ACB)
+DOUBLE_BYTE_PAIR(0x90C0, 0x901D)
+DOUBLE_BYTE_PAIR(0x90C1, 0x9192)
+DOUBLE_BYTE_PAIR(0x90C2, 0x9752)
+DOUBLE_BYTE_PAIR(0x90C3, 0x9759)
+DOUBLE_BYTE_PAIR(0x90C4, 0x6589)
+DOUBLE_BYTE_PAIR(0x90C5, 0x7A0E)
+DOUBLE_BYTE_PAIR(0x90C6, 0x8106)
+DOUBLE_BYTE_PAIR(0x90C7, 0x96BB)
+DOUBLE_BYTE_PAIR(0x90C8, 0x5E2D)
+DOUBLE_BYTE_PAIR(0x90C9, 0x60DC)
+DOUBLE_BYTE_PAIR(0x90CA, 0x621A)
+DOUBLE_BYTE_PAIR(0x90CB, 0x65A5)
+DOUBLE_BYTE_PAIR(0x90CC, 0x6614)
+DOUBLE_BYTE_PAIR(0x90CD, 0x6790)
+DOUBLE_BYTE_PAIR(0x90CE, 0x77F3)
+DOUBLE_BYTE_PAIR(0x90CF, 0x7A4D)
+DOUBLE_BYTE_PAIR(0x90D0, 0x7C4D)
+DOUBLE_BYTE_PAIR(0x90D1, 0x7E3E)
+DOUBLE_BYTE_PAIR(0x90D2, 0x810A)
+DOUBLE_BYTE_PAIR(0x90D3, 0x8CAC)
+DOUBLE_BYTE_PAIR(0x90D4, 0x8D64)
+DOUBLE_BYTE_PAIR(0x90D5, 0x8DE1)
+DOUBLE_BYTE_PAIR(0x90D6, 0x8E5F)
+DOUBLE_BYTE_PAIR(0x90D7, 0x78A9)
+DOUBLE_BYTE_PAIR(0x90D8, 0x5207)
+DOUBLE_BYTE_PAIR(0x90D9, 0x62D9)
+DOUBLE_BYTE_PAIR(0x90DA, 0x63A5)
+DOUBLE_BYTE_PAIR(0x90DB, 0x6442)
+DOUBLE_BYTE_PAIR(0x90DC, 0x6298)
+DOUBLE_BYTE_PAIR(0x90DD, 0x8A2D)
+DOUBLE_BYTE_PAIR(0x90DE, 0x7A83)
+DOUBLE_BYTE_PAIR(0x90DF, 0x7BC0)
+DOUBLE_BYTE_PAIR(0x90E0, 0x8AAC)
+DOUBLE_BYTE_PAIR(0x90E1, 0x96EA)
+DOUBLE_BYTE_PAIR(0x90E2, 0x7D76)
+DOUBLE_BYTE_PAIR(0x90E3, 0x820C)
+DOUBLE_BYTE_PAIR(0x90E4, 0x8749)
+DOUBLE_BYTE_PAIR(0x90E5, 0x4ED9)
+DOUBLE_BYTE_PAIR(0x90E6, 0x5148)
+DOUBLE_BYTE_PAIR(0x90E7, 0x5343)
+DOUBLE_BYTE_PAIR(0x90E8, 0x5360)
+DOUBLE_BYTE_PAIR(0x90E9, 0x5BA3)
+DOUBLE_BYTE_PAIR(0x90EA, 0x5C02)
+DOUBLE_BYTE_PAIR(0x90EB, 0x5C16)
+DOUBLE_BYTE_PAIR(0x90EC, 0x5DDD)
+DOUBLE_BYTE_PAIR(0x90ED, 0x6226)
+DOUBLE_BYTE_PAIR(0x90EE, 0x6247)
+DOUBLE_BYTE_PAIR(0x90EF, 0x64B0)
+DOUBLE_BYTE_PAIR(0x90F0, 0x6813)
+DOUBLE_BYTE_PAIR(0x90F1, 0x6834)
+DOUBLE_BYTE_PAIR(0x90F2, 0x6CC9)
+DOUBLE_BYTE_PAIR(0x90F3, 0x6D45)
+DOUBLE_BYTE_PAIR(0x90F4, 0x6D17)
+DOUBLE_BYTE_PAIR(0x90F5, 0x67D3)
+DOUBLE_BYTE_PAIR(0x90F6, 0x6F5C)
+DOUBLE_BYTE_PAIR(0x90F7, 0x714E)
+DOUBLE_BYTE_PAIR(0x90F8, 0x717D)
+DOUBLE_BYTE_PAIR(0x90F9, 0x65CB)
+DOUBLE_BYTE_PAIR(0x90FA, 0x7A7F)
+DOUBLE_BYTE_PAIR(0x90FB, 0x7BAD)
+DOUBLE_BYTE_PAIR(0x90FC, 0x7DDA)
+DOUBLE_BYTE_PAIR(0x9140, 0x7E4A)
+DOUBLE_BYTE_PAIR(0x9141, 0x7FA8)
+DOUBLE_BYTE_PAIR(0x9142, 0x817A)
+DOUBLE_BYTE_PAIR(0x9143, 0x821B)
+DOUBLE_BYTE_PAIR(0x9144, 0x8239)
+DOUBLE_BYTE_PAIR(0x9145, 0x85A6)
+DOUBLE_BYTE_PAIR(0x9146, 0x8A6E)
+DOUBLE_BYTE_PAIR(0x9147, 0x8CCE)
+DOUBLE_BYTE_PAIR(0x9148, 0x8DF5)
+DOUBLE_BYTE_PAIR(0x9149, 0x9078)
+DOUBLE_BYTE_PAIR(0x914A, 0x9077)
+DOUBLE_BYTE_PAIR(0x914B, 0x92AD)
+DOUBLE_BYTE_PAIR(0x914C, 0x9291)
+DOUBLE_BYTE_PAIR(0x914D, 0x9583)
+DOUBLE_BYTE_PAIR(0x914E, 0x9BAE)
+DOUBLE_BYTE_PAIR(0x914F, 0x524D)
+DOUBLE_BYTE_PAIR(0x9150, 0x5584)
+DOUBLE_BYTE_PAIR(0x9151, 0x6F38)
+DOUBLE_BYTE_PAIR(0x9152, 0x7136)
+DOUBLE_BYTE_PAIR(0x9153, 0x5168)
+DOUBLE_BYTE_PAIR(0x9154, 0x7985)
+DOUBLE_BYTE_PAIR(0x9155, 0x7E55)
+DOUBLE_BYTE_PAIR(0x9156, 0x81B3)
+DOUBLE_BYTE_PAIR(0x9157, 0x7CCE)
+DOUBLE_BYTE_PAIR(0x9158, 0x564C)
+DOUBLE_BYTE_PAIR(0x9159, 0x5851)
+DOUBLE_BYTE_PAIR(0x915A, 0x5CA8)
+DOUBLE_BYTE_PAIR(0x915B, 0x63AA)
+DOUBLE_BYTE_PAIR(0x915C, 0x66FE)
+DOUBLE_BYTE_PAIR(0x915D, 0x66FD)
+DOUBLE_BYTE_PAIR(0x915E, 0x695A)
+DOUBLE_BYTE_PAIR(0x915F, 0x72D9)
+DOUBLE_BYTE_PAIR(0x9160, 0x758F)
+DOUBLE_BYTE_PAIR(0x9161, 0x758E)
+DOUBLE_BYTE_PAIR(0x9162, 0x790E)
+DOUBLE_BYTE_PAIR(0x9163, 0x7956)
+DOUBLE_BYTE_PAIR(0x9164, 0x79DF)
+DOUBLE_BYTE_PAIR(0x9165, 0x7C97)
+DOUBLE_BYTE_PAIR(0x9166, 0x7D20)
+DOUBLE_BYTE_PAIR(0x9167, 0x7D44)
+DOUBLE_BYTE_PAIR(0x9168, 0x8607)
+DOUBLE_BYTE_PAIR(0x9169, 0x8A34)
+DOUBLE_BYTE_PAIR(0x916A, 0x963B)
+DOUBLE_BYTE_PAIR(0x916B, 0x9061)
+DOUBLE_BYTE_PAIR(0x916C, 0x9F20)
+DOUBLE_BYTE_PAIR(0x916D, 0x50E7)
+DOUBLE_BYTE_PAIR(0x916E, 0x5275)
+DOUBLE_BYTE_PAIR(0x916F, 0x53CC)
+DOUBLE_BYTE_PAIR(0x9170, 0x53E2)
+DOUBLE_BYTE_PAIR(0x9171, 0x5009)
+DOUBLE_BYTE_PAIR(0x9172, 0x55AA)
+DOUBLE_BYTE_PAIR(0x9173, 0x58EE)
+DOUBLE_BYTE_PAIR(0x9174, 0x594F)
+DOUBLE_BYTE_PAIR(0x9175, 0x723D)
+DOUBLE_BYTE_PAIR(0x9176, 0x5B8B)
+DOUBLE_BYTE_PAIR(0x9177, 0x5C64)
+DOUBLE_BYTE_PAIR(0x9178, 0x531D)
+DOUBLE_BYTE_PAIR(0x9179, 0x60E3)
+DOUBLE_BYTE_PAIR(0x917A, 0x60F3)
+DOUBLE_BYTE_PAIR(0x917B, 0x635C)
+DOUBLE_BYTE_PAIR(0x917C, 0x6383)
+DOUBLE_BYTE_PAIR(0x917D, 0x633F)
+DOUBLE_BYTE_PAIR(0x917E, 0x63BB)
+DOUBLE_BYTE_PAIR(0x9180, 0x64CD)
+DOUBLE_BYTE_PAIR(0x9181, 0x65E9)
+DOUBLE_BYTE_PAIR(0x9182, 0x66F9)
+DOUBLE_BYTE_PAIR(0x9183, 0x5DE3)
+DOUBLE_BYTE_PAIR(0x9184, 0x69CD)
+DOUBLE_BYTE_PAIR(0x9185, 0x69FD)
+DOUBLE_BYTE_PAIR(0x9186, 0x6F15)
+DOUBLE_BYTE_PAIR(0x9187, 0x71E5)
+DOUBLE_BYTE_PAIR(0x9188, 0x4E89)
+DOUBLE_BYTE_PAIR(0x9189, 0x75E9)
+DOUBLE_BYTE_PAIR(0x918A, 0x76F8)
+DOUBLE_BYTE_PAIR(0x918B, 0x7A93)
+DOUBLE_BYTE_PAIR(0x918C, 0x7CDF)
+DOUBLE_BYTE_PAIR(0x918D, 0x7DCF)
+DOUBLE_BYTE_PAIR(0x918E, 0x7D9C)
+DOUBLE_BYTE_PAIR(0x918F, 0x8061)
+DOUBLE_BYTE_PAIR(0x9190, 0x8349)
+DOUBLE_BYTE_PAIR(0x9191, 0x8358)
+DOUBLE_BYTE_PAIR(0x9192, 0x846C)
+DOUBLE_BYTE_PAIR(0x9193, 0x84BC)
+DOUBLE_BYTE_PAIR(0x9194, 0x85FB)
+DOUBLE_BYTE_PAIR(0x9195, 0x88C5)
+DOUBLE_BYTE_PAIR(0x9196, 0x8D70)
+DOUBLE_BYTE_PAIR(0x9197, 0x9001)
+DOUBLE_BYTE_PAIR(0x9198, 0x906D)
+DOUBLE_BYTE_PAIR(0x9199, 0x9397)
+DOUBLE_BYTE_PAIR(0x919A, 0x971C)
+DOUBLE_BYTE_PAIR(0x919B, 0x9A12)
+DOUBLE_BYTE_PAIR(0x919C, 0x50CF)
+DOUBLE_BYTE_PAIR(0x919D, 0x5897)
+DOUBLE_BYTE_PAIR(0x919E, 0x618E)
+DOUBLE_BYTE_PAIR(0x919F, 0x81D3)
+DOUBLE_BYTE_PAIR(0x91A0, 0x8535)
+DOUBLE_BYTE_PAIR(0x91A1, 0x8D08)
+DOUBLE_BYTE_PAIR(0x91A2, 0x9020)
+DOUBLE_BYTE_PAIR(0x91A3, 0x4FC3)
+DOUBLE_BYTE_PAIR(0x91A4, 0x5074)
+DOUBLE_BYTE_PAIR(0x91A5, 0x5247)
+DOUBLE_BYTE_PAIR(0x91A6, 0x5373)
+DOUBLE_BYTE_PAIR(0x91A7, 0x606F)
+DOUBLE_BYTE_PAIR(0x91A8, 0x6349)
+DOUBLE_BYTE_PAIR(0x91A9, 0x675F)
+DOUBLE_BYTE_PAIR(0x91AA, 0x6E2C)
+DOUBLE_BYTE_PAIR(0x91AB, 0x8DB3)
+DOUBLE_BYTE_PAIR(0x91AC, 0x901F)
+DOUBLE_BYTE_PAIR(0x91AD, 0x4FD7)
+DOUBLE_BYTE_PAIR(0x91AE, 0x5C5E)
+DOUBLE_BYTE_PAIR(0x91AF, 0x8CCA)
+DOUBLE_BYTE_PAIR(0x91B0, 0x65CF)
+DOUBLE_BYTE_PAIR(0x91B1, 0x7D9A)
+DOUBLE_BYTE_PAIR(0x91B2, 0x5352)
+DOUBLE_BYTE_PAIR(0x91B3, 0x8896)
+DOUBLE_BYTE_PAIR(0x91B4, 0x5176)
+DOUBLE_BYTE_PAIR(0x91B5, 0x63C3)
+DOUBLE_BYTE_PAIR(0x91B6, 0x5B58)
+DOUBLE_BYTE_PAIR(0x91B7, 0x5B6B)
+DOUBLE_BYTE_PAIR(0x91B8, 0x5C0A)
+DOUBLE_BYTE_PAIR(0x91B9, 0x640D)
+DOUBLE_BYTE_PAIR(0x91BA, 0x6751)
+DOUBLE_BYTE_PAIR(0x91BB, 0x905C)
+DOUBLE_BYTE_PAIR(0x91BC, 0x4ED6)
+DOUBLE_BYTE_PAIR(0x91BD, 0x591A)
+DOUBLE_BYTE_PAIR(0x91BE, 0x592A)
+DOUBLE_BYTE_PAIR(0x91BF, 0x6C70)
+DOUBLE_BYTE_PAIR(0x91C0, 0x8A51)
+DOUBLE_BYTE_PAIR(0x91C1, 0x553E)
+DOUBLE_BYTE_PAIR(0x91C2, 0x5815)
+DOUBLE_BYTE_PAIR(0x91C3, 0x59A5)
+DOUBLE_BYTE_PAIR(0x91C4, 0x60F0)
+DOUBLE_BYTE_PAIR(0x91C5, 0x6253)
+DOUBLE_BYTE_PAIR(0x91C6, 0x67C1)
+DOUBLE_BYTE_PAIR(0x91C7, 0x8235)
+DOUBLE_BYTE_PAIR(0x91C8, 0x6955)
+DOUBLE_BYTE_PAIR(0x91C9, 0x9640)
+DOUBLE_BYTE_PAIR(0x91CA, 0x99C4)
+DOUBLE_BYTE_PAIR(0x91CB, 0x9A28)
+DOUBLE_BYTE_PAIR(0x91CC, 0x4F53)
+DOUBLE_BYTE_PAIR(0x91CD, 0x5806)
+DOUBLE_BYTE_PAIR(0x91CE, 0x5BFE)
+DOUBLE_BYTE_PAIR(0x91CF, 0x8010)
+DOUBLE_BYTE_PAIR(0x91D0, 0x5CB1)
+DOUBLE_BYTE_PAIR(0x91D1, 0x5E2F)
+DOUBLE_BYTE_PAIR(0x91D2, 0x5F85)
+DOUBLE_BYTE_PAIR(0x91D3, 0x6020)
+DOUBLE_BYTE_PAIR(0x91D4, 0x614B)
+DOUBLE_BYTE_PAIR(0x91D5, 0x6234)
+DOUBLE_BYTE_PAIR(0x91D6, 0x66FF)
+DOUBLE_BYTE_PAIR(0x91D7, 0x6CF0)
+DOUBLE_BYTE_PAIR(0x91D8, 0x6EDE)
+DOUBLE_BYTE_PAIR(0x91D9, 0x80CE)
+DOUBLE_BYTE_PAIR(0x91DA, 0x817F)
+DOUBLE_BYTE_PAIR(0x91DB, 0x82D4)
+DOUBLE_BYTE_PAIR(0x91DC, 0x888B)
+DOUBLE_BYTE_PAIR(0x91DD, 0x8CB8)
+DOUBLE_BYTE_PAIR(0x91DE, 0x9000)
+DOUBLE_BYTE_PAIR(0x91DF, 0x902E)
+DOUBLE_BYTE_PAIR(0x91E0, 0x968A)
+DOUBLE_BYTE_PAIR(0x91E1, 0x9EDB)
+DOUBLE_BYTE_PAIR(0x91E2, 0x9BDB)
+DOUBLE_BYTE_PAIR(0x91E3, 0x4EE3)
+DOUBLE_BYTE_PAIR(0x91E4, 0x53F0)
+DOUBLE_BYTE_PAIR(0x91E5, 0x5927)
+DOUBLE_BYTE_PAIR(0x91E6, 0x7B2C)
+DOUBLE_BYTE_PAIR(0x91E7, 0x918D)
+DOUBLE_BYTE_PAIR(0x91E8, 0x984C)
+DOUBLE_BYTE_PAIR(0x91E9, 0x9DF9)
+DOUBLE_BYTE_PAIR(0x91EA, 0x6EDD)
+DOUBLE_BYTE_PAIR(0x91EB, 0x7027)
+DOUBLE_BYTE_PAIR(0x91EC, 0x5353)
+DOUBLE_BYTE_PAIR(0x91ED, 0x5544)
+DOUBLE_BYTE_PAIR(0x91EE, 0x5B85)
+DOUBLE_BYTE_PAIR(0x91EF, 0x6258)
+DOUBLE_BYTE_PAIR(0x91F0, 0x629E)
+DOUBLE_BYTE_PAIR(0x91F1, 0x62D3)
+DOUBLE_BYTE_PAIR(0x91F2, 0x6CA2)
+DOUBLE_BYTE_PAIR(0x91F3, 0x6FEF)
+DOUBLE_BYTE_PAIR(0x91F4, 0x7422)
+DOUBLE_BYTE_PAIR(0x91F5, 0x8A17)
+DOUBLE_BYTE_PAIR(0x91F6, 0x9438)
+DOUBLE_BYTE_PAIR(0x91F7, 0x6FC1)
+DOUBLE_BYTE_PAIR(0x91F8, 0x8AFE)
+DOUBLE_BYTE_PAIR(0x91F9, 0x8338)
+DOUBLE_BYTE_PAIR(0x91FA, 0x51E7)
+DOUBLE_BYTE_PAIR(0x91FB, 0x86F8)
+DOUBLE_BYTE_PAIR(0x91FC, 0x53EA)
+DOUBLE_BYTE_PAIR(0x9240, 0x53E9)
+DOUBLE_BYTE_PAIR(0x9241, 0x4F46)
+DOUBLE_BYTE_PAIR(0x9242, 0x9054)
+DOUBLE_BYTE_PAIR(0x9243, 0x8FB0)
+DOUBLE_BYTE_PAIR(0x9244, 0x596A)
+DOUBLE_BYTE_PAIR(0x9245, 0x8131)
+DOUBLE_BYTE_PAIR(0x9246, 0x5DFD)
+DOUBLE_BYTE_PAIR(0x9247, 0x7AEA)
+DOUBLE_BYTE_PAIR(0x9248, 0x8FBF)
+DOUBLE_BYTE_PAIR(0x9249, 0x68DA)
+DOUBLE_BYTE_PAIR(0x924A, 0x8C37)
+DOUBLE_BYTE_PAIR(0x924B, 0x72F8)
+DOUBLE_BYTE_PAIR(0x924C, 0x9C48)
+DOUBLE_BYTE_PAIR(0x924D, 0x6A3D)
+DOUBLE_BYTE_PAIR(0x924E, 0x8AB0)
+DOUBLE_BYTE_PAIR(0x924F, 0x4E39)
+DOUBLE_BYTE_PAIR(0x9250, 0x5358)
+DOUBLE_BYTE_PAIR(0x9251, 0x5606)
+DOUBLE_BYTE_PAIR(0x9252, 0x5766)
+DOUBLE_BYTE_PAIR(0x9253, 0x62C5)
+DOUBLE_BYTE_PAIR(0x9254, 0x63A2)
+DOUBLE_BYTE_PAIR(0x9255, 0x65E6)
+DOUBLE_BYTE_PAIR(0x9256, 0x6B4E)
+DOUBLE_BYTE_PAIR(0x9257, 0x6DE1)
+DOUBLE_BYTE_PAIR(0x9258, 0x6E5B)
+DOUBLE_BYTE_PAIR(0x9259, 0x70AD)
+DOUBLE_BYTE_PAIR(0x925A, 0x77ED)
+DOUBLE_BYTE_PAIR(0x925B, 0x7AEF)
+DOUBLE_BYTE_PAIR(0x925C, 0x7BAA)
+DOUBLE_BYTE_PAIR(0x925D, 0x7DBB)
+DOUBLE_BYTE_PAIR(0x925E, 0x803D)
+DOUBLE_BYTE_PAIR(0x925F, 0x80C6)
+DOUBLE_BYTE_PAIR(0x9260, 0x86CB)
+DOUBLE_BYTE_PAIR(0x9261, 0x8A95)
+DOUBLE_BYTE_PAIR(0x9262, 0x935B)
+DOUBLE_BYTE_PAIR(0x9263, 0x56E3)
+DOUBLE_BYTE_PAIR(0x9264, 0x58C7)
+DOUBLE_BYTE_PAIR(0x9265, 0x5F3E)
+DOUBLE_BYTE_PAIR(0x9266, 0x65AD)
+DOUBLE_BYTE_PAIR(0x9267, 0x6696)
+DOUBLE_BYTE_PAIR(0x9268, 0x6A80)
+DOUBLE_BYTE_PAIR(0x9269, 0x6BB5)
+DOUBLE_BYTE_PAIR(0x926A, 0x7537)
+DOUBLE_BYTE_PAIR(0x926B, 0x8AC7)
+DOUBLE_BYTE_PAIR(0x926C, 0x5024)
+DOUBLE_BYTE_PAIR(0x926D, 0x77E5)
+DOUBLE_BYTE_PAIR(0x926E, 0x5730)
+DOUBLE_BYTE_PAIR(0x926F, 0x5F1B)
+DOUBLE_BYTE_PAIR(0x9270, 0x6065)
+DOUBLE_BYTE_PAIR(0x9271, 0x667A)
+DOUBLE_BYTE_PAIR(0x9272, 0x6C60)
+DOUBLE_BYTE_PAIR(0x9273, 0x75F4)
+DOUBLE_BYTE_PAIR(0x9274, 0x7A1A)
+DOUBLE_BYTE_PAIR(0x9275, 0x7F6E)
+DOUBLE_BYTE_PAIR(0x9276, 0x81F4)
+DOUBLE_BYTE_PAIR(0x9277, 0x8718)
+DOUBLE_BYTE_PAIR(0x9278, 0x9045)
+DOUBLE_BYTE_PAIR(0x9279, 0x99B3)
+DOUBLE_BYTE_PAIR(0x927A, 0x7BC9)
+DOUBLE_BYTE_PAIR(0x927B, 0x755C)
+DOUBLE_BYTE_PAIR(0x927C, 0x7AF9)
+DOUBLE_BYTE_PAIR(0x927D, 0x7B51)
+DOUBLE_BYTE_PAIR(0x927E, 0x84C4)
+DOUBLE_BYTE_PAIR(0x9280, 0x9010)
+DOUBLE_BYTE_PAIR(0x9281, 0x79E9)
+DOUBLE_BYTE_PAIR(0x9282, 0x7A92)
+DOUBLE_BYTE_PAIR(0x9283, 0x8336)
+DOUBLE_BYTE_PAIR(0x9284, 0x5AE1)
+DOUBLE_BYTE_PAIR(0x9285, 0x7740)
+DOUBLE_BYTE_PAIR(0x9286, 0x4E2D)
+DOUBLE_BYTE_PAIR(0x9287, 0x4EF2)
+DOUBLE_BYTE_PAIR(0x9288, 0x5B99)
+DOUBLE_BYTE_PAIR(0x9289, 0x5FE0)
+DOUBLE_BYTE_PAIR(0x928A, 0x62BD)
+DOUBLE_BYTE_PAIR(0x928B, 0x663C)
+DOUBLE_BYTE_PAIR(0x928C, 0x67F1)
+DOUBLE_BYTE_PAIR(0x928D, 0x6CE8)
+DOUBLE_BYTE_PAIR(0x928E, 0x866B)
+DOUBLE_BYTE_PAIR(0x928F, 0x8877)
+DOUBLE_BYTE_PAIR(0x9290, 0x8A3B)
+DOUBLE_BYTE_PAIR(0x9291, 0x914E)
+DOUBLE_BYTE_PAIR(0x9292, 0x92F3)
+DOUBLE_BYTE_PAIR(0x9293, 0x99D0)
+DOUBLE_BYTE_PAIR(0x9294, 0x6A17)
+DOUBLE_BYTE_PAIR(0x9295, 0x7026)
+DOUBLE_BYTE_PAIR(0x9296, 0x732A)
+DOUBLE_BYTE_PAIR(0x9297, 0x82E7)
+DOUBLE_BYTE_PAIR(0x9298, 0x8457)
+DOUBLE_BYTE_PAIR(0x9299, 0x8CAF)
+DOUBLE_BYTE_PAIR(0x929A, 0x4E01)
+DOUBLE_BYTE_PAIR(0x929B, 0x5146)
+DOUBLE_BYTE_PAIR(0x929C, 0x51CB)
+DOUBLE_BYTE_PAIR(0x929D, 0x558B)
+DOUBLE_BYTE_PAIR(0x929E, 0x5BF5)
+DOUBLE_BYTE_PAIR(0x929F, 0x5E16)
+DOUBLE_BYTE_PAIR(0x92A0, 0x5E33)
+DOUBLE_BYTE_PAIR(0x92A1, 0x5E81)
+DOUBLE_BYTE_PAIR(0x92A2, 0x5F14)
+DOUBLE_BYTE_PAIR(0x92A3, 0x5F35)
+DOUBLE_BYTE_PAIR(0x92A4, 0x5F6B)
+DOUBLE_BYTE_PAIR(0x92A5, 0x5FB4)
+DOUBLE_BYTE_PAIR(0x92A6, 0x61F2)
+DOUBLE_BYTE_PAIR(0x92A7, 0x6311)
+DOUBLE_BYTE_PAIR(0x92A8, 0x66A2)
+DOUBLE_BYTE_PAIR(0x92A9, 0x671D)
+DOUBLE_BYTE_PAIR(0x92AA, 0x6F6E)
+DOUBLE_BYTE_PAIR(0x92AB, 0x7252)
+DOUBLE_BYTE_PAIR(0x92AC, 0x753A)
+DOUBLE_BYTE_PAIR(0x92AD, 0x773A)
+DOUBLE_BYTE_PAIR(0x92AE, 0x8074)
+DOUBLE_BYTE_PAIR(0x92AF, 0x8139)
+DOUBLE_BYTE_PAIR(0x92B0, 0x8178)
+DOUBLE_BYTE_PAIR(0x92B1, 0x8776)
+DOUBLE_BYTE_PAIR(0x92B2, 0x8ABF)
+DOUBLE_BYTE_PAIR(0x92B3, 0x8ADC)
+DOUBLE_BYTE_PAIR(0x92B4, 0x8D85)
+DOUBLE_BYTE_PAIR(0x92B5, 0x8DF3)
+DOUBLE_BYTE_PAIR(0x92B6, 0x929A)
+DOUBLE_BYTE_PAIR(0x92B7, 0x9577)
+DOUBLE_BYTE_PAIR(0x92B8, 0x9802)
+DOUBLE_BYTE_PAIR(0x92B9, 0x9CE5)
+DOUBLE_BYTE_PAIR(0x92BA, 0x52C5)
+DOUBLE_BYTE_PAIR(0x92BB, 0x6357)
+DOUBLE_BYTE_PAIR(0x92BC, 0x76F4)
+DOUBLE_BYTE_PAIR(0x92BD, 0x6715)
+DOUBLE_BYTE_PAIR(0x92BE, 0x6C88)
+DOUBLE_BYTE_PAIR(0x92BF, 0x73CD)
+DOUBLE_BYTE_PAIR(0x92C0, 0x8CC3)
+DOUBLE_BYTE_PAIR(0x92C1, 0x93AE)
+DOUBLE_BYTE_PAIR(0x92C2, 0x9673)
+DOUBLE_BYTE_PAIR(0x92C3, 0x6D25)
+DOUBLE_BYTE_PAIR(0x92C4, 0x589C)
+DOUBLE_BYTE_PAIR(0x92C5, 0x690E)
+DOUBLE_BYTE_PAIR(0x92C6, 0x69CC)
+DOUBLE_BYTE_PAIR(0x92C7, 0x8FFD)
+DOUBLE_BYTE_PAIR(0x92C8, 0x939A)
+DOUBLE_BYTE_PAIR(0x92C9, 0x75DB)
+DOUBLE_BYTE_PAIR(0x92CA, 0x901A)
+DOUBLE_BYTE_PAIR(0x92CB, 0x585A)
+DOUBLE_BYTE_PAIR(0x92CC, 0x6802)
+DOUBLE_BYTE_PAIR(0x92CD, 0x63B4)
+DOUBLE_BYTE_PAIR(0x92CE, 0x69FB)
+DOUBLE_BYTE_PAIR(0x92CF, 0x4F43)
+DOUBLE_BYTE_PAIR(0x92D0, 0x6F2C)
+DOUBLE_BYTE_PAIR(0x92D1, 0x67D8)
+DOUBLE_BYTE_PAIR(0x92D2, 0x8FBB)
+DOUBLE_BYTE_PAIR(0x92D3, 0x8526)
+DOUBLE_BYTE_PAIR(0x92D4, 0x7DB4)
+DOUBLE_BYTE_PAIR(0x92D5, 0x9354)
+DOUBLE_BYTE_PAIR(0x92D6, 0x693F)
+DOUBLE_BYTE_PAIR(0x92D7, 0x6F70)
+DOUBLE_BYTE_PAIR(0x92D8, 0x576A)
+DOUBLE_BYTE_PAIR(0x92D9, 0x58F7)
+DOUBLE_BYTE_PAIR(0x92DA, 0x5B2C)
+DOUBLE_BYTE_PAIR(0x92DB, 0x7D2C)
+DOUBLE_BYTE_PAIR(0x92DC, 0x722A)
+DOUBLE_BYTE_PAIR(0x92DD, 0x540A)
+DOUBLE_BYTE_PAIR(0x92DE, 0x91E3)
+DOUBLE_BYTE_PAIR(0x92DF, 0x9DB4)
+DOUBLE_BYTE_PAIR(0x92E0, 0x4EAD)
+DOUBLE_BYTE_PAIR(0x92E1, 0x4F4E)
+DOUBLE_BYTE_PAIR(0x92E2, 0x505C)
+DOUBLE_BYTE_PAIR(0x92E3, 0x5075)
+DOUBLE_BYTE_PAIR(0x92E4, 0x5243)
+DOUBLE_BYTE_PAIR(0x92E5, 0x8C9E)
+DOUBLE_BYTE_PAIR(0x92E6, 0x5448)
+DOUBLE_BYTE_PAIR(0x92E7, 0x5824)
+DOUBLE_BYTE_PAIR(0x92E8, 0x5B9A)
+DOUBLE_BYTE_PAIR(0x92E9, 0x5E1D)
+DOUBLE_BYTE_PAIR(0x92EA, 0x5E95)
+DOUBLE_BYTE_PAIR(0x92EB, 0x5EAD)
+DOUBLE_BYTE_PAIR(0x92EC, 0x5EF7)
+DOUBLE_BYTE_PAIR(0x92ED, 0x5F1F)
+DOUBLE_BYTE_PAIR(0x92EE, 0x608C)
+DOUBLE_BYTE_PAIR(0x92EF, 0x62B5)
+DOUBLE_BYTE_PAIR(0x92F0, 0x633A)
+DOUBLE_BYTE_PAIR(0x92F1, 0x63D0)
+DOUBLE_BYTE_PAIR(0x92F2, 0x68AF)
+DOUBLE_BYTE_PAIR(0x92F3, 0x6C40)
+DOUBLE_BYTE_PAIR(0x92F4, 0x7887)
+DOUBLE_BYTE_PAIR(0x92F5, 0x798E)
+DOUBLE_BYTE_PAIR(0x92F6, 0x7A0B)
+DOUBLE_BYTE_PAIR(0x92F7, 0x7DE0)
+DOUBLE_BYTE_PAIR(0x92F8, 0x8247)
+DOUBLE_BYTE_PAIR(0x92F9, 0x8A02)
+DOUBLE_BYTE_PAIR(0x92FA, 0x8AE6)
+DOUBLE_BYTE_PAIR(0x92FB, 0x8E44)
+DOUBLE_BYTE_PAIR(0x92FC, 0x9013)
+DOUBLE_BYTE_PAIR(0x9340, 0x90B8)
+DOUBLE_BYTE_PAIR(0x9341, 0x912D)
+DOUBLE_BYTE_PAIR(0x9342, 0x91D8)
+DOUBLE_BYTE_PAIR(0x9343, 0x9F0E)
+DOUBLE_BYTE_PAIR(0x9344, 0x6CE5)
+DOUBLE_BYTE_PAIR(0x9345, 0x6458)
+DOUBLE_BYTE_PAIR(0x9346, 0x64E2)
+DOUBLE_BYTE_PAIR(0x9347, 0x6575)
+DOUBLE_BYTE_PAIR(0x9348, 0x6EF4)
+DOUBLE_BYTE_PAIR(0x9349, 0x7684)
+DOUBLE_BYTE_PAIR(0x934A, 0x7B1B)
+DOUBLE_BYTE_PAIR(0x934B, 0x9069)
+DOUBLE_BYTE_PAIR(0x934C, 0x93D1)
+DOUBLE_BYTE_PAIR(0x934D, 0x6EBA)
+DOUBLE_BYTE_PAIR(0x934E, 0x54F2)
+DOUBLE_BYTE_PAIR(0x934F, 0x5FB9)
+DOUBLE_BYTE_PAIR(0x9350, 0x64A4)
+DOUBLE_BYTE_PAIR(0x9351, 0x8F4D)
+DOUBLE_BYTE_PAIR(0x9352, 0x8FED)
+DOUBLE_BYTE_PAIR(0x9353, 0x9244)
+DOUBLE_BYTE_PAIR(0x9354, 0x5178)
+DOUBLE_BYTE_PAIR(0x9355, 0x586B)
+DOUBLE_BYTE_PAIR(0x9356, 0x5929)
+DOUBLE_BYTE_PAIR(0x9357, 0x5C55)
+DOUBLE_BYTE_PAIR(0x9358, 0x5E97)
+DOUBLE_BYTE_PAIR(0x9359, 0x6DFB)
+DOUBLE_BYTE_PAIR(0x935A, 0x7E8F)
+DOUBLE_BYTE_PAIR(0x935B, 0x751C)
+DOUBLE_BYTE_PAIR(0x935C, 0x8CBC)
+DOUBLE_BYTE_PAIR(0x935D, 0x8EE2)
+DOUBLE_BYTE_PAIR(0x935E, 0x985B)
+DOUBLE_BYTE_PAIR(0x935F, 0x70B9)
+DOUBLE_BYTE_PAIR(0x9360, 0x4F1D)
+DOUBLE_BYTE_PAIR(0x9361, 0x6BBF)
+DOUBLE_BYTE_PAIR(0x9362, 0x6FB1)
+DOUBLE_BYTE_PAIR(0x9363, 0x7530)
+DOUBLE_BYTE_PAIR(0x9364, 0x96FB)
+DOUBLE_BYTE_PAIR(0x9365, 0x514E)
+DOUBLE_BYTE_PAIR(0x9366, 0x5410)
+DOUBLE_BYTE_PAIR(0x9367, 0x5835)
+DOUBLE_BYTE_PAIR(0x9368, 0x5857)
+DOUBLE_BYTE_PAIR(0x9369, 0x59AC)
+DOUBLE_BYTE_PAIR(0x936A, 0x5C60)
+DOUBLE_BYTE_PAIR(0x936B, 0x5F92)
+DOUBLE_BYTE_PAIR(0x936C, 0x6597)
+DOUBLE_BYTE_PAIR(0x936D, 0x675C)
+DOUBLE_BYTE_PAIR(0x936E, 0x6E21)
+DOUBLE_BYTE_PAIR(0x936F, 0x767B)
+DOUBLE_BYTE_PAIR(0x9370, 0x83DF)
+DOUBLE_BYTE_PAIR(0x9371, 0x8CED)
+DOUBLE_BYTE_PAIR(0x9372, 0x9014)
+DOUBLE_BYTE_PAIR(0x9373, 0x90FD)
+DOUBLE_BYTE_PAIR(0x9374, 0x934D)
+DOUBLE_BYTE_PAIR(0x9375, 0x7825)
+DOUBLE_BYTE_PAIR(0x9376, 0x783A)
+DOUBLE_BYTE_PAIR(0x9377, 0x52AA)
+DOUBLE_BYTE_PAIR(0x9378, 0x5EA6)
+DOUBLE_BYTE_PAIR(0x9379, 0x571F)
+DOUBLE_BYTE_PAIR(0x937A, 0x5974)
+DOUBLE_BYTE_PAIR(0x937B, 0x6012)
+DOUBLE_BYTE_PAIR(0x937C, 0x5012)
+DOUBLE_BYTE_PAIR(0x937D, 0x515A)
+DOUBLE_BYTE_PAIR(0x937E, 0x51AC)
+DOUBLE_BYTE_PAIR(0x9380, 0x51CD)
+DOUBLE_BYTE_PAIR(0x9381, 0x5200)
+DOUBLE_BYTE_PAIR(0x9382, 0x5510)
+DOUBLE_BYTE_PAIR(0x9383, 0x5854)
+DOUBLE_BYTE_PAIR(0x9384, 0x5858)
+DOUBLE_BYTE_PAIR(0x9385, 0x5957)
+DOUBLE_BYTE_PAIR(0x9386, 0x5B95)
+DOUBLE_BYTE_PAIR(0x9387, 0x5CF6)
+DOUBLE_BYTE_PAIR(0x9388, 0x5D8B)
+DOUBLE_BYTE_PAIR(0x9389, 0x60BC)
+DOUBLE_BYTE_PAIR(0x938A, 0x6295)
+DOUBLE_BYTE_PAIR(0x938B, 0x642D)
+DOUBLE_BYTE_PAIR(0x938C, 0x6771)
+DOUBLE_BYTE_PAIR(0x938D, 0x6843)
+DOUBLE_BYTE_PAIR(0x938E, 0x68BC)
+DOUBLE_BYTE_PAIR(0x938F, 0x68DF)
+DOUBLE_BYTE_PAIR(0x9390, 0x76D7)
+DOUBLE_BYTE_PAIR(0x9391, 0x6DD8)
+DOUBLE_BYTE_PAIR(0x9392, 0x6E6F)
+DOUBLE_BYTE_PAIR(0x9393, 0x6D9B)
+DOUBLE_BYTE_PAIR(0x9394, 0x706F)
+DOUBLE_BYTE_PAIR(0x9395, 0x71C8)
+DOUBLE_BYTE_PAIR(0x9396, 0x5F53)
+DOUBLE_BYTE_PAIR(0x9397, 0x75D8)
+DOUBLE_BYTE_PAIR(0x9398, 0x7977)
+DOUBLE_BYTE_PAIR(0x9399, 0x7B49)
+DOUBLE_BYTE_PAIR(0x939A, 0x7B54)
+DOUBLE_BYTE_PAIR(0x939B, 0x7B52)
+DOUBLE_BYTE_PAIR(0x939C, 0x7CD6)
+DOUBLE_BYTE_PAIR(0x939D, 0x7D71)
+DOUBLE_BYTE_PAIR(0x939E, 0x5230)
+DOUBLE_BYTE_PAIR(0x939F, 0x8463)
+DOUBLE_BYTE_PAIR(0x93A0, 0x8569)
+DOUBLE_BYTE_PAIR(0x93A1, 0x85E4)
+DOUBLE_BYTE_PAIR(0x93A2, 0x8A0E)
+DOUBLE_BYTE_PAIR(0x93A3, 0x8B04)
+DOUBLE_BYTE_PAIR(0x93A4, 0x8C46)
+DOUBLE_BYTE_PAIR(0x93A5, 0x8E0F)
+DOUBLE_BYTE_PAIR(0x93A6, 0x9003)
+DOUBLE_BYTE_PAIR(0x93A7, 0x900F)
+DOUBLE_BYTE_PAIR(0x93A8, 0x9419)
+DOUBLE_BYTE_PAIR(0x93A9, 0x9676)
+DOUBLE_BYTE_PAIR(0x93AA, 0x982D)
+DOUBLE_BYTE_PAIR(0x93AB, 0x9A30)
+DOUBLE_BYTE_PAIR(0x93AC, 0x95D8)
+DOUBLE_BYTE_PAIR(0x93AD, 0x50CD)
+DOUBLE_BYTE_PAIR(0x93AE, 0x52D5)
+DOUBLE_BYTE_PAIR(0x93AF, 0x540C)
+DOUBLE_BYTE_PAIR(0x93B0, 0x5802)
+DOUBLE_BYTE_PAIR(0x93B1, 0x5C0E)
+DOUBLE_BYTE_PAIR(0x93B2, 0x61A7)
+DOUBLE_BYTE_PAIR(0x93B3, 0x649E)
+DOUBLE_BYTE_PAIR(0x93B4, 0x6D1E)
+DOUBLE_BYTE_PAIR(0x93B5, 0x77B3)
+DOUBLE_BYTE_PAIR(0x93B6, 0x7AE5)
+DOUBLE_BYTE_PAIR(0x93B7, 0x80F4)
+DOUBLE_BYTE_PAIR(0x93B8, 0x8404)
+DOUBLE_BYTE_PAIR(0x93B9, 0x9053)
+DOUBLE_BYTE_PAIR(0x93BA, 0x9285)
+DOUBLE_BYTE_PAIR(0x93BB, 0x5CE0)
+DOUBLE_BYTE_PAIR(0x93BC, 0x9D07)
+DOUBLE_BYTE_PAIR(0x93BD, 0x533F)
+DOUBLE_BYTE_PAIR(0x93BE, 0x5F97)
+DOUBLE_BYTE_PAIR(0x93BF, 0x5FB3)
+DOUBLE_BYTE_PAIR(0x93C0, 0x6D9C)
+DOUBLE_BYTE_PAIR(0x93C1, 0x7279)
+DOUBLE_BYTE_PAIR(0x93C2, 0x7763)
+DOUBLE_BYTE_PAIR(0x93C3, 0x79BF)
+DOUBLE_BYTE_PAIR(0x93C4, 0x7BE4)
+DOUBLE_BYTE_PAIR(0x93C5, 0x6BD2)
+DOUBLE_BYTE_PAIR(0x93C6, 0x72EC)
+DOUBLE_BYTE_PAIR(0x93C7, 0x8AAD)
+DOUBLE_BYTE_PAIR(0x93C8, 0x6803)
+DOUBLE_BYTE_PAIR(0x93C9, 0x6A61)
+DOUBLE_BYTE_PAIR(0x93CA, 0x51F8)
+DOUBLE_BYTE_PAIR(0x93CB, 0x7A81)
+DOUBLE_BYTE_PAIR(0x93CC, 0x6934)
+DOUBLE_BYTE_PAIR(0x93CD, 0x5C4A)
+DOUBLE_BYTE_PAIR(0x93CE, 0x9CF6)
+DOUBLE_BYTE_PAIR(0x93CF, 0x82EB)
+DOUBLE_BYTE_PAIR(0x93D0, 0x5BC5)
+DOUBLE_BYTE_PAIR(0x93D1, 0x9149)
+DOUBLE_BYTE_PAIR(0x93D2, 0x701E)
+DOUBLE_BYTE_PAIR(0x93D3, 0x5678)
+DOUBLE_BYTE_PAIR(0x93D4, 0x5C6F)
+DOUBLE_BYTE_PAIR(0x93D5, 0x60C7)
+DOUBLE_BYTE_PAIR(0x93D6, 0x6566)
+DOUBLE_BYTE_PAIR(0x93D7, 0x6C8C)
+DOUBLE_BYTE_PAIR(0x93D8, 0x8C5A)
+DOUBLE_BYTE_PAIR(0x93D9, 0x9041)
+DOUBLE_BYTE_PAIR(0x93DA, 0x9813)
+DOUBLE_BYTE_PAIR(0x93DB, 0x5451)
+DOUBLE_BYTE_PAIR(0x93DC, 0x66C7)
+DOUBLE_BYTE_PAIR(0x93DD, 0x920D)
+DOUBLE_BYTE_PAIR(0x93DE, 0x5948)
+DOUBLE_BYTE_PAIR(0x93DF, 0x90A3)
+DOUBLE_BYTE_PAIR(0x93E0, 0x5185)
+DOUBLE_BYTE_PAIR(0x93E1, 0x4E4D)
+DOUBLE_BYTE_PAIR(0x93E2, 0x51EA)
+DOUBLE_BYTE_PAIR(0x93E3, 0x8599)
+DOUBLE_BYTE_PAIR(0x93E4, 0x8B0E)
+DOUBLE_BYTE_PAIR(0x93E5, 0x7058)
+DOUBLE_BYTE_PAIR(0x93E6, 0x637A)
+DOUBLE_BYTE_PAIR(0x93E7, 0x934B)
+DOUBLE_BYTE_PAIR(0x93E8, 0x6962)
+DOUBLE_BYTE_PAIR(0x93E9, 0x99B4)
+DOUBLE_BYTE_PAIR(0x93EA, 0x7E04)
+DOUBLE_BYTE_PAIR(0x93EB, 0x7577)
+DOUBLE_BYTE_PAIR(0x93EC, 0x5357)
+DOUBLE_BYTE_PAIR(0x93ED, 0x6960)
+DOUBLE_BYTE_PAIR(0x93EE, 0x8EDF)
+DOUBLE_BYTE_PAIR(0x93EF, 0x96E3)
+DOUBLE_BYTE_PAIR(0x93F0, 0x6C5D)
+DOUBLE_BYTE_PAIR(0x93F1, 0x4E8C)
+DOUBLE_BYTE_PAIR(0x93F2, 0x5C3C)
+DOUBLE_BYTE_PAIR(0x93F3, 0x5F10)
+DOUBLE_BYTE_PAIR(0x93F4, 0x8FE9)
+DOUBLE_BYTE_PAIR(0x93F5, 0x5302)
+DOUBLE_BYTE_PAIR(0x93F6, 0x8CD1)
+DOUBLE_BYTE_PAIR(0x93F7, 0x8089)
+DOUBLE_BYTE_PAIR(0x93F8, 0x8679)
+DOUBLE_BYTE_PAIR(0x93F9, 0x5EFF)
+DOUBLE_BYTE_PAIR(0x93FA, 0x65E5)
+DOUBLE_BYTE_PAIR(0x93FB, 0x4E73)
+DOUBLE_BYTE_PAIR(0x93FC, 0x5165)
+DOUBLE_BYTE_PAIR(0x9440, 0x5982)
+DOUBLE_BYTE_PAIR(0x9441, 0x5C3F)
+DOUBLE_BYTE_PAIR(0x9442, 0x97EE)
+DOUBLE_BYTE_PAIR(0x9443, 0x4EFB)
+DOUBLE_BYTE_PAIR(0x9444, 0x598A)
+DOUBLE_BYTE_PAIR(0x9445, 0x5FCD)
+DOUBLE_BYTE_PAIR(0x9446, 0x8A8D)
+DOUBLE_BYTE_PAIR(0x9447, 0x6FE1)
+DOUBLE_BYTE_PAIR(0x9448, 0x79B0)
+DOUBLE_BYTE_PAIR(0x9449, 0x7962)
+DOUBLE_BYTE_PAIR(0x944A, 0x5BE7)
+DOUBLE_BYTE_PAIR(0x944B, 0x8471)
+DOUBLE_BYTE_PAIR(0x944C, 0x732B)
+DOUBLE_BYTE_PAIR(0x944D, 0x71B1)
+DOUBLE_BYTE_PAIR(0x944E, 0x5E74)
+DOUBLE_BYTE_PAIR(0x944F, 0x5FF5)
+DOUBLE_BYTE_PAIR(0x9450, 0x637B)
+DOUBLE_BYTE_PAIR(0x9451, 0x649A)
+DOUBLE_BYTE_PAIR(0x9452, 0x71C3)
+DOUBLE_BYTE_PAIR(0x9453, 0x7C98)
+DOUBLE_BYTE_PAIR(0x9454, 0x4E43)
+DOUBLE_BYTE_PAIR(0x9455, 0x5EFC)
+DOUBLE_BYTE_PAIR(0x9456, 0x4E4B)
+DOUBLE_BYTE_PAIR(0x9457, 0x57DC)
+DOUBLE_BYTE_PAIR(0x9458, 0x56A2)
+DOUBLE_BYTE_PAIR(0x9459, 0x60A9)
+DOUBLE_BYTE_PAIR(0x945A, 0x6FC3)
+DOUBLE_BYTE_PAIR(0x945B, 0x7D0D)
+DOUBLE_BYTE_PAIR(0x945C, 0x80FD)
+DOUBLE_BYTE_PAIR(0x945D, 0x8133)
+DOUBLE_BYTE_PAIR(0x945E, 0x81BF)
+DOUBLE_BYTE_PAIR(0x945F, 0x8FB2)
+DOUBLE_BYTE_PAIR(0x9460, 0x8997)
+DOUBLE_BYTE_PAIR(0x9461, 0x86A4)
+DOUBLE_BYTE_PAIR(0x9462, 0x5DF4)
+DOUBLE_BYTE_PAIR(0x9463, 0x628A)
+DOUBLE_BYTE_PAIR(0x9464, 0x64AD)
+DOUBLE_BYTE_PAIR(0x9465, 0x8987)
+DOUBLE_BYTE_PAIR(0x9466, 0x6777)
+DOUBLE_BYTE_PAIR(0x9467, 0x6CE2)
+DOUBLE_BYTE_PAIR(0x9468, 0x6D3E)
+DOUBLE_BYTE_PAIR(0x9469, 0x7436)
+DOUBLE_BYTE_PAIR(0x946A, 0x7834)
+DOUBLE_BYTE_PAIR(0x946B, 0x5A46)
+DOUBLE_BYTE_PAIR(0x946C, 0x7F75)
+DOUBLE_BYTE_PAIR(0x946D, 0x82AD)
+DOUBLE_BYTE_PAIR(0x946E, 0x99AC)
+DOUBLE_BYTE_PAIR(0x946F, 0x4FF3)
+DOUBLE_BYTE_PAIR(0x9470, 0x5EC3)
+DOUBLE_BYTE_PAIR(0x9471, 0x62DD)
+DOUBLE_BYTE_PAIR(0x9472, 0x6392)
+DOUBLE_BYTE_PAIR(0x9473, 0x6557)
+DOUBLE_BYTE_PAIR(0x9474, 0x676F)
+DOUBLE_BYTE_PAIR(0x9475, 0x76C3)
+DOUBLE_BYTE_PAIR(0x9476, 0x724C)
+DOUBLE_BYTE_PAIR(0x9477, 0x80CC)
+DOUBLE_BYTE_PAIR(0x9478, 0x80BA)
+DOUBLE_BYTE_PAIR(0x9479, 0x8F29)
+DOUBLE_BYTE_PAIR(0x947A, 0x914D)
+DOUBLE_BYTE_PAIR(0x947B, 0x500D)
+DOUBLE_BYTE_PAIR(0x947C, 0x57F9)
+DOUBLE_BYTE_PAIR(0x947D, 0x5A92)
+DOUBLE_BYTE_PAIR(0x947E, 0x6885)
+DOUBLE_BYTE_PAIR(0x9480, 0x6973)
+DOUBLE_BYTE_PAIR(0x9481, 0x7164)
+DOUBLE_BYTE_PAIR(0x9482, 0x72FD)
+DOUBLE_BYTE_PAIR(0x9483, 0x8CB7)
+DOUBLE_BYTE_PAIR(0x9484, 0x58F2)
+DOUBLE_BYTE_PAIR(0x9485, 0x8CE0)
+DOUBLE_BYTE_PAIR(0x9486, 0x966A)
+DOUBLE_BYTE_PAIR(0x9487, 0x9019)
+DOUBLE_BYTE_PAIR(0x9488, 0x877F)
+DOUBLE_BYTE_PAIR(0x9489, 0x79E4)
+DOUBLE_BYTE_PAIR(0x948A, 0x77E7)
+DOUBLE_BYTE_PAIR(0x948B, 0x8429)
+DOUBLE_BYTE_PAIR(0x948C, 0x4F2F)
+DOUBLE_BYTE_PAIR(0x948D, 0x5265)
+DOUBLE_BYTE_PAIR(0x948E, 0x535A)
+DOUBLE_BYTE_PAIR(0x948F, 0x62CD)
+DOUBLE_BYTE_PAIR(0x9490, 0x67CF)
+DOUBLE_BYTE_PAIR(0x9491, 0x6CCA)
+DOUBLE_BYTE_PAIR(0x9492, 0x767D)
+DOUBLE_BYTE_PAIR(0x9493, 0x7B94)
+DOUBLE_BYTE_PAIR(0x9494, 0x7C95)
+DOUBLE_BYTE_PAIR(0x9495, 0x8236)
+DOUBLE_BYTE_PAIR(0x9496, 0x8584)
+DOUBLE_BYTE_PAIR(0x9497, 0x8FEB)
+DOUBLE_BYTE_PAIR(0x9498, 0x66DD)
+DOUBLE_BYTE_PAIR(0x9499, 0x6F20)
+DOUBLE_BYTE_PAIR(0x949A, 0x7206)
+DOUBLE_BYTE_PAIR(0x949B, 0x7E1B)
+DOUBLE_BYTE_PAIR(0x949C, 0x83AB)
+DOUBLE_BYTE_PAIR(0x949D, 0x99C1)
+DOUBLE_BYTE_PAIR(0x949E, 0x9EA6)
+DOUBLE_BYTE_PAIR(0x949F, 0x51FD)
+DOUBLE_BYTE_PAIR(0x94A0, 0x7BB1)
+DOUBLE_BYTE_PAIR(0x94A1, 0x7872)
+DOUBLE_BYTE_PAIR(0x94A2, 0x7BB8)
+DOUBLE_BYTE_PAIR(0x94A3, 0x8087)
+DOUBLE_BYTE_PAIR(0x94A4, 0x7B48)
+DOUBLE_BYTE_PAIR(0x94A5, 0x6AE8)
+DOUBLE_BYTE_PAIR(0x94A6, 0x5E61)
+DOUBLE_BYTE_PAIR(0x94A7, 0x808C)
+DOUBLE_BYTE_PAIR(0x94A8, 0x7551)
+DOUBLE_BYTE_PAIR(0x94A9, 0x7560)
+DOUBLE_BYTE_PAIR(0x94AA, 0x516B)
+DOUBLE_BYTE_PAIR(0x94AB, 0x9262)
+DOUBLE_BYTE_PAIR(0x94AC, 0x6E8C)
+DOUBLE_BYTE_PAIR(0x94AD, 0x767A)
+DOUBLE_BYTE_PAIR(0x94AE, 0x9197)
+DOUBLE_BYTE_PAIR(0x94AF, 0x9AEA)
+DOUBLE_BYTE_PAIR(0x94B0, 0x4F10)
+DOUBLE_BYTE_PAIR(0x94B1, 0x7F70)
+DOUBLE_BYTE_PAIR(0x94B2, 0x629C)
+DOUBLE_BYTE_PAIR(0x94B3, 0x7B4F)
+DOUBLE_BYTE_PAIR(0x94B4, 0x95A5)
+DOUBLE_BYTE_PAIR(0x94B5, 0x9CE9)
+DOUBLE_BYTE_PAIR(0x94B6, 0x567A)
+DOUBLE_BYTE_PAIR(0x94B7, 0x5859)
+DOUBLE_BYTE_PAIR(0x94B8, 0x86E4)
+DOUBLE_BYTE_PAIR(0x94B9, 0x96BC)
+DOUBLE_BYTE_PAIR(0x94BA, 0x4F34)
+DOUBLE_BYTE_PAIR(0x94BB, 0x5224)
+DOUBLE_BYTE_PAIR(0x94BC, 0x534A)
+DOUBLE_BYTE_PAIR(0x94BD, 0x53CD)
+DOUBLE_BYTE_PAIR(0x94BE, 0x53DB)
+DOUBLE_BYTE_PAIR(0x94BF, 0x5E06)
+DOUBLE_BYTE_PAIR(0x94C0, 0x642C)
+DOUBLE_BYTE_PAIR(0x94C1, 0x6591)
+DOUBLE_BYTE_PAIR(0x94C2, 0x677F)
+DOUBLE_BYTE_PAIR(0x94C3, 0x6C3E)
+DOUBLE_BYTE_PAIR(0x94C4, 0x6C4E)
+DOUBLE_BYTE_PAIR(0x94C5, 0x7248)
+DOUBLE_BYTE_PAIR(0x94C6, 0x72AF)
+DOUBLE_BYTE_PAIR(0x94C7, 0x73ED)
+DOUBLE_BYTE_PAIR(0x94C8, 0x7554)
+DOUBLE_BYTE_PAIR(0x94C9, 0x7E41)
+DOUBLE_BYTE_PAIR(0x94CA, 0x822C)
+DOUBLE_BYTE_PAIR(0x94CB, 0x85E9)
+DOUBLE_BYTE_PAIR(0x94CC, 0x8CA9)
+DOUBLE_BYTE_PAIR(0x94CD, 0x7BC4)
+DOUBLE_BYTE_PAIR(0x94CE, 0x91C6)
+DOUBLE_BYTE_PAIR(0x94CF, 0x7169)
+DOUBLE_BYTE_PAIR(0x94D0, 0x9812)
+DOUBLE_BYTE_PAIR(0x94D1, 0x98EF)
+DOUBLE_BYTE_PAIR(0x94D2, 0x633D)
+DOUBLE_BYTE_PAIR(0x94D3, 0x6669)
+DOUBLE_BYTE_PAIR(0x94D4, 0x756A)
+DOUBLE_BYTE_PAIR(0x94D5, 0x76E4)
+DOUBLE_BYTE_PAIR(0x94D6, 0x78D0)
+DOUBLE_BYTE_PAIR(0x94D7, 0x8543)
+DOUBLE_BYTE_PAIR(0x94D8, 0x86EE)
+DOUBLE_BYTE_PAIR(0x94D9, 0x532A)
+DOUBLE_BYTE_PAIR(0x94DA, 0x5351)
+DOUBLE_BYTE_PAIR(0x94DB, 0x5426)
+DOUBLE_BYTE_PAIR(0x94DC, 0x5983)
+DOUBLE_BYTE_PAIR(0x94DD, 0x5E87)
+DOUBLE_BYTE_PAIR(0x94DE, 0x5F7C)
+DOUBLE_BYTE_PAIR(0x94DF, 0x60B2)
+DOUBLE_BYTE_PAIR(0x94E0, 0x6249)
+DOUBLE_BYTE_PAIR(0x94E1, 0x6279)
+DOUBLE_BYTE_PAIR(0x94E2, 0x62AB)
+DOUBLE_BYTE_PAIR(0x94E3, 0x6590)
+DOUBLE_BYTE_PAIR(0x94E4, 0x6BD4)
+DOUBLE_BYTE_PAIR(0x94E5, 0x6CCC)
+DOUBLE_BYTE_PAIR(0x94E6, 0x75B2)
+DOUBLE_BYTE_PAIR(0x94E7, 0x76AE)
+DOUBLE_BYTE_PAIR(0x94E8, 0x7891)
+DOUBLE_BYTE_PAIR(0x94E9, 0x79D8)
+DOUBLE_BYTE_PAIR(0x94EA, 0x7DCB)
+DOUBLE_BYTE_PAIR(0x94EB, 0x7F77)
+DOUBLE_BYTE_PAIR(0x94EC, 0x80A5)
+DOUBLE_BYTE_PAIR(0x94ED, 0x88AB)
+DOUBLE_BYTE_PAIR(0x94EE, 0x8AB9)
+DOUBLE_BYTE_PAIR(0x94EF, 0x8CBB)
+DOUBLE_BYTE_PAIR(0x94F0, 0x907F)
+DOUBLE_BYTE_PAIR(0x94F1, 0x975E)
+DOUBLE_BYTE_PAIR(0x94F2, 0x98DB)
+DOUBLE_BYTE_PAIR(0x94F3, 0x6A0B)
+DOUBLE_BYTE_PAIR(0x94F4, 0x7C38)
+DOUBLE_BYTE_PAIR(0x94F5, 0x5099)
+DOUBLE_BYTE_PAIR(0x94F6, 0x5C3E)
+DOUBLE_BYTE_PAIR(0x94F7, 0x5FAE)
+DOUBLE_BYTE_PAIR(0x94F8, 0x6787)
+DOUBLE_BYTE_PAIR(0x94F9, 0x6BD8)
+DOUBLE_BYTE_PAIR(0x94FA, 0x7435)
+DOUBLE_BYTE_PAIR(0x94FB, 0x7709)
+DOUBLE_BYTE_PAIR(0x94FC, 0x7F8E)
+DOUBLE_BYTE_PAIR(0x9540, 0x9F3B)
+DOUBLE_BYTE_PAIR(0x9541, 0x67CA)
+DOUBLE_BYTE_PAIR(0x9542, 0x7A17)
+DOUBLE_BYTE_PAIR(0x9543, 0x5339)
+DOUBLE_BYTE_PAIR(0x9544, 0x758B)
+DOUBLE_BYTE_PAIR(0x9545, 0x9AED)
+DOUBLE_BYTE_PAIR(0x9546, 0x5F66)
+DOUBLE_BYTE_PAIR(0x9547, 0x819D)
+DOUBLE_BYTE_PAIR(0x9548, 0x83F1)
+DOUBLE_BYTE_PAIR(0x9549, 0x8098)
+DOUBLE_BYTE_PAIR(0x954A, 0x5F3C)
+DOUBLE_BYTE_PAIR(0x954B, 0x5FC5)
+DOUBLE_BYTE_PAIR(0x954C, 0x7562)
+DOUBLE_BYTE_PAIR(0x954D, 0x7B46)
+DOUBLE_BYTE_PAIR(0x954E, 0x903C)
+DOUBLE_BYTE_PAIR(0x954F, 0x6867)
+DOUBLE_BYTE_PAIR(0x9550, 0x59EB)
+DOUBLE_BYTE_PAIR(0x9551, 0x5A9B)
+DOUBLE_BYTE_PAIR(0x9552, 0x7D10)
+DOUBLE_BYTE_PAIR(0x9553, 0x767E)
+DOUBLE_BYTE_PAIR(0x9554, 0x8B2C)
+DOUBLE_BYTE_PAIR(0x9555, 0x4FF5)
+DOUBLE_BYTE_PAIR(0x9556, 0x5F6A)
+DOUBLE_BYTE_PAIR(0x9557, 0x6A19)
+DOUBLE_BYTE_PAIR(0x9558, 0x6C37)
+DOUBLE_BYTE_PAIR(0x9559, 0x6F02)
+DOUBLE_BYTE_PAIR(0x955A, 0x74E2)
+DOUBLE_BYTE_PAIR(0x955B, 0x7968)
+DOUBLE_BYTE_PAIR(0x955C, 0x8868)
+DOUBLE_BYTE_PAIR(0x955D, 0x8A55)
+DOUBLE_BYTE_PAIR(0x955E, 0x8C79)
+DOUBLE_BYTE_PAIR(0x955F, 0x5EDF)
+DOUBLE_BYTE_PAIR(0x9560, 0x63CF)
+DOUBLE_BYTE_PAIR(0x9561, 0x75C5)
+DOUBLE_BYTE_PAIR(0x9562, 0x79D2)
+DOUBLE_BYTE_PAIR(0x9563, 0x82D7)
+DOUBLE_BYTE_PAIR(0x9564, 0x9328)
+DOUBLE_BYTE_PAIR(0x9565, 0x92F2)
+DOUBLE_BYTE_PAIR(0x9566, 0x849C)
+DOUBLE_BYTE_PAIR(0x9567, 0x86ED)
+DOUBLE_BYTE_PAIR(0x9568, 0x9C2D)
+DOUBLE_BYTE_PAIR(0x9569, 0x54C1)
+DOUBLE_BYTE_PAIR(0x956A, 0x5F6C)
+DOUBLE_BYTE_PAIR(0x956B, 0x658C)
+DOUBLE_BYTE_PAIR(0x956C, 0x6D5C)
+DOUBLE_BYTE_PAIR(0x956D, 0x7015)
+DOUBLE_BYTE_PAIR(0x956E, 0x8CA7)
+DOUBLE_BYTE_PAIR(0x956F, 0x8CD3)
+DOUBLE_BYTE_PAIR(0x9570, 0x983B)
+DOUBLE_BYTE_PAIR(0x9571, 0x654F)
+DOUBLE_BYTE_PAIR(0x9572, 0x74F6)
+DOUBLE_BYTE_PAIR(0x9573, 0x4E0D)
+DOUBLE_BYTE_PAIR(0x9574, 0x4ED8)
+DOUBLE_BYTE_PAIR(0x9575, 0x57E0)
+DOUBLE_BYTE_PAIR(0x9576, 0x592B)
+DOUBLE_BYTE_PAIR(0x9577, 0x5A66)
+DOUBLE_BYTE_PAIR(0x9578, 0x5BCC)
+DOUBLE_BYTE_PAIR(0x9579, 0x51A8)
+DOUBLE_BYTE_PAIR(0x957A, 0x5E03)
+DOUBLE_BYTE_PAIR(0x957B, 0x5E9C)
+DOUBLE_BYTE_PAIR(0x957C, 0x6016)
+DOUBLE_BYTE_PAIR(0x957D, 0x6276)
+DOUBLE_BYTE_PAIR(0x957E, 0x6577)
+DOUBLE_BYTE_PAIR(0x9580, 0x65A7)
+DOUBLE_BYTE_PAIR(0x9581, 0x666E)
+DOUBLE_BYTE_PAIR(0x9582, 0x6D6E)
+DOUBLE_BYTE_PAIR(0x9583, 0x7236)
+DOUBLE_BYTE_PAIR(0x9584, 0x7B26)
+DOUBLE_BYTE_PAIR(0x9585, 0x8150)
+DOUBLE_BYTE_PAIR(0x9586, 0x819A)
+DOUBLE_BYTE_PAIR(0x9587, 0x8299)
+DOUBLE_BYTE_PAIR(0x9588, 0x8B5C)
+DOUBLE_BYTE_PAIR(0x9589, 0x8CA0)
+DOUBLE_BYTE_PAIR(0x958A, 0x8CE6)
+DOUBLE_BYTE_PAIR(0x958B, 0x8D74)
+DOUBLE_BYTE_PAIR(0x958C, 0x961C)
+DOUBLE_BYTE_PAIR(0x958D, 0x9644)
+DOUBLE_BYTE_PAIR(0x958E, 0x4FAE)
+DOUBLE_BYTE_PAIR(0x958F, 0x64AB)
+DOUBLE_BYTE_PAIR(0x9590, 0x6B66)
+DOUBLE_BYTE_PAIR(0x9591, 0x821E)
+DOUBLE_BYTE_PAIR(0x9592, 0x8461)
+DOUBLE_BYTE_PAIR(0x9593, 0x856A)
+DOUBLE_BYTE_PAIR(0x9594, 0x90E8)
+DOUBLE_BYTE_PAIR(0x9595, 0x5C01)
+DOUBLE_BYTE_PAIR(0x9596, 0x6953)
+DOUBLE_BYTE_PAIR(0x9597, 0x98A8)
+DOUBLE_BYTE_PAIR(0x9598, 0x847A)
+DOUBLE_BYTE_PAIR(0x9599, 0x8557)
+DOUBLE_BYTE_PAIR(0x959A, 0x4F0F)
+DOUBLE_BYTE_PAIR(0x959B, 0x526F)
+DOUBLE_BYTE_PAIR(0x959C, 0x5FA9)
+DOUBLE_BYTE_PAIR(0x959D, 0x5E45)
+DOUBLE_BYTE_PAIR(0x959E, 0x670D)
+DOUBLE_BYTE_PAIR(0x959F, 0x798F)
+DOUBLE_BYTE_PAIR(0x95A0, 0x8179)
+DOUBLE_BYTE_PAIR(0x95A1, 0x8907)
+DOUBLE_BYTE_PAIR(0x95A2, 0x8986)
+DOUBLE_BYTE_PAIR(0x95A3, 0x6DF5)
+DOUBLE_BYTE_PAIR(0x95A4, 0x5F17)
+DOUBLE_BYTE_PAIR(0x95A5, 0x6255)
+DOUBLE_BYTE_PAIR(0x95A6, 0x6CB8)
+DOUBLE_BYTE_PAIR(0x95A7, 0x4ECF)
+DOUBLE_BYTE_PAIR(0x95A8, 0x7269)
+DOUBLE_BYTE_PAIR(0x95A9, 0x9B92)
+DOUBLE_BYTE_PAIR(0x95AA, 0x5206)
+DOUBLE_BYTE_PAIR(0x95AB, 0x543B)
+DOUBLE_BYTE_PAIR(0x95AC, 0x5674)
+DOUBLE_BYTE_PAIR(0x95AD, 0x58B3)
+DOUBLE_BYTE_PAIR(0x95AE, 0x61A4)
+DOUBLE_BYTE_PAIR(0x95AF, 0x626E)
+DOUBLE_BYTE_PAIR(0x95B0, 0x711A)
+DOUBLE_BYTE_PAIR(0x95B1, 0x596E)
+DOUBLE_BYTE_PAIR(0x95B2, 0x7C89)
+DOUBLE_BYTE_PAIR(0x95B3, 0x7CDE)
+DOUBLE_BYTE_PAIR(0x95B4, 0x7D1B)
+DOUBLE_BYTE_PAIR(0x95B5, 0x96F0)
+DOUBLE_BYTE_PAIR(0x95B6, 0x6587)
+DOUBLE_BYTE_PAIR(0x95B7, 0x805E)
+DOUBLE_BYTE_PAIR(0x95B8, 0x4E19)
+DOUBLE_BYTE_PAIR(0x95B9, 0x4F75)
+DOUBLE_BYTE_PAIR(0x95BA, 0x5175)
+DOUBLE_BYTE_PAIR(0x95BB, 0x5840)
+DOUBLE_BYTE_PAIR(0x95BC, 0x5E63)
+DOUBLE_BYTE_PAIR(0x95BD, 0x5E73)
+DOUBLE_BYTE_PAIR(0x95BE, 0x5F0A)
+DOUBLE_BYTE_PAIR(0x95BF, 0x67C4)
+DOUBLE_BYTE_PAIR(0x95C0, 0x4E26)
+DOUBLE_BYTE_PAIR(0x95C1, 0x853D)
+DOUBLE_BYTE_PAIR(0x95C2, 0x9589)
+DOUBLE_BYTE_PAIR(0x95C3, 0x965B)
+DOUBLE_BYTE_PAIR(0x95C4, 0x7C73)
+DOUBLE_BYTE_PAIR(0x95C5, 0x9801)
+DOUBLE_BYTE_PAIR(0x95C6, 0x50FB)
+DOUBLE_BYTE_PAIR(0x95C7, 0x58C1)
+DOUBLE_BYTE_PAIR(0x95C8, 0x7656)
+DOUBLE_BYTE_PAIR(0x95C9, 0x78A7)
+DOUBLE_BYTE_PAIR(0x95CA, 0x5225)
+DOUBLE_BYTE_PAIR(0x95CB, 0x77A5)
+DOUBLE_BYTE_PAIR(0x95CC, 0x8511)
+DOUBLE_BYTE_PAIR(0x95CD, 0x7B86)
+DOUBLE_BYTE_PAIR(0x95CE, 0x504F)
+DOUBLE_BYTE_PAIR(0x95CF, 0x5909)
+DOUBLE_BYTE_PAIR(0x95D0, 0x7247)
+DOUBLE_BYTE_PAIR(0x95D1, 0x7BC7)
+DOUBLE_BYTE_PAIR(0x95D2, 0x7DE8)
+DOUBLE_BYTE_PAIR(0x95D3, 0x8FBA)
+DOUBLE_BYTE_PAIR(0x95D4, 0x8FD4)
+DOUBLE_BYTE_PAIR(0x95D5, 0x904D)
+DOUBLE_BYTE_PAIR(0x95D6, 0x4FBF)
+DOUBLE_BYTE_PAIR(0x95D7, 0x52C9)
+DOUBLE_BYTE_PAIR(0x95D8, 0x5A29)
+DOUBLE_BYTE_PAIR(0x95D9, 0x5F01)
+DOUBLE_BYTE_PAIR(0x95DA, 0x97AD)
+DOUBLE_BYTE_PAIR(0x95DB, 0x4FDD)
+DOUBLE_BYTE_PAIR(0x95DC, 0x8217)
+DOUBLE_BYTE_PAIR(0x95DD, 0x92EA)
+DOUBLE_BYTE_PAIR(0x95DE, 0x5703)
+DOUBLE_BYTE_PAIR(0x95DF, 0x6355)
+DOUBLE_BYTE_PAIR(0x95E0, 0x6B69)
+DOUBLE_BYTE_PAIR(0x95E1, 0x752B)
+DOUBLE_BYTE_PAIR(0x95E2, 0x88DC)
+DOUBLE_BYTE_PAIR(0x95E3, 0x8F14)
+DOUBLE_BYTE_PAIR(0x95E4, 0x7A42)
+DOUBLE_BYTE_PAIR(0x95E5, 0x52DF)
+DOUBLE_BYTE_PAIR(0x95E6, 0x5893)
+DOUBLE_BYTE_PAIR(0x95E7, 0x6155)
+DOUBLE_BYTE_PAIR(0x95E8, 0x620A)
+DOUBLE_BYTE_PAIR(0x95E9, 0x66AE)
+DOUBLE_BYTE_PAIR(0x95EA, 0x6BCD)
+DOUBLE_BYTE_PAIR(0x95EB, 0x7C3F)
+DOUBLE_BYTE_PAIR(0x95EC, 0x83E9)
+DOUBLE_BYTE_PAIR(0x95ED, 0x5023)
+DOUBLE_BYTE_PAIR(0x95EE, 0x4FF8)
+DOUBLE_BYTE_PAIR(0x95EF, 0x5305)
+DOUBLE_BYTE_PAIR(0x95F0, 0x5446)
+DOUBLE_BYTE_PAIR(0x95F1, 0x5831)
+DOUBLE_BYTE_PAIR(0x95F2, 0x5949)
+DOUBLE_BYTE_PAIR(0x95F3, 0x5B9D)
+DOUBLE_BYTE_PAIR(0x95F4, 0x5CF0)
+DOUBLE_BYTE_PAIR(0x95F5, 0x5CEF)
+DOUBLE_BYTE_PAIR(0x95F6, 0x5D29)
+DOUBLE_BYTE_PAIR(0x95F7, 0x5E96)
+DOUBLE_BYTE_PAIR(0x95F8, 0x62B1)
+DOUBLE_BYTE_PAIR(0x95F9, 0x6367)
+DOUBLE_BYTE_PAIR(0x95FA, 0x653E)
+DOUBLE_BYTE_PAIR(0x95FB, 0x65B9)
+DOUBLE_BYTE_PAIR(0x95FC, 0x670B)
+DOUBLE_BYTE_PAIR(0x9640, 0x6CD5)
+DOUBLE_BYTE_PAIR(0x9641, 0x6CE1)
+DOUBLE_BYTE_PAIR(0x9642, 0x70F9)
+DOUBLE_BYTE_PAIR(0x9643, 0x7832)
+DOUBLE_BYTE_PAIR(0x9644, 0x7E2B)
+DOUBLE_BYTE_PAIR(0x9645, 0x80DE)
+DOUBLE_BYTE_PAIR(0x9646, 0x82B3)
+DOUBLE_BYTE_PAIR(0x9647, 0x840C)
+DOUBLE_BYTE_PAIR(0x9648, 0x84EC)
+DOUBLE_BYTE_PAIR(0x9649, 0x8702)
+DOUBLE_BYTE_PAIR(0x964A, 0x8912)
+DOUBLE_BYTE_PAIR(0x964B, 0x8A2A)
+DOUBLE_BYTE_PAIR(0x964C, 0x8C4A)
+DOUBLE_BYTE_PAIR(0x964D, 0x90A6)
+DOUBLE_BYTE_PAIR(0x964E, 0x92D2)
+DOUBLE_BYTE_PAIR(0x964F, 0x98FD)
+DOUBLE_BYTE_PAIR(0x9650, 0x9CF3)
+DOUBLE_BYTE_PAIR(0x9651, 0x9D6C)
+DOUBLE_BYTE_PAIR(0x9652, 0x4E4F)
+DOUBLE_BYTE_PAIR(0x9653, 0x4EA1)
+DOUBLE_BYTE_PAIR(0x9654, 0x508D)
+DOUBLE_BYTE_PAIR(0x9655, 0x5256)
+DOUBLE_BYTE_PAIR(0x9656, 0x574A)
+DOUBLE_BYTE_PAIR(0x9657, 0x59A8)
+DOUBLE_BYTE_PAIR(0x9658, 0x5E3D)
+DOUBLE_BYTE_PAIR(0x9659, 0x5FD8)
+DOUBLE_BYTE_PAIR(0x965A, 0x5FD9)
+DOUBLE_BYTE_PAIR(0x965B, 0x623F)
+DOUBLE_BYTE_PAIR(0x965C, 0x66B4)
+DOUBLE_BYTE_PAIR(0x965D, 0x671B)
+DOUBLE_BYTE_PAIR(0x965E, 0x67D0)
+DOUBLE_BYTE_PAIR(0x965F, 0x68D2)
+DOUBLE_BYTE_PAIR(0x9660, 0x5192)
+DOUBLE_BYTE_PAIR(0x9661, 0x7D21)
+DOUBLE_BYTE_PAIR(0x9662, 0x80AA)
+DOUBLE_BYTE_PAIR(0x9663, 0x81A8)
+DOUBLE_BYTE_PAIR(0x9664, 0x8B00)
+DOUBLE_BYTE_PAIR(0x9665, 0x8C8C)
+DOUBLE_BYTE_PAIR(0x9666, 0x8CBF)
+DOUBLE_BYTE_PAIR(0x9667, 0x927E)
+DOUBLE_BYTE_PAIR(0x9668, 0x9632)
+DOUBLE_BYTE_PAIR(0x9669, 0x5420)
+DOUBLE_BYTE_PAIR(0x966A, 0x982C)
+DOUBLE_BYTE_PAIR(0x966B, 0x5317)
+DOUBLE_BYTE_PAIR(0x966C, 0x50D5)
+DOUBLE_BYTE_PAIR(0x966D, 0x535C)
+DOUBLE_BYTE_PAIR(0x966E, 0x58A8)
+DOUBLE_BYTE_PAIR(0x966F, 0x64B2)
+DOUBLE_BYTE_PAIR(0x9670, 0x6734)
+DOUBLE_BYTE_PAIR(0x9671, 0x7267)
+DOUBLE_BYTE_PAIR(0x9672, 0x7766)
+DOUBLE_BYTE_PAIR(0x9673, 0x7A46)
+DOUBLE_BYTE_PAIR(0x9674, 0x91E6)
+DOUBLE_BYTE_PAIR(0x9675, 0x52C3)
+DOUBLE_BYTE_PAIR(0x9676, 0x6CA1)
+DOUBLE_BYTE_PAIR(0x9677, 0x6B86)
+DOUBLE_BYTE_PAIR(0x9678, 0x5800)
+DOUBLE_BYTE_PAIR(0x9679, 0x5E4C)
+DOUBLE_BYTE_PAIR(0x967A, 0x5954)
+DOUBLE_BYTE_PAIR(0x967B, 0x672C)
+DOUBLE_BYTE_PAIR(0x967C, 0x7FFB)
+DOUBLE_BYTE_PAIR(0x967D, 0x51E1)
+DOUBLE_BYTE_PAIR(0x967E, 0x76C6)
+DOUBLE_BYTE_PAIR(0x9680, 0x6469)
+DOUBLE_BYTE_PAIR(0x9681, 0x78E8)
+DOUBLE_BYTE_PAIR(0x9682, 0x9B54)
+DOUBLE_BYTE_PAIR(0x9683, 0x9EBB)
+DOUBLE_BYTE_PAIR(0x9684, 0x57CB)
+DOUBLE_BYTE_PAIR(0x9685, 0x59B9)
+DOUBLE_BYTE_PAIR(0x9686, 0x6627)
+DOUBLE_BYTE_PAIR(0x9687, 0x679A)
+DOUBLE_BYTE_PAIR(0x9688, 0x6BCE)
+DOUBLE_BYTE_PAIR(0x9689, 0x54E9)
+DOUBLE_BYTE_PAIR(0x968A, 0x69D9)
+DOUBLE_BYTE_PAIR(0x968B, 0x5E55)
+DOUBLE_BYTE_PAIR(0x968C, 0x819C)
+DOUBLE_BYTE_PAIR(0x968D, 0x6795)
+DOUBLE_BYTE_PAIR(0x968E, 0x9BAA)
+DOUBLE_BYTE_PAIR(0x968F, 0x67FE)
+DOUBLE_BYTE_PAIR(0x9690, 0x9C52)
+DOUBLE_BYTE_PAIR(0x9691, 0x685D)
+DOUBLE_BYTE_PAIR(0x9692, 0x4EA6)
+DOUBLE_BYTE_PAIR(0x9693, 0x4FE3)
+DOUBLE_BYTE_PAIR(0x9694, 0x53C8)
+DOUBLE_BYTE_PAIR(0x9695, 0x62B9)
+DOUBLE_BYTE_PAIR(0x9696, 0x672B)
+DOUBLE_BYTE_PAIR(0x9697, 0x6CAB)
+DOUBLE_BYTE_PAIR(0x9698, 0x8FC4)
+DOUBLE_BYTE_PAIR(0x9699, 0x4FAD)
+DOUBLE_BYTE_PAIR(0x969A, 0x7E6D)
+DOUBLE_BYTE_PAIR(0x969B, 0x9EBF)
+DOUBLE_BYTE_PAIR(0x969C, 0x4E07)
+DOUBLE_BYTE_PAIR(0x969D, 0x6162)
+DOUBLE_BYTE_PAIR(0x969E, 0x6E80)
+DOUBLE_BYTE_PAIR(0x969F, 0x6F2B)
+DOUBLE_BYTE_PAIR(0x96A0, 0x8513)
+DOUBLE_BYTE_PAIR(0x96A1, 0x5473)
+DOUBLE_BYTE_PAIR(0x96A2, 0x672A)
+DOUBLE_BYTE_PAIR(0x96A3, 0x9B45)
+DOUBLE_BYTE_PAIR(0x96A4, 0x5DF3)
+DOUBLE_BYTE_PAIR(0x96A5, 0x7B95)
+DOUBLE_BYTE_PAIR(0x96A6, 0x5CAC)
+DOUBLE_BYTE_PAIR(0x96A7, 0x5BC6)
+DOUBLE_BYTE_PAIR(0x96A8, 0x871C)
+DOUBLE_BYTE_PAIR(0x96A9, 0x6E4A)
+DOUBLE_BYTE_PAIR(0x96AA, 0x84D1)
+DOUBLE_BYTE_PAIR(0x96AB, 0x7A14)
+DOUBLE_BYTE_PAIR(0x96AC, 0x8108)
+DOUBLE_BYTE_PAIR(0x96AD, 0x5999)
+DOUBLE_BYTE_PAIR(0x96AE, 0x7C8D)
+DOUBLE_BYTE_PAIR(0x96AF, 0x6C11)
+DOUBLE_BYTE_PAIR(0x96B0, 0x7720)
+DOUBLE_BYTE_PAIR(0x96B1, 0x52D9)
+DOUBLE_BYTE_PAIR(0x96B2, 0x5922)
+DOUBLE_BYTE_PAIR(0x96B3, 0x7121)
+DOUBLE_BYTE_PAIR(0x96B4, 0x725F)
+DOUBLE_BYTE_PAIR(0x96B5, 0x77DB)
+DOUBLE_BYTE_PAIR(0x96B6, 0x9727)
+DOUBLE_BYTE_PAIR(0x96B7, 0x9D61)
+DOUBLE_BYTE_PAIR(0x96B8, 0x690B)
+DOUBLE_BYTE_PAIR(0x96B9, 0x5A7F)
+DOUBLE_BYTE_PAIR(0x96BA, 0x5A18)
+DOUBLE_BYTE_PAIR(0x96BB, 0x51A5)
+DOUBLE_BYTE_PAIR(0x96BC, 0x540D)
+DOUBLE_BYTE_PAIR(0x96BD, 0x547D)
+DOUBLE_BYTE_PAIR(0x96BE, 0x660E)
+DOUBLE_BYTE_PAIR(0x96BF, 0x76DF)
+DOUBLE_BYTE_PAIR(0x96C0, 0x8FF7)
+DOUBLE_BYTE_PAIR(0x96C1, 0x9298)
+DOUBLE_BYTE_PAIR(0x96C2, 0x9CF4)
+DOUBLE_BYTE_PAIR(0x96C3, 0x59EA)
+DOUBLE_BYTE_PAIR(0x96C4, 0x725D)
+DOUBLE_BYTE_PAIR(0x96C5, 0x6EC5)
+DOUBLE_BYTE_PAIR(0x96C6, 0x514D)
+DOUBLE_BYTE_PAIR(0x96C7, 0x68C9)
+DOUBLE_BYTE_PAIR(0x96C8, 0x7DBF)
+DOUBLE_BYTE_PAIR(0x96C9, 0x7DEC)
+DOUBLE_BYTE_PAIR(0x96CA, 0x9762)
+DOUBLE_BYTE_PAIR(0x96CB, 0x9EBA)
+DOUBLE_BYTE_PAIR(0x96CC, 0x6478)
+DOUBLE_BYTE_PAIR(0x96CD, 0x6A21)
+DOUBLE_BYTE_PAIR(0x96CE, 0x8302)
+DOUBLE_BYTE_PAIR(0x96CF, 0x5984)
+DOUBLE_BYTE_PAIR(0x96D0, 0x5B5F)
+DOUBLE_BYTE_PAIR(0x96D1, 0x6BDB)
+DOUBLE_BYTE_PAIR(0x96D2, 0x731B)
+DOUBLE_BYTE_PAIR(0x96D3, 0x76F2)
+DOUBLE_BYTE_PAIR(0x96D4, 0x7DB2)
+DOUBLE_BYTE_PAIR(0x96D5, 0x8017)
+DOUBLE_BYTE_PAIR(0x96D6, 0x8499)
+DOUBLE_BYTE_PAIR(0x96D7, 0x5132)
+DOUBLE_BYTE_PAIR(0x96D8, 0x6728)
+DOUBLE_BYTE_PAIR(0x96D9, 0x9ED9)
+DOUBLE_BYTE_PAIR(0x96DA, 0x76EE)
+DOUBLE_BYTE_PAIR(0x96DB, 0x6762)
+DOUBLE_BYTE_PAIR(0x96DC, 0x52FF)
+DOUBLE_BYTE_PAIR(0x96DD, 0x9905)
+DOUBLE_BYTE_PAIR(0x96DE, 0x5C24)
+DOUBLE_BYTE_PAIR(0x96DF, 0x623B)
+DOUBLE_BYTE_PAIR(0x96E0, 0x7C7E)
+DOUBLE_BYTE_PAIR(0x96E1, 0x8CB0)
+DOUBLE_BYTE_PAIR(0x96E2, 0x554F)
+DOUBLE_BYTE_PAIR(0x96E3, 0x60B6)
+DOUBLE_BYTE_PAIR(0x96E4, 0x7D0B)
+DOUBLE_BYTE_PAIR(0x96E5, 0x9580)
+DOUBLE_BYTE_PAIR(0x96E6, 0x5301)
+DOUBLE_BYTE_PAIR(0x96E7, 0x4E5F)
+DOUBLE_BYTE_PAIR(0x96E8, 0x51B6)
+DOUBLE_BYTE_PAIR(0x96E9, 0x591C)
+DOUBLE_BYTE_PAIR(0x96EA, 0x723A)
+DOUBLE_BYTE_PAIR(0x96EB, 0x8036)
+DOUBLE_BYTE_PAIR(0x96EC, 0x91CE)
+DOUBLE_BYTE_PAIR(0x96ED, 0x5F25)
+DOUBLE_BYTE_PAIR(0x96EE, 0x77E2)
+DOUBLE_BYTE_PAIR(0x96EF, 0x5384)
+DOUBLE_BYTE_PAIR(0x96F0, 0x5F79)
+DOUBLE_BYTE_PAIR(0x96F1, 0x7D04)
+DOUBLE_BYTE_PAIR(0x96F2, 0x85AC)
+DOUBLE_BYTE_PAIR(0x96F3, 0x8A33)
+DOUBLE_BYTE_PAIR(0x96F4, 0x8E8D)
+DOUBLE_BYTE_PAIR(0x96F5, 0x9756)
+DOUBLE_BYTE_PAIR(0x96F6, 0x67F3)
+DOUBLE_BYTE_PAIR(0x96F7, 0x85AE)
+DOUBLE_BYTE_PAIR(0x96F8, 0x9453)
+DOUBLE_BYTE_PAIR(0x96F9, 0x6109)
+DOUBLE_BYTE_PAIR(0x96FA, 0x6108)
+DOUBLE_BYTE_PAIR(0x96FB, 0x6CB9)
+DOUBLE_BYTE_PAIR(0x96FC, 0x7652)
+DOUBLE_BYTE_PAIR(0x9740, 0x8AED)
+DOUBLE_BYTE_PAIR(0x9741, 0x8F38)
+DOUBLE_BYTE_PAIR(0x9742, 0x552F)
+DOUBLE_BYTE_PAIR(0x9743, 0x4F51)
+DOUBLE_BYTE_PAIR(0x9744, 0x512A)
+DOUBLE_BYTE_PAIR(0x9745, 0x52C7)
+DOUBLE_BYTE_PAIR(0x9746, 0x53CB)
+DOUBLE_BYTE_PAIR(0x9747, 0x5BA5)
+DOUBLE_BYTE_PAIR(0x9748, 0x5E7D)
+DOUBLE_BYTE_PAIR(0x9749, 0x60A0)
+DOUBLE_BYTE_PAIR(0x974A, 0x6182)
+DOUBLE_BYTE_PAIR(0x974B, 0x63D6)
+DOUBLE_BYTE_PAIR(0x974C, 0x6709)
+DOUBLE_BYTE_PAIR(0x974D, 0x67DA)
+DOUBLE_BYTE_PAIR(0x974E, 0x6E67)
+DOUBLE_BYTE_PAIR(0x974F, 0x6D8C)
+DOUBLE_BYTE_PAIR(0x9750, 0x7336)
+DOUBLE_BYTE_PAIR(0x9751, 0x7337)
+DOUBLE_BYTE_PAIR(0x9752, 0x7531)
+DOUBLE_BYTE_PAIR(0x9753, 0x7950)
+DOUBLE_BYTE_PAIR(0x9754, 0x88D5)
+DOUBLE_BYTE_PAIR(0x9755, 0x8A98)
+DOUBLE_BYTE_PAIR(0x9756, 0x904A)
+DOUBLE_BYTE_PAIR(0x9757, 0x9091)
+DOUBLE_BYTE_PAIR(0x9758, 0x90F5)
+DOUBLE_BYTE_PAIR(0x9759, 0x96C4)
+DOUBLE_BYTE_PAIR(0x975A, 0x878D)
+DOUBLE_BYTE_PAIR(0x975B, 0x5915)
+DOUBLE_BYTE_PAIR(0x975C, 0x4E88)
+DOUBLE_BYTE_PAIR(0x975D, 0x4F59)
+DOUBLE_BYTE_PAIR(0x975E, 0x4E0E)
+DOUBLE_BYTE_PAIR(0x975F, 0x8A89)
+DOUBLE_BYTE_PAIR(0x9760, 0x8F3F)
+DOUBLE_BYTE_PAIR(0x9761, 0x9810)
+DOUBLE_BYTE_PAIR(0x9762, 0x50AD)
+DOUBLE_BYTE_PAIR(0x9763, 0x5E7C)
+DOUBLE_BYTE_PAIR(0x9764, 0x5996)
+DOUBLE_BYTE_PAIR(0x9765, 0x5BB9)
+DOUBLE_BYTE_PAIR(0x9766, 0x5EB8)
+DOUBLE_BYTE_PAIR(0x9767, 0x63DA)
+DOUBLE_BYTE_PAIR(0x9768, 0x63FA)
+DOUBLE_BYTE_PAIR(0x9769, 0x64C1)
+DOUBLE_BYTE_PAIR(0x976A, 0x66DC)
+DOUBLE_BYTE_PAIR(0x976B, 0x694A)
+DOUBLE_BYTE_PAIR(0x976C, 0x69D8)
+DOUBLE_BYTE_PAIR(0x976D, 0x6D0B)
+DOUBLE_BYTE_PAIR(0x976E, 0x6EB6)
+DOUBLE_BYTE_PAIR(0x976F, 0x7194)
+DOUBLE_BYTE_PAIR(0x9770, 0x7528)
+DOUBLE_BYTE_PAIR(0x9771, 0x7AAF)
+DOUBLE_BYTE_PAIR(0x9772, 0x7F8A)
+DOUBLE_BYTE_PAIR(0x9773, 0x8000)
+DOUBLE_BYTE_PAIR(0x9774, 0x8449)
+DOUBLE_BYTE_PAIR(0x9775, 0x84C9)
+DOUBLE_BYTE_PAIR(0x9776, 0x8981)
+DOUBLE_BYTE_PAIR(0x9777, 0x8B21)
+DOUBLE_BYTE_PAIR(0x9778, 0x8E0A)
+DOUBLE_BYTE_PAIR(0x9779, 0x9065)
+DOUBLE_BYTE_PAIR(0x977A, 0x967D)
+DOUBLE_BYTE_PAIR(0x977B, 0x990A)
+DOUBLE_BYTE_PAIR(0x977C, 0x617E)
+DOUBLE_BYTE_PAIR(0x977D, 0x6291)
+DOUBLE_BYTE_PAIR(0x977E, 0x6B32)
+DOUBLE_BYTE_PAIR(0x9780, 0x6C83)
+DOUBLE_BYTE_PAIR(0x9781, 0x6D74)
+DOUBLE_BYTE_PAIR(0x9782, 0x7FCC)
+DOUBLE_BYTE_PAIR(0x9783, 0x7FFC)
+DOUBLE_BYTE_PAIR(0x9784, 0x6DC0)
+DOUBLE_BYTE_PAIR(0x9785, 0x7F85)
+DOUBLE_BYTE_PAIR(0x9786, 0x87BA)
+DOUBLE_BYTE_PAIR(0x9787, 0x88F8)
+DOUBLE_BYTE_PAIR(0x9788, 0x6765)
+DOUBLE_BYTE_PAIR(0x9789, 0x83B1)
+DOUBLE_BYTE_PAIR(0x978A, 0x983C)
+DOUBLE_BYTE_PAIR(0x978B, 0x96F7)
+DOUBLE_BYTE_PAIR(0x978C, 0x6D1B)
+DOUBLE_BYTE_PAIR(0x978D, 0x7D61)
+DOUBLE_BYTE_PAIR(0x978E, 0x843D)
+DOUBLE_BYTE_PAIR(0x978F, 0x916A)
+DOUBLE_BYTE_PAIR(0x9790, 0x4E71)
+DOUBLE_BYTE_PAIR(0x9791, 0x5375)
+DOUBLE_BYTE_PAIR(0x9792, 0x5D50)
+DOUBLE_BYTE_PAIR(0x9793, 0x6B04)
+DOUBLE_BYTE_PAIR(0x9794, 0x6FEB)
+DOUBLE_BYTE_PAIR(0x9795, 0x85CD)
+DOUBLE_BYTE_PAIR(0x9796, 0x862D)
+DOUBLE_BYTE_PAIR(0x9797, 0x89A7)
+DOUBLE_BYTE_PAIR(0x9798, 0x5229)
+DOUBLE_BYTE_PAIR(0x9799, 0x540F)
+DOUBLE_BYTE_PAIR(0x979A, 0x5C65)
+DOUBLE_BYTE_PAIR(0x979B, 0x674E)
+DOUBLE_BYTE_PAIR(0x979C, 0x68A8)
+DOUBLE_BYTE_PAIR(0x979D, 0x7406)
+DOUBLE_BYTE_PAIR(0x979E, 0x7483)
+DOUBLE_BYTE_PAIR(0x979F, 0x75E2)
+DOUBLE_BYTE_PAIR(0x97A0, 0x88CF)
+DOUBLE_BYTE_PAIR(0x97A1, 0x88E1)
+DOUBLE_BYTE_PAIR(0x97A2, 0x91CC)
+DOUBLE_BYTE_PAIR(0x97A3, 0x96E2)
+DOUBLE_BYTE_PAIR(0x97A4, 0x9678)
+DOUBLE_BYTE_PAIR(0x97A5, 0x5F8B)
+DOUBLE_BYTE_PAIR(0x97A6, 0x7387)
+DOUBLE_BYTE_PAIR(0x97A7, 0x7ACB)
+DOUBLE_BYTE_PAIR(0x97A8, 0x844E)
+DOUBLE_BYTE_PAIR(0x97A9, 0x63A0)
+DOUBLE_BYTE_PAIR(0x97AA, 0x7565)
+DOUBLE_BYTE_PAIR(0x97AB, 0x5289)
+DOUBLE_BYTE_PAIR(0x97AC, 0x6D41)
+DOUBLE_BYTE_PAIR(0x97AD, 0x6E9C)
+DOUBLE_BYTE_PAIR(0x97AE, 0x7409)
+DOUBLE_BYTE_PAIR(0x97AF, 0x7559)
+DOUBLE_BYTE_PAIR(0x97B0, 0x786B)
+DOUBLE_BYTE_PAIR(0x97B1, 0x7C92)
+DOUBLE_BYTE_PAIR(0x97B2, 0x9686)
+DOUBLE_BYTE_PAIR(0x97B3, 0x7ADC)
+DOUBLE_BYTE_PAIR(0x97B4, 0x9F8D)
+DOUBLE_BYTE_PAIR(0x97B5, 0x4FB6)
+DOUBLE_BYTE_PAIR(0x97B6, 0x616E)
+DOUBLE_BYTE_PAIR(0x97B7, 0x65C5)
+DOUBLE_BYTE_PAIR(0x97B8, 0x865C)
+DOUBLE_BYTE_PAIR(0x97B9, 0x4E86)
+DOUBLE_BYTE_PAIR(0x97BA, 0x4EAE)
+DOUBLE_BYTE_PAIR(0x97BB, 0x50DA)
+DOUBLE_BYTE_PAIR(0x97BC, 0x4E21)
+DOUBLE_BYTE_PAIR(0x97BD, 0x51CC)
+DOUBLE_BYTE_PAIR(0x97BE, 0x5BEE)
+DOUBLE_BYTE_PAIR(0x97BF, 0x6599)
+DOUBLE_BYTE_PAIR(0x97C0, 0x6881)
+DOUBLE_BYTE_PAIR(0x97C1, 0x6DBC)
+DOUBLE_BYTE_PAIR(0x97C2, 0x731F)
+DOUBLE_BYTE_PAIR(0x97C3, 0x7642)
+DOUBLE_BYTE_PAIR(0x97C4, 0x77AD)
+DOUBLE_BYTE_PAIR(0x97C5, 0x7A1C)
+DOUBLE_BYTE_PAIR(0x97C6, 0x7CE7)
+DOUBLE_BYTE_PAIR(0x97C7, 0x826F)
+DOUBLE_BYTE_PAIR(0x97C8, 0x8AD2)
+DOUBLE_BYTE_PAIR(0x97C9, 0x907C)
+DOUBLE_BYTE_PAIR(0x97CA, 0x91CF)
+DOUBLE_BYTE_PAIR(0x97CB, 0x9675)
+DOUBLE_BYTE_PAIR(0x97CC, 0x9818)
+DOUBLE_BYTE_PAIR(0x97CD, 0x529B)
+DOUBLE_BYTE_PAIR(0x97CE, 0x7DD1)
+DOUBLE_BYTE_PAIR(0x97CF, 0x502B)
+DOUBLE_BYTE_PAIR(0x97D0, 0x5398)
+DOUBLE_BYTE_PAIR(0x97D1, 0x6797)
+DOUBLE_BYTE_PAIR(0x97D2, 0x6DCB)
+DOUBLE_BYTE_PAIR(0x97D3, 0x71D0)
+DOUBLE_BYTE_PAIR(0x97D4, 0x7433)
+DOUBLE_BYTE_PAIR(0x97D5, 0x81E8)
+DOUBLE_BYTE_PAIR(0x97D6, 0x8F2A)
+DOUBLE_BYTE_PAIR(0x97D7, 0x96A3)
+DOUBLE_BYTE_PAIR(0x97D8, 0x9C57)
+DOUBLE_BYTE_PAIR(0x97D9, 0x9E9F)
+DOUBLE_BYTE_PAIR(0x97DA, 0x7460)
+DOUBLE_BYTE_PAIR(0x97DB, 0x5841)
+DOUBLE_BYTE_PAIR(0x97DC, 0x6D99)
+DOUBLE_BYTE_PAIR(0x97DD, 0x7D2F)
+DOUBLE_BYTE_PAIR(0x97DE, 0x985E)
+DOUBLE_BYTE_PAIR(0x97DF, 0x4EE4)
+DOUBLE_BYTE_PAIR(0x97E0, 0x4F36)
+DOUBLE_BYTE_PAIR(0x97E1, 0x4F8B)
+DOUBLE_BYTE_PAIR(0x97E2, 0x51B7)
+DOUBLE_BYTE_PAIR(0x97E3, 0x52B1)
+DOUBLE_BYTE_PAIR(0x97E4, 0x5DBA)
+DOUBLE_BYTE_PAIR(0x97E5, 0x601C)
+DOUBLE_BYTE_PAIR(0x97E6, 0x73B2)
+DOUBLE_BYTE_PAIR(0x97E7, 0x793C)
+DOUBLE_BYTE_PAIR(0x97E8, 0x82D3)
+DOUBLE_BYTE_PAIR(0x97E9, 0x9234)
+DOUBLE_BYTE_PAIR(0x97EA, 0x96B7)
+DOUBLE_BYTE_PAIR(0x97EB, 0x96F6)
+DOUBLE_BYTE_PAIR(0x97EC, 0x970A)
+DOUBLE_BYTE_PAIR(0x97ED, 0x9E97)
+DOUBLE_BYTE_PAIR(0x97EE, 0x9F62)
+DOUBLE_BYTE_PAIR(0x97EF, 0x66A6)
+DOUBLE_BYTE_PAIR(0x97F0, 0x6B74)
+DOUBLE_BYTE_PAIR(0x97F1, 0x5217)
+DOUBLE_BYTE_PAIR(0x97F2, 0x52A3)
+DOUBLE_BYTE_PAIR(0x97F3, 0x70C8)
+DOUBLE_BYTE_PAIR(0x97F4, 0x88C2)
+DOUBLE_BYTE_PAIR(0x97F5, 0x5EC9)
+DOUBLE_BYTE_PAIR(0x97F6, 0x604B)
+DOUBLE_BYTE_PAIR(0x97F7, 0x6190)
+DOUBLE_BYTE_PAIR(0x97F8, 0x6F23)
+DOUBLE_BYTE_PAIR(0x97F9, 0x7149)
+DOUBLE_BYTE_PAIR(0x97FA, 0x7C3E)
+DOUBLE_BYTE_PAIR(0x97FB, 0x7DF4)
+DOUBLE_BYTE_PAIR(0x97FC, 0x806F)
+DOUBLE_BYTE_PAIR(0x9840, 0x84EE)
+DOUBLE_BYTE_PAIR(0x9841, 0x9023)
+DOUBLE_BYTE_PAIR(0x9842, 0x932C)
+DOUBLE_BYTE_PAIR(0x9843, 0x5442)
+DOUBLE_BYTE_PAIR(0x9844, 0x9B6F)
+DOUBLE_BYTE_PAIR(0x9845, 0x6AD3)
+DOUBLE_BYTE_PAIR(0x9846, 0x7089)
+DOUBLE_BYTE_PAIR(0x9847, 0x8CC2)
+DOUBLE_BYTE_PAIR(0x9848, 0x8DEF)
+DOUBLE_BYTE_PAIR(0x9849, 0x9732)
+DOUBLE_BYTE_PAIR(0x984A, 0x52B4)
+DOUBLE_BYTE_PAIR(0x984B, 0x5A41)
+DOUBLE_BYTE_PAIR(0x984C, 0x5ECA)
+DOUBLE_BYTE_PAIR(0x984D, 0x5F04)
+DOUBLE_BYTE_PAIR(0x984E, 0x6717)
+DOUBLE_BYTE_PAIR(0x984F, 0x697C)
+DOUBLE_BYTE_PAIR(0x9850, 0x6994)
+DOUBLE_BYTE_PAIR(0x9851, 0x6D6A)
+DOUBLE_BYTE_PAIR(0x9852, 0x6F0F)
+DOUBLE_BYTE_PAIR(0x9853, 0x7262)
+DOUBLE_BYTE_PAIR(0x9854, 0x72FC)
+DOUBLE_BYTE_PAIR(0x9855, 0x7BED)
+DOUBLE_BYTE_PAIR(0x9856, 0x8001)
+DOUBLE_BYTE_PAIR(0x9857, 0x807E)
+DOUBLE_BYTE_PAIR(0x9858, 0x874B)
+DOUBLE_BYTE_PAIR(0x9859, 0x90CE)
+DOUBLE_BYTE_PAIR(0x985A, 0x516D)
+DOUBLE_BYTE_PAIR(0x985B, 0x9E93)
+DOUBLE_BYTE_PAIR(0x985C, 0x7984)
+DOUBLE_BYTE_PAIR(0x985D, 0x808B)
+DOUBLE_BYTE_PAIR(0x985E, 0x9332)
+DOUBLE_BYTE_PAIR(0x985F, 0x8AD6)
+DOUBLE_BYTE_PAIR(0x9860, 0x502D)
+DOUBLE_BYTE_PAIR(0x9861, 0x548C)
+DOUBLE_BYTE_PAIR(0x9862, 0x8A71)
+DOUBLE_BYTE_PAIR(0x9863, 0x6B6A)
+DOUBLE_BYTE_PAIR(0x9864, 0x8CC4)
+DOUBLE_BYTE_PAIR(0x9865, 0x8107)
+DOUBLE_BYTE_PAIR(0x9866, 0x60D1)
+DOUBLE_BYTE_PAIR(0x9867, 0x67A0)
+DOUBLE_BYTE_PAIR(0x9868, 0x9DF2)
+DOUBLE_BYTE_PAIR(0x9869, 0x4E99)
+DOUBLE_BYTE_PAIR(0x986A, 0x4E98)
+DOUBLE_BYTE_PAIR(0x986B, 0x9C10)
+DOUBLE_BYTE_PAIR(0x986C, 0x8A6B)
+DOUBLE_BYTE_PAIR(0x986D, 0x85C1)
+DOUBLE_BYTE_PAIR(0x986E, 0x8568)
+DOUBLE_BYTE_PAIR(0x986F, 0x6900)
+DOUBLE_BYTE_PAIR(0x9870, 0x6E7E)
+DOUBLE_BYTE_PAIR(0x9871, 0x7897)
+DOUBLE_BYTE_PAIR(0x9872, 0x8155)
+DOUBLE_BYTE_PAIR(0x989F, 0x5F0C)
+DOUBLE_BYTE_PAIR(0x98A0, 0x4E10)
+DOUBLE_BYTE_PAIR(0x98A1, 0x4E15)
+DOUBLE_BYTE_PAIR(0x98A2, 0x4E2A)
+DOUBLE_BYTE_PAIR(0x98A3, 0x4E31)
+DOUBLE_BYTE_PAIR(0x98A4, 0x4E36)
+DOUBLE_BYTE_PAIR(0x98A5, 0x4E3C)
+DOUBLE_BYTE_PAIR(0x98A6, 0x4E3F)
+DOUBLE_BYTE_PAIR(0x98A7, 0x4E42)
+DOUBLE_BYTE_PAIR(0x98A8, 0x4E56)
+DOUBLE_BYTE_PAIR(0x98A9, 0x4E58)
+DOUBLE_BYTE_PAIR(0x98AA, 0x4E82)
+DOUBLE_BYTE_PAIR(0x98AB, 0x4E85)
+DOUBLE_BYTE_PAIR(0x98AC, 0x8C6B)
+DOUBLE_BYTE_PAIR(0x98AD, 0x4E8A)
+DOUBLE_BYTE_PAIR(0x98AE, 0x8212)
+DOUBLE_BYTE_PAIR(0x98AF, 0x5F0D)
+DOUBLE_BYTE_PAIR(0x98B0, 0x4E8E)
+DOUBLE_BYTE_PAIR(0x98B1, 0x4E9E)
+DOUBLE_BYTE_PAIR(0x98B2, 0x4E9F)
+DOUBLE_BYTE_PAIR(0x98B3, 0x4EA0)
+DOUBLE_BYTE_PAIR(0x98B4, 0x4EA2)
+DOUBLE_BYTE_PAIR(0x98B5, 0x4EB0)
+DOUBLE_BYTE_PAIR(0x98B6, 0x4EB3)
+DOUBLE_BYTE_PAIR(0x98B7, 0x4EB6)
+DOUBLE_BYTE_PAIR(0x98B8, 0x4ECE)
+DOUBLE_BYTE_PAIR(0x98B9, 0x4ECD)
+DOUBLE_BYTE_PAIR(0x98BA, 0x4EC4)
+DOUBLE_BYTE_PAIR(0x98BB, 0x4EC6)
+DOUBLE_BYTE_PAIR(0x98BC, 0x4EC2)
+DOUBLE_BYTE_PAIR(0x98BD, 0x4ED7)
+DOUBLE_BYTE_PAIR(0x98BE, 0x4EDE)
+DOUBLE_BYTE_PAIR(0x98BF, 0x4EED)
+DOUBLE_BYTE_PAIR(0x98C0, 0x4EDF)
+DOUBLE_BYTE_PAIR(0x98C1, 0x4EF7)
+DOUBLE_BYTE_PAIR(0x98C2, 0x4F09)
+DOUBLE_BYTE_PAIR(0x98C3, 0x4F5A)
+DOUBLE_BYTE_PAIR(0x98C4, 0x4F30)
+DOUBLE_BYTE_PAIR(0x98C5, 0x4F5B)
+DOUBLE_BYTE_PAIR(0x98C6, 0x4F5D)
+DOUBLE_BYTE_PAIR(0x98C7, 0x4F57)
+DOUBLE_BYTE_PAIR(0x98C8, 0x4F47)
+DOUBLE_BYTE_PAIR(0x98C9, 0x4F76)
+DOUBLE_BYTE_PAIR(0x98CA, 0x4F88)
+DOUBLE_BYTE_PAIR(0x98CB, 0x4F8F)
+DOUBLE_BYTE_PAIR(0x98CC, 0x4F98)
+DOUBLE_BYTE_PAIR(0x98CD, 0x4F7B)
+DOUBLE_BYTE_PAIR(0x98CE, 0x4F69)
+DOUBLE_BYTE_PAIR(0x98CF, 0x4F70)
+DOUBLE_BYTE_PAIR(0x98D0, 0x4F91)
+DOUBLE_BYTE_PAIR(0x98D1, 0x4F6F)
+DOUBLE_BYTE_PAIR(0x98D2, 0x4F86)
+DOUBLE_BYTE_PAIR(0x98D3, 0x4F96)
+DOUBLE_BYTE_PAIR(0x98D4, 0x5118)
+DOUBLE_BYTE_PAIR(0x98D5, 0x4FD4)
+DOUBLE_BYTE_PAIR(0x98D6, 0x4FDF)
+DOUBLE_BYTE_PAIR(0x98D7, 0x4FCE)
+DOUBLE_BYTE_PAIR(0x98D8, 0x4FD8)
+DOUBLE_BYTE_PAIR(0x98D9, 0x4FDB)
+DOUBLE_BYTE_PAIR(0x98DA, 0x4FD1)
+DOUBLE_BYTE_PAIR(0x98DB, 0x4FDA)
+DOUBLE_BYTE_PAIR(0x98DC, 0x4FD0)
+DOUBLE_BYTE_PAIR(0x98DD, 0x4FE4)
+DOUBLE_BYTE_PAIR(0x98DE, 0x4FE5)
+DOUBLE_BYTE_PAIR(0x98DF, 0x501A)
+DOUBLE_BYTE_PAIR(0x98E0, 0x5028)
+DOUBLE_BYTE_PAIR(0x98E1, 0x5014)
+DOUBLE_BYTE_PAIR(0x98E2, 0x502A)
+DOUBLE_BYTE_PAIR(0x98E3, 0x5025)
+DOUBLE_BYTE_PAIR(0x98E4, 0x5005)
+DOUBLE_BYTE_PAIR(0x98E5, 0x4F1C)
+DOUBLE_BYTE_PAIR(0x98E6, 0x4FF6)
+DOUBLE_BYTE_PAIR(0x98E7, 0x5021)
+DOUBLE_BYTE_PAIR(0x98E8, 0x5029)
+DOUBLE_BYTE_PAIR(0x98E9, 0x502C)
+DOUBLE_BYTE_PAIR(0x98EA, 0x4FFE)
+DOUBLE_BYTE_PAIR(0x98EB, 0x4FEF)
+DOUBLE_BYTE_PAIR(0x98EC, 0x5011)
+DOUBLE_BYTE_PAIR(0x98ED, 0x5006)
+DOUBLE_BYTE_PAIR(0x98EE, 0x5043)
+DOUBLE_BYTE_PAIR(0x98EF, 0x5047)
+DOUBLE_BYTE_PAIR(0x98F0, 0x6703)
+DOUBLE_BYTE_PAIR(0x98F1, 0x5055)
+DOUBLE_BYTE_PAIR(0x98F2, 0x5050)
+DOUBLE_BYTE_PAIR(0x98F3, 0x5048)
+DOUBLE_BYTE_PAIR(0x98F4, 0x505A)
+DOUBLE_BYTE_PAIR(0x98F5, 0x5056)
+DOUBLE_BYTE_PAIR(0x98F6, 0x506C)
+DOUBLE_BYTE_PAIR(0x98F7, 0x5078)
+DOUBLE_BYTE_PAIR(0x98F8, 0x5080)
+DOUBLE_BYTE_PAIR(0x98F9, 0x509A)
+DOUBLE_BYTE_PAIR(0x98FA, 0x5085)
+DOUBLE_BYTE_PAIR(0x98FB, 0x50B4)
+DOUBLE_BYTE_PAIR(0x98FC, 0x50B2)
+DOUBLE_BYTE_PAIR(0x9940, 0x50C9)
+DOUBLE_BYTE_PAIR(0x9941, 0x50CA)
+DOUBLE_BYTE_PAIR(0x9942, 0x50B3)
+DOUBLE_BYTE_PAIR(0x9943, 0x50C2)
+DOUBLE_BYTE_PAIR(0x9944, 0x50D6)
+DOUBLE_BYTE_PAIR(0x9945, 0x50DE)
+DOUBLE_BYTE_PAIR(0x9946, 0x50E5)
+DOUBLE_BYTE_PAIR(0x9947, 0x50ED)
+DOUBLE_BYTE_PAIR(0x9948, 0x50E3)
+DOUBLE_BYTE_PAIR(0x9949, 0x50EE)
+DOUBLE_BYTE_PAIR(0x994A, 0x50F9)
+DOUBLE_BYTE_PAIR(0x994B, 0x50F5)
+DOUBLE_BYTE_PAIR(0x994C, 0x5109)
+DOUBLE_BYTE_PAIR(0x994D, 0x5101)
+DOUBLE_BYTE_PAIR(0x994E, 0x5102)
+DOUBLE_BYTE_PAIR(0x994F, 0x5116)
+DOUBLE_BYTE_PAIR(0x9950, 0x5115)
+DOUBLE_BYTE_PAIR(0x9951, 0x5114)
+DOUBLE_BYTE_PAIR(0x9952, 0x511A)
+DOUBLE_BYTE_PAIR(0x9953, 0x5121)
+DOUBLE_BYTE_PAIR(0x9954, 0x513A)
+DOUBLE_BYTE_PAIR(0x9955, 0x5137)
+DOUBLE_BYTE_PAIR(0x9956, 0x513C)
+DOUBLE_BYTE_PAIR(0x9957, 0x513B)
+DOUBLE_BYTE_PAIR(0x9958, 0x513F)
+DOUBLE_BYTE_PAIR(0x9959, 0x5140)
+DOUBLE_BYTE_PAIR(0x995A, 0x5152)
+DOUBLE_BYTE_PAIR(0x995B, 0x514C)
+DOUBLE_BYTE_PAIR(0x995C, 0x5154)
+DOUBLE_BYTE_PAIR(0x995D, 0x5162)
+DOUBLE_BYTE_PAIR(0x995E, 0x7AF8)
+DOUBLE_BYTE_PAIR(0x995F, 0x5169)
+DOUBLE_BYTE_PAIR(0x9960, 0x516A)
+DOUBLE_BYTE_PAIR(0x9961, 0x516E)
+DOUBLE_BYTE_PAIR(0x9962, 0x5180)
+DOUBLE_BYTE_PAIR(0x9963, 0x5182)
+DOUBLE_BYTE_PAIR(0x9964, 0x56D8)
+DOUBLE_BYTE_PAIR(0x9965, 0x518C)
+DOUBLE_BYTE_PAIR(0x9966, 0x5189)
+DOUBLE_BYTE_PAIR(0x9967, 0x518F)
+DOUBLE_BYTE_PAIR(0x9968, 0x5191)
+DOUBLE_BYTE_PAIR(0x9969, 0x5193)
+DOUBLE_BYTE_PAIR(0x996A, 0x5195)
+DOUBLE_BYTE_PAIR(0x996B, 0x5196)
+DOUBLE_BYTE_PAIR(0x996C, 0x51A4)
+DOUBLE_BYTE_PAIR(0x996D, 0x51A6)
+DOUBLE_BYTE_PAIR(0x996E, 0x51A2)
+DOUBLE_BYTE_PAIR(0x996F, 0x51A9)
+DOUBLE_BYTE_PAIR(0x9970, 0x51AA)
+DOUBLE_BYTE_PAIR(0x9971, 0x51AB)
+DOUBLE_BYTE_PAIR(0x9972, 0x51B3)
+DOUBLE_BYTE_PAIR(0x9973, 0x51B1)
+DOUBLE_BYTE_PAIR(0x9974, 0x51B2)
+DOUBLE_BYTE_PAIR(0x9975, 0x51B0)
+DOUBLE_BYTE_PAIR(0x9976, 0x51B5)
+DOUBLE_BYTE_PAIR(0x9977, 0x51BD)
+DOUBLE_BYTE_PAIR(0x9978, 0x51C5)
+DOUBLE_BYTE_PAIR(0x9979, 0x51C9)
+DOUBLE_BYTE_PAIR(0x997A, 0x51DB)
+DOUBLE_BYTE_PAIR(0x997B, 0x51E0)
+DOUBLE_BYTE_PAIR(0x997C, 0x8655)
+DOUBLE_BYTE_PAIR(0x997D, 0x51E9)
+DOUBLE_BYTE_PAIR(0x997E, 0x51ED)
+DOUBLE_BYTE_PAIR(0x9980, 0x51F0)
+DOUBLE_BYTE_PAIR(0x9981, 0x51F5)
+DOUBLE_BYTE_PAIR(0x9982, 0x51FE)
+DOUBLE_BYTE_PAIR(0x9983, 0x5204)
+DOUBLE_BYTE_PAIR(0x9984, 0x520B)
+DOUBLE_BYTE_PAIR(0x9985, 0x5214)
+DOUBLE_BYTE_PAIR(0x9986, 0x520E)
+DOUBLE_BYTE_PAIR(0x9987, 0x5227)
+DOUBLE_BYTE_PAIR(0x9988, 0x522A)
+DOUBLE_BYTE_PAIR(0x9989, 0x522E)
+DOUBLE_BYTE_PAIR(0x998A, 0x5233)
+DOUBLE_BYTE_PAIR(0x998B, 0x5239)
+DOUBLE_BYTE_PAIR(0x998C, 0x524F)
+DOUBLE_BYTE_PAIR(0x998D, 0x5244)
+DOUBLE_BYTE_PAIR(0x998E, 0x524B)
+DOUBLE_BYTE_PAIR(0x998F, 0x524C)
+DOUBLE_BYTE_PAIR(0x9990, 0x525E)
+DOUBLE_BYTE_PAIR(0x9991, 0x5254)
+DOUBLE_BYTE_PAIR(0x9992, 0x526A)
+DOUBLE_BYTE_PAIR(0x9993, 0x5274)
+DOUBLE_BYTE_PAIR(0x9994, 0x5269)
+DOUBLE_BYTE_PAIR(0x9995, 0x5273)
+DOUBLE_BYTE_PAIR(0x9996, 0x527F)
+DOUBLE_BYTE_PAIR(0x9997, 0x527D)
+DOUBLE_BYTE_PAIR(0x9998, 0x528D)
+DOUBLE_BYTE_PAIR(0x9999, 0x5294)
+DOUBLE_BYTE_PAIR(0x999A, 0x5292)
+DOUBLE_BYTE_PAIR(0x999B, 0x5271)
+DOUBLE_BYTE_PAIR(0x999C, 0x5288)
+DOUBLE_BYTE_PAIR(0x999D, 0x5291)
+DOUBLE_BYTE_PAIR(0x999E, 0x8FA8)
+DOUBLE_BYTE_PAIR(0x999F, 0x8FA7)
+DOUBLE_BYTE_PAIR(0x99A0, 0x52AC)
+DOUBLE_BYTE_PAIR(0x99A1, 0x52AD)
+DOUBLE_BYTE_PAIR(0x99A2, 0x52BC)
+DOUBLE_BYTE_PAIR(0x99A3, 0x52B5)
+DOUBLE_BYTE_PAIR(0x99A4, 0x52C1)
+DOUBLE_BYTE_PAIR(0x99A5, 0x52CD)
+DOUBLE_BYTE_PAIR(0x99A6, 0x52D7)
+DOUBLE_BYTE_PAIR(0x99A7, 0x52DE)
+DOUBLE_BYTE_PAIR(0x99A8, 0x52E3)
+DOUBLE_BYTE_PAIR(0x99A9, 0x52E6)
+DOUBLE_BYTE_PAIR(0x99AA, 0x98ED)
+DOUBLE_BYTE_PAIR(0x99AB, 0x52E0)
+DOUBLE_BYTE_PAIR(0x99AC, 0x52F3)
+DOUBLE_BYTE_PAIR(0x99AD, 0x52F5)
+DOUBLE_BYTE_PAIR(0x99AE, 0x52F8)
+DOUBLE_BYTE_PAIR(0x99AF, 0x52F9)
+DOUBLE_BYTE_PAIR(0x99B0, 0x5306)
+DOUBLE_BYTE_PAIR(0x99B1, 0x5308)
+DOUBLE_BYTE_PAIR(0x99B2, 0x7538)
+DOUBLE_BYTE_PAIR(0x99B3, 0x530D)
+DOUBLE_BYTE_PAIR(0x99B4, 0x5310)
+DOUBLE_BYTE_PAIR(0x99B5, 0x530F)
+DOUBLE_BYTE_PAIR(0x99B6, 0x5315)
+DOUBLE_BYTE_PAIR(0x99B7, 0x531A)
+DOUBLE_BYTE_PAIR(0x99B8, 0x5323)
+DOUBLE_BYTE_PAIR(0x99B9, 0x532F)
+DOUBLE_BYTE_PAIR(0x99BA, 0x5331)
+DOUBLE_BYTE_PAIR(0x99BB, 0x5333)
+DOUBLE_BYTE_PAIR(0x99BC, 0x5338)
+DOUBLE_BYTE_PAIR(0x99BD, 0x5340)
+DOUBLE_BYTE_PAIR(0x99BE, 0x5346)
+DOUBLE_BYTE_PAIR(0x99BF, 0x5345)
+DOUBLE_BYTE_PAIR(0x99C0, 0x4E17)
+DOUBLE_BYTE_PAIR(0x99C1, 0x5349)
+DOUBLE_BYTE_PAIR(0x99C2, 0x534D)
+DOUBLE_BYTE_PAIR(0x99C3, 0x51D6)
+DOUBLE_BYTE_PAIR(0x99C4, 0x535E)
+DOUBLE_BYTE_PAIR(0x99C5, 0x5369)
+DOUBLE_BYTE_PAIR(0x99C6, 0x536E)
+DOUBLE_BYTE_PAIR(0x99C7, 0x5918)
+DOUBLE_BYTE_PAIR(0x99C8, 0x537B)
+DOUBLE_BYTE_PAIR(0x99C9, 0x5377)
+DOUBLE_BYTE_PAIR(0x99CA, 0x5382)
+DOUBLE_BYTE_PAIR(0x99CB, 0x5396)
+DOUBLE_BYTE_PAIR(0x99CC, 0x53A0)
+DOUBLE_BYTE_PAIR(0x99CD, 0x53A6)
+DOUBLE_BYTE_PAIR(0x99CE, 0x53A5)
+DOUBLE_BYTE_PAIR(0x99CF, 0x53AE)
+DOUBLE_BYTE_PAIR(0x99D0, 0x53B0)
+DOUBLE_BYTE_PAIR(0x99D1, 0x53B6)
+DOUBLE_BYTE_PAIR(0x99D2, 0x53C3)
+DOUBLE_BYTE_PAIR(0x99D3, 0x7C12)
+DOUBLE_BYTE_PAIR(0x99D4, 0x96D9)
+DOUBLE_BYTE_PAIR(0x99D5, 0x53DF)
+DOUBLE_BYTE_PAIR(0x99D6, 0x66FC)
+DOUBLE_BYTE_PAIR(0x99D7, 0x71EE)
+DOUBLE_BYTE_PAIR(0x99D8, 0x53EE)
+DOUBLE_BYTE_PAIR(0x99D9, 0x53E8)
+DOUBLE_BYTE_PAIR(0x99DA, 0x53ED)
+DOUBLE_BYTE_PAIR(0x99DB, 0x53FA)
+DOUBLE_BYTE_PAIR(0x99DC, 0x5401)
+DOUBLE_BYTE_PAIR(0x99DD, 0x543D)
+DOUBLE_BYTE_PAIR(0x99DE, 0x5440)
+DOUBLE_BYTE_PAIR(0x99DF, 0x542C)
+DOUBLE_BYTE_PAIR(0x99E0, 0x542D)
+DOUBLE_BYTE_PAIR(0x99E1, 0x543C)
+DOUBLE_BYTE_PAIR(0x99E2, 0x542E)
+DOUBLE_BYTE_PAIR(0x99E3, 0x5436)
+DOUBLE_BYTE_PAIR(0x99E4, 0x5429)
+DOUBLE_BYTE_PAIR(0x99E5, 0x541D)
+DOUBLE_BYTE_PAIR(0x99E6, 0x544E)
+DOUBLE_BYTE_PAIR(0x99E7, 0x548F)
+DOUBLE_BYTE_PAIR(0x99E8, 0x5475)
+DOUBLE_BYTE_PAIR(0x99E9, 0x548E)
+DOUBLE_BYTE_PAIR(0x99EA, 0x545F)
+DOUBLE_BYTE_PAIR(0x99EB, 0x5471)
+DOUBLE_BYTE_PAIR(0x99EC, 0x5477)
+DOUBLE_BYTE_PAIR(0x99ED, 0x5470)
+DOUBLE_BYTE_PAIR(0x99EE, 0x5492)
+DOUBLE_BYTE_PAIR(0x99EF, 0x547B)
+DOUBLE_BYTE_PAIR(0x99F0, 0x5480)
+DOUBLE_BYTE_PAIR(0x99F1, 0x5476)
+DOUBLE_BYTE_PAIR(0x99F2, 0x5484)
+DOUBLE_BYTE_PAIR(0x99F3, 0x5490)
+DOUBLE_BYTE_PAIR(0x99F4, 0x5486)
+DOUBLE_BYTE_PAIR(0x99F5, 0x54C7)
+DOUBLE_BYTE_PAIR(0x99F6, 0x54A2)
+DOUBLE_BYTE_PAIR(0x99F7, 0x54B8)
+DOUBLE_BYTE_PAIR(0x99F8, 0x54A5)
+DOUBLE_BYTE_PAIR(0x99F9, 0x54AC)
+DOUBLE_BYTE_PAIR(0x99FA, 0x54C4)
+DOUBLE_BYTE_PAIR(0x99FB, 0x54C8)
+DOUBLE_BYTE_PAIR(0x99FC, 0x54A8)
+DOUBLE_BYTE_PAIR(0x9A40, 0x54AB)
+DOUBLE_BYTE_PAIR(0x9A41, 0x54C2)
+DOUBLE_BYTE_PAIR(0x9A42, 0x54A4)
+DOUBLE_BYTE_PAIR(0x9A43, 0x54BE)
+DOUBLE_BYTE_PAIR(0x9A44, 0x54BC)
+DOUBLE_BYTE_PAIR(0x9A45, 0x54D8)
+DOUBLE_BYTE_PAIR(0x9A46, 0x54E5)
+DOUBLE_BYTE_PAIR(0x9A47, 0x54E6)
+DOUBLE_BYTE_PAIR(0x9A48, 0x550F)
+DOUBLE_BYTE_PAIR(0x9A49, 0x5514)
+DOUBLE_BYTE_PAIR(0x9A4A, 0x54FD)
+DOUBLE_BYTE_PAIR(0x9A4B, 0x54EE)
+DOUBLE_BYTE_PAIR(0x9A4C, 0x54ED)
+DOUBLE_BYTE_PAIR(0x9A4D, 0x54FA)
+DOUBLE_BYTE_PAIR(0x9A4E, 0x54E2)
+DOUBLE_BYTE_PAIR(0x9A4F, 0x5539)
+DOUBLE_BYTE_PAIR(0x9A50, 0x5540)
+DOUBLE_BYTE_PAIR(0x9A51, 0x5563)
+DOUBLE_BYTE_PAIR(0x9A52, 0x554C)
+DOUBLE_BYTE_PAIR(0x9A53, 0x552E)
+DOUBLE_BYTE_PAIR(0x9A54, 0x555C)
+DOUBLE_BYTE_PAIR(0x9A55, 0x5545)
+DOUBLE_BYTE_PAIR(0x9A56, 0x5556)
+DOUBLE_BYTE_PAIR(0x9A57, 0x5557)
+DOUBLE_BYTE_PAIR(0x9A58, 0x5538)
+DOUBLE_BYTE_PAIR(0x9A59, 0x5533)
+DOUBLE_BYTE_PAIR(0x9A5A, 0x555D)
+DOUBLE_BYTE_PAIR(0x9A5B, 0x5599)
+DOUBLE_BYTE_PAIR(0x9A5C, 0x5580)
+DOUBLE_BYTE_PAIR(0x9A5D, 0x54AF)
+DOUBLE_BYTE_PAIR(0x9A5E, 0x558A)
+DOUBLE_BYTE_PAIR(0x9A5F, 0x559F)
+DOUBLE_BYTE_PAIR(0x9A60, 0x557B)
+DOUBLE_BYTE_PAIR(0x9A61, 0x557E)
+DOUBLE_BYTE_PAIR(0x9A62, 0x5598)
+DOUBLE_BYTE_PAIR(0x9A63, 0x559E)
+DOUBLE_BYTE_PAIR(0x9A64, 0x55AE)
+DOUBLE_BYTE_PAIR(0x9A65, 0x557C)
+DOUBLE_BYTE_PAIR(0x9A66, 0x5583)
+DOUBLE_BYTE_PAIR(0x9A67, 0x55A9)
+DOUBLE_BYTE_PAIR(0x9A68, 0x5587)
+DOUBLE_BYTE_PAIR(0x9A69, 0x55A8)
+DOUBLE_BYTE_PAIR(0x9A6A, 0x55DA)
+DOUBLE_BYTE_PAIR(0x9A6B, 0x55C5)
+DOUBLE_BYTE_PAIR(0x9A6C, 0x55DF)
+DOUBLE_BYTE_PAIR(0x9A6D, 0x55C4)
+DOUBLE_BYTE_PAIR(0x9A6E, 0x55DC)
+DOUBLE_BYTE_PAIR(0x9A6F, 0x55E4)
+DOUBLE_BYTE_PAIR(0x9A70, 0x55D4)
+DOUBLE_BYTE_PAIR(0x9A71, 0x5614)
+DOUBLE_BYTE_PAIR(0x9A72, 0x55F7)
+DOUBLE_BYTE_PAIR(0x9A73, 0x5616)
+DOUBLE_BYTE_PAIR(0x9A74, 0x55FE)
+DOUBLE_BYTE_PAIR(0x9A75, 0x55FD)
+DOUBLE_BYTE_PAIR(0x9A76, 0x561B)
+DOUBLE_BYTE_PAIR(0x9A77, 0x55F9)
+DOUBLE_BYTE_PAIR(0x9A78, 0x564E)
+DOUBLE_BYTE_PAIR(0x9A79, 0x5650)
+DOUBLE_BYTE_PAIR(0x9A7A, 0x71DF)
+DOUBLE_BYTE_PAIR(0x9A7B, 0x5634)
+DOUBLE_BYTE_PAIR(0x9A7C, 0x5636)
+DOUBLE_BYTE_PAIR(0x9A7D, 0x5632)
+DOUBLE_BYTE_PAIR(0x9A7E, 0x5638)
+DOUBLE_BYTE_PAIR(0x9A80, 0x566B)
+DOUBLE_BYTE_PAIR(0x9A81, 0x5664)
+DOUBLE_BYTE_PAIR(0x9A82, 0x562F)
+DOUBLE_BYTE_PAIR(0x9A83, 0x566C)
+DOUBLE_BYTE_PAIR(0x9A84, 0x566A)
+DOUBLE_BYTE_PAIR(0x9A85, 0x5686)
+DOUBLE_BYTE_PAIR(0x9A86, 0x5680)
+DOUBLE_BYTE_PAIR(0x9A87, 0x568A)
+DOUBLE_BYTE_PAIR(0x9A88, 0x56A0)
+DOUBLE_BYTE_PAIR(0x9A89, 0x5694)
+DOUBLE_BYTE_PAIR(0x9A8A, 0x568F)
+DOUBLE_BYTE_PAIR(0x9A8B, 0x56A5)
+DOUBLE_BYTE_PAIR(0x9A8C, 0x56AE)
+DOUBLE_BYTE_PAIR(0x9A8D, 0x56B6)
+DOUBLE_BYTE_PAIR(0x9A8E, 0x56B4)
+DOUBLE_BYTE_PAIR(0x9A8F, 0x56C2)
+DOUBLE_BYTE_PAIR(0x9A90, 0x56BC)
+DOUBLE_BYTE_PAIR(0x9A91, 0x56C1)
+DOUBLE_BYTE_PAIR(0x9A92, 0x56C3)
+DOUBLE_BYTE_PAIR(0x9A93, 0x56C0)
+DOUBLE_BYTE_PAIR(0x9A94, 0x56C8)
+DOUBLE_BYTE_PAIR(0x9A95, 0x56CE)
+DOUBLE_BYTE_PAIR(0x9A96, 0x56D1)
+DOUBLE_BYTE_PAIR(0x9A97, 0x56D3)
+DOUBLE_BYTE_PAIR(0x9A98, 0x56D7)
+DOUBLE_BYTE_PAIR(0x9A99, 0x56EE)
+DOUBLE_BYTE_PAIR(0x9A9A, 0x56F9)
+DOUBLE_BYTE_PAIR(0x9A9B, 0x5700)
+DOUBLE_BYTE_PAIR(0x9A9C, 0x56FF)
+DOUBLE_BYTE_PAIR(0x9A9D, 0x5704)
+DOUBLE_BYTE_PAIR(0x9A9E, 0x5709)
+DOUBLE_BYTE_PAIR(0x9A9F, 0x5708)
+DOUBLE_BYTE_PAIR(0x9AA0, 0x570B)
+DOUBLE_BYTE_PAIR(0x9AA1, 0x570D)
+DOUBLE_BYTE_PAIR(0x9AA2, 0x5713)
+DOUBLE_BYTE_PAIR(0x9AA3, 0x5718)
+DOUBLE_BYTE_PAIR(0x9AA4, 0x5716)
+DOUBLE_BYTE_PAIR(0x9AA5, 0x55C7)
+DOUBLE_BYTE_PAIR(0x9AA6, 0x571C)
+DOUBLE_BYTE_PAIR(0x9AA7, 0x5726)
+DOUBLE_BYTE_PAIR(0x9AA8, 0x5737)
+DOUBLE_BYTE_PAIR(0x9AA9, 0x5738)
+DOUBLE_BYTE_PAIR(0x9AAA, 0x574E)
+DOUBLE_BYTE_PAIR(0x9AAB, 0x573B)
+DOUBLE_BYTE_PAIR(0x9AAC, 0x5740)
+DOUBLE_BYTE_PAIR(0x9AAD, 0x574F)
+DOUBLE_BYTE_PAIR(0x9AAE, 0x5769)
+DOUBLE_BYTE_PAIR(0x9AAF, 0x57C0)
+DOUBLE_BYTE_PAIR(0x9AB0, 0x5788)
+DOUBLE_BYTE_PAIR(0x9AB1, 0x5761)
+DOUBLE_BYTE_PAIR(0x9AB2, 0x577F)
+DOUBLE_BYTE_PAIR(0x9AB3, 0x5789)
+DOUBLE_BYTE_PAIR(0x9AB4, 0x5793)
+DOUBLE_BYTE_PAIR(0x9AB5, 0x57A0)
+DOUBLE_BYTE_PAIR(0x9AB6, 0x57B3)
+DOUBLE_BYTE_PAIR(0x9AB7, 0x57A4)
+DOUBLE_BYTE_PAIR(0x9AB8, 0x57AA)
+DOUBLE_BYTE_PAIR(0x9AB9, 0x57B0)
+DOUBLE_BYTE_PAIR(0x9ABA, 0x57C3)
+DOUBLE_BYTE_PAIR(0x9ABB, 0x57C6)
+DOUBLE_BYTE_PAIR(0x9ABC, 0x57D4)
+DOUBLE_BYTE_PAIR(0x9ABD, 0x57D2)
+DOUBLE_BYTE_PAIR(0x9ABE, 0x57D3)
+DOUBLE_BYTE_PAIR(0x9ABF, 0x580A)
+DOUBLE_BYTE_PAIR(0x9AC0, 0x57D6)
+DOUBLE_BYTE_PAIR(0x9AC1, 0x57E3)
+DOUBLE_BYTE_PAIR(0x9AC2, 0x580B)
+DOUBLE_BYTE_PAIR(0x9AC3, 0x5819)
+DOUBLE_BYTE_PAIR(0x9AC4, 0x581D)
+DOUBLE_BYTE_PAIR(0x9AC5, 0x5872)
+DOUBLE_BYTE_PAIR(0x9AC6, 0x5821)
+DOUBLE_BYTE_PAIR(0x9AC7, 0x5862)
+DOUBLE_BYTE_PAIR(0x9AC8, 0x584B)
+DOUBLE_BYTE_PAIR(0x9AC9, 0x5870)
+DOUBLE_BYTE_PAIR(0x9ACA, 0x6BC0)
+DOUBLE_BYTE_PAIR(0x9ACB, 0x5852)
+DOUBLE_BYTE_PAIR(0x9ACC, 0x583D)
+DOUBLE_BYTE_PAIR(0x9ACD, 0x5879)
+DOUBLE_BYTE_PAIR(0x9ACE, 0x5885)
+DOUBLE_BYTE_PAIR(0x9ACF, 0x58B9)
+DOUBLE_BYTE_PAIR(0x9AD0, 0x589F)
+DOUBLE_BYTE_PAIR(0x9AD1, 0x58AB)
+DOUBLE_BYTE_PAIR(0x9AD2, 0x58BA)
+DOUBLE_BYTE_PAIR(0x9AD3, 0x58DE)
+DOUBLE_BYTE_PAIR(0x9AD4, 0x58BB)
+DOUBLE_BYTE_PAIR(0x9AD5, 0x58B8)
+DOUBLE_BYTE_PAIR(0x9AD6, 0x58AE)
+DOUBLE_BYTE_PAIR(0x9AD7, 0x58C5)
+DOUBLE_BYTE_PAIR(0x9AD8, 0x58D3)
+DOUBLE_BYTE_PAIR(0x9AD9, 0x58D1)
+DOUBLE_BYTE_PAIR(0x9ADA, 0x58D7)
+DOUBLE_BYTE_PAIR(0x9ADB, 0x58D9)
+DOUBLE_BYTE_PAIR(0x9ADC, 0x58D8)
+DOUBLE_BYTE_PAIR(0x9ADD, 0x58E5)
+DOUBLE_BYTE_PAIR(0x9ADE, 0x58DC)
+DOUBLE_BYTE_PAIR(0x9ADF, 0x58E4)
+DOUBLE_BYTE_PAIR(0x9AE0, 0x58DF)
+DOUBLE_BYTE_PAIR(0x9AE1, 0x58EF)
+DOUBLE_BYTE_PAIR(0x9AE2, 0x58FA)
+DOUBLE_BYTE_PAIR(0x9AE3, 0x58F9)
+DOUBLE_BYTE_PAIR(0x9AE4, 0x58FB)
+DOUBLE_BYTE_PAIR(0x9AE5, 0x58FC)
+DOUBLE_BYTE_PAIR(0x9AE6, 0x58FD)
+DOUBLE_BYTE_PAIR(0x9AE7, 0x5902)
+DOUBLE_BYTE_PAIR(0x9AE8, 0x590A)
+DOUBLE_BYTE_PAIR(0x9AE9, 0x5910)
+DOUBLE_BYTE_PAIR(0x9AEA, 0x591B)
+DOUBLE_BYTE_PAIR(0x9AEB, 0x68A6)
+DOUBLE_BYTE_PAIR(0x9AEC, 0x5925)
+DOUBLE_BYTE_PAIR(0x9AED, 0x592C)
+DOUBLE_BYTE_PAIR(0x9AEE, 0x592D)
+DOUBLE_BYTE_PAIR(0x9AEF, 0x5932)
+DOUBLE_BYTE_PAIR(0x9AF0, 0x5938)
+DOUBLE_BYTE_PAIR(0x9AF1, 0x593E)
+DOUBLE_BYTE_PAIR(0x9AF2, 0x7AD2)
+DOUBLE_BYTE_PAIR(0x9AF3, 0x5955)
+DOUBLE_BYTE_PAIR(0x9AF4, 0x5950)
+DOUBLE_BYTE_PAIR(0x9AF5, 0x594E)
+DOUBLE_BYTE_PAIR(0x9AF6, 0x595A)
+DOUBLE_BYTE_PAIR(0x9AF7, 0x5958)
+DOUBLE_BYTE_PAIR(0x9AF8, 0x5962)
+DOUBLE_BYTE_PAIR(0x9AF9, 0x5960)
+DOUBLE_BYTE_PAIR(0x9AFA, 0x5967)
+DOUBLE_BYTE_PAIR(0x9AFB, 0x596C)
+DOUBLE_BYTE_PAIR(0x9AFC, 0x5969)
+DOUBLE_BYTE_PAIR(0x9B40, 0x5978)
+DOUBLE_BYTE_PAIR(0x9B41, 0x5981)
+DOUBLE_BYTE_PAIR(0x9B42, 0x599D)
+DOUBLE_BYTE_PAIR(0x9B43, 0x4F5E)
+DOUBLE_BYTE_PAIR(0x9B44, 0x4FAB)
+DOUBLE_BYTE_PAIR(0x9B45, 0x59A3)
+DOUBLE_BYTE_PAIR(0x9B46, 0x59B2)
+DOUBLE_BYTE_PAIR(0x9B47, 0x59C6)
+DOUBLE_BYTE_PAIR(0x9B48, 0x59E8)
+DOUBLE_BYTE_PAIR(0x9B49, 0x59DC)
+DOUBLE_BYTE_PAIR(0x9B4A, 0x598D)
+DOUBLE_BYTE_PAIR(0x9B4B, 0x59D9)
+DOUBLE_BYTE_PAIR(0x9B4C, 0x59DA)
+DOUBLE_BYTE_PAIR(0x9B4D, 0x5A25)
+DOUBLE_BYTE_PAIR(0x9B4E, 0x5A1F)
+DOUBLE_BYTE_PAIR(0x9B4F, 0x5A11)
+DOUBLE_BYTE_PAIR(0x9B50, 0x5A1C)
+DOUBLE_BYTE_PAIR(0x9B51, 0x5A09)
+DOUBLE_BYTE_PAIR(0x9B52, 0x5A1A)
+DOUBLE_BYTE_PAIR(0x9B53, 0x5A40)
+DOUBLE_BYTE_PAIR(0x9B54, 0x5A6C)
+DOUBLE_BYTE_PAIR(0x9B55, 0x5A49)
+DOUBLE_BYTE_PAIR(0x9B56, 0x5A35)
+DOUBLE_BYTE_PAIR(0x9B57, 0x5A36)
+DOUBLE_BYTE_PAIR(0x9B58, 0x5A62)
+DOUBLE_BYTE_PAIR(0x9B59, 0x5A6A)
+DOUBLE_BYTE_PAIR(0x9B5A, 0x5A9A)
+DOUBLE_BYTE_PAIR(0x9B5B, 0x5ABC)
+DOUBLE_BYTE_PAIR(0x9B5C, 0x5ABE)
+DOUBLE_BYTE_PAIR(0x9B5D, 0x5ACB)
+DOUBLE_BYTE_PAIR(0x9B5E, 0x5AC2)
+DOUBLE_BYTE_PAIR(0x9B5F, 0x5ABD)
+DOUBLE_BYTE_PAIR(0x9B60, 0x5AE3)
+DOUBLE_BYTE_PAIR(0x9B61, 0x5AD7)
+DOUBLE_BYTE_PAIR(0x9B62, 0x5AE6)
+DOUBLE_BYTE_PAIR(0x9B63, 0x5AE9)
+DOUBLE_BYTE_PAIR(0x9B64, 0x5AD6)
+DOUBLE_BYTE_PAIR(0x9B65, 0x5AFA)
+DOUBLE_BYTE_PAIR(0x9B66, 0x5AFB)
+DOUBLE_BYTE_PAIR(0x9B67, 0x5B0C)
+DOUBLE_BYTE_PAIR(0x9B68, 0x5B0B)
+DOUBLE_BYTE_PAIR(0x9B69, 0x5B16)
+DOUBLE_BYTE_PAIR(0x9B6A, 0x5B32)
+DOUBLE_BYTE_PAIR(0x9B6B, 0x5AD0)
+DOUBLE_BYTE_PAIR(0x9B6C, 0x5B2A)
+DOUBLE_BYTE_PAIR(0x9B6D, 0x5B36)
+DOUBLE_BYTE_PAIR(0x9B6E, 0x5B3E)
+DOUBLE_BYTE_PAIR(0x9B6F, 0x5B43)
+DOUBLE_BYTE_PAIR(0x9B70, 0x5B45)
+DOUBLE_BYTE_PAIR(0x9B71, 0x5B40)
+DOUBLE_BYTE_PAIR(0x9B72, 0x5B51)
+DOUBLE_BYTE_PAIR(0x9B73, 0x5B55)
+DOUBLE_BYTE_PAIR(0x9B74, 0x5B5A)
+DOUBLE_BYTE_PAIR(0x9B75, 0x5B5B)
+DOUBLE_BYTE_PAIR(0x9B76, 0x5B65)
+DOUBLE_BYTE_PAIR(0x9B77, 0x5B69)
+DOUBLE_BYTE_PAIR(0x9B78, 0x5B70)
+DOUBLE_BYTE_PAIR(0x9B79, 0x5B73)
+DOUBLE_BYTE_PAIR(0x9B7A, 0x5B75)
+DOUBLE_BYTE_PAIR(0x9B7B, 0x5B78)
+DOUBLE_BYTE_PAIR(0x9B7C, 0x6588)
+DOUBLE_BYTE_PAIR(0x9B7D, 0x5B7A)
+DOUBLE_BYTE_PAIR(0x9B7E, 0x5B80)
+DOUBLE_BYTE_PAIR(0x9B80, 0x5B83)
+DOUBLE_BYTE_PAIR(0x9B81, 0x5BA6)
+DOUBLE_BYTE_PAIR(0x9B82, 0x5BB8)
+DOUBLE_BYTE_PAIR(0x9B83, 0x5BC3)
+DOUBLE_BYTE_PAIR(0x9B84, 0x5BC7)
+DOUBLE_BYTE_PAIR(0x9B85, 0x5BC9)
+DOUBLE_BYTE_PAIR(0x9B86, 0x5BD4)
+DOUBLE_BYTE_PAIR(0x9B87, 0x5BD0)
+DOUBLE_BYTE_PAIR(0x9B88, 0x5BE4)
+DOUBLE_BYTE_PAIR(0x9B89, 0x5BE6)
+DOUBLE_BYTE_PAIR(0x9B8A, 0x5BE2)
+DOUBLE_BYTE_PAIR(0x9B8B, 0x5BDE)
+DOUBLE_BYTE_PAIR(0x9B8C, 0x5BE5)
+DOUBLE_BYTE_PAIR(0x9B8D, 0x5BEB)
+DOUBLE_BYTE_PAIR(0x9B8E, 0x5BF0)
+DOUBLE_BYTE_PAIR(0x9B8F, 0x5BF6)
+DOUBLE_BYTE_PAIR(0x9B90, 0x5BF3)
+DOUBLE_BYTE_PAIR(0x9B91, 0x5C05)
+DOUBLE_BYTE_PAIR(0x9B92, 0x5C07)
+DOUBLE_BYTE_PAIR(0x9B93, 0x5C08)
+DOUBLE_BYTE_PAIR(0x9B94, 0x5C0D)
+DOUBLE_BYTE_PAIR(0x9B95, 0x5C13)
+DOUBLE_BYTE_PAIR(0x9B96, 0x5C20)
+DOUBLE_BYTE_PAIR(0x9B97, 0x5C22)
+DOUBLE_BYTE_PAIR(0x9B98, 0x5C28)
+DOUBLE_BYTE_PAIR(0x9B99, 0x5C38)
+DOUBLE_BYTE_PAIR(0x9B9A, 0x5C39)
+DOUBLE_BYTE_PAIR(0x9B9B, 0x5C41)
+DOUBLE_BYTE_PAIR(0x9B9C, 0x5C46)
+DOUBLE_BYTE_PAIR(0x9B9D, 0x5C4E)
+DOUBLE_BYTE_PAIR(0x9B9E, 0x5C53)
+DOUBLE_BYTE_PAIR(0x9B9F, 0x5C50)
+DOUBLE_BYTE_PAIR(0x9BA0, 0x5C4F)
+DOUBLE_BYTE_PAIR(0x9BA1, 0x5B71)
+DOUBLE_BYTE_PAIR(0x9BA2, 0x5C6C)
+DOUBLE_BYTE_PAIR(0x9BA3, 0x5C6E)
+DOUBLE_BYTE_PAIR(0x9BA4, 0x4E62)
+DOUBLE_BYTE_PAIR(0x9BA5, 0x5C76)
+DOUBLE_BYTE_PAIR(0x9BA6, 0x5C79)
+DOUBLE_BYTE_PAIR(0x9BA7, 0x5C8C)
+DOUBLE_BYTE_PAIR(0x9BA8, 0x5C91)
+DOUBLE_BYTE_PAIR(0x9BA9, 0x5C94)
+DOUBLE_BYTE_PAIR(0x9BAA, 0x599B)
+DOUBLE_BYTE_PAIR(0x9BAB, 0x5CAB)
+DOUBLE_BYTE_PAIR(0x9BAC, 0x5CBB)
+DOUBLE_BYTE_PAIR(0x9BAD, 0x5CB6)
+DOUBLE_BYTE_PAIR(0x9BAE, 0x5CBC)
+DOUBLE_BYTE_PAIR(0x9BAF, 0x5CB7)
+DOUBLE_BYTE_PAIR(0x9BB0, 0x5CC5)
+DOUBLE_BYTE_PAIR(0x9BB1, 0x5CBE)
+DOUBLE_BYTE_PAIR(0x9BB2, 0x5CC7)
+DOUBLE_BYTE_PAIR(0x9BB3, 0x5CD9)
+DOUBLE_BYTE_PAIR(0x9BB4, 0x5CE9)
+DOUBLE_BYTE_PAIR(0x9BB5, 0x5CFD)
+DOUBLE_BYTE_PAIR(0x9BB6, 0x5CFA)
+DOUBLE_BYTE_PAIR(0x9BB7, 0x5CED)
+DOUBLE_BYTE_PAIR(0x9BB8, 0x5D8C)
+DOUBLE_BYTE_PAIR(0x9BB9, 0x5CEA)
+DOUBLE_BYTE_PAIR(0x9BBA, 0x5D0B)
+DOUBLE_BYTE_PAIR(0x9BBB, 0x5D15)
+DOUBLE_BYTE_PAIR(0x9BBC, 0x5D17)
+DOUBLE_BYTE_PAIR(0x9BBD, 0x5D5C)
+DOUBLE_BYTE_PAIR(0x9BBE, 0x5D1F)
+DOUBLE_BYTE_PAIR(0x9BBF, 0x5D1B)
+DOUBLE_BYTE_PAIR(0x9BC0, 0x5D11)
+DOUBLE_BYTE_PAIR(0x9BC1, 0x5D14)
+DOUBLE_BYTE_PAIR(0x9BC2, 0x5D22)
+DOUBLE_BYTE_PAIR(0x9BC3, 0x5D1A)
+DOUBLE_BYTE_PAIR(0x9BC4, 0x5D19)
+DOUBLE_BYTE_PAIR(0x9BC5, 0x5D18)
+DOUBLE_BYTE_PAIR(0x9BC6, 0x5D4C)
+DOUBLE_BYTE_PAIR(0x9BC7, 0x5D52)
+DOUBLE_BYTE_PAIR(0x9BC8, 0x5D4E)
+DOUBLE_BYTE_PAIR(0x9BC9, 0x5D4B)
+DOUBLE_BYTE_PAIR(0x9BCA, 0x5D6C)
+DOUBLE_BYTE_PAIR(0x9BCB, 0x5D73)
+DOUBLE_BYTE_PAIR(0x9BCC, 0x5D76)
+DOUBLE_BYTE_PAIR(0x9BCD, 0x5D87)
+DOUBLE_BYTE_PAIR(0x9BCE, 0x5D84)
+DOUBLE_BYTE_PAIR(0x9BCF, 0x5D82)
+DOUBLE_BYTE_PAIR(0x9BD0, 0x5DA2)
+DOUBLE_BYTE_PAIR(0x9BD1, 0x5D9D)
+DOUBLE_BYTE_PAIR(0x9BD2, 0x5DAC)
+DOUBLE_BYTE_PAIR(0x9BD3, 0x5DAE)
+DOUBLE_BYTE_PAIR(0x9BD4, 0x5DBD)
+DOUBLE_BYTE_PAIR(0x9BD5, 0x5D90)
+DOUBLE_BYTE_PAIR(0x9BD6, 0x5DB7)
+DOUBLE_BYTE_PAIR(0x9BD7, 0x5DBC)
+DOUBLE_BYTE_PAIR(0x9BD8, 0x5DC9)
+DOUBLE_BYTE_PAIR(0x9BD9, 0x5DCD)
+DOUBLE_BYTE_PAIR(0x9BDA, 0x5DD3)
+DOUBLE_BYTE_PAIR(0x9BDB, 0x5DD2)
+DOUBLE_BYTE_PAIR(0x9BDC, 0x5DD6)
+DOUBLE_BYTE_PAIR(0x9BDD, 0x5DDB)
+DOUBLE_BYTE_PAIR(0x9BDE, 0x5DEB)
+DOUBLE_BYTE_PAIR(0x9BDF, 0x5DF2)
+DOUBLE_BYTE_PAIR(0x9BE0, 0x5DF5)
+DOUBLE_BYTE_PAIR(0x9BE1, 0x5E0B)
+DOUBLE_BYTE_PAIR(0x9BE2, 0x5E1A)
+DOUBLE_BYTE_PAIR(0x9BE3, 0x5E19)
+DOUBLE_BYTE_PAIR(0x9BE4, 0x5E11)
+DOUBLE_BYTE_PAIR(0x9BE5, 0x5E1B)
+DOUBLE_BYTE_PAIR(0x9BE6, 0x5E36)
+DOUBLE_BYTE_PAIR(0x9BE7, 0x5E37)
+DOUBLE_BYTE_PAIR(0x9BE8, 0x5E44)
+DOUBLE_BYTE_PAIR(0x9BE9, 0x5E43)
+DOUBLE_BYTE_PAIR(0x9BEA, 0x5E40)
+DOUBLE_BYTE_PAIR(0x9BEB, 0x5E4E)
+DOUBLE_BYTE_PAIR(0x9BEC, 0x5E57)
+DOUBLE_BYTE_PAIR(0x9BED, 0x5E54)
+DOUBLE_BYTE_PAIR(0x9BEE, 0x5E5F)
+DOUBLE_BYTE_PAIR(0x9BEF, 0x5E62)
+DOUBLE_BYTE_PAIR(0x9BF0, 0x5E64)
+DOUBLE_BYTE_PAIR(0x9BF1, 0x5E47)
+DOUBLE_BYTE_PAIR(0x9BF2, 0x5E75)
+DOUBLE_BYTE_PAIR(0x9BF3, 0x5E76)
+DOUBLE_BYTE_PAIR(0x9BF4, 0x5E7A)
+DOUBLE_BYTE_PAIR(0x9BF5, 0x9EBC)
+DOUBLE_BYTE_PAIR(0x9BF6, 0x5E7F)
+DOUBLE_BYTE_PAIR(0x9BF7, 0x5EA0)
+DOUBLE_BYTE_PAIR(0x9BF8, 0x5EC1)
+DOUBLE_BYTE_PAIR(0x9BF9, 0x5EC2)
+DOUBLE_BYTE_PAIR(0x9BFA, 0x5EC8)
+DOUBLE_BYTE_PAIR(0x9BFB, 0x5ED0)
+DOUBLE_BYTE_PAIR(0x9BFC, 0x5ECF)
+DOUBLE_BYTE_PAIR(0x9C40, 0x5ED6)
+DOUBLE_BYTE_PAIR(0x9C41, 0x5EE3)
+DOUBLE_BYTE_PAIR(0x9C42, 0x5EDD)
+DOUBLE_BYTE_PAIR(0x9C43, 0x5EDA)
+DOUBLE_BYTE_PAIR(0x9C44, 0x5EDB)
+DOUBLE_BYTE_PAIR(0x9C45, 0x5EE2)
+DOUBLE_BYTE_PAIR(0x9C46, 0x5EE1)
+DOUBLE_BYTE_PAIR(0x9C47, 0x5EE8)
+DOUBLE_BYTE_PAIR(0x9C48, 0x5EE9)
+DOUBLE_BYTE_PAIR(0x9C49, 0x5EEC)
+DOUBLE_BYTE_PAIR(0x9C4A, 0x5EF1)
+DOUBLE_BYTE_PAIR(0x9C4B, 0x5EF3)
+DOUBLE_BYTE_PAIR(0x9C4C, 0x5EF0)
+DOUBLE_BYTE_PAIR(0x9C4D, 0x5EF4)
+DOUBLE_BYTE_PAIR(0x9C4E, 0x5EF8)
+DOUBLE_BYTE_PAIR(0x9C4F, 0x5EFE)
+DOUBLE_BYTE_PAIR(0x9C50, 0x5F03)
+DOUBLE_BYTE_PAIR(0x9C51, 0x5F09)
+DOUBLE_BYTE_PAIR(0x9C52, 0x5F5D)
+DOUBLE_BYTE_PAIR(0x9C53, 0x5F5C)
+DOUBLE_BYTE_PAIR(0x9C54, 0x5F0B)
+DOUBLE_BYTE_PAIR(0x9C55, 0x5F11)
+DOUBLE_BYTE_PAIR(0x9C56, 0x5F16)
+DOUBLE_BYTE_PAIR(0x9C57, 0x5F29)
+DOUBLE_BYTE_PAIR(0x9C58, 0x5F2D)
+DOUBLE_BYTE_PAIR(0x9C59, 0x5F38)
+DOUBLE_BYTE_PAIR(0x9C5A, 0x5F41)
+DOUBLE_BYTE_PAIR(0x9C5B, 0x5F48)
+DOUBLE_BYTE_PAIR(0x9C5C, 0x5F4C)
+DOUBLE_BYTE_PAIR(0x9C5D, 0x5F4E)
+DOUBLE_BYTE_PAIR(0x9C5E, 0x5F2F)
+DOUBLE_BYTE_PAIR(0x9C5F, 0x5F51)
+DOUBLE_BYTE_PAIR(0x9C60, 0x5F56)
+DOUBLE_BYTE_PAIR(0x9C61, 0x5F57)
+DOUBLE_BYTE_PAIR(0x9C62, 0x5F59)
+DOUBLE_BYTE_PAIR(0x9C63, 0x5F61)
+DOUBLE_BYTE_PAIR(0x9C64, 0x5F6D)
+DOUBLE_BYTE_PAIR(0x9C65, 0x5F73)
+DOUBLE_BYTE_PAIR(0x9C66, 0x5F77)
+DOUBLE_BYTE_PAIR(0x9C67, 0x5F83)
+DOUBLE_BYTE_PAIR(0x9C68, 0x5F82)
+DOUBLE_BYTE_PAIR(0x9C69, 0x5F7F)
+DOUBLE_BYTE_PAIR(0x9C6A, 0x5F8A)
+DOUBLE_BYTE_PAIR(0x9C6B, 0x5F88)
+DOUBLE_BYTE_PAIR(0x9C6C, 0x5F91)
+DOUBLE_BYTE_PAIR(0x9C6D, 0x5F87)
+DOUBLE_BYTE_PAIR(0x9C6E, 0x5F9E)
+DOUBLE_BYTE_PAIR(0x9C6F, 0x5F99)
+DOUBLE_BYTE_PAIR(0x9C70, 0x5F98)
+DOUBLE_BYTE_PAIR(0x9C71, 0x5FA0)
+DOUBLE_BYTE_PAIR(0x9C72, 0x5FA8)
+DOUBLE_BYTE_PAIR(0x9C73, 0x5FAD)
+DOUBLE_BYTE_PAIR(0x9C74, 0x5FBC)
+DOUBLE_BYTE_PAIR(0x9C75, 0x5FD6)
+DOUBLE_BYTE_PAIR(0x9C76, 0x5FFB)
+DOUBLE_BYTE_PAIR(0x9C77, 0x5FE4)
+DOUBLE_BYTE_PAIR(0x9C78, 0x5FF8)
+DOUBLE_BYTE_PAIR(0x9C79, 0x5FF1)
+DOUBLE_BYTE_PAIR(0x9C7A, 0x5FDD)
+DOUBLE_BYTE_PAIR(0x9C7B, 0x60B3)
+DOUBLE_BYTE_PAIR(0x9C7C, 0x5FFF)
+DOUBLE_BYTE_PAIR(0x9C7D, 0x6021)
+DOUBLE_BYTE_PAIR(0x9C7E, 0x6060)
+DOUBLE_BYTE_PAIR(0x9C80, 0x6019)
+DOUBLE_BYTE_PAIR(0x9C81, 0x6010)
+DOUBLE_BYTE_PAIR(0x9C82, 0x6029)
+DOUBLE_BYTE_PAIR(0x9C83, 0x600E)
+DOUBLE_BYTE_PAIR(0x9C84, 0x6031)
+DOUBLE_BYTE_PAIR(0x9C85, 0x601B)
+DOUBLE_BYTE_PAIR(0x9C86, 0x6015)
+DOUBLE_BYTE_PAIR(0x9C87, 0x602B)
+DOUBLE_BYTE_PAIR(0x9C88, 0x6026)
+DOUBLE_BYTE_PAIR(0x9C89, 0x600F)
+DOUBLE_BYTE_PAIR(0x9C8A, 0x603A)
+DOUBLE_BYTE_PAIR(0x9C8B, 0x605A)
+DOUBLE_BYTE_PAIR(0x9C8C, 0x6041)
+DOUBLE_BYTE_PAIR(0x9C8D, 0x606A)
+DOUBLE_BYTE_PAIR(0x9C8E, 0x6077)
+DOUBLE_BYTE_PAIR(0x9C8F, 0x605F)
+DOUBLE_BYTE_PAIR(0x9C90, 0x604A)
+DOUBLE_BYTE_PAIR(0x9C91, 0x6046)
+DOUBLE_BYTE_PAIR(0x9C92, 0x604D)
+DOUBLE_BYTE_PAIR(0x9C93, 0x6063)
+DOUBLE_BYTE_PAIR(0x9C94, 0x6043)
+DOUBLE_BYTE_PAIR(0x9C95, 0x6064)
+DOUBLE_BYTE_PAIR(0x9C96, 0x6042)
+DOUBLE_BYTE_PAIR(0x9C97, 0x606C)
+DOUBLE_BYTE_PAIR(0x9C98, 0x606B)
+DOUBLE_BYTE_PAIR(0x9C99, 0x6059)
+DOUBLE_BYTE_PAIR(0x9C9A, 0x6081)
+DOUBLE_BYTE_PAIR(0x9C9B, 0x608D)
+DOUBLE_BYTE_PAIR(0x9C9C, 0x60E7)
+DOUBLE_BYTE_PAIR(0x9C9D, 0x6083)
+DOUBLE_BYTE_PAIR(0x9C9E, 0x609A)
+DOUBLE_BYTE_PAIR(0x9C9F, 0x6084)
+DOUBLE_BYTE_PAIR(0x9CA0, 0x609B)
+DOUBLE_BYTE_PAIR(0x9CA1, 0x6096)
+DOUBLE_BYTE_PAIR(0x9CA2, 0x6097)
+DOUBLE_BYTE_PAIR(0x9CA3, 0x6092)
+DOUBLE_BYTE_PAIR(0x9CA4, 0x60A7)
+DOUBLE_BYTE_PAIR(0x9CA5, 0x608B)
+DOUBLE_BYTE_PAIR(0x9CA6, 0x60E1)
+DOUBLE_BYTE_PAIR(0x9CA7, 0x60B8)
+DOUBLE_BYTE_PAIR(0x9CA8, 0x60E0)
+DOUBLE_BYTE_PAIR(0x9CA9, 0x60D3)
+DOUBLE_BYTE_PAIR(0x9CAA, 0x60B4)
+DOUBLE_BYTE_PAIR(0x9CAB, 0x5FF0)
+DOUBLE_BYTE_PAIR(0x9CAC, 0x60BD)
+DOUBLE_BYTE_PAIR(0x9CAD, 0x60C6)
+DOUBLE_BYTE_PAIR(0x9CAE, 0x60B5)
+DOUBLE_BYTE_PAIR(0x9CAF, 0x60D8)
+DOUBLE_BYTE_PAIR(0x9CB0, 0x614D)
+DOUBLE_BYTE_PAIR(0x9CB1, 0x6115)
+DOUBLE_BYTE_PAIR(0x9CB2, 0x6106)
+DOUBLE_BYTE_PAIR(0x9CB3, 0x60F6)
+DOUBLE_BYTE_PAIR(0x9CB4, 0x60F7)
+DOUBLE_BYTE_PAIR(0x9CB5, 0x6100)
+DOUBLE_BYTE_PAIR(0x9CB6, 0x60F4)
+DOUBLE_BYTE_PAIR(0x9CB7, 0x60FA)
+DOUBLE_BYTE_PAIR(0x9CB8, 0x6103)
+DOUBLE_BYTE_PAIR(0x9CB9, 0x6121)
+DOUBLE_BYTE_PAIR(0x9CBA, 0x60FB)
+DOUBLE_BYTE_PAIR(0x9CBB, 0x60F1)
+DOUBLE_BYTE_PAIR(0x9CBC, 0x610D)
+DOUBLE_BYTE_PAIR(0x9CBD, 0x610E)
+DOUBLE_BYTE_PAIR(0x9CBE, 0x6147)
+DOUBLE_BYTE_PAIR(0x9CBF, 0x613E)
+DOUBLE_BYTE_PAIR(0x9CC0, 0x6128)
+DOUBLE_BYTE_PAIR(0x9CC1, 0x6127)
+DOUBLE_BYTE_PAIR(0x9CC2, 0x614A)
+DOUBLE_BYTE_PAIR(0x9CC3, 0x613F)
+DOUBLE_BYTE_PAIR(0x9CC4, 0x613C)
+DOUBLE_BYTE_PAIR(0x9CC5, 0x612C)
+DOUBLE_BYTE_PAIR(0x9CC6, 0x6134)
+DOUBLE_BYTE_PAIR(0x9CC7, 0x613D)
+DOUBLE_BYTE_PAIR(0x9CC8, 0x6142)
+DOUBLE_BYTE_PAIR(0x9CC9, 0x6144)
+DOUBLE_BYTE_PAIR(0x9CCA, 0x6173)
+DOUBLE_BYTE_PAIR(0x9CCB, 0x6177)
+DOUBLE_BYTE_PAIR(0x9CCC, 0x6158)
+DOUBLE_BYTE_PAIR(0x9CCD, 0x6159)
+DOUBLE_BYTE_PAIR(0x9CCE, 0x615A)
+DOUBLE_BYTE_PAIR(0x9CCF, 0x616B)
+DOUBLE_BYTE_PAIR(0x9CD0, 0x6174)
+DOUBLE_BYTE_PAIR(0x9CD1, 0x616F)
+DOUBLE_BYTE_PAIR(0x9CD2, 0x6165)
+DOUBLE_BYTE_PAIR(0x9CD3, 0x6171)
+DOUBLE_BYTE_PAIR(0x9CD4, 0x615F)
+DOUBLE_BYTE_PAIR(0x9CD5, 0x615D)
+DOUBLE_BYTE_PAIR(0x9CD6, 0x6153)
+DOUBLE_BYTE_PAIR(0x9CD7, 0x6175)
+DOUBLE_BYTE_PAIR(0x9CD8, 0x6199)
+DOUBLE_BYTE_PAIR(0x9CD9, 0x6196)
+DOUBLE_BYTE_PAIR(0x9CDA, 0x6187)
+DOUBLE_BYTE_PAIR(0x9CDB, 0x61AC)
+DOUBLE_BYTE_PAIR(0x9CDC, 0x6194)
+DOUBLE_BYTE_PAIR(0x9CDD, 0x619A)
+DOUBLE_BYTE_PAIR(0x9CDE, 0x618A)
+DOUBLE_BYTE_PAIR(0x9CDF, 0x6191)
+DOUBLE_BYTE_PAIR(0x9CE0, 0x61AB)
+DOUBLE_BYTE_PAIR(0x9CE1, 0x61AE)
+DOUBLE_BYTE_PAIR(0x9CE2, 0x61CC)
+DOUBLE_BYTE_PAIR(0x9CE3, 0x61CA)
+DOUBLE_BYTE_PAIR(0x9CE4, 0x61C9)
+DOUBLE_BYTE_PAIR(0x9CE5, 0x61F7)
+DOUBLE_BYTE_PAIR(0x9CE6, 0x61C8)
+DOUBLE_BYTE_PAIR(0x9CE7, 0x61C3)
+DOUBLE_BYTE_PAIR(0x9CE8, 0x61C6)
+DOUBLE_BYTE_PAIR(0x9CE9, 0x61BA)
+DOUBLE_BYTE_PAIR(0x9CEA, 0x61CB)
+DOUBLE_BYTE_PAIR(0x9CEB, 0x7F79)
+DOUBLE_BYTE_PAIR(0x9CEC, 0x61CD)
+DOUBLE_BYTE_PAIR(0x9CED, 0x61E6)
+DOUBLE_BYTE_PAIR(0x9CEE, 0x61E3)
+DOUBLE_BYTE_PAIR(0x9CEF, 0x61F6)
+DOUBLE_BYTE_PAIR(0x9CF0, 0x61FA)
+DOUBLE_BYTE_PAIR(0x9CF1, 0x61F4)
+DOUBLE_BYTE_PAIR(0x9CF2, 0x61FF)
+DOUBLE_BYTE_PAIR(0x9CF3, 0x61FD)
+DOUBLE_BYTE_PAIR(0x9CF4, 0x61FC)
+DOUBLE_BYTE_PAIR(0x9CF5, 0x61FE)
+DOUBLE_BYTE_PAIR(0x9CF6, 0x6200)
+DOUBLE_BYTE_PAIR(0x9CF7, 0x6208)
+DOUBLE_BYTE_PAIR(0x9CF8, 0x6209)
+DOUBLE_BYTE_PAIR(0x9CF9, 0x620D)
+DOUBLE_BYTE_PAIR(0x9CFA, 0x620C)
+DOUBLE_BYTE_PAIR(0x9CFB, 0x6214)
+DOUBLE_BYTE_PAIR(0x9CFC, 0x621B)
+DOUBLE_BYTE_PAIR(0x9D40, 0x621E)
+DOUBLE_BYTE_PAIR(0x9D41, 0x6221)
+DOUBLE_BYTE_PAIR(0x9D42, 0x622A)
+DOUBLE_BYTE_PAIR(0x9D43, 0x622E)
+DOUBLE_BYTE_PAIR(0x9D44, 0x6230)
+DOUBLE_BYTE_PAIR(0x9D45, 0x6232)
+DOUBLE_BYTE_PAIR(0x9D46, 0x6233)
+DOUBLE_BYTE_PAIR(0x9D47, 0x6241)
+DOUBLE_BYTE_PAIR(0x9D48, 0x624E)
+DOUBLE_BYTE_PAIR(0x9D49, 0x625E)
+DOUBLE_BYTE_PAIR(0x9D4A, 0x6263)
+DOUBLE_BYTE_PAIR(0x9D4B, 0x625B)
+DOUBLE_BYTE_PAIR(0x9D4C, 0x6260)
+DOUBLE_BYTE_PAIR(0x9D4D, 0x6268)
+DOUBLE_BYTE_PAIR(0x9D4E, 0x627C)
+DOUBLE_BYTE_PAIR(0x9D4F, 0x6282)
+DOUBLE_BYTE_PAIR(0x9D50, 0x6289)
+DOUBLE_BYTE_PAIR(0x9D51, 0x627E)
+DOUBLE_BYTE_PAIR(0x9D52, 0x6292)
+DOUBLE_BYTE_PAIR(0x9D53, 0x6293)
+DOUBLE_BYTE_PAIR(0x9D54, 0x6296)
+DOUBLE_BYTE_PAIR(0x9D55, 0x62D4)
+DOUBLE_BYTE_PAIR(0x9D56, 0x6283)
+DOUBLE_BYTE_PAIR(0x9D57, 0x6294)
+DOUBLE_BYTE_PAIR(0x9D58, 0x62D7)
+DOUBLE_BYTE_PAIR(0x9D59, 0x62D1)
+DOUBLE_BYTE_PAIR(0x9D5A, 0x62BB)
+DOUBLE_BYTE_PAIR(0x9D5B, 0x62CF)
+DOUBLE_BYTE_PAIR(0x9D5C, 0x62FF)
+DOUBLE_BYTE_PAIR(0x9D5D, 0x62C6)
+DOUBLE_BYTE_PAIR(0x9D5E, 0x64D4)
+DOUBLE_BYTE_PAIR(0x9D5F, 0x62C8)
+DOUBLE_BYTE_PAIR(0x9D60, 0x62DC)
+DOUBLE_BYTE_PAIR(0x9D61, 0x62CC)
+DOUBLE_BYTE_PAIR(0x9D62, 0x62CA)
+DOUBLE_BYTE_PAIR(0x9D63, 0x62C2)
+DOUBLE_BYTE_PAIR(0x9D64, 0x62C7)
+DOUBLE_BYTE_PAIR(0x9D65, 0x629B)
+DOUBLE_BYTE_PAIR(0x9D66, 0x62C9)
+DOUBLE_BYTE_PAIR(0x9D67, 0x630C)
+DOUBLE_BYTE_PAIR(0x9D68, 0x62EE)
+DOUBLE_BYTE_PAIR(0x9D69, 0x62F1)
+DOUBLE_BYTE_PAIR(0x9D6A, 0x6327)
+DOUBLE_BYTE_PAIR(0x9D6B, 0x6302)
+DOUBLE_BYTE_PAIR(0x9D6C, 0x6308)
+DOUBLE_BYTE_PAIR(0x9D6D, 0x62EF)
+DOUBLE_BYTE_PAIR(0x9D6E, 0x62F5)
+DOUBLE_BYTE_PAIR(0x9D6F, 0x6350)
+DOUBLE_BYTE_PAIR(0x9D70, 0x633E)
+DOUBLE_BYTE_PAIR(0x9D71, 0x634D)
+DOUBLE_BYTE_PAIR(0x9D72, 0x641C)
+DOUBLE_BYTE_PAIR(0x9D73, 0x634F)
+DOUBLE_BYTE_PAIR(0x9D74, 0x6396)
+DOUBLE_BYTE_PAIR(0x9D75, 0x638E)
+DOUBLE_BYTE_PAIR(0x9D76, 0x6380)
+DOUBLE_BYTE_PAIR(0x9D77, 0x63AB)
+DOUBLE_BYTE_PAIR(0x9D78, 0x6376)
+DOUBLE_BYTE_PAIR(0x9D79, 0x63A3)
+DOUBLE_BYTE_PAIR(0x9D7A, 0x638F)
+DOUBLE_BYTE_PAIR(0x9D7B, 0x6389)
+DOUBLE_BYTE_PAIR(0x9D7C, 0x639F)
+DOUBLE_BYTE_PAIR(0x9D7D, 0x63B5)
+DOUBLE_BYTE_PAIR(0x9D7E, 0x636B)
+DOUBLE_BYTE_PAIR(0x9D80, 0x6369)
+DOUBLE_BYTE_PAIR(0x9D81, 0x63BE)
+DOUBLE_BYTE_PAIR(0x9D82, 0x63E9)
+DOUBLE_BYTE_PAIR(0x9D83, 0x63C0)
+DOUBLE_BYTE_PAIR(0x9D84, 0x63C6)
+DOUBLE_BYTE_PAIR(0x9D85, 0x63E3)
+DOUBLE_BYTE_PAIR(0x9D86, 0x63C9)
+DOUBLE_BYTE_PAIR(0x9D87, 0x63D2)
+DOUBLE_BYTE_PAIR(0x9D88, 0x63F6)
+DOUBLE_BYTE_PAIR(0x9D89, 0x63C4)
+DOUBLE_BYTE_PAIR(0x9D8A, 0x6416)
+DOUBLE_BYTE_PAIR(0x9D8B, 0x6434)
+DOUBLE_BYTE_PAIR(0x9D8C, 0x6406)
+DOUBLE_BYTE_PAIR(0x9D8D, 0x6413)
+DOUBLE_BYTE_PAIR(0x9D8E, 0x6426)
+DOUBLE_BYTE_PAIR(0x9D8F, 0x6436)
+DOUBLE_BYTE_PAIR(0x9D90, 0x651D)
+DOUBLE_BYTE_PAIR(0x9D91, 0x6417)
+DOUBLE_BYTE_PAIR(0x9D92, 0x6428)
+DOUBLE_BYTE_PAIR(0x9D93, 0x640F)
+DOUBLE_BYTE_PAIR(0x9D94, 0x6467)
+DOUBLE_BYTE_PAIR(0x9D95, 0x646F)
+DOUBLE_BYTE_PAIR(0x9D96, 0x6476)
+DOUBLE_BYTE_PAIR(0x9D97, 0x644E)
+DOUBLE_BYTE_PAIR(0x9D98, 0x652A)
+DOUBLE_BYTE_PAIR(0x9D99, 0x6495)
+DOUBLE_BYTE_PAIR(0x9D9A, 0x6493)
+DOUBLE_BYTE_PAIR(0x9D9B, 0x64A5)
+DOUBLE_BYTE_PAIR(0x9D9C, 0x64A9)
+DOUBLE_BYTE_PAIR(0x9D9D, 0x6488)
+DOUBLE_BYTE_PAIR(0x9D9E, 0x64BC)
+DOUBLE_BYTE_PAIR(0x9D9F, 0x64DA)
+DOUBLE_BYTE_PAIR(0x9DA0, 0x64D2)
+DOUBLE_BYTE_PAIR(0x9DA1, 0x64C5)
+DOUBLE_BYTE_PAIR(0x9DA2, 0x64C7)
+DOUBLE_BYTE_PAIR(0x9DA3, 0x64BB)
+DOUBLE_BYTE_PAIR(0x9DA4, 0x64D8)
+DOUBLE_BYTE_PAIR(0x9DA5, 0x64C2)
+DOUBLE_BYTE_PAIR(0x9DA6, 0x64F1)
+DOUBLE_BYTE_PAIR(0x9DA7, 0x64E7)
+DOUBLE_BYTE_PAIR(0x9DA8, 0x8209)
+DOUBLE_BYTE_PAIR(0x9DA9, 0x64E0)
+DOUBLE_BYTE_PAIR(0x9DAA, 0x64E1)
+DOUBLE_BYTE_PAIR(0x9DAB, 0x62AC)
+DOUBLE_BYTE_PAIR(0x9DAC, 0x64E3)
+DOUBLE_BYTE_PAIR(0x9DAD, 0x64EF)
+DOUBLE_BYTE_PAIR(0x9DAE, 0x652C)
+DOUBLE_BYTE_PAIR(0x9DAF, 0x64F6)
+DOUBLE_BYTE_PAIR(0x9DB0, 0x64F4)
+DOUBLE_BYTE_PAIR(0x9DB1, 0x64F2)
+DOUBLE_BYTE_PAIR(0x9DB2, 0x64FA)
+DOUBLE_BYTE_PAIR(0x9DB3, 0x6500)
+DOUBLE_BYTE_PAIR(0x9DB4, 0x64FD)
+DOUBLE_BYTE_PAIR(0x9DB5, 0x6518)
+DOUBLE_BYTE_PAIR(0x9DB6, 0x651C)
+DOUBLE_BYTE_PAIR(0x9DB7, 0x6505)
+DOUBLE_BYTE_PAIR(0x9DB8, 0x6524)
+DOUBLE_BYTE_PAIR(0x9DB9, 0x6523)
+DOUBLE_BYTE_PAIR(0x9DBA, 0x652B)
+DOUBLE_BYTE_PAIR(0x9DBB, 0x6534)
+DOUBLE_BYTE_PAIR(0x9DBC, 0x6535)
+DOUBLE_BYTE_PAIR(0x9DBD, 0x6537)
+DOUBLE_BYTE_PAIR(0x9DBE, 0x6536)
+DOUBLE_BYTE_PAIR(0x9DBF, 0x6538)
+DOUBLE_BYTE_PAIR(0x9DC0, 0x754B)
+DOUBLE_BYTE_PAIR(0x9DC1, 0x6548)
+DOUBLE_BYTE_PAIR(0x9DC2, 0x6556)
+DOUBLE_BYTE_PAIR(0x9DC3, 0x6555)
+DOUBLE_BYTE_PAIR(0x9DC4, 0x654D)
+DOUBLE_BYTE_PAIR(0x9DC5, 0x6558)
+DOUBLE_BYTE_PAIR(0x9DC6, 0x655E)
+DOUBLE_BYTE_PAIR(0x9DC7, 0x655D)
+DOUBLE_BYTE_PAIR(0x9DC8, 0x6572)
+DOUBLE_BYTE_PAIR(0x9DC9, 0x6578)
+DOUBLE_BYTE_PAIR(0x9DCA, 0x6582)
+DOUBLE_BYTE_PAIR(0x9DCB, 0x6583)
+DOUBLE_BYTE_PAIR(0x9DCC, 0x8B8A)
+DOUBLE_BYTE_PAIR(0x9DCD, 0x659B)
+DOUBLE_BYTE_PAIR(0x9DCE, 0x659F)
+DOUBLE_BYTE_PAIR(0x9DCF, 0x65AB)
+DOUBLE_BYTE_PAIR(0x9DD0, 0x65B7)
+DOUBLE_BYTE_PAIR(0x9DD1, 0x65C3)
+DOUBLE_BYTE_PAIR(0x9DD2, 0x65C6)
+DOUBLE_BYTE_PAIR(0x9DD3, 0x65C1)
+DOUBLE_BYTE_PAIR(0x9DD4, 0x65C4)
+DOUBLE_BYTE_PAIR(0x9DD5, 0x65CC)
+DOUBLE_BYTE_PAIR(0x9DD6, 0x65D2)
+DOUBLE_BYTE_PAIR(0x9DD7, 0x65DB)
+DOUBLE_BYTE_PAIR(0x9DD8, 0x65D9)
+DOUBLE_BYTE_PAIR(0x9DD9, 0x65E0)
+DOUBLE_BYTE_PAIR(0x9DDA, 0x65E1)
+DOUBLE_BYTE_PAIR(0x9DDB, 0x65F1)
+DOUBLE_BYTE_PAIR(0x9DDC, 0x6772)
+DOUBLE_BYTE_PAIR(0x9DDD, 0x660A)
+DOUBLE_BYTE_PAIR(0x9DDE, 0x6603)
+DOUBLE_BYTE_PAIR(0x9DDF, 0x65FB)
+DOUBLE_BYTE_PAIR(0x9DE0, 0x6773)
+DOUBLE_BYTE_PAIR(0x9DE1, 0x6635)
+DOUBLE_BYTE_PAIR(0x9DE2, 0x6636)
+DOUBLE_BYTE_PAIR(0x9DE3, 0x6634)
+DOUBLE_BYTE_PAIR(0x9DE4, 0x661C)
+DOUBLE_BYTE_PAIR(0x9DE5, 0x664F)
+DOUBLE_BYTE_PAIR(0x9DE6, 0x6644)
+DOUBLE_BYTE_PAIR(0x9DE7, 0x6649)
+DOUBLE_BYTE_PAIR(0x9DE8, 0x6641)
+DOUBLE_BYTE_PAIR(0x9DE9, 0x665E)
+DOUBLE_BYTE_PAIR(0x9DEA, 0x665D)
+DOUBLE_BYTE_PAIR(0x9DEB, 0x6664)
+DOUBLE_BYTE_PAIR(0x9DEC, 0x6667)
+DOUBLE_BYTE_PAIR(0x9DED, 0x6668)
+DOUBLE_BYTE_PAIR(0x9DEE, 0x665F)
+DOUBLE_BYTE_PAIR(0x9DEF, 0x6662)
+DOUBLE_BYTE_PAIR(0x9DF0, 0x6670)
+DOUBLE_BYTE_PAIR(0x9DF1, 0x6683)
+DOUBLE_BYTE_PAIR(0x9DF2, 0x6688)
+DOUBLE_BYTE_PAIR(0x9DF3, 0x668E)
+DOUBLE_BYTE_PAIR(0x9DF4, 0x6689)
+DOUBLE_BYTE_PAIR(0x9DF5, 0x6684)
+DOUBLE_BYTE_PAIR(0x9DF6, 0x6698)
+DOUBLE_BYTE_PAIR(0x9DF7, 0x669D)
+DOUBLE_BYTE_PAIR(0x9DF8, 0x66C1)
+DOUBLE_BYTE_PAIR(0x9DF9, 0x66B9)
+DOUBLE_BYTE_PAIR(0x9DFA, 0x66C9)
+DOUBLE_BYTE_PAIR(0x9DFB, 0x66BE)
+DOUBLE_BYTE_PAIR(0x9DFC, 0x66BC)
+DOUBLE_BYTE_PAIR(0x9E40, 0x66C4)
+DOUBLE_BYTE_PAIR(0x9E41, 0x66B8)
+DOUBLE_BYTE_PAIR(0x9E42, 0x66D6)
+DOUBLE_BYTE_PAIR(0x9E43, 0x66DA)
+DOUBLE_BYTE_PAIR(0x9E44, 0x66E0)
+DOUBLE_BYTE_PAIR(0x9E45, 0x663F)
+DOUBLE_BYTE_PAIR(0x9E46, 0x66E6)
+DOUBLE_BYTE_PAIR(0x9E47, 0x66E9)
+DOUBLE_BYTE_PAIR(0x9E48, 0x66F0)
+DOUBLE_BYTE_PAIR(0x9E49, 0x66F5)
+DOUBLE_BYTE_PAIR(0x9E4A, 0x66F7)
+DOUBLE_BYTE_PAIR(0x9E4B, 0x670F)
+DOUBLE_BYTE_PAIR(0x9E4C, 0x6716)
+DOUBLE_BYTE_PAIR(0x9E4D, 0x671E)
+DOUBLE_BYTE_PAIR(0x9E4E, 0x6726)
+DOUBLE_BYTE_PAIR(0x9E4F, 0x6727)
+DOUBLE_BYTE_PAIR(0x9E50, 0x9738)
+DOUBLE_BYTE_PAIR(0x9E51, 0x672E)
+DOUBLE_BYTE_PAIR(0x9E52, 0x673F)
+DOUBLE_BYTE_PAIR(0x9E53, 0x6736)
+DOUBLE_BYTE_PAIR(0x9E54, 0x6741)
+DOUBLE_BYTE_PAIR(0x9E55, 0x6738)
+DOUBLE_BYTE_PAIR(0x9E56, 0x6737)
+DOUBLE_BYTE_PAIR(0x9E57, 0x6746)
+DOUBLE_BYTE_PAIR(0x9E58, 0x675E)
+DOUBLE_BYTE_PAIR(0x9E59, 0x6760)
+DOUBLE_BYTE_PAIR(0x9E5A, 0x6759)
+DOUBLE_BYTE_PAIR(0x9E5B, 0x6763)
+DOUBLE_BYTE_PAIR(0x9E5C, 0x6764)
+DOUBLE_BYTE_PAIR(0x9E5D, 0x6789)
+DOUBLE_BYTE_PAIR(0x9E5E, 0x6770)
+DOUBLE_BYTE_PAIR(0x9E5F, 0x67A9)
+DOUBLE_BYTE_PAIR(0x9E60, 0x677C)
+DOUBLE_BYTE_PAIR(0x9E61, 0x676A)
+DOUBLE_BYTE_PAIR(0x9E62, 0x678C)
+DOUBLE_BYTE_PAIR(0x9E63, 0x678B)
+DOUBLE_BYTE_PAIR(0x9E64, 0x67A6)
+DOUBLE_BYTE_PAIR(0x9E65, 0x67A1)
+DOUBLE_BYTE_PAIR(0x9E66, 0x6785)
+DOUBLE_BYTE_PAIR(0x9E67, 0x67B7)
+DOUBLE_BYTE_PAIR(0x9E68, 0x67EF)
+DOUBLE_BYTE_PAIR(0x9E69, 0x67B4)
+DOUBLE_BYTE_PAIR(0x9E6A, 0x67EC)
+DOUBLE_BYTE_PAIR(0x9E6B, 0x67B3)
+DOUBLE_BYTE_PAIR(0x9E6C, 0x67E9)
+DOUBLE_BYTE_PAIR(0x9E6D, 0x67B8)
+DOUBLE_BYTE_PAIR(0x9E6E, 0x67E4)
+DOUBLE_BYTE_PAIR(0x9E6F, 0x67DE)
+DOUBLE_BYTE_PAIR(0x9E70, 0x67DD)
+DOUBLE_BYTE_PAIR(0x9E71, 0x67E2)
+DOUBLE_BYTE_PAIR(0x9E72, 0x67EE)
+DOUBLE_BYTE_PAIR(0x9E73, 0x67B9)
+DOUBLE_BYTE_PAIR(0x9E74, 0x67CE)
+DOUBLE_BYTE_PAIR(0x9E75, 0x67C6)
+DOUBLE_BYTE_PAIR(0x9E76, 0x67E7)
+DOUBLE_BYTE_PAIR(0x9E77, 0x6A9C)
+DOUBLE_BYTE_PAIR(0x9E78, 0x681E)
+DOUBLE_BYTE_PAIR(0x9E79, 0x6846)
+DOUBLE_BYTE_PAIR(0x9E7A, 0x6829)
+DOUBLE_BYTE_PAIR(0x9E7B, 0x6840)
+DOUBLE_BYTE_PAIR(0x9E7C, 0x684D)
+DOUBLE_BYTE_PAIR(0x9E7D, 0x6832)
+DOUBLE_BYTE_PAIR(0x9E7E, 0x684E)
+DOUBLE_BYTE_PAIR(0x9E80, 0x68B3)
+DOUBLE_BYTE_PAIR(0x9E81, 0x682B)
+DOUBLE_BYTE_PAIR(0x9E82, 0x6859)
+DOUBLE_BYTE_PAIR(0x9E83, 0x6863)
+DOUBLE_BYTE_PAIR(0x9E84, 0x6877)
+DOUBLE_BYTE_PAIR(0x9E85, 0x687F)
+DOUBLE_BYTE_PAIR(0x9E86, 0x689F)
+DOUBLE_BYTE_PAIR(0x9E87, 0x688F)
+DOUBLE_BYTE_PAIR(0x9E88, 0x68AD)
+DOUBLE_BYTE_PAIR(0x9E89, 0x6894)
+DOUBLE_BYTE_PAIR(0x9E8A, 0x689D)
+DOUBLE_BYTE_PAIR(0x9E8B, 0x689B)
+DOUBLE_BYTE_PAIR(0x9E8C, 0x6883)
+DOUBLE_BYTE_PAIR(0x9E8D, 0x6AAE)
+DOUBLE_BYTE_PAIR(0x9E8E, 0x68B9)
+DOUBLE_BYTE_PAIR(0x9E8F, 0x6874)
+DOUBLE_BYTE_PAIR(0x9E90, 0x68B5)
+DOUBLE_BYTE_PAIR(0x9E91, 0x68A0)
+DOUBLE_BYTE_PAIR(0x9E92, 0x68BA)
+DOUBLE_BYTE_PAIR(0x9E93, 0x690F)
+DOUBLE_BYTE_PAIR(0x9E94, 0x688D)
+DOUBLE_BYTE_PAIR(0x9E95, 0x687E)
+DOUBLE_BYTE_PAIR(0x9E96, 0x6901)
+DOUBLE_BYTE_PAIR(0x9E97, 0x68CA)
+DOUBLE_BYTE_PAIR(0x9E98, 0x6908)
+DOUBLE_BYTE_PAIR(0x9E99, 0x68D8)
+DOUBLE_BYTE_PAIR(0x9E9A, 0x6922)
+DOUBLE_BYTE_PAIR(0x9E9B, 0x6926)
+DOUBLE_BYTE_PAIR(0x9E9C, 0x68E1)
+DOUBLE_BYTE_PAIR(0x9E9D, 0x690C)
+DOUBLE_BYTE_PAIR(0x9E9E, 0x68CD)
+DOUBLE_BYTE_PAIR(0x9E9F, 0x68D4)
+DOUBLE_BYTE_PAIR(0x9EA0, 0x68E7)
+DOUBLE_BYTE_PAIR(0x9EA1, 0x68D5)
+DOUBLE_BYTE_PAIR(0x9EA2, 0x6936)
+DOUBLE_BYTE_PAIR(0x9EA3, 0x6912)
+DOUBLE_BYTE_PAIR(0x9EA4, 0x6904)
+DOUBLE_BYTE_PAIR(0x9EA5, 0x68D7)
+DOUBLE_BYTE_PAIR(0x9EA6, 0x68E3)
+DOUBLE_BYTE_PAIR(0x9EA7, 0x6925)
+DOUBLE_BYTE_PAIR(0x9EA8, 0x68F9)
+DOUBLE_BYTE_PAIR(0x9EA9, 0x68E0)
+DOUBLE_BYTE_PAIR(0x9EAA, 0x68EF)
+DOUBLE_BYTE_PAIR(0x9EAB, 0x6928)
+DOUBLE_BYTE_PAIR(0x9EAC, 0x692A)
+DOUBLE_BYTE_PAIR(0x9EAD, 0x691A)
+DOUBLE_BYTE_PAIR(0x9EAE, 0x6923)
+DOUBLE_BYTE_PAIR(0x9EAF, 0x6921)
+DOUBLE_BYTE_PAIR(0x9EB0, 0x68C6)
+DOUBLE_BYTE_PAIR(0x9EB1, 0x6979)
+DOUBLE_BYTE_PAIR(0x9EB2, 0x6977)
+DOUBLE_BYTE_PAIR(0x9EB3, 0x695C)
+DOUBLE_BYTE_PAIR(0x9EB4, 0x6978)
+DOUBLE_BYTE_PAIR(0x9EB5, 0x696B)
+DOUBLE_BYTE_PAIR(0x9EB6, 0x6954)
+DOUBLE_BYTE_PAIR(0x9EB7, 0x697E)
+DOUBLE_BYTE_PAIR(0x9EB8, 0x696E)
+DOUBLE_BYTE_PAIR(0x9EB9, 0x6939)
+DOUBLE_BYTE_PAIR(0x9EBA, 0x6974)
+DOUBLE_BYTE_PAIR(0x9EBB, 0x693D)
+DOUBLE_BYTE_PAIR(0x9EBC, 0x6959)
+DOUBLE_BYTE_PAIR(0x9EBD, 0x6930)
+DOUBLE_BYTE_PAIR(0x9EBE, 0x6961)
+DOUBLE_BYTE_PAIR(0x9EBF, 0x695E)
+DOUBLE_BYTE_PAIR(0x9EC0, 0x695D)
+DOUBLE_BYTE_PAIR(0x9EC1, 0x6981)
+DOUBLE_BYTE_PAIR(0x9EC2, 0x696A)
+DOUBLE_BYTE_PAIR(0x9EC3, 0x69B2)
+DOUBLE_BYTE_PAIR(0x9EC4, 0x69AE)
+DOUBLE_BYTE_PAIR(0x9EC5, 0x69D0)
+DOUBLE_BYTE_PAIR(0x9EC6, 0x69BF)
+DOUBLE_BYTE_PAIR(0x9EC7, 0x69C1)
+DOUBLE_BYTE_PAIR(0x9EC8, 0x69D3)
+DOUBLE_BYTE_PAIR(0x9EC9, 0x69BE)
+DOUBLE_BYTE_PAIR(0x9ECA, 0x69CE)
+DOUBLE_BYTE_PAIR(0x9ECB, 0x5BE8)
+DOUBLE_BYTE_PAIR(0x9ECC, 0x69CA)
+DOUBLE_BYTE_PAIR(0x9ECD, 0x69DD)
+DOUBLE_BYTE_PAIR(0x9ECE, 0x69BB)
+DOUBLE_BYTE_PAIR(0x9ECF, 0x69C3)
+DOUBLE_BYTE_PAIR(0x9ED0, 0x69A7)
+DOUBLE_BYTE_PAIR(0x9ED1, 0x6A2E)
+DOUBLE_BYTE_PAIR(0x9ED2, 0x6991)
+DOUBLE_BYTE_PAIR(0x9ED3, 0x69A0)
+DOUBLE_BYTE_PAIR(0x9ED4, 0x699C)
+DOUBLE_BYTE_PAIR(0x9ED5, 0x6995)
+DOUBLE_BYTE_PAIR(0x9ED6, 0x69B4)
+DOUBLE_BYTE_PAIR(0x9ED7, 0x69DE)
+DOUBLE_BYTE_PAIR(0x9ED8, 0x69E8)
+DOUBLE_BYTE_PAIR(0x9ED9, 0x6A02)
+DOUBLE_BYTE_PAIR(0x9EDA, 0x6A1B)
+DOUBLE_BYTE_PAIR(0x9EDB, 0x69FF)
+DOUBLE_BYTE_PAIR(0x9EDC, 0x6B0A)
+DOUBLE_BYTE_PAIR(0x9EDD, 0x69F9)
+DOUBLE_BYTE_PAIR(0x9EDE, 0x69F2)
+DOUBLE_BYTE_PAIR(0x9EDF, 0x69E7)
+DOUBLE_BYTE_PAIR(0x9EE0, 0x6A05)
+DOUBLE_BYTE_PAIR(0x9EE1, 0x69B1)
+DOUBLE_BYTE_PAIR(0x9EE2, 0x6A1E)
+DOUBLE_BYTE_PAIR(0x9EE3, 0x69ED)
+DOUBLE_BYTE_PAIR(0x9EE4, 0x6A14)
+DOUBLE_BYTE_PAIR(0x9EE5, 0x69EB)
+DOUBLE_BYTE_PAIR(0x9EE6, 0x6A0A)
+DOUBLE_BYTE_PAIR(0x9EE7, 0x6A12)
+DOUBLE_BYTE_PAIR(0x9EE8, 0x6AC1)
+DOUBLE_BYTE_PAIR(0x9EE9, 0x6A23)
+DOUBLE_BYTE_PAIR(0x9EEA, 0x6A13)
+DOUBLE_BYTE_PAIR(0x9EEB, 0x6A44)
+DOUBLE_BYTE_PAIR(0x9EEC, 0x6A0C)
+DOUBLE_BYTE_PAIR(0x9EED, 0x6A72)
+DOUBLE_BYTE_PAIR(0x9EEE, 0x6A36)
+DOUBLE_BYTE_PAIR(0x9EEF, 0x6A78)
+DOUBLE_BYTE_PAIR(0x9EF0, 0x6A47)
+DOUBLE_BYTE_PAIR(0x9EF1, 0x6A62)
+DOUBLE_BYTE_PAIR(0x9EF2, 0x6A59)
+DOUBLE_BYTE_PAIR(0x9EF3, 0x6A66)
+DOUBLE_BYTE_PAIR(0x9EF4, 0x6A48)
+DOUBLE_BYTE_PAIR(0x9EF5, 0x6A38)
+DOUBLE_BYTE_PAIR(0x9EF6, 0x6A22)
+DOUBLE_BYTE_PAIR(0x9EF7, 0x6A90)
+DOUBLE_BYTE_PAIR(0x9EF8, 0x6A8D)
+DOUBLE_BYTE_PAIR(0x9EF9, 0x6AA0)
+DOUBLE_BYTE_PAIR(0x9EFA, 0x6A84)
+DOUBLE_BYTE_PAIR(0x9EFB, 0x6AA2)
+DOUBLE_BYTE_PAIR(0x9EFC, 0x6AA3)
+DOUBLE_BYTE_PAIR(0x9F40, 0x6A97)
+DOUBLE_BYTE_PAIR(0x9F41, 0x8617)
+DOUBLE_BYTE_PAIR(0x9F42, 0x6ABB)
+DOUBLE_BYTE_PAIR(0x9F43, 0x6AC3)
+DOUBLE_BYTE_PAIR(0x9F44, 0x6AC2)
+DOUBLE_BYTE_PAIR(0x9F45, 0x6AB8)
+DOUBLE_BYTE_PAIR(0x9F46, 0x6AB3)
+DOUBLE_BYTE_PAIR(0x9F47, 0x6AAC)
+DOUBLE_BYTE_PAIR(0x9F48, 0x6ADE)
+DOUBLE_BYTE_PAIR(0x9F49, 0x6AD1)
+DOUBLE_BYTE_PAIR(0x9F4A, 0x6ADF)
+DOUBLE_BYTE_PAIR(0x9F4B, 0x6AAA)
+DOUBLE_BYTE_PAIR(0x9F4C, 0x6ADA)
+DOUBLE_BYTE_PAIR(0x9F4D, 0x6AEA)
+DOUBLE_BYTE_PAIR(0x9F4E, 0x6AFB)
+DOUBLE_BYTE_PAIR(0x9F4F, 0x6B05)
+DOUBLE_BYTE_PAIR(0x9F50, 0x8616)
+DOUBLE_BYTE_PAIR(0x9F51, 0x6AFA)
+DOUBLE_BYTE_PAIR(0x9F52, 0x6B12)
+DOUBLE_BYTE_PAIR(0x9F53, 0x6B16)
+DOUBLE_BYTE_PAIR(0x9F54, 0x9B31)
+DOUBLE_BYTE_PAIR(0x9F55, 0x6B1F)
+DOUBLE_BYTE_PAIR(0x9F56, 0x6B38)
+DOUBLE_BYTE_PAIR(0x9F57, 0x6B37)
+DOUBLE_BYTE_PAIR(0x9F58, 0x76DC)
+DOUBLE_BYTE_PAIR(0x9F59, 0x6B39)
+DOUBLE_BYTE_PAIR(0x9F5A, 0x98EE)
+DOUBLE_BYTE_PAIR(0x9F5B, 0x6B47)
+DOUBLE_BYTE_PAIR(0x9F5C, 0x6B43)
+DOUBLE_BYTE_PAIR(0x9F5D, 0x6B49)
+DOUBLE_BYTE_PAIR(0x9F5E, 0x6B50)
+DOUBLE_BYTE_PAIR(0x9F5F, 0x6B59)
+DOUBLE_BYTE_PAIR(0x9F60, 0x6B54)
+DOUBLE_BYTE_PAIR(0x9F61, 0x6B5B)
+DOUBLE_BYTE_PAIR(0x9F62, 0x6B5F)
+DOUBLE_BYTE_PAIR(0x9F63, 0x6B61)
+DOUBLE_BYTE_PAIR(0x9F64, 0x6B78)
+DOUBLE_BYTE_PAIR(0x9F65, 0x6B79)
+DOUBLE_BYTE_PAIR(0x9F66, 0x6B7F)
+DOUBLE_BYTE_PAIR(0x9F67, 0x6B80)
+DOUBLE_BYTE_PAIR(0x9F68, 0x6B84)
+DOUBLE_BYTE_PAIR(0x9F69, 0x6B83)
+DOUBLE_BYTE_PAIR(0x9F6A, 0x6B8D)
+DOUBLE_BYTE_PAIR(0x9F6B, 0x6B98)
+DOUBLE_BYTE_PAIR(0x9F6C, 0x6B95)
+DOUBLE_BYTE_PAIR(0x9F6D, 0x6B9E)
+DOUBLE_BYTE_PAIR(0x9F6E, 0x6BA4)
+DOUBLE_BYTE_PAIR(0x9F6F, 0x6BAA)
+DOUBLE_BYTE_PAIR(0x9F70, 0x6BAB)
+DOUBLE_BYTE_PAIR(0x9F71, 0x6BAF)
+DOUBLE_BYTE_PAIR(0x9F72, 0x6BB2)
+DOUBLE_BYTE_PAIR(0x9F73, 0x6BB1)
+DOUBLE_BYTE_PAIR(0x9F74, 0x6BB3)
+DOUBLE_BYTE_PAIR(0x9F75, 0x6BB7)
+DOUBLE_BYTE_PAIR(0x9F76, 0x6BBC)
+DOUBLE_BYTE_PAIR(0x9F77, 0x6BC6)
+DOUBLE_BYTE_PAIR(0x9F78, 0x6BCB)
+DOUBLE_BYTE_PAIR(0x9F79, 0x6BD3)
+DOUBLE_BYTE_PAIR(0x9F7A, 0x6BDF)
+DOUBLE_BYTE_PAIR(0x9F7B, 0x6BEC)
+DOUBLE_BYTE_PAIR(0x9F7C, 0x6BEB)
+DOUBLE_BYTE_PAIR(0x9F7D, 0x6BF3)
+DOUBLE_BYTE_PAIR(0x9F7E, 0x6BEF)
+DOUBLE_BYTE_PAIR(0x9F80, 0x9EBE)
+DOUBLE_BYTE_PAIR(0x9F81, 0x6C08)
+DOUBLE_BYTE_PAIR(0x9F82, 0x6C13)
+DOUBLE_BYTE_PAIR(0x9F83, 0x6C14)
+DOUBLE_BYTE_PAIR(0x9F84, 0x6C1B)
+DOUBLE_BYTE_PAIR(0x9F85, 0x6C24)
+DOUBLE_BYTE_PAIR(0x9F86, 0x6C23)
+DOUBLE_BYTE_PAIR(0x9F87, 0x6C5E)
+DOUBLE_BYTE_PAIR(0x9F88, 0x6C55)
+DOUBLE_BYTE_PAIR(0x9F89, 0x6C62)
+DOUBLE_BYTE_PAIR(0x9F8A, 0x6C6A)
+DOUBLE_BYTE_PAIR(0x9F8B, 0x6C82)
+DOUBLE_BYTE_PAIR(0x9F8C, 0x6C8D)
+DOUBLE_BYTE_PAIR(0x9F8D, 0x6C9A)
+DOUBLE_BYTE_PAIR(0x9F8E, 0x6C81)
+DOUBLE_BYTE_PAIR(0x9F8F, 0x6C9B)
+DOUBLE_BYTE_PAIR(0x9F90, 0x6C7E)
+DOUBLE_BYTE_PAIR(0x9F91, 0x6C68)
+DOUBLE_BYTE_PAIR(0x9F92, 0x6C73)
+DOUBLE_BYTE_PAIR(0x9F93, 0x6C92)
+DOUBLE_BYTE_PAIR(0x9F94, 0x6C90)
+DOUBLE_BYTE_PAIR(0x9F95, 0x6CC4)
+DOUBLE_BYTE_PAIR(0x9F96, 0x6CF1)
+DOUBLE_BYTE_PAIR(0x9F97, 0x6CD3)
+DOUBLE_BYTE_PAIR(0x9F98, 0x6CBD)
+DOUBLE_BYTE_PAIR(0x9F99, 0x6CD7)
+DOUBLE_BYTE_PAIR(0x9F9A, 0x6CC5)
+DOUBLE_BYTE_PAIR(0x9F9B, 0x6CDD)
+DOUBLE_BYTE_PAIR(0x9F9C, 0x6CAE)
+DOUBLE_BYTE_PAIR(0x9F9D, 0x6CB1)
+DOUBLE_BYTE_PAIR(0x9F9E, 0x6CBE)
+DOUBLE_BYTE_PAIR(0x9F9F, 0x6CBA)
+DOUBLE_BYTE_PAIR(0x9FA0, 0x6CDB)
+DOUBLE_BYTE_PAIR(0x9FA1, 0x6CEF)
+DOUBLE_BYTE_PAIR(0x9FA2, 0x6CD9)
+DOUBLE_BYTE_PAIR(0x9FA3, 0x6CEA)
+DOUBLE_BYTE_PAIR(0x9FA4, 0x6D1F)
+DOUBLE_BYTE_PAIR(0x9FA5, 0x884D)
+DOUBLE_BYTE_PAIR(0x9FA6, 0x6D36)
+DOUBLE_BYTE_PAIR(0x9FA7, 0x6D2B)
+DOUBLE_BYTE_PAIR(0x9FA8, 0x6D3D)
+DOUBLE_BYTE_PAIR(0x9FA9, 0x6D38)
+DOUBLE_BYTE_PAIR(0x9FAA, 0x6D19)
+DOUBLE_BYTE_PAIR(0x9FAB, 0x6D35)
+DOUBLE_BYTE_PAIR(0x9FAC, 0x6D33)
+DOUBLE_BYTE_PAIR(0x9FAD, 0x6D12)
+DOUBLE_BYTE_PAIR(0x9FAE, 0x6D0C)
+DOUBLE_BYTE_PAIR(0x9FAF, 0x6D63)
+DOUBLE_BYTE_PAIR(0x9FB0, 0x6D93)
+DOUBLE_BYTE_PAIR(0x9FB1, 0x6D64)
+DOUBLE_BYTE_PAIR(0x9FB2, 0x6D5A)
+DOUBLE_BYTE_PAIR(0x9FB3, 0x6D79)
+DOUBLE_BYTE_PAIR(0x9FB4, 0x6D59)
+DOUBLE_BYTE_PAIR(0x9FB5, 0x6D8E)
+DOUBLE_BYTE_PAIR(0x9FB6, 0x6D95)
+DOUBLE_BYTE_PAIR(0x9FB7, 0x6FE4)
+DOUBLE_BYTE_PAIR(0x9FB8, 0x6D85)
+DOUBLE_BYTE_PAIR(0x9FB9, 0x6DF9)
+DOUBLE_BYTE_PAIR(0x9FBA, 0x6E15)
+DOUBLE_BYTE_PAIR(0x9FBB, 0x6E0A)
+DOUBLE_BYTE_PAIR(0x9FBC, 0x6DB5)
+DOUBLE_BYTE_PAIR(0x9FBD, 0x6DC7)
+DOUBLE_BYTE_PAIR(0x9FBE, 0x6DE6)
+DOUBLE_BYTE_PAIR(0x9FBF, 0x6DB8)
+DOUBLE_BYTE_PAIR(0x9FC0, 0x6DC6)
+DOUBLE_BYTE_PAIR(0x9FC1, 0x6DEC)
+DOUBLE_BYTE_PAIR(0x9FC2, 0x6DDE)
+DOUBLE_BYTE_PAIR(0x9FC3, 0x6DCC)
+DOUBLE_BYTE_PAIR(0x9FC4, 0x6DE8)
+DOUBLE_BYTE_PAIR(0x9FC5, 0x6DD2)
+DOUBLE_BYTE_PAIR(0x9FC6, 0x6DC5)
+DOUBLE_BYTE_PAIR(0x9FC7, 0x6DFA)
+DOUBLE_BYTE_PAIR(0x9FC8, 0x6DD9)
+DOUBLE_BYTE_PAIR(0x9FC9, 0x6DE4)
+DOUBLE_BYTE_PAIR(0x9FCA, 0x6DD5)
+DOUBLE_BYTE_PAIR(0x9FCB, 0x6DEA)
+DOUBLE_BYTE_PAIR(0x9FCC, 0x6DEE)
+DOUBLE_BYTE_PAIR(0x9FCD, 0x6E2D)
+DOUBLE_BYTE_PAIR(0x9FCE, 0x6E6E)
+DOUBLE_BYTE_PAIR(0x9FCF, 0x6E2E)
+DOUBLE_BYTE_PAIR(0x9FD0, 0x6E19)
+DOUBLE_BYTE_PAIR(0x9FD1, 0x6E72)
+DOUBLE_BYTE_PAIR(0x9FD2, 0x6E5F)
+DOUBLE_BYTE_PAIR(0x9FD3, 0x6E3E)
+DOUBLE_BYTE_PAIR(0x9FD4, 0x6E23)
+DOUBLE_BYTE_PAIR(0x9FD5, 0x6E6B)
+DOUBLE_BYTE_PAIR(0x9FD6, 0x6E2B)
+DOUBLE_BYTE_PAIR(0x9FD7, 0x6E76)
+DOUBLE_BYTE_PAIR(0x9FD8, 0x6E4D)
+DOUBLE_BYTE_PAIR(0x9FD9, 0x6E1F)
+DOUBLE_BYTE_PAIR(0x9FDA, 0x6E43)
+DOUBLE_BYTE_PAIR(0x9FDB, 0x6E3A)
+DOUBLE_BYTE_PAIR(0x9FDC, 0x6E4E)
+DOUBLE_BYTE_PAIR(0x9FDD, 0x6E24)
+DOUBLE_BYTE_PAIR(0x9FDE, 0x6EFF)
+DOUBLE_BYTE_PAIR(0x9FDF, 0x6E1D)
+DOUBLE_BYTE_PAIR(0x9FE0, 0x6E38)
+DOUBLE_BYTE_PAIR(0x9FE1, 0x6E82)
+DOUBLE_BYTE_PAIR(0x9FE2, 0x6EAA)
+DOUBLE_BYTE_PAIR(0x9FE3, 0x6E98)
+DOUBLE_BYTE_PAIR(0x9FE4, 0x6EC9)
+DOUBLE_BYTE_PAIR(0x9FE5, 0x6EB7)
+DOUBLE_BYTE_PAIR(0x9FE6, 0x6ED3)
+DOUBLE_BYTE_PAIR(0x9FE7, 0x6EBD)
+DOUBLE_BYTE_PAIR(0x9FE8, 0x6EAF)
+DOUBLE_BYTE_PAIR(0x9FE9, 0x6EC4)
+DOUBLE_BYTE_PAIR(0x9FEA, 0x6EB2)
+DOUBLE_BYTE_PAIR(0x9FEB, 0x6ED4)
+DOUBLE_BYTE_PAIR(0x9FEC, 0x6ED5)
+DOUBLE_BYTE_PAIR(0x9FED, 0x6E8F)
+DOUBLE_BYTE_PAIR(0x9FEE, 0x6EA5)
+DOUBLE_BYTE_PAIR(0x9FEF, 0x6EC2)
+DOUBLE_BYTE_PAIR(0x9FF0, 0x6E9F)
+DOUBLE_BYTE_PAIR(0x9FF1, 0x6F41)
+DOUBLE_BYTE_PAIR(0x9FF2, 0x6F11)
+DOUBLE_BYTE_PAIR(0x9FF3, 0x704C)
+DOUBLE_BYTE_PAIR(0x9FF4, 0x6EEC)
+DOUBLE_BYTE_PAIR(0x9FF5, 0x6EF8)
+DOUBLE_BYTE_PAIR(0x9FF6, 0x6EFE)
+DOUBLE_BYTE_PAIR(0x9FF7, 0x6F3F)
+DOUBLE_BYTE_PAIR(0x9FF8, 0x6EF2)
+DOUBLE_BYTE_PAIR(0x9FF9, 0x6F31)
+DOUBLE_BYTE_PAIR(0x9FFA, 0x6EEF)
+DOUBLE_BYTE_PAIR(0x9FFB, 0x6F32)
+DOUBLE_BYTE_PAIR(0x9FFC, 0x6ECC)
+DOUBLE_BYTE_PAIR(0xE040, 0x6F3E)
+DOUBLE_BYTE_PAIR(0xE041, 0x6F13)
+DOUBLE_BYTE_PAIR(0xE042, 0x6EF7)
+DOUBLE_BYTE_PAIR(0xE043, 0x6F86)
+DOUBLE_BYTE_PAIR(0xE044, 0x6F7A)
+DOUBLE_BYTE_PAIR(0xE045, 0x6F78)
+DOUBLE_BYTE_PAIR(0xE046, 0x6F81)
+DOUBLE_BYTE_PAIR(0xE047, 0x6F80)
+DOUBLE_BYTE_PAIR(0xE048, 0x6F6F)
+DOUBLE_BYTE_PAIR(0xE049, 0x6F5B)
+DOUBLE_BYTE_PAIR(0xE04A, 0x6FF3)
+DOUBLE_BYTE_PAIR(0xE04B, 0x6F6D)
+DOUBLE_BYTE_PAIR(0xE04C, 0x6F82)
+DOUBLE_BYTE_PAIR(0xE04D, 0x6F7C)
+DOUBLE_BYTE_PAIR(0xE04E, 0x6F58)
+DOUBLE_BYTE_PAIR(0xE04F, 0x6F8E)
+DOUBLE_BYTE_PAIR(0xE050, 0x6F91)
+DOUBLE_BYTE_PAIR(0xE051, 0x6FC2)
+DOUBLE_BYTE_PAIR(0xE052, 0x6F66)
+DOUBLE_BYTE_PAIR(0xE053, 0x6FB3)
+DOUBLE_BYTE_PAIR(0xE054, 0x6FA3)
+DOUBLE_BYTE_PAIR(0xE055, 0x6FA1)
+DOUBLE_BYTE_PAIR(0xE056, 0x6FA4)
+DOUBLE_BYTE_PAIR(0xE057, 0x6FB9)
+DOUBLE_BYTE_PAIR(0xE058, 0x6FC6)
+DOUBLE_BYTE_PAIR(0xE059, 0x6FAA)
+DOUBLE_BYTE_PAIR(0xE05A, 0x6FDF)
+DOUBLE_BYTE_PAIR(0xE05B, 0x6FD5)
+DOUBLE_BYTE_PAIR(0xE05C, 0x6FEC)
+DOUBLE_BYTE_PAIR(0xE05D, 0x6FD4)
+DOUBLE_BYTE_PAIR(0xE05E, 0x6FD8)
+DOUBLE_BYTE_PAIR(0xE05F, 0x6FF1)
+DOUBLE_BYTE_PAIR(0xE060, 0x6FEE)
+DOUBLE_BYTE_PAIR(0xE061, 0x6FDB)
+DOUBLE_BYTE_PAIR(0xE062, 0x7009)
+DOUBLE_BYTE_PAIR(0xE063, 0x700B)
+DOUBLE_BYTE_PAIR(0xE064, 0x6FFA)
+DOUBLE_BYTE_PAIR(0xE065, 0x7011)
+DOUBLE_BYTE_PAIR(0xE066, 0x7001)
+DOUBLE_BYTE_PAIR(0xE067, 0x700F)
+DOUBLE_BYTE_PAIR(0xE068, 0x6FFE)
+DOUBLE_BYTE_PAIR(0xE069, 0x701B)
+DOUBLE_BYTE_PAIR(0xE06A, 0x701A)
+DOUBLE_BYTE_PAIR(0xE06B, 0x6F74)
+DOUBLE_BYTE_PAIR(0xE06C, 0x701D)
+DOUBLE_BYTE_PAIR(0xE06D, 0x7018)
+DOUBLE_BYTE_PAIR(0xE06E, 0x701F)
+DOUBLE_BYTE_PAIR(0xE06F, 0x7030)
+DOUBLE_BYTE_PAIR(0xE070, 0x703E)
+DOUBLE_BYTE_PAIR(0xE071, 0x7032)
+DOUBLE_BYTE_PAIR(0xE072, 0x7051)
+DOUBLE_BYTE_PAIR(0xE073, 0x7063)
+DOUBLE_BYTE_PAIR(0xE074, 0x7099)
+DOUBLE_BYTE_PAIR(0xE075, 0x7092)
+DOUBLE_BYTE_PAIR(0xE076, 0x70AF)
+DOUBLE_BYTE_PAIR(0xE077, 0x70F1)
+DOUBLE_BYTE_PAIR(0xE078, 0x70AC)
+DOUBLE_BYTE_PAIR(0xE079, 0x70B8)
+DOUBLE_BYTE_PAIR(0xE07A, 0x70B3)
+DOUBLE_BYTE_PAIR(0xE07B, 0x70AE)
+DOUBLE_BYTE_PAIR(0xE07C, 0x70DF)
+DOUBLE_BYTE_PAIR(0xE07D, 0x70CB)
+DOUBLE_BYTE_PAIR(0xE07E, 0x70DD)
+DOUBLE_BYTE_PAIR(0xE080, 0x70D9)
+DOUBLE_BYTE_PAIR(0xE081, 0x7109)
+DOUBLE_BYTE_PAIR(0xE082, 0x70FD)
+DOUBLE_BYTE_PAIR(0xE083, 0x711C)
+DOUBLE_BYTE_PAIR(0xE084, 0x7119)
+DOUBLE_BYTE_PAIR(0xE085, 0x7165)
+DOUBLE_BYTE_PAIR(0xE086, 0x7155)
+DOUBLE_BYTE_PAIR(0xE087, 0x7188)
+DOUBLE_BYTE_PAIR(0xE088, 0x7166)
+DOUBLE_BYTE_PAIR(0xE089, 0x7162)
+DOUBLE_BYTE_PAIR(0xE08A, 0x714C)
+DOUBLE_BYTE_PAIR(0xE08B, 0x7156)
+DOUBLE_BYTE_PAIR(0xE08C, 0x716C)
+DOUBLE_BYTE_PAIR(0xE08D, 0x718F)
+DOUBLE_BYTE_PAIR(0xE08E, 0x71FB)
+DOUBLE_BYTE_PAIR(0xE08F, 0x7184)
+DOUBLE_BYTE_PAIR(0xE090, 0x7195)
+DOUBLE_BYTE_PAIR(0xE091, 0x71A8)
+DOUBLE_BYTE_PAIR(0xE092, 0x71AC)
+DOUBLE_BYTE_PAIR(0xE093, 0x71D7)
+DOUBLE_BYTE_PAIR(0xE094, 0x71B9)
+DOUBLE_BYTE_PAIR(0xE095, 0x71BE)
+DOUBLE_BYTE_PAIR(0xE096, 0x71D2)
+DOUBLE_BYTE_PAIR(0xE097, 0x71C9)
+DOUBLE_BYTE_PAIR(0xE098, 0x71D4)
+DOUBLE_BYTE_PAIR(0xE099, 0x71CE)
+DOUBLE_BYTE_PAIR(0xE09A, 0x71E0)
+DOUBLE_BYTE_PAIR(0xE09B, 0x71EC)
+DOUBLE_BYTE_PAIR(0xE09C, 0x71E7)
+DOUBLE_BYTE_PAIR(0xE09D, 0x71F5)
+DOUBLE_BYTE_PAIR(0xE09E, 0x71FC)
+DOUBLE_BYTE_PAIR(0xE09F, 0x71F9)
+DOUBLE_BYTE_PAIR(0xE0A0, 0x71FF)
+DOUBLE_BYTE_PAIR(0xE0A1, 0x720D)
+DOUBLE_BYTE_PAIR(0xE0A2, 0x7210)
+DOUBLE_BYTE_PAIR(0xE0A3, 0x721B)
+DOUBLE_BYTE_PAIR(0xE0A4, 0x7228)
+DOUBLE_BYTE_PAIR(0xE0A5, 0x722D)
+DOUBLE_BYTE_PAIR(0xE0A6, 0x722C)
+DOUBLE_BYTE_PAIR(0xE0A7, 0x7230)
+DOUBLE_BYTE_PAIR(0xE0A8, 0x7232)
+DOUBLE_BYTE_PAIR(0xE0A9, 0x723B)
+DOUBLE_BYTE_PAIR(0xE0AA, 0x723C)
+DOUBLE_BYTE_PAIR(0xE0AB, 0x723F)
+DOUBLE_BYTE_PAIR(0xE0AC, 0x7240)
+DOUBLE_BYTE_PAIR(0xE0AD, 0x7246)
+DOUBLE_BYTE_PAIR(0xE0AE, 0x724B)
+DOUBLE_BYTE_PAIR(0xE0AF, 0x7258)
+DOUBLE_BYTE_PAIR(0xE0B0, 0x7274)
+DOUBLE_BYTE_PAIR(0xE0B1, 0x727E)
+DOUBLE_BYTE_PAIR(0xE0B2, 0x7282)
+DOUBLE_BYTE_PAIR(0xE0B3, 0x7281)
+DOUBLE_BYTE_PAIR(0xE0B4, 0x7287)
+DOUBLE_BYTE_PAIR(0xE0B5, 0x7292)
+DOUBLE_BYTE_PAIR(0xE0B6, 0x7296)
+DOUBLE_BYTE_PAIR(0xE0B7, 0x72A2)
+DOUBLE_BYTE_PAIR(0xE0B8, 0x72A7)
+DOUBLE_BYTE_PAIR(0xE0B9, 0x72B9)
+DOUBLE_BYTE_PAIR(0xE0BA, 0x72B2)
+DOUBLE_BYTE_PAIR(0xE0BB, 0x72C3)
+DOUBLE_BYTE_PAIR(0xE0BC, 0x72C6)
+DOUBLE_BYTE_PAIR(0xE0BD, 0x72C4)
+DOUBLE_BYTE_PAIR(0xE0BE, 0x72CE)
+DOUBLE_BYTE_PAIR(0xE0BF, 0x72D2)
+DOUBLE_BYTE_PAIR(0xE0C0, 0x72E2)
+DOUBLE_BYTE_PAIR(0xE0C1, 0x72E0)
+DOUBLE_BYTE_PAIR(0xE0C2, 0x72E1)
+DOUBLE_BYTE_PAIR(0xE0C3, 0x72F9)
+DOUBLE_BYTE_PAIR(0xE0C4, 0x72F7)
+DOUBLE_BYTE_PAIR(0xE0C5, 0x500F)
+DOUBLE_BYTE_PAIR(0xE0C6, 0x7317)
+DOUBLE_BYTE_PAIR(0xE0C7, 0x730A)
+DOUBLE_BYTE_PAIR(0xE0C8, 0x731C)
+DOUBLE_BYTE_PAIR(0xE0C9, 0x7316)
+DOUBLE_BYTE_PAIR(0xE0CA, 0x731D)
+DOUBLE_BYTE_PAIR(0xE0CB, 0x7334)
+DOUBLE_BYTE_PAIR(0xE0CC, 0x732F)
+DOUBLE_BYTE_PAIR(0xE0CD, 0x7329)
+DOUBLE_BYTE_PAIR(0xE0CE, 0x7325)
+DOUBLE_BYTE_PAIR(0xE0CF, 0x733E)
+DOUBLE_BYTE_PAIR(0xE0D0, 0x734E)
+DOUBLE_BYTE_PAIR(0xE0D1, 0x734F)
+DOUBLE_BYTE_PAIR(0xE0D2, 0x9ED8)
+DOUBLE_BYTE_PAIR(0xE0D3, 0x7357)
+DOUBLE_BYTE_PAIR(0xE0D4, 0x736A)
+DOUBLE_BYTE_PAIR(0xE0D5, 0x7368)
+DOUBLE_BYTE_PAIR(0xE0D6, 0x7370)
+DOUBLE_BYTE_PAIR(0xE0D7, 0x7378)
+DOUBLE_BYTE_PAIR(0xE0D8, 0x7375)
+DOUBLE_BYTE_PAIR(0xE0D9, 0x737B)
+DOUBLE_BYTE_PAIR(0xE0DA, 0x737A)
+DOUBLE_BYTE_PAIR(0xE0DB, 0x73C8)
+DOUBLE_BYTE_PAIR(0xE0DC, 0x73B3)
+DOUBLE_BYTE_PAIR(0xE0DD, 0x73CE)
+DOUBLE_BYTE_PAIR(0xE0DE, 0x73BB)
+DOUBLE_BYTE_PAIR(0xE0DF, 0x73C0)
+DOUBLE_BYTE_PAIR(0xE0E0, 0x73E5)
+DOUBLE_BYTE_PAIR(0xE0E1, 0x73EE)
+DOUBLE_BYTE_PAIR(0xE0E2, 0x73DE)
+DOUBLE_BYTE_PAIR(0xE0E3, 0x74A2)
+DOUBLE_BYTE_PAIR(0xE0E4, 0x7405)
+DOUBLE_BYTE_PAIR(0xE0E5, 0x746F)
+DOUBLE_BYTE_PAIR(0xE0E6, 0x7425)
+DOUBLE_BYTE_PAIR(0xE0E7, 0x73F8)
+DOUBLE_BYTE_PAIR(0xE0E8, 0x7432)
+DOUBLE_BYTE_PAIR(0xE0E9, 0x743A)
+DOUBLE_BYTE_PAIR(0xE0EA, 0x7455)
+DOUBLE_BYTE_PAIR(0xE0EB, 0x743F)
+DOUBLE_BYTE_PAIR(0xE0EC, 0x745F)
+DOUBLE_BYTE_PAIR(0xE0ED, 0x7459)
+DOUBLE_BYTE_PAIR(0xE0EE, 0x7441)
+DOUBLE_BYTE_PAIR(0xE0EF, 0x745C)
+DOUBLE_BYTE_PAIR(0xE0F0, 0x7469)
+DOUBLE_BYTE_PAIR(0xE0F1, 0x7470)
+DOUBLE_BYTE_PAIR(0xE0F2, 0x7463)
+DOUBLE_BYTE_PAIR(0xE0F3, 0x746A)
+DOUBLE_BYTE_PAIR(0xE0F4, 0x7476)
+DOUBLE_BYTE_PAIR(0xE0F5, 0x747E)
+DOUBLE_BYTE_PAIR(0xE0F6, 0x748B)
+DOUBLE_BYTE_PAIR(0xE0F7, 0x749E)
+DOUBLE_BYTE_PAIR(0xE0F8, 0x74A7)
+DOUBLE_BYTE_PAIR(0xE0F9, 0x74CA)
+DOUBLE_BYTE_PAIR(0xE0FA, 0x74CF)
+DOUBLE_BYTE_PAIR(0xE0FB, 0x74D4)
+DOUBLE_BYTE_PAIR(0xE0FC, 0x73F1)
+DOUBLE_BYTE_PAIR(0xE140, 0x74E0)
+DOUBLE_BYTE_PAIR(0xE141, 0x74E3)
+DOUBLE_BYTE_PAIR(0xE142, 0x74E7)
+DOUBLE_BYTE_PAIR(0xE143, 0x74E9)
+DOUBLE_BYTE_PAIR(0xE144, 0x74EE)
+DOUBLE_BYTE_PAIR(0xE145, 0x74F2)
+DOUBLE_BYTE_PAIR(0xE146, 0x74F0)
+DOUBLE_BYTE_PAIR(0xE147, 0x74F1)
+DOUBLE_BYTE_PAIR(0xE148, 0x74F8)
+DOUBLE_BYTE_PAIR(0xE149, 0x74F7)
+DOUBLE_BYTE_PAIR(0xE14A, 0x7504)
+DOUBLE_BYTE_PAIR(0xE14B, 0x7503)
+DOUBLE_BYTE_PAIR(0xE14C, 0x7505)
+DOUBLE_BYTE_PAIR(0xE14D, 0x750C)
+DOUBLE_BYTE_PAIR(0xE14E, 0x750E)
+DOUBLE_BYTE_PAIR(0xE14F, 0x750D)
+DOUBLE_BYTE_PAIR(0xE150, 0x7515)
+DOUBLE_BYTE_PAIR(0xE151, 0x7513)
+DOUBLE_BYTE_PAIR(0xE152, 0x751E)
+DOUBLE_BYTE_PAIR(0xE153, 0x7526)
+DOUBLE_BYTE_PAIR(0xE154, 0x752C)
+DOUBLE_BYTE_PAIR(0xE155, 0x753C)
+DOUBLE_BYTE_PAIR(0xE156, 0x7544)
+DOUBLE_BYTE_PAIR(0xE157, 0x754D)
+DOUBLE_BYTE_PAIR(0xE158, 0x754A)
+DOUBLE_BYTE_PAIR(0xE159, 0x7549)
+DOUBLE_BYTE_PAIR(0xE15A, 0x755B)
+DOUBLE_BYTE_PAIR(0xE15B, 0x7546)
+DOUBLE_BYTE_PAIR(0xE15C, 0x755A)
+DOUBLE_BYTE_PAIR(0xE15D, 0x7569)
+DOUBLE_BYTE_PAIR(0xE15E, 0x7564)
+DOUBLE_BYTE_PAIR(0xE15F, 0x7567)
+DOUBLE_BYTE_PAIR(0xE160, 0x756B)
+DOUBLE_BYTE_PAIR(0xE161, 0x756D)
+DOUBLE_BYTE_PAIR(0xE162, 0x7578)
+DOUBLE_BYTE_PAIR(0xE163, 0x7576)
+DOUBLE_BYTE_PAIR(0xE164, 0x7586)
+DOUBLE_BYTE_PAIR(0xE165, 0x7587)
+DOUBLE_BYTE_PAIR(0xE166, 0x7574)
+DOUBLE_BYTE_PAIR(0xE167, 0x758A)
+DOUBLE_BYTE_PAIR(0xE168, 0x7589)
+DOUBLE_BYTE_PAIR(0xE169, 0x7582)
+DOUBLE_BYTE_PAIR(0xE16A, 0x7594)
+DOUBLE_BYTE_PAIR(0xE16B, 0x759A)
+DOUBLE_BYTE_PAIR(0xE16C, 0x759D)
+DOUBLE_BYTE_PAIR(0xE16D, 0x75A5)
+DOUBLE_BYTE_PAIR(0xE16E, 0x75A3)
+DOUBLE_BYTE_PAIR(0xE16F, 0x75C2)
+DOUBLE_BYTE_PAIR(0xE170, 0x75B3)
+DOUBLE_BYTE_PAIR(0xE171, 0x75C3)
+DOUBLE_BYTE_PAIR(0xE172, 0x75B5)
+DOUBLE_BYTE_PAIR(0xE173, 0x75BD)
+DOUBLE_BYTE_PAIR(0xE174, 0x75B8)
+DOUBLE_BYTE_PAIR(0xE175, 0x75BC)
+DOUBLE_BYTE_PAIR(0xE176, 0x75B1)
+DOUBLE_BYTE_PAIR(0xE177, 0x75CD)
+DOUBLE_BYTE_PAIR(0xE178, 0x75CA)
+DOUBLE_BYTE_PAIR(0xE179, 0x75D2)
+DOUBLE_BYTE_PAIR(0xE17A, 0x75D9)
+DOUBLE_BYTE_PAIR(0xE17B, 0x75E3)
+DOUBLE_BYTE_PAIR(0xE17C, 0x75DE)
+DOUBLE_BYTE_PAIR(0xE17D, 0x75FE)
+DOUBLE_BYTE_PAIR(0xE17E, 0x75FF)
+DOUBLE_BYTE_PAIR(0xE180, 0x75FC)
+DOUBLE_BYTE_PAIR(0xE181, 0x7601)
+DOUBLE_BYTE_PAIR(0xE182, 0x75F0)
+DOUBLE_BYTE_PAIR(0xE183, 0x75FA)
+DOUBLE_BYTE_PAIR(0xE184, 0x75F2)
+DOUBLE_BYTE_PAIR(0xE185, 0x75F3)
+DOUBLE_BYTE_PAIR(0xE186, 0x760B)
+DOUBLE_BYTE_PAIR(0xE187, 0x760D)
+DOUBLE_BYTE_PAIR(0xE188, 0x7609)
+DOUBLE_BYTE_PAIR(0xE189, 0x761F)
+DOUBLE_BYTE_PAIR(0xE18A, 0x7627)
+DOUBLE_BYTE_PAIR(0xE18B, 0x7620)
+DOUBLE_BYTE_PAIR(0xE18C, 0x7621)
+DOUBLE_BYTE_PAIR(0xE18D, 0x7622)
+DOUBLE_BYTE_PAIR(0xE18E, 0x7624)
+DOUBLE_BYTE_PAIR(0xE18F, 0x7634)
+DOUBLE_BYTE_PAIR(0xE190, 0x7630)
+DOUBLE_BYTE_PAIR(0xE191, 0x763B)
+DOUBLE_BYTE_PAIR(0xE192, 0x7647)
+DOUBLE_BYTE_PAIR(0xE193, 0x7648)
+DOUBLE_BYTE_PAIR(0xE194, 0x7646)
+DOUBLE_BYTE_PAIR(0xE195, 0x765C)
+DOUBLE_BYTE_PAIR(0xE196, 0x7658)
+DOUBLE_BYTE_PAIR(0xE197, 0x7661)
+DOUBLE_BYTE_PAIR(0xE198, 0x7662)
+DOUBLE_BYTE_PAIR(0xE199, 0x7668)
+DOUBLE_BYTE_PAIR(0xE19A, 0x7669)
+DOUBLE_BYTE_PAIR(0xE19B, 0x766A)
+DOUBLE_BYTE_PAIR(0xE19C, 0x7667)
+DOUBLE_BYTE_PAIR(0xE19D, 0x766C)
+DOUBLE_BYTE_PAIR(0xE19E, 0x7670)
+DOUBLE_BYTE_PAIR(0xE19F, 0x7672)
+DOUBLE_BYTE_PAIR(0xE1A0, 0x7676)
+DOUBLE_BYTE_PAIR(0xE1A1, 0x7678)
+DOUBLE_BYTE_PAIR(0xE1A2, 0x767C)
+DOUBLE_BYTE_PAIR(0xE1A3, 0x7680)
+DOUBLE_BYTE_PAIR(0xE1A4, 0x7683)
+DOUBLE_BYTE_PAIR(0xE1A5, 0x7688)
+DOUBLE_BYTE_PAIR(0xE1A6, 0x768B)
+DOUBLE_BYTE_PAIR(0xE1A7, 0x768E)
+DOUBLE_BYTE_PAIR(0xE1A8, 0x7696)
+DOUBLE_BYTE_PAIR(0xE1A9, 0x7693)
+DOUBLE_BYTE_PAIR(0xE1AA, 0x7699)
+DOUBLE_BYTE_PAIR(0xE1AB, 0x769A)
+DOUBLE_BYTE_PAIR(0xE1AC, 0x76B0)
+DOUBLE_BYTE_PAIR(0xE1AD, 0x76B4)
+DOUBLE_BYTE_PAIR(0xE1AE, 0x76B8)
+DOUBLE_BYTE_PAIR(0xE1AF, 0x76B9)
+DOUBLE_BYTE_PAIR(0xE1B0, 0x76BA)
+DOUBLE_BYTE_PAIR(0xE1B1, 0x76C2)
+DOUBLE_BYTE_PAIR(0xE1B2, 0x76CD)
+DOUBLE_BYTE_PAIR(0xE1B3, 0x76D6)
+DOUBLE_BYTE_PAIR(0xE1B4, 0x76D2)
+DOUBLE_BYTE_PAIR(0xE1B5, 0x76DE)
+DOUBLE_BYTE_PAIR(0xE1B6, 0x76E1)
+DOUBLE_BYTE_PAIR(0xE1B7, 0x76E5)
+DOUBLE_BYTE_PAIR(0xE1B8, 0x76E7)
+DOUBLE_BYTE_PAIR(0xE1B9, 0x76EA)
+DOUBLE_BYTE_PAIR(0xE1BA, 0x862F)
+DOUBLE_BYTE_PAIR(0xE1BB, 0x76FB)
+DOUBLE_BYTE_PAIR(0xE1BC, 0x7708)
+DOUBLE_BYTE_PAIR(0xE1BD, 0x7707)
+DOUBLE_BYTE_PAIR(0xE1BE, 0x7704)
+DOUBLE_BYTE_PAIR(0xE1BF, 0x7729)
+DOUBLE_BYTE_PAIR(0xE1C0, 0x7724)
+DOUBLE_BYTE_PAIR(0xE1C1, 0x771E)
+DOUBLE_BYTE_PAIR(0xE1C2, 0x7725)
+DOUBLE_BYTE_PAIR(0xE1C3, 0x7726)
+DOUBLE_BYTE_PAIR(0xE1C4, 0x771B)
+DOUBLE_BYTE_PAIR(0xE1C5, 0x7737)
+DOUBLE_BYTE_PAIR(0xE1C6, 0x7738)
+DOUBLE_BYTE_PAIR(0xE1C7, 0x7747)
+DOUBLE_BYTE_PAIR(0xE1C8, 0x775A)
+DOUBLE_BYTE_PAIR(0xE1C9, 0x7768)
+DOUBLE_BYTE_PAIR(0xE1CA, 0x776B)
+DOUBLE_BYTE_PAIR(0xE1CB, 0x775B)
+DOUBLE_BYTE_PAIR(0xE1CC, 0x7765)
+DOUBLE_BYTE_PAIR(0xE1CD, 0x777F)
+DOUBLE_BYTE_PAIR(0xE1CE, 0x777E)
+DOUBLE_BYTE_PAIR(0xE1CF, 0x7779)
+DOUBLE_BYTE_PAIR(0xE1D0, 0x778E)
+DOUBLE_BYTE_PAIR(0xE1D1, 0x778B)
+DOUBLE_BYTE_PAIR(0xE1D2, 0x7791)
+DOUBLE_BYTE_PAIR(0xE1D3, 0x77A0)
+DOUBLE_BYTE_PAIR(0xE1D4, 0x779E)
+DOUBLE_BYTE_PAIR(0xE1D5, 0x77B0)
+DOUBLE_BYTE_PAIR(0xE1D6, 0x77B6)
+DOUBLE_BYTE_PAIR(0xE1D7, 0x77B9)
+DOUBLE_BYTE_PAIR(0xE1D8, 0x77BF)
+DOUBLE_BYTE_PAIR(0xE1D9, 0x77BC)
+DOUBLE_BYTE_PAIR(0xE1DA, 0x77BD)
+DOUBLE_BYTE_PAIR(0xE1DB, 0x77BB)
+DOUBLE_BYTE_PAIR(0xE1DC, 0x77C7)
+DOUBLE_BYTE_PAIR(0xE1DD, 0x77CD)
+DOUBLE_BYTE_PAIR(0xE1DE, 0x77D7)
+DOUBLE_BYTE_PAIR(0xE1DF, 0x77DA)
+DOUBLE_BYTE_PAIR(0xE1E0, 0x77DC)
+DOUBLE_BYTE_PAIR(0xE1E1, 0x77E3)
+DOUBLE_BYTE_PAIR(0xE1E2, 0x77EE)
+DOUBLE_BYTE_PAIR(0xE1E3, 0x77FC)
+DOUBLE_BYTE_PAIR(0xE1E4, 0x780C)
+DOUBLE_BYTE_PAIR(0xE1E5, 0x7812)
+DOUBLE_BYTE_PAIR(0xE1E6, 0x7926)
+DOUBLE_BYTE_PAIR(0xE1E7, 0x7820)
+DOUBLE_BYTE_PAIR(0xE1E8, 0x792A)
+DOUBLE_BYTE_PAIR(0xE1E9, 0x7845)
+DOUBLE_BYTE_PAIR(0xE1EA, 0x788E)
+DOUBLE_BYTE_PAIR(0xE1EB, 0x7874)
+DOUBLE_BYTE_PAIR(0xE1EC, 0x7886)
+DOUBLE_BYTE_PAIR(0xE1ED, 0x787C)
+DOUBLE_BYTE_PAIR(0xE1EE, 0x789A)
+DOUBLE_BYTE_PAIR(0xE1EF, 0x788C)
+DOUBLE_BYTE_PAIR(0xE1F0, 0x78A3)
+DOUBLE_BYTE_PAIR(0xE1F1, 0x78B5)
+DOUBLE_BYTE_PAIR(0xE1F2, 0x78AA)
+DOUBLE_BYTE_PAIR(0xE1F3, 0x78AF)
+DOUBLE_BYTE_PAIR(0xE1F4, 0x78D1)
+DOUBLE_BYTE_PAIR(0xE1F5, 0x78C6)
+DOUBLE_BYTE_PAIR(0xE1F6, 0x78CB)
+DOUBLE_BYTE_PAIR(0xE1F7, 0x78D4)
+DOUBLE_BYTE_PAIR(0xE1F8, 0x78BE)
+DOUBLE_BYTE_PAIR(0xE1F9, 0x78BC)
+DOUBLE_BYTE_PAIR(0xE1FA, 0x78C5)
+DOUBLE_BYTE_PAIR(0xE1FB, 0x78CA)
+DOUBLE_BYTE_PAIR(0xE1FC, 0x78EC)
+DOUBLE_BYTE_PAIR(0xE240, 0x78E7)
+DOUBLE_BYTE_PAIR(0xE241, 0x78DA)
+DOUBLE_BYTE_PAIR(0xE242, 0x78FD)
+DOUBLE_BYTE_PAIR(0xE243, 0x78F4)
+DOUBLE_BYTE_PAIR(0xE244, 0x7907)
+DOUBLE_BYTE_PAIR(0xE245, 0x7912)
+DOUBLE_BYTE_PAIR(0xE246, 0x7911)
+DOUBLE_BYTE_PAIR(0xE247, 0x7919)
+DOUBLE_BYTE_PAIR(0xE248, 0x792C)
+DOUBLE_BYTE_PAIR(0xE249, 0x792B)
+DOUBLE_BYTE_PAIR(0xE24A, 0x7940)
+DOUBLE_BYTE_PAIR(0xE24B, 0x7960)
+DOUBLE_BYTE_PAIR(0xE24C, 0x7957)
+DOUBLE_BYTE_PAIR(0xE24D, 0x795F)
+DOUBLE_BYTE_PAIR(0xE24E, 0x795A)
+DOUBLE_BYTE_PAIR(0xE24F, 0x7955)
+DOUBLE_BYTE_PAIR(0xE250, 0x7953)
+DOUBLE_BYTE_PAIR(0xE251, 0x797A)
+DOUBLE_BYTE_PAIR(0xE252, 0x797F)
+DOUBLE_BYTE_PAIR(0xE253, 0x798A)
+DOUBLE_BYTE_PAIR(0xE254, 0x799D)
+DOUBLE_BYTE_PAIR(0xE255, 0x79A7)
+DOUBLE_BYTE_PAIR(0xE256, 0x9F4B)
+DOUBLE_BYTE_PAIR(0xE257, 0x79AA)
+DOUBLE_BYTE_PAIR(0xE258, 0x79AE)
+DOUBLE_BYTE_PAIR(0xE259, 0x79B3)
+DOUBLE_BYTE_PAIR(0xE25A, 0x79B9)
+DOUBLE_BYTE_PAIR(0xE25B, 0x79BA)
+DOUBLE_BYTE_PAIR(0xE25C, 0x79C9)
+DOUBLE_BYTE_PAIR(0xE25D, 0x79D5)
+DOUBLE_BYTE_PAIR(0xE25E, 0x79E7)
+DOUBLE_BYTE_PAIR(0xE25F, 0x79EC)
+DOUBLE_BYTE_PAIR(0xE260, 0x79E1)
+DOUBLE_BYTE_PAIR(0xE261, 0x79E3)
+DOUBLE_BYTE_PAIR(0xE262, 0x7A08)
+DOUBLE_BYTE_PAIR(0xE263, 0x7A0D)
+DOUBLE_BYTE_PAIR(0xE264, 0x7A18)
+DOUBLE_BYTE_PAIR(0xE265, 0x7A19)
+DOUBLE_BYTE_PAIR(0xE266, 0x7A20)
+DOUBLE_BYTE_PAIR(0xE267, 0x7A1F)
+DOUBLE_BYTE_PAIR(0xE268, 0x7980)
+DOUBLE_BYTE_PAIR(0xE269, 0x7A31)
+DOUBLE_BYTE_PAIR(0xE26A, 0x7A3B)
+DOUBLE_BYTE_PAIR(0xE26B, 0x7A3E)
+DOUBLE_BYTE_PAIR(0xE26C, 0x7A37)
+DOUBLE_BYTE_PAIR(0xE26D, 0x7A43)
+DOUBLE_BYTE_PAIR(0xE26E, 0x7A57)
+DOUBLE_BYTE_PAIR(0xE26F, 0x7A49)
+DOUBLE_BYTE_PAIR(0xE270, 0x7A61)
+DOUBLE_BYTE_PAIR(0xE271, 0x7A62)
+DOUBLE_BYTE_PAIR(0xE272, 0x7A69)
+DOUBLE_BYTE_PAIR(0xE273, 0x9F9D)
+DOUBLE_BYTE_PAIR(0xE274, 0x7A70)
+DOUBLE_BYTE_PAIR(0xE275, 0x7A79)
+DOUBLE_BYTE_PAIR(0xE276, 0x7A7D)
+DOUBLE_BYTE_PAIR(0xE277, 0x7A88)
+DOUBLE_BYTE_PAIR(0xE278, 0x7A97)
+DOUBLE_BYTE_PAIR(0xE279, 0x7A95)
+DOUBLE_BYTE_PAIR(0xE27A, 0x7A98)
+DOUBLE_BYTE_PAIR(0xE27B, 0x7A96)
+DOUBLE_BYTE_PAIR(0xE27C, 0x7AA9)
+DOUBLE_BYTE_PAIR(0xE27D, 0x7AC8)
+DOUBLE_BYTE_PAIR(0xE27E, 0x7AB0)
+DOUBLE_BYTE_PAIR(0xE280, 0x7AB6)
+DOUBLE_BYTE_PAIR(0xE281, 0x7AC5)
+DOUBLE_BYTE_PAIR(0xE282, 0x7AC4)
+DOUBLE_BYTE_PAIR(0xE283, 0x7ABF)
+DOUBLE_BYTE_PAIR(0xE284, 0x9083)
+DOUBLE_BYTE_PAIR(0xE285, 0x7AC7)
+DOUBLE_BYTE_PAIR(0xE286, 0x7ACA)
+DOUBLE_BYTE_PAIR(0xE287, 0x7ACD)
+DOUBLE_BYTE_PAIR(0xE288, 0x7ACF)
+DOUBLE_BYTE_PAIR(0xE289, 0x7AD5)
+DOUBLE_BYTE_PAIR(0xE28A, 0x7AD3)
+DOUBLE_BYTE_PAIR(0xE28B, 0x7AD9)
+DOUBLE_BYTE_PAIR(0xE28C, 0x7ADA)
+DOUBLE_BYTE_PAIR(0xE28D, 0x7ADD)
+DOUBLE_BYTE_PAIR(0xE28E, 0x7AE1)
+DOUBLE_BYTE_PAIR(0xE28F, 0x7AE2)
+DOUBLE_BYTE_PAIR(0xE290, 0x7AE6)
+DOUBLE_BYTE_PAIR(0xE291, 0x7AED)
+DOUBLE_BYTE_PAIR(0xE292, 0x7AF0)
+DOUBLE_BYTE_PAIR(0xE293, 0x7B02)
+DOUBLE_BYTE_PAIR(0xE294, 0x7B0F)
+DOUBLE_BYTE_PAIR(0xE295, 0x7B0A)
+DOUBLE_BYTE_PAIR(0xE296, 0x7B06)
+DOUBLE_BYTE_PAIR(0xE297, 0x7B33)
+DOUBLE_BYTE_PAIR(0xE298, 0x7B18)
+DOUBLE_BYTE_PAIR(0xE299, 0x7B19)
+DOUBLE_BYTE_PAIR(0xE29A, 0x7B1E)
+DOUBLE_BYTE_PAIR(0xE29B, 0x7B35)
+DOUBLE_BYTE_PAIR(0xE29C, 0x7B28)
+DOUBLE_BYTE_PAIR(0xE29D, 0x7B36)
+DOUBLE_BYTE_PAIR(0xE29E, 0x7B50)
+DOUBLE_BYTE_PAIR(0xE29F, 0x7B7A)
+DOUBLE_BYTE_PAIR(0xE2A0, 0x7B04)
+DOUBLE_BYTE_PAIR(0xE2A1, 0x7B4D)
+DOUBLE_BYTE_PAIR(0xE2A2, 0x7B0B)
+DOUBLE_BYTE_PAIR(0xE2A3, 0x7B4C)
+DOUBLE_BYTE_PAIR(0xE2A4, 0x7B45)
+DOUBLE_BYTE_PAIR(0xE2A5, 0x7B75)
+DOUBLE_BYTE_PAIR(0xE2A6, 0x7B65)
+DOUBLE_BYTE_PAIR(0xE2A7, 0x7B74)
+DOUBLE_BYTE_PAIR(0xE2A8, 0x7B67)
+DOUBLE_BYTE_PAIR(0xE2A9, 0x7B70)
+DOUBLE_BYTE_PAIR(0xE2AA, 0x7B71)
+DOUBLE_BYTE_PAIR(0xE2AB, 0x7B6C)
+DOUBLE_BYTE_PAIR(0xE2AC, 0x7B6E)
+DOUBLE_BYTE_PAIR(0xE2AD, 0x7B9D)
+DOUBLE_BYTE_PAIR(0xE2AE, 0x7B98)
+DOUBLE_BYTE_PAIR(0xE2AF, 0x7B9F)
+DOUBLE_BYTE_PAIR(0xE2B0, 0x7B8D)
+DOUBLE_BYTE_PAIR(0xE2B1, 0x7B9C)
+DOUBLE_BYTE_PAIR(0xE2B2, 0x7B9A)
+DOUBLE_BYTE_PAIR(0xE2B3, 0x7B8B)
+DOUBLE_BYTE_PAIR(0xE2B4, 0x7B92)
+DOUBLE_BYTE_PAIR(0xE2B5, 0x7B8F)
+DOUBLE_BYTE_PAIR(0xE2B6, 0x7B5D)
+DOUBLE_BYTE_PAIR(0xE2B7, 0x7B99)
+DOUBLE_BYTE_PAIR(0xE2B8, 0x7BCB)
+DOUBLE_BYTE_PAIR(0xE2B9, 0x7BC1)
+DOUBLE_BYTE_PAIR(0xE2BA, 0x7BCC)
+DOUBLE_BYTE_PAIR(0xE2BB, 0x7BCF)
+DOUBLE_BYTE_PAIR(0xE2BC, 0x7BB4)
+DOUBLE_BYTE_PAIR(0xE2BD, 0x7BC6)
+DOUBLE_BYTE_PAIR(0xE2BE, 0x7BDD)
+DOUBLE_BYTE_PAIR(0xE2BF, 0x7BE9)
+DOUBLE_BYTE_PAIR(0xE2C0, 0x7C11)
+DOUBLE_BYTE_PAIR(0xE2C1, 0x7C14)
+DOUBLE_BYTE_PAIR(0xE2C2, 0x7BE6)
+DOUBLE_BYTE_PAIR(0xE2C3, 0x7BE5)
+DOUBLE_BYTE_PAIR(0xE2C4, 0x7C60)
+DOUBLE_BYTE_PAIR(0xE2C5, 0x7C00)
+DOUBLE_BYTE_PAIR(0xE2C6, 0x7C07)
+DOUBLE_BYTE_PAIR(0xE2C7, 0x7C13)
+DOUBLE_BYTE_PAIR(0xE2C8, 0x7BF3)
+DOUBLE_BYTE_PAIR(0xE2C9, 0x7BF7)
+DOUBLE_BYTE_PAIR(0xE2CA, 0x7C17)
+DOUBLE_BYTE_PAIR(0xE2CB, 0x7C0D)
+DOUBLE_BYTE_PAIR(0xE2CC, 0x7BF6)
+DOUBLE_BYTE_PAIR(0xE2CD, 0x7C23)
+DOUBLE_BYTE_PAIR(0xE2CE, 0x7C27)
+DOUBLE_BYTE_PAIR(0xE2CF, 0x7C2A)
+DOUBLE_BYTE_PAIR(0xE2D0, 0x7C1F)
+DOUBLE_BYTE_PAIR(0xE2D1, 0x7C37)
+DOUBLE_BYTE_PAIR(0xE2D2, 0x7C2B)
+DOUBLE_BYTE_PAIR(0xE2D3, 0x7C3D)
+DOUBLE_BYTE_PAIR(0xE2D4, 0x7C4C)
+DOUBLE_BYTE_PAIR(0xE2D5, 0x7C43)
+DOUBLE_BYTE_PAIR(0xE2D6, 0x7C54)
+DOUBLE_BYTE_PAIR(0xE2D7, 0x7C4F)
+DOUBLE_BYTE_PAIR(0xE2D8, 0x7C40)
+DOUBLE_BYTE_PAIR(0xE2D9, 0x7C50)
+DOUBLE_BYTE_PAIR(0xE2DA, 0x7C58)
+DOUBLE_BYTE_PAIR(0xE2DB, 0x7C5F)
+DOUBLE_BYTE_PAIR(0xE2DC, 0x7C64)
+DOUBLE_BYTE_PAIR(0xE2DD, 0x7C56)
+DOUBLE_BYTE_PAIR(0xE2DE, 0x7C65)
+DOUBLE_BYTE_PAIR(0xE2DF, 0x7C6C)
+DOUBLE_BYTE_PAIR(0xE2E0, 0x7C75)
+DOUBLE_BYTE_PAIR(0xE2E1, 0x7C83)
+DOUBLE_BYTE_PAIR(0xE2E2, 0x7C90)
+DOUBLE_BYTE_PAIR(0xE2E3, 0x7CA4)
+DOUBLE_BYTE_PAIR(0xE2E4, 0x7CAD)
+DOUBLE_BYTE_PAIR(0xE2E5, 0x7CA2)
+DOUBLE_BYTE_PAIR(0xE2E6, 0x7CAB)
+DOUBLE_BYTE_PAIR(0xE2E7, 0x7CA1)
+DOUBLE_BYTE_PAIR(0xE2E8, 0x7CA8)
+DOUBLE_BYTE_PAIR(0xE2E9, 0x7CB3)
+DOUBLE_BYTE_PAIR(0xE2EA, 0x7CB2)
+DOUBLE_BYTE_PAIR(0xE2EB, 0x7CB1)
+DOUBLE_BYTE_PAIR(0xE2EC, 0x7CAE)
+DOUBLE_BYTE_PAIR(0xE2ED, 0x7CB9)
+DOUBLE_BYTE_PAIR(0xE2EE, 0x7CBD)
+DOUBLE_BYTE_PAIR(0xE2EF, 0x7CC0)
+DOUBLE_BYTE_PAIR(0xE2F0, 0x7CC5)
+DOUBLE_BYTE_PAIR(0xE2F1, 0x7CC2)
+DOUBLE_BYTE_PAIR(0xE2F2, 0x7CD8)
+DOUBLE_BYTE_PAIR(0xE2F3, 0x7CD2)
+DOUBLE_BYTE_PAIR(0xE2F4, 0x7CDC)
+DOUBLE_BYTE_PAIR(0xE2F5, 0x7CE2)
+DOUBLE_BYTE_PAIR(0xE2F6, 0x9B3B)
+DOUBLE_BYTE_PAIR(0xE2F7, 0x7CEF)
+DOUBLE_BYTE_PAIR(0xE2F8, 0x7CF2)
+DOUBLE_BYTE_PAIR(0xE2F9, 0x7CF4)
+DOUBLE_BYTE_PAIR(0xE2FA, 0x7CF6)
+DOUBLE_BYTE_PAIR(0xE2FB, 0x7CFA)
+DOUBLE_BYTE_PAIR(0xE2FC, 0x7D06)
+DOUBLE_BYTE_PAIR(0xE340, 0x7D02)
+DOUBLE_BYTE_PAIR(0xE341, 0x7D1C)
+DOUBLE_BYTE_PAIR(0xE342, 0x7D15)
+DOUBLE_BYTE_PAIR(0xE343, 0x7D0A)
+DOUBLE_BYTE_PAIR(0xE344, 0x7D45)
+DOUBLE_BYTE_PAIR(0xE345, 0x7D4B)
+DOUBLE_BYTE_PAIR(0xE346, 0x7D2E)
+DOUBLE_BYTE_PAIR(0xE347, 0x7D32)
+DOUBLE_BYTE_PAIR(0xE348, 0x7D3F)
+DOUBLE_BYTE_PAIR(0xE349, 0x7D35)
+DOUBLE_BYTE_PAIR(0xE34A, 0x7D46)
+DOUBLE_BYTE_PAIR(0xE34B, 0x7D73)
+DOUBLE_BYTE_PAIR(0xE34C, 0x7D56)
+DOUBLE_BYTE_PAIR(0xE34D, 0x7D4E)
+DOUBLE_BYTE_PAIR(0xE34E, 0x7D72)
+DOUBLE_BYTE_PAIR(0xE34F, 0x7D68)
+DOUBLE_BYTE_PAIR(0xE350, 0x7D6E)
+DOUBLE_BYTE_PAIR(0xE351, 0x7D4F)
+DOUBLE_BYTE_PAIR(0xE352, 0x7D63)
+DOUBLE_BYTE_PAIR(0xE353, 0x7D93)
+DOUBLE_BYTE_PAIR(0xE354, 0x7D89)
+DOUBLE_BYTE_PAIR(0xE355, 0x7D5B)
+DOUBLE_BYTE_PAIR(0xE356, 0x7D8F)
+DOUBLE_BYTE_PAIR(0xE357, 0x7D7D)
+DOUBLE_BYTE_PAIR(0xE358, 0x7D9B)
+DOUBLE_BYTE_PAIR(0xE359, 0x7DBA)
+DOUBLE_BYTE_PAIR(0xE35A, 0x7DAE)
+DOUBLE_BYTE_PAIR(0xE35B, 0x7DA3)
+DOUBLE_BYTE_PAIR(0xE35C, 0x7DB5)
+DOUBLE_BYTE_PAIR(0xE35D, 0x7DC7)
+DOUBLE_BYTE_PAIR(0xE35E, 0x7DBD)
+DOUBLE_BYTE_PAIR(0xE35F, 0x7DAB)
+DOUBLE_BYTE_PAIR(0xE360, 0x7E3D)
+DOUBLE_BYTE_PAIR(0xE361, 0x7DA2)
+DOUBLE_BYTE_PAIR(0xE362, 0x7DAF)
+DOUBLE_BYTE_PAIR(0xE363, 0x7DDC)
+DOUBLE_BYTE_PAIR(0xE364, 0x7DB8)
+DOUBLE_BYTE_PAIR(0xE365, 0x7D9F)
+DOUBLE_BYTE_PAIR(0xE366, 0x7DB0)
+DOUBLE_BYTE_PAIR(0xE367, 0x7DD8)
+DOUBLE_BYTE_PAIR(0xE368, 0x7DDD)
+DOUBLE_BYTE_PAIR(0xE369, 0x7DE4)
+DOUBLE_BYTE_PAIR(0xE36A, 0x7DDE)
+DOUBLE_BYTE_PAIR(0xE36B, 0x7DFB)
+DOUBLE_BYTE_PAIR(0xE36C, 0x7DF2)
+DOUBLE_BYTE_PAIR(0xE36D, 0x7DE1)
+DOUBLE_BYTE_PAIR(0xE36E, 0x7E05)
+DOUBLE_BYTE_PAIR(0xE36F, 0x7E0A)
+DOUBLE_BYTE_PAIR(0xE370, 0x7E23)
+DOUBLE_BYTE_PAIR(0xE371, 0x7E21)
+DOUBLE_BYTE_PAIR(0xE372, 0x7E12)
+DOUBLE_BYTE_PAIR(0xE373, 0x7E31)
+DOUBLE_BYTE_PAIR(0xE374, 0x7E1F)
+DOUBLE_BYTE_PAIR(0xE375, 0x7E09)
+DOUBLE_BYTE_PAIR(0xE376, 0x7E0B)
+DOUBLE_BYTE_PAIR(0xE377, 0x7E22)
+DOUBLE_BYTE_PAIR(0xE378, 0x7E46)
+DOUBLE_BYTE_PAIR(0xE379, 0x7E66)
+DOUBLE_BYTE_PAIR(0xE37A, 0x7E3B)
+DOUBLE_BYTE_PAIR(0xE37B, 0x7E35)
+DOUBLE_BYTE_PAIR(0xE37C, 0x7E39)
+DOUBLE_BYTE_PAIR(0xE37D, 0x7E43)
+DOUBLE_BYTE_PAIR(0xE37E, 0x7E37)
+DOUBLE_BYTE_PAIR(0xE380, 0x7E32)
+DOUBLE_BYTE_PAIR(0xE381, 0x7E3A)
+DOUBLE_BYTE_PAIR(0xE382, 0x7E67)
+DOUBLE_BYTE_PAIR(0xE383, 0x7E5D)
+DOUBLE_BYTE_PAIR(0xE384, 0x7E56)
+DOUBLE_BYTE_PAIR(0xE385, 0x7E5E)
+DOUBLE_BYTE_PAIR(0xE386, 0x7E59)
+DOUBLE_BYTE_PAIR(0xE387, 0x7E5A)
+DOUBLE_BYTE_PAIR(0xE388, 0x7E79)
+DOUBLE_BYTE_PAIR(0xE389, 0x7E6A)
+DOUBLE_BYTE_PAIR(0xE38A, 0x7E69)
+DOUBLE_BYTE_PAIR(0xE38B, 0x7E7C)
+DOUBLE_BYTE_PAIR(0xE38C, 0x7E7B)
+DOUBLE_BYTE_PAIR(0xE38D, 0x7E83)
+DOUBLE_BYTE_PAIR(0xE38E, 0x7DD5)
+DOUBLE_BYTE_PAIR(0xE38F, 0x7E7D)
+DOUBLE_BYTE_PAIR(0xE390, 0x8FAE)
+DOUBLE_BYTE_PAIR(0xE391, 0x7E7F)
+DOUBLE_BYTE_PAIR(0xE392, 0x7E88)
+DOUBLE_BYTE_PAIR(0xE393, 0x7E89)
+DOUBLE_BYTE_PAIR(0xE394, 0x7E8C)
+DOUBLE_BYTE_PAIR(0xE395, 0x7E92)
+DOUBLE_BYTE_PAIR(0xE396, 0x7E90)
+DOUBLE_BYTE_PAIR(0xE397, 0x7E93)
+DOUBLE_BYTE_PAIR(0xE398, 0x7E94)
+DOUBLE_BYTE_PAIR(0xE399, 0x7E96)
+DOUBLE_BYTE_PAIR(0xE39A, 0x7E8E)
+DOUBLE_BYTE_PAIR(0xE39B, 0x7E9B)
+DOUBLE_BYTE_PAIR(0xE39C, 0x7E9C)
+DOUBLE_BYTE_PAIR(0xE39D, 0x7F38)
+DOUBLE_BYTE_PAIR(0xE39E, 0x7F3A)
+DOUBLE_BYTE_PAIR(0xE39F, 0x7F45)
+DOUBLE_BYTE_PAIR(0xE3A0, 0x7F4C)
+DOUBLE_BYTE_PAIR(0xE3A1, 0x7F4D)
+DOUBLE_BYTE_PAIR(0xE3A2, 0x7F4E)
+DOUBLE_BYTE_PAIR(0xE3A3, 0x7F50)
+DOUBLE_BYTE_PAIR(0xE3A4, 0x7F51)
+DOUBLE_BYTE_PAIR(0xE3A5, 0x7F55)
+DOUBLE_BYTE_PAIR(0xE3A6, 0x7F54)
+DOUBLE_BYTE_PAIR(0xE3A7, 0x7F58)
+DOUBLE_BYTE_PAIR(0xE3A8, 0x7F5F)
+DOUBLE_BYTE_PAIR(0xE3A9, 0x7F60)
+DOUBLE_BYTE_PAIR(0xE3AA, 0x7F68)
+DOUBLE_BYTE_PAIR(0xE3AB, 0x7F69)
+DOUBLE_BYTE_PAIR(0xE3AC, 0x7F67)
+DOUBLE_BYTE_PAIR(0xE3AD, 0x7F78)
+DOUBLE_BYTE_PAIR(0xE3AE, 0x7F82)
+DOUBLE_BYTE_PAIR(0xE3AF, 0x7F86)
+DOUBLE_BYTE_PAIR(0xE3B0, 0x7F83)
+DOUBLE_BYTE_PAIR(0xE3B1, 0x7F88)
+DOUBLE_BYTE_PAIR(0xE3B2, 0x7F87)
+DOUBLE_BYTE_PAIR(0xE3B3, 0x7F8C)
+DOUBLE_BYTE_PAIR(0xE3B4, 0x7F94)
+DOUBLE_BYTE_PAIR(0xE3B5, 0x7F9E)
+DOUBLE_BYTE_PAIR(0xE3B6, 0x7F9D)
+DOUBLE_BYTE_PAIR(0xE3B7, 0x7F9A)
+DOUBLE_BYTE_PAIR(0xE3B8, 0x7FA3)
+DOUBLE_BYTE_PAIR(0xE3B9, 0x7FAF)
+DOUBLE_BYTE_PAIR(0xE3BA, 0x7FB2)
+DOUBLE_BYTE_PAIR(0xE3BB, 0x7FB9)
+DOUBLE_BYTE_PAIR(0xE3BC, 0x7FAE)
+DOUBLE_BYTE_PAIR(0xE3BD, 0x7FB6)
+DOUBLE_BYTE_PAIR(0xE3BE, 0x7FB8)
+DOUBLE_BYTE_PAIR(0xE3BF, 0x8B71)
+DOUBLE_BYTE_PAIR(0xE3C0, 0x7FC5)
+DOUBLE_BYTE_PAIR(0xE3C1, 0x7FC6)
+DOUBLE_BYTE_PAIR(0xE3C2, 0x7FCA)
+DOUBLE_BYTE_PAIR(0xE3C3, 0x7FD5)
+DOUBLE_BYTE_PAIR(0xE3C4, 0x7FD4)
+DOUBLE_BYTE_PAIR(0xE3C5, 0x7FE1)
+DOUBLE_BYTE_PAIR(0xE3C6, 0x7FE6)
+DOUBLE_BYTE_PAIR(0xE3C7, 0x7FE9)
+DOUBLE_BYTE_PAIR(0xE3C8, 0x7FF3)
+DOUBLE_BYTE_PAIR(0xE3C9, 0x7FF9)
+DOUBLE_BYTE_PAIR(0xE3CA, 0x98DC)
+DOUBLE_BYTE_PAIR(0xE3CB, 0x8006)
+DOUBLE_BYTE_PAIR(0xE3CC, 0x8004)
+DOUBLE_BYTE_PAIR(0xE3CD, 0x800B)
+DOUBLE_BYTE_PAIR(0xE3CE, 0x8012)
+DOUBLE_BYTE_PAIR(0xE3CF, 0x8018)
+DOUBLE_BYTE_PAIR(0xE3D0, 0x8019)
+DOUBLE_BYTE_PAIR(0xE3D1, 0x801C)
+DOUBLE_BYTE_PAIR(0xE3D2, 0x8021)
+DOUBLE_BYTE_PAIR(0xE3D3, 0x8028)
+DOUBLE_BYTE_PAIR(0xE3D4, 0x803F)
+DOUBLE_BYTE_PAIR(0xE3D5, 0x803B)
+DOUBLE_BYTE_PAIR(0xE3D6, 0x804A)
+DOUBLE_BYTE_PAIR(0xE3D7, 0x8046)
+DOUBLE_BYTE_PAIR(0xE3D8, 0x8052)
+DOUBLE_BYTE_PAIR(0xE3D9, 0x8058)
+DOUBLE_BYTE_PAIR(0xE3DA, 0x805A)
+DOUBLE_BYTE_PAIR(0xE3DB, 0x805F)
+DOUBLE_BYTE_PAIR(0xE3DC, 0x8062)
+DOUBLE_BYTE_PAIR(0xE3DD, 0x8068)
+DOUBLE_BYTE_PAIR(0xE3DE, 0x8073)
+DOUBLE_BYTE_PAIR(0xE3DF, 0x8072)
+DOUBLE_BYTE_PAIR(0xE3E0, 0x8070)
+DOUBLE_BYTE_PAIR(0xE3E1, 0x8076)
+DOUBLE_BYTE_PAIR(0xE3E2, 0x8079)
+DOUBLE_BYTE_PAIR(0xE3E3, 0x807D)
+DOUBLE_BYTE_PAIR(0xE3E4, 0x807F)
+DOUBLE_BYTE_PAIR(0xE3E5, 0x8084)
+DOUBLE_BYTE_PAIR(0xE3E6, 0x8086)
+DOUBLE_BYTE_PAIR(0xE3E7, 0x8085)
+DOUBLE_BYTE_PAIR(0xE3E8, 0x809B)
+DOUBLE_BYTE_PAIR(0xE3E9, 0x8093)
+DOUBLE_BYTE_PAIR(0xE3EA, 0x809A)
+DOUBLE_BYTE_PAIR(0xE3EB, 0x80AD)
+DOUBLE_BYTE_PAIR(0xE3EC, 0x5190)
+DOUBLE_BYTE_PAIR(0xE3ED, 0x80AC)
+DOUBLE_BYTE_PAIR(0xE3EE, 0x80DB)
+DOUBLE_BYTE_PAIR(0xE3EF, 0x80E5)
+DOUBLE_BYTE_PAIR(0xE3F0, 0x80D9)
+DOUBLE_BYTE_PAIR(0xE3F1, 0x80DD)
+DOUBLE_BYTE_PAIR(0xE3F2, 0x80C4)
+DOUBLE_BYTE_PAIR(0xE3F3, 0x80DA)
+DOUBLE_BYTE_PAIR(0xE3F4, 0x80D6)
+DOUBLE_BYTE_PAIR(0xE3F5, 0x8109)
+DOUBLE_BYTE_PAIR(0xE3F6, 0x80EF)
+DOUBLE_BYTE_PAIR(0xE3F7, 0x80F1)
+DOUBLE_BYTE_PAIR(0xE3F8, 0x811B)
+DOUBLE_BYTE_PAIR(0xE3F9, 0x8129)
+DOUBLE_BYTE_PAIR(0xE3FA, 0x8123)
+DOUBLE_BYTE_PAIR(0xE3FB, 0x812F)
+DOUBLE_BYTE_PAIR(0xE3FC, 0x814B)
+DOUBLE_BYTE_PAIR(0xE440, 0x968B)
+DOUBLE_BYTE_PAIR(0xE441, 0x8146)
+DOUBLE_BYTE_PAIR(0xE442, 0x813E)
+DOUBLE_BYTE_PAIR(0xE443, 0x8153)
+DOUBLE_BYTE_PAIR(0xE444, 0x8151)
+DOUBLE_BYTE_PAIR(0xE445, 0x80FC)
+DOUBLE_BYTE_PAIR(0xE446, 0x8171)
+DOUBLE_BYTE_PAIR(0xE447, 0x816E)
+DOUBLE_BYTE_PAIR(0xE448, 0x8165)
+DOUBLE_BYTE_PAIR(0xE449, 0x8166)
+DOUBLE_BYTE_PAIR(0xE44A, 0x8174)
+DOUBLE_BYTE_PAIR(0xE44B, 0x8183)
+DOUBLE_BYTE_PAIR(0xE44C, 0x8188)
+DOUBLE_BYTE_PAIR(0xE44D, 0x818A)
+DOUBLE_BYTE_PAIR(0xE44E, 0x8180)
+DOUBLE_BYTE_PAIR(0xE44F, 0x8182)
+DOUBLE_BYTE_PAIR(0xE450, 0x81A0)
+DOUBLE_BYTE_PAIR(0xE451, 0x8195)
+DOUBLE_BYTE_PAIR(0xE452, 0x81A4)
+DOUBLE_BYTE_PAIR(0xE453, 0x81A3)
+DOUBLE_BYTE_PAIR(0xE454, 0x815F)
+DOUBLE_BYTE_PAIR(0xE455, 0x8193)
+DOUBLE_BYTE_PAIR(0xE456, 0x81A9)
+DOUBLE_BYTE_PAIR(0xE457, 0x81B0)
+DOUBLE_BYTE_PAIR(0xE458, 0x81B5)
+DOUBLE_BYTE_PAIR(0xE459, 0x81BE)
+DOUBLE_BYTE_PAIR(0xE45A, 0x81B8)
+DOUBLE_BYTE_PAIR(0xE45B, 0x81BD)
+DOUBLE_BYTE_PAIR(0xE45C, 0x81C0)
+DOUBLE_BYTE_PAIR(0xE45D, 0x81C2)
+DOUBLE_BYTE_PAIR(0xE45E, 0x81BA)
+DOUBLE_BYTE_PAIR(0xE45F, 0x81C9)
+DOUBLE_BYTE_PAIR(0xE460, 0x81CD)
+DOUBLE_BYTE_PAIR(0xE461, 0x81D1)
+DOUBLE_BYTE_PAIR(0xE462, 0x81D9)
+DOUBLE_BYTE_PAIR(0xE463, 0x81D8)
+DOUBLE_BYTE_PAIR(0xE464, 0x81C8)
+DOUBLE_BYTE_PAIR(0xE465, 0x81DA)
+DOUBLE_BYTE_PAIR(0xE466, 0x81DF)
+DOUBLE_BYTE_PAIR(0xE467, 0x81E0)
+DOUBLE_BYTE_PAIR(0xE468, 0x81E7)
+DOUBLE_BYTE_PAIR(0xE469, 0x81FA)
+DOUBLE_BYTE_PAIR(0xE46A, 0x81FB)
+DOUBLE_BYTE_PAIR(0xE46B, 0x81FE)
+DOUBLE_BYTE_PAIR(0xE46C, 0x8201)
+DOUBLE_BYTE_PAIR(0xE46D, 0x8202)
+DOUBLE_BYTE_PAIR(0xE46E, 0x8205)
+DOUBLE_BYTE_PAIR(0xE46F, 0x8207)
+DOUBLE_BYTE_PAIR(0xE470, 0x820A)
+DOUBLE_BYTE_PAIR(0xE471, 0x820D)
+DOUBLE_BYTE_PAIR(0xE472, 0x8210)
+DOUBLE_BYTE_PAIR(0xE473, 0x8216)
+DOUBLE_BYTE_PAIR(0xE474, 0x8229)
+DOUBLE_BYTE_PAIR(0xE475, 0x822B)
+DOUBLE_BYTE_PAIR(0xE476, 0x8238)
+DOUBLE_BYTE_PAIR(0xE477, 0x8233)
+DOUBLE_BYTE_PAIR(0xE478, 0x8240)
+DOUBLE_BYTE_PAIR(0xE479, 0x8259)
+DOUBLE_BYTE_PAIR(0xE47A, 0x8258)
+DOUBLE_BYTE_PAIR(0xE47B, 0x825D)
+DOUBLE_BYTE_PAIR(0xE47C, 0x825A)
+DOUBLE_BYTE_PAIR(0xE47D, 0x825F)
+DOUBLE_BYTE_PAIR(0xE47E, 0x8264)
+DOUBLE_BYTE_PAIR(0xE480, 0x8262)
+DOUBLE_BYTE_PAIR(0xE481, 0x8268)
+DOUBLE_BYTE_PAIR(0xE482, 0x826A)
+DOUBLE_BYTE_PAIR(0xE483, 0x826B)
+DOUBLE_BYTE_PAIR(0xE484, 0x822E)
+DOUBLE_BYTE_PAIR(0xE485, 0x8271)
+DOUBLE_BYTE_PAIR(0xE486, 0x8277)
+DOUBLE_BYTE_PAIR(0xE487, 0x8278)
+DOUBLE_BYTE_PAIR(0xE488, 0x827E)
+DOUBLE_BYTE_PAIR(0xE489, 0x828D)
+DOUBLE_BYTE_PAIR(0xE48A, 0x8292)
+DOUBLE_BYTE_PAIR(0xE48B, 0x82AB)
+DOUBLE_BYTE_PAIR(0xE48C, 0x829F)
+DOUBLE_BYTE_PAIR(0xE48D, 0x82BB)
+DOUBLE_BYTE_PAIR(0xE48E, 0x82AC)
+DOUBLE_BYTE_PAIR(0xE48F, 0x82E1)
+DOUBLE_BYTE_PAIR(0xE490, 0x82E3)
+DOUBLE_BYTE_PAIR(0xE491, 0x82DF)
+DOUBLE_BYTE_PAIR(0xE492, 0x82D2)
+DOUBLE_BYTE_PAIR(0xE493, 0x82F4)
+DOUBLE_BYTE_PAIR(0xE494, 0x82F3)
+DOUBLE_BYTE_PAIR(0xE495, 0x82FA)
+DOUBLE_BYTE_PAIR(0xE496, 0x8393)
+DOUBLE_BYTE_PAIR(0xE497, 0x8303)
+DOUBLE_BYTE_PAIR(0xE498, 0x82FB)
+DOUBLE_BYTE_PAIR(0xE499, 0x82F9)
+DOUBLE_BYTE_PAIR(0xE49A, 0x82DE)
+DOUBLE_BYTE_PAIR(0xE49B, 0x8306)
+DOUBLE_BYTE_PAIR(0xE49C, 0x82DC)
+DOUBLE_BYTE_PAIR(0xE49D, 0x8309)
+DOUBLE_BYTE_PAIR(0xE49E, 0x82D9)
+DOUBLE_BYTE_PAIR(0xE49F, 0x8335)
+DOUBLE_BYTE_PAIR(0xE4A0, 0x8334)
+DOUBLE_BYTE_PAIR(0xE4A1, 0x8316)
+DOUBLE_BYTE_PAIR(0xE4A2, 0x8332)
+DOUBLE_BYTE_PAIR(0xE4A3, 0x8331)
+DOUBLE_BYTE_PAIR(0xE4A4, 0x8340)
+DOUBLE_BYTE_PAIR(0xE4A5, 0x8339)
+DOUBLE_BYTE_PAIR(0xE4A6, 0x8350)
+DOUBLE_BYTE_PAIR(0xE4A7, 0x8345)
+DOUBLE_BYTE_PAIR(0xE4A8, 0x832F)
+DOUBLE_BYTE_PAIR(0xE4A9, 0x832B)
+DOUBLE_BYTE_PAIR(0xE4AA, 0x8317)
+DOUBLE_BYTE_PAIR(0xE4AB, 0x8318)
+DOUBLE_BYTE_PAIR(0xE4AC, 0x8385)
+DOUBLE_BYTE_PAIR(0xE4AD, 0x839A)
+DOUBLE_BYTE_PAIR(0xE4AE, 0x83AA)
+DOUBLE_BYTE_PAIR(0xE4AF, 0x839F)
+DOUBLE_BYTE_PAIR(0xE4B0, 0x83A2)
+DOUBLE_BYTE_PAIR(0xE4B1, 0x8396)
+DOUBLE_BYTE_PAIR(0xE4B2, 0x8323)
+DOUBLE_BYTE_PAIR(0xE4B3, 0x838E)
+DOUBLE_BYTE_PAIR(0xE4B4, 0x8387)
+DOUBLE_BYTE_PAIR(0xE4B5, 0x838A)
+DOUBLE_BYTE_PAIR(0xE4B6, 0x837C)
+DOUBLE_BYTE_PAIR(0xE4B7, 0x83B5)
+DOUBLE_BYTE_PAIR(0xE4B8, 0x8373)
+DOUBLE_BYTE_PAIR(0xE4B9, 0x8375)
+DOUBLE_BYTE_PAIR(0xE4BA, 0x83A0)
+DOUBLE_BYTE_PAIR(0xE4BB, 0x8389)
+DOUBLE_BYTE_PAIR(0xE4BC, 0x83A8)
+DOUBLE_BYTE_PAIR(0xE4BD, 0x83F4)
+DOUBLE_BYTE_PAIR(0xE4BE, 0x8413)
+DOUBLE_BYTE_PAIR(0xE4BF, 0x83EB)
+DOUBLE_BYTE_PAIR(0xE4C0, 0x83CE)
+DOUBLE_BYTE_PAIR(0xE4C1, 0x83FD)
+DOUBLE_BYTE_PAIR(0xE4C2, 0x8403)
+DOUBLE_BYTE_PAIR(0xE4C3, 0x83D8)
+DOUBLE_BYTE_PAIR(0xE4C4, 0x840B)
+DOUBLE_BYTE_PAIR(0xE4C5, 0x83C1)
+DOUBLE_BYTE_PAIR(0xE4C6, 0x83F7)
+DOUBLE_BYTE_PAIR(0xE4C7, 0x8407)
+DOUBLE_BYTE_PAIR(0xE4C8, 0x83E0)
+DOUBLE_BYTE_PAIR(0xE4C9, 0x83F2)
+DOUBLE_BYTE_PAIR(0xE4CA, 0x840D)
+DOUBLE_BYTE_PAIR(0xE4CB, 0x8422)
+DOUBLE_BYTE_PAIR(0xE4CC, 0x8420)
+DOUBLE_BYTE_PAIR(0xE4CD, 0x83BD)
+DOUBLE_BYTE_PAIR(0xE4CE, 0x8438)
+DOUBLE_BYTE_PAIR(0xE4CF, 0x8506)
+DOUBLE_BYTE_PAIR(0xE4D0, 0x83FB)
+DOUBLE_BYTE_PAIR(0xE4D1, 0x846D)
+DOUBLE_BYTE_PAIR(0xE4D2, 0x842A)
+DOUBLE_BYTE_PAIR(0xE4D3, 0x843C)
+DOUBLE_BYTE_PAIR(0xE4D4, 0x855A)
+DOUBLE_BYTE_PAIR(0xE4D5, 0x8484)
+DOUBLE_BYTE_PAIR(0xE4D6, 0x8477)
+DOUBLE_BYTE_PAIR(0xE4D7, 0x846B)
+DOUBLE_BYTE_PAIR(0xE4D8, 0x84AD)
+DOUBLE_BYTE_PAIR(0xE4D9, 0x846E)
+DOUBLE_BYTE_PAIR(0xE4DA, 0x8482)
+DOUBLE_BYTE_PAIR(0xE4DB, 0x8469)
+DOUBLE_BYTE_PAIR(0xE4DC, 0x8446)
+DOUBLE_BYTE_PAIR(0xE4DD, 0x842C)
+DOUBLE_BYTE_PAIR(0xE4DE, 0x846F)
+DOUBLE_BYTE_PAIR(0xE4DF, 0x8479)
+DOUBLE_BYTE_PAIR(0xE4E0, 0x8435)
+DOUBLE_BYTE_PAIR(0xE4E1, 0x84CA)
+DOUBLE_BYTE_PAIR(0xE4E2, 0x8462)
+DOUBLE_BYTE_PAIR(0xE4E3, 0x84B9)
+DOUBLE_BYTE_PAIR(0xE4E4, 0x84BF)
+DOUBLE_BYTE_PAIR(0xE4E5, 0x849F)
+DOUBLE_BYTE_PAIR(0xE4E6, 0x84D9)
+DOUBLE_BYTE_PAIR(0xE4E7, 0x84CD)
+DOUBLE_BYTE_PAIR(0xE4E8, 0x84BB)
+DOUBLE_BYTE_PAIR(0xE4E9, 0x84DA)
+DOUBLE_BYTE_PAIR(0xE4EA, 0x84D0)
+DOUBLE_BYTE_PAIR(0xE4EB, 0x84C1)
+DOUBLE_BYTE_PAIR(0xE4EC, 0x84C6)
+DOUBLE_BYTE_PAIR(0xE4ED, 0x84D6)
+DOUBLE_BYTE_PAIR(0xE4EE, 0x84A1)
+DOUBLE_BYTE_PAIR(0xE4EF, 0x8521)
+DOUBLE_BYTE_PAIR(0xE4F0, 0x84FF)
+DOUBLE_BYTE_PAIR(0xE4F1, 0x84F4)
+DOUBLE_BYTE_PAIR(0xE4F2, 0x8517)
+DOUBLE_BYTE_PAIR(0xE4F3, 0x8518)
+DOUBLE_BYTE_PAIR(0xE4F4, 0x852C)
+DOUBLE_BYTE_PAIR(0xE4F5, 0x851F)
+DOUBLE_BYTE_PAIR(0xE4F6, 0x8515)
+DOUBLE_BYTE_PAIR(0xE4F7, 0x8514)
+DOUBLE_BYTE_PAIR(0xE4F8, 0x84FC)
+DOUBLE_BYTE_PAIR(0xE4F9, 0x8540)
+DOUBLE_BYTE_PAIR(0xE4FA, 0x8563)
+DOUBLE_BYTE_PAIR(0xE4FB, 0x8558)
+DOUBLE_BYTE_PAIR(0xE4FC, 0x8548)
+DOUBLE_BYTE_PAIR(0xE540, 0x8541)
+DOUBLE_BYTE_PAIR(0xE541, 0x8602)
+DOUBLE_BYTE_PAIR(0xE542, 0x854B)
+DOUBLE_BYTE_PAIR(0xE543, 0x8555)
+DOUBLE_BYTE_PAIR(0xE544, 0x8580)
+DOUBLE_BYTE_PAIR(0xE545, 0x85A4)
+DOUBLE_BYTE_PAIR(0xE546, 0x8588)
+DOUBLE_BYTE_PAIR(0xE547, 0x8591)
+DOUBLE_BYTE_PAIR(0xE548, 0x858A)
+DOUBLE_BYTE_PAIR(0xE549, 0x85A8)
+DOUBLE_BYTE_PAIR(0xE54A, 0x856D)
+DOUBLE_BYTE_PAIR(0xE54B, 0x8594)
+DOUBLE_BYTE_PAIR(0xE54C, 0x859B)
+DOUBLE_BYTE_PAIR(0xE54D, 0x85EA)
+DOUBLE_BYTE_PAIR(0xE54E, 0x8587)
+DOUBLE_BYTE_PAIR(0xE54F, 0x859C)
+DOUBLE_BYTE_PAIR(0xE550, 0x8577)
+DOUBLE_BYTE_PAIR(0xE551, 0x857E)
+DOUBLE_BYTE_PAIR(0xE552, 0x8590)
+DOUBLE_BYTE_PAIR(0xE553, 0x85C9)
+DOUBLE_BYTE_PAIR(0xE554, 0x85BA)
+DOUBLE_BYTE_PAIR(0xE555, 0x85CF)
+DOUBLE_BYTE_PAIR(0xE556, 0x85B9)
+DOUBLE_BYTE_PAIR(0xE557, 0x85D0)
+DOUBLE_BYTE_PAIR(0xE558, 0x85D5)
+DOUBLE_BYTE_PAIR(0xE559, 0x85DD)
+DOUBLE_BYTE_PAIR(0xE55A, 0x85E5)
+DOUBLE_BYTE_PAIR(0xE55B, 0x85DC)
+DOUBLE_BYTE_PAIR(0xE55C, 0x85F9)
+DOUBLE_BYTE_PAIR(0xE55D, 0x860A)
+DOUBLE_BYTE_PAIR(0xE55E, 0x8613)
+DOUBLE_BYTE_PAIR(0xE55F, 0x860B)
+DOUBLE_BYTE_PAIR(0xE560, 0x85FE)
+DOUBLE_BYTE_PAIR(0xE561, 0x85FA)
+DOUBLE_BYTE_PAIR(0xE562, 0x8606)
+DOUBLE_BYTE_PAIR(0xE563, 0x8622)
+DOUBLE_BYTE_PAIR(0xE564, 0x861A)
+DOUBLE_BYTE_PAIR(0xE565, 0x8630)
+DOUBLE_BYTE_PAIR(0xE566, 0x863F)
+DOUBLE_BYTE_PAIR(0xE567, 0x864D)
+DOUBLE_BYTE_PAIR(0xE568, 0x4E55)
+DOUBLE_BYTE_PAIR(0xE569, 0x8654)
+DOUBLE_BYTE_PAIR(0xE56A, 0x865F)
+DOUBLE_BYTE_PAIR(0xE56B, 0x8667)
+DOUBLE_BYTE_PAIR(0xE56C, 0x8671)
+DOUBLE_BYTE_PAIR(0xE56D, 0x8693)
+DOUBLE_BYTE_PAIR(0xE56E, 0x86A3)
+DOUBLE_BYTE_PAIR(0xE56F, 0x86A9)
+DOUBLE_BYTE_PAIR(0xE570, 0x86AA)
+DOUBLE_BYTE_PAIR(0xE571, 0x868B)
+DOUBLE_BYTE_PAIR(0xE572, 0x868C)
+DOUBLE_BYTE_PAIR(0xE573, 0x86B6)
+DOUBLE_BYTE_PAIR(0xE574, 0x86AF)
+DOUBLE_BYTE_PAIR(0xE575, 0x86C4)
+DOUBLE_BYTE_PAIR(0xE576, 0x86C6)
+DOUBLE_BYTE_PAIR(0xE577, 0x86B0)
+DOUBLE_BYTE_PAIR(0xE578, 0x86C9)
+DOUBLE_BYTE_PAIR(0xE579, 0x8823)
+DOUBLE_BYTE_PAIR(0xE57A, 0x86AB)
+DOUBLE_BYTE_PAIR(0xE57B, 0x86D4)
+DOUBLE_BYTE_PAIR(0xE57C, 0x86DE)
+DOUBLE_BYTE_PAIR(0xE57D, 0x86E9)
+DOUBLE_BYTE_PAIR(0xE57E, 0x86EC)
+DOUBLE_BYTE_PAIR(0xE580, 0x86DF)
+DOUBLE_BYTE_PAIR(0xE581, 0x86DB)
+DOUBLE_BYTE_PAIR(0xE582, 0x86EF)
+DOUBLE_BYTE_PAIR(0xE583, 0x8712)
+DOUBLE_BYTE_PAIR(0xE584, 0x8706)
+DOUBLE_BYTE_PAIR(0xE585, 0x8708)
+DOUBLE_BYTE_PAIR(0xE586, 0x8700)
+DOUBLE_BYTE_PAIR(0xE587, 0x8703)
+DOUBLE_BYTE_PAIR(0xE588, 0x86FB)
+DOUBLE_BYTE_PAIR(0xE589, 0x8711)
+DOUBLE_BYTE_PAIR(0xE58A, 0x8709)
+DOUBLE_BYTE_PAIR(0xE58B, 0x870D)
+DOUBLE_BYTE_PAIR(0xE58C, 0x86F9)
+DOUBLE_BYTE_PAIR(0xE58D, 0x870A)
+DOUBLE_BYTE_PAIR(0xE58E, 0x8734)
+DOUBLE_BYTE_PAIR(0xE58F, 0x873F)
+DOUBLE_BYTE_PAIR(0xE590, 0x8737)
+DOUBLE_BYTE_PAIR(0xE591, 0x873B)
+DOUBLE_BYTE_PAIR(0xE592, 0x8725)
+DOUBLE_BYTE_PAIR(0xE593, 0x8729)
+DOUBLE_BYTE_PAIR(0xE594, 0x871A)
+DOUBLE_BYTE_PAIR(0xE595, 0x8760)
+DOUBLE_BYTE_PAIR(0xE596, 0x875F)
+DOUBLE_BYTE_PAIR(0xE597, 0x8778)
+DOUBLE_BYTE_PAIR(0xE598, 0x874C)
+DOUBLE_BYTE_PAIR(0xE599, 0x874E)
+DOUBLE_BYTE_PAIR(0xE59A, 0x8774)
+DOUBLE_BYTE_PAIR(0xE59B, 0x8757)
+DOUBLE_BYTE_PAIR(0xE59C, 0x8768)
+DOUBLE_BYTE_PAIR(0xE59D, 0x876E)
+DOUBLE_BYTE_PAIR(0xE59E, 0x8759)
+DOUBLE_BYTE_PAIR(0xE59F, 0x8753)
+DOUBLE_BYTE_PAIR(0xE5A0, 0x8763)
+DOUBLE_BYTE_PAIR(0xE5A1, 0x876A)
+DOUBLE_BYTE_PAIR(0xE5A2, 0x8805)
+DOUBLE_BYTE_PAIR(0xE5A3, 0x87A2)
+DOUBLE_BYTE_PAIR(0xE5A4, 0x879F)
+DOUBLE_BYTE_PAIR(0xE5A5, 0x8782)
+DOUBLE_BYTE_PAIR(0xE5A6, 0x87AF)
+DOUBLE_BYTE_PAIR(0xE5A7, 0x87CB)
+DOUBLE_BYTE_PAIR(0xE5A8, 0x87BD)
+DOUBLE_BYTE_PAIR(0xE5A9, 0x87C0)
+DOUBLE_BYTE_PAIR(0xE5AA, 0x87D0)
+DOUBLE_BYTE_PAIR(0xE5AB, 0x96D6)
+DOUBLE_BYTE_PAIR(0xE5AC, 0x87AB)
+DOUBLE_BYTE_PAIR(0xE5AD, 0x87C4)
+DOUBLE_BYTE_PAIR(0xE5AE, 0x87B3)
+DOUBLE_BYTE_PAIR(0xE5AF, 0x87C7)
+DOUBLE_BYTE_PAIR(0xE5B0, 0x87C6)
+DOUBLE_BYTE_PAIR(0xE5B1, 0x87BB)
+DOUBLE_BYTE_PAIR(0xE5B2, 0x87EF)
+DOUBLE_BYTE_PAIR(0xE5B3, 0x87F2)
+DOUBLE_BYTE_PAIR(0xE5B4, 0x87E0)
+DOUBLE_BYTE_PAIR(0xE5B5, 0x880F)
+DOUBLE_BYTE_PAIR(0xE5B6, 0x880D)
+DOUBLE_BYTE_PAIR(0xE5B7, 0x87FE)
+DOUBLE_BYTE_PAIR(0xE5B8, 0x87F6)
+DOUBLE_BYTE_PAIR(0xE5B9, 0x87F7)
+DOUBLE_BYTE_PAIR(0xE5BA, 0x880E)
+DOUBLE_BYTE_PAIR(0xE5BB, 0x87D2)
+DOUBLE_BYTE_PAIR(0xE5BC, 0x8811)
+DOUBLE_BYTE_PAIR(0xE5BD, 0x8816)
+DOUBLE_BYTE_PAIR(0xE5BE, 0x8815)
+DOUBLE_BYTE_PAIR(0xE5BF, 0x8822)
+DOUBLE_BYTE_PAIR(0xE5C0, 0x8821)
+DOUBLE_BYTE_PAIR(0xE5C1, 0x8831)
+DOUBLE_BYTE_PAIR(0xE5C2, 0x8836)
+DOUBLE_BYTE_PAIR(0xE5C3, 0x8839)
+DOUBLE_BYTE_PAIR(0xE5C4, 0x8827)
+DOUBLE_BYTE_PAIR(0xE5C5, 0x883B)
+DOUBLE_BYTE_PAIR(0xE5C6, 0x8844)
+DOUBLE_BYTE_PAIR(0xE5C7, 0x8842)
+DOUBLE_BYTE_PAIR(0xE5C8, 0x8852)
+DOUBLE_BYTE_PAIR(0xE5C9, 0x8859)
+DOUBLE_BYTE_PAIR(0xE5CA, 0x885E)
+DOUBLE_BYTE_PAIR(0xE5CB, 0x8862)
+DOUBLE_BYTE_PAIR(0xE5CC, 0x886B)
+DOUBLE_BYTE_PAIR(0xE5CD, 0x8881)
+DOUBLE_BYTE_PAIR(0xE5CE, 0x887E)
+DOUBLE_BYTE_PAIR(0xE5CF, 0x889E)
+DOUBLE_BYTE_PAIR(0xE5D0, 0x8875)
+DOUBLE_BYTE_PAIR(0xE5D1, 0x887D)
+DOUBLE_BYTE_PAIR(0xE5D2, 0x88B5)
+DOUBLE_BYTE_PAIR(0xE5D3, 0x8872)
+DOUBLE_BYTE_PAIR(0xE5D4, 0x8882)
+DOUBLE_BYTE_PAIR(0xE5D5, 0x8897)
+DOUBLE_BYTE_PAIR(0xE5D6, 0x8892)
+DOUBLE_BYTE_PAIR(0xE5D7, 0x88AE)
+DOUBLE_BYTE_PAIR(0xE5D8, 0x8899)
+DOUBLE_BYTE_PAIR(0xE5D9, 0x88A2)
+DOUBLE_BYTE_PAIR(0xE5DA, 0x888D)
+DOUBLE_BYTE_PAIR(0xE5DB, 0x88A4)
+DOUBLE_BYTE_PAIR(0xE5DC, 0x88B0)
+DOUBLE_BYTE_PAIR(0xE5DD, 0x88BF)
+DOUBLE_BYTE_PAIR(0xE5DE, 0x88B1)
+DOUBLE_BYTE_PAIR(0xE5DF, 0x88C3)
+DOUBLE_BYTE_PAIR(0xE5E0, 0x88C4)
+DOUBLE_BYTE_PAIR(0xE5E1, 0x88D4)
+DOUBLE_BYTE_PAIR(0xE5E2, 0x88D8)
+DOUBLE_BYTE_PAIR(0xE5E3, 0x88D9)
+DOUBLE_BYTE_PAIR(0xE5E4, 0x88DD)
+DOUBLE_BYTE_PAIR(0xE5E5, 0x88F9)
+DOUBLE_BYTE_PAIR(0xE5E6, 0x8902)
+DOUBLE_BYTE_PAIR(0xE5E7, 0x88FC)
+DOUBLE_BYTE_PAIR(0xE5E8, 0x88F4)
+DOUBLE_BYTE_PAIR(0xE5E9, 0x88E8)
+DOUBLE_BYTE_PAIR(0xE5EA, 0x88F2)
+DOUBLE_BYTE_PAIR(0xE5EB, 0x8904)
+DOUBLE_BYTE_PAIR(0xE5EC, 0x890C)
+DOUBLE_BYTE_PAIR(0xE5ED, 0x890A)
+DOUBLE_BYTE_PAIR(0xE5EE, 0x8913)
+DOUBLE_BYTE_PAIR(0xE5EF, 0x8943)
+DOUBLE_BYTE_PAIR(0xE5F0, 0x891E)
+DOUBLE_BYTE_PAIR(0xE5F1, 0x8925)
+DOUBLE_BYTE_PAIR(0xE5F2, 0x892A)
+DOUBLE_BYTE_PAIR(0xE5F3, 0x892B)
+DOUBLE_BYTE_PAIR(0xE5F4, 0x8941)
+DOUBLE_BYTE_PAIR(0xE5F5, 0x8944)
+DOUBLE_BYTE_PAIR(0xE5F6, 0x893B)
+DOUBLE_BYTE_PAIR(0xE5F7, 0x8936)
+DOUBLE_BYTE_PAIR(0xE5F8, 0x8938)
+DOUBLE_BYTE_PAIR(0xE5F9, 0x894C)
+DOUBLE_BYTE_PAIR(0xE5FA, 0x891D)
+DOUBLE_BYTE_PAIR(0xE5FB, 0x8960)
+DOUBLE_BYTE_PAIR(0xE5FC, 0x895E)
+DOUBLE_BYTE_PAIR(0xE640, 0x8966)
+DOUBLE_BYTE_PAIR(0xE641, 0x8964)
+DOUBLE_BYTE_PAIR(0xE642, 0x896D)
+DOUBLE_BYTE_PAIR(0xE643, 0x896A)
+DOUBLE_BYTE_PAIR(0xE644, 0x896F)
+DOUBLE_BYTE_PAIR(0xE645, 0x8974)
+DOUBLE_BYTE_PAIR(0xE646, 0x8977)
+DOUBLE_BYTE_PAIR(0xE647, 0x897E)
+DOUBLE_BYTE_PAIR(0xE648, 0x8983)
+DOUBLE_BYTE_PAIR(0xE649, 0x8988)
+DOUBLE_BYTE_PAIR(0xE64A, 0x898A)
+DOUBLE_BYTE_PAIR(0xE64B, 0x8993)
+DOUBLE_BYTE_PAIR(0xE64C, 0x8998)
+DOUBLE_BYTE_PAIR(0xE64D, 0x89A1)
+DOUBLE_BYTE_PAIR(0xE64E, 0x89A9)
+DOUBLE_BYTE_PAIR(0xE64F, 0x89A6)
+DOUBLE_BYTE_PAIR(0xE650, 0x89AC)
+DOUBLE_BYTE_PAIR(0xE651, 0x89AF)
+DOUBLE_BYTE_PAIR(0xE652, 0x89B2)
+DOUBLE_BYTE_PAIR(0xE653, 0x89BA)
+DOUBLE_BYTE_PAIR(0xE654, 0x89BD)
+DOUBLE_BYTE_PAIR(0xE655, 0x89BF)
+DOUBLE_BYTE_PAIR(0xE656, 0x89C0)
+DOUBLE_BYTE_PAIR(0xE657, 0x89DA)
+DOUBLE_BYTE_PAIR(0xE658, 0x89DC)
+DOUBLE_BYTE_PAIR(0xE659, 0x89DD)
+DOUBLE_BYTE_PAIR(0xE65A, 0x89E7)
+DOUBLE_BYTE_PAIR(0xE65B, 0x89F4)
+DOUBLE_BYTE_PAIR(0xE65C, 0x89F8)
+DOUBLE_BYTE_PAIR(0xE65D, 0x8A03)
+DOUBLE_BYTE_PAIR(0xE65E, 0x8A16)
+DOUBLE_BYTE_PAIR(0xE65F, 0x8A10)
+DOUBLE_BYTE_PAIR(0xE660, 0x8A0C)
+DOUBLE_BYTE_PAIR(0xE661, 0x8A1B)
+DOUBLE_BYTE_PAIR(0xE662, 0x8A1D)
+DOUBLE_BYTE_PAIR(0xE663, 0x8A25)
+DOUBLE_BYTE_PAIR(0xE664, 0x8A36)
+DOUBLE_BYTE_PAIR(0xE665, 0x8A41)
+DOUBLE_BYTE_PAIR(0xE666, 0x8A5B)
+DOUBLE_BYTE_PAIR(0xE667, 0x8A52)
+DOUBLE_BYTE_PAIR(0xE668, 0x8A46)
+DOUBLE_BYTE_PAIR(0xE669, 0x8A48)
+DOUBLE_BYTE_PAIR(0xE66A, 0x8A7C)
+DOUBLE_BYTE_PAIR(0xE66B, 0x8A6D)
+DOUBLE_BYTE_PAIR(0xE66C, 0x8A6C)
+DOUBLE_BYTE_PAIR(0xE66D, 0x8A62)
+DOUBLE_BYTE_PAIR(0xE66E, 0x8A85)
+DOUBLE_BYTE_PAIR(0xE66F, 0x8A82)
+DOUBLE_BYTE_PAIR(0xE670, 0x8A84)
+DOUBLE_BYTE_PAIR(0xE671, 0x8AA8)
+DOUBLE_BYTE_PAIR(0xE672, 0x8AA1)
+DOUBLE_BYTE_PAIR(0xE673, 0x8A91)
+DOUBLE_BYTE_PAIR(0xE674, 0x8AA5)
+DOUBLE_BYTE_PAIR(0xE675, 0x8AA6)
+DOUBLE_BYTE_PAIR(0xE676, 0x8A9A)
+DOUBLE_BYTE_PAIR(0xE677, 0x8AA3)
+DOUBLE_BYTE_PAIR(0xE678, 0x8AC4)
+DOUBLE_BYTE_PAIR(0xE679, 0x8ACD)
+DOUBLE_BYTE_PAIR(0xE67A, 0x8AC2)
+DOUBLE_BYTE_PAIR(0xE67B, 0x8ADA)
+DOUBLE_BYTE_PAIR(0xE67C, 0x8AEB)
+DOUBLE_BYTE_PAIR(0xE67D, 0x8AF3)
+DOUBLE_BYTE_PAIR(0xE67E, 0x8AE7)
+DOUBLE_BYTE_PAIR(0xE680, 0x8AE4)
+DOUBLE_BYTE_PAIR(0xE681, 0x8AF1)
+DOUBLE_BYTE_PAIR(0xE682, 0x8B14)
+DOUBLE_BYTE_PAIR(0xE683, 0x8AE0)
+DOUBLE_BYTE_PAIR(0xE684, 0x8AE2)
+DOUBLE_BYTE_PAIR(0xE685, 0x8AF7)
+DOUBLE_BYTE_PAIR(0xE686, 0x8ADE)
+DOUBLE_BYTE_PAIR(0xE687, 0x8ADB)
+DOUBLE_BYTE_PAIR(0xE688, 0x8B0C)
+DOUBLE_BYTE_PAIR(0xE689, 0x8B07)
+DOUBLE_BYTE_PAIR(0xE68A, 0x8B1A)
+DOUBLE_BYTE_PAIR(0xE68B, 0x8AE1)
+DOUBLE_BYTE_PAIR(0xE68C, 0x8B16)
+DOUBLE_BYTE_PAIR(0xE68D, 0x8B10)
+DOUBLE_BYTE_PAIR(0xE68E, 0x8B17)
+DOUBLE_BYTE_PAIR(0xE68F, 0x8B20)
+DOUBLE_BYTE_PAIR(0xE690, 0x8B33)
+DOUBLE_BYTE_PAIR(0xE691, 0x97AB)
+DOUBLE_BYTE_PAIR(0xE692, 0x8B26)
+DOUBLE_BYTE_PAIR(0xE693, 0x8B2B)
+DOUBLE_BYTE_PAIR(0xE694, 0x8B3E)
+DOUBLE_BYTE_PAIR(0xE695, 0x8B28)
+DOUBLE_BYTE_PAIR(0xE696, 0x8B41)
+DOUBLE_BYTE_PAIR(0xE697, 0x8B4C)
+DOUBLE_BYTE_PAIR(0xE698, 0x8B4F)
+DOUBLE_BYTE_PAIR(0xE699, 0x8B4E)
+DOUBLE_BYTE_PAIR(0xE69A, 0x8B49)
+DOUBLE_BYTE_PAIR(0xE69B, 0x8B56)
+DOUBLE_BYTE_PAIR(0xE69C, 0x8B5B)
+DOUBLE_BYTE_PAIR(0xE69D, 0x8B5A)
+DOUBLE_BYTE_PAIR(0xE69E, 0x8B6B)
+DOUBLE_BYTE_PAIR(0xE69F, 0x8B5F)
+DOUBLE_BYTE_PAIR(0xE6A0, 0x8B6C)
+DOUBLE_BYTE_PAIR(0xE6A1, 0x8B6F)
+DOUBLE_BYTE_PAIR(0xE6A2, 0x8B74)
+DOUBLE_BYTE_PAIR(0xE6A3, 0x8B7D)
+DOUBLE_BYTE_PAIR(0xE6A4, 0x8B80)
+DOUBLE_BYTE_PAIR(0xE6A5, 0x8B8C)
+DOUBLE_BYTE_PAIR(0xE6A6, 0x8B8E)
+DOUBLE_BYTE_PAIR(0xE6A7, 0x8B92)
+DOUBLE_BYTE_PAIR(0xE6A8, 0x8B93)
+DOUBLE_BYTE_PAIR(0xE6A9, 0x8B96)
+DOUBLE_BYTE_PAIR(0xE6AA, 0x8B99)
+DOUBLE_BYTE_PAIR(0xE6AB, 0x8B9A)
+DOUBLE_BYTE_PAIR(0xE6AC, 0x8C3A)
+DOUBLE_BYTE_PAIR(0xE6AD, 0x8C41)
+DOUBLE_BYTE_PAIR(0xE6AE, 0x8C3F)
+DOUBLE_BYTE_PAIR(0xE6AF, 0x8C48)
+DOUBLE_BYTE_PAIR(0xE6B0, 0x8C4C)
+DOUBLE_BYTE_PAIR(0xE6B1, 0x8C4E)
+DOUBLE_BYTE_PAIR(0xE6B2, 0x8C50)
+DOUBLE_BYTE_PAIR(0xE6B3, 0x8C55)
+DOUBLE_BYTE_PAIR(0xE6B4, 0x8C62)
+DOUBLE_BYTE_PAIR(0xE6B5, 0x8C6C)
+DOUBLE_BYTE_PAIR(0xE6B6, 0x8C78)
+DOUBLE_BYTE_PAIR(0xE6B7, 0x8C7A)
+DOUBLE_BYTE_PAIR(0xE6B8, 0x8C82)
+DOUBLE_BYTE_PAIR(0xE6B9, 0x8C89)
+DOUBLE_BYTE_PAIR(0xE6BA, 0x8C85)
+DOUBLE_BYTE_PAIR(0xE6BB, 0x8C8A)
+DOUBLE_BYTE_PAIR(0xE6BC, 0x8C8D)
+DOUBLE_BYTE_PAIR(0xE6BD, 0x8C8E)
+DOUBLE_BYTE_PAIR(0xE6BE, 0x8C94)
+DOUBLE_BYTE_PAIR(0xE6BF, 0x8C7C)
+DOUBLE_BYTE_PAIR(0xE6C0, 0x8C98)
+DOUBLE_BYTE_PAIR(0xE6C1, 0x621D)
+DOUBLE_BYTE_PAIR(0xE6C2, 0x8CAD)
+DOUBLE_BYTE_PAIR(0xE6C3, 0x8CAA)
+DOUBLE_BYTE_PAIR(0xE6C4, 0x8CBD)
+DOUBLE_BYTE_PAIR(0xE6C5, 0x8CB2)
+DOUBLE_BYTE_PAIR(0xE6C6, 0x8CB3)
+DOUBLE_BYTE_PAIR(0xE6C7, 0x8CAE)
+DOUBLE_BYTE_PAIR(0xE6C8, 0x8CB6)
+DOUBLE_BYTE_PAIR(0xE6C9, 0x8CC8)
+DOUBLE_BYTE_PAIR(0xE6CA, 0x8CC1)
+DOUBLE_BYTE_PAIR(0xE6CB, 0x8CE4)
+DOUBLE_BYTE_PAIR(0xE6CC, 0x8CE3)
+DOUBLE_BYTE_PAIR(0xE6CD, 0x8CDA)
+DOUBLE_BYTE_PAIR(0xE6CE, 0x8CFD)
+DOUBLE_BYTE_PAIR(0xE6CF, 0x8CFA)
+DOUBLE_BYTE_PAIR(0xE6D0, 0x8CFB)
+DOUBLE_BYTE_PAIR(0xE6D1, 0x8D04)
+DOUBLE_BYTE_PAIR(0xE6D2, 0x8D05)
+DOUBLE_BYTE_PAIR(0xE6D3, 0x8D0A)
+DOUBLE_BYTE_PAIR(0xE6D4, 0x8D07)
+DOUBLE_BYTE_PAIR(0xE6D5, 0x8D0F)
+DOUBLE_BYTE_PAIR(0xE6D6, 0x8D0D)
+DOUBLE_BYTE_PAIR(0xE6D7, 0x8D10)
+DOUBLE_BYTE_PAIR(0xE6D8, 0x9F4E)
+DOUBLE_BYTE_PAIR(0xE6D9, 0x8D13)
+DOUBLE_BYTE_PAIR(0xE6DA, 0x8CCD)
+DOUBLE_BYTE_PAIR(0xE6DB, 0x8D14)
+DOUBLE_BYTE_PAIR(0xE6DC, 0x8D16)
+DOUBLE_BYTE_PAIR(0xE6DD, 0x8D67)
+DOUBLE_BYTE_PAIR(0xE6DE, 0x8D6D)
+DOUBLE_BYTE_PAIR(0xE6DF, 0x8D71)
+DOUBLE_BYTE_PAIR(0xE6E0, 0x8D73)
+DOUBLE_BYTE_PAIR(0xE6E1, 0x8D81)
+DOUBLE_BYTE_PAIR(0xE6E2, 0x8D99)
+DOUBLE_BYTE_PAIR(0xE6E3, 0x8DC2)
+DOUBLE_BYTE_PAIR(0xE6E4, 0x8DBE)
+DOUBLE_BYTE_PAIR(0xE6E5, 0x8DBA)
+DOUBLE_BYTE_PAIR(0xE6E6, 0x8DCF)
+DOUBLE_BYTE_PAIR(0xE6E7, 0x8DDA)
+DOUBLE_BYTE_PAIR(0xE6E8, 0x8DD6)
+DOUBLE_BYTE_PAIR(0xE6E9, 0x8DCC)
+DOUBLE_BYTE_PAIR(0xE6EA, 0x8DDB)
+DOUBLE_BYTE_PAIR(0xE6EB, 0x8DCB)
+DOUBLE_BYTE_PAIR(0xE6EC, 0x8DEA)
+DOUBLE_BYTE_PAIR(0xE6ED, 0x8DEB)
+DOUBLE_BYTE_PAIR(0xE6EE, 0x8DDF)
+DOUBLE_BYTE_PAIR(0xE6EF, 0x8DE3)
+DOUBLE_BYTE_PAIR(0xE6F0, 0x8DFC)
+DOUBLE_BYTE_PAIR(0xE6F1, 0x8E08)
+DOUBLE_BYTE_PAIR(0xE6F2, 0x8E09)
+DOUBLE_BYTE_PAIR(0xE6F3, 0x8DFF)
+DOUBLE_BYTE_PAIR(0xE6F4, 0x8E1D)
+DOUBLE_BYTE_PAIR(0xE6F5, 0x8E1E)
+DOUBLE_BYTE_PAIR(0xE6F6, 0x8E10)
+DOUBLE_BYTE_PAIR(0xE6F7, 0x8E1F)
+DOUBLE_BYTE_PAIR(0xE6F8, 0x8E42)
+DOUBLE_BYTE_PAIR(0xE6F9, 0x8E35)
+DOUBLE_BYTE_PAIR(0xE6FA, 0x8E30)
+DOUBLE_BYTE_PAIR(0xE6FB, 0x8E34)
+DOUBLE_BYTE_PAIR(0xE6FC, 0x8E4A)
+DOUBLE_BYTE_PAIR(0xE740, 0x8E47)
+DOUBLE_BYTE_PAIR(0xE741, 0x8E49)
+DOUBLE_BYTE_PAIR(0xE742, 0x8E4C)
+DOUBLE_BYTE_PAIR(0xE743, 0x8E50)
+DOUBLE_BYTE_PAIR(0xE744, 0x8E48)
+DOUBLE_BYTE_PAIR(0xE745, 0x8E59)
+DOUBLE_BYTE_PAIR(0xE746, 0x8E64)
+DOUBLE_BYTE_PAIR(0xE747, 0x8E60)
+DOUBLE_BYTE_PAIR(0xE748, 0x8E2A)
+DOUBLE_BYTE_PAIR(0xE749, 0x8E63)
+DOUBLE_BYTE_PAIR(0xE74A, 0x8E55)
+DOUBLE_BYTE_PAIR(0xE74B, 0x8E76)
+DOUBLE_BYTE_PAIR(0xE74C, 0x8E72)
+DOUBLE_BYTE_PAIR(0xE74D, 0x8E7C)
+DOUBLE_BYTE_PAIR(0xE74E, 0x8E81)
+DOUBLE_BYTE_PAIR(0xE74F, 0x8E87)
+DOUBLE_BYTE_PAIR(0xE750, 0x8E85)
+DOUBLE_BYTE_PAIR(0xE751, 0x8E84)
+DOUBLE_BYTE_PAIR(0xE752, 0x8E8B)
+DOUBLE_BYTE_PAIR(0xE753, 0x8E8A)
+DOUBLE_BYTE_PAIR(0xE754, 0x8E93)
+DOUBLE_BYTE_PAIR(0xE755, 0x8E91)
+DOUBLE_BYTE_PAIR(0xE756, 0x8E94)
+DOUBLE_BYTE_PAIR(0xE757, 0x8E99)
+DOUBLE_BYTE_PAIR(0xE758, 0x8EAA)
+DOUBLE_BYTE_PAIR(0xE759, 0x8EA1)
+DOUBLE_BYTE_PAIR(0xE75A, 0x8EAC)
+DOUBLE_BYTE_PAIR(0xE75B, 0x8EB0)
+DOUBLE_BYTE_PAIR(0xE75C, 0x8EC6)
+DOUBLE_BYTE_PAIR(0xE75D, 0x8EB1)
+DOUBLE_BYTE_PAIR(0xE75E, 0x8EBE)
+DOUBLE_BYTE_PAIR(0xE75F, 0x8EC5)
+DOUBLE_BYTE_PAIR(0xE760, 0x8EC8)
+DOUBLE_BYTE_PAIR(0xE761, 0x8ECB)
+DOUBLE_BYTE_PAIR(0xE762, 0x8EDB)
+DOUBLE_BYTE_PAIR(0xE763, 0x8EE3)
+DOUBLE_BYTE_PAIR(0xE764, 0x8EFC)
+DOUBLE_BYTE_PAIR(0xE765, 0x8EFB)
+DOUBLE_BYTE_PAIR(0xE766, 0x8EEB)
+DOUBLE_BYTE_PAIR(0xE767, 0x8EFE)
+DOUBLE_BYTE_PAIR(0xE768, 0x8F0A)
+DOUBLE_BYTE_PAIR(0xE769, 0x8F05)
+DOUBLE_BYTE_PAIR(0xE76A, 0x8F15)
+DOUBLE_BYTE_PAIR(0xE76B, 0x8F12)
+DOUBLE_BYTE_PAIR(0xE76C, 0x8F19)
+DOUBLE_BYTE_PAIR(0xE76D, 0x8F13)
+DOUBLE_BYTE_PAIR(0xE76E, 0x8F1C)
+DOUBLE_BYTE_PAIR(0xE76F, 0x8F1F)
+DOUBLE_BYTE_PAIR(0xE770, 0x8F1B)
+DOUBLE_BYTE_PAIR(0xE771, 0x8F0C)
+DOUBLE_BYTE_PAIR(0xE772, 0x8F26)
+DOUBLE_BYTE_PAIR(0xE773, 0x8F33)
+DOUBLE_BYTE_PAIR(0xE774, 0x8F3B)
+DOUBLE_BYTE_PAIR(0xE775, 0x8F39)
+DOUBLE_BYTE_PAIR(0xE776, 0x8F45)
+DOUBLE_BYTE_PAIR(0xE777, 0x8F42)
+DOUBLE_BYTE_PAIR(0xE778, 0x8F3E)
+DOUBLE_BYTE_PAIR(0xE779, 0x8F4C)
+DOUBLE_BYTE_PAIR(0xE77A, 0x8F49)
+DOUBLE_BYTE_PAIR(0xE77B, 0x8F46)
+DOUBLE_BYTE_PAIR(0xE77C, 0x8F4E)
+DOUBLE_BYTE_PAIR(0xE77D, 0x8F57)
+DOUBLE_BYTE_PAIR(0xE77E, 0x8F5C)
+DOUBLE_BYTE_PAIR(0xE780, 0x8F62)
+DOUBLE_BYTE_PAIR(0xE781, 0x8F63)
+DOUBLE_BYTE_PAIR(0xE782, 0x8F64)
+DOUBLE_BYTE_PAIR(0xE783, 0x8F9C)
+DOUBLE_BYTE_PAIR(0xE784, 0x8F9F)
+DOUBLE_BYTE_PAIR(0xE785, 0x8FA3)
+DOUBLE_BYTE_PAIR(0xE786, 0x8FAD)
+DOUBLE_BYTE_PAIR(0xE787, 0x8FAF)
+DOUBLE_BYTE_PAIR(0xE788, 0x8FB7)
+DOUBLE_BYTE_PAIR(0xE789, 0x8FDA)
+DOUBLE_BYTE_PAIR(0xE78A, 0x8FE5)
+DOUBLE_BYTE_PAIR(0xE78B, 0x8FE2)
+DOUBLE_BYTE_PAIR(0xE78C, 0x8FEA)
+DOUBLE_BYTE_PAIR(0xE78D, 0x8FEF)
+DOUBLE_BYTE_PAIR(0xE78E, 0x9087)
+DOUBLE_BYTE_PAIR(0xE78F, 0x8FF4)
+DOUBLE_BYTE_PAIR(0xE790, 0x9005)
+DOUBLE_BYTE_PAIR(0xE791, 0x8FF9)
+DOUBLE_BYTE_PAIR(0xE792, 0x8FFA)
+DOUBLE_BYTE_PAIR(0xE793, 0x9011)
+DOUBLE_BYTE_PAIR(0xE794, 0x9015)
+DOUBLE_BYTE_PAIR(0xE795, 0x9021)
+DOUBLE_BYTE_PAIR(0xE796, 0x900D)
+DOUBLE_BYTE_PAIR(0xE797, 0x901E)
+DOUBLE_BYTE_PAIR(0xE798, 0x9016)
+DOUBLE_BYTE_PAIR(0xE799, 0x900B)
+DOUBLE_BYTE_PAIR(0xE79A, 0x9027)
+DOUBLE_BYTE_PAIR(0xE79B, 0x9036)
+DOUBLE_BYTE_PAIR(0xE79C, 0x9035)
+DOUBLE_BYTE_PAIR(0xE79D, 0x9039)
+DOUBLE_BYTE_PAIR(0xE79E, 0x8FF8)
+DOUBLE_BYTE_PAIR(0xE79F, 0x904F)
+DOUBLE_BYTE_PAIR(0xE7A0, 0x9050)
+DOUBLE_BYTE_PAIR(0xE7A1, 0x9051)
+DOUBLE_BYTE_PAIR(0xE7A2, 0x9052)
+DOUBLE_BYTE_PAIR(0xE7A3, 0x900E)
+DOUBLE_BYTE_PAIR(0xE7A4, 0x9049)
+DOUBLE_BYTE_PAIR(0xE7A5, 0x903E)
+DOUBLE_BYTE_PAIR(0xE7A6, 0x9056)
+DOUBLE_BYTE_PAIR(0xE7A7, 0x9058)
+DOUBLE_BYTE_PAIR(0xE7A8, 0x905E)
+DOUBLE_BYTE_PAIR(0xE7A9, 0x9068)
+DOUBLE_BYTE_PAIR(0xE7AA, 0x906F)
+DOUBLE_BYTE_PAIR(0xE7AB, 0x9076)
+DOUBLE_BYTE_PAIR(0xE7AC, 0x96A8)
+DOUBLE_BYTE_PAIR(0xE7AD, 0x9072)
+DOUBLE_BYTE_PAIR(0xE7AE, 0x9082)
+DOUBLE_BYTE_PAIR(0xE7AF, 0x907D)
+DOUBLE_BYTE_PAIR(0xE7B0, 0x9081)
+DOUBLE_BYTE_PAIR(0xE7B1, 0x9080)
+DOUBLE_BYTE_PAIR(0xE7B2, 0x908A)
+DOUBLE_BYTE_PAIR(0xE7B3, 0x9089)
+DOUBLE_BYTE_PAIR(0xE7B4, 0x908F)
+DOUBLE_BYTE_PAIR(0xE7B5, 0x90A8)
+DOUBLE_BYTE_PAIR(0xE7B6, 0x90AF)
+DOUBLE_BYTE_PAIR(0xE7B7, 0x90B1)
+DOUBLE_BYTE_PAIR(0xE7B8, 0x90B5)
+DOUBLE_BYTE_PAIR(0xE7B9, 0x90E2)
+DOUBLE_BYTE_PAIR(0xE7BA, 0x90E4)
+DOUBLE_BYTE_PAIR(0xE7BB, 0x6248)
+DOUBLE_BYTE_PAIR(0xE7BC, 0x90DB)
+DOUBLE_BYTE_PAIR(0xE7BD, 0x9102)
+DOUBLE_BYTE_PAIR(0xE7BE, 0x9112)
+DOUBLE_BYTE_PAIR(0xE7BF, 0x9119)
+DOUBLE_BYTE_PAIR(0xE7C0, 0x9132)
+DOUBLE_BYTE_PAIR(0xE7C1, 0x9130)
+DOUBLE_BYTE_PAIR(0xE7C2, 0x914A)
+DOUBLE_BYTE_PAIR(0xE7C3, 0x9156)
+DOUBLE_BYTE_PAIR(0xE7C4, 0x9158)
+DOUBLE_BYTE_PAIR(0xE7C5, 0x9163)
+DOUBLE_BYTE_PAIR(0xE7C6, 0x9165)
+DOUBLE_BYTE_PAIR(0xE7C7, 0x9169)
+DOUBLE_BYTE_PAIR(0xE7C8, 0x9173)
+DOUBLE_BYTE_PAIR(0xE7C9, 0x9172)
+DOUBLE_BYTE_PAIR(0xE7CA, 0x918B)
+DOUBLE_BYTE_PAIR(0xE7CB, 0x9189)
+DOUBLE_BYTE_PAIR(0xE7CC, 0x9182)
+DOUBLE_BYTE_PAIR(0xE7CD, 0x91A2)
+DOUBLE_BYTE_PAIR(0xE7CE, 0x91AB)
+DOUBLE_BYTE_PAIR(0xE7CF, 0x91AF)
+DOUBLE_BYTE_PAIR(0xE7D0, 0x91AA)
+DOUBLE_BYTE_PAIR(0xE7D1, 0x91B5)
+DOUBLE_BYTE_PAIR(0xE7D2, 0x91B4)
+DOUBLE_BYTE_PAIR(0xE7D3, 0x91BA)
+DOUBLE_BYTE_PAIR(0xE7D4, 0x91C0)
+DOUBLE_BYTE_PAIR(0xE7D5, 0x91C1)
+DOUBLE_BYTE_PAIR(0xE7D6, 0x91C9)
+DOUBLE_BYTE_PAIR(0xE7D7, 0x91CB)
+DOUBLE_BYTE_PAIR(0xE7D8, 0x91D0)
+DOUBLE_BYTE_PAIR(0xE7D9, 0x91D6)
+DOUBLE_BYTE_PAIR(0xE7DA, 0x91DF)
+DOUBLE_BYTE_PAIR(0xE7DB, 0x91E1)
+DOUBLE_BYTE_PAIR(0xE7DC, 0x91DB)
+DOUBLE_BYTE_PAIR(0xE7DD, 0x91FC)
+DOUBLE_BYTE_PAIR(0xE7DE, 0x91F5)
+DOUBLE_BYTE_PAIR(0xE7DF, 0x91F6)
+DOUBLE_BYTE_PAIR(0xE7E0, 0x921E)
+DOUBLE_BYTE_PAIR(0xE7E1, 0x91FF)
+DOUBLE_BYTE_PAIR(0xE7E2, 0x9214)
+DOUBLE_BYTE_PAIR(0xE7E3, 0x922C)
+DOUBLE_BYTE_PAIR(0xE7E4, 0x9215)
+DOUBLE_BYTE_PAIR(0xE7E5, 0x9211)
+DOUBLE_BYTE_PAIR(0xE7E6, 0x925E)
+DOUBLE_BYTE_PAIR(0xE7E7, 0x9257)
+DOUBLE_BYTE_PAIR(0xE7E8, 0x9245)
+DOUBLE_BYTE_PAIR(0xE7E9, 0x9249)
+DOUBLE_BYTE_PAIR(0xE7EA, 0x9264)
+DOUBLE_BYTE_PAIR(0xE7EB, 0x9248)
+DOUBLE_BYTE_PAIR(0xE7EC, 0x9295)
+DOUBLE_BYTE_PAIR(0xE7ED, 0x923F)
+DOUBLE_BYTE_PAIR(0xE7EE, 0x924B)
+DOUBLE_BYTE_PAIR(0xE7EF, 0x9250)
+DOUBLE_BYTE_PAIR(0xE7F0, 0x929C)
+DOUBLE_BYTE_PAIR(0xE7F1, 0x9296)
+DOUBLE_BYTE_PAIR(0xE7F2, 0x9293)
+DOUBLE_BYTE_PAIR(0xE7F3, 0x929B)
+DOUBLE_BYTE_PAIR(0xE7F4, 0x925A)
+DOUBLE_BYTE_PAIR(0xE7F5, 0x92CF)
+DOUBLE_BYTE_PAIR(0xE7F6, 0x92B9)
+DOUBLE_BYTE_PAIR(0xE7F7, 0x92B7)
+DOUBLE_BYTE_PAIR(0xE7F8, 0x92E9)
+DOUBLE_BYTE_PAIR(0xE7F9, 0x930F)
+DOUBLE_BYTE_PAIR(0xE7FA, 0x92FA)
+DOUBLE_BYTE_PAIR(0xE7FB, 0x9344)
+DOUBLE_BYTE_PAIR(0xE7FC, 0x932E)
+DOUBLE_BYTE_PAIR(0xE840, 0x9319)
+DOUBLE_BYTE_PAIR(0xE841, 0x9322)
+DOUBLE_BYTE_PAIR(0xE842, 0x931A)
+DOUBLE_BYTE_PAIR(0xE843, 0x9323)
+DOUBLE_BYTE_PAIR(0xE844, 0x933A)
+DOUBLE_BYTE_PAIR(0xE845, 0x9335)
+DOUBLE_BYTE_PAIR(0xE846, 0x933B)
+DOUBLE_BYTE_PAIR(0xE847, 0x935C)
+DOUBLE_BYTE_PAIR(0xE848, 0x9360)
+DOUBLE_BYTE_PAIR(0xE849, 0x937C)
+DOUBLE_BYTE_PAIR(0xE84A, 0x936E)
+DOUBLE_BYTE_PAIR(0xE84B, 0x9356)
+DOUBLE_BYTE_PAIR(0xE84C, 0x93B0)
+DOUBLE_BYTE_PAIR(0xE84D, 0x93AC)
+DOUBLE_BYTE_PAIR(0xE84E, 0x93AD)
+DOUBLE_BYTE_PAIR(0xE84F, 0x9394)
+DOUBLE_BYTE_PAIR(0xE850, 0x93B9)
+DOUBLE_BYTE_PAIR(0xE851, 0x93D6)
+DOUBLE_BYTE_PAIR(0xE852, 0x93D7)
+DOUBLE_BYTE_PAIR(0xE853, 0x93E8)
+DOUBLE_BYTE_PAIR(0xE854, 0x93E5)
+DOUBLE_BYTE_PAIR(0xE855, 0x93D8)
+DOUBLE_BYTE_PAIR(0xE856, 0x93C3)
+DOUBLE_BYTE_PAIR(0xE857, 0x93DD)
+DOUBLE_BYTE_PAIR(0xE858, 0x93D0)
+DOUBLE_BYTE_PAIR(0xE859, 0x93C8)
+DOUBLE_BYTE_PAIR(0xE85A, 0x93E4)
+DOUBLE_BYTE_PAIR(0xE85B, 0x941A)
+DOUBLE_BYTE_PAIR(0xE85C, 0x9414)
+DOUBLE_BYTE_PAIR(0xE85D, 0x9413)
+DOUBLE_BYTE_PAIR(0xE85E, 0x9403)
+DOUBLE_BYTE_PAIR(0xE85F, 0x9407)
+DOUBLE_BYTE_PAIR(0xE860, 0x9410)
+DOUBLE_BYTE_PAIR(0xE861, 0x9436)
+DOUBLE_BYTE_PAIR(0xE862, 0x942B)
+DOUBLE_BYTE_PAIR(0xE863, 0x9435)
+DOUBLE_BYTE_PAIR(0xE864, 0x9421)
+DOUBLE_BYTE_PAIR(0xE865, 0x943A)
+DOUBLE_BYTE_PAIR(0xE866, 0x9441)
+DOUBLE_BYTE_PAIR(0xE867, 0x9452)
+DOUBLE_BYTE_PAIR(0xE868, 0x9444)
+DOUBLE_BYTE_PAIR(0xE869, 0x945B)
+DOUBLE_BYTE_PAIR(0xE86A, 0x9460)
+DOUBLE_BYTE_PAIR(0xE86B, 0x9462)
+DOUBLE_BYTE_PAIR(0xE86C, 0x945E)
+DOUBLE_BYTE_PAIR(0xE86D, 0x946A)
+DOUBLE_BYTE_PAIR(0xE86E, 0x9229)
+DOUBLE_BYTE_PAIR(0xE86F, 0x9470)
+DOUBLE_BYTE_PAIR(0xE870, 0x9475)
+DOUBLE_BYTE_PAIR(0xE871, 0x9477)
+DOUBLE_BYTE_PAIR(0xE872, 0x947D)
+DOUBLE_BYTE_PAIR(0xE873, 0x945A)
+DOUBLE_BYTE_PAIR(0xE874, 0x947C)
+DOUBLE_BYTE_PAIR(0xE875, 0x947E)
+DOUBLE_BYTE_PAIR(0xE876, 0x9481)
+DOUBLE_BYTE_PAIR(0xE877, 0x947F)
+DOUBLE_BYTE_PAIR(0xE878, 0x9582)
+DOUBLE_BYTE_PAIR(0xE879, 0x9587)
+DOUBLE_BYTE_PAIR(0xE87A, 0x958A)
+DOUBLE_BYTE_PAIR(0xE87B, 0x9594)
+DOUBLE_BYTE_PAIR(0xE87C, 0x9596)
+DOUBLE_BYTE_PAIR(0xE87D, 0x9598)
+DOUBLE_BYTE_PAIR(0xE87E, 0x9599)
+DOUBLE_BYTE_PAIR(0xE880, 0x95A0)
+DOUBLE_BYTE_PAIR(0xE881, 0x95A8)
+DOUBLE_BYTE_PAIR(0xE882, 0x95A7)
+DOUBLE_BYTE_PAIR(0xE883, 0x95AD)
+DOUBLE_BYTE_PAIR(0xE884, 0x95BC)
+DOUBLE_BYTE_PAIR(0xE885, 0x95BB)
+DOUBLE_BYTE_PAIR(0xE886, 0x95B9)
+DOUBLE_BYTE_PAIR(0xE887, 0x95BE)
+DOUBLE_BYTE_PAIR(0xE888, 0x95CA)
+DOUBLE_BYTE_PAIR(0xE889, 0x6FF6)
+DOUBLE_BYTE_PAIR(0xE88A, 0x95C3)
+DOUBLE_BYTE_PAIR(0xE88B, 0x95CD)
+DOUBLE_BYTE_PAIR(0xE88C, 0x95CC)
+DOUBLE_BYTE_PAIR(0xE88D, 0x95D5)
+DOUBLE_BYTE_PAIR(0xE88E, 0x95D4)
+DOUBLE_BYTE_PAIR(0xE88F, 0x95D6)
+DOUBLE_BYTE_PAIR(0xE890, 0x95DC)
+DOUBLE_BYTE_PAIR(0xE891, 0x95E1)
+DOUBLE_BYTE_PAIR(0xE892, 0x95E5)
+DOUBLE_BYTE_PAIR(0xE893, 0x95E2)
+DOUBLE_BYTE_PAIR(0xE894, 0x9621)
+DOUBLE_BYTE_PAIR(0xE895, 0x9628)
+DOUBLE_BYTE_PAIR(0xE896, 0x962E)
+DOUBLE_BYTE_PAIR(0xE897, 0x962F)
+DOUBLE_BYTE_PAIR(0xE898, 0x9642)
+DOUBLE_BYTE_PAIR(0xE899, 0x964C)
+DOUBLE_BYTE_PAIR(0xE89A, 0x964F)
+DOUBLE_BYTE_PAIR(0xE89B, 0x964B)
+DOUBLE_BYTE_PAIR(0xE89C, 0x9677)
+DOUBLE_BYTE_PAIR(0xE89D, 0x965C)
+DOUBLE_BYTE_PAIR(0xE89E, 0x965E)
+DOUBLE_BYTE_PAIR(0xE89F, 0x965D)
+DOUBLE_BYTE_PAIR(0xE8A0, 0x965F)
+DOUBLE_BYTE_PAIR(0xE8A1, 0x9666)
+DOUBLE_BYTE_PAIR(0xE8A2, 0x9672)
+DOUBLE_BYTE_PAIR(0xE8A3, 0x966C)
+DOUBLE_BYTE_PAIR(0xE8A4, 0x968D)
+DOUBLE_BYTE_PAIR(0xE8A5, 0x9698)
+DOUBLE_BYTE_PAIR(0xE8A6, 0x9695)
+DOUBLE_BYTE_PAIR(0xE8A7, 0x9697)
+DOUBLE_BYTE_PAIR(0xE8A8, 0x96AA)
+DOUBLE_BYTE_PAIR(0xE8A9, 0x96A7)
+DOUBLE_BYTE_PAIR(0xE8AA, 0x96B1)
+DOUBLE_BYTE_PAIR(0xE8AB, 0x96B2)
+DOUBLE_BYTE_PAIR(0xE8AC, 0x96B0)
+DOUBLE_BYTE_PAIR(0xE8AD, 0x96B4)
+DOUBLE_BYTE_PAIR(0xE8AE, 0x96B6)
+DOUBLE_BYTE_PAIR(0xE8AF, 0x96B8)
+DOUBLE_BYTE_PAIR(0xE8B0, 0x96B9)
+DOUBLE_BYTE_PAIR(0xE8B1, 0x96CE)
+DOUBLE_BYTE_PAIR(0xE8B2, 0x96CB)
+DOUBLE_BYTE_PAIR(0xE8B3, 0x96C9)
+DOUBLE_BYTE_PAIR(0xE8B4, 0x96CD)
+DOUBLE_BYTE_PAIR(0xE8B5, 0x894D)
+DOUBLE_BYTE_PAIR(0xE8B6, 0x96DC)
+DOUBLE_BYTE_PAIR(0xE8B7, 0x970D)
+DOUBLE_BYTE_PAIR(0xE8B8, 0x96D5)
+DOUBLE_BYTE_PAIR(0xE8B9, 0x96F9)
+DOUBLE_BYTE_PAIR(0xE8BA, 0x9704)
+DOUBLE_BYTE_PAIR(0xE8BB, 0x9706)
+DOUBLE_BYTE_PAIR(0xE8BC, 0x9708)
+DOUBLE_BYTE_PAIR(0xE8BD, 0x9713)
+DOUBLE_BYTE_PAIR(0xE8BE, 0x970E)
+DOUBLE_BYTE_PAIR(0xE8BF, 0x9711)
+DOUBLE_BYTE_PAIR(0xE8C0, 0x970F)
+DOUBLE_BYTE_PAIR(0xE8C1, 0x9716)
+DOUBLE_BYTE_PAIR(0xE8C2, 0x9719)
+DOUBLE_BYTE_PAIR(0xE8C3, 0x9724)
+DOUBLE_BYTE_PAIR(0xE8C4, 0x972A)
+DOUBLE_BYTE_PAIR(0xE8C5, 0x9730)
+DOUBLE_BYTE_PAIR(0xE8C6, 0x9739)
+DOUBLE_BYTE_PAIR(0xE8C7, 0x973D)
+DOUBLE_BYTE_PAIR(0xE8C8, 0x973E)
+DOUBLE_BYTE_PAIR(0xE8C9, 0x9744)
+DOUBLE_BYTE_PAIR(0xE8CA, 0x9746)
+DOUBLE_BYTE_PAIR(0xE8CB, 0x9748)
+DOUBLE_BYTE_PAIR(0xE8CC, 0x9742)
+DOUBLE_BYTE_PAIR(0xE8CD, 0x9749)
+DOUBLE_BYTE_PAIR(0xE8CE, 0x975C)
+DOUBLE_BYTE_PAIR(0xE8CF, 0x9760)
+DOUBLE_BYTE_PAIR(0xE8D0, 0x9764)
+DOUBLE_BYTE_PAIR(0xE8D1, 0x9766)
+DOUBLE_BYTE_PAIR(0xE8D2, 0x9768)
+DOUBLE_BYTE_PAIR(0xE8D3, 0x52D2)
+DOUBLE_BYTE_PAIR(0xE8D4, 0x976B)
+DOUBLE_BYTE_PAIR(0xE8D5, 0x9771)
+DOUBLE_BYTE_PAIR(0xE8D6, 0x9779)
+DOUBLE_BYTE_PAIR(0xE8D7, 0x9785)
+DOUBLE_BYTE_PAIR(0xE8D8, 0x977C)
+DOUBLE_BYTE_PAIR(0xE8D9, 0x9781)
+DOUBLE_BYTE_PAIR(0xE8DA, 0x977A)
+DOUBLE_BYTE_PAIR(0xE8DB, 0x9786)
+DOUBLE_BYTE_PAIR(0xE8DC, 0x978B)
+DOUBLE_BYTE_PAIR(0xE8DD, 0x978F)
+DOUBLE_BYTE_PAIR(0xE8DE, 0x9790)
+DOUBLE_BYTE_PAIR(0xE8DF, 0x979C)
+DOUBLE_BYTE_PAIR(0xE8E0, 0x97A8)
+DOUBLE_BYTE_PAIR(0xE8E1, 0x97A6)
+DOUBLE_BYTE_PAIR(0xE8E2, 0x97A3)
+DOUBLE_BYTE_PAIR(0xE8E3, 0x97B3)
+DOUBLE_BYTE_PAIR(0xE8E4, 0x97B4)
+DOUBLE_BYTE_PAIR(0xE8E5, 0x97C3)
+DOUBLE_BYTE_PAIR(0xE8E6, 0x97C6)
+DOUBLE_BYTE_PAIR(0xE8E7, 0x97C8)
+DOUBLE_BYTE_PAIR(0xE8E8, 0x97CB)
+DOUBLE_BYTE_PAIR(0xE8E9, 0x97DC)
+DOUBLE_BYTE_PAIR(0xE8EA, 0x97ED)
+DOUBLE_BYTE_PAIR(0xE8EB, 0x9F4F)
+DOUBLE_BYTE_PAIR(0xE8EC, 0x97F2)
+DOUBLE_BYTE_PAIR(0xE8ED, 0x7ADF)
+DOUBLE_BYTE_PAIR(0xE8EE, 0x97F6)
+DOUBLE_BYTE_PAIR(0xE8EF, 0x97F5)
+DOUBLE_BYTE_PAIR(0xE8F0, 0x980F)
+DOUBLE_BYTE_PAIR(0xE8F1, 0x980C)
+DOUBLE_BYTE_PAIR(0xE8F2, 0x9838)
+DOUBLE_BYTE_PAIR(0xE8F3, 0x9824)
+DOUBLE_BYTE_PAIR(0xE8F4, 0x9821)
+DOUBLE_BYTE_PAIR(0xE8F5, 0x9837)
+DOUBLE_BYTE_PAIR(0xE8F6, 0x983D)
+DOUBLE_BYTE_PAIR(0xE8F7, 0x9846)
+DOUBLE_BYTE_PAIR(0xE8F8, 0x984F)
+DOUBLE_BYTE_PAIR(0xE8F9, 0x984B)
+DOUBLE_BYTE_PAIR(0xE8FA, 0x986B)
+DOUBLE_BYTE_PAIR(0xE8FB, 0x986F)
+DOUBLE_BYTE_PAIR(0xE8FC, 0x9870)
+DOUBLE_BYTE_PAIR(0xE940, 0x9871)
+DOUBLE_BYTE_PAIR(0xE941, 0x9874)
+DOUBLE_BYTE_PAIR(0xE942, 0x9873)
+DOUBLE_BYTE_PAIR(0xE943, 0x98AA)
+DOUBLE_BYTE_PAIR(0xE944, 0x98AF)
+DOUBLE_BYTE_PAIR(0xE945, 0x98B1)
+DOUBLE_BYTE_PAIR(0xE946, 0x98B6)
+DOUBLE_BYTE_PAIR(0xE947, 0x98C4)
+DOUBLE_BYTE_PAIR(0xE948, 0x98C3)
+DOUBLE_BYTE_PAIR(0xE949, 0x98C6)
+DOUBLE_BYTE_PAIR(0xE94A, 0x98E9)
+DOUBLE_BYTE_PAIR(0xE94B, 0x98EB)
+DOUBLE_BYTE_PAIR(0xE94C, 0x9903)
+DOUBLE_BYTE_PAIR(0xE94D, 0x9909)
+DOUBLE_BYTE_PAIR(0xE94E, 0x9912)
+DOUBLE_BYTE_PAIR(0xE94F, 0x9914)
+DOUBLE_BYTE_PAIR(0xE950, 0x9918)
+DOUBLE_BYTE_PAIR(0xE951, 0x9921)
+DOUBLE_BYTE_PAIR(0xE952, 0x991D)
+DOUBLE_BYTE_PAIR(0xE953, 0x991E)
+DOUBLE_BYTE_PAIR(0xE954, 0x9924)
+DOUBLE_BYTE_PAIR(0xE955, 0x9920)
+DOUBLE_BYTE_PAIR(0xE956, 0x992C)
+DOUBLE_BYTE_PAIR(0xE957, 0x992E)
+DOUBLE_BYTE_PAIR(0xE958, 0x993D)
+DOUBLE_BYTE_PAIR(0xE959, 0x993E)
+DOUBLE_BYTE_PAIR(0xE95A, 0x9942)
+DOUBLE_BYTE_PAIR(0xE95B, 0x9949)
+DOUBLE_BYTE_PAIR(0xE95C, 0x9945)
+DOUBLE_BYTE_PAIR(0xE95D, 0x9950)
+DOUBLE_BYTE_PAIR(0xE95E, 0x994B)
+DOUBLE_BYTE_PAIR(0xE95F, 0x9951)
+DOUBLE_BYTE_PAIR(0xE960, 0x9952)
+DOUBLE_BYTE_PAIR(0xE961, 0x994C)
+DOUBLE_BYTE_PAIR(0xE962, 0x9955)
+DOUBLE_BYTE_PAIR(0xE963, 0x9997)
+DOUBLE_BYTE_PAIR(0xE964, 0x9998)
+DOUBLE_BYTE_PAIR(0xE965, 0x99A5)
+DOUBLE_BYTE_PAIR(0xE966, 0x99AD)
+DOUBLE_BYTE_PAIR(0xE967, 0x99AE)
+DOUBLE_BYTE_PAIR(0xE968, 0x99BC)
+DOUBLE_BYTE_PAIR(0xE969, 0x99DF)
+DOUBLE_BYTE_PAIR(0xE96A, 0x99DB)
+DOUBLE_BYTE_PAIR(0xE96B, 0x99DD)
+DOUBLE_BYTE_PAIR(0xE96C, 0x99D8)
+DOUBLE_BYTE_PAIR(0xE96D, 0x99D1)
+DOUBLE_BYTE_PAIR(0xE96E, 0x99ED)
+DOUBLE_BYTE_PAIR(0xE96F, 0x99EE)
+DOUBLE_BYTE_PAIR(0xE970, 0x99F1)
+DOUBLE_BYTE_PAIR(0xE971, 0x99F2)
+DOUBLE_BYTE_PAIR(0xE972, 0x99FB)
+DOUBLE_BYTE_PAIR(0xE973, 0x99F8)
+DOUBLE_BYTE_PAIR(0xE974, 0x9A01)
+DOUBLE_BYTE_PAIR(0xE975, 0x9A0F)
+DOUBLE_BYTE_PAIR(0xE976, 0x9A05)
+DOUBLE_BYTE_PAIR(0xE977, 0x99E2)
+DOUBLE_BYTE_PAIR(0xE978, 0x9A19)
+DOUBLE_BYTE_PAIR(0xE979, 0x9A2B)
+DOUBLE_BYTE_PAIR(0xE97A, 0x9A37)
+DOUBLE_BYTE_PAIR(0xE97B, 0x9A45)
+DOUBLE_BYTE_PAIR(0xE97C, 0x9A42)
+DOUBLE_BYTE_PAIR(0xE97D, 0x9A40)
+DOUBLE_BYTE_PAIR(0xE97E, 0x9A43)
+DOUBLE_BYTE_PAIR(0xE980, 0x9A3E)
+DOUBLE_BYTE_PAIR(0xE981, 0x9A55)
+DOUBLE_BYTE_PAIR(0xE982, 0x9A4D)
+DOUBLE_BYTE_PAIR(0xE983, 0x9A5B)
+DOUBLE_BYTE_PAIR(0xE984, 0x9A57)
+DOUBLE_BYTE_PAIR(0xE985, 0x9A5F)
+DOUBLE_BYTE_PAIR(0xE986, 0x9A62)
+DOUBLE_BYTE_PAIR(0xE987, 0x9A65)
+DOUBLE_BYTE_PAIR(0xE988, 0x9A64)
+DOUBLE_BYTE_PAIR(0xE989, 0x9A69)
+DOUBLE_BYTE_PAIR(0xE98A, 0x9A6B)
+DOUBLE_BYTE_PAIR(0xE98B, 0x9A6A)
+DOUBLE_BYTE_PAIR(0xE98C, 0x9AAD)
+DOUBLE_BYTE_PAIR(0xE98D, 0x9AB0)
+DOUBLE_BYTE_PAIR(0xE98E, 0x9ABC)
+DOUBLE_BYTE_PAIR(0xE98F, 0x9AC0)
+DOUBLE_BYTE_PAIR(0xE990, 0x9ACF)
+DOUBLE_BYTE_PAIR(0xE991, 0x9AD1)
+DOUBLE_BYTE_PAIR(0xE992, 0x9AD3)
+DOUBLE_BYTE_PAIR(0xE993, 0x9AD4)
+DOUBLE_BYTE_PAIR(0xE994, 0x9ADE)
+DOUBLE_BYTE_PAIR(0xE995, 0x9ADF)
+DOUBLE_BYTE_PAIR(0xE996, 0x9AE2)
+DOUBLE_BYTE_PAIR(0xE997, 0x9AE3)
+DOUBLE_BYTE_PAIR(0xE998, 0x9AE6)
+DOUBLE_BYTE_PAIR(0xE999, 0x9AEF)
+DOUBLE_BYTE_PAIR(0xE99A, 0x9AEB)
+DOUBLE_BYTE_PAIR(0xE99B, 0x9AEE)
+DOUBLE_BYTE_PAIR(0xE99C, 0x9AF4)
+DOUBLE_BYTE_PAIR(0xE99D, 0x9AF1)
+DOUBLE_BYTE_PAIR(0xE99E, 0x9AF7)
+DOUBLE_BYTE_PAIR(0xE99F, 0x9AFB)
+DOUBLE_BYTE_PAIR(0xE9A0, 0x9B06)
+DOUBLE_BYTE_PAIR(0xE9A1, 0x9B18)
+DOUBLE_BYTE_PAIR(0xE9A2, 0x9B1A)
+DOUBLE_BYTE_PAIR(0xE9A3, 0x9B1F)
+DOUBLE_BYTE_PAIR(0xE9A4, 0x9B22)
+DOUBLE_BYTE_PAIR(0xE9A5, 0x9B23)
+DOUBLE_BYTE_PAIR(0xE9A6, 0x9B25)
+DOUBLE_BYTE_PAIR(0xE9A7, 0x9B27)
+DOUBLE_BYTE_PAIR(0xE9A8, 0x9B28)
+DOUBLE_BYTE_PAIR(0xE9A9, 0x9B29)
+DOUBLE_BYTE_PAIR(0xE9AA, 0x9B2A)
+DOUBLE_BYTE_PAIR(0xE9AB, 0x9B2E)
+DOUBLE_BYTE_PAIR(0xE9AC, 0x9B2F)
+DOUBLE_BYTE_PAIR(0xE9AD, 0x9B32)
+DOUBLE_BYTE_PAIR(0xE9AE, 0x9B44)
+DOUBLE_BYTE_PAIR(0xE9AF, 0x9B43)
+DOUBLE_BYTE_PAIR(0xE9B0, 0x9B4F)
+DOUBLE_BYTE_PAIR(0xE9B1, 0x9B4D)
+DOUBLE_BYTE_PAIR(0xE9B2, 0x9B4E)
+DOUBLE_BYTE_PAIR(0xE9B3, 0x9B51)
+DOUBLE_BYTE_PAIR(0xE9B4, 0x9B58)
+DOUBLE_BYTE_PAIR(0xE9B5, 0x9B74)
+DOUBLE_BYTE_PAIR(0xE9B6, 0x9B93)
+DOUBLE_BYTE_PAIR(0xE9B7, 0x9B83)
+DOUBLE_BYTE_PAIR(0xE9B8, 0x9B91)
+DOUBLE_BYTE_PAIR(0xE9B9, 0x9B96)
+DOUBLE_BYTE_PAIR(0xE9BA, 0x9B97)
+DOUBLE_BYTE_PAIR(0xE9BB, 0x9B9F)
+DOUBLE_BYTE_PAIR(0xE9BC, 0x9BA0)
+DOUBLE_BYTE_PAIR(0xE9BD, 0x9BA8)
+DOUBLE_BYTE_PAIR(0xE9BE, 0x9BB4)
+DOUBLE_BYTE_PAIR(0xE9BF, 0x9BC0)
+DOUBLE_BYTE_PAIR(0xE9C0, 0x9BCA)
+DOUBLE_BYTE_PAIR(0xE9C1, 0x9BB9)
+DOUBLE_BYTE_PAIR(0xE9C2, 0x9BC6)
+DOUBLE_BYTE_PAIR(0xE9C3, 0x9BCF)
+DOUBLE_BYTE_PAIR(0xE9C4, 0x9BD1)
+DOUBLE_BYTE_PAIR(0xE9C5, 0x9BD2)
+DOUBLE_BYTE_PAIR(0xE9C6, 0x9BE3)
+DOUBLE_BYTE_PAIR(0xE9C7, 0x9BE2)
+DOUBLE_BYTE_PAIR(0xE9C8, 0x9BE4)
+DOUBLE_BYTE_PAIR(0xE9C9, 0x9BD4)
+DOUBLE_BYTE_PAIR(0xE9CA, 0x9BE1)
+DOUBLE_BYTE_PAIR(0xE9CB, 0x9C3A)
+DOUBLE_BYTE_PAIR(0xE9CC, 0x9BF2)
+DOUBLE_BYTE_PAIR(0xE9CD, 0x9BF1)
+DOUBLE_BYTE_PAIR(0xE9CE, 0x9BF0)
+DOUBLE_BYTE_PAIR(0xE9CF, 0x9C15)
+DOUBLE_BYTE_PAIR(0xE9D0, 0x9C14)
+DOUBLE_BYTE_PAIR(0xE9D1, 0x9C09)
+DOUBLE_BYTE_PAIR(0xE9D2, 0x9C13)
+DOUBLE_BYTE_PAIR(0xE9D3, 0x9C0C)
+DOUBLE_BYTE_PAIR(0xE9D4, 0x9C06)
+DOUBLE_BYTE_PAIR(0xE9D5, 0x9C08)
+DOUBLE_BYTE_PAIR(0xE9D6, 0x9C12)
+DOUBLE_BYTE_PAIR(0xE9D7, 0x9C0A)
+DOUBLE_BYTE_PAIR(0xE9D8, 0x9C04)
+DOUBLE_BYTE_PAIR(0xE9D9, 0x9C2E)
+DOUBLE_BYTE_PAIR(0xE9DA, 0x9C1B)
+DOUBLE_BYTE_PAIR(0xE9DB, 0x9C25)
+DOUBLE_BYTE_PAIR(0xE9DC, 0x9C24)
+DOUBLE_BYTE_PAIR(0xE9DD, 0x9C21)
+DOUBLE_BYTE_PAIR(0xE9DE, 0x9C30)
+DOUBLE_BYTE_PAIR(0xE9DF, 0x9C47)
+DOUBLE_BYTE_PAIR(0xE9E0, 0x9C32)
+DOUBLE_BYTE_PAIR(0xE9E1, 0x9C46)
+DOUBLE_BYTE_PAIR(0xE9E2, 0x9C3E)
+DOUBLE_BYTE_PAIR(0xE9E3, 0x9C5A)
+DOUBLE_BYTE_PAIR(0xE9E4, 0x9C60)
+DOUBLE_BYTE_PAIR(0xE9E5, 0x9C67)
+DOUBLE_BYTE_PAIR(0xE9E6, 0x9C76)
+DOUBLE_BYTE_PAIR(0xE9E7, 0x9C78)
+DOUBLE_BYTE_PAIR(0xE9E8, 0x9CE7)
+DOUBLE_BYTE_PAIR(0xE9E9, 0x9CEC)
+DOUBLE_BYTE_PAIR(0xE9EA, 0x9CF0)
+DOUBLE_BYTE_PAIR(0xE9EB, 0x9D09)
+DOUBLE_BYTE_PAIR(0xE9EC, 0x9D08)
+DOUBLE_BYTE_PAIR(0xE9ED, 0x9CEB)
+DOUBLE_BYTE_PAIR(0xE9EE, 0x9D03)
+DOUBLE_BYTE_PAIR(0xE9EF, 0x9D06)
+DOUBLE_BYTE_PAIR(0xE9F0, 0x9D2A)
+DOUBLE_BYTE_PAIR(0xE9F1, 0x9D26)
+DOUBLE_BYTE_PAIR(0xE9F2, 0x9DAF)
+DOUBLE_BYTE_PAIR(0xE9F3, 0x9D23)
+DOUBLE_BYTE_PAIR(0xE9F4, 0x9D1F)
+DOUBLE_BYTE_PAIR(0xE9F5, 0x9D44)
+DOUBLE_BYTE_PAIR(0xE9F6, 0x9D15)
+DOUBLE_BYTE_PAIR(0xE9F7, 0x9D12)
+DOUBLE_BYTE_PAIR(0xE9F8, 0x9D41)
+DOUBLE_BYTE_PAIR(0xE9F9, 0x9D3F)
+DOUBLE_BYTE_PAIR(0xE9FA, 0x9D3E)
+DOUBLE_BYTE_PAIR(0xE9FB, 0x9D46)
+DOUBLE_BYTE_PAIR(0xE9FC, 0x9D48)
+DOUBLE_BYTE_PAIR(0xEA40, 0x9D5D)
+DOUBLE_BYTE_PAIR(0xEA41, 0x9D5E)
+DOUBLE_BYTE_PAIR(0xEA42, 0x9D64)
+DOUBLE_BYTE_PAIR(0xEA43, 0x9D51)
+DOUBLE_BYTE_PAIR(0xEA44, 0x9D50)
+DOUBLE_BYTE_PAIR(0xEA45, 0x9D59)
+DOUBLE_BYTE_PAIR(0xEA46, 0x9D72)
+DOUBLE_BYTE_PAIR(0xEA47, 0x9D89)
+DOUBLE_BYTE_PAIR(0xEA48, 0x9D87)
+DOUBLE_BYTE_PAIR(0xEA49, 0x9DAB)
+DOUBLE_BYTE_PAIR(0xEA4A, 0x9D6F)
+DOUBLE_BYTE_PAIR(0xEA4B, 0x9D7A)
+DOUBLE_BYTE_PAIR(0xEA4C, 0x9D9A)
+DOUBLE_BYTE_PAIR(0xEA4D, 0x9DA4)
+DOUBLE_BYTE_PAIR(0xEA4E, 0x9DA9)
+DOUBLE_BYTE_PAIR(0xEA4F, 0x9DB2)
+DOUBLE_BYTE_PAIR(0xEA50, 0x9DC4)
+DOUBLE_BYTE_PAIR(0xEA51, 0x9DC1)
+DOUBLE_BYTE_PAIR(0xEA52, 0x9DBB)
+DOUBLE_BYTE_PAIR(0xEA53, 0x9DB8)
+DOUBLE_BYTE_PAIR(0xEA54, 0x9DBA)
+DOUBLE_BYTE_PAIR(0xEA55, 0x9DC6)
+DOUBLE_BYTE_PAIR(0xEA56, 0x9DCF)
+DOUBLE_BYTE_PAIR(0xEA57, 0x9DC2)
+DOUBLE_BYTE_PAIR(0xEA58, 0x9DD9)
+DOUBLE_BYTE_PAIR(0xEA59, 0x9DD3)
+DOUBLE_BYTE_PAIR(0xEA5A, 0x9DF8)
+DOUBLE_BYTE_PAIR(0xEA5B, 0x9DE6)
+DOUBLE_BYTE_PAIR(0xEA5C, 0x9DED)
+DOUBLE_BYTE_PAIR(0xEA5D, 0x9DEF)
+DOUBLE_BYTE_PAIR(0xEA5E, 0x9DFD)
+DOUBLE_BYTE_PAIR(0xEA5F, 0x9E1A)
+DOUBLE_BYTE_PAIR(0xEA60, 0x9E1B)
+DOUBLE_BYTE_PAIR(0xEA61, 0x9E1E)
+DOUBLE_BYTE_PAIR(0xEA62, 0x9E75)
+DOUBLE_BYTE_PAIR(0xEA63, 0x9E79)
+DOUBLE_BYTE_PAIR(0xEA64, 0x9E7D)
+DOUBLE_BYTE_PAIR(0xEA65, 0x9E81)
+DOUBLE_BYTE_PAIR(0xEA66, 0x9E88)
+DOUBLE_BYTE_PAIR(0xEA67, 0x9E8B)
+DOUBLE_BYTE_PAIR(0xEA68, 0x9E8C)
+DOUBLE_BYTE_PAIR(0xEA69, 0x9E92)
+DOUBLE_BYTE_PAIR(0xEA6A, 0x9E95)
+DOUBLE_BYTE_PAIR(0xEA6B, 0x9E91)
+DOUBLE_BYTE_PAIR(0xEA6C, 0x9E9D)
+DOUBLE_BYTE_PAIR(0xEA6D, 0x9EA5)
+DOUBLE_BYTE_PAIR(0xEA6E, 0x9EA9)
+DOUBLE_BYTE_PAIR(0xEA6F, 0x9EB8)
+DOUBLE_BYTE_PAIR(0xEA70, 0x9EAA)
+DOUBLE_BYTE_PAIR(0xEA71, 0x9EAD)
+DOUBLE_BYTE_PAIR(0xEA72, 0x9761)
+DOUBLE_BYTE_PAIR(0xEA73, 0x9ECC)
+DOUBLE_BYTE_PAIR(0xEA74, 0x9ECE)
+DOUBLE_BYTE_PAIR(0xEA75, 0x9ECF)
+DOUBLE_BYTE_PAIR(0xEA76, 0x9ED0)
+DOUBLE_BYTE_PAIR(0xEA77, 0x9ED4)
+DOUBLE_BYTE_PAIR(0xEA78, 0x9EDC)
+DOUBLE_BYTE_PAIR(0xEA79, 0x9EDE)
+DOUBLE_BYTE_PAIR(0xEA7A, 0x9EDD)
+DOUBLE_BYTE_PAIR(0xEA7B, 0x9EE0)
+DOUBLE_BYTE_PAIR(0xEA7C, 0x9EE5)
+DOUBLE_BYTE_PAIR(0xEA7D, 0x9EE8)
+DOUBLE_BYTE_PAIR(0xEA7E, 0x9EEF)
+DOUBLE_BYTE_PAIR(0xEA80, 0x9EF4)
+DOUBLE_BYTE_PAIR(0xEA81, 0x9EF6)
+DOUBLE_BYTE_PAIR(0xEA82, 0x9EF7)
+DOUBLE_BYTE_PAIR(0xEA83, 0x9EF9)
+DOUBLE_BYTE_PAIR(0xEA84, 0x9EFB)
+DOUBLE_BYTE_PAIR(0xEA85, 0x9EFC)
+DOUBLE_BYTE_PAIR(0xEA86, 0x9EFD)
+DOUBLE_BYTE_PAIR(0xEA87, 0x9F07)
+DOUBLE_BYTE_PAIR(0xEA88, 0x9F08)
+DOUBLE_BYTE_PAIR(0xEA89, 0x76B7)
+DOUBLE_BYTE_PAIR(0xEA8A, 0x9F15)
+DOUBLE_BYTE_PAIR(0xEA8B, 0x9F21)
+DOUBLE_BYTE_PAIR(0xEA8C, 0x9F2C)
+DOUBLE_BYTE_PAIR(0xEA8D, 0x9F3E)
+DOUBLE_BYTE_PAIR(0xEA8E, 0x9F4A)
+DOUBLE_BYTE_PAIR(0xEA8F, 0x9F52)
+DOUBLE_BYTE_PAIR(0xEA90, 0x9F54)
+DOUBLE_BYTE_PAIR(0xEA91, 0x9F63)
+DOUBLE_BYTE_PAIR(0xEA92, 0x9F5F)
+DOUBLE_BYTE_PAIR(0xEA93, 0x9F60)
+DOUBLE_BYTE_PAIR(0xEA94, 0x9F61)
+DOUBLE_BYTE_PAIR(0xEA95, 0x9F66)
+DOUBLE_BYTE_PAIR(0xEA96, 0x9F67)
+DOUBLE_BYTE_PAIR(0xEA97, 0x9F6C)
+DOUBLE_BYTE_PAIR(0xEA98, 0x9F6A)
+DOUBLE_BYTE_PAIR(0xEA99, 0x9F77)
+DOUBLE_BYTE_PAIR(0xEA9A, 0x9F72)
+DOUBLE_BYTE_PAIR(0xEA9B, 0x9F76)
+DOUBLE_BYTE_PAIR(0xEA9C, 0x9F95)
+DOUBLE_BYTE_PAIR(0xEA9D, 0x9F9C)
+DOUBLE_BYTE_PAIR(0xEA9E, 0x9FA0)
+DOUBLE_BYTE_PAIR(0xEA9F, 0x582F)
+DOUBLE_BYTE_PAIR(0xEAA0, 0x69C7)
+DOUBLE_BYTE_PAIR(0xEAA1, 0x9059)
+DOUBLE_BYTE_PAIR(0xEAA2, 0x7464)
+DOUBLE_BYTE_PAIR(0xEAA3, 0x51DC)
+DOUBLE_BYTE_PAIR(0xEAA4, 0x7199)
+DOUBLE_BYTE_PAIR(0xED40, 0x7E8A)
+DOUBLE_BYTE_PAIR(0xED41, 0x891C)
+DOUBLE_BYTE_PAIR(0xED42, 0x9348)
+DOUBLE_BYTE_PAIR(0xED43, 0x9288)
+DOUBLE_BYTE_PAIR(0xED44, 0x84DC)
+DOUBLE_BYTE_PAIR(0xED45, 0x4FC9)
+DOUBLE_BYTE_PAIR(0xED46, 0x70BB)
+DOUBLE_BYTE_PAIR(0xED47, 0x6631)
+DOUBLE_BYTE_PAIR(0xED48, 0x68C8)
+DOUBLE_BYTE_PAIR(0xED49, 0x92F9)
+DOUBLE_BYTE_PAIR(0xED4A, 0x66FB)
+DOUBLE_BYTE_PAIR(0xED4B, 0x5F45)
+DOUBLE_BYTE_PAIR(0xED4C, 0x4E28)
+DOUBLE_BYTE_PAIR(0xED4D, 0x4EE1)
+DOUBLE_BYTE_PAIR(0xED4E, 0x4EFC)
+DOUBLE_BYTE_PAIR(0xED4F, 0x4F00)
+DOUBLE_BYTE_PAIR(0xED50, 0x4F03)
+DOUBLE_BYTE_PAIR(0xED51, 0x4F39)
+DOUBLE_BYTE_PAIR(0xED52, 0x4F56)
+DOUBLE_BYTE_PAIR(0xED53, 0x4F92)
+DOUBLE_BYTE_PAIR(0xED54, 0x4F8A)
+DOUBLE_BYTE_PAIR(0xED55, 0x4F9A)
+DOUBLE_BYTE_PAIR(0xED56, 0x4F94)
+DOUBLE_BYTE_PAIR(0xED57, 0x4FCD)
+DOUBLE_BYTE_PAIR(0xED58, 0x5040)
+DOUBLE_BYTE_PAIR(0xED59, 0x5022)
+DOUBLE_BYTE_PAIR(0xED5A, 0x4FFF)
+DOUBLE_BYTE_PAIR(0xED5B, 0x501E)
+DOUBLE_BYTE_PAIR(0xED5C, 0x5046)
+DOUBLE_BYTE_PAIR(0xED5D, 0x5070)
+DOUBLE_BYTE_PAIR(0xED5E, 0x5042)
+DOUBLE_BYTE_PAIR(0xED5F, 0x5094)
+DOUBLE_BYTE_PAIR(0xED60, 0x50F4)
+DOUBLE_BYTE_PAIR(0xED61, 0x50D8)
+DOUBLE_BYTE_PAIR(0xED62, 0x514A)
+DOUBLE_BYTE_PAIR(0xED63, 0x5164)
+DOUBLE_BYTE_PAIR(0xED64, 0x519D)
+DOUBLE_BYTE_PAIR(0xED65, 0x51BE)
+DOUBLE_BYTE_PAIR(0xED66, 0x51EC)
+DOUBLE_BYTE_PAIR(0xED67, 0x5215)
+DOUBLE_BYTE_PAIR(0xED68, 0x529C)
+DOUBLE_BYTE_PAIR(0xED69, 0x52A6)
+DOUBLE_BYTE_PAIR(0xED6A, 0x52C0)
+DOUBLE_BYTE_PAIR(0xED6B, 0x52DB)
+DOUBLE_BYTE_PAIR(0xED6C, 0x5300)
+DOUBLE_BYTE_PAIR(0xED6D, 0x5307)
+DOUBLE_BYTE_PAIR(0xED6E, 0x5324)
+DOUBLE_BYTE_PAIR(0xED6F, 0x5372)
+DOUBLE_BYTE_PAIR(0xED70, 0x5393)
+DOUBLE_BYTE_PAIR(0xED71, 0x53B2)
+DOUBLE_BYTE_PAIR(0xED72, 0x53DD)
+DOUBLE_BYTE_PAIR(0xED73, 0xFA0E)
+DOUBLE_BYTE_PAIR(0xED74, 0x549C)
+DOUBLE_BYTE_PAIR(0xED75, 0x548A)
+DOUBLE_BYTE_PAIR(0xED76, 0x54A9)
+DOUBLE_BYTE_PAIR(0xED77, 0x54FF)
+DOUBLE_BYTE_PAIR(0xED78, 0x5586)
+DOUBLE_BYTE_PAIR(0xED79, 0x5759)
+DOUBLE_BYTE_PAIR(0xED7A, 0x5765)
+DOUBLE_BYTE_PAIR(0xED7B, 0x57AC)
+DOUBLE_BYTE_PAIR(0xED7C, 0x57C8)
+DOUBLE_BYTE_PAIR(0xED7D, 0x57C7)
+DOUBLE_BYTE_PAIR(0xED7E, 0xFA0F)
+DOUBLE_BYTE_PAIR(0xED80, 0xFA10)
+DOUBLE_BYTE_PAIR(0xED81, 0x589E)
+DOUBLE_BYTE_PAIR(0xED82, 0x58B2)
+DOUBLE_BYTE_PAIR(0xED83, 0x590B)
+DOUBLE_BYTE_PAIR(0xED84, 0x5953)
+DOUBLE_BYTE_PAIR(0xED85, 0x595B)
+DOUBLE_BYTE_PAIR(0xED86, 0x595D)
+DOUBLE_BYTE_PAIR(0xED87, 0x5963)
+DOUBLE_BYTE_PAIR(0xED88, 0x59A4)
+DOUBLE_BYTE_PAIR(0xED89, 0x59BA)
+DOUBLE_BYTE_PAIR(0xED8A, 0x5B56)
+DOUBLE_BYTE_PAIR(0xED8B, 0x5BC0)
+DOUBLE_BYTE_PAIR(0xED8C, 0x752F)
+DOUBLE_BYTE_PAIR(0xED8D, 0x5BD8)
+DOUBLE_BYTE_PAIR(0xED8E, 0x5BEC)
+DOUBLE_BYTE_PAIR(0xED8F, 0x5C1E)
+DOUBLE_BYTE_PAIR(0xED90, 0x5CA6)
+DOUBLE_BYTE_PAIR(0xED91, 0x5CBA)
+DOUBLE_BYTE_PAIR(0xED92, 0x5CF5)
+DOUBLE_BYTE_PAIR(0xED93, 0x5D27)
+DOUBLE_BYTE_PAIR(0xED94, 0x5D53)
+DOUBLE_BYTE_PAIR(0xED95, 0xFA11)
+DOUBLE_BYTE_PAIR(0xED96, 0x5D42)
+DOUBLE_BYTE_PAIR(0xED97, 0x5D6D)
+DOUBLE_BYTE_PAIR(0xED98, 0x5DB8)
+DOUBLE_BYTE_PAIR(0xED99, 0x5DB9)
+DOUBLE_BYTE_PAIR(0xED9A, 0x5DD0)
+DOUBLE_BYTE_PAIR(0xED9B, 0x5F21)
+DOUBLE_BYTE_PAIR(0xED9C, 0x5F34)
+DOUBLE_BYTE_PAIR(0xED9D, 0x5F67)
+DOUBLE_BYTE_PAIR(0xED9E, 0x5FB7)
+DOUBLE_BYTE_PAIR(0xED9F, 0x5FDE)
+DOUBLE_BYTE_PAIR(0xEDA0, 0x605D)
+DOUBLE_BYTE_PAIR(0xEDA1, 0x6085)
+DOUBLE_BYTE_PAIR(0xEDA2, 0x608A)
+DOUBLE_BYTE_PAIR(0xEDA3, 0x60DE)
+DOUBLE_BYTE_PAIR(0xEDA4, 0x60D5)
+DOUBLE_BYTE_PAIR(0xEDA5, 0x6120)
+DOUBLE_BYTE_PAIR(0xEDA6, 0x60F2)
+DOUBLE_BYTE_PAIR(0xEDA7, 0x6111)
+DOUBLE_BYTE_PAIR(0xEDA8, 0x6137)
+DOUBLE_BYTE_PAIR(0xEDA9, 0x6130)
+DOUBLE_BYTE_PAIR(0xEDAA, 0x6198)
+DOUBLE_BYTE_PAIR(0xEDAB, 0x6213)
+DOUBLE_BYTE_PAIR(0xEDAC, 0x62A6)
+DOUBLE_BYTE_PAIR(0xEDAD, 0x63F5)
+DOUBLE_BYTE_PAIR(0xEDAE, 0x6460)
+DOUBLE_BYTE_PAIR(0xEDAF, 0x649D)
+DOUBLE_BYTE_PAIR(0xEDB0, 0x64CE)
+DOUBLE_BYTE_PAIR(0xEDB1, 0x654E)
+DOUBLE_BYTE_PAIR(0xEDB2, 0x6600)
+DOUBLE_BYTE_PAIR(0xEDB3, 0x6615)
+DOUBLE_BYTE_PAIR(0xEDB4, 0x663B)
+DOUBLE_BYTE_PAIR(0xEDB5, 0x6609)
+DOUBLE_BYTE_PAIR(0xEDB6, 0x662E)
+DOUBLE_BYTE_PAIR(0xEDB7, 0x661E)
+DOUBLE_BYTE_PAIR(0xEDB8, 0x6624)
+DOUBLE_BYTE_PAIR(0xEDB9, 0x6665)
+DOUBLE_BYTE_PAIR(0xEDBA, 0x6657)
+DOUBLE_BYTE_PAIR(0xEDBB, 0x6659)
+DOUBLE_BYTE_PAIR(0xEDBC, 0xFA12)
+DOUBLE_BYTE_PAIR(0xEDBD, 0x6673)
+DOUBLE_BYTE_PAIR(0xEDBE, 0x6699)
+DOUBLE_BYTE_PAIR(0xEDBF, 0x66A0)
+DOUBLE_BYTE_PAIR(0xEDC0, 0x66B2)
+DOUBLE_BYTE_PAIR(0xEDC1, 0x66BF)
+DOUBLE_BYTE_PAIR(0xEDC2, 0x66FA)
+DOUBLE_BYTE_PAIR(0xEDC3, 0x670E)
+DOUBLE_BYTE_PAIR(0xEDC4, 0xF929)
+DOUBLE_BYTE_PAIR(0xEDC5, 0x6766)
+DOUBLE_BYTE_PAIR(0xEDC6, 0x67BB)
+DOUBLE_BYTE_PAIR(0xEDC7, 0x6852)
+DOUBLE_BYTE_PAIR(0xEDC8, 0x67C0)
+DOUBLE_BYTE_PAIR(0xEDC9, 0x6801)
+DOUBLE_BYTE_PAIR(0xEDCA, 0x6844)
+DOUBLE_BYTE_PAIR(0xEDCB, 0x68CF)
+DOUBLE_BYTE_PAIR(0xEDCC, 0xFA13)
+DOUBLE_BYTE_PAIR(0xEDCD, 0x6968)
+DOUBLE_BYTE_PAIR(0xEDCE, 0xFA14)
+DOUBLE_BYTE_PAIR(0xEDCF, 0x6998)
+DOUBLE_BYTE_PAIR(0xEDD0, 0x69E2)
+DOUBLE_BYTE_PAIR(0xEDD1, 0x6A30)
+DOUBLE_BYTE_PAIR(0xEDD2, 0x6A6B)
+DOUBLE_BYTE_PAIR(0xEDD3, 0x6A46)
+DOUBLE_BYTE_PAIR(0xEDD4, 0x6A73)
+DOUBLE_BYTE_PAIR(0xEDD5, 0x6A7E)
+DOUBLE_BYTE_PAIR(0xEDD6, 0x6AE2)
+DOUBLE_BYTE_PAIR(0xEDD7, 0x6AE4)
+DOUBLE_BYTE_PAIR(0xEDD8, 0x6BD6)
+DOUBLE_BYTE_PAIR(0xEDD9, 0x6C3F)
+DOUBLE_BYTE_PAIR(0xEDDA, 0x6C5C)
+DOUBLE_BYTE_PAIR(0xEDDB, 0x6C86)
+DOUBLE_BYTE_PAIR(0xEDDC, 0x6C6F)
+DOUBLE_BYTE_PAIR(0xEDDD, 0x6CDA)
+DOUBLE_BYTE_PAIR(0xEDDE, 0x6D04)
+DOUBLE_BYTE_PAIR(0xEDDF, 0x6D87)
+DOUBLE_BYTE_PAIR(0xEDE0, 0x6D6F)
+DOUBLE_BYTE_PAIR(0xEDE1, 0x6D96)
+DOUBLE_BYTE_PAIR(0xEDE2, 0x6DAC)
+DOUBLE_BYTE_PAIR(0xEDE3, 0x6DCF)
+DOUBLE_BYTE_PAIR(0xEDE4, 0x6DF8)
+DOUBLE_BYTE_PAIR(0xEDE5, 0x6DF2)
+DOUBLE_BYTE_PAIR(0xEDE6, 0x6DFC)
+DOUBLE_BYTE_PAIR(0xEDE7, 0x6E39)
+DOUBLE_BYTE_PAIR(0xEDE8, 0x6E5C)
+DOUBLE_BYTE_PAIR(0xEDE9, 0x6E27)
+DOUBLE_BYTE_PAIR(0xEDEA, 0x6E3C)
+DOUBLE_BYTE_PAIR(0xEDEB, 0x6EBF)
+DOUBLE_BYTE_PAIR(0xEDEC, 0x6F88)
+DOUBLE_BYTE_PAIR(0xEDED, 0x6FB5)
+DOUBLE_BYTE_PAIR(0xEDEE, 0x6FF5)
+DOUBLE_BYTE_PAIR(0xEDEF, 0x7005)
+DOUBLE_BYTE_PAIR(0xEDF0, 0x7007)
+DOUBLE_BYTE_PAIR(0xEDF1, 0x7028)
+DOUBLE_BYTE_PAIR(0xEDF2, 0x7085)
+DOUBLE_BYTE_PAIR(0xEDF3, 0x70AB)
+DOUBLE_BYTE_PAIR(0xEDF4, 0x710F)
+DOUBLE_BYTE_PAIR(0xEDF5, 0x7104)
+DOUBLE_BYTE_PAIR(0xEDF6, 0x715C)
+DOUBLE_BYTE_PAIR(0xEDF7, 0x7146)
+DOUBLE_BYTE_PAIR(0xEDF8, 0x7147)
+DOUBLE_BYTE_PAIR(0xEDF9, 0xFA15)
+DOUBLE_BYTE_PAIR(0xEDFA, 0x71C1)
+DOUBLE_BYTE_PAIR(0xEDFB, 0x71FE)
+DOUBLE_BYTE_PAIR(0xEDFC, 0x72B1)
+DOUBLE_BYTE_PAIR(0xEE40, 0x72BE)
+DOUBLE_BYTE_PAIR(0xEE41, 0x7324)
+DOUBLE_BYTE_PAIR(0xEE42, 0xFA16)
+DOUBLE_BYTE_PAIR(0xEE43, 0x7377)
+DOUBLE_BYTE_PAIR(0xEE44, 0x73BD)
+DOUBLE_BYTE_PAIR(0xEE45, 0x73C9)
+DOUBLE_BYTE_PAIR(0xEE46, 0x73D6)
+DOUBLE_BYTE_PAIR(0xEE47, 0x73E3)
+DOUBLE_BYTE_PAIR(0xEE48, 0x73D2)
+DOUBLE_BYTE_PAIR(0xEE49, 0x7407)
+DOUBLE_BYTE_PAIR(0xEE4A, 0x73F5)
+DOUBLE_BYTE_PAIR(0xEE4B, 0x7426)
+DOUBLE_BYTE_PAIR(0xEE4C, 0x742A)
+DOUBLE_BYTE_PAIR(0xEE4D, 0x7429)
+DOUBLE_BYTE_PAIR(0xEE4E, 0x742E)
+DOUBLE_BYTE_PAIR(0xEE4F, 0x7462)
+DOUBLE_BYTE_PAIR(0xEE50, 0x7489)
+DOUBLE_BYTE_PAIR(0xEE51, 0x749F)
+DOUBLE_BYTE_PAIR(0xEE52, 0x7501)
+DOUBLE_BYTE_PAIR(0xEE53, 0x756F)
+DOUBLE_BYTE_PAIR(0xEE54, 0x7682)
+DOUBLE_BYTE_PAIR(0xEE55, 0x769C)
+DOUBLE_BYTE_PAIR(0xEE56, 0x769E)
+DOUBLE_BYTE_PAIR(0xEE57, 0x769B)
+DOUBLE_BYTE_PAIR(0xEE58, 0x76A6)
+DOUBLE_BYTE_PAIR(0xEE59, 0xFA17)
+DOUBLE_BYTE_PAIR(0xEE5A, 0x7746)
+DOUBLE_BYTE_PAIR(0xEE5B, 0x52AF)
+DOUBLE_BYTE_PAIR(0xEE5C, 0x7821)
+DOUBLE_BYTE_PAIR(0xEE5D, 0x784E)
+DOUBLE_BYTE_PAIR(0xEE5E, 0x7864)
+DOUBLE_BYTE_PAIR(0xEE5F, 0x787A)
+DOUBLE_BYTE_PAIR(0xEE60, 0x7930)
+DOUBLE_BYTE_PAIR(0xEE61, 0xFA18)
+DOUBLE_BYTE_PAIR(0xEE62, 0xFA19)
+DOUBLE_BYTE_PAIR(0xEE63, 0xFA1A)
+DOUBLE_BYTE_PAIR(0xEE64, 0x7994)
+DOUBLE_BYTE_PAIR(0xEE65, 0xFA1B)
+DOUBLE_BYTE_PAIR(0xEE66, 0x799B)
+DOUBLE_BYTE_PAIR(0xEE67, 0x7AD1)
+DOUBLE_BYTE_PAIR(0xEE68, 0x7AE7)
+DOUBLE_BYTE_PAIR(0xEE69, 0xFA1C)
+DOUBLE_BYTE_PAIR(0xEE6A, 0x7AEB)
+DOUBLE_BYTE_PAIR(0xEE6B, 0x7B9E)
+DOUBLE_BYTE_PAIR(0xEE6C, 0xFA1D)
+DOUBLE_BYTE_PAIR(0xEE6D, 0x7D48)
+DOUBLE_BYTE_PAIR(0xEE6E, 0x7D5C)
+DOUBLE_BYTE_PAIR(0xEE6F, 0x7DB7)
+DOUBLE_BYTE_PAIR(0xEE70, 0x7DA0)
+DOUBLE_BYTE_PAIR(0xEE71, 0x7DD6)
+DOUBLE_BYTE_PAIR(0xEE72, 0x7E52)
+DOUBLE_BYTE_PAIR(0xEE73, 0x7F47)
+DOUBLE_BYTE_PAIR(0xEE74, 0x7FA1)
+DOUBLE_BYTE_PAIR(0xEE75, 0xFA1E)
+DOUBLE_BYTE_PAIR(0xEE76, 0x8301)
+DOUBLE_BYTE_PAIR(0xEE77, 0x8362)
+DOUBLE_BYTE_PAIR(0xEE78, 0x837F)
+DOUBLE_BYTE_PAIR(0xEE79, 0x83C7)
+DOUBLE_BYTE_PAIR(0xEE7A, 0x83F6)
+DOUBLE_BYTE_PAIR(0xEE7B, 0x8448)
+DOUBLE_BYTE_PAIR(0xEE7C, 0x84B4)
+DOUBLE_BYTE_PAIR(0xEE7D, 0x8553)
+DOUBLE_BYTE_PAIR(0xEE7E, 0x8559)
+DOUBLE_BYTE_PAIR(0xEE80, 0x856B)
+DOUBLE_BYTE_PAIR(0xEE81, 0xFA1F)
+DOUBLE_BYTE_PAIR(0xEE82, 0x85B0)
+DOUBLE_BYTE_PAIR(0xEE83, 0xFA20)
+DOUBLE_BYTE_PAIR(0xEE84, 0xFA21)
+DOUBLE_BYTE_PAIR(0xEE85, 0x8807)
+DOUBLE_BYTE_PAIR(0xEE86, 0x88F5)
+DOUBLE_BYTE_PAIR(0xEE87, 0x8A12)
+DOUBLE_BYTE_PAIR(0xEE88, 0x8A37)
+DOUBLE_BYTE_PAIR(0xEE89, 0x8A79)
+DOUBLE_BYTE_PAIR(0xEE8A, 0x8AA7)
+DOUBLE_BYTE_PAIR(0xEE8B, 0x8ABE)
+DOUBLE_BYTE_PAIR(0xEE8C, 0x8ADF)
+DOUBLE_BYTE_PAIR(0xEE8D, 0xFA22)
+DOUBLE_BYTE_PAIR(0xEE8E, 0x8AF6)
+DOUBLE_BYTE_PAIR(0xEE8F, 0x8B53)
+DOUBLE_BYTE_PAIR(0xEE90, 0x8B7F)
+DOUBLE_BYTE_PAIR(0xEE91, 0x8CF0)
+DOUBLE_BYTE_PAIR(0xEE92, 0x8CF4)
+DOUBLE_BYTE_PAIR(0xEE93, 0x8D12)
+DOUBLE_BYTE_PAIR(0xEE94, 0x8D76)
+DOUBLE_BYTE_PAIR(0xEE95, 0xFA23)
+DOUBLE_BYTE_PAIR(0xEE96, 0x8ECF)
+DOUBLE_BYTE_PAIR(0xEE97, 0xFA24)
+DOUBLE_BYTE_PAIR(0xEE98, 0xFA25)
+DOUBLE_BYTE_PAIR(0xEE99, 0x9067)
+DOUBLE_BYTE_PAIR(0xEE9A, 0x90DE)
+DOUBLE_BYTE_PAIR(0xEE9B, 0xFA26)
+DOUBLE_BYTE_PAIR(0xEE9C, 0x9115)
+DOUBLE_BYTE_PAIR(0xEE9D, 0x9127)
+DOUBLE_BYTE_PAIR(0xEE9E, 0x91DA)
+DOUBLE_BYTE_PAIR(0xEE9F, 0x91D7)
+DOUBLE_BYTE_PAIR(0xEEA0, 0x91DE)
+DOUBLE_BYTE_PAIR(0xEEA1, 0x91ED)
+DOUBLE_BYTE_PAIR(0xEEA2, 0x91EE)
+DOUBLE_BYTE_PAIR(0xEEA3, 0x91E4)
+DOUBLE_BYTE_PAIR(0xEEA4, 0x91E5)
+DOUBLE_BYTE_PAIR(0xEEA5, 0x9206)
+DOUBLE_BYTE_PAIR(0xEEA6, 0x9210)
+DOUBLE_BYTE_PAIR(0xEEA7, 0x920A)
+DOUBLE_BYTE_PAIR(0xEEA8, 0x923A)
+DOUBLE_BYTE_PAIR(0xEEA9, 0x9240)
+DOUBLE_BYTE_PAIR(0xEEAA, 0x923C)
+DOUBLE_BYTE_PAIR(0xEEAB, 0x924E)
+DOUBLE_BYTE_PAIR(0xEEAC, 0x9259)
+DOUBLE_BYTE_PAIR(0xEEAD, 0x9251)
+DOUBLE_BYTE_PAIR(0xEEAE, 0x9239)
+DOUBLE_BYTE_PAIR(0xEEAF, 0x9267)
+DOUBLE_BYTE_PAIR(0xEEB0, 0x92A7)
+DOUBLE_BYTE_PAIR(0xEEB1, 0x9277)
+DOUBLE_BYTE_PAIR(0xEEB2, 0x9278)
+DOUBLE_BYTE_PAIR(0xEEB3, 0x92E7)
+DOUBLE_BYTE_PAIR(0xEEB4, 0x92D7)
+DOUBLE_BYTE_PAIR(0xEEB5, 0x92D9)
+DOUBLE_BYTE_PAIR(0xEEB6, 0x92D0)
+DOUBLE_BYTE_PAIR(0xEEB7, 0xFA27)
+DOUBLE_BYTE_PAIR(0xEEB8, 0x92D5)
+DOUBLE_BYTE_PAIR(0xEEB9, 0x92E0)
+DOUBLE_BYTE_PAIR(0xEEBA, 0x92D3)
+DOUBLE_BYTE_PAIR(0xEEBB, 0x9325)
+DOUBLE_BYTE_PAIR(0xEEBC, 0x9321)
+DOUBLE_BYTE_PAIR(0xEEBD, 0x92FB)
+DOUBLE_BYTE_PAIR(0xEEBE, 0xFA28)
+DOUBLE_BYTE_PAIR(0xEEBF, 0x931E)
+DOUBLE_BYTE_PAIR(0xEEC0, 0x92FF)
+DOUBLE_BYTE_PAIR(0xEEC1, 0x931D)
+DOUBLE_BYTE_PAIR(0xEEC2, 0x9302)
+DOUBLE_BYTE_PAIR(0xEEC3, 0x9370)
+DOUBLE_BYTE_PAIR(0xEEC4, 0x9357)
+DOUBLE_BYTE_PAIR(0xEEC5, 0x93A4)
+DOUBLE_BYTE_PAIR(0xEEC6, 0x93C6)
+DOUBLE_BYTE_PAIR(0xEEC7, 0x93DE)
+DOUBLE_BYTE_PAIR(0xEEC8, 0x93F8)
+DOUBLE_BYTE_PAIR(0xEEC9, 0x9431)
+DOUBLE_BYTE_PAIR(0xEECA, 0x9445)
+DOUBLE_BYTE_PAIR(0xEECB, 0x9448)
+DOUBLE_BYTE_PAIR(0xEECC, 0x9592)
+DOUBLE_BYTE_PAIR(0xEECD, 0xF9DC)
+DOUBLE_BYTE_PAIR(0xEECE, 0xFA29)
+DOUBLE_BYTE_PAIR(0xEECF, 0x969D)
+DOUBLE_BYTE_PAIR(0xEED0, 0x96AF)
+DOUBLE_BYTE_PAIR(0xEED1, 0x9733)
+DOUBLE_BYTE_PAIR(0xEED2, 0x973B)
+DOUBLE_BYTE_PAIR(0xEED3, 0x9743)
+DOUBLE_BYTE_PAIR(0xEED4, 0x974D)
+DOUBLE_BYTE_PAIR(0xEED5, 0x974F)
+DOUBLE_BYTE_PAIR(0xEED6, 0x9751)
+DOUBLE_BYTE_PAIR(0xEED7, 0x9755)
+DOUBLE_BYTE_PAIR(0xEED8, 0x9857)
+DOUBLE_BYTE_PAIR(0xEED9, 0x9865)
+DOUBLE_BYTE_PAIR(0xEEDA, 0xFA2A)
+DOUBLE_BYTE_PAIR(0xEEDB, 0xFA2B)
+DOUBLE_BYTE_PAIR(0xEEDC, 0x9927)
+DOUBLE_BYTE_PAIR(0xEEDD, 0xFA2C)
+DOUBLE_BYTE_PAIR(0xEEDE, 0x999E)
+DOUBLE_BYTE_PAIR(0xEEDF, 0x9A4E)
+DOUBLE_BYTE_PAIR(0xEEE0, 0x9AD9)
+DOUBLE_BYTE_PAIR(0xEEE1, 0x9ADC)
+DOUBLE_BYTE_PAIR(0xEEE2, 0x9B75)
+DOUBLE_BYTE_PAIR(0xEEE3, 0x9B72)
+DOUBLE_BYTE_PAIR(0xEEE4, 0x9B8F)
+DOUBLE_BYTE_PAIR(0xEEE5, 0x9BB1)
+DOUBLE_BYTE_PAIR(0xEEE6, 0x9BBB)
+DOUBLE_BYTE_PAIR(0xEEE7, 0x9C00)
+DOUBLE_BYTE_PAIR(0xEEE8, 0x9D70)
+DOUBLE_BYTE_PAIR(0xEEE9, 0x9D6B)
+DOUBLE_BYTE_PAIR(0xEEEA, 0xFA2D)
+DOUBLE_BYTE_PAIR(0xEEEB, 0x9E19)
+DOUBLE_BYTE_PAIR(0xEEEC, 0x9ED1)
+DOUBLE_BYTE_PAIR(0xEEEF, 0x2170)
+DOUBLE_BYTE_PAIR(0xEEF0, 0x2171)
+DOUBLE_BYTE_PAIR(0xEEF1, 0x2172)
+DOUBLE_BYTE_PAIR(0xEEF2, 0x2173)
+DOUBLE_BYTE_PAIR(0xEEF3, 0x2174)
+DOUBLE_BYTE_PAIR(0xEEF4, 0x2175)
+DOUBLE_BYTE_PAIR(0xEEF5, 0x2176)
+DOUBLE_BYTE_PAIR(0xEEF6, 0x2177)
+DOUBLE_BYTE_PAIR(0xEEF7, 0x2178)
+DOUBLE_BYTE_PAIR(0xEEF8, 0x2179)
+DOUBLE_BYTE_PAIR(0xEEF9, 0xFFE2)
+DOUBLE_BYTE_PAIR(0xEEFA, 0xFFE4)
+DOUBLE_BYTE_PAIR(0xEEFB, 0xFF07)
+DOUBLE_BYTE_PAIR(0xEEFC, 0xFF02)
+DOUBLE_BYTE_PAIR(0xF040, 0xE000)
+DOUBLE_BYTE_PAIR(0xF041, 0xE001)
+DOUBLE_BYTE_PAIR(0xF042, 0xE002)
+DOUBLE_BYTE_PAIR(0xF043, 0xE003)
+DOUBLE_BYTE_PAIR(0xF044, 0xE004)
+DOUBLE_BYTE_PAIR(0xF045, 0xE005)
+DOUBLE_BYTE_PAIR(0xF046, 0xE006)
+DOUBLE_BYTE_PAIR(0xF047, 0xE007)
+DOUBLE_BYTE_PAIR(0xF048, 0xE008)
+DOUBLE_BYTE_PAIR(0xF049, 0xE009)
+DOUBLE_BYTE_PAIR(0xF04A, 0xE00A)
+DOUBLE_BYTE_PAIR(0xF04B, 0xE00B)
+DOUBLE_BYTE_PAIR(0xF04C, 0xE00C)
+DOUBLE_BYTE_PAIR(0xF04D, 0xE00D)
+DOUBLE_BYTE_PAIR(0xF04E, 0xE00E)
+DOUBLE_BYTE_PAIR(0xF04F, 0xE00F)
+DOUBLE_BYTE_PAIR(0xF050, 0xE010)
+DOUBLE_BYTE_PAIR(0xF051, 0xE011)
+DOUBLE_BYTE_PAIR(0xF052, 0xE012)
+DOUBLE_BYTE_PAIR(0xF053, 0xE013)
+DOUBLE_BYTE_PAIR(0xF054, 0xE014)
+DOUBLE_BYTE_PAIR(0xF055, 0xE015)
+DOUBLE_BYTE_PAIR(0xF056, 0xE016)
+DOUBLE_BYTE_PAIR(0xF057, 0xE017)
+DOUBLE_BYTE_PAIR(0xF058, 0xE018)
+DOUBLE_BYTE_PAIR(0xF059, 0xE019)
+DOUBLE_BYTE_PAIR(0xF05A, 0xE01A)
+DOUBLE_BYTE_PAIR(0xF05B, 0xE01B)
+DOUBLE_BYTE_PAIR(0xF05C, 0xE01C)
+DOUBLE_BYTE_PAIR(0xF05D, 0xE01D)
+DOUBLE_BYTE_PAIR(0xF05E, 0xE01E)
+DOUBLE_BYTE_PAIR(0xF05F, 0xE01F)
+DOUBLE_BYTE_PAIR(0xF060, 0xE020)
+DOUBLE_BYTE_PAIR(0xF061, 0xE021)
+DOUBLE_BYTE_PAIR(0xF062, 0xE022)
+DOUBLE_BYTE_PAIR(0xF063, 0xE023)
+DOUBLE_BYTE_PAIR(0xF064, 0xE024)
+DOUBLE_BYTE_PAIR(0xF065, 0xE025)
+DOUBLE_BYTE_PAIR(0xF066, 0xE026)
+DOUBLE_BYTE_PAIR(0xF067, 0xE027)
+DOUBLE_BYTE_PAIR(0xF068, 0xE028)
+DOUBLE_BYTE_PAIR(0xF069, 0xE029)
+DOUBLE_BYTE_PAIR(0xF06A, 0xE02A)
+DOUBLE_BYTE_PAIR(0xF06B, 0xE02B)
+DOUBLE_BYTE_PAIR(0xF06C, 0xE02C)
+DOUBLE_BYTE_PAIR(0xF06D, 0xE02D)
+DOUBLE_BYTE_PAIR(0xF06E, 0xE02E)
+DOUBLE_BYTE_PAIR(0xF06F, 0xE02F)
+DOUBLE_BYTE_PAIR(0xF070, 0xE030)
+DOUBLE_BYTE_PAIR(0xF071, 0xE031)
+DOUBLE_BYTE_PAIR(0xF072, 0xE032)
+DOUBLE_BYTE_PAIR(0xF073, 0xE033)
+DOUBLE_BYTE_PAIR(0xF074, 0xE034)
+DOUBLE_BYTE_PAIR(0xF075, 0xE035)
+DOUBLE_BYTE_PAIR(0xF076, 0xE036)
+DOUBLE_BYTE_PAIR(0xF077, 0xE037)
+DOUBLE_BYTE_PAIR(0xF078, 0xE038)
+DOUBLE_BYTE_PAIR(0xF079, 0xE039)
+DOUBLE_BYTE_PAIR(0xF07A, 0xE03A)
+DOUBLE_BYTE_PAIR(0xF07B, 0xE03B)
+DOUBLE_BYTE_PAIR(0xF07C, 0xE03C)
+DOUBLE_BYTE_PAIR(0xF07D, 0xE03D)
+DOUBLE_BYTE_PAIR(0xF07E, 0xE03E)
+DOUBLE_BYTE_PAIR(0xF080, 0xE03F)
+DOUBLE_BYTE_PAIR(0xF081, 0xE040)
+DOUBLE_BYTE_PAIR(0xF082, 0xE041)
+DOUBLE_BYTE_PAIR(0xF083, 0xE042)
+DOUBLE_BYTE_PAIR(0xF084, 0xE043)
+DOUBLE_BYTE_PAIR(0xF085, 0xE044)
+DOUBLE_BYTE_PAIR(0xF086, 0xE045)
+DOUBLE_BYTE_PAIR(0xF087, 0xE046)
+DOUBLE_BYTE_PAIR(0xF088, 0xE047)
+DOUBLE_BYTE_PAIR(0xF089, 0xE048)
+DOUBLE_BYTE_PAIR(0xF08A, 0xE049)
+DOUBLE_BYTE_PAIR(0xF08B, 0xE04A)
+DOUBLE_BYTE_PAIR(0xF08C, 0xE04B)
+DOUBLE_BYTE_PAIR(0xF08D, 0xE04C)
+DOUBLE_BYTE_PAIR(0xF08E, 0xE04D)
+DOUBLE_BYTE_PAIR(0xF08F, 0xE04E)
+DOUBLE_BYTE_PAIR(0xF090, 0xE04F)
+DOUBLE_BYTE_PAIR(0xF091, 0xE050)
+DOUBLE_BYTE_PAIR(0xF092, 0xE051)
+DOUBLE_BYTE_PAIR(0xF093, 0xE052)
+DOUBLE_BYTE_PAIR(0xF094, 0xE053)
+DOUBLE_BYTE_PAIR(0xF095, 0xE054)
+DOUBLE_BYTE_PAIR(0xF096, 0xE055)
+DOUBLE_BYTE_PAIR(0xF097, 0xE056)
+DOUBLE_BYTE_PAIR(0xF098, 0xE057)
+DOUBLE_BYTE_PAIR(0xF099, 0xE058)
+DOUBLE_BYTE_PAIR(0xF09A, 0xE059)
+DOUBLE_BYTE_PAIR(0xF09B, 0xE05A)
+DOUBLE_BYTE_PAIR(0xF09C, 0xE05B)
+DOUBLE_BYTE_PAIR(0xF09D, 0xE05C)
+DOUBLE_BYTE_PAIR(0xF09E, 0xE05D)
+DOUBLE_BYTE_PAIR(0xF09F, 0xE05E)
+DOUBLE_BYTE_PAIR(0xF0A0, 0xE05F)
+DOUBLE_BYTE_PAIR(0xF0A1, 0xE060)
+DOUBLE_BYTE_PAIR(0xF0A2, 0xE061)
+DOUBLE_BYTE_PAIR(0xF0A3, 0xE062)
+DOUBLE_BYTE_PAIR(0xF0A4, 0xE063)
+DOUBLE_BYTE_PAIR(0xF0A5, 0xE064)
+DOUBLE_BYTE_PAIR(0xF0A6, 0xE065)
+DOUBLE_BYTE_PAIR(0xF0A7, 0xE066)
+DOUBLE_BYTE_PAIR(0xF0A8, 0xE067)
+DOUBLE_BYTE_PAIR(0xF0A9, 0xE068)
+DOUBLE_BYTE_PAIR(0xF0AA, 0xE069)
+DOUBLE_BYTE_PAIR(0xF0AB, 0xE06A)
+DOUBLE_BYTE_PAIR(0xF0AC, 0xE06B)
+DOUBLE_BYTE_PAIR(0xF0AD, 0xE06C)
+DOUBLE_BYTE_PAIR(0xF0AE, 0xE06D)
+DOUBLE_BYTE_PAIR(0xF0AF, 0xE06E)
+DOUBLE_BYTE_PAIR(0xF0B0, 0xE06F)
+DOUBLE_BYTE_PAIR(0xF0B1, 0xE070)
+DOUBLE_BYTE_PAIR(0xF0B2, 0xE071)
+DOUBLE_BYTE_PAIR(0xF0B3, 0xE072)
+DOUBLE_BYTE_PAIR(0xF0B4, 0xE073)
+DOUBLE_BYTE_PAIR(0xF0B5, 0xE074)
+DOUBLE_BYTE_PAIR(0xF0B6, 0xE075)
+DOUBLE_BYTE_PAIR(0xF0B7, 0xE076)
+DOUBLE_BYTE_PAIR(0xF0B8, 0xE077)
+DOUBLE_BYTE_PAIR(0xF0B9, 0xE078)
+DOUBLE_BYTE_PAIR(0xF0BA, 0xE079)
+DOUBLE_BYTE_PAIR(0xF0BB, 0xE07A)
+DOUBLE_BYTE_PAIR(0xF0BC, 0xE07B)
+DOUBLE_BYTE_PAIR(0xF0BD, 0xE07C)
+DOUBLE_BYTE_PAIR(0xF0BE, 0xE07D)
+DOUBLE_BYTE_PAIR(0xF0BF, 0xE07E)
+DOUBLE_BYTE_PAIR(0xF0C0, 0xE07F)
+DOUBLE_BYTE_PAIR(0xF0C1, 0xE080)
+DOUBLE_BYTE_PAIR(0xF0C2, 0xE081)
+DOUBLE_BYTE_PAIR(0xF0C3, 0xE082)
+DOUBLE_BYTE_PAIR(0xF0C4, 0xE083)
+DOUBLE_BYTE_PAIR(0xF0C5, 0xE084)
+DOUBLE_BYTE_PAIR(0xF0C6, 0xE085)
+DOUBLE_BYTE_PAIR(0xF0C7, 0xE086)
+DOUBLE_BYTE_PAIR(0xF0C8, 0xE087)
+DOUBLE_BYTE_PAIR(0xF0C9, 0xE088)
+DOUBLE_BYTE_PAIR(0xF0CA, 0xE089)
+DOUBLE_BYTE_PAIR(0xF0CB, 0xE08A)
+DOUBLE_BYTE_PAIR(0xF0CC, 0xE08B)
+DOUBLE_BYTE_PAIR(0xF0CD, 0xE08C)
+DOUBLE_BYTE_PAIR(0xF0CE, 0xE08D)
+DOUBLE_BYTE_PAIR(0xF0CF, 0xE08E)
+DOUBLE_BYTE_PAIR(0xF0D0, 0xE08F)
+DOUBLE_BYTE_PAIR(0xF0D1, 0xE090)
+DOUBLE_BYTE_PAIR(0xF0D2, 0xE091)
+DOUBLE_BYTE_PAIR(0xF0D3, 0xE092)
+DOUBLE_BYTE_PAIR(0xF0D4, 0xE093)
+DOUBLE_BYTE_PAIR(0xF0D5, 0xE094)
+DOUBLE_BYTE_PAIR(0xF0D6, 0xE095)
+DOUBLE_BYTE_PAIR(0xF0D7, 0xE096)
+DOUBLE_BYTE_PAIR(0xF0D8, 0xE097)
+DOUBLE_BYTE_PAIR(0xF0D9, 0xE098)
+DOUBLE_BYTE_PAIR(0xF0DA, 0xE099)
+DOUBLE_BYTE_PAIR(0xF0DB, 0xE09A)
+DOUBLE_BYTE_PAIR(0xF0DC, 0xE09B)
+DOUBLE_BYTE_PAIR(0xF0DD, 0xE09C)
+DOUBLE_BYTE_PAIR(0xF0DE, 0xE09D)
+DOUBLE_BYTE_PAIR(0xF0DF, 0xE09E)
+DOUBLE_BYTE_PAIR(0xF0E0, 0xE09F)
+DOUBLE_BYTE_PAIR(0xF0E1, 0xE0A0)
+DOUBLE_BYTE_PAIR(0xF0E2, 0xE0A1)
+DOUBLE_BYTE_PAIR(0xF0E3, 0xE0A2)
+DOUBLE_BYTE_PAIR(0xF0E4, 0xE0A3)
+DOUBLE_BYTE_PAIR(0xF0E5, 0xE0A4)
+DOUBLE_BYTE_PAIR(0xF0E6, 0xE0A5)
+DOUBLE_BYTE_PAIR(0xF0E7, 0xE0A6)
+DOUBLE_BYTE_PAIR(0xF0E8, 0xE0A7)
+DOUBLE_BYTE_PAIR(0xF0E9, 0xE0A8)
+DOUBLE_BYTE_PAIR(0xF0EA, 0xE0A9)
+DOUBLE_BYTE_PAIR(0xF0EB, 0xE0AA)
+DOUBLE_BYTE_PAIR(0xF0EC, 0xE0AB)
+DOUBLE_BYTE_PAIR(0xF0ED, 0xE0AC)
+DOUBLE_BYTE_PAIR(0xF0EE, 0xE0AD)
+DOUBLE_BYTE_PAIR(0xF0EF, 0xE0AE)
+DOUBLE_BYTE_PAIR(0xF0F0, 0xE0AF)
+DOUBLE_BYTE_PAIR(0xF0F1, 0xE0B0)
+DOUBLE_BYTE_PAIR(0xF0F2, 0xE0B1)
+DOUBLE_BYTE_PAIR(0xF0F3, 0xE0B2)
+DOUBLE_BYTE_PAIR(0xF0F4, 0xE0B3)
+DOUBLE_BYTE_PAIR(0xF0F5, 0xE0B4)
+DOUBLE_BYTE_PAIR(0xF0F6, 0xE0B5)
+DOUBLE_BYTE_PAIR(0xF0F7, 0xE0B6)
+DOUBLE_BYTE_PAIR(0xF0F8, 0xE0B7)
+DOUBLE_BYTE_PAIR(0xF0F9, 0xE0B8)
+DOUBLE_BYTE_PAIR(0xF0FA, 0xE0B9)
+DOUBLE_BYTE_PAIR(0xF0FB, 0xE0BA)
+DOUBLE_BYTE_PAIR(0xF0FC, 0xE0BB)
+DOUBLE_BYTE_PAIR(0xF140, 0xE0BC)
+DOUBLE_BYTE_PAIR(0xF141, 0xE0BD)
+DOUBLE_BYTE_PAIR(0xF142, 0xE0BE)
+DOUBLE_BYTE_PAIR(0xF143, 0xE0BF)
+DOUBLE_BYTE_PAIR(0xF144, 0xE0C0)
+DOUBLE_BYTE_PAIR(0xF145, 0xE0C1)
+DOUBLE_BYTE_PAIR(0xF146, 0xE0C2)
+DOUBLE_BYTE_PAIR(0xF147, 0xE0C3)
+DOUBLE_BYTE_PAIR(0xF148, 0xE0C4)
+DOUBLE_BYTE_PAIR(0xF149, 0xE0C5)
+DOUBLE_BYTE_PAIR(0xF14A, 0xE0C6)
+DOUBLE_BYTE_PAIR(0xF14B, 0xE0C7)
+DOUBLE_BYTE_PAIR(0xF14C, 0xE0C8)
+DOUBLE_BYTE_PAIR(0xF14D, 0xE0C9)
+DOUBLE_BYTE_PAIR(0xF14E, 0xE0CA)
+DOUBLE_BYTE_PAIR(0xF14F, 0xE0CB)
+DOUBLE_BYTE_PAIR(0xF150, 0xE0CC)
+DOUBLE_BYTE_PAIR(0xF151, 0xE0CD)
+DOUBLE_BYTE_PAIR(0xF152, 0xE0CE)
+DOUBLE_BYTE_PAIR(0xF153, 0xE0CF)
+DOUBLE_BYTE_PAIR(0xF154, 0xE0D0)
+DOUBLE_BYTE_PAIR(0xF155, 0xE0D1)
+DOUBLE_BYTE_PAIR(0xF156, 0xE0D2)
+DOUBLE_BYTE_PAIR(0xF157, 0xE0D3)
+DOUBLE_BYTE_PAIR(0xF158, 0xE0D4)
+DOUBLE_BYTE_PAIR(0xF159, 0xE0D5)
+DOUBLE_BYTE_PAIR(0xF15A, 0xE0D6)
+DOUBLE_BYTE_PAIR(0xF15B, 0xE0D7)
+DOUBLE_BYTE_PAIR(0xF15C, 0xE0D8)
+DOUBLE_BYTE_PAIR(0xF15D, 0xE0D9)
+DOUBLE_BYTE_PAIR(0xF15E, 0xE0DA)
+DOUBLE_BYTE_PAIR(0xF15F, 0xE0DB)
+DOUBLE_BYTE_PAIR(0xF160, 0xE0DC)
+DOUBLE_BYTE_PAIR(0xF161, 0xE0DD)
+DOUBLE_BYTE_PAIR(0xF162, 0xE0DE)
+DOUBLE_BYTE_PAIR(0xF163, 0xE0DF)
+DOUBLE_BYTE_PAIR(0xF164, 0xE0E0)
+DOUBLE_BYTE_PAIR(0xF165, 0xE0E1)
+DOUBLE_BYTE_PAIR(0xF166, 0xE0E2)
+DOUBLE_BYTE_PAIR(0xF167, 0xE0E3)
+DOUBLE_BYTE_PAIR(0xF168, 0xE0E4)
+DOUBLE_BYTE_PAIR(0xF169, 0xE0E5)
+DOUBLE_BYTE_PAIR(0xF16A, 0xE0E6)
+DOUBLE_BYTE_PAIR(0xF16B, 0xE0E7)
+DOUBLE_BYTE_PAIR(0xF16C, 0xE0E8)
+DOUBLE_BYTE_PAIR(0xF16D, 0xE0E9)
+DOUBLE_BYTE_PAIR(0xF16E, 0xE0EA)
+DOUBLE_BYTE_PAIR(0xF16F, 0xE0EB)
+DOUBLE_BYTE_PAIR(0xF170, 0xE0EC)
+DOUBLE_BYTE_PAIR(0xF171, 0xE0ED)
+DOUBLE_BYTE_PAIR(0xF172, 0xE0EE)
+DOUBLE_BYTE_PAIR(0xF173, 0xE0EF)
+DOUBLE_BYTE_PAIR(0xF174, 0xE0F0)
+DOUBLE_BYTE_PAIR(0xF175, 0xE0F1)
+DOUBLE_BYTE_PAIR(0xF176, 0xE0F2)
+DOUBLE_BYTE_PAIR(0xF177, 0xE0F3)
+DOUBLE_BYTE_PAIR(0xF178, 0xE0F4)
+DOUBLE_BYTE_PAIR(0xF179, 0xE0F5)
+DOUBLE_BYTE_PAIR(0xF17A, 0xE0F6)
+DOUBLE_BYTE_PAIR(0xF17B, 0xE0F7)
+DOUBLE_BYTE_PAIR(0xF17C, 0xE0F8)
+DOUBLE_BYTE_PAIR(0xF17D, 0xE0F9)
+DOUBLE_BYTE_PAIR(0xF17E, 0xE0FA)
+DOUBLE_BYTE_PAIR(0xF180, 0xE0FB)
+DOUBLE_BYTE_PAIR(0xF181, 0xE0FC)
+DOUBLE_BYTE_PAIR(0xF182, 0xE0FD)
+DOUBLE_BYTE_PAIR(0xF183, 0xE0FE)
+DOUBLE_BYTE_PAIR(0xF184, 0xE0FF)
+DOUBLE_BYTE_PAIR(0xF185, 0xE100)
+DOUBLE_BYTE_PAIR(0xF186, 0xE101)
+DOUBLE_BYTE_PAIR(0xF187, 0xE102)
+DOUBLE_BYTE_PAIR(0xF188, 0xE103)
+DOUBLE_BYTE_PAIR(0xF189, 0xE104)
+DOUBLE_BYTE_PAIR(0xF18A, 0xE105)
+DOUBLE_BYTE_PAIR(0xF18B, 0xE106)
+DOUBLE_BYTE_PAIR(0xF18C, 0xE107)
+DOUBLE_BYTE_PAIR(0xF18D, 0xE108)
+DOUBLE_BYTE_PAIR(0xF18E, 0xE109)
+DOUBLE_BYTE_PAIR(0xF18F, 0xE10A)
+DOUBLE_BYTE_PAIR(0xF190, 0xE10B)
+DOUBLE_BYTE_PAIR(0xF191, 0xE10C)
+DOUBLE_BYTE_PAIR(0xF192, 0xE10D)
+DOUBLE_BYTE_PAIR(0xF193, 0xE10E)
+DOUBLE_BYTE_PAIR(0xF194, 0xE10F)
+DOUBLE_BYTE_PAIR(0xF195, 0xE110)
+DOUBLE_BYTE_PAIR(0xF196, 0xE111)
+DOUBLE_BYTE_PAIR(0xF197, 0xE112)
+DOUBLE_BYTE_PAIR(0xF198, 0xE113)
+DOUBLE_BYTE_PAIR(0xF199, 0xE114)
+DOUBLE_BYTE_PAIR(0xF19A, 0xE115)
+DOUBLE_BYTE_PAIR(0xF19B, 0xE116)
+DOUBLE_BYTE_PAIR(0xF19C, 0xE117)
+DOUBLE_BYTE_PAIR(0xF19D, 0xE118)
+DOUBLE_BYTE_PAIR(0xF19E, 0xE119)
+DOUBLE_BYTE_PAIR(0xF19F, 0xE11A)
+DOUBLE_BYTE_PAIR(0xF1A0, 0xE11B)
+DOUBLE_BYTE_PAIR(0xF1A1, 0xE11C)
+DOUBLE_BYTE_PAIR(0xF1A2, 0xE11D)
+DOUBLE_BYTE_PAIR(0xF1A3, 0xE11E)
+DOUBLE_BYTE_PAIR(0xF1A4, 0xE11F)
+DOUBLE_BYTE_PAIR(0xF1A5, 0xE120)
+DOUBLE_BYTE_PAIR(0xF1A6, 0xE121)
+DOUBLE_BYTE_PAIR(0xF1A7, 0xE122)
+DOUBLE_BYTE_PAIR(0xF1A8, 0xE123)
+DOUBLE_BYTE_PAIR(0xF1A9, 0xE124)
+DOUBLE_BYTE_PAIR(0xF1AA, 0xE125)
+DOUBLE_BYTE_PAIR(0xF1AB, 0xE126)
+DOUBLE_BYTE_PAIR(0xF1AC, 0xE127)
+DOUBLE_BYTE_PAIR(0xF1AD, 0xE128)
+DOUBLE_BYTE_PAIR(0xF1AE, 0xE129)
+DOUBLE_BYTE_PAIR(0xF1AF, 0xE12A)
+DOUBLE_BYTE_PAIR(0xF1B0, 0xE12B)
+DOUBLE_BYTE_PAIR(0xF1B1, 0xE12C)
+DOUBLE_BYTE_PAIR(0xF1B2, 0xE12D)
+DOUBLE_BYTE_PAIR(0xF1B3, 0xE12E)
+DOUBLE_BYTE_PAIR(0xF1B4, 0xE12F)
+DOUBLE_BYTE_PAIR(0xF1B5, 0xE130)
+DOUBLE_BYTE_PAIR(0xF1B6, 0xE131)
+DOUBLE_BYTE_PAIR(0xF1B7, 0xE132)
+DOUBLE_BYTE_PAIR(0xF1B8, 0xE133)
+DOUBLE_BYTE_PAIR(0xF1B9, 0xE134)
+DOUBLE_BYTE_PAIR(0xF1BA, 0xE135)
+DOUBLE_BYTE_PAIR(0xF1BB, 0xE136)
+DOUBLE_BYTE_PAIR(0xF1BC, 0xE137)
+DOUBLE_BYTE_PAIR(0xF1BD, 0xE138)
+DOUBLE_BYTE_PAIR(0xF1BE, 0xE139)
+DOUBLE_BYTE_PAIR(0xF1BF, 0xE13A)
+DOUBLE_BYTE_PAIR(0xF1C0, 0xE13B)
+DOUBLE_BYTE_PAIR(0xF1C1, 0xE13C)
+DOUBLE_BYTE_PAIR(0xF1C2, 0xE13D)
+DOUBLE_BYTE_PAIR(0xF1C3, 0xE13E)
+DOUBLE_BYTE_PAIR(0xF1C4, 0xE13F)
+DOUBLE_BYTE_PAIR(0xF1C5, 0xE140)
+DOUBLE_BYTE_PAIR(0xF1C6, 0xE141)
+DOUBLE_BYTE_PAIR(0xF1C7, 0xE142)
+DOUBLE_BYTE_PAIR(0xF1C8, 0xE143)
+DOUBLE_BYTE_PAIR(0xF1C9, 0xE144)
+DOUBLE_BYTE_PAIR(0xF1CA, 0xE145)
+DOUBLE_BYTE_PAIR(0xF1CB, 0xE146)
+DOUBLE_BYTE_PAIR(0xF1CC, 0xE147)
+DOUBLE_BYTE_PAIR(0xF1CD, 0xE148)
+DOUBLE_BYTE_PAIR(0xF1CE, 0xE149)
+DOUBLE_BYTE_PAIR(0xF1CF, 0xE14A)
+DOUBLE_BYTE_PAIR(0xF1D0, 0xE14B)
+DOUBLE_BYTE_PAIR(0xF1D1, 0xE14C)
+DOUBLE_BYTE_PAIR(0xF1D2, 0xE14D)
+DOUBLE_BYTE_PAIR(0xF1D3, 0xE14E)
+DOUBLE_BYTE_PAIR(0xF1D4, 0xE14F)
+DOUBLE_BYTE_PAIR(0xF1D5, 0xE150)
+DOUBLE_BYTE_PAIR(0xF1D6, 0xE151)
+DOUBLE_BYTE_PAIR(0xF1D7, 0xE152)
+DOUBLE_BYTE_PAIR(0xF1D8, 0xE153)
+DOUBLE_BYTE_PAIR(0xF1D9, 0xE154)
+DOUBLE_BYTE_PAIR(0xF1DA, 0xE155)
+DOUBLE_BYTE_PAIR(0xF1DB, 0xE156)
+DOUBLE_BYTE_PAIR(0xF1DC, 0xE157)
+DOUBLE_BYTE_PAIR(0xF1DD, 0xE158)
+DOUBLE_BYTE_PAIR(0xF1DE, 0xE159)
+DOUBLE_BYTE_PAIR(0xF1DF, 0xE15A)
+DOUBLE_BYTE_PAIR(0xF1E0, 0xE15B)
+DOUBLE_BYTE_PAIR(0xF1E1, 0xE15C)
+DOUBLE_BYTE_PAIR(0xF1E2, 0xE15D)
+DOUBLE_BYTE_PAIR(0xF1E3, 0xE15E)
+DOUBLE_BYTE_PAIR(0xF1E4, 0xE15F)
+DOUBLE_BYTE_PAIR(0xF1E5, 0xE160)
+DOUBLE_BYTE_PAIR(0xF1E6, 0xE161)
+DOUBLE_BYTE_PAIR(0xF1E7, 0xE162)
+DOUBLE_BYTE_PAIR(0xF1E8, 0xE163)
+DOUBLE_BYTE_PAIR(0xF1E9, 0xE164)
+DOUBLE_BYTE_PAIR(0xF1EA, 0xE165)
+DOUBLE_BYTE_PAIR(0xF1EB, 0xE166)
+DOUBLE_BYTE_PAIR(0xF1EC, 0xE167)
+DOUBLE_BYTE_PAIR(0xF1ED, 0xE168)
+DOUBLE_BYTE_PAIR(0xF1EE, 0xE169)
+DOUBLE_BYTE_PAIR(0xF1EF, 0xE16A)
+DOUBLE_BYTE_PAIR(0xF1F0, 0xE16B)
+DOUBLE_BYTE_PAIR(0xF1F1, 0xE16C)
+DOUBLE_BYTE_PAIR(0xF1F2, 0xE16D)
+DOUBLE_BYTE_PAIR(0xF1F3, 0xE16E)
+DOUBLE_BYTE_PAIR(0xF1F4, 0xE16F)
+DOUBLE_BYTE_PAIR(0xF1F5, 0xE170)
+DOUBLE_BYTE_PAIR(0xF1F6, 0xE171)
+DOUBLE_BYTE_PAIR(0xF1F7, 0xE172)
+DOUBLE_BYTE_PAIR(0xF1F8, 0xE173)
+DOUBLE_BYTE_PAIR(0xF1F9, 0xE174)
+DOUBLE_BYTE_PAIR(0xF1FA, 0xE175)
+DOUBLE_BYTE_PAIR(0xF1FB, 0xE176)
+DOUBLE_BYTE_PAIR(0xF1FC, 0xE177)
+DOUBLE_BYTE_PAIR(0xF240, 0xE178)
+DOUBLE_BYTE_PAIR(0xF241, 0xE179)
+DOUBLE_BYTE_PAIR(0xF242, 0xE17A)
+DOUBLE_BYTE_PAIR(0xF243, 0xE17B)
+DOUBLE_BYTE_PAIR(0xF244, 0xE17C)
+DOUBLE_BYTE_PAIR(0xF245, 0xE17D)
+DOUBLE_BYTE_PAIR(0xF246, 0xE17E)
+DOUBLE_BYTE_PAIR(0xF247, 0xE17F)
+DOUBLE_BYTE_PAIR(0xF248, 0xE180)
+DOUBLE_BYTE_PAIR(0xF249, 0xE181)
+DOUBLE_BYTE_PAIR(0xF24A, 0xE182)
+DOUBLE_BYTE_PAIR(0xF24B, 0xE183)
+DOUBLE_BYTE_PAIR(0xF24C, 0xE184)
+DOUBLE_BYTE_PAIR(0xF24D, 0xE185)
+DOUBLE_BYTE_PAIR(0xF24E, 0xE186)
+DOUBLE_BYTE_PAIR(0xF24F, 0xE187)
+DOUBLE_BYTE_PAIR(0xF250, 0xE188)
+DOUBLE_BYTE_PAIR(0xF251, 0xE189)
+DOUBLE_BYTE_PAIR(0xF252, 0xE18A)
+DOUBLE_BYTE_PAIR(0xF253, 0xE18B)
+DOUBLE_BYTE_PAIR(0xF254, 0xE18C)
+DOUBLE_BYTE_PAIR(0xF255, 0xE18D)
+DOUBLE_BYTE_PAIR(0xF256, 0xE18E)
+DOUBLE_BYTE_PAIR(0xF257, 0xE18F)
+DOUBLE_BYTE_PAIR(0xF258, 0xE190)
+DOUBLE_BYTE_PAIR(0xF259, 0xE191)
+DOUBLE_BYTE_PAIR(0xF25A, 0xE192)
+DOUBLE_BYTE_PAIR(0xF25B, 0xE193)
+DOUBLE_BYTE_PAIR(0xF25C, 0xE194)
+DOUBLE_BYTE_PAIR(0xF25D, 0xE195)
+DOUBLE_BYTE_PAIR(0xF25E, 0xE196)
+DOUBLE_BYTE_PAIR(0xF25F, 0xE197)
+DOUBLE_BYTE_PAIR(0xF260, 0xE198)
+DOUBLE_BYTE_PAIR(0xF261, 0xE199)
+DOUBLE_BYTE_PAIR(0xF262, 0xE19A)
+DOUBLE_BYTE_PAIR(0xF263, 0xE19B)
+DOUBLE_BYTE_PAIR(0xF264, 0xE19C)
+DOUBLE_BYTE_PAIR(0xF265, 0xE19D)
+DOUBLE_BYTE_PAIR(0xF266, 0xE19E)
+DOUBLE_BYTE_PAIR(0xF267, 0xE19F)
+DOUBLE_BYTE_PAIR(0xF268, 0xE1A0)
+DOUBLE_BYTE_PAIR(0xF269, 0xE1A1)
+DOUBLE_BYTE_PAIR(0xF26A, 0xE1A2)
+DOUBLE_BYTE_PAIR(0xF26B, 0xE1A3)
+DOUBLE_BYTE_PAIR(0xF26C, 0xE1A4)
+DOUBLE_BYTE_PAIR(0xF26D, 0xE1A5)
+DOUBLE_BYTE_PAIR(0xF26E, 0xE1A6)
+DOUBLE_BYTE_PAIR(0xF26F, 0xE1A7)
+DOUBLE_BYTE_PAIR(0xF270, 0xE1A8)
+DOUBLE_BYTE_PAIR(0xF271, 0xE1A9)
+DOUBLE_BYTE_PAIR(0xF272, 0xE1AA)
+DOUBLE_BYTE_PAIR(0xF273, 0xE1AB)
+DOUBLE_BYTE_PAIR(0xF274, 0xE1AC)
+DOUBLE_BYTE_PAIR(0xF275, 0xE1AD)
+DOUBLE_BYTE_PAIR(0xF276, 0xE1AE)
+DOUBLE_BYTE_PAIR(0xF277, 0xE1AF)
+DOUBLE_BYTE_PAIR(0xF278, 0xE1B0)
+DOUBLE_BYTE_PAIR(0xF279, 0xE1B1)
+DOUBLE_BYTE_PAIR(0xF27A, 0xE1B2)
+DOUBLE_BYTE_PAIR(0xF27B, 0xE1B3)
+DOUBLE_BYTE_PAIR(0xF27C, 0xE1B4)
+DOUBLE_BYTE_PAIR(0xF27D, 0xE1B5)
+DOUBLE_BYTE_PAIR(0xF27E, 0xE1B6)
+DOUBLE_BYTE_PAIR(0xF280, 0xE1B7)
+DOUBLE_BYTE_PAIR(0xF281, 0xE1B8)
+DOUBLE_BYTE_PAIR(0xF282, 0xE1B9)
+DOUBLE_BYTE_PAIR(0xF283, 0xE1BA)
+DOUBLE_BYTE_PAIR(0xF284, 0xE1BB)
+DOUBLE_BYTE_PAIR(0xF285, 0xE1BC)
+DOUBLE_BYTE_PAIR(0xF286, 0xE1BD)
+DOUBLE_BYTE_PAIR(0xF287, 0xE1BE)
+DOUBLE_BYTE_PAIR(0xF288, 0xE1BF)
+DOUBLE_BYTE_PAIR(0xF289, 0xE1C0)
+DOUBLE_BYTE_PAIR(0xF28A, 0xE1C1)
+DOUBLE_BYTE_PAIR(0xF28B, 0xE1C2)
+DOUBLE_BYTE_PAIR(0xF28C, 0xE1C3)
+DOUBLE_BYTE_PAIR(0xF28D, 0xE1C4)
+DOUBLE_BYTE_PAIR(0xF28E, 0xE1C5)
+DOUBLE_BYTE_PAIR(0xF28F, 0xE1C6)
+DOUBLE_BYTE_PAIR(0xF290, 0xE1C7)
+DOUBLE_BYTE_PAIR(0xF291, 0xE1C8)
+DOUBLE_BYTE_PAIR(0xF292, 0xE1C9)
+DOUBLE_BYTE_PAIR(0xF293, 0xE1CA)
+DOUBLE_BYTE_PAIR(0xF294, 0xE1CB)
+DOUBLE_BYTE_PAIR(0xF295, 0xE1CC)
+DOUBLE_BYTE_PAIR(0xF296, 0xE1CD)
+DOUBLE_BYTE_PAIR(0xF297, 0xE1CE)
+DOUBLE_BYTE_PAIR(0xF298, 0xE1CF)
+DOUBLE_BYTE_PAIR(0xF299, 0xE1D0)
+DOUBLE_BYTE_PAIR(0xF29A, 0xE1D1)
+DOUBLE_BYTE_PAIR(0xF29B, 0xE1D2)
+DOUBLE_BYTE_PAIR(0xF29C, 0xE1D3)
+DOUBLE_BYTE_PAIR(0xF29D, 0xE1D4)
+DOUBLE_BYTE_PAIR(0xF29E, 0xE1D5)
+DOUBLE_BYTE_PAIR(0xF29F, 0xE1D6)
+DOUBLE_BYTE_PAIR(0xF2A0, 0xE1D7)
+DOUBLE_BYTE_PAIR(0xF2A1, 0xE1D8)
+DOUBLE_BYTE_PAIR(0xF2A2, 0xE1D9)
+DOUBLE_BYTE_PAIR(0xF2A3, 0xE1DA)
+DOUBLE_BYTE_PAIR(0xF2A4, 0xE1DB)
+DOUBLE_BYTE_PAIR(0xF2A5, 0xE1DC)
+DOUBLE_BYTE_PAIR(0xF2A6, 0xE1DD)
+DOUBLE_BYTE_PAIR(0xF2A7, 0xE1DE)
+DOUBLE_BYTE_PAIR(0xF2A8, 0xE1DF)
+DOUBLE_BYTE_PAIR(0xF2A9, 0xE1E0)
+DOUBLE_BYTE_PAIR(0xF2AA, 0xE1E1)
+DOUBLE_BYTE_PAIR(0xF2AB, 0xE1E2)
+DOUBLE_BYTE_PAIR(0xF2AC, 0xE1E3)
+DOUBLE_BYTE_PAIR(0xF2AD, 0xE1E4)
+DOUBLE_BYTE_PAIR(0xF2AE, 0xE1E5)
+DOUBLE_BYTE_PAIR(0xF2AF, 0xE1E6)
+DOUBLE_BYTE_PAIR(0xF2B0, 0xE1E7)
+DOUBLE_BYTE_PAIR(0xF2B1, 0xE1E8)
+DOUBLE_BYTE_PAIR(0xF2B2, 0xE1E9)
+DOUBLE_BYTE_PAIR(0xF2B3, 0xE1EA)
+DOUBLE_BYTE_PAIR(0xF2B4, 0xE1EB)
+DOUBLE_BYTE_PAIR(0xF2B5, 0xE1EC)
+DOUBLE_BYTE_PAIR(0xF2B6, 0xE1ED)
+DOUBLE_BYTE_PAIR(0xF2B7, 0xE1EE)
+DOUBLE_BYTE_PAIR(0xF2B8, 0xE1EF)
+DOUBLE_BYTE_PAIR(0xF2B9, 0xE1F0)
+DOUBLE_BYTE_PAIR(0xF2BA, 0xE1F1)
+DOUBLE_BYTE_PAIR(0xF2BB, 0xE1F2)
+DOUBLE_BYTE_PAIR(0xF2BC, 0xE1F3)
+DOUBLE_BYTE_PAIR(0xF2BD, 0xE1F4)
+DOUBLE_BYTE_PAIR(0xF2BE, 0xE1F5)
+DOUBLE_BYTE_PAIR(0xF2BF, 0xE1F6)
+DOUBLE_BYTE_PAIR(0xF2C0, 0xE1F7)
+DOUBLE_BYTE_PAIR(0xF2C1, 0xE1F8)
+DOUBLE_BYTE_PAIR(0xF2C2, 0xE1F9)
+DOUBLE_BYTE_PAIR(0xF2C3, 0xE1FA)
+DOUBLE_BYTE_PAIR(0xF2C4, 0xE1FB)
+DOUBLE_BYTE_PAIR(0xF2C5, 0xE1FC)
+DOUBLE_BYTE_PAIR(0xF2C6, 0xE1FD)
+DOUBLE_BYTE_PAIR(0xF2C7, 0xE1FE)
+DOUBLE_BYTE_PAIR(0xF2C8, 0xE1FF)
+DOUBLE_BYTE_PAIR(0xF2C9, 0xE200)
+DOUBLE_BYTE_PAIR(0xF2CA, 0xE201)
+DOUBLE_BYTE_PAIR(0xF2CB, 0xE202)
+DOUBLE_BYTE_PAIR(0xF2CC, 0xE203)
+DOUBLE_BYTE_PAIR(0xF2CD, 0xE204)
+DOUBLE_BYTE_PAIR(0xF2CE, 0xE205)
+DOUBLE_BYTE_PAIR(0xF2CF, 0xE206)
+DOUBLE_BYTE_PAIR(0xF2D0, 0xE207)
+DOUBLE_BYTE_PAIR(0xF2D1, 0xE208)
+DOUBLE_BYTE_PAIR(0xF2D2, 0xE209)
+DOUBLE_BYTE_PAIR(0xF2D3, 0xE20A)
+DOUBLE_BYTE_PAIR(0xF2D4, 0xE20B)
+DOUBLE_BYTE_PAIR(0xF2D5, 0xE20C)
+DOUBLE_BYTE_PAIR(0xF2D6, 0xE20D)
+DOUBLE_BYTE_PAIR(0xF2D7, 0xE20E)
+DOUBLE_BYTE_PAIR(0xF2D8, 0xE20F)
+DOUBLE_BYTE_PAIR(0xF2D9, 0xE210)
+DOUBLE_BYTE_PAIR(0xF2DA, 0xE211)
+DOUBLE_BYTE_PAIR(0xF2DB, 0xE212)
+DOUBLE_BYTE_PAIR(0xF2DC, 0xE213)
+DOUBLE_BYTE_PAIR(0xF2DD, 0xE214)
+DOUBLE_BYTE_PAIR(0xF2DE, 0xE215)
+DOUBLE_BYTE_PAIR(0xF2DF, 0xE216)
+DOUBLE_BYTE_PAIR(0xF2E0, 0xE217)
+DOUBLE_BYTE_PAIR(0xF2E1, 0xE218)
+DOUBLE_BYTE_PAIR(0xF2E2, 0xE219)
+DOUBLE_BYTE_PAIR(0xF2E3, 0xE21A)
+DOUBLE_BYTE_PAIR(0xF2E4, 0xE21B)
+DOUBLE_BYTE_PAIR(0xF2E5, 0xE21C)
+DOUBLE_BYTE_PAIR(0xF2E6, 0xE21D)
+DOUBLE_BYTE_PAIR(0xF2E7, 0xE21E)
+DOUBLE_BYTE_PAIR(0xF2E8, 0xE21F)
+DOUBLE_BYTE_PAIR(0xF2E9, 0xE220)
+DOUBLE_BYTE_PAIR(0xF2EA, 0xE221)
+DOUBLE_BYTE_PAIR(0xF2EB, 0xE222)
+DOUBLE_BYTE_PAIR(0xF2EC, 0xE223)
+DOUBLE_BYTE_PAIR(0xF2ED, 0xE224)
+DOUBLE_BYTE_PAIR(0xF2EE, 0xE225)
+DOUBLE_BYTE_PAIR(0xF2EF, 0xE226)
+DOUBLE_BYTE_PAIR(0xF2F0, 0xE227)
+DOUBLE_BYTE_PAIR(0xF2F1, 0xE228)
+DOUBLE_BYTE_PAIR(0xF2F2, 0xE229)
+DOUBLE_BYTE_PAIR(0xF2F3, 0xE22A)
+DOUBLE_BYTE_PAIR(0xF2F4, 0xE22B)
+DOUBLE_BYTE_PAIR(0xF2F5, 0xE22C)
+DOUBLE_BYTE_PAIR(0xF2F6, 0xE22D)
+DOUBLE_BYTE_PAIR(0xF2F7, 0xE22E)
+DOUBLE_BYTE_PAIR(0xF2F8, 0xE22F)
+DOUBLE_BYTE_PAIR(0xF2F9, 0xE230)
+DOUBLE_BYTE_PAIR(0xF2FA, 0xE231)
+DOUBLE_BYTE_PAIR(0xF2FB, 0xE232)
+DOUBLE_BYTE_PAIR(0xF2FC, 0xE233)
+DOUBLE_BYTE_PAIR(0xF340, 0xE234)
+DOUBLE_BYTE_PAIR(0xF341, 0xE235)
+DOUBLE_BYTE_PAIR(0xF342, 0xE236)
+DOUBLE_BYTE_PAIR(0xF343, 0xE237)
+DOUBLE_BYTE_PAIR(0xF344, 0xE238)
+DOUBLE_BYTE_PAIR(0xF345, 0xE239)
+DOUBLE_BYTE_PAIR(0xF346, 0xE23A)
+DOUBLE_BYTE_PAIR(0xF347, 0xE23B)
+DOUBLE_BYTE_PAIR(0xF348, 0xE23C)
+DOUBLE_BYTE_PAIR(0xF349, 0xE23D)
+DOUBLE_BYTE_PAIR(0xF34A, 0xE23E)
+DOUBLE_BYTE_PAIR(0xF34B, 0xE23F)
+DOUBLE_BYTE_PAIR(0xF34C, 0xE240)
+DOUBLE_BYTE_PAIR(0xF34D, 0xE241)
+DOUBLE_BYTE_PAIR(0xF34E, 0xE242)
+DOUBLE_BYTE_PAIR(0xF34F, 0xE243)
+DOUBLE_BYTE_PAIR(0xF350, 0xE244)
+DOUBLE_BYTE_PAIR(0xF351, 0xE245)
+DOUBLE_BYTE_PAIR(0xF352, 0xE246)
+DOUBLE_BYTE_PAIR(0xF353, 0xE247)
+DOUBLE_BYTE_PAIR(0xF354, 0xE248)
+DOUBLE_BYTE_PAIR(0xF355, 0xE249)
+DOUBLE_BYTE_PAIR(0xF356, 0xE24A)
+DOUBLE_BYTE_PAIR(0xF357, 0xE24B)
+DOUBLE_BYTE_PAIR(0xF358, 0xE24C)
+DOUBLE_BYTE_PAIR(0xF359, 0xE24D)
+DOUBLE_BYTE_PAIR(0xF35A, 0xE24E)
+DOUBLE_BYTE_PAIR(0xF35B, 0xE24F)
+DOUBLE_BYTE_PAIR(0xF35C, 0xE250)
+DOUBLE_BYTE_PAIR(0xF35D, 0xE251)
+DOUBLE_BYTE_PAIR(0xF35E, 0xE252)
+DOUBLE_BYTE_PAIR(0xF35F, 0xE253)
+DOUBLE_BYTE_PAIR(0xF360, 0xE254)
+DOUBLE_BYTE_PAIR(0xF361, 0xE255)
+DOUBLE_BYTE_PAIR(0xF362, 0xE256)
+DOUBLE_BYTE_PAIR(0xF363, 0xE257)
+DOUBLE_BYTE_PAIR(0xF364, 0xE258)
+DOUBLE_BYTE_PAIR(0xF365, 0xE259)
+DOUBLE_BYTE_PAIR(0xF366, 0xE25A)
+DOUBLE_BYTE_PAIR(0xF367, 0xE25B)
+DOUBLE_BYTE_PAIR(0xF368, 0xE25C)
+DOUBLE_BYTE_PAIR(0xF369, 0xE25D)
+DOUBLE_BYTE_PAIR(0xF36A, 0xE25E)
+DOUBLE_BYTE_PAIR(0xF36B, 0xE25F)
+DOUBLE_BYTE_PAIR(0xF36C, 0xE260)
+DOUBLE_BYTE_PAIR(0xF36D, 0xE261)
+DOUBLE_BYTE_PAIR(0xF36E, 0xE262)
+DOUBLE_BYTE_PAIR(0xF36F, 0xE263)
+DOUBLE_BYTE_PAIR(0xF370, 0xE264)
+DOUBLE_BYTE_PAIR(0xF371, 0xE265)
+DOUBLE_BYTE_PAIR(0xF372, 0xE266)
+DOUBLE_BYTE_PAIR(0xF373, 0xE267)
+DOUBLE_BYTE_PAIR(0xF374, 0xE268)
+DOUBLE_BYTE_PAIR(0xF375, 0xE269)
+DOUBLE_BYTE_PAIR(0xF376, 0xE26A)
+DOUBLE_BYTE_PAIR(0xF377, 0xE26B)
+DOUBLE_BYTE_PAIR(0xF378, 0xE26C)
+DOUBLE_BYTE_PAIR(0xF379, 0xE26D)
+DOUBLE_BYTE_PAIR(0xF37A, 0xE26E)
+DOUBLE_BYTE_PAIR(0xF37B, 0xE26F)
+DOUBLE_BYTE_PAIR(0xF37C, 0xE270)
+DOUBLE_BYTE_PAIR(0xF37D, 0xE271)
+DOUBLE_BYTE_PAIR(0xF37E, 0xE272)
+DOUBLE_BYTE_PAIR(0xF380, 0xE273)
+DOUBLE_BYTE_PAIR(0xF381, 0xE274)
+DOUBLE_BYTE_PAIR(0xF382, 0xE275)
+DOUBLE_BYTE_PAIR(0xF383, 0xE276)
+DOUBLE_BYTE_PAIR(0xF384, 0xE277)
+DOUBLE_BYTE_PAIR(0xF385, 0xE278)
+DOUBLE_BYTE_PAIR(0xF386, 0xE279)
+DOUBLE_BYTE_PAIR(0xF387, 0xE27A)
+DOUBLE_BYTE_PAIR(0xF388, 0xE27B)
+DOUBLE_BYTE_PAIR(0xF389, 0xE27C)
+DOUBLE_BYTE_PAIR(0xF38A, 0xE27D)
+DOUBLE_BYTE_PAIR(0xF38B, 0xE27E)
+DOUBLE_BYTE_PAIR(0xF38C, 0xE27F)
+DOUBLE_BYTE_PAIR(0xF38D, 0xE280)
+DOUBLE_BYTE_PAIR(0xF38E, 0xE281)
+DOUBLE_BYTE_PAIR(0xF38F, 0xE282)
+DOUBLE_BYTE_PAIR(0xF390, 0xE283)
+DOUBLE_BYTE_PAIR(0xF391, 0xE284)
+DOUBLE_BYTE_PAIR(0xF392, 0xE285)
+DOUBLE_BYTE_PAIR(0xF393, 0xE286)
+DOUBLE_BYTE_PAIR(0xF394, 0xE287)
+DOUBLE_BYTE_PAIR(0xF395, 0xE288)
+DOUBLE_BYTE_PAIR(0xF396, 0xE289)
+DOUBLE_BYTE_PAIR(0xF397, 0xE28A)
+DOUBLE_BYTE_PAIR(0xF398, 0xE28B)
+DOUBLE_BYTE_PAIR(0xF399, 0xE28C)
+DOUBLE_BYTE_PAIR(0xF39A, 0xE28D)
+DOUBLE_BYTE_PAIR(0xF39B, 0xE28E)
+DOUBLE_BYTE_PAIR(0xF39C, 0xE28F)
+DOUBLE_BYTE_PAIR(0xF39D, 0xE290)
+DOUBLE_BYTE_PAIR(0xF39E, 0xE291)
+DOUBLE_BYTE_PAIR(0xF39F, 0xE292)
+DOUBLE_BYTE_PAIR(0xF3A0, 0xE293)
+DOUBLE_BYTE_PAIR(0xF3A1, 0xE294)
+DOUBLE_BYTE_PAIR(0xF3A2, 0xE295)
+DOUBLE_BYTE_PAIR(0xF3A3, 0xE296)
+DOUBLE_BYTE_PAIR(0xF3A4, 0xE297)
+DOUBLE_BYTE_PAIR(0xF3A5, 0xE298)
+DOUBLE_BYTE_PAIR(0xF3A6, 0xE299)
+DOUBLE_BYTE_PAIR(0xF3A7, 0xE29A)
+DOUBLE_BYTE_PAIR(0xF3A8, 0xE29B)
+DOUBLE_BYTE_PAIR(0xF3A9, 0xE29C)
+DOUBLE_BYTE_PAIR(0xF3AA, 0xE29D)
+DOUBLE_BYTE_PAIR(0xF3AB, 0xE29E)
+DOUBLE_BYTE_PAIR(0xF3AC, 0xE29F)
+DOUBLE_BYTE_PAIR(0xF3AD, 0xE2A0)
+DOUBLE_BYTE_PAIR(0xF3AE, 0xE2A1)
+DOUBLE_BYTE_PAIR(0xF3AF, 0xE2A2)
+DOUBLE_BYTE_PAIR(0xF3B0, 0xE2A3)
+DOUBLE_BYTE_PAIR(0xF3B1, 0xE2A4)
+DOUBLE_BYTE_PAIR(0xF3B2, 0xE2A5)
+DOUBLE_BYTE_PAIR(0xF3B3, 0xE2A6)
+DOUBLE_BYTE_PAIR(0xF3B4, 0xE2A7)
+DOUBLE_BYTE_PAIR(0xF3B5, 0xE2A8)
+DOUBLE_BYTE_PAIR(0xF3B6, 0xE2A9)
+DOUBLE_BYTE_PAIR(0xF3B7, 0xE2AA)
+DOUBLE_BYTE_PAIR(0xF3B8, 0xE2AB)
+DOUBLE_BYTE_PAIR(0xF3B9, 0xE2AC)
+DOUBLE_BYTE_PAIR(0xF3BA, 0xE2AD)
+DOUBLE_BYTE_PAIR(0xF3BB, 0xE2AE)
+DOUBLE_BYTE_PAIR(0xF3BC, 0xE2AF)
+DOUBLE_BYTE_PAIR(0xF3BD, 0xE2B0)
+DOUBLE_BYTE_PAIR(0xF3BE, 0xE2B1)
+DOUBLE_BYTE_PAIR(0xF3BF, 0xE2B2)
+DOUBLE_BYTE_PAIR(0xF3C0, 0xE2B3)
+DOUBLE_BYTE_PAIR(0xF3C1, 0xE2B4)
+DOUBLE_BYTE_PAIR(0xF3C2, 0xE2B5)
+DOUBLE_BYTE_PAIR(0xF3C3, 0xE2B6)
+DOUBLE_BYTE_PAIR(0xF3C4, 0xE2B7)
+DOUBLE_BYTE_PAIR(0xF3C5, 0xE2B8)
+DOUBLE_BYTE_PAIR(0xF3C6, 0xE2B9)
+DOUBLE_BYTE_PAIR(0xF3C7, 0xE2BA)
+DOUBLE_BYTE_PAIR(0xF3C8, 0xE2BB)
+DOUBLE_BYTE_PAIR(0xF3C9, 0xE2BC)
+DOUBLE_BYTE_PAIR(0xF3CA, 0xE2BD)
+DOUBLE_BYTE_PAIR(0xF3CB, 0xE2BE)
+DOUBLE_BYTE_PAIR(0xF3CC, 0xE2BF)
+DOUBLE_BYTE_PAIR(0xF3CD, 0xE2C0)
+DOUBLE_BYTE_PAIR(0xF3CE, 0xE2C1)
+DOUBLE_BYTE_PAIR(0xF3CF, 0xE2C2)
+DOUBLE_BYTE_PAIR(0xF3D0, 0xE2C3)
+DOUBLE_BYTE_PAIR(0xF3D1, 0xE2C4)
+DOUBLE_BYTE_PAIR(0xF3D2, 0xE2C5)
+DOUBLE_BYTE_PAIR(0xF3D3, 0xE2C6)
+DOUBLE_BYTE_PAIR(0xF3D4, 0xE2C7)
+DOUBLE_BYTE_PAIR(0xF3D5, 0xE2C8)
+DOUBLE_BYTE_PAIR(0xF3D6, 0xE2C9)
+DOUBLE_BYTE_PAIR(0xF3D7, 0xE2CA)
+DOUBLE_BYTE_PAIR(0xF3D8, 0xE2CB)
+DOUBLE_BYTE_PAIR(0xF3D9, 0xE2CC)
+DOUBLE_BYTE_PAIR(0xF3DA, 0xE2CD)
+DOUBLE_BYTE_PAIR(0xF3DB, 0xE2CE)
+DOUBLE_BYTE_PAIR(0xF3DC, 0xE2CF)
+DOUBLE_BYTE_PAIR(0xF3DD, 0xE2D0)
+DOUBLE_BYTE_PAIR(0xF3DE, 0xE2D1)
+DOUBLE_BYTE_PAIR(0xF3DF, 0xE2D2)
+DOUBLE_BYTE_PAIR(0xF3E0, 0xE2D3)
+DOUBLE_BYTE_PAIR(0xF3E1, 0xE2D4)
+DOUBLE_BYTE_PAIR(0xF3E2, 0xE2D5)
+DOUBLE_BYTE_PAIR(0xF3E3, 0xE2D6)
+DOUBLE_BYTE_PAIR(0xF3E4, 0xE2D7)
+DOUBLE_BYTE_PAIR(0xF3E5, 0xE2D8)
+DOUBLE_BYTE_PAIR(0xF3E6, 0xE2D9)
+DOUBLE_BYTE_PAIR(0xF3E7, 0xE2DA)
+DOUBLE_BYTE_PAIR(0xF3E8, 0xE2DB)
+DOUBLE_BYTE_PAIR(0xF3E9, 0xE2DC)
+DOUBLE_BYTE_PAIR(0xF3EA, 0xE2DD)
+DOUBLE_BYTE_PAIR(0xF3EB, 0xE2DE)
+DOUBLE_BYTE_PAIR(0xF3EC, 0xE2DF)
+DOUBLE_BYTE_PAIR(0xF3ED, 0xE2E0)
+DOUBLE_BYTE_PAIR(0xF3EE, 0xE2E1)
+DOUBLE_BYTE_PAIR(0xF3EF, 0xE2E2)
+DOUBLE_BYTE_PAIR(0xF3F0, 0xE2E3)
+DOUBLE_BYTE_PAIR(0xF3F1, 0xE2E4)
+DOUBLE_BYTE_PAIR(0xF3F2, 0xE2E5)
+DOUBLE_BYTE_PAIR(0xF3F3, 0xE2E6)
+DOUBLE_BYTE_PAIR(0xF3F4, 0xE2E7)
+DOUBLE_BYTE_PAIR(0xF3F5, 0xE2E8)
+DOUBLE_BYTE_PAIR(0xF3F6, 0xE2E9)
+DOUBLE_BYTE_PAIR(0xF3F7, 0xE2EA)
+DOUBLE_BYTE_PAIR(0xF3F8, 0xE2EB)
+DOUBLE_BYTE_PAIR(0xF3F9, 0xE2EC)
+DOUBLE_BYTE_PAIR(0xF3FA, 0xE2ED)
+DOUBLE_BYTE_PAIR(0xF3FB, 0xE2EE)
+DOUBLE_BYTE_PAIR(0xF3FC, 0xE2EF)
+DOUBLE_BYTE_PAIR(0xF440, 0xE2F0)
+DOUBLE_BYTE_PAIR(0xF441, 0xE2F1)
+DOUBLE_BYTE_PAIR(0xF442, 0xE2F2)
+DOUBLE_BYTE_PAIR(0xF443, 0xE2F3)
+DOUBLE_BYTE_PAIR(0xF444, 0xE2F4)
+DOUBLE_BYTE_PAIR(0xF445, 0xE2F5)
+DOUBLE_BYTE_PAIR(0xF446, 0xE2F6)
+DOUBLE_BYTE_PAIR(0xF447, 0xE2F7)
+DOUBLE_BYTE_PAIR(0xF448, 0xE2F8)
+DOUBLE_BYTE_PAIR(0xF449, 0xE2F9)
+DOUBLE_BYTE_PAIR(0xF44A, 0xE2FA)
+DOUBLE_BYTE_PAIR(0xF44B, 0xE2FB)
+DOUBLE_BYTE_PAIR(0xF44C, 0xE2FC)
+DOUBLE_BYTE_PAIR(0xF44D, 0xE2FD)
+DOUBLE_BYTE_PAIR(0xF44E, 0xE2FE)
+DOUBLE_BYTE_PAIR(0xF44F, 0xE2FF)
+DOUBLE_BYTE_PAIR(0xF450, 0xE300)
+DOUBLE_BYTE_PAIR(0xF451, 0xE301)
+DOUBLE_BYTE_PAIR(0xF452, 0xE302)
+DOUBLE_BYTE_PAIR(0xF453, 0xE303)
+DOUBLE_BYTE_PAIR(0xF454, 0xE304)
+DOUBLE_BYTE_PAIR(0xF455, 0xE305)
+DOUBLE_BYTE_PAIR(0xF456, 0xE306)
+DOUBLE_BYTE_PAIR(0xF457, 0xE307)
+DOUBLE_BYTE_PAIR(0xF458, 0xE308)
+DOUBLE_BYTE_PAIR(0xF459, 0xE309)
+DOUBLE_BYTE_PAIR(0xF45A, 0xE30A)
+DOUBLE_BYTE_PAIR(0xF45B, 0xE30B)
+DOUBLE_BYTE_PAIR(0xF45C, 0xE30C)
+DOUBLE_BYTE_PAIR(0xF45D, 0xE30D)
+DOUBLE_BYTE_PAIR(0xF45E, 0xE30E)
+DOUBLE_BYTE_PAIR(0xF45F, 0xE30F)
+DOUBLE_BYTE_PAIR(0xF460, 0xE310)
+DOUBLE_BYTE_PAIR(0xF461, 0xE311)
+DOUBLE_BYTE_PAIR(0xF462, 0xE312)
+DOUBLE_BYTE_PAIR(0xF463, 0xE313)
+DOUBLE_BYTE_PAIR(0xF464, 0xE314)
+DOUBLE_BYTE_PAIR(0xF465, 0xE315)
+DOUBLE_BYTE_PAIR(0xF466, 0xE316)
+DOUBLE_BYTE_PAIR(0xF467, 0xE317)
+DOUBLE_BYTE_PAIR(0xF468, 0xE318)
+DOUBLE_BYTE_PAIR(0xF469, 0xE319)
+DOUBLE_BYTE_PAIR(0xF46A, 0xE31A)
+DOUBLE_BYTE_PAIR(0xF46B, 0xE31B)
+DOUBLE_BYTE_PAIR(0xF46C, 0xE31C)
+DOUBLE_BYTE_PAIR(0xF46D, 0xE31D)
+DOUBLE_BYTE_PAIR(0xF46E, 0xE31E)
+DOUBLE_BYTE_PAIR(0xF46F, 0xE31F)
+DOUBLE_BYTE_PAIR(0xF470, 0xE320)
+DOUBLE_BYTE_PAIR(0xF471, 0xE321)
+DOUBLE_BYTE_PAIR(0xF472, 0xE322)
+DOUBLE_BYTE_PAIR(0xF473, 0xE323)
+DOUBLE_BYTE_PAIR(0xF474, 0xE324)
+DOUBLE_BYTE_PAIR(0xF475, 0xE325)
+DOUBLE_BYTE_PAIR(0xF476, 0xE326)
+DOUBLE_BYTE_PAIR(0xF477, 0xE327)
+DOUBLE_BYTE_PAIR(0xF478, 0xE328)
+DOUBLE_BYTE_PAIR(0xF479, 0xE329)
+DOUBLE_BYTE_PAIR(0xF47A, 0xE32A)
+DOUBLE_BYTE_PAIR(0xF47B, 0xE32B)
+DOUBLE_BYTE_PAIR(0xF47C, 0xE32C)
+DOUBLE_BYTE_PAIR(0xF47D, 0xE32D)
+DOUBLE_BYTE_PAIR(0xF47E, 0xE32E)
+DOUBLE_BYTE_PAIR(0xF480, 0xE32F)
+DOUBLE_BYTE_PAIR(0xF481, 0xE330)
+DOUBLE_BYTE_PAIR(0xF482, 0xE331)
+DOUBLE_BYTE_PAIR(0xF483, 0xE332)
+DOUBLE_BYTE_PAIR(0xF484, 0xE333)
+DOUBLE_BYTE_PAIR(0xF485, 0xE334)
+DOUBLE_BYTE_PAIR(0xF486, 0xE335)
+DOUBLE_BYTE_PAIR(0xF487, 0xE336)
+DOUBLE_BYTE_PAIR(0xF488, 0xE337)
+DOUBLE_BYTE_PAIR(0xF489, 0xE338)
+DOUBLE_BYTE_PAIR(0xF48A, 0xE339)
+DOUBLE_BYTE_PAIR(0xF48B, 0xE33A)
+DOUBLE_BYTE_PAIR(0xF48C, 0xE33B)
+DOUBLE_BYTE_PAIR(0xF48D, 0xE33C)
+DOUBLE_BYTE_PAIR(0xF48E, 0xE33D)
+DOUBLE_BYTE_PAIR(0xF48F, 0xE33E)
+DOUBLE_BYTE_PAIR(0xF490, 0xE33F)
+DOUBLE_BYTE_PAIR(0xF491, 0xE340)
+DOUBLE_BYTE_PAIR(0xF492, 0xE341)
+DOUBLE_BYTE_PAIR(0xF493, 0xE342)
+DOUBLE_BYTE_PAIR(0xF494, 0xE343)
+DOUBLE_BYTE_PAIR(0xF495, 0xE344)
+DOUBLE_BYTE_PAIR(0xF496, 0xE345)
+DOUBLE_BYTE_PAIR(0xF497, 0xE346)
+DOUBLE_BYTE_PAIR(0xF498, 0xE347)
+DOUBLE_BYTE_PAIR(0xF499, 0xE348)
+DOUBLE_BYTE_PAIR(0xF49A, 0xE349)
+DOUBLE_BYTE_PAIR(0xF49B, 0xE34A)
+DOUBLE_BYTE_PAIR(0xF49C, 0xE34B)
+DOUBLE_BYTE_PAIR(0xF49D, 0xE34C)
+DOUBLE_BYTE_PAIR(0xF49E, 0xE34D)
+DOUBLE_BYTE_PAIR(0xF49F, 0xE34E)
+DOUBLE_BYTE_PAIR(0xF4A0, 0xE34F)
+DOUBLE_BYTE_PAIR(0xF4A1, 0xE350)
+DOUBLE_BYTE_PAIR(0xF4A2, 0xE351)
+DOUBLE_BYTE_PAIR(0xF4A3, 0xE352)
+DOUBLE_BYTE_PAIR(0xF4A4, 0xE353)
+DOUBLE_BYTE_PAIR(0xF4A5, 0xE354)
+DOUBLE_BYTE_PAIR(0xF4A6, 0xE355)
+DOUBLE_BYTE_PAIR(0xF4A7, 0xE356)
+DOUBLE_BYTE_PAIR(0xF4A8, 0xE357)
+DOUBLE_BYTE_PAIR(0xF4A9, 0xE358)
+DOUBLE_BYTE_PAIR(0xF4AA, 0xE359)
+DOUBLE_BYTE_PAIR(0xF4AB, 0xE35A)
+DOUBLE_BYTE_PAIR(0xF4AC, 0xE35B)
+DOUBLE_BYTE_PAIR(0xF4AD, 0xE35C)
+DOUBLE_BYTE_PAIR(0xF4AE, 0xE35D)
+DOUBLE_BYTE_PAIR(0xF4AF, 0xE35E)
+DOUBLE_BYTE_PAIR(0xF4B0, 0xE35F)
+DOUBLE_BYTE_PAIR(0xF4B1, 0xE360)
+DOUBLE_BYTE_PAIR(0xF4B2, 0xE361)
+DOUBLE_BYTE_PAIR(0xF4B3, 0xE362)
+DOUBLE_BYTE_PAIR(0xF4B4, 0xE363)
+DOUBLE_BYTE_PAIR(0xF4B5, 0xE364)
+DOUBLE_BYTE_PAIR(0xF4B6, 0xE365)
+DOUBLE_BYTE_PAIR(0xF4B7, 0xE366)
+DOUBLE_BYTE_PAIR(0xF4B8, 0xE367)
+DOUBLE_BYTE_PAIR(0xF4B9, 0xE368)
+DOUBLE_BYTE_PAIR(0xF4BA, 0xE369)
+DOUBLE_BYTE_PAIR(0xF4BB, 0xE36A)
+DOUBLE_BYTE_PAIR(0xF4BC, 0xE36B)
+DOUBLE_BYTE_PAIR(0xF4BD, 0xE36C)
+DOUBLE_BYTE_PAIR(0xF4BE, 0xE36D)
+DOUBLE_BYTE_PAIR(0xF4BF, 0xE36E)
+DOUBLE_BYTE_PAIR(0xF4C0, 0xE36F)
+DOUBLE_BYTE_PAIR(0xF4C1, 0xE370)
+DOUBLE_BYTE_PAIR(0xF4C2, 0xE371)
+DOUBLE_BYTE_PAIR(0xF4C3, 0xE372)
+DOUBLE_BYTE_PAIR(0xF4C4, 0xE373)
+DOUBLE_BYTE_PAIR(0xF4C5, 0xE374)
+DOUBLE_BYTE_PAIR(0xF4C6, 0xE375)
+DOUBLE_BYTE_PAIR(0xF4C7, 0xE376)
+DOUBLE_BYTE_PAIR(0xF4C8, 0xE377)
+DOUBLE_BYTE_PAIR(0xF4C9, 0xE378)
+DOUBLE_BYTE_PAIR(0xF4CA, 0xE379)
+DOUBLE_BYTE_PAIR(0xF4CB, 0xE37A)
+DOUBLE_BYTE_PAIR(0xF4CC, 0xE37B)
+DOUBLE_BYTE_PAIR(0xF4CD, 0xE37C)
+DOUBLE_BYTE_PAIR(0xF4CE, 0xE37D)
+DOUBLE_BYTE_PAIR(0xF4CF, 0xE37E)
+DOUBLE_BYTE_PAIR(0xF4D0, 0xE37F)
+DOUBLE_BYTE_PAIR(0xF4D1, 0xE380)
+DOUBLE_BYTE_PAIR(0xF4D2, 0xE381)
+DOUBLE_BYTE_PAIR(0xF4D3, 0xE382)
+DOUBLE_BYTE_PAIR(0xF4D4, 0xE383)
+DOUBLE_BYTE_PAIR(0xF4D5, 0xE384)
+DOUBLE_BYTE_PAIR(0xF4D6, 0xE385)
+DOUBLE_BYTE_PAIR(0xF4D7, 0xE386)
+DOUBLE_BYTE_PAIR(0xF4D8, 0xE387)
+DOUBLE_BYTE_PAIR(0xF4D9, 0xE388)
+DOUBLE_BYTE_PAIR(0xF4DA, 0xE389)
+DOUBLE_BYTE_PAIR(0xF4DB, 0xE38A)
+DOUBLE_BYTE_PAIR(0xF4DC, 0xE38B)
+DOUBLE_BYTE_PAIR(0xF4DD, 0xE38C)
+DOUBLE_BYTE_PAIR(0xF4DE, 0xE38D)
+DOUBLE_BYTE_PAIR(0xF4DF, 0xE38E)
+DOUBLE_BYTE_PAIR(0xF4E0, 0xE38F)
+DOUBLE_BYTE_PAIR(0xF4E1, 0xE390)
+DOUBLE_BYTE_PAIR(0xF4E2, 0xE391)
+DOUBLE_BYTE_PAIR(0xF4E3, 0xE392)
+DOUBLE_BYTE_PAIR(0xF4E4, 0xE393)
+DOUBLE_BYTE_PAIR(0xF4E5, 0xE394)
+DOUBLE_BYTE_PAIR(0xF4E6, 0xE395)
+DOUBLE_BYTE_PAIR(0xF4E7, 0xE396)
+DOUBLE_BYTE_PAIR(0xF4E8, 0xE397)
+DOUBLE_BYTE_PAIR(0xF4E9, 0xE398)
+DOUBLE_BYTE_PAIR(0xF4EA, 0xE399)
+DOUBLE_BYTE_PAIR(0xF4EB, 0xE39A)
+DOUBLE_BYTE_PAIR(0xF4EC, 0xE39B)
+DOUBLE_BYTE_PAIR(0xF4ED, 0xE39C)
+DOUBLE_BYTE_PAIR(0xF4EE, 0xE39D)
+DOUBLE_BYTE_PAIR(0xF4EF, 0xE39E)
+DOUBLE_BYTE_PAIR(0xF4F0, 0xE39F)
+DOUBLE_BYTE_PAIR(0xF4F1, 0xE3A0)
+DOUBLE_BYTE_PAIR(0xF4F2, 0xE3A1)
+DOUBLE_BYTE_PAIR(0xF4F3, 0xE3A2)
+DOUBLE_BYTE_PAIR(0xF4F4, 0xE3A3)
+DOUBLE_BYTE_PAIR(0xF4F5, 0xE3A4)
+DOUBLE_BYTE_PAIR(0xF4F6, 0xE3A5)
+DOUBLE_BYTE_PAIR(0xF4F7, 0xE3A6)
+DOUBLE_BYTE_PAIR(0xF4F8, 0xE3A7)
+DOUBLE_BYTE_PAIR(0xF4F9, 0xE3A8)
+DOUBLE_BYTE_PAIR(0xF4FA, 0xE3A9)
+DOUBLE_BYTE_PAIR(0xF4FB, 0xE3AA)
+DOUBLE_BYTE_PAIR(0xF4FC, 0xE3AB)
+DOUBLE_BYTE_PAIR(0xF540, 0xE3AC)
+DOUBLE_BYTE_PAIR(0xF541, 0xE3AD)
+DOUBLE_BYTE_PAIR(0xF542, 0xE3AE)
+DOUBLE_BYTE_PAIR(0xF543, 0xE3AF)
+DOUBLE_BYTE_PAIR(0xF544, 0xE3B0)
+DOUBLE_BYTE_PAIR(0xF545, 0xE3B1)
+DOUBLE_BYTE_PAIR(0xF546, 0xE3B2)
+DOUBLE_BYTE_PAIR(0xF547, 0xE3B3)
+DOUBLE_BYTE_PAIR(0xF548, 0xE3B4)
+DOUBLE_BYTE_PAIR(0xF549, 0xE3B5)
+DOUBLE_BYTE_PAIR(0xF54A, 0xE3B6)
+DOUBLE_BYTE_PAIR(0xF54B, 0xE3B7)
+DOUBLE_BYTE_PAIR(0xF54C, 0xE3B8)
+DOUBLE_BYTE_PAIR(0xF54D, 0xE3B9)
+DOUBLE_BYTE_PAIR(0xF54E, 0xE3BA)
+DOUBLE_BYTE_PAIR(0xF54F, 0xE3BB)
+DOUBLE_BYTE_PAIR(0xF550, 0xE3BC)
+DOUBLE_BYTE_PAIR(0xF551, 0xE3BD)
+DOUBLE_BYTE_PAIR(0xF552, 0xE3BE)
+DOUBLE_BYTE_PAIR(0xF553, 0xE3BF)
+DOUBLE_BYTE_PAIR(0xF554, 0xE3C0)
+DOUBLE_BYTE_PAIR(0xF555, 0xE3C1)
+DOUBLE_BYTE_PAIR(0xF556, 0xE3C2)
+DOUBLE_BYTE_PAIR(0xF557, 0xE3C3)
+DOUBLE_BYTE_PAIR(0xF558, 0xE3C4)
+DOUBLE_BYTE_PAIR(0xF559, 0xE3C5)
+DOUBLE_BYTE_PAIR(0xF55A, 0xE3C6)
+DOUBLE_BYTE_PAIR(0xF55B, 0xE3C7)
+DOUBLE_BYTE_PAIR(0xF55C, 0xE3C8)
+DOUBLE_BYTE_PAIR(0xF55D, 0xE3C9)
+DOUBLE_BYTE_PAIR(0xF55E, 0xE3CA)
+DOUBLE_BYTE_PAIR(0xF55F, 0xE3CB)
+DOUBLE_BYTE_PAIR(0xF560, 0xE3CC)
+DOUBLE_BYTE_PAIR(0xF561, 0xE3CD)
+DOUBLE_BYTE_PAIR(0xF562, 0xE3CE)
+DOUBLE_BYTE_PAIR(0xF563, 0xE3CF)
+DOUBLE_BYTE_PAIR(0xF564, 0xE3D0)
+DOUBLE_BYTE_PAIR(0xF565, 0xE3D1)
+DOUBLE_BYTE_PAIR(0xF566, 0xE3D2)
+DOUBLE_BYTE_PAIR(0xF567, 0xE3D3)
+DOUBLE_BYTE_PAIR(0xF568, 0xE3D4)
+DOUBLE_BYTE_PAIR(0xF569, 0xE3D5)
+DOUBLE_BYTE_PAIR(0xF56A, 0xE3D6)
+DOUBLE_BYTE_PAIR(0xF56B, 0xE3D7)
+DOUBLE_BYTE_PAIR(0xF56C, 0xE3D8)
+DOUBLE_BYTE_PAIR(0xF56D, 0xE3D9)
+DOUBLE_BYTE_PAIR(0xF56E, 0xE3DA)
+DOUBLE_BYTE_PAIR(0xF56F, 0xE3DB)
+DOUBLE_BYTE_PAIR(0xF570, 0xE3DC)
+DOUBLE_BYTE_PAIR(0xF571, 0xE3DD)
+DOUBLE_BYTE_PAIR(0xF572, 0xE3DE)
+DOUBLE_BYTE_PAIR(0xF573, 0xE3DF)
+DOUBLE_BYTE_PAIR(0xF574, 0xE3E0)
+DOUBLE_BYTE_PAIR(0xF575, 0xE3E1)
+DOUBLE_BYTE_PAIR(0xF576, 0xE3E2)
+DOUBLE_BYTE_PAIR(0xF577, 0xE3E3)
+DOUBLE_BYTE_PAIR(0xF578, 0xE3E4)
+DOUBLE_BYTE_PAIR(0xF579, 0xE3E5)
+DOUBLE_BYTE_PAIR(0xF57A, 0xE3E6)
+DOUBLE_BYTE_PAIR(0xF57B, 0xE3E7)
+DOUBLE_BYTE_PAIR(0xF57C, 0xE3E8)
+DOUBLE_BYTE_PAIR(0xF57D, 0xE3E9)
+DOUBLE_BYTE_PAIR(0xF57E, 0xE3EA)
+DOUBLE_BYTE_PAIR(0xF580, 0xE3EB)
+DOUBLE_BYTE_PAIR(0xF581, 0xE3EC)
+DOUBLE_BYTE_PAIR(0xF582, 0xE3ED)
+DOUBLE_BYTE_PAIR(0xF583, 0xE3EE)
+DOUBLE_BYTE_PAIR(0xF584, 0xE3EF)
+DOUBLE_BYTE_PAIR(0xF585, 0xE3F0)
+DOUBLE_BYTE_PAIR(0xF586, 0xE3F1)
+DOUBLE_BYTE_PAIR(0xF587, 0xE3F2)
+DOUBLE_BYTE_PAIR(0xF588, 0xE3F3)
+DOUBLE_BYTE_PAIR(0xF589, 0xE3F4)
+DOUBLE_BYTE_PAIR(0xF58A, 0xE3F5)
+DOUBLE_BYTE_PAIR(0xF58B, 0xE3F6)
+DOUBLE_BYTE_PAIR(0xF58C, 0xE3F7)
+DOUBLE_BYTE_PAIR(0xF58D, 0xE3F8)
+DOUBLE_BYTE_PAIR(0xF58E, 0xE3F9)
+DOUBLE_BYTE_PAIR(0xF58F, 0xE3FA)
+DOUBLE_BYTE_PAIR(0xF590, 0xE3FB)
+DOUBLE_BYTE_PAIR(0xF591, 0xE3FC)
+DOUBLE_BYTE_PAIR(0xF592, 0xE3FD)
+DOUBLE_BYTE_PAIR(0xF593, 0xE3FE)
+DOUBLE_BYTE_PAIR(0xF594, 0xE3FF)
+DOUBLE_BYTE_PAIR(0xF595, 0xE400)
+DOUBLE_BYTE_PAIR(0xF596, 0xE401)
+DOUBLE_BYTE_PAIR(0xF597, 0xE402)
+DOUBLE_BYTE_PAIR(0xF598, 0xE403)
+DOUBLE_BYTE_PAIR(0xF599, 0xE404)
+DOUBLE_BYTE_PAIR(0xF59A, 0xE405)
+DOUBLE_BYTE_PAIR(0xF59B, 0xE406)
+DOUBLE_BYTE_PAIR(0xF59C, 0xE407)
+DOUBLE_BYTE_PAIR(0xF59D, 0xE408)
+DOUBLE_BYTE_PAIR(0xF59E, 0xE409)
+DOUBLE_BYTE_PAIR(0xF59F, 0xE40A)
+DOUBLE_BYTE_PAIR(0xF5A0, 0xE40B)
+DOUBLE_BYTE_PAIR(0xF5A1, 0xE40C)
+DOUBLE_BYTE_PAIR(0xF5A2, 0xE40D)
+DOUBLE_BYTE_PAIR(0xF5A3, 0xE40E)
+DOUBLE_BYTE_PAIR(0xF5A4, 0xE40F)
+DOUBLE_BYTE_PAIR(0xF5A5, 0xE410)
+DOUBLE_BYTE_PAIR(0xF5A6, 0xE411)
+DOUBLE_BYTE_PAIR(0xF5A7, 0xE412)
+DOUBLE_BYTE_PAIR(0xF5A8, 0xE413)
+DOUBLE_BYTE_PAIR(0xF5A9, 0xE414)
+DOUBLE_BYTE_PAIR(0xF5AA, 0xE415)
+DOUBLE_BYTE_PAIR(0xF5AB, 0xE416)
+DOUBLE_BYTE_PAIR(0xF5AC, 0xE417)
+DOUBLE_BYTE_PAIR(0xF5AD, 0xE418)
+DOUBLE_BYTE_PAIR(0xF5AE, 0xE419)
+DOUBLE_BYTE_PAIR(0xF5AF, 0xE41A)
+DOUBLE_BYTE_PAIR(0xF5B0, 0xE41B)
+DOUBLE_BYTE_PAIR(0xF5B1, 0xE41C)
+DOUBLE_BYTE_PAIR(0xF5B2, 0xE41D)
+DOUBLE_BYTE_PAIR(0xF5B3, 0xE41E)
+DOUBLE_BYTE_PAIR(0xF5B4, 0xE41F)
+DOUBLE_BYTE_PAIR(0xF5B5, 0xE420)
+DOUBLE_BYTE_PAIR(0xF5B6, 0xE421)
+DOUBLE_BYTE_PAIR(0xF5B7, 0xE422)
+DOUBLE_BYTE_PAIR(0xF5B8, 0xE423)
+DOUBLE_BYTE_PAIR(0xF5B9, 0xE424)
+DOUBLE_BYTE_PAIR(0xF5BA, 0xE425)
+DOUBLE_BYTE_PAIR(0xF5BB, 0xE426)
+DOUBLE_BYTE_PAIR(0xF5BC, 0xE427)
+DOUBLE_BYTE_PAIR(0xF5BD, 0xE428)
+DOUBLE_BYTE_PAIR(0xF5BE, 0xE429)
+DOUBLE_BYTE_PAIR(0xF5BF, 0xE42A)
+DOUBLE_BYTE_PAIR(0xF5C0, 0xE42B)
+DOUBLE_BYTE_PAIR(0xF5C1, 0xE42C)
+DOUBLE_BYTE_PAIR(0xF5C2, 0xE42D)
+DOUBLE_BYTE_PAIR(0xF5C3, 0xE42E)
+DOUBLE_BYTE_PAIR(0xF5C4, 0xE42F)
+DOUBLE_BYTE_PAIR(0xF5C5, 0xE430)
+DOUBLE_BYTE_PAIR(0xF5C6, 0xE431)
+DOUBLE_BYTE_PAIR(0xF5C7, 0xE432)
+DOUBLE_BYTE_PAIR(0xF5C8, 0xE433)
+DOUBLE_BYTE_PAIR(0xF5C9, 0xE434)
+DOUBLE_BYTE_PAIR(0xF5CA, 0xE435)
+DOUBLE_BYTE_PAIR(0xF5CB, 0xE436)
+DOUBLE_BYTE_PAIR(0xF5CC, 0xE437)
+DOUBLE_BYTE_PAIR(0xF5CD, 0xE438)
+DOUBLE_BYTE_PAIR(0xF5CE, 0xE439)
+DOUBLE_BYTE_PAIR(0xF5CF, 0xE43A)
+DOUBLE_BYTE_PAIR(0xF5D0, 0xE43B)
+DOUBLE_BYTE_PAIR(0xF5D1, 0xE43C)
+DOUBLE_BYTE_PAIR(0xF5D2, 0xE43D)
+DOUBLE_BYTE_PAIR(0xF5D3, 0xE43E)
+DOUBLE_BYTE_PAIR(0xF5D4, 0xE43F)
+DOUBLE_BYTE_PAIR(0xF5D5, 0xE440)
+DOUBLE_BYTE_PAIR(0xF5D6, 0xE441)
+DOUBLE_BYTE_PAIR(0xF5D7, 0xE442)
+DOUBLE_BYTE_PAIR(0xF5D8, 0xE443)
+DOUBLE_BYTE_PAIR(0xF5D9, 0xE444)
+DOUBLE_BYTE_PAIR(0xF5DA, 0xE445)
+DOUBLE_BYTE_PAIR(0xF5DB, 0xE446)
+DOUBLE_BYTE_PAIR(0xF5DC, 0xE447)
+DOUBLE_BYTE_PAIR(0xF5DD, 0xE448)
+DOUBLE_BYTE_PAIR(0xF5DE, 0xE449)
+DOUBLE_BYTE_PAIR(0xF5DF, 0xE44A)
+DOUBLE_BYTE_PAIR(0xF5E0, 0xE44B)
+DOUBLE_BYTE_PAIR(0xF5E1, 0xE44C)
+DOUBLE_BYTE_PAIR(0xF5E2, 0xE44D)
+DOUBLE_BYTE_PAIR(0xF5E3, 0xE44E)
+DOUBLE_BYTE_PAIR(0xF5E4, 0xE44F)
+DOUBLE_BYTE_PAIR(0xF5E5, 0xE450)
+DOUBLE_BYTE_PAIR(0xF5E6, 0xE451)
+DOUBLE_BYTE_PAIR(0xF5E7, 0xE452)
+DOUBLE_BYTE_PAIR(0xF5E8, 0xE453)
+DOUBLE_BYTE_PAIR(0xF5E9, 0xE454)
+DOUBLE_BYTE_PAIR(0xF5EA, 0xE455)
+DOUBLE_BYTE_PAIR(0xF5EB, 0xE456)
+DOUBLE_BYTE_PAIR(0xF5EC, 0xE457)
+DOUBLE_BYTE_PAIR(0xF5ED, 0xE458)
+DOUBLE_BYTE_PAIR(0xF5EE, 0xE459)
+DOUBLE_BYTE_PAIR(0xF5EF, 0xE45A)
+DOUBLE_BYTE_PAIR(0xF5F0, 0xE45B)
+DOUBLE_BYTE_PAIR(0xF5F1, 0xE45C)
+DOUBLE_BYTE_PAIR(0xF5F2, 0xE45D)
+DOUBLE_BYTE_PAIR(0xF5F3, 0xE45E)
+DOUBLE_BYTE_PAIR(0xF5F4, 0xE45F)
+DOUBLE_BYTE_PAIR(0xF5F5, 0xE460)
+DOUBLE_BYTE_PAIR(0xF5F6, 0xE461)
+DOUBLE_BYTE_PAIR(0xF5F7, 0xE462)
+DOUBLE_BYTE_PAIR(0xF5F8, 0xE463)
+DOUBLE_BYTE_PAIR(0xF5F9, 0xE464)
+DOUBLE_BYTE_PAIR(0xF5FA, 0xE465)
+DOUBLE_BYTE_PAIR(0xF5FB, 0xE466)
+DOUBLE_BYTE_PAIR(0xF5FC, 0xE467)
+DOUBLE_BYTE_PAIR(0xF640, 0xE468)
+DOUBLE_BYTE_PAIR(0xF641, 0xE469)
+DOUBLE_BYTE_PAIR(0xF642, 0xE46A)
+DOUBLE_BYTE_PAIR(0xF643, 0xE46B)
+DOUBLE_BYTE_PAIR(0xF644, 0xE46C)
+DOUBLE_BYTE_PAIR(0xF645, 0xE46D)
+DOUBLE_BYTE_PAIR(0xF646, 0xE46E)
+DOUBLE_BYTE_PAIR(0xF647, 0xE46F)
+DOUBLE_BYTE_PAIR(0xF648, 0xE470)
+DOUBLE_BYTE_PAIR(0xF649, 0xE471)
+DOUBLE_BYTE_PAIR(0xF64A, 0xE472)
+DOUBLE_BYTE_PAIR(0xF64B, 0xE473)
+DOUBLE_BYTE_PAIR(0xF64C, 0xE474)
+DOUBLE_BYTE_PAIR(0xF64D, 0xE475)
+DOUBLE_BYTE_PAIR(0xF64E, 0xE476)
+DOUBLE_BYTE_PAIR(0xF64F, 0xE477)
+DOUBLE_BYTE_PAIR(0xF650, 0xE478)
+DOUBLE_BYTE_PAIR(0xF651, 0xE479)
+DOUBLE_BYTE_PAIR(0xF652, 0xE47A)
+DOUBLE_BYTE_PAIR(0xF653, 0xE47B)
+DOUBLE_BYTE_PAIR(0xF654, 0xE47C)
+DOUBLE_BYTE_PAIR(0xF655, 0xE47D)
+DOUBLE_BYTE_PAIR(0xF656, 0xE47E)
+DOUBLE_BYTE_PAIR(0xF657, 0xE47F)
+DOUBLE_BYTE_PAIR(0xF658, 0xE480)
+DOUBLE_BYTE_PAIR(0xF659, 0xE481)
+DOUBLE_BYTE_PAIR(0xF65A, 0xE482)
+DOUBLE_BYTE_PAIR(0xF65B, 0xE483)
+DOUBLE_BYTE_PAIR(0xF65C, 0xE484)
+DOUBLE_BYTE_PAIR(0xF65D, 0xE485)
+DOUBLE_BYTE_PAIR(0xF65E, 0xE486)
+DOUBLE_BYTE_PAIR(0xF65F, 0xE487)
+DOUBLE_BYTE_PAIR(0xF660, 0xE488)
+DOUBLE_BYTE_PAIR(0xF661, 0xE489)
+DOUBLE_BYTE_PAIR(0xF662, 0xE48A)
+DOUBLE_BYTE_PAIR(0xF663, 0xE48B)
+DOUBLE_BYTE_PAIR(0xF664, 0xE48C)
+DOUBLE_BYTE_PAIR(0xF665, 0xE48D)
+DOUBLE_BYTE_PAIR(0xF666, 0xE48E)
+DOUBLE_BYTE_PAIR(0xF667, 0xE48F)
+DOUBLE_BYTE_PAIR(0xF668, 0xE490)
+DOUBLE_BYTE_PAIR(0xF669, 0xE491)
+DOUBLE_BYTE_PAIR(0xF66A, 0xE492)
+DOUBLE_BYTE_PAIR(0xF66B, 0xE493)
+DOUBLE_BYTE_PAIR(0xF66C, 0xE494)
+DOUBLE_BYTE_PAIR(0xF66D, 0xE495)
+DOUBLE_BYTE_PAIR(0xF66E, 0xE496)
+DOUBLE_BYTE_PAIR(0xF66F, 0xE497)
+DOUBLE_BYTE_PAIR(0xF670, 0xE498)
+DOUBLE_BYTE_PAIR(0xF671, 0xE499)
+DOUBLE_BYTE_PAIR(0xF672, 0xE49A)
+DOUBLE_BYTE_PAIR(0xF673, 0xE49B)
+DOUBLE_BYTE_PAIR(0xF674, 0xE49C)
+DOUBLE_BYTE_PAIR(0xF675, 0xE49D)
+DOUBLE_BYTE_PAIR(0xF676, 0xE49E)
+DOUBLE_BYTE_PAIR(0xF677, 0xE49F)
+DOUBLE_BYTE_PAIR(0xF678, 0xE4A0)
+DOUBLE_BYTE_PAIR(0xF679, 0xE4A1)
+DOUBLE_BYTE_PAIR(0xF67A, 0xE4A2)
+DOUBLE_BYTE_PAIR(0xF67B, 0xE4A3)
+DOUBLE_BYTE_PAIR(0xF67C, 0xE4A4)
+DOUBLE_BYTE_PAIR(0xF67D, 0xE4A5)
+DOUBLE_BYTE_PAIR(0xF67E, 0xE4A6)
+DOUBLE_BYTE_PAIR(0xF680, 0xE4A7)
+DOUBLE_BYTE_PAIR(0xF681, 0xE4A8)
+DOUBLE_BYTE_PAIR(0xF682, 0xE4A9)
+DOUBLE_BYTE_PAIR(0xF683, 0xE4AA)
+DOUBLE_BYTE_PAIR(0xF684, 0xE4AB)
+DOUBLE_BYTE_PAIR(0xF685, 0xE4AC)
+DOUBLE_BYTE_PAIR(0xF686, 0xE4AD)
+DOUBLE_BYTE_PAIR(0xF687, 0xE4AE)
+DOUBLE_BYTE_PAIR(0xF688, 0xE4AF)
+DOUBLE_BYTE_PAIR(0xF689, 0xE4B0)
+DOUBLE_BYTE_PAIR(0xF68A, 0xE4B1)
+DOUBLE_BYTE_PAIR(0xF68B, 0xE4B2)
+DOUBLE_BYTE_PAIR(0xF68C, 0xE4B3)
+DOUBLE_BYTE_PAIR(0xF68D, 0xE4B4)
+DOUBLE_BYTE_PAIR(0xF68E, 0xE4B5)
+DOUBLE_BYTE_PAIR(0xF68F, 0xE4B6)
+DOUBLE_BYTE_PAIR(0xF690, 0xE4B7)
+DOUBLE_BYTE_PAIR(0xF691, 0xE4B8)
+DOUBLE_BYTE_PAIR(0xF692, 0xE4B9)
+DOUBLE_BYTE_PAIR(0xF693, 0xE4BA)
+DOUBLE_BYTE_PAIR(0xF694, 0xE4BB)
+DOUBLE_BYTE_PAIR(0xF695, 0xE4BC)
+DOUBLE_BYTE_PAIR(0xF696, 0xE4BD)
+DOUBLE_BYTE_PAIR(0xF697, 0xE4BE)
+DOUBLE_BYTE_PAIR(0xF698, 0xE4BF)
+DOUBLE_BYTE_PAIR(0xF699, 0xE4C0)
+DOUBLE_BYTE_PAIR(0xF69A, 0xE4C1)
+DOUBLE_BYTE_PAIR(0xF69B, 0xE4C2)
+DOUBLE_BYTE_PAIR(0xF69C, 0xE4C3)
+DOUBLE_BYTE_PAIR(0xF69D, 0xE4C4)
+DOUBLE_BYTE_PAIR(0xF69E, 0xE4C5)
+DOUBLE_BYTE_PAIR(0xF69F, 0xE4C6)
+DOUBLE_BYTE_PAIR(0xF6A0, 0xE4C7)
+DOUBLE_BYTE_PAIR(0xF6A1, 0xE4C8)
+DOUBLE_BYTE_PAIR(0xF6A2, 0xE4C9)
+DOUBLE_BYTE_PAIR(0xF6A3, 0xE4CA)
+DOUBLE_BYTE_PAIR(0xF6A4, 0xE4CB)
+DOUBLE_BYTE_PAIR(0xF6A5, 0xE4CC)
+DOUBLE_BYTE_PAIR(0xF6A6, 0xE4CD)
+DOUBLE_BYTE_PAIR(0xF6A7, 0xE4CE)
+DOUBLE_BYTE_PAIR(0xF6A8, 0xE4CF)
+DOUBLE_BYTE_PAIR(0xF6A9, 0xE4D0)
+DOUBLE_BYTE_PAIR(0xF6AA, 0xE4D1)
+DOUBLE_BYTE_PAIR(0xF6AB, 0xE4D2)
+DOUBLE_BYTE_PAIR(0xF6AC, 0xE4D3)
+DOUBLE_BYTE_PAIR(0xF6AD, 0xE4D4)
+DOUBLE_BYTE_PAIR(0xF6AE, 0xE4D5)
+DOUBLE_BYTE_PAIR(0xF6AF, 0xE4D6)
+DOUBLE_BYTE_PAIR(0xF6B0, 0xE4D7)
+DOUBLE_BYTE_PAIR(0xF6B1, 0xE4D8)
+DOUBLE_BYTE_PAIR(0xF6B2, 0xE4D9)
+DOUBLE_BYTE_PAIR(0xF6B3, 0xE4DA)
+DOUBLE_BYTE_PAIR(0xF6B4, 0xE4DB)
+DOUBLE_BYTE_PAIR(0xF6B5, 0xE4DC)
+DOUBLE_BYTE_PAIR(0xF6B6, 0xE4DD)
+DOUBLE_BYTE_PAIR(0xF6B7, 0xE4DE)
+DOUBLE_BYTE_PAIR(0xF6B8, 0xE4DF)
+DOUBLE_BYTE_PAIR(0xF6B9, 0xE4E0)
+DOUBLE_BYTE_PAIR(0xF6BA, 0xE4E1)
+DOUBLE_BYTE_PAIR(0xF6BB, 0xE4E2)
+DOUBLE_BYTE_PAIR(0xF6BC, 0xE4E3)
+DOUBLE_BYTE_PAIR(0xF6BD, 0xE4E4)
+DOUBLE_BYTE_PAIR(0xF6BE, 0xE4E5)
+DOUBLE_BYTE_PAIR(0xF6BF, 0xE4E6)
+DOUBLE_BYTE_PAIR(0xF6C0, 0xE4E7)
+DOUBLE_BYTE_PAIR(0xF6C1, 0xE4E8)
+DOUBLE_BYTE_PAIR(0xF6C2, 0xE4E9)
+DOUBLE_BYTE_PAIR(0xF6C3, 0xE4EA)
+DOUBLE_BYTE_PAIR(0xF6C4, 0xE4EB)
+DOUBLE_BYTE_PAIR(0xF6C5, 0xE4EC)
+DOUBLE_BYTE_PAIR(0xF6C6, 0xE4ED)
+DOUBLE_BYTE_PAIR(0xF6C7, 0xE4EE)
+DOUBLE_BYTE_PAIR(0xF6C8, 0xE4EF)
+DOUBLE_BYTE_PAIR(0xF6C9, 0xE4F0)
+DOUBLE_BYTE_PAIR(0xF6CA, 0xE4F1)
+DOUBLE_BYTE_PAIR(0xF6CB, 0xE4F2)
+DOUBLE_BYTE_PAIR(0xF6CC, 0xE4F3)
+DOUBLE_BYTE_PAIR(0xF6CD, 0xE4F4)
+DOUBLE_BYTE_PAIR(0xF6CE, 0xE4F5)
+DOUBLE_BYTE_PAIR(0xF6CF, 0xE4F6)
+DOUBLE_BYTE_PAIR(0xF6D0, 0xE4F7)
+DOUBLE_BYTE_PAIR(0xF6D1, 0xE4F8)
+DOUBLE_BYTE_PAIR(0xF6D2, 0xE4F9)
+DOUBLE_BYTE_PAIR(0xF6D3, 0xE4FA)
+DOUBLE_BYTE_PAIR(0xF6D4, 0xE4FB)
+DOUBLE_BYTE_PAIR(0xF6D5, 0xE4FC)
+DOUBLE_BYTE_PAIR(0xF6D6, 0xE4FD)
+DOUBLE_BYTE_PAIR(0xF6D7, 0xE4FE)
+DOUBLE_BYTE_PAIR(0xF6D8, 0xE4FF)
+DOUBLE_BYTE_PAIR(0xF6D9, 0xE500)
+DOUBLE_BYTE_PAIR(0xF6DA, 0xE501)
+DOUBLE_BYTE_PAIR(0xF6DB, 0xE502)
+DOUBLE_BYTE_PAIR(0xF6DC, 0xE503)
+DOUBLE_BYTE_PAIR(0xF6DD, 0xE504)
+DOUBLE_BYTE_PAIR(0xF6DE, 0xE505)
+DOUBLE_BYTE_PAIR(0xF6DF, 0xE506)
+DOUBLE_BYTE_PAIR(0xF6E0, 0xE507)
+DOUBLE_BYTE_PAIR(0xF6E1, 0xE508)
+DOUBLE_BYTE_PAIR(0xF6E2, 0xE509)
+DOUBLE_BYTE_PAIR(0xF6E3, 0xE50A)
+DOUBLE_BYTE_PAIR(0xF6E4, 0xE50B)
+DOUBLE_BYTE_PAIR(0xF6E5, 0xE50C)
+DOUBLE_BYTE_PAIR(0xF6E6, 0xE50D)
+DOUBLE_BYTE_PAIR(0xF6E7, 0xE50E)
+DOUBLE_BYTE_PAIR(0xF6E8, 0xE50F)
+DOUBLE_BYTE_PAIR(0xF6E9, 0xE510)
+DOUBLE_BYTE_PAIR(0xF6EA, 0xE511)
+DOUBLE_BYTE_PAIR(0xF6EB, 0xE512)
+DOUBLE_BYTE_PAIR(0xF6EC, 0xE513)
+DOUBLE_BYTE_PAIR(0xF6ED, 0xE514)
+DOUBLE_BYTE_PAIR(0xF6EE, 0xE515)
+DOUBLE_BYTE_PAIR(0xF6EF, 0xE516)
+DOUBLE_BYTE_PAIR(0xF6F0, 0xE517)
+DOUBLE_BYTE_PAIR(0xF6F1, 0xE518)
+DOUBLE_BYTE_PAIR(0xF6F2, 0xE519)
+DOUBLE_BYTE_PAIR(0xF6F3, 0xE51A)
+DOUBLE_BYTE_PAIR(0xF6F4, 0xE51B)
+DOUBLE_BYTE_PAIR(0xF6F5, 0xE51C)
+DOUBLE_BYTE_PAIR(0xF6F6, 0xE51D)
+DOUBLE_BYTE_PAIR(0xF6F7, 0xE51E)
+DOUBLE_BYTE_PAIR(0xF6F8, 0xE51F)
+DOUBLE_BYTE_PAIR(0xF6F9, 0xE520)
+DOUBLE_BYTE_PAIR(0xF6FA, 0xE521)
+DOUBLE_BYTE_PAIR(0xF6FB, 0xE522)
+DOUBLE_BYTE_PAIR(0xF6FC, 0xE523)
+DOUBLE_BYTE_PAIR(0xF740, 0xE524)
+DOUBLE_BYTE_PAIR(0xF741, 0xE525)
+DOUBLE_BYTE_PAIR(0xF742, 0xE526)
+DOUBLE_BYTE_PAIR(0xF743, 0xE527)
+DOUBLE_BYTE_PAIR(0xF744, 0xE528)
+DOUBLE_BYTE_PAIR(0xF745, 0xE529)
+DOUBLE_BYTE_PAIR(0xF746, 0xE52A)
+DOUBLE_BYTE_PAIR(0xF747, 0xE52B)
+DOUBLE_BYTE_PAIR(0xF748, 0xE52C)
+DOUBLE_BYTE_PAIR(0xF749, 0xE52D)
+DOUBLE_BYTE_PAIR(0xF74A, 0xE52E)
+DOUBLE_BYTE_PAIR(0xF74B, 0xE52F)
+DOUBLE_BYTE_PAIR(0xF74C, 0xE530)
+DOUBLE_BYTE_PAIR(0xF74D, 0xE531)
+DOUBLE_BYTE_PAIR(0xF74E, 0xE532)
+DOUBLE_BYTE_PAIR(0xF74F, 0xE533)
+DOUBLE_BYTE_PAIR(0xF750, 0xE534)
+DOUBLE_BYTE_PAIR(0xF751, 0xE535)
+DOUBLE_BYTE_PAIR(0xF752, 0xE536)
+DOUBLE_BYTE_PAIR(0xF753, 0xE537)
+DOUBLE_BYTE_PAIR(0xF754, 0xE538)
+DOUBLE_BYTE_PAIR(0xF755, 0xE539)
+DOUBLE_BYTE_PAIR(0xF756, 0xE53A)
+DOUBLE_BYTE_PAIR(0xF757, 0xE53B)
+DOUBLE_BYTE_PAIR(0xF758, 0xE53C)
+DOUBLE_BYTE_PAIR(0xF759, 0xE53D)
+DOUBLE_BYTE_PAIR(0xF75A, 0xE53E)
+DOUBLE_BYTE_PAIR(0xF75B, 0xE53F)
+DOUBLE_BYTE_PAIR(0xF75C, 0xE540)
+DOUBLE_BYTE_PAIR(0xF75D, 0xE541)
+DOUBLE_BYTE_PAIR(0xF75E, 0xE542)
+DOUBLE_BYTE_PAIR(0xF75F, 0xE543)
+DOUBLE_BYTE_PAIR(0xF760, 0xE544)
+DOUBLE_BYTE_PAIR(0xF761, 0xE545)
+DOUBLE_BYTE_PAIR(0xF762, 0xE546)
+DOUBLE_BYTE_PAIR(0xF763, 0xE547)
+DOUBLE_BYTE_PAIR(0xF764, 0xE548)
+DOUBLE_BYTE_PAIR(0xF765, 0xE549)
+DOUBLE_BYTE_PAIR(0xF766, 0xE54A)
+DOUBLE_BYTE_PAIR(0xF767, 0xE54B)
+DOUBLE_BYTE_PAIR(0xF768, 0xE54C)
+DOUBLE_BYTE_PAIR(0xF769, 0xE54D)
+DOUBLE_BYTE_PAIR(0xF76A, 0xE54E)
+DOUBLE_BYTE_PAIR(0xF76B, 0xE54F)
+DOUBLE_BYTE_PAIR(0xF76C, 0xE550)
+DOUBLE_BYTE_PAIR(0xF76D, 0xE551)
+DOUBLE_BYTE_PAIR(0xF76E, 0xE552)
+DOUBLE_BYTE_PAIR(0xF76F, 0xE553)
+DOUBLE_BYTE_PAIR(0xF770, 0xE554)
+DOUBLE_BYTE_PAIR(0xF771, 0xE555)
+DOUBLE_BYTE_PAIR(0xF772, 0xE556)
+DOUBLE_BYTE_PAIR(0xF773, 0xE557)
+DOUBLE_BYTE_PAIR(0xF774, 0xE558)
+DOUBLE_BYTE_PAIR(0xF775, 0xE559)
+DOUBLE_BYTE_PAIR(0xF776, 0xE55A)
+DOUBLE_BYTE_PAIR(0xF777, 0xE55B)
+DOUBLE_BYTE_PAIR(0xF778, 0xE55C)
+DOUBLE_BYTE_PAIR(0xF779, 0xE55D)
+DOUBLE_BYTE_PAIR(0xF77A, 0xE55E)
+DOUBLE_BYTE_PAIR(0xF77B, 0xE55F)
+DOUBLE_BYTE_PAIR(0xF77C, 0xE560)
+DOUBLE_BYTE_PAIR(0xF77D, 0xE561)
+DOUBLE_BYTE_PAIR(0xF77E, 0xE562)
+DOUBLE_BYTE_PAIR(0xF780, 0xE563)
+DOUBLE_BYTE_PAIR(0xF781, 0xE564)
+DOUBLE_BYTE_PAIR(0xF782, 0xE565)
+DOUBLE_BYTE_PAIR(0xF783, 0xE566)
+DOUBLE_BYTE_PAIR(0xF784, 0xE567)
+DOUBLE_BYTE_PAIR(0xF785, 0xE568)
+DOUBLE_BYTE_PAIR(0xF786, 0xE569)
+DOUBLE_BYTE_PAIR(0xF787, 0xE56A)
+DOUBLE_BYTE_PAIR(0xF788, 0xE56B)
+DOUBLE_BYTE_PAIR(0xF789, 0xE56C)
+DOUBLE_BYTE_PAIR(0xF78A, 0xE56D)
+DOUBLE_BYTE_PAIR(0xF78B, 0xE56E)
+DOUBLE_BYTE_PAIR(0xF78C, 0xE56F)
+DOUBLE_BYTE_PAIR(0xF78D, 0xE570)
+DOUBLE_BYTE_PAIR(0xF78E, 0xE571)
+DOUBLE_BYTE_PAIR(0xF78F, 0xE572)
+DOUBLE_BYTE_PAIR(0xF790, 0xE573)
+DOUBLE_BYTE_PAIR(0xF791, 0xE574)
+DOUBLE_BYTE_PAIR(0xF792, 0xE575)
+DOUBLE_BYTE_PAIR(0xF793, 0xE576)
+DOUBLE_BYTE_PAIR(0xF794, 0xE577)
+DOUBLE_BYTE_PAIR(0xF795, 0xE578)
+DOUBLE_BYTE_PAIR(0xF796, 0xE579)
+DOUBLE_BYTE_PAIR(0xF797, 0xE57A)
+DOUBLE_BYTE_PAIR(0xF798, 0xE57B)
+DOUBLE_BYTE_PAIR(0xF799, 0xE57C)
+DOUBLE_BYTE_PAIR(0xF79A, 0xE57D)
+DOUBLE_BYTE_PAIR(0xF79B, 0xE57E)
+DOUBLE_BYTE_PAIR(0xF79C, 0xE57F)
+DOUBLE_BYTE_PAIR(0xF79D, 0xE580)
+DOUBLE_BYTE_PAIR(0xF79E, 0xE581)
+DOUBLE_BYTE_PAIR(0xF79F, 0xE582)
+DOUBLE_BYTE_PAIR(0xF7A0, 0xE583)
+DOUBLE_BYTE_PAIR(0xF7A1, 0xE584)
+DOUBLE_BYTE_PAIR(0xF7A2, 0xE585)
+DOUBLE_BYTE_PAIR(0xF7A3, 0xE586)
+DOUBLE_BYTE_PAIR(0xF7A4, 0xE587)
+DOUBLE_BYTE_PAIR(0xF7A5, 0xE588)
+DOUBLE_BYTE_PAIR(0xF7A6, 0xE589)
+DOUBLE_BYTE_PAIR(0xF7A7, 0xE58A)
+DOUBLE_BYTE_PAIR(0xF7A8, 0xE58B)
+DOUBLE_BYTE_PAIR(0xF7A9, 0xE58C)
+DOUBLE_BYTE_PAIR(0xF7AA, 0xE58D)
+DOUBLE_BYTE_PAIR(0xF7AB, 0xE58E)
+DOUBLE_BYTE_PAIR(0xF7AC, 0xE58F)
+DOUBLE_BYTE_PAIR(0xF7AD, 0xE590)
+DOUBLE_BYTE_PAIR(0xF7AE, 0xE591)
+DOUBLE_BYTE_PAIR(0xF7AF, 0xE592)
+DOUBLE_BYTE_PAIR(0xF7B0, 0xE593)
+DOUBLE_BYTE_PAIR(0xF7B1, 0xE594)
+DOUBLE_BYTE_PAIR(0xF7B2, 0xE595)
+DOUBLE_BYTE_PAIR(0xF7B3, 0xE596)
+DOUBLE_BYTE_PAIR(0xF7B4, 0xE597)
+DOUBLE_BYTE_PAIR(0xF7B5, 0xE598)
+DOUBLE_BYTE_PAIR(0xF7B6, 0xE599)
+DOUBLE_BYTE_PAIR(0xF7B7, 0xE59A)
+DOUBLE_BYTE_PAIR(0xF7B8, 0xE59B)
+DOUBLE_BYTE_PAIR(0xF7B9, 0xE59C)
+DOUBLE_BYTE_PAIR(0xF7BA, 0xE59D)
+DOUBLE_BYTE_PAIR(0xF7BB, 0xE59E)
+DOUBLE_BYTE_PAIR(0xF7BC, 0xE59F)
+DOUBLE_BYTE_PAIR(0xF7BD, 0xE5A0)
+DOUBLE_BYTE_PAIR(0xF7BE, 0xE5A1)
+DOUBLE_BYTE_PAIR(0xF7BF, 0xE5A2)
+DOUBLE_BYTE_PAIR(0xF7C0, 0xE5A3)
+DOUBLE_BYTE_PAIR(0xF7C1, 0xE5A4)
+DOUBLE_BYTE_PAIR(0xF7C2, 0xE5A5)
+DOUBLE_BYTE_PAIR(0xF7C3, 0xE5A6)
+DOUBLE_BYTE_PAIR(0xF7C4, 0xE5A7)
+DOUBLE_BYTE_PAIR(0xF7C5, 0xE5A8)
+DOUBLE_BYTE_PAIR(0xF7C6, 0xE5A9)
+DOUBLE_BYTE_PAIR(0xF7C7, 0xE5AA)
+DOUBLE_BYTE_PAIR(0xF7C8, 0xE5AB)
+DOUBLE_BYTE_PAIR(0xF7C9, 0xE5AC)
+DOUBLE_BYTE_PAIR(0xF7CA, 0xE5AD)
+DOUBLE_BYTE_PAIR(0xF7CB, 0xE5AE)
+DOUBLE_BYTE_PAIR(0xF7CC, 0xE5AF)
+DOUBLE_BYTE_PAIR(0xF7CD, 0xE5B0)
+DOUBLE_BYTE_PAIR(0xF7CE, 0xE5B1)
+DOUBLE_BYTE_PAIR(0xF7CF, 0xE5B2)
+DOUBLE_BYTE_PAIR(0xF7D0, 0xE5B3)
+DOUBLE_BYTE_PAIR(0xF7D1, 0xE5B4)
+DOUBLE_BYTE_PAIR(0xF7D2, 0xE5B5)
+DOUBLE_BYTE_PAIR(0xF7D3, 0xE5B6)
+DOUBLE_BYTE_PAIR(0xF7D4, 0xE5B7)
+DOUBLE_BYTE_PAIR(0xF7D5, 0xE5B8)
+DOUBLE_BYTE_PAIR(0xF7D6, 0xE5B9)
+DOUBLE_BYTE_PAIR(0xF7D7, 0xE5BA)
+DOUBLE_BYTE_PAIR(0xF7D8, 0xE5BB)
+DOUBLE_BYTE_PAIR(0xF7D9, 0xE5BC)
+DOUBLE_BYTE_PAIR(0xF7DA, 0xE5BD)
+DOUBLE_BYTE_PAIR(0xF7DB, 0xE5BE)
+DOUBLE_BYTE_PAIR(0xF7DC, 0xE5BF)
+DOUBLE_BYTE_PAIR(0xF7DD, 0xE5C0)
+DOUBLE_BYTE_PAIR(0xF7DE, 0xE5C1)
+DOUBLE_BYTE_PAIR(0xF7DF, 0xE5C2)
+DOUBLE_BYTE_PAIR(0xF7E0, 0xE5C3)
+DOUBLE_BYTE_PAIR(0xF7E1, 0xE5C4)
+DOUBLE_BYTE_PAIR(0xF7E2, 0xE5C5)
+DOUBLE_BYTE_PAIR(0xF7E3, 0xE5C6)
+DOUBLE_BYTE_PAIR(0xF7E4, 0xE5C7)
+DOUBLE_BYTE_PAIR(0xF7E5, 0xE5C8)
+DOUBLE_BYTE_PAIR(0xF7E6, 0xE5C9)
+DOUBLE_BYTE_PAIR(0xF7E7, 0xE5CA)
+DOUBLE_BYTE_PAIR(0xF7E8, 0xE5CB)
+DOUBLE_BYTE_PAIR(0xF7E9, 0xE5CC)
+DOUBLE_BYTE_PAIR(0xF7EA, 0xE5CD)
+DOUBLE_BYTE_PAIR(0xF7EB, 0xE5CE)
+DOUBLE_BYTE_PAIR(0xF7EC, 0xE5CF)
+DOUBLE_BYTE_PAIR(0xF7ED, 0xE5D0)
+DOUBLE_BYTE_PAIR(0xF7EE, 0xE5D1)
+DOUBLE_BYTE_PAIR(0xF7EF, 0xE5D2)
+DOUBLE_BYTE_PAIR(0xF7F0, 0xE5D3)
+DOUBLE_BYTE_PAIR(0xF7F1, 0xE5D4)
+DOUBLE_BYTE_PAIR(0xF7F2, 0xE5D5)
+DOUBLE_BYTE_PAIR(0xF7F3, 0xE5D6)
+DOUBLE_BYTE_PAIR(0xF7F4, 0xE5D7)
+DOUBLE_BYTE_PAIR(0xF7F5, 0xE5D8)
+DOUBLE_BYTE_PAIR(0xF7F6, 0xE5D9)
+DOUBLE_BYTE_PAIR(0xF7F7, 0xE5DA)
+DOUBLE_BYTE_PAIR(0xF7F8, 0xE5DB)
+DOUBLE_BYTE_PAIR(0xF7F9, 0xE5DC)
+DOUBLE_BYTE_PAIR(0xF7FA, 0xE5DD)
+DOUBLE_BYTE_PAIR(0xF7FB, 0xE5DE)
+DOUBLE_BYTE_PAIR(0xF7FC, 0xE5DF)
+DOUBLE_BYTE_PAIR(0xF840, 0xE5E0)
+DOUBLE_BYTE_PAIR(0xF841, 0xE5E1)
+DOUBLE_BYTE_PAIR(0xF842, 0xE5E2)
+DOUBLE_BYTE_PAIR(0xF843, 0xE5E3)
+DOUBLE_BYTE_PAIR(0xF844, 0xE5E4)
+DOUBLE_BYTE_PAIR(0xF845, 0xE5E5)
+DOUBLE_BYTE_PAIR(0xF846, 0xE5E6)
+DOUBLE_BYTE_PAIR(0xF847, 0xE5E7)
+DOUBLE_BYTE_PAIR(0xF848, 0xE5E8)
+DOUBLE_BYTE_PAIR(0xF849, 0xE5E9)
+DOUBLE_BYTE_PAIR(0xF84A, 0xE5EA)
+DOUBLE_BYTE_PAIR(0xF84B, 0xE5EB)
+DOUBLE_BYTE_PAIR(0xF84C, 0xE5EC)
+DOUBLE_BYTE_PAIR(0xF84D, 0xE5ED)
+DOUBLE_BYTE_PAIR(0xF84E, 0xE5EE)
+DOUBLE_BYTE_PAIR(0xF84F, 0xE5EF)
+DOUBLE_BYTE_PAIR(0xF850, 0xE5F0)
+DOUBLE_BYTE_PAIR(0xF851, 0xE5F1)
+DOUBLE_BYTE_PAIR(0xF852, 0xE5F2)
+DOUBLE_BYTE_PAIR(0xF853, 0xE5F3)
+DOUBLE_BYTE_PAIR(0xF854, 0xE5F4)
+DOUBLE_BYTE_PAIR(0xF855, 0xE5F5)
+DOUBLE_BYTE_PAIR(0xF856, 0xE5F6)
+DOUBLE_BYTE_PAIR(0xF857, 0xE5F7)
+DOUBLE_BYTE_PAIR(0xF858, 0xE5F8)
+DOUBLE_BYTE_PAIR(0xF859, 0xE5F9)
+DOUBLE_BYTE_PAIR(0xF85A, 0xE5FA)
+DOUBLE_BYTE_PAIR(0xF85B, 0xE5FB)
+DOUBLE_BYTE_PAIR(0xF85C, 0xE5FC)
+DOUBLE_BYTE_PAIR(0xF85D, 0xE5FD)
+DOUBLE_BYTE_PAIR(0xF85E, 0xE5FE)
+DOUBLE_BYTE_PAIR(0xF85F, 0xE5FF)
+DOUBLE_BYTE_PAIR(0xF860, 0xE600)
+DOUBLE_BYTE_PAIR(0xF861, 0xE601)
+DOUBLE_BYTE_PAIR(0xF862, 0xE602)
+DOUBLE_BYTE_PAIR(0xF863, 0xE603)
+DOUBLE_BYTE_PAIR(0xF864, 0xE604)
+DOUBLE_BYTE_PAIR(0xF865, 0xE605)
+DOUBLE_BYTE_PAIR(0xF866, 0xE606)
+DOUBLE_BYTE_PAIR(0xF867, 0xE607)
+DOUBLE_BYTE_PAIR(0xF868, 0xE608)
+DOUBLE_BYTE_PAIR(0xF869, 0xE609)
+DOUBLE_BYTE_PAIR(0xF86A, 0xE60A)
+DOUBLE_BYTE_PAIR(0xF86B, 0xE60B)
+DOUBLE_BYTE_PAIR(0xF86C, 0xE60C)
+DOUBLE_BYTE_PAIR(0xF86D, 0xE60D)
+DOUBLE_BYTE_PAIR(0xF86E, 0xE60E)
+DOUBLE_BYTE_PAIR(0xF86F, 0xE60F)
+DOUBLE_BYTE_PAIR(0xF870, 0xE610)
+DOUBLE_BYTE_PAIR(0xF871, 0xE611)
+DOUBLE_BYTE_PAIR(0xF872, 0xE612)
+DOUBLE_BYTE_PAIR(0xF873, 0xE613)
+DOUBLE_BYTE_PAIR(0xF874, 0xE614)
+DOUBLE_BYTE_PAIR(0xF875, 0xE615)
+DOUBLE_BYTE_PAIR(0xF876, 0xE616)
+DOUBLE_BYTE_PAIR(0xF877, 0xE617)
+DOUBLE_BYTE_PAIR(0xF878, 0xE618)
+DOUBLE_BYTE_PAIR(0xF879, 0xE619)
+DOUBLE_BYTE_PAIR(0xF87A, 0xE61A)
+DOUBLE_BYTE_PAIR(0xF87B, 0xE61B)
+DOUBLE_BYTE_PAIR(0xF87C, 0xE61C)
+DOUBLE_BYTE_PAIR(0xF87D, 0xE61D)
+DOUBLE_BYTE_PAIR(0xF87E, 0xE61E)
+DOUBLE_BYTE_PAIR(0xF880, 0xE61F)
+DOUBLE_BYTE_PAIR(0xF881, 0xE620)
+DOUBLE_BYTE_PAIR(0xF882, 0xE621)
+DOUBLE_BYTE_PAIR(0xF883, 0xE622)
+DOUBLE_BYTE_PAIR(0xF884, 0xE623)
+DOUBLE_BYTE_PAIR(0xF885, 0xE624)
+DOUBLE_BYTE_PAIR(0xF886, 0xE625)
+DOUBLE_BYTE_PAIR(0xF887, 0xE626)
+DOUBLE_BYTE_PAIR(0xF888, 0xE627)
+DOUBLE_BYTE_PAIR(0xF889, 0xE628)
+DOUBLE_BYTE_PAIR(0xF88A, 0xE629)
+DOUBLE_BYTE_PAIR(0xF88B, 0xE62A)
+DOUBLE_BYTE_PAIR(0xF88C, 0xE62B)
+DOUBLE_BYTE_PAIR(0xF88D, 0xE62C)
+DOUBLE_BYTE_PAIR(0xF88E, 0xE62D)
+DOUBLE_BYTE_PAIR(0xF88F, 0xE62E)
+DOUBLE_BYTE_PAIR(0xF890, 0xE62F)
+DOUBLE_BYTE_PAIR(0xF891, 0xE630)
+DOUBLE_BYTE_PAIR(0xF892, 0xE631)
+DOUBLE_BYTE_PAIR(0xF893, 0xE632)
+DOUBLE_BYTE_PAIR(0xF894, 0xE633)
+DOUBLE_BYTE_PAIR(0xF895, 0xE634)
+DOUBLE_BYTE_PAIR(0xF896, 0xE635)
+DOUBLE_BYTE_PAIR(0xF897, 0xE636)
+DOUBLE_BYTE_PAIR(0xF898, 0xE637)
+DOUBLE_BYTE_PAIR(0xF899, 0xE638)
+DOUBLE_BYTE_PAIR(0xF89A, 0xE639)
+DOUBLE_BYTE_PAIR(0xF89B, 0xE63A)
+DOUBLE_BYTE_PAIR(0xF89C, 0xE63B)
+DOUBLE_BYTE_PAIR(0xF89D, 0xE63C)
+DOUBLE_BYTE_PAIR(0xF89E, 0xE63D)
+DOUBLE_BYTE_PAIR(0xF89F, 0xE63E)
+DOUBLE_BYTE_PAIR(0xF8A0, 0xE63F)
+DOUBLE_BYTE_PAIR(0xF8A1, 0xE640)
+DOUBLE_BYTE_PAIR(0xF8A2, 0xE641)
+DOUBLE_BYTE_PAIR(0xF8A3, 0xE642)
+DOUBLE_BYTE_PAIR(0xF8A4, 0xE643)
+DOUBLE_BYTE_PAIR(0xF8A5, 0xE644)
+DOUBLE_BYTE_PAIR(0xF8A6, 0xE645)
+DOUBLE_BYTE_PAIR(0xF8A7, 0xE646)
+DOUBLE_BYTE_PAIR(0xF8A8, 0xE647)
+DOUBLE_BYTE_PAIR(0xF8A9, 0xE648)
+DOUBLE_BYTE_PAIR(0xF8AA, 0xE649)
+DOUBLE_BYTE_PAIR(0xF8AB, 0xE64A)
+DOUBLE_BYTE_PAIR(0xF8AC, 0xE64B)
+DOUBLE_BYTE_PAIR(0xF8AD, 0xE64C)
+DOUBLE_BYTE_PAIR(0xF8AE, 0xE64D)
+DOUBLE_BYTE_PAIR(0xF8AF, 0xE64E)
+DOUBLE_BYTE_PAIR(0xF8B0, 0xE64F)
+DOUBLE_BYTE_PAIR(0xF8B1, 0xE650)
+DOUBLE_BYTE_PAIR(0xF8B2, 0xE651)
+DOUBLE_BYTE_PAIR(0xF8B3, 0xE652)
+DOUBLE_BYTE_PAIR(0xF8B4, 0xE653)
+DOUBLE_BYTE_PAIR(0xF8B5, 0xE654)
+DOUBLE_BYTE_PAIR(0xF8B6, 0xE655)
+DOUBLE_BYTE_PAIR(0xF8B7, 0xE656)
+DOUBLE_BYTE_PAIR(0xF8B8, 0xE657)
+DOUBLE_BYTE_PAIR(0xF8B9, 0xE658)
+DOUBLE_BYTE_PAIR(0xF8BA, 0xE659)
+DOUBLE_BYTE_PAIR(0xF8BB, 0xE65A)
+DOUBLE_BYTE_PAIR(0xF8BC, 0xE65B)
+DOUBLE_BYTE_PAIR(0xF8BD, 0xE65C)
+DOUBLE_BYTE_PAIR(0xF8BE, 0xE65D)
+DOUBLE_BYTE_PAIR(0xF8BF, 0xE65E)
+DOUBLE_BYTE_PAIR(0xF8C0, 0xE65F)
+DOUBLE_BYTE_PAIR(0xF8C1, 0xE660)
+DOUBLE_BYTE_PAIR(0xF8C2, 0xE661)
+DOUBLE_BYTE_PAIR(0xF8C3, 0xE662)
+DOUBLE_BYTE_PAIR(0xF8C4, 0xE663)
+DOUBLE_BYTE_PAIR(0xF8C5, 0xE664)
+DOUBLE_BYTE_PAIR(0xF8C6, 0xE665)
+DOUBLE_BYTE_PAIR(0xF8C7, 0xE666)
+DOUBLE_BYTE_PAIR(0xF8C8, 0xE667)
+DOUBLE_BYTE_PAIR(0xF8C9, 0xE668)
+DOUBLE_BYTE_PAIR(0xF8CA, 0xE669)
+DOUBLE_BYTE_PAIR(0xF8CB, 0xE66A)
+DOUBLE_BYTE_PAIR(0xF8CC, 0xE66B)
+DOUBLE_BYTE_PAIR(0xF8CD, 0xE66C)
+DOUBLE_BYTE_PAIR(0xF8CE, 0xE66D)
+DOUBLE_BYTE_PAIR(0xF8CF, 0xE66E)
+DOUBLE_BYTE_PAIR(0xF8D0, 0xE66F)
+DOUBLE_BYTE_PAIR(0xF8D1, 0xE670)
+DOUBLE_BYTE_PAIR(0xF8D2, 0xE671)
+DOUBLE_BYTE_PAIR(0xF8D3, 0xE672)
+DOUBLE_BYTE_PAIR(0xF8D4, 0xE673)
+DOUBLE_BYTE_PAIR(0xF8D5, 0xE674)
+DOUBLE_BYTE_PAIR(0xF8D6, 0xE675)
+DOUBLE_BYTE_PAIR(0xF8D7, 0xE676)
+DOUBLE_BYTE_PAIR(0xF8D8, 0xE677)
+DOUBLE_BYTE_PAIR(0xF8D9, 0xE678)
+DOUBLE_BYTE_PAIR(0xF8DA, 0xE679)
+DOUBLE_BYTE_PAIR(0xF8DB, 0xE67A)
+DOUBLE_BYTE_PAIR(0xF8DC, 0xE67B)
+DOUBLE_BYTE_PAIR(0xF8DD, 0xE67C)
+DOUBLE_BYTE_PAIR(0xF8DE, 0xE67D)
+DOUBLE_BYTE_PAIR(0xF8DF, 0xE67E)
+DOUBLE_BYTE_PAIR(0xF8E0, 0xE67F)
+DOUBLE_BYTE_PAIR(0xF8E1, 0xE680)
+DOUBLE_BYTE_PAIR(0xF8E2, 0xE681)
+DOUBLE_BYTE_PAIR(0xF8E3, 0xE682)
+DOUBLE_BYTE_PAIR(0xF8E4, 0xE683)
+DOUBLE_BYTE_PAIR(0xF8E5, 0xE684)
+DOUBLE_BYTE_PAIR(0xF8E6, 0xE685)
+DOUBLE_BYTE_PAIR(0xF8E7, 0xE686)
+DOUBLE_BYTE_PAIR(0xF8E8, 0xE687)
+DOUBLE_BYTE_PAIR(0xF8E9, 0xE688)
+DOUBLE_BYTE_PAIR(0xF8EA, 0xE689)
+DOUBLE_BYTE_PAIR(0xF8EB, 0xE68A)
+DOUBLE_BYTE_PAIR(0xF8EC, 0xE68B)
+DOUBLE_BYTE_PAIR(0xF8ED, 0xE68C)
+DOUBLE_BYTE_PAIR(0xF8EE, 0xE68D)
+DOUBLE_BYTE_PAIR(0xF8EF, 0xE68E)
+DOUBLE_BYTE_PAIR(0xF8F0, 0xE68F)
+DOUBLE_BYTE_PAIR(0xF8F1, 0xE690)
+DOUBLE_BYTE_PAIR(0xF8F2, 0xE691)
+DOUBLE_BYTE_PAIR(0xF8F3, 0xE692)
+DOUBLE_BYTE_PAIR(0xF8F4, 0xE693)
+DOUBLE_BYTE_PAIR(0xF8F5, 0xE694)
+DOUBLE_BYTE_PAIR(0xF8F6, 0xE695)
+DOUBLE_BYTE_PAIR(0xF8F7, 0xE696)
+DOUBLE_BYTE_PAIR(0xF8F8, 0xE697)
+DOUBLE_BYTE_PAIR(0xF8F9, 0xE698)
+DOUBLE_BYTE_PAIR(0xF8FA, 0xE699)
+DOUBLE_BYTE_PAIR(0xF8FB, 0xE69A)
+DOUBLE_BYTE_PAIR(0xF8FC, 0xE69B)
+DOUBLE_BYTE_PAIR(0xF940, 0xE69C)
+DOUBLE_BYTE_PAIR(0xF941, 0xE69D)
+DOUBLE_BYTE_PAIR(0xF942, 0xE69E)
+DOUBLE_BYTE_PAIR(0xF943, 0xE69F)
+DOUBLE_BYTE_PAIR(0xF944, 0xE6A0)
+DOUBLE_BYTE_PAIR(0xF945, 0xE6A1)
+DOUBLE_BYTE_PAIR(0xF946, 0xE6A2)
+DOUBLE_BYTE_PAIR(0xF947, 0xE6A3)
+DOUBLE_BYTE_PAIR(0xF948, 0xE6A4)
+DOUBLE_BYTE_PAIR(0xF949, 0xE6A5)
+DOUBLE_BYTE_PAIR(0xF94A, 0xE6A6)
+DOUBLE_BYTE_PAIR(0xF94B, 0xE6A7)
+DOUBLE_BYTE_PAIR(0xF94C, 0xE6A8)
+DOUBLE_BYTE_PAIR(0xF94D, 0xE6A9)
+DOUBLE_BYTE_PAIR(0xF94E, 0xE6AA)
+DOUBLE_BYTE_PAIR(0xF94F, 0xE6AB)
+DOUBLE_BYTE_PAIR(0xF950, 0xE6AC)
+DOUBLE_BYTE_PAIR(0xF951, 0xE6AD)
+DOUBLE_BYTE_PAIR(0xF952, 0xE6AE)
+DOUBLE_BYTE_PAIR(0xF953, 0xE6AF)
+DOUBLE_BYTE_PAIR(0xF954, 0xE6B0)
+DOUBLE_BYTE_PAIR(0xF955, 0xE6B1)
+DOUBLE_BYTE_PAIR(0xF956, 0xE6B2)
+DOUBLE_BYTE_PAIR(0xF957, 0xE6B3)
+DOUBLE_BYTE_PAIR(0xF958, 0xE6B4)
+DOUBLE_BYTE_PAIR(0xF959, 0xE6B5)
+DOUBLE_BYTE_PAIR(0xF95A, 0xE6B6)
+DOUBLE_BYTE_PAIR(0xF95B, 0xE6B7)
+DOUBLE_BYTE_PAIR(0xF95C, 0xE6B8)
+DOUBLE_BYTE_PAIR(0xF95D, 0xE6B9)
+DOUBLE_BYTE_PAIR(0xF95E, 0xE6BA)
+DOUBLE_BYTE_PAIR(0xF95F, 0xE6BB)
+DOUBLE_BYTE_PAIR(0xF960, 0xE6BC)
+DOUBLE_BYTE_PAIR(0xF961, 0xE6BD)
+DOUBLE_BYTE_PAIR(0xF962, 0xE6BE)
+DOUBLE_BYTE_PAIR(0xF963, 0xE6BF)
+DOUBLE_BYTE_PAIR(0xF964, 0xE6C0)
+DOUBLE_BYTE_PAIR(0xF965, 0xE6C1)
+DOUBLE_BYTE_PAIR(0xF966, 0xE6C2)
+DOUBLE_BYTE_PAIR(0xF967, 0xE6C3)
+DOUBLE_BYTE_PAIR(0xF968, 0xE6C4)
+DOUBLE_BYTE_PAIR(0xF969, 0xE6C5)
+DOUBLE_BYTE_PAIR(0xF96A, 0xE6C6)
+DOUBLE_BYTE_PAIR(0xF96B, 0xE6C7)
+DOUBLE_BYTE_PAIR(0xF96C, 0xE6C8)
+DOUBLE_BYTE_PAIR(0xF96D, 0xE6C9)
+DOUBLE_BYTE_PAIR(0xF96E, 0xE6CA)
+DOUBLE_BYTE_PAIR(0xF96F, 0xE6CB)
+DOUBLE_BYTE_PAIR(0xF970, 0xE6CC)
+DOUBLE_BYTE_PAIR(0xF971, 0xE6CD)
+DOUBLE_BYTE_PAIR(0xF972, 0xE6CE)
+DOUBLE_BYTE_PAIR(0xF973, 0xE6CF)
+DOUBLE_BYTE_PAIR(0xF974, 0xE6D0)
+DOUBLE_BYTE_PAIR(0xF975, 0xE6D1)
+DOUBLE_BYTE_PAIR(0xF976, 0xE6D2)
+DOUBLE_BYTE_PAIR(0xF977, 0xE6D3)
+DOUBLE_BYTE_PAIR(0xF978, 0xE6D4)
+DOUBLE_BYTE_PAIR(0xF979, 0xE6D5)
+DOUBLE_BYTE_PAIR(0xF97A, 0xE6D6)
+DOUBLE_BYTE_PAIR(0xF97B, 0xE6D7)
+DOUBLE_BYTE_PAIR(0xF97C, 0xE6D8)
+DOUBLE_BYTE_PAIR(0xF97D, 0xE6D9)
+DOUBLE_BYTE_PAIR(0xF97E, 0xE6DA)
+DOUBLE_BYTE_PAIR(0xF980, 0xE6DB)
+DOUBLE_BYTE_PAIR(0xF981, 0xE6DC)
+DOUBLE_BYTE_PAIR(0xF982, 0xE6DD)
+DOUBLE_BYTE_PAIR(0xF983, 0xE6DE)
+DOUBLE_BYTE_PAIR(0xF984, 0xE6DF)
+DOUBLE_BYTE_PAIR(0xF985, 0xE6E0)
+DOUBLE_BYTE_PAIR(0xF986, 0xE6E1)
+DOUBLE_BYTE_PAIR(0xF987, 0xE6E2)
+DOUBLE_BYTE_PAIR(0xF988, 0xE6E3)
+DOUBLE_BYTE_PAIR(0xF989, 0xE6E4)
+DOUBLE_BYTE_PAIR(0xF98A, 0xE6E5)
+DOUBLE_BYTE_PAIR(0xF98B, 0xE6E6)
+DOUBLE_BYTE_PAIR(0xF98C, 0xE6E7)
+DOUBLE_BYTE_PAIR(0xF98D, 0xE6E8)
+DOUBLE_BYTE_PAIR(0xF98E, 0xE6E9)
+DOUBLE_BYTE_PAIR(0xF98F, 0xE6EA)
+DOUBLE_BYTE_PAIR(0xF990, 0xE6EB)
+DOUBLE_BYTE_PAIR(0xF991, 0xE6EC)
+DOUBLE_BYTE_PAIR(0xF992, 0xE6ED)
+DOUBLE_BYTE_PAIR(0xF993, 0xE6EE)
+DOUBLE_BYTE_PAIR(0xF994, 0xE6EF)
+DOUBLE_BYTE_PAIR(0xF995, 0xE6F0)
+DOUBLE_BYTE_PAIR(0xF996, 0xE6F1)
+DOUBLE_BYTE_PAIR(0xF997, 0xE6F2)
+DOUBLE_BYTE_PAIR(0xF998, 0xE6F3)
+DOUBLE_BYTE_PAIR(0xF999, 0xE6F4)
+DOUBLE_BYTE_PAIR(0xF99A, 0xE6F5)
+DOUBLE_BYTE_PAIR(0xF99B, 0xE6F6)
+DOUBLE_BYTE_PAIR(0xF99C, 0xE6F7)
+DOUBLE_BYTE_PAIR(0xF99D, 0xE6F8)
+DOUBLE_BYTE_PAIR(0xF99E, 0xE6F9)
+DOUBLE_BYTE_PAIR(0xF99F, 0xE6FA)
+DOUBLE_BYTE_PAIR(0xF9A0, 0xE6FB)
+DOUBLE_BYTE_PAIR(0xF9A1, 0xE6FC)
+DOUBLE_BYTE_PAIR(0xF9A2, 0xE6FD)
+DOUBLE_BYTE_PAIR(0xF9A3, 0xE6FE)
+DOUBLE_BYTE_PAIR(0xF9A4, 0xE6FF)
+DOUBLE_BYTE_PAIR(0xF9A5, 0xE700)
+DOUBLE_BYTE_PAIR(0xF9A6, 0xE701)
+DOUBLE_BYTE_PAIR(0xF9A7, 0xE702)
+DOUBLE_BYTE_PAIR(0xF9A8, 0xE703)
+DOUBLE_BYTE_PAIR(0xF9A9, 0xE704)
+DOUBLE_BYTE_PAIR(0xF9AA, 0xE705)
+DOUBLE_BYTE_PAIR(0xF9AB, 0xE706)
+DOUBLE_BYTE_PAIR(0xF9AC, 0xE707)
+DOUBLE_BYTE_PAIR(0xF9AD, 0xE708)
+DOUBLE_BYTE_PAIR(0xF9AE, 0xE709)
+DOUBLE_BYTE_PAIR(0xF9AF, 0xE70A)
+DOUBLE_BYTE_PAIR(0xF9B0, 0xE70B)
+DOUBLE_BYTE_PAIR(0xF9B1, 0xE70C)
+DOUBLE_BYTE_PAIR(0xF9B2, 0xE70D)
+DOUBLE_BYTE_PAIR(0xF9B3, 0xE70E)
+DOUBLE_BYTE_PAIR(0xF9B4, 0xE70F)
+DOUBLE_BYTE_PAIR(0xF9B5, 0xE710)
+DOUBLE_BYTE_PAIR(0xF9B6, 0xE711)
+DOUBLE_BYTE_PAIR(0xF9B7, 0xE712)
+DOUBLE_BYTE_PAIR(0xF9B8, 0xE713)
+DOUBLE_BYTE_PAIR(0xF9B9, 0xE714)
+DOUBLE_BYTE_PAIR(0xF9BA, 0xE715)
+DOUBLE_BYTE_PAIR(0xF9BB, 0xE716)
+DOUBLE_BYTE_PAIR(0xF9BC, 0xE717)
+DOUBLE_BYTE_PAIR(0xF9BD, 0xE718)
+DOUBLE_BYTE_PAIR(0xF9BE, 0xE719)
+DOUBLE_BYTE_PAIR(0xF9BF, 0xE71A)
+DOUBLE_BYTE_PAIR(0xF9C0, 0xE71B)
+DOUBLE_BYTE_PAIR(0xF9C1, 0xE71C)
+DOUBLE_BYTE_PAIR(0xF9C2, 0xE71D)
+DOUBLE_BYTE_PAIR(0xF9C3, 0xE71E)
+DOUBLE_BYTE_PAIR(0xF9C4, 0xE71F)
+DOUBLE_BYTE_PAIR(0xF9C5, 0xE720)
+DOUBLE_BYTE_PAIR(0xF9C6, 0xE721)
+DOUBLE_BYTE_PAIR(0xF9C7, 0xE722)
+DOUBLE_BYTE_PAIR(0xF9C8, 0xE723)
+DOUBLE_BYTE_PAIR(0xF9C9, 0xE724)
+DOUBLE_BYTE_PAIR(0xF9CA, 0xE725)
+DOUBLE_BYTE_PAIR(0xF9CB, 0xE726)
+DOUBLE_BYTE_PAIR(0xF9CC, 0xE727)
+DOUBLE_BYTE_PAIR(0xF9CD, 0xE728)
+DOUBLE_BYTE_PAIR(0xF9CE, 0xE729)
+DOUBLE_BYTE_PAIR(0xF9CF, 0xE72A)
+DOUBLE_BYTE_PAIR(0xF9D0, 0xE72B)
+DOUBLE_BYTE_PAIR(0xF9D1, 0xE72C)
+DOUBLE_BYTE_PAIR(0xF9D2, 0xE72D)
+DOUBLE_BYTE_PAIR(0xF9D3, 0xE72E)
+DOUBLE_BYTE_PAIR(0xF9D4, 0xE72F)
+DOUBLE_BYTE_PAIR(0xF9D5, 0xE730)
+DOUBLE_BYTE_PAIR(0xF9D6, 0xE731)
+DOUBLE_BYTE_PAIR(0xF9D7, 0xE732)
+DOUBLE_BYTE_PAIR(0xF9D8, 0xE733)
+DOUBLE_BYTE_PAIR(0xF9D9, 0xE734)
+DOUBLE_BYTE_PAIR(0xF9DA, 0xE735)
+DOUBLE_BYTE_PAIR(0xF9DB, 0xE736)
+DOUBLE_BYTE_PAIR(0xF9DC, 0xE737)
+DOUBLE_BYTE_PAIR(0xF9DD, 0xE738)
+DOUBLE_BYTE_PAIR(0xF9DE, 0xE739)
+DOUBLE_BYTE_PAIR(0xF9DF, 0xE73A)
+DOUBLE_BYTE_PAIR(0xF9E0, 0xE73B)
+DOUBLE_BYTE_PAIR(0xF9E1, 0xE73C)
+DOUBLE_BYTE_PAIR(0xF9E2, 0xE73D)
+DOUBLE_BYTE_PAIR(0xF9E3, 0xE73E)
+DOUBLE_BYTE_PAIR(0xF9E4, 0xE73F)
+DOUBLE_BYTE_PAIR(0xF9E5, 0xE740)
+DOUBLE_BYTE_PAIR(0xF9E6, 0xE741)
+DOUBLE_BYTE_PAIR(0xF9E7, 0xE742)
+DOUBLE_BYTE_PAIR(0xF9E8, 0xE743)
+DOUBLE_BYTE_PAIR(0xF9E9, 0xE744)
+DOUBLE_BYTE_PAIR(0xF9EA, 0xE745)
+DOUBLE_BYTE_PAIR(0xF9EB, 0xE746)
+DOUBLE_BYTE_PAIR(0xF9EC, 0xE747)
+DOUBLE_BYTE_PAIR(0xF9ED, 0xE748)
+DOUBLE_BYTE_PAIR(0xF9EE, 0xE749)
+DOUBLE_BYTE_PAIR(0xF9EF, 0xE74A)
+DOUBLE_BYTE_PAIR(0xF9F0, 0xE74B)
+DOUBLE_BYTE_PAIR(0xF9F1, 0xE74C)
+DOUBLE_BYTE_PAIR(0xF9F2, 0xE74D)
+DOUBLE_BYTE_PAIR(0xF9F3, 0xE74E)
+DOUBLE_BYTE_PAIR(0xF9F4, 0xE74F)
+DOUBLE_BYTE_PAIR(0xF9F5, 0xE750)
+DOUBLE_BYTE_PAIR(0xF9F6, 0xE751)
+DOUBLE_BYTE_PAIR(0xF9F7, 0xE752)
+DOUBLE_BYTE_PAIR(0xF9F8, 0xE753)
+DOUBLE_BYTE_PAIR(0xF9F9, 0xE754)
+DOUBLE_BYTE_PAIR(0xF9FA, 0xE755)
+DOUBLE_BYTE_PAIR(0xF9FB, 0xE756)
+DOUBLE_BYTE_PAIR(0xF9FC, 0xE757)
+DOUBLE_BYTE_PAIR(0xFA40, 0x2170)
+DOUBLE_BYTE_PAIR(0xFA41, 0x2171)
+DOUBLE_BYTE_PAIR(0xFA42, 0x2172)
+DOUBLE_BYTE_PAIR(0xFA43, 0x2173)
+DOUBLE_BYTE_PAIR(0xFA44, 0x2174)
+DOUBLE_BYTE_PAIR(0xFA45, 0x2175)
+DOUBLE_BYTE_PAIR(0xFA46, 0x2176)
+DOUBLE_BYTE_PAIR(0xFA47, 0x2177)
+DOUBLE_BYTE_PAIR(0xFA48, 0x2178)
+DOUBLE_BYTE_PAIR(0xFA49, 0x2179)
+DOUBLE_BYTE_PAIR(0xFA4A, 0x2160)
+DOUBLE_BYTE_PAIR(0xFA4B, 0x2161)
+DOUBLE_BYTE_PAIR(0xFA4C, 0x2162)
+DOUBLE_BYTE_PAIR(0xFA4D, 0x2163)
+DOUBLE_BYTE_PAIR(0xFA4E, 0x2164)
+DOUBLE_BYTE_PAIR(0xFA4F, 0x2165)
+DOUBLE_BYTE_PAIR(0xFA50, 0x2166)
+DOUBLE_BYTE_PAIR(0xFA51, 0x2167)
+DOUBLE_BYTE_PAIR(0xFA52, 0x2168)
+DOUBLE_BYTE_PAIR(0xFA53, 0x2169)
+DOUBLE_BYTE_PAIR(0xFA54, 0xFFE2)
+DOUBLE_BYTE_PAIR(0xFA55, 0xFFE4)
+DOUBLE_BYTE_PAIR(0xFA56, 0xFF07)
+DOUBLE_BYTE_PAIR(0xFA57, 0xFF02)
+DOUBLE_BYTE_PAIR(0xFA58, 0x3231)
+DOUBLE_BYTE_PAIR(0xFA59, 0x2116)
+DOUBLE_BYTE_PAIR(0xFA5A, 0x2121)
+DOUBLE_BYTE_PAIR(0xFA5B, 0x2235)
+DOUBLE_BYTE_PAIR(0xFA5C, 0x7E8A)
+DOUBLE_BYTE_PAIR(0xFA5D, 0x891C)
+DOUBLE_BYTE_PAIR(0xFA5E, 0x9348)
+DOUBLE_BYTE_PAIR(0xFA5F, 0x9288)
+DOUBLE_BYTE_PAIR(0xFA60, 0x84DC)
+DOUBLE_BYTE_PAIR(0xFA61, 0x4FC9)
+DOUBLE_BYTE_PAIR(0xFA62, 0x70BB)
+DOUBLE_BYTE_PAIR(0xFA63, 0x6631)
+DOUBLE_BYTE_PAIR(0xFA64, 0x68C8)
+DOUBLE_BYTE_PAIR(0xFA65, 0x92F9)
+DOUBLE_BYTE_PAIR(0xFA66, 0x66FB)
+DOUBLE_BYTE_PAIR(0xFA67, 0x5F45)
+DOUBLE_BYTE_PAIR(0xFA68, 0x4E28)
+DOUBLE_BYTE_PAIR(0xFA69, 0x4EE1)
+DOUBLE_BYTE_PAIR(0xFA6A, 0x4EFC)
+DOUBLE_BYTE_PAIR(0xFA6B, 0x4F00)
+DOUBLE_BYTE_PAIR(0xFA6C, 0x4F03)
+DOUBLE_BYTE_PAIR(0xFA6D, 0x4F39)
+DOUBLE_BYTE_PAIR(0xFA6E, 0x4F56)
+DOUBLE_BYTE_PAIR(0xFA6F, 0x4F92)
+DOUBLE_BYTE_PAIR(0xFA70, 0x4F8A)
+DOUBLE_BYTE_PAIR(0xFA71, 0x4F9A)
+DOUBLE_BYTE_PAIR(0xFA72, 0x4F94)
+DOUBLE_BYTE_PAIR(0xFA73, 0x4FCD)
+DOUBLE_BYTE_PAIR(0xFA74, 0x5040)
+DOUBLE_BYTE_PAIR(0xFA75, 0x5022)
+DOUBLE_BYTE_PAIR(0xFA76, 0x4FFF)
+DOUBLE_BYTE_PAIR(0xFA77, 0x501E)
+DOUBLE_BYTE_PAIR(0xFA78, 0x5046)
+DOUBLE_BYTE_PAIR(0xFA79, 0x5070)
+DOUBLE_BYTE_PAIR(0xFA7A, 0x5042)
+DOUBLE_BYTE_PAIR(0xFA7B, 0x5094)
+DOUBLE_BYTE_PAIR(0xFA7C, 0x50F4)
+DOUBLE_BYTE_PAIR(0xFA7D, 0x50D8)
+DOUBLE_BYTE_PAIR(0xFA7E, 0x514A)
+DOUBLE_BYTE_PAIR(0xFA80, 0x5164)
+DOUBLE_BYTE_PAIR(0xFA81, 0x519D)
+DOUBLE_BYTE_PAIR(0xFA82, 0x51BE)
+DOUBLE_BYTE_PAIR(0xFA83, 0x51EC)
+DOUBLE_BYTE_PAIR(0xFA84, 0x5215)
+DOUBLE_BYTE_PAIR(0xFA85, 0x529C)
+DOUBLE_BYTE_PAIR(0xFA86, 0x52A6)
+DOUBLE_BYTE_PAIR(0xFA87, 0x52C0)
+DOUBLE_BYTE_PAIR(0xFA88, 0x52DB)
+DOUBLE_BYTE_PAIR(0xFA89, 0x5300)
+DOUBLE_BYTE_PAIR(0xFA8A, 0x5307)
+DOUBLE_BYTE_PAIR(0xFA8B, 0x5324)
+DOUBLE_BYTE_PAIR(0xFA8C, 0x5372)
+DOUBLE_BYTE_PAIR(0xFA8D, 0x5393)
+DOUBLE_BYTE_PAIR(0xFA8E, 0x53B2)
+DOUBLE_BYTE_PAIR(0xFA8F, 0x53DD)
+DOUBLE_BYTE_PAIR(0xFA90, 0xFA0E)
+DOUBLE_BYTE_PAIR(0xFA91, 0x549C)
+DOUBLE_BYTE_PAIR(0xFA92, 0x548A)
+DOUBLE_BYTE_PAIR(0xFA93, 0x54A9)
+DOUBLE_BYTE_PAIR(0xFA94, 0x54FF)
+DOUBLE_BYTE_PAIR(0xFA95, 0x5586)
+DOUBLE_BYTE_PAIR(0xFA96, 0x5759)
+DOUBLE_BYTE_PAIR(0xFA97, 0x5765)
+DOUBLE_BYTE_PAIR(0xFA98, 0x57AC)
+DOUBLE_BYTE_PAIR(0xFA99, 0x57C8)
+DOUBLE_BYTE_PAIR(0xFA9A, 0x57C7)
+DOUBLE_BYTE_PAIR(0xFA9B, 0xFA0F)
+DOUBLE_BYTE_PAIR(0xFA9C, 0xFA10)
+DOUBLE_BYTE_PAIR(0xFA9D, 0x589E)
+DOUBLE_BYTE_PAIR(0xFA9E, 0x58B2)
+DOUBLE_BYTE_PAIR(0xFA9F, 0x590B)
+DOUBLE_BYTE_PAIR(0xFAA0, 0x5953)
+DOUBLE_BYTE_PAIR(0xFAA1, 0x595B)
+DOUBLE_BYTE_PAIR(0xFAA2, 0x595D)
+DOUBLE_BYTE_PAIR(0xFAA3, 0x5963)
+DOUBLE_BYTE_PAIR(0xFAA4, 0x59A4)
+DOUBLE_BYTE_PAIR(0xFAA5, 0x59BA)
+DOUBLE_BYTE_PAIR(0xFAA6, 0x5B56)
+DOUBLE_BYTE_PAIR(0xFAA7, 0x5BC0)
+DOUBLE_BYTE_PAIR(0xFAA8, 0x752F)
+DOUBLE_BYTE_PAIR(0xFAA9, 0x5BD8)
+DOUBLE_BYTE_PAIR(0xFAAA, 0x5BEC)
+DOUBLE_BYTE_PAIR(0xFAAB, 0x5C1E)
+DOUBLE_BYTE_PAIR(0xFAAC, 0x5CA6)
+DOUBLE_BYTE_PAIR(0xFAAD, 0x5CBA)
+DOUBLE_BYTE_PAIR(0xFAAE, 0x5CF5)
+DOUBLE_BYTE_PAIR(0xFAAF, 0x5D27)
+DOUBLE_BYTE_PAIR(0xFAB0, 0x5D53)
+DOUBLE_BYTE_PAIR(0xFAB1, 0xFA11)
+DOUBLE_BYTE_PAIR(0xFAB2, 0x5D42)
+DOUBLE_BYTE_PAIR(0xFAB3, 0x5D6D)
+DOUBLE_BYTE_PAIR(0xFAB4, 0x5DB8)
+DOUBLE_BYTE_PAIR(0xFAB5, 0x5DB9)
+DOUBLE_BYTE_PAIR(0xFAB6, 0x5DD0)
+DOUBLE_BYTE_PAIR(0xFAB7, 0x5F21)
+DOUBLE_BYTE_PAIR(0xFAB8, 0x5F34)
+DOUBLE_BYTE_PAIR(0xFAB9, 0x5F67)
+DOUBLE_BYTE_PAIR(0xFABA, 0x5FB7)
+DOUBLE_BYTE_PAIR(0xFABB, 0x5FDE)
+DOUBLE_BYTE_PAIR(0xFABC, 0x605D)
+DOUBLE_BYTE_PAIR(0xFABD, 0x6085)
+DOUBLE_BYTE_PAIR(0xFABE, 0x608A)
+DOUBLE_BYTE_PAIR(0xFABF, 0x60DE)
+DOUBLE_BYTE_PAIR(0xFAC0, 0x60D5)
+DOUBLE_BYTE_PAIR(0xFAC1, 0x6120)
+DOUBLE_BYTE_PAIR(0xFAC2, 0x60F2)
+DOUBLE_BYTE_PAIR(0xFAC3, 0x6111)
+DOUBLE_BYTE_PAIR(0xFAC4, 0x6137)
+DOUBLE_BYTE_PAIR(0xFAC5, 0x6130)
+DOUBLE_BYTE_PAIR(0xFAC6, 0x6198)
+DOUBLE_BYTE_PAIR(0xFAC7, 0x6213)
+DOUBLE_BYTE_PAIR(0xFAC8, 0x62A6)
+DOUBLE_BYTE_PAIR(0xFAC9, 0x63F5)
+DOUBLE_BYTE_PAIR(0xFACA, 0x6460)
+DOUBLE_BYTE_PAIR(0xFACB, 0x649D)
+DOUBLE_BYTE_PAIR(0xFACC, 0x64CE)
+DOUBLE_BYTE_PAIR(0xFACD, 0x654E)
+DOUBLE_BYTE_PAIR(0xFACE, 0x6600)
+DOUBLE_BYTE_PAIR(0xFACF, 0x6615)
+DOUBLE_BYTE_PAIR(0xFAD0, 0x663B)
+DOUBLE_BYTE_PAIR(0xFAD1, 0x6609)
+DOUBLE_BYTE_PAIR(0xFAD2, 0x662E)
+DOUBLE_BYTE_PAIR(0xFAD3, 0x661E)
+DOUBLE_BYTE_PAIR(0xFAD4, 0x6624)
+DOUBLE_BYTE_PAIR(0xFAD5, 0x6665)
+DOUBLE_BYTE_PAIR(0xFAD6, 0x6657)
+DOUBLE_BYTE_PAIR(0xFAD7, 0x6659)
+DOUBLE_BYTE_PAIR(0xFAD8, 0xFA12)
+DOUBLE_BYTE_PAIR(0xFAD9, 0x6673)
+DOUBLE_BYTE_PAIR(0xFADA, 0x6699)
+DOUBLE_BYTE_PAIR(0xFADB, 0x66A0)
+DOUBLE_BYTE_PAIR(0xFADC, 0x66B2)
+DOUBLE_BYTE_PAIR(0xFADD, 0x66BF)
+DOUBLE_BYTE_PAIR(0xFADE, 0x66FA)
+DOUBLE_BYTE_PAIR(0xFADF, 0x670E)
+DOUBLE_BYTE_PAIR(0xFAE0, 0xF929)
+DOUBLE_BYTE_PAIR(0xFAE1, 0x6766)
+DOUBLE_BYTE_PAIR(0xFAE2, 0x67BB)
+DOUBLE_BYTE_PAIR(0xFAE3, 0x6852)
+DOUBLE_BYTE_PAIR(0xFAE4, 0x67C0)
+DOUBLE_BYTE_PAIR(0xFAE5, 0x6801)
+DOUBLE_BYTE_PAIR(0xFAE6, 0x6844)
+DOUBLE_BYTE_PAIR(0xFAE7, 0x68CF)
+DOUBLE_BYTE_PAIR(0xFAE8, 0xFA13)
+DOUBLE_BYTE_PAIR(0xFAE9, 0x6968)
+DOUBLE_BYTE_PAIR(0xFAEA, 0xFA14)
+DOUBLE_BYTE_PAIR(0xFAEB, 0x6998)
+DOUBLE_BYTE_PAIR(0xFAEC, 0x69E2)
+DOUBLE_BYTE_PAIR(0xFAED, 0x6A30)
+DOUBLE_BYTE_PAIR(0xFAEE, 0x6A6B)
+DOUBLE_BYTE_PAIR(0xFAEF, 0x6A46)
+DOUBLE_BYTE_PAIR(0xFAF0, 0x6A73)
+DOUBLE_BYTE_PAIR(0xFAF1, 0x6A7E)
+DOUBLE_BYTE_PAIR(0xFAF2, 0x6AE2)
+DOUBLE_BYTE_PAIR(0xFAF3, 0x6AE4)
+DOUBLE_BYTE_PAIR(0xFAF4, 0x6BD6)
+DOUBLE_BYTE_PAIR(0xFAF5, 0x6C3F)
+DOUBLE_BYTE_PAIR(0xFAF6, 0x6C5C)
+DOUBLE_BYTE_PAIR(0xFAF7, 0x6C86)
+DOUBLE_BYTE_PAIR(0xFAF8, 0x6C6F)
+DOUBLE_BYTE_PAIR(0xFAF9, 0x6CDA)
+DOUBLE_BYTE_PAIR(0xFAFA, 0x6D04)
+DOUBLE_BYTE_PAIR(0xFAFB, 0x6D87)
+DOUBLE_BYTE_PAIR(0xFAFC, 0x6D6F)
+DOUBLE_BYTE_PAIR(0xFB40, 0x6D96)
+DOUBLE_BYTE_PAIR(0xFB41, 0x6DAC)
+DOUBLE_BYTE_PAIR(0xFB42, 0x6DCF)
+DOUBLE_BYTE_PAIR(0xFB43, 0x6DF8)
+DOUBLE_BYTE_PAIR(0xFB44, 0x6DF2)
+DOUBLE_BYTE_PAIR(0xFB45, 0x6DFC)
+DOUBLE_BYTE_PAIR(0xFB46, 0x6E39)
+DOUBLE_BYTE_PAIR(0xFB47, 0x6E5C)
+DOUBLE_BYTE_PAIR(0xFB48, 0x6E27)
+DOUBLE_BYTE_PAIR(0xFB49, 0x6E3C)
+DOUBLE_BYTE_PAIR(0xFB4A, 0x6EBF)
+DOUBLE_BYTE_PAIR(0xFB4B, 0x6F88)
+DOUBLE_BYTE_PAIR(0xFB4C, 0x6FB5)
+DOUBLE_BYTE_PAIR(0xFB4D, 0x6FF5)
+DOUBLE_BYTE_PAIR(0xFB4E, 0x7005)
+DOUBLE_BYTE_PAIR(0xFB4F, 0x7007)
+DOUBLE_BYTE_PAIR(0xFB50, 0x7028)
+DOUBLE_BYTE_PAIR(0xFB51, 0x7085)
+DOUBLE_BYTE_PAIR(0xFB52, 0x70AB)
+DOUBLE_BYTE_PAIR(0xFB53, 0x710F)
+DOUBLE_BYTE_PAIR(0xFB54, 0x7104)
+DOUBLE_BYTE_PAIR(0xFB55, 0x715C)
+DOUBLE_BYTE_PAIR(0xFB56, 0x7146)
+DOUBLE_BYTE_PAIR(0xFB57, 0x7147)
+DOUBLE_BYTE_PAIR(0xFB58, 0xFA15)
+DOUBLE_BYTE_PAIR(0xFB59, 0x71C1)
+DOUBLE_BYTE_PAIR(0xFB5A, 0x71FE)
+DOUBLE_BYTE_PAIR(0xFB5B, 0x72B1)
+DOUBLE_BYTE_PAIR(0xFB5C, 0x72BE)
+DOUBLE_BYTE_PAIR(0xFB5D, 0x7324)
+DOUBLE_BYTE_PAIR(0xFB5E, 0xFA16)
+DOUBLE_BYTE_PAIR(0xFB5F, 0x7377)
+DOUBLE_BYTE_PAIR(0xFB60, 0x73BD)
+DOUBLE_BYTE_PAIR(0xFB61, 0x73C9)
+DOUBLE_BYTE_PAIR(0xFB62, 0x73D6)
+DOUBLE_BYTE_PAIR(0xFB63, 0x73E3)
+DOUBLE_BYTE_PAIR(0xFB64, 0x73D2)
+DOUBLE_BYTE_PAIR(0xFB65, 0x7407)
+DOUBLE_BYTE_PAIR(0xFB66, 0x73F5)
+DOUBLE_BYTE_PAIR(0xFB67, 0x7426)
+DOUBLE_BYTE_PAIR(0xFB68, 0x742A)
+DOUBLE_BYTE_PAIR(0xFB69, 0x7429)
+DOUBLE_BYTE_PAIR(0xFB6A, 0x742E)
+DOUBLE_BYTE_PAIR(0xFB6B, 0x7462)
+DOUBLE_BYTE_PAIR(0xFB6C, 0x7489)
+DOUBLE_BYTE_PAIR(0xFB6D, 0x749F)
+DOUBLE_BYTE_PAIR(0xFB6E, 0x7501)
+DOUBLE_BYTE_PAIR(0xFB6F, 0x756F)
+DOUBLE_BYTE_PAIR(0xFB70, 0x7682)
+DOUBLE_BYTE_PAIR(0xFB71, 0x769C)
+DOUBLE_BYTE_PAIR(0xFB72, 0x769E)
+DOUBLE_BYTE_PAIR(0xFB73, 0x769B)
+DOUBLE_BYTE_PAIR(0xFB74, 0x76A6)
+DOUBLE_BYTE_PAIR(0xFB75, 0xFA17)
+DOUBLE_BYTE_PAIR(0xFB76, 0x7746)
+DOUBLE_BYTE_PAIR(0xFB77, 0x52AF)
+DOUBLE_BYTE_PAIR(0xFB78, 0x7821)
+DOUBLE_BYTE_PAIR(0xFB79, 0x784E)
+DOUBLE_BYTE_PAIR(0xFB7A, 0x7864)
+DOUBLE_BYTE_PAIR(0xFB7B, 0x787A)
+DOUBLE_BYTE_PAIR(0xFB7C, 0x7930)
+DOUBLE_BYTE_PAIR(0xFB7D, 0xFA18)
+DOUBLE_BYTE_PAIR(0xFB7E, 0xFA19)
+DOUBLE_BYTE_PAIR(0xFB80, 0xFA1A)
+DOUBLE_BYTE_PAIR(0xFB81, 0x7994)
+DOUBLE_BYTE_PAIR(0xFB82, 0xFA1B)
+DOUBLE_BYTE_PAIR(0xFB83, 0x799B)
+DOUBLE_BYTE_PAIR(0xFB84, 0x7AD1)
+DOUBLE_BYTE_PAIR(0xFB85, 0x7AE7)
+DOUBLE_BYTE_PAIR(0xFB86, 0xFA1C)
+DOUBLE_BYTE_PAIR(0xFB87, 0x7AEB)
+DOUBLE_BYTE_PAIR(0xFB88, 0x7B9E)
+DOUBLE_BYTE_PAIR(0xFB89, 0xFA1D)
+DOUBLE_BYTE_PAIR(0xFB8A, 0x7D48)
+DOUBLE_BYTE_PAIR(0xFB8B, 0x7D5C)
+DOUBLE_BYTE_PAIR(0xFB8C, 0x7DB7)
+DOUBLE_BYTE_PAIR(0xFB8D, 0x7DA0)
+DOUBLE_BYTE_PAIR(0xFB8E, 0x7DD6)
+DOUBLE_BYTE_PAIR(0xFB8F, 0x7E52)
+DOUBLE_BYTE_PAIR(0xFB90, 0x7F47)
+DOUBLE_BYTE_PAIR(0xFB91, 0x7FA1)
+DOUBLE_BYTE_PAIR(0xFB92, 0xFA1E)
+DOUBLE_BYTE_PAIR(0xFB93, 0x8301)
+DOUBLE_BYTE_PAIR(0xFB94, 0x8362)
+DOUBLE_BYTE_PAIR(0xFB95, 0x837F)
+DOUBLE_BYTE_PAIR(0xFB96, 0x83C7)
+DOUBLE_BYTE_PAIR(0xFB97, 0x83F6)
+DOUBLE_BYTE_PAIR(0xFB98, 0x8448)
+DOUBLE_BYTE_PAIR(0xFB99, 0x84B4)
+DOUBLE_BYTE_PAIR(0xFB9A, 0x8553)
+DOUBLE_BYTE_PAIR(0xFB9B, 0x8559)
+DOUBLE_BYTE_PAIR(0xFB9C, 0x856B)
+DOUBLE_BYTE_PAIR(0xFB9D, 0xFA1F)
+DOUBLE_BYTE_PAIR(0xFB9E, 0x85B0)
+DOUBLE_BYTE_PAIR(0xFB9F, 0xFA20)
+DOUBLE_BYTE_PAIR(0xFBA0, 0xFA21)
+DOUBLE_BYTE_PAIR(0xFBA1, 0x8807)
+DOUBLE_BYTE_PAIR(0xFBA2, 0x88F5)
+DOUBLE_BYTE_PAIR(0xFBA3, 0x8A12)
+DOUBLE_BYTE_PAIR(0xFBA4, 0x8A37)
+DOUBLE_BYTE_PAIR(0xFBA5, 0x8A79)
+DOUBLE_BYTE_PAIR(0xFBA6, 0x8AA7)
+DOUBLE_BYTE_PAIR(0xFBA7, 0x8ABE)
+DOUBLE_BYTE_PAIR(0xFBA8, 0x8ADF)
+DOUBLE_BYTE_PAIR(0xFBA9, 0xFA22)
+DOUBLE_BYTE_PAIR(0xFBAA, 0x8AF6)
+DOUBLE_BYTE_PAIR(0xFBAB, 0x8B53)
+DOUBLE_BYTE_PAIR(0xFBAC, 0x8B7F)
+DOUBLE_BYTE_PAIR(0xFBAD, 0x8CF0)
+DOUBLE_BYTE_PAIR(0xFBAE, 0x8CF4)
+DOUBLE_BYTE_PAIR(0xFBAF, 0x8D12)
+DOUBLE_BYTE_PAIR(0xFBB0, 0x8D76)
+DOUBLE_BYTE_PAIR(0xFBB1, 0xFA23)
+DOUBLE_BYTE_PAIR(0xFBB2, 0x8ECF)
+DOUBLE_BYTE_PAIR(0xFBB3, 0xFA24)
+DOUBLE_BYTE_PAIR(0xFBB4, 0xFA25)
+DOUBLE_BYTE_PAIR(0xFBB5, 0x9067)
+DOUBLE_BYTE_PAIR(0xFBB6, 0x90DE)
+DOUBLE_BYTE_PAIR(0xFBB7, 0xFA26)
+DOUBLE_BYTE_PAIR(0xFBB8, 0x9115)
+DOUBLE_BYTE_PAIR(0xFBB9, 0x9127)
+DOUBLE_BYTE_PAIR(0xFBBA, 0x91DA)
+DOUBLE_BYTE_PAIR(0xFBBB, 0x91D7)
+DOUBLE_BYTE_PAIR(0xFBBC, 0x91DE)
+DOUBLE_BYTE_PAIR(0xFBBD, 0x91ED)
+DOUBLE_BYTE_PAIR(0xFBBE, 0x91EE)
+DOUBLE_BYTE_PAIR(0xFBBF, 0x91E4)
+DOUBLE_BYTE_PAIR(0xFBC0, 0x91E5)
+DOUBLE_BYTE_PAIR(0xFBC1, 0x9206)
+DOUBLE_BYTE_PAIR(0xFBC2, 0x9210)
+DOUBLE_BYTE_PAIR(0xFBC3, 0x920A)
+DOUBLE_BYTE_PAIR(0xFBC4, 0x923A)
+DOUBLE_BYTE_PAIR(0xFBC5, 0x9240)
+DOUBLE_BYTE_PAIR(0xFBC6, 0x923C)
+DOUBLE_BYTE_PAIR(0xFBC7, 0x924E)
+DOUBLE_BYTE_PAIR(0xFBC8, 0x9259)
+DOUBLE_BYTE_PAIR(0xFBC9, 0x9251)
+DOUBLE_BYTE_PAIR(0xFBCA, 0x9239)
+DOUBLE_BYTE_PAIR(0xFBCB, 0x9267)
+DOUBLE_BYTE_PAIR(0xFBCC, 0x92A7)
+DOUBLE_BYTE_PAIR(0xFBCD, 0x9277)
+DOUBLE_BYTE_PAIR(0xFBCE, 0x9278)
+DOUBLE_BYTE_PAIR(0xFBCF, 0x92E7)
+DOUBLE_BYTE_PAIR(0xFBD0, 0x92D7)
+DOUBLE_BYTE_PAIR(0xFBD1, 0x92D9)
+DOUBLE_BYTE_PAIR(0xFBD2, 0x92D0)
+DOUBLE_BYTE_PAIR(0xFBD3, 0xFA27)
+DOUBLE_BYTE_PAIR(0xFBD4, 0x92D5)
+DOUBLE_BYTE_PAIR(0xFBD5, 0x92E0)
+DOUBLE_BYTE_PAIR(0xFBD6, 0x92D3)
+DOUBLE_BYTE_PAIR(0xFBD7, 0x9325)
+DOUBLE_BYTE_PAIR(0xFBD8, 0x9321)
+DOUBLE_BYTE_PAIR(0xFBD9, 0x92FB)
+DOUBLE_BYTE_PAIR(0xFBDA, 0xFA28)
+DOUBLE_BYTE_PAIR(0xFBDB, 0x931E)
+DOUBLE_BYTE_PAIR(0xFBDC, 0x92FF)
+DOUBLE_BYTE_PAIR(0xFBDD, 0x931D)
+DOUBLE_BYTE_PAIR(0xFBDE, 0x9302)
+DOUBLE_BYTE_PAIR(0xFBDF, 0x9370)
+DOUBLE_BYTE_PAIR(0xFBE0, 0x9357)
+DOUBLE_BYTE_PAIR(0xFBE1, 0x93A4)
+DOUBLE_BYTE_PAIR(0xFBE2, 0x93C6)
+DOUBLE_BYTE_PAIR(0xFBE3, 0x93DE)
+DOUBLE_BYTE_PAIR(0xFBE4, 0x93F8)
+DOUBLE_BYTE_PAIR(0xFBE5, 0x9431)
+DOUBLE_BYTE_PAIR(0xFBE6, 0x9445)
+DOUBLE_BYTE_PAIR(0xFBE7, 0x9448)
+DOUBLE_BYTE_PAIR(0xFBE8, 0x9592)
+DOUBLE_BYTE_PAIR(0xFBE9, 0xF9DC)
+DOUBLE_BYTE_PAIR(0xFBEA, 0xFA29)
+DOUBLE_BYTE_PAIR(0xFBEB, 0x969D)
+DOUBLE_BYTE_PAIR(0xFBEC, 0x96AF)
+DOUBLE_BYTE_PAIR(0xFBED, 0x9733)
+DOUBLE_BYTE_PAIR(0xFBEE, 0x973B)
+DOUBLE_BYTE_PAIR(0xFBEF, 0x9743)
+DOUBLE_BYTE_PAIR(0xFBF0, 0x974D)
+DOUBLE_BYTE_PAIR(0xFBF1, 0x974F)
+DOUBLE_BYTE_PAIR(0xFBF2, 0x9751)
+DOUBLE_BYTE_PAIR(0xFBF3, 0x9755)
+DOUBLE_BYTE_PAIR(0xFBF4, 0x9857)
+DOUBLE_BYTE_PAIR(0xFBF5, 0x9865)
+DOUBLE_BYTE_PAIR(0xFBF6, 0xFA2A)
+DOUBLE_BYTE_PAIR(0xFBF7, 0xFA2B)
+DOUBLE_BYTE_PAIR(0xFBF8, 0x9927)
+DOUBLE_BYTE_PAIR(0xFBF9, 0xFA2C)
+DOUBLE_BYTE_PAIR(0xFBFA, 0x999E)
+DOUBLE_BYTE_PAIR(0xFBFB, 0x9A4E)
+DOUBLE_BYTE_PAIR(0xFBFC, 0x9AD9)
+DOUBLE_BYTE_PAIR(0xFC40, 0x9ADC)
+DOUBLE_BYTE_PAIR(0xFC41, 0x9B75)
+DOUBLE_BYTE_PAIR(0xFC42, 0x9B72)
+DOUBLE_BYTE_PAIR(0xFC43, 0x9B8F)
+DOUBLE_BYTE_PAIR(0xFC44, 0x9BB1)
+DOUBLE_BYTE_PAIR(0xFC45, 0x9BBB)
+DOUBLE_BYTE_PAIR(0xFC46, 0x9C00)
+DOUBLE_BYTE_PAIR(0xFC47, 0x9D70)
+DOUBLE_BYTE_PAIR(0xFC48, 0x9D6B)
+DOUBLE_BYTE_PAIR(0xFC49, 0xFA2D)
+DOUBLE_BYTE_PAIR(0xFC4A, 0x9E19)
+DOUBLE_BYTE_PAIR(0xFC4B, 0x9ED1)
+
+#undef DOUBLE_BYTE_PAIR
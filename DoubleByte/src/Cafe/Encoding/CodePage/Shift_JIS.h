@@ -0,0 +1,45 @@
+#ifndef CAFE_ENCODING_CODEPAGE_SHIFT_JIS_H
+#define CAFE_ENCODING_CODEPAGE_SHIFT_JIS_H
+
+#include "DoubleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  表示 Windows 所使用的 Shift_JIS 编码（Windows-31J）
+		constexpr CodePageType ShiftJis = static_cast<CodePageType>(932);
+
+		namespace Detail
+		{
+			inline constexpr DoubleBytePair ShiftJisMapping[] = {
+#define DOUBLE_BYTE_PAIR(code, codePoint) { code, codePoint },
+#include "Impl/Shift_JISImpl.h"
+			};
+
+			/// @brief  判断是否为 NEC 选定 IBM 扩展文字（0xED40-0xEEFC）
+			/// @remark 这些文字均同时存在于 IBM 扩展文字（0xFA40-0xFC4B）中，与 Windows 一致，编码时
+			///         优先使用 IBM 扩展文字
+			///         NEC 特殊文字（第 13 区）及 JIS X 0208 中的文字排在 IBM 扩展文字之前，因此仍优先
+			///         使用，如 U+2160 编码为 0x8754，U+FFE2 编码为 0x81CA
+			[[nodiscard]] constexpr bool IsNecSelectedIbmExtension(std::uint16_t code) noexcept
+			{
+				return code >= 0xED40 && code <= 0xEEFC;
+			}
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<ShiftJis>
+		    : Detail::DoubleByteCommonPart<ShiftJis, Detail::ShiftJisMapping,
+		                                   Detail::IsNecSelectedIbmExtension>
+		{
+			static constexpr const char Name[] = "Shift_JIS";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::ShiftJis)
+#endif
@@ -0,0 +1,409 @@
+#ifndef CAFE_ENCODING_CODEPAGE_GB18030
+#define CAFE_ENCODING_CODEPAGE_GB18030
+
+#include <Cafe/Encoding/CodePage/GB2312.h>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  表示 GB18030-2005 编码
+		/// @remark 双字节部分与 GB2312（CP936）共享映射表，四字节部分以线性区间表示，
+		///         可与 Unicode 的全部码点（代理码点除外）往返转换
+		/// @see    https://en.wikipedia.org/wiki/GB_18030
+		constexpr CodePageType GB18030 = static_cast<CodePageType>(54936);
+
+		namespace Detail
+		{
+			struct GB18030TwoBytePair
+			{
+				std::uint16_t GB18030;
+				std::uint16_t Unicode;
+			};
+
+			/// @brief  CP936 未映射且不在用户自定义区内的双字节编码，以 GB18030 编码排序
+			inline constexpr auto GB18030ExtraTwoByteMapping = []() constexpr
+			{
+				std::array<GB18030TwoBytePair, 255> result{};
+				auto iter = result.begin();
+#define GB18030_TWO_BYTE_PAIR(gb18030, unicode)                                                    \
+	*iter++ = { gb18030, unicode };
+#define GB18030_RANGE(pointer, codePoint)
+#include "Impl/GB18030Impl.h"
+				return result;
+			}
+			();
+
+			/// @brief  同 GB18030ExtraTwoByteMapping，以码点排序
+			inline constexpr auto UnicodeToGB18030ExtraTwoByteMapping = []() constexpr
+			{
+				auto result = GB18030ExtraTwoByteMapping;
+				std::sort(result.begin(), result.end(),
+				          [](GB18030TwoBytePair const& a, GB18030TwoBytePair const& b) {
+					          return a.Unicode < b.Unicode;
+				          });
+				return result;
+			}
+			();
+
+			/// @brief  四字节编码的线性区间，Pointer 及 CodePoint 均单调递增
+			/// @remark 区间内的 Pointer 与 CodePoint 一一线性对应，查找时二分查找所在的区间
+			struct GB18030Range
+			{
+				std::uint32_t Pointer;
+				CodePointType CodePoint;
+			};
+
+			inline constexpr auto GB18030Ranges = []() constexpr
+			{
+				std::array<GB18030Range, 206> result{};
+				auto iter = result.begin();
+#define GB18030_TWO_BYTE_PAIR(gb18030, unicode)
+#define GB18030_RANGE(pointer, codePoint)                                                          \
+	*iter++ = { pointer, codePoint };
+#include "Impl/GB18030Impl.h"
+				return result;
+			}
+			();
+
+			/// @brief  BMP 内四字节编码的 Pointer 个数
+			constexpr std::uint32_t GB18030BmpPointerCount = 39420;
+
+			/// @brief  辅助平面的起始 Pointer，对应 0x90308130
+			constexpr std::uint32_t GB18030SupplementaryPointerBegin = 189000;
+
+			// GB18030-2005 将 0xA8BC 改为映射到 U+1E3F，原先 U+1E3F 所在的四字节编码改为映射到 U+E7C7，
+			// 区间表按 GB18030-2000 生成，因此需单独处理
+			constexpr std::uint32_t GB18030SpecialPointer = 7457;
+			constexpr CodePointType GB18030SpecialCodePoint = 0xE7C7;
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<GB18030>
+		{
+		private:
+			[[nodiscard]] static constexpr bool IsLeadByte(unsigned char value) noexcept
+			{
+				return value >= 0x81 && value <= 0xFE;
+			}
+
+			[[nodiscard]] static constexpr bool IsFourByteTrailDigit(unsigned char value) noexcept
+			{
+				return value >= 0x30 && value <= 0x39;
+			}
+
+			[[nodiscard]] static constexpr bool IsTwoByteTrailByte(unsigned char value) noexcept
+			{
+				return value >= 0x40 && value <= 0xFE && value != 0x7F;
+			}
+
+			// 调用方保证 firstUnit 为首字节且 secondUnit 为双字节编码的尾字节，此时总能映射到码点
+			[[nodiscard]] static constexpr CodePointType
+			TwoByteToCodePoint(unsigned char firstUnit, unsigned char secondUnit) noexcept
+			{
+				const auto unit = static_cast<std::uint16_t>(firstUnit << 8 | secondUnit);
+				const auto index = static_cast<std::size_t>(unit - 0x8140);
+				if (index < std::size(Detail::GB2312ToUnicodeMapping) &&
+				    Detail::GB2312ToUnicodeMapping[index])
+				{
+					return Detail::GB2312ToUnicodeMapping[index];
+				}
+
+				// 用户自定义区映射到私用区
+				if (secondUnit >= 0xA1)
+				{
+					if (firstUnit >= 0xAA && firstUnit <= 0xAF)
+					{
+						return 0xE000 + (firstUnit - 0xAA) * 94 + (secondUnit - 0xA1);
+					}
+
+					if (firstUnit >= 0xF8)
+					{
+						return 0xE234 + (firstUnit - 0xF8) * 94 + (secondUnit - 0xA1);
+					}
+				}
+				else if (firstUnit >= 0xA1 && firstUnit <= 0xA7)
+				{
+					return 0xE4C6 + (firstUnit - 0xA1) * 96 + (secondUnit - 0x40) -
+					       (secondUnit > 0x7F);
+				}
+
+				const auto iter = std::lower_bound(
+				    Detail::GB18030ExtraTwoByteMapping.begin(),
+				    Detail::GB18030ExtraTwoByteMapping.end(), unit,
+				    [](Detail::GB18030TwoBytePair const& pair, std::uint16_t value) {
+					    return pair.GB18030 < value;
+				    });
+				assert(iter != Detail::GB18030ExtraTwoByteMapping.end() && iter->GB18030 == unit);
+				return iter->Unicode;
+			}
+
+			// 返回 0 表示无对应的双字节编码
+			[[nodiscard]] static constexpr std::uint16_t
+			CodePointToTwoByte(CodePointType codePoint) noexcept
+			{
+				assert(codePoint >= 0x80 && codePoint <= 0xFFFF);
+
+				if (const auto mappedUnit = Detail::UnicodeToGB2312Mapping[codePoint])
+				{
+					return mappedUnit;
+				}
+
+				if (codePoint >= 0xE000 && codePoint < 0xE234)
+				{
+					const auto offset = codePoint - 0xE000;
+					return static_cast<std::uint16_t>((0xAA + offset / 94) << 8 |
+					                                  (0xA1 + offset % 94));
+				}
+
+				if (codePoint >= 0xE234 && codePoint < 0xE4C6)
+				{
+					const auto offset = codePoint - 0xE234;
+					return static_cast<std::uint16_t>((0xF8 + offset / 94) << 8 |
+					                                  (0xA1 + offset % 94));
+				}
+
+				if (codePoint >= 0xE4C6 && codePoint < 0xE766)
+				{
+					const auto offset = codePoint - 0xE4C6;
+					const auto secondUnit = 0x40 + offset % 96;
+					return static_cast<std::uint16_t>((0xA1 + offset / 96) << 8 |
+					                                  (secondUnit + (secondUnit >= 0x7F)));
+				}
+
+				const auto iter = std::lower_bound(
+				    Detail::UnicodeToGB18030ExtraTwoByteMapping.begin(),
+				    Detail::UnicodeToGB18030ExtraTwoByteMapping.end(), codePoint,
+				    [](Detail::GB18030TwoBytePair const& pair, CodePointType value) {
+					    return pair.Unicode < value;
+				    });
+				if (iter != Detail::UnicodeToGB18030ExtraTwoByteMapping.end() &&
+				    iter->Unicode == codePoint)
+				{
+					return iter->GB18030;
+				}
+
+				return 0;
+			}
+
+			// 返回 MaxValidCodePoint + 1 表示 pointer 无效
+			[[nodiscard]] static constexpr CodePointType
+			FourBytePointerToCodePoint(std::uint32_t pointer) noexcept
+			{
+				if (pointer < Detail::GB18030BmpPointerCount)
+				{
+					if (pointer == Detail::GB18030SpecialPointer)
+					{
+						return Detail::GB18030SpecialCodePoint;
+					}
+
+					const auto iter = std::prev(std::upper_bound(
+					    Detail::GB18030Ranges.begin(), Detail::GB18030Ranges.end(), pointer,
+					    [](std::uint32_t value, Detail::GB18030Range const& range) {
+						    return value < range.Pointer;
+					    }));
+					return iter->CodePoint + (pointer - iter->Pointer);
+				}
+
+				if (pointer >= Detail::GB18030SupplementaryPointerBegin &&
+				    pointer - Detail::GB18030SupplementaryPointerBegin <= MaxValidCodePoint - 0x10000)
+				{
+					return 0x10000 + (pointer - Detail::GB18030SupplementaryPointerBegin);
+				}
+
+				return MaxValidCodePoint + 1;
+			}
+
+			// 调用方保证 codePoint 无对应的单字节及双字节编码
+			[[nodiscard]] static constexpr std::uint32_t
+			CodePointToFourBytePointer(CodePointType codePoint) noexcept
+			{
+				if (codePoint >= 0x10000)
+				{
+					return Detail::GB18030SupplementaryPointerBegin + (codePoint - 0x10000);
+				}
+
+				if (codePoint == Detail::GB18030SpecialCodePoint)
+				{
+					return Detail::GB18030SpecialPointer;
+				}
+
+				const auto iter = std::prev(std::upper_bound(
+				    Detail::GB18030Ranges.begin(), Detail::GB18030Ranges.end(), codePoint,
+				    [](CodePointType value, Detail::GB18030Range const& range) {
+					    return value < range.CodePoint;
+				    }));
+				return iter->Pointer + (codePoint - iter->CodePoint);
+			}
+
+		public:
+			static constexpr const char Name[] = "GB18030";
+
+			using CharType = char;
+
+			static constexpr bool IsVariableWidth = true;
+
+			static constexpr std::size_t MaxWidth = 4;
+
+			/// @remark 仅由首字节无法区分双字节及四字节编码，此时返回最小可能宽度 2，
+			///         实际宽度需由第二个字节确定，ToCodePoint 会正确处理此情况
+			///         四字节编码的尾字节可能与 ASCII 及首字节重合，因此无法判断中间字节
+			[[nodiscard]] static constexpr std::ptrdiff_t GetWidth(CharType value) noexcept
+			{
+				const auto charValue = static_cast<unsigned char>(value);
+				if (charValue < 0x80)
+				{
+					return 1;
+				}
+
+				if (IsLeadByte(charValue))
+				{
+					return 2;
+				}
+
+				return 0;
+			}
+
+			template <std::size_t Extent, typename OutputReceiver>
+			static constexpr void ToCodePoint(std::span<const CharType, Extent> const& span,
+			                                  OutputReceiver&& receiver)
+			{
+				if (span.empty())
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Incomplete>{ 0, 1 });
+					return;
+				}
+
+				const auto firstUnit = static_cast<unsigned char>(span[0]);
+				if (firstUnit < 0x80)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Accept>{
+					        static_cast<CodePointType>(firstUnit), 1u });
+					return;
+				}
+
+				if (!IsLeadByte(firstUnit))
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Reject>{});
+					return;
+				}
+
+				if (span.size() < 2)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Incomplete>{ 0, 1 });
+					return;
+				}
+
+				const auto secondUnit = static_cast<unsigned char>(span[1]);
+				if (IsTwoByteTrailByte(secondUnit))
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Accept>{
+					        TwoByteToCodePoint(firstUnit, secondUnit), 2u });
+					return;
+				}
+
+				if (!IsFourByteTrailDigit(secondUnit))
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Reject>{});
+					return;
+				}
+
+				if (span.size() < 4)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Incomplete>{
+					        0, static_cast<std::size_t>(4 - span.size()) });
+					return;
+				}
+
+				const auto thirdUnit = static_cast<unsigned char>(span[2]);
+				const auto fourthUnit = static_cast<unsigned char>(span[3]);
+				if (!IsLeadByte(thirdUnit) || !IsFourByteTrailDigit(fourthUnit))
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Reject>{});
+					return;
+				}
+
+				const auto pointer = static_cast<std::uint32_t>(
+				    (firstUnit - 0x81) * 12600 + (secondUnit - 0x30) * 1260 +
+				    (thirdUnit - 0x81) * 10 + (fourthUnit - 0x30));
+				const auto result = FourBytePointerToCodePoint(pointer);
+				if (result > MaxValidCodePoint)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Reject>{});
+				}
+				else
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB18030, CodePoint, EncodingResultCode::Accept>{ result,
+					                                                                    4u });
+				}
+			}
+
+			template <typename OutputReceiver>
+			static constexpr void FromCodePoint(CodePointType codePoint, OutputReceiver&& receiver)
+			{
+				if (codePoint > MaxValidCodePoint || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<CodePoint, GB18030, EncodingResultCode::Reject>{});
+					return;
+				}
+
+				if (codePoint < 0x80)
+				{
+					const auto result = static_cast<CharType>(codePoint);
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<CodePoint, GB18030, EncodingResultCode::Accept>{
+					        std::span(&result, 1) });
+					return;
+				}
+
+				if (codePoint <= 0xFFFF)
+				{
+					if (const auto mappedUnit = CodePointToTwoByte(codePoint))
+					{
+						const CharType result[]{ static_cast<CharType>((mappedUnit & 0xFF00) >> 8),
+							                     static_cast<CharType>(mappedUnit & 0xFF) };
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<CodePoint, GB18030, EncodingResultCode::Accept>{
+						        std::span(result) });
+						return;
+					}
+				}
+
+				auto pointer = CodePointToFourBytePointer(codePoint);
+				CharType result[4]{};
+				result[3] = static_cast<CharType>(0x30 + pointer % 10);
+				pointer /= 10;
+				result[2] = static_cast<CharType>(0x81 + pointer % 126);
+				pointer /= 126;
+				result[1] = static_cast<CharType>(0x30 + pointer % 10);
+				pointer /= 10;
+				result[0] = static_cast<CharType>(0x81 + pointer);
+				std::forward<OutputReceiver>(receiver)(
+				    EncodingResult<CodePoint, GB18030, EncodingResultCode::Accept>{
+				        std::span(result) });
+			}
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::GB18030)
+#endif
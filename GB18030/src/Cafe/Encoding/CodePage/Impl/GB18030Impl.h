@@ -0,0 +1,469 @@
+// Generated from https://www.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP936.TXT and GB 18030-2005
+// GB18030_TWO_BYTE_PAIR: two-byte codes not mapped by CP936, excluding the user-defined areas
+// GB18030_RANGE: four-byte linear pointer ranges of the BMP, pointer 7457 (U+E7C7) is handled separately
+
+GB18030_TWO_BYTE_PAIR(0xA2AB, 0xE766)
+GB18030_TWO_BYTE_PAIR(0xA2AC, 0xE767)
+GB18030_TWO_BYTE_PAIR(0xA2AD, 0xE768)
+GB18030_TWO_BYTE_PAIR(0xA2AE, 0xE769)
+GB18030_TWO_BYTE_PAIR(0xA2AF, 0xE76A)
+GB18030_TWO_BYTE_PAIR(0xA2B0, 0xE76B)
+GB18030_TWO_BYTE_PAIR(0xA2E3, 0x20AC)
+GB18030_TWO_BYTE_PAIR(0xA2E4, 0xE76D)
+GB18030_TWO_BYTE_PAIR(0xA2EF, 0xE76E)
+GB18030_TWO_BYTE_PAIR(0xA2F0, 0xE76F)
+GB18030_TWO_BYTE_PAIR(0xA2FD, 0xE770)
+GB18030_TWO_BYTE_PAIR(0xA2FE, 0xE771)
+GB18030_TWO_BYTE_PAIR(0xA4F4, 0xE772)
+GB18030_TWO_BYTE_PAIR(0xA4F5, 0xE773)
+GB18030_TWO_BYTE_PAIR(0xA4F6, 0xE774)
+GB18030_TWO_BYTE_PAIR(0xA4F7, 0xE775)
+GB18030_TWO_BYTE_PAIR(0xA4F8, 0xE776)
+GB18030_TWO_BYTE_PAIR(0xA4F9, 0xE777)
+GB18030_TWO_BYTE_PAIR(0xA4FA, 0xE778)
+GB18030_TWO_BYTE_PAIR(0xA4FB, 0xE779)
+GB18030_TWO_BYTE_PAIR(0xA4FC, 0xE77A)
+GB18030_TWO_BYTE_PAIR(0xA4FD, 0xE77B)
+GB18030_TWO_BYTE_PAIR(0xA4FE, 0xE77C)
+GB18030_TWO_BYTE_PAIR(0xA5F7, 0xE77D)
+GB18030_TWO_BYTE_PAIR(0xA5F8, 0xE77E)
+GB18030_TWO_BYTE_PAIR(0xA5F9, 0xE77F)
+GB18030_TWO_BYTE_PAIR(0xA5FA, 0xE780)
+GB18030_TWO_BYTE_PAIR(0xA5FB, 0xE781)
+GB18030_TWO_BYTE_PAIR(0xA5FC, 0xE782)
+GB18030_TWO_BYTE_PAIR(0xA5FD, 0xE783)
+GB18030_TWO_BYTE_PAIR(0xA5FE, 0xE784)
+GB18030_TWO_BYTE_PAIR(0xA6B9, 0xE785)
+GB18030_TWO_BYTE_PAIR(0xA6BA, 0xE786)
+GB18030_TWO_BYTE_PAIR(0xA6BB, 0xE787)
+GB18030_TWO_BYTE_PAIR(0xA6BC, 0xE788)
+GB18030_TWO_BYTE_PAIR(0xA6BD, 0xE789)
+GB18030_TWO_BYTE_PAIR(0xA6BE, 0xE78A)
+GB18030_TWO_BYTE_PAIR(0xA6BF, 0xE78B)
+GB18030_TWO_BYTE_PAIR(0xA6C0, 0xE78C)
+GB18030_TWO_BYTE_PAIR(0xA6D9, 0xE78D)
+GB18030_TWO_BYTE_PAIR(0xA6DA, 0xE78E)
+GB18030_TWO_BYTE_PAIR(0xA6DB, 0xE78F)
+GB18030_TWO_BYTE_PAIR(0xA6DC, 0xE790)
+GB18030_TWO_BYTE_PAIR(0xA6DD, 0xE791)
+GB18030_TWO_BYTE_PAIR(0xA6DE, 0xE792)
+GB18030_TWO_BYTE_PAIR(0xA6DF, 0xE793)
+GB18030_TWO_BYTE_PAIR(0xA6EC, 0xE794)
+GB18030_TWO_BYTE_PAIR(0xA6ED, 0xE795)
+GB18030_TWO_BYTE_PAIR(0xA6F3, 0xE796)
+GB18030_TWO_BYTE_PAIR(0xA6F6, 0xE797)
+GB18030_TWO_BYTE_PAIR(0xA6F7, 0xE798)
+GB18030_TWO_BYTE_PAIR(0xA6F8, 0xE799)
+GB18030_TWO_BYTE_PAIR(0xA6F9, 0xE79A)
+GB18030_TWO_BYTE_PAIR(0xA6FA, 0xE79B)
+GB18030_TWO_BYTE_PAIR(0xA6FB, 0xE79C)
+GB18030_TWO_BYTE_PAIR(0xA6FC, 0xE79D)
+GB18030_TWO_BYTE_PAIR(0xA6FD, 0xE79E)
+GB18030_TWO_BYTE_PAIR(0xA6FE, 0xE79F)
+GB18030_TWO_BYTE_PAIR(0xA7C2, 0xE7A0)
+GB18030_TWO_BYTE_PAIR(0xA7C3, 0xE7A1)
+GB18030_TWO_BYTE_PAIR(0xA7C4, 0xE7A2)
+GB18030_TWO_BYTE_PAIR(0xA7C5, 0xE7A3)
+GB18030_TWO_BYTE_PAIR(0xA7C6, 0xE7A4)
+GB18030_TWO_BYTE_PAIR(0xA7C7, 0xE7A5)
+GB18030_TWO_BYTE_PAIR(0xA7C8, 0xE7A6)
+GB18030_TWO_BYTE_PAIR(0xA7C9, 0xE7A7)
+GB18030_TWO_BYTE_PAIR(0xA7CA, 0xE7A8)
+GB18030_TWO_BYTE_PAIR(0xA7CB, 0xE7A9)
+GB18030_TWO_BYTE_PAIR(0xA7CC, 0xE7AA)
+GB18030_TWO_BYTE_PAIR(0xA7CD, 0xE7AB)
+GB18030_TWO_BYTE_PAIR(0xA7CE, 0xE7AC)
+GB18030_TWO_BYTE_PAIR(0xA7CF, 0xE7AD)
+GB18030_TWO_BYTE_PAIR(0xA7D0, 0xE7AE)
+GB18030_TWO_BYTE_PAIR(0xA7F2, 0xE7AF)
+GB18030_TWO_BYTE_PAIR(0xA7F3, 0xE7B0)
+GB18030_TWO_BYTE_PAIR(0xA7F4, 0xE7B1)
+GB18030_TWO_BYTE_PAIR(0xA7F5, 0xE7B2)
+GB18030_TWO_BYTE_PAIR(0xA7F6, 0xE7B3)
+GB18030_TWO_BYTE_PAIR(0xA7F7, 0xE7B4)
+GB18030_TWO_BYTE_PAIR(0xA7F8, 0xE7B5)
+GB18030_TWO_BYTE_PAIR(0xA7F9, 0xE7B6)
+GB18030_TWO_BYTE_PAIR(0xA7FA, 0xE7B7)
+GB18030_TWO_BYTE_PAIR(0xA7FB, 0xE7B8)
+GB18030_TWO_BYTE_PAIR(0xA7FC, 0xE7B9)
+GB18030_TWO_BYTE_PAIR(0xA7FD, 0xE7BA)
+GB18030_TWO_BYTE_PAIR(0xA7FE, 0xE7BB)
+GB18030_TWO_BYTE_PAIR(0xA896, 0xE7BC)
+GB18030_TWO_BYTE_PAIR(0xA897, 0xE7BD)
+GB18030_TWO_BYTE_PAIR(0xA898, 0xE7BE)
+GB18030_TWO_BYTE_PAIR(0xA899, 0xE7BF)
+GB18030_TWO_BYTE_PAIR(0xA89A, 0xE7C0)
+GB18030_TWO_BYTE_PAIR(0xA89B, 0xE7C1)
+GB18030_TWO_BYTE_PAIR(0xA89C, 0xE7C2)
+GB18030_TWO_BYTE_PAIR(0xA89D, 0xE7C3)
+GB18030_TWO_BYTE_PAIR(0xA89E, 0xE7C4)
+GB18030_TWO_BYTE_PAIR(0xA89F, 0xE7C5)
+GB18030_TWO_BYTE_PAIR(0xA8A0, 0xE7C6)
+GB18030_TWO_BYTE_PAIR(0xA8BC, 0x1E3F)
+GB18030_TWO_BYTE_PAIR(0xA8BF, 0x01F9)
+GB18030_TWO_BYTE_PAIR(0xA8C1, 0xE7C9)
+GB18030_TWO_BYTE_PAIR(0xA8C2, 0xE7CA)
+GB18030_TWO_BYTE_PAIR(0xA8C3, 0xE7CB)
+GB18030_TWO_BYTE_PAIR(0xA8C4, 0xE7CC)
+GB18030_TWO_BYTE_PAIR(0xA8EA, 0xE7CD)
+GB18030_TWO_BYTE_PAIR(0xA8EB, 0xE7CE)
+GB18030_TWO_BYTE_PAIR(0xA8EC, 0xE7CF)
+GB18030_TWO_BYTE_PAIR(0xA8ED, 0xE7D0)
+GB18030_TWO_BYTE_PAIR(0xA8EE, 0xE7D1)
+GB18030_TWO_BYTE_PAIR(0xA8EF, 0xE7D2)
+GB18030_TWO_BYTE_PAIR(0xA8F0, 0xE7D3)
+GB18030_TWO_BYTE_PAIR(0xA8F1, 0xE7D4)
+GB18030_TWO_BYTE_PAIR(0xA8F2, 0xE7D5)
+GB18030_TWO_BYTE_PAIR(0xA8F3, 0xE7D6)
+GB18030_TWO_BYTE_PAIR(0xA8F4, 0xE7D7)
+GB18030_TWO_BYTE_PAIR(0xA8F5, 0xE7D8)
+GB18030_TWO_BYTE_PAIR(0xA8F6, 0xE7D9)
+GB18030_TWO_BYTE_PAIR(0xA8F7, 0xE7DA)
+GB18030_TWO_BYTE_PAIR(0xA8F8, 0xE7DB)
+GB18030_TWO_BYTE_PAIR(0xA8F9, 0xE7DC)
+GB18030_TWO_BYTE_PAIR(0xA8FA, 0xE7DD)
+GB18030_TWO_BYTE_PAIR(0xA8FB, 0xE7DE)
+GB18030_TWO_BYTE_PAIR(0xA8FC, 0xE7DF)
+GB18030_TWO_BYTE_PAIR(0xA8FD, 0xE7E0)
+GB18030_TWO_BYTE_PAIR(0xA8FE, 0xE7E1)
+GB18030_TWO_BYTE_PAIR(0xA958, 0xE7E2)
+GB18030_TWO_BYTE_PAIR(0xA95B, 0xE7E3)
+GB18030_TWO_BYTE_PAIR(0xA95D, 0xE7E4)
+GB18030_TWO_BYTE_PAIR(0xA95E, 0xE7E5)
+GB18030_TWO_BYTE_PAIR(0xA95F, 0xE7E6)
+GB18030_TWO_BYTE_PAIR(0xA989, 0x303E)
+GB18030_TWO_BYTE_PAIR(0xA98A, 0x2FF0)
+GB18030_TWO_BYTE_PAIR(0xA98B, 0x2FF1)
+GB18030_TWO_BYTE_PAIR(0xA98C, 0x2FF2)
+GB18030_TWO_BYTE_PAIR(0xA98D, 0x2FF3)
+GB18030_TWO_BYTE_PAIR(0xA98E, 0x2FF4)
+GB18030_TWO_BYTE_PAIR(0xA98F, 0x2FF5)
+GB18030_TWO_BYTE_PAIR(0xA990, 0x2FF6)
+GB18030_TWO_BYTE_PAIR(0xA991, 0x2FF7)
+GB18030_TWO_BYTE_PAIR(0xA992, 0x2FF8)
+GB18030_TWO_BYTE_PAIR(0xA993, 0x2FF9)
+GB18030_TWO_BYTE_PAIR(0xA994, 0x2FFA)
+GB18030_TWO_BYTE_PAIR(0xA995, 0x2FFB)
+GB18030_TWO_BYTE_PAIR(0xA997, 0xE7F4)
+GB18030_TWO_BYTE_PAIR(0xA998, 0xE7F5)
+GB18030_TWO_BYTE_PAIR(0xA999, 0xE7F6)
+GB18030_TWO_BYTE_PAIR(0xA99A, 0xE7F7)
+GB18030_TWO_BYTE_PAIR(0xA99B, 0xE7F8)
+GB18030_TWO_BYTE_PAIR(0xA99C, 0xE7F9)
+GB18030_TWO_BYTE_PAIR(0xA99D, 0xE7FA)
+GB18030_TWO_BYTE_PAIR(0xA99E, 0xE7FB)
+GB18030_TWO_BYTE_PAIR(0xA99F, 0xE7FC)
+GB18030_TWO_BYTE_PAIR(0xA9A0, 0xE7FD)
+GB18030_TWO_BYTE_PAIR(0xA9A1, 0xE7FE)
+GB18030_TWO_BYTE_PAIR(0xA9A2, 0xE7FF)
+GB18030_TWO_BYTE_PAIR(0xA9A3, 0xE800)
+GB18030_TWO_BYTE_PAIR(0xA9F0, 0xE801)
+GB18030_TWO_BYTE_PAIR(0xA9F1, 0xE802)
+GB18030_TWO_BYTE_PAIR(0xA9F2, 0xE803)
+GB18030_TWO_BYTE_PAIR(0xA9F3, 0xE804)
+GB18030_TWO_BYTE_PAIR(0xA9F4, 0xE805)
+GB18030_TWO_BYTE_PAIR(0xA9F5, 0xE806)
+GB18030_TWO_BYTE_PAIR(0xA9F6, 0xE807)
+GB18030_TWO_BYTE_PAIR(0xA9F7, 0xE808)
+GB18030_TWO_BYTE_PAIR(0xA9F8, 0xE809)
+GB18030_TWO_BYTE_PAIR(0xA9F9, 0xE80A)
+GB18030_TWO_BYTE_PAIR(0xA9FA, 0xE80B)
+GB18030_TWO_BYTE_PAIR(0xA9FB, 0xE80C)
+GB18030_TWO_BYTE_PAIR(0xA9FC, 0xE80D)
+GB18030_TWO_BYTE_PAIR(0xA9FD, 0xE80E)
+GB18030_TWO_BYTE_PAIR(0xA9FE, 0xE80F)
+GB18030_TWO_BYTE_PAIR(0xD7FA, 0xE810)
+GB18030_TWO_BYTE_PAIR(0xD7FB, 0xE811)
+GB18030_TWO_BYTE_PAIR(0xD7FC, 0xE812)
+GB18030_TWO_BYTE_PAIR(0xD7FD, 0xE813)
+GB18030_TWO_BYTE_PAIR(0xD7FE, 0xE814)
+GB18030_TWO_BYTE_PAIR(0xFE50, 0x2E81)
+GB18030_TWO_BYTE_PAIR(0xFE51, 0xE816)
+GB18030_TWO_BYTE_PAIR(0xFE52, 0xE817)
+GB18030_TWO_BYTE_PAIR(0xFE53, 0xE818)
+GB18030_TWO_BYTE_PAIR(0xFE54, 0x2E84)
+GB18030_TWO_BYTE_PAIR(0xFE55, 0x3473)
+GB18030_TWO_BYTE_PAIR(0xFE56, 0x3447)
+GB18030_TWO_BYTE_PAIR(0xFE57, 0x2E88)
+GB18030_TWO_BYTE_PAIR(0xFE58, 0x2E8B)
+GB18030_TWO_BYTE_PAIR(0xFE59, 0xE81E)
+GB18030_TWO_BYTE_PAIR(0xFE5A, 0x359E)
+GB18030_TWO_BYTE_PAIR(0xFE5B, 0x361A)
+GB18030_TWO_BYTE_PAIR(0xFE5C, 0x360E)
+GB18030_TWO_BYTE_PAIR(0xFE5D, 0x2E8C)
+GB18030_TWO_BYTE_PAIR(0xFE5E, 0x2E97)
+GB18030_TWO_BYTE_PAIR(0xFE5F, 0x396E)
+GB18030_TWO_BYTE_PAIR(0xFE60, 0x3918)
+GB18030_TWO_BYTE_PAIR(0xFE61, 0xE826)
+GB18030_TWO_BYTE_PAIR(0xFE62, 0x39CF)
+GB18030_TWO_BYTE_PAIR(0xFE63, 0x39DF)
+GB18030_TWO_BYTE_PAIR(0xFE64, 0x3A73)
+GB18030_TWO_BYTE_PAIR(0xFE65, 0x39D0)
+GB18030_TWO_BYTE_PAIR(0xFE66, 0xE82B)
+GB18030_TWO_BYTE_PAIR(0xFE67, 0xE82C)
+GB18030_TWO_BYTE_PAIR(0xFE68, 0x3B4E)
+GB18030_TWO_BYTE_PAIR(0xFE69, 0x3C6E)
+GB18030_TWO_BYTE_PAIR(0xFE6A, 0x3CE0)
+GB18030_TWO_BYTE_PAIR(0xFE6B, 0x2EA7)
+GB18030_TWO_BYTE_PAIR(0xFE6C, 0xE831)
+GB18030_TWO_BYTE_PAIR(0xFE6D, 0xE832)
+GB18030_TWO_BYTE_PAIR(0xFE6E, 0x2EAA)
+GB18030_TWO_BYTE_PAIR(0xFE6F, 0x4056)
+GB18030_TWO_BYTE_PAIR(0xFE70, 0x415F)
+GB18030_TWO_BYTE_PAIR(0xFE71, 0x2EAE)
+GB18030_TWO_BYTE_PAIR(0xFE72, 0x4337)
+GB18030_TWO_BYTE_PAIR(0xFE73, 0x2EB3)
+GB18030_TWO_BYTE_PAIR(0xFE74, 0x2EB6)
+GB18030_TWO_BYTE_PAIR(0xFE75, 0x2EB7)
+GB18030_TWO_BYTE_PAIR(0xFE76, 0xE83B)
+GB18030_TWO_BYTE_PAIR(0xFE77, 0x43B1)
+GB18030_TWO_BYTE_PAIR(0xFE78, 0x43AC)
+GB18030_TWO_BYTE_PAIR(0xFE79, 0x2EBB)
+GB18030_TWO_BYTE_PAIR(0xFE7A, 0x43DD)
+GB18030_TWO_BYTE_PAIR(0xFE7B, 0x44D6)
+GB18030_TWO_BYTE_PAIR(0xFE7C, 0x4661)
+GB18030_TWO_BYTE_PAIR(0xFE7D, 0x464C)
+GB18030_TWO_BYTE_PAIR(0xFE7E, 0xE843)
+GB18030_TWO_BYTE_PAIR(0xFE80, 0x4723)
+GB18030_TWO_BYTE_PAIR(0xFE81, 0x4729)
+GB18030_TWO_BYTE_PAIR(0xFE82, 0x477C)
+GB18030_TWO_BYTE_PAIR(0xFE83, 0x478D)
+GB18030_TWO_BYTE_PAIR(0xFE84, 0x2ECA)
+GB18030_TWO_BYTE_PAIR(0xFE85, 0x4947)
+GB18030_TWO_BYTE_PAIR(0xFE86, 0x497A)
+GB18030_TWO_BYTE_PAIR(0xFE87, 0x497D)
+GB18030_TWO_BYTE_PAIR(0xFE88, 0x4982)
+GB18030_TWO_BYTE_PAIR(0xFE89, 0x4983)
+GB18030_TWO_BYTE_PAIR(0xFE8A, 0x4985)
+GB18030_TWO_BYTE_PAIR(0xFE8B, 0x4986)
+GB18030_TWO_BYTE_PAIR(0xFE8C, 0x499F)
+GB18030_TWO_BYTE_PAIR(0xFE8D, 0x499B)
+GB18030_TWO_BYTE_PAIR(0xFE8E, 0x49B7)
+GB18030_TWO_BYTE_PAIR(0xFE8F, 0x49B6)
+GB18030_TWO_BYTE_PAIR(0xFE90, 0xE854)
+GB18030_TWO_BYTE_PAIR(0xFE91, 0xE855)
+GB18030_TWO_BYTE_PAIR(0xFE92, 0x4CA3)
+GB18030_TWO_BYTE_PAIR(0xFE93, 0x4C9F)
+GB18030_TWO_BYTE_PAIR(0xFE94, 0x4CA0)
+GB18030_TWO_BYTE_PAIR(0xFE95, 0x4CA1)
+GB18030_TWO_BYTE_PAIR(0xFE96, 0x4C77)
+GB18030_TWO_BYTE_PAIR(0xFE97, 0x4CA2)
+GB18030_TWO_BYTE_PAIR(0xFE98, 0x4D13)
+GB18030_TWO_BYTE_PAIR(0xFE99, 0x4D14)
+GB18030_TWO_BYTE_PAIR(0xFE9A, 0x4D15)
+GB18030_TWO_BYTE_PAIR(0xFE9B, 0x4D16)
+GB18030_TWO_BYTE_PAIR(0xFE9C, 0x4D17)
+GB18030_TWO_BYTE_PAIR(0xFE9D, 0x4D18)
+GB18030_TWO_BYTE_PAIR(0xFE9E, 0x4D19)
+GB18030_TWO_BYTE_PAIR(0xFE9F, 0x4DAE)
+GB18030_TWO_BYTE_PAIR(0xFEA0, 0xE864)
+
+GB18030_RANGE(0, 0x0080)
+GB18030_RANGE(36, 0x00A5)
+GB18030_RANGE(38, 0x00A9)
+GB18030_RANGE(45, 0x00B2)
+GB18030_RANGE(50, 0x00B8)
+GB18030_RANGE(81, 0x00D8)
+GB18030_RANGE(89, 0x00E2)
+GB18030_RANGE(95, 0x00EB)
+GB18030_RANGE(96, 0x00EE)
+GB18030_RANGE(100, 0x00F4)
+GB18030_RANGE(103, 0x00F8)
+GB18030_RANGE(104, 0x00FB)
+GB18030_RANGE(105, 0x00FD)
+GB18030_RANGE(109, 0x0102)
+GB18030_RANGE(126, 0x0114)
+GB18030_RANGE(133, 0x011C)
+GB18030_RANGE(148, 0x012C)
+GB18030_RANGE(172, 0x0145)
+GB18030_RANGE(175, 0x0149)
+GB18030_RANGE(179, 0x014E)
+GB18030_RANGE(208, 0x016C)
+GB18030_RANGE(306, 0x01CF)
+GB18030_RANGE(307, 0x01D1)
+GB18030_RANGE(308, 0x01D3)
+GB18030_RANGE(309, 0x01D5)
+GB18030_RANGE(310, 0x01D7)
+GB18030_RANGE(311, 0x01D9)
+GB18030_RANGE(312, 0x01DB)
+GB18030_RANGE(313, 0x01DD)
+GB18030_RANGE(341, 0x01FA)
+GB18030_RANGE(428, 0x0252)
+GB18030_RANGE(443, 0x0262)
+GB18030_RANGE(544, 0x02C8)
+GB18030_RANGE(545, 0x02CC)
+GB18030_RANGE(558, 0x02DA)
+GB18030_RANGE(741, 0x03A2)
+GB18030_RANGE(742, 0x03AA)
+GB18030_RANGE(749, 0x03C2)
+GB18030_RANGE(750, 0x03CA)
+GB18030_RANGE(805, 0x0402)
+GB18030_RANGE(819, 0x0450)
+GB18030_RANGE(820, 0x0452)
+GB18030_RANGE(7922, 0x2011)
+GB18030_RANGE(7924, 0x2017)
+GB18030_RANGE(7925, 0x201A)
+GB18030_RANGE(7927, 0x201E)
+GB18030_RANGE(7934, 0x2027)
+GB18030_RANGE(7943, 0x2031)
+GB18030_RANGE(7944, 0x2034)
+GB18030_RANGE(7945, 0x2036)
+GB18030_RANGE(7950, 0x203C)
+GB18030_RANGE(8062, 0x20AD)
+GB18030_RANGE(8148, 0x2104)
+GB18030_RANGE(8149, 0x2106)
+GB18030_RANGE(8152, 0x210A)
+GB18030_RANGE(8164, 0x2117)
+GB18030_RANGE(8174, 0x2122)
+GB18030_RANGE(8236, 0x216C)
+GB18030_RANGE(8240, 0x217A)
+GB18030_RANGE(8262, 0x2194)
+GB18030_RANGE(8264, 0x219A)
+GB18030_RANGE(8374, 0x2209)
+GB18030_RANGE(8380, 0x2210)
+GB18030_RANGE(8381, 0x2212)
+GB18030_RANGE(8384, 0x2216)
+GB18030_RANGE(8388, 0x221B)
+GB18030_RANGE(8390, 0x2221)
+GB18030_RANGE(8392, 0x2224)
+GB18030_RANGE(8393, 0x2226)
+GB18030_RANGE(8394, 0x222C)
+GB18030_RANGE(8396, 0x222F)
+GB18030_RANGE(8401, 0x2238)
+GB18030_RANGE(8406, 0x223E)
+GB18030_RANGE(8416, 0x2249)
+GB18030_RANGE(8419, 0x224D)
+GB18030_RANGE(8424, 0x2253)
+GB18030_RANGE(8437, 0x2262)
+GB18030_RANGE(8439, 0x2268)
+GB18030_RANGE(8445, 0x2270)
+GB18030_RANGE(8482, 0x2296)
+GB18030_RANGE(8485, 0x229A)
+GB18030_RANGE(8496, 0x22A6)
+GB18030_RANGE(8521, 0x22C0)
+GB18030_RANGE(8603, 0x2313)
+GB18030_RANGE(8936, 0x246A)
+GB18030_RANGE(8946, 0x249C)
+GB18030_RANGE(9046, 0x254C)
+GB18030_RANGE(9050, 0x2574)
+GB18030_RANGE(9063, 0x2590)
+GB18030_RANGE(9066, 0x2596)
+GB18030_RANGE(9076, 0x25A2)
+GB18030_RANGE(9092, 0x25B4)
+GB18030_RANGE(9100, 0x25BE)
+GB18030_RANGE(9108, 0x25C8)
+GB18030_RANGE(9111, 0x25CC)
+GB18030_RANGE(9113, 0x25D0)
+GB18030_RANGE(9131, 0x25E6)
+GB18030_RANGE(9162, 0x2607)
+GB18030_RANGE(9164, 0x260A)
+GB18030_RANGE(9218, 0x2641)
+GB18030_RANGE(9219, 0x2643)
+GB18030_RANGE(11329, 0x2E82)
+GB18030_RANGE(11331, 0x2E85)
+GB18030_RANGE(11334, 0x2E89)
+GB18030_RANGE(11336, 0x2E8D)
+GB18030_RANGE(11346, 0x2E98)
+GB18030_RANGE(11361, 0x2EA8)
+GB18030_RANGE(11363, 0x2EAB)
+GB18030_RANGE(11366, 0x2EAF)
+GB18030_RANGE(11370, 0x2EB4)
+GB18030_RANGE(11372, 0x2EB8)
+GB18030_RANGE(11375, 0x2EBC)
+GB18030_RANGE(11389, 0x2ECB)
+GB18030_RANGE(11682, 0x2FFC)
+GB18030_RANGE(11686, 0x3004)
+GB18030_RANGE(11687, 0x3018)
+GB18030_RANGE(11692, 0x301F)
+GB18030_RANGE(11694, 0x302A)
+GB18030_RANGE(11714, 0x303F)
+GB18030_RANGE(11716, 0x3094)
+GB18030_RANGE(11723, 0x309F)
+GB18030_RANGE(11725, 0x30F7)
+GB18030_RANGE(11730, 0x30FF)
+GB18030_RANGE(11736, 0x312A)
+GB18030_RANGE(11982, 0x322A)
+GB18030_RANGE(11989, 0x3232)
+GB18030_RANGE(12102, 0x32A4)
+GB18030_RANGE(12336, 0x3390)
+GB18030_RANGE(12348, 0x339F)
+GB18030_RANGE(12350, 0x33A2)
+GB18030_RANGE(12384, 0x33C5)
+GB18030_RANGE(12393, 0x33CF)
+GB18030_RANGE(12395, 0x33D3)
+GB18030_RANGE(12397, 0x33D6)
+GB18030_RANGE(12510, 0x3448)
+GB18030_RANGE(12553, 0x3474)
+GB18030_RANGE(12851, 0x359F)
+GB18030_RANGE(12962, 0x360F)
+GB18030_RANGE(12973, 0x361B)
+GB18030_RANGE(13738, 0x3919)
+GB18030_RANGE(13823, 0x396F)
+GB18030_RANGE(13919, 0x39D1)
+GB18030_RANGE(13933, 0x39E0)
+GB18030_RANGE(14080, 0x3A74)
+GB18030_RANGE(14298, 0x3B4F)
+GB18030_RANGE(14585, 0x3C6F)
+GB18030_RANGE(14698, 0x3CE1)
+GB18030_RANGE(15583, 0x4057)
+GB18030_RANGE(15847, 0x4160)
+GB18030_RANGE(16318, 0x4338)
+GB18030_RANGE(16434, 0x43AD)
+GB18030_RANGE(16438, 0x43B2)
+GB18030_RANGE(16481, 0x43DE)
+GB18030_RANGE(16729, 0x44D7)
+GB18030_RANGE(17102, 0x464D)
+GB18030_RANGE(17122, 0x4662)
+GB18030_RANGE(17315, 0x4724)
+GB18030_RANGE(17320, 0x472A)
+GB18030_RANGE(17402, 0x477D)
+GB18030_RANGE(17418, 0x478E)
+GB18030_RANGE(17859, 0x4948)
+GB18030_RANGE(17909, 0x497B)
+GB18030_RANGE(17911, 0x497E)
+GB18030_RANGE(17915, 0x4984)
+GB18030_RANGE(17916, 0x4987)
+GB18030_RANGE(17936, 0x499C)
+GB18030_RANGE(17939, 0x49A0)
+GB18030_RANGE(17961, 0x49B8)
+GB18030_RANGE(18664, 0x4C78)
+GB18030_RANGE(18703, 0x4CA4)
+GB18030_RANGE(18814, 0x4D1A)
+GB18030_RANGE(18962, 0x4DAF)
+GB18030_RANGE(19043, 0x9FA6)
+GB18030_RANGE(33469, 0xE76C)
+GB18030_RANGE(33470, 0xE7C8)
+GB18030_RANGE(33471, 0xE7E7)
+GB18030_RANGE(33484, 0xE815)
+GB18030_RANGE(33485, 0xE819)
+GB18030_RANGE(33490, 0xE81F)
+GB18030_RANGE(33497, 0xE827)
+GB18030_RANGE(33501, 0xE82D)
+GB18030_RANGE(33505, 0xE833)
+GB18030_RANGE(33513, 0xE83C)
+GB18030_RANGE(33520, 0xE844)
+GB18030_RANGE(33536, 0xE856)
+GB18030_RANGE(33550, 0xE865)
+GB18030_RANGE(37845, 0xF92D)
+GB18030_RANGE(37921, 0xF97A)
+GB18030_RANGE(37948, 0xF996)
+GB18030_RANGE(38029, 0xF9E8)
+GB18030_RANGE(38038, 0xF9F2)
+GB18030_RANGE(38064, 0xFA10)
+GB18030_RANGE(38065, 0xFA12)
+GB18030_RANGE(38066, 0xFA15)
+GB18030_RANGE(38069, 0xFA19)
+GB18030_RANGE(38075, 0xFA22)
+GB18030_RANGE(38076, 0xFA25)
+GB18030_RANGE(38078, 0xFA2A)
+GB18030_RANGE(39108, 0xFE32)
+GB18030_RANGE(39109, 0xFE45)
+GB18030_RANGE(39113, 0xFE53)
+GB18030_RANGE(39114, 0xFE58)
+GB18030_RANGE(39115, 0xFE67)
+GB18030_RANGE(39116, 0xFE6C)
+GB18030_RANGE(39265, 0xFF5F)
+GB18030_RANGE(39394, 0xFFE6)
+
+#undef GB18030_TWO_BYTE_PAIR
+#undef GB18030_RANGE
@@ -3,8 +3,15 @@
 
 #include <Cafe/Encoding/Encode.h>
 #include <Cafe/Encoding/Strings.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iterator>
 
+#if CAFE_ENCODING_GB2312_COMPILED_TABLE
+#include <Cafe/Misc/Export.h>
+#endif
+
 namespace Cafe::Encoding
 {
 	namespace CodePage
@@ -13,30 +20,32 @@ namespace Cafe::Encoding
 		/// @see    https://en.wikipedia.org/wiki/Extended_Unix_Code
 		constexpr CodePageType GB2312 = static_cast<CodePageType>(936);
 
+		namespace Detail
+		{
+			/// @brief  GB2312 到 Unicode 的映射表的大小，index 是编码单元组合减去 0x8140
+			constexpr std::size_t GB2312ToUnicodeMappingSize = 0x7D10;
+
+			/// @brief  Unicode 到 GB2312 的映射表的大小，index 是码点，覆盖整个 BMP
+			constexpr std::size_t UnicodeToGB2312MappingSize = 0x10000;
+
+#if CAFE_ENCODING_GB2312_COMPILED_TABLE
+			// 映射表由 Cafe.Encoding.GB2312 库求值一次，此时映射相关操作不可用于常量求值
+			CAFE_PUBLIC extern const std::array<std::uint16_t, GB2312ToUnicodeMappingSize>
+			    GB2312ToUnicodeMapping;
+			CAFE_PUBLIC extern const std::array<std::uint16_t, UnicodeToGB2312MappingSize>
+			    UnicodeToGB2312Mapping;
+#else
+#include "Impl/GB2312Mapping.h"
+
+			// 使用 inline 变量以保证程序中仅存在一份映射表，但每个包含本文件的编译单元仍会各自求值
+			inline constexpr auto GB2312ToUnicodeMapping = MakeGB2312ToUnicodeMapping();
+			inline constexpr auto UnicodeToGB2312Mapping = MakeUnicodeToGB2312Mapping();
+#endif
+		} // namespace Detail
+
 		template <>
 		struct CodePageTrait<GB2312>
 		{
-		private:
-			// index 是编码单元组合减去 0x8140
-			static constexpr auto GB2312ToUnicodeMapping = []() constexpr
-			{
-				std::array<std::uint16_t, 0x7D10> result{};
-#define GB2312_PAIR(gb2312, unicode) result[gb2312 - 0x8140] = unicode;
-#include "Impl/GB2312Impl.h"
-				return result;
-			}
-			();
-
-			static constexpr auto UnicodeToGB2312Mapping = []() constexpr
-			{
-				std::array<std::uint16_t, 0xFFFF> result{};
-#define GB2312_PAIR(gb2312, unicode) result[unicode] = gb2312;
-#include "Impl/GB2312Impl.h"
-				return result;
-			}
-			();
-
-		public:
 			static constexpr const char Name[] = "GB2312";
 
 			using CharType = char;
@@ -95,8 +104,8 @@ namespace Cafe::Encoding
 					const auto unit = static_cast<std::uint16_t>(firstUnit) << 8 | secondUnit;
 					const auto index = unit - 0x8140;
 
-					if (index >= std::size(GB2312ToUnicodeMapping) ||
-					    !GB2312ToUnicodeMapping[index])
+					if (index >= std::size(Detail::GB2312ToUnicodeMapping) ||
+					    !Detail::GB2312ToUnicodeMapping[index])
 					{
 						std::forward<OutputReceiver>(receiver)(
 						    EncodingResult<GB2312, CodePoint, EncodingResultCode::Reject>{});
@@ -104,7 +113,7 @@ namespace Cafe::Encoding
 					else
 					{
 						const auto result =
-						    static_cast<CodePointType>(GB2312ToUnicodeMapping[index]);
+						    static_cast<CodePointType>(Detail::GB2312ToUnicodeMapping[index]);
 						std::forward<OutputReceiver>(receiver)(
 						    EncodingResult<GB2312, CodePoint, EncodingResultCode::Accept>{ result,
 						                                                                   2u });
@@ -112,6 +121,72 @@ namespace Cafe::Encoding
 				}
 			}
 
+			/// @brief  向前至多检查的编码单元个数，见 ToCodePointBackward
+			static constexpr std::size_t MaxResyncLength = 64;
+
+			/// @brief  转换 span 结尾的字符
+			/// @remark 结果的 AdvanceCount 为从结尾向前消耗的编码单元个数
+			///         后尾编码单元（0x40-0xFE，除 0x7F）的范围与单字节字符及首位编码单元（0x81-0xFE）
+			///         均有重叠，因此需向前找到不可能是首位的编码单元，其后必然是字符边界，再由其后连续的
+			///         可能是首位的编码单元个数的奇偶性决定结尾字符的宽度，span 的开头视为字符边界
+			///         若向前 MaxResyncLength 个编码单元内仍未找到边界，则尽力而为：假定结尾编码单元
+			///         可能是首位时与前一编码单元组成双字节字符，否则为单字节字符，
+			///         这对于 GB2312 范围内的双字节字符（两个编码单元均不小于 0xA1）总是正确的
+			template <std::size_t Extent, typename OutputReceiver>
+			static constexpr void ToCodePointBackward(std::span<const CharType, Extent> const& span,
+			                                          OutputReceiver&& receiver)
+			{
+				const auto size = span.size();
+				if (!size)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB2312, CodePoint, EncodingResultCode::Incomplete>{ 0, 1 });
+					return;
+				}
+
+				const auto lastUnit = static_cast<unsigned char>(span[size - 1]);
+				if (lastUnit == 0xFF)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB2312, CodePoint, EncodingResultCode::Reject>{});
+					return;
+				}
+
+				const auto isLeadUnit = [](unsigned char unit) constexpr {
+					return unit >= 0x81 && unit != 0xFF;
+				};
+
+				auto isDoubleByte = false;
+				if (lastUnit >= 0x40 && lastUnit != 0x7F)
+				{
+					const auto scanLimit = std::min(size - 1, MaxResyncLength);
+					std::size_t leadCount = 0;
+					while (leadCount < scanLimit &&
+					       isLeadUnit(static_cast<unsigned char>(span[size - 2 - leadCount])))
+					{
+						++leadCount;
+					}
+
+					isDoubleByte =
+					    leadCount == MaxResyncLength ? isLeadUnit(lastUnit) : leadCount % 2 != 0;
+				}
+
+				if (isDoubleByte)
+				{
+					ToCodePoint(span.subspan(size - 2), std::forward<OutputReceiver>(receiver));
+				}
+				else if (isLeadUnit(lastUnit))
+				{
+					// 结尾是首位编码单元，缺少后尾编码单元
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<GB2312, CodePoint, EncodingResultCode::Incomplete>{ 0, 1 });
+				}
+				else
+				{
+					ToCodePoint(span.subspan(size - 1), std::forward<OutputReceiver>(receiver));
+				}
+			}
+
 			template <typename OutputReceiver>
 			static constexpr void FromCodePoint(CodePointType codePoint, OutputReceiver&& receiver)
 			{
@@ -138,7 +213,7 @@ namespace Cafe::Encoding
 				}
 				else
 				{
-					const auto mappedUnit = UnicodeToGB2312Mapping[codePoint];
+					const auto mappedUnit = Detail::UnicodeToGB2312Mapping[codePoint];
 					if (!mappedUnit)
 					{
 						std::forward<OutputReceiver>(receiver)(
@@ -0,0 +1,24 @@
+// 生成 GB2312 映射表的函数，需在命名空间 Cafe::Encoding::CodePage::Detail 中包含
+// 仅供 GB2312.h 及映射表的编译单元使用
+
+/// @brief  生成 GB2312 到 Unicode 的映射表
+/// @remark 求值开销较大，除生成映射表外不应使用
+[[nodiscard]] constexpr std::array<std::uint16_t, GB2312ToUnicodeMappingSize>
+MakeGB2312ToUnicodeMapping() noexcept
+{
+	std::array<std::uint16_t, GB2312ToUnicodeMappingSize> result{};
+#define GB2312_PAIR(gb2312, unicode) result[gb2312 - 0x8140] = unicode;
+#include "GB2312Impl.h"
+	return result;
+}
+
+/// @brief  生成 Unicode 到 GB2312 的映射表
+/// @remark 求值开销较大，除生成映射表外不应使用
+[[nodiscard]] constexpr std::array<std::uint16_t, UnicodeToGB2312MappingSize>
+MakeUnicodeToGB2312Mapping() noexcept
+{
+	std::array<std::uint16_t, UnicodeToGB2312MappingSize> result{};
+#define GB2312_PAIR(gb2312, unicode) result[unicode] = gb2312;
+#include "GB2312Impl.h"
+	return result;
+}
@@ -0,0 +1,10 @@
+#include <Cafe/Encoding/CodePage/GB2312.h>
+
+namespace Cafe::Encoding::CodePage::Detail
+{
+#include <Cafe/Encoding/CodePage/Impl/GB2312Mapping.h>
+
+	// 与 UnicodeToGB2312Mapping 分别位于不同的目标文件，仅解码的程序不会链接反向映射表
+	constexpr std::array<std::uint16_t, GB2312ToUnicodeMappingSize> GB2312ToUnicodeMapping =
+	    MakeGB2312ToUnicodeMapping();
+} // namespace Cafe::Encoding::CodePage::Detail
@@ -0,0 +1,9 @@
+#include <Cafe/Encoding/CodePage/GB2312.h>
+
+namespace Cafe::Encoding::CodePage::Detail
+{
+#include <Cafe/Encoding/CodePage/Impl/GB2312Mapping.h>
+
+	constexpr std::array<std::uint16_t, UnicodeToGB2312MappingSize> UnicodeToGB2312Mapping =
+	    MakeUnicodeToGB2312Mapping();
+} // namespace Cafe::Encoding::CodePage::Detail
@@ -0,0 +1,275 @@
+#ifndef CAFE_ENCODING_CODEPAGE_ISO_8859_1_H
+#define CAFE_ENCODING_CODEPAGE_ISO_8859_1_H
+
+#include <Cafe/Encoding/Encode.h>
+#include <Cafe/Encoding/Strings.h>
+#include <bit>
+
+// 以下代码页存在时提供直接转换的编码器，这些代码页的码点与 ISO-8859-1 的编码单元一一对应
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+#include <Cafe/Encoding/CodePage/UTF-16.h>
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-32.h>)
+#include <Cafe/Encoding/CodePage/UTF-32.h>
+#endif
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  ISO/IEC 8859-1，西欧语言
+		/// @remark 编码单元的值即为码点
+		constexpr CodePageType Iso8859_1 = static_cast<CodePageType>(28591);
+
+		template <>
+		struct CodePageTrait<Iso8859_1>
+		{
+			static constexpr const char Name[] = "ISO-8859-1";
+
+			using CharType = char;
+
+			static constexpr bool IsVariableWidth = false;
+
+			template <typename OutputReceiver>
+			static constexpr void ToCodePoint(CharType codeUnit, OutputReceiver&& receiver)
+			{
+				std::forward<OutputReceiver>(receiver)(
+				    EncodingResult<Iso8859_1, CodePoint, EncodingResultCode::Accept>{
+				        static_cast<CodePointType>(static_cast<unsigned char>(codeUnit)) });
+			}
+
+			template <typename OutputReceiver>
+			static constexpr void FromCodePoint(CodePointType codePoint, OutputReceiver&& receiver)
+			{
+				if (codePoint > 0xFF)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<CodePoint, Iso8859_1, EncodingResultCode::Reject>{});
+				}
+				else
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<CodePoint, Iso8859_1, EncodingResultCode::Accept>{
+					        static_cast<CharType>(codePoint) });
+				}
+			}
+		};
+
+		namespace Detail
+		{
+			/// @brief  编码单元可由 ISO-8859-1 编码单元零扩展得到的代码页
+			/// @remark 值为 ISO-8859-1 编码单元在按本机端序读取的编码单元中的位移，考虑了端序交换，
+			///         为 -1 表示不可直接零扩展
+			template <CodePageType CodePageValue>
+			constexpr int Iso8859_1WideningShift = -1;
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+			template <>
+			constexpr int Iso8859_1WideningShift<Utf16LittleEndian> =
+			    std::endian::native == std::endian::little ? 0 : 8;
+
+			template <>
+			constexpr int Iso8859_1WideningShift<Utf16BigEndian> =
+			    std::endian::native == std::endian::big ? 0 : 8;
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-32.h>)
+			template <>
+			constexpr int Iso8859_1WideningShift<Utf32LittleEndian> =
+			    std::endian::native == std::endian::little ? 0 : 24;
+
+			template <>
+			constexpr int Iso8859_1WideningShift<Utf32BigEndian> =
+			    std::endian::native == std::endian::big ? 0 : 24;
+#endif
+
+			/// @brief  将结果传递给接收器
+			/// @return 接收器是否要求终止
+			template <typename OutputReceiver, typename ResultType>
+			constexpr bool EmitIso8859_1Result(OutputReceiver&& receiver, ResultType const& result)
+			{
+				if constexpr (Core::Misc::IsCallableReturningControlFlow<OutputReceiver,
+				                                                          ResultType const&>::value)
+				{
+					return std::forward<OutputReceiver>(receiver)(result).IsBreak();
+				}
+				else
+				{
+					std::forward<OutputReceiver>(receiver)(result);
+					return false;
+				}
+			}
+		} // namespace Detail
+	}     // namespace CodePage
+
+	/// @brief  ISO-8859-1 到 UTF-16 及 UTF-32 的编码器，仅需零扩展
+	template <CodePage::CodePageType ToCodePageValue>
+	requires(CodePage::Detail::Iso8859_1WideningShift<ToCodePageValue> >=
+	         0) struct Encoder<CodePage::Iso8859_1, ToCodePageValue>
+	    : EncoderBase<CodePage::Iso8859_1, ToCodePageValue>
+	{
+		template <std::size_t Extent, typename OutputReceiver>
+		static constexpr void EncodeAll(std::span<const char, Extent> const& span,
+		                                OutputReceiver&& receiver)
+		{
+			using ToCodePageTrait = CodePage::CodePageTrait<ToCodePageValue>;
+			using ToCharType = typename ToCodePageTrait::CharType;
+			using ResultType =
+			    EncodingResult<CodePage::Iso8859_1, ToCodePageValue, EncodingResultCode::Accept>;
+			constexpr auto Shift = CodePage::Detail::Iso8859_1WideningShift<ToCodePageValue>;
+
+			for (const auto codeUnit : span)
+			{
+				const auto result = static_cast<ToCharType>(
+				    static_cast<ToCharType>(static_cast<unsigned char>(codeUnit)) << Shift);
+				const auto shouldBreak = [&] {
+					if constexpr (ToCodePageTrait::IsVariableWidth)
+					{
+						return CodePage::Detail::EmitIso8859_1Result(
+						    receiver, ResultType{ std::span(&result, 1) });
+					}
+					else
+					{
+						return CodePage::Detail::EmitIso8859_1Result(receiver, ResultType{ result });
+					}
+				}();
+				if (shouldBreak)
+				{
+					return;
+				}
+			}
+		}
+	};
+
+	/// @brief  UTF-16 及 UTF-32 到 ISO-8859-1 的编码器
+	/// @remark 码点不大于 0xFF 的编码单元直接截断，否则交由通用实现处理剩余部分，以保持相同的错误结果
+	template <CodePage::CodePageType FromCodePageValue>
+	requires(CodePage::Detail::Iso8859_1WideningShift<FromCodePageValue> >=
+	         0) struct Encoder<FromCodePageValue, CodePage::Iso8859_1>
+	    : EncoderBase<FromCodePageValue, CodePage::Iso8859_1>
+	{
+		using CharType = typename CodePage::CodePageTrait<FromCodePageValue>::CharType;
+
+		template <std::size_t Extent, typename OutputReceiver>
+		static constexpr void EncodeAll(std::span<const CharType, Extent> const& span,
+		                                OutputReceiver&& receiver)
+		{
+			using ResultType =
+			    EncodingResult<FromCodePageValue, CodePage::Iso8859_1, EncodingResultCode::Accept>;
+			constexpr auto Shift = CodePage::Detail::Iso8859_1WideningShift<FromCodePageValue>;
+			constexpr auto Mask = static_cast<CharType>(~(static_cast<CharType>(0xFF) << Shift));
+
+			for (std::size_t i = 0; i < span.size(); ++i)
+			{
+				const auto codeUnit = span[i];
+				if (codeUnit & Mask)
+				{
+					EncoderBase<FromCodePageValue, CodePage::Iso8859_1>::EncodeAll(
+					    span.subspan(i), std::forward<OutputReceiver>(receiver));
+					return;
+				}
+
+				if (CodePage::Detail::EmitIso8859_1Result(
+				        receiver, ResultType{ static_cast<char>(codeUnit >> Shift) }))
+				{
+					return;
+				}
+			}
+		}
+	};
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+	/// @brief  ISO-8859-1 到 UTF-8 的编码器，ASCII 以外的编码单元展开为 2 个 UTF-8 编码单元
+	template <>
+	struct Encoder<CodePage::Iso8859_1, CodePage::Utf8>
+	    : EncoderBase<CodePage::Iso8859_1, CodePage::Utf8>
+	{
+		template <std::size_t Extent, typename OutputReceiver>
+		static constexpr void EncodeAll(std::span<const char, Extent> const& span,
+		                                OutputReceiver&& receiver)
+		{
+			using ToCharType = typename CodePage::CodePageTrait<CodePage::Utf8>::CharType;
+			using ResultType =
+			    EncodingResult<CodePage::Iso8859_1, CodePage::Utf8, EncodingResultCode::Accept>;
+
+			for (const auto codeUnit : span)
+			{
+				const auto value = static_cast<unsigned char>(codeUnit);
+				const auto isAscii = value < 0x80;
+				const ToCharType result[]{
+					static_cast<ToCharType>(isAscii ? value : 0xC0 | value >> 6),
+					static_cast<ToCharType>(0x80 | (value & 0x3F))
+				};
+				if (CodePage::Detail::EmitIso8859_1Result(
+				        receiver, ResultType{ std::span(result, isAscii ? 1 : 2) }))
+				{
+					return;
+				}
+			}
+		}
+	};
+
+	/// @brief  UTF-8 到 ISO-8859-1 的编码器
+	/// @remark 仅处理 ASCII 及以 0xC2、0xC3 开头的 2 字节序列，否则交由通用实现处理剩余部分
+	template <>
+	struct Encoder<CodePage::Utf8, CodePage::Iso8859_1>
+	    : EncoderBase<CodePage::Utf8, CodePage::Iso8859_1>
+	{
+		using CharType = typename CodePage::CodePageTrait<CodePage::Utf8>::CharType;
+
+		template <std::size_t Extent, typename OutputReceiver>
+		static constexpr void EncodeAll(std::span<const CharType, Extent> const& span,
+		                                OutputReceiver&& receiver)
+		{
+			using ResultType =
+			    EncodingResult<CodePage::Utf8, CodePage::Iso8859_1, EncodingResultCode::Accept>;
+
+			std::size_t i = 0;
+			while (i < span.size())
+			{
+				const auto firstUnit = static_cast<unsigned char>(span[i]);
+				if (firstUnit < 0x80)
+				{
+					if (CodePage::Detail::EmitIso8859_1Result(
+					        receiver, ResultType{ static_cast<char>(firstUnit), 1u }))
+					{
+						return;
+					}
+					++i;
+					continue;
+				}
+
+				if ((firstUnit & 0xFE) == 0xC2 && i + 1 < span.size() &&
+				    (static_cast<unsigned char>(span[i + 1]) & 0xC0) == 0x80)
+				{
+					const auto secondUnit = static_cast<unsigned char>(span[i + 1]);
+					if (CodePage::Detail::EmitIso8859_1Result(
+					        receiver,
+					        ResultType{ static_cast<char>((firstUnit & 0x1F) << 6 | (secondUnit & 0x3F)),
+					                    2u }))
+					{
+						return;
+					}
+					i += 2;
+					continue;
+				}
+
+				EncoderBase<CodePage::Utf8, CodePage::Iso8859_1>::EncodeAll(
+				    span.subspan(i), std::forward<OutputReceiver>(receiver));
+				return;
+			}
+		}
+	};
+#endif
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Iso8859_1)
+#endif
@@ -0,0 +1,241 @@
+#include <Cafe/Encoding/BatchTranscode.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	namespace
+	{
+		// 来源的一个字节至多产生的结果字节数，如 ASCII 转码到 UTF-32
+		constexpr std::size_t MaxExpansion = 4;
+		constexpr std::size_t ArenaChunkSize = 1024 * 1024;
+
+		/// @brief  工作线程持有的任务区间，高 32 位为起始下标，低 32 位为结束下标
+		/// @remark 所有者从头部取得任务，窃取者从尾部取走一半，均通过 CAS 修改
+		///         区间的值唯一地表示其中未开始的任务，因此 ABA 不会导致错误
+		class JobRange
+		{
+		public:
+			void Reset(std::uint32_t begin, std::uint32_t end) noexcept
+			{
+				m_Range.store(Pack(begin, end), std::memory_order_release);
+			}
+
+			bool PopFront(std::uint32_t& index) noexcept
+			{
+				auto range = m_Range.load(std::memory_order_acquire);
+				while (true)
+				{
+					const auto [begin, end] = Unpack(range);
+					if (begin >= end)
+					{
+						return false;
+					}
+					if (m_Range.compare_exchange_weak(range, Pack(begin + 1, end),
+					                                  std::memory_order_acq_rel))
+					{
+						index = begin;
+						return true;
+					}
+				}
+			}
+
+			bool StealHalf(std::uint32_t& stolenBegin, std::uint32_t& stolenEnd) noexcept
+			{
+				auto range = m_Range.load(std::memory_order_acquire);
+				while (true)
+				{
+					const auto [begin, end] = Unpack(range);
+					if (begin >= end)
+					{
+						return false;
+					}
+					const auto newEnd = end - (end - begin + 1) / 2;
+					if (m_Range.compare_exchange_weak(range, Pack(begin, newEnd),
+					                                  std::memory_order_acq_rel))
+					{
+						stolenBegin = newEnd;
+						stolenEnd = end;
+						return true;
+					}
+				}
+			}
+
+		private:
+			std::atomic<std::uint64_t> m_Range{};
+
+			static constexpr std::uint64_t Pack(std::uint32_t begin, std::uint32_t end) noexcept
+			{
+				return std::uint64_t{ begin } << 32 | end;
+			}
+
+			static constexpr std::pair<std::uint32_t, std::uint32_t>
+			Unpack(std::uint64_t range) noexcept
+			{
+				return { static_cast<std::uint32_t>(range >> 32), static_cast<std::uint32_t>(range) };
+			}
+		};
+
+		/// @brief  已检查过是否受支持的代码页对
+		/// @remark 同一批次中的任务通常使用少数几种代码页对，缓存最近一次的检查结果以避免
+		///         每个任务都查找由 LoadCodePage 注册的代码页
+		struct ResolvedConverter
+		{
+			CodePage::CodePageType FromCodePage{};
+			CodePage::CodePageType ToCodePage{};
+			bool IsResolved{};
+			bool IsSupported{};
+
+			bool Resolve(CodePage::CodePageType fromCodePage, CodePage::CodePageType toCodePage)
+			{
+				if (!IsResolved || FromCodePage != fromCodePage || ToCodePage != toCodePage)
+				{
+					FromCodePage = fromCodePage;
+					ToCodePage = toCodePage;
+					IsResolved = true;
+					IsSupported =
+					    !GetCodePageName(fromCodePage).empty() && !GetCodePageName(toCodePage).empty();
+				}
+				return IsSupported;
+			}
+		};
+
+		struct alignas(64) Worker
+		{
+			JobRange Range;
+			ResolvedConverter Converter;
+			std::vector<std::byte> Scratch;
+			std::vector<std::unique_ptr<std::byte[]>> Arena;
+			std::byte* ArenaCurrent{};
+			std::size_t ArenaRest{};
+
+			std::byte* Allocate(std::size_t size)
+			{
+				if (size > ArenaRest)
+				{
+					// 较大的结果单独分配，避免浪费当前块的剩余空间
+					if (size > ArenaChunkSize / 4)
+					{
+						return Arena.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size))
+						    .get();
+					}
+					ArenaCurrent =
+					    Arena.emplace_back(std::make_unique_for_overwrite<std::byte[]>(ArenaChunkSize))
+					        .get();
+					ArenaRest = ArenaChunkSize;
+				}
+
+				const auto result = ArenaCurrent;
+				ArenaCurrent += size;
+				ArenaRest -= size;
+				return result;
+			}
+
+			TranscodeJobResult Run(TranscodeJob const& job)
+			{
+				if (!Converter.Resolve(job.FromCodePage, job.ToCodePage))
+				{
+					return { RuntimeEncodingResultCode::Reject, 0, {} };
+				}
+
+				if (job.Src.empty())
+				{
+					return { RuntimeEncodingResultCode::Accept, 0, {} };
+				}
+
+				if (Scratch.size() < job.Src.size() * MaxExpansion)
+				{
+					Scratch.resize(job.Src.size() * MaxExpansion);
+				}
+
+				const auto result =
+				    EncodeAllToSpan(job.FromCodePage, job.Src, job.ToCodePage, Scratch);
+				const auto resultData = Allocate(result.ProduceCount);
+				std::memcpy(resultData, Scratch.data(), result.ProduceCount);
+				return { result.ResultCode, result.ConsumeCount,
+					     std::span<const std::byte>(resultData, result.ProduceCount) };
+			}
+		};
+	} // namespace
+
+	BatchTranscodeResult::BatchTranscodeResult() noexcept = default;
+	BatchTranscodeResult::BatchTranscodeResult(BatchTranscodeResult&& other) noexcept = default;
+	BatchTranscodeResult&
+	BatchTranscodeResult::operator=(BatchTranscodeResult&& other) noexcept = default;
+	BatchTranscodeResult::~BatchTranscodeResult() = default;
+
+	BatchTranscodeResult BatchTranscode(std::span<const TranscodeJob> jobs, std::size_t workerCount)
+	{
+		BatchTranscodeResult batchResult;
+		batchResult.m_Results.resize(jobs.size());
+		if (jobs.empty())
+		{
+			return batchResult;
+		}
+
+		if (!workerCount)
+		{
+			workerCount =
+			    std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t{ 1 });
+		}
+		workerCount = std::min(workerCount, jobs.size());
+
+		std::vector<Worker> workers(workerCount);
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			workers[i].Range.Reset(static_cast<std::uint32_t>(jobs.size() * i / workerCount),
+			                       static_cast<std::uint32_t>(jobs.size() * (i + 1) / workerCount));
+		}
+
+		const auto work = [&](std::size_t workerIndex) {
+			auto& worker = workers[workerIndex];
+			while (true)
+			{
+				std::uint32_t index;
+				while (worker.Range.PopFront(index))
+				{
+					batchResult.m_Results[index] = worker.Run(jobs[index]);
+				}
+
+				// 从下一个工作线程开始依次尝试窃取，所有区间均为空时结束
+				std::uint32_t stolenBegin, stolenEnd;
+				bool isStolen = false;
+				for (std::size_t i = 1; i < workerCount && !isStolen; ++i)
+				{
+					isStolen = workers[(workerIndex + i) % workerCount].Range.StealHalf(stolenBegin,
+					                                                                    stolenEnd);
+				}
+				if (!isStolen)
+				{
+					break;
+				}
+				worker.Range.Reset(stolenBegin, stolenEnd);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(workerCount - 1);
+		for (std::size_t i = 1; i < workerCount; ++i)
+		{
+			threads.emplace_back(work, i);
+		}
+		work(0);
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		for (auto& worker : workers)
+		{
+			std::move(worker.Arena.begin(), worker.Arena.end(),
+			          std::back_inserter(batchResult.m_Arena));
+		}
+
+		return batchResult;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	struct TranscodeJob
+	{
+		CodePage::CodePageType FromCodePage;
+		std::span<const std::byte> Src; ///< @brief 来源数据，需在 BatchTranscode 返回前保持有效
+		CodePage::CodePageType ToCodePage;
+	};
+
+	struct TranscodeJobResult
+	{
+		/// @brief  转码结果，代码页不受支持时为 Reject 且 ConsumeCount 为 0
+		RuntimeEncodingResultCode ResultCode;
+		std::size_t ConsumeCount;         ///< @brief 已转码的来源字节数，转码失败时即为出错的位置
+		std::span<const std::byte> Result; ///< @brief 出错前的结果，由所属的 BatchTranscodeResult 持有
+	};
+
+	/// @brief  批量转码的结果
+	/// @remark 各任务的结果紧密地存放在由本对象持有的若干大块内存中，本对象销毁后结果失效
+	class CAFE_PUBLIC BatchTranscodeResult
+	{
+	public:
+		BatchTranscodeResult() noexcept;
+		BatchTranscodeResult(BatchTranscodeResult&& other) noexcept;
+		BatchTranscodeResult& operator=(BatchTranscodeResult&& other) noexcept;
+		~BatchTranscodeResult();
+
+		/// @brief  获得各任务的结果，顺序与传入的任务相同
+		[[nodiscard]] std::span<const TranscodeJobResult> GetResults() const noexcept
+		{
+			return m_Results;
+		}
+
+		[[nodiscard]] TranscodeJobResult const& operator[](std::size_t index) const noexcept
+		{
+			return m_Results[index];
+		}
+
+		[[nodiscard]] std::size_t GetSize() const noexcept
+		{
+			return m_Results.size();
+		}
+
+	private:
+		friend CAFE_PUBLIC BatchTranscodeResult BatchTranscode(std::span<const TranscodeJob> jobs,
+		                                                       std::size_t workerCount);
+
+		std::vector<TranscodeJobResult> m_Results;
+		std::vector<std::unique_ptr<std::byte[]>> m_Arena;
+	};
+
+	/// @brief  并行转码多个互相独立的任务
+	/// @param  jobs        任务列表，各任务的代码页可以不同，任务数需小于 2^32
+	/// @param  workerCount 工作线程数（包括调用线程），为 0 时使用硬件线程数
+	/// @remark 任务被平均分配给各工作线程，空闲的工作线程会从其他工作线程窃取剩余任务的一半，
+	///         因此任务大小不均匀时仍能充分利用各线程
+	///         每个工作线程持有自己的转码缓冲区及结果内存，转码过程中线程之间不需要加锁
+	CAFE_PUBLIC BatchTranscodeResult BatchTranscode(std::span<const TranscodeJob> jobs,
+	                                                std::size_t workerCount = 0);
+} // namespace Cafe::Encoding::RuntimeEncoding
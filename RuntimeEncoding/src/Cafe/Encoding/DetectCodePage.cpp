@@ -0,0 +1,485 @@
+#include <Cafe/Encoding/DetectCodePage.h>
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	namespace
+	{
+		// 候选代码页未必被包含，因此不使用各代码页头文件中的常量
+		constexpr auto Utf8CodePage = static_cast<CodePage::CodePageType>(65001);
+		constexpr auto Utf16LittleEndianCodePage = static_cast<CodePage::CodePageType>(1200);
+		constexpr auto Utf16BigEndianCodePage = static_cast<CodePage::CodePageType>(1201);
+		constexpr auto Utf32LittleEndianCodePage = static_cast<CodePage::CodePageType>(12000);
+		constexpr auto Utf32BigEndianCodePage = static_cast<CodePage::CodePageType>(12001);
+		constexpr auto GB2312CodePage = static_cast<CodePage::CodePageType>(936);
+		constexpr auto GB18030CodePage = static_cast<CodePage::CodePageType>(54936);
+		constexpr auto Big5CodePage = static_cast<CodePage::CodePageType>(950);
+		constexpr auto ShiftJisCodePage = static_cast<CodePage::CodePageType>(932);
+		constexpr auto EucKrCodePage = static_cast<CodePage::CodePageType>(949);
+		constexpr auto Iso8859_1CodePage = static_cast<CodePage::CodePageType>(28591);
+		constexpr auto Windows1252CodePage = static_cast<CodePage::CodePageType>(1252);
+
+		struct Bom
+		{
+			unsigned char Bytes[4];
+			std::size_t Size;
+			CodePage::CodePageType CodePage;
+		};
+
+		// UTF-32LE 的 BOM 以 UTF-16LE 的 BOM 开头，需要先检查
+		constexpr Bom Boms[]{
+			{ { 0xEF, 0xBB, 0xBF }, 3, Utf8CodePage },
+			{ { 0xFF, 0xFE, 0x00, 0x00 }, 4, Utf32LittleEndianCodePage },
+			{ { 0x00, 0x00, 0xFE, 0xFF }, 4, Utf32BigEndianCodePage },
+			{ { 0xFF, 0xFE }, 2, Utf16LittleEndianCodePage },
+			{ { 0xFE, 0xFF }, 2, Utf16BigEndianCodePage },
+		};
+
+		/// @brief  增量检查 UTF-8 序列的有效性
+		/// @remark 拒绝非最短形式、代理码点及超过 U+10FFFF 的码点，结尾不完整的序列视为被截断而不是无效
+		class Utf8Validator
+		{
+		public:
+			[[nodiscard]] bool IsIdle() const noexcept
+			{
+				return !m_Rest;
+			}
+
+			[[nodiscard]] bool IsValid() const noexcept
+			{
+				return m_IsValid;
+			}
+
+			[[nodiscard]] std::size_t GetSequenceCount() const noexcept
+			{
+				return m_SequenceCount;
+			}
+
+			void Feed(unsigned char value) noexcept
+			{
+				if (m_Rest)
+				{
+					if (value < m_Lower || value > m_Upper)
+					{
+						m_IsValid = false;
+						m_Rest = 0;
+						return;
+					}
+
+					m_Lower = 0x80;
+					m_Upper = 0xBF;
+					if (!--m_Rest)
+					{
+						++m_SequenceCount;
+					}
+					return;
+				}
+
+				if (value < 0x80 || !m_IsValid)
+				{
+					return;
+				}
+
+				if (value < 0xC2 || value > 0xF4)
+				{
+					m_IsValid = false;
+				}
+				else if (value < 0xE0)
+				{
+					m_Rest = 1;
+				}
+				else if (value < 0xF0)
+				{
+					m_Rest = 2;
+					m_Lower = value == 0xE0 ? 0xA0 : 0x80;
+					m_Upper = value == 0xED ? 0x9F : 0xBF;
+				}
+				else
+				{
+					m_Rest = 3;
+					m_Lower = value == 0xF0 ? 0x90 : 0x80;
+					m_Upper = value == 0xF4 ? 0x8F : 0xBF;
+				}
+			}
+
+		private:
+			bool m_IsValid = true;
+			unsigned m_Rest = 0;
+			unsigned char m_Lower = 0x80;
+			unsigned char m_Upper = 0xBF;
+			std::size_t m_SequenceCount = 0;
+		};
+
+		/// @brief  双字节代码页中字节的分类
+		enum DoubleByteClass : std::uint8_t
+		{
+			Lead = 1,            ///< @brief 可作为前导字节
+			Trail = 2,           ///< @brief 可作为后续字节
+			FrequentLead = 4,    ///< @brief 常用字符所在的前导字节
+			DistinctiveLead = 8, ///< @brief 可与结构相似的代码页区分的常用字符所在的前导字节
+			Single = 16,         ///< @brief ASCII 以外的单字节编码单元
+			FourByteSecond = 32, ///< @brief 四字节序列的第二及第四字节
+		};
+
+		using ByteRanges = std::initializer_list<std::pair<unsigned, unsigned>>;
+
+		struct DoubleByteScheme
+		{
+			CodePage::CodePageType CodePage;
+			std::array<std::uint8_t, 256> Classes;
+		};
+
+		[[nodiscard]] constexpr DoubleByteScheme
+		MakeDoubleByteScheme(CodePage::CodePageType codePage, ByteRanges leads, ByteRanges trails,
+		                     ByteRanges frequentLeads, ByteRanges distinctiveLeads = {},
+		                     ByteRanges singles = {}, ByteRanges fourByteSeconds = {}) noexcept
+		{
+			DoubleByteScheme result{ codePage, {} };
+			const auto mark = [&](ByteRanges ranges, std::uint8_t flag) {
+				for (const auto& [first, last] : ranges)
+				{
+					for (auto i = first; i <= last; ++i)
+					{
+						result.Classes[i] |= flag;
+					}
+				}
+			};
+			mark(leads, Lead);
+			mark(trails, Trail);
+			mark(frequentLeads, FrequentLead);
+			mark(distinctiveLeads, DistinctiveLead);
+			mark(singles, Single);
+			mark(fourByteSeconds, FourByteSecond);
+			return result;
+		}
+
+		// 常用字符的范围：GB2312 及 GB18030 为一级汉字（B0-D7），其中 C9-D7 不与 EUC-KR 的谚文重叠；
+		// Big5 为常用汉字（A4-C6）；Shift_JIS 为假名、符号（81-83）及第一水准汉字（88-9F）；
+		// EUC-KR 为谚文（B0-C8），各代码页的标点所在行也视为常用
+		constexpr DoubleByteScheme DoubleByteSchemes[]{
+			MakeDoubleByteScheme(GB2312CodePage, { { 0xA1, 0xF7 } }, { { 0xA1, 0xFE } },
+			                     { { 0xA1, 0xA1 }, { 0xA3, 0xA3 }, { 0xB0, 0xD7 } },
+			                     { { 0xC9, 0xD7 } }),
+			MakeDoubleByteScheme(GB18030CodePage, { { 0x81, 0xFE } },
+			                     { { 0x40, 0x7E }, { 0x80, 0xFE } },
+			                     { { 0xA1, 0xA1 }, { 0xA3, 0xA3 }, { 0xB0, 0xD7 } },
+			                     { { 0xC9, 0xD7 } }, {}, { { 0x30, 0x39 } }),
+			MakeDoubleByteScheme(Big5CodePage, { { 0xA1, 0xF9 } }, { { 0x40, 0x7E }, { 0xA1, 0xFE } },
+			                     { { 0xA1, 0xA1 }, { 0xA4, 0xC6 } }),
+			MakeDoubleByteScheme(ShiftJisCodePage, { { 0x81, 0x9F }, { 0xE0, 0xFC } },
+			                     { { 0x40, 0x7E }, { 0x80, 0xFC } }, { { 0x81, 0x83 }, { 0x88, 0x9F } },
+			                     {}, { { 0xA1, 0xDF } }),
+			MakeDoubleByteScheme(EucKrCodePage, { { 0x81, 0xFE } },
+			                     { { 0x41, 0x5A }, { 0x61, 0x7A }, { 0x81, 0xFE } },
+			                     { { 0xA1, 0xA1 }, { 0xA3, 0xA3 }, { 0xB0, 0xC8 } }),
+		};
+
+		constexpr auto DoubleByteSchemeCount = std::size(DoubleByteSchemes);
+
+		/// @brief  双字节代码页的字节对统计
+		class DoubleByteStatistic
+		{
+		public:
+			[[nodiscard]] bool IsIdle() const noexcept
+			{
+				return m_State == State::ExpectLead;
+			}
+
+			void Feed(DoubleByteScheme const& scheme, unsigned char value) noexcept
+			{
+				const auto classes = scheme.Classes[value];
+				switch (m_State)
+				{
+				case State::ExpectLead:
+					if (value < 0x80)
+					{
+						return;
+					}
+					if (classes & Lead)
+					{
+						m_Lead = value;
+						m_State = State::ExpectTrail;
+					}
+					else if (!(classes & Single))
+					{
+						++m_ErrorCount;
+					}
+					return;
+				case State::ExpectTrail:
+					if (classes & Trail)
+					{
+						const auto leadClasses = scheme.Classes[m_Lead];
+						++m_PairCount;
+						m_FrequentPairCount += (leadClasses & FrequentLead) != 0;
+						m_DistinctivePairCount += (leadClasses & DistinctiveLead) != 0;
+						m_State = State::ExpectLead;
+					}
+					else if (classes & FourByteSecond)
+					{
+						m_State = State::ExpectFourByteThird;
+					}
+					else
+					{
+						++m_ErrorCount;
+						m_State = State::ExpectLead;
+					}
+					return;
+				case State::ExpectFourByteThird:
+					if (classes & Lead)
+					{
+						m_State = State::ExpectFourByteFourth;
+					}
+					else
+					{
+						++m_ErrorCount;
+						m_State = State::ExpectLead;
+					}
+					return;
+				case State::ExpectFourByteFourth:
+					if (classes & FourByteSecond)
+					{
+						++m_PairCount;
+					}
+					else
+					{
+						++m_ErrorCount;
+					}
+					m_State = State::ExpectLead;
+					return;
+				}
+			}
+
+			/// @brief  计算置信度，为 0 表示不可能是此代码页
+			[[nodiscard]] double GetConfidence(DoubleByteScheme const& scheme) const noexcept
+			{
+				if (m_ErrorCount || !m_PairCount)
+				{
+					return 0;
+				}
+
+				auto confidence = 0.4 + 0.5 * static_cast<double>(m_FrequentPairCount) /
+				                            static_cast<double>(m_PairCount);
+				// 有足够样本却几乎不包含可区分的常用字符时，更可能是结构相似的其他代码页
+				const auto hasDistinctiveLead = std::any_of(
+				    scheme.Classes.begin(), scheme.Classes.end(),
+				    [](std::uint8_t classes) { return (classes & DistinctiveLead) != 0; });
+				if (hasDistinctiveLead && m_PairCount >= 8 &&
+				    m_DistinctivePairCount * 20 < m_PairCount)
+				{
+					confidence *= 0.7;
+				}
+				return confidence;
+			}
+
+		private:
+			enum class State
+			{
+				ExpectLead,
+				ExpectTrail,
+				ExpectFourByteThird,
+				ExpectFourByteFourth,
+			};
+
+			State m_State = State::ExpectLead;
+			unsigned char m_Lead = 0;
+			std::size_t m_PairCount = 0;
+			std::size_t m_FrequentPairCount = 0;
+			std::size_t m_DistinctivePairCount = 0;
+			std::size_t m_ErrorCount = 0;
+		};
+
+		constexpr std::uint64_t RepeatByte(std::uint8_t value) noexcept
+		{
+			return 0x0101010101010101ull * value;
+		}
+
+		/// @brief  判断 8 个字节中是否存在最高位为 1 或为 0 的字节
+		constexpr bool HasHighOrZeroByte(std::uint64_t word) noexcept
+		{
+			const auto hasZero = (word - RepeatByte(0x01)) & ~word & RepeatByte(0x80);
+			return ((word & RepeatByte(0x80)) | hasZero) != 0;
+		}
+
+		[[nodiscard]] bool IsSupported(CodePage::CodePageType codePage) noexcept
+		{
+			return !GetCodePageName(codePage).empty();
+		}
+	} // namespace
+
+	std::optional<CodePageCandidate> DetectBom(std::span<const std::byte> src) noexcept
+	{
+		for (const auto& bom : Boms)
+		{
+			if (src.size() >= bom.Size && std::memcmp(src.data(), bom.Bytes, bom.Size) == 0)
+			{
+				return CodePageCandidate{ bom.CodePage, 1.0, bom.Size };
+			}
+		}
+		return {};
+	}
+
+	std::vector<CodePageCandidate> DetectCodePage(std::span<const std::byte> src)
+	{
+		std::vector<CodePageCandidate> result;
+		if (const auto bom = DetectBom(src); bom && IsSupported(bom->CodePage))
+		{
+			result.push_back(*bom);
+			return result;
+		}
+
+		const auto data = reinterpret_cast<const unsigned char*>(src.data());
+		const auto size = src.size();
+
+		Utf8Validator utf8Validator;
+		DoubleByteStatistic doubleByteStatistics[DoubleByteSchemeCount];
+		// 按下标模 4 分类的零字节数
+		std::size_t zeroCounts[4]{};
+		std::size_t highByteCount = 0;
+		// 0xC0 至 0xFF，在拉丁字母的单字节代码页中多为字母
+		std::size_t latinLetterCount = 0;
+		// 0x80 至 0x9F，在 ISO-8859-1 中为 C1 控制字符
+		std::size_t c1ControlCount = 0;
+		bool hasWindows1252Unmapped = false;
+
+		const auto isIdle = [&] {
+			return utf8Validator.IsIdle() &&
+			       std::all_of(std::begin(doubleByteStatistics), std::end(doubleByteStatistics),
+			                   [](DoubleByteStatistic const& statistic) { return statistic.IsIdle(); });
+		};
+
+		std::size_t i = 0;
+		while (i < size)
+		{
+			// 所有状态机均处于初始状态时，以 8 字节为单位跳过不含零字节的 ASCII，不改变任何统计结果
+			if (i + 8 <= size && isIdle())
+			{
+				std::uint64_t word;
+				std::memcpy(&word, data + i, sizeof(word));
+				if (!HasHighOrZeroByte(word))
+				{
+					i += 8;
+					continue;
+				}
+			}
+
+			const auto end = std::min(i + 8, size);
+			for (; i < end; ++i)
+			{
+				const auto value = data[i];
+				if (!value)
+				{
+					++zeroCounts[i % 4];
+				}
+				else if (value >= 0x80)
+				{
+					++highByteCount;
+					latinLetterCount += value >= 0xC0;
+					c1ControlCount += value < 0xA0;
+					hasWindows1252Unmapped |= value == 0x81 || value == 0x8D || value == 0x8F ||
+					                          value == 0x90 || value == 0x9D;
+				}
+
+				utf8Validator.Feed(value);
+				for (std::size_t j = 0; j < DoubleByteSchemeCount; ++j)
+				{
+					doubleByteStatistics[j].Feed(DoubleByteSchemes[j], value);
+				}
+			}
+		}
+
+		const auto zeroCount = zeroCounts[0] + zeroCounts[1] + zeroCounts[2] + zeroCounts[3];
+		if (!highByteCount && !zeroCount)
+		{
+			if (size && IsSupported(Utf8CodePage))
+			{
+				result.push_back({ Utf8CodePage, 1.0, 0 });
+			}
+			return result;
+		}
+
+		const auto addCandidate = [&](CodePage::CodePageType codePage, double confidence) {
+			if (confidence > 0 && IsSupported(codePage))
+			{
+				result.push_back({ codePage, confidence, 0 });
+			}
+		};
+
+		const auto ratio = [](std::size_t count, std::size_t total) {
+			return total ? static_cast<double>(count) / static_cast<double>(total) : 0.0;
+		};
+
+		// 不含 BOM 的 UTF-32 及 UTF-16 依赖零字节的位置判断，对于 BMP 字符，UTF-32 的高 2 字节恒为 0，
+		// 而 UTF-16 中较小的码点的高字节为 0
+		if (size % 4 == 0)
+		{
+			const auto unitCount = size / 4;
+			if (ratio(zeroCounts[2] + zeroCounts[3], unitCount * 2) >= 0.95 &&
+			    ratio(zeroCounts[0], unitCount) < 0.5)
+			{
+				addCandidate(Utf32LittleEndianCodePage, 0.95);
+			}
+			if (ratio(zeroCounts[0] + zeroCounts[1], unitCount * 2) >= 0.95 &&
+			    ratio(zeroCounts[3], unitCount) < 0.5)
+			{
+				addCandidate(Utf32BigEndianCodePage, 0.95);
+			}
+		}
+
+		if (size % 2 == 0)
+		{
+			const auto unitCount = size / 2;
+			const auto evenZeroRatio = ratio(zeroCounts[0] + zeroCounts[2], unitCount);
+			const auto oddZeroRatio = ratio(zeroCounts[1] + zeroCounts[3], unitCount);
+			if (oddZeroRatio >= 0.3 && evenZeroRatio < 0.1)
+			{
+				addCandidate(Utf16LittleEndianCodePage, 0.5 + 0.45 * oddZeroRatio);
+			}
+			if (evenZeroRatio >= 0.3 && oddZeroRatio < 0.1)
+			{
+				addCandidate(Utf16BigEndianCodePage, 0.5 + 0.45 * evenZeroRatio);
+			}
+		}
+
+		// 零字节在文本中罕见，据此降低 ASCII 兼容的代码页的置信度
+		const auto textConfidence = 1.0 - ratio(zeroCount, size);
+
+		// 结尾不完整的序列仅在已有完整的多字节序列时视为被截断，否则如以 0xE9 结尾的 Latin-1 文本中
+		// 唯一的非 ASCII 字节会被当作未完成的 UTF-8 序列
+		if (utf8Validator.IsValid() && (utf8Validator.IsIdle() || utf8Validator.GetSequenceCount()))
+		{
+			addCandidate(Utf8CodePage,
+			             (utf8Validator.GetSequenceCount() ? 0.99 : 0.5) * textConfidence);
+		}
+
+		for (std::size_t j = 0; j < DoubleByteSchemeCount; ++j)
+		{
+			addCandidate(DoubleByteSchemes[j].CodePage,
+			             doubleByteStatistics[j].GetConfidence(DoubleByteSchemes[j]) *
+			                 textConfidence);
+		}
+
+		// 单字节代码页总能解码，仅作为其他代码页均不符合时的后备
+		if (highByteCount)
+		{
+			const auto latinConfidence =
+			    (0.1 + 0.3 * ratio(latinLetterCount, highByteCount)) * textConfidence;
+			if (!hasWindows1252Unmapped)
+			{
+				addCandidate(Windows1252CodePage, latinConfidence);
+			}
+			addCandidate(Iso8859_1CodePage, c1ControlCount ? latinConfidence * 0.5 : latinConfidence);
+		}
+
+		std::stable_sort(result.begin(), result.end(),
+		                 [](CodePageCandidate const& a, CodePageCandidate const& b) {
+			                 return a.Confidence > b.Confidence;
+		                 });
+		return result;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
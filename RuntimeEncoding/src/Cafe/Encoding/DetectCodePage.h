@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Cafe/Encoding/CodePage.h>
+#include <Cafe/Misc/Export.h>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	struct CodePageCandidate
+	{
+		CodePage::CodePageType CodePage;
+		double Confidence;   ///< @brief 置信度，范围为 (0, 1]
+		std::size_t BomSize; ///< @brief 开头的 BOM 的字节数，不存在 BOM 时为 0
+	};
+
+	/// @brief  检测开头的 BOM
+	/// @return 若不存在 UTF-8、UTF-16 或 UTF-32 的 BOM 则返回 std::nullopt，否则置信度为 1
+	/// @remark 不检查对应的代码页是否被包含
+	CAFE_PUBLIC std::optional<CodePageCandidate> DetectBom(std::span<const std::byte> src) noexcept;
+
+	/// @brief  推测未标注代码页的输入所使用的代码页
+	/// @remark 存在 BOM 时仅返回 BOM 对应的代码页，否则仅遍历输入一次，同时进行 UTF-8 有效性检查、
+	///         各双字节代码页的字节对统计及 UTF-16、UTF-32 的零字节分布统计
+	///         仅返回 GetSupportCodePages 中包含的代码页，结果按置信度降序排列
+	///         纯 ASCII 的输入仅返回 UTF-8，无法判断时返回空
+	CAFE_PUBLIC std::vector<CodePageCandidate> DetectCodePage(std::span<const std::byte> src);
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -0,0 +1,158 @@
+#include <Cafe/Encoding/MappedText.h>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+	    : m_Data{ std::exchange(other.m_Data, {}) }
+	{
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			m_Data = std::exchange(other.m_Data, {});
+		}
+		return *this;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(std::filesystem::path const& path,
+	                      MappedFileAccessPattern accessPattern) noexcept
+	{
+		Close();
+
+#ifdef _WIN32
+		const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		                              OPEN_EXISTING,
+		                              accessPattern == MappedFileAccessPattern::Sequential
+		                                  ? FILE_FLAG_SEQUENTIAL_SCAN
+		                                  : FILE_ATTRIBUTE_NORMAL,
+		                              nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart < 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		// 无法映射空文件
+		if (!size.QuadPart)
+		{
+			CloseHandle(file);
+			return true;
+		}
+
+		const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+		{
+			return false;
+		}
+
+		const auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		// 视图会保持映射对象存活
+		CloseHandle(mapping);
+		if (!data)
+		{
+			return false;
+		}
+
+		m_Data = std::span(static_cast<const std::byte*>(data),
+		                   static_cast<std::size_t>(size.QuadPart));
+#else
+		const auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd == -1)
+		{
+			return false;
+		}
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		// 无法映射空文件
+		if (!fileStat.st_size)
+		{
+			close(fd);
+			return true;
+		}
+
+		const auto size = static_cast<std::size_t>(fileStat.st_size);
+		const auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+		// 映射会保持文件存活
+		close(fd);
+		if (data == MAP_FAILED)
+		{
+			return false;
+		}
+
+#ifdef MADV_SEQUENTIAL
+		if (accessPattern == MappedFileAccessPattern::Sequential)
+		{
+			// 仅为提示，失败时无需处理
+			madvise(data, size, MADV_SEQUENTIAL);
+		}
+#endif
+
+		m_Data = std::span(static_cast<const std::byte*>(data), size);
+#endif
+		return true;
+	}
+
+	void MappedFile::Close() noexcept
+	{
+		if (m_Data.empty())
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		UnmapViewOfFile(m_Data.data());
+#else
+		munmap(const_cast<std::byte*>(m_Data.data()), m_Data.size());
+#endif
+		m_Data = {};
+	}
+
+	std::optional<MappedText> MappedText::Open(std::filesystem::path const& path) noexcept
+	{
+		MappedText result;
+		if (!result.m_File.Open(path, MappedFileAccessPattern::Sequential))
+		{
+			return {};
+		}
+
+		result.m_Bom = DetectBom(result.m_File.GetData());
+		return result;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Cafe/Encoding/DetectCodePage.h>
+#include <Cafe/Encoding/Strings.h>
+#include <Cafe/Misc/Export.h>
+#include <filesystem>
+#include <optional>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	/// @brief  映射文件时对访问方式的提示
+	enum class MappedFileAccessPattern
+	{
+		Normal,     ///< @brief 无特殊提示
+		Sequential, ///< @brief 从头到尾顺序访问一次
+	};
+
+	/// @brief  以只读方式映射的整个文件
+	/// @remark 内容仅在访问时才会被读入，并可在进程间共享
+	class CAFE_PUBLIC MappedFile
+	{
+	public:
+		MappedFile() noexcept = default;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+		~MappedFile();
+
+		/// @brief  映射文件，若已映射其他文件则先解除映射
+		/// @remark 空文件可成功映射，其内容为空
+		/// @return 是否成功，失败时不映射任何文件
+		bool Open(std::filesystem::path const& path,
+		          MappedFileAccessPattern accessPattern = MappedFileAccessPattern::Normal) noexcept;
+
+		void Close() noexcept;
+
+		[[nodiscard]] std::span<const std::byte> GetData() const noexcept
+		{
+			return m_Data;
+		}
+
+	private:
+		std::span<const std::byte> m_Data;
+	};
+
+	/// @brief  以只读方式映射的文本文件
+	/// @remark 打开时检测并跳过开头的 BOM，内容不会被复制，可直接用于 EncodeAll 等操作
+	class CAFE_PUBLIC MappedText
+	{
+	public:
+		/// @brief  映射文件并检测 BOM，按顺序访问提示系统
+		/// @return 若无法打开或映射文件则返回 std::nullopt
+		[[nodiscard]] static std::optional<MappedText> Open(std::filesystem::path const& path) noexcept;
+
+		/// @brief  获得包括 BOM 在内的整个文件的内容
+		[[nodiscard]] std::span<const std::byte> GetBytes() const noexcept
+		{
+			return m_File.GetData();
+		}
+
+		/// @brief  获得 BOM 之后的内容
+		[[nodiscard]] std::span<const std::byte> GetContent() const noexcept
+		{
+			return GetBytes().subspan(GetBomSize());
+		}
+
+		/// @brief  获得 BOM 指示的代码页，不存在 BOM 时返回 std::nullopt
+		[[nodiscard]] std::optional<CodePage::CodePageType> GetBomCodePage() const noexcept
+		{
+			if (m_Bom)
+			{
+				return m_Bom->CodePage;
+			}
+			return {};
+		}
+
+		[[nodiscard]] std::size_t GetBomSize() const noexcept
+		{
+			return m_Bom ? m_Bom->BomSize : 0;
+		}
+
+		/// @brief  以指定代码页的字符串视图访问 BOM 之后的内容
+		/// @return 若存在指示其他代码页的 BOM，或内容的大小及对齐不符合代码页的编码单元，
+		///         则返回 std::nullopt
+		/// @remark 不检查内容的有效性，返回的视图在本对象销毁前有效
+		template <CodePage::CodePageType CodePageValue>
+		[[nodiscard]] std::optional<StringView<CodePageValue>> GetView() const noexcept
+		{
+			using CharType = typename CodePage::CodePageTrait<CodePageValue>::CharType;
+
+			if (m_Bom && m_Bom->CodePage != CodePageValue)
+			{
+				return {};
+			}
+
+			const auto content = GetContent();
+			if (content.size() % sizeof(CharType) ||
+			    reinterpret_cast<std::uintptr_t>(content.data()) % alignof(CharType))
+			{
+				return {};
+			}
+
+			return StringView<CodePageValue>{ std::span(
+				reinterpret_cast<const CharType*>(content.data()), content.size() / sizeof(CharType)) };
+		}
+
+	private:
+		MappedFile m_File;
+		std::optional<CodePageCandidate> m_Bom;
+	};
+} // namespace Cafe::Encoding::RuntimeEncoding
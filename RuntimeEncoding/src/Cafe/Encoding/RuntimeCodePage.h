@@ -0,0 +1,347 @@
+#pragma once
+
+#include <Cafe/Encoding/Encode.h>
+#include <Cafe/Misc/Export.h>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	/// @brief  运行时加载的代码页映射表格式
+	/// @remark 所有整数均为小端序，布局如下（偏移以字节计）：
+	///         0    Magic[8]        "CafeCPT\0"
+	///         8    Version         uint32，当前为 1
+	///         12   CodePage        uint32，注册的代码页值
+	///         16   Name[32]        UTF-8 名称，以 0 填充，至少包含一个 0
+	///         48   MaxWidth        uint32，1 或 2
+	///         52   RowCount        uint32，正向映射表的行数，包括保留的第 0 行
+	///         56   PageCount       uint32，反向映射表的页数，包括保留的第 0 页
+	///         60   Reserved        uint32，为 0
+	///         64   SingleByte      uint16[256]，单字节编码单元的码点，0xFFFF 表示未映射
+	///         576  LeadIndex       uint8[256]，前导字节对应的行号，0 表示不是前导字节
+	///         832  Rows            uint16[RowCount][256]，index 是后续字节，0 表示未映射
+	///         ...  PageIndex       uint8[256]，码点高 8 位对应的页号
+	///         ...  Pages           uint16[PageCount][256]，index 是码点低 8 位，值小于 0x100
+	///                              时为单字节编码，否则高 8 位为前导字节，0 仅可表示 U+0000
+	///         与 DoubleByte 模块使用相同的两级表，单字节代码页的 RowCount 为 1 且 LeadIndex 全为 0
+	namespace RuntimeCodePageFormat
+	{
+		constexpr char Magic[8]{ 'C', 'a', 'f', 'e', 'C', 'P', 'T', '\0' };
+		constexpr std::uint32_t Version = 1;
+		constexpr std::size_t NameSize = 32;
+		constexpr std::size_t HeaderSize = 64;
+		constexpr std::size_t SingleByteOffset = HeaderSize;
+		constexpr std::size_t LeadIndexOffset = SingleByteOffset + 256 * 2;
+		constexpr std::size_t RowsOffset = LeadIndexOffset + 256;
+		constexpr std::size_t TableSize = 256 * 2;
+		constexpr char16_t Unmapped = 0xFFFF;
+
+		[[nodiscard]] constexpr std::size_t GetPageIndexOffset(std::size_t rowCount) noexcept
+		{
+			return RowsOffset + rowCount * TableSize;
+		}
+
+		[[nodiscard]] constexpr std::size_t GetPagesOffset(std::size_t rowCount) noexcept
+		{
+			return GetPageIndexOffset(rowCount) + 256;
+		}
+
+		[[nodiscard]] constexpr std::size_t GetFileSize(std::size_t rowCount,
+		                                                std::size_t pageCount) noexcept
+		{
+			return GetPagesOffset(rowCount) + pageCount * TableSize;
+		}
+	} // namespace RuntimeCodePageFormat
+
+	/// @brief  运行时加载的代码页映射表的视图
+	/// @remark 不持有映射表的内存，仅能通过 FromBytes 验证后创建
+	class RuntimeCodePageTable
+	{
+	public:
+		struct ToCodePointResult
+		{
+			EncodingResultCode ResultCode;
+			CodePointType CodePoint;
+			std::size_t AdvanceCount;
+		};
+
+		/// @brief  验证并创建映射表的视图
+		/// @return 若格式不正确则返回 std::nullopt
+		[[nodiscard]] static std::optional<RuntimeCodePageTable>
+		FromBytes(std::span<const std::byte> bytes) noexcept
+		{
+			using namespace RuntimeCodePageFormat;
+
+			if (bytes.size() < HeaderSize ||
+			    std::memcmp(bytes.data(), Magic, sizeof(Magic)) != 0 ||
+			    ReadUInt32(bytes.data() + 8) != Version)
+			{
+				return {};
+			}
+
+			const auto codePage = ReadUInt32(bytes.data() + 12);
+			const auto maxWidth = ReadUInt32(bytes.data() + 48);
+			const auto rowCount = ReadUInt32(bytes.data() + 52);
+			const auto pageCount = ReadUInt32(bytes.data() + 56);
+			if (codePage == 0 || codePage > 0xFFFF || (maxWidth != 1 && maxWidth != 2) ||
+			    rowCount == 0 || rowCount > 256 || pageCount == 0 || pageCount > 256 ||
+			    bytes.size() != GetFileSize(rowCount, pageCount) ||
+			    std::memchr(bytes.data() + 16, 0, NameSize) == nullptr)
+			{
+				return {};
+			}
+
+			RuntimeCodePageTable table{ bytes, rowCount };
+			for (std::size_t i = 0; i < 256; ++i)
+			{
+				const auto row = table.GetLeadIndex(i);
+				const auto page = std::to_integer<std::size_t>(table.m_PageIndex[i]);
+				if (row >= rowCount || (maxWidth == 1 && row) || page >= pageCount)
+				{
+					return {};
+				}
+			}
+
+			return table;
+		}
+
+		[[nodiscard]] CodePage::CodePageType GetCodePage() const noexcept
+		{
+			return static_cast<CodePage::CodePageType>(ReadUInt32(m_Bytes.data() + 12));
+		}
+
+		[[nodiscard]] std::string_view GetName() const noexcept
+		{
+			return reinterpret_cast<const char*>(m_Bytes.data() + 16);
+		}
+
+		[[nodiscard]] std::size_t GetMaxWidth() const noexcept
+		{
+			return ReadUInt32(m_Bytes.data() + 48);
+		}
+
+		[[nodiscard]] ToCodePointResult ToCodePoint(std::span<const std::byte> src) const noexcept
+		{
+			if (src.empty())
+			{
+				return { EncodingResultCode::Incomplete, 0, 0 };
+			}
+
+			const auto firstUnit = std::to_integer<std::size_t>(src[0]);
+			const auto row = GetLeadIndex(firstUnit);
+			if (!row)
+			{
+				const auto result = ReadUInt16(m_SingleByte + firstUnit * 2);
+				if (result == RuntimeCodePageFormat::Unmapped)
+				{
+					return { EncodingResultCode::Reject, 0, 0 };
+				}
+				return { EncodingResultCode::Accept, result, 1 };
+			}
+
+			if (src.size() < 2)
+			{
+				return { EncodingResultCode::Incomplete, 0, 0 };
+			}
+
+			const auto result = ReadUInt16(m_Rows + row * RuntimeCodePageFormat::TableSize +
+			                               std::to_integer<std::size_t>(src[1]) * 2);
+			if (!result)
+			{
+				return { EncodingResultCode::Reject, 0, 0 };
+			}
+			return { EncodingResultCode::Accept, result, 2 };
+		}
+
+		/// @brief  将码点编码到 buffer
+		/// @return 编码的字节数，为 0 表示无法编码
+		[[nodiscard]] std::size_t FromCodePoint(CodePointType codePoint,
+		                                        std::byte (&buffer)[2]) const noexcept
+		{
+			if (codePoint > 0xFFFF)
+			{
+				return 0;
+			}
+
+			const auto page = std::to_integer<std::size_t>(m_PageIndex[codePoint >> 8]);
+			const auto mappedUnit = ReadUInt16(m_Pages + page * RuntimeCodePageFormat::TableSize +
+			                                   (codePoint & 0xFF) * 2);
+			if (!mappedUnit && codePoint)
+			{
+				return 0;
+			}
+
+			if (mappedUnit <= 0xFF)
+			{
+				buffer[0] = static_cast<std::byte>(mappedUnit);
+				return 1;
+			}
+
+			buffer[0] = static_cast<std::byte>(mappedUnit >> 8);
+			buffer[1] = static_cast<std::byte>(mappedUnit & 0xFF);
+			return 2;
+		}
+
+	private:
+		std::span<const std::byte> m_Bytes;
+		const std::byte* m_SingleByte;
+		const std::byte* m_LeadIndex;
+		const std::byte* m_Rows;
+		const std::byte* m_PageIndex;
+		const std::byte* m_Pages;
+
+		RuntimeCodePageTable(std::span<const std::byte> bytes, std::size_t rowCount) noexcept
+		    : m_Bytes{ bytes }, m_SingleByte{ bytes.data() +
+			                                  RuntimeCodePageFormat::SingleByteOffset },
+		      m_LeadIndex{ bytes.data() + RuntimeCodePageFormat::LeadIndexOffset },
+		      m_Rows{ bytes.data() + RuntimeCodePageFormat::RowsOffset },
+		      m_PageIndex{ bytes.data() + RuntimeCodePageFormat::GetPageIndexOffset(rowCount) },
+		      m_Pages{ bytes.data() + RuntimeCodePageFormat::GetPagesOffset(rowCount) }
+		{
+		}
+
+		[[nodiscard]] std::size_t GetLeadIndex(std::size_t unit) const noexcept
+		{
+			return std::to_integer<std::size_t>(m_LeadIndex[unit]);
+		}
+
+		[[nodiscard]] static std::uint16_t ReadUInt16(const std::byte* ptr) noexcept
+		{
+			return static_cast<std::uint16_t>(std::to_integer<unsigned>(ptr[0]) |
+			                                  std::to_integer<unsigned>(ptr[1]) << 8);
+		}
+
+		[[nodiscard]] static std::uint32_t ReadUInt32(const std::byte* ptr) noexcept
+		{
+			return ReadUInt16(ptr) | static_cast<std::uint32_t>(ReadUInt16(ptr + 2)) << 16;
+		}
+	};
+
+	/// @brief  由映射项生成运行时加载的代码页映射表
+	/// @param  pairs   映射项，first 小于 0x100 时为单字节编码，否则高 8 位为前导字节；
+	///                 同一码点存在多个映射项时，编码时使用最先出现的映射项
+	/// @return 若参数无效则返回空
+	[[nodiscard]] inline std::vector<std::byte>
+	BuildRuntimeCodePageTable(CodePage::CodePageType codePage, std::string_view name,
+	                          std::span<const std::pair<std::uint16_t, char16_t>> pairs)
+	{
+		using namespace RuntimeCodePageFormat;
+
+		if (codePage == CodePage::CodePoint || name.size() >= NameSize)
+		{
+			return {};
+		}
+
+		std::array<std::uint8_t, 256> leadIndex{}, pageIndex{};
+		std::size_t rowCount = 1, pageCount = 1;
+		std::uint32_t maxWidth = 1;
+		for (const auto& [code, codePoint] : pairs)
+		{
+			if (code > 0xFF)
+			{
+				maxWidth = 2;
+				if (!leadIndex[code >> 8])
+				{
+					leadIndex[code >> 8] = static_cast<std::uint8_t>(rowCount++);
+				}
+			}
+			else if (codePoint == Unmapped)
+			{
+				return {};
+			}
+
+			if (!pageIndex[codePoint >> 8])
+			{
+				pageIndex[codePoint >> 8] = static_cast<std::uint8_t>(pageCount++);
+			}
+		}
+
+		if (rowCount > 256 || pageCount > 256)
+		{
+			return {};
+		}
+
+		std::vector<std::byte> result(GetFileSize(rowCount, pageCount));
+		const auto writeUInt16 = [&](std::size_t offset, std::uint16_t value) {
+			result[offset] = static_cast<std::byte>(value & 0xFF);
+			result[offset + 1] = static_cast<std::byte>(value >> 8);
+		};
+		const auto writeUInt32 = [&](std::size_t offset, std::uint32_t value) {
+			writeUInt16(offset, static_cast<std::uint16_t>(value & 0xFFFF));
+			writeUInt16(offset + 2, static_cast<std::uint16_t>(value >> 16));
+		};
+
+		std::memcpy(result.data(), Magic, sizeof(Magic));
+		writeUInt32(8, Version);
+		writeUInt32(12, static_cast<std::uint32_t>(codePage));
+		std::memcpy(result.data() + 16, name.data(), name.size());
+		writeUInt32(48, maxWidth);
+		writeUInt32(52, static_cast<std::uint32_t>(rowCount));
+		writeUInt32(56, static_cast<std::uint32_t>(pageCount));
+
+		for (std::size_t i = 0; i < 256; ++i)
+		{
+			writeUInt16(SingleByteOffset + i * 2, Unmapped);
+			result[LeadIndexOffset + i] = static_cast<std::byte>(leadIndex[i]);
+			result[GetPageIndexOffset(rowCount) + i] = static_cast<std::byte>(pageIndex[i]);
+		}
+
+		std::vector<bool> mapped(0x10000);
+		for (const auto& [code, codePoint] : pairs)
+		{
+			if (code > 0xFF)
+			{
+				writeUInt16(RowsOffset + leadIndex[code >> 8] * TableSize + (code & 0xFF) * 2,
+				            codePoint);
+			}
+			else
+			{
+				writeUInt16(SingleByteOffset + code * 2, codePoint);
+			}
+
+			if (!mapped[codePoint])
+			{
+				mapped[codePoint] = true;
+				writeUInt16(GetPagesOffset(rowCount) + pageIndex[codePoint >> 8] * TableSize +
+				                (codePoint & 0xFF) * 2,
+				            code);
+			}
+		}
+
+		return result;
+	}
+
+	enum class LoadCodePageResultCode
+	{
+		Succeed,        ///< @brief 加载成功
+		CannotOpenFile, ///< @brief 无法打开或映射文件
+		InvalidFormat,  ///< @brief 文件格式不正确
+		AlreadyExists,  ///< @brief 已存在相同值的代码页
+	};
+
+	struct LoadCodePageResult
+	{
+		LoadCodePageResultCode ResultCode;
+		CodePage::CodePageType CodePage; ///< @brief 加载成功时为注册的代码页
+	};
+
+	/// @brief  以只读方式映射文件并注册其中的代码页
+	/// @remark 映射表的内容仅在使用时才会被读入，并可在进程间共享
+	///         注册后 GetSupportCodePages、GetCodePageName、EncodeAll 等函数均可使用此代码页
+	CAFE_PUBLIC LoadCodePageResult LoadCodePage(std::filesystem::path const& path);
+
+	/// @brief  注销由 LoadCodePage 注册的代码页并解除映射
+	/// @remark 调用者需保证没有正在使用此代码页的操作
+	/// @return 是否存在此代码页
+	CAFE_PUBLIC bool UnloadCodePage(CodePage::CodePageType codePage) noexcept;
+
+	/// @brief  查找由 LoadCodePage 注册的代码页
+	/// @return 若不存在则返回 nullptr，返回的指针在代码页注销前有效
+	CAFE_PUBLIC const RuntimeCodePageTable*
+	FindLoadedCodePage(CodePage::CodePageType codePage) noexcept;
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -1,11 +1,120 @@
+#include <Cafe/Encoding/MappedText.h>
 #include <Cafe/Encoding/RuntimeEncoding.h>
 #include <Cafe/Misc/Utility.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Cafe::Encoding::RuntimeEncoding
 {
-	std::span<const Cafe::Encoding::CodePage::CodePageType> GetSupportCodePages() noexcept
+	namespace
 	{
-		return std::span(Cafe::Core::Misc::SequenceToArray<AllIncludedCodePages>::Array);
+		struct LoadedCodePage
+		{
+			MappedFile File;
+			std::optional<RuntimeCodePageTable> Table;
+		};
+
+		/// @brief  运行时加载的代码页的注册表
+		struct LoadedCodePageRegistry
+		{
+			std::shared_mutex Mutex;
+			std::unordered_map<CodePage::CodePageType, std::unique_ptr<LoadedCodePage>> CodePages;
+			/// @brief  编译时包含的代码页及运行时加载的代码页
+			std::vector<CodePage::CodePageType> SupportCodePages{
+				std::begin(Core::Misc::SequenceToArray<AllIncludedCodePages>::Array),
+				std::end(Core::Misc::SequenceToArray<AllIncludedCodePages>::Array)
+			};
+		};
+
+		LoadedCodePageRegistry& GetRegistry() noexcept
+		{
+			static LoadedCodePageRegistry registry;
+			return registry;
+		}
+
+		constexpr bool IsIncludedCodePage(CodePage::CodePageType codePage) noexcept
+		{
+			switch (codePage)
+			{
+#define CAFE_CODEPAGE(codePageValue)                                                               \
+	case codePageValue:                                                                            \
+		return true;
+#include <Cafe/Encoding/Config/IncludedEncoding.h>
+			default:
+				return false;
+			}
+		}
+	} // namespace
+
+	LoadCodePageResult LoadCodePage(std::filesystem::path const& path)
+	{
+		auto loadedCodePage = std::make_unique<LoadedCodePage>();
+		if (!loadedCodePage->File.Open(path))
+		{
+			return { LoadCodePageResultCode::CannotOpenFile, {} };
+		}
+
+		loadedCodePage->Table = RuntimeCodePageTable::FromBytes(loadedCodePage->File.GetData());
+		if (!loadedCodePage->Table)
+		{
+			return { LoadCodePageResultCode::InvalidFormat, {} };
+		}
+
+		const auto codePage = loadedCodePage->Table->GetCodePage();
+		if (IsIncludedCodePage(codePage))
+		{
+			return { LoadCodePageResultCode::AlreadyExists, codePage };
+		}
+
+		auto& registry = GetRegistry();
+		std::unique_lock lock{ registry.Mutex };
+		if (!registry.CodePages.try_emplace(codePage, std::move(loadedCodePage)).second)
+		{
+			return { LoadCodePageResultCode::AlreadyExists, codePage };
+		}
+		registry.SupportCodePages.push_back(codePage);
+
+		return { LoadCodePageResultCode::Succeed, codePage };
+	}
+
+	bool UnloadCodePage(CodePage::CodePageType codePage) noexcept
+	{
+		auto& registry = GetRegistry();
+		std::unique_ptr<LoadedCodePage> loadedCodePage;
+		{
+			std::unique_lock lock{ registry.Mutex };
+			const auto iter = registry.CodePages.find(codePage);
+			if (iter == registry.CodePages.end())
+			{
+				return false;
+			}
+
+			loadedCodePage = std::move(iter->second);
+			registry.CodePages.erase(iter);
+			registry.SupportCodePages.erase(std::find(registry.SupportCodePages.begin(),
+			                                          registry.SupportCodePages.end(), codePage));
+		}
+		// 在锁外解除映射
+		return true;
+	}
+
+	const RuntimeCodePageTable* FindLoadedCodePage(CodePage::CodePageType codePage) noexcept
+	{
+		auto& registry = GetRegistry();
+		std::shared_lock lock{ registry.Mutex };
+		const auto iter = registry.CodePages.find(codePage);
+		return iter == registry.CodePages.end() ? nullptr : &*iter->second->Table;
+	}
+
+	std::vector<CodePage::CodePageType> GetSupportCodePages()
+	{
+		auto& registry = GetRegistry();
+		// 在锁内复制，其他线程可能同时加载或卸载代码页
+		std::shared_lock lock{ registry.Mutex };
+		return registry.SupportCodePages;
 	}
 
 	std::string_view GetCodePageName(CodePage::CodePageType codePage) noexcept
@@ -17,6 +126,10 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return CodePage::CodePageTrait<codePageValue>::Name;
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 		default:
+			if (const auto table = FindLoadedCodePage(codePage))
+			{
+				return table->GetName();
+			}
 			return {};
 		}
 	}
@@ -30,6 +143,10 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return CodePage::CodePageTrait<codePageValue>::IsVariableWidth;
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 		default:
+			if (const auto table = FindLoadedCodePage(codePage))
+			{
+				return table->GetMaxWidth() > 1;
+			}
 			return {};
 		}
 	}
@@ -43,6 +160,10 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return CodePage::GetMaxWidth<codePageValue>();
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 		default:
+			if (const auto table = FindLoadedCodePage(codePage))
+			{
+				return table->GetMaxWidth();
+			}
 			return {};
 		}
 	}
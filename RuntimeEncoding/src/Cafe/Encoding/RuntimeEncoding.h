@@ -2,8 +2,11 @@
 
 #include <Cafe/Encoding/Config/IncludedEncoding.h> // 提前包含以阻止错误引入声明
 #include <Cafe/Encoding/Encode.h>
+#include <Cafe/Encoding/RuntimeCodePage.h>
 #include <Cafe/Misc/Export.h>
+#include <algorithm>
 #include <cstring>
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <vector>
@@ -15,7 +18,9 @@ namespace Cafe::Encoding::RuntimeEncoding
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 	                                                   >;
 
-	CAFE_PUBLIC std::span<const CodePage::CodePageType> GetSupportCodePages() noexcept;
+	/// @brief  获取支持的代码页，包括由 LoadCodePage 注册的代码页
+	/// @remark 返回调用时的副本，不受之后的 LoadCodePage 或 UnloadCodePage 影响
+	CAFE_PUBLIC std::vector<CodePage::CodePageType> GetSupportCodePages();
 
 	CAFE_PUBLIC std::string_view GetCodePageName(CodePage::CodePageType codePage) noexcept;
 	CAFE_PUBLIC std::optional<bool>
@@ -47,9 +52,9 @@ namespace Cafe::Encoding::RuntimeEncoding
 			{
 				if constexpr (!IsEncodeOne || FromCodePageTrait::IsVariableWidth)
 				{
-					std::size_t dummy;
+					auto space = src.size();
 					void* dummyPtr = const_cast<std::byte*>(src.data());
-					if (std::align(alignof(FromCharType), src.size(), dummyPtr, dummy) ==
+					if (std::align(alignof(FromCharType), src.size(), dummyPtr, space) ==
 					    src.data())
 					{
 						return std::span(reinterpret_cast<const FromCharType*>(src.data()),
@@ -67,7 +72,8 @@ namespace Cafe::Encoding::RuntimeEncoding
 							}
 						}
 						mayBeDynamicAllocatedBuffer = std::make_unique<FromCharType[]>(size);
-						std::memcpy(mayBeDynamicAllocatedBuffer.get(), src.data(), src.size());
+						std::memcpy(mayBeDynamicAllocatedBuffer.get(), src.data(),
+						            std::min(src.size(), size * sizeof(FromCharType)));
 						return std::span(&std::as_const(*mayBeDynamicAllocatedBuffer.get()), size);
 					}
 				}
@@ -94,13 +100,13 @@ namespace Cafe::Encoding::RuntimeEncoding
 					{
 						resultSpan = std::span(&result.Result, 1);
 					}
-					std::forward<OutputReceiver>(receiver)(
+					return std::forward<OutputReceiver>(receiver)(
 					    RuntimeEncodingResult<CharType>{ resultSpan, EncodingResultCode::Accept,
 					                                     advanceCount * sizeof(FromCharType) });
 				}
 				else
 				{
-					std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<CharType>{
+					return std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<CharType>{
 					    {}, GetEncodingResultCode<decltype(result)>, 0 });
 				}
 			};
@@ -115,6 +121,66 @@ namespace Cafe::Encoding::RuntimeEncoding
 			}
 		}
 
+		/// @brief  从运行时加载的代码页编码
+		template <bool IsEncodeOne, typename OutputReceiver>
+		static void EncodeFromLoadedImpl(RuntimeCodePageTable const& table,
+		                                 std::span<const std::byte> src, OutputReceiver&& receiver)
+		{
+			using ResultType = RuntimeEncodingResult<CharType>;
+			while (!src.empty())
+			{
+				const auto decoded = table.ToCodePoint(src);
+				if (decoded.ResultCode != EncodingResultCode::Accept)
+				{
+					std::forward<OutputReceiver>(receiver)(ResultType{ {}, decoded.ResultCode, 0 });
+					return;
+				}
+
+				bool shouldContinue = false;
+				Encoder<CodePage::CodePoint, CodePageValue>::Encode(
+				    decoded.CodePoint, [&](auto const& result) {
+					    if constexpr (GetEncodingResultCode<decltype(result)> ==
+					                  EncodingResultCode::Accept)
+					    {
+						    std::span<const CharType> resultSpan;
+						    if constexpr (UsingCodePageTrait::IsVariableWidth)
+						    {
+							    resultSpan = result.Result;
+						    }
+						    else
+						    {
+							    resultSpan = std::span(&result.Result, 1);
+						    }
+
+						    const ResultType runtimeResult{ resultSpan, EncodingResultCode::Accept,
+							                                decoded.AdvanceCount };
+						    if constexpr (Core::Misc::IsCallableReturningControlFlow<
+						                      OutputReceiver, ResultType const&>::value)
+						    {
+							    shouldContinue =
+							        !std::forward<OutputReceiver>(receiver)(runtimeResult).IsBreak();
+						    }
+						    else
+						    {
+							    std::forward<OutputReceiver>(receiver)(runtimeResult);
+							    shouldContinue = true;
+						    }
+					    }
+					    else
+					    {
+						    std::forward<OutputReceiver>(receiver)(
+						        ResultType{ {}, GetEncodingResultCode<decltype(result)>, 0 });
+					    }
+				    });
+
+				if (IsEncodeOne || !shouldContinue)
+				{
+					return;
+				}
+				src = src.subspan(decoded.AdvanceCount);
+			}
+		}
+
 	public:
 		template <typename OutputReceiver>
 		static void EncodeOneFrom(CodePage::CodePageType fromCodePage,
@@ -132,6 +198,11 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return EncodeFromImpl<true, codePageValue>(src, std::forward<OutputReceiver>(receiver));
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 			default:
+				if (const auto table = FindLoadedCodePage(fromCodePage))
+				{
+					return EncodeFromLoadedImpl<true>(*table, src,
+					                                  std::forward<OutputReceiver>(receiver));
+				}
 				assert(!"Invalid code page.");
 				return;
 			}
@@ -153,6 +224,11 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return EncodeFromImpl<false, codePageValue>(src, std::forward<OutputReceiver>(receiver));
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 			default:
+				if (const auto table = FindLoadedCodePage(fromCodePage))
+				{
+					return EncodeFromLoadedImpl<false>(*table, src,
+					                                  std::forward<OutputReceiver>(receiver));
+				}
 				assert(!"Invalid code page.");
 				return;
 			}
@@ -193,12 +269,12 @@ namespace Cafe::Encoding::RuntimeEncoding
 						resultSpan = std::as_bytes(std::span(&result.Result, 1));
 					}
 
-					std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{
+					return std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{
 					    resultSpan, EncodingResultCode::Accept, advanceCount });
 				}
 				else
 				{
-					std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{
+					return std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{
 					    {}, GetEncodingResultCode<decltype(result)>, 0 });
 				}
 			};
@@ -213,6 +289,69 @@ namespace Cafe::Encoding::RuntimeEncoding
 			}
 		}
 
+		/// @brief  编码到运行时加载的代码页
+		template <bool IsEncodeOne, typename OutputReceiver>
+		static void EncodeToLoadedImpl(RuntimeCodePageTable const& table,
+		                               std::span<const CharType> const& src,
+		                               OutputReceiver&& receiver)
+		{
+			using ResultType = RuntimeEncodingResult<std::byte>;
+
+			const auto innerReceiver =
+			    [&](auto const& result) -> Core::Misc::ControlFlowVariant<> {
+				if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+				{
+					std::byte buffer[2];
+					const auto size = table.FromCodePoint(result.Result, buffer);
+					if (!size)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    ResultType{ {}, EncodingResultCode::Reject, 0 });
+						return Core::Misc::BreakType{};
+					}
+
+					const ResultType runtimeResult{ std::span<const std::byte>(buffer, size),
+						                            EncodingResultCode::Accept,
+						                            result.AdvanceCount };
+					if constexpr (Core::Misc::IsCallableReturningControlFlow<
+					                  OutputReceiver, ResultType const&>::value)
+					{
+						if (std::forward<OutputReceiver>(receiver)(runtimeResult).IsBreak())
+						{
+							return Core::Misc::BreakType{};
+						}
+					}
+					else
+					{
+						std::forward<OutputReceiver>(receiver)(runtimeResult);
+					}
+					return Core::Misc::ContinueType{};
+				}
+				else
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    ResultType{ {}, GetEncodingResultCode<decltype(result)>, 0 });
+					return Core::Misc::BreakType{};
+				}
+			};
+
+			if constexpr (IsEncodeOne)
+			{
+				if constexpr (UsingCodePageTrait::IsVariableWidth)
+				{
+					Encoder<CodePageValue, CodePage::CodePoint>::Encode(src, innerReceiver);
+				}
+				else
+				{
+					Encoder<CodePageValue, CodePage::CodePoint>::Encode(src.front(), innerReceiver);
+				}
+			}
+			else
+			{
+				Encoder<CodePageValue, CodePage::CodePoint>::EncodeAll(src, innerReceiver);
+			}
+		}
+
 	public:
 		template <typename OutputReceiver>
 		static void EncodeOneTo(std::span<const CharType> const& src,
@@ -230,6 +369,11 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return EncodeToImpl<true, codePageValue>(src, std::forward<OutputReceiver>(receiver));
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 			default:
+				if (const auto table = FindLoadedCodePage(toCodePage))
+				{
+					return EncodeToLoadedImpl<true>(*table, src,
+					                                  std::forward<OutputReceiver>(receiver));
+				}
 				assert(!"Invalid code page.");
 				return;
 			}
@@ -251,12 +395,55 @@ namespace Cafe::Encoding::RuntimeEncoding
 		return EncodeToImpl<false, codePageValue>(src, std::forward<OutputReceiver>(receiver));
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 			default:
+				if (const auto table = FindLoadedCodePage(toCodePage))
+				{
+					return EncodeToLoadedImpl<false>(*table, src,
+					                                  std::forward<OutputReceiver>(receiver));
+				}
 				assert(!"Invalid code page.");
 				return;
 			}
 		}
 	};
 
+	namespace Detail
+	{
+		/// @brief  将解码得到的码点编码到运行时加载的代码页并传递给接收器
+		template <typename OutputReceiver>
+		auto EncodeCodePointToLoaded(RuntimeCodePageTable const& table,
+		                             RuntimeEncodingResult<CodePointType> const& result,
+		                             OutputReceiver&& receiver)
+		{
+			using ResultType = RuntimeEncodingResult<std::byte>;
+			constexpr auto ReturnControlFlow =
+			    Core::Misc::IsCallableReturningControlFlow<OutputReceiver, ResultType const&>::value;
+
+			std::byte buffer[2];
+			const auto size = result.ResultCode == EncodingResultCode::Accept
+			                      ? table.FromCodePoint(result.Result[0], buffer)
+			                      : 0;
+			if (!size)
+			{
+				const auto resultCode = result.ResultCode == EncodingResultCode::Accept
+				                            ? EncodingResultCode::Reject
+				                            : result.ResultCode;
+				std::forward<OutputReceiver>(receiver)(ResultType{ {}, resultCode, 0 });
+				if constexpr (ReturnControlFlow)
+				{
+					return Core::Misc::ControlFlowVariant<>{ Core::Misc::BreakType{} };
+				}
+				else
+				{
+					return;
+				}
+			}
+
+			return std::forward<OutputReceiver>(receiver)(ResultType{
+			    std::span<const std::byte>(buffer, size), EncodingResultCode::Accept,
+			    result.AdvanceCount });
+		}
+	} // namespace Detail
+
 	template <typename OutputReceiver>
 	void EncodeOne(CodePage::CodePageType fromCodePage, std::span<const std::byte> const& src,
 	               CodePage::CodePageType toCodePage, OutputReceiver&& receiver)
@@ -266,12 +453,22 @@ namespace Cafe::Encoding::RuntimeEncoding
 #define CAFE_CODEPAGE(codePageValue)                                                               \
 	case codePageValue:                                                                            \
 		RuntimeEncoder<codePageValue>::EncodeOneFrom(fromCodePage, src, [&](auto const& result) {  \
-			std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{               \
+			return std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{        \
 			    std::as_bytes(result.Result), result.ResultCode, result.AdvanceCount });           \
 		});                                                                                        \
 		break;
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 		default:
+			if (const auto table = FindLoadedCodePage(toCodePage))
+			{
+				// 经由码点编码到运行时加载的代码页
+				RuntimeEncoder<CodePage::CodePoint>::EncodeOneFrom(
+				    fromCodePage, src, [&](auto const& result) {
+					    return Detail::EncodeCodePointToLoaded(*table, result,
+					                                           std::forward<OutputReceiver>(receiver));
+				    });
+				return;
+			}
 			assert(!"Invalid code page.");
 			return;
 		}
@@ -286,12 +483,22 @@ namespace Cafe::Encoding::RuntimeEncoding
 #define CAFE_CODEPAGE(codePageValue)                                                               \
 	case codePageValue:                                                                            \
 		RuntimeEncoder<codePageValue>::EncodeAllFrom(fromCodePage, src, [&](auto const& result) {  \
-			std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{               \
+			return std::forward<OutputReceiver>(receiver)(RuntimeEncodingResult<std::byte>{        \
 			    std::as_bytes(result.Result), result.ResultCode, result.AdvanceCount });           \
 		});                                                                                        \
 		break;
 #include <Cafe/Encoding/Config/IncludedEncoding.h>
 		default:
+			if (const auto table = FindLoadedCodePage(toCodePage))
+			{
+				// 经由码点编码到运行时加载的代码页
+				RuntimeEncoder<CodePage::CodePoint>::EncodeAllFrom(
+				    fromCodePage, src, [&](auto const& result) {
+					    return Detail::EncodeCodePointToLoaded(*table, result,
+					                                           std::forward<OutputReceiver>(receiver));
+				    });
+				return;
+			}
 			assert(!"Invalid code page.");
 			return;
 		}
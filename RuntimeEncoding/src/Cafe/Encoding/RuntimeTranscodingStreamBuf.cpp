@@ -0,0 +1,37 @@
+#include <Cafe/Encoding/RuntimeTranscodingStreamBuf.h>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	RuntimeTranscodingStreamBuf::RuntimeTranscodingStreamBuf(std::streambuf* underlying,
+	                                                         CodePage::CodePageType fromCodePage,
+	                                                         CodePage::CodePageType toCodePage,
+	                                                         std::size_t bufferSize)
+	    : TranscodingStreamBufBase{ underlying, bufferSize }, m_FromCodePage{ fromCodePage },
+	      m_ToCodePage{ toCodePage }
+	{
+	}
+
+	RuntimeTranscodingStreamBuf::~RuntimeTranscodingStreamBuf()
+	{
+		pubsync();
+	}
+
+	TranscodingStreamBufBase::TranscodeResult
+	RuntimeTranscodingStreamBuf::Transcode(std::span<const std::byte> src, std::vector<char>& dst)
+	{
+		TranscodeResult transcodeResult{ EncodingResultCode::Accept, 0 };
+		EncodeAll(m_FromCodePage, src, m_ToCodePage, [&](auto const& result) {
+			if (result.ResultCode == EncodingResultCode::Accept)
+			{
+				const auto resultData = reinterpret_cast<const char*>(result.Result.data());
+				dst.insert(dst.end(), resultData, resultData + result.Result.size());
+				transcodeResult.ConsumeCount += result.AdvanceCount;
+			}
+			else
+			{
+				transcodeResult.ResultCode = result.ResultCode;
+			}
+		});
+		return transcodeResult;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <Cafe/Encoding/TranscodingStreamBuf.h>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	/// @brief  在运行时确定的代码页之间转码的流缓冲
+	/// @remark 代码页需为 GetSupportCodePages 中包含的代码页，由 LoadCodePage
+	///         注册的代码页需在本对象销毁前保持注册
+	class CAFE_PUBLIC RuntimeTranscodingStreamBuf : public TranscodingStreamBufBase
+	{
+	public:
+		RuntimeTranscodingStreamBuf(std::streambuf* underlying, CodePage::CodePageType fromCodePage,
+		                            CodePage::CodePageType toCodePage,
+		                            std::size_t bufferSize = DefaultBufferSize);
+
+		~RuntimeTranscodingStreamBuf() override;
+
+		[[nodiscard]] CodePage::CodePageType GetFromCodePage() const noexcept
+		{
+			return m_FromCodePage;
+		}
+
+		[[nodiscard]] CodePage::CodePageType GetToCodePage() const noexcept
+		{
+			return m_ToCodePage;
+		}
+
+	protected:
+		TranscodeResult Transcode(std::span<const std::byte> src, std::vector<char>& dst) override;
+
+	private:
+		CodePage::CodePageType m_FromCodePage;
+		CodePage::CodePageType m_ToCodePage;
+	};
+} // namespace Cafe::Encoding::RuntimeEncoding
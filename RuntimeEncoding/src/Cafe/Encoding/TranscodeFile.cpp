@@ -0,0 +1,478 @@
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <Cafe/Encoding/TranscodeFile.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	namespace
+	{
+		constexpr auto Utf8CodePage = static_cast<CodePage::CodePageType>(65001);
+		constexpr auto Utf16LittleEndianCodePage = static_cast<CodePage::CodePageType>(1200);
+		constexpr auto Utf16BigEndianCodePage = static_cast<CodePage::CodePageType>(1201);
+		constexpr auto Utf32LittleEndianCodePage = static_cast<CodePage::CodePageType>(12000);
+		constexpr auto Utf32BigEndianCodePage = static_cast<CodePage::CodePageType>(12001);
+		constexpr auto GB2312CodePage = static_cast<CodePage::CodePageType>(936);
+		constexpr auto GB18030CodePage = static_cast<CodePage::CodePageType>(54936);
+		constexpr auto Big5CodePage = static_cast<CodePage::CodePageType>(950);
+		constexpr auto ShiftJisCodePage = static_cast<CodePage::CodePageType>(932);
+		constexpr auto EucKrCodePage = static_cast<CodePage::CodePageType>(949);
+
+		constexpr std::size_t BlockAlignment = 4096;
+		// 来源的一个字节至多产生的结果字节数，如 ASCII 转码到 UTF-32
+		constexpr std::size_t MaxExpansion = 4;
+		constexpr std::size_t EndOfStream = static_cast<std::size_t>(-1);
+
+		/// @brief  有界无锁多生产者多消费者队列
+		/// @remark 每个位置带有序号，生产者及消费者通过 CAS 竞争位置
+		///         使用者需保证队列中的元素数不超过容量，队列为空时 Pop 通过 std::atomic::wait 等待
+		class BoundedQueue
+		{
+		public:
+			explicit BoundedQueue(std::size_t capacity)
+			    : m_Capacity{ std::bit_ceil(capacity) },
+			      m_Cells{ std::make_unique<Cell[]>(m_Capacity) }, m_EnqueuePos{}, m_DequeuePos{},
+			      m_PushCount{}
+			{
+				for (std::size_t i = 0; i < m_Capacity; ++i)
+				{
+					m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			void Push(std::size_t value) noexcept
+			{
+				auto pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				while (true)
+				{
+					auto& cell = m_Cells[pos & (m_Capacity - 1)];
+					const auto diff = static_cast<std::intptr_t>(
+					    cell.Sequence.load(std::memory_order_acquire) - pos);
+					if (diff == 0)
+					{
+						if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1,
+						                                       std::memory_order_relaxed))
+						{
+							cell.Value = value;
+							cell.Sequence.store(pos + 1, std::memory_order_release);
+							break;
+						}
+					}
+					else
+					{
+						// 其他生产者已占用此位置
+						pos = m_EnqueuePos.load(std::memory_order_relaxed);
+					}
+				}
+
+				m_PushCount.fetch_add(1, std::memory_order_release);
+				m_PushCount.notify_one();
+			}
+
+			std::size_t Pop() noexcept
+			{
+				while (true)
+				{
+					const auto pushCount = m_PushCount.load(std::memory_order_acquire);
+					if (const auto value = TryPop())
+					{
+						return *value;
+					}
+					m_PushCount.wait(pushCount, std::memory_order_acquire);
+				}
+			}
+
+		private:
+			struct Cell
+			{
+				std::atomic<std::size_t> Sequence;
+				std::size_t Value;
+			};
+
+			std::size_t m_Capacity;
+			std::unique_ptr<Cell[]> m_Cells;
+			alignas(64) std::atomic<std::size_t> m_EnqueuePos;
+			alignas(64) std::atomic<std::size_t> m_DequeuePos;
+			alignas(64) std::atomic<std::uint32_t> m_PushCount;
+
+			std::optional<std::size_t> TryPop() noexcept
+			{
+				auto pos = m_DequeuePos.load(std::memory_order_relaxed);
+				while (true)
+				{
+					auto& cell = m_Cells[pos & (m_Capacity - 1)];
+					const auto diff = static_cast<std::intptr_t>(
+					    cell.Sequence.load(std::memory_order_acquire) - (pos + 1));
+					if (diff == 0)
+					{
+						if (m_DequeuePos.compare_exchange_weak(pos, pos + 1,
+						                                       std::memory_order_relaxed))
+						{
+							const auto value = cell.Value;
+							cell.Sequence.store(pos + m_Capacity, std::memory_order_release);
+							return value;
+						}
+					}
+					else if (diff < 0)
+					{
+						return {};
+					}
+					else
+					{
+						pos = m_DequeuePos.load(std::memory_order_relaxed);
+					}
+				}
+			}
+		};
+
+		struct AlignedDeleter
+		{
+			void operator()(std::byte* ptr) const noexcept
+			{
+				::operator delete[](ptr, std::align_val_t{ BlockAlignment });
+			}
+		};
+
+		using AlignedBuffer = std::unique_ptr<std::byte[], AlignedDeleter>;
+
+		AlignedBuffer AllocateAligned(std::size_t size)
+		{
+			return AlignedBuffer{ new (std::align_val_t{ BlockAlignment }) std::byte[size] };
+		}
+
+		struct Block
+		{
+			AlignedBuffer Input;
+			std::size_t InputSize;
+			AlignedBuffer Output;
+			RuntimeEncodingToSpanResult Result;
+			std::size_t Sequence;
+		};
+
+		struct FileCloser
+		{
+			void operator()(std::FILE* file) const noexcept
+			{
+				std::fclose(file);
+			}
+		};
+
+		using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+		FilePtr OpenFile(std::filesystem::path const& path, bool isWrite)
+		{
+#ifdef _WIN32
+			FilePtr file{ _wfopen(path.c_str(), isWrite ? L"wb" : L"rb") };
+#else
+			FilePtr file{ std::fopen(path.c_str(), isWrite ? "wb" : "rb") };
+#endif
+			if (file)
+			{
+				// 每次读写均为整块，无需额外缓冲
+				std::setvbuf(file.get(), nullptr, _IONBF, 0);
+			}
+			return file;
+		}
+
+		/// @brief  获得 data 中最后一个可以切分的字符边界，其后的数据需保留到下一块
+		/// @remark data 需从字符边界开始，返回 0 表示无法在 data 中找到字符边界
+		std::size_t FindBlockEnd(CodePage::CodePageType codePage, std::span<const std::byte> data)
+		{
+			const auto at = [&](std::size_t i) { return std::to_integer<unsigned>(data[i]); };
+
+			switch (codePage)
+			{
+			case Utf8CodePage:
+			{
+				// 回退到最后一个字符的开头，若其已完整则无需保留
+				auto pos = data.size();
+				while (pos > 0 && data.size() - pos < 3 && (at(pos - 1) & 0xC0) == 0x80)
+				{
+					--pos;
+				}
+				if (!pos)
+				{
+					return 0;
+				}
+				const auto lead = at(pos - 1);
+				const std::size_t width = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+				return data.size() - (pos - 1) >= width ? data.size() : pos - 1;
+			}
+			case Utf16LittleEndianCodePage:
+			case Utf16BigEndianCodePage:
+			{
+				auto pos = data.size() & ~std::size_t{ 1 };
+				// 不切分代理对
+				if (pos >= 2 &&
+				    ((codePage == Utf16BigEndianCodePage ? at(pos - 2) : at(pos - 1)) & 0xFC) == 0xD8)
+				{
+					pos -= 2;
+				}
+				return pos;
+			}
+			case Utf32LittleEndianCodePage:
+			case Utf32BigEndianCodePage:
+				return data.size() & ~std::size_t{ 3 };
+			case GB2312CodePage:
+			case GB18030CodePage:
+			case Big5CodePage:
+			case ShiftJisCodePage:
+			case EucKrCodePage:
+				// 这些代码页的后续字节均不小于 0x30，因此小于 0x30 的字节之后必为字符边界
+				for (auto pos = data.size(); pos > 0; --pos)
+				{
+					if (at(pos - 1) < 0x30)
+					{
+						return pos;
+					}
+				}
+				break;
+			default:
+				if (!IsCodePageVariableWidth(codePage).value_or(true))
+				{
+					return data.size();
+				}
+				break;
+			}
+
+			// 无法从字节本身判断边界的代码页需从头解码
+			std::size_t end = 0;
+			RuntimeEncoder<CodePage::CodePoint>::EncodeAllFrom(
+			    codePage, data, [&](auto const& result) -> Core::Misc::ControlFlowVariant<> {
+				    if (result.ResultCode != EncodingResultCode::Accept)
+				    {
+					    return Core::Misc::BreakType{};
+				    }
+				    end += result.AdvanceCount;
+				    return Core::Misc::ContinueType{};
+			    });
+			return end;
+		}
+	} // namespace
+
+	TranscodeFileResult TranscodeFile(std::filesystem::path const& fromPath,
+	                                  CodePage::CodePageType fromCodePage,
+	                                  std::filesystem::path const& toPath,
+	                                  CodePage::CodePageType toCodePage,
+	                                  TranscodeFileOptions const& options)
+	{
+		if (GetCodePageName(fromCodePage).empty() || GetCodePageName(toCodePage).empty())
+		{
+			return { TranscodeFileResultCode::UnsupportedCodePage, 0, 0 };
+		}
+
+		const auto input = OpenFile(fromPath, false);
+		if (!input)
+		{
+			return { TranscodeFileResultCode::CannotOpenInput, 0, 0 };
+		}
+
+		const auto output = OpenFile(toPath, true);
+		if (!output)
+		{
+			return { TranscodeFileResultCode::CannotOpenOutput, 0, 0 };
+		}
+
+		const auto blockSize = std::max(options.BlockSize, std::size_t{ 4 });
+		const auto blockCount = std::max(options.BlockCount, std::size_t{ 1 });
+		const auto converterCount =
+		    options.ConverterCount
+		        ? options.ConverterCount
+		        : std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+		                   std::size_t{ 1 });
+
+		std::vector<Block> blocks(blockCount);
+		for (auto& block : blocks)
+		{
+			block.Input = AllocateAligned(blockSize);
+			block.Output = AllocateAligned(blockSize * MaxExpansion);
+		}
+
+		// 各队列中的元素为块的下标或 EndOfStream，元素总数不会超过块数与转码线程数之和
+		const auto queueCapacity = blockCount + converterCount;
+		BoundedQueue freeQueue{ queueCapacity };
+		BoundedQueue convertQueue{ queueCapacity };
+		BoundedQueue writeQueue{ queueCapacity };
+		for (std::size_t i = 0; i < blockCount; ++i)
+		{
+			freeQueue.Push(i);
+		}
+
+		std::atomic<bool> stopped{ false };
+		std::atomic<bool> readFailed{ false };
+
+		std::thread reader{ [&] {
+			std::vector<std::byte> carry;
+			for (std::size_t sequence = 0; !stopped.load(std::memory_order_relaxed); ++sequence)
+			{
+				const auto index = freeQueue.Pop();
+				auto& block = blocks[index];
+
+				std::memcpy(block.Input.get(), carry.data(), carry.size());
+				auto size = carry.size();
+				while (size < blockSize)
+				{
+					const auto readCount =
+					    std::fread(block.Input.get() + size, 1, blockSize - size, input.get());
+					if (!readCount)
+					{
+						break;
+					}
+					size += readCount;
+				}
+
+				if (std::ferror(input.get()))
+				{
+					readFailed.store(true, std::memory_order_relaxed);
+					freeQueue.Push(index);
+					break;
+				}
+
+				const auto isEnd = size < blockSize;
+				if (!size)
+				{
+					freeQueue.Push(index);
+					break;
+				}
+
+				// 结尾不完整的字符保留到下一块，输入结束时则交由转码线程报告
+				auto end = isEnd ? size : FindBlockEnd(fromCodePage, std::span(block.Input.get(), size));
+				if (!end)
+				{
+					end = size;
+				}
+				carry.assign(block.Input.get() + end, block.Input.get() + size);
+
+				block.InputSize = end;
+				block.Sequence = sequence;
+				convertQueue.Push(index);
+
+				if (isEnd)
+				{
+					break;
+				}
+			}
+
+			for (std::size_t i = 0; i < converterCount; ++i)
+			{
+				convertQueue.Push(EndOfStream);
+			}
+		} };
+
+		std::vector<std::thread> converters;
+		converters.reserve(converterCount);
+		for (std::size_t i = 0; i < converterCount; ++i)
+		{
+			converters.emplace_back([&] {
+				while (true)
+				{
+					const auto index = convertQueue.Pop();
+					if (index == EndOfStream)
+					{
+						writeQueue.Push(EndOfStream);
+						break;
+					}
+
+					auto& block = blocks[index];
+					if (!stopped.load(std::memory_order_relaxed))
+					{
+						block.Result = EncodeAllToSpan(
+						    fromCodePage, std::span(block.Input.get(), block.InputSize), toCodePage,
+						    std::span(block.Output.get(), blockSize * MaxExpansion));
+					}
+					writeQueue.Push(index);
+				}
+			});
+		}
+
+		// 调用线程作为写入阶段，按序号重新排列转码完成的块
+		TranscodeFileResult result{ TranscodeFileResultCode::Succeed, 0, 0 };
+		std::vector<std::optional<std::size_t>> reorderBuffer(blockCount);
+		std::size_t nextSequence = 0;
+		const auto stop = [&](TranscodeFileResultCode resultCode) {
+			result.ResultCode = resultCode;
+			stopped.store(true, std::memory_order_relaxed);
+			for (auto& index : reorderBuffer)
+			{
+				if (index)
+				{
+					freeQueue.Push(*std::exchange(index, std::nullopt));
+				}
+			}
+		};
+
+		for (std::size_t finishedCount = 0; finishedCount < converterCount;)
+		{
+			const auto index = writeQueue.Pop();
+			if (index == EndOfStream)
+			{
+				++finishedCount;
+				continue;
+			}
+
+			if (stopped.load(std::memory_order_relaxed))
+			{
+				freeQueue.Push(index);
+				continue;
+			}
+
+			reorderBuffer[blocks[index].Sequence % blockCount] = index;
+			while (const auto readyIndex = std::exchange(reorderBuffer[nextSequence % blockCount],
+			                                             std::nullopt))
+			{
+				auto const& block = blocks[*readyIndex];
+				const auto blockResult = block.Result;
+				const auto writeCount =
+				    std::fwrite(block.Output.get(), 1, blockResult.ProduceCount, output.get());
+				result.ConsumeCount += blockResult.ConsumeCount;
+				result.ProduceCount += writeCount;
+				freeQueue.Push(*readyIndex);
+				++nextSequence;
+
+				if (writeCount != blockResult.ProduceCount)
+				{
+					stop(TranscodeFileResultCode::WriteError);
+					break;
+				}
+
+				if (blockResult.ResultCode != RuntimeEncodingResultCode::Accept)
+				{
+					stop(blockResult.ResultCode == RuntimeEncodingResultCode::Incomplete
+					         ? TranscodeFileResultCode::Incomplete
+					         : TranscodeFileResultCode::Reject);
+					break;
+				}
+			}
+		}
+
+		reader.join();
+		for (auto& converter : converters)
+		{
+			converter.join();
+		}
+
+		if (result.ResultCode == TranscodeFileResultCode::Succeed)
+		{
+			if (readFailed.load(std::memory_order_relaxed))
+			{
+				result.ResultCode = TranscodeFileResultCode::ReadError;
+			}
+			else if (std::fflush(output.get()) != 0)
+			{
+				result.ResultCode = TranscodeFileResultCode::WriteError;
+			}
+		}
+
+		return result;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
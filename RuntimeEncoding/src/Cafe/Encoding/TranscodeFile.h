@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Cafe/Encoding/CodePage.h>
+#include <Cafe/Misc/Export.h>
+#include <cstddef>
+#include <filesystem>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	struct TranscodeFileOptions
+	{
+		/// @brief  每块读取的来源字节数，至少需能容纳来源代码页的一个完整字符
+		std::size_t BlockSize = 1024 * 1024;
+		/// @brief  可重用的块数，即同时处于读取、转码及写入中的块数的上限
+		/// @remark 应大于转码线程数，使读取、转码及写入可以同时进行
+		std::size_t BlockCount = 16;
+		/// @brief  转码线程数，为 0 时使用硬件线程数
+		std::size_t ConverterCount = 0;
+	};
+
+	enum class TranscodeFileResultCode
+	{
+		Succeed,             ///< @brief 转码成功
+		UnsupportedCodePage, ///< @brief 代码页不在 GetSupportCodePages 中
+		CannotOpenInput,     ///< @brief 无法打开输入文件
+		CannotOpenOutput,    ///< @brief 无法打开输出文件
+		ReadError,           ///< @brief 读取输入文件时出错
+		WriteError,          ///< @brief 写入输出文件时出错
+		Incomplete,          ///< @brief 输入结尾的字符不完整
+		Reject,              ///< @brief 输入包含无效或无法转码的字符
+	};
+
+	struct TranscodeFileResult
+	{
+		TranscodeFileResultCode ResultCode;
+		std::size_t ConsumeCount; ///< @brief 已转码的来源字节数，转码失败时即为出错的位置
+		std::size_t ProduceCount; ///< @brief 已写入输出文件的字节数
+	};
+
+	/// @brief  将文件从一个代码页转码到另一个代码页并写入另一个文件
+	/// @remark 使用读取、转码、写入三个阶段的流水线，读取线程在字符边界处切分块并将不完整的字符
+	///         保留到下一块，多个转码线程以 EncodeAllToSpan 并行转码各块，调用线程按读取顺序写入结果
+	///         各阶段之间以有界无锁队列传递可重用的对齐的块，因此磁盘读写与转码可以同时进行
+	///         出错时之前的块的结果均已写入输出文件，之后的块不会写入
+	CAFE_PUBLIC TranscodeFileResult TranscodeFile(std::filesystem::path const& fromPath,
+	                                              CodePage::CodePageType fromCodePage,
+	                                              std::filesystem::path const& toPath,
+	                                              CodePage::CodePageType toCodePage,
+	                                              TranscodeFileOptions const& options = {});
+} // namespace Cafe::Encoding::RuntimeEncoding
@@ -0,0 +1,209 @@
+#include <Cafe/Encoding/TranscodeStage.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	namespace
+	{
+		// 来源的一个字节至多产生的结果字节数，如 ASCII 转码到 UTF-32
+		constexpr std::size_t MaxExpansion = 4;
+	} // namespace
+
+	struct TranscodeStage::Coroutine
+	{
+		struct promise_type
+		{
+			TranscodeStage* Stage;
+
+			explicit promise_type(TranscodeStage& stage) noexcept : Stage{ &stage }
+			{
+			}
+
+			Coroutine get_return_object() noexcept
+			{
+				return { std::coroutine_handle<promise_type>::from_promise(*this) };
+			}
+
+			std::suspend_always initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_always final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_always yield_value(std::span<const std::byte> output) const noexcept
+			{
+				Stage->m_Output = output;
+				Stage->m_State = State::Output;
+				return {};
+			}
+
+			void return_void() const noexcept
+			{
+				Stage->m_State = State::Finished;
+			}
+
+			[[noreturn]] void unhandled_exception() const
+			{
+				Stage->m_State = State::Finished;
+				throw;
+			}
+		};
+
+		std::coroutine_handle<promise_type> Handle;
+	};
+
+	TranscodeStage::TranscodeStage(CodePage::CodePageType fromCodePage,
+	                               CodePage::CodePageType toCodePage, std::size_t workQuantum)
+	    : m_FromCodePage{ fromCodePage }, m_ToCodePage{ toCodePage },
+	      m_WorkQuantum{ std::max(workQuantum, MaxCarrySize) },
+	      m_OutputBufferSize{ (m_WorkQuantum + MaxCarrySize) * MaxExpansion }, m_IsLastInput{},
+	      m_CarrySize{}, m_State{ State::NeedInput }, m_ResultCode{ RuntimeEncodingResultCode::Accept },
+	      m_ConsumeCount{}
+	{
+		m_OutputBuffer = std::make_unique_for_overwrite<std::byte[]>(m_OutputBufferSize);
+		m_Coroutine = Run(*this).Handle;
+	}
+
+	TranscodeStage::~TranscodeStage()
+	{
+		m_Coroutine.destroy();
+	}
+
+	void TranscodeStage::Feed(std::span<const std::byte> chunk, bool isLast) noexcept
+	{
+		assert(m_State == State::NeedInput);
+		m_Input = chunk;
+		m_IsLastInput = isLast;
+	}
+
+	bool TranscodeStage::Next()
+	{
+		m_Output = {};
+		if (m_State == State::Finished)
+		{
+			return false;
+		}
+
+		m_Coroutine.resume();
+		return m_State == State::Output;
+	}
+
+	TranscodeStage::Coroutine TranscodeStage::Run(TranscodeStage& stage)
+	{
+		const auto outputBuffer = std::span(stage.m_OutputBuffer.get(), stage.m_OutputBufferSize);
+		while (true)
+		{
+			while (!stage.m_Input.empty())
+			{
+				std::size_t produceCount = 0;
+				if (stage.m_CarrySize)
+				{
+					produceCount = stage.TranscodeCarry(outputBuffer);
+				}
+				if (stage.m_ResultCode == RuntimeEncodingResultCode::Accept && !stage.m_CarrySize &&
+				    !stage.m_Input.empty())
+				{
+					produceCount += stage.TranscodeInput(outputBuffer.subspan(produceCount));
+				}
+
+				if (produceCount)
+				{
+					co_yield std::span<const std::byte>(outputBuffer.data(), produceCount);
+				}
+
+				if (stage.m_ResultCode != RuntimeEncodingResultCode::Accept)
+				{
+					co_return;
+				}
+			}
+
+			if (stage.m_IsLastInput)
+			{
+				if (stage.m_CarrySize)
+				{
+					stage.m_ResultCode = RuntimeEncodingResultCode::Incomplete;
+				}
+				co_return;
+			}
+
+			stage.m_State = State::NeedInput;
+			co_await std::suspend_always{};
+		}
+	}
+
+	std::size_t TranscodeStage::TranscodeCarry(std::span<std::byte> output)
+	{
+		// 将保留的不完整字符与新输入的开头拼接后转码
+		std::byte staging[MaxCarrySize * 2];
+		const auto appendSize = std::min(m_Input.size(), MaxCarrySize);
+		std::memcpy(staging, m_Carry, m_CarrySize);
+		std::memcpy(staging + m_CarrySize, m_Input.data(), appendSize);
+		const auto stagingSize = m_CarrySize + appendSize;
+
+		const auto result =
+		    EncodeAllToSpan(m_FromCodePage, std::span(staging, stagingSize), m_ToCodePage, output);
+		if (result.ConsumeCount >= m_CarrySize)
+		{
+			m_Input = m_Input.subspan(result.ConsumeCount - m_CarrySize);
+			m_ConsumeCount += result.ConsumeCount;
+			m_CarrySize = 0;
+			if (result.ResultCode == RuntimeEncodingResultCode::Reject)
+			{
+				m_ResultCode = RuntimeEncodingResultCode::Reject;
+			}
+			return result.ProduceCount;
+		}
+
+		// 保留的字符仍不完整，此时新输入必然已全部拼接
+		if (result.ResultCode == RuntimeEncodingResultCode::Reject || stagingSize > MaxCarrySize)
+		{
+			m_ResultCode = RuntimeEncodingResultCode::Reject;
+			return 0;
+		}
+
+		std::memcpy(m_Carry, staging, stagingSize);
+		m_CarrySize = stagingSize;
+		m_Input = m_Input.subspan(appendSize);
+		return 0;
+	}
+
+	std::size_t TranscodeStage::TranscodeInput(std::span<std::byte> output)
+	{
+		const auto isWhole = m_Input.size() <= m_WorkQuantum;
+		const auto result = EncodeAllToSpan(
+		    m_FromCodePage, m_Input.first(isWhole ? m_Input.size() : m_WorkQuantum), m_ToCodePage,
+		    output);
+		m_Input = m_Input.subspan(result.ConsumeCount);
+		m_ConsumeCount += result.ConsumeCount;
+
+		if (result.ResultCode == RuntimeEncodingResultCode::Reject)
+		{
+			m_ResultCode = RuntimeEncodingResultCode::Reject;
+		}
+		else if (!m_Input.empty())
+		{
+			// 未出错而提前停止时，停止的位置处为不完整的字符，但不一定位于输入块结尾，如 UTF-8 中
+			// 单独出现的后续字节
+			if (isWhole && m_Input.size() < MaxCarrySize)
+			{
+				// 输入块结尾的不完整字符保留到下一个输入块
+				std::memcpy(m_Carry, m_Input.data(), m_Input.size());
+				m_CarrySize = m_Input.size();
+				m_Input = {};
+			}
+			else if (isWhole || !result.ConsumeCount)
+			{
+				// 剩余部分足以容纳一个字符仍不完整，重试不会有进展
+				m_ResultCode = result.ResultCode;
+			}
+		}
+
+		return result.ProduceCount;
+	}
+} // namespace Cafe::Encoding::RuntimeEncoding
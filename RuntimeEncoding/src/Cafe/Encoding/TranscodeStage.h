@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <coroutine>
+#include <memory>
+
+namespace Cafe::Encoding::RuntimeEncoding
+{
+	/// @brief  用于事件循环的流式转码阶段
+	/// @remark 内部由一个贯穿整个流的协程实现：输入块通过 Feed 提供，协程每处理至多
+	///         WorkQuantum 字节的输入即 co_yield 一块输出并挂起，输入耗尽时挂起等待下一个输入块，
+	///         因此单次 Next 的耗时有上限，调用者可在两次 Next 之间让出事件循环
+	///         跨越输入块的不完整字符保留在内部，协程帧及输出缓冲区仅在构造时分配一次
+	///         由于协程引用本对象，本对象不可复制或移动
+	/// @code
+	///         stage.Feed(chunk, isLast);
+	///         while (stage.Next())
+	///         {
+	///             Send(stage.GetOutput());
+	///             co_await loop.Yield();
+	///         }
+	/// @endcode
+	class CAFE_PUBLIC TranscodeStage
+	{
+	public:
+		static constexpr std::size_t DefaultWorkQuantum = 64 * 1024;
+
+		/// @param  workQuantum 每次 Next 至多处理的输入字节数，不小于 16
+		TranscodeStage(CodePage::CodePageType fromCodePage, CodePage::CodePageType toCodePage,
+		               std::size_t workQuantum = DefaultWorkQuantum);
+		~TranscodeStage();
+
+		TranscodeStage(TranscodeStage const&) = delete;
+		TranscodeStage& operator=(TranscodeStage const&) = delete;
+
+		/// @brief  提供下一个输入块
+		/// @param  chunk   输入块，需保持有效直至 Next 返回 false
+		/// @param  isLast  是否为最后一个输入块，此后结尾仍不完整的字符将视为错误
+		/// @remark 仅可在 NeedInput 返回 true 时调用
+		void Feed(std::span<const std::byte> chunk, bool isLast = false) noexcept;
+
+		/// @brief  继续转码直至产生下一块输出
+		/// @return 是否产生了输出，需要更多输入、转码出错或已结束时返回 false
+		bool Next();
+
+		/// @brief  获得最近一次 Next 产生的输出，在下一次 Next 前有效
+		[[nodiscard]] std::span<const std::byte> GetOutput() const noexcept
+		{
+			return m_Output;
+		}
+
+		[[nodiscard]] bool NeedInput() const noexcept
+		{
+			return m_State == State::NeedInput;
+		}
+
+		[[nodiscard]] bool IsFinished() const noexcept
+		{
+			return m_State == State::Finished;
+		}
+
+		/// @brief  获得转码结果，未结束或成功结束时为 Accept
+		[[nodiscard]] RuntimeEncodingResultCode GetResultCode() const noexcept
+		{
+			return m_ResultCode;
+		}
+
+		/// @brief  获得已转码的输入字节数，转码出错时即为出错的位置
+		[[nodiscard]] std::size_t GetConsumeCount() const noexcept
+		{
+			return m_ConsumeCount;
+		}
+
+	private:
+		enum class State
+		{
+			NeedInput,
+			Output,
+			Finished,
+		};
+
+		// 来源代码页的一个字符的最大字节数的上界，用于保留跨越输入块的不完整字符
+		static constexpr std::size_t MaxCarrySize = 16;
+
+		CodePage::CodePageType m_FromCodePage;
+		CodePage::CodePageType m_ToCodePage;
+		std::size_t m_WorkQuantum;
+
+		std::unique_ptr<std::byte[]> m_OutputBuffer;
+		std::size_t m_OutputBufferSize;
+		std::span<const std::byte> m_Output;
+
+		std::span<const std::byte> m_Input;
+		bool m_IsLastInput;
+		std::byte m_Carry[MaxCarrySize];
+		std::size_t m_CarrySize;
+
+		State m_State;
+		RuntimeEncodingResultCode m_ResultCode;
+		std::size_t m_ConsumeCount;
+
+		std::coroutine_handle<> m_Coroutine;
+
+		struct Coroutine;
+		static Coroutine Run(TranscodeStage& stage);
+
+		std::size_t TranscodeCarry(std::span<std::byte> output);
+		std::size_t TranscodeInput(std::span<std::byte> output);
+	};
+} // namespace Cafe::Encoding::RuntimeEncoding
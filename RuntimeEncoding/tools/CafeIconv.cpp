@@ -0,0 +1,525 @@
+#include <Cafe/Encoding/MappedText.h>
+#include <Cafe/Encoding/RuntimeEncoding.h>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+// 用法：cafe-iconv -f <来源代码页> -t <目标代码页> [选项] [输入文件]
+//       cafe-iconv -l
+// 代码页可使用名称（不区分大小写）或代码页值，未指定输入文件或为 "-" 时从标准输入读取
+// 选项：
+//   -o <输出文件>            输出到文件而不是标准输出
+//   -j <线程数>              并行转码的线程数，默认为硬件线程数
+//   --replacement <字符串>   以 UTF-8 表示的替换字符串，用于替换无法转码的字符，未指定时遇到无法转码的
+//                            字符即停止
+//   --validate-only          仅检查输入是否为有效的来源代码页的文本，不进行输出，此时无需指定 -t
+// 输入被映射到内存并在字符边界处分块，各块并行转码后按顺序输出
+
+using namespace Cafe::Encoding;
+
+namespace
+{
+	constexpr std::size_t ChunkSize = 4 * 1024 * 1024;
+	// 所有代码页中一个字符编码后的最大字节数
+	constexpr std::size_t MaxCharBytes = 4;
+
+	constexpr auto Utf8CodePage = static_cast<CodePage::CodePageType>(65001);
+	constexpr auto Utf16LittleEndianCodePage = static_cast<CodePage::CodePageType>(1200);
+	constexpr auto Utf16BigEndianCodePage = static_cast<CodePage::CodePageType>(1201);
+	constexpr auto Utf32LittleEndianCodePage = static_cast<CodePage::CodePageType>(12000);
+	constexpr auto Utf32BigEndianCodePage = static_cast<CodePage::CodePageType>(12001);
+
+	/// @brief  寻找字符边界的方式
+	enum class BoundaryKind
+	{
+		Fixed,   ///< @brief 定长代码页，按编码单元对齐即可
+		Utf8,    ///< @brief 跳过后续字节
+		Utf16,   ///< @brief 按编码单元对齐并跳过低代理
+		Newline, ///< @brief 不能自同步的变长代码页，在换行符之后分块
+	};
+
+	struct CodePageInfo
+	{
+		CodePage::CodePageType CodePage;
+		BoundaryKind Boundary;
+		std::size_t UnitSize;
+		bool IsBigEndian;
+	};
+
+	CodePageInfo GetCodePageInfo(CodePage::CodePageType codePage)
+	{
+		switch (codePage)
+		{
+		case Utf8CodePage:
+			return { codePage, BoundaryKind::Utf8, 1, false };
+		case Utf16LittleEndianCodePage:
+			return { codePage, BoundaryKind::Utf16, 2, false };
+		case Utf16BigEndianCodePage:
+			return { codePage, BoundaryKind::Utf16, 2, true };
+		case Utf32LittleEndianCodePage:
+			return { codePage, BoundaryKind::Fixed, 4, false };
+		case Utf32BigEndianCodePage:
+			return { codePage, BoundaryKind::Fixed, 4, true };
+		default:
+			// 换行符不会出现在任何已知双字节代码页的后续字节中
+			return { codePage,
+				     RuntimeEncoding::IsCodePageVariableWidth(codePage).value_or(true)
+				         ? BoundaryKind::Newline
+				         : BoundaryKind::Fixed,
+				     1, false };
+		}
+	}
+
+	/// @brief  寻找不小于 pos 的字符边界
+	std::size_t FindBoundary(std::span<const std::byte> data, std::size_t pos,
+	                         CodePageInfo const& info)
+	{
+		const auto at = [&](std::size_t i) { return std::to_integer<unsigned>(data[i]); };
+
+		pos = std::min((pos + info.UnitSize - 1) / info.UnitSize * info.UnitSize, data.size());
+		switch (info.Boundary)
+		{
+		case BoundaryKind::Fixed:
+			return pos;
+		case BoundaryKind::Utf8:
+			for (std::size_t i = 0; i < 3 && pos < data.size() && (at(pos) & 0xC0) == 0x80; ++i)
+			{
+				++pos;
+			}
+			return pos;
+		case BoundaryKind::Utf16:
+			if (pos + 2 <= data.size() &&
+			    ((info.IsBigEndian ? at(pos) : at(pos + 1)) & 0xFC) == 0xDC)
+			{
+				pos += 2;
+			}
+			return pos;
+		case BoundaryKind::Newline:
+		{
+			const auto newline = std::find(data.begin() + pos, data.end(), std::byte{ '\n' });
+			return newline == data.end() ? data.size() : newline - data.begin() + 1;
+		}
+		}
+		return data.size();
+	}
+
+	std::vector<std::span<const std::byte>> SplitChunks(std::span<const std::byte> data,
+	                                                    CodePageInfo const& info)
+	{
+		std::vector<std::span<const std::byte>> chunks;
+		std::size_t begin = 0;
+		while (begin < data.size())
+		{
+			const auto end = FindBoundary(data, std::max(begin + ChunkSize, begin + 1), info);
+			chunks.push_back(data.subspan(begin, end - begin));
+			begin = end;
+		}
+		return chunks;
+	}
+
+	struct ChunkResult
+	{
+		std::vector<std::byte> Output;
+		/// @brief  首个无法转码的位置（相对于块开头），若不存在则为 std::nullopt
+		std::optional<std::size_t> ErrorOffset;
+		RuntimeEncoding::RuntimeEncodingResultCode ErrorCode{};
+		std::size_t ReplacedCount{};
+	};
+
+	/// @brief  获得开头的字符的宽度，无法解码时返回一个编码单元的宽度
+	std::size_t GetSourceCharWidth(std::span<const std::byte> src, CodePageInfo const& info)
+	{
+		std::size_t width = 0;
+		const auto maxCharSize =
+		    RuntimeEncoding::GetCodePageMaxWidth(info.CodePage) * info.UnitSize;
+		RuntimeEncoding::RuntimeEncoder<CodePage::CodePoint>::EncodeOneFrom(
+		    info.CodePage, src.first(std::min(src.size(), maxCharSize)), [&](auto const& result) {
+			    if (result.ResultCode == EncodingResultCode::Accept)
+			    {
+				    width = result.AdvanceCount;
+			    }
+		    });
+		return std::min(width ? width : info.UnitSize, src.size());
+	}
+
+	/// @brief  判断 src 是否仅为一个被截断的字符
+	/// @remark 短于一个字符的最大宽度，且除开头的编码单元外不能解码出任何字符
+	bool IsTruncatedChar(std::span<const std::byte> src, CodePageInfo const& info)
+	{
+		if (src.size() >= RuntimeEncoding::GetCodePageMaxWidth(info.CodePage) * info.UnitSize)
+		{
+			return false;
+		}
+
+		for (auto i = info.UnitSize; i < src.size(); i += info.UnitSize)
+		{
+			bool accepted = false;
+			RuntimeEncoding::RuntimeEncoder<CodePage::CodePoint>::EncodeOneFrom(
+			    info.CodePage, src.subspan(i), [&](auto const& result) {
+				    accepted = result.ResultCode == EncodingResultCode::Accept;
+			    });
+			if (accepted)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	ChunkResult TranscodeChunk(std::span<const std::byte> src, CodePageInfo const& from,
+	                           CodePage::CodePageType to,
+	                           std::optional<std::span<const std::byte>> const& replacement)
+	{
+		ChunkResult result;
+		// 每个源字节至多产生一个字符或一个替换字符串
+		result.Output.resize(src.size() *
+		                     std::max(MaxCharBytes, replacement ? replacement->size() : 0));
+		std::size_t produceCount = 0;
+		std::size_t offset = 0;
+		while (offset < src.size())
+		{
+			const auto rest = src.subspan(offset);
+			const auto encodeResult = RuntimeEncoding::EncodeAllToSpan(
+			    from.CodePage, rest, to, std::span(result.Output).subspan(produceCount));
+			produceCount += encodeResult.ProduceCount;
+			offset += encodeResult.ConsumeCount;
+			if (encodeResult.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Accept)
+			{
+				continue;
+			}
+
+			if (!replacement)
+			{
+				result.ErrorOffset = offset;
+				result.ErrorCode = encodeResult.ResultCode;
+				break;
+			}
+
+			std::memcpy(result.Output.data() + produceCount, replacement->data(),
+			            replacement->size());
+			produceCount += replacement->size();
+			++result.ReplacedCount;
+			// 不完整的字符也可能出现在输入中间，如 UTF-8 中单独出现的后续字节，此时仅跳过一个字符
+			offset += encodeResult.ResultCode ==
+			                      RuntimeEncoding::RuntimeEncodingResultCode::Incomplete &&
+			                  IsTruncatedChar(src.subspan(offset), from)
+			              ? src.size() - offset
+			              : GetSourceCharWidth(src.subspan(offset), from);
+		}
+		result.Output.resize(produceCount);
+		return result;
+	}
+
+	ChunkResult ValidateChunk(std::span<const std::byte> src, CodePageInfo const& from)
+	{
+		ChunkResult result;
+		std::size_t offset = 0;
+		RuntimeEncoding::RuntimeEncoder<CodePage::CodePoint>::EncodeAllFrom(
+		    from.CodePage, src,
+		    [&](auto const& encodeResult) -> Cafe::Core::Misc::ControlFlowVariant<> {
+			    if (encodeResult.ResultCode == EncodingResultCode::Accept)
+			    {
+				    offset += encodeResult.AdvanceCount;
+				    return Cafe::Core::Misc::ContinueType{};
+			    }
+
+			    result.ErrorOffset = offset;
+			    result.ErrorCode =
+			        static_cast<RuntimeEncoding::RuntimeEncodingResultCode>(encodeResult.ResultCode);
+			    return Cafe::Core::Misc::BreakType{};
+		    });
+		return result;
+	}
+
+	std::optional<CodePage::CodePageType> FindCodePage(std::string_view name)
+	{
+		unsigned value;
+		if (const auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), value);
+		    ec == std::errc{} && ptr == name.data() + name.size())
+		{
+			const auto codePage = static_cast<CodePage::CodePageType>(value);
+			if (!RuntimeEncoding::GetCodePageName(codePage).empty())
+			{
+				return codePage;
+			}
+			return {};
+		}
+
+		// 比较时忽略大小写及空格、'-'、'_' 等分隔符，如 "utf16le" 可匹配 "UTF-16 LE"
+		const auto normalize = [](std::string_view str) {
+			std::string result;
+			for (const auto ch : str)
+			{
+				if (std::isalnum(static_cast<unsigned char>(ch)))
+				{
+					result.push_back(
+					    static_cast<char>(std::tolower(static_cast<unsigned char>(ch))));
+				}
+			}
+			return result;
+		};
+		const auto normalizedName = normalize(name);
+		for (const auto codePage : RuntimeEncoding::GetSupportCodePages())
+		{
+			if (normalize(RuntimeEncoding::GetCodePageName(codePage)) == normalizedName)
+			{
+				return codePage;
+			}
+		}
+		return {};
+	}
+
+	const char* GetErrorDescription(RuntimeEncoding::RuntimeEncodingResultCode code)
+	{
+		return code == RuntimeEncoding::RuntimeEncodingResultCode::Incomplete
+		           ? "incomplete character"
+		           : "invalid or unconvertible character";
+	}
+
+	[[noreturn]] void Usage()
+	{
+		std::cerr << "Usage: cafe-iconv -f <from> -t <to> [-o <output>] [-j <threads>] "
+		             "[--replacement <utf-8 string>] [--validate-only] [input]\n"
+		             "       cafe-iconv -l\n";
+		std::exit(2);
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	std::optional<std::string_view> fromName, toName, outputPath, replacementText;
+	std::string_view inputPath = "-";
+	bool validateOnly = false;
+	unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg = argv[i];
+		const auto next = [&]() -> std::string_view {
+			if (i + 1 >= argc)
+			{
+				Usage();
+			}
+			return argv[++i];
+		};
+
+		if (arg == "-f")
+		{
+			fromName = next();
+		}
+		else if (arg == "-t")
+		{
+			toName = next();
+		}
+		else if (arg == "-o")
+		{
+			outputPath = next();
+		}
+		else if (arg == "-j")
+		{
+			const auto value = next();
+			if (std::from_chars(value.data(), value.data() + value.size(), threadCount).ec !=
+			        std::errc{} ||
+			    !threadCount)
+			{
+				Usage();
+			}
+		}
+		else if (arg == "--replacement")
+		{
+			replacementText = next();
+		}
+		else if (arg == "--validate-only")
+		{
+			validateOnly = true;
+		}
+		else if (arg == "-l")
+		{
+			for (const auto codePage : RuntimeEncoding::GetSupportCodePages())
+			{
+				if (codePage != CodePage::CodePoint)
+				{
+					std::cout << RuntimeEncoding::GetCodePageName(codePage) << " ("
+					          << static_cast<unsigned>(codePage) << ")\n";
+				}
+			}
+			return 0;
+		}
+		else if (arg.size() > 1 && arg.front() == '-')
+		{
+			Usage();
+		}
+		else
+		{
+			inputPath = arg;
+		}
+	}
+
+	if (!fromName || (!validateOnly && !toName))
+	{
+		Usage();
+	}
+
+	const auto fromCodePage = FindCodePage(*fromName);
+	const auto toCodePage = validateOnly ? fromCodePage : FindCodePage(*toName);
+	if (!fromCodePage || !toCodePage)
+	{
+		std::cerr << "cafe-iconv: unsupported code page \""
+		          << (fromCodePage ? *toName : *fromName) << "\"\n";
+		return 2;
+	}
+	const auto fromInfo = GetCodePageInfo(*fromCodePage);
+
+	std::vector<std::byte> replacementBuffer;
+	std::optional<std::span<const std::byte>> replacement;
+	if (replacementText && !validateOnly)
+	{
+		const auto utf8CodePage = FindCodePage("UTF-8");
+		if (!utf8CodePage)
+		{
+			std::cerr << "cafe-iconv: UTF-8 is required for --replacement\n";
+			return 2;
+		}
+
+		replacementBuffer.resize(replacementText->size() * MaxCharBytes);
+		const auto result = RuntimeEncoding::EncodeAllToSpan(
+		    *utf8CodePage, std::as_bytes(std::span(*replacementText)), *toCodePage,
+		    replacementBuffer);
+		if (!replacementText->empty() &&
+		    result.ResultCode != RuntimeEncoding::RuntimeEncodingResultCode::Accept)
+		{
+			std::cerr << "cafe-iconv: replacement cannot be represented in \"" << *toName
+			          << "\"\n";
+			return 2;
+		}
+		replacementBuffer.resize(result.ProduceCount);
+		replacement = replacementBuffer;
+	}
+
+	RuntimeEncoding::MappedFile mappedInput;
+	std::vector<std::byte> stdinInput;
+	std::span<const std::byte> input;
+	if (inputPath == "-")
+	{
+#ifdef _WIN32
+		_setmode(_fileno(stdin), _O_BINARY);
+#endif
+		constexpr std::size_t ReadSize = 1024 * 1024;
+		std::size_t readCount;
+		do
+		{
+			const auto oldSize = stdinInput.size();
+			stdinInput.resize(oldSize + ReadSize);
+			readCount = std::fread(stdinInput.data() + oldSize, 1, ReadSize, stdin);
+			stdinInput.resize(oldSize + readCount);
+		} while (readCount);
+		input = stdinInput;
+	}
+	else
+	{
+		if (!mappedInput.Open(std::string(inputPath), RuntimeEncoding::MappedFileAccessPattern::Sequential))
+		{
+			std::cerr << "cafe-iconv: cannot open \"" << inputPath << "\"\n";
+			return 1;
+		}
+		input = mappedInput.GetData();
+	}
+
+	std::FILE* output = stdout;
+	if (outputPath)
+	{
+		output = std::fopen(std::string(*outputPath).c_str(), "wb");
+		if (!output)
+		{
+			std::cerr << "cafe-iconv: cannot open \"" << *outputPath << "\"\n";
+			return 1;
+		}
+	}
+#ifdef _WIN32
+	else
+	{
+		_setmode(_fileno(stdout), _O_BINARY);
+	}
+#endif
+	// 每块的输出均为一次大的写入，无需额外缓冲
+	std::setvbuf(output, nullptr, _IONBF, 0);
+
+	const auto chunks = SplitChunks(input, fromInfo);
+	std::deque<std::future<ChunkResult>> pending;
+	std::size_t nextChunk = 0, chunkOffset = 0, replacedCount = 0;
+	int exitCode = 0;
+
+	const auto launch = [&] {
+		const auto chunk = chunks[nextChunk++];
+		pending.push_back(std::async(std::launch::async, [=, &fromInfo] {
+			return validateOnly ? ValidateChunk(chunk, fromInfo)
+			                    : TranscodeChunk(chunk, fromInfo, *toCodePage, replacement);
+		}));
+	};
+
+	// 同时处理的块数有限，以限制内存占用
+	while (nextChunk < chunks.size() && pending.size() < threadCount)
+	{
+		launch();
+	}
+
+	for (std::size_t i = 0; i < chunks.size(); ++i)
+	{
+		auto result = pending.front().get();
+		pending.pop_front();
+		if (nextChunk < chunks.size())
+		{
+			launch();
+		}
+
+		if (!result.Output.empty() &&
+		    std::fwrite(result.Output.data(), 1, result.Output.size(), output) !=
+		        result.Output.size())
+		{
+			std::cerr << "cafe-iconv: write error\n";
+			exitCode = 1;
+			break;
+		}
+		replacedCount += result.ReplacedCount;
+
+		if (result.ErrorOffset)
+		{
+			std::cerr << "cafe-iconv: " << GetErrorDescription(result.ErrorCode)
+			          << " at byte offset " << chunkOffset + *result.ErrorOffset << "\n";
+			exitCode = 1;
+			break;
+		}
+		chunkOffset += chunks[i].size();
+	}
+
+	// 等待仍在进行的块
+	pending.clear();
+
+	if (replacedCount)
+	{
+		std::cerr << "cafe-iconv: " << replacedCount << " character(s) replaced\n";
+	}
+
+	if (output != stdout && std::fclose(output) != 0)
+	{
+		std::cerr << "cafe-iconv: write error\n";
+		exitCode = 1;
+	}
+
+	return exitCode;
+}
@@ -0,0 +1,69 @@
+#include <Cafe/Encoding/RuntimeCodePage.h>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+
+// 用法：RuntimeCodePageTool <映射文件> <输出文件> <代码页值> <代码页名称>
+// 映射文件格式与 https://www.unicode.org/Public/MAPPINGS/ 下的文件相同，每行为
+// "0xXX<tab>0xXXXX<tab>#注释" 或 "0xXXXX<tab>0xXXXX<tab>#注释"，未定义的编码单元将被跳过
+// 生成的文件可由 Cafe::Encoding::RuntimeEncoding::LoadCodePage 加载
+int main(int argc, char** argv)
+{
+	if (argc != 5)
+	{
+		std::cerr << "Invalid arguments";
+		return -1;
+	}
+
+	const std::string input{ argv[1] }, output{ argv[2] }, name{ argv[4] };
+	const auto codePage = std::stoul(argv[3]);
+	std::ifstream inputFile{ input };
+	if (!inputFile)
+	{
+		std::cerr << "Cannot open input file \"" << input << "\"";
+		return -2;
+	}
+
+	std::vector<std::pair<std::uint16_t, char16_t>> pairs;
+	std::string line;
+	const std::regex pattern{ R"(^\s*0x([0-9A-Fa-f]{2}|[0-9A-Fa-f]{4})\s+0x([0-9A-Fa-f]{4}))" };
+	while (std::getline(inputFile, line))
+	{
+		std::smatch match;
+		if (!std::regex_search(line, match, pattern))
+		{
+			continue;
+		}
+
+		const auto code = static_cast<std::uint16_t>(std::stoul(match[1].str(), nullptr, 16));
+		const auto codePoint = static_cast<char16_t>(std::stoul(match[2].str(), nullptr, 16));
+		// 双字节编码中 0 表示未映射，U+FFFF 在单字节编码中表示未映射
+		if ((code > 0xFF && codePoint == 0) ||
+		    codePoint == Cafe::Encoding::RuntimeEncoding::RuntimeCodePageFormat::Unmapped)
+		{
+			std::cerr << "Invalid mapping for code 0x" << match[1].str();
+			return -4;
+		}
+
+		pairs.emplace_back(code, codePoint);
+	}
+
+	const auto table = Cafe::Encoding::RuntimeEncoding::BuildRuntimeCodePageTable(
+	    static_cast<Cafe::Encoding::CodePage::CodePageType>(codePage), name, pairs);
+	if (table.empty())
+	{
+		std::cerr << "Cannot build mapping table";
+		return -5;
+	}
+
+	std::ofstream outputFile{ output, std::ios::binary };
+	if (!outputFile)
+	{
+		std::cerr << "Cannot open output file \"" << output << "\"";
+		return -3;
+	}
+
+	outputFile.write(reinterpret_cast<const char*>(table.data()),
+	                 static_cast<std::streamsize>(table.size()));
+}
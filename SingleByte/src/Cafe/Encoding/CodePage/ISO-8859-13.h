@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_ISO_8859_13_H
+#define CAFE_ENCODING_CODEPAGE_ISO_8859_13_H
+
+#include "SingleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  ISO/IEC 8859-13，波罗的海语言
+		constexpr CodePageType Iso8859_13 = static_cast<CodePageType>(28603);
+
+		namespace Detail
+		{
+			inline constexpr auto Iso8859_13ToUnicodeMapping = [] {
+				auto result = MakeEmptySingleByteToUnicodeMapping();
+#define SINGLE_BYTE_PAIR(codeUnit, codePoint) result[codeUnit] = codePoint;
+#include "Impl/ISO-8859-13Impl.h"
+				return result;
+			}();
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Iso8859_13>
+		    : Detail::SingleByteCommonPart<Iso8859_13, Detail::Iso8859_13ToUnicodeMapping>
+		{
+			static constexpr const char Name[] = "ISO-8859-13";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Iso8859_13)
+#endif
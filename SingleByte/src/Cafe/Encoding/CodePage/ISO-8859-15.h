@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_ISO_8859_15_H
+#define CAFE_ENCODING_CODEPAGE_ISO_8859_15_H
+
+#include "SingleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  ISO/IEC 8859-15，西欧语言（含欧元符号）
+		constexpr CodePageType Iso8859_15 = static_cast<CodePageType>(28605);
+
+		namespace Detail
+		{
+			inline constexpr auto Iso8859_15ToUnicodeMapping = [] {
+				auto result = MakeEmptySingleByteToUnicodeMapping();
+#define SINGLE_BYTE_PAIR(codeUnit, codePoint) result[codeUnit] = codePoint;
+#include "Impl/ISO-8859-15Impl.h"
+				return result;
+			}();
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Iso8859_15>
+		    : Detail::SingleByteCommonPart<Iso8859_15, Detail::Iso8859_15ToUnicodeMapping>
+		{
+			static constexpr const char Name[] = "ISO-8859-15";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Iso8859_15)
+#endif
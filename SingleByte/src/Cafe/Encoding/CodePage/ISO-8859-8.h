@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_ISO_8859_8_H
+#define CAFE_ENCODING_CODEPAGE_ISO_8859_8_H
+
+#include "SingleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  ISO/IEC 8859-8，希伯来字母
+		constexpr CodePageType Iso8859_8 = static_cast<CodePageType>(28598);
+
+		namespace Detail
+		{
+			inline constexpr auto Iso8859_8ToUnicodeMapping = [] {
+				auto result = MakeEmptySingleByteToUnicodeMapping();
+#define SINGLE_BYTE_PAIR(codeUnit, codePoint) result[codeUnit] = codePoint;
+#include "Impl/ISO-8859-8Impl.h"
+				return result;
+			}();
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Iso8859_8>
+		    : Detail::SingleByteCommonPart<Iso8859_8, Detail::Iso8859_8ToUnicodeMapping>
+		{
+			static constexpr const char Name[] = "ISO-8859-8";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Iso8859_8)
+#endif
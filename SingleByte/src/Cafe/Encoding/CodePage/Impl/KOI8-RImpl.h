@@ -0,0 +1,261 @@
+// This file is generated from https://www.unicode.org/Public/MAPPINGS/VENDORS/MISC/KOI8-R.TXT
+// DO NOT EDIT!
+
+SINGLE_BYTE_PAIR(0x00, 0x0000)
+SINGLE_BYTE_PAIR(0x01, 0x0001)
+SINGLE_BYTE_PAIR(0x02, 0x0002)
+SINGLE_BYTE_PAIR(0x03, 0x0003)
+SINGLE_BYTE_PAIR(0x04, 0x0004)
+SINGLE_BYTE_PAIR(0x05, 0x0005)
+SINGLE_BYTE_PAIR(0x06, 0x0006)
+SINGLE_BYTE_PAIR(0x07, 0x0007)
+SINGLE_BYTE_PAIR(0x08, 0x0008)
+SINGLE_BYTE_PAIR(0x09, 0x0009)
+SINGLE_BYTE_PAIR(0x0A, 0x000A)
+SINGLE_BYTE_PAIR(0x0B, 0x000B)
+SINGLE_BYTE_PAIR(0x0C, 0x000C)
+SINGLE_BYTE_PAIR(0x0D, 0x000D)
+SINGLE_BYTE_PAIR(0x0E, 0x000E)
+SINGLE_BYTE_PAIR(0x0F, 0x000F)
+SINGLE_BYTE_PAIR(0x10, 0x0010)
+SINGLE_BYTE_PAIR(0x11, 0x0011)
+SINGLE_BYTE_PAIR(0x12, 0x0012)
+SINGLE_BYTE_PAIR(0x13, 0x0013)
+SINGLE_BYTE_PAIR(0x14, 0x0014)
+SINGLE_BYTE_PAIR(0x15, 0x0015)
+SINGLE_BYTE_PAIR(0x16, 0x0016)
+SINGLE_BYTE_PAIR(0x17, 0x0017)
+SINGLE_BYTE_PAIR(0x18, 0x0018)
+SINGLE_BYTE_PAIR(0x19, 0x0019)
+SINGLE_BYTE_PAIR(0x1A, 0x001A)
+SINGLE_BYTE_PAIR(0x1B, 0x001B)
+SINGLE_BYTE_PAIR(0x1C, 0x001C)
+SINGLE_BYTE_PAIR(0x1D, 0x001D)
+SINGLE_BYTE_PAIR(0x1E, 0x001E)
+SINGLE_BYTE_PAIR(0x1F, 0x001F)
+SINGLE_BYTE_PAIR(0x20, 0x0020)
+SINGLE_BYTE_PAIR(0x21, 0x0021)
+SINGLE_BYTE_PAIR(0x22, 0x0022)
+SINGLE_BYTE_PAIR(0x23, 0x0023)
+SINGLE_BYTE_PAIR(0x24, 0x0024)
+SINGLE_BYTE_PAIR(0x25, 0x0025)
+SINGLE_BYTE_PAIR(0x26, 0x0026)
+SINGLE_BYTE_PAIR(0x27, 0x0027)
+SINGLE_BYTE_PAIR(0x28, 0x0028)
+SINGLE_BYTE_PAIR(0x29, 0x0029)
+SINGLE_BYTE_PAIR(0x2A, 0x002A)
+SINGLE_BYTE_PAIR(0x2B, 0x002B)
+SINGLE_BYTE_PAIR(0x2C, 0x002C)
+SINGLE_BYTE_PAIR(0x2D, 0x002D)
+SINGLE_BYTE_PAIR(0x2E, 0x002E)
+SINGLE_BYTE_PAIR(0x2F, 0x002F)
+SINGLE_BYTE_PAIR(0x30, 0x0030)
+SINGLE_BYTE_PAIR(0x31, 0x0031)
+SINGLE_BYTE_PAIR(0x32, 0x0032)
+SINGLE_BYTE_PAIR(0x33, 0x0033)
+SINGLE_BYTE_PAIR(0x34, 0x0034)
+SINGLE_BYTE_PAIR(0x35, 0x0035)
+SINGLE_BYTE_PAIR(0x36, 0x0036)
+SINGLE_BYTE_PAIR(0x37, 0x0037)
+SINGLE_BYTE_PAIR(0x38, 0x0038)
+SINGLE_BYTE_PAIR(0x39, 0x0039)
+SINGLE_BYTE_PAIR(0x3A, 0x003A)
+SINGLE_BYTE_PAIR(0x3B, 0x003B)
+SINGLE_BYTE_PAIR(0x3C, 0x003C)
+SINGLE_BYTE_PAIR(0x3D, 0x003D)
+SINGLE_BYTE_PAIR(0x3E, 0x003E)
+SINGLE_BYTE_PAIR(0x3F, 0x003F)
+SINGLE_BYTE_PAIR(0x40, 0x0040)
+SINGLE_BYTE_PAIR(0x41, 0x0041)
+SINGLE_BYTE_PAIR(0x42, 0x0042)
+SINGLE_BYTE_PAIR(0x43, 0x0043)
+SINGLE_BYTE_PAIR(0x44, 0x0044)
+SINGLE_BYTE_PAIR(0x45, 0x0045)
+SINGLE_BYTE_PAIR(0x46, 0x0046)
+SINGLE_BYTE_PAIR(0x47, 0x0047)
+SINGLE_BYTE_PAIR(0x48, 0x0048)
+SINGLE_BYTE_PAIR(0x49, 0x0049)
+SINGLE_BYTE_PAIR(0x4A, 0x004A)
+SINGLE_BYTE_PAIR(0x4B, 0x004B)
+SINGLE_BYTE_PAIR(0x4C, 0x004C)
+SINGLE_BYTE_PAIR(0x4D, 0x004D)
+SINGLE_BYTE_PAIR(0x4E, 0x004E)
+SINGLE_BYTE_PAIR(0x4F, 0x004F)
+SINGLE_BYTE_PAIR(0x50, 0x0050)
+SINGLE_BYTE_PAIR(0x51, 0x0051)
+SINGLE_BYTE_PAIR(0x52, 0x0052)
+SINGLE_BYTE_PAIR(0x53, 0x0053)
+SINGLE_BYTE_PAIR(0x54, 0x0054)
+SINGLE_BYTE_PAIR(0x55, 0x0055)
+SINGLE_BYTE_PAIR(0x56, 0x0056)
+SINGLE_BYTE_PAIR(0x57, 0x0057)
+SINGLE_BYTE_PAIR(0x58, 0x0058)
+SINGLE_BYTE_PAIR(0x59, 0x0059)
+SINGLE_BYTE_PAIR(0x5A, 0x005A)
+SINGLE_BYTE_PAIR(0x5B, 0x005B)
+SINGLE_BYTE_PAIR(0x5C, 0x005C)
+SINGLE_BYTE_PAIR(0x5D, 0x005D)
+SINGLE_BYTE_PAIR(0x5E, 0x005E)
+SINGLE_BYTE_PAIR(0x5F, 0x005F)
+SINGLE_BYTE_PAIR(0x60, 0x0060)
+SINGLE_BYTE_PAIR(0x61, 0x0061)
+SINGLE_BYTE_PAIR(0x62, 0x0062)
+SINGLE_BYTE_PAIR(0x63, 0x0063)
+SINGLE_BYTE_PAIR(0x64, 0x0064)
+SINGLE_BYTE_PAIR(0x65, 0x0065)
+SINGLE_BYTE_PAIR(0x66, 0x0066)
+SINGLE_BYTE_PAIR(0x67, 0x0067)
+SINGLE_BYTE_PAIR(0x68, 0x0068)
+SINGLE_BYTE_PAIR(0x69, 0x0069)
+SINGLE_BYTE_PAIR(0x6A, 0x006A)
+SINGLE_BYTE_PAIR(0x6B, 0x006B)
+SINGLE_BYTE_PAIR(0x6C, 0x006C)
+SINGLE_BYTE_PAIR(0x6D, 0x006D)
+SINGLE_BYTE_PAIR(0x6E, 0x006E)
+SINGLE_BYTE_PAIR(0x6F, 0x006F)
+SINGLE_BYTE_PAIR(0x70, 0x0070)
+SINGLE_BYTE_PAIR(0x71, 0x0071)
+SINGLE_BYTE_PAIR(0x72, 0x0072)
+SINGLE_BYTE_PAIR(0x73, 0x0073)
+SINGLE_BYTE_PAIR(0x74, 0x0074)
+SINGLE_BYTE_PAIR(0x75, 0x0075)
+SINGLE_BYTE_PAIR(0x76, 0x0076)
+SINGLE_BYTE_PAIR(0x77, 0x0077)
+SINGLE_BYTE_PAIR(0x78, 0x0078)
+SINGLE_BYTE_PAIR(0x79, 0x0079)
+SINGLE_BYTE_PAIR(0x7A, 0x007A)
+SINGLE_BYTE_PAIR(0x7B, 0x007B)
+SINGLE_BYTE_PAIR(0x7C, 0x007C)
+SINGLE_BYTE_PAIR(0x7D, 0x007D)
+SINGLE_BYTE_PAIR(0x7E, 0x007E)
+SINGLE_BYTE_PAIR(0x7F, 0x007F)
+SINGLE_BYTE_PAIR(0x80, 0x2500)
+SINGLE_BYTE_PAIR(0x81, 0x2502)
+SINGLE_BYTE_PAIR(0x82, 0x250C)
+SINGLE_BYTE_PAIR(0x83, 0x2510)
+SINGLE_BYTE_PAIR(0x84, 0x2514)
+SINGLE_BYTE_PAIR(0x85, 0x2518)
+SINGLE_BYTE_PAIR(0x86, 0x251C)
+SINGLE_BYTE_PAIR(0x87, 0x2524)
+SINGLE_BYTE_PAIR(0x88, 0x252C)
+SINGLE_BYTE_PAIR(0x89, 0x2534)
+SINGLE_BYTE_PAIR(0x8A, 0x253C)
+SINGLE_BYTE_PAIR(0x8B, 0x2580)
+SINGLE_BYTE_PAIR(0x8C, 0x2584)
+SINGLE_BYTE_PAIR(0x8D, 0x2588)
+SINGLE_BYTE_PAIR(0x8E, 0x258C)
+SINGLE_BYTE_PAIR(0x8F, 0x2590)
+SINGLE_BYTE_PAIR(0x90, 0x2591)
+SINGLE_BYTE_PAIR(0x91, 0x2592)
+SINGLE_BYTE_PAIR(0x92, 0x2593)
+SINGLE_BYTE_PAIR(0x93, 0x2320)
+SINGLE_BYTE_PAIR(0x94, 0x25A0)
+SINGLE_BYTE_PAIR(0x95, 0x2219)
+SINGLE_BYTE_PAIR(0x96, 0x221A)
+SINGLE_BYTE_PAIR(0x97, 0x2248)
+SINGLE_BYTE_PAIR(0x98, 0x2264)
+SINGLE_BYTE_PAIR(0x99, 0x2265)
+SINGLE_BYTE_PAIR(0x9A, 0x00A0)
+SINGLE_BYTE_PAIR(0x9B, 0x2321)
+SINGLE_BYTE_PAIR(0x9C, 0x00B0)
+SINGLE_BYTE_PAIR(0x9D, 0x00B2)
+SINGLE_BYTE_PAIR(0x9E, 0x00B7)
+SINGLE_BYTE_PAIR(0x9F, 0x00F7)
+SINGLE_BYTE_PAIR(0xA0, 0x2550)
+SINGLE_BYTE_PAIR(0xA1, 0x2551)
+SINGLE_BYTE_PAIR(0xA2, 0x2552)
+SINGLE_BYTE_PAIR(0xA3, 0x0451)
+SINGLE_BYTE_PAIR(0xA4, 0x2553)
+SINGLE_BYTE_PAIR(0xA5, 0x2554)
+SINGLE_BYTE_PAIR(0xA6, 0x2555)
+SINGLE_BYTE_PAIR(0xA7, 0x2556)
+SINGLE_BYTE_PAIR(0xA8, 0x2557)
+SINGLE_BYTE_PAIR(0xA9, 0x2558)
+SINGLE_BYTE_PAIR(0xAA, 0x2559)
+SINGLE_BYTE_PAIR(0xAB, 0x255A)
+SINGLE_BYTE_PAIR(0xAC, 0x255B)
+SINGLE_BYTE_PAIR(0xAD, 0x255C)
+SINGLE_BYTE_PAIR(0xAE, 0x255D)
+SINGLE_BYTE_PAIR(0xAF, 0x255E)
+SINGLE_BYTE_PAIR(0xB0, 0x255F)
+SINGLE_BYTE_PAIR(0xB1, 0x2560)
+SINGLE_BYTE_PAIR(0xB2, 0x2561)
+SINGLE_BYTE_PAIR(0xB3, 0x0401)
+SINGLE_BYTE_PAIR(0xB4, 0x2562)
+SINGLE_BYTE_PAIR(0xB5, 0x2563)
+SINGLE_BYTE_PAIR(0xB6, 0x2564)
+SINGLE_BYTE_PAIR(0xB7, 0x2565)
+SINGLE_BYTE_PAIR(0xB8, 0x2566)
+SINGLE_BYTE_PAIR(0xB9, 0x2567)
+SINGLE_BYTE_PAIR(0xBA, 0x2568)
+SINGLE_BYTE_PAIR(0xBB, 0x2569)
+SINGLE_BYTE_PAIR(0xBC, 0x256A)
+SINGLE_BYTE_PAIR(0xBD, 0x256B)
+SINGLE_BYTE_PAIR(0xBE, 0x256C)
+SINGLE_BYTE_PAIR(0xBF, 0x00A9)
+SINGLE_BYTE_PAIR(0xC0, 0x044E)
+SINGLE_BYTE_PAIR(0xC1, 0x0430)
+SINGLE_BYTE_PAIR(0xC2, 0x0431)
+SINGLE_BYTE_PAIR(0xC3, 0x0446)
+SINGLE_BYTE_PAIR(0xC4, 0x0434)
+SINGLE_BYTE_PAIR(0xC5, 0x0435)
+SINGLE_BYTE_PAIR(0xC6, 0x0444)
+SINGLE_BYTE_PAIR(0xC7, 0x0433)
+SINGLE_BYTE_PAIR(0xC8, 0x0445)
+SINGLE_BYTE_PAIR(0xC9, 0x0438)
+SINGLE_BYTE_PAIR(0xCA, 0x0439)
+SINGLE_BYTE_PAIR(0xCB, 0x043A)
+SINGLE_BYTE_PAIR(0xCC, 0x043B)
+SINGLE_BYTE_PAIR(0xCD, 0x043C)
+SINGLE_BYTE_PAIR(0xCE, 0x043D)
+SINGLE_BYTE_PAIR(0xCF, 0x043E)
+SINGLE_BYTE_PAIR(0xD0, 0x043F)
+SINGLE_BYTE_PAIR(0xD1, 0x044F)
+SINGLE_BYTE_PAIR(0xD2, 0x0440)
+SINGLE_BYTE_PAIR(0xD3, 0x0441)
+SINGLE_BYTE_PAIR(0xD4, 0x0442)
+SINGLE_BYTE_PAIR(0xD5, 0x0443)
+SINGLE_BYTE_PAIR(0xD6, 0x0436)
+SINGLE_BYTE_PAIR(0xD7, 0x0432)
+SINGLE_BYTE_PAIR(0xD8, 0x044C)
+SINGLE_BYTE_PAIR(0xD9, 0x044B)
+SINGLE_BYTE_PAIR(0xDA, 0x0437)
+SINGLE_BYTE_PAIR(0xDB, 0x0448)
+SINGLE_BYTE_PAIR(0xDC, 0x044D)
+SINGLE_BYTE_PAIR(0xDD, 0x0449)
+SINGLE_BYTE_PAIR(0xDE, 0x0447)
+SINGLE_BYTE_PAIR(0xDF, 0x044A)
+SINGLE_BYTE_PAIR(0xE0, 0x042E)
+SINGLE_BYTE_PAIR(0xE1, 0x0410)
+SINGLE_BYTE_PAIR(0xE2, 0x0411)
+SINGLE_BYTE_PAIR(0xE3, 0x0426)
+SINGLE_BYTE_PAIR(0xE4, 0x0414)
+SINGLE_BYTE_PAIR(0xE5, 0x0415)
+SINGLE_BYTE_PAIR(0xE6, 0x0424)
+SINGLE_BYTE_PAIR(0xE7, 0x0413)
+SINGLE_BYTE_PAIR(0xE8, 0x0425)
+SINGLE_BYTE_PAIR(0xE9, 0x0418)
+SINGLE_BYTE_PAIR(0xEA, 0x0419)
+SINGLE_BYTE_PAIR(0xEB, 0x041A)
+SINGLE_BYTE_PAIR(0xEC, 0x041B)
+SINGLE_BYTE_PAIR(0xED, 0x041C)
+SINGLE_BYTE_PAIR(0xEE, 0x041D)
+SINGLE_BYTE_PAIR(0xEF, 0x041E)
+SINGLE_BYTE_PAIR(0xF0, 0x041F)
+SINGLE_BYTE_PAIR(0xF1, 0x042F)
+SINGLE_BYTE_PAIR(0xF2, 0x0420)
+SINGLE_BYTE_PAIR(0xF3, 0x0421)
+SINGLE_BYTE_PAIR(0xF4, 0x0422)
+SINGLE_BYTE_PAIR(0xF5, 0x0423)
+SINGLE_BYTE_PAIR(0xF6, 0x0416)
+SINGLE_BYTE_PAIR(0xF7, 0x0412)
+SINGLE_BYTE_PAIR(0xF8, 0x042C)
+SINGLE_BYTE_PAIR(0xF9, 0x042B)
+SINGLE_BYTE_PAIR(0xFA, 0x0417)
+SINGLE_BYTE_PAIR(0xFB, 0x0428)
+SINGLE_BYTE_PAIR(0xFC, 0x042D)
+SINGLE_BYTE_PAIR(0xFD, 0x0429)
+SINGLE_BYTE_PAIR(0xFE, 0x0427)
+SINGLE_BYTE_PAIR(0xFF, 0x042A)
+
+#undef SINGLE_BYTE_PAIR
@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_KOI8_R_H
+#define CAFE_ENCODING_CODEPAGE_KOI8_R_H
+
+#include "SingleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  KOI8-R，俄语西里尔字母
+		constexpr CodePageType Koi8R = static_cast<CodePageType>(20866);
+
+		namespace Detail
+		{
+			inline constexpr auto Koi8RToUnicodeMapping = [] {
+				auto result = MakeEmptySingleByteToUnicodeMapping();
+#define SINGLE_BYTE_PAIR(codeUnit, codePoint) result[codeUnit] = codePoint;
+#include "Impl/KOI8-RImpl.h"
+				return result;
+			}();
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Koi8R>
+		    : Detail::SingleByteCommonPart<Koi8R, Detail::Koi8RToUnicodeMapping>
+		{
+			static constexpr const char Name[] = "KOI8-R";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Koi8R)
+#endif
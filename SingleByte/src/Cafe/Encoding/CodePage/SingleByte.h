@@ -0,0 +1,246 @@
+#ifndef CAFE_ENCODING_CODEPAGE_SINGLE_BYTE_H
+#define CAFE_ENCODING_CODEPAGE_SINGLE_BYTE_H
+
+#include <Cafe/Encoding/Encode.h>
+#include <Cafe/Encoding/Strings.h>
+#include <array>
+#include <cstdint>
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		namespace Detail
+		{
+			/// @brief  单字节代码页中表示未映射的码点
+			/// @remark U+FFFF 是非字符，不会出现在任何映射文件中
+			constexpr char16_t SingleByteUnmapped = 0xFFFF;
+
+			/// @brief  单字节代码页到 Unicode 的映射表，index 是编码单元
+			using SingleByteToUnicodeMapping = std::array<char16_t, 256>;
+
+			/// @brief  生成所有编码单元均未映射的映射表，以便由映射文件填充
+			[[nodiscard]] constexpr SingleByteToUnicodeMapping
+			MakeEmptySingleByteToUnicodeMapping() noexcept
+			{
+				SingleByteToUnicodeMapping result{};
+				result.fill(SingleByteUnmapped);
+				return result;
+			}
+
+			/// @brief  计算反向映射表需要的页数，第 0 页保留为全部未映射
+			[[nodiscard]] constexpr std::size_t
+			CountSingleByteReversePages(SingleByteToUnicodeMapping const& mapping) noexcept
+			{
+				std::array<bool, 256> used{};
+				std::size_t count = 1;
+				for (const auto codePoint : mapping)
+				{
+					if (codePoint != SingleByteUnmapped && !used[codePoint >> 8])
+					{
+						used[codePoint >> 8] = true;
+						++count;
+					}
+				}
+				return count;
+			}
+
+			/// @brief  紧凑的两级反向映射表
+			/// @remark 码点的高 8 位索引 PageIndex 得到页号，低 8 位在页内索引得到候选编码单元，
+			///         候选编码单元需经正向映射表验证，因此未使用的位置可以直接填 0
+			template <std::size_t PageCount>
+			struct SingleByteFromUnicodeMapping
+			{
+				std::array<std::uint8_t, 256> PageIndex;
+				std::array<std::array<std::uint8_t, 256>, PageCount> Pages;
+			};
+
+			template <std::size_t PageCount>
+			[[nodiscard]] constexpr SingleByteFromUnicodeMapping<PageCount>
+			MakeSingleByteFromUnicodeMapping(SingleByteToUnicodeMapping const& mapping) noexcept
+			{
+				SingleByteFromUnicodeMapping<PageCount> result{};
+				std::size_t nextPage = 1;
+				for (std::size_t i = 0; i < mapping.size(); ++i)
+				{
+					const auto codePoint = mapping[i];
+					if (codePoint == SingleByteUnmapped)
+					{
+						continue;
+					}
+
+					auto& page = result.PageIndex[codePoint >> 8];
+					if (!page)
+					{
+						page = static_cast<std::uint8_t>(nextPage++);
+					}
+					result.Pages[page][codePoint & 0xFF] = static_cast<std::uint8_t>(i);
+				}
+				return result;
+			}
+
+			/// @brief  由映射表驱动的单字节代码页的通用部分
+			/// @remark 各代码页的映射表由 tools/SingleByteMappingTool.cpp 从 Unicode
+			///         提供的映射文件生成
+			template <CodePageType SingleByteCodePage, SingleByteToUnicodeMapping const& Mapping>
+			struct SingleByteCommonPart
+			{
+			private:
+				static constexpr auto FromUnicodeMapping =
+				    MakeSingleByteFromUnicodeMapping<CountSingleByteReversePages(Mapping)>(Mapping);
+
+			public:
+				using CharType = char;
+
+				static constexpr bool IsVariableWidth = false;
+
+				/// @brief  获取编码单元对应的码点，未映射时返回 SingleByteUnmapped
+				/// @remark 用于批量转换时绕过接收器直接查表
+				[[nodiscard]] static constexpr char16_t LookupCodePoint(CharType codeUnit) noexcept
+				{
+					return Mapping[static_cast<unsigned char>(codeUnit)];
+				}
+
+				template <typename OutputReceiver>
+				static constexpr void ToCodePoint(CharType codeUnit, OutputReceiver&& receiver)
+				{
+					const auto codePoint = LookupCodePoint(codeUnit);
+					if (codePoint == SingleByteUnmapped)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<SingleByteCodePage, CodePoint,
+						                   EncodingResultCode::Reject>{});
+					}
+					else
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<SingleByteCodePage, CodePoint,
+						                   EncodingResultCode::Accept>{
+						        static_cast<CodePointType>(codePoint) });
+					}
+				}
+
+				template <typename OutputReceiver>
+				static constexpr void FromCodePoint(CodePointType codePoint,
+				                                    OutputReceiver&& receiver)
+				{
+					if (codePoint <= 0xFFFF)
+					{
+						const auto page = FromUnicodeMapping.PageIndex[codePoint >> 8];
+						const auto codeUnit = FromUnicodeMapping.Pages[page][codePoint & 0xFF];
+						if (Mapping[codeUnit] == codePoint)
+						{
+							std::forward<OutputReceiver>(receiver)(
+							    EncodingResult<CodePoint, SingleByteCodePage,
+							                   EncodingResultCode::Accept>{
+							        static_cast<CharType>(codeUnit) });
+							return;
+						}
+					}
+
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<CodePoint, SingleByteCodePage, EncodingResultCode::Reject>{});
+				}
+			};
+
+			template <CodePageType CodePageValue>
+			concept IsSingleByteCodePage = requires(char codeUnit)
+			{
+				{
+					CodePageTrait<CodePageValue>::LookupCodePoint(codeUnit)
+					} -> std::same_as<char16_t>;
+			};
+		} // namespace Detail
+	}     // namespace CodePage
+
+	/// @brief  单字节代码页作为来源的编码器
+	/// @remark 直接查表获得码点，并且每次处理 4 个编码单元以便查表可以并行进行
+	template <CodePage::CodePageType FromCodePageValue, CodePage::CodePageType ToCodePageValue>
+	requires CodePage::Detail::IsSingleByteCodePage<FromCodePageValue> &&
+	    (FromCodePageValue != ToCodePageValue) struct Encoder<FromCodePageValue, ToCodePageValue>
+	{
+		using Trait = CodePage::CodePageTrait<FromCodePageValue>;
+		using CharType = typename Trait::CharType;
+
+		template <typename OutputReceiver>
+		static constexpr void Encode(CharType encodeUnit, OutputReceiver&& receiver)
+		{
+			EncoderBase<FromCodePageValue, ToCodePageValue>::Encode(
+			    encodeUnit, std::forward<OutputReceiver>(receiver));
+		}
+
+		template <std::size_t Extent, typename OutputReceiver>
+		static constexpr void EncodeAll(std::span<const CharType, Extent> const& span,
+		                                OutputReceiver&& receiver)
+		{
+			constexpr std::size_t BlockSize = 4;
+
+			// 返回 false 表示需要终止
+			const auto emit = [&](char16_t codePoint) constexpr {
+				if (codePoint == CodePage::Detail::SingleByteUnmapped)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<FromCodePageValue, ToCodePageValue,
+					                   EncodingResultCode::Reject>{});
+					return false;
+				}
+
+				bool shouldContinue = true;
+				EncoderBase<CodePage::CodePoint, ToCodePageValue>::Encode(
+				    static_cast<CodePointType>(codePoint), [&](auto const& result) {
+					    using ResultType =
+					        EncodingResult<FromCodePageValue, ToCodePageValue,
+					                       GetEncodingResultCode<decltype(result)>>;
+					    if constexpr (GetEncodingResultCode<decltype(result)> !=
+					                  EncodingResultCode::Accept)
+					    {
+						    shouldContinue = false;
+					    }
+
+					    if constexpr (Core::Misc::IsCallableReturningControlFlow<
+					                      OutputReceiver, ResultType const&>::value)
+					    {
+						    if (std::forward<OutputReceiver>(receiver)(ResultType{ result })
+						            .IsBreak())
+						    {
+							    shouldContinue = false;
+						    }
+					    }
+					    else
+					    {
+						    std::forward<OutputReceiver>(receiver)(ResultType{ result });
+					    }
+				    });
+				return shouldContinue;
+			};
+
+			const auto data = span.data();
+			const auto size = span.size();
+			std::size_t i = 0;
+			for (; i + BlockSize <= size; i += BlockSize)
+			{
+				const char16_t codePoints[BlockSize]{
+					Trait::LookupCodePoint(data[i]), Trait::LookupCodePoint(data[i + 1]),
+					Trait::LookupCodePoint(data[i + 2]), Trait::LookupCodePoint(data[i + 3])
+				};
+				for (const auto codePoint : codePoints)
+				{
+					if (!emit(codePoint))
+					{
+						return;
+					}
+				}
+			}
+
+			for (; i < size; ++i)
+			{
+				if (!emit(Trait::LookupCodePoint(data[i])))
+				{
+					return;
+				}
+			}
+		}
+	};
+} // namespace Cafe::Encoding
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CAFE_ENCODING_CODEPAGE_WINDOWS_1252_H
+#define CAFE_ENCODING_CODEPAGE_WINDOWS_1252_H
+
+#include "SingleByte.h"
+
+namespace Cafe::Encoding
+{
+	namespace CodePage
+	{
+		/// @brief  Windows 西欧语言代码页
+		constexpr CodePageType Windows1252 = static_cast<CodePageType>(1252);
+
+		namespace Detail
+		{
+			inline constexpr auto Windows1252ToUnicodeMapping = [] {
+				auto result = MakeEmptySingleByteToUnicodeMapping();
+#define SINGLE_BYTE_PAIR(codeUnit, codePoint) result[codeUnit] = codePoint;
+#include "Impl/Windows-1252Impl.h"
+				return result;
+			}();
+		} // namespace Detail
+
+		template <>
+		struct CodePageTrait<Windows1252>
+		    : Detail::SingleByteCommonPart<Windows1252, Detail::Windows1252ToUnicodeMapping>
+		{
+			static constexpr const char Name[] = "Windows-1252";
+		};
+	} // namespace CodePage
+} // namespace Cafe::Encoding
+
+#endif
+
+#ifdef CAFE_CODEPAGE
+CAFE_CODEPAGE(::Cafe::Encoding::CodePage::Windows1252)
+#endif
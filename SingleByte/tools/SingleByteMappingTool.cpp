@@ -0,0 +1,72 @@
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+
+constexpr const char Epilogue[] =
+    R"(
+#undef SINGLE_BYTE_PAIR
+)";
+
+// 用法：SingleByteMappingTool <映射文件> <输出文件> [映射文件来源]
+// 映射文件格式与 https://www.unicode.org/Public/MAPPINGS/ 下的文件相同，每行为
+// "0xXX<tab>0xXXXX<tab>#注释"，未定义的编码单元将被跳过
+int main(int argc, char** argv)
+{
+	if (argc != 3 && argc != 4)
+	{
+		std::cerr << "Invalid arguments";
+		return -1;
+	}
+
+	const std::string input{ argv[1] }, output{ argv[2] };
+	const std::string source{ argc == 4 ? argv[3] : input };
+	std::ifstream inputFile{ input };
+	if (!inputFile)
+	{
+		std::cerr << "Cannot open input file \"" << input << "\"";
+		return -2;
+	}
+
+	std::ofstream outputFile{ output };
+	if (!outputFile)
+	{
+		std::cerr << "Cannot open output file \"" << output << "\"";
+		return -3;
+	}
+
+	outputFile << "// This file is generated from " << source << "\n// DO NOT EDIT!\n\n";
+
+	std::string line;
+	const std::regex pattern{ R"(^\s*0x([0-9A-Fa-f]{2})\s+0x([0-9A-Fa-f]{4}))" };
+	while (std::getline(inputFile, line))
+	{
+		std::smatch match;
+		if (!std::regex_search(line, match, pattern))
+		{
+			continue;
+		}
+
+		auto codeUnit = match[1].str();
+		auto codePoint = match[2].str();
+		for (auto& ch : codeUnit)
+		{
+			ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+		}
+		for (auto& ch : codePoint)
+		{
+			ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+		}
+
+		// U+FFFF 用于表示未映射
+		if (codePoint == "FFFF")
+		{
+			std::cerr << "Invalid mapping for code unit 0x" << codeUnit;
+			return -4;
+		}
+
+		outputFile << "SINGLE_BYTE_PAIR(0x" << codeUnit << ", 0x" << codePoint << ")\n";
+	}
+
+	outputFile << Epilogue;
+}
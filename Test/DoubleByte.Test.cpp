@@ -0,0 +1,163 @@
+#include <Cafe/Encoding/CodePage/Big5.h>
+#include <Cafe/Encoding/CodePage/EUC-KR.h>
+#include <Cafe/Encoding/CodePage/Shift_JIS.h>
+#include <catch2/catch_all.hpp>
+#include <cstring>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	template <CodePage::CodePageType CodePageValue>
+	bool CheckFromCodePoint(CodePointType codePoint, std::span<const char> expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePageValue>::FromCodePoint(codePoint, [&](auto const& result) {
+			if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			{
+				succeed = result.Result.size() == expected.size() &&
+				          std::memcmp(result.Result.data(), expected.data(), expected.size()) == 0;
+			}
+		});
+		return succeed;
+	}
+
+	template <CodePage::CodePageType CodePageValue>
+	bool CheckToCodePoint(std::span<const char> src, CodePointType expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePageValue>::ToCodePoint(src, [&](auto const& result) {
+			if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			{
+				succeed = result.AdvanceCount == src.size() && result.Result == expected;
+			}
+		});
+		return succeed;
+	}
+
+	/// @brief  检查所有可解码的双字节编码解码后再编码可得到相同的码点，返回可解码的编码数量
+	template <CodePage::CodePageType CodePageValue>
+	std::size_t CheckRoundTrip()
+	{
+		std::size_t mappedCount{};
+		for (unsigned firstUnit = 0x81; firstUnit <= 0xFE; ++firstUnit)
+		{
+			for (unsigned secondUnit = 0x40; secondUnit <= 0xFE; ++secondUnit)
+			{
+				const char src[]{ static_cast<char>(firstUnit), static_cast<char>(secondUnit) };
+				CodePage::CodePageTrait<CodePageValue>::ToCodePoint(
+				    std::span(src), [&](auto const& result) {
+					    if constexpr (GetEncodingResultCode<decltype(result)> ==
+					                  EncodingResultCode::Accept)
+					    {
+						    if (result.AdvanceCount != 2)
+						    {
+							    return;
+						    }
+
+						    ++mappedCount;
+						    CodePage::CodePageTrait<CodePageValue>::FromCodePoint(
+						        result.Result, [&](auto const& encodeResult) {
+							        if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+							                      EncodingResultCode::Accept)
+							        {
+								        REQUIRE(CheckToCodePoint<CodePageValue>(
+								            encodeResult.Result, result.Result));
+							        }
+							        else
+							        {
+								        REQUIRE(false);
+							        }
+						        });
+					    }
+				    });
+			}
+		}
+		return mappedCount;
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.DoubleByte", "[Encoding][DoubleByte]")
+{
+	SECTION("Shift_JIS")
+	{
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x3042, std::span("\x82\xA0", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\x82\xA0", 2), 0x3042));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0xFF71, std::span("\xB1", 1)));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xB1", 1), 0xFF71));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x0000, std::span("\0", 1)));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\x87\x54", 2), 0x2160));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x2160, std::span("\x87\x54", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xFA\x4A", 2), 0x2160));
+		// NEC 选定 IBM 扩展文字与 IBM 扩展文字重复时编码为后者
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xEE\xEF", 2), 0x2170));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xFA\x40", 2), 0x2170));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x2170, std::span("\xFA\x40", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xED\x40", 2), 0x7E8A));
+		REQUIRE(CheckToCodePoint<CodePage::ShiftJis>(std::span("\xFA\x5C", 2), 0x7E8A));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x7E8A, std::span("\xFA\x5C", 2)));
+		// 第 13 区及 JIS X 0208 中的文字仍优先于 IBM 扩展文字
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x3231, std::span("\x87\x8A", 2)));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0x2235, std::span("\x81\xE6", 2)));
+		REQUIRE(CheckFromCodePoint<CodePage::ShiftJis>(0xFFE2, std::span("\x81\xCA", 2)));
+
+		REQUIRE(CodePage::CodePageTrait<CodePage::ShiftJis>::GetWidth('\x82') == 2);
+		REQUIRE(CodePage::CodePageTrait<CodePage::ShiftJis>::GetWidth('\xB1') == 1);
+
+		CodePage::CodePageTrait<CodePage::ShiftJis>::ToCodePoint(
+		    std::span("\x82", 1), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Incomplete);
+		    });
+		CodePage::CodePageTrait<CodePage::ShiftJis>::ToCodePoint(
+		    std::span("\xA0", 1), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+
+		REQUIRE(CheckRoundTrip<CodePage::ShiftJis>() == 9604);
+	}
+
+	SECTION("Big5")
+	{
+		REQUIRE(CheckFromCodePoint<CodePage::Big5>(0x4E2D, std::span("\xA4\xA4", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::Big5>(std::span("\xA4\xA4", 2), 0x4E2D));
+		REQUIRE(CheckToCodePoint<CodePage::Big5>(std::span("\xA2\xCC", 2), 0x5341));
+		REQUIRE(CheckFromCodePoint<CodePage::Big5>(0x5341, std::span("\xA4\x51", 2)));
+		REQUIRE(CheckFromCodePoint<CodePage::Big5>(0x20AC, std::span("\xA3\xE1", 2)));
+
+		CodePage::CodePageTrait<CodePage::Big5>::ToCodePoint(
+		    std::span("\xA4\x7F", 2), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+
+		REQUIRE(CheckRoundTrip<CodePage::Big5>() == 13752);
+	}
+
+	SECTION("EUC-KR")
+	{
+		REQUIRE(CheckFromCodePoint<CodePage::EucKr>(0xD55C, std::span("\xC7\xD1", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::EucKr>(std::span("\xC7\xD1", 2), 0xD55C));
+		REQUIRE(CheckFromCodePoint<CodePage::EucKr>(0xAC02, std::span("\x81\x41", 2)));
+		REQUIRE(CheckToCodePoint<CodePage::EucKr>(std::span("\x41", 1), 0x41));
+
+		REQUIRE(CheckRoundTrip<CodePage::EucKr>() == 17048);
+	}
+
+	SECTION("Encode all")
+	{
+		std::u32string result;
+		Encoder<CodePage::ShiftJis, CodePage::CodePoint>::EncodeAll(
+		    std::span("\x93\xFA\x96\x7B\x8C\xEA abc\xB1", 11), [&](auto const& encodeResult) {
+			    if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+			                  EncodingResultCode::Accept)
+			    {
+				    result.push_back(encodeResult.Result);
+			    }
+			    else
+			    {
+				    REQUIRE(false);
+			    }
+		    });
+		REQUIRE(result == U"日本語 abcｱ");
+	}
+}
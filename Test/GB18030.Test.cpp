@@ -0,0 +1,158 @@
+#include <Cafe/Encoding/CodePage/GB18030.h>
+#include <catch2/catch_all.hpp>
+#include <cstring>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	bool CheckFromCodePoint(CodePointType codePoint, std::span<const char> expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePage::GB18030>::FromCodePoint(
+		    codePoint, [&](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    succeed = result.Result.size() == expected.size() &&
+				              std::memcmp(result.Result.data(), expected.data(), expected.size()) == 0;
+			    }
+		    });
+		return succeed;
+	}
+
+	bool CheckToCodePoint(std::span<const char> src, CodePointType expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePage::GB18030>::ToCodePoint(src, [&](auto const& result) {
+			if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			{
+				succeed = result.AdvanceCount == src.size() && result.Result == expected;
+			}
+		});
+		return succeed;
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.GB18030", "[Encoding][GB18030]")
+{
+	SECTION("Two-byte sequences")
+	{
+		// 与 GB2312 共享的部分
+		REQUIRE(CheckFromCodePoint(0x6D4B, std::span("\xB2\xE2", 2)));
+		REQUIRE(CheckToCodePoint(std::span("\xB2\xE2", 2), 0x6D4B));
+
+		// CP936 未映射的部分
+		REQUIRE(CheckFromCodePoint(0x20AC, std::span("\xA2\xE3", 2)));
+		REQUIRE(CheckToCodePoint(std::span("\xA2\xE3", 2), 0x20AC));
+		REQUIRE(CheckFromCodePoint(0x1E3F, std::span("\xA8\xBC", 2)));
+		REQUIRE(CheckToCodePoint(std::span("\xFE\x51", 2), 0xE816));
+
+		// 用户自定义区
+		REQUIRE(CheckFromCodePoint(0xE000, std::span("\xAA\xA1", 2)));
+		REQUIRE(CheckToCodePoint(std::span("\xA1\x80", 2), 0xE4C6 + 0x3F));
+	}
+
+	SECTION("Four-byte sequences")
+	{
+		REQUIRE(CheckFromCodePoint(0x0080, std::span("\x81\x30\x81\x30", 4)));
+		REQUIRE(CheckFromCodePoint(0x00A5, std::span("\x81\x30\x84\x36", 4)));
+		REQUIRE(CheckToCodePoint(std::span("\x81\x30\x84\x36", 4), 0x00A5));
+		REQUIRE(CheckFromCodePoint(0xE7C7, std::span("\x81\x35\xF4\x37", 4)));
+		REQUIRE(CheckToCodePoint(std::span("\x81\x35\xF4\x37", 4), 0xE7C7));
+		REQUIRE(CheckFromCodePoint(0xFFFF, std::span("\x84\x31\xA4\x39", 4)));
+		REQUIRE(CheckFromCodePoint(0x10000, std::span("\x90\x30\x81\x30", 4)));
+		REQUIRE(CheckToCodePoint(std::span("\xE3\x32\x9A\x35", 4), 0x10FFFF));
+	}
+
+	SECTION("Invalid sequences")
+	{
+		CodePage::CodePageTrait<CodePage::GB18030>::ToCodePoint(
+		    std::span("\x80", 1), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+		CodePage::CodePageTrait<CodePage::GB18030>::ToCodePoint(
+		    std::span("\x84\x31\xA5\x30", 4), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+		CodePage::CodePageTrait<CodePage::GB18030>::ToCodePoint(
+		    std::span("\x81\x30", 2), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Incomplete);
+		    });
+	}
+
+	SECTION("Find at character boundary")
+	{
+		// 81 30 81 30 为 U+0080，位置 2 的 81 30 82 30 跨越两个四字节字符
+		const StringView<CodePage::GB18030> str{ std::span<const char>(
+			"\x81\x30\x81\x30\x82\x30\x81\x30", 8) };
+		const StringView<CodePage::GB18030> crossing{ std::span<const char>("\x81\x30\x82\x30",
+			                                                                 4) };
+		REQUIRE(str.Find(crossing) == 2);
+		REQUIRE(str.FindChar(crossing) == StringView<CodePage::GB18030>::Npos);
+		REQUIRE(str.FindCodePoint(0x008A) == StringView<CodePage::GB18030>::Npos);
+		REQUIRE(str.FindCodePoint(0x0080) == 0);
+
+		const StringView<CodePage::GB18030> second{ std::span<const char>("\x82\x30\x81\x30", 4) };
+		REQUIRE(str.FindChar(second) == 4);
+	}
+
+	SECTION("Round trip")
+	{
+		std::size_t failedCount{};
+		for (CodePointType codePoint = 0; codePoint <= MaxValidCodePoint; ++codePoint)
+		{
+			if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+			{
+				continue;
+			}
+
+			CodePage::CodePageTrait<CodePage::GB18030>::FromCodePoint(
+			    codePoint, [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    if (!CheckToCodePoint(result.Result, codePoint))
+					    {
+						    ++failedCount;
+					    }
+				    }
+				    else
+				    {
+					    ++failedCount;
+				    }
+			    });
+		}
+		REQUIRE(failedCount == 0);
+
+		// 所有双字节编码均有对应码点
+		for (unsigned firstUnit = 0x81; firstUnit <= 0xFE; ++firstUnit)
+		{
+			for (unsigned secondUnit = 0x40; secondUnit <= 0xFE; ++secondUnit)
+			{
+				if (secondUnit == 0x7F)
+				{
+					continue;
+				}
+
+				const char src[]{ static_cast<char>(firstUnit), static_cast<char>(secondUnit) };
+				CodePage::CodePageTrait<CodePage::GB18030>::ToCodePoint(
+				    std::span(src), [&](auto const& result) {
+					    if constexpr (GetEncodingResultCode<decltype(result)> ==
+					                  EncodingResultCode::Accept)
+					    {
+						    if (!CheckFromCodePoint(result.Result, src))
+						    {
+							    ++failedCount;
+						    }
+					    }
+					    else
+					    {
+						    ++failedCount;
+					    }
+				    });
+			}
+		}
+		REQUIRE(failedCount == 0);
+	}
+}
@@ -1,6 +1,9 @@
 #include <Cafe/Encoding/CodePage/GB2312.h>
+#include <Cafe/Encoding/Strings.h>
 #include <catch2/catch_all.hpp>
 #include <cstring>
+#include <string>
+#include <string_view>
 
 using namespace Cafe;
 using namespace Encoding;
@@ -34,4 +37,66 @@ TEST_CASE("Cafe.Encoding.GB2312", "[Encoding][GB2312]")
 			    }
 		    });
 	}
+
+	SECTION("Backward")
+	{
+		const auto getLastWidth = [](std::string_view str) {
+			std::size_t width = 0;
+			CodePage::CodePageTrait<CodePage::GB2312>::ToCodePointBackward(
+			    std::span(str.data(), str.size()), [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    width = result.AdvanceCount;
+				    }
+			    });
+			return width;
+		};
+
+		REQUIRE(getLastWidth("\xB2\xE2") == 2);
+		REQUIRE(getLastWidth("\xB2\xE2" "a") == 1);
+		// 0x41 ('A') 作为后尾编码单元
+		REQUIRE(getLastWidth("a\x81\x41") == 2);
+		REQUIRE(getLastWidth("\xB2\xE2\x81\x41") == 2);
+		REQUIRE(getLastWidth("\x81\x41" "A") == 1);
+		// 结尾是首位编码单元
+		REQUIRE(getLastWidth("\xB2\xE2\xB2") == 0);
+
+		// 超出向前检查的范围时按双字节字符处理
+		std::string longStr;
+		for (std::size_t i = 0; i < CodePage::CodePageTrait<CodePage::GB2312>::MaxResyncLength; ++i)
+		{
+			longStr += "\xB2\xE2";
+		}
+		REQUIRE(getLastWidth(longStr) == 2);
+		REQUIRE(getLastWidth(longStr + "a") == 1);
+	}
+
+	SECTION("Find at character boundary")
+	{
+		// "啊" 为 B0 A1，位置 1 的 A1 A1 跨越字符边界
+		const StringView<CodePage::GB2312> str{ std::span<const char>("\xB0\xA1\xA1\xA1", 4) };
+		const StringView<CodePage::GB2312> pattern{ std::span<const char>("\xA1\xA1", 2) };
+		REQUIRE(str.Find(pattern) == 1);
+		REQUIRE(str.FindChar(pattern) == 2);
+
+		const StringView<CodePage::GB2312> crossingOnly{ std::span<const char>(
+			"x\xB0\xA1\xB0\xA1", 5) };
+		const StringView<CodePage::GB2312> crossingPattern{ std::span<const char>("\xA1\xB0",
+			                                                                      2) };
+		REQUIRE(crossingOnly.Find(crossingPattern) == 2);
+		REQUIRE(crossingOnly.FindChar(crossingPattern) == StringView<CodePage::GB2312>::Npos);
+
+		REQUIRE(crossingOnly.FindCodePoint(0x554A) == 1);
+		REQUIRE(crossingOnly.FindCodePoint(U'x') == 0);
+		REQUIRE(crossingOnly.FindCodePoint(0x1F600) == StringView<CodePage::GB2312>::Npos);
+
+		// 以其他代码页表示的模式串仅编码一次
+		const CodePointType codePoints[] = { 0x554A, 0x554A };
+		REQUIRE(crossingOnly.FindChar(StringView<CodePage::CodePoint>{ std::span(codePoints) }) ==
+		        1);
+		const CodePointType unencodable[] = { 0x1F600 };
+		REQUIRE(crossingOnly.FindChar(StringView<CodePage::CodePoint>{ std::span(unencodable) }) ==
+		        StringView<CodePage::GB2312>::Npos);
+	}
 }
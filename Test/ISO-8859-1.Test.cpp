@@ -0,0 +1,122 @@
+#include <Cafe/Encoding/CodePage/ISO-8859-1.h>
+#include <catch2/catch_all.hpp>
+#include <vector>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	/// @brief  以 Encoder 及通用实现分别转换，检查结果一致
+	template <CodePage::CodePageType FromCodePageValue, CodePage::CodePageType ToCodePageValue>
+	void CheckSameAsGeneric(
+	    std::span<const typename CodePage::CodePageTrait<FromCodePageValue>::CharType> src)
+	{
+		using ToCharType = typename CodePage::CodePageTrait<ToCodePageValue>::CharType;
+
+		const auto encode = [&](auto encodeAll) {
+			std::vector<ToCharType> result;
+			EncodingResultCode lastCode = EncodingResultCode::Accept;
+			encodeAll(src, [&](auto const& encodeResult) {
+				lastCode = GetEncodingResultCode<decltype(encodeResult)>;
+				if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+				              EncodingResultCode::Accept)
+				{
+					if constexpr (CodePage::CodePageTrait<ToCodePageValue>::IsVariableWidth)
+					{
+						result.insert(result.end(), encodeResult.Result.begin(),
+						              encodeResult.Result.end());
+					}
+					else
+					{
+						result.push_back(encodeResult.Result);
+					}
+				}
+			});
+			return std::pair(result, lastCode);
+		};
+
+		const auto optimized = encode([](auto const& span, auto&& receiver) {
+			Encoder<FromCodePageValue, ToCodePageValue>::EncodeAll(span, receiver);
+		});
+		const auto generic = encode([](auto const& span, auto&& receiver) {
+			EncoderBase<FromCodePageValue, ToCodePageValue>::EncodeAll(span, receiver);
+		});
+		REQUIRE(optimized == generic);
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.ISO-8859-1", "[Encoding][ISO-8859-1]")
+{
+	char all[256];
+	for (std::size_t i = 0; i < std::size(all); ++i)
+	{
+		all[i] = static_cast<char>(i);
+	}
+
+	SECTION("Code point")
+	{
+		CodePage::CodePageTrait<CodePage::Iso8859_1>::ToCodePoint('\xE9', [](auto const& result) {
+			if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			{
+				REQUIRE(result.Result == 0xE9);
+			}
+			else
+			{
+				REQUIRE(false);
+			}
+		});
+		CodePage::CodePageTrait<CodePage::Iso8859_1>::FromCodePoint(0x20AC, [](auto const& result) {
+			REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		});
+	}
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>) && __has_include(<Cafe/Encoding/CodePage/UTF-32.h>)
+	SECTION("Widening and narrowing")
+	{
+		CheckSameAsGeneric<CodePage::Iso8859_1, CodePage::Utf16LittleEndian>(all);
+		CheckSameAsGeneric<CodePage::Iso8859_1, CodePage::Utf16BigEndian>(all);
+		CheckSameAsGeneric<CodePage::Iso8859_1, CodePage::Utf32LittleEndian>(all);
+		CheckSameAsGeneric<CodePage::Iso8859_1, CodePage::Utf32BigEndian>(all);
+
+		std::u16string utf16(std::begin(all), std::end(all));
+		CheckSameAsGeneric<CodePage::Utf16LittleEndian, CodePage::Iso8859_1>(utf16);
+		utf16 += u"€";
+		CheckSameAsGeneric<CodePage::Utf16LittleEndian, CodePage::Iso8859_1>(utf16);
+		utf16.back() = 0xD800;
+		CheckSameAsGeneric<CodePage::Utf16LittleEndian, CodePage::Iso8859_1>(utf16);
+		CheckSameAsGeneric<CodePage::Utf16BigEndian, CodePage::Iso8859_1>(std::u16string(u"\xE900"));
+
+		std::u32string utf32(std::begin(all), std::end(all));
+		utf32 += U"\U0001F600";
+		CheckSameAsGeneric<CodePage::Utf32LittleEndian, CodePage::Iso8859_1>(utf32);
+	}
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+	SECTION("UTF-8")
+	{
+		using Utf8CharType = CodePage::CodePageTrait<CodePage::Utf8>::CharType;
+
+		CheckSameAsGeneric<CodePage::Iso8859_1, CodePage::Utf8>(all);
+
+		std::basic_string<Utf8CharType> utf8;
+		EncoderBase<CodePage::Iso8859_1, CodePage::Utf8>::EncodeAll(
+		    std::span<const char>(all), [&](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    utf8.append(result.Result.begin(), result.Result.end());
+			    }
+		    });
+		CheckSameAsGeneric<CodePage::Utf8, CodePage::Iso8859_1>(utf8);
+
+		// 无法表示的码点、不完整的序列及非最短形式
+		CheckSameAsGeneric<CodePage::Utf8, CodePage::Iso8859_1>(
+		    std::span(reinterpret_cast<const Utf8CharType*>("a\xE2\x82\xAC"), 4));
+		CheckSameAsGeneric<CodePage::Utf8, CodePage::Iso8859_1>(
+		    std::span(reinterpret_cast<const Utf8CharType*>("a\xC3"), 2));
+		CheckSameAsGeneric<CodePage::Utf8, CodePage::Iso8859_1>(
+		    std::span(reinterpret_cast<const Utf8CharType*>("a\xC1\x81"), 3));
+	}
+#endif
+}
@@ -0,0 +1,14 @@
+# cafe-iconv 的回归测试，由 ctest 以 cmake -P 运行
+# 参数：ICONV 为 cafe-iconv 的路径，DATA_DIR 为测试数据所在的目录
+
+# 输入中间单独出现的后续字节仅替换该字节，之后的内容仍被转码
+execute_process(
+    COMMAND ${ICONV} -f UTF-8 -t ISO-8859-1 --replacement ? ${DATA_DIR}/StrayContinuationByte.txt
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "cafe-iconv exited with ${result}")
+endif()
+if (NOT output STREQUAL "a?bcdef\n")
+    message(FATAL_ERROR "Unexpected output: \"${output}\"")
+endif()
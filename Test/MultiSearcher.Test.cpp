@@ -0,0 +1,214 @@
+#include <Cafe/Encoding/MultiSearcher.h>
+#include <catch2/catch_all.hpp>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+#if __has_include(<Cafe/Encoding/CodePage/GB2312.h>)
+#include <Cafe/Encoding/CodePage/GB2312.h>
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/GB18030.h>)
+#include <Cafe/Encoding/CodePage/GB18030.h>
+#endif
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	using Match = std::pair<std::size_t, std::size_t>;
+
+	template <CodePage::CodePageType CodePageValue, std::size_t Extent>
+	std::vector<Match> ScanAll(MultiSearcher<CodePageValue> const& searcher,
+	                           StringView<CodePageValue, Extent> const& str)
+	{
+		std::vector<Match> matches;
+		searcher.Scan(str, [&](std::size_t pattern, std::size_t pos) {
+			matches.emplace_back(pattern, pos);
+		});
+		std::sort(matches.begin(), matches.end(), [](Match const& a, Match const& b) {
+			return a.second != b.second ? a.second < b.second : a.first < b.first;
+		});
+		return matches;
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.Base.MultiSearcher", "[Encoding][MultiSearcher]")
+{
+	SECTION("Basic")
+	{
+		const MultiSearcher<CodePage::Utf8> searcher{ CAFE_UTF8_SV("he"), CAFE_UTF8_SV("she"),
+			                                          CAFE_UTF8_SV("his"), CAFE_UTF8_SV("hers"),
+			                                          CAFE_UTF8_SV("") };
+		REQUIRE(searcher.GetPatternCount() == 5);
+
+		// 重叠的出现均被报告，空模式串不被报告
+		REQUIRE(ScanAll(searcher, CAFE_UTF8_SV("ushers")) ==
+		        std::vector<Match>{ { 1, 1 }, { 0, 2 }, { 3, 2 } });
+		REQUIRE(ScanAll(searcher, CAFE_UTF8_SV("xyz")).empty());
+		REQUIRE(ScanAll(searcher, CAFE_UTF8_SV("")).empty());
+
+		// 重复的模式串均被报告
+		const MultiSearcher<CodePage::Utf8> duplicated{ CAFE_UTF8_SV("ab"), CAFE_UTF8_SV("ab") };
+		REQUIRE(ScanAll(duplicated, CAFE_UTF8_SV("xab")) == std::vector<Match>{ { 0, 1 }, { 1, 1 } });
+
+		// 提前终止
+		std::size_t count = 0;
+		searcher.Scan(CAFE_UTF8_SV("she sells his hers"),
+		              [&](std::size_t, std::size_t) -> Core::Misc::ControlFlowVariant<> {
+			              ++count;
+			              return Core::Misc::BreakType{};
+		              });
+		REQUIRE(count == 1);
+	}
+
+	SECTION("Compare with naive search")
+	{
+		// 较小的字符集以产生大量重叠及部分匹配，模式串较少时经常全部以同一编码单元开头
+		std::minstd_rand random{ 42 };
+		for (std::size_t round = 0; round < 200; ++round)
+		{
+			std::vector<std::u8string> patterns(1 + random() % 20);
+			for (auto& pattern : patterns)
+			{
+				pattern.resize(1 + random() % 6);
+				for (auto& unit : pattern)
+				{
+					unit = static_cast<char8_t>(u8'a' + random() % 4);
+				}
+			}
+
+			std::u8string text(random() % 300, u8'x');
+			for (auto& unit : text)
+			{
+				if (random() % 4 == 0)
+				{
+					unit = static_cast<char8_t>(u8'a' + random() % 4);
+				}
+			}
+
+			std::vector<StringView<CodePage::Utf8>> patternViews;
+			for (const auto& pattern : patterns)
+			{
+				patternViews.emplace_back(std::span<const char8_t>(pattern));
+			}
+			const MultiSearcher<CodePage::Utf8> searcher{
+				std::span<const StringView<CodePage::Utf8>>(patternViews)
+			};
+
+			std::vector<Match> expected;
+			for (std::size_t pos = 0; pos < text.size(); ++pos)
+			{
+				for (std::size_t i = 0; i < patterns.size(); ++i)
+				{
+					if (text.compare(pos, patterns[i].size(), patterns[i]) == 0)
+					{
+						expected.emplace_back(i, pos);
+					}
+				}
+			}
+
+			REQUIRE(ScanAll(searcher, StringView<CodePage::Utf8>{ std::span<const char8_t>(text) }) ==
+			        expected);
+		}
+	}
+
+	SECTION("Character boundary")
+	{
+		// "中" 为 E4 B8 AD，B8 AD 不起始于字符边界因此不被报告
+		const MultiSearcher<CodePage::Utf8> searcher{ CAFE_UTF8_SV("\xB8\xAD"),
+			                                          CAFE_UTF8_SV("中") };
+		REQUIRE(ScanAll(searcher, CAFE_UTF8_SV("a中b")) == std::vector<Match>{ { 1, 1 } });
+
+		// 定长代码页不需要确定字符边界
+		const std::vector<CodePointType> pattern{ 0x4E2D, 0x6587 };
+		const std::vector<CodePointType> text{ 0x4E2D, 0x6587, 0x4E2D, 0x6587 };
+		const MultiSearcher<CodePage::CodePoint> codePointSearcher{
+			StringView<CodePage::CodePoint>{ std::span<const CodePointType>(pattern) }
+		};
+		REQUIRE(ScanAll(codePointSearcher,
+		                StringView<CodePage::CodePoint>{ std::span<const CodePointType>(text) }) ==
+		        std::vector<Match>{ { 0, 0 }, { 0, 2 } });
+	}
+
+	SECTION("Many code units")
+	{
+		// 编码单元的编号较多，深度为 1 的状态不使用稠密转移表
+		std::vector<std::vector<CodePointType>> patterns(400);
+		for (std::size_t i = 0; i < patterns.size(); ++i)
+		{
+			const auto base = static_cast<CodePointType>(0x4E00 + i * 2);
+			patterns[i] = { base, base + 1, base };
+		}
+		std::vector<StringView<CodePage::CodePoint>> patternViews;
+		for (const auto& pattern : patterns)
+		{
+			patternViews.emplace_back(std::span<const CodePointType>(pattern));
+		}
+		const MultiSearcher<CodePage::CodePoint> searcher{
+			std::span<const StringView<CodePage::CodePoint>>(patternViews)
+		};
+
+		// 0x4E02 0x4E03 0x4E02 0x4E03 0x4E02 中模式串 1 出现两次，0x4E00 0x4E01 0x4E02 不匹配
+		const std::vector<CodePointType> text{ 0x4E00, 0x4E01, 0x4E02, 0x4E03, 0x4E02,
+			                                   0x4E03, 0x4E02, 0x20,   0x4E00, 0x4E01,
+			                                   0x4E00 };
+		REQUIRE(ScanAll(searcher,
+		                StringView<CodePage::CodePoint>{ std::span<const CodePointType>(text) }) ==
+		        std::vector<Match>{ { 1, 2 }, { 1, 4 }, { 0, 8 } });
+	}
+
+#if __has_include(<Cafe/Encoding/CodePage/GB2312.h>)
+	SECTION("GB2312")
+	{
+		// "啊啊" 为 B0 A1 B0 A1，位置 1 的 A1 B0 跨越字符边界
+		const StringView<CodePage::GB2312> text{ std::span<const char>("x\xB0\xA1\xB0\xA1", 5) };
+		const StringView<CodePage::GB2312> crossing{ std::span<const char>("\xA1\xB0", 2) };
+		const StringView<CodePage::GB2312> character{ std::span<const char>("\xB0\xA1", 2) };
+		const MultiSearcher<CodePage::GB2312> searcher{ crossing, character };
+		REQUIRE(ScanAll(searcher, text) == std::vector<Match>{ { 1, 1 }, { 1, 3 } });
+
+		// 较长的模式串使用堆上分配的边界记录
+		std::string longPattern;
+		for (std::size_t i = 0; i < 600; ++i)
+		{
+			longPattern += "\xB0\xA1";
+		}
+		const auto longText = "x" + longPattern + longPattern;
+		const MultiSearcher<CodePage::GB2312> longSearcher{
+			StringView<CodePage::GB2312>{ std::span<const char>(longPattern) }, crossing
+		};
+		std::size_t count = 0;
+		longSearcher.Scan(StringView<CodePage::GB2312>{ std::span<const char>(longText) },
+		                  [&](std::size_t pattern, std::size_t pos) {
+			                  REQUIRE(pattern == 0);
+			                  REQUIRE(pos % 2 == 1);
+			                  ++count;
+		                  });
+		REQUIRE(count == 601);
+	}
+#endif
+
+#if __has_include(<Cafe/Encoding/CodePage/GB18030.h>)
+	SECTION("GB18030")
+	{
+		// 四字节编码的宽度无法仅由首字节确定，位置 2 的 81 30 82 30 跨越两个字符
+		const StringView<CodePage::GB18030> text{ std::span<const char>(
+			"\x81\x30\x81\x30\x82\x30\x81\x30", 8) };
+		const StringView<CodePage::GB18030> crossing{ std::span<const char>("\x81\x30\x82\x30",
+			                                                                 4) };
+		const StringView<CodePage::GB18030> character{ std::span<const char>(
+			"\x82\x30\x81\x30", 4) };
+		const MultiSearcher<CodePage::GB18030> searcher{ crossing, character };
+		REQUIRE(ScanAll(searcher, text) == std::vector<Match>{ { 1, 4 } });
+	}
+#endif
+}
+
+#endif
@@ -1,6 +1,17 @@
+#include <Cafe/Encoding/BatchTranscode.h>
+#include <Cafe/Encoding/DetectCodePage.h>
+#include <Cafe/Encoding/MappedText.h>
 #include <Cafe/Encoding/RuntimeEncoding.h>
+#include <Cafe/Encoding/RuntimeTranscodingStreamBuf.h>
+#include <Cafe/Encoding/TranscodeFile.h>
+#include <Cafe/Encoding/TranscodeStage.h>
 #include <catch2/catch_all.hpp>
+#include <algorithm>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 #include <vector>
 
 using namespace Cafe;
@@ -36,5 +47,492 @@ TEST_CASE("Cafe.Encoding.RuntimeEncoding", "[Encoding][RuntimeEncoding]")
 		REQUIRE(result.ProduceCount == expectedOutput.GetSize());
 		REQUIRE(std::memcmp(expectedOutput2, expectedOutput.GetSpan().data(), expectedOutput.GetSize()) == 0);
 	}
+
+	SECTION("Transcoding stream buffer")
+	{
+		const std::u16string_view u16Str = u"\xD852\xDF62\x4E2D\xFEFF";
+		const std::string_view expectedOutput = "\xF0\xA4\xAD\xA2\xE4\xB8\xAD\xEF\xBB\xBF";
+		std::stringbuf underlying{ std::string(reinterpret_cast<const char*>(u16Str.data()),
+			                                   u16Str.size() * sizeof(char16_t)) };
+		// 块大小为奇数，使代理对跨越块边界
+		RuntimeEncoding::RuntimeTranscodingStreamBuf streamBuf{ &underlying,
+			                                                    CodePage::Utf16LittleEndian,
+			                                                    CodePage::Utf8, 5 };
+		const std::string result{ std::istreambuf_iterator<char>(&streamBuf),
+			                      std::istreambuf_iterator<char>() };
+		REQUIRE(streamBuf.GetResultCode() == EncodingResultCode::Accept);
+		REQUIRE(result == expectedOutput);
+	}
+
+	SECTION("Mapped text")
+	{
+		const auto path = std::filesystem::temp_directory_path() / "Cafe.Encoding.Test.txt";
+		const auto writeFile = [&](std::string_view content) {
+			std::ofstream file{ path, std::ios::binary };
+			file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		};
+
+		writeFile(std::string_view("\xFF\xFE" "a\0\x2D\x4E", 6));
+		{
+			const auto text = RuntimeEncoding::MappedText::Open(path);
+			REQUIRE(text.has_value());
+			REQUIRE(text->GetBomCodePage() == CodePage::Utf16LittleEndian);
+			REQUIRE(text->GetBomSize() == 2);
+			REQUIRE(text->GetBytes().size() == 6);
+			REQUIRE(text->GetContent().size() == 4);
+			REQUIRE(!text->GetView<CodePage::Utf8>().has_value());
+
+			const auto view = text->GetView<CodePage::Utf16LittleEndian>();
+			REQUIRE(view.has_value());
+			REQUIRE(view->GetSize() == 2);
+			REQUIRE(view->GetSpan()[0] == u'a');
+			REQUIRE(view->GetSpan()[1] == u'\x4E2D');
+
+			// 映射的内容可直接用于编码
+			std::byte output[8];
+			const auto result = RuntimeEncoding::EncodeAllToSpan(
+			    CodePage::Utf16LittleEndian, text->GetContent(), CodePage::Utf8, output);
+			REQUIRE(result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+			REQUIRE(result.ProduceCount == 4);
+			REQUIRE(std::memcmp(output, "a\xE4\xB8\xAD", 4) == 0);
+		}
+
+		writeFile("abc");
+		{
+			const auto text = RuntimeEncoding::MappedText::Open(path);
+			REQUIRE(text.has_value());
+			REQUIRE(!text->GetBomCodePage().has_value());
+			REQUIRE(text->GetView<CodePage::Utf8>().has_value());
+			REQUIRE(text->GetView<CodePage::Utf8>()->GetSize() == 3);
+			// 大小不是编码单元的整数倍
+			REQUIRE(!text->GetView<CodePage::Utf16LittleEndian>().has_value());
+		}
+
+		writeFile("");
+		{
+			const auto text = RuntimeEncoding::MappedText::Open(path);
+			REQUIRE(text.has_value());
+			REQUIRE(text->GetContent().empty());
+		}
+
+		std::filesystem::remove(path);
+		REQUIRE(!RuntimeEncoding::MappedText::Open(path).has_value());
+	}
+
+	SECTION("Transcode file")
+	{
+		const auto fromPath = std::filesystem::temp_directory_path() / "Cafe.Encoding.Test.from";
+		const auto toPath = std::filesystem::temp_directory_path() / "Cafe.Encoding.Test.to";
+		const auto writeFile = [&](std::string_view content) {
+			std::ofstream file{ fromPath, std::ios::binary };
+			file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		};
+		const auto readFile = [&] {
+			std::ifstream file{ toPath, std::ios::binary };
+			return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		};
+
+		std::string u8Str;
+		std::u16string u16Str;
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			u8Str += "a\xE4\xB8\xAD\xF0\xA4\xAD\xA2\xC3\xA9";
+			u16Str += u"a\x4E2D\xD852\xDF62\xE9";
+		}
+		const std::string u16Bytes(reinterpret_cast<const char*>(u16Str.data()),
+		                           u16Str.size() * sizeof(char16_t));
+
+		// 较小的块使字符跨越块边界，少于转码线程数的块数使各阶段互相等待
+		const RuntimeEncoding::TranscodeFileOptions options{ 7, 3, 4 };
+
+		writeFile(u8Str);
+		auto result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf8, toPath,
+		                                             CodePage::Utf16LittleEndian, options);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::Succeed);
+		REQUIRE(result.ConsumeCount == u8Str.size());
+		REQUIRE(result.ProduceCount == u16Bytes.size());
+		REQUIRE(readFile() == u16Bytes);
+
+		writeFile(u16Bytes);
+		result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf16LittleEndian, toPath,
+		                                        CodePage::Utf8, options);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::Succeed);
+		REQUIRE(readFile() == u8Str);
+
+		// 出错前的结果均已写入
+		writeFile(u8Str + "abc\xFF" + u8Str);
+		result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf8, toPath,
+		                                        CodePage::Utf16LittleEndian, options);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::Reject);
+		REQUIRE(result.ConsumeCount == u8Str.size() + 3);
+		REQUIRE(readFile() == u16Bytes + std::string("a\0b\0c\0", 6));
+
+		writeFile(u8Str + "\xE4\xB8");
+		result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf8, toPath,
+		                                        CodePage::Utf16LittleEndian, options);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::Incomplete);
+		REQUIRE(result.ConsumeCount == u8Str.size());
+		REQUIRE(readFile() == u16Bytes);
+
+		writeFile("");
+		result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf8, toPath,
+		                                        CodePage::Utf16LittleEndian);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::Succeed);
+		REQUIRE(result.ProduceCount == 0);
+
+		std::filesystem::remove(fromPath);
+		result = RuntimeEncoding::TranscodeFile(fromPath, CodePage::Utf8, toPath,
+		                                        CodePage::Utf16LittleEndian);
+		REQUIRE(result.ResultCode == RuntimeEncoding::TranscodeFileResultCode::CannotOpenInput);
+		std::filesystem::remove(toPath);
+	}
+
+	SECTION("Batch transcode")
+	{
+		const std::string_view u8Str = "a\xE4\xB8\xAD\xF0\xA4\xAD\xA2";
+		const std::u16string_view u16Str = u"a\x4E2D\xD852\xDF62";
+		const auto u8Bytes = std::as_bytes(std::span(u8Str));
+		const auto u16Bytes = std::as_bytes(std::span(u16Str));
+
+		// 任务大小不均匀，使工作线程之间发生窃取
+		std::vector<std::string> documents;
+		std::vector<RuntimeEncoding::TranscodeJob> jobs;
+		for (std::size_t i = 0; i < 1000; ++i)
+		{
+			std::string document;
+			for (std::size_t j = 0; j < (i % 7 == 0 ? 200 : 1); ++j)
+			{
+				document += u8Str;
+			}
+			documents.push_back(std::move(document));
+		}
+		for (std::size_t i = 0; i < documents.size(); ++i)
+		{
+			jobs.push_back({ CodePage::Utf8, std::as_bytes(std::span(documents[i])),
+			                 i % 2 ? CodePage::Utf16LittleEndian : CodePage::Utf8 });
+		}
+		jobs.push_back({ CodePage::Utf16LittleEndian, u16Bytes, CodePage::Utf8 });
+		jobs.push_back({ CodePage::Utf8, std::as_bytes(std::span(std::string_view("ab\xFF"))),
+		                 CodePage::Utf16LittleEndian });
+		jobs.push_back({ CodePage::Utf8, {}, CodePage::Utf16LittleEndian });
+		jobs.push_back({ CodePage::Utf8, u8Bytes, static_cast<CodePage::CodePageType>(1) });
+
+		for (const std::size_t workerCount : { 1, 4 })
+		{
+			const auto results = RuntimeEncoding::BatchTranscode(jobs, workerCount);
+			REQUIRE(results.GetSize() == jobs.size());
+
+			for (std::size_t i = 0; i < documents.size(); ++i)
+			{
+				const auto repeatCount = i % 7 == 0 ? 200 : 1;
+				const auto expected = i % 2 ? u16Bytes : u8Bytes;
+				REQUIRE(results[i].ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+				REQUIRE(results[i].ConsumeCount == documents[i].size());
+				REQUIRE(results[i].Result.size() == expected.size() * repeatCount);
+				REQUIRE(std::memcmp(results[i].Result.data() + results[i].Result.size() - expected.size(),
+				                    expected.data(), expected.size()) == 0);
+			}
+
+			const auto& u16Result = results[documents.size()];
+			REQUIRE(u16Result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+			REQUIRE(std::ranges::equal(u16Result.Result, u8Bytes));
+
+			const auto& rejected = results[documents.size() + 1];
+			REQUIRE(rejected.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Reject);
+			REQUIRE(rejected.ConsumeCount == 2);
+			REQUIRE(rejected.Result.size() == 4);
+
+			REQUIRE(results[documents.size() + 2].ResultCode ==
+			        RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+			REQUIRE(results[documents.size() + 2].Result.empty());
+
+			const auto& unsupported = results[documents.size() + 3];
+			REQUIRE(unsupported.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Reject);
+			REQUIRE(unsupported.ConsumeCount == 0);
+		}
+	}
+
+	SECTION("Transcode stage")
+	{
+		std::string u8Str;
+		std::u16string u16Str;
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			u8Str += "a\xE4\xB8\xAD\xF0\xA4\xAD\xA2";
+			u16Str += u"a\x4E2D\xD852\xDF62";
+		}
+		const std::string u16Bytes(reinterpret_cast<const char*>(u16Str.data()),
+		                           u16Str.size() * sizeof(char16_t));
+
+		const auto transcode = [](RuntimeEncoding::TranscodeStage& stage, std::string_view input,
+		                          std::size_t chunkSize) {
+			std::string output;
+			std::size_t outputCount = 0;
+			for (std::size_t pos = 0; pos < input.size() || pos == 0; pos += chunkSize)
+			{
+				REQUIRE(stage.NeedInput());
+				const auto chunk = input.substr(pos, chunkSize);
+				stage.Feed(std::as_bytes(std::span(chunk)), pos + chunkSize >= input.size());
+				while (stage.Next())
+				{
+					const auto block = stage.GetOutput();
+					output.append(reinterpret_cast<const char*>(block.data()), block.size());
+					++outputCount;
+				}
+				if (stage.IsFinished())
+				{
+					break;
+				}
+			}
+			return std::pair(output, outputCount);
+		};
+
+		// 输入块的边界切分字符
+		for (const std::size_t chunkSize : { 1, 3, 7 })
+		{
+			RuntimeEncoding::TranscodeStage stage{ CodePage::Utf8, CodePage::Utf16LittleEndian, 16 };
+			REQUIRE(transcode(stage, u8Str, chunkSize).first == u16Bytes);
+			REQUIRE(stage.IsFinished());
+			REQUIRE(stage.GetResultCode() == RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+			REQUIRE(stage.GetConsumeCount() == u8Str.size());
+		}
+
+		// 较大的输入块被按工作量切分为多块输出
+		{
+			RuntimeEncoding::TranscodeStage stage{ CodePage::Utf16LittleEndian, CodePage::Utf8, 16 };
+			const auto [output, outputCount] = transcode(stage, u16Bytes, u16Bytes.size());
+			REQUIRE(output == u8Str);
+			REQUIRE(outputCount >= u16Bytes.size() / 16);
+		}
+
+		{
+			RuntimeEncoding::TranscodeStage stage{ CodePage::Utf8, CodePage::Utf16LittleEndian, 16 };
+			const auto [output, outputCount] = transcode(stage, "abc\xFF" "def", 2);
+			REQUIRE(output == std::string("a\0b\0c\0", 6));
+			REQUIRE(stage.IsFinished());
+			REQUIRE(stage.GetResultCode() == RuntimeEncoding::RuntimeEncodingResultCode::Reject);
+			REQUIRE(stage.GetConsumeCount() == 3);
+		}
+
+		{
+			RuntimeEncoding::TranscodeStage stage{ CodePage::Utf8, CodePage::Utf16LittleEndian, 16 };
+			const auto [output, outputCount] = transcode(stage, "ab\xE4\xB8", 3);
+			REQUIRE(output == std::string("a\0b\0", 4));
+			REQUIRE(stage.GetResultCode() == RuntimeEncoding::RuntimeEncodingResultCode::Incomplete);
+			REQUIRE(stage.GetConsumeCount() == 2);
+		}
+
+		// 输入块中间单独出现的后续字节
+		for (const std::size_t padding : { 40, 100 })
+		{
+			RuntimeEncoding::TranscodeStage stage{ CodePage::Utf8, CodePage::Utf16LittleEndian, 64 };
+			const auto input = "a\x80" + std::string(padding, 'b');
+			const auto [output, outputCount] = transcode(stage, input, input.size());
+			REQUIRE(output == std::string("a\0", 2));
+			REQUIRE(stage.IsFinished());
+			REQUIRE(stage.GetResultCode() == RuntimeEncoding::RuntimeEncodingResultCode::Incomplete);
+			REQUIRE(stage.GetConsumeCount() == 1);
+		}
+	}
+
+	SECTION("Loaded code page")
+	{
+		constexpr auto TestCodePage = static_cast<CodePage::CodePageType>(60000);
+
+		std::vector<std::pair<std::uint16_t, char16_t>> pairs;
+		for (char16_t i = 0; i < 0x80; ++i)
+		{
+			pairs.emplace_back(i, i);
+		}
+		pairs.emplace_back(0x8140, u'中');
+		pairs.emplace_back(0x8141, u'文');
+		pairs.emplace_back(0x8242, u'中'); // 编码时使用最先出现的映射项
+
+		const auto table = RuntimeEncoding::BuildRuntimeCodePageTable(TestCodePage, "Test-DBCS", pairs);
+		REQUIRE(!table.empty());
+
+		const auto path = std::filesystem::temp_directory_path() / "Cafe.Encoding.Test.cpt";
+		{
+			std::ofstream file{ path, std::ios::binary };
+			file.write(reinterpret_cast<const char*>(table.data()),
+			           static_cast<std::streamsize>(table.size()));
+		}
+
+		const auto loadResult = RuntimeEncoding::LoadCodePage(path);
+		REQUIRE(loadResult.ResultCode == RuntimeEncoding::LoadCodePageResultCode::Succeed);
+		REQUIRE(loadResult.CodePage == TestCodePage);
+		REQUIRE(RuntimeEncoding::LoadCodePage(path).ResultCode ==
+		        RuntimeEncoding::LoadCodePageResultCode::AlreadyExists);
+
+		const auto supportCodePages = RuntimeEncoding::GetSupportCodePages();
+		REQUIRE(std::find(supportCodePages.begin(), supportCodePages.end(), TestCodePage) !=
+		        supportCodePages.end());
+		REQUIRE(RuntimeEncoding::GetCodePageName(TestCodePage) == "Test-DBCS");
+		REQUIRE(RuntimeEncoding::IsCodePageVariableWidth(TestCodePage) == true);
+		REQUIRE(RuntimeEncoding::GetCodePageMaxWidth(TestCodePage) == 2);
+
+		const char encoded[]{ 'a', '\x81', '\x40', '\x82', '\x42', '\x81', '\x41' };
+		constexpr auto expectedOutput = CAFE_UTF8_SV("a中中文");
+
+		String<CodePage::Utf8> resultStr;
+		RuntimeEncoding::EncodeAll(
+		    TestCodePage, std::as_bytes(std::span(encoded)), CodePage::Utf8,
+		    [&](auto const& result) {
+			    REQUIRE(result.ResultCode == EncodingResultCode::Accept);
+			    resultStr.Append(std::span(
+			        reinterpret_cast<
+			            const typename CodePage::CodePageTrait<CodePage::Utf8>::CharType*>(
+			            result.Result.data()),
+			        result.Result.size()));
+		    });
+		REQUIRE(resultStr == expectedOutput);
+
+		std::byte output[16];
+		auto result = RuntimeEncoding::EncodeAllToSpan(
+		    CodePage::Utf8, std::as_bytes(expectedOutput.GetSpan()), TestCodePage, output);
+		REQUIRE(result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Accept);
+		REQUIRE(result.ConsumeCount == expectedOutput.GetSize());
+		// 包含结尾的空字符
+		REQUIRE(result.ProduceCount == 8);
+		REQUIRE(std::memcmp(output, "a\x81\x40\x81\x40\x81\x41", 8) == 0);
+
+		// 无法编码的码点
+		constexpr auto unmappedInput = CAFE_UTF8_SV("a€b");
+		result = RuntimeEncoding::EncodeAllToSpan(
+		    CodePage::Utf8, std::as_bytes(unmappedInput.GetSpan()), TestCodePage, output);
+		REQUIRE(result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Reject);
+		REQUIRE(result.ConsumeCount == 1);
+		REQUIRE(result.ProduceCount == 1);
+
+		// 不完整及未映射的编码
+		result = RuntimeEncoding::EncodeAllToSpan(TestCodePage, std::as_bytes(std::span(encoded, 2)),
+		                                          CodePage::Utf8, output);
+		REQUIRE(result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Incomplete);
+		REQUIRE(result.ProduceCount == 1);
+		const char unmappedEncoded[]{ '\x81', '\x42' };
+		result = RuntimeEncoding::EncodeAllToSpan(
+		    TestCodePage, std::as_bytes(std::span(unmappedEncoded)), CodePage::Utf8, output);
+		REQUIRE(result.ResultCode == RuntimeEncoding::RuntimeEncodingResultCode::Reject);
+
+		REQUIRE(RuntimeEncoding::UnloadCodePage(TestCodePage));
+		REQUIRE(!RuntimeEncoding::UnloadCodePage(TestCodePage));
+		REQUIRE(RuntimeEncoding::GetCodePageName(TestCodePage).empty());
+
+		REQUIRE(RuntimeEncoding::LoadCodePage(path.string() + ".nonexistent").ResultCode ==
+		        RuntimeEncoding::LoadCodePageResultCode::CannotOpenFile);
+		{
+			std::ofstream file{ path, std::ios::binary };
+			file.write(reinterpret_cast<const char*>(table.data()),
+			           static_cast<std::streamsize>(table.size() - 1));
+		}
+		REQUIRE(RuntimeEncoding::LoadCodePage(path).ResultCode ==
+		        RuntimeEncoding::LoadCodePageResultCode::InvalidFormat);
+		std::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("Cafe.Encoding.RuntimeEncoding.DetectCodePage", "[Encoding][RuntimeEncoding]")
+{
+	const auto detect = [](std::string_view str) {
+		return RuntimeEncoding::DetectCodePage(std::as_bytes(std::span(str)));
+	};
+
+	const auto getTop = [&](std::string_view str) {
+		const auto candidates = detect(str);
+		REQUIRE(!candidates.empty());
+		for (std::size_t i = 1; i < candidates.size(); ++i)
+		{
+			REQUIRE(candidates[i - 1].Confidence >= candidates[i].Confidence);
+		}
+		return candidates.front().CodePage;
+	};
+
+	SECTION("BOM")
+	{
+		auto candidates = detect("\xEF\xBB\xBF" "abc");
+		REQUIRE(candidates.size() == 1);
+		REQUIRE(candidates[0].CodePage == CodePage::Utf8);
+		REQUIRE(candidates[0].BomSize == 3);
+
+		candidates = detect(std::string_view("\xFF\xFE" "a\0", 4));
+		REQUIRE(candidates.size() == 1);
+		REQUIRE(candidates[0].CodePage == CodePage::Utf16LittleEndian);
+		REQUIRE(candidates[0].BomSize == 2);
+	}
+
+	SECTION("Unicode without BOM")
+	{
+		REQUIRE(detect("").empty());
+
+		// 纯 ASCII 仅返回 UTF-8
+		const auto candidates = detect("The quick brown fox jumps over the lazy dog.");
+		REQUIRE(candidates.size() == 1);
+		REQUIRE(candidates[0].CodePage == CodePage::Utf8);
+
+		REQUIRE(getTop("\xE4\xB8\xAD\xE6\x96\x87 text \xE6\xA3\x80\xE6\xB5\x8B") == CodePage::Utf8);
+		// 已有完整的多字节序列时，结尾不完整的序列视为被截断
+		REQUIRE(getTop("\xE4\xB8\xAD\xE6\x96\x87 text \xE6\xA3") == CodePage::Utf8);
+		REQUIRE(getTop(std::string_view("t\0e\0x\0t\0 \0f\0i\0l\0e\0", 18)) ==
+		        CodePage::Utf16LittleEndian);
+		REQUIRE(getTop(std::string_view("\0t\0e\0x\0t\0 \0f\0i\0l\0e", 18)) ==
+		        CodePage::Utf16BigEndian);
+	}
+
+	SECTION("Double byte code pages")
+	{
+		const auto isSupported = [](CodePage::CodePageType codePage) {
+			return !RuntimeEncoding::GetCodePageName(codePage).empty();
+		};
+
+		if (isSupported(static_cast<CodePage::CodePageType>(936)))
+		{
+			REQUIRE(getTop("\xCE\xD2\xC3\xC7\xD4\xDA\xD5\xE2\xC0\xEF\xB2\xE2\xCA\xD4\xD6\xD0\xCE\xC4\xB1"
+			               "\xE0\xC2\xEB\xB5\xC4\xD7\xD4\xB6\xAF\xBC\xEC\xB2\xE2\xA3\xAC\xD5\xE2\xCA"
+			               "\xC7\xD2\xBB\xB8\xF6\xBC\xF2\xB5\xA5\xB5\xC4\xBE\xE4\xD7\xD3\xA1\xA3") ==
+			        static_cast<CodePage::CodePageType>(936));
+		}
+
+		if (isSupported(static_cast<CodePage::CodePageType>(949)))
+		{
+			REQUIRE(getTop("\xC7\xD1\xB1\xB9\xBE\xEE \xC0\xCE\xC4\xDA\xB5\xF9 \xC0\xDA\xB5\xBF "
+			               "\xB0\xA8\xC1\xF6\xB8\xA6 \xC0\xA7\xC7\xD1 \xB0\xA3\xB4\xDC\xC7\xD1 "
+			               "\xB9\xAE\xC0\xE5\xC0\xD4\xB4\xCF\xB4\xD9.") ==
+			        static_cast<CodePage::CodePageType>(949));
+		}
+
+		if (isSupported(static_cast<CodePage::CodePageType>(950)))
+		{
+			REQUIRE(getTop("\xB3o\xACO\xA4@\xAD\xD3\xA5\xCE\xA8\xD3\xB4\xFA\xB8\xD5\xC1"
+			               "c\xC5\xE9\xA4\xA4\xA4\xE5\xBDs\xBDX\xA6\xDB\xB0\xCA\xB0\xBB\xB4\xFA\xAA"
+			               "\xBA\xA5y\xA4l\xA1" "C") == static_cast<CodePage::CodePageType>(950));
+		}
+
+		if (isSupported(static_cast<CodePage::CodePageType>(932)))
+		{
+			REQUIRE(getTop("\x82\xB1\x82\xEA\x82\xCD\x93\xFA\x96{\x8C\xEA\x82\xCC\x95\xB6\x8E\x9A\x83"
+			               "R\x81[\x83h\x82\xF0\x8E\xA9\x93\xAE\x94\xBB\x92\xE8\x82\xB7\x82\xE9\x82"
+			               "\xBD\x82\xDF\x82\xCC\x95\xB6\x82\xC5\x82\xB7\x81" "B") ==
+			        static_cast<CodePage::CodePageType>(932));
+		}
+	}
+
+	SECTION("Single byte code pages")
+	{
+		// 非 UTF-8 的拉丁字母文本，包括唯一的非 ASCII 字节位于结尾而看似未完成的 UTF-8 序列的情况
+		for (const std::string_view str : { "caf\xE9 cr\xE8me br\xFBl\xE9" "e", "Bonjour, caf\xE9" })
+		{
+			const auto candidates = detect(str);
+			REQUIRE(std::none_of(candidates.begin(), candidates.end(), [](auto const& candidate) {
+				return candidate.CodePage == CodePage::Utf8;
+			}));
+			if (!RuntimeEncoding::GetCodePageName(static_cast<CodePage::CodePageType>(28591))
+			         .empty())
+			{
+				REQUIRE(std::any_of(candidates.begin(), candidates.end(), [](auto const& candidate) {
+					return candidate.CodePage == static_cast<CodePage::CodePageType>(28591);
+				}));
+			}
+		}
+	}
 }
 #endif
@@ -0,0 +1,88 @@
+#include <Cafe/Encoding/Searcher.h>
+#include <catch2/catch_all.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	StringView<CodePage::Utf8> AsUtf8View(std::u8string const& str)
+	{
+		return std::span<const char8_t>(str);
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.Base.Searcher", "[Encoding][Searcher]")
+{
+	SECTION("Algorithm selection")
+	{
+		REQUIRE(Searcher<CodePage::Utf8>{ CAFE_UTF8_SV("abc") }.GetAlgorithm() ==
+		        Searcher<CodePage::Utf8>::Algorithm::Filter);
+		const Searcher<CodePage::Utf8> longSearcher{ CAFE_UTF8_SV("the quick brown fox jumps") };
+		REQUIRE(longSearcher.GetAlgorithm() == Searcher<CodePage::Utf8>::Algorithm::Horspool);
+		REQUIRE(Searcher<CodePage::Utf8>{ CAFE_UTF8_SV("abababababababababab") }.GetAlgorithm() ==
+		        Searcher<CodePage::Utf8>::Algorithm::TwoWay);
+		REQUIRE(Searcher<CodePage::Utf8>{ CAFE_UTF8_SV("abc") }.GetPattern() ==
+		        CAFE_UTF8_SV("abc").Trim());
+	}
+
+	SECTION("Find")
+	{
+		// 与朴素查找的结果比较，较小的字符集以产生大量部分匹配
+		std::minstd_rand random{ 42 };
+		for (std::size_t round = 0; round < 1000; ++round)
+		{
+			const auto alphabetSize = 1 + round % 4;
+			std::u8string haystack(random() % 400, u8'a');
+			for (auto& item : haystack)
+			{
+				item = static_cast<char8_t>(u8'a' + random() % alphabetSize);
+			}
+			std::u8string pattern(1 + random() % 40, u8'a');
+			for (auto& item : pattern)
+			{
+				item = static_cast<char8_t>(u8'a' + random() % alphabetSize);
+			}
+
+			const auto haystackView = AsUtf8View(haystack);
+			const Searcher<CodePage::Utf8> searcher{ AsUtf8View(pattern) };
+			REQUIRE(searcher.FindIn(haystackView) == haystackView.NaiveFind(AsUtf8View(pattern)));
+		}
+
+		const Searcher<CodePage::Utf8> searcher{ CAFE_UTF8_SV("ab") };
+		const auto str = CAFE_UTF8_SV("xabyab");
+		REQUIRE(searcher.FindIn(str) == 1);
+		REQUIRE(searcher.FindIn(str, 2) == 4);
+		REQUIRE(searcher.FindIn(str, 5) == Searcher<CodePage::Utf8>::Npos);
+		REQUIRE(searcher.FindIn(str, 100) == Searcher<CodePage::Utf8>::Npos);
+	}
+
+	SECTION("Find all")
+	{
+		const Searcher<CodePage::Utf8> searcher{ CAFE_UTF8_SV("aa") };
+		const auto str = CAFE_UTF8_SV("aaaaabaa");
+
+		std::vector<std::size_t> positions;
+		searcher.FindAllIn(str, [&](std::size_t pos) { positions.push_back(pos); });
+		REQUIRE(positions == std::vector<std::size_t>{ 0, 2, 6 });
+		REQUIRE(searcher.CountIn(str) == 3);
+
+		positions.clear();
+		searcher.FindAllIn(str, [&](std::size_t pos) -> Core::Misc::ControlFlowVariant<> {
+			positions.push_back(pos);
+			return Core::Misc::BreakType{};
+		});
+		REQUIRE(positions == std::vector<std::size_t>{ 0 });
+
+		REQUIRE(Searcher<CodePage::Utf8>{ CAFE_UTF8_SV("") }.CountIn(str) == 0);
+	}
+}
+
+#endif
@@ -0,0 +1,153 @@
+#include <Cafe/Encoding/CodePage/ISO-8859-11.h>
+#include <Cafe/Encoding/CodePage/ISO-8859-15.h>
+#include <Cafe/Encoding/CodePage/ISO-8859-2.h>
+#include <Cafe/Encoding/CodePage/ISO-8859-5.h>
+#include <Cafe/Encoding/CodePage/ISO-8859-7.h>
+#include <Cafe/Encoding/CodePage/KOI8-R.h>
+#include <Cafe/Encoding/CodePage/Windows-1252.h>
+#include <catch2/catch_all.hpp>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	template <CodePage::CodePageType CodePageValue>
+	bool CheckToCodePoint(unsigned char codeUnit, CodePointType expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePageValue>::ToCodePoint(
+		    static_cast<char>(codeUnit), [&](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    succeed = result.Result == expected;
+			    }
+		    });
+		return succeed;
+	}
+
+	template <CodePage::CodePageType CodePageValue>
+	bool CheckFromCodePoint(CodePointType codePoint, unsigned char expected)
+	{
+		bool succeed = false;
+		CodePage::CodePageTrait<CodePageValue>::FromCodePoint(
+		    codePoint, [&](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    succeed = result.Result == static_cast<char>(expected);
+			    }
+		    });
+		return succeed;
+	}
+
+	template <CodePage::CodePageType CodePageValue>
+	bool IsRejectedFromCodePoint(CodePointType codePoint)
+	{
+		bool rejected = false;
+		CodePage::CodePageTrait<CodePageValue>::FromCodePoint(
+		    codePoint, [&](auto const& result) {
+			    rejected =
+			        GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject;
+		    });
+		return rejected;
+	}
+
+	/// @brief  检查所有已映射的编码单元可往返转换，返回已映射的编码单元个数
+	template <CodePage::CodePageType CodePageValue>
+	std::size_t CheckRoundTrip()
+	{
+		std::size_t mappedCount{};
+		for (unsigned codeUnit = 0; codeUnit <= 0xFF; ++codeUnit)
+		{
+			CodePage::CodePageTrait<CodePageValue>::ToCodePoint(
+			    static_cast<char>(codeUnit), [&](auto const& result) {
+				    if constexpr (GetEncodingResultCode<decltype(result)> ==
+				                  EncodingResultCode::Accept)
+				    {
+					    REQUIRE(CheckFromCodePoint<CodePageValue>(result.Result, codeUnit));
+					    ++mappedCount;
+				    }
+			    });
+		}
+		return mappedCount;
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.SingleByte", "[Encoding][SingleByte]")
+{
+	SECTION("Mapping")
+	{
+		REQUIRE(CheckToCodePoint<CodePage::Windows1252>(0x80, 0x20AC));
+		REQUIRE(CheckFromCodePoint<CodePage::Windows1252>(0x20AC, 0x80));
+		REQUIRE(CheckToCodePoint<CodePage::Windows1252>(0xFF, 0x00FF));
+		REQUIRE(IsRejectedFromCodePoint<CodePage::Windows1252>(0x0100));
+		REQUIRE(IsRejectedFromCodePoint<CodePage::Windows1252>(0x1F600));
+
+		REQUIRE(CheckToCodePoint<CodePage::Iso8859_2>(0xA1, 0x0104));
+		REQUIRE(CheckToCodePoint<CodePage::Iso8859_5>(0xB0, 0x0410));
+		REQUIRE(CheckFromCodePoint<CodePage::Iso8859_7>(0x03A9, 0xD9));
+		REQUIRE(CheckFromCodePoint<CodePage::Iso8859_15>(0x20AC, 0xA4));
+		REQUIRE(IsRejectedFromCodePoint<CodePage::Iso8859_15>(0x00A4));
+
+		REQUIRE(CheckToCodePoint<CodePage::Koi8R>(0xC1, 0x0430));
+		REQUIRE(CheckFromCodePoint<CodePage::Koi8R>(0x042A, 0xFF));
+		REQUIRE(CheckFromCodePoint<CodePage::Koi8R>(0x0000, 0x00));
+	}
+
+	SECTION("Unmapped code units")
+	{
+		CodePage::CodePageTrait<CodePage::Windows1252>::ToCodePoint(
+		    '\x81', [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+		CodePage::CodePageTrait<CodePage::Iso8859_11>::ToCodePoint(
+		    '\xDB', [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+	}
+
+	SECTION("Round trip")
+	{
+		REQUIRE(CheckRoundTrip<CodePage::Windows1252>() == 251);
+		REQUIRE(CheckRoundTrip<CodePage::Iso8859_2>() == 256);
+		REQUIRE(CheckRoundTrip<CodePage::Iso8859_11>() == 248);
+		REQUIRE(CheckRoundTrip<CodePage::Koi8R>() == 256);
+	}
+
+	SECTION("Encode all")
+	{
+		const auto src = std::span("\x80\xC0\xE9 r\xE9sum\xE9", 10);
+		std::u32string result;
+		Encoder<CodePage::Windows1252, CodePage::CodePoint>::EncodeAll(
+		    src, [&](auto const& encodeResult) {
+			    if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+			                  EncodingResultCode::Accept)
+			    {
+				    result.push_back(encodeResult.Result);
+			    }
+			    else
+			    {
+				    REQUIRE(false);
+			    }
+		    });
+		REQUIRE(result == U"€Àé résumé");
+
+		// 遇到未映射的编码单元时终止
+		std::size_t acceptedCount{};
+		bool rejected = false;
+		Encoder<CodePage::Windows1252, CodePage::CodePoint>::EncodeAll(
+		    std::span("abc\x81\x64", 5), [&](auto const& encodeResult) {
+			    if constexpr (GetEncodingResultCode<decltype(encodeResult)> ==
+			                  EncodingResultCode::Accept)
+			    {
+				    ++acceptedCount;
+			    }
+			    else
+			    {
+				    rejected = true;
+			    }
+		    });
+		REQUIRE(acceptedCount == 3);
+		REQUIRE(rejected);
+	}
+}
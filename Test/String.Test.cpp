@@ -1,7 +1,12 @@
+#include <Cafe/Encoding/HashedString.h>
 #include <Cafe/Encoding/Strings.h>
 #include <catch2/catch_all.hpp>
 #include <map>
+#include <random>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
 #include <Cafe/Encoding/CodePage/UTF-8.h>
@@ -137,5 +142,267 @@ TEST_CASE("Cafe.Encoding.Base.String", "[Encoding][String]")
 			static_assert(constStr == u8"Const"_u8sv);
 		}
 	}
+
+	SECTION("Find")
+	{
+		// 与朴素查找的结果比较，较小的字符集以产生大量部分匹配
+		std::minstd_rand random{ 42 };
+		for (std::size_t round = 0; round < 500; ++round)
+		{
+			std::u8string haystack(random() % 200, u8'a');
+			for (auto& item : haystack)
+			{
+				item = static_cast<char8_t>(u8'a' + random() % 3);
+			}
+			std::u8string pattern(1 + random() % 8, u8'a');
+			for (auto& item : pattern)
+			{
+				item = static_cast<char8_t>(u8'a' + random() % 3);
+			}
+
+			const StringView<CodePage::Utf8> haystackView{ std::span<const char8_t>(haystack) };
+			const StringView<CodePage::Utf8> patternView{ std::span<const char8_t>(pattern) };
+			const auto expected = haystackView.NaiveFind(patternView);
+			REQUIRE(haystackView.Find(patternView) == expected);
+			REQUIRE(haystackView.FindWithCache(patternView) == expected);
+		}
+
+		// 周期性的病态输入将改用 Two-Way 算法
+		{
+			std::u8string haystack(10000, u8'a');
+			std::u8string pattern(100, u8'a');
+			pattern.back() = u8'b';
+			const StringView<CodePage::Utf8> haystackView{ std::span<const char8_t>(haystack) };
+			const StringView<CodePage::Utf8> patternView{ std::span<const char8_t>(pattern) };
+			REQUIRE(haystackView.Find(patternView) == StringView<CodePage::Utf8>::Npos);
+
+			haystack.replace(haystack.size() - 50, 1, u8"b");
+			const StringView<CodePage::Utf8> haystackView2{ std::span<const char8_t>(haystack) };
+			REQUIRE(haystackView2.Find(patternView) == haystack.size() - 50 - 99);
+		}
+
+		// 非字符类型的编码单元
+		{
+			const CodePointType haystack[]{ 1, 2, 1, 2, 3, 1, 2, 3, 4 };
+			const CodePointType pattern[]{ 1, 2, 3, 4 };
+			REQUIRE(AsView<CodePage::CodePoint>(haystack).Find(AsView<CodePage::CodePoint>(pattern)) ==
+			        5);
+		}
+
+		static_assert(CAFE_UTF8_SV("abcabd").Find(CAFE_UTF8_SV("abd")) == 3);
+		static_assert(CAFE_UTF8_SV("abcabd").Find(CAFE_UTF8_SV("")) == 0);
+	}
+
+	SECTION("Hash")
+	{
+		const auto view = CAFE_UTF8_SV("The quick brown fox jumps over the lazy dog");
+		const auto str = view.ToString();
+		const StaticString<CodePage::Utf8, 64> staticStr{ StringView<CodePage::Utf8>{ view } };
+		const auto hashValue = std::hash<StringView<CodePage::Utf8>>{}(view);
+		REQUIRE(std::hash<String<CodePage::Utf8>>{}(str) == hashValue);
+		REQUIRE(std::hash<StaticString<CodePage::Utf8, 64>>{}(staticStr) ==
+		        StringHasher<>{}(staticStr.GetView()));
+		REQUIRE(StringHasher<>{}(view) == hashValue);
+
+		// 常量求值环境下的结果与运行时相同
+		constexpr auto constantHash =
+		    StringHasher<>{}(CAFE_UTF8_SV("The quick brown fox jumps over the lazy dog"));
+		REQUIRE(constantHash == hashValue);
+
+		// 保留的 BKDR 算法与原先的结果一致
+		std::size_t bkdrHash = 0;
+		for (const auto item : view)
+		{
+			bkdrHash = bkdrHash * 131 + item;
+		}
+		REQUIRE(StringHasher<Detail::BkdrHashPolicy>{}(view) == bkdrHash);
+
+		// 覆盖各个长度的分支
+		std::u8string text;
+		std::unordered_set<std::size_t> hashes;
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			hashes.insert(
+			    StringHasher<>{}(StringView<CodePage::Utf8>{ std::span<const char8_t>(text) }));
+			text.push_back(static_cast<char8_t>(u8'a' + i % 26));
+		}
+		REQUIRE(hashes.size() == 200);
+
+		// 多字节的编码单元按小端序处理，与平台字节序无关
+		std::u16string u16Text;
+		for (std::size_t i = 0; i < 60; ++i)
+		{
+			std::string bytes;
+			for (const auto unit : u16Text)
+			{
+				bytes.push_back(static_cast<char>(unit & 0xFF));
+				bytes.push_back(static_cast<char>(unit >> 8));
+			}
+			REQUIRE(Detail::WyHashPolicy::Hash(std::span<const char16_t>(u16Text)) ==
+			        Detail::WyHashPolicy::Hash(std::span<const char>(bytes)));
+			u16Text.push_back(static_cast<char16_t>(0x4E00 + i * 37));
+		}
+	}
+
+	SECTION("HashedString")
+	{
+		HashedString<CodePage::Utf8> str{ CAFE_UTF8_SV("abc") };
+		REQUIRE(str.GetHash() == StringHasher<>{}(CAFE_UTF8_SV("abc")));
+		REQUIRE(str == CAFE_UTF8_SV("abc"));
+
+		str.Modify([](auto& value) { value.Append(CAFE_UTF8_SV("def")); });
+		REQUIRE(str == CAFE_UTF8_SV("abcdef"));
+		REQUIRE(str.GetHash() == StringHasher<>{}(CAFE_UTF8_SV("abcdef")));
+
+		std::unordered_map<HashedString<CodePage::Utf8>, int, std::hash<HashedString<CodePage::Utf8>>,
+		                   std::equal_to<>>
+		    map;
+		map.emplace(CAFE_UTF8_SV("abc"), 1);
+		map.emplace(str, 2);
+		REQUIRE(map.size() == 2);
+		const auto iter = map.find(CAFE_UTF8_SV("abcdef"));
+		const auto b = iter != map.end();
+		REQUIRE(b);
+		REQUIRE(iter->second == 2);
+
+		// 保留的算法
+		const HashedString<CodePage::Utf8, Detail::BkdrHashPolicy> bkdrStr{ CAFE_UTF8_SV("abc") };
+		REQUIRE(bkdrStr.GetHash() == StringHasher<Detail::BkdrHashPolicy>{}(CAFE_UTF8_SV("abc")));
+	}
+
+	SECTION("CompactString")
+	{
+		static_assert(sizeof(CompactString<CodePage::Utf8>) == 3 * sizeof(void*));
+		static_assert(sizeof(CompactString<CodePage::CodePoint>) == 3 * sizeof(void*));
+
+		constexpr auto ssoLength = 3 * sizeof(void*) - 1;
+		const std::u8string shortText(ssoLength, u8'a');
+		const std::u8string longText(ssoLength + 1, u8'b');
+
+		CompactString<CodePage::Utf8> empty;
+		REQUIRE(empty.IsEmpty());
+		REQUIRE(empty.GetSize() == 1);
+		REQUIRE(empty.GetData()[0] == 0);
+
+		// 缓冲区恰好填满时最后一个字节即为结尾的空编码单元
+		CompactString<CodePage::Utf8> shortStr{ std::span<const char8_t>(shortText) };
+		REQUIRE(shortStr.GetSize() == ssoLength + 1);
+		REQUIRE(shortStr.GetCapacity() == ssoLength + 1);
+		REQUIRE(shortStr.GetData()[ssoLength] == 0);
+		REQUIRE(std::u8string_view(shortStr.GetData(), ssoLength) == shortText);
+
+		shortStr.Append(u8'b');
+		REQUIRE(shortStr.GetSize() == ssoLength + 2);
+		REQUIRE(shortStr.GetCapacity() >= ssoLength + 2);
+		REQUIRE(shortStr.GetData()[ssoLength] == u8'b');
+		REQUIRE(shortStr.GetData()[ssoLength + 1] == 0);
+
+		shortStr.RemoveBack(ssoLength - 1);
+		REQUIRE(shortStr == CAFE_UTF8_SV("aa"));
+		shortStr.ShrinkToFit();
+		REQUIRE(shortStr == CAFE_UTF8_SV("aa"));
+		REQUIRE(shortStr.GetCapacity() == ssoLength + 1);
+
+		CompactString<CodePage::Utf8> longStr{ std::span<const char8_t>(longText) };
+		REQUIRE(longStr.GetSize() == ssoLength + 2);
+		longStr.Insert(longStr.begin() + 1, CAFE_UTF8_SV("123"));
+		longStr.Remove(longStr.begin(), 1);
+		REQUIRE(std::u8string_view(longStr.GetData(), 5) == u8"123bb");
+		longStr.Reserve(100);
+		REQUIRE(longStr.GetCapacity() >= 100);
+		REQUIRE(longStr.GetSize() == ssoLength + 4);
+		longStr.ShrinkToFit();
+		REQUIRE(longStr.GetCapacity() == ssoLength + 4);
+
+		// 复制及移动
+		auto copied = longStr;
+		REQUIRE(copied == longStr.GetView());
+		REQUIRE(copied.GetData() != longStr.GetData());
+		const auto data = copied.GetData();
+		auto moved = std::move(copied);
+		REQUIRE(moved.GetData() == data);
+		REQUIRE(copied.IsEmpty());
+		copied = moved;
+		REQUIRE(copied == moved.GetView());
+		copied = std::move(shortStr);
+		REQUIRE(copied == CAFE_UTF8_SV("aa"));
+
+		// 与默认布局之间的转换
+		String<CodePage::Utf8> normal = moved;
+		REQUIRE(normal == moved.GetView());
+		CompactString<CodePage::Utf8> fromNormal = std::move(normal);
+		REQUIRE(fromNormal == moved.GetView());
+		REQUIRE(normal.IsEmpty());
+		normal = std::move(fromNormal);
+		REQUIRE(normal == moved.GetView());
+		REQUIRE(fromNormal.IsEmpty());
+
+		// 较宽的编码单元
+		CompactString<CodePage::CodePoint> codePoints;
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			codePoints.Append(static_cast<CodePointType>(0x4E00 + i));
+			REQUIRE(codePoints.GetSize() == i + 2);
+			REQUIRE(codePoints.GetData()[i] == static_cast<CodePointType>(0x4E00 + i));
+			REQUIRE(codePoints.GetData()[i + 1] == 0);
+		}
+	}
+
+	SECTION("Copy and move")
+	{
+		const std::u8string text(100, u8'a');
+		String<CodePage::Utf8> a{ std::span<const char8_t>(text) };
+		String<CodePage::Utf8> b(a);
+		REQUIRE(b.GetData() != a.GetData());
+		REQUIRE(b == a.GetView());
+		b = a;
+		REQUIRE(b.GetData() != a.GetData());
+		const auto data = a.GetData();
+		String<CodePage::Utf8> c(std::move(a));
+		REQUIRE(c.GetData() == data);
+		b = std::move(c);
+		REQUIRE(b.GetData() == data);
+	}
+
+	SECTION("Concat")
+	{
+		const auto prefix = CAFE_UTF8_SV("[");
+		const auto suffix = CAFE_UTF8_SV("]");
+		const String<CodePage::Utf8> body = CAFE_UTF8_SV("body");
+
+		// StringView 相加产生延迟的表达式，转换为 String 时一次性分配
+		const auto expression = prefix + CAFE_UTF8_SV("info") + suffix + body;
+		REQUIRE(expression.GetSize() == 10);
+		const String<CodePage::Utf8> joined = expression;
+		REQUIRE(joined == CAFE_UTF8_SV("[info]body"));
+		REQUIRE((body + (prefix + suffix)).ToString() == CAFE_UTF8_SV("body[]"));
+		REQUIRE((prefix + suffix) + u8"!"_u8s == CAFE_UTF8_SV("[]!"));
+		REQUIRE(u8"!"_u8s + (prefix + suffix) == CAFE_UTF8_SV("![]"));
+
+		const std::u8string longText(100, u8'a');
+		const StringView<CodePage::Utf8> longView{ std::span<const char8_t>(longText) };
+		const String<CodePage::Utf8> longJoined = prefix + longView + suffix;
+		REQUIRE(longJoined.GetSize() == 103);
+		REQUIRE(longJoined.GetCapacity() == 103);
+
+		// String 与 StringView 相加时同样仅分配一次
+		const String<CodePage::Utf8> longStr{ longView };
+		const auto added = longStr + longView;
+		REQUIRE(added.GetSize() == 201);
+		REQUIRE(added.GetCapacity() == 201);
+
+		REQUIRE(Concat(prefix, body, suffix) == CAFE_UTF8_SV("[body]"));
+		REQUIRE(Concat<CodePage::Utf8>() == CAFE_UTF8_SV(""));
+		const auto longConcat = Concat(longView, body, longStr);
+		REQUIRE(longConcat.GetSize() == 205);
+		REQUIRE(longConcat.GetCapacity() == 205);
+
+		// 不同代码页的部分被编码
+		const std::vector<CodePointType> codePoints{ 0x4E2D, 0x6587 };
+		const auto mixed = Concat<CodePage::Utf8>(
+		    prefix, StringView<CodePage::CodePoint>{ std::span<const CodePointType>(codePoints) },
+		    suffix);
+		REQUIRE(mixed == CAFE_UTF8_SV("[\xE4\xB8\xAD\xE6\x96\x87]"));
+	}
 }
 #endif
@@ -0,0 +1,88 @@
+#include <Cafe/Encoding/StringArena.h>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <string>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+#include <Cafe/Encoding/CodePage/UTF-16.h>
+#endif
+
+using namespace Cafe;
+using namespace Encoding;
+
+TEST_CASE("Cafe.Encoding.Base.StringArena", "[Encoding][StringArena]")
+{
+	SECTION("Allocate")
+	{
+		StringArena arena{ 64 };
+		const auto a = static_cast<std::byte*>(arena.Allocate(10, 1));
+		const auto b = static_cast<std::byte*>(arena.Allocate(8, 8));
+		REQUIRE(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+		REQUIRE(b >= a + 10);
+		REQUIRE(arena.GetReservedSize() == 64);
+
+		// 最后一次分配可被回收
+		arena.Deallocate(b, 8);
+		REQUIRE(arena.Allocate(8, 8) == b);
+
+		// 超过块大小的分配单独占用一块
+		const auto large = static_cast<std::byte*>(arena.Allocate(100, 1));
+		REQUIRE(arena.GetReservedSize() == 164);
+
+		// Reset 后复用已分配的块，第一块放不下时使用之前单独分配的块
+		arena.Reset();
+		REQUIRE(arena.Allocate(10, 1) == a);
+		REQUIRE(arena.Allocate(60, 1) == large);
+		REQUIRE(arena.Allocate(40, 1) == large + 60);
+		REQUIRE(arena.GetReservedSize() == 164);
+
+		arena.Release();
+		REQUIRE(arena.GetReservedSize() == 0);
+	}
+
+	SECTION("String")
+	{
+		StringArena arena;
+		auto str = arena.MakeString<CodePage::Utf8>();
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			str.Append(CAFE_UTF8_SV("abc"));
+		}
+		REQUIRE(str.GetSize() == 301);
+		REQUIRE(str.GetView().Find(CAFE_UTF8_SV("cab")) == 2);
+
+		const auto copied = str;
+		REQUIRE(copied == str.GetView());
+
+		const auto view = arena.Copy(CAFE_UTF8_SV("abc"));
+		REQUIRE(view == CAFE_UTF8_SV("abc"));
+		REQUIRE(view.GetSize() == 4);
+
+		const auto fromView = arena.MakeString(CAFE_UTF8_SV("def"));
+		REQUIRE(fromView == CAFE_UTF8_SV("def"));
+	}
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+	SECTION("Encode")
+	{
+		StringArena arena;
+		const auto [resultCode, utf16] = arena.Encode<CodePage::Utf16LittleEndian>(
+		    CAFE_UTF8_SV("\xE4\xB8\xAD\xE6\x96\x87\xF0\xA4\xAD\xA2"));
+		REQUIRE(resultCode == EncodingResultCode::Accept);
+		REQUIRE(utf16.GetSize() == 5);
+		REQUIRE(std::u16string_view(utf16.GetData(), 4) == u"\x4E2D\x6587\xD852\xDF62");
+		REQUIRE(utf16.GetData()[4] == 0);
+
+		// 失败时保留已编码的部分
+		const auto [failedResultCode, partial] =
+		    arena.Encode<CodePage::Utf16LittleEndian>(CAFE_UTF8_SV("ab\xFF"));
+		REQUIRE(failedResultCode != EncodingResultCode::Accept);
+		REQUIRE(std::u16string_view(partial.GetData()) == u"ab");
+	}
+#endif
+}
+
+#endif
@@ -0,0 +1,97 @@
+#include <Cafe/Encoding/StringBuilder.h>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <vector>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+#include <Cafe/Encoding/CodePage/UTF-16.h>
+#endif
+
+using namespace Cafe;
+using namespace Encoding;
+
+TEST_CASE("Cafe.Encoding.Base.StringBuilder", "[Encoding][StringBuilder]")
+{
+	SECTION("Append")
+	{
+		// 较小的块以经过跨越块的路径
+		StringBuilder<CodePage::Utf8> builder{ 4 };
+		REQUIRE(builder.IsEmpty());
+		REQUIRE(builder.ToString() == CAFE_UTF8_SV(""));
+
+		builder.Append(CAFE_UTF8_SV("abc"));
+		builder.Append(CAFE_UTF8_SV("defghij"));
+		builder.Append(u8'x', 6);
+		REQUIRE(builder.GetSize() == 16);
+
+		const auto str = builder.ToString();
+		REQUIRE(str == CAFE_UTF8_SV("abcdefghijxxxxxx"));
+
+		std::vector<std::size_t> chunkSizes;
+		builder.ForEachChunk(
+		    [&](std::span<const char8_t> const& chunk) { chunkSizes.push_back(chunk.size()); });
+		REQUIRE(chunkSizes == std::vector<std::size_t>{ 4, 4, 4, 4 });
+
+		std::size_t count = 0;
+		builder.ForEachChunk([&](std::span<const char8_t> const&) -> Core::Misc::ControlFlowVariant<> {
+			++count;
+			return Core::Misc::BreakType{};
+		});
+		REQUIRE(count == 1);
+
+		// 内容中的 0 被保留，包括位于块结尾的连续的 0
+		builder.Append(u8'\0');
+		const auto withNull = builder.ToString();
+		REQUIRE(withNull.GetSize() == 18);
+		REQUIRE(withNull.GetData()[16] == 0);
+		builder.Append(u8'\0', 3);
+		const auto withNulls = builder.ToString();
+		REQUIRE(withNulls.GetSize() == 21);
+		REQUIRE(std::u8string_view(withNulls.GetData() + 14, 7) ==
+		        std::u8string_view(u8"xx\0\0\0\0\0", 7));
+
+		// 复用已分配的块
+		builder.Clear();
+		REQUIRE(builder.IsEmpty());
+		builder.Append(CAFE_UTF8_SV("12345"));
+		REQUIRE(builder.ToString() == CAFE_UTF8_SV("12345"));
+	}
+
+	SECTION("Large")
+	{
+		StringBuilder<CodePage::Utf8> builder;
+		std::u8string expected;
+		for (std::size_t i = 0; i < 10000; ++i)
+		{
+			builder.Append(CAFE_UTF8_SV("line "));
+			builder.Append(static_cast<char8_t>(u8'0' + i % 10));
+			builder.Append(CAFE_UTF8_SV("\n"));
+			expected += u8"line ";
+			expected += static_cast<char8_t>(u8'0' + i % 10);
+			expected += u8"\n";
+		}
+		const auto str = builder.ToString();
+		REQUIRE(std::u8string_view(str.GetData(), str.GetSize() - 1) == expected);
+		REQUIRE(str.GetCapacity() == str.GetSize());
+	}
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+	SECTION("Encode")
+	{
+		StringBuilder<CodePage::Utf8> builder{ 3 };
+		REQUIRE(builder.Append(StringView<CodePage::Utf16LittleEndian>{ std::span<const char16_t>(
+		            u"\x4E2D\x6587\xD852\xDF62", 4) }) == EncodingResultCode::Accept);
+		REQUIRE(builder.AppendCodePoint(U'!') == EncodingResultCode::Accept);
+		REQUIRE(builder.ToString() == CAFE_UTF8_SV("\xE4\xB8\xAD\xE6\x96\x87\xF0\xA4\xAD\xA2!"));
+
+		StringBuilder<CodePage::Utf16LittleEndian> utf16Builder;
+		REQUIRE(utf16Builder.Append(CAFE_UTF8_SV("ab\xFF")) != EncodingResultCode::Accept);
+		REQUIRE(utf16Builder.GetSize() == 2);
+	}
+#endif
+}
+
+#endif
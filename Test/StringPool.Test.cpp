@@ -0,0 +1,111 @@
+#include <Cafe/Encoding/StringPool.h>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>)
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+using namespace Cafe;
+using namespace Encoding;
+
+TEST_CASE("Cafe.Encoding.Base.StringPool", "[Encoding][StringPool]")
+{
+	SECTION("Intern")
+	{
+		StringPool<CodePage::Utf8> pool;
+		const auto a = pool.Intern(CAFE_UTF8_SV("abc"));
+		const auto b = pool.Intern(CAFE_UTF8_SV("def"));
+		REQUIRE(a != b);
+		REQUIRE(pool.Intern(CAFE_UTF8_SV("abc")) == a);
+		REQUIRE(pool.GetCount() == 2);
+
+		REQUIRE(a.GetView() == CAFE_UTF8_SV("abc"));
+		REQUIRE(a.GetView().GetSize() == 4);
+		REQUIRE(a.GetHash() ==
+		        Detail::DefaultHashPolicy::Hash(CAFE_UTF8_SV("abc").GetTrimmedSpan()));
+		REQUIRE(std::hash<InternedString<CodePage::Utf8>>{}(b) == b.GetHash());
+
+		// 是否以 0 结尾不影响结果
+		const std::u8string text = u8"abc";
+		REQUIRE(pool.Intern(StringView<CodePage::Utf8>{ std::span<const char8_t>(text) }) == a);
+
+		REQUIRE(pool.Find(CAFE_UTF8_SV("def")) == b);
+		REQUIRE(!pool.Find(CAFE_UTF8_SV("xyz")));
+
+		const auto empty = pool.Intern(CAFE_UTF8_SV(""));
+		REQUIRE(empty.GetView().GetSize() == 1);
+		REQUIRE(InternedString<CodePage::Utf8>{}.IsNull());
+	}
+
+	SECTION("Stable storage")
+	{
+		StringPool<CodePage::Utf8> pool{ 256 };
+		std::vector<InternedString<CodePage::Utf8>> handles;
+		std::vector<std::u8string> texts;
+		for (std::size_t i = 0; i < 2000; ++i)
+		{
+			texts.push_back(u8"item" + std::u8string(i % 50, u8'x') +
+			                std::u8string(reinterpret_cast<const char8_t*>(std::to_string(i).c_str())));
+			handles.push_back(pool.Intern(
+			    StringView<CodePage::Utf8>{ std::span<const char8_t>(texts.back()) }));
+		}
+		REQUIRE(pool.GetCount() == 2000);
+
+		std::unordered_set<InternedString<CodePage::Utf8>> set(handles.begin(), handles.end());
+		REQUIRE(set.size() == 2000);
+
+		for (std::size_t i = 0; i < texts.size(); ++i)
+		{
+			const auto view = handles[i].GetView();
+			REQUIRE(std::u8string_view(view.GetData(), view.GetSize() - 1) == texts[i]);
+			REQUIRE(pool.Intern(StringView<CodePage::Utf8>{ std::span<const char8_t>(texts[i]) }) ==
+			        handles[i]);
+		}
+	}
+
+	SECTION("Concurrent")
+	{
+		constexpr std::size_t ThreadCount = 8;
+		constexpr std::size_t ItemCount = 4096;
+
+		std::vector<std::u8string> texts;
+		for (std::size_t i = 0; i < ItemCount; ++i)
+		{
+			texts.push_back(
+			    std::u8string(reinterpret_cast<const char8_t*>(std::to_string(i * 7919).c_str())));
+		}
+
+		StringPool<CodePage::Utf8> pool;
+		std::vector<std::vector<InternedString<CodePage::Utf8>>> results(ThreadCount);
+		std::vector<std::thread> threads;
+		for (std::size_t t = 0; t < ThreadCount; ++t)
+		{
+			threads.emplace_back([&, t] {
+				auto& result = results[t];
+				result.resize(ItemCount);
+				// 各线程以不同的顺序插入，ItemCount 为 2 的幂因此奇数倍的排列仍覆盖所有元素
+				for (std::size_t i = 0; i < ItemCount; ++i)
+				{
+					const auto index = (i * (2 * t + 1) + t * 101) % ItemCount;
+					result[index] = pool.Intern(
+					    StringView<CodePage::Utf8>{ std::span<const char8_t>(texts[index]) });
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		REQUIRE(pool.GetCount() == ItemCount);
+		for (std::size_t t = 1; t < ThreadCount; ++t)
+		{
+			REQUIRE(results[t] == results[0]);
+		}
+	}
+}
+
+#endif
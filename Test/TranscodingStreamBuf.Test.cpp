@@ -0,0 +1,90 @@
+#include <Cafe/Encoding/TranscodingStreamBuf.h>
+#include <catch2/catch_all.hpp>
+#include <iterator>
+#include <sstream>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>) && __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+
+#include <Cafe/Encoding/CodePage/UTF-16.h>
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+using namespace Cafe;
+using namespace Encoding;
+
+namespace
+{
+	template <typename CharType>
+	std::string ToBytes(std::basic_string_view<CharType> str)
+	{
+		return std::string(reinterpret_cast<const char*>(str.data()), str.size() * sizeof(CharType));
+	}
+
+	std::string ReadAll(std::streambuf& streamBuf)
+	{
+		return std::string(std::istreambuf_iterator<char>(&streamBuf),
+		                   std::istreambuf_iterator<char>());
+	}
+} // namespace
+
+TEST_CASE("Cafe.Encoding.Base.TranscodingStreamBuf", "[Encoding][TranscodingStreamBuf]")
+{
+	const std::u16string_view u16Str = u"ASCII \xD852\xDF62 \x4E2D\x6587\xFEFF end";
+	const std::string_view u8Str =
+	    "ASCII \xF0\xA4\xAD\xA2 \xE4\xB8\xAD\xE6\x96\x87\xEF\xBB\xBF end";
+
+	SECTION("Read")
+	{
+		// 较小且为奇数的块大小，使编码单元及字符跨越块边界
+		for (const std::size_t bufferSize : { 5, 7, 64 })
+		{
+			std::stringbuf underlying{ ToBytes(u16Str) };
+			TranscodingStreamBuf<CodePage::Utf16LittleEndian, CodePage::Utf8> streamBuf{
+				&underlying, bufferSize
+			};
+			REQUIRE(ReadAll(streamBuf) == u8Str);
+			REQUIRE(streamBuf.GetResultCode() == EncodingResultCode::Accept);
+		}
+	}
+
+	SECTION("Write")
+	{
+		for (const std::size_t bufferSize : { 4, 7, 64 })
+		{
+			std::stringbuf underlying;
+			{
+				TranscodingStreamBuf<CodePage::Utf8, CodePage::Utf16LittleEndian> streamBuf{
+					&underlying, bufferSize
+				};
+				std::ostream stream{ &streamBuf };
+				stream << u8Str.substr(0, 8);
+				for (const auto ch : u8Str.substr(8))
+				{
+					stream.put(ch);
+				}
+				stream.flush();
+				REQUIRE(stream.good());
+				REQUIRE(streamBuf.GetResultCode() == EncodingResultCode::Accept);
+			}
+			REQUIRE(underlying.str() == ToBytes(u16Str));
+		}
+	}
+
+	SECTION("Invalid input")
+	{
+		std::stringbuf rejected{ "abc\xFF" "def" };
+		TranscodingStreamBuf<CodePage::Utf8, CodePage::Utf16LittleEndian> rejectedStreamBuf{
+			&rejected, 16
+		};
+		REQUIRE(ReadAll(rejectedStreamBuf) == ToBytes(std::u16string_view(u"abc")));
+		REQUIRE(rejectedStreamBuf.GetResultCode() == EncodingResultCode::Reject);
+
+		std::stringbuf truncated{ "abc\xE4\xB8" };
+		TranscodingStreamBuf<CodePage::Utf8, CodePage::Utf16LittleEndian> truncatedStreamBuf{
+			&truncated, 16
+		};
+		REQUIRE(ReadAll(truncatedStreamBuf) == ToBytes(std::u16string_view(u"abc")));
+		REQUIRE(truncatedStreamBuf.GetResultCode() == EncodingResultCode::Incomplete);
+	}
+}
+
+#endif
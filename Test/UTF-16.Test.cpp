@@ -64,4 +64,32 @@ TEST_CASE("Cafe.Encoding.UTF-16", "[Encoding][UTF-16]")
 			    }
 		    });
 	}
+
+	SECTION("Backward")
+	{
+		const auto u16Str = u"a\xD852\xDF62";
+		CodePage::CodePageTrait<CodePage::Utf16LittleEndian>::ToCodePointBackward(
+		    std::span(u16Str, 3), [](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    REQUIRE(result.AdvanceCount == 2);
+				    REQUIRE(result.Result == 0x24B62);
+			    }
+			    else
+			    {
+				    REQUIRE(false);
+			    }
+		    });
+
+		CodePage::CodePageTrait<CodePage::Utf16LittleEndian>::ToCodePointBackward(
+		    std::span(u16Str, 2), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Incomplete);
+		    });
+
+		// 孤立的后尾代理
+		CodePage::CodePageTrait<CodePage::Utf16LittleEndian>::ToCodePointBackward(
+		    std::span(u"a\xDF62", 2), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+	}
 }
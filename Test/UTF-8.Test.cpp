@@ -33,4 +33,46 @@ TEST_CASE("Cafe.Encoding.UTF-8", "[Encoding][UTF-8]")
 			    }
 		    });
 	}
+
+	SECTION("Backward")
+	{
+		const auto u8Str = u8"a\xE4\xB8\xAD\xF0\xA4\xAD\xA2";
+		CodePage::CodePageTrait<CodePage::Utf8>::ToCodePointBackward(
+		    std::span(u8Str, 8), [](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    REQUIRE(result.AdvanceCount == 4);
+				    REQUIRE(result.Result == 0x24B62);
+			    }
+			    else
+			    {
+				    REQUIRE(false);
+			    }
+		    });
+
+		CodePage::CodePageTrait<CodePage::Utf8>::ToCodePointBackward(
+		    std::span(u8Str, 4), [](auto const& result) {
+			    if constexpr (GetEncodingResultCode<decltype(result)> == EncodingResultCode::Accept)
+			    {
+				    REQUIRE(result.AdvanceCount == 3);
+				    REQUIRE(result.Result == 0x4E2D);
+			    }
+			    else
+			    {
+				    REQUIRE(false);
+			    }
+		    });
+
+		// 结尾的字符不完整
+		CodePage::CodePageTrait<CodePage::Utf8>::ToCodePointBackward(
+		    std::span(u8Str, 7), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Incomplete);
+		    });
+
+		// 多余的后续编码单元
+		CodePage::CodePageTrait<CodePage::Utf8>::ToCodePointBackward(
+		    std::span(u8"a\xAD", 2), [](auto const& result) {
+			    REQUIRE(GetEncodingResultCode<decltype(result)> == EncodingResultCode::Reject);
+		    });
+	}
 }
@@ -0,0 +1,126 @@
+#include <Cafe/Encoding/Views.h>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <vector>
+
+#if __has_include(<Cafe/Encoding/CodePage/UTF-8.h>) && __has_include(<Cafe/Encoding/CodePage/UTF-16.h>)
+
+#include <Cafe/Encoding/CodePage/UTF-16.h>
+#include <Cafe/Encoding/CodePage/UTF-8.h>
+
+using namespace Cafe;
+using namespace Encoding;
+
+static_assert(std::ranges::forward_range<DecodeView<CodePage::Utf8>>);
+static_assert(std::ranges::view<DecodeView<CodePage::Utf8>>);
+static_assert(std::ranges::forward_range<TranscodeView<CodePage::Utf8, CodePage::Utf16LittleEndian>>);
+static_assert(std::bidirectional_iterator<DecodeIterator<CodePage::CodePoint>>);
+static_assert(std::bidirectional_iterator<DecodeIterator<CodePage::Utf8>>);
+static_assert(std::ranges::forward_range<ReverseDecodeView<CodePage::Utf16LittleEndian>>);
+
+TEST_CASE("Cafe.Encoding.Base.Views", "[Encoding][Views]")
+{
+	const auto u8Str = CAFE_UTF8_SV("a中\U00024B62b");
+
+	SECTION("Decode")
+	{
+		std::vector<CodePointType> codePoints;
+		for (const auto codePoint : u8Str | Views::Decode)
+		{
+			codePoints.push_back(codePoint);
+		}
+		REQUIRE(codePoints == std::vector<CodePointType>{ 0x61, 0x4E2D, 0x24B62, 0x62 });
+
+		// 仅解码需要的字符
+		std::vector<CodePointType> firstTwo;
+		for (const auto codePoint : Views::Decode(u8Str) | std::views::take(2))
+		{
+			firstTwo.push_back(codePoint);
+		}
+		REQUIRE(firstTwo == std::vector<CodePointType>{ 0x61, 0x4E2D });
+
+		const auto str = u8Str.ToString();
+		REQUIRE(std::ranges::distance(str | Views::Decode) == 4);
+	}
+
+	SECTION("Transcode")
+	{
+		std::u16string u16Str;
+		for (const auto codeUnit : u8Str | Views::Transcode<CodePage::Utf16LittleEndian>)
+		{
+			u16Str.push_back(codeUnit);
+		}
+		REQUIRE(u16Str == u"a中\U00024B62b");
+
+		const StringView<CodePage::Utf16LittleEndian> u16View{ std::span<const char16_t>(u16Str) };
+		std::u8string roundTrip;
+		for (const auto codeUnit : u16View | Views::Transcode<CodePage::Utf8>)
+		{
+			roundTrip.push_back(codeUnit);
+		}
+		REQUIRE(roundTrip == u8Str.Trim().ToStdStringView());
+	}
+
+	SECTION("Reverse decode")
+	{
+		std::vector<CodePointType> codePoints;
+		for (const auto codePoint : u8Str | Views::ReverseDecode)
+		{
+			codePoints.push_back(codePoint);
+		}
+		REQUIRE(codePoints == std::vector<CodePointType>{ 0x62, 0x24B62, 0x4E2D, 0x61 });
+
+		const auto view = u8Str | Views::Decode;
+		auto iter = std::ranges::next(view.begin(), 3);
+		REQUIRE(*iter == 0x62);
+		--iter;
+		REQUIRE(*iter == 0x24B62);
+		REQUIRE(iter.GetWidth() == 4);
+		--iter;
+		REQUIRE(*iter == 0x4E2D);
+
+		// 按码点去除结尾空白
+		const auto withSpaces = AsView<CodePage::Utf8>(u8"中 \u3000 ");
+		auto reverseIter = (withSpaces | Views::ReverseDecode).begin();
+		while (reverseIter != std::default_sentinel &&
+		       (*reverseIter == U' ' || *reverseIter == U'\u3000'))
+		{
+			++reverseIter;
+		}
+		REQUIRE(*reverseIter == 0x4E2D);
+		const auto trimmed = withSpaces.SubStr(
+		    0, reverseIter.GetPosition() + reverseIter.GetWidth() - withSpaces.GetData());
+		REQUIRE(trimmed == AsView<CodePage::Utf8>(u8"中").Trim());
+
+		const auto invalid = AsView<CodePage::Utf8>(u8"a\xFF" "bc");
+		auto invalidIter = (invalid | Views::ReverseDecode).begin();
+		REQUIRE(*invalidIter++ == U'c');
+		REQUIRE(*invalidIter++ == U'b');
+		REQUIRE(invalidIter == std::default_sentinel);
+		REQUIRE(invalidIter.GetResultCode() == EncodingResultCode::Reject);
+	}
+
+	SECTION("Error")
+	{
+		const auto invalid = AsView<CodePage::Utf8>(u8"ab\xFF" "c");
+		const auto view = invalid | Views::Decode;
+		auto iter = view.begin();
+		std::size_t count = 0;
+		for (; iter != view.end(); ++iter)
+		{
+			++count;
+		}
+		REQUIRE(count == 2);
+		REQUIRE(iter.GetResultCode() == EncodingResultCode::Reject);
+		REQUIRE(iter.GetPosition() - invalid.GetData() == 2);
+
+		const auto incomplete = AsView<CodePage::Utf8>(u8"a\xE4\xB8");
+		auto transcodeIter = (incomplete | Views::Transcode<CodePage::Utf16LittleEndian>).begin();
+		REQUIRE(*transcodeIter == u'a');
+		++transcodeIter;
+		REQUIRE(transcodeIter == std::default_sentinel);
+		REQUIRE(transcodeIter.GetResultCode() == EncodingResultCode::Incomplete);
+	}
+}
+
+#endif
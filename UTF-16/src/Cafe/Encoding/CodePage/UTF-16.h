@@ -123,6 +123,60 @@ namespace Cafe::Encoding
 					}
 				}
 
+				/// @brief  转换 span 结尾的字符
+				/// @remark 结果的 AdvanceCount 为从结尾向前消耗的编码单元个数
+				template <std::size_t Extent, typename OutputReceiver>
+				static constexpr void
+				ToCodePointBackward(std::span<const CharType, Extent> const& span,
+				                    OutputReceiver&& receiver)
+				{
+					const auto size = span.size();
+					if (!size)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<Utf16, CodePoint, EncodingResultCode::Incomplete>{ 0,
+						                                                                      1 });
+						return;
+					}
+
+					switch (GetWidth(span[size - 1]))
+					{
+					default:
+						assert(!"Should never happen.");
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<Utf16, CodePoint, EncodingResultCode::Reject>{});
+						break;
+					case 1:
+						ToCodePoint(span.subspan(size - 1), std::forward<OutputReceiver>(receiver));
+						break;
+					case 2:
+						// 结尾是前导代理，缺少后尾代理
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<Utf16, CodePoint, EncodingResultCode::Incomplete>{ 0,
+						                                                                      1 });
+						break;
+					case -1:
+						if (size < 2)
+						{
+							std::forward<OutputReceiver>(receiver)(
+							    EncodingResult<Utf16, CodePoint, EncodingResultCode::Incomplete>{
+							        -1 });
+						}
+						else if (GetWidth(span[size - 2]) != 2)
+						{
+							// 孤立的后尾代理
+							std::forward<OutputReceiver>(receiver)(
+							    EncodingResult<Utf16, CodePoint, EncodingResultCode::Reject>{});
+						}
+						else
+						{
+							ToCodePoint(span.subspan(size - 2),
+							            std::forward<OutputReceiver>(receiver));
+						}
+						break;
+					}
+				}
+
 				template <typename OutputReceiver>
 				static constexpr void FromCodePoint(CodePointType codePoint,
 				                                    OutputReceiver&& receiver)
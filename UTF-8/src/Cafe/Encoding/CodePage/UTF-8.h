@@ -182,6 +182,62 @@ namespace Cafe::Encoding
 				}
 			}
 
+			/// @brief  由编码单元转换为码点，但转换的是 span 结尾的字符
+			/// @remark 结果的 AdvanceCount 为从结尾向前消耗的编码单元个数
+			///         由于后续编码单元可被识别，向前至多检查 MaxWidth 个编码单元即可找到首位
+			template <std::size_t Extent, typename OutputReceiver>
+			static constexpr void ToCodePointBackward(std::span<const CharType, Extent> const& span,
+			                                          OutputReceiver&& receiver)
+			{
+				const auto size = span.size();
+				if (size <= 0)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<Utf8, CodePoint, EncodingResultCode::Incomplete>{ 0, 1 });
+					return;
+				}
+
+				auto leadPos = size - 1;
+				std::size_t count = 1;
+				while ((static_cast<std::make_unsigned_t<CharType>>(span[leadPos]) & 0xC0) == 0x80)
+				{
+					if (count == MaxWidth)
+					{
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<Utf8, CodePoint, EncodingResultCode::Reject>{});
+						return;
+					}
+
+					if (leadPos == 0)
+					{
+						// 首位在 span 之前
+						std::forward<OutputReceiver>(receiver)(
+						    EncodingResult<Utf8, CodePoint, EncodingResultCode::Incomplete>{ -1 });
+						return;
+					}
+
+					--leadPos;
+					++count;
+				}
+
+				const auto width = GetWidth(span[leadPos]);
+				if (width <= 0 || static_cast<std::size_t>(width) < count)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<Utf8, CodePoint, EncodingResultCode::Reject>{});
+				}
+				else if (static_cast<std::size_t>(width) > count)
+				{
+					std::forward<OutputReceiver>(receiver)(
+					    EncodingResult<Utf8, CodePoint, EncodingResultCode::Incomplete>{
+					        0, static_cast<std::size_t>(width) - count });
+				}
+				else
+				{
+					ToCodePoint(span.subspan(leadPos), std::forward<OutputReceiver>(receiver));
+				}
+			}
+
 			/// @brief  从码点转换为编码单元
 			/// @remark receiver 应可接受 EncodingResult 中 FromCodePage 是 CodePoint，
 			///         ToCodePage 是当前代码页，所有结果代码的实例
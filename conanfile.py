@@ -5,9 +5,10 @@ Options = [
     ("CAFE_INCLUDE_TESTS", [True, False], False),
 
     # Cafe.Encoding
-    ("CAFE_ENCODING_INCLUDE_ENCODING_LIST", "ANY", "UTF-8,UTF-16,UTF-32,GB2312"),
+    ("CAFE_ENCODING_INCLUDE_ENCODING_LIST", "ANY", "UTF-8,UTF-16,UTF-32,ISO-8859-1,GB2312,GB18030"),
     ("CAFE_ENCODING_INCLUDE_UNICODE_DATA", [True, False], True),
     ("CAFE_ENCODING_INCLUDE_RUNTIME_ENCODING", [True, False], True),
+    ("CAFE_ENCODING_GB2312_COMPILED_TABLE", [True, False], False),
 ]
 
 
@@ -28,7 +29,7 @@ class CafeEncodingConan(ConanFile):
 
     generators = "cmake"
 
-    exports_sources = "CMakeLists.txt", "CafeCommon*", "Base*", "GB2312*", "RuntimeEncoding*", "UnicodeData*", "UTF-8*", "UTF-16*", "UTF-32*", "Test*"
+    exports_sources = "CMakeLists.txt", "CafeCommon*", "Base*", "DoubleByte*", "GB2312*", "GB18030*", "ISO-8859-1*", "RuntimeEncoding*", "SingleByte*", "UnicodeData*", "UTF-8*", "UTF-16*", "UTF-32*", "Test*"
 
     def requirements(self):
         if self.options.CAFE_INCLUDE_TESTS:
@@ -55,3 +56,6 @@ class CafeEncodingConan(ConanFile):
         self.python_requires["CafeCommon"].module.addCafeSharedCompileOptions(self)
         self.cpp_info.libs = [
             "Cafe.Encoding.RuntimeEncoding", "Cafe.Encoding.UnicodeData"]
+        if self.options.CAFE_ENCODING_GB2312_COMPILED_TABLE:
+            self.cpp_info.libs.append("Cafe.Encoding.GB2312")
+            self.cpp_info.defines.append("CAFE_ENCODING_GB2312_COMPILED_TABLE=1")